@@ -0,0 +1,294 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package main
+
+import (
+	"math/rand/v2"
+	"slices"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/activation"
+	"github.com/ajroetker/go-highway/hwy/contrib/algo"
+	"github.com/ajroetker/go-highway/hwy/contrib/matmul"
+	"github.com/ajroetker/go-highway/hwy/contrib/matvec"
+	"github.com/ajroetker/go-highway/hwy/contrib/nn"
+	"github.com/ajroetker/go-highway/hwy/contrib/stats"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec"
+)
+
+// benchCase benchmarks one dispatch group on float32 data.
+type benchCase struct {
+	// Group is the dispatch group, e.g. "vec.Dot".
+	Group string
+	// Dims is true when sizes are square matrix dimensions rather than
+	// vector lengths.
+	Dims bool
+	// Bytes is the minimum memory traffic of one call of size n.
+	Bytes func(n int) float64
+	// Flops is the floating-point operation count of one call of size n,
+	// or nil for kernels dominated by transcendentals or comparisons.
+	Flops func(n int) float64
+	// Setup allocates the inputs of size n and returns the call to time.
+	Setup func(n int) func()
+	// Generated is true for cases derived from a variable's signature by
+	// generatedCases rather than written in benchCases.
+	Generated bool
+}
+
+// sink keeps kernel results alive.
+var sink float32
+
+func perElem(k float64) func(n int) float64 {
+	return func(n int) float64 { return k * float64(n) }
+}
+
+// randFloats returns n deterministic values in [-1, 1).
+func randFloats(n int) []float32 {
+	r := rand.New(rand.NewPCG(uint64(n), 1))
+	s := make([]float32, n)
+	for i := range s {
+		s[i] = 2*r.Float32() - 1
+	}
+	return s
+}
+
+// benchCases are the benchmarked dispatch groups. Bytes count each input
+// read once and each output written once, 4 bytes per element.
+var benchCases = []benchCase{
+	{
+		Group: "vec.Dot", Bytes: perElem(8), Flops: perElem(2),
+		Setup: func(n int) func() {
+			a, b := randFloats(n), randFloats(n)
+			return func() { sink = vec.Dot(a, b) }
+		},
+	},
+	{
+		Group: "vec.Sum", Bytes: perElem(4), Flops: perElem(1),
+		Setup: func(n int) func() {
+			a := randFloats(n)
+			return func() { sink = vec.Sum(a) }
+		},
+	},
+	{
+		Group: "vec.SquaredNorm", Bytes: perElem(4), Flops: perElem(2),
+		Setup: func(n int) func() {
+			a := randFloats(n)
+			return func() { sink = vec.SquaredNorm(a) }
+		},
+	},
+	{
+		Group: "vec.L2SquaredDistance", Bytes: perElem(8), Flops: perElem(3),
+		Setup: func(n int) func() {
+			a, b := randFloats(n), randFloats(n)
+			return func() { sink = vec.L2SquaredDistance(a, b) }
+		},
+	},
+	{
+		Group: "vec.Add", Bytes: perElem(12), Flops: perElem(1),
+		Setup: func(n int) func() {
+			dst, s := randFloats(n), randFloats(n)
+			return func() { vec.Add(dst, s) }
+		},
+	},
+	{
+		Group: "stats.Moments", Bytes: perElem(4),
+		Setup: func(n int) func() {
+			x := randFloats(n)
+			return func() { sink, _, _, _ = stats.Moments(x, 0) }
+		},
+	},
+	{
+		Group: "activation.GELU", Bytes: perElem(8),
+		Setup: func(n int) func() {
+			in, out := randFloats(n), make([]float32, n)
+			return func() { activation.GELU(in, out) }
+		},
+	},
+	{
+		Group: "algo.ExpTransform", Bytes: perElem(8),
+		Setup: func(n int) func() {
+			in, out := randFloats(n), make([]float32, n)
+			return func() { algo.ExpTransform(in, out) }
+		},
+	},
+	{
+		Group: "nn.Softmax", Bytes: perElem(8),
+		Setup: func(n int) func() {
+			in, out := randFloats(n), make([]float32, n)
+			return func() { nn.Softmax(in, out) }
+		},
+	},
+	{
+		Group: "nn.LayerNorm", Bytes: perElem(16),
+		Setup: func(n int) func() {
+			in, out := randFloats(n), make([]float32, n)
+			gamma, beta := randFloats(n), randFloats(n)
+			return func() { nn.LayerNorm(in, out, n, gamma, beta, 1e-5) }
+		},
+	},
+	{
+		Group: "matvec.MatVec", Dims: true,
+		Bytes: func(n int) float64 { return 4 * float64(n*n+2*n) },
+		Flops: func(n int) float64 { return 2 * float64(n) * float64(n) },
+		Setup: func(n int) func() {
+			m, v, result := randFloats(n*n), randFloats(n), make([]float32, n)
+			return func() { matvec.MatVec(m, n, n, v, result) }
+		},
+	},
+	{
+		Group: "matmul.MatMul", Dims: true,
+		Bytes: func(n int) float64 { return 4 * 3 * float64(n) * float64(n) },
+		Flops: matMulFlops,
+		Setup: matMulSetup,
+	},
+}
+
+func matMulFlops(n int) float64 {
+	return 2 * float64(n) * float64(n) * float64(n)
+}
+
+func matMulSetup(n int) func() {
+	a, b, c := randFloats(n*n), randFloats(n*n), make([]float32, n*n)
+	return func() { matmul.MatMul(a, b, c, n, n, n) }
+}
+
+const (
+	// probeSize is the length generatedCases runs each candidate at once.
+	probeSize = 64
+	// shapeScalar is the scalar argument of generated cases.
+	shapeScalar = 0.5
+	// absent is a search value outside the [-1, 1) range of randFloats.
+	absent = 2
+)
+
+// allCases returns benchCases followed by generatedCases.
+func allCases() []benchCase {
+	return append(slices.Clip(benchCases), generatedCases()...)
+}
+
+// generatedCases returns a case for every registered group without a
+// hand-written one whose float32 variable has an element-wise, reduction
+// or unary shape, calling through the variable so ForceDispatch applies.
+// Generated cases have no Flops: the shape does not say how much work an
+// element costs. Bytes count each slice once, so an in-place update such
+// as vec.Sub that also reads its destination is undercounted by a third.
+func generatedCases() []benchCase {
+	covered := map[string]bool{fmaGroup: true}
+	for _, c := range benchCases {
+		covered[c.Group] = true
+	}
+	var cases []benchCase
+	for _, info := range hwy.DispatchReport() {
+		if covered[info.Group] {
+			continue
+		}
+		if c, ok := shapeCase(info); ok && probeCase(c) {
+			cases = append(cases, c)
+		}
+	}
+	return cases
+}
+
+// shapeCase builds the case for the first variable of info with a known
+// float32 shape. Slices have length n, scalar parameters are shapeScalar,
+// and searches look for a value absent from the data so they scan it all.
+func shapeCase(info hwy.DispatchInfo) (benchCase, bool) {
+	for _, v := range info.Vars {
+		c := benchCase{Group: info.Group, Generated: true}
+		switch fn := v.(type) {
+		case *func([]float32) float32: // reduction
+			c.Bytes, c.Setup = perElem(4), func(n int) func() {
+				a := randFloats(n)
+				return func() { sink = (*fn)(a) }
+			}
+		case *func([]float32) int: // arg reduction
+			c.Bytes, c.Setup = perElem(4), func(n int) func() {
+				a := randFloats(n)
+				return func() { sink = float32((*fn)(a)) }
+			}
+		case *func([]float32) (float32, float32): // paired reduction
+			c.Bytes, c.Setup = perElem(4), func(n int) func() {
+				a := randFloats(n)
+				return func() { sink, _ = (*fn)(a) }
+			}
+		case *func([]float32, float32) int: // search
+			c.Bytes, c.Setup = perElem(4), func(n int) func() {
+				a := randFloats(n)
+				return func() { sink = float32((*fn)(a, absent)) }
+			}
+		case *func([]float32, float32) bool: // search
+			c.Bytes, c.Setup = perElem(4), func(n int) func() {
+				a := randFloats(n)
+				return func() {
+					if (*fn)(a, absent) {
+						sink++
+					}
+				}
+			}
+		case *func([]float32, []float32) float32: // binary reduction
+			c.Bytes, c.Setup = perElem(8), func(n int) func() {
+				a, b := randFloats(n), randFloats(n)
+				return func() { sink = (*fn)(a, b) }
+			}
+		case *func([]float32): // in-place unary
+			c.Bytes, c.Setup = perElem(8), func(n int) func() {
+				a := randFloats(n)
+				return func() { (*fn)(a) }
+			}
+		case *func(float32, []float32): // in-place unary with a scalar
+			c.Bytes, c.Setup = perElem(8), func(n int) func() {
+				a := randFloats(n)
+				return func() { (*fn)(shapeScalar, a) }
+			}
+		case *func([]float32, []float32): // unary
+			c.Bytes, c.Setup = perElem(8), func(n int) func() {
+				a, b := randFloats(n), randFloats(n)
+				return func() { (*fn)(a, b) }
+			}
+		case *func([]float32, []float32, float32): // unary with a scalar
+			c.Bytes, c.Setup = perElem(8), func(n int) func() {
+				a, b := randFloats(n), randFloats(n)
+				return func() { (*fn)(a, b, shapeScalar) }
+			}
+		case *func([]float32, float32, []float32): // dst, scalar, src
+			c.Bytes, c.Setup = perElem(8), func(n int) func() {
+				dst, a := randFloats(n), randFloats(n)
+				return func() { (*fn)(dst, shapeScalar, a) }
+			}
+		case *func([]float32, []float32, []float32): // binary element-wise
+			c.Bytes, c.Setup = perElem(12), func(n int) func() {
+				a, b, dst := randFloats(n), randFloats(n), make([]float32, n)
+				return func() { (*fn)(a, b, dst) }
+			}
+		default:
+			continue
+		}
+		return c, true
+	}
+	return benchCase{}, false
+}
+
+// probeCase reports whether c runs at probeSize without panicking. A
+// matching signature does not guarantee the arguments mean what the shape
+// assumes, e.g. a second slice of another length.
+func probeCase(c benchCase) (ok bool) {
+	defer func() {
+		if recover() != nil {
+			ok = false
+		}
+	}()
+	c.Setup(probeSize)()
+	return true
+}
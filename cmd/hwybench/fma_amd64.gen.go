@@ -0,0 +1,56 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package main
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var FMAProbe func(acc []float32, iters int) int
+
+func init() {
+	initFmaAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "main",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FMAProbe", Vars: []any{&FMAProbe}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initFmaAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initFmaAVX2},
+			{Name: "fallback", Supported: true, Init: initFmaFallback},
+		},
+	})
+}
+
+func initFmaAll() {
+	if hwy.NoSimdEnv() {
+		initFmaFallback()
+		return
+	}
+	if archsimd.X86.AVX512() {
+		initFmaAVX512()
+		return
+	}
+	if archsimd.X86.AVX2() {
+		initFmaAVX2()
+		return
+	}
+	initFmaFallback()
+}
+
+func initFmaAVX2() {
+	FMAProbe = BaseFMAProbe_avx2
+}
+
+func initFmaAVX512() {
+	FMAProbe = BaseFMAProbe_avx512
+}
+
+func initFmaFallback() {
+	FMAProbe = BaseFMAProbe_fallback
+}
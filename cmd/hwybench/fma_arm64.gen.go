@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package main
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var FMAProbe func(acc []float32, iters int) int
+
+func init() {
+	initFmaAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "main",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FMAProbe", Vars: []any{&FMAProbe}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initFmaNEON},
+			{Name: "fallback", Supported: true, Init: initFmaFallback},
+		},
+	})
+}
+
+func initFmaAll() {
+	if hwy.NoSimdEnv() {
+		initFmaFallback()
+		return
+	}
+	initFmaNEON()
+	return
+}
+
+func initFmaNEON() {
+	FMAProbe = BaseFMAProbe_neon
+}
+
+func initFmaFallback() {
+	FMAProbe = BaseFMAProbe_fallback
+}
@@ -0,0 +1,63 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package main
+
+//go:generate go run ../hwygen -input fma_base.go -output . -targets avx2,avx512,neon,fallback -dispatch fma
+
+import "github.com/ajroetker/go-highway/hwy"
+
+// fmaChains is the number of independent accumulators in BaseFMAProbe,
+// enough to cover FMA latency times the FMA ports of current cores.
+const fmaChains = 8
+
+// BaseFMAProbe runs iters rounds of fmaChains independent hwy.MulAdd chains
+// held in registers and returns the number of multiply-adds per round
+// (fmaChains × lanes), so a call performs 2 × iters × result flops. acc
+// seeds the chains and receives their final values so the work is not
+// dead; it must hold fmaChains × the widest vector of float32 lanes.
+//
+//hwy:elemtype float32
+func BaseFMAProbe(acc []float32, iters int) int {
+	lanes := hwy.Zero[float32]().NumLanes()
+	a0 := hwy.Load(acc[0*lanes:])
+	a1 := hwy.Load(acc[1*lanes:])
+	a2 := hwy.Load(acc[2*lanes:])
+	a3 := hwy.Load(acc[3*lanes:])
+	a4 := hwy.Load(acc[4*lanes:])
+	a5 := hwy.Load(acc[5*lanes:])
+	a6 := hwy.Load(acc[6*lanes:])
+	a7 := hwy.Load(acc[7*lanes:])
+	m := hwy.Set[float32](0.999999)
+	c := hwy.Set[float32](1e-6)
+	for range iters {
+		a0 = hwy.MulAdd(a0, m, c)
+		a1 = hwy.MulAdd(a1, m, c)
+		a2 = hwy.MulAdd(a2, m, c)
+		a3 = hwy.MulAdd(a3, m, c)
+		a4 = hwy.MulAdd(a4, m, c)
+		a5 = hwy.MulAdd(a5, m, c)
+		a6 = hwy.MulAdd(a6, m, c)
+		a7 = hwy.MulAdd(a7, m, c)
+	}
+	hwy.Store(a0, acc[0*lanes:])
+	hwy.Store(a1, acc[1*lanes:])
+	hwy.Store(a2, acc[2*lanes:])
+	hwy.Store(a3, acc[3*lanes:])
+	hwy.Store(a4, acc[4*lanes:])
+	hwy.Store(a5, acc[5*lanes:])
+	hwy.Store(a6, acc[6*lanes:])
+	hwy.Store(a7, acc[7*lanes:])
+	return fmaChains * lanes
+}
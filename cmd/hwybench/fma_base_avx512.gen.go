@@ -0,0 +1,59 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package main
+
+import (
+	"simd/archsimd"
+	"sync"
+	"unsafe"
+)
+
+// Hoisted constants - lazily initialized on first use to avoid init-time crashes
+var (
+	BaseFMAProbe_AVX512_c_f32 archsimd.Float32x16
+	BaseFMAProbe_AVX512_m_f32 archsimd.Float32x16
+	_fmaBaseHoistOnce         sync.Once
+)
+
+func _fmaBaseInitHoistedConstants() {
+	_fmaBaseHoistOnce.Do(func() {
+		BaseFMAProbe_AVX512_c_f32 = archsimd.BroadcastFloat32x16(1e-6)
+		BaseFMAProbe_AVX512_m_f32 = archsimd.BroadcastFloat32x16(0.999999)
+	})
+}
+
+func BaseFMAProbe_avx512(acc []float32, iters int) int {
+	_fmaBaseInitHoistedConstants()
+	lanes := 16
+	a0 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&acc[0*lanes])))
+	a1 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&acc[1*lanes])))
+	a2 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&acc[2*lanes])))
+	a3 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&acc[3*lanes])))
+	a4 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&acc[4*lanes])))
+	a5 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&acc[5*lanes])))
+	a6 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&acc[6*lanes])))
+	a7 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&acc[7*lanes])))
+	m := BaseFMAProbe_AVX512_m_f32
+	c := BaseFMAProbe_AVX512_c_f32
+	for range iters {
+		a0 = a0.MulAdd(m, c)
+		a1 = a1.MulAdd(m, c)
+		a2 = a2.MulAdd(m, c)
+		a3 = a3.MulAdd(m, c)
+		a4 = a4.MulAdd(m, c)
+		a5 = a5.MulAdd(m, c)
+		a6 = a6.MulAdd(m, c)
+		a7 = a7.MulAdd(m, c)
+	}
+	a0.Store((*[16]float32)(unsafe.Pointer(&acc[0*lanes])))
+	a1.Store((*[16]float32)(unsafe.Pointer(&acc[1*lanes])))
+	a2.Store((*[16]float32)(unsafe.Pointer(&acc[2*lanes])))
+	a3.Store((*[16]float32)(unsafe.Pointer(&acc[3*lanes])))
+	a4.Store((*[16]float32)(unsafe.Pointer(&acc[4*lanes])))
+	a5.Store((*[16]float32)(unsafe.Pointer(&acc[5*lanes])))
+	a6.Store((*[16]float32)(unsafe.Pointer(&acc[6*lanes])))
+	a7.Store((*[16]float32)(unsafe.Pointer(&acc[7*lanes])))
+	return fmaChains * lanes
+}
@@ -0,0 +1,40 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package main
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func BaseFMAProbe_fallback(acc []float32, iters int) int {
+	lanes := hwy.Zero[float32]().NumLanes()
+	a0 := hwy.Load(acc[0*lanes:])
+	a1 := hwy.Load(acc[1*lanes:])
+	a2 := hwy.Load(acc[2*lanes:])
+	a3 := hwy.Load(acc[3*lanes:])
+	a4 := hwy.Load(acc[4*lanes:])
+	a5 := hwy.Load(acc[5*lanes:])
+	a6 := hwy.Load(acc[6*lanes:])
+	a7 := hwy.Load(acc[7*lanes:])
+	m := hwy.Set[float32](0.999999)
+	c := hwy.Set[float32](1e-6)
+	for range iters {
+		a0 = hwy.MulAdd(a0, m, c)
+		a1 = hwy.MulAdd(a1, m, c)
+		a2 = hwy.MulAdd(a2, m, c)
+		a3 = hwy.MulAdd(a3, m, c)
+		a4 = hwy.MulAdd(a4, m, c)
+		a5 = hwy.MulAdd(a5, m, c)
+		a6 = hwy.MulAdd(a6, m, c)
+		a7 = hwy.MulAdd(a7, m, c)
+	}
+	hwy.Store(a0, acc[0*lanes:])
+	hwy.Store(a1, acc[1*lanes:])
+	hwy.Store(a2, acc[2*lanes:])
+	hwy.Store(a3, acc[3*lanes:])
+	hwy.Store(a4, acc[4*lanes:])
+	hwy.Store(a5, acc[5*lanes:])
+	hwy.Store(a6, acc[6*lanes:])
+	hwy.Store(a7, acc[7*lanes:])
+	return fmaChains * lanes
+}
@@ -0,0 +1,50 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package main
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy/asm"
+)
+
+// Hoisted constants - pre-broadcasted at package init time
+var (
+	BaseFMAProbe_NEON_c_f32 = asm.BroadcastFloat32x4(1e-6)
+	BaseFMAProbe_NEON_m_f32 = asm.BroadcastFloat32x4(0.999999)
+)
+
+func BaseFMAProbe_neon(acc []float32, iters int) int {
+	lanes := 4
+	a0 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&acc[0*lanes])))
+	a1 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&acc[1*lanes])))
+	a2 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&acc[2*lanes])))
+	a3 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&acc[3*lanes])))
+	a4 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&acc[4*lanes])))
+	a5 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&acc[5*lanes])))
+	a6 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&acc[6*lanes])))
+	a7 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&acc[7*lanes])))
+	m := BaseFMAProbe_NEON_m_f32
+	c := BaseFMAProbe_NEON_c_f32
+	for range iters {
+		a0 = a0.MulAdd(m, c)
+		a1 = a1.MulAdd(m, c)
+		a2 = a2.MulAdd(m, c)
+		a3 = a3.MulAdd(m, c)
+		a4 = a4.MulAdd(m, c)
+		a5 = a5.MulAdd(m, c)
+		a6 = a6.MulAdd(m, c)
+		a7 = a7.MulAdd(m, c)
+	}
+	a0.Store((*[4]float32)(unsafe.Pointer(&acc[0*lanes])))
+	a1.Store((*[4]float32)(unsafe.Pointer(&acc[1*lanes])))
+	a2.Store((*[4]float32)(unsafe.Pointer(&acc[2*lanes])))
+	a3.Store((*[4]float32)(unsafe.Pointer(&acc[3*lanes])))
+	a4.Store((*[4]float32)(unsafe.Pointer(&acc[4*lanes])))
+	a5.Store((*[4]float32)(unsafe.Pointer(&acc[5*lanes])))
+	a6.Store((*[4]float32)(unsafe.Pointer(&acc[6*lanes])))
+	a7.Store((*[4]float32)(unsafe.Pointer(&acc[7*lanes])))
+	return fmaChains * lanes
+}
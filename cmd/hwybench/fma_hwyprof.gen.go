@@ -0,0 +1,22 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package main
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("main", "FMAProbe", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FMAProbe; hwyImpl != nil {
+			FMAProbe = func(acc []float32, iters int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(acc, iters)
+				hwyCounter.Done(hwyStart, len(acc), hwy.SliceBytes(acc))
+				return hwyR0
+			}
+		}
+	})
+}
@@ -0,0 +1,32 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build !arm64 && !(amd64 && goexperiment.simd)
+
+package main
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var FMAProbe func(acc []float32, iters int) int
+
+func init() {
+	initFmaAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "main",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FMAProbe", Vars: []any{&FMAProbe}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initFmaFallback},
+		},
+	})
+}
+
+func initFmaAll() {
+	initFmaFallback()
+}
+
+func initFmaFallback() {
+	FMAProbe = BaseFMAProbe_fallback
+}
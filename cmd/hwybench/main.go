@@ -0,0 +1,314 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Command hwybench benchmarks hwy dispatch groups on every target the CPU
+// supports and reports each against a measured roofline.
+//
+// Usage:
+//
+//	hwybench                          # all groups, targets and sizes
+//	hwybench -run 'vec\.' -nosimd     # vec groups, plus an HWY_NO_SIMD=1 run
+//	hwybench -count 10 > new.txt      # samples for benchstat old.txt new.txt
+//	hwybench -json results.json       # also write a JSON report
+//	hwybench -list                    # groups with and without a benchmark
+//
+// Groups in benchCases have hand-written inputs and flop counts. Every
+// other group with a float32 variable of an element-wise, reduction or
+// unary shape gets a generated case with lengths n and no flop count; -list
+// marks them "+" and the hand-written ones "*".
+//
+// Every group runs on target "default", whatever the process dispatches to
+// including hand-written assembly overrides, and then pinned with
+// hwy.ForceDispatch to each target it has, fallback included. With -nosimd
+// the default target is also run in a child process with HWY_NO_SIMD=1 and
+// reported as target "nosimd". Pinning affects only the named group; kernels
+// it calls in other groups keep their default.
+//
+// Output is Go benchmark format with one line per sample:
+//
+//	BenchmarkKernels/group=vec.Dot/target=avx2/n=16384-8  20000  1520.0 ns/op  86.23 GB/s  21.56 GFLOP/s  71.9 %mem  14.2 %fma
+//
+// GB/s counts each input read and each output written once. %mem is the
+// percentage of the bandwidth of a large copy and %fma of the rate of
+// FMAProbe on the same target, independent register-resident MulAdd
+// chains, both measured at startup; small sizes run from cache and can
+// exceed 100 %mem. Vector sizes are lengths, matrix sizes are square
+// dimensions, and all data is float32.
+package main
+
+import (
+	"bytes"
+	"encoding/json"
+	"flag"
+	"fmt"
+	"os"
+	"os/exec"
+	"regexp"
+	"strconv"
+	"strings"
+	"time"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var (
+	runPattern = flag.String("run", "", "Regular expression selecting dispatch groups, e.g. 'vec\\.|matmul'")
+	targetList = flag.String("targets", "", "Comma-separated targets to run (default: default and every supported target)")
+	sizeList   = flag.String("sizes", "1024,16384,262144,4194304", "Comma-separated vector lengths")
+	dimList    = flag.String("dims", "64,256,512", "Comma-separated matrix dimensions")
+	benchtime  = flag.Duration("benchtime", 300*time.Millisecond, "Minimum run time of each sample")
+	count      = flag.Int("count", 1, "Number of samples of each benchmark")
+	noSimd     = flag.Bool("nosimd", false, "Also run the default target with HWY_NO_SIMD=1")
+	jsonOut    = flag.String("json", "", "Write a JSON report to this file ('-' for stdout, which replaces the text output)")
+	memBytes   = flag.Int("membytes", 64<<20, "Buffer size of the memory bandwidth probe")
+	listMode   = flag.Bool("list", false, "List dispatch groups and whether hwybench covers them")
+	childMode  = flag.Bool("child", false, "Internal: run as the HWY_NO_SIMD child and print results as JSON")
+)
+
+func main() {
+	flag.Parse()
+
+	if *listMode {
+		listGroups()
+		return
+	}
+
+	cases, err := selectCases(*runPattern)
+	if err != nil {
+		fatalf("%v", err)
+	}
+	sizes, err := parseSizes(*sizeList)
+	if err != nil {
+		fatalf("-sizes: %v", err)
+	}
+	dims, err := parseSizes(*dimList)
+	if err != nil {
+		fatalf("-dims: %v", err)
+	}
+	var targets map[string]bool
+	if *targetList != "" {
+		targets = map[string]bool{}
+		for _, t := range strings.Split(*targetList, ",") {
+			targets[strings.ToLower(strings.TrimSpace(t))] = true
+		}
+	}
+
+	b := &bench{sizes: sizes, dims: dims, targets: targets}
+	if *childMode {
+		results := b.run(cases, true)
+		if err := json.NewEncoder(os.Stdout).Encode(results); err != nil {
+			fatalf("%v", err)
+		}
+		return
+	}
+
+	rep := newReport()
+	rep.Roofline = measureRoofline(*memBytes, *benchtime)
+	text := os.Stdout
+	if *jsonOut == "-" {
+		text = nil
+	}
+	if text != nil {
+		writeHeader(text, rep)
+	}
+	b.roof, b.out = rep.Roofline, text
+	rep.Results = b.run(cases, false)
+	if *noSimd {
+		results, err := runNoSimdChild()
+		if err != nil {
+			fatalf("HWY_NO_SIMD run: %v", err)
+		}
+		for _, r := range results {
+			r.setRates(rep.Roofline)
+			if text != nil {
+				writeResult(text, r)
+			}
+			rep.Results = append(rep.Results, r)
+		}
+	}
+
+	if *jsonOut != "" {
+		if err := writeJSON(*jsonOut, rep); err != nil {
+			fatalf("%v", err)
+		}
+	}
+}
+
+// bench runs benchmark cases over the selected targets and sizes.
+type bench struct {
+	sizes, dims []int
+	// targets selects targets by name; nil runs them all.
+	targets map[string]bool
+	roof    roofline
+	// out receives each result as it completes, or nil.
+	out *os.File
+}
+
+// run benchmarks cases. In the HWY_NO_SIMD child only the default target
+// runs and is reported as "nosimd".
+func (b *bench) run(cases []benchCase, child bool) []result {
+	infos := map[string]hwy.DispatchInfo{}
+	for _, info := range hwy.DispatchReport() {
+		infos[info.Group] = info
+	}
+	restore := hwy.SaveDispatch()
+	defer restore()
+
+	var results []result
+	for _, c := range cases {
+		info, ok := infos[c.Group]
+		if !ok {
+			fmt.Fprintf(os.Stderr, "hwybench: %s is not registered on %s, skipping\n", c.Group, hwy.CurrentName())
+			continue
+		}
+		targets := []string{"default"}
+		if !child {
+			targets = append(targets, info.Available...)
+		}
+		for _, target := range targets {
+			label := target
+			if child {
+				label = "nosimd"
+			}
+			if b.targets != nil && !b.targets[label] {
+				continue
+			}
+			if target != "default" {
+				if err := hwy.ForceDispatch(c.Group, target); err != nil {
+					fmt.Fprintf(os.Stderr, "hwybench: %v\n", err)
+					continue
+				}
+			}
+			sizes := b.sizes
+			if c.Dims {
+				sizes = b.dims
+			}
+			for _, n := range sizes {
+				op := c.Setup(n)
+				for range *count {
+					r := result{
+						Name:       benchName(c, label, n),
+						Group:      c.Group,
+						Target:     label,
+						Size:       n,
+						BytesPerOp: c.Bytes(n),
+					}
+					if c.Flops != nil {
+						r.FlopsPerOp = c.Flops(n)
+					}
+					r.NsPerOp, r.Iterations = measure(op, *benchtime)
+					r.setRates(b.roof)
+					if b.out != nil {
+						writeResult(b.out, r)
+					}
+					results = append(results, r)
+				}
+			}
+			restore()
+		}
+	}
+	return results
+}
+
+// runNoSimdChild reruns this binary with HWY_NO_SIMD=1, which is read at
+// package init, and returns the child's results.
+func runNoSimdChild() ([]result, error) {
+	exe, err := os.Executable()
+	if err != nil {
+		return nil, err
+	}
+	args := []string{"-child"}
+	flag.Visit(func(f *flag.Flag) {
+		switch f.Name {
+		case "run", "targets", "sizes", "dims", "benchtime", "count":
+			args = append(args, "-"+f.Name+"="+f.Value.String())
+		}
+	})
+	cmd := exec.Command(exe, args...)
+	cmd.Env = append(os.Environ(), "HWY_NO_SIMD=1")
+	cmd.Stderr = os.Stderr
+	var stdout bytes.Buffer
+	cmd.Stdout = &stdout
+	if err := cmd.Run(); err != nil {
+		return nil, err
+	}
+	var results []result
+	if err := json.Unmarshal(stdout.Bytes(), &results); err != nil {
+		return nil, err
+	}
+	return results, nil
+}
+
+// selectCases returns the benchmark cases whose group matches pattern.
+func selectCases(pattern string) ([]benchCase, error) {
+	re, err := regexp.Compile(pattern)
+	if err != nil {
+		return nil, fmt.Errorf("-run: %w", err)
+	}
+	var cases []benchCase
+	for _, c := range allCases() {
+		if re.MatchString(c.Group) {
+			cases = append(cases, c)
+		}
+	}
+	if len(cases) == 0 {
+		return nil, fmt.Errorf("no benchmarked group matches %q; see -list", pattern)
+	}
+	return cases, nil
+}
+
+// parseSizes parses a comma-separated list of positive sizes.
+func parseSizes(s string) ([]int, error) {
+	var sizes []int
+	for _, f := range strings.Split(s, ",") {
+		f = strings.TrimSpace(f)
+		if f == "" {
+			continue
+		}
+		n, err := strconv.Atoi(f)
+		if err != nil || n <= 0 {
+			return nil, fmt.Errorf("bad size %q", f)
+		}
+		sizes = append(sizes, n)
+	}
+	if len(sizes) == 0 {
+		return nil, fmt.Errorf("no sizes in %q", s)
+	}
+	return sizes, nil
+}
+
+// listGroups prints every registered dispatch group with its targets and
+// whether hwybench has a hand-written ("*") or generated ("+") benchmark
+// for it.
+func listGroups() {
+	marks := map[string]string{}
+	for _, c := range allCases() {
+		marks[c.Group] = "*"
+		if c.Generated {
+			marks[c.Group] = "+"
+		}
+	}
+	for _, info := range hwy.DispatchReport() {
+		mark := marks[info.Group]
+		if mark == "" {
+			mark = " "
+		}
+		fmt.Printf("%s %-40s %s\n", mark, info.Group, strings.Join(info.Available, ","))
+	}
+}
+
+func fatalf(format string, args ...any) {
+	fmt.Fprintf(os.Stderr, "hwybench: "+format+"\n", args...)
+	os.Exit(1)
+}
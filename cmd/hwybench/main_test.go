@@ -0,0 +1,151 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package main
+
+import (
+	"bytes"
+	"strings"
+	"testing"
+	"time"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func TestParseSizes(t *testing.T) {
+	got, err := parseSizes(" 16, 1024,")
+	if err != nil || len(got) != 2 || got[0] != 16 || got[1] != 1024 {
+		t.Errorf("parseSizes: got %v, %v", got, err)
+	}
+	for _, bad := range []string{"", "0", "-4", "1k"} {
+		if _, err := parseSizes(bad); err == nil {
+			t.Errorf("parseSizes(%q): expected error", bad)
+		}
+	}
+}
+
+func TestWriteResult(t *testing.T) {
+	c := benchCase{Group: "vec.Dot"}
+	r := result{
+		Name:       benchName(c, "avx2", 1024),
+		Iterations: 100,
+		NsPerOp:    100,
+		BytesPerOp: 8192,
+		FlopsPerOp: 2048,
+	}
+	r.setRates(roofline{MemGBPerSec: 163.84, FMAGFLOPPerSec: 40.96})
+	if r.GBPerSec != 81.92 || r.MemRoofPct != 50 || r.FMARoofPct != 50 {
+		t.Errorf("rates: got %+v", r)
+	}
+
+	var buf bytes.Buffer
+	writeResult(&buf, r)
+	fields := strings.Fields(buf.String())
+	if !strings.HasPrefix(fields[0], "BenchmarkKernels/group=vec.Dot/target=avx2/n=1024") {
+		t.Errorf("name: got %s", fields[0])
+	}
+	// benchstat reads "iterations (value unit)..." after the name.
+	if len(fields)%2 != 0 || fields[1] != "100" {
+		t.Fatalf("not benchmark format: %q", buf.String())
+	}
+	var units []string
+	for i := 3; i < len(fields); i += 2 {
+		units = append(units, fields[i])
+	}
+	if got := strings.Join(units, " "); got != "ns/op GB/s GFLOP/s %mem %fma" {
+		t.Errorf("units: got %s", got)
+	}
+}
+
+func TestRunRestoresDispatch(t *testing.T) {
+	saved := *benchtime
+	*benchtime = time.Millisecond
+	defer func() { *benchtime = saved }()
+
+	before := dispatchTargets()
+	cases, err := selectCases(`^vec\.Sum$`)
+	if err != nil {
+		t.Fatal(err)
+	}
+	b := &bench{sizes: []int{64}, dims: []int{8}}
+	results := b.run(cases, false)
+
+	seen := map[string]bool{}
+	for _, r := range results {
+		seen[r.Target] = true
+		if r.NsPerOp <= 0 || r.BytesPerOp != 256 {
+			t.Errorf("%s: got %+v", r.Name, r)
+		}
+	}
+	if !seen["default"] || !seen["fallback"] {
+		t.Errorf("targets: got %v, want default and fallback", seen)
+	}
+	if after := dispatchTargets(); after != before {
+		t.Errorf("dispatch not restored:\nbefore %s\nafter  %s", before, after)
+	}
+}
+
+func dispatchTargets() string {
+	var sb strings.Builder
+	for _, info := range hwy.DispatchReport() {
+		sb.WriteString(info.Group + "=" + info.Target + " ")
+	}
+	return sb.String()
+}
+
+func TestGeneratedCases(t *testing.T) {
+	hand := map[string]bool{}
+	for _, c := range benchCases {
+		hand[c.Group] = true
+	}
+	got := map[string]bool{}
+	for _, c := range generatedCases() {
+		if hand[c.Group] || !c.Generated || c.Flops != nil {
+			t.Errorf("%s: got %+v", c.Group, c)
+		}
+		got[c.Group] = true
+	}
+	// One group of each of several shapes.
+	for _, group := range []string{"vec.Max", "vec.Argmax", "vec.Sub", "vec.Scale", "activation.ELU", "nn.SoftmaxInPlace"} {
+		if !got[group] {
+			t.Errorf("no generated case for %s", group)
+		}
+	}
+
+	saved := *benchtime
+	*benchtime = time.Millisecond
+	defer func() { *benchtime = saved }()
+	cases, err := selectCases(`^vec\.SubTo$`)
+	if err != nil {
+		t.Fatal(err)
+	}
+	b := &bench{sizes: []int{64}, dims: []int{8}}
+	for _, r := range b.run(cases, false) {
+		if r.NsPerOp <= 0 || r.BytesPerOp != 768 {
+			t.Errorf("%s: got %+v", r.Name, r)
+		}
+	}
+}
+
+func TestFMARoof(t *testing.T) {
+	if gflops := measureFMA(time.Millisecond); gflops <= 0 {
+		t.Errorf("measureFMA: got %v", gflops)
+	}
+	roof := roofline{FMAGFLOPPerSec: 8, FMAByTarget: map[string]float64{"fallback": 1, "avx2": 16}}
+	for target, want := range map[string]float64{"default": 8, "avx2": 16, "fallback": 1, "nosimd": 1, "neon": 8} {
+		if got := roof.fmaRoof(target); got != want {
+			t.Errorf("fmaRoof(%s): got %v, want %v", target, got, want)
+		}
+	}
+}
@@ -0,0 +1,166 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package main
+
+import (
+	"bufio"
+	"encoding/json"
+	"fmt"
+	"io"
+	"os"
+	"runtime"
+	"slices"
+	"strings"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+// result is one timed (group, target, size) combination.
+type result struct {
+	// Name is the benchmark name in the format benchstat reads.
+	Name       string  `json:"name"`
+	Group      string  `json:"group"`
+	Target     string  `json:"target"`
+	Size       int     `json:"size"`
+	Iterations int     `json:"iterations"`
+	NsPerOp    float64 `json:"ns_per_op"`
+	BytesPerOp float64 `json:"bytes_per_op"`
+	FlopsPerOp float64 `json:"flops_per_op,omitempty"`
+
+	GBPerSec    float64 `json:"gb_per_sec"`
+	GFLOPPerSec float64 `json:"gflop_per_sec,omitempty"`
+	// MemRoofPct and FMARoofPct are the rates as a percentage of the
+	// measured roofs; FMARoofPct uses the FMAProbe rate of the same target.
+	// In-cache sizes can exceed 100% of memory bandwidth.
+	MemRoofPct float64 `json:"mem_roof_pct"`
+	FMARoofPct float64 `json:"fma_roof_pct,omitempty"`
+}
+
+// report is the -json output.
+type report struct {
+	GOOS       string   `json:"goos"`
+	GOARCH     string   `json:"goarch"`
+	CPU        string   `json:"cpu,omitempty"`
+	Level      string   `json:"level"`
+	GOMAXPROCS int      `json:"gomaxprocs"`
+	Roofline   roofline `json:"roofline"`
+	Results    []result `json:"results"`
+}
+
+// benchName returns the name of a result as "Kernels/group=vec.Dot/
+// target=avx2/n=4096", so benchstat can project on the group, target and
+// size keys.
+func benchName(c benchCase, target string, size int) string {
+	key := "n"
+	if c.Dims {
+		key = "dim"
+	}
+	return fmt.Sprintf("Kernels/group=%s/target=%s/%s=%d", c.Group, target, key, size)
+}
+
+// setRates derives the rates of r from its timing and the roofs.
+func (r *result) setRates(roof roofline) {
+	r.GBPerSec = r.BytesPerOp / r.NsPerOp
+	r.GFLOPPerSec = r.FlopsPerOp / r.NsPerOp
+	r.MemRoofPct, r.FMARoofPct = 0, 0
+	if roof.MemGBPerSec > 0 {
+		r.MemRoofPct = 100 * r.GBPerSec / roof.MemGBPerSec
+	}
+	if fma := roof.fmaRoof(r.Target); fma > 0 {
+		r.FMARoofPct = 100 * r.GFLOPPerSec / fma
+	}
+}
+
+// writeHeader writes the configuration lines benchstat keys results by.
+func writeHeader(w io.Writer, rep *report) {
+	fmt.Fprintf(w, "goos: %s\n", rep.GOOS)
+	fmt.Fprintf(w, "goarch: %s\n", rep.GOARCH)
+	fmt.Fprintf(w, "pkg: github.com/ajroetker/go-highway/cmd/hwybench\n")
+	if rep.CPU != "" {
+		fmt.Fprintf(w, "cpu: %s\n", rep.CPU)
+	}
+	fmt.Fprintf(w, "level: %s\n", rep.Level)
+	fmt.Fprintf(w, "roofline-mem: %.2f GB/s\n", rep.Roofline.MemGBPerSec)
+	fmt.Fprintf(w, "roofline-fma: %.2f GFLOP/s\n", rep.Roofline.FMAGFLOPPerSec)
+	targets := make([]string, 0, len(rep.Roofline.FMAByTarget))
+	for target := range rep.Roofline.FMAByTarget {
+		targets = append(targets, target)
+	}
+	slices.Sort(targets)
+	for _, target := range targets {
+		fmt.Fprintf(w, "roofline-fma-%s: %.2f GFLOP/s\n", target, rep.Roofline.FMAByTarget[target])
+	}
+}
+
+// writeResult writes r as one line of Go benchmark output.
+func writeResult(w io.Writer, r result) {
+	name := "Benchmark" + r.Name
+	if procs := runtime.GOMAXPROCS(0); procs > 1 {
+		name += fmt.Sprintf("-%d", procs)
+	}
+	fmt.Fprintf(w, "%s\t%8d\t%12.1f ns/op\t%8.2f GB/s", name, r.Iterations, r.NsPerOp, r.GBPerSec)
+	if r.FlopsPerOp > 0 {
+		fmt.Fprintf(w, "\t%8.2f GFLOP/s", r.GFLOPPerSec)
+	}
+	fmt.Fprintf(w, "\t%6.1f %%mem", r.MemRoofPct)
+	if r.FlopsPerOp > 0 {
+		fmt.Fprintf(w, "\t%6.1f %%fma", r.FMARoofPct)
+	}
+	fmt.Fprintln(w)
+}
+
+func newReport() *report {
+	return &report{
+		GOOS:       runtime.GOOS,
+		GOARCH:     runtime.GOARCH,
+		CPU:        cpuName(),
+		Level:      hwy.CurrentName(),
+		GOMAXPROCS: runtime.GOMAXPROCS(0),
+	}
+}
+
+func writeJSON(path string, v any) error {
+	data, err := json.MarshalIndent(v, "", "  ")
+	if err != nil {
+		return err
+	}
+	data = append(data, '\n')
+	if path == "-" {
+		_, err = os.Stdout.Write(data)
+		return err
+	}
+	return os.WriteFile(path, data, 0644)
+}
+
+// cpuName returns the processor model on Linux, or "".
+func cpuName() string {
+	f, err := os.Open("/proc/cpuinfo")
+	if err != nil {
+		return ""
+	}
+	defer f.Close()
+	sc := bufio.NewScanner(f)
+	for sc.Scan() {
+		key, value, ok := strings.Cut(sc.Text(), ":")
+		if !ok {
+			continue
+		}
+		switch strings.TrimSpace(key) {
+		case "model name", "Model", "cpu model":
+			return strings.TrimSpace(value)
+		}
+	}
+	return ""
+}
@@ -0,0 +1,125 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package main
+
+import (
+	"time"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+const (
+	// fmaGroup is the dispatch group of the compute probe.
+	fmaGroup = "main.FMAProbe"
+	// fmaProbeIters is the number of rounds of one FMAProbe call, enough
+	// that the call overhead is noise.
+	fmaProbeIters = 4096
+	// fmaProbeLen holds fmaChains vectors of the widest target, 16 float32
+	// lanes.
+	fmaProbeLen = fmaChains * 16
+)
+
+// roofline is the measured machine balance kernels are compared against.
+type roofline struct {
+	// MemGBPerSec is the memory bandwidth of copying a buffer much larger
+	// than the caches, counting bytes read and written.
+	MemGBPerSec float64 `json:"mem_gb_per_sec"`
+	// FMAGFLOPPerSec is the rate of FMAProbe, fmaChains independent
+	// register-resident hwy.MulAdd chains, on the default dispatch. It is an
+	// attainable peak, not the data sheet one.
+	FMAGFLOPPerSec float64 `json:"fma_gflop_per_sec"`
+	// FMAByTarget is the FMAProbe rate pinned to each supported target.
+	FMAByTarget map[string]float64 `json:"fma_gflop_per_sec_by_target,omitempty"`
+}
+
+// fmaRoof returns the compute roof of target: its own FMAProbe rate when
+// measured, the fallback rate for the HWY_NO_SIMD run, and otherwise the
+// default one.
+func (r roofline) fmaRoof(target string) float64 {
+	if target == "nosimd" {
+		target = "fallback"
+	}
+	if gflops, ok := r.FMAByTarget[target]; ok {
+		return gflops
+	}
+	return r.FMAGFLOPPerSec
+}
+
+// measureRoofline measures the memory and compute roofs. bufBytes is the
+// size of each copy buffer. Each roof is the best of three runs.
+func measureRoofline(bufBytes int, benchtime time.Duration) roofline {
+	n := bufBytes / 4
+	src, dst := randFloats(n), make([]float32, n)
+	copyOp := func() { copy(dst, src) }
+
+	var roof roofline
+	for range 3 {
+		ns, _ := measure(copyOp, benchtime/3)
+		roof.MemGBPerSec = max(roof.MemGBPerSec, 2*float64(bufBytes)/ns)
+	}
+	roof.FMAGFLOPPerSec = measureFMA(benchtime)
+
+	restore := hwy.SaveDispatch()
+	defer restore()
+	for _, info := range hwy.DispatchReport() {
+		if info.Group != fmaGroup {
+			continue
+		}
+		roof.FMAByTarget = map[string]float64{}
+		for _, target := range info.Available {
+			if err := hwy.ForceDispatch(fmaGroup, target); err != nil {
+				continue
+			}
+			roof.FMAByTarget[target] = measureFMA(benchtime)
+			restore()
+		}
+	}
+	return roof
+}
+
+// measureFMA returns the best FMAProbe rate of three runs in GFLOP/s.
+func measureFMA(benchtime time.Duration) float64 {
+	acc := randFloats(fmaProbeLen)
+	var perRound int
+	op := func() { perRound = FMAProbe(acc, fmaProbeIters) }
+	var best float64
+	for range 3 {
+		ns, _ := measure(op, benchtime/3)
+		best = max(best, 2*fmaProbeIters*float64(perRound)/ns)
+	}
+	return best
+}
+
+// measure runs op repeatedly for at least benchtime, growing the iteration
+// count the way package testing does, and returns the mean ns per call.
+func measure(op func(), benchtime time.Duration) (nsPerOp float64, iters int) {
+	op() // fault in pages and run any lazy initialization
+	n := 1
+	for {
+		start := time.Now()
+		for range n {
+			op()
+		}
+		d := time.Since(start)
+		if d >= benchtime || n >= 1e9 {
+			return float64(d.Nanoseconds()) / float64(n), n
+		}
+		next := n * 100
+		if d > 0 {
+			next = int(1.2 * float64(n) * float64(benchtime) / float64(d))
+		}
+		n = min(max(next, n+1), 100*n, 1e9)
+	}
+}
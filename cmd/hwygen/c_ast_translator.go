@@ -373,7 +373,7 @@ func (t *CASTTranslator) TranslateToC(pf *ParsedFunc) (string, error) {
 
 	// Translate function body
 	if pf.Body != nil {
-		t.translateBlockStmtContents(pf.Body)
+		t.translateBlockStmtContents(t.splitAccumulatorChains(pf))
 	}
 
 	// Close function
@@ -388,6 +388,33 @@ func (t *CASTTranslator) TranslateToC(pf *ParsedFunc) (string, error) {
 	return t.buf.String(), nil
 }
 
+// splitAccumulatorChains returns pf.Body with the //hwy:accumulators rewrite
+// the Go targets get in transformFunction: the main loop unrolled with one
+// accumulator chain per copy. Clang does not reassociate floating-point
+// reductions by itself. Profiles with a runtime lane count keep one chain.
+func (t *CASTTranslator) splitAccumulatorChains(pf *ParsedFunc) *ast.BlockStmt {
+	li := pf.LoopInfo
+	if li == nil || li.Accumulators <= 1 || len(li.AccumulatorVars) == 0 ||
+		t.lanesExpr() != strconv.Itoa(t.lanes) {
+		return pf.Body
+	}
+	body, ok := cloneStmt(pf.Body).(*ast.BlockStmt)
+	if !ok {
+		return pf.Body
+	}
+	loop := findMainSimdLoop(body, li)
+	if loop == nil {
+		return pf.Body
+	}
+	factor := li.Accumulators
+	if li.UnrollHint > 1 {
+		factor = li.UnrollHint
+	}
+	unrollLoopWithCleanup(body, loop, li, factor, t.lanes)
+	splitAccumulators(body, loop, li, factor, nil)
+	return body
+}
+
 // discoverStructFields walks the function body to discover struct fields
 // from field accesses and method calls. This uses a convention-based approach:
 //   - Direct field accesses (e.g., img.height, img.width) → scalar fields (long)
@@ -2809,6 +2836,16 @@ func (t *CASTTranslator) translateBinaryExpr(e *ast.BinaryExpr) string {
 	left := t.translateExpr(e.X)
 	right := t.translateExpr(e.Y)
 
+	// Go ranks shifts and & with *, and | and ^ with +; C ranks them lower.
+	// Parenthesize operands that C would otherwise bind differently, e.g.
+	// Go's 1<<n - 1 must not become 1 << n - 1.
+	if x, ok := e.X.(*ast.BinaryExpr); ok && cBinaryPrec(x.Op) < cBinaryPrec(e.Op) {
+		left = "(" + left + ")"
+	}
+	if y, ok := e.Y.(*ast.BinaryExpr); ok && cBinaryPrec(y.Op) <= cBinaryPrec(e.Op) {
+		right = "(" + right + ")"
+	}
+
 	// In Go, integer literals are 64-bit on arm64. In C, integer literals
 	// like `1` are 32-bit int. `1 << N` for N >= 32 is undefined behavior
 	// in C. Suffix with L to force 64-bit when the left operand of a shift
@@ -2828,6 +2865,34 @@ func (t *CASTTranslator) translateBinaryExpr(e *ast.BinaryExpr) string {
 	return left + " " + e.Op.String() + " " + right
 }
 
+// cBinaryPrec returns the C precedence of a Go binary operator; higher
+// binds tighter. &^ is emitted as a & ~(b) and ranks as &.
+func cBinaryPrec(op token.Token) int {
+	switch op {
+	case token.MUL, token.QUO, token.REM:
+		return 10
+	case token.ADD, token.SUB:
+		return 9
+	case token.SHL, token.SHR:
+		return 8
+	case token.LSS, token.LEQ, token.GTR, token.GEQ:
+		return 7
+	case token.EQL, token.NEQ:
+		return 6
+	case token.AND, token.AND_NOT:
+		return 5
+	case token.XOR:
+		return 4
+	case token.OR:
+		return 3
+	case token.LAND:
+		return 2
+	case token.LOR:
+		return 1
+	}
+	return 0
+}
+
 // translateCallExpr translates function calls, dispatching hwy.* calls to intrinsics.
 func (t *CASTTranslator) translateCallExpr(e *ast.CallExpr) string {
 	// Check for hwy.Func(...) or hwy.Func[T](...)
@@ -2853,6 +2918,7 @@ func (t *CASTTranslator) translateCallExpr(e *ast.CallExpr) string {
 
 	// Check for bits.OnesCount* → __builtin_popcount*
 	// Check for bits.Len32/Len64 → bit-length via __builtin_clz
+	// Check for bits.Reverse* → __builtin_bitreverse*
 	if sel, ok := e.Fun.(*ast.SelectorExpr); ok {
 		if pkg, ok := sel.X.(*ast.Ident); ok && pkg.Name == "bits" {
 			if builtinFn := bitsOnesCountToBuiltin(sel.Sel.Name); builtinFn != "" {
@@ -2867,6 +2933,12 @@ func (t *CASTTranslator) translateCallExpr(e *ast.CallExpr) string {
 					return fmt.Sprintf(builtinExpr, arg, arg)
 				}
 			}
+			if builtinFn := bitsReverseToBuiltin(sel.Sel.Name); builtinFn != "" {
+				if len(e.Args) == 1 {
+					arg := t.translateExpr(e.Args[0])
+					return fmt.Sprintf("%s(%s)", builtinFn, arg)
+				}
+			}
 		}
 	}
 
@@ -4799,6 +4871,23 @@ func bitsLenToBuiltin(funcName string) string {
 	}
 }
 
+// bitsReverseToBuiltin maps Go math/bits Reverse* functions to clang's
+// __builtin_bitreverse* builtins (a single RBIT on arm64).
+func bitsReverseToBuiltin(funcName string) string {
+	switch funcName {
+	case "Reverse64", "Reverse":
+		return "__builtin_bitreverse64"
+	case "Reverse32":
+		return "__builtin_bitreverse32"
+	case "Reverse16":
+		return "__builtin_bitreverse16"
+	case "Reverse8":
+		return "__builtin_bitreverse8"
+	default:
+		return ""
+	}
+}
+
 // translateUnsafeSlice handles unsafe.Slice((*T)(unsafe.Pointer(&arr[0])), N).
 // This common Go pattern reinterprets a slice's backing memory as a different type.
 // In C, this is just a pointer cast: (C_T *)arr.
@@ -570,3 +570,69 @@ func TestEmitFuncSignature_ScalarGenericReturn_BFloat16(t *testing.T) {
 		t.Errorf("BFloat16 BaseDot should not return long, got: %s", output)
 	}
 }
+
+// TestAccumulatorChainsVecReduce checks the NEON C that the translator emits
+// for the //hwy:accumulators reductions in hwy/contrib/vec: Sum keeps four
+// independent add chains and Min/Max two, each merged pairwise after the main
+// loop and before the single-vector cleanup loop. SquaredNorm is Dot(v, v),
+// whose four hand-written FMA chains are checked as well.
+func TestAccumulatorChainsVecReduce(t *testing.T) {
+	funcs := make(map[string]*ParsedFunc)
+	for _, file := range []string{"reduce_base.go", "dot_base.go"} {
+		result, err := Parse(filepath.Join("..", "..", "hwy", "contrib", "vec", file))
+		if err != nil {
+			t.Fatalf("Parse(%s): %v", file, err)
+		}
+		for i := range result.Funcs {
+			funcs[result.Funcs[i].Name] = &result.Funcs[i]
+		}
+	}
+
+	tests := []struct {
+		fn, elemType string
+		want         []string
+	}{
+		{"BaseSum", "float32", []string{
+			"float32x4_t sum3 = vdupq_n_f32(0.0f);",
+			"for (i = 0; i + lanes * 4 <= len_v; i += lanes * 4) {",
+			"sum1 = vaddq_f32(sum1, va1);",
+			"sum3 = vaddq_f32(sum3, va3);\n    }\n" +
+				"    sum = vaddq_f32(sum, sum1);\n" +
+				"    sum2 = vaddq_f32(sum2, sum3);\n" +
+				"    sum = vaddq_f32(sum, sum2);\n",
+			"for (; i + lanes <= len_v; i += lanes) {",
+		}},
+		{"BaseSum", "float64", []string{
+			"float64x2_t sum3 = vdupq_n_f64(0.0);",
+			"sum3 = vaddq_f64(sum3, va3);\n    }\n    sum = vaddq_f64(sum, sum1);\n",
+		}},
+		{"BaseMax", "float32", []string{
+			"float32x4_t maxVec1 = maxVec;",
+			"for (i = lanes; i + lanes * 2 <= len_v; i += lanes * 2) {",
+			"maxVec1 = vmaxq_f32(maxVec1, va1);\n    }\n    maxVec = vmaxq_f32(maxVec, maxVec1);\n",
+		}},
+		{"BaseMin", "float64", []string{
+			"float64x2_t minVec1 = minVec;",
+			"minVec1 = vminq_f64(minVec1, va1);\n    }\n    minVec = vminq_f64(minVec, minVec1);\n",
+		}},
+		{"BaseDot", "float32", []string{
+			"sum0 = vfmaq_f32(sum0, va0, vb0);",
+			"sum3 = vfmaq_f32(sum3, va3, vb3);",
+		}},
+	}
+	for _, tt := range tests {
+		pf := funcs[tt.fn]
+		if pf == nil {
+			t.Fatalf("%s not found", tt.fn)
+		}
+		code, err := NewCASTTranslator(testProfile(t, tt.elemType), tt.elemType).TranslateToC(pf)
+		if err != nil {
+			t.Fatalf("%s/%s: TranslateToC: %v", tt.fn, tt.elemType, err)
+		}
+		for _, want := range tt.want {
+			if !strings.Contains(code, want) {
+				t.Errorf("%s/%s: C code missing %q, got:\n%s", tt.fn, tt.elemType, want, code)
+			}
+		}
+	}
+}
@@ -182,6 +182,12 @@ func (g *Generator) runCModeInternal(result *ParseResult, targets []Target, asmM
 				if profile == nil {
 					continue
 				}
+				// The x86 asm targets cover float32 and float64. Their
+				// half-precision profiles have no vector reductions and
+				// compare raw bits in scalar tails.
+				if asmMode && isX86AsmTarget(target) && elemType != "float32" && elemType != "float64" {
+					continue
+				}
 
 				// Create a working copy with the primary's name for output naming
 				pf := *sourcePF
@@ -248,12 +254,11 @@ func (g *Generator) runCModeInternal(result *ParseResult, targets []Target, asmM
 					continue
 				}
 				compiledFiles = append(compiledFiles, cFile)
-				// Track which element type suffixes were compiled successfully.
-				// This prevents wrapper generation for skipped combos (e.g.,
-				// uint8 DotProduct without DotAccFn).
-				if profile != nil {
-					compiledElemSuffixes[cTypeSuffix(profile.ElemType)] = true
-				}
+				// Track which function and element type pairs were compiled
+				// successfully. This prevents wrapper generation for skipped
+				// combos (e.g., uint8 DotProduct without DotAccFn) and for
+				// files the C compiler rejected.
+				compiledElemSuffixes[compiledCFileKey(cFile)] = true
 				fmt.Printf("  Compiled: %s\n", filepath.Base(cFile))
 			}
 			cFiles = compiledFiles
@@ -357,14 +362,14 @@ func (g *Generator) runCModeInternal(result *ParseResult, targets []Target, asmM
 						continue
 					}
 					// Skip elem types whose C file was not compiled.
-					if compiledElemSuffixes != nil && !compiledElemSuffixes[cTypeSuffix(elemType)] {
+					if !asmCompiled(compiledElemSuffixes, pf.Name, elemType) {
 						continue
 					}
 					allAdapters = append(allAdapters, AsmAdapterInfo{
 						TargetName:  target.Name,
 						Arch:        target.Arch(),
 						DispatchVar: buildDispatchVarName(pf.Name, elemType, len(pf.TypeParams) > 0),
-						AdapterFunc: buildAdapterFuncName(pf.Name, elemType),
+						AdapterFunc: buildAdapterFuncName(pf.Name, elemType, asmNameQualifier(target)),
 					})
 				}
 			}
@@ -420,6 +425,11 @@ func (g *Generator) runFusionCMode(result *ParseResult, sliceFuncs []ParsedFunc,
 					Name: pf.Name,
 					Body: pf.Body,
 				}
+				if pf.LoopInfo != nil && pf.LoopInfo.Accumulators > 1 {
+					if loop := findMainSimdLoop(pf.Body, pf.LoopInfo); loop != nil {
+						irPF.Accumulators = map[*ast.ForStmt]int{loop: pf.LoopInfo.Accumulators}
+					}
+				}
 				for _, tp := range pf.TypeParams {
 					irPF.TypeParams = append(irPF.TypeParams, ir.TypeParamInput{
 						Name:       tp.Name,
@@ -832,6 +842,9 @@ func getCProfileForFile(cFile string, target Target) *CIntrinsicProfile {
 // runGOAT invokes the GOAT tool to compile a C file to Go assembly.
 // It uses `go tool github.com/ajroetker/go-highway/hwy/goat` which requires goat to be
 // declared as a tool dependency in go.mod (via `go get -tool`).
+//
+// HWYGEN_GOAT replaces that command with a prebuilt GoAT plus any leading
+// flags, e.g. HWYGEN_GOAT="goat --cc gcc" to build amd64 asm with GCC.
 func runGOAT(cFile string, profile *CIntrinsicProfile) error {
 	// Use the Go binary from GOROOT (same toolchain that built hwygen)
 	goBin := filepath.Join(runtime.GOROOT(), "bin", "go")
@@ -856,10 +869,16 @@ func runGOAT(cFile string, profile *CIntrinsicProfile) error {
 	if profile != nil && profile.GoatTarget != "" {
 		goatTarget = profile.GoatTarget
 	}
-	args := []string{"tool", "github.com/ajroetker/go-highway/hwy/goat", absCFile,
+	// Pass the C file relative to the module root, where GOAT runs, so the
+	// "source:" line it records does not depend on the checkout location.
+	relCFile, err := filepath.Rel(modRoot, absCFile)
+	if err != nil {
+		return fmt.Errorf("rel path: %w", err)
+	}
+	args := []string{"tool", "github.com/ajroetker/go-highway/hwy/goat", relCFile,
 		"-O3",
 		"-t", goatTarget,
-		"-o", filepath.Dir(absCFile),
+		"-o", filepath.Dir(relCFile),
 	}
 
 	if profile != nil {
@@ -880,6 +899,9 @@ func runGOAT(cFile string, profile *CIntrinsicProfile) error {
 	args = append(args, "-e=-fno-builtin-memset")
 
 	cmd := exec.Command(goBin, args...)
+	if goat := strings.Fields(os.Getenv("HWYGEN_GOAT")); len(goat) > 0 {
+		cmd = exec.Command(goat[0], append(goat[1:], args[2:]...)...)
+	}
 	cmd.Dir = modRoot
 	cmd.Env = os.Environ()
 
@@ -1102,7 +1124,7 @@ func (g *Generator) emitCWrappers(funcs []ParsedFunc, target Target, outputDir s
 			}
 			// Skip wrapper for elemTypes whose C file was not compiled
 			// (e.g., uint8 DotProduct skipped due to missing DotAccFn).
-			if compiledElemSuffixes != nil && !compiledElemSuffixes[cTypeSuffix(elemType)] {
+			if !asmCompiled(compiledElemSuffixes, pf.Name, elemType) {
 				continue
 			}
 			if IsASTCEligible(&pf) {
@@ -1115,10 +1137,10 @@ func (g *Generator) emitCWrappers(funcs []ParsedFunc, target Target, outputDir s
 				if hasStructPtrParams(&pf) {
 					emitStructPtrAsmWrapper(&buf, &pf, elemType, target)
 				} else {
-					emitASTCWrapperFunc(&buf, &pf, elemType, targetSuffix)
+					emitASTCWrapperFunc(&buf, &pf, elemType, targetSuffix, asmNameQualifier(target))
 				}
 			} else {
-				emitCWrapperFunc(&buf, &pf, elemType, targetSuffix)
+				emitCWrapperFunc(&buf, &pf, elemType, targetSuffix, asmNameQualifier(target))
 			}
 		}
 	}
@@ -1170,7 +1192,7 @@ func (g *Generator) emitStructAsmPassthrough(funcs []ParsedFunc, target Target,
 			}
 
 			// Exported name: ForwardICT_F32
-			exportedName := structAsmExportedName(pf.Name, elemType)
+			exportedName := structAsmExportedName(pf.Name, elemType, asmNameQualifier(target))
 			// Assembly name: forwardict_c_f32_neon
 			asmName := cAsmFuncName(pf.Name, elemType, targetSuffix)
 
@@ -1217,6 +1239,56 @@ func isNeonTarget(target Target) bool {
 	return target.Name == "NEON"
 }
 
+// isX86AsmTarget returns true for AVX2/AVX-512 targets compiled with GoAT.
+func isX86AsmTarget(target Target) bool {
+	return target.Mode == TargetModeAsm && (target.Name == "AVX2" || target.Name == "AVX512")
+}
+
+// compiledCFileKey returns the function and element type part of a C file
+// name: basedot_c_f32_avx2_amd64.c → basedot_c_f32.
+func compiledCFileKey(cFile string) string {
+	name := filepath.Base(cFile)
+	if i := strings.Index(name, "_c_"); i >= 0 {
+		if j := strings.Index(name[i+3:], "_"); j >= 0 {
+			return name[:i+3+j]
+		}
+	}
+	return name
+}
+
+// asmCompiled reports whether the C file for name and elemType compiled.
+// A nil set means no C was compiled on this path, so nothing is filtered.
+func asmCompiled(compiled map[string]bool, name, elemType string) bool {
+	if compiled == nil {
+		return true
+	}
+	return compiled[strings.ToLower(name)+"_c_"+cTypeSuffix(elemType)]
+}
+
+// asmNameQualifier returns the infix that keeps the Go names of x86 asm
+// targets apart: avx2:asm and avx512:asm both build for amd64 and share the
+// asm package, so Dot_F32 becomes Dot_AVX2_F32 and Dot_AVX512_F32. Other
+// targets own their architecture and keep the plain names.
+func asmNameQualifier(target Target) string {
+	if isX86AsmTarget(target) {
+		return target.Name
+	}
+	return ""
+}
+
+// x86RuntimeGuard returns the CPU feature check for x86 asm targets. It uses
+// the x/sys/cpu based hwy.HasAVX2/HasAVX512 so the guard works with and
+// without GOEXPERIMENT=simd.
+func x86RuntimeGuard(target Target) string {
+	if !isX86AsmTarget(target) {
+		return ""
+	}
+	if target.Name == "AVX512" {
+		return "hwy.HasAVX512()"
+	}
+	return "hwy.HasAVX2()"
+}
+
 // isSVEStreamingTarget returns true for SVE targets that require SME streaming
 // mode (smstart/smstop). On Darwin, SVE instructions only work in streaming mode,
 // so per-function dispatch is impractical due to ~50ns transition overhead.
@@ -1250,12 +1322,24 @@ func neonNoSimdGuard(target Target) string {
 	return ""
 }
 
-// elemTypeFeatureGuard returns the runtime feature guard expression for ARM64
+// elemTypeFeatureGuard returns the runtime feature guard expression for
 // element types that require optional CPU extensions. Returns empty string for
 // universally-supported types (f32, f64, integers without DotAccFn).
-// Float16 requires FEAT_FP16 (ARMv8.2-A+), BFloat16 requires FEAT_BF16 (ARMv8.6-A+).
-// Profiles with DotAccFn require FEAT_DotProd (ARMv8.2-A+dotprod).
+// On ARM64, Float16 requires FEAT_FP16 (ARMv8.2-A+), BFloat16 requires
+// FEAT_BF16 (ARMv8.6-A+) and profiles with DotAccFn require FEAT_DotProd.
+// On x86, Float16 requires F16C (AVX2) or AVX512-FP16, BFloat16 AVX512-BF16.
 func elemTypeFeatureGuard(elemType string, profile *CIntrinsicProfile) string {
+	if profile != nil && (profile.TargetName == "AVX2" || profile.TargetName == "AVX512") {
+		switch {
+		case isFloat16Type(elemType) && profile.TargetName == "AVX2":
+			return "hwy.HasF16C()"
+		case isFloat16Type(elemType):
+			return "hwy.HasAVX512FP16()"
+		case isBFloat16Type(elemType):
+			return "hwy.HasAVX512BF16()"
+		}
+		return ""
+	}
 	if isFloat16Type(elemType) {
 		return "hwy.HasARMFP16()"
 	}
@@ -1299,11 +1383,11 @@ func emitGuardedDispatchAssignments(buf *bytes.Buffer, funcs []ParsedFunc, targe
 				continue
 			}
 			// Skip elem types whose C file was not compiled.
-			if compiledElemSuffixes != nil && !compiledElemSuffixes[cTypeSuffix(elemType)] {
+			if !asmCompiled(compiledElemSuffixes, pf.Name, elemType) {
 				continue
 			}
 			dv := buildDispatchVarName(pf.Name, elemType, len(pf.TypeParams) > 0)
-			an := buildAdapterFuncName(pf.Name, elemType)
+			an := buildAdapterFuncName(pf.Name, elemType, asmNameQualifier(target))
 			guard := elemTypeFeatureGuard(elemType, profile)
 			guardedAssignments[guard] = append(guardedAssignments[guard], dispatchAssignment{dv, an})
 		}
@@ -1315,7 +1399,7 @@ func emitGuardedDispatchAssignments(buf *bytes.Buffer, funcs []ParsedFunc, targe
 	}
 
 	// Emit guarded blocks in a stable order.
-	for _, guard := range []string{"hwy.HasARMFP16()", "hwy.HasARMBF16()", "hwy.HasARMDotProd()"} {
+	for _, guard := range []string{"hwy.HasARMFP16()", "hwy.HasARMBF16()", "hwy.HasARMDotProd()", "hwy.HasF16C()", "hwy.HasAVX512FP16()", "hwy.HasAVX512BF16()"} {
 		assignments := guardedAssignments[guard]
 		if len(assignments) == 0 {
 			continue
@@ -1338,7 +1422,7 @@ func needsHwyImportForDispatchAssignments(funcs []ParsedFunc, target Target, com
 			if shouldSkipPromotedType(&pf, profile) {
 				continue
 			}
-			if compiledElemSuffixes != nil && !compiledElemSuffixes[cTypeSuffix(elemType)] {
+			if !asmCompiled(compiledElemSuffixes, pf.Name, elemType) {
 				continue
 			}
 			if elemTypeFeatureGuard(elemType, profile) != "" {
@@ -1447,7 +1531,7 @@ func (g *Generator) emitZCDispatch(funcs []ParsedFunc, target Target) error {
 	// Determine if hwy import is needed:
 	// - Dispatch init wrappers use hwy runtime guards
 	// - Half-precision adapter signatures use hwy.Float16 / hwy.BFloat16
-	needsHwy := emitDispatchInit && (isNeonTarget(target) || (isSVETarget(target) && !isSVEStreamingTarget(target)))
+	needsHwy := emitDispatchInit && (isNeonTarget(target) || isX86AsmTarget(target) || (isSVETarget(target) && !isSVEStreamingTarget(target)))
 	if !needsHwy {
 		// Check if we need the hwy import for half-precision types
 		for _, pf := range funcs {
@@ -1487,7 +1571,8 @@ func (g *Generator) emitZCDispatch(funcs []ParsedFunc, target Target) error {
 		initFn := "init" + capPrefix + capTarget + "CAsm"
 		fmt.Fprintf(&buf, "func init() {\n\t%s()\n}\n\n", initFn)
 		fmt.Fprintf(&buf, "func %s() {\n", initFn)
-		// Emit runtime guards: NoSimdEnv for NEON, feature detection for SVE.
+		// Emit runtime guards: NoSimdEnv for NEON, feature detection for SVE,
+		// both for x86 (which runs after the archsimd or fallback dispatcher).
 		noSimdGuard := neonNoSimdGuard(target)
 		sveGuard := sveRuntimeGuard(target)
 		if noSimdGuard != "" {
@@ -1500,6 +1585,11 @@ func (g *Generator) emitZCDispatch(funcs []ParsedFunc, target Target) error {
 			fmt.Fprintf(&buf, "\t\treturn\n")
 			fmt.Fprintf(&buf, "\t}\n")
 		}
+		if x86Guard := x86RuntimeGuard(target); x86Guard != "" {
+			fmt.Fprintf(&buf, "\tif hwy.NoSimdEnv() || !%s {\n", x86Guard)
+			fmt.Fprintf(&buf, "\t\treturn\n")
+			fmt.Fprintf(&buf, "\t}\n")
+		}
 		emitGuardedDispatchAssignments(&buf, funcs, target, nil)
 		fmt.Fprintf(&buf, "}\n\n")
 	}
@@ -1564,12 +1654,12 @@ func (g *Generator) emitSliceAsmPassthrough(funcs []ParsedFunc, target Target, a
 				continue
 			}
 			// Skip elem types whose C file was not compiled.
-			if compiledElemSuffixes != nil && !compiledElemSuffixes[cTypeSuffix(elemType)] {
+			if !asmCompiled(compiledElemSuffixes, pf.Name, elemType) {
 				continue
 			}
 
 			// Exported name: LiftUpdate53_S32
-			exportedName := structAsmExportedName(pf.Name, elemType)
+			exportedName := structAsmExportedName(pf.Name, elemType, asmNameQualifier(target))
 			// Assembly name: liftupdate53_c_s32_neon
 			asmName := cAsmFuncName(pf.Name, elemType, targetSuffix)
 
@@ -1702,7 +1792,7 @@ func (g *Generator) emitZCDispatchForSlices(funcs []ParsedFunc, target Target, c
 	// Determine if hwy import is needed:
 	// - Dispatch init wrappers use hwy runtime guards
 	// - Half-precision adapter signatures use hwy.Float16 / hwy.BFloat16
-	needsHwy := emitDispatchInit && (isNeonTarget(target) || (isSVETarget(target) && !isSVEStreamingTarget(target)))
+	needsHwy := emitDispatchInit && (isNeonTarget(target) || isX86AsmTarget(target) || (isSVETarget(target) && !isSVEStreamingTarget(target)))
 	if !needsHwy {
 		// Check if we need the hwy import for half-precision types
 		for _, pf := range funcs {
@@ -1742,7 +1832,8 @@ func (g *Generator) emitZCDispatchForSlices(funcs []ParsedFunc, target Target, c
 		initFn := "init" + capPrefix + capTarget + "CAsm"
 		fmt.Fprintf(&buf, "func init() {\n\t%s()\n}\n\n", initFn)
 		fmt.Fprintf(&buf, "func %s() {\n", initFn)
-		// Emit runtime guards: NoSimdEnv for NEON, feature detection for SVE.
+		// Emit runtime guards: NoSimdEnv for NEON, feature detection for SVE,
+		// both for x86 (which runs after the archsimd or fallback dispatcher).
 		noSimdGuard := neonNoSimdGuard(target)
 		sveGuard := sveRuntimeGuard(target)
 		if noSimdGuard != "" {
@@ -1755,6 +1846,11 @@ func (g *Generator) emitZCDispatchForSlices(funcs []ParsedFunc, target Target, c
 			fmt.Fprintf(&buf, "\t\treturn\n")
 			fmt.Fprintf(&buf, "\t}\n")
 		}
+		if x86Guard := x86RuntimeGuard(target); x86Guard != "" {
+			fmt.Fprintf(&buf, "\tif hwy.NoSimdEnv() || !%s {\n", x86Guard)
+			fmt.Fprintf(&buf, "\t\treturn\n")
+			fmt.Fprintf(&buf, "\t}\n")
+		}
 		emitGuardedDispatchAssignments(&buf, funcs, target, compiledElemSuffixes)
 		fmt.Fprintf(&buf, "}\n\n")
 	}
@@ -1770,10 +1866,10 @@ func (g *Generator) emitZCDispatchForSlices(funcs []ParsedFunc, target Target, c
 				continue
 			}
 			// Skip elem types whose C file was not compiled.
-			if compiledElemSuffixes != nil && !compiledElemSuffixes[cTypeSuffix(elemType)] {
+			if !asmCompiled(compiledElemSuffixes, pf.Name, elemType) {
 				continue
 			}
-			emitSliceZCAdapterFunc(&buf, &pf, elemType)
+			emitSliceZCAdapterFunc(&buf, &pf, elemType, asmNameQualifier(target))
 		}
 	}
 
@@ -1912,9 +2008,9 @@ func referencesIdent(expr ast.Expr, name string) bool {
 // emitSliceZCAdapterFunc generates an adapter function for a non-struct
 // AST-translated function. The adapter converts Go slice/int/scalar params
 // to the unsafe.Pointer calling convention expected by the asm passthrough.
-func emitSliceZCAdapterFunc(buf *bytes.Buffer, pf *ParsedFunc, elemType string) {
-	adapterName := buildAdapterFuncName(pf.Name, elemType)
-	asmExportedName := structAsmExportedName(pf.Name, elemType)
+func emitSliceZCAdapterFunc(buf *bytes.Buffer, pf *ParsedFunc, elemType, qual string) {
+	adapterName := buildAdapterFuncName(pf.Name, elemType, qual)
+	asmExportedName := structAsmExportedName(pf.Name, elemType, qual)
 
 	goSliceType := astWrapperGoSliceType(elemType)
 
@@ -2021,11 +2117,14 @@ func emitSliceZCAdapterFunc(buf *bytes.Buffer, pf *ParsedFunc, elemType string)
 		fmt.Fprintf(buf, "\tlenVal := int64(%s)\n", sharedLenExpr)
 		fmt.Fprintf(buf, "\tif lenVal == 0 {\n")
 		if hasReturns {
-			var zeros []string
-			for _, ret := range pf.Returns {
-				zeros = append(zeros, goReturnZeroValue(ret.Type, elemType))
+			// The base function decides what empty input returns (true for
+			// IsSorted, -1 for Find, a panic for Argmax), so defer to its
+			// fallback instead of guessing a zero value.
+			var args []string
+			for _, p := range pf.Params {
+				args = append(args, p.Name)
 			}
-			fmt.Fprintf(buf, "\t\treturn %s\n", strings.Join(zeros, ", "))
+			fmt.Fprintf(buf, "\t\treturn %s(%s)\n", zcFallbackName(pf, elemType), strings.Join(args, ", "))
 		} else {
 			fmt.Fprintf(buf, "\t\treturn\n")
 		}
@@ -2113,8 +2212,11 @@ func (g *Generator) resolveAsmImportPath() (string, error) {
 
 // structAsmExportedName builds the exported function name for asm/ passthrough.
 // E.g., BaseForwardICT + float32 → ForwardICT_F32
-func structAsmExportedName(baseName, elemType string) string {
+func structAsmExportedName(baseName, elemType, qual string) string {
 	name := stripBasePrefix(baseName)
+	if qual != "" {
+		name += "_" + qual
+	}
 	return name + "_" + cTypePublicSuffix(elemType)
 }
 
@@ -2136,13 +2238,13 @@ func buildDispatchVarName(baseName, elemType string, isGeneric bool) string {
 
 // buildAdapterFuncName builds the unexported adapter function name.
 // E.g., BaseForwardICT + float32 → forwardICTAsmF32
-func buildAdapterFuncName(baseName, elemType string) string {
+func buildAdapterFuncName(baseName, elemType, qual string) string {
 	name := stripBasePrefix(baseName)
 	// Lowercase first letter
 	if len(name) > 0 {
 		name = strings.ToLower(name[:1]) + name[1:]
 	}
-	return name + "Asm" + cTypePublicSuffix(elemType)
+	return name + qual + "Asm" + cTypePublicSuffix(elemType)
 }
 
 // typeNameToDispatchSuffix returns the suffix used in dispatch variable names.
@@ -2156,7 +2258,7 @@ func typeNameToDispatchSuffix(elemType string) string {
 // emitZCAdapterFunc generates an adapter function that converts *Image[T] params
 // to C-compatible structs and calls the asm/ exported wrapper.
 func emitZCAdapterFunc(buf *bytes.Buffer, pf *ParsedFunc, elemType string, target Target) {
-	adapterName := buildAdapterFuncName(pf.Name, elemType)
+	adapterName := buildAdapterFuncName(pf.Name, elemType, asmNameQualifier(target))
 
 	// Build set of type parameter names for generic substitution.
 	typeParamNames := typeParamNameSet(pf.TypeParams)
@@ -2219,7 +2321,7 @@ func emitZCAdapterFunc(buf *bytes.Buffer, pf *ParsedFunc, elemType string, targe
 	// Call the asm/ exported function, passing struct pointers and scalar
 	// params. Scalar params are passed as unsafe.Pointer(&param) to match
 	// the GOAT calling convention (all scalars passed as pointers).
-	asmExportedName := structAsmExportedName(pf.Name, elemType)
+	asmExportedName := structAsmExportedName(pf.Name, elemType, asmNameQualifier(target))
 	fmt.Fprintf(buf, "\tasm.%s(\n", asmExportedName)
 	for _, p := range pf.Params {
 		if isGenericStructPtr(p.Type) {
@@ -2233,8 +2335,8 @@ func emitZCAdapterFunc(buf *bytes.Buffer, pf *ParsedFunc, elemType string, targe
 }
 
 // emitCWrapperFunc generates a single wrapper function.
-func emitCWrapperFunc(buf *bytes.Buffer, pf *ParsedFunc, elemType, targetSuffix string) {
-	publicName := buildCPublicName(pf.Name, elemType)
+func emitCWrapperFunc(buf *bytes.Buffer, pf *ParsedFunc, elemType, targetSuffix, qual string) {
+	publicName := buildCPublicName(pf.Name, elemType, qual)
 	asmName := cAsmFuncName(pf.Name, elemType, targetSuffix)
 	sliceType := cWrapperSliceType(elemType)
 
@@ -2280,12 +2382,12 @@ func emitCWrapperFunc(buf *bytes.Buffer, pf *ParsedFunc, elemType, targetSuffix
 
 // buildCPublicName creates the public function name.
 // BaseExpVec -> ExpVecCF32, BaseGELU -> GELUCF32
-func buildCPublicName(baseName, elemType string) string {
+func buildCPublicName(baseName, elemType, qual string) string {
 	name := stripBasePrefix(baseName)
 
 	typeSuffix := cTypePublicSuffix(elemType)
 
-	return name + "C" + typeSuffix
+	return name + "C" + qual + typeSuffix
 }
 
 // cAsmFuncName creates the assembly function name.
@@ -2498,6 +2600,20 @@ func goReturnZeroValue(goType, elemType string) string {
 	return "0"
 }
 
+// zcFallbackName returns the name of the fallback implementation hwygen
+// emits for pf at elemType, mirroring dispatchImplName.
+func zcFallbackName(pf *ParsedFunc, elemType string) string {
+	name := pf.Name
+	if pf.Private {
+		name = makeUnexported(name)
+	}
+	name += "_fallback"
+	if suffix := typeNameToSuffix(elemType); len(pf.TypeParams) > 0 && suffix != "Float32" {
+		name += "_" + suffix
+	}
+	return name
+}
+
 // emitReturnNarrowing writes the "return out_x, out_y, ..." line, converting
 // each int64/float out-var to its proper Go return type.
 func emitReturnNarrowing(buf *bytes.Buffer, pf *ParsedFunc, elemType string) {
@@ -2529,7 +2645,7 @@ func emitReturnNarrowing(buf *bytes.Buffer, pf *ParsedFunc, elemType string) {
 //
 // Note: Functions with *Image[T] params are handled through the normal transformer/emitter
 // flow via the asmBody generation, not through separate wrapper functions.
-func emitASTCWrapperFunc(buf *bytes.Buffer, pf *ParsedFunc, elemType, targetSuffix string) {
+func emitASTCWrapperFunc(buf *bytes.Buffer, pf *ParsedFunc, elemType, targetSuffix, qual string) {
 	// Skip functions with *Image[T] params - they go through the normal transformer flow
 	for _, p := range pf.Params {
 		if isGenericStructPtr(p.Type) {
@@ -2540,7 +2656,7 @@ func emitASTCWrapperFunc(buf *bytes.Buffer, pf *ParsedFunc, elemType, targetSuff
 	// Build set of type parameter names (e.g., T, P) for generic substitution.
 	typeParamNames := typeParamNameSet(pf.TypeParams)
 
-	publicName := buildCPublicName(pf.Name, elemType)
+	publicName := buildCPublicName(pf.Name, elemType, qual)
 	asmName := cAsmFuncName(pf.Name, elemType, targetSuffix)
 	goSliceType := astWrapperGoSliceType(elemType)
 
@@ -3,6 +3,7 @@ package main
 import (
 	"os"
 	"path/filepath"
+	"strings"
 	"testing"
 )
 
@@ -238,3 +239,47 @@ func TestNeonNoSimdGuard(t *testing.T) {
 		}
 	}
 }
+
+// TestX86RuntimeGuard verifies that AVX asm targets are guarded by the
+// x/sys/cpu feature checks and that other targets get no guard.
+func TestX86RuntimeGuard(t *testing.T) {
+	tests := []struct {
+		target Target
+		want   string
+	}{
+		{Target{Name: "AVX2", Mode: TargetModeAsm}, "hwy.HasAVX2()"},
+		{Target{Name: "AVX512", Mode: TargetModeAsm}, "hwy.HasAVX512()"},
+		{Target{Name: "AVX2", Mode: TargetModeGoSimd}, ""},
+		{Target{Name: "NEON", Mode: TargetModeAsm}, ""},
+	}
+	for _, tt := range tests {
+		got := x86RuntimeGuard(tt.target)
+		if got != tt.want {
+			t.Errorf("x86RuntimeGuard(%s, %v) = %q, want %q", tt.target.Name, tt.target.Mode, got, tt.want)
+		}
+	}
+}
+
+// TestX86FloatProfiles verifies that the AVX2 and AVX-512 float profiles are
+// registered for GoAT and carry the inline helpers their op maps refer to.
+func TestX86FloatProfiles(t *testing.T) {
+	for _, target := range []string{"AVX2", "AVX512"} {
+		for _, elemType := range []string{"float32", "float64"} {
+			p := GetCProfile(target, elemType)
+			if p == nil {
+				t.Fatalf("no %s %s profile", target, elemType)
+			}
+			if p.GoatTarget != "amd64" {
+				t.Errorf("%s %s: GoatTarget = %q, want amd64", target, elemType, p.GoatTarget)
+			}
+			helpers := strings.Join(p.InlineHelpers, "\n")
+			for _, fns := range []map[string]string{p.NegFn, p.ReduceSumFn, p.ReduceMaxFn} {
+				for _, fn := range fns {
+					if !strings.Contains(helpers, " "+fn+"(") {
+						t.Errorf("%s %s: helper %s is not defined", target, elemType, fn)
+					}
+				}
+			}
+		}
+	}
+}
@@ -1,6 +1,11 @@
 package main
 
-import "slices"
+import (
+	"fmt"
+	"slices"
+	"strconv"
+	"strings"
+)
 
 // GOAT-safe inline C math helpers.
 //
@@ -148,6 +153,97 @@ var neonF32MathHelpers = []string{
 	`static inline float32x4_t _v_sqrt_f32(float32x4_t x) {
     return vsqrtq_f32(x);
 }`,
+	// NEON vectorized pow(base, exp) = exp(exp * log(base)).
+	`static inline float32x4_t _v_pow_f32(float32x4_t base, float32x4_t exponent) {
+    return _v_exp_f32(vmulq_f32(exponent, _v_log_f32(base)));
+}`,
+	// NEON vectorized tanh(x) = 2*sigmoid(2*x) - 1.
+	`static inline float32x4_t _v_tanh_f32(float32x4_t x) {
+    float32x4_t two = vdupq_n_f32(2.0f);
+    float32x4_t one = vdupq_n_f32(1.0f);
+    float32x4_t sig2x = _v_sigmoid_f32(vmulq_f32(two, x));
+    return vsubq_f32(vmulq_f32(two, sig2x), one);
+}`,
+	// NEON vectorized rsqrt(x) = 1/sqrt(x) using vrsqrte + 2 Newton-Raphson steps.
+	`static inline float32x4_t _v_rsqrt_f32(float32x4_t x) {
+    float32x4_t est = vrsqrteq_f32(x);
+    est = vmulq_f32(est, vrsqrtsq_f32(vmulq_f32(x, est), est));
+    est = vmulq_f32(est, vrsqrtsq_f32(vmulq_f32(x, est), est));
+    return est;
+}`,
+	// NEON vectorized sin(x) using range reduction to [-pi/4, pi/4] + Chebyshev polynomial.
+	// Octant selection via vbslq_f32 for branchless quadrant handling.
+	`static inline float32x4_t _v_sin_f32(float32x4_t x) {
+    float32x4_t two_over_pi = vdupq_n_f32(0.6366197723675814f);
+    float32x4_t pi_over_2_hi = vdupq_n_f32(1.5707963267948966f);
+    float32x4_t pi_over_2_lo = vdupq_n_f32(6.123233995736766e-17f);
+    /* Range reduction: k = round(x * 2/pi) */
+    float32x4_t kf = vrndnq_f32(vmulq_f32(x, two_over_pi));
+    int32x4_t ki = vcvtnq_s32_f32(kf);
+    /* r = x - k * pi/2 (Cody-Waite two-step) */
+    float32x4_t r = vsubq_f32(x, vmulq_f32(kf, pi_over_2_hi));
+    r = vsubq_f32(r, vmulq_f32(kf, pi_over_2_lo));
+    float32x4_t r2 = vmulq_f32(r, r);
+    /* Sin polynomial: r * (1 + r^2*(s1 + r^2*(s2 + r^2*(s3 + r^2*s4)))) */
+    float32x4_t sp = vdupq_n_f32(2.718311493989822e-6f);
+    sp = vfmaq_f32(vdupq_n_f32(-0.00019839334836096632f), sp, r2);
+    sp = vfmaq_f32(vdupq_n_f32(0.008333329385889463f), sp, r2);
+    sp = vfmaq_f32(vdupq_n_f32(-0.16666666641626524f), sp, r2);
+    float32x4_t sinR = vfmaq_f32(r, vmulq_f32(r, r2), sp);
+    /* Cos polynomial: 1 + r^2*(c1 + r^2*(c2 + r^2*(c3 + r^2*c4))) */
+    float32x4_t cp = vdupq_n_f32(2.443315711809948e-5f);
+    cp = vfmaq_f32(vdupq_n_f32(-0.001388731625493765f), cp, r2);
+    cp = vfmaq_f32(vdupq_n_f32(0.04166662453689337f), cp, r2);
+    cp = vfmaq_f32(vdupq_n_f32(-0.4999999963229337f), cp, r2);
+    float32x4_t cosR = vfmaq_f32(vdupq_n_f32(1.0f), r2, cp);
+    /* Octant selection: bit 0 of k -> swap sin/cos, bit 1 -> negate */
+    int32x4_t one_i = vdupq_n_s32(1);
+    int32x4_t two_i = vdupq_n_s32(2);
+    uint32x4_t swap = vtstq_s32(ki, one_i);
+    uint32x4_t neg = vtstq_s32(ki, two_i);
+    float32x4_t result = vbslq_f32(swap, cosR, sinR);
+    result = vbslq_f32(neg, vnegq_f32(result), result);
+    return result;
+}`,
+	// NEON vectorized cos(x) = sin(x + pi/2), implemented via octant offset.
+	`static inline float32x4_t _v_cos_f32(float32x4_t x) {
+    float32x4_t two_over_pi = vdupq_n_f32(0.6366197723675814f);
+    float32x4_t pi_over_2_hi = vdupq_n_f32(1.5707963267948966f);
+    float32x4_t pi_over_2_lo = vdupq_n_f32(6.123233995736766e-17f);
+    float32x4_t kf = vrndnq_f32(vmulq_f32(x, two_over_pi));
+    int32x4_t ki = vcvtnq_s32_f32(kf);
+    ki = vaddq_s32(ki, vdupq_n_s32(1)); /* offset by 1 for cos */
+    float32x4_t r = vsubq_f32(x, vmulq_f32(kf, pi_over_2_hi));
+    r = vsubq_f32(r, vmulq_f32(kf, pi_over_2_lo));
+    float32x4_t r2 = vmulq_f32(r, r);
+    float32x4_t sp = vdupq_n_f32(2.718311493989822e-6f);
+    sp = vfmaq_f32(vdupq_n_f32(-0.00019839334836096632f), sp, r2);
+    sp = vfmaq_f32(vdupq_n_f32(0.008333329385889463f), sp, r2);
+    sp = vfmaq_f32(vdupq_n_f32(-0.16666666641626524f), sp, r2);
+    float32x4_t sinR = vfmaq_f32(r, vmulq_f32(r, r2), sp);
+    float32x4_t cp = vdupq_n_f32(2.443315711809948e-5f);
+    cp = vfmaq_f32(vdupq_n_f32(-0.001388731625493765f), cp, r2);
+    cp = vfmaq_f32(vdupq_n_f32(0.04166662453689337f), cp, r2);
+    cp = vfmaq_f32(vdupq_n_f32(-0.4999999963229337f), cp, r2);
+    float32x4_t cosR = vfmaq_f32(vdupq_n_f32(1.0f), r2, cp);
+    int32x4_t one_i = vdupq_n_s32(1);
+    int32x4_t two_i = vdupq_n_s32(2);
+    uint32x4_t swap = vtstq_s32(ki, one_i);
+    uint32x4_t neg = vtstq_s32(ki, two_i);
+    float32x4_t result = vbslq_f32(swap, cosR, sinR);
+    result = vbslq_f32(neg, vnegq_f32(result), result);
+    return result;
+}`,
+}
+
+// ---------------------------------------------------------------------------
+// Scalar float32 math helpers (tail loops of every f32/f16/bf16 profile)
+//
+// Like the f64 helpers below these use only scalar arithmetic, so NEON and
+// x86 profiles share them.
+// ---------------------------------------------------------------------------
+
+var scalarF32MathHelpers = []string{
 	// Scalar sqrt(x) using hardware fsqrt instruction.
 	`static inline float _s_sqrt_f32(float x) {
     return __builtin_sqrtf(x);
@@ -209,70 +305,18 @@ var neonF32MathHelpers = []string{
     poly = poly * y2 + 1.0f;
     float logM = 2.0f * y * poly;
     return e * 0.693359375f + logM + e * (-2.12194440e-4f);
-}`,
-	// NEON vectorized pow(base, exp) = exp(exp * log(base)).
-	`static inline float32x4_t _v_pow_f32(float32x4_t base, float32x4_t exponent) {
-    return _v_exp_f32(vmulq_f32(exponent, _v_log_f32(base)));
 }`,
 	// Scalar pow(base, exp) = exp(exp * log(base)).
 	`static inline float _s_pow_f32(float base, float exponent) {
     return _s_exp_f32(exponent * _s_log_f32(base));
-}`,
-	// NEON vectorized tanh(x) = 2*sigmoid(2*x) - 1.
-	`static inline float32x4_t _v_tanh_f32(float32x4_t x) {
-    float32x4_t two = vdupq_n_f32(2.0f);
-    float32x4_t one = vdupq_n_f32(1.0f);
-    float32x4_t sig2x = _v_sigmoid_f32(vmulq_f32(two, x));
-    return vsubq_f32(vmulq_f32(two, sig2x), one);
 }`,
 	// Scalar tanh(x) = 2*sigmoid(2*x) - 1.
 	`static inline float _s_tanh_f32(float x) {
     return 2.0f * _s_sigmoid_f32(2.0f * x) - 1.0f;
-}`,
-	// NEON vectorized rsqrt(x) = 1/sqrt(x) using vrsqrte + 2 Newton-Raphson steps.
-	`static inline float32x4_t _v_rsqrt_f32(float32x4_t x) {
-    float32x4_t est = vrsqrteq_f32(x);
-    est = vmulq_f32(est, vrsqrtsq_f32(vmulq_f32(x, est), est));
-    est = vmulq_f32(est, vrsqrtsq_f32(vmulq_f32(x, est), est));
-    return est;
 }`,
 	// Scalar rsqrt(x) = 1/sqrt(x). Uses __builtin_sqrtf to avoid <math.h> dependency.
 	`static inline float _s_rsqrt_f32(float x) {
     return 1.0f / __builtin_sqrtf(x);
-}`,
-	// NEON vectorized sin(x) using range reduction to [-pi/4, pi/4] + Chebyshev polynomial.
-	// Octant selection via vbslq_f32 for branchless quadrant handling.
-	`static inline float32x4_t _v_sin_f32(float32x4_t x) {
-    float32x4_t two_over_pi = vdupq_n_f32(0.6366197723675814f);
-    float32x4_t pi_over_2_hi = vdupq_n_f32(1.5707963267948966f);
-    float32x4_t pi_over_2_lo = vdupq_n_f32(6.123233995736766e-17f);
-    /* Range reduction: k = round(x * 2/pi) */
-    float32x4_t kf = vrndnq_f32(vmulq_f32(x, two_over_pi));
-    int32x4_t ki = vcvtnq_s32_f32(kf);
-    /* r = x - k * pi/2 (Cody-Waite two-step) */
-    float32x4_t r = vsubq_f32(x, vmulq_f32(kf, pi_over_2_hi));
-    r = vsubq_f32(r, vmulq_f32(kf, pi_over_2_lo));
-    float32x4_t r2 = vmulq_f32(r, r);
-    /* Sin polynomial: r * (1 + r^2*(s1 + r^2*(s2 + r^2*(s3 + r^2*s4)))) */
-    float32x4_t sp = vdupq_n_f32(2.718311493989822e-6f);
-    sp = vfmaq_f32(vdupq_n_f32(-0.00019839334836096632f), sp, r2);
-    sp = vfmaq_f32(vdupq_n_f32(0.008333329385889463f), sp, r2);
-    sp = vfmaq_f32(vdupq_n_f32(-0.16666666641626524f), sp, r2);
-    float32x4_t sinR = vfmaq_f32(r, vmulq_f32(r, r2), sp);
-    /* Cos polynomial: 1 + r^2*(c1 + r^2*(c2 + r^2*(c3 + r^2*c4))) */
-    float32x4_t cp = vdupq_n_f32(2.443315711809948e-5f);
-    cp = vfmaq_f32(vdupq_n_f32(-0.001388731625493765f), cp, r2);
-    cp = vfmaq_f32(vdupq_n_f32(0.04166662453689337f), cp, r2);
-    cp = vfmaq_f32(vdupq_n_f32(-0.4999999963229337f), cp, r2);
-    float32x4_t cosR = vfmaq_f32(vdupq_n_f32(1.0f), r2, cp);
-    /* Octant selection: bit 0 of k -> swap sin/cos, bit 1 -> negate */
-    int32x4_t one_i = vdupq_n_s32(1);
-    int32x4_t two_i = vdupq_n_s32(2);
-    uint32x4_t swap = vtstq_s32(ki, one_i);
-    uint32x4_t neg = vtstq_s32(ki, two_i);
-    float32x4_t result = vbslq_f32(swap, cosR, sinR);
-    result = vbslq_f32(neg, vnegq_f32(result), result);
-    return result;
 }`,
 	// Scalar sin(x) using range reduction + polynomial.
 	`static inline float _s_sin_f32(float x) {
@@ -294,35 +338,6 @@ var neonF32MathHelpers = []string{
     float result = (ki & 1) ? cosR : sinR;
     if (ki & 2) result = -result;
     return result;
-}`,
-	// NEON vectorized cos(x) = sin(x + pi/2), implemented via octant offset.
-	`static inline float32x4_t _v_cos_f32(float32x4_t x) {
-    float32x4_t two_over_pi = vdupq_n_f32(0.6366197723675814f);
-    float32x4_t pi_over_2_hi = vdupq_n_f32(1.5707963267948966f);
-    float32x4_t pi_over_2_lo = vdupq_n_f32(6.123233995736766e-17f);
-    float32x4_t kf = vrndnq_f32(vmulq_f32(x, two_over_pi));
-    int32x4_t ki = vcvtnq_s32_f32(kf);
-    ki = vaddq_s32(ki, vdupq_n_s32(1)); /* offset by 1 for cos */
-    float32x4_t r = vsubq_f32(x, vmulq_f32(kf, pi_over_2_hi));
-    r = vsubq_f32(r, vmulq_f32(kf, pi_over_2_lo));
-    float32x4_t r2 = vmulq_f32(r, r);
-    float32x4_t sp = vdupq_n_f32(2.718311493989822e-6f);
-    sp = vfmaq_f32(vdupq_n_f32(-0.00019839334836096632f), sp, r2);
-    sp = vfmaq_f32(vdupq_n_f32(0.008333329385889463f), sp, r2);
-    sp = vfmaq_f32(vdupq_n_f32(-0.16666666641626524f), sp, r2);
-    float32x4_t sinR = vfmaq_f32(r, vmulq_f32(r, r2), sp);
-    float32x4_t cp = vdupq_n_f32(2.443315711809948e-5f);
-    cp = vfmaq_f32(vdupq_n_f32(-0.001388731625493765f), cp, r2);
-    cp = vfmaq_f32(vdupq_n_f32(0.04166662453689337f), cp, r2);
-    cp = vfmaq_f32(vdupq_n_f32(-0.4999999963229337f), cp, r2);
-    float32x4_t cosR = vfmaq_f32(vdupq_n_f32(1.0f), r2, cp);
-    int32x4_t one_i = vdupq_n_s32(1);
-    int32x4_t two_i = vdupq_n_s32(2);
-    uint32x4_t swap = vtstq_s32(ki, one_i);
-    uint32x4_t neg = vtstq_s32(ki, two_i);
-    float32x4_t result = vbslq_f32(swap, cosR, sinR);
-    result = vbslq_f32(neg, vnegq_f32(result), result);
-    return result;
 }`,
 	// Scalar cos(x) = sin(x + pi/2) via octant offset.
 	`static inline float _s_cos_f32(float x) {
@@ -863,6 +878,10 @@ var neonU32MaskQueryHelpers = []string{
 	`static inline uint32x4_t hwy_first_n_u32(long n) {
     uint32x4_t iota = {0, 1, 2, 3};
     return vcltq_u32(iota, vdupq_n_u32((unsigned int)n));
+}`,
+	`static inline unsigned int hwy_bits_from_mask_u32(uint32x4_t mask) {
+    uint32x4_t lane_bits = {1, 2, 4, 8};
+    return vaddvq_u32(vandq_u32(mask, lane_bits));
 }`,
 }
 
@@ -892,6 +911,10 @@ var neonU64MaskQueryHelpers = []string{
 	`static inline uint64x2_t hwy_first_n_u64(long n) {
     uint64x2_t iota = {0, 1};
     return vcltq_u64(iota, vdupq_n_u64((unsigned long long)n));
+}`,
+	`static inline unsigned int hwy_bits_from_mask_u64(uint64x2_t mask) {
+    uint64x2_t lane_bits = {1, 2};
+    return (unsigned int)vaddvq_u64(vandq_u64(mask, lane_bits));
 }`,
 }
 
@@ -1048,3 +1071,305 @@ var neonU64MaskHelpers = slices.Concat(neonU64MaskQueryHelpers, []string{
     return count;
 }`,
 })
+
+// ---------------------------------------------------------------------------
+// x86 float32/float64 helpers (AVX2 and AVX-512)
+// ---------------------------------------------------------------------------
+// AVX2 and AVX-512 share the same helper bodies modulo register width, so the
+// helpers are written once as templates and expanded per profile. Comparisons
+// return a full-width vector mask on AVX2 and a k-register mask on AVX-512;
+// every mask consumer goes through hwy_mask_bits_* or hwy_blend_* so the
+// templates above the mask layer are ISA-agnostic.
+
+// x86FloatVec describes one x86 float vector shape for template expansion.
+type x86FloatVec struct {
+	vecType  string // "__m256", "__m512d"
+	prefix   string // "_mm256", "_mm512"
+	suffix   string // "ps", "pd"
+	cType    string // "float", "double"
+	helper   string // helper name suffix: "f32", "f64"
+	lanes    int
+	avx512   bool
+	maskType string // "__m256" (AVX2) or "__mmask16" (AVX-512)
+}
+
+func (v x86FloatVec) expand(templates ...string) []string {
+	si, siType := "si256", "__m256i"
+	round := "{P}_round_{S}(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)"
+	if v.avx512 {
+		si, siType = "si512", "__m512i"
+		round = "{P}_roundscale_{S}(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)"
+	}
+	iota := make([]string, v.lanes)
+	for i := range iota {
+		iota[i] = fmt.Sprintf("%d.0", i)
+		if v.cType == "float" {
+			iota[i] += "f"
+		}
+	}
+	r := strings.NewReplacer(
+		"{ROUND}", strings.NewReplacer("{P}", v.prefix, "{S}", v.suffix).Replace(round),
+		"{IOTA}", strings.Join(iota, ", "),
+		"{FULL}", fmt.Sprintf("0x%X", uint32(1)<<v.lanes-1),
+		"{SI_T}", siType,
+		"{SI}", si,
+		"{MT}", v.maskType,
+		"{V}", v.vecType,
+		"{P}", v.prefix,
+		"{S}", v.suffix,
+		"{T}", v.cType,
+		"{X}", v.helper,
+		"{N}", strconv.Itoa(v.lanes),
+	)
+	out := make([]string, len(templates))
+	for i, t := range templates {
+		out[i] = r.Replace(t)
+	}
+	return out
+}
+
+// x86FloatHelpers returns the inline helpers backing an AVX2/AVX-512 float
+// profile: lane ops without a single-instruction equivalent, comparisons,
+// mask queries, reductions and, for float32, vector math.
+func x86FloatHelpers(v x86FloatVec) []string {
+	var helpers []string
+	helpers = append(helpers, v.expand(
+		`static inline {V} hwy_neg_{X}({V} x) {
+    return {P}_xor_{S}(x, {P}_set1_{S}(-0.0));
+}`,
+		`static inline {V} hwy_abs_{X}({V} x) {
+    return {P}_andnot_{S}({P}_set1_{S}(-0.0), x);
+}`,
+		`static inline {V} hwy_round_{X}({V} x) {
+    return {ROUND};
+}`,
+		`static inline {T} hwy_get_lane_{X}({V} v, long idx) {
+    {T} lanes[{N}];
+    {P}_storeu_{S}(lanes, v);
+    return lanes[idx];
+}`,
+		`static inline {V} hwy_iota_{X}(void) {
+    return {P}_setr_{S}({IOTA});
+}`,
+		`static inline {V} _v_sqrt_{X}({V} x) {
+    return {P}_sqrt_{S}(x);
+}`,
+		`static inline {V} _v_rsqrt_{X}({V} x) {
+    return {P}_div_{S}({P}_set1_{S}(1.0), {P}_sqrt_{S}(x));
+}`,
+	)...)
+
+	if v.avx512 {
+		helpers = append(helpers, v.expand(
+			`static inline {MT} hwy_lt_{X}({V} a, {V} b) {
+    return {P}_cmp_{S}_mask(a, b, _CMP_LT_OQ);
+}`,
+			`static inline {MT} hwy_eq_{X}({V} a, {V} b) {
+    return {P}_cmp_{S}_mask(a, b, _CMP_EQ_OQ);
+}`,
+			`static inline {MT} hwy_gt_{X}({V} a, {V} b) {
+    return {P}_cmp_{S}_mask(a, b, _CMP_GT_OQ);
+}`,
+			`static inline {MT} hwy_ge_{X}({V} a, {V} b) {
+    return {P}_cmp_{S}_mask(a, b, _CMP_GE_OQ);
+}`,
+			`static inline {V} hwy_blend_{X}({V} no, {V} yes, {MT} mask) {
+    return {P}_mask_blend_{S}(mask, no, yes);
+}`,
+			`static inline {MT} hwy_mask_and_{X}({MT} a, {MT} b) {
+    return ({MT})(a & b);
+}`,
+			`static inline {MT} hwy_mask_or_{X}({MT} a, {MT} b) {
+    return ({MT})(a | b);
+}`,
+			`static inline {MT} hwy_mask_andnot_{X}({MT} a, {MT} b) {
+    return ({MT})(a & ~b);
+}`,
+			`static inline int hwy_mask_bits_{X}({MT} mask) {
+    return (int)mask;
+}`,
+			`static inline {MT} hwy_first_n_{X}(long n) {
+    if (n <= 0) return 0;
+    if (n >= {N}) return ({MT}){FULL};
+    return ({MT})((1u << n) - 1);
+}`,
+			`static inline long hwy_compress_store_{X}({V} v, {MT} mask, {T} *dst) {
+    {P}_mask_compressstoreu_{S}(dst, mask, v);
+    return __builtin_popcount((unsigned int)mask);
+}`,
+			`static inline {T} hwy_reduce_add_{X}({V} v) {
+    return {P}_reduce_add_{S}(v);
+}`,
+			`static inline {T} hwy_reduce_min_{X}({V} v) {
+    return {P}_reduce_min_{S}(v);
+}`,
+			`static inline {T} hwy_reduce_max_{X}({V} v) {
+    return {P}_reduce_max_{S}(v);
+}`,
+		)...)
+	} else {
+		helpers = append(helpers, v.expand(
+			`static inline {MT} hwy_lt_{X}({V} a, {V} b) {
+    return {P}_cmp_{S}(a, b, _CMP_LT_OQ);
+}`,
+			`static inline {MT} hwy_eq_{X}({V} a, {V} b) {
+    return {P}_cmp_{S}(a, b, _CMP_EQ_OQ);
+}`,
+			`static inline {MT} hwy_gt_{X}({V} a, {V} b) {
+    return {P}_cmp_{S}(a, b, _CMP_GT_OQ);
+}`,
+			`static inline {MT} hwy_ge_{X}({V} a, {V} b) {
+    return {P}_cmp_{S}(a, b, _CMP_GE_OQ);
+}`,
+			`static inline {V} hwy_blend_{X}({V} no, {V} yes, {MT} mask) {
+    return {P}_blendv_{S}(no, yes, mask);
+}`,
+			`static inline {MT} hwy_mask_and_{X}({MT} a, {MT} b) {
+    return {P}_and_{S}(a, b);
+}`,
+			`static inline {MT} hwy_mask_or_{X}({MT} a, {MT} b) {
+    return {P}_or_{S}(a, b);
+}`,
+			`static inline {MT} hwy_mask_andnot_{X}({MT} a, {MT} b) {
+    return {P}_andnot_{S}(b, a);
+}`,
+			`static inline int hwy_mask_bits_{X}({MT} mask) {
+    return {P}_movemask_{S}(mask);
+}`,
+			`static inline {MT} hwy_first_n_{X}(long n) {
+    return {P}_cmp_{S}(hwy_iota_{X}(), {P}_set1_{S}(({T})n), _CMP_LT_OQ);
+}`,
+			`static inline long hwy_compress_store_{X}({V} v, {MT} mask, {T} *dst) {
+    {T} lanes[{N}];
+    {P}_storeu_{S}(lanes, v);
+    int bits = {P}_movemask_{S}(mask);
+    long count = 0;
+    for (int i = 0; i < {N}; i++) {
+        if (bits & (1 << i)) dst[count++] = lanes[i];
+    }
+    return count;
+}`,
+		)...)
+		if v.cType == "float" {
+			for _, op := range []string{"add", "min", "max"} {
+				helpers = append(helpers, strings.ReplaceAll(`static inline float hwy_reduce_OP_f32(__m256 v) {
+    __m128 x = _mm_OP_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    x = _mm_OP_ps(x, _mm_movehl_ps(x, x));
+    x = _mm_OP_ss(x, _mm_movehdup_ps(x));
+    return _mm_cvtss_f32(x);
+}`, "OP", op))
+			}
+		} else {
+			for _, op := range []string{"add", "min", "max"} {
+				helpers = append(helpers, strings.ReplaceAll(`static inline double hwy_reduce_OP_f64(__m256d v) {
+    __m128d x = _mm_OP_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    x = _mm_OP_sd(x, _mm_unpackhi_pd(x, x));
+    return _mm_cvtsd_f64(x);
+}`, "OP", op))
+			}
+		}
+	}
+
+	helpers = append(helpers, v.expand(
+		`static inline long hwy_all_true_{X}({MT} mask) {
+    return hwy_mask_bits_{X}(mask) == {FULL};
+}`,
+		`static inline long hwy_all_false_{X}({MT} mask) {
+    return hwy_mask_bits_{X}(mask) == 0;
+}`,
+		`static inline long hwy_find_first_true_{X}({MT} mask) {
+    int bits = hwy_mask_bits_{X}(mask);
+    return bits ? __builtin_ctz(bits) : -1;
+}`,
+		`static inline long hwy_count_true_{X}({MT} mask) {
+    return __builtin_popcount(hwy_mask_bits_{X}(mask));
+}`,
+	)...)
+
+	if v.cType == "float" {
+		helpers = append(helpers, v.expand(x86F32MathTemplates...)...)
+	}
+	return helpers
+}
+
+// x86F32MathTemplates are the AVX2/AVX-512 ports of the NEON float32 vector
+// math helpers (same polynomials, so results match across targets).
+// Functions without an x86 port (sin, cos) make GoAT skip the kernel, which
+// then keeps its fallback implementation on that target.
+var x86F32MathTemplates = []string{
+	`static inline {V} _v_exp_f32({V} x) {
+    {V} invLn2 = {P}_set1_ps(1.44269504088896341f);
+    {V} ln2Hi = {P}_set1_ps(0.693359375f);
+    {V} ln2Lo = {P}_set1_ps(-2.12194440e-4f);
+    {V} c1 = {P}_set1_ps(1.0f);
+    {V} c2 = {P}_set1_ps(0.5f);
+    {V} c3 = {P}_set1_ps(0.16666666666666666f);
+    {V} c4 = {P}_set1_ps(0.041666666666666664f);
+    {V} c5 = {P}_set1_ps(0.008333333333333333f);
+    {V} c6 = {P}_set1_ps(0.001388888888888889f);
+    {MT} over = hwy_gt_f32(x, {P}_set1_ps(88.72283905206835f));
+    {MT} under = hwy_lt_f32(x, {P}_set1_ps(-87.33654475055310f));
+    {V} kf = hwy_round_f32({P}_mul_ps(x, invLn2));
+    {V} r = {P}_fnmadd_ps(kf, ln2Hi, x);
+    r = {P}_fnmadd_ps(kf, ln2Lo, r);
+    {V} ep = {P}_fmadd_ps(c6, r, c5);
+    ep = {P}_fmadd_ps(ep, r, c4);
+    ep = {P}_fmadd_ps(ep, r, c3);
+    ep = {P}_fmadd_ps(ep, r, c2);
+    ep = {P}_fmadd_ps(ep, r, c1);
+    ep = {P}_fmadd_ps(ep, r, c1);
+    {SI_T} ki = {P}_cvtps_epi32(kf);
+    {V} scale = {P}_cast{SI}_ps({P}_slli_epi32({P}_add_epi32(ki, {P}_set1_epi32(127)), 23));
+    {V} result = {P}_mul_ps(ep, scale);
+    result = hwy_blend_f32(result, {P}_set1_ps(1.0f / 0.0f), over);
+    return hwy_blend_f32(result, {P}_setzero_ps(), under);
+}`,
+	`static inline {V} _v_sigmoid_f32({V} x) {
+    {V} one = {P}_set1_ps(1.0f);
+    return {P}_div_ps(one, {P}_add_ps(one, _v_exp_f32(hwy_neg_f32(x))));
+}`,
+	`static inline {V} _v_tanh_f32({V} x) {
+    {V} two = {P}_set1_ps(2.0f);
+    {V} sig2x = _v_sigmoid_f32({P}_mul_ps(two, x));
+    return {P}_sub_ps({P}_mul_ps(two, sig2x), {P}_set1_ps(1.0f));
+}`,
+	`static inline {V} _v_erf_f32({V} x) {
+    {V} one = {P}_set1_ps(1.0f);
+    {V} abs_x = hwy_abs_f32(x);
+    {V} sign = hwy_blend_f32(one, {P}_set1_ps(-1.0f), hwy_lt_f32(x, {P}_setzero_ps()));
+    {V} t = {P}_div_ps(one, {P}_fmadd_ps({P}_set1_ps(0.3275911f), abs_x, one));
+    {V} t2 = {P}_mul_ps(t, t);
+    {V} t3 = {P}_mul_ps(t2, t);
+    {V} t4 = {P}_mul_ps(t3, t);
+    {V} t5 = {P}_mul_ps(t4, t);
+    {V} poly = {P}_mul_ps({P}_set1_ps(0.254829592f), t);
+    poly = {P}_fmadd_ps({P}_set1_ps(-0.284496736f), t2, poly);
+    poly = {P}_fmadd_ps({P}_set1_ps(1.421413741f), t3, poly);
+    poly = {P}_fmadd_ps({P}_set1_ps(-1.453152027f), t4, poly);
+    poly = {P}_fmadd_ps({P}_set1_ps(1.061405429f), t5, poly);
+    {V} exp_neg_x2 = _v_exp_f32(hwy_neg_f32({P}_mul_ps(abs_x, abs_x)));
+    return {P}_mul_ps(sign, {P}_fnmadd_ps(poly, exp_neg_x2, one));
+}`,
+	`static inline {V} _v_log_f32({V} x) {
+    {V} one = {P}_set1_ps(1.0f);
+    {SI_T} bits = {P}_castps_{SI}(x);
+    {SI_T} exp_i = {P}_sub_epi32({P}_and_{SI}({P}_srli_epi32(bits, 23), {P}_set1_epi32(0xFF)), {P}_set1_epi32(127));
+    {V} e = {P}_cvtepi32_ps(exp_i);
+    {SI_T} m_bits = {P}_or_{SI}({P}_and_{SI}(bits, {P}_set1_epi32(0x007FFFFF)), {P}_set1_epi32(0x3F800000));
+    {V} m = {P}_cast{SI}_ps(m_bits);
+    {MT} mLarge = hwy_gt_f32(m, {P}_set1_ps(1.414f));
+    m = hwy_blend_f32(m, {P}_mul_ps(m, {P}_set1_ps(0.5f)), mLarge);
+    e = hwy_blend_f32(e, {P}_add_ps(e, one), mLarge);
+    {V} y = {P}_div_ps({P}_sub_ps(m, one), {P}_add_ps(m, one));
+    {V} y2 = {P}_mul_ps(y, y);
+    {V} poly = {P}_fmadd_ps({P}_set1_ps(0.1111109921607489198f), y2, {P}_set1_ps(0.1428571437183119574f));
+    poly = {P}_fmadd_ps(poly, y2, {P}_set1_ps(0.1999999999970470954f));
+    poly = {P}_fmadd_ps(poly, y2, {P}_set1_ps(0.3333333333333367565f));
+    poly = {P}_fmadd_ps(poly, y2, one);
+    {V} logM = {P}_mul_ps({P}_mul_ps({P}_set1_ps(2.0f), y), poly);
+    return {P}_add_ps({P}_fmadd_ps(e, {P}_set1_ps(0.693359375f), logM), {P}_mul_ps(e, {P}_set1_ps(-2.12194440e-4f)));
+}`,
+	`static inline {V} _v_pow_f32({V} base, {V} exponent) {
+    return _v_exp_f32({P}_mul_ps(exponent, _v_log_f32(base)));
+}`,
+}
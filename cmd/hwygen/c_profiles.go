@@ -1,6 +1,9 @@
 package main
 
-import "slices"
+import (
+	"slices"
+	"strconv"
+)
 
 // CIntrinsicProfile defines the complete set of C intrinsics and metadata
 // for a specific target architecture + element type combination.
@@ -229,6 +232,10 @@ func init() {
 		avx2F16Profile(),
 		avx512F16Profile(),
 		avx512BF16Profile(),
+		avx2F32Profile(),
+		avx2F64Profile(),
+		avx512F32Profile(),
+		avx512F64Profile(),
 		neonUint64Profile(),
 		neonUint8Profile(),
 		neonUint32Profile(),
@@ -331,6 +338,7 @@ func neonF32Profile() *CIntrinsicProfile {
 		FindFirstTrueFn: map[string]string{"q": "hwy_find_first_true_u32"},
 		CountTrueFn:     map[string]string{"q": "hwy_count_true_u32"},
 		FirstNFn:        map[string]string{"q": "hwy_first_n_u32"},
+		BitsFromMaskFn:  map[string]string{"q": "hwy_bits_from_mask_u32"},
 		IotaFn:          map[string]string{"q": "hwy_iota_f32"},
 		CompressStoreFn: map[string]string{"q": "hwy_compress_store_f32"},
 
@@ -345,7 +353,7 @@ func neonF32Profile() *CIntrinsicProfile {
     __builtin_memcpy(&f, &bits, 4);
     return f;
 }`,
-		}, neonF32MathHelpers, scalarF64MathHelpers, neonF32MaskHelpers),
+		}, scalarF32MathHelpers, neonF32MathHelpers, scalarF64MathHelpers, neonF32MaskHelpers),
 
 		MathStrategy:   "native",
 		FmaArgOrder:    "acc_first",
@@ -415,6 +423,7 @@ func neonF64Profile() *CIntrinsicProfile {
 		FindFirstTrueFn: map[string]string{"q": "hwy_find_first_true_u64"},
 		CountTrueFn:     map[string]string{"q": "hwy_count_true_u64"},
 		FirstNFn:        map[string]string{"q": "hwy_first_n_u64"},
+		BitsFromMaskFn:  map[string]string{"q": "hwy_bits_from_mask_u64"},
 		IotaFn:          map[string]string{"q": "hwy_iota_f64"},
 		CompressStoreFn: map[string]string{"q": "hwy_compress_store_f64"},
 
@@ -546,7 +555,7 @@ func neonF16Profile() *CIntrinsicProfile {
 
 		NativeArithmetic: true,
 		ScalarArithType:  "float16_t",
-		InlineHelpers:    slices.Concat(neonF32MathHelpers, scalarF64MathHelpers, neonF16MaskHelpers),
+		InlineHelpers:    slices.Concat(scalarF32MathHelpers, neonF32MathHelpers, scalarF64MathHelpers, neonF16MaskHelpers),
 		MathStrategy:     "promoted",
 		PromoteFn:      "vcvt_f32_f16",
 		DemoteFn:       "vcvt_f16_f32(%s)",
@@ -644,7 +653,7 @@ func neonBF16Profile() *CIntrinsicProfile {
 		PointerElemType: "unsigned short", // BF16 elements are 2 bytes, not 4 (float)
 		ScalarPromote:   "bf16_scalar_to_f32",
 		ScalarDemote:    "f32_scalar_to_bf16",
-		InlineHelpers:   slices.Concat(neonBF16ArithHelpers, neonF32MathHelpers, scalarF64MathHelpers, neonF16MaskHelpers, neonBF16MaskHelpers),
+		InlineHelpers:   slices.Concat(neonBF16ArithHelpers, scalarF32MathHelpers, neonF32MathHelpers, scalarF64MathHelpers, neonF16MaskHelpers, neonBF16MaskHelpers),
 		MathStrategy:    "promoted",
 		PromoteFn:       "bf16_promote_lo",
 		DemoteFn:        "bf16_demote_half(%s)",
@@ -916,6 +925,126 @@ func avx512BF16Profile() *CIntrinsicProfile {
 	}
 }
 
+// ---------------------------------------------------------------------------
+// AVX2 / AVX-512 float32 and float64
+// ---------------------------------------------------------------------------
+// These profiles let hwygen compile float kernels to Go assembly with GoAT
+// ("avx2:asm", "avx512:asm"), so amd64 gets SIMD without GOEXPERIMENT=simd.
+// AVX2 profiles require FMA; AVX-512 profiles require F/BW/DQ/VL, matching
+// hwy.HasAVX2() and hwy.HasAVX512().
+
+func avx2F32Profile() *CIntrinsicProfile {
+	return x86FloatProfile("AVX2", "float32", x86FloatVec{
+		vecType: "__m256", prefix: "_mm256", suffix: "ps", cType: "float",
+		helper: "f32", lanes: 8, maskType: "__m256",
+	}, []string{"-mavx2", "-mfma"})
+}
+
+func avx2F64Profile() *CIntrinsicProfile {
+	return x86FloatProfile("AVX2", "float64", x86FloatVec{
+		vecType: "__m256d", prefix: "_mm256", suffix: "pd", cType: "double",
+		helper: "f64", lanes: 4, maskType: "__m256d",
+	}, []string{"-mavx2", "-mfma"})
+}
+
+func avx512F32Profile() *CIntrinsicProfile {
+	return x86FloatProfile("AVX512", "float32", x86FloatVec{
+		vecType: "__m512", prefix: "_mm512", suffix: "ps", cType: "float",
+		helper: "f32", lanes: 16, avx512: true, maskType: "__mmask16",
+	}, []string{"-mavx512f", "-mavx512bw", "-mavx512dq", "-mavx512vl", "-mfma"})
+}
+
+func avx512F64Profile() *CIntrinsicProfile {
+	return x86FloatProfile("AVX512", "float64", x86FloatVec{
+		vecType: "__m512d", prefix: "_mm512", suffix: "pd", cType: "double",
+		helper: "f64", lanes: 8, avx512: true, maskType: "__mmask8",
+	}, []string{"-mavx512f", "-mavx512bw", "-mavx512dq", "-mavx512vl", "-mfma"})
+}
+
+// x86FloatProfile builds an AVX2 or AVX-512 float profile. Both widths use a
+// single tier ("ymm" or "zmm") and route everything that is not one
+// intrinsic through the x86FloatHelpers inline helpers.
+func x86FloatProfile(targetName, elemType string, v x86FloatVec, flags []string) *CIntrinsicProfile {
+	tier := "ymm"
+	if v.avx512 {
+		tier = "zmm"
+	}
+	op := func(name string) map[string]string {
+		return map[string]string{tier: v.prefix + "_" + name + "_" + v.suffix}
+	}
+	helper := func(name string) map[string]string {
+		return map[string]string{tier: name + "_" + v.helper}
+	}
+
+	p := &CIntrinsicProfile{
+		ElemType:   elemType,
+		TargetName: targetName,
+		Include:    "#include <immintrin.h>",
+		CType:      v.cType,
+		VecTypes: map[string]string{
+			tier:     v.vecType,
+			"scalar": v.vecType,
+		},
+		Tiers: []CLoopTier{
+			{Name: tier, Lanes: v.lanes, Unroll: 4, IsScalar: false},
+			{Name: tier, Lanes: v.lanes, Unroll: 1, IsScalar: false},
+			{Name: "scalar", Lanes: 1, Unroll: 1, IsScalar: true},
+		},
+		LoadFn:    op("loadu"),
+		StoreFn:   op("storeu"),
+		AddFn:     op("add"),
+		SubFn:     op("sub"),
+		MulFn:     op("mul"),
+		DivFn:     op("div"),
+		FmaFn:     op("fmadd"),
+		NegFn:     helper("hwy_neg"),
+		AbsFn:     helper("hwy_abs"),
+		SqrtFn:    op("sqrt"),
+		RSqrtFn:   helper("_v_rsqrt"),
+		MinFn:     op("min"),
+		MaxFn:     op("max"),
+		DupFn:     op("set1"),
+		GetLaneFn: helper("hwy_get_lane"),
+
+		RoundFn: helper("hwy_round"),
+
+		ReduceSumFn:    helper("hwy_reduce_add"),
+		ReduceMinFn:    helper("hwy_reduce_min"),
+		ReduceMaxFn:    helper("hwy_reduce_max"),
+		LessThanFn:     helper("hwy_lt"),
+		EqualFn:        helper("hwy_eq"),
+		GreaterThanFn:  helper("hwy_gt"),
+		GreaterEqualFn: helper("hwy_ge"),
+		IfThenElseFn:   helper("hwy_blend"),
+		MaskType:       map[string]string{tier: v.maskType},
+
+		MaskAndFn:    helper("hwy_mask_and"),
+		MaskOrFn:     helper("hwy_mask_or"),
+		MaskAndNotFn: helper("hwy_mask_andnot"),
+
+		AllTrueFn:       helper("hwy_all_true"),
+		AllFalseFn:      helper("hwy_all_false"),
+		FindFirstTrueFn: helper("hwy_find_first_true"),
+		CountTrueFn:     helper("hwy_count_true"),
+		FirstNFn:        helper("hwy_first_n"),
+		IotaFn:          helper("hwy_iota"),
+		CompressStoreFn: helper("hwy_compress_store"),
+
+		InlineHelpers: slices.Concat(x86FloatHelpers(v), scalarF32MathHelpers, scalarF64MathHelpers),
+
+		MathStrategy:   "native",
+		FmaArgOrder:    "acc_last",
+		GoatTarget:     "amd64",
+		GoatExtraFlags: flags,
+	}
+	if elemType == "float32" {
+		p.ConvertToFloat32Fn = map[string]string{tier: v.prefix + "_cvtepi32_ps"}
+		p.ConvertToInt32Fn = map[string]string{tier: v.prefix + "_cvttps_epi32"}
+		p.Int32VecType = map[string]string{tier: "__m" + strconv.Itoa(v.lanes*32) + "i"}
+	}
+	return p
+}
+
 // ---------------------------------------------------------------------------
 // NEON uint64 (for RaBitQ bit product)
 // ---------------------------------------------------------------------------
@@ -981,6 +1110,7 @@ func neonUint64Profile() *CIntrinsicProfile {
 		FindFirstTrueFn: map[string]string{"q": "hwy_find_first_true_u64"},
 		CountTrueFn:     map[string]string{"q": "hwy_count_true_u64"},
 		FirstNFn:        map[string]string{"q": "hwy_first_n_u64"},
+		BitsFromMaskFn:  map[string]string{"q": "hwy_bits_from_mask_u64"},
 		IotaFn:          map[string]string{"q": "hwy_iota_u64"},
 		CompressStoreFn: map[string]string{"q": "hwy_compress_store_u64"},
 
@@ -1123,6 +1253,7 @@ func neonUint32Profile() *CIntrinsicProfile {
 		FindFirstTrueFn: map[string]string{"q": "hwy_find_first_true_u32"},
 		CountTrueFn:     map[string]string{"q": "hwy_count_true_u32"},
 		FirstNFn:        map[string]string{"q": "hwy_first_n_u32"},
+		BitsFromMaskFn:  map[string]string{"q": "hwy_bits_from_mask_u32"},
 		IotaFn:          map[string]string{"q": "hwy_iota_u32"},
 		CompressStoreFn: map[string]string{"q": "hwy_compress_store_u32"},
 
@@ -1192,6 +1323,7 @@ func neonInt32Profile() *CIntrinsicProfile {
 		FindFirstTrueFn: map[string]string{"q": "hwy_find_first_true_u32"},
 		CountTrueFn:     map[string]string{"q": "hwy_count_true_u32"},
 		FirstNFn:        map[string]string{"q": "hwy_first_n_u32"},
+		BitsFromMaskFn:  map[string]string{"q": "hwy_bits_from_mask_u32"},
 		IotaFn:          map[string]string{"q": "hwy_iota_s32"},
 		CompressStoreFn: map[string]string{"q": "hwy_compress_store_s32"},
 
@@ -1261,6 +1393,7 @@ func neonInt64Profile() *CIntrinsicProfile {
 		FindFirstTrueFn: map[string]string{"q": "hwy_find_first_true_u64"},
 		CountTrueFn:     map[string]string{"q": "hwy_count_true_u64"},
 		FirstNFn:        map[string]string{"q": "hwy_first_n_u64"},
+		BitsFromMaskFn:  map[string]string{"q": "hwy_bits_from_mask_u64"},
 		IotaFn:          map[string]string{"q": "hwy_iota_s64"},
 		CompressStoreFn: map[string]string{"q": "hwy_compress_store_s64"},
 
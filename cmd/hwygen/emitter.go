@@ -127,24 +127,6 @@ func dispatchImplName(pf ParsedFunc, dc dispatchComboInfo, target Target) string
 	return implName
 }
 
-func dispatcherNeedsHwyImport(funcs []ParsedFunc) bool {
-	for _, pf := range funcs {
-		if len(pf.TypeParams) > 0 {
-			return true
-		}
-		for _, dc := range getDispatchCombos(pf) {
-			typeMap := dc.Combo.Types
-			if len(typeMap) <= 1 {
-				typeMap = nil
-			}
-			if strings.Contains(buildFuncSignatureWithMap(pf, dc.ElemType, typeMap), "hwy.") {
-				return true
-			}
-		}
-	}
-	return false
-}
-
 func appendUniqueImport(imports []string, imp string) []string {
 	for _, existing := range imports {
 		if existing == imp {
@@ -414,6 +396,19 @@ func comboAvailable(targetComboMap map[string]map[string]bool, targetName, dispa
 	return available[dispatchName]
 }
 
+// targetMissesCombos reports whether the fallback provides a dispatch combo
+// that targetName does not.
+func targetMissesCombos(funcs []ParsedFunc, targetComboMap map[string]map[string]bool, targetName string) bool {
+	for _, pf := range funcs {
+		for _, dc := range getDispatchCombos(pf) {
+			if comboAvailable(targetComboMap, "Fallback", dc.DispatchName) && !comboAvailable(targetComboMap, targetName, dc.DispatchName) {
+				return true
+			}
+		}
+	}
+	return false
+}
+
 // EmitDispatcher generates the runtime dispatch file(s).
 // This generates architecture-specific dispatch files:
 // - dispatch_{prefix}_amd64.gen.go for AVX2/AVX512
@@ -446,6 +441,12 @@ func EmitDispatcher(funcs []ParsedFunc, targets []Target, pkgName, outPath, disp
 	for _, target := range targets {
 		switch target.Arch() {
 		case "amd64":
+			if isX86AsmTarget(target) {
+				// GoAT-compiled x86 kernels do not need archsimd. Their
+				// z_c_*.gen.go files self-register after the dispatcher that
+				// matches the toolchain (amd64 or _other) has run.
+				continue
+			}
 			amd64Targets = append(amd64Targets, target)
 		case "arm64":
 			arm64Targets = append(arm64Targets, target)
@@ -495,6 +496,24 @@ func EmitDispatcher(funcs []ParsedFunc, targets []Target, pkgName, outPath, disp
 		}
 	}
 
+	// Profiling wrappers build wherever one of the dispatchers above does.
+	// The fallback dispatcher covers every build the others do not.
+	var dispatchTags []string
+	if len(amd64Targets) > 0 {
+		dispatchTags = append(dispatchTags, dispatcherBuildTag("amd64"))
+	}
+	if len(arm64Targets) > 0 {
+		dispatchTags = append(dispatchTags, dispatcherBuildTag("arm64"))
+	}
+	if hasFallback {
+		dispatchTags = append(dispatchTags, "")
+	}
+	if len(dispatchTags) > 0 {
+		if err := emitProfileFile(funcs, pkgName, outPath, prefix, useCustomPrefix, dispatchTags); err != nil {
+			return err
+		}
+	}
+
 	return nil
 }
 
@@ -581,15 +600,53 @@ func emitArchDispatcher(funcs []ParsedFunc, archTargets []Target, hasFallback bo
 	for _, pf := range dispatchableFuncs {
 		if len(pf.TypeParams) > 0 {
 			emitGenericDispatcher(&buf, pf)
+			if pf.KernelHandle {
+				emitKernelAccessor(&buf, pf)
+			}
 		}
 	}
 
 	// Capitalize prefix for function names (e.g., "matmul" -> "Matmul")
 	capPrefix := cases.Title(language.English).String(prefix)
 
+	// IMPORTANT: Sort targets so more capable SIMD is checked first.
+	// AVX512 CPUs also have AVX2, so we must check AVX512 before AVX2.
+	sortedTargets := make([]Target, len(archTargets))
+	copy(sortedTargets, archTargets)
+	sort.Slice(sortedTargets, func(i, j int) bool {
+		return targetPriority(sortedTargets[i].Name) > targetPriority(sortedTargets[j].Name)
+	})
+
+	// Targets that get an init function, in dispatch order, for the
+	// hwy.RegisterDispatch table.
+	var regTargets []dispatchRegTarget
+	for _, target := range sortedTargets {
+		if isSVETarget(target) && !dispatcherOwnsAsmInit(target) {
+			continue
+		}
+		if target.Mode == TargetModeAsm && !hasAsmAdaptersForTarget(asmAdapters, target) {
+			continue
+		}
+		supported := "true"
+		switch {
+		case target.Name == "AVX512" || target.Name == "AVX2":
+			supported = "archsimd.X86." + target.Name + "()"
+		case isSVETarget(target):
+			supported = sveRuntimeGuard(target)
+		}
+		regTargets = append(regTargets, dispatchRegTarget{
+			Name:      forceTargetName(target),
+			Supported: supported,
+			Init:      targetInitFuncName(prefix, target),
+		})
+	}
+	if hasFallback {
+		regTargets = append(regTargets, dispatchRegTarget{Name: "fallback", Supported: "true", Init: "init" + capPrefix + "Fallback"})
+	}
+
 	// Generate init() function
 	initGenFn := "init" + capPrefix + "All"
-	fmt.Fprintf(&buf, "func init() {\n\t%s()\n}\n\n", initGenFn)
+	emitDispatchInit(&buf, dispatchableFuncs, pkgName, initGenFn, regTargets)
 	fmt.Fprintf(&buf, "func %s() {\n", initGenFn)
 	fmt.Fprintf(&buf, "\tif hwy.NoSimdEnv() {\n")
 	fmt.Fprintf(&buf, "\t\tinit%sFallback()\n", capPrefix)
@@ -597,14 +654,6 @@ func emitArchDispatcher(funcs []ParsedFunc, archTargets []Target, hasFallback bo
 	fmt.Fprintf(&buf, "\t}\n")
 
 	// Add CPU detection for each target.
-	// IMPORTANT: Sort targets so more capable SIMD is checked first.
-	// AVX512 CPUs also have AVX2, so we must check AVX512 before AVX2.
-	sortedTargets := make([]Target, len(archTargets))
-	copy(sortedTargets, archTargets)
-	sort.Slice(sortedTargets, func(i, j int) bool {
-		return targetPriority(sortedTargets[i].Name) > targetPriority(sortedTargets[j].Name)
-	})
-
 	for _, target := range sortedTargets {
 		switch target.Name {
 		case "AVX512":
@@ -673,6 +722,12 @@ func emitArchDispatcher(funcs []ParsedFunc, archTargets []Target, hasFallback bo
 			continue
 		}
 
+		// Combos that only a fallback specialization provides (for example
+		// 8-bit lanes of a group whose SIMD bodies cover 32 and 64 bits)
+		// keep their fallback implementation on this target.
+		if hasFallback && targetMissesCombos(dispatchableFuncs, targetComboMap, target.Name) {
+			fmt.Fprintf(&buf, "\tinit%sFallback()\n", capPrefix)
+		}
 		for _, pf := range dispatchableFuncs {
 			for _, dc := range getDispatchCombos(pf) {
 				if !comboAvailable(targetComboMap, target.Name, dc.DispatchName) {
@@ -737,11 +792,10 @@ func emitFallbackOnlyDispatcher(funcs []ParsedFunc, pkgName, outPath, prefix, su
 	}
 	fmt.Fprintf(&buf, "\npackage %s\n\n", pkgName)
 
-	if dispatcherNeedsHwyImport(dispatchableFuncs) {
-		fmt.Fprintf(&buf, "import (\n")
-		fmt.Fprintf(&buf, "\t\"github.com/ajroetker/go-highway/hwy\"\n")
-		fmt.Fprintf(&buf, ")\n\n")
-	}
+	// hwy is always needed for RegisterDispatch
+	fmt.Fprintf(&buf, "import (\n")
+	fmt.Fprintf(&buf, "\t\"github.com/ajroetker/go-highway/hwy\"\n")
+	fmt.Fprintf(&buf, ")\n\n")
 
 	// Declare function variables
 	for _, pf := range dispatchableFuncs {
@@ -760,6 +814,9 @@ func emitFallbackOnlyDispatcher(funcs []ParsedFunc, pkgName, outPath, prefix, su
 	for _, pf := range dispatchableFuncs {
 		if len(pf.TypeParams) > 0 {
 			emitGenericDispatcher(&buf, pf)
+			if pf.KernelHandle {
+				emitKernelAccessor(&buf, pf)
+			}
 		}
 	}
 
@@ -768,7 +825,9 @@ func emitFallbackOnlyDispatcher(funcs []ParsedFunc, pkgName, outPath, prefix, su
 
 	// Simple init that just uses fallback
 	initGenFn := "init" + capPrefix + "All"
-	fmt.Fprintf(&buf, "func init() {\n\t%s()\n}\n\n", initGenFn)
+	emitDispatchInit(&buf, dispatchableFuncs, pkgName, initGenFn, []dispatchRegTarget{
+		{Name: "fallback", Supported: "true", Init: "init" + capPrefix + "Fallback"},
+	})
 	fmt.Fprintf(&buf, "func %s() {\n", initGenFn)
 	fmt.Fprintf(&buf, "\tinit%sFallback()\n", capPrefix)
 	fmt.Fprintf(&buf, "}\n\n")
@@ -805,6 +864,61 @@ func emitFallbackOnlyDispatcher(funcs []ParsedFunc, pkgName, outPath, prefix, su
 	return nil
 }
 
+// dispatchRegTarget is one entry of the Targets list passed to
+// hwy.RegisterDispatch: the HWY_FORCE name, the Go expression that tells
+// whether the CPU supports it, and the init function that selects it.
+type dispatchRegTarget struct {
+	Name      string
+	Supported string
+	Init      string
+}
+
+// forceTargetName returns the lower-case name HWY_FORCE uses for target.
+func forceTargetName(target Target) string {
+	if isSVETarget(target) {
+		return "sve"
+	}
+	return strings.ToLower(target.Name)
+}
+
+// emitDispatchInit emits the package init function of a dispatch file. It
+// runs the default selection and then registers every dispatch group with
+// hwy.RegisterDispatch, which applies HWY_FORCE and feeds hwy.DispatchReport:
+//
+//	func init() {
+//		initDotAll()
+//		hwy.RegisterDispatch(hwy.DispatchTable{
+//			Package: "vec",
+//			Groups: []hwy.DispatchGroup{
+//				{Name: "Dot", Vars: []any{&DotFloat32, &DotFloat64}},
+//			},
+//			Targets: []hwy.DispatchTarget{
+//				{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initDotAVX2},
+//				{Name: "fallback", Supported: true, Init: initDotFallback},
+//			},
+//		})
+//	}
+func emitDispatchInit(buf *bytes.Buffer, funcs []ParsedFunc, pkgName, initGenFn string, targets []dispatchRegTarget) {
+	fmt.Fprintf(buf, "func init() {\n\t%s()\n", initGenFn)
+	fmt.Fprintf(buf, "\thwy.RegisterDispatch(hwy.DispatchTable{\n")
+	fmt.Fprintf(buf, "\t\tPackage: %q,\n", pkgName)
+	fmt.Fprintf(buf, "\t\tGroups: []hwy.DispatchGroup{\n")
+	for _, pf := range funcs {
+		var vars []string
+		for _, dc := range getDispatchCombos(pf) {
+			vars = append(vars, "&"+dc.DispatchName)
+		}
+		fmt.Fprintf(buf, "\t\t\t{Name: %q, Vars: []any{%s}},\n", buildGenericFuncName(pf.Name, pf.Private), strings.Join(vars, ", "))
+	}
+	fmt.Fprintf(buf, "\t\t},\n")
+	fmt.Fprintf(buf, "\t\tTargets: []hwy.DispatchTarget{\n")
+	for _, t := range targets {
+		fmt.Fprintf(buf, "\t\t\t{Name: %q, Supported: %s, Init: %s},\n", t.Name, t.Supported, t.Init)
+	}
+	fmt.Fprintf(buf, "\t\t},\n")
+	fmt.Fprintf(buf, "\t})\n}\n\n")
+}
+
 // EmitTarget generates a target-specific implementation file.
 // sourceImports contains the imports from the original source file that should be preserved
 // if they're still used after transformation (e.g., "unsafe", "math/bits").
@@ -996,6 +1110,12 @@ func emitGenericDispatcher(buf *bytes.Buffer, pf ParsedFunc) {
 	// Copy doc comments from the base function, then add dispatch note
 	if pf.Doc != nil {
 		for _, comment := range pf.Doc.List {
+			// //hwy:maskedtail only shapes the AVX bodies and //hwy:profile
+			// only the hwyprof wrappers; keep them out of the dispatchers,
+			// which every architecture shares.
+			if text := strings.TrimSpace(comment.Text); text == "//hwy:maskedtail" || strings.HasPrefix(text, "//hwy:profile ") {
+				continue
+			}
 			// Rewrite the first line to use the dispatch function name instead of the base name
 			text := comment.Text
 			if after, ok := strings.CutPrefix(text, "// "+pf.Name+" "); ok {
@@ -1017,55 +1137,98 @@ func emitGenericDispatcher(buf *bytes.Buffer, pf ParsedFunc) {
 		}
 		fmt.Fprintf(buf, "%s %s", tp.Name, tp.Constraint)
 	}
-	fmt.Fprintf(buf, "](")
+	fmt.Fprintf(buf, "]%s {\n", genericSignature(pf))
 
-	// Parameters
+	if isMultiType {
+		// Multi-type dispatch: nested type switches.
+		// Group combos by first type param value for the outer switch.
+		if len(pf.Returns) > 0 {
+			emitMultiTypeDispatchWithAssertions(buf, pf, combos)
+		} else {
+			emitMultiTypeDispatch(buf, pf, combos)
+		}
+	} else {
+		// Single-type dispatch: simple type switch on first generic param
+		if len(pf.Returns) > 0 {
+			emitSingleTypeDispatchWithAssertions(buf, pf, combos)
+		} else {
+			emitSingleTypeDispatch(buf, pf, combos)
+		}
+	}
+
+	fmt.Fprintf(buf, "}\n\n")
+}
+
+// genericSignature returns the parameter and result list of a generic source
+// function with its type parameters left in place, e.g. "(a []T, b []T) T".
+func genericSignature(pf ParsedFunc) string {
+	var sb strings.Builder
+	sb.WriteString("(")
 	for i, param := range pf.Params {
 		if i > 0 {
-			fmt.Fprintf(buf, ", ")
+			sb.WriteString(", ")
 		}
-		fmt.Fprintf(buf, "%s %s", param.Name, param.Type)
+		fmt.Fprintf(&sb, "%s %s", param.Name, param.Type)
 	}
-	fmt.Fprintf(buf, ")")
+	sb.WriteString(")")
 
-	// Return type if any
 	if len(pf.Returns) > 0 {
 		if len(pf.Returns) == 1 && pf.Returns[0].Name == "" {
-			fmt.Fprintf(buf, " %s", pf.Returns[0].Type)
+			fmt.Fprintf(&sb, " %s", pf.Returns[0].Type)
 		} else {
-			fmt.Fprintf(buf, " (")
+			sb.WriteString(" (")
 			for i, ret := range pf.Returns {
 				if i > 0 {
-					fmt.Fprintf(buf, ", ")
+					sb.WriteString(", ")
 				}
 				if ret.Name != "" {
-					fmt.Fprintf(buf, "%s ", ret.Name)
+					fmt.Fprintf(&sb, "%s ", ret.Name)
 				}
-				fmt.Fprintf(buf, "%s", ret.Type)
+				sb.WriteString(ret.Type)
 			}
-			fmt.Fprintf(buf, ")")
+			sb.WriteString(")")
 		}
 	}
+	return sb.String()
+}
 
-	fmt.Fprintf(buf, " {\n")
-
-	if isMultiType {
-		// Multi-type dispatch: nested type switches.
-		// Group combos by first type param value for the outer switch.
-		if len(pf.Returns) > 0 {
-			emitMultiTypeDispatchWithAssertions(buf, pf, combos)
-		} else {
-			emitMultiTypeDispatch(buf, pf, combos)
-		}
-	} else {
-		// Single-type dispatch: simple type switch on first generic param
-		if len(pf.Returns) > 0 {
-			emitSingleTypeDispatchWithAssertions(buf, pf, combos)
-		} else {
-			emitSingleTypeDispatch(buf, pf, combos)
-		}
+// emitKernelAccessor generates the kernel handle for a //hwy:kernel function.
+// For BaseDot[T hwy.Floats], this generates:
+//
+//	func DotKernel[T hwy.Floats]() func(a []T, b []T) T {
+//	    var zero T
+//	    if _, ok := any(zero).(float32); ok {
+//	        return any(DotFloat32).(func(a []T, b []T) T)
+//	    }
+//	    ...
+//	}
+//
+// The returned value is the per-type function variable at the time of the
+// call, so callers pay the type dispatch once instead of on every call. It
+// is a copy: later ForceDispatch overrides do not reach it, which the
+// generated comment spells out.
+func emitKernelAccessor(buf *bytes.Buffer, pf ParsedFunc) {
+	genericName := buildGenericFuncName(pf.Name, pf.Private)
+	tp := pf.TypeParams[0]
+	funcType := "func" + genericSignature(pf)
+
+	fmt.Fprintf(buf, "// %sKernel returns the %s implementation selected for %s on this CPU.\n", genericName, genericName, tp.Name)
+	fmt.Fprintf(buf, "// Calling the returned function skips the per-call type dispatch of %s,\n", genericName)
+	fmt.Fprintf(buf, "// which matters when it is called many times on short inputs.\n")
+	fmt.Fprintf(buf, "//\n")
+	fmt.Fprintf(buf, "// The handle is the implementation in effect when %sKernel is called.\n", genericName)
+	fmt.Fprintf(buf, "// Take it after hwy.ForceDispatch or hwy.ApplyDispatchEnv, and again after\n")
+	fmt.Fprintf(buf, "// any later override or restore; an older handle keeps the old target.\n")
+	fmt.Fprintf(buf, "func %sKernel[%s %s]() %s {\n", genericName, tp.Name, tp.Constraint, funcType)
+	fmt.Fprintf(buf, "\tvar zero %s\n", tp.Name)
+	for _, combo := range getTypeCombinations(&pf) {
+		elemType := comboPrimaryType(combo, pf.TypeParams)
+		dispatchName := buildDispatchFuncNameCombo(pf.Name, combo, pf.TypeParams, pf.Private)
+		fmt.Fprintf(buf, "\tif _, ok := any(zero).(%s); ok {\n", elemType)
+		fmt.Fprintf(buf, "\t\treturn any(%s).(%s)\n", dispatchName, funcType)
+		fmt.Fprintf(buf, "\t}\n")
 	}
-
+	fmt.Fprintf(buf, "\tpanic(\"unsupported type\")\n")
 	fmt.Fprintf(buf, "}\n\n")
 }
 
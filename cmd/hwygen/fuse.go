@@ -0,0 +1,1611 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package main
+
+import (
+	"bytes"
+	"fmt"
+	"go/ast"
+	"go/parser"
+	"go/token"
+	"go/types"
+	"os"
+	"path/filepath"
+	"reflect"
+	"slices"
+	"strconv"
+	"strings"
+)
+
+// Cross-function loop fusion.
+//
+// A function marked //hwy:fuse is a composite: a sequence of calls to
+// elementwise kernels, optionally ending in "return Kernel(...)".
+//
+//	//hwy:fuse
+//	func BaseScaleTanhSum[T hwy.Floats](x []T, scale T) T {
+//		vec.BaseScale(scale, x)
+//		activation.BaseTanh(x, x)
+//		return vec.BaseSum(x)
+//	}
+//
+// Before any other analysis, Parse replaces the composite's body with the
+// inlined bodies of its callees, whose main SIMD loops are merged into one so
+// the generated kernel makes a single pass over memory. Inside the merged
+// loop, a vector stored to s[i:] is forwarded to later hwy.Load(s[i:]) calls
+// of the same iteration, and a store that a later stage overwrites before any
+// load reads memory is dropped. The result is an ordinary Base function, so
+// every target, including the C and IR paths, generates from it.
+//
+// A stage must have the shape of the vec and activation kernels: setup
+// statements, one SIMD loop "for i = 0; i+lanes <= n; i += lanes" that
+// touches memory only at x[i:], optional statements after it, an optional
+// scalar tail loop from i, and for the final stage an optional return.
+// The slice parameters of a composite must not overlap one another, since
+// loads and stores are matched by slice name; one slice may be passed to a
+// stage several times, as for the in-place forms of the kernels themselves.
+
+// FusionInfo describes the stages inlined into a //hwy:fuse composite.
+type FusionInfo struct {
+	Stages           []string // callee of each stage as written, e.g. "vec.BaseScale"
+	LoadsForwarded   int      // loads replaced by a vector stored earlier in the iteration
+	StoresEliminated int      // stores overwritten later in the same iteration
+	Accumulators     int      // accumulator chains kept from the stages' //hwy:accumulators
+}
+
+// fuseComposites inlines the stages of every //hwy:fuse function in file and
+// returns what was fused, keyed by function name. Imports that the inlined
+// bodies need are added to imports.
+func fuseComposites(file *ast.File, fset *token.FileSet, filename string, imports map[string]string, directives []FuseDirective) (map[string]*FusionInfo, error) {
+	if len(directives) == 0 {
+		return nil, nil
+	}
+	absFile, err := filepath.Abs(filename)
+	if err != nil {
+		return nil, err
+	}
+
+	fusions := make(map[string]*FusionInfo)
+	for _, decl := range file.Decls {
+		funcDecl, ok := decl.(*ast.FuncDecl)
+		if !ok || funcDecl.Recv != nil || funcDecl.Body == nil {
+			continue
+		}
+		funcLine := fset.Position(funcDecl.Pos()).Line
+		marked := false
+		for _, fd := range directives {
+			if fd.Line >= funcLine-5 && fd.Line < funcLine {
+				marked = true
+			}
+		}
+		if !marked {
+			continue
+		}
+		f := &fuser{dir: filepath.Dir(absFile), imports: imports, fn: funcDecl}
+		info, err := f.fuse()
+		if err != nil {
+			return nil, fmt.Errorf("%s: //hwy:fuse: %w", fset.Position(funcDecl.Pos()), err)
+		}
+		fusions[funcDecl.Name.Name] = info
+	}
+	return fusions, nil
+}
+
+// fuser builds the fused body of one composite.
+type fuser struct {
+	dir     string            // directory of the composite's package
+	imports map[string]string // composite imports, extended with the stages'
+	fn      *ast.FuncDecl
+	returns bool // the last stage's result is the composite's result
+	stages  []*fuseStage
+
+	taken      map[string]bool // names the fused body may not declare again
+	iter       string          // iterator of the merged loop
+	strideExpr ast.Expr        // step of the merged loop
+}
+
+// fuseStage is one inlined kernel call.
+type fuseStage struct {
+	name         string              // callee as written, e.g. "vec.BaseScale"
+	body         *ast.BlockStmt      // callee body, rewritten in place
+	subst        map[string]ast.Expr // callee params, type params and qualified package names
+	temps        []fuseTemp          // arguments that need a temporary
+	bindings     []ast.Stmt          // declarations of temps
+	sliceParams  map[string]bool     // callee params of slice type
+	setupReads   bool                // the prologue reads slice data
+	postReads    bool                // the post-loop statements read slice data
+	locals       []string            // names the callee declares, in order
+	free         map[string]bool     // names the callee uses but does not declare
+	accumulators int                 // //hwy:accumulators of the callee's loop
+
+	guards   []ast.Stmt // "if len(x) == 0 { return }" checks
+	prologue []ast.Stmt // statements before the SIMD loop
+	loop     *ast.ForStmt
+	iter     string // loop iterator
+	stride   string // loop step when it is a local identifier
+	post     []ast.Stmt
+	tail     *ast.ForStmt
+	ret      *ast.ReturnStmt
+}
+
+// fuseTemp is a call argument bound to a temporary, because substituting the
+// expression for every use of the parameter could change its meaning.
+type fuseTemp struct {
+	param string
+	typ   ast.Expr
+	value ast.Expr
+}
+
+func (f *fuser) fuse() (*FusionInfo, error) {
+	fn := f.fn
+	stmts := fn.Body.List
+	if len(stmts) == 0 {
+		return nil, fmt.Errorf("%s has no stages", fn.Name.Name)
+	}
+	if fn.Type.Results != nil && fn.Type.Results.NumFields() > 0 {
+		f.returns = true
+		if fn.Type.Results.NumFields() != 1 {
+			return nil, fmt.Errorf("%s may return at most one value", fn.Name.Name)
+		}
+	}
+
+	for i, stmt := range stmts {
+		var call *ast.CallExpr
+		switch s := stmt.(type) {
+		case *ast.ExprStmt:
+			call, _ = s.X.(*ast.CallExpr)
+		case *ast.ReturnStmt:
+			if f.returns && i == len(stmts)-1 && len(s.Results) == 1 {
+				call, _ = s.Results[0].(*ast.CallExpr)
+			}
+		}
+		if call == nil {
+			return nil, fmt.Errorf("statement %d of %s is not a kernel call; a composite only calls kernels and returns the last call's result",
+				i+1, fn.Name.Name)
+		}
+		returns := f.returns && i == len(stmts)-1
+		st, err := f.loadStage(call, returns)
+		if err != nil {
+			return nil, err
+		}
+		f.stages = append(f.stages, st)
+	}
+
+	// Fused, every stage's setup runs before the first loop and every
+	// stage's post-loop code after the last one.
+	for k, st := range f.stages {
+		if k > 0 && st.setupReads {
+			return nil, fmt.Errorf("%s reads its input before its SIMD loop, before the earlier stages have written it", st.name)
+		}
+		if k < len(f.stages)-1 && st.postReads {
+			return nil, fmt.Errorf("%s reads its data after its SIMD loop, after the later stages have written it", st.name)
+		}
+		for _, t := range st.temps {
+			if k > 0 && !f.pureArg(t.value) {
+				return nil, fmt.Errorf("argument %s of %s would be evaluated before the earlier stages run; pass a variable",
+					exprToString(t.value), st.name)
+			}
+		}
+	}
+
+	f.reserveNames()
+	for k, st := range f.stages {
+		if err := f.rewriteStage(k, st); err != nil {
+			return nil, err
+		}
+	}
+
+	info := &FusionInfo{}
+	body := f.assemble(info)
+	clearPositions(body)
+	fn.Body = body
+
+	// Keep the widest accumulator split a stage asked for, if the merged loop
+	// still has the shape //hwy:accumulators needs.
+	for _, st := range f.stages {
+		info.Accumulators = max(info.Accumulators, st.accumulators)
+	}
+	if info.Accumulators > 1 {
+		li := &LoopInfo{Iterator: f.iter, Accumulators: info.Accumulators}
+		if findReductionAccumulators(body, li) != nil {
+			info.Accumulators = 0
+		}
+	}
+	return info, nil
+}
+
+// loadStage parses the callee of call and checks that it can be fused.
+func (f *fuser) loadStage(call *ast.CallExpr, returns bool) (*fuseStage, error) {
+	fun := call.Fun
+	var typeArgs []ast.Expr
+	switch e := fun.(type) {
+	case *ast.IndexExpr:
+		fun, typeArgs = e.X, []ast.Expr{e.Index}
+	case *ast.IndexListExpr:
+		fun, typeArgs = e.X, e.Indices
+	}
+
+	var dir, qual, name string
+	switch e := fun.(type) {
+	case *ast.Ident:
+		dir, name = f.dir, e.Name
+		if name == f.fn.Name.Name {
+			return nil, fmt.Errorf("%s calls itself", name)
+		}
+	case *ast.SelectorExpr:
+		pkg, ok := e.X.(*ast.Ident)
+		if !ok || f.imports[pkg.Name] == "" {
+			return nil, fmt.Errorf("%s is not a kernel of an imported package", exprToString(e))
+		}
+		d, err := packageDir(f.dir, f.imports[pkg.Name])
+		if err != nil {
+			return nil, err
+		}
+		dir, qual, name = d, pkg.Name, e.Sel.Name
+	default:
+		return nil, fmt.Errorf("cannot fuse call of %s", exprToString(call.Fun))
+	}
+
+	st := &fuseStage{
+		name:        name,
+		subst:       make(map[string]ast.Expr),
+		sliceParams: make(map[string]bool),
+		free:        make(map[string]bool),
+	}
+	if qual != "" {
+		st.name = qual + "." + name
+	}
+
+	cfset := token.NewFileSet()
+	cfile, decl, err := findFuncDecl(cfset, dir, name)
+	if err != nil {
+		return nil, err
+	}
+	st.body = decl.Body
+	if err := checkStageDirectives(cfile, decl); err != nil {
+		return nil, fmt.Errorf("%s: %w", st.name, err)
+	}
+
+	results := 0
+	if decl.Type.Results != nil {
+		results = decl.Type.Results.NumFields()
+		for _, field := range decl.Type.Results.List {
+			if len(field.Names) > 0 {
+				return nil, fmt.Errorf("%s has named results", st.name)
+			}
+		}
+	}
+	switch {
+	case returns && results != 1:
+		return nil, fmt.Errorf("%s returns %d values; the composite returns its result", st.name, results)
+	case !returns && results != 0:
+		return nil, fmt.Errorf("%s returns a result; only the final stage may, in a return statement", st.name)
+	}
+
+	// Type parameters: explicit arguments, or the composite's own in order.
+	var typeParams []string
+	if decl.Type.TypeParams != nil {
+		for _, field := range decl.Type.TypeParams.List {
+			for _, n := range field.Names {
+				typeParams = append(typeParams, n.Name)
+			}
+		}
+	}
+	var ownTypeParams []string
+	if f.fn.Type.TypeParams != nil {
+		for _, field := range f.fn.Type.TypeParams.List {
+			for _, n := range field.Names {
+				ownTypeParams = append(ownTypeParams, n.Name)
+			}
+		}
+	}
+	switch {
+	case len(typeArgs) > 0:
+		if len(typeArgs) != len(typeParams) {
+			return nil, fmt.Errorf("%s takes %d type arguments, got %d", st.name, len(typeParams), len(typeArgs))
+		}
+		for i, tp := range typeParams {
+			st.subst[tp] = typeArgs[i]
+		}
+	case len(typeParams) == len(ownTypeParams):
+		for i, tp := range typeParams {
+			st.subst[tp] = ast.NewIdent(ownTypeParams[i])
+		}
+	default:
+		return nil, fmt.Errorf("cannot infer the type arguments of %s; instantiate it explicitly", st.name)
+	}
+
+	// Parameters become the call's arguments.
+	var params []*ast.Ident
+	var paramTypes []ast.Expr
+	for _, field := range decl.Type.Params.List {
+		if _, ok := field.Type.(*ast.Ellipsis); ok {
+			return nil, fmt.Errorf("%s is variadic", st.name)
+		}
+		if len(field.Names) == 0 {
+			params = append(params, nil)
+			paramTypes = append(paramTypes, field.Type)
+		}
+		for _, n := range field.Names {
+			params = append(params, n)
+			paramTypes = append(paramTypes, field.Type)
+		}
+	}
+	if len(call.Args) != len(params) {
+		return nil, fmt.Errorf("%s takes %d arguments, got %d", st.name, len(params), len(call.Args))
+	}
+	for i, p := range params {
+		if p == nil || p.Name == "_" {
+			continue
+		}
+		arg := call.Args[i]
+		if at, ok := paramTypes[i].(*ast.ArrayType); ok && at.Len == nil {
+			if _, ok := arg.(*ast.Ident); !ok {
+				return nil, fmt.Errorf("slice argument %s of %s must be a variable", exprToString(arg), st.name)
+			}
+			st.sliceParams[p.Name] = true
+		}
+		switch arg.(type) {
+		case *ast.Ident, *ast.BasicLit:
+			st.subst[p.Name] = arg
+		default:
+			st.temps = append(st.temps, fuseTemp{param: p.Name, typ: paramTypes[i], value: arg})
+		}
+	}
+	for _, t := range st.temps {
+		// Filled in with the temporary's name when names are assigned.
+		st.subst[t.param] = nil
+	}
+
+	if err := st.collectNames(); err != nil {
+		return nil, err
+	}
+	if err := f.resolveFree(st, cfile, dir, qual); err != nil {
+		return nil, err
+	}
+	if err := st.split(); err != nil {
+		return nil, fmt.Errorf("%s: %w", st.name, err)
+	}
+	if info := detectLoopWithUnroll(decl.Body, cfset, parseUnrollDirectives(cfile, cfset)); info != nil {
+		st.accumulators = info.Accumulators
+	}
+	return st, nil
+}
+
+// packageDir returns the directory of a package of the module containing dir.
+func packageDir(dir, importPath string) (string, error) {
+	root, module, err := FindModuleRoot(dir)
+	if err != nil {
+		return "", err
+	}
+	rel, ok := strings.CutPrefix(importPath, module)
+	if !ok || (rel != "" && !strings.HasPrefix(rel, "/")) {
+		return "", fmt.Errorf("%s is outside module %s", importPath, module)
+	}
+	return filepath.Join(root, filepath.FromSlash(strings.TrimPrefix(rel, "/"))), nil
+}
+
+// findFuncDecl parses the non-generated source file of dir that declares the
+// function name.
+func findFuncDecl(fset *token.FileSet, dir, name string) (*ast.File, *ast.FuncDecl, error) {
+	entries, err := os.ReadDir(dir)
+	if err != nil {
+		return nil, nil, err
+	}
+	for _, entry := range entries {
+		fname := entry.Name()
+		if entry.IsDir() || !strings.HasSuffix(fname, ".go") ||
+			strings.HasSuffix(fname, "_test.go") || strings.HasSuffix(fname, ".gen.go") {
+			continue
+		}
+		path := filepath.Join(dir, fname)
+		src, err := os.ReadFile(path)
+		if err != nil || !bytes.Contains(src, []byte("func "+name)) {
+			continue
+		}
+		file, err := parser.ParseFile(fset, path, src, parser.ParseComments|parser.SkipObjectResolution)
+		if err != nil {
+			return nil, nil, err
+		}
+		for _, decl := range file.Decls {
+			if fd, ok := decl.(*ast.FuncDecl); ok && fd.Recv == nil && fd.Name.Name == name && fd.Body != nil {
+				return file, fd, nil
+			}
+		}
+	}
+	return nil, nil, fmt.Errorf("function %s not found in %s", name, dir)
+}
+
+// checkStageDirectives rejects callees whose directives would be lost by
+// inlining.
+func checkStageDirectives(file *ast.File, decl *ast.FuncDecl) error {
+	if decl.Doc != nil {
+		for _, c := range decl.Doc.List {
+			if strings.TrimSpace(strings.TrimPrefix(c.Text, "//")) == "hwy:fuse" {
+				return fmt.Errorf("composites cannot be nested")
+			}
+		}
+	}
+	for _, cg := range file.Comments {
+		if cg.Pos() < decl.Body.Pos() || cg.End() > decl.Body.End() {
+			continue
+		}
+		for _, c := range cg.List {
+			text := strings.TrimSpace(strings.TrimPrefix(c.Text, "//"))
+			if !strings.HasPrefix(text, "hwy:") ||
+				strings.HasPrefix(text, "hwy:unroll ") || strings.HasPrefix(text, "hwy:accumulators ") {
+				continue
+			}
+			return fmt.Errorf("//%s in the body cannot be fused", text)
+		}
+	}
+	return nil
+}
+
+// collectNames records the names the stage body declares.
+func (st *fuseStage) collectNames() error {
+	seen := make(map[string]bool)
+	declare := func(id *ast.Ident) {
+		if id != nil && id.Name != "_" && !seen[id.Name] {
+			seen[id.Name] = true
+			st.locals = append(st.locals, id.Name)
+		}
+	}
+	var err error
+	ast.Inspect(st.body, func(n ast.Node) bool {
+		switch n := n.(type) {
+		case *ast.AssignStmt:
+			if n.Tok == token.DEFINE {
+				for _, lhs := range n.Lhs {
+					if id, ok := lhs.(*ast.Ident); ok {
+						declare(id)
+					}
+				}
+			}
+		case *ast.ValueSpec:
+			for _, id := range n.Names {
+				declare(id)
+			}
+		case *ast.TypeSpec:
+			declare(n.Name)
+		case *ast.RangeStmt:
+			if n.Tok == token.DEFINE {
+				for _, e := range []ast.Expr{n.Key, n.Value} {
+					if id, ok := e.(*ast.Ident); ok {
+						declare(id)
+					}
+				}
+			}
+		case *ast.FuncLit:
+			err = fmt.Errorf("%s contains a function literal", st.name)
+		case *ast.LabeledStmt:
+			err = fmt.Errorf("%s contains a labeled statement", st.name)
+		}
+		return err == nil
+	})
+	if err != nil {
+		return err
+	}
+	for _, l := range st.locals {
+		if _, ok := st.subst[l]; ok {
+			return fmt.Errorf("%s redeclares parameter %s", st.name, l)
+		}
+	}
+	return nil
+}
+
+// resolveFree classifies the names the stage uses without declaring them.
+// Package names the body uses are added to the composite's imports; names of
+// another package are qualified with the composite's import of it.
+func (f *fuser) resolveFree(st *fuseStage, file *ast.File, dir, qual string) error {
+	fileImports := make(map[string]string)
+	for _, imp := range file.Imports {
+		path := strings.Trim(imp.Path.Value, `"`)
+		name := filepath.Base(path)
+		if imp.Name != nil {
+			name = imp.Name.Name
+		}
+		fileImports[name] = path
+	}
+	local := make(map[string]bool, len(st.locals))
+	for _, l := range st.locals {
+		local[l] = true
+	}
+
+	var pkgNames map[string]bool
+	var err error
+	forEachIdent(st.body, func(id *ast.Ident, isSelectorX bool) {
+		name := id.Name
+		if err != nil || name == "_" || local[name] {
+			return
+		}
+		if _, ok := st.subst[name]; ok {
+			return
+		}
+		if path, ok := fileImports[name]; ok && isSelectorX {
+			if have, ok := f.imports[name]; ok && have != path {
+				err = fmt.Errorf("%s uses %s for %q, but the composite's file imports %q as %s", st.name, name, path, have, name)
+				return
+			}
+			f.imports[name] = path
+			st.free[name] = true
+			return
+		}
+		if types.Universe.Lookup(name) != nil {
+			st.free[name] = true
+			return
+		}
+		if qual == "" {
+			st.free[name] = true
+			return
+		}
+		if pkgNames == nil {
+			pkgNames = packageLevelNames(dir)
+		}
+		switch {
+		case !pkgNames[name]:
+			err = fmt.Errorf("%s uses undefined %s", st.name, name)
+		case !ast.IsExported(name):
+			err = fmt.Errorf("%s uses %s, which is not exported by %s", st.name, name, qual)
+		default:
+			st.subst[name] = &ast.SelectorExpr{X: ast.NewIdent(qual), Sel: ast.NewIdent(name)}
+			st.free[qual] = true
+		}
+	})
+	return err
+}
+
+// packageLevelNames returns the top-level names declared by the package in
+// dir.
+func packageLevelNames(dir string) map[string]bool {
+	names := make(map[string]bool)
+	entries, err := os.ReadDir(dir)
+	if err != nil {
+		return names
+	}
+	fset := token.NewFileSet()
+	for _, entry := range entries {
+		if entry.IsDir() || !strings.HasSuffix(entry.Name(), ".go") || strings.HasSuffix(entry.Name(), "_test.go") {
+			continue
+		}
+		file, err := parser.ParseFile(fset, filepath.Join(dir, entry.Name()), nil, parser.SkipObjectResolution)
+		if err != nil {
+			continue
+		}
+		for _, decl := range file.Decls {
+			switch d := decl.(type) {
+			case *ast.FuncDecl:
+				if d.Recv == nil {
+					names[d.Name.Name] = true
+				}
+			case *ast.GenDecl:
+				for _, spec := range d.Specs {
+					switch s := spec.(type) {
+					case *ast.ValueSpec:
+						for _, n := range s.Names {
+							names[n.Name] = true
+						}
+					case *ast.TypeSpec:
+						names[s.Name.Name] = true
+					}
+				}
+			}
+		}
+	}
+	return names
+}
+
+// forEachIdent calls fn for every identifier of node that names a variable,
+// constant, type, function or package, i.e. all but selected field and
+// method names.
+func forEachIdent(node ast.Node, fn func(id *ast.Ident, isSelectorX bool)) {
+	ast.Inspect(node, func(n ast.Node) bool {
+		switch n := n.(type) {
+		case *ast.SelectorExpr:
+			if id, ok := n.X.(*ast.Ident); ok {
+				fn(id, true)
+			} else {
+				forEachIdent(n.X, fn)
+			}
+			return false
+		case *ast.Ident:
+			fn(n, false)
+		}
+		return true
+	})
+}
+
+// split divides the stage body into guards, prologue, SIMD loop, post-loop
+// statements, tail loop and return.
+func (st *fuseStage) split() error {
+	list := st.body.List
+	k := 0
+	for ; k < len(list); k++ {
+		s := list[k]
+		if _, ok := s.(*ast.ForStmt); ok {
+			break
+		}
+		if g, ok := s.(*ast.IfStmt); ok && isReturnGuard(g) {
+			if !isEmptyCheck(g.Cond) {
+				return fmt.Errorf("returns early on %s; only empty-input checks can be fused", exprToString(g.Cond))
+			}
+			st.guards = append(st.guards, g)
+			continue
+		}
+		if hasLoopOrReturn(s) {
+			return fmt.Errorf("has a loop or return before its SIMD loop")
+		}
+		if st.readsSlice(s) {
+			if len(st.guards) > 0 {
+				return fmt.Errorf("reads a slice before its SIMD loop, which it cannot do once its empty-input check is fused away")
+			}
+			st.setupReads = true
+		}
+		st.prologue = append(st.prologue, s)
+	}
+	if k == len(list) {
+		return fmt.Errorf("has no SIMD loop")
+	}
+
+	st.loop = list[k].(*ast.ForStmt)
+	iter, stride, ok := simdLoopShape(st.loop)
+	if !ok {
+		return fmt.Errorf("SIMD loop must have the form \"for i = 0; i+lanes <= n; i += lanes\"")
+	}
+	st.iter = iter
+	if id, ok := stride.(*ast.Ident); ok && slices.Contains(st.locals, id.Name) {
+		st.stride = id.Name
+	}
+	if err := checkElementwise(st.loop.Body, iter); err != nil {
+		return err
+	}
+	st.prologue = slices.DeleteFunc(st.prologue, func(s ast.Stmt) bool { return declaresZero(s, iter) })
+
+	for k++; k < len(list); k++ {
+		switch s := list[k].(type) {
+		case *ast.ForStmt:
+			if st.tail != nil {
+				return fmt.Errorf("has more than one loop after its SIMD loop")
+			}
+			if !tailLoopShape(s, iter) {
+				return fmt.Errorf("tail loop must have the form \"for ; %s < n; %s++\" or \"for j := %s; j < n; j++\"", iter, iter, iter)
+			}
+			st.tail = s
+		case *ast.ReturnStmt:
+			if k != len(list)-1 {
+				return fmt.Errorf("returns before its end")
+			}
+			st.ret = s
+		default:
+			if st.tail != nil {
+				return fmt.Errorf("has statements after its tail loop")
+			}
+			if hasLoopOrReturn(s) {
+				return fmt.Errorf("has a loop or return after its SIMD loop")
+			}
+			if usesName(s, iter) {
+				return fmt.Errorf("uses %s after its SIMD loop", iter)
+			}
+			st.postReads = st.postReads || st.readsSlice(s)
+			st.post = append(st.post, s)
+		}
+	}
+	return nil
+}
+
+// isReturnGuard reports whether s is "if cond { return ... }".
+func isReturnGuard(s *ast.IfStmt) bool {
+	if s.Init != nil || s.Else != nil || len(s.Body.List) != 1 {
+		return false
+	}
+	_, ok := s.Body.List[0].(*ast.ReturnStmt)
+	return ok
+}
+
+// isEmptyCheck reports whether cond only tests lengths against zero, e.g.
+// "len(a) == 0 || n == 0".
+func isEmptyCheck(cond ast.Expr) bool {
+	switch e := cond.(type) {
+	case *ast.ParenExpr:
+		return isEmptyCheck(e.X)
+	case *ast.BinaryExpr:
+		switch e.Op {
+		case token.LOR:
+			return isEmptyCheck(e.X) && isEmptyCheck(e.Y)
+		case token.EQL, token.LEQ:
+			lit, ok := e.Y.(*ast.BasicLit)
+			if !ok || lit.Value != "0" {
+				return false
+			}
+			switch x := e.X.(type) {
+			case *ast.Ident:
+				return true
+			case *ast.CallExpr:
+				fun, ok := x.Fun.(*ast.Ident)
+				return ok && fun.Name == "len"
+			}
+		}
+	}
+	return false
+}
+
+// readsSlice reports whether s uses a slice parameter of the stage other
+// than to take its length.
+func (st *fuseStage) readsSlice(s ast.Stmt) bool {
+	found := false
+	ast.Inspect(s, func(n ast.Node) bool {
+		switch n := n.(type) {
+		case *ast.CallExpr:
+			if fun, ok := n.Fun.(*ast.Ident); ok && (fun.Name == "len" || fun.Name == "cap") {
+				return false
+			}
+		case *ast.Ident:
+			found = found || st.sliceParams[n.Name]
+		}
+		return !found
+	})
+	return found
+}
+
+// pureArg reports whether evaluating e reads no memory: it uses only
+// variables, literals, operators, len, cap, min, max and conversions.
+func (f *fuser) pureArg(e ast.Expr) bool {
+	typeParams := make(map[string]bool)
+	if f.fn.Type.TypeParams != nil {
+		for _, field := range f.fn.Type.TypeParams.List {
+			for _, n := range field.Names {
+				typeParams[n.Name] = true
+			}
+		}
+	}
+	pure := true
+	ast.Inspect(e, func(n ast.Node) bool {
+		switch n := n.(type) {
+		case *ast.IndexExpr, *ast.IndexListExpr, *ast.SliceExpr, *ast.StarExpr, *ast.FuncLit:
+			pure = false
+		case *ast.CallExpr:
+			fun, ok := n.Fun.(*ast.Ident)
+			if !ok {
+				pure = false
+				break
+			}
+			_, isType := types.Universe.Lookup(fun.Name).(*types.TypeName)
+			switch {
+			case isType, typeParams[fun.Name]:
+			case fun.Name == "len", fun.Name == "cap", fun.Name == "min", fun.Name == "max":
+			default:
+				pure = false
+			}
+		}
+		return pure
+	})
+	return pure
+}
+
+// hasLoopOrReturn reports whether s contains a loop or a return.
+func hasLoopOrReturn(s ast.Stmt) bool {
+	found := false
+	ast.Inspect(s, func(n ast.Node) bool {
+		switch n.(type) {
+		case *ast.ForStmt, *ast.RangeStmt, *ast.ReturnStmt:
+			found = true
+		}
+		return !found
+	})
+	return found
+}
+
+// usesName reports whether node refers to name.
+func usesName(node ast.Node, name string) bool {
+	found := false
+	forEachIdent(node, func(id *ast.Ident, _ bool) {
+		if id.Name == name {
+			found = true
+		}
+	})
+	return found
+}
+
+// simdLoopShape matches "for [i = 0]; i+stride <= n; i += stride".
+func simdLoopShape(loop *ast.ForStmt) (iter string, stride ast.Expr, ok bool) {
+	post, ok := loop.Post.(*ast.AssignStmt)
+	if !ok || post.Tok != token.ADD_ASSIGN || len(post.Lhs) != 1 || len(post.Rhs) != 1 {
+		return "", nil, false
+	}
+	it, ok := post.Lhs[0].(*ast.Ident)
+	if !ok {
+		return "", nil, false
+	}
+	stride = post.Rhs[0]
+	cond, ok := loop.Cond.(*ast.BinaryExpr)
+	if !ok || cond.Op != token.LEQ {
+		return "", nil, false
+	}
+	sum, ok := cond.X.(*ast.BinaryExpr)
+	if !ok || sum.Op != token.ADD || exprToString(sum.X) != it.Name || exprToString(sum.Y) != exprToString(stride) {
+		return "", nil, false
+	}
+	if loop.Init != nil {
+		init, ok := loop.Init.(*ast.AssignStmt)
+		if !ok || len(init.Lhs) != 1 || len(init.Rhs) != 1 ||
+			exprToString(init.Lhs[0]) != it.Name || exprToString(init.Rhs[0]) != "0" {
+			return "", nil, false
+		}
+	}
+	return it.Name, stride, true
+}
+
+// tailLoopShape matches "for ; i < n; i++" and "for j := i; j < n; j++".
+func tailLoopShape(loop *ast.ForStmt, iter string) bool {
+	cond, ok := loop.Cond.(*ast.BinaryExpr)
+	if !ok || cond.Op != token.LSS {
+		return false
+	}
+	v, ok := cond.X.(*ast.Ident)
+	if !ok {
+		return false
+	}
+	post, ok := loop.Post.(*ast.IncDecStmt)
+	if !ok || post.Tok != token.INC || exprToString(post.X) != v.Name {
+		return false
+	}
+	if loop.Init == nil {
+		return v.Name == iter
+	}
+	init, ok := loop.Init.(*ast.AssignStmt)
+	return ok && init.Tok == token.DEFINE && len(init.Lhs) == 1 && len(init.Rhs) == 1 &&
+		exprToString(init.Lhs[0]) == v.Name && exprToString(init.Rhs[0]) == iter
+}
+
+// checkElementwise requires the SIMD loop body to use the iterator only as
+// the start of a slice window, x[i:], and not to leave the loop early.
+func checkElementwise(body *ast.BlockStmt, iter string) error {
+	window := make(map[*ast.Ident]bool)
+	var err error
+	ast.Inspect(body, func(n ast.Node) bool {
+		switch n := n.(type) {
+		case *ast.SliceExpr:
+			if id, ok := n.Low.(*ast.Ident); ok && id.Name == iter {
+				window[id] = true
+			}
+		case *ast.BranchStmt, *ast.ReturnStmt, *ast.GoStmt, *ast.DeferStmt:
+			err = fmt.Errorf("SIMD loop must not contain %T", n)
+		}
+		return err == nil
+	})
+	if err != nil {
+		return err
+	}
+	forEachIdent(body, func(id *ast.Ident, _ bool) {
+		if id.Name == iter && !window[id] && err == nil {
+			err = fmt.Errorf("SIMD loop uses %s other than as x[%s:], so it is not elementwise", iter, iter)
+		}
+	})
+	return err
+}
+
+// declaresZero reports whether s is "var name int", "var name = 0" or
+// "name := 0".
+func declaresZero(s ast.Stmt, name string) bool {
+	switch s := s.(type) {
+	case *ast.AssignStmt:
+		return s.Tok == token.DEFINE && len(s.Lhs) == 1 && len(s.Rhs) == 1 &&
+			exprToString(s.Lhs[0]) == name && exprToString(s.Rhs[0]) == "0"
+	case *ast.DeclStmt:
+		gd, ok := s.Decl.(*ast.GenDecl)
+		if !ok || gd.Tok != token.VAR || len(gd.Specs) != 1 {
+			return false
+		}
+		vs := gd.Specs[0].(*ast.ValueSpec)
+		if len(vs.Names) != 1 || vs.Names[0].Name != name {
+			return false
+		}
+		return len(vs.Values) == 0 || (len(vs.Values) == 1 && exprToString(vs.Values[0]) == "0")
+	}
+	return false
+}
+
+// reserveNames marks the names that stage locals must not take: the
+// composite's parameters and imports and every name a stage uses without
+// declaring it.
+func (f *fuser) reserveNames() {
+	f.taken = make(map[string]bool)
+	for _, fl := range []*ast.FieldList{f.fn.Type.TypeParams, f.fn.Type.Params, f.fn.Type.Results} {
+		if fl == nil {
+			continue
+		}
+		for _, field := range fl.List {
+			for _, n := range field.Names {
+				f.taken[n.Name] = true
+			}
+		}
+	}
+	for name := range f.imports {
+		f.taken[name] = true
+	}
+	for _, st := range f.stages {
+		for name := range st.free {
+			f.taken[name] = true
+		}
+	}
+}
+
+// uniq returns name, or name with the smallest "_k" suffix that is free,
+// and reserves it. Digit suffixes are left to loop unrolling, which renames
+// the copies of x to x1, x2, ...
+func (f *fuser) uniq(name string) string {
+	cand := name
+	for k := 2; f.taken[cand]; k++ {
+		cand = name + "_" + strconv.Itoa(k)
+	}
+	f.taken[cand] = true
+	return cand
+}
+
+// rewriteStage gives the locals of stage k unique names, substitutes the
+// call's arguments for the parameters and, after the first stage, makes the
+// iterator and lane count those of the merged loop.
+func (f *fuser) rewriteStage(k int, st *fuseStage) error {
+	rename := make(map[string]string, len(st.locals))
+	for _, l := range st.locals {
+		switch {
+		case k > 0 && l == st.iter:
+			rename[l] = f.iter
+		case k > 0 && l == st.stride:
+			// Replaced by the merged loop's step below.
+		default:
+			rename[l] = f.uniq(l)
+		}
+	}
+	for i, t := range st.temps {
+		name := f.uniq(t.param)
+		typ := &ast.ParenExpr{X: cloneExpr(t.typ)}
+		substIdents(typ, nil, st.subst)
+		st.bindings = append(st.bindings, &ast.DeclStmt{Decl: &ast.GenDecl{
+			Tok:   token.VAR,
+			Specs: []ast.Spec{&ast.ValueSpec{Names: []*ast.Ident{ast.NewIdent(name)}, Type: typ.X, Values: []ast.Expr{t.value}}},
+		}})
+		st.subst[st.temps[i].param] = ast.NewIdent(name)
+	}
+	if k > 0 && st.stride != "" {
+		before := len(st.prologue)
+		st.prologue = slices.DeleteFunc(st.prologue, func(s ast.Stmt) bool { return definesName(s, st.stride) })
+		if len(st.prologue) != before-1 {
+			return fmt.Errorf("%s: cannot merge lane count %s with the first stage's", st.name, st.stride)
+		}
+		st.subst[st.stride] = f.strideExpr
+	}
+
+	substIdents(st.body, rename, st.subst)
+
+	if k == 0 {
+		f.iter = rename[st.iter]
+		_, stride, _ := simdLoopShape(st.loop)
+		f.strideExpr = stride
+	}
+	return nil
+}
+
+// definesName reports whether s is "name := ..." or "var name ...".
+func definesName(s ast.Stmt, name string) bool {
+	switch s := s.(type) {
+	case *ast.AssignStmt:
+		return s.Tok == token.DEFINE && len(s.Lhs) == 1 && exprToString(s.Lhs[0]) == name
+	case *ast.DeclStmt:
+		gd, ok := s.Decl.(*ast.GenDecl)
+		if !ok || len(gd.Specs) != 1 {
+			return false
+		}
+		vs, ok := gd.Specs[0].(*ast.ValueSpec)
+		return ok && len(vs.Names) == 1 && vs.Names[0].Name == name
+	}
+	return false
+}
+
+// substIdents renames identifiers in place and replaces others with copies
+// of expressions. Selected field and method names are left alone.
+func substIdents(node ast.Node, rename map[string]string, subst map[string]ast.Expr) {
+	replaceExprs(node, func(e ast.Expr) ast.Expr {
+		id, ok := e.(*ast.Ident)
+		if !ok {
+			return nil
+		}
+		if name, ok := rename[id.Name]; ok {
+			id.Name = name
+		} else if r, ok := subst[id.Name]; ok && r != nil {
+			if rid, ok := r.(*ast.Ident); ok {
+				id.Name = rid.Name
+			} else {
+				return cloneExpr(r)
+			}
+		}
+		return nil
+	})
+	// Names declared by var, const and type are not expressions.
+	ast.Inspect(node, func(n ast.Node) bool {
+		var ids []*ast.Ident
+		switch n := n.(type) {
+		case *ast.ValueSpec:
+			ids = n.Names
+		case *ast.TypeSpec:
+			ids = []*ast.Ident{n.Name}
+		}
+		for _, id := range ids {
+			if name, ok := rename[id.Name]; ok {
+				id.Name = name
+			}
+		}
+		return true
+	})
+}
+
+var (
+	exprType   = reflect.TypeOf((*ast.Expr)(nil)).Elem()
+	objectType = reflect.TypeOf((*ast.Object)(nil))
+	scopeType  = reflect.TypeOf((*ast.Scope)(nil))
+)
+
+// replaceExprs calls fn for every expression of node, outermost first, and
+// stores the expression fn returns in its place. A replaced expression is not
+// walked further. Selected names, x.Sel, are not expressions of their own.
+func replaceExprs(node ast.Node, fn func(ast.Expr) ast.Expr) {
+	var walk func(v reflect.Value)
+	walk = func(v reflect.Value) {
+		switch v.Kind() {
+		case reflect.Pointer:
+			if v.IsNil() || v.Type() == objectType || v.Type() == scopeType {
+				return
+			}
+			if sel, ok := v.Interface().(*ast.SelectorExpr); ok {
+				walk(reflect.ValueOf(&sel.X).Elem())
+				return
+			}
+			walk(v.Elem())
+		case reflect.Interface:
+			if v.IsNil() {
+				return
+			}
+			if v.Type() == exprType && v.CanSet() {
+				if e := fn(v.Interface().(ast.Expr)); e != nil {
+					v.Set(reflect.ValueOf(e))
+					return
+				}
+			}
+			walk(v.Elem())
+		case reflect.Slice:
+			for i := range v.Len() {
+				walk(v.Index(i))
+			}
+		case reflect.Struct:
+			for i := range v.NumField() {
+				walk(v.Field(i))
+			}
+		}
+	}
+	walk(reflect.ValueOf(node))
+}
+
+// assemble builds the fused body: every stage's setup, one merged SIMD loop,
+// then every stage's post-loop statements and tail loop in order.
+func (f *fuser) assemble(info *FusionInfo) *ast.BlockStmt {
+	var out []ast.Stmt
+	for _, st := range f.stages {
+		info.Stages = append(info.Stages, st.name)
+		out = append(out, st.bindings...)
+		out = append(out, st.prologue...)
+	}
+	out, defs := f.mergeSetup(out)
+
+	// The merged loop runs while every stage's loop would; each stage's
+	// tail finishes its own range.
+	var ends []ast.Expr
+	seen := make(map[string]bool)
+	for _, st := range f.stages {
+		end := st.loop.Cond.(*ast.BinaryExpr).Y
+		if name, ok := defs[exprToString(end)]; ok {
+			end = ast.NewIdent(name)
+		}
+		if !seen[exprToString(end)] {
+			seen[exprToString(end)] = true
+			ends = append(ends, end)
+		}
+	}
+	end := ends[0]
+	if len(ends) > 1 {
+		n := f.uniq("n")
+		out = append(out, &ast.AssignStmt{
+			Lhs: []ast.Expr{ast.NewIdent(n)},
+			Tok: token.DEFINE,
+			Rhs: []ast.Expr{&ast.CallExpr{Fun: ast.NewIdent("min"), Args: ends}},
+		})
+		end = ast.NewIdent(n)
+	}
+	out = append(out, &ast.DeclStmt{Decl: &ast.GenDecl{
+		Tok:   token.VAR,
+		Specs: []ast.Spec{&ast.ValueSpec{Names: []*ast.Ident{ast.NewIdent(f.iter)}, Type: ast.NewIdent("int")}},
+	}})
+	out = append(out, &ast.ForStmt{
+		Init: &ast.AssignStmt{
+			Lhs: []ast.Expr{ast.NewIdent(f.iter)},
+			Tok: token.ASSIGN,
+			Rhs: []ast.Expr{&ast.BasicLit{Kind: token.INT, Value: "0"}},
+		},
+		Cond: &ast.BinaryExpr{
+			X:  &ast.BinaryExpr{X: ast.NewIdent(f.iter), Op: token.ADD, Y: cloneExpr(f.strideExpr)},
+			Op: token.LEQ,
+			Y:  end,
+		},
+		Post: &ast.AssignStmt{
+			Lhs: []ast.Expr{ast.NewIdent(f.iter)},
+			Tok: token.ADD_ASSIGN,
+			Rhs: []ast.Expr{cloneExpr(f.strideExpr)},
+		},
+		Body: &ast.BlockStmt{List: f.mergeLoopBodies(info)},
+	})
+
+	lastTail := -1
+	for k, st := range f.stages {
+		if st.tail != nil {
+			lastTail = k
+		}
+	}
+	for k, st := range f.stages {
+		if f.returns && k == len(f.stages)-1 {
+			// The returning stage's empty-input checks run once the
+			// earlier stages are done.
+			out = append(out, st.guards...)
+		}
+		out = append(out, st.post...)
+		if st.tail == nil {
+			continue
+		}
+		if st.tail.Init == nil && k != lastTail {
+			// Later tails start from the same index.
+			j := f.uniq(f.iter)
+			substIdents(st.tail, map[string]string{f.iter: j}, nil)
+			st.tail.Init = &ast.AssignStmt{
+				Lhs: []ast.Expr{ast.NewIdent(j)},
+				Tok: token.DEFINE,
+				Rhs: []ast.Expr{ast.NewIdent(f.iter)},
+			}
+		}
+		out = append(out, st.tail)
+	}
+	if f.returns {
+		out = append(out, &ast.ReturnStmt{Results: f.stages[len(f.stages)-1].ret.Results})
+	}
+	return &ast.BlockStmt{List: dropUnusedDefs(out)}
+}
+
+// mergeSetup drops setup definitions that repeat an earlier one, such as the
+// n := len(x) of every stage over x, and renames their uses in all stages.
+// It returns the kept statements and the variable defined by each merged
+// expression. Only pure definitions of variables assigned nowhere else merge.
+func (f *fuser) mergeSetup(stmts []ast.Stmt) ([]ast.Stmt, map[string]string) {
+	assigned := make(map[string]int)
+	countAssigned := func(n ast.Node) bool {
+		if as, ok := n.(*ast.AssignStmt); ok {
+			for _, lhs := range as.Lhs {
+				assigned[exprToString(lhs)]++
+			}
+		}
+		return true
+	}
+	for _, st := range f.stages {
+		ast.Inspect(st.body, countAssigned)
+	}
+	for _, s := range stmts {
+		if _, ok := s.(*ast.DeclStmt); ok {
+			ast.Inspect(s, countAssigned)
+		}
+	}
+
+	defs := make(map[string]string)
+	rename := make(map[string]string)
+	var kept []ast.Stmt
+	for _, s := range stmts {
+		if len(rename) > 0 {
+			substIdents(s, rename, nil)
+		}
+		if as, ok := s.(*ast.AssignStmt); ok && as.Tok == token.DEFINE && len(as.Lhs) == 1 && len(as.Rhs) == 1 {
+			name := exprToString(as.Lhs[0])
+			as.Rhs[0] = simplifyMinMax(as.Rhs[0])
+			stable := assigned[name] == 1 && isPureSetup(as.Rhs[0])
+			forEachIdent(as.Rhs[0], func(id *ast.Ident, _ bool) {
+				stable = stable && assigned[id.Name] <= 1
+			})
+			if stable {
+				key := exprToString(as.Rhs[0])
+				if prev, ok := defs[key]; ok {
+					rename[name] = prev
+					continue
+				}
+				defs[key] = name
+			}
+		}
+		kept = append(kept, s)
+	}
+	if len(rename) > 0 {
+		for _, st := range f.stages {
+			substIdents(st.body, rename, nil)
+		}
+	}
+	return kept, defs
+}
+
+// isPureSetup reports whether e computes a value from its operands alone:
+// lengths, lane counts, broadcasts and arithmetic on them.
+func isPureSetup(e ast.Expr) bool {
+	pure := true
+	ast.Inspect(e, func(n ast.Node) bool {
+		switch n := n.(type) {
+		case *ast.SliceExpr, *ast.StarExpr, *ast.FuncLit, *ast.CompositeLit:
+			pure = false
+		case *ast.IndexExpr:
+			// Only type arguments, as in hwy.MaxLanes[T]().
+			if _, ok := n.X.(*ast.SelectorExpr); !ok {
+				pure = false
+			}
+		case *ast.CallExpr:
+			fun := n.Fun
+			if idx, ok := fun.(*ast.IndexExpr); ok {
+				fun = idx.X
+			}
+			switch fn := fun.(type) {
+			case *ast.Ident:
+				pure = fn.Name == "len" || fn.Name == "cap" || fn.Name == "min" || fn.Name == "max"
+			case *ast.SelectorExpr:
+				switch fn.Sel.Name {
+				case "Set", "Zero", "Const", "MaxLanes", "Lanes", "NumLanes", "NumElements":
+					_, isHwy := hwyCallNamed(&ast.CallExpr{Fun: fun}, fn.Sel.Name)
+					pure = isHwy || fn.Sel.Name == "NumLanes" || fn.Sel.Name == "NumElements"
+				default:
+					pure = false
+				}
+			default:
+				pure = false
+			}
+		}
+		return pure
+	})
+	return pure
+}
+
+// simplifyMinMax rewrites min(a, a) and max(a, a) to a.
+func simplifyMinMax(e ast.Expr) ast.Expr {
+	call, ok := e.(*ast.CallExpr)
+	if !ok || len(call.Args) < 2 {
+		return e
+	}
+	if fun, ok := call.Fun.(*ast.Ident); !ok || (fun.Name != "min" && fun.Name != "max") {
+		return e
+	}
+	for i := range call.Args {
+		call.Args[i] = simplifyMinMax(call.Args[i])
+		if exprToString(call.Args[i]) != exprToString(call.Args[0]) {
+			return e
+		}
+	}
+	return call.Args[0]
+}
+
+// mergeLoopBodies concatenates the stages' SIMD loop bodies, forwarding
+// stored vectors to later loads of the same window and dropping stores that
+// a later store to the same window makes dead.
+func (f *fuser) mergeLoopBodies(info *FusionInfo) []ast.Stmt {
+	var stmts []ast.Stmt
+	for _, st := range f.stages {
+		stmts = append(stmts, st.loop.Body.List...)
+	}
+	assigned := make(map[string]int)
+	topLevel := make(map[string]bool)
+	for _, s := range stmts {
+		if as, ok := s.(*ast.AssignStmt); ok && as.Tok == token.DEFINE {
+			for _, lhs := range as.Lhs {
+				topLevel[exprToString(lhs)] = true
+			}
+		}
+		ast.Inspect(s, func(n ast.Node) bool {
+			if as, ok := n.(*ast.AssignStmt); ok {
+				for _, lhs := range as.Lhs {
+					assigned[exprToString(lhs)]++
+				}
+			}
+			return true
+		})
+	}
+
+	var out []ast.Stmt
+	fwd := make(map[string]string)   // slice -> vector holding its current window
+	pending := make(map[string]int)  // slice -> index in out of its last unread store
+	alias := make(map[string]string) // forwarded load result -> vector
+	var dead []int
+	for _, s := range stmts {
+		if len(alias) > 0 {
+			substIdents(s, alias, nil)
+		}
+		if !isSimpleStmt(s) {
+			reads, other := windowAccesses(s, f.iter, nil)
+			forgetWindows(fwd, pending, reads, other)
+			out = append(out, s)
+			continue
+		}
+
+		// x := hwy.Load(s[i:]) of a forwarded window disappears.
+		if as, ok := s.(*ast.AssignStmt); ok && as.Tok == token.DEFINE && len(as.Lhs) == 1 && len(as.Rhs) == 1 {
+			if slice := loadedWindow(as.Rhs[0], f.iter); slice != "" && fwd[slice] != "" {
+				alias[exprToString(as.Lhs[0])] = fwd[slice]
+				info.LoadsForwarded++
+				continue
+			}
+		}
+		replaceExprs(s, func(e ast.Expr) ast.Expr {
+			if slice := loadedWindow(e, f.iter); slice != "" && fwd[slice] != "" {
+				info.LoadsForwarded++
+				return ast.NewIdent(fwd[slice])
+			}
+			return nil
+		})
+
+		storeSlice, storeVal, store := storedWindow(s, f.iter)
+		reads, other := windowAccesses(s, f.iter, store)
+		forgetWindows(fwd, pending, reads, other)
+		if store != nil {
+			if p, ok := pending[storeSlice]; ok && storeSlice != "" {
+				dead = append(dead, p)
+			}
+			delete(fwd, storeSlice)
+			if storeSlice == "" {
+				// A store through an unnamed slice may write any window.
+				clear(fwd)
+				clear(pending)
+			} else {
+				if storeVal != "" && assigned[storeVal] == 1 && topLevel[storeVal] {
+					fwd[storeSlice] = storeVal
+				}
+				pending[storeSlice] = len(out)
+			}
+		}
+		out = append(out, s)
+	}
+
+	// Drop dead stores whose value is still used, so no variable is left
+	// unused.
+	drop := make(map[int]bool)
+	for _, p := range dead {
+		_, val, _ := storedWindow(out[p], f.iter)
+		if val == "" {
+			continue
+		}
+		uses := 0
+		for i, s := range out {
+			if i != p && !drop[i] {
+				uses += countName(s, val)
+			}
+		}
+		if uses >= 2 {
+			drop[p] = true
+			info.StoresEliminated++
+		}
+	}
+	var kept []ast.Stmt
+	for i, s := range out {
+		if !drop[i] {
+			kept = append(kept, s)
+		}
+	}
+	return kept
+}
+
+// isSimpleStmt reports whether s executes unconditionally and once.
+func isSimpleStmt(s ast.Stmt) bool {
+	switch s.(type) {
+	case *ast.ExprStmt, *ast.AssignStmt, *ast.DeclStmt, *ast.IncDecStmt:
+		return true
+	}
+	return false
+}
+
+// isWindow reports whether e is x[iter:] and returns x when it is a plain
+// identifier.
+func isWindow(e ast.Expr, iter string) (string, bool) {
+	se, ok := e.(*ast.SliceExpr)
+	if !ok {
+		return "", false
+	}
+	if id, ok := se.Low.(*ast.Ident); !ok || id.Name != iter {
+		return "", false
+	}
+	if id, ok := se.X.(*ast.Ident); ok && se.High == nil {
+		return id.Name, true
+	}
+	return "", true
+}
+
+// hwyCallNamed reports whether e calls hwy.<name>, with or without type
+// arguments.
+func hwyCallNamed(e ast.Expr, name string) (*ast.CallExpr, bool) {
+	call, ok := e.(*ast.CallExpr)
+	if !ok {
+		return nil, false
+	}
+	fun := call.Fun
+	switch f := fun.(type) {
+	case *ast.IndexExpr:
+		fun = f.X
+	case *ast.IndexListExpr:
+		fun = f.X
+	}
+	sel, ok := fun.(*ast.SelectorExpr)
+	if !ok || sel.Sel.Name != name {
+		return nil, false
+	}
+	pkg, ok := sel.X.(*ast.Ident)
+	return call, ok && pkg.Name == "hwy"
+}
+
+// loadedWindow returns x when e is hwy.Load(x[iter:]).
+func loadedWindow(e ast.Expr, iter string) string {
+	call, ok := hwyCallNamed(e, "Load")
+	if !ok || len(call.Args) != 1 {
+		return ""
+	}
+	slice, _ := isWindow(call.Args[0], iter)
+	return slice
+}
+
+// storedWindow matches the statement hwy.Store(v, x[iter:]) and returns x
+// and v when they are plain identifiers, and the window expression.
+func storedWindow(s ast.Stmt, iter string) (slice, val string, window ast.Expr) {
+	es, ok := s.(*ast.ExprStmt)
+	if !ok {
+		return "", "", nil
+	}
+	call, ok := hwyCallNamed(es.X, "Store")
+	if !ok || len(call.Args) != 2 {
+		return "", "", nil
+	}
+	slice, ok = isWindow(call.Args[1], iter)
+	if !ok {
+		return "", "", nil
+	}
+	if id, ok := call.Args[0].(*ast.Ident); ok {
+		val = id.Name
+	}
+	return slice, val, call.Args[1]
+}
+
+// windowAccesses returns the slices whose windows s reads with hwy.Load and
+// those whose windows it touches in any other way, apart from the store
+// window. A window of an expression other than a plain slice is recorded
+// under "".
+func windowAccesses(s ast.Stmt, iter string, store ast.Expr) (reads, other map[string]bool) {
+	reads, other = make(map[string]bool), make(map[string]bool)
+	loads := make(map[ast.Expr]bool)
+	ast.Inspect(s, func(n ast.Node) bool {
+		if e, ok := n.(ast.Expr); ok {
+			if call, ok := hwyCallNamed(e, "Load"); ok && len(call.Args) == 1 {
+				if slice, ok := isWindow(call.Args[0], iter); ok {
+					loads[call.Args[0]] = true
+					reads[slice] = true
+				}
+			}
+			if slice, ok := isWindow(e, iter); ok && e != store && !loads[e] {
+				other[slice] = true
+			}
+		}
+		return true
+	})
+	return reads, other
+}
+
+// forgetWindows updates the forwarded and pending stores of mergeLoopBodies
+// for the windows a statement reads or otherwise touches.
+func forgetWindows(fwd map[string]string, pending map[string]int, reads, other map[string]bool) {
+	if reads[""] || other[""] {
+		clear(pending)
+	}
+	if other[""] {
+		clear(fwd)
+	}
+	for slice := range reads {
+		delete(pending, slice)
+	}
+	for slice := range other {
+		delete(pending, slice)
+		delete(fwd, slice)
+	}
+}
+
+// countName counts the identifiers of node named name.
+func countName(node ast.Node, name string) int {
+	n := 0
+	forEachIdent(node, func(id *ast.Ident, _ bool) {
+		if id.Name == name {
+			n++
+		}
+	})
+	return n
+}
+
+// dropUnusedDefs removes top-level "x := <hwy call or method call>"
+// definitions that merging left unused, such as the vector a later stage
+// only needed for its lane count.
+func dropUnusedDefs(stmts []ast.Stmt) []ast.Stmt {
+	for {
+		removed := false
+		for i, s := range stmts {
+			as, ok := s.(*ast.AssignStmt)
+			if !ok || as.Tok != token.DEFINE || len(as.Lhs) != 1 || len(as.Rhs) != 1 {
+				continue
+			}
+			name := exprToString(as.Lhs[0])
+			if _, ok := as.Rhs[0].(*ast.CallExpr); !ok || !strings.Contains(exprToString(as.Rhs[0]), "hwy.") {
+				continue
+			}
+			uses := 0
+			for _, other := range stmts {
+				uses += countName(other, name)
+			}
+			if uses == 1 {
+				stmts = slices.Delete(stmts, i, i+1)
+				removed = true
+				break
+			}
+		}
+		if !removed {
+			return stmts
+		}
+	}
+}
+
+// clearPositions resets every position in node. The fused body combines
+// nodes parsed from several files, whose positions mean nothing in the
+// composite's file set and must not match its line-based directives.
+func clearPositions(node ast.Node) {
+	posType := reflect.TypeOf(token.NoPos)
+	seen := make(map[uintptr]bool)
+	var walk func(v reflect.Value)
+	walk = func(v reflect.Value) {
+		switch v.Kind() {
+		case reflect.Pointer:
+			if v.IsNil() || seen[v.Pointer()] {
+				return
+			}
+			seen[v.Pointer()] = true
+			walk(v.Elem())
+		case reflect.Interface:
+			if !v.IsNil() {
+				walk(v.Elem())
+			}
+		case reflect.Slice:
+			for i := range v.Len() {
+				walk(v.Index(i))
+			}
+		case reflect.Struct:
+			for i := range v.NumField() {
+				field := v.Field(i)
+				if field.Type() == posType && field.CanSet() {
+					field.SetInt(0)
+					continue
+				}
+				if field.CanSet() {
+					walk(field)
+				}
+			}
+		}
+	}
+	walk(reflect.ValueOf(node))
+}
@@ -532,6 +532,17 @@ func (g *Generator) Run() error {
 	}
 	result := validation.Result
 
+	// Print //hwy:fuse statistics if verbose
+	if g.Verbose {
+		for _, pf := range result.Funcs {
+			if fi := pf.Fusion; fi != nil {
+				fmt.Printf("  %s: %d→1 passes (%s), %d loads forwarded, %d stores eliminated\n",
+					pf.Name, len(fi.Stages), strings.Join(fi.Stages, ", "),
+					fi.LoadsForwarded, fi.StoresEliminated)
+			}
+		}
+	}
+
 	// Use input package name if output package not specified
 	if g.PackageOut == "" {
 		g.PackageOut = result.PackageName
@@ -4,6 +4,7 @@ import (
 	"bytes"
 	"fmt"
 	"go/ast"
+	"go/format"
 	"go/parser"
 	"go/token"
 	"os"
@@ -340,8 +341,9 @@ func BaseCopy(src, dst []uint32) {
 	if strings.Contains(code, "_ = hwy.NoSimdEnv") {
 		t.Fatalf("fallback-only dispatcher should not include unused hwy hack:\n%s", code)
 	}
-	if strings.Contains(code, "\"github.com/ajroetker/go-highway/hwy\"") {
-		t.Fatalf("fallback-only dispatcher should not import hwy when signatures do not need it:\n%s", code)
+	// hwy is still imported, for the dispatch registration.
+	if !strings.Contains(code, "hwy.RegisterDispatch(hwy.DispatchTable{") {
+		t.Fatalf("fallback-only dispatcher should register its groups:\n%s", code)
 	}
 }
 
@@ -3165,15 +3167,16 @@ func BaseTestPopCount(a, b []uint64) uint64 {
 	}
 }
 
-// TestTranslateRaBitQQuantizeVectors verifies that rabitq_base.go's BaseQuantizeVectors
-// translates correctly to NEON C using the float32 profile with mixed-type params.
+// TestTranslateRaBitQQuantizeVectors verifies that rabitq's BaseQuantizeVectors
+// translates correctly to NEON C using the float32 profile with mixed-type
+// params.
 func TestTranslateRaBitQQuantizeVectors(t *testing.T) {
-	rabitqPath := filepath.Join("..", "..", "hwy", "contrib", "rabitq", "rabitq_base.go")
-	if _, err := os.Stat(rabitqPath); err != nil {
-		t.Skipf("rabitq_base.go not found: %v", err)
+	quantizePath := filepath.Join("..", "..", "hwy", "contrib", "rabitq", "quantize_base.go")
+	if _, err := os.Stat(quantizePath); err != nil {
+		t.Skipf("quantize_base.go not found: %v", err)
 	}
 
-	result, err := Parse(rabitqPath)
+	result, err := Parse(quantizePath)
 	if err != nil {
 		t.Fatalf("Parse failed: %v", err)
 	}
@@ -3228,20 +3231,17 @@ func TestTranslateRaBitQQuantizeVectors(t *testing.T) {
 		t.Error("vec slice should be typed as float *")
 	}
 
-	// Verify GetLane with variable index uses store-to-stack pattern
-	if !strings.Contains(cCode, "volatile float _getlane_buf") {
-		t.Error("missing volatile store-to-stack buffer for variable-index GetLane")
-	}
-	if !strings.Contains(cCode, "_getlane_buf[j]") {
-		t.Error("missing variable-index access to _getlane_buf")
+	// Verify the sign bits of a whole vector come from one mask-to-bits
+	// helper, lane-reversed with RBIT, and that the lane mask keeps Go's
+	// precedence (1<<lanes - 1, not 1 << (lanes - 1)).
+	if !strings.Contains(cCode, "~hwy_bits_from_mask_u32(negMask) & laneMask") {
+		t.Error("missing hwy_bits_from_mask_u32 for BitsFromMask")
 	}
-
-	// Verify getSignBit is inlined as float_to_bits >> 31
-	if !strings.Contains(cCode, "float_to_bits(") {
-		t.Error("missing float_to_bits for getSignBit inlining")
+	if !strings.Contains(cCode, "__builtin_bitreverse64(signs)") {
+		t.Error("missing __builtin_bitreverse64 for bits.Reverse64")
 	}
-	if !strings.Contains(cCode, ">> 31") {
-		t.Error("missing >> 31 for sign bit extraction")
+	if !strings.Contains(cCode, "((unsigned long long)(1) << (unsigned long)(lanes)) - 1") {
+		t.Error("laneMask shift should be parenthesized before the subtraction")
 	}
 
 	// Verify NEON SIMD intrinsics for the vectorized path
@@ -3402,7 +3402,7 @@ func TestBenchmarkRaBitQASTvsScalar(t *testing.T) {
 	{
 		var buf bytes.Buffer
 		fmt.Fprintf(&buf, "package rabitqbench\n\nimport \"unsafe\"\n\n")
-		emitASTCWrapperFunc(&buf, bitProductFunc, "uint64", "neon")
+		emitASTCWrapperFunc(&buf, bitProductFunc, "uint64", "neon", "")
 		if err := os.WriteFile(filepath.Join(tmpDir, "ast_wrapper.go"), buf.Bytes(), 0644); err != nil {
 			t.Fatalf("write ast wrapper: %v", err)
 		}
@@ -3592,7 +3592,7 @@ func TestBenchmarkVarintASTvsHandwritten(t *testing.T) {
 	{
 		var buf bytes.Buffer
 		fmt.Fprintf(&buf, "package varintbench\n\nimport \"unsafe\"\n\n")
-		emitASTCWrapperFunc(&buf, findEndsFunc, "uint8", "neon")
+		emitASTCWrapperFunc(&buf, findEndsFunc, "uint8", "neon", "")
 		if err := os.WriteFile(filepath.Join(tmpDir, "ast_wrapper.go"), buf.Bytes(), 0644); err != nil {
 			t.Fatalf("write ast wrapper: %v", err)
 		}
@@ -6707,6 +6707,19 @@ func TestParseTargetsCLI(t *testing.T) {
 		}
 	})
 
+	t.Run("x86 asm targets drop the goexperiment build tag", func(t *testing.T) {
+		specs, err := parseTargets("avx2:asm,avx512", false, false)
+		if err != nil {
+			t.Fatalf("parseTargets(avx2:asm,avx512): %v", err)
+		}
+		if got := specs[0].Target.BuildTag; got != "amd64" {
+			t.Errorf("avx2:asm build tag = %q, want amd64", got)
+		}
+		if got := specs[1].Target.BuildTag; got != amd64SimdBuildTag {
+			t.Errorf("avx512 build tag = %q, want %q", got, amd64SimdBuildTag)
+		}
+	})
+
 	t.Run("rejects invalid mode suffix", func(t *testing.T) {
 		_, err := parseTargets("neon:weird", false, false)
 		if err == nil {
@@ -7399,6 +7412,443 @@ func BaseMainHalf[T hwy.Floats](a []T) {
 	}
 }
 
+func TestScanSpecializationsSkipsOtherInputs(t *testing.T) {
+	tmpDir := t.TempDir()
+
+	// Two hwygen inputs in one package, each with its own specialization.
+	files := map[string]string{
+		"add_base.go": `package test
+
+import "github.com/ajroetker/go-highway/hwy"
+
+//hwy:gen T={float32}
+func BaseAdd[T hwy.Floats](a []T) {
+	_ = hwy.Add(hwy.Vec[T]{}, hwy.Vec[T]{})
+}
+
+//hwy:specializes Add
+//hwy:targets fallback
+func BaseAddScalar(a []float32) {}
+`,
+		"mul_base.go": `package test
+
+import "github.com/ajroetker/go-highway/hwy"
+
+//hwy:gen T={float32}
+func BaseMul[T hwy.Floats](a []T) {
+	_ = hwy.Mul(hwy.Vec[T]{}, hwy.Vec[T]{})
+}
+
+//hwy:specializes Mul
+//hwy:targets fallback
+func BaseMulScalar(a []float32) {}
+`,
+	}
+	for name, content := range files {
+		if err := os.WriteFile(filepath.Join(tmpDir, name), []byte(content), 0644); err != nil {
+			t.Fatalf("Failed to write %s: %v", name, err)
+		}
+	}
+
+	result, err := Parse(filepath.Join(tmpDir, "add_base.go"))
+	if err != nil {
+		t.Fatalf("Parse failed: %v", err)
+	}
+	var names []string
+	for _, pf := range result.Funcs {
+		names = append(names, pf.Name)
+	}
+	if got := strings.Join(names, " "); got != "BaseAdd BaseAddScalar" {
+		t.Errorf("Funcs = %s, want BaseAdd BaseAddScalar", got)
+	}
+	if _, err := buildDispatchGroups(result.Funcs); err != nil {
+		t.Errorf("buildDispatchGroups: %v", err)
+	}
+}
+
+// TestFallbackOnlyCombosDispatch checks that types added by a fallback
+// specialization keep their fallback on SIMD targets instead of staying nil.
+func TestFallbackOnlyCombosDispatch(t *testing.T) {
+	tmpDir := t.TempDir()
+	src := `package test
+
+import "github.com/ajroetker/go-highway/hwy"
+
+//hwy:gen T={int32}
+func BaseFind[T hwy.Integers](s []T, v T) int {
+	_ = hwy.Equal(hwy.Set(v), hwy.Load(s))
+	return -1
+}
+
+//hwy:gen T={uint8}
+//hwy:specializes Find
+//hwy:targets fallback
+func BaseFindBytes[T uint8](s []T, v T) int {
+	return -1
+}
+`
+	path := filepath.Join(tmpDir, "find_base.go")
+	if err := os.WriteFile(path, []byte(src), 0644); err != nil {
+		t.Fatalf("Failed to write input: %v", err)
+	}
+	gen := &Generator{
+		InputFile:      path,
+		OutputDir:      tmpDir,
+		TargetSpecs:    makeTestSpecs(TargetModeGoSimd, "avx2", "fallback"),
+		DispatchPrefix: "find",
+	}
+	if err := gen.Run(); err != nil {
+		t.Fatalf("Generator.Run() failed: %v", err)
+	}
+	data, err := os.ReadFile(filepath.Join(tmpDir, "find_amd64.gen.go"))
+	if err != nil {
+		t.Fatalf("read dispatcher: %v", err)
+	}
+	code := string(data)
+	for _, want := range []string{
+		"func initFindAVX2() {\n\tinitFindFallback()\n\tFindInt32 = BaseFind_avx2_Int32\n}",
+		"FindUint8 = BaseFind_fallback_Uint8",
+	} {
+		if !strings.Contains(code, want) {
+			t.Errorf("dispatcher missing %q, got:\n%s", want, code)
+		}
+	}
+}
+
+func TestKernelDirective(t *testing.T) {
+	tmpDir := t.TempDir()
+	src := `package test
+
+import "github.com/ajroetker/go-highway/hwy"
+
+// BaseDot computes a dot product.
+//
+//hwy:gen T={float32, float64}
+//hwy:kernel
+func BaseDot[T hwy.Floats](a, b []T) T {
+	_ = hwy.Add(hwy.Vec[T]{}, hwy.Vec[T]{})
+	return 0
+}
+
+func BaseSum[T hwy.Floats](a []T) T {
+	_ = hwy.Add(hwy.Vec[T]{}, hwy.Vec[T]{})
+	return 0
+}
+`
+	path := filepath.Join(tmpDir, "dot_base.go")
+	if err := os.WriteFile(path, []byte(src), 0644); err != nil {
+		t.Fatalf("Failed to write input: %v", err)
+	}
+
+	result, err := Parse(path)
+	if err != nil {
+		t.Fatalf("Parse failed: %v", err)
+	}
+	var dot ParsedFunc
+	for _, pf := range result.Funcs {
+		switch pf.Name {
+		case "BaseDot":
+			dot = pf
+		case "BaseSum":
+			if pf.KernelHandle {
+				t.Error("BaseSum has no //hwy:kernel directive")
+			}
+		}
+	}
+	if !dot.KernelHandle {
+		t.Fatal("BaseDot.KernelHandle = false, want true")
+	}
+
+	var buf bytes.Buffer
+	emitKernelAccessor(&buf, dot)
+	output := buf.String()
+	for _, want := range []string{
+		"func DotKernel[T hwy.Floats]() func(a []T, b []T) T {",
+		"// Take it after hwy.ForceDispatch or hwy.ApplyDispatchEnv",
+		"if _, ok := any(zero).(float32); ok {\n\t\treturn any(DotFloat32).(func(a []T, b []T) T)",
+		"if _, ok := any(zero).(float64); ok {\n\t\treturn any(DotFloat64).(func(a []T, b []T) T)",
+	} {
+		if !strings.Contains(output, want) {
+			t.Errorf("accessor missing %q, got:\n%s", want, output)
+		}
+	}
+
+	// Non-generic functions already expose their dispatch variable.
+	bad := strings.Replace(src, "//hwy:kernel\nfunc BaseDot[T hwy.Floats](a, b []T) T {", "//hwy:kernel\nfunc BaseDot(a, b []float32) float32 {", 1)
+	if err := os.WriteFile(path, []byte(bad), 0644); err != nil {
+		t.Fatalf("Failed to write input: %v", err)
+	}
+	if _, err := Parse(path); err == nil || !strings.Contains(err.Error(), "//hwy:kernel") {
+		t.Errorf("Parse of non-generic //hwy:kernel function: err = %v, want //hwy:kernel error", err)
+	}
+}
+
+func TestMaskedTailDirective(t *testing.T) {
+	tmpDir := t.TempDir()
+	src := `package test
+
+import "github.com/ajroetker/go-highway/hwy"
+
+//hwy:gen T={float32, float64}
+//hwy:maskedtail
+func BaseAdd[T hwy.Floats](dst, s []T) {
+	n := min(len(dst), len(s))
+	lanes := hwy.Zero[T]().NumLanes()
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		vd := hwy.Load(dst[i:])
+		vs := hwy.Load(s[i:])
+		hwy.Store(hwy.Add(vd, vs), dst[i:])
+	}
+	for ; i < n; i++ {
+		vd := hwy.Load(dst[i:])
+		vs := hwy.Load(s[i:])
+		hwy.Store(hwy.Add(vd, vs), dst[i:])
+	}
+}
+`
+	path := filepath.Join(tmpDir, "add_base.go")
+	if err := os.WriteFile(path, []byte(src), 0644); err != nil {
+		t.Fatalf("Failed to write input: %v", err)
+	}
+
+	gen := &Generator{
+		InputFile:   path,
+		OutputDir:   tmpDir,
+		TargetSpecs: makeTestSpecs(TargetModeGoSimd, "avx2", "avx512", "fallback"),
+	}
+	if err := gen.Run(); err != nil {
+		t.Fatalf("Generator.Run() failed: %v", err)
+	}
+
+	for file, wants := range map[string][]string{
+		"add_base_avx2.gen.go": {
+			"if i < n {\n\t\thwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)",
+			"hwy.MaskLoad_AVX2_F32x8(hwyTailMask, dst[i:])",
+			"hwy.MaskStore_AVX2_F32x8(hwyTailMask,",
+			"hwy.FirstN_AVX2_F64x4(n - i)",
+		},
+		"add_base_avx512.gen.go": {
+			"hwy.FirstN_AVX512_F32x16(n - i)",
+			"hwy.MaskLoad_AVX512_F64x8(hwyTailMask, s[i:])",
+		},
+	} {
+		data, err := os.ReadFile(filepath.Join(tmpDir, file))
+		if err != nil {
+			t.Fatalf("read %s: %v", file, err)
+		}
+		code := string(data)
+		for _, want := range wants {
+			if !strings.Contains(code, want) {
+				t.Errorf("%s missing %q, got:\n%s", file, want, code)
+			}
+		}
+		if strings.Contains(code, "for ; i < n; i++") {
+			t.Errorf("%s kept the scalar tail loop:\n%s", file, code)
+		}
+	}
+
+	// Reductions get the masked iteration right after the SIMD loop, ahead
+	// of the horizontal reduction, with the accumulator update blended.
+	reduceSrc := `package test
+
+import "github.com/ajroetker/go-highway/hwy"
+
+//hwy:gen T={float32, float64}
+//hwy:maskedtail
+func BaseSum[T hwy.Floats](v []T) T {
+	sum := hwy.Zero[T]()
+	lanes := sum.NumLanes()
+	var i int
+	for i = 0; i+lanes <= len(v); i += lanes {
+		va := hwy.Load(v[i:])
+		sum = hwy.Add(sum, va)
+	}
+	result := hwy.ReduceSum(sum)
+	for ; i < len(v); i++ {
+		result += v[i]
+	}
+	return result
+}
+`
+	reducePath := filepath.Join(tmpDir, "sum_base.go")
+	if err := os.WriteFile(reducePath, []byte(reduceSrc), 0644); err != nil {
+		t.Fatalf("Failed to write input: %v", err)
+	}
+	gen.InputFile = reducePath
+	if err := gen.Run(); err != nil {
+		t.Fatalf("Generator.Run() failed: %v", err)
+	}
+	data, err := os.ReadFile(filepath.Join(tmpDir, "sum_base_avx2.gen.go"))
+	if err != nil {
+		t.Fatalf("read sum_base_avx2.gen.go: %v", err)
+	}
+	code := string(data)
+	masked := strings.Index(code, "sum = sum.Add(va).Merge(sum, hwyTailMask)")
+	reduce := strings.Index(code, "hwy.ReduceSum_AVX2_F32x8(sum)")
+	if masked < 0 || reduce < 0 || masked > reduce {
+		t.Errorf("want the blended masked accumulate before the reduction, got:\n%s", code)
+	}
+	if strings.Contains(code, "for ; i < len(v); i++") {
+		t.Errorf("kept the scalar tail loop:\n%s", code)
+	}
+
+	// The masked iteration reruns the SIMD loop body, so that body must be
+	// element-wise over x[i:] and may update outer variables only whole.
+	for name, bad := range map[string]string{
+		"scalar index": strings.Replace(src,
+			"\t\tvs := hwy.Load(s[i:])\n",
+			"\t\tvs := hwy.Load(s[i:])\n\t\ts[i+lanes-1] = 0\n", 1),
+		"counter": strings.NewReplacer(
+			"\tvar i int\n", "\tvar i, count int\n",
+			"\t\tvd := hwy.Load(dst[i:])\n", "\t\tvd := hwy.Load(dst[i:])\n\t\tcount += lanes\n",
+		).Replace(src),
+		"iterator between loops": strings.Replace(reduceSrc,
+			"\tresult := hwy.ReduceSum(sum)\n", "\tresult := hwy.ReduceSum(sum) + T(i)\n", 1),
+	} {
+		if err := os.WriteFile(path, []byte(bad), 0644); err != nil {
+			t.Fatalf("Failed to write input: %v", err)
+		}
+		if _, err := Parse(path); err == nil || !strings.Contains(err.Error(), "//hwy:maskedtail") {
+			t.Errorf("%s: Parse err = %v, want //hwy:maskedtail error", name, err)
+		}
+	}
+}
+
+func TestAccumulatorsDirective(t *testing.T) {
+	tmpDir := t.TempDir()
+	src := `package test
+
+import "github.com/ajroetker/go-highway/hwy"
+
+//hwy:gen T={float32, float64}
+func BaseSum[T hwy.Floats](v []T) T {
+	sum := hwy.Zero[T]()
+	lanes := sum.NumLanes()
+	var i int
+	//hwy:accumulators 4
+	for i = 0; i+lanes <= len(v); i += lanes {
+		va := hwy.Load(v[i:])
+		sum = hwy.Add(sum, va)
+	}
+	result := hwy.ReduceSum(sum)
+	for ; i < len(v); i++ {
+		result += v[i]
+	}
+	return result
+}
+
+//hwy:gen T={float32, float64}
+func BaseMax[T hwy.Floats](v []T) T {
+	lanes := hwy.Zero[T]().NumLanes()
+	maxVec := hwy.LoadSlice(v)
+	var i int
+	//hwy:accumulators 2
+	for i = lanes; i+lanes <= len(v); i += lanes {
+		va := hwy.Load(v[i:])
+		maxVec = hwy.Max(maxVec, va)
+	}
+	result := hwy.ReduceMax(maxVec)
+	for ; i < len(v); i++ {
+		result = max(result, v[i])
+	}
+	return result
+}
+`
+	path := filepath.Join(tmpDir, "reduce_base.go")
+	if err := os.WriteFile(path, []byte(src), 0644); err != nil {
+		t.Fatalf("Failed to write input: %v", err)
+	}
+
+	result, err := Parse(path)
+	if err != nil {
+		t.Fatalf("Parse failed: %v", err)
+	}
+	for _, pf := range result.Funcs {
+		want := map[string]AccumulatorVar{
+			"BaseSum": {Name: "sum", Combine: "Add"},
+			"BaseMax": {Name: "maxVec", Combine: "Max"},
+		}[pf.Name]
+		if len(pf.LoopInfo.AccumulatorVars) != 1 || pf.LoopInfo.AccumulatorVars[0] != want {
+			t.Errorf("%s: AccumulatorVars = %v, want [%v]", pf.Name, pf.LoopInfo.AccumulatorVars, want)
+		}
+	}
+
+	gen := &Generator{
+		InputFile:   path,
+		OutputDir:   tmpDir,
+		TargetSpecs: makeTestSpecs(TargetModeGoSimd, "avx2", "fallback"),
+	}
+	if err := gen.Run(); err != nil {
+		t.Fatalf("Generator.Run() failed: %v", err)
+	}
+	data, err := os.ReadFile(filepath.Join(tmpDir, "reduce_base_avx2.gen.go"))
+	if err != nil {
+		t.Fatalf("read AVX2 file: %v", err)
+	}
+	code := string(data)
+	for _, want := range []string{
+		"sum3 := archsimd.BroadcastFloat32x8(0)\n\tfor i = 0; i+lanes*4 <= len(v); i += lanes * 4 {",
+		"sum3 = sum3.Add(va3)\n\t}\n\tsum = sum.Add(sum1)\n\tsum2 = sum2.Add(sum3)\n\tsum = sum.Add(sum2)\n",
+		// The single-vector cleanup loop runs before the scalar tail.
+		"\tfor ; i+lanes <= len(v); i += lanes {",
+		"maxVec1 := maxVec\n",
+		"maxVec1 = maxVec1.Max(va1)\n\t}\n\tmaxVec = maxVec.Max(maxVec1)\n",
+	} {
+		if !strings.Contains(code, want) {
+			t.Errorf("AVX2 file missing %q, got:\n%s", want, code)
+		}
+	}
+
+	// The scalarized fallback keeps one scalar chain per accumulator.
+	data, err = os.ReadFile(filepath.Join(tmpDir, "reduce_base_fallback.gen.go"))
+	if err != nil {
+		t.Fatalf("read fallback file: %v", err)
+	}
+	code = string(data)
+	for _, want := range []string{
+		"sum3 := float32(0)\n\tfor i = 0; i+4 <= len(v); i += 4 {",
+		"sum3 = sum3 + va3\n\t}\n\tsum = sum + sum1\n\tsum2 = sum2 + sum3\n\tsum = sum + sum2\n",
+		"maxVec1 := maxVec\n",
+		"maxVec1 = max(maxVec1, va1)\n\t}\n\tmaxVec = max(maxVec, maxVec1)\n",
+	} {
+		if !strings.Contains(code, want) {
+			t.Errorf("fallback file missing %q, got:\n%s", want, code)
+		}
+	}
+
+	// The C translator splits the chains the same way.
+	var sum *ParsedFunc
+	for i := range result.Funcs {
+		if result.Funcs[i].Name == "BaseSum" {
+			sum = &result.Funcs[i]
+		}
+	}
+	cCode, err := NewCASTTranslator(GetCProfile("NEON", "float32"), "float32").TranslateToC(sum)
+	if err != nil {
+		t.Fatalf("TranslateToC: %v", err)
+	}
+	for _, want := range []string{"sum3", "vaddq_f32(sum, sum1)"} {
+		if !strings.Contains(cCode, want) {
+			t.Errorf("C code missing %q, got:\n%s", want, cCode)
+		}
+	}
+
+	for name, bad := range map[string]string{
+		"non-zero start":  strings.Replace(src, "sum := hwy.Zero[T]()", "sum := hwy.Set(T(1))", 1),
+		"extra use":       strings.Replace(src, "sum = hwy.Add(sum, va)", "sum = hwy.Add(sum, va)\n\t\t_ = hwy.ReduceSum(sum)", 1),
+		"unroll 3":        strings.Replace(src, "//hwy:accumulators 4", "//hwy:unroll 3\n\t//hwy:accumulators 4", 1),
+		"not a reduction": strings.Replace(src, "sum = hwy.Add(sum, va)", "sum = hwy.Sub(sum, va)", 1),
+	} {
+		if err := os.WriteFile(path, []byte(bad), 0644); err != nil {
+			t.Fatalf("Failed to write input: %v", err)
+		}
+		if _, err := Parse(path); err == nil || !strings.Contains(err.Error(), "//hwy:accumulators") {
+			t.Errorf("%s: Parse err = %v, want //hwy:accumulators error", name, err)
+		}
+	}
+}
+
 // TestCModeSpecializesVecVec verifies that the C generator applies dispatch
 // group name normalization to Vec→Vec functions. The Vec→Vec C emitter
 // generates code based on recognized function names (Exp, Sigmoid, etc.),
@@ -7939,7 +8389,7 @@ func TestTypeParamScalarDoesNotChangeLengthStrategy(t *testing.T) {
 	{
 		var buf bytes.Buffer
 		buf.WriteString("package test\n\nimport \"unsafe\"\n\n")
-		emitASTCWrapperFunc(&buf, pf, "float32", "neon")
+		emitASTCWrapperFunc(&buf, pf, "float32", "neon", "")
 		code := buf.String()
 
 		// Should have shared length: lenVal := int64(len(input))
@@ -7956,7 +8406,7 @@ func TestTypeParamScalarDoesNotChangeLengthStrategy(t *testing.T) {
 	{
 		var buf bytes.Buffer
 		buf.WriteString("package test\n\nimport \"unsafe\"\n\n")
-		emitSliceZCAdapterFunc(&buf, pf, "float32")
+		emitSliceZCAdapterFunc(&buf, pf, "float32", "")
 		code := buf.String()
 
 		// Should have shared length: lenVal := int64(len(input))
@@ -7986,7 +8436,7 @@ func TestTypeParamScalarDoesNotChangeLengthStrategy(t *testing.T) {
 	{
 		var buf bytes.Buffer
 		buf.WriteString("package test\n\nimport \"unsafe\"\n\n")
-		emitASTCWrapperFunc(&buf, pfWithInt, "float32", "neon")
+		emitASTCWrapperFunc(&buf, pfWithInt, "float32", "neon", "")
 		code := buf.String()
 
 		// Should have per-slice lengths (len_aVal, len_bVal, etc.)
@@ -7996,6 +8446,25 @@ func TestTypeParamScalarDoesNotChangeLengthStrategy(t *testing.T) {
 	}
 }
 
+func TestSliceZCAdapterEmptyInputUsesFallback(t *testing.T) {
+	pf := &ParsedFunc{
+		Name:       "BaseIsSorted",
+		TypeParams: []TypeParam{{Name: "T", Constraint: "hwy.Lanes"}},
+		Params:     []Param{{Name: "data", Type: "[]T"}},
+		Returns:    []Param{{Type: "bool"}},
+	}
+	for elemType, want := range map[string]string{
+		"float32": "return BaseIsSorted_fallback(data)",
+		"float64": "return BaseIsSorted_fallback_Float64(data)",
+	} {
+		var buf bytes.Buffer
+		emitSliceZCAdapterFunc(&buf, pf, elemType, "avx2")
+		if code := buf.String(); !strings.Contains(code, "if lenVal == 0 {\n\t\t"+want+"\n") {
+			t.Errorf("%s: empty input should defer to the fallback:\n%s", elemType, code)
+		}
+	}
+}
+
 func TestSharedLengthAdaptersPreserveMinSliceExpr(t *testing.T) {
 	pf := &ParsedFunc{
 		Name:       "BaseAndSlice",
@@ -8019,7 +8488,7 @@ func TestSharedLengthAdaptersPreserveMinSliceExpr(t *testing.T) {
 	{
 		var buf bytes.Buffer
 		buf.WriteString("package test\n\nimport \"unsafe\"\n\n")
-		emitSliceZCAdapterFunc(&buf, pf, "uint64")
+		emitSliceZCAdapterFunc(&buf, pf, "uint64", "")
 		code := buf.String()
 		if !strings.Contains(code, wantLen) {
 			t.Errorf("emitSliceZCAdapterFunc: expected min-based shared length:\n%s", code)
@@ -8035,7 +8504,7 @@ func TestSharedLengthAdaptersPreserveMinSliceExpr(t *testing.T) {
 	{
 		var buf bytes.Buffer
 		buf.WriteString("package test\n\nimport \"unsafe\"\n\n")
-		emitASTCWrapperFunc(&buf, pf, "uint64", "neon")
+		emitASTCWrapperFunc(&buf, pf, "uint64", "neon", "")
 		code := buf.String()
 		if !strings.Contains(code, wantLen) {
 			t.Errorf("emitASTCWrapperFunc: expected min-based shared length:\n%s", code)
@@ -8178,6 +8647,196 @@ func TestEmitDispatcherSkipsArm64AsmTargetWithoutAdapters(t *testing.T) {
 	}
 }
 
+func TestEmitDispatcherRegistersGroups(t *testing.T) {
+	tmpDir := t.TempDir()
+	inputFile := filepath.Join(tmpDir, "dot_base.go")
+
+	dot := ParsedFunc{
+		Name:       "BaseDot",
+		TypeParams: []TypeParam{{Name: "T", Constraint: "hwy.Floats"}},
+		Params: []Param{
+			{Name: "a", Type: "[]T"},
+			{Name: "b", Type: "[]T"},
+		},
+		Returns: []Param{{Type: "T"}},
+		TypeCombinations: []TypeCombination{
+			{Types: map[string]string{"T": "float32"}},
+			{Types: map[string]string{"T": "float64"}},
+		},
+	}
+	sum := ParsedFunc{
+		Name:    "BaseSum",
+		Params:  []Param{{Name: "a", Type: "[]float32"}},
+		Returns: []Param{{Type: "float32"}},
+	}
+
+	neon := NEONTarget()
+	neon.Mode = TargetModeAsm
+
+	if err := EmitDispatcher(
+		[]ParsedFunc{dot, sum},
+		[]Target{AVX2Target(), AVX512Target(), neon, FallbackTarget()},
+		"testpkg",
+		tmpDir,
+		"",
+		inputFile,
+		nil,
+		nil,
+	); err != nil {
+		t.Fatalf("EmitDispatcher: %v", err)
+	}
+
+	for file, wants := range map[string][]string{
+		"dispatch_dot_amd64.gen.go": {
+			"func init() {\n\tinitDotAll()\n\thwy.RegisterDispatch(hwy.DispatchTable{\n\t\tPackage: \"testpkg\",",
+			"{Name: \"Dot\", Vars: []any{&DotFloat32, &DotFloat64}},",
+			"{Name: \"Sum\", Vars: []any{&Sum}},",
+			"{Name: \"avx512\", Supported: archsimd.X86.AVX512(), Init: initDotAVX512},\n" +
+				"\t\t\t{Name: \"avx2\", Supported: archsimd.X86.AVX2(), Init: initDotAVX2},\n" +
+				"\t\t\t{Name: \"fallback\", Supported: true, Init: initDotFallback},",
+		},
+		// Without asm adapters the NEON asm target has no init function.
+		"dispatch_dot_arm64.gen.go": {
+			"Targets: []hwy.DispatchTarget{\n\t\t\t{Name: \"fallback\", Supported: true, Init: initDotFallback},\n\t\t},",
+		},
+		"dispatch_dot_other.gen.go": {
+			"Targets: []hwy.DispatchTarget{\n\t\t\t{Name: \"fallback\", Supported: true, Init: initDotFallback},\n\t\t},",
+		},
+	} {
+		data, err := os.ReadFile(filepath.Join(tmpDir, file))
+		if err != nil {
+			t.Fatalf("read dispatcher: %v", err)
+		}
+		code := string(data)
+		for _, want := range wants {
+			if !strings.Contains(code, want) {
+				t.Errorf("%s missing %q, got:\n%s", file, want, code)
+			}
+		}
+	}
+}
+
+func TestProfileWrapper(t *testing.T) {
+	for _, tc := range []struct {
+		name string
+		sig  string
+		want []string
+	}{
+		{
+			name: "reduction",
+			sig:  "(a []float32, b []float32) float32",
+			want: []string{
+				"DotFloat32 = func(a []float32, b []float32) float32 {",
+				"hwyR0 := hwyImpl(a, b)",
+				"hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))",
+				"return hwyR0",
+			},
+		},
+		{
+			// A kernel parameter named c must not capture the counter.
+			name: "matmul",
+			sig:  "(a []float32, b []float32, c []float32, m int, n int, k int)",
+			want: []string{
+				"hwyImpl(a, b, c, m, n, k)\n",
+				"hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))",
+			},
+		},
+		{
+			name: "batch",
+			sig:  "(vectors [][]float32, _ []float32, opts ...int) (int, error)",
+			want: []string{
+				"func(vectors [][]float32, hwyP1 []float32, opts ...int) (int, error) {",
+				"hwyR0, hwyR1 := hwyImpl(vectors, hwyP1, opts...)",
+				"hwyCounter.Done(hwyStart, len(hwyP1), hwy.SliceBytes(hwyP1))",
+				"return hwyR0, hwyR1",
+			},
+		},
+	} {
+		var buf bytes.Buffer
+		if err := emitProfileWrapper(&buf, profileVar{Name: "DotFloat32", Signature: tc.sig}); err != nil {
+			t.Fatalf("%s: %v", tc.name, err)
+		}
+		for _, want := range tc.want {
+			if !strings.Contains(buf.String(), want) {
+				t.Errorf("%s: wrapper missing %q, got:\n%s", tc.name, want, buf.String())
+			}
+		}
+	}
+
+	for _, tc := range []struct {
+		tags []string
+		want string
+	}{
+		{[]string{"amd64 && goexperiment.simd", "arm64", ""}, "hwyprof"},
+		{[]string{"arm64"}, "hwyprof && arm64"},
+		{[]string{"amd64 && goexperiment.simd", "arm64"}, "hwyprof && ((amd64 && goexperiment.simd) || arm64)"},
+	} {
+		if got := profileFileBuildTag(tc.tags); got != tc.want {
+			t.Errorf("profileFileBuildTag(%q) = %q, want %q", tc.tags, got, tc.want)
+		}
+	}
+}
+
+func TestProfileDirective(t *testing.T) {
+	tmpDir := t.TempDir()
+	src := `package test
+
+import "github.com/ajroetker/go-highway/hwy"
+
+// BaseUnpackBlock unpacks one block of src into dst.
+//
+//hwy:profile elems=BlockSize bytes=4*BlockSize + 4*len(dst)
+func BaseUnpackBlock(src []uint32, bitWidth int, dst []uint32) int {
+	_ = hwy.Add(hwy.Vec[uint32]{}, hwy.Vec[uint32]{})
+	return 0
+}
+`
+	path := filepath.Join(tmpDir, "block_base.go")
+	if err := os.WriteFile(path, []byte(src), 0644); err != nil {
+		t.Fatalf("Failed to write input: %v", err)
+	}
+	result, err := Parse(path)
+	if err != nil {
+		t.Fatalf("Parse failed: %v", err)
+	}
+	if len(result.Funcs) != 1 {
+		t.Fatalf("got %d funcs, want 1", len(result.Funcs))
+	}
+	pf := result.Funcs[0]
+	if pf.ProfileElems != "BlockSize" || pf.ProfileBytes != "4*BlockSize + 4*len(dst)" {
+		t.Fatalf("ProfileElems, ProfileBytes = %q, %q", pf.ProfileElems, pf.ProfileBytes)
+	}
+
+	var buf bytes.Buffer
+	v := profileVar{
+		Name:      "UnpackBlock",
+		Signature: "(src []uint32, bitWidth int, dst []uint32) int",
+		Elems:     pf.ProfileElems,
+		Bytes:     pf.ProfileBytes,
+	}
+	if err := emitProfileWrapper(&buf, v); err != nil {
+		t.Fatal(err)
+	}
+	if want := "hwyCounter.Done(hwyStart, BlockSize, 4*BlockSize + 4*len(dst))"; !strings.Contains(buf.String(), want) {
+		t.Errorf("wrapper missing %q, got:\n%s", want, buf.String())
+	}
+
+	for name, directive := range map[string]string{
+		"empty":       "//hwy:profile",
+		"unknown key": "//hwy:profile items=BlockSize",
+		"repeated":    "//hwy:profile elems=1 elems=2",
+		"bad expr":    "//hwy:profile bytes=4*(len(dst)",
+	} {
+		bad := strings.Replace(src, "//hwy:profile elems=BlockSize bytes=4*BlockSize + 4*len(dst)", directive, 1)
+		if err := os.WriteFile(path, []byte(bad), 0644); err != nil {
+			t.Fatalf("Failed to write input: %v", err)
+		}
+		if _, err := Parse(path); err == nil || !strings.Contains(err.Error(), "//hwy:profile") {
+			t.Errorf("%s: Parse err = %v, want //hwy:profile error", name, err)
+		}
+	}
+}
+
 func TestEmitAsmDispatchBridgeCreatesBridgeAndStub(t *testing.T) {
 	tmpRoot := t.TempDir()
 	if err := os.WriteFile(filepath.Join(tmpRoot, "go.mod"), []byte("module example.com/test\n\ngo 1.26\n"), 0o644); err != nil {
@@ -8207,7 +8866,7 @@ func TestEmitAsmDispatchBridgeCreatesBridgeAndStub(t *testing.T) {
 		PackageOut:     "roaring",
 		DispatchPrefix: "roaring",
 	}
-	compiled := map[string]bool{cTypeSuffix("uint64"): true}
+	compiled := map[string]bool{"baseandslice_c_" + cTypeSuffix("uint64"): true}
 
 	if err := g.emitAsmDispatchBridge([]ParsedFunc{pf}, neon, compiled); err != nil {
 		t.Fatalf("emitAsmDispatchBridge: %v", err)
@@ -8226,7 +8885,7 @@ func TestEmitAsmDispatchBridgeCreatesBridgeAndStub(t *testing.T) {
 	if !strings.Contains(bridge, "func initRoaringNeonCAsm() {") {
 		t.Fatalf("bridge missing helper init function:\n%s", bridge)
 	}
-	wantAssign := buildDispatchVarName(pf.Name, "uint64", true) + " = " + buildAdapterFuncName(pf.Name, "uint64")
+	wantAssign := buildDispatchVarName(pf.Name, "uint64", true) + " = " + buildAdapterFuncName(pf.Name, "uint64", "")
 	if !strings.Contains(bridge, wantAssign) {
 		t.Fatalf("bridge missing dispatch assignment %q:\n%s", wantAssign, bridge)
 	}
@@ -8276,7 +8935,7 @@ func TestEmitZCDispatchForSlicesOmitsDispatcherOwnedInit(t *testing.T) {
 		PackageOut:     "roaring",
 		DispatchPrefix: "roaring",
 	}
-	compiled := map[string]bool{cTypeSuffix("uint64"): true}
+	compiled := map[string]bool{"baseandslice_c_" + cTypeSuffix("uint64"): true}
 
 	if err := g.emitZCDispatchForSlices([]ParsedFunc{pf}, neon, compiled); err != nil {
 		t.Fatalf("emitZCDispatchForSlices: %v", err)
@@ -8295,7 +8954,167 @@ func TestEmitZCDispatchForSlicesOmitsDispatcherOwnedInit(t *testing.T) {
 	if strings.Contains(code, "\"github.com/ajroetker/go-highway/hwy\"") {
 		t.Fatalf("uint64 adapter-only file should not import hwy:\n%s", code)
 	}
-	if !strings.Contains(code, "func "+buildAdapterFuncName(pf.Name, "uint64")+"(") {
+	if !strings.Contains(code, "func "+buildAdapterFuncName(pf.Name, "uint64", "")+"(") {
 		t.Fatalf("missing uint64 adapter function:\n%s", code)
 	}
 }
+
+func TestFuseDirective(t *testing.T) {
+	tmpDir := t.TempDir()
+	ops := `package test
+
+import "github.com/ajroetker/go-highway/hwy"
+
+func BaseScale[T hwy.Floats](c T, dst []T) {
+	if len(dst) == 0 {
+		return
+	}
+	n := len(dst)
+	vc := hwy.Set(c)
+	lanes := vc.NumLanes()
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		vd := hwy.Load(dst[i:])
+		result := hwy.Mul(vd, vc)
+		hwy.Store(result, dst[i:])
+	}
+	for ; i < n; i++ {
+		dst[i] *= c
+	}
+}
+
+func BaseAddTo[T hwy.Floats](dst, s []T) {
+	n := min(len(dst), len(s))
+	lanes := hwy.MaxLanes[T]()
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		va := hwy.Load(dst[i:])
+		vb := hwy.Load(s[i:])
+		result := hwy.Add(va, vb)
+		hwy.Store(result, dst[i:])
+	}
+	for ; i < n; i++ {
+		dst[i] += s[i]
+	}
+}
+
+func BaseSum[T hwy.Floats](v []T) T {
+	if len(v) == 0 {
+		return 0
+	}
+	sum := hwy.Zero[T]()
+	lanes := sum.NumLanes()
+	var i int
+	//hwy:accumulators 2
+	for i = 0; i+lanes <= len(v); i += lanes {
+		sum = hwy.Add(sum, hwy.Load(v[i:]))
+	}
+	result := hwy.ReduceSum(sum)
+	for ; i < len(v); i++ {
+		result += v[i]
+	}
+	return result
+}
+
+func BaseFirst[T hwy.Floats](v []T) {
+	first := v[0]
+	lanes := hwy.MaxLanes[T]()
+	var i int
+	for i = 0; i+lanes <= len(v); i += lanes {
+		hwy.Store(hwy.Set(first), v[i:])
+	}
+}
+`
+	if err := os.WriteFile(filepath.Join(tmpDir, "ops.go"), []byte(ops), 0644); err != nil {
+		t.Fatalf("Failed to write ops: %v", err)
+	}
+	src := `package test
+
+import "github.com/ajroetker/go-highway/hwy"
+
+//hwy:gen T={float32, float64}
+//hwy:fuse
+func BaseScaleAddSum[T hwy.Floats](x, y []T, c T) T {
+	BaseScale(c*2, x)
+	BaseAddTo(x, y)
+	return BaseSum(x)
+}
+`
+	path := filepath.Join(tmpDir, "fused_base.go")
+	if err := os.WriteFile(path, []byte(src), 0644); err != nil {
+		t.Fatalf("Failed to write input: %v", err)
+	}
+
+	result, err := Parse(path)
+	if err != nil {
+		t.Fatalf("Parse failed: %v", err)
+	}
+	if len(result.Funcs) != 1 || result.Funcs[0].Fusion == nil {
+		t.Fatalf("expected one fused function, got %+v", result.Funcs)
+	}
+	pf := result.Funcs[0]
+	fi := pf.Fusion
+	if got := strings.Join(fi.Stages, ","); got != "BaseScale,BaseAddTo,BaseSum" {
+		t.Errorf("Stages = %s", got)
+	}
+	// The loads of x in BaseAddTo and BaseSum reuse the vector just
+	// computed, and BaseScale's store is overwritten by BaseAddTo's.
+	if fi.LoadsForwarded != 2 || fi.StoresEliminated != 1 || fi.Accumulators != 2 {
+		t.Errorf("LoadsForwarded, StoresEliminated, Accumulators = %d, %d, %d, want 2, 1, 2",
+			fi.LoadsForwarded, fi.StoresEliminated, fi.Accumulators)
+	}
+	if pf.LoopInfo == nil || pf.LoopInfo.Accumulators != 2 || len(pf.LoopInfo.AccumulatorVars) != 1 {
+		t.Errorf("LoopInfo = %+v, want the sum split into 2 chains", pf.LoopInfo)
+	}
+	var body bytes.Buffer
+	if err := format.Node(&body, token.NewFileSet(), pf.Body); err != nil {
+		t.Fatal(err)
+	}
+	fused := body.String()
+	for want, count := range map[string]int{
+		"for i = 0; i+lanes <= n_3; i += lanes {": 1,
+		"hwy.Load(":          2,
+		"hwy.Store(":         1,
+		"c_2 T = c * 2":      1,
+		"n_3 := min(n, n_2)": 1,
+		"if len(x) == 0 {":   1,
+	} {
+		if got := strings.Count(fused, want); got != count {
+			t.Errorf("fused body has %d of %q, want %d:\n%s", got, want, count, fused)
+		}
+	}
+
+	gen := &Generator{
+		InputFile:   path,
+		OutputDir:   tmpDir,
+		TargetSpecs: makeTestSpecs(TargetModeGoSimd, "avx2", "fallback"),
+	}
+	if err := gen.Run(); err != nil {
+		t.Fatalf("Generator.Run() failed: %v", err)
+	}
+	data, err := os.ReadFile(filepath.Join(tmpDir, "fused_base_avx2.gen.go"))
+	if err != nil {
+		t.Fatalf("read AVX2 file: %v", err)
+	}
+	if code := string(data); !strings.Contains(code, "sum1 = sum1.Add(result_21)") {
+		t.Errorf("AVX2 file does not split the fused sum, got:\n%s", code)
+	}
+
+	for _, tc := range []struct {
+		body, want string
+	}{
+		{"x[0] = c\n\tBaseScale(c, x)", "is not a kernel call"},
+		{"BaseScale(c, x)\n\tBaseFirst(x)", "reads its input before its SIMD loop"},
+		{"BaseScale(c, x[1:])", "must be a variable"},
+		{"BaseScale(c, x)\n\tBaseMissing(x)", "BaseMissing not found"},
+	} {
+		bad := strings.Replace(src, "BaseScale(c*2, x)\n\tBaseAddTo(x, y)\n\treturn BaseSum(x)", tc.body, 1)
+		bad = strings.Replace(bad, ") T {", ") {", 1)
+		if err := os.WriteFile(path, []byte(bad), 0644); err != nil {
+			t.Fatal(err)
+		}
+		if _, err := Parse(path); err == nil || !strings.Contains(err.Error(), tc.want) {
+			t.Errorf("%q: got error %v, want %q", tc.body, err, tc.want)
+		}
+	}
+}
@@ -45,6 +45,9 @@ type Builder struct {
 
 	// elemType is the concrete element type (e.g., "float32").
 	elemType string
+
+	// accumulators holds the //hwy:accumulators count of each loop.
+	accumulators map[*ast.ForStmt]int
 }
 
 // Resolver is an interface for resolving cross-package function calls.
@@ -101,6 +104,9 @@ type ParsedFunc struct {
 	Params     []ParamInput
 	Returns    []ParamInput
 	Body       *ast.BlockStmt
+
+	// Accumulators maps loops of Body to their //hwy:accumulators count.
+	Accumulators map[*ast.ForStmt]int
 }
 
 // TypeParamInput mirrors the main package's TypeParam.
@@ -121,6 +127,7 @@ func (b *Builder) Build(pf *ParsedFunc) (*IRFunction, error) {
 	b.fn.ElemType = b.elemType
 	b.vars = make(map[string]*IRNode)
 	b.varTypes = make(map[string]string)
+	b.accumulators = pf.Accumulators
 
 	// Copy type parameters
 	for _, tp := range pf.TypeParams {
@@ -426,6 +433,7 @@ func (b *Builder) buildFor(stmt *ast.ForStmt) error {
 		}
 	}
 
+	lr.Accumulators = b.accumulators[stmt]
 	loopNode.LoopRange = lr
 
 	// Save current loop context
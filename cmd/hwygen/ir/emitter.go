@@ -17,6 +17,7 @@ package ir
 import (
 	"bytes"
 	"fmt"
+	"maps"
 	"slices"
 	"strings"
 )
@@ -778,7 +779,6 @@ func (e *Emitter) emitFusedMapReduce(fn *IRFunction, group *FusionGroup) {
 	tier := e.profile.GetTier()
 	lanes := e.profile.GetLanes()
 	vecType := e.profile.GetVecType(tier)
-	scalarType := e.profile.GetScalarType()
 
 	// Find the reduction node
 	var reduceNode *IRNode
@@ -793,6 +793,11 @@ func (e *Emitter) emitFusedMapReduce(fn *IRFunction, group *FusionGroup) {
 		return
 	}
 
+	if lr.Accumulators > 1 {
+		e.emitMultiChainMapReduce(fn, group, reduceNode)
+		return
+	}
+
 	// Initialize vector accumulator
 	accName := "_vacc"
 	zeroInit := e.profile.GetZeroInit(tier)
@@ -804,6 +809,93 @@ func (e *Emitter) emitFusedMapReduce(fn *IRFunction, group *FusionGroup) {
 		lr.LoopVar, lr.Start, lr.LoopVar, lanes, lr.End, lr.LoopVar, lanes)
 
 	e.indent++
+	e.emitMapReduceBody(fn, group, reduceNode, accName)
+	e.indent--
+	e.writef("}\n")
+
+	e.emitFinalReduce(reduceNode, accName)
+}
+
+// emitMultiChainMapReduce emits a fused compute-and-reduce loop whose
+// reduction is split over lr.Accumulators independent chains, so that
+// consecutive vectors do not wait on each other's add latency:
+//
+//	_vacc = 0; _vacc1 = 0; ...
+//	for (_base ...; _base += N*lanes) {
+//		{ long i = _base;           ...; _vacc = add(_vacc, x); }
+//		{ long i = _base + lanes;   ...; _vacc1 = add(_vacc1, x); }
+//	}
+//	for (; _base + lanes <= end; _base += lanes) { long i = _base; ... }
+//	_vacc = add(_vacc, _vacc1) ...
+//
+// Each chain body is its own C block so its temporaries can be redeclared.
+func (e *Emitter) emitMultiChainMapReduce(fn *IRFunction, group *FusionGroup, reduceNode *IRNode) {
+	lr := group.LoopRange
+	n := lr.Accumulators
+	tier := e.profile.GetTier()
+	lanes := e.profile.GetLanes()
+	vecType := e.profile.GetVecType(tier)
+	zeroInit := e.profile.GetZeroInit(tier)
+	addIntrinsic := e.profile.GetIntrinsic("Add", tier)
+
+	accs := make([]string, n)
+	accs[0] = "_vacc"
+	for k := 1; k < n; k++ {
+		accs[k] = fmt.Sprintf("_vacc%d", k)
+	}
+	base := "_" + lr.LoopVar + "_base"
+
+	e.writef("// Fused: %s (MapReduce, %d accumulators)\n", group.Pattern, n)
+	for _, acc := range accs {
+		e.writef("%s %s = %s;\n", vecType, acc, zeroInit)
+	}
+	e.writef("long %s = %s;\n", base, lr.Start)
+
+	// chain emits one body copy at offset k*lanes into accumulator acc.
+	chain := func(k int, acc string) {
+		declared := maps.Clone(e.emittedVars)
+		e.writef("{\n")
+		e.indent++
+		if k == 0 {
+			e.writef("long %s = %s;\n", lr.LoopVar, base)
+		} else {
+			e.writef("long %s = %s + %d;\n", lr.LoopVar, base, k*lanes)
+		}
+		e.emitMapReduceBody(fn, group, reduceNode, acc)
+		e.indent--
+		e.writef("}\n")
+		e.emittedVars = declared
+	}
+
+	e.writef("for (; %s + %d <= %s; %s += %d) {\n", base, n*lanes, lr.End, base, n*lanes)
+	e.indent++
+	for k, acc := range accs {
+		chain(k, acc)
+	}
+	e.indent--
+	e.writef("}\n")
+
+	// Remaining full vectors go to the first chain.
+	e.writef("for (; %s + %d <= %s; %s += %d) {\n", base, lanes, lr.End, base, lanes)
+	e.indent++
+	chain(0, accs[0])
+	e.indent--
+	e.writef("}\n")
+
+	// Tree combine keeps the merge depth at log2(n).
+	for step := 1; step < n; step *= 2 {
+		for k := 0; k+step < n; k += 2 * step {
+			e.writef("%s = %s(%s, %s);\n", accs[k], addIntrinsic, accs[k], accs[k+step])
+		}
+	}
+
+	e.emitFinalReduce(reduceNode, accs[0])
+}
+
+// emitMapReduceBody emits the elementwise members of a MapReduce group
+// followed by the accumulation of the reduction input into acc.
+func (e *Emitter) emitMapReduceBody(fn *IRFunction, group *FusionGroup, reduceNode *IRNode, acc string) {
+	tier := e.profile.GetTier()
 
 	// Emit elementwise operations
 	for _, id := range group.Members {
@@ -818,17 +910,21 @@ func (e *Emitter) emitFusedMapReduce(fn *IRFunction, group *FusionGroup) {
 	addIntrinsic := e.profile.GetIntrinsic("Add", tier)
 	if len(reduceNode.Inputs) > 0 && reduceNode.Inputs[0] != nil {
 		inputName := reduceNode.Inputs[0].Outputs[0]
-		e.writef("%s = %s(%s, %s);\n", accName, addIntrinsic, accName, inputName)
+		e.writef("%s = %s(%s, %s);\n", acc, addIntrinsic, acc, inputName)
 	}
+}
 
-	e.indent--
-	e.writef("}\n")
+// emitFinalReduce emits the horizontal reduction of acc into the reduction
+// node's output.
+func (e *Emitter) emitFinalReduce(reduceNode *IRNode, acc string) {
+	tier := e.profile.GetTier()
+	scalarType := e.profile.GetScalarType()
 
 	// Final horizontal reduction
 	reduceIntrinsic := e.profile.GetIntrinsic(reduceNode.Op, tier)
 	if len(reduceNode.Outputs) > 0 {
 		outName := reduceNode.Outputs[0]
-		e.writef("%s %s = %s(%s);\n", scalarType, outName, reduceIntrinsic, accName)
+		e.writef("%s %s = %s(%s);\n", scalarType, outName, reduceIntrinsic, acc)
 		e.emittedVars[outName] = true
 	}
 }
@@ -424,3 +424,68 @@ func TestHasSingleConsumer(t *testing.T) {
 		t.Error("node with 2 consumers should not have single consumer")
 	}
 }
+
+// TestEmitMultiChainMapReduce verifies that a MapReduce group whose loop
+// carries an //hwy:accumulators count is emitted with independent chains and
+// a tree combine.
+func TestEmitMultiChainMapReduce(t *testing.T) {
+	src := `package test
+
+func sumExp(input []float32, size int) {
+	for i := 0; i < size; i += lanes {
+		x := hwy.Load(input[i:])
+	}
+}
+`
+	file, err := parser.ParseFile(token.NewFileSet(), "test.go", src, 0)
+	if err != nil {
+		t.Fatalf("parse: %v", err)
+	}
+	body := file.Decls[0].(*ast.FuncDecl).Body
+	loop := body.List[0].(*ast.ForStmt)
+	irFunc, err := NewBuilder().Build(&ParsedFunc{
+		Name:         "sumExp",
+		Body:         body,
+		Accumulators: map[*ast.ForStmt]int{loop: 4},
+	})
+	if err != nil {
+		t.Fatalf("build IR: %v", err)
+	}
+	if got := irFunc.Operations[0].LoopRange.Accumulators; got != 4 {
+		t.Fatalf("LoopRange.Accumulators = %d, want 4", got)
+	}
+
+	fn := NewFunction("BaseSumExp")
+	fn.ElemType = "float32"
+	lr := &LoopRange{LoopVar: "i", Start: "0", End: "size", Step: "4", IsVectorized: true, VectorLanes: 4, Accumulators: 4}
+
+	expNode := fn.AddNode(OpKindElementwise, "Exp")
+	expNode.InputNames = []string{"x"}
+	expNode.Outputs = []string{"e"}
+	expNode.LoopRange = lr.Clone()
+
+	sumNode := fn.AddNode(OpKindReduction, "ReduceSum")
+	sumNode.Inputs = []*IRNode{expNode}
+	sumNode.Outputs = []string{"sum"}
+	sumNode.LoopRange = lr.Clone()
+
+	ApplyFusionRules(fn)
+
+	cCode := NewEmitter(&testProfile{lanes: 4, tier: "NEON"}).EmitFunction(fn)
+	for _, want := range []string{
+		"float32x4_t _vacc3 = vdupq_n_f32(0.0f);",
+		"long i = _i_base + 12;",
+		"_vacc3 = vaddq_f32(_vacc3, e);",
+		"_vacc = vaddq_f32(_vacc, _vacc1);",
+		"_vacc2 = vaddq_f32(_vacc2, _vacc3);",
+		"_vacc = vaddq_f32(_vacc, _vacc2);",
+	} {
+		if !strings.Contains(cCode, want) {
+			t.Errorf("generated C missing %q, got:\n%s", want, cCode)
+		}
+	}
+	// Every chain and the cleanup loop declare their own temporaries.
+	if got := strings.Count(cCode, "float32x4_t e = "); got != 5 {
+		t.Errorf("got %d declarations of e, want 5:\n%s", got, cCode)
+	}
+}
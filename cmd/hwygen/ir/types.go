@@ -229,6 +229,11 @@ type LoopRange struct {
 	// VectorLanes is the number of elements per vector iteration.
 	// 0 for scalar loops.
 	VectorLanes int
+
+	// Accumulators is the number of independent accumulator chains a
+	// reduction in this loop should use (//hwy:accumulators). 0 or 1 means
+	// a single chain.
+	Accumulators int
 }
 
 // Clone creates a deep copy of the LoopRange.
@@ -243,6 +248,7 @@ func (lr *LoopRange) Clone() *LoopRange {
 		Step:         lr.Step,
 		IsVectorized: lr.IsVectorized,
 		VectorLanes:  lr.VectorLanes,
+		Accumulators: lr.Accumulators,
 	}
 }
 
@@ -133,7 +133,7 @@ func parseTargets(s string, globalC, globalAsm bool) ([]TargetSpec, error) {
 					return nil, err
 				}
 				mode := globalMode(globalC, globalAsm)
-				result = append(result, TargetSpec{Target: selector.Target, Mode: mode})
+				result = append(result, TargetSpec{Target: withModeBuildTag(selector.Target, mode), Mode: mode})
 			}
 			return result, nil
 		}
@@ -146,7 +146,7 @@ func parseTargets(s string, globalC, globalAsm bool) ([]TargetSpec, error) {
 		if !selector.HasExplicitMode {
 			mode = globalMode(globalC, globalAsm)
 		}
-		result = append(result, TargetSpec{Target: selector.Target, Mode: mode})
+		result = append(result, TargetSpec{Target: withModeBuildTag(selector.Target, mode), Mode: mode})
 	}
 	return result, nil
 }
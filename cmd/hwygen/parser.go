@@ -56,6 +56,27 @@ type ParsedFunc struct {
 	// SIMD operations are float32 (e.g., quantized dot products).
 	ElemTypeOverride string
 
+	// KernelHandle requests a <Name>Kernel[T]() accessor next to the generic
+	// dispatcher, returning the implementation selected for T at init time.
+	// Set from //hwy:kernel directive.
+	KernelHandle bool
+
+	// MaskedTail lowers the scalar tail loop after the main SIMD loop into a
+	// single masked iteration of the loop body on AVX2 and AVX-512.
+	// Set from //hwy:maskedtail directive.
+	MaskedTail bool
+
+	// ProfileElems and ProfileBytes are Go expressions over the parameters
+	// giving the elements and bytes one call processes, for the hwyprof
+	// wrappers. Empty means derive them from the slice lengths.
+	// Set from //hwy:profile directive.
+	ProfileElems string
+	ProfileBytes string
+
+	// Fusion describes the kernels inlined into this function's body.
+	// Set from //hwy:fuse directive.
+	Fusion *FusionInfo
+
 	// SourceFile records which file this function came from.
 	SourceFile string
 }
@@ -85,6 +106,28 @@ type ElemTypeDirective struct {
 	ElemType string // Element type (e.g., "float32")
 }
 
+// KernelDirective represents a parsed //hwy:kernel directive.
+type KernelDirective struct {
+	Line int // Line number of the directive
+}
+
+// MaskedTailDirective represents a parsed //hwy:maskedtail directive.
+type MaskedTailDirective struct {
+	Line int // Line number of the directive
+}
+
+// ProfileDirective represents a parsed //hwy:profile directive.
+type ProfileDirective struct {
+	Line  int    // Line number of the directive
+	Elems string // Element count expression (e.g., "BlockSize")
+	Bytes string // Byte count expression (e.g., "16*bitWidth+4*BlockSize")
+}
+
+// FuseDirective represents a parsed //hwy:fuse directive.
+type FuseDirective struct {
+	Line int // Line number of the directive
+}
+
 // TargetsDirective represents a parsed //hwy:targets directive.
 type TargetsDirective struct {
 	Line    int              // Line number of the directive
@@ -122,6 +165,20 @@ type LoopInfo struct {
 	End        string // "size", "len(data)"
 	Stride     string // "vOne.NumElements()", "lanes", etc.
 	UnrollHint int    // Explicit unroll factor from //hwy:unroll directive (0 = auto)
+
+	// Accumulators is the number of independent accumulator chains requested
+	// by //hwy:accumulators (0 = one chain).
+	Accumulators int
+	// AccumulatorVars are the loop-carried reduction variables split across
+	// the chains. Filled in by findReductionAccumulators.
+	AccumulatorVars []AccumulatorVar
+}
+
+// AccumulatorVar is a vector reduction variable of the main loop, e.g. sum in
+// "sum = hwy.Add(sum, v)".
+type AccumulatorVar struct {
+	Name    string // "sum"
+	Combine string // hwy op that merges two chains: "Add", "Min" or "Max"
 }
 
 // TypeSpecificConst represents a constant with type-specific variants.
@@ -296,6 +353,25 @@ func Parse(filename string) (*ParseResult, error) {
 	// Parse //hwy:elemtype directives from comments
 	elemTypeDirectives := parseElemTypeDirectives(file, fset)
 
+	// Parse //hwy:kernel directives from comments
+	kernelDirectives := parseKernelDirectives(file, fset)
+
+	// Parse //hwy:maskedtail directives from comments
+	maskedTailDirectives := parseMaskedTailDirectives(file, fset)
+
+	// Parse //hwy:profile directives from comments
+	profileDirectives, err := parseProfileDirectives(file, fset)
+	if err != nil {
+		return nil, err
+	}
+
+	// Inline the stages of //hwy:fuse composites before anything looks at
+	// their bodies.
+	fusions, err := fuseComposites(file, fset, filename, result.Imports, parseFuseDirectives(file, fset))
+	if err != nil {
+		return nil, err
+	}
+
 	for _, decl := range file.Decls {
 		funcDecl, ok := decl.(*ast.FuncDecl)
 		if !ok {
@@ -316,6 +392,7 @@ func Parse(filename string) (*ParseResult, error) {
 			Body:    funcDecl.Body,
 			Doc:     funcDecl.Doc,
 			Private: isPrivateBase,
+			Fusion:  fusions[name],
 		}
 
 		// Extract type parameters
@@ -384,6 +461,26 @@ func Parse(filename string) (*ParseResult, error) {
 					pf.ElemTypeOverride = ed.ElemType
 				}
 			}
+			for _, kd := range kernelDirectives {
+				if kd.Line >= funcLine-5 && kd.Line < funcLine {
+					if !hasBasePrefix(name) || len(pf.TypeParams) != 1 {
+						return nil, fmt.Errorf("%s: //hwy:kernel applies only to Base... functions with one type parameter",
+							fset.Position(funcDecl.Pos()))
+					}
+					pf.KernelHandle = true
+				}
+			}
+			for _, md := range maskedTailDirectives {
+				if md.Line >= funcLine-5 && md.Line < funcLine {
+					pf.MaskedTail = true
+				}
+			}
+			for _, pd := range profileDirectives {
+				if pd.Line >= funcLine-5 && pd.Line < funcLine {
+					pf.ProfileElems = pd.Elems
+					pf.ProfileBytes = pd.Bytes
+				}
+			}
 		}
 		pf.SourceFile = filename
 
@@ -422,6 +519,17 @@ func Parse(filename string) (*ParseResult, error) {
 		// Detect main vectorized loop (with unroll directive support)
 		pf.LoopInfo = detectLoopWithUnroll(funcDecl.Body, fset, unrollDirectives)
 		pf.SharedLenExpr = inferSharedLenExpr(funcDecl.Body, pf.Params)
+		if pf.Fusion != nil && pf.LoopInfo != nil {
+			pf.LoopInfo.Accumulators = pf.Fusion.Accumulators
+		}
+		if err := findReductionAccumulators(funcDecl.Body, pf.LoopInfo); err != nil {
+			return nil, fmt.Errorf("%s: //hwy:accumulators: %w", fset.Position(funcDecl.Pos()), err)
+		}
+		if pf.MaskedTail {
+			if _, _, _, err := findMaskedTailLoop(funcDecl.Body, pf.LoopInfo); err != nil {
+				return nil, fmt.Errorf("%s: //hwy:maskedtail: %w", fset.Position(funcDecl.Pos()), err)
+			}
+		}
 
 		// Store ALL functions in AllFuncs for potential inlining
 		pfCopy := pf // Make a copy since pf is reused
@@ -429,10 +537,11 @@ func Parse(filename string) (*ParseResult, error) {
 
 		// Only add Base*/base* functions to Funcs for code generation
 		// Include functions that use hwy operations OR have hwy.Lanes type parameters
-		// (generic functions with hwy.Lanes need type specialization even without hwy ops)
+		// (generic functions with hwy.Lanes need type specialization even without hwy ops),
+		// and specializations, which may be plain scalar code for the fallback target.
 		if isExportedBase || isPrivateBase {
 			hasHwyLanesTypeParam := hasHwyLanesConstraint(pf.TypeParams)
-			if len(pf.HwyCalls) > 0 || hasHwyLanesTypeParam {
+			if len(pf.HwyCalls) > 0 || hasHwyLanesTypeParam || pf.SpecializesGroup != "" {
 				result.Funcs = append(result.Funcs, pf)
 			}
 		}
@@ -604,13 +713,16 @@ func findHwyCalls(node ast.Node, imports map[string]string) []HwyCall {
 	return calls
 }
 
-// UnrollDirective represents a parsed //hwy:unroll directive.
+// UnrollDirective represents a parsed //hwy:unroll or //hwy:accumulators
+// directive.
 type UnrollDirective struct {
-	Line   int // Line number of the directive
-	Factor int // Unroll factor (1 = no unroll, 0 = disable)
+	Line         int // Line number of the directive
+	Factor       int // Unroll factor (1 = no unroll, 0 = disable)
+	Accumulators int // Accumulator chains, for //hwy:accumulators
 }
 
-// parseUnrollDirectives parses //hwy:unroll N comments from the file.
+// parseUnrollDirectives parses //hwy:unroll N and //hwy:accumulators N
+// comments from the file.
 func parseUnrollDirectives(file *ast.File, fset *token.FileSet) []UnrollDirective {
 	var directives []UnrollDirective
 
@@ -628,6 +740,15 @@ func parseUnrollDirectives(file *ast.File, fset *token.FileSet) []UnrollDirectiv
 					})
 				}
 			}
+			if after, ok := strings.CutPrefix(text, "hwy:accumulators "); ok {
+				n := 0
+				if _, err := fmt.Sscanf(after, "%d", &n); err == nil {
+					directives = append(directives, UnrollDirective{
+						Line:         line,
+						Accumulators: n,
+					})
+				}
+			}
 		}
 	}
 
@@ -778,6 +899,120 @@ func parseElemTypeDirectives(file *ast.File, fset *token.FileSet) []ElemTypeDire
 	return directives
 }
 
+// parseKernelDirectives scans all comments in the file for //hwy:kernel directives.
+// Syntax: //hwy:kernel
+func parseKernelDirectives(file *ast.File, fset *token.FileSet) []KernelDirective {
+	var directives []KernelDirective
+
+	for _, cg := range file.Comments {
+		for _, c := range cg.List {
+			text := strings.TrimSpace(strings.TrimPrefix(c.Text, "//"))
+			if text != "hwy:kernel" {
+				continue
+			}
+			directives = append(directives, KernelDirective{
+				Line: fset.Position(c.Pos()).Line,
+			})
+		}
+	}
+
+	return directives
+}
+
+// parseMaskedTailDirectives scans all comments in the file for
+// //hwy:maskedtail directives.
+// Syntax: //hwy:maskedtail
+func parseMaskedTailDirectives(file *ast.File, fset *token.FileSet) []MaskedTailDirective {
+	var directives []MaskedTailDirective
+
+	for _, cg := range file.Comments {
+		for _, c := range cg.List {
+			text := strings.TrimSpace(strings.TrimPrefix(c.Text, "//"))
+			if text != "hwy:maskedtail" {
+				continue
+			}
+			directives = append(directives, MaskedTailDirective{
+				Line: fset.Position(c.Pos()).Line,
+			})
+		}
+	}
+
+	return directives
+}
+
+// parseProfileDirectives scans all comments in the file for //hwy:profile
+// directives. Each key is optional; an expression may contain spaces.
+// Syntax: //hwy:profile elems=<expr> bytes=<expr>
+func parseProfileDirectives(file *ast.File, fset *token.FileSet) ([]ProfileDirective, error) {
+	var directives []ProfileDirective
+
+	for _, cg := range file.Comments {
+		for _, c := range cg.List {
+			text := strings.TrimSpace(strings.TrimPrefix(c.Text, "//"))
+			after, ok := strings.CutPrefix(text, "hwy:profile")
+			if !ok || (after != "" && after[0] != ' ' && after[0] != '\t') {
+				continue
+			}
+			pos := fset.Position(c.Pos())
+			d := ProfileDirective{Line: pos.Line}
+			var cur *string
+			for _, field := range strings.Fields(after) {
+				key, value, found := strings.Cut(field, "=")
+				switch {
+				case found && key == "elems":
+					cur = &d.Elems
+				case found && key == "bytes":
+					cur = &d.Bytes
+				case cur != nil:
+					*cur += " " + field
+					continue
+				default:
+					return nil, fmt.Errorf("%s: //hwy:profile: want elems=<expr> and/or bytes=<expr>, got %q", pos, field)
+				}
+				if *cur != "" {
+					return nil, fmt.Errorf("%s: //hwy:profile: %s given twice", pos, key)
+				}
+				*cur = value
+			}
+			if d.Elems == "" && d.Bytes == "" {
+				return nil, fmt.Errorf("%s: //hwy:profile: want elems=<expr> and/or bytes=<expr>", pos)
+			}
+			for _, expr := range []string{d.Elems, d.Bytes} {
+				if expr == "" {
+					continue
+				}
+				if _, err := parser.ParseExpr(expr); err != nil {
+					return nil, fmt.Errorf("%s: //hwy:profile: %q: %w", pos, expr, err)
+				}
+			}
+			directives = append(directives, d)
+		}
+	}
+
+	return directives, nil
+}
+
+// parseFuseDirectives scans all comments in the file for //hwy:fuse
+// directives.
+// Syntax: //hwy:fuse
+func parseFuseDirectives(file *ast.File, fset *token.FileSet) []FuseDirective {
+	var directives []FuseDirective
+
+	for _, cg := range file.Comments {
+		for _, c := range cg.List {
+			text := strings.TrimSpace(strings.TrimPrefix(c.Text, "//"))
+			if text != "hwy:fuse" {
+				continue
+			}
+			directives = append(directives, FuseDirective{
+				Line: fset.Position(c.Pos()).Line,
+			})
+		}
+	}
+
+	return directives
+}
+
 // parseGenDirective parses a single //hwy:gen directive line and expands it
 // into a flat slice of TypeCombinations via cross-product expansion with
 // back-reference resolution.
@@ -892,7 +1127,7 @@ func cloneTypeCombination(tc TypeCombination) TypeCombination {
 }
 
 // detectLoopWithUnroll attempts to find the main vectorized loop pattern
-// and also checks for //hwy:unroll directives.
+// and also checks for //hwy:unroll and //hwy:accumulators directives.
 // Looks for: for ii := 0; ii < size; ii += stride
 // Skips auxiliary loops that only contain Store operations (like zeroing loops).
 func detectLoopWithUnroll(body *ast.BlockStmt, fset *token.FileSet, unrollDirectives []UnrollDirective) *LoopInfo {
@@ -967,14 +1202,19 @@ func detectLoopWithUnroll(body *ast.BlockStmt, fset *token.FileSet, unrollDirect
 		}
 
 		if info.Iterator != "" && info.End != "" && isSimdLoop {
-			// Check for //hwy:unroll directive on the line before the loop
+			// Check for //hwy:unroll and //hwy:accumulators directives on
+			// the lines before the loop
 			if fset != nil {
 				loopLine := fset.Position(forStmt.Pos()).Line
 				for _, ud := range unrollDirectives {
 					// Directive should be on the line immediately before the loop
-					if ud.Line == loopLine-1 || ud.Line == loopLine-2 {
+					if ud.Line != loopLine-1 && ud.Line != loopLine-2 {
+						continue
+					}
+					if ud.Accumulators > 0 {
+						info.Accumulators = ud.Accumulators
+					} else {
 						info.UnrollHint = ud.Factor
-						break
 					}
 				}
 			}
@@ -1609,10 +1849,24 @@ func scanPackageFuncs(filename string, result *ParseResult) {
 // //hwy:specializes directives. These functions are fully parsed (including
 // //hwy:gen and //hwy:targets directives) and appended to result.Funcs so the
 // generator can select them for specific (target, combo) pairs.
+//
+// Only specializations of groups whose primary is defined in filename are
+// picked up; a package with several hwygen inputs keeps each input's
+// specializations next to its own primaries.
 func scanSpecializations(filename string, result *ParseResult) error {
 	dir := filepath.Dir(filename)
 	base := filepath.Base(filename)
 
+	primaryGroups := make(map[string]bool)
+	for _, pf := range result.Funcs {
+		if pf.SpecializesGroup != "" {
+			continue
+		}
+		if name, err := deriveFuncGroupName(pf.Name); err == nil {
+			primaryGroups[name] = true
+		}
+	}
+
 	entries, err := os.ReadDir(dir)
 	if err != nil {
 		return nil
@@ -1679,6 +1933,9 @@ func scanSpecializations(filename string, result *ParseResult) error {
 			if specializesGroup == "" {
 				continue // not a specialization function
 			}
+			if !primaryGroups[specializesGroup] {
+				continue // specializes a group from another input file
+			}
 
 			// Already in Funcs from the primary file? Skip.
 			alreadyInFuncs := false
@@ -1789,6 +2046,9 @@ func scanSpecializations(filename string, result *ParseResult) error {
 			// Detect main vectorized loop
 			pf.LoopInfo = detectLoopWithUnroll(funcDecl.Body, fset, unrollDirectives)
 			pf.SharedLenExpr = inferSharedLenExpr(funcDecl.Body, pf.Params)
+			if err := findReductionAccumulators(funcDecl.Body, pf.LoopInfo); err != nil {
+				return fmt.Errorf("%s: //hwy:accumulators: %w", fset.Position(funcDecl.Pos()), err)
+			}
 
 			// Add to both AllFuncs and Funcs
 			pfCopy := pf
@@ -0,0 +1,240 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package main
+
+import (
+	"bytes"
+	"fmt"
+	"go/ast"
+	"go/parser"
+	"os"
+	"path/filepath"
+	"strings"
+)
+
+// profileBuildTag enables the kernel profiling wrappers.
+const profileBuildTag = "hwyprof"
+
+// profileGroup is one dispatch group of a profiling file.
+type profileGroup struct {
+	Name string
+	Vars []profileVar
+}
+
+// profileVar is one dispatch variable and its signature, e.g.
+// "(a []float32, b []float32) float32". Elems and Bytes come from the
+// function's //hwy:profile directive.
+type profileVar struct {
+	Name      string
+	Signature string
+	Elems     string
+	Bytes     string
+}
+
+// emitProfileFile writes <prefix>_hwyprof.gen.go, which wraps every dispatch
+// variable with hwy kernel counters. It is built only with -tags hwyprof.
+// dispatchTags are the build tags of the dispatch files declaring the
+// variables; the profiling file must not build where none of them does.
+func emitProfileFile(funcs []ParsedFunc, pkgName, outPath, prefix string, useCustomPrefix bool, dispatchTags []string) error {
+	dispatchableFuncs := filterDispatchableFuncs(funcs)
+	if len(dispatchableFuncs) == 0 {
+		return nil
+	}
+
+	var groups []profileGroup
+	for _, pf := range dispatchableFuncs {
+		g := profileGroup{Name: buildGenericFuncName(pf.Name, pf.Private)}
+		for _, dc := range getDispatchCombos(pf) {
+			typeMap := dc.Combo.Types
+			if len(typeMap) <= 1 {
+				typeMap = nil
+			}
+			g.Vars = append(g.Vars, profileVar{
+				Name:      dc.DispatchName,
+				Signature: buildFuncSignatureWithMap(pf, dc.ElemType, typeMap),
+				Elems:     pf.ProfileElems,
+				Bytes:     pf.ProfileBytes,
+			})
+		}
+		groups = append(groups, g)
+	}
+
+	src, err := profileFileSource(pkgName, profileFileBuildTag(dispatchTags), groups)
+	if err != nil {
+		return err
+	}
+
+	filePrefix := "dispatch_"
+	if useCustomPrefix {
+		filePrefix = ""
+	}
+	filename := filepath.Join(outPath, fmt.Sprintf("%s%s_hwyprof.gen.go", filePrefix, prefix))
+
+	formatted, err := formatAndFixImports(filename, src)
+	if err != nil {
+		fmt.Fprintf(os.Stderr, "Warning: formatting failed: %v\n", err)
+		formatted = src
+	}
+	if err := os.WriteFile(filename, formatted, 0644); err != nil {
+		return fmt.Errorf("write profiling wrappers: %w", err)
+	}
+	return nil
+}
+
+// profileFileBuildTag combines the hwyprof tag with the dispatch files' tags.
+// An empty tag means a dispatch file builds everywhere.
+func profileFileBuildTag(dispatchTags []string) string {
+	var alts []string
+	for _, tag := range dispatchTags {
+		if tag == "" {
+			return profileBuildTag
+		}
+		if strings.ContainsAny(tag, " &|") {
+			tag = "(" + tag + ")"
+		}
+		alts = append(alts, tag)
+	}
+	if len(alts) == 1 {
+		return profileBuildTag + " && " + alts[0]
+	}
+	return profileBuildTag + " && (" + strings.Join(alts, " || ") + ")"
+}
+
+// profileFileSource returns the unformatted profiling file:
+//
+//	func init() {
+//		hwy.ProfileDispatch("vec", "Dot", func(hwyCounter *hwy.KernelCounter) {
+//			if hwyImpl := DotFloat32; hwyImpl != nil {
+//				DotFloat32 = func(a []float32, b []float32) float32 {
+//					hwyStart := hwyCounter.Start()
+//					hwyR0 := hwyImpl(a, b)
+//					hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+//					return hwyR0
+//				}
+//			}
+//		})
+//	}
+//
+// The hwy-prefixed names keep clear of kernel parameter names.
+func profileFileSource(pkgName, buildTag string, groups []profileGroup) ([]byte, error) {
+	var buf bytes.Buffer
+	fmt.Fprintf(&buf, HeaderNote)
+	fmt.Fprintf(&buf, "//go:build %s\n", buildTag)
+	fmt.Fprintf(&buf, "\npackage %s\n\n", pkgName)
+	fmt.Fprintf(&buf, "import (\n\t\"github.com/ajroetker/go-highway/hwy\"\n)\n\n")
+
+	fmt.Fprintf(&buf, "func init() {\n")
+	for _, g := range groups {
+		fmt.Fprintf(&buf, "\thwy.ProfileDispatch(%q, %q, func(hwyCounter *hwy.KernelCounter) {\n", pkgName, g.Name)
+		for _, v := range g.Vars {
+			if err := emitProfileWrapper(&buf, v); err != nil {
+				return nil, err
+			}
+		}
+		fmt.Fprintf(&buf, "\t})\n")
+	}
+	fmt.Fprintf(&buf, "}\n")
+	return buf.Bytes(), nil
+}
+
+// emitProfileWrapper emits the wrapper of one dispatch variable. Unless the
+// //hwy:profile directive declares them, elements are the length of the
+// first slice argument and bytes are the sizes of all slice arguments.
+// Slices of slices are not counted.
+func emitProfileWrapper(buf *bytes.Buffer, v profileVar) error {
+	src := "func" + v.Signature
+	expr, err := parser.ParseExpr(src)
+	if err != nil {
+		return fmt.Errorf("profiling wrapper for %s: %w", v.Name, err)
+	}
+	ft, ok := expr.(*ast.FuncType)
+	if !ok {
+		return fmt.Errorf("profiling wrapper for %s: %q is not a function type", v.Name, v.Signature)
+	}
+	text := func(n ast.Node) string {
+		return src[n.Pos()-1 : n.End()-1]
+	}
+
+	var params, args, byteTerms []string
+	elems := "0"
+	for _, field := range ft.Params.List {
+		names := field.Names
+		if len(names) == 0 {
+			names = []*ast.Ident{nil}
+		}
+		for _, ident := range names {
+			name := fmt.Sprintf("hwyP%d", len(params))
+			if ident != nil && ident.Name != "_" {
+				name = ident.Name
+			}
+			params = append(params, name+" "+text(field.Type))
+			if _, variadic := field.Type.(*ast.Ellipsis); variadic {
+				args = append(args, name+"...")
+				continue
+			}
+			args = append(args, name)
+			if at, ok := field.Type.(*ast.ArrayType); ok && at.Len == nil {
+				if inner, ok := at.Elt.(*ast.ArrayType); ok && inner.Len == nil {
+					continue
+				}
+				if elems == "0" {
+					elems = "len(" + name + ")"
+				}
+				byteTerms = append(byteTerms, "hwy.SliceBytes("+name+")")
+			}
+		}
+	}
+	bytesExpr := "0"
+	if len(byteTerms) > 0 {
+		bytesExpr = strings.Join(byteTerms, "+")
+	}
+	if v.Elems != "" {
+		elems = v.Elems
+	}
+	if v.Bytes != "" {
+		bytesExpr = v.Bytes
+	}
+
+	var results []string
+	if ft.Results != nil {
+		for _, field := range ft.Results.List {
+			n := max(len(field.Names), 1)
+			for range n {
+				results = append(results, fmt.Sprintf("hwyR%d", len(results)))
+			}
+		}
+	}
+	resultType := ""
+	if ft.Results != nil {
+		resultType = " " + text(ft.Results)
+	}
+
+	fmt.Fprintf(buf, "\t\tif hwyImpl := %s; hwyImpl != nil {\n", v.Name)
+	fmt.Fprintf(buf, "\t\t\t%s = func(%s)%s {\n", v.Name, strings.Join(params, ", "), resultType)
+	fmt.Fprintf(buf, "\t\t\t\thwyStart := hwyCounter.Start()\n")
+	call := fmt.Sprintf("hwyImpl(%s)", strings.Join(args, ", "))
+	if len(results) > 0 {
+		fmt.Fprintf(buf, "\t\t\t\t%s := %s\n", strings.Join(results, ", "), call)
+	} else {
+		fmt.Fprintf(buf, "\t\t\t\t%s\n", call)
+	}
+	fmt.Fprintf(buf, "\t\t\t\thwyCounter.Done(hwyStart, %s, %s)\n", elems, bytesExpr)
+	if len(results) > 0 {
+		fmt.Fprintf(buf, "\t\t\t\treturn %s\n", strings.Join(results, ", "))
+	}
+	fmt.Fprintf(buf, "\t\t\t}\n")
+	fmt.Fprintf(buf, "\t\t}\n")
+	return nil
+}
@@ -17,6 +17,7 @@ package main
 import (
 	"go/ast"
 	"go/token"
+	"slices"
 	"strings"
 )
 
@@ -434,6 +435,114 @@ func scalarizeFallback(funcDecl *ast.FuncDecl, elemType string) {
 	funcDecl.Body.List = scalarizeStmts(funcDecl.Body.List, elemType)
 }
 
+// splitScalarAccumulators gives the scalarized main loop the
+// //hwy:accumulators chains of the SIMD targets, so the fallback does not
+// wait on one add latency per element. With //hwy:accumulators 2,
+//
+//	for i = 0; i < len(v); i++ {
+//		sum = sum + v[i]
+//	}
+//
+// becomes
+//
+//	sum1 := float32(0)
+//	for i = 0; i+2 <= len(v); i += 2 {
+//		sum = sum + v[i]
+//		sum1 = sum1 + v[i+1]
+//	}
+//	sum = sum + sum1
+//
+// An explicit tail loop over the same iterator picks up the last N-1
+// elements; otherwise the original loop follows as cleanup. The loop is left
+// alone unless it has that shape and uses its iterator only as an index.
+func splitScalarAccumulators(body *ast.BlockStmt, loopInfo *LoopInfo, elemType string) {
+	if loopInfo == nil || loopInfo.Accumulators <= 1 || len(loopInfo.AccumulatorVars) == 0 {
+		return
+	}
+	n, it := loopInfo.Accumulators, loopInfo.Iterator
+	loop := findMainSimdLoop(body, loopInfo)
+	if loop == nil {
+		return
+	}
+	cond, ok := loop.Cond.(*ast.BinaryExpr)
+	if !ok || cond.Op != token.LSS || exprToString(cond.X) != it {
+		return
+	}
+	if post, ok := loop.Post.(*ast.IncDecStmt); !ok || post.Tok != token.INC || exprToString(post.X) != it {
+		return
+	}
+	if init, ok := loop.Init.(*ast.AssignStmt); ok && init.Tok == token.DEFINE {
+		return
+	}
+	if !usesIteratorOnlyAsIndex(loop.Body, it) {
+		return
+	}
+
+	var cleanup *ast.ForStmt
+	if !hasExplicitTailLoop(body, loop, it) {
+		cleanup = &ast.ForStmt{
+			Cond: cloneExpr(loop.Cond),
+			Post: cloneStmt(loop.Post),
+			Body: cloneStmt(loop.Body).(*ast.BlockStmt),
+		}
+	}
+
+	// i < n; i++  ->  i+1 <= n; i += 1, which unrollLoop scales by N.
+	loop.Cond = &ast.BinaryExpr{
+		X:  &ast.BinaryExpr{X: ast.NewIdent(it), Op: token.ADD, Y: &ast.BasicLit{Kind: token.INT, Value: "1"}},
+		Op: token.LEQ,
+		Y:  cond.Y,
+	}
+	loop.Post = &ast.AssignStmt{
+		Lhs: []ast.Expr{ast.NewIdent(it)},
+		Tok: token.ADD_ASSIGN,
+		Rhs: []ast.Expr{&ast.BasicLit{Kind: token.INT, Value: "1"}},
+	}
+	unrollLoop(loop, loopInfo, n, 1)
+	splitAccumulators(body, loop, loopInfo, n, nil)
+
+	// The merges come out as hwy.Add(sum, sum1) and friends; lower them
+	// like the rest of the body.
+	for i, stmt := range body.List {
+		if stmt != loop {
+			continue
+		}
+		merges := len(loopInfo.AccumulatorVars) * (n - 1)
+		tail := slices.Clone(body.List[i+1+merges:])
+		list := append(body.List[:i+1:i+1], scalarizeStmts(body.List[i+1:i+1+merges], elemType)...)
+		if cleanup != nil {
+			list = append(list, cleanup)
+		}
+		body.List = append(list, tail...)
+		return
+	}
+}
+
+// usesIteratorOnlyAsIndex reports whether every use of it in body is the
+// whole index of an index expression or the low bound of a slice
+// expression, the positions unrollLoop offsets.
+func usesIteratorOnlyAsIndex(body *ast.BlockStmt, it string) bool {
+	indexUses, uses := 0, 0
+	ast.Inspect(body, func(n ast.Node) bool {
+		switch node := n.(type) {
+		case *ast.IndexExpr:
+			if exprToString(node.Index) == it {
+				indexUses++
+			}
+		case *ast.SliceExpr:
+			if node.Low != nil && exprToString(node.Low) == it {
+				indexUses++
+			}
+		case *ast.Ident:
+			if node.Name == it {
+				uses++
+			}
+		}
+		return true
+	})
+	return uses == indexUses
+}
+
 // scalarizeStmts transforms a list of statements to use scalar operations.
 func scalarizeStmts(stmts []ast.Stmt, elemType string) []ast.Stmt {
 	var result []ast.Stmt
@@ -76,6 +76,17 @@ func (m TargetMode) String() string {
 	}
 }
 
+// withModeBuildTag adjusts a target's build tag for its generation mode.
+// x86 asm targets are compiled by GoAT and never touch archsimd, so their
+// files build on every amd64 toolchain instead of only under
+// GOEXPERIMENT=simd.
+func withModeBuildTag(t Target, mode TargetMode) Target {
+	if mode == TargetModeAsm && t.BuildTag == amd64SimdBuildTag {
+		t.BuildTag = "amd64"
+	}
+	return t
+}
+
 // parseTargetSelector parses a target selector like "neon" or "neon:asm".
 func parseTargetSelector(spec string) (TargetSelector, error) {
 	raw := strings.TrimSpace(strings.ToLower(spec))
@@ -280,6 +291,11 @@ func armBaseOps(targetName string, f32Lanes, f64Lanes string) map[string]OpInfo
 		// Shuffle
 		"TableLookupBytes": {Name: "TableLookupBytes", IsMethod: true},
 
+		// Saturating arithmetic and byte widening (UQADD, UXTL/UXTL2)
+		"SaturatedAdd":        {Name: "AddSaturated", IsMethod: true},
+		"PromoteLowerU8ToU16": {Name: "PromoteLowerToUint16", IsMethod: true},
+		"PromoteUpperU8ToU16": {Name: "PromoteUpperToUint16", IsMethod: true},
+
 		// Core math
 		"Sqrt":               {Name: "Sqrt", IsMethod: true},
 		"RSqrt":              {Name: "ReciprocalSqrt", IsMethod: true},
@@ -410,8 +426,8 @@ func avxBaseOps(targetName string, f32Lanes, f64Lanes string) map[string]OpInfo
 		"Set":        {Name: "Broadcast", IsMethod: false},
 		"Const":      {Name: "Broadcast", IsMethod: false},
 		"Zero":       {Package: "special", Name: "Zero", IsMethod: false},
-		"MaskLoad":   {Name: "MaskLoad", IsMethod: false},
-		"MaskStore":  {Name: "MaskStore", IsMethod: true},
+		"MaskLoad":   {Package: "hwy", Name: "MaskLoad", IsMethod: false},
+		"MaskStore":  {Package: "hwy", Name: "MaskStore", IsMethod: false},
 
 		// Arithmetic
 		"Add": {Name: "Add", IsMethod: true},
@@ -433,6 +449,11 @@ func avxBaseOps(targetName string, f32Lanes, f64Lanes string) map[string]OpInfo
 		// Shuffle
 		"TableLookupBytes": {Package: "hwy", Name: "TableLookupBytes", IsMethod: false},
 
+		// Saturating arithmetic (VPADDUS*) and byte widening (PSHUFB with zeroing indices)
+		"SaturatedAdd":        {Name: "AddSaturated", IsMethod: true},
+		"PromoteLowerU8ToU16": {Package: "hwy", Name: "PromoteLowerU8ToU16", IsMethod: false},
+		"PromoteUpperU8ToU16": {Package: "hwy", Name: "PromoteUpperU8ToU16", IsMethod: false},
+
 		// Core math
 		"Sqrt":               {Name: "Sqrt", IsMethod: true},
 		"RSqrt":              {Name: "ReciprocalSqrt", IsMethod: true},
@@ -713,6 +734,11 @@ func FallbackTarget() Target {
 		// Shuffle
 		"TableLookupBytes": {Package: "hwy", Name: "TableLookupBytes", IsMethod: false},
 
+		// Saturating arithmetic and byte widening
+		"SaturatedAdd":        {Package: "hwy", Name: "SaturatedAdd", IsMethod: false},
+		"PromoteLowerU8ToU16": {Package: "hwy", Name: "PromoteLowerU8ToU16", IsMethod: false},
+		"PromoteUpperU8ToU16": {Package: "hwy", Name: "PromoteUpperU8ToU16", IsMethod: false},
+
 		// Core math
 		"Sqrt":               {Package: "hwy", Name: "Sqrt", IsMethod: false},
 		"RSqrt":              {Package: "hwy", Name: "RSqrt", IsMethod: false},
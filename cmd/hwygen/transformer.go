@@ -161,6 +161,13 @@ func TransformWithOptions(pf *ParsedFunc, target Target, elemType string, opts *
 		}
 	}
 
+	// Lower the scalar tail loop into one masked iteration (//hwy:maskedtail).
+	// The parser validated the loop; if a conditional block removed it, the
+	// scalar tail is kept and handled by insertTailHandling as usual.
+	if pf.MaskedTail && target.IsAVX() && maskedTailElemTypes[elemType] {
+		_ = insertMaskedTail(funcDecl.Body, pf.LoopInfo, elemType)
+	}
+
 	// Collect all locally-defined variable names to avoid hoisting them as constants
 	collectLocalVariables(funcDecl.Body, ctx)
 
@@ -196,6 +203,7 @@ func TransformWithOptions(pf *ParsedFunc, target Target, elemType string, opts *
 	if target.IsFallback() && !isHalfPrecisionType(elemType) {
 		if canScalarizeFallback(funcDecl) {
 			scalarizeFallback(funcDecl, elemType)
+			splitScalarAccumulators(funcDecl.Body, pf.LoopInfo, elemType)
 			wasScalarized = true
 		}
 	}
@@ -236,6 +244,7 @@ func TransformWithOptions(pf *ParsedFunc, target Target, elemType string, opts *
 			// Find the main SIMD loop and unroll it
 			if mainLoop := findMainSimdLoop(funcDecl.Body, pf.LoopInfo); mainLoop != nil {
 				unrollLoopWithCleanup(funcDecl.Body, mainLoop, pf.LoopInfo, unrollFactor, lanes)
+				splitAccumulators(funcDecl.Body, mainLoop, pf.LoopInfo, unrollFactor, ctx)
 			}
 		}
 	}
@@ -404,8 +413,9 @@ func inferVecLanesFromLoad(expr ast.Expr, ctx *transformContext) vecLoadInfo {
 		return vecLoadInfo{}
 	}
 
-	sliceBytes := getSliceSize(call.Args[0])
-	if sliceBytes <= 0 {
+	// The slice length is in elements: s[:4] of uint32 is a 4-lane load.
+	sliceLanes := getSliceSize(call.Args[0])
+	if sliceLanes <= 0 {
 		return vecLoadInfo{}
 	}
 
@@ -427,7 +437,7 @@ func inferVecLanesFromLoad(expr ast.Expr, ctx *transformContext) vecLoadInfo {
 	}
 
 	return vecLoadInfo{
-		lanes:    sliceBytes / elemSize,
+		lanes:    sliceLanes,
 		elemType: returnElemType,
 	}
 }
@@ -1426,12 +1436,18 @@ func findMaxLoadSizeForElemType(body *ast.BlockStmt, elemType string) int {
 		if !ok {
 			return true
 		}
-		// Check for hwy.Load[T](slice) pattern
-		indexExpr, ok := call.Fun.(*ast.IndexExpr)
-		if !ok {
-			return true
+		// Check for hwy.LoadSlice[T](slice) pattern, or hwy.LoadSlice(slice)
+		// which loads the function's element type
+		fun := call.Fun
+		if indexExpr, ok := fun.(*ast.IndexExpr); ok {
+			// Check type parameter matches
+			typeIdent, ok := indexExpr.Index.(*ast.Ident)
+			if !ok || typeIdent.Name != elemType {
+				return true
+			}
+			fun = indexExpr.X
 		}
-		selExpr, ok := indexExpr.X.(*ast.SelectorExpr)
+		selExpr, ok := fun.(*ast.SelectorExpr)
 		if !ok {
 			return true
 		}
@@ -1439,11 +1455,6 @@ func findMaxLoadSizeForElemType(body *ast.BlockStmt, elemType string) int {
 		if !ok || ident.Name != "hwy" || selExpr.Sel.Name != "LoadSlice" {
 			return true
 		}
-		// Check type parameter matches
-		typeIdent, ok := indexExpr.Index.(*ast.Ident)
-		if !ok || typeIdent.Name != elemType {
-			return true
-		}
 		// Get slice size from argument
 		if len(call.Args) == 1 {
 			if size := getSliceSize(call.Args[0]); size > 0 && size > maxSize {
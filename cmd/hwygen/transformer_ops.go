@@ -1117,6 +1117,14 @@ func transformToFunction(call *ast.CallExpr, funcName string, opInfo OpInfo, ctx
 	}
 	vecTypeName := getVectorTypeName(effectiveElemType, ctx.target)
 	pkgName := ctx.vecPkgName
+	// Broadcasts must match the width of sized loads such as
+	// hwy.LoadSlice(s[:4]), like hoisted constants do.
+	switch funcName {
+	case "Set", "Const", "Zero":
+		if targetLanes := ctx.target.LanesFor(effectiveElemType); ctx.inferredFuncLanes > 0 && ctx.inferredFuncLanes < targetLanes {
+			vecTypeName = getVectorTypeNameForLanes(effectiveElemType, ctx.inferredFuncLanes)
+		}
+	}
 
 	// Check if this op should be redirected to hwy wrappers (archsimd doesn't have it)
 	if opInfo.Package == "hwy" && opInfo.SubPackage == "" {
@@ -1163,11 +1171,10 @@ func transformToFunction(call *ast.CallExpr, funcName string, opInfo OpInfo, ctx
 		// For example, hwy.LoadSlice(data[:16]) with uint8 should use Uint8x16, not Uint8x32
 		loadVecTypeName := vecTypeName
 		if len(call.Args) > 0 {
-			sliceBytes := getSliceSize(call.Args[0])
-			elemSize := elemTypeSize(effectiveElemType)
+			// The slice length is in elements: s[:4] of uint32 is a 4-lane load.
+			detectedLanes := getSliceSize(call.Args[0])
 			targetLanes := ctx.target.LanesFor(effectiveElemType)
-			if sliceBytes > 0 && elemSize > 0 {
-				detectedLanes := sliceBytes / elemSize
+			if detectedLanes > 0 {
 				// Only use smaller type if detected lanes is less than target default
 				// and is a valid vector size (power of 2, typically 2, 4, 8, 16, 32, 64)
 				if detectedLanes < targetLanes && detectedLanes > 0 {
@@ -17,8 +17,10 @@ package main
 import (
 	"fmt"
 	"go/ast"
+	"go/parser"
 	"go/token"
 	"maps"
+	"slices"
 	"strconv"
 	"strings"
 )
@@ -120,6 +122,10 @@ func computeUnrollFactor(loopInfo *LoopInfo, hwyCalls []HwyCall, target Target)
 	if loopInfo.UnrollHint > 0 {
 		return loopInfo.UnrollHint
 	}
+	// //hwy:accumulators N needs one body copy per chain
+	if loopInfo.Accumulators > 1 && loopInfo.UnrollHint == 0 {
+		return loopInfo.Accumulators
+	}
 	// //hwy:unroll 0 or //hwy:unroll 1 disables unrolling
 	if loopInfo.UnrollHint == 0 {
 		// No directive - use automatic heuristics
@@ -174,7 +180,9 @@ func unrollLoopWithCleanup(body *ast.BlockStmt, forStmt *ast.ForStmt, loopInfo *
 
 	// Check if there's already a tail loop after the main loop (explicit tail handling).
 	// If so, the cleanup loop is unnecessary since the existing tail loop handles all remaining elements.
-	needsCleanupLoop := !hasExplicitTailLoop(body, forStmt, loopInfo.Iterator)
+	// Split accumulators keep it anyway: their unroll factor is chosen for
+	// latency, and leaving up to N-1 vectors to a scalar tail would undo it.
+	needsCleanupLoop := loopInfo.Accumulators > 1 || !hasExplicitTailLoop(body, forStmt, loopInfo.Iterator)
 
 	// Clone the original loop body before unrolling (for the cleanup loop)
 	var origBodyClone []ast.Stmt
@@ -270,6 +278,270 @@ func hasExplicitTailLoop(body *ast.BlockStmt, mainLoop *ast.ForStmt, iterator st
 	return false
 }
 
+// maxAccumulators bounds //hwy:accumulators; more chains than this spill
+// vector registers on every target.
+const maxAccumulators = 8
+
+// findReductionAccumulators validates the //hwy:accumulators directive of the
+// main loop and records its reduction variables in loopInfo. The loop may
+// update variables declared outside it only as reductions:
+//
+//	sum = hwy.Add(sum, v)      // or hwy.Add(v, sum)
+//	sum = hwy.MulAdd(a, b, sum)
+//	m = hwy.Max(m, v)          // or hwy.Min
+//
+// Add and MulAdd chains must start from hwy.Zero so the extra chains can
+// start from zero as well; Min and Max chains start from a copy.
+func findReductionAccumulators(body *ast.BlockStmt, loopInfo *LoopInfo) error {
+	if loopInfo == nil || loopInfo.Accumulators == 0 {
+		return nil
+	}
+	n := loopInfo.Accumulators
+	if n < 1 || n > maxAccumulators {
+		return fmt.Errorf("accumulator count %d is outside 1..%d", n, maxAccumulators)
+	}
+	if loopInfo.UnrollHint > 1 && loopInfo.UnrollHint%n != 0 {
+		return fmt.Errorf("//hwy:unroll %d is not a multiple of %d accumulators", loopInfo.UnrollHint, n)
+	}
+	if n == 1 {
+		return nil
+	}
+	it := loopInfo.Iterator
+	loop := findMainSimdLoop(body, loopInfo)
+	if loop == nil {
+		return fmt.Errorf("no SIMD loop over %s found", it)
+	}
+
+	declared := collectDeclaredVars(loop.Body.List)
+	var accs []AccumulatorVar
+	seen := make(map[string]bool)
+	for _, stmt := range loop.Body.List {
+		assign, ok := stmt.(*ast.AssignStmt)
+		if !ok || assign.Tok != token.ASSIGN || len(assign.Lhs) != 1 || len(assign.Rhs) != 1 {
+			continue
+		}
+		lhs, ok := assign.Lhs[0].(*ast.Ident)
+		if !ok || lhs.Name == "_" || lhs.Name == it || declared[lhs.Name] {
+			continue
+		}
+		combine, ok := reductionCombine(assign.Rhs[0], lhs.Name)
+		if !ok {
+			return fmt.Errorf("%s is updated in the loop, but not as an Add, MulAdd, Min or Max reduction", lhs.Name)
+		}
+		if seen[lhs.Name] {
+			return fmt.Errorf("%s is updated more than once per iteration", lhs.Name)
+		}
+		seen[lhs.Name] = true
+		accs = append(accs, AccumulatorVar{Name: lhs.Name, Combine: combine})
+	}
+	if len(accs) == 0 {
+		return fmt.Errorf("the SIMD loop over %s has no reduction to split", it)
+	}
+
+	for _, acc := range accs {
+		// The reduction itself names the accumulator twice; any other use
+		// would see a partial result.
+		uses := 0
+		ast.Inspect(loop.Body, func(n ast.Node) bool {
+			if ident, ok := n.(*ast.Ident); ok && ident.Name == acc.Name {
+				uses++
+			}
+			return true
+		})
+		if uses != 2 {
+			return fmt.Errorf("%s is used in the loop outside its reduction", acc.Name)
+		}
+		if acc.Combine == "Add" && !startsFromZero(body, acc.Name) {
+			return fmt.Errorf("%s must be declared as %s := hwy.Zero[T]()", acc.Name, acc.Name)
+		}
+	}
+	loopInfo.AccumulatorVars = accs
+	return nil
+}
+
+// reductionCombine reports whether rhs reduces into acc, and the hwy op that
+// merges two of its chains.
+func reductionCombine(rhs ast.Expr, acc string) (string, bool) {
+	call, ok := rhs.(*ast.CallExpr)
+	if !ok {
+		return "", false
+	}
+	isAcc := func(e ast.Expr) bool {
+		ident, ok := e.(*ast.Ident)
+		return ok && ident.Name == acc
+	}
+	switch op := hwyFuncName(call.Fun); op {
+	case "Add", "Min", "Max":
+		if len(call.Args) != 2 {
+			return "", false
+		}
+		x, y := call.Args[0], call.Args[1]
+		if isAcc(x) && !referencesIdent(y, acc) || isAcc(y) && !referencesIdent(x, acc) {
+			return op, true
+		}
+	case "MulAdd":
+		if len(call.Args) == 3 && isAcc(call.Args[2]) &&
+			!referencesIdent(call.Args[0], acc) && !referencesIdent(call.Args[1], acc) {
+			return "Add", true
+		}
+	}
+	return "", false
+}
+
+// startsFromZero reports whether the function body declares name as
+// hwy.Zero[T]().
+func startsFromZero(body *ast.BlockStmt, name string) bool {
+	value := definedValue(body.List, name)
+	call, ok := value.(*ast.CallExpr)
+	return ok && len(call.Args) == 0 && hwyFuncName(call.Fun) == "Zero"
+}
+
+// definedValue returns the initial value of a top-level "name := value" or
+// "var name = value" among stmts, or nil.
+func definedValue(stmts []ast.Stmt, name string) ast.Expr {
+	for _, stmt := range stmts {
+		switch s := stmt.(type) {
+		case *ast.AssignStmt:
+			if s.Tok != token.DEFINE || len(s.Lhs) != 1 || len(s.Rhs) != 1 {
+				continue
+			}
+			if ident, ok := s.Lhs[0].(*ast.Ident); ok && ident.Name == name {
+				return s.Rhs[0]
+			}
+		case *ast.DeclStmt:
+			gen, ok := s.Decl.(*ast.GenDecl)
+			if !ok || gen.Tok != token.VAR {
+				continue
+			}
+			for _, spec := range gen.Specs {
+				vs, ok := spec.(*ast.ValueSpec)
+				if ok && len(vs.Names) == 1 && vs.Names[0].Name == name && len(vs.Values) == 1 {
+					return vs.Values[0]
+				}
+			}
+		}
+	}
+	return nil
+}
+
+// splitAccumulators gives each reduction variable of an unrolled main loop
+// independent chains, so that body copies no longer wait on each other's
+// add or FMA latency. Copy u of the body (see unrollLoop) updates chain
+// u%N; chains 1..N-1 are declared before the loop and merged pairwise after
+// it:
+//
+//	sum1 := archsimd.BroadcastFloat32x8(0)
+//	for ... {
+//		sum = sum.Add(va)
+//		sum1 = sum1.Add(va1)
+//	}
+//	sum = sum.Add(sum1)
+//
+// The merges are lowered through ctx; with a nil ctx (the C translator) they
+// stay in hwy form.
+func splitAccumulators(body *ast.BlockStmt, loop *ast.ForStmt, loopInfo *LoopInfo, unrollFactor int, ctx *transformContext) {
+	n := loopInfo.Accumulators
+	if n <= 1 || unrollFactor%n != 0 || len(loopInfo.AccumulatorVars) == 0 {
+		return
+	}
+	loopIdx := -1
+	for i, stmt := range body.List {
+		if stmt == loop {
+			loopIdx = i
+		}
+	}
+	if loopIdx < 0 {
+		return
+	}
+
+	used := make(map[string]bool)
+	ast.Inspect(body, func(n ast.Node) bool {
+		if ident, ok := n.(*ast.Ident); ok {
+			used[ident.Name] = true
+		}
+		return true
+	})
+
+	// Resolve every chain before rewriting anything.
+	inits := make([]ast.Expr, len(loopInfo.AccumulatorVars))
+	names := make([][]string, len(loopInfo.AccumulatorVars))
+	for a, acc := range loopInfo.AccumulatorVars {
+		inits[a] = ast.NewIdent(acc.Name)
+		if acc.Combine == "Add" {
+			if inits[a] = definedValue(body.List[:loopIdx], acc.Name); inits[a] == nil {
+				return
+			}
+		}
+		names[a] = []string{acc.Name}
+		for k := 1; k < n; k++ {
+			name := fmt.Sprintf("%s%d", acc.Name, k)
+			for i := 2; used[name]; i++ {
+				name = fmt.Sprintf("%s%d_%d", acc.Name, k, i)
+			}
+			used[name] = true
+			names[a] = append(names[a], name)
+		}
+	}
+
+	copyLen := len(loop.Body.List) / unrollFactor
+	for u := range unrollFactor {
+		k := u % n
+		if k == 0 {
+			continue
+		}
+		for _, stmt := range loop.Body.List[u*copyLen : (u+1)*copyLen] {
+			ast.Inspect(stmt, func(node ast.Node) bool {
+				if ident, ok := node.(*ast.Ident); ok {
+					for a, acc := range loopInfo.AccumulatorVars {
+						if ident.Name == acc.Name {
+							ident.Name = names[a][k]
+						}
+					}
+				}
+				return true
+			})
+		}
+	}
+
+	var decls, merges []ast.Stmt
+	for a, acc := range loopInfo.AccumulatorVars {
+		for k := 1; k < n; k++ {
+			decls = append(decls, &ast.AssignStmt{
+				Lhs: []ast.Expr{ast.NewIdent(names[a][k])},
+				Tok: token.DEFINE,
+				Rhs: []ast.Expr{cloneExpr(inits[a])},
+			})
+		}
+		// Tree merge: (0,1) (2,3) ... then (0,2) ... keeps the merge depth
+		// at log2(N).
+		for step := 1; step < n; step *= 2 {
+			for k := 0; k+step < n; k += 2 * step {
+				dst, src := names[a][k], names[a][k+step]
+				call := &ast.CallExpr{
+					Fun:  &ast.SelectorExpr{X: ast.NewIdent("hwy"), Sel: ast.NewIdent(acc.Combine)},
+					Args: []ast.Expr{ast.NewIdent(dst), ast.NewIdent(src)},
+				}
+				if ctx != nil {
+					transformCallExpr(call, ctx)
+				}
+				merges = append(merges, &ast.AssignStmt{
+					Lhs: []ast.Expr{ast.NewIdent(dst)},
+					Tok: token.ASSIGN,
+					Rhs: []ast.Expr{call},
+				})
+			}
+		}
+	}
+
+	newList := make([]ast.Stmt, 0, len(body.List)+len(decls)+len(merges))
+	newList = append(newList, body.List[:loopIdx]...)
+	newList = append(newList, decls...)
+	newList = append(newList, loop)
+	newList = append(newList, merges...)
+	newList = append(newList, body.List[loopIdx+1:]...)
+	body.List = newList
+}
+
 // unrollLoop applies loop unrolling to a for loop, creating N copies of the body.
 // It modifies the loop in place:
 // - Multiplies the stride by unrollFactor
@@ -435,6 +707,10 @@ func findMainSimdLoop(body *ast.BlockStmt, loopInfo *LoopInfo) *ast.ForStmt {
 		return nil
 	}
 
+	// Prefer the loop loopInfo was taken from: when an earlier loop over the
+	// same iterator strides by something other than lanes (a Load4 block,
+	// say), loopInfo describes the later lanes-strided loop.
+	var first *ast.ForStmt
 	for _, stmt := range body.List {
 		forStmt, ok := stmt.(*ast.ForStmt)
 		if !ok {
@@ -442,12 +718,19 @@ func findMainSimdLoop(body *ast.BlockStmt, loopInfo *LoopInfo) *ast.ForStmt {
 		}
 
 		// Check if this loop's iterator matches loopInfo.Iterator
-		if matchesLoopIterator(forStmt, loopInfo.Iterator) {
+		if !matchesLoopIterator(forStmt, loopInfo.Iterator) {
+			continue
+		}
+		if post, ok := forStmt.Post.(*ast.AssignStmt); ok && len(post.Rhs) == 1 &&
+			exprToString(post.Rhs[0]) == loopInfo.Stride {
 			return forStmt
 		}
+		if first == nil {
+			first = forStmt
+		}
 	}
 
-	return nil
+	return first
 }
 
 
@@ -638,6 +921,235 @@ func insertTailHandling(body *ast.BlockStmt, loopInfo *LoopInfo, elemType string
 	body.List = newStmts
 }
 
+// maskedTailElemTypes are the element types //hwy:maskedtail lowers: the
+// ones AVX2 can load and store under a mask (VMASKMOV/VPMASKMOV). AVX-512
+// uses k-masks for the same types.
+var maskedTailElemTypes = map[string]bool{
+	"float32": true, "float64": true,
+	"int32": true, "int64": true,
+	"uint32": true, "uint64": true,
+}
+
+// findMaskedTailLoop locates the main SIMD loop of a //hwy:maskedtail
+// function and the scalar tail loop "for ; i < n; i++" that finishes it,
+// returning their indices in body and the accumulators the SIMD loop body
+// updates. Statements between the two loops, such as a horizontal reduction
+// of the accumulators, must not use the iterator. The loop body must be safe
+// to run on a partial vector: memory is accessed only through
+// hwy.Load(x[i:]) and hwy.Store(v, x[i:]), and variables declared outside
+// the body are only assigned whole, as in "acc = hwy.Add(acc, v)".
+func findMaskedTailLoop(body *ast.BlockStmt, loopInfo *LoopInfo) (loopIdx, tailIdx int, accs []string, err error) {
+	if body == nil || loopInfo == nil {
+		return -1, -1, nil, fmt.Errorf("no SIMD loop found")
+	}
+	it := loopInfo.Iterator
+	loopIdx = -1
+	for idx, stmt := range body.List {
+		loop, ok := stmt.(*ast.ForStmt)
+		if !ok {
+			continue
+		}
+		if matchesLoopIterator(loop, it) && isSimdStyleLoop(loop) {
+			loopIdx = idx
+			continue
+		}
+		if loopIdx < 0 || !isTailLoopShape(loop, it, loopInfo.End) {
+			continue
+		}
+		for _, between := range body.List[loopIdx+1 : idx] {
+			if usesName(between, it) {
+				return -1, -1, nil, fmt.Errorf("%s is used between the SIMD loop and its tail loop", it)
+			}
+		}
+		accs, err := checkMaskedTailBody(body.List[loopIdx].(*ast.ForStmt).Body, it)
+		if err != nil {
+			return -1, -1, nil, err
+		}
+		return loopIdx, idx, accs, nil
+	}
+	if loopIdx < 0 {
+		return -1, -1, nil, fmt.Errorf("no SIMD loop over %s found", it)
+	}
+	return -1, -1, nil, fmt.Errorf("the SIMD loop over %s must be followed by a tail loop \"for ; %s < %s; %s++\"",
+		it, it, loopInfo.End, it)
+}
+
+func nextStmt(body *ast.BlockStmt, idx int) ast.Stmt {
+	if idx+1 < len(body.List) {
+		return body.List[idx+1]
+	}
+	return nil
+}
+
+// checkMaskedTailBody reports why a SIMD loop body cannot run as a masked
+// tail iteration. Otherwise it returns the variables declared outside the
+// body that the body assigns.
+func checkMaskedTailBody(loopBody *ast.BlockStmt, iterator string) ([]string, error) {
+	declared := collectDeclaredVars(loopBody.List)
+	isTailSlice := func(e ast.Expr) bool {
+		se, ok := e.(*ast.SliceExpr)
+		if !ok || se.High != nil || se.Max != nil {
+			return false
+		}
+		low, ok := se.Low.(*ast.Ident)
+		return ok && low.Name == iterator
+	}
+
+	var accs []string
+	var err error
+	ast.Inspect(loopBody, func(n ast.Node) bool {
+		if err != nil {
+			return false
+		}
+		switch node := n.(type) {
+		case *ast.CallExpr:
+			name := hwyFuncName(node.Fun)
+			switch {
+			case name == "Load":
+				if len(node.Args) != 1 || !isTailSlice(node.Args[0]) {
+					err = fmt.Errorf("hwy.Load must load from x[%s:], got %s", iterator, exprToString(node))
+				}
+			case name == "Store":
+				if len(node.Args) != 2 || !isTailSlice(node.Args[1]) {
+					err = fmt.Errorf("hwy.Store must store to x[%s:], got %s", iterator, exprToString(node))
+				}
+			case strings.HasPrefix(name, "Load") || strings.Contains(name, "Store") ||
+				strings.HasPrefix(name, "Gather") || strings.HasPrefix(name, "Scatter"):
+				err = fmt.Errorf("hwy.%s has no masked form; only hwy.Load and hwy.Store are supported", name)
+			}
+		case *ast.IndexExpr:
+			if referencesIdent(node.Index, iterator) {
+				err = fmt.Errorf("scalar access %s would read past the tail", exprToString(node))
+			}
+		case *ast.AssignStmt:
+			if node.Tok == token.DEFINE {
+				return true
+			}
+			for _, lhs := range node.Lhs {
+				ident, ok := lhs.(*ast.Ident)
+				if !ok || ident.Name == "_" || declared[ident.Name] {
+					continue
+				}
+				if node.Tok != token.ASSIGN || len(node.Lhs) != 1 || len(node.Rhs) != 1 {
+					err = fmt.Errorf("the loop body updates %s, which is declared outside it, other than by \"%s = ...\"",
+						ident.Name, ident.Name)
+				} else if !slices.Contains(accs, ident.Name) {
+					accs = append(accs, ident.Name)
+				}
+			}
+		case *ast.IncDecStmt:
+			if ident, ok := node.X.(*ast.Ident); ok && !declared[ident.Name] {
+				err = fmt.Errorf("the loop body updates %s, which is declared outside it", ident.Name)
+			}
+		}
+		return true
+	})
+	return accs, err
+}
+
+// hwyFuncName returns Name for hwy.Name and hwy.Name[T], or "".
+func hwyFuncName(fun ast.Expr) string {
+	if idx, ok := fun.(*ast.IndexExpr); ok {
+		fun = idx.X
+	}
+	sel, ok := fun.(*ast.SelectorExpr)
+	if !ok {
+		return ""
+	}
+	if pkg, ok := sel.X.(*ast.Ident); !ok || pkg.Name != "hwy" {
+		return ""
+	}
+	return sel.Sel.Name
+}
+
+// insertMaskedTail replaces the scalar tail loop of a //hwy:maskedtail
+// function with one masked iteration of the SIMD loop body, placed right
+// after the SIMD loop:
+//
+//	if i < n {
+//		hwyTailMask := hwy.FirstN[float32](n - i)
+//		vd := hwy.MaskLoad(hwyTailMask, dst[i:])
+//		...
+//		hwy.MaskStore(hwyTailMask, result, dst[i:])
+//	}
+//
+// Accumulator updates "acc = expr" become
+// "acc = hwy.Merge(expr, acc, hwyTailMask)", a single blend, so lanes past
+// the end leave reductions such as Min untouched even when expr is not zero
+// there.
+//
+// It runs on the source AST before the target transformation, which lowers
+// FirstN, MaskLoad and MaskStore to the AVX2/AVX-512 wrappers in package hwy.
+func insertMaskedTail(body *ast.BlockStmt, loopInfo *LoopInfo, elemType string) error {
+	idx, tailIdx, accs, err := findMaskedTailLoop(body, loopInfo)
+	if err != nil {
+		return err
+	}
+	end, err := parser.ParseExpr(loopInfo.End)
+	if err != nil {
+		return fmt.Errorf("tail loop bound %q: %w", loopInfo.End, err)
+	}
+	const maskVar = "hwyTailMask"
+
+	tail := cloneBlockStmt(body.List[idx].(*ast.ForStmt).Body)
+	ast.Inspect(tail, func(n ast.Node) bool {
+		call, ok := n.(*ast.CallExpr)
+		if !ok {
+			return true
+		}
+		switch hwyFuncName(call.Fun) {
+		case "Load":
+			call.Fun = hwySelector("MaskLoad")
+			call.Args = []ast.Expr{ast.NewIdent(maskVar), call.Args[0]}
+		case "Store":
+			call.Fun = hwySelector("MaskStore")
+			call.Args = []ast.Expr{ast.NewIdent(maskVar), call.Args[0], call.Args[1]}
+		}
+		return true
+	})
+	ast.Inspect(tail, func(n ast.Node) bool {
+		assign, ok := n.(*ast.AssignStmt)
+		if !ok || assign.Tok != token.ASSIGN || len(assign.Lhs) != 1 {
+			return true
+		}
+		if ident, ok := assign.Lhs[0].(*ast.Ident); ok && slices.Contains(accs, ident.Name) {
+			assign.Rhs[0] = &ast.CallExpr{
+				Fun:  hwySelector("Merge"),
+				Args: []ast.Expr{assign.Rhs[0], ast.NewIdent(ident.Name), ast.NewIdent(maskVar)},
+			}
+		}
+		return true
+	})
+
+	maskDecl := &ast.AssignStmt{
+		Lhs: []ast.Expr{ast.NewIdent(maskVar)},
+		Tok: token.DEFINE,
+		Rhs: []ast.Expr{&ast.CallExpr{
+			Fun: &ast.IndexExpr{X: hwySelector("FirstN"), Index: ast.NewIdent(elemType)},
+			Args: []ast.Expr{&ast.BinaryExpr{
+				X:  end,
+				Op: token.SUB,
+				Y:  ast.NewIdent(loopInfo.Iterator),
+			}},
+		}},
+	}
+	masked := &ast.IfStmt{
+		Cond: &ast.BinaryExpr{
+			X:  ast.NewIdent(loopInfo.Iterator),
+			Op: token.LSS,
+			Y:  cloneExpr(end),
+		},
+		Body: &ast.BlockStmt{List: append([]ast.Stmt{maskDecl}, tail.List...)},
+	}
+	list := slices.Delete(body.List, tailIdx, tailIdx+1)
+	body.List = slices.Insert(list, idx+1, ast.Stmt(masked))
+	return nil
+}
+
+func hwySelector(name string) *ast.SelectorExpr {
+	return &ast.SelectorExpr{X: ast.NewIdent("hwy"), Sel: ast.NewIdent(name)}
+}
+
 // isScalarTailLoop checks if a statement is a scalar tail loop that should be
 // replaced by the fallback call. A scalar tail loop has the form:
 //
@@ -648,10 +1160,31 @@ func insertTailHandling(body *ast.BlockStmt, loopInfo *LoopInfo, elemType string
 // array elements), as these indicate state that the fallback cannot handle.
 func isScalarTailLoop(stmt ast.Stmt, iterator, end string) bool {
 	forStmt, ok := stmt.(*ast.ForStmt)
-	if !ok {
+	if !ok || !isTailLoopShape(forStmt, iterator, end) {
+		return false
+	}
+
+	// Check if the loop body assigns to local variables (not array elements).
+	// If so, this loop has state that the fallback cannot handle correctly.
+	// Example: "prev = src[i]" indicates state tracking that needs the manual loop.
+	if hasLocalVariableAssignment(forStmt.Body, iterator) {
 		return false
 	}
 
+	// Check if the loop body uses external variables (not just the iterator and arrays).
+	// If so, those variables were computed from the full input and the fallback would
+	// recalculate them incorrectly from just the tail.
+	// Example: "dst[i] *= scale" uses external variable "scale" computed from full array.
+	if usesExternalVariables(forStmt.Body, iterator) {
+		return false
+	}
+
+	return true
+}
+
+// isTailLoopShape reports whether forStmt has the form "for ; i < n; i++",
+// with i the iterator and n the end expression of the SIMD loop.
+func isTailLoopShape(forStmt *ast.ForStmt, iterator, end string) bool {
 	// Scalar tail loops have no Init (the iterator is already declared)
 	if forStmt.Init != nil {
 		return false
@@ -681,26 +1214,7 @@ func isScalarTailLoop(stmt ast.Stmt, iterator, end string) bool {
 	}
 
 	postIdent, ok := post.X.(*ast.Ident)
-	if !ok || postIdent.Name != iterator {
-		return false
-	}
-
-	// Check if the loop body assigns to local variables (not array elements).
-	// If so, this loop has state that the fallback cannot handle correctly.
-	// Example: "prev = src[i]" indicates state tracking that needs the manual loop.
-	if hasLocalVariableAssignment(forStmt.Body, iterator) {
-		return false
-	}
-
-	// Check if the loop body uses external variables (not just the iterator and arrays).
-	// If so, those variables were computed from the full input and the fallback would
-	// recalculate them incorrectly from just the tail.
-	// Example: "dst[i] *= scale" uses external variable "scale" computed from full array.
-	if usesExternalVariables(forStmt.Body, iterator) {
-		return false
-	}
-
-	return true
+	return ok && postIdent.Name == iterator
 }
 
 // hasLocalVariableAssignment checks if a block contains assignments to local
@@ -0,0 +1,94 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package fuse
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var ScaleShiftTanhSumFloat16 func(x []hwy.Float16, scale hwy.Float16, shift hwy.Float16) hwy.Float16
+var ScaleShiftTanhSumBFloat16 func(x []hwy.BFloat16, scale hwy.BFloat16, shift hwy.BFloat16) hwy.BFloat16
+var ScaleShiftTanhSumFloat32 func(x []float32, scale float32, shift float32) float32
+var ScaleShiftTanhSumFloat64 func(x []float64, scale float64, shift float64) float64
+
+// ScaleShiftTanhSum replaces x with tanh(x*scale + shift) and returns the
+// sum of the result.
+//
+// Called one after another, the four kernels read x four times and write it
+// three times. Fused, each vector of x is loaded once, stored once, and
+// added to the sum while it is still in a register.
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:fuse
+func ScaleShiftTanhSum[T hwy.Floats](x []T, scale T, shift T) T {
+	if _, ok := any(x).([]hwy.Float16); ok {
+		return any(ScaleShiftTanhSumFloat16(any(x).([]hwy.Float16), any(scale).(hwy.Float16), any(shift).(hwy.Float16))).(T)
+	}
+	if _, ok := any(x).([]hwy.BFloat16); ok {
+		return any(ScaleShiftTanhSumBFloat16(any(x).([]hwy.BFloat16), any(scale).(hwy.BFloat16), any(shift).(hwy.BFloat16))).(T)
+	}
+	if _, ok := any(x).([]float32); ok {
+		return any(ScaleShiftTanhSumFloat32(any(x).([]float32), any(scale).(float32), any(shift).(float32))).(T)
+	}
+	if _, ok := any(x).([]float64); ok {
+		return any(ScaleShiftTanhSumFloat64(any(x).([]float64), any(scale).(float64), any(shift).(float64))).(T)
+	}
+	panic("unsupported type")
+}
+
+func init() {
+	initFuseAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "fuse",
+		Groups: []hwy.DispatchGroup{
+			{Name: "ScaleShiftTanhSum", Vars: []any{&ScaleShiftTanhSumFloat16, &ScaleShiftTanhSumBFloat16, &ScaleShiftTanhSumFloat32, &ScaleShiftTanhSumFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initFuseAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initFuseAVX2},
+			{Name: "fallback", Supported: true, Init: initFuseFallback},
+		},
+	})
+}
+
+func initFuseAll() {
+	if hwy.NoSimdEnv() {
+		initFuseFallback()
+		return
+	}
+	if archsimd.X86.AVX512() {
+		initFuseAVX512()
+		return
+	}
+	if archsimd.X86.AVX2() {
+		initFuseAVX2()
+		return
+	}
+	initFuseFallback()
+}
+
+func initFuseAVX2() {
+	ScaleShiftTanhSumFloat16 = BaseScaleShiftTanhSum_avx2_Float16
+	ScaleShiftTanhSumBFloat16 = BaseScaleShiftTanhSum_avx2_BFloat16
+	ScaleShiftTanhSumFloat32 = BaseScaleShiftTanhSum_avx2
+	ScaleShiftTanhSumFloat64 = BaseScaleShiftTanhSum_avx2_Float64
+}
+
+func initFuseAVX512() {
+	ScaleShiftTanhSumFloat16 = BaseScaleShiftTanhSum_avx512_Float16
+	ScaleShiftTanhSumBFloat16 = BaseScaleShiftTanhSum_avx512_BFloat16
+	ScaleShiftTanhSumFloat32 = BaseScaleShiftTanhSum_avx512
+	ScaleShiftTanhSumFloat64 = BaseScaleShiftTanhSum_avx512_Float64
+}
+
+func initFuseFallback() {
+	ScaleShiftTanhSumFloat16 = BaseScaleShiftTanhSum_fallback_Float16
+	ScaleShiftTanhSumBFloat16 = BaseScaleShiftTanhSum_fallback_BFloat16
+	ScaleShiftTanhSumFloat32 = BaseScaleShiftTanhSum_fallback
+	ScaleShiftTanhSumFloat64 = BaseScaleShiftTanhSum_fallback_Float64
+}
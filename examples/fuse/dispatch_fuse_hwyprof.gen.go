@@ -0,0 +1,46 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package fuse
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("fuse", "ScaleShiftTanhSum", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ScaleShiftTanhSumFloat16; hwyImpl != nil {
+			ScaleShiftTanhSumFloat16 = func(x []hwy.Float16, scale hwy.Float16, shift hwy.Float16) hwy.Float16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(x, scale, shift)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ScaleShiftTanhSumBFloat16; hwyImpl != nil {
+			ScaleShiftTanhSumBFloat16 = func(x []hwy.BFloat16, scale hwy.BFloat16, shift hwy.BFloat16) hwy.BFloat16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(x, scale, shift)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ScaleShiftTanhSumFloat32; hwyImpl != nil {
+			ScaleShiftTanhSumFloat32 = func(x []float32, scale float32, shift float32) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(x, scale, shift)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ScaleShiftTanhSumFloat64; hwyImpl != nil {
+			ScaleShiftTanhSumFloat64 = func(x []float64, scale float64, shift float64) float64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(x, scale, shift)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+				return hwyR0
+			}
+		}
+	})
+}
@@ -0,0 +1,46 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package fuse demonstrates //hwy:fuse, which inlines a pipeline of
+// elementwise kernels into one generated kernel that makes a single pass
+// over memory.
+//
+// Usage:
+//
+//	go generate ./...
+//	GOEXPERIMENT=simd go build
+package fuse
+
+//go:generate go run ../../cmd/hwygen -input fuse.go -output . -targets avx2,avx512,neon,fallback
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/activation"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec"
+)
+
+// BaseScaleShiftTanhSum replaces x with tanh(x*scale + shift) and returns the
+// sum of the result.
+//
+// Called one after another, the four kernels read x four times and write it
+// three times. Fused, each vector of x is loaded once, stored once, and
+// added to the sum while it is still in a register.
+//
+//hwy:fuse
+func BaseScaleShiftTanhSum[T hwy.Floats](x []T, scale, shift T) T {
+	vec.BaseScale(scale, x)
+	vec.BaseAddConst(shift, x)
+	activation.BaseTanh(x, x)
+	return vec.BaseSum(x)
+}
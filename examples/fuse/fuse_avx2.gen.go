@@ -0,0 +1,283 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package fuse
+
+import (
+	stdmath "math"
+	"simd/archsimd"
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/asm"
+	"github.com/ajroetker/go-highway/hwy/contrib/math"
+)
+
+func BaseScaleShiftTanhSum_avx2_Float16(x []hwy.Float16, scale hwy.Float16, shift hwy.Float16) hwy.Float16 {
+	n := len(x)
+	vc := asm.BroadcastFloat16x8AVX2(uint16(scale))
+	lanes := 8
+	vc_2 := asm.BroadcastFloat16x8AVX2(uint16(shift))
+	sum := asm.ZeroFloat16x8AVX2()
+	var i int
+	sum1 := asm.ZeroFloat16x8AVX2()
+	sum2 := asm.ZeroFloat16x8AVX2()
+	sum3 := asm.ZeroFloat16x8AVX2()
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
+		vd := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&x[i]))
+		result := vd.Mul(vc)
+		result_2 := result.Add(vc_2)
+		result_3 := math.BaseTanhVec_avx2_Float16(result_2)
+		result_3.StorePtr(unsafe.Pointer(&x[i]))
+		sum = sum.Add(result_3)
+		vd1 := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&x[i+8]))
+		result1 := vd1.Mul(vc)
+		result_21 := result1.Add(vc_2)
+		result_31 := math.BaseTanhVec_avx2_Float16(result_21)
+		result_31.StorePtr(unsafe.Pointer(&x[i+8]))
+		sum1 = sum1.Add(result_31)
+		vd2 := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&x[i+16]))
+		result2 := vd2.Mul(vc)
+		result_22 := result2.Add(vc_2)
+		result_32 := math.BaseTanhVec_avx2_Float16(result_22)
+		result_32.StorePtr(unsafe.Pointer(&x[i+16]))
+		sum2 = sum2.Add(result_32)
+		vd3 := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&x[i+24]))
+		result3 := vd3.Mul(vc)
+		result_23 := result3.Add(vc_2)
+		result_33 := math.BaseTanhVec_avx2_Float16(result_23)
+		result_33.StorePtr(unsafe.Pointer(&x[i+24]))
+		sum3 = sum3.Add(result_33)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= n; i += lanes {
+		vd := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&x[i]))
+		result := vd.Mul(vc)
+		result_2 := result.Add(vc_2)
+		result_3 := math.BaseTanhVec_avx2_Float16(result_2)
+		result_3.StorePtr(unsafe.Pointer(&x[i]))
+		sum = sum.Add(result_3)
+	}
+	for i_3 := i; i_3 < n; i_3++ {
+		x[i_3] = hwy.Float32ToFloat16(x[i_3].Float32() * scale.Float32())
+	}
+	for i_4 := i; i_4 < n; i_4++ {
+		x[i_4] = hwy.Float32ToFloat16(x[i_4].Float32() + shift.Float32())
+	}
+	for i_2 := i; i_2 < n; i_2++ {
+		x_2 := float64(x[i_2].Float32())
+		x[i_2] = hwy.Float32ToFloat16(float32(stdmath.Tanh(x_2)))
+	}
+	if len(x) == 0 {
+		return 0
+	}
+	result_4 := sum.ReduceSum()
+	for ; i < len(x); i++ {
+		result_4 += x[i].Float32()
+	}
+	return hwy.Float32ToFloat16(result_4)
+}
+
+func BaseScaleShiftTanhSum_avx2_BFloat16(x []hwy.BFloat16, scale hwy.BFloat16, shift hwy.BFloat16) hwy.BFloat16 {
+	n := len(x)
+	vc := asm.BroadcastBFloat16x8AVX2(uint16(scale))
+	lanes := 8
+	vc_2 := asm.BroadcastBFloat16x8AVX2(uint16(shift))
+	sum := asm.ZeroBFloat16x8AVX2()
+	var i int
+	sum1 := asm.ZeroBFloat16x8AVX2()
+	sum2 := asm.ZeroBFloat16x8AVX2()
+	sum3 := asm.ZeroBFloat16x8AVX2()
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
+		vd := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&x[i]))
+		result := vd.Mul(vc)
+		result_2 := result.Add(vc_2)
+		result_3 := math.BaseTanhVec_avx2_BFloat16(result_2)
+		result_3.StorePtr(unsafe.Pointer(&x[i]))
+		sum = sum.Add(result_3)
+		vd1 := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&x[i+8]))
+		result1 := vd1.Mul(vc)
+		result_21 := result1.Add(vc_2)
+		result_31 := math.BaseTanhVec_avx2_BFloat16(result_21)
+		result_31.StorePtr(unsafe.Pointer(&x[i+8]))
+		sum1 = sum1.Add(result_31)
+		vd2 := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&x[i+16]))
+		result2 := vd2.Mul(vc)
+		result_22 := result2.Add(vc_2)
+		result_32 := math.BaseTanhVec_avx2_BFloat16(result_22)
+		result_32.StorePtr(unsafe.Pointer(&x[i+16]))
+		sum2 = sum2.Add(result_32)
+		vd3 := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&x[i+24]))
+		result3 := vd3.Mul(vc)
+		result_23 := result3.Add(vc_2)
+		result_33 := math.BaseTanhVec_avx2_BFloat16(result_23)
+		result_33.StorePtr(unsafe.Pointer(&x[i+24]))
+		sum3 = sum3.Add(result_33)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= n; i += lanes {
+		vd := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&x[i]))
+		result := vd.Mul(vc)
+		result_2 := result.Add(vc_2)
+		result_3 := math.BaseTanhVec_avx2_BFloat16(result_2)
+		result_3.StorePtr(unsafe.Pointer(&x[i]))
+		sum = sum.Add(result_3)
+	}
+	for i_3 := i; i_3 < n; i_3++ {
+		x[i_3] = hwy.Float32ToBFloat16(x[i_3].Float32() * scale.Float32())
+	}
+	for i_4 := i; i_4 < n; i_4++ {
+		x[i_4] = hwy.Float32ToBFloat16(x[i_4].Float32() + shift.Float32())
+	}
+	for i_2 := i; i_2 < n; i_2++ {
+		x_2 := float64(x[i_2].Float32())
+		x[i_2] = hwy.Float32ToBFloat16(float32(stdmath.Tanh(x_2)))
+	}
+	if len(x) == 0 {
+		return 0
+	}
+	result_4 := sum.ReduceSum()
+	for ; i < len(x); i++ {
+		result_4 += x[i].Float32()
+	}
+	return hwy.Float32ToBFloat16(result_4)
+}
+
+func BaseScaleShiftTanhSum_avx2(x []float32, scale float32, shift float32) float32 {
+	n := len(x)
+	vc := archsimd.BroadcastFloat32x8(scale)
+	lanes := 8
+	vc_2 := archsimd.BroadcastFloat32x8(shift)
+	sum := archsimd.BroadcastFloat32x8(0)
+	var i int
+	sum1 := archsimd.BroadcastFloat32x8(0)
+	sum2 := archsimd.BroadcastFloat32x8(0)
+	sum3 := archsimd.BroadcastFloat32x8(0)
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
+		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[i])))
+		result := vd.Mul(vc)
+		result_2 := result.Add(vc_2)
+		result_3 := math.BaseTanhVec_avx2(result_2)
+		result_3.Store((*[8]float32)(unsafe.Pointer(&x[i])))
+		sum = sum.Add(result_3)
+		vd1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[i+8])))
+		result1 := vd1.Mul(vc)
+		result_21 := result1.Add(vc_2)
+		result_31 := math.BaseTanhVec_avx2(result_21)
+		result_31.Store((*[8]float32)(unsafe.Pointer(&x[i+8])))
+		sum1 = sum1.Add(result_31)
+		vd2 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[i+16])))
+		result2 := vd2.Mul(vc)
+		result_22 := result2.Add(vc_2)
+		result_32 := math.BaseTanhVec_avx2(result_22)
+		result_32.Store((*[8]float32)(unsafe.Pointer(&x[i+16])))
+		sum2 = sum2.Add(result_32)
+		vd3 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[i+24])))
+		result3 := vd3.Mul(vc)
+		result_23 := result3.Add(vc_2)
+		result_33 := math.BaseTanhVec_avx2(result_23)
+		result_33.Store((*[8]float32)(unsafe.Pointer(&x[i+24])))
+		sum3 = sum3.Add(result_33)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[i])))
+		result := vd.Mul(vc)
+		result_2 := result.Add(vc_2)
+		result_3 := math.BaseTanhVec_avx2(result_2)
+		result_3.Store((*[8]float32)(unsafe.Pointer(&x[i])))
+		sum = sum.Add(result_3)
+	}
+	for i_3 := i; i_3 < n; i_3++ {
+		x[i_3] *= scale
+	}
+	for i_4 := i; i_4 < n; i_4++ {
+		x[i_4] += shift
+	}
+	for i_2 := i; i_2 < n; i_2++ {
+		x_2 := float64(x[i_2])
+		x[i_2] = float32(stdmath.Tanh(x_2))
+	}
+	if len(x) == 0 {
+		return 0
+	}
+	result_4 := hwy.ReduceSum_AVX2_F32x8(sum)
+	for ; i < len(x); i++ {
+		result_4 += x[i]
+	}
+	return result_4
+}
+
+func BaseScaleShiftTanhSum_avx2_Float64(x []float64, scale float64, shift float64) float64 {
+	n := len(x)
+	vc := archsimd.BroadcastFloat64x4(scale)
+	lanes := 4
+	vc_2 := archsimd.BroadcastFloat64x4(shift)
+	sum := archsimd.BroadcastFloat64x4(0)
+	var i int
+	sum1 := archsimd.BroadcastFloat64x4(0)
+	sum2 := archsimd.BroadcastFloat64x4(0)
+	sum3 := archsimd.BroadcastFloat64x4(0)
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
+		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&x[i])))
+		result := vd.Mul(vc)
+		result_2 := result.Add(vc_2)
+		result_3 := math.BaseTanhVec_avx2_Float64(result_2)
+		result_3.Store((*[4]float64)(unsafe.Pointer(&x[i])))
+		sum = sum.Add(result_3)
+		vd1 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&x[i+4])))
+		result1 := vd1.Mul(vc)
+		result_21 := result1.Add(vc_2)
+		result_31 := math.BaseTanhVec_avx2_Float64(result_21)
+		result_31.Store((*[4]float64)(unsafe.Pointer(&x[i+4])))
+		sum1 = sum1.Add(result_31)
+		vd2 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&x[i+8])))
+		result2 := vd2.Mul(vc)
+		result_22 := result2.Add(vc_2)
+		result_32 := math.BaseTanhVec_avx2_Float64(result_22)
+		result_32.Store((*[4]float64)(unsafe.Pointer(&x[i+8])))
+		sum2 = sum2.Add(result_32)
+		vd3 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&x[i+12])))
+		result3 := vd3.Mul(vc)
+		result_23 := result3.Add(vc_2)
+		result_33 := math.BaseTanhVec_avx2_Float64(result_23)
+		result_33.Store((*[4]float64)(unsafe.Pointer(&x[i+12])))
+		sum3 = sum3.Add(result_33)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&x[i])))
+		result := vd.Mul(vc)
+		result_2 := result.Add(vc_2)
+		result_3 := math.BaseTanhVec_avx2_Float64(result_2)
+		result_3.Store((*[4]float64)(unsafe.Pointer(&x[i])))
+		sum = sum.Add(result_3)
+	}
+	for i_3 := i; i_3 < n; i_3++ {
+		x[i_3] *= scale
+	}
+	for i_4 := i; i_4 < n; i_4++ {
+		x[i_4] += shift
+	}
+	for i_2 := i; i_2 < n; i_2++ {
+		x_2 := float64(x[i_2])
+		x[i_2] = float64(stdmath.Tanh(x_2))
+	}
+	if len(x) == 0 {
+		return 0
+	}
+	result_4 := hwy.ReduceSum_AVX2_F64x4(sum)
+	for ; i < len(x); i++ {
+		result_4 += x[i]
+	}
+	return result_4
+}
@@ -0,0 +1,148 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package fuse
+
+import (
+	stdmath "math"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/math"
+)
+
+func BaseScaleShiftTanhSum_fallback_Float16(x []hwy.Float16, scale hwy.Float16, shift hwy.Float16) hwy.Float16 {
+	n := len(x)
+	vc := hwy.Set(scale)
+	lanes := vc.NumLanes()
+	vc_2 := hwy.Set(shift)
+	sum := hwy.Zero[hwy.Float16]()
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		vd := hwy.Load(x[i:])
+		result := hwy.Mul(vd, vc)
+		result_2 := hwy.Add(result, vc_2)
+		result_3 := math.BaseTanhVec_fallback_Float16(result_2)
+		hwy.Store(result_3, x[i:])
+		sum = hwy.Add(sum, result_3)
+	}
+	for i_3 := i; i_3 < n; i_3++ {
+		x[i_3] = hwy.Float32ToFloat16(x[i_3].Float32() * scale.Float32())
+	}
+	for i_4 := i; i_4 < n; i_4++ {
+		x[i_4] = hwy.Float32ToFloat16(x[i_4].Float32() + shift.Float32())
+	}
+	for i_2 := i; i_2 < n; i_2++ {
+		x_2 := float64(x[i_2].Float32())
+		x[i_2] = hwy.Float32ToFloat16(float32(stdmath.Tanh(x_2)))
+	}
+	if len(x) == 0 {
+		return 0
+	}
+	result_4 := hwy.ReduceSum(sum).Float32()
+	for ; i < len(x); i++ {
+		result_4 += x[i].Float32()
+	}
+	return hwy.Float32ToFloat16(result_4)
+}
+
+func BaseScaleShiftTanhSum_fallback_BFloat16(x []hwy.BFloat16, scale hwy.BFloat16, shift hwy.BFloat16) hwy.BFloat16 {
+	n := len(x)
+	vc := hwy.Set(scale)
+	lanes := vc.NumLanes()
+	vc_2 := hwy.Set(shift)
+	sum := hwy.Zero[hwy.BFloat16]()
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		vd := hwy.Load(x[i:])
+		result := hwy.Mul(vd, vc)
+		result_2 := hwy.Add(result, vc_2)
+		result_3 := math.BaseTanhVec_fallback_BFloat16(result_2)
+		hwy.Store(result_3, x[i:])
+		sum = hwy.Add(sum, result_3)
+	}
+	for i_3 := i; i_3 < n; i_3++ {
+		x[i_3] = hwy.Float32ToBFloat16(x[i_3].Float32() * scale.Float32())
+	}
+	for i_4 := i; i_4 < n; i_4++ {
+		x[i_4] = hwy.Float32ToBFloat16(x[i_4].Float32() + shift.Float32())
+	}
+	for i_2 := i; i_2 < n; i_2++ {
+		x_2 := float64(x[i_2].Float32())
+		x[i_2] = hwy.Float32ToBFloat16(float32(stdmath.Tanh(x_2)))
+	}
+	if len(x) == 0 {
+		return 0
+	}
+	result_4 := hwy.ReduceSum(sum).Float32()
+	for ; i < len(x); i++ {
+		result_4 += x[i].Float32()
+	}
+	return hwy.Float32ToBFloat16(result_4)
+}
+
+func BaseScaleShiftTanhSum_fallback(x []float32, scale float32, shift float32) float32 {
+	n := len(x)
+	vc := float32(scale)
+	vc_2 := float32(shift)
+	sum := float32(0)
+	var i int
+	for i = 0; i < n; i++ {
+		vd := x[i]
+		result := vd * vc
+		result_2 := result + vc_2
+		result_3 := float32(stdmath.Tanh(float64(result_2)))
+		x[i] = result_3
+		sum = sum + result_3
+	}
+	for i_3 := i; i_3 < n; i_3++ {
+		x[i_3] *= scale
+	}
+	for i_4 := i; i_4 < n; i_4++ {
+		x[i_4] += shift
+	}
+	for i_2 := i; i_2 < n; i_2++ {
+		x_2 := float64(x[i_2])
+		x[i_2] = float32(stdmath.Tanh(x_2))
+	}
+	if len(x) == 0 {
+		return 0
+	}
+	result_4 := sum
+	for ; i < len(x); i++ {
+		result_4 += x[i]
+	}
+	return result_4
+}
+
+func BaseScaleShiftTanhSum_fallback_Float64(x []float64, scale float64, shift float64) float64 {
+	n := len(x)
+	vc := float64(scale)
+	vc_2 := float64(shift)
+	sum := float64(0)
+	var i int
+	for i = 0; i < n; i++ {
+		vd := x[i]
+		result := vd * vc
+		result_2 := result + vc_2
+		result_3 := float64(stdmath.Tanh(float64(result_2)))
+		x[i] = result_3
+		sum = sum + result_3
+	}
+	for i_3 := i; i_3 < n; i_3++ {
+		x[i_3] *= scale
+	}
+	for i_4 := i; i_4 < n; i_4++ {
+		x[i_4] += shift
+	}
+	for i_2 := i; i_2 < n; i_2++ {
+		x_2 := float64(x[i_2])
+		x[i_2] = float64(stdmath.Tanh(x_2))
+	}
+	if len(x) == 0 {
+		return 0
+	}
+	result_4 := sum
+	for ; i < len(x); i++ {
+		result_4 += x[i]
+	}
+	return result_4
+}
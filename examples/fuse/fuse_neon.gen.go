@@ -0,0 +1,282 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package fuse
+
+import (
+	stdmath "math"
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/asm"
+	"github.com/ajroetker/go-highway/hwy/contrib/math"
+)
+
+func BaseScaleShiftTanhSum_neon_Float16(x []hwy.Float16, scale hwy.Float16, shift hwy.Float16) hwy.Float16 {
+	n := len(x)
+	vc := hwy.Set(scale)
+	lanes := 8
+	vc_2 := hwy.Set(shift)
+	sum := hwy.Zero[hwy.Float16]()
+	var i int
+	sum1 := hwy.Zero[hwy.Float16]()
+	sum2 := hwy.Zero[hwy.Float16]()
+	sum3 := hwy.Zero[hwy.Float16]()
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
+		vd := hwy.Load(x[i:])
+		result := hwy.MulF16(vd, vc)
+		result_2 := hwy.AddF16(result, vc_2)
+		result_3 := math.BaseTanhVec_neon_Float16(result_2)
+		hwy.Store(result_3, x[i:])
+		sum = hwy.AddF16(sum, result_3)
+		vd1 := hwy.Load(x[i+8:])
+		result1 := hwy.MulF16(vd1, vc)
+		result_21 := hwy.AddF16(result1, vc_2)
+		result_31 := math.BaseTanhVec_neon_Float16(result_21)
+		hwy.Store(result_31, x[i+8:])
+		sum1 = hwy.AddF16(sum1, result_31)
+		vd2 := hwy.Load(x[i+16:])
+		result2 := hwy.MulF16(vd2, vc)
+		result_22 := hwy.AddF16(result2, vc_2)
+		result_32 := math.BaseTanhVec_neon_Float16(result_22)
+		hwy.Store(result_32, x[i+16:])
+		sum2 = hwy.AddF16(sum2, result_32)
+		vd3 := hwy.Load(x[i+24:])
+		result3 := hwy.MulF16(vd3, vc)
+		result_23 := hwy.AddF16(result3, vc_2)
+		result_33 := math.BaseTanhVec_neon_Float16(result_23)
+		hwy.Store(result_33, x[i+24:])
+		sum3 = hwy.AddF16(sum3, result_33)
+	}
+	sum = hwy.AddF16(sum, sum1)
+	sum2 = hwy.AddF16(sum2, sum3)
+	sum = hwy.AddF16(sum, sum2)
+	for ; i+lanes <= n; i += lanes {
+		vd := hwy.Load(x[i:])
+		result := hwy.MulF16(vd, vc)
+		result_2 := hwy.AddF16(result, vc_2)
+		result_3 := math.BaseTanhVec_neon_Float16(result_2)
+		hwy.Store(result_3, x[i:])
+		sum = hwy.AddF16(sum, result_3)
+	}
+	for i_3 := i; i_3 < n; i_3++ {
+		x[i_3] = hwy.Float32ToFloat16(x[i_3].Float32() * scale.Float32())
+	}
+	for i_4 := i; i_4 < n; i_4++ {
+		x[i_4] = hwy.Float32ToFloat16(x[i_4].Float32() + shift.Float32())
+	}
+	for i_2 := i; i_2 < n; i_2++ {
+		x_2 := float64(x[i_2].Float32())
+		x[i_2] = hwy.Float32ToFloat16(float32(stdmath.Tanh(x_2)))
+	}
+	if len(x) == 0 {
+		return 0
+	}
+	result_4 := hwy.ReduceSumF16(sum)
+	for ; i < len(x); i++ {
+		result_4 += x[i].Float32()
+	}
+	return hwy.Float32ToFloat16(result_4)
+}
+
+func BaseScaleShiftTanhSum_neon_BFloat16(x []hwy.BFloat16, scale hwy.BFloat16, shift hwy.BFloat16) hwy.BFloat16 {
+	n := len(x)
+	vc := hwy.Set(scale)
+	lanes := 8
+	vc_2 := hwy.Set(shift)
+	sum := hwy.Zero[hwy.BFloat16]()
+	var i int
+	sum1 := hwy.Zero[hwy.BFloat16]()
+	sum2 := hwy.Zero[hwy.BFloat16]()
+	sum3 := hwy.Zero[hwy.BFloat16]()
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
+		vd := hwy.Load(x[i:])
+		result := hwy.MulBF16(vd, vc)
+		result_2 := hwy.AddBF16(result, vc_2)
+		result_3 := math.BaseTanhVec_neon_BFloat16(result_2)
+		hwy.Store(result_3, x[i:])
+		sum = hwy.AddBF16(sum, result_3)
+		vd1 := hwy.Load(x[i+8:])
+		result1 := hwy.MulBF16(vd1, vc)
+		result_21 := hwy.AddBF16(result1, vc_2)
+		result_31 := math.BaseTanhVec_neon_BFloat16(result_21)
+		hwy.Store(result_31, x[i+8:])
+		sum1 = hwy.AddBF16(sum1, result_31)
+		vd2 := hwy.Load(x[i+16:])
+		result2 := hwy.MulBF16(vd2, vc)
+		result_22 := hwy.AddBF16(result2, vc_2)
+		result_32 := math.BaseTanhVec_neon_BFloat16(result_22)
+		hwy.Store(result_32, x[i+16:])
+		sum2 = hwy.AddBF16(sum2, result_32)
+		vd3 := hwy.Load(x[i+24:])
+		result3 := hwy.MulBF16(vd3, vc)
+		result_23 := hwy.AddBF16(result3, vc_2)
+		result_33 := math.BaseTanhVec_neon_BFloat16(result_23)
+		hwy.Store(result_33, x[i+24:])
+		sum3 = hwy.AddBF16(sum3, result_33)
+	}
+	sum = hwy.AddBF16(sum, sum1)
+	sum2 = hwy.AddBF16(sum2, sum3)
+	sum = hwy.AddBF16(sum, sum2)
+	for ; i+lanes <= n; i += lanes {
+		vd := hwy.Load(x[i:])
+		result := hwy.MulBF16(vd, vc)
+		result_2 := hwy.AddBF16(result, vc_2)
+		result_3 := math.BaseTanhVec_neon_BFloat16(result_2)
+		hwy.Store(result_3, x[i:])
+		sum = hwy.AddBF16(sum, result_3)
+	}
+	for i_3 := i; i_3 < n; i_3++ {
+		x[i_3] = hwy.Float32ToBFloat16(x[i_3].Float32() * scale.Float32())
+	}
+	for i_4 := i; i_4 < n; i_4++ {
+		x[i_4] = hwy.Float32ToBFloat16(x[i_4].Float32() + shift.Float32())
+	}
+	for i_2 := i; i_2 < n; i_2++ {
+		x_2 := float64(x[i_2].Float32())
+		x[i_2] = hwy.Float32ToBFloat16(float32(stdmath.Tanh(x_2)))
+	}
+	if len(x) == 0 {
+		return 0
+	}
+	result_4 := hwy.ReduceSumBF16(sum)
+	for ; i < len(x); i++ {
+		result_4 += x[i].Float32()
+	}
+	return hwy.Float32ToBFloat16(result_4)
+}
+
+func BaseScaleShiftTanhSum_neon(x []float32, scale float32, shift float32) float32 {
+	n := len(x)
+	vc := asm.BroadcastFloat32x4(scale)
+	lanes := 4
+	vc_2 := asm.BroadcastFloat32x4(shift)
+	sum := asm.ZeroFloat32x4()
+	var i int
+	sum1 := asm.ZeroFloat32x4()
+	sum2 := asm.ZeroFloat32x4()
+	sum3 := asm.ZeroFloat32x4()
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
+		vd := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&x[i])))
+		result := vd.Mul(vc)
+		result_2 := result.Add(vc_2)
+		result_3 := math.BaseTanhVec_neon(result_2)
+		result_3.Store((*[4]float32)(unsafe.Pointer(&x[i])))
+		sum = sum.Add(result_3)
+		vd1 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&x[i+4])))
+		result1 := vd1.Mul(vc)
+		result_21 := result1.Add(vc_2)
+		result_31 := math.BaseTanhVec_neon(result_21)
+		result_31.Store((*[4]float32)(unsafe.Pointer(&x[i+4])))
+		sum1 = sum1.Add(result_31)
+		vd2 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&x[i+8])))
+		result2 := vd2.Mul(vc)
+		result_22 := result2.Add(vc_2)
+		result_32 := math.BaseTanhVec_neon(result_22)
+		result_32.Store((*[4]float32)(unsafe.Pointer(&x[i+8])))
+		sum2 = sum2.Add(result_32)
+		vd3 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&x[i+12])))
+		result3 := vd3.Mul(vc)
+		result_23 := result3.Add(vc_2)
+		result_33 := math.BaseTanhVec_neon(result_23)
+		result_33.Store((*[4]float32)(unsafe.Pointer(&x[i+12])))
+		sum3 = sum3.Add(result_33)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= n; i += lanes {
+		vd := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&x[i])))
+		result := vd.Mul(vc)
+		result_2 := result.Add(vc_2)
+		result_3 := math.BaseTanhVec_neon(result_2)
+		result_3.Store((*[4]float32)(unsafe.Pointer(&x[i])))
+		sum = sum.Add(result_3)
+	}
+	for i_3 := i; i_3 < n; i_3++ {
+		x[i_3] *= scale
+	}
+	for i_4 := i; i_4 < n; i_4++ {
+		x[i_4] += shift
+	}
+	for i_2 := i; i_2 < n; i_2++ {
+		x_2 := float64(x[i_2])
+		x[i_2] = float32(stdmath.Tanh(x_2))
+	}
+	if len(x) == 0 {
+		return 0
+	}
+	result_4 := sum.ReduceSum()
+	for ; i < len(x); i++ {
+		result_4 += x[i]
+	}
+	return result_4
+}
+
+func BaseScaleShiftTanhSum_neon_Float64(x []float64, scale float64, shift float64) float64 {
+	n := len(x)
+	vc := asm.BroadcastFloat64x2(scale)
+	lanes := 2
+	vc_2 := asm.BroadcastFloat64x2(shift)
+	sum := asm.ZeroFloat64x2()
+	var i int
+	sum1 := asm.ZeroFloat64x2()
+	sum2 := asm.ZeroFloat64x2()
+	sum3 := asm.ZeroFloat64x2()
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
+		vd := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&x[i])))
+		result := vd.Mul(vc)
+		result_2 := result.Add(vc_2)
+		result_3 := math.BaseTanhVec_neon_Float64(result_2)
+		result_3.Store((*[2]float64)(unsafe.Pointer(&x[i])))
+		sum = sum.Add(result_3)
+		vd1 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&x[i+2])))
+		result1 := vd1.Mul(vc)
+		result_21 := result1.Add(vc_2)
+		result_31 := math.BaseTanhVec_neon_Float64(result_21)
+		result_31.Store((*[2]float64)(unsafe.Pointer(&x[i+2])))
+		sum1 = sum1.Add(result_31)
+		vd2 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&x[i+4])))
+		result2 := vd2.Mul(vc)
+		result_22 := result2.Add(vc_2)
+		result_32 := math.BaseTanhVec_neon_Float64(result_22)
+		result_32.Store((*[2]float64)(unsafe.Pointer(&x[i+4])))
+		sum2 = sum2.Add(result_32)
+		vd3 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&x[i+6])))
+		result3 := vd3.Mul(vc)
+		result_23 := result3.Add(vc_2)
+		result_33 := math.BaseTanhVec_neon_Float64(result_23)
+		result_33.Store((*[2]float64)(unsafe.Pointer(&x[i+6])))
+		sum3 = sum3.Add(result_33)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= n; i += lanes {
+		vd := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&x[i])))
+		result := vd.Mul(vc)
+		result_2 := result.Add(vc_2)
+		result_3 := math.BaseTanhVec_neon_Float64(result_2)
+		result_3.Store((*[2]float64)(unsafe.Pointer(&x[i])))
+		sum = sum.Add(result_3)
+	}
+	for i_3 := i; i_3 < n; i_3++ {
+		x[i_3] *= scale
+	}
+	for i_4 := i; i_4 < n; i_4++ {
+		x[i_4] += shift
+	}
+	for i_2 := i; i_2 < n; i_2++ {
+		x_2 := float64(x[i_2])
+		x[i_2] = float64(stdmath.Tanh(x_2))
+	}
+	if len(x) == 0 {
+		return 0
+	}
+	result_4 := sum.ReduceSum()
+	for ; i < len(x); i++ {
+		result_4 += x[i]
+	}
+	return result_4
+}
@@ -0,0 +1,85 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package fuse
+
+import (
+	"fmt"
+	stdmath "math"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/activation"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec"
+)
+
+func TestScaleShiftTanhSum(t *testing.T) {
+	for _, n := range []int{0, 1, 3, 7, 8, 16, 31, 64, 100, 1000} {
+		t.Run(fmt.Sprintf("n=%d", n), func(t *testing.T) {
+			x := make([]float32, n)
+			for i := range x {
+				x[i] = float32(i%17)/4 - 2
+			}
+			want := append([]float32(nil), x...)
+			vec.Scale(float32(0.5), want)
+			vec.AddConst(float32(0.25), want)
+			activation.Tanh(want, want)
+			wantSum := vec.Sum(want)
+
+			got := ScaleShiftTanhSum(x, 0.5, 0.25)
+			for i := range x {
+				if stdmath.Abs(float64(x[i]-want[i])) > 1e-6 {
+					t.Fatalf("x[%d] = %v, want %v", i, x[i], want[i])
+				}
+			}
+			if stdmath.Abs(float64(got-wantSum)) > 1e-4*max(1, stdmath.Abs(float64(wantSum))) {
+				t.Errorf("sum = %v, want %v", got, wantSum)
+			}
+		})
+	}
+}
+
+func TestScaleShiftTanhSumFloat64(t *testing.T) {
+	x := make([]float64, 37)
+	want := 0.0
+	for i := range x {
+		x[i] = float64(i) / 10
+		want += stdmath.Tanh(x[i]*2 - 1)
+	}
+	got := ScaleShiftTanhSum(x, 2, -1)
+	if stdmath.Abs(got-want) > 1e-7*float64(len(x)) {
+		t.Errorf("sum = %v, want %v", got, want)
+	}
+	for i := range x {
+		if w := stdmath.Tanh(float64(i)/10*2 - 1); stdmath.Abs(x[i]-w) > 1e-7 {
+			t.Fatalf("x[%d] = %v, want %v", i, x[i], w)
+		}
+	}
+}
+
+func BenchmarkScaleShiftTanhSum(b *testing.B) {
+	x := make([]float32, 4096)
+	b.Run("fused", func(b *testing.B) {
+		for range b.N {
+			ScaleShiftTanhSum(x, 0.5, 0.25)
+		}
+	})
+	b.Run("sequential", func(b *testing.B) {
+		for range b.N {
+			vec.Scale(float32(0.5), x)
+			vec.AddConst(float32(0.25), x)
+			activation.Tanh(x, x)
+			vec.Sum(x)
+		}
+	})
+}
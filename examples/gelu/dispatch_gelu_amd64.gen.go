@@ -64,6 +64,18 @@ func GELUApprox[T hwy.Floats](input []T, output []T) {
 
 func init() {
 	initGeluAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gelu",
+		Groups: []hwy.DispatchGroup{
+			{Name: "GELU", Vars: []any{&GELUFloat16, &GELUBFloat16, &GELUFloat32, &GELUFloat64}},
+			{Name: "GELUApprox", Vars: []any{&GELUApproxFloat16, &GELUApproxBFloat16, &GELUApproxFloat32, &GELUApproxFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initGeluAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initGeluAVX2},
+			{Name: "fallback", Supported: true, Init: initGeluFallback},
+		},
+	})
 }
 
 func initGeluAll() {
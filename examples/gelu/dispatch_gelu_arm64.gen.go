@@ -62,6 +62,17 @@ func GELUApprox[T hwy.Floats](input []T, output []T) {
 
 func init() {
 	initGeluAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gelu",
+		Groups: []hwy.DispatchGroup{
+			{Name: "GELU", Vars: []any{&GELUFloat16, &GELUBFloat16, &GELUFloat32, &GELUFloat64}},
+			{Name: "GELUApprox", Vars: []any{&GELUApproxFloat16, &GELUApproxBFloat16, &GELUApproxFloat32, &GELUApproxFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initGeluNEONAsm},
+			{Name: "fallback", Supported: true, Init: initGeluFallback},
+		},
+	})
 }
 
 func initGeluAll() {
@@ -0,0 +1,72 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package gelu
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("gelu", "GELU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := GELUFloat16; hwyImpl != nil {
+			GELUFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := GELUBFloat16; hwyImpl != nil {
+			GELUBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := GELUFloat32; hwyImpl != nil {
+			GELUFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := GELUFloat64; hwyImpl != nil {
+			GELUFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("gelu", "GELUApprox", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := GELUApproxFloat16; hwyImpl != nil {
+			GELUApproxFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := GELUApproxBFloat16; hwyImpl != nil {
+			GELUApproxBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := GELUApproxFloat32; hwyImpl != nil {
+			GELUApproxFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := GELUApproxFloat64; hwyImpl != nil {
+			GELUApproxFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
@@ -60,6 +60,18 @@ func SoftmaxScalar[T hwy.Floats](input []T, output []T) {
 
 func init() {
 	initSoftmaxAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "softmax",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Softmax", Vars: []any{&SoftmaxFloat16, &SoftmaxBFloat16, &SoftmaxFloat32, &SoftmaxFloat64}},
+			{Name: "SoftmaxScalar", Vars: []any{&SoftmaxScalarFloat16, &SoftmaxScalarBFloat16, &SoftmaxScalarFloat32, &SoftmaxScalarFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initSoftmaxAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initSoftmaxAVX2},
+			{Name: "fallback", Supported: true, Init: initSoftmaxFallback},
+		},
+	})
 }
 
 func initSoftmaxAll() {
@@ -58,6 +58,17 @@ func SoftmaxScalar[T hwy.Floats](input []T, output []T) {
 
 func init() {
 	initSoftmaxAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "softmax",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Softmax", Vars: []any{&SoftmaxFloat16, &SoftmaxBFloat16, &SoftmaxFloat32, &SoftmaxFloat64}},
+			{Name: "SoftmaxScalar", Vars: []any{&SoftmaxScalarFloat16, &SoftmaxScalarBFloat16, &SoftmaxScalarFloat32, &SoftmaxScalarFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initSoftmaxNEONAsm},
+			{Name: "fallback", Supported: true, Init: initSoftmaxFallback},
+		},
+	})
 }
 
 func initSoftmaxAll() {
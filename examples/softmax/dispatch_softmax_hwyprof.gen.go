@@ -0,0 +1,72 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package softmax
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("softmax", "Softmax", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SoftmaxFloat16; hwyImpl != nil {
+			SoftmaxFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxBFloat16; hwyImpl != nil {
+			SoftmaxBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxFloat32; hwyImpl != nil {
+			SoftmaxFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxFloat64; hwyImpl != nil {
+			SoftmaxFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("softmax", "SoftmaxScalar", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SoftmaxScalarFloat16; hwyImpl != nil {
+			SoftmaxScalarFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxScalarBFloat16; hwyImpl != nil {
+			SoftmaxScalarBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxScalarFloat32; hwyImpl != nil {
+			SoftmaxScalarFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxScalarFloat64; hwyImpl != nil {
+			SoftmaxScalarFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
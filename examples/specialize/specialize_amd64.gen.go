@@ -39,6 +39,17 @@ func MulAdd[T hwy.Floats](x []T, y []T, out []T) {
 
 func init() {
 	initSpecializeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "specialize",
+		Groups: []hwy.DispatchGroup{
+			{Name: "MulAdd", Vars: []any{&MulAddFloat32, &MulAddFloat64, &MulAddFloat16, &MulAddBFloat16}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initSpecializeAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initSpecializeAVX2},
+			{Name: "fallback", Supported: true, Init: initSpecializeFallback},
+		},
+	})
 }
 
 func initSpecializeAll() {
@@ -37,6 +37,16 @@ func MulAdd[T hwy.Floats](x []T, y []T, out []T) {
 
 func init() {
 	initSpecializeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "specialize",
+		Groups: []hwy.DispatchGroup{
+			{Name: "MulAdd", Vars: []any{&MulAddFloat32, &MulAddFloat64, &MulAddFloat16, &MulAddBFloat16}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initSpecializeNEONAsm},
+			{Name: "fallback", Supported: true, Init: initSpecializeFallback},
+		},
+	})
 }
 
 func initSpecializeAll() {
@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package specialize
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("specialize", "MulAdd", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MulAddFloat32; hwyImpl != nil {
+			MulAddFloat32 = func(x []float32, y []float32, out []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, y, out)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(y)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := MulAddFloat64; hwyImpl != nil {
+			MulAddFloat64 = func(x []float64, y []float64, out []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, y, out)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(y)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := MulAddFloat16; hwyImpl != nil {
+			MulAddFloat16 = func(x []hwy.Float16, y []hwy.Float16, out []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, y, out)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(y)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := MulAddBFloat16; hwyImpl != nil {
+			MulAddBFloat16 = func(x []hwy.BFloat16, y []hwy.BFloat16, out []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, y, out)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(y)+hwy.SliceBytes(out))
+			}
+		}
+	})
+}
@@ -37,6 +37,15 @@ func MulAdd[T hwy.Floats](x []T, y []T, out []T) {
 
 func init() {
 	initSpecializeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "specialize",
+		Groups: []hwy.DispatchGroup{
+			{Name: "MulAdd", Vars: []any{&MulAddFloat32, &MulAddFloat64, &MulAddFloat16, &MulAddBFloat16}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initSpecializeFallback},
+		},
+	})
 }
 
 func initSpecializeAll() {
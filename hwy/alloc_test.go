@@ -0,0 +1,69 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package hwy
+
+import "testing"
+
+// Package-level sinks keep the results of the ops under test live.
+var (
+	allocSinkVec  Vec[float32]
+	allocSinkMask Mask[float32]
+	allocSinkInt  int
+	allocSinkBool bool
+)
+
+// TestOpsNoAllocs checks that the portable Vec and Mask ops run without
+// heap allocations.
+func TestOpsNoAllocs(t *testing.T) {
+	src := make([]float32, 64)
+	dst := make([]float32, 64)
+	for i := range src {
+		src[i] = float32(i)
+	}
+	a := Load(src)
+	b := Set[float32](8)
+	m := LessThan(a, b)
+	ops := []struct {
+		name string
+		fn   func()
+	}{
+		{"Zero", func() { allocSinkVec = Zero[float32]() }},
+		{"Load", func() { allocSinkVec = Load(src) }},
+		{"Set", func() { allocSinkVec = Set[float32](1) }},
+		{"Undefined", func() { allocSinkVec = Undefined[float32]() }},
+		{"Store", func() { Store(a, dst) }},
+		{"Add", func() { allocSinkVec = Add(a, b) }},
+		{"IfThenElse", func() { allocSinkVec = IfThenElse(m, a, b) }},
+		{"MaskLoad", func() { allocSinkVec = MaskLoad(m, src) }},
+		{"MaskStore", func() { MaskStore(m, a, dst) }},
+		{"LessThan", func() { allocSinkMask = LessThan(a, b) }},
+		{"Equal", func() { allocSinkMask = Equal(a, b) }},
+		{"FirstN", func() { allocSinkMask = FirstN[float32](3) }},
+		{"MaskAnd", func() { allocSinkMask = MaskAnd(m, m) }},
+		{"MaskOr", func() { allocSinkMask = MaskOr(m, m) }},
+		{"MaskXor", func() { allocSinkMask = MaskXor(m, m) }},
+		{"MaskNot", func() { allocSinkMask = MaskNot(m) }},
+		{"MaskAndNot", func() { allocSinkMask = MaskAndNot(m, m) }},
+		{"CountTrue", func() { allocSinkInt = CountTrue(m) }},
+		{"FindFirstTrue", func() { allocSinkInt = FindFirstTrue(m) }},
+		{"AllTrue", func() { allocSinkBool = AllTrue(m) }},
+		{"AllFalse", func() { allocSinkBool = AllFalse(m) }},
+	}
+	for _, op := range ops {
+		if allocs := testing.AllocsPerRun(10, op.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", op.name, allocs)
+		}
+	}
+}
@@ -97,6 +97,8 @@ func (v Uint8x16) And(other Uint8x16) Uint8x16         { panic("NEON not availab
 func (v Uint8x16) Or(other Uint8x16) Uint8x16          { panic("NEON not available") }
 func (v Uint8x16) Xor(other Uint8x16) Uint8x16         { panic("NEON not available") }
 func (v Uint8x16) Not() Uint8x16                       { panic("NEON not available") }
+func (v Uint8x16) PromoteLowerToUint16() Uint16x8      { panic("NEON not available") }
+func (v Uint8x16) PromoteUpperToUint16() Uint16x8      { panic("NEON not available") }
 func (v Uint8x16) TableLookupBytes(idx Uint8x16) Uint8x16 {
 	// Scalar fallback implementation
 	var result [16]uint8
@@ -214,6 +216,7 @@ func (v Uint64x2) And(other Uint64x2) Uint64x2         { panic("NEON not availab
 func (v Uint64x2) Or(other Uint64x2) Uint64x2          { panic("NEON not available") }
 func (v Uint64x2) Xor(other Uint64x2) Uint64x2         { panic("NEON not available") }
 func (v Uint64x2) Not() Uint64x2                       { panic("NEON not available") }
+func (v Uint64x2) PopCount() Uint64x2                  { panic("NEON not available") }
 func (v Uint64x2) ShiftAllLeft(count int) Uint64x2     { panic("NEON not available") }
 func (v Uint64x2) ShiftAllRight(count int) Uint64x2    { panic("NEON not available") }
 func (v Uint64x2) Merge(other Uint64x2, mask Uint64x2) Uint64x2 { panic("NEON not available") }
@@ -446,6 +449,8 @@ func and_u8x16(a, b [16]byte) [16]byte  { panic("NEON not available") }
 func or_u8x16(a, b [16]byte) [16]byte   { panic("NEON not available") }
 func xor_u8x16(a, b [16]byte) [16]byte  { panic("NEON not available") }
 func not_u8x16(a [16]byte) [16]byte     { panic("NEON not available") }
+func promotelo_u8x16(a [16]byte) [16]byte { panic("NEON not available") }
+func promotehi_u8x16(a [16]byte) [16]byte { panic("NEON not available") }
 
 // Uint16x8 stubs
 func lt_u16x8(a, b [16]byte) [16]byte   { panic("NEON not available") }
@@ -498,6 +503,7 @@ func and_u64x2(a, b [16]byte) [16]byte          { panic("NEON not available") }
 func or_u64x2(a, b [16]byte) [16]byte           { panic("NEON not available") }
 func xor_u64x2(a, b [16]byte) [16]byte          { panic("NEON not available") }
 func sel_u64x2(mask, yes, no [16]byte) [16]byte { panic("NEON not available") }
+func popcnt_u64x2(a [16]byte) [16]byte            { panic("NEON not available") }
 
 // SlideUpLanes stubs
 func SlideUpLanesFloat32x4(v Float32x4, offset int) Float32x4 { panic("NEON not available") }
@@ -2998,6 +2998,35 @@ func BenchmarkReduceMaxF64_NEON(b *testing.B) {
 // Unsigned Integer Vector Tests
 // ============================================================================
 
+func TestUint8x16_Promote(t *testing.T) {
+	var src [16]uint8
+	for i := range src {
+		src[i] = uint8(250 + i)
+	}
+	v := LoadUint8x16Slice(src[:])
+
+	lo := v.PromoteLowerToUint16()
+	hi := v.PromoteUpperToUint16()
+	for i := range 8 {
+		if got := lo.Get(i); got != uint16(src[i]) {
+			t.Errorf("PromoteLowerToUint16[%d]: got %d, want %d", i, got, src[i])
+		}
+		if got := hi.Get(i); got != uint16(src[8+i]) {
+			t.Errorf("PromoteUpperToUint16[%d]: got %d, want %d", i, got, src[8+i])
+		}
+	}
+}
+
+func TestUint64x2_PopCount(t *testing.T) {
+	src := [2]uint64{0xffff_ffff_ffff_ffff, 0x8000_0000_0000_0f01}
+	got := LoadUint64x2Slice(src[:]).PopCount()
+	for i, want := range []uint64{64, 6} {
+		if got.Get(i) != want {
+			t.Errorf("PopCount[%d]: got %d, want %d", i, got.Get(i), want)
+		}
+	}
+}
+
 func TestUint8x16_Saturating(t *testing.T) {
 	// Test saturating add at boundary
 	a := BroadcastUint8x16(250)
@@ -2330,6 +2330,16 @@ func (v Uint8x16) Not() Uint8x16 {
 	return Uint8x16(not_u8x16([16]byte(v)))
 }
 
+// PromoteLowerToUint16 zero-extends lanes 0-7 to uint16 (UXTL).
+func (v Uint8x16) PromoteLowerToUint16() Uint16x8 {
+	return Uint16x8(promotelo_u8x16([16]byte(v)))
+}
+
+// PromoteUpperToUint16 zero-extends lanes 8-15 to uint16 (UXTL2).
+func (v Uint8x16) PromoteUpperToUint16() Uint16x8 {
+	return Uint16x8(promotehi_u8x16([16]byte(v)))
+}
+
 // GetBit returns true if the element at index i is non-zero.
 func (v Uint8x16) GetBit(i int) bool {
 	return v[i] != 0
@@ -2845,6 +2855,11 @@ func (v Uint64x2) Not() Uint64x2 {
 	return Uint64x2(xor_u64x2([16]byte(v), allOnes))
 }
 
+// PopCount returns the number of set bits in each lane (CNT + UADDLP).
+func (v Uint64x2) PopCount() Uint64x2 {
+	return Uint64x2(popcnt_u64x2([16]byte(v)))
+}
+
 // ShiftAllLeft shifts all elements left by the given count.
 func (v Uint64x2) ShiftAllLeft(count int) Uint64x2 {
 	a := (*[2]uint64)(unsafe.Pointer(&v))
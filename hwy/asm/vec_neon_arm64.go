@@ -295,6 +295,12 @@ func xor_u8x16(a, b [16]byte) (result [16]byte)
 //go:noescape
 func not_u8x16(a [16]byte) (result [16]byte)
 
+//go:noescape
+func promotelo_u8x16(a [16]byte) (result [16]byte)
+
+//go:noescape
+func promotehi_u8x16(a [16]byte) (result [16]byte)
+
 //go:noescape
 func lt_u16x8(a, b [16]byte) (result [16]byte)
 
@@ -433,6 +439,9 @@ func xor_u64x2(a, b [16]byte) (result [16]byte)
 //go:noescape
 func sel_u64x2(mask, yes, no [16]byte) (result [16]byte)
 
+//go:noescape
+func popcnt_u64x2(a [16]byte) (result [16]byte)
+
 //go:noescape
 func slide_up_1_f32x4(v [16]byte) (result [16]byte)
 
@@ -1362,6 +1362,30 @@ TEXT ·not_u8x16(SB), $0-32
 	MOVD R10, result_8+24(FP)
 	RET
 
+TEXT ·promotelo_u8x16(SB), $0-32
+	MOVD a_0+0(FP), R9
+	MOVD a_8+8(FP), R10
+	VMOV R9, V0.D[0]
+	VMOV R10, V0.D[1]
+	WORD $0x2f08a400          // ushll.8h	v0, v0, #0
+	VMOV V0.D[0], R9
+	VMOV V0.D[1], R10
+	MOVD R9, result_0+16(FP)
+	MOVD R10, result_8+24(FP)
+	RET
+
+TEXT ·promotehi_u8x16(SB), $0-32
+	MOVD a_0+0(FP), R9
+	MOVD a_8+8(FP), R10
+	VMOV R9, V0.D[0]
+	VMOV R10, V0.D[1]
+	WORD $0x6f08a400          // ushll2.8h	v0, v0, #0
+	VMOV V0.D[0], R9
+	VMOV V0.D[1], R10
+	MOVD R9, result_0+16(FP)
+	MOVD R10, result_8+24(FP)
+	RET
+
 TEXT ·lt_u16x8(SB), $0-48
 	MOVD a_0+0(FP), R9
 	MOVD a_8+8(FP), R10
@@ -2090,6 +2114,21 @@ TEXT ·sel_u64x2(SB), $0-64
 	MOVD R10, result_8+56(FP)
 	RET
 
+TEXT ·popcnt_u64x2(SB), $0-32
+	MOVD a_0+0(FP), R9
+	MOVD a_8+8(FP), R10
+	VMOV R9, V0.D[0]
+	VMOV R10, V0.D[1]
+	WORD $0x4e205800          // cnt.16b	v0, v0
+	WORD $0x6e202800          // uaddlp.8h	v0, v0
+	WORD $0x6e602800          // uaddlp.4s	v0, v0
+	WORD $0x6ea02800          // uaddlp.2d	v0, v0
+	VMOV V0.D[0], R9
+	VMOV V0.D[1], R10
+	MOVD R9, result_0+16(FP)
+	MOVD R10, result_8+24(FP)
+	RET
+
 TEXT ·slide_up_1_f32x4(SB), $0-32
 	MOVD v_0+0(FP), R9
 	MOVD v_8+8(FP), R10
@@ -337,7 +337,7 @@ func TestAddBF16(t *testing.T) {
 	result := AddBF16(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := BFloat16ToFloat32(result.data[i])
+		got := BFloat16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-5.0)) > 0.01 {
 			t.Errorf("AddBF16: lane %d: got %v, want 5.0", i, got)
 		}
@@ -351,7 +351,7 @@ func TestSubBF16(t *testing.T) {
 	result := SubBF16(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := BFloat16ToFloat32(result.data[i])
+		got := BFloat16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-3.0)) > 0.01 {
 			t.Errorf("SubBF16: lane %d: got %v, want 3.0", i, got)
 		}
@@ -365,7 +365,7 @@ func TestMulBF16(t *testing.T) {
 	result := MulBF16(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := BFloat16ToFloat32(result.data[i])
+		got := BFloat16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-12.0)) > 0.1 {
 			t.Errorf("MulBF16: lane %d: got %v, want 12.0", i, got)
 		}
@@ -379,7 +379,7 @@ func TestDivBF16(t *testing.T) {
 	result := DivBF16(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := BFloat16ToFloat32(result.data[i])
+		got := BFloat16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-4.0)) > 0.1 {
 			t.Errorf("DivBF16: lane %d: got %v, want 4.0", i, got)
 		}
@@ -394,7 +394,7 @@ func TestFMABF16(t *testing.T) {
 	result := FMABF16(a, b, c) // 2*3 + 4 = 10
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := BFloat16ToFloat32(result.data[i])
+		got := BFloat16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-10.0)) > 0.1 {
 			t.Errorf("FMABF16: lane %d: got %v, want 10.0", i, got)
 		}
@@ -407,7 +407,7 @@ func TestNegBF16(t *testing.T) {
 	result := NegBF16(v)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := BFloat16ToFloat32(result.data[i])
+		got := BFloat16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-(-5.0))) > 0.01 {
 			t.Errorf("NegBF16: lane %d: got %v, want -5.0", i, got)
 		}
@@ -420,7 +420,7 @@ func TestAbsBF16(t *testing.T) {
 	result := AbsBF16(v)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := BFloat16ToFloat32(result.data[i])
+		got := BFloat16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-7.0)) > 0.01 {
 			t.Errorf("AbsBF16: lane %d: got %v, want 7.0", i, got)
 		}
@@ -436,8 +436,8 @@ func TestMinMaxBF16(t *testing.T) {
 	maxResult := MaxBF16(a, b)
 
 	for i := 0; i < minResult.NumLanes(); i++ {
-		gotMin := BFloat16ToFloat32(minResult.data[i])
-		gotMax := BFloat16ToFloat32(maxResult.data[i])
+		gotMin := BFloat16ToFloat32(minResult.data()[i])
+		gotMax := BFloat16ToFloat32(maxResult.data()[i])
 		if math.Abs(float64(gotMin-3.0)) > 0.01 {
 			t.Errorf("MinBF16: lane %d: got %v, want 3.0", i, gotMin)
 		}
@@ -453,7 +453,7 @@ func TestSqrtBF16(t *testing.T) {
 	result := SqrtBF16(v)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := BFloat16ToFloat32(result.data[i])
+		got := BFloat16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-4.0)) > 0.1 {
 			t.Errorf("SqrtBF16: lane %d: got %v, want 4.0", i, got)
 		}
@@ -466,7 +466,7 @@ func TestReciprocalBF16(t *testing.T) {
 	result := ReciprocalBF16(v)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := BFloat16ToFloat32(result.data[i])
+		got := BFloat16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-0.25)) > 0.01 {
 			t.Errorf("ReciprocalBF16: lane %d: got %v, want 0.25", i, got)
 		}
@@ -476,11 +476,12 @@ func TestReciprocalBF16(t *testing.T) {
 // TestReduceSumBF16 tests BFloat16 reduction sum.
 func TestReduceSumBF16(t *testing.T) {
 	// Create a vector with known values
-	data := make([]BFloat16, MaxLanes[BFloat16]())
+	out := makeVec[BFloat16](MaxLanes[BFloat16]())
+	data := out.data()
 	for i := range data {
 		data[i] = Float32ToBFloat16(float32(i + 1))
 	}
-	v := Vec[BFloat16]{data: data}
+	v := out
 
 	sum := ReduceSumBF16(v)
 
@@ -504,7 +505,7 @@ func TestReduceMinMaxBF16(t *testing.T) {
 		Float32ToBFloat16(8.0),
 		Float32ToBFloat16(1.0),
 	}
-	v := Vec[BFloat16]{data: data}
+	v := vecFrom(data)
 
 	min := ReduceMinBF16(v)
 	max := ReduceMaxBF16(v)
@@ -519,18 +520,18 @@ func TestReduceMinMaxBF16(t *testing.T) {
 
 // TestDotBF16 tests BFloat16 dot product.
 func TestDotBF16(t *testing.T) {
-	a := Vec[BFloat16]{data: []BFloat16{
+	a := vecFrom([]BFloat16{
 		Float32ToBFloat16(1.0),
 		Float32ToBFloat16(2.0),
 		Float32ToBFloat16(3.0),
 		Float32ToBFloat16(4.0),
-	}}
-	b := Vec[BFloat16]{data: []BFloat16{
+	})
+	b := vecFrom([]BFloat16{
 		Float32ToBFloat16(1.0),
 		Float32ToBFloat16(1.0),
 		Float32ToBFloat16(1.0),
 		Float32ToBFloat16(1.0),
-	}}
+	})
 
 	dot := DotBF16(a, b)
 	// 1*1 + 2*1 + 3*1 + 4*1 = 10
@@ -541,18 +542,18 @@ func TestDotBF16(t *testing.T) {
 
 // TestComparisonBF16 tests BFloat16 comparison operations.
 func TestComparisonBF16(t *testing.T) {
-	a := Vec[BFloat16]{data: []BFloat16{
+	a := vecFrom([]BFloat16{
 		Float32ToBFloat16(1.0),
 		Float32ToBFloat16(5.0),
 		Float32ToBFloat16(3.0),
 		Float32ToBFloat16(7.0),
-	}}
-	b := Vec[BFloat16]{data: []BFloat16{
+	})
+	b := vecFrom([]BFloat16{
 		Float32ToBFloat16(1.0),
 		Float32ToBFloat16(3.0),
 		Float32ToBFloat16(5.0),
 		Float32ToBFloat16(7.0),
-	}}
+	})
 
 	t.Run("Equal", func(t *testing.T) {
 		mask := EqualBF16(a, b)
@@ -593,12 +594,12 @@ func TestComparisonBF16(t *testing.T) {
 
 // TestIsNaNBF16 tests BFloat16 NaN detection.
 func TestIsNaNBF16(t *testing.T) {
-	v := Vec[BFloat16]{data: []BFloat16{
+	v := vecFrom([]BFloat16{
 		BFloat16One,
 		BFloat16NaN,
 		BFloat16Inf,
 		BFloat16(0x7FC1), // Another NaN
-	}}
+	})
 
 	mask := IsNaNBF16(v)
 
@@ -618,12 +619,12 @@ func TestIsNaNBF16(t *testing.T) {
 
 // TestIsInfBF16 tests BFloat16 infinity detection.
 func TestIsInfBF16(t *testing.T) {
-	v := Vec[BFloat16]{data: []BFloat16{
+	v := vecFrom([]BFloat16{
 		BFloat16One,
 		BFloat16Inf,
 		BFloat16NegInf,
 		BFloat16NaN,
-	}}
+	})
 
 	t.Run("AnyInf", func(t *testing.T) {
 		mask := IsInfBF16(v, 0)
@@ -664,18 +665,18 @@ func TestIsInfBF16(t *testing.T) {
 
 // TestIfThenElseBF16 tests BFloat16 conditional selection.
 func TestIfThenElseBF16(t *testing.T) {
-	a := Vec[BFloat16]{data: []BFloat16{
+	a := vecFrom([]BFloat16{
 		Float32ToBFloat16(1.0),
 		Float32ToBFloat16(2.0),
 		Float32ToBFloat16(3.0),
 		Float32ToBFloat16(4.0),
-	}}
-	b := Vec[BFloat16]{data: []BFloat16{
+	})
+	b := vecFrom([]BFloat16{
 		Float32ToBFloat16(1.0),
 		Float32ToBFloat16(1.0),
 		Float32ToBFloat16(3.0),
 		Float32ToBFloat16(1.0),
-	}}
+	})
 
 	mask := EqualBF16(a, b) // true, false, true, false
 	yes := SetBF16FromF32(100.0)
@@ -683,13 +684,13 @@ func TestIfThenElseBF16(t *testing.T) {
 
 	result := IfThenElseBF16(mask, yes, no)
 
-	if BFloat16ToFloat32(result.data[0]) != 100.0 {
+	if BFloat16ToFloat32(result.data()[0]) != 100.0 {
 		t.Errorf("IfThenElseBF16: lane 0 should be 100.0 (mask true)")
 	}
-	if BFloat16ToFloat32(result.data[1]) != 0.0 {
+	if BFloat16ToFloat32(result.data()[1]) != 0.0 {
 		t.Errorf("IfThenElseBF16: lane 1 should be 0.0 (mask false)")
 	}
-	if BFloat16ToFloat32(result.data[2]) != 100.0 {
+	if BFloat16ToFloat32(result.data()[2]) != 100.0 {
 		t.Errorf("IfThenElseBF16: lane 2 should be 100.0 (mask true)")
 	}
 }
@@ -697,30 +698,30 @@ func TestIfThenElseBF16(t *testing.T) {
 // TestPromoteDemoteBF16 tests BFloat16 promotion and demotion operations.
 func TestPromoteDemoteBF16(t *testing.T) {
 	t.Run("PromoteBF16ToF32", func(t *testing.T) {
-		v := Vec[BFloat16]{data: []BFloat16{
+		v := vecFrom([]BFloat16{
 			Float32ToBFloat16(1.0),
 			Float32ToBFloat16(2.0),
 			Float32ToBFloat16(3.0),
 			Float32ToBFloat16(4.0),
-		}}
+		})
 
 		result := PromoteBF16ToF32(v)
 
-		for i := 0; i < len(v.data); i++ {
+		for i := 0; i < v.NumLanes(); i++ {
 			expected := float32(i + 1)
-			if math.Abs(float64(result.data[i]-expected)) > 0.01 {
-				t.Errorf("PromoteBF16ToF32: lane %d: got %v, want %v", i, result.data[i], expected)
+			if math.Abs(float64(result.data()[i]-expected)) > 0.01 {
+				t.Errorf("PromoteBF16ToF32: lane %d: got %v, want %v", i, result.data()[i], expected)
 			}
 		}
 	})
 
 	t.Run("DemoteF32ToBF16", func(t *testing.T) {
-		v := Vec[float32]{data: []float32{1.0, 2.0, 3.0, 4.0}}
+		v := vecFrom([]float32{1.0, 2.0, 3.0, 4.0})
 
 		result := DemoteF32ToBF16(v)
 
-		for i := 0; i < len(v.data); i++ {
-			got := BFloat16ToFloat32(result.data[i])
+		for i := 0; i < v.NumLanes(); i++ {
+			got := BFloat16ToFloat32(result.data()[i])
 			expected := float32(i + 1)
 			if math.Abs(float64(got-expected)) > 0.01 {
 				t.Errorf("DemoteF32ToBF16: lane %d: got %v, want %v", i, got, expected)
@@ -729,56 +730,56 @@ func TestPromoteDemoteBF16(t *testing.T) {
 	})
 
 	t.Run("PromoteLowerBF16ToF32", func(t *testing.T) {
-		v := Vec[BFloat16]{data: []BFloat16{
+		v := vecFrom([]BFloat16{
 			Float32ToBFloat16(1.0),
 			Float32ToBFloat16(2.0),
 			Float32ToBFloat16(3.0),
 			Float32ToBFloat16(4.0),
-		}}
+		})
 
 		result := PromoteLowerBF16ToF32(v)
 
 		// Should only contain lower half (1.0, 2.0)
-		if len(result.data) != 2 {
-			t.Errorf("PromoteLowerBF16ToF32: expected 2 elements, got %d", len(result.data))
+		if result.NumLanes() != 2 {
+			t.Errorf("PromoteLowerBF16ToF32: expected 2 elements, got %d", result.NumLanes())
 		}
-		if result.data[0] != 1.0 || result.data[1] != 2.0 {
-			t.Errorf("PromoteLowerBF16ToF32: got %v, want [1.0, 2.0]", result.data)
+		if result.data()[0] != 1.0 || result.data()[1] != 2.0 {
+			t.Errorf("PromoteLowerBF16ToF32: got %v, want [1.0, 2.0]", result.data())
 		}
 	})
 
 	t.Run("PromoteUpperBF16ToF32", func(t *testing.T) {
-		v := Vec[BFloat16]{data: []BFloat16{
+		v := vecFrom([]BFloat16{
 			Float32ToBFloat16(1.0),
 			Float32ToBFloat16(2.0),
 			Float32ToBFloat16(3.0),
 			Float32ToBFloat16(4.0),
-		}}
+		})
 
 		result := PromoteUpperBF16ToF32(v)
 
 		// Should only contain upper half (3.0, 4.0)
-		if len(result.data) != 2 {
-			t.Errorf("PromoteUpperBF16ToF32: expected 2 elements, got %d", len(result.data))
+		if result.NumLanes() != 2 {
+			t.Errorf("PromoteUpperBF16ToF32: expected 2 elements, got %d", result.NumLanes())
 		}
-		if result.data[0] != 3.0 || result.data[1] != 4.0 {
-			t.Errorf("PromoteUpperBF16ToF32: got %v, want [3.0, 4.0]", result.data)
+		if result.data()[0] != 3.0 || result.data()[1] != 4.0 {
+			t.Errorf("PromoteUpperBF16ToF32: got %v, want [3.0, 4.0]", result.data())
 		}
 	})
 
 	t.Run("DemoteTwoF32ToBF16", func(t *testing.T) {
-		lo := Vec[float32]{data: []float32{1.0, 2.0}}
-		hi := Vec[float32]{data: []float32{3.0, 4.0}}
+		lo := vecFrom([]float32{1.0, 2.0})
+		hi := vecFrom([]float32{3.0, 4.0})
 
 		result := DemoteTwoF32ToBF16(lo, hi)
 
-		if len(result.data) != 4 {
-			t.Errorf("DemoteTwoF32ToBF16: expected 4 elements, got %d", len(result.data))
+		if result.NumLanes() != 4 {
+			t.Errorf("DemoteTwoF32ToBF16: expected 4 elements, got %d", result.NumLanes())
 		}
 
 		expected := []float32{1.0, 2.0, 3.0, 4.0}
 		for i, exp := range expected {
-			got := BFloat16ToFloat32(result.data[i])
+			got := BFloat16ToFloat32(result.data()[i])
 			if math.Abs(float64(got-exp)) > 0.01 {
 				t.Errorf("DemoteTwoF32ToBF16: lane %d: got %v, want %v", i, got, exp)
 			}
@@ -786,31 +787,31 @@ func TestPromoteDemoteBF16(t *testing.T) {
 	})
 
 	t.Run("PromoteBF16ToF64", func(t *testing.T) {
-		v := Vec[BFloat16]{data: []BFloat16{
+		v := vecFrom([]BFloat16{
 			Float32ToBFloat16(1.0),
 			Float32ToBFloat16(2.0),
-		}}
+		})
 
 		result := PromoteBF16ToF64(v)
 
-		if len(result.data) != 2 {
-			t.Errorf("PromoteBF16ToF64: expected 2 elements, got %d", len(result.data))
+		if result.NumLanes() != 2 {
+			t.Errorf("PromoteBF16ToF64: expected 2 elements, got %d", result.NumLanes())
 		}
-		if result.data[0] != 1.0 || result.data[1] != 2.0 {
-			t.Errorf("PromoteBF16ToF64: got %v, want [1.0, 2.0]", result.data)
+		if result.data()[0] != 1.0 || result.data()[1] != 2.0 {
+			t.Errorf("PromoteBF16ToF64: got %v, want [1.0, 2.0]", result.data())
 		}
 	})
 
 	t.Run("DemoteF64ToBF16", func(t *testing.T) {
-		v := Vec[float64]{data: []float64{1.0, 2.0}}
+		v := vecFrom([]float64{1.0, 2.0})
 
 		result := DemoteF64ToBF16(v)
 
-		if len(result.data) != 2 {
-			t.Errorf("DemoteF64ToBF16: expected 2 elements, got %d", len(result.data))
+		if result.NumLanes() != 2 {
+			t.Errorf("DemoteF64ToBF16: expected 2 elements, got %d", result.NumLanes())
 		}
-		got0 := BFloat16ToFloat32(result.data[0])
-		got1 := BFloat16ToFloat32(result.data[1])
+		got0 := BFloat16ToFloat32(result.data()[0])
+		got1 := BFloat16ToFloat32(result.data()[1])
 		if got0 != 1.0 || got1 != 2.0 {
 			t.Errorf("DemoteF64ToBF16: got [%v, %v], want [1.0, 2.0]", got0, got1)
 		}
@@ -824,14 +825,14 @@ func TestLoadStoreBF16(t *testing.T) {
 		v := LoadBF16(src)
 
 		for i := 0; i < len(src) && i < v.NumLanes(); i++ {
-			if v.data[i] != BFloat16(src[i]) {
-				t.Errorf("LoadBF16: lane %d: got 0x%04X, want 0x%04X", i, v.data[i], src[i])
+			if v.data()[i] != BFloat16(src[i]) {
+				t.Errorf("LoadBF16: lane %d: got 0x%04X, want 0x%04X", i, v.data()[i], src[i])
 			}
 		}
 	})
 
 	t.Run("StoreBF16", func(t *testing.T) {
-		v := Vec[BFloat16]{data: []BFloat16{0x3F80, 0x4000, 0x4040, 0x4080}}
+		v := vecFrom([]BFloat16{0x3F80, 0x4000, 0x4040, 0x4080})
 		dst := make([]uint16, 4)
 		StoreBF16(v, dst)
 
@@ -848,7 +849,7 @@ func TestLoadStoreBF16(t *testing.T) {
 		v := LoadBF16FromF32(src)
 
 		for i := 0; i < len(src) && i < v.NumLanes(); i++ {
-			got := BFloat16ToFloat32(v.data[i])
+			got := BFloat16ToFloat32(v.data()[i])
 			if math.Abs(float64(got-src[i])) > 0.01 {
 				t.Errorf("LoadBF16FromF32: lane %d: got %v, want %v", i, got, src[i])
 			}
@@ -856,12 +857,12 @@ func TestLoadStoreBF16(t *testing.T) {
 	})
 
 	t.Run("StoreBF16ToF32", func(t *testing.T) {
-		v := Vec[BFloat16]{data: []BFloat16{
+		v := vecFrom([]BFloat16{
 			Float32ToBFloat16(1.0),
 			Float32ToBFloat16(2.0),
 			Float32ToBFloat16(3.0),
 			Float32ToBFloat16(4.0),
-		}}
+		})
 		dst := make([]float32, 4)
 		StoreBF16ToF32(v, dst)
 
@@ -879,8 +880,8 @@ func TestSetZeroBF16(t *testing.T) {
 	t.Run("SetBF16", func(t *testing.T) {
 		v := SetBF16(BFloat16One)
 		for i := 0; i < v.NumLanes(); i++ {
-			if v.data[i] != BFloat16One {
-				t.Errorf("SetBF16: lane %d: got 0x%04X, want 0x%04X", i, v.data[i], BFloat16One)
+			if v.data()[i] != BFloat16One {
+				t.Errorf("SetBF16: lane %d: got 0x%04X, want 0x%04X", i, v.data()[i], BFloat16One)
 			}
 		}
 	})
@@ -888,7 +889,7 @@ func TestSetZeroBF16(t *testing.T) {
 	t.Run("SetBF16FromF32", func(t *testing.T) {
 		v := SetBF16FromF32(2.0)
 		for i := 0; i < v.NumLanes(); i++ {
-			got := BFloat16ToFloat32(v.data[i])
+			got := BFloat16ToFloat32(v.data()[i])
 			if math.Abs(float64(got-2.0)) > 0.01 {
 				t.Errorf("SetBF16FromF32: lane %d: got %v, want 2.0", i, got)
 			}
@@ -898,8 +899,8 @@ func TestSetZeroBF16(t *testing.T) {
 	t.Run("ZeroBF16", func(t *testing.T) {
 		v := ZeroBF16()
 		for i := 0; i < v.NumLanes(); i++ {
-			if v.data[i] != BFloat16Zero {
-				t.Errorf("ZeroBF16: lane %d: got 0x%04X, want 0x0000", i, v.data[i])
+			if v.data()[i] != BFloat16Zero {
+				t.Errorf("ZeroBF16: lane %d: got 0x%04X, want 0x0000", i, v.data()[i])
 			}
 		}
 	})
@@ -907,12 +908,12 @@ func TestSetZeroBF16(t *testing.T) {
 
 // TestClampBF16 tests BFloat16 clamping.
 func TestClampBF16(t *testing.T) {
-	v := Vec[BFloat16]{data: []BFloat16{
+	v := vecFrom([]BFloat16{
 		Float32ToBFloat16(0.0),
 		Float32ToBFloat16(5.0),
 		Float32ToBFloat16(15.0),
 		Float32ToBFloat16(10.0),
-	}}
+	})
 	lo := SetBF16FromF32(2.0)
 	hi := SetBF16FromF32(12.0)
 
@@ -920,7 +921,7 @@ func TestClampBF16(t *testing.T) {
 
 	expected := []float32{2.0, 5.0, 12.0, 10.0}
 	for i, exp := range expected {
-		got := BFloat16ToFloat32(result.data[i])
+		got := BFloat16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-exp)) > 0.01 {
 			t.Errorf("ClampBF16: lane %d: got %v, want %v", i, got, exp)
 		}
@@ -936,7 +937,7 @@ func TestMulAddSubBF16(t *testing.T) {
 	t.Run("MulAddBF16", func(t *testing.T) {
 		// 2*3 + 4 = 10
 		result := MulAddBF16(a, b, c)
-		got := BFloat16ToFloat32(result.data[0])
+		got := BFloat16ToFloat32(result.data()[0])
 		if math.Abs(float64(got-10.0)) > 0.1 {
 			t.Errorf("MulAddBF16: got %v, want 10.0", got)
 		}
@@ -945,7 +946,7 @@ func TestMulAddSubBF16(t *testing.T) {
 	t.Run("MulSubBF16", func(t *testing.T) {
 		// 2*3 - 4 = 2
 		result := MulSubBF16(a, b, c)
-		got := BFloat16ToFloat32(result.data[0])
+		got := BFloat16ToFloat32(result.data()[0])
 		if math.Abs(float64(got-2.0)) > 0.1 {
 			t.Errorf("MulSubBF16: got %v, want 2.0", got)
 		}
@@ -954,7 +955,7 @@ func TestMulAddSubBF16(t *testing.T) {
 	t.Run("NegMulAddBF16", func(t *testing.T) {
 		// -2*3 + 4 = -2
 		result := NegMulAddBF16(a, b, c)
-		got := BFloat16ToFloat32(result.data[0])
+		got := BFloat16ToFloat32(result.data()[0])
 		if math.Abs(float64(got-(-2.0))) > 0.1 {
 			t.Errorf("NegMulAddBF16: got %v, want -2.0", got)
 		}
@@ -963,7 +964,7 @@ func TestMulAddSubBF16(t *testing.T) {
 	t.Run("NegMulSubBF16", func(t *testing.T) {
 		// -(2*3 + 4) = -10
 		result := NegMulSubBF16(a, b, c)
-		got := BFloat16ToFloat32(result.data[0])
+		got := BFloat16ToFloat32(result.data()[0])
 		if math.Abs(float64(got-(-10.0))) > 0.1 {
 			t.Errorf("NegMulSubBF16: got %v, want -10.0", got)
 		}
@@ -973,17 +974,17 @@ func TestMulAddSubBF16(t *testing.T) {
 // TestConvertF16BF16 tests cross-format conversion at vector level.
 func TestConvertF16BF16(t *testing.T) {
 	t.Run("ConvertF16ToBF16", func(t *testing.T) {
-		v := Vec[Float16]{data: []Float16{
+		v := vecFrom([]Float16{
 			Float32ToFloat16(1.0),
 			Float32ToFloat16(2.0),
 			Float32ToFloat16(3.0),
 			Float32ToFloat16(4.0),
-		}}
+		})
 
 		result := ConvertF16ToBF16(v)
 
-		for i := 0; i < len(v.data); i++ {
-			got := BFloat16ToFloat32(result.data[i])
+		for i := 0; i < v.NumLanes(); i++ {
+			got := BFloat16ToFloat32(result.data()[i])
 			expected := float32(i + 1)
 			if math.Abs(float64(got-expected)) > 0.1 {
 				t.Errorf("ConvertF16ToBF16: lane %d: got %v, want %v", i, got, expected)
@@ -992,17 +993,17 @@ func TestConvertF16BF16(t *testing.T) {
 	})
 
 	t.Run("ConvertBF16ToF16", func(t *testing.T) {
-		v := Vec[BFloat16]{data: []BFloat16{
+		v := vecFrom([]BFloat16{
 			Float32ToBFloat16(1.0),
 			Float32ToBFloat16(2.0),
 			Float32ToBFloat16(3.0),
 			Float32ToBFloat16(4.0),
-		}}
+		})
 
 		result := ConvertBF16ToF16(v)
 
-		for i := 0; i < len(v.data); i++ {
-			got := Float16ToFloat32(result.data[i])
+		for i := 0; i < v.NumLanes(); i++ {
+			got := Float16ToFloat32(result.data()[i])
 			expected := float32(i + 1)
 			if math.Abs(float64(got-expected)) > 0.1 {
 				t.Errorf("ConvertBF16ToF16: lane %d: got %v, want %v", i, got, expected)
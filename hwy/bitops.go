@@ -22,11 +22,12 @@ import "math/bits"
 
 // PopCount counts the number of set bits (1s) in each lane.
 func PopCount[T Integers](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = popCount(v.data[i])
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = popCount(v.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // popCount counts set bits for a single value.
@@ -55,11 +56,12 @@ func popCount[T Integers](val T) T {
 
 // LeadingZeroCount counts the number of leading zero bits in each lane.
 func LeadingZeroCount[T Integers](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = leadingZeroCount(v.data[i])
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = leadingZeroCount(v.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // leadingZeroCount counts leading zeros for a single value.
@@ -88,11 +90,12 @@ func leadingZeroCount[T Integers](val T) T {
 
 // TrailingZeroCount counts the number of trailing zero bits in each lane.
 func TrailingZeroCount[T Integers](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = trailingZeroCount(v.data[i])
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = trailingZeroCount(v.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // trailingZeroCount counts trailing zeros for a single value.
@@ -153,11 +156,12 @@ func trailingZeroCount[T Integers](val T) T {
 
 // RotateRight rotates the bits in each lane to the right by the specified count.
 func RotateRight[T Integers](v Vec[T], count int) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = rotateRight(v.data[i], count)
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = rotateRight(v.data()[i], count)
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // rotateRight rotates bits right for a single value.
@@ -194,11 +198,12 @@ func rotateRight[T Integers](val T, count int) T {
 
 // ReverseBits reverses the bit order in each lane.
 func ReverseBits[T Integers](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = reverseBits(v.data[i])
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = reverseBits(v.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // reverseBits reverses bit order for a single value.
@@ -238,11 +243,12 @@ func reverseBits[T Integers](val T) T {
 // For a value with bit pattern ...001xxx, returns the position of the leftmost 1.
 // This is equivalent to floor(log2(x)) for non-zero values.
 func HighestSetBitIndex[T Integers](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = highestSetBitIndex(v.data[i])
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = highestSetBitIndex(v.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // highestSetBitIndex returns the index of the highest set bit for a single value.
@@ -22,7 +22,17 @@ import (
 )
 
 // This file provides AVX2 SIMD implementations of bit manipulation operations.
-// AVX2 doesn't have native SIMD popcount instructions, so we use store/scalar/load pattern.
+// AVX2 doesn't have native SIMD popcount instructions. The uint64 popcount used
+// by the Hamming and bitmap kernels is computed in-register with a PSHUFB
+// nibble lookup and PSADBW; the other lane types use a store/scalar/load
+// pattern.
+
+// popcntNibbleLUT holds the popcount of each 4-bit value, repeated for both
+// 128-bit halves because VPSHUFB looks up within each half.
+var popcntNibbleLUT = [32]uint8{
+	0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+	0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+}
 
 // PopCount_AVX2_I32x8 counts set bits in each lane.
 func PopCount_AVX2_I32x8(v archsimd.Int32x8) archsimd.Int32x8 {
@@ -171,11 +181,14 @@ func PopCount_AVX2_Uint32x8(v archsimd.Uint32x8) archsimd.Uint32x8 {
 }
 
 // PopCount_AVX2_Uint64x4 counts set bits in each lane (unsigned).
+//
+// Each byte is split into nibbles that index popcntNibbleLUT with VPSHUFB;
+// VPSADBW against zero then sums the eight byte counts of every uint64 lane.
 func PopCount_AVX2_Uint64x4(v archsimd.Uint64x4) archsimd.Uint64x4 {
-	var data [4]uint64
-	v.Store(&data)
-	for i := 0; i < 4; i++ {
-		data[i] = uint64(bits.OnesCount64(data[i]))
-	}
-	return archsimd.LoadUint64x4(&data)
+	lut := archsimd.LoadUint8x32(&popcntNibbleLUT)
+	nibble := archsimd.BroadcastUint8x32(0x0f)
+	lo := v.AsUint8x32().And(nibble)
+	hi := v.ShiftAllRight(4).AsUint8x32().And(nibble)
+	counts := lut.PermuteOrZeroGrouped(lo.AsInt8x32()).Add(lut.PermuteOrZeroGrouped(hi.AsInt8x32()))
+	return counts.SumAbsDiff(archsimd.Uint8x32{}).AsUint64x4()
 }
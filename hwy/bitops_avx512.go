@@ -22,8 +22,17 @@ import (
 )
 
 // This file provides AVX-512 SIMD implementations of bit manipulation operations.
-// AVX-512 VPOPCNTDQ provides native popcount for 32/64-bit elements, but we use
-// store/scalar/load pattern for consistency and portability across all AVX-512 variants.
+// AVX-512 VPOPCNTDQ provides native popcount for 32/64-bit elements. The uint64
+// popcount uses VPOPCNTQ where the CPU has it and a VPSHUFB nibble lookup
+// otherwise; the other lane types use a store/scalar/load pattern.
+
+// popcntNibbleLUT512 is popcntNibbleLUT repeated for all four 128-bit groups.
+var popcntNibbleLUT512 = [64]uint8{
+	0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+	0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+	0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+	0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+}
 
 // PopCount_AVX512_I32x16 counts set bits in each lane.
 func PopCount_AVX512_I32x16(v archsimd.Int32x16) archsimd.Int32x16 {
@@ -172,11 +181,18 @@ func PopCount_AVX512_Uint32x16(v archsimd.Uint32x16) archsimd.Uint32x16 {
 }
 
 // PopCount_AVX512_Uint64x8 counts set bits in each lane (unsigned).
+//
+// CPUs with AVX512_VPOPCNTDQ (Ice Lake+, Zen 4+) use VPOPCNTQ directly.
+// Earlier AVX-512 CPUs look up nibble counts with VPSHUFB and sum the bytes
+// of each lane with VPSADBW, as on AVX2.
 func PopCount_AVX512_Uint64x8(v archsimd.Uint64x8) archsimd.Uint64x8 {
-	var data [8]uint64
-	v.Store(&data)
-	for i := 0; i < 8; i++ {
-		data[i] = uint64(bits.OnesCount64(data[i]))
+	if hasAVX512VPOPCNTDQ {
+		return v.OnesCount()
 	}
-	return archsimd.LoadUint64x8(&data)
+	lut := archsimd.LoadUint8x64(&popcntNibbleLUT512)
+	nibble := archsimd.BroadcastUint8x64(0x0f)
+	lo := v.AsUint8x64().And(nibble)
+	hi := v.ShiftAllRight(4).AsUint8x64().And(nibble)
+	counts := lut.PermuteOrZeroGrouped(lo.AsInt8x64()).Add(lut.PermuteOrZeroGrouped(hi.AsInt8x64()))
+	return counts.SumAbsDiff(archsimd.Uint8x64{}).AsUint64x8()
 }
@@ -24,8 +24,8 @@ import (
 )
 
 // This file provides NEON SIMD implementations of bit manipulation operations.
-// NEON doesn't have native SIMD popcount instructions for 64-bit lanes,
-// so we use store/scalar/load pattern.
+// NEON only has a per-byte popcount (CNT). Uint64 lanes widen the byte
+// counts in-register; the other lane types use a store/scalar/load pattern.
 
 // PopCount_NEON_Uint32x4 counts set bits in each lane (unsigned).
 func PopCount_NEON_Uint32x4(v asm.Uint32x4) asm.Uint32x4 {
@@ -36,13 +36,10 @@ func PopCount_NEON_Uint32x4(v asm.Uint32x4) asm.Uint32x4 {
 	return *(*asm.Uint32x4)(unsafe.Pointer(&data))
 }
 
-// PopCount_NEON_Uint64x2 counts set bits in each lane (unsigned).
+// PopCount_NEON_Uint64x2 counts set bits in each lane (unsigned) in-register
+// with CNT and pairwise widening adds.
 func PopCount_NEON_Uint64x2(v asm.Uint64x2) asm.Uint64x2 {
-	data := *(*[2]uint64)(unsafe.Pointer(&v))
-	for i := range 2 {
-		data[i] = uint64(bits.OnesCount64(data[i]))
-	}
-	return *(*asm.Uint64x2)(unsafe.Pointer(&data))
+	return v.PopCount()
 }
 
 // PopCount_NEON_Int32x4 counts set bits in each lane (signed).
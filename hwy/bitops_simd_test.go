@@ -0,0 +1,73 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//go:build amd64 && goexperiment.simd
+
+package hwy
+
+import (
+	"math/bits"
+	"math/rand/v2"
+	"simd/archsimd"
+	"testing"
+)
+
+// popCountInputs returns edge cases followed by random words, a multiple of
+// eight long.
+func popCountInputs() []uint64 {
+	in := []uint64{0, ^uint64(0), 1, 1 << 63, 0x0f0f0f0f0f0f0f0f, 0xf0f0f0f0f0f0f0f0, 0xaaaaaaaaaaaaaaaa, 0x8000000000000001}
+	r := rand.New(rand.NewPCG(1, 2))
+	for range 248 {
+		in = append(in, r.Uint64())
+	}
+	return in
+}
+
+func TestPopCountAVX2Uint64x4(t *testing.T) {
+	if !hasAVX2 {
+		t.Skip("AVX2 not available")
+	}
+	in := popCountInputs()
+	var got [4]uint64
+	for i := 0; i < len(in); i += 4 {
+		PopCount_AVX2_Uint64x4(archsimd.LoadUint64x4Slice(in[i:])).Store(&got)
+		for j, g := range got {
+			if want := uint64(bits.OnesCount64(in[i+j])); g != want {
+				t.Errorf("PopCount(%#x) = %d, want %d", in[i+j], g, want)
+			}
+		}
+	}
+}
+
+func TestPopCountAVX512Uint64x8(t *testing.T) {
+	if !hasAVX512 {
+		t.Skip("AVX-512 not available")
+	}
+	saved := hasAVX512VPOPCNTDQ
+	defer func() { hasAVX512VPOPCNTDQ = saved }()
+	in := popCountInputs()
+	// The nibble lookup always runs; VPOPCNTQ only where the CPU has it.
+	for _, native := range []bool{false, saved} {
+		hasAVX512VPOPCNTDQ = native
+		var got [8]uint64
+		for i := 0; i < len(in); i += 8 {
+			PopCount_AVX512_Uint64x8(archsimd.LoadUint64x8Slice(in[i:])).Store(&got)
+			for j, g := range got {
+				if want := uint64(bits.OnesCount64(in[i+j])); g != want {
+					t.Errorf("vpopcntdq=%v: PopCount(%#x) = %d, want %d", native, in[i+j], g, want)
+				}
+			}
+		}
+	}
+}
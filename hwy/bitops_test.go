@@ -54,11 +54,11 @@ func TestPopCount(t *testing.T) {
 
 		for _, tt := range tests {
 			t.Run(tt.name, func(t *testing.T) {
-				v := Vec[uint8]{data: tt.input}
+				v := vecFrom(tt.input)
 				result := PopCount(v)
 				for i := 0; i < len(tt.want); i++ {
-					if result.data[i] != tt.want[i] {
-						t.Errorf("lane %d: got %d, want %d", i, result.data[i], tt.want[i])
+					if result.data()[i] != tt.want[i] {
+						t.Errorf("lane %d: got %d, want %d", i, result.data()[i], tt.want[i])
 					}
 				}
 			})
@@ -90,11 +90,11 @@ func TestPopCount(t *testing.T) {
 
 		for _, tt := range tests {
 			t.Run(tt.name, func(t *testing.T) {
-				v := Vec[int32]{data: tt.input}
+				v := vecFrom(tt.input)
 				result := PopCount(v)
 				for i := 0; i < len(tt.want); i++ {
-					if result.data[i] != tt.want[i] {
-						t.Errorf("lane %d: got %d, want %d", i, result.data[i], tt.want[i])
+					if result.data()[i] != tt.want[i] {
+						t.Errorf("lane %d: got %d, want %d", i, result.data()[i], tt.want[i])
 					}
 				}
 			})
@@ -102,12 +102,12 @@ func TestPopCount(t *testing.T) {
 	})
 
 	t.Run("uint64", func(t *testing.T) {
-		v := Vec[uint64]{data: []uint64{0, 1, 0xFFFFFFFFFFFFFFFF, 0x8000000000000001}}
+		v := vecFrom([]uint64{0, 1, 0xFFFFFFFFFFFFFFFF, 0x8000000000000001})
 		result := PopCount(v)
 		want := []uint64{0, 1, 64, 2}
 		for i := range want {
-			if result.data[i] != want[i] {
-				t.Errorf("lane %d: got %d, want %d", i, result.data[i], want[i])
+			if result.data()[i] != want[i] {
+				t.Errorf("lane %d: got %d, want %d", i, result.data()[i], want[i])
 			}
 		}
 	})
@@ -139,11 +139,11 @@ func TestLeadingZeroCount(t *testing.T) {
 
 		for _, tt := range tests {
 			t.Run(tt.name, func(t *testing.T) {
-				v := Vec[uint8]{data: tt.input}
+				v := vecFrom(tt.input)
 				result := LeadingZeroCount(v)
 				for i := 0; i < len(tt.want); i++ {
-					if result.data[i] != tt.want[i] {
-						t.Errorf("lane %d: got %d, want %d", i, result.data[i], tt.want[i])
+					if result.data()[i] != tt.want[i] {
+						t.Errorf("lane %d: got %d, want %d", i, result.data()[i], tt.want[i])
 					}
 				}
 			})
@@ -175,11 +175,11 @@ func TestLeadingZeroCount(t *testing.T) {
 
 		for _, tt := range tests {
 			t.Run(tt.name, func(t *testing.T) {
-				v := Vec[int32]{data: tt.input}
+				v := vecFrom(tt.input)
 				result := LeadingZeroCount(v)
 				for i := 0; i < len(tt.want); i++ {
-					if result.data[i] != tt.want[i] {
-						t.Errorf("lane %d: got %d, want %d", i, result.data[i], tt.want[i])
+					if result.data()[i] != tt.want[i] {
+						t.Errorf("lane %d: got %d, want %d", i, result.data()[i], tt.want[i])
 					}
 				}
 			})
@@ -187,12 +187,12 @@ func TestLeadingZeroCount(t *testing.T) {
 	})
 
 	t.Run("uint64", func(t *testing.T) {
-		v := Vec[uint64]{data: []uint64{0, 1, 0x8000000000000000, 0xFFFFFFFFFFFFFFFF}}
+		v := vecFrom([]uint64{0, 1, 0x8000000000000000, 0xFFFFFFFFFFFFFFFF})
 		result := LeadingZeroCount(v)
 		want := []uint64{64, 63, 0, 0}
 		for i := range want {
-			if result.data[i] != want[i] {
-				t.Errorf("lane %d: got %d, want %d", i, result.data[i], want[i])
+			if result.data()[i] != want[i] {
+				t.Errorf("lane %d: got %d, want %d", i, result.data()[i], want[i])
 			}
 		}
 	})
@@ -229,11 +229,11 @@ func TestTrailingZeroCount(t *testing.T) {
 
 		for _, tt := range tests {
 			t.Run(tt.name, func(t *testing.T) {
-				v := Vec[uint8]{data: tt.input}
+				v := vecFrom(tt.input)
 				result := TrailingZeroCount(v)
 				for i := 0; i < len(tt.want); i++ {
-					if result.data[i] != tt.want[i] {
-						t.Errorf("lane %d: got %d, want %d", i, result.data[i], tt.want[i])
+					if result.data()[i] != tt.want[i] {
+						t.Errorf("lane %d: got %d, want %d", i, result.data()[i], tt.want[i])
 					}
 				}
 			})
@@ -265,11 +265,11 @@ func TestTrailingZeroCount(t *testing.T) {
 
 		for _, tt := range tests {
 			t.Run(tt.name, func(t *testing.T) {
-				v := Vec[int32]{data: tt.input}
+				v := vecFrom(tt.input)
 				result := TrailingZeroCount(v)
 				for i := 0; i < len(tt.want); i++ {
-					if result.data[i] != tt.want[i] {
-						t.Errorf("lane %d: got %d, want %d", i, result.data[i], tt.want[i])
+					if result.data()[i] != tt.want[i] {
+						t.Errorf("lane %d: got %d, want %d", i, result.data()[i], tt.want[i])
 					}
 				}
 			})
@@ -277,12 +277,12 @@ func TestTrailingZeroCount(t *testing.T) {
 	})
 
 	t.Run("uint64", func(t *testing.T) {
-		v := Vec[uint64]{data: []uint64{0, 1, 0x8000000000000000, 0x0000000100000000}}
+		v := vecFrom([]uint64{0, 1, 0x8000000000000000, 0x0000000100000000})
 		result := TrailingZeroCount(v)
 		want := []uint64{64, 0, 63, 32}
 		for i := range want {
-			if result.data[i] != want[i] {
-				t.Errorf("lane %d: got %d, want %d", i, result.data[i], want[i])
+			if result.data()[i] != want[i] {
+				t.Errorf("lane %d: got %d, want %d", i, result.data()[i], want[i])
 			}
 		}
 	})
@@ -324,11 +324,11 @@ func TestRotateRight(t *testing.T) {
 
 		for _, tt := range tests {
 			t.Run(tt.name, func(t *testing.T) {
-				v := Vec[uint8]{data: tt.input}
+				v := vecFrom(tt.input)
 				result := RotateRight(v, tt.count)
 				for i := 0; i < len(tt.want); i++ {
-					if result.data[i] != tt.want[i] {
-						t.Errorf("lane %d: got 0x%02X, want 0x%02X", i, result.data[i], tt.want[i])
+					if result.data()[i] != tt.want[i] {
+						t.Errorf("lane %d: got 0x%02X, want 0x%02X", i, result.data()[i], tt.want[i])
 					}
 				}
 			})
@@ -370,11 +370,11 @@ func TestRotateRight(t *testing.T) {
 
 		for _, tt := range tests {
 			t.Run(tt.name, func(t *testing.T) {
-				v := Vec[uint32]{data: tt.input}
+				v := vecFrom(tt.input)
 				result := RotateRight(v, tt.count)
 				for i := 0; i < len(tt.want); i++ {
-					if result.data[i] != tt.want[i] {
-						t.Errorf("lane %d: got 0x%08X, want 0x%08X", i, result.data[i], tt.want[i])
+					if result.data()[i] != tt.want[i] {
+						t.Errorf("lane %d: got 0x%08X, want 0x%08X", i, result.data()[i], tt.want[i])
 					}
 				}
 			})
@@ -383,11 +383,11 @@ func TestRotateRight(t *testing.T) {
 
 	t.Run("int32", func(t *testing.T) {
 		// Test with negative values
-		v := Vec[int32]{data: []int32{-1}}
+		v := vecFrom([]int32{-1})
 		result := RotateRight(v, 5)
 		// -1 is all 1s, so rotating returns the same value
-		if result.data[0] != -1 {
-			t.Errorf("got %d, want -1", result.data[0])
+		if result.data()[0] != -1 {
+			t.Errorf("got %d, want -1", result.data()[0])
 		}
 	})
 }
@@ -428,11 +428,11 @@ func TestReverseBits(t *testing.T) {
 
 		for _, tt := range tests {
 			t.Run(tt.name, func(t *testing.T) {
-				v := Vec[uint8]{data: tt.input}
+				v := vecFrom(tt.input)
 				result := ReverseBits(v)
 				for i := 0; i < len(tt.want); i++ {
-					if result.data[i] != tt.want[i] {
-						t.Errorf("lane %d: got 0x%02X, want 0x%02X", i, result.data[i], tt.want[i])
+					if result.data()[i] != tt.want[i] {
+						t.Errorf("lane %d: got 0x%02X, want 0x%02X", i, result.data()[i], tt.want[i])
 					}
 				}
 			})
@@ -469,11 +469,11 @@ func TestReverseBits(t *testing.T) {
 
 		for _, tt := range tests {
 			t.Run(tt.name, func(t *testing.T) {
-				v := Vec[uint32]{data: tt.input}
+				v := vecFrom(tt.input)
 				result := ReverseBits(v)
 				for i := 0; i < len(tt.want); i++ {
-					if result.data[i] != tt.want[i] {
-						t.Errorf("lane %d: got 0x%08X, want 0x%08X", i, result.data[i], tt.want[i])
+					if result.data()[i] != tt.want[i] {
+						t.Errorf("lane %d: got 0x%08X, want 0x%08X", i, result.data()[i], tt.want[i])
 					}
 				}
 			})
@@ -483,11 +483,11 @@ func TestReverseBits(t *testing.T) {
 	t.Run("double_reverse", func(t *testing.T) {
 		// Reversing twice should return original
 		input := []uint32{0x12345678, 0xABCDEF01}
-		v := Vec[uint32]{data: input}
+		v := vecFrom(input)
 		result := ReverseBits(ReverseBits(v))
 		for i := range input {
-			if result.data[i] != input[i] {
-				t.Errorf("lane %d: double reverse got 0x%08X, want 0x%08X", i, result.data[i], input[i])
+			if result.data()[i] != input[i] {
+				t.Errorf("lane %d: double reverse got 0x%08X, want 0x%08X", i, result.data()[i], input[i])
 			}
 		}
 	})
@@ -519,12 +519,12 @@ func TestHighestSetBitIndex(t *testing.T) {
 
 		for _, tt := range tests {
 			t.Run(tt.name, func(t *testing.T) {
-				v := Vec[uint8]{data: tt.input}
+				v := vecFrom(tt.input)
 				result := HighestSetBitIndex(v)
 				for i := 0; i < len(tt.want); i++ {
-					if result.data[i] != tt.want[i] {
+					if result.data()[i] != tt.want[i] {
 						t.Errorf("lane %d: got %d (0x%02X), want %d (0x%02X)",
-							i, result.data[i], result.data[i], tt.want[i], tt.want[i])
+							i, result.data()[i], result.data()[i], tt.want[i], tt.want[i])
 					}
 				}
 			})
@@ -561,11 +561,11 @@ func TestHighestSetBitIndex(t *testing.T) {
 
 		for _, tt := range tests {
 			t.Run(tt.name, func(t *testing.T) {
-				v := Vec[int32]{data: tt.input}
+				v := vecFrom(tt.input)
 				result := HighestSetBitIndex(v)
 				for i := 0; i < len(tt.want); i++ {
-					if result.data[i] != tt.want[i] {
-						t.Errorf("lane %d: got %d, want %d", i, result.data[i], tt.want[i])
+					if result.data()[i] != tt.want[i] {
+						t.Errorf("lane %d: got %d, want %d", i, result.data()[i], tt.want[i])
 					}
 				}
 			})
@@ -573,12 +573,12 @@ func TestHighestSetBitIndex(t *testing.T) {
 	})
 
 	t.Run("uint64", func(t *testing.T) {
-		v := Vec[uint64]{data: []uint64{0, 1, 0x8000000000000000, 0xFFFFFFFFFFFFFFFF}}
+		v := vecFrom([]uint64{0, 1, 0x8000000000000000, 0xFFFFFFFFFFFFFFFF})
 		result := HighestSetBitIndex(v)
 		want := []uint64{0xFFFFFFFFFFFFFFFF, 0, 63, 63} // -1 as uint64, 0, 63, 63
 		for i := range want {
-			if result.data[i] != want[i] {
-				t.Errorf("lane %d: got %d, want %d", i, result.data[i], want[i])
+			if result.data()[i] != want[i] {
+				t.Errorf("lane %d: got %d, want %d", i, result.data()[i], want[i])
 			}
 		}
 	})
@@ -587,7 +587,7 @@ func TestHighestSetBitIndex(t *testing.T) {
 // Benchmarks
 
 func BenchmarkPopCount_U32(b *testing.B) {
-	v := Vec[uint32]{data: []uint32{0xAAAAAAAA, 0x55555555, 0xFFFF0000, 0x00FFFF00, 0x12345678, 0x87654321, 0xDEADBEEF, 0xCAFEBABE}}
+	v := vecFrom([]uint32{0xAAAAAAAA, 0x55555555, 0xFFFF0000, 0x00FFFF00, 0x12345678, 0x87654321, 0xDEADBEEF, 0xCAFEBABE})
 
 	for b.Loop() {
 		_ = PopCount(v)
@@ -595,7 +595,7 @@ func BenchmarkPopCount_U32(b *testing.B) {
 }
 
 func BenchmarkLeadingZeroCount_U32(b *testing.B) {
-	v := Vec[uint32]{data: []uint32{0xAAAAAAAA, 0x55555555, 0xFFFF0000, 0x00FFFF00, 0x12345678, 0x87654321, 0xDEADBEEF, 0xCAFEBABE}}
+	v := vecFrom([]uint32{0xAAAAAAAA, 0x55555555, 0xFFFF0000, 0x00FFFF00, 0x12345678, 0x87654321, 0xDEADBEEF, 0xCAFEBABE})
 
 	for b.Loop() {
 		_ = LeadingZeroCount(v)
@@ -603,7 +603,7 @@ func BenchmarkLeadingZeroCount_U32(b *testing.B) {
 }
 
 func BenchmarkTrailingZeroCount_U32(b *testing.B) {
-	v := Vec[uint32]{data: []uint32{0xAAAAAAAA, 0x55555555, 0xFFFF0000, 0x00FFFF00, 0x12345678, 0x87654321, 0xDEADBEEF, 0xCAFEBABE}}
+	v := vecFrom([]uint32{0xAAAAAAAA, 0x55555555, 0xFFFF0000, 0x00FFFF00, 0x12345678, 0x87654321, 0xDEADBEEF, 0xCAFEBABE})
 
 	for b.Loop() {
 		_ = TrailingZeroCount(v)
@@ -611,7 +611,7 @@ func BenchmarkTrailingZeroCount_U32(b *testing.B) {
 }
 
 func BenchmarkRotateRight_U32(b *testing.B) {
-	v := Vec[uint32]{data: []uint32{0x12345678, 0x87654321, 0xDEADBEEF, 0xCAFEBABE, 0xAAAAAAAA, 0x55555555, 0xFFFF0000, 0x00FFFF00}}
+	v := vecFrom([]uint32{0x12345678, 0x87654321, 0xDEADBEEF, 0xCAFEBABE, 0xAAAAAAAA, 0x55555555, 0xFFFF0000, 0x00FFFF00})
 
 	for b.Loop() {
 		_ = RotateRight(v, 7)
@@ -619,7 +619,7 @@ func BenchmarkRotateRight_U32(b *testing.B) {
 }
 
 func BenchmarkReverseBits_U32(b *testing.B) {
-	v := Vec[uint32]{data: []uint32{0x12345678, 0x87654321, 0xDEADBEEF, 0xCAFEBABE, 0xAAAAAAAA, 0x55555555, 0xFFFF0000, 0x00FFFF00}}
+	v := vecFrom([]uint32{0x12345678, 0x87654321, 0xDEADBEEF, 0xCAFEBABE, 0xAAAAAAAA, 0x55555555, 0xFFFF0000, 0x00FFFF00})
 
 	for b.Loop() {
 		_ = ReverseBits(v)
@@ -627,7 +627,7 @@ func BenchmarkReverseBits_U32(b *testing.B) {
 }
 
 func BenchmarkHighestSetBitIndex_U32(b *testing.B) {
-	v := Vec[uint32]{data: []uint32{0x12345678, 0x87654321, 0xDEADBEEF, 0xCAFEBABE, 0xAAAAAAAA, 0x55555555, 0xFFFF0000, 0x00FFFF00}}
+	v := vecFrom([]uint32{0x12345678, 0x87654321, 0xDEADBEEF, 0xCAFEBABE, 0xAAAAAAAA, 0x55555555, 0xFFFF0000, 0x00FFFF00})
 
 	for b.Loop() {
 		_ = HighestSetBitIndex(v)
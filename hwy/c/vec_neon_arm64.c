@@ -476,6 +476,15 @@ uint8x16_t not_u8x16(uint8x16_t a) {
     return vmvnq_u8(a);
 }
 
+// Widening (zero-extend each half to uint16)
+uint16x8_t promotelo_u8x16(uint8x16_t a) {
+    return vmovl_u8(vget_low_u8(a));
+}
+
+uint16x8_t promotehi_u8x16(uint8x16_t a) {
+    return vmovl_high_u8(a);
+}
+
 // ============================================================================
 // Uint16x8 Operations (128-bit, 8 lanes)
 // ============================================================================
@@ -690,6 +699,12 @@ uint64x2_t sel_u64x2(uint64x2_t mask, uint64x2_t yes, uint64x2_t no) {
     return vbslq_u64(mask, yes, no);
 }
 
+// Population count: per-byte CNT, then widen-and-add pairwise up to 64 bits
+uint64x2_t popcnt_u64x2(uint64x2_t a) {
+    uint8x16_t c = vcntq_u8(vreinterpretq_u8_u64(a));
+    return vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(c)));
+}
+
 // ============================================================================
 // Slide/Extract Operations (for prefix sum, etc.)
 // ============================================================================
@@ -56,6 +56,18 @@ func BitsFromMask_NEON_Float64x2(mask asm.Int64x2) uint64 {
 	return result
 }
 
+// BitsFromMask_NEON_F32x4 is BitsFromMask_NEON_Float32x4 under the short
+// type suffix hwygen emits for float32 code.
+func BitsFromMask_NEON_F32x4(mask asm.Int32x4) uint64 {
+	return BitsFromMask_NEON_Float32x4(mask)
+}
+
+// BitsFromMask_NEON_F64x2 is BitsFromMask_NEON_Float64x2 under the short
+// type suffix hwygen emits for float64 code.
+func BitsFromMask_NEON_F64x2(mask asm.Int64x2) uint64 {
+	return BitsFromMask_NEON_Float64x2(mask)
+}
+
 // BitsFromMask_NEON_Int32x4 converts a NEON int32 comparison result to a bitmask.
 func BitsFromMask_NEON_Int32x4(mask asm.Int32x4) uint64 {
 	return BitsFromMask_NEON_Float32x4(mask)
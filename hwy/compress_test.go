@@ -86,8 +86,8 @@ func TestCompress(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			v := Vec[float32]{data: tt.data}
-			mask := Mask[float32]{bits: tt.mask}
+			v := vecFrom(tt.data)
+			mask := maskFrom[float32](tt.mask)
 
 			result, count := Compress(v, mask)
 
@@ -95,9 +95,9 @@ func TestCompress(t *testing.T) {
 				t.Errorf("Compress count: got %d, want %d", count, tt.wantCnt)
 			}
 
-			for i := 0; i < len(tt.wantData) && i < len(result.data); i++ {
-				if result.data[i] != tt.wantData[i] {
-					t.Errorf("Compress lane %d: got %v, want %v", i, result.data[i], tt.wantData[i])
+			for i := 0; i < len(tt.wantData) && i < result.NumLanes(); i++ {
+				if result.data()[i] != tt.wantData[i] {
+					t.Errorf("Compress lane %d: got %v, want %v", i, result.data()[i], tt.wantData[i])
 				}
 			}
 		})
@@ -157,14 +157,14 @@ func TestExpand(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			v := Vec[float32]{data: tt.data}
-			mask := Mask[float32]{bits: tt.mask}
+			v := vecFrom(tt.data)
+			mask := maskFrom[float32](tt.mask)
 
 			result := Expand(v, mask)
 
-			for i := 0; i < len(tt.wantData) && i < len(result.data); i++ {
-				if result.data[i] != tt.wantData[i] {
-					t.Errorf("Expand lane %d: got %v, want %v", i, result.data[i], tt.wantData[i])
+			for i := 0; i < len(tt.wantData) && i < result.NumLanes(); i++ {
+				if result.data()[i] != tt.wantData[i] {
+					t.Errorf("Expand lane %d: got %v, want %v", i, result.data()[i], tt.wantData[i])
 				}
 			}
 		})
@@ -184,8 +184,8 @@ func TestCompressExpandRoundTrip(t *testing.T) {
 	}
 
 	for _, maskBits := range masks {
-		v := Vec[float32]{data: data}
-		mask := Mask[float32]{bits: maskBits}
+		v := vecFrom(data)
+		mask := maskFrom[float32](maskBits)
 
 		// Compress then expand
 		compressed, count := Compress(v, mask)
@@ -195,15 +195,15 @@ func TestCompressExpandRoundTrip(t *testing.T) {
 		// Check that positions where mask is true have the original values
 		for i := range data {
 			if maskBits[i] {
-				if expanded.data[i] != data[i] {
+				if expanded.data()[i] != data[i] {
 					t.Errorf("Round trip lane %d: got %v, want %v (mask pattern: %v)",
-						i, expanded.data[i], data[i], maskBits)
+						i, expanded.data()[i], data[i], maskBits)
 				}
 			} else {
 				// Positions where mask is false should be zero
-				if expanded.data[i] != 0 {
+				if expanded.data()[i] != 0 {
 					t.Errorf("Round trip lane %d: got %v, want 0 (mask pattern: %v)",
-						i, expanded.data[i], maskBits)
+						i, expanded.data()[i], maskBits)
 				}
 			}
 		}
@@ -212,8 +212,8 @@ func TestCompressExpandRoundTrip(t *testing.T) {
 
 func TestCompressStore(t *testing.T) {
 	data := []float32{1, 2, 3, 4, 5, 6, 7, 8}
-	mask := Mask[float32]{bits: []bool{true, false, true, true, false, false, true, false}}
-	v := Vec[float32]{data: data}
+	mask := maskFrom[float32]([]bool{true, false, true, true, false, false, true, false})
+	v := vecFrom(data)
 
 	dst := make([]float32, 8)
 	count := CompressStore(v, mask, dst)
@@ -245,7 +245,7 @@ func TestCountTrue(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			mask := Mask[float32]{bits: tt.mask}
+			mask := maskFrom[float32](tt.mask)
 			got := CountTrue(mask)
 			if got != tt.want {
 				t.Errorf("CountTrue: got %d, want %d", got, tt.want)
@@ -269,7 +269,7 @@ func TestAllTrue(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			mask := Mask[float32]{bits: tt.mask}
+			mask := maskFrom[float32](tt.mask)
 			got := AllTrue(mask)
 			if got != tt.want {
 				t.Errorf("AllTrue: got %v, want %v", got, tt.want)
@@ -293,7 +293,7 @@ func TestAllFalse(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			mask := Mask[float32]{bits: tt.mask}
+			mask := maskFrom[float32](tt.mask)
 			got := AllFalse(mask)
 			if got != tt.want {
 				t.Errorf("AllFalse: got %v, want %v", got, tt.want)
@@ -318,7 +318,7 @@ func TestFindFirstTrue(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			mask := Mask[float32]{bits: tt.mask}
+			mask := maskFrom[float32](tt.mask)
 			got := FindFirstTrue(mask)
 			if got != tt.want {
 				t.Errorf("FindFirstTrue: got %d, want %d", got, tt.want)
@@ -343,7 +343,7 @@ func TestFindLastTrue(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			mask := Mask[float32]{bits: tt.mask}
+			mask := maskFrom[float32](tt.mask)
 			got := FindLastTrue(mask)
 			if got != tt.want {
 				t.Errorf("FindLastTrue: got %d, want %d", got, tt.want)
@@ -475,7 +475,7 @@ func TestBitsFromMask(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			mask := Mask[float32]{bits: tt.mask}
+			mask := maskFrom[float32](tt.mask)
 			got := BitsFromMask(mask)
 			if got != tt.want {
 				t.Errorf("BitsFromMask: got 0x%X, want 0x%X", got, tt.want)
@@ -506,71 +506,71 @@ func TestMaskFromBitsRoundTrip(t *testing.T) {
 }
 
 func TestMaskAnd(t *testing.T) {
-	a := Mask[float32]{bits: []bool{true, true, false, false}}
-	b := Mask[float32]{bits: []bool{true, false, true, false}}
+	a := maskFrom[float32]([]bool{true, true, false, false})
+	b := maskFrom[float32]([]bool{true, false, true, false})
 
 	result := MaskAnd(a, b)
 	expected := []bool{true, false, false, false}
 
 	for i := range expected {
-		if result.bits[i] != expected[i] {
-			t.Errorf("MaskAnd lane %d: got %v, want %v", i, result.bits[i], expected[i])
+		if result.get(i) != expected[i] {
+			t.Errorf("MaskAnd lane %d: got %v, want %v", i, result.get(i), expected[i])
 		}
 	}
 }
 
 func TestMaskOr(t *testing.T) {
-	a := Mask[float32]{bits: []bool{true, true, false, false}}
-	b := Mask[float32]{bits: []bool{true, false, true, false}}
+	a := maskFrom[float32]([]bool{true, true, false, false})
+	b := maskFrom[float32]([]bool{true, false, true, false})
 
 	result := MaskOr(a, b)
 	expected := []bool{true, true, true, false}
 
 	for i := range expected {
-		if result.bits[i] != expected[i] {
-			t.Errorf("MaskOr lane %d: got %v, want %v", i, result.bits[i], expected[i])
+		if result.get(i) != expected[i] {
+			t.Errorf("MaskOr lane %d: got %v, want %v", i, result.get(i), expected[i])
 		}
 	}
 }
 
 func TestMaskXor(t *testing.T) {
-	a := Mask[float32]{bits: []bool{true, true, false, false}}
-	b := Mask[float32]{bits: []bool{true, false, true, false}}
+	a := maskFrom[float32]([]bool{true, true, false, false})
+	b := maskFrom[float32]([]bool{true, false, true, false})
 
 	result := MaskXor(a, b)
 	expected := []bool{false, true, true, false}
 
 	for i := range expected {
-		if result.bits[i] != expected[i] {
-			t.Errorf("MaskXor lane %d: got %v, want %v", i, result.bits[i], expected[i])
+		if result.get(i) != expected[i] {
+			t.Errorf("MaskXor lane %d: got %v, want %v", i, result.get(i), expected[i])
 		}
 	}
 }
 
 func TestMaskNot(t *testing.T) {
-	mask := Mask[float32]{bits: []bool{true, false, true, false}}
+	mask := maskFrom[float32]([]bool{true, false, true, false})
 
 	result := MaskNot(mask)
 	expected := []bool{false, true, false, true}
 
 	for i := range expected {
-		if result.bits[i] != expected[i] {
-			t.Errorf("MaskNot lane %d: got %v, want %v", i, result.bits[i], expected[i])
+		if result.get(i) != expected[i] {
+			t.Errorf("MaskNot lane %d: got %v, want %v", i, result.get(i), expected[i])
 		}
 	}
 }
 
 func TestMaskAndNot(t *testing.T) {
-	a := Mask[float32]{bits: []bool{true, true, false, false}}
-	b := Mask[float32]{bits: []bool{true, false, true, false}}
+	a := maskFrom[float32]([]bool{true, true, false, false})
+	b := maskFrom[float32]([]bool{true, false, true, false})
 
 	// (~a) & b
 	result := MaskAndNot(a, b)
 	expected := []bool{false, false, true, false}
 
 	for i := range expected {
-		if result.bits[i] != expected[i] {
-			t.Errorf("MaskAndNot lane %d: got %v, want %v", i, result.bits[i], expected[i])
+		if result.get(i) != expected[i] {
+			t.Errorf("MaskAndNot lane %d: got %v, want %v", i, result.get(i), expected[i])
 		}
 	}
 }
@@ -579,56 +579,56 @@ func TestCompressWithDifferentTypes(t *testing.T) {
 	// Test with float64
 	t.Run("float64", func(t *testing.T) {
 		data := []float64{1, 2, 3, 4}
-		mask := Mask[float64]{bits: []bool{true, false, true, false}}
-		v := Vec[float64]{data: data}
+		mask := maskFrom[float64]([]bool{true, false, true, false})
+		v := vecFrom(data)
 
 		result, count := Compress(v, mask)
 
 		if count != 2 {
 			t.Errorf("Compress float64 count: got %d, want 2", count)
 		}
-		if result.data[0] != 1 || result.data[1] != 3 {
-			t.Errorf("Compress float64: got %v, want [1, 3, ...]", result.data[:2])
+		if result.data()[0] != 1 || result.data()[1] != 3 {
+			t.Errorf("Compress float64: got %v, want [1, 3, ...]", result.data()[:2])
 		}
 	})
 
 	// Test with int32
 	t.Run("int32", func(t *testing.T) {
 		data := []int32{10, 20, 30, 40}
-		mask := Mask[int32]{bits: []bool{false, true, false, true}}
-		v := Vec[int32]{data: data}
+		mask := maskFrom[int32]([]bool{false, true, false, true})
+		v := vecFrom(data)
 
 		result, count := Compress(v, mask)
 
 		if count != 2 {
 			t.Errorf("Compress int32 count: got %d, want 2", count)
 		}
-		if result.data[0] != 20 || result.data[1] != 40 {
-			t.Errorf("Compress int32: got %v, want [20, 40, ...]", result.data[:2])
+		if result.data()[0] != 20 || result.data()[1] != 40 {
+			t.Errorf("Compress int32: got %v, want [20, 40, ...]", result.data()[:2])
 		}
 	})
 
 	// Test with uint64
 	t.Run("uint64", func(t *testing.T) {
 		data := []uint64{100, 200, 300, 400}
-		mask := Mask[uint64]{bits: []bool{true, true, false, false}}
-		v := Vec[uint64]{data: data}
+		mask := maskFrom[uint64]([]bool{true, true, false, false})
+		v := vecFrom(data)
 
 		result, count := Compress(v, mask)
 
 		if count != 2 {
 			t.Errorf("Compress uint64 count: got %d, want 2", count)
 		}
-		if result.data[0] != 100 || result.data[1] != 200 {
-			t.Errorf("Compress uint64: got %v, want [100, 200, ...]", result.data[:2])
+		if result.data()[0] != 100 || result.data()[1] != 200 {
+			t.Errorf("Compress uint64: got %v, want [100, 200, ...]", result.data()[:2])
 		}
 	})
 }
 
 func TestCompressBlendedStore(t *testing.T) {
 	data := []float32{1, 2, 3, 4, 5, 6, 7, 8}
-	mask := Mask[float32]{bits: []bool{true, false, true, true, false, false, true, false}}
-	v := Vec[float32]{data: data}
+	mask := maskFrom[float32]([]bool{true, false, true, true, false, false, true, false})
+	v := vecFrom(data)
 
 	dst := []float32{99, 99, 99, 99, 99, 99, 99, 99}
 	count := CompressBlendedStore(v, mask, dst)
@@ -649,18 +649,19 @@ func TestCompressBlendedStore(t *testing.T) {
 // Benchmark tests
 func BenchmarkCompress(b *testing.B) {
 	maxLanes := MaxLanes[float32]()
-	data := make([]float32, maxLanes)
+	out := makeVec[float32](maxLanes)
+	data := out.data()
 	for i := range data {
 		data[i] = float32(i)
 	}
-	v := Vec[float32]{data: data}
+	v := out
 
 	// Alternating mask (50% true)
-	bits := make([]bool, maxLanes)
+	bits := makeMask[float32](maxLanes)
 	for i := range maxLanes {
-		bits[i] = i%2 == 0
+		bits.set(i, i%2 == 0)
 	}
-	mask := Mask[float32]{bits: bits}
+	mask := bits
 
 	for b.Loop() {
 		_, _ = Compress(v, mask)
@@ -669,18 +670,19 @@ func BenchmarkCompress(b *testing.B) {
 
 func BenchmarkExpand(b *testing.B) {
 	maxLanes := MaxLanes[float32]()
-	data := make([]float32, maxLanes)
+	out := makeVec[float32](maxLanes)
+	data := out.data()
 	for i := range data {
 		data[i] = float32(i)
 	}
-	v := Vec[float32]{data: data}
+	v := out
 
 	// Alternating mask (50% true)
-	bits := make([]bool, maxLanes)
+	bits := makeMask[float32](maxLanes)
 	for i := range maxLanes {
-		bits[i] = i%2 == 0
+		bits.set(i, i%2 == 0)
 	}
-	mask := Mask[float32]{bits: bits}
+	mask := bits
 
 	for b.Loop() {
 		_ = Expand(v, mask)
@@ -689,17 +691,18 @@ func BenchmarkExpand(b *testing.B) {
 
 func BenchmarkCompressStore(b *testing.B) {
 	maxLanes := MaxLanes[float32]()
-	data := make([]float32, maxLanes)
+	out := makeVec[float32](maxLanes)
+	data := out.data()
 	for i := range data {
 		data[i] = float32(i)
 	}
-	v := Vec[float32]{data: data}
+	v := out
 
-	bits := make([]bool, maxLanes)
+	bits := makeMask[float32](maxLanes)
 	for i := range maxLanes {
-		bits[i] = i%2 == 0
+		bits.set(i, i%2 == 0)
 	}
-	mask := Mask[float32]{bits: bits}
+	mask := bits
 	dst := make([]float32, maxLanes)
 
 	for b.Loop() {
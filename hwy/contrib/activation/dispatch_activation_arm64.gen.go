@@ -233,6 +233,24 @@ func Tanh[T hwy.Floats](input []T, output []T) {
 
 func init() {
 	initActivationAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "activation",
+		Groups: []hwy.DispatchGroup{
+			{Name: "ELU", Vars: []any{&ELUFloat16, &ELUBFloat16, &ELUFloat32, &ELUFloat64}},
+			{Name: "GELU", Vars: []any{&GELUFloat16, &GELUBFloat16, &GELUFloat32, &GELUFloat64}},
+			{Name: "GELUApprox", Vars: []any{&GELUApproxFloat16, &GELUApproxBFloat16, &GELUApproxFloat32, &GELUApproxFloat64}},
+			{Name: "HardSwish", Vars: []any{&HardSwishFloat16, &HardSwishBFloat16, &HardSwishFloat32, &HardSwishFloat64}},
+			{Name: "LeakyReLU", Vars: []any{&LeakyReLUFloat16, &LeakyReLUBFloat16, &LeakyReLUFloat32, &LeakyReLUFloat64}},
+			{Name: "ReLU", Vars: []any{&ReLUFloat16, &ReLUBFloat16, &ReLUFloat32, &ReLUFloat64}},
+			{Name: "SiLU", Vars: []any{&SiLUFloat16, &SiLUBFloat16, &SiLUFloat32, &SiLUFloat64}},
+			{Name: "Softplus", Vars: []any{&SoftplusFloat16, &SoftplusBFloat16, &SoftplusFloat32, &SoftplusFloat64}},
+			{Name: "Tanh", Vars: []any{&TanhFloat16, &TanhBFloat16, &TanhFloat32, &TanhFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initActivationNEONAsm},
+			{Name: "fallback", Supported: true, Init: initActivationFallback},
+		},
+	})
 }
 
 func initActivationAll() {
@@ -0,0 +1,282 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package activation
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("activation", "ELU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ELUFloat16; hwyImpl != nil {
+			ELUFloat16 = func(input []hwy.Float16, output []hwy.Float16, alpha hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, alpha)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ELUBFloat16; hwyImpl != nil {
+			ELUBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16, alpha hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, alpha)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ELUFloat32; hwyImpl != nil {
+			ELUFloat32 = func(input []float32, output []float32, alpha float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, alpha)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ELUFloat64; hwyImpl != nil {
+			ELUFloat64 = func(input []float64, output []float64, alpha float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, alpha)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("activation", "GELU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := GELUFloat16; hwyImpl != nil {
+			GELUFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := GELUBFloat16; hwyImpl != nil {
+			GELUBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := GELUFloat32; hwyImpl != nil {
+			GELUFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := GELUFloat64; hwyImpl != nil {
+			GELUFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("activation", "GELUApprox", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := GELUApproxFloat16; hwyImpl != nil {
+			GELUApproxFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := GELUApproxBFloat16; hwyImpl != nil {
+			GELUApproxBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := GELUApproxFloat32; hwyImpl != nil {
+			GELUApproxFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := GELUApproxFloat64; hwyImpl != nil {
+			GELUApproxFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("activation", "HardSwish", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := HardSwishFloat16; hwyImpl != nil {
+			HardSwishFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := HardSwishBFloat16; hwyImpl != nil {
+			HardSwishBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := HardSwishFloat32; hwyImpl != nil {
+			HardSwishFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := HardSwishFloat64; hwyImpl != nil {
+			HardSwishFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("activation", "LeakyReLU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := LeakyReLUFloat16; hwyImpl != nil {
+			LeakyReLUFloat16 = func(input []hwy.Float16, output []hwy.Float16, alpha hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, alpha)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := LeakyReLUBFloat16; hwyImpl != nil {
+			LeakyReLUBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16, alpha hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, alpha)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := LeakyReLUFloat32; hwyImpl != nil {
+			LeakyReLUFloat32 = func(input []float32, output []float32, alpha float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, alpha)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := LeakyReLUFloat64; hwyImpl != nil {
+			LeakyReLUFloat64 = func(input []float64, output []float64, alpha float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, alpha)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("activation", "ReLU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ReLUFloat16; hwyImpl != nil {
+			ReLUFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ReLUBFloat16; hwyImpl != nil {
+			ReLUBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ReLUFloat32; hwyImpl != nil {
+			ReLUFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ReLUFloat64; hwyImpl != nil {
+			ReLUFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("activation", "SiLU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SiLUFloat16; hwyImpl != nil {
+			SiLUFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SiLUBFloat16; hwyImpl != nil {
+			SiLUBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SiLUFloat32; hwyImpl != nil {
+			SiLUFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SiLUFloat64; hwyImpl != nil {
+			SiLUFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("activation", "Softplus", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SoftplusFloat16; hwyImpl != nil {
+			SoftplusFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftplusBFloat16; hwyImpl != nil {
+			SoftplusBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftplusFloat32; hwyImpl != nil {
+			SoftplusFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftplusFloat64; hwyImpl != nil {
+			SoftplusFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("activation", "Tanh", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := TanhFloat16; hwyImpl != nil {
+			TanhFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := TanhBFloat16; hwyImpl != nil {
+			TanhBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := TanhFloat32; hwyImpl != nil {
+			TanhFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := TanhFloat64; hwyImpl != nil {
+			TanhFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
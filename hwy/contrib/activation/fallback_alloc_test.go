@@ -0,0 +1,96 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package activation
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		f16        = make([]hwy.Float16, allocTestLen)
+		bf16       = make([]hwy.BFloat16, allocTestLen)
+		f32        = make([]float32, allocTestLen)
+		f64        = make([]float64, allocTestLen)
+		f16Scalar  = hwy.NewFloat16(1)
+		bf16Scalar = hwy.NewBFloat16(1)
+		f32Scalar  = float32(1)
+		f64Scalar  = float64(1)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseELU_fallback_Float16", func() { BaseELU_fallback_Float16(f16, f16, f16Scalar) }},
+		{"BaseELU_fallback_BFloat16", func() { BaseELU_fallback_BFloat16(bf16, bf16, bf16Scalar) }},
+		{"BaseELU_fallback", func() { BaseELU_fallback(f32, f32, f32Scalar) }},
+		{"BaseELU_fallback_Float64", func() { BaseELU_fallback_Float64(f64, f64, f64Scalar) }},
+		{"BaseGELU_fallback_Float16", func() { BaseGELU_fallback_Float16(f16, f16) }},
+		{"BaseGELU_fallback_BFloat16", func() { BaseGELU_fallback_BFloat16(bf16, bf16) }},
+		{"BaseGELU_fallback", func() { BaseGELU_fallback(f32, f32) }},
+		{"BaseGELU_fallback_Float64", func() { BaseGELU_fallback_Float64(f64, f64) }},
+		{"BaseGELUApprox_fallback_Float16", func() { BaseGELUApprox_fallback_Float16(f16, f16) }},
+		{"BaseGELUApprox_fallback_BFloat16", func() { BaseGELUApprox_fallback_BFloat16(bf16, bf16) }},
+		{"BaseGELUApprox_fallback", func() { BaseGELUApprox_fallback(f32, f32) }},
+		{"BaseGELUApprox_fallback_Float64", func() { BaseGELUApprox_fallback_Float64(f64, f64) }},
+		{"BaseHardSwish_fallback_Float16", func() { BaseHardSwish_fallback_Float16(f16, f16) }},
+		{"BaseHardSwish_fallback_BFloat16", func() { BaseHardSwish_fallback_BFloat16(bf16, bf16) }},
+		{"BaseHardSwish_fallback", func() { BaseHardSwish_fallback(f32, f32) }},
+		{"BaseHardSwish_fallback_Float64", func() { BaseHardSwish_fallback_Float64(f64, f64) }},
+		{"BaseLeakyReLU_fallback_Float16", func() { BaseLeakyReLU_fallback_Float16(f16, f16, f16Scalar) }},
+		{"BaseLeakyReLU_fallback_BFloat16", func() { BaseLeakyReLU_fallback_BFloat16(bf16, bf16, bf16Scalar) }},
+		{"BaseLeakyReLU_fallback", func() { BaseLeakyReLU_fallback(f32, f32, f32Scalar) }},
+		{"BaseLeakyReLU_fallback_Float64", func() { BaseLeakyReLU_fallback_Float64(f64, f64, f64Scalar) }},
+		{"BaseReLU_fallback_Float16", func() { BaseReLU_fallback_Float16(f16, f16) }},
+		{"BaseReLU_fallback_BFloat16", func() { BaseReLU_fallback_BFloat16(bf16, bf16) }},
+		{"BaseReLU_fallback", func() { BaseReLU_fallback(f32, f32) }},
+		{"BaseReLU_fallback_Float64", func() { BaseReLU_fallback_Float64(f64, f64) }},
+		{"BaseSiLU_fallback_Float16", func() { BaseSiLU_fallback_Float16(f16, f16) }},
+		{"BaseSiLU_fallback_BFloat16", func() { BaseSiLU_fallback_BFloat16(bf16, bf16) }},
+		{"BaseSiLU_fallback", func() { BaseSiLU_fallback(f32, f32) }},
+		{"BaseSiLU_fallback_Float64", func() { BaseSiLU_fallback_Float64(f64, f64) }},
+		{"BaseSoftplus_fallback_Float16", func() { BaseSoftplus_fallback_Float16(f16, f16) }},
+		{"BaseSoftplus_fallback_BFloat16", func() { BaseSoftplus_fallback_BFloat16(bf16, bf16) }},
+		{"BaseSoftplus_fallback", func() { BaseSoftplus_fallback(f32, f32) }},
+		{"BaseSoftplus_fallback_Float64", func() { BaseSoftplus_fallback_Float64(f64, f64) }},
+		{"BaseTanh_fallback_Float16", func() { BaseTanh_fallback_Float16(f16, f16) }},
+		{"BaseTanh_fallback_BFloat16", func() { BaseTanh_fallback_BFloat16(bf16, bf16) }},
+		{"BaseTanh_fallback", func() { BaseTanh_fallback(f32, f32) }},
+		{"BaseTanh_fallback_Float64", func() { BaseTanh_fallback_Float64(f64, f64) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
@@ -154,6 +154,23 @@ func TanhTransform[T hwy.Floats](in []T, out []T) {
 
 func init() {
 	initExptransformAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "algo",
+		Groups: []hwy.DispatchGroup{
+			{Name: "CosTransform", Vars: []any{&CosTransformFloat16, &CosTransformBFloat16, &CosTransformFloat32, &CosTransformFloat64}},
+			{Name: "ErfTransform", Vars: []any{&ErfTransformFloat16, &ErfTransformBFloat16, &ErfTransformFloat32, &ErfTransformFloat64}},
+			{Name: "ExpTransform", Vars: []any{&ExpTransformFloat16, &ExpTransformBFloat16, &ExpTransformFloat32, &ExpTransformFloat64}},
+			{Name: "LogTransform", Vars: []any{&LogTransformFloat16, &LogTransformBFloat16, &LogTransformFloat32, &LogTransformFloat64}},
+			{Name: "SigmoidTransform", Vars: []any{&SigmoidTransformFloat16, &SigmoidTransformBFloat16, &SigmoidTransformFloat32, &SigmoidTransformFloat64}},
+			{Name: "SinTransform", Vars: []any{&SinTransformFloat16, &SinTransformBFloat16, &SinTransformFloat32, &SinTransformFloat64}},
+			{Name: "TanhTransform", Vars: []any{&TanhTransformFloat16, &TanhTransformBFloat16, &TanhTransformFloat32, &TanhTransformFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initExptransformAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initExptransformAVX2},
+			{Name: "fallback", Supported: true, Init: initExptransformFallback},
+		},
+	})
 }
 
 func initExptransformAll() {
@@ -0,0 +1,222 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package algo
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("algo", "CosTransform", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := CosTransformFloat16; hwyImpl != nil {
+			CosTransformFloat16 = func(in []hwy.Float16, out []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := CosTransformBFloat16; hwyImpl != nil {
+			CosTransformBFloat16 = func(in []hwy.BFloat16, out []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := CosTransformFloat32; hwyImpl != nil {
+			CosTransformFloat32 = func(in []float32, out []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := CosTransformFloat64; hwyImpl != nil {
+			CosTransformFloat64 = func(in []float64, out []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+	})
+	hwy.ProfileDispatch("algo", "ErfTransform", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ErfTransformFloat16; hwyImpl != nil {
+			ErfTransformFloat16 = func(in []hwy.Float16, out []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := ErfTransformBFloat16; hwyImpl != nil {
+			ErfTransformBFloat16 = func(in []hwy.BFloat16, out []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := ErfTransformFloat32; hwyImpl != nil {
+			ErfTransformFloat32 = func(in []float32, out []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := ErfTransformFloat64; hwyImpl != nil {
+			ErfTransformFloat64 = func(in []float64, out []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+	})
+	hwy.ProfileDispatch("algo", "ExpTransform", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ExpTransformFloat16; hwyImpl != nil {
+			ExpTransformFloat16 = func(in []hwy.Float16, out []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := ExpTransformBFloat16; hwyImpl != nil {
+			ExpTransformBFloat16 = func(in []hwy.BFloat16, out []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := ExpTransformFloat32; hwyImpl != nil {
+			ExpTransformFloat32 = func(in []float32, out []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := ExpTransformFloat64; hwyImpl != nil {
+			ExpTransformFloat64 = func(in []float64, out []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+	})
+	hwy.ProfileDispatch("algo", "LogTransform", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := LogTransformFloat16; hwyImpl != nil {
+			LogTransformFloat16 = func(in []hwy.Float16, out []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := LogTransformBFloat16; hwyImpl != nil {
+			LogTransformBFloat16 = func(in []hwy.BFloat16, out []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := LogTransformFloat32; hwyImpl != nil {
+			LogTransformFloat32 = func(in []float32, out []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := LogTransformFloat64; hwyImpl != nil {
+			LogTransformFloat64 = func(in []float64, out []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+	})
+	hwy.ProfileDispatch("algo", "SigmoidTransform", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SigmoidTransformFloat16; hwyImpl != nil {
+			SigmoidTransformFloat16 = func(in []hwy.Float16, out []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := SigmoidTransformBFloat16; hwyImpl != nil {
+			SigmoidTransformBFloat16 = func(in []hwy.BFloat16, out []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := SigmoidTransformFloat32; hwyImpl != nil {
+			SigmoidTransformFloat32 = func(in []float32, out []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := SigmoidTransformFloat64; hwyImpl != nil {
+			SigmoidTransformFloat64 = func(in []float64, out []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+	})
+	hwy.ProfileDispatch("algo", "SinTransform", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SinTransformFloat16; hwyImpl != nil {
+			SinTransformFloat16 = func(in []hwy.Float16, out []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := SinTransformBFloat16; hwyImpl != nil {
+			SinTransformBFloat16 = func(in []hwy.BFloat16, out []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := SinTransformFloat32; hwyImpl != nil {
+			SinTransformFloat32 = func(in []float32, out []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := SinTransformFloat64; hwyImpl != nil {
+			SinTransformFloat64 = func(in []float64, out []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+	})
+	hwy.ProfileDispatch("algo", "TanhTransform", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := TanhTransformFloat16; hwyImpl != nil {
+			TanhTransformFloat16 = func(in []hwy.Float16, out []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := TanhTransformBFloat16; hwyImpl != nil {
+			TanhTransformBFloat16 = func(in []hwy.BFloat16, out []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := TanhTransformFloat32; hwyImpl != nil {
+			TanhTransformFloat32 = func(in []float32, out []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+		if hwyImpl := TanhTransformFloat64; hwyImpl != nil {
+			TanhTransformFloat64 = func(in []float64, out []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(in, out)
+				hwyCounter.Done(hwyStart, len(in), hwy.SliceBytes(in)+hwy.SliceBytes(out))
+			}
+		}
+	})
+}
@@ -0,0 +1,158 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package algo
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		f16       = make([]hwy.Float16, allocTestLen)
+		bf16      = make([]hwy.BFloat16, allocTestLen)
+		f32       = make([]float32, allocTestLen)
+		f64       = make([]float64, allocTestLen)
+		i8        = make([]int8, allocTestLen)
+		i16       = make([]int16, allocTestLen)
+		i32       = make([]int32, allocTestLen)
+		i64       = make([]int64, allocTestLen)
+		u8        = make([]uint8, allocTestLen)
+		u16       = make([]uint16, allocTestLen)
+		u32       = make([]uint32, allocTestLen)
+		u64       = make([]uint64, allocTestLen)
+		f32Scalar = float32(1)
+		f64Scalar = float64(1)
+		i8Scalar  = int8(1)
+		i16Scalar = int16(1)
+		i32Scalar = int32(1)
+		i64Scalar = int64(1)
+		u8Scalar  = uint8(1)
+		u16Scalar = uint16(1)
+		u32Scalar = uint32(1)
+		u64Scalar = uint64(1)
+		f32Vec    = hwy.Load(f32)
+		f64Vec    = hwy.Load(f64)
+		i32Vec    = hwy.Load(i32)
+		i64Vec    = hwy.Load(i64)
+		u32Vec    = hwy.Load(u32)
+		u64Vec    = hwy.Load(u64)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseApply_fallback_Float16", func() {
+			BaseApply_fallback_Float16(f16, f16, func(v hwy.Vec[hwy.Float16]) hwy.Vec[hwy.Float16] { return v })
+		}},
+		{"BaseApply_fallback_BFloat16", func() {
+			BaseApply_fallback_BFloat16(bf16, bf16, func(v hwy.Vec[hwy.BFloat16]) hwy.Vec[hwy.BFloat16] { return v })
+		}},
+		{"BaseApply_fallback", func() { BaseApply_fallback(f32, f32, func(v hwy.Vec[float32]) hwy.Vec[float32] { return v }) }},
+		{"BaseApply_fallback_Float64", func() { BaseApply_fallback_Float64(f64, f64, func(v hwy.Vec[float64]) hwy.Vec[float64] { return v }) }},
+		{"BaseCosTransform_fallback_Float16", func() { BaseCosTransform_fallback_Float16(f16, f16) }},
+		{"BaseCosTransform_fallback_BFloat16", func() { BaseCosTransform_fallback_BFloat16(bf16, bf16) }},
+		{"BaseCosTransform_fallback", func() { BaseCosTransform_fallback(f32, f32) }},
+		{"BaseCosTransform_fallback_Float64", func() { BaseCosTransform_fallback_Float64(f64, f64) }},
+		{"BaseErfTransform_fallback_Float16", func() { BaseErfTransform_fallback_Float16(f16, f16) }},
+		{"BaseErfTransform_fallback_BFloat16", func() { BaseErfTransform_fallback_BFloat16(bf16, bf16) }},
+		{"BaseErfTransform_fallback", func() { BaseErfTransform_fallback(f32, f32) }},
+		{"BaseErfTransform_fallback_Float64", func() { BaseErfTransform_fallback_Float64(f64, f64) }},
+		{"BaseExpTransform_fallback_Float16", func() { BaseExpTransform_fallback_Float16(f16, f16) }},
+		{"BaseExpTransform_fallback_BFloat16", func() { BaseExpTransform_fallback_BFloat16(bf16, bf16) }},
+		{"BaseExpTransform_fallback", func() { BaseExpTransform_fallback(f32, f32) }},
+		{"BaseExpTransform_fallback_Float64", func() { BaseExpTransform_fallback_Float64(f64, f64) }},
+		{"BaseLogTransform_fallback_Float16", func() { BaseLogTransform_fallback_Float16(f16, f16) }},
+		{"BaseLogTransform_fallback_BFloat16", func() { BaseLogTransform_fallback_BFloat16(bf16, bf16) }},
+		{"BaseLogTransform_fallback", func() { BaseLogTransform_fallback(f32, f32) }},
+		{"BaseLogTransform_fallback_Float64", func() { BaseLogTransform_fallback_Float64(f64, f64) }},
+		{"BaseSigmoidTransform_fallback_Float16", func() { BaseSigmoidTransform_fallback_Float16(f16, f16) }},
+		{"BaseSigmoidTransform_fallback_BFloat16", func() { BaseSigmoidTransform_fallback_BFloat16(bf16, bf16) }},
+		{"BaseSigmoidTransform_fallback", func() { BaseSigmoidTransform_fallback(f32, f32) }},
+		{"BaseSigmoidTransform_fallback_Float64", func() { BaseSigmoidTransform_fallback_Float64(f64, f64) }},
+		{"BaseSinTransform_fallback_Float16", func() { BaseSinTransform_fallback_Float16(f16, f16) }},
+		{"BaseSinTransform_fallback_BFloat16", func() { BaseSinTransform_fallback_BFloat16(bf16, bf16) }},
+		{"BaseSinTransform_fallback", func() { BaseSinTransform_fallback(f32, f32) }},
+		{"BaseSinTransform_fallback_Float64", func() { BaseSinTransform_fallback_Float64(f64, f64) }},
+		{"BaseTanhTransform_fallback_Float16", func() { BaseTanhTransform_fallback_Float16(f16, f16) }},
+		{"BaseTanhTransform_fallback_BFloat16", func() { BaseTanhTransform_fallback_BFloat16(bf16, bf16) }},
+		{"BaseTanhTransform_fallback", func() { BaseTanhTransform_fallback(f32, f32) }},
+		{"BaseTanhTransform_fallback_Float64", func() { BaseTanhTransform_fallback_Float64(f64, f64) }},
+		{"BaseContains_fallback", func() { BaseContains_fallback(f32, f32Scalar) }},
+		{"BaseContains_fallback_Float64", func() { BaseContains_fallback_Float64(f64, f64Scalar) }},
+		{"BaseContains_fallback_Int32", func() { BaseContains_fallback_Int32(i32, i32Scalar) }},
+		{"BaseContains_fallback_Int64", func() { BaseContains_fallback_Int64(i64, i64Scalar) }},
+		{"BaseContains_fallback_Uint32", func() { BaseContains_fallback_Uint32(u32, u32Scalar) }},
+		{"BaseContains_fallback_Uint64", func() { BaseContains_fallback_Uint64(u64, u64Scalar) }},
+		{"BaseCount_fallback", func() { BaseCount_fallback(f32, f32Scalar) }},
+		{"BaseCount_fallback_Float64", func() { BaseCount_fallback_Float64(f64, f64Scalar) }},
+		{"BaseCount_fallback_Int32", func() { BaseCount_fallback_Int32(i32, i32Scalar) }},
+		{"BaseCount_fallback_Int64", func() { BaseCount_fallback_Int64(i64, i64Scalar) }},
+		{"BaseCount_fallback_Uint32", func() { BaseCount_fallback_Uint32(u32, u32Scalar) }},
+		{"BaseCount_fallback_Uint64", func() { BaseCount_fallback_Uint64(u64, u64Scalar) }},
+		{"BaseCount_fallback_Int8", func() { BaseCount_fallback_Int8(i8, i8Scalar) }},
+		{"BaseCount_fallback_Uint8", func() { BaseCount_fallback_Uint8(u8, u8Scalar) }},
+		{"BaseCount_fallback_Int16", func() { BaseCount_fallback_Int16(i16, i16Scalar) }},
+		{"BaseCount_fallback_Uint16", func() { BaseCount_fallback_Uint16(u16, u16Scalar) }},
+		{"BaseFind_fallback", func() { BaseFind_fallback(f32, f32Scalar) }},
+		{"BaseFind_fallback_Float64", func() { BaseFind_fallback_Float64(f64, f64Scalar) }},
+		{"BaseFind_fallback_Int32", func() { BaseFind_fallback_Int32(i32, i32Scalar) }},
+		{"BaseFind_fallback_Int64", func() { BaseFind_fallback_Int64(i64, i64Scalar) }},
+		{"BaseFind_fallback_Uint32", func() { BaseFind_fallback_Uint32(u32, u32Scalar) }},
+		{"BaseFind_fallback_Uint64", func() { BaseFind_fallback_Uint64(u64, u64Scalar) }},
+		{"BaseFind_fallback_Int8", func() { BaseFind_fallback_Int8(i8, i8Scalar) }},
+		{"BaseFind_fallback_Uint8", func() { BaseFind_fallback_Uint8(u8, u8Scalar) }},
+		{"BaseFind_fallback_Int16", func() { BaseFind_fallback_Int16(i16, i16Scalar) }},
+		{"BaseFind_fallback_Uint16", func() { BaseFind_fallback_Uint16(u16, u16Scalar) }},
+		{"BaseDeltaDecode_fallback_Int32", func() { BaseDeltaDecode_fallback_Int32(i32, i32Scalar) }},
+		{"BaseDeltaDecode_fallback_Int64", func() { BaseDeltaDecode_fallback_Int64(i64, i64Scalar) }},
+		{"BaseDeltaDecode_fallback_Uint32", func() { BaseDeltaDecode_fallback_Uint32(u32, u32Scalar) }},
+		{"BaseDeltaDecode_fallback_Uint64", func() { BaseDeltaDecode_fallback_Uint64(u64, u64Scalar) }},
+		{"BasePrefixSum_fallback", func() { BasePrefixSum_fallback(f32) }},
+		{"BasePrefixSum_fallback_Float64", func() { BasePrefixSum_fallback_Float64(f64) }},
+		{"BasePrefixSum_fallback_Int32", func() { BasePrefixSum_fallback_Int32(i32) }},
+		{"BasePrefixSum_fallback_Int64", func() { BasePrefixSum_fallback_Int64(i64) }},
+		{"BasePrefixSum_fallback_Uint32", func() { BasePrefixSum_fallback_Uint32(u32) }},
+		{"BasePrefixSum_fallback_Uint64", func() { BasePrefixSum_fallback_Uint64(u64) }},
+		{"BasePrefixSumVec_fallback", func() { BasePrefixSumVec_fallback(f32Vec) }},
+		{"BasePrefixSumVec_fallback_Float64", func() { BasePrefixSumVec_fallback_Float64(f64Vec) }},
+		{"BasePrefixSumVec_fallback_Int32", func() { BasePrefixSumVec_fallback_Int32(i32Vec) }},
+		{"BasePrefixSumVec_fallback_Int64", func() { BasePrefixSumVec_fallback_Int64(i64Vec) }},
+		{"BasePrefixSumVec_fallback_Uint32", func() { BasePrefixSumVec_fallback_Uint32(u32Vec) }},
+		{"BasePrefixSumVec_fallback_Uint64", func() { BasePrefixSumVec_fallback_Uint64(u64Vec) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
@@ -14,7 +14,13 @@
 
 package algo
 
-import "github.com/ajroetker/go-highway/hwy"
+import (
+	"encoding/binary"
+	"math/bits"
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
 
 //go:generate go run ../../../cmd/hwygen -input find_base.go -output . -targets avx2,avx512,neon:asm,fallback -dispatch find
 
@@ -49,6 +55,81 @@ func BaseFind[T hwy.Lanes](slice []T, value T) int {
 	return -1
 }
 
+// BaseFindScalar is the fallback of BaseFind. Without vector registers a
+// plain scan does one compare per element, where the emulated Equal and
+// FindFirstTrue loop over every lane.
+//
+//hwy:specializes Find
+//hwy:targets fallback
+func BaseFindScalar[T hwy.Lanes](slice []T, value T) int {
+	for i, v := range slice {
+		if v == value {
+			return i
+		}
+	}
+	return -1
+}
+
+// Word-at-a-time (SWAR) constants: the low bit and the high bit of every
+// 8-bit and 16-bit lane of a uint64.
+const (
+	swarLow8   = 0x0101010101010101
+	swarHigh8  = 0x8080808080808080
+	swarLow16  = 0x0001000100010001
+	swarHigh16 = 0x8000800080008000
+)
+
+// BaseFindSWAR8 is the fallback of BaseFind for 8-bit lanes. It tests eight
+// elements per 64-bit word: w^pattern has a zero byte where an element
+// matches, and haszero(x) = (x-0x01..)&^x&0x80.. flags the first of them
+// exactly (a borrow can only set bytes above a true zero).
+//
+//hwy:gen T={int8, uint8}
+//hwy:specializes Find
+//hwy:targets fallback
+func BaseFindSWAR8[T int8 | uint8](slice []T, value T) int {
+	b := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(slice))), len(slice))
+	pattern := uint64(uint8(value)) * swarLow8
+	i := 0
+	for ; i+8 <= len(b); i += 8 {
+		x := binary.LittleEndian.Uint64(b[i:]) ^ pattern
+		if m := (x - swarLow8) &^ x & swarHigh8; m != 0 {
+			return i + bits.TrailingZeros64(m)/8
+		}
+	}
+	for ; i < len(slice); i++ {
+		if slice[i] == value {
+			return i
+		}
+	}
+	return -1
+}
+
+// BaseFindSWAR16 is BaseFindSWAR8 for 16-bit lanes, four per word. The word
+// is read little-endian from the raw bytes and value is splatted from its own
+// bytes the same way, so lane k is element k on either byte order.
+//
+//hwy:gen T={int16, uint16}
+//hwy:specializes Find
+//hwy:targets fallback
+func BaseFindSWAR16[T int16 | uint16](slice []T, value T) int {
+	b := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(slice))), 2*len(slice))
+	pattern := uint64(binary.LittleEndian.Uint16(unsafe.Slice((*byte)(unsafe.Pointer(&value)), 2))) * swarLow16
+	i := 0
+	for ; i+8 <= len(b); i += 8 {
+		x := binary.LittleEndian.Uint64(b[i:]) ^ pattern
+		if m := (x - swarLow16) &^ x & swarHigh16; m != 0 {
+			return i/2 + bits.TrailingZeros64(m)/16
+		}
+	}
+	for i /= 2; i < len(slice); i++ {
+		if slice[i] == value {
+			return i
+		}
+	}
+	return -1
+}
+
 // BaseCount returns the number of elements equal to target.
 // Uses SIMD comparison and popcount for efficiency.
 func BaseCount[T hwy.Lanes](slice []T, value T) int {
@@ -79,9 +160,72 @@ func BaseCount[T hwy.Lanes](slice []T, value T) int {
 	return count
 }
 
+// BaseCountScalar is the fallback of BaseCount.
+//
+//hwy:specializes Count
+//hwy:targets fallback
+func BaseCountScalar[T hwy.Lanes](slice []T, value T) int {
+	count := 0
+	for _, v := range slice {
+		if v == value {
+			count++
+		}
+	}
+	return count
+}
+
+// BaseCountSWAR8 is the fallback of BaseCount for 8-bit lanes. Counting
+// needs every match, not just the first, so zero bytes of x = w^pattern are
+// flagged without borrows: ((x&0x7f..)+0x7f..)|x sets the high bit of each
+// nonzero byte, and the complement's high bits are popcounted.
+//
+//hwy:gen T={int8, uint8}
+//hwy:specializes Count
+//hwy:targets fallback
+func BaseCountSWAR8[T int8 | uint8](slice []T, value T) int {
+	b := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(slice))), len(slice))
+	pattern := uint64(uint8(value)) * swarLow8
+	count := 0
+	i := 0
+	for ; i+8 <= len(b); i += 8 {
+		x := binary.LittleEndian.Uint64(b[i:]) ^ pattern
+		nonzero := (x&^swarHigh8 + (swarHigh8 - swarLow8)) | x
+		count += bits.OnesCount64(^nonzero & swarHigh8)
+	}
+	for ; i < len(slice); i++ {
+		if slice[i] == value {
+			count++
+		}
+	}
+	return count
+}
+
+// BaseCountSWAR16 is BaseCountSWAR8 for 16-bit lanes, four per word, read
+// the same way as in BaseFindSWAR16.
+//
+//hwy:gen T={int16, uint16}
+//hwy:specializes Count
+//hwy:targets fallback
+func BaseCountSWAR16[T int16 | uint16](slice []T, value T) int {
+	b := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(slice))), 2*len(slice))
+	pattern := uint64(binary.LittleEndian.Uint16(unsafe.Slice((*byte)(unsafe.Pointer(&value)), 2))) * swarLow16
+	count := 0
+	i := 0
+	for ; i+8 <= len(b); i += 8 {
+		x := binary.LittleEndian.Uint64(b[i:]) ^ pattern
+		nonzero := (x&^swarHigh16 + (swarHigh16 - swarLow16)) | x
+		count += bits.OnesCount64(^nonzero & swarHigh16)
+	}
+	for i /= 2; i < len(slice); i++ {
+		if slice[i] == value {
+			count++
+		}
+	}
+	return count
+}
+
 // BaseContains returns true if slice contains the specified value.
 // This is a convenience wrapper around BaseFind.
 func BaseContains[T hwy.Lanes](slice []T, value T) bool {
 	return BaseFind(slice, value) >= 0
 }
-
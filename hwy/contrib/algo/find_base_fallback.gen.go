@@ -3,7 +3,9 @@
 package algo
 
 import (
-	"github.com/ajroetker/go-highway/hwy"
+	"encoding/binary"
+	"math/bits"
+	"unsafe"
 )
 
 func BaseContains_fallback(slice []float32, value float32) bool {
@@ -31,21 +33,9 @@ func BaseContains_fallback_Uint64(slice []uint64, value uint64) bool {
 }
 
 func BaseCount_fallback(slice []float32, value float32) int {
-	n := len(slice)
-	if n == 0 {
-		return 0
-	}
-	target := hwy.Set(value)
-	lanes := hwy.MaxLanes[float32]()
 	count := 0
-	i := 0
-	for ; i+lanes <= n; i += lanes {
-		v := hwy.Load(slice[i:])
-		mask := hwy.Equal(v, target)
-		count += hwy.CountTrue(mask)
-	}
-	for ; i < n; i++ {
-		if slice[i] == value {
+	for _, v := range slice {
+		if v == value {
 			count++
 		}
 	}
@@ -53,42 +43,66 @@ func BaseCount_fallback(slice []float32, value float32) int {
 }
 
 func BaseCount_fallback_Float64(slice []float64, value float64) int {
-	n := len(slice)
-	if n == 0 {
-		return 0
+	count := 0
+	for _, v := range slice {
+		if v == value {
+			count++
+		}
 	}
-	target := hwy.Set(value)
-	lanes := hwy.MaxLanes[float64]()
+	return count
+}
+
+func BaseCount_fallback_Int32(slice []int32, value int32) int {
 	count := 0
-	i := 0
-	for ; i+lanes <= n; i += lanes {
-		v := hwy.Load(slice[i:])
-		mask := hwy.Equal(v, target)
-		count += hwy.CountTrue(mask)
+	for _, v := range slice {
+		if v == value {
+			count++
+		}
 	}
-	for ; i < n; i++ {
-		if slice[i] == value {
+	return count
+}
+
+func BaseCount_fallback_Int64(slice []int64, value int64) int {
+	count := 0
+	for _, v := range slice {
+		if v == value {
 			count++
 		}
 	}
 	return count
 }
 
-func BaseCount_fallback_Int32(slice []int32, value int32) int {
-	n := len(slice)
-	if n == 0 {
-		return 0
+func BaseCount_fallback_Uint32(slice []uint32, value uint32) int {
+	count := 0
+	for _, v := range slice {
+		if v == value {
+			count++
+		}
 	}
-	target := hwy.Set(value)
-	lanes := hwy.MaxLanes[int32]()
+	return count
+}
+
+func BaseCount_fallback_Uint64(slice []uint64, value uint64) int {
+	count := 0
+	for _, v := range slice {
+		if v == value {
+			count++
+		}
+	}
+	return count
+}
+
+func BaseCount_fallback_Int8(slice []int8, value int8) int {
+	b := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(slice))), len(slice))
+	pattern := uint64(uint8(value)) * swarLow8
 	count := 0
 	i := 0
-	for ; i+lanes <= n; i += lanes {
-		v := hwy.Load(slice[i:])
-		mask := hwy.Equal(v, target)
-		count += hwy.CountTrue(mask)
+	for ; i+8 <= len(b); i += 8 {
+		x := binary.LittleEndian.Uint64(b[i:]) ^ pattern
+		nonzero := (x&^swarHigh8 + (swarHigh8 - swarLow8)) | x
+		count += bits.OnesCount64(^nonzero & swarHigh8)
 	}
-	for ; i < n; i++ {
+	for ; i < len(slice); i++ {
 		if slice[i] == value {
 			count++
 		}
@@ -96,21 +110,17 @@ func BaseCount_fallback_Int32(slice []int32, value int32) int {
 	return count
 }
 
-func BaseCount_fallback_Int64(slice []int64, value int64) int {
-	n := len(slice)
-	if n == 0 {
-		return 0
-	}
-	target := hwy.Set(value)
-	lanes := hwy.MaxLanes[int64]()
+func BaseCount_fallback_Uint8(slice []uint8, value uint8) int {
+	b := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(slice))), len(slice))
+	pattern := uint64(uint8(value)) * swarLow8
 	count := 0
 	i := 0
-	for ; i+lanes <= n; i += lanes {
-		v := hwy.Load(slice[i:])
-		mask := hwy.Equal(v, target)
-		count += hwy.CountTrue(mask)
+	for ; i+8 <= len(b); i += 8 {
+		x := binary.LittleEndian.Uint64(b[i:]) ^ pattern
+		nonzero := (x&^swarHigh8 + (swarHigh8 - swarLow8)) | x
+		count += bits.OnesCount64(^nonzero & swarHigh8)
 	}
-	for ; i < n; i++ {
+	for ; i < len(slice); i++ {
 		if slice[i] == value {
 			count++
 		}
@@ -118,21 +128,17 @@ func BaseCount_fallback_Int64(slice []int64, value int64) int {
 	return count
 }
 
-func BaseCount_fallback_Uint32(slice []uint32, value uint32) int {
-	n := len(slice)
-	if n == 0 {
-		return 0
-	}
-	target := hwy.Set(value)
-	lanes := hwy.MaxLanes[uint32]()
+func BaseCount_fallback_Int16(slice []int16, value int16) int {
+	b := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(slice))), 2*len(slice))
+	pattern := uint64(binary.LittleEndian.Uint16(unsafe.Slice((*byte)(unsafe.Pointer(&value)), 2))) * swarLow16
 	count := 0
 	i := 0
-	for ; i+lanes <= n; i += lanes {
-		v := hwy.Load(slice[i:])
-		mask := hwy.Equal(v, target)
-		count += hwy.CountTrue(mask)
+	for ; i+8 <= len(b); i += 8 {
+		x := binary.LittleEndian.Uint64(b[i:]) ^ pattern
+		nonzero := (x&^swarHigh16 + (swarHigh16 - swarLow16)) | x
+		count += bits.OnesCount64(^nonzero & swarHigh16)
 	}
-	for ; i < n; i++ {
+	for i /= 2; i < len(slice); i++ {
 		if slice[i] == value {
 			count++
 		}
@@ -140,21 +146,17 @@ func BaseCount_fallback_Uint32(slice []uint32, value uint32) int {
 	return count
 }
 
-func BaseCount_fallback_Uint64(slice []uint64, value uint64) int {
-	n := len(slice)
-	if n == 0 {
-		return 0
-	}
-	target := hwy.Set(value)
-	lanes := hwy.MaxLanes[uint64]()
+func BaseCount_fallback_Uint16(slice []uint16, value uint16) int {
+	b := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(slice))), 2*len(slice))
+	pattern := uint64(binary.LittleEndian.Uint16(unsafe.Slice((*byte)(unsafe.Pointer(&value)), 2))) * swarLow16
 	count := 0
 	i := 0
-	for ; i+lanes <= n; i += lanes {
-		v := hwy.Load(slice[i:])
-		mask := hwy.Equal(v, target)
-		count += hwy.CountTrue(mask)
+	for ; i+8 <= len(b); i += 8 {
+		x := binary.LittleEndian.Uint64(b[i:]) ^ pattern
+		nonzero := (x&^swarHigh16 + (swarHigh16 - swarLow16)) | x
+		count += bits.OnesCount64(^nonzero & swarHigh16)
 	}
-	for ; i < n; i++ {
+	for i /= 2; i < len(slice); i++ {
 		if slice[i] == value {
 			count++
 		}
@@ -163,67 +165,70 @@ func BaseCount_fallback_Uint64(slice []uint64, value uint64) int {
 }
 
 func BaseFind_fallback(slice []float32, value float32) int {
-	n := len(slice)
-	if n == 0 {
-		return -1
-	}
-	target := hwy.Set(value)
-	lanes := hwy.MaxLanes[float32]()
-	i := 0
-	for ; i+lanes <= n; i += lanes {
-		v := hwy.Load(slice[i:])
-		mask := hwy.Equal(v, target)
-		if idx := hwy.FindFirstTrue(mask); idx >= 0 {
-			return i + idx
+	for i, v := range slice {
+		if v == value {
+			return i
 		}
 	}
-	for ; i < n; i++ {
-		if slice[i] == value {
+	return -1
+}
+
+func BaseFind_fallback_Float64(slice []float64, value float64) int {
+	for i, v := range slice {
+		if v == value {
 			return i
 		}
 	}
 	return -1
 }
 
-func BaseFind_fallback_Float64(slice []float64, value float64) int {
-	n := len(slice)
-	if n == 0 {
-		return -1
+func BaseFind_fallback_Int32(slice []int32, value int32) int {
+	for i, v := range slice {
+		if v == value {
+			return i
+		}
 	}
-	target := hwy.Set(value)
-	lanes := hwy.MaxLanes[float64]()
-	i := 0
-	for ; i+lanes <= n; i += lanes {
-		v := hwy.Load(slice[i:])
-		mask := hwy.Equal(v, target)
-		if idx := hwy.FindFirstTrue(mask); idx >= 0 {
-			return i + idx
+	return -1
+}
+
+func BaseFind_fallback_Int64(slice []int64, value int64) int {
+	for i, v := range slice {
+		if v == value {
+			return i
 		}
 	}
-	for ; i < n; i++ {
-		if slice[i] == value {
+	return -1
+}
+
+func BaseFind_fallback_Uint32(slice []uint32, value uint32) int {
+	for i, v := range slice {
+		if v == value {
 			return i
 		}
 	}
 	return -1
 }
 
-func BaseFind_fallback_Int32(slice []int32, value int32) int {
-	n := len(slice)
-	if n == 0 {
-		return -1
+func BaseFind_fallback_Uint64(slice []uint64, value uint64) int {
+	for i, v := range slice {
+		if v == value {
+			return i
+		}
 	}
-	target := hwy.Set(value)
-	lanes := hwy.MaxLanes[int32]()
+	return -1
+}
+
+func BaseFind_fallback_Int8(slice []int8, value int8) int {
+	b := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(slice))), len(slice))
+	pattern := uint64(uint8(value)) * swarLow8
 	i := 0
-	for ; i+lanes <= n; i += lanes {
-		v := hwy.Load(slice[i:])
-		mask := hwy.Equal(v, target)
-		if idx := hwy.FindFirstTrue(mask); idx >= 0 {
-			return i + idx
+	for ; i+8 <= len(b); i += 8 {
+		x := binary.LittleEndian.Uint64(b[i:]) ^ pattern
+		if m := (x - swarLow8) &^ x & swarHigh8; m != 0 {
+			return i + bits.TrailingZeros64(m)/8
 		}
 	}
-	for ; i < n; i++ {
+	for ; i < len(slice); i++ {
 		if slice[i] == value {
 			return i
 		}
@@ -231,22 +236,17 @@ func BaseFind_fallback_Int32(slice []int32, value int32) int {
 	return -1
 }
 
-func BaseFind_fallback_Int64(slice []int64, value int64) int {
-	n := len(slice)
-	if n == 0 {
-		return -1
-	}
-	target := hwy.Set(value)
-	lanes := hwy.MaxLanes[int64]()
+func BaseFind_fallback_Uint8(slice []uint8, value uint8) int {
+	b := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(slice))), len(slice))
+	pattern := uint64(uint8(value)) * swarLow8
 	i := 0
-	for ; i+lanes <= n; i += lanes {
-		v := hwy.Load(slice[i:])
-		mask := hwy.Equal(v, target)
-		if idx := hwy.FindFirstTrue(mask); idx >= 0 {
-			return i + idx
+	for ; i+8 <= len(b); i += 8 {
+		x := binary.LittleEndian.Uint64(b[i:]) ^ pattern
+		if m := (x - swarLow8) &^ x & swarHigh8; m != 0 {
+			return i + bits.TrailingZeros64(m)/8
 		}
 	}
-	for ; i < n; i++ {
+	for ; i < len(slice); i++ {
 		if slice[i] == value {
 			return i
 		}
@@ -254,22 +254,17 @@ func BaseFind_fallback_Int64(slice []int64, value int64) int {
 	return -1
 }
 
-func BaseFind_fallback_Uint32(slice []uint32, value uint32) int {
-	n := len(slice)
-	if n == 0 {
-		return -1
-	}
-	target := hwy.Set(value)
-	lanes := hwy.MaxLanes[uint32]()
+func BaseFind_fallback_Int16(slice []int16, value int16) int {
+	b := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(slice))), 2*len(slice))
+	pattern := uint64(binary.LittleEndian.Uint16(unsafe.Slice((*byte)(unsafe.Pointer(&value)), 2))) * swarLow16
 	i := 0
-	for ; i+lanes <= n; i += lanes {
-		v := hwy.Load(slice[i:])
-		mask := hwy.Equal(v, target)
-		if idx := hwy.FindFirstTrue(mask); idx >= 0 {
-			return i + idx
+	for ; i+8 <= len(b); i += 8 {
+		x := binary.LittleEndian.Uint64(b[i:]) ^ pattern
+		if m := (x - swarLow16) &^ x & swarHigh16; m != 0 {
+			return i/2 + bits.TrailingZeros64(m)/16
 		}
 	}
-	for ; i < n; i++ {
+	for i /= 2; i < len(slice); i++ {
 		if slice[i] == value {
 			return i
 		}
@@ -277,22 +272,17 @@ func BaseFind_fallback_Uint32(slice []uint32, value uint32) int {
 	return -1
 }
 
-func BaseFind_fallback_Uint64(slice []uint64, value uint64) int {
-	n := len(slice)
-	if n == 0 {
-		return -1
-	}
-	target := hwy.Set(value)
-	lanes := hwy.MaxLanes[uint64]()
+func BaseFind_fallback_Uint16(slice []uint16, value uint16) int {
+	b := unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(slice))), 2*len(slice))
+	pattern := uint64(binary.LittleEndian.Uint16(unsafe.Slice((*byte)(unsafe.Pointer(&value)), 2))) * swarLow16
 	i := 0
-	for ; i+lanes <= n; i += lanes {
-		v := hwy.Load(slice[i:])
-		mask := hwy.Equal(v, target)
-		if idx := hwy.FindFirstTrue(mask); idx >= 0 {
-			return i + idx
+	for ; i+8 <= len(b); i += 8 {
+		x := binary.LittleEndian.Uint64(b[i:]) ^ pattern
+		if m := (x - swarLow16) &^ x & swarHigh16; m != 0 {
+			return i/2 + bits.TrailingZeros64(m)/16
 		}
 	}
-	for ; i < n; i++ {
+	for i /= 2; i < len(slice); i++ {
 		if slice[i] == value {
 			return i
 		}
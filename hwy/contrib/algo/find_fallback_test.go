@@ -0,0 +1,99 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package algo
+
+import (
+	"fmt"
+	"testing"
+)
+
+// checkFindCountFallback compares a SWAR Find/Count fallback against a plain
+// scan for every length up to 40 and every match position, with values whose
+// bytes have the high bit set and neighbours that differ from the target by
+// one (the cases where a borrow could leak into the next lane).
+func checkFindCountFallback[T int8 | uint8 | int16 | uint16](t *testing.T, find, count func([]T, T) int, values []T) {
+	t.Helper()
+	for _, value := range values {
+		for n := range 41 {
+			for pos := -1; pos < n; pos++ {
+				slice := make([]T, n)
+				for i := range slice {
+					slice[i] = value + 1
+				}
+				if pos >= 0 {
+					slice[pos] = value
+					for i := pos + 3; i < n; i += 5 {
+						slice[i] = value
+					}
+				}
+				if got, want := find(slice, value), BaseFindScalar(slice, value); got != want {
+					t.Fatalf("find(%v, %v) = %d, want %d", slice, value, got, want)
+				}
+				if got, want := count(slice, value), BaseCountScalar(slice, value); got != want {
+					t.Fatalf("count(%v, %v) = %d, want %d", slice, value, got, want)
+				}
+			}
+		}
+	}
+}
+
+func TestFindCountFallbackSWAR(t *testing.T) {
+	checkFindCountFallback(t, BaseFind_fallback_Uint8, BaseCount_fallback_Uint8, []uint8{0, 1, 0x7f, 0x80, 0xff})
+	checkFindCountFallback(t, BaseFind_fallback_Int8, BaseCount_fallback_Int8, []int8{0, 1, -1, 127, -128})
+	checkFindCountFallback(t, BaseFind_fallback_Uint16, BaseCount_fallback_Uint16, []uint16{0, 1, 0x00ff, 0x0100, 0x8000, 0xffff})
+	checkFindCountFallback(t, BaseFind_fallback_Int16, BaseCount_fallback_Int16, []int16{0, 1, -1, 255, -32768})
+}
+
+// fallbackBenchLen sizes the fallback benchmarks, which run the SWAR kernels
+// next to the plain scans they replace, with the only match last (Find) or
+// every tenth element matching (Count).
+const fallbackBenchLen = 1024
+
+func benchFindCountFallback[T uint8 | uint16](b *testing.B, find, count func([]T, T) int) {
+	slice := make([]T, fallbackBenchLen)
+	for i := range slice {
+		slice[i] = T(i%7 + 1)
+	}
+	slice[fallbackBenchLen-1] = 0
+	name := fmt.Sprintf("%T", slice[0])
+	b.Run("Find/swar/"+name, func(b *testing.B) {
+		for b.Loop() {
+			find(slice, 0)
+		}
+	})
+	b.Run("Find/scalar/"+name, func(b *testing.B) {
+		for b.Loop() {
+			BaseFindScalar(slice, 0)
+		}
+	})
+	for i := 0; i < fallbackBenchLen; i += 10 {
+		slice[i] = 0
+	}
+	b.Run("Count/swar/"+name, func(b *testing.B) {
+		for b.Loop() {
+			count(slice, 0)
+		}
+	})
+	b.Run("Count/scalar/"+name, func(b *testing.B) {
+		for b.Loop() {
+			BaseCountScalar(slice, 0)
+		}
+	})
+}
+
+func BenchmarkFindCountFallback(b *testing.B) {
+	benchFindCountFallback(b, BaseFind_fallback_Uint8, BaseCount_fallback_Uint8)
+	benchFindCountFallback(b, BaseFind_fallback_Uint16, BaseCount_fallback_Uint16)
+}
@@ -0,0 +1,226 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package algo
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("algo", "Contains", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ContainsFloat32; hwyImpl != nil {
+			ContainsFloat32 = func(slice []float32, value float32) bool {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ContainsFloat64; hwyImpl != nil {
+			ContainsFloat64 = func(slice []float64, value float64) bool {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ContainsInt32; hwyImpl != nil {
+			ContainsInt32 = func(slice []int32, value int32) bool {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ContainsInt64; hwyImpl != nil {
+			ContainsInt64 = func(slice []int64, value int64) bool {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ContainsUint32; hwyImpl != nil {
+			ContainsUint32 = func(slice []uint32, value uint32) bool {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ContainsUint64; hwyImpl != nil {
+			ContainsUint64 = func(slice []uint64, value uint64) bool {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("algo", "Count", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := CountFloat32; hwyImpl != nil {
+			CountFloat32 = func(slice []float32, value float32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CountFloat64; hwyImpl != nil {
+			CountFloat64 = func(slice []float64, value float64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CountInt32; hwyImpl != nil {
+			CountInt32 = func(slice []int32, value int32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CountInt64; hwyImpl != nil {
+			CountInt64 = func(slice []int64, value int64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CountUint32; hwyImpl != nil {
+			CountUint32 = func(slice []uint32, value uint32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CountUint64; hwyImpl != nil {
+			CountUint64 = func(slice []uint64, value uint64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CountInt8; hwyImpl != nil {
+			CountInt8 = func(slice []int8, value int8) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CountUint8; hwyImpl != nil {
+			CountUint8 = func(slice []uint8, value uint8) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CountInt16; hwyImpl != nil {
+			CountInt16 = func(slice []int16, value int16) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CountUint16; hwyImpl != nil {
+			CountUint16 = func(slice []uint16, value uint16) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("algo", "Find", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FindFloat32; hwyImpl != nil {
+			FindFloat32 = func(slice []float32, value float32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := FindFloat64; hwyImpl != nil {
+			FindFloat64 = func(slice []float64, value float64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := FindInt32; hwyImpl != nil {
+			FindInt32 = func(slice []int32, value int32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := FindInt64; hwyImpl != nil {
+			FindInt64 = func(slice []int64, value int64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := FindUint32; hwyImpl != nil {
+			FindUint32 = func(slice []uint32, value uint32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := FindUint64; hwyImpl != nil {
+			FindUint64 = func(slice []uint64, value uint64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := FindInt8; hwyImpl != nil {
+			FindInt8 = func(slice []int8, value int8) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := FindUint8; hwyImpl != nil {
+			FindUint8 = func(slice []uint8, value uint8) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := FindInt16; hwyImpl != nil {
+			FindInt16 = func(slice []int16, value int16) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+		if hwyImpl := FindUint16; hwyImpl != nil {
+			FindUint16 = func(slice []uint16, value uint16) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(slice, value)
+				hwyCounter.Done(hwyStart, len(slice), hwy.SliceBytes(slice))
+				return hwyR0
+			}
+		}
+	})
+}
@@ -20,12 +20,20 @@ var CountInt32 func(slice []int32, value int32) int
 var CountInt64 func(slice []int64, value int64) int
 var CountUint32 func(slice []uint32, value uint32) int
 var CountUint64 func(slice []uint64, value uint64) int
+var CountInt8 func(slice []int8, value int8) int
+var CountUint8 func(slice []uint8, value uint8) int
+var CountInt16 func(slice []int16, value int16) int
+var CountUint16 func(slice []uint16, value uint16) int
 var FindFloat32 func(slice []float32, value float32) int
 var FindFloat64 func(slice []float64, value float64) int
 var FindInt32 func(slice []int32, value int32) int
 var FindInt64 func(slice []int64, value int64) int
 var FindUint32 func(slice []uint32, value uint32) int
 var FindUint64 func(slice []uint64, value uint64) int
+var FindInt8 func(slice []int8, value int8) int
+var FindUint8 func(slice []uint8, value uint8) int
+var FindInt16 func(slice []int16, value int16) int
+var FindUint16 func(slice []uint16, value uint16) int
 
 // Contains returns true if slice contains the specified value.
 // This is a convenience wrapper around BaseFind.
@@ -76,6 +84,18 @@ func Count[T hwy.Lanes](slice []T, value T) int {
 	if _, ok := any(slice).([]uint64); ok {
 		return CountUint64(any(slice).([]uint64), any(value).(uint64))
 	}
+	if _, ok := any(slice).([]int8); ok {
+		return CountInt8(any(slice).([]int8), any(value).(int8))
+	}
+	if _, ok := any(slice).([]uint8); ok {
+		return CountUint8(any(slice).([]uint8), any(value).(uint8))
+	}
+	if _, ok := any(slice).([]int16); ok {
+		return CountInt16(any(slice).([]int16), any(value).(int16))
+	}
+	if _, ok := any(slice).([]uint16); ok {
+		return CountUint16(any(slice).([]uint16), any(value).(uint16))
+	}
 	panic("unsupported type")
 }
 
@@ -102,11 +122,34 @@ func Find[T hwy.Lanes](slice []T, value T) int {
 	if _, ok := any(slice).([]uint64); ok {
 		return FindUint64(any(slice).([]uint64), any(value).(uint64))
 	}
+	if _, ok := any(slice).([]int8); ok {
+		return FindInt8(any(slice).([]int8), any(value).(int8))
+	}
+	if _, ok := any(slice).([]uint8); ok {
+		return FindUint8(any(slice).([]uint8), any(value).(uint8))
+	}
+	if _, ok := any(slice).([]int16); ok {
+		return FindInt16(any(slice).([]int16), any(value).(int16))
+	}
+	if _, ok := any(slice).([]uint16); ok {
+		return FindUint16(any(slice).([]uint16), any(value).(uint16))
+	}
 	panic("unsupported type")
 }
 
 func init() {
 	initFindAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "algo",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Contains", Vars: []any{&ContainsFloat32, &ContainsFloat64, &ContainsInt32, &ContainsInt64, &ContainsUint32, &ContainsUint64}},
+			{Name: "Count", Vars: []any{&CountFloat32, &CountFloat64, &CountInt32, &CountInt64, &CountUint32, &CountUint64, &CountInt8, &CountUint8, &CountInt16, &CountUint16}},
+			{Name: "Find", Vars: []any{&FindFloat32, &FindFloat64, &FindInt32, &FindInt64, &FindUint32, &FindUint64, &FindInt8, &FindUint8, &FindInt16, &FindUint16}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initFindFallback},
+		},
+	})
 }
 
 func initFindAll() {
@@ -126,10 +169,18 @@ func initFindFallback() {
 	CountInt64 = BaseCount_fallback_Int64
 	CountUint32 = BaseCount_fallback_Uint32
 	CountUint64 = BaseCount_fallback_Uint64
+	CountInt8 = BaseCount_fallback_Int8
+	CountUint8 = BaseCount_fallback_Uint8
+	CountInt16 = BaseCount_fallback_Int16
+	CountUint16 = BaseCount_fallback_Uint16
 	FindFloat32 = BaseFind_fallback
 	FindFloat64 = BaseFind_fallback_Float64
 	FindInt32 = BaseFind_fallback_Int32
 	FindInt64 = BaseFind_fallback_Int64
 	FindUint32 = BaseFind_fallback_Uint32
 	FindUint64 = BaseFind_fallback_Uint64
+	FindInt8 = BaseFind_fallback_Int8
+	FindUint8 = BaseFind_fallback_Uint8
+	FindInt16 = BaseFind_fallback_Int16
+	FindUint16 = BaseFind_fallback_Uint16
 }
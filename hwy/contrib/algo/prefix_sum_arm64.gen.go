@@ -87,6 +87,17 @@ func PrefixSum[T hwy.Integers | hwy.FloatsNative](data []T) {
 
 func init() {
 	initPrefix_sumAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "algo",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DeltaDecode", Vars: []any{&DeltaDecodeInt32, &DeltaDecodeInt64, &DeltaDecodeUint32, &DeltaDecodeUint64}},
+			{Name: "PrefixSum", Vars: []any{&PrefixSumFloat32, &PrefixSumFloat64, &PrefixSumInt32, &PrefixSumInt64, &PrefixSumUint32, &PrefixSumUint64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initPrefix_sumNEONAsm},
+			{Name: "fallback", Supported: true, Init: initPrefix_sumFallback},
+		},
+	})
 }
 
 func initPrefix_sumAll() {
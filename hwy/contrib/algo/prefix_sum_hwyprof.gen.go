@@ -0,0 +1,86 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package algo
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("algo", "DeltaDecode", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DeltaDecodeInt32; hwyImpl != nil {
+			DeltaDecodeInt32 = func(data []int32, base int32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, base)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := DeltaDecodeInt64; hwyImpl != nil {
+			DeltaDecodeInt64 = func(data []int64, base int64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, base)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := DeltaDecodeUint32; hwyImpl != nil {
+			DeltaDecodeUint32 = func(data []uint32, base uint32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, base)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := DeltaDecodeUint64; hwyImpl != nil {
+			DeltaDecodeUint64 = func(data []uint64, base uint64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, base)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+	})
+	hwy.ProfileDispatch("algo", "PrefixSum", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PrefixSumFloat32; hwyImpl != nil {
+			PrefixSumFloat32 = func(data []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := PrefixSumFloat64; hwyImpl != nil {
+			PrefixSumFloat64 = func(data []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := PrefixSumInt32; hwyImpl != nil {
+			PrefixSumInt32 = func(data []int32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := PrefixSumInt64; hwyImpl != nil {
+			PrefixSumInt64 = func(data []int64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := PrefixSumUint32; hwyImpl != nil {
+			PrefixSumUint32 = func(data []uint32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := PrefixSumUint64; hwyImpl != nil {
+			PrefixSumUint64 = func(data []uint64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+	})
+}
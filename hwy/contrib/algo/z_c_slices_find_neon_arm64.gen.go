@@ -18,7 +18,7 @@ func containsAsmF32(slice []float32, value float32) bool {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return false
+		return BaseContains_fallback(slice, value)
 	}
 	var out_result int64
 	asm.Contains_F32(
@@ -38,7 +38,7 @@ func containsAsmF64(slice []float64, value float64) bool {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return false
+		return BaseContains_fallback_Float64(slice, value)
 	}
 	var out_result int64
 	asm.Contains_F64(
@@ -58,7 +58,7 @@ func containsAsmS32(slice []int32, value int32) bool {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return false
+		return BaseContains_fallback_Int32(slice, value)
 	}
 	var out_result int64
 	asm.Contains_S32(
@@ -78,7 +78,7 @@ func containsAsmS64(slice []int64, value int64) bool {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return false
+		return BaseContains_fallback_Int64(slice, value)
 	}
 	var out_result int64
 	asm.Contains_S64(
@@ -98,7 +98,7 @@ func containsAsmU32(slice []uint32, value uint32) bool {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return false
+		return BaseContains_fallback_Uint32(slice, value)
 	}
 	var out_result int64
 	asm.Contains_U32(
@@ -118,7 +118,7 @@ func containsAsmU64(slice []uint64, value uint64) bool {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return false
+		return BaseContains_fallback_Uint64(slice, value)
 	}
 	var out_result int64
 	asm.Contains_U64(
@@ -138,7 +138,7 @@ func countAsmF32(slice []float32, value float32) int {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return 0
+		return BaseCount_fallback(slice, value)
 	}
 	var out_result int64
 	asm.Count_F32(
@@ -158,7 +158,7 @@ func countAsmF64(slice []float64, value float64) int {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return 0
+		return BaseCount_fallback_Float64(slice, value)
 	}
 	var out_result int64
 	asm.Count_F64(
@@ -178,7 +178,7 @@ func countAsmS32(slice []int32, value int32) int {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return 0
+		return BaseCount_fallback_Int32(slice, value)
 	}
 	var out_result int64
 	asm.Count_S32(
@@ -198,7 +198,7 @@ func countAsmS64(slice []int64, value int64) int {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return 0
+		return BaseCount_fallback_Int64(slice, value)
 	}
 	var out_result int64
 	asm.Count_S64(
@@ -218,7 +218,7 @@ func countAsmU32(slice []uint32, value uint32) int {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return 0
+		return BaseCount_fallback_Uint32(slice, value)
 	}
 	var out_result int64
 	asm.Count_U32(
@@ -238,7 +238,7 @@ func countAsmU64(slice []uint64, value uint64) int {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return 0
+		return BaseCount_fallback_Uint64(slice, value)
 	}
 	var out_result int64
 	asm.Count_U64(
@@ -258,7 +258,7 @@ func findAsmF32(slice []float32, value float32) int {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return 0
+		return BaseFind_fallback(slice, value)
 	}
 	var out_result int64
 	asm.Find_F32(
@@ -278,7 +278,7 @@ func findAsmF64(slice []float64, value float64) int {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return 0
+		return BaseFind_fallback_Float64(slice, value)
 	}
 	var out_result int64
 	asm.Find_F64(
@@ -298,7 +298,7 @@ func findAsmS32(slice []int32, value int32) int {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return 0
+		return BaseFind_fallback_Int32(slice, value)
 	}
 	var out_result int64
 	asm.Find_S32(
@@ -318,7 +318,7 @@ func findAsmS64(slice []int64, value int64) int {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return 0
+		return BaseFind_fallback_Int64(slice, value)
 	}
 	var out_result int64
 	asm.Find_S64(
@@ -338,7 +338,7 @@ func findAsmU32(slice []uint32, value uint32) int {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return 0
+		return BaseFind_fallback_Uint32(slice, value)
 	}
 	var out_result int64
 	asm.Find_U32(
@@ -358,7 +358,7 @@ func findAsmU64(slice []uint64, value uint64) int {
 	valueVal := value
 	lenVal := int64(len(slice))
 	if lenVal == 0 {
-		return 0
+		return BaseFind_fallback_Uint64(slice, value)
 	}
 	var out_result int64
 	asm.Find_U64(
@@ -19,6 +19,22 @@ var Unpack64 func(src []byte, bitWidth int, dst []uint64) int
 
 func init() {
 	initBitpackAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "bitpack",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DeltaEncode32", Vars: []any{&DeltaEncode32}},
+			{Name: "DeltaEncode64", Vars: []any{&DeltaEncode64}},
+			{Name: "Pack32", Vars: []any{&Pack32}},
+			{Name: "Pack64", Vars: []any{&Pack64}},
+			{Name: "Unpack32", Vars: []any{&Unpack32}},
+			{Name: "Unpack64", Vars: []any{&Unpack64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initBitpackAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initBitpackAVX2},
+			{Name: "fallback", Supported: true, Init: initBitpackFallback},
+		},
+	})
 }
 
 func initBitpackAll() {
@@ -17,6 +17,21 @@ var Unpack64 func(src []byte, bitWidth int, dst []uint64) int
 
 func init() {
 	initBitpackAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "bitpack",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DeltaEncode32", Vars: []any{&DeltaEncode32}},
+			{Name: "DeltaEncode64", Vars: []any{&DeltaEncode64}},
+			{Name: "Pack32", Vars: []any{&Pack32}},
+			{Name: "Pack64", Vars: []any{&Pack64}},
+			{Name: "Unpack32", Vars: []any{&Unpack32}},
+			{Name: "Unpack64", Vars: []any{&Unpack64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initBitpackNEONAsm},
+			{Name: "fallback", Supported: true, Init: initBitpackFallback},
+		},
+	})
 }
 
 func initBitpackAll() {
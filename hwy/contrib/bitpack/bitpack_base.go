@@ -130,6 +130,41 @@ func BasePack32(src []uint32, bitWidth int, dst []byte) int {
 	return bytePos
 }
 
+// BasePack32Scalar is the fallback of BasePack32. It shifts each value into
+// a 64-bit bit buffer and flushes whole bytes, instead of splitting every
+// value at byte boundaries.
+//
+//hwy:specializes Pack32
+//hwy:targets fallback
+func BasePack32Scalar(src []uint32, bitWidth int, dst []byte) int {
+	if len(src) == 0 || bitWidth == 0 {
+		return 0
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	mask := ^uint32(0) >> (32 - bitWidth)
+
+	// acc holds at most 7 pending bits before a value is added.
+	var acc uint64
+	var nbits, pos int
+	for _, v := range src {
+		acc |= uint64(v&mask) << nbits
+		nbits += bitWidth
+		for nbits >= 8 {
+			dst[pos] |= byte(acc)
+			acc >>= 8
+			nbits -= 8
+			pos++
+		}
+	}
+	if nbits > 0 {
+		dst[pos] |= byte(acc)
+		pos++
+	}
+	return pos
+}
+
 // packValue32 packs a single value into the byte stream.
 func packValue32(val uint32, bitWidth int, bitPos, bytePos *int, dst []byte) {
 	remaining := bitWidth
@@ -165,6 +200,8 @@ func packValue32(val uint32, bitWidth int, bitPos, bytePos *int, dst []byte) {
 //	packed := []byte{0x5C, 0x3F}  // 4 values at 4 bits each
 //	dst := make([]uint32, 4)
 //	Unpack32(packed, 4, dst)  // Unpacks to [5, 12, 3, 15]
+//
+//hwy:profile elems=len(dst)
 func BaseUnpack32(src []byte, bitWidth int, dst []uint32) int {
 	if len(src) == 0 || bitWidth == 0 || len(dst) == 0 {
 		return 0
@@ -278,6 +315,47 @@ func BasePack64(src []uint64, bitWidth int, dst []byte) int {
 	return bytePos
 }
 
+// BasePack64Scalar is the fallback of BasePack64. A value and the pending
+// bits can exceed 64 bits, so the bit buffer is kept as a lo/hi pair.
+//
+//hwy:specializes Pack64
+//hwy:targets fallback
+func BasePack64Scalar(src []uint64, bitWidth int, dst []byte) int {
+	if len(src) == 0 || bitWidth == 0 {
+		return 0
+	}
+	if bitWidth > 64 {
+		bitWidth = 64
+	}
+	mask := ^uint64(0) >> (64 - bitWidth)
+
+	// acc holds at most 7 pending bits before a value is added.
+	var acc uint64
+	var nbits, pos int
+	for _, v := range src {
+		v &= mask
+		lo := acc | v<<nbits
+		var hi uint64
+		if nbits > 0 {
+			hi = v >> (64 - nbits)
+		}
+		nbits += bitWidth
+		for nbits >= 8 {
+			dst[pos] |= byte(lo)
+			lo = lo>>8 | hi<<56
+			hi >>= 8
+			nbits -= 8
+			pos++
+		}
+		acc = lo
+	}
+	if nbits > 0 {
+		dst[pos] |= byte(acc)
+		pos++
+	}
+	return pos
+}
+
 // packValue64 packs a single uint64 value into the byte stream.
 func packValue64(val uint64, bitWidth int, bitPos, bytePos *int, dst []byte) {
 	remaining := bitWidth
@@ -303,6 +381,8 @@ func packValue64(val uint64, bitWidth int, bitPos, bytePos *int, dst []byte) {
 // BaseUnpack64 unpacks uint64 values from a bit-packed byte slice.
 // Each value is read using exactly bitWidth bits.
 // Returns the number of values unpacked to dst.
+//
+//hwy:profile elems=len(dst)
 func BaseUnpack64(src []byte, bitWidth int, dst []uint64) int {
 	if len(src) == 0 || bitWidth == 0 || len(dst) == 0 {
 		return 0
@@ -415,6 +495,26 @@ func BaseDeltaEncode32(src []uint32, base uint32, dst []uint32) {
 	}
 }
 
+// BaseDeltaEncode32Scalar is the fallback of BaseDeltaEncode32.
+//
+//hwy:specializes DeltaEncode32
+//hwy:targets fallback
+func BaseDeltaEncode32Scalar(src []uint32, base uint32, dst []uint32) {
+	if len(src) == 0 {
+		return
+	}
+	if len(dst) < len(src) {
+		return
+	}
+	dst = dst[:len(src)]
+
+	prev := base
+	for i, v := range src {
+		dst[i] = v - prev
+		prev = v
+	}
+}
+
 // DeltaDecode reconstructs original values from delta-encoded data.
 // This is the inverse of DeltaEncode.
 //
@@ -478,3 +578,22 @@ func BaseDeltaEncode64(src []uint64, base uint64, dst []uint64) {
 	}
 }
 
+// BaseDeltaEncode64Scalar is the fallback of BaseDeltaEncode64.
+//
+//hwy:specializes DeltaEncode64
+//hwy:targets fallback
+func BaseDeltaEncode64Scalar(src []uint64, base uint64, dst []uint64) {
+	if len(src) == 0 {
+		return
+	}
+	if len(dst) < len(src) {
+		return
+	}
+	dst = dst[:len(src)]
+
+	prev := base
+	for i, v := range src {
+		dst[i] = v - prev
+		prev = v
+	}
+}
@@ -2,10 +2,6 @@
 
 package bitpack
 
-import (
-	"github.com/ajroetker/go-highway/hwy"
-)
-
 func BaseDeltaEncode32_fallback(src []uint32, base uint32, dst []uint32) {
 	if len(src) == 0 {
 		return
@@ -13,20 +9,11 @@ func BaseDeltaEncode32_fallback(src []uint32, base uint32, dst []uint32) {
 	if len(dst) < len(src) {
 		return
 	}
-	lanes := hwy.Zero[uint32]().NumLanes()
-	dst[0] = src[0] - base
-	prev := src[0]
-	var i int
-	for i = 1; i+lanes <= len(src); i += lanes {
-		curr := hwy.Load(src[i:])
-		prevVec := hwy.Load(src[i-1:])
-		delta := hwy.Sub(curr, prevVec)
-		hwy.Store(delta, dst[i:])
-		prev = src[i+lanes-1]
-	}
-	for ; i < len(src); i++ {
-		dst[i] = src[i] - prev
-		prev = src[i]
+	dst = dst[:len(src)]
+	prev := base
+	for i, v := range src {
+		dst[i] = v - prev
+		prev = v
 	}
 }
 
@@ -37,20 +24,11 @@ func BaseDeltaEncode64_fallback(src []uint64, base uint64, dst []uint64) {
 	if len(dst) < len(src) {
 		return
 	}
-	lanes := hwy.Zero[uint64]().NumLanes()
-	dst[0] = src[0] - base
-	prev := src[0]
-	var i int
-	for i = 1; i+lanes <= len(src); i += lanes {
-		curr := hwy.Load(src[i:])
-		prevVec := hwy.Load(src[i-1:])
-		delta := hwy.Sub(curr, prevVec)
-		hwy.Store(delta, dst[i:])
-		prev = src[i+lanes-1]
-	}
-	for ; i < len(src); i++ {
-		dst[i] = src[i] - prev
-		prev = src[i]
+	dst = dst[:len(src)]
+	prev := base
+	for i, v := range src {
+		dst[i] = v - prev
+		prev = v
 	}
 }
 
@@ -61,65 +39,24 @@ func BasePack32_fallback(src []uint32, bitWidth int, dst []byte) int {
 	if bitWidth > 32 {
 		bitWidth = 32
 	}
-	lanes := hwy.Zero[uint32]().NumLanes()
-	var mask uint32
-	if bitWidth == 32 {
-		mask = ^uint32(0)
-	} else {
-		mask = uint32((1 << bitWidth) - 1)
-	}
-	maskVec := hwy.Set[uint32](mask)
-	bitPos := 0
-	bytePos := 0
-	var i int
-	for i = 0; i+lanes <= len(src); i += lanes {
-		v := hwy.Load(src[i:])
-		v = hwy.And(v, maskVec)
-		for lane := range lanes {
-			val := hwy.GetLane(v, lane)
-			{
-				remaining_1 := bitWidth
-				for remaining_1 > 0 {
-					bitsAvailable_1 := 8 - *&bitPos
-					bitsToWrite_1 := min(remaining_1, bitsAvailable_1)
-					writeMask_1 := uint32((1 << bitsToWrite_1) - 1)
-					bits_1 := val & writeMask_1
-					val >>= bitsToWrite_1
-					remaining_1 -= bitsToWrite_1
-					dst[*&bytePos] |= byte(bits_1 << *&bitPos)
-					*&bitPos += bitsToWrite_1
-					if *&bitPos >= 8 {
-						*&bitPos = 0
-						*&bytePos++
-					}
-				}
-			}
-		}
-	}
-	for ; i < len(src); i++ {
-		val := src[i] & mask
-		{
-			remaining_2 := bitWidth
-			for remaining_2 > 0 {
-				bitsAvailable_2 := 8 - *&bitPos
-				bitsToWrite_2 := min(remaining_2, bitsAvailable_2)
-				writeMask_2 := uint32((1 << bitsToWrite_2) - 1)
-				bits_2 := val & writeMask_2
-				val >>= bitsToWrite_2
-				remaining_2 -= bitsToWrite_2
-				dst[*&bytePos] |= byte(bits_2 << *&bitPos)
-				*&bitPos += bitsToWrite_2
-				if *&bitPos >= 8 {
-					*&bitPos = 0
-					*&bytePos++
-				}
-			}
+	mask := ^uint32(0) >> (32 - bitWidth)
+	var acc uint64
+	var nbits, pos int
+	for _, v := range src {
+		acc |= uint64(v&mask) << nbits
+		nbits += bitWidth
+		for nbits >= 8 {
+			dst[pos] |= byte(acc)
+			acc >>= 8
+			nbits -= 8
+			pos++
 		}
 	}
-	if bitPos > 0 {
-		return bytePos + 1
+	if nbits > 0 {
+		dst[pos] |= byte(acc)
+		pos++
 	}
-	return bytePos
+	return pos
 }
 
 func BasePack64_fallback(src []uint64, bitWidth int, dst []byte) int {
@@ -129,65 +66,31 @@ func BasePack64_fallback(src []uint64, bitWidth int, dst []byte) int {
 	if bitWidth > 64 {
 		bitWidth = 64
 	}
-	lanes := hwy.Zero[uint64]().NumLanes()
-	var mask uint64
-	if bitWidth == 64 {
-		mask = ^uint64(0)
-	} else {
-		mask = (1 << bitWidth) - 1
-	}
-	maskVec := hwy.Set[uint64](mask)
-	bitPos := 0
-	bytePos := 0
-	var i int
-	for i = 0; i+lanes <= len(src); i += lanes {
-		v := hwy.Load(src[i:])
-		v = hwy.And(v, maskVec)
-		for lane := range lanes {
-			val := hwy.GetLane(v, lane)
-			{
-				remaining_1 := bitWidth
-				for remaining_1 > 0 {
-					bitsAvailable_1 := 8 - *&bitPos
-					bitsToWrite_1 := min(remaining_1, bitsAvailable_1)
-					writeMask_1 := uint64((1 << bitsToWrite_1) - 1)
-					bits_1 := val & writeMask_1
-					val >>= bitsToWrite_1
-					remaining_1 -= bitsToWrite_1
-					dst[*&bytePos] |= byte(bits_1 << *&bitPos)
-					*&bitPos += bitsToWrite_1
-					if *&bitPos >= 8 {
-						*&bitPos = 0
-						*&bytePos++
-					}
-				}
-			}
+	mask := ^uint64(0) >> (64 - bitWidth)
+	var acc uint64
+	var nbits, pos int
+	for _, v := range src {
+		v &= mask
+		lo := acc | v<<nbits
+		var hi uint64
+		if nbits > 0 {
+			hi = v >> (64 - nbits)
 		}
-	}
-	for ; i < len(src); i++ {
-		val := src[i] & mask
-		{
-			remaining_2 := bitWidth
-			for remaining_2 > 0 {
-				bitsAvailable_2 := 8 - *&bitPos
-				bitsToWrite_2 := min(remaining_2, bitsAvailable_2)
-				writeMask_2 := uint64((1 << bitsToWrite_2) - 1)
-				bits_2 := val & writeMask_2
-				val >>= bitsToWrite_2
-				remaining_2 -= bitsToWrite_2
-				dst[*&bytePos] |= byte(bits_2 << *&bitPos)
-				*&bitPos += bitsToWrite_2
-				if *&bitPos >= 8 {
-					*&bitPos = 0
-					*&bytePos++
-				}
-			}
+		nbits += bitWidth
+		for nbits >= 8 {
+			dst[pos] |= byte(lo)
+			lo = lo>>8 | hi<<56
+			hi >>= 8
+			nbits -= 8
+			pos++
 		}
+		acc = lo
 	}
-	if bitPos > 0 {
-		return bytePos + 1
+	if nbits > 0 {
+		dst[pos] |= byte(acc)
+		pos++
 	}
-	return bytePos
+	return pos
 }
 
 func BaseUnpack32_fallback(src []byte, bitWidth int, dst []uint32) int {
@@ -0,0 +1,70 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package bitpack
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("bitpack", "DeltaEncode32", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DeltaEncode32; hwyImpl != nil {
+			DeltaEncode32 = func(src []uint32, base uint32, dst []uint32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, base, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("bitpack", "DeltaEncode64", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DeltaEncode64; hwyImpl != nil {
+			DeltaEncode64 = func(src []uint64, base uint64, dst []uint64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, base, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("bitpack", "Pack32", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Pack32; hwyImpl != nil {
+			Pack32 = func(src []uint32, bitWidth int, dst []byte) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(src, bitWidth, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("bitpack", "Pack64", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Pack64; hwyImpl != nil {
+			Pack64 = func(src []uint64, bitWidth int, dst []byte) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(src, bitWidth, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("bitpack", "Unpack32", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Unpack32; hwyImpl != nil {
+			Unpack32 = func(src []byte, bitWidth int, dst []uint32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(src, bitWidth, dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("bitpack", "Unpack64", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Unpack64; hwyImpl != nil {
+			Unpack64 = func(src []byte, bitWidth int, dst []uint64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(src, bitWidth, dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+				return hwyR0
+			}
+		}
+	})
+}
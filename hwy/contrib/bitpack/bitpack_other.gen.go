@@ -4,6 +4,10 @@
 
 package bitpack
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var DeltaEncode32 func(src []uint32, base uint32, dst []uint32)
 var DeltaEncode64 func(src []uint64, base uint64, dst []uint64)
 var Pack32 func(src []uint32, bitWidth int, dst []byte) int
@@ -13,6 +17,20 @@ var Unpack64 func(src []byte, bitWidth int, dst []uint64) int
 
 func init() {
 	initBitpackAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "bitpack",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DeltaEncode32", Vars: []any{&DeltaEncode32}},
+			{Name: "DeltaEncode64", Vars: []any{&DeltaEncode64}},
+			{Name: "Pack32", Vars: []any{&Pack32}},
+			{Name: "Pack64", Vars: []any{&Pack64}},
+			{Name: "Unpack32", Vars: []any{&Unpack32}},
+			{Name: "Unpack64", Vars: []any{&Unpack64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initBitpackFallback},
+		},
+	})
 }
 
 func initBitpackAll() {
@@ -0,0 +1,164 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package bitpack
+
+// This file implements the SIMD-BP128 block layout used by the FOR and PFOR
+// codecs in pfor.go.
+//
+// A block holds BlockSize (128) uint32 values packed with a single bit width.
+// Values are distributed round-robin over BlockLanes (4) interleaved streams:
+// value i belongs to stream i%4 at row i/4. Each stream packs its 32 values
+// LSB-first into bitWidth uint32 words, and word k of stream s is stored at
+// index k*4+s. A packed block is therefore exactly 4*bitWidth words.
+//
+// Because every stream sees the same shift at every row, unpacking a row is
+// one 4-lane shift/or/and sequence with no cross-lane data movement. The
+// stream count is fixed by the format (not by the host SIMD width) so that
+// encoded data is portable between targets.
+
+const (
+	// BlockSize is the number of values in a SIMD-BP128 block.
+	BlockSize = 128
+
+	// BlockLanes is the number of interleaved 32-bit streams in a block.
+	BlockLanes = 4
+
+	// blockRows is the number of values each stream holds.
+	blockRows = BlockSize / BlockLanes
+)
+
+// BlockPackedWords returns the number of uint32 words a packed block of
+// BlockSize values occupies at the given bit width.
+func BlockPackedWords(bitWidth int) int {
+	return BlockLanes * bitWidth
+}
+
+// maskFor returns the low-bit mask for bitWidth in [0, 32].
+func maskFor(bitWidth int) uint32 {
+	if bitWidth >= 32 {
+		return ^uint32(0)
+	}
+	return uint32(1)<<bitWidth - 1
+}
+
+// unpackBlockRows unpacks rows [r0, r1) of a block packed by PackBlock128
+// into dst[:4*(r1-r0)], adding ref to every value. Row r holds values
+// 4r..4r+3, so this decodes only the vectors covering a range of positions
+// without touching the rest of the block.
+func unpackBlockRows(src []uint32, bitWidth int, ref uint32, r0, r1 int, dst []uint32) {
+	_ = dst[4*(r1-r0)-1]
+	if bitWidth <= 0 {
+		for i := range 4 * (r1 - r0) {
+			dst[i] = ref
+		}
+		return
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	mask := maskFor(bitWidth)
+	words := BlockPackedWords(bitWidth)
+	for r := r0; r < r1; r++ {
+		bit := r * bitWidth
+		k := (bit / 32) * BlockLanes
+		shift := uint(bit % 32)
+		v0 := src[k] >> shift
+		v1 := src[k+1] >> shift
+		v2 := src[k+2] >> shift
+		v3 := src[k+3] >> shift
+		if next := k + BlockLanes; shift > 0 && int(shift)+bitWidth > 32 && next < words {
+			spill := 32 - shift
+			v0 |= src[next] << spill
+			v1 |= src[next+1] << spill
+			v2 |= src[next+2] << spill
+			v3 |= src[next+3] << spill
+		}
+		o := (r - r0) * 4
+		dst[o] = v0&mask + ref
+		dst[o+1] = v1&mask + ref
+		dst[o+2] = v2&mask + ref
+		dst[o+3] = v3&mask + ref
+	}
+}
+
+// packWords packs src into dst horizontally (value i occupies bits
+// [i*bitWidth, (i+1)*bitWidth) of the word stream, LSB-first) and returns
+// the number of words written. Used for partial blocks and exception data,
+// where the vertical layout would waste space.
+func packWords(src []uint32, bitWidth int, dst []uint32) int {
+	if bitWidth <= 0 || len(src) == 0 {
+		return 0
+	}
+	mask := maskFor(bitWidth)
+	words := packedWords(len(src), bitWidth)
+	_ = dst[words-1]
+
+	var acc uint64
+	fill := 0
+	k := 0
+	for _, v := range src {
+		acc |= uint64(v&mask) << fill
+		fill += bitWidth
+		if fill >= 32 {
+			dst[k] = uint32(acc)
+			k++
+			acc >>= 32
+			fill -= 32
+		}
+	}
+	if fill > 0 {
+		dst[k] = uint32(acc)
+		k++
+	}
+	return k
+}
+
+// unpackWords is the inverse of packWords. It unpacks len(dst) values,
+// adding ref to each, and returns the number of words consumed.
+func unpackWords(src []uint32, bitWidth int, ref uint32, dst []uint32) int {
+	if bitWidth <= 0 {
+		for i := range dst {
+			dst[i] = ref
+		}
+		return 0
+	}
+	if len(dst) == 0 {
+		return 0
+	}
+	mask := uint64(maskFor(bitWidth))
+	words := packedWords(len(dst), bitWidth)
+	_ = src[words-1]
+
+	var acc uint64
+	avail := 0
+	k := 0
+	for i := range dst {
+		if avail < bitWidth {
+			acc |= uint64(src[k]) << avail
+			k++
+			avail += 32
+		}
+		dst[i] = uint32(acc&mask) + ref
+		acc >>= bitWidth
+		avail -= bitWidth
+	}
+	return words
+}
+
+// packedWords returns the number of uint32 words needed to hold n values of
+// bitWidth bits packed horizontally.
+func packedWords(n, bitWidth int) int {
+	return (n*bitWidth + 31) / 32
+}
@@ -0,0 +1,66 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package bitpack
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var PackBlock128 func(src []uint32, bitWidth int, dst []uint32) int
+var UnpackBlock128 func(src []uint32, bitWidth int, ref uint32, dst []uint32) int
+var UnpackBlock128Delta func(src []uint32, bitWidth int, ref uint32, prev uint32, dst []uint32) (int, uint32)
+
+func init() {
+	initBlockAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "bitpack",
+		Groups: []hwy.DispatchGroup{
+			{Name: "PackBlock128", Vars: []any{&PackBlock128}},
+			{Name: "UnpackBlock128", Vars: []any{&UnpackBlock128}},
+			{Name: "UnpackBlock128Delta", Vars: []any{&UnpackBlock128Delta}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initBlockAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initBlockAVX2},
+			{Name: "fallback", Supported: true, Init: initBlockFallback},
+		},
+	})
+}
+
+func initBlockAll() {
+	if hwy.NoSimdEnv() {
+		initBlockFallback()
+		return
+	}
+	if archsimd.X86.AVX512() {
+		initBlockAVX512()
+		return
+	}
+	if archsimd.X86.AVX2() {
+		initBlockAVX2()
+		return
+	}
+	initBlockFallback()
+}
+
+func initBlockAVX2() {
+	PackBlock128 = BasePackBlock128_avx2
+	UnpackBlock128 = BaseUnpackBlock128_avx2
+	UnpackBlock128Delta = BaseUnpackBlock128Delta_avx2
+}
+
+func initBlockAVX512() {
+	PackBlock128 = BasePackBlock128_avx512
+	UnpackBlock128 = BaseUnpackBlock128_avx512
+	UnpackBlock128Delta = BaseUnpackBlock128Delta_avx512
+}
+
+func initBlockFallback() {
+	PackBlock128 = BasePackBlock128_fallback
+	UnpackBlock128 = BaseUnpackBlock128_fallback
+	UnpackBlock128Delta = BaseUnpackBlock128Delta_fallback
+}
@@ -0,0 +1,336 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package bitpack
+
+//go:generate go run ../../../cmd/hwygen -input block_base.go -output . -targets avx2,avx512,neon,fallback -dispatch block
+
+import "github.com/ajroetker/go-highway/hwy"
+
+// BasePackBlock128 packs src[:BlockSize] into dst using the vertical SIMD-BP128
+// layout and returns the number of words written (4*bitWidth).
+//
+// Values are masked to bitWidth bits. bitWidth must be in [0, 32];
+// a bit width of zero writes nothing.
+//
+// A row of the block is one 128-bit vector with a lane per stream, so every
+// row costs one load, mask, shift and or, and every output word row one
+// store, on all targets.
+//
+//hwy:elemtype uint32
+//hwy:profile elems=BlockSize bytes=4*BlockSize+4*BlockPackedWords(bitWidth)
+func BasePackBlock128(src []uint32, bitWidth int, dst []uint32) int {
+	if bitWidth <= 0 {
+		return 0
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	_ = src[BlockSize-1]
+	words := BlockPackedWords(bitWidth)
+	_ = dst[words-1]
+	mask := hwy.Set[uint32](maskFor(bitWidth))
+
+	acc := hwy.Zero[uint32]()
+	shift := 0
+	k := 0
+	for r := range blockRows {
+		v := hwy.And(hwy.LoadSlice(src[r*BlockLanes:][:4]), mask)
+		acc = hwy.Or(acc, hwy.ShiftLeft(v, shift))
+		shift += bitWidth
+		if shift >= 32 {
+			hwy.StoreSlice(acc, dst[k:][:4])
+			k += BlockLanes
+			shift -= 32
+			// Carry the high bits of values that straddled the word boundary.
+			// shift is 0 when the value ended exactly on the boundary.
+			acc = hwy.Zero[uint32]()
+			if shift > 0 {
+				acc = hwy.ShiftRight(v, bitWidth-shift)
+			}
+		}
+	}
+	return words
+}
+
+// BaseUnpackBlock128 unpacks BlockSize values from src (packed by
+// PackBlock128) into dst[:BlockSize], adding ref to every value (frame of
+// reference). Returns the number of words consumed (4*bitWidth).
+//
+// Pass ref = 0 for plain unpacking. A bit width of zero fills dst with ref.
+//
+//hwy:elemtype uint32
+//hwy:profile elems=BlockSize bytes=4*BlockSize+4*BlockPackedWords(bitWidth)
+func BaseUnpackBlock128(src []uint32, bitWidth int, ref uint32, dst []uint32) int {
+	_ = dst[BlockSize-1]
+	if bitWidth <= 0 {
+		for i := range BlockSize {
+			dst[i] = ref
+		}
+		return 0
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	words := BlockPackedWords(bitWidth)
+	_ = src[words-1]
+	mask := hwy.Set[uint32](maskFor(bitWidth))
+	refs := hwy.Set[uint32](ref)
+
+	w := hwy.LoadSlice(src[:4])
+	shift := 0
+	k := 0
+	for r := range blockRows {
+		v := hwy.ShiftRight(w, shift)
+		shift += bitWidth
+		if shift >= 32 {
+			k += BlockLanes
+			shift -= 32
+			if k < words {
+				w = hwy.LoadSlice(src[k:][:4])
+				if shift > 0 {
+					v = hwy.Or(v, hwy.ShiftLeft(w, bitWidth-shift))
+				}
+			}
+		}
+		hwy.StoreSlice(hwy.Add(hwy.And(v, mask), refs), dst[r*BlockLanes:][:4])
+	}
+	return words
+}
+
+// BaseUnpackBlock128Delta unpacks a block of deltas and reconstructs the
+// original values in the same pass (fused delta decode):
+//
+//	dst[0] = prev + (src[0] + ref)
+//	dst[i] = dst[i-1] + (src[i] + ref)
+//
+// ref is the frame-of-reference added to every delta before accumulation,
+// and prev is the last value of the preceding block (or the list base).
+// Returns the number of words consumed and the last decoded value, which is
+// the prev for the next block.
+//
+// Rows are unpacked as in BaseUnpackBlock128; the four lanes of a row are
+// consecutive values, so the running sum over the stored row is the only
+// serial step.
+//
+//hwy:elemtype uint32
+//hwy:profile elems=BlockSize bytes=4*BlockSize+4*BlockPackedWords(bitWidth)
+func BaseUnpackBlock128Delta(src []uint32, bitWidth int, ref, prev uint32, dst []uint32) (int, uint32) {
+	_ = dst[BlockSize-1]
+	if bitWidth <= 0 {
+		for i := range BlockSize {
+			prev += ref
+			dst[i] = prev
+		}
+		return 0, prev
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	words := BlockPackedWords(bitWidth)
+	_ = src[words-1]
+	mask := hwy.Set[uint32](maskFor(bitWidth))
+	refs := hwy.Set[uint32](ref)
+
+	w := hwy.LoadSlice(src[:4])
+	shift := 0
+	k := 0
+	for r := range blockRows {
+		v := hwy.ShiftRight(w, shift)
+		shift += bitWidth
+		if shift >= 32 {
+			k += BlockLanes
+			shift -= 32
+			if k < words {
+				w = hwy.LoadSlice(src[k:][:4])
+				if shift > 0 {
+					v = hwy.Or(v, hwy.ShiftLeft(w, bitWidth-shift))
+				}
+			}
+		}
+		row := dst[r*BlockLanes:][:4]
+		hwy.StoreSlice(hwy.Add(hwy.And(v, mask), refs), row)
+		row[0] += prev
+		row[1] += row[0]
+		row[2] += row[1]
+		row[3] += row[2]
+		prev = row[3]
+	}
+	return words, prev
+}
+
+// BasePackBlock128Scalar is the fallback of BasePackBlock128. It keeps one
+// scalar accumulator per stream.
+//
+//hwy:specializes PackBlock128
+//hwy:targets fallback
+func BasePackBlock128Scalar(src []uint32, bitWidth int, dst []uint32) int {
+	if bitWidth <= 0 {
+		return 0
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	_ = src[BlockSize-1]
+	words := BlockPackedWords(bitWidth)
+	_ = dst[words-1]
+	mask := maskFor(bitWidth)
+
+	var acc0, acc1, acc2, acc3 uint32
+	shift := 0
+	k := 0
+	for r := range blockRows {
+		v0 := src[r*4] & mask
+		v1 := src[r*4+1] & mask
+		v2 := src[r*4+2] & mask
+		v3 := src[r*4+3] & mask
+
+		acc0 |= v0 << shift
+		acc1 |= v1 << shift
+		acc2 |= v2 << shift
+		acc3 |= v3 << shift
+
+		shift += bitWidth
+		if shift >= 32 {
+			dst[k] = acc0
+			dst[k+1] = acc1
+			dst[k+2] = acc2
+			dst[k+3] = acc3
+			k += BlockLanes
+			shift -= 32
+			// Carry the high bits of values that straddled the word boundary.
+			// When shift is 0 the value ended exactly on the boundary and the
+			// shift count is 32, which yields 0 for uint32 in Go.
+			spill := uint(bitWidth - shift)
+			acc0 = v0 >> spill
+			acc1 = v1 >> spill
+			acc2 = v2 >> spill
+			acc3 = v3 >> spill
+		}
+	}
+	return words
+}
+
+// BaseUnpackBlock128Scalar is the fallback of BaseUnpackBlock128. It keeps
+// one scalar word per stream.
+//
+//hwy:specializes UnpackBlock128
+//hwy:targets fallback
+func BaseUnpackBlock128Scalar(src []uint32, bitWidth int, ref uint32, dst []uint32) int {
+	_ = dst[BlockSize-1]
+	if bitWidth <= 0 {
+		for i := range BlockSize {
+			dst[i] = ref
+		}
+		return 0
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	words := BlockPackedWords(bitWidth)
+	_ = src[words-1]
+	mask := maskFor(bitWidth)
+
+	w0, w1, w2, w3 := src[0], src[1], src[2], src[3]
+	shift := 0
+	k := 0
+	for r := range blockRows {
+		v0 := w0 >> shift
+		v1 := w1 >> shift
+		v2 := w2 >> shift
+		v3 := w3 >> shift
+
+		shift += bitWidth
+		if shift >= 32 {
+			k += BlockLanes
+			shift -= 32
+			if k < words {
+				w0, w1, w2, w3 = src[k], src[k+1], src[k+2], src[k+3]
+				if shift > 0 {
+					spill := uint(bitWidth - shift)
+					v0 |= w0 << spill
+					v1 |= w1 << spill
+					v2 |= w2 << spill
+					v3 |= w3 << spill
+				}
+			}
+		}
+
+		dst[r*4] = v0&mask + ref
+		dst[r*4+1] = v1&mask + ref
+		dst[r*4+2] = v2&mask + ref
+		dst[r*4+3] = v3&mask + ref
+	}
+	return words
+}
+
+// BaseUnpackBlock128DeltaScalar is the fallback of BaseUnpackBlock128Delta.
+// It keeps one scalar word per stream.
+//
+//hwy:specializes UnpackBlock128Delta
+//hwy:targets fallback
+func BaseUnpackBlock128DeltaScalar(src []uint32, bitWidth int, ref, prev uint32, dst []uint32) (int, uint32) {
+	_ = dst[BlockSize-1]
+	if bitWidth <= 0 {
+		for i := range BlockSize {
+			prev += ref
+			dst[i] = prev
+		}
+		return 0, prev
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	words := BlockPackedWords(bitWidth)
+	_ = src[words-1]
+	mask := maskFor(bitWidth)
+
+	w0, w1, w2, w3 := src[0], src[1], src[2], src[3]
+	shift := 0
+	k := 0
+	for r := range blockRows {
+		v0 := w0 >> shift
+		v1 := w1 >> shift
+		v2 := w2 >> shift
+		v3 := w3 >> shift
+
+		shift += bitWidth
+		if shift >= 32 {
+			k += BlockLanes
+			shift -= 32
+			if k < words {
+				w0, w1, w2, w3 = src[k], src[k+1], src[k+2], src[k+3]
+				if shift > 0 {
+					spill := uint(bitWidth - shift)
+					v0 |= w0 << spill
+					v1 |= w1 << spill
+					v2 |= w2 << spill
+					v3 |= w3 << spill
+				}
+			}
+		}
+
+		// Row-local prefix sum: the four lanes are consecutive values.
+		d0 := prev + v0&mask + ref
+		d1 := d0 + v1&mask + ref
+		d2 := d1 + v2&mask + ref
+		d3 := d2 + v3&mask + ref
+		dst[r*4] = d0
+		dst[r*4+1] = d1
+		dst[r*4+2] = d2
+		dst[r*4+3] = d3
+		prev = d3
+	}
+	return words, prev
+}
@@ -0,0 +1,119 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package bitpack
+
+import (
+	"simd/archsimd"
+)
+
+func BasePackBlock128_avx2(src []uint32, bitWidth int, dst []uint32) int {
+	if bitWidth <= 0 {
+		return 0
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	_ = src[BlockSize-1]
+	words := BlockPackedWords(bitWidth)
+	_ = dst[words-1]
+	mask := archsimd.BroadcastUint32x4(maskFor(bitWidth))
+	acc := archsimd.BroadcastUint32x4(0)
+	shift := 0
+	k := 0
+	for r := range blockRows {
+		v := archsimd.LoadUint32x4Slice(src[r*BlockLanes:][:4]).And(mask)
+		acc = acc.Or(v.ShiftAllLeft(uint64(shift)))
+		shift += bitWidth
+		if shift >= 32 {
+			acc.StoreSlice(dst[k:][:4])
+			k += BlockLanes
+			shift -= 32
+			acc = archsimd.BroadcastUint32x4(0)
+			if shift > 0 {
+				acc = v.ShiftAllRight(uint64(bitWidth - shift))
+			}
+		}
+	}
+	return words
+}
+
+func BaseUnpackBlock128_avx2(src []uint32, bitWidth int, ref uint32, dst []uint32) int {
+	_ = dst[BlockSize-1]
+	if bitWidth <= 0 {
+		for i := range BlockSize {
+			dst[i] = ref
+		}
+		return 0
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	words := BlockPackedWords(bitWidth)
+	_ = src[words-1]
+	mask := archsimd.BroadcastUint32x4(maskFor(bitWidth))
+	refs := archsimd.BroadcastUint32x4(ref)
+	w := archsimd.LoadUint32x4Slice(src[:4])
+	shift := 0
+	k := 0
+	for r := range blockRows {
+		v := w.ShiftAllRight(uint64(shift))
+		shift += bitWidth
+		if shift >= 32 {
+			k += BlockLanes
+			shift -= 32
+			if k < words {
+				w = archsimd.LoadUint32x4Slice(src[k:][:4])
+				if shift > 0 {
+					v = v.Or(w.ShiftAllLeft(uint64(bitWidth - shift)))
+				}
+			}
+		}
+		v.And(mask).Add(refs).StoreSlice(dst[r*BlockLanes:][:4])
+	}
+	return words
+}
+
+func BaseUnpackBlock128Delta_avx2(src []uint32, bitWidth int, ref uint32, prev uint32, dst []uint32) (int, uint32) {
+	_ = dst[BlockSize-1]
+	if bitWidth <= 0 {
+		for i := range BlockSize {
+			prev += ref
+			dst[i] = prev
+		}
+		return 0, prev
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	words := BlockPackedWords(bitWidth)
+	_ = src[words-1]
+	mask := archsimd.BroadcastUint32x4(maskFor(bitWidth))
+	refs := archsimd.BroadcastUint32x4(ref)
+	w := archsimd.LoadUint32x4Slice(src[:4])
+	shift := 0
+	k := 0
+	for r := range blockRows {
+		v := w.ShiftAllRight(uint64(shift))
+		shift += bitWidth
+		if shift >= 32 {
+			k += BlockLanes
+			shift -= 32
+			if k < words {
+				w = archsimd.LoadUint32x4Slice(src[k:][:4])
+				if shift > 0 {
+					v = v.Or(w.ShiftAllLeft(uint64(bitWidth - shift)))
+				}
+			}
+		}
+		row := dst[r*BlockLanes:][:4]
+		v.And(mask).Add(refs).StoreSlice(row)
+		row[0] += prev
+		row[1] += row[0]
+		row[2] += row[1]
+		row[3] += row[2]
+		prev = row[3]
+	}
+	return words, prev
+}
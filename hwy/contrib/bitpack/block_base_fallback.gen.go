@@ -0,0 +1,140 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package bitpack
+
+func BasePackBlock128_fallback(src []uint32, bitWidth int, dst []uint32) int {
+	if bitWidth <= 0 {
+		return 0
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	_ = src[BlockSize-1]
+	words := BlockPackedWords(bitWidth)
+	_ = dst[words-1]
+	mask := maskFor(bitWidth)
+	var acc0, acc1, acc2, acc3 uint32
+	shift := 0
+	k := 0
+	for r := range blockRows {
+		v0 := src[r*4] & mask
+		v1 := src[r*4+1] & mask
+		v2 := src[r*4+2] & mask
+		v3 := src[r*4+3] & mask
+		acc0 |= v0 << shift
+		acc1 |= v1 << shift
+		acc2 |= v2 << shift
+		acc3 |= v3 << shift
+		shift += bitWidth
+		if shift >= 32 {
+			dst[k] = acc0
+			dst[k+1] = acc1
+			dst[k+2] = acc2
+			dst[k+3] = acc3
+			k += BlockLanes
+			shift -= 32
+			spill := uint(bitWidth - shift)
+			acc0 = v0 >> spill
+			acc1 = v1 >> spill
+			acc2 = v2 >> spill
+			acc3 = v3 >> spill
+		}
+	}
+	return words
+}
+
+func BaseUnpackBlock128_fallback(src []uint32, bitWidth int, ref uint32, dst []uint32) int {
+	_ = dst[BlockSize-1]
+	if bitWidth <= 0 {
+		for i := range BlockSize {
+			dst[i] = ref
+		}
+		return 0
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	words := BlockPackedWords(bitWidth)
+	_ = src[words-1]
+	mask := maskFor(bitWidth)
+	w0, w1, w2, w3 := src[0], src[1], src[2], src[3]
+	shift := 0
+	k := 0
+	for r := range blockRows {
+		v0 := w0 >> shift
+		v1 := w1 >> shift
+		v2 := w2 >> shift
+		v3 := w3 >> shift
+		shift += bitWidth
+		if shift >= 32 {
+			k += BlockLanes
+			shift -= 32
+			if k < words {
+				w0, w1, w2, w3 = src[k], src[k+1], src[k+2], src[k+3]
+				if shift > 0 {
+					spill := uint(bitWidth - shift)
+					v0 |= w0 << spill
+					v1 |= w1 << spill
+					v2 |= w2 << spill
+					v3 |= w3 << spill
+				}
+			}
+		}
+		dst[r*4] = v0&mask + ref
+		dst[r*4+1] = v1&mask + ref
+		dst[r*4+2] = v2&mask + ref
+		dst[r*4+3] = v3&mask + ref
+	}
+	return words
+}
+
+func BaseUnpackBlock128Delta_fallback(src []uint32, bitWidth int, ref uint32, prev uint32, dst []uint32) (int, uint32) {
+	_ = dst[BlockSize-1]
+	if bitWidth <= 0 {
+		for i := range BlockSize {
+			prev += ref
+			dst[i] = prev
+		}
+		return 0, prev
+	}
+	if bitWidth > 32 {
+		bitWidth = 32
+	}
+	words := BlockPackedWords(bitWidth)
+	_ = src[words-1]
+	mask := maskFor(bitWidth)
+	w0, w1, w2, w3 := src[0], src[1], src[2], src[3]
+	shift := 0
+	k := 0
+	for r := range blockRows {
+		v0 := w0 >> shift
+		v1 := w1 >> shift
+		v2 := w2 >> shift
+		v3 := w3 >> shift
+		shift += bitWidth
+		if shift >= 32 {
+			k += BlockLanes
+			shift -= 32
+			if k < words {
+				w0, w1, w2, w3 = src[k], src[k+1], src[k+2], src[k+3]
+				if shift > 0 {
+					spill := uint(bitWidth - shift)
+					v0 |= w0 << spill
+					v1 |= w1 << spill
+					v2 |= w2 << spill
+					v3 |= w3 << spill
+				}
+			}
+		}
+		d0 := prev + v0&mask + ref
+		d1 := d0 + v1&mask + ref
+		d2 := d1 + v2&mask + ref
+		d3 := d2 + v3&mask + ref
+		dst[r*4] = d0
+		dst[r*4+1] = d1
+		dst[r*4+2] = d2
+		dst[r*4+3] = d3
+		prev = d3
+	}
+	return words, prev
+}
@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package bitpack
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("bitpack", "PackBlock128", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PackBlock128; hwyImpl != nil {
+			PackBlock128 = func(src []uint32, bitWidth int, dst []uint32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(src, bitWidth, dst)
+				hwyCounter.Done(hwyStart, BlockSize, 4*BlockSize+4*BlockPackedWords(bitWidth))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("bitpack", "UnpackBlock128", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := UnpackBlock128; hwyImpl != nil {
+			UnpackBlock128 = func(src []uint32, bitWidth int, ref uint32, dst []uint32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(src, bitWidth, ref, dst)
+				hwyCounter.Done(hwyStart, BlockSize, 4*BlockSize+4*BlockPackedWords(bitWidth))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("bitpack", "UnpackBlock128Delta", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := UnpackBlock128Delta; hwyImpl != nil {
+			UnpackBlock128Delta = func(src []uint32, bitWidth int, ref uint32, prev uint32, dst []uint32) (int, uint32) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(src, bitWidth, ref, prev, dst)
+				hwyCounter.Done(hwyStart, BlockSize, 4*BlockSize+4*BlockPackedWords(bitWidth))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+}
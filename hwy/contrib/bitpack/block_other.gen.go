@@ -0,0 +1,38 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build !arm64 && !(amd64 && goexperiment.simd)
+
+package bitpack
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var PackBlock128 func(src []uint32, bitWidth int, dst []uint32) int
+var UnpackBlock128 func(src []uint32, bitWidth int, ref uint32, dst []uint32) int
+var UnpackBlock128Delta func(src []uint32, bitWidth int, ref uint32, prev uint32, dst []uint32) (int, uint32)
+
+func init() {
+	initBlockAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "bitpack",
+		Groups: []hwy.DispatchGroup{
+			{Name: "PackBlock128", Vars: []any{&PackBlock128}},
+			{Name: "UnpackBlock128", Vars: []any{&UnpackBlock128}},
+			{Name: "UnpackBlock128Delta", Vars: []any{&UnpackBlock128Delta}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initBlockFallback},
+		},
+	})
+}
+
+func initBlockAll() {
+	initBlockFallback()
+}
+
+func initBlockFallback() {
+	PackBlock128 = BasePackBlock128_fallback
+	UnpackBlock128 = BaseUnpackBlock128_fallback
+	UnpackBlock128Delta = BaseUnpackBlock128Delta_fallback
+}
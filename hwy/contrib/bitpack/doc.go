@@ -43,6 +43,44 @@
 //   3. Use SIMD OR operations to combine multiple packed values
 //   4. Handle cross-word boundaries with appropriate masking
 //
+// # Block Codecs (FOR / PFOR)
+//
+// For posting lists and other long integer sequences the package provides
+// block codecs over the SIMD-BP128 layout: 128 values per block, spread over
+// 4 interleaved 32-bit streams so each row unpacks with one shift/mask
+// sequence and no cross-lane shuffles.
+//   - PackBlock128 / UnpackBlock128 - Vertical pack/unpack of a single block
+//   - UnpackBlock128Delta - Unpack fused with the prefix sum of a delta block
+//   - EncodeFOR / DecodeFOR - Frame of reference: each block stores its
+//     minimum and packs value-min at the block's bit width
+//   - EncodePFOR / DecodePFOR - Patched FOR: each block picks the bit width
+//     that minimizes its size and stores outliers as patched exceptions
+//   - EncodeDeltaFOR / EncodeDeltaPFOR / DecodeDelta - Sorted lists, encoded
+//     as gaps and decoded back to absolute values in a single pass
+//
+//	docs := []uint32{3, 9, 10, 14, 200, 201, 205}
+//	enc := bitpack.EncodeDeltaPFOR(docs, 0, nil)
+//	out := make([]uint32, bitpack.DecodedLen(enc))
+//	bitpack.DecodeDelta(enc, 0, out)
+//
+// # Random Access and Skipping
+//
+// BlockList pairs an encoded stream with a BlockDirectory (per-block offset,
+// min and max) built while packing:
+//   - Select(i) - Decode one value, unpacking only the vector that holds it
+//   - UnpackRange(start, end, dst) - Decode a slice of the list
+//   - Cursor().NextGEQ(target) - Skip to the first value >= target by
+//     searching the directory, then the single decoded block
+//   - NextGEQ(sorted, target) - SIMD search of a decoded sorted block
+//
+//	list := bitpack.NewDeltaBlockList(docs, 0, true)
+//	c := list.Cursor()
+//	for _, doc := range shortList {
+//		if v, ok := c.NextGEQ(doc); ok && v == doc {
+//			// doc is in both lists
+//		}
+//	}
+//
 // # Example Usage
 //
 //	import "github.com/ajroetker/go-highway/hwy/contrib/bitpack"
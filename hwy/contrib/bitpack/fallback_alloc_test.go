@@ -0,0 +1,66 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package bitpack
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		u32       = make([]uint32, allocTestLen)
+		u64       = make([]uint64, allocTestLen)
+		u8        = make([]uint8, allocTestLen)
+		u32Scalar = uint32(1)
+		u64Scalar = uint64(1)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseDeltaEncode32_fallback", func() { BaseDeltaEncode32_fallback(u32, u32Scalar, u32) }},
+		{"BaseDeltaEncode64_fallback", func() { BaseDeltaEncode64_fallback(u64, u64Scalar, u64) }},
+		{"BasePack32_fallback", func() { BasePack32_fallback(u32[:allocTestDim], allocTestDim, u8) }},
+		{"BasePack64_fallback", func() { BasePack64_fallback(u64[:allocTestDim], allocTestDim, u8) }},
+		{"BaseUnpack32_fallback", func() { BaseUnpack32_fallback(u8, allocTestDim, u32) }},
+		{"BaseUnpack64_fallback", func() { BaseUnpack64_fallback(u8, allocTestDim, u64) }},
+		{"BaseNextGEQ_fallback", func() { BaseNextGEQ_fallback(u32, u32Scalar) }},
+		{"BasePackBlock128_fallback", func() { BasePackBlock128_fallback(u32[:BlockSize], 7, u32) }},
+		{"BaseUnpackBlock128_fallback", func() { BaseUnpackBlock128_fallback(u32, 7, u32Scalar, u32[:BlockSize]) }},
+		{"BaseUnpackBlock128Delta_fallback", func() { BaseUnpackBlock128Delta_fallback(u32, 7, u32Scalar, u32Scalar, u32[:BlockSize]) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
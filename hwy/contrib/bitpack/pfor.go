@@ -0,0 +1,340 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package bitpack
+
+import (
+	"math/bits"
+	"slices"
+)
+
+// Frame-of-reference (FOR) and patched frame-of-reference (PFOR) codecs over
+// SIMD-BP128 blocks.
+//
+// Stream layout (all uint32 words):
+//
+//	word 0            number of encoded values n
+//	per block         header, ref, payload
+//
+// The header word is bitWidth | exceptions<<8 | exceptionBits<<16 and ref is
+// the block minimum (frame of reference). Full blocks carry a vertical
+// SIMD-BP128 payload of 4*bitWidth words; the final partial block (fewer than
+// BlockSize values) is packed horizontally so short lists stay compact.
+//
+// PFOR blocks may choose a bit width below the block maximum. Values that do
+// not fit ("exceptions") store their low bitWidth bits in the packed payload,
+// followed by their in-block positions (one byte each, four per word) and
+// their high bits packed at exceptionBits per value. Decoding unpacks the
+// block and then patches the exceptions. FOR blocks never have exceptions,
+// so both codecs share a single decoder.
+
+const (
+	headerWidthMask = 0xFF
+	headerExcShift  = 8
+	headerExcBits   = 16
+)
+
+// EncodeFOR appends the FOR encoding of src to dst and returns the extended
+// slice. Each block is packed at the bit width of its largest value minus
+// the block minimum.
+func EncodeFOR(src, dst []uint32) []uint32 {
+	return encodeBlocks(src, dst, false, nil)
+}
+
+// EncodePFOR appends the PFOR encoding of src to dst and returns the
+// extended slice. For every block the bit width is chosen to minimize the
+// encoded size, storing outliers as patched exceptions instead of widening
+// the whole block.
+func EncodePFOR(src, dst []uint32) []uint32 {
+	return encodeBlocks(src, dst, true, nil)
+}
+
+// EncodeDeltaFOR delta-encodes the sorted values in src relative to base
+// (see DeltaEncode32) and appends their FOR encoding to dst.
+func EncodeDeltaFOR(src []uint32, base uint32, dst []uint32) []uint32 {
+	return encodeDeltaBlocks(src, base, dst, false, nil)
+}
+
+// EncodeDeltaPFOR delta-encodes the sorted values in src relative to base
+// and appends their PFOR encoding to dst.
+func EncodeDeltaPFOR(src []uint32, base uint32, dst []uint32) []uint32 {
+	return encodeDeltaBlocks(src, base, dst, true, nil)
+}
+
+// DecodedLen returns the number of values stored in an encoded stream.
+func DecodedLen(src []uint32) int {
+	if len(src) == 0 {
+		return 0
+	}
+	return int(src[0])
+}
+
+// DecodeFOR decodes a stream produced by EncodeFOR or EncodePFOR into dst and
+// returns the number of values written. dst must hold at least
+// DecodedLen(src) values.
+func DecodeFOR(src, dst []uint32) int {
+	return decodeBlocks(src, dst, false, 0)
+}
+
+// DecodePFOR decodes a stream produced by EncodePFOR or EncodeFOR into dst
+// and returns the number of values written. It is identical to DecodeFOR;
+// FOR streams are PFOR streams without exceptions.
+func DecodePFOR(src, dst []uint32) int {
+	return decodeBlocks(src, dst, false, 0)
+}
+
+// DecodeDelta decodes a stream produced by EncodeDeltaFOR or EncodeDeltaPFOR
+// and reconstructs the original sorted values starting from base. Blocks
+// without exceptions are unpacked and prefix-summed in a single pass.
+// Returns the number of values written.
+func DecodeDelta(src []uint32, base uint32, dst []uint32) int {
+	return decodeBlocks(src, dst, true, base)
+}
+
+// encodeBlocks encodes src as a FOR/PFOR stream appended to dst. If dir is
+// non-nil it receives one directory entry per block.
+func encodeBlocks(src, dst []uint32, patched bool, dir *BlockDirectory) []uint32 {
+	n := len(src)
+	start := len(dst)
+	dst = append(dst, uint32(n))
+	for i := 0; i < n; i += BlockSize {
+		block := src[i:min(i+BlockSize, n)]
+		if dir != nil {
+			lo, hi := blockRange(block)
+			dir.add(len(dst)-start, lo, hi)
+		}
+		dst = appendBlock(dst, block, patched)
+	}
+	return dst
+}
+
+// encodeDeltaBlocks delta-encodes the sorted values in src and appends their
+// FOR/PFOR stream to dst. Directory entries record each block's first and
+// last value.
+func encodeDeltaBlocks(src []uint32, base uint32, dst []uint32, patched bool, dir *BlockDirectory) []uint32 {
+	n := len(src)
+	start := len(dst)
+	dst = append(dst, uint32(n))
+	var deltas [BlockSize]uint32
+	prev := base
+	for i := 0; i < n; i += BlockSize {
+		block := src[i:min(i+BlockSize, n)]
+		if dir != nil {
+			dir.add(len(dst)-start, block[0], block[len(block)-1])
+		}
+		DeltaEncode32(block, prev, deltas[:len(block)])
+		prev = block[len(block)-1]
+		dst = appendBlock(dst, deltas[:len(block)], patched)
+	}
+	return dst
+}
+
+// appendBlock encodes one full or partial block.
+func appendBlock(dst, block []uint32, patched bool) []uint32 {
+	ref, maxVal := blockRange(block)
+	maxWidth := bits.Len32(maxVal - ref)
+
+	width := maxWidth
+	var exceptions [BlockSize]uint8
+	numExc := 0
+	if patched && maxWidth > 0 {
+		width = chooseWidth(block, ref, maxWidth)
+		if width < maxWidth {
+			limit := uint32(1) << width
+			for i, v := range block {
+				if v-ref >= limit {
+					exceptions[numExc] = uint8(i)
+					numExc++
+				}
+			}
+		}
+	}
+	excBits := 0
+	if numExc > 0 {
+		excBits = maxWidth - width
+	}
+
+	header := uint32(width) | uint32(numExc)<<headerExcShift | uint32(excBits)<<headerExcBits
+	dst = append(dst, header, ref)
+
+	// Subtract the frame of reference into a scratch block.
+	var scratch [BlockSize]uint32
+	vals := scratch[:len(block)]
+	for i, v := range block {
+		vals[i] = v - ref
+	}
+
+	if len(block) == BlockSize {
+		dst = growWords(dst, BlockPackedWords(width))
+		PackBlock128(vals, width, dst[len(dst)-BlockPackedWords(width):])
+	} else {
+		words := packedWords(len(vals), width)
+		dst = growWords(dst, words)
+		packWords(vals, width, dst[len(dst)-words:])
+	}
+
+	if numExc > 0 {
+		// Positions, four per word.
+		posWords := (numExc + 3) / 4
+		dst = growWords(dst, posWords)
+		pos := dst[len(dst)-posWords:]
+		for j := range numExc {
+			pos[j/4] |= uint32(exceptions[j]) << (8 * (j % 4))
+		}
+
+		var high [BlockSize]uint32
+		for j := range numExc {
+			high[j] = vals[exceptions[j]] >> width
+		}
+		words := packedWords(numExc, excBits)
+		dst = growWords(dst, words)
+		packWords(high[:numExc], excBits, dst[len(dst)-words:])
+	}
+	return dst
+}
+
+// blockRange returns the minimum and maximum of a non-empty block.
+func blockRange(block []uint32) (lo, hi uint32) {
+	lo, hi = block[0], block[0]
+	for _, v := range block[1:] {
+		lo = min(lo, v)
+		hi = max(hi, v)
+	}
+	return lo, hi
+}
+
+// chooseWidth returns the bit width minimizing the encoded size of a PFOR
+// block, counting every exception as a one-byte position plus its high bits.
+func chooseWidth(block []uint32, ref uint32, maxWidth int) int {
+	var freq [33]int
+	for _, v := range block {
+		freq[bits.Len32(v-ref)]++
+	}
+	n := len(block)
+	best := maxWidth
+	bestCost := n * maxWidth
+	numExc := 0
+	for w := maxWidth - 1; w >= 0; w-- {
+		numExc += freq[w+1]
+		cost := n*w + numExc*(8+maxWidth-w)
+		if cost < bestCost {
+			best, bestCost = w, cost
+		}
+	}
+	return best
+}
+
+// growWords extends dst by n zeroed words.
+func growWords(dst []uint32, n int) []uint32 {
+	l := len(dst)
+	dst = slices.Grow(dst, n)[:l+n]
+	clear(dst[l:])
+	return dst
+}
+
+// decodeBlocks decodes a FOR/PFOR stream. When delta is set, the decoded
+// values are prefix-summed starting from base.
+func decodeBlocks(src, dst []uint32, delta bool, base uint32) int {
+	n := DecodedLen(src)
+	if n == 0 {
+		return 0
+	}
+	_ = dst[n-1]
+	pos := 1
+	prev := base
+	for i := 0; i < n; i += BlockSize {
+		out := dst[i:min(i+BlockSize, n)]
+		pos, prev = decodeBlock(src, pos, out, delta, prev)
+	}
+	return n
+}
+
+// blockHeader is the decoded header of one block.
+type blockHeader struct {
+	width   int
+	numExc  int
+	excBits int
+	ref     uint32
+}
+
+// readHeader parses the block header at src[pos] and returns it along with
+// the position of the block payload.
+func readHeader(src []uint32, pos int) (blockHeader, int) {
+	header := src[pos]
+	return blockHeader{
+		width:   int(header & headerWidthMask),
+		numExc:  int(header>>headerExcShift) & 0xFF,
+		excBits: int(header>>headerExcBits) & 0xFF,
+		ref:     src[pos+1],
+	}, pos + 2
+}
+
+// payloadWords returns the size of the packed payload of a block holding n
+// values.
+func (h blockHeader) payloadWords(n int) int {
+	if n == BlockSize {
+		return BlockPackedWords(h.width)
+	}
+	return packedWords(n, h.width)
+}
+
+// patchExceptions adds the high bits of the exceptions stored at src[pos]
+// to the values of out whose in-block index lies in [lo, hi). out is indexed
+// by in-block position. Returns the position after the exception data.
+func (h blockHeader) patchExceptions(src []uint32, pos int, out []uint32, lo, hi int) int {
+	posWords := (h.numExc + 3) / 4
+	positions := src[pos : pos+posWords]
+	pos += posWords
+	var high [BlockSize]uint32
+	pos += unpackWords(src[pos:], h.excBits, 0, high[:h.numExc])
+	for j := range h.numExc {
+		idx := int(uint8(positions[j/4] >> (8 * (j % 4))))
+		if idx >= lo && idx < hi {
+			out[idx] += high[j] << h.width
+		}
+	}
+	return pos
+}
+
+// decodeBlock decodes the block starting at src[pos] into out and returns
+// the position of the next block and the running delta base.
+func decodeBlock(src []uint32, pos int, out []uint32, delta bool, prev uint32) (int, uint32) {
+	h, pos := readHeader(src, pos)
+
+	full := len(out) == BlockSize
+	if full && h.numExc == 0 && delta {
+		words, last := UnpackBlock128Delta(src[pos:], h.width, h.ref, prev, out)
+		return pos + words, last
+	}
+
+	if full {
+		pos += UnpackBlock128(src[pos:], h.width, h.ref, out)
+	} else {
+		pos += unpackWords(src[pos:], h.width, h.ref, out)
+	}
+
+	if h.numExc > 0 {
+		pos = h.patchExceptions(src, pos, out, 0, len(out))
+	}
+
+	if delta {
+		// Patched and partial blocks take a separate prefix-sum pass; the
+		// chain is short enough that a scalar loop beats a dispatched call.
+		for i, d := range out {
+			prev += d
+			out[i] = prev
+		}
+	}
+	return pos, prev
+}
@@ -0,0 +1,371 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package bitpack
+
+import (
+	"fmt"
+	"math"
+	"math/rand"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/algo"
+	"github.com/ajroetker/go-highway/hwy/contrib/varint"
+)
+
+func TestPackUnpackBlock128(t *testing.T) {
+	rng := rand.New(rand.NewSource(7))
+	for bitWidth := 0; bitWidth <= 32; bitWidth++ {
+		t.Run(fmt.Sprintf("bits=%d", bitWidth), func(t *testing.T) {
+			mask := maskFor(bitWidth)
+			if bitWidth == 0 {
+				mask = 0
+			}
+			src := make([]uint32, BlockSize)
+			for i := range src {
+				src[i] = rng.Uint32() & mask
+			}
+
+			packed := make([]uint32, BlockPackedWords(bitWidth))
+			if got := PackBlock128(src, bitWidth, packed); got != len(packed) {
+				t.Fatalf("PackBlock128 wrote %d words, want %d", got, len(packed))
+			}
+
+			dst := make([]uint32, BlockSize)
+			if got := UnpackBlock128(packed, bitWidth, 0, dst); got != len(packed) {
+				t.Fatalf("UnpackBlock128 consumed %d words, want %d", got, len(packed))
+			}
+			for i := range src {
+				if dst[i] != src[i] {
+					t.Fatalf("idx=%d: got %d, want %d", i, dst[i], src[i])
+				}
+			}
+
+			// Frame of reference is added to every value.
+			UnpackBlock128(packed, bitWidth, 1000, dst)
+			for i := range src {
+				if dst[i] != src[i]+1000 {
+					t.Fatalf("ref: idx=%d: got %d, want %d", i, dst[i], src[i]+1000)
+				}
+			}
+		})
+	}
+}
+
+func TestUnpackBlock128Delta(t *testing.T) {
+	rng := rand.New(rand.NewSource(11))
+	for _, bitWidth := range []int{0, 1, 3, 7, 13, 20, 32} {
+		t.Run(fmt.Sprintf("bits=%d", bitWidth), func(t *testing.T) {
+			mask := maskFor(bitWidth)
+			if bitWidth == 0 {
+				mask = 0
+			}
+			deltas := make([]uint32, BlockSize)
+			for i := range deltas {
+				deltas[i] = rng.Uint32() & mask
+			}
+			packed := make([]uint32, BlockPackedWords(bitWidth))
+			PackBlock128(deltas, bitWidth, packed)
+
+			const ref, prev = 3, 500
+			want := make([]uint32, BlockSize)
+			for i := range deltas {
+				want[i] = deltas[i] + ref
+			}
+			algo.DeltaDecode(want, uint32(prev))
+
+			dst := make([]uint32, BlockSize)
+			_, last := UnpackBlock128Delta(packed, bitWidth, ref, prev, dst)
+			for i := range want {
+				if dst[i] != want[i] {
+					t.Fatalf("idx=%d: got %d, want %d", i, dst[i], want[i])
+				}
+			}
+			if last != want[BlockSize-1] {
+				t.Errorf("last = %d, want %d", last, want[BlockSize-1])
+			}
+		})
+	}
+}
+
+func TestPackWordsRoundtrip(t *testing.T) {
+	rng := rand.New(rand.NewSource(3))
+	for bitWidth := 1; bitWidth <= 32; bitWidth++ {
+		for _, n := range []int{1, 5, 31, 33, 127} {
+			src := make([]uint32, n)
+			for i := range src {
+				src[i] = rng.Uint32() & maskFor(bitWidth)
+			}
+			packed := make([]uint32, packedWords(n, bitWidth))
+			if got := packWords(src, bitWidth, packed); got != len(packed) {
+				t.Fatalf("bits=%d n=%d: packWords wrote %d, want %d", bitWidth, n, got, len(packed))
+			}
+			dst := make([]uint32, n)
+			unpackWords(packed, bitWidth, 0, dst)
+			for i := range src {
+				if dst[i] != src[i] {
+					t.Fatalf("bits=%d n=%d idx=%d: got %d, want %d", bitWidth, n, i, dst[i], src[i])
+				}
+			}
+		}
+	}
+}
+
+// outlierData returns values mostly below 2^small with a sprinkling of
+// values near 2^large, the case PFOR is designed for.
+func outlierData(rng *rand.Rand, n, small, large int, outlierRate float64) []uint32 {
+	data := make([]uint32, n)
+	for i := range data {
+		if rng.Float64() < outlierRate {
+			data[i] = rng.Uint32()&maskFor(large) | 1<<(large-1)
+		} else {
+			data[i] = rng.Uint32() & maskFor(small)
+		}
+	}
+	return data
+}
+
+func TestForPforRoundtrip(t *testing.T) {
+	rng := rand.New(rand.NewSource(42))
+	sizes := []int{0, 1, 7, 127, 128, 129, 256, 1000, 4099}
+	codecs := []struct {
+		name   string
+		encode func(src, dst []uint32) []uint32
+		decode func(src, dst []uint32) int
+	}{
+		{"FOR", EncodeFOR, DecodeFOR},
+		{"PFOR", EncodePFOR, DecodePFOR},
+	}
+	for _, c := range codecs {
+		for _, n := range sizes {
+			t.Run(fmt.Sprintf("%s/n=%d", c.name, n), func(t *testing.T) {
+				for _, data := range [][]uint32{
+					outlierData(rng, n, 5, 28, 0.02),
+					outlierData(rng, n, 12, 32, 0.1),
+					outlierData(rng, n, 0, 1, 0),
+				} {
+					enc := c.encode(data, nil)
+					if got := DecodedLen(enc); got != n {
+						t.Fatalf("DecodedLen = %d, want %d", got, n)
+					}
+					dst := make([]uint32, n)
+					if got := c.decode(enc, dst); got != n {
+						t.Fatalf("decode returned %d, want %d", got, n)
+					}
+					for i := range data {
+						if dst[i] != data[i] {
+							t.Fatalf("idx=%d: got %d, want %d", i, dst[i], data[i])
+						}
+					}
+				}
+			})
+		}
+	}
+}
+
+func TestPforSmallerWithOutliers(t *testing.T) {
+	rng := rand.New(rand.NewSource(5))
+	data := outlierData(rng, 4096, 6, 30, 0.01)
+	forLen := len(EncodeFOR(data, nil))
+	pforLen := len(EncodePFOR(data, nil))
+	if pforLen >= forLen {
+		t.Errorf("PFOR size %d words, want less than FOR size %d", pforLen, forLen)
+	}
+	// Without outliers PFOR must not be worse than FOR.
+	uniform := outlierData(rng, 4096, 9, 9, 0)
+	if a, b := len(EncodePFOR(uniform, nil)), len(EncodeFOR(uniform, nil)); a > b {
+		t.Errorf("uniform: PFOR size %d words > FOR size %d", a, b)
+	}
+}
+
+func TestDeltaRoundtrip(t *testing.T) {
+	rng := rand.New(rand.NewSource(9))
+	for _, dist := range postingDistributions {
+		for _, n := range []int{1, 100, 128, 300, 5000} {
+			t.Run(fmt.Sprintf("%s/n=%d", dist.name, n), func(t *testing.T) {
+				docs := dist.gen(rng, n)
+				const base = 17
+				for _, encode := range []func([]uint32, uint32, []uint32) []uint32{EncodeDeltaFOR, EncodeDeltaPFOR} {
+					enc := encode(docs, base, nil)
+					dst := make([]uint32, n)
+					if got := DecodeDelta(enc, base, dst); got != n {
+						t.Fatalf("DecodeDelta returned %d, want %d", got, n)
+					}
+					for i := range docs {
+						if dst[i] != docs[i] {
+							t.Fatalf("idx=%d: got %d, want %d", i, dst[i], docs[i])
+						}
+					}
+				}
+			})
+		}
+	}
+}
+
+func TestEncodeAppends(t *testing.T) {
+	prefix := []uint32{0xDEADBEEF}
+	enc := EncodePFOR([]uint32{1, 2, 3}, prefix)
+	if enc[0] != 0xDEADBEEF {
+		t.Fatalf("prefix overwritten: %#x", enc[0])
+	}
+	dst := make([]uint32, 3)
+	DecodePFOR(enc[1:], dst)
+	if dst[0] != 1 || dst[1] != 2 || dst[2] != 3 {
+		t.Errorf("got %v, want [1 2 3]", dst)
+	}
+}
+
+// postingDistributions model document-ID gaps of real inverted indexes:
+// frequent terms have dense postings with tiny gaps, rare terms have large
+// gaps, and clustered terms mix runs of adjacent documents with long jumps.
+var postingDistributions = []struct {
+	name string
+	gen  func(rng *rand.Rand, n int) []uint32
+}{
+	{"dense", func(rng *rand.Rand, n int) []uint32 {
+		return geometricPostings(rng, n, 2)
+	}},
+	{"sparse", func(rng *rand.Rand, n int) []uint32 {
+		return geometricPostings(rng, n, 5000)
+	}},
+	{"clustered", func(rng *rand.Rand, n int) []uint32 {
+		docs := make([]uint32, n)
+		doc := uint32(0)
+		for i := range docs {
+			if rng.Intn(64) == 0 {
+				doc += uint32(rng.Intn(1 << 20))
+			}
+			doc += 1 + uint32(rng.Intn(3))
+			docs[i] = doc
+		}
+		return docs
+	}},
+}
+
+// geometricPostings returns n increasing doc IDs with geometrically
+// distributed gaps of the given mean.
+func geometricPostings(rng *rand.Rand, n int, mean float64) []uint32 {
+	docs := make([]uint32, n)
+	p := 1 / mean
+	doc := uint32(0)
+	for i := range docs {
+		gap := 1 + uint32(math.Log(1-rng.Float64())/math.Log(1-p+1e-12))
+		doc += gap
+		docs[i] = doc
+	}
+	return docs
+}
+
+// Benchmarks
+
+func BenchmarkPackBlock128(b *testing.B) {
+	for _, bitWidth := range []int{1, 4, 8, 13, 24} {
+		src := make([]uint32, BlockSize)
+		for i := range src {
+			src[i] = uint32(i*2654435761) & maskFor(bitWidth)
+		}
+		packed := make([]uint32, BlockPackedWords(bitWidth))
+		b.Run(fmt.Sprintf("bits=%d", bitWidth), func(b *testing.B) {
+			b.SetBytes(BlockSize * 4)
+			for i := 0; i < b.N; i++ {
+				PackBlock128(src, bitWidth, packed)
+			}
+		})
+	}
+}
+
+func BenchmarkUnpackBlock128(b *testing.B) {
+	for _, bitWidth := range []int{1, 4, 8, 13, 24} {
+		src := make([]uint32, BlockSize)
+		for i := range src {
+			src[i] = uint32(i*2654435761) & maskFor(bitWidth)
+		}
+		packed := make([]uint32, BlockPackedWords(bitWidth))
+		PackBlock128(src, bitWidth, packed)
+		dst := make([]uint32, BlockSize)
+		b.Run(fmt.Sprintf("bits=%d", bitWidth), func(b *testing.B) {
+			b.SetBytes(BlockSize * 4)
+			for i := 0; i < b.N; i++ {
+				UnpackBlock128(packed, bitWidth, 0, dst)
+			}
+		})
+	}
+}
+
+// BenchmarkPostingDecode compares delta FOR/PFOR decoding against
+// Stream-VByte (plus SIMD prefix sum) on posting-list distributions.
+// The bits/int metric reports the compressed size.
+func BenchmarkPostingDecode(b *testing.B) {
+	const n = 1 << 16
+	rng := rand.New(rand.NewSource(1))
+	for _, dist := range postingDistributions {
+		docs := dist.gen(rng, n)
+		dst := make([]uint32, n)
+
+		for _, c := range []struct {
+			name   string
+			encode func([]uint32, uint32, []uint32) []uint32
+		}{
+			{"DeltaFOR", EncodeDeltaFOR},
+			{"DeltaPFOR", EncodeDeltaPFOR},
+		} {
+			enc := c.encode(docs, 0, nil)
+			b.Run(dist.name+"/"+c.name, func(b *testing.B) {
+				b.SetBytes(n * 4)
+				b.ReportMetric(float64(len(enc)*32)/n, "bits/int")
+				b.ReportAllocs()
+				for i := 0; i < b.N; i++ {
+					DecodeDelta(enc, 0, dst)
+				}
+			})
+		}
+
+		deltas := make([]uint32, n)
+		DeltaEncode32(docs, 0, deltas)
+		control, data := varint.EncodeStreamVByte32(deltas)
+		b.Run(dist.name+"/StreamVByte", func(b *testing.B) {
+			b.SetBytes(n * 4)
+			b.ReportMetric(float64((len(control)+len(data))*8)/n, "bits/int")
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				varint.DecodeStreamVByte32Into(control, data, dst)
+				algo.DeltaDecode(dst, 0)
+			}
+		})
+	}
+}
+
+func BenchmarkPostingEncode(b *testing.B) {
+	const n = 1 << 16
+	rng := rand.New(rand.NewSource(1))
+	for _, dist := range postingDistributions {
+		docs := dist.gen(rng, n)
+		buf := make([]uint32, 0, 2*n)
+		for _, c := range []struct {
+			name   string
+			encode func([]uint32, uint32, []uint32) []uint32
+		}{
+			{"DeltaFOR", EncodeDeltaFOR},
+			{"DeltaPFOR", EncodeDeltaPFOR},
+		} {
+			b.Run(dist.name+"/"+c.name, func(b *testing.B) {
+				b.SetBytes(n * 4)
+				b.ReportAllocs()
+				for i := 0; i < b.N; i++ {
+					buf = c.encode(docs, 0, buf[:0])
+				}
+			})
+		}
+	}
+}
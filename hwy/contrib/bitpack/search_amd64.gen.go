@@ -0,0 +1,56 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package bitpack
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var NextGEQ func(sorted []uint32, target uint32) int
+
+func init() {
+	initSearchAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "bitpack",
+		Groups: []hwy.DispatchGroup{
+			{Name: "NextGEQ", Vars: []any{&NextGEQ}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initSearchAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initSearchAVX2},
+			{Name: "fallback", Supported: true, Init: initSearchFallback},
+		},
+	})
+}
+
+func initSearchAll() {
+	if hwy.NoSimdEnv() {
+		initSearchFallback()
+		return
+	}
+	if archsimd.X86.AVX512() {
+		initSearchAVX512()
+		return
+	}
+	if archsimd.X86.AVX2() {
+		initSearchAVX2()
+		return
+	}
+	initSearchFallback()
+}
+
+func initSearchAVX2() {
+	NextGEQ = BaseNextGEQ_avx2
+}
+
+func initSearchAVX512() {
+	NextGEQ = BaseNextGEQ_avx512
+}
+
+func initSearchFallback() {
+	NextGEQ = BaseNextGEQ_fallback
+}
@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package bitpack
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var NextGEQ func(sorted []uint32, target uint32) int
+
+func init() {
+	initSearchAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "bitpack",
+		Groups: []hwy.DispatchGroup{
+			{Name: "NextGEQ", Vars: []any{&NextGEQ}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initSearchNEON},
+			{Name: "fallback", Supported: true, Init: initSearchFallback},
+		},
+	})
+}
+
+func initSearchAll() {
+	if hwy.NoSimdEnv() {
+		initSearchFallback()
+		return
+	}
+	initSearchNEON()
+	return
+}
+
+func initSearchNEON() {
+	NextGEQ = BaseNextGEQ_neon
+}
+
+func initSearchFallback() {
+	NextGEQ = BaseNextGEQ_fallback
+}
@@ -0,0 +1,70 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package bitpack
+
+//go:generate go run ../../../cmd/hwygen -input search_base.go -output . -targets avx2,avx512,neon,fallback -dispatch search
+
+import "github.com/ajroetker/go-highway/hwy"
+
+// BaseNextGEQ returns the index of the first value in the sorted slice that
+// is greater than or equal to target, or len(sorted) if there is none.
+//
+// Each vector counts its lanes below target; because the input is sorted,
+// the count is the offset of the answer once it is less than a full vector.
+// The unsigned comparison is computed as the borrow bit of v - target so the
+// kernel is correct over the full uint32 range on every target.
+//
+// Example:
+//
+//	block := []uint32{3, 9, 10, 14, 200}
+//	NextGEQ(block, 11)  // Returns 3 (block[3] = 14)
+func BaseNextGEQ(sorted []uint32, target uint32) int {
+	n := len(sorted)
+	lanes := hwy.Zero[uint32]().NumLanes()
+	t := hwy.Set(target)
+
+	var i int
+	//hwy:unroll 1
+	for i = 0; i+lanes <= n; i += lanes {
+		v := hwy.Load(sorted[i:])
+		// borrow(v - t) = (~v & t) | (~(v ^ t) & (v - t)), top bit.
+		borrow := hwy.Or(hwy.AndNot(v, t), hwy.AndNot(hwy.Xor(v, t), hwy.Sub(v, t)))
+		less := int(hwy.ReduceSum(hwy.ShiftRight(borrow, 31)))
+		if less < lanes {
+			return i + less
+		}
+	}
+
+	for ; i < n; i++ {
+		if sorted[i] >= target {
+			return i
+		}
+	}
+	return n
+}
+
+// BaseNextGEQScalar is the fallback of BaseNextGEQ: a plain scan, which
+// beats counting lanes of the emulated vectors one at a time.
+//
+//hwy:specializes NextGEQ
+//hwy:targets fallback
+func BaseNextGEQScalar(sorted []uint32, target uint32) int {
+	for i, v := range sorted {
+		if v >= target {
+			return i
+		}
+	}
+	return len(sorted)
+}
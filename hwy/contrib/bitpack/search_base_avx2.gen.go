@@ -0,0 +1,33 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package bitpack
+
+import (
+	"simd/archsimd"
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func BaseNextGEQ_avx2(sorted []uint32, target uint32) int {
+	n := len(sorted)
+	lanes := 8
+	t := archsimd.BroadcastUint32x8(target)
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		v := archsimd.LoadUint32x8((*[8]uint32)(unsafe.Pointer(&sorted[i])))
+		borrow := v.AndNot(t).Or(v.Xor(t).AndNot(v.Sub(t)))
+		less := int(hwy.ReduceSum_AVX2_Uint32x8(borrow.ShiftAllRight(uint64(31))))
+		if less < lanes {
+			return i + less
+		}
+	}
+	for ; i < n; i++ {
+		if sorted[i] >= target {
+			return i
+		}
+	}
+	return n
+}
@@ -0,0 +1,12 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package bitpack
+
+func BaseNextGEQ_fallback(sorted []uint32, target uint32) int {
+	for i, v := range sorted {
+		if v >= target {
+			return i
+		}
+	}
+	return len(sorted)
+}
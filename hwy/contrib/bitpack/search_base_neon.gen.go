@@ -0,0 +1,32 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package bitpack
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy/asm"
+)
+
+func BaseNextGEQ_neon(sorted []uint32, target uint32) int {
+	n := len(sorted)
+	lanes := 4
+	t := asm.BroadcastUint32x4(target)
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		v := asm.LoadUint32x4((*[4]uint32)(unsafe.Pointer(&sorted[i])))
+		borrow := v.AndNot(t).Or(v.Xor(t).AndNot(v.Sub(t)))
+		less := int(borrow.ShiftAllRight(31).ReduceSum())
+		if less < lanes {
+			return i + less
+		}
+	}
+	for ; i < n; i++ {
+		if sorted[i] >= target {
+			return i
+		}
+	}
+	return n
+}
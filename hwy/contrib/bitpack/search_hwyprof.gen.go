@@ -0,0 +1,22 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package bitpack
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("bitpack", "NextGEQ", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := NextGEQ; hwyImpl != nil {
+			NextGEQ = func(sorted []uint32, target uint32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(sorted, target)
+				hwyCounter.Done(hwyStart, len(sorted), hwy.SliceBytes(sorted))
+				return hwyR0
+			}
+		}
+	})
+}
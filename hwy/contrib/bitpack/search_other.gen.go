@@ -0,0 +1,32 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build !arm64 && !(amd64 && goexperiment.simd)
+
+package bitpack
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var NextGEQ func(sorted []uint32, target uint32) int
+
+func init() {
+	initSearchAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "bitpack",
+		Groups: []hwy.DispatchGroup{
+			{Name: "NextGEQ", Vars: []any{&NextGEQ}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initSearchFallback},
+		},
+	})
+}
+
+func initSearchAll() {
+	initSearchFallback()
+}
+
+func initSearchFallback() {
+	NextGEQ = BaseNextGEQ_fallback
+}
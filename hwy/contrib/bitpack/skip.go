@@ -0,0 +1,249 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package bitpack
+
+// BlockDirectory indexes the blocks of a FOR/PFOR stream so individual blocks
+// can be located and skipped without decoding their predecessors.
+//
+// Entry b describes the values src[b*BlockSize : (b+1)*BlockSize]. For lists
+// encoded with delta coding Min and Max are the first and last value of the
+// block, which are also the smallest and largest because the input is sorted.
+type BlockDirectory struct {
+	// Offsets holds the word offset of each block header within the stream.
+	Offsets []uint32
+
+	// Min holds the smallest value of each block.
+	Min []uint32
+
+	// Max holds the largest value of each block.
+	Max []uint32
+}
+
+// NumBlocks returns the number of indexed blocks.
+func (d *BlockDirectory) NumBlocks() int {
+	return len(d.Offsets)
+}
+
+func (d *BlockDirectory) add(offset int, lo, hi uint32) {
+	d.Offsets = append(d.Offsets, uint32(offset))
+	d.Min = append(d.Min, lo)
+	d.Max = append(d.Max, hi)
+}
+
+// BlockList is a FOR/PFOR encoded list together with its block directory.
+// It supports random access (Select), partial decoding (UnpackRange) and,
+// for sorted lists, skipping to the first value >= a target (BlockCursor).
+//
+// A BlockList is immutable after construction and safe for concurrent reads;
+// cursors are not safe for concurrent use.
+type BlockList struct {
+	data  []uint32
+	dir   BlockDirectory
+	delta bool
+	base  uint32
+}
+
+// NewBlockList encodes src as a FOR stream, or a PFOR stream if patched is
+// set, and builds its block directory.
+func NewBlockList(src []uint32, patched bool) *BlockList {
+	l := &BlockList{}
+	l.data = encodeBlocks(src, nil, patched, &l.dir)
+	return l
+}
+
+// NewDeltaBlockList encodes the sorted values in src as a delta FOR (or PFOR,
+// if patched is set) stream relative to base and builds its block directory.
+// Decoding any block only needs the directory entry of its predecessor, so
+// blocks can be decoded independently.
+func NewDeltaBlockList(src []uint32, base uint32, patched bool) *BlockList {
+	l := &BlockList{delta: true, base: base}
+	l.data = encodeDeltaBlocks(src, base, nil, patched, &l.dir)
+	return l
+}
+
+// Len returns the number of values in the list.
+func (l *BlockList) Len() int {
+	return DecodedLen(l.data)
+}
+
+// Data returns the encoded stream. It can be decoded as a whole with
+// DecodeFOR/DecodePFOR, or DecodeDelta for delta lists.
+func (l *BlockList) Data() []uint32 {
+	return l.data
+}
+
+// Directory returns the block directory.
+func (l *BlockList) Directory() *BlockDirectory {
+	return &l.dir
+}
+
+// blockLen returns the number of values in block b.
+func (l *BlockList) blockLen(b int) int {
+	return min(BlockSize, l.Len()-b*BlockSize)
+}
+
+// blockBase returns the value preceding block b in a delta list.
+func (l *BlockList) blockBase(b int) uint32 {
+	if b == 0 {
+		return l.base
+	}
+	return l.dir.Max[b-1]
+}
+
+// DecodeBlock decodes block b into dst and returns the number of values
+// written (BlockSize, except for the last block).
+func (l *BlockList) DecodeBlock(b int, dst []uint32) int {
+	n := l.blockLen(b)
+	var prev uint32
+	if l.delta {
+		prev = l.blockBase(b)
+	}
+	decodeBlock(l.data, int(l.dir.Offsets[b]), dst[:n], l.delta, prev)
+	return n
+}
+
+// decodeSpan decodes in-block positions [lo, hi) of block b into out[lo:hi].
+// Only the packed rows covering the span are unpacked. Delta blocks are
+// decoded from position 0 because each value depends on its predecessors.
+func (l *BlockList) decodeSpan(b, lo, hi int, out *[BlockSize]uint32) {
+	if l.delta {
+		lo = 0
+	}
+	n := l.blockLen(b)
+	h, pos := readHeader(l.data, int(l.dir.Offsets[b]))
+	if n == BlockSize {
+		r0, r1 := lo/BlockLanes, (hi+BlockLanes-1)/BlockLanes
+		unpackBlockRows(l.data[pos:], h.width, h.ref, r0, r1, out[r0*BlockLanes:r1*BlockLanes])
+	} else {
+		unpackWords(l.data[pos:], h.width, h.ref, out[:hi])
+	}
+	if h.numExc > 0 {
+		h.patchExceptions(l.data, pos+h.payloadWords(n), out[:], lo, hi)
+	}
+	if l.delta {
+		prev := l.blockBase(b)
+		for i := range hi {
+			prev += out[i]
+			out[i] = prev
+		}
+	}
+}
+
+// Select returns the value at index i, decoding only the packed vector that
+// holds it (or, for delta lists, the vectors up to it within its block).
+func (l *BlockList) Select(i int) uint32 {
+	if i < 0 || i >= l.Len() {
+		panic("bitpack: Select index out of range")
+	}
+	var buf [BlockSize]uint32
+	b, j := i/BlockSize, i%BlockSize
+	l.decodeSpan(b, j, j+1, &buf)
+	return buf[j]
+}
+
+// UnpackRange decodes the values at indices [start, end) into dst and
+// returns the number of values written. Blocks outside the range are
+// skipped using the directory.
+func (l *BlockList) UnpackRange(start, end int, dst []uint32) int {
+	end = min(end, l.Len())
+	if start < 0 || start >= end {
+		return 0
+	}
+	_ = dst[end-start-1]
+	var buf [BlockSize]uint32
+	out := 0
+	for b := start / BlockSize; b*BlockSize < end; b++ {
+		lo := max(start-b*BlockSize, 0)
+		hi := min(end-b*BlockSize, l.blockLen(b))
+		if lo == 0 && hi == l.blockLen(b) {
+			out += l.DecodeBlock(b, dst[out:])
+			continue
+		}
+		l.decodeSpan(b, lo, hi, &buf)
+		out += copy(dst[out:], buf[lo:hi])
+	}
+	return out
+}
+
+// BlockCursor iterates over a sorted BlockList with support for skipping
+// ahead, as used by skip-pointer evaluation of posting-list intersections.
+type BlockCursor struct {
+	list  *BlockList
+	block int // block held in buf, or -1
+	n     int // number of values in buf
+	pos   int // current index in the list
+	buf   [BlockSize]uint32
+}
+
+// Cursor returns a cursor positioned at index 0. The list must be sorted
+// (any delta list, or a FOR/PFOR list built from sorted input).
+func (l *BlockList) Cursor() *BlockCursor {
+	return &BlockCursor{list: l, block: -1}
+}
+
+// Index returns the current index, or Len() once the cursor is exhausted.
+func (c *BlockCursor) Index() int {
+	return c.pos
+}
+
+// Value returns the value at the current index. It must not be called once
+// the cursor is exhausted.
+func (c *BlockCursor) Value() uint32 {
+	c.load(c.pos / BlockSize)
+	return c.buf[c.pos%BlockSize]
+}
+
+// Next advances to the next index and reports whether it holds a value.
+func (c *BlockCursor) Next() bool {
+	if c.pos < c.list.Len() {
+		c.pos++
+	}
+	return c.pos < c.list.Len()
+}
+
+// NextGEQ advances the cursor to the first index at or after the current one
+// whose value is >= target, and returns that value. ok is false (and the
+// cursor exhausted) if there is no such value.
+//
+// Whole blocks are skipped by searching the directory maxima, and only the
+// block containing the answer is decoded.
+func (c *BlockCursor) NextGEQ(target uint32) (value uint32, ok bool) {
+	l := c.list
+	if c.pos >= l.Len() {
+		return 0, false
+	}
+	b := c.pos / BlockSize
+	if l.dir.Max[b] < target {
+		b += 1 + NextGEQ(l.dir.Max[b+1:], target)
+		if b >= l.dir.NumBlocks() {
+			c.pos = l.Len()
+			return 0, false
+		}
+		c.pos = b * BlockSize
+	}
+	c.load(b)
+	j := c.pos % BlockSize
+	j += NextGEQ(c.buf[j:c.n], target)
+	c.pos = b*BlockSize + j
+	return c.buf[j], true
+}
+
+// load decodes block b into the cursor buffer if it is not already there.
+func (c *BlockCursor) load(b int) {
+	if c.block != b {
+		c.n = c.list.DecodeBlock(b, c.buf[:])
+		c.block = b
+	}
+}
@@ -0,0 +1,253 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package bitpack
+
+import (
+	"fmt"
+	"math/rand"
+	"sort"
+	"testing"
+)
+
+func TestNextGEQ(t *testing.T) {
+	rng := rand.New(rand.NewSource(1))
+	for _, n := range []int{0, 1, 3, 4, 15, 16, 17, 64, 128, 1000} {
+		sorted := make([]uint32, n)
+		for i := range sorted {
+			sorted[i] = rng.Uint32()
+		}
+		sort.Slice(sorted, func(i, j int) bool { return sorted[i] < sorted[j] })
+
+		targets := []uint32{0, 1, 1 << 31, (1 << 31) - 1, ^uint32(0)}
+		for range 50 {
+			targets = append(targets, rng.Uint32())
+		}
+		for _, v := range sorted {
+			targets = append(targets, v, v+1)
+		}
+		for _, target := range targets {
+			want := sort.Search(n, func(i int) bool { return sorted[i] >= target })
+			if got := NextGEQ(sorted, target); got != want {
+				t.Fatalf("n=%d target=%d: got %d, want %d", n, target, got, want)
+			}
+		}
+	}
+}
+
+func TestNextGEQDuplicates(t *testing.T) {
+	sorted := []uint32{1, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 9, 9, 9, 9}
+	if got := NextGEQ(sorted, 5); got != 1 {
+		t.Errorf("NextGEQ(5) = %d, want 1", got)
+	}
+	if got := NextGEQ(sorted, 6); got != 18 {
+		t.Errorf("NextGEQ(6) = %d, want 18", got)
+	}
+}
+
+func testLists(docs []uint32) map[string]*BlockList {
+	return map[string]*BlockList{
+		"FOR":       NewBlockList(docs, false),
+		"PFOR":      NewBlockList(docs, true),
+		"DeltaFOR":  NewDeltaBlockList(docs, 0, false),
+		"DeltaPFOR": NewDeltaBlockList(docs, 0, true),
+	}
+}
+
+func TestBlockDirectory(t *testing.T) {
+	rng := rand.New(rand.NewSource(2))
+	docs := postingDistributions[2].gen(rng, 1000)
+	for name, l := range testLists(docs) {
+		dir := l.Directory()
+		if got, want := dir.NumBlocks(), (len(docs)+BlockSize-1)/BlockSize; got != want {
+			t.Fatalf("%s: NumBlocks = %d, want %d", name, got, want)
+		}
+		for b := range dir.NumBlocks() {
+			block := docs[b*BlockSize : min((b+1)*BlockSize, len(docs))]
+			if dir.Min[b] != block[0] || dir.Max[b] != block[len(block)-1] {
+				t.Errorf("%s block %d: range [%d, %d], want [%d, %d]",
+					name, b, dir.Min[b], dir.Max[b], block[0], block[len(block)-1])
+			}
+		}
+		// The stream stays decodable by the whole-list decoders.
+		out := make([]uint32, len(docs))
+		if l.delta {
+			DecodeDelta(l.Data(), 0, out)
+		} else {
+			DecodePFOR(l.Data(), out)
+		}
+		for i := range docs {
+			if out[i] != docs[i] {
+				t.Fatalf("%s: Data decode idx=%d: got %d, want %d", name, i, out[i], docs[i])
+			}
+		}
+	}
+}
+
+func TestSelect(t *testing.T) {
+	rng := rand.New(rand.NewSource(3))
+	for _, dist := range postingDistributions {
+		docs := dist.gen(rng, 777)
+		for name, l := range testLists(docs) {
+			for i := range docs {
+				if got := l.Select(i); got != docs[i] {
+					t.Fatalf("%s/%s: Select(%d) = %d, want %d", dist.name, name, i, got, docs[i])
+				}
+			}
+		}
+	}
+
+	// Unsorted data with outliers for the non-delta codecs.
+	data := outlierData(rng, 500, 4, 30, 0.05)
+	for _, patched := range []bool{false, true} {
+		l := NewBlockList(data, patched)
+		for i := range data {
+			if got := l.Select(i); got != data[i] {
+				t.Fatalf("patched=%v: Select(%d) = %d, want %d", patched, i, got, data[i])
+			}
+		}
+	}
+}
+
+func TestUnpackRange(t *testing.T) {
+	rng := rand.New(rand.NewSource(4))
+	docs := postingDistributions[0].gen(rng, 1000)
+	ranges := [][2]int{{0, 1000}, {0, 1}, {5, 6}, {127, 129}, {128, 256}, {100, 900}, {990, 1000}, {999, 2000}}
+	for name, l := range testLists(docs) {
+		for _, r := range ranges {
+			t.Run(fmt.Sprintf("%s/%d-%d", name, r[0], r[1]), func(t *testing.T) {
+				end := min(r[1], len(docs))
+				dst := make([]uint32, end-r[0])
+				if got := l.UnpackRange(r[0], r[1], dst); got != end-r[0] {
+					t.Fatalf("UnpackRange returned %d, want %d", got, end-r[0])
+				}
+				for i := range dst {
+					if dst[i] != docs[r[0]+i] {
+						t.Fatalf("idx=%d: got %d, want %d", r[0]+i, dst[i], docs[r[0]+i])
+					}
+				}
+			})
+		}
+	}
+}
+
+func TestCursorNextGEQ(t *testing.T) {
+	rng := rand.New(rand.NewSource(5))
+	for _, dist := range postingDistributions {
+		docs := dist.gen(rng, 3000)
+		for name, l := range testLists(docs) {
+			c := l.Cursor()
+			target := uint32(0)
+			for {
+				target += uint32(rng.Intn(int(docs[len(docs)-1]/200) + 2))
+				want := sort.Search(len(docs), func(i int) bool { return docs[i] >= target })
+				want = max(want, c.Index())
+				got, ok := c.NextGEQ(target)
+				if want == len(docs) {
+					if ok {
+						t.Fatalf("%s/%s: NextGEQ(%d) = %d, want exhausted", dist.name, name, target, got)
+					}
+					break
+				}
+				if !ok || c.Index() != want || got != docs[want] {
+					t.Fatalf("%s/%s: NextGEQ(%d) = (%d, %v) at %d, want %d at %d",
+						dist.name, name, target, got, ok, c.Index(), docs[want], want)
+				}
+				if c.Value() != got {
+					t.Fatalf("Value() = %d, want %d", c.Value(), got)
+				}
+			}
+		}
+	}
+}
+
+func TestCursorNext(t *testing.T) {
+	rng := rand.New(rand.NewSource(6))
+	docs := postingDistributions[1].gen(rng, 300)
+	c := NewDeltaBlockList(docs, 0, true).Cursor()
+	for i := range docs {
+		if c.Index() != i || c.Value() != docs[i] {
+			t.Fatalf("idx=%d: got (%d, %d)", i, c.Index(), c.Value())
+		}
+		if c.Next() != (i+1 < len(docs)) {
+			t.Fatalf("Next at %d returned wrong result", i)
+		}
+	}
+}
+
+// Benchmarks
+
+func BenchmarkNextGEQ(b *testing.B) {
+	block := make([]uint32, BlockSize)
+	for i := range block {
+		block[i] = uint32(i * 3)
+	}
+	b.SetBytes(BlockSize * 4)
+	for i := 0; i < b.N; i++ {
+		NextGEQ(block, uint32(i%BlockSize)*3)
+	}
+}
+
+func BenchmarkSelect(b *testing.B) {
+	rng := rand.New(rand.NewSource(1))
+	docs := postingDistributions[0].gen(rng, 1<<16)
+	for _, delta := range []bool{false, true} {
+		l := NewBlockList(docs, true)
+		if delta {
+			l = NewDeltaBlockList(docs, 0, true)
+		}
+		b.Run(fmt.Sprintf("delta=%v", delta), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				l.Select((i * 7919) % len(docs))
+			}
+		})
+	}
+}
+
+// BenchmarkIntersect intersects a short posting list with a long one by
+// skipping through the long list, versus decoding the long list fully.
+func BenchmarkIntersect(b *testing.B) {
+	rng := rand.New(rand.NewSource(1))
+	long := postingDistributions[0].gen(rng, 1<<18)
+	short := make([]uint32, 0, 256)
+	for range 256 {
+		short = append(short, long[rng.Intn(len(long))])
+	}
+	sort.Slice(short, func(i, j int) bool { return short[i] < short[j] })
+	l := NewDeltaBlockList(long, 0, true)
+
+	b.Run("Skip", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			c := l.Cursor()
+			for _, doc := range short {
+				if _, ok := c.NextGEQ(doc); !ok {
+					break
+				}
+			}
+		}
+	})
+
+	full := make([]uint32, len(long))
+	b.Run("FullDecode", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			DecodeDelta(l.Data(), 0, full)
+			j := 0
+			for _, doc := range short {
+				j += NextGEQ(full[j:], doc)
+			}
+		}
+	})
+}
@@ -0,0 +1,42 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package fastscan provides the 4-bit lookup-table block scan shared by the
+// FastScan paths of the pq and rabitq packages.
+//
+// # Layout
+//
+// A block holds BlockSize codes of n 4-bit sub-codes each, transposed so
+// that sub-code s of every vector is contiguous: byte s*BlockSize+j is the
+// sub-code of vector j. The query side is a uint8 lookup table of 16 entries
+// per sub-code. The score of vector j is
+//
+//	sum over s of lut[s*16 + codes[s*BlockSize+j]]
+//
+// # Kernels
+//
+//   - ScanBlock(codes, lut, n, out) - Scores of one block, saturated to
+//     uint16
+//
+// ScanBlock scores 16 codes per byte-shuffle instruction (PSHUFB on x86, TBL
+// on ARM), zero-extends the looked-up bytes into uint16 lanes and keeps four
+// saturating uint16 accumulators in registers for the whole block, storing
+// them once at the end.
+//
+// # Build Requirements
+//
+// The SIMD implementations require:
+//   - GOEXPERIMENT=simd build flag
+//   - AMD64 architecture with AVX2 or AVX-512 support, or ARM64 with NEON
+package fastscan
@@ -0,0 +1,54 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package fastscan
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		u8  = make([]uint8, allocTestLen)
+		u16 = make([]uint16, allocTestLen)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseScanBlock_fallback", func() { BaseScanBlock_fallback(u8, u8, allocTestDim, u16) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
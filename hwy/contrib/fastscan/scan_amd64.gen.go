@@ -0,0 +1,56 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package fastscan
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var ScanBlock func(codes []uint8, lut []uint8, n int, out []uint16)
+
+func init() {
+	initScanAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "fastscan",
+		Groups: []hwy.DispatchGroup{
+			{Name: "ScanBlock", Vars: []any{&ScanBlock}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initScanAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initScanAVX2},
+			{Name: "fallback", Supported: true, Init: initScanFallback},
+		},
+	})
+}
+
+func initScanAll() {
+	if hwy.NoSimdEnv() {
+		initScanFallback()
+		return
+	}
+	if archsimd.X86.AVX512() {
+		initScanAVX512()
+		return
+	}
+	if archsimd.X86.AVX2() {
+		initScanAVX2()
+		return
+	}
+	initScanFallback()
+}
+
+func initScanAVX2() {
+	ScanBlock = BaseScanBlock_avx2
+}
+
+func initScanAVX512() {
+	ScanBlock = BaseScanBlock_avx512
+}
+
+func initScanFallback() {
+	ScanBlock = BaseScanBlock_fallback
+}
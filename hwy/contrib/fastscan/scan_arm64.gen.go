@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package fastscan
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var ScanBlock func(codes []uint8, lut []uint8, n int, out []uint16)
+
+func init() {
+	initScanAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "fastscan",
+		Groups: []hwy.DispatchGroup{
+			{Name: "ScanBlock", Vars: []any{&ScanBlock}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initScanNEON},
+			{Name: "fallback", Supported: true, Init: initScanFallback},
+		},
+	})
+}
+
+func initScanAll() {
+	if hwy.NoSimdEnv() {
+		initScanFallback()
+		return
+	}
+	initScanNEON()
+	return
+}
+
+func initScanNEON() {
+	ScanBlock = BaseScanBlock_neon
+}
+
+func initScanFallback() {
+	ScanBlock = BaseScanBlock_fallback
+}
@@ -0,0 +1,67 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package fastscan
+
+//go:generate go run ../../../cmd/hwygen -input scan_base.go -output . -targets avx2,avx512,neon,fallback -dispatch scan
+
+import "github.com/ajroetker/go-highway/hwy"
+
+// BlockSize is the number of codes scored together by ScanBlock.
+const BlockSize = 32
+
+// BaseScanBlock scores one block of BlockSize codes against a uint8 lookup
+// table: out[j] is the sum over s < n of lut[s*16+codes[s*BlockSize+j]],
+// saturated to math.MaxUint16. See the package documentation for the layout.
+//
+// Each sub-code costs two 16-byte table lookups that score 16 vectors each.
+// The looked-up bytes are zero-extended into four uint16 accumulators of 8
+// lanes that stay in registers for all n sub-codes and are stored once.
+//
+//hwy:elemtype uint8
+func BaseScanBlock(codes []uint8, lut []uint8, n int, out []uint16) {
+	if len(out) < BlockSize {
+		return
+	}
+	if n == 0 {
+		for j := range BlockSize {
+			out[j] = 0
+		}
+		return
+	}
+	_ = codes[n*BlockSize-1]
+	_ = lut[n*16-1]
+
+	tbl := hwy.LoadSlice(lut[:16])
+	lo := hwy.TableLookupBytes(tbl, hwy.LoadSlice(codes[:16]))
+	hi := hwy.TableLookupBytes(tbl, hwy.LoadSlice(codes[16:][:16]))
+	acc0 := hwy.PromoteLowerU8ToU16(lo)
+	acc1 := hwy.PromoteUpperU8ToU16(lo)
+	acc2 := hwy.PromoteLowerU8ToU16(hi)
+	acc3 := hwy.PromoteUpperU8ToU16(hi)
+	for s := 1; s < n; s++ {
+		tbl = hwy.LoadSlice(lut[s*16:][:16])
+		lo = hwy.TableLookupBytes(tbl, hwy.LoadSlice(codes[s*BlockSize:][:16]))
+		hi = hwy.TableLookupBytes(tbl, hwy.LoadSlice(codes[s*BlockSize+16:][:16]))
+		acc0 = hwy.SaturatedAdd(acc0, hwy.PromoteLowerU8ToU16(lo))
+		acc1 = hwy.SaturatedAdd(acc1, hwy.PromoteUpperU8ToU16(lo))
+		acc2 = hwy.SaturatedAdd(acc2, hwy.PromoteLowerU8ToU16(hi))
+		acc3 = hwy.SaturatedAdd(acc3, hwy.PromoteUpperU8ToU16(hi))
+	}
+
+	hwy.StoreSlice(acc0, out[:8])
+	hwy.StoreSlice(acc1, out[8:16])
+	hwy.StoreSlice(acc2, out[16:24])
+	hwy.StoreSlice(acc3, out[24:32])
+}
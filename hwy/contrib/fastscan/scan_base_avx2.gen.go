@@ -0,0 +1,45 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package fastscan
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func BaseScanBlock_avx2(codes []uint8, lut []uint8, n int, out []uint16) {
+	if len(out) < BlockSize {
+		return
+	}
+	if n == 0 {
+		for j := range BlockSize {
+			out[j] = 0
+		}
+		return
+	}
+	_ = codes[n*BlockSize-1]
+	_ = lut[n*16-1]
+	tbl := archsimd.LoadUint8x16Slice(lut[:16])
+	lo := hwy.TableLookupBytes_AVX2_Uint8x16(tbl, archsimd.LoadUint8x16Slice(codes[:16]))
+	hi := hwy.TableLookupBytes_AVX2_Uint8x16(tbl, archsimd.LoadUint8x16Slice(codes[16:][:16]))
+	acc0 := hwy.PromoteLowerU8ToU16_AVX2_Uint8x16(lo)
+	acc1 := hwy.PromoteUpperU8ToU16_AVX2_Uint8x16(lo)
+	acc2 := hwy.PromoteLowerU8ToU16_AVX2_Uint8x16(hi)
+	acc3 := hwy.PromoteUpperU8ToU16_AVX2_Uint8x16(hi)
+	for s := 1; s < n; s++ {
+		tbl = archsimd.LoadUint8x16Slice(lut[s*16:][:16])
+		lo = hwy.TableLookupBytes_AVX2_Uint8x16(tbl, archsimd.LoadUint8x16Slice(codes[s*BlockSize:][:16]))
+		hi = hwy.TableLookupBytes_AVX2_Uint8x16(tbl, archsimd.LoadUint8x16Slice(codes[s*BlockSize+16:][:16]))
+		acc0 = acc0.AddSaturated(hwy.PromoteLowerU8ToU16_AVX2_Uint8x16(lo))
+		acc1 = acc1.AddSaturated(hwy.PromoteUpperU8ToU16_AVX2_Uint8x16(lo))
+		acc2 = acc2.AddSaturated(hwy.PromoteLowerU8ToU16_AVX2_Uint8x16(hi))
+		acc3 = acc3.AddSaturated(hwy.PromoteUpperU8ToU16_AVX2_Uint8x16(hi))
+	}
+	acc0.StoreSlice(out[:8])
+	acc1.StoreSlice(out[8:16])
+	acc2.StoreSlice(out[16:24])
+	acc3.StoreSlice(out[24:32])
+}
@@ -0,0 +1,41 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package fastscan
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func BaseScanBlock_fallback(codes []uint8, lut []uint8, n int, out []uint16) {
+	if len(out) < BlockSize {
+		return
+	}
+	if n == 0 {
+		for j := range BlockSize {
+			out[j] = 0
+		}
+		return
+	}
+	_ = codes[n*BlockSize-1]
+	_ = lut[n*16-1]
+	tbl := hwy.LoadSlice(lut[:16])
+	lo := hwy.TableLookupBytes(tbl, hwy.LoadSlice(codes[:16]))
+	hi := hwy.TableLookupBytes(tbl, hwy.LoadSlice(codes[16:][:16]))
+	acc0 := hwy.PromoteLowerU8ToU16(lo)
+	acc1 := hwy.PromoteUpperU8ToU16(lo)
+	acc2 := hwy.PromoteLowerU8ToU16(hi)
+	acc3 := hwy.PromoteUpperU8ToU16(hi)
+	for s := 1; s < n; s++ {
+		tbl = hwy.LoadSlice(lut[s*16:][:16])
+		lo = hwy.TableLookupBytes(tbl, hwy.LoadSlice(codes[s*BlockSize:][:16]))
+		hi = hwy.TableLookupBytes(tbl, hwy.LoadSlice(codes[s*BlockSize+16:][:16]))
+		acc0 = hwy.SaturatedAdd(acc0, hwy.PromoteLowerU8ToU16(lo))
+		acc1 = hwy.SaturatedAdd(acc1, hwy.PromoteUpperU8ToU16(lo))
+		acc2 = hwy.SaturatedAdd(acc2, hwy.PromoteLowerU8ToU16(hi))
+		acc3 = hwy.SaturatedAdd(acc3, hwy.PromoteUpperU8ToU16(hi))
+	}
+	hwy.StoreSlice(acc0, out[:8])
+	hwy.StoreSlice(acc1, out[8:16])
+	hwy.StoreSlice(acc2, out[16:24])
+	hwy.StoreSlice(acc3, out[24:32])
+}
@@ -0,0 +1,43 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package fastscan
+
+import (
+	"github.com/ajroetker/go-highway/hwy/asm"
+)
+
+func BaseScanBlock_neon(codes []uint8, lut []uint8, n int, out []uint16) {
+	if len(out) < BlockSize {
+		return
+	}
+	if n == 0 {
+		for j := range BlockSize {
+			out[j] = 0
+		}
+		return
+	}
+	_ = codes[n*BlockSize-1]
+	_ = lut[n*16-1]
+	tbl := asm.LoadUint8x16Slice(lut[:16])
+	lo := tbl.TableLookupBytes(asm.LoadUint8x16Slice(codes[:16]))
+	hi := tbl.TableLookupBytes(asm.LoadUint8x16Slice(codes[16:][:16]))
+	acc0 := lo.PromoteLowerToUint16()
+	acc1 := lo.PromoteUpperToUint16()
+	acc2 := hi.PromoteLowerToUint16()
+	acc3 := hi.PromoteUpperToUint16()
+	for s := 1; s < n; s++ {
+		tbl = asm.LoadUint8x16Slice(lut[s*16:][:16])
+		lo = tbl.TableLookupBytes(asm.LoadUint8x16Slice(codes[s*BlockSize:][:16]))
+		hi = tbl.TableLookupBytes(asm.LoadUint8x16Slice(codes[s*BlockSize+16:][:16]))
+		acc0 = acc0.AddSaturated(lo.PromoteLowerToUint16())
+		acc1 = acc1.AddSaturated(lo.PromoteUpperToUint16())
+		acc2 = acc2.AddSaturated(hi.PromoteLowerToUint16())
+		acc3 = acc3.AddSaturated(hi.PromoteUpperToUint16())
+	}
+	acc0.StoreSlice(out[:8])
+	acc1.StoreSlice(out[8:16])
+	acc2.StoreSlice(out[16:24])
+	acc3.StoreSlice(out[24:32])
+}
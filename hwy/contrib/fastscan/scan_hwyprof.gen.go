@@ -0,0 +1,21 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package fastscan
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("fastscan", "ScanBlock", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ScanBlock; hwyImpl != nil {
+			ScanBlock = func(codes []uint8, lut []uint8, n int, out []uint16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(codes, lut, n, out)
+				hwyCounter.Done(hwyStart, len(codes), hwy.SliceBytes(codes)+hwy.SliceBytes(lut)+hwy.SliceBytes(out))
+			}
+		}
+	})
+}
@@ -0,0 +1,32 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build !arm64 && !(amd64 && goexperiment.simd)
+
+package fastscan
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var ScanBlock func(codes []uint8, lut []uint8, n int, out []uint16)
+
+func init() {
+	initScanAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "fastscan",
+		Groups: []hwy.DispatchGroup{
+			{Name: "ScanBlock", Vars: []any{&ScanBlock}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initScanFallback},
+		},
+	})
+}
+
+func initScanAll() {
+	initScanFallback()
+}
+
+func initScanFallback() {
+	ScanBlock = BaseScanBlock_fallback
+}
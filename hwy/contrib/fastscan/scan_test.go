@@ -0,0 +1,90 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package fastscan
+
+import (
+	"math"
+	"math/rand/v2"
+	"strconv"
+	"testing"
+)
+
+// scanBlockRef is the scalar definition of ScanBlock.
+func scanBlockRef(codes, lut []uint8, n int) [BlockSize]uint16 {
+	var out [BlockSize]uint16
+	for j := range BlockSize {
+		var sum int
+		for s := range n {
+			sum += int(lut[s*16+int(codes[s*BlockSize+j])])
+		}
+		out[j] = uint16(min(sum, math.MaxUint16))
+	}
+	return out
+}
+
+func TestScanBlock(t *testing.T) {
+	rng := rand.New(rand.NewPCG(1, 1))
+	kernels := []struct {
+		name string
+		fn   func(codes, lut []uint8, n int, out []uint16)
+	}{
+		{"dispatch", ScanBlock},
+		{"fallback", BaseScanBlock_fallback},
+	}
+	// n up to 300 with entries up to 255 exercises saturation.
+	for _, n := range []int{0, 1, 2, 3, 16, 33, 257, 300} {
+		codes := make([]uint8, n*BlockSize)
+		for i := range codes {
+			codes[i] = uint8(rng.IntN(16))
+		}
+		lut := make([]uint8, n*16)
+		for i := range lut {
+			lut[i] = uint8(rng.IntN(256))
+		}
+		want := scanBlockRef(codes, lut, n)
+		for _, k := range kernels {
+			out := make([]uint16, BlockSize)
+			for j := range out {
+				out[j] = 0xdead
+			}
+			k.fn(codes, lut, n, out)
+			for j := range BlockSize {
+				if out[j] != want[j] {
+					t.Fatalf("%s n=%d vector %d: got %d, want %d", k.name, n, j, out[j], want[j])
+				}
+			}
+		}
+	}
+}
+
+func BenchmarkScanBlock(b *testing.B) {
+	for _, n := range []int{16, 64, 256} {
+		codes := make([]uint8, n*BlockSize)
+		lut := make([]uint8, n*16)
+		for i := range codes {
+			codes[i] = uint8(i % 16)
+		}
+		for i := range lut {
+			lut[i] = uint8(i % 128)
+		}
+		out := make([]uint16, BlockSize)
+		b.Run("n="+strconv.Itoa(n), func(b *testing.B) {
+			b.SetBytes(int64(len(codes)))
+			for b.Loop() {
+				ScanBlock(codes, lut, n, out)
+			}
+		})
+	}
+}
@@ -37,7 +37,9 @@ func BaseAccumulateTilesUnsigned(acc []float32, tiles []int32,
 	mTile int, nRows int) {
 
 	lanes := hwy.NumLanes[float32]()
-	fbuf := make([]float32, lanes)
+	// A vector has at most 16 float32 lanes; the constant capacity keeps
+	// fbuf on the stack.
+	fbuf := make([]float32, lanes, 16)
 
 	for row := range nRows {
 		dVec := hwy.Set[float32](dA[row])
@@ -91,7 +93,9 @@ func BaseAccumulateTilesSigned(acc []float32, tiles []int32,
 	mTile int, nRows int) {
 
 	lanes := hwy.NumLanes[float32]()
-	fbuf := make([]float32, lanes)
+	// A vector has at most 16 float32 lanes; the constant capacity keeps
+	// fbuf on the stack.
+	fbuf := make([]float32, lanes, 16)
 
 	for row := range nRows {
 		dVec := hwy.Set[float32](dA[row])
@@ -8,7 +8,7 @@ import (
 
 func BaseAccumulateTilesSigned_fallback(acc []float32, tiles []int32, sc []float32, dA []float32, mTile int, nRows int) {
 	lanes := hwy.NumLanes[float32]()
-	fbuf := make([]float32, lanes)
+	fbuf := make([]float32, lanes, 16)
 	for row := range nRows {
 		dVec := hwy.Set[float32](dA[row])
 		accRowOff := (mTile + row) * 64
@@ -37,7 +37,7 @@ func BaseAccumulateTilesSigned_fallback(acc []float32, tiles []int32, sc []float
 
 func BaseAccumulateTilesUnsigned_fallback(acc []float32, tiles []int32, sc []float32, mn []float32, dA []float32, dABsum []float32, mTile int, nRows int) {
 	lanes := hwy.NumLanes[float32]()
-	fbuf := make([]float32, lanes)
+	fbuf := make([]float32, lanes, 16)
 	for row := range nRows {
 		dVec := hwy.Set[float32](dA[row])
 		bsVec := hwy.Set[float32](dABsum[row])
@@ -13,6 +13,17 @@ var AccumulateTilesUnsigned func(acc []float32, tiles []int32, sc []float32, mn
 
 func init() {
 	initAccumulatetilesAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "AccumulateTilesSigned", Vars: []any{&AccumulateTilesSigned}},
+			{Name: "AccumulateTilesUnsigned", Vars: []any{&AccumulateTilesUnsigned}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initAccumulatetilesNEONAsm},
+			{Name: "fallback", Supported: true, Init: initAccumulatetilesFallback},
+		},
+	})
 }
 
 func initAccumulatetilesAll() {
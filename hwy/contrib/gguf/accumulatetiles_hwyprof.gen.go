@@ -0,0 +1,30 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package gguf
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("gguf", "AccumulateTilesSigned", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := AccumulateTilesSigned; hwyImpl != nil {
+			AccumulateTilesSigned = func(acc []float32, tiles []int32, sc []float32, dA []float32, mTile int, nRows int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(acc, tiles, sc, dA, mTile, nRows)
+				hwyCounter.Done(hwyStart, len(acc), hwy.SliceBytes(acc)+hwy.SliceBytes(tiles)+hwy.SliceBytes(sc)+hwy.SliceBytes(dA))
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "AccumulateTilesUnsigned", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := AccumulateTilesUnsigned; hwyImpl != nil {
+			AccumulateTilesUnsigned = func(acc []float32, tiles []int32, sc []float32, mn []float32, dA []float32, dABsum []float32, mTile int, nRows int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(acc, tiles, sc, mn, dA, dABsum, mTile, nRows)
+				hwyCounter.Done(hwyStart, len(acc), hwy.SliceBytes(acc)+hwy.SliceBytes(tiles)+hwy.SliceBytes(sc)+hwy.SliceBytes(mn)+hwy.SliceBytes(dA)+hwy.SliceBytes(dABsum))
+			}
+		}
+	})
+}
@@ -4,11 +4,25 @@
 
 package gguf
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var AccumulateTilesSigned func(acc []float32, tiles []int32, sc []float32, dA []float32, mTile int, nRows int)
 var AccumulateTilesUnsigned func(acc []float32, tiles []int32, sc []float32, mn []float32, dA []float32, dABsum []float32, mTile int, nRows int)
 
 func init() {
 	initAccumulatetilesAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "AccumulateTilesSigned", Vars: []any{&AccumulateTilesSigned}},
+			{Name: "AccumulateTilesUnsigned", Vars: []any{&AccumulateTilesUnsigned}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initAccumulatetilesFallback},
+		},
+	})
 }
 
 func initAccumulatetilesAll() {
@@ -0,0 +1,74 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package gguf
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		f32 = make([]float32, allocTestLen)
+		i32 = make([]int32, allocTestLen)
+		u8  = make([]uint8, allocTestLen)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseAccumulateTilesSigned_fallback", func() { BaseAccumulateTilesSigned_fallback(f32, i32, f32, f32, allocTestDim, allocTestDim) }},
+		{"BaseAccumulateTilesUnsigned_fallback", func() { BaseAccumulateTilesUnsigned_fallback(f32, i32, f32, f32, f32, f32, allocTestDim, allocTestDim) }},
+		{"BaseDequantizeIQ4NL_fallback", func() { BaseDequantizeIQ4NL_fallback(u8[:allocTestLen/4], f32) }},
+		{"BaseDequantizeQ2K_fallback", func() { BaseDequantizeQ2K_fallback(u8[:allocTestLen/4], f32) }},
+		{"BaseDequantizeQ3K_fallback", func() { BaseDequantizeQ3K_fallback(u8[:allocTestLen/4], f32) }},
+		{"BaseDequantizeQ4K_fallback", func() { BaseDequantizeQ4K_fallback(u8[:allocTestLen/4], f32) }},
+		{"BaseDequantizeQ4_0_fallback", func() { BaseDequantizeQ4_0_fallback(u8[:allocTestLen/4], f32) }},
+		{"BaseDequantizeQ5K_fallback", func() { BaseDequantizeQ5K_fallback(u8[:allocTestLen/4], f32) }},
+		{"BaseDequantizeQ6K_fallback", func() { BaseDequantizeQ6K_fallback(u8[:allocTestLen/4], f32) }},
+		{"BaseDequantizeQ8_0_fallback", func() { BaseDequantizeQ8_0_fallback(u8[:allocTestLen/4], f32) }},
+		{"BaseQuantizeQ8_0_fallback", func() { BaseQuantizeQ8_0_fallback(f32[:allocTestLen/4], u8) }},
+		{"BaseQuantizeQ8_K_fallback", func() { BaseQuantizeQ8_K_fallback(f32[:allocTestLen/4], u8) }},
+		{"BaseVecDotIQ4NLQ8_0_fallback", func() { BaseVecDotIQ4NLQ8_0_fallback(u8, u8, allocTestDim) }},
+		{"BaseVecDotQ4_0Q8_0_fallback", func() { BaseVecDotQ4_0Q8_0_fallback(u8, u8, allocTestDim) }},
+		{"BaseVecDotQ8_0Q8_0_fallback", func() { BaseVecDotQ8_0Q8_0_fallback(u8, u8, allocTestDim) }},
+		{"BaseVecDotQ2_KQ8_K_fallback", func() { BaseVecDotQ2_KQ8_K_fallback(u8, u8, 4) }},
+		{"BaseVecDotQ3_KQ8_K_fallback", func() { BaseVecDotQ3_KQ8_K_fallback(u8, u8, 4) }},
+		{"BaseVecDotQ4_KQ8_K_fallback", func() { BaseVecDotQ4_KQ8_K_fallback(u8, u8, 4) }},
+		{"BaseVecDotQ5_KQ8_K_fallback", func() { BaseVecDotQ5_KQ8_K_fallback(u8, u8, 4) }},
+		{"BaseVecDotQ6_KQ8_K_fallback", func() { BaseVecDotQ6_KQ8_K_fallback(u8, u8, 4) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
@@ -19,6 +19,23 @@ var DequantizeQ8_0 func(data []uint8, output []float32)
 
 func init() {
 	initGgufAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DequantizeIQ4NL", Vars: []any{&DequantizeIQ4NL}},
+			{Name: "DequantizeQ2K", Vars: []any{&DequantizeQ2K}},
+			{Name: "DequantizeQ3K", Vars: []any{&DequantizeQ3K}},
+			{Name: "DequantizeQ4K", Vars: []any{&DequantizeQ4K}},
+			{Name: "DequantizeQ4_0", Vars: []any{&DequantizeQ4_0}},
+			{Name: "DequantizeQ5K", Vars: []any{&DequantizeQ5K}},
+			{Name: "DequantizeQ6K", Vars: []any{&DequantizeQ6K}},
+			{Name: "DequantizeQ8_0", Vars: []any{&DequantizeQ8_0}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initGgufNEONAsm},
+			{Name: "fallback", Supported: true, Init: initGgufFallback},
+		},
+	})
 }
 
 func initGgufAll() {
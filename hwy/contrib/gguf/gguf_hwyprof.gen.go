@@ -0,0 +1,84 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package gguf
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("gguf", "DequantizeIQ4NL", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DequantizeIQ4NL; hwyImpl != nil {
+			DequantizeIQ4NL = func(data []uint8, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, output)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "DequantizeQ2K", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DequantizeQ2K; hwyImpl != nil {
+			DequantizeQ2K = func(data []uint8, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, output)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "DequantizeQ3K", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DequantizeQ3K; hwyImpl != nil {
+			DequantizeQ3K = func(data []uint8, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, output)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "DequantizeQ4K", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DequantizeQ4K; hwyImpl != nil {
+			DequantizeQ4K = func(data []uint8, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, output)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "DequantizeQ4_0", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DequantizeQ4_0; hwyImpl != nil {
+			DequantizeQ4_0 = func(data []uint8, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, output)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "DequantizeQ5K", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DequantizeQ5K; hwyImpl != nil {
+			DequantizeQ5K = func(data []uint8, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, output)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "DequantizeQ6K", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DequantizeQ6K; hwyImpl != nil {
+			DequantizeQ6K = func(data []uint8, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, output)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "DequantizeQ8_0", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DequantizeQ8_0; hwyImpl != nil {
+			DequantizeQ8_0 = func(data []uint8, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, output)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
@@ -14,6 +14,17 @@ var QuantizeQ8_K func(input []float32, output []uint8)
 
 func init() {
 	initGgufkqquantAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "QuantizeQ8_K", Vars: []any{&QuantizeQ8_K}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initGgufkqquantAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initGgufkqquantAVX2},
+			{Name: "fallback", Supported: true, Init: initGgufkqquantFallback},
+		},
+	})
 }
 
 func initGgufkqquantAll() {
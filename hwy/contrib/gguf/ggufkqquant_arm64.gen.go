@@ -12,6 +12,16 @@ var QuantizeQ8_K func(input []float32, output []uint8)
 
 func init() {
 	initGgufkqquantAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "QuantizeQ8_K", Vars: []any{&QuantizeQ8_K}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initGgufkqquantNEONAsm},
+			{Name: "fallback", Supported: true, Init: initGgufkqquantFallback},
+		},
+	})
 }
 
 func initGgufkqquantAll() {
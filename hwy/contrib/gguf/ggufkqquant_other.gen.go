@@ -4,10 +4,23 @@
 
 package gguf
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var QuantizeQ8_K func(input []float32, output []uint8)
 
 func init() {
 	initGgufkqquantAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "QuantizeQ8_K", Vars: []any{&QuantizeQ8_K}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initGgufkqquantFallback},
+		},
+	})
 }
 
 func initGgufkqquantAll() {
@@ -18,6 +18,21 @@ var VecDotQ6_KQ8_K func(wdata []uint8, adata []uint8, nblocks int) float32
 
 func init() {
 	initGgufkqvecdotAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "VecDotQ2_KQ8_K", Vars: []any{&VecDotQ2_KQ8_K}},
+			{Name: "VecDotQ3_KQ8_K", Vars: []any{&VecDotQ3_KQ8_K}},
+			{Name: "VecDotQ4_KQ8_K", Vars: []any{&VecDotQ4_KQ8_K}},
+			{Name: "VecDotQ5_KQ8_K", Vars: []any{&VecDotQ5_KQ8_K}},
+			{Name: "VecDotQ6_KQ8_K", Vars: []any{&VecDotQ6_KQ8_K}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initGgufkqvecdotAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initGgufkqvecdotAVX2},
+			{Name: "fallback", Supported: true, Init: initGgufkqvecdotFallback},
+		},
+	})
 }
 
 func initGgufkqvecdotAll() {
@@ -0,0 +1,62 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package gguf
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("gguf", "VecDotQ2_KQ8_K", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := VecDotQ2_KQ8_K; hwyImpl != nil {
+			VecDotQ2_KQ8_K = func(wdata []uint8, adata []uint8, nblocks int) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(wdata, adata, nblocks)
+				hwyCounter.Done(hwyStart, len(wdata), hwy.SliceBytes(wdata)+hwy.SliceBytes(adata))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "VecDotQ3_KQ8_K", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := VecDotQ3_KQ8_K; hwyImpl != nil {
+			VecDotQ3_KQ8_K = func(wdata []uint8, adata []uint8, nblocks int) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(wdata, adata, nblocks)
+				hwyCounter.Done(hwyStart, len(wdata), hwy.SliceBytes(wdata)+hwy.SliceBytes(adata))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "VecDotQ4_KQ8_K", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := VecDotQ4_KQ8_K; hwyImpl != nil {
+			VecDotQ4_KQ8_K = func(wdata []uint8, adata []uint8, nblocks int) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(wdata, adata, nblocks)
+				hwyCounter.Done(hwyStart, len(wdata), hwy.SliceBytes(wdata)+hwy.SliceBytes(adata))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "VecDotQ5_KQ8_K", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := VecDotQ5_KQ8_K; hwyImpl != nil {
+			VecDotQ5_KQ8_K = func(wdata []uint8, adata []uint8, nblocks int) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(wdata, adata, nblocks)
+				hwyCounter.Done(hwyStart, len(wdata), hwy.SliceBytes(wdata)+hwy.SliceBytes(adata))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "VecDotQ6_KQ8_K", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := VecDotQ6_KQ8_K; hwyImpl != nil {
+			VecDotQ6_KQ8_K = func(wdata []uint8, adata []uint8, nblocks int) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(wdata, adata, nblocks)
+				hwyCounter.Done(hwyStart, len(wdata), hwy.SliceBytes(wdata)+hwy.SliceBytes(adata))
+				return hwyR0
+			}
+		}
+	})
+}
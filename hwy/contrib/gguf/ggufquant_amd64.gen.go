@@ -14,6 +14,17 @@ var QuantizeQ8_0 func(input []float32, output []uint8)
 
 func init() {
 	initGgufquantAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "QuantizeQ8_0", Vars: []any{&QuantizeQ8_0}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initGgufquantAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initGgufquantAVX2},
+			{Name: "fallback", Supported: true, Init: initGgufquantFallback},
+		},
+	})
 }
 
 func initGgufquantAll() {
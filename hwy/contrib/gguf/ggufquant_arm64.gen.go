@@ -12,6 +12,16 @@ var QuantizeQ8_0 func(input []float32, output []uint8)
 
 func init() {
 	initGgufquantAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "QuantizeQ8_0", Vars: []any{&QuantizeQ8_0}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initGgufquantNEONAsm},
+			{Name: "fallback", Supported: true, Init: initGgufquantFallback},
+		},
+	})
 }
 
 func initGgufquantAll() {
@@ -0,0 +1,21 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package gguf
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("gguf", "QuantizeQ8_0", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := QuantizeQ8_0; hwyImpl != nil {
+			QuantizeQ8_0 = func(input []float32, output []uint8) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
@@ -4,10 +4,23 @@
 
 package gguf
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var QuantizeQ8_0 func(input []float32, output []uint8)
 
 func init() {
 	initGgufquantAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "QuantizeQ8_0", Vars: []any{&QuantizeQ8_0}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initGgufquantFallback},
+		},
+	})
 }
 
 func initGgufquantAll() {
@@ -16,6 +16,19 @@ var VecDotQ8_0Q8_0 func(wdata []uint8, adata []uint8, nblocks int) float32
 
 func init() {
 	initGgufvecdotAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "VecDotIQ4NLQ8_0", Vars: []any{&VecDotIQ4NLQ8_0}},
+			{Name: "VecDotQ4_0Q8_0", Vars: []any{&VecDotQ4_0Q8_0}},
+			{Name: "VecDotQ8_0Q8_0", Vars: []any{&VecDotQ8_0Q8_0}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initGgufvecdotAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initGgufvecdotAVX2},
+			{Name: "fallback", Supported: true, Init: initGgufvecdotFallback},
+		},
+	})
 }
 
 func initGgufvecdotAll() {
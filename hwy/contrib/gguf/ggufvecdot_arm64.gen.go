@@ -14,6 +14,18 @@ var VecDotQ8_0Q8_0 func(wdata []uint8, adata []uint8, nblocks int) float32
 
 func init() {
 	initGgufvecdotAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "VecDotIQ4NLQ8_0", Vars: []any{&VecDotIQ4NLQ8_0}},
+			{Name: "VecDotQ4_0Q8_0", Vars: []any{&VecDotQ4_0Q8_0}},
+			{Name: "VecDotQ8_0Q8_0", Vars: []any{&VecDotQ8_0Q8_0}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initGgufvecdotNEONAsm},
+			{Name: "fallback", Supported: true, Init: initGgufvecdotFallback},
+		},
+	})
 }
 
 func initGgufvecdotAll() {
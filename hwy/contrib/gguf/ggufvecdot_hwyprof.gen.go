@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package gguf
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("gguf", "VecDotIQ4NLQ8_0", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := VecDotIQ4NLQ8_0; hwyImpl != nil {
+			VecDotIQ4NLQ8_0 = func(wdata []uint8, adata []uint8, nblocks int) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(wdata, adata, nblocks)
+				hwyCounter.Done(hwyStart, len(wdata), hwy.SliceBytes(wdata)+hwy.SliceBytes(adata))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "VecDotQ4_0Q8_0", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := VecDotQ4_0Q8_0; hwyImpl != nil {
+			VecDotQ4_0Q8_0 = func(wdata []uint8, adata []uint8, nblocks int) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(wdata, adata, nblocks)
+				hwyCounter.Done(hwyStart, len(wdata), hwy.SliceBytes(wdata)+hwy.SliceBytes(adata))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("gguf", "VecDotQ8_0Q8_0", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := VecDotQ8_0Q8_0; hwyImpl != nil {
+			VecDotQ8_0Q8_0 = func(wdata []uint8, adata []uint8, nblocks int) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(wdata, adata, nblocks)
+				hwyCounter.Done(hwyStart, len(wdata), hwy.SliceBytes(wdata)+hwy.SliceBytes(adata))
+				return hwyR0
+			}
+		}
+	})
+}
@@ -4,12 +4,27 @@
 
 package gguf
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var VecDotIQ4NLQ8_0 func(wdata []uint8, adata []uint8, nblocks int) float32
 var VecDotQ4_0Q8_0 func(wdata []uint8, adata []uint8, nblocks int) float32
 var VecDotQ8_0Q8_0 func(wdata []uint8, adata []uint8, nblocks int) float32
 
 func init() {
 	initGgufvecdotAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "gguf",
+		Groups: []hwy.DispatchGroup{
+			{Name: "VecDotIQ4NLQ8_0", Vars: []any{&VecDotIQ4NLQ8_0}},
+			{Name: "VecDotQ4_0Q8_0", Vars: []any{&VecDotQ4_0Q8_0}},
+			{Name: "VecDotQ8_0Q8_0", Vars: []any{&VecDotQ8_0Q8_0}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initGgufvecdotFallback},
+		},
+	})
 }
 
 func initGgufvecdotAll() {
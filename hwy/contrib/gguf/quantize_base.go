@@ -39,7 +39,9 @@ func BaseQuantizeQ8_0(input []float32, output []uint8) {
 	nblocks := len(input) / QK
 
 	lanes := hwy.NumLanes[float32]()
-	buf := make([]float32, lanes)
+	// A vector has at most 16 float32 lanes; the constant capacity keeps
+	// buf on the stack.
+	buf := make([]float32, lanes, 16)
 	minVec := hwy.Set[float32](-128.0)
 	maxVec := hwy.Set[float32](127.0)
 
@@ -14,7 +14,7 @@ func BaseQuantizeQ8_K_fallback(input []float32, output []uint8) {
 	}
 	nblocks := len(input) / QK_K
 	lanes := hwy.NumLanes[float32]()
-	buf := make([]float32, lanes)
+	buf := make([]float32, lanes, 16)
 	minVec := hwy.Set[float32](-128.0)
 	maxVec := hwy.Set[float32](127.0)
 	for b := range nblocks {
@@ -0,0 +1,34 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package hamming provides batch Hamming and Jaccard distances over binary
+// embeddings packed in uint64 words, with fused top-k selection.
+//
+// Binary codes (sign-quantized embeddings, SimHash, learned hashes) are
+// usually 256, 512 or 1024 bits. At those sizes the call overhead of a
+// per-pair slice kernel dominates, so BatchHamming, BatchJaccard and
+// PushHamming score a query against many contiguous codes per call, and the
+// fallback has fully unrolled kernels for widths of 4, 8 and 16 words:
+//
+//	dist := make([]uint32, count)
+//	hamming.BatchHamming(query, codes, 8, count, dist) // 512-bit codes
+//
+//	best := hamming.TopK(query, codes, 8, count, 100)
+//
+// The kernels are generated per target: SIMD targets XOR (or AND/OR) a
+// vector of words and popcount it in-register, with VPOPCNTQ on AVX-512 CPUs
+// that have it, a VPSHUFB nibble lookup on other x86 CPUs, and CNT with
+// pairwise widening adds on NEON. The fallback uses math/bits.OnesCount64,
+// which compiles to POPCNT on amd64 and CNT on arm64.
+package hamming
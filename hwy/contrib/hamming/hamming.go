@@ -0,0 +1,160 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package hamming
+
+import (
+	"math/bits"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/topk"
+)
+
+// Distance returns the Hamming distance between two codes, the number of
+// differing bits. If the codes have different lengths, the shorter length
+// is used.
+func Distance(a, b []uint64) int {
+	n := min(len(a), len(b))
+	return int(HammingDistance(a[:n], b[:n]))
+}
+
+// hammingWords returns the Hamming distance between equal-length codes a
+// word at a time.
+func hammingWords(a, b []uint64) uint32 {
+	b = b[:len(a)]
+	var d int
+	for i := range a {
+		d += bits.OnesCount64(a[i] ^ b[i])
+	}
+	return uint32(d)
+}
+
+func hamming4(q, c *[4]uint64) uint32 {
+	return uint32(bits.OnesCount64(q[0]^c[0]) + bits.OnesCount64(q[1]^c[1]) +
+		bits.OnesCount64(q[2]^c[2]) + bits.OnesCount64(q[3]^c[3]))
+}
+
+func hamming8(q, c *[8]uint64) uint32 {
+	return hamming4((*[4]uint64)(q[:4]), (*[4]uint64)(c[:4])) +
+		hamming4((*[4]uint64)(q[4:]), (*[4]uint64)(c[4:]))
+}
+
+func hamming16(q, c *[16]uint64) uint32 {
+	return hamming8((*[8]uint64)(q[:8]), (*[8]uint64)(c[:8])) +
+		hamming8((*[8]uint64)(q[8:]), (*[8]uint64)(c[8:]))
+}
+
+// BatchHamming computes the Hamming distances from query to count codes of
+// width uint64 words each, stored contiguously in codes, writing one
+// distance per code to dist.
+//
+// On SIMD targets each code is scored with in-register vector popcounts
+// (see HammingBatch). The fallback uses fully unrolled kernels for codes of
+// 256, 512 and 1024 bits (width 4, 8 and 16).
+func BatchHamming(query, codes []uint64, width, count int, dist []uint32) {
+	if count <= 0 || width <= 0 {
+		return
+	}
+	HammingBatch(query[:width], codes[:count*width], dist[:count])
+}
+
+// Jaccard returns the Jaccard distance between two codes viewed as sets of
+// bits, 1 − |a ∧ b| / |a ∨ b|. Two empty sets are at distance 0. If the
+// codes have different lengths, the shorter length is used.
+func Jaccard(a, b []uint64) float32 {
+	n := min(len(a), len(b))
+	inter, union := AndOrCount(a[:n], b[:n])
+	return jaccard(int(inter), int(union))
+}
+
+func jaccard(inter, union int) float32 {
+	if union == 0 {
+		return 0
+	}
+	return 1 - float32(inter)/float32(union)
+}
+
+// andOrWords returns the popcounts of a AND b and a OR b for equal-length
+// codes a word at a time.
+func andOrWords(a, b []uint64) (inter, union int) {
+	b = b[:len(a)]
+	for i := range a {
+		inter += bits.OnesCount64(a[i] & b[i])
+		union += bits.OnesCount64(a[i] | b[i])
+	}
+	return inter, union
+}
+
+func andOr4(q, c *[4]uint64) (inter, union int) {
+	inter = bits.OnesCount64(q[0]&c[0]) + bits.OnesCount64(q[1]&c[1]) +
+		bits.OnesCount64(q[2]&c[2]) + bits.OnesCount64(q[3]&c[3])
+	union = bits.OnesCount64(q[0]|c[0]) + bits.OnesCount64(q[1]|c[1]) +
+		bits.OnesCount64(q[2]|c[2]) + bits.OnesCount64(q[3]|c[3])
+	return inter, union
+}
+
+func andOr8(q, c *[8]uint64) (inter, union int) {
+	i0, u0 := andOr4((*[4]uint64)(q[:4]), (*[4]uint64)(c[:4]))
+	i1, u1 := andOr4((*[4]uint64)(q[4:]), (*[4]uint64)(c[4:]))
+	return i0 + i1, u0 + u1
+}
+
+func andOr16(q, c *[16]uint64) (inter, union int) {
+	i0, u0 := andOr8((*[8]uint64)(q[:8]), (*[8]uint64)(c[:8]))
+	i1, u1 := andOr8((*[8]uint64)(q[8:]), (*[8]uint64)(c[8:]))
+	return i0 + i1, u0 + u1
+}
+
+// BatchJaccard computes the Jaccard distances from query to count codes of
+// width uint64 words each, stored contiguously in codes, writing one
+// distance per code to dist.
+//
+// Like BatchHamming, SIMD targets use vector popcounts and the fallback
+// unrolls codes of 256, 512 and 1024 bits.
+func BatchJaccard(query, codes []uint64, width, count int, dist []float32) {
+	if count <= 0 || width <= 0 {
+		return
+	}
+	JaccardBatch(query[:width], codes[:count*width], dist[:count])
+}
+
+// PushHamming offers the count codes of width words in codes to h, with
+// their Hamming distance from query as the distance and firstID+i as the
+// id of code i.
+//
+// Selection is fused with the distance computation: a code touches the heap
+// only if its distance beats the current k-th best, so no distance buffer
+// is materialized.
+func PushHamming(h *topk.Heap, query, codes []uint64, width, count int, firstID int64) {
+	if count <= 0 || width <= 0 {
+		return
+	}
+	_ = codes[count*width-1]
+	query = query[:width]
+	threshold := h.Threshold()
+	for i := range count {
+		d := float32(HammingDistance(query, codes[i*width:(i+1)*width]))
+		if d < threshold {
+			h.Push(firstID+int64(i), d)
+			threshold = h.Threshold()
+		}
+	}
+}
+
+// TopK returns the k codes nearest to query in Hamming distance, as
+// neighbors whose ID is the code's index, in order of increasing distance.
+func TopK(query, codes []uint64, width, count, k int) []topk.Neighbor {
+	h := topk.New(k)
+	PushHamming(h, query, codes, width, count, 0)
+	return h.Sorted(nil)
+}
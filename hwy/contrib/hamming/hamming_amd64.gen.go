@@ -0,0 +1,71 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package hamming
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var AndOrCount func(a []uint64, b []uint64) (inter uint32, union uint32)
+var HammingBatch func(query []uint64, codes []uint64, dist []uint32)
+var HammingDistance func(a []uint64, b []uint64) uint32
+var JaccardBatch func(query []uint64, codes []uint64, dist []float32)
+
+func init() {
+	initHammingAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "hamming",
+		Groups: []hwy.DispatchGroup{
+			{Name: "AndOrCount", Vars: []any{&AndOrCount}},
+			{Name: "HammingBatch", Vars: []any{&HammingBatch}},
+			{Name: "HammingDistance", Vars: []any{&HammingDistance}},
+			{Name: "JaccardBatch", Vars: []any{&JaccardBatch}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initHammingAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initHammingAVX2},
+			{Name: "fallback", Supported: true, Init: initHammingFallback},
+		},
+	})
+}
+
+func initHammingAll() {
+	if hwy.NoSimdEnv() {
+		initHammingFallback()
+		return
+	}
+	if archsimd.X86.AVX512() {
+		initHammingAVX512()
+		return
+	}
+	if archsimd.X86.AVX2() {
+		initHammingAVX2()
+		return
+	}
+	initHammingFallback()
+}
+
+func initHammingAVX2() {
+	AndOrCount = BaseAndOrCount_avx2
+	HammingBatch = BaseHammingBatch_avx2
+	HammingDistance = BaseHammingDistance_avx2
+	JaccardBatch = BaseJaccardBatch_avx2
+}
+
+func initHammingAVX512() {
+	AndOrCount = BaseAndOrCount_avx512
+	HammingBatch = BaseHammingBatch_avx512
+	HammingDistance = BaseHammingDistance_avx512
+	JaccardBatch = BaseJaccardBatch_avx512
+}
+
+func initHammingFallback() {
+	AndOrCount = BaseAndOrCount_fallback
+	HammingBatch = BaseHammingBatch_fallback
+	HammingDistance = BaseHammingDistance_fallback
+	JaccardBatch = BaseJaccardBatch_fallback
+}
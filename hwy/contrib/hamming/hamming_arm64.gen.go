@@ -0,0 +1,54 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package hamming
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var AndOrCount func(a []uint64, b []uint64) (inter uint32, union uint32)
+var HammingBatch func(query []uint64, codes []uint64, dist []uint32)
+var HammingDistance func(a []uint64, b []uint64) uint32
+var JaccardBatch func(query []uint64, codes []uint64, dist []float32)
+
+func init() {
+	initHammingAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "hamming",
+		Groups: []hwy.DispatchGroup{
+			{Name: "AndOrCount", Vars: []any{&AndOrCount}},
+			{Name: "HammingBatch", Vars: []any{&HammingBatch}},
+			{Name: "HammingDistance", Vars: []any{&HammingDistance}},
+			{Name: "JaccardBatch", Vars: []any{&JaccardBatch}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initHammingNEON},
+			{Name: "fallback", Supported: true, Init: initHammingFallback},
+		},
+	})
+}
+
+func initHammingAll() {
+	if hwy.NoSimdEnv() {
+		initHammingFallback()
+		return
+	}
+	initHammingNEON()
+	return
+}
+
+func initHammingNEON() {
+	AndOrCount = BaseAndOrCount_neon
+	HammingBatch = BaseHammingBatch_neon
+	HammingDistance = BaseHammingDistance_neon
+	JaccardBatch = BaseJaccardBatch_neon
+}
+
+func initHammingFallback() {
+	AndOrCount = BaseAndOrCount_fallback
+	HammingBatch = BaseHammingBatch_fallback
+	HammingDistance = BaseHammingDistance_fallback
+	JaccardBatch = BaseJaccardBatch_fallback
+}
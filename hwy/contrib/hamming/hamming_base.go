@@ -0,0 +1,221 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package hamming
+
+//go:generate go run ../../../cmd/hwygen -input hamming_base.go -output . -targets avx2,avx512,neon,fallback -dispatch hamming
+
+import (
+	"math/bits"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+// BaseHammingDistance returns the Hamming distance between the codes a and b,
+// which must have equal length.
+//
+// Each vector of words is XORed and popcounted in-register (VPOPCNTQ or a
+// VPSHUFB nibble lookup on x86, CNT on NEON) into a uint64 accumulator;
+// words past the last full vector are counted with bits.OnesCount64.
+//
+//hwy:elemtype uint64
+func BaseHammingDistance(a, b []uint64) uint32 {
+	n := len(a)
+	b = b[:n]
+	lanes := hwy.Zero[uint64]().NumLanes()
+	acc := hwy.Zero[uint64]()
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		acc = hwy.Add(acc, hwy.PopCount(hwy.Xor(hwy.Load(a[i:]), hwy.Load(b[i:]))))
+	}
+	d := uint32(hwy.ReduceSum(acc))
+	for ; i < n; i++ {
+		d += uint32(bits.OnesCount64(a[i] ^ b[i]))
+	}
+	return d
+}
+
+// BaseHammingDistanceScalar is the fallback of BaseHammingDistance.
+//
+//hwy:specializes HammingDistance
+//hwy:targets fallback
+func BaseHammingDistanceScalar(a, b []uint64) uint32 {
+	return hammingWords(a, b)
+}
+
+// BaseAndOrCount returns the popcounts of a AND b and a OR b for the codes a
+// and b, which must have equal length.
+//
+//hwy:elemtype uint64
+func BaseAndOrCount(a, b []uint64) (inter, union uint32) {
+	n := len(a)
+	b = b[:n]
+	lanes := hwy.Zero[uint64]().NumLanes()
+	accAnd := hwy.Zero[uint64]()
+	accOr := hwy.Zero[uint64]()
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		va := hwy.Load(a[i:])
+		vb := hwy.Load(b[i:])
+		accAnd = hwy.Add(accAnd, hwy.PopCount(hwy.And(va, vb)))
+		accOr = hwy.Add(accOr, hwy.PopCount(hwy.Or(va, vb)))
+	}
+	inter = uint32(hwy.ReduceSum(accAnd))
+	union = uint32(hwy.ReduceSum(accOr))
+	for ; i < n; i++ {
+		inter += uint32(bits.OnesCount64(a[i] & b[i]))
+		union += uint32(bits.OnesCount64(a[i] | b[i]))
+	}
+	return inter, union
+}
+
+// BaseAndOrCountScalar is the fallback of BaseAndOrCount.
+//
+//hwy:specializes AndOrCount
+//hwy:targets fallback
+func BaseAndOrCountScalar(a, b []uint64) (inter, union uint32) {
+	in, un := andOrWords(a, b)
+	return uint32(in), uint32(un)
+}
+
+// BaseHammingBatch writes to dist[i] the Hamming distance between query and
+// the i-th code in codes, which holds len(dist) codes of len(query) words.
+//
+// Codes whose width is a multiple of the vector width (256, 512 and 1024-bit
+// codes on every target except 256-bit codes on AVX-512) are scored without a
+// scalar tail.
+//
+//hwy:elemtype uint64
+func BaseHammingBatch(query, codes []uint64, dist []uint32) {
+	width := len(query)
+	if width == 0 || len(dist) == 0 {
+		return
+	}
+	_ = codes[len(dist)*width-1]
+	lanes := hwy.Zero[uint64]().NumLanes()
+	for c := range dist {
+		code := codes[c*width : (c+1)*width]
+		acc := hwy.Zero[uint64]()
+		var i int
+		for i = 0; i+lanes <= width; i += lanes {
+			acc = hwy.Add(acc, hwy.PopCount(hwy.Xor(hwy.Load(query[i:]), hwy.Load(code[i:]))))
+		}
+		d := uint32(hwy.ReduceSum(acc))
+		for ; i < width; i++ {
+			d += uint32(bits.OnesCount64(query[i] ^ code[i]))
+		}
+		dist[c] = d
+	}
+}
+
+// BaseHammingBatchScalar is the fallback of BaseHammingBatch. Codes of 256,
+// 512 and 1024 bits use fully unrolled kernels; bits.OnesCount64 compiles to
+// POPCNT on amd64 and CNT on arm64.
+//
+//hwy:specializes HammingBatch
+//hwy:targets fallback
+func BaseHammingBatchScalar(query, codes []uint64, dist []uint32) {
+	width := len(query)
+	if width == 0 || len(dist) == 0 {
+		return
+	}
+	_ = codes[len(dist)*width-1]
+	switch width {
+	case 4:
+		q := (*[4]uint64)(query)
+		for i := range dist {
+			dist[i] = hamming4(q, (*[4]uint64)(codes[i*4:]))
+		}
+	case 8:
+		q := (*[8]uint64)(query)
+		for i := range dist {
+			dist[i] = hamming8(q, (*[8]uint64)(codes[i*8:]))
+		}
+	case 16:
+		q := (*[16]uint64)(query)
+		for i := range dist {
+			dist[i] = hamming16(q, (*[16]uint64)(codes[i*16:]))
+		}
+	default:
+		for i := range dist {
+			dist[i] = hammingWords(query, codes[i*width:(i+1)*width])
+		}
+	}
+}
+
+// BaseJaccardBatch writes to dist[i] the Jaccard distance between query and
+// the i-th code in codes, which holds len(dist) codes of len(query) words.
+//
+//hwy:elemtype uint64
+func BaseJaccardBatch(query, codes []uint64, dist []float32) {
+	width := len(query)
+	if width == 0 || len(dist) == 0 {
+		return
+	}
+	_ = codes[len(dist)*width-1]
+	lanes := hwy.Zero[uint64]().NumLanes()
+	for c := range dist {
+		code := codes[c*width : (c+1)*width]
+		accAnd := hwy.Zero[uint64]()
+		accOr := hwy.Zero[uint64]()
+		var i int
+		for i = 0; i+lanes <= width; i += lanes {
+			vq := hwy.Load(query[i:])
+			vc := hwy.Load(code[i:])
+			accAnd = hwy.Add(accAnd, hwy.PopCount(hwy.And(vq, vc)))
+			accOr = hwy.Add(accOr, hwy.PopCount(hwy.Or(vq, vc)))
+		}
+		inter := int(hwy.ReduceSum(accAnd))
+		union := int(hwy.ReduceSum(accOr))
+		for ; i < width; i++ {
+			inter += bits.OnesCount64(query[i] & code[i])
+			union += bits.OnesCount64(query[i] | code[i])
+		}
+		dist[c] = jaccard(inter, union)
+	}
+}
+
+// BaseJaccardBatchScalar is the fallback of BaseJaccardBatch, with the same
+// unrolled 256, 512 and 1024-bit kernels as BaseHammingBatchScalar.
+//
+//hwy:specializes JaccardBatch
+//hwy:targets fallback
+func BaseJaccardBatchScalar(query, codes []uint64, dist []float32) {
+	width := len(query)
+	if width == 0 || len(dist) == 0 {
+		return
+	}
+	_ = codes[len(dist)*width-1]
+	switch width {
+	case 4:
+		q := (*[4]uint64)(query)
+		for i := range dist {
+			dist[i] = jaccard(andOr4(q, (*[4]uint64)(codes[i*4:])))
+		}
+	case 8:
+		q := (*[8]uint64)(query)
+		for i := range dist {
+			dist[i] = jaccard(andOr8(q, (*[8]uint64)(codes[i*8:])))
+		}
+	case 16:
+		q := (*[16]uint64)(query)
+		for i := range dist {
+			dist[i] = jaccard(andOr16(q, (*[16]uint64)(codes[i*16:])))
+		}
+	default:
+		for i := range dist {
+			dist[i] = jaccard(andOrWords(query, codes[i*width:(i+1)*width]))
+		}
+	}
+}
@@ -0,0 +1,106 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package hamming
+
+import (
+	"math/bits"
+	"simd/archsimd"
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func BaseAndOrCount_avx2(a []uint64, b []uint64) (inter uint32, union uint32) {
+	n := len(a)
+	b = b[:n]
+	lanes := 4
+	accAnd := archsimd.BroadcastUint64x4(0)
+	accOr := archsimd.BroadcastUint64x4(0)
+	var i int
+	for i = 0; i+lanes*2 <= n; i += lanes * 2 {
+		va := archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&a[i])))
+		vb := archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&b[i])))
+		accAnd = accAnd.Add(hwy.PopCount_AVX2_Uint64x4(va.And(vb)))
+		accOr = accOr.Add(hwy.PopCount_AVX2_Uint64x4(va.Or(vb)))
+		va1 := archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&a[i+4])))
+		vb1 := archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&b[i+4])))
+		accAnd = accAnd.Add(hwy.PopCount_AVX2_Uint64x4(va1.And(vb1)))
+		accOr = accOr.Add(hwy.PopCount_AVX2_Uint64x4(va1.Or(vb1)))
+	}
+	inter = uint32(hwy.ReduceSum_AVX2_Uint64x4(accAnd))
+	union = uint32(hwy.ReduceSum_AVX2_Uint64x4(accOr))
+	for ; i < n; i++ {
+		inter += uint32(bits.OnesCount64(a[i] & b[i]))
+		union += uint32(bits.OnesCount64(a[i] | b[i]))
+	}
+	return inter, union
+}
+
+func BaseHammingBatch_avx2(query []uint64, codes []uint64, dist []uint32) {
+	width := len(query)
+	if width == 0 || len(dist) == 0 {
+		return
+	}
+	_ = codes[len(dist)*width-1]
+	lanes := 4
+	for c := range dist {
+		code := codes[c*width : (c+1)*width]
+		acc := archsimd.BroadcastUint64x4(0)
+		var i int
+		for i = 0; i+lanes <= width; i += lanes {
+			acc = acc.Add(hwy.PopCount_AVX2_Uint64x4(archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&query[i]))).Xor(archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&code[i]))))))
+		}
+		d := uint32(hwy.ReduceSum_AVX2_Uint64x4(acc))
+		for ; i < width; i++ {
+			d += uint32(bits.OnesCount64(query[i] ^ code[i]))
+		}
+		dist[c] = d
+	}
+}
+
+func BaseHammingDistance_avx2(a []uint64, b []uint64) uint32 {
+	n := len(a)
+	b = b[:n]
+	lanes := 4
+	acc := archsimd.BroadcastUint64x4(0)
+	var i int
+	for i = 0; i+lanes*2 <= n; i += lanes * 2 {
+		acc = acc.Add(hwy.PopCount_AVX2_Uint64x4(archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&a[i]))).Xor(archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&b[i]))))))
+		acc = acc.Add(hwy.PopCount_AVX2_Uint64x4(archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&a[i+4]))).Xor(archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&b[i+4]))))))
+	}
+	d := uint32(hwy.ReduceSum_AVX2_Uint64x4(acc))
+	for ; i < n; i++ {
+		d += uint32(bits.OnesCount64(a[i] ^ b[i]))
+	}
+	return d
+}
+
+func BaseJaccardBatch_avx2(query []uint64, codes []uint64, dist []float32) {
+	width := len(query)
+	if width == 0 || len(dist) == 0 {
+		return
+	}
+	_ = codes[len(dist)*width-1]
+	lanes := 4
+	for c := range dist {
+		code := codes[c*width : (c+1)*width]
+		accAnd := archsimd.BroadcastUint64x4(0)
+		accOr := archsimd.BroadcastUint64x4(0)
+		var i int
+		for i = 0; i+lanes <= width; i += lanes {
+			vq := archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&query[i])))
+			vc := archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&code[i])))
+			accAnd = accAnd.Add(hwy.PopCount_AVX2_Uint64x4(vq.And(vc)))
+			accOr = accOr.Add(hwy.PopCount_AVX2_Uint64x4(vq.Or(vc)))
+		}
+		inter := int(hwy.ReduceSum_AVX2_Uint64x4(accAnd))
+		union := int(hwy.ReduceSum_AVX2_Uint64x4(accOr))
+		for ; i < width; i++ {
+			inter += bits.OnesCount64(query[i] & code[i])
+			union += bits.OnesCount64(query[i] | code[i])
+		}
+		dist[c] = jaccard(inter, union)
+	}
+}
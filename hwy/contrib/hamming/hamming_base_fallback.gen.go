@@ -0,0 +1,70 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package hamming
+
+func BaseAndOrCount_fallback(a []uint64, b []uint64) (inter uint32, union uint32) {
+	in, un := andOrWords(a, b)
+	return uint32(in), uint32(un)
+}
+
+func BaseHammingBatch_fallback(query []uint64, codes []uint64, dist []uint32) {
+	width := len(query)
+	if width == 0 || len(dist) == 0 {
+		return
+	}
+	_ = codes[len(dist)*width-1]
+	switch width {
+	case 4:
+		q := (*[4]uint64)(query)
+		for i := range dist {
+			dist[i] = hamming4(q, (*[4]uint64)(codes[i*4:]))
+		}
+	case 8:
+		q := (*[8]uint64)(query)
+		for i := range dist {
+			dist[i] = hamming8(q, (*[8]uint64)(codes[i*8:]))
+		}
+	case 16:
+		q := (*[16]uint64)(query)
+		for i := range dist {
+			dist[i] = hamming16(q, (*[16]uint64)(codes[i*16:]))
+		}
+	default:
+		for i := range dist {
+			dist[i] = hammingWords(query, codes[i*width:(i+1)*width])
+		}
+	}
+}
+
+func BaseHammingDistance_fallback(a []uint64, b []uint64) uint32 {
+	return hammingWords(a, b)
+}
+
+func BaseJaccardBatch_fallback(query []uint64, codes []uint64, dist []float32) {
+	width := len(query)
+	if width == 0 || len(dist) == 0 {
+		return
+	}
+	_ = codes[len(dist)*width-1]
+	switch width {
+	case 4:
+		q := (*[4]uint64)(query)
+		for i := range dist {
+			dist[i] = jaccard(andOr4(q, (*[4]uint64)(codes[i*4:])))
+		}
+	case 8:
+		q := (*[8]uint64)(query)
+		for i := range dist {
+			dist[i] = jaccard(andOr8(q, (*[8]uint64)(codes[i*8:])))
+		}
+	case 16:
+		q := (*[16]uint64)(query)
+		for i := range dist {
+			dist[i] = jaccard(andOr16(q, (*[16]uint64)(codes[i*16:])))
+		}
+	default:
+		for i := range dist {
+			dist[i] = jaccard(andOrWords(query, codes[i*width:(i+1)*width]))
+		}
+	}
+}
@@ -0,0 +1,106 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package hamming
+
+import (
+	"math/bits"
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/asm"
+)
+
+func BaseAndOrCount_neon(a []uint64, b []uint64) (inter uint32, union uint32) {
+	n := len(a)
+	b = b[:n]
+	lanes := 2
+	accAnd := asm.ZeroUint64x2()
+	accOr := asm.ZeroUint64x2()
+	var i int
+	for i = 0; i+lanes*2 <= n; i += lanes * 2 {
+		va := asm.LoadUint64x2((*[2]uint64)(unsafe.Pointer(&a[i])))
+		vb := asm.LoadUint64x2((*[2]uint64)(unsafe.Pointer(&b[i])))
+		accAnd = accAnd.Add(hwy.PopCount_NEON_Uint64x2(va.And(vb)))
+		accOr = accOr.Add(hwy.PopCount_NEON_Uint64x2(va.Or(vb)))
+		va1 := asm.LoadUint64x2((*[2]uint64)(unsafe.Pointer(&a[i+2])))
+		vb1 := asm.LoadUint64x2((*[2]uint64)(unsafe.Pointer(&b[i+2])))
+		accAnd = accAnd.Add(hwy.PopCount_NEON_Uint64x2(va1.And(vb1)))
+		accOr = accOr.Add(hwy.PopCount_NEON_Uint64x2(va1.Or(vb1)))
+	}
+	inter = uint32(accAnd.ReduceSum())
+	union = uint32(accOr.ReduceSum())
+	for ; i < n; i++ {
+		inter += uint32(bits.OnesCount64(a[i] & b[i]))
+		union += uint32(bits.OnesCount64(a[i] | b[i]))
+	}
+	return inter, union
+}
+
+func BaseHammingBatch_neon(query []uint64, codes []uint64, dist []uint32) {
+	width := len(query)
+	if width == 0 || len(dist) == 0 {
+		return
+	}
+	_ = codes[len(dist)*width-1]
+	lanes := 2
+	for c := range dist {
+		code := codes[c*width : (c+1)*width]
+		acc := asm.ZeroUint64x2()
+		var i int
+		for i = 0; i+lanes <= width; i += lanes {
+			acc = acc.Add(hwy.PopCount_NEON_Uint64x2(asm.LoadUint64x2((*[2]uint64)(unsafe.Pointer(&query[i]))).Xor(asm.LoadUint64x2((*[2]uint64)(unsafe.Pointer(&code[i]))))))
+		}
+		d := uint32(acc.ReduceSum())
+		for ; i < width; i++ {
+			d += uint32(bits.OnesCount64(query[i] ^ code[i]))
+		}
+		dist[c] = d
+	}
+}
+
+func BaseHammingDistance_neon(a []uint64, b []uint64) uint32 {
+	n := len(a)
+	b = b[:n]
+	lanes := 2
+	acc := asm.ZeroUint64x2()
+	var i int
+	for i = 0; i+lanes*2 <= n; i += lanes * 2 {
+		acc = acc.Add(hwy.PopCount_NEON_Uint64x2(asm.LoadUint64x2((*[2]uint64)(unsafe.Pointer(&a[i]))).Xor(asm.LoadUint64x2((*[2]uint64)(unsafe.Pointer(&b[i]))))))
+		acc = acc.Add(hwy.PopCount_NEON_Uint64x2(asm.LoadUint64x2((*[2]uint64)(unsafe.Pointer(&a[i+2]))).Xor(asm.LoadUint64x2((*[2]uint64)(unsafe.Pointer(&b[i+2]))))))
+	}
+	d := uint32(acc.ReduceSum())
+	for ; i < n; i++ {
+		d += uint32(bits.OnesCount64(a[i] ^ b[i]))
+	}
+	return d
+}
+
+func BaseJaccardBatch_neon(query []uint64, codes []uint64, dist []float32) {
+	width := len(query)
+	if width == 0 || len(dist) == 0 {
+		return
+	}
+	_ = codes[len(dist)*width-1]
+	lanes := 2
+	for c := range dist {
+		code := codes[c*width : (c+1)*width]
+		accAnd := asm.ZeroUint64x2()
+		accOr := asm.ZeroUint64x2()
+		var i int
+		for i = 0; i+lanes <= width; i += lanes {
+			vq := asm.LoadUint64x2((*[2]uint64)(unsafe.Pointer(&query[i])))
+			vc := asm.LoadUint64x2((*[2]uint64)(unsafe.Pointer(&code[i])))
+			accAnd = accAnd.Add(hwy.PopCount_NEON_Uint64x2(vq.And(vc)))
+			accOr = accOr.Add(hwy.PopCount_NEON_Uint64x2(vq.Or(vc)))
+		}
+		inter := int(accAnd.ReduceSum())
+		union := int(accOr.ReduceSum())
+		for ; i < width; i++ {
+			inter += bits.OnesCount64(query[i] & code[i])
+			union += bits.OnesCount64(query[i] | code[i])
+		}
+		dist[c] = jaccard(inter, union)
+	}
+}
@@ -0,0 +1,50 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package hamming
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("hamming", "AndOrCount", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := AndOrCount; hwyImpl != nil {
+			AndOrCount = func(a []uint64, b []uint64) (inter uint32, union uint32) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+	hwy.ProfileDispatch("hamming", "HammingBatch", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := HammingBatch; hwyImpl != nil {
+			HammingBatch = func(query []uint64, codes []uint64, dist []uint32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, codes, dist)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(codes)+hwy.SliceBytes(dist))
+			}
+		}
+	})
+	hwy.ProfileDispatch("hamming", "HammingDistance", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := HammingDistance; hwyImpl != nil {
+			HammingDistance = func(a []uint64, b []uint64) uint32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("hamming", "JaccardBatch", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := JaccardBatch; hwyImpl != nil {
+			JaccardBatch = func(query []uint64, codes []uint64, dist []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, codes, dist)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(codes)+hwy.SliceBytes(dist))
+			}
+		}
+	})
+}
@@ -0,0 +1,130 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package hamming
+
+import (
+	"math/bits"
+	"math/rand/v2"
+	"slices"
+	"strconv"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/topk"
+)
+
+var widths = []int{1, 3, 4, 5, 8, 16, 17, 32, 40}
+
+func randomCodes(rng *rand.Rand, n int) []uint64 {
+	c := make([]uint64, n)
+	for i := range c {
+		// Sparse words exercise the Jaccard union/intersection split.
+		c[i] = rng.Uint64() & rng.Uint64()
+	}
+	return c
+}
+
+func refHamming(a, b []uint64) uint32 {
+	var d int
+	for i := range a {
+		d += bits.OnesCount64(a[i] ^ b[i])
+	}
+	return uint32(d)
+}
+
+func refJaccard(a, b []uint64) float32 {
+	var inter, union int
+	for i := range a {
+		inter += bits.OnesCount64(a[i] & b[i])
+		union += bits.OnesCount64(a[i] | b[i])
+	}
+	if union == 0 {
+		return 0
+	}
+	return 1 - float32(inter)/float32(union)
+}
+
+func TestBatchHamming(t *testing.T) {
+	rng := rand.New(rand.NewPCG(1, 1))
+	const count = 37
+	for _, w := range widths {
+		query := randomCodes(rng, w)
+		codes := randomCodes(rng, count*w)
+		dist := make([]uint32, count)
+		jac := make([]float32, count)
+		BatchHamming(query, codes, w, count, dist)
+		BatchJaccard(query, codes, w, count, jac)
+		for i := range count {
+			code := codes[i*w : (i+1)*w]
+			if want := refHamming(query, code); dist[i] != want || Distance(query, code) != int(want) {
+				t.Fatalf("width=%d code %d: Hamming %d, want %d", w, i, dist[i], want)
+			}
+			if want := refJaccard(query, code); jac[i] != want || Jaccard(query, code) != want {
+				t.Fatalf("width=%d code %d: Jaccard %v, want %v", w, i, jac[i], want)
+			}
+		}
+	}
+}
+
+func TestJaccardEmpty(t *testing.T) {
+	zero := make([]uint64, 4)
+	if d := Jaccard(zero, zero); d != 0 {
+		t.Errorf("Jaccard(empty, empty) = %v, want 0", d)
+	}
+	if d := Jaccard(zero, []uint64{1, 0, 0, 0}); d != 1 {
+		t.Errorf("Jaccard(empty, {0}) = %v, want 1", d)
+	}
+}
+
+func TestTopK(t *testing.T) {
+	rng := rand.New(rand.NewPCG(2, 1))
+	const count, k = 2000, 25
+	for _, w := range widths {
+		query := randomCodes(rng, w)
+		codes := randomCodes(rng, count*w)
+		got := TopK(query, codes, w, count, k)
+
+		h := topk.New(k)
+		for i := range count {
+			h.Push(int64(i), float32(refHamming(query, codes[i*w:(i+1)*w])))
+		}
+		if want := h.Sorted(nil); !slices.Equal(got, want) {
+			t.Fatalf("width=%d: TopK = %v, want %v", w, got, want)
+		}
+	}
+}
+
+func BenchmarkBatchHamming(b *testing.B) {
+	const count = 1 << 14
+	rng := rand.New(rand.NewPCG(1, 1))
+	dist := make([]uint32, count)
+	for _, w := range []int{4, 8, 16} {
+		query := randomCodes(rng, w)
+		codes := randomCodes(rng, count*w)
+		b.Run("Batch/bits="+strconv.Itoa(w*64), func(b *testing.B) {
+			b.SetBytes(int64(count * w * 8))
+			for i := 0; i < b.N; i++ {
+				BatchHamming(query, codes, w, count, dist)
+			}
+		})
+		b.Run("PerPair/bits="+strconv.Itoa(w*64), func(b *testing.B) {
+			b.SetBytes(int64(count * w * 8))
+			for i := 0; i < b.N; i++ {
+				for j := range count {
+					dist[j] = uint32(refHamming(query, codes[j*w:(j+1)*w]))
+				}
+			}
+		})
+	}
+}
@@ -107,6 +107,19 @@ func InverseRCT[T hwy.SignedInts](y *Image[T], cb *Image[T], cr *Image[T], outR
 
 func init() {
 	initColorAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "image",
+		Groups: []hwy.DispatchGroup{
+			{Name: "ForwardICT", Vars: []any{&ForwardICTFloat16, &ForwardICTBFloat16, &ForwardICTFloat32, &ForwardICTFloat64}},
+			{Name: "ForwardRCT", Vars: []any{&ForwardRCTInt32, &ForwardRCTInt64}},
+			{Name: "InverseICT", Vars: []any{&InverseICTFloat16, &InverseICTBFloat16, &InverseICTFloat32, &InverseICTFloat64}},
+			{Name: "InverseRCT", Vars: []any{&InverseRCTInt32, &InverseRCTInt64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initColorNEONAsm},
+			{Name: "fallback", Supported: true, Init: initColorFallback},
+		},
+	})
 }
 
 func initColorAll() {
@@ -0,0 +1,104 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package image
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("image", "ForwardICT", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ForwardICTFloat16; hwyImpl != nil {
+			ForwardICTFloat16 = func(r *Image[hwy.Float16], g *Image[hwy.Float16], b *Image[hwy.Float16], outY *Image[hwy.Float16], outCb *Image[hwy.Float16], outCr *Image[hwy.Float16]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(r, g, b, outY, outCb, outCr)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ForwardICTBFloat16; hwyImpl != nil {
+			ForwardICTBFloat16 = func(r *Image[hwy.BFloat16], g *Image[hwy.BFloat16], b *Image[hwy.BFloat16], outY *Image[hwy.BFloat16], outCb *Image[hwy.BFloat16], outCr *Image[hwy.BFloat16]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(r, g, b, outY, outCb, outCr)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ForwardICTFloat32; hwyImpl != nil {
+			ForwardICTFloat32 = func(r *Image[float32], g *Image[float32], b *Image[float32], outY *Image[float32], outCb *Image[float32], outCr *Image[float32]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(r, g, b, outY, outCb, outCr)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ForwardICTFloat64; hwyImpl != nil {
+			ForwardICTFloat64 = func(r *Image[float64], g *Image[float64], b *Image[float64], outY *Image[float64], outCb *Image[float64], outCr *Image[float64]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(r, g, b, outY, outCb, outCr)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "ForwardRCT", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ForwardRCTInt32; hwyImpl != nil {
+			ForwardRCTInt32 = func(r *Image[int32], g *Image[int32], b *Image[int32], outY *Image[int32], outCb *Image[int32], outCr *Image[int32]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(r, g, b, outY, outCb, outCr)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ForwardRCTInt64; hwyImpl != nil {
+			ForwardRCTInt64 = func(r *Image[int64], g *Image[int64], b *Image[int64], outY *Image[int64], outCb *Image[int64], outCr *Image[int64]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(r, g, b, outY, outCb, outCr)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "InverseICT", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := InverseICTFloat16; hwyImpl != nil {
+			InverseICTFloat16 = func(y *Image[hwy.Float16], cb *Image[hwy.Float16], cr *Image[hwy.Float16], outR *Image[hwy.Float16], outG *Image[hwy.Float16], outB *Image[hwy.Float16]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(y, cb, cr, outR, outG, outB)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := InverseICTBFloat16; hwyImpl != nil {
+			InverseICTBFloat16 = func(y *Image[hwy.BFloat16], cb *Image[hwy.BFloat16], cr *Image[hwy.BFloat16], outR *Image[hwy.BFloat16], outG *Image[hwy.BFloat16], outB *Image[hwy.BFloat16]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(y, cb, cr, outR, outG, outB)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := InverseICTFloat32; hwyImpl != nil {
+			InverseICTFloat32 = func(y *Image[float32], cb *Image[float32], cr *Image[float32], outR *Image[float32], outG *Image[float32], outB *Image[float32]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(y, cb, cr, outR, outG, outB)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := InverseICTFloat64; hwyImpl != nil {
+			InverseICTFloat64 = func(y *Image[float64], cb *Image[float64], cr *Image[float64], outR *Image[float64], outG *Image[float64], outB *Image[float64]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(y, cb, cr, outR, outG, outB)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "InverseRCT", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := InverseRCTInt32; hwyImpl != nil {
+			InverseRCTInt32 = func(y *Image[int32], cb *Image[int32], cr *Image[int32], outR *Image[int32], outG *Image[int32], outB *Image[int32]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(y, cb, cr, outR, outG, outB)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := InverseRCTInt64; hwyImpl != nil {
+			InverseRCTInt64 = func(y *Image[int64], cb *Image[int64], cr *Image[int64], outR *Image[int64], outG *Image[int64], outB *Image[int64]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(y, cb, cr, outR, outG, outB)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+}
@@ -0,0 +1,269 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package image
+
+import (
+	"math"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// MinParallelConvolvePixels is the minimum image size, in pixels, before a
+// filter is split into row bands across the worker pool.
+const MinParallelConvolvePixels = 16384
+
+// BorderMode selects how filters extend the image past its edges.
+type BorderMode int
+
+const (
+	// BorderMirror reflects at the edges, repeating the edge pixel (see Mirror).
+	BorderMirror BorderMode = iota
+	// BorderClamp repeats the edge pixel (see Clamp).
+	BorderClamp
+	// BorderWrap tiles the image (see Wrap).
+	BorderWrap
+)
+
+// index maps a possibly out-of-range coordinate into [0, size).
+func (m BorderMode) index(i, size int) int {
+	switch m {
+	case BorderClamp:
+		return Clamp(i, size)
+	case BorderWrap:
+		return Wrap(i, size)
+	default:
+		return Mirror(i, size)
+	}
+}
+
+// Filters compute a correlation: the kernel is not flipped, and a kernel of
+// n taps is centred on tap n/2. Each works on row bands; within a band,
+// source rows enter a ring buffer once, border-extended and (for separable
+// filters) already filtered horizontally, and every output row is produced
+// from the ring. dst must not alias src. Nil images or images of different
+// sizes are ignored.
+
+// SeparableConvolve filters src with kernelX along rows and kernelY along
+// columns and writes the result to dst.
+func SeparableConvolve[T hwy.FloatsNative](pool workerpool.Executor, src, dst *Image[T], kernelX, kernelY []T, border BorderMode) {
+	if !filterable(src, dst) || len(kernelX) == 0 || len(kernelY) == 0 {
+		return
+	}
+	width, height := src.width, src.height
+	kx, ky := len(kernelX), len(kernelY)
+	forRowBands(pool, width, height, func(y0, y1 int) {
+		pad := make([]T, width+kx-1)
+		ring := make([]T, ky*width)
+		load := func(v int) {
+			padRow(pad, src.Row(border.index(v, height)), width, kx/2, border)
+			ConvolveRow(pad, kernelX, ring[ringSlot(v, ky)*width:], width)
+		}
+		top := ky / 2
+		for v := y0 - top; v < y0-top+ky-1; v++ {
+			load(v)
+		}
+		for y := y0; y < y1; y++ {
+			load(y - top + ky - 1)
+			ConvolveVertical(ring, width, ringSlot(y-top, ky), kernelY, dst.Row(y), width)
+		}
+	})
+}
+
+// Convolve2D filters src with a kw-column kernel stored row-major in kernel
+// and writes the result to dst. Prefer SeparableConvolve when the kernel is
+// separable.
+func Convolve2D[T hwy.FloatsNative](pool workerpool.Executor, src, dst *Image[T], kernel []T, kw int, border BorderMode) {
+	if !filterable(src, dst) || kw <= 0 || len(kernel) < kw {
+		return
+	}
+	width, height := src.width, src.height
+	kh := len(kernel) / kw
+	kernel = kernel[:kh*kw]
+	rowLen := width + kw - 1
+	forRowBands(pool, width, height, func(y0, y1 int) {
+		ring := make([]T, kh*rowLen)
+		load := func(v int) {
+			slot := ringSlot(v, kh) * rowLen
+			padRow(ring[slot:slot+rowLen], src.Row(border.index(v, height)), width, kw/2, border)
+		}
+		top := kh / 2
+		for v := y0 - top; v < y0-top+kh-1; v++ {
+			load(v)
+		}
+		for y := y0; y < y1; y++ {
+			load(y - top + kh - 1)
+			Convolve2DRow(ring, rowLen, ringSlot(y-top, kh), kernel, kw, dst.Row(y), width)
+		}
+	})
+}
+
+// GaussianKernel returns a normalized Gaussian kernel with standard
+// deviation sigma, truncated at 3 sigma. sigma <= 0 yields the identity.
+func GaussianKernel[T hwy.FloatsNative](sigma float64) []T {
+	if sigma <= 0 {
+		return []T{1}
+	}
+	radius := int(math.Ceil(3 * sigma))
+	weights := make([]float64, 2*radius+1)
+	var sum float64
+	for i := range weights {
+		d := float64(i - radius)
+		weights[i] = math.Exp(-d * d / (2 * sigma * sigma))
+		sum += weights[i]
+	}
+	kernel := make([]T, len(weights))
+	for i, w := range weights {
+		kernel[i] = T(w / sum)
+	}
+	return kernel
+}
+
+// GaussianBlur blurs src with a Gaussian of standard deviation sigma and
+// writes the result to dst. For large sigma, BoxBlur is cheaper.
+func GaussianBlur[T hwy.FloatsNative](pool workerpool.Executor, src, dst *Image[T], sigma float64, border BorderMode) {
+	kernel := GaussianKernel[T](sigma)
+	SeparableConvolve(pool, src, dst, kernel, kernel, border)
+}
+
+// BoxBlur averages each (2*radius+1)-square neighbourhood of src into dst.
+// Horizontal and vertical running sums make the cost independent of the
+// radius; applying it three times approximates a Gaussian blur.
+func BoxBlur[T hwy.FloatsNative](pool workerpool.Executor, src, dst *Image[T], radius int, border BorderMode) {
+	if !filterable(src, dst) || radius < 0 {
+		return
+	}
+	width, height := src.width, src.height
+	taps := 2*radius + 1
+	scale := T(1) / T(taps*taps)
+	// The ring keeps one row more than the window so the row leaving the
+	// window is still available when the next one enters.
+	slots := taps + 1
+	forRowBands(pool, width, height, func(y0, y1 int) {
+		pad := make([]T, width+taps-1)
+		ring := make([]T, slots*width)
+		sum := make([]T, width)
+		load := func(v int) []T {
+			row := ring[ringSlot(v, slots)*width:][:width]
+			padRow(pad, src.Row(border.index(v, height)), width, radius, border)
+			boxRow(pad, row, taps)
+			return row
+		}
+		// Start one row above the band's first window: the first SlideSum
+		// then adds row y0+radius and drops row y0-radius-1.
+		for v := y0 - radius - 1; v < y0+radius; v++ {
+			for x, s := range load(v) {
+				sum[x] += s
+			}
+		}
+		for y := y0; y < y1; y++ {
+			add := load(y + radius)
+			sub := ring[ringSlot(y-radius-1, slots)*width:][:width]
+			SlideSum(sum, add, sub, dst.Row(y), scale, width)
+		}
+	})
+}
+
+// Sobel computes the horizontal (gx) and vertical (gy) 3x3 Sobel derivatives
+// of src. gx is positive where intensity increases to the right, gy where it
+// increases downwards.
+func Sobel[T hwy.FloatsNative](pool workerpool.Executor, src, gx, gy *Image[T], border BorderMode) {
+	if !filterable(src, gx) || !filterable(src, gy) {
+		return
+	}
+	width, height := src.width, src.height
+	rowLen := width + 2
+	forRowBands(pool, width, height, func(y0, y1 int) {
+		ring := make([]T, 3*rowLen)
+		load := func(v int) {
+			slot := ringSlot(v, 3) * rowLen
+			padRow(ring[slot:slot+rowLen], src.Row(border.index(v, height)), width, 1, border)
+		}
+		load(y0 - 1)
+		load(y0)
+		for y := y0; y < y1; y++ {
+			load(y + 1)
+			above := ring[ringSlot(y-1, 3)*rowLen:]
+			mid := ring[ringSlot(y, 3)*rowLen:]
+			below := ring[ringSlot(y+1, 3)*rowLen:]
+			SobelRow(above, mid, below, gx.Row(y), gy.Row(y), width)
+		}
+	})
+}
+
+// GradientMagnitude writes sqrt(gx^2 + gy^2) to dst, e.g. for the outputs
+// of Sobel.
+func GradientMagnitude[T hwy.FloatsNative](pool workerpool.Executor, gx, gy, dst *Image[T]) {
+	if !filterable(gx, gy) || !filterable(gx, dst) {
+		return
+	}
+	forRowBands(pool, gx.width, gx.height, func(y0, y1 int) {
+		for y := y0; y < y1; y++ {
+			GradientMagnitudeRow(gx.Row(y), gy.Row(y), dst.Row(y), gx.width)
+		}
+	})
+}
+
+// filterable reports whether a filter can read src and write dst.
+func filterable[T hwy.Lanes](src, dst *Image[T]) bool {
+	return src != nil && dst != nil && src.data != nil && dst.data != nil && SameSize(src, dst)
+}
+
+// forRowBands runs fn over contiguous bands of rows covering [0, height),
+// one per worker, or over all rows on the calling goroutine when pool is
+// nil or the image has fewer than MinParallelConvolvePixels pixels.
+func forRowBands(pool workerpool.Executor, width, height int, fn func(y0, y1 int)) {
+	if pool == nil || width*height < MinParallelConvolvePixels {
+		fn(0, height)
+		return
+	}
+	pool.ParallelFor(height, fn)
+}
+
+// ringSlot returns the ring buffer slot of virtual row v, which may be
+// negative near the top border.
+func ringSlot(v, slots int) int {
+	s := v % slots
+	if s < 0 {
+		s += slots
+	}
+	return s
+}
+
+// padRow copies the first width samples of row into pad, preceded by left
+// and followed by len(pad)-width-left samples extended by border.
+func padRow[T hwy.Lanes](pad, row []T, width, left int, border BorderMode) {
+	copy(pad[left:left+width], row[:width])
+	for i := range left {
+		pad[i] = row[border.index(i-left, width)]
+	}
+	for i := left + width; i < len(pad); i++ {
+		pad[i] = row[border.index(i-left, width)]
+	}
+}
+
+// boxRow writes the sums of each taps-wide window of pad to dst using a
+// running sum.
+func boxRow[T hwy.FloatsNative](pad, dst []T, taps int) {
+	var s T
+	for _, v := range pad[:taps] {
+		s += v
+	}
+	dst[0] = s
+	for x := 1; x < len(dst); x++ {
+		s += pad[x+taps-1] - pad[x-1]
+		dst[x] = s
+	}
+}
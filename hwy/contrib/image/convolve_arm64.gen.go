@@ -0,0 +1,162 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package image
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var Convolve2DRowFloat32 func(ring []float32, rowLen int, first int, kernel []float32, kw int, dst []float32, width int)
+var Convolve2DRowFloat64 func(ring []float64, rowLen int, first int, kernel []float64, kw int, dst []float64, width int)
+var ConvolveRowFloat32 func(src []float32, kernel []float32, dst []float32, width int)
+var ConvolveRowFloat64 func(src []float64, kernel []float64, dst []float64, width int)
+var ConvolveVerticalFloat32 func(ring []float32, rowLen int, first int, kernel []float32, dst []float32, width int)
+var ConvolveVerticalFloat64 func(ring []float64, rowLen int, first int, kernel []float64, dst []float64, width int)
+var GradientMagnitudeRowFloat32 func(gx []float32, gy []float32, dst []float32, width int)
+var GradientMagnitudeRowFloat64 func(gx []float64, gy []float64, dst []float64, width int)
+var SlideSumFloat32 func(sum []float32, add []float32, sub []float32, dst []float32, scale float32, width int)
+var SlideSumFloat64 func(sum []float64, add []float64, sub []float64, dst []float64, scale float64, width int)
+var SobelRowFloat32 func(above []float32, mid []float32, below []float32, gx []float32, gy []float32, width int)
+var SobelRowFloat64 func(above []float64, mid []float64, below []float64, gx []float64, gy []float64, width int)
+
+// Convolve2DRow computes one output row of a 2D convolution with a
+// kw-column kernel stored row-major in kernel. ring holds len(kernel)/kw
+// padded source rows; kernel row ky is applied to slot (first+ky) mod
+// len(kernel)/kw.
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+func Convolve2DRow[T hwy.FloatsNative](ring []T, rowLen int, first int, kernel []T, kw int, dst []T, width int) {
+	switch any(ring).(type) {
+	case []float32:
+		Convolve2DRowFloat32(any(ring).([]float32), rowLen, first, any(kernel).([]float32), kw, any(dst).([]float32), width)
+	case []float64:
+		Convolve2DRowFloat64(any(ring).([]float64), rowLen, first, any(kernel).([]float64), kw, any(dst).([]float64), width)
+	}
+}
+
+// ConvolveRow applies a 1D horizontal kernel to a padded row:
+// dst[x] = sum(kernel[k] * src[x+k]) for x in [0, width).
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+func ConvolveRow[T hwy.FloatsNative](src []T, kernel []T, dst []T, width int) {
+	switch any(src).(type) {
+	case []float32:
+		ConvolveRowFloat32(any(src).([]float32), any(kernel).([]float32), any(dst).([]float32), width)
+	case []float64:
+		ConvolveRowFloat64(any(src).([]float64), any(kernel).([]float64), any(dst).([]float64), width)
+	}
+}
+
+// ConvolveVertical applies a 1D vertical kernel across the rows of a
+// ring buffer of len(kernel) rows: dst[x] = sum(kernel[k] * row_k[x]), where
+// row_k is ring slot (first+k) mod len(kernel).
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+func ConvolveVertical[T hwy.FloatsNative](ring []T, rowLen int, first int, kernel []T, dst []T, width int) {
+	switch any(ring).(type) {
+	case []float32:
+		ConvolveVerticalFloat32(any(ring).([]float32), rowLen, first, any(kernel).([]float32), any(dst).([]float32), width)
+	case []float64:
+		ConvolveVerticalFloat64(any(ring).([]float64), rowLen, first, any(kernel).([]float64), any(dst).([]float64), width)
+	}
+}
+
+// GradientMagnitudeRow computes dst = sqrt(gx*gx + gy*gy).
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+func GradientMagnitudeRow[T hwy.FloatsNative](gx []T, gy []T, dst []T, width int) {
+	switch any(gx).(type) {
+	case []float32:
+		GradientMagnitudeRowFloat32(any(gx).([]float32), any(gy).([]float32), any(dst).([]float32), width)
+	case []float64:
+		GradientMagnitudeRowFloat64(any(gx).([]float64), any(gy).([]float64), any(dst).([]float64), width)
+	}
+}
+
+// SlideSum advances a running column sum by one row and writes the
+// scaled result: sum += add - sub; dst = sum * scale.
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+func SlideSum[T hwy.FloatsNative](sum []T, add []T, sub []T, dst []T, scale T, width int) {
+	switch any(sum).(type) {
+	case []float32:
+		SlideSumFloat32(any(sum).([]float32), any(add).([]float32), any(sub).([]float32), any(dst).([]float32), any(scale).(float32), width)
+	case []float64:
+		SlideSumFloat64(any(sum).([]float64), any(add).([]float64), any(sub).([]float64), any(dst).([]float64), any(scale).(float64), width)
+	}
+}
+
+// SobelRow computes the 3x3 Sobel derivatives of one output row from
+// three padded source rows (above, mid, below):
+//
+//	gx = [-1 0 1; -2 0 2; -1 0 1],  gy = [-1 -2 -1; 0 0 0; 1 2 1]
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+func SobelRow[T hwy.FloatsNative](above []T, mid []T, below []T, gx []T, gy []T, width int) {
+	switch any(above).(type) {
+	case []float32:
+		SobelRowFloat32(any(above).([]float32), any(mid).([]float32), any(below).([]float32), any(gx).([]float32), any(gy).([]float32), width)
+	case []float64:
+		SobelRowFloat64(any(above).([]float64), any(mid).([]float64), any(below).([]float64), any(gx).([]float64), any(gy).([]float64), width)
+	}
+}
+
+func init() {
+	initConvolveAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "image",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Convolve2DRow", Vars: []any{&Convolve2DRowFloat32, &Convolve2DRowFloat64}},
+			{Name: "ConvolveRow", Vars: []any{&ConvolveRowFloat32, &ConvolveRowFloat64}},
+			{Name: "ConvolveVertical", Vars: []any{&ConvolveVerticalFloat32, &ConvolveVerticalFloat64}},
+			{Name: "GradientMagnitudeRow", Vars: []any{&GradientMagnitudeRowFloat32, &GradientMagnitudeRowFloat64}},
+			{Name: "SlideSum", Vars: []any{&SlideSumFloat32, &SlideSumFloat64}},
+			{Name: "SobelRow", Vars: []any{&SobelRowFloat32, &SobelRowFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initConvolveNEON},
+			{Name: "fallback", Supported: true, Init: initConvolveFallback},
+		},
+	})
+}
+
+func initConvolveAll() {
+	if hwy.NoSimdEnv() {
+		initConvolveFallback()
+		return
+	}
+	initConvolveNEON()
+	return
+}
+
+func initConvolveNEON() {
+	Convolve2DRowFloat32 = BaseConvolve2DRow_neon
+	Convolve2DRowFloat64 = BaseConvolve2DRow_neon_Float64
+	ConvolveRowFloat32 = BaseConvolveRow_neon
+	ConvolveRowFloat64 = BaseConvolveRow_neon_Float64
+	ConvolveVerticalFloat32 = BaseConvolveVertical_neon
+	ConvolveVerticalFloat64 = BaseConvolveVertical_neon_Float64
+	GradientMagnitudeRowFloat32 = BaseGradientMagnitudeRow_neon
+	GradientMagnitudeRowFloat64 = BaseGradientMagnitudeRow_neon_Float64
+	SlideSumFloat32 = BaseSlideSum_neon
+	SlideSumFloat64 = BaseSlideSum_neon_Float64
+	SobelRowFloat32 = BaseSobelRow_neon
+	SobelRowFloat64 = BaseSobelRow_neon_Float64
+}
+
+func initConvolveFallback() {
+	Convolve2DRowFloat32 = BaseConvolve2DRow_fallback
+	Convolve2DRowFloat64 = BaseConvolve2DRow_fallback_Float64
+	ConvolveRowFloat32 = BaseConvolveRow_fallback
+	ConvolveRowFloat64 = BaseConvolveRow_fallback_Float64
+	ConvolveVerticalFloat32 = BaseConvolveVertical_fallback
+	ConvolveVerticalFloat64 = BaseConvolveVertical_fallback_Float64
+	GradientMagnitudeRowFloat32 = BaseGradientMagnitudeRow_fallback
+	GradientMagnitudeRowFloat64 = BaseGradientMagnitudeRow_fallback_Float64
+	SlideSumFloat32 = BaseSlideSum_fallback
+	SlideSumFloat64 = BaseSlideSum_fallback_Float64
+	SobelRowFloat32 = BaseSobelRow_fallback
+	SobelRowFloat64 = BaseSobelRow_fallback_Float64
+}
@@ -0,0 +1,210 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package image
+
+import (
+	stdmath "math"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+//go:generate go run ../../../cmd/hwygen -input convolve_base.go -output . -targets avx2,avx512,neon,fallback -dispatch convolve
+
+// The row kernels below read border-extended rows: a padded row for an
+// output of `width` pixels and a kernel of `taps` columns holds
+// width+taps-1 samples, so output pixel x sees padded[x : x+taps]. Rows of
+// a ring buffer are stored back to back, rowLen elements apart.
+
+// BaseConvolveRow applies a 1D horizontal kernel to a padded row:
+// dst[x] = sum(kernel[k] * src[x+k]) for x in [0, width).
+func BaseConvolveRow[T hwy.FloatsNative](src, kernel, dst []T, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	lanes := hwy.MaxLanes[T]()
+
+	x := 0
+	for ; x+lanes <= width; x += lanes {
+		acc := hwy.Zero[T]()
+		for k := 0; k < taps; k++ {
+			acc = hwy.MulAdd(hwy.Set(kernel[k]), hwy.Load(src[x+k:]), acc)
+		}
+		hwy.Store(acc, dst[x:])
+	}
+	for ; x < width; x++ {
+		var sum T
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * src[x+k]
+		}
+		dst[x] = sum
+	}
+}
+
+// BaseConvolveVertical applies a 1D vertical kernel across the rows of a
+// ring buffer of len(kernel) rows: dst[x] = sum(kernel[k] * row_k[x]), where
+// row_k is ring slot (first+k) mod len(kernel).
+func BaseConvolveVertical[T hwy.FloatsNative](ring []T, rowLen, first int, kernel, dst []T, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	lanes := hwy.MaxLanes[T]()
+
+	x := 0
+	for ; x+lanes <= width; x += lanes {
+		acc := hwy.Zero[T]()
+		slot := first
+		for k := 0; k < taps; k++ {
+			acc = hwy.MulAdd(hwy.Set(kernel[k]), hwy.Load(ring[slot*rowLen+x:]), acc)
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		hwy.Store(acc, dst[x:])
+	}
+	for ; x < width; x++ {
+		var sum T
+		slot := first
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * ring[slot*rowLen+x]
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+// BaseConvolve2DRow computes one output row of a 2D convolution with a
+// kw-column kernel stored row-major in kernel. ring holds len(kernel)/kw
+// padded source rows; kernel row ky is applied to slot (first+ky) mod
+// len(kernel)/kw.
+func BaseConvolve2DRow[T hwy.FloatsNative](ring []T, rowLen, first int, kernel []T, kw int, dst []T, width int) {
+	if kw <= 0 || width <= 0 {
+		return
+	}
+	kh := len(kernel) / kw
+	lanes := hwy.MaxLanes[T]()
+
+	x := 0
+	for ; x+lanes <= width; x += lanes {
+		acc := hwy.Zero[T]()
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				acc = hwy.MulAdd(hwy.Set(kernel[ky*kw+kx]), hwy.Load(row[x+kx:]), acc)
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		hwy.Store(acc, dst[x:])
+	}
+	for ; x < width; x++ {
+		var sum T
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				sum += kernel[ky*kw+kx] * row[x+kx]
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+// BaseSobelRow computes the 3x3 Sobel derivatives of one output row from
+// three padded source rows (above, mid, below):
+//
+//	gx = [-1 0 1; -2 0 2; -1 0 1],  gy = [-1 -2 -1; 0 0 0; 1 2 1]
+func BaseSobelRow[T hwy.FloatsNative](above, mid, below, gx, gy []T, width int) {
+	if width <= 0 {
+		return
+	}
+	lanes := hwy.MaxLanes[T]()
+
+	x := 0
+	for ; x+lanes <= width; x += lanes {
+		a0 := hwy.Load(above[x:])
+		a1 := hwy.Load(above[x+1:])
+		a2 := hwy.Load(above[x+2:])
+		m0 := hwy.Load(mid[x:])
+		m2 := hwy.Load(mid[x+2:])
+		b0 := hwy.Load(below[x:])
+		b1 := hwy.Load(below[x+1:])
+		b2 := hwy.Load(below[x+2:])
+
+		// Column differences for gx, row differences for gy; the centre
+		// tap is counted twice.
+		dm := hwy.Sub(m2, m0)
+		dx := hwy.Add(hwy.Add(hwy.Sub(a2, a0), hwy.Sub(b2, b0)), hwy.Add(dm, dm))
+		d1 := hwy.Sub(b1, a1)
+		dy := hwy.Add(hwy.Add(hwy.Sub(b0, a0), hwy.Sub(b2, a2)), hwy.Add(d1, d1))
+		hwy.Store(dx, gx[x:])
+		hwy.Store(dy, gy[x:])
+	}
+	for ; x < width; x++ {
+		gx[x] = (above[x+2] - above[x]) + 2*(mid[x+2]-mid[x]) + (below[x+2] - below[x])
+		gy[x] = (below[x] - above[x]) + 2*(below[x+1]-above[x+1]) + (below[x+2] - above[x+2])
+	}
+}
+
+// BaseSlideSum advances a running column sum by one row and writes the
+// scaled result: sum += add - sub; dst = sum * scale.
+func BaseSlideSum[T hwy.FloatsNative](sum, add, sub, dst []T, scale T, width int) {
+	if width <= 0 {
+		return
+	}
+	scaleVec := hwy.Set(scale)
+	lanes := hwy.MaxLanes[T]()
+
+	x := 0
+	for ; x+lanes <= width; x += lanes {
+		s := hwy.Add(hwy.Load(sum[x:]), hwy.Sub(hwy.Load(add[x:]), hwy.Load(sub[x:])))
+		hwy.Store(s, sum[x:])
+		hwy.Store(hwy.Mul(s, scaleVec), dst[x:])
+	}
+	for ; x < width; x++ {
+		sum[x] += add[x] - sub[x]
+		dst[x] = sum[x] * scale
+	}
+}
+
+// BaseGradientMagnitudeRow computes dst = sqrt(gx*gx + gy*gy).
+func BaseGradientMagnitudeRow[T hwy.FloatsNative](gx, gy, dst []T, width int) {
+	if width <= 0 {
+		return
+	}
+	lanes := hwy.MaxLanes[T]()
+
+	x := 0
+	for ; x+lanes <= width; x += lanes {
+		vx := hwy.Load(gx[x:])
+		vy := hwy.Load(gy[x:])
+		hwy.Store(hwy.Sqrt(hwy.MulAdd(vx, vx, hwy.Mul(vy, vy))), dst[x:])
+	}
+	for ; x < width; x++ {
+		dst[x] = T(stdmath.Sqrt(float64(gx[x]*gx[x] + gy[x]*gy[x])))
+	}
+}
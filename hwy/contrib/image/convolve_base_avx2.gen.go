@@ -0,0 +1,598 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package image
+
+import (
+	"simd/archsimd"
+	"unsafe"
+)
+
+func BaseConvolve2DRow_avx2(ring []float32, rowLen int, first int, kernel []float32, kw int, dst []float32, width int) {
+	if kw <= 0 || width <= 0 {
+		return
+	}
+	kh := len(kernel) / kw
+	lanes := 8
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		acc := archsimd.BroadcastFloat32x8(0)
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				acc = archsimd.BroadcastFloat32x8(kernel[ky*kw+kx]).MulAdd(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&row[x+kx]))), acc)
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		acc.Store((*[8]float32)(unsafe.Pointer(&dst[x])))
+		acc1 := archsimd.BroadcastFloat32x8(0)
+		slot1 := first
+		for ky1 := 0; ky1 < kh; ky1++ {
+			row1 := ring[slot1*rowLen:]
+			for kx1 := 0; kx1 < kw; kx1++ {
+				acc1 = archsimd.BroadcastFloat32x8(kernel[ky1*kw+kx1]).MulAdd(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&row1[x+kx1+8]))), acc1)
+			}
+			slot1++
+			if slot1 == kh {
+				slot1 = 0
+			}
+		}
+		acc1.Store((*[8]float32)(unsafe.Pointer(&dst[x+8])))
+		acc2 := archsimd.BroadcastFloat32x8(0)
+		slot2 := first
+		for ky2 := 0; ky2 < kh; ky2++ {
+			row2 := ring[slot2*rowLen:]
+			for kx2 := 0; kx2 < kw; kx2++ {
+				acc2 = archsimd.BroadcastFloat32x8(kernel[ky2*kw+kx2]).MulAdd(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&row2[x+kx2+16]))), acc2)
+			}
+			slot2++
+			if slot2 == kh {
+				slot2 = 0
+			}
+		}
+		acc2.Store((*[8]float32)(unsafe.Pointer(&dst[x+16])))
+		acc3 := archsimd.BroadcastFloat32x8(0)
+		slot3 := first
+		for ky3 := 0; ky3 < kh; ky3++ {
+			row3 := ring[slot3*rowLen:]
+			for kx3 := 0; kx3 < kw; kx3++ {
+				acc3 = archsimd.BroadcastFloat32x8(kernel[ky3*kw+kx3]).MulAdd(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&row3[x+kx3+24]))), acc3)
+			}
+			slot3++
+			if slot3 == kh {
+				slot3 = 0
+			}
+		}
+		acc3.Store((*[8]float32)(unsafe.Pointer(&dst[x+24])))
+	}
+	for ; x < width; x++ {
+		var sum float32
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				sum += kernel[ky*kw+kx] * row[x+kx]
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolve2DRow_avx2_Float64(ring []float64, rowLen int, first int, kernel []float64, kw int, dst []float64, width int) {
+	if kw <= 0 || width <= 0 {
+		return
+	}
+	kh := len(kernel) / kw
+	lanes := 4
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		acc := archsimd.BroadcastFloat64x4(0)
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				acc = archsimd.BroadcastFloat64x4(kernel[ky*kw+kx]).MulAdd(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&row[x+kx]))), acc)
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		acc.Store((*[4]float64)(unsafe.Pointer(&dst[x])))
+		acc1 := archsimd.BroadcastFloat64x4(0)
+		slot1 := first
+		for ky1 := 0; ky1 < kh; ky1++ {
+			row1 := ring[slot1*rowLen:]
+			for kx1 := 0; kx1 < kw; kx1++ {
+				acc1 = archsimd.BroadcastFloat64x4(kernel[ky1*kw+kx1]).MulAdd(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&row1[x+kx1+4]))), acc1)
+			}
+			slot1++
+			if slot1 == kh {
+				slot1 = 0
+			}
+		}
+		acc1.Store((*[4]float64)(unsafe.Pointer(&dst[x+4])))
+		acc2 := archsimd.BroadcastFloat64x4(0)
+		slot2 := first
+		for ky2 := 0; ky2 < kh; ky2++ {
+			row2 := ring[slot2*rowLen:]
+			for kx2 := 0; kx2 < kw; kx2++ {
+				acc2 = archsimd.BroadcastFloat64x4(kernel[ky2*kw+kx2]).MulAdd(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&row2[x+kx2+8]))), acc2)
+			}
+			slot2++
+			if slot2 == kh {
+				slot2 = 0
+			}
+		}
+		acc2.Store((*[4]float64)(unsafe.Pointer(&dst[x+8])))
+		acc3 := archsimd.BroadcastFloat64x4(0)
+		slot3 := first
+		for ky3 := 0; ky3 < kh; ky3++ {
+			row3 := ring[slot3*rowLen:]
+			for kx3 := 0; kx3 < kw; kx3++ {
+				acc3 = archsimd.BroadcastFloat64x4(kernel[ky3*kw+kx3]).MulAdd(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&row3[x+kx3+12]))), acc3)
+			}
+			slot3++
+			if slot3 == kh {
+				slot3 = 0
+			}
+		}
+		acc3.Store((*[4]float64)(unsafe.Pointer(&dst[x+12])))
+	}
+	for ; x < width; x++ {
+		var sum float64
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				sum += kernel[ky*kw+kx] * row[x+kx]
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolveRow_avx2(src []float32, kernel []float32, dst []float32, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	lanes := 8
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		acc := archsimd.BroadcastFloat32x8(0)
+		for k := 0; k < taps; k++ {
+			acc = archsimd.BroadcastFloat32x8(kernel[k]).MulAdd(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&src[x+k]))), acc)
+		}
+		acc.Store((*[8]float32)(unsafe.Pointer(&dst[x])))
+		acc1 := archsimd.BroadcastFloat32x8(0)
+		for k1 := 0; k1 < taps; k1++ {
+			acc1 = archsimd.BroadcastFloat32x8(kernel[k1]).MulAdd(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&src[x+k1+8]))), acc1)
+		}
+		acc1.Store((*[8]float32)(unsafe.Pointer(&dst[x+8])))
+		acc2 := archsimd.BroadcastFloat32x8(0)
+		for k2 := 0; k2 < taps; k2++ {
+			acc2 = archsimd.BroadcastFloat32x8(kernel[k2]).MulAdd(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&src[x+k2+16]))), acc2)
+		}
+		acc2.Store((*[8]float32)(unsafe.Pointer(&dst[x+16])))
+		acc3 := archsimd.BroadcastFloat32x8(0)
+		for k3 := 0; k3 < taps; k3++ {
+			acc3 = archsimd.BroadcastFloat32x8(kernel[k3]).MulAdd(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&src[x+k3+24]))), acc3)
+		}
+		acc3.Store((*[8]float32)(unsafe.Pointer(&dst[x+24])))
+	}
+	for ; x < width; x++ {
+		var sum float32
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * src[x+k]
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolveRow_avx2_Float64(src []float64, kernel []float64, dst []float64, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	lanes := 4
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		acc := archsimd.BroadcastFloat64x4(0)
+		for k := 0; k < taps; k++ {
+			acc = archsimd.BroadcastFloat64x4(kernel[k]).MulAdd(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&src[x+k]))), acc)
+		}
+		acc.Store((*[4]float64)(unsafe.Pointer(&dst[x])))
+		acc1 := archsimd.BroadcastFloat64x4(0)
+		for k1 := 0; k1 < taps; k1++ {
+			acc1 = archsimd.BroadcastFloat64x4(kernel[k1]).MulAdd(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&src[x+k1+4]))), acc1)
+		}
+		acc1.Store((*[4]float64)(unsafe.Pointer(&dst[x+4])))
+		acc2 := archsimd.BroadcastFloat64x4(0)
+		for k2 := 0; k2 < taps; k2++ {
+			acc2 = archsimd.BroadcastFloat64x4(kernel[k2]).MulAdd(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&src[x+k2+8]))), acc2)
+		}
+		acc2.Store((*[4]float64)(unsafe.Pointer(&dst[x+8])))
+		acc3 := archsimd.BroadcastFloat64x4(0)
+		for k3 := 0; k3 < taps; k3++ {
+			acc3 = archsimd.BroadcastFloat64x4(kernel[k3]).MulAdd(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&src[x+k3+12]))), acc3)
+		}
+		acc3.Store((*[4]float64)(unsafe.Pointer(&dst[x+12])))
+	}
+	for ; x < width; x++ {
+		var sum float64
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * src[x+k]
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolveVertical_avx2(ring []float32, rowLen int, first int, kernel []float32, dst []float32, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	lanes := 8
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		acc := archsimd.BroadcastFloat32x8(0)
+		slot := first
+		for k := 0; k < taps; k++ {
+			acc = archsimd.BroadcastFloat32x8(kernel[k]).MulAdd(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&ring[slot*rowLen+x]))), acc)
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		acc.Store((*[8]float32)(unsafe.Pointer(&dst[x])))
+		acc1 := archsimd.BroadcastFloat32x8(0)
+		slot1 := first
+		for k1 := 0; k1 < taps; k1++ {
+			acc1 = archsimd.BroadcastFloat32x8(kernel[k1]).MulAdd(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&ring[slot1*rowLen+x]))), acc1)
+			slot1++
+			if slot1 == taps {
+				slot1 = 0
+			}
+		}
+		acc1.Store((*[8]float32)(unsafe.Pointer(&dst[x+8])))
+		acc2 := archsimd.BroadcastFloat32x8(0)
+		slot2 := first
+		for k2 := 0; k2 < taps; k2++ {
+			acc2 = archsimd.BroadcastFloat32x8(kernel[k2]).MulAdd(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&ring[slot2*rowLen+x]))), acc2)
+			slot2++
+			if slot2 == taps {
+				slot2 = 0
+			}
+		}
+		acc2.Store((*[8]float32)(unsafe.Pointer(&dst[x+16])))
+		acc3 := archsimd.BroadcastFloat32x8(0)
+		slot3 := first
+		for k3 := 0; k3 < taps; k3++ {
+			acc3 = archsimd.BroadcastFloat32x8(kernel[k3]).MulAdd(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&ring[slot3*rowLen+x]))), acc3)
+			slot3++
+			if slot3 == taps {
+				slot3 = 0
+			}
+		}
+		acc3.Store((*[8]float32)(unsafe.Pointer(&dst[x+24])))
+	}
+	for ; x < width; x++ {
+		var sum float32
+		slot := first
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * ring[slot*rowLen+x]
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolveVertical_avx2_Float64(ring []float64, rowLen int, first int, kernel []float64, dst []float64, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	lanes := 4
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		acc := archsimd.BroadcastFloat64x4(0)
+		slot := first
+		for k := 0; k < taps; k++ {
+			acc = archsimd.BroadcastFloat64x4(kernel[k]).MulAdd(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&ring[slot*rowLen+x]))), acc)
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		acc.Store((*[4]float64)(unsafe.Pointer(&dst[x])))
+		acc1 := archsimd.BroadcastFloat64x4(0)
+		slot1 := first
+		for k1 := 0; k1 < taps; k1++ {
+			acc1 = archsimd.BroadcastFloat64x4(kernel[k1]).MulAdd(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&ring[slot1*rowLen+x]))), acc1)
+			slot1++
+			if slot1 == taps {
+				slot1 = 0
+			}
+		}
+		acc1.Store((*[4]float64)(unsafe.Pointer(&dst[x+4])))
+		acc2 := archsimd.BroadcastFloat64x4(0)
+		slot2 := first
+		for k2 := 0; k2 < taps; k2++ {
+			acc2 = archsimd.BroadcastFloat64x4(kernel[k2]).MulAdd(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&ring[slot2*rowLen+x]))), acc2)
+			slot2++
+			if slot2 == taps {
+				slot2 = 0
+			}
+		}
+		acc2.Store((*[4]float64)(unsafe.Pointer(&dst[x+8])))
+		acc3 := archsimd.BroadcastFloat64x4(0)
+		slot3 := first
+		for k3 := 0; k3 < taps; k3++ {
+			acc3 = archsimd.BroadcastFloat64x4(kernel[k3]).MulAdd(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&ring[slot3*rowLen+x]))), acc3)
+			slot3++
+			if slot3 == taps {
+				slot3 = 0
+			}
+		}
+		acc3.Store((*[4]float64)(unsafe.Pointer(&dst[x+12])))
+	}
+	for ; x < width; x++ {
+		var sum float64
+		slot := first
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * ring[slot*rowLen+x]
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseGradientMagnitudeRow_avx2(gx []float32, gy []float32, dst []float32, width int) {
+	if width <= 0 {
+		return
+	}
+	lanes := 8
+	x := 0
+	for ; x+lanes*2 <= width; x += lanes * 2 {
+		vx := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&gx[x])))
+		vy := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&gy[x])))
+		vx.MulAdd(vx, vy.Mul(vy)).Sqrt().Store((*[8]float32)(unsafe.Pointer(&dst[x])))
+		vx1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&gx[x+8])))
+		vy1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&gy[x+8])))
+		vx1.MulAdd(vx1, vy1.Mul(vy1)).Sqrt().Store((*[8]float32)(unsafe.Pointer(&dst[x+8])))
+	}
+	if x < width {
+		BaseGradientMagnitudeRow_fallback(gx[x:width], gy[x:width], dst[x:width], width)
+	}
+}
+
+func BaseGradientMagnitudeRow_avx2_Float64(gx []float64, gy []float64, dst []float64, width int) {
+	if width <= 0 {
+		return
+	}
+	lanes := 4
+	x := 0
+	for ; x+lanes*2 <= width; x += lanes * 2 {
+		vx := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&gx[x])))
+		vy := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&gy[x])))
+		vx.MulAdd(vx, vy.Mul(vy)).Sqrt().Store((*[4]float64)(unsafe.Pointer(&dst[x])))
+		vx1 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&gx[x+4])))
+		vy1 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&gy[x+4])))
+		vx1.MulAdd(vx1, vy1.Mul(vy1)).Sqrt().Store((*[4]float64)(unsafe.Pointer(&dst[x+4])))
+	}
+	if x < width {
+		BaseGradientMagnitudeRow_fallback_Float64(gx[x:width], gy[x:width], dst[x:width], width)
+	}
+}
+
+func BaseSlideSum_avx2(sum []float32, add []float32, sub []float32, dst []float32, scale float32, width int) {
+	if width <= 0 {
+		return
+	}
+	scaleVec := archsimd.BroadcastFloat32x8(scale)
+	lanes := 8
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		s := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&sum[x]))).Add(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&add[x]))).Sub(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&sub[x])))))
+		s.Store((*[8]float32)(unsafe.Pointer(&sum[x])))
+		s.Mul(scaleVec).Store((*[8]float32)(unsafe.Pointer(&dst[x])))
+		s1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&sum[x+8]))).Add(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&add[x+8]))).Sub(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&sub[x+8])))))
+		s1.Store((*[8]float32)(unsafe.Pointer(&sum[x+8])))
+		s1.Mul(scaleVec).Store((*[8]float32)(unsafe.Pointer(&dst[x+8])))
+		s2 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&sum[x+16]))).Add(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&add[x+16]))).Sub(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&sub[x+16])))))
+		s2.Store((*[8]float32)(unsafe.Pointer(&sum[x+16])))
+		s2.Mul(scaleVec).Store((*[8]float32)(unsafe.Pointer(&dst[x+16])))
+		s3 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&sum[x+24]))).Add(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&add[x+24]))).Sub(archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&sub[x+24])))))
+		s3.Store((*[8]float32)(unsafe.Pointer(&sum[x+24])))
+		s3.Mul(scaleVec).Store((*[8]float32)(unsafe.Pointer(&dst[x+24])))
+	}
+	for ; x < width; x++ {
+		sum[x] += add[x] - sub[x]
+		dst[x] = sum[x] * scale
+	}
+}
+
+func BaseSlideSum_avx2_Float64(sum []float64, add []float64, sub []float64, dst []float64, scale float64, width int) {
+	if width <= 0 {
+		return
+	}
+	scaleVec := archsimd.BroadcastFloat64x4(scale)
+	lanes := 4
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		s := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&sum[x]))).Add(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&add[x]))).Sub(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&sub[x])))))
+		s.Store((*[4]float64)(unsafe.Pointer(&sum[x])))
+		s.Mul(scaleVec).Store((*[4]float64)(unsafe.Pointer(&dst[x])))
+		s1 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&sum[x+4]))).Add(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&add[x+4]))).Sub(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&sub[x+4])))))
+		s1.Store((*[4]float64)(unsafe.Pointer(&sum[x+4])))
+		s1.Mul(scaleVec).Store((*[4]float64)(unsafe.Pointer(&dst[x+4])))
+		s2 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&sum[x+8]))).Add(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&add[x+8]))).Sub(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&sub[x+8])))))
+		s2.Store((*[4]float64)(unsafe.Pointer(&sum[x+8])))
+		s2.Mul(scaleVec).Store((*[4]float64)(unsafe.Pointer(&dst[x+8])))
+		s3 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&sum[x+12]))).Add(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&add[x+12]))).Sub(archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&sub[x+12])))))
+		s3.Store((*[4]float64)(unsafe.Pointer(&sum[x+12])))
+		s3.Mul(scaleVec).Store((*[4]float64)(unsafe.Pointer(&dst[x+12])))
+	}
+	for ; x < width; x++ {
+		sum[x] += add[x] - sub[x]
+		dst[x] = sum[x] * scale
+	}
+}
+
+func BaseSobelRow_avx2(above []float32, mid []float32, below []float32, gx []float32, gy []float32, width int) {
+	if width <= 0 {
+		return
+	}
+	lanes := 8
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		a0 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&above[x])))
+		a1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&above[x+1])))
+		a2 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&above[x+2])))
+		m0 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&mid[x])))
+		m2 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&mid[x+2])))
+		b0 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&below[x])))
+		b1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&below[x+1])))
+		b2 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&below[x+2])))
+		dm := m2.Sub(m0)
+		dx := a2.Sub(a0).Add(b2.Sub(b0)).Add(dm.Add(dm))
+		d1 := b1.Sub(a1)
+		dy := b0.Sub(a0).Add(b2.Sub(a2)).Add(d1.Add(d1))
+		dx.Store((*[8]float32)(unsafe.Pointer(&gx[x])))
+		dy.Store((*[8]float32)(unsafe.Pointer(&gy[x])))
+		a01 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&above[x+8])))
+		a11 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&above[x+1+8])))
+		a21 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&above[x+2+8])))
+		m01 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&mid[x+8])))
+		m21 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&mid[x+2+8])))
+		b01 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&below[x+8])))
+		b11 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&below[x+1+8])))
+		b21 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&below[x+2+8])))
+		dm1 := m21.Sub(m01)
+		dx1 := a21.Sub(a01).Add(b21.Sub(b01)).Add(dm1.Add(dm1))
+		d11 := b11.Sub(a11)
+		dy1 := b01.Sub(a01).Add(b21.Sub(a21)).Add(d11.Add(d11))
+		dx1.Store((*[8]float32)(unsafe.Pointer(&gx[x+8])))
+		dy1.Store((*[8]float32)(unsafe.Pointer(&gy[x+8])))
+		a02 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&above[x+16])))
+		a12 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&above[x+1+16])))
+		a22 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&above[x+2+16])))
+		m02 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&mid[x+16])))
+		m22 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&mid[x+2+16])))
+		b02 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&below[x+16])))
+		b12 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&below[x+1+16])))
+		b22 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&below[x+2+16])))
+		dm2 := m22.Sub(m02)
+		dx2 := a22.Sub(a02).Add(b22.Sub(b02)).Add(dm2.Add(dm2))
+		d12 := b12.Sub(a12)
+		dy2 := b02.Sub(a02).Add(b22.Sub(a22)).Add(d12.Add(d12))
+		dx2.Store((*[8]float32)(unsafe.Pointer(&gx[x+16])))
+		dy2.Store((*[8]float32)(unsafe.Pointer(&gy[x+16])))
+		a03 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&above[x+24])))
+		a13 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&above[x+1+24])))
+		a23 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&above[x+2+24])))
+		m03 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&mid[x+24])))
+		m23 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&mid[x+2+24])))
+		b03 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&below[x+24])))
+		b13 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&below[x+1+24])))
+		b23 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&below[x+2+24])))
+		dm3 := m23.Sub(m03)
+		dx3 := a23.Sub(a03).Add(b23.Sub(b03)).Add(dm3.Add(dm3))
+		d13 := b13.Sub(a13)
+		dy3 := b03.Sub(a03).Add(b23.Sub(a23)).Add(d13.Add(d13))
+		dx3.Store((*[8]float32)(unsafe.Pointer(&gx[x+24])))
+		dy3.Store((*[8]float32)(unsafe.Pointer(&gy[x+24])))
+	}
+	if x < width {
+		BaseSobelRow_fallback(above[x:width], mid[x:width], below[x:width], gx[x:width], gy[x:width], width)
+	}
+}
+
+func BaseSobelRow_avx2_Float64(above []float64, mid []float64, below []float64, gx []float64, gy []float64, width int) {
+	if width <= 0 {
+		return
+	}
+	lanes := 4
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		a0 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&above[x])))
+		a1 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&above[x+1])))
+		a2 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&above[x+2])))
+		m0 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&mid[x])))
+		m2 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&mid[x+2])))
+		b0 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&below[x])))
+		b1 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&below[x+1])))
+		b2 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&below[x+2])))
+		dm := m2.Sub(m0)
+		dx := a2.Sub(a0).Add(b2.Sub(b0)).Add(dm.Add(dm))
+		d1 := b1.Sub(a1)
+		dy := b0.Sub(a0).Add(b2.Sub(a2)).Add(d1.Add(d1))
+		dx.Store((*[4]float64)(unsafe.Pointer(&gx[x])))
+		dy.Store((*[4]float64)(unsafe.Pointer(&gy[x])))
+		a01 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&above[x+4])))
+		a11 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&above[x+1+4])))
+		a21 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&above[x+2+4])))
+		m01 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&mid[x+4])))
+		m21 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&mid[x+2+4])))
+		b01 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&below[x+4])))
+		b11 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&below[x+1+4])))
+		b21 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&below[x+2+4])))
+		dm1 := m21.Sub(m01)
+		dx1 := a21.Sub(a01).Add(b21.Sub(b01)).Add(dm1.Add(dm1))
+		d11 := b11.Sub(a11)
+		dy1 := b01.Sub(a01).Add(b21.Sub(a21)).Add(d11.Add(d11))
+		dx1.Store((*[4]float64)(unsafe.Pointer(&gx[x+4])))
+		dy1.Store((*[4]float64)(unsafe.Pointer(&gy[x+4])))
+		a02 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&above[x+8])))
+		a12 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&above[x+1+8])))
+		a22 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&above[x+2+8])))
+		m02 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&mid[x+8])))
+		m22 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&mid[x+2+8])))
+		b02 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&below[x+8])))
+		b12 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&below[x+1+8])))
+		b22 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&below[x+2+8])))
+		dm2 := m22.Sub(m02)
+		dx2 := a22.Sub(a02).Add(b22.Sub(b02)).Add(dm2.Add(dm2))
+		d12 := b12.Sub(a12)
+		dy2 := b02.Sub(a02).Add(b22.Sub(a22)).Add(d12.Add(d12))
+		dx2.Store((*[4]float64)(unsafe.Pointer(&gx[x+8])))
+		dy2.Store((*[4]float64)(unsafe.Pointer(&gy[x+8])))
+		a03 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&above[x+12])))
+		a13 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&above[x+1+12])))
+		a23 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&above[x+2+12])))
+		m03 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&mid[x+12])))
+		m23 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&mid[x+2+12])))
+		b03 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&below[x+12])))
+		b13 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&below[x+1+12])))
+		b23 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&below[x+2+12])))
+		dm3 := m23.Sub(m03)
+		dx3 := a23.Sub(a03).Add(b23.Sub(b03)).Add(dm3.Add(dm3))
+		d13 := b13.Sub(a13)
+		dy3 := b03.Sub(a03).Add(b23.Sub(a23)).Add(d13.Add(d13))
+		dx3.Store((*[4]float64)(unsafe.Pointer(&gx[x+12])))
+		dy3.Store((*[4]float64)(unsafe.Pointer(&gy[x+12])))
+	}
+	if x < width {
+		BaseSobelRow_fallback_Float64(above[x:width], mid[x:width], below[x:width], gx[x:width], gy[x:width], width)
+	}
+}
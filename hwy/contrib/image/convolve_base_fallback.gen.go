@@ -0,0 +1,313 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package image
+
+import (
+	stdmath "math"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func BaseConvolve2DRow_fallback(ring []float32, rowLen int, first int, kernel []float32, kw int, dst []float32, width int) {
+	if kw <= 0 || width <= 0 {
+		return
+	}
+	kh := len(kernel) / kw
+	x := 0
+	for ; x < width; x++ {
+		acc := float32(0)
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				acc = float32(kernel[ky*kw+kx])*row[x+kx] + acc
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		dst[x] = acc
+	}
+	for ; x < width; x++ {
+		var sum float32
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				sum += kernel[ky*kw+kx] * row[x+kx]
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolve2DRow_fallback_Float64(ring []float64, rowLen int, first int, kernel []float64, kw int, dst []float64, width int) {
+	if kw <= 0 || width <= 0 {
+		return
+	}
+	kh := len(kernel) / kw
+	x := 0
+	for ; x < width; x++ {
+		acc := float64(0)
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				acc = float64(kernel[ky*kw+kx])*row[x+kx] + acc
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		dst[x] = acc
+	}
+	for ; x < width; x++ {
+		var sum float64
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				sum += kernel[ky*kw+kx] * row[x+kx]
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolveRow_fallback(src []float32, kernel []float32, dst []float32, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	x := 0
+	for ; x < width; x++ {
+		acc := float32(0)
+		for k := 0; k < taps; k++ {
+			acc = float32(kernel[k])*src[x+k] + acc
+		}
+		dst[x] = acc
+	}
+	for ; x < width; x++ {
+		var sum float32
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * src[x+k]
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolveRow_fallback_Float64(src []float64, kernel []float64, dst []float64, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	x := 0
+	for ; x < width; x++ {
+		acc := float64(0)
+		for k := 0; k < taps; k++ {
+			acc = float64(kernel[k])*src[x+k] + acc
+		}
+		dst[x] = acc
+	}
+	for ; x < width; x++ {
+		var sum float64
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * src[x+k]
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolveVertical_fallback(ring []float32, rowLen int, first int, kernel []float32, dst []float32, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	x := 0
+	for ; x < width; x++ {
+		acc := float32(0)
+		slot := first
+		for k := 0; k < taps; k++ {
+			acc = float32(kernel[k])*ring[slot*rowLen+x] + acc
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		dst[x] = acc
+	}
+	for ; x < width; x++ {
+		var sum float32
+		slot := first
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * ring[slot*rowLen+x]
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolveVertical_fallback_Float64(ring []float64, rowLen int, first int, kernel []float64, dst []float64, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	x := 0
+	for ; x < width; x++ {
+		acc := float64(0)
+		slot := first
+		for k := 0; k < taps; k++ {
+			acc = float64(kernel[k])*ring[slot*rowLen+x] + acc
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		dst[x] = acc
+	}
+	for ; x < width; x++ {
+		var sum float64
+		slot := first
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * ring[slot*rowLen+x]
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseGradientMagnitudeRow_fallback(gx []float32, gy []float32, dst []float32, width int) {
+	if width <= 0 {
+		return
+	}
+	lanes := hwy.MaxLanes[float32]()
+	x := 0
+	for ; x+lanes <= width; x += lanes {
+		vx := hwy.Load(gx[x:])
+		vy := hwy.Load(gy[x:])
+		hwy.Store(hwy.Sqrt(hwy.MulAdd(vx, vx, hwy.Mul(vy, vy))), dst[x:])
+	}
+	for ; x < width; x++ {
+		dst[x] = float32(stdmath.Sqrt(float64(gx[x]*gx[x] + gy[x]*gy[x])))
+	}
+}
+
+func BaseGradientMagnitudeRow_fallback_Float64(gx []float64, gy []float64, dst []float64, width int) {
+	if width <= 0 {
+		return
+	}
+	lanes := hwy.MaxLanes[float64]()
+	x := 0
+	for ; x+lanes <= width; x += lanes {
+		vx := hwy.Load(gx[x:])
+		vy := hwy.Load(gy[x:])
+		hwy.Store(hwy.Sqrt(hwy.MulAdd(vx, vx, hwy.Mul(vy, vy))), dst[x:])
+	}
+	for ; x < width; x++ {
+		dst[x] = float64(stdmath.Sqrt(float64(gx[x]*gx[x] + gy[x]*gy[x])))
+	}
+}
+
+func BaseSlideSum_fallback(sum []float32, add []float32, sub []float32, dst []float32, scale float32, width int) {
+	if width <= 0 {
+		return
+	}
+	scaleVec := float32(scale)
+	x := 0
+	for ; x < width; x++ {
+		s := sum[x] + (add[x] - sub[x])
+		sum[x] = s
+		dst[x] = s * scaleVec
+	}
+	for ; x < width; x++ {
+		sum[x] += add[x] - sub[x]
+		dst[x] = sum[x] * scale
+	}
+}
+
+func BaseSlideSum_fallback_Float64(sum []float64, add []float64, sub []float64, dst []float64, scale float64, width int) {
+	if width <= 0 {
+		return
+	}
+	scaleVec := float64(scale)
+	x := 0
+	for ; x < width; x++ {
+		s := sum[x] + (add[x] - sub[x])
+		sum[x] = s
+		dst[x] = s * scaleVec
+	}
+	for ; x < width; x++ {
+		sum[x] += add[x] - sub[x]
+		dst[x] = sum[x] * scale
+	}
+}
+
+func BaseSobelRow_fallback(above []float32, mid []float32, below []float32, gx []float32, gy []float32, width int) {
+	if width <= 0 {
+		return
+	}
+	x := 0
+	for ; x < width; x++ {
+		a0 := above[x]
+		a1 := above[x+1]
+		a2 := above[x+2]
+		m0 := mid[x]
+		m2 := mid[x+2]
+		b0 := below[x]
+		b1 := below[x+1]
+		b2 := below[x+2]
+		dm := m2 - m0
+		dx := a2 - a0 + (b2 - b0) + (dm + dm)
+		d1 := b1 - a1
+		dy := b0 - a0 + (b2 - a2) + (d1 + d1)
+		gx[x] = dx
+		gy[x] = dy
+	}
+	for ; x < width; x++ {
+		gx[x] = (above[x+2] - above[x]) + 2*(mid[x+2]-mid[x]) + (below[x+2] - below[x])
+		gy[x] = (below[x] - above[x]) + 2*(below[x+1]-above[x+1]) + (below[x+2] - above[x+2])
+	}
+}
+
+func BaseSobelRow_fallback_Float64(above []float64, mid []float64, below []float64, gx []float64, gy []float64, width int) {
+	if width <= 0 {
+		return
+	}
+	x := 0
+	for ; x < width; x++ {
+		a0 := above[x]
+		a1 := above[x+1]
+		a2 := above[x+2]
+		m0 := mid[x]
+		m2 := mid[x+2]
+		b0 := below[x]
+		b1 := below[x+1]
+		b2 := below[x+2]
+		dm := m2 - m0
+		dx := a2 - a0 + (b2 - b0) + (dm + dm)
+		d1 := b1 - a1
+		dy := b0 - a0 + (b2 - a2) + (d1 + d1)
+		gx[x] = dx
+		gy[x] = dy
+	}
+	for ; x < width; x++ {
+		gx[x] = (above[x+2] - above[x]) + 2*(mid[x+2]-mid[x]) + (below[x+2] - below[x])
+		gy[x] = (below[x] - above[x]) + 2*(below[x+1]-above[x+1]) + (below[x+2] - above[x+2])
+	}
+}
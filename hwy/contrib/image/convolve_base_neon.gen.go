@@ -0,0 +1,599 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package image
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy/asm"
+)
+
+func BaseConvolve2DRow_neon(ring []float32, rowLen int, first int, kernel []float32, kw int, dst []float32, width int) {
+	if kw <= 0 || width <= 0 {
+		return
+	}
+	kh := len(kernel) / kw
+	lanes := 4
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		acc := asm.ZeroFloat32x4()
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				asm.BroadcastFloat32x4(kernel[ky*kw+kx]).MulAddAcc(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&row[x+kx]))), &acc)
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		acc.Store((*[4]float32)(unsafe.Pointer(&dst[x])))
+		acc1 := asm.ZeroFloat32x4()
+		slot1 := first
+		for ky1 := 0; ky1 < kh; ky1++ {
+			row1 := ring[slot1*rowLen:]
+			for kx1 := 0; kx1 < kw; kx1++ {
+				asm.BroadcastFloat32x4(kernel[ky1*kw+kx1]).MulAddAcc(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&row1[x+kx1+4]))), &acc1)
+			}
+			slot1++
+			if slot1 == kh {
+				slot1 = 0
+			}
+		}
+		acc1.Store((*[4]float32)(unsafe.Pointer(&dst[x+4])))
+		acc2 := asm.ZeroFloat32x4()
+		slot2 := first
+		for ky2 := 0; ky2 < kh; ky2++ {
+			row2 := ring[slot2*rowLen:]
+			for kx2 := 0; kx2 < kw; kx2++ {
+				asm.BroadcastFloat32x4(kernel[ky2*kw+kx2]).MulAddAcc(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&row2[x+kx2+8]))), &acc2)
+			}
+			slot2++
+			if slot2 == kh {
+				slot2 = 0
+			}
+		}
+		acc2.Store((*[4]float32)(unsafe.Pointer(&dst[x+8])))
+		acc3 := asm.ZeroFloat32x4()
+		slot3 := first
+		for ky3 := 0; ky3 < kh; ky3++ {
+			row3 := ring[slot3*rowLen:]
+			for kx3 := 0; kx3 < kw; kx3++ {
+				asm.BroadcastFloat32x4(kernel[ky3*kw+kx3]).MulAddAcc(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&row3[x+kx3+12]))), &acc3)
+			}
+			slot3++
+			if slot3 == kh {
+				slot3 = 0
+			}
+		}
+		acc3.Store((*[4]float32)(unsafe.Pointer(&dst[x+12])))
+	}
+	for ; x < width; x++ {
+		var sum float32
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				sum += kernel[ky*kw+kx] * row[x+kx]
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolve2DRow_neon_Float64(ring []float64, rowLen int, first int, kernel []float64, kw int, dst []float64, width int) {
+	if kw <= 0 || width <= 0 {
+		return
+	}
+	kh := len(kernel) / kw
+	lanes := 2
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		acc := asm.ZeroFloat64x2()
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				asm.BroadcastFloat64x2(kernel[ky*kw+kx]).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&row[x+kx]))), &acc)
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		acc.Store((*[2]float64)(unsafe.Pointer(&dst[x])))
+		acc1 := asm.ZeroFloat64x2()
+		slot1 := first
+		for ky1 := 0; ky1 < kh; ky1++ {
+			row1 := ring[slot1*rowLen:]
+			for kx1 := 0; kx1 < kw; kx1++ {
+				asm.BroadcastFloat64x2(kernel[ky1*kw+kx1]).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&row1[x+kx1+2]))), &acc1)
+			}
+			slot1++
+			if slot1 == kh {
+				slot1 = 0
+			}
+		}
+		acc1.Store((*[2]float64)(unsafe.Pointer(&dst[x+2])))
+		acc2 := asm.ZeroFloat64x2()
+		slot2 := first
+		for ky2 := 0; ky2 < kh; ky2++ {
+			row2 := ring[slot2*rowLen:]
+			for kx2 := 0; kx2 < kw; kx2++ {
+				asm.BroadcastFloat64x2(kernel[ky2*kw+kx2]).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&row2[x+kx2+4]))), &acc2)
+			}
+			slot2++
+			if slot2 == kh {
+				slot2 = 0
+			}
+		}
+		acc2.Store((*[2]float64)(unsafe.Pointer(&dst[x+4])))
+		acc3 := asm.ZeroFloat64x2()
+		slot3 := first
+		for ky3 := 0; ky3 < kh; ky3++ {
+			row3 := ring[slot3*rowLen:]
+			for kx3 := 0; kx3 < kw; kx3++ {
+				asm.BroadcastFloat64x2(kernel[ky3*kw+kx3]).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&row3[x+kx3+6]))), &acc3)
+			}
+			slot3++
+			if slot3 == kh {
+				slot3 = 0
+			}
+		}
+		acc3.Store((*[2]float64)(unsafe.Pointer(&dst[x+6])))
+	}
+	for ; x < width; x++ {
+		var sum float64
+		slot := first
+		for ky := 0; ky < kh; ky++ {
+			row := ring[slot*rowLen:]
+			for kx := 0; kx < kw; kx++ {
+				sum += kernel[ky*kw+kx] * row[x+kx]
+			}
+			slot++
+			if slot == kh {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolveRow_neon(src []float32, kernel []float32, dst []float32, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	lanes := 4
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		acc := asm.ZeroFloat32x4()
+		for k := 0; k < taps; k++ {
+			acc = asm.BroadcastFloat32x4(kernel[k]).MulAdd(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&src[x+k]))), acc)
+		}
+		acc.Store((*[4]float32)(unsafe.Pointer(&dst[x])))
+		acc1 := asm.ZeroFloat32x4()
+		for k1 := 0; k1 < taps; k1++ {
+			acc1 = asm.BroadcastFloat32x4(kernel[k1]).MulAdd(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&src[x+k1+4]))), acc1)
+		}
+		acc1.Store((*[4]float32)(unsafe.Pointer(&dst[x+4])))
+		acc2 := asm.ZeroFloat32x4()
+		for k2 := 0; k2 < taps; k2++ {
+			acc2 = asm.BroadcastFloat32x4(kernel[k2]).MulAdd(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&src[x+k2+8]))), acc2)
+		}
+		acc2.Store((*[4]float32)(unsafe.Pointer(&dst[x+8])))
+		acc3 := asm.ZeroFloat32x4()
+		for k3 := 0; k3 < taps; k3++ {
+			acc3 = asm.BroadcastFloat32x4(kernel[k3]).MulAdd(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&src[x+k3+12]))), acc3)
+		}
+		acc3.Store((*[4]float32)(unsafe.Pointer(&dst[x+12])))
+	}
+	for ; x < width; x++ {
+		var sum float32
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * src[x+k]
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolveRow_neon_Float64(src []float64, kernel []float64, dst []float64, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	lanes := 2
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		acc := asm.ZeroFloat64x2()
+		for k := 0; k < taps; k++ {
+			asm.BroadcastFloat64x2(kernel[k]).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&src[x+k]))), &acc)
+		}
+		acc.Store((*[2]float64)(unsafe.Pointer(&dst[x])))
+		acc1 := asm.ZeroFloat64x2()
+		for k1 := 0; k1 < taps; k1++ {
+			asm.BroadcastFloat64x2(kernel[k1]).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&src[x+k1+2]))), &acc1)
+		}
+		acc1.Store((*[2]float64)(unsafe.Pointer(&dst[x+2])))
+		acc2 := asm.ZeroFloat64x2()
+		for k2 := 0; k2 < taps; k2++ {
+			asm.BroadcastFloat64x2(kernel[k2]).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&src[x+k2+4]))), &acc2)
+		}
+		acc2.Store((*[2]float64)(unsafe.Pointer(&dst[x+4])))
+		acc3 := asm.ZeroFloat64x2()
+		for k3 := 0; k3 < taps; k3++ {
+			asm.BroadcastFloat64x2(kernel[k3]).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&src[x+k3+6]))), &acc3)
+		}
+		acc3.Store((*[2]float64)(unsafe.Pointer(&dst[x+6])))
+	}
+	for ; x < width; x++ {
+		var sum float64
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * src[x+k]
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolveVertical_neon(ring []float32, rowLen int, first int, kernel []float32, dst []float32, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	lanes := 4
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		acc := asm.ZeroFloat32x4()
+		slot := first
+		for k := 0; k < taps; k++ {
+			acc = asm.BroadcastFloat32x4(kernel[k]).MulAdd(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&ring[slot*rowLen+x]))), acc)
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		acc.Store((*[4]float32)(unsafe.Pointer(&dst[x])))
+		acc1 := asm.ZeroFloat32x4()
+		slot1 := first
+		for k1 := 0; k1 < taps; k1++ {
+			acc1 = asm.BroadcastFloat32x4(kernel[k1]).MulAdd(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&ring[slot1*rowLen+x]))), acc1)
+			slot1++
+			if slot1 == taps {
+				slot1 = 0
+			}
+		}
+		acc1.Store((*[4]float32)(unsafe.Pointer(&dst[x+4])))
+		acc2 := asm.ZeroFloat32x4()
+		slot2 := first
+		for k2 := 0; k2 < taps; k2++ {
+			acc2 = asm.BroadcastFloat32x4(kernel[k2]).MulAdd(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&ring[slot2*rowLen+x]))), acc2)
+			slot2++
+			if slot2 == taps {
+				slot2 = 0
+			}
+		}
+		acc2.Store((*[4]float32)(unsafe.Pointer(&dst[x+8])))
+		acc3 := asm.ZeroFloat32x4()
+		slot3 := first
+		for k3 := 0; k3 < taps; k3++ {
+			acc3 = asm.BroadcastFloat32x4(kernel[k3]).MulAdd(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&ring[slot3*rowLen+x]))), acc3)
+			slot3++
+			if slot3 == taps {
+				slot3 = 0
+			}
+		}
+		acc3.Store((*[4]float32)(unsafe.Pointer(&dst[x+12])))
+	}
+	for ; x < width; x++ {
+		var sum float32
+		slot := first
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * ring[slot*rowLen+x]
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseConvolveVertical_neon_Float64(ring []float64, rowLen int, first int, kernel []float64, dst []float64, width int) {
+	taps := len(kernel)
+	if taps == 0 || width <= 0 {
+		return
+	}
+	lanes := 2
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		acc := asm.ZeroFloat64x2()
+		slot := first
+		for k := 0; k < taps; k++ {
+			asm.BroadcastFloat64x2(kernel[k]).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&ring[slot*rowLen+x]))), &acc)
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		acc.Store((*[2]float64)(unsafe.Pointer(&dst[x])))
+		acc1 := asm.ZeroFloat64x2()
+		slot1 := first
+		for k1 := 0; k1 < taps; k1++ {
+			asm.BroadcastFloat64x2(kernel[k1]).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&ring[slot1*rowLen+x]))), &acc1)
+			slot1++
+			if slot1 == taps {
+				slot1 = 0
+			}
+		}
+		acc1.Store((*[2]float64)(unsafe.Pointer(&dst[x+2])))
+		acc2 := asm.ZeroFloat64x2()
+		slot2 := first
+		for k2 := 0; k2 < taps; k2++ {
+			asm.BroadcastFloat64x2(kernel[k2]).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&ring[slot2*rowLen+x]))), &acc2)
+			slot2++
+			if slot2 == taps {
+				slot2 = 0
+			}
+		}
+		acc2.Store((*[2]float64)(unsafe.Pointer(&dst[x+4])))
+		acc3 := asm.ZeroFloat64x2()
+		slot3 := first
+		for k3 := 0; k3 < taps; k3++ {
+			asm.BroadcastFloat64x2(kernel[k3]).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&ring[slot3*rowLen+x]))), &acc3)
+			slot3++
+			if slot3 == taps {
+				slot3 = 0
+			}
+		}
+		acc3.Store((*[2]float64)(unsafe.Pointer(&dst[x+6])))
+	}
+	for ; x < width; x++ {
+		var sum float64
+		slot := first
+		for k := 0; k < taps; k++ {
+			sum += kernel[k] * ring[slot*rowLen+x]
+			slot++
+			if slot == taps {
+				slot = 0
+			}
+		}
+		dst[x] = sum
+	}
+}
+
+func BaseGradientMagnitudeRow_neon(gx []float32, gy []float32, dst []float32, width int) {
+	if width <= 0 {
+		return
+	}
+	lanes := 4
+	x := 0
+	for ; x+lanes*2 <= width; x += lanes * 2 {
+		vx := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&gx[x])))
+		vy := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&gy[x])))
+		vx.MulAdd(vx, vy.Mul(vy)).Sqrt().Store((*[4]float32)(unsafe.Pointer(&dst[x])))
+		vx1 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&gx[x+4])))
+		vy1 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&gy[x+4])))
+		vx1.MulAdd(vx1, vy1.Mul(vy1)).Sqrt().Store((*[4]float32)(unsafe.Pointer(&dst[x+4])))
+	}
+	if x < width {
+		BaseGradientMagnitudeRow_fallback(gx[x:width], gy[x:width], dst[x:width], width)
+	}
+}
+
+func BaseGradientMagnitudeRow_neon_Float64(gx []float64, gy []float64, dst []float64, width int) {
+	if width <= 0 {
+		return
+	}
+	lanes := 2
+	x := 0
+	for ; x+lanes*2 <= width; x += lanes * 2 {
+		vx := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&gx[x])))
+		vy := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&gy[x])))
+		vx.MulAdd(vx, vy.Mul(vy)).Sqrt().Store((*[2]float64)(unsafe.Pointer(&dst[x])))
+		vx1 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&gx[x+2])))
+		vy1 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&gy[x+2])))
+		vx1.MulAdd(vx1, vy1.Mul(vy1)).Sqrt().Store((*[2]float64)(unsafe.Pointer(&dst[x+2])))
+	}
+	if x < width {
+		BaseGradientMagnitudeRow_fallback_Float64(gx[x:width], gy[x:width], dst[x:width], width)
+	}
+}
+
+func BaseSlideSum_neon(sum []float32, add []float32, sub []float32, dst []float32, scale float32, width int) {
+	if width <= 0 {
+		return
+	}
+	scaleVec := asm.BroadcastFloat32x4(scale)
+	lanes := 4
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		s := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&sum[x]))).Add(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&add[x]))).Sub(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&sub[x])))))
+		s.Store((*[4]float32)(unsafe.Pointer(&sum[x])))
+		s.Mul(scaleVec).Store((*[4]float32)(unsafe.Pointer(&dst[x])))
+		s1 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&sum[x+4]))).Add(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&add[x+4]))).Sub(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&sub[x+4])))))
+		s1.Store((*[4]float32)(unsafe.Pointer(&sum[x+4])))
+		s1.Mul(scaleVec).Store((*[4]float32)(unsafe.Pointer(&dst[x+4])))
+		s2 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&sum[x+8]))).Add(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&add[x+8]))).Sub(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&sub[x+8])))))
+		s2.Store((*[4]float32)(unsafe.Pointer(&sum[x+8])))
+		s2.Mul(scaleVec).Store((*[4]float32)(unsafe.Pointer(&dst[x+8])))
+		s3 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&sum[x+12]))).Add(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&add[x+12]))).Sub(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&sub[x+12])))))
+		s3.Store((*[4]float32)(unsafe.Pointer(&sum[x+12])))
+		s3.Mul(scaleVec).Store((*[4]float32)(unsafe.Pointer(&dst[x+12])))
+	}
+	for ; x < width; x++ {
+		sum[x] += add[x] - sub[x]
+		dst[x] = sum[x] * scale
+	}
+}
+
+func BaseSlideSum_neon_Float64(sum []float64, add []float64, sub []float64, dst []float64, scale float64, width int) {
+	if width <= 0 {
+		return
+	}
+	scaleVec := asm.BroadcastFloat64x2(scale)
+	lanes := 2
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		s := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&sum[x]))).Add(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&add[x]))).Sub(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&sub[x])))))
+		s.Store((*[2]float64)(unsafe.Pointer(&sum[x])))
+		s.Mul(scaleVec).Store((*[2]float64)(unsafe.Pointer(&dst[x])))
+		s1 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&sum[x+2]))).Add(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&add[x+2]))).Sub(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&sub[x+2])))))
+		s1.Store((*[2]float64)(unsafe.Pointer(&sum[x+2])))
+		s1.Mul(scaleVec).Store((*[2]float64)(unsafe.Pointer(&dst[x+2])))
+		s2 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&sum[x+4]))).Add(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&add[x+4]))).Sub(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&sub[x+4])))))
+		s2.Store((*[2]float64)(unsafe.Pointer(&sum[x+4])))
+		s2.Mul(scaleVec).Store((*[2]float64)(unsafe.Pointer(&dst[x+4])))
+		s3 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&sum[x+6]))).Add(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&add[x+6]))).Sub(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&sub[x+6])))))
+		s3.Store((*[2]float64)(unsafe.Pointer(&sum[x+6])))
+		s3.Mul(scaleVec).Store((*[2]float64)(unsafe.Pointer(&dst[x+6])))
+	}
+	for ; x < width; x++ {
+		sum[x] += add[x] - sub[x]
+		dst[x] = sum[x] * scale
+	}
+}
+
+func BaseSobelRow_neon(above []float32, mid []float32, below []float32, gx []float32, gy []float32, width int) {
+	if width <= 0 {
+		return
+	}
+	lanes := 4
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		a0 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&above[x])))
+		a1 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&above[x+1])))
+		a2 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&above[x+2])))
+		m0 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&mid[x])))
+		m2 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&mid[x+2])))
+		b0 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&below[x])))
+		b1 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&below[x+1])))
+		b2 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&below[x+2])))
+		dm := m2.Sub(m0)
+		dx := a2.Sub(a0).Add(b2.Sub(b0)).Add(dm.Add(dm))
+		d1 := b1.Sub(a1)
+		dy := b0.Sub(a0).Add(b2.Sub(a2)).Add(d1.Add(d1))
+		dx.Store((*[4]float32)(unsafe.Pointer(&gx[x])))
+		dy.Store((*[4]float32)(unsafe.Pointer(&gy[x])))
+		a01 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&above[x+4])))
+		a11 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&above[x+1+4])))
+		a21 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&above[x+2+4])))
+		m01 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&mid[x+4])))
+		m21 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&mid[x+2+4])))
+		b01 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&below[x+4])))
+		b11 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&below[x+1+4])))
+		b21 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&below[x+2+4])))
+		dm1 := m21.Sub(m01)
+		dx1 := a21.Sub(a01).Add(b21.Sub(b01)).Add(dm1.Add(dm1))
+		d11 := b11.Sub(a11)
+		dy1 := b01.Sub(a01).Add(b21.Sub(a21)).Add(d11.Add(d11))
+		dx1.Store((*[4]float32)(unsafe.Pointer(&gx[x+4])))
+		dy1.Store((*[4]float32)(unsafe.Pointer(&gy[x+4])))
+		a02 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&above[x+8])))
+		a12 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&above[x+1+8])))
+		a22 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&above[x+2+8])))
+		m02 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&mid[x+8])))
+		m22 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&mid[x+2+8])))
+		b02 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&below[x+8])))
+		b12 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&below[x+1+8])))
+		b22 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&below[x+2+8])))
+		dm2 := m22.Sub(m02)
+		dx2 := a22.Sub(a02).Add(b22.Sub(b02)).Add(dm2.Add(dm2))
+		d12 := b12.Sub(a12)
+		dy2 := b02.Sub(a02).Add(b22.Sub(a22)).Add(d12.Add(d12))
+		dx2.Store((*[4]float32)(unsafe.Pointer(&gx[x+8])))
+		dy2.Store((*[4]float32)(unsafe.Pointer(&gy[x+8])))
+		a03 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&above[x+12])))
+		a13 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&above[x+1+12])))
+		a23 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&above[x+2+12])))
+		m03 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&mid[x+12])))
+		m23 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&mid[x+2+12])))
+		b03 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&below[x+12])))
+		b13 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&below[x+1+12])))
+		b23 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&below[x+2+12])))
+		dm3 := m23.Sub(m03)
+		dx3 := a23.Sub(a03).Add(b23.Sub(b03)).Add(dm3.Add(dm3))
+		d13 := b13.Sub(a13)
+		dy3 := b03.Sub(a03).Add(b23.Sub(a23)).Add(d13.Add(d13))
+		dx3.Store((*[4]float32)(unsafe.Pointer(&gx[x+12])))
+		dy3.Store((*[4]float32)(unsafe.Pointer(&gy[x+12])))
+	}
+	if x < width {
+		BaseSobelRow_fallback(above[x:width], mid[x:width], below[x:width], gx[x:width], gy[x:width], width)
+	}
+}
+
+func BaseSobelRow_neon_Float64(above []float64, mid []float64, below []float64, gx []float64, gy []float64, width int) {
+	if width <= 0 {
+		return
+	}
+	lanes := 2
+	x := 0
+	for ; x+lanes*4 <= width; x += lanes * 4 {
+		a0 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&above[x])))
+		a1 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&above[x+1])))
+		a2 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&above[x+2])))
+		m0 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&mid[x])))
+		m2 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&mid[x+2])))
+		b0 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&below[x])))
+		b1 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&below[x+1])))
+		b2 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&below[x+2])))
+		dm := m2.Sub(m0)
+		dx := a2.Sub(a0).Add(b2.Sub(b0)).Add(dm.Add(dm))
+		d1 := b1.Sub(a1)
+		dy := b0.Sub(a0).Add(b2.Sub(a2)).Add(d1.Add(d1))
+		dx.Store((*[2]float64)(unsafe.Pointer(&gx[x])))
+		dy.Store((*[2]float64)(unsafe.Pointer(&gy[x])))
+		a01 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&above[x+2])))
+		a11 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&above[x+1+2])))
+		a21 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&above[x+2+2])))
+		m01 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&mid[x+2])))
+		m21 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&mid[x+2+2])))
+		b01 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&below[x+2])))
+		b11 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&below[x+1+2])))
+		b21 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&below[x+2+2])))
+		dm1 := m21.Sub(m01)
+		dx1 := a21.Sub(a01).Add(b21.Sub(b01)).Add(dm1.Add(dm1))
+		d11 := b11.Sub(a11)
+		dy1 := b01.Sub(a01).Add(b21.Sub(a21)).Add(d11.Add(d11))
+		dx1.Store((*[2]float64)(unsafe.Pointer(&gx[x+2])))
+		dy1.Store((*[2]float64)(unsafe.Pointer(&gy[x+2])))
+		a02 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&above[x+4])))
+		a12 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&above[x+1+4])))
+		a22 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&above[x+2+4])))
+		m02 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&mid[x+4])))
+		m22 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&mid[x+2+4])))
+		b02 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&below[x+4])))
+		b12 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&below[x+1+4])))
+		b22 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&below[x+2+4])))
+		dm2 := m22.Sub(m02)
+		dx2 := a22.Sub(a02).Add(b22.Sub(b02)).Add(dm2.Add(dm2))
+		d12 := b12.Sub(a12)
+		dy2 := b02.Sub(a02).Add(b22.Sub(a22)).Add(d12.Add(d12))
+		dx2.Store((*[2]float64)(unsafe.Pointer(&gx[x+4])))
+		dy2.Store((*[2]float64)(unsafe.Pointer(&gy[x+4])))
+		a03 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&above[x+6])))
+		a13 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&above[x+1+6])))
+		a23 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&above[x+2+6])))
+		m03 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&mid[x+6])))
+		m23 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&mid[x+2+6])))
+		b03 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&below[x+6])))
+		b13 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&below[x+1+6])))
+		b23 := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&below[x+2+6])))
+		dm3 := m23.Sub(m03)
+		dx3 := a23.Sub(a03).Add(b23.Sub(b03)).Add(dm3.Add(dm3))
+		d13 := b13.Sub(a13)
+		dy3 := b03.Sub(a03).Add(b23.Sub(a23)).Add(d13.Add(d13))
+		dx3.Store((*[2]float64)(unsafe.Pointer(&gx[x+6])))
+		dy3.Store((*[2]float64)(unsafe.Pointer(&gy[x+6])))
+	}
+	if x < width {
+		BaseSobelRow_fallback_Float64(above[x:width], mid[x:width], below[x:width], gx[x:width], gy[x:width], width)
+	}
+}
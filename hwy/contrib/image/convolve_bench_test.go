@@ -0,0 +1,78 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package image
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+func BenchmarkGaussianBlur(b *testing.B) {
+	benchFilter(b, func(pool workerpool.Executor, img, out *Image[float32]) {
+		GaussianBlur(pool, img, out, 2, BorderMirror)
+	})
+}
+
+func BenchmarkBoxBlur(b *testing.B) {
+	benchFilter(b, func(pool workerpool.Executor, img, out *Image[float32]) {
+		BoxBlur(pool, img, out, 8, BorderMirror)
+	})
+}
+
+func BenchmarkConvolve2D5x5(b *testing.B) {
+	kernel := make([]float32, 25)
+	for i := range kernel {
+		kernel[i] = 1.0 / 25
+	}
+	benchFilter(b, func(pool workerpool.Executor, img, out *Image[float32]) {
+		Convolve2D(pool, img, out, kernel, 5, BorderClamp)
+	})
+}
+
+func BenchmarkSobel(b *testing.B) {
+	benchFilter(b, func(pool workerpool.Executor, img, out *Image[float32]) {
+		Sobel(pool, img, out, out, BorderClamp)
+	})
+}
+
+func benchFilter(b *testing.B, filter func(pool workerpool.Executor, img, out *Image[float32])) {
+	pool := workerpool.New(0)
+	defer pool.Close()
+
+	for _, size := range benchSizes[1:3] {
+		img := NewImage[float32](size.width, size.height)
+		for y := 0; y < size.height; y++ {
+			row := img.Row(y)
+			for x := 0; x < size.width; x++ {
+				row[x] = float32(x+y) / float32(size.width+size.height)
+			}
+		}
+		out := NewImage[float32](size.width, size.height)
+
+		for _, bc := range []struct {
+			name string
+			pool workerpool.Executor
+		}{{"seq", nil}, {"pool", pool}} {
+			b.Run(size.name+"/"+bc.name, func(b *testing.B) {
+				b.ReportAllocs()
+				for i := 0; i < b.N; i++ {
+					filter(bc.pool, img, out)
+				}
+				b.SetBytes(int64(size.width * size.height * 4 * 2))
+			})
+		}
+	}
+}
@@ -0,0 +1,108 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package image
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("image", "Convolve2DRow", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Convolve2DRowFloat32; hwyImpl != nil {
+			Convolve2DRowFloat32 = func(ring []float32, rowLen int, first int, kernel []float32, kw int, dst []float32, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(ring, rowLen, first, kernel, kw, dst, width)
+				hwyCounter.Done(hwyStart, len(ring), hwy.SliceBytes(ring)+hwy.SliceBytes(kernel)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := Convolve2DRowFloat64; hwyImpl != nil {
+			Convolve2DRowFloat64 = func(ring []float64, rowLen int, first int, kernel []float64, kw int, dst []float64, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(ring, rowLen, first, kernel, kw, dst, width)
+				hwyCounter.Done(hwyStart, len(ring), hwy.SliceBytes(ring)+hwy.SliceBytes(kernel)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "ConvolveRow", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ConvolveRowFloat32; hwyImpl != nil {
+			ConvolveRowFloat32 = func(src []float32, kernel []float32, dst []float32, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, kernel, dst, width)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(kernel)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := ConvolveRowFloat64; hwyImpl != nil {
+			ConvolveRowFloat64 = func(src []float64, kernel []float64, dst []float64, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, kernel, dst, width)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(kernel)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "ConvolveVertical", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ConvolveVerticalFloat32; hwyImpl != nil {
+			ConvolveVerticalFloat32 = func(ring []float32, rowLen int, first int, kernel []float32, dst []float32, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(ring, rowLen, first, kernel, dst, width)
+				hwyCounter.Done(hwyStart, len(ring), hwy.SliceBytes(ring)+hwy.SliceBytes(kernel)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := ConvolveVerticalFloat64; hwyImpl != nil {
+			ConvolveVerticalFloat64 = func(ring []float64, rowLen int, first int, kernel []float64, dst []float64, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(ring, rowLen, first, kernel, dst, width)
+				hwyCounter.Done(hwyStart, len(ring), hwy.SliceBytes(ring)+hwy.SliceBytes(kernel)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "GradientMagnitudeRow", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := GradientMagnitudeRowFloat32; hwyImpl != nil {
+			GradientMagnitudeRowFloat32 = func(gx []float32, gy []float32, dst []float32, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(gx, gy, dst, width)
+				hwyCounter.Done(hwyStart, len(gx), hwy.SliceBytes(gx)+hwy.SliceBytes(gy)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := GradientMagnitudeRowFloat64; hwyImpl != nil {
+			GradientMagnitudeRowFloat64 = func(gx []float64, gy []float64, dst []float64, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(gx, gy, dst, width)
+				hwyCounter.Done(hwyStart, len(gx), hwy.SliceBytes(gx)+hwy.SliceBytes(gy)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "SlideSum", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SlideSumFloat32; hwyImpl != nil {
+			SlideSumFloat32 = func(sum []float32, add []float32, sub []float32, dst []float32, scale float32, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(sum, add, sub, dst, scale, width)
+				hwyCounter.Done(hwyStart, len(sum), hwy.SliceBytes(sum)+hwy.SliceBytes(add)+hwy.SliceBytes(sub)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := SlideSumFloat64; hwyImpl != nil {
+			SlideSumFloat64 = func(sum []float64, add []float64, sub []float64, dst []float64, scale float64, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(sum, add, sub, dst, scale, width)
+				hwyCounter.Done(hwyStart, len(sum), hwy.SliceBytes(sum)+hwy.SliceBytes(add)+hwy.SliceBytes(sub)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "SobelRow", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SobelRowFloat32; hwyImpl != nil {
+			SobelRowFloat32 = func(above []float32, mid []float32, below []float32, gx []float32, gy []float32, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(above, mid, below, gx, gy, width)
+				hwyCounter.Done(hwyStart, len(above), hwy.SliceBytes(above)+hwy.SliceBytes(mid)+hwy.SliceBytes(below)+hwy.SliceBytes(gx)+hwy.SliceBytes(gy))
+			}
+		}
+		if hwyImpl := SobelRowFloat64; hwyImpl != nil {
+			SobelRowFloat64 = func(above []float64, mid []float64, below []float64, gx []float64, gy []float64, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(above, mid, below, gx, gy, width)
+				hwyCounter.Done(hwyStart, len(above), hwy.SliceBytes(above)+hwy.SliceBytes(mid)+hwy.SliceBytes(below)+hwy.SliceBytes(gx)+hwy.SliceBytes(gy))
+			}
+		}
+	})
+}
@@ -0,0 +1,228 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package image
+
+import (
+	"fmt"
+	"math"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// Filter test shapes: single pixels, images narrower than the kernels, and
+// widths with vector tails.
+var filterSizes = [][2]int{{1, 1}, {2, 5}, {7, 3}, {17, 9}, {40, 33}}
+
+var borderModes = []struct {
+	name string
+	mode BorderMode
+}{{"mirror", BorderMirror}, {"clamp", BorderClamp}, {"wrap", BorderWrap}}
+
+func TestSeparableConvolve(t *testing.T) {
+	kx := []float64{0.25, -1, 0.5, 2}
+	ky := []float64{1, 0.5, -0.25}
+	kernel := outer(ky, kx)
+	for _, sz := range filterSizes {
+		for _, b := range borderModes {
+			t.Run(fmt.Sprintf("%dx%d_%s", sz[0], sz[1], b.name), func(t *testing.T) {
+				src := filterTestImage(sz[0], sz[1])
+				dst := NewImage[float64](sz[0], sz[1])
+				SeparableConvolve(nil, src, dst, kx, ky, b.mode)
+				compareFiltered(t, dst, referenceConvolve(src, kernel, len(kx), b.mode), 1e-9)
+			})
+		}
+	}
+}
+
+func TestConvolve2D(t *testing.T) {
+	kernel := []float64{
+		1, 0, -2, 0.5, 3,
+		-1, 4, 0, 2, -0.5,
+		0.25, 1, 1, -3, 2,
+	}
+	for _, sz := range filterSizes {
+		for _, b := range borderModes {
+			t.Run(fmt.Sprintf("%dx%d_%s", sz[0], sz[1], b.name), func(t *testing.T) {
+				src := filterTestImage(sz[0], sz[1])
+				dst := NewImage[float64](sz[0], sz[1])
+				Convolve2D(nil, src, dst, kernel, 5, b.mode)
+				compareFiltered(t, dst, referenceConvolve(src, kernel, 5, b.mode), 1e-9)
+			})
+		}
+	}
+}
+
+func TestBoxBlur(t *testing.T) {
+	for _, radius := range []int{0, 1, 3} {
+		taps := 2*radius + 1
+		kernel := make([]float64, taps*taps)
+		for i := range kernel {
+			kernel[i] = 1 / float64(len(kernel))
+		}
+		for _, sz := range filterSizes {
+			for _, b := range borderModes {
+				t.Run(fmt.Sprintf("r%d_%dx%d_%s", radius, sz[0], sz[1], b.name), func(t *testing.T) {
+					src := filterTestImage(sz[0], sz[1])
+					dst := NewImage[float64](sz[0], sz[1])
+					BoxBlur(nil, src, dst, radius, b.mode)
+					compareFiltered(t, dst, referenceConvolve(src, kernel, taps, b.mode), 1e-9)
+				})
+			}
+		}
+	}
+}
+
+func TestGaussianBlur(t *testing.T) {
+	kernel := GaussianKernel[float32](1.5)
+	if len(kernel) != 11 {
+		t.Fatalf("kernel length: got %d, want 11", len(kernel))
+	}
+	var sum float32
+	for i, w := range kernel {
+		sum += w
+		if w != kernel[len(kernel)-1-i] {
+			t.Errorf("kernel not symmetric at %d", i)
+		}
+	}
+	if !almostEqual(sum, 1, tolerance) {
+		t.Errorf("kernel sum: got %v, want 1", sum)
+	}
+
+	// A blur leaves a constant image unchanged.
+	src := NewImage[float32](37, 21)
+	src.Fill(0.75)
+	dst := NewImage[float32](37, 21)
+	GaussianBlur(nil, src, dst, 2, BorderClamp)
+	for y := range dst.Height() {
+		for x := range dst.Width() {
+			if !almostEqual(dst.At(x, y), 0.75, tolerance) {
+				t.Fatalf("(%d,%d): got %v, want 0.75", x, y, dst.At(x, y))
+			}
+		}
+	}
+}
+
+func TestSobel(t *testing.T) {
+	kx := []float64{-1, 0, 1, -2, 0, 2, -1, 0, 1}
+	ky := []float64{-1, -2, -1, 0, 0, 0, 1, 2, 1}
+	for _, sz := range filterSizes {
+		for _, b := range borderModes {
+			t.Run(fmt.Sprintf("%dx%d_%s", sz[0], sz[1], b.name), func(t *testing.T) {
+				src := filterTestImage(sz[0], sz[1])
+				gx := NewImage[float64](sz[0], sz[1])
+				gy := NewImage[float64](sz[0], sz[1])
+				mag := NewImage[float64](sz[0], sz[1])
+				Sobel(nil, src, gx, gy, b.mode)
+				GradientMagnitude(nil, gx, gy, mag)
+
+				wantX := referenceConvolve(src, kx, 3, b.mode)
+				wantY := referenceConvolve(src, ky, 3, b.mode)
+				compareFiltered(t, gx, wantX, 1e-9)
+				compareFiltered(t, gy, wantY, 1e-9)
+				for y := range sz[1] {
+					for x := range sz[0] {
+						want := math.Hypot(wantX.At(x, y), wantY.At(x, y))
+						if !almostEqualF64(mag.At(x, y), want, 1e-9) {
+							t.Fatalf("magnitude (%d,%d): got %v, want %v", x, y, mag.At(x, y), want)
+						}
+					}
+				}
+			})
+		}
+	}
+}
+
+func TestFiltersParallel(t *testing.T) {
+	pool := workerpool.New(4)
+	defer pool.Close()
+
+	const w, h = 203, 157
+	src := filterTestImage(w, h)
+	seq := NewImage[float64](w, h)
+	par := NewImage[float64](w, h)
+
+	kernel := GaussianKernel[float64](1.2)
+	SeparableConvolve(nil, src, seq, kernel, kernel, BorderMirror)
+	SeparableConvolve(pool, src, par, kernel, kernel, BorderMirror)
+	compareFiltered(t, par, seq, 0)
+
+	Convolve2D(nil, src, seq, outer(kernel, kernel), len(kernel), BorderWrap)
+	Convolve2D(pool, src, par, outer(kernel, kernel), len(kernel), BorderWrap)
+	compareFiltered(t, par, seq, 0)
+
+	// Running sums restart at each band, so rounding may differ slightly.
+	BoxBlur(nil, src, seq, 4, BorderClamp)
+	BoxBlur(pool, src, par, 4, BorderClamp)
+	compareFiltered(t, par, seq, 1e-9)
+
+	gx := NewImage[float64](w, h)
+	Sobel(nil, src, seq, gx, BorderMirror)
+	Sobel(pool, src, par, gx, BorderMirror)
+	compareFiltered(t, par, seq, 0)
+}
+
+func filterTestImage(w, h int) *Image[float64] {
+	img := NewImage[float64](w, h)
+	for y := range h {
+		for x := range w {
+			img.Set(x, y, float64((x*37+y*101)%53)/7-3)
+		}
+	}
+	return img
+}
+
+func outer(col, row []float64) []float64 {
+	out := make([]float64, 0, len(col)*len(row))
+	for _, c := range col {
+		for _, r := range row {
+			out = append(out, c*r)
+		}
+	}
+	return out
+}
+
+// referenceConvolve correlates src with a kw-column kernel centred on tap
+// (kw/2, kh/2), one pixel at a time.
+func referenceConvolve(src *Image[float64], kernel []float64, kw int, border BorderMode) *Image[float64] {
+	w, h := src.Width(), src.Height()
+	kh := len(kernel) / kw
+	out := NewImage[float64](w, h)
+	for y := range h {
+		for x := range w {
+			var sum float64
+			for ky := range kh {
+				sy := border.index(y+ky-kh/2, h)
+				for kx := range kw {
+					sx := border.index(x+kx-kw/2, w)
+					sum += kernel[ky*kw+kx] * src.At(sx, sy)
+				}
+			}
+			out.Set(x, y, sum)
+		}
+	}
+	return out
+}
+
+func compareFiltered(t *testing.T, got, want *Image[float64], tol float64) {
+	t.Helper()
+	for y := range want.Height() {
+		for x := range want.Width() {
+			if g, w := got.At(x, y), want.At(x, y); math.Abs(g-w) > tol {
+				t.Fatalf("(%d,%d): got %v, want %v", x, y, g, w)
+			}
+		}
+	}
+}
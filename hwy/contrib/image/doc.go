@@ -49,6 +49,19 @@
 //	ForwardICT(r, g, b, outY, outCb, outCr) // RGB → YCbCr
 //	InverseICT(y, cb, cr, outR, outG, outB) // YCbCr → RGB
 //
+// # Filters
+//
+// Neighbourhood filters take an optional workerpool.Executor (nil runs on
+// the calling goroutine) and split the image into row bands. Within a band,
+// each source row is border-extended into a ring buffer once:
+//
+//	SeparableConvolve(pool, src, dst, kernelX, kernelY, border)
+//	Convolve2D(pool, src, dst, kernel, kw, border) // kw-column row-major kernel
+//	GaussianBlur(pool, src, dst, sigma, border)
+//	BoxBlur(pool, src, dst, radius, border)       // running sums, any radius
+//	Sobel(pool, src, gx, gy, border)
+//	GradientMagnitude(pool, gx, gy, dst)
+//
 // # Edge Handling
 //
 // Coordinate helper functions for handling out-of-bounds pixel access:
@@ -56,4 +69,6 @@
 //	Mirror(index, size) - reflect at boundaries
 //	Clamp(index, size)  - repeat edge pixels
 //	Wrap(index, size)   - tile/wrap around
+//
+// Filters select one with BorderMirror, BorderClamp or BorderWrap.
 package image
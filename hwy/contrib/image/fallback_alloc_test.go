@@ -0,0 +1,132 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package image
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		f16Scalar  = hwy.NewFloat16(1)
+		bf16Scalar = hwy.NewBFloat16(1)
+		f32Scalar  = float32(1)
+		f64Scalar  = float64(1)
+		f16Img     = NewImage[hwy.Float16](allocTestDim, allocTestDim)
+		bf16Img    = NewImage[hwy.BFloat16](allocTestDim, allocTestDim)
+		f32Img     = NewImage[float32](allocTestDim, allocTestDim)
+		f64Img     = NewImage[float64](allocTestDim, allocTestDim)
+		i32Img     = NewImage[int32](allocTestDim, allocTestDim)
+		i64Img     = NewImage[int64](allocTestDim, allocTestDim)
+		f32        = make([]float32, allocTestLen)
+		f64        = make([]float64, allocTestLen)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseForwardICT_fallback_Float16", func() { BaseForwardICT_fallback_Float16(f16Img, f16Img, f16Img, f16Img, f16Img, f16Img) }},
+		{"BaseForwardICT_fallback_BFloat16", func() { BaseForwardICT_fallback_BFloat16(bf16Img, bf16Img, bf16Img, bf16Img, bf16Img, bf16Img) }},
+		{"BaseForwardICT_fallback", func() { BaseForwardICT_fallback(f32Img, f32Img, f32Img, f32Img, f32Img, f32Img) }},
+		{"BaseForwardICT_fallback_Float64", func() { BaseForwardICT_fallback_Float64(f64Img, f64Img, f64Img, f64Img, f64Img, f64Img) }},
+		{"BaseForwardRCT_fallback_Int32", func() { BaseForwardRCT_fallback_Int32(i32Img, i32Img, i32Img, i32Img, i32Img, i32Img) }},
+		{"BaseForwardRCT_fallback_Int64", func() { BaseForwardRCT_fallback_Int64(i64Img, i64Img, i64Img, i64Img, i64Img, i64Img) }},
+		{"BaseInverseICT_fallback_Float16", func() { BaseInverseICT_fallback_Float16(f16Img, f16Img, f16Img, f16Img, f16Img, f16Img) }},
+		{"BaseInverseICT_fallback_BFloat16", func() { BaseInverseICT_fallback_BFloat16(bf16Img, bf16Img, bf16Img, bf16Img, bf16Img, bf16Img) }},
+		{"BaseInverseICT_fallback", func() { BaseInverseICT_fallback(f32Img, f32Img, f32Img, f32Img, f32Img, f32Img) }},
+		{"BaseInverseICT_fallback_Float64", func() { BaseInverseICT_fallback_Float64(f64Img, f64Img, f64Img, f64Img, f64Img, f64Img) }},
+		{"BaseInverseRCT_fallback_Int32", func() { BaseInverseRCT_fallback_Int32(i32Img, i32Img, i32Img, i32Img, i32Img, i32Img) }},
+		{"BaseInverseRCT_fallback_Int64", func() { BaseInverseRCT_fallback_Int64(i64Img, i64Img, i64Img, i64Img, i64Img, i64Img) }},
+		{"BaseAbs_fallback_Float16", func() { BaseAbs_fallback_Float16(f16Img, f16Img) }},
+		{"BaseAbs_fallback_BFloat16", func() { BaseAbs_fallback_BFloat16(bf16Img, bf16Img) }},
+		{"BaseAbs_fallback", func() { BaseAbs_fallback(f32Img, f32Img) }},
+		{"BaseAbs_fallback_Float64", func() { BaseAbs_fallback_Float64(f64Img, f64Img) }},
+		{"BaseBrightnessContrast_fallback_Float16", func() { BaseBrightnessContrast_fallback_Float16(f16Img, f16Img, f16Scalar, f16Scalar) }},
+		{"BaseBrightnessContrast_fallback_BFloat16", func() { BaseBrightnessContrast_fallback_BFloat16(bf16Img, bf16Img, bf16Scalar, bf16Scalar) }},
+		{"BaseBrightnessContrast_fallback", func() { BaseBrightnessContrast_fallback(f32Img, f32Img, f32Scalar, f32Scalar) }},
+		{"BaseBrightnessContrast_fallback_Float64", func() { BaseBrightnessContrast_fallback_Float64(f64Img, f64Img, f64Scalar, f64Scalar) }},
+		{"BaseClampImage_fallback_Float16", func() { BaseClampImage_fallback_Float16(f16Img, f16Img, f16Scalar, f16Scalar) }},
+		{"BaseClampImage_fallback_BFloat16", func() { BaseClampImage_fallback_BFloat16(bf16Img, bf16Img, bf16Scalar, bf16Scalar) }},
+		{"BaseClampImage_fallback", func() { BaseClampImage_fallback(f32Img, f32Img, f32Scalar, f32Scalar) }},
+		{"BaseClampImage_fallback_Float64", func() { BaseClampImage_fallback_Float64(f64Img, f64Img, f64Scalar, f64Scalar) }},
+		{"BaseGamma_fallback_Float16", func() { BaseGamma_fallback_Float16(f16Img, f16Img, f16Scalar) }},
+		{"BaseGamma_fallback_BFloat16", func() { BaseGamma_fallback_BFloat16(bf16Img, bf16Img, bf16Scalar) }},
+		{"BaseGamma_fallback", func() { BaseGamma_fallback(f32Img, f32Img, f32Scalar) }},
+		{"BaseGamma_fallback_Float64", func() { BaseGamma_fallback_Float64(f64Img, f64Img, f64Scalar) }},
+		{"BaseInvert_fallback_Float16", func() { BaseInvert_fallback_Float16(f16Img, f16Img, f16Scalar) }},
+		{"BaseInvert_fallback_BFloat16", func() { BaseInvert_fallback_BFloat16(bf16Img, bf16Img, bf16Scalar) }},
+		{"BaseInvert_fallback", func() { BaseInvert_fallback(f32Img, f32Img, f32Scalar) }},
+		{"BaseInvert_fallback_Float64", func() { BaseInvert_fallback_Float64(f64Img, f64Img, f64Scalar) }},
+		{"BaseMaxImage_fallback_Float16", func() { BaseMaxImage_fallback_Float16(f16Img, f16Img, f16Img) }},
+		{"BaseMaxImage_fallback_BFloat16", func() { BaseMaxImage_fallback_BFloat16(bf16Img, bf16Img, bf16Img) }},
+		{"BaseMaxImage_fallback", func() { BaseMaxImage_fallback(f32Img, f32Img, f32Img) }},
+		{"BaseMaxImage_fallback_Float64", func() { BaseMaxImage_fallback_Float64(f64Img, f64Img, f64Img) }},
+		{"BaseMinImage_fallback_Float16", func() { BaseMinImage_fallback_Float16(f16Img, f16Img, f16Img) }},
+		{"BaseMinImage_fallback_BFloat16", func() { BaseMinImage_fallback_BFloat16(bf16Img, bf16Img, bf16Img) }},
+		{"BaseMinImage_fallback", func() { BaseMinImage_fallback(f32Img, f32Img, f32Img) }},
+		{"BaseMinImage_fallback_Float64", func() { BaseMinImage_fallback_Float64(f64Img, f64Img, f64Img) }},
+		{"BaseOffset_fallback_Float16", func() { BaseOffset_fallback_Float16(f16Img, f16Img, f16Scalar) }},
+		{"BaseOffset_fallback_BFloat16", func() { BaseOffset_fallback_BFloat16(bf16Img, bf16Img, bf16Scalar) }},
+		{"BaseOffset_fallback", func() { BaseOffset_fallback(f32Img, f32Img, f32Scalar) }},
+		{"BaseOffset_fallback_Float64", func() { BaseOffset_fallback_Float64(f64Img, f64Img, f64Scalar) }},
+		{"BaseScale_fallback_Float16", func() { BaseScale_fallback_Float16(f16Img, f16Img, f16Scalar) }},
+		{"BaseScale_fallback_BFloat16", func() { BaseScale_fallback_BFloat16(bf16Img, bf16Img, bf16Scalar) }},
+		{"BaseScale_fallback", func() { BaseScale_fallback(f32Img, f32Img, f32Scalar) }},
+		{"BaseScale_fallback_Float64", func() { BaseScale_fallback_Float64(f64Img, f64Img, f64Scalar) }},
+		{"BaseThreshold_fallback_Float16", func() { BaseThreshold_fallback_Float16(f16Img, f16Img, f16Scalar, f16Scalar, f16Scalar) }},
+		{"BaseThreshold_fallback_BFloat16", func() { BaseThreshold_fallback_BFloat16(bf16Img, bf16Img, bf16Scalar, bf16Scalar, bf16Scalar) }},
+		{"BaseThreshold_fallback", func() { BaseThreshold_fallback(f32Img, f32Img, f32Scalar, f32Scalar, f32Scalar) }},
+		{"BaseThreshold_fallback_Float64", func() { BaseThreshold_fallback_Float64(f64Img, f64Img, f64Scalar, f64Scalar, f64Scalar) }},
+		{"BaseConvolveRow_fallback", func() { BaseConvolveRow_fallback(f32, f32[:3], f32, allocTestDim) }},
+		{"BaseConvolveRow_fallback_Float64", func() { BaseConvolveRow_fallback_Float64(f64, f64[:3], f64, allocTestDim) }},
+		{"BaseConvolveVertical_fallback", func() { BaseConvolveVertical_fallback(f32, allocTestDim, 1, f32[:3], f32, allocTestDim) }},
+		{"BaseConvolveVertical_fallback_Float64", func() {
+			BaseConvolveVertical_fallback_Float64(f64, allocTestDim, 1, f64[:3], f64, allocTestDim)
+		}},
+		{"BaseConvolve2DRow_fallback", func() { BaseConvolve2DRow_fallback(f32, allocTestDim+2, 1, f32[:9], 3, f32, allocTestDim) }},
+		{"BaseConvolve2DRow_fallback_Float64", func() {
+			BaseConvolve2DRow_fallback_Float64(f64, allocTestDim+2, 1, f64[:9], 3, f64, allocTestDim)
+		}},
+		{"BaseSobelRow_fallback", func() { BaseSobelRow_fallback(f32, f32, f32, f32, f32, allocTestDim) }},
+		{"BaseSobelRow_fallback_Float64", func() { BaseSobelRow_fallback_Float64(f64, f64, f64, f64, f64, allocTestDim) }},
+		{"BaseSlideSum_fallback", func() { BaseSlideSum_fallback(f32, f32, f32, f32, f32Scalar, allocTestDim) }},
+		{"BaseSlideSum_fallback_Float64", func() { BaseSlideSum_fallback_Float64(f64, f64, f64, f64, f64Scalar, allocTestDim) }},
+		{"BaseGradientMagnitudeRow_fallback", func() { BaseGradientMagnitudeRow_fallback(f32, f32, f32, allocTestDim) }},
+		{"BaseGradientMagnitudeRow_fallback_Float64", func() { BaseGradientMagnitudeRow_fallback_Float64(f64, f64, f64, allocTestDim) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
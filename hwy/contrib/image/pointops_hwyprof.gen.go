@@ -0,0 +1,312 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package image
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("image", "Abs", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := AbsFloat16; hwyImpl != nil {
+			AbsFloat16 = func(img *Image[hwy.Float16], out *Image[hwy.Float16]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := AbsBFloat16; hwyImpl != nil {
+			AbsBFloat16 = func(img *Image[hwy.BFloat16], out *Image[hwy.BFloat16]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := AbsFloat32; hwyImpl != nil {
+			AbsFloat32 = func(img *Image[float32], out *Image[float32]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := AbsFloat64; hwyImpl != nil {
+			AbsFloat64 = func(img *Image[float64], out *Image[float64]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "BrightnessContrast", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := BrightnessContrastFloat16; hwyImpl != nil {
+			BrightnessContrastFloat16 = func(img *Image[hwy.Float16], out *Image[hwy.Float16], scale hwy.Float16, offset hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, scale, offset)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := BrightnessContrastBFloat16; hwyImpl != nil {
+			BrightnessContrastBFloat16 = func(img *Image[hwy.BFloat16], out *Image[hwy.BFloat16], scale hwy.BFloat16, offset hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, scale, offset)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := BrightnessContrastFloat32; hwyImpl != nil {
+			BrightnessContrastFloat32 = func(img *Image[float32], out *Image[float32], scale float32, offset float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, scale, offset)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := BrightnessContrastFloat64; hwyImpl != nil {
+			BrightnessContrastFloat64 = func(img *Image[float64], out *Image[float64], scale float64, offset float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, scale, offset)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "ClampImage", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ClampImageFloat16; hwyImpl != nil {
+			ClampImageFloat16 = func(img *Image[hwy.Float16], out *Image[hwy.Float16], minVal hwy.Float16, maxVal hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, minVal, maxVal)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ClampImageBFloat16; hwyImpl != nil {
+			ClampImageBFloat16 = func(img *Image[hwy.BFloat16], out *Image[hwy.BFloat16], minVal hwy.BFloat16, maxVal hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, minVal, maxVal)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ClampImageFloat32; hwyImpl != nil {
+			ClampImageFloat32 = func(img *Image[float32], out *Image[float32], minVal float32, maxVal float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, minVal, maxVal)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ClampImageFloat64; hwyImpl != nil {
+			ClampImageFloat64 = func(img *Image[float64], out *Image[float64], minVal float64, maxVal float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, minVal, maxVal)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "Gamma", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := GammaFloat16; hwyImpl != nil {
+			GammaFloat16 = func(img *Image[hwy.Float16], out *Image[hwy.Float16], gamma hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, gamma)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := GammaBFloat16; hwyImpl != nil {
+			GammaBFloat16 = func(img *Image[hwy.BFloat16], out *Image[hwy.BFloat16], gamma hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, gamma)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := GammaFloat32; hwyImpl != nil {
+			GammaFloat32 = func(img *Image[float32], out *Image[float32], gamma float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, gamma)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := GammaFloat64; hwyImpl != nil {
+			GammaFloat64 = func(img *Image[float64], out *Image[float64], gamma float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, gamma)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "Invert", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := InvertFloat16; hwyImpl != nil {
+			InvertFloat16 = func(img *Image[hwy.Float16], out *Image[hwy.Float16], maxVal hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, maxVal)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := InvertBFloat16; hwyImpl != nil {
+			InvertBFloat16 = func(img *Image[hwy.BFloat16], out *Image[hwy.BFloat16], maxVal hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, maxVal)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := InvertFloat32; hwyImpl != nil {
+			InvertFloat32 = func(img *Image[float32], out *Image[float32], maxVal float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, maxVal)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := InvertFloat64; hwyImpl != nil {
+			InvertFloat64 = func(img *Image[float64], out *Image[float64], maxVal float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, maxVal)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "MaxImage", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MaxImageFloat16; hwyImpl != nil {
+			MaxImageFloat16 = func(a *Image[hwy.Float16], b *Image[hwy.Float16], out *Image[hwy.Float16]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, out)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := MaxImageBFloat16; hwyImpl != nil {
+			MaxImageBFloat16 = func(a *Image[hwy.BFloat16], b *Image[hwy.BFloat16], out *Image[hwy.BFloat16]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, out)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := MaxImageFloat32; hwyImpl != nil {
+			MaxImageFloat32 = func(a *Image[float32], b *Image[float32], out *Image[float32]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, out)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := MaxImageFloat64; hwyImpl != nil {
+			MaxImageFloat64 = func(a *Image[float64], b *Image[float64], out *Image[float64]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, out)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "MinImage", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MinImageFloat16; hwyImpl != nil {
+			MinImageFloat16 = func(a *Image[hwy.Float16], b *Image[hwy.Float16], out *Image[hwy.Float16]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, out)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := MinImageBFloat16; hwyImpl != nil {
+			MinImageBFloat16 = func(a *Image[hwy.BFloat16], b *Image[hwy.BFloat16], out *Image[hwy.BFloat16]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, out)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := MinImageFloat32; hwyImpl != nil {
+			MinImageFloat32 = func(a *Image[float32], b *Image[float32], out *Image[float32]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, out)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := MinImageFloat64; hwyImpl != nil {
+			MinImageFloat64 = func(a *Image[float64], b *Image[float64], out *Image[float64]) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, out)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "Offset", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := OffsetFloat16; hwyImpl != nil {
+			OffsetFloat16 = func(img *Image[hwy.Float16], out *Image[hwy.Float16], offset hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, offset)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := OffsetBFloat16; hwyImpl != nil {
+			OffsetBFloat16 = func(img *Image[hwy.BFloat16], out *Image[hwy.BFloat16], offset hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, offset)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := OffsetFloat32; hwyImpl != nil {
+			OffsetFloat32 = func(img *Image[float32], out *Image[float32], offset float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, offset)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := OffsetFloat64; hwyImpl != nil {
+			OffsetFloat64 = func(img *Image[float64], out *Image[float64], offset float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, offset)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "Scale", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ScaleFloat16; hwyImpl != nil {
+			ScaleFloat16 = func(img *Image[hwy.Float16], out *Image[hwy.Float16], scale hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, scale)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ScaleBFloat16; hwyImpl != nil {
+			ScaleBFloat16 = func(img *Image[hwy.BFloat16], out *Image[hwy.BFloat16], scale hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, scale)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ScaleFloat32; hwyImpl != nil {
+			ScaleFloat32 = func(img *Image[float32], out *Image[float32], scale float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, scale)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ScaleFloat64; hwyImpl != nil {
+			ScaleFloat64 = func(img *Image[float64], out *Image[float64], scale float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, scale)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+	hwy.ProfileDispatch("image", "Threshold", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ThresholdFloat16; hwyImpl != nil {
+			ThresholdFloat16 = func(img *Image[hwy.Float16], out *Image[hwy.Float16], threshold hwy.Float16, below hwy.Float16, above hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, threshold, below, above)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ThresholdBFloat16; hwyImpl != nil {
+			ThresholdBFloat16 = func(img *Image[hwy.BFloat16], out *Image[hwy.BFloat16], threshold hwy.BFloat16, below hwy.BFloat16, above hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, threshold, below, above)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ThresholdFloat32; hwyImpl != nil {
+			ThresholdFloat32 = func(img *Image[float32], out *Image[float32], threshold float32, below float32, above float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, threshold, below, above)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+		if hwyImpl := ThresholdFloat64; hwyImpl != nil {
+			ThresholdFloat64 = func(img *Image[float64], out *Image[float64], threshold float64, below float64, above float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(img, out, threshold, below, above)
+				hwyCounter.Done(hwyStart, 0, 0)
+			}
+		}
+	})
+}
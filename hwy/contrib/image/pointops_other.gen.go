@@ -215,6 +215,24 @@ func Threshold[T hwy.Floats](img *Image[T], out *Image[T], threshold T, below T,
 
 func init() {
 	initPointopsAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "image",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Abs", Vars: []any{&AbsFloat16, &AbsBFloat16, &AbsFloat32, &AbsFloat64}},
+			{Name: "BrightnessContrast", Vars: []any{&BrightnessContrastFloat16, &BrightnessContrastBFloat16, &BrightnessContrastFloat32, &BrightnessContrastFloat64}},
+			{Name: "ClampImage", Vars: []any{&ClampImageFloat16, &ClampImageBFloat16, &ClampImageFloat32, &ClampImageFloat64}},
+			{Name: "Gamma", Vars: []any{&GammaFloat16, &GammaBFloat16, &GammaFloat32, &GammaFloat64}},
+			{Name: "Invert", Vars: []any{&InvertFloat16, &InvertBFloat16, &InvertFloat32, &InvertFloat64}},
+			{Name: "MaxImage", Vars: []any{&MaxImageFloat16, &MaxImageBFloat16, &MaxImageFloat32, &MaxImageFloat64}},
+			{Name: "MinImage", Vars: []any{&MinImageFloat16, &MinImageBFloat16, &MinImageFloat32, &MinImageFloat64}},
+			{Name: "Offset", Vars: []any{&OffsetFloat16, &OffsetBFloat16, &OffsetFloat32, &OffsetFloat64}},
+			{Name: "Scale", Vars: []any{&ScaleFloat16, &ScaleBFloat16, &ScaleFloat32, &ScaleFloat64}},
+			{Name: "Threshold", Vars: []any{&ThresholdFloat16, &ThresholdBFloat16, &ThresholdFloat32, &ThresholdFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initPointopsFallback},
+		},
+	})
 }
 
 func initPointopsAll() {
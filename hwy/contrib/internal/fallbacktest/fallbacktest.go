@@ -0,0 +1,73 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package fallbacktest lists the kernels hwygen wrote to a package's
+// *_fallback.gen.go files, so per-package fallback tests can check that
+// they cover every generated kernel.
+package fallbacktest
+
+import (
+	"go/ast"
+	"go/parser"
+	"go/token"
+	"path/filepath"
+	"slices"
+	"testing"
+)
+
+// Kernels returns the sorted names of the functions declared in the
+// *_fallback.gen.go files of the current directory, which is the package
+// directory when run from a test.
+func Kernels(t testing.TB) []string {
+	t.Helper()
+	files, err := filepath.Glob("*_fallback.gen.go")
+	if err != nil {
+		t.Fatal(err)
+	}
+	if len(files) == 0 {
+		t.Fatal("no *_fallback.gen.go files in the package directory")
+	}
+	var names []string
+	fset := token.NewFileSet()
+	for _, file := range files {
+		f, err := parser.ParseFile(fset, file, nil, parser.SkipObjectResolution)
+		if err != nil {
+			t.Fatal(err)
+		}
+		for _, decl := range f.Decls {
+			if fn, ok := decl.(*ast.FuncDecl); ok && fn.Recv == nil {
+				names = append(names, fn.Name.Name)
+			}
+		}
+	}
+	slices.Sort(names)
+	return names
+}
+
+// CheckCovered reports every generated fallback kernel missing from
+// tested, and every name in tested that is not a generated kernel.
+func CheckCovered(t testing.TB, tested []string) {
+	t.Helper()
+	generated := Kernels(t)
+	for _, name := range generated {
+		if !slices.Contains(tested, name) {
+			t.Errorf("%s: generated fallback kernel not tested", name)
+		}
+	}
+	for _, name := range tested {
+		if _, found := slices.BinarySearch(generated, name); !found {
+			t.Errorf("%s: tested but not a generated fallback kernel", name)
+		}
+	}
+}
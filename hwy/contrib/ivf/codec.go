@@ -0,0 +1,326 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package ivf
+
+import (
+	"math"
+	"sync"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/quantize"
+	"github.com/ajroetker/go-highway/hwy/contrib/rabitq"
+	"github.com/ajroetker/go-highway/hwy/contrib/topk"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec"
+)
+
+// scanBlock is the number of vectors scored per kernel call while scanning
+// a list. It is a multiple of rabitq.FastScanBlockSize.
+const scanBlock = 256
+
+// Codec selects how the vectors of each inverted list are stored and
+// scored. FlatCodec, AsymmetricUint8Codec, SQ8Codec and RaBitQCodec are
+// provided; other encodings can be plugged in by implementing Codec and List.
+type Codec interface {
+	// NewList returns an empty list for the vectors assigned to centroid.
+	NewList(centroid []float32) List
+}
+
+// List holds the encoded vectors of one inverted list.
+//
+// Scan may be called concurrently; Append must not run concurrently with
+// any other method.
+type List interface {
+	// Len returns the number of vectors in the list.
+	Len() int
+
+	// Append encodes the len(ids) vectors in vectors (len(ids)×dims) and
+	// adds them to the list under ids.
+	Append(vectors []float32, ids []int64)
+
+	// Scan offers the squared L2 distance (exact or estimated, depending on
+	// the encoding) from query to every vector in the list to h.
+	Scan(query []float32, h *topk.Heap)
+}
+
+// FlatCodec stores vectors as raw float32 and scores them exactly.
+type FlatCodec struct{}
+
+// NewList implements Codec.
+func (FlatCodec) NewList(centroid []float32) List {
+	return &flatList{dims: len(centroid)}
+}
+
+type flatList struct {
+	dims    int
+	vectors []float32
+	ids     []int64
+}
+
+func (l *flatList) Len() int { return len(l.ids) }
+
+func (l *flatList) Append(vectors []float32, ids []int64) {
+	l.vectors = append(l.vectors, vectors[:len(ids)*l.dims]...)
+	l.ids = append(l.ids, ids...)
+}
+
+func (l *flatList) Scan(query []float32, h *topk.Heap) {
+	var dist [scanBlock]float32
+	for start := 0; start < len(l.ids); start += scanBlock {
+		n := min(scanBlock, len(l.ids)-start)
+		vec.BatchL2SquaredDistanceFloat32(query, l.vectors[start*l.dims:(start+n)*l.dims], dist[:n], n, l.dims)
+		h.PushBatch(dist[:n], l.ids[start:start+n])
+	}
+}
+
+// AsymmetricUint8Codec stores each vector as uint8 codes (a quarter of the
+// memory of FlatCodec) under an asymmetric, or affine, quantizer: a
+// per-vector minimum and scale map the vector's [min, max] range onto
+// 0..255, so one-sided vectors use the full code range.
+//
+// Distances are asymmetric as well: queries stay float32, and the stored
+// vectors are dequantized a block at a time and scored with
+// BatchL2SquaredDistance. SQ8Codec takes the same memory and scores codes
+// with an integer dot product instead.
+type AsymmetricUint8Codec struct{}
+
+// NewList implements Codec.
+func (AsymmetricUint8Codec) NewList(centroid []float32) List {
+	return &asymmetricUint8List{dims: len(centroid)}
+}
+
+type asymmetricUint8List struct {
+	dims   int
+	codes  []uint8
+	mins   []float32
+	scales []float32
+	ids    []int64
+}
+
+// uint8ScanBlock is the number of vectors dequantized at a time.
+const uint8ScanBlock = 32
+
+var dequantPool = sync.Pool{
+	New: func() any { return &[]float32{} },
+}
+
+func (l *asymmetricUint8List) Len() int { return len(l.ids) }
+
+func (l *asymmetricUint8List) Append(vectors []float32, ids []int64) {
+	d := l.dims
+	off := len(l.codes)
+	l.codes = append(l.codes, make([]uint8, len(ids)*d)...)
+	for i := range ids {
+		v := vectors[i*d : (i+1)*d]
+		lo, hi := vec.MinMaxFloat32(v)
+		scale := (hi - lo) / 255
+		if scale == 0 {
+			scale = 1
+		}
+		quantize.QuantizeFloat32(v, l.codes[off+i*d:off+(i+1)*d], lo, scale)
+		l.mins = append(l.mins, lo)
+		l.scales = append(l.scales, scale)
+	}
+	l.ids = append(l.ids, ids...)
+}
+
+func (l *asymmetricUint8List) Scan(query []float32, h *topk.Heap) {
+	d := l.dims
+	bufp := dequantPool.Get().(*[]float32)
+	if cap(*bufp) < uint8ScanBlock*d {
+		*bufp = make([]float32, uint8ScanBlock*d)
+	}
+	buf := (*bufp)[:uint8ScanBlock*d]
+	var dist [uint8ScanBlock]float32
+	for start := 0; start < len(l.ids); start += uint8ScanBlock {
+		n := min(uint8ScanBlock, len(l.ids)-start)
+		for j := range n {
+			i := start + j
+			quantize.DequantizeUint8(l.codes[i*d:(i+1)*d], buf[j*d:(j+1)*d], l.mins[i], l.scales[i])
+		}
+		vec.BatchL2SquaredDistanceFloat32(query, buf[:n*d], dist[:n], n, d)
+		h.PushBatch(dist[:n], l.ids[start:start+n])
+	}
+	dequantPool.Put(bufp)
+}
+
+// SQ8Codec stores each vector as the int8 codes of a per-vector
+// quantize.ScalarQuantizer (SQ8), one byte per dimension plus its
+// ScalarFactors. Scan quantizes the query once per list and scores every
+// code with an int8 integer dot product and a few per-vector corrections,
+// without dequantizing the stored vectors.
+type SQ8Codec struct{}
+
+// NewList implements Codec.
+func (SQ8Codec) NewList(centroid []float32) List {
+	return &sq8List{q: quantize.NewScalarQuantizer(len(centroid), 8)}
+}
+
+type sq8List struct {
+	q       *quantize.ScalarQuantizer
+	codes   []uint8
+	factors []quantize.ScalarFactors
+	ids     []int64
+}
+
+func (l *sq8List) Len() int { return len(l.ids) }
+
+func (l *sq8List) Append(vectors []float32, ids []int64) {
+	n, size := len(ids), l.q.CodeSize()
+	off := len(l.ids)
+	l.codes = append(l.codes, make([]uint8, n*size)...)
+	l.factors = append(l.factors, make([]quantize.ScalarFactors, n)...)
+	l.q.Encode(nil, vectors, n, l.codes[off*size:], l.factors[off:])
+	l.ids = append(l.ids, ids...)
+}
+
+func (l *sq8List) Scan(query []float32, h *topk.Heap) {
+	if len(l.ids) == 0 {
+		return
+	}
+	size := l.q.CodeSize()
+	sq := l.q.NewQuery(query)
+	var dist [scanBlock]float32
+	for start := 0; start < len(l.ids); start += scanBlock {
+		n := min(scanBlock, len(l.ids)-start)
+		sq.BatchL2SquaredDistance(l.codes[start*size:(start+n)*size], l.factors[start:start+n], dist[:n], n)
+		h.PushBatch(dist[:n], l.ids[start:start+n])
+	}
+}
+
+// RaBitQCodec stores 1-bit RaBitQ codes of the residuals to the list
+// centroid in the FastScan layout, and scores them with the RaBitQ distance
+// estimator.
+type RaBitQCodec struct {
+	// Rerank keeps the raw vectors alongside the codes. Scan then computes
+	// exact distances for the candidates whose estimated lower bound beats
+	// the current k-th best distance, and offers only exact distances.
+	// Without it, Scan offers the estimates.
+	Rerank bool
+}
+
+// NewList implements Codec.
+func (c RaBitQCodec) NewList(centroid []float32) List {
+	return &rabitqList{centroid: centroid, dims: len(centroid), width: rabitq.CodeWidth(len(centroid)), rerank: c.Rerank}
+}
+
+type rabitqList struct {
+	centroid    []float32
+	dims, width int
+	codes       []uint64
+	packed      []uint8
+	dotProducts []float32
+	codeCounts  []uint32
+	norms       []float32
+	ids         []int64
+	rerank      bool
+	vectors     []float32 // raw vectors, kept if rerank is set
+}
+
+// rabitqScratch holds the per-query buffers of a RaBitQ list scan.
+type rabitqScratch struct {
+	unit     []float32
+	planes   []uint64
+	lut      []uint8
+	products [scanBlock]uint32
+	dist     [scanBlock]float32
+	lower    [scanBlock]float32
+	selected [scanBlock]int32
+}
+
+var rabitqScratchPool = sync.Pool{
+	New: func() any { return &rabitqScratch{} },
+}
+
+func (l *rabitqList) Len() int { return len(l.ids) }
+
+// residual writes (v - c)/‖v - c‖ to unit and returns ‖v - c‖. unit is left
+// zero if v equals c.
+func residual(v, c, unit []float32) float32 {
+	vec.SubToFloat32(unit, v, c)
+	norm := float32(math.Sqrt(float64(vec.SquaredNormFloat32(unit))))
+	if norm > 0 {
+		vec.ScaleFloat32(1/norm, unit)
+	}
+	return norm
+}
+
+func (l *rabitqList) Append(vectors []float32, ids []int64) {
+	d, n := l.dims, len(ids)
+	unit := make([]float32, n*d)
+	for i := range n {
+		l.norms = append(l.norms, residual(vectors[i*d:(i+1)*d], l.centroid, unit[i*d:(i+1)*d]))
+	}
+	off := len(l.ids)
+	l.codes = append(l.codes, make([]uint64, n*l.width)...)
+	l.dotProducts = append(l.dotProducts, make([]float32, n)...)
+	l.codeCounts = append(l.codeCounts, make([]uint32, n)...)
+	rabitq.QuantizeVectors(unit, l.codes[off*l.width:], l.dotProducts[off:], l.codeCounts[off:],
+		float32(1/math.Sqrt(float64(d))), n, d, l.width)
+	l.ids = append(l.ids, ids...)
+	if l.rerank {
+		l.vectors = append(l.vectors, vectors[:n*d]...)
+	}
+
+	// The FastScan layout interleaves FastScanBlockSize codes per block.
+	// Full blocks are left as they are; only the zero-padded last block
+	// and the blocks after it are packed.
+	first := off - off%rabitq.FastScanBlockSize
+	size := rabitq.FastScanPackedSize(len(l.ids), d)
+	l.packed = append(l.packed, make([]uint8, size-len(l.packed))...)
+	rabitq.PackFastScanCodes(l.codes[first*l.width:], len(l.ids)-first, d,
+		l.packed[first/rabitq.FastScanBlockSize*rabitq.FastScanBlockBytes(d):])
+}
+
+func (l *rabitqList) Scan(query []float32, h *topk.Heap) {
+	if len(l.ids) == 0 {
+		return
+	}
+	d, w := l.dims, l.width
+	groups := rabitq.FastScanGroups(d)
+	s := rabitqScratchPool.Get().(*rabitqScratch)
+	if cap(s.unit) < d {
+		s.unit = make([]float32, d)
+		s.planes = make([]uint64, 4*w)
+		s.lut = make([]uint8, 16*groups)
+	}
+	unit, planes, lut := s.unit[:d], s.planes[:4*w], s.lut[:16*groups]
+
+	qNorm := residual(query, l.centroid, unit)
+	q1, q2, q3, q4 := planes[:w], planes[w:2*w], planes[2*w:3*w], planes[3*w:]
+	f := rabitq.QuantizeQuery(unit, qNorm, q1, q2, q3, q4)
+	rabitq.BuildFastScanLUT(q1, q2, q3, q4, d, lut)
+
+	blockBytes := rabitq.FastScanBlockBytes(d)
+	for start := 0; start < len(l.ids); start += scanBlock {
+		n := min(scanBlock, len(l.ids)-start)
+		packed := l.packed[(start/rabitq.FastScanBlockSize)*blockBytes:]
+		rabitq.FastScan(packed, lut, d, n, s.products[:n])
+		rabitq.EstimateDistances(s.products[:n], l.codeCounts[start:start+n], l.dotProducts[start:start+n],
+			l.norms[start:start+n], f, s.dist[:n], s.lower[:n])
+		if !l.rerank {
+			h.PushBatch(s.dist[:n], l.ids[start:start+n])
+			continue
+		}
+		// Only candidates whose lower bound beats the current k-th best
+		// distance can enter the result; score those exactly.
+		m := topk.SelectLess(s.lower[:n], h.Threshold(), s.selected[:])
+		for _, j := range s.selected[:m] {
+			i := start + int(j)
+			if s.lower[j] < h.Threshold() {
+				h.Push(l.ids[i], vec.L2SquaredDistanceFloat32(query, l.vectors[i*d:(i+1)*d]))
+			}
+		}
+	}
+	rabitqScratchPool.Put(s)
+}
@@ -0,0 +1,60 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package ivf provides an inverted-file (IVF) approximate nearest neighbor
+// index built on the vec, rabitq and topk kernels.
+//
+// # Overview
+//
+// An IVF index partitions the data set with a coarse k-means quantizer.
+// Every vector is stored in the inverted list of its nearest centroid, and a
+// search scans only the nprobe lists whose centroids are nearest to the
+// query, trading recall for speed.
+//
+//   - KMeans - Parallel k-means training; the assignment step runs
+//     BatchL2SquaredDistance and Argmin for every vector on a worker pool
+//   - AssignNearest - Nearest-centroid assignment of a batch of vectors
+//   - Index.Add - Assign vectors to lists and encode them
+//   - Index.Search / SearchBatch - nprobe search with SIMD top-k selection
+//
+// # List Encodings
+//
+// The storage of each list is chosen by a Codec:
+//   - FlatCodec - Raw float32 vectors, exact distances
+//   - AsymmetricUint8Codec - 8-bit codes with a per-vector minimum and
+//     scale, scored against the float32 query
+//   - SQ8Codec - int8 codes from quantize.ScalarQuantizer, scored with an
+//     integer dot product against the quantized query
+//   - RaBitQCodec - 1-bit RaBitQ codes of the residuals to the centroid,
+//     scored with FastScan; distances are estimates unless Rerank is set,
+//     in which case candidates that pass the RaBitQ lower bound are
+//     rescored exactly
+//
+// Other encodings plug in by implementing Codec and List.
+//
+// # Example Usage
+//
+//	pool := workerpool.New(0)
+//	defer pool.Close()
+//
+//	index := ivf.Train(pool, train, numTrain, dims, 1024, ivf.FlatCodec{}, ivf.KMeansConfig{})
+//	index.Add(pool, vectors, ids)
+//	neighbors := index.Search(query, 10, 16) // top 10, probing 16 lists
+//
+// # Build Requirements
+//
+// The SIMD implementations require:
+//   - GOEXPERIMENT=simd build flag
+//   - AMD64 architecture with AVX2 or AVX-512 support, or ARM64 with NEON
+package ivf
@@ -0,0 +1,169 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package ivf
+
+import (
+	"github.com/ajroetker/go-highway/hwy/contrib/topk"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec"
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// Index is an inverted-file (IVF) index: vectors are partitioned into
+// lists by their nearest coarse centroid, and a search scans only the
+// nprobe lists whose centroids are nearest to the query.
+//
+// Searches may run concurrently with each other, but not with Add.
+type Index struct {
+	dims      int
+	centroids []float32
+	lists     []List
+	size      int
+}
+
+// New returns an empty index over the given coarse centroids (nlist×dims)
+// whose lists are created by codec.
+func New(centroids []float32, dims int, codec Codec) *Index {
+	if dims <= 0 || len(centroids) == 0 || len(centroids)%dims != 0 {
+		panic("ivf: centroids must hold a positive multiple of dims values")
+	}
+	nlist := len(centroids) / dims
+	x := &Index{dims: dims, centroids: centroids, lists: make([]List, nlist)}
+	for c := range x.lists {
+		x.lists[c] = codec.NewList(centroids[c*dims : (c+1)*dims])
+	}
+	return x
+}
+
+// Train runs KMeans on count training vectors to find nlist coarse
+// centroids and returns an empty index over them.
+func Train(pool workerpool.Executor, data []float32, count, dims, nlist int, codec Codec, cfg KMeansConfig) *Index {
+	return New(KMeans(pool, data, count, dims, nlist, cfg), dims, codec)
+}
+
+// Dims returns the vector dimensionality.
+func (x *Index) Dims() int {
+	return x.dims
+}
+
+// NumLists returns the number of inverted lists.
+func (x *Index) NumLists() int {
+	return len(x.lists)
+}
+
+// Len returns the number of indexed vectors.
+func (x *Index) Len() int {
+	return x.size
+}
+
+// Centroids returns the coarse centroids (NumLists()×Dims()).
+func (x *Index) Centroids() []float32 {
+	return x.centroids
+}
+
+// List returns inverted list c.
+func (x *Index) List(c int) List {
+	return x.lists[c]
+}
+
+// Add assigns the len(ids) vectors in vectors to their nearest lists and
+// encodes them there. Assignment runs in parallel on pool, and so does
+// encoding, one list per task.
+func (x *Index) Add(pool workerpool.Executor, vectors []float32, ids []int64) {
+	count, d := len(ids), x.dims
+	if count == 0 {
+		return
+	}
+	assign := make([]int32, count)
+	AssignNearest(pool, vectors, x.centroids, count, d, len(x.lists), assign)
+
+	members := make([][]int32, len(x.lists))
+	for i, c := range assign {
+		members[c] = append(members[c], int32(i))
+	}
+	encode := func(c int) {
+		m := members[c]
+		if len(m) == 0 {
+			return
+		}
+		buf := make([]float32, len(m)*d)
+		listIDs := make([]int64, len(m))
+		for j, i := range m {
+			copy(buf[j*d:(j+1)*d], vectors[int(i)*d:(int(i)+1)*d])
+			listIDs[j] = ids[i]
+		}
+		x.lists[c].Append(buf, listIDs)
+	}
+	if pool == nil {
+		for c := range x.lists {
+			encode(c)
+		}
+	} else {
+		pool.ParallelForAtomic(len(x.lists), encode)
+	}
+	x.size += count
+}
+
+// Search returns the k nearest neighbors of query among the vectors of the
+// nprobe lists nearest to it, by increasing distance.
+func (x *Index) Search(query []float32, k, nprobe int) []topk.Neighbor {
+	h := topk.New(k)
+	x.search(query, h, x.newProbeScratch(nprobe))
+	return h.Sorted(nil)
+}
+
+// SearchBatch runs Search for each of the len(queries)/Dims() queries, in
+// parallel on pool, and returns their results in query order.
+func (x *Index) SearchBatch(pool workerpool.Executor, queries []float32, k, nprobe int) [][]topk.Neighbor {
+	d := x.dims
+	nq := len(queries) / d
+	results := make([][]topk.Neighbor, nq)
+	run := func(start, end int) {
+		h := topk.New(k)
+		s := x.newProbeScratch(nprobe)
+		for q := start; q < end; q++ {
+			h.Reset()
+			x.search(queries[q*d:(q+1)*d], h, s)
+			results[q] = h.Sorted(nil)
+		}
+	}
+	if pool == nil {
+		run(0, nq)
+	} else {
+		pool.ParallelForAtomicBatched(nq, 1, run)
+	}
+	return results
+}
+
+// probeScratch holds the per-query buffers of list selection.
+type probeScratch struct {
+	dist   []float32
+	probes *topk.Heap
+	order  []topk.Neighbor
+}
+
+func (x *Index) newProbeScratch(nprobe int) *probeScratch {
+	return &probeScratch{dist: make([]float32, len(x.lists)), probes: topk.New(nprobe)}
+}
+
+// search scans the lists nearest to query, nearest first, into h.
+func (x *Index) search(query []float32, h *topk.Heap, s *probeScratch) {
+	vec.BatchL2SquaredDistanceFloat32(query, x.centroids, s.dist, len(x.lists), x.dims)
+	s.probes.Reset()
+	s.probes.PushRange(s.dist, 0)
+	s.order = s.probes.Sorted(s.order[:0])
+	for _, p := range s.order {
+		x.lists[p.ID].Scan(query, h)
+	}
+}
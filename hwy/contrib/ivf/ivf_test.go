@@ -0,0 +1,264 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package ivf
+
+import (
+	"fmt"
+	"math/rand/v2"
+	"slices"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/topk"
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// clusteredData returns count vectors drawn around numClusters random
+// centers, which is the structure IVF relies on.
+func clusteredData(rng *rand.Rand, count, dims, numClusters int) []float32 {
+	centers := make([]float32, numClusters*dims)
+	for i := range centers {
+		centers[i] = float32(rng.NormFloat64()) * 4
+	}
+	data := make([]float32, count*dims)
+	for i := range count {
+		c := rng.IntN(numClusters)
+		for d := range dims {
+			data[i*dims+d] = centers[c*dims+d] + float32(rng.NormFloat64())
+		}
+	}
+	return data
+}
+
+// exactNeighbors returns the exact k nearest neighbors of query.
+func exactNeighbors(data, query []float32, dims, k int) []topk.Neighbor {
+	h := topk.New(k)
+	for i := range len(data) / dims {
+		var dist float32
+		for d := range dims {
+			diff := data[i*dims+d] - query[d]
+			dist += diff * diff
+		}
+		h.Push(int64(i), dist)
+	}
+	return h.Sorted(nil)
+}
+
+func recall(got, want []topk.Neighbor) float64 {
+	ids := make(map[int64]bool, len(want))
+	for _, n := range want {
+		ids[n.ID] = true
+	}
+	hits := 0
+	for _, n := range got {
+		if ids[n.ID] {
+			hits++
+		}
+	}
+	return float64(hits) / float64(len(want))
+}
+
+func sequentialIDs(n int) []int64 {
+	ids := make([]int64, n)
+	for i := range ids {
+		ids[i] = int64(i)
+	}
+	return ids
+}
+
+func TestKMeans(t *testing.T) {
+	const count, dims, k = 2000, 16, 8
+	rng := rand.New(rand.NewPCG(1, 1))
+	data := clusteredData(rng, count, dims, k)
+
+	pool := workerpool.New(4)
+	defer pool.Close()
+	cfg := KMeansConfig{Seed: 7}
+	seq := KMeans(nil, data, count, dims, k, cfg)
+	par := KMeans(pool, data, count, dims, k, cfg)
+	for i := range seq {
+		if seq[i] != par[i] {
+			t.Fatalf("parallel training differs from sequential at %d: %v vs %v", i, par[i], seq[i])
+		}
+	}
+
+	// Every vector is nearer to its assigned centroid than to any other,
+	// and training reduces the quantization error below that of the
+	// initial centroids.
+	assign := make([]int32, count)
+	AssignNearest(pool, data, seq, count, dims, k, assign)
+	sqErr := func(centroids []float32) float64 {
+		a := make([]int32, count)
+		AssignNearest(nil, data, centroids, count, dims, k, a)
+		var e float64
+		for i, c := range a {
+			for d := range dims {
+				diff := float64(data[i*dims+d] - centroids[int(c)*dims+d])
+				e += diff * diff
+			}
+		}
+		return e
+	}
+	for i, c := range assign {
+		best := exactNeighbors(seq, data[i*dims:(i+1)*dims], dims, 1)[0]
+		if best.ID != int64(c) {
+			t.Fatalf("vector %d assigned to %d, nearest is %d", i, c, best.ID)
+		}
+	}
+	initial := KMeans(nil, data, count, dims, k, KMeansConfig{Seed: 7, Iterations: 1})
+	if trained, start := sqErr(seq), sqErr(initial); trained > start {
+		t.Errorf("training increased the error: %v > %v", trained, start)
+	}
+}
+
+func TestSearch(t *testing.T) {
+	const count, dims, nlist, k = 3000, 32, 16, 10
+	rng := rand.New(rand.NewPCG(2, 1))
+	data := clusteredData(rng, count, dims, 20)
+	queries := clusteredData(rng, 20, dims, 20)
+	pool := workerpool.New(4)
+	defer pool.Close()
+
+	codecs := []struct {
+		name      string
+		codec     Codec
+		minRecall float64
+	}{
+		{"Flat", FlatCodec{}, 0.99},
+		{"AsymmetricUint8", AsymmetricUint8Codec{}, 0.9},
+		{"SQ8", SQ8Codec{}, 0.9},
+		{"RaBitQ", RaBitQCodec{}, 0.2},
+		{"RaBitQRerank", RaBitQCodec{Rerank: true}, 0.97},
+	}
+	centroids := KMeans(pool, data, count, dims, nlist, KMeansConfig{Seed: 3})
+	for _, tc := range codecs {
+		t.Run(tc.name, func(t *testing.T) {
+			index := New(centroids, dims, tc.codec)
+			index.Add(pool, data, sequentialIDs(count))
+			if index.Len() != count {
+				t.Fatalf("Len = %d, want %d", index.Len(), count)
+			}
+			total := 0
+			for c := range index.NumLists() {
+				total += index.List(c).Len()
+			}
+			if total != count {
+				t.Fatalf("lists hold %d vectors, want %d", total, count)
+			}
+
+			nq := len(queries) / dims
+			batch := index.SearchBatch(pool, queries, k, nlist)
+			var sum float64
+			for q := range nq {
+				query := queries[q*dims : (q+1)*dims]
+				got := index.Search(query, k, nlist)
+				if len(got) != k {
+					t.Fatalf("query %d: %d results, want %d", q, len(got), k)
+				}
+				for i := range got {
+					if batch[q][i] != got[i] {
+						t.Fatalf("query %d: SearchBatch differs from Search", q)
+					}
+					if i > 0 && got[i].Dist < got[i-1].Dist {
+						t.Fatalf("query %d: results not sorted", q)
+					}
+				}
+				sum += recall(got, exactNeighbors(data, query, dims, k))
+			}
+			if r := sum / float64(nq); r < tc.minRecall {
+				t.Errorf("recall@%d with all lists probed = %.3f, want >= %.2f", k, r, tc.minRecall)
+			}
+		})
+	}
+}
+
+func TestSearchProbesNearestLists(t *testing.T) {
+	const count, dims, nlist = 2000, 8, 10
+	rng := rand.New(rand.NewPCG(4, 1))
+	data := clusteredData(rng, count, dims, nlist)
+	index := Train(nil, data, count, dims, nlist, FlatCodec{}, KMeansConfig{Seed: 5})
+	index.Add(nil, data, sequentialIDs(count))
+
+	// With one probe, every result lies in the list nearest to the query.
+	query := data[:dims]
+	assign := make([]int32, count)
+	AssignNearest(nil, data, index.Centroids(), count, dims, nlist, assign)
+	for _, n := range index.Search(query, 50, 1) {
+		if assign[n.ID] != assign[0] {
+			t.Fatalf("result %d is in list %d, want %d", n.ID, assign[n.ID], assign[0])
+		}
+	}
+
+	// Adding in several batches is equivalent to adding at once.
+	split := New(index.Centroids(), dims, FlatCodec{})
+	split.Add(nil, data[:1000*dims], sequentialIDs(1000))
+	ids := sequentialIDs(count)[1000:]
+	split.Add(nil, data[1000*dims:], ids)
+	a, b := index.Search(query, 20, 3), split.Search(query, 20, 3)
+	for i := range a {
+		if a[i] != b[i] {
+			t.Fatalf("rank %d: %v vs %v", i, a[i], b[i])
+		}
+	}
+}
+
+func TestRaBitQAppendIncremental(t *testing.T) {
+	const count, dims = 150, 40
+	rng := rand.New(rand.NewPCG(6, 1))
+	data := clusteredData(rng, count, dims, 4)
+	centroid := data[:dims]
+
+	whole := RaBitQCodec{}.NewList(centroid).(*rabitqList)
+	whole.Append(data, sequentialIDs(count))
+
+	// Batches that end mid-block exercise repacking the partial last block.
+	split := RaBitQCodec{}.NewList(centroid).(*rabitqList)
+	start := 0
+	for _, n := range []int{5, 40, 1, 31, 73} {
+		split.Append(data[start*dims:(start+n)*dims], sequentialIDs(count)[start:start+n])
+		start += n
+	}
+	if !slices.Equal(whole.packed, split.packed) {
+		t.Fatal("packed codes differ between one Append and several")
+	}
+}
+
+func BenchmarkSearch(b *testing.B) {
+	const count, dims, nlist = 20000, 128, 64
+	rng := rand.New(rand.NewPCG(1, 1))
+	data := clusteredData(rng, count, dims, 100)
+	queries := clusteredData(rng, 64, dims, 100)
+	pool := workerpool.New(0)
+	defer pool.Close()
+	centroids := KMeans(pool, data, count, dims, nlist, KMeansConfig{Iterations: 5})
+	for _, tc := range []struct {
+		name  string
+		codec Codec
+	}{
+		{"Flat", FlatCodec{}},
+		{"AsymmetricUint8", AsymmetricUint8Codec{}},
+		{"SQ8", SQ8Codec{}},
+		{"RaBitQ", RaBitQCodec{}},
+		{"RaBitQRerank", RaBitQCodec{Rerank: true}},
+	} {
+		index := New(centroids, dims, tc.codec)
+		index.Add(pool, data, sequentialIDs(count))
+		b.Run(fmt.Sprintf("%s/nprobe=8", tc.name), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				q := i % 64
+				index.Search(queries[q*dims:(q+1)*dims], 10, 8)
+			}
+		})
+	}
+}
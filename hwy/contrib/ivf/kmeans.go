@@ -0,0 +1,116 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package ivf
+
+import (
+	"math/rand/v2"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/vec"
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// DefaultIterations is the default number of k-means iterations.
+const DefaultIterations = 20
+
+// MinParallelAssignOps is the minimum count*k*dims before AssignNearest
+// splits the vectors across the pool.
+const MinParallelAssignOps = 1 << 16
+
+// assignBatch is the number of vectors handed to a worker at a time.
+const assignBatch = 64
+
+// KMeansConfig controls KMeans training.
+type KMeansConfig struct {
+	// Iterations is the number of Lloyd iterations (DefaultIterations if 0).
+	Iterations int
+
+	// Seed seeds the choice of initial centroids and the reseeding of empty
+	// clusters, making training deterministic.
+	Seed uint64
+}
+
+// KMeans clusters count vectors of dims components into k clusters and
+// returns the k×dims centroids.
+//
+// Each iteration assigns every vector to its nearest centroid with
+// BatchL2SquaredDistance and Argmin, in parallel on pool, then moves every
+// centroid to the mean of its vectors. Initial centroids are k distinct
+// training vectors; a cluster that becomes empty is reseeded with a random
+// training vector.
+func KMeans(pool workerpool.Executor, data []float32, count, dims, k int, cfg KMeansConfig) []float32 {
+	if k <= 0 || dims <= 0 {
+		panic("ivf: k and dims must be positive")
+	}
+	if count < k {
+		panic("ivf: fewer training vectors than clusters")
+	}
+	iterations := cfg.Iterations
+	if iterations <= 0 {
+		iterations = DefaultIterations
+	}
+	rng := rand.New(rand.NewPCG(cfg.Seed, 0x9e3779b97f4a7c15))
+
+	centroids := make([]float32, k*dims)
+	for c, i := range rng.Perm(count)[:k] {
+		copy(centroids[c*dims:(c+1)*dims], data[i*dims:(i+1)*dims])
+	}
+
+	assign := make([]int32, count)
+	sizes := make([]int, k)
+	for range iterations {
+		AssignNearest(pool, data, centroids, count, dims, k, assign)
+
+		clear(centroids)
+		clear(sizes)
+		for i, c := range assign {
+			vec.AddFloat32(centroids[int(c)*dims:(int(c)+1)*dims], data[i*dims:(i+1)*dims])
+			sizes[c]++
+		}
+		for c, n := range sizes {
+			centroid := centroids[c*dims : (c+1)*dims]
+			if n == 0 {
+				i := rng.IntN(count)
+				copy(centroid, data[i*dims:(i+1)*dims])
+				continue
+			}
+			vec.ScaleFloat32(1/float32(n), centroid)
+		}
+	}
+	return centroids
+}
+
+// AssignNearest writes to assign[i] the index of the centroid (of k, each
+// dims components) nearest to vector i of data in squared L2 distance.
+//
+// Falls back to sequential execution when pool is nil or the work is below
+// MinParallelAssignOps.
+func AssignNearest(pool workerpool.Executor, data, centroids []float32, count, dims, k int, assign []int32) {
+	if count == 0 {
+		return
+	}
+	_ = assign[count-1]
+	run := func(start, end int) {
+		dist := make([]float32, k)
+		for i := start; i < end; i++ {
+			vec.BatchL2SquaredDistanceFloat32(data[i*dims:(i+1)*dims], centroids, dist, k, dims)
+			assign[i] = int32(vec.ArgminFloat32(dist))
+		}
+	}
+	if pool == nil || count*k*dims < MinParallelAssignOps {
+		run(0, count)
+		return
+	}
+	pool.ParallelForAtomicBatched(count, assignBatch, run)
+}
@@ -0,0 +1,56 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package knn
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var L2FromDots func(dots []float32, norms []float32, queryNorm float32)
+
+func init() {
+	initDistanceAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "knn",
+		Groups: []hwy.DispatchGroup{
+			{Name: "L2FromDots", Vars: []any{&L2FromDots}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initDistanceAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initDistanceAVX2},
+			{Name: "fallback", Supported: true, Init: initDistanceFallback},
+		},
+	})
+}
+
+func initDistanceAll() {
+	if hwy.NoSimdEnv() {
+		initDistanceFallback()
+		return
+	}
+	if archsimd.X86.AVX512() {
+		initDistanceAVX512()
+		return
+	}
+	if archsimd.X86.AVX2() {
+		initDistanceAVX2()
+		return
+	}
+	initDistanceFallback()
+}
+
+func initDistanceAVX2() {
+	L2FromDots = BaseL2FromDots_avx2
+}
+
+func initDistanceAVX512() {
+	L2FromDots = BaseL2FromDots_avx512
+}
+
+func initDistanceFallback() {
+	L2FromDots = BaseL2FromDots_fallback
+}
@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package knn
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var L2FromDots func(dots []float32, norms []float32, queryNorm float32)
+
+func init() {
+	initDistanceAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "knn",
+		Groups: []hwy.DispatchGroup{
+			{Name: "L2FromDots", Vars: []any{&L2FromDots}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initDistanceNEON},
+			{Name: "fallback", Supported: true, Init: initDistanceFallback},
+		},
+	})
+}
+
+func initDistanceAll() {
+	if hwy.NoSimdEnv() {
+		initDistanceFallback()
+		return
+	}
+	initDistanceNEON()
+	return
+}
+
+func initDistanceNEON() {
+	L2FromDots = BaseL2FromDots_neon
+}
+
+func initDistanceFallback() {
+	L2FromDots = BaseL2FromDots_fallback
+}
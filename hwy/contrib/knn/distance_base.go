@@ -0,0 +1,47 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package knn
+
+//go:generate go run ../../../cmd/hwygen -input distance_base.go -output . -targets avx2,avx512,neon,fallback -dispatch distance
+
+import "github.com/ajroetker/go-highway/hwy"
+
+// BaseL2FromDots turns the dot products of one query with a tile of data
+// vectors into squared L2 distances, in place:
+//
+//	dots[j] = max(0, queryNorm + norms[j] - 2*dots[j])
+//
+// where queryNorm and norms[j] are the squared norms of the query and of
+// data vector j. The clamp removes small negative values produced by
+// rounding when a data vector equals the query.
+func BaseL2FromDots(dots, norms []float32, queryNorm float32) {
+	n := min(len(dots), len(norms))
+	qn := hwy.Set[float32](queryNorm)
+	minusTwo := hwy.Set[float32](-2)
+	zero := hwy.Zero[float32]()
+	lanes := qn.NumLanes()
+
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		vd := hwy.Load(dots[i:])
+		vn := hwy.Load(norms[i:])
+		result := hwy.MulAdd(minusTwo, vd, hwy.Add(vn, qn))
+		hwy.Store(hwy.Max(result, zero), dots[i:])
+	}
+
+	for ; i < n; i++ {
+		dots[i] = max(0, queryNorm+norms[i]-2*dots[i])
+	}
+}
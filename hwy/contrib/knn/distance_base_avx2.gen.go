@@ -0,0 +1,46 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package knn
+
+import (
+	"simd/archsimd"
+	"unsafe"
+)
+
+// Hoisted constants - pre-broadcasted at package init time
+var (
+	BaseL2FromDots_AVX2_minusTwo_f32 = archsimd.BroadcastFloat32x8(-2)
+)
+
+func BaseL2FromDots_avx2(dots []float32, norms []float32, queryNorm float32) {
+	n := min(len(dots), len(norms))
+	qn := archsimd.BroadcastFloat32x8(queryNorm)
+	minusTwo := BaseL2FromDots_AVX2_minusTwo_f32
+	zero := archsimd.BroadcastFloat32x8(0)
+	lanes := 8
+	var i int
+	i = 0
+	for ; i+lanes*4 <= n; i += lanes * 4 {
+		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dots[i])))
+		vn := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&norms[i])))
+		result := minusTwo.MulAdd(vd, vn.Add(qn))
+		result.Max(zero).Store((*[8]float32)(unsafe.Pointer(&dots[i])))
+		vd1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dots[i+8])))
+		vn1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&norms[i+8])))
+		result1 := minusTwo.MulAdd(vd1, vn1.Add(qn))
+		result1.Max(zero).Store((*[8]float32)(unsafe.Pointer(&dots[i+8])))
+		vd2 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dots[i+16])))
+		vn2 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&norms[i+16])))
+		result2 := minusTwo.MulAdd(vd2, vn2.Add(qn))
+		result2.Max(zero).Store((*[8]float32)(unsafe.Pointer(&dots[i+16])))
+		vd3 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dots[i+24])))
+		vn3 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&norms[i+24])))
+		result3 := minusTwo.MulAdd(vd3, vn3.Add(qn))
+		result3.Max(zero).Store((*[8]float32)(unsafe.Pointer(&dots[i+24])))
+	}
+	for ; i < n; i++ {
+		dots[i] = max(0, queryNorm+norms[i]-2*dots[i])
+	}
+}
@@ -0,0 +1,55 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package knn
+
+import (
+	"simd/archsimd"
+	"sync"
+	"unsafe"
+)
+
+// Hoisted constants - lazily initialized on first use to avoid init-time crashes
+var (
+	BaseL2FromDots_AVX512_minusTwo_f32 archsimd.Float32x16
+	_distanceBaseHoistOnce             sync.Once
+)
+
+func _distanceBaseInitHoistedConstants() {
+	_distanceBaseHoistOnce.Do(func() {
+		BaseL2FromDots_AVX512_minusTwo_f32 = archsimd.BroadcastFloat32x16(-2)
+	})
+}
+
+func BaseL2FromDots_avx512(dots []float32, norms []float32, queryNorm float32) {
+	_distanceBaseInitHoistedConstants()
+	n := min(len(dots), len(norms))
+	qn := archsimd.BroadcastFloat32x16(queryNorm)
+	minusTwo := BaseL2FromDots_AVX512_minusTwo_f32
+	zero := archsimd.BroadcastFloat32x16(0)
+	lanes := 16
+	var i int
+	i = 0
+	for ; i+lanes*4 <= n; i += lanes * 4 {
+		vd := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&dots[i])))
+		vn := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&norms[i])))
+		result := minusTwo.MulAdd(vd, vn.Add(qn))
+		result.Max(zero).Store((*[16]float32)(unsafe.Pointer(&dots[i])))
+		vd1 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&dots[i+16])))
+		vn1 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&norms[i+16])))
+		result1 := minusTwo.MulAdd(vd1, vn1.Add(qn))
+		result1.Max(zero).Store((*[16]float32)(unsafe.Pointer(&dots[i+16])))
+		vd2 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&dots[i+32])))
+		vn2 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&norms[i+32])))
+		result2 := minusTwo.MulAdd(vd2, vn2.Add(qn))
+		result2.Max(zero).Store((*[16]float32)(unsafe.Pointer(&dots[i+32])))
+		vd3 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&dots[i+48])))
+		vn3 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&norms[i+48])))
+		result3 := minusTwo.MulAdd(vd3, vn3.Add(qn))
+		result3.Max(zero).Store((*[16]float32)(unsafe.Pointer(&dots[i+48])))
+	}
+	for ; i < n; i++ {
+		dots[i] = max(0, queryNorm+norms[i]-2*dots[i])
+	}
+}
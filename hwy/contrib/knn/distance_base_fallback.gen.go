@@ -0,0 +1,20 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package knn
+
+func BaseL2FromDots_fallback(dots []float32, norms []float32, queryNorm float32) {
+	n := min(len(dots), len(norms))
+	qn := float32(queryNorm)
+	minusTwo := float32(-2)
+	zero := float32(0)
+	var i int
+	for i = 0; i < n; i++ {
+		vd := dots[i]
+		vn := norms[i]
+		result := minusTwo*vd + (vn + qn)
+		dots[i] = max(result, zero)
+	}
+	for ; i < n; i++ {
+		dots[i] = max(0, queryNorm+norms[i]-2*dots[i])
+	}
+}
@@ -0,0 +1,47 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package knn
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy/asm"
+)
+
+// Hoisted constants - pre-broadcasted at package init time
+var (
+	BaseL2FromDots_NEON_minusTwo_f32 = asm.BroadcastFloat32x4(-2)
+)
+
+func BaseL2FromDots_neon(dots []float32, norms []float32, queryNorm float32) {
+	n := min(len(dots), len(norms))
+	qn := asm.BroadcastFloat32x4(queryNorm)
+	minusTwo := BaseL2FromDots_NEON_minusTwo_f32
+	zero := asm.ZeroFloat32x4()
+	lanes := 4
+	var i int
+	i = 0
+	for ; i+lanes*4 <= n; i += lanes * 4 {
+		vd := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&dots[i])))
+		vn := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&norms[i])))
+		result := minusTwo.MulAdd(vd, vn.Add(qn))
+		result.Max(zero).Store((*[4]float32)(unsafe.Pointer(&dots[i])))
+		vd1 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&dots[i+4])))
+		vn1 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&norms[i+4])))
+		result1 := minusTwo.MulAdd(vd1, vn1.Add(qn))
+		result1.Max(zero).Store((*[4]float32)(unsafe.Pointer(&dots[i+4])))
+		vd2 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&dots[i+8])))
+		vn2 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&norms[i+8])))
+		result2 := minusTwo.MulAdd(vd2, vn2.Add(qn))
+		result2.Max(zero).Store((*[4]float32)(unsafe.Pointer(&dots[i+8])))
+		vd3 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&dots[i+12])))
+		vn3 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&norms[i+12])))
+		result3 := minusTwo.MulAdd(vd3, vn3.Add(qn))
+		result3.Max(zero).Store((*[4]float32)(unsafe.Pointer(&dots[i+12])))
+	}
+	for ; i < n; i++ {
+		dots[i] = max(0, queryNorm+norms[i]-2*dots[i])
+	}
+}
@@ -0,0 +1,21 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package knn
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("knn", "L2FromDots", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := L2FromDots; hwyImpl != nil {
+			L2FromDots = func(dots []float32, norms []float32, queryNorm float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dots, norms, queryNorm)
+				hwyCounter.Done(hwyStart, len(dots), hwy.SliceBytes(dots)+hwy.SliceBytes(norms))
+			}
+		}
+	})
+}
@@ -0,0 +1,32 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build !arm64 && !(amd64 && goexperiment.simd)
+
+package knn
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var L2FromDots func(dots []float32, norms []float32, queryNorm float32)
+
+func init() {
+	initDistanceAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "knn",
+		Groups: []hwy.DispatchGroup{
+			{Name: "L2FromDots", Vars: []any{&L2FromDots}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initDistanceFallback},
+		},
+	})
+}
+
+func initDistanceAll() {
+	initDistanceFallback()
+}
+
+func initDistanceFallback() {
+	L2FromDots = BaseL2FromDots_fallback
+}
@@ -0,0 +1,45 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package knn provides a brute-force k-nearest-neighbor engine for batches
+// of queries.
+//
+// # Overview
+//
+// Comparing Q queries against N data vectors one query at a time streams
+// the whole data set Q times. Search instead computes distances for a block
+// of queries against a cache-sized tile of data vectors at once, using the
+// matrix-multiply kernels and the identity
+//
+//	‖q − x‖² = ‖q‖² + ‖x‖² − 2·q·x
+//
+// with the data norms precomputed by NewDataset. Each query keeps a running
+// top-k (see package topk) that consumes every tile while it is in cache,
+// so the Q×N distance matrix is never materialized. Work is spread over a
+// workerpool.Executor.
+//
+//	ds := knn.NewDataset(data, dims)
+//	results := ds.Search(pool, queries, 10) // [][]topk.Neighbor per query
+//
+// # Kernels
+//
+//   - L2FromDots(dots, norms, queryNorm) - Convert a row of dot products to
+//     squared L2 distances in place
+//
+// # Build Requirements
+//
+// The SIMD implementations require:
+//   - GOEXPERIMENT=simd build flag
+//   - AMD64 architecture with AVX2 or AVX-512 support, or ARM64 with NEON
+package knn
@@ -0,0 +1,162 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package knn
+
+import (
+	"github.com/ajroetker/go-highway/hwy/contrib/matmul"
+	"github.com/ajroetker/go-highway/hwy/contrib/topk"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec"
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// Tiling parameters of the distance computation.
+const (
+	// QueryBlock is the number of queries whose distances are computed
+	// together against each data tile.
+	QueryBlock = 32
+
+	// tileBytes is the target size of one data tile, chosen so the tile
+	// stays in L2 while all queries of a block are scored against it.
+	tileBytes = 256 << 10
+
+	// minTile and maxTile bound the number of data vectors per tile.
+	minTile = 32
+	maxTile = 1024
+)
+
+// Dataset holds data vectors together with their squared norms, which are
+// computed once and reused by every search.
+//
+// A Dataset is immutable and safe for concurrent searches.
+type Dataset struct {
+	data  []float32
+	norms []float32
+	count int
+	dims  int
+}
+
+// NewDataset wraps count = len(data)/dims vectors of dims components and
+// precomputes their squared norms. data is retained, not copied.
+func NewDataset(data []float32, dims int) *Dataset {
+	if dims <= 0 || len(data)%dims != 0 {
+		panic("knn: data must hold a multiple of dims values")
+	}
+	count := len(data) / dims
+	norms := make([]float32, count)
+	for i := range norms {
+		norms[i] = vec.SquaredNormFloat32(data[i*dims : (i+1)*dims])
+	}
+	return &Dataset{data: data, norms: norms, count: count, dims: dims}
+}
+
+// Len returns the number of data vectors.
+func (ds *Dataset) Len() int {
+	return ds.count
+}
+
+// Dims returns the vector dimensionality.
+func (ds *Dataset) Dims() int {
+	return ds.dims
+}
+
+// KNN returns the k nearest data vectors (in squared L2 distance) of each
+// of the len(queries)/dims queries, by increasing distance. It is a
+// shorthand for NewDataset(data, dims).Search(pool, queries, k).
+func KNN(pool workerpool.Executor, queries, data []float32, dims, k int) [][]topk.Neighbor {
+	return NewDataset(data, dims).Search(pool, queries, k)
+}
+
+// tileSize returns the number of data vectors per tile for dims.
+func tileSize(dims int) int {
+	t := tileBytes / (4 * dims)
+	t = min(max(t, minTile), maxTile)
+	return t &^ 15
+}
+
+// Search returns the k nearest data vectors of each query by increasing
+// squared L2 distance. Neighbor IDs are data vector indices.
+//
+// Distances are computed a tile at a time as ‖q‖² + ‖x‖² − 2q·x, with the
+// q·x block of QueryBlock queries against one data tile produced by the
+// K-last GEMM. Each query keeps a running top-k that consumes the tile
+// while it is still in cache, so the full query×data distance matrix is
+// never materialized. The expansion rounds like any difference of large
+// terms: a distance carries an absolute error of a few ulps of ‖q‖²+‖x‖².
+//
+// Work is split across pool by query blocks; when there are fewer query
+// blocks than workers, the data is also split and the partial top-k
+// results are merged. A nil pool runs sequentially.
+func (ds *Dataset) Search(pool workerpool.Executor, queries []float32, k int) [][]topk.Neighbor {
+	d := ds.dims
+	nq := len(queries) / d
+	results := make([][]topk.Neighbor, nq)
+	if nq == 0 {
+		return results
+	}
+
+	queryNorms := make([]float32, nq)
+	for q := range queryNorms {
+		queryNorms[q] = vec.SquaredNormFloat32(queries[q*d : (q+1)*d])
+	}
+
+	tile := tileSize(d)
+	numTiles := (ds.count + tile - 1) / tile
+	qBlocks := (nq + QueryBlock - 1) / QueryBlock
+	parts := 1
+	if pool != nil && qBlocks < pool.NumWorkers() {
+		parts = max(1, min(numTiles, (pool.NumWorkers()+qBlocks-1)/qBlocks))
+	}
+	tilesPerPart := (numTiles + parts - 1) / parts
+
+	// heaps[q*parts+p] holds the top-k of query q over data part p.
+	heaps := make([]*topk.Heap, nq*parts)
+	for i := range heaps {
+		heaps[i] = topk.New(k)
+	}
+
+	task := func(t int) {
+		qb, p := t/parts, t%parts
+		q0, q1 := qb*QueryBlock, min((qb+1)*QueryBlock, nq)
+		n0, n1 := p*tilesPerPart*tile, min((p+1)*tilesPerPart*tile, ds.count)
+		dots := make([]float32, QueryBlock*tile)
+		for start := n0; start < n1; start += tile {
+			tn := min(tile, n1-start)
+			block := dots[:(q1-q0)*tn]
+			matmul.MatMulKLastBlockedFloat32(queries[q0*d:q1*d], ds.data[start*d:(start+tn)*d], block, q1-q0, tn, d)
+			for q := q0; q < q1; q++ {
+				row := block[(q-q0)*tn : (q-q0+1)*tn]
+				L2FromDots(row, ds.norms[start:start+tn], queryNorms[q])
+				heaps[q*parts+p].PushRange(row, int64(start))
+			}
+		}
+	}
+	numTasks := qBlocks * parts
+	if pool == nil {
+		for t := range numTasks {
+			task(t)
+		}
+	} else {
+		pool.ParallelForAtomic(numTasks, task)
+	}
+
+	for q := range nq {
+		h := heaps[q*parts]
+		for p := 1; p < parts; p++ {
+			h.Merge(heaps[q*parts+p])
+		}
+		results[q] = h.Sorted(nil)
+	}
+	return results
+}
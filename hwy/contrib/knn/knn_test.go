@@ -0,0 +1,128 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package knn
+
+import (
+	"fmt"
+	"math"
+	"math/rand"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/topk"
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+func randomVectors(rng *rand.Rand, count, dims int) []float32 {
+	v := make([]float32, count*dims)
+	for i := range v {
+		v[i] = float32(rng.NormFloat64())
+	}
+	return v
+}
+
+// bruteForce computes exact neighbors one distance at a time.
+func bruteForce(queries, data []float32, dims, k int) [][]topk.Neighbor {
+	nq := len(queries) / dims
+	out := make([][]topk.Neighbor, nq)
+	for q := range nq {
+		h := topk.New(k)
+		for i := range len(data) / dims {
+			var dist float64
+			for d := range dims {
+				diff := float64(queries[q*dims+d]) - float64(data[i*dims+d])
+				dist += diff * diff
+			}
+			h.Push(int64(i), float32(dist))
+		}
+		out[q] = h.Sorted(nil)
+	}
+	return out
+}
+
+func TestL2FromDots(t *testing.T) {
+	rng := rand.New(rand.NewSource(1))
+	for _, n := range []int{0, 1, 7, 8, 33, 100} {
+		dots := make([]float32, n)
+		norms := make([]float32, n)
+		want := make([]float32, n)
+		for i := range dots {
+			dots[i] = rng.Float32()
+			norms[i] = rng.Float32()
+			want[i] = max(0, 0.5+norms[i]-2*dots[i])
+		}
+		L2FromDots(dots, norms, 0.5)
+		for i := range dots {
+			if math.Abs(float64(dots[i]-want[i])) > 1e-6 {
+				t.Fatalf("n=%d i=%d: got %v, want %v", n, i, dots[i], want[i])
+			}
+		}
+	}
+}
+
+func TestSearch(t *testing.T) {
+	rng := rand.New(rand.NewSource(2))
+	pool := workerpool.New(4)
+	defer pool.Close()
+	for _, tc := range []struct{ nq, count, dims, k int }{
+		{1, 100, 8, 5},
+		{3, 1000, 17, 10},
+		{40, 2500, 64, 10},
+		{70, 300, 300, 1},
+		{5, 3, 4, 10}, // k larger than the data set
+	} {
+		t.Run(fmt.Sprintf("q=%d/n=%d/d=%d/k=%d", tc.nq, tc.count, tc.dims, tc.k), func(t *testing.T) {
+			queries := randomVectors(rng, tc.nq, tc.dims)
+			data := randomVectors(rng, tc.count, tc.dims)
+			// Include exact matches to exercise the clamp at zero.
+			copy(data[:tc.dims], queries[:tc.dims])
+			want := bruteForce(queries, data, tc.dims, tc.k)
+			for _, p := range []workerpool.Executor{nil, pool} {
+				got := KNN(p, queries, data, tc.dims, tc.k)
+				for q := range want {
+					if len(got[q]) != len(want[q]) {
+						t.Fatalf("query %d: %d results, want %d", q, len(got[q]), len(want[q]))
+					}
+					for i := range want[q] {
+						g, w := got[q][i], want[q][i]
+						tol := 1e-3 * (1 + float64(w.Dist))
+						if math.Abs(float64(g.Dist-w.Dist)) > tol {
+							t.Fatalf("query %d rank %d: got %v, want %v", q, i, g, w)
+						}
+					}
+				}
+				// The expansion cancels to about ε·‖q‖² rather than exactly 0.
+				if got[0][0].ID != 0 || got[0][0].Dist > 1e-5*float32(tc.dims) {
+					t.Errorf("exact match: got %v, want id 0 at distance ~0", got[0][0])
+				}
+			}
+		})
+	}
+}
+
+func BenchmarkSearch(b *testing.B) {
+	const count, dims, k = 50000, 128, 10
+	rng := rand.New(rand.NewSource(1))
+	ds := NewDataset(randomVectors(rng, count, dims), dims)
+	pool := workerpool.New(0)
+	defer pool.Close()
+	for _, nq := range []int{1, 64} {
+		queries := randomVectors(rng, nq, dims)
+		b.Run(fmt.Sprintf("queries=%d", nq), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				ds.Search(pool, queries, k)
+			}
+		})
+	}
+}
@@ -16,6 +16,19 @@ var CutCrossEntropyWithLogits func(hiddenStates []float32, embeddings []float32,
 
 func init() {
 	initCutceAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "loss",
+		Groups: []hwy.DispatchGroup{
+			{Name: "CutCrossEntropy", Vars: []any{&CutCrossEntropy}},
+			{Name: "CutCrossEntropyGrad", Vars: []any{&CutCrossEntropyGrad}},
+			{Name: "CutCrossEntropyWithLogits", Vars: []any{&CutCrossEntropyWithLogits}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initCutceAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initCutceAVX2},
+			{Name: "fallback", Supported: true, Init: initCutceFallback},
+		},
+	})
 }
 
 func initCutceAll() {
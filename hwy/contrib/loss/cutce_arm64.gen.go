@@ -14,6 +14,18 @@ var CutCrossEntropyWithLogits func(hiddenStates []float32, embeddings []float32,
 
 func init() {
 	initCutceAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "loss",
+		Groups: []hwy.DispatchGroup{
+			{Name: "CutCrossEntropy", Vars: []any{&CutCrossEntropy}},
+			{Name: "CutCrossEntropyGrad", Vars: []any{&CutCrossEntropyGrad}},
+			{Name: "CutCrossEntropyWithLogits", Vars: []any{&CutCrossEntropyWithLogits}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initCutceNEONAsm},
+			{Name: "fallback", Supported: true, Init: initCutceFallback},
+		},
+	})
 }
 
 func initCutceAll() {
@@ -0,0 +1,41 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package loss
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("loss", "CutCrossEntropy", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := CutCrossEntropy; hwyImpl != nil {
+			CutCrossEntropy = func(hiddenStates []float32, embeddings []float32, labels []int32, numPositions int, hiddenDim int, vocabSize int) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(hiddenStates, embeddings, labels, numPositions, hiddenDim, vocabSize)
+				hwyCounter.Done(hwyStart, len(hiddenStates), hwy.SliceBytes(hiddenStates)+hwy.SliceBytes(embeddings)+hwy.SliceBytes(labels))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("loss", "CutCrossEntropyGrad", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := CutCrossEntropyGrad; hwyImpl != nil {
+			CutCrossEntropyGrad = func(hiddenStates []float32, embeddings []float32, labels []int32, gradOutput []float32, numPositions int, hiddenDim int, vocabSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(hiddenStates, embeddings, labels, gradOutput, numPositions, hiddenDim, vocabSize)
+				hwyCounter.Done(hwyStart, len(hiddenStates), hwy.SliceBytes(hiddenStates)+hwy.SliceBytes(embeddings)+hwy.SliceBytes(labels)+hwy.SliceBytes(gradOutput))
+			}
+		}
+	})
+	hwy.ProfileDispatch("loss", "CutCrossEntropyWithLogits", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := CutCrossEntropyWithLogits; hwyImpl != nil {
+			CutCrossEntropyWithLogits = func(hiddenStates []float32, embeddings []float32, labels []int32, perPositionLoss []float32, correctLogits []float32, numPositions int, hiddenDim int, vocabSize int) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(hiddenStates, embeddings, labels, perPositionLoss, correctLogits, numPositions, hiddenDim, vocabSize)
+				hwyCounter.Done(hwyStart, len(hiddenStates), hwy.SliceBytes(hiddenStates)+hwy.SliceBytes(embeddings)+hwy.SliceBytes(labels)+hwy.SliceBytes(perPositionLoss)+hwy.SliceBytes(correctLogits))
+				return hwyR0
+			}
+		}
+	})
+}
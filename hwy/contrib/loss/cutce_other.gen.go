@@ -4,12 +4,27 @@
 
 package loss
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var CutCrossEntropy func(hiddenStates []float32, embeddings []float32, labels []int32, numPositions int, hiddenDim int, vocabSize int) float32
 var CutCrossEntropyGrad func(hiddenStates []float32, embeddings []float32, labels []int32, gradOutput []float32, numPositions int, hiddenDim int, vocabSize int)
 var CutCrossEntropyWithLogits func(hiddenStates []float32, embeddings []float32, labels []int32, perPositionLoss []float32, correctLogits []float32, numPositions int, hiddenDim int, vocabSize int) float32
 
 func init() {
 	initCutceAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "loss",
+		Groups: []hwy.DispatchGroup{
+			{Name: "CutCrossEntropy", Vars: []any{&CutCrossEntropy}},
+			{Name: "CutCrossEntropyGrad", Vars: []any{&CutCrossEntropyGrad}},
+			{Name: "CutCrossEntropyWithLogits", Vars: []any{&CutCrossEntropyWithLogits}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initCutceFallback},
+		},
+	})
 }
 
 func initCutceAll() {
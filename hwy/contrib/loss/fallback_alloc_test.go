@@ -0,0 +1,58 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package loss
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		f32 = make([]float32, allocTestLen)
+		i32 = make([]int32, allocTestLen)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseCutCrossEntropy_fallback", func() { BaseCutCrossEntropy_fallback(f32, f32, i32, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseCutCrossEntropyGrad_fallback", func() { BaseCutCrossEntropyGrad_fallback(f32, f32, i32, f32, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseCutCrossEntropyWithLogits_fallback", func() {
+			BaseCutCrossEntropyWithLogits_fallback(f32, f32, i32, f32, f32, allocTestDim, allocTestDim, allocTestDim)
+		}},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
@@ -0,0 +1,124 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package math
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		f16     = make([]hwy.Float16, allocTestLen)
+		bf16    = make([]hwy.BFloat16, allocTestLen)
+		f32     = make([]float32, allocTestLen)
+		f64     = make([]float64, allocTestLen)
+		f16Vec  = hwy.Load(f16)
+		bf16Vec = hwy.Load(bf16)
+		f32Vec  = hwy.Load(f32)
+		f64Vec  = hwy.Load(f64)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseAcoshVec_fallback_Float16", func() { BaseAcoshVec_fallback_Float16(f16Vec) }},
+		{"BaseAcoshVec_fallback_BFloat16", func() { BaseAcoshVec_fallback_BFloat16(bf16Vec) }},
+		{"BaseAcoshVec_fallback", func() { BaseAcoshVec_fallback(f32Vec) }},
+		{"BaseAcoshVec_fallback_Float64", func() { BaseAcoshVec_fallback_Float64(f64Vec) }},
+		{"BaseAsinhVec_fallback_Float16", func() { BaseAsinhVec_fallback_Float16(f16Vec) }},
+		{"BaseAsinhVec_fallback_BFloat16", func() { BaseAsinhVec_fallback_BFloat16(bf16Vec) }},
+		{"BaseAsinhVec_fallback", func() { BaseAsinhVec_fallback(f32Vec) }},
+		{"BaseAsinhVec_fallback_Float64", func() { BaseAsinhVec_fallback_Float64(f64Vec) }},
+		{"BaseAtanhVec_fallback_Float16", func() { BaseAtanhVec_fallback_Float16(f16Vec) }},
+		{"BaseAtanhVec_fallback_BFloat16", func() { BaseAtanhVec_fallback_BFloat16(bf16Vec) }},
+		{"BaseAtanhVec_fallback", func() { BaseAtanhVec_fallback(f32Vec) }},
+		{"BaseAtanhVec_fallback_Float64", func() { BaseAtanhVec_fallback_Float64(f64Vec) }},
+		{"BaseCosVec_fallback_Float16", func() { BaseCosVec_fallback_Float16(f16Vec) }},
+		{"BaseCosVec_fallback_BFloat16", func() { BaseCosVec_fallback_BFloat16(bf16Vec) }},
+		{"BaseCosVec_fallback", func() { BaseCosVec_fallback(f32Vec) }},
+		{"BaseCosVec_fallback_Float64", func() { BaseCosVec_fallback_Float64(f64Vec) }},
+		{"BaseCoshVec_fallback_Float16", func() { BaseCoshVec_fallback_Float16(f16Vec) }},
+		{"BaseCoshVec_fallback_BFloat16", func() { BaseCoshVec_fallback_BFloat16(bf16Vec) }},
+		{"BaseCoshVec_fallback", func() { BaseCoshVec_fallback(f32Vec) }},
+		{"BaseCoshVec_fallback_Float64", func() { BaseCoshVec_fallback_Float64(f64Vec) }},
+		{"BaseErfVec_fallback_Float16", func() { BaseErfVec_fallback_Float16(f16Vec) }},
+		{"BaseErfVec_fallback_BFloat16", func() { BaseErfVec_fallback_BFloat16(bf16Vec) }},
+		{"BaseErfVec_fallback", func() { BaseErfVec_fallback(f32Vec) }},
+		{"BaseErfVec_fallback_Float64", func() { BaseErfVec_fallback_Float64(f64Vec) }},
+		{"BaseExp2Vec_fallback_Float16", func() { BaseExp2Vec_fallback_Float16(f16Vec) }},
+		{"BaseExp2Vec_fallback_BFloat16", func() { BaseExp2Vec_fallback_BFloat16(bf16Vec) }},
+		{"BaseExp2Vec_fallback", func() { BaseExp2Vec_fallback(f32Vec) }},
+		{"BaseExp2Vec_fallback_Float64", func() { BaseExp2Vec_fallback_Float64(f64Vec) }},
+		{"BaseExpVec_fallback_Float16", func() { BaseExpVec_fallback_Float16(f16Vec) }},
+		{"BaseExpVec_fallback_BFloat16", func() { BaseExpVec_fallback_BFloat16(bf16Vec) }},
+		{"BaseExpVec_fallback", func() { BaseExpVec_fallback(f32Vec) }},
+		{"BaseExpVec_fallback_Float64", func() { BaseExpVec_fallback_Float64(f64Vec) }},
+		{"BaseLog10Vec_fallback_Float16", func() { BaseLog10Vec_fallback_Float16(f16Vec) }},
+		{"BaseLog10Vec_fallback_BFloat16", func() { BaseLog10Vec_fallback_BFloat16(bf16Vec) }},
+		{"BaseLog10Vec_fallback", func() { BaseLog10Vec_fallback(f32Vec) }},
+		{"BaseLog10Vec_fallback_Float64", func() { BaseLog10Vec_fallback_Float64(f64Vec) }},
+		{"BaseLog2Vec_fallback_Float16", func() { BaseLog2Vec_fallback_Float16(f16Vec) }},
+		{"BaseLog2Vec_fallback_BFloat16", func() { BaseLog2Vec_fallback_BFloat16(bf16Vec) }},
+		{"BaseLog2Vec_fallback", func() { BaseLog2Vec_fallback(f32Vec) }},
+		{"BaseLog2Vec_fallback_Float64", func() { BaseLog2Vec_fallback_Float64(f64Vec) }},
+		{"BaseLogVec_fallback_Float16", func() { BaseLogVec_fallback_Float16(f16Vec) }},
+		{"BaseLogVec_fallback_BFloat16", func() { BaseLogVec_fallback_BFloat16(bf16Vec) }},
+		{"BaseLogVec_fallback", func() { BaseLogVec_fallback(f32Vec) }},
+		{"BaseLogVec_fallback_Float64", func() { BaseLogVec_fallback_Float64(f64Vec) }},
+		{"BasePowVec_fallback_Float16", func() { BasePowVec_fallback_Float16(f16Vec, f16Vec) }},
+		{"BasePowVec_fallback_BFloat16", func() { BasePowVec_fallback_BFloat16(bf16Vec, bf16Vec) }},
+		{"BasePowVec_fallback", func() { BasePowVec_fallback(f32Vec, f32Vec) }},
+		{"BasePowVec_fallback_Float64", func() { BasePowVec_fallback_Float64(f64Vec, f64Vec) }},
+		{"BaseSigmoidVec_fallback_Float16", func() { BaseSigmoidVec_fallback_Float16(f16Vec) }},
+		{"BaseSigmoidVec_fallback_BFloat16", func() { BaseSigmoidVec_fallback_BFloat16(bf16Vec) }},
+		{"BaseSigmoidVec_fallback", func() { BaseSigmoidVec_fallback(f32Vec) }},
+		{"BaseSigmoidVec_fallback_Float64", func() { BaseSigmoidVec_fallback_Float64(f64Vec) }},
+		{"BaseSinVec_fallback_Float16", func() { BaseSinVec_fallback_Float16(f16Vec) }},
+		{"BaseSinVec_fallback_BFloat16", func() { BaseSinVec_fallback_BFloat16(bf16Vec) }},
+		{"BaseSinVec_fallback", func() { BaseSinVec_fallback(f32Vec) }},
+		{"BaseSinVec_fallback_Float64", func() { BaseSinVec_fallback_Float64(f64Vec) }},
+		{"BaseSinhVec_fallback_Float16", func() { BaseSinhVec_fallback_Float16(f16Vec) }},
+		{"BaseSinhVec_fallback_BFloat16", func() { BaseSinhVec_fallback_BFloat16(bf16Vec) }},
+		{"BaseSinhVec_fallback", func() { BaseSinhVec_fallback(f32Vec) }},
+		{"BaseSinhVec_fallback_Float64", func() { BaseSinhVec_fallback_Float64(f64Vec) }},
+		{"BaseTanhVec_fallback_Float16", func() { BaseTanhVec_fallback_Float16(f16Vec) }},
+		{"BaseTanhVec_fallback_BFloat16", func() { BaseTanhVec_fallback_BFloat16(bf16Vec) }},
+		{"BaseTanhVec_fallback", func() { BaseTanhVec_fallback(f32Vec) }},
+		{"BaseTanhVec_fallback_Float64", func() { BaseTanhVec_fallback_Float64(f64Vec) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
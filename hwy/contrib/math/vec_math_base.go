@@ -246,10 +246,12 @@ func BaseSinVec[T hwy.Floats](x hwy.Vec[T]) hwy.Vec[T] {
 	useCosMask := hwy.Equal(hwy.And(octant, intOne), intOne)
 	negateMask := hwy.Equal(hwy.And(octant, intTwo), intTwo)
 
-	// Select between sin(r) and cos(r)
+	// Select between sin(r) and cos(r). A vector has at most 64 lanes, so
+	// the selection buffer lives on the stack.
 	sinRData := sinR.Data()
 	cosRData := cosR.Data()
-	resultData := make([]T, len(sinRData))
+	var resultBuf [64]T
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -315,10 +317,12 @@ func BaseCosVec[T hwy.Floats](x hwy.Vec[T]) hwy.Vec[T] {
 	useCosMask := hwy.Equal(hwy.And(cosOctant, intOne), intOne)
 	negateMask := hwy.Equal(hwy.And(cosOctant, intTwo), intTwo)
 
-	// Select between sin(r) and cos(r)
+	// Select between sin(r) and cos(r). A vector has at most 64 lanes, so
+	// the selection buffer lives on the stack.
 	sinRData := sinR.Data()
 	cosRData := cosR.Data()
-	resultData := make([]T, len(sinRData))
+	var resultBuf [64]T
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -389,7 +389,8 @@ func BaseCosVec_avx2_Float16(x asm.Float16x8AVX2) asm.Float16x8AVX2 {
 		cosR.StoreSlice(unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(_simd_tmp[:]))), len(_simd_tmp[:])))
 		return _simd_tmp[:]
 	}()
-	resultData := make([]hwy.Float16, len(sinRData))
+	var resultBuf [64]hwy.Float16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x8(1)
@@ -469,7 +470,8 @@ func BaseCosVec_avx2_BFloat16(x asm.BFloat16x8AVX2) asm.BFloat16x8AVX2 {
 		cosR.StoreSlice(unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(_simd_tmp[:]))), len(_simd_tmp[:])))
 		return _simd_tmp[:]
 	}()
-	resultData := make([]hwy.BFloat16, len(sinRData))
+	var resultBuf [64]hwy.BFloat16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x8(1)
@@ -549,7 +551,8 @@ func BaseCosVec_avx2(x archsimd.Float32x8) archsimd.Float32x8 {
 		cosR.StoreSlice(_simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]float32, len(sinRData))
+	var resultBuf [64]float32
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x8(1)
@@ -629,7 +632,8 @@ func BaseCosVec_avx2_Float64(x archsimd.Float64x4) archsimd.Float64x4 {
 		cosR.StoreSlice(_simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]float64, len(sinRData))
+	var resultBuf [64]float64
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x4(1)
@@ -1353,7 +1357,8 @@ func BaseSinVec_avx2_Float16(x asm.Float16x8AVX2) asm.Float16x8AVX2 {
 		cosR.StoreSlice(unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(_simd_tmp[:]))), len(_simd_tmp[:])))
 		return _simd_tmp[:]
 	}()
-	resultData := make([]hwy.Float16, len(sinRData))
+	var resultBuf [64]hwy.Float16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x8(1)
@@ -1433,7 +1438,8 @@ func BaseSinVec_avx2_BFloat16(x asm.BFloat16x8AVX2) asm.BFloat16x8AVX2 {
 		cosR.StoreSlice(unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(_simd_tmp[:]))), len(_simd_tmp[:])))
 		return _simd_tmp[:]
 	}()
-	resultData := make([]hwy.BFloat16, len(sinRData))
+	var resultBuf [64]hwy.BFloat16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x8(1)
@@ -1513,7 +1519,8 @@ func BaseSinVec_avx2(x archsimd.Float32x8) archsimd.Float32x8 {
 		cosR.StoreSlice(_simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]float32, len(sinRData))
+	var resultBuf [64]float32
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x8(1)
@@ -1593,7 +1600,8 @@ func BaseSinVec_avx2_Float64(x archsimd.Float64x4) archsimd.Float64x4 {
 		cosR.StoreSlice(_simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]float64, len(sinRData))
+	var resultBuf [64]float64
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x4(1)
@@ -595,7 +595,8 @@ func BaseCosVec_avx512_Float16(x asm.Float16x16AVX512) asm.Float16x16AVX512 {
 		cosR.StoreSlice(unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(_simd_tmp[:]))), len(_simd_tmp[:])))
 		return _simd_tmp[:]
 	}()
-	resultData := make([]hwy.Float16, len(sinRData))
+	var resultBuf [64]hwy.Float16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x16(1)
@@ -676,7 +677,8 @@ func BaseCosVec_avx512_BFloat16(x asm.BFloat16x16AVX512) asm.BFloat16x16AVX512 {
 		cosR.StoreSlice(unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(_simd_tmp[:]))), len(_simd_tmp[:])))
 		return _simd_tmp[:]
 	}()
-	resultData := make([]hwy.BFloat16, len(sinRData))
+	var resultBuf [64]hwy.BFloat16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x16(1)
@@ -757,7 +759,8 @@ func BaseCosVec_avx512(x archsimd.Float32x16) archsimd.Float32x16 {
 		cosR.StoreSlice(_simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]float32, len(sinRData))
+	var resultBuf [64]float32
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x16(1)
@@ -838,7 +841,8 @@ func BaseCosVec_avx512_Float64(x archsimd.Float64x8) archsimd.Float64x8 {
 		cosR.StoreSlice(_simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]float64, len(sinRData))
+	var resultBuf [64]float64
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x8(1)
@@ -1599,7 +1603,8 @@ func BaseSinVec_avx512_Float16(x asm.Float16x16AVX512) asm.Float16x16AVX512 {
 		cosR.StoreSlice(unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(_simd_tmp[:]))), len(_simd_tmp[:])))
 		return _simd_tmp[:]
 	}()
-	resultData := make([]hwy.Float16, len(sinRData))
+	var resultBuf [64]hwy.Float16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x16(1)
@@ -1680,7 +1685,8 @@ func BaseSinVec_avx512_BFloat16(x asm.BFloat16x16AVX512) asm.BFloat16x16AVX512 {
 		cosR.StoreSlice(unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(_simd_tmp[:]))), len(_simd_tmp[:])))
 		return _simd_tmp[:]
 	}()
-	resultData := make([]hwy.BFloat16, len(sinRData))
+	var resultBuf [64]hwy.BFloat16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x16(1)
@@ -1761,7 +1767,8 @@ func BaseSinVec_avx512(x archsimd.Float32x16) archsimd.Float32x16 {
 		cosR.StoreSlice(_simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]float32, len(sinRData))
+	var resultBuf [64]float32
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x16(1)
@@ -1842,7 +1849,8 @@ func BaseSinVec_avx512_Float64(x archsimd.Float64x8) archsimd.Float64x8 {
 		cosR.StoreSlice(_simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]float64, len(sinRData))
+	var resultBuf [64]float64
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := archsimd.BroadcastInt32x8(1)
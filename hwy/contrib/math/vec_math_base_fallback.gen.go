@@ -185,7 +185,8 @@ func BaseCosVec_fallback_Float16(x hwy.Vec[hwy.Float16]) hwy.Vec[hwy.Float16] {
 	negateMask := hwy.Equal(hwy.And(cosOctant, intTwo), intTwo)
 	sinRData := sinR.Data()
 	cosRData := cosR.Data()
-	resultData := make([]hwy.Float16, len(sinRData))
+	var resultBuf [64]hwy.Float16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -239,7 +240,8 @@ func BaseCosVec_fallback_BFloat16(x hwy.Vec[hwy.BFloat16]) hwy.Vec[hwy.BFloat16]
 	negateMask := hwy.Equal(hwy.And(cosOctant, intTwo), intTwo)
 	sinRData := sinR.Data()
 	cosRData := cosR.Data()
-	resultData := make([]hwy.BFloat16, len(sinRData))
+	var resultBuf [64]hwy.BFloat16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -293,7 +295,8 @@ func BaseCosVec_fallback(x hwy.Vec[float32]) hwy.Vec[float32] {
 	negateMask := hwy.Equal(hwy.And(cosOctant, intTwo), intTwo)
 	sinRData := sinR.Data()
 	cosRData := cosR.Data()
-	resultData := make([]float32, len(sinRData))
+	var resultBuf [64]float32
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -347,7 +350,8 @@ func BaseCosVec_fallback_Float64(x hwy.Vec[float64]) hwy.Vec[float64] {
 	negateMask := hwy.Equal(hwy.And(cosOctant, intTwo), intTwo)
 	sinRData := sinR.Data()
 	cosRData := cosR.Data()
-	resultData := make([]float64, len(sinRData))
+	var resultBuf [64]float64
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -1045,7 +1049,8 @@ func BaseSinVec_fallback_Float16(x hwy.Vec[hwy.Float16]) hwy.Vec[hwy.Float16] {
 	negateMask := hwy.Equal(hwy.And(octant, intTwo), intTwo)
 	sinRData := sinR.Data()
 	cosRData := cosR.Data()
-	resultData := make([]hwy.Float16, len(sinRData))
+	var resultBuf [64]hwy.Float16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -1099,7 +1104,8 @@ func BaseSinVec_fallback_BFloat16(x hwy.Vec[hwy.BFloat16]) hwy.Vec[hwy.BFloat16]
 	negateMask := hwy.Equal(hwy.And(octant, intTwo), intTwo)
 	sinRData := sinR.Data()
 	cosRData := cosR.Data()
-	resultData := make([]hwy.BFloat16, len(sinRData))
+	var resultBuf [64]hwy.BFloat16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -1153,7 +1159,8 @@ func BaseSinVec_fallback(x hwy.Vec[float32]) hwy.Vec[float32] {
 	negateMask := hwy.Equal(hwy.And(octant, intTwo), intTwo)
 	sinRData := sinR.Data()
 	cosRData := cosR.Data()
-	resultData := make([]float32, len(sinRData))
+	var resultBuf [64]float32
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -1207,7 +1214,8 @@ func BaseSinVec_fallback_Float64(x hwy.Vec[float64]) hwy.Vec[float64] {
 	negateMask := hwy.Equal(hwy.And(octant, intTwo), intTwo)
 	sinRData := sinR.Data()
 	cosRData := cosR.Data()
-	resultData := make([]float64, len(sinRData))
+	var resultBuf [64]float64
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
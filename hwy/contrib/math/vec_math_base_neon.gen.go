@@ -386,7 +386,8 @@ func BaseCosVec_neon_Float16(x hwy.Vec[hwy.Float16]) hwy.Vec[hwy.Float16] {
 		hwy.Store(cosR, _simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]hwy.Float16, len(sinRData))
+	var resultBuf [64]hwy.Float16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -452,7 +453,8 @@ func BaseCosVec_neon_BFloat16(x hwy.Vec[hwy.BFloat16]) hwy.Vec[hwy.BFloat16] {
 		hwy.Store(cosR, _simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]hwy.BFloat16, len(sinRData))
+	var resultBuf [64]hwy.BFloat16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -518,7 +520,8 @@ func BaseCosVec_neon(x asm.Float32x4) asm.Float32x4 {
 		cosR.StoreSlice(_simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]float32, len(sinRData))
+	var resultBuf [64]float32
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := asm.BroadcastInt32x4(1)
@@ -598,7 +601,8 @@ func BaseCosVec_neon_Float64(x asm.Float64x2) asm.Float64x2 {
 		cosR.StoreSlice(_simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]float64, len(sinRData))
+	var resultBuf [64]float64
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := asm.BroadcastInt32x2(1)
@@ -1322,7 +1326,8 @@ func BaseSinVec_neon_Float16(x hwy.Vec[hwy.Float16]) hwy.Vec[hwy.Float16] {
 		hwy.Store(cosR, _simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]hwy.Float16, len(sinRData))
+	var resultBuf [64]hwy.Float16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -1388,7 +1393,8 @@ func BaseSinVec_neon_BFloat16(x hwy.Vec[hwy.BFloat16]) hwy.Vec[hwy.BFloat16] {
 		hwy.Store(cosR, _simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]hwy.BFloat16, len(sinRData))
+	var resultBuf [64]hwy.BFloat16
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if useCosMask.GetBit(i) {
 			resultData[i] = cosRData[i]
@@ -1454,7 +1460,8 @@ func BaseSinVec_neon(x asm.Float32x4) asm.Float32x4 {
 		cosR.StoreSlice(_simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]float32, len(sinRData))
+	var resultBuf [64]float32
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := asm.BroadcastInt32x4(1)
@@ -1534,7 +1541,8 @@ func BaseSinVec_neon_Float64(x asm.Float64x2) asm.Float64x2 {
 		cosR.StoreSlice(_simd_tmp[:])
 		return _simd_tmp[:]
 	}()
-	resultData := make([]float64, len(sinRData))
+	var resultBuf [64]float64
+	resultData := resultBuf[:len(sinRData)]
 	for i := range sinRData {
 		if func() bool {
 			_vOne := asm.BroadcastInt32x2(1)
@@ -0,0 +1,268 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmul_c_f32_avx2_amd64.c
+
+TEXT ·matmul_c_f32_avx2(SB), $224-72
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ c+16(FP), DX
+	MOVQ pm+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_a+48(FP), R11
+	MOVQ R11, 192(SP)
+	MOVQ plen_b+56(FP), R11
+	MOVQ R11, 200(SP)
+	MOVQ plen_c+64(FP), R11
+	MOVQ R11, 208(SP)
+	QUAD $0x000000b024ac8d48             // leaq	176(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x20         // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348                     // andq	$-32, %rsp
+	WORD $0x8b48; BYTE $0x01             // movq	(%rcx), %rax
+	WORD $0x8b4d; BYTE $0x19             // movq	(%r9), %r11
+	LONG $0x247c8948; BYTE $0x70         // movq	%rdi, 112(%rsp)
+	WORD $0x8b49; BYTE $0x18             // movq	(%r8), %rbx
+	LONG $0x24448948; BYTE $0x40         // movq	%rax, 64(%rsp)
+	WORD $0x8548; BYTE $0xc0             // testq	%rax, %rax
+	JLE  BB0_36
+	WORD $0x8949; BYTE $0xf6             // movq	%rsi, %r14
+	WORD $0x3145; BYTE $0xe4             // xorl	%r12d, %r12d
+	WORD $0x8949; BYTE $0xd2             // movq	%rdx, %r10
+	WORD $0x8948; BYTE $0xd9             // movq	%rbx, %rcx
+	QUAD $0x000000009d048d4a             // leaq	0(,%r11,4), %rax
+	LONG $0x2464894c; BYTE $0x58         // movq	%r12, 88(%rsp)
+	LONG $0x5b148d48                     // leaq	(%rbx,%rbx,2), %rdx
+	LONG $0x04e1c148                     // salq	$4, %rcx
+	LONG $0x24448948; BYTE $0x38         // movq	%rax, 56(%rsp)
+	LONG $0x38048d4c                     // leaq	(%rax,%rdi), %r8
+	LONG $0xe0438d48                     // leaq	-32(%rbx), %rax
+	LONG $0x02e2c148                     // salq	$2, %rdx
+	LONG $0x05e8c148                     // shrq	$5, %rax
+	QUAD $0x0000008824bc8948             // movq	%rdi, 136(%rsp)
+	QUAD $0x000000009d348d48             // leaq	0(,%rbx,4), %rsi
+	LONG $0x01c08348                     // addq	$1, %rax
+	LONG $0x2474894c; BYTE $0x68         // movq	%r14, 104(%rsp)
+	QUAD $0x000000502444c748; BYTE $0x00 // movq	$0, 80(%rsp)
+	WORD $0x8949; BYTE $0xc7             // movq	%rax, %r15
+	LONG $0x05e0c148                     // salq	$5, %rax
+	LONG $0x24448948; BYTE $0x30         // movq	%rax, 48(%rsp)
+	LONG $0x08c08348                     // addq	$8, %rax
+	LONG $0x07e7c149                     // salq	$7, %r15
+	LONG $0x24448948; BYTE $0x28         // movq	%rax, 40(%rsp)
+	LONG $0xff438d49                     // leaq	-1(%r11), %rax
+	QUAD $0x0000008024848948             // movq	%rax, 128(%rsp)
+	WORD $0x894c; BYTE $0xd8             // movq	%r11, %rax
+	LONG $0x02e8c148                     // shrq	$2, %rax
+	LONG $0x247c894c; BYTE $0x20         // movq	%r15, 32(%rsp)
+	LONG $0x04e0c148                     // salq	$4, %rax
+	LONG $0x24448948; BYTE $0x18         // movq	%rax, 24(%rsp)
+	WORD $0x894c; BYTE $0xd8             // movq	%r11, %rax
+	LONG $0xfce08348                     // andq	$-4, %rax
+	LONG $0x24448948; BYTE $0x60         // movq	%rax, 96(%rsp)
+	WORD $0x894c; BYTE $0xd8             // movq	%r11, %rax
+	WORD $0xe083; BYTE $0x03             // andl	$3, %eax
+	LONG $0x24448948; BYTE $0x78         // movq	%rax, 120(%rsp)
+
+BB0_20:
+	WORD $0x3145; BYTE $0xe4     // xorl	%r12d, %r12d
+	LONG $0x000008bf; BYTE $0x00 // movl	$8, %edi
+	WORD $0xc031                 // xorl	%eax, %eax
+	LONG $0x1ffb8348             // cmpq	$31, %rbx
+	JLE  BB0_4
+	QUAD $0x00000098249c8948     // movq	%rbx, 152(%rsp)
+	LONG $0x247c8b4c; BYTE $0x68 // movq	104(%rsp), %r15
+	QUAD $0x00000090248c8948     // movq	%rcx, 144(%rsp)
+	QUAD $0x00000088248c8b48     // movq	136(%rsp), %rcx
+	LONG $0x24548948; BYTE $0x48 // movq	%rdx, 72(%rsp)
+	LONG $0x24548b48; BYTE $0x20 // movq	32(%rsp), %rdx
+
+BB0_3:
+	LONG $0x24748d4d; BYTE $0x20 // leaq	32(%r12), %r14
+	LONG $0x246c8d4d; BYTE $0x40 // leaq	64(%r12), %r13
+	LONG $0x245c8d49; BYTE $0x60 // leaq	96(%r12), %rbx
+	WORD $0x854d; BYTE $0xdb     // testq	%r11, %r11
+	JLE  BB0_39
+	LONG $0xe457d8c5             // vxorps	%xmm4, %xmm4, %xmm4
+	LONG $0x273c8d4b             // leaq	(%r15,%r12), %rdi
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	LONG $0xdc28fcc5             // vmovaps	%ymm4, %ymm3
+	LONG $0xd428fcc5             // vmovaps	%ymm4, %ymm2
+	LONG $0xcc28fcc5             // vmovaps	%ymm4, %ymm1
+
+BB0_5:
+	WORD $0x8949; BYTE $0xf9       // movq	%rdi, %r9
+	LONG $0x187de2c4; BYTE $0x00   // vbroadcastss	(%rax), %ymm0
+	LONG $0x04c08348               // addq	$4, %rax
+	WORD $0x294d; BYTE $0xe1       // subq	%r12, %r9
+	LONG $0xb87de2c4; BYTE $0x0f   // vfmadd231ps	(%rdi), %ymm0, %ymm1
+	WORD $0x0148; BYTE $0xf7       // addq	%rsi, %rdi
+	LONG $0xb87d82c4; WORD $0x3114 // vfmadd231ps	(%r9,%r14), %ymm0, %ymm2
+	LONG $0xb87d82c4; WORD $0x291c // vfmadd231ps	(%r9,%r13), %ymm0, %ymm3
+	LONG $0xb87dc2c4; WORD $0x1924 // vfmadd231ps	(%r9,%rbx), %ymm0, %ymm4
+	WORD $0x3949; BYTE $0xc0       // cmpq	%rax, %r8
+	JNE  BB0_5
+
+BB0_7:
+	LONG $0x117c81c4; WORD $0x220c             // vmovups	%ymm1, (%r10,%r12)
+	LONG $0x117c81c4; WORD $0x2254; BYTE $0x20 // vmovups	%ymm2, 32(%r10,%r12)
+	LONG $0x117c81c4; WORD $0x225c; BYTE $0x40 // vmovups	%ymm3, 64(%r10,%r12)
+	LONG $0x117c81c4; WORD $0x2264; BYTE $0x60 // vmovups	%ymm4, 96(%r10,%r12)
+	LONG $0x80ec8349                           // subq	$-128, %r12
+	WORD $0x394c; BYTE $0xe2                   // cmpq	%r12, %rdx
+	JNE  BB0_3
+	QUAD $0x00000098249c8b48                   // movq	152(%rsp), %rbx
+	QUAD $0x00000090248c8b48                   // movq	144(%rsp), %rcx
+	LONG $0x24548b48; BYTE $0x48               // movq	72(%rsp), %rdx
+	LONG $0x247c8b48; BYTE $0x28               // movq	40(%rsp), %rdi
+	LONG $0x24448b48; BYTE $0x30               // movq	48(%rsp), %rax
+
+BB0_4:
+	WORD $0x3948; BYTE $0xfb     // cmpq	%rdi, %rbx
+	JL   BB0_8
+	LONG $0x247c8b4c; BYTE $0x70 // movq	112(%rsp), %r15
+	LONG $0x24748b4c; BYTE $0x50 // movq	80(%rsp), %r14
+	WORD $0x8949; BYTE $0xfc     // movq	%rdi, %r12
+	LONG $0xb7348d4f             // leaq	(%r15,%r14,4), %r14
+
+BB0_9:
+	WORD $0x8949; BYTE $0xc7     // movq	%rax, %r15
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x894c; BYTE $0xe0     // movq	%r12, %rax
+	WORD $0x854d; BYTE $0xdb     // testq	%r11, %r11
+	JLE  BB0_12
+	LONG $0x244c8b4c; BYTE $0x68 // movq	104(%rsp), %r9
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0xb92c8d4f             // leaq	(%r9,%r15,4), %r13
+	WORD $0x894d; BYTE $0xf1     // movq	%r14, %r9
+
+BB0_10:
+	LONG $0x187dc2c4; BYTE $0x09   // vbroadcastss	(%r9), %ymm1
+	LONG $0x04c18349               // addq	$4, %r9
+	LONG $0xb875c2c4; WORD $0x0045 // vfmadd231ps	0(%r13), %ymm1, %ymm0
+	WORD $0x0149; BYTE $0xf5       // addq	%rsi, %r13
+	WORD $0x394d; BYTE $0xc8       // cmpq	%r9, %r8
+	JNE  BB0_10
+
+BB0_12:
+	LONG $0x08c48349               // addq	$8, %r12
+	LONG $0x117c81c4; WORD $0xba04 // vmovups	%ymm0, (%r10,%r15,4)
+	WORD $0x394c; BYTE $0xe3       // cmpq	%r12, %rbx
+	JGE  BB0_9
+	WORD $0x8948; BYTE $0xd8       // movq	%rbx, %rax
+	WORD $0x2948; BYTE $0xf8       // subq	%rdi, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+
+BB0_8:
+	WORD $0x3948; BYTE $0xc3     // cmpq	%rax, %rbx
+	JLE  BB0_13
+	LONG $0x247c8b48; BYTE $0x18 // movq	24(%rsp), %rdi
+	LONG $0x246c8b4c; BYTE $0x68 // movq	104(%rsp), %r13
+	LONG $0x2444894c; BYTE $0x48 // movq	%r8, 72(%rsp)
+	QUAD $0x0000008824bc8b4c     // movq	136(%rsp), %r15
+	QUAD $0x000000902494894c     // movq	%r10, 144(%rsp)
+	LONG $0x24548b4c; BYTE $0x50 // movq	80(%rsp), %r10
+	LONG $0x85748d4d; BYTE $0x00 // leaq	0(%r13,%rax,4), %r14
+	LONG $0x3f0c8d4e             // leaq	(%rdi,%r15), %r9
+	QUAD $0x00000098248c894c     // movq	%r9, 152(%rsp)
+
+BB0_14:
+	LONG $0xc957f0c5                     // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0x854d; BYTE $0xdb             // testq	%r11, %r11
+	JLE  BB0_19
+	QUAD $0x0000008024bc8348; BYTE $0x02 // cmpq	$2, 128(%rsp)
+	JBE  BB0_24
+	QUAD $0x0000008824848b4c             // movq	136(%rsp), %r8
+	QUAD $0x00000098248c8b4c             // movq	152(%rsp), %r9
+	WORD $0x894c; BYTE $0xf7             // movq	%r14, %rdi
+	LONG $0xc957f0c5                     // vxorps	%xmm1, %xmm1, %xmm1
+
+BB0_16:
+	LONG $0x0410fac5; BYTE $0x77               // vmovss	(%rdi,%rsi,2), %xmm0
+	LONG $0x2179e3c4; WORD $0x1714; BYTE $0x10 // vinsertps	$0x10, (%rdi,%rdx), %xmm0, %xmm2
+	LONG $0x10c08349                           // addq	$16, %r8
+	LONG $0x0710fac5                           // vmovss	(%rdi), %xmm0
+	LONG $0x2179e3c4; WORD $0x3704; BYTE $0x10 // vinsertps	$0x10, (%rdi,%rsi), %xmm0, %xmm0
+	WORD $0x0148; BYTE $0xcf                   // addq	%rcx, %rdi
+	LONG $0xc216f8c5                           // vmovlhps	%xmm2, %xmm0, %xmm0
+	LONG $0x5978c1c4; WORD $0xf040             // vmulps	-16(%r8), %xmm0, %xmm0
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xd0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm2
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xc815f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm1
+	LONG $0xc0c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm0
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	WORD $0x394d; BYTE $0xc1                   // cmpq	%r8, %r9
+	JNE  BB0_16
+	LONG $0x247c8348; WORD $0x0078             // cmpq	$0, 120(%rsp)
+	QUAD $0x00000098248c894c                   // movq	%r9, 152(%rsp)
+	JE   BB0_19
+	LONG $0x247c8b48; BYTE $0x60               // movq	96(%rsp), %rdi
+
+BB0_15:
+	WORD $0x8949; BYTE $0xd8                   // movq	%rbx, %r8
+	LONG $0x244c8b4c; BYTE $0x70               // movq	112(%rsp), %r9
+	LONG $0x3a3c8d4d                           // leaq	(%r10,%rdi), %r15
+	LONG $0xc7af0f4c                           // imulq	%rdi, %r8
+	LONG $0x107a81c4; WORD $0xb92c             // vmovss	(%r9,%r15,4), %xmm5
+	LONG $0x00248d4d                           // leaq	(%r8,%rax), %r12
+	LONG $0xb95182c4; WORD $0xa54c; BYTE $0x00 // vfmadd231ss	0(%r13,%r12,4), %xmm5, %xmm1
+	LONG $0x01678d4c                           // leaq	1(%rdi), %r12
+	WORD $0x394d; BYTE $0xe3                   // cmpq	%r12, %r11
+	JLE  BB0_19
+	WORD $0x0149; BYTE $0xd8                   // addq	%rbx, %r8
+	WORD $0x014d; BYTE $0xd4                   // addq	%r10, %r12
+	LONG $0x02c78348                           // addq	$2, %rdi
+	LONG $0x003c8d4e                           // leaq	(%rax,%r8), %r15
+	LONG $0x107a81c4; WORD $0xbd74; BYTE $0x00 // vmovss	0(%r13,%r15,4), %xmm6
+	LONG $0xb94982c4; WORD $0xa10c             // vfmadd231ss	(%r9,%r12,4), %xmm6, %xmm1
+	WORD $0x3949; BYTE $0xfb                   // cmpq	%rdi, %r11
+	JLE  BB0_19
+	LONG $0x03248d4c                           // leaq	(%rbx,%rax), %r12
+	WORD $0x014c; BYTE $0xd7                   // addq	%r10, %rdi
+	WORD $0x014d; BYTE $0xc4                   // addq	%r8, %r12
+	LONG $0x107a81c4; WORD $0xa57c; BYTE $0x00 // vmovss	0(%r13,%r12,4), %xmm7
+	LONG $0xb941c2c4; WORD $0xb90c             // vfmadd231ss	(%r9,%rdi,4), %xmm7, %xmm1
+
+BB0_19:
+	QUAD $0x0000009024bc8b48     // movq	144(%rsp), %rdi
+	LONG $0x04c68349             // addq	$4, %r14
+	LONG $0x0c11fac5; BYTE $0x87 // vmovss	%xmm1, (%rdi,%rax,4)
+	LONG $0x01c08348             // addq	$1, %rax
+	WORD $0x3948; BYTE $0xc3     // cmpq	%rax, %rbx
+	JNE  BB0_14
+	LONG $0x24448b4c; BYTE $0x48 // movq	72(%rsp), %r8
+	WORD $0x8949; BYTE $0xfa     // movq	%rdi, %r10
+
+BB0_13:
+	LONG $0x247c8b4c; BYTE $0x38   // movq	56(%rsp), %r15
+	LONG $0x24448348; WORD $0x0158 // addq	$1, 88(%rsp)
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	LONG $0x245c014c; BYTE $0x50   // addq	%r11, 80(%rsp)
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	QUAD $0x0000008824bc014c       // addq	%r15, 136(%rsp)
+	WORD $0x014d; BYTE $0xf8       // addq	%r15, %r8
+	LONG $0x24443948; BYTE $0x40   // cmpq	%rax, 64(%rsp)
+	JNE  BB0_20
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+
+BB0_36:
+	LONG $0x50a58d48; WORD $0xffff; BYTE $0xff // leaq	-176(%rbp), %rsp
+	RET
+
+BB0_39:
+	LONG $0xe457d8c5 // vxorps	%xmm4, %xmm4, %xmm4
+	LONG $0xdc28fcc5 // vmovaps	%ymm4, %ymm3
+	LONG $0xd428fcc5 // vmovaps	%ymm4, %ymm2
+	LONG $0xcc28fcc5 // vmovaps	%ymm4, %ymm1
+	JMP  BB0_7
+
+BB0_24:
+	WORD $0xff31     // xorl	%edi, %edi
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	JMP  BB0_15
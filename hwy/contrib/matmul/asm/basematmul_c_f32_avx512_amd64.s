@@ -0,0 +1,281 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmul_c_f32_avx512_amd64.c
+
+TEXT ·matmul_c_f32_avx512(SB), $96-72
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ c+16(FP), DX
+	MOVQ pm+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_a+48(FP), R11
+	MOVQ R11, 64(SP)
+	MOVQ plen_b+56(FP), R11
+	MOVQ R11, 72(SP)
+	MOVQ plen_c+64(FP), R11
+	MOVQ R11, 80(SP)
+	LONG $0x246c8d48; BYTE $0x30         // leaq	48(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x40         // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348                     // andq	$-64, %rsp
+	LONG $0x80c48348                     // addq	$-128, %rsp
+	WORD $0x8b48; BYTE $0x01             // movq	(%rcx), %rax
+	WORD $0x8b4d; BYTE $0x19             // movq	(%r9), %r11
+	LONG $0x247c8948; BYTE $0x28         // movq	%rdi, 40(%rsp)
+	WORD $0x8b49; BYTE $0x18             // movq	(%r8), %rbx
+	LONG $0x24448948; BYTE $0x20         // movq	%rax, 32(%rsp)
+	WORD $0x8548; BYTE $0xc0             // testq	%rax, %rax
+	JLE  BB0_36
+	WORD $0x8949; BYTE $0xfe             // movq	%rdi, %r14
+	WORD $0x8948; BYTE $0xd7             // movq	%rdx, %rdi
+	LONG $0x5b048d4c                     // leaq	(%rbx,%rbx,2), %r8
+	WORD $0x3145; BYTE $0xe4             // xorl	%r12d, %r12d
+	LONG $0x02e0c149                     // salq	$2, %r8
+	LONG $0x2464894c; BYTE $0x48         // movq	%r12, 72(%rsp)
+	WORD $0x8949; BYTE $0xd9             // movq	%rbx, %r9
+	WORD $0x8949; BYTE $0xf5             // movq	%rsi, %r13
+	QUAD $0x000000009d148d4a             // leaq	0(,%r11,4), %rdx
+	LONG $0x2404894c                     // movq	%r8, (%rsp)
+	LONG $0x04e1c149                     // salq	$4, %r9
+	QUAD $0x000000009d048d48             // leaq	0(,%rbx,4), %rax
+	LONG $0x6ef9e1c4; BYTE $0xd2         // vmovq	%rdx, %xmm2
+	LONG $0x320c8d4a                     // leaq	(%rdx,%r14), %rcx
+	LONG $0xc0538d48                     // leaq	-64(%rbx), %rdx
+	QUAD $0x000000402444c748; BYTE $0x00 // movq	$0, 64(%rsp)
+	LONG $0x06eac148                     // shrq	$6, %rdx
+	LONG $0x2474894c; BYTE $0x68         // movq	%r14, 104(%rsp)
+	LONG $0xc26f79c5                     // vmovdqa	%xmm2, %xmm8
+	WORD $0x8949; BYTE $0xc6             // movq	%rax, %r14
+	LONG $0x01c28348                     // addq	$1, %rdx
+	WORD $0x8949; BYTE $0xd7             // movq	%rdx, %r15
+	LONG $0x06e2c148                     // salq	$6, %rdx
+	LONG $0x24548948; BYTE $0x18         // movq	%rdx, 24(%rsp)
+	LONG $0x10c28348                     // addq	$16, %rdx
+	LONG $0x08e7c149                     // salq	$8, %r15
+	LONG $0x24548948; BYTE $0x08         // movq	%rdx, 8(%rsp)
+	LONG $0xff538d49                     // leaq	-1(%r11), %rdx
+	WORD $0x894d; BYTE $0xfa             // movq	%r15, %r10
+	LONG $0x24548948; BYTE $0x60         // movq	%rdx, 96(%rsp)
+	WORD $0x894c; BYTE $0xda             // movq	%r11, %rdx
+	LONG $0x02eac148                     // shrq	$2, %rdx
+	LONG $0x04e2c148                     // salq	$4, %rdx
+	LONG $0x24548948; BYTE $0x10         // movq	%rdx, 16(%rsp)
+	WORD $0x894c; BYTE $0xda             // movq	%r11, %rdx
+	LONG $0xfce28348                     // andq	$-4, %rdx
+	LONG $0x24548948; BYTE $0x50         // movq	%rdx, 80(%rsp)
+	WORD $0x894c; BYTE $0xda             // movq	%r11, %rdx
+	WORD $0xe283; BYTE $0x03             // andl	$3, %edx
+	LONG $0x24548948; BYTE $0x58         // movq	%rdx, 88(%rsp)
+
+BB0_20:
+	WORD $0x3145; BYTE $0xff     // xorl	%r15d, %r15d
+	LONG $0x000010be; BYTE $0x00 // movl	$16, %esi
+	WORD $0x3145; BYTE $0xe4     // xorl	%r12d, %r12d
+	LONG $0x3ffb8348             // cmpq	$63, %rbx
+	JLE  BB0_4
+	LONG $0x245c8948; BYTE $0x78 // movq	%rbx, 120(%rsp)
+	LONG $0x245c8b48; BYTE $0x68 // movq	104(%rsp), %rbx
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x244c894c; BYTE $0x70 // movq	%r9, 112(%rsp)
+	WORD $0x8949; BYTE $0xf9     // movq	%rdi, %r9
+
+BB0_3:
+	LONG $0x40578d49                           // leaq	64(%r15), %rdx
+	LONG $0x80bf8d49; WORD $0x0000; BYTE $0x00 // leaq	128(%r15), %rdi
+	LONG $0xc08f8d49; WORD $0x0000; BYTE $0x00 // leaq	192(%r15), %rcx
+	WORD $0x854d; BYTE $0xdb                   // testq	%r11, %r11
+	JLE  BB0_39
+	LONG $0xed57d0c5                           // vxorps	%xmm5, %xmm5, %xmm5
+	LONG $0x3d748d4b; BYTE $0x00               // leaq	0(%r13,%r15), %rsi
+	WORD $0x8948; BYTE $0xd8                   // movq	%rbx, %rax
+	LONG $0x487cf162; WORD $0xe528             // vmovaps	%zmm5, %zmm4
+	LONG $0x487cf162; WORD $0xd528             // vmovaps	%zmm5, %zmm2
+	LONG $0x487cf162; WORD $0xcd28             // vmovaps	%zmm5, %zmm1
+
+BB0_5:
+	WORD $0x8949; BYTE $0xf4                   // movq	%rsi, %r12
+	LONG $0x487df262; WORD $0x0018             // vbroadcastss	(%rax), %zmm0
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x294d; BYTE $0xfc                   // subq	%r15, %r12
+	LONG $0x487df262; WORD $0x0eb8             // vfmadd231ps	(%rsi), %zmm0, %zmm1
+	WORD $0x014c; BYTE $0xf6                   // addq	%r14, %rsi
+	LONG $0x487dd262; WORD $0x14b8; BYTE $0x14 // vfmadd231ps	(%r12,%rdx), %zmm0, %zmm2
+	LONG $0x487dd262; WORD $0x24b8; BYTE $0x3c // vfmadd231ps	(%r12,%rdi), %zmm0, %zmm4
+	LONG $0x487dd262; WORD $0x2cb8; BYTE $0x0c // vfmadd231ps	(%r12,%rcx), %zmm0, %zmm5
+	WORD $0x3949; BYTE $0xc0                   // cmpq	%rax, %r8
+	JNE  BB0_5
+
+BB0_7:
+	LONG $0x487c9162; WORD $0x0c11; BYTE $0x39 // vmovups	%zmm1, (%r9,%r15)
+	QUAD $0x01395411487c9162                   // vmovups	%zmm2, 64(%r9,%r15)
+	QUAD $0x02396411487c9162                   // vmovups	%zmm4, 128(%r9,%r15)
+	QUAD $0x03396c11487c9162                   // vmovups	%zmm5, 192(%r9,%r15)
+	LONG $0x00c78149; WORD $0x0001; BYTE $0x00 // addq	$256, %r15
+	WORD $0x394d; BYTE $0xfa                   // cmpq	%r15, %r10
+	JNE  BB0_3
+	WORD $0x894c; BYTE $0xcf                   // movq	%r9, %rdi
+	LONG $0x245c8b48; BYTE $0x78               // movq	120(%rsp), %rbx
+	LONG $0x244c8b4c; BYTE $0x70               // movq	112(%rsp), %r9
+	WORD $0x894c; BYTE $0xc1                   // movq	%r8, %rcx
+	LONG $0x24748b48; BYTE $0x08               // movq	8(%rsp), %rsi
+	LONG $0x24648b4c; BYTE $0x18               // movq	24(%rsp), %r12
+
+BB0_4:
+	WORD $0x3948; BYTE $0xf3     // cmpq	%rsi, %rbx
+	JL   BB0_8
+	LONG $0x24448b48; BYTE $0x28 // movq	40(%rsp), %rax
+	LONG $0x24548b48; BYTE $0x40 // movq	64(%rsp), %rdx
+	LONG $0x24748948; BYTE $0x78 // movq	%rsi, 120(%rsp)
+	WORD $0x8949; BYTE $0xf7     // movq	%rsi, %r15
+	WORD $0x894c; BYTE $0xe6     // movq	%r12, %rsi
+	LONG $0x90048d48             // leaq	(%rax,%rdx,4), %rax
+	WORD $0x8949; BYTE $0xc0     // movq	%rax, %r8
+
+BB0_9:
+	WORD $0x8948; BYTE $0xf2     // movq	%rsi, %rdx
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x894c; BYTE $0xfe     // movq	%r15, %rsi
+	WORD $0x854d; BYTE $0xdb     // testq	%r11, %r11
+	JLE  BB0_12
+	LONG $0x95648d4d; BYTE $0x00 // leaq	0(%r13,%rdx,4), %r12
+	WORD $0x894c; BYTE $0xc0     // movq	%r8, %rax
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+
+BB0_10:
+	LONG $0x487df262; WORD $0x3018             // vbroadcastss	(%rax), %zmm6
+	LONG $0x04c08348                           // addq	$4, %rax
+	LONG $0x484dd262; WORD $0x04b8; BYTE $0x24 // vfmadd231ps	(%r12), %zmm6, %zmm0
+	WORD $0x014d; BYTE $0xf4                   // addq	%r14, %r12
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JNE  BB0_10
+
+BB0_12:
+	LONG $0x10c78349                           // addq	$16, %r15
+	LONG $0x487cf162; WORD $0x0411; BYTE $0x97 // vmovups	%zmm0, (%rdi,%rdx,4)
+	WORD $0x394c; BYTE $0xfb                   // cmpq	%r15, %rbx
+	JGE  BB0_9
+	LONG $0x24748b48; BYTE $0x78               // movq	120(%rsp), %rsi
+	WORD $0x8949; BYTE $0xdc                   // movq	%rbx, %r12
+	WORD $0x2949; BYTE $0xf4                   // subq	%rsi, %r12
+	LONG $0xf0e48349                           // andq	$-16, %r12
+	WORD $0x0149; BYTE $0xf4                   // addq	%rsi, %r12
+
+BB0_8:
+	WORD $0x394c; BYTE $0xe3     // cmpq	%r12, %rbx
+	JLE  BB0_13
+	LONG $0x24548b48; BYTE $0x10 // movq	16(%rsp), %rdx
+	LONG $0x24748b48; BYTE $0x68 // movq	104(%rsp), %rsi
+	LONG $0x244c8948; BYTE $0x38 // movq	%rcx, 56(%rsp)
+	LONG $0xa5448d4b; BYTE $0x00 // leaq	0(%r13,%r12,4), %rax
+	LONG $0x247c8948; BYTE $0x70 // movq	%rdi, 112(%rsp)
+	LONG $0x24048b4c             // movq	(%rsp), %r8
+	WORD $0x0148; BYTE $0xd6     // addq	%rdx, %rsi
+	LONG $0x2454894c; BYTE $0x30 // movq	%r10, 48(%rsp)
+	LONG $0x247c8b48; BYTE $0x40 // movq	64(%rsp), %rdi
+	WORD $0x894c; BYTE $0xea     // movq	%r13, %rdx
+	LONG $0x24748948; BYTE $0x78 // movq	%rsi, 120(%rsp)
+	LONG $0x24548b4c; BYTE $0x28 // movq	40(%rsp), %r10
+
+BB0_14:
+	LONG $0xc957f0c5               // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0x854d; BYTE $0xdb       // testq	%r11, %r11
+	JLE  BB0_19
+	LONG $0x247c8348; WORD $0x0260 // cmpq	$2, 96(%rsp)
+	JBE  BB0_24
+	LONG $0x247c8b4c; BYTE $0x68   // movq	104(%rsp), %r15
+	LONG $0x24748b48; BYTE $0x78   // movq	120(%rsp), %rsi
+	WORD $0x8948; BYTE $0xc1       // movq	%rax, %rcx
+	LONG $0xc957f0c5               // vxorps	%xmm1, %xmm1, %xmm1
+
+BB0_16:
+	LONG $0x107aa1c4; WORD $0x7114             // vmovss	(%rcx,%r14,2), %xmm2
+	LONG $0x0110fac5                           // vmovss	(%rcx), %xmm0
+	LONG $0x10c78349                           // addq	$16, %r15
+	LONG $0x2169a3c4; WORD $0x0114; BYTE $0x10 // vinsertps	$0x10, (%rcx,%r8), %xmm2, %xmm2
+	LONG $0x2179a3c4; WORD $0x3104; BYTE $0x10 // vinsertps	$0x10, (%rcx,%r14), %xmm0, %xmm0
+	WORD $0x014c; BYTE $0xc9                   // addq	%r9, %rcx
+	LONG $0xc216f8c5                           // vmovlhps	%xmm2, %xmm0, %xmm0
+	LONG $0x5978c1c4; WORD $0xf047             // vmulps	-16(%r15), %xmm0, %xmm0
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xd0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm2
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xc815f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm1
+	LONG $0xc0c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm0
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	WORD $0x394c; BYTE $0xfe                   // cmpq	%r15, %rsi
+	JNE  BB0_16
+	LONG $0x247c8348; WORD $0x0058             // cmpq	$0, 88(%rsp)
+	LONG $0x24748948; BYTE $0x78               // movq	%rsi, 120(%rsp)
+	JE   BB0_19
+	LONG $0x244c8b48; BYTE $0x50               // movq	80(%rsp), %rcx
+
+BB0_15:
+	WORD $0x8949; BYTE $0xdf       // movq	%rbx, %r15
+	LONG $0x0f2c8d4c               // leaq	(%rdi,%rcx), %r13
+	LONG $0xf9af0f4c               // imulq	%rcx, %r15
+	LONG $0x6ef9c1c4; BYTE $0xc5   // vmovq	%r13, %xmm0
+	LONG $0x7ef9e1c4; BYTE $0xc6   // vmovq	%xmm0, %rsi
+	LONG $0x107ac1c4; WORD $0xb23c // vmovss	(%r10,%rsi,4), %xmm7
+	LONG $0x272c8d4f               // leaq	(%r15,%r12), %r13
+	LONG $0xb941a2c4; WORD $0xaa0c // vfmadd231ss	(%rdx,%r13,4), %xmm7, %xmm1
+	LONG $0x01698d4c               // leaq	1(%rcx), %r13
+	WORD $0x394d; BYTE $0xeb       // cmpq	%r13, %r11
+	JLE  BB0_19
+	WORD $0x0149; BYTE $0xdf       // addq	%rbx, %r15
+	WORD $0x0149; BYTE $0xfd       // addq	%rdi, %r13
+	LONG $0x02c18348               // addq	$2, %rcx
+	LONG $0x3c348d4b               // leaq	(%r12,%r15), %rsi
+	LONG $0x3c10fac5; BYTE $0xb2   // vmovss	(%rdx,%rsi,4), %xmm7
+	LONG $0xb94182c4; WORD $0xaa0c // vfmadd231ss	(%r10,%r13,4), %xmm7, %xmm1
+	WORD $0x3949; BYTE $0xcb       // cmpq	%rcx, %r11
+	JLE  BB0_19
+	LONG $0x232c8d4e               // leaq	(%rbx,%r12), %r13
+	WORD $0x0148; BYTE $0xf9       // addq	%rdi, %rcx
+	WORD $0x014d; BYTE $0xef       // addq	%r13, %r15
+	LONG $0x107aa1c4; WORD $0xba3c // vmovss	(%rdx,%r15,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x8a0c // vfmadd231ss	(%r10,%rcx,4), %xmm7, %xmm1
+
+BB0_19:
+	LONG $0x244c8b48; BYTE $0x70   // movq	112(%rsp), %rcx
+	LONG $0x04c08348               // addq	$4, %rax
+	LONG $0x117aa1c4; WORD $0xa10c // vmovss	%xmm1, (%rcx,%r12,4)
+	LONG $0x01c48349               // addq	$1, %r12
+	WORD $0x394c; BYTE $0xe3       // cmpq	%r12, %rbx
+	JNE  BB0_14
+	WORD $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	LONG $0x24548b4c; BYTE $0x30   // movq	48(%rsp), %r10
+	LONG $0x244c8b48; BYTE $0x38   // movq	56(%rsp), %rcx
+	WORD $0x8949; BYTE $0xd5       // movq	%rdx, %r13
+
+BB0_13:
+	LONG $0x7ef961c4; BYTE $0xc6   // vmovq	%xmm8, %rsi
+	LONG $0x24448348; WORD $0x0148 // addq	$1, 72(%rsp)
+	WORD $0x014c; BYTE $0xf7       // addq	%r14, %rdi
+	LONG $0x24448b48; BYTE $0x48   // movq	72(%rsp), %rax
+	LONG $0x245c014c; BYTE $0x40   // addq	%r11, 64(%rsp)
+	WORD $0x0148; BYTE $0xf1       // addq	%rsi, %rcx
+	LONG $0x24740148; BYTE $0x68   // addq	%rsi, 104(%rsp)
+	LONG $0x24443948; BYTE $0x20   // cmpq	%rax, 32(%rsp)
+	JNE  BB0_20
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+
+BB0_36:
+	LONG $0xd0658d48 // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_39:
+	LONG $0xed57d0c5               // vxorps	%xmm5, %xmm5, %xmm5
+	LONG $0x487cf162; WORD $0xe528 // vmovaps	%zmm5, %zmm4
+	LONG $0x487cf162; WORD $0xd528 // vmovaps	%zmm5, %zmm2
+	LONG $0x487cf162; WORD $0xcd28 // vmovaps	%zmm5, %zmm1
+	JMP  BB0_7
+
+BB0_24:
+	WORD $0xc931     // xorl	%ecx, %ecx
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	JMP  BB0_15
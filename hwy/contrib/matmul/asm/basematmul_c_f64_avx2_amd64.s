@@ -0,0 +1,233 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmul_c_f64_avx2_amd64.c
+
+TEXT ·matmul_c_f64_avx2(SB), $160-72
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ c+16(FP), DX
+	MOVQ pm+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_a+48(FP), R11
+	MOVQ R11, 128(SP)
+	MOVQ plen_b+56(FP), R11
+	MOVQ R11, 136(SP)
+	MOVQ plen_c+64(FP), R11
+	MOVQ R11, 144(SP)
+	LONG $0x246c8d48; BYTE $0x70         // leaq	112(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x20         // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348                     // andq	$-32, %rsp
+	WORD $0x8b48; BYTE $0x09             // movq	(%rcx), %rcx
+	WORD $0x8b4d; BYTE $0x39             // movq	(%r9), %r15
+	WORD $0x8b49; BYTE $0x00             // movq	(%r8), %rax
+	LONG $0x244c8948; BYTE $0x30         // movq	%rcx, 48(%rsp)
+	WORD $0x8548; BYTE $0xc9             // testq	%rcx, %rcx
+	JLE  BB0_31
+	WORD $0x8949; BYTE $0xd4             // movq	%rdx, %r12
+	LONG $0xf0508d48                     // leaq	-16(%rax), %rdx
+	WORD $0x8949; BYTE $0xfa             // movq	%rdi, %r10
+	WORD $0x8949; BYTE $0xc6             // movq	%rax, %r14
+	LONG $0x04eac148                     // shrq	$4, %rdx
+	WORD $0x8948; BYTE $0xf3             // movq	%rsi, %rbx
+	LONG $0x04e6c149                     // salq	$4, %r14
+	WORD $0x894d; BYTE $0xf9             // movq	%r15, %r9
+	QUAD $0x00000000fd0c8d4a             // leaq	0(,%r15,8), %rcx
+	LONG $0x01c28348                     // addq	$1, %rdx
+	QUAD $0x000000502444c748; BYTE $0x00 // movq	$0, 80(%rsp)
+	QUAD $0x00000000c53c8d48             // leaq	0(,%rax,8), %rdi
+	LONG $0x244c8948; BYTE $0x28         // movq	%rcx, 40(%rsp)
+	LONG $0x0a048d4d                     // leaq	(%r10,%rcx), %r8
+	WORD $0x8948; BYTE $0xd1             // movq	%rdx, %rcx
+	LONG $0x04e2c148                     // salq	$4, %rdx
+	LONG $0x07e1c148                     // salq	$7, %rcx
+	LONG $0x24548948; BYTE $0x20         // movq	%rdx, 32(%rsp)
+	LONG $0x244c8948; BYTE $0x18         // movq	%rcx, 24(%rsp)
+	LONG $0x044a8d48                     // leaq	4(%rdx), %rcx
+	WORD $0x894c; BYTE $0xfa             // movq	%r15, %rdx
+	LONG $0x244c8948; BYTE $0x10         // movq	%rcx, 16(%rsp)
+	WORD $0xd148; BYTE $0xea             // shrq	%rdx
+	WORD $0x894c; BYTE $0xf9             // movq	%r15, %rcx
+	LONG $0x04e2c148                     // salq	$4, %rdx
+	LONG $0xfee18348                     // andq	$-2, %rcx
+	LONG $0x24548948; BYTE $0x08         // movq	%rdx, 8(%rsp)
+	WORD $0xd231                         // xorl	%edx, %edx
+	LONG $0x240c8948                     // movq	%rcx, (%rsp)
+	WORD $0x894c; BYTE $0xd1             // movq	%r10, %rcx
+
+BB0_20:
+	LONG $0x0ff88348             // cmpq	$15, %rax
+	JLE  BB0_22
+	LONG $0x24448948; BYTE $0x58 // movq	%rax, 88(%rsp)
+	LONG $0xd13c8d4c             // leaq	(%rcx,%rdx,8), %r15
+	WORD $0x3145; BYTE $0xd2     // xorl	%r10d, %r10d
+	LONG $0x24548948; BYTE $0x48 // movq	%rdx, 72(%rsp)
+	LONG $0x2474894c; BYTE $0x40 // movq	%r14, 64(%rsp)
+	LONG $0x244c8948; BYTE $0x38 // movq	%rcx, 56(%rsp)
+	LONG $0x244c8b48; BYTE $0x18 // movq	24(%rsp), %rcx
+
+BB0_4:
+	LONG $0x20728d4d         // leaq	32(%r10), %r14
+	LONG $0x406a8d4d         // leaq	64(%r10), %r13
+	LONG $0x605a8d4d         // leaq	96(%r10), %r11
+	WORD $0x854d; BYTE $0xc9 // testq	%r9, %r9
+	JLE  BB0_34
+	LONG $0xe457d9c5         // vxorpd	%xmm4, %xmm4, %xmm4
+	LONG $0x13148d4a         // leaq	(%rbx,%r10), %rdx
+	WORD $0x894c; BYTE $0xf8 // movq	%r15, %rax
+	LONG $0xdc28fdc5         // vmovapd	%ymm4, %ymm3
+	LONG $0xd428fdc5         // vmovapd	%ymm4, %ymm2
+	LONG $0xcc28fdc5         // vmovapd	%ymm4, %ymm1
+
+BB0_5:
+	WORD $0x8948; BYTE $0xd6       // movq	%rdx, %rsi
+	LONG $0x197de2c4; BYTE $0x00   // vbroadcastsd	(%rax), %ymm0
+	LONG $0x08c08348               // addq	$8, %rax
+	WORD $0x294c; BYTE $0xd6       // subq	%r10, %rsi
+	LONG $0xb8fde2c4; BYTE $0x0a   // vfmadd231pd	(%rdx), %ymm0, %ymm1
+	WORD $0x0148; BYTE $0xfa       // addq	%rdi, %rdx
+	LONG $0xb8fda2c4; WORD $0x3614 // vfmadd231pd	(%rsi,%r14), %ymm0, %ymm2
+	LONG $0xb8fda2c4; WORD $0x2e1c // vfmadd231pd	(%rsi,%r13), %ymm0, %ymm3
+	LONG $0xb8fda2c4; WORD $0x1e24 // vfmadd231pd	(%rsi,%r11), %ymm0, %ymm4
+	WORD $0x3949; BYTE $0xc0       // cmpq	%rax, %r8
+	JNE  BB0_5
+
+BB0_7:
+	LONG $0x117d81c4; WORD $0x140c             // vmovupd	%ymm1, (%r12,%r10)
+	LONG $0x117d81c4; WORD $0x1454; BYTE $0x20 // vmovupd	%ymm2, 32(%r12,%r10)
+	LONG $0x117d81c4; WORD $0x145c; BYTE $0x40 // vmovupd	%ymm3, 64(%r12,%r10)
+	LONG $0x117d81c4; WORD $0x1464; BYTE $0x60 // vmovupd	%ymm4, 96(%r12,%r10)
+	LONG $0x80ea8349                           // subq	$-128, %r10
+	WORD $0x394c; BYTE $0xd1                   // cmpq	%r10, %rcx
+	JNE  BB0_4
+	LONG $0x24448b48; BYTE $0x58               // movq	88(%rsp), %rax
+	LONG $0x24548b48; BYTE $0x48               // movq	72(%rsp), %rdx
+	LONG $0x24748b4c; BYTE $0x40               // movq	64(%rsp), %r14
+	LONG $0x244c8b48; BYTE $0x38               // movq	56(%rsp), %rcx
+	LONG $0x24748b48; BYTE $0x10               // movq	16(%rsp), %rsi
+	LONG $0x245c8b4c; BYTE $0x20               // movq	32(%rsp), %r11
+
+BB0_3:
+	WORD $0x3948; BYTE $0xf0     // cmpq	%rsi, %rax
+	JL   BB0_8
+	LONG $0xd13c8d4c             // leaq	(%rcx,%rdx,8), %r15
+	LONG $0x24548948; BYTE $0x48 // movq	%rdx, 72(%rsp)
+	WORD $0x8949; BYTE $0xf5     // movq	%rsi, %r13
+	LONG $0x247c894c; BYTE $0x58 // movq	%r15, 88(%rsp)
+
+BB0_9:
+	WORD $0x894d; BYTE $0xdf     // movq	%r11, %r15
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x894d; BYTE $0xeb     // movq	%r13, %r11
+	WORD $0x854d; BYTE $0xc9     // testq	%r9, %r9
+	JLE  BB0_12
+	LONG $0x24548b48; BYTE $0x58 // movq	88(%rsp), %rdx
+	LONG $0xfb148d4e             // leaq	(%rbx,%r15,8), %r10
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+
+BB0_10:
+	LONG $0x197de2c4; BYTE $0x0a // vbroadcastsd	(%rdx), %ymm1
+	LONG $0x08c28348             // addq	$8, %rdx
+	LONG $0xb8f5c2c4; BYTE $0x02 // vfmadd231pd	(%r10), %ymm1, %ymm0
+	WORD $0x0149; BYTE $0xfa     // addq	%rdi, %r10
+	WORD $0x3949; BYTE $0xd0     // cmpq	%rdx, %r8
+	JNE  BB0_10
+
+BB0_12:
+	LONG $0x04c58349               // addq	$4, %r13
+	LONG $0x117d81c4; WORD $0xfc04 // vmovupd	%ymm0, (%r12,%r15,8)
+	WORD $0x394c; BYTE $0xe8       // cmpq	%r13, %rax
+	JGE  BB0_9
+	WORD $0x8949; BYTE $0xc3       // movq	%rax, %r11
+	LONG $0x24548b48; BYTE $0x48   // movq	72(%rsp), %rdx
+	WORD $0x2949; BYTE $0xf3       // subq	%rsi, %r11
+	LONG $0xfce38349               // andq	$-4, %r11
+	WORD $0x0149; BYTE $0xf3       // addq	%rsi, %r11
+
+BB0_8:
+	WORD $0x394c; BYTE $0xd8     // cmpq	%r11, %rax
+	JLE  BB0_13
+	LONG $0xd1348d48             // leaq	(%rcx,%rdx,8), %rsi
+	LONG $0x24548b4c; BYTE $0x08 // movq	8(%rsp), %r10
+	LONG $0x2444894c; BYTE $0x48 // movq	%r8, 72(%rsp)
+	LONG $0xdb3c8d4e             // leaq	(%rbx,%r11,8), %r15
+	LONG $0x24748948; BYTE $0x58 // movq	%rsi, 88(%rsp)
+	LONG $0x24048b4c             // movq	(%rsp), %r8
+	LONG $0x162c8d4e             // leaq	(%rsi,%r10), %r13
+
+BB0_14:
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0x854d; BYTE $0xc9     // testq	%r9, %r9
+	JLE  BB0_19
+	LONG $0x01f98349             // cmpq	$1, %r9
+	JE   BB0_24
+	LONG $0x24548b4c; BYTE $0x58 // movq	88(%rsp), %r10
+	WORD $0x894c; BYTE $0xfe     // movq	%r15, %rsi
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+
+BB0_16:
+	LONG $0x0610fbc5               // vmovsd	(%rsi), %xmm0
+	LONG $0x10c28349               // addq	$16, %r10
+	LONG $0x0416f9c5; BYTE $0x3e   // vmovhpd	(%rsi,%rdi), %xmm0, %xmm0
+	WORD $0x014c; BYTE $0xf6       // addq	%r14, %rsi
+	LONG $0x5979c1c4; WORD $0xf042 // vmulpd	-16(%r10), %xmm0, %xmm0
+	LONG $0xc858f3c5               // vaddsd	%xmm0, %xmm1, %xmm1
+	LONG $0xc015f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xc958fbc5               // vaddsd	%xmm1, %xmm0, %xmm1
+	WORD $0x394d; BYTE $0xea       // cmpq	%r13, %r10
+	JNE  BB0_16
+	WORD $0x894c; BYTE $0xc6       // movq	%r8, %rsi
+	WORD $0x394d; BYTE $0xc1       // cmpq	%r8, %r9
+	JE   BB0_19
+
+BB0_15:
+	WORD $0x8949; BYTE $0xc2       // movq	%rax, %r10
+	LONG $0xd6af0f4c               // imulq	%rsi, %r10
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	WORD $0x014d; BYTE $0xda       // addq	%r11, %r10
+	LONG $0x107ba1c4; WORD $0xd32c // vmovsd	(%rbx,%r10,8), %xmm5
+	LONG $0xb9d1e2c4; WORD $0xf10c // vfmadd231sd	(%rcx,%rsi,8), %xmm5, %xmm1
+
+BB0_19:
+	LONG $0x117b81c4; WORD $0xdc0c // vmovsd	%xmm1, (%r12,%r11,8)
+	LONG $0x01c38349               // addq	$1, %r11
+	LONG $0x08c78349               // addq	$8, %r15
+	WORD $0x394c; BYTE $0xd8       // cmpq	%r11, %rax
+	JNE  BB0_14
+	LONG $0x24448b4c; BYTE $0x48   // movq	72(%rsp), %r8
+
+BB0_13:
+	LONG $0x247c8b4c; BYTE $0x28   // movq	40(%rsp), %r15
+	LONG $0x24448348; WORD $0x0150 // addq	$1, 80(%rsp)
+	WORD $0x0149; BYTE $0xfc       // addq	%rdi, %r12
+	WORD $0x014c; BYTE $0xca       // addq	%r9, %rdx
+	LONG $0x24748b48; BYTE $0x50   // movq	80(%rsp), %rsi
+	WORD $0x014d; BYTE $0xf8       // addq	%r15, %r8
+	LONG $0x24743948; BYTE $0x30   // cmpq	%rsi, 48(%rsp)
+	JNE  BB0_20
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+
+BB0_31:
+	LONG $0x90658d48 // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_34:
+	LONG $0xe457d9c5 // vxorpd	%xmm4, %xmm4, %xmm4
+	LONG $0xdc28fdc5 // vmovapd	%ymm4, %ymm3
+	LONG $0xd428fdc5 // vmovapd	%ymm4, %ymm2
+	LONG $0xcc28fdc5 // vmovapd	%ymm4, %ymm1
+	JMP  BB0_7
+
+BB0_24:
+	WORD $0xf631     // xorl	%esi, %esi
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	JMP  BB0_15
+
+BB0_22:
+	LONG $0x000004be; BYTE $0x00 // movl	$4, %esi
+	WORD $0x3145; BYTE $0xdb     // xorl	%r11d, %r11d
+	JMP  BB0_3
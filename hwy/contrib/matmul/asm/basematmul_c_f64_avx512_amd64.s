@@ -0,0 +1,256 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmul_c_f64_avx512_amd64.c
+
+TEXT ·matmul_c_f64_avx512(SB), $96-72
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ c+16(FP), DX
+	MOVQ pm+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_a+48(FP), R11
+	MOVQ R11, 64(SP)
+	MOVQ plen_b+56(FP), R11
+	MOVQ R11, 72(SP)
+	MOVQ plen_c+64(FP), R11
+	MOVQ R11, 80(SP)
+	WORD $0x8949; BYTE $0xfa             // movq	%rdi, %r10
+	LONG $0x246c8d48; BYTE $0x30         // leaq	48(%rsp), %rbp
+	WORD $0x8948; BYTE $0xf3             // movq	%rsi, %rbx
+	LONG $0x24648d48; BYTE $0x40         // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348                     // andq	$-64, %rsp
+	LONG $0x80c48348                     // addq	$-128, %rsp
+	WORD $0x8b48; BYTE $0x39             // movq	(%rcx), %rdi
+	WORD $0x8b49; BYTE $0x31             // movq	(%r9), %rsi
+	WORD $0x8b4d; BYTE $0x00             // movq	(%r8), %r8
+	LONG $0x247c8948; BYTE $0x48         // movq	%rdi, 72(%rsp)
+	WORD $0x8548; BYTE $0xff             // testq	%rdi, %rdi
+	JLE  BB0_33
+	LONG $0xe0488d49                     // leaq	-32(%r8), %rcx
+	WORD $0x8949; BYTE $0xd1             // movq	%rdx, %r9
+	LONG $0x24748948; BYTE $0x70         // movq	%rsi, 112(%rsp)
+	WORD $0x894d; BYTE $0xc3             // movq	%r8, %r11
+	LONG $0x05e9c148                     // shrq	$5, %rcx
+	LONG $0x2454894c; BYTE $0x50         // movq	%r10, 80(%rsp)
+	LONG $0x04e3c149                     // salq	$4, %r11
+	WORD $0x894d; BYTE $0xd4             // movq	%r10, %r12
+	QUAD $0x00000000f5048d48             // leaq	0(,%rsi,8), %rax
+	LONG $0x01c18348                     // addq	$1, %rcx
+	QUAD $0x000000682444c748; BYTE $0x00 // movq	$0, 104(%rsp)
+	QUAD $0x00000000c53c8d4e             // leaq	0(,%r8,8), %r15
+	LONG $0x6ef9e1c4; BYTE $0xd0         // vmovq	%rax, %xmm2
+	LONG $0x02148d49                     // leaq	(%r10,%rax), %rdx
+	WORD $0x8948; BYTE $0xc8             // movq	%rcx, %rax
+	LONG $0x05e1c148                     // salq	$5, %rcx
+	LONG $0x08798d48                     // leaq	8(%rcx), %rdi
+	LONG $0x244c8948; BYTE $0x40         // movq	%rcx, 64(%rsp)
+	WORD $0x8948; BYTE $0xf1             // movq	%rsi, %rcx
+	LONG $0x08e0c148                     // salq	$8, %rax
+	WORD $0xd148; BYTE $0xe9             // shrq	%rcx
+	LONG $0x247c8948; BYTE $0x38         // movq	%rdi, 56(%rsp)
+	WORD $0x8948; BYTE $0xf7             // movq	%rsi, %rdi
+	LONG $0xfa6ff9c5                     // vmovdqa	%xmm2, %xmm7
+	LONG $0x04e1c148                     // salq	$4, %rcx
+	LONG $0xfee78348                     // andq	$-2, %rdi
+	LONG $0x6ef941c4; BYTE $0xc7         // vmovq	%r15, %xmm8
+	LONG $0x244c8948; BYTE $0x30         // movq	%rcx, 48(%rsp)
+	LONG $0x6ef961c4; BYTE $0xcb         // vmovq	%rbx, %xmm9
+	LONG $0x247c8948; BYTE $0x28         // movq	%rdi, 40(%rsp)
+	WORD $0xff31                         // xorl	%edi, %edi
+
+BB0_20:
+	WORD $0xdb31                   // xorl	%ebx, %ebx
+	LONG $0x0008be41; WORD $0x0000 // movl	$8, %r14d
+	WORD $0xc931                   // xorl	%ecx, %ecx
+	LONG $0x1ff88349               // cmpq	$31, %r8
+	JLE  BB0_4
+	LONG $0x247c8948; BYTE $0x60   // movq	%rdi, 96(%rsp)
+	LONG $0x247c8b48; BYTE $0x70   // movq	112(%rsp), %rdi
+	LONG $0x7ef941c4; BYTE $0xc2   // vmovq	%xmm8, %r10
+	LONG $0x2444894c; BYTE $0x78   // movq	%r8, 120(%rsp)
+	WORD $0x8949; BYTE $0xc0       // movq	%rax, %r8
+	LONG $0x245c894c; BYTE $0x58   // movq	%r11, 88(%rsp)
+	LONG $0x7ef941c4; BYTE $0xcb   // vmovq	%xmm9, %r11
+
+BB0_3:
+	LONG $0x407b8d4c                           // leaq	64(%rbx), %r15
+	LONG $0x80b38d48; WORD $0x0000; BYTE $0x00 // leaq	128(%rbx), %rsi
+	LONG $0xc0838d48; WORD $0x0000; BYTE $0x00 // leaq	192(%rbx), %rax
+	WORD $0x8548; BYTE $0xff                   // testq	%rdi, %rdi
+	JLE  BB0_36
+	LONG $0xe457d9c5                           // vxorpd	%xmm4, %xmm4, %xmm4
+	LONG $0x1b2c8d4d                           // leaq	(%r11,%rbx), %r13
+	WORD $0x894c; BYTE $0xe1                   // movq	%r12, %rcx
+	LONG $0x48fdf162; WORD $0xdc28             // vmovapd	%zmm4, %zmm3
+	LONG $0x48fdf162; WORD $0xd428             // vmovapd	%zmm4, %zmm2
+	LONG $0x48fdf162; WORD $0xcc28             // vmovapd	%zmm4, %zmm1
+
+BB0_5:
+	WORD $0x894d; BYTE $0xee                   // movq	%r13, %r14
+	LONG $0x48fdf262; WORD $0x0119             // vbroadcastsd	(%rcx), %zmm0
+	LONG $0x08c18348                           // addq	$8, %rcx
+	WORD $0x2949; BYTE $0xde                   // subq	%rbx, %r14
+	LONG $0x48fdd262; WORD $0x4db8; BYTE $0x00 // vfmadd231pd	0(%r13), %zmm0, %zmm1
+	WORD $0x014d; BYTE $0xd5                   // addq	%r10, %r13
+	LONG $0x48fd9262; WORD $0x14b8; BYTE $0x3e // vfmadd231pd	(%r14,%r15), %zmm0, %zmm2
+	LONG $0x48fdd262; WORD $0x1cb8; BYTE $0x36 // vfmadd231pd	(%r14,%rsi), %zmm0, %zmm3
+	LONG $0x48fdd262; WORD $0x24b8; BYTE $0x06 // vfmadd231pd	(%r14,%rax), %zmm0, %zmm4
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JNE  BB0_5
+
+BB0_7:
+	LONG $0x48fdd162; WORD $0x0c11; BYTE $0x19 // vmovupd	%zmm1, (%r9,%rbx)
+	QUAD $0x0119541148fdd162                   // vmovupd	%zmm2, 64(%r9,%rbx)
+	QUAD $0x02195c1148fdd162                   // vmovupd	%zmm3, 128(%r9,%rbx)
+	QUAD $0x0319641148fdd162                   // vmovupd	%zmm4, 192(%r9,%rbx)
+	LONG $0x00c38148; WORD $0x0001; BYTE $0x00 // addq	$256, %rbx
+	WORD $0x3949; BYTE $0xd8                   // cmpq	%rbx, %r8
+	JNE  BB0_3
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	LONG $0x247c8b48; BYTE $0x60               // movq	96(%rsp), %rdi
+	LONG $0x24448b4c; BYTE $0x78               // movq	120(%rsp), %r8
+	LONG $0x245c8b4c; BYTE $0x58               // movq	88(%rsp), %r11
+	LONG $0x24748b4c; BYTE $0x38               // movq	56(%rsp), %r14
+	LONG $0x244c8b48; BYTE $0x40               // movq	64(%rsp), %rcx
+
+BB0_4:
+	WORD $0x394d; BYTE $0xf0     // cmpq	%r14, %r8
+	JL   BB0_8
+	LONG $0x24748b48; BYTE $0x50 // movq	80(%rsp), %rsi
+	LONG $0x247c8948; BYTE $0x78 // movq	%rdi, 120(%rsp)
+	WORD $0x894d; BYTE $0xf5     // movq	%r14, %r13
+	LONG $0x7ef941c4; BYTE $0xc7 // vmovq	%xmm8, %r15
+	LONG $0x2474894c; BYTE $0x60 // movq	%r14, 96(%rsp)
+	LONG $0x7ef941c4; BYTE $0xca // vmovq	%xmm9, %r10
+	WORD $0x894d; BYTE $0xde     // movq	%r11, %r14
+	WORD $0x8949; BYTE $0xc3     // movq	%rax, %r11
+	LONG $0xfe1c8d48             // leaq	(%rsi,%rdi,8), %rbx
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	WORD $0x8948; BYTE $0xdf     // movq	%rbx, %rdi
+
+BB0_9:
+	LONG $0x247c8348; WORD $0x0070 // cmpq	$0, 112(%rsp)
+	WORD $0x8948; BYTE $0xc6       // movq	%rax, %rsi
+	LONG $0xc057f9c5               // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x894c; BYTE $0xe8       // movq	%r13, %rax
+	JLE  BB0_12
+	LONG $0xf21c8d49               // leaq	(%r10,%rsi,8), %rbx
+	WORD $0x8948; BYTE $0xf9       // movq	%rdi, %rcx
+	LONG $0xc057f9c5               // vxorpd	%xmm0, %xmm0, %xmm0
+
+BB0_10:
+	LONG $0x48fdf262; WORD $0x3119 // vbroadcastsd	(%rcx), %zmm6
+	LONG $0x08c18348               // addq	$8, %rcx
+	LONG $0x48cdf262; WORD $0x03b8 // vfmadd231pd	(%rbx), %zmm6, %zmm0
+	WORD $0x014c; BYTE $0xfb       // addq	%r15, %rbx
+	WORD $0x3948; BYTE $0xca       // cmpq	%rcx, %rdx
+	JNE  BB0_10
+
+BB0_12:
+	LONG $0x08c58349                           // addq	$8, %r13
+	LONG $0x48fdd162; WORD $0x0411; BYTE $0xf1 // vmovupd	%zmm0, (%r9,%rsi,8)
+	WORD $0x394d; BYTE $0xe8                   // cmpq	%r13, %r8
+	JGE  BB0_9
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	WORD $0x894d; BYTE $0xf3                   // movq	%r14, %r11
+	LONG $0x24748b4c; BYTE $0x60               // movq	96(%rsp), %r14
+	WORD $0x894c; BYTE $0xc1                   // movq	%r8, %rcx
+	LONG $0x247c8b48; BYTE $0x78               // movq	120(%rsp), %rdi
+	WORD $0x294c; BYTE $0xf1                   // subq	%r14, %rcx
+	LONG $0xf8e18348                           // andq	$-8, %rcx
+	WORD $0x014c; BYTE $0xf1                   // addq	%r14, %rcx
+
+BB0_8:
+	WORD $0x3949; BYTE $0xc8     // cmpq	%rcx, %r8
+	JLE  BB0_13
+	LONG $0x24748b48; BYTE $0x30 // movq	48(%rsp), %rsi
+	LONG $0x24548948; BYTE $0x60 // movq	%rdx, 96(%rsp)
+	LONG $0x7ef941c4; BYTE $0xcf // vmovq	%xmm9, %r15
+	LONG $0x2464894c; BYTE $0x78 // movq	%r12, 120(%rsp)
+	LONG $0x24548b4c; BYTE $0x50 // movq	80(%rsp), %r10
+	LONG $0xcf1c8d49             // leaq	(%r15,%rcx,8), %rbx
+	LONG $0x26348d4e             // leaq	(%rsi,%r12), %r14
+	LONG $0x24448948; BYTE $0x58 // movq	%rax, 88(%rsp)
+	WORD $0x894d; BYTE $0xcc     // movq	%r9, %r12
+	LONG $0x24448b48; BYTE $0x70 // movq	112(%rsp), %rax
+	LONG $0x244c8b4c; BYTE $0x28 // movq	40(%rsp), %r9
+	LONG $0x7ef961c4; BYTE $0xc6 // vmovq	%xmm8, %rsi
+
+BB0_14:
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JLE  BB0_19
+	LONG $0x01f88348             // cmpq	$1, %rax
+	JE   BB0_24
+	LONG $0x246c8b4c; BYTE $0x78 // movq	120(%rsp), %r13
+	WORD $0x8948; BYTE $0xda     // movq	%rbx, %rdx
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+
+BB0_16:
+	LONG $0x0210fbc5               // vmovsd	(%rdx), %xmm0
+	LONG $0x10c58349               // addq	$16, %r13
+	LONG $0x0416f9c5; BYTE $0x32   // vmovhpd	(%rdx,%rsi), %xmm0, %xmm0
+	WORD $0x014c; BYTE $0xda       // addq	%r11, %rdx
+	LONG $0x5979c1c4; WORD $0xf045 // vmulpd	-16(%r13), %xmm0, %xmm0
+	LONG $0xc858f3c5               // vaddsd	%xmm0, %xmm1, %xmm1
+	LONG $0xc015f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xc958fbc5               // vaddsd	%xmm1, %xmm0, %xmm1
+	WORD $0x394d; BYTE $0xee       // cmpq	%r13, %r14
+	JNE  BB0_16
+	WORD $0x894c; BYTE $0xca       // movq	%r9, %rdx
+	WORD $0x394c; BYTE $0xc8       // cmpq	%r9, %rax
+	JE   BB0_19
+
+BB0_15:
+	WORD $0x894d; BYTE $0xc5       // movq	%r8, %r13
+	LONG $0xeaaf0f4c               // imulq	%rdx, %r13
+	WORD $0x0148; BYTE $0xfa       // addq	%rdi, %rdx
+	WORD $0x0149; BYTE $0xcd       // addq	%rcx, %r13
+	LONG $0x107b81c4; WORD $0xef2c // vmovsd	(%r15,%r13,8), %xmm5
+	LONG $0xb9d1c2c4; WORD $0xd20c // vfmadd231sd	(%r10,%rdx,8), %xmm5, %xmm1
+
+BB0_19:
+	LONG $0x117bc1c4; WORD $0xcc0c // vmovsd	%xmm1, (%r12,%rcx,8)
+	LONG $0x01c18348               // addq	$1, %rcx
+	LONG $0x08c38348               // addq	$8, %rbx
+	WORD $0x3949; BYTE $0xc8       // cmpq	%rcx, %r8
+	JNE  BB0_14
+	WORD $0x894d; BYTE $0xe1       // movq	%r12, %r9
+	LONG $0x24548b48; BYTE $0x60   // movq	96(%rsp), %rdx
+	LONG $0x24648b4c; BYTE $0x78   // movq	120(%rsp), %r12
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+
+BB0_13:
+	LONG $0x7ef961c4; BYTE $0xc3   // vmovq	%xmm8, %rbx
+	LONG $0x24448348; WORD $0x0168 // addq	$1, 104(%rsp)
+	LONG $0x24748b48; BYTE $0x68   // movq	104(%rsp), %rsi
+	WORD $0x0149; BYTE $0xd9       // addq	%rbx, %r9
+	LONG $0x245c8b48; BYTE $0x70   // movq	112(%rsp), %rbx
+	WORD $0x0148; BYTE $0xdf       // addq	%rbx, %rdi
+	LONG $0x7ef9e1c4; BYTE $0xfb   // vmovq	%xmm7, %rbx
+	WORD $0x0149; BYTE $0xdc       // addq	%rbx, %r12
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x24743948; BYTE $0x48   // cmpq	%rsi, 72(%rsp)
+	JNE  BB0_20
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+
+BB0_33:
+	LONG $0xd0658d48 // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_36:
+	LONG $0xe457d9c5               // vxorpd	%xmm4, %xmm4, %xmm4
+	LONG $0x48fdf162; WORD $0xdc28 // vmovapd	%zmm4, %zmm3
+	LONG $0x48fdf162; WORD $0xd428 // vmovapd	%zmm4, %zmm2
+	LONG $0x48fdf162; WORD $0xcc28 // vmovapd	%zmm4, %zmm1
+	JMP  BB0_7
+
+BB0_24:
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	JMP  BB0_15
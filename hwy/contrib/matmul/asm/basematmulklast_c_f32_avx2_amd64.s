@@ -0,0 +1,1091 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmulklast_c_f32_avx2_amd64.c
+
+TEXT ·matmulklast_c_f32_avx2(SB), $288-72
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ c+16(FP), DX
+	MOVQ pm+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_a+48(FP), R11
+	MOVQ R11, 256(SP)
+	MOVQ plen_b+56(FP), R11
+	MOVQ R11, 264(SP)
+	MOVQ plen_c+64(FP), R11
+	MOVQ R11, 272(SP)
+	QUAD $0x000000f024ac8d48                   // leaq	240(%rsp), %rbp
+	WORD $0x8949; BYTE $0xfe                   // movq	%rdi, %r14
+	LONG $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348                           // andq	$-32, %rsp
+	WORD $0x8b48; BYTE $0x01                   // movq	(%rcx), %rax
+	WORD $0x8b49; BYTE $0x08                   // movq	(%r8), %rcx
+	QUAD $0x000000b824b48948                   // movq	%rsi, 184(%rsp)
+	WORD $0x8b4d; BYTE $0x39                   // movq	(%r9), %r15
+	LONG $0x24148948                           // movq	%rdx, (%rsp)
+	LONG $0x24448948; BYTE $0x18               // movq	%rax, 24(%rsp)
+	QUAD $0x00000080248c8948                   // movq	%rcx, 128(%rsp)
+	LONG $0x01f88348                           // cmpq	$1, %rax
+	JE   BB0_2
+	LONG $0x03f88348                           // cmpq	$3, %rax
+	JLE  BB0_103
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	WORD $0x894d; BYTE $0xf8                   // movq	%r15, %r8
+	WORD $0x8948; BYTE $0xd7                   // movq	%rdx, %rdi
+	WORD $0xd231                               // xorl	%edx, %edx
+	QUAD $0x000000008d148d4c                   // leaq	0(,%rcx,4), %r10
+	LONG $0x090c8d48                           // leaq	(%rcx,%rcx), %rcx
+	QUAD $0x000000d824bc894c                   // movq	%r15, 216(%rsp)
+	LONG $0x04e0c149                           // salq	$4, %r8
+	LONG $0x01248d4c                           // leaq	(%rcx,%rax), %r12
+	LONG $0x04e0c148                           // salq	$4, %rax
+	LONG $0x244c8948; BYTE $0x48               // movq	%rcx, 72(%rsp)
+	QUAD $0x00000000bd0c8d4a                   // leaq	0(,%r15,4), %rcx
+	LONG $0x24448948; BYTE $0x10               // movq	%rax, 16(%rsp)
+	LONG $0x3f048d4b                           // leaq	(%r15,%r15), %rax
+	LONG $0x0e1c8d49                           // leaq	(%r14,%rcx), %rbx
+	QUAD $0x000000d024848948                   // movq	%rax, 208(%rsp)
+	WORD $0x014c; BYTE $0xf8                   // addq	%r15, %rax
+	LONG $0x0b2c8d4c                           // leaq	(%rbx,%rcx), %r13
+	WORD $0x8949; BYTE $0xdb                   // movq	%rbx, %r11
+	QUAD $0x000000c824848948                   // movq	%rax, 200(%rsp)
+	LONG $0xf8478d49                           // leaq	-8(%r15), %rax
+	LONG $0x0d4c8d4d; BYTE $0x00               // leaq	0(%r13,%rcx), %r9
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	LONG $0x244c8948; BYTE $0x78               // movq	%rcx, 120(%rsp)
+	LONG $0x2464894c; BYTE $0x08               // movq	%r12, 8(%rsp)
+	QUAD $0x00000008c5048d48                   // leaq	8(,%rax,8), %rax
+	QUAD $0x000000b02484c748; LONG $0x00000000 // movq	$0, 176(%rsp)
+	QUAD $0x000003502444c748; BYTE $0x00       // movq	$3, 80(%rsp)
+	LONG $0x24448948; BYTE $0x58               // movq	%rax, 88(%rsp)
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	WORD $0x894d; BYTE $0xe8                   // movq	%r13, %r8
+	WORD $0x894d; BYTE $0xf5                   // movq	%r14, %r13
+
+BB0_29:
+	QUAD $0x00000080249c8b48                   // movq	128(%rsp), %rbx
+	LONG $0x1a0c8d48                           // leaq	(%rdx,%rbx), %rcx
+	LONG $0x244c8948; BYTE $0x40               // movq	%rcx, 64(%rsp)
+	WORD $0x8548; BYTE $0xdb                   // testq	%rbx, %rbx
+	JLE  BB0_40
+	LONG $0x24748b48; BYTE $0x48               // movq	72(%rsp), %rsi
+	LONG $0x2464894c; BYTE $0x30               // movq	%r12, 48(%rsp)
+	LONG $0x3a1c8d49                           // leaq	(%r10,%rdi), %rbx
+	LONG $0x247c8948; BYTE $0x28               // movq	%rdi, 40(%rsp)
+	QUAD $0x000000b8248c8b48                   // movq	184(%rsp), %rcx
+	WORD $0x2948; BYTE $0xd6                   // subq	%rdx, %rsi
+	LONG $0x24448948; BYTE $0x20               // movq	%rax, 32(%rsp)
+	LONG $0x24748948; BYTE $0x68               // movq	%rsi, 104(%rsp)
+	WORD $0x894c; BYTE $0xe6                   // movq	%r12, %rsi
+	WORD $0x2948; BYTE $0xd6                   // subq	%rdx, %rsi
+	LONG $0x245c8948; BYTE $0x70               // movq	%rbx, 112(%rsp)
+	WORD $0x894c; BYTE $0xdb                   // movq	%r11, %rbx
+	WORD $0x894d; BYTE $0xeb                   // movq	%r13, %r11
+	QUAD $0x000000c02484c748; LONG $0x00000000 // movq	$0, 192(%rsp)
+	LONG $0x24748948; BYTE $0x60               // movq	%rsi, 96(%rsp)
+	LONG $0x2454894c; BYTE $0x38               // movq	%r10, 56(%rsp)
+	WORD $0x8949; BYTE $0xfa                   // movq	%rdi, %r10
+
+BB0_39:
+	LONG $0x07ff8349             // cmpq	$7, %r15
+	JLE  BB0_58
+	LONG $0xdb57e0c5             // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	LONG $0xe328fcc5             // vmovaps	%ymm3, %ymm4
+	LONG $0xcb28fcc5             // vmovaps	%ymm3, %ymm1
+	LONG $0xd328fcc5             // vmovaps	%ymm3, %ymm2
+
+BB0_31:
+	LONG $0x4410fcc5; WORD $0xe081             // vmovups	-32(%rcx,%rax,4), %ymm0
+	LONG $0xb87dc2c4; WORD $0x8354; BYTE $0xe0 // vfmadd231ps	-32(%r11,%rax,4), %ymm0, %ymm2
+	LONG $0xb87de2c4; WORD $0x834c; BYTE $0xe0 // vfmadd231ps	-32(%rbx,%rax,4), %ymm0, %ymm1
+	LONG $0xb87dc2c4; WORD $0x8064; BYTE $0xe0 // vfmadd231ps	-32(%r8,%rax,4), %ymm0, %ymm4
+	LONG $0xb87dc2c4; WORD $0x815c; BYTE $0xe0 // vfmadd231ps	-32(%r9,%rax,4), %ymm0, %ymm3
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_31
+	LONG $0x24548b48; BYTE $0x58               // movq	88(%rsp), %rdx
+
+BB0_30:
+	LONG $0x197de3c4; WORD $0x01d0 // vextractf128	$0x1, %ymm2, %xmm0
+	LONG $0xd258f8c5               // vaddps	%xmm2, %xmm0, %xmm2
+	LONG $0xc212e8c5               // vmovhlps	%xmm2, %xmm2, %xmm0
+	LONG $0xd058e8c5               // vaddps	%xmm0, %xmm2, %xmm2
+	LONG $0xc216fac5               // vmovshdup	%xmm2, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc958f8c5               // vaddps	%xmm1, %xmm0, %xmm1
+	LONG $0xc112f0c5               // vmovhlps	%xmm1, %xmm1, %xmm0
+	LONG $0xc858f0c5               // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc116fac5               // vmovshdup	%xmm1, %xmm0
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0x197de3c4; WORD $0x01e0 // vextractf128	$0x1, %ymm4, %xmm0
+	LONG $0xc458f8c5               // vaddps	%xmm4, %xmm0, %xmm0
+	LONG $0xe012f8c5               // vmovhlps	%xmm0, %xmm0, %xmm4
+	LONG $0xc458f8c5               // vaddps	%xmm4, %xmm0, %xmm0
+	LONG $0xe016fac5               // vmovshdup	%xmm0, %xmm4
+	LONG $0xc458fac5               // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01dc // vextractf128	$0x1, %ymm3, %xmm4
+	LONG $0xe358d8c5               // vaddps	%xmm3, %xmm4, %xmm4
+	LONG $0xdc12d8c5               // vmovhlps	%xmm4, %xmm4, %xmm3
+	LONG $0xe358d8c5               // vaddps	%xmm3, %xmm4, %xmm4
+	LONG $0xdc16fac5               // vmovshdup	%xmm4, %xmm3
+	LONG $0xe358dac5               // vaddss	%xmm3, %xmm4, %xmm4
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_32
+	WORD $0x894c; BYTE $0xff       // movq	%r15, %rdi
+	QUAD $0x000000a024948948       // movq	%rdx, 160(%rsp)
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	QUAD $0x000000a824bc8948       // movq	%rdi, 168(%rsp)
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_59
+	QUAD $0x000000b024848b48       // movq	176(%rsp), %rax
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	QUAD $0x0000008824bc894c       // movq	%r15, 136(%rsp)
+	LONG $0x03efc148               // shrq	$3, %rdi
+	LONG $0x05e7c148               // salq	$5, %rdi
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x862c8d4d               // leaq	(%r14,%rax,4), %r13
+	QUAD $0x000000c024848b48       // movq	192(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x86248d4c               // leaq	(%rsi,%rax,4), %r12
+	QUAD $0x000000d824848b48       // movq	216(%rsp), %rax
+	QUAD $0x000000d024b48b48       // movq	208(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x86048d49               // leaq	(%r14,%rax,4), %rax
+	QUAD $0x0000009024848948       // movq	%rax, 144(%rsp)
+	LONG $0x32048d48               // leaq	(%rdx,%rsi), %rax
+	QUAD $0x0000009024bc8b4c       // movq	144(%rsp), %r15
+	LONG $0x86348d49               // leaq	(%r14,%rax,4), %rsi
+	QUAD $0x000000c824848b48       // movq	200(%rsp), %rax
+	QUAD $0x0000009024948948       // movq	%rdx, 144(%rsp)
+	QUAD $0x0000009824b48948       // movq	%rsi, 152(%rsp)
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	QUAD $0x0000009824948b48       // movq	152(%rsp), %rdx
+	LONG $0x86348d49               // leaq	(%r14,%rax,4), %rsi
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_34:
+	LONG $0x107cc1c4; WORD $0x041c             // vmovups	(%r12,%rax), %ymm3
+	LONG $0x5964c1c4; WORD $0x056c; BYTE $0x00 // vmulps	0(%r13,%rax), %ymm3, %ymm5
+	LONG $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG $0xfdc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm7
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0xfa58c2c5                           // vaddss	%xmm2, %xmm7, %xmm7
+	LONG $0xd515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm2
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xd758eac5                           // vaddss	%xmm7, %xmm2, %xmm2
+	LONG $0xf258cac5                           // vaddss	%xmm2, %xmm6, %xmm6
+	LONG $0xd658d2c5                           // vaddss	%xmm6, %xmm5, %xmm2
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0xf258cac5                           // vaddss	%xmm2, %xmm6, %xmm6
+	LONG $0xd515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm2
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG $0x5964c1c4; WORD $0x072c             // vmulps	(%r15,%rax), %ymm3, %ymm5
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xfdc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm7
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0xf958c2c5                           // vaddss	%xmm1, %xmm7, %xmm7
+	LONG $0xcd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm1
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xcf58f2c5                           // vaddss	%xmm7, %xmm1, %xmm1
+	LONG $0xf158cac5                           // vaddss	%xmm1, %xmm6, %xmm6
+	LONG $0xce58d2c5                           // vaddss	%xmm6, %xmm5, %xmm1
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0xf158cac5                           // vaddss	%xmm1, %xmm6, %xmm6
+	LONG $0xcd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm1
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x2c59e4c5; BYTE $0x02               // vmulps	(%rdx,%rax), %ymm3, %ymm5
+	LONG $0x1c59e4c5; BYTE $0x06               // vmulps	(%rsi,%rax), %ymm3, %ymm3
+	LONG $0x20c08348                           // addq	$32, %rax
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xfdc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm7
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG $0xf858c2c5                           // vaddss	%xmm0, %xmm7, %xmm7
+	LONG $0xc515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm0
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0xf058cac5                           // vaddss	%xmm0, %xmm6, %xmm6
+	LONG $0xc658d2c5                           // vaddss	%xmm6, %xmm5, %xmm0
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0xf058cac5                           // vaddss	%xmm0, %xmm6, %xmm6
+	LONG $0xc515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm0
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xf3c6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm6
+	LONG $0xf458cac5                           // vaddss	%xmm4, %xmm6, %xmm6
+	LONG $0xe315e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm4
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xebc6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm5
+	LONG $0x197de3c4; WORD $0x01db             // vextractf128	$0x1, %ymm3, %xmm3
+	LONG $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG $0xe558e2c5                           // vaddss	%xmm5, %xmm3, %xmm4
+	LONG $0xebc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm5
+	LONG $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG $0xe315e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm4
+	LONG $0xdbc6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	WORD $0x3948; BYTE $0xf8                   // cmpq	%rdi, %rax
+	JNE  BB0_34
+	QUAD $0x000000a824b48b48                   // movq	168(%rsp), %rsi
+	QUAD $0x0000009024948b48                   // movq	144(%rsp), %rdx
+	QUAD $0x0000008824bc8b4c                   // movq	136(%rsp), %r15
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x07                   // andl	$7, %esi
+	JE   BB0_32
+
+BB0_33:
+	QUAD $0x000000a824b48b48                   // movq	168(%rsp), %rsi
+	WORD $0x2948; BYTE $0xc6                   // subq	%rax, %rsi
+	LONG $0xff7e8d48                           // leaq	-1(%rsi), %rdi
+	LONG $0x02ff8348                           // cmpq	$2, %rdi
+	JBE  BB0_37
+	QUAD $0x000000a024bc8b48                   // movq	160(%rsp), %rdi
+	QUAD $0x000000b824ac8b4c                   // movq	184(%rsp), %r13
+	WORD $0x0148; BYTE $0xf8                   // addq	%rdi, %rax
+	QUAD $0x000000c024bc8b48                   // movq	192(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	LONG $0x1078c1c4; WORD $0xbd5c; BYTE $0x00 // vmovups	0(%r13,%rdi,4), %xmm3
+	QUAD $0x000000b024bc8b48                   // movq	176(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	LONG $0x5960c1c4; WORD $0xbe2c             // vmulps	(%r14,%rdi,4), %xmm3, %xmm5
+	QUAD $0x000000d824bc8b48                   // movq	216(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	LONG $0xd258d2c5                           // vaddss	%xmm2, %xmm5, %xmm2
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0xf258cac5                           // vaddss	%xmm2, %xmm6, %xmm6
+	LONG $0xd515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm2
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG $0x5960c1c4; WORD $0xbe2c             // vmulps	(%r14,%rdi,4), %xmm3, %xmm5
+	QUAD $0x000000d024bc8b48                   // movq	208(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	LONG $0xc958d2c5                           // vaddss	%xmm1, %xmm5, %xmm1
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0xf158cac5                           // vaddss	%xmm1, %xmm6, %xmm6
+	LONG $0xcd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm1
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x5960c1c4; WORD $0xbe2c             // vmulps	(%r14,%rdi,4), %xmm3, %xmm5
+	QUAD $0x000000c824bc8b48                   // movq	200(%rsp), %rdi
+	WORD $0x0148; BYTE $0xf8                   // addq	%rdi, %rax
+	LONG $0x5960c1c4; WORD $0x861c             // vmulps	(%r14,%rax,4), %xmm3, %xmm3
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xfce08348                           // andq	$-4, %rax
+	LONG $0xc058d2c5                           // vaddss	%xmm0, %xmm5, %xmm0
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x03                   // andl	$3, %esi
+	LONG $0xf058cac5                           // vaddss	%xmm0, %xmm6, %xmm6
+	LONG $0xc515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm0
+	LONG $0xe458e2c5                           // vaddss	%xmm4, %xmm3, %xmm4
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xebc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm5
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xeb15e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm5
+	LONG $0xdbc6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	JE   BB0_32
+
+BB0_37:
+	QUAD $0x000000c024bc8b48       // movq	192(%rsp), %rdi
+	QUAD $0x000000b824a48b4c       // movq	184(%rsp), %r12
+	QUAD $0x000000b024ac8b4c       // movq	176(%rsp), %r13
+	QUAD $0x000000d024b48b48       // movq	208(%rsp), %rsi
+	LONG $0x17048d48               // leaq	(%rdi,%rdx), %rax
+	LONG $0x107ac1c4; WORD $0x841c // vmovss	(%r12,%rax,4), %xmm3
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	LONG $0xb961c2c4; WORD $0x8614 // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm2
+	QUAD $0x000000d824848b48       // movq	216(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb961c2c4; WORD $0x860c // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm1
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	LONG $0xb961c2c4; WORD $0x8604 // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm0
+	QUAD $0x000000c824848b48       // movq	200(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb961c2c4; WORD $0x8624 // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm4
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_32
+	LONG $0x07348d48               // leaq	(%rdi,%rax), %rsi
+	LONG $0x02c28348               // addq	$2, %rdx
+	LONG $0x107ac1c4; WORD $0xb41c // vmovss	(%r12,%rsi,4), %xmm3
+	LONG $0x05748d49; BYTE $0x00   // leaq	0(%r13,%rax), %rsi
+	LONG $0xb961c2c4; WORD $0xb614 // vfmadd231ss	(%r14,%rsi,4), %xmm3, %xmm2
+	QUAD $0x000000d824b48b48       // movq	216(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb961c2c4; WORD $0xb60c // vfmadd231ss	(%r14,%rsi,4), %xmm3, %xmm1
+	QUAD $0x000000d024b48b48       // movq	208(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb961c2c4; WORD $0xb604 // vfmadd231ss	(%r14,%rsi,4), %xmm3, %xmm0
+	QUAD $0x000000c824b48b48       // movq	200(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0xb961c2c4; WORD $0x8624 // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm4
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_32
+	LONG $0x17048d48               // leaq	(%rdi,%rdx), %rax
+	QUAD $0x000000d824b48b48       // movq	216(%rsp), %rsi
+	LONG $0x107ac1c4; WORD $0x841c // vmovss	(%r12,%rax,4), %xmm3
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	LONG $0xb961c2c4; WORD $0x8614 // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm2
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	QUAD $0x000000d024b48b48       // movq	208(%rsp), %rsi
+	LONG $0xb961c2c4; WORD $0x860c // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm1
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	QUAD $0x000000c824b48b48       // movq	200(%rsp), %rsi
+	LONG $0xb961c2c4; WORD $0x8604 // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm0
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+	LONG $0xb961c2c4; WORD $0x9624 // vfmadd231ss	(%r14,%rdx,4), %xmm3, %xmm4
+
+BB0_32:
+	QUAD $0x0000008024848b48       // movq	128(%rsp), %rax
+	LONG $0x117ac1c4; BYTE $0x12   // vmovss	%xmm2, (%r10)
+	QUAD $0x000000c024bc014c       // addq	%r15, 192(%rsp)
+	LONG $0x117ac1c4; WORD $0x820c // vmovss	%xmm1, (%r10,%rax,4)
+	LONG $0x24448b48; BYTE $0x68   // movq	104(%rsp), %rax
+	LONG $0x117ac1c4; WORD $0x8204 // vmovss	%xmm0, (%r10,%rax,4)
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+	LONG $0x117ac1c4; WORD $0x8224 // vmovss	%xmm4, (%r10,%rax,4)
+	LONG $0x24448b48; BYTE $0x78   // movq	120(%rsp), %rax
+	LONG $0x04c28349               // addq	$4, %r10
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0x24448b48; BYTE $0x70   // movq	112(%rsp), %rax
+	WORD $0x3949; BYTE $0xc2       // cmpq	%rax, %r10
+	JNE  BB0_39
+	LONG $0x24548b4c; BYTE $0x38   // movq	56(%rsp), %r10
+	LONG $0x24648b4c; BYTE $0x30   // movq	48(%rsp), %r12
+	WORD $0x894d; BYTE $0xdd       // movq	%r11, %r13
+	WORD $0x8949; BYTE $0xdb       // movq	%rbx, %r11
+	LONG $0x247c8b48; BYTE $0x28   // movq	40(%rsp), %rdi
+	LONG $0x24448b48; BYTE $0x20   // movq	32(%rsp), %rax
+
+BB0_40:
+	LONG $0x245c8b48; BYTE $0x08   // movq	8(%rsp), %rbx
+	LONG $0x24548b48; BYTE $0x40   // movq	64(%rsp), %rdx
+	WORD $0x014d; BYTE $0xd4       // addq	%r10, %r12
+	WORD $0x0149; BYTE $0xc5       // addq	%rax, %r13
+	LONG $0x24448348; WORD $0x0450 // addq	$4, 80(%rsp)
+	WORD $0x0149; BYTE $0xc3       // addq	%rax, %r11
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x245c8b48; BYTE $0x10   // movq	16(%rsp), %rbx
+	LONG $0x2454014c; BYTE $0x48   // addq	%r10, 72(%rsp)
+	LONG $0x244c8b48; BYTE $0x50   // movq	80(%rsp), %rcx
+	WORD $0x0148; BYTE $0xdf       // addq	%rbx, %rdi
+	LONG $0x245c8b48; BYTE $0x78   // movq	120(%rsp), %rbx
+	QUAD $0x000000b0249c0148       // addq	%rbx, 176(%rsp)
+	QUAD $0x000000d8249c0148       // addq	%rbx, 216(%rsp)
+	QUAD $0x000000d0249c0148       // addq	%rbx, 208(%rsp)
+	QUAD $0x000000c8249c0148       // addq	%rbx, 200(%rsp)
+	LONG $0x244c3948; BYTE $0x18   // cmpq	%rcx, 24(%rsp)
+	JG   BB0_29
+	LONG $0x24448b48; BYTE $0x18   // movq	24(%rsp), %rax
+	LONG $0x04e88348               // subq	$4, %rax
+	LONG $0x02e8c148               // shrq	$2, %rax
+	QUAD $0x0000000485048d48       // leaq	4(,%rax,4), %rax
+
+BB0_4:
+	LONG $0x24443948; BYTE $0x18 // cmpq	%rax, 24(%rsp)
+	JLE  BB0_100
+	QUAD $0x00000080248c8b48     // movq	128(%rsp), %rcx
+	WORD $0x8548; BYTE $0xc9     // testq	%rcx, %rcx
+	JLE  BB0_100
+	WORD $0x8948; BYTE $0xca     // movq	%rcx, %rdx
+	QUAD $0x000000008d048d4c     // leaq	0(,%rcx,4), %r8
+	WORD $0x894c; BYTE $0xfb     // movq	%r15, %rbx
+	QUAD $0x000000b824a48b4c     // movq	184(%rsp), %r12
+	LONG $0xd0af0f48             // imulq	%rax, %rdx
+	QUAD $0x000000a82484894c     // movq	%r8, 168(%rsp)
+	LONG $0xd8af0f48             // imulq	%rax, %rbx
+	LONG $0x11348d48             // leaq	(%rcx,%rdx), %rsi
+	LONG $0x240c8b48             // movq	(%rsp), %rcx
+	LONG $0x9e3c8d49             // leaq	(%r14,%rbx,4), %rdi
+	LONG $0xb10c8d48             // leaq	(%rcx,%rsi,4), %rcx
+	QUAD $0x000000d0248c8948     // movq	%rcx, 208(%rsp)
+	QUAD $0x00000000bd0c8d4a     // leaq	0(,%r15,4), %rcx
+	QUAD $0x000000c8248c8948     // movq	%rcx, 200(%rsp)
+	LONG $0xf84f8d49             // leaq	-8(%r15), %rcx
+	LONG $0x03e9c148             // shrq	$3, %rcx
+	QUAD $0x00000008cd0c8d48     // leaq	8(,%rcx,8), %rcx
+	QUAD $0x000000c0248c8948     // movq	%rcx, 192(%rsp)
+
+BB0_52:
+	LONG $0x240c8b48         // movq	(%rsp), %rcx
+	QUAD $0x000000b824848948 // movq	%rax, 184(%rsp)
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	QUAD $0x000000b024b48948 // movq	%rsi, 176(%rsp)
+	LONG $0x912c8d4c         // leaq	(%rcx,%rdx,4), %r13
+	WORD $0x894c; BYTE $0xe1 // movq	%r12, %rcx
+
+BB0_42:
+	LONG $0x07ff8349             // cmpq	$7, %r15
+	JLE  BB0_60
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_44:
+	LONG $0x7c10fcc5; WORD $0xe087             // vmovups	-32(%rdi,%rax,4), %ymm7
+	LONG $0xb845e2c4; WORD $0x814c; BYTE $0xe0 // vfmadd231ps	-32(%rcx,%rax,4), %ymm7, %ymm1
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_44
+	QUAD $0x000000c024948b48                   // movq	192(%rsp), %rdx
+
+BB0_43:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_45
+	WORD $0x894c; BYTE $0xfe       // movq	%r15, %rsi
+	QUAD $0x000000d824948948       // movq	%rdx, 216(%rsp)
+	WORD $0x2948; BYTE $0xd6       // subq	%rdx, %rsi
+	LONG $0xff468d48               // leaq	-1(%rsi), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_61
+	LONG $0x1a048d48               // leaq	(%rdx,%rbx), %rax
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	LONG $0x861c8d4d               // leaq	(%r14,%rax,4), %r11
+	LONG $0x03e8c149               // shrq	$3, %r8
+	LONG $0x0a048d4a               // leaq	(%rdx,%r9), %rax
+	LONG $0x84148d4d               // leaq	(%r12,%rax,4), %r10
+	LONG $0x05e0c149               // salq	$5, %r8
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_47:
+	LONG $0x107cc1c4; WORD $0x023c // vmovups	(%r10,%rax), %ymm7
+	LONG $0x5944c1c4; WORD $0x0314 // vmulps	(%r11,%rax), %ymm7, %ymm2
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xcac6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xdac6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xc215e8c5               // vunpckhps	%xmm2, %xmm2, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd858e2c5               // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f2c5               // vaddss	%xmm3, %xmm1, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc0       // cmpq	%r8, %rax
+	JNE  BB0_47
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x07c6f640               // testb	$7, %sil
+	JE   BB0_45
+
+BB0_46:
+	WORD $0x2948; BYTE $0xc6       // subq	%rax, %rsi
+	LONG $0xff468d4c               // leaq	-1(%rsi), %r8
+	LONG $0x02f88349               // cmpq	$2, %r8
+	JBE  BB0_50
+	QUAD $0x000000d824948b4c       // movq	216(%rsp), %r10
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+	LONG $0x08048d4e               // leaq	(%rax,%r9), %r8
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	LONG $0x1078c1c4; WORD $0x860c // vmovups	(%r14,%rax,4), %xmm1
+	LONG $0x597081c4; WORD $0x840c // vmulps	(%r12,%r8,4), %xmm1, %xmm1
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x03       // andl	$3, %esi
+	LONG $0xc058f2c5               // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_45
+
+BB0_50:
+	LONG $0x11048d49               // leaq	(%r9,%rdx), %rax
+	LONG $0x13348d48               // leaq	(%rbx,%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0xb63c // vmovss	(%r14,%rsi,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x8404 // vfmadd231ss	(%r12,%rax,4), %xmm7, %xmm0
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x394c; BYTE $0xf8       // cmpq	%r15, %rax
+	JGE  BB0_45
+	LONG $0x18348d48               // leaq	(%rax,%rbx), %rsi
+	LONG $0x02c28348               // addq	$2, %rdx
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x107ac1c4; WORD $0xb63c // vmovss	(%r14,%rsi,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x8404 // vfmadd231ss	(%r12,%rax,4), %xmm7, %xmm0
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_45
+	LONG $0x11048d49               // leaq	(%r9,%rdx), %rax
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x107ac1c4; WORD $0x843c // vmovss	(%r12,%rax,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x9604 // vfmadd231ss	(%r14,%rdx,4), %xmm7, %xmm0
+
+BB0_45:
+	QUAD $0x000000c824848b48       // movq	200(%rsp), %rax
+	LONG $0x117ac1c4; WORD $0x0045 // vmovss	%xmm0, 0(%r13)
+	LONG $0x04c58349               // addq	$4, %r13
+	WORD $0x014d; BYTE $0xf9       // addq	%r15, %r9
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	QUAD $0x000000d024848b48       // movq	208(%rsp), %rax
+	WORD $0x3949; BYTE $0xc5       // cmpq	%rax, %r13
+	JNE  BB0_42
+	QUAD $0x000000b824848b48       // movq	184(%rsp), %rax
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	WORD $0x014c; BYTE $0xfb       // addq	%r15, %rbx
+	QUAD $0x000000c8248c8b48       // movq	200(%rsp), %rcx
+	QUAD $0x000000a824948b4c       // movq	168(%rsp), %r10
+	LONG $0x01c08348               // addq	$1, %rax
+	QUAD $0x000000d02494014c       // addq	%r10, 208(%rsp)
+	WORD $0x8948; BYTE $0xf2       // movq	%rsi, %rdx
+	WORD $0x0148; BYTE $0xcf       // addq	%rcx, %rdi
+	LONG $0x24443948; BYTE $0x18   // cmpq	%rax, 24(%rsp)
+	JE   BB0_100
+	QUAD $0x00000080248c8b48       // movq	128(%rsp), %rcx
+	WORD $0x0148; BYTE $0xce       // addq	%rcx, %rsi
+	JMP  BB0_52
+
+BB0_58:
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xe328fcc5 // vmovaps	%ymm3, %ymm4
+	LONG $0xcb28fcc5 // vmovaps	%ymm3, %ymm1
+	LONG $0xd328fcc5 // vmovaps	%ymm3, %ymm2
+	JMP  BB0_30
+
+BB0_59:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_33
+
+BB0_60:
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	JMP  BB0_43
+
+BB0_61:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_46
+
+BB0_2:
+	LONG $0x03f98348                           // cmpq	$3, %rcx
+	JLE  BB0_53
+	WORD $0x894c; BYTE $0xfb                   // movq	%r15, %rbx
+	QUAD $0x00000000bd048d4a                   // leaq	0(,%r15,4), %rax
+	LONG $0x3f348d4b                           // leaq	(%r15,%r15), %rsi
+	QUAD $0x000000a024948948                   // movq	%rdx, 160(%rsp)
+	LONG $0x04e3c148                           // salq	$4, %rbx
+	QUAD $0x0000009824848948                   // movq	%rax, 152(%rsp)
+	LONG $0x245c8948; BYTE $0x78               // movq	%rbx, 120(%rsp)
+	QUAD $0x000000b8249c8b48                   // movq	184(%rsp), %rbx
+	QUAD $0x000000d024b48948                   // movq	%rsi, 208(%rsp)
+	WORD $0x014c; BYTE $0xfe                   // addq	%r15, %rsi
+	LONG $0x03248d4c                           // leaq	(%rbx,%rax), %r12
+	WORD $0x8949; BYTE $0xda                   // movq	%rbx, %r10
+	QUAD $0x000000b024b48948                   // movq	%rsi, 176(%rsp)
+	LONG $0x042c8d4d                           // leaq	(%r12,%rax), %r13
+	QUAD $0x000000d824bc894c                   // movq	%r15, 216(%rsp)
+	LONG $0x054c8d4d; BYTE $0x00               // leaq	0(%r13,%rax), %r9
+	LONG $0xfc418d48                           // leaq	-4(%rcx), %rax
+	QUAD $0x000000c02484c748; LONG $0x00000000 // movq	$0, 192(%rsp)
+	LONG $0x02e8c148                           // shrq	$2, %rax
+	QUAD $0x000000c8248c894c                   // movq	%r9, 200(%rsp)
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	LONG $0x04e0c148                           // salq	$4, %rax
+	LONG $0x02448d48; BYTE $0x10               // leaq	16(%rdx,%rax), %rax
+	LONG $0x244c8948; BYTE $0x58               // movq	%rcx, 88(%rsp)
+	WORD $0x8948; BYTE $0xd9                   // movq	%rbx, %rcx
+	LONG $0x24448948; BYTE $0x70               // movq	%rax, 112(%rsp)
+	LONG $0xf8478d49                           // leaq	-8(%r15), %rax
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	QUAD $0x00000008c5048d48                   // leaq	8(,%rax,8), %rax
+	QUAD $0x0000008824848948                   // movq	%rax, 136(%rsp)
+
+BB0_15:
+	LONG $0x07ff8349             // cmpq	$7, %r15
+	JLE  BB0_54
+	LONG $0xd257e8c5             // vxorps	%xmm2, %xmm2, %xmm2
+	QUAD $0x000000c8248c8b4c     // movq	200(%rsp), %r9
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	LONG $0xca28fcc5             // vmovaps	%ymm2, %ymm1
+	LONG $0xda28fcc5             // vmovaps	%ymm2, %ymm3
+	LONG $0xe228fcc5             // vmovaps	%ymm2, %ymm4
+
+BB0_7:
+	LONG $0x107cc1c4; WORD $0x8644; BYTE $0xe0 // vmovups	-32(%r14,%rax,4), %ymm0
+	LONG $0xb87dc2c4; WORD $0x8264; BYTE $0xe0 // vfmadd231ps	-32(%r10,%rax,4), %ymm0, %ymm4
+	LONG $0xb87dc2c4; WORD $0x845c; BYTE $0xe0 // vfmadd231ps	-32(%r12,%rax,4), %ymm0, %ymm3
+	LONG $0xb87dc2c4; WORD $0x854c; BYTE $0xe0 // vfmadd231ps	-32(%r13,%rax,4), %ymm0, %ymm1
+	LONG $0xb87dc2c4; WORD $0x8154; BYTE $0xe0 // vfmadd231ps	-32(%r9,%rax,4), %ymm0, %ymm2
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_7
+	QUAD $0x000000c8248c894c                   // movq	%r9, 200(%rsp)
+	QUAD $0x0000008824948b48                   // movq	136(%rsp), %rdx
+
+BB0_6:
+	LONG $0x197de3c4; WORD $0x01e0 // vextractf128	$0x1, %ymm4, %xmm0
+	LONG $0x197de3c4; WORD $0x01cd // vextractf128	$0x1, %ymm1, %xmm5
+	LONG $0xe458f8c5               // vaddps	%xmm4, %xmm0, %xmm4
+	LONG $0xc412d8c5               // vmovhlps	%xmm4, %xmm4, %xmm0
+	LONG $0xe058d8c5               // vaddps	%xmm0, %xmm4, %xmm4
+	LONG $0xc416fac5               // vmovshdup	%xmm4, %xmm0
+	LONG $0xe058dac5               // vaddss	%xmm0, %xmm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01d8 // vextractf128	$0x1, %ymm3, %xmm0
+	LONG $0xc358f8c5               // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xd812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm3
+	LONG $0xc358f8c5               // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xd816fac5               // vmovshdup	%xmm0, %xmm3
+	LONG $0xdb58fac5               // vaddss	%xmm3, %xmm0, %xmm3
+	LONG $0xc558f0c5               // vaddps	%xmm5, %xmm1, %xmm0
+	LONG $0x197de3c4; WORD $0x01d5 // vextractf128	$0x1, %ymm2, %xmm5
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xe314d8c5               // vunpcklps	%xmm3, %xmm4, %xmm4
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc958fac5               // vaddss	%xmm1, %xmm0, %xmm1
+	LONG $0xc558e8c5               // vaddps	%xmm5, %xmm2, %xmm0
+	LONG $0xd012f8c5               // vmovhlps	%xmm0, %xmm0, %xmm2
+	LONG $0xc058e8c5               // vaddps	%xmm0, %xmm2, %xmm0
+	LONG $0xd016fac5               // vmovshdup	%xmm0, %xmm2
+	LONG $0xd258fac5               // vaddss	%xmm2, %xmm0, %xmm2
+	LONG $0xca14f0c5               // vunpcklps	%xmm2, %xmm1, %xmm1
+	LONG $0xc116d8c5               // vmovlhps	%xmm1, %xmm4, %xmm0
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_8
+	WORD $0x894c; BYTE $0xf8       // movq	%r15, %rax
+	WORD $0x8948; BYTE $0xd6       // movq	%rdx, %rsi
+	WORD $0x2948; BYTE $0xd0       // subq	%rdx, %rax
+	QUAD $0x000000a824848948       // movq	%rax, 168(%rsp)
+	LONG $0x01e88348               // subq	$1, %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_55
+	QUAD $0x000000c024bc8b48       // movq	192(%rsp), %rdi
+	LONG $0x247c894c; BYTE $0x68   // movq	%r15, 104(%rsp)
+	LONG $0x961c8d49               // leaq	(%r14,%rdx,4), %rbx
+	QUAD $0x000000b0248c8b4c       // movq	176(%rsp), %r9
+	LONG $0x2454894c; BYTE $0x60   // movq	%r10, 96(%rsp)
+	LONG $0x17048d48               // leaq	(%rdi,%rdx), %rax
+	QUAD $0x000000d824bc8b48       // movq	216(%rsp), %rdi
+	LONG $0x811c8d4c               // leaq	(%rcx,%rax,4), %r11
+	LONG $0x17048d48               // leaq	(%rdi,%rdx), %rax
+	QUAD $0x000000d024bc8b48       // movq	208(%rsp), %rdi
+	LONG $0x81048d4c               // leaq	(%rcx,%rax,4), %r8
+	LONG $0x17048d48               // leaq	(%rdi,%rdx), %rax
+	LONG $0x813c8d48               // leaq	(%rcx,%rax,4), %rdi
+	LONG $0x11048d49               // leaq	(%r9,%rdx), %rax
+	LONG $0x810c8d4c               // leaq	(%rcx,%rax,4), %r9
+	QUAD $0x000000a824848b48       // movq	168(%rsp), %rax
+	QUAD $0x00000090248c894c       // movq	%r9, 144(%rsp)
+	QUAD $0x0000009024bc8b4c       // movq	144(%rsp), %r15
+	LONG $0x03e8c148               // shrq	$3, %rax
+	LONG $0x05e0c148               // salq	$5, %rax
+	WORD $0x8949; BYTE $0xc1       // movq	%rax, %r9
+	WORD $0xc031                   // xorl	%eax, %eax
+	WORD $0x894d; BYTE $0xca       // movq	%r9, %r10
+	QUAD $0x000000c8248c8b4c       // movq	200(%rsp), %r9
+
+BB0_10:
+	LONG $0x1410fcc5; BYTE $0x03   // vmovups	(%rbx,%rax), %ymm2
+	LONG $0x596cc1c4; WORD $0x031c // vmulps	(%r11,%rax), %ymm2, %ymm3
+	LONG $0x596cc1c4; WORD $0x0034 // vmulps	(%r8,%rax), %ymm2, %ymm6
+	LONG $0x2459ecc5; BYTE $0x07   // vmulps	(%rdi,%rax), %ymm2, %ymm4
+	LONG $0x596cc1c4; WORD $0x0714 // vmulps	(%r15,%rax), %ymm2, %ymm2
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xebc6e0c5; BYTE $0xff   // vshufps	$255, %xmm3, %xmm3, %xmm5
+	LONG $0xce14e0c5               // vunpcklps	%xmm6, %xmm3, %xmm1
+	LONG $0xdec648c5; BYTE $0x55   // vshufps	$85, %xmm6, %xmm6, %xmm11
+	LONG $0xcec648c5; BYTE $0xff   // vshufps	$255, %xmm6, %xmm6, %xmm9
+	LONG $0x1450c1c4; BYTE $0xe9   // vunpcklps	%xmm9, %xmm5, %xmm5
+	LONG $0xfcc6d8c5; BYTE $0xff   // vshufps	$255, %xmm4, %xmm4, %xmm7
+	LONG $0xd21458c5               // vunpcklps	%xmm2, %xmm4, %xmm10
+	LONG $0xe2c668c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm12
+	LONG $0xc2c668c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm8
+	LONG $0x1440c1c4; BYTE $0xf8   // vunpcklps	%xmm8, %xmm7, %xmm7
+	LONG $0x1670c1c4; BYTE $0xca   // vmovlhps	%xmm10, %xmm1, %xmm1
+	LONG $0xd4c658c5; BYTE $0x55   // vshufps	$85, %xmm4, %xmm4, %xmm10
+	LONG $0x142841c4; BYTE $0xd4   // vunpcklps	%xmm12, %xmm10, %xmm10
+	LONG $0xe21568c5               // vunpckhps	%xmm2, %xmm2, %xmm12
+	LONG $0xc058f0c5               // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0xcbc6e0c5; BYTE $0x55   // vshufps	$85, %xmm3, %xmm3, %xmm1
+	LONG $0x1470c1c4; BYTE $0xcb   // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0xde1548c5               // vunpckhps	%xmm6, %xmm6, %xmm11
+	LONG $0x1670c1c4; BYTE $0xca   // vmovlhps	%xmm10, %xmm1, %xmm1
+	LONG $0xd41558c5               // vunpckhps	%xmm4, %xmm4, %xmm10
+	LONG $0x197de3c4; WORD $0x01f6 // vextractf128	$0x1, %ymm6, %xmm6
+	LONG $0x142841c4; BYTE $0xd4   // vunpcklps	%xmm12, %xmm10, %xmm10
+	LONG $0x197de3c4; WORD $0x01e4 // vextractf128	$0x1, %ymm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01d2 // vextractf128	$0x1, %ymm2, %xmm2
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xcb15e0c5               // vunpckhps	%xmm3, %xmm3, %xmm1
+	LONG $0xc2c668c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm8
+	LONG $0x1470c1c4; BYTE $0xcb   // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0x1670c1c4; BYTE $0xca   // vmovlhps	%xmm10, %xmm1, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xcf16d0c5               // vmovlhps	%xmm7, %xmm5, %xmm1
+	LONG $0xea14d8c5               // vunpcklps	%xmm2, %xmm4, %xmm5
+	LONG $0xfec6c8c5; BYTE $0x55   // vshufps	$85, %xmm6, %xmm6, %xmm7
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01d9 // vextractf128	$0x1, %ymm3, %xmm1
+	LONG $0xde14f0c5               // vunpcklps	%xmm6, %xmm1, %xmm3
+	LONG $0xdd16e0c5               // vmovlhps	%xmm5, %xmm3, %xmm3
+	LONG $0xecc6d8c5; BYTE $0x55   // vshufps	$85, %xmm4, %xmm4, %xmm5
+	LONG $0x1450c1c4; BYTE $0xe8   // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0xc21568c5               // vunpckhps	%xmm2, %xmm2, %xmm8
+	LONG $0xc358f8c5               // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xdf14e0c5               // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0xfe15c8c5               // vunpckhps	%xmm6, %xmm6, %xmm7
+	LONG $0xdd16e0c5               // vmovlhps	%xmm5, %xmm3, %xmm3
+	LONG $0xec15d8c5               // vunpckhps	%xmm4, %xmm4, %xmm5
+	LONG $0xf6c6c8c5; BYTE $0xff   // vshufps	$255, %xmm6, %xmm6, %xmm6
+	LONG $0xe4c6d8c5; BYTE $0xff   // vshufps	$255, %xmm4, %xmm4, %xmm4
+	LONG $0x1450c1c4; BYTE $0xe8   // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0xd2c6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm2
+	LONG $0xe214d8c5               // vunpcklps	%xmm2, %xmm4, %xmm4
+	LONG $0xc358f8c5               // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xd915f0c5               // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xce14f0c5               // vunpcklps	%xmm6, %xmm1, %xmm1
+	LONG $0xdf14e0c5               // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0xcc16f0c5               // vmovlhps	%xmm4, %xmm1, %xmm1
+	LONG $0xdd16e0c5               // vmovlhps	%xmm5, %xmm3, %xmm3
+	LONG $0xc358f8c5               // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc2       // cmpq	%rax, %r10
+	JNE  BB0_10
+	QUAD $0x000000a8249c8b48       // movq	168(%rsp), %rbx
+	QUAD $0x000000c8248c894c       // movq	%r9, 200(%rsp)
+	LONG $0x247c8b4c; BYTE $0x68   // movq	104(%rsp), %r15
+	LONG $0x24548b4c; BYTE $0x60   // movq	96(%rsp), %r10
+	WORD $0x8948; BYTE $0xd8       // movq	%rbx, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	WORD $0xe383; BYTE $0x07       // andl	$7, %ebx
+	JE   BB0_8
+
+BB0_9:
+	QUAD $0x000000a824848b4c       // movq	168(%rsp), %r8
+	LONG $0xf015f8c5               // vunpckhps	%xmm0, %xmm0, %xmm6
+	LONG $0xe028f8c5               // vmovaps	%xmm0, %xmm4
+	LONG $0xf8c6f8c5; BYTE $0xff   // vshufps	$255, %xmm0, %xmm0, %xmm7
+	LONG $0xd8c6f8c5; BYTE $0x55   // vshufps	$85, %xmm0, %xmm0, %xmm3
+	WORD $0x2949; BYTE $0xc0       // subq	%rax, %r8
+	LONG $0xff788d49               // leaq	-1(%r8), %rdi
+	LONG $0x02ff8348               // cmpq	$2, %rdi
+	JBE  BB0_13
+	QUAD $0x000000c0249c8b48       // movq	192(%rsp), %rbx
+	LONG $0x303c8d48               // leaq	(%rax,%rsi), %rdi
+	LONG $0x1078c1c4; WORD $0xbe0c // vmovups	(%r14,%rdi,4), %xmm1
+	LONG $0x033c8d48               // leaq	(%rbx,%rax), %rdi
+	QUAD $0x000000d8249c8b48       // movq	216(%rsp), %rbx
+	WORD $0x0148; BYTE $0xf7       // addq	%rsi, %rdi
+	LONG $0x0459f0c5; BYTE $0xb9   // vmulps	(%rcx,%rdi,4), %xmm1, %xmm0
+	LONG $0x033c8d48               // leaq	(%rbx,%rax), %rdi
+	QUAD $0x000000d0249c8b48       // movq	208(%rsp), %rbx
+	WORD $0x0148; BYTE $0xf7       // addq	%rsi, %rdi
+	LONG $0xd458fac5               // vaddss	%xmm4, %xmm0, %xmm2
+	LONG $0x2459f0c5; BYTE $0xb9   // vmulps	(%rcx,%rdi,4), %xmm1, %xmm4
+	LONG $0x033c8d48               // leaq	(%rbx,%rax), %rdi
+	QUAD $0x000000b0249c8b48       // movq	176(%rsp), %rbx
+	WORD $0x0148; BYTE $0xf7       // addq	%rsi, %rdi
+	LONG $0xd8c678c5; BYTE $0x55   // vshufps	$85, %xmm0, %xmm0, %xmm11
+	LONG $0xd01578c5               // vunpckhps	%xmm0, %xmm0, %xmm10
+	LONG $0xc0c6f8c5; BYTE $0xff   // vshufps	$255, %xmm0, %xmm0, %xmm0
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	LONG $0xda5822c5               // vaddss	%xmm2, %xmm11, %xmm11
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0xd358dac5               // vaddss	%xmm3, %xmm4, %xmm2
+	LONG $0x1c59f0c5; BYTE $0xb9   // vmulps	(%rcx,%rdi,4), %xmm1, %xmm3
+	LONG $0xccc658c5; BYTE $0x55   // vshufps	$85, %xmm4, %xmm4, %xmm9
+	LONG $0xec15d8c5               // vunpckhps	%xmm4, %xmm4, %xmm5
+	LONG $0x0c59f0c5; BYTE $0x81   // vmulps	(%rcx,%rax,4), %xmm1, %xmm1
+	LONG $0x582a41c4; BYTE $0xd3   // vaddss	%xmm11, %xmm10, %xmm10
+	LONG $0xe4c6d8c5; BYTE $0xff   // vshufps	$255, %xmm4, %xmm4, %xmm4
+	WORD $0x894c; BYTE $0xc0       // movq	%r8, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	LONG $0xca5832c5               // vaddss	%xmm2, %xmm9, %xmm9
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x03e08341               // andl	$3, %r8d
+	LONG $0xc058aac5               // vaddss	%xmm0, %xmm10, %xmm0
+	LONG $0xd658e2c5               // vaddss	%xmm6, %xmm3, %xmm2
+	LONG $0xc3c660c5; BYTE $0x55   // vshufps	$85, %xmm3, %xmm3, %xmm8
+	LONG $0xf758f2c5               // vaddss	%xmm7, %xmm1, %xmm6
+	LONG $0xf9c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm7
+	LONG $0x5852c1c4; BYTE $0xe9   // vaddss	%xmm9, %xmm5, %xmm5
+	LONG $0xc2583ac5               // vaddss	%xmm2, %xmm8, %xmm8
+	LONG $0xd315e0c5               // vunpckhps	%xmm3, %xmm3, %xmm2
+	LONG $0xdbc6e0c5; BYTE $0xff   // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xfe58c2c5               // vaddss	%xmm6, %xmm7, %xmm7
+	LONG $0xf115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm6
+	LONG $0xe458d2c5               // vaddss	%xmm4, %xmm5, %xmm4
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0x586ac1c4; BYTE $0xd0   // vaddss	%xmm8, %xmm2, %xmm2
+	LONG $0xc414f8c5               // vunpcklps	%xmm4, %xmm0, %xmm0
+	LONG $0xd358eac5               // vaddss	%xmm3, %xmm2, %xmm2
+	LONG $0xdf58cac5               // vaddss	%xmm7, %xmm6, %xmm3
+	LONG $0xc958e2c5               // vaddss	%xmm1, %xmm3, %xmm1
+	LONG $0xd114e8c5               // vunpcklps	%xmm1, %xmm2, %xmm2
+	LONG $0xc216f8c5               // vmovlhps	%xmm2, %xmm0, %xmm0
+	JE   BB0_8
+
+BB0_13:
+	QUAD $0x000000d024bc8b48                   // movq	208(%rsp), %rdi
+	QUAD $0x000000b0248c8b4c                   // movq	176(%rsp), %r9
+	QUAD $0x00000000951c8d4c                   // leaq	0(,%rdx,4), %r11
+	QUAD $0x000000c0249c8b48                   // movq	192(%rsp), %rbx
+	QUAD $0x000000d824848b48                   // movq	216(%rsp), %rax
+	LONG $0x17048d4c                           // leaq	(%rdi,%rdx), %r8
+	WORD $0x894c; BYTE $0xcf                   // movq	%r9, %rdi
+	LONG $0x1879c2c4; WORD $0x961c             // vbroadcastss	(%r14,%rdx,4), %xmm3
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x13348d48                           // leaq	(%rbx,%rdx), %rsi
+	WORD $0x0148; BYTE $0xd7                   // addq	%rdx, %rdi
+	LONG $0x107aa1c4; WORD $0x8114             // vmovss	(%rcx,%r8,4), %xmm2
+	LONG $0x0c10fac5; BYTE $0xb1               // vmovss	(%rcx,%rsi,4), %xmm1
+	LONG $0x2169e3c4; WORD $0xb914; BYTE $0x10 // vinsertps	$0x10, (%rcx,%rdi,4), %xmm2, %xmm2
+	LONG $0x2171e3c4; WORD $0x810c; BYTE $0x10 // vinsertps	$0x10, (%rcx,%rax,4), %xmm1, %xmm1
+	LONG $0x01428d48                           // leaq	1(%rdx), %rax
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	LONG $0xb861e2c4; BYTE $0xc1               // vfmadd231ps	%xmm1, %xmm3, %xmm0
+	WORD $0x3949; BYTE $0xc7                   // cmpq	%rax, %r15
+	JLE  BB0_8
+	QUAD $0x000000d824b48b48                   // movq	216(%rsp), %rsi
+	LONG $0x033c8d48                           // leaq	(%rbx,%rax), %rdi
+	LONG $0x02c28348                           // addq	$2, %rdx
+	QUAD $0x000000d024848b4c                   // movq	208(%rsp), %r8
+	LONG $0x0c10fac5; BYTE $0xb9               // vmovss	(%rcx,%rdi,4), %xmm1
+	LONG $0x187982c4; WORD $0x1e5c; BYTE $0x04 // vbroadcastss	4(%r14,%r11), %xmm3
+	WORD $0x0148; BYTE $0xc6                   // addq	%rax, %rsi
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+	LONG $0x107aa1c4; WORD $0x8114             // vmovss	(%rcx,%r8,4), %xmm2
+	LONG $0x2171e3c4; WORD $0xb10c; BYTE $0x10 // vinsertps	$0x10, (%rcx,%rsi,4), %xmm1, %xmm1
+	LONG $0x2169e3c4; WORD $0x8114; BYTE $0x10 // vinsertps	$0x10, (%rcx,%rax,4), %xmm2, %xmm2
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	LONG $0xb861e2c4; BYTE $0xc1               // vfmadd231ps	%xmm1, %xmm3, %xmm0
+	WORD $0x394c; BYTE $0xfa                   // cmpq	%r15, %rdx
+	JGE  BB0_8
+	QUAD $0x000000d824848b48                   // movq	216(%rsp), %rax
+	QUAD $0x000000d024848b4c                   // movq	208(%rsp), %r8
+	LONG $0x1a348d48                           // leaq	(%rdx,%rbx), %rsi
+	LONG $0x0c10fac5; BYTE $0xb1               // vmovss	(%rcx,%rsi,4), %xmm1
+	LONG $0x187982c4; WORD $0x1e5c; BYTE $0x08 // vbroadcastss	8(%r14,%r11), %xmm3
+	LONG $0x023c8d48                           // leaq	(%rdx,%rax), %rdi
+	LONG $0x02048d4a                           // leaq	(%rdx,%r8), %rax
+	WORD $0x014c; BYTE $0xca                   // addq	%r9, %rdx
+	LONG $0x1410fac5; BYTE $0x81               // vmovss	(%rcx,%rax,4), %xmm2
+	LONG $0x2171e3c4; WORD $0xb90c; BYTE $0x10 // vinsertps	$0x10, (%rcx,%rdi,4), %xmm1, %xmm1
+	LONG $0x2169e3c4; WORD $0x9114; BYTE $0x10 // vinsertps	$0x10, (%rcx,%rdx,4), %xmm2, %xmm2
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	LONG $0xb861e2c4; BYTE $0xc1               // vfmadd231ps	%xmm1, %xmm3, %xmm0
+
+BB0_8:
+	QUAD $0x000000a024848b48     // movq	160(%rsp), %rax
+	QUAD $0x00000098249c8b48     // movq	152(%rsp), %rbx
+	LONG $0x24548b48; BYTE $0x78 // movq	120(%rsp), %rdx
+	QUAD $0x000000c0249c0148     // addq	%rbx, 192(%rsp)
+	QUAD $0x000000d8249c0148     // addq	%rbx, 216(%rsp)
+	LONG $0x10c08348             // addq	$16, %rax
+	LONG $0x4011f8c5; BYTE $0xf0 // vmovups	%xmm0, -16(%rax)
+	WORD $0x0149; BYTE $0xd2     // addq	%rdx, %r10
+	WORD $0x0149; BYTE $0xd4     // addq	%rdx, %r12
+	WORD $0x0149; BYTE $0xd5     // addq	%rdx, %r13
+	QUAD $0x000000d0249c0148     // addq	%rbx, 208(%rsp)
+	QUAD $0x000000b0249c0148     // addq	%rbx, 176(%rsp)
+	LONG $0x245c8b48; BYTE $0x70 // movq	112(%rsp), %rbx
+	QUAD $0x000000c824940148     // addq	%rdx, 200(%rsp)
+	QUAD $0x000000a024848948     // movq	%rax, 160(%rsp)
+	WORD $0x3948; BYTE $0xd8     // cmpq	%rbx, %rax
+	JNE  BB0_15
+	LONG $0x244c8b48; BYTE $0x58 // movq	88(%rsp), %rcx
+	QUAD $0x000000048d0c8d48     // leaq	4(,%rcx,4), %rcx
+
+BB0_5:
+	QUAD $0x0000008024848b48 // movq	128(%rsp), %rax
+	WORD $0x3948; BYTE $0xc8 // cmpq	%rcx, %rax
+	JLE  BB0_100
+	LONG $0x241c8b48         // movq	(%rsp), %rbx
+	QUAD $0x000000b824a48b4c // movq	184(%rsp), %r12
+	QUAD $0x00000000bd1c8d4e // leaq	0(,%r15,4), %r11
+	LONG $0x832c8d4c         // leaq	(%rbx,%rax,4), %r13
+	LONG $0xf8478d49         // leaq	-8(%r15), %rax
+	LONG $0x03e8c148         // shrq	$3, %rax
+	LONG $0x8b148d4c         // leaq	(%rbx,%rcx,4), %r10
+	LONG $0xcfaf0f49         // imulq	%r15, %rcx
+	QUAD $0x00000008c5048d48 // leaq	8(,%rax,8), %rax
+	QUAD $0x000000d024848948 // movq	%rax, 208(%rsp)
+	LONG $0x8c348d49         // leaq	(%r12,%rcx,4), %rsi
+
+BB0_26:
+	LONG $0x07ff8349             // cmpq	$7, %r15
+	JLE  BB0_56
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_18:
+	LONG $0x107cc1c4; WORD $0x867c; BYTE $0xe0 // vmovups	-32(%r14,%rax,4), %ymm7
+	LONG $0xb845e2c4; WORD $0x864c; BYTE $0xe0 // vfmadd231ps	-32(%rsi,%rax,4), %ymm7, %ymm1
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_18
+	QUAD $0x000000d024948b48                   // movq	208(%rsp), %rdx
+
+BB0_17:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_19
+	WORD $0x894c; BYTE $0xff       // movq	%r15, %rdi
+	QUAD $0x000000d824948948       // movq	%rdx, 216(%rsp)
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_57
+	WORD $0x8949; BYTE $0xf8       // movq	%rdi, %r8
+	LONG $0x11048d48               // leaq	(%rcx,%rdx), %rax
+	LONG $0x961c8d49               // leaq	(%r14,%rdx,4), %rbx
+	LONG $0x03e8c149               // shrq	$3, %r8
+	LONG $0x840c8d4d               // leaq	(%r12,%rax,4), %r9
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x05e0c149               // salq	$5, %r8
+
+BB0_21:
+	LONG $0x107cc1c4; WORD $0x013c // vmovups	(%r9,%rax), %ymm7
+	LONG $0x1459c4c5; BYTE $0x03   // vmulps	(%rbx,%rax), %ymm7, %ymm2
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xcac6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xc058f2c5               // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xca15e8c5               // vunpckhps	%xmm2, %xmm2, %xmm1
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xc2c6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xc058f2c5               // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc0       // cmpq	%r8, %rax
+	JNE  BB0_21
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x07c7f640               // testb	$7, %dil
+	JE   BB0_19
+
+BB0_20:
+	WORD $0x2948; BYTE $0xc7       // subq	%rax, %rdi
+	LONG $0xff478d4c               // leaq	-1(%rdi), %r8
+	LONG $0x02f88349               // cmpq	$2, %r8
+	JBE  BB0_24
+	QUAD $0x000000d8249c8b48       // movq	216(%rsp), %rbx
+	LONG $0x08048d4c               // leaq	(%rax,%rcx), %r8
+	WORD $0x0149; BYTE $0xd8       // addq	%rbx, %r8
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	LONG $0x1078c1c4; WORD $0x860c // vmovups	(%r14,%rax,4), %xmm1
+	LONG $0x597081c4; WORD $0x840c // vmulps	(%r12,%r8,4), %xmm1, %xmm1
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	WORD $0xe783; BYTE $0x03       // andl	$3, %edi
+	LONG $0xc058f2c5               // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_19
+
+BB0_24:
+	LONG $0x11048d48                           // leaq	(%rcx,%rdx), %rax
+	LONG $0x107ac1c4; WORD $0x963c             // vmovss	(%r14,%rdx,4), %xmm7
+	QUAD $0x00000000953c8d48                   // leaq	0(,%rdx,4), %rdi
+	LONG $0xb941c2c4; WORD $0x8404             // vfmadd231ss	(%r12,%rax,4), %xmm7, %xmm0
+	LONG $0x01428d48                           // leaq	1(%rdx), %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JGE  BB0_19
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x02c28348                           // addq	$2, %rdx
+	LONG $0x107ac1c4; WORD $0x3e7c; BYTE $0x04 // vmovss	4(%r14,%rdi), %xmm7
+	LONG $0xb941c2c4; WORD $0x8404             // vfmadd231ss	(%r12,%rax,4), %xmm7, %xmm0
+	WORD $0x394c; BYTE $0xfa                   // cmpq	%r15, %rdx
+	JGE  BB0_19
+	WORD $0x0148; BYTE $0xca                   // addq	%rcx, %rdx
+	LONG $0x107ac1c4; WORD $0x943c             // vmovss	(%r12,%rdx,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x3e44; BYTE $0x08 // vfmadd231ss	8(%r14,%rdi), %xmm7, %xmm0
+
+BB0_19:
+	LONG $0x117ac1c4; BYTE $0x02 // vmovss	%xmm0, (%r10)
+	LONG $0x04c28349             // addq	$4, %r10
+	WORD $0x014c; BYTE $0xf9     // addq	%r15, %rcx
+	WORD $0x014c; BYTE $0xde     // addq	%r11, %rsi
+	WORD $0x394d; BYTE $0xd5     // cmpq	%r10, %r13
+	JNE  BB0_26
+
+BB0_100:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x10a58d48; WORD $0xffff; BYTE $0xff // leaq	-240(%rbp), %rsp
+	RET
+
+BB0_54:
+	LONG $0xd257e8c5 // vxorps	%xmm2, %xmm2, %xmm2
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xca28fcc5 // vmovaps	%ymm2, %ymm1
+	LONG $0xda28fcc5 // vmovaps	%ymm2, %ymm3
+	LONG $0xe228fcc5 // vmovaps	%ymm2, %ymm4
+	JMP  BB0_6
+
+BB0_55:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_9
+
+BB0_103:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_4
+
+BB0_57:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_20
+
+BB0_56:
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	JMP  BB0_17
+
+BB0_53:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_5
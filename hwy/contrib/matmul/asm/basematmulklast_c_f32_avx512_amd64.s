@@ -0,0 +1,1562 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmulklast_c_f32_avx512_amd64.c
+
+TEXT ·matmulklast_c_f32_avx512(SB), $288-72
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ c+16(FP), DX
+	MOVQ pm+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_a+48(FP), R11
+	MOVQ R11, 256(SP)
+	MOVQ plen_b+56(FP), R11
+	MOVQ R11, 264(SP)
+	MOVQ plen_c+64(FP), R11
+	MOVQ R11, 272(SP)
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	QUAD $0x000000f024ac8d48                   // leaq	240(%rsp), %rbp
+	WORD $0x8949; BYTE $0xf5                   // movq	%rsi, %r13
+	LONG $0x24648d48; BYTE $0x40               // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348                           // andq	$-64, %rsp
+	WORD $0x8b48; BYTE $0x00                   // movq	(%rax), %rax
+	WORD $0x8b49; BYTE $0x18                   // movq	(%r8), %rbx
+	LONG $0x24148948                           // movq	%rdx, (%rsp)
+	WORD $0x8b49; BYTE $0x09                   // movq	(%r9), %rcx
+	LONG $0x24448948; BYTE $0x18               // movq	%rax, 24(%rsp)
+	LONG $0x245c8948; BYTE $0x68               // movq	%rbx, 104(%rsp)
+	LONG $0x01f88348                           // cmpq	$1, %rax
+	JE   BB0_2
+	LONG $0x03f88348                           // cmpq	$3, %rax
+	JLE  BB0_103
+	WORD $0x8948; BYTE $0xd8                   // movq	%rbx, %rax
+	LONG $0x09348d48                           // leaq	(%rcx,%rcx), %rsi
+	WORD $0x8949; BYTE $0xd3                   // movq	%rdx, %r11
+	LONG $0x246c894c; BYTE $0x38               // movq	%r13, 56(%rsp)
+	LONG $0x00348d4c                           // leaq	(%rax,%rax), %r14
+	QUAD $0x000000b024b48948                   // movq	%rsi, 176(%rsp)
+	LONG $0xf0518d48                           // leaq	-16(%rcx), %rdx
+	WORD $0x0148; BYTE $0xce                   // addq	%rcx, %rsi
+	LONG $0x060c8d4d                           // leaq	(%r14,%rax), %r9
+	LONG $0x04e0c148                           // salq	$4, %rax
+	QUAD $0x000000009d1c8d48                   // leaq	0(,%rbx,4), %rbx
+	LONG $0xf0e28348                           // andq	$-16, %rdx
+	LONG $0x24448948; BYTE $0x10               // movq	%rax, 16(%rsp)
+	WORD $0x894d; BYTE $0xf0                   // movq	%r14, %r8
+	QUAD $0x000000008d048d48                   // leaq	0(,%rcx,4), %rax
+	LONG $0x6ef9e1c4; BYTE $0xd3               // vmovq	%rbx, %xmm2
+	LONG $0x6ef9e1c4; BYTE $0xc8               // vmovq	%rax, %xmm1
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	QUAD $0x000000a824b48948                   // movq	%rsi, 168(%rsp)
+	WORD $0x8948; BYTE $0xfb                   // movq	%rdi, %rbx
+	LONG $0x04e0c148                           // salq	$4, %rax
+	WORD $0x894d; BYTE $0xcf                   // movq	%r9, %r15
+	LONG $0x7ef9e1c4; BYTE $0xce               // vmovq	%xmm1, %rsi
+	QUAD $0x000000b8248c8948                   // movq	%rcx, 184(%rsp)
+	LONG $0x24448948; BYTE $0x08               // movq	%rax, 8(%rsp)
+	LONG $0x7ef9e1c4; BYTE $0xc8               // vmovq	%xmm1, %rax
+	LONG $0x6ef9c1c4; BYTE $0xf1               // vmovq	%r9, %xmm6
+	LONG $0x08fde162; WORD $0xc16f             // vmovdqa64	%xmm1, %xmm16
+	LONG $0x07148d4c                           // leaq	(%rdi,%rax), %r10
+	QUAD $0x000000a0248c8948                   // movq	%rcx, 160(%rsp)
+	QUAD $0x000000982484c748; LONG $0x00000000 // movq	$0, 152(%rsp)
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+	QUAD $0x000003482444c748; BYTE $0x00       // movq	$3, 72(%rsp)
+	LONG $0x30248d4c                           // leaq	(%rax,%rsi), %r12
+	LONG $0x10728d48                           // leaq	16(%rdx), %rsi
+	WORD $0xd231                               // xorl	%edx, %edx
+	LONG $0x24748948; BYTE $0x50               // movq	%rsi, 80(%rsp)
+	LONG $0x7ef9e1c4; BYTE $0xd6               // vmovq	%xmm2, %rsi
+
+BB0_29:
+	LONG $0x24748b4c; BYTE $0x68   // movq	104(%rsp), %r14
+	LONG $0x320c8d4a               // leaq	(%rdx,%r14), %rcx
+	LONG $0x244c8948; BYTE $0x40   // movq	%rcx, 64(%rsp)
+	WORD $0x854d; BYTE $0xf6       // testq	%r14, %r14
+	JLE  BB0_40
+	LONG $0x1e0c8d4a               // leaq	(%rsi,%r11), %rcx
+	LONG $0x244c8b4c; BYTE $0x38   // movq	56(%rsp), %r9
+	WORD $0x894d; BYTE $0xde       // movq	%r11, %r14
+	WORD $0x3145; BYTE $0xed       // xorl	%r13d, %r13d
+	LONG $0x08fde162; WORD $0xc96e // vmovq	%rcx, %xmm17
+	WORD $0x894c; BYTE $0xc1       // movq	%r8, %rcx
+	LONG $0x2444894c; BYTE $0x30   // movq	%r8, 48(%rsp)
+	LONG $0x08fde162; WORD $0xd66e // vmovq	%rsi, %xmm18
+	WORD $0x2948; BYTE $0xd1       // subq	%rdx, %rcx
+	LONG $0x245c894c; BYTE $0x20   // movq	%r11, 32(%rsp)
+	LONG $0x244c8948; BYTE $0x60   // movq	%rcx, 96(%rsp)
+	WORD $0x894c; BYTE $0xf9       // movq	%r15, %rcx
+	WORD $0x2948; BYTE $0xd1       // subq	%rdx, %rcx
+	LONG $0x247c894c; BYTE $0x28   // movq	%r15, 40(%rsp)
+	WORD $0x894d; BYTE $0xcf       // movq	%r9, %r15
+	LONG $0x244c8948; BYTE $0x58   // movq	%rcx, 88(%rsp)
+	QUAD $0x000000a0248c8b48       // movq	160(%rsp), %rcx
+
+BB0_39:
+	LONG $0x0ff98348               // cmpq	$15, %rcx
+	JLE  BB0_58
+	LONG $0xff57c0c5               // vxorps	%xmm7, %xmm7, %xmm7
+	LONG $0x000010ba; BYTE $0x00   // movl	$16, %edx
+	LONG $0x487cf162; WORD $0xe728 // vmovaps	%zmm7, %zmm4
+	LONG $0x487cf162; WORD $0xd728 // vmovaps	%zmm7, %zmm2
+	LONG $0x487cf162; WORD $0xdf28 // vmovaps	%zmm7, %zmm3
+
+BB0_31:
+	QUAD $0xff914410487cd162       // vmovups	-64(%r9,%rdx,4), %zmm0
+	QUAD $0xff935cb8487df262       // vfmadd231ps	-64(%rbx,%rdx,4), %zmm0, %zmm3
+	QUAD $0xff9254b8487dd262       // vfmadd231ps	-64(%r10,%rdx,4), %zmm0, %zmm2
+	QUAD $0xff9064b8487df262       // vfmadd231ps	-64(%rax,%rdx,4), %zmm0, %zmm4
+	QUAD $0xff947cb8487dd262       // vfmadd231ps	-64(%r12,%rdx,4), %zmm0, %zmm7
+	LONG $0x10c28348               // addq	$16, %rdx
+	WORD $0x3948; BYTE $0xca       // cmpq	%rcx, %rdx
+	JLE  BB0_31
+	LONG $0x24448b4c; BYTE $0x50   // movq	80(%rsp), %r8
+	LONG $0x48fdf162; WORD $0xc428 // vmovapd	%zmm4, %zmm0
+
+BB0_30:
+	LONG $0x48fdf362; WORD $0xdc1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm3, %ymm4
+	LONG $0xdb58dcc5                           // vaddps	%ymm3, %ymm4, %ymm3
+	LONG $0x197de3c4; WORD $0x01dc             // vextractf128	$0x1, %ymm3, %xmm4
+	LONG $0xe358d8c5                           // vaddps	%xmm3, %xmm4, %xmm4
+	LONG $0x0479e3c4; WORD $0x4edc             // vpermilps	$78, %xmm4, %xmm3
+	LONG $0xdc58e0c5                           // vaddps	%xmm4, %xmm3, %xmm3
+	LONG $0xe328f8c5                           // vmovaps	%xmm3, %xmm4
+	LONG $0xdbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm3
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG $0x48fdf362; WORD $0xd31b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm3
+	LONG $0xd258e4c5                           // vaddps	%ymm2, %ymm3, %ymm2
+	LONG $0x197de3c4; WORD $0x01d3             // vextractf128	$0x1, %ymm2, %xmm3
+	LONG $0xda58e0c5                           // vaddps	%xmm2, %xmm3, %xmm3
+	LONG $0x0479e3c4; WORD $0x4ed3             // vpermilps	$78, %xmm3, %xmm2
+	LONG $0xd358e8c5                           // vaddps	%xmm3, %xmm2, %xmm2
+	LONG $0xda28f8c5                           // vmovaps	%xmm2, %xmm3
+	LONG $0xd2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm2
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0x48fdf362; WORD $0xc21b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm2
+	LONG $0xc058ecc5                           // vaddps	%ymm0, %ymm2, %ymm0
+	LONG $0x197de3c4; WORD $0x01c2             // vextractf128	$0x1, %ymm0, %xmm2
+	LONG $0xd058e8c5                           // vaddps	%xmm0, %xmm2, %xmm2
+	LONG $0x0479e3c4; WORD $0x4ec2             // vpermilps	$78, %xmm2, %xmm0
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0xd028f8c5                           // vmovaps	%xmm0, %xmm2
+	LONG $0xc0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm0
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x48fdf362; WORD $0xf81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm7, %ymm0
+	LONG $0xff58fcc5                           // vaddps	%ymm7, %ymm0, %ymm7
+	LONG $0x197de3c4; WORD $0x01f8             // vextractf128	$0x1, %ymm7, %xmm0
+	LONG $0xc758f8c5                           // vaddps	%xmm7, %xmm0, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ef8             // vpermilps	$78, %xmm0, %xmm7
+	LONG $0xf858c0c5                           // vaddps	%xmm0, %xmm7, %xmm7
+	LONG $0xc728f8c5                           // vmovaps	%xmm7, %xmm0
+	LONG $0xffc6c0c5; BYTE $0x55               // vshufps	$85, %xmm7, %xmm7, %xmm7
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_32
+	WORD $0x8948; BYTE $0xce                   // movq	%rcx, %rsi
+	QUAD $0x000000902484894c                   // movq	%r8, 144(%rsp)
+	WORD $0x294c; BYTE $0xc6                   // subq	%r8, %rsi
+	LONG $0xff568d48                           // leaq	-1(%rsi), %rdx
+	QUAD $0x000000a024b48948                   // movq	%rsi, 160(%rsp)
+	LONG $0x0efa8348                           // cmpq	$14, %rdx
+	JBE  BB0_59
+	QUAD $0x00000098249c8b4c                   // movq	152(%rsp), %r11
+	QUAD $0x00000080248c8948                   // movq	%rcx, 128(%rsp)
+	LONG $0x2444894c; BYTE $0x78               // movq	%r8, 120(%rsp)
+	LONG $0x18148d4b                           // leaq	(%r8,%r11), %rdx
+	LONG $0x247c894c; BYTE $0x70               // movq	%r15, 112(%rsp)
+	LONG $0x971c8d4c                           // leaq	(%rdi,%rdx,4), %r11
+	LONG $0x28148d4b                           // leaq	(%r8,%r13), %rdx
+	LONG $0x6ef941c4; BYTE $0xfb               // vmovq	%r11, %xmm15
+	QUAD $0x000000b8249c8b4c                   // movq	184(%rsp), %r11
+	LONG $0x97348d49                           // leaq	(%r15,%rdx,4), %rsi
+	WORD $0x894d; BYTE $0xe7                   // movq	%r12, %r15
+	WORD $0x8949; BYTE $0xc4                   // movq	%rax, %r12
+	LONG $0x7ef961c4; BYTE $0xf8               // vmovq	%xmm15, %rax
+	LONG $0x18148d4b                           // leaq	(%r8,%r11), %rdx
+	LONG $0x971c8d4c                           // leaq	(%rdi,%rdx,4), %r11
+	LONG $0x6ef941c4; BYTE $0xc3               // vmovq	%r11, %xmm8
+	QUAD $0x000000b0249c8b4c                   // movq	176(%rsp), %r11
+	LONG $0x18148d4b                           // leaq	(%r8,%r11), %rdx
+	LONG $0x971c8d4c                           // leaq	(%rdi,%rdx,4), %r11
+	LONG $0x6ef9c1c4; BYTE $0xeb               // vmovq	%r11, %xmm5
+	QUAD $0x000000a8249c8b4c                   // movq	168(%rsp), %r11
+	LONG $0x18148d4b                           // leaq	(%r8,%r11), %rdx
+	LONG $0x971c8d4c                           // leaq	(%rdi,%rdx,4), %r11
+	QUAD $0x000000a024948b48                   // movq	160(%rsp), %rdx
+	WORD $0x894d; BYTE $0xd8                   // movq	%r11, %r8
+	LONG $0x7ef941c4; BYTE $0xc3               // vmovq	%xmm8, %r11
+	LONG $0x04eac148                           // shrq	$4, %rdx
+	LONG $0x06e2c148                           // salq	$6, %rdx
+	QUAD $0x0000008824948948                   // movq	%rdx, 136(%rsp)
+	WORD $0xd231                               // xorl	%edx, %edx
+	QUAD $0x00000088248c8b48                   // movq	136(%rsp), %rcx
+	QUAD $0x0000008824bc8948                   // movq	%rdi, 136(%rsp)
+	LONG $0x7ef9e1c4; BYTE $0xef               // vmovq	%xmm5, %rdi
+
+BB0_34:
+	LONG $0x487c7162; WORD $0x1c10; BYTE $0x16 // vmovups	(%rsi,%rdx), %zmm11
+	LONG $0x48247162; WORD $0x2459; BYTE $0x10 // vmulps	(%rax,%rdx), %zmm11, %zmm12
+	LONG $0xc61841c4; WORD $0x55d4             // vshufps	$85, %xmm12, %xmm12, %xmm10
+	LONG $0xc61841c4; WORD $0xfff4             // vshufps	$255, %xmm12, %xmm12, %xmm14
+	LONG $0x281d5362; WORD $0xec03; BYTE $0x07 // valignd	$7, %ymm12, %ymm12, %ymm13
+	LONG $0x585ac1c4; BYTE $0xe4               // vaddss	%xmm12, %xmm4, %xmm4
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0x151841c4; BYTE $0xd4               // vunpckhps	%xmm12, %xmm12, %xmm10
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0x287d5362; WORD $0xe219; BYTE $0x01 // vextractf32x4	$1, %ymm12, %xmm10
+	LONG $0x585ac1c4; BYTE $0xe6               // vaddss	%xmm14, %xmm4, %xmm4
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0x281d5362; WORD $0xd403; BYTE $0x05 // valignd	$5, %ymm12, %ymm12, %ymm10
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0x281d5362; WORD $0xd403; BYTE $0x06 // valignd	$6, %ymm12, %ymm12, %ymm10
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0x487d5362; WORD $0xe21b; BYTE $0x01 // vextractf32x8	$0x1, %zmm12, %ymm10
+	LONG $0xc62841c4; WORD $0xffe2             // vshufps	$255, %xmm10, %xmm10, %xmm12
+	LONG $0x585ac1c4; BYTE $0xe5               // vaddss	%xmm13, %xmm4, %xmm4
+	LONG $0xc62841c4; WORD $0x55ea             // vshufps	$85, %xmm10, %xmm10, %xmm13
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0x585ac1c4; BYTE $0xe5               // vaddss	%xmm13, %xmm4, %xmm4
+	LONG $0x152841c4; BYTE $0xea               // vunpckhps	%xmm10, %xmm10, %xmm13
+	LONG $0x585ac1c4; BYTE $0xe5               // vaddss	%xmm13, %xmm4, %xmm4
+	LONG $0x585ac1c4; BYTE $0xe4               // vaddss	%xmm12, %xmm4, %xmm4
+	LONG $0x287d5362; WORD $0xd419; BYTE $0x01 // vextractf32x4	$1, %ymm10, %xmm12
+	LONG $0x585ac1c4; BYTE $0xe4               // vaddss	%xmm12, %xmm4, %xmm4
+	LONG $0x282d5362; WORD $0xe203; BYTE $0x05 // valignd	$5, %ymm10, %ymm10, %ymm12
+	LONG $0x585ac1c4; BYTE $0xe4               // vaddss	%xmm12, %xmm4, %xmm4
+	LONG $0x282d5362; WORD $0xe203; BYTE $0x06 // valignd	$6, %ymm10, %ymm10, %ymm12
+	LONG $0x282d5362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm10, %ymm10, %ymm10
+	LONG $0x585ac1c4; BYTE $0xe4               // vaddss	%xmm12, %xmm4, %xmm4
+	LONG $0x48245162; WORD $0x2459; BYTE $0x13 // vmulps	(%r11,%rdx), %zmm11, %zmm12
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0xc61841c4; WORD $0x55d4             // vshufps	$85, %xmm12, %xmm12, %xmm10
+	LONG $0xc61841c4; WORD $0xfff4             // vshufps	$255, %xmm12, %xmm12, %xmm14
+	LONG $0x281d5362; WORD $0xec03; BYTE $0x07 // valignd	$7, %ymm12, %ymm12, %ymm13
+	LONG $0x5862c1c4; BYTE $0xdc               // vaddss	%xmm12, %xmm3, %xmm3
+	LONG $0x5862c1c4; BYTE $0xda               // vaddss	%xmm10, %xmm3, %xmm3
+	LONG $0x151841c4; BYTE $0xd4               // vunpckhps	%xmm12, %xmm12, %xmm10
+	LONG $0x5862c1c4; BYTE $0xda               // vaddss	%xmm10, %xmm3, %xmm3
+	LONG $0x287d5362; WORD $0xe219; BYTE $0x01 // vextractf32x4	$1, %ymm12, %xmm10
+	LONG $0x5862c1c4; BYTE $0xde               // vaddss	%xmm14, %xmm3, %xmm3
+	LONG $0x5862c1c4; BYTE $0xda               // vaddss	%xmm10, %xmm3, %xmm3
+	LONG $0x281d5362; WORD $0xd403; BYTE $0x05 // valignd	$5, %ymm12, %ymm12, %ymm10
+	LONG $0x5862c1c4; BYTE $0xda               // vaddss	%xmm10, %xmm3, %xmm3
+	LONG $0x281d5362; WORD $0xd403; BYTE $0x06 // valignd	$6, %ymm12, %ymm12, %ymm10
+	LONG $0x5862c1c4; BYTE $0xda               // vaddss	%xmm10, %xmm3, %xmm3
+	LONG $0x487d5362; WORD $0xe21b; BYTE $0x01 // vextractf32x8	$0x1, %zmm12, %ymm10
+	LONG $0xc62841c4; WORD $0xffe2             // vshufps	$255, %xmm10, %xmm10, %xmm12
+	LONG $0x5862c1c4; BYTE $0xdd               // vaddss	%xmm13, %xmm3, %xmm3
+	LONG $0xc62841c4; WORD $0x55ea             // vshufps	$85, %xmm10, %xmm10, %xmm13
+	LONG $0x5862c1c4; BYTE $0xda               // vaddss	%xmm10, %xmm3, %xmm3
+	LONG $0x5862c1c4; BYTE $0xdd               // vaddss	%xmm13, %xmm3, %xmm3
+	LONG $0x152841c4; BYTE $0xea               // vunpckhps	%xmm10, %xmm10, %xmm13
+	LONG $0x5862c1c4; BYTE $0xdd               // vaddss	%xmm13, %xmm3, %xmm3
+	LONG $0x5862c1c4; BYTE $0xdc               // vaddss	%xmm12, %xmm3, %xmm3
+	LONG $0x287d5362; WORD $0xd419; BYTE $0x01 // vextractf32x4	$1, %ymm10, %xmm12
+	LONG $0x5862c1c4; BYTE $0xdc               // vaddss	%xmm12, %xmm3, %xmm3
+	LONG $0x282d5362; WORD $0xe203; BYTE $0x05 // valignd	$5, %ymm10, %ymm10, %ymm12
+	LONG $0x5862c1c4; BYTE $0xdc               // vaddss	%xmm12, %xmm3, %xmm3
+	LONG $0x282d5362; WORD $0xe203; BYTE $0x06 // valignd	$6, %ymm10, %ymm10, %ymm12
+	LONG $0x282d5362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm10, %ymm10, %ymm10
+	LONG $0x5862c1c4; BYTE $0xdc               // vaddss	%xmm12, %xmm3, %xmm3
+	LONG $0x48247162; WORD $0x2459; BYTE $0x17 // vmulps	(%rdi,%rdx), %zmm11, %zmm12
+	LONG $0x48245162; WORD $0x1c59; BYTE $0x10 // vmulps	(%r8,%rdx), %zmm11, %zmm11
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x5862c1c4; BYTE $0xda               // vaddss	%xmm10, %xmm3, %xmm3
+	LONG $0xc61841c4; WORD $0x55d4             // vshufps	$85, %xmm12, %xmm12, %xmm10
+	LONG $0xc61841c4; WORD $0xfff4             // vshufps	$255, %xmm12, %xmm12, %xmm14
+	LONG $0x281d5362; WORD $0xec03; BYTE $0x07 // valignd	$7, %ymm12, %ymm12, %ymm13
+	LONG $0x586ac1c4; BYTE $0xd4               // vaddss	%xmm12, %xmm2, %xmm2
+	LONG $0x587ac1c4; BYTE $0xc3               // vaddss	%xmm11, %xmm0, %xmm0
+	LONG $0x586ac1c4; BYTE $0xd2               // vaddss	%xmm10, %xmm2, %xmm2
+	LONG $0x151841c4; BYTE $0xd4               // vunpckhps	%xmm12, %xmm12, %xmm10
+	LONG $0x586ac1c4; BYTE $0xd2               // vaddss	%xmm10, %xmm2, %xmm2
+	LONG $0x287d5362; WORD $0xe219; BYTE $0x01 // vextractf32x4	$1, %ymm12, %xmm10
+	LONG $0x586ac1c4; BYTE $0xd6               // vaddss	%xmm14, %xmm2, %xmm2
+	LONG $0x586ac1c4; BYTE $0xd2               // vaddss	%xmm10, %xmm2, %xmm2
+	LONG $0x281d5362; WORD $0xd403; BYTE $0x05 // valignd	$5, %ymm12, %ymm12, %ymm10
+	LONG $0x586ac1c4; BYTE $0xd2               // vaddss	%xmm10, %xmm2, %xmm2
+	LONG $0x281d5362; WORD $0xd403; BYTE $0x06 // valignd	$6, %ymm12, %ymm12, %ymm10
+	LONG $0x586ac1c4; BYTE $0xd2               // vaddss	%xmm10, %xmm2, %xmm2
+	LONG $0x487d5362; WORD $0xe21b; BYTE $0x01 // vextractf32x8	$0x1, %zmm12, %ymm10
+	LONG $0xc62841c4; WORD $0xffe2             // vshufps	$255, %xmm10, %xmm10, %xmm12
+	LONG $0x586ac1c4; BYTE $0xd5               // vaddss	%xmm13, %xmm2, %xmm2
+	LONG $0xc62841c4; WORD $0x55ea             // vshufps	$85, %xmm10, %xmm10, %xmm13
+	LONG $0x586ac1c4; BYTE $0xd2               // vaddss	%xmm10, %xmm2, %xmm2
+	LONG $0x586ac1c4; BYTE $0xd5               // vaddss	%xmm13, %xmm2, %xmm2
+	LONG $0x152841c4; BYTE $0xea               // vunpckhps	%xmm10, %xmm10, %xmm13
+	LONG $0x586ac1c4; BYTE $0xd5               // vaddss	%xmm13, %xmm2, %xmm2
+	LONG $0xc62041c4; WORD $0x55eb             // vshufps	$85, %xmm11, %xmm11, %xmm13
+	LONG $0x587ac1c4; BYTE $0xc5               // vaddss	%xmm13, %xmm0, %xmm0
+	LONG $0x152041c4; BYTE $0xeb               // vunpckhps	%xmm11, %xmm11, %xmm13
+	LONG $0x586ac1c4; BYTE $0xd4               // vaddss	%xmm12, %xmm2, %xmm2
+	LONG $0x587ac1c4; BYTE $0xc5               // vaddss	%xmm13, %xmm0, %xmm0
+	LONG $0x287d5362; WORD $0xd419; BYTE $0x01 // vextractf32x4	$1, %ymm10, %xmm12
+	LONG $0x586ac1c4; BYTE $0xd4               // vaddss	%xmm12, %xmm2, %xmm2
+	LONG $0x282d5362; WORD $0xe203; BYTE $0x05 // valignd	$5, %ymm10, %ymm10, %ymm12
+	LONG $0x586ac1c4; BYTE $0xd4               // vaddss	%xmm12, %xmm2, %xmm2
+	LONG $0x282d5362; WORD $0xe203; BYTE $0x06 // valignd	$6, %ymm10, %ymm10, %ymm12
+	LONG $0x282d5362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm10, %ymm10, %ymm10
+	LONG $0x586ac1c4; BYTE $0xd4               // vaddss	%xmm12, %xmm2, %xmm2
+	LONG $0xc62041c4; WORD $0xffe3             // vshufps	$255, %xmm11, %xmm11, %xmm12
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0x287d5362; WORD $0xdc19; BYTE $0x01 // vextractf32x4	$1, %ymm11, %xmm12
+	LONG $0x586ac1c4; BYTE $0xd2               // vaddss	%xmm10, %xmm2, %xmm2
+	LONG $0x28255362; WORD $0xd303; BYTE $0x07 // valignd	$7, %ymm11, %ymm11, %ymm10
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0x28255362; WORD $0xe303; BYTE $0x05 // valignd	$5, %ymm11, %ymm11, %ymm12
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0x28255362; WORD $0xe303; BYTE $0x06 // valignd	$6, %ymm11, %ymm11, %ymm12
+	LONG $0x487d5362; WORD $0xdb1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm11, %ymm11
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0xc62041c4; WORD $0x55e3             // vshufps	$85, %xmm11, %xmm11, %xmm12
+	LONG $0x587ac1c4; BYTE $0xc2               // vaddss	%xmm10, %xmm0, %xmm0
+	LONG $0xc62041c4; WORD $0xffd3             // vshufps	$255, %xmm11, %xmm11, %xmm10
+	LONG $0x587ac1c4; BYTE $0xc3               // vaddss	%xmm11, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0x152041c4; BYTE $0xe3               // vunpckhps	%xmm11, %xmm11, %xmm12
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc2               // vaddss	%xmm10, %xmm0, %xmm0
+	LONG $0x287d5362; WORD $0xda19; BYTE $0x01 // vextractf32x4	$1, %ymm11, %xmm10
+	LONG $0x587ac1c4; BYTE $0xc2               // vaddss	%xmm10, %xmm0, %xmm0
+	LONG $0x28255362; WORD $0xd303; BYTE $0x05 // valignd	$5, %ymm11, %ymm11, %ymm10
+	LONG $0x587ac1c4; BYTE $0xc2               // vaddss	%xmm10, %xmm0, %xmm0
+	LONG $0x28255362; WORD $0xd303; BYTE $0x06 // valignd	$6, %ymm11, %ymm11, %ymm10
+	LONG $0x28255362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm11, %ymm11, %ymm11
+	LONG $0x587ac1c4; BYTE $0xc2               // vaddss	%xmm10, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc3               // vaddss	%xmm11, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JNE  BB0_34
+	QUAD $0x000000a024b48b48                   // movq	160(%rsp), %rsi
+	LONG $0x24448b4c; BYTE $0x78               // movq	120(%rsp), %r8
+	WORD $0x894c; BYTE $0xe0                   // movq	%r12, %rax
+	WORD $0x894d; BYTE $0xfc                   // movq	%r15, %r12
+	QUAD $0x00000080248c8b48                   // movq	128(%rsp), %rcx
+	QUAD $0x0000008824bc8b48                   // movq	136(%rsp), %rdi
+	WORD $0x8948; BYTE $0xf2                   // movq	%rsi, %rdx
+	LONG $0x247c8b4c; BYTE $0x70               // movq	112(%rsp), %r15
+	LONG $0xf0e28348                           // andq	$-16, %rdx
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	WORD $0xe683; BYTE $0x0f                   // andl	$15, %esi
+	JE   BB0_32
+
+BB0_33:
+	QUAD $0x000000a0249c8b4c                   // movq	160(%rsp), %r11
+	WORD $0x2949; BYTE $0xd3                   // subq	%rdx, %r11
+	LONG $0xff738d49                           // leaq	-1(%r11), %rsi
+	LONG $0x06fe8348                           // cmpq	$6, %rsi
+	JBE  BB0_37
+	QUAD $0x0000009024b48b48                   // movq	144(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6                   // addq	%rdx, %rsi
+	WORD $0x8948; BYTE $0xf2                   // movq	%rsi, %rdx
+	LONG $0x2e348d4a                           // leaq	(%rsi,%r13), %rsi
+	LONG $0x107c41c4; WORD $0xb704             // vmovups	(%r15,%rsi,4), %ymm8
+	QUAD $0x0000009824b48b48                   // movq	152(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6                   // addq	%rdx, %rsi
+	LONG $0x14593cc5; BYTE $0xb7               // vmulps	(%rdi,%rsi,4), %ymm8, %ymm10
+	QUAD $0x000000b824b48b48                   // movq	184(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6                   // addq	%rdx, %rsi
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0xc628c1c4; WORD $0x55fa             // vshufps	$85, %xmm10, %xmm10, %xmm7
+	LONG $0xc62841c4; WORD $0xffda             // vshufps	$255, %xmm10, %xmm10, %xmm11
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0x1528c1c4; BYTE $0xfa               // vunpckhps	%xmm10, %xmm10, %xmm7
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0x287d7362; WORD $0xd719; BYTE $0x01 // vextractf32x4	$1, %ymm10, %xmm7
+	LONG $0x585ac1c4; BYTE $0xe3               // vaddss	%xmm11, %xmm4, %xmm4
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0x282dd362; WORD $0xfa03; BYTE $0x05 // valignd	$5, %ymm10, %ymm10, %ymm7
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0x282dd362; WORD $0xfa03; BYTE $0x06 // valignd	$6, %ymm10, %ymm10, %ymm7
+	LONG $0x282d5362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm10, %ymm10, %ymm10
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0x14593cc5; BYTE $0xb7               // vmulps	(%rdi,%rsi,4), %ymm8, %ymm10
+	QUAD $0x000000b024b48b48                   // movq	176(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6                   // addq	%rdx, %rsi
+	LONG $0x5862c1c4; BYTE $0xda               // vaddss	%xmm10, %xmm3, %xmm3
+	LONG $0xc628c1c4; WORD $0x55fa             // vshufps	$85, %xmm10, %xmm10, %xmm7
+	LONG $0xc62841c4; WORD $0xffda             // vshufps	$255, %xmm10, %xmm10, %xmm11
+	LONG $0xdf58e2c5                           // vaddss	%xmm7, %xmm3, %xmm3
+	LONG $0x1528c1c4; BYTE $0xfa               // vunpckhps	%xmm10, %xmm10, %xmm7
+	LONG $0xdf58e2c5                           // vaddss	%xmm7, %xmm3, %xmm3
+	LONG $0x287d7362; WORD $0xd719; BYTE $0x01 // vextractf32x4	$1, %ymm10, %xmm7
+	LONG $0x5862c1c4; BYTE $0xdb               // vaddss	%xmm11, %xmm3, %xmm3
+	LONG $0xdf58e2c5                           // vaddss	%xmm7, %xmm3, %xmm3
+	LONG $0x282dd362; WORD $0xfa03; BYTE $0x05 // valignd	$5, %ymm10, %ymm10, %ymm7
+	LONG $0xdf58e2c5                           // vaddss	%xmm7, %xmm3, %xmm3
+	LONG $0x282dd362; WORD $0xfa03; BYTE $0x06 // valignd	$6, %ymm10, %ymm10, %ymm7
+	LONG $0x282d5362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm10, %ymm10, %ymm10
+	LONG $0xdf58e2c5                           // vaddss	%xmm7, %xmm3, %xmm3
+	LONG $0x5862c1c4; BYTE $0xda               // vaddss	%xmm10, %xmm3, %xmm3
+	LONG $0x14593cc5; BYTE $0xb7               // vmulps	(%rdi,%rsi,4), %ymm8, %ymm10
+	QUAD $0x000000a824b48b48                   // movq	168(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf2                   // addq	%rsi, %rdx
+	LONG $0x04593cc5; BYTE $0x97               // vmulps	(%rdi,%rdx,4), %ymm8, %ymm8
+	WORD $0x894c; BYTE $0xda                   // movq	%r11, %rdx
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	LONG $0x586ac1c4; BYTE $0xd2               // vaddss	%xmm10, %xmm2, %xmm2
+	LONG $0xc628c1c4; WORD $0x55fa             // vshufps	$85, %xmm10, %xmm10, %xmm7
+	LONG $0xc62841c4; WORD $0xffda             // vshufps	$255, %xmm10, %xmm10, %xmm11
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x07e38341                           // andl	$7, %r11d
+	LONG $0xd758eac5                           // vaddss	%xmm7, %xmm2, %xmm2
+	LONG $0x1528c1c4; BYTE $0xfa               // vunpckhps	%xmm10, %xmm10, %xmm7
+	LONG $0x587ac1c4; BYTE $0xc0               // vaddss	%xmm8, %xmm0, %xmm0
+	LONG $0xd758eac5                           // vaddss	%xmm7, %xmm2, %xmm2
+	LONG $0x287d7362; WORD $0xd719; BYTE $0x01 // vextractf32x4	$1, %ymm10, %xmm7
+	LONG $0x586ac1c4; BYTE $0xd3               // vaddss	%xmm11, %xmm2, %xmm2
+	LONG $0xd758eac5                           // vaddss	%xmm7, %xmm2, %xmm2
+	LONG $0x282dd362; WORD $0xfa03; BYTE $0x05 // valignd	$5, %ymm10, %ymm10, %ymm7
+	LONG $0xd758eac5                           // vaddss	%xmm7, %xmm2, %xmm2
+	LONG $0x282dd362; WORD $0xfa03; BYTE $0x06 // valignd	$6, %ymm10, %ymm10, %ymm7
+	LONG $0x282d5362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm10, %ymm10, %ymm10
+	LONG $0xd758eac5                           // vaddss	%xmm7, %xmm2, %xmm2
+	LONG $0xc638c1c4; WORD $0x55f8             // vshufps	$85, %xmm8, %xmm8, %xmm7
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0x1538c1c4; BYTE $0xf8               // vunpckhps	%xmm8, %xmm8, %xmm7
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0x586ac1c4; BYTE $0xd2               // vaddss	%xmm10, %xmm2, %xmm2
+	LONG $0xc63841c4; WORD $0xffd0             // vshufps	$255, %xmm8, %xmm8, %xmm10
+	LONG $0x287d7362; WORD $0xc719; BYTE $0x01 // vextractf32x4	$1, %ymm8, %xmm7
+	LONG $0x587ac1c4; BYTE $0xc2               // vaddss	%xmm10, %xmm0, %xmm0
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0x283dd362; WORD $0xf803; BYTE $0x05 // valignd	$5, %ymm8, %ymm8, %ymm7
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0x283dd362; WORD $0xf803; BYTE $0x06 // valignd	$6, %ymm8, %ymm8, %ymm7
+	LONG $0x283d5362; WORD $0xc003; BYTE $0x07 // valignd	$7, %ymm8, %ymm8, %ymm8
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc0               // vaddss	%xmm8, %xmm0, %xmm0
+	JE   BB0_32
+
+BB0_37:
+	QUAD $0x00000098249c8b4c       // movq	152(%rsp), %r11
+	LONG $0x05548d4b; BYTE $0x00   // leaq	0(%r13,%r8), %rdx
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	LONG $0x107ac1c4; WORD $0x970c // vmovss	(%r15,%rdx,4), %xmm1
+	LONG $0x03148d4b               // leaq	(%r11,%r8), %rdx
+	LONG $0xb971e2c4; WORD $0x9724 // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm4
+	LONG $0x06148d4a               // leaq	(%rsi,%r8), %rdx
+	LONG $0xb971e2c4; WORD $0x971c // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm3
+	QUAD $0x000000b024948b48       // movq	176(%rsp), %rdx
+	WORD $0x014c; BYTE $0xc2       // addq	%r8, %rdx
+	LONG $0xb971e2c4; WORD $0x9714 // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm2
+	QUAD $0x000000a824948b48       // movq	168(%rsp), %rdx
+	WORD $0x014c; BYTE $0xc2       // addq	%r8, %rdx
+	LONG $0xb971e2c4; WORD $0x9704 // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm0
+	LONG $0x01508d49               // leaq	1(%r8), %rdx
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_32
+	LONG $0x15748d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0xb70c // vmovss	(%r15,%rsi,4), %xmm1
+	LONG $0x13348d49               // leaq	(%r11,%rdx), %rsi
+	LONG $0xb971e2c4; WORD $0xb724 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm4
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	LONG $0xb971e2c4; WORD $0xb71c // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm3
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	LONG $0xb971e2c4; WORD $0xb714 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm2
+	QUAD $0x000000a824b48b48       // movq	168(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+	LONG $0xb971e2c4; WORD $0x9704 // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm0
+	LONG $0x02508d49               // leaq	2(%r8), %rdx
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_32
+	LONG $0x15748d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0xb70c // vmovss	(%r15,%rsi,4), %xmm1
+	LONG $0x13348d49               // leaq	(%r11,%rdx), %rsi
+	LONG $0xb971e2c4; WORD $0xb724 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm4
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	LONG $0xb971e2c4; WORD $0xb71c // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm3
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	LONG $0xb971e2c4; WORD $0xb714 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm2
+	QUAD $0x000000a824b48b48       // movq	168(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+	LONG $0xb971e2c4; WORD $0x9704 // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm0
+	LONG $0x03508d49               // leaq	3(%r8), %rdx
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_32
+	LONG $0x15748d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0xb70c // vmovss	(%r15,%rsi,4), %xmm1
+	LONG $0x13348d49               // leaq	(%r11,%rdx), %rsi
+	LONG $0xb971e2c4; WORD $0xb724 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm4
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	LONG $0xb971e2c4; WORD $0xb71c // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm3
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	LONG $0xb971e2c4; WORD $0xb714 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm2
+	QUAD $0x000000a824b48b48       // movq	168(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+	LONG $0xb971e2c4; WORD $0x9704 // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm0
+	LONG $0x04508d49               // leaq	4(%r8), %rdx
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_32
+	LONG $0x15748d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0xb70c // vmovss	(%r15,%rsi,4), %xmm1
+	LONG $0x13348d49               // leaq	(%r11,%rdx), %rsi
+	LONG $0xb971e2c4; WORD $0xb724 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm4
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	LONG $0xb971e2c4; WORD $0xb71c // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm3
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	LONG $0xb971e2c4; WORD $0xb714 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm2
+	QUAD $0x000000a824b48b48       // movq	168(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+	LONG $0xb971e2c4; WORD $0x9704 // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm0
+	LONG $0x05508d49               // leaq	5(%r8), %rdx
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_32
+	LONG $0x15748d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rsi
+	LONG $0x06c08349               // addq	$6, %r8
+	LONG $0x107ac1c4; WORD $0xb70c // vmovss	(%r15,%rsi,4), %xmm1
+	LONG $0x13348d49               // leaq	(%r11,%rdx), %rsi
+	LONG $0xb971e2c4; WORD $0xb724 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm4
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	LONG $0xb971e2c4; WORD $0xb71c // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm3
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	LONG $0xb971e2c4; WORD $0xb714 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm2
+	QUAD $0x000000a824b48b48       // movq	168(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+	LONG $0xb971e2c4; WORD $0x9704 // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm0
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_32
+	LONG $0x05548d4b; BYTE $0x00   // leaq	0(%r13,%r8), %rdx
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	LONG $0x107ac1c4; WORD $0x970c // vmovss	(%r15,%rdx,4), %xmm1
+	LONG $0x03148d4b               // leaq	(%r11,%r8), %rdx
+	LONG $0xb971e2c4; WORD $0x9724 // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm4
+	LONG $0x06148d4a               // leaq	(%rsi,%r8), %rdx
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	LONG $0xb971e2c4; WORD $0x971c // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm3
+	LONG $0x06148d4a               // leaq	(%rsi,%r8), %rdx
+	QUAD $0x000000a824b48b48       // movq	168(%rsp), %rsi
+	LONG $0xb971e2c4; WORD $0x9714 // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm2
+	WORD $0x0149; BYTE $0xf0       // addq	%rsi, %r8
+	LONG $0xb971a2c4; WORD $0x8704 // vfmadd231ss	(%rdi,%r8,4), %xmm1, %xmm0
+
+BB0_32:
+	LONG $0x24748b48; BYTE $0x68   // movq	104(%rsp), %rsi
+	LONG $0x117ac1c4; BYTE $0x26   // vmovss	%xmm4, (%r14)
+	WORD $0x0149; BYTE $0xcd       // addq	%rcx, %r13
+	LONG $0x117ac1c4; WORD $0xb61c // vmovss	%xmm3, (%r14,%rsi,4)
+	LONG $0x24748b48; BYTE $0x60   // movq	96(%rsp), %rsi
+	LONG $0x117ac1c4; WORD $0xb614 // vmovss	%xmm2, (%r14,%rsi,4)
+	LONG $0x24748b48; BYTE $0x58   // movq	88(%rsp), %rsi
+	LONG $0x117ac1c4; WORD $0xb604 // vmovss	%xmm0, (%r14,%rsi,4)
+	LONG $0x08fde162; WORD $0xc67e // vmovq	%xmm16, %rsi
+	LONG $0x04c68349               // addq	$4, %r14
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	LONG $0x08fde162; WORD $0xce7e // vmovq	%xmm17, %rsi
+	WORD $0x3949; BYTE $0xf6       // cmpq	%rsi, %r14
+	JNE  BB0_39
+	LONG $0x24448b4c; BYTE $0x30   // movq	48(%rsp), %r8
+	LONG $0x247c8b4c; BYTE $0x28   // movq	40(%rsp), %r15
+	QUAD $0x000000a0248c8948       // movq	%rcx, 160(%rsp)
+	LONG $0x08fde162; WORD $0xd67e // vmovq	%xmm18, %rsi
+	LONG $0x245c8b4c; BYTE $0x20   // movq	32(%rsp), %r11
+
+BB0_40:
+	LONG $0x24548b48; BYTE $0x40   // movq	64(%rsp), %rdx
+	LONG $0x24748b4c; BYTE $0x08   // movq	8(%rsp), %r14
+	WORD $0x0149; BYTE $0xf0       // addq	%rsi, %r8
+	WORD $0x0149; BYTE $0xf7       // addq	%rsi, %r15
+	LONG $0x7ef9e1c4; BYTE $0xf1   // vmovq	%xmm6, %rcx
+	LONG $0x24448348; WORD $0x0448 // addq	$4, 72(%rsp)
+	LONG $0x244c8b4c; BYTE $0x48   // movq	72(%rsp), %r9
+	WORD $0x0148; BYTE $0xca       // addq	%rcx, %rdx
+	LONG $0x244c8b48; BYTE $0x10   // movq	16(%rsp), %rcx
+	WORD $0x014c; BYTE $0xf3       // addq	%r14, %rbx
+	WORD $0x014d; BYTE $0xf2       // addq	%r14, %r10
+	WORD $0x014c; BYTE $0xf0       // addq	%r14, %rax
+	WORD $0x014d; BYTE $0xf4       // addq	%r14, %r12
+	WORD $0x0149; BYTE $0xcb       // addq	%rcx, %r11
+	LONG $0x08fde162; WORD $0xc17e // vmovq	%xmm16, %rcx
+	QUAD $0x00000098248c0148       // addq	%rcx, 152(%rsp)
+	QUAD $0x000000b8248c0148       // addq	%rcx, 184(%rsp)
+	QUAD $0x000000b0248c0148       // addq	%rcx, 176(%rsp)
+	QUAD $0x000000a8248c0148       // addq	%rcx, 168(%rsp)
+	LONG $0x244c394c; BYTE $0x18   // cmpq	%r9, 24(%rsp)
+	JG   BB0_29
+	LONG $0x24448b48; BYTE $0x18   // movq	24(%rsp), %rax
+	QUAD $0x000000a0248c8b48       // movq	160(%rsp), %rcx
+	LONG $0x246c8b4c; BYTE $0x38   // movq	56(%rsp), %r13
+	LONG $0x04e88348               // subq	$4, %rax
+	LONG $0x02e8c148               // shrq	$2, %rax
+	QUAD $0x0000000485048d48       // leaq	4(,%rax,4), %rax
+
+BB0_4:
+	LONG $0x24443948; BYTE $0x18 // cmpq	%rax, 24(%rsp)
+	JLE  BB0_100
+	LONG $0x245c8b48; BYTE $0x68 // movq	104(%rsp), %rbx
+	WORD $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE  BB0_100
+	WORD $0x8949; BYTE $0xda     // movq	%rbx, %r10
+	LONG $0xf0718d48             // leaq	-16(%rcx), %rsi
+	WORD $0x8949; BYTE $0xcb     // movq	%rcx, %r11
+	WORD $0x8949; BYTE $0xc6     // movq	%rax, %r14
+	LONG $0xd0af0f4c             // imulq	%rax, %r10
+	QUAD $0x000000009d148d48     // leaq	0(,%rbx,4), %rdx
+	LONG $0xf0e68348             // andq	$-16, %rsi
+	LONG $0xd8af0f4c             // imulq	%rax, %r11
+	LONG $0x6ef9e1c4; BYTE $0xfa // vmovq	%rdx, %xmm7
+	LONG $0x13048d4e             // leaq	(%rbx,%r10), %r8
+	LONG $0x241c8b48             // movq	(%rsp), %rbx
+	LONG $0x9f0c8d4e             // leaq	(%rdi,%r11,4), %r9
+	WORD $0x894c; BYTE $0xc0     // movq	%r8, %rax
+	LONG $0x831c8d4a             // leaq	(%rbx,%r8,4), %rbx
+	QUAD $0x000000b0249c8948     // movq	%rbx, 176(%rsp)
+	QUAD $0x000000008d1c8d48     // leaq	0(,%rcx,4), %rbx
+	LONG $0x6ef9e1c4; BYTE $0xd3 // vmovq	%rbx, %xmm2
+	LONG $0x105e8d48             // leaq	16(%rsi), %rbx
+	QUAD $0x000000a8249c8948     // movq	%rbx, 168(%rsp)
+	LONG $0xfa6f79c5             // vmovdqa	%xmm2, %xmm15
+
+BB0_52:
+	LONG $0x241c8b48         // movq	(%rsp), %rbx
+	QUAD $0x000000a024b4894c // movq	%r14, 160(%rsp)
+	WORD $0x894d; BYTE $0xe8 // movq	%r13, %r8
+	LONG $0xfd7f79c5         // vmovdqa	%xmm15, %xmm5
+	QUAD $0x0000009824848948 // movq	%rax, 152(%rsp)
+	LONG $0x93248d4e         // leaq	(%rbx,%r10,4), %r12
+	WORD $0xdb31             // xorl	%ebx, %ebx
+
+BB0_42:
+	LONG $0x0ff98348             // cmpq	$15, %rcx
+	JLE  BB0_60
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x000010b8; BYTE $0x00 // movl	$16, %eax
+
+BB0_44:
+	QUAD $0xff817410487cd162 // vmovups	-64(%r9,%rax,4), %zmm6
+	QUAD $0xff8044b8484dd262 // vfmadd231ps	-64(%r8,%rax,4), %zmm6, %zmm0
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x3948; BYTE $0xc8 // cmpq	%rcx, %rax
+	JLE  BB0_44
+	QUAD $0x000000a824b48b48 // movq	168(%rsp), %rsi
+
+BB0_43:
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f4c5                           // vaddps	%ymm0, %ymm1, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc128f8c5                           // vmovaps	%xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JLE  BB0_45
+	WORD $0x8949; BYTE $0xca                   // movq	%rcx, %r10
+	QUAD $0x000000b824b48948                   // movq	%rsi, 184(%rsp)
+	WORD $0x2949; BYTE $0xf2                   // subq	%rsi, %r10
+	LONG $0xff428d49                           // leaq	-1(%r10), %rax
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_61
+	LONG $0x1e048d4a                           // leaq	(%rsi,%r11), %rax
+	LONG $0x87348d4c                           // leaq	(%rdi,%rax,4), %r14
+	LONG $0x1e048d48                           // leaq	(%rsi,%rbx), %rax
+	LONG $0x857c8d4d; BYTE $0x00               // leaq	0(%r13,%rax,4), %r15
+	WORD $0x894c; BYTE $0xd0                   // movq	%r10, %rax
+	LONG $0x04e8c148                           // shrq	$4, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	WORD $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_47:
+	LONG $0x487cd162; WORD $0x3410; BYTE $0x06 // vmovups	(%r14,%rax), %zmm6
+	LONG $0x484cd162; WORD $0x1459; BYTE $0x07 // vmulps	(%r15,%rax), %zmm6, %zmm2
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0xcac6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xdac6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0x286df362; WORD $0xe203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm4
+	LONG $0xc058eac5                           // vaddss	%xmm0, %xmm2, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xca15e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x286df362; WORD $0xca03; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm1
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xd019; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x286df362; WORD $0xca03; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xd11b; BYTE $0x01 // vextractf32x8	$0x1, %zmm2, %ymm1
+	LONG $0xd9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm3
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xe1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm4
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xe115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm4
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xcb19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm3
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JNE  BB0_47
+	WORD $0x894c; BYTE $0xd0                   // movq	%r10, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc6                   // addq	%rax, %rsi
+	LONG $0x0fc2f641                           // testb	$15, %r10b
+	JE   BB0_45
+
+BB0_46:
+	WORD $0x2949; BYTE $0xc2                   // subq	%rax, %r10
+	LONG $0xff528d49                           // leaq	-1(%r10), %rdx
+	LONG $0x06fa8348                           // cmpq	$6, %rdx
+	JBE  BB0_50
+	QUAD $0x000000b824948b48                   // movq	184(%rsp), %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x18348d4e                           // leaq	(%rax,%r11), %r14
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x107cc1c4; WORD $0x854c; BYTE $0x00 // vmovups	0(%r13,%rax,4), %ymm1
+	LONG $0x5974a1c4; WORD $0xb70c             // vmulps	(%rdi,%r14,4), %ymm1, %ymm1
+	WORD $0x894c; BYTE $0xd0                   // movq	%r10, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc6                   // addq	%rax, %rsi
+	LONG $0x07e28341                           // andl	$7, %r10d
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xe1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm4
+	LONG $0xd9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm3
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xe115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm4
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xcb19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm3
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_45
+
+BB0_50:
+	LONG $0x33048d48                           // leaq	(%rbx,%rsi), %rax
+	LONG $0x33148d4d                           // leaq	(%r11,%rsi), %r10
+	LONG $0x107aa1c4; WORD $0x9734             // vmovss	(%rdi,%r10,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8544; BYTE $0x00 // vfmadd231ss	0(%r13,%rax,4), %xmm6, %xmm0
+	LONG $0x01468d48                           // leaq	1(%rsi), %rax
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_45
+	LONG $0x03148d4d                           // leaq	(%r11,%rax), %r10
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x107aa1c4; WORD $0x9734             // vmovss	(%rdi,%r10,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8544; BYTE $0x00 // vfmadd231ss	0(%r13,%rax,4), %xmm6, %xmm0
+	LONG $0x02468d48                           // leaq	2(%rsi), %rax
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_45
+	LONG $0x03148d4d                           // leaq	(%r11,%rax), %r10
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x107aa1c4; WORD $0x9734             // vmovss	(%rdi,%r10,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8544; BYTE $0x00 // vfmadd231ss	0(%r13,%rax,4), %xmm6, %xmm0
+	LONG $0x03468d48                           // leaq	3(%rsi), %rax
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_45
+	LONG $0x03148d4d                           // leaq	(%r11,%rax), %r10
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x107aa1c4; WORD $0x9734             // vmovss	(%rdi,%r10,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8544; BYTE $0x00 // vfmadd231ss	0(%r13,%rax,4), %xmm6, %xmm0
+	LONG $0x04468d48                           // leaq	4(%rsi), %rax
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_45
+	LONG $0x03148d4d                           // leaq	(%r11,%rax), %r10
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x107aa1c4; WORD $0x9734             // vmovss	(%rdi,%r10,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8544; BYTE $0x00 // vfmadd231ss	0(%r13,%rax,4), %xmm6, %xmm0
+	LONG $0x05468d48                           // leaq	5(%rsi), %rax
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_45
+	LONG $0x03148d4d                           // leaq	(%r11,%rax), %r10
+	LONG $0x06c68348                           // addq	$6, %rsi
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x107aa1c4; WORD $0x9734             // vmovss	(%rdi,%r10,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8544; BYTE $0x00 // vfmadd231ss	0(%r13,%rax,4), %xmm6, %xmm0
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JLE  BB0_45
+	LONG $0x33048d49                           // leaq	(%r11,%rsi), %rax
+	WORD $0x0148; BYTE $0xde                   // addq	%rbx, %rsi
+	LONG $0x3410fac5; BYTE $0x87               // vmovss	(%rdi,%rax,4), %xmm6
+	LONG $0xb949c2c4; WORD $0xb544; BYTE $0x00 // vfmadd231ss	0(%r13,%rsi,4), %xmm6, %xmm0
+
+BB0_45:
+	LONG $0x7ef9e1c4; BYTE $0xe8   // vmovq	%xmm5, %rax
+	LONG $0x117ac1c4; WORD $0x2404 // vmovss	%xmm0, (%r12)
+	LONG $0x04c48349               // addq	$4, %r12
+	WORD $0x0148; BYTE $0xcb       // addq	%rcx, %rbx
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	QUAD $0x000000b024848b48       // movq	176(%rsp), %rax
+	WORD $0x3949; BYTE $0xc4       // cmpq	%rax, %r12
+	JNE  BB0_42
+	LONG $0x7ef961c4; BYTE $0xfb   // vmovq	%xmm15, %rbx
+	LONG $0x7ef9e1c4; BYTE $0xfe   // vmovq	%xmm7, %rsi
+	WORD $0x0149; BYTE $0xcb       // addq	%rcx, %r11
+	QUAD $0x000000a024b48b4c       // movq	160(%rsp), %r14
+	QUAD $0x0000009824848b48       // movq	152(%rsp), %rax
+	QUAD $0x000000b024b40148       // addq	%rsi, 176(%rsp)
+	WORD $0x0149; BYTE $0xd9       // addq	%rbx, %r9
+	LONG $0x01c68349               // addq	$1, %r14
+	WORD $0x8949; BYTE $0xc2       // movq	%rax, %r10
+	LONG $0x2474394c; BYTE $0x18   // cmpq	%r14, 24(%rsp)
+	JE   BB0_100
+	LONG $0x245c8b48; BYTE $0x68   // movq	104(%rsp), %rbx
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	JMP  BB0_52
+
+BB0_58:
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	WORD $0x3145; BYTE $0xc0       // xorl	%r8d, %r8d
+	LONG $0x48fdf162; WORD $0xd328 // vmovapd	%zmm3, %zmm2
+	LONG $0x48fdf162; WORD $0xc328 // vmovapd	%zmm3, %zmm0
+	LONG $0x48fdf162; WORD $0xfb28 // vmovapd	%zmm3, %zmm7
+	JMP  BB0_30
+
+BB0_59:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_33
+
+BB0_60:
+	LONG $0xc057f9c5 // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0xf631     // xorl	%esi, %esi
+	JMP  BB0_43
+
+BB0_61:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_46
+
+BB0_2:
+	WORD $0x8948; BYTE $0xd8                   // movq	%rbx, %rax
+	LONG $0x03fb8348                           // cmpq	$3, %rbx
+	JLE  BB0_53
+	LONG $0x04e88348                           // subq	$4, %rax
+	QUAD $0x000000008d1c8d48                   // leaq	0(,%rcx,4), %rbx
+	WORD $0x8949; BYTE $0xf2                   // movq	%rsi, %r10
+	QUAD $0x0000009824948948                   // movq	%rdx, 152(%rsp)
+	LONG $0x02e8c148                           // shrq	$2, %rax
+	LONG $0x6ef961c4; BYTE $0xfb               // vmovq	%rbx, %xmm15
+	WORD $0x8948; BYTE $0xcb                   // movq	%rcx, %rbx
+	QUAD $0x000000b82484c748; LONG $0x00000000 // movq	$0, 184(%rsp)
+	WORD $0x8949; BYTE $0xc3                   // movq	%rax, %r11
+	LONG $0x04e0c148                           // salq	$4, %rax
+	LONG $0x7ef941c4; BYTE $0xff               // vmovq	%xmm15, %r15
+	LONG $0x04e3c148                           // salq	$4, %rbx
+	LONG $0x02448d48; BYTE $0x10               // leaq	16(%rdx,%rax), %rax
+	LONG $0x245c894c; BYTE $0x60               // movq	%r11, 96(%rsp)
+	QUAD $0x00000088249c8948                   // movq	%rbx, 136(%rsp)
+	LONG $0x08fde162; WORD $0xc06e             // vmovq	%rax, %xmm16
+	LONG $0x7ef961c4; BYTE $0xfb               // vmovq	%xmm15, %rbx
+	LONG $0xf0418d48                           // leaq	-16(%rcx), %rax
+	LONG $0x1e048d4c                           // leaq	(%rsi,%rbx), %r8
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	LONG $0x7ef961c4; BYTE $0xfe               // vmovq	%xmm15, %rsi
+	WORD $0x014c; BYTE $0xc6                   // addq	%r8, %rsi
+	LONG $0x10c08348                           // addq	$16, %rax
+	LONG $0x091c8d48                           // leaq	(%rcx,%rcx), %rbx
+	QUAD $0x0000009024848948                   // movq	%rax, 144(%rsp)
+	LONG $0x3e0c8d4e                           // leaq	(%rsi,%r15), %r9
+	LONG $0x0b348d4c                           // leaq	(%rbx,%rcx), %r14
+	WORD $0x8949; BYTE $0xcf                   // movq	%rcx, %r15
+	QUAD $0x000000b024b48948                   // movq	%rsi, 176(%rsp)
+
+BB0_15:
+	LONG $0x0ff98348               // cmpq	$15, %rcx
+	JLE  BB0_54
+	LONG $0xe457d8c5               // vxorps	%xmm4, %xmm4, %xmm4
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	LONG $0x000010b8; BYTE $0x00   // movl	$16, %eax
+	LONG $0x487cf162; WORD $0xcc28 // vmovaps	%zmm4, %zmm1
+	LONG $0x487cf162; WORD $0xd428 // vmovaps	%zmm4, %zmm2
+	LONG $0x487cf162; WORD $0xdc28 // vmovaps	%zmm4, %zmm3
+
+BB0_7:
+	QUAD $0xff874410487cf162 // vmovups	-64(%rdi,%rax,4), %zmm0
+	QUAD $0xff825cb8487dd262 // vfmadd231ps	-64(%r10,%rax,4), %zmm0, %zmm3
+	QUAD $0xff8054b8487dd262 // vfmadd231ps	-64(%r8,%rax,4), %zmm0, %zmm2
+	QUAD $0xff864cb8487df262 // vfmadd231ps	-64(%rsi,%rax,4), %zmm0, %zmm1
+	QUAD $0xff8164b8487dd262 // vfmadd231ps	-64(%r9,%rax,4), %zmm0, %zmm4
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x3948; BYTE $0xc8 // cmpq	%rcx, %rax
+	JLE  BB0_7
+	QUAD $0x000000b024b48948 // movq	%rsi, 176(%rsp)
+	QUAD $0x0000009024848b48 // movq	144(%rsp), %rax
+
+BB0_6:
+	LONG $0x48fdf362; WORD $0xd81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm3, %ymm0
+	LONG $0xc358fcc5                           // vaddps	%ymm3, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c3             // vextractf128	$0x1, %ymm0, %xmm3
+	LONG $0xc058e0c5                           // vaddps	%xmm0, %xmm3, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ee8             // vpermilps	$78, %xmm0, %xmm5
+	LONG $0xe858d0c5                           // vaddps	%xmm0, %xmm5, %xmm5
+	LONG $0x48fdf362; WORD $0xd01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm0
+	LONG $0xc258fcc5                           // vaddps	%ymm2, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c2             // vextractf128	$0x1, %ymm0, %xmm2
+	LONG $0xc058e8c5                           // vaddps	%xmm0, %xmm2, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ed8             // vpermilps	$78, %xmm0, %xmm3
+	LONG $0xd858e0c5                           // vaddps	%xmm0, %xmm3, %xmm3
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc158fcc5                           // vaddps	%ymm1, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ed0             // vpermilps	$78, %xmm0, %xmm2
+	LONG $0xd058e8c5                           // vaddps	%xmm0, %xmm2, %xmm2
+	LONG $0x48fdf362; WORD $0xe01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm0
+	LONG $0xc058dcc5                           // vaddps	%ymm0, %ymm4, %ymm0
+	LONG $0xe328f8c5                           // vmovaps	%xmm3, %xmm4
+	LONG $0xdbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm3
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG $0xda28f8c5                           // vmovaps	%xmm2, %xmm3
+	LONG $0xd2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc528f8c5                           // vmovaps	%xmm5, %xmm0
+	LONG $0xedc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xd128f8c5                           // vmovaps	%xmm1, %xmm2
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc958eac5                           // vaddss	%xmm1, %xmm2, %xmm1
+	LONG $0xc414f8c5                           // vunpcklps	%xmm4, %xmm0, %xmm0
+	LONG $0xc914e0c5                           // vunpcklps	%xmm1, %xmm3, %xmm1
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_8
+	WORD $0x8949; BYTE $0xcb                   // movq	%rcx, %r11
+	QUAD $0x000000a024848948                   // movq	%rax, 160(%rsp)
+	WORD $0x2949; BYTE $0xc3                   // subq	%rax, %r11
+	LONG $0xff538d49                           // leaq	-1(%r11), %rdx
+	QUAD $0x000000a8249c894c                   // movq	%r11, 168(%rsp)
+	LONG $0x0efa8348                           // cmpq	$14, %rdx
+	JBE  BB0_55
+	QUAD $0x000000b824948b48                   // movq	184(%rsp), %rdx
+	LONG $0x87248d4c                           // leaq	(%rdi,%rax,4), %r12
+	LONG $0x04ebc149                           // shrq	$4, %r11
+	QUAD $0x00000080248c8948                   // movq	%rcx, 128(%rsp)
+	LONG $0x24448948; BYTE $0x78               // movq	%rax, 120(%rsp)
+	LONG $0x06e3c149                           // salq	$6, %r11
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x247c8948; BYTE $0x70               // movq	%rdi, 112(%rsp)
+	WORD $0x894c; BYTE $0xe7                   // movq	%r12, %rdi
+	LONG $0x95548d49; BYTE $0x00               // leaq	0(%r13,%rdx,4), %rdx
+	LONG $0x6ef961c4; BYTE $0xea               // vmovq	%rdx, %xmm13
+	LONG $0x38148d4a                           // leaq	(%rax,%r15), %rdx
+	LONG $0x95548d49; BYTE $0x00               // leaq	0(%r13,%rdx,4), %rdx
+	LONG $0x7ef961c4; BYTE $0xee               // vmovq	%xmm13, %rsi
+	LONG $0x6ef961c4; BYTE $0xe2               // vmovq	%rdx, %xmm12
+	LONG $0x03148d48                           // leaq	(%rbx,%rax), %rdx
+	LONG $0x95548d49; BYTE $0x00               // leaq	0(%r13,%rdx,4), %rdx
+	LONG $0x7ef961c4; BYTE $0xe1               // vmovq	%xmm12, %rcx
+	LONG $0x6ef961c4; BYTE $0xda               // vmovq	%rdx, %xmm11
+	LONG $0x30148d4a                           // leaq	(%rax,%r14), %rdx
+	LONG $0x95548d49; BYTE $0x00               // leaq	0(%r13,%rdx,4), %rdx
+	LONG $0x7ef961c4; BYTE $0xd8               // vmovq	%xmm11, %rax
+	LONG $0x6ef961c4; BYTE $0xd2               // vmovq	%rdx, %xmm10
+	WORD $0xd231                               // xorl	%edx, %edx
+	LONG $0x7ef941c4; BYTE $0xd4               // vmovq	%xmm10, %r12
+
+BB0_10:
+	LONG $0x487cf162; WORD $0x1410; BYTE $0x17 // vmovups	(%rdi,%rdx), %zmm2
+	LONG $0x486cf162; WORD $0x1c59; BYTE $0x16 // vmulps	(%rsi,%rdx), %zmm2, %zmm3
+	LONG $0x486cf162; WORD $0x3459; BYTE $0x11 // vmulps	(%rcx,%rdx), %zmm2, %zmm6
+	LONG $0x486cf162; WORD $0x2459; BYTE $0x10 // vmulps	(%rax,%rdx), %zmm2, %zmm4
+	LONG $0x486cd162; WORD $0x1459; BYTE $0x14 // vmulps	(%r12,%rdx), %zmm2, %zmm2
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x0864e162; WORD $0xdbc6; BYTE $0xff // vshufps	$255, %xmm3, %xmm3, %xmm19
+	LONG $0x2865f362; WORD $0xeb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm5
+	LONG $0xf6c648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm14
+	LONG $0xce14e0c5                           // vunpcklps	%xmm6, %xmm3, %xmm1
+	LONG $0x084ce162; WORD $0xd6c6; BYTE $0xff // vshufps	$255, %xmm6, %xmm6, %xmm18
+	LONG $0x284d7362; WORD $0xc603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm8
+	LONG $0x086ce162; WORD $0xf2c6; BYTE $0x55 // vshufps	$85, %xmm2, %xmm2, %xmm22
+	LONG $0xca1458c5                           // vunpcklps	%xmm2, %xmm4, %xmm9
+	LONG $0x086ce162; WORD $0xe2c6; BYTE $0xff // vshufps	$255, %xmm2, %xmm2, %xmm20
+	LONG $0x286de362; WORD $0xca03; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm17
+	LONG $0x1670c1c4; BYTE $0xc9               // vmovlhps	%xmm9, %xmm1, %xmm1
+	LONG $0xcbc660c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm9
+	LONG $0x143041c4; BYTE $0xce               // vunpcklps	%xmm14, %xmm9, %xmm9
+	LONG $0x285df362; WORD $0xfc03; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm7
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0xccc6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm1
+	LONG $0xf61548c5                           // vunpckhps	%xmm6, %xmm6, %xmm14
+	LONG $0x0874b162; WORD $0xce14             // vunpcklps	%xmm22, %xmm1, %xmm1
+	LONG $0x086ce162; WORD $0xf215             // vunpckhps	%xmm2, %xmm2, %xmm22
+	LONG $0xc91630c5                           // vmovlhps	%xmm1, %xmm9, %xmm9
+	LONG $0xcc15d8c5                           // vunpckhps	%xmm4, %xmm4, %xmm1
+	LONG $0x5878c1c4; BYTE $0xc1               // vaddps	%xmm9, %xmm0, %xmm0
+	LONG $0xcb1560c5                           // vunpckhps	%xmm3, %xmm3, %xmm9
+	LONG $0x0874b162; WORD $0xce14             // vunpcklps	%xmm22, %xmm1, %xmm1
+	LONG $0x143041c4; BYTE $0xce               // vunpcklps	%xmm14, %xmm9, %xmm9
+	LONG $0x1450c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0x287dd362; WORD $0xf619; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm14
+	LONG $0xc91630c5                           // vmovlhps	%xmm1, %xmm9, %xmm9
+	LONG $0xccc6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm1
+	LONG $0x0874b162; WORD $0xcc14             // vunpcklps	%xmm20, %xmm1, %xmm1
+	LONG $0x587841c4; BYTE $0xc9               // vaddps	%xmm9, %xmm0, %xmm9
+	LONG $0x0064b162; WORD $0xc214             // vunpcklps	%xmm18, %xmm19, %xmm0
+	LONG $0x0844b162; WORD $0xf914             // vunpcklps	%xmm17, %xmm7, %xmm7
+	LONG $0x287db362; WORD $0xd219; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm18
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	LONG $0xef16d0c5                           // vmovlhps	%xmm7, %xmm5, %xmm5
+	LONG $0x287df362; WORD $0xd919; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm1
+	LONG $0xc058b0c5                           // vaddps	%xmm0, %xmm9, %xmm0
+	LONG $0x287dd362; WORD $0xe119; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm9
+	LONG $0x1470c1c4; BYTE $0xce               // vunpcklps	%xmm14, %xmm1, %xmm1
+	LONG $0x284d7362; WORD $0xf603; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm14
+	LONG $0x08343162; WORD $0xca14             // vunpcklps	%xmm18, %xmm9, %xmm9
+	LONG $0x286de362; WORD $0xd203; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm18
+	LONG $0x1670c1c4; BYTE $0xc9               // vmovlhps	%xmm9, %xmm1, %xmm1
+	LONG $0x285d7362; WORD $0xcc03; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm9
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xcb03; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm1
+	LONG $0x08343162; WORD $0xca14             // vunpcklps	%xmm18, %xmm9, %xmm9
+	LONG $0x286de362; WORD $0xd203; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm18
+	LONG $0x1470c1c4; BYTE $0xce               // vunpcklps	%xmm14, %xmm1, %xmm1
+	LONG $0x487df362; WORD $0xd21b; BYTE $0x01 // vextractf32x8	$0x1, %zmm2, %ymm2
+	LONG $0x284d7362; WORD $0xf603; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm14
+	LONG $0x1670c1c4; BYTE $0xc9               // vmovlhps	%xmm9, %xmm1, %xmm1
+	LONG $0x487df362; WORD $0xf61b; BYTE $0x01 // vextractf32x8	$0x1, %zmm6, %ymm6
+	LONG $0x086ce162; WORD $0xcac6; BYTE $0xff // vshufps	$255, %xmm2, %xmm2, %xmm17
+	LONG $0x285d7362; WORD $0xcc03; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm9
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xe41b; BYTE $0x01 // vextractf32x8	$0x1, %zmm4, %ymm4
+	LONG $0x2865f362; WORD $0xcb03; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm1
+	LONG $0x487df362; WORD $0xdb1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm3, %ymm3
+	LONG $0xc21458c5                           // vunpcklps	%xmm2, %xmm4, %xmm8
+	LONG $0xfe14e0c5                           // vunpcklps	%xmm6, %xmm3, %xmm7
+	LONG $0x1640c1c4; BYTE $0xf8               // vmovlhps	%xmm8, %xmm7, %xmm7
+	LONG $0xc4c658c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm8
+	LONG $0x08343162; WORD $0xca14             // vunpcklps	%xmm18, %xmm9, %xmm9
+	LONG $0x086ce162; WORD $0xd2c6; BYTE $0x55 // vshufps	$85, %xmm2, %xmm2, %xmm18
+	LONG $0x083c3162; WORD $0xc214             // vunpcklps	%xmm18, %xmm8, %xmm8
+	LONG $0x086ce162; WORD $0xd215             // vunpckhps	%xmm2, %xmm2, %xmm18
+	LONG $0x1470c1c4; BYTE $0xce               // vunpcklps	%xmm14, %xmm1, %xmm1
+	LONG $0xf6c648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm14
+	LONG $0x1670c1c4; BYTE $0xc9               // vmovlhps	%xmm9, %xmm1, %xmm1
+	LONG $0xcec648c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm9
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xcbc6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm1
+	LONG $0x1470c1c4; BYTE $0xc9               // vunpcklps	%xmm9, %xmm1, %xmm1
+	LONG $0xc558f8c5                           // vaddps	%xmm5, %xmm0, %xmm0
+	LONG $0xecc6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm5
+	LONG $0x0854b162; WORD $0xe914             // vunpcklps	%xmm17, %xmm5, %xmm5
+	LONG $0xcd16f0c5                           // vmovlhps	%xmm5, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xe519; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm5
+	LONG $0xc758f8c5                           // vaddps	%xmm7, %xmm0, %xmm0
+	LONG $0xfbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm7
+	LONG $0x1440c1c4; BYTE $0xfe               // vunpcklps	%xmm14, %xmm7, %xmm7
+	LONG $0xf61548c5                           // vunpckhps	%xmm6, %xmm6, %xmm14
+	LONG $0x1640c1c4; BYTE $0xf8               // vmovlhps	%xmm8, %xmm7, %xmm7
+	LONG $0xc41558c5                           // vunpckhps	%xmm4, %xmm4, %xmm8
+	LONG $0x083c3162; WORD $0xc214             // vunpcklps	%xmm18, %xmm8, %xmm8
+	LONG $0xc758f8c5                           // vaddps	%xmm7, %xmm0, %xmm0
+	LONG $0xfb15e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm7
+	LONG $0x1440c1c4; BYTE $0xfe               // vunpcklps	%xmm14, %xmm7, %xmm7
+	LONG $0x1640c1c4; BYTE $0xf8               // vmovlhps	%xmm8, %xmm7, %xmm7
+	LONG $0x287dd362; WORD $0xd019; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm8
+	LONG $0xc758f8c5                           // vaddps	%xmm7, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xf719; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm7
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xd919; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm1
+	LONG $0x1450c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0x286d7362; WORD $0xc203; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm8
+	LONG $0xcf14f0c5                           // vunpcklps	%xmm7, %xmm1, %xmm1
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm7
+	LONG $0xcd16f0c5                           // vmovlhps	%xmm5, %xmm1, %xmm1
+	LONG $0x285df362; WORD $0xec03; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm5
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xcb03; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm1
+	LONG $0x1450c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0x286d7362; WORD $0xc203; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm8
+	LONG $0xcf14f0c5                           // vunpcklps	%xmm7, %xmm1, %xmm1
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm7
+	LONG $0xcd16f0c5                           // vmovlhps	%xmm5, %xmm1, %xmm1
+	LONG $0x285df362; WORD $0xec03; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm5
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xcb03; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm1
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0x2865f362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm3
+	LONG $0x285df362; WORD $0xe403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm4
+	LONG $0x286df362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm2
+	LONG $0x1450c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0xcf14f0c5                           // vunpcklps	%xmm7, %xmm1, %xmm1
+	LONG $0xcd16f0c5                           // vmovlhps	%xmm5, %xmm1, %xmm1
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xde14e0c5                           // vunpcklps	%xmm6, %xmm3, %xmm3
+	LONG $0xd214d8c5                           // vunpcklps	%xmm2, %xmm4, %xmm2
+	LONG $0xda16e0c5                           // vmovlhps	%xmm2, %xmm3, %xmm3
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xda                   // cmpq	%r11, %rdx
+	JNE  BB0_10
+	QUAD $0x000000a8249c8b4c                   // movq	168(%rsp), %r11
+	LONG $0x24448b48; BYTE $0x78               // movq	120(%rsp), %rax
+	QUAD $0x00000080248c8b48                   // movq	128(%rsp), %rcx
+	LONG $0x247c8b48; BYTE $0x70               // movq	112(%rsp), %rdi
+	WORD $0x894c; BYTE $0xda                   // movq	%r11, %rdx
+	LONG $0xf0e28348                           // andq	$-16, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x0fe38341                           // andl	$15, %r11d
+	JE   BB0_8
+
+BB0_9:
+	QUAD $0x000000a824a48b4c                   // movq	168(%rsp), %r12
+	WORD $0x2949; BYTE $0xd4                   // subq	%rdx, %r12
+	LONG $0x245c8d4d; BYTE $0xff               // leaq	-1(%r12), %r11
+	QUAD $0x000000a824a4894c                   // movq	%r12, 168(%rsp)
+	LONG $0x06fb8349                           // cmpq	$6, %r11
+	JBE  BB0_13
+	QUAD $0x000000a024b48b48                   // movq	160(%rsp), %rsi
+	QUAD $0x000000b824a48b4c                   // movq	184(%rsp), %r12
+	WORD $0x8949; BYTE $0xf3                   // movq	%rsi, %r11
+	WORD $0x0149; BYTE $0xd3                   // addq	%rdx, %r11
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	WORD $0x014d; BYTE $0xdc                   // addq	%r11, %r12
+	LONG $0x107ca1c4; WORD $0x9f24             // vmovups	(%rdi,%r11,4), %ymm4
+	WORD $0x0148; BYTE $0xf2                   // addq	%rsi, %rdx
+	LONG $0x595c81c4; WORD $0xa56c; BYTE $0x00 // vmulps	0(%r13,%r12,4), %ymm4, %ymm5
+	LONG $0x3b248d4f                           // leaq	(%r11,%r15), %r12
+	WORD $0x014d; BYTE $0xf3                   // addq	%r14, %r11
+	LONG $0x595c81c4; WORD $0xa57c; BYTE $0x00 // vmulps	0(%r13,%r12,4), %ymm4, %ymm7
+	QUAD $0x000000a824a48b4c                   // movq	168(%rsp), %r12
+	LONG $0x595cc1c4; WORD $0x9574; BYTE $0x00 // vmulps	0(%r13,%rdx,4), %ymm4, %ymm6
+	LONG $0x595c81c4; WORD $0x9d64; BYTE $0x00 // vmulps	0(%r13,%r11,4), %ymm4, %ymm4
+	WORD $0x894c; BYTE $0xe2                   // movq	%r12, %rdx
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	LONG $0xd5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm2
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x07e48341                           // andl	$7, %r12d
+	LONG $0xcf14d0c5                           // vunpcklps	%xmm7, %xmm5, %xmm1
+	LONG $0xdfc640c5; BYTE $0x55               // vshufps	$85, %xmm7, %xmm7, %xmm11
+	LONG $0xc7c640c5; BYTE $0xff               // vshufps	$255, %xmm7, %xmm7, %xmm8
+	LONG $0x1468c1c4; BYTE $0xd0               // vunpcklps	%xmm8, %xmm2, %xmm2
+	LONG $0xdec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm3
+	LONG $0xe4c658c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm12
+	LONG $0xd41448c5                           // vunpcklps	%xmm4, %xmm6, %xmm10
+	LONG $0xccc658c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm9
+	LONG $0x1460c1c4; BYTE $0xd9               // vunpcklps	%xmm9, %xmm3, %xmm3
+	LONG $0x287dd362; WORD $0xe019; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm8
+	LONG $0x1670c1c4; BYTE $0xca               // vmovlhps	%xmm10, %xmm1, %xmm1
+	LONG $0xd6c648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm10
+	LONG $0x142841c4; BYTE $0xd4               // vunpcklps	%xmm12, %xmm10, %xmm10
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0xe41558c5                           // vunpckhps	%xmm4, %xmm4, %xmm12
+	LONG $0xcdc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm1
+	LONG $0x1470c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0x1670c1c4; BYTE $0xca               // vmovlhps	%xmm10, %xmm1, %xmm1
+	LONG $0xdf1540c5                           // vunpckhps	%xmm7, %xmm7, %xmm11
+	LONG $0xd61548c5                           // vunpckhps	%xmm6, %xmm6, %xmm10
+	LONG $0x142841c4; BYTE $0xd4               // vunpcklps	%xmm12, %xmm10, %xmm10
+	LONG $0xd316e8c5                           // vmovlhps	%xmm3, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xfb19; BYTE $0x01 // vextractf32x4	$1, %ymm7, %xmm3
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xcd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm1
+	LONG $0x1470c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0x1670c1c4; BYTE $0xca               // vmovlhps	%xmm10, %xmm1, %xmm1
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xe919; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm1
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xf219; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm2
+	LONG $0xcb14f0c5                           // vunpcklps	%xmm3, %xmm1, %xmm1
+	LONG $0x2845f362; WORD $0xdf03; BYTE $0x05 // valignd	$5, %ymm7, %ymm7, %ymm3
+	LONG $0x1468c1c4; BYTE $0xd0               // vunpcklps	%xmm8, %xmm2, %xmm2
+	LONG $0x285d7362; WORD $0xc403; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm8
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	LONG $0x284df362; WORD $0xd603; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm2
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x2855f362; WORD $0xcd03; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm1
+	LONG $0x1468c1c4; BYTE $0xd0               // vunpcklps	%xmm8, %xmm2, %xmm2
+	LONG $0x285d7362; WORD $0xc403; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm8
+	LONG $0xcb14f0c5                           // vunpcklps	%xmm3, %xmm1, %xmm1
+	LONG $0x2845f362; WORD $0xdf03; BYTE $0x06 // valignd	$6, %ymm7, %ymm7, %ymm3
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	LONG $0x284df362; WORD $0xd603; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm2
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x2855f362; WORD $0xcd03; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm1
+	LONG $0x2845f362; WORD $0xff03; BYTE $0x07 // valignd	$7, %ymm7, %ymm7, %ymm7
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0x285df362; WORD $0xe403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm4
+	LONG $0x1468c1c4; BYTE $0xd0               // vunpcklps	%xmm8, %xmm2, %xmm2
+	LONG $0xcb14f0c5                           // vunpcklps	%xmm3, %xmm1, %xmm1
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xcf14d0c5                           // vunpcklps	%xmm7, %xmm5, %xmm1
+	LONG $0xe414c8c5                           // vunpcklps	%xmm4, %xmm6, %xmm4
+	LONG $0xcc16f0c5                           // vmovlhps	%xmm4, %xmm1, %xmm1
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	JE   BB0_8
+
+BB0_13:
+	LONG $0x03348d48                           // leaq	(%rbx,%rax), %rsi
+	QUAD $0x000000b824a48b4c                   // movq	184(%rsp), %r12
+	QUAD $0x00000000851c8d4c                   // leaq	0(,%rax,4), %r11
+	LONG $0x6ef9e1c4; BYTE $0xd6               // vmovq	%rsi, %xmm2
+	LONG $0x06348d49                           // leaq	(%r14,%rax), %rsi
+	LONG $0x04148d49                           // leaq	(%r12,%rax), %rdx
+	LONG $0x6ef9e1c4; BYTE $0xde               // vmovq	%rsi, %xmm3
+	LONG $0x7ef9e1c4; BYTE $0xd6               // vmovq	%xmm2, %rsi
+	LONG $0x6ef9e1c4; BYTE $0xca               // vmovq	%rdx, %xmm1
+	LONG $0x107ac1c4; WORD $0xb554; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm2
+	LONG $0x7ef9e1c4; BYTE $0xde               // vmovq	%xmm3, %rsi
+	LONG $0x07148d49                           // leaq	(%r15,%rax), %rdx
+	QUAD $0x1000b5542169c3c4                   // vinsertps	$0x10, 0(%r13,%rsi,4), %xmm2, %xmm2
+	LONG $0x7ef9e1c4; BYTE $0xce               // vmovq	%xmm1, %rsi
+	LONG $0x107ac1c4; WORD $0xb54c; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm1
+	QUAD $0x1000954c2171c3c4                   // vinsertps	$0x10, 0(%r13,%rdx,4), %xmm1, %xmm1
+	LONG $0x01508d48                           // leaq	1(%rax), %rdx
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	LONG $0x1875f262; WORD $0x04b8; BYTE $0x87 // vfmadd231ps	(%rdi,%rax,4){1to4}, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JGE  BB0_8
+	LONG $0x22348d4a                           // leaq	(%rdx,%r12), %rsi
+	LONG $0x6ef9e1c4; BYTE $0xce               // vmovq	%rsi, %xmm1
+	LONG $0x3a348d4a                           // leaq	(%rdx,%r15), %rsi
+	LONG $0x6ef9e1c4; BYTE $0xde               // vmovq	%rsi, %xmm3
+	LONG $0x1a348d48                           // leaq	(%rdx,%rbx), %rsi
+	WORD $0x014c; BYTE $0xf2                   // addq	%r14, %rdx
+	LONG $0x107ac1c4; WORD $0xb554; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm2
+	LONG $0x7ef9e1c4; BYTE $0xce               // vmovq	%xmm1, %rsi
+	QUAD $0x100095542169c3c4                   // vinsertps	$0x10, 0(%r13,%rdx,4), %xmm2, %xmm2
+	LONG $0x02508d48                           // leaq	2(%rax), %rdx
+	LONG $0x107ac1c4; WORD $0xb54c; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm1
+	LONG $0x7ef9e1c4; BYTE $0xde               // vmovq	%xmm3, %rsi
+	QUAD $0x1000b54c2171c3c4                   // vinsertps	$0x10, 0(%r13,%rsi,4), %xmm1, %xmm1
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	QUAD $0x011f44b81875b262                   // vfmadd231ps	4(%rdi,%r11){1to4}, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JGE  BB0_8
+	LONG $0x22348d4a                           // leaq	(%rdx,%r12), %rsi
+	LONG $0x6ef9e1c4; BYTE $0xce               // vmovq	%rsi, %xmm1
+	LONG $0x3a348d4a                           // leaq	(%rdx,%r15), %rsi
+	LONG $0x6ef9e1c4; BYTE $0xde               // vmovq	%rsi, %xmm3
+	LONG $0x1a348d48                           // leaq	(%rdx,%rbx), %rsi
+	WORD $0x014c; BYTE $0xf2                   // addq	%r14, %rdx
+	LONG $0x107ac1c4; WORD $0xb554; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm2
+	LONG $0x7ef9e1c4; BYTE $0xce               // vmovq	%xmm1, %rsi
+	QUAD $0x100095542169c3c4                   // vinsertps	$0x10, 0(%r13,%rdx,4), %xmm2, %xmm2
+	LONG $0x03508d48                           // leaq	3(%rax), %rdx
+	LONG $0x107ac1c4; WORD $0xb54c; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm1
+	LONG $0x7ef9e1c4; BYTE $0xde               // vmovq	%xmm3, %rsi
+	QUAD $0x1000b54c2171c3c4                   // vinsertps	$0x10, 0(%r13,%rsi,4), %xmm1, %xmm1
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	QUAD $0x021f44b81875b262                   // vfmadd231ps	8(%rdi,%r11){1to4}, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_8
+	LONG $0x14348d49                           // leaq	(%r12,%rdx), %rsi
+	LONG $0x6ef9e1c4; BYTE $0xce               // vmovq	%rsi, %xmm1
+	LONG $0x17348d49                           // leaq	(%r15,%rdx), %rsi
+	LONG $0x6ef9e1c4; BYTE $0xde               // vmovq	%rsi, %xmm3
+	LONG $0x13348d48                           // leaq	(%rbx,%rdx), %rsi
+	WORD $0x014c; BYTE $0xf2                   // addq	%r14, %rdx
+	LONG $0x107ac1c4; WORD $0xb554; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm2
+	LONG $0x7ef9e1c4; BYTE $0xce               // vmovq	%xmm1, %rsi
+	QUAD $0x100095542169c3c4                   // vinsertps	$0x10, 0(%r13,%rdx,4), %xmm2, %xmm2
+	LONG $0x04508d48                           // leaq	4(%rax), %rdx
+	LONG $0x107ac1c4; WORD $0xb54c; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm1
+	LONG $0x7ef9e1c4; BYTE $0xde               // vmovq	%xmm3, %rsi
+	QUAD $0x1000b54c2171c3c4                   // vinsertps	$0x10, 0(%r13,%rsi,4), %xmm1, %xmm1
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	QUAD $0x031f44b81875b262                   // vfmadd231ps	12(%rdi,%r11){1to4}, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_8
+	LONG $0x14348d49                           // leaq	(%r12,%rdx), %rsi
+	LONG $0x6ef9e1c4; BYTE $0xce               // vmovq	%rsi, %xmm1
+	LONG $0x17348d49                           // leaq	(%r15,%rdx), %rsi
+	LONG $0x6ef9e1c4; BYTE $0xde               // vmovq	%rsi, %xmm3
+	LONG $0x13348d48                           // leaq	(%rbx,%rdx), %rsi
+	WORD $0x014c; BYTE $0xf2                   // addq	%r14, %rdx
+	LONG $0x107ac1c4; WORD $0xb554; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm2
+	LONG $0x7ef9e1c4; BYTE $0xce               // vmovq	%xmm1, %rsi
+	QUAD $0x100095542169c3c4                   // vinsertps	$0x10, 0(%r13,%rdx,4), %xmm2, %xmm2
+	LONG $0x05508d48                           // leaq	5(%rax), %rdx
+	LONG $0x107ac1c4; WORD $0xb54c; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm1
+	LONG $0x7ef9e1c4; BYTE $0xde               // vmovq	%xmm3, %rsi
+	QUAD $0x1000b54c2171c3c4                   // vinsertps	$0x10, 0(%r13,%rsi,4), %xmm1, %xmm1
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	QUAD $0x041f44b81875b262                   // vfmadd231ps	16(%rdi,%r11){1to4}, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_8
+	LONG $0x14348d49                           // leaq	(%r12,%rdx), %rsi
+	LONG $0x06c08348                           // addq	$6, %rax
+	LONG $0x6ef9e1c4; BYTE $0xce               // vmovq	%rsi, %xmm1
+	LONG $0x17348d49                           // leaq	(%r15,%rdx), %rsi
+	LONG $0x6ef9e1c4; BYTE $0xde               // vmovq	%rsi, %xmm3
+	LONG $0x13348d48                           // leaq	(%rbx,%rdx), %rsi
+	WORD $0x014c; BYTE $0xf2                   // addq	%r14, %rdx
+	LONG $0x107ac1c4; WORD $0xb554; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm2
+	LONG $0x7ef9e1c4; BYTE $0xce               // vmovq	%xmm1, %rsi
+	QUAD $0x100095542169c3c4                   // vinsertps	$0x10, 0(%r13,%rdx,4), %xmm2, %xmm2
+	LONG $0x107ac1c4; WORD $0xb54c; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm1
+	LONG $0x7ef9e1c4; BYTE $0xde               // vmovq	%xmm3, %rsi
+	QUAD $0x1000b54c2171c3c4                   // vinsertps	$0x10, 0(%r13,%rsi,4), %xmm1, %xmm1
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	QUAD $0x051f44b81875b262                   // vfmadd231ps	20(%rdi,%r11){1to4}, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_8
+	LONG $0x04348d49                           // leaq	(%r12,%rax), %rsi
+	LONG $0x07148d49                           // leaq	(%r15,%rax), %rdx
+	LONG $0x6ef9e1c4; BYTE $0xce               // vmovq	%rsi, %xmm1
+	LONG $0x03348d48                           // leaq	(%rbx,%rax), %rsi
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x107ac1c4; WORD $0xb554; BYTE $0x00 // vmovss	0(%r13,%rsi,4), %xmm2
+	QUAD $0x100085542169c3c4                   // vinsertps	$0x10, 0(%r13,%rax,4), %xmm2, %xmm2
+	LONG $0x7ef9e1c4; BYTE $0xc8               // vmovq	%xmm1, %rax
+	LONG $0x107ac1c4; WORD $0x854c; BYTE $0x00 // vmovss	0(%r13,%rax,4), %xmm1
+	QUAD $0x1000954c2171c3c4                   // vinsertps	$0x10, 0(%r13,%rdx,4), %xmm1, %xmm1
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	QUAD $0x061f44b81875b262                   // vfmadd231ps	24(%rdi,%r11){1to4}, %xmm1, %xmm0
+
+BB0_8:
+	QUAD $0x0000008824948b48       // movq	136(%rsp), %rdx
+	QUAD $0x0000009824848b48       // movq	152(%rsp), %rax
+	LONG $0x7ef941c4; BYTE $0xfb   // vmovq	%xmm15, %r11
+	QUAD $0x000000b024940148       // addq	%rdx, 176(%rsp)
+	WORD $0x014d; BYTE $0xdf       // addq	%r11, %r15
+	WORD $0x014c; BYTE $0xdb       // addq	%r11, %rbx
+	WORD $0x014d; BYTE $0xde       // addq	%r11, %r14
+	LONG $0x0011f8c5               // vmovups	%xmm0, (%rax)
+	WORD $0x0149; BYTE $0xd2       // addq	%rdx, %r10
+	LONG $0x10c08348               // addq	$16, %rax
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	WORD $0x0149; BYTE $0xd1       // addq	%rdx, %r9
+	LONG $0x08fde162; WORD $0xc27e // vmovq	%xmm16, %rdx
+	QUAD $0x000000b8249c014c       // addq	%r11, 184(%rsp)
+	QUAD $0x0000009824848948       // movq	%rax, 152(%rsp)
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JNE  BB0_15
+	LONG $0x245c8b4c; BYTE $0x60   // movq	96(%rsp), %r11
+	QUAD $0x000000049d348d4a       // leaq	4(,%r11,4), %rsi
+
+BB0_5:
+	LONG $0x24448b48; BYTE $0x68 // movq	104(%rsp), %rax
+	WORD $0x3948; BYTE $0xf0     // cmpq	%rsi, %rax
+	JLE  BB0_100
+	LONG $0x241c8b48             // movq	(%rsp), %rbx
+	QUAD $0x000000008d148d48     // leaq	0(,%rcx,4), %rdx
+	LONG $0x6ef9e1c4; BYTE $0xe2 // vmovq	%rdx, %xmm4
+	LONG $0xb30c8d4c             // leaq	(%rbx,%rsi,4), %r9
+	LONG $0x831c8d48             // leaq	(%rbx,%rax,4), %rbx
+	LONG $0xec6ff9c5             // vmovdqa	%xmm4, %xmm5
+	LONG $0xf1af0f48             // imulq	%rcx, %rsi
+	LONG $0xf0418d48             // leaq	-16(%rcx), %rax
+	LONG $0xf0e08348             // andq	$-16, %rax
+	LONG $0x10c08348             // addq	$16, %rax
+	QUAD $0x000000b824848948     // movq	%rax, 184(%rsp)
+	LONG $0xb5448d4d; BYTE $0x00 // leaq	0(%r13,%rsi,4), %r8
+
+BB0_26:
+	LONG $0x0ff98348             // cmpq	$15, %rcx
+	JLE  BB0_56
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x000010b8; BYTE $0x00 // movl	$16, %eax
+
+BB0_18:
+	QUAD $0xff877410487cf162 // vmovups	-64(%rdi,%rax,4), %zmm6
+	QUAD $0xff8044b8484dd262 // vfmadd231ps	-64(%r8,%rax,4), %zmm6, %zmm0
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x3948; BYTE $0xc8 // cmpq	%rcx, %rax
+	JLE  BB0_18
+	QUAD $0x000000b824948b48 // movq	184(%rsp), %rdx
+
+BB0_17:
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f4c5                           // vaddps	%ymm0, %ymm1, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc128f8c5                           // vmovaps	%xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_19
+	WORD $0x8949; BYTE $0xcf                   // movq	%rcx, %r15
+	WORD $0x8949; BYTE $0xd4                   // movq	%rdx, %r12
+	WORD $0x2949; BYTE $0xd7                   // subq	%rdx, %r15
+	LONG $0xff478d49                           // leaq	-1(%r15), %rax
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_57
+	WORD $0x894d; BYTE $0xfa                   // movq	%r15, %r10
+	LONG $0x16048d48                           // leaq	(%rsi,%rdx), %rax
+	LONG $0x97348d4c                           // leaq	(%rdi,%rdx,4), %r14
+	LONG $0x04eac149                           // shrq	$4, %r10
+	LONG $0x855c8d4d; BYTE $0x00               // leaq	0(%r13,%rax,4), %r11
+	WORD $0xc031                               // xorl	%eax, %eax
+	LONG $0x06e2c149                           // salq	$6, %r10
+
+BB0_21:
+	LONG $0x487cd162; WORD $0x3410; BYTE $0x03 // vmovups	(%r11,%rax), %zmm6
+	LONG $0x484cd162; WORD $0x1459; BYTE $0x06 // vmulps	(%r14,%rax), %zmm6, %zmm2
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xcac6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xc058f2c5                           // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xca15e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm1
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xc2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xd119; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm1
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0x286df362; WORD $0xc203; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x286df362; WORD $0xca03; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm1
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0x286df362; WORD $0xc203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xd11b; BYTE $0x01 // vextractf32x8	$0x1, %zmm2, %ymm1
+	LONG $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG $0xd858f2c5                           // vaddss	%xmm0, %xmm1, %xmm3
+	LONG $0xc1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc058eac5                           // vaddss	%xmm0, %xmm2, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x2875f362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm0
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xd0                   // cmpq	%r10, %rax
+	JNE  BB0_21
+	WORD $0x894d; BYTE $0xfa                   // movq	%r15, %r10
+	LONG $0xf0e28349                           // andq	$-16, %r10
+	WORD $0x014c; BYTE $0xd2                   // addq	%r10, %rdx
+	LONG $0x0fc7f641                           // testb	$15, %r15b
+	JE   BB0_19
+
+BB0_20:
+	WORD $0x894c; BYTE $0xf8                   // movq	%r15, %rax
+	WORD $0x294c; BYTE $0xd0                   // subq	%r10, %rax
+	LONG $0xff588d4c                           // leaq	-1(%rax), %r11
+	LONG $0x06fb8349                           // cmpq	$6, %r11
+	JBE  BB0_24
+	LONG $0x321c8d4d                           // leaq	(%r10,%rsi), %r11
+	WORD $0x014d; BYTE $0xe2                   // addq	%r12, %r10
+	WORD $0x014d; BYTE $0xe3                   // addq	%r12, %r11
+	LONG $0x107ca1c4; WORD $0x970c             // vmovups	(%rdi,%r10,4), %ymm1
+	WORD $0x8949; BYTE $0xc2                   // movq	%rax, %r10
+	LONG $0x597481c4; WORD $0x9d4c; BYTE $0x00 // vmulps	0(%r13,%r11,4), %ymm1, %ymm1
+	LONG $0xf8e28349                           // andq	$-8, %r10
+	WORD $0x014c; BYTE $0xd2                   // addq	%r10, %rdx
+	LONG $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG $0xd858f2c5                           // vaddss	%xmm0, %xmm1, %xmm3
+	LONG $0xc1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc058eac5                           // vaddss	%xmm0, %xmm2, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x2875f362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm0
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x07a8                               // testb	$7, %al
+	JE   BB0_19
+
+BB0_24:
+	LONG $0x16148d4c                           // leaq	(%rsi,%rdx), %r10
+	LONG $0x3410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm6
+	QUAD $0x0000000095048d48                   // leaq	0(,%rdx,4), %rax
+	LONG $0xb94982c4; WORD $0x9544; BYTE $0x00 // vfmadd231ss	0(%r13,%r10,4), %xmm6, %xmm0
+	LONG $0x01528d4c                           // leaq	1(%rdx), %r10
+	WORD $0x3949; BYTE $0xca                   // cmpq	%rcx, %r10
+	JGE  BB0_19
+	WORD $0x0149; BYTE $0xf2                   // addq	%rsi, %r10
+	LONG $0x7410fac5; WORD $0x0407             // vmovss	4(%rdi,%rax), %xmm6
+	LONG $0xb94982c4; WORD $0x9544; BYTE $0x00 // vfmadd231ss	0(%r13,%r10,4), %xmm6, %xmm0
+	LONG $0x02528d4c                           // leaq	2(%rdx), %r10
+	WORD $0x3949; BYTE $0xca                   // cmpq	%rcx, %r10
+	JGE  BB0_19
+	WORD $0x0149; BYTE $0xf2                   // addq	%rsi, %r10
+	LONG $0x7410fac5; WORD $0x0807             // vmovss	8(%rdi,%rax), %xmm6
+	LONG $0xb94982c4; WORD $0x9544; BYTE $0x00 // vfmadd231ss	0(%r13,%r10,4), %xmm6, %xmm0
+	LONG $0x03528d4c                           // leaq	3(%rdx), %r10
+	WORD $0x394c; BYTE $0xd1                   // cmpq	%r10, %rcx
+	JLE  BB0_19
+	WORD $0x0149; BYTE $0xf2                   // addq	%rsi, %r10
+	LONG $0x107a81c4; WORD $0x9574; BYTE $0x00 // vmovss	0(%r13,%r10,4), %xmm6
+	LONG $0x04528d4c                           // leaq	4(%rdx), %r10
+	LONG $0xb949e2c4; WORD $0x0744; BYTE $0x0c // vfmadd231ss	12(%rdi,%rax), %xmm6, %xmm0
+	WORD $0x394c; BYTE $0xd1                   // cmpq	%r10, %rcx
+	JLE  BB0_19
+	WORD $0x0149; BYTE $0xf2                   // addq	%rsi, %r10
+	LONG $0x107a81c4; WORD $0x9574; BYTE $0x00 // vmovss	0(%r13,%r10,4), %xmm6
+	LONG $0x05528d4c                           // leaq	5(%rdx), %r10
+	LONG $0xb949e2c4; WORD $0x0744; BYTE $0x10 // vfmadd231ss	16(%rdi,%rax), %xmm6, %xmm0
+	WORD $0x394c; BYTE $0xd1                   // cmpq	%r10, %rcx
+	JLE  BB0_19
+	WORD $0x0149; BYTE $0xf2                   // addq	%rsi, %r10
+	LONG $0x06c28348                           // addq	$6, %rdx
+	LONG $0x107a81c4; WORD $0x9574; BYTE $0x00 // vmovss	0(%r13,%r10,4), %xmm6
+	LONG $0xb949e2c4; WORD $0x0744; BYTE $0x14 // vfmadd231ss	20(%rdi,%rax), %xmm6, %xmm0
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_19
+	WORD $0x0148; BYTE $0xf2                   // addq	%rsi, %rdx
+	LONG $0x107ac1c4; WORD $0x9574; BYTE $0x00 // vmovss	0(%r13,%rdx,4), %xmm6
+	LONG $0xb949e2c4; WORD $0x0744; BYTE $0x18 // vfmadd231ss	24(%rdi,%rax), %xmm6, %xmm0
+
+BB0_19:
+	LONG $0x117ac1c4; BYTE $0x01 // vmovss	%xmm0, (%r9)
+	LONG $0x7ef9e1c4; BYTE $0xe8 // vmovq	%xmm5, %rax
+	LONG $0x04c18349             // addq	$4, %r9
+	WORD $0x0148; BYTE $0xce     // addq	%rcx, %rsi
+	WORD $0x0149; BYTE $0xc0     // addq	%rax, %r8
+	WORD $0x3949; BYTE $0xd9     // cmpq	%rbx, %r9
+	JNE  BB0_26
+
+BB0_100:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x10a58d48; WORD $0xffff; BYTE $0xff // leaq	-240(%rbp), %rsp
+	RET
+
+BB0_54:
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x48fdf162; WORD $0xd328 // vmovapd	%zmm3, %zmm2
+	LONG $0x48fdf162; WORD $0xcb28 // vmovapd	%zmm3, %zmm1
+	LONG $0x48fdf162; WORD $0xe328 // vmovapd	%zmm3, %zmm4
+	JMP  BB0_6
+
+BB0_55:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_9
+
+BB0_103:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_4
+
+BB0_57:
+	WORD $0x3145; BYTE $0xd2 // xorl	%r10d, %r10d
+	JMP  BB0_20
+
+BB0_56:
+	LONG $0xc057f9c5 // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0xd231     // xorl	%edx, %edx
+	JMP  BB0_17
+
+BB0_53:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_5
@@ -0,0 +1,14 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmulklast_c_f64_avx2_amd64.c
+
+package asm
+
+import "unsafe"
+
+//go:noescape
+func matmulklast_c_f64_avx2(a, b, c, pm, pn, pk, plen_a, plen_b, plen_c unsafe.Pointer)
@@ -0,0 +1,830 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmulklast_c_f64_avx2_amd64.c
+
+TEXT ·matmulklast_c_f64_avx2(SB), $320-72
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ c+16(FP), DX
+	MOVQ pm+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_a+48(FP), R11
+	MOVQ R11, 288(SP)
+	MOVQ plen_b+56(FP), R11
+	MOVQ R11, 296(SP)
+	MOVQ plen_c+64(FP), R11
+	MOVQ R11, 304(SP)
+	QUAD $0x0000011024ac8d48                   // leaq	272(%rsp), %rbp
+	WORD $0x8949; BYTE $0xfe                   // movq	%rdi, %r14
+	WORD $0x8949; BYTE $0xf5                   // movq	%rsi, %r13
+	LONG $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348                           // andq	$-32, %rsp
+	WORD $0x8b48; BYTE $0x01                   // movq	(%rcx), %rax
+	WORD $0x8b49; BYTE $0x18                   // movq	(%r8), %rbx
+	LONG $0x24548948; BYTE $0x10               // movq	%rdx, 16(%rsp)
+	WORD $0x8b4d; BYTE $0x39                   // movq	(%r9), %r15
+	LONG $0x24448948; BYTE $0x40               // movq	%rax, 64(%rsp)
+	QUAD $0x00000090249c8948                   // movq	%rbx, 144(%rsp)
+	LONG $0x01f88348                           // cmpq	$1, %rax
+	JE   BB0_2
+	WORD $0xd231                               // xorl	%edx, %edx
+	LONG $0x03f88348                           // cmpq	$3, %rax
+	JLE  BB0_4
+	WORD $0x8948; BYTE $0xd8                   // movq	%rbx, %rax
+	LONG $0x1b148d4c                           // leaq	(%rbx,%rbx), %r10
+	LONG $0x3f0c8d4b                           // leaq	(%r15,%r15), %rcx
+	WORD $0x894d; BYTE $0xf8                   // movq	%r15, %r8
+	QUAD $0x00000000c5348d48                   // leaq	0(,%rax,8), %rsi
+	LONG $0x1a1c8d4d                           // leaq	(%r10,%rbx), %r11
+	LONG $0x24448b48; BYTE $0x10               // movq	16(%rsp), %rax
+	QUAD $0x000000e8248c8948                   // movq	%rcx, 232(%rsp)
+	QUAD $0x000000009d248d4c                   // leaq	0(,%rbx,4), %r12
+	LONG $0x05e3c148                           // salq	$5, %rbx
+	WORD $0x014c; BYTE $0xf9                   // addq	%r15, %rcx
+	QUAD $0x000000e024bc894c                   // movq	%r15, 224(%rsp)
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x05e0c149                           // salq	$5, %r8
+	LONG $0x245c8948; BYTE $0x38               // movq	%rbx, 56(%rsp)
+	QUAD $0x0000009824848948                   // movq	%rax, 152(%rsp)
+	QUAD $0x00000000bd048d4a                   // leaq	0(,%r15,4), %rax
+	LONG $0x24448948; BYTE $0x30               // movq	%rax, 48(%rsp)
+	QUAD $0x00000000fd048d4a                   // leaq	0(,%r15,8), %rax
+	LONG $0x073c8d48                           // leaq	(%rdi,%rax), %rdi
+	LONG $0x24448948; BYTE $0x78               // movq	%rax, 120(%rsp)
+	LONG $0x071c8d48                           // leaq	(%rdi,%rax), %rbx
+	LONG $0x24748948; BYTE $0x20               // movq	%rsi, 32(%rsp)
+	LONG $0x030c8d4c                           // leaq	(%rbx,%rax), %r9
+	LONG $0xfc478d49                           // leaq	-4(%r15), %rax
+	QUAD $0x000000f0248c8948                   // movq	%rcx, 240(%rsp)
+	LONG $0x02e8c148                           // shrq	$2, %rax
+	LONG $0x2464894c; BYTE $0x18               // movq	%r12, 24(%rsp)
+	QUAD $0x0000000485048d48                   // leaq	4(,%rax,4), %rax
+	LONG $0x245c894c; BYTE $0x28               // movq	%r11, 40(%rsp)
+	QUAD $0x000000d82484c748; LONG $0x00000000 // movq	$0, 216(%rsp)
+	QUAD $0x000003682444c748; BYTE $0x00       // movq	$3, 104(%rsp)
+	LONG $0x24448948; BYTE $0x70               // movq	%rax, 112(%rsp)
+	WORD $0xc031                               // xorl	%eax, %eax
+	LONG $0x2454894c; BYTE $0x60               // movq	%r10, 96(%rsp)
+	WORD $0x8949; BYTE $0xfa                   // movq	%rdi, %r10
+	LONG $0x245c894c; BYTE $0x58               // movq	%r11, 88(%rsp)
+	WORD $0x894d; BYTE $0xf3                   // movq	%r14, %r11
+	QUAD $0x000000f824ac894c                   // movq	%r13, 248(%rsp)
+	WORD $0x894d; BYTE $0xcd                   // movq	%r9, %r13
+
+BB0_29:
+	LONG $0x244c8b4c; BYTE $0x60 // movq	96(%rsp), %r9
+	QUAD $0x0000009024948b48     // movq	144(%rsp), %rdx
+	WORD $0xff31                 // xorl	%edi, %edi
+	QUAD $0x0000009824b48b48     // movq	152(%rsp), %rsi
+	WORD $0x2949; BYTE $0xc1     // subq	%rax, %r9
+	LONG $0x100c8d48             // leaq	(%rax,%rdx), %rcx
+	QUAD $0x00000088248c894c     // movq	%r9, 136(%rsp)
+	LONG $0x244c8b4c; BYTE $0x58 // movq	88(%rsp), %r9
+	LONG $0x244c8948; BYTE $0x50 // movq	%rcx, 80(%rsp)
+	LONG $0x244c8b48; BYTE $0x20 // movq	32(%rsp), %rcx
+	WORD $0x2949; BYTE $0xc1     // subq	%rax, %r9
+	WORD $0x2948; BYTE $0xce     // subq	%rcx, %rsi
+	QUAD $0x00000080248c894c     // movq	%r9, 128(%rsp)
+	QUAD $0x000000f8248c8b48     // movq	248(%rsp), %rcx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JLE  BB0_40
+	QUAD $0x000000c024b48948     // movq	%rsi, 192(%rsp)
+	WORD $0x894d; BYTE $0xd1     // movq	%r10, %r9
+	WORD $0x8949; BYTE $0xfa     // movq	%rdi, %r10
+	LONG $0x2444894c; BYTE $0x48 // movq	%r8, 72(%rsp)
+
+BB0_39:
+	LONG $0x03ff8349             // cmpq	$3, %r15
+	JLE  BB0_58
+	LONG $0xe457d9c5             // vxorpd	%xmm4, %xmm4, %xmm4
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+	LONG $0xec28fdc5             // vmovapd	%ymm4, %ymm5
+	LONG $0xcc28fdc5             // vmovapd	%ymm4, %ymm1
+	LONG $0xd428fdc5             // vmovapd	%ymm4, %ymm2
+
+BB0_31:
+	LONG $0x4410fdc5; WORD $0xe0c1             // vmovupd	-32(%rcx,%rax,8), %ymm0
+	LONG $0xb8fdc2c4; WORD $0xc354; BYTE $0xe0 // vfmadd231pd	-32(%r11,%rax,8), %ymm0, %ymm2
+	LONG $0xb8fdc2c4; WORD $0xc14c; BYTE $0xe0 // vfmadd231pd	-32(%r9,%rax,8), %ymm0, %ymm1
+	LONG $0xb8fde2c4; WORD $0xc36c; BYTE $0xe0 // vfmadd231pd	-32(%rbx,%rax,8), %ymm0, %ymm5
+	LONG $0xb8fdc2c4; WORD $0xc564; BYTE $0xe0 // vfmadd231pd	-32(%r13,%rax,8), %ymm0, %ymm4
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_31
+	LONG $0x24448b48; BYTE $0x70               // movq	112(%rsp), %rax
+
+BB0_30:
+	LONG $0x197de3c4; WORD $0x01d3 // vextractf128	$0x1, %ymm2, %xmm3
+	LONG $0xda58e1c5               // vaddpd	%xmm2, %xmm3, %xmm3
+	LONG $0x197de3c4; WORD $0x01ca // vextractf128	$0x1, %ymm1, %xmm2
+	LONG $0xd158e9c5               // vaddpd	%xmm1, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01e9 // vextractf128	$0x1, %ymm5, %xmm1
+	LONG $0xcd58f1c5               // vaddpd	%xmm5, %xmm1, %xmm1
+	LONG $0xc315e1c5               // vunpckhpd	%xmm3, %xmm3, %xmm0
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc215e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm0
+	LONG $0xd058ebc5               // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm0
+	LONG $0xc858f3c5               // vaddsd	%xmm0, %xmm1, %xmm1
+	LONG $0x197de3c4; WORD $0x01e0 // vextractf128	$0x1, %ymm4, %xmm0
+	LONG $0xc458f9c5               // vaddpd	%xmm4, %xmm0, %xmm0
+	LONG $0xe015f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm4
+	LONG $0xc458fbc5               // vaddsd	%xmm4, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_32
+	WORD $0x894c; BYTE $0xff       // movq	%r15, %rdi
+	QUAD $0x000000c824848948       // movq	%rax, 200(%rsp)
+	WORD $0x2948; BYTE $0xc7       // subq	%rax, %rdi
+	LONG $0xff578d48               // leaq	-1(%rdi), %rdx
+	QUAD $0x000000d024bc8948       // movq	%rdi, 208(%rsp)
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_59
+	QUAD $0x000000d824b48b48       // movq	216(%rsp), %rsi
+	QUAD $0x000000f824848b4c       // movq	248(%rsp), %r8
+	LONG $0x02efc148               // shrq	$2, %rdi
+	QUAD $0x000000a82494894c       // movq	%r10, 168(%rsp)
+	QUAD $0x000000a024ac894c       // movq	%r13, 160(%rsp)
+	LONG $0x05e7c148               // salq	$5, %rdi
+	LONG $0x30148d48               // leaq	(%rax,%rsi), %rdx
+	LONG $0xd6348d49               // leaq	(%r14,%rdx,8), %rsi
+	LONG $0x02148d49               // leaq	(%r10,%rax), %rdx
+	LONG $0xd0248d4d               // leaq	(%r8,%rdx,8), %r12
+	QUAD $0x000000e024948b48       // movq	224(%rsp), %rdx
+	QUAD $0x000000e824848b4c       // movq	232(%rsp), %r8
+	QUAD $0x000000b024b48948       // movq	%rsi, 176(%rsp)
+	QUAD $0x000000b024ac8b4c       // movq	176(%rsp), %r13
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0xd6148d49               // leaq	(%r14,%rdx,8), %rdx
+	QUAD $0x000000b824948948       // movq	%rdx, 184(%rsp)
+	LONG $0x00148d4a               // leaq	(%rax,%r8), %rdx
+	QUAD $0x000000f024848b4c       // movq	240(%rsp), %r8
+	LONG $0xd6348d49               // leaq	(%r14,%rdx,8), %rsi
+	QUAD $0x000000b824948b4c       // movq	184(%rsp), %r10
+	LONG $0x00148d49               // leaq	(%r8,%rax), %rdx
+	LONG $0xd6048d4d               // leaq	(%r14,%rdx,8), %r8
+	WORD $0xd231                   // xorl	%edx, %edx
+
+BB0_34:
+	LONG $0x107dc1c4; WORD $0x1424             // vmovupd	(%r12,%rdx), %ymm4
+	LONG $0x595dc1c4; WORD $0x156c; BYTE $0x00 // vmulpd	0(%r13,%rdx), %ymm4, %ymm5
+	LONG $0xdd58e3c5                           // vaddsd	%xmm5, %xmm3, %xmm3
+	LONG $0xf515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm6
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xf358cbc5                           // vaddsd	%xmm3, %xmm6, %xmm6
+	LONG $0xde58d3c5                           // vaddsd	%xmm6, %xmm5, %xmm3
+	LONG $0xed15d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xdd58e3c5                           // vaddsd	%xmm5, %xmm3, %xmm3
+	LONG $0x595dc1c4; WORD $0x122c             // vmulpd	(%r10,%rdx), %ymm4, %ymm5
+	LONG $0xd558ebc5                           // vaddsd	%xmm5, %xmm2, %xmm2
+	LONG $0xf515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm6
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xf258cbc5                           // vaddsd	%xmm2, %xmm6, %xmm6
+	LONG $0xd658d3c5                           // vaddsd	%xmm6, %xmm5, %xmm2
+	LONG $0xed15d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xd558ebc5                           // vaddsd	%xmm5, %xmm2, %xmm2
+	LONG $0x2c59ddc5; BYTE $0x16               // vmulpd	(%rsi,%rdx), %ymm4, %ymm5
+	LONG $0x595dc1c4; WORD $0x1024             // vmulpd	(%r8,%rdx), %ymm4, %ymm4
+	LONG $0x20c28348                           // addq	$32, %rdx
+	LONG $0xcd58f3c5                           // vaddsd	%xmm5, %xmm1, %xmm1
+	LONG $0xf515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm6
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xc458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm0
+	LONG $0xf158cbc5                           // vaddsd	%xmm1, %xmm6, %xmm6
+	LONG $0xce58d3c5                           // vaddsd	%xmm6, %xmm5, %xmm1
+	LONG $0xed15d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xcd58f3c5                           // vaddsd	%xmm5, %xmm1, %xmm1
+	LONG $0xec15d9c5                           // vunpckhpd	%xmm4, %xmm4, %xmm5
+	LONG $0x197de3c4; WORD $0x01e4             // vextractf128	$0x1, %ymm4, %xmm4
+	LONG $0xe858d3c5                           // vaddsd	%xmm0, %xmm5, %xmm5
+	LONG $0xc558dbc5                           // vaddsd	%xmm5, %xmm4, %xmm0
+	LONG $0xe415d9c5                           // vunpckhpd	%xmm4, %xmm4, %xmm4
+	LONG $0xc458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xfa                   // cmpq	%rdi, %rdx
+	JNE  BB0_34
+	QUAD $0x000000d024b48b48                   // movq	208(%rsp), %rsi
+	QUAD $0x000000a824948b4c                   // movq	168(%rsp), %r10
+	QUAD $0x000000a024ac8b4c                   // movq	160(%rsp), %r13
+	LONG $0x03c6f640                           // testb	$3, %sil
+	JE   BB0_32
+	WORD $0x8948; BYTE $0xf2                   // movq	%rsi, %rdx
+	LONG $0xfce28348                           // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+
+BB0_33:
+	WORD $0x2948; BYTE $0xd6       // subq	%rdx, %rsi
+	LONG $0x01fe8348               // cmpq	$1, %rsi
+	JE   BB0_37
+	QUAD $0x000000c824a48b4c       // movq	200(%rsp), %r12
+	QUAD $0x000000f824848b4c       // movq	248(%rsp), %r8
+	LONG $0x123c8d49               // leaq	(%r10,%rdx), %rdi
+	WORD $0x014c; BYTE $0xe7       // addq	%r12, %rdi
+	LONG $0x1079c1c4; WORD $0xf824 // vmovupd	(%r8,%rdi,8), %xmm4
+	QUAD $0x000000d824848b4c       // movq	216(%rsp), %r8
+	LONG $0x223c8d4a               // leaq	(%rdx,%r12), %rdi
+	WORD $0x0149; BYTE $0xf8       // addq	%rdi, %r8
+	LONG $0x595981c4; WORD $0xc62c // vmulpd	(%r14,%r8,8), %xmm4, %xmm5
+	QUAD $0x000000e024848b4c       // movq	224(%rsp), %r8
+	WORD $0x0149; BYTE $0xf8       // addq	%rdi, %r8
+	LONG $0xdb58d3c5               // vaddsd	%xmm3, %xmm5, %xmm3
+	LONG $0xed15d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xdb58d3c5               // vaddsd	%xmm3, %xmm5, %xmm3
+	LONG $0x595981c4; WORD $0xc62c // vmulpd	(%r14,%r8,8), %xmm4, %xmm5
+	QUAD $0x000000e824848b4c       // movq	232(%rsp), %r8
+	WORD $0x014c; BYTE $0xc7       // addq	%r8, %rdi
+	LONG $0xd258d3c5               // vaddsd	%xmm2, %xmm5, %xmm2
+	LONG $0xed15d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xd258d3c5               // vaddsd	%xmm2, %xmm5, %xmm2
+	LONG $0x5959c1c4; WORD $0xfe2c // vmulpd	(%r14,%rdi,8), %xmm4, %xmm5
+	QUAD $0x000000f024bc8b48       // movq	240(%rsp), %rdi
+	WORD $0x0148; BYTE $0xfa       // addq	%rdi, %rdx
+	WORD $0x014c; BYTE $0xe2       // addq	%r12, %rdx
+	LONG $0x5959c1c4; WORD $0xd624 // vmulpd	(%r14,%rdx,8), %xmm4, %xmm4
+	LONG $0xc958d3c5               // vaddsd	%xmm1, %xmm5, %xmm1
+	LONG $0xed15d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xc958d3c5               // vaddsd	%xmm1, %xmm5, %xmm1
+	LONG $0xc058dbc5               // vaddsd	%xmm0, %xmm4, %xmm0
+	LONG $0xe415d9c5               // vunpckhpd	%xmm4, %xmm4, %xmm4
+	LONG $0xc058dbc5               // vaddsd	%xmm0, %xmm4, %xmm0
+	LONG $0x01c6f640               // testb	$1, %sil
+	JE   BB0_32
+	LONG $0xfee68348               // andq	$-2, %rsi
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+
+BB0_37:
+	QUAD $0x000000f824b48b48       // movq	248(%rsp), %rsi
+	LONG $0x02148d49               // leaq	(%r10,%rax), %rdx
+	QUAD $0x000000e024bc8b48       // movq	224(%rsp), %rdi
+	LONG $0x2410fbc5; BYTE $0xd6   // vmovsd	(%rsi,%rdx,8), %xmm4
+	QUAD $0x000000d824b48b48       // movq	216(%rsp), %rsi
+	LONG $0x06148d48               // leaq	(%rsi,%rax), %rdx
+	QUAD $0x000000e824b48b48       // movq	232(%rsp), %rsi
+	LONG $0xb9d9c2c4; WORD $0xd61c // vfmadd231sd	(%r14,%rdx,8), %xmm4, %xmm3
+	LONG $0x07148d48               // leaq	(%rdi,%rax), %rdx
+	QUAD $0x000000f024bc8b48       // movq	240(%rsp), %rdi
+	LONG $0xb9d9c2c4; WORD $0xd614 // vfmadd231sd	(%r14,%rdx,8), %xmm4, %xmm2
+	LONG $0x06148d48               // leaq	(%rsi,%rax), %rdx
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+	LONG $0xb9d9c2c4; WORD $0xd60c // vfmadd231sd	(%r14,%rdx,8), %xmm4, %xmm1
+	LONG $0xb9d9c2c4; WORD $0xc604 // vfmadd231sd	(%r14,%rax,8), %xmm4, %xmm0
+
+BB0_32:
+	QUAD $0x000000c024848b48     // movq	192(%rsp), %rax
+	QUAD $0x0000009024b48b48     // movq	144(%rsp), %rsi
+	WORD $0x014d; BYTE $0xfa     // addq	%r15, %r10
+	LONG $0x1811fbc5             // vmovsd	%xmm3, (%rax)
+	LONG $0x1411fbc5; BYTE $0xf0 // vmovsd	%xmm2, (%rax,%rsi,8)
+	QUAD $0x0000008824b48b48     // movq	136(%rsp), %rsi
+	LONG $0x0c11fbc5; BYTE $0xf0 // vmovsd	%xmm1, (%rax,%rsi,8)
+	QUAD $0x0000008024b48b48     // movq	128(%rsp), %rsi
+	LONG $0x0411fbc5; BYTE $0xf0 // vmovsd	%xmm0, (%rax,%rsi,8)
+	LONG $0x24748b48; BYTE $0x78 // movq	120(%rsp), %rsi
+	LONG $0x08c08348             // addq	$8, %rax
+	QUAD $0x000000c024848948     // movq	%rax, 192(%rsp)
+	WORD $0x0148; BYTE $0xf1     // addq	%rsi, %rcx
+	QUAD $0x0000009824b48b48     // movq	152(%rsp), %rsi
+	WORD $0x3948; BYTE $0xf0     // cmpq	%rsi, %rax
+	JNE  BB0_39
+	LONG $0x24448b4c; BYTE $0x48 // movq	72(%rsp), %r8
+	WORD $0x894d; BYTE $0xca     // movq	%r9, %r10
+
+BB0_40:
+	LONG $0x244c8b48; BYTE $0x28   // movq	40(%rsp), %rcx
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	WORD $0x014d; BYTE $0xc3       // addq	%r8, %r11
+	WORD $0x014d; BYTE $0xc2       // addq	%r8, %r10
+	LONG $0x24448348; WORD $0x0468 // addq	$4, 104(%rsp)
+	LONG $0x247c8b48; BYTE $0x68   // movq	104(%rsp), %rdi
+	WORD $0x014c; BYTE $0xc3       // addq	%r8, %rbx
+	WORD $0x014d; BYTE $0xc5       // addq	%r8, %r13
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	LONG $0x244c8b48; BYTE $0x30   // movq	48(%rsp), %rcx
+	QUAD $0x000000d8248c0148       // addq	%rcx, 216(%rsp)
+	QUAD $0x000000e0248c0148       // addq	%rcx, 224(%rsp)
+	LONG $0x24748b48; BYTE $0x18   // movq	24(%rsp), %rsi
+	QUAD $0x000000e8248c0148       // addq	%rcx, 232(%rsp)
+	QUAD $0x000000f0248c0148       // addq	%rcx, 240(%rsp)
+	LONG $0x244c8b48; BYTE $0x40   // movq	64(%rsp), %rcx
+	LONG $0x24740148; BYTE $0x60   // addq	%rsi, 96(%rsp)
+	LONG $0x24740148; BYTE $0x58   // addq	%rsi, 88(%rsp)
+	LONG $0x24748b48; BYTE $0x38   // movq	56(%rsp), %rsi
+	QUAD $0x0000009824b40148       // addq	%rsi, 152(%rsp)
+	WORD $0x3948; BYTE $0xcf       // cmpq	%rcx, %rdi
+	JL   BB0_29
+	WORD $0x8948; BYTE $0xc8       // movq	%rcx, %rax
+	QUAD $0x000000f824ac8b4c       // movq	248(%rsp), %r13
+	LONG $0x04e88348               // subq	$4, %rax
+	LONG $0x02e8c148               // shrq	$2, %rax
+	QUAD $0x0000000485148d48       // leaq	4(,%rax,4), %rdx
+
+BB0_4:
+	LONG $0x24543948; BYTE $0x40 // cmpq	%rdx, 64(%rsp)
+	JLE  BB0_114
+	QUAD $0x00000090249c8b48     // movq	144(%rsp), %rbx
+	WORD $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE  BB0_114
+	WORD $0x8948; BYTE $0xd8     // movq	%rbx, %rax
+	QUAD $0x00000000dd0c8d4c     // leaq	0(,%rbx,8), %r9
+	LONG $0xfc4f8d49             // leaq	-4(%r15), %rcx
+	WORD $0x894d; BYTE $0xfa     // movq	%r15, %r10
+	LONG $0xc2af0f48             // imulq	%rdx, %rax
+	LONG $0x02e9c148             // shrq	$2, %rcx
+	QUAD $0x000000c8248c894c     // movq	%r9, 200(%rsp)
+	LONG $0xd2af0f4c             // imulq	%rdx, %r10
+	LONG $0x18348d48             // leaq	(%rax,%rbx), %rsi
+	LONG $0x245c8b48; BYTE $0x10 // movq	16(%rsp), %rbx
+	LONG $0xd6048d4f             // leaq	(%r14,%r10,8), %r8
+	LONG $0xf31c8d48             // leaq	(%rbx,%rsi,8), %rbx
+	QUAD $0x000000e8249c8948     // movq	%rbx, 232(%rsp)
+	QUAD $0x00000000fd1c8d4a     // leaq	0(,%r15,8), %rbx
+	QUAD $0x000000f0249c8948     // movq	%rbx, 240(%rsp)
+	QUAD $0x000000048d1c8d48     // leaq	4(,%rcx,4), %rbx
+	QUAD $0x000000e0249c8948     // movq	%rbx, 224(%rsp)
+
+BB0_52:
+	LONG $0x245c8b48; BYTE $0x10 // movq	16(%rsp), %rbx
+	QUAD $0x000000d824948948     // movq	%rdx, 216(%rsp)
+	WORD $0x894c; BYTE $0xe9     // movq	%r13, %rcx
+	WORD $0xff31                 // xorl	%edi, %edi
+	QUAD $0x000000d024b48948     // movq	%rsi, 208(%rsp)
+	LONG $0xc3248d4c             // leaq	(%rbx,%rax,8), %r12
+
+BB0_42:
+	LONG $0x03ff8349             // cmpq	$3, %r15
+	JLE  BB0_60
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+
+BB0_44:
+	LONG $0x107dc1c4; WORD $0xc07c; BYTE $0xe0 // vmovupd	-32(%r8,%rax,8), %ymm7
+	LONG $0xb8c5e2c4; WORD $0xc14c; BYTE $0xe0 // vfmadd231pd	-32(%rcx,%rax,8), %ymm7, %ymm1
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_44
+	QUAD $0x000000e024848b48                   // movq	224(%rsp), %rax
+
+BB0_43:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_45
+	WORD $0x894c; BYTE $0xfe       // movq	%r15, %rsi
+	QUAD $0x000000f824848948       // movq	%rax, 248(%rsp)
+	WORD $0x2948; BYTE $0xc6       // subq	%rax, %rsi
+	LONG $0xff568d48               // leaq	-1(%rsi), %rdx
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_61
+	LONG $0x10148d4a               // leaq	(%rax,%r10), %rdx
+	WORD $0x8949; BYTE $0xf1       // movq	%rsi, %r9
+	LONG $0xd61c8d49               // leaq	(%r14,%rdx,8), %rbx
+	LONG $0x02e9c149               // shrq	$2, %r9
+	LONG $0x38148d48               // leaq	(%rax,%rdi), %rdx
+	LONG $0xd55c8d4d; BYTE $0x00   // leaq	0(%r13,%rdx,8), %r11
+	LONG $0x05e1c149               // salq	$5, %r9
+	WORD $0xd231                   // xorl	%edx, %edx
+
+BB0_47:
+	LONG $0x107dc1c4; WORD $0x133c // vmovupd	(%r11,%rdx), %ymm7
+	LONG $0x1459c5c5; BYTE $0x13   // vmulpd	(%rbx,%rdx), %ymm7, %ymm2
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xc258fbc5               // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xda15e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm3
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f3c5               // vaddsd	%xmm3, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JNE  BB0_47
+	WORD $0x8948; BYTE $0xf2       // movq	%rsi, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x03c6f640               // testb	$3, %sil
+	JE   BB0_45
+
+BB0_46:
+	WORD $0x2948; BYTE $0xd6                   // subq	%rdx, %rsi
+	LONG $0x01fe8348                           // cmpq	$1, %rsi
+	JE   BB0_50
+	QUAD $0x000000f8249c8b48                   // movq	248(%rsp), %rbx
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x3a0c8d4c                           // leaq	(%rdx,%rdi), %r9
+	WORD $0x014c; BYTE $0xd2                   // addq	%r10, %rdx
+	LONG $0x1079c1c4; WORD $0xd60c             // vmovupd	(%r14,%rdx,8), %xmm1
+	LONG $0x597181c4; WORD $0xcd4c; BYTE $0x00 // vmulpd	0(%r13,%r9,8), %xmm1, %xmm1
+	LONG $0xc058f3c5                           // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5                           // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0x01c6f640                           // testb	$1, %sil
+	JE   BB0_45
+	LONG $0xfee68348                           // andq	$-2, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+
+BB0_50:
+	LONG $0x07148d48                           // leaq	(%rdi,%rax), %rdx
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+	LONG $0x107bc1c4; WORD $0xd57c; BYTE $0x00 // vmovsd	0(%r13,%rdx,8), %xmm7
+	LONG $0xb9c1c2c4; WORD $0xc604             // vfmadd231sd	(%r14,%rax,8), %xmm7, %xmm0
+
+BB0_45:
+	QUAD $0x000000f024848b48       // movq	240(%rsp), %rax
+	LONG $0x117bc1c4; WORD $0x2404 // vmovsd	%xmm0, (%r12)
+	WORD $0x014c; BYTE $0xff       // addq	%r15, %rdi
+	LONG $0x08c48349               // addq	$8, %r12
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	QUAD $0x000000e824a4394c       // cmpq	%r12, 232(%rsp)
+	JNE  BB0_42
+	QUAD $0x000000d824948b48       // movq	216(%rsp), %rdx
+	WORD $0x8948; BYTE $0xc3       // movq	%rax, %rbx
+	WORD $0x014d; BYTE $0xfa       // addq	%r15, %r10
+	QUAD $0x000000d024b48b48       // movq	208(%rsp), %rsi
+	QUAD $0x000000c8248c8b48       // movq	200(%rsp), %rcx
+	WORD $0x0149; BYTE $0xd8       // addq	%rbx, %r8
+	QUAD $0x000000e8248c0148       // addq	%rcx, 232(%rsp)
+	LONG $0x01c28348               // addq	$1, %rdx
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG $0x24543948; BYTE $0x40   // cmpq	%rdx, 64(%rsp)
+	JE   BB0_114
+	QUAD $0x00000090249c8b48       // movq	144(%rsp), %rbx
+	WORD $0x0148; BYTE $0xde       // addq	%rbx, %rsi
+	JMP  BB0_52
+
+BB0_58:
+	LONG $0xe457d9c5 // vxorpd	%xmm4, %xmm4, %xmm4
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xec28fdc5 // vmovapd	%ymm4, %ymm5
+	LONG $0xcc28fdc5 // vmovapd	%ymm4, %ymm1
+	LONG $0xd428fdc5 // vmovapd	%ymm4, %ymm2
+	JMP  BB0_30
+
+BB0_59:
+	WORD $0xd231             // xorl	%edx, %edx
+	WORD $0x8948; BYTE $0xfe // movq	%rdi, %rsi
+	JMP  BB0_33
+
+BB0_60:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	JMP  BB0_43
+
+BB0_61:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_46
+
+BB0_2:
+	LONG $0x03fb8348             // cmpq	$3, %rbx
+	JLE  BB0_53
+	QUAD $0x00000000bd048d4a     // leaq	0(,%r15,4), %rax
+	WORD $0x8948; BYTE $0xd1     // movq	%rdx, %rcx
+	LONG $0x3f048d4f             // leaq	(%r15,%r15), %r8
+	WORD $0x8949; BYTE $0xf1     // movq	%rsi, %r9
+	QUAD $0x000000c824848948     // movq	%rax, 200(%rsp)
+	WORD $0x894c; BYTE $0xf8     // movq	%r15, %rax
+	LONG $0x383c8d4b             // leaq	(%r8,%r15), %rdi
+	LONG $0x05e0c148             // salq	$5, %rax
+	QUAD $0x000000e824948948     // movq	%rdx, 232(%rsp)
+	QUAD $0x000000c024848948     // movq	%rax, 192(%rsp)
+	QUAD $0x00000000fd048d4a     // leaq	0(,%r15,8), %rax
+	LONG $0x06248d4c             // leaq	(%rsi,%rax), %r12
+	QUAD $0x000000f024bc894c     // movq	%r15, 240(%rsp)
+	LONG $0x041c8d4d             // leaq	(%r12,%rax), %r11
+	QUAD $0x000000f824bc8948     // movq	%rdi, 248(%rsp)
+	LONG $0x03148d4d             // leaq	(%r11,%rax), %r10
+	LONG $0xfc438d48             // leaq	-4(%rbx), %rax
+	WORD $0x894c; BYTE $0xdf     // movq	%r11, %rdi
+	LONG $0x02e8c148             // shrq	$2, %rax
+	WORD $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+	LONG $0x05e0c148             // salq	$5, %rax
+	LONG $0x01448d48; BYTE $0x20 // leaq	32(%rcx,%rax), %rax
+	LONG $0x24548948; BYTE $0x78 // movq	%rdx, 120(%rsp)
+	QUAD $0x000000d024848948     // movq	%rax, 208(%rsp)
+	LONG $0xfc478d49             // leaq	-4(%r15), %rax
+	LONG $0x02e8c148             // shrq	$2, %rax
+	QUAD $0x0000000485048d48     // leaq	4(,%rax,4), %rax
+	QUAD $0x000000a024848948     // movq	%rax, 160(%rsp)
+	WORD $0xc031                 // xorl	%eax, %eax
+	WORD $0x8949; BYTE $0xc3     // movq	%rax, %r11
+
+BB0_15:
+	LONG $0x03ff8349             // cmpq	$3, %r15
+	JLE  BB0_54
+	LONG $0xd257e9c5             // vxorpd	%xmm2, %xmm2, %xmm2
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+	LONG $0xca28fdc5             // vmovapd	%ymm2, %ymm1
+	LONG $0xda28fdc5             // vmovapd	%ymm2, %ymm3
+	LONG $0xe228fdc5             // vmovapd	%ymm2, %ymm4
+
+BB0_7:
+	LONG $0x107dc1c4; WORD $0xc644; BYTE $0xe0 // vmovupd	-32(%r14,%rax,8), %ymm0
+	LONG $0xb8fdc2c4; WORD $0xc164; BYTE $0xe0 // vfmadd231pd	-32(%r9,%rax,8), %ymm0, %ymm4
+	LONG $0xb8fdc2c4; WORD $0xc45c; BYTE $0xe0 // vfmadd231pd	-32(%r12,%rax,8), %ymm0, %ymm3
+	LONG $0xb8fde2c4; WORD $0xc74c; BYTE $0xe0 // vfmadd231pd	-32(%rdi,%rax,8), %ymm0, %ymm1
+	LONG $0xb8fdc2c4; WORD $0xc254; BYTE $0xe0 // vfmadd231pd	-32(%r10,%rax,8), %ymm0, %ymm2
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_7
+	QUAD $0x000000a024848b48                   // movq	160(%rsp), %rax
+
+BB0_6:
+	LONG $0x197de3c4; WORD $0x01e0 // vextractf128	$0x1, %ymm4, %xmm0
+	LONG $0x197de3c4; WORD $0x01cd // vextractf128	$0x1, %ymm1, %xmm5
+	LONG $0xe458f9c5               // vaddpd	%xmm4, %xmm0, %xmm4
+	LONG $0xc415d9c5               // vunpckhpd	%xmm4, %xmm4, %xmm0
+	LONG $0xe058dbc5               // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01d8 // vextractf128	$0x1, %ymm3, %xmm0
+	LONG $0xc358f9c5               // vaddpd	%xmm3, %xmm0, %xmm0
+	LONG $0xd815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm3
+	LONG $0xdb58fbc5               // vaddsd	%xmm3, %xmm0, %xmm3
+	LONG $0xc558f1c5               // vaddpd	%xmm5, %xmm1, %xmm0
+	LONG $0x197de3c4; WORD $0x01d5 // vextractf128	$0x1, %ymm2, %xmm5
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xcd58e9c5               // vaddpd	%xmm5, %xmm2, %xmm1
+	LONG $0xd115f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0xca58f3c5               // vaddsd	%xmm2, %xmm1, %xmm1
+	LONG $0xc914f9c5               // vunpcklpd	%xmm1, %xmm0, %xmm1
+	LONG $0xc314d9c5               // vunpcklpd	%xmm3, %xmm4, %xmm0
+	LONG $0x187de3c4; WORD $0x01c1 // vinsertf128	$0x1, %xmm1, %ymm0, %ymm0
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_8
+	WORD $0x894c; BYTE $0xf9       // movq	%r15, %rcx
+	QUAD $0x000000e024848948       // movq	%rax, 224(%rsp)
+	WORD $0x2948; BYTE $0xc1       // subq	%rax, %rcx
+	LONG $0xff518d48               // leaq	-1(%rcx), %rdx
+	QUAD $0x000000d8248c8948       // movq	%rcx, 216(%rsp)
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_55
+	LONG $0x03148d49               // leaq	(%r11,%rax), %rdx
+	LONG $0x02e9c148               // shrq	$2, %rcx
+	LONG $0xc61c8d49               // leaq	(%r14,%rax,8), %rbx
+	QUAD $0x0000009824bc8948       // movq	%rdi, 152(%rsp)
+	LONG $0xd5748d49; BYTE $0x00   // leaq	0(%r13,%rdx,8), %rsi
+	QUAD $0x000000f024948b48       // movq	240(%rsp), %rdx
+	QUAD $0x000000882494894c       // movq	%r10, 136(%rsp)
+	LONG $0x05e1c148               // salq	$5, %rcx
+	QUAD $0x000000a824b48948       // movq	%rsi, 168(%rsp)
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	QUAD $0x0000008024bc894c       // movq	%r15, 128(%rsp)
+	QUAD $0x000000a824bc8b4c       // movq	168(%rsp), %r15
+	LONG $0xd5548d49; BYTE $0x00   // leaq	0(%r13,%rdx,8), %rdx
+	QUAD $0x000000b024948948       // movq	%rdx, 176(%rsp)
+	LONG $0x00148d49               // leaq	(%r8,%rax), %rdx
+	QUAD $0x000000b024948b4c       // movq	176(%rsp), %r10
+	LONG $0xd5748d49; BYTE $0x00   // leaq	0(%r13,%rdx,8), %rsi
+	QUAD $0x000000f824948b48       // movq	248(%rsp), %rdx
+	QUAD $0x000000b824b48948       // movq	%rsi, 184(%rsp)
+	QUAD $0x000000b824bc8b48       // movq	184(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0xd5748d49; BYTE $0x00   // leaq	0(%r13,%rdx,8), %rsi
+	WORD $0xd231                   // xorl	%edx, %edx
+
+BB0_10:
+	LONG $0x1c10fdc5; BYTE $0x13   // vmovupd	(%rbx,%rdx), %ymm3
+	LONG $0x5965c1c4; WORD $0x1214 // vmulpd	(%r10,%rdx), %ymm3, %ymm2
+	LONG $0x5965c1c4; WORD $0x1724 // vmulpd	(%r15,%rdx), %ymm3, %ymm4
+	LONG $0x2c59e5c5; BYTE $0x17   // vmulpd	(%rdi,%rdx), %ymm3, %ymm5
+	LONG $0x1c59e5c5; BYTE $0x16   // vmulpd	(%rsi,%rdx), %ymm3, %ymm3
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xca14d9c5               // vunpcklpd	%xmm2, %xmm4, %xmm1
+	LONG $0xc41559c5               // vunpckhpd	%xmm4, %xmm4, %xmm8
+	LONG $0x197de3c4; WORD $0x01e4 // vextractf128	$0x1, %ymm4, %xmm4
+	LONG $0xcd1551c5               // vunpckhpd	%xmm5, %xmm5, %xmm9
+	LONG $0xc6116bc5               // vmovsd	%xmm8, %xmm2, %xmm6
+	LONG $0xd31451c5               // vunpcklpd	%xmm3, %xmm5, %xmm10
+	LONG $0xcf1163c5               // vmovsd	%xmm9, %xmm3, %xmm7
+	LONG $0x197de3c4; WORD $0x01ed // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0x1875c3c4; WORD $0x01ca // vinsertf128	$0x1, %xmm10, %ymm1, %ymm1
+	LONG $0x184de3c4; WORD $0x01f7 // vinsertf128	$0x1, %xmm7, %ymm6, %ymm6
+	LONG $0xc058f5c5               // vaddpd	%ymm0, %ymm1, %ymm0
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0x197de3c4; WORD $0x01da // vextractf128	$0x1, %ymm3, %xmm2
+	LONG $0xfa14d1c5               // vunpcklpd	%xmm2, %xmm5, %xmm7
+	LONG $0xd914d9c5               // vunpcklpd	%xmm1, %xmm4, %xmm3
+	LONG $0xed15d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0x1865e3c4; WORD $0x01df // vinsertf128	$0x1, %xmm7, %ymm3, %ymm3
+	LONG $0xe415d9c5               // vunpckhpd	%xmm4, %xmm4, %xmm4
+	LONG $0xd510ebc5               // vmovsd	%xmm5, %xmm2, %xmm2
+	LONG $0xc658fdc5               // vaddpd	%ymm6, %ymm0, %ymm0
+	LONG $0xcc10f3c5               // vmovsd	%xmm4, %xmm1, %xmm1
+	LONG $0x1875e3c4; WORD $0x01ca // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	LONG $0xc358fdc5               // vaddpd	%ymm3, %ymm0, %ymm0
+	LONG $0xc158fdc5               // vaddpd	%ymm1, %ymm0, %ymm0
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JNE  BB0_10
+	QUAD $0x000000d8249c8b48       // movq	216(%rsp), %rbx
+	QUAD $0x0000009824bc8b48       // movq	152(%rsp), %rdi
+	QUAD $0x0000008824948b4c       // movq	136(%rsp), %r10
+	QUAD $0x0000008024bc8b4c       // movq	128(%rsp), %r15
+	WORD $0x8948; BYTE $0xda       // movq	%rbx, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	WORD $0xe383; BYTE $0x03       // andl	$3, %ebx
+	JE   BB0_8
+
+BB0_9:
+	QUAD $0x000000d824b48b48                   // movq	216(%rsp), %rsi
+	WORD $0x2948; BYTE $0xd6                   // subq	%rdx, %rsi
+	LONG $0x01fe8348                           // cmpq	$1, %rsi
+	JE   BB0_13
+	QUAD $0x000000e0249c8b48                   // movq	224(%rsp), %rbx
+	LONG $0x1a0c8d48                           // leaq	(%rdx,%rbx), %rcx
+	LONG $0x1079c1c4; WORD $0xce0c             // vmovupd	(%r14,%rcx,8), %xmm1
+	LONG $0x130c8d49                           // leaq	(%r11,%rdx), %rcx
+	WORD $0x0148; BYTE $0xd9                   // addq	%rbx, %rcx
+	LONG $0x5971c1c4; WORD $0xcd64; BYTE $0x00 // vmulpd	0(%r13,%rcx,8), %xmm1, %xmm4
+	QUAD $0x000000f0248c8b48                   // movq	240(%rsp), %rcx
+	WORD $0x0148; BYTE $0xd1                   // addq	%rdx, %rcx
+	WORD $0x0148; BYTE $0xd9                   // addq	%rbx, %rcx
+	LONG $0x5971c1c4; WORD $0xcd5c; BYTE $0x00 // vmulpd	0(%r13,%rcx,8), %xmm1, %xmm3
+	LONG $0x100c8d49                           // leaq	(%r8,%rdx), %rcx
+	WORD $0x0148; BYTE $0xd9                   // addq	%rbx, %rcx
+	LONG $0x5971c1c4; WORD $0xcd6c; BYTE $0x00 // vmulpd	0(%r13,%rcx,8), %xmm1, %xmm5
+	QUAD $0x000000f8248c8b48                   // movq	248(%rsp), %rcx
+	WORD $0x0148; BYTE $0xca                   // addq	%rcx, %rdx
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0xd314d9c5                           // vunpcklpd	%xmm3, %xmm4, %xmm2
+	LONG $0xe415d9c5                           // vunpckhpd	%xmm4, %xmm4, %xmm4
+	LONG $0x5971c1c4; WORD $0xd54c; BYTE $0x00 // vmulpd	0(%r13,%rdx,8), %xmm1, %xmm1
+	LONG $0xdc10e3c5                           // vmovsd	%xmm4, %xmm3, %xmm3
+	LONG $0xf114d1c5                           // vunpcklpd	%xmm1, %xmm5, %xmm6
+	LONG $0xed15d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0x186de3c4; WORD $0x01d6             // vinsertf128	$0x1, %xmm6, %ymm2, %ymm2
+	LONG $0xcd10f3c5                           // vmovsd	%xmm5, %xmm1, %xmm1
+	LONG $0xc058edc5                           // vaddpd	%ymm0, %ymm2, %ymm0
+	LONG $0x1865e3c4; WORD $0x01c9             // vinsertf128	$0x1, %xmm1, %ymm3, %ymm1
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	LONG $0x01c6f640                           // testb	$1, %sil
+	JE   BB0_8
+	LONG $0xfee68348                           // andq	$-2, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+
+BB0_13:
+	QUAD $0x000000f0249c8b48                   // movq	240(%rsp), %rbx
+	LONG $0x030c8d49                           // leaq	(%r11,%rax), %rcx
+	LONG $0x00348d49                           // leaq	(%r8,%rax), %rsi
+	LONG $0x197dc2c4; WORD $0xc61c             // vbroadcastsd	(%r14,%rax,8), %ymm3
+	LONG $0x107bc1c4; WORD $0xf554; BYTE $0x00 // vmovsd	0(%r13,%rsi,8), %xmm2
+	LONG $0x107bc1c4; WORD $0xcd4c; BYTE $0x00 // vmovsd	0(%r13,%rcx,8), %xmm1
+	LONG $0x03148d48                           // leaq	(%rbx,%rax), %rdx
+	QUAD $0x000000f8249c8b48                   // movq	248(%rsp), %rbx
+	LONG $0x1671c1c4; WORD $0xd54c; BYTE $0x00 // vmovhpd	0(%r13,%rdx,8), %xmm1, %xmm1
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x1669c1c4; WORD $0xc554; BYTE $0x00 // vmovhpd	0(%r13,%rax,8), %xmm2, %xmm2
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	LONG $0xb8e5e2c4; BYTE $0xc1               // vfmadd231pd	%ymm1, %ymm3, %ymm0
+
+BB0_8:
+	QUAD $0x000000e824848b48     // movq	232(%rsp), %rax
+	QUAD $0x000000c8249c8b48     // movq	200(%rsp), %rbx
+	QUAD $0x000000c0248c8b48     // movq	192(%rsp), %rcx
+	QUAD $0x000000f0249c0148     // addq	%rbx, 240(%rsp)
+	LONG $0x0011fdc5             // vmovupd	%ymm0, (%rax)
+	LONG $0x20c08348             // addq	$32, %rax
+	WORD $0x0149; BYTE $0xdb     // addq	%rbx, %r11
+	WORD $0x0149; BYTE $0xd8     // addq	%rbx, %r8
+	WORD $0x0149; BYTE $0xc9     // addq	%rcx, %r9
+	WORD $0x0149; BYTE $0xcc     // addq	%rcx, %r12
+	WORD $0x0148; BYTE $0xcf     // addq	%rcx, %rdi
+	WORD $0x0149; BYTE $0xca     // addq	%rcx, %r10
+	QUAD $0x000000f8249c0148     // addq	%rbx, 248(%rsp)
+	QUAD $0x000000e824848948     // movq	%rax, 232(%rsp)
+	QUAD $0x000000d024843948     // cmpq	%rax, 208(%rsp)
+	JNE  BB0_15
+	LONG $0x24548b48; BYTE $0x78 // movq	120(%rsp), %rdx
+	QUAD $0x00000004950c8d48     // leaq	4(,%rdx,4), %rcx
+
+BB0_5:
+	QUAD $0x0000009024848b48     // movq	144(%rsp), %rax
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JLE  BB0_114
+	LONG $0x245c8b48; BYTE $0x10 // movq	16(%rsp), %rbx
+	QUAD $0x00000000fd1c8d4e     // leaq	0(,%r15,8), %r11
+	LONG $0xc3048d48             // leaq	(%rbx,%rax,8), %rax
+	LONG $0xcb148d4c             // leaq	(%rbx,%rcx,8), %r10
+	QUAD $0x000000f824848948     // movq	%rax, 248(%rsp)
+	LONG $0xcfaf0f49             // imulq	%r15, %rcx
+	LONG $0xfc478d49             // leaq	-4(%r15), %rax
+	LONG $0x02e8c148             // shrq	$2, %rax
+	QUAD $0x0000000485048d48     // leaq	4(,%rax,4), %rax
+	QUAD $0x000000f024848948     // movq	%rax, 240(%rsp)
+	LONG $0xcd748d49; BYTE $0x00 // leaq	0(%r13,%rcx,8), %rsi
+
+BB0_26:
+	LONG $0x03ff8349             // cmpq	$3, %r15
+	JLE  BB0_56
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+
+BB0_18:
+	LONG $0x107dc1c4; WORD $0xc67c; BYTE $0xe0 // vmovupd	-32(%r14,%rax,8), %ymm7
+	LONG $0xb8c5e2c4; WORD $0xc64c; BYTE $0xe0 // vfmadd231pd	-32(%rsi,%rax,8), %ymm7, %ymm1
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_18
+	QUAD $0x000000f024948b48                   // movq	240(%rsp), %rdx
+
+BB0_17:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_19
+	WORD $0x894c; BYTE $0xff       // movq	%r15, %rdi
+	WORD $0x8948; BYTE $0xd3       // movq	%rdx, %rbx
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	LONG $0x02f88348               // cmpq	$2, %rax
+	JBE  BB0_57
+	WORD $0x8949; BYTE $0xf8       // movq	%rdi, %r8
+	LONG $0x11048d48               // leaq	(%rcx,%rdx), %rax
+	LONG $0xd6248d4d               // leaq	(%r14,%rdx,8), %r12
+	LONG $0x02e8c149               // shrq	$2, %r8
+	LONG $0xc54c8d4d; BYTE $0x00   // leaq	0(%r13,%rax,8), %r9
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x05e0c149               // salq	$5, %r8
+
+BB0_21:
+	LONG $0x107dc1c4; WORD $0x013c // vmovupd	(%r9,%rax), %ymm7
+	LONG $0x5945c1c4; WORD $0x0414 // vmulpd	(%r12,%rax), %ymm7, %ymm2
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xc258fbc5               // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xda15e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm3
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f3c5               // vaddsd	%xmm3, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc0       // cmpq	%r8, %rax
+	JNE  BB0_21
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x03c7f640               // testb	$3, %dil
+	JE   BB0_19
+
+BB0_20:
+	WORD $0x2948; BYTE $0xc7                   // subq	%rax, %rdi
+	LONG $0x01ff8348                           // cmpq	$1, %rdi
+	JE   BB0_24
+	LONG $0x08048d4c                           // leaq	(%rax,%rcx), %r8
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	WORD $0x0149; BYTE $0xd8                   // addq	%rbx, %r8
+	LONG $0x1079c1c4; WORD $0xc60c             // vmovupd	(%r14,%rax,8), %xmm1
+	LONG $0x597181c4; WORD $0xc54c; BYTE $0x00 // vmulpd	0(%r13,%r8,8), %xmm1, %xmm1
+	LONG $0xc058f3c5                           // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5                           // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0x01c7f640                           // testb	$1, %dil
+	JE   BB0_19
+	LONG $0xfee78348                           // andq	$-2, %rdi
+	WORD $0x0148; BYTE $0xfa                   // addq	%rdi, %rdx
+
+BB0_24:
+	LONG $0x11048d48                           // leaq	(%rcx,%rdx), %rax
+	LONG $0x107bc1c4; WORD $0xc57c; BYTE $0x00 // vmovsd	0(%r13,%rax,8), %xmm7
+	LONG $0xb9c1c2c4; WORD $0xd604             // vfmadd231sd	(%r14,%rdx,8), %xmm7, %xmm0
+
+BB0_19:
+	LONG $0x117bc1c4; BYTE $0x02 // vmovsd	%xmm0, (%r10)
+	WORD $0x014c; BYTE $0xf9     // addq	%r15, %rcx
+	LONG $0x08c28349             // addq	$8, %r10
+	WORD $0x014c; BYTE $0xde     // addq	%r11, %rsi
+	QUAD $0x000000f82494394c     // cmpq	%r10, 248(%rsp)
+	JNE  BB0_26
+
+BB0_114:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0xf0a58d48; WORD $0xfffe; BYTE $0xff // leaq	-272(%rbp), %rsp
+	RET
+
+BB0_54:
+	LONG $0xd257e9c5 // vxorpd	%xmm2, %xmm2, %xmm2
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xca28fdc5 // vmovapd	%ymm2, %ymm1
+	LONG $0xda28fdc5 // vmovapd	%ymm2, %ymm3
+	LONG $0xe228fdc5 // vmovapd	%ymm2, %ymm4
+	JMP  BB0_6
+
+BB0_55:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_9
+
+BB0_56:
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	JMP  BB0_17
+
+BB0_57:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_20
+
+BB0_53:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_5
@@ -0,0 +1,1119 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmulklast_c_f64_avx512_amd64.c
+
+TEXT ·matmulklast_c_f64_avx512(SB), $288-72
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ c+16(FP), DX
+	MOVQ pm+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_a+48(FP), R11
+	MOVQ R11, 256(SP)
+	MOVQ plen_b+56(FP), R11
+	MOVQ R11, 264(SP)
+	MOVQ plen_c+64(FP), R11
+	MOVQ R11, 272(SP)
+	WORD $0x8949; BYTE $0xd3                   // movq	%rdx, %r11
+	QUAD $0x000000f024ac8d48                   // leaq	240(%rsp), %rbp
+	WORD $0x8948; BYTE $0xfb                   // movq	%rdi, %rbx
+	LONG $0x24648d48; BYTE $0x40               // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348                           // andq	$-64, %rsp
+	WORD $0x8b48; BYTE $0x01                   // movq	(%rcx), %rax
+	WORD $0x8b4d; BYTE $0x29                   // movq	(%r9), %r13
+	QUAD $0x000000a024b48948                   // movq	%rsi, 160(%rsp)
+	WORD $0x8b49; BYTE $0x30                   // movq	(%r8), %rsi
+	LONG $0x24448948; BYTE $0x18               // movq	%rax, 24(%rsp)
+	LONG $0x24748948; BYTE $0x68               // movq	%rsi, 104(%rsp)
+	LONG $0x01f88348                           // cmpq	$1, %rax
+	JE   BB0_2
+	LONG $0x03f88348                           // cmpq	$3, %rax
+	JLE  BB0_105
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	QUAD $0x00000000b5348d48                   // leaq	0(,%rsi,4), %rsi
+	LONG $0x245c894c; BYTE $0x08               // movq	%r11, 8(%rsp)
+	LONG $0x0003be41; WORD $0x0000             // movl	$3, %r14d
+	LONG $0x003c8d48                           // leaq	(%rax,%rax), %rdi
+	WORD $0x8949; BYTE $0xda                   // movq	%rbx, %r10
+	LONG $0x6ef9e1c4; BYTE $0xf6               // vmovq	%rsi, %xmm6
+	WORD $0x8948; BYTE $0xc6                   // movq	%rax, %rsi
+	LONG $0x073c8d4c                           // leaq	(%rdi,%rax), %r15
+	LONG $0x03e0c148                           // salq	$3, %rax
+	LONG $0x05e6c148                           // salq	$5, %rsi
+	QUAD $0x000000b824ac894c                   // movq	%r13, 184(%rsp)
+	LONG $0x6ef9e1c4; BYTE $0xf8               // vmovq	%rax, %xmm7
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x24748948; BYTE $0x10               // movq	%rsi, 16(%rsp)
+	WORD $0x894c; BYTE $0xee                   // movq	%r13, %rsi
+	LONG $0x24448948; BYTE $0x60               // movq	%rax, 96(%rsp)
+	LONG $0x05e6c148                           // salq	$5, %rsi
+	LONG $0x6ef941c4; BYTE $0xc7               // vmovq	%r15, %xmm8
+	WORD $0x8948; BYTE $0xf9                   // movq	%rdi, %rcx
+	QUAD $0x00000000ad048d4a                   // leaq	0(,%r13,4), %rax
+	WORD $0x894c; BYTE $0xff                   // movq	%r15, %rdi
+	WORD $0x894d; BYTE $0xf7                   // movq	%r14, %r15
+	QUAD $0x000000982484c748; LONG $0x00000000 // movq	$0, 152(%rsp)
+	LONG $0x6ef9e1c4; BYTE $0xd0               // vmovq	%rax, %xmm2
+	QUAD $0x00000000ed048d4a                   // leaq	0(,%r13,8), %rax
+	LONG $0x6ef9e1c4; BYTE $0xc8               // vmovq	%rax, %xmm1
+	LONG $0x030c8d4c                           // leaq	(%rbx,%rax), %r9
+	LONG $0x2d448d4b; BYTE $0x00               // leaq	(%r13,%r13), %rax
+	QUAD $0x000000b024848948                   // movq	%rax, 176(%rsp)
+	WORD $0x014c; BYTE $0xe8                   // addq	%r13, %rax
+	LONG $0x7ef9e1c4; BYTE $0xca               // vmovq	%xmm1, %rdx
+	LONG $0xea6ff9c5                           // vmovdqa	%xmm2, %xmm5
+	QUAD $0x000000a824848948                   // movq	%rax, 168(%rsp)
+	LONG $0xf8458d49                           // leaq	-8(%r13), %rax
+	LONG $0x11048d4d                           // leaq	(%r9,%rdx), %r8
+	LONG $0x08fde162; WORD $0xd16f             // vmovdqa64	%xmm1, %xmm18
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	LONG $0x10248d4d                           // leaq	(%r8,%rdx), %r12
+	WORD $0xd231                               // xorl	%edx, %edx
+	QUAD $0x00000008c5048d48                   // leaq	8(,%rax,8), %rax
+	LONG $0x24448948; BYTE $0x48               // movq	%rax, 72(%rsp)
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+
+BB0_29:
+	LONG $0x24748b48; BYTE $0x68   // movq	104(%rsp), %rsi
+	LONG $0x245c8b4c; BYTE $0x60   // movq	96(%rsp), %r11
+	LONG $0x32348d4c               // leaq	(%rdx,%rsi), %r14
+	QUAD $0x000000a024b48b48       // movq	160(%rsp), %rsi
+	LONG $0x2474894c; BYTE $0x40   // movq	%r14, 64(%rsp)
+	LONG $0x7ef9c1c4; BYTE $0xfe   // vmovq	%xmm7, %r14
+	WORD $0x294d; BYTE $0xf3       // subq	%r14, %r11
+	WORD $0x3145; BYTE $0xf6       // xorl	%r14d, %r14d
+	QUAD $0x00000090249c894c       // movq	%r11, 144(%rsp)
+	WORD $0x8949; BYTE $0xcb       // movq	%rcx, %r11
+	WORD $0x2949; BYTE $0xd3       // subq	%rdx, %r11
+	LONG $0x245c894c; BYTE $0x58   // movq	%r11, 88(%rsp)
+	WORD $0x8949; BYTE $0xfb       // movq	%rdi, %r11
+	WORD $0x2949; BYTE $0xd3       // subq	%rdx, %r11
+	LONG $0x247c8348; WORD $0x0068 // cmpq	$0, 104(%rsp)
+	LONG $0x245c894c; BYTE $0x50   // movq	%r11, 80(%rsp)
+	JLE  BB0_40
+	LONG $0x247c894c; BYTE $0x38   // movq	%r15, 56(%rsp)
+	QUAD $0x00000090249c8b4c       // movq	144(%rsp), %r11
+	LONG $0x244c8948; BYTE $0x30   // movq	%rcx, 48(%rsp)
+	LONG $0x247c8948; BYTE $0x28   // movq	%rdi, 40(%rsp)
+	LONG $0x24448948; BYTE $0x20   // movq	%rax, 32(%rsp)
+
+BB0_39:
+	LONG $0x07fd8349               // cmpq	$7, %r13
+	JLE  BB0_58
+	LONG $0x573141c4; BYTE $0xc9   // vxorpd	%xmm9, %xmm9, %xmm9
+	LONG $0x000008b8; BYTE $0x00   // movl	$8, %eax
+	LONG $0x48fdd162; WORD $0xd128 // vmovapd	%zmm9, %zmm2
+	LONG $0x48fdd162; WORD $0xd928 // vmovapd	%zmm9, %zmm3
+	LONG $0x48fdd162; WORD $0xe128 // vmovapd	%zmm9, %zmm4
+
+BB0_31:
+	QUAD $0xffc6441048fdf162     // vmovupd	-64(%rsi,%rax,8), %zmm0
+	QUAD $0xffc264b848fdd262     // vfmadd231pd	-64(%r10,%rax,8), %zmm0, %zmm4
+	QUAD $0xffc15cb848fdd262     // vfmadd231pd	-64(%r9,%rax,8), %zmm0, %zmm3
+	QUAD $0xffc054b848fdd262     // vfmadd231pd	-64(%r8,%rax,8), %zmm0, %zmm2
+	QUAD $0xffc44cb848fd5262     // vfmadd231pd	-64(%r12,%rax,8), %zmm0, %zmm9
+	LONG $0x08c08348             // addq	$8, %rax
+	WORD $0x394c; BYTE $0xe8     // cmpq	%r13, %rax
+	JLE  BB0_31
+	LONG $0x24548b48; BYTE $0x48 // movq	72(%rsp), %rdx
+
+BB0_30:
+	LONG $0x48fdf362; WORD $0xe01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm0
+	LONG $0xe458fdc5                           // vaddpd	%ymm4, %ymm0, %ymm4
+	LONG $0x28fdf362; WORD $0xe019; BYTE $0x01 // vextractf64x2	$0x1, %ymm4, %xmm0
+	LONG $0xc458f9c5                           // vaddpd	%xmm4, %xmm0, %xmm0
+	LONG $0xe010fbc5                           // vmovsd	%xmm0, %xmm0, %xmm4
+	LONG $0xc015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xe058dbc5                           // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0x48fdf362; WORD $0xd81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm3, %ymm0
+	LONG $0xdb58fdc5                           // vaddpd	%ymm3, %ymm0, %ymm3
+	LONG $0x28fdf362; WORD $0xd819; BYTE $0x01 // vextractf64x2	$0x1, %ymm3, %xmm0
+	LONG $0xc358f9c5                           // vaddpd	%xmm3, %xmm0, %xmm0
+	LONG $0xd810fbc5                           // vmovsd	%xmm0, %xmm0, %xmm3
+	LONG $0xc015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xd858e3c5                           // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0x48fdf362; WORD $0xd01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm0
+	LONG $0xd258fdc5                           // vaddpd	%ymm2, %ymm0, %ymm2
+	LONG $0x28fdf362; WORD $0xd019; BYTE $0x01 // vextractf64x2	$0x1, %ymm2, %xmm0
+	LONG $0xc258f9c5                           // vaddpd	%xmm2, %xmm0, %xmm0
+	LONG $0xd010fbc5                           // vmovsd	%xmm0, %xmm0, %xmm2
+	LONG $0xc015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xd058ebc5                           // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0x48fd7362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm9, %ymm0
+	LONG $0x587dc1c4; BYTE $0xc1               // vaddpd	%ymm9, %ymm0, %ymm0
+	LONG $0x28fdd362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm9
+	LONG $0xc85831c5                           // vaddpd	%xmm0, %xmm9, %xmm9
+	LONG $0xc81133c5                           // vmovsd	%xmm9, %xmm9, %xmm0
+	LONG $0x153141c4; BYTE $0xc9               // vunpckhpd	%xmm9, %xmm9, %xmm9
+	LONG $0x587bc1c4; BYTE $0xc1               // vaddsd	%xmm9, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd5                   // cmpq	%rdx, %r13
+	JLE  BB0_32
+	WORD $0x894d; BYTE $0xef                   // movq	%r13, %r15
+	QUAD $0x0000008824948948                   // movq	%rdx, 136(%rsp)
+	WORD $0x2949; BYTE $0xd7                   // subq	%rdx, %r15
+	LONG $0xff478d49                           // leaq	-1(%r15), %rax
+	QUAD $0x0000009024bc894c                   // movq	%r15, 144(%rsp)
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_59
+	QUAD $0x0000009824848b48                   // movq	152(%rsp), %rax
+	QUAD $0x000000a024bc8b48                   // movq	160(%rsp), %rdi
+	LONG $0x03efc149                           // shrq	$3, %r15
+	QUAD $0x0000008024948948                   // movq	%rdx, 128(%rsp)
+	LONG $0x06e7c149                           // salq	$6, %r15
+	LONG $0x24748948; BYTE $0x78               // movq	%rsi, 120(%rsp)
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x245c8948; BYTE $0x70               // movq	%rbx, 112(%rsp)
+	LONG $0xc3048d48                           // leaq	(%rbx,%rax,8), %rax
+	LONG $0x08fde162; WORD $0xd86e             // vmovq	%rax, %xmm19
+	LONG $0x32048d4a                           // leaq	(%rdx,%r14), %rax
+	LONG $0xc70c8d48                           // leaq	(%rdi,%rax,8), %rcx
+	QUAD $0x000000b824848b48                   // movq	184(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0xc3048d48                           // leaq	(%rbx,%rax,8), %rax
+	LONG $0x08fde162; WORD $0xc06e             // vmovq	%rax, %xmm16
+	QUAD $0x000000b024848b48                   // movq	176(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0xc33c8d48                           // leaq	(%rbx,%rax,8), %rdi
+	QUAD $0x000000a824848b48                   // movq	168(%rsp), %rax
+	WORD $0x8948; BYTE $0xfe                   // movq	%rdi, %rsi
+	LONG $0x08fde162; WORD $0xc77e             // vmovq	%xmm16, %rdi
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0x894c; BYTE $0xfa                   // movq	%r15, %rdx
+	LONG $0x08fdc162; WORD $0xdf7e             // vmovq	%xmm19, %r15
+	LONG $0xc3048d48                           // leaq	(%rbx,%rax,8), %rax
+	WORD $0x894c; BYTE $0xc3                   // movq	%r8, %rbx
+	LONG $0x6ef961c4; BYTE $0xf0               // vmovq	%rax, %xmm14
+	WORD $0xc031                               // xorl	%eax, %eax
+	LONG $0x7ef941c4; BYTE $0xf0               // vmovq	%xmm14, %r8
+
+BB0_34:
+	LONG $0x48fd7162; WORD $0x1410; BYTE $0x01 // vmovupd	(%rcx,%rax), %zmm10
+	LONG $0x48ad5162; WORD $0x1c59; BYTE $0x07 // vmulpd	(%r15,%rax), %zmm10, %zmm11
+	LONG $0x28fd5362; WORD $0xd919; BYTE $0x01 // vextractf64x2	$1, %ymm11, %xmm9
+	LONG $0x585bc1c4; BYTE $0xe3               // vaddsd	%xmm11, %xmm4, %xmm4
+	LONG $0x152141c4; BYTE $0xeb               // vunpckhpd	%xmm11, %xmm11, %xmm13
+	LONG $0x28a55362; WORD $0xe303; BYTE $0x03 // valignq	$3, %ymm11, %ymm11, %ymm12
+	LONG $0x585bc1c4; BYTE $0xe5               // vaddsd	%xmm13, %xmm4, %xmm4
+	LONG $0x585bc1c4; BYTE $0xe1               // vaddsd	%xmm9, %xmm4, %xmm4
+	LONG $0x48fd5362; WORD $0xd91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm11, %ymm9
+	LONG $0x153141c4; BYTE $0xd9               // vunpckhpd	%xmm9, %xmm9, %xmm11
+	LONG $0x585bc1c4; BYTE $0xe4               // vaddsd	%xmm12, %xmm4, %xmm4
+	LONG $0x585bc1c4; BYTE $0xe1               // vaddsd	%xmm9, %xmm4, %xmm4
+	LONG $0x585bc1c4; BYTE $0xe3               // vaddsd	%xmm11, %xmm4, %xmm4
+	LONG $0x28fd5362; WORD $0xcb19; BYTE $0x01 // vextractf64x2	$1, %ymm9, %xmm11
+	LONG $0x28b55362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm9, %ymm9, %ymm9
+	LONG $0x585bc1c4; BYTE $0xe3               // vaddsd	%xmm11, %xmm4, %xmm4
+	LONG $0x48ad7162; WORD $0x1c59; BYTE $0x07 // vmulpd	(%rdi,%rax), %zmm10, %zmm11
+	LONG $0x585bc1c4; BYTE $0xe1               // vaddsd	%xmm9, %xmm4, %xmm4
+	LONG $0x28fd5362; WORD $0xd919; BYTE $0x01 // vextractf64x2	$1, %ymm11, %xmm9
+	LONG $0x5863c1c4; BYTE $0xdb               // vaddsd	%xmm11, %xmm3, %xmm3
+	LONG $0x152141c4; BYTE $0xeb               // vunpckhpd	%xmm11, %xmm11, %xmm13
+	LONG $0x28a55362; WORD $0xe303; BYTE $0x03 // valignq	$3, %ymm11, %ymm11, %ymm12
+	LONG $0x5863c1c4; BYTE $0xdd               // vaddsd	%xmm13, %xmm3, %xmm3
+	LONG $0x5863c1c4; BYTE $0xd9               // vaddsd	%xmm9, %xmm3, %xmm3
+	LONG $0x48fd5362; WORD $0xd91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm11, %ymm9
+	LONG $0x153141c4; BYTE $0xd9               // vunpckhpd	%xmm9, %xmm9, %xmm11
+	LONG $0x5863c1c4; BYTE $0xdc               // vaddsd	%xmm12, %xmm3, %xmm3
+	LONG $0x5863c1c4; BYTE $0xd9               // vaddsd	%xmm9, %xmm3, %xmm3
+	LONG $0x5863c1c4; BYTE $0xdb               // vaddsd	%xmm11, %xmm3, %xmm3
+	LONG $0x28fd5362; WORD $0xcb19; BYTE $0x01 // vextractf64x2	$1, %ymm9, %xmm11
+	LONG $0x28b55362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm9, %ymm9, %ymm9
+	LONG $0x5863c1c4; BYTE $0xdb               // vaddsd	%xmm11, %xmm3, %xmm3
+	LONG $0x5863c1c4; BYTE $0xd9               // vaddsd	%xmm9, %xmm3, %xmm3
+	LONG $0x48ad7162; WORD $0x0c59; BYTE $0x06 // vmulpd	(%rsi,%rax), %zmm10, %zmm9
+	LONG $0x48ad5162; WORD $0x1459; BYTE $0x00 // vmulpd	(%r8,%rax), %zmm10, %zmm10
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x28b55362; WORD $0xd903; BYTE $0x03 // valignq	$3, %ymm9, %ymm9, %ymm11
+	LONG $0x586bc1c4; BYTE $0xd1               // vaddsd	%xmm9, %xmm2, %xmm2
+	LONG $0x153141c4; BYTE $0xe1               // vunpckhpd	%xmm9, %xmm9, %xmm12
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	LONG $0x586bc1c4; BYTE $0xd4               // vaddsd	%xmm12, %xmm2, %xmm2
+	LONG $0x28fd5362; WORD $0xcc19; BYTE $0x01 // vextractf64x2	$1, %ymm9, %xmm12
+	LONG $0x48fd5362; WORD $0xc91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm9, %ymm9
+	LONG $0x586bc1c4; BYTE $0xd4               // vaddsd	%xmm12, %xmm2, %xmm2
+	LONG $0x586bc1c4; BYTE $0xd3               // vaddsd	%xmm11, %xmm2, %xmm2
+	LONG $0x153141c4; BYTE $0xd9               // vunpckhpd	%xmm9, %xmm9, %xmm11
+	LONG $0x586bc1c4; BYTE $0xd1               // vaddsd	%xmm9, %xmm2, %xmm2
+	LONG $0x586bc1c4; BYTE $0xd3               // vaddsd	%xmm11, %xmm2, %xmm2
+	LONG $0x28fd5362; WORD $0xcb19; BYTE $0x01 // vextractf64x2	$1, %ymm9, %xmm11
+	LONG $0x28b55362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm9, %ymm9, %ymm9
+	LONG $0x586bc1c4; BYTE $0xd3               // vaddsd	%xmm11, %xmm2, %xmm2
+	LONG $0x152941c4; BYTE $0xda               // vunpckhpd	%xmm10, %xmm10, %xmm11
+	LONG $0x587bc1c4; BYTE $0xc3               // vaddsd	%xmm11, %xmm0, %xmm0
+	LONG $0x28fd5362; WORD $0xd319; BYTE $0x01 // vextractf64x2	$1, %ymm10, %xmm11
+	LONG $0x586bc1c4; BYTE $0xd1               // vaddsd	%xmm9, %xmm2, %xmm2
+	LONG $0x28ad5362; WORD $0xca03; BYTE $0x03 // valignq	$3, %ymm10, %ymm10, %ymm9
+	LONG $0x48fd5362; WORD $0xd21b; BYTE $0x01 // vextractf64x4	$0x1, %zmm10, %ymm10
+	LONG $0x587bc1c4; BYTE $0xc3               // vaddsd	%xmm11, %xmm0, %xmm0
+	LONG $0x587bc1c4; BYTE $0xc1               // vaddsd	%xmm9, %xmm0, %xmm0
+	LONG $0x152941c4; BYTE $0xca               // vunpckhpd	%xmm10, %xmm10, %xmm9
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	LONG $0x587bc1c4; BYTE $0xc1               // vaddsd	%xmm9, %xmm0, %xmm0
+	LONG $0x28fd5362; WORD $0xd119; BYTE $0x01 // vextractf64x2	$1, %ymm10, %xmm9
+	LONG $0x28ad5362; WORD $0xd203; BYTE $0x03 // valignq	$3, %ymm10, %ymm10, %ymm10
+	LONG $0x587bc1c4; BYTE $0xc1               // vaddsd	%xmm9, %xmm0, %xmm0
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JNE  BB0_34
+	QUAD $0x0000009024bc8b48                   // movq	144(%rsp), %rdi
+	QUAD $0x0000008024948b48                   // movq	128(%rsp), %rdx
+	WORD $0x8949; BYTE $0xd8                   // movq	%rbx, %r8
+	LONG $0x24748b48; BYTE $0x78               // movq	120(%rsp), %rsi
+	LONG $0x245c8b48; BYTE $0x70               // movq	112(%rsp), %rbx
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe783; BYTE $0x07                   // andl	$7, %edi
+	JE   BB0_32
+
+BB0_33:
+	QUAD $0x0000009024bc8b48                   // movq	144(%rsp), %rdi
+	WORD $0x2948; BYTE $0xc7                   // subq	%rax, %rdi
+	LONG $0xff7f8d4c                           // leaq	-1(%rdi), %r15
+	LONG $0x02ff8349                           // cmpq	$2, %r15
+	JBE  BB0_37
+	QUAD $0x00000088248c8b48                   // movq	136(%rsp), %rcx
+	QUAD $0x000000a024bc8b4c                   // movq	160(%rsp), %r15
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x31048d4a                           // leaq	(%rcx,%r14), %rax
+	LONG $0x107d41c4; WORD $0xc70c             // vmovupd	(%r15,%rax,8), %ymm9
+	QUAD $0x0000009824848b48                   // movq	152(%rsp), %rax
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x1c5935c5; BYTE $0xc3               // vmulpd	(%rbx,%rax,8), %ymm9, %ymm11
+	QUAD $0x000000b824848b48                   // movq	184(%rsp), %rax
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x28fd5362; WORD $0xda19; BYTE $0x01 // vextractf64x2	$1, %ymm11, %xmm10
+	LONG $0x585bc1c4; BYTE $0xe3               // vaddsd	%xmm11, %xmm4, %xmm4
+	LONG $0x152141c4; BYTE $0xe3               // vunpckhpd	%xmm11, %xmm11, %xmm12
+	LONG $0x28a55362; WORD $0xdb03; BYTE $0x03 // valignq	$3, %ymm11, %ymm11, %ymm11
+	LONG $0x585bc1c4; BYTE $0xe4               // vaddsd	%xmm12, %xmm4, %xmm4
+	LONG $0x585bc1c4; BYTE $0xe2               // vaddsd	%xmm10, %xmm4, %xmm4
+	LONG $0x585bc1c4; BYTE $0xe3               // vaddsd	%xmm11, %xmm4, %xmm4
+	LONG $0x1c5935c5; BYTE $0xc3               // vmulpd	(%rbx,%rax,8), %ymm9, %ymm11
+	QUAD $0x000000b024848b48                   // movq	176(%rsp), %rax
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x28fd5362; WORD $0xda19; BYTE $0x01 // vextractf64x2	$1, %ymm11, %xmm10
+	LONG $0x5863c1c4; BYTE $0xdb               // vaddsd	%xmm11, %xmm3, %xmm3
+	LONG $0x152141c4; BYTE $0xe3               // vunpckhpd	%xmm11, %xmm11, %xmm12
+	LONG $0x28a55362; WORD $0xdb03; BYTE $0x03 // valignq	$3, %ymm11, %ymm11, %ymm11
+	LONG $0x5863c1c4; BYTE $0xdc               // vaddsd	%xmm12, %xmm3, %xmm3
+	LONG $0x5863c1c4; BYTE $0xda               // vaddsd	%xmm10, %xmm3, %xmm3
+	LONG $0x5863c1c4; BYTE $0xdb               // vaddsd	%xmm11, %xmm3, %xmm3
+	LONG $0x1c5935c5; BYTE $0xc3               // vmulpd	(%rbx,%rax,8), %ymm9, %ymm11
+	QUAD $0x000000a824848b48                   // movq	168(%rsp), %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	LONG $0x0c5935c5; BYTE $0xcb               // vmulpd	(%rbx,%rcx,8), %ymm9, %ymm9
+	LONG $0xfce08348                           // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe783; BYTE $0x03                   // andl	$3, %edi
+	LONG $0x28fd5362; WORD $0xda19; BYTE $0x01 // vextractf64x2	$1, %ymm11, %xmm10
+	LONG $0x586bc1c4; BYTE $0xd3               // vaddsd	%xmm11, %xmm2, %xmm2
+	LONG $0x152141c4; BYTE $0xe3               // vunpckhpd	%xmm11, %xmm11, %xmm12
+	LONG $0x28a55362; WORD $0xdb03; BYTE $0x03 // valignq	$3, %ymm11, %ymm11, %ymm11
+	LONG $0x586bc1c4; BYTE $0xd4               // vaddsd	%xmm12, %xmm2, %xmm2
+	LONG $0x587bc1c4; BYTE $0xc1               // vaddsd	%xmm9, %xmm0, %xmm0
+	LONG $0x586bc1c4; BYTE $0xd2               // vaddsd	%xmm10, %xmm2, %xmm2
+	LONG $0x28fd5362; WORD $0xca19; BYTE $0x01 // vextractf64x2	$1, %ymm9, %xmm10
+	LONG $0x586bc1c4; BYTE $0xd3               // vaddsd	%xmm11, %xmm2, %xmm2
+	LONG $0x153141c4; BYTE $0xd9               // vunpckhpd	%xmm9, %xmm9, %xmm11
+	LONG $0x28b55362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm9, %ymm9, %ymm9
+	LONG $0x587bc1c4; BYTE $0xc3               // vaddsd	%xmm11, %xmm0, %xmm0
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	LONG $0x587bc1c4; BYTE $0xc1               // vaddsd	%xmm9, %xmm0, %xmm0
+	JE   BB0_32
+
+BB0_37:
+	QUAD $0x000000a024bc8b48       // movq	160(%rsp), %rdi
+	QUAD $0x0000009824bc8b4c       // movq	152(%rsp), %r15
+	LONG $0x16048d49               // leaq	(%r14,%rdx), %rax
+	QUAD $0x000000b0248c8b48       // movq	176(%rsp), %rcx
+	LONG $0x0c10fbc5; BYTE $0xc7   // vmovsd	(%rdi,%rax,8), %xmm1
+	LONG $0x17048d49               // leaq	(%r15,%rdx), %rax
+	LONG $0xb9f1e2c4; WORD $0xc324 // vfmadd231sd	(%rbx,%rax,8), %xmm1, %xmm4
+	QUAD $0x000000b824848b48       // movq	184(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb9f1e2c4; WORD $0xc31c // vfmadd231sd	(%rbx,%rax,8), %xmm1, %xmm3
+	LONG $0x11048d48               // leaq	(%rcx,%rdx), %rax
+	LONG $0xb9f1e2c4; WORD $0xc314 // vfmadd231sd	(%rbx,%rax,8), %xmm1, %xmm2
+	QUAD $0x000000a824848b48       // movq	168(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb9f1e2c4; WORD $0xc304 // vfmadd231sd	(%rbx,%rax,8), %xmm1, %xmm0
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5       // cmpq	%rax, %r13
+	JLE  BB0_32
+	LONG $0x060c8d49               // leaq	(%r14,%rax), %rcx
+	LONG $0x02c28348               // addq	$2, %rdx
+	LONG $0x0c10fbc5; BYTE $0xcf   // vmovsd	(%rdi,%rcx,8), %xmm1
+	LONG $0x070c8d49               // leaq	(%r15,%rax), %rcx
+	LONG $0xb9f1e2c4; WORD $0xcb24 // vfmadd231sd	(%rbx,%rcx,8), %xmm1, %xmm4
+	QUAD $0x000000b8248c8b48       // movq	184(%rsp), %rcx
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0xb9f1e2c4; WORD $0xcb1c // vfmadd231sd	(%rbx,%rcx,8), %xmm1, %xmm3
+	QUAD $0x000000b0248c8b48       // movq	176(%rsp), %rcx
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0xb9f1e2c4; WORD $0xcb14 // vfmadd231sd	(%rbx,%rcx,8), %xmm1, %xmm2
+	QUAD $0x000000a8248c8b48       // movq	168(%rsp), %rcx
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	LONG $0xb9f1e2c4; WORD $0xc304 // vfmadd231sd	(%rbx,%rax,8), %xmm1, %xmm0
+	WORD $0x3949; BYTE $0xd5       // cmpq	%rdx, %r13
+	JLE  BB0_32
+	LONG $0x16048d49               // leaq	(%r14,%rdx), %rax
+	QUAD $0x000000b8248c8b48       // movq	184(%rsp), %rcx
+	LONG $0x0c10fbc5; BYTE $0xc7   // vmovsd	(%rdi,%rax,8), %xmm1
+	LONG $0x17048d49               // leaq	(%r15,%rdx), %rax
+	LONG $0xb9f1e2c4; WORD $0xc324 // vfmadd231sd	(%rbx,%rax,8), %xmm1, %xmm4
+	LONG $0x11048d48               // leaq	(%rcx,%rdx), %rax
+	QUAD $0x000000b0248c8b48       // movq	176(%rsp), %rcx
+	LONG $0xb9f1e2c4; WORD $0xc31c // vfmadd231sd	(%rbx,%rax,8), %xmm1, %xmm3
+	LONG $0x11048d48               // leaq	(%rcx,%rdx), %rax
+	QUAD $0x000000a8248c8b48       // movq	168(%rsp), %rcx
+	LONG $0xb9f1e2c4; WORD $0xc314 // vfmadd231sd	(%rbx,%rax,8), %xmm1, %xmm2
+	WORD $0x0148; BYTE $0xca       // addq	%rcx, %rdx
+	LONG $0xb9f1e2c4; WORD $0xd304 // vfmadd231sd	(%rbx,%rdx,8), %xmm1, %xmm0
+
+BB0_32:
+	LONG $0x24448b48; BYTE $0x68   // movq	104(%rsp), %rax
+	LONG $0x117bc1c4; BYTE $0x23   // vmovsd	%xmm4, (%r11)
+	WORD $0x014d; BYTE $0xee       // addq	%r13, %r14
+	LONG $0x117bc1c4; WORD $0xc31c // vmovsd	%xmm3, (%r11,%rax,8)
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	LONG $0x117bc1c4; WORD $0xc314 // vmovsd	%xmm2, (%r11,%rax,8)
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x117bc1c4; WORD $0xc304 // vmovsd	%xmm0, (%r11,%rax,8)
+	LONG $0x08fde162; WORD $0xd07e // vmovq	%xmm18, %rax
+	LONG $0x08c38349               // addq	$8, %r11
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+	WORD $0x3949; BYTE $0xc3       // cmpq	%rax, %r11
+	JNE  BB0_39
+	LONG $0x247c8b4c; BYTE $0x38   // movq	56(%rsp), %r15
+	LONG $0x244c8b48; BYTE $0x30   // movq	48(%rsp), %rcx
+	LONG $0x247c8b48; BYTE $0x28   // movq	40(%rsp), %rdi
+	LONG $0x24448b48; BYTE $0x20   // movq	32(%rsp), %rax
+
+BB0_40:
+	LONG $0x24548b48; BYTE $0x40 // movq	64(%rsp), %rdx
+	LONG $0x24748b4c; BYTE $0x10 // movq	16(%rsp), %r14
+	WORD $0x0149; BYTE $0xc2     // addq	%rax, %r10
+	WORD $0x0149; BYTE $0xc1     // addq	%rax, %r9
+	LONG $0x7ef961c4; BYTE $0xc6 // vmovq	%xmm8, %rsi
+	LONG $0x04c78349             // addq	$4, %r15
+	WORD $0x0149; BYTE $0xc0     // addq	%rax, %r8
+	WORD $0x0149; BYTE $0xc4     // addq	%rax, %r12
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	LONG $0x7ef9e1c4; BYTE $0xf6 // vmovq	%xmm6, %rsi
+	LONG $0x2474014c; BYTE $0x60 // addq	%r14, 96(%rsp)
+	WORD $0x0148; BYTE $0xf1     // addq	%rsi, %rcx
+	LONG $0x7ef9c1c4; BYTE $0xee // vmovq	%xmm5, %r14
+	WORD $0x0148; BYTE $0xf7     // addq	%rsi, %rdi
+	QUAD $0x0000009824b4014c     // addq	%r14, 152(%rsp)
+	QUAD $0x000000b824b4014c     // addq	%r14, 184(%rsp)
+	QUAD $0x000000b024b4014c     // addq	%r14, 176(%rsp)
+	QUAD $0x000000a824b4014c     // addq	%r14, 168(%rsp)
+	LONG $0x247c394c; BYTE $0x18 // cmpq	%r15, 24(%rsp)
+	JG   BB0_29
+	LONG $0x24448b48; BYTE $0x18 // movq	24(%rsp), %rax
+	LONG $0x245c8b4c; BYTE $0x08 // movq	8(%rsp), %r11
+	LONG $0x04e88348             // subq	$4, %rax
+	LONG $0x02e8c148             // shrq	$2, %rax
+	QUAD $0x0000000485048d48     // leaq	4(,%rax,4), %rax
+
+BB0_4:
+	LONG $0x24443948; BYTE $0x18 // cmpq	%rax, 24(%rsp)
+	JLE  BB0_102
+	LONG $0x24748b48; BYTE $0x68 // movq	104(%rsp), %rsi
+	WORD $0x8548; BYTE $0xf6     // testq	%rsi, %rsi
+	JLE  BB0_102
+	WORD $0x8949; BYTE $0xf0     // movq	%rsi, %r8
+	LONG $0xf84d8d49             // leaq	-8(%r13), %rcx
+	WORD $0x894d; BYTE $0xe9     // movq	%r13, %r9
+	WORD $0x8949; BYTE $0xc6     // movq	%rax, %r14
+	LONG $0xc0af0f4c             // imulq	%rax, %r8
+	QUAD $0x00000000f5148d48     // leaq	0(,%rsi,8), %rdx
+	LONG $0x03e9c148             // shrq	$3, %rcx
+	QUAD $0x00000090249c894c     // movq	%r11, 144(%rsp)
+	LONG $0xc8af0f4c             // imulq	%rax, %r9
+	QUAD $0x00000008cd0c8d48     // leaq	8(,%rcx,8), %rcx
+	QUAD $0x000000a024a48b4c     // movq	160(%rsp), %r12
+	LONG $0x6ef961c4; BYTE $0xfa // vmovq	%rdx, %xmm15
+	QUAD $0x000000a8248c8948     // movq	%rcx, 168(%rsp)
+	WORD $0x014c; BYTE $0xc6     // addq	%r8, %rsi
+	LONG $0xf33c8d49             // leaq	(%r11,%rsi,8), %rdi
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	QUAD $0x000000b024bc8948     // movq	%rdi, 176(%rsp)
+	QUAD $0x00000000ed3c8d4a     // leaq	0(,%r13,8), %rdi
+	LONG $0x6ef9e1c4; BYTE $0xe7 // vmovq	%rdi, %xmm4
+	LONG $0xcb3c8d4a             // leaq	(%rbx,%r9,8), %rdi
+	LONG $0xf46f79c5             // vmovdqa	%xmm4, %xmm14
+
+BB0_52:
+	QUAD $0x0000009024b48b48 // movq	144(%rsp), %rsi
+	QUAD $0x000000a024b4894c // movq	%r14, 160(%rsp)
+	WORD $0x3145; BYTE $0xd2 // xorl	%r10d, %r10d
+	LONG $0xf57f79c5         // vmovdqa	%xmm14, %xmm5
+	QUAD $0x0000009824848948 // movq	%rax, 152(%rsp)
+	LONG $0xc61c8d4e         // leaq	(%rsi,%r8,8), %r11
+	WORD $0x894c; BYTE $0xe6 // movq	%r12, %rsi
+
+BB0_42:
+	LONG $0x07fd8349             // cmpq	$7, %r13
+	JLE  BB0_60
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_44:
+	QUAD $0xffc7741048fdf162 // vmovupd	-64(%rdi,%rax,8), %zmm6
+	QUAD $0xffc644b848cdf262 // vfmadd231pd	-64(%rsi,%rax,8), %zmm6, %zmm0
+	LONG $0x08c08348         // addq	$8, %rax
+	WORD $0x394c; BYTE $0xe8 // cmpq	%r13, %rax
+	JLE  BB0_44
+	QUAD $0x000000a824948b48 // movq	168(%rsp), %rdx
+
+BB0_43:
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f5c5                           // vaddpd	%ymm0, %ymm1, %ymm0
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm1
+	LONG $0xc858f1c5                           // vaddpd	%xmm0, %xmm1, %xmm1
+	LONG $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd5                   // cmpq	%rdx, %r13
+	JLE  BB0_45
+	WORD $0x894d; BYTE $0xe8                   // movq	%r13, %r8
+	QUAD $0x000000b824948948                   // movq	%rdx, 184(%rsp)
+	WORD $0x2949; BYTE $0xd0                   // subq	%rdx, %r8
+	LONG $0xff408d49                           // leaq	-1(%r8), %rax
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_61
+	LONG $0x0a048d4a                           // leaq	(%rdx,%r9), %rax
+	LONG $0xc3348d4c                           // leaq	(%rbx,%rax,8), %r14
+	LONG $0x12048d4a                           // leaq	(%rdx,%r10), %rax
+	LONG $0xc43c8d4d                           // leaq	(%r12,%rax,8), %r15
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_47:
+	LONG $0x48fdd162; WORD $0x3c10; BYTE $0x07 // vmovupd	(%r15,%rax), %zmm7
+	LONG $0x48c5d162; WORD $0x1459; BYTE $0x06 // vmulpd	(%r14,%rax), %zmm7, %zmm2
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x28edf362; WORD $0xda03; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm3
+	LONG $0xc058ebc5                           // vaddsd	%xmm0, %xmm2, %xmm0
+	LONG $0xe215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm4
+	LONG $0x48fdf362; WORD $0xd11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm1
+	LONG $0xe058dbc5                           // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0x28fdf362; WORD $0xd019; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm0
+	LONG $0xc458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm0
+	LONG $0xd858e3c5                           // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm0
+	LONG $0xd358f3c5                           // vaddsd	%xmm3, %xmm1, %xmm2
+	LONG $0xd258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm2
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm0
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JNE  BB0_47
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x07c0f641                           // testb	$7, %r8b
+	JE   BB0_45
+
+BB0_46:
+	WORD $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG $0xff488d49                           // leaq	-1(%r8), %rcx
+	LONG $0x02f98348                           // cmpq	$2, %rcx
+	JBE  BB0_50
+	QUAD $0x000000b8248c8b48                   // movq	184(%rsp), %rcx
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x10348d4e                           // leaq	(%rax,%r10), %r14
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+	LONG $0x0c10fdc5; BYTE $0xc3               // vmovupd	(%rbx,%rax,8), %ymm1
+	LONG $0x597581c4; WORD $0xf40c             // vmulpd	(%r12,%r14,8), %ymm1, %ymm1
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	LONG $0xfce08348                           // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x03e08341                           // andl	$3, %r8d
+	LONG $0x28fdf362; WORD $0xca19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm2
+	LONG $0xc058f3c5                           // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xd915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm3
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc358fbc5                           // vaddsd	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	JE   BB0_45
+
+BB0_50:
+	LONG $0x12048d4a               // leaq	(%rdx,%r10), %rax
+	LONG $0x0a048d4e               // leaq	(%rdx,%r9), %r8
+	LONG $0x107ba1c4; WORD $0xc33c // vmovsd	(%rbx,%r8,8), %xmm7
+	LONG $0xb9c1c2c4; WORD $0xc404 // vfmadd231sd	(%r12,%rax,8), %xmm7, %xmm0
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x394c; BYTE $0xe8       // cmpq	%r13, %rax
+	JGE  BB0_45
+	LONG $0x08048d4e               // leaq	(%rax,%r9), %r8
+	LONG $0x02c28348               // addq	$2, %rdx
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+	LONG $0x107ba1c4; WORD $0xc33c // vmovsd	(%rbx,%r8,8), %xmm7
+	LONG $0xb9c1c2c4; WORD $0xc404 // vfmadd231sd	(%r12,%rax,8), %xmm7, %xmm0
+	WORD $0x3949; BYTE $0xd5       // cmpq	%rdx, %r13
+	JLE  BB0_45
+	LONG $0x12048d49               // leaq	(%r10,%rdx), %rax
+	WORD $0x014c; BYTE $0xca       // addq	%r9, %rdx
+	LONG $0x107bc1c4; WORD $0xc43c // vmovsd	(%r12,%rax,8), %xmm7
+	LONG $0xb9c1e2c4; WORD $0xd304 // vfmadd231sd	(%rbx,%rdx,8), %xmm7, %xmm0
+
+BB0_45:
+	LONG $0x7ef9e1c4; BYTE $0xe8 // vmovq	%xmm5, %rax
+	LONG $0x117bc1c4; BYTE $0x03 // vmovsd	%xmm0, (%r11)
+	LONG $0x08c38349             // addq	$8, %r11
+	WORD $0x014d; BYTE $0xea     // addq	%r13, %r10
+	WORD $0x0148; BYTE $0xc6     // addq	%rax, %rsi
+	QUAD $0x000000b024848b48     // movq	176(%rsp), %rax
+	WORD $0x3949; BYTE $0xc3     // cmpq	%rax, %r11
+	JNE  BB0_42
+	LONG $0x7ef961c4; BYTE $0xf6 // vmovq	%xmm14, %rsi
+	LONG $0x7ef961c4; BYTE $0xfa // vmovq	%xmm15, %rdx
+	WORD $0x014d; BYTE $0xe9     // addq	%r13, %r9
+	QUAD $0x000000a024b48b4c     // movq	160(%rsp), %r14
+	QUAD $0x0000009824848b48     // movq	152(%rsp), %rax
+	QUAD $0x000000b024940148     // addq	%rdx, 176(%rsp)
+	WORD $0x0148; BYTE $0xf7     // addq	%rsi, %rdi
+	LONG $0x01c68349             // addq	$1, %r14
+	WORD $0x8949; BYTE $0xc0     // movq	%rax, %r8
+	LONG $0x2474394c; BYTE $0x18 // cmpq	%r14, 24(%rsp)
+	JE   BB0_102
+	LONG $0x24748b48; BYTE $0x68 // movq	104(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	JMP  BB0_52
+
+BB0_58:
+	LONG $0x573141c4; BYTE $0xc9   // vxorpd	%xmm9, %xmm9, %xmm9
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x48fdd162; WORD $0xd128 // vmovapd	%zmm9, %zmm2
+	LONG $0x48fdd162; WORD $0xd928 // vmovapd	%zmm9, %zmm3
+	LONG $0x48fdd162; WORD $0xe128 // vmovapd	%zmm9, %zmm4
+	JMP  BB0_30
+
+BB0_59:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_33
+
+BB0_60:
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xc057f9c5 // vxorpd	%xmm0, %xmm0, %xmm0
+	JMP  BB0_43
+
+BB0_61:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_46
+
+BB0_2:
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0x03fe8348                           // cmpq	$3, %rsi
+	JLE  BB0_53
+	LONG $0x04e88348                           // subq	$4, %rax
+	QUAD $0x00000000ad348d4a                   // leaq	0(,%r13,4), %rsi
+	QUAD $0x0000008024948948                   // movq	%rdx, 128(%rsp)
+	QUAD $0x000000a024948b48                   // movq	160(%rsp), %rdx
+	LONG $0x02e8c148                           // shrq	$2, %rax
+	LONG $0x6ef9e1c4; BYTE $0xde               // vmovq	%rsi, %xmm3
+	WORD $0x894c; BYTE $0xee                   // movq	%r13, %rsi
+	QUAD $0x0000009824ac894c                   // movq	%r13, 152(%rsp)
+	WORD $0x8949; BYTE $0xc1                   // movq	%rax, %r9
+	LONG $0x05e0c148                           // salq	$5, %rax
+	LONG $0x245c894c; BYTE $0x50               // movq	%r11, 80(%rsp)
+	WORD $0x8949; BYTE $0xd0                   // movq	%rdx, %r8
+	LONG $0x05e6c148                           // salq	$5, %rsi
+	LONG $0x03448d49; BYTE $0x20               // leaq	32(%r11,%rax), %rax
+	QUAD $0x00000000ed0c8d4a                   // leaq	0(,%r13,8), %rcx
+	QUAD $0x000000a82484c748; LONG $0x00000000 // movq	$0, 168(%rsp)
+	LONG $0x6ef9e1c4; BYTE $0xe0               // vmovq	%rax, %xmm4
+	LONG $0x24748948; BYTE $0x70               // movq	%rsi, 112(%rsp)
+	LONG $0xf8458d49                           // leaq	-8(%r13), %rax
+	LONG $0x2d748d4b; BYTE $0x00               // leaq	(%r13,%r13), %rsi
+	WORD $0x8949; BYTE $0xf6                   // movq	%rsi, %r14
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	LONG $0x0a3c8d48                           // leaq	(%rdx,%rcx), %rdi
+	LONG $0x244c894c; BYTE $0x58               // movq	%r9, 88(%rsp)
+	WORD $0x014d; BYTE $0xee                   // addq	%r13, %r14
+	LONG $0x08fde162; WORD $0xe36f             // vmovdqa64	%xmm3, %xmm20
+	WORD $0x8949; BYTE $0xd1                   // movq	%rdx, %r9
+	QUAD $0x000000b024b48948                   // movq	%rsi, 176(%rsp)
+	QUAD $0x00000008c5048d48                   // leaq	8(,%rax,8), %rax
+	LONG $0x0f348d48                           // leaq	(%rdi,%rcx), %rsi
+	QUAD $0x000000b824b4894c                   // movq	%r14, 184(%rsp)
+	LONG $0x08fde162; WORD $0xec6f             // vmovdqa64	%xmm4, %xmm21
+	LONG $0x24448948; BYTE $0x78               // movq	%rax, 120(%rsp)
+	WORD $0x0148; BYTE $0xf1                   // addq	%rsi, %rcx
+
+BB0_15:
+	LONG $0x07fd8349               // cmpq	$7, %r13
+	JLE  BB0_54
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b8; BYTE $0x00   // movl	$8, %eax
+	LONG $0x48fdf162; WORD $0xd128 // vmovapd	%zmm1, %zmm2
+	LONG $0x48fdf162; WORD $0xe928 // vmovapd	%zmm1, %zmm5
+	LONG $0x48fdf162; WORD $0xf128 // vmovapd	%zmm1, %zmm6
+
+BB0_7:
+	QUAD $0xffc3441048fdf162     // vmovupd	-64(%rbx,%rax,8), %zmm0
+	QUAD $0xffc074b848fdd262     // vfmadd231pd	-64(%r8,%rax,8), %zmm0, %zmm6
+	QUAD $0xffc76cb848fdf262     // vfmadd231pd	-64(%rdi,%rax,8), %zmm0, %zmm5
+	QUAD $0xffc654b848fdf262     // vfmadd231pd	-64(%rsi,%rax,8), %zmm0, %zmm2
+	QUAD $0xffc14cb848fdf262     // vfmadd231pd	-64(%rcx,%rax,8), %zmm0, %zmm1
+	LONG $0x08c08348             // addq	$8, %rax
+	WORD $0x394c; BYTE $0xe8     // cmpq	%r13, %rax
+	JLE  BB0_7
+	LONG $0x24548b48; BYTE $0x78 // movq	120(%rsp), %rdx
+
+BB0_6:
+	LONG $0x48fdf362; WORD $0xf01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm6, %ymm0
+	LONG $0x48fdf362; WORD $0xcf1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm7
+	LONG $0xc658fdc5                           // vaddpd	%ymm6, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc619; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm6
+	LONG $0xf058c9c5                           // vaddpd	%xmm0, %xmm6, %xmm6
+	LONG $0x48fdf362; WORD $0xe81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm0
+	LONG $0xc558fdc5                           // vaddpd	%ymm5, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc519; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm5
+	LONG $0xe858d1c5                           // vaddpd	%xmm0, %xmm5, %xmm5
+	LONG $0x48fdf362; WORD $0xd01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm0
+	LONG $0xc258fdc5                           // vaddpd	%ymm2, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc219; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm2
+	LONG $0xd058e9c5                           // vaddpd	%xmm0, %xmm2, %xmm2
+	LONG $0xc758f5c5                           // vaddpd	%ymm7, %ymm1, %ymm0
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm1
+	LONG $0xc958f9c5                           // vaddpd	%xmm1, %xmm0, %xmm1
+	LONG $0xc610cbc5                           // vmovsd	%xmm6, %xmm6, %xmm0
+	LONG $0xf615c9c5                           // vunpckhpd	%xmm6, %xmm6, %xmm6
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0xf510d3c5                           // vmovsd	%xmm5, %xmm5, %xmm6
+	LONG $0xed15d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xf558cbc5                           // vaddsd	%xmm5, %xmm6, %xmm6
+	LONG $0xea10ebc5                           // vmovsd	%xmm2, %xmm2, %xmm5
+	LONG $0xd215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xea58d3c5                           // vaddsd	%xmm2, %xmm5, %xmm5
+	LONG $0xd115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0xc958ebc5                           // vaddsd	%xmm1, %xmm2, %xmm1
+	LONG $0xc614f9c5                           // vunpcklpd	%xmm6, %xmm0, %xmm0
+	LONG $0xc914d1c5                           // vunpcklpd	%xmm1, %xmm5, %xmm1
+	LONG $0x187de3c4; WORD $0x01c1             // vinsertf128	$0x1, %xmm1, %ymm0, %ymm0
+	WORD $0x3949; BYTE $0xd5                   // cmpq	%rdx, %r13
+	JLE  BB0_8
+	WORD $0x894d; BYTE $0xef                   // movq	%r13, %r15
+	QUAD $0x0000009024948948                   // movq	%rdx, 144(%rsp)
+	WORD $0x2949; BYTE $0xd7                   // subq	%rdx, %r15
+	LONG $0xff478d49                           // leaq	-1(%r15), %rax
+	QUAD $0x0000008824bc894c                   // movq	%r15, 136(%rsp)
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_55
+	QUAD $0x000000a824848b48                   // movq	168(%rsp), %rax
+	LONG $0xd3148d4c                           // leaq	(%rbx,%rdx,8), %r10
+	LONG $0x03efc149                           // shrq	$3, %r15
+	LONG $0x24548948; BYTE $0x60               // movq	%rdx, 96(%rsp)
+	LONG $0x06e7c149                           // salq	$6, %r15
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0xc1348d4d                           // leaq	(%r9,%rax,8), %r14
+	QUAD $0x0000009824848b48                   // movq	152(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0xc1248d4d                           // leaq	(%r9,%rax,8), %r12
+	QUAD $0x000000b024848b48                   // movq	176(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0xc11c8d4d                           // leaq	(%r9,%rax,8), %r11
+	QUAD $0x000000b824848b48                   // movq	184(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0x894c; BYTE $0xd2                   // movq	%r10, %rdx
+	LONG $0xc1048d49                           // leaq	(%r9,%rax,8), %rax
+	LONG $0x6ef9e1c4; BYTE $0xf8               // vmovq	%rax, %xmm7
+	WORD $0xc031                               // xorl	%eax, %eax
+	LONG $0x7ef9c1c4; BYTE $0xfa               // vmovq	%xmm7, %r10
+
+BB0_10:
+	LONG $0x48fdf162; WORD $0x1410; BYTE $0x02 // vmovupd	(%rdx,%rax), %zmm2
+	LONG $0x48edd162; WORD $0x1c59; BYTE $0x06 // vmulpd	(%r14,%rax), %zmm2, %zmm3
+	LONG $0x48edd162; WORD $0x2c59; BYTE $0x03 // vmulpd	(%r11,%rax), %zmm2, %zmm5
+	LONG $0x48ed5162; WORD $0x2c59; BYTE $0x04 // vmulpd	(%r12,%rax), %zmm2, %zmm13
+	LONG $0x48edd162; WORD $0x1459; BYTE $0x02 // vmulpd	(%r10,%rax), %zmm2, %zmm2
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x28e5f362; WORD $0xe303; BYTE $0x03 // valignq	$3, %ymm3, %ymm3, %ymm4
+	LONG $0x08e5e162; WORD $0xcb15             // vunpckhpd	%xmm3, %xmm3, %xmm17
+	LONG $0x28d57362; WORD $0xdd03; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm11
+	LONG $0x08d5e162; WORD $0xd515             // vunpckhpd	%xmm5, %xmm5, %xmm18
+	LONG $0x28fd7362; WORD $0xef19; BYTE $0x01 // vextractf64x2	$1, %ymm13, %xmm7
+	LONG $0x1461c1c4; BYTE $0xcd               // vunpcklpd	%xmm13, %xmm3, %xmm1
+	LONG $0x08973162; WORD $0xe110             // vmovsd	%xmm17, %xmm13, %xmm12
+	LONG $0x28fdd362; WORD $0xd019; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm8
+	LONG $0x08d5e162; WORD $0xda14             // vunpcklpd	%xmm2, %xmm5, %xmm19
+	LONG $0x08efa162; WORD $0xc210             // vmovsd	%xmm18, %xmm2, %xmm16
+	LONG $0x28ed7362; WORD $0xfa03; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm15
+	LONG $0x28f5b362; WORD $0xcb18; BYTE $0x01 // vinsertf64x2	$0x1, %xmm19, %ymm1, %ymm1
+	LONG $0x289d3362; WORD $0xe018; BYTE $0x01 // vinsertf64x2	$0x1, %xmm16, %ymm12, %ymm12
+	LONG $0x48fdf362; WORD $0xd21b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm2
+	LONG $0x28955362; WORD $0xf503; BYTE $0x03 // valignq	$3, %ymm13, %ymm13, %ymm14
+	LONG $0xc058f5c5                           // vaddpd	%ymm0, %ymm1, %ymm0
+	LONG $0x28fdf362; WORD $0xd919; BYTE $0x01 // vextractf64x2	$1, %ymm3, %xmm1
+	LONG $0x587dc1c4; BYTE $0xc4               // vaddpd	%ymm12, %ymm0, %ymm0
+	LONG $0x28fdd362; WORD $0xec19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm12
+	LONG $0x142141c4; BYTE $0xdf               // vunpcklpd	%xmm15, %xmm11, %xmm11
+	LONG $0xcf14f1c5                           // vunpcklpd	%xmm7, %xmm1, %xmm1
+	LONG $0x28fdf362; WORD $0xd719; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm7
+	LONG $0x141941c4; BYTE $0xe0               // vunpcklpd	%xmm8, %xmm12, %xmm12
+	LONG $0x1875c3c4; WORD $0x01cc             // vinsertf128	$0x1, %xmm12, %ymm1, %ymm1
+	LONG $0x48fd5362; WORD $0xec1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm13, %ymm12
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	LONG $0x1459c1c4; BYTE $0xce               // vunpcklpd	%xmm14, %xmm4, %xmm1
+	LONG $0x28fd7362; WORD $0xe419; BYTE $0x01 // vextractf64x2	$1, %ymm12, %xmm4
+	LONG $0x1875c3c4; WORD $0x01cb             // vinsertf128	$0x1, %xmm11, %ymm1, %ymm1
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	LONG $0x48fdf362; WORD $0xd91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm3, %ymm1
+	LONG $0x48fdf362; WORD $0xeb1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm3
+	LONG $0x08e5e162; WORD $0xca14             // vunpcklpd	%xmm2, %xmm3, %xmm17
+	LONG $0x1471c1c4; BYTE $0xec               // vunpcklpd	%xmm12, %xmm1, %xmm5
+	LONG $0xf91571c5                           // vunpckhpd	%xmm1, %xmm1, %xmm15
+	LONG $0x28d5b362; WORD $0xe918; BYTE $0x01 // vinsertf64x2	$0x1, %xmm17, %ymm5, %ymm5
+	LONG $0x08e5e162; WORD $0xc315             // vunpckhpd	%xmm3, %xmm3, %xmm16
+	LONG $0x101b41c4; BYTE $0xdf               // vmovsd	%xmm15, %xmm12, %xmm11
+	LONG $0x289d5362; WORD $0xe403; BYTE $0x03 // valignq	$3, %ymm12, %ymm12, %ymm12
+	LONG $0xc558fdc5                           // vaddpd	%ymm5, %ymm0, %ymm0
+	LONG $0x08ef3162; WORD $0xf010             // vmovsd	%xmm16, %xmm2, %xmm14
+	LONG $0x28fdf362; WORD $0xcd19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm5
+	LONG $0x182543c4; WORD $0x01de             // vinsertf128	$0x1, %xmm14, %ymm11, %ymm11
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0x28edf362; WORD $0xd203; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm2
+	LONG $0x587dc1c4; BYTE $0xc3               // vaddpd	%ymm11, %ymm0, %ymm0
+	LONG $0x28fdd362; WORD $0xdb19; BYTE $0x01 // vextractf64x2	$1, %ymm3, %xmm11
+	LONG $0x28e5f362; WORD $0xdb03; BYTE $0x03 // valignq	$3, %ymm3, %ymm3, %ymm3
+	LONG $0xec14d1c5                           // vunpcklpd	%xmm4, %xmm5, %xmm5
+	LONG $0x1471c1c4; BYTE $0xcc               // vunpcklpd	%xmm12, %xmm1, %xmm1
+	LONG $0xdf1421c5                           // vunpcklpd	%xmm7, %xmm11, %xmm11
+	LONG $0x1855c3c4; WORD $0x01eb             // vinsertf128	$0x1, %xmm11, %ymm5, %ymm5
+	LONG $0xda14e1c5                           // vunpcklpd	%xmm2, %xmm3, %xmm3
+	LONG $0xc558fdc5                           // vaddpd	%ymm5, %ymm0, %ymm0
+	LONG $0x1875e3c4; WORD $0x01cb             // vinsertf128	$0x1, %xmm3, %ymm1, %ymm1
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JNE  BB0_10
+	QUAD $0x0000008824b48b4c                   // movq	136(%rsp), %r14
+	LONG $0x24548b48; BYTE $0x60               // movq	96(%rsp), %rdx
+	WORD $0x894c; BYTE $0xf0                   // movq	%r14, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x07e68341                           // andl	$7, %r14d
+	JE   BB0_8
+
+BB0_9:
+	LONG $0x28fd7362; WORD $0xf003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm14
+	QUAD $0x0000008824b48b4c                   // movq	136(%rsp), %r14
+	LONG $0xe828f9c5                           // vmovapd	%xmm0, %xmm5
+	LONG $0xf815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm7
+	LONG $0x28fdf362; WORD $0xc619; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm6
+	WORD $0x2949; BYTE $0xc6                   // subq	%rax, %r14
+	LONG $0xff7e8d4d                           // leaq	-1(%r14), %r15
+	LONG $0x02ff8349                           // cmpq	$2, %r15
+	JBE  BB0_13
+	QUAD $0x00000090249c8b4c                   // movq	144(%rsp), %r11
+	QUAD $0x000000a824948b4c                   // movq	168(%rsp), %r10
+	LONG $0x183c8d4e                           // leaq	(%rax,%r11), %r15
+	WORD $0x014d; BYTE $0xfa                   // addq	%r15, %r10
+	LONG $0x107da1c4; WORD $0xfb04             // vmovupd	(%rbx,%r15,8), %ymm0
+	LONG $0x597d01c4; WORD $0xd12c             // vmulpd	(%r9,%r10,8), %ymm0, %ymm13
+	QUAD $0x0000009824948b4c                   // movq	152(%rsp), %r10
+	WORD $0x014d; BYTE $0xd7                   // addq	%r10, %r15
+	QUAD $0x000000b024948b4c                   // movq	176(%rsp), %r10
+	LONG $0x597d01c4; WORD $0xf924             // vmulpd	(%r9,%r15,8), %ymm0, %ymm12
+	LONG $0x023c8d4d                           // leaq	(%r10,%rax), %r15
+	QUAD $0x000000b824948b4c                   // movq	184(%rsp), %r10
+	WORD $0x014d; BYTE $0xdf                   // addq	%r11, %r15
+	LONG $0xd55893c5                           // vaddsd	%xmm5, %xmm13, %xmm2
+	LONG $0x1511c1c4; BYTE $0xcd               // vunpckhpd	%xmm13, %xmm13, %xmm1
+	LONG $0x597d01c4; WORD $0xf91c             // vmulpd	(%r9,%r15,8), %ymm0, %ymm11
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+	WORD $0x014c; BYTE $0xd8                   // addq	%r11, %rax
+	LONG $0x597dc1c4; WORD $0xc104             // vmulpd	(%r9,%rax,8), %ymm0, %ymm0
+	LONG $0xef589bc5                           // vaddsd	%xmm7, %xmm12, %xmm5
+	LONG $0xc25873c5                           // vaddsd	%xmm2, %xmm1, %xmm8
+	WORD $0x894c; BYTE $0xf0                   // movq	%r14, %rax
+	LONG $0x28fd7362; WORD $0xea19; BYTE $0x01 // vextractf64x2	$1, %ymm13, %xmm2
+	LONG $0x1519c1c4; BYTE $0xcc               // vunpckhpd	%xmm12, %xmm12, %xmm1
+	LONG $0xfce08348                           // andq	$-4, %rax
+	LONG $0x28fd5362; WORD $0xe119; BYTE $0x01 // vextractf64x2	$1, %ymm12, %xmm9
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x03e68341                           // andl	$3, %r14d
+	LONG $0x289d5362; WORD $0xe403; BYTE $0x03 // valignq	$3, %ymm12, %ymm12, %ymm12
+	LONG $0xfd58f3c5                           // vaddsd	%xmm5, %xmm1, %xmm7
+	LONG $0xee58a3c5                           // vaddsd	%xmm6, %xmm11, %xmm5
+	LONG $0x1521c1c4; BYTE $0xcb               // vunpckhpd	%xmm11, %xmm11, %xmm1
+	LONG $0x587b41c4; BYTE $0xd6               // vaddsd	%xmm14, %xmm0, %xmm10
+	LONG $0xf558f3c5                           // vaddsd	%xmm5, %xmm1, %xmm6
+	LONG $0xe815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm5
+	LONG $0x28fd7362; WORD $0xd919; BYTE $0x01 // vextractf64x2	$1, %ymm11, %xmm1
+	LONG $0x586bc1c4; BYTE $0xd0               // vaddsd	%xmm8, %xmm2, %xmm2
+	LONG $0x28a55362; WORD $0xdb03; BYTE $0x03 // valignq	$3, %ymm11, %ymm11, %ymm11
+	LONG $0x5853c1c4; BYTE $0xea               // vaddsd	%xmm10, %xmm5, %xmm5
+	LONG $0xff58b3c5                           // vaddsd	%xmm7, %xmm9, %xmm7
+	LONG $0x28fdd362; WORD $0xc219; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm10
+	LONG $0x28955362; WORD $0xc503; BYTE $0x03 // valignq	$3, %ymm13, %ymm13, %ymm8
+	LONG $0x28fdf362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm0
+	LONG $0x5843c1c4; BYTE $0xfc               // vaddsd	%xmm12, %xmm7, %xmm7
+	LONG $0xce58f3c5                           // vaddsd	%xmm6, %xmm1, %xmm1
+	LONG $0xed58abc5                           // vaddsd	%xmm5, %xmm10, %xmm5
+	LONG $0x586bc1c4; BYTE $0xd0               // vaddsd	%xmm8, %xmm2, %xmm2
+	LONG $0x5873c1c4; BYTE $0xcb               // vaddsd	%xmm11, %xmm1, %xmm1
+	LONG $0xc058d3c5                           // vaddsd	%xmm0, %xmm5, %xmm0
+	LONG $0xc814f1c5                           // vunpcklpd	%xmm0, %xmm1, %xmm1
+	LONG $0xc714e9c5                           // vunpcklpd	%xmm7, %xmm2, %xmm0
+	LONG $0x187de3c4; WORD $0x01c1             // vinsertf128	$0x1, %xmm1, %ymm0, %ymm0
+	JE   BB0_8
+
+BB0_13:
+	QUAD $0x000000b024a48b4c                   // movq	176(%rsp), %r12
+	QUAD $0x000000a8249c8b4c                   // movq	168(%rsp), %r11
+	QUAD $0x00000000d5048d48                   // leaq	0(,%rdx,8), %rax
+	QUAD $0x0000009824948b4c                   // movq	152(%rsp), %r10
+	LONG $0x6ef9e1c4; BYTE $0xf8               // vmovq	%rax, %xmm7
+	LONG $0x14348d4d                           // leaq	(%r12,%rdx), %r14
+	LONG $0x133c8d4d                           // leaq	(%r11,%rdx), %r15
+	LONG $0x6ef9c1c4; BYTE $0xce               // vmovq	%r14, %xmm1
+	QUAD $0x000000b824b48b4c                   // movq	184(%rsp), %r14
+	LONG $0x12048d49                           // leaq	(%r10,%rdx), %rax
+	WORD $0x0149; BYTE $0xd6                   // addq	%rdx, %r14
+	LONG $0x6ef9c1c4; BYTE $0xde               // vmovq	%r14, %xmm3
+	LONG $0x7ef9c1c4; BYTE $0xce               // vmovq	%xmm1, %r14
+	LONG $0x107b81c4; WORD $0xf90c             // vmovsd	(%r9,%r15,8), %xmm1
+	LONG $0x107b81c4; WORD $0xf114             // vmovsd	(%r9,%r14,8), %xmm2
+	LONG $0x7ef9c1c4; BYTE $0xde               // vmovq	%xmm3, %r14
+	LONG $0x1671c1c4; WORD $0xc10c             // vmovhpd	(%r9,%rax,8), %xmm1, %xmm1
+	LONG $0x01428d48                           // leaq	1(%rdx), %rax
+	LONG $0x166981c4; WORD $0xf114             // vmovhpd	(%r9,%r14,8), %xmm2, %xmm2
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	LONG $0x38f5f262; WORD $0x04b8; BYTE $0xd3 // vfmadd231pd	(%rbx,%rdx,8){1to4}, %ymm1, %ymm0
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_8
+	LONG $0x04348d4d                           // leaq	(%r12,%rax), %r14
+	LONG $0x033c8d4d                           // leaq	(%r11,%rax), %r15
+	LONG $0x02c28348                           // addq	$2, %rdx
+	LONG $0x6ef9c1c4; BYTE $0xce               // vmovq	%r14, %xmm1
+	QUAD $0x000000b824b48b4c                   // movq	184(%rsp), %r14
+	LONG $0x6ef9c1c4; BYTE $0xdf               // vmovq	%r15, %xmm3
+	LONG $0x023c8d4d                           // leaq	(%r10,%rax), %r15
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x7ef9c1c4; BYTE $0xce               // vmovq	%xmm1, %r14
+	LONG $0x107b81c4; WORD $0xf114             // vmovsd	(%r9,%r14,8), %xmm2
+	LONG $0x1669c1c4; WORD $0xc114             // vmovhpd	(%r9,%rax,8), %xmm2, %xmm2
+	LONG $0x7ef9e1c4; BYTE $0xd8               // vmovq	%xmm3, %rax
+	LONG $0x107bc1c4; WORD $0xc10c             // vmovsd	(%r9,%rax,8), %xmm1
+	LONG $0x7ef9e1c4; BYTE $0xf8               // vmovq	%xmm7, %rax
+	LONG $0x167181c4; WORD $0xf90c             // vmovhpd	(%r9,%r15,8), %xmm1, %xmm1
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	QUAD $0x010344b838f5f262                   // vfmadd231pd	8(%rbx,%rax){1to4}, %ymm1, %ymm0
+	WORD $0x394c; BYTE $0xea                   // cmpq	%r13, %rdx
+	JGE  BB0_8
+	LONG $0x1a3c8d4e                           // leaq	(%rdx,%r11), %r15
+	QUAD $0x000000b824b48b4c                   // movq	184(%rsp), %r14
+	LONG $0x221c8d4e                           // leaq	(%rdx,%r12), %r11
+	LONG $0x107b81c4; WORD $0xd914             // vmovsd	(%r9,%r11,8), %xmm2
+	LONG $0x107b81c4; WORD $0xf90c             // vmovsd	(%r9,%r15,8), %xmm1
+	LONG $0x12048d4a                           // leaq	(%rdx,%r10), %rax
+	WORD $0x014c; BYTE $0xf2                   // addq	%r14, %rdx
+	LONG $0x1671c1c4; WORD $0xc10c             // vmovhpd	(%r9,%rax,8), %xmm1, %xmm1
+	LONG $0x1669c1c4; WORD $0xd114             // vmovhpd	(%r9,%rdx,8), %xmm2, %xmm2
+	LONG $0x7ef9e1c4; BYTE $0xf8               // vmovq	%xmm7, %rax
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	QUAD $0x020344b838f5f262                   // vfmadd231pd	16(%rbx,%rax){1to4}, %ymm1, %ymm0
+
+BB0_8:
+	LONG $0x24548b48; BYTE $0x70   // movq	112(%rsp), %rdx
+	QUAD $0x0000008024848b48       // movq	128(%rsp), %rax
+	LONG $0x08fdc162; WORD $0xe67e // vmovq	%xmm20, %r14
+	QUAD $0x000000a824b4014c       // addq	%r14, 168(%rsp)
+	LONG $0x0011fdc5               // vmovupd	%ymm0, (%rax)
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0x20c08348               // addq	$32, %rax
+	WORD $0x0148; BYTE $0xd7       // addq	%rdx, %rdi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	WORD $0x0148; BYTE $0xd1       // addq	%rdx, %rcx
+	LONG $0x08fde162; WORD $0xea7e // vmovq	%xmm21, %rdx
+	QUAD $0x0000009824b4014c       // addq	%r14, 152(%rsp)
+	QUAD $0x000000b024b4014c       // addq	%r14, 176(%rsp)
+	QUAD $0x000000b824b4014c       // addq	%r14, 184(%rsp)
+	QUAD $0x0000008024848948       // movq	%rax, 128(%rsp)
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JNE  BB0_15
+	LONG $0x244c8b4c; BYTE $0x58   // movq	88(%rsp), %r9
+	LONG $0x245c8b4c; BYTE $0x50   // movq	80(%rsp), %r11
+	QUAD $0x000000048d0c8d4a       // leaq	4(,%r9,4), %rcx
+
+BB0_5:
+	LONG $0x24448b48; BYTE $0x68 // movq	104(%rsp), %rax
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JLE  BB0_102
+	LONG $0xc3248d4d             // leaq	(%r11,%rax,8), %r12
+	LONG $0xf8458d49             // leaq	-8(%r13), %rax
+	QUAD $0x000000a024948b4c     // movq	160(%rsp), %r10
+	LONG $0x03e8c148             // shrq	$3, %rax
+	LONG $0xcb048d4d             // leaq	(%r11,%rcx,8), %r8
+	QUAD $0x00000000ed3c8d4e     // leaq	0(,%r13,8), %r15
+	LONG $0xcdaf0f49             // imulq	%r13, %rcx
+	QUAD $0x00000008c5048d48     // leaq	8(,%rax,8), %rax
+	LONG $0x6ef9c1c4; BYTE $0xec // vmovq	%r12, %xmm5
+	QUAD $0x000000b824848948     // movq	%rax, 184(%rsp)
+	LONG $0xca348d49             // leaq	(%r10,%rcx,8), %rsi
+
+BB0_26:
+	LONG $0x07fd8349             // cmpq	$7, %r13
+	JLE  BB0_56
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_18:
+	QUAD $0xffc37c1048fdf162 // vmovupd	-64(%rbx,%rax,8), %zmm7
+	QUAD $0xffc644b848c5f262 // vfmadd231pd	-64(%rsi,%rax,8), %zmm7, %zmm0
+	LONG $0x08c08348         // addq	$8, %rax
+	WORD $0x394c; BYTE $0xe8 // cmpq	%r13, %rax
+	JLE  BB0_18
+	QUAD $0x000000b824948b48 // movq	184(%rsp), %rdx
+
+BB0_17:
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f5c5                           // vaddpd	%ymm0, %ymm1, %ymm0
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm1
+	LONG $0xc858f1c5                           // vaddpd	%xmm0, %xmm1, %xmm1
+	LONG $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd5                   // cmpq	%rdx, %r13
+	JLE  BB0_19
+	WORD $0x894d; BYTE $0xec                   // movq	%r13, %r12
+	WORD $0x8949; BYTE $0xd6                   // movq	%rdx, %r14
+	WORD $0x2949; BYTE $0xd4                   // subq	%rdx, %r12
+	LONG $0x24448d49; BYTE $0xff               // leaq	-1(%r12), %rax
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_57
+	WORD $0x894c; BYTE $0xe7                   // movq	%r12, %rdi
+	LONG $0x11048d48                           // leaq	(%rcx,%rdx), %rax
+	LONG $0xd31c8d4c                           // leaq	(%rbx,%rdx,8), %r11
+	LONG $0x03efc148                           // shrq	$3, %rdi
+	LONG $0xc20c8d4d                           // leaq	(%r10,%rax,8), %r9
+	WORD $0xc031                               // xorl	%eax, %eax
+	LONG $0x06e7c148                           // salq	$6, %rdi
+
+BB0_21:
+	LONG $0x48fdd162; WORD $0x3c10; BYTE $0x01 // vmovupd	(%r9,%rax), %zmm7
+	LONG $0x48c5d162; WORD $0x1459; BYTE $0x03 // vmulpd	(%r11,%rax), %zmm7, %zmm2
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x28fdf362; WORD $0xd119; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xe215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm4
+	LONG $0xc058dbc5                           // vaddsd	%xmm0, %xmm4, %xmm0
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	LONG $0x28edf362; WORD $0xc203; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0x48fdf362; WORD $0xd11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm1
+	LONG $0xd115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0xc058f3c5                           // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xd058ebc5                           // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm0
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xf8                   // cmpq	%rdi, %rax
+	JNE  BB0_21
+	WORD $0x894c; BYTE $0xe0                   // movq	%r12, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x07c4f641                           // testb	$7, %r12b
+	JE   BB0_19
+
+BB0_20:
+	WORD $0x894d; BYTE $0xe1                   // movq	%r12, %r9
+	WORD $0x2949; BYTE $0xc1                   // subq	%rax, %r9
+	LONG $0xff798d49                           // leaq	-1(%r9), %rdi
+	LONG $0x02ff8348                           // cmpq	$2, %rdi
+	JBE  BB0_24
+	LONG $0x083c8d48                           // leaq	(%rax,%rcx), %rdi
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	WORD $0x014c; BYTE $0xf7                   // addq	%r14, %rdi
+	LONG $0x0c10fdc5; BYTE $0xc3               // vmovupd	(%rbx,%rax,8), %ymm1
+	WORD $0x894c; BYTE $0xc8                   // movq	%r9, %rax
+	LONG $0x5975c1c4; WORD $0xfa0c             // vmulpd	(%r10,%rdi,8), %ymm1, %ymm1
+	LONG $0xfce08348                           // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x03e18341                           // andl	$3, %r9d
+	LONG $0xc058f3c5                           // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xd115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0xd058ebc5                           // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm0
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	JE   BB0_19
+
+BB0_24:
+	LONG $0x11048d48                           // leaq	(%rcx,%rdx), %rax
+	LONG $0x3c10fbc5; BYTE $0xd3               // vmovsd	(%rbx,%rdx,8), %xmm7
+	QUAD $0x00000000d53c8d48                   // leaq	0(,%rdx,8), %rdi
+	LONG $0xb9c1c2c4; WORD $0xc204             // vfmadd231sd	(%r10,%rax,8), %xmm7, %xmm0
+	LONG $0x01428d48                           // leaq	1(%rdx), %rax
+	WORD $0x394c; BYTE $0xe8                   // cmpq	%r13, %rax
+	JGE  BB0_19
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x02c28348                           // addq	$2, %rdx
+	LONG $0x7c10fbc5; WORD $0x083b             // vmovsd	8(%rbx,%rdi), %xmm7
+	LONG $0xb9c1c2c4; WORD $0xc204             // vfmadd231sd	(%r10,%rax,8), %xmm7, %xmm0
+	WORD $0x394c; BYTE $0xea                   // cmpq	%r13, %rdx
+	JGE  BB0_19
+	WORD $0x0148; BYTE $0xca                   // addq	%rcx, %rdx
+	LONG $0x107bc1c4; WORD $0xd23c             // vmovsd	(%r10,%rdx,8), %xmm7
+	LONG $0xb9c1e2c4; WORD $0x3b44; BYTE $0x10 // vfmadd231sd	16(%rbx,%rdi), %xmm7, %xmm0
+
+BB0_19:
+	LONG $0x117bc1c4; BYTE $0x00 // vmovsd	%xmm0, (%r8)
+	LONG $0x08c08349             // addq	$8, %r8
+	WORD $0x014c; BYTE $0xe9     // addq	%r13, %rcx
+	WORD $0x014c; BYTE $0xfe     // addq	%r15, %rsi
+	LONG $0x7ef9e1c4; BYTE $0xe8 // vmovq	%xmm5, %rax
+	WORD $0x3949; BYTE $0xc0     // cmpq	%rax, %r8
+	JNE  BB0_26
+
+BB0_102:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x10a58d48; WORD $0xffff; BYTE $0xff // leaq	-240(%rbp), %rsp
+	RET
+
+BB0_54:
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x48fdf162; WORD $0xd128 // vmovapd	%zmm1, %zmm2
+	LONG $0x48fdf162; WORD $0xe928 // vmovapd	%zmm1, %zmm5
+	LONG $0x48fdf162; WORD $0xf128 // vmovapd	%zmm1, %zmm6
+	JMP  BB0_6
+
+BB0_55:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_9
+
+BB0_105:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_4
+
+BB0_57:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_20
+
+BB0_56:
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xc057f9c5 // vxorpd	%xmm0, %xmm0, %xmm0
+	JMP  BB0_17
+
+BB0_53:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_5
@@ -0,0 +1,353 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmulklastblocked_c_f32_avx2_amd64.c
+
+TEXT ·matmulklastblocked_c_f32_avx2(SB), $288-72
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ c+16(FP), DX
+	MOVQ pm+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_a+48(FP), R11
+	MOVQ R11, 256(SP)
+	MOVQ plen_b+56(FP), R11
+	MOVQ R11, 264(SP)
+	MOVQ plen_c+64(FP), R11
+	MOVQ R11, 272(SP)
+	WORD $0x8949; BYTE $0xfa     // movq	%rdi, %r10
+	QUAD $0x000000f024ac8d48     // leaq	240(%rsp), %rbp
+	WORD $0x8949; BYTE $0xf7     // movq	%rsi, %r15
+	WORD $0x8949; BYTE $0xd4     // movq	%rdx, %r12
+	LONG $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348             // andq	$-32, %rsp
+	WORD $0x8b48; BYTE $0x09     // movq	(%rcx), %rcx
+	WORD $0x8b4d; BYTE $0x28     // movq	(%r8), %r13
+	WORD $0x8b49; BYTE $0x01     // movq	(%r9), %rax
+	WORD $0x8948; BYTE $0xca     // movq	%rcx, %rdx
+	LONG $0xd5af0f49             // imulq	%r13, %rdx
+	QUAD $0x000000c824848948     // movq	%rax, 200(%rsp)
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JLE  BB0_8
+	LONG $0xff428d48             // leaq	-1(%rdx), %rax
+	LONG $0x06f88348             // cmpq	$6, %rax
+	JBE  BB0_32
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	WORD $0x894c; BYTE $0xe6     // movq	%r12, %rsi
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x03e8c148             // shrq	$3, %rax
+	LONG $0x05e0c148             // salq	$5, %rax
+	WORD $0x014c; BYTE $0xe0     // addq	%r12, %rax
+
+BB0_6:
+	LONG $0x0611fcc5         // vmovups	%ymm0, (%rsi)
+	LONG $0x20c68348         // addq	$32, %rsi
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JNE  BB0_6
+	WORD $0x8948; BYTE $0xd0 // movq	%rdx, %rax
+	LONG $0xf8e08348         // andq	$-8, %rax
+	WORD $0x8948; BYTE $0xc7 // movq	%rax, %rdi
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JE   BB0_8
+
+BB0_5:
+	WORD $0x8948; BYTE $0xd6       // movq	%rdx, %rsi
+	WORD $0x2948; BYTE $0xfe       // subq	%rdi, %rsi
+	LONG $0xff468d4c               // leaq	-1(%rsi), %r8
+	LONG $0x02f88349               // cmpq	$2, %r8
+	JBE  BB0_10
+	LONG $0xc057f8c5               // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x1178c1c4; WORD $0xbc04 // vmovups	%xmm0, (%r12,%rdi,4)
+	WORD $0x8948; BYTE $0xf7       // movq	%rsi, %rdi
+	LONG $0xfce78348               // andq	$-4, %rdi
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+	WORD $0xe683; BYTE $0x03       // andl	$3, %esi
+	JE   BB0_8
+
+BB0_10:
+	LONG $0x01788d48                     // leaq	1(%rax), %rdi
+	QUAD $0x000000008404c741             // movl	$0x00000000, (%r12,%rax,4)
+	QUAD $0x0000000085348d48             // leaq	0(,%rax,4), %rsi
+	WORD $0x3948; BYTE $0xfa             // cmpq	%rdi, %rdx
+	JLE  BB0_8
+	QUAD $0x000000043444c741; BYTE $0x00 // movl	$0x00000000, 4(%r12,%rsi)
+	LONG $0x02c08348                     // addq	$2, %rax
+	WORD $0x3948; BYTE $0xc2             // cmpq	%rax, %rdx
+	JLE  BB0_8
+	QUAD $0x000000083444c741; BYTE $0x00 // movl	$0x00000000, 8(%r12,%rsi)
+
+BB0_8:
+	WORD $0x8548; BYTE $0xc9             // testq	%rcx, %rcx
+	JLE  BB0_55
+	WORD $0x854d; BYTE $0xed             // testq	%r13, %r13
+	JLE  BB0_55
+	QUAD $0x000000c824848b48             // movq	200(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0             // testq	%rax, %rax
+	JLE  BB0_55
+	WORD $0x8948; BYTE $0xc6             // movq	%rax, %rsi
+	WORD $0x894c; BYTE $0xef             // movq	%r13, %rdi
+	WORD $0x894d; BYTE $0xfe             // movq	%r15, %r14
+	WORD $0x8948; BYTE $0xca             // movq	%rcx, %rdx
+	LONG $0x06e6c148                     // salq	$6, %rsi
+	QUAD $0x00000000ad1c8d4a             // leaq	0(,%r13,4), %rbx
+	WORD $0x894d; BYTE $0xd7             // movq	%r10, %r15
+	LONG $0x06e7c148                     // salq	$6, %rdi
+	LONG $0x24748948; BYTE $0x70         // movq	%rsi, 112(%rsp)
+	WORD $0x8948; BYTE $0xc6             // movq	%rax, %rsi
+	LONG $0x02e0c148                     // salq	$2, %rax
+	LONG $0x08e6c148                     // salq	$8, %rsi
+	QUAD $0x00000080249c8948             // movq	%rbx, 128(%rsp)
+	WORD $0xdb31                         // xorl	%ebx, %ebx
+	LONG $0x24748948; BYTE $0x60         // movq	%rsi, 96(%rsp)
+	WORD $0x8949; BYTE $0xda             // movq	%rbx, %r10
+	QUAD $0x000000782444c748; BYTE $0x00 // movq	$0, 120(%rsp)
+	QUAD $0x000000b824848948             // movq	%rax, 184(%rsp)
+	WORD $0xc031                         // xorl	%eax, %eax
+
+BB0_17:
+	WORD $0x8949; BYTE $0xc0     // movq	%rax, %r8
+	LONG $0x40c08348             // addq	$64, %rax
+	WORD $0x8948; BYTE $0xd3     // movq	%rdx, %rbx
+	WORD $0x894d; BYTE $0xf1     // movq	%r14, %r9
+	WORD $0x3948; BYTE $0xd0     // cmpq	%rdx, %rax
+	LONG $0xd84e0f48             // cmovle	%rax, %rbx
+	WORD $0x3145; BYTE $0xdb     // xorl	%r11d, %r11d
+	WORD $0xc931                 // xorl	%ecx, %ecx
+	WORD $0x394c; BYTE $0xc3     // cmpq	%r8, %rbx
+	JLE  BB0_14
+	LONG $0x24448948; BYTE $0x58 // movq	%rax, 88(%rsp)
+	LONG $0x24548948; BYTE $0x50 // movq	%rdx, 80(%rsp)
+	LONG $0x247c8948; BYTE $0x48 // movq	%rdi, 72(%rsp)
+
+BB0_19:
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	LONG $0x40c18348                           // addq	$64, %rcx
+	WORD $0x894c; BYTE $0xe8                   // movq	%r13, %rax
+	WORD $0x394c; BYTE $0xe9                   // cmpq	%r13, %rcx
+	LONG $0xc14e0f48                           // cmovle	%rcx, %rax
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JLE  BB0_16
+	LONG $0x10148d4a                           // leaq	(%rax,%r10), %rdx
+	LONG $0x244c8948; BYTE $0x40               // movq	%rcx, 64(%rsp)
+	LONG $0x94348d49                           // leaq	(%r12,%rdx,4), %rsi
+	LONG $0x246c894c; BYTE $0x38               // movq	%r13, 56(%rsp)
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	LONG $0x24748948; BYTE $0x68               // movq	%rsi, 104(%rsp)
+	WORD $0x2948; BYTE $0xc2                   // subq	%rax, %rdx
+	LONG $0x2454894c; BYTE $0x30               // movq	%r10, 48(%rsp)
+	QUAD $0xffffff00953c8d48                   // leaq	-256(,%rdx,4), %rdi
+	WORD $0xd231                               // xorl	%edx, %edx
+	QUAD $0x000000c02484c748; LONG $0x00000008 // movq	$8, 192(%rsp)
+	LONG $0x2464894c; BYTE $0x28               // movq	%r12, 40(%rsp)
+
+BB0_21:
+	QUAD $0x000000c824848b48                   // movq	200(%rsp), %rax
+	QUAD $0x0000008824948948                   // movq	%rdx, 136(%rsp)
+	LONG $0x00c28148; WORD $0x0001; BYTE $0x00 // addq	$256, %rdx
+	LONG $0x24548948; BYTE $0x20               // movq	%rdx, 32(%rsp)
+	LONG $0x246c8b4c; BYTE $0x78               // movq	120(%rsp), %r13
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	QUAD $0x000000a8249c8948                   // movq	%rbx, 168(%rsp)
+	LONG $0xc24e0f48                           // cmovle	%rdx, %rax
+	LONG $0x2444894c; BYTE $0x18               // movq	%r8, 24(%rsp)
+	QUAD $0x000000a024bc8948                   // movq	%rdi, 160(%rsp)
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	QUAD $0x00000098249c894c                   // movq	%r11, 152(%rsp)
+	LONG $0x24448b48; BYTE $0x68               // movq	104(%rsp), %rax
+	QUAD $0x00000090248c894c                   // movq	%r9, 144(%rsp)
+	QUAD $0x000000d024848948                   // movq	%rax, 208(%rsp)
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+
+BB0_18:
+	QUAD $0x000000d024b48b48 // movq	208(%rsp), %rsi
+	QUAD $0x000000a0249c8b48 // movq	160(%rsp), %rbx
+	LONG $0xaf048d4f         // leaq	(%r15,%r13,4), %r8
+	QUAD $0x000000b024848948 // movq	%rax, 176(%rsp)
+	QUAD $0x0000009824948b4c // movq	152(%rsp), %r10
+	LONG $0x1e248d4c         // leaq	(%rsi,%rbx), %r12
+	QUAD $0x0000009024b48b48 // movq	144(%rsp), %rsi
+
+BB0_20:
+	QUAD $0x000000c024848b48 // movq	192(%rsp), %rax
+	WORD $0x3948; BYTE $0xc1 // cmpq	%rax, %rcx
+	JL   BB0_33
+	LONG $0xc957f0c5         // vxorps	%xmm1, %xmm1, %xmm1
+
+BB0_23:
+	LONG $0x107cc1c4; WORD $0x8064; BYTE $0xe0 // vmovups	-32(%r8,%rax,4), %ymm4
+	WORD $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	LONG $0xb85de2c4; WORD $0x864c; BYTE $0xe0 // vfmadd231ps	-32(%rsi,%rax,4), %ymm4, %ymm1
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JGE  BB0_23
+
+BB0_22:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_24
+	WORD $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	QUAD $0x000000d824948948       // movq	%rdx, 216(%rsp)
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_34
+	LONG $0x2a048d4a               // leaq	(%rdx,%r13), %rax
+	WORD $0x8949; BYTE $0xf9       // movq	%rdi, %r9
+	LONG $0x871c8d49               // leaq	(%r15,%rax,4), %rbx
+	LONG $0x03e9c149               // shrq	$3, %r9
+	LONG $0x12048d49               // leaq	(%r10,%rdx), %rax
+	LONG $0x861c8d4d               // leaq	(%r14,%rax,4), %r11
+	LONG $0x05e1c149               // salq	$5, %r9
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_26:
+	LONG $0x107cc1c4; WORD $0x032c // vmovups	(%r11,%rax), %ymm5
+	LONG $0x1459d4c5; BYTE $0x03   // vmulps	(%rbx,%rax), %ymm5, %ymm2
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xcac6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xdac6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xc215e8c5               // vunpckhps	%xmm2, %xmm2, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd858e2c5               // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f2c5               // vaddss	%xmm3, %xmm1, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc1       // cmpq	%rax, %r9
+	JNE  BB0_26
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x07c7f640               // testb	$7, %dil
+	JE   BB0_24
+
+BB0_25:
+	WORD $0x2948; BYTE $0xc7       // subq	%rax, %rdi
+	LONG $0xff4f8d4c               // leaq	-1(%rdi), %r9
+	LONG $0x02f98349               // cmpq	$2, %r9
+	JBE  BB0_29
+	QUAD $0x000000d8249c8b48       // movq	216(%rsp), %rbx
+	LONG $0x020c8d4d               // leaq	(%r10,%rax), %r9
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	WORD $0x0149; BYTE $0xd9       // addq	%rbx, %r9
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0x1078c1c4; WORD $0x870c // vmovups	(%r15,%rax,4), %xmm1
+	LONG $0x597081c4; WORD $0x8e0c // vmulps	(%r14,%r9,4), %xmm1, %xmm1
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	WORD $0xe783; BYTE $0x03       // andl	$3, %edi
+	LONG $0xc058f2c5               // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_24
+
+BB0_29:
+	LONG $0x12048d49               // leaq	(%r10,%rdx), %rax
+	LONG $0x157c8d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rdi
+	LONG $0x107ac1c4; WORD $0xbf34 // vmovss	(%r15,%rdi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8604 // vfmadd231ss	(%r14,%rax,4), %xmm6, %xmm0
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3948; BYTE $0xc8       // cmpq	%rcx, %rax
+	JGE  BB0_24
+	LONG $0x283c8d4a               // leaq	(%rax,%r13), %rdi
+	LONG $0x02c28348               // addq	$2, %rdx
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+	LONG $0x107ac1c4; WORD $0xbf3c // vmovss	(%r15,%rdi,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x8604 // vfmadd231ss	(%r14,%rax,4), %xmm7, %xmm0
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_24
+	LONG $0x12048d49               // leaq	(%r10,%rdx), %rax
+	WORD $0x014c; BYTE $0xea       // addq	%r13, %rdx
+	LONG $0x107ac1c4; WORD $0x863c // vmovss	(%r14,%rax,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x9704 // vfmadd231ss	(%r15,%rdx,4), %xmm7, %xmm0
+
+BB0_24:
+	QUAD $0x000000c824848b48                   // movq	200(%rsp), %rax
+	LONG $0x587ac1c4; WORD $0x2404             // vaddss	(%r12), %xmm0, %xmm0
+	LONG $0x04c48349                           // addq	$4, %r12
+	WORD $0x0149; BYTE $0xc2                   // addq	%rax, %r10
+	QUAD $0x000000b824848b48                   // movq	184(%rsp), %rax
+	LONG $0x117ac1c4; WORD $0x2444; BYTE $0xfc // vmovss	%xmm0, -4(%r12)
+	WORD $0x0148; BYTE $0xc6                   // addq	%rax, %rsi
+	QUAD $0x000000d024848b48                   // movq	208(%rsp), %rax
+	WORD $0x3949; BYTE $0xc4                   // cmpq	%rax, %r12
+	JNE  BB0_20
+	QUAD $0x0000008024b48b48                   // movq	128(%rsp), %rsi
+	QUAD $0x000000b024848b48                   // movq	176(%rsp), %rax
+	WORD $0x014c; BYTE $0xe6                   // addq	%r12, %rsi
+	LONG $0x01c08348                           // addq	$1, %rax
+	QUAD $0x000000d024b48948                   // movq	%rsi, 208(%rsp)
+	QUAD $0x000000c824b48b48                   // movq	200(%rsp), %rsi
+	WORD $0x0149; BYTE $0xf5                   // addq	%rsi, %r13
+	QUAD $0x000000a824843948                   // cmpq	%rax, 168(%rsp)
+	JNE  BB0_18
+	LONG $0x24548b48; BYTE $0x20               // movq	32(%rsp), %rdx
+	QUAD $0x000000a8249c8b48                   // movq	168(%rsp), %rbx
+	LONG $0x24448b4c; BYTE $0x18               // movq	24(%rsp), %r8
+	QUAD $0x000000a024bc8b48                   // movq	160(%rsp), %rdi
+	QUAD $0x00000098249c8b4c                   // movq	152(%rsp), %r11
+	QUAD $0x00000090248c8b4c                   // movq	144(%rsp), %r9
+	QUAD $0x000000c024848148; LONG $0x00000100 // addq	$256, 192(%rsp)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JL   BB0_21
+	LONG $0x244c8b48; BYTE $0x40               // movq	64(%rsp), %rcx
+	LONG $0x246c8b4c; BYTE $0x38               // movq	56(%rsp), %r13
+	LONG $0x24548b4c; BYTE $0x30               // movq	48(%rsp), %r10
+	LONG $0x24648b4c; BYTE $0x28               // movq	40(%rsp), %r12
+
+BB0_16:
+	LONG $0x24448b48; BYTE $0x70 // movq	112(%rsp), %rax
+	WORD $0x0149; BYTE $0xc3     // addq	%rax, %r11
+	LONG $0x24448b48; BYTE $0x60 // movq	96(%rsp), %rax
+	WORD $0x0149; BYTE $0xc1     // addq	%rax, %r9
+	WORD $0x394c; BYTE $0xe9     // cmpq	%r13, %rcx
+	JL   BB0_19
+	LONG $0x24448b48; BYTE $0x58 // movq	88(%rsp), %rax
+	LONG $0x24548b48; BYTE $0x50 // movq	80(%rsp), %rdx
+	LONG $0x247c8b48; BYTE $0x48 // movq	72(%rsp), %rdi
+
+BB0_14:
+	LONG $0x245c8b48; BYTE $0x70 // movq	112(%rsp), %rbx
+	WORD $0x0149; BYTE $0xfa     // addq	%rdi, %r10
+	LONG $0x245c0148; BYTE $0x78 // addq	%rbx, 120(%rsp)
+	WORD $0x3948; BYTE $0xd0     // cmpq	%rdx, %rax
+	JL   BB0_17
+
+BB0_55:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x10a58d48; WORD $0xffff; BYTE $0xff // leaq	-240(%rbp), %rsp
+	RET
+
+BB0_33:
+	QUAD $0x0000008824948b48 // movq	136(%rsp), %rdx
+	LONG $0xc957f0c5         // vxorps	%xmm1, %xmm1, %xmm1
+	JMP  BB0_22
+
+BB0_34:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_25
+
+BB0_32:
+	WORD $0xff31 // xorl	%edi, %edi
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_5
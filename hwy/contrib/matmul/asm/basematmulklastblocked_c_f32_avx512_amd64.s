@@ -0,0 +1,434 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmulklastblocked_c_f32_avx512_amd64.c
+
+TEXT ·matmulklastblocked_c_f32_avx512(SB), $288-72
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ c+16(FP), DX
+	MOVQ pm+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_a+48(FP), R11
+	MOVQ R11, 256(SP)
+	MOVQ plen_b+56(FP), R11
+	MOVQ R11, 264(SP)
+	MOVQ plen_c+64(FP), R11
+	MOVQ R11, 272(SP)
+	QUAD $0x000000f024ac8d48     // leaq	240(%rsp), %rbp
+	WORD $0x8949; BYTE $0xd7     // movq	%rdx, %r15
+	WORD $0x8949; BYTE $0xfe     // movq	%rdi, %r14
+	LONG $0x24648d48; BYTE $0x40 // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348             // andq	$-64, %rsp
+	WORD $0x8b4c; BYTE $0x11     // movq	(%rcx), %r10
+	WORD $0x8b4d; BYTE $0x00     // movq	(%r8), %r8
+	WORD $0x8b49; BYTE $0x01     // movq	(%r9), %rax
+	WORD $0x894c; BYTE $0xd2     // movq	%r10, %rdx
+	LONG $0xd0af0f49             // imulq	%r8, %rdx
+	QUAD $0x000000a824848948     // movq	%rax, 168(%rsp)
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JLE  BB0_8
+	LONG $0xff428d48             // leaq	-1(%rdx), %rax
+	LONG $0x0ef88348             // cmpq	$14, %rax
+	JBE  BB0_32
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	WORD $0x894c; BYTE $0xf9     // movq	%r15, %rcx
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x04e8c148             // shrq	$4, %rax
+	LONG $0x06e0c148             // salq	$6, %rax
+	WORD $0x014c; BYTE $0xf8     // addq	%r15, %rax
+
+BB0_6:
+	LONG $0x487cf162; WORD $0x0111 // vmovups	%zmm0, (%rcx)
+	LONG $0x40c18348               // addq	$64, %rcx
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JNE  BB0_6
+	WORD $0x8948; BYTE $0xd0       // movq	%rdx, %rax
+	LONG $0xf0e08348               // andq	$-16, %rax
+	WORD $0x8949; BYTE $0xc1       // movq	%rax, %r9
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JE   BB0_8
+
+BB0_5:
+	WORD $0x8948; BYTE $0xd1       // movq	%rdx, %rcx
+	WORD $0x294c; BYTE $0xc9       // subq	%r9, %rcx
+	LONG $0xff798d48               // leaq	-1(%rcx), %rdi
+	LONG $0x06ff8348               // cmpq	$6, %rdi
+	JBE  BB0_10
+	WORD $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	LONG $0xc057f8c5               // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0xf8e78348               // andq	$-8, %rdi
+	LONG $0x117c81c4; WORD $0x8f04 // vmovups	%ymm0, (%r15,%r9,4)
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+	WORD $0xe183; BYTE $0x07       // andl	$7, %ecx
+	JE   BB0_8
+
+BB0_10:
+	LONG $0x01788d48                     // leaq	1(%rax), %rdi
+	QUAD $0x000000008704c741             // movl	$0x00000000, (%r15,%rax,4)
+	QUAD $0x00000000850c8d48             // leaq	0(,%rax,4), %rcx
+	WORD $0x3948; BYTE $0xfa             // cmpq	%rdi, %rdx
+	JLE  BB0_8
+	QUAD $0x000000040f44c741; BYTE $0x00 // movl	$0x00000000, 4(%r15,%rcx)
+	LONG $0x02788d48                     // leaq	2(%rax), %rdi
+	WORD $0x3948; BYTE $0xfa             // cmpq	%rdi, %rdx
+	JLE  BB0_8
+	QUAD $0x000000080f44c741; BYTE $0x00 // movl	$0x00000000, 8(%r15,%rcx)
+	LONG $0x03788d48                     // leaq	3(%rax), %rdi
+	WORD $0x3948; BYTE $0xfa             // cmpq	%rdi, %rdx
+	JLE  BB0_8
+	QUAD $0x0000000c0f44c741; BYTE $0x00 // movl	$0x00000000, 12(%r15,%rcx)
+	LONG $0x04788d48                     // leaq	4(%rax), %rdi
+	WORD $0x3948; BYTE $0xfa             // cmpq	%rdi, %rdx
+	JLE  BB0_8
+	QUAD $0x000000100f44c741; BYTE $0x00 // movl	$0x00000000, 16(%r15,%rcx)
+	LONG $0x05788d48                     // leaq	5(%rax), %rdi
+	WORD $0x3948; BYTE $0xfa             // cmpq	%rdi, %rdx
+	JLE  BB0_8
+	QUAD $0x000000140f44c741; BYTE $0x00 // movl	$0x00000000, 20(%r15,%rcx)
+	LONG $0x06c08348                     // addq	$6, %rax
+	WORD $0x3948; BYTE $0xc2             // cmpq	%rax, %rdx
+	JLE  BB0_8
+	QUAD $0x000000180f44c741; BYTE $0x00 // movl	$0x00000000, 24(%r15,%rcx)
+
+BB0_8:
+	WORD $0x854d; BYTE $0xd2     // testq	%r10, %r10
+	JLE  BB0_55
+	WORD $0x854d; BYTE $0xc0     // testq	%r8, %r8
+	JLE  BB0_55
+	QUAD $0x000000a8249c8b48     // movq	168(%rsp), %rbx
+	WORD $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE  BB0_55
+	WORD $0x8948; BYTE $0xdf     // movq	%rbx, %rdi
+	WORD $0x8948; BYTE $0xda     // movq	%rbx, %rdx
+	LONG $0x02e3c148             // salq	$2, %rbx
+	WORD $0x894c; BYTE $0xc0     // movq	%r8, %rax
+	LONG $0x08e7c148             // salq	$8, %rdi
+	LONG $0x06e2c148             // salq	$6, %rdx
+	WORD $0x3145; BYTE $0xe4     // xorl	%r12d, %r12d
+	WORD $0x3145; BYTE $0xed     // xorl	%r13d, %r13d
+	LONG $0x247c8948; BYTE $0x60 // movq	%rdi, 96(%rsp)
+	LONG $0x06e0c148             // salq	$6, %rax
+	WORD $0x3145; BYTE $0xc9     // xorl	%r9d, %r9d
+	WORD $0x8949; BYTE $0xd3     // movq	%rdx, %r11
+	LONG $0x6ef9e1c4; BYTE $0xd3 // vmovq	%rbx, %xmm2
+	QUAD $0x00000000853c8d4a     // leaq	0(,%r8,4), %rdi
+	LONG $0x6ef941c4; BYTE $0xfe // vmovq	%r14, %xmm15
+	WORD $0x894c; BYTE $0xf9     // movq	%r15, %rcx
+	LONG $0x6ef9e1c4; BYTE $0xcf // vmovq	%rdi, %xmm1
+	LONG $0xf26f79c5             // vmovdqa	%xmm2, %xmm14
+	WORD $0x8949; BYTE $0xf6     // movq	%rsi, %r14
+	LONG $0xc96f79c5             // vmovdqa	%xmm1, %xmm9
+
+BB0_17:
+	LONG $0x244c894c; BYTE $0x70               // movq	%r9, 112(%rsp)
+	WORD $0x894c; BYTE $0xce                   // movq	%r9, %rsi
+	LONG $0x40c18349                           // addq	$64, %r9
+	WORD $0x894c; BYTE $0xd3                   // movq	%r10, %rbx
+	WORD $0x394d; BYTE $0xd1                   // cmpq	%r10, %r9
+	QUAD $0x0000008824b4894c                   // movq	%r14, 136(%rsp)
+	QUAD $0x000000902484c748; LONG $0x00000000 // movq	$0, 144(%rsp)
+	LONG $0xd94e0f49                           // cmovle	%r9, %rbx
+	WORD $0x3145; BYTE $0xff                   // xorl	%r15d, %r15d
+	QUAD $0x00000080249c8948                   // movq	%rbx, 128(%rsp)
+	WORD $0x3948; BYTE $0xf3                   // cmpq	%rsi, %rbx
+	JLE  BB0_14
+	LONG $0x244c894c; BYTE $0x58               // movq	%r9, 88(%rsp)
+	LONG $0x6f7941c4; BYTE $0xde               // vmovdqa	%xmm14, %xmm11
+	WORD $0x894c; BYTE $0xeb                   // movq	%r13, %rbx
+	WORD $0x894c; BYTE $0xde                   // movq	%r11, %rsi
+	LONG $0x24448948; BYTE $0x48               // movq	%rax, 72(%rsp)
+	LONG $0x2454894c; BYTE $0x50               // movq	%r10, 80(%rsp)
+	WORD $0x894d; BYTE $0xe2                   // movq	%r12, %r10
+	WORD $0x894d; BYTE $0xfc                   // movq	%r15, %r12
+
+BB0_19:
+	WORD $0x894d; BYTE $0xe3                   // movq	%r12, %r11
+	LONG $0x40c48349                           // addq	$64, %r12
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	WORD $0x394d; BYTE $0xc4                   // cmpq	%r8, %r12
+	LONG $0xc44e0f49                           // cmovle	%r12, %rax
+	WORD $0x394c; BYTE $0xd8                   // cmpq	%r11, %rax
+	JLE  BB0_16
+	LONG $0x181c8d4c                           // leaq	(%rax,%rbx), %r11
+	LONG $0x2464894c; BYTE $0x40               // movq	%r12, 64(%rsp)
+	WORD $0x894c; BYTE $0xd2                   // movq	%r10, %rdx
+	LONG $0x993c8d4a                           // leaq	(%rcx,%r11,4), %rdi
+	WORD $0x894d; BYTE $0xe3                   // movq	%r12, %r11
+	LONG $0x2444894c; BYTE $0x38               // movq	%r8, 56(%rsp)
+	WORD $0x2949; BYTE $0xc3                   // subq	%rax, %r11
+	LONG $0x247c8948; BYTE $0x68               // movq	%rdi, 104(%rsp)
+	LONG $0x245c8948; BYTE $0x30               // movq	%rbx, 48(%rsp)
+	QUAD $0xffffff009d2c8d4e                   // leaq	-256(,%r11,4), %r13
+	WORD $0x3145; BYTE $0xdb                   // xorl	%r11d, %r11d
+	LONG $0x24748948; BYTE $0x28               // movq	%rsi, 40(%rsp)
+	LONG $0x08fdc162; WORD $0xc56e             // vmovq	%r13, %xmm16
+	QUAD $0x000000a02484c748; LONG $0x00000010 // movq	$16, 160(%rsp)
+	LONG $0x244c8948; BYTE $0x20               // movq	%rcx, 32(%rsp)
+
+BB0_21:
+	QUAD $0x000000a824848b48                   // movq	168(%rsp), %rax
+	LONG $0x245c894c; BYTE $0x78               // movq	%r11, 120(%rsp)
+	LONG $0x00c38149; WORD $0x0001; BYTE $0x00 // addq	$256, %r11
+	WORD $0x8949; BYTE $0xd2                   // movq	%rdx, %r10
+	LONG $0x247c8b4c; BYTE $0x70               // movq	112(%rsp), %r15
+	LONG $0x245c894c; BYTE $0x18               // movq	%r11, 24(%rsp)
+	LONG $0x6f7941c4; BYTE $0xe3               // vmovdqa	%xmm11, %xmm12
+	LONG $0x08fd3162; WORD $0xd06f             // vmovdqa64	%xmm16, %xmm10
+	WORD $0x3949; BYTE $0xc3                   // cmpq	%rax, %r11
+	LONG $0x24548948; BYTE $0x10               // movq	%rdx, 16(%rsp)
+	LONG $0x7ef941c4; BYTE $0xf9               // vmovq	%xmm15, %r9
+	LONG $0xc34e0f49                           // cmovle	%r11, %rax
+	WORD $0x894d; BYTE $0xf8                   // movq	%r15, %r8
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	LONG $0x24448b48; BYTE $0x68               // movq	104(%rsp), %rax
+	QUAD $0x000000b024848948                   // movq	%rax, 176(%rsp)
+
+BB0_18:
+	QUAD $0x000000b024848b48     // movq	176(%rsp), %rax
+	QUAD $0x000000982484894c     // movq	%r8, 152(%rsp)
+	LONG $0x7ef961c4; BYTE $0xd3 // vmovq	%xmm10, %rbx
+	LONG $0x91348d4b             // leaq	(%r9,%r10,4), %rsi
+	QUAD $0x0000008824bc8b48     // movq	136(%rsp), %rdi
+	QUAD $0x00000090249c8b4c     // movq	144(%rsp), %r11
+	LONG $0xe57f79c5             // vmovdqa	%xmm12, %xmm5
+	WORD $0x0148; BYTE $0xc3     // addq	%rax, %rbx
+
+BB0_20:
+	QUAD $0x000000a024a48b4c // movq	160(%rsp), %r12
+	WORD $0x394c; BYTE $0xe1 // cmpq	%r12, %rcx
+	JL   BB0_33
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+
+BB0_23:
+	QUAD $0xffa65410487cb162 // vmovups	-64(%rsi,%r12,4), %zmm2
+	WORD $0x894d; BYTE $0xe0 // movq	%r12, %r8
+	QUAD $0xffa744b8486db262 // vfmadd231ps	-64(%rdi,%r12,4), %zmm2, %zmm0
+	LONG $0x10c48349         // addq	$16, %r12
+	WORD $0x394c; BYTE $0xe1 // cmpq	%r12, %rcx
+	JGE  BB0_23
+
+BB0_22:
+	LONG $0x48fdf362; WORD $0xc61b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm6
+	LONG $0xc058ccc5                           // vaddps	%ymm0, %ymm6, %ymm0
+	LONG $0x197de3c4; WORD $0x01c6             // vextractf128	$0x1, %ymm0, %xmm6
+	LONG $0xc058c8c5                           // vaddps	%xmm0, %xmm6, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ef0             // vpermilps	$78, %xmm0, %xmm6
+	LONG $0xf058c8c5                           // vaddps	%xmm0, %xmm6, %xmm6
+	LONG $0xc628f8c5                           // vmovaps	%xmm6, %xmm0
+	LONG $0xf6c6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm6
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_24
+	WORD $0x8949; BYTE $0xcd                   // movq	%rcx, %r13
+	QUAD $0x000000b82484894c                   // movq	%r8, 184(%rsp)
+	WORD $0x294d; BYTE $0xc5                   // subq	%r8, %r13
+	LONG $0xff658d4d                           // leaq	-1(%r13), %r12
+	LONG $0x0efc8349                           // cmpq	$14, %r12
+	JBE  BB0_34
+	LONG $0x10248d4f                           // leaq	(%r8,%r10), %r12
+	LONG $0xa13c8d4f                           // leaq	(%r9,%r12,4), %r15
+	LONG $0x18248d4f                           // leaq	(%r8,%r11), %r12
+	LONG $0xa6148d4b                           // leaq	(%r14,%r12,4), %rdx
+	WORD $0x894d; BYTE $0xec                   // movq	%r13, %r12
+	LONG $0x04ecc149                           // shrq	$4, %r12
+	WORD $0x894c; BYTE $0xe0                   // movq	%r12, %rax
+	WORD $0x3145; BYTE $0xe4                   // xorl	%r12d, %r12d
+	LONG $0x06e0c148                           // salq	$6, %rax
+
+BB0_26:
+	LONG $0x487cb162; WORD $0x1410; BYTE $0x22 // vmovups	(%rdx,%r12), %zmm2
+	LONG $0x486c9162; WORD $0x1459; BYTE $0x27 // vmulps	(%r15,%r12), %zmm2, %zmm2
+	LONG $0x40c48349                           // addq	$64, %r12
+	LONG $0xf2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm6
+	LONG $0xe2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm4
+	LONG $0x286df362; WORD $0xda03; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm3
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xd11b; BYTE $0x01 // vextractf32x8	$0x1, %zmm2, %ymm1
+	LONG $0xf9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm7
+	LONG $0xf058cac5                           // vaddss	%xmm0, %xmm6, %xmm6
+	LONG $0xc215e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm0
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0x286df362; WORD $0xf203; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm6
+	LONG $0xe058dac5                           // vaddss	%xmm0, %xmm4, %xmm4
+	LONG $0x287df362; WORD $0xd019; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xf058cac5                           // vaddss	%xmm0, %xmm6, %xmm6
+	LONG $0x286df362; WORD $0xc203; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm0
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm0
+	LONG $0xf358f2c5                           // vaddss	%xmm3, %xmm1, %xmm6
+	LONG $0xfe58c2c5                           // vaddss	%xmm6, %xmm7, %xmm7
+	LONG $0xf115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm6
+	LONG $0xf758cac5                           // vaddss	%xmm7, %xmm6, %xmm6
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xce19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm6
+	LONG $0xc058cac5                           // vaddss	%xmm0, %xmm6, %xmm0
+	LONG $0x2875f362; WORD $0xf103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm6
+	LONG $0xf058cac5                           // vaddss	%xmm0, %xmm6, %xmm6
+	LONG $0x2875f362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm0
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xe0                   // cmpq	%r12, %rax
+	JNE  BB0_26
+	WORD $0x894d; BYTE $0xec                   // movq	%r13, %r12
+	LONG $0xf0e48349                           // andq	$-16, %r12
+	WORD $0x014d; BYTE $0xe0                   // addq	%r12, %r8
+	LONG $0x0fc5f641                           // testb	$15, %r13b
+	JE   BB0_24
+
+BB0_25:
+	WORD $0x294d; BYTE $0xe5                   // subq	%r12, %r13
+	LONG $0xff458d49                           // leaq	-1(%r13), %rax
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_29
+	QUAD $0x000000b824948b48                   // movq	184(%rsp), %rdx
+	LONG $0x14048d49                           // leaq	(%r12,%rdx), %rax
+	WORD $0x014d; BYTE $0xdc                   // addq	%r11, %r12
+	WORD $0x0149; BYTE $0xd4                   // addq	%rdx, %r12
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+	LONG $0x107c81c4; WORD $0xa634             // vmovups	(%r14,%r12,4), %ymm6
+	LONG $0x594cc1c4; WORD $0x8134             // vmulps	(%r9,%rax,4), %ymm6, %ymm6
+	WORD $0x894d; BYTE $0xec                   // movq	%r13, %r12
+	LONG $0xf8e48349                           // andq	$-8, %r12
+	WORD $0x014d; BYTE $0xe0                   // addq	%r12, %r8
+	LONG $0x07e58341                           // andl	$7, %r13d
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xc6c648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm8
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0x587ac1c4; BYTE $0xc0               // vaddss	%xmm8, %xmm0, %xmm0
+	LONG $0xc61548c5                           // vunpckhps	%xmm6, %xmm6, %xmm8
+	LONG $0x587ac1c4; BYTE $0xc0               // vaddss	%xmm8, %xmm0, %xmm0
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xf719; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm7
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm7
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm7
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	JE   BB0_24
+
+BB0_29:
+	LONG $0x18248d4f               // leaq	(%r8,%r11), %r12
+	LONG $0x102c8d4f               // leaq	(%r8,%r10), %r13
+	LONG $0x107a81c4; WORD $0xa93c // vmovss	(%r9,%r13,4), %xmm7
+	LONG $0xb94182c4; WORD $0xa604 // vfmadd231ss	(%r14,%r12,4), %xmm7, %xmm0
+	LONG $0x01608d4d               // leaq	1(%r8), %r12
+	WORD $0x3949; BYTE $0xcc       // cmpq	%rcx, %r12
+	JGE  BB0_24
+	LONG $0x142c8d4f               // leaq	(%r12,%r10), %r13
+	WORD $0x014d; BYTE $0xdc       // addq	%r11, %r12
+	LONG $0x107a81c4; WORD $0xa914 // vmovss	(%r9,%r13,4), %xmm2
+	LONG $0xb96982c4; WORD $0xa604 // vfmadd231ss	(%r14,%r12,4), %xmm2, %xmm0
+	LONG $0x02608d4d               // leaq	2(%r8), %r12
+	WORD $0x394c; BYTE $0xe1       // cmpq	%r12, %rcx
+	JLE  BB0_24
+	LONG $0x232c8d4f               // leaq	(%r11,%r12), %r13
+	WORD $0x014d; BYTE $0xd4       // addq	%r10, %r12
+	LONG $0x107a81c4; WORD $0xae3c // vmovss	(%r14,%r13,4), %xmm7
+	LONG $0xb94182c4; WORD $0xa104 // vfmadd231ss	(%r9,%r12,4), %xmm7, %xmm0
+	LONG $0x03608d4d               // leaq	3(%r8), %r12
+	WORD $0x394c; BYTE $0xe1       // cmpq	%r12, %rcx
+	JLE  BB0_24
+	LONG $0x222c8d4f               // leaq	(%r10,%r12), %r13
+	WORD $0x014d; BYTE $0xdc       // addq	%r11, %r12
+	LONG $0x107a81c4; WORD $0xa93c // vmovss	(%r9,%r13,4), %xmm7
+	LONG $0xb94182c4; WORD $0xa604 // vfmadd231ss	(%r14,%r12,4), %xmm7, %xmm0
+	LONG $0x04608d4d               // leaq	4(%r8), %r12
+	WORD $0x394c; BYTE $0xe1       // cmpq	%r12, %rcx
+	JLE  BB0_24
+	LONG $0x222c8d4f               // leaq	(%r10,%r12), %r13
+	WORD $0x014d; BYTE $0xdc       // addq	%r11, %r12
+	LONG $0x107a81c4; WORD $0xa914 // vmovss	(%r9,%r13,4), %xmm2
+	LONG $0xb96982c4; WORD $0xa604 // vfmadd231ss	(%r14,%r12,4), %xmm2, %xmm0
+	LONG $0x05608d4d               // leaq	5(%r8), %r12
+	WORD $0x394c; BYTE $0xe1       // cmpq	%r12, %rcx
+	JLE  BB0_24
+	LONG $0x222c8d4f               // leaq	(%r10,%r12), %r13
+	LONG $0x06c08349               // addq	$6, %r8
+	WORD $0x014d; BYTE $0xdc       // addq	%r11, %r12
+	LONG $0x107a81c4; WORD $0xa914 // vmovss	(%r9,%r13,4), %xmm2
+	LONG $0xb96982c4; WORD $0xa604 // vfmadd231ss	(%r14,%r12,4), %xmm2, %xmm0
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_24
+	LONG $0x03248d4f               // leaq	(%r11,%r8), %r12
+	WORD $0x014d; BYTE $0xd0       // addq	%r10, %r8
+	LONG $0x107a81c4; WORD $0xa63c // vmovss	(%r14,%r12,4), %xmm7
+	LONG $0xb94182c4; WORD $0x8104 // vfmadd231ss	(%r9,%r8,4), %xmm7, %xmm0
+
+BB0_24:
+	LONG $0x0358fac5                           // vaddss	(%rbx), %xmm0, %xmm0
+	QUAD $0x000000a824848b48                   // movq	168(%rsp), %rax
+	LONG $0x04c38348                           // addq	$4, %rbx
+	WORD $0x0149; BYTE $0xc3                   // addq	%rax, %r11
+	LONG $0x7ef9e1c4; BYTE $0xe8               // vmovq	%xmm5, %rax
+	LONG $0x4311fac5; BYTE $0xfc               // vmovss	%xmm0, -4(%rbx)
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	QUAD $0x000000b0249c3948                   // cmpq	%rbx, 176(%rsp)
+	JNE  BB0_20
+	QUAD $0x0000009824848b4c                   // movq	152(%rsp), %r8
+	QUAD $0x000000a824848b48                   // movq	168(%rsp), %rax
+	LONG $0x7ef961c4; BYTE $0xcb               // vmovq	%xmm9, %rbx
+	QUAD $0x000000b0249c0148                   // addq	%rbx, 176(%rsp)
+	LONG $0x01c08349                           // addq	$1, %r8
+	WORD $0x0149; BYTE $0xc2                   // addq	%rax, %r10
+	QUAD $0x000000802484394c                   // cmpq	%r8, 128(%rsp)
+	JNE  BB0_18
+	LONG $0x245c8b4c; BYTE $0x18               // movq	24(%rsp), %r11
+	LONG $0x24548b48; BYTE $0x10               // movq	16(%rsp), %rdx
+	LONG $0x6f7941c4; BYTE $0xdc               // vmovdqa	%xmm12, %xmm11
+	QUAD $0x000000a024848148; LONG $0x00000100 // addq	$256, 160(%rsp)
+	WORD $0x3949; BYTE $0xc3                   // cmpq	%rax, %r11
+	JL   BB0_21
+	LONG $0x24648b4c; BYTE $0x40               // movq	64(%rsp), %r12
+	LONG $0x24448b4c; BYTE $0x38               // movq	56(%rsp), %r8
+	WORD $0x8949; BYTE $0xd2                   // movq	%rdx, %r10
+	LONG $0x245c8b48; BYTE $0x30               // movq	48(%rsp), %rbx
+	LONG $0x24748b48; BYTE $0x28               // movq	40(%rsp), %rsi
+	LONG $0x244c8b48; BYTE $0x20               // movq	32(%rsp), %rcx
+
+BB0_16:
+	LONG $0x247c8b48; BYTE $0x60 // movq	96(%rsp), %rdi
+	QUAD $0x0000009024b40148     // addq	%rsi, 144(%rsp)
+	QUAD $0x0000008824bc0148     // addq	%rdi, 136(%rsp)
+	WORD $0x394d; BYTE $0xc4     // cmpq	%r8, %r12
+	JL   BB0_19
+	WORD $0x894d; BYTE $0xd4     // movq	%r10, %r12
+	LONG $0x244c8b4c; BYTE $0x58 // movq	88(%rsp), %r9
+	LONG $0x24448b48; BYTE $0x48 // movq	72(%rsp), %rax
+	WORD $0x8949; BYTE $0xdd     // movq	%rbx, %r13
+	LONG $0x24548b4c; BYTE $0x50 // movq	80(%rsp), %r10
+	WORD $0x8949; BYTE $0xf3     // movq	%rsi, %r11
+
+BB0_14:
+	WORD $0x0149; BYTE $0xc5 // addq	%rax, %r13
+	WORD $0x014d; BYTE $0xdc // addq	%r11, %r12
+	WORD $0x394d; BYTE $0xd1 // cmpq	%r10, %r9
+	JL   BB0_17
+
+BB0_55:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x10a58d48; WORD $0xffff; BYTE $0xff // leaq	-240(%rbp), %rsp
+	RET
+
+BB0_33:
+	LONG $0x24448b4c; BYTE $0x78 // movq	120(%rsp), %r8
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+	JMP  BB0_22
+
+BB0_34:
+	WORD $0x3145; BYTE $0xe4 // xorl	%r12d, %r12d
+	JMP  BB0_25
+
+BB0_32:
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_5
@@ -0,0 +1,306 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmulklastblocked_c_f64_avx2_amd64.c
+
+TEXT ·matmulklastblocked_c_f64_avx2(SB), $288-72
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ c+16(FP), DX
+	MOVQ pm+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_a+48(FP), R11
+	MOVQ R11, 256(SP)
+	MOVQ plen_b+56(FP), R11
+	MOVQ R11, 264(SP)
+	MOVQ plen_c+64(FP), R11
+	MOVQ R11, 272(SP)
+	WORD $0x8949; BYTE $0xd3     // movq	%rdx, %r11
+	QUAD $0x000000f024ac8d48     // leaq	240(%rsp), %rbp
+	WORD $0x8949; BYTE $0xff     // movq	%rdi, %r15
+	WORD $0x8949; BYTE $0xf6     // movq	%rsi, %r14
+	LONG $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348             // andq	$-32, %rsp
+	WORD $0x8b49; BYTE $0x01     // movq	(%r9), %rax
+	WORD $0x8b48; BYTE $0x19     // movq	(%rcx), %rbx
+	WORD $0x8b49; BYTE $0x08     // movq	(%r8), %rcx
+	QUAD $0x000000c824848948     // movq	%rax, 200(%rsp)
+	WORD $0x8948; BYTE $0xd8     // movq	%rbx, %rax
+	LONG $0xc1af0f48             // imulq	%rcx, %rax
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JLE  BB0_8
+	LONG $0xff508d48             // leaq	-1(%rax), %rdx
+	LONG $0x02fa8348             // cmpq	$2, %rdx
+	JBE  BB0_30
+	WORD $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+	WORD $0x894c; BYTE $0xde     // movq	%r11, %rsi
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x02eac148             // shrq	$2, %rdx
+	LONG $0x05e2c148             // salq	$5, %rdx
+	WORD $0x014c; BYTE $0xda     // addq	%r11, %rdx
+
+BB0_6:
+	LONG $0x0611fdc5         // vmovupd	%ymm0, (%rsi)
+	LONG $0x20c68348         // addq	$32, %rsi
+	WORD $0x3948; BYTE $0xd6 // cmpq	%rdx, %rsi
+	JNE  BB0_6
+	WORD $0x8948; BYTE $0xc2 // movq	%rax, %rdx
+	LONG $0xfce28348         // andq	$-4, %rdx
+	WORD $0x03a8             // testb	$3, %al
+	JE   BB0_8
+
+BB0_5:
+	LONG $0x017a8d48                     // leaq	1(%rdx), %rdi
+	QUAD $0x00000000d304c749             // movq	$0x000000000, (%r11,%rdx,8)
+	QUAD $0x00000000d5348d48             // leaq	0(,%rdx,8), %rsi
+	WORD $0x3948; BYTE $0xf8             // cmpq	%rdi, %rax
+	JLE  BB0_8
+	QUAD $0x000000083344c749; BYTE $0x00 // movq	$0x000000000, 8(%r11,%rsi)
+	LONG $0x02c28348                     // addq	$2, %rdx
+	WORD $0x3948; BYTE $0xc2             // cmpq	%rax, %rdx
+	JGE  BB0_8
+	QUAD $0x000000103344c749; BYTE $0x00 // movq	$0x000000000, 16(%r11,%rsi)
+
+BB0_8:
+	WORD $0x8548; BYTE $0xdb             // testq	%rbx, %rbx
+	JLE  BB0_56
+	WORD $0x8548; BYTE $0xc9             // testq	%rcx, %rcx
+	JLE  BB0_56
+	QUAD $0x000000c824848b48             // movq	200(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0             // testq	%rax, %rax
+	JLE  BB0_56
+	WORD $0x8948; BYTE $0xc7             // movq	%rax, %rdi
+	WORD $0x8949; BYTE $0xcd             // movq	%rcx, %r13
+	WORD $0x3145; BYTE $0xc0             // xorl	%r8d, %r8d
+	WORD $0xd231                         // xorl	%edx, %edx
+	LONG $0x06e7c148                     // salq	$6, %rdi
+	LONG $0x06e5c149                     // salq	$6, %r13
+	QUAD $0x000000782444c748; BYTE $0x00 // movq	$0, 120(%rsp)
+	LONG $0x247c8948; BYTE $0x70         // movq	%rdi, 112(%rsp)
+	WORD $0x8948; BYTE $0xc7             // movq	%rax, %rdi
+	LONG $0x03e0c148                     // salq	$3, %rax
+	LONG $0x09e7c148                     // salq	$9, %rdi
+	QUAD $0x000000b824848948             // movq	%rax, 184(%rsp)
+	WORD $0x894c; BYTE $0xe8             // movq	%r13, %rax
+	WORD $0x894d; BYTE $0xdd             // movq	%r11, %r13
+	LONG $0x247c8948; BYTE $0x58         // movq	%rdi, 88(%rsp)
+	QUAD $0x00000000cd3c8d48             // leaq	0(,%rcx,8), %rdi
+	WORD $0x894d; BYTE $0xc3             // movq	%r8, %r11
+	WORD $0x8949; BYTE $0xc8             // movq	%rcx, %r8
+	QUAD $0x0000008824bc8948             // movq	%rdi, 136(%rsp)
+
+BB0_15:
+	LONG $0x24548948; BYTE $0x68 // movq	%rdx, 104(%rsp)
+	WORD $0x8948; BYTE $0xd6     // movq	%rdx, %rsi
+	LONG $0x40c28348             // addq	$64, %rdx
+	WORD $0x8949; BYTE $0xdc     // movq	%rbx, %r12
+	WORD $0x3948; BYTE $0xda     // cmpq	%rbx, %rdx
+	WORD $0x894c; BYTE $0xf7     // movq	%r14, %rdi
+	LONG $0xe24e0f4c             // cmovle	%rdx, %r12
+	WORD $0x3145; BYTE $0xd2     // xorl	%r10d, %r10d
+	WORD $0xc931                 // xorl	%ecx, %ecx
+	WORD $0x3949; BYTE $0xf4     // cmpq	%rsi, %r12
+	JLE  BB0_12
+	LONG $0x24548948; BYTE $0x50 // movq	%rdx, 80(%rsp)
+	WORD $0x8948; BYTE $0xc6     // movq	%rax, %rsi
+	LONG $0x245c8948; BYTE $0x48 // movq	%rbx, 72(%rsp)
+
+BB0_17:
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	LONG $0x40c18348                           // addq	$64, %rcx
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	LONG $0xc14e0f48                           // cmovle	%rcx, %rax
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JLE  BB0_14
+	LONG $0x18148d4a                           // leaq	(%rax,%r11), %rdx
+	LONG $0x244c8948; BYTE $0x40               // movq	%rcx, 64(%rsp)
+	LONG $0xd55c8d49; BYTE $0x00               // leaq	0(%r13,%rdx,8), %rbx
+	LONG $0x245c894c; BYTE $0x38               // movq	%r11, 56(%rsp)
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	QUAD $0x000000c02484c748; LONG $0x00000004 // movq	$4, 192(%rsp)
+	WORD $0x2948; BYTE $0xc2                   // subq	%rax, %rdx
+	WORD $0xc031                               // xorl	%eax, %eax
+	LONG $0x245c8948; BYTE $0x60               // movq	%rbx, 96(%rsp)
+	QUAD $0xfffffe00d51c8d48                   // leaq	-512(,%rdx,8), %rbx
+
+BB0_19:
+	QUAD $0x000000c8248c8b48       // movq	200(%rsp), %rcx
+	LONG $0x24548b48; BYTE $0x60   // movq	96(%rsp), %rdx
+	QUAD $0x0000008024848948       // movq	%rax, 128(%rsp)
+	LONG $0x01000548; WORD $0x0000 // addq	$256, %rax
+	LONG $0x24448948; BYTE $0x30   // movq	%rax, 48(%rsp)
+	LONG $0x245c8b4c; BYTE $0x78   // movq	120(%rsp), %r11
+	WORD $0x3948; BYTE $0xc8       // cmpq	%rcx, %rax
+	LONG $0x2444894c; BYTE $0x28   // movq	%r8, 40(%rsp)
+	QUAD $0x000000a824a4894c       // movq	%r12, 168(%rsp)
+	LONG $0xc84e0f48               // cmovle	%rax, %rcx
+	QUAD $0x000000a0249c8948       // movq	%rbx, 160(%rsp)
+	QUAD $0x000000982494894c       // movq	%r10, 152(%rsp)
+	QUAD $0x0000009024bc8948       // movq	%rdi, 144(%rsp)
+	LONG $0x24748948; BYTE $0x20   // movq	%rsi, 32(%rsp)
+	LONG $0x246c894c; BYTE $0x18   // movq	%r13, 24(%rsp)
+	QUAD $0x000000d024948948       // movq	%rdx, 208(%rsp)
+	LONG $0x24548b48; BYTE $0x68   // movq	104(%rsp), %rdx
+
+BB0_16:
+	QUAD $0x000000d024848b48 // movq	208(%rsp), %rax
+	QUAD $0x000000a024bc8b48 // movq	160(%rsp), %rdi
+	QUAD $0x000000b024948948 // movq	%rdx, 176(%rsp)
+	LONG $0xdf0c8d4f         // leaq	(%r15,%r11,8), %r9
+	QUAD $0x0000009024b48b48 // movq	144(%rsp), %rsi
+	QUAD $0x0000009824848b4c // movq	152(%rsp), %r8
+	LONG $0x382c8d4c         // leaq	(%rax,%rdi), %r13
+
+BB0_18:
+	QUAD $0x000000c024948b48 // movq	192(%rsp), %rdx
+	WORD $0x3948; BYTE $0xd1 // cmpq	%rdx, %rcx
+	JL   BB0_31
+	LONG $0xc957f1c5         // vxorpd	%xmm1, %xmm1, %xmm1
+
+BB0_21:
+	LONG $0x107dc1c4; WORD $0xd164; BYTE $0xe0 // vmovupd	-32(%r9,%rdx,8), %ymm4
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0xb8dde2c4; WORD $0xd64c; BYTE $0xe0 // vfmadd231pd	-32(%rsi,%rdx,8), %ymm4, %ymm1
+	LONG $0x04c28348                           // addq	$4, %rdx
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JGE  BB0_21
+
+BB0_20:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_22
+	WORD $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	QUAD $0x000000d824848948       // movq	%rax, 216(%rsp)
+	WORD $0x2948; BYTE $0xc7       // subq	%rax, %rdi
+	LONG $0xff578d48               // leaq	-1(%rdi), %rdx
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_32
+	LONG $0x03148d49               // leaq	(%r11,%rax), %rdx
+	WORD $0x8949; BYTE $0xfa       // movq	%rdi, %r10
+	LONG $0xd7248d4d               // leaq	(%r15,%rdx,8), %r12
+	LONG $0x02eac149               // shrq	$2, %r10
+	LONG $0x00148d49               // leaq	(%r8,%rax), %rdx
+	LONG $0xd61c8d49               // leaq	(%r14,%rdx,8), %rbx
+	LONG $0x05e2c149               // salq	$5, %r10
+	WORD $0xd231                   // xorl	%edx, %edx
+
+BB0_24:
+	LONG $0x2c10fdc5; BYTE $0x13   // vmovupd	(%rbx,%rdx), %ymm5
+	LONG $0x5955c1c4; WORD $0x1414 // vmulpd	(%r12,%rdx), %ymm5, %ymm2
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xc258fbc5               // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xda15e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm3
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f3c5               // vaddsd	%xmm3, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd2       // cmpq	%rdx, %r10
+	JNE  BB0_24
+	LONG $0x03c7f640               // testb	$3, %dil
+	JE   BB0_22
+	WORD $0x8948; BYTE $0xfa       // movq	%rdi, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+
+BB0_23:
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0x01ff8348               // cmpq	$1, %rdi
+	JE   BB0_27
+	QUAD $0x000000d8249c8b48       // movq	216(%rsp), %rbx
+	LONG $0x10148d4d               // leaq	(%r8,%rdx), %r10
+	WORD $0x014c; BYTE $0xda       // addq	%r11, %rdx
+	WORD $0x0149; BYTE $0xda       // addq	%rbx, %r10
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x1079c1c4; WORD $0xd70c // vmovupd	(%r15,%rdx,8), %xmm1
+	LONG $0x597181c4; WORD $0xd60c // vmulpd	(%r14,%r10,8), %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0x01c7f640               // testb	$1, %dil
+	JE   BB0_22
+	LONG $0xfee78348               // andq	$-2, %rdi
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+
+BB0_27:
+	LONG $0x00148d49               // leaq	(%r8,%rax), %rdx
+	WORD $0x014c; BYTE $0xd8       // addq	%r11, %rax
+	LONG $0x107bc1c4; WORD $0xd634 // vmovsd	(%r14,%rdx,8), %xmm6
+	LONG $0xb9c9c2c4; WORD $0xc704 // vfmadd231sd	(%r15,%rax,8), %xmm6, %xmm0
+
+BB0_22:
+	QUAD $0x000000c824848b48                   // movq	200(%rsp), %rax
+	LONG $0x587bc1c4; WORD $0x0045             // vaddsd	0(%r13), %xmm0, %xmm0
+	LONG $0x08c58349                           // addq	$8, %r13
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	QUAD $0x000000b824848b48                   // movq	184(%rsp), %rax
+	LONG $0x117bc1c4; WORD $0xf845             // vmovsd	%xmm0, -8(%r13)
+	WORD $0x0148; BYTE $0xc6                   // addq	%rax, %rsi
+	QUAD $0x000000d024ac394c                   // cmpq	%r13, 208(%rsp)
+	JNE  BB0_18
+	QUAD $0x000000b024948b48                   // movq	176(%rsp), %rdx
+	QUAD $0x000000c824848b48                   // movq	200(%rsp), %rax
+	QUAD $0x0000008824bc8b48                   // movq	136(%rsp), %rdi
+	QUAD $0x000000d024bc0148                   // addq	%rdi, 208(%rsp)
+	LONG $0x01c28348                           // addq	$1, %rdx
+	WORD $0x0149; BYTE $0xc3                   // addq	%rax, %r11
+	QUAD $0x000000a824943948                   // cmpq	%rdx, 168(%rsp)
+	JNE  BB0_16
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	LONG $0x24448b48; BYTE $0x30               // movq	48(%rsp), %rax
+	QUAD $0x000000c024848148; LONG $0x00000100 // addq	$256, 192(%rsp)
+	LONG $0x24448b4c; BYTE $0x28               // movq	40(%rsp), %r8
+	QUAD $0x000000a824a48b4c                   // movq	168(%rsp), %r12
+	QUAD $0x000000a0249c8b48                   // movq	160(%rsp), %rbx
+	QUAD $0x0000009824948b4c                   // movq	152(%rsp), %r10
+	QUAD $0x0000009024bc8b48                   // movq	144(%rsp), %rdi
+	LONG $0x24748b48; BYTE $0x20               // movq	32(%rsp), %rsi
+	LONG $0x246c8b4c; BYTE $0x18               // movq	24(%rsp), %r13
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JL   BB0_19
+	LONG $0x244c8b48; BYTE $0x40               // movq	64(%rsp), %rcx
+	LONG $0x245c8b4c; BYTE $0x38               // movq	56(%rsp), %r11
+
+BB0_14:
+	LONG $0x24448b48; BYTE $0x70 // movq	112(%rsp), %rax
+	WORD $0x0149; BYTE $0xc2     // addq	%rax, %r10
+	LONG $0x24448b48; BYTE $0x58 // movq	88(%rsp), %rax
+	WORD $0x0148; BYTE $0xc7     // addq	%rax, %rdi
+	WORD $0x394c; BYTE $0xc1     // cmpq	%r8, %rcx
+	JL   BB0_17
+	LONG $0x24548b48; BYTE $0x50 // movq	80(%rsp), %rdx
+	LONG $0x245c8b48; BYTE $0x48 // movq	72(%rsp), %rbx
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+
+BB0_12:
+	LONG $0x24748b48; BYTE $0x70 // movq	112(%rsp), %rsi
+	WORD $0x0149; BYTE $0xc3     // addq	%rax, %r11
+	LONG $0x24740148; BYTE $0x78 // addq	%rsi, 120(%rsp)
+	WORD $0x3948; BYTE $0xda     // cmpq	%rbx, %rdx
+	JL   BB0_15
+
+BB0_56:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x10a58d48; WORD $0xffff; BYTE $0xff // leaq	-240(%rbp), %rsp
+	RET
+
+BB0_31:
+	QUAD $0x0000008024848b48 // movq	128(%rsp), %rax
+	LONG $0xc957f1c5         // vxorpd	%xmm1, %xmm1, %xmm1
+	JMP  BB0_20
+
+BB0_32:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_23
+
+BB0_30:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_5
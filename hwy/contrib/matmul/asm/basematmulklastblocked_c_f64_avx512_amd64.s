@@ -0,0 +1,370 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basematmulklastblocked_c_f64_avx512_amd64.c
+
+TEXT ·matmulklastblocked_c_f64_avx512(SB), $288-72
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ c+16(FP), DX
+	MOVQ pm+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_a+48(FP), R11
+	MOVQ R11, 256(SP)
+	MOVQ plen_b+56(FP), R11
+	MOVQ R11, 264(SP)
+	MOVQ plen_c+64(FP), R11
+	MOVQ R11, 272(SP)
+	WORD $0x8949; BYTE $0xd2     // movq	%rdx, %r10
+	QUAD $0x000000f024ac8d48     // leaq	240(%rsp), %rbp
+	WORD $0x8949; BYTE $0xf7     // movq	%rsi, %r15
+	WORD $0x8949; BYTE $0xfe     // movq	%rdi, %r14
+	LONG $0x24648d48; BYTE $0x40 // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348             // andq	$-64, %rsp
+	WORD $0x8b48; BYTE $0x19     // movq	(%rcx), %rbx
+	WORD $0x8b49; BYTE $0x01     // movq	(%r9), %rax
+	WORD $0x8b4d; BYTE $0x08     // movq	(%r8), %r9
+	WORD $0x8948; BYTE $0xda     // movq	%rbx, %rdx
+	QUAD $0x000000a824848948     // movq	%rax, 168(%rsp)
+	LONG $0xd1af0f49             // imulq	%r9, %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JLE  BB0_8
+	LONG $0xff428d48             // leaq	-1(%rdx), %rax
+	LONG $0x06f88348             // cmpq	$6, %rax
+	JBE  BB0_30
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	WORD $0x894c; BYTE $0xd1     // movq	%r10, %rcx
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x03e8c148             // shrq	$3, %rax
+	LONG $0x06e0c148             // salq	$6, %rax
+	WORD $0x014c; BYTE $0xd0     // addq	%r10, %rax
+
+BB0_6:
+	LONG $0x48fdf162; WORD $0x0111 // vmovupd	%zmm0, (%rcx)
+	LONG $0x40c18348               // addq	$64, %rcx
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JNE  BB0_6
+	WORD $0x8948; BYTE $0xd0       // movq	%rdx, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0xc2f6; BYTE $0x07       // testb	$7, %dl
+	JE   BB0_8
+
+BB0_5:
+	LONG $0x01708d48                     // leaq	1(%rax), %rsi
+	QUAD $0x00000000c204c749             // movq	$0x000000000, (%r10,%rax,8)
+	QUAD $0x00000000c50c8d48             // leaq	0(,%rax,8), %rcx
+	WORD $0x3948; BYTE $0xf2             // cmpq	%rsi, %rdx
+	JLE  BB0_8
+	QUAD $0x000000080a44c749; BYTE $0x00 // movq	$0x000000000, 8(%r10,%rcx)
+	LONG $0x02708d48                     // leaq	2(%rax), %rsi
+	WORD $0x3948; BYTE $0xf2             // cmpq	%rsi, %rdx
+	JLE  BB0_8
+	QUAD $0x000000100a44c749; BYTE $0x00 // movq	$0x000000000, 16(%r10,%rcx)
+	LONG $0x03708d48                     // leaq	3(%rax), %rsi
+	WORD $0x3948; BYTE $0xf2             // cmpq	%rsi, %rdx
+	JLE  BB0_8
+	QUAD $0x000000180a44c749; BYTE $0x00 // movq	$0x000000000, 24(%r10,%rcx)
+	LONG $0x04708d48                     // leaq	4(%rax), %rsi
+	WORD $0x3948; BYTE $0xf2             // cmpq	%rsi, %rdx
+	JLE  BB0_8
+	QUAD $0x000000200a44c749; BYTE $0x00 // movq	$0x000000000, 32(%r10,%rcx)
+	LONG $0x05708d48                     // leaq	5(%rax), %rsi
+	WORD $0x3948; BYTE $0xf2             // cmpq	%rsi, %rdx
+	JLE  BB0_8
+	QUAD $0x000000280a44c749; BYTE $0x00 // movq	$0x000000000, 40(%r10,%rcx)
+	LONG $0x06c08348                     // addq	$6, %rax
+	WORD $0x3948; BYTE $0xc2             // cmpq	%rax, %rdx
+	JLE  BB0_8
+	QUAD $0x000000300a44c749; BYTE $0x00 // movq	$0x000000000, 48(%r10,%rcx)
+
+BB0_8:
+	WORD $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE  BB0_50
+	WORD $0x854d; BYTE $0xc9     // testq	%r9, %r9
+	JLE  BB0_50
+	QUAD $0x000000a824948b48     // movq	168(%rsp), %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JLE  BB0_50
+	WORD $0x8948; BYTE $0xd1     // movq	%rdx, %rcx
+	WORD $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	LONG $0x03e2c148             // salq	$3, %rdx
+	WORD $0x894c; BYTE $0xc8     // movq	%r9, %rax
+	LONG $0x09e1c148             // salq	$9, %rcx
+	LONG $0x06e7c148             // salq	$6, %rdi
+	WORD $0x3145; BYTE $0xe4     // xorl	%r12d, %r12d
+	WORD $0x3145; BYTE $0xdb     // xorl	%r11d, %r11d
+	LONG $0x244c8948; BYTE $0x58 // movq	%rcx, 88(%rsp)
+	QUAD $0x00000000cd0c8d4a     // leaq	0(,%r9,8), %rcx
+	LONG $0x06e0c148             // salq	$6, %rax
+	WORD $0x3145; BYTE $0xc0     // xorl	%r8d, %r8d
+	LONG $0x6ef9e1c4; BYTE $0xc9 // vmovq	%rcx, %xmm1
+	LONG $0x6ef9e1c4; BYTE $0xd2 // vmovq	%rdx, %xmm2
+	WORD $0x894c; BYTE $0xd1     // movq	%r10, %rcx
+	WORD $0x8948; BYTE $0xda     // movq	%rbx, %rdx
+	LONG $0x6ef941c4; BYTE $0xf6 // vmovq	%r14, %xmm14
+	WORD $0x8949; BYTE $0xfa     // movq	%rdi, %r10
+	WORD $0x894c; BYTE $0xe3     // movq	%r12, %rbx
+	WORD $0x894d; BYTE $0xfe     // movq	%r15, %r14
+	LONG $0xfa6f79c5             // vmovdqa	%xmm2, %xmm15
+	LONG $0xc96f79c5             // vmovdqa	%xmm1, %xmm9
+	WORD $0x8948; BYTE $0xcf     // movq	%rcx, %rdi
+
+BB0_15:
+	LONG $0x2444894c; BYTE $0x68 // movq	%r8, 104(%rsp)
+	WORD $0x894c; BYTE $0xc1     // movq	%r8, %rcx
+	LONG $0x40c08349             // addq	$64, %r8
+	WORD $0x8949; BYTE $0xd5     // movq	%rdx, %r13
+	WORD $0x3949; BYTE $0xd0     // cmpq	%rdx, %r8
+	QUAD $0x0000009024b4894c     // movq	%r14, 144(%rsp)
+	LONG $0xe84e0f4d             // cmovle	%r8, %r13
+	WORD $0x3145; BYTE $0xff     // xorl	%r15d, %r15d
+	WORD $0x3145; BYTE $0xe4     // xorl	%r12d, %r12d
+	WORD $0x3949; BYTE $0xcd     // cmpq	%rcx, %r13
+	JLE  BB0_12
+	LONG $0x2444894c; BYTE $0x50 // movq	%r8, 80(%rsp)
+	LONG $0x6f7941c4; BYTE $0xd7 // vmovdqa	%xmm15, %xmm10
+	WORD $0x8948; BYTE $0xde     // movq	%rbx, %rsi
+	LONG $0x24548948; BYTE $0x48 // movq	%rdx, 72(%rsp)
+	LONG $0x246c894c; BYTE $0x78 // movq	%r13, 120(%rsp)
+	WORD $0x894d; BYTE $0xe5     // movq	%r12, %r13
+	LONG $0x245c894c; BYTE $0x70 // movq	%r11, 112(%rsp)
+	WORD $0x8949; BYTE $0xc3     // movq	%rax, %r11
+
+BB0_17:
+	WORD $0x894c; BYTE $0xe9                   // movq	%r13, %rcx
+	LONG $0x40c58349                           // addq	$64, %r13
+	WORD $0x894c; BYTE $0xca                   // movq	%r9, %rdx
+	WORD $0x394d; BYTE $0xcd                   // cmpq	%r9, %r13
+	LONG $0xd54e0f49                           // cmovle	%r13, %rdx
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_14
+	LONG $0x320c8d48                           // leaq	(%rdx,%rsi), %rcx
+	WORD $0x894c; BYTE $0xeb                   // movq	%r13, %rbx
+	QUAD $0x000000a02484c748; LONG $0x00000008 // movq	$8, 160(%rsp)
+	LONG $0xcf048d48                           // leaq	(%rdi,%rcx,8), %rax
+	WORD $0x2948; BYTE $0xd3                   // subq	%rdx, %rbx
+	WORD $0xd231                               // xorl	%edx, %edx
+	LONG $0x246c894c; BYTE $0x40               // movq	%r13, 64(%rsp)
+	LONG $0x24448948; BYTE $0x60               // movq	%rax, 96(%rsp)
+	QUAD $0xfffffe00dd0c8d48                   // leaq	-512(,%rbx,8), %rcx
+	LONG $0x244c894c; BYTE $0x38               // movq	%r9, 56(%rsp)
+	LONG $0x08fde162; WORD $0xc16e             // vmovq	%rcx, %xmm16
+	WORD $0x8948; BYTE $0xd1                   // movq	%rdx, %rcx
+	QUAD $0x0000008824bc894c                   // movq	%r15, 136(%rsp)
+	LONG $0x24748948; BYTE $0x30               // movq	%rsi, 48(%rsp)
+
+BB0_19:
+	LONG $0x245c894c; BYTE $0x20               // movq	%r11, 32(%rsp)
+	LONG $0x245c8b48; BYTE $0x70               // movq	112(%rsp), %rbx
+	LONG $0x6f7941c4; BYTE $0xea               // vmovdqa	%xmm10, %xmm13
+	LONG $0x08fd3162; WORD $0xd86f             // vmovdqa64	%xmm16, %xmm11
+	QUAD $0x000000a824848b48                   // movq	168(%rsp), %rax
+	LONG $0x24448b4c; BYTE $0x68               // movq	104(%rsp), %r8
+	LONG $0x2454894c; BYTE $0x18               // movq	%r10, 24(%rsp)
+	QUAD $0x00000080248c8948                   // movq	%rcx, 128(%rsp)
+	LONG $0x00c18148; WORD $0x0001; BYTE $0x00 // addq	$256, %rcx
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	LONG $0x244c8948; BYTE $0x28               // movq	%rcx, 40(%rsp)
+	LONG $0xc14e0f48                           // cmovle	%rcx, %rax
+	LONG $0x247c8948; BYTE $0x10               // movq	%rdi, 16(%rsp)
+	WORD $0x8948; BYTE $0xc6                   // movq	%rax, %rsi
+	LONG $0x24448b48; BYTE $0x60               // movq	96(%rsp), %rax
+	QUAD $0x000000b024848948                   // movq	%rax, 176(%rsp)
+
+BB0_16:
+	QUAD $0x000000b024848b48     // movq	176(%rsp), %rax
+	LONG $0x7ef961c4; BYTE $0xda // vmovq	%xmm11, %rdx
+	QUAD $0x000000982484894c     // movq	%r8, 152(%rsp)
+	LONG $0xed7f79c5             // vmovdqa	%xmm13, %xmm5
+	QUAD $0x0000009024bc8b48     // movq	144(%rsp), %rdi
+	QUAD $0x00000088248c8b4c     // movq	136(%rsp), %r9
+	LONG $0x10148d4c             // leaq	(%rax,%rdx), %r10
+	LONG $0x7ef961c4; BYTE $0xf0 // vmovq	%xmm14, %rax
+	LONG $0xd8148d48             // leaq	(%rax,%rbx,8), %rdx
+	WORD $0x8948; BYTE $0xd1     // movq	%rdx, %rcx
+	WORD $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+
+BB0_18:
+	QUAD $0x000000a024848b48 // movq	160(%rsp), %rax
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JL   BB0_31
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+
+BB0_21:
+	QUAD $0xffc17c1048fdf162 // vmovupd	-64(%rcx,%rax,8), %zmm7
+	WORD $0x8949; BYTE $0xc0 // movq	%rax, %r8
+	QUAD $0xffc744b848c5f262 // vfmadd231pd	-64(%rdi,%rax,8), %zmm7, %zmm0
+	LONG $0x08c08348         // addq	$8, %rax
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JGE  BB0_21
+
+BB0_20:
+	LONG $0x48fdf362; WORD $0xc61b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm6
+	LONG $0xc058cdc5                           // vaddpd	%ymm0, %ymm6, %ymm0
+	LONG $0x28fdf362; WORD $0xc619; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm6
+	LONG $0xf058c9c5                           // vaddpd	%xmm0, %xmm6, %xmm6
+	LONG $0xc610cbc5                           // vmovsd	%xmm6, %xmm6, %xmm0
+	LONG $0xf615c9c5                           // vunpckhpd	%xmm6, %xmm6, %xmm6
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc6                   // cmpq	%r8, %rsi
+	JLE  BB0_22
+	WORD $0x8949; BYTE $0xf3                   // movq	%rsi, %r11
+	QUAD $0x000000b82484894c                   // movq	%r8, 184(%rsp)
+	WORD $0x294d; BYTE $0xc3                   // subq	%r8, %r11
+	LONG $0xff438d49                           // leaq	-1(%r11), %rax
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_32
+	LONG $0x18048d49                           // leaq	(%r8,%rbx), %rax
+	LONG $0xc2248d4c                           // leaq	(%rdx,%rax,8), %r12
+	LONG $0x01048d4b                           // leaq	(%r9,%r8), %rax
+	LONG $0xc63c8d4d                           // leaq	(%r14,%rax,8), %r15
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	WORD $0x8949; BYTE $0xc5                   // movq	%rax, %r13
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_24:
+	LONG $0x48fdd162; WORD $0x3410; BYTE $0x07 // vmovupd	(%r15,%rax), %zmm6
+	LONG $0x48cdd162; WORD $0x1459; BYTE $0x04 // vmulpd	(%r12,%rax), %zmm6, %zmm2
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x28edf362; WORD $0xda03; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm3
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xe215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm4
+	LONG $0x48fdf362; WORD $0xd11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm1
+	LONG $0xe058dbc5                           // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0x28fdf362; WORD $0xd019; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm0
+	LONG $0xc458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm0
+	LONG $0xd858e3c5                           // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm0
+	LONG $0xd358f3c5                           // vaddsd	%xmm3, %xmm1, %xmm2
+	LONG $0xd258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm2
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm0
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xe8                   // cmpq	%r13, %rax
+	JNE  BB0_24
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x07c3f641                           // testb	$7, %r11b
+	JE   BB0_22
+
+BB0_23:
+	WORD $0x2949; BYTE $0xc3                   // subq	%rax, %r11
+	LONG $0xff6b8d4d                           // leaq	-1(%r11), %r13
+	LONG $0x02fd8349                           // cmpq	$2, %r13
+	JBE  BB0_27
+	QUAD $0x000000b824bc8b4c                   // movq	184(%rsp), %r15
+	LONG $0x382c8d4e                           // leaq	(%rax,%r15), %r13
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+	WORD $0x014c; BYTE $0xf8                   // addq	%r15, %rax
+	WORD $0x0149; BYTE $0xdd                   // addq	%rbx, %r13
+	LONG $0x107dc1c4; WORD $0xc634             // vmovupd	(%r14,%rax,8), %ymm6
+	LONG $0x594da1c4; WORD $0xea34             // vmulpd	(%rdx,%r13,8), %ymm6, %ymm6
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	LONG $0xfce08348                           // andq	$-4, %rax
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x03e38341                           // andl	$3, %r11d
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0xfe15c9c5                           // vunpckhpd	%xmm6, %xmm6, %xmm7
+	LONG $0xc758fbc5                           // vaddsd	%xmm7, %xmm0, %xmm0
+	LONG $0x28fdf362; WORD $0xf719; BYTE $0x01 // vextractf64x2	$1, %ymm6, %xmm7
+	LONG $0x28cdf362; WORD $0xf603; BYTE $0x03 // valignq	$3, %ymm6, %ymm6, %ymm6
+	LONG $0xc758fbc5                           // vaddsd	%xmm7, %xmm0, %xmm0
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	JE   BB0_22
+
+BB0_27:
+	LONG $0x03048d4a               // leaq	(%rbx,%r8), %rax
+	LONG $0x011c8d4f               // leaq	(%r9,%r8), %r11
+	LONG $0x107b81c4; WORD $0xde3c // vmovsd	(%r14,%r11,8), %xmm7
+	LONG $0xb9c1e2c4; WORD $0xc204 // vfmadd231sd	(%rdx,%rax,8), %xmm7, %xmm0
+	LONG $0x01408d49               // leaq	1(%r8), %rax
+	WORD $0x3948; BYTE $0xf0       // cmpq	%rsi, %rax
+	JGE  BB0_22
+	LONG $0x081c8d4e               // leaq	(%rax,%r9), %r11
+	LONG $0x02c08349               // addq	$2, %r8
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	LONG $0x107b81c4; WORD $0xde3c // vmovsd	(%r14,%r11,8), %xmm7
+	LONG $0xb9c1e2c4; WORD $0xc204 // vfmadd231sd	(%rdx,%rax,8), %xmm7, %xmm0
+	WORD $0x394c; BYTE $0xc6       // cmpq	%r8, %rsi
+	JLE  BB0_22
+	LONG $0x01048d4b               // leaq	(%r9,%r8), %rax
+	WORD $0x0149; BYTE $0xd8       // addq	%rbx, %r8
+	LONG $0x107bc1c4; WORD $0xc63c // vmovsd	(%r14,%rax,8), %xmm7
+	LONG $0xb9c1a2c4; WORD $0xc204 // vfmadd231sd	(%rdx,%r8,8), %xmm7, %xmm0
+
+BB0_22:
+	QUAD $0x000000a824848b48                   // movq	168(%rsp), %rax
+	LONG $0x587bc1c4; BYTE $0x02               // vaddsd	(%r10), %xmm0, %xmm0
+	LONG $0x08c28349                           // addq	$8, %r10
+	WORD $0x0149; BYTE $0xc1                   // addq	%rax, %r9
+	LONG $0x7ef9e1c4; BYTE $0xe8               // vmovq	%xmm5, %rax
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	QUAD $0x000000b024848b48                   // movq	176(%rsp), %rax
+	LONG $0x117bc1c4; WORD $0xf842             // vmovsd	%xmm0, -8(%r10)
+	WORD $0x3949; BYTE $0xc2                   // cmpq	%rax, %r10
+	JNE  BB0_18
+	LONG $0x7ef961c4; BYTE $0xc8               // vmovq	%xmm9, %rax
+	QUAD $0x0000009824848b4c                   // movq	152(%rsp), %r8
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+	QUAD $0x000000b024848948                   // movq	%rax, 176(%rsp)
+	QUAD $0x000000a824848b48                   // movq	168(%rsp), %rax
+	LONG $0x01c08349                           // addq	$1, %r8
+	WORD $0x0148; BYTE $0xc3                   // addq	%rax, %rbx
+	LONG $0x2444394c; BYTE $0x78               // cmpq	%r8, 120(%rsp)
+	JNE  BB0_16
+	LONG $0x244c8b48; BYTE $0x28               // movq	40(%rsp), %rcx
+	LONG $0x245c8b4c; BYTE $0x20               // movq	32(%rsp), %r11
+	LONG $0x6f7941c4; BYTE $0xd5               // vmovdqa	%xmm13, %xmm10
+	LONG $0x24548b4c; BYTE $0x18               // movq	24(%rsp), %r10
+	LONG $0x247c8b48; BYTE $0x10               // movq	16(%rsp), %rdi
+	QUAD $0x000000a024848148; LONG $0x00000100 // addq	$256, 160(%rsp)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JL   BB0_19
+	LONG $0x246c8b4c; BYTE $0x40               // movq	64(%rsp), %r13
+	LONG $0x244c8b4c; BYTE $0x38               // movq	56(%rsp), %r9
+	QUAD $0x0000008824bc8b4c                   // movq	136(%rsp), %r15
+	LONG $0x24748b48; BYTE $0x30               // movq	48(%rsp), %rsi
+
+BB0_14:
+	LONG $0x245c8b48; BYTE $0x58 // movq	88(%rsp), %rbx
+	WORD $0x014d; BYTE $0xd7     // addq	%r10, %r15
+	QUAD $0x00000090249c0148     // addq	%rbx, 144(%rsp)
+	WORD $0x394d; BYTE $0xcd     // cmpq	%r9, %r13
+	JL   BB0_17
+	WORD $0x894c; BYTE $0xd8     // movq	%r11, %rax
+	LONG $0x24448b4c; BYTE $0x50 // movq	80(%rsp), %r8
+	LONG $0x24548b48; BYTE $0x48 // movq	72(%rsp), %rdx
+	WORD $0x8948; BYTE $0xf3     // movq	%rsi, %rbx
+	LONG $0x245c8b4c; BYTE $0x70 // movq	112(%rsp), %r11
+
+BB0_12:
+	WORD $0x0148; BYTE $0xc3 // addq	%rax, %rbx
+	WORD $0x014d; BYTE $0xd3 // addq	%r10, %r11
+	WORD $0x3949; BYTE $0xd0 // cmpq	%rdx, %r8
+	JL   BB0_15
+
+BB0_50:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x10a58d48; WORD $0xffff; BYTE $0xff // leaq	-240(%rbp), %rsp
+	RET
+
+BB0_31:
+	QUAD $0x0000008024848b4c // movq	128(%rsp), %r8
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	JMP  BB0_20
+
+BB0_32:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_23
+
+BB0_30:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_5
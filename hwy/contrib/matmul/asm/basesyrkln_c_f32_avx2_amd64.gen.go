@@ -0,0 +1,14 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basesyrkln_c_f32_avx2_amd64.c
+
+package asm
+
+import "unsafe"
+
+//go:noescape
+func syrkln_c_f32_avx2(c, pldc, a, plda, pn, pk, plen_c, plen_a unsafe.Pointer)
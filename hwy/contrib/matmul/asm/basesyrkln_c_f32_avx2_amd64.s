@@ -0,0 +1,197 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basesyrkln_c_f32_avx2_amd64.c
+
+TEXT ·syrkln_c_f32_avx2(SB), $144-64
+	MOVQ c+0(FP), DI
+	MOVQ pldc+8(FP), SI
+	MOVQ a+16(FP), DX
+	MOVQ plda+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_c+48(FP), R11
+	MOVQ R11, 128(SP)
+	MOVQ plen_a+56(FP), R11
+	MOVQ R11, 136(SP)
+	WORD $0x8949; BYTE $0xfb     // movq	%rdi, %r11
+	WORD $0x8b49; BYTE $0x39     // movq	(%r9), %rdi
+	WORD $0x8b4d; BYTE $0x08     // movq	(%r8), %r9
+	WORD $0x8548; BYTE $0xff     // testq	%rdi, %rdi
+	JE   BB0_27
+	WORD $0x854d; BYTE $0xc9     // testq	%r9, %r9
+	JLE  BB0_27
+	LONG $0x04438d49             // leaq	4(%r11), %rax
+	WORD $0x8949; BYTE $0xd2     // movq	%rdx, %r10
+	LONG $0x246c8d48; BYTE $0x70 // leaq	112(%rsp), %rbp
+	WORD $0x3145; BYTE $0xff     // xorl	%r15d, %r15d
+	LONG $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348             // andq	$-32, %rsp
+	WORD $0x8b4c; BYTE $0x06     // movq	(%rsi), %r8
+	LONG $0x24448948; BYTE $0x58 // movq	%rax, 88(%rsp)
+	WORD $0x8b48; BYTE $0x01     // movq	(%rcx), %rax
+	WORD $0xc931                 // xorl	%ecx, %ecx
+	QUAD $0x00000004851c8d4a     // leaq	4(,%r8,4), %rbx
+	LONG $0x244c894c; BYTE $0x30 // movq	%r9, 48(%rsp)
+	LONG $0x24448948; BYTE $0x50 // movq	%rax, 80(%rsp)
+	LONG $0xf8478d48             // leaq	-8(%rdi), %rax
+	LONG $0x03e8c148             // shrq	$3, %rax
+	LONG $0x2444894c; BYTE $0x28 // movq	%r8, 40(%rsp)
+	LONG $0x245c8948; BYTE $0x20 // movq	%rbx, 32(%rsp)
+	QUAD $0x00000008c5048d48     // leaq	8(,%rax,8), %rax
+	LONG $0x245c894c; BYTE $0x18 // movq	%r11, 24(%rsp)
+	LONG $0x24448948; BYTE $0x48 // movq	%rax, 72(%rsp)
+	WORD $0xc031                 // xorl	%eax, %eax
+
+BB0_12:
+	LONG $0x245c8b48; BYTE $0x18 // movq	24(%rsp), %rbx
+	LONG $0x244c8948; BYTE $0x40 // movq	%rcx, 64(%rsp)
+	LONG $0xba348d4b             // leaq	(%r10,%r15,4), %rsi
+	WORD $0x3145; BYTE $0xe4     // xorl	%r12d, %r12d
+	LONG $0x24448948; BYTE $0x38 // movq	%rax, 56(%rsp)
+	LONG $0x832c8d4c             // leaq	(%rbx,%rax,4), %r13
+
+BB0_11:
+	LONG $0xa20c8d4b             // leaq	(%r10,%r12,4), %rcx
+	LONG $0x07ff8348             // cmpq	$7, %rdi
+	JLE  BB0_13
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_4:
+	LONG $0x6410fcc5; WORD $0xe086             // vmovups	-32(%rsi,%rax,4), %ymm4
+	LONG $0xb85de2c4; WORD $0x814c; BYTE $0xe0 // vfmadd231ps	-32(%rcx,%rax,4), %ymm4, %ymm1
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x3948; BYTE $0xf8                   // cmpq	%rdi, %rax
+	JLE  BB0_4
+	LONG $0x24548b48; BYTE $0x48               // movq	72(%rsp), %rdx
+
+BB0_3:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd7       // cmpq	%rdx, %rdi
+	JLE  BB0_5
+	WORD $0x8949; BYTE $0xf8       // movq	%rdi, %r8
+	WORD $0x8949; BYTE $0xd6       // movq	%rdx, %r14
+	WORD $0x2949; BYTE $0xd0       // subq	%rdx, %r8
+	LONG $0xff408d49               // leaq	-1(%r8), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_14
+	LONG $0x3a048d4a               // leaq	(%rdx,%r15), %rax
+	WORD $0x894d; BYTE $0xc1       // movq	%r8, %r9
+	LONG $0x821c8d49               // leaq	(%r10,%rax,4), %rbx
+	LONG $0x03e9c149               // shrq	$3, %r9
+	LONG $0x14048d49               // leaq	(%r12,%rdx), %rax
+	LONG $0x821c8d4d               // leaq	(%r10,%rax,4), %r11
+	LONG $0x05e1c149               // salq	$5, %r9
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_7:
+	LONG $0x107cc1c4; WORD $0x032c // vmovups	(%r11,%rax), %ymm5
+	LONG $0x1459d4c5; BYTE $0x03   // vmulps	(%rbx,%rax), %ymm5, %ymm2
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xcac6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xdac6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xc215e8c5               // vunpckhps	%xmm2, %xmm2, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd858e2c5               // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f2c5               // vaddss	%xmm3, %xmm1, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc8       // cmpq	%r9, %rax
+	JNE  BB0_7
+	WORD $0x894c; BYTE $0xc0       // movq	%r8, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x07c0f641               // testb	$7, %r8b
+	JE   BB0_5
+
+BB0_6:
+	WORD $0x2949; BYTE $0xc0       // subq	%rax, %r8
+	LONG $0xff488d4d               // leaq	-1(%r8), %r9
+	LONG $0x02f98349               // cmpq	$2, %r9
+	JBE  BB0_9
+	LONG $0x300c8d4e               // leaq	(%rax,%r14), %r9
+	WORD $0x014c; BYTE $0xe0       // addq	%r12, %rax
+	WORD $0x014c; BYTE $0xf0       // addq	%r14, %rax
+	WORD $0x014d; BYTE $0xf9       // addq	%r15, %r9
+	LONG $0x1078c1c4; WORD $0x820c // vmovups	(%r10,%rax,4), %xmm1
+	LONG $0x597081c4; WORD $0x8a0c // vmulps	(%r10,%r9,4), %xmm1, %xmm1
+	WORD $0x894c; BYTE $0xc0       // movq	%r8, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x03e08341               // andl	$3, %r8d
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xd115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm2
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_5
+
+BB0_9:
+	LONG $0x01428d4c                           // leaq	1(%rdx), %r8
+	LONG $0x3410fac5; BYTE $0x96               // vmovss	(%rsi,%rdx,4), %xmm6
+	QUAD $0x0000000095048d48                   // leaq	0(,%rdx,4), %rax
+	LONG $0xb949e2c4; WORD $0x9104             // vfmadd231ss	(%rcx,%rdx,4), %xmm6, %xmm0
+	WORD $0x394c; BYTE $0xc7                   // cmpq	%r8, %rdi
+	JLE  BB0_5
+	LONG $0x02c28348                           // addq	$2, %rdx
+	LONG $0x7c10fac5; WORD $0x0401             // vmovss	4(%rcx,%rax), %xmm7
+	LONG $0xb941e2c4; WORD $0x0644; BYTE $0x04 // vfmadd231ss	4(%rsi,%rax), %xmm7, %xmm0
+	WORD $0x3948; BYTE $0xd7                   // cmpq	%rdx, %rdi
+	JLE  BB0_5
+	LONG $0x7c10fac5; WORD $0x0801             // vmovss	8(%rcx,%rax), %xmm7
+	LONG $0xb941e2c4; WORD $0x0644; BYTE $0x08 // vfmadd231ss	8(%rsi,%rax), %xmm7, %xmm0
+
+BB0_5:
+	LONG $0x107ac1c4; WORD $0x004d // vmovss	0(%r13), %xmm1
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x04c58349               // addq	$4, %r13
+	LONG $0xc05cf2c5               // vsubss	%xmm0, %xmm1, %xmm0
+	WORD $0x0149; BYTE $0xc4       // addq	%rax, %r12
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	LONG $0x117ac1c4; WORD $0xfc45 // vmovss	%xmm0, -4(%r13)
+	WORD $0x3949; BYTE $0xc5       // cmpq	%rax, %r13
+	JNE  BB0_11
+	LONG $0x245c8b48; BYTE $0x28   // movq	40(%rsp), %rbx
+	LONG $0x24448b48; BYTE $0x38   // movq	56(%rsp), %rax
+	LONG $0x244c8b48; BYTE $0x40   // movq	64(%rsp), %rcx
+	LONG $0x24548b48; BYTE $0x20   // movq	32(%rsp), %rdx
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	LONG $0x245c8b48; BYTE $0x50   // movq	80(%rsp), %rbx
+	LONG $0x24540148; BYTE $0x58   // addq	%rdx, 88(%rsp)
+	LONG $0x01c18348               // addq	$1, %rcx
+	WORD $0x0149; BYTE $0xdf       // addq	%rbx, %r15
+	LONG $0x244c3948; BYTE $0x30   // cmpq	%rcx, 48(%rsp)
+	JG   BB0_12
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	LONG $0x90658d48               // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_13:
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	JMP  BB0_3
+
+BB0_14:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_6
+
+BB0_27:
+	RET
@@ -0,0 +1,252 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basesyrkln_c_f32_avx512_amd64.c
+
+TEXT ·syrkln_c_f32_avx512(SB), $144-64
+	MOVQ c+0(FP), DI
+	MOVQ pldc+8(FP), SI
+	MOVQ a+16(FP), DX
+	MOVQ plda+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_c+48(FP), R11
+	MOVQ R11, 128(SP)
+	MOVQ plen_a+56(FP), R11
+	MOVQ R11, 136(SP)
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0x246c8d48; BYTE $0x70 // leaq	112(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x40 // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348             // andq	$-64, %rsp
+	WORD $0x8b49; BYTE $0x39     // movq	(%r9), %rdi
+	WORD $0x8b4d; BYTE $0x28     // movq	(%r8), %r13
+	WORD $0x8548; BYTE $0xff     // testq	%rdi, %rdi
+	JE   BB0_28
+	WORD $0x854d; BYTE $0xed     // testq	%r13, %r13
+	JLE  BB0_28
+	LONG $0x017efac5             // vmovq	(%rcx), %xmm0
+	LONG $0xf04f8d48             // leaq	-16(%rdi), %rcx
+	WORD $0x8949; BYTE $0xd3     // movq	%rdx, %r11
+	WORD $0x8b48; BYTE $0x16     // movq	(%rsi), %rdx
+	LONG $0x04588d48             // leaq	4(%rax), %rbx
+	LONG $0xf0e18348             // andq	$-16, %rcx
+	WORD $0x3145; BYTE $0xe4     // xorl	%r12d, %r12d
+	LONG $0x246c894c; BYTE $0x18 // movq	%r13, 24(%rsp)
+	LONG $0x245c8948; BYTE $0x38 // movq	%rbx, 56(%rsp)
+	LONG $0x10598d48             // leaq	16(%rcx), %rbx
+	LONG $0x6ef961c4; BYTE $0xe8 // vmovq	%rax, %xmm13
+	WORD $0x3145; BYTE $0xc9     // xorl	%r9d, %r9d
+	LONG $0x245c8948; BYTE $0x30 // movq	%rbx, 48(%rsp)
+	QUAD $0x0000000495348d4c     // leaq	4(,%rdx,4), %r14
+	WORD $0xdb31                 // xorl	%ebx, %ebx
+	LONG $0x6ef961c4; BYTE $0xe2 // vmovq	%rdx, %xmm12
+	WORD $0x8949; BYTE $0xdd     // movq	%rbx, %r13
+	LONG $0x6ef941c4; BYTE $0xc6 // vmovq	%r14, %xmm8
+	LONG $0xf86ff9c5             // vmovdqa	%xmm0, %xmm7
+	WORD $0x894c; BYTE $0xe0     // movq	%r12, %rax
+	LONG $0x6ef941c4; BYTE $0xf3 // vmovq	%r11, %xmm14
+
+BB0_14:
+	LONG $0x7ef941c4; BYTE $0xf6 // vmovq	%xmm14, %r14
+	LONG $0x7ef961c4; BYTE $0xea // vmovq	%xmm13, %rdx
+	LONG $0x246c894c; BYTE $0x28 // movq	%r13, 40(%rsp)
+	WORD $0x3145; BYTE $0xd2     // xorl	%r10d, %r10d
+	LONG $0x823c8d4c             // leaq	(%rdx,%rax,4), %r15
+	LONG $0x8e1c8d4b             // leaq	(%r14,%r9,4), %rbx
+	LONG $0x24448948; BYTE $0x20 // movq	%rax, 32(%rsp)
+	WORD $0x8949; BYTE $0xdc     // movq	%rbx, %r12
+	WORD $0x894c; BYTE $0xf8     // movq	%r15, %rax
+	WORD $0x894d; BYTE $0xd7     // movq	%r10, %r15
+
+BB0_13:
+	LONG $0xbe348d4b               // leaq	(%r14,%r15,4), %rsi
+	LONG $0x0fff8348               // cmpq	$15, %rdi
+	JLE  BB0_16
+	LONG $0xc957f0c5               // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x0010b841; WORD $0x0000 // movl	$16, %r8d
+
+BB0_5:
+	QUAD $0xff847410487c9162     // vmovups	-64(%r12,%r8,4), %zmm6
+	QUAD $0xff864cb8484db262     // vfmadd231ps	-64(%rsi,%r8,4), %zmm6, %zmm1
+	LONG $0x10c08349             // addq	$16, %r8
+	WORD $0x3949; BYTE $0xf8     // cmpq	%rdi, %r8
+	JLE  BB0_5
+	LONG $0x245c8b4c; BYTE $0x30 // movq	48(%rsp), %r11
+
+BB0_4:
+	LONG $0x48fdf362; WORD $0xcc1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm4
+	LONG $0xc958dcc5                           // vaddps	%ymm1, %ymm4, %ymm1
+	LONG $0x197de3c4; WORD $0x01cc             // vextractf128	$0x1, %ymm1, %xmm4
+	LONG $0xc958d8c5                           // vaddps	%xmm1, %xmm4, %xmm1
+	LONG $0x0479e3c4; WORD $0x4ee1             // vpermilps	$78, %xmm1, %xmm4
+	LONG $0xe158d8c5                           // vaddps	%xmm1, %xmm4, %xmm4
+	LONG $0xcc28f8c5                           // vmovaps	%xmm4, %xmm1
+	LONG $0xe4c6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm4
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	WORD $0x394c; BYTE $0xdf                   // cmpq	%r11, %rdi
+	JLE  BB0_6
+	WORD $0x8949; BYTE $0xfa                   // movq	%rdi, %r10
+	WORD $0x894c; BYTE $0xdb                   // movq	%r11, %rbx
+	WORD $0x294d; BYTE $0xda                   // subq	%r11, %r10
+	LONG $0xff428d4d                           // leaq	-1(%r10), %r8
+	LONG $0x0ef88349                           // cmpq	$14, %r8
+	JBE  BB0_17
+	LONG $0x0b048d4f                           // leaq	(%r11,%r9), %r8
+	LONG $0x862c8d4f                           // leaq	(%r14,%r8,4), %r13
+	LONG $0x1f048d4f                           // leaq	(%r15,%r11), %r8
+	LONG $0x86148d4b                           // leaq	(%r14,%r8,4), %rdx
+	WORD $0x894d; BYTE $0xd0                   // movq	%r10, %r8
+	LONG $0x04e8c149                           // shrq	$4, %r8
+	WORD $0x894c; BYTE $0xc1                   // movq	%r8, %rcx
+	WORD $0x3145; BYTE $0xc0                   // xorl	%r8d, %r8d
+	LONG $0x06e1c148                           // salq	$6, %rcx
+
+BB0_8:
+	LONG $0x487cb162; WORD $0x1410; BYTE $0x02 // vmovups	(%rdx,%r8), %zmm2
+	QUAD $0x00055c59486c9162                   // vmulps	0(%r13,%r8), %zmm2, %zmm3
+	LONG $0x40c08349                           // addq	$64, %r8
+	LONG $0xebc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm5
+	LONG $0xe3c6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm4
+	LONG $0x2865f362; WORD $0xc303; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm0
+	LONG $0xc958e2c5                           // vaddss	%xmm1, %xmm3, %xmm1
+	LONG $0xe958d2c5                           // vaddss	%xmm1, %xmm5, %xmm5
+	LONG $0xcb15e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm1
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0x287df362; WORD $0xd919; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm1
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0x2865f362; WORD $0xe303; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm4
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0x2865f362; WORD $0xcb03; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm1
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xd91b; BYTE $0x01 // vextractf32x8	$0x1, %zmm3, %ymm1
+	LONG $0xe9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm5
+	LONG $0xe1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm4
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xe915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xcc19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm4
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xe103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm4
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xe103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm4
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xc958fac5                           // vaddss	%xmm1, %xmm0, %xmm1
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JNE  BB0_8
+	WORD $0x894d; BYTE $0xd0                   // movq	%r10, %r8
+	LONG $0xf0e08349                           // andq	$-16, %r8
+	WORD $0x014d; BYTE $0xc3                   // addq	%r8, %r11
+	LONG $0x0fc2f641                           // testb	$15, %r10b
+	JE   BB0_6
+
+BB0_7:
+	WORD $0x894c; BYTE $0xd1                   // movq	%r10, %rcx
+	WORD $0x294c; BYTE $0xc1                   // subq	%r8, %rcx
+	LONG $0xff518d4c                           // leaq	-1(%rcx), %r10
+	LONG $0x06fa8349                           // cmpq	$6, %r10
+	JBE  BB0_11
+	LONG $0x18148d4d                           // leaq	(%r8,%rbx), %r10
+	WORD $0x014d; BYTE $0xf8                   // addq	%r15, %r8
+	WORD $0x0149; BYTE $0xd8                   // addq	%rbx, %r8
+	WORD $0x014d; BYTE $0xca                   // addq	%r9, %r10
+	LONG $0x107c81c4; WORD $0x8624             // vmovups	(%r14,%r8,4), %ymm4
+	LONG $0x595c81c4; WORD $0x9624             // vmulps	(%r14,%r10,4), %ymm4, %ymm4
+	WORD $0x8949; BYTE $0xc8                   // movq	%rcx, %r8
+	LONG $0xf8e08349                           // andq	$-8, %r8
+	WORD $0x014d; BYTE $0xc3                   // addq	%r8, %r11
+	WORD $0xe183; BYTE $0x07                   // andl	$7, %ecx
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xf4c6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm6
+	LONG $0xecc6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm5
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xf415d8c5                           // vunpckhps	%xmm4, %xmm4, %xmm6
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xe519; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm5
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x285df362; WORD $0xec03; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm5
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x285df362; WORD $0xec03; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm5
+	LONG $0x285df362; WORD $0xe403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm4
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	JE   BB0_6
+
+BB0_11:
+	LONG $0x01538d4d                           // leaq	1(%r11), %r10
+	LONG $0x107a81c4; WORD $0x9c1c             // vmovss	(%r12,%r11,4), %xmm3
+	QUAD $0x000000009d048d4e                   // leaq	0(,%r11,4), %r8
+	LONG $0xb961a2c4; WORD $0x9e0c             // vfmadd231ss	(%rsi,%r11,4), %xmm3, %xmm1
+	WORD $0x394c; BYTE $0xd7                   // cmpq	%r10, %rdi
+	JLE  BB0_6
+	LONG $0x02538d4d                           // leaq	2(%r11), %r10
+	LONG $0x107a81c4; WORD $0x045c; BYTE $0x04 // vmovss	4(%r12,%r8), %xmm3
+	LONG $0xb961a2c4; WORD $0x064c; BYTE $0x04 // vfmadd231ss	4(%rsi,%r8), %xmm3, %xmm1
+	WORD $0x394c; BYTE $0xd7                   // cmpq	%r10, %rdi
+	JLE  BB0_6
+	LONG $0x03538d4d                           // leaq	3(%r11), %r10
+	LONG $0x107a81c4; WORD $0x045c; BYTE $0x08 // vmovss	8(%r12,%r8), %xmm3
+	LONG $0xb961a2c4; WORD $0x064c; BYTE $0x08 // vfmadd231ss	8(%rsi,%r8), %xmm3, %xmm1
+	WORD $0x394c; BYTE $0xd7                   // cmpq	%r10, %rdi
+	JLE  BB0_6
+	LONG $0x04538d4d                           // leaq	4(%r11), %r10
+	LONG $0x107a81c4; WORD $0x045c; BYTE $0x0c // vmovss	12(%r12,%r8), %xmm3
+	LONG $0xb961a2c4; WORD $0x064c; BYTE $0x0c // vfmadd231ss	12(%rsi,%r8), %xmm3, %xmm1
+	WORD $0x394c; BYTE $0xd7                   // cmpq	%r10, %rdi
+	JLE  BB0_6
+	LONG $0x05538d4d                           // leaq	5(%r11), %r10
+	LONG $0x107a81c4; WORD $0x0454; BYTE $0x10 // vmovss	16(%r12,%r8), %xmm2
+	LONG $0xb969a2c4; WORD $0x064c; BYTE $0x10 // vfmadd231ss	16(%rsi,%r8), %xmm2, %xmm1
+	WORD $0x394c; BYTE $0xd7                   // cmpq	%r10, %rdi
+	JLE  BB0_6
+	LONG $0x06c38349                           // addq	$6, %r11
+	LONG $0x107a81c4; WORD $0x045c; BYTE $0x14 // vmovss	20(%r12,%r8), %xmm3
+	LONG $0xb961a2c4; WORD $0x064c; BYTE $0x14 // vfmadd231ss	20(%rsi,%r8), %xmm3, %xmm1
+	WORD $0x394c; BYTE $0xdf                   // cmpq	%r11, %rdi
+	JLE  BB0_6
+	LONG $0x107a81c4; WORD $0x0454; BYTE $0x18 // vmovss	24(%r12,%r8), %xmm2
+	LONG $0xb969a2c4; WORD $0x064c; BYTE $0x18 // vfmadd231ss	24(%rsi,%r8), %xmm2, %xmm1
+
+BB0_6:
+	LONG $0x2010fac5             // vmovss	(%rax), %xmm4
+	LONG $0x245c8b48; BYTE $0x38 // movq	56(%rsp), %rbx
+	LONG $0x7ef9e1c4; BYTE $0xfa // vmovq	%xmm7, %rdx
+	LONG $0x04c08348             // addq	$4, %rax
+	WORD $0x0149; BYTE $0xd7     // addq	%rdx, %r15
+	LONG $0xc95cdac5             // vsubss	%xmm1, %xmm4, %xmm1
+	LONG $0x4811fac5; BYTE $0xfc // vmovss	%xmm1, -4(%rax)
+	WORD $0x3948; BYTE $0xd8     // cmpq	%rbx, %rax
+	JNE  BB0_13
+	LONG $0x24448b48; BYTE $0x20 // movq	32(%rsp), %rax
+	LONG $0x7ef961c4; BYTE $0xe3 // vmovq	%xmm12, %rbx
+	LONG $0x246c8b4c; BYTE $0x28 // movq	40(%rsp), %r13
+	LONG $0x7ef961c4; BYTE $0xc2 // vmovq	%xmm8, %rdx
+	LONG $0x24540148; BYTE $0x38 // addq	%rdx, 56(%rsp)
+	WORD $0x0148; BYTE $0xd8     // addq	%rbx, %rax
+	LONG $0x7ef9e1c4; BYTE $0xfb // vmovq	%xmm7, %rbx
+	LONG $0x01c58349             // addq	$1, %r13
+	WORD $0x0149; BYTE $0xd9     // addq	%rbx, %r9
+	LONG $0x246c394c; BYTE $0x18 // cmpq	%r13, 24(%rsp)
+	JG   BB0_14
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+
+BB0_28:
+	LONG $0x90658d48 // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_16:
+	LONG $0xc957f1c5         // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	JMP  BB0_4
+
+BB0_17:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_7
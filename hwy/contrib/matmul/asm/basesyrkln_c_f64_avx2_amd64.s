@@ -0,0 +1,169 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basesyrkln_c_f64_avx2_amd64.c
+
+TEXT ·syrkln_c_f64_avx2(SB), $144-64
+	MOVQ c+0(FP), DI
+	MOVQ pldc+8(FP), SI
+	MOVQ a+16(FP), DX
+	MOVQ plda+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_c+48(FP), R11
+	MOVQ R11, 128(SP)
+	MOVQ plen_a+56(FP), R11
+	MOVQ R11, 136(SP)
+	WORD $0x8949; BYTE $0xfa     // movq	%rdi, %r10
+	WORD $0x8b49; BYTE $0x39     // movq	(%r9), %rdi
+	WORD $0x8b4d; BYTE $0x08     // movq	(%r8), %r9
+	WORD $0x8548; BYTE $0xff     // testq	%rdi, %rdi
+	JE   BB0_30
+	WORD $0x854d; BYTE $0xc9     // testq	%r9, %r9
+	JLE  BB0_30
+	LONG $0x08428d49             // leaq	8(%r10), %rax
+	LONG $0x246c8d48; BYTE $0x70 // leaq	112(%rsp), %rbp
+	WORD $0x3145; BYTE $0xff     // xorl	%r15d, %r15d
+	WORD $0x8948; BYTE $0xd3     // movq	%rdx, %rbx
+	LONG $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348             // andq	$-32, %rsp
+	WORD $0x8b4c; BYTE $0x06     // movq	(%rsi), %r8
+	LONG $0x24448948; BYTE $0x58 // movq	%rax, 88(%rsp)
+	WORD $0x8b48; BYTE $0x01     // movq	(%rcx), %rax
+	WORD $0xc931                 // xorl	%ecx, %ecx
+	QUAD $0x00000008c51c8d4e     // leaq	8(,%r8,8), %r11
+	LONG $0x2444894c; BYTE $0x30 // movq	%r8, 48(%rsp)
+	LONG $0x24448948; BYTE $0x50 // movq	%rax, 80(%rsp)
+	LONG $0xfc478d48             // leaq	-4(%rdi), %rax
+	LONG $0x02e8c148             // shrq	$2, %rax
+	LONG $0x244c894c; BYTE $0x28 // movq	%r9, 40(%rsp)
+	LONG $0x245c894c; BYTE $0x20 // movq	%r11, 32(%rsp)
+	QUAD $0x0000000485048d48     // leaq	4(,%rax,4), %rax
+	LONG $0x2454894c; BYTE $0x18 // movq	%r10, 24(%rsp)
+	LONG $0x24448948; BYTE $0x48 // movq	%rax, 72(%rsp)
+	WORD $0xc031                 // xorl	%eax, %eax
+
+BB0_12:
+	LONG $0x24548b48; BYTE $0x18 // movq	24(%rsp), %rdx
+	LONG $0x24448948; BYTE $0x40 // movq	%rax, 64(%rsp)
+	LONG $0xfb348d4a             // leaq	(%rbx,%r15,8), %rsi
+	WORD $0x3145; BYTE $0xe4     // xorl	%r12d, %r12d
+	LONG $0x244c8948; BYTE $0x38 // movq	%rcx, 56(%rsp)
+	LONG $0xc22c8d4c             // leaq	(%rdx,%rax,8), %r13
+
+BB0_11:
+	LONG $0xe30c8d4a             // leaq	(%rbx,%r12,8), %rcx
+	LONG $0x03ff8348             // cmpq	$3, %rdi
+	JLE  BB0_13
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+
+BB0_4:
+	LONG $0x6410fdc5; WORD $0xe0c6             // vmovupd	-32(%rsi,%rax,8), %ymm4
+	LONG $0xb8dde2c4; WORD $0xc14c; BYTE $0xe0 // vfmadd231pd	-32(%rcx,%rax,8), %ymm4, %ymm1
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x3948; BYTE $0xf8                   // cmpq	%rdi, %rax
+	JLE  BB0_4
+	LONG $0x24548b48; BYTE $0x48               // movq	72(%rsp), %rdx
+
+BB0_3:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd7       // cmpq	%rdx, %rdi
+	JLE  BB0_5
+	WORD $0x8949; BYTE $0xf8       // movq	%rdi, %r8
+	WORD $0x8949; BYTE $0xd6       // movq	%rdx, %r14
+	WORD $0x2949; BYTE $0xd0       // subq	%rdx, %r8
+	LONG $0xff408d49               // leaq	-1(%r8), %rax
+	LONG $0x02f88348               // cmpq	$2, %rax
+	JBE  BB0_14
+	LONG $0x17048d49               // leaq	(%r15,%rdx), %rax
+	WORD $0x894d; BYTE $0xc1       // movq	%r8, %r9
+	LONG $0xc31c8d4c               // leaq	(%rbx,%rax,8), %r11
+	LONG $0x02e9c149               // shrq	$2, %r9
+	LONG $0x14048d49               // leaq	(%r12,%rdx), %rax
+	LONG $0xc3148d4c               // leaq	(%rbx,%rax,8), %r10
+	LONG $0x05e1c149               // salq	$5, %r9
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_7:
+	LONG $0x107dc1c4; WORD $0x022c // vmovupd	(%r10,%rax), %ymm5
+	LONG $0x5955c1c4; WORD $0x0314 // vmulpd	(%r11,%rax), %ymm5, %ymm2
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xc258fbc5               // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xda15e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm3
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f3c5               // vaddsd	%xmm3, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc8       // cmpq	%r9, %rax
+	JNE  BB0_7
+	LONG $0x03c0f641               // testb	$3, %r8b
+	JE   BB0_5
+	WORD $0x894c; BYTE $0xc0       // movq	%r8, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+
+BB0_6:
+	WORD $0x2949; BYTE $0xc0       // subq	%rax, %r8
+	LONG $0x01f88349               // cmpq	$1, %r8
+	JE   BB0_9
+	LONG $0x380c8d4e               // leaq	(%rax,%r15), %r9
+	WORD $0x014c; BYTE $0xe0       // addq	%r12, %rax
+	WORD $0x014d; BYTE $0xf1       // addq	%r14, %r9
+	WORD $0x014c; BYTE $0xf0       // addq	%r14, %rax
+	LONG $0x0c10f9c5; BYTE $0xc3   // vmovupd	(%rbx,%rax,8), %xmm1
+	LONG $0x5971a1c4; WORD $0xcb0c // vmulpd	(%rbx,%r9,8), %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0x01c0f641               // testb	$1, %r8b
+	JE   BB0_5
+	LONG $0xfee08349               // andq	$-2, %r8
+	WORD $0x014c; BYTE $0xc2       // addq	%r8, %rdx
+
+BB0_9:
+	LONG $0x3410fbc5; BYTE $0xd1   // vmovsd	(%rcx,%rdx,8), %xmm6
+	LONG $0xb9c9e2c4; WORD $0xd604 // vfmadd231sd	(%rsi,%rdx,8), %xmm6, %xmm0
+
+BB0_5:
+	LONG $0x107bc1c4; WORD $0x004d // vmovsd	0(%r13), %xmm1
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x08c58349               // addq	$8, %r13
+	LONG $0xc05cf3c5               // vsubsd	%xmm0, %xmm1, %xmm0
+	WORD $0x0149; BYTE $0xc4       // addq	%rax, %r12
+	LONG $0x117bc1c4; WORD $0xf845 // vmovsd	%xmm0, -8(%r13)
+	LONG $0x246c394c; BYTE $0x58   // cmpq	%r13, 88(%rsp)
+	JNE  BB0_11
+	LONG $0x24548b48; BYTE $0x30   // movq	48(%rsp), %rdx
+	LONG $0x24448b48; BYTE $0x40   // movq	64(%rsp), %rax
+	LONG $0x244c8b48; BYTE $0x38   // movq	56(%rsp), %rcx
+	LONG $0x24748b48; BYTE $0x20   // movq	32(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x24548b48; BYTE $0x50   // movq	80(%rsp), %rdx
+	LONG $0x24740148; BYTE $0x58   // addq	%rsi, 88(%rsp)
+	LONG $0x01c18348               // addq	$1, %rcx
+	WORD $0x0149; BYTE $0xd7       // addq	%rdx, %r15
+	LONG $0x244c3948; BYTE $0x28   // cmpq	%rcx, 40(%rsp)
+	JG   BB0_12
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	LONG $0x90658d48               // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_13:
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	JMP  BB0_3
+
+BB0_14:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_6
+
+BB0_30:
+	RET
@@ -0,0 +1,206 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basesyrkln_c_f64_avx512_amd64.c
+
+TEXT ·syrkln_c_f64_avx512(SB), $144-64
+	MOVQ c+0(FP), DI
+	MOVQ pldc+8(FP), SI
+	MOVQ a+16(FP), DX
+	MOVQ plda+24(FP), CX
+	MOVQ pn+32(FP), R8
+	MOVQ pk+40(FP), R9
+	MOVQ plen_c+48(FP), R11
+	MOVQ R11, 128(SP)
+	MOVQ plen_a+56(FP), R11
+	MOVQ R11, 136(SP)
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0x246c8d48; BYTE $0x70 // leaq	112(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x40 // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348             // andq	$-64, %rsp
+	WORD $0x8b49; BYTE $0x39     // movq	(%r9), %rdi
+	WORD $0x8b4d; BYTE $0x28     // movq	(%r8), %r13
+	WORD $0x8548; BYTE $0xff     // testq	%rdi, %rdi
+	JE   BB0_25
+	WORD $0x854d; BYTE $0xed     // testq	%r13, %r13
+	JLE  BB0_25
+	LONG $0x117efac5             // vmovq	(%rcx), %xmm2
+	LONG $0xf84f8d48             // leaq	-8(%rdi), %rcx
+	WORD $0x8949; BYTE $0xd3     // movq	%rdx, %r11
+	WORD $0x8b48; BYTE $0x16     // movq	(%rsi), %rdx
+	LONG $0x08588d48             // leaq	8(%rax), %rbx
+	LONG $0x03e9c148             // shrq	$3, %rcx
+	WORD $0x3145; BYTE $0xe4     // xorl	%r12d, %r12d
+	LONG $0x246c894c; BYTE $0x18 // movq	%r13, 24(%rsp)
+	LONG $0x245c8948; BYTE $0x38 // movq	%rbx, 56(%rsp)
+	QUAD $0x00000008cd1c8d48     // leaq	8(,%rcx,8), %rbx
+	LONG $0x6ef961c4; BYTE $0xe8 // vmovq	%rax, %xmm13
+	WORD $0x3145; BYTE $0xc9     // xorl	%r9d, %r9d
+	LONG $0x245c8948; BYTE $0x30 // movq	%rbx, 48(%rsp)
+	QUAD $0x00000008d5348d4c     // leaq	8(,%rdx,8), %r14
+	WORD $0xdb31                 // xorl	%ebx, %ebx
+	LONG $0x6ef961c4; BYTE $0xc2 // vmovq	%rdx, %xmm8
+	WORD $0x8949; BYTE $0xdd     // movq	%rbx, %r13
+	LONG $0x6ef941c4; BYTE $0xe6 // vmovq	%r14, %xmm12
+	LONG $0xfa6ff9c5             // vmovdqa	%xmm2, %xmm7
+	WORD $0x894c; BYTE $0xe0     // movq	%r12, %rax
+	LONG $0x6ef941c4; BYTE $0xf3 // vmovq	%r11, %xmm14
+
+BB0_12:
+	LONG $0x7ef961c4; BYTE $0xf2 // vmovq	%xmm14, %rdx
+	LONG $0x7ef961c4; BYTE $0xe9 // vmovq	%xmm13, %rcx
+	LONG $0x246c894c; BYTE $0x28 // movq	%r13, 40(%rsp)
+	WORD $0x3145; BYTE $0xd2     // xorl	%r10d, %r10d
+	LONG $0xc13c8d4c             // leaq	(%rcx,%rax,8), %r15
+	LONG $0xca1c8d4a             // leaq	(%rdx,%r9,8), %rbx
+	LONG $0x24448948; BYTE $0x20 // movq	%rax, 32(%rsp)
+	WORD $0x8949; BYTE $0xdc     // movq	%rbx, %r12
+	WORD $0x894c; BYTE $0xf8     // movq	%r15, %rax
+	WORD $0x894d; BYTE $0xd7     // movq	%r10, %r15
+
+BB0_11:
+	LONG $0xfa348d4a               // leaq	(%rdx,%r15,8), %rsi
+	LONG $0x07ff8348               // cmpq	$7, %rdi
+	JLE  BB0_13
+	LONG $0xc057f9c5               // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x0008b841; WORD $0x0000 // movl	$8, %r8d
+
+BB0_4:
+	QUAD $0xffc4741048fd9162     // vmovupd	-64(%r12,%r8,8), %zmm6
+	QUAD $0xffc644b848cdb262     // vfmadd231pd	-64(%rsi,%r8,8), %zmm6, %zmm0
+	LONG $0x08c08349             // addq	$8, %r8
+	WORD $0x3949; BYTE $0xf8     // cmpq	%rdi, %r8
+	JLE  BB0_4
+	LONG $0x245c8b4c; BYTE $0x30 // movq	48(%rsp), %r11
+
+BB0_3:
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f5c5                           // vaddpd	%ymm0, %ymm1, %ymm0
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm1
+	LONG $0xc858f1c5                           // vaddpd	%xmm0, %xmm1, %xmm1
+	LONG $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xdf                   // cmpq	%r11, %rdi
+	JLE  BB0_5
+	WORD $0x8949; BYTE $0xfa                   // movq	%rdi, %r10
+	WORD $0x894c; BYTE $0xdb                   // movq	%r11, %rbx
+	WORD $0x294d; BYTE $0xda                   // subq	%r11, %r10
+	LONG $0xff428d4d                           // leaq	-1(%r10), %r8
+	LONG $0x06f88349                           // cmpq	$6, %r8
+	JBE  BB0_14
+	LONG $0x0b048d4f                           // leaq	(%r11,%r9), %r8
+	LONG $0xc22c8d4e                           // leaq	(%rdx,%r8,8), %r13
+	LONG $0x1f048d4f                           // leaq	(%r15,%r11), %r8
+	LONG $0xc2348d4e                           // leaq	(%rdx,%r8,8), %r14
+	WORD $0x894d; BYTE $0xd0                   // movq	%r10, %r8
+	LONG $0x03e8c149                           // shrq	$3, %r8
+	WORD $0x894c; BYTE $0xc1                   // movq	%r8, %rcx
+	WORD $0x3145; BYTE $0xc0                   // xorl	%r8d, %r8d
+	LONG $0x06e1c148                           // salq	$6, %rcx
+
+BB0_7:
+	LONG $0x48fd9162; WORD $0x3410; BYTE $0x06 // vmovupd	(%r14,%r8), %zmm6
+	QUAD $0x0005545948cd9162                   // vmulpd	0(%r13,%r8), %zmm6, %zmm2
+	LONG $0x40c08349                           // addq	$64, %r8
+	LONG $0x28edf362; WORD $0xda03; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm3
+	LONG $0xc058ebc5                           // vaddsd	%xmm0, %xmm2, %xmm0
+	LONG $0xe215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm4
+	LONG $0x48fdf362; WORD $0xd11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm1
+	LONG $0x28fdf362; WORD $0xcd19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm5
+	LONG $0xe058dbc5                           // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0x28fdf362; WORD $0xd019; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm0
+	LONG $0xc458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm0
+	LONG $0xd858e3c5                           // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm0
+	LONG $0xd358f3c5                           // vaddsd	%xmm3, %xmm1, %xmm2
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JNE  BB0_7
+	WORD $0x894d; BYTE $0xd0                   // movq	%r10, %r8
+	LONG $0xf8e08349                           // andq	$-8, %r8
+	WORD $0x014d; BYTE $0xc3                   // addq	%r8, %r11
+	LONG $0x07c2f641                           // testb	$7, %r10b
+	JE   BB0_5
+
+BB0_6:
+	WORD $0x894c; BYTE $0xd1                   // movq	%r10, %rcx
+	WORD $0x294c; BYTE $0xc1                   // subq	%r8, %rcx
+	LONG $0xff518d4c                           // leaq	-1(%rcx), %r10
+	LONG $0x02fa8349                           // cmpq	$2, %r10
+	JBE  BB0_9
+	LONG $0x18148d4d                           // leaq	(%r8,%rbx), %r10
+	WORD $0x014d; BYTE $0xf8                   // addq	%r15, %r8
+	WORD $0x0149; BYTE $0xd8                   // addq	%rbx, %r8
+	WORD $0x014d; BYTE $0xca                   // addq	%r9, %r10
+	LONG $0x107da1c4; WORD $0xc20c             // vmovupd	(%rdx,%r8,8), %ymm1
+	LONG $0x5975a1c4; WORD $0xd20c             // vmulpd	(%rdx,%r10,8), %ymm1, %ymm1
+	WORD $0x8949; BYTE $0xc8                   // movq	%rcx, %r8
+	LONG $0xfce08349                           // andq	$-4, %r8
+	WORD $0x014d; BYTE $0xc3                   // addq	%r8, %r11
+	WORD $0xe183; BYTE $0x03                   // andl	$3, %ecx
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xe915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm5
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	LONG $0x28fdf362; WORD $0xcd19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm5
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	JE   BB0_5
+
+BB0_9:
+	LONG $0x01538d4d                           // leaq	1(%r11), %r10
+	LONG $0x107b81c4; WORD $0xdc2c             // vmovsd	(%r12,%r11,8), %xmm5
+	QUAD $0x00000000dd048d4e                   // leaq	0(,%r11,8), %r8
+	LONG $0xb9d1a2c4; WORD $0xde04             // vfmadd231sd	(%rsi,%r11,8), %xmm5, %xmm0
+	WORD $0x394c; BYTE $0xd7                   // cmpq	%r10, %rdi
+	JLE  BB0_5
+	LONG $0x02c38349                           // addq	$2, %r11
+	LONG $0x107b81c4; WORD $0x046c; BYTE $0x08 // vmovsd	8(%r12,%r8), %xmm5
+	LONG $0xb9d1a2c4; WORD $0x0644; BYTE $0x08 // vfmadd231sd	8(%rsi,%r8), %xmm5, %xmm0
+	WORD $0x394c; BYTE $0xdf                   // cmpq	%r11, %rdi
+	JLE  BB0_5
+	LONG $0x107b81c4; WORD $0x046c; BYTE $0x10 // vmovsd	16(%r12,%r8), %xmm5
+	LONG $0xb9d1a2c4; WORD $0x0644; BYTE $0x10 // vfmadd231sd	16(%rsi,%r8), %xmm5, %xmm0
+
+BB0_5:
+	LONG $0x0810fbc5             // vmovsd	(%rax), %xmm1
+	LONG $0x7ef9e1c4; BYTE $0xfb // vmovq	%xmm7, %rbx
+	LONG $0x08c08348             // addq	$8, %rax
+	WORD $0x0149; BYTE $0xdf     // addq	%rbx, %r15
+	LONG $0x245c8b48; BYTE $0x38 // movq	56(%rsp), %rbx
+	LONG $0xc05cf3c5             // vsubsd	%xmm0, %xmm1, %xmm0
+	LONG $0x4011fbc5; BYTE $0xf8 // vmovsd	%xmm0, -8(%rax)
+	WORD $0x3948; BYTE $0xd8     // cmpq	%rbx, %rax
+	JNE  BB0_11
+	LONG $0x24448b48; BYTE $0x20 // movq	32(%rsp), %rax
+	LONG $0x7ef961c4; BYTE $0xc3 // vmovq	%xmm8, %rbx
+	LONG $0x246c8b4c; BYTE $0x28 // movq	40(%rsp), %r13
+	LONG $0x7ef961c4; BYTE $0xe2 // vmovq	%xmm12, %rdx
+	LONG $0x24540148; BYTE $0x38 // addq	%rdx, 56(%rsp)
+	WORD $0x0148; BYTE $0xd8     // addq	%rbx, %rax
+	LONG $0x7ef9e1c4; BYTE $0xfb // vmovq	%xmm7, %rbx
+	LONG $0x01c58349             // addq	$1, %r13
+	WORD $0x0149; BYTE $0xd9     // addq	%rbx, %r9
+	LONG $0x246c394c; BYTE $0x18 // cmpq	%r13, 24(%rsp)
+	JG   BB0_12
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+
+BB0_25:
+	LONG $0x90658d48 // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_13:
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	JMP  BB0_3
+
+BB0_14:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_6
@@ -0,0 +1,457 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basetrsmln_c_f32_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_1<>+0(SB)/4, $0x80000000
+DATA CPI0_1<>+4(SB)/4, $0x00000000
+DATA CPI0_1<>+8(SB)/4, $0x00000000
+DATA CPI0_1<>+12(SB)/4, $0x00000000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $16
+
+TEXT ·trsmln_c_f32_avx2(SB), $32-48
+	MOVQ   l+0(FP), DI
+	MOVQ   b+8(FP), SI
+	MOVQ   pn+16(FP), DX
+	MOVQ   pnrhs+24(FP), CX
+	MOVQ   plen_l+32(FP), R8
+	MOVQ   plen_b+40(FP), R9
+	LONG   $0x246c8d48; BYTE $0x10 // leaq	16(%rsp), %rbp
+	LONG   $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG   $0xe0e48348             // andq	$-32, %rsp
+	LONG   $0x80c48348             // addq	$-128, %rsp
+	WORD   $0x8b4c; BYTE $0x39     // movq	(%rcx), %r15
+	WORD   $0x8b4c; BYTE $0x1a     // movq	(%rdx), %r11
+	LONG   $0x247c8948; BYTE $0x60 // movq	%rdi, 96(%rsp)
+	WORD   $0x854d; BYTE $0xff     // testq	%r15, %r15
+	JE     BB0_75
+	WORD   $0x854d; BYTE $0xdb     // testq	%r11, %r11
+	JLE    BB0_75
+	LONG   $0xf8578d49             // leaq	-8(%r15), %rdx
+	VMOVSS CPI0_0<>(SB), X3        // vmovss	.LCPI0_0(%rip), %xmm3
+	WORD   $0x8949; BYTE $0xf6     // movq	%rsi, %r14
+	WORD   $0xc931                 // xorl	%ecx, %ecx
+	WORD   $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	LONG   $0x03e8c148             // shrq	$3, %rax
+	QUAD   $0x00000008c5048d48     // leaq	8(,%rax,8), %rax
+	LONG   $0x24448948; BYTE $0x68 // movq	%rax, 104(%rsp)
+	LONG   $0x24448b48; BYTE $0x60 // movq	96(%rsp), %rax
+	LONG   $0x105ee2c5             // vdivss	(%rax), %xmm3, %xmm2
+	LONG   $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG   $0x07ff8349             // cmpq	$7, %r15
+	JLE    BB0_36
+	WORD   $0x8948; BYTE $0xd1     // movq	%rdx, %rcx
+	WORD   $0x894c; BYTE $0xf0     // movq	%r14, %rax
+	LONG   $0xf8e18348             // andq	$-8, %rcx
+	LONG   $0x8e4c8d49; BYTE $0x20 // leaq	32(%r14,%rcx,4), %rcx
+
+BB0_4:
+	LONG $0x0059f4c5             // vmulps	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fcc5; BYTE $0xe0 // vmovups	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JNE  BB0_4
+	LONG $0x24448b48; BYTE $0x60 // movq	96(%rsp), %rax
+	LONG $0x244c8b48; BYTE $0x68 // movq	104(%rsp), %rcx
+	LONG $0x105ee2c5             // vdivss	(%rax), %xmm3, %xmm2
+
+BB0_36:
+	WORD $0x3949; BYTE $0xcf     // cmpq	%rcx, %r15
+	JLE  BB0_31
+	WORD $0x894c; BYTE $0xfe     // movq	%r15, %rsi
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	WORD $0x2948; BYTE $0xce     // subq	%rcx, %rsi
+	LONG $0xff468d48             // leaq	-1(%rsi), %rax
+	LONG $0x06f88348             // cmpq	$6, %rax
+	JBE  BB0_40
+	WORD $0x8948; BYTE $0xf7     // movq	%rsi, %rdi
+	LONG $0x8e048d49             // leaq	(%r14,%rcx,4), %rax
+	LONG $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG $0x03efc148             // shrq	$3, %rdi
+	LONG $0x05e7c148             // salq	$5, %rdi
+	WORD $0x0148; BYTE $0xc7     // addq	%rax, %rdi
+
+BB0_29:
+	LONG $0x0059f4c5             // vmulps	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fcc5; BYTE $0xe0 // vmovups	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xf8     // cmpq	%rdi, %rax
+	JNE  BB0_29
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc1     // addq	%rax, %rcx
+	LONG $0x07c6f640             // testb	$7, %sil
+	JE   BB0_31
+
+BB0_28:
+	WORD $0x2948; BYTE $0xc6     // subq	%rax, %rsi
+	LONG $0xff7e8d48             // leaq	-1(%rsi), %rdi
+	LONG $0x02ff8348             // cmpq	$2, %rdi
+	JBE  BB0_33
+	WORD $0x014c; BYTE $0xc0     // addq	%r8, %rax
+	LONG $0xc2c6e8c5; BYTE $0x00 // vshufps	$0, %xmm2, %xmm2, %xmm0
+	LONG $0x86048d49             // leaq	(%r14,%rax,4), %rax
+	LONG $0x0059f8c5             // vmulps	(%rax), %xmm0, %xmm0
+	LONG $0x0011f8c5             // vmovups	%xmm0, (%rax)
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc1     // addq	%rax, %rcx
+	WORD $0xe683; BYTE $0x03     // andl	$3, %esi
+	JE   BB0_31
+
+BB0_33:
+	LONG $0x8e048d49         // leaq	(%r14,%rcx,4), %rax
+	LONG $0x0059eac5         // vmulss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x01418d48         // leaq	1(%rcx), %rax
+	WORD $0x3949; BYTE $0xc7 // cmpq	%rax, %r15
+	JLE  BB0_31
+	LONG $0x86048d49         // leaq	(%r14,%rax,4), %rax
+	LONG $0x02c18348         // addq	$2, %rcx
+	LONG $0x0059eac5         // vmulss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	WORD $0x3949; BYTE $0xcf // cmpq	%rcx, %r15
+	JLE  BB0_31
+	LONG $0x8e048d49         // leaq	(%r14,%rcx,4), %rax
+	LONG $0x1059eac5         // vmulss	(%rax), %xmm2, %xmm2
+	LONG $0x1011fac5         // vmovss	%xmm2, (%rax)
+
+BB0_31:
+	LONG   $0x01fb8349               // cmpq	$1, %r11
+	JE     BB0_74
+	LONG   $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+	LONG   $0xf8e28348               // andq	$-8, %rdx
+	WORD   $0x894d; BYTE $0xfa       // movq	%r15, %r10
+	WORD   $0x894c; BYTE $0xdb       // movq	%r11, %rbx
+	QUAD   $0x000000049d248d4e       // leaq	4(,%r11,4), %r12
+	LONG   $0x0001bd41; WORD $0x0000 // movl	$1, %r13d
+	WORD   $0xf749; BYTE $0xda       // negq	%r10
+	WORD   $0x894d; BYTE $0xf9       // movq	%r15, %r9
+	LONG   $0x20048d4e               // leaq	(%rax,%r12), %r8
+	LONG   $0x20468d49               // leaq	32(%r14), %rax
+	LONG   $0x24548948; BYTE $0x48   // movq	%rdx, 72(%rsp)
+	VMOVSS CPI0_1<>(SB), X4          // vmovss	.LCPI0_1(%rip), %xmm4
+	LONG   $0x24448948; BYTE $0x40   // movq	%rax, 64(%rsp)
+	LONG   $0x246c894c; BYTE $0x78   // movq	%r13, 120(%rsp)
+
+BB0_27:
+	LONG $0x24448b48; BYTE $0x60 // movq	96(%rsp), %rax
+	LONG $0x24548b48; BYTE $0x48 // movq	72(%rsp), %rdx
+	LONG $0x2454894c; BYTE $0x38 // movq	%r10, 56(%rsp)
+	WORD $0x3145; BYTE $0xed     // xorl	%r13d, %r13d
+	LONG $0x24748b48; BYTE $0x40 // movq	64(%rsp), %rsi
+	LONG $0x245c8948; BYTE $0x30 // movq	%rbx, 48(%rsp)
+	LONG $0x98048d48             // leaq	(%rax,%rbx,4), %rax
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x245c894c; BYTE $0x28 // movq	%r11, 40(%rsp)
+	LONG $0x960c8d48             // leaq	(%rsi,%rdx,4), %rcx
+	LONG $0x24448948; BYTE $0x58 // movq	%rax, 88(%rsp)
+	LONG $0x8e048d4b             // leaq	(%r14,%r9,4), %rax
+	WORD $0xd231                 // xorl	%edx, %edx
+	LONG $0x24448948; BYTE $0x50 // movq	%rax, 80(%rsp)
+	WORD $0x894c; BYTE $0xd6     // movq	%r10, %rsi
+	LONG $0x2444894c; BYTE $0x20 // movq	%r8, 32(%rsp)
+	LONG $0x244c8948; BYTE $0x70 // movq	%rcx, 112(%rsp)
+	LONG $0x2464894c; BYTE $0x18 // movq	%r12, 24(%rsp)
+	WORD $0x8949; BYTE $0xd4     // movq	%rdx, %r12
+
+BB0_9:
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	LONG $0x107aa1c4; WORD $0xa014 // vmovss	(%rax,%r12,4), %xmm2
+	LONG $0xcc57e8c5               // vxorps	%xmm4, %xmm2, %xmm1
+	LONG $0x187de2c4; BYTE $0xc9   // vbroadcastss	%xmm1, %ymm1
+	LONG $0x07ff8349               // cmpq	$7, %r15
+	JLE  BB0_37
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x244c8b48; BYTE $0x70   // movq	112(%rsp), %rcx
+
+BB0_7:
+	LONG $0x0410fcc5; BYTE $0xb0 // vmovups	(%rax,%rsi,4), %ymm0
+	LONG $0xa875e2c4; BYTE $0x00 // vfmadd213ps	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fcc5; BYTE $0xe0 // vmovups	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JNE  BB0_7
+	LONG $0x244c8948; BYTE $0x70 // movq	%rcx, 112(%rsp)
+	LONG $0x24548b48; BYTE $0x68 // movq	104(%rsp), %rdx
+
+BB0_6:
+	WORD $0x3949; BYTE $0xd7 // cmpq	%rdx, %r15
+	JLE  BB0_15
+	WORD $0x894c; BYTE $0xf8 // movq	%r15, %rax
+	LONG $0x0a3c8d4a         // leaq	(%rdx,%r9), %rdi
+	LONG $0x2a148d4e         // leaq	(%rdx,%r13), %r10
+	WORD $0x2948; BYTE $0xd0 // subq	%rdx, %rax
+	LONG $0xff588d48         // leaq	-1(%rax), %rbx
+	LONG $0x02fb8348         // cmpq	$2, %rbx
+	JBE  BB0_11
+	QUAD $0x00000000bd048d4c // leaq	0(,%rdi,4), %r8
+	LONG $0x2a148d4e         // leaq	(%rdx,%r13), %r10
+	QUAD $0x00000004951c8d4e // leaq	4(,%r10,4), %r11
+	WORD $0x894c; BYTE $0xc1 // movq	%r8, %rcx
+	WORD $0x294c; BYTE $0xd9 // subq	%r11, %rcx
+	LONG $0x18f98348         // cmpq	$24, %rcx
+	JA   BB0_78
+
+BB0_11:
+	LONG $0xbe048d49               // leaq	(%r14,%rdi,4), %rax
+	LONG $0x107a81c4; WORD $0x9604 // vmovss	(%r14,%r10,4), %xmm0
+	LONG $0xad69e2c4; BYTE $0x00   // vfnmadd213ss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5               // vmovss	%xmm0, (%rax)
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_15
+	LONG $0x013c8d49               // leaq	(%r9,%rax), %rdi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0xbe3c8d49               // leaq	(%r14,%rdi,4), %rdi
+	LONG $0x107ac1c4; WORD $0x8604 // vmovss	(%r14,%rax,4), %xmm0
+	LONG $0x02428d48               // leaq	2(%rdx), %rax
+	LONG $0xad69e2c4; BYTE $0x07   // vfnmadd213ss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_15
+	LONG $0x083c8d4a               // leaq	(%rax,%r9), %rdi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0xbe3c8d49               // leaq	(%r14,%rdi,4), %rdi
+	LONG $0x107ac1c4; WORD $0x8604 // vmovss	(%r14,%rax,4), %xmm0
+	LONG $0x03428d48               // leaq	3(%rdx), %rax
+	LONG $0xad69e2c4; BYTE $0x07   // vfnmadd213ss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_15
+	LONG $0x013c8d49               // leaq	(%r9,%rax), %rdi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0xbe3c8d49               // leaq	(%r14,%rdi,4), %rdi
+	LONG $0x107ac1c4; WORD $0x8604 // vmovss	(%r14,%rax,4), %xmm0
+	LONG $0x04428d48               // leaq	4(%rdx), %rax
+	LONG $0xad69e2c4; BYTE $0x07   // vfnmadd213ss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_15
+	LONG $0x013c8d49               // leaq	(%r9,%rax), %rdi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0xbe3c8d49               // leaq	(%r14,%rdi,4), %rdi
+	LONG $0x107ac1c4; WORD $0x8604 // vmovss	(%r14,%rax,4), %xmm0
+	LONG $0x05428d48               // leaq	5(%rdx), %rax
+	LONG $0xad69e2c4; BYTE $0x07   // vfnmadd213ss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_15
+	LONG $0x083c8d4a               // leaq	(%rax,%r9), %rdi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0xbe3c8d49               // leaq	(%r14,%rdi,4), %rdi
+	LONG $0x107ac1c4; WORD $0x8604 // vmovss	(%r14,%rax,4), %xmm0
+	LONG $0x06428d48               // leaq	6(%rdx), %rax
+	LONG $0xad69e2c4; BYTE $0x07   // vfnmadd213ss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_15
+	LONG $0x013c8d49               // leaq	(%r9,%rax), %rdi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0xbe3c8d49               // leaq	(%r14,%rdi,4), %rdi
+	LONG $0x107ac1c4; WORD $0x8604 // vmovss	(%r14,%rax,4), %xmm0
+	LONG $0x07428d48               // leaq	7(%rdx), %rax
+	LONG $0xad69e2c4; BYTE $0x07   // vfnmadd213ss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_15
+	LONG $0x013c8d49               // leaq	(%r9,%rax), %rdi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0xbe3c8d49               // leaq	(%r14,%rdi,4), %rdi
+	LONG $0x3f10fac5               // vmovss	(%rdi), %xmm7
+	LONG $0x9d41c2c4; WORD $0x8614 // vfnmadd132ss	(%r14,%rax,4), %xmm7, %xmm2
+	LONG $0x1711fac5               // vmovss	%xmm2, (%rdi)
+
+BB0_15:
+	LONG $0x24448b48; BYTE $0x78 // movq	120(%rsp), %rax
+	LONG $0x01c48349             // addq	$1, %r12
+	WORD $0x014d; BYTE $0xfd     // addq	%r15, %r13
+	WORD $0x014c; BYTE $0xfe     // addq	%r15, %rsi
+	WORD $0x3949; BYTE $0xc4     // cmpq	%rax, %r12
+	JL   BB0_9
+	LONG $0x24448b4c; BYTE $0x20 // movq	32(%rsp), %r8
+	LONG $0x24548b4c; BYTE $0x38 // movq	56(%rsp), %r10
+	LONG $0x245c8b48; BYTE $0x30 // movq	48(%rsp), %rbx
+	LONG $0x245c8b4c; BYTE $0x28 // movq	40(%rsp), %r11
+	LONG $0x5e62c1c4; BYTE $0x10 // vdivss	(%r8), %xmm3, %xmm2
+	LONG $0x24448b48; BYTE $0x50 // movq	80(%rsp), %rax
+	LONG $0x244c8b48; BYTE $0x70 // movq	112(%rsp), %rcx
+	LONG $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG $0x24648b4c; BYTE $0x18 // movq	24(%rsp), %r12
+	LONG $0x07ff8349             // cmpq	$7, %r15
+	JLE  BB0_19
+
+BB0_20:
+	LONG $0x0059f4c5             // vmulps	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fcc5; BYTE $0xe0 // vmovups	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JNE  BB0_20
+	LONG $0x5e62c1c4; BYTE $0x10 // vdivss	(%r8), %xmm3, %xmm2
+
+BB0_19:
+	WORD $0x3949; BYTE $0xd7     // cmpq	%rdx, %r15
+	JLE  BB0_21
+	WORD $0x894c; BYTE $0xf9     // movq	%r15, %rcx
+	WORD $0x8948; BYTE $0xd6     // movq	%rdx, %rsi
+	WORD $0x2948; BYTE $0xd1     // subq	%rdx, %rcx
+	LONG $0xff418d48             // leaq	-1(%rcx), %rax
+	LONG $0x06f88348             // cmpq	$6, %rax
+	JBE  BB0_39
+	WORD $0x8948; BYTE $0xcf     // movq	%rcx, %rdi
+	LONG $0x0a048d4a             // leaq	(%rdx,%r9), %rax
+	LONG $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG $0x03efc148             // shrq	$3, %rdi
+	LONG $0x86048d49             // leaq	(%r14,%rax,4), %rax
+	LONG $0x05e7c148             // salq	$5, %rdi
+	WORD $0x0148; BYTE $0xc7     // addq	%rax, %rdi
+
+BB0_23:
+	LONG $0x0059f4c5             // vmulps	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fcc5; BYTE $0xe0 // vmovups	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc7     // cmpq	%rax, %rdi
+	JNE  BB0_23
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	WORD $0xc1f6; BYTE $0x07     // testb	$7, %cl
+	JE   BB0_21
+
+BB0_22:
+	WORD $0x2948; BYTE $0xc1     // subq	%rax, %rcx
+	LONG $0xff798d48             // leaq	-1(%rcx), %rdi
+	LONG $0x02ff8348             // cmpq	$2, %rdi
+	JBE  BB0_25
+	WORD $0x014c; BYTE $0xce     // addq	%r9, %rsi
+	LONG $0xc2c6e8c5; BYTE $0x00 // vshufps	$0, %xmm2, %xmm2, %xmm0
+	WORD $0x0148; BYTE $0xc6     // addq	%rax, %rsi
+	LONG $0xb6048d49             // leaq	(%r14,%rsi,4), %rax
+	LONG $0x0059f8c5             // vmulps	(%rax), %xmm0, %xmm0
+	LONG $0x0011f8c5             // vmovups	%xmm0, (%rax)
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	WORD $0xe183; BYTE $0x03     // andl	$3, %ecx
+	JE   BB0_21
+
+BB0_25:
+	LONG $0x0a048d4a         // leaq	(%rdx,%r9), %rax
+	LONG $0x86048d49         // leaq	(%r14,%rax,4), %rax
+	LONG $0x0059eac5         // vmulss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x01428d48         // leaq	1(%rdx), %rax
+	WORD $0x3949; BYTE $0xc7 // cmpq	%rax, %r15
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xc8 // addq	%r9, %rax
+	LONG $0x02c28348         // addq	$2, %rdx
+	LONG $0x86048d49         // leaq	(%r14,%rax,4), %rax
+	LONG $0x0059eac5         // vmulss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	WORD $0x3949; BYTE $0xd7 // cmpq	%rdx, %r15
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xca // addq	%r9, %rdx
+	LONG $0x96048d49         // leaq	(%r14,%rdx,4), %rax
+	LONG $0x1059eac5         // vmulss	(%rax), %xmm2, %xmm2
+	LONG $0x1011fac5         // vmovss	%xmm2, (%rax)
+
+BB0_21:
+	LONG $0x24448348; WORD $0x0178 // addq	$1, 120(%rsp)
+	WORD $0x014d; BYTE $0xf9       // addq	%r15, %r9
+	WORD $0x014d; BYTE $0xe0       // addq	%r12, %r8
+	WORD $0x294d; BYTE $0xfa       // subq	%r15, %r10
+	LONG $0x24448b48; BYTE $0x78   // movq	120(%rsp), %rax
+	WORD $0x014c; BYTE $0xdb       // addq	%r11, %rbx
+	WORD $0x3949; BYTE $0xc3       // cmpq	%rax, %r11
+	JNE  BB0_27
+
+BB0_74:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_75:
+	LONG $0xf0658d48 // leaq	-16(%rbp), %rsp
+	RET
+
+BB0_78:
+	LONG $0x06fb8348                           // cmpq	$6, %rbx
+	JBE  BB0_38
+	WORD $0x014d; BYTE $0xf0                   // addq	%r14, %r8
+	LONG $0x187de2c4; BYTE $0xc2               // vbroadcastss	%xmm2, %ymm0
+	LONG $0x107cc1c4; BYTE $0x30               // vmovups	(%r8), %ymm6
+	LONG $0x9c4d82c4; WORD $0x1e44; BYTE $0xfc // vfnmadd132ps	-4(%r14,%r11), %ymm6, %ymm0
+	WORD $0x8949; BYTE $0xc3                   // movq	%rax, %r11
+	LONG $0xf8e38349                           // andq	$-8, %r11
+	LONG $0x117cc1c4; BYTE $0x00               // vmovups	%ymm0, (%r8)
+	LONG $0x13048d4d                           // leaq	(%r11,%rdx), %r8
+	WORD $0x07a8                               // testb	$7, %al
+	JE   BB0_15
+	WORD $0x294c; BYTE $0xd8                   // subq	%r11, %rax
+	LONG $0xff588d48                           // leaq	-1(%rax), %rbx
+	LONG $0x02fb8348                           // cmpq	$2, %rbx
+	JBE  BB0_16
+
+BB0_12:
+	WORD $0x014c; BYTE $0xdf       // addq	%r11, %rdi
+	WORD $0x014d; BYTE $0xd3       // addq	%r10, %r11
+	LONG $0xc2c6e8c5; BYTE $0x00   // vshufps	$0, %xmm2, %xmm2, %xmm0
+	LONG $0xbe3c8d49               // leaq	(%r14,%rdi,4), %rdi
+	LONG $0x2f10f8c5               // vmovups	(%rdi), %xmm5
+	LONG $0x9c5182c4; WORD $0x9e04 // vfnmadd132ps	(%r14,%r11,4), %xmm5, %xmm0
+	LONG $0x0711f8c5               // vmovups	%xmm0, (%rdi)
+	WORD $0x8948; BYTE $0xc7       // movq	%rax, %rdi
+	LONG $0xfce78348               // andq	$-4, %rdi
+	WORD $0x0149; BYTE $0xf8       // addq	%rdi, %r8
+	WORD $0x03a8                   // testb	$3, %al
+	JE   BB0_15
+
+BB0_16:
+	LONG $0x01048d4b               // leaq	(%r9,%r8), %rax
+	LONG $0x057c8d4b; BYTE $0x00   // leaq	0(%r13,%r8), %rdi
+	LONG $0x86048d49               // leaq	(%r14,%rax,4), %rax
+	LONG $0x107ac1c4; WORD $0xbe04 // vmovss	(%r14,%rdi,4), %xmm0
+	LONG $0xad69e2c4; BYTE $0x00   // vfnmadd213ss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5               // vmovss	%xmm0, (%rax)
+	LONG $0x01408d49               // leaq	1(%r8), %rax
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_15
+	LONG $0x013c8d49               // leaq	(%r9,%rax), %rdi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0x02c08349               // addq	$2, %r8
+	LONG $0xbe3c8d49               // leaq	(%r14,%rdi,4), %rdi
+	LONG $0x107ac1c4; WORD $0x8604 // vmovss	(%r14,%rax,4), %xmm0
+	LONG $0xad69e2c4; BYTE $0x07   // vfnmadd213ss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	WORD $0x394d; BYTE $0xc7       // cmpq	%r8, %r15
+	JLE  BB0_15
+	LONG $0x01048d4b               // leaq	(%r9,%r8), %rax
+	WORD $0x014d; BYTE $0xe8       // addq	%r13, %r8
+	LONG $0x86048d49               // leaq	(%r14,%rax,4), %rax
+	LONG $0x3810fac5               // vmovss	(%rax), %xmm7
+	LONG $0x9d4182c4; WORD $0x8614 // vfnmadd132ss	(%r14,%r8,4), %xmm7, %xmm2
+	LONG $0x1011fac5               // vmovss	%xmm2, (%rax)
+	JMP  BB0_15
+
+BB0_37:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_6
+
+BB0_39:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_22
+
+BB0_40:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_28
+
+BB0_38:
+	WORD $0x8949; BYTE $0xd0 // movq	%rdx, %r8
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	JMP  BB0_12
@@ -0,0 +1,615 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basetrsmln_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_1<>+0(SB)/4, $0x80000000
+DATA CPI0_1<>+4(SB)/4, $0x00000000
+DATA CPI0_1<>+8(SB)/4, $0x00000000
+DATA CPI0_1<>+12(SB)/4, $0x00000000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $16
+
+TEXT ·trsmln_c_f32_avx512(SB), $64-48
+	MOVQ   l+0(FP), DI
+	MOVQ   b+8(FP), SI
+	MOVQ   pn+16(FP), DX
+	MOVQ   pnrhs+24(FP), CX
+	MOVQ   plen_l+32(FP), R8
+	MOVQ   plen_b+40(FP), R9
+	LONG   $0x246c8d48; BYTE $0x30   // leaq	48(%rsp), %rbp
+	LONG   $0x24648d48; BYTE $0x40   // leaq	64(%rsp), %rsp
+	LONG   $0xc0e48348               // andq	$-64, %rsp
+	LONG   $0x80c48348               // addq	$-128, %rsp
+	WORD   $0x8b48; BYTE $0x02       // movq	(%rdx), %rax
+	WORD   $0x8b48; BYTE $0x11       // movq	(%rcx), %rdx
+	LONG   $0x24448948; BYTE $0x78   // movq	%rax, 120(%rsp)
+	WORD   $0x8548; BYTE $0xd2       // testq	%rdx, %rdx
+	JE     BB0_75
+	WORD   $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JLE    BB0_75
+	LONG   $0xf0428d4c               // leaq	-16(%rdx), %r8
+	LONG   $0x6ef9e1c4; BYTE $0xf7   // vmovq	%rdi, %xmm6
+	WORD   $0xc931                   // xorl	%ecx, %ecx
+	VMOVSS CPI0_0<>(SB), X3          // vmovss	.LCPI0_0(%rip), %xmm3
+	WORD   $0x894c; BYTE $0xc0       // movq	%r8, %rax
+	LONG   $0x175ee2c5               // vdivss	(%rdi), %xmm3, %xmm2
+	LONG   $0x487df262; WORD $0xca18 // vbroadcastss	%xmm2, %zmm1
+	LONG   $0xf0e08348               // andq	$-16, %rax
+	LONG   $0x10c08348               // addq	$16, %rax
+	LONG   $0x24448948; BYTE $0x68   // movq	%rax, 104(%rsp)
+	LONG   $0x0ffa8348               // cmpq	$15, %rdx
+	JLE    BB0_36
+	WORD   $0x894c; BYTE $0xc1       // movq	%r8, %rcx
+	WORD   $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG   $0xf0e18348               // andq	$-16, %rcx
+	LONG   $0x8e4c8d48; BYTE $0x40   // leaq	64(%rsi,%rcx,4), %rcx
+
+BB0_4:
+	LONG $0x4874f162; WORD $0x0059             // vmulps	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JNE  BB0_4
+	LONG $0x244c8b48; BYTE $0x68               // movq	104(%rsp), %rcx
+	LONG $0x7ef9e1c4; BYTE $0xf0               // vmovq	%xmm6, %rax
+	LONG $0x105ee2c5                           // vdivss	(%rax), %xmm3, %xmm2
+
+BB0_36:
+	WORD $0x3948; BYTE $0xca       // cmpq	%rcx, %rdx
+	JLE  BB0_31
+	WORD $0x8948; BYTE $0xd7       // movq	%rdx, %rdi
+	WORD $0x8949; BYTE $0xca       // movq	%rcx, %r10
+	WORD $0x2948; BYTE $0xcf       // subq	%rcx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	LONG $0x0ef88348               // cmpq	$14, %rax
+	JBE  BB0_40
+	WORD $0x8949; BYTE $0xf9       // movq	%rdi, %r9
+	LONG $0x8e048d48               // leaq	(%rsi,%rcx,4), %rax
+	LONG $0x487df262; WORD $0xca18 // vbroadcastss	%xmm2, %zmm1
+	LONG $0x04e9c149               // shrq	$4, %r9
+	LONG $0x06e1c149               // salq	$6, %r9
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+
+BB0_29:
+	LONG $0x4874f162; WORD $0x0059             // vmulps	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x3949; BYTE $0xc1                   // cmpq	%rax, %r9
+	JNE  BB0_29
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x0fc7f640                           // testb	$15, %dil
+	JE   BB0_31
+
+BB0_28:
+	WORD $0x2948; BYTE $0xc7     // subq	%rax, %rdi
+	LONG $0xff4f8d4c             // leaq	-1(%rdi), %r9
+	LONG $0x06f98349             // cmpq	$6, %r9
+	JBE  BB0_33
+	WORD $0x014c; BYTE $0xd0     // addq	%r10, %rax
+	LONG $0x187de2c4; BYTE $0xc2 // vbroadcastss	%xmm2, %ymm0
+	LONG $0x86048d48             // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059fcc5             // vmulps	(%rax), %ymm0, %ymm0
+	LONG $0x0011fcc5             // vmovups	%ymm0, (%rax)
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc1     // addq	%rax, %rcx
+	WORD $0xe783; BYTE $0x07     // andl	$7, %edi
+	JE   BB0_31
+
+BB0_33:
+	LONG $0x8e048d48         // leaq	(%rsi,%rcx,4), %rax
+	LONG $0x0059eac5         // vmulss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x01418d48         // leaq	1(%rcx), %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JLE  BB0_31
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059eac5         // vmulss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x02418d48         // leaq	2(%rcx), %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JLE  BB0_31
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059eac5         // vmulss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x03418d48         // leaq	3(%rcx), %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JLE  BB0_31
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059eac5         // vmulss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x04418d48         // leaq	4(%rcx), %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JLE  BB0_31
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059eac5         // vmulss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x05418d48         // leaq	5(%rcx), %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JLE  BB0_31
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x06c18348         // addq	$6, %rcx
+	LONG $0x0059eac5         // vmulss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	WORD $0x3948; BYTE $0xca // cmpq	%rcx, %rdx
+	JLE  BB0_31
+	LONG $0x8e048d48         // leaq	(%rsi,%rcx,4), %rax
+	LONG $0x1059eac5         // vmulss	(%rax), %xmm2, %xmm2
+	LONG $0x1011fac5         // vmovss	%xmm2, (%rax)
+
+BB0_31:
+	LONG   $0x24448b48; BYTE $0x78   // movq	120(%rsp), %rax
+	LONG   $0x01f88348               // cmpq	$1, %rax
+	JE     BB0_74
+	WORD   $0x8949; BYTE $0xd5       // movq	%rdx, %r13
+	LONG   $0x40768d4c               // leaq	64(%rsi), %r14
+	LONG   $0x0001ba41; WORD $0x0000 // movl	$1, %r10d
+	WORD   $0x8949; BYTE $0xd7       // movq	%rdx, %r15
+	QUAD   $0x00000004851c8d48       // leaq	4(,%rax,4), %rbx
+	WORD   $0xf749; BYTE $0xdd       // negq	%r13
+	WORD   $0x8949; BYTE $0xc4       // movq	%rax, %r12
+	LONG   $0x6ef9e1c4; BYTE $0xe3   // vmovq	%rbx, %xmm4
+	LONG   $0x7ef9e1c4; BYTE $0xf3   // vmovq	%xmm6, %rbx
+	LONG   $0x246c894c; BYTE $0x60   // movq	%r13, 96(%rsp)
+	LONG   $0x6ef9c1c4; BYTE $0xfe   // vmovq	%r14, %xmm7
+	LONG   $0x7ef9e1c4; BYTE $0xe7   // vmovq	%xmm4, %rdi
+	LONG   $0x7ef9c1c4; BYTE $0xe5   // vmovq	%xmm4, %r13
+	WORD   $0x894d; BYTE $0xd6       // movq	%r10, %r14
+	VMOVSS CPI0_1<>(SB), X5          // vmovss	.LCPI0_1(%rip), %xmm5
+	LONG   $0x3b1c8d4c               // leaq	(%rbx,%rdi), %r11
+	WORD   $0x894c; BYTE $0xc3       // movq	%r8, %rbx
+	LONG   $0xf0e38348               // andq	$-16, %rbx
+
+BB0_27:
+	LONG $0x3b0c8d4a             // leaq	(%rbx,%r15), %rcx
+	LONG $0x2464894c; BYTE $0x48 // movq	%r12, 72(%rsp)
+	WORD $0x3145; BYTE $0xc9     // xorl	%r9d, %r9d
+	WORD $0x3145; BYTE $0xd2     // xorl	%r10d, %r10d
+	LONG $0x7ef9e1c4; BYTE $0xf0 // vmovq	%xmm6, %rax
+	LONG $0x7ef9e1c4; BYTE $0xff // vmovq	%xmm7, %rdi
+	LONG $0x2474894c; BYTE $0x58 // movq	%r14, 88(%rsp)
+	LONG $0x24448b4c; BYTE $0x60 // movq	96(%rsp), %r8
+	LONG $0xa0048d4a             // leaq	(%rax,%r12,4), %rax
+	LONG $0x8f3c8d48             // leaq	(%rdi,%rcx,4), %rdi
+	LONG $0x245c894c; BYTE $0x40 // movq	%r11, 64(%rsp)
+	LONG $0x6ef941c4; BYTE $0xc5 // vmovq	%r13, %xmm8
+	LONG $0x6ef9e1c4; BYTE $0xe0 // vmovq	%rax, %xmm4
+	LONG $0xbe048d4a             // leaq	(%rsi,%r15,4), %rax
+	LONG $0x247c8948; BYTE $0x70 // movq	%rdi, 112(%rsp)
+	LONG $0x24448948; BYTE $0x50 // movq	%rax, 80(%rsp)
+	LONG $0x245c8948; BYTE $0x38 // movq	%rbx, 56(%rsp)
+
+BB0_9:
+	LONG $0x7ef9e1c4; BYTE $0xe0   // vmovq	%xmm4, %rax
+	LONG $0x107aa1c4; WORD $0x9014 // vmovss	(%rax,%r10,4), %xmm2
+	LONG $0xcd57e8c5               // vxorps	%xmm5, %xmm2, %xmm1
+	LONG $0x487df262; WORD $0xc918 // vbroadcastss	%xmm1, %zmm1
+	LONG $0x0ffa8348               // cmpq	$15, %rdx
+	JLE  BB0_37
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x247c8b48; BYTE $0x70   // movq	112(%rsp), %rdi
+
+BB0_7:
+	LONG $0x487cb162; WORD $0x0410; BYTE $0x80 // vmovups	(%rax,%r8,4), %zmm0
+	LONG $0x4875f262; WORD $0x00a8             // vfmadd213ps	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xc7                   // cmpq	%rax, %rdi
+	JNE  BB0_7
+	LONG $0x247c8948; BYTE $0x70               // movq	%rdi, 112(%rsp)
+	LONG $0x244c8b48; BYTE $0x68               // movq	104(%rsp), %rcx
+
+BB0_6:
+	WORD $0x3948; BYTE $0xca // cmpq	%rcx, %rdx
+	JLE  BB0_15
+	WORD $0x8949; BYTE $0xd3 // movq	%rdx, %r11
+	LONG $0x391c8d4a         // leaq	(%rcx,%r15), %rbx
+	LONG $0x09348d4e         // leaq	(%rcx,%r9), %r14
+	WORD $0x2949; BYTE $0xcb // subq	%rcx, %r11
+	LONG $0xff638d4d         // leaq	-1(%r11), %r12
+	LONG $0x06fc8349         // cmpq	$6, %r12
+	JBE  BB0_11
+	QUAD $0x000000009d048d48 // leaq	0(,%rbx,4), %rax
+	LONG $0x09348d4e         // leaq	(%rcx,%r9), %r14
+	QUAD $0x00000004b52c8d4e // leaq	4(,%r14,4), %r13
+	WORD $0x8948; BYTE $0xc7 // movq	%rax, %rdi
+	WORD $0x294c; BYTE $0xef // subq	%r13, %rdi
+	LONG $0x38ff8348         // cmpq	$56, %rdi
+	JA   BB0_79
+
+BB0_11:
+	LONG $0x9e048d48               // leaq	(%rsi,%rbx,4), %rax
+	LONG $0x107aa1c4; WORD $0xb604 // vmovss	(%rsi,%r14,4), %xmm0
+	LONG $0xad69e2c4; BYTE $0x00   // vfnmadd213ss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5               // vmovss	%xmm0, (%rax)
+	LONG $0x01418d48               // leaq	1(%rcx), %rax
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x02418d48               // leaq	2(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x03418d48               // leaq	3(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x04418d48               // leaq	4(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x05418d48               // leaq	5(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x06418d48               // leaq	6(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x07418d48               // leaq	7(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x08418d48               // leaq	8(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x09418d48               // leaq	9(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x0a418d48               // leaq	10(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x0b418d48               // leaq	11(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x0c418d48               // leaq	12(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x0d418d48               // leaq	13(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x0e418d48               // leaq	14(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x86   // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x0f418d48               // leaq	15(%rcx), %rax
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JG   BB0_77
+
+BB0_15:
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	LONG $0x01c28349               // addq	$1, %r10
+	WORD $0x0149; BYTE $0xd1       // addq	%rdx, %r9
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	WORD $0x3949; BYTE $0xc2       // cmpq	%rax, %r10
+	JL   BB0_9
+	LONG $0x245c8b4c; BYTE $0x40   // movq	64(%rsp), %r11
+	WORD $0x8949; BYTE $0xc6       // movq	%rax, %r14
+	LONG $0x24648b4c; BYTE $0x48   // movq	72(%rsp), %r12
+	LONG $0x7ef941c4; BYTE $0xc5   // vmovq	%xmm8, %r13
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x247c8b48; BYTE $0x70   // movq	112(%rsp), %rdi
+	LONG $0x5e62c1c4; BYTE $0x0b   // vdivss	(%r11), %xmm3, %xmm1
+	LONG $0x245c8b48; BYTE $0x38   // movq	56(%rsp), %rbx
+	LONG $0x487df262; WORD $0xd118 // vbroadcastss	%xmm1, %zmm2
+	LONG $0x0ffa8348               // cmpq	$15, %rdx
+	JLE  BB0_19
+
+BB0_20:
+	LONG $0x486cf162; WORD $0x0059             // vmulps	(%rax), %zmm2, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xf8                   // cmpq	%rdi, %rax
+	JNE  BB0_20
+	LONG $0x5e62c1c4; BYTE $0x0b               // vdivss	(%r11), %xmm3, %xmm1
+
+BB0_19:
+	WORD $0x3948; BYTE $0xca       // cmpq	%rcx, %rdx
+	JLE  BB0_21
+	WORD $0x8948; BYTE $0xd7       // movq	%rdx, %rdi
+	WORD $0x8949; BYTE $0xc8       // movq	%rcx, %r8
+	WORD $0x2948; BYTE $0xcf       // subq	%rcx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	LONG $0x0ef88348               // cmpq	$14, %rax
+	JBE  BB0_39
+	WORD $0x8949; BYTE $0xf9       // movq	%rdi, %r9
+	LONG $0x39048d4a               // leaq	(%rcx,%r15), %rax
+	LONG $0x487df262; WORD $0xd118 // vbroadcastss	%xmm1, %zmm2
+	LONG $0x04e9c149               // shrq	$4, %r9
+	LONG $0x86048d48               // leaq	(%rsi,%rax,4), %rax
+	LONG $0x06e1c149               // salq	$6, %r9
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+
+BB0_23:
+	LONG $0x486cf162; WORD $0x0059             // vmulps	(%rax), %zmm2, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x394c; BYTE $0xc8                   // cmpq	%r9, %rax
+	JNE  BB0_23
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x0fc7f640                           // testb	$15, %dil
+	JE   BB0_21
+
+BB0_22:
+	WORD $0x2948; BYTE $0xc7     // subq	%rax, %rdi
+	LONG $0xff4f8d4c             // leaq	-1(%rdi), %r9
+	LONG $0x06f98349             // cmpq	$6, %r9
+	JBE  BB0_25
+	WORD $0x014d; BYTE $0xf8     // addq	%r15, %r8
+	LONG $0x187de2c4; BYTE $0xc1 // vbroadcastss	%xmm1, %ymm0
+	WORD $0x0149; BYTE $0xc0     // addq	%rax, %r8
+	LONG $0x86048d4a             // leaq	(%rsi,%r8,4), %rax
+	LONG $0x0059fcc5             // vmulps	(%rax), %ymm0, %ymm0
+	LONG $0x0011fcc5             // vmovups	%ymm0, (%rax)
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc1     // addq	%rax, %rcx
+	WORD $0xe783; BYTE $0x07     // andl	$7, %edi
+	JE   BB0_21
+
+BB0_25:
+	LONG $0x39048d4a         // leaq	(%rcx,%r15), %rax
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059f2c5         // vmulss	(%rax), %xmm1, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x01418d48         // leaq	1(%rcx), %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xf8 // addq	%r15, %rax
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059f2c5         // vmulss	(%rax), %xmm1, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x02418d48         // leaq	2(%rcx), %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xf8 // addq	%r15, %rax
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059f2c5         // vmulss	(%rax), %xmm1, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x03418d48         // leaq	3(%rcx), %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xf8 // addq	%r15, %rax
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059f2c5         // vmulss	(%rax), %xmm1, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x04418d48         // leaq	4(%rcx), %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xf8 // addq	%r15, %rax
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059f2c5         // vmulss	(%rax), %xmm1, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x05418d48         // leaq	5(%rcx), %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xf8 // addq	%r15, %rax
+	LONG $0x06c18348         // addq	$6, %rcx
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059f2c5         // vmulss	(%rax), %xmm1, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	WORD $0x3948; BYTE $0xca // cmpq	%rcx, %rdx
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xf9 // addq	%r15, %rcx
+	LONG $0x8e048d48         // leaq	(%rsi,%rcx,4), %rax
+	LONG $0x0859f2c5         // vmulss	(%rax), %xmm1, %xmm1
+	LONG $0x0811fac5         // vmovss	%xmm1, (%rax)
+
+BB0_21:
+	LONG $0x24448b48; BYTE $0x78 // movq	120(%rsp), %rax
+	LONG $0x01c68349             // addq	$1, %r14
+	WORD $0x0149; BYTE $0xd7     // addq	%rdx, %r15
+	WORD $0x014d; BYTE $0xeb     // addq	%r13, %r11
+	LONG $0x24542948; BYTE $0x60 // subq	%rdx, 96(%rsp)
+	WORD $0x0149; BYTE $0xc4     // addq	%rax, %r12
+	WORD $0x394c; BYTE $0xf0     // cmpq	%r14, %rax
+	JNE  BB0_27
+
+BB0_74:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_75:
+	LONG $0xd0658d48 // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_79:
+	LONG $0x0efc8349                                   // cmpq	$14, %r12
+	JBE  BB0_38
+	WORD $0x0148; BYTE $0xf0                           // addq	%rsi, %rax
+	QUAD $0xfc2e8410487cb162; WORD $0xffff; BYTE $0xff // vmovups	-4(%rsi,%r13), %zmm0
+	LONG $0x487df262; WORD $0xca18                     // vbroadcastss	%xmm2, %zmm1
+	WORD $0x894d; BYTE $0xdc                           // movq	%r11, %r12
+	LONG $0x4875f262; WORD $0x00ac                     // vfnmadd213ps	(%rax), %zmm1, %zmm0
+	LONG $0xf0e48349                                   // andq	$-16, %r12
+	LONG $0x487cf162; WORD $0x0011                     // vmovups	%zmm0, (%rax)
+	LONG $0x0c048d49                                   // leaq	(%r12,%rcx), %rax
+	LONG $0x0fc3f641                                   // testb	$15, %r11b
+	JE   BB0_15
+	WORD $0x294d; BYTE $0xe3                           // subq	%r12, %r11
+	LONG $0xff6b8d4d                                   // leaq	-1(%r11), %r13
+	LONG $0x06fd8349                                   // cmpq	$6, %r13
+	JBE  BB0_16
+
+BB0_12:
+	WORD $0x014c; BYTE $0xe3       // addq	%r12, %rbx
+	WORD $0x014d; BYTE $0xf4       // addq	%r14, %r12
+	LONG $0x187de2c4; BYTE $0xc2   // vbroadcastss	%xmm2, %ymm0
+	LONG $0x9e1c8d48               // leaq	(%rsi,%rbx,4), %rbx
+	LONG $0x0b10fcc5               // vmovups	(%rbx), %ymm1
+	LONG $0x9c75a2c4; WORD $0xa604 // vfnmadd132ps	(%rsi,%r12,4), %ymm1, %ymm0
+	LONG $0x0311fcc5               // vmovups	%ymm0, (%rbx)
+	WORD $0x894c; BYTE $0xdb       // movq	%r11, %rbx
+	LONG $0xf8e38348               // andq	$-8, %rbx
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	LONG $0x07e38341               // andl	$7, %r11d
+	JE   BB0_15
+
+BB0_16:
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	LONG $0x011c8d49               // leaq	(%r9,%rax), %rbx
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x0410fac5; BYTE $0x9e   // vmovss	(%rsi,%rbx,4), %xmm0
+	LONG $0xad69c2c4; BYTE $0x03   // vfnmadd213ss	(%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x03   // vmovss	%xmm0, (%r11)
+	LONG $0x01588d4c               // leaq	1(%rax), %r11
+	WORD $0x394c; BYTE $0xda       // cmpq	%r11, %rdx
+	JLE  BB0_15
+	LONG $0x1f1c8d4b               // leaq	(%r15,%r11), %rbx
+	WORD $0x014d; BYTE $0xcb       // addq	%r9, %r11
+	LONG $0x9e1c8d48               // leaq	(%rsi,%rbx,4), %rbx
+	LONG $0x107aa1c4; WORD $0x9e04 // vmovss	(%rsi,%r11,4), %xmm0
+	LONG $0x02588d4c               // leaq	2(%rax), %r11
+	LONG $0xad69e2c4; BYTE $0x03   // vfnmadd213ss	(%rbx), %xmm2, %xmm0
+	LONG $0x0311fac5               // vmovss	%xmm0, (%rbx)
+	WORD $0x394c; BYTE $0xda       // cmpq	%r11, %rdx
+	JLE  BB0_15
+	LONG $0x1f1c8d4b               // leaq	(%r15,%r11), %rbx
+	WORD $0x014d; BYTE $0xcb       // addq	%r9, %r11
+	LONG $0x9e1c8d48               // leaq	(%rsi,%rbx,4), %rbx
+	LONG $0x107aa1c4; WORD $0x9e04 // vmovss	(%rsi,%r11,4), %xmm0
+	LONG $0x03588d4c               // leaq	3(%rax), %r11
+	LONG $0xad69e2c4; BYTE $0x03   // vfnmadd213ss	(%rbx), %xmm2, %xmm0
+	LONG $0x0311fac5               // vmovss	%xmm0, (%rbx)
+	WORD $0x394c; BYTE $0xda       // cmpq	%r11, %rdx
+	JLE  BB0_15
+	LONG $0x1f1c8d4b               // leaq	(%r15,%r11), %rbx
+	WORD $0x014d; BYTE $0xcb       // addq	%r9, %r11
+	LONG $0x9e1c8d48               // leaq	(%rsi,%rbx,4), %rbx
+	LONG $0x107aa1c4; WORD $0x9e04 // vmovss	(%rsi,%r11,4), %xmm0
+	LONG $0x04588d4c               // leaq	4(%rax), %r11
+	LONG $0xad69e2c4; BYTE $0x03   // vfnmadd213ss	(%rbx), %xmm2, %xmm0
+	LONG $0x0311fac5               // vmovss	%xmm0, (%rbx)
+	WORD $0x394c; BYTE $0xda       // cmpq	%r11, %rdx
+	JLE  BB0_15
+	LONG $0x1f1c8d4b               // leaq	(%r15,%r11), %rbx
+	WORD $0x014d; BYTE $0xcb       // addq	%r9, %r11
+	LONG $0x9e1c8d48               // leaq	(%rsi,%rbx,4), %rbx
+	LONG $0x107aa1c4; WORD $0x9e04 // vmovss	(%rsi,%r11,4), %xmm0
+	LONG $0x05588d4c               // leaq	5(%rax), %r11
+	LONG $0xad69e2c4; BYTE $0x03   // vfnmadd213ss	(%rbx), %xmm2, %xmm0
+	LONG $0x0311fac5               // vmovss	%xmm0, (%rbx)
+	WORD $0x394c; BYTE $0xda       // cmpq	%r11, %rdx
+	JLE  BB0_15
+	LONG $0x1f1c8d4b               // leaq	(%r15,%r11), %rbx
+	WORD $0x014d; BYTE $0xcb       // addq	%r9, %r11
+	LONG $0x06c08348               // addq	$6, %rax
+	LONG $0x9e1c8d48               // leaq	(%rsi,%rbx,4), %rbx
+	LONG $0x107aa1c4; WORD $0x9e04 // vmovss	(%rsi,%r11,4), %xmm0
+	LONG $0xad69e2c4; BYTE $0x03   // vfnmadd213ss	(%rbx), %xmm2, %xmm0
+	LONG $0x0311fac5               // vmovss	%xmm0, (%rbx)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_15
+
+BB0_77:
+	LONG $0x071c8d4d               // leaq	(%r15,%rax), %r11
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x9e1c8d4e               // leaq	(%rsi,%r11,4), %r11
+	LONG $0x107ac1c4; BYTE $0x0b   // vmovss	(%r11), %xmm1
+	LONG $0x9d71e2c4; WORD $0x8614 // vfnmadd132ss	(%rsi,%rax,4), %xmm1, %xmm2
+	LONG $0x117ac1c4; BYTE $0x13   // vmovss	%xmm2, (%r11)
+	JMP  BB0_15
+
+BB0_37:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_6
+
+BB0_39:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_22
+
+BB0_40:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_28
+
+BB0_38:
+	WORD $0x8948; BYTE $0xc8 // movq	%rcx, %rax
+	WORD $0x3145; BYTE $0xe4 // xorl	%r12d, %r12d
+	JMP  BB0_12
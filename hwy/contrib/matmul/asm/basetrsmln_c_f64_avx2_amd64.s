@@ -0,0 +1,369 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basetrsmln_c_f64_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x00000000
+DATA CPI0_0<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x80000000
+DATA CPI0_1<>+8(SB)/4, $0x00000000
+DATA CPI0_1<>+12(SB)/4, $0x00000000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $16
+
+TEXT ·trsmln_c_f64_avx2(SB), $128-48
+	MOVQ   l+0(FP), DI
+	MOVQ   b+8(FP), SI
+	MOVQ   pn+16(FP), DX
+	MOVQ   pnrhs+24(FP), CX
+	MOVQ   plen_l+32(FP), R8
+	MOVQ   plen_b+40(FP), R9
+	LONG   $0x246c8d48; BYTE $0x70 // leaq	112(%rsp), %rbp
+	LONG   $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG   $0xe0e48348             // andq	$-32, %rsp
+	WORD   $0x8b4c; BYTE $0x39     // movq	(%rcx), %r15
+	WORD   $0x8b48; BYTE $0x1a     // movq	(%rdx), %rbx
+	LONG   $0x247c8948; BYTE $0x50 // movq	%rdi, 80(%rsp)
+	WORD   $0x854d; BYTE $0xff     // testq	%r15, %r15
+	JE     BB0_85
+	WORD   $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE    BB0_85
+	LONG   $0xfc578d49             // leaq	-4(%r15), %rdx
+	VMOVSD CPI0_0<>(SB), X3        // vmovsd	.LCPI0_0(%rip), %xmm3
+	WORD   $0xc931                 // xorl	%ecx, %ecx
+	WORD   $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	LONG   $0x02e8c148             // shrq	$2, %rax
+	QUAD   $0x0000000485048d48     // leaq	4(,%rax,4), %rax
+	LONG   $0x24448948; BYTE $0x58 // movq	%rax, 88(%rsp)
+	LONG   $0x24448b48; BYTE $0x50 // movq	80(%rsp), %rax
+	LONG   $0x005ee3c5             // vdivsd	(%rax), %xmm3, %xmm0
+	LONG   $0x197de2c4; BYTE $0xc8 // vbroadcastsd	%xmm0, %ymm1
+	LONG   $0x03ff8349             // cmpq	$3, %r15
+	JLE    BB0_36
+	WORD   $0x8948; BYTE $0xd1     // movq	%rdx, %rcx
+	WORD   $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	LONG   $0xfce18348             // andq	$-4, %rcx
+	LONG   $0xce4c8d48; BYTE $0x20 // leaq	32(%rsi,%rcx,8), %rcx
+
+BB0_4:
+	LONG $0x0059f5c5             // vmulpd	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fdc5; BYTE $0xe0 // vmovupd	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JNE  BB0_4
+	LONG $0x24448b48; BYTE $0x50 // movq	80(%rsp), %rax
+	LONG $0x244c8b48; BYTE $0x58 // movq	88(%rsp), %rcx
+	LONG $0x005ee3c5             // vdivsd	(%rax), %xmm3, %xmm0
+
+BB0_36:
+	WORD $0x3949; BYTE $0xcf     // cmpq	%rcx, %r15
+	JLE  BB0_31
+	WORD $0x894c; BYTE $0xff     // movq	%r15, %rdi
+	WORD $0x8949; BYTE $0xc9     // movq	%rcx, %r9
+	WORD $0x2948; BYTE $0xcf     // subq	%rcx, %rdi
+	LONG $0xff478d48             // leaq	-1(%rdi), %rax
+	LONG $0x02f88348             // cmpq	$2, %rax
+	JBE  BB0_40
+	WORD $0x8949; BYTE $0xf8     // movq	%rdi, %r8
+	LONG $0xce048d48             // leaq	(%rsi,%rcx,8), %rax
+	LONG $0x197de2c4; BYTE $0xd0 // vbroadcastsd	%xmm0, %ymm2
+	LONG $0x02e8c149             // shrq	$2, %r8
+	LONG $0x05e0c149             // salq	$5, %r8
+	WORD $0x0149; BYTE $0xc0     // addq	%rax, %r8
+
+BB0_29:
+	LONG $0x0859edc5             // vmulpd	(%rax), %ymm2, %ymm1
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4811fdc5; BYTE $0xe0 // vmovupd	%ymm1, -32(%rax)
+	WORD $0x3949; BYTE $0xc0     // cmpq	%rax, %r8
+	JNE  BB0_29
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc1     // addq	%rax, %rcx
+	LONG $0x03c7f640             // testb	$3, %dil
+	JE   BB0_31
+
+BB0_28:
+	WORD $0x2948; BYTE $0xc7 // subq	%rax, %rdi
+	LONG $0x01ff8348         // cmpq	$1, %rdi
+	JE   BB0_33
+	WORD $0x014c; BYTE $0xc8 // addq	%r9, %rax
+	LONG $0xc812fbc5         // vmovddup	%xmm0, %xmm1
+	LONG $0xc6048d48         // leaq	(%rsi,%rax,8), %rax
+	LONG $0x0859f1c5         // vmulpd	(%rax), %xmm1, %xmm1
+	LONG $0x0811f9c5         // vmovupd	%xmm1, (%rax)
+	LONG $0x01c7f640         // testb	$1, %dil
+	JE   BB0_31
+	LONG $0xfee78348         // andq	$-2, %rdi
+	WORD $0x0148; BYTE $0xf9 // addq	%rdi, %rcx
+
+BB0_33:
+	LONG $0xce048d48 // leaq	(%rsi,%rcx,8), %rax
+	LONG $0x0059fbc5 // vmulsd	(%rax), %xmm0, %xmm0
+	LONG $0x0011fbc5 // vmovsd	%xmm0, (%rax)
+
+BB0_31:
+	LONG  $0x01fb8348               // cmpq	$1, %rbx
+	JE    BB0_84
+	LONG  $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG  $0xfce28348               // andq	$-4, %rdx
+	WORD  $0x894d; BYTE $0xfa       // movq	%r15, %r10
+	WORD  $0x8949; BYTE $0xdc       // movq	%rbx, %r12
+	QUAD  $0x00000008dd2c8d4c       // leaq	8(,%rbx,8), %r13
+	LONG  $0x24548948; BYTE $0x30   // movq	%rdx, 48(%rsp)
+	WORD  $0xf749; BYTE $0xda       // negq	%r10
+	VMOVQ CPI0_1<>(SB), X4          // vmovq	.LCPI0_1(%rip), %xmm4
+	LONG  $0x281c8d4e               // leaq	(%rax,%r13), %r11
+	LONG  $0x20468d48               // leaq	32(%rsi), %rax
+	WORD  $0x894d; BYTE $0xf9       // movq	%r15, %r9
+	LONG  $0x0001be41; WORD $0x0000 // movl	$1, %r14d
+	LONG  $0x24448948; BYTE $0x28   // movq	%rax, 40(%rsp)
+	WORD  $0x894c; BYTE $0xe8       // movq	%r13, %rax
+	WORD  $0x894d; BYTE $0xd5       // movq	%r10, %r13
+	WORD  $0x8949; BYTE $0xc2       // movq	%rax, %r10
+
+BB0_27:
+	LONG $0x247c8b48; BYTE $0x30 // movq	48(%rsp), %rdi
+	LONG $0x24448b48; BYTE $0x50 // movq	80(%rsp), %rax
+	LONG $0x246c894c; BYTE $0x20 // movq	%r13, 32(%rsp)
+	WORD $0x3145; BYTE $0xc0     // xorl	%r8d, %r8d
+	LONG $0x245c8948; BYTE $0x18 // movq	%rbx, 24(%rsp)
+	LONG $0x0f148d4a             // leaq	(%rdi,%r9), %rdx
+	LONG $0x247c8b48; BYTE $0x28 // movq	40(%rsp), %rdi
+	LONG $0xe0048d4a             // leaq	(%rax,%r12,8), %rax
+	LONG $0x2474894c; BYTE $0x48 // movq	%r14, 72(%rsp)
+	LONG $0x245c894c; BYTE $0x10 // movq	%r11, 16(%rsp)
+	LONG $0x2464894c; BYTE $0x08 // movq	%r12, 8(%rsp)
+	LONG $0xd70c8d48             // leaq	(%rdi,%rdx,8), %rcx
+	WORD $0xd231                 // xorl	%edx, %edx
+	WORD $0x894c; BYTE $0xef     // movq	%r13, %rdi
+	LONG $0x2414894c             // movq	%r10, (%rsp)
+	LONG $0x24448948; BYTE $0x40 // movq	%rax, 64(%rsp)
+	LONG $0xce048d4a             // leaq	(%rsi,%r9,8), %rax
+	LONG $0x24448948; BYTE $0x38 // movq	%rax, 56(%rsp)
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+
+BB0_9:
+	LONG $0x245c8b48; BYTE $0x40 // movq	64(%rsp), %rbx
+	LONG $0x1410fbc5; BYTE $0xc3 // vmovsd	(%rbx,%rax,8), %xmm2
+	LONG $0xcc57e9c5             // vxorpd	%xmm4, %xmm2, %xmm1
+	LONG $0x197de2c4; BYTE $0xc9 // vbroadcastsd	%xmm1, %ymm1
+	LONG $0x03ff8349             // cmpq	$3, %r15
+	JLE  BB0_37
+	LONG $0x24548b48; BYTE $0x38 // movq	56(%rsp), %rdx
+
+BB0_7:
+	LONG $0x0410fdc5; BYTE $0xfa // vmovupd	(%rdx,%rdi,8), %ymm0
+	LONG $0xa8f5e2c4; BYTE $0x02 // vfmadd213pd	(%rdx), %ymm1, %ymm0
+	LONG $0x20c28348             // addq	$32, %rdx
+	LONG $0x4211fdc5; BYTE $0xe0 // vmovupd	%ymm0, -32(%rdx)
+	WORD $0x3948; BYTE $0xd1     // cmpq	%rdx, %rcx
+	JNE  BB0_7
+	LONG $0x24548b48; BYTE $0x58 // movq	88(%rsp), %rdx
+
+BB0_6:
+	WORD $0x3949; BYTE $0xd7 // cmpq	%rdx, %r15
+	JLE  BB0_15
+	WORD $0x894d; BYTE $0xfa // movq	%r15, %r10
+	LONG $0x0a1c8d4e         // leaq	(%rdx,%r9), %r11
+	LONG $0x021c8d4a         // leaq	(%rdx,%r8), %rbx
+	WORD $0x2949; BYTE $0xd2 // subq	%rdx, %r10
+	LONG $0x01fa8349         // cmpq	$1, %r10
+	JE   BB0_11
+	QUAD $0x00000000dd248d4e // leaq	0(,%r11,8), %r12
+	LONG $0x021c8d4a         // leaq	(%rdx,%r8), %rbx
+	QUAD $0x00000008dd2c8d4c // leaq	8(,%rbx,8), %r13
+	WORD $0x894d; BYTE $0xe6 // movq	%r12, %r14
+	WORD $0x294d; BYTE $0xee // subq	%r13, %r14
+	LONG $0x10fe8349         // cmpq	$16, %r14
+	JA   BB0_88
+
+BB0_11:
+	LONG $0xde148d4e               // leaq	(%rsi,%r11,8), %r10
+	LONG $0x0410fbc5; BYTE $0xde   // vmovsd	(%rsi,%rbx,8), %xmm0
+	LONG $0xade9c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	LONG $0x01528d4c               // leaq	1(%rdx), %r10
+	WORD $0x394d; BYTE $0xd7       // cmpq	%r10, %r15
+	JLE  BB0_15
+	LONG $0x111c8d4f               // leaq	(%r9,%r10), %r11
+	WORD $0x014d; BYTE $0xc2       // addq	%r8, %r10
+	LONG $0xde1c8d4e               // leaq	(%rsi,%r11,8), %r11
+	LONG $0x107ba1c4; WORD $0xd604 // vmovsd	(%rsi,%r10,8), %xmm0
+	LONG $0x02528d4c               // leaq	2(%rdx), %r10
+	LONG $0xade9c2c4; BYTE $0x03   // vfnmadd213sd	(%r11), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x03   // vmovsd	%xmm0, (%r11)
+	WORD $0x394d; BYTE $0xd7       // cmpq	%r10, %r15
+	JLE  BB0_15
+	LONG $0x0a1c8d4f               // leaq	(%r10,%r9), %r11
+	WORD $0x014d; BYTE $0xc2       // addq	%r8, %r10
+	LONG $0xde1c8d4e               // leaq	(%rsi,%r11,8), %r11
+	LONG $0x107ba1c4; WORD $0xd604 // vmovsd	(%rsi,%r10,8), %xmm0
+	LONG $0x03528d4c               // leaq	3(%rdx), %r10
+	LONG $0xade9c2c4; BYTE $0x03   // vfnmadd213sd	(%r11), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x03   // vmovsd	%xmm0, (%r11)
+	WORD $0x394d; BYTE $0xd7       // cmpq	%r10, %r15
+	JLE  BB0_15
+	LONG $0x0a1c8d4f               // leaq	(%r10,%r9), %r11
+	WORD $0x014d; BYTE $0xc2       // addq	%r8, %r10
+	LONG $0xde1c8d4e               // leaq	(%rsi,%r11,8), %r11
+	LONG $0x107bc1c4; BYTE $0x3b   // vmovsd	(%r11), %xmm7
+	LONG $0x9dc1a2c4; WORD $0xd614 // vfnmadd132sd	(%rsi,%r10,8), %xmm7, %xmm2
+	LONG $0x117bc1c4; BYTE $0x13   // vmovsd	%xmm2, (%r11)
+
+BB0_15:
+	LONG $0x245c8b48; BYTE $0x48 // movq	72(%rsp), %rbx
+	LONG $0x01c08348             // addq	$1, %rax
+	WORD $0x014d; BYTE $0xf8     // addq	%r15, %r8
+	WORD $0x014c; BYTE $0xff     // addq	%r15, %rdi
+	WORD $0x3948; BYTE $0xd8     // cmpq	%rbx, %rax
+	JL   BB0_9
+	LONG $0x245c8b4c; BYTE $0x10 // movq	16(%rsp), %r11
+	WORD $0x8949; BYTE $0xde     // movq	%rbx, %r14
+	LONG $0x246c8b4c; BYTE $0x20 // movq	32(%rsp), %r13
+	LONG $0x245c8b48; BYTE $0x18 // movq	24(%rsp), %rbx
+	LONG $0x24448b48; BYTE $0x38 // movq	56(%rsp), %rax
+	LONG $0x5e63c1c4; BYTE $0x03 // vdivsd	(%r11), %xmm3, %xmm0
+	LONG $0x24648b4c; BYTE $0x08 // movq	8(%rsp), %r12
+	LONG $0x24148b4c             // movq	(%rsp), %r10
+	LONG $0x197de2c4; BYTE $0xc8 // vbroadcastsd	%xmm0, %ymm1
+	LONG $0x03ff8349             // cmpq	$3, %r15
+	JLE  BB0_19
+
+BB0_20:
+	LONG $0x0059f5c5             // vmulpd	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fdc5; BYTE $0xe0 // vmovupd	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JNE  BB0_20
+	LONG $0x5e63c1c4; BYTE $0x03 // vdivsd	(%r11), %xmm3, %xmm0
+
+BB0_19:
+	WORD $0x3949; BYTE $0xd7     // cmpq	%rdx, %r15
+	JLE  BB0_21
+	WORD $0x894c; BYTE $0xf9     // movq	%r15, %rcx
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	WORD $0x2948; BYTE $0xd1     // subq	%rdx, %rcx
+	LONG $0xff418d48             // leaq	-1(%rcx), %rax
+	LONG $0x02f88348             // cmpq	$2, %rax
+	JBE  BB0_39
+	WORD $0x8948; BYTE $0xcf     // movq	%rcx, %rdi
+	LONG $0x0a048d4a             // leaq	(%rdx,%r9), %rax
+	LONG $0x197de2c4; BYTE $0xd0 // vbroadcastsd	%xmm0, %ymm2
+	LONG $0x02efc148             // shrq	$2, %rdi
+	LONG $0xc6048d48             // leaq	(%rsi,%rax,8), %rax
+	LONG $0x05e7c148             // salq	$5, %rdi
+	WORD $0x0148; BYTE $0xc7     // addq	%rax, %rdi
+
+BB0_23:
+	LONG $0x0859edc5             // vmulpd	(%rax), %ymm2, %ymm1
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4811fdc5; BYTE $0xe0 // vmovupd	%ymm1, -32(%rax)
+	WORD $0x3948; BYTE $0xf8     // cmpq	%rdi, %rax
+	JNE  BB0_23
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	WORD $0xc1f6; BYTE $0x03     // testb	$3, %cl
+	JE   BB0_21
+
+BB0_22:
+	WORD $0x2948; BYTE $0xc1 // subq	%rax, %rcx
+	LONG $0x01f98348         // cmpq	$1, %rcx
+	JE   BB0_25
+	WORD $0x014d; BYTE $0xc8 // addq	%r9, %r8
+	LONG $0xc812fbc5         // vmovddup	%xmm0, %xmm1
+	WORD $0x0149; BYTE $0xc0 // addq	%rax, %r8
+	LONG $0xc6048d4a         // leaq	(%rsi,%r8,8), %rax
+	LONG $0x0859f1c5         // vmulpd	(%rax), %xmm1, %xmm1
+	LONG $0x0811f9c5         // vmovupd	%xmm1, (%rax)
+	WORD $0xc1f6; BYTE $0x01 // testb	$1, %cl
+	JE   BB0_21
+	LONG $0xfee18348         // andq	$-2, %rcx
+	WORD $0x0148; BYTE $0xca // addq	%rcx, %rdx
+
+BB0_25:
+	WORD $0x014c; BYTE $0xca // addq	%r9, %rdx
+	LONG $0xd6048d48         // leaq	(%rsi,%rdx,8), %rax
+	LONG $0x0059fbc5         // vmulsd	(%rax), %xmm0, %xmm0
+	LONG $0x0011fbc5         // vmovsd	%xmm0, (%rax)
+
+BB0_21:
+	LONG $0x01c68349         // addq	$1, %r14
+	WORD $0x014d; BYTE $0xf9 // addq	%r15, %r9
+	WORD $0x014d; BYTE $0xd3 // addq	%r10, %r11
+	WORD $0x294d; BYTE $0xfd // subq	%r15, %r13
+	WORD $0x0149; BYTE $0xdc // addq	%rbx, %r12
+	WORD $0x394c; BYTE $0xf3 // cmpq	%r14, %rbx
+	JNE  BB0_27
+
+BB0_84:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_85:
+	LONG $0x90658d48 // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_88:
+	LONG $0xff728d4d                           // leaq	-1(%r10), %r14
+	LONG $0x02fe8349                           // cmpq	$2, %r14
+	JBE  BB0_38
+	WORD $0x0149; BYTE $0xf4                   // addq	%rsi, %r12
+	LONG $0x197de2c4; BYTE $0xc2               // vbroadcastsd	%xmm2, %ymm0
+	LONG $0x107dc1c4; WORD $0x243c             // vmovupd	(%r12), %ymm7
+	LONG $0x9cc5a2c4; WORD $0x2e44; BYTE $0xf8 // vfnmadd132pd	-8(%rsi,%r13), %ymm7, %ymm0
+	LONG $0x117dc1c4; WORD $0x2404             // vmovupd	%ymm0, (%r12)
+	LONG $0x03c2f641                           // testb	$3, %r10b
+	JE   BB0_15
+	WORD $0x894d; BYTE $0xd5                   // movq	%r10, %r13
+	LONG $0xfce58349                           // andq	$-4, %r13
+	WORD $0x294d; BYTE $0xea                   // subq	%r13, %r10
+	LONG $0x15648d4d; BYTE $0x00               // leaq	0(%r13,%rdx), %r12
+	LONG $0x01fa8349                           // cmpq	$1, %r10
+	JE   BB0_16
+
+BB0_12:
+	WORD $0x014d; BYTE $0xeb       // addq	%r13, %r11
+	WORD $0x0149; BYTE $0xdd       // addq	%rbx, %r13
+	LONG $0xc212fbc5               // vmovddup	%xmm2, %xmm0
+	LONG $0xde1c8d4e               // leaq	(%rsi,%r11,8), %r11
+	LONG $0x1079c1c4; BYTE $0x33   // vmovupd	(%r11), %xmm6
+	LONG $0x9cc9a2c4; WORD $0xee04 // vfnmadd132pd	(%rsi,%r13,8), %xmm6, %xmm0
+	LONG $0x1179c1c4; BYTE $0x03   // vmovupd	%xmm0, (%r11)
+	LONG $0x01c2f641               // testb	$1, %r10b
+	JE   BB0_15
+	LONG $0xfee28349               // andq	$-2, %r10
+	WORD $0x014d; BYTE $0xd4       // addq	%r10, %r12
+
+BB0_16:
+	LONG $0x21148d4f               // leaq	(%r9,%r12), %r10
+	WORD $0x014d; BYTE $0xc4       // addq	%r8, %r12
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x107bc1c4; BYTE $0x2a   // vmovsd	(%r10), %xmm5
+	LONG $0x9dd1a2c4; WORD $0xe614 // vfnmadd132sd	(%rsi,%r12,8), %xmm5, %xmm2
+	LONG $0x117bc1c4; BYTE $0x12   // vmovsd	%xmm2, (%r10)
+	JMP  BB0_15
+
+BB0_37:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_6
+
+BB0_39:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_22
+
+BB0_40:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_28
+
+BB0_38:
+	WORD $0x8949; BYTE $0xd4 // movq	%rdx, %r12
+	WORD $0x3145; BYTE $0xed // xorl	%r13d, %r13d
+	JMP  BB0_12
@@ -0,0 +1,467 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basetrsmln_c_f64_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x00000000
+DATA CPI0_0<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x80000000
+DATA CPI0_1<>+8(SB)/4, $0x00000000
+DATA CPI0_1<>+12(SB)/4, $0x00000000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $16
+
+TEXT ·trsmln_c_f64_avx512(SB), $128-48
+	MOVQ   l+0(FP), DI
+	MOVQ   b+8(FP), SI
+	MOVQ   pn+16(FP), DX
+	MOVQ   pnrhs+24(FP), CX
+	MOVQ   plen_l+32(FP), R8
+	MOVQ   plen_b+40(FP), R9
+	WORD   $0x8b48; BYTE $0x09       // movq	(%rcx), %rcx
+	WORD   $0x8b48; BYTE $0x02       // movq	(%rdx), %rax
+	WORD   $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JE     BB0_77
+	WORD   $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JLE    BB0_80
+	LONG   $0xf8498d4c               // leaq	-8(%rcx), %r9
+	WORD   $0xd231                   // xorl	%edx, %edx
+	LONG   $0x246c8d48; BYTE $0x70   // leaq	112(%rsp), %rbp
+	WORD   $0x8949; BYTE $0xff       // movq	%rdi, %r15
+	WORD   $0x8948; BYTE $0xc3       // movq	%rax, %rbx
+	WORD   $0x894c; BYTE $0xc8       // movq	%r9, %rax
+	LONG   $0x03e8c148               // shrq	$3, %rax
+	QUAD   $0x00000008c5048d48       // leaq	8(,%rax,8), %rax
+	LONG   $0x24648d48; BYTE $0x40   // leaq	64(%rsp), %rsp
+	LONG   $0xc0e48348               // andq	$-64, %rsp
+	VMOVSD CPI0_0<>(SB), X4          // vmovsd	.LCPI0_0(%rip), %xmm4
+	LONG   $0x175edbc5               // vdivsd	(%rdi), %xmm4, %xmm2
+	LONG   $0x48fdf262; WORD $0xca19 // vbroadcastsd	%xmm2, %zmm1
+	LONG   $0x24448948; BYTE $0x30   // movq	%rax, 48(%rsp)
+	LONG   $0x07f98348               // cmpq	$7, %rcx
+	JLE    BB0_36
+	WORD   $0x894c; BYTE $0xca       // movq	%r9, %rdx
+	WORD   $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG   $0xf8e28348               // andq	$-8, %rdx
+	LONG   $0xd6548d48; BYTE $0x40   // leaq	64(%rsi,%rdx,8), %rdx
+
+BB0_4:
+	LONG $0x48f5f162; WORD $0x0059             // vmulpd	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x48fdf162; WORD $0x4011; BYTE $0xff // vmovupd	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JNE  BB0_4
+	LONG $0x24548b48; BYTE $0x30               // movq	48(%rsp), %rdx
+	LONG $0x5e5bc1c4; BYTE $0x17               // vdivsd	(%r15), %xmm4, %xmm2
+
+BB0_36:
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	WORD $0x8949; BYTE $0xd2       // movq	%rdx, %r10
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_40
+	WORD $0x8949; BYTE $0xf8       // movq	%rdi, %r8
+	LONG $0xd6048d48               // leaq	(%rsi,%rdx,8), %rax
+	LONG $0x48fdf262; WORD $0xca19 // vbroadcastsd	%xmm2, %zmm1
+	LONG $0x03e8c149               // shrq	$3, %r8
+	LONG $0x06e0c149               // salq	$6, %r8
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+
+BB0_29:
+	LONG $0x48f5f162; WORD $0x0059             // vmulpd	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x48fdf162; WORD $0x4011; BYTE $0xff // vmovupd	%zmm0, -64(%rax)
+	WORD $0x394c; BYTE $0xc0                   // cmpq	%r8, %rax
+	JNE  BB0_29
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x07c7f640                           // testb	$7, %dil
+	JE   BB0_31
+
+BB0_28:
+	WORD $0x2948; BYTE $0xc7     // subq	%rax, %rdi
+	LONG $0xff478d4c             // leaq	-1(%rdi), %r8
+	LONG $0x02f88349             // cmpq	$2, %r8
+	JBE  BB0_33
+	WORD $0x014c; BYTE $0xd0     // addq	%r10, %rax
+	LONG $0x197de2c4; BYTE $0xc2 // vbroadcastsd	%xmm2, %ymm0
+	LONG $0xc6048d48             // leaq	(%rsi,%rax,8), %rax
+	LONG $0x0059fdc5             // vmulpd	(%rax), %ymm0, %ymm0
+	LONG $0x0011fdc5             // vmovupd	%ymm0, (%rax)
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	WORD $0xe783; BYTE $0x03     // andl	$3, %edi
+	JE   BB0_31
+
+BB0_33:
+	LONG $0xd6048d48         // leaq	(%rsi,%rdx,8), %rax
+	LONG $0x0059ebc5         // vmulsd	(%rax), %xmm2, %xmm0
+	LONG $0x0011fbc5         // vmovsd	%xmm0, (%rax)
+	LONG $0x01428d48         // leaq	1(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1 // cmpq	%rax, %rcx
+	JLE  BB0_31
+	LONG $0xc6048d48         // leaq	(%rsi,%rax,8), %rax
+	LONG $0x02c28348         // addq	$2, %rdx
+	LONG $0x0059ebc5         // vmulsd	(%rax), %xmm2, %xmm0
+	LONG $0x0011fbc5         // vmovsd	%xmm0, (%rax)
+	WORD $0x3948; BYTE $0xd1 // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	LONG $0xd6048d48         // leaq	(%rsi,%rdx,8), %rax
+	LONG $0x1059ebc5         // vmulsd	(%rax), %xmm2, %xmm2
+	LONG $0x1011fbc5         // vmovsd	%xmm2, (%rax)
+
+BB0_31:
+	WORD  $0x8948; BYTE $0xd8       // movq	%rbx, %rax
+	LONG  $0x01fb8348               // cmpq	$1, %rbx
+	JE    BB0_74
+	WORD  $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	LONG  $0x24448948; BYTE $0x28   // movq	%rax, 40(%rsp)
+	LONG  $0x406e8d4c               // leaq	64(%rsi), %r13
+	WORD  $0x8949; BYTE $0xc8       // movq	%rcx, %r8
+	LONG  $0x0001bc41; WORD $0x0000 // movl	$1, %r12d
+	WORD  $0xf748; BYTE $0xdf       // negq	%rdi
+	QUAD  $0x00000008dd1c8d48       // leaq	8(,%rbx,8), %rbx
+	VMOVQ CPI0_1<>(SB), X6          // vmovq	.LCPI0_1(%rip), %xmm6
+	LONG  $0x1f148d4d               // leaq	(%r15,%rbx), %r10
+	LONG  $0x6ef9e1c4; BYTE $0xeb   // vmovq	%rbx, %xmm5
+	WORD  $0x894c; BYTE $0xcb       // movq	%r9, %rbx
+	LONG  $0xf8e38348               // andq	$-8, %rbx
+	LONG  $0x2454894c; BYTE $0x38   // movq	%r10, 56(%rsp)
+	LONG  $0x6ef941c4; BYTE $0xc7   // vmovq	%r15, %xmm8
+	WORD  $0x894d; BYTE $0xe7       // movq	%r12, %r15
+	WORD  $0x8949; BYTE $0xda       // movq	%rbx, %r10
+	LONG  $0x7ef9c1c4; BYTE $0xeb   // vmovq	%xmm5, %r11
+	WORD  $0x8949; BYTE $0xfc       // movq	%rdi, %r12
+	WORD  $0x8948; BYTE $0xc3       // movq	%rax, %rbx
+	LONG  $0x6ef941c4; BYTE $0xcd   // vmovq	%r13, %xmm9
+
+BB0_27:
+	LONG $0x247c8b48; BYTE $0x28 // movq	40(%rsp), %rdi
+	LONG $0x02148d4b             // leaq	(%r10,%r8), %rdx
+	LONG $0x2414894c             // movq	%r10, (%rsp)
+	WORD $0x3145; BYTE $0xc9     // xorl	%r9d, %r9d
+	LONG $0x7ef961c4; BYTE $0xc0 // vmovq	%xmm8, %rax
+	LONG $0x247c894c; BYTE $0x20 // movq	%r15, 32(%rsp)
+	LONG $0x6ef9c1c4; BYTE $0xeb // vmovq	%r11, %xmm5
+	LONG $0xf8048d48             // leaq	(%rax,%rdi,8), %rax
+	LONG $0x2464894c; BYTE $0x08 // movq	%r12, 8(%rsp)
+	LONG $0x7ef961c4; BYTE $0xcf // vmovq	%xmm9, %rdi
+	LONG $0x6ef9e1c4; BYTE $0xf8 // vmovq	%rax, %xmm7
+	LONG $0xc6048d4a             // leaq	(%rsi,%r8,8), %rax
+	LONG $0xd7348d4c             // leaq	(%rdi,%rdx,8), %r14
+	WORD $0xd231                 // xorl	%edx, %edx
+	LONG $0x24448948; BYTE $0x18 // movq	%rax, 24(%rsp)
+	WORD $0x894c; BYTE $0xe7     // movq	%r12, %rdi
+	LONG $0x6ef941c4; BYTE $0xd6 // vmovq	%r14, %xmm10
+	LONG $0x245c8948; BYTE $0x10 // movq	%rbx, 16(%rsp)
+	WORD $0x8948; BYTE $0xd3     // movq	%rdx, %rbx
+
+BB0_9:
+	LONG $0x7ef9e1c4; BYTE $0xf8   // vmovq	%xmm7, %rax
+	LONG $0x1c10fbc5; BYTE $0xd8   // vmovsd	(%rax,%rbx,8), %xmm3
+	LONG $0xd657e1c5               // vxorpd	%xmm6, %xmm3, %xmm2
+	LONG $0x48fdf262; WORD $0xd219 // vbroadcastsd	%xmm2, %zmm2
+	LONG $0x07f98348               // cmpq	$7, %rcx
+	JLE  BB0_37
+	LONG $0x24448b48; BYTE $0x18   // movq	24(%rsp), %rax
+	LONG $0x7ef941c4; BYTE $0xd3   // vmovq	%xmm10, %r11
+
+BB0_7:
+	LONG $0x48fdf162; WORD $0x0410; BYTE $0xf8 // vmovupd	(%rax,%rdi,8), %zmm0
+	LONG $0x48edf262; WORD $0x00a8             // vfmadd213pd	(%rax), %zmm2, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x48fdf162; WORD $0x4011; BYTE $0xff // vmovupd	%zmm0, -64(%rax)
+	WORD $0x394c; BYTE $0xd8                   // cmpq	%r11, %rax
+	JNE  BB0_7
+	LONG $0x24548b48; BYTE $0x30               // movq	48(%rsp), %rdx
+	LONG $0x6ef941c4; BYTE $0xd3               // vmovq	%r11, %xmm10
+
+BB0_6:
+	WORD $0x3948; BYTE $0xd1 // cmpq	%rdx, %rcx
+	JLE  BB0_15
+	WORD $0x8948; BYTE $0xc8 // movq	%rcx, %rax
+	LONG $0x02148d4e         // leaq	(%rdx,%r8), %r10
+	LONG $0x0a3c8d4e         // leaq	(%rdx,%r9), %r15
+	WORD $0x2948; BYTE $0xd0 // subq	%rdx, %rax
+	LONG $0xff688d4c         // leaq	-1(%rax), %r13
+	LONG $0x02fd8349         // cmpq	$2, %r13
+	JBE  BB0_11
+	QUAD $0x00000000d5248d4e // leaq	0(,%r10,8), %r12
+	LONG $0x0a3c8d4e         // leaq	(%rdx,%r9), %r15
+	QUAD $0x00000008fd348d4e // leaq	8(,%r15,8), %r14
+	WORD $0x894d; BYTE $0xe3 // movq	%r12, %r11
+	WORD $0x294d; BYTE $0xf3 // subq	%r14, %r11
+	LONG $0x30fb8349         // cmpq	$48, %r11
+	JA   BB0_81
+
+BB0_11:
+	LONG $0xd6048d4a               // leaq	(%rsi,%r10,8), %rax
+	LONG $0x107ba1c4; WORD $0xfe04 // vmovsd	(%rsi,%r15,8), %xmm0
+	LONG $0xade1e2c4; BYTE $0x00   // vfnmadd213sd	(%rax), %xmm3, %xmm0
+	LONG $0x0011fbc5               // vmovsd	%xmm0, (%rax)
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_15
+	LONG $0x00148d4d               // leaq	(%r8,%rax), %r10
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x0410fbc5; BYTE $0xc6   // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0x02428d48               // leaq	2(%rdx), %rax
+	LONG $0xade1c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm3, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_15
+	LONG $0x00148d4e               // leaq	(%rax,%r8), %r10
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x0410fbc5; BYTE $0xc6   // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0x03428d48               // leaq	3(%rdx), %rax
+	LONG $0xade1c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm3, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_15
+	LONG $0x00148d4d               // leaq	(%r8,%rax), %r10
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x0410fbc5; BYTE $0xc6   // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0x04428d48               // leaq	4(%rdx), %rax
+	LONG $0xade1c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm3, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_15
+	LONG $0x00148d4d               // leaq	(%r8,%rax), %r10
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x0410fbc5; BYTE $0xc6   // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0x05428d48               // leaq	5(%rdx), %rax
+	LONG $0xade1c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm3, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_15
+	LONG $0x00148d4e               // leaq	(%rax,%r8), %r10
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x0410fbc5; BYTE $0xc6   // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0x06428d48               // leaq	6(%rdx), %rax
+	LONG $0xade1c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm3, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_15
+	LONG $0x00148d4d               // leaq	(%r8,%rax), %r10
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x0410fbc5; BYTE $0xc6   // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0x07428d48               // leaq	7(%rdx), %rax
+	LONG $0xade1c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm3, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_15
+	LONG $0x00148d4d               // leaq	(%r8,%rax), %r10
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x107bc1c4; BYTE $0x0a   // vmovsd	(%r10), %xmm1
+	LONG $0x9df1e2c4; WORD $0xc61c // vfnmadd132sd	(%rsi,%rax,8), %xmm1, %xmm3
+	LONG $0x117bc1c4; BYTE $0x1a   // vmovsd	%xmm3, (%r10)
+
+BB0_15:
+	LONG $0x24448b48; BYTE $0x20   // movq	32(%rsp), %rax
+	LONG $0x01c38348               // addq	$1, %rbx
+	WORD $0x0149; BYTE $0xc9       // addq	%rcx, %r9
+	WORD $0x0148; BYTE $0xcf       // addq	%rcx, %rdi
+	WORD $0x3948; BYTE $0xc3       // cmpq	%rax, %rbx
+	JL   BB0_9
+	LONG $0x247c8b48; BYTE $0x38   // movq	56(%rsp), %rdi
+	WORD $0x8949; BYTE $0xc7       // movq	%rax, %r15
+	LONG $0x245c8b48; BYTE $0x10   // movq	16(%rsp), %rbx
+	LONG $0x7ef941c4; BYTE $0xd6   // vmovq	%xmm10, %r14
+	LONG $0x24448b48; BYTE $0x18   // movq	24(%rsp), %rax
+	LONG $0x24148b4c               // movq	(%rsp), %r10
+	LONG $0x7ef9c1c4; BYTE $0xeb   // vmovq	%xmm5, %r11
+	LONG $0x1f5edbc5               // vdivsd	(%rdi), %xmm4, %xmm3
+	LONG $0x24648b4c; BYTE $0x08   // movq	8(%rsp), %r12
+	LONG $0x48fdf262; WORD $0xd319 // vbroadcastsd	%xmm3, %zmm2
+	LONG $0x07f98348               // cmpq	$7, %rcx
+	JLE  BB0_19
+
+BB0_20:
+	LONG $0x48edf162; WORD $0x0059             // vmulpd	(%rax), %zmm2, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x48fdf162; WORD $0x4011; BYTE $0xff // vmovupd	%zmm0, -64(%rax)
+	WORD $0x394c; BYTE $0xf0                   // cmpq	%r14, %rax
+	JNE  BB0_20
+	LONG $0x24448b48; BYTE $0x38               // movq	56(%rsp), %rax
+	LONG $0x185edbc5                           // vdivsd	(%rax), %xmm4, %xmm3
+
+BB0_19:
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_21
+	WORD $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	WORD $0x8949; BYTE $0xd1       // movq	%rdx, %r9
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_39
+	WORD $0x8949; BYTE $0xfd       // movq	%rdi, %r13
+	LONG $0x02048d4a               // leaq	(%rdx,%r8), %rax
+	LONG $0x48fdf262; WORD $0xcb19 // vbroadcastsd	%xmm3, %zmm1
+	LONG $0x03edc149               // shrq	$3, %r13
+	LONG $0xc6048d48               // leaq	(%rsi,%rax,8), %rax
+	LONG $0x06e5c149               // salq	$6, %r13
+	WORD $0x0149; BYTE $0xc5       // addq	%rax, %r13
+
+BB0_23:
+	LONG $0x48f5f162; WORD $0x0059             // vmulpd	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x48fdf162; WORD $0x4011; BYTE $0xff // vmovupd	%zmm0, -64(%rax)
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JNE  BB0_23
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x07c7f640                           // testb	$7, %dil
+	JE   BB0_21
+
+BB0_22:
+	WORD $0x2948; BYTE $0xc7     // subq	%rax, %rdi
+	LONG $0xff6f8d4c             // leaq	-1(%rdi), %r13
+	LONG $0x02fd8349             // cmpq	$2, %r13
+	JBE  BB0_25
+	WORD $0x014d; BYTE $0xc1     // addq	%r8, %r9
+	LONG $0x197de2c4; BYTE $0xc3 // vbroadcastsd	%xmm3, %ymm0
+	WORD $0x0149; BYTE $0xc1     // addq	%rax, %r9
+	LONG $0xce048d4a             // leaq	(%rsi,%r9,8), %rax
+	LONG $0x0059fdc5             // vmulpd	(%rax), %ymm0, %ymm0
+	LONG $0x0011fdc5             // vmovupd	%ymm0, (%rax)
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	WORD $0xe783; BYTE $0x03     // andl	$3, %edi
+	JE   BB0_21
+
+BB0_25:
+	LONG $0x02048d4a         // leaq	(%rdx,%r8), %rax
+	LONG $0xc6048d48         // leaq	(%rsi,%rax,8), %rax
+	LONG $0x0059e3c5         // vmulsd	(%rax), %xmm3, %xmm0
+	LONG $0x0011fbc5         // vmovsd	%xmm0, (%rax)
+	LONG $0x01428d48         // leaq	1(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1 // cmpq	%rax, %rcx
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xc0 // addq	%r8, %rax
+	LONG $0x02c28348         // addq	$2, %rdx
+	LONG $0xc6048d48         // leaq	(%rsi,%rax,8), %rax
+	LONG $0x0059e3c5         // vmulsd	(%rax), %xmm3, %xmm0
+	LONG $0x0011fbc5         // vmovsd	%xmm0, (%rax)
+	WORD $0x3948; BYTE $0xd1 // cmpq	%rdx, %rcx
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xc2 // addq	%r8, %rdx
+	LONG $0xd6048d48         // leaq	(%rsi,%rdx,8), %rax
+	LONG $0x1859e3c5         // vmulsd	(%rax), %xmm3, %xmm3
+	LONG $0x1811fbc5         // vmovsd	%xmm3, (%rax)
+
+BB0_21:
+	LONG $0x01c78349             // addq	$1, %r15
+	LONG $0x245c014c; BYTE $0x38 // addq	%r11, 56(%rsp)
+	WORD $0x0149; BYTE $0xc8     // addq	%rcx, %r8
+	WORD $0x2949; BYTE $0xcc     // subq	%rcx, %r12
+	LONG $0x245c0148; BYTE $0x28 // addq	%rbx, 40(%rsp)
+	WORD $0x394c; BYTE $0xfb     // cmpq	%r15, %rbx
+	JNE  BB0_27
+
+BB0_74:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	LONG $0x90658d48         // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_81:
+	LONG $0x06fd8349                                   // cmpq	$6, %r13
+	JBE  BB0_38
+	WORD $0x0149; BYTE $0xf4                           // addq	%rsi, %r12
+	QUAD $0xf836841048fdb162; WORD $0xffff; BYTE $0xff // vmovupd	-8(%rsi,%r14), %zmm0
+	LONG $0x48fdf262; WORD $0xd319                     // vbroadcastsd	%xmm3, %zmm2
+	WORD $0x8949; BYTE $0xc5                           // movq	%rax, %r13
+	LONG $0x48edd262; WORD $0x04ac; BYTE $0x24         // vfnmadd213pd	(%r12), %zmm2, %zmm0
+	LONG $0xf8e58349                                   // andq	$-8, %r13
+	LONG $0x48fdd162; WORD $0x0411; BYTE $0x24         // vmovupd	%zmm0, (%r12)
+	LONG $0x15648d4d; BYTE $0x00                       // leaq	0(%r13,%rdx), %r12
+	WORD $0x07a8                                       // testb	$7, %al
+	JE   BB0_15
+	WORD $0x294c; BYTE $0xe8                           // subq	%r13, %rax
+	LONG $0xff708d4c                                   // leaq	-1(%rax), %r14
+	LONG $0x02fe8349                                   // cmpq	$2, %r14
+	JBE  BB0_16
+
+BB0_12:
+	WORD $0x014d; BYTE $0xea       // addq	%r13, %r10
+	WORD $0x014d; BYTE $0xfd       // addq	%r15, %r13
+	LONG $0x197de2c4; BYTE $0xc3   // vbroadcastsd	%xmm3, %ymm0
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x107dc1c4; BYTE $0x0a   // vmovupd	(%r10), %ymm1
+	LONG $0x9cf5a2c4; WORD $0xee04 // vfnmadd132pd	(%rsi,%r13,8), %ymm1, %ymm0
+	LONG $0x117dc1c4; BYTE $0x02   // vmovupd	%ymm0, (%r10)
+	WORD $0x8949; BYTE $0xc2       // movq	%rax, %r10
+	LONG $0xfce28349               // andq	$-4, %r10
+	WORD $0x014d; BYTE $0xd4       // addq	%r10, %r12
+	WORD $0x03a8                   // testb	$3, %al
+	JE   BB0_15
+
+BB0_16:
+	LONG $0x20048d4b               // leaq	(%r8,%r12), %rax
+	LONG $0x21148d4f               // leaq	(%r9,%r12), %r10
+	LONG $0xc6048d48               // leaq	(%rsi,%rax,8), %rax
+	LONG $0x107ba1c4; WORD $0xd604 // vmovsd	(%rsi,%r10,8), %xmm0
+	LONG $0xade1e2c4; BYTE $0x00   // vfnmadd213sd	(%rax), %xmm3, %xmm0
+	LONG $0x0011fbc5               // vmovsd	%xmm0, (%rax)
+	LONG $0x24448d49; BYTE $0x01   // leaq	1(%r12), %rax
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_15
+	LONG $0x00148d4d               // leaq	(%r8,%rax), %r10
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x02c48349               // addq	$2, %r12
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x0410fbc5; BYTE $0xc6   // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0xade1c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm3, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xe1       // cmpq	%r12, %rcx
+	JLE  BB0_15
+	LONG $0x20048d4b               // leaq	(%r8,%r12), %rax
+	WORD $0x014d; BYTE $0xcc       // addq	%r9, %r12
+	LONG $0xc6048d48               // leaq	(%rsi,%rax,8), %rax
+	LONG $0x0810fbc5               // vmovsd	(%rax), %xmm1
+	LONG $0x9df1a2c4; WORD $0xe61c // vfnmadd132sd	(%rsi,%r12,8), %xmm1, %xmm3
+	LONG $0x1811fbc5               // vmovsd	%xmm3, (%rax)
+	JMP  BB0_15
+
+BB0_37:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_6
+
+BB0_39:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_22
+
+BB0_40:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_28
+
+BB0_77:
+	RET
+
+BB0_38:
+	WORD $0x8949; BYTE $0xd4 // movq	%rdx, %r12
+	WORD $0x3145; BYTE $0xed // xorl	%r13d, %r13d
+	JMP  BB0_12
+
+BB0_80:
+	RET
@@ -0,0 +1,387 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basetrsmlt_c_f32_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_1<>+0(SB)/4, $0x80000000
+DATA CPI0_1<>+4(SB)/4, $0x00000000
+DATA CPI0_1<>+8(SB)/4, $0x00000000
+DATA CPI0_1<>+12(SB)/4, $0x00000000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $16
+
+TEXT ·trsmlt_c_f32_avx2(SB), $32-48
+	MOVQ   l+0(FP), DI
+	MOVQ   b+8(FP), SI
+	MOVQ   pn+16(FP), DX
+	MOVQ   pnrhs+24(FP), CX
+	MOVQ   plen_l+32(FP), R8
+	MOVQ   plen_b+40(FP), R9
+	LONG   $0x246c8d48; BYTE $0x10 // leaq	16(%rsp), %rbp
+	LONG   $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG   $0xe0e48348             // andq	$-32, %rsp
+	LONG   $0x80c48348             // addq	$-128, %rsp
+	WORD   $0x8b48; BYTE $0x1a     // movq	(%rdx), %rbx
+	WORD   $0x8b4c; BYTE $0x39     // movq	(%rcx), %r15
+	LONG   $0x245c8948; BYTE $0x68 // movq	%rbx, 104(%rsp)
+	WORD   $0x854d; BYTE $0xff     // testq	%r15, %r15
+	JE     BB0_53
+	WORD   $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE    BB0_53
+	WORD   $0x8948; BYTE $0xd9     // movq	%rbx, %rcx
+	WORD   $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	WORD   $0x8949; BYTE $0xd9     // movq	%rbx, %r9
+	WORD   $0x8948; BYTE $0xdf     // movq	%rbx, %rdi
+	LONG   $0xcbaf0f48             // imulq	%rbx, %rcx
+	LONG   $0xff538d48             // leaq	-1(%rbx), %rdx
+	WORD   $0x894d; BYTE $0xfe     // movq	%r15, %r14
+	WORD   $0xf748; BYTE $0xd7     // notq	%rdi
+	LONG   $0xf2af0f4c             // imulq	%rdx, %r14
+	QUAD   $0x00000000bd2c8d4c     // leaq	0(,%rdi,4), %r13
+	WORD   $0x894d; BYTE $0xcb     // movq	%r9, %r11
+	VMOVSS CPI0_0<>(SB), X4        // vmovss	.LCPI0_0(%rip), %xmm4
+	LONG   $0xdfaf0f4d             // imulq	%r15, %r11
+	LONG   $0x246c894c; BYTE $0x10 // movq	%r13, 16(%rsp)
+	VMOVSS CPI0_1<>(SB), X3        // vmovss	.LCPI0_1(%rip), %xmm3
+	LONG   $0x88048d4c             // leaq	(%rax,%rcx,4), %r8
+	LONG   $0x014b8d48             // leaq	1(%rbx), %rcx
+	LONG   $0xcbaf0f48             // imulq	%rbx, %rcx
+	LONG   $0x885c8d48; BYTE $0xfc // leaq	-4(%rax,%rcx,4), %rbx
+	WORD   $0x894c; BYTE $0xf8     // movq	%r15, %rax
+	WORD   $0xf748; BYTE $0xd8     // negq	%rax
+	LONG   $0x02e0c148             // salq	$2, %rax
+	LONG   $0xd0af0f48             // imulq	%rax, %rdx
+	LONG   $0x24448948; BYTE $0x18 // movq	%rax, 24(%rsp)
+	WORD   $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	WORD   $0x2948; BYTE $0xd0     // subq	%rdx, %rax
+	LONG   $0x24448948; BYTE $0x60 // movq	%rax, 96(%rsp)
+	QUAD   $0x000000008d048d4a     // leaq	0(,%r9,4), %rax
+	LONG   $0x24448948; BYTE $0x58 // movq	%rax, 88(%rsp)
+	LONG   $0xf8478d49             // leaq	-8(%r15), %rax
+	WORD   $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+	LONG   $0xf8e08348             // andq	$-8, %rax
+	LONG   $0x03eac148             // shrq	$3, %rdx
+	LONG   $0x24448948; BYTE $0x48 // movq	%rax, 72(%rsp)
+	LONG   $0x20468d48             // leaq	32(%rsi), %rax
+	QUAD   $0x00000008d53c8d48     // leaq	8(,%rdx,8), %rdi
+	LONG   $0x24448948; BYTE $0x40 // movq	%rax, 64(%rsp)
+	LONG   $0x247c8948; BYTE $0x50 // movq	%rdi, 80(%rsp)
+
+BB0_22:
+	WORD $0x894c; BYTE $0xc8     // movq	%r9, %rax
+	LONG $0x01e98349             // subq	$1, %r9
+	WORD $0x8949; BYTE $0xc4     // movq	%rax, %r12
+	LONG $0x24443948; BYTE $0x68 // cmpq	%rax, 104(%rsp)
+	JLE  BB0_11
+	LONG $0x24448b48; BYTE $0x48 // movq	72(%rsp), %rax
+	LONG $0x244c894c; BYTE $0x38 // movq	%r9, 56(%rsp)
+	WORD $0x894c; BYTE $0xda     // movq	%r11, %rdx
+	WORD $0x894d; BYTE $0xe5     // movq	%r12, %r13
+	LONG $0x247c8b48; BYTE $0x40 // movq	64(%rsp), %rdi
+	LONG $0x2444894c; BYTE $0x30 // movq	%r8, 48(%rsp)
+	WORD $0x294c; BYTE $0xf2     // subq	%r14, %rdx
+	WORD $0x8949; BYTE $0xdc     // movq	%rbx, %r12
+	WORD $0x014c; BYTE $0xf0     // addq	%r14, %rax
+	LONG $0x245c8948; BYTE $0x28 // movq	%rbx, 40(%rsp)
+	LONG $0x870c8d48             // leaq	(%rdi,%rax,4), %rcx
+	LONG $0x245c894c; BYTE $0x20 // movq	%r11, 32(%rsp)
+	WORD $0x894c; BYTE $0xdf     // movq	%r11, %rdi
+	LONG $0x244c8948; BYTE $0x78 // movq	%rcx, 120(%rsp)
+
+BB0_10:
+	LONG $0x107ac1c4; WORD $0x2414 // vmovss	(%r12), %xmm2
+	LONG $0xcb57e8c5               // vxorps	%xmm3, %xmm2, %xmm1
+	LONG $0x187de2c4; BYTE $0xc9   // vbroadcastss	%xmm1, %ymm1
+	LONG $0x07ff8349               // cmpq	$7, %r15
+	JLE  BB0_31
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+	LONG $0x244c8b48; BYTE $0x78   // movq	120(%rsp), %rcx
+
+BB0_8:
+	LONG $0x0410fcc5; BYTE $0x90 // vmovups	(%rax,%rdx,4), %ymm0
+	LONG $0xa875e2c4; BYTE $0x00 // vfmadd213ps	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fcc5; BYTE $0xe0 // vmovups	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JNE  BB0_8
+	LONG $0x244c8948; BYTE $0x78 // movq	%rcx, 120(%rsp)
+	LONG $0x24448b48; BYTE $0x50 // movq	80(%rsp), %rax
+
+BB0_7:
+	WORD $0x3949; BYTE $0xc7     // cmpq	%rax, %r15
+	JLE  BB0_16
+	WORD $0x894d; BYTE $0xf8     // movq	%r15, %r8
+	LONG $0x300c8d4e             // leaq	(%rax,%r14), %r9
+	LONG $0x38148d4c             // leaq	(%rax,%rdi), %r10
+	WORD $0x2949; BYTE $0xc0     // subq	%rax, %r8
+	LONG $0xff588d4d             // leaq	-1(%r8), %r11
+	LONG $0x02fb8349             // cmpq	$2, %r11
+	JBE  BB0_12
+	QUAD $0x000000008d1c8d4a     // leaq	0(,%r9,4), %rbx
+	LONG $0x38148d4c             // leaq	(%rax,%rdi), %r10
+	WORD $0x8948; BYTE $0xd9     // movq	%rbx, %rcx
+	QUAD $0x00000004951c8d4a     // leaq	4(,%r10,4), %rbx
+	LONG $0x244c8948; BYTE $0x70 // movq	%rcx, 112(%rsp)
+	WORD $0x2948; BYTE $0xd9     // subq	%rbx, %rcx
+	LONG $0x18f98348             // cmpq	$24, %rcx
+	JA   BB0_57
+
+BB0_12:
+	LONG $0x8e048d4e               // leaq	(%rsi,%r9,4), %r8
+	LONG $0x107aa1c4; WORD $0x9604 // vmovss	(%rsi,%r10,4), %xmm0
+	LONG $0xad69c2c4; BYTE $0x00   // vfnmadd213ss	(%r8), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x00   // vmovss	%xmm0, (%r8)
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	WORD $0x394d; BYTE $0xf8       // cmpq	%r15, %r8
+	JGE  BB0_16
+	LONG $0x060c8d4f               // leaq	(%r14,%r8), %r9
+	WORD $0x0149; BYTE $0xf8       // addq	%rdi, %r8
+	LONG $0x8e0c8d4e               // leaq	(%rsi,%r9,4), %r9
+	LONG $0x107aa1c4; WORD $0x8604 // vmovss	(%rsi,%r8,4), %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0xad69c2c4; BYTE $0x01   // vfnmadd213ss	(%r9), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x01   // vmovss	%xmm0, (%r9)
+	WORD $0x394d; BYTE $0xc7       // cmpq	%r8, %r15
+	JLE  BB0_16
+	LONG $0x060c8d4f               // leaq	(%r14,%r8), %r9
+	WORD $0x0149; BYTE $0xf8       // addq	%rdi, %r8
+	LONG $0x8e0c8d4e               // leaq	(%rsi,%r9,4), %r9
+	LONG $0x107aa1c4; WORD $0x8604 // vmovss	(%rsi,%r8,4), %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0xad69c2c4; BYTE $0x01   // vfnmadd213ss	(%r9), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x01   // vmovss	%xmm0, (%r9)
+	WORD $0x394d; BYTE $0xc7       // cmpq	%r8, %r15
+	JLE  BB0_16
+	LONG $0x060c8d4f               // leaq	(%r14,%r8), %r9
+	WORD $0x0149; BYTE $0xf8       // addq	%rdi, %r8
+	LONG $0x8e0c8d4e               // leaq	(%rsi,%r9,4), %r9
+	LONG $0x107aa1c4; WORD $0x8604 // vmovss	(%rsi,%r8,4), %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0xad69c2c4; BYTE $0x01   // vfnmadd213ss	(%r9), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x01   // vmovss	%xmm0, (%r9)
+	WORD $0x394d; BYTE $0xc7       // cmpq	%r8, %r15
+	JLE  BB0_16
+	LONG $0x060c8d4f               // leaq	(%r14,%r8), %r9
+	WORD $0x0149; BYTE $0xf8       // addq	%rdi, %r8
+	LONG $0x8e0c8d4e               // leaq	(%rsi,%r9,4), %r9
+	LONG $0x107aa1c4; WORD $0x8604 // vmovss	(%rsi,%r8,4), %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0xad69c2c4; BYTE $0x01   // vfnmadd213ss	(%r9), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x01   // vmovss	%xmm0, (%r9)
+	WORD $0x394d; BYTE $0xc7       // cmpq	%r8, %r15
+	JLE  BB0_16
+	LONG $0x060c8d4f               // leaq	(%r14,%r8), %r9
+	WORD $0x0149; BYTE $0xf8       // addq	%rdi, %r8
+	LONG $0x8e0c8d4e               // leaq	(%rsi,%r9,4), %r9
+	LONG $0x107aa1c4; WORD $0x8604 // vmovss	(%rsi,%r8,4), %xmm0
+	LONG $0x06408d4c               // leaq	6(%rax), %r8
+	LONG $0xad69c2c4; BYTE $0x01   // vfnmadd213ss	(%r9), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x01   // vmovss	%xmm0, (%r9)
+	WORD $0x394d; BYTE $0xc7       // cmpq	%r8, %r15
+	JLE  BB0_16
+	LONG $0x060c8d4f               // leaq	(%r14,%r8), %r9
+	WORD $0x0149; BYTE $0xf8       // addq	%rdi, %r8
+	LONG $0x07c08348               // addq	$7, %rax
+	LONG $0x8e0c8d4e               // leaq	(%rsi,%r9,4), %r9
+	LONG $0x107aa1c4; WORD $0x8604 // vmovss	(%rsi,%r8,4), %xmm0
+	LONG $0xad69c2c4; BYTE $0x01   // vfnmadd213ss	(%r9), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x01   // vmovss	%xmm0, (%r9)
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_16
+
+BB0_55:
+	LONG $0x06048d4d               // leaq	(%r14,%rax), %r8
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+	LONG $0x86048d4e               // leaq	(%rsi,%r8,4), %r8
+	LONG $0x107ac1c4; BYTE $0x38   // vmovss	(%r8), %xmm7
+	LONG $0x9d41e2c4; WORD $0x8614 // vfnmadd132ss	(%rsi,%rax,4), %xmm7, %xmm2
+	LONG $0x117ac1c4; BYTE $0x10   // vmovss	%xmm2, (%r8)
+
+BB0_16:
+	LONG $0x24448b48; BYTE $0x58 // movq	88(%rsp), %rax
+	LONG $0x01c58349             // addq	$1, %r13
+	WORD $0x014c; BYTE $0xff     // addq	%r15, %rdi
+	WORD $0x014c; BYTE $0xfa     // addq	%r15, %rdx
+	WORD $0x0149; BYTE $0xc4     // addq	%rax, %r12
+	LONG $0x246c394c; BYTE $0x68 // cmpq	%r13, 104(%rsp)
+	JNE  BB0_10
+	LONG $0x244c8b4c; BYTE $0x38 // movq	56(%rsp), %r9
+	LONG $0x24448b4c; BYTE $0x30 // movq	48(%rsp), %r8
+	LONG $0x245c8b48; BYTE $0x28 // movq	40(%rsp), %rbx
+	LONG $0x245c8b4c; BYTE $0x20 // movq	32(%rsp), %r11
+
+BB0_11:
+	LONG $0x5e5ac1c4; WORD $0xfc50 // vdivss	-4(%r8), %xmm4, %xmm2
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x187de2c4; BYTE $0xca   // vbroadcastss	%xmm2, %ymm1
+	LONG $0x07ff8349               // cmpq	$7, %r15
+	JLE  BB0_6
+	LONG $0x24448b48; BYTE $0x48   // movq	72(%rsp), %rax
+	LONG $0x247c8b48; BYTE $0x40   // movq	64(%rsp), %rdi
+	WORD $0x014c; BYTE $0xf0       // addq	%r14, %rax
+	LONG $0x87148d48               // leaq	(%rdi,%rax,4), %rdx
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+
+BB0_20:
+	LONG $0x0059f4c5               // vmulps	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0x4011fcc5; BYTE $0xe0   // vmovups	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JNE  BB0_20
+	LONG $0x24548b48; BYTE $0x50   // movq	80(%rsp), %rdx
+	LONG $0x5e5ac1c4; WORD $0xfc50 // vdivss	-4(%r8), %xmm4, %xmm2
+
+BB0_6:
+	WORD $0x3949; BYTE $0xd7     // cmpq	%rdx, %r15
+	JLE  BB0_27
+	WORD $0x894c; BYTE $0xf9     // movq	%r15, %rcx
+	WORD $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	WORD $0x2948; BYTE $0xd1     // subq	%rdx, %rcx
+	LONG $0xff418d48             // leaq	-1(%rcx), %rax
+	LONG $0x06f88348             // cmpq	$6, %rax
+	JBE  BB0_33
+	WORD $0x8949; BYTE $0xca     // movq	%rcx, %r10
+	LONG $0x16048d49             // leaq	(%r14,%rdx), %rax
+	LONG $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG $0x03eac149             // shrq	$3, %r10
+	LONG $0x86048d48             // leaq	(%rsi,%rax,4), %rax
+	LONG $0x05e2c149             // salq	$5, %r10
+	WORD $0x0149; BYTE $0xc2     // addq	%rax, %r10
+
+BB0_25:
+	LONG $0x0059f4c5             // vmulps	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fcc5; BYTE $0xe0 // vmovups	%ymm0, -32(%rax)
+	WORD $0x3949; BYTE $0xc2     // cmpq	%rax, %r10
+	JNE  BB0_25
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	WORD $0xc1f6; BYTE $0x07     // testb	$7, %cl
+	JE   BB0_27
+
+BB0_24:
+	WORD $0x2948; BYTE $0xc1     // subq	%rax, %rcx
+	LONG $0xff518d4c             // leaq	-1(%rcx), %r10
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_29
+	WORD $0x014c; BYTE $0xf7     // addq	%r14, %rdi
+	LONG $0xc2c6e8c5; BYTE $0x00 // vshufps	$0, %xmm2, %xmm2, %xmm0
+	WORD $0x0148; BYTE $0xc7     // addq	%rax, %rdi
+	LONG $0xbe048d48             // leaq	(%rsi,%rdi,4), %rax
+	LONG $0x0059f8c5             // vmulps	(%rax), %xmm0, %xmm0
+	LONG $0x0011f8c5             // vmovups	%xmm0, (%rax)
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	WORD $0xe183; BYTE $0x03     // andl	$3, %ecx
+	JE   BB0_27
+
+BB0_29:
+	LONG $0x16048d49         // leaq	(%r14,%rdx), %rax
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059eac5         // vmulss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x01428d48         // leaq	1(%rdx), %rax
+	WORD $0x3949; BYTE $0xc7 // cmpq	%rax, %r15
+	JLE  BB0_27
+	WORD $0x014c; BYTE $0xf0 // addq	%r14, %rax
+	LONG $0x02c28348         // addq	$2, %rdx
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059eac5         // vmulss	(%rax), %xmm2, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	WORD $0x394c; BYTE $0xfa // cmpq	%r15, %rdx
+	JGE  BB0_27
+	WORD $0x014c; BYTE $0xf2 // addq	%r14, %rdx
+	LONG $0x96048d48         // leaq	(%rsi,%rdx,4), %rax
+	LONG $0x1059eac5         // vmulss	(%rax), %xmm2, %xmm2
+	LONG $0x1011fac5         // vmovss	%xmm2, (%rax)
+
+BB0_27:
+	LONG $0x24448b48; BYTE $0x10 // movq	16(%rsp), %rax
+	LONG $0x247c8b48; BYTE $0x18 // movq	24(%rsp), %rdi
+	WORD $0x294d; BYTE $0xfe     // subq	%r15, %r14
+	WORD $0x294d; BYTE $0xfb     // subq	%r15, %r11
+	LONG $0x247c0148; BYTE $0x60 // addq	%rdi, 96(%rsp)
+	WORD $0x0149; BYTE $0xc0     // addq	%rax, %r8
+	WORD $0x0148; BYTE $0xc3     // addq	%rax, %rbx
+	WORD $0x854d; BYTE $0xc9     // testq	%r9, %r9
+	JNE  BB0_22
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+
+BB0_53:
+	LONG $0xf0658d48 // leaq	-16(%rbp), %rsp
+	RET
+
+BB0_57:
+	LONG $0x06fb8349                           // cmpq	$6, %r11
+	JBE  BB0_32
+	LONG $0x245c8b4c; BYTE $0x70               // movq	112(%rsp), %r11
+	LONG $0x187de2c4; BYTE $0xc2               // vbroadcastss	%xmm2, %ymm0
+	WORD $0x0149; BYTE $0xf3                   // addq	%rsi, %r11
+	LONG $0x107cc1c4; BYTE $0x33               // vmovups	(%r11), %ymm6
+	LONG $0x9c4de2c4; WORD $0x1e44; BYTE $0xfc // vfnmadd132ps	-4(%rsi,%rbx), %ymm6, %ymm0
+	LONG $0x117cc1c4; BYTE $0x03               // vmovups	%ymm0, (%r11)
+	WORD $0x894d; BYTE $0xc3                   // movq	%r8, %r11
+	LONG $0xf8e38349                           // andq	$-8, %r11
+	WORD $0x014c; BYTE $0xd8                   // addq	%r11, %rax
+	LONG $0x07c0f641                           // testb	$7, %r8b
+	JE   BB0_16
+	WORD $0x294d; BYTE $0xd8                   // subq	%r11, %r8
+	LONG $0xff588d49                           // leaq	-1(%r8), %rbx
+	LONG $0x02fb8348                           // cmpq	$2, %rbx
+	JBE  BB0_17
+
+BB0_13:
+	WORD $0x014d; BYTE $0xd9       // addq	%r11, %r9
+	WORD $0x014d; BYTE $0xd3       // addq	%r10, %r11
+	LONG $0xc2c6e8c5; BYTE $0x00   // vshufps	$0, %xmm2, %xmm2, %xmm0
+	LONG $0x8e0c8d4e               // leaq	(%rsi,%r9,4), %r9
+	LONG $0x1078c1c4; BYTE $0x29   // vmovups	(%r9), %xmm5
+	LONG $0x9c51a2c4; WORD $0x9e04 // vfnmadd132ps	(%rsi,%r11,4), %xmm5, %xmm0
+	LONG $0x1178c1c4; BYTE $0x01   // vmovups	%xmm0, (%r9)
+	WORD $0x894d; BYTE $0xc1       // movq	%r8, %r9
+	LONG $0xfce18349               // andq	$-4, %r9
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x03e08341               // andl	$3, %r8d
+	JE   BB0_16
+
+BB0_17:
+	LONG $0x06048d4d               // leaq	(%r14,%rax), %r8
+	LONG $0x070c8d4c               // leaq	(%rdi,%rax), %r9
+	LONG $0x86048d4e               // leaq	(%rsi,%r8,4), %r8
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0xad69c2c4; BYTE $0x00   // vfnmadd213ss	(%r8), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x00   // vmovss	%xmm0, (%r8)
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	WORD $0x394d; BYTE $0xc7       // cmpq	%r8, %r15
+	JLE  BB0_16
+	LONG $0x060c8d4f               // leaq	(%r14,%r8), %r9
+	WORD $0x0149; BYTE $0xf8       // addq	%rdi, %r8
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x8e0c8d4e               // leaq	(%rsi,%r9,4), %r9
+	LONG $0x107aa1c4; WORD $0x8604 // vmovss	(%rsi,%r8,4), %xmm0
+	LONG $0xad69c2c4; BYTE $0x01   // vfnmadd213ss	(%r9), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x01   // vmovss	%xmm0, (%r9)
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JG   BB0_55
+	JMP  BB0_16
+
+BB0_31:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_7
+
+BB0_32:
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	JMP  BB0_13
+
+BB0_33:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_24
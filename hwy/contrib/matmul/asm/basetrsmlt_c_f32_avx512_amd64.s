@@ -0,0 +1,518 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basetrsmlt_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_1<>+0(SB)/4, $0x80000000
+DATA CPI0_1<>+4(SB)/4, $0x00000000
+DATA CPI0_1<>+8(SB)/4, $0x00000000
+DATA CPI0_1<>+12(SB)/4, $0x00000000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $16
+
+TEXT ·trsmlt_c_f32_avx512(SB), $64-48
+	MOVQ   l+0(FP), DI
+	MOVQ   b+8(FP), SI
+	MOVQ   pn+16(FP), DX
+	MOVQ   pnrhs+24(FP), CX
+	MOVQ   plen_l+32(FP), R8
+	MOVQ   plen_b+40(FP), R9
+	LONG   $0x246c8d48; BYTE $0x30 // leaq	48(%rsp), %rbp
+	LONG   $0x24648d48; BYTE $0x40 // leaq	64(%rsp), %rsp
+	LONG   $0xc0e48348             // andq	$-64, %rsp
+	LONG   $0x80c48348             // addq	$-128, %rsp
+	WORD   $0x8b48; BYTE $0x1a     // movq	(%rdx), %rbx
+	WORD   $0x8b48; BYTE $0x11     // movq	(%rcx), %rdx
+	LONG   $0x245c8948; BYTE $0x68 // movq	%rbx, 104(%rsp)
+	WORD   $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE     BB0_53
+	WORD   $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE    BB0_53
+	WORD   $0x8948; BYTE $0xd9     // movq	%rbx, %rcx
+	LONG   $0xff438d48             // leaq	-1(%rbx), %rax
+	WORD   $0x8949; BYTE $0xda     // movq	%rbx, %r10
+	VMOVSS CPI0_0<>(SB), X5        // vmovss	.LCPI0_0(%rip), %xmm5
+	VMOVSS CPI0_1<>(SB), X3        // vmovss	.LCPI0_1(%rip), %xmm3
+	WORD   $0xf748; BYTE $0xd1     // notq	%rcx
+	WORD   $0x8949; BYTE $0xc7     // movq	%rax, %r15
+	LONG   $0xfaaf0f4c             // imulq	%rdx, %r15
+	QUAD   $0x000000008d348d4c     // leaq	0(,%rcx,4), %r14
+	WORD   $0x8948; BYTE $0xd9     // movq	%rbx, %rcx
+	LONG   $0xcbaf0f48             // imulq	%rbx, %rcx
+	LONG   $0x2474894c; BYTE $0x20 // movq	%r14, 32(%rsp)
+	LONG   $0x8f0c8d4c             // leaq	(%rdi,%rcx,4), %r9
+	LONG   $0x014b8d48             // leaq	1(%rbx), %rcx
+	LONG   $0xcbaf0f48             // imulq	%rbx, %rcx
+	LONG   $0xdaaf0f48             // imulq	%rdx, %rbx
+	LONG   $0x8f648d4c; BYTE $0xfc // leaq	-4(%rdi,%rcx,4), %r12
+	WORD   $0x8948; BYTE $0xd1     // movq	%rdx, %rcx
+	WORD   $0xf748; BYTE $0xd9     // negq	%rcx
+	LONG   $0x02e1c148             // salq	$2, %rcx
+	LONG   $0xc1af0f48             // imulq	%rcx, %rax
+	LONG   $0x244c8948; BYTE $0x28 // movq	%rcx, 40(%rsp)
+	WORD   $0x8948; BYTE $0xf1     // movq	%rsi, %rcx
+	WORD   $0x2948; BYTE $0xc1     // subq	%rax, %rcx
+	QUAD   $0x0000000095048d4a     // leaq	0(,%r10,4), %rax
+	LONG   $0x6ef9e1c4; BYTE $0xf0 // vmovq	%rax, %xmm6
+	LONG   $0xf0428d48             // leaq	-16(%rdx), %rax
+	LONG   $0x244c8948; BYTE $0x60 // movq	%rcx, 96(%rsp)
+	WORD   $0x8948; BYTE $0xc1     // movq	%rax, %rcx
+	LONG   $0xf0e18348             // andq	$-16, %rcx
+	LONG   $0x10798d48             // leaq	16(%rcx), %rdi
+	WORD   $0x8949; BYTE $0xce     // movq	%rcx, %r14
+	LONG   $0x247c8948; BYTE $0x58 // movq	%rdi, 88(%rsp)
+	LONG   $0x407e8d48             // leaq	64(%rsi), %rdi
+	LONG   $0x6ef9e1c4; BYTE $0xe7 // vmovq	%rdi, %xmm4
+
+BB0_22:
+	WORD $0x894d; BYTE $0xd3     // movq	%r10, %r11
+	LONG $0x01ea8349             // subq	$1, %r10
+	LONG $0x245c394c; BYTE $0x68 // cmpq	%r11, 104(%rsp)
+	JLE  BB0_11
+	LONG $0x3e048d4b             // leaq	(%r14,%r15), %rax
+	LONG $0x7ef9e1c4; BYTE $0xe7 // vmovq	%xmm4, %rdi
+	LONG $0x244c894c; BYTE $0x50 // movq	%r9, 80(%rsp)
+	WORD $0x8948; BYTE $0xd9     // movq	%rbx, %rcx
+	LONG $0x87048d4c             // leaq	(%rdi,%rax,4), %r8
+	LONG $0x2464894c; BYTE $0x48 // movq	%r12, 72(%rsp)
+	WORD $0x294c; BYTE $0xf9     // subq	%r15, %rcx
+	WORD $0x8948; BYTE $0xdf     // movq	%rbx, %rdi
+	LONG $0x2454894c; BYTE $0x40 // movq	%r10, 64(%rsp)
+	LONG $0x2444894c; BYTE $0x78 // movq	%r8, 120(%rsp)
+	LONG $0x245c8948; BYTE $0x38 // movq	%rbx, 56(%rsp)
+	LONG $0x2474894c; BYTE $0x30 // movq	%r14, 48(%rsp)
+	WORD $0x894d; BYTE $0xe6     // movq	%r12, %r14
+
+BB0_10:
+	LONG $0x107ac1c4; BYTE $0x16   // vmovss	(%r14), %xmm2
+	LONG $0xcb57e8c5               // vxorps	%xmm3, %xmm2, %xmm1
+	LONG $0x487df262; WORD $0xc918 // vbroadcastss	%xmm1, %zmm1
+	LONG $0x0ffa8348               // cmpq	$15, %rdx
+	JLE  BB0_31
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+	LONG $0x24448b4c; BYTE $0x78   // movq	120(%rsp), %r8
+
+BB0_8:
+	LONG $0x487cf162; WORD $0x0410; BYTE $0x88 // vmovups	(%rax,%rcx,4), %zmm0
+	LONG $0x4875f262; WORD $0x00a8             // vfmadd213ps	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x3949; BYTE $0xc0                   // cmpq	%rax, %r8
+	JNE  BB0_8
+	LONG $0x2444894c; BYTE $0x78               // movq	%r8, 120(%rsp)
+	LONG $0x24448b48; BYTE $0x58               // movq	88(%rsp), %rax
+
+BB0_7:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_16
+	WORD $0x8949; BYTE $0xd1     // movq	%rdx, %r9
+	LONG $0x38148d4e             // leaq	(%rax,%r15), %r10
+	LONG $0x381c8d48             // leaq	(%rax,%rdi), %rbx
+	WORD $0x2949; BYTE $0xc1     // subq	%rax, %r9
+	LONG $0xff618d4d             // leaq	-1(%r9), %r12
+	LONG $0x06fc8349             // cmpq	$6, %r12
+	JBE  BB0_12
+	QUAD $0x00000000951c8d4a     // leaq	0(,%r10,4), %rbx
+	WORD $0x8949; BYTE $0xd8     // movq	%rbx, %r8
+	LONG $0x381c8d48             // leaq	(%rax,%rdi), %rbx
+	QUAD $0x000000049d2c8d4c     // leaq	4(,%rbx,4), %r13
+	LONG $0x2444894c; BYTE $0x70 // movq	%r8, 112(%rsp)
+	WORD $0x294d; BYTE $0xe8     // subq	%r13, %r8
+	LONG $0x38f88349             // cmpq	$56, %r8
+	JA   BB0_57
+
+BB0_12:
+	LONG $0x960c8d4e               // leaq	(%rsi,%r10,4), %r9
+	LONG $0x0410fac5; BYTE $0x9e   // vmovss	(%rsi,%rbx,4), %xmm0
+	LONG $0xad69c2c4; BYTE $0x01   // vfnmadd213ss	(%r9), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x01   // vmovss	%xmm0, (%r9)
+	LONG $0x01488d4c               // leaq	1(%rax), %r9
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x02488d4c               // leaq	2(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x03488d4c               // leaq	3(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x04488d4c               // leaq	4(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x05488d4c               // leaq	5(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x06488d4c               // leaq	6(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x07488d4c               // leaq	7(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x08488d4c               // leaq	8(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x09488d4c               // leaq	9(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x0a488d4c               // leaq	10(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x0b488d4c               // leaq	11(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x0c488d4c               // leaq	12(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x0d488d4c               // leaq	13(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x0e488d4c               // leaq	14(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x0fc08348               // addq	$15, %rax
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_16
+
+BB0_55:
+	LONG $0x070c8d4d               // leaq	(%r15,%rax), %r9
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+	LONG $0x8e0c8d4e               // leaq	(%rsi,%r9,4), %r9
+	LONG $0x107ac1c4; BYTE $0x39   // vmovss	(%r9), %xmm7
+	LONG $0x9d41e2c4; WORD $0x8614 // vfnmadd132ss	(%rsi,%rax,4), %xmm7, %xmm2
+	LONG $0x117ac1c4; BYTE $0x11   // vmovss	%xmm2, (%r9)
+
+BB0_16:
+	LONG $0x7ef9e1c4; BYTE $0xf0 // vmovq	%xmm6, %rax
+	LONG $0x01c38349             // addq	$1, %r11
+	WORD $0x0148; BYTE $0xd7     // addq	%rdx, %rdi
+	WORD $0x0148; BYTE $0xd1     // addq	%rdx, %rcx
+	WORD $0x0149; BYTE $0xc6     // addq	%rax, %r14
+	LONG $0x245c394c; BYTE $0x68 // cmpq	%r11, 104(%rsp)
+	JNE  BB0_10
+	LONG $0x244c8b4c; BYTE $0x50 // movq	80(%rsp), %r9
+	LONG $0x24648b4c; BYTE $0x48 // movq	72(%rsp), %r12
+	LONG $0x24548b4c; BYTE $0x40 // movq	64(%rsp), %r10
+	LONG $0x245c8b48; BYTE $0x38 // movq	56(%rsp), %rbx
+	LONG $0x24748b4c; BYTE $0x30 // movq	48(%rsp), %r14
+
+BB0_11:
+	LONG $0x5e52c1c4; WORD $0xfc49 // vdivss	-4(%r9), %xmm5, %xmm1
+	WORD $0xc931                   // xorl	%ecx, %ecx
+	LONG $0x487df262; WORD $0xd118 // vbroadcastss	%xmm1, %zmm2
+	LONG $0x0ffa8348               // cmpq	$15, %rdx
+	JLE  BB0_6
+	LONG $0x3e048d4b               // leaq	(%r14,%r15), %rax
+	LONG $0x7ef9e1c4; BYTE $0xe7   // vmovq	%xmm4, %rdi
+	LONG $0x870c8d48               // leaq	(%rdi,%rax,4), %rcx
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+
+BB0_20:
+	LONG $0x486cf162; WORD $0x0059             // vmulps	(%rax), %zmm2, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JNE  BB0_20
+	LONG $0x244c8b48; BYTE $0x58               // movq	88(%rsp), %rcx
+	LONG $0x5e52c1c4; WORD $0xfc49             // vdivss	-4(%r9), %xmm5, %xmm1
+
+BB0_6:
+	WORD $0x3948; BYTE $0xca       // cmpq	%rcx, %rdx
+	JLE  BB0_27
+	WORD $0x8948; BYTE $0xd7       // movq	%rdx, %rdi
+	WORD $0x8949; BYTE $0xc8       // movq	%rcx, %r8
+	WORD $0x2948; BYTE $0xcf       // subq	%rcx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	LONG $0x0ef88348               // cmpq	$14, %rax
+	JBE  BB0_33
+	WORD $0x8949; BYTE $0xfb       // movq	%rdi, %r11
+	LONG $0x0f048d49               // leaq	(%r15,%rcx), %rax
+	LONG $0x487df262; WORD $0xd118 // vbroadcastss	%xmm1, %zmm2
+	LONG $0x04ebc149               // shrq	$4, %r11
+	LONG $0x86048d48               // leaq	(%rsi,%rax,4), %rax
+	LONG $0x06e3c149               // salq	$6, %r11
+	WORD $0x0149; BYTE $0xc3       // addq	%rax, %r11
+
+BB0_25:
+	LONG $0x486cf162; WORD $0x0059             // vmulps	(%rax), %zmm2, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x3949; BYTE $0xc3                   // cmpq	%rax, %r11
+	JNE  BB0_25
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x0fc7f640                           // testb	$15, %dil
+	JE   BB0_27
+
+BB0_24:
+	WORD $0x2948; BYTE $0xc7     // subq	%rax, %rdi
+	LONG $0xff5f8d4c             // leaq	-1(%rdi), %r11
+	LONG $0x06fb8349             // cmpq	$6, %r11
+	JBE  BB0_29
+	WORD $0x014d; BYTE $0xf8     // addq	%r15, %r8
+	LONG $0x187de2c4; BYTE $0xc1 // vbroadcastss	%xmm1, %ymm0
+	WORD $0x0149; BYTE $0xc0     // addq	%rax, %r8
+	LONG $0x86048d4a             // leaq	(%rsi,%r8,4), %rax
+	LONG $0x0059fcc5             // vmulps	(%rax), %ymm0, %ymm0
+	LONG $0x0011fcc5             // vmovups	%ymm0, (%rax)
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc1     // addq	%rax, %rcx
+	WORD $0xe783; BYTE $0x07     // andl	$7, %edi
+	JE   BB0_27
+
+BB0_29:
+	LONG $0x0f048d49         // leaq	(%r15,%rcx), %rax
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059f2c5         // vmulss	(%rax), %xmm1, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x01418d48         // leaq	1(%rcx), %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JLE  BB0_27
+	WORD $0x014c; BYTE $0xf8 // addq	%r15, %rax
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059f2c5         // vmulss	(%rax), %xmm1, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x02418d48         // leaq	2(%rcx), %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JGE  BB0_27
+	WORD $0x014c; BYTE $0xf8 // addq	%r15, %rax
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059f2c5         // vmulss	(%rax), %xmm1, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x03418d48         // leaq	3(%rcx), %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JGE  BB0_27
+	WORD $0x014c; BYTE $0xf8 // addq	%r15, %rax
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059f2c5         // vmulss	(%rax), %xmm1, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x04418d48         // leaq	4(%rcx), %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JGE  BB0_27
+	WORD $0x014c; BYTE $0xf8 // addq	%r15, %rax
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059f2c5         // vmulss	(%rax), %xmm1, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	LONG $0x05418d48         // leaq	5(%rcx), %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JGE  BB0_27
+	WORD $0x014c; BYTE $0xf8 // addq	%r15, %rax
+	LONG $0x06c18348         // addq	$6, %rcx
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x0059f2c5         // vmulss	(%rax), %xmm1, %xmm0
+	LONG $0x0011fac5         // vmovss	%xmm0, (%rax)
+	WORD $0x3948; BYTE $0xca // cmpq	%rcx, %rdx
+	JLE  BB0_27
+	WORD $0x014c; BYTE $0xf9 // addq	%r15, %rcx
+	LONG $0x8e048d48         // leaq	(%rsi,%rcx,4), %rax
+	LONG $0x0859f2c5         // vmulss	(%rax), %xmm1, %xmm1
+	LONG $0x0811fac5         // vmovss	%xmm1, (%rax)
+
+BB0_27:
+	LONG $0x24448b48; BYTE $0x20 // movq	32(%rsp), %rax
+	LONG $0x247c8b48; BYTE $0x28 // movq	40(%rsp), %rdi
+	WORD $0x2949; BYTE $0xd7     // subq	%rdx, %r15
+	WORD $0x2948; BYTE $0xd3     // subq	%rdx, %rbx
+	LONG $0x247c0148; BYTE $0x60 // addq	%rdi, 96(%rsp)
+	WORD $0x0149; BYTE $0xc1     // addq	%rax, %r9
+	WORD $0x0149; BYTE $0xc4     // addq	%rax, %r12
+	WORD $0x854d; BYTE $0xd2     // testq	%r10, %r10
+	JNE  BB0_22
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+
+BB0_53:
+	LONG $0xd0658d48 // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_57:
+	LONG $0x0efc8349                                   // cmpq	$14, %r12
+	JBE  BB0_32
+	LONG $0x24648b4c; BYTE $0x70                       // movq	112(%rsp), %r12
+	QUAD $0xfc2e8410487cb162; WORD $0xffff; BYTE $0xff // vmovups	-4(%rsi,%r13), %zmm0
+	LONG $0x487df262; WORD $0xca18                     // vbroadcastss	%xmm2, %zmm1
+	WORD $0x0149; BYTE $0xf4                           // addq	%rsi, %r12
+	LONG $0x4875d262; WORD $0x04ac; BYTE $0x24         // vfnmadd213ps	(%r12), %zmm1, %zmm0
+	LONG $0x487cd162; WORD $0x0411; BYTE $0x24         // vmovups	%zmm0, (%r12)
+	WORD $0x894d; BYTE $0xcc                           // movq	%r9, %r12
+	LONG $0xf0e48349                                   // andq	$-16, %r12
+	WORD $0x014c; BYTE $0xe0                           // addq	%r12, %rax
+	LONG $0x0fc1f641                                   // testb	$15, %r9b
+	JE   BB0_16
+	WORD $0x294d; BYTE $0xe1                           // subq	%r12, %r9
+	LONG $0xff698d4d                                   // leaq	-1(%r9), %r13
+	LONG $0x06fd8349                                   // cmpq	$6, %r13
+	JBE  BB0_17
+
+BB0_13:
+	WORD $0x014d; BYTE $0xe2       // addq	%r12, %r10
+	WORD $0x0149; BYTE $0xdc       // addq	%rbx, %r12
+	LONG $0x187de2c4; BYTE $0xc2   // vbroadcastss	%xmm2, %ymm0
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107cc1c4; BYTE $0x3a   // vmovups	(%r10), %ymm7
+	LONG $0x9c45a2c4; WORD $0xa604 // vfnmadd132ps	(%rsi,%r12,4), %ymm7, %ymm0
+	LONG $0x117cc1c4; BYTE $0x02   // vmovups	%ymm0, (%r10)
+	WORD $0x894d; BYTE $0xca       // movq	%r9, %r10
+	LONG $0xf8e28349               // andq	$-8, %r10
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+	LONG $0x07e18341               // andl	$7, %r9d
+	JE   BB0_16
+
+BB0_17:
+	LONG $0x070c8d4d               // leaq	(%r15,%rax), %r9
+	LONG $0x07148d4c               // leaq	(%rdi,%rax), %r10
+	LONG $0x8e0c8d4e               // leaq	(%rsi,%r9,4), %r9
+	LONG $0x107aa1c4; WORD $0x9604 // vmovss	(%rsi,%r10,4), %xmm0
+	LONG $0xad69c2c4; BYTE $0x01   // vfnmadd213ss	(%r9), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x01   // vmovss	%xmm0, (%r9)
+	LONG $0x01488d4c               // leaq	1(%rax), %r9
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x02488d4c               // leaq	2(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x03488d4c               // leaq	3(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x04488d4c               // leaq	4(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0x05488d4c               // leaq	5(%rax), %r9
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x06c08348               // addq	$6, %rax
+	LONG $0x96148d4e               // leaq	(%rsi,%r10,4), %r10
+	LONG $0x107aa1c4; WORD $0x8e04 // vmovss	(%rsi,%r9,4), %xmm0
+	LONG $0xad69c2c4; BYTE $0x02   // vfnmadd213ss	(%r10), %xmm2, %xmm0
+	LONG $0x117ac1c4; BYTE $0x02   // vmovss	%xmm0, (%r10)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JG   BB0_55
+	JMP  BB0_16
+
+BB0_31:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_7
+
+BB0_32:
+	WORD $0x3145; BYTE $0xe4 // xorl	%r12d, %r12d
+	JMP  BB0_13
+
+BB0_33:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_24
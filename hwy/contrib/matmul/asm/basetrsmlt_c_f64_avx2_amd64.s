@@ -0,0 +1,321 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basetrsmlt_c_f64_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x00000000
+DATA CPI0_0<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x80000000
+DATA CPI0_1<>+8(SB)/4, $0x00000000
+DATA CPI0_1<>+12(SB)/4, $0x00000000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $16
+
+TEXT ·trsmlt_c_f64_avx2(SB), $32-48
+	MOVQ   l+0(FP), DI
+	MOVQ   b+8(FP), SI
+	MOVQ   pn+16(FP), DX
+	MOVQ   pnrhs+24(FP), CX
+	MOVQ   plen_l+32(FP), R8
+	MOVQ   plen_b+40(FP), R9
+	WORD   $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	WORD   $0x8948; BYTE $0xf7     // movq	%rsi, %rdi
+	LONG   $0x246c8d48; BYTE $0x10 // leaq	16(%rsp), %rbp
+	LONG   $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG   $0xe0e48348             // andq	$-32, %rsp
+	LONG   $0x80c48348             // addq	$-128, %rsp
+	WORD   $0x8b4c; BYTE $0x3a     // movq	(%rdx), %r15
+	WORD   $0x8b48; BYTE $0x31     // movq	(%rcx), %rsi
+	LONG   $0x247c894c; BYTE $0x70 // movq	%r15, 112(%rsp)
+	WORD   $0x8548; BYTE $0xf6     // testq	%rsi, %rsi
+	JE     BB0_60
+	WORD   $0x854d; BYTE $0xff     // testq	%r15, %r15
+	JLE    BB0_60
+	WORD   $0x894c; BYTE $0xf9     // movq	%r15, %rcx
+	LONG   $0xff578d49             // leaq	-1(%r15), %rdx
+	WORD   $0x894d; BYTE $0xfc     // movq	%r15, %r12
+	WORD   $0x894d; BYTE $0xfa     // movq	%r15, %r10
+	WORD   $0xf748; BYTE $0xd1     // notq	%rcx
+	LONG   $0xe6af0f4c             // imulq	%rsi, %r12
+	WORD   $0x8949; BYTE $0xd6     // movq	%rdx, %r14
+	VMOVSD CPI0_0<>(SB), X4        // vmovsd	.LCPI0_0(%rip), %xmm4
+	QUAD   $0x00000000cd1c8d48     // leaq	0(,%rcx,8), %rbx
+	WORD   $0x894c; BYTE $0xf9     // movq	%r15, %rcx
+	VMOVQ  CPI0_1<>(SB), X3        // vmovq	.LCPI0_1(%rip), %xmm3
+	LONG   $0xcfaf0f49             // imulq	%r15, %rcx
+	LONG   $0xf6af0f4c             // imulq	%rsi, %r14
+	LONG   $0xc80c8d4c             // leaq	(%rax,%rcx,8), %r9
+	LONG   $0x014f8d49             // leaq	1(%r15), %rcx
+	LONG   $0xcfaf0f49             // imulq	%r15, %rcx
+	LONG   $0xc86c8d4c; BYTE $0xf8 // leaq	-8(%rax,%rcx,8), %r13
+	WORD   $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	WORD   $0xf748; BYTE $0xd8     // negq	%rax
+	LONG   $0x03e0c148             // salq	$3, %rax
+	LONG   $0xd0af0f48             // imulq	%rax, %rdx
+	LONG   $0x24448948; BYTE $0x18 // movq	%rax, 24(%rsp)
+	WORD   $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	WORD   $0x2948; BYTE $0xd0     // subq	%rdx, %rax
+	LONG   $0x24448948; BYTE $0x68 // movq	%rax, 104(%rsp)
+	QUAD   $0x00000000fd048d4a     // leaq	0(,%r15,8), %rax
+	LONG   $0x207f8d4c             // leaq	32(%rdi), %r15
+	LONG   $0x24448948; BYTE $0x60 // movq	%rax, 96(%rsp)
+	LONG   $0xfc468d48             // leaq	-4(%rsi), %rax
+	WORD   $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+	LONG   $0xfce08348             // andq	$-4, %rax
+	LONG   $0x247c894c; BYTE $0x48 // movq	%r15, 72(%rsp)
+	LONG   $0x02eac148             // shrq	$2, %rdx
+	LONG   $0x24448948; BYTE $0x50 // movq	%rax, 80(%rsp)
+	QUAD   $0x00000004950c8d48     // leaq	4(,%rdx,4), %rcx
+	LONG   $0x244c8948; BYTE $0x58 // movq	%rcx, 88(%rsp)
+
+BB0_22:
+	WORD $0x894c; BYTE $0xd0     // movq	%r10, %rax
+	LONG $0x01ea8349             // subq	$1, %r10
+	WORD $0x8949; BYTE $0xc7     // movq	%rax, %r15
+	LONG $0x24443948; BYTE $0x70 // cmpq	%rax, 112(%rsp)
+	JLE  BB0_11
+	LONG $0x24448b48; BYTE $0x50 // movq	80(%rsp), %rax
+	LONG $0x2454894c; BYTE $0x40 // movq	%r10, 64(%rsp)
+	WORD $0x894c; BYTE $0xe2     // movq	%r12, %rdx
+	WORD $0x894d; BYTE $0xeb     // movq	%r13, %r11
+	LONG $0x244c8b48; BYTE $0x48 // movq	72(%rsp), %rcx
+	LONG $0x244c894c; BYTE $0x38 // movq	%r9, 56(%rsp)
+	WORD $0x294c; BYTE $0xf2     // subq	%r14, %rdx
+	WORD $0x894d; BYTE $0xe0     // movq	%r12, %r8
+	WORD $0x014c; BYTE $0xf0     // addq	%r14, %rax
+	LONG $0x245c8948; BYTE $0x28 // movq	%rbx, 40(%rsp)
+	LONG $0xc10c8d48             // leaq	(%rcx,%rax,8), %rcx
+	LONG $0x2464894c; BYTE $0x20 // movq	%r12, 32(%rsp)
+	LONG $0x244c8948; BYTE $0x78 // movq	%rcx, 120(%rsp)
+	LONG $0x246c894c; BYTE $0x30 // movq	%r13, 48(%rsp)
+	WORD $0x894d; BYTE $0xf5     // movq	%r14, %r13
+
+BB0_10:
+	LONG $0x107bc1c4; BYTE $0x13 // vmovsd	(%r11), %xmm2
+	LONG $0xcb57e9c5             // vxorpd	%xmm3, %xmm2, %xmm1
+	LONG $0x197de2c4; BYTE $0xc9 // vbroadcastsd	%xmm1, %ymm1
+	LONG $0x03fe8348             // cmpq	$3, %rsi
+	JLE  BB0_31
+	LONG $0x24448b48; BYTE $0x68 // movq	104(%rsp), %rax
+	LONG $0x244c8b48; BYTE $0x78 // movq	120(%rsp), %rcx
+
+BB0_8:
+	LONG $0x0410fdc5; BYTE $0xd0 // vmovupd	(%rax,%rdx,8), %ymm0
+	LONG $0xa8f5e2c4; BYTE $0x00 // vfmadd213pd	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fdc5; BYTE $0xe0 // vmovupd	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JNE  BB0_8
+	LONG $0x244c8948; BYTE $0x78 // movq	%rcx, 120(%rsp)
+	LONG $0x24448b48; BYTE $0x58 // movq	88(%rsp), %rax
+
+BB0_7:
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JLE  BB0_16
+	WORD $0x8949; BYTE $0xf1 // movq	%rsi, %r9
+	LONG $0x28148d4e         // leaq	(%rax,%r13), %r10
+	LONG $0x00248d4e         // leaq	(%rax,%r8), %r12
+	WORD $0x2949; BYTE $0xc1 // subq	%rax, %r9
+	LONG $0x01f98349         // cmpq	$1, %r9
+	JE   BB0_12
+	LONG $0x00248d4e         // leaq	(%rax,%r8), %r12
+	QUAD $0x00000000d51c8d4a // leaq	0(,%r10,8), %rbx
+	QUAD $0x00000008e5348d4e // leaq	8(,%r12,8), %r14
+	WORD $0x894c; BYTE $0xf1 // movq	%r14, %rcx
+	WORD $0x8949; BYTE $0xde // movq	%rbx, %r14
+	WORD $0x2949; BYTE $0xce // subq	%rcx, %r14
+	LONG $0x10fe8349         // cmpq	$16, %r14
+	JA   BB0_63
+
+BB0_12:
+	LONG $0xd70c8d4e               // leaq	(%rdi,%r10,8), %r9
+	LONG $0x107ba1c4; WORD $0xe704 // vmovsd	(%rdi,%r12,8), %xmm0
+	LONG $0xade9c2c4; BYTE $0x01   // vfnmadd213sd	(%r9), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x01   // vmovsd	%xmm0, (%r9)
+	LONG $0x01488d4c               // leaq	1(%rax), %r9
+	WORD $0x394c; BYTE $0xce       // cmpq	%r9, %rsi
+	JLE  BB0_16
+	LONG $0x0d548d4f; BYTE $0x00   // leaq	0(%r13,%r9), %r10
+	WORD $0x014d; BYTE $0xc1       // addq	%r8, %r9
+	LONG $0xd7148d4e               // leaq	(%rdi,%r10,8), %r10
+	LONG $0x107ba1c4; WORD $0xcf04 // vmovsd	(%rdi,%r9,8), %xmm0
+	LONG $0x02488d4c               // leaq	2(%rax), %r9
+	LONG $0xade9c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xce       // cmpq	%r9, %rsi
+	JLE  BB0_16
+	LONG $0x0d548d4f; BYTE $0x00   // leaq	0(%r13,%r9), %r10
+	WORD $0x014d; BYTE $0xc1       // addq	%r8, %r9
+	LONG $0x03c08348               // addq	$3, %rax
+	LONG $0xd7148d4e               // leaq	(%rdi,%r10,8), %r10
+	LONG $0x107ba1c4; WORD $0xcf04 // vmovsd	(%rdi,%r9,8), %xmm0
+	LONG $0xade9c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_16
+	LONG $0x054c8d4d; BYTE $0x00   // leaq	0(%r13,%rax), %r9
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0xcf0c8d4e               // leaq	(%rdi,%r9,8), %r9
+	LONG $0x107bc1c4; BYTE $0x39   // vmovsd	(%r9), %xmm7
+	LONG $0x9dc1e2c4; WORD $0xc714 // vfnmadd132sd	(%rdi,%rax,8), %xmm7, %xmm2
+	LONG $0x117bc1c4; BYTE $0x11   // vmovsd	%xmm2, (%r9)
+
+BB0_16:
+	LONG $0x24448b48; BYTE $0x60 // movq	96(%rsp), %rax
+	LONG $0x01c78349             // addq	$1, %r15
+	WORD $0x0149; BYTE $0xf0     // addq	%rsi, %r8
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	WORD $0x0149; BYTE $0xc3     // addq	%rax, %r11
+	LONG $0x247c394c; BYTE $0x70 // cmpq	%r15, 112(%rsp)
+	JNE  BB0_10
+	WORD $0x894d; BYTE $0xee     // movq	%r13, %r14
+	LONG $0x24548b4c; BYTE $0x40 // movq	64(%rsp), %r10
+	LONG $0x244c8b4c; BYTE $0x38 // movq	56(%rsp), %r9
+	LONG $0x245c8b48; BYTE $0x28 // movq	40(%rsp), %rbx
+	LONG $0x246c8b4c; BYTE $0x30 // movq	48(%rsp), %r13
+	LONG $0x24648b4c; BYTE $0x20 // movq	32(%rsp), %r12
+
+BB0_11:
+	LONG $0x5e5bc1c4; WORD $0xf841 // vdivsd	-8(%r9), %xmm4, %xmm0
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x197de2c4; BYTE $0xc8   // vbroadcastsd	%xmm0, %ymm1
+	LONG $0x03fe8348               // cmpq	$3, %rsi
+	JLE  BB0_6
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x244c8b48; BYTE $0x48   // movq	72(%rsp), %rcx
+	WORD $0x014c; BYTE $0xf0       // addq	%r14, %rax
+	LONG $0xc1148d48               // leaq	(%rcx,%rax,8), %rdx
+	LONG $0x24448b48; BYTE $0x68   // movq	104(%rsp), %rax
+
+BB0_20:
+	LONG $0x0059f5c5               // vmulpd	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0x4011fdc5; BYTE $0xe0   // vmovupd	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JNE  BB0_20
+	LONG $0x24548b48; BYTE $0x58   // movq	88(%rsp), %rdx
+	LONG $0x5e5bc1c4; WORD $0xf841 // vdivsd	-8(%r9), %xmm4, %xmm0
+
+BB0_6:
+	WORD $0x3948; BYTE $0xd6     // cmpq	%rdx, %rsi
+	JLE  BB0_27
+	WORD $0x8948; BYTE $0xf1     // movq	%rsi, %rcx
+	WORD $0x8949; BYTE $0xd3     // movq	%rdx, %r11
+	WORD $0x2948; BYTE $0xd1     // subq	%rdx, %rcx
+	LONG $0xff418d48             // leaq	-1(%rcx), %rax
+	LONG $0x02f88348             // cmpq	$2, %rax
+	JBE  BB0_33
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x32048d4a             // leaq	(%rdx,%r14), %rax
+	LONG $0x197de2c4; BYTE $0xd0 // vbroadcastsd	%xmm0, %ymm2
+	LONG $0x02e8c149             // shrq	$2, %r8
+	LONG $0xc7048d48             // leaq	(%rdi,%rax,8), %rax
+	LONG $0x05e0c149             // salq	$5, %r8
+	WORD $0x0149; BYTE $0xc0     // addq	%rax, %r8
+
+BB0_25:
+	LONG $0x0859edc5             // vmulpd	(%rax), %ymm2, %ymm1
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4811fdc5; BYTE $0xe0 // vmovupd	%ymm1, -32(%rax)
+	WORD $0x3949; BYTE $0xc0     // cmpq	%rax, %r8
+	JNE  BB0_25
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	WORD $0xc1f6; BYTE $0x03     // testb	$3, %cl
+	JE   BB0_27
+
+BB0_24:
+	WORD $0x2948; BYTE $0xc1 // subq	%rax, %rcx
+	LONG $0x01f98348         // cmpq	$1, %rcx
+	JE   BB0_29
+	WORD $0x014d; BYTE $0xf3 // addq	%r14, %r11
+	LONG $0xc812fbc5         // vmovddup	%xmm0, %xmm1
+	WORD $0x0149; BYTE $0xc3 // addq	%rax, %r11
+	LONG $0xdf048d4a         // leaq	(%rdi,%r11,8), %rax
+	LONG $0x0859f1c5         // vmulpd	(%rax), %xmm1, %xmm1
+	LONG $0x0811f9c5         // vmovupd	%xmm1, (%rax)
+	WORD $0xc1f6; BYTE $0x01 // testb	$1, %cl
+	JE   BB0_27
+	LONG $0xfee18348         // andq	$-2, %rcx
+	WORD $0x0148; BYTE $0xca // addq	%rcx, %rdx
+
+BB0_29:
+	WORD $0x014c; BYTE $0xf2 // addq	%r14, %rdx
+	LONG $0xd7048d48         // leaq	(%rdi,%rdx,8), %rax
+	LONG $0x0059fbc5         // vmulsd	(%rax), %xmm0, %xmm0
+	LONG $0x0011fbc5         // vmovsd	%xmm0, (%rax)
+
+BB0_27:
+	LONG $0x244c8b48; BYTE $0x18 // movq	24(%rsp), %rcx
+	WORD $0x2949; BYTE $0xf6     // subq	%rsi, %r14
+	LONG $0x244c0148; BYTE $0x68 // addq	%rcx, 104(%rsp)
+	WORD $0x0149; BYTE $0xd9     // addq	%rbx, %r9
+	WORD $0x0149; BYTE $0xdd     // addq	%rbx, %r13
+	WORD $0x2949; BYTE $0xf4     // subq	%rsi, %r12
+	WORD $0x854d; BYTE $0xd2     // testq	%r10, %r10
+	JNE  BB0_22
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+
+BB0_60:
+	LONG $0xf0658d48 // leaq	-16(%rbp), %rsp
+	RET
+
+BB0_63:
+	LONG $0xff718d4d                           // leaq	-1(%r9), %r14
+	LONG $0x02fe8349                           // cmpq	$2, %r14
+	JBE  BB0_32
+	WORD $0x0148; BYTE $0xfb                   // addq	%rdi, %rbx
+	LONG $0x197de2c4; BYTE $0xc2               // vbroadcastsd	%xmm2, %ymm0
+	LONG $0x3b10fdc5                           // vmovupd	(%rbx), %ymm7
+	LONG $0x9cc5e2c4; WORD $0x0f44; BYTE $0xf8 // vfnmadd132pd	-8(%rdi,%rcx), %ymm7, %ymm0
+	LONG $0x0311fdc5                           // vmovupd	%ymm0, (%rbx)
+	WORD $0x894c; BYTE $0xcb                   // movq	%r9, %rbx
+	LONG $0xfce38348                           // andq	$-4, %rbx
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x03c1f641                           // testb	$3, %r9b
+	JE   BB0_16
+	WORD $0x2949; BYTE $0xd9                   // subq	%rbx, %r9
+	LONG $0x01f98349                           // cmpq	$1, %r9
+	JE   BB0_17
+
+BB0_13:
+	WORD $0x0149; BYTE $0xda       // addq	%rbx, %r10
+	WORD $0x014c; BYTE $0xe3       // addq	%r12, %rbx
+	LONG $0xc212fbc5               // vmovddup	%xmm2, %xmm0
+	LONG $0xd7148d4e               // leaq	(%rdi,%r10,8), %r10
+	LONG $0x1079c1c4; BYTE $0x32   // vmovupd	(%r10), %xmm6
+	LONG $0x9cc9e2c4; WORD $0xdf04 // vfnmadd132pd	(%rdi,%rbx,8), %xmm6, %xmm0
+	LONG $0x1179c1c4; BYTE $0x02   // vmovupd	%xmm0, (%r10)
+	LONG $0x01c1f641               // testb	$1, %r9b
+	JE   BB0_16
+	LONG $0xfee18349               // andq	$-2, %r9
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+
+BB0_17:
+	LONG $0x054c8d4d; BYTE $0x00   // leaq	0(%r13,%rax), %r9
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0xcf0c8d4e               // leaq	(%rdi,%r9,8), %r9
+	LONG $0x107bc1c4; BYTE $0x29   // vmovsd	(%r9), %xmm5
+	LONG $0x9dd1e2c4; WORD $0xc714 // vfnmadd132sd	(%rdi,%rax,8), %xmm5, %xmm2
+	LONG $0x117bc1c4; BYTE $0x11   // vmovsd	%xmm2, (%r9)
+	JMP  BB0_16
+
+BB0_31:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_7
+
+BB0_32:
+	WORD $0xdb31 // xorl	%ebx, %ebx
+	JMP  BB0_13
+
+BB0_33:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_24
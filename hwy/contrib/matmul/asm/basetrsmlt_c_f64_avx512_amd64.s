@@ -0,0 +1,384 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/matmul/asm/basetrsmlt_c_f64_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x00000000
+DATA CPI0_0<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x80000000
+DATA CPI0_1<>+8(SB)/4, $0x00000000
+DATA CPI0_1<>+12(SB)/4, $0x00000000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $16
+
+TEXT ·trsmlt_c_f64_avx512(SB), $64-48
+	MOVQ   l+0(FP), DI
+	MOVQ   b+8(FP), SI
+	MOVQ   pn+16(FP), DX
+	MOVQ   pnrhs+24(FP), CX
+	MOVQ   plen_l+32(FP), R8
+	MOVQ   plen_b+40(FP), R9
+	LONG   $0x246c8d48; BYTE $0x30 // leaq	48(%rsp), %rbp
+	LONG   $0x24648d48; BYTE $0x40 // leaq	64(%rsp), %rsp
+	LONG   $0xc0e48348             // andq	$-64, %rsp
+	LONG   $0x80c48348             // addq	$-128, %rsp
+	WORD   $0x8b48; BYTE $0x1a     // movq	(%rdx), %rbx
+	WORD   $0x8b48; BYTE $0x09     // movq	(%rcx), %rcx
+	LONG   $0x245c8948; BYTE $0x68 // movq	%rbx, 104(%rsp)
+	WORD   $0x8548; BYTE $0xc9     // testq	%rcx, %rcx
+	JE     BB0_53
+	WORD   $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE    BB0_53
+	WORD   $0x8948; BYTE $0xda     // movq	%rbx, %rdx
+	LONG   $0xff438d48             // leaq	-1(%rbx), %rax
+	WORD   $0x8949; BYTE $0xcf     // movq	%rcx, %r15
+	WORD   $0x8949; BYTE $0xda     // movq	%rbx, %r10
+	WORD   $0xf748; BYTE $0xd2     // notq	%rdx
+	LONG   $0xf8af0f4c             // imulq	%rax, %r15
+	VMOVSD CPI0_0<>(SB), X5        // vmovsd	.LCPI0_0(%rip), %xmm5
+	VMOVQ  CPI0_1<>(SB), X3        // vmovq	.LCPI0_1(%rip), %xmm3
+	QUAD   $0x00000000d5348d4c     // leaq	0(,%rdx,8), %r14
+	WORD   $0x8948; BYTE $0xda     // movq	%rbx, %rdx
+	LONG   $0xd3af0f48             // imulq	%rbx, %rdx
+	LONG   $0x2474894c; BYTE $0x20 // movq	%r14, 32(%rsp)
+	LONG   $0xd70c8d4c             // leaq	(%rdi,%rdx,8), %r9
+	LONG   $0x01538d48             // leaq	1(%rbx), %rdx
+	LONG   $0xd3af0f48             // imulq	%rbx, %rdx
+	LONG   $0xd9af0f48             // imulq	%rcx, %rbx
+	LONG   $0xd7648d4c; BYTE $0xf8 // leaq	-8(%rdi,%rdx,8), %r12
+	WORD   $0x8948; BYTE $0xca     // movq	%rcx, %rdx
+	WORD   $0xf748; BYTE $0xda     // negq	%rdx
+	LONG   $0x03e2c148             // salq	$3, %rdx
+	LONG   $0xc2af0f48             // imulq	%rdx, %rax
+	LONG   $0x24548948; BYTE $0x28 // movq	%rdx, 40(%rsp)
+	WORD   $0x8948; BYTE $0xf2     // movq	%rsi, %rdx
+	WORD   $0x2948; BYTE $0xc2     // subq	%rax, %rdx
+	QUAD   $0x00000000d5048d4a     // leaq	0(,%r10,8), %rax
+	LONG   $0x6ef9e1c4; BYTE $0xf0 // vmovq	%rax, %xmm6
+	LONG   $0xf8418d48             // leaq	-8(%rcx), %rax
+	LONG   $0x24548948; BYTE $0x60 // movq	%rdx, 96(%rsp)
+	WORD   $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+	LONG   $0xf8e08348             // andq	$-8, %rax
+	LONG   $0x03eac148             // shrq	$3, %rdx
+	WORD   $0x8949; BYTE $0xc6     // movq	%rax, %r14
+	QUAD   $0x00000008d5148d48     // leaq	8(,%rdx,8), %rdx
+	LONG   $0x24548948; BYTE $0x58 // movq	%rdx, 88(%rsp)
+	LONG   $0x40568d48             // leaq	64(%rsi), %rdx
+	LONG   $0x6ef9e1c4; BYTE $0xe2 // vmovq	%rdx, %xmm4
+
+BB0_22:
+	WORD $0x894d; BYTE $0xd3     // movq	%r10, %r11
+	LONG $0x01ea8349             // subq	$1, %r10
+	LONG $0x245c394c; BYTE $0x68 // cmpq	%r11, 104(%rsp)
+	JLE  BB0_11
+	LONG $0x3e048d4b             // leaq	(%r14,%r15), %rax
+	LONG $0x2454894c; BYTE $0x50 // movq	%r10, 80(%rsp)
+	WORD $0x8948; BYTE $0xda     // movq	%rbx, %rdx
+	WORD $0x8949; BYTE $0xd8     // movq	%rbx, %r8
+	LONG $0x7ef9e1c4; BYTE $0xe7 // vmovq	%xmm4, %rdi
+	LONG $0x244c894c; BYTE $0x48 // movq	%r9, 72(%rsp)
+	WORD $0x294c; BYTE $0xfa     // subq	%r15, %rdx
+	LONG $0xc73c8d48             // leaq	(%rdi,%rax,8), %rdi
+	LONG $0x2464894c; BYTE $0x40 // movq	%r12, 64(%rsp)
+	LONG $0x247c8948; BYTE $0x78 // movq	%rdi, 120(%rsp)
+	LONG $0x245c8948; BYTE $0x38 // movq	%rbx, 56(%rsp)
+	LONG $0x2474894c; BYTE $0x30 // movq	%r14, 48(%rsp)
+	WORD $0x894d; BYTE $0xe6     // movq	%r12, %r14
+
+BB0_10:
+	LONG $0x107bc1c4; BYTE $0x16   // vmovsd	(%r14), %xmm2
+	LONG $0xcb57e9c5               // vxorpd	%xmm3, %xmm2, %xmm1
+	LONG $0x48fdf262; WORD $0xc919 // vbroadcastsd	%xmm1, %zmm1
+	LONG $0x07f98348               // cmpq	$7, %rcx
+	JLE  BB0_31
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+	LONG $0x247c8b48; BYTE $0x78   // movq	120(%rsp), %rdi
+
+BB0_8:
+	LONG $0x48fdf162; WORD $0x0410; BYTE $0xd0 // vmovupd	(%rax,%rdx,8), %zmm0
+	LONG $0x48f5f262; WORD $0x00a8             // vfmadd213pd	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x48fdf162; WORD $0x4011; BYTE $0xff // vmovupd	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xc7                   // cmpq	%rax, %rdi
+	JNE  BB0_8
+	LONG $0x247c8948; BYTE $0x78               // movq	%rdi, 120(%rsp)
+	LONG $0x24448b48; BYTE $0x58               // movq	88(%rsp), %rax
+
+BB0_7:
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JLE  BB0_16
+	WORD $0x8949; BYTE $0xc9     // movq	%rcx, %r9
+	LONG $0x38148d4e             // leaq	(%rax,%r15), %r10
+	LONG $0x001c8d4a             // leaq	(%rax,%r8), %rbx
+	WORD $0x2949; BYTE $0xc1     // subq	%rax, %r9
+	LONG $0xff618d4d             // leaq	-1(%r9), %r12
+	LONG $0x02fc8349             // cmpq	$2, %r12
+	JBE  BB0_12
+	QUAD $0x00000000d51c8d4a     // leaq	0(,%r10,8), %rbx
+	WORD $0x8948; BYTE $0xdf     // movq	%rbx, %rdi
+	LONG $0x001c8d4a             // leaq	(%rax,%r8), %rbx
+	QUAD $0x00000008dd2c8d4c     // leaq	8(,%rbx,8), %r13
+	LONG $0x247c8948; BYTE $0x70 // movq	%rdi, 112(%rsp)
+	WORD $0x294c; BYTE $0xef     // subq	%r13, %rdi
+	LONG $0x30ff8348             // cmpq	$48, %rdi
+	JA   BB0_57
+
+BB0_12:
+	LONG $0xd60c8d4e               // leaq	(%rsi,%r10,8), %r9
+	LONG $0x0410fbc5; BYTE $0xde   // vmovsd	(%rsi,%rbx,8), %xmm0
+	LONG $0xade9c2c4; BYTE $0x01   // vfnmadd213sd	(%r9), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x01   // vmovsd	%xmm0, (%r9)
+	LONG $0x01488d4c               // leaq	1(%rax), %r9
+	WORD $0x3949; BYTE $0xc9       // cmpq	%rcx, %r9
+	JGE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x014d; BYTE $0xc1       // addq	%r8, %r9
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x107ba1c4; WORD $0xce04 // vmovsd	(%rsi,%r9,8), %xmm0
+	LONG $0x02488d4c               // leaq	2(%rax), %r9
+	LONG $0xade9c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x014d; BYTE $0xc1       // addq	%r8, %r9
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x107ba1c4; WORD $0xce04 // vmovsd	(%rsi,%r9,8), %xmm0
+	LONG $0x03488d4c               // leaq	3(%rax), %r9
+	LONG $0xade9c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x014d; BYTE $0xc1       // addq	%r8, %r9
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x107ba1c4; WORD $0xce04 // vmovsd	(%rsi,%r9,8), %xmm0
+	LONG $0x04488d4c               // leaq	4(%rax), %r9
+	LONG $0xade9c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x014d; BYTE $0xc1       // addq	%r8, %r9
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x107ba1c4; WORD $0xce04 // vmovsd	(%rsi,%r9,8), %xmm0
+	LONG $0x05488d4c               // leaq	5(%rax), %r9
+	LONG $0xade9c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x014d; BYTE $0xc1       // addq	%r8, %r9
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x107ba1c4; WORD $0xce04 // vmovsd	(%rsi,%r9,8), %xmm0
+	LONG $0x06488d4c               // leaq	6(%rax), %r9
+	LONG $0xade9c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x014d; BYTE $0xc1       // addq	%r8, %r9
+	LONG $0x07c08348               // addq	$7, %rax
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x107ba1c4; WORD $0xce04 // vmovsd	(%rsi,%r9,8), %xmm0
+	LONG $0xade9c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_16
+
+BB0_55:
+	LONG $0x070c8d4d               // leaq	(%r15,%rax), %r9
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0xce0c8d4e               // leaq	(%rsi,%r9,8), %r9
+	LONG $0x107bc1c4; BYTE $0x39   // vmovsd	(%r9), %xmm7
+	LONG $0x9dc1e2c4; WORD $0xc614 // vfnmadd132sd	(%rsi,%rax,8), %xmm7, %xmm2
+	LONG $0x117bc1c4; BYTE $0x11   // vmovsd	%xmm2, (%r9)
+
+BB0_16:
+	LONG $0x7ef9e1c4; BYTE $0xf0 // vmovq	%xmm6, %rax
+	LONG $0x01c38349             // addq	$1, %r11
+	WORD $0x0149; BYTE $0xc8     // addq	%rcx, %r8
+	WORD $0x0148; BYTE $0xca     // addq	%rcx, %rdx
+	WORD $0x0149; BYTE $0xc6     // addq	%rax, %r14
+	LONG $0x245c394c; BYTE $0x68 // cmpq	%r11, 104(%rsp)
+	JNE  BB0_10
+	LONG $0x24548b4c; BYTE $0x50 // movq	80(%rsp), %r10
+	LONG $0x244c8b4c; BYTE $0x48 // movq	72(%rsp), %r9
+	LONG $0x24648b4c; BYTE $0x40 // movq	64(%rsp), %r12
+	LONG $0x245c8b48; BYTE $0x38 // movq	56(%rsp), %rbx
+	LONG $0x24748b4c; BYTE $0x30 // movq	48(%rsp), %r14
+
+BB0_11:
+	LONG $0x5e53c1c4; WORD $0xf851 // vdivsd	-8(%r9), %xmm5, %xmm2
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x48fdf262; WORD $0xca19 // vbroadcastsd	%xmm2, %zmm1
+	LONG $0x07f98348               // cmpq	$7, %rcx
+	JLE  BB0_6
+	LONG $0x3e048d4b               // leaq	(%r14,%r15), %rax
+	LONG $0x7ef9e1c4; BYTE $0xe2   // vmovq	%xmm4, %rdx
+	LONG $0xc2148d48               // leaq	(%rdx,%rax,8), %rdx
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+
+BB0_20:
+	LONG $0x48f5f162; WORD $0x0059             // vmulpd	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x48fdf162; WORD $0x4011; BYTE $0xff // vmovupd	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JNE  BB0_20
+	LONG $0x24548b48; BYTE $0x58               // movq	88(%rsp), %rdx
+	LONG $0x5e53c1c4; WORD $0xf851             // vdivsd	-8(%r9), %xmm5, %xmm2
+
+BB0_6:
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_27
+	WORD $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	WORD $0x8949; BYTE $0xd0       // movq	%rdx, %r8
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_33
+	WORD $0x8949; BYTE $0xfb       // movq	%rdi, %r11
+	LONG $0x17048d49               // leaq	(%r15,%rdx), %rax
+	LONG $0x48fdf262; WORD $0xca19 // vbroadcastsd	%xmm2, %zmm1
+	LONG $0x03ebc149               // shrq	$3, %r11
+	LONG $0xc6048d48               // leaq	(%rsi,%rax,8), %rax
+	LONG $0x06e3c149               // salq	$6, %r11
+	WORD $0x0149; BYTE $0xc3       // addq	%rax, %r11
+
+BB0_25:
+	LONG $0x48f5f162; WORD $0x0059             // vmulpd	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x48fdf162; WORD $0x4011; BYTE $0xff // vmovupd	%zmm0, -64(%rax)
+	WORD $0x3949; BYTE $0xc3                   // cmpq	%rax, %r11
+	JNE  BB0_25
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x07c7f640                           // testb	$7, %dil
+	JE   BB0_27
+
+BB0_24:
+	WORD $0x2948; BYTE $0xc7     // subq	%rax, %rdi
+	LONG $0xff5f8d4c             // leaq	-1(%rdi), %r11
+	LONG $0x02fb8349             // cmpq	$2, %r11
+	JBE  BB0_29
+	WORD $0x014d; BYTE $0xf8     // addq	%r15, %r8
+	LONG $0x197de2c4; BYTE $0xc2 // vbroadcastsd	%xmm2, %ymm0
+	WORD $0x0149; BYTE $0xc0     // addq	%rax, %r8
+	LONG $0xc6048d4a             // leaq	(%rsi,%r8,8), %rax
+	LONG $0x0059fdc5             // vmulpd	(%rax), %ymm0, %ymm0
+	LONG $0x0011fdc5             // vmovupd	%ymm0, (%rax)
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	WORD $0xe783; BYTE $0x03     // andl	$3, %edi
+	JE   BB0_27
+
+BB0_29:
+	LONG $0x17048d49         // leaq	(%r15,%rdx), %rax
+	LONG $0xc6048d48         // leaq	(%rsi,%rax,8), %rax
+	LONG $0x0059ebc5         // vmulsd	(%rax), %xmm2, %xmm0
+	LONG $0x0011fbc5         // vmovsd	%xmm0, (%rax)
+	LONG $0x01428d48         // leaq	1(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1 // cmpq	%rax, %rcx
+	JLE  BB0_27
+	WORD $0x014c; BYTE $0xf8 // addq	%r15, %rax
+	LONG $0x02c28348         // addq	$2, %rdx
+	LONG $0xc6048d48         // leaq	(%rsi,%rax,8), %rax
+	LONG $0x0059ebc5         // vmulsd	(%rax), %xmm2, %xmm0
+	LONG $0x0011fbc5         // vmovsd	%xmm0, (%rax)
+	WORD $0x3948; BYTE $0xca // cmpq	%rcx, %rdx
+	JGE  BB0_27
+	WORD $0x014c; BYTE $0xfa // addq	%r15, %rdx
+	LONG $0xd6048d48         // leaq	(%rsi,%rdx,8), %rax
+	LONG $0x1059ebc5         // vmulsd	(%rax), %xmm2, %xmm2
+	LONG $0x1011fbc5         // vmovsd	%xmm2, (%rax)
+
+BB0_27:
+	LONG $0x24448b48; BYTE $0x20 // movq	32(%rsp), %rax
+	LONG $0x24548b48; BYTE $0x28 // movq	40(%rsp), %rdx
+	WORD $0x2949; BYTE $0xcf     // subq	%rcx, %r15
+	WORD $0x2948; BYTE $0xcb     // subq	%rcx, %rbx
+	LONG $0x24540148; BYTE $0x60 // addq	%rdx, 96(%rsp)
+	WORD $0x0149; BYTE $0xc1     // addq	%rax, %r9
+	WORD $0x0149; BYTE $0xc4     // addq	%rax, %r12
+	WORD $0x854d; BYTE $0xd2     // testq	%r10, %r10
+	JNE  BB0_22
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+
+BB0_53:
+	LONG $0xd0658d48 // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_57:
+	LONG $0x06fc8349                                   // cmpq	$6, %r12
+	JBE  BB0_32
+	LONG $0x24648b4c; BYTE $0x70                       // movq	112(%rsp), %r12
+	QUAD $0xf82e841048fdb162; WORD $0xffff; BYTE $0xff // vmovupd	-8(%rsi,%r13), %zmm0
+	LONG $0x48fdf262; WORD $0xca19                     // vbroadcastsd	%xmm2, %zmm1
+	WORD $0x0149; BYTE $0xf4                           // addq	%rsi, %r12
+	LONG $0x48f5d262; WORD $0x04ac; BYTE $0x24         // vfnmadd213pd	(%r12), %zmm1, %zmm0
+	LONG $0x48fdd162; WORD $0x0411; BYTE $0x24         // vmovupd	%zmm0, (%r12)
+	WORD $0x894d; BYTE $0xcc                           // movq	%r9, %r12
+	LONG $0xf8e48349                                   // andq	$-8, %r12
+	WORD $0x014c; BYTE $0xe0                           // addq	%r12, %rax
+	LONG $0x07c1f641                                   // testb	$7, %r9b
+	JE   BB0_16
+	WORD $0x294d; BYTE $0xe1                           // subq	%r12, %r9
+	LONG $0xff698d4d                                   // leaq	-1(%r9), %r13
+	LONG $0x02fd8349                                   // cmpq	$2, %r13
+	JBE  BB0_17
+
+BB0_13:
+	WORD $0x014d; BYTE $0xe2       // addq	%r12, %r10
+	WORD $0x0149; BYTE $0xdc       // addq	%rbx, %r12
+	LONG $0x197de2c4; BYTE $0xc2   // vbroadcastsd	%xmm2, %ymm0
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x107dc1c4; BYTE $0x3a   // vmovupd	(%r10), %ymm7
+	LONG $0x9cc5a2c4; WORD $0xe604 // vfnmadd132pd	(%rsi,%r12,8), %ymm7, %ymm0
+	LONG $0x117dc1c4; BYTE $0x02   // vmovupd	%ymm0, (%r10)
+	WORD $0x894d; BYTE $0xca       // movq	%r9, %r10
+	LONG $0xfce28349               // andq	$-4, %r10
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+	LONG $0x03e18341               // andl	$3, %r9d
+	JE   BB0_16
+
+BB0_17:
+	LONG $0x070c8d4d               // leaq	(%r15,%rax), %r9
+	LONG $0x00148d4d               // leaq	(%r8,%rax), %r10
+	LONG $0xce0c8d4e               // leaq	(%rsi,%r9,8), %r9
+	LONG $0x107ba1c4; WORD $0xd604 // vmovsd	(%rsi,%r10,8), %xmm0
+	LONG $0xade9c2c4; BYTE $0x01   // vfnmadd213sd	(%r9), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x01   // vmovsd	%xmm0, (%r9)
+	LONG $0x01488d4c               // leaq	1(%rax), %r9
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_16
+	LONG $0x0f148d4f               // leaq	(%r15,%r9), %r10
+	WORD $0x014d; BYTE $0xc1       // addq	%r8, %r9
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0xd6148d4e               // leaq	(%rsi,%r10,8), %r10
+	LONG $0x107ba1c4; WORD $0xce04 // vmovsd	(%rsi,%r9,8), %xmm0
+	LONG $0xade9c2c4; BYTE $0x02   // vfnmadd213sd	(%r10), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x02   // vmovsd	%xmm0, (%r10)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JG   BB0_55
+	JMP  BB0_16
+
+BB0_31:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_7
+
+BB0_32:
+	WORD $0x3145; BYTE $0xe4 // xorl	%r12d, %r12d
+	JMP  BB0_13
+
+BB0_33:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_24
@@ -0,0 +1,17 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// MatMul_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func MatMul_AVX512_F32(a unsafe.Pointer, b unsafe.Pointer, c unsafe.Pointer, pm unsafe.Pointer, pn unsafe.Pointer, pk unsafe.Pointer, plen_a unsafe.Pointer, plen_b unsafe.Pointer, plen_c unsafe.Pointer) {
+	matmul_c_f32_avx512(a, b, c, pm, pn, pk, plen_a, plen_b, plen_c)
+}
+
+// MatMul_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func MatMul_AVX512_F64(a unsafe.Pointer, b unsafe.Pointer, c unsafe.Pointer, pm unsafe.Pointer, pn unsafe.Pointer, pk unsafe.Pointer, plen_a unsafe.Pointer, plen_b unsafe.Pointer, plen_c unsafe.Pointer) {
+	matmul_c_f64_avx512(a, b, c, pm, pn, pk, plen_a, plen_b, plen_c)
+}
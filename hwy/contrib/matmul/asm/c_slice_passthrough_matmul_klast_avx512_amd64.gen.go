@@ -0,0 +1,27 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// MatMulKLast_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func MatMulKLast_AVX512_F32(a unsafe.Pointer, b unsafe.Pointer, c unsafe.Pointer, pm unsafe.Pointer, pn unsafe.Pointer, pk unsafe.Pointer, plen_a unsafe.Pointer, plen_b unsafe.Pointer, plen_c unsafe.Pointer) {
+	matmulklast_c_f32_avx512(a, b, c, pm, pn, pk, plen_a, plen_b, plen_c)
+}
+
+// MatMulKLast_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func MatMulKLast_AVX512_F64(a unsafe.Pointer, b unsafe.Pointer, c unsafe.Pointer, pm unsafe.Pointer, pn unsafe.Pointer, pk unsafe.Pointer, plen_a unsafe.Pointer, plen_b unsafe.Pointer, plen_c unsafe.Pointer) {
+	matmulklast_c_f64_avx512(a, b, c, pm, pn, pk, plen_a, plen_b, plen_c)
+}
+
+// MatMulKLastBlocked_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func MatMulKLastBlocked_AVX512_F32(a unsafe.Pointer, b unsafe.Pointer, c unsafe.Pointer, pm unsafe.Pointer, pn unsafe.Pointer, pk unsafe.Pointer, plen_a unsafe.Pointer, plen_b unsafe.Pointer, plen_c unsafe.Pointer) {
+	matmulklastblocked_c_f32_avx512(a, b, c, pm, pn, pk, plen_a, plen_b, plen_c)
+}
+
+// MatMulKLastBlocked_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func MatMulKLastBlocked_AVX512_F64(a unsafe.Pointer, b unsafe.Pointer, c unsafe.Pointer, pm unsafe.Pointer, pn unsafe.Pointer, pk unsafe.Pointer, plen_a unsafe.Pointer, plen_b unsafe.Pointer, plen_c unsafe.Pointer) {
+	matmulklastblocked_c_f64_avx512(a, b, c, pm, pn, pk, plen_a, plen_b, plen_c)
+}
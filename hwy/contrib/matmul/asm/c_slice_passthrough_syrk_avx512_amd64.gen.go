@@ -0,0 +1,17 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// SyrkLN_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func SyrkLN_AVX512_F32(c unsafe.Pointer, pldc unsafe.Pointer, a unsafe.Pointer, plda unsafe.Pointer, pn unsafe.Pointer, pk unsafe.Pointer, plen_c unsafe.Pointer, plen_a unsafe.Pointer) {
+	syrkln_c_f32_avx512(c, pldc, a, plda, pn, pk, plen_c, plen_a)
+}
+
+// SyrkLN_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func SyrkLN_AVX512_F64(c unsafe.Pointer, pldc unsafe.Pointer, a unsafe.Pointer, plda unsafe.Pointer, pn unsafe.Pointer, pk unsafe.Pointer, plen_c unsafe.Pointer, plen_a unsafe.Pointer) {
+	syrkln_c_f64_avx512(c, pldc, a, plda, pn, pk, plen_c, plen_a)
+}
@@ -0,0 +1,27 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// TrsmLN_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func TrsmLN_AVX2_F32(l unsafe.Pointer, b unsafe.Pointer, pn unsafe.Pointer, pnrhs unsafe.Pointer, plen_l unsafe.Pointer, plen_b unsafe.Pointer) {
+	trsmln_c_f32_avx2(l, b, pn, pnrhs, plen_l, plen_b)
+}
+
+// TrsmLN_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func TrsmLN_AVX2_F64(l unsafe.Pointer, b unsafe.Pointer, pn unsafe.Pointer, pnrhs unsafe.Pointer, plen_l unsafe.Pointer, plen_b unsafe.Pointer) {
+	trsmln_c_f64_avx2(l, b, pn, pnrhs, plen_l, plen_b)
+}
+
+// TrsmLT_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func TrsmLT_AVX2_F32(l unsafe.Pointer, b unsafe.Pointer, pn unsafe.Pointer, pnrhs unsafe.Pointer, plen_l unsafe.Pointer, plen_b unsafe.Pointer) {
+	trsmlt_c_f32_avx2(l, b, pn, pnrhs, plen_l, plen_b)
+}
+
+// TrsmLT_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func TrsmLT_AVX2_F64(l unsafe.Pointer, b unsafe.Pointer, pn unsafe.Pointer, pnrhs unsafe.Pointer, plen_l unsafe.Pointer, plen_b unsafe.Pointer) {
+	trsmlt_c_f64_avx2(l, b, pn, pnrhs, plen_l, plen_b)
+}
@@ -0,0 +1,86 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// MatMulCAVX2F32 computes MatMul using AVX2 SIMD assembly.
+func MatMulCAVX2F32(a, b, c []float32, m, n, k int) {
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	var p_c unsafe.Pointer
+	if len(c) > 0 {
+		p_c = unsafe.Pointer(&c[0])
+	}
+	if m == 0 || n == 0 || k == 0 {
+		return
+	}
+	if len(a) < m*k || len(b) < k*n || len(c) < m*n {
+		return
+	}
+	mVal := int64(m)
+	nVal := int64(n)
+	kVal := int64(k)
+	len_aVal := int64(len(a))
+	len_bVal := int64(len(b))
+	len_cVal := int64(len(c))
+	matmul_c_f32_avx2(
+		p_a,
+		p_b,
+		p_c,
+		unsafe.Pointer(&mVal),
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&kVal),
+		unsafe.Pointer(&len_aVal),
+		unsafe.Pointer(&len_bVal),
+		unsafe.Pointer(&len_cVal),
+	)
+}
+
+// MatMulCAVX2F64 computes MatMul using AVX2 SIMD assembly.
+func MatMulCAVX2F64(a, b, c []float64, m, n, k int) {
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	var p_c unsafe.Pointer
+	if len(c) > 0 {
+		p_c = unsafe.Pointer(&c[0])
+	}
+	if m == 0 || n == 0 || k == 0 {
+		return
+	}
+	if len(a) < m*k || len(b) < k*n || len(c) < m*n {
+		return
+	}
+	mVal := int64(m)
+	nVal := int64(n)
+	kVal := int64(k)
+	len_aVal := int64(len(a))
+	len_bVal := int64(len(b))
+	len_cVal := int64(len(c))
+	matmul_c_f64_avx2(
+		p_a,
+		p_b,
+		p_c,
+		unsafe.Pointer(&mVal),
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&kVal),
+		unsafe.Pointer(&len_aVal),
+		unsafe.Pointer(&len_bVal),
+		unsafe.Pointer(&len_cVal),
+	)
+}
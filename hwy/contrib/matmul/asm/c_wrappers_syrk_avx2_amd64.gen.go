@@ -0,0 +1,64 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// SyrkLNCAVX2F32 computes SyrkLN using AVX2 SIMD assembly.
+func SyrkLNCAVX2F32(c []float32, ldc int, a []float32, lda, n, k int) {
+	var p_c unsafe.Pointer
+	if len(c) > 0 {
+		p_c = unsafe.Pointer(&c[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	ldcVal := int64(ldc)
+	ldaVal := int64(lda)
+	nVal := int64(n)
+	kVal := int64(k)
+	len_cVal := int64(len(c))
+	len_aVal := int64(len(a))
+	syrkln_c_f32_avx2(
+		p_c,
+		unsafe.Pointer(&ldcVal),
+		p_a,
+		unsafe.Pointer(&ldaVal),
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&kVal),
+		unsafe.Pointer(&len_cVal),
+		unsafe.Pointer(&len_aVal),
+	)
+}
+
+// SyrkLNCAVX2F64 computes SyrkLN using AVX2 SIMD assembly.
+func SyrkLNCAVX2F64(c []float64, ldc int, a []float64, lda, n, k int) {
+	var p_c unsafe.Pointer
+	if len(c) > 0 {
+		p_c = unsafe.Pointer(&c[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	ldcVal := int64(ldc)
+	ldaVal := int64(lda)
+	nVal := int64(n)
+	kVal := int64(k)
+	len_cVal := int64(len(c))
+	len_aVal := int64(len(a))
+	syrkln_c_f64_avx2(
+		p_c,
+		unsafe.Pointer(&ldcVal),
+		p_a,
+		unsafe.Pointer(&ldaVal),
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&kVal),
+		unsafe.Pointer(&len_cVal),
+		unsafe.Pointer(&len_aVal),
+	)
+}
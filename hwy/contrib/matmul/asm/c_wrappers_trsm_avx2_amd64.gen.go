@@ -0,0 +1,104 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// TrsmLNCAVX2F32 computes TrsmLN using AVX2 SIMD assembly.
+func TrsmLNCAVX2F32(l, b []float32, n, nrhs int) {
+	var p_l unsafe.Pointer
+	if len(l) > 0 {
+		p_l = unsafe.Pointer(&l[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	nVal := int64(n)
+	nrhsVal := int64(nrhs)
+	len_lVal := int64(len(l))
+	len_bVal := int64(len(b))
+	trsmln_c_f32_avx2(
+		p_l,
+		p_b,
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&nrhsVal),
+		unsafe.Pointer(&len_lVal),
+		unsafe.Pointer(&len_bVal),
+	)
+}
+
+// TrsmLNCAVX2F64 computes TrsmLN using AVX2 SIMD assembly.
+func TrsmLNCAVX2F64(l, b []float64, n, nrhs int) {
+	var p_l unsafe.Pointer
+	if len(l) > 0 {
+		p_l = unsafe.Pointer(&l[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	nVal := int64(n)
+	nrhsVal := int64(nrhs)
+	len_lVal := int64(len(l))
+	len_bVal := int64(len(b))
+	trsmln_c_f64_avx2(
+		p_l,
+		p_b,
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&nrhsVal),
+		unsafe.Pointer(&len_lVal),
+		unsafe.Pointer(&len_bVal),
+	)
+}
+
+// TrsmLTCAVX2F32 computes TrsmLT using AVX2 SIMD assembly.
+func TrsmLTCAVX2F32(l, b []float32, n, nrhs int) {
+	var p_l unsafe.Pointer
+	if len(l) > 0 {
+		p_l = unsafe.Pointer(&l[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	nVal := int64(n)
+	nrhsVal := int64(nrhs)
+	len_lVal := int64(len(l))
+	len_bVal := int64(len(b))
+	trsmlt_c_f32_avx2(
+		p_l,
+		p_b,
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&nrhsVal),
+		unsafe.Pointer(&len_lVal),
+		unsafe.Pointer(&len_bVal),
+	)
+}
+
+// TrsmLTCAVX2F64 computes TrsmLT using AVX2 SIMD assembly.
+func TrsmLTCAVX2F64(l, b []float64, n, nrhs int) {
+	var p_l unsafe.Pointer
+	if len(l) > 0 {
+		p_l = unsafe.Pointer(&l[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	nVal := int64(n)
+	nrhsVal := int64(nrhs)
+	len_lVal := int64(len(l))
+	len_bVal := int64(len(b))
+	trsmlt_c_f64_avx2(
+		p_l,
+		p_b,
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&nrhsVal),
+		unsafe.Pointer(&len_lVal),
+		unsafe.Pointer(&len_bVal),
+	)
+}
@@ -124,6 +124,20 @@ func BlockMulAddRegBlocked[T hwy.Floats](aT []T, b []T, c []T, blockDim int) {
 
 func init() {
 	initBlockkernelAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "BlockMulAdd", Vars: []any{&BlockMulAddFloat16, &BlockMulAddBFloat16, &BlockMulAddFloat32, &BlockMulAddFloat64}},
+			{Name: "BlockMulAdd2", Vars: []any{&BlockMulAdd2Float16, &BlockMulAdd2BFloat16, &BlockMulAdd2Float32, &BlockMulAdd2Float64}},
+			{Name: "BlockMulAdd4", Vars: []any{&BlockMulAdd4Float16, &BlockMulAdd4BFloat16, &BlockMulAdd4Float32, &BlockMulAdd4Float64}},
+			{Name: "BlockMulAddRegBlocked", Vars: []any{&BlockMulAddRegBlockedFloat16, &BlockMulAddRegBlockedBFloat16, &BlockMulAddRegBlockedFloat32, &BlockMulAddRegBlockedFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initBlockkernelAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initBlockkernelAVX2},
+			{Name: "fallback", Supported: true, Init: initBlockkernelFallback},
+		},
+	})
 }
 
 func initBlockkernelAll() {
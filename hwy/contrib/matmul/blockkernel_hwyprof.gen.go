@@ -0,0 +1,132 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "BlockMulAdd", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := BlockMulAddFloat16; hwyImpl != nil {
+			BlockMulAddFloat16 = func(aT []hwy.Float16, b []hwy.Float16, c []hwy.Float16, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockMulAddBFloat16; hwyImpl != nil {
+			BlockMulAddBFloat16 = func(aT []hwy.BFloat16, b []hwy.BFloat16, c []hwy.BFloat16, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockMulAddFloat32; hwyImpl != nil {
+			BlockMulAddFloat32 = func(aT []float32, b []float32, c []float32, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockMulAddFloat64; hwyImpl != nil {
+			BlockMulAddFloat64 = func(aT []float64, b []float64, c []float64, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "BlockMulAdd2", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := BlockMulAdd2Float16; hwyImpl != nil {
+			BlockMulAdd2Float16 = func(aT []hwy.Float16, b []hwy.Float16, c []hwy.Float16, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockMulAdd2BFloat16; hwyImpl != nil {
+			BlockMulAdd2BFloat16 = func(aT []hwy.BFloat16, b []hwy.BFloat16, c []hwy.BFloat16, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockMulAdd2Float32; hwyImpl != nil {
+			BlockMulAdd2Float32 = func(aT []float32, b []float32, c []float32, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockMulAdd2Float64; hwyImpl != nil {
+			BlockMulAdd2Float64 = func(aT []float64, b []float64, c []float64, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "BlockMulAdd4", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := BlockMulAdd4Float16; hwyImpl != nil {
+			BlockMulAdd4Float16 = func(aT []hwy.Float16, b []hwy.Float16, c []hwy.Float16, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockMulAdd4BFloat16; hwyImpl != nil {
+			BlockMulAdd4BFloat16 = func(aT []hwy.BFloat16, b []hwy.BFloat16, c []hwy.BFloat16, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockMulAdd4Float32; hwyImpl != nil {
+			BlockMulAdd4Float32 = func(aT []float32, b []float32, c []float32, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockMulAdd4Float64; hwyImpl != nil {
+			BlockMulAdd4Float64 = func(aT []float64, b []float64, c []float64, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "BlockMulAddRegBlocked", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := BlockMulAddRegBlockedFloat16; hwyImpl != nil {
+			BlockMulAddRegBlockedFloat16 = func(aT []hwy.Float16, b []hwy.Float16, c []hwy.Float16, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockMulAddRegBlockedBFloat16; hwyImpl != nil {
+			BlockMulAddRegBlockedBFloat16 = func(aT []hwy.BFloat16, b []hwy.BFloat16, c []hwy.BFloat16, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockMulAddRegBlockedFloat32; hwyImpl != nil {
+			BlockMulAddRegBlockedFloat32 = func(aT []float32, b []float32, c []float32, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockMulAddRegBlockedFloat64; hwyImpl != nil {
+			BlockMulAddRegBlockedFloat64 = func(aT []float64, b []float64, c []float64, blockDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(aT, b, c, blockDim)
+				hwyCounter.Done(hwyStart, len(aT), hwy.SliceBytes(aT)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+	})
+}
@@ -0,0 +1,391 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package matmul
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// workspaceAllocs pins the fallback kernels that allocate scratch buffers
+// sized by their inputs. The scratch layout is shared with the assembly
+// kernels, so the counts are checked to catch regressions rather than
+// required to be zero.
+var workspaceAllocs = map[string]float64{
+	"BaseFusedInt8MatMul_fallback":           2,
+	"BaseFusedInt8MatMulGELU_fallback":       2,
+	"BaseFusedInt8MatMulGELUApprox_fallback": 2,
+	"BaseFusedInt8MatMulReLU_fallback":       2,
+	"BaseFusedInt8MatMulSiLU_fallback":       2,
+	"BaseFusedInt4MatMul_fallback":           2,
+	"BaseFusedInt4MatMulGELU_fallback":       2,
+	"BaseFusedInt4MatMulGELUApprox_fallback": 2,
+	"BaseFusedInt4MatMulReLU_fallback":       2,
+	"BaseFusedInt4MatMulSiLU_fallback":       2,
+	"BaseFusedInt4MatMulSwiGLU_fallback":     4,
+	"BaseFusedNF4MatMul_fallback":            2,
+	"BaseFusedNF4MatMulGELU_fallback":        2,
+	"BaseFusedNF4MatMulGELUApprox_fallback":  2,
+	"BaseFusedNF4MatMulReLU_fallback":        2,
+	"BaseFusedNF4MatMulSiLU_fallback":        2,
+	"BaseFusedNF4MatMulSwiGLU_fallback":      4,
+	"BaseInt8x8MatMul_fallback":              1,
+	"BaseInt8x8MatMulPerAxis_fallback":       1,
+	"BasePackedMatMul_fallback":              2,
+	"BasePackedMatMul_fallback_Float64":      2,
+	"BasePackedMatMul_fallback_Float16":      2,
+	"BasePackedMatMul_fallback_BFloat16":     2,
+	// The half-precision transpose builds a fresh row slice per butterfly
+	// stage; hoisting it changes the NEON C translation of the same code.
+	"BaseTranspose2D_fallback_Float16":  16,
+	"BaseTranspose2D_fallback_BFloat16": 16,
+}
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		f16        = make([]hwy.Float16, allocTestLen)
+		bf16       = make([]hwy.BFloat16, allocTestLen)
+		f32        = make([]float32, allocTestLen)
+		f64        = make([]float64, allocTestLen)
+		i8         = make([]int8, allocTestLen)
+		u8         = make([]uint8, allocTestLen)
+		i32        = make([]int32, allocTestLen)
+		u8Scalar   = uint8(1)
+		f16Scalar  = hwy.NewFloat16(1)
+		bf16Scalar = hwy.NewBFloat16(1)
+		f32Scalar  = float32(1)
+		f64Scalar  = float64(1)
+		params     = CacheParams{Mr: 4, Nr: 32, Kc: 16, Mc: 16, Nc: 32}
+	)
+	// The half-precision TRSM kernels divide by the diagonal of L, so give
+	// them a unit matrix that the other kernels do not write to.
+	f16L := make([]hwy.Float16, allocTestDim*allocTestDim)
+	bf16L := make([]hwy.BFloat16, allocTestDim*allocTestDim)
+	for i := range allocTestDim {
+		f16L[i*allocTestDim+i] = hwy.NewFloat16(1)
+		bf16L[i*allocTestDim+i] = hwy.NewBFloat16(1)
+	}
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseBlockMulAdd_fallback_Float16", func() { BaseBlockMulAdd_fallback_Float16(f16, f16, f16, allocTestDim) }},
+		{"BaseBlockMulAdd_fallback_BFloat16", func() { BaseBlockMulAdd_fallback_BFloat16(bf16, bf16, bf16, allocTestDim) }},
+		{"BaseBlockMulAdd_fallback", func() { BaseBlockMulAdd_fallback(f32, f32, f32, allocTestDim) }},
+		{"BaseBlockMulAdd_fallback_Float64", func() { BaseBlockMulAdd_fallback_Float64(f64, f64, f64, allocTestDim) }},
+		{"BaseBlockMulAdd2_fallback_Float16", func() { BaseBlockMulAdd2_fallback_Float16(f16, f16, f16, allocTestDim) }},
+		{"BaseBlockMulAdd2_fallback_BFloat16", func() { BaseBlockMulAdd2_fallback_BFloat16(bf16, bf16, bf16, allocTestDim) }},
+		{"BaseBlockMulAdd2_fallback", func() { BaseBlockMulAdd2_fallback(f32, f32, f32, allocTestDim) }},
+		{"BaseBlockMulAdd2_fallback_Float64", func() { BaseBlockMulAdd2_fallback_Float64(f64, f64, f64, allocTestDim) }},
+		{"BaseBlockMulAdd4_fallback_Float16", func() { BaseBlockMulAdd4_fallback_Float16(f16, f16, f16, allocTestDim) }},
+		{"BaseBlockMulAdd4_fallback_BFloat16", func() { BaseBlockMulAdd4_fallback_BFloat16(bf16, bf16, bf16, allocTestDim) }},
+		{"BaseBlockMulAdd4_fallback", func() { BaseBlockMulAdd4_fallback(f32, f32, f32, allocTestDim) }},
+		{"BaseBlockMulAdd4_fallback_Float64", func() { BaseBlockMulAdd4_fallback_Float64(f64, f64, f64, allocTestDim) }},
+		{"BaseBlockMulAddRegBlocked_fallback_Float16", func() { BaseBlockMulAddRegBlocked_fallback_Float16(f16, f16, f16, allocTestDim) }},
+		{"BaseBlockMulAddRegBlocked_fallback_BFloat16", func() { BaseBlockMulAddRegBlocked_fallback_BFloat16(bf16, bf16, bf16, allocTestDim) }},
+		{"BaseBlockMulAddRegBlocked_fallback", func() { BaseBlockMulAddRegBlocked_fallback(f32, f32, f32, allocTestDim) }},
+		{"BaseBlockMulAddRegBlocked_fallback_Float64", func() { BaseBlockMulAddRegBlocked_fallback_Float64(f64, f64, f64, allocTestDim) }},
+		{"BaseMatMul_fallback_Float16", func() { BaseMatMul_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseMatMul_fallback_BFloat16", func() { BaseMatMul_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseMatMul_fallback", func() { BaseMatMul_fallback(f32, f32, f32, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseMatMul_fallback_Float64", func() { BaseMatMul_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseBlockedMatMul_fallback_Float16", func() { BaseBlockedMatMul_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseBlockedMatMul_fallback_BFloat16", func() {
+			BaseBlockedMatMul_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseBlockedMatMul_fallback", func() { BaseBlockedMatMul_fallback(f32, f32, f32, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseBlockedMatMul_fallback_Float64", func() { BaseBlockedMatMul_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseFusedInt8MatMulGELU_fallback", func() {
+			BaseFusedInt8MatMulGELU_fallback(f32, i8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedInt8MatMulGELUApprox_fallback", func() {
+			BaseFusedInt8MatMulGELUApprox_fallback(f32, i8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedInt8MatMulReLU_fallback", func() {
+			BaseFusedInt8MatMulReLU_fallback(f32, i8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedInt8MatMulSiLU_fallback", func() {
+			BaseFusedInt8MatMulSiLU_fallback(f32, i8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedInt8MatMul_fallback", func() {
+			BaseFusedInt8MatMul_fallback(f32, i8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedInt4MatMulGELU_fallback", func() {
+			BaseFusedInt4MatMulGELU_fallback(f32, u8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedInt4MatMulGELUApprox_fallback", func() {
+			BaseFusedInt4MatMulGELUApprox_fallback(f32, u8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedInt4MatMulReLU_fallback", func() {
+			BaseFusedInt4MatMulReLU_fallback(f32, u8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedInt4MatMulSiLU_fallback", func() {
+			BaseFusedInt4MatMulSiLU_fallback(f32, u8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedInt4MatMulSwiGLU_fallback", func() {
+			BaseFusedInt4MatMulSwiGLU_fallback(f32, u8, f32, u8, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedNF4MatMulGELU_fallback", func() {
+			BaseFusedNF4MatMulGELU_fallback(f32, u8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedNF4MatMulGELUApprox_fallback", func() {
+			BaseFusedNF4MatMulGELUApprox_fallback(f32, u8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedNF4MatMulReLU_fallback", func() {
+			BaseFusedNF4MatMulReLU_fallback(f32, u8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedNF4MatMulSiLU_fallback", func() {
+			BaseFusedNF4MatMulSiLU_fallback(f32, u8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedNF4MatMulSwiGLU_fallback", func() {
+			BaseFusedNF4MatMulSwiGLU_fallback(f32, u8, f32, u8, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedInt4MatMul_fallback", func() {
+			BaseFusedInt4MatMul_fallback(f32, u8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseFusedNF4MatMul_fallback", func() {
+			BaseFusedNF4MatMul_fallback(f32, u8, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseInt8x8MatMul_fallback", func() {
+			BaseInt8x8MatMul_fallback(i32, u8, u8, u8Scalar, u8Scalar, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseInt8x8MatMulPerAxis_fallback", func() {
+			BaseInt8x8MatMulPerAxis_fallback(i32, u8, u8, u8, u8, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseMatMulKLast_fallback_Float16", func() { BaseMatMulKLast_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseMatMulKLast_fallback_BFloat16", func() { BaseMatMulKLast_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseMatMulKLast_fallback", func() { BaseMatMulKLast_fallback(f32, f32, f32, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseMatMulKLast_fallback_Float64", func() { BaseMatMulKLast_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseMatMulKLastBlocked_fallback_Float16", func() {
+			BaseMatMulKLastBlocked_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseMatMulKLastBlocked_fallback_BFloat16", func() {
+			BaseMatMulKLastBlocked_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseMatMulKLastBlocked_fallback", func() { BaseMatMulKLastBlocked_fallback(f32, f32, f32, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseMatMulKLastBlocked_fallback_Float64", func() {
+			BaseMatMulKLastBlocked_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackedMatMul_fallback_Float16", func() { BasePackedMatMul_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BasePackedMatMul_fallback_BFloat16", func() { BasePackedMatMul_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BasePackedMatMul_fallback", func() { BasePackedMatMul_fallback(f32, f32, f32, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BasePackedMatMul_fallback_Float64", func() { BasePackedMatMul_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BasePackedMatMulStrip_fallback_Float16", func() {
+			BasePackedMatMulStrip_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, f16, f16, params)
+		}},
+		{"BasePackedMatMulStrip_fallback_BFloat16", func() {
+			BasePackedMatMulStrip_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, bf16, bf16, params)
+		}},
+		{"BasePackedMatMulStrip_fallback", func() {
+			BasePackedMatMulStrip_fallback(f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, f32, f32, params)
+		}},
+		{"BasePackedMatMulStrip_fallback_Float64", func() {
+			BasePackedMatMulStrip_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, f64, f64, params)
+		}},
+		{"BasePackedMatMulWithBuffers_fallback_Float16", func() {
+			BasePackedMatMulWithBuffers_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim, allocTestDim, f16, f16, params)
+		}},
+		{"BasePackedMatMulWithBuffers_fallback_BFloat16", func() {
+			BasePackedMatMulWithBuffers_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim, bf16, bf16, params)
+		}},
+		{"BasePackedMatMulWithBuffers_fallback", func() {
+			BasePackedMatMulWithBuffers_fallback(f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, f32, f32, params)
+		}},
+		{"BasePackedMatMulWithBuffers_fallback_Float64", func() {
+			BasePackedMatMulWithBuffers_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim, allocTestDim, f64, f64, params)
+		}},
+		{"BaseSkinnyMatMul_fallback_Float16", func() { BaseSkinnyMatMul_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseSkinnyMatMul_fallback_BFloat16", func() { BaseSkinnyMatMul_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseSkinnyMatMul_fallback", func() { BaseSkinnyMatMul_fallback(f32, f32, f32, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseSkinnyMatMul_fallback_Float64", func() { BaseSkinnyMatMul_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BasePackedMicroKernel_fallback_Float16", func() {
+			BasePackedMicroKernel_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackedMicroKernel_fallback_BFloat16", func() {
+			BasePackedMicroKernel_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackedMicroKernel_fallback", func() {
+			BasePackedMicroKernel_fallback(f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackedMicroKernel_fallback_Float64", func() {
+			BasePackedMicroKernel_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"basePackedMicroKernelGeneral_fallback_Float16", func() {
+			basePackedMicroKernelGeneral_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"basePackedMicroKernelGeneral_fallback_BFloat16", func() {
+			basePackedMicroKernelGeneral_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"basePackedMicroKernelGeneral_fallback", func() {
+			basePackedMicroKernelGeneral_fallback(f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"basePackedMicroKernelGeneral_fallback_Float64", func() {
+			basePackedMicroKernelGeneral_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackedMicroKernelPartial_fallback_Float16", func() {
+			BasePackedMicroKernelPartial_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackedMicroKernelPartial_fallback_BFloat16", func() {
+			BasePackedMicroKernelPartial_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackedMicroKernelPartial_fallback", func() {
+			BasePackedMicroKernelPartial_fallback(f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackedMicroKernelPartial_fallback_Float64", func() {
+			BasePackedMicroKernelPartial_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackedMicroKernel4x2_fallback_Float16", func() {
+			BasePackedMicroKernel4x2_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackedMicroKernel4x2_fallback_BFloat16", func() {
+			BasePackedMicroKernel4x2_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackedMicroKernel4x2_fallback", func() {
+			BasePackedMicroKernel4x2_fallback(f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackedMicroKernel4x2_fallback_Float64", func() {
+			BasePackedMicroKernel4x2_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseZeroSlice_fallback_Float16", func() { BaseZeroSlice_fallback_Float16(f16, allocTestDim) }},
+		{"BaseZeroSlice_fallback_BFloat16", func() { BaseZeroSlice_fallback_BFloat16(bf16, allocTestDim) }},
+		{"BaseZeroSlice_fallback", func() { BaseZeroSlice_fallback(f32, allocTestDim) }},
+		{"BaseZeroSlice_fallback_Float64", func() { BaseZeroSlice_fallback_Float64(f64, allocTestDim) }},
+		{"BasePackLHS_fallback_Float16", func() {
+			BasePackLHS_fallback_Float16(f16, f16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackLHS_fallback_BFloat16", func() {
+			BasePackLHS_fallback_BFloat16(bf16, bf16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackLHS_fallback", func() {
+			BasePackLHS_fallback(f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackLHS_fallback_Float64", func() {
+			BasePackLHS_fallback_Float64(f64, f64, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackLHSVec_fallback_Float16", func() {
+			BasePackLHSVec_fallback_Float16(f16, f16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackLHSVec_fallback_BFloat16", func() {
+			BasePackLHSVec_fallback_BFloat16(bf16, bf16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackLHSVec_fallback", func() {
+			BasePackLHSVec_fallback(f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackLHSVec_fallback_Float64", func() {
+			BasePackLHSVec_fallback_Float64(f64, f64, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackRHSVec_fallback_Float16", func() {
+			BasePackRHSVec_fallback_Float16(f16, f16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackRHSVec_fallback_BFloat16", func() {
+			BasePackRHSVec_fallback_BFloat16(bf16, bf16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackRHSVec_fallback", func() {
+			BasePackRHSVec_fallback(f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BasePackRHSVec_fallback_Float64", func() {
+			BasePackRHSVec_fallback_Float64(f64, f64, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseApplyPackedOutput_fallback_Float16", func() {
+			BaseApplyPackedOutput_fallback_Float16(f16, f16, f16Scalar, f16Scalar, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseApplyPackedOutput_fallback_BFloat16", func() {
+			BaseApplyPackedOutput_fallback_BFloat16(bf16, bf16, bf16Scalar, bf16Scalar, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseApplyPackedOutput_fallback", func() {
+			BaseApplyPackedOutput_fallback(f32, f32, f32Scalar, f32Scalar, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseApplyPackedOutput_fallback_Float64", func() {
+			BaseApplyPackedOutput_fallback_Float64(f64, f64, f64Scalar, f64Scalar, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseApplyPackedOutputAccum_fallback_Float16", func() {
+			BaseApplyPackedOutputAccum_fallback_Float16(f16, f16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseApplyPackedOutputAccum_fallback_BFloat16", func() {
+			BaseApplyPackedOutputAccum_fallback_BFloat16(bf16, bf16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseApplyPackedOutputAccum_fallback", func() {
+			BaseApplyPackedOutputAccum_fallback(f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseApplyPackedOutputAccum_fallback_Float64", func() {
+			BaseApplyPackedOutputAccum_fallback_Float64(f64, f64, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseApplyPackedOutputSimple_fallback_Float16", func() {
+			BaseApplyPackedOutputSimple_fallback_Float16(f16, f16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseApplyPackedOutputSimple_fallback_BFloat16", func() {
+			BaseApplyPackedOutputSimple_fallback_BFloat16(bf16, bf16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseApplyPackedOutputSimple_fallback", func() {
+			BaseApplyPackedOutputSimple_fallback(f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseApplyPackedOutputSimple_fallback_Float64", func() {
+			BaseApplyPackedOutputSimple_fallback_Float64(f64, f64, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseSyrkLN_fallback_Float16", func() { BaseSyrkLN_fallback_Float16(f16, allocTestDim, f16, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseSyrkLN_fallback_BFloat16", func() {
+			BaseSyrkLN_fallback_BFloat16(bf16, allocTestDim, bf16, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseSyrkLN_fallback", func() { BaseSyrkLN_fallback(f32, allocTestDim, f32, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseSyrkLN_fallback_Float64", func() { BaseSyrkLN_fallback_Float64(f64, allocTestDim, f64, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseTranspose2D_fallback_Float16", func() { BaseTranspose2D_fallback_Float16(f16, allocTestDim, allocTestDim, f16) }},
+		{"BaseTranspose2D_fallback_BFloat16", func() { BaseTranspose2D_fallback_BFloat16(bf16, allocTestDim, allocTestDim, bf16) }},
+		{"BaseTranspose2D_fallback", func() { BaseTranspose2D_fallback(f32, allocTestDim, allocTestDim, f32) }},
+		{"BaseTranspose2D_fallback_Float64", func() { BaseTranspose2D_fallback_Float64(f64, allocTestDim, allocTestDim, f64) }},
+		{"BaseTranspose2DStrided_fallback_Float16", func() {
+			BaseTranspose2DStrided_fallback_Float16(f16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, f16)
+		}},
+		{"BaseTranspose2DStrided_fallback_BFloat16", func() {
+			BaseTranspose2DStrided_fallback_BFloat16(bf16, allocTestDim, allocTestDim, allocTestDim, allocTestDim, bf16)
+		}},
+		{"BaseTranspose2DStrided_fallback", func() {
+			BaseTranspose2DStrided_fallback(f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim, f32)
+		}},
+		{"BaseTranspose2DStrided_fallback_Float64", func() {
+			BaseTranspose2DStrided_fallback_Float64(f64, allocTestDim, allocTestDim, allocTestDim, allocTestDim, f64)
+		}},
+		{"BaseTrsmLN_fallback_Float16", func() { BaseTrsmLN_fallback_Float16(f16L, f16, allocTestDim, allocTestDim) }},
+		{"BaseTrsmLN_fallback_BFloat16", func() { BaseTrsmLN_fallback_BFloat16(bf16L, bf16, allocTestDim, allocTestDim) }},
+		{"BaseTrsmLN_fallback", func() { BaseTrsmLN_fallback(f32, f32, allocTestDim, allocTestDim) }},
+		{"BaseTrsmLN_fallback_Float64", func() { BaseTrsmLN_fallback_Float64(f64, f64, allocTestDim, allocTestDim) }},
+		{"BaseTrsmLT_fallback_Float16", func() { BaseTrsmLT_fallback_Float16(f16L, f16, allocTestDim, allocTestDim) }},
+		{"BaseTrsmLT_fallback_BFloat16", func() { BaseTrsmLT_fallback_BFloat16(bf16L, bf16, allocTestDim, allocTestDim) }},
+		{"BaseTrsmLT_fallback", func() { BaseTrsmLT_fallback(f32, f32, allocTestDim, allocTestDim) }},
+		{"BaseTrsmLT_fallback_Float64", func() { BaseTrsmLT_fallback_Float64(f64, f64, allocTestDim, allocTestDim) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		want := workspaceAllocs[k.name]
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != want {
+			t.Errorf("%s: %v allocs/op, want %v", k.name, allocs, want)
+		}
+	}
+}
@@ -17,6 +17,20 @@ var FusedInt8MatMulSiLU func(input []float32, weights []int8, scales []float32,
 
 func init() {
 	initFusedint8actmatmulAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FusedInt8MatMulGELU", Vars: []any{&FusedInt8MatMulGELU}},
+			{Name: "FusedInt8MatMulGELUApprox", Vars: []any{&FusedInt8MatMulGELUApprox}},
+			{Name: "FusedInt8MatMulReLU", Vars: []any{&FusedInt8MatMulReLU}},
+			{Name: "FusedInt8MatMulSiLU", Vars: []any{&FusedInt8MatMulSiLU}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initFusedint8actmatmulAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initFusedint8actmatmulAVX2},
+			{Name: "fallback", Supported: true, Init: initFusedint8actmatmulFallback},
+		},
+	})
 }
 
 func initFusedint8actmatmulAll() {
@@ -0,0 +1,48 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "FusedInt8MatMulGELU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedInt8MatMulGELU; hwyImpl != nil {
+			FusedInt8MatMulGELU = func(input []float32, weights []int8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, weights, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(weights)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedInt8MatMulGELUApprox", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedInt8MatMulGELUApprox; hwyImpl != nil {
+			FusedInt8MatMulGELUApprox = func(input []float32, weights []int8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, weights, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(weights)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedInt8MatMulReLU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedInt8MatMulReLU; hwyImpl != nil {
+			FusedInt8MatMulReLU = func(input []float32, weights []int8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, weights, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(weights)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedInt8MatMulSiLU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedInt8MatMulSiLU; hwyImpl != nil {
+			FusedInt8MatMulSiLU = func(input []float32, weights []int8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, weights, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(weights)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
@@ -4,6 +4,10 @@
 
 package matmul
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var FusedInt8MatMulGELU func(input []float32, weights []int8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int)
 var FusedInt8MatMulGELUApprox func(input []float32, weights []int8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int)
 var FusedInt8MatMulReLU func(input []float32, weights []int8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int)
@@ -11,6 +15,18 @@ var FusedInt8MatMulSiLU func(input []float32, weights []int8, scales []float32,
 
 func init() {
 	initFusedint8actmatmulAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FusedInt8MatMulGELU", Vars: []any{&FusedInt8MatMulGELU}},
+			{Name: "FusedInt8MatMulGELUApprox", Vars: []any{&FusedInt8MatMulGELUApprox}},
+			{Name: "FusedInt8MatMulReLU", Vars: []any{&FusedInt8MatMulReLU}},
+			{Name: "FusedInt8MatMulSiLU", Vars: []any{&FusedInt8MatMulSiLU}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initFusedint8actmatmulFallback},
+		},
+	})
 }
 
 func initFusedint8actmatmulAll() {
@@ -14,6 +14,17 @@ var FusedInt8MatMul func(input []float32, weights []int8, scales []float32, bias
 
 func init() {
 	initFusedint8matmulAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FusedInt8MatMul", Vars: []any{&FusedInt8MatMul}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initFusedint8matmulAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initFusedint8matmulAVX2},
+			{Name: "fallback", Supported: true, Init: initFusedint8matmulFallback},
+		},
+	})
 }
 
 func initFusedint8matmulAll() {
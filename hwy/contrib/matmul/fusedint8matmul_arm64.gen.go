@@ -12,6 +12,16 @@ var FusedInt8MatMul func(input []float32, weights []int8, scales []float32, bias
 
 func init() {
 	initFusedint8matmulAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FusedInt8MatMul", Vars: []any{&FusedInt8MatMul}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initFusedint8matmulNEONAsm},
+			{Name: "fallback", Supported: true, Init: initFusedint8matmulFallback},
+		},
+	})
 }
 
 func initFusedint8matmulAll() {
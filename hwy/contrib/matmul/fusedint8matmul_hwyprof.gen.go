@@ -0,0 +1,21 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "FusedInt8MatMul", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedInt8MatMul; hwyImpl != nil {
+			FusedInt8MatMul = func(input []float32, weights []int8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, weights, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(weights)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
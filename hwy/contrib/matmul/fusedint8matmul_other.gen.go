@@ -4,10 +4,23 @@
 
 package matmul
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var FusedInt8MatMul func(input []float32, weights []int8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int)
 
 func init() {
 	initFusedint8matmulAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FusedInt8MatMul", Vars: []any{&FusedInt8MatMul}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initFusedint8matmulFallback},
+		},
+	})
 }
 
 func initFusedint8matmulAll() {
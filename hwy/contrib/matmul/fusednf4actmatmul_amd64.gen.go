@@ -23,6 +23,26 @@ var FusedNF4MatMulSwiGLU func(input []float32, gatePacked []uint8, gateScales []
 
 func init() {
 	initFusednf4actmatmulAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FusedInt4MatMulGELU", Vars: []any{&FusedInt4MatMulGELU}},
+			{Name: "FusedInt4MatMulGELUApprox", Vars: []any{&FusedInt4MatMulGELUApprox}},
+			{Name: "FusedInt4MatMulReLU", Vars: []any{&FusedInt4MatMulReLU}},
+			{Name: "FusedInt4MatMulSiLU", Vars: []any{&FusedInt4MatMulSiLU}},
+			{Name: "FusedInt4MatMulSwiGLU", Vars: []any{&FusedInt4MatMulSwiGLU}},
+			{Name: "FusedNF4MatMulGELU", Vars: []any{&FusedNF4MatMulGELU}},
+			{Name: "FusedNF4MatMulGELUApprox", Vars: []any{&FusedNF4MatMulGELUApprox}},
+			{Name: "FusedNF4MatMulReLU", Vars: []any{&FusedNF4MatMulReLU}},
+			{Name: "FusedNF4MatMulSiLU", Vars: []any{&FusedNF4MatMulSiLU}},
+			{Name: "FusedNF4MatMulSwiGLU", Vars: []any{&FusedNF4MatMulSwiGLU}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initFusednf4actmatmulAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initFusednf4actmatmulAVX2},
+			{Name: "fallback", Supported: true, Init: initFusednf4actmatmulFallback},
+		},
+	})
 }
 
 func initFusednf4actmatmulAll() {
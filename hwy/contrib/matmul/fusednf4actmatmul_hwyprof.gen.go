@@ -0,0 +1,102 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "FusedInt4MatMulGELU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedInt4MatMulGELU; hwyImpl != nil {
+			FusedInt4MatMulGELU = func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, packed, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(packed)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedInt4MatMulGELUApprox", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedInt4MatMulGELUApprox; hwyImpl != nil {
+			FusedInt4MatMulGELUApprox = func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, packed, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(packed)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedInt4MatMulReLU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedInt4MatMulReLU; hwyImpl != nil {
+			FusedInt4MatMulReLU = func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, packed, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(packed)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedInt4MatMulSiLU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedInt4MatMulSiLU; hwyImpl != nil {
+			FusedInt4MatMulSiLU = func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, packed, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(packed)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedInt4MatMulSwiGLU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedInt4MatMulSwiGLU; hwyImpl != nil {
+			FusedInt4MatMulSwiGLU = func(input []float32, gatePacked []uint8, gateScales []float32, upPacked []uint8, upScales []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, gatePacked, gateScales, upPacked, upScales, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(gatePacked)+hwy.SliceBytes(gateScales)+hwy.SliceBytes(upPacked)+hwy.SliceBytes(upScales)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedNF4MatMulGELU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedNF4MatMulGELU; hwyImpl != nil {
+			FusedNF4MatMulGELU = func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, packed, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(packed)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedNF4MatMulGELUApprox", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedNF4MatMulGELUApprox; hwyImpl != nil {
+			FusedNF4MatMulGELUApprox = func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, packed, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(packed)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedNF4MatMulReLU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedNF4MatMulReLU; hwyImpl != nil {
+			FusedNF4MatMulReLU = func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, packed, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(packed)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedNF4MatMulSiLU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedNF4MatMulSiLU; hwyImpl != nil {
+			FusedNF4MatMulSiLU = func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, packed, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(packed)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedNF4MatMulSwiGLU", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedNF4MatMulSwiGLU; hwyImpl != nil {
+			FusedNF4MatMulSwiGLU = func(input []float32, gatePacked []uint8, gateScales []float32, upPacked []uint8, upScales []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, gatePacked, gateScales, upPacked, upScales, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(gatePacked)+hwy.SliceBytes(gateScales)+hwy.SliceBytes(upPacked)+hwy.SliceBytes(upScales)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
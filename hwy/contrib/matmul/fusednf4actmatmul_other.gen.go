@@ -4,6 +4,10 @@
 
 package matmul
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var FusedInt4MatMulGELU func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int)
 var FusedInt4MatMulGELUApprox func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int)
 var FusedInt4MatMulReLU func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int)
@@ -17,6 +21,24 @@ var FusedNF4MatMulSwiGLU func(input []float32, gatePacked []uint8, gateScales []
 
 func init() {
 	initFusednf4actmatmulAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FusedInt4MatMulGELU", Vars: []any{&FusedInt4MatMulGELU}},
+			{Name: "FusedInt4MatMulGELUApprox", Vars: []any{&FusedInt4MatMulGELUApprox}},
+			{Name: "FusedInt4MatMulReLU", Vars: []any{&FusedInt4MatMulReLU}},
+			{Name: "FusedInt4MatMulSiLU", Vars: []any{&FusedInt4MatMulSiLU}},
+			{Name: "FusedInt4MatMulSwiGLU", Vars: []any{&FusedInt4MatMulSwiGLU}},
+			{Name: "FusedNF4MatMulGELU", Vars: []any{&FusedNF4MatMulGELU}},
+			{Name: "FusedNF4MatMulGELUApprox", Vars: []any{&FusedNF4MatMulGELUApprox}},
+			{Name: "FusedNF4MatMulReLU", Vars: []any{&FusedNF4MatMulReLU}},
+			{Name: "FusedNF4MatMulSiLU", Vars: []any{&FusedNF4MatMulSiLU}},
+			{Name: "FusedNF4MatMulSwiGLU", Vars: []any{&FusedNF4MatMulSwiGLU}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initFusednf4actmatmulFallback},
+		},
+	})
 }
 
 func initFusednf4actmatmulAll() {
@@ -12,6 +12,16 @@ var Int8x8MatMul func(output []int32, a []uint8, b []uint8, aZP uint8, bZP uint8
 
 func init() {
 	initInt8x8matmulAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Int8x8MatMul", Vars: []any{&Int8x8MatMul}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initInt8x8matmulNEONAsm},
+			{Name: "fallback", Supported: true, Init: initInt8x8matmulFallback},
+		},
+	})
 }
 
 func initInt8x8matmulAll() {
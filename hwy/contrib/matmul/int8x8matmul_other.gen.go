@@ -4,10 +4,23 @@
 
 package matmul
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var Int8x8MatMul func(output []int32, a []uint8, b []uint8, aZP uint8, bZP uint8, M int, K int, N int)
 
 func init() {
 	initInt8x8matmulAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Int8x8MatMul", Vars: []any{&Int8x8MatMul}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initInt8x8matmulFallback},
+		},
+	})
 }
 
 func initInt8x8matmulAll() {
@@ -14,6 +14,17 @@ var Int8x8MatMulPerAxis func(output []int32, a []uint8, b []uint8, aZP []uint8,
 
 func init() {
 	initInt8x8matmulperaxisAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Int8x8MatMulPerAxis", Vars: []any{&Int8x8MatMulPerAxis}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initInt8x8matmulperaxisAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initInt8x8matmulperaxisAVX2},
+			{Name: "fallback", Supported: true, Init: initInt8x8matmulperaxisFallback},
+		},
+	})
 }
 
 func initInt8x8matmulperaxisAll() {
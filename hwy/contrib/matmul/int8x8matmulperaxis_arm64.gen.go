@@ -12,6 +12,16 @@ var Int8x8MatMulPerAxis func(output []int32, a []uint8, b []uint8, aZP []uint8,
 
 func init() {
 	initInt8x8matmulperaxisAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Int8x8MatMulPerAxis", Vars: []any{&Int8x8MatMulPerAxis}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initInt8x8matmulperaxisNEONAsm},
+			{Name: "fallback", Supported: true, Init: initInt8x8matmulperaxisFallback},
+		},
+	})
 }
 
 func initInt8x8matmulperaxisAll() {
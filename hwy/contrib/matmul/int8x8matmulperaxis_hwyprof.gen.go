@@ -0,0 +1,21 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "Int8x8MatMulPerAxis", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Int8x8MatMulPerAxis; hwyImpl != nil {
+			Int8x8MatMulPerAxis = func(output []int32, a []uint8, b []uint8, aZP []uint8, bZP []uint8, M int, K int, N int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(output, a, b, aZP, bZP, M, K, N)
+				hwyCounter.Done(hwyStart, len(output), hwy.SliceBytes(output)+hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(aZP)+hwy.SliceBytes(bZP))
+			}
+		}
+	})
+}
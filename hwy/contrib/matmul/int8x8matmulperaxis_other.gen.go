@@ -4,10 +4,23 @@
 
 package matmul
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var Int8x8MatMulPerAxis func(output []int32, a []uint8, b []uint8, aZP []uint8, bZP []uint8, M int, K int, N int)
 
 func init() {
 	initInt8x8matmulperaxisAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Int8x8MatMulPerAxis", Vars: []any{&Int8x8MatMulPerAxis}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initInt8x8matmulperaxisFallback},
+		},
+	})
 }
 
 func initInt8x8matmulperaxisAll() {
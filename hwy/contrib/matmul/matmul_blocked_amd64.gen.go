@@ -45,6 +45,17 @@ func BlockedMatMul[T hwy.Floats](a []T, b []T, c []T, m int, n int, k int) {
 
 func init() {
 	initMatmul_blockedAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "BlockedMatMul", Vars: []any{&BlockedMatMulFloat16, &BlockedMatMulBFloat16, &BlockedMatMulFloat32, &BlockedMatMulFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initMatmul_blockedAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initMatmul_blockedAVX2},
+			{Name: "fallback", Supported: true, Init: initMatmul_blockedFallback},
+		},
+	})
 }
 
 func initMatmul_blockedAll() {
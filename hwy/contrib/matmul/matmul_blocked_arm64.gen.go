@@ -43,6 +43,16 @@ func BlockedMatMul[T hwy.Floats](a []T, b []T, c []T, m int, n int, k int) {
 
 func init() {
 	initMatmul_blockedAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "BlockedMatMul", Vars: []any{&BlockedMatMulFloat16, &BlockedMatMulBFloat16, &BlockedMatMulFloat32, &BlockedMatMulFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initMatmul_blockedNEONAsm},
+			{Name: "fallback", Supported: true, Init: initMatmul_blockedFallback},
+		},
+	})
 }
 
 func initMatmul_blockedAll() {
@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "BlockedMatMul", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := BlockedMatMulFloat16; hwyImpl != nil {
+			BlockedMatMulFloat16 = func(a []hwy.Float16, b []hwy.Float16, c []hwy.Float16, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockedMatMulBFloat16; hwyImpl != nil {
+			BlockedMatMulBFloat16 = func(a []hwy.BFloat16, b []hwy.BFloat16, c []hwy.BFloat16, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockedMatMulFloat32; hwyImpl != nil {
+			BlockedMatMulFloat32 = func(a []float32, b []float32, c []float32, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := BlockedMatMulFloat64; hwyImpl != nil {
+			BlockedMatMulFloat64 = func(a []float64, b []float64, c []float64, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+	})
+}
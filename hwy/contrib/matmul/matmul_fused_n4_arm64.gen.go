@@ -13,6 +13,17 @@ var FusedNF4MatMul func(input []float32, packed []uint8, scales []float32, bias
 
 func init() {
 	initMatmul_fused_n4All()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FusedInt4MatMul", Vars: []any{&FusedInt4MatMul}},
+			{Name: "FusedNF4MatMul", Vars: []any{&FusedNF4MatMul}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initMatmul_fused_n4NEONAsm},
+			{Name: "fallback", Supported: true, Init: initMatmul_fused_n4Fallback},
+		},
+	})
 }
 
 func initMatmul_fused_n4All() {
@@ -0,0 +1,30 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "FusedInt4MatMul", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedInt4MatMul; hwyImpl != nil {
+			FusedInt4MatMul = func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, packed, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(packed)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "FusedNF4MatMul", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FusedNF4MatMul; hwyImpl != nil {
+			FusedNF4MatMul = func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, packed, scales, bias, output, M, K, N, groupSize)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(packed)+hwy.SliceBytes(scales)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
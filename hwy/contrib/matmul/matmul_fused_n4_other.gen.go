@@ -4,11 +4,25 @@
 
 package matmul
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var FusedInt4MatMul func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int)
 var FusedNF4MatMul func(input []float32, packed []uint8, scales []float32, bias []float32, output []float32, M int, K int, N int, groupSize int)
 
 func init() {
 	initMatmul_fused_n4All()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FusedInt4MatMul", Vars: []any{&FusedInt4MatMul}},
+			{Name: "FusedNF4MatMul", Vars: []any{&FusedNF4MatMul}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initMatmul_fused_n4Fallback},
+		},
+	})
 }
 
 func initMatmul_fused_n4All() {
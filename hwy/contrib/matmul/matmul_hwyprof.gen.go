@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "MatMul", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MatMulFloat16; hwyImpl != nil {
+			MatMulFloat16 = func(a []hwy.Float16, b []hwy.Float16, c []hwy.Float16, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := MatMulBFloat16; hwyImpl != nil {
+			MatMulBFloat16 = func(a []hwy.BFloat16, b []hwy.BFloat16, c []hwy.BFloat16, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := MatMulFloat32; hwyImpl != nil {
+			MatMulFloat32 = func(a []float32, b []float32, c []float32, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := MatMulFloat64; hwyImpl != nil {
+			MatMulFloat64 = func(a []float64, b []float64, c []float64, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+	})
+}
@@ -79,6 +79,17 @@ func MatMulKLastBlocked[T hwy.Floats](a []T, b []T, c []T, m int, n int, k int)
 
 func init() {
 	initMatmul_klastAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "MatMulKLast", Vars: []any{&MatMulKLastFloat16, &MatMulKLastBFloat16, &MatMulKLastFloat32, &MatMulKLastFloat64}},
+			{Name: "MatMulKLastBlocked", Vars: []any{&MatMulKLastBlockedFloat16, &MatMulKLastBlockedBFloat16, &MatMulKLastBlockedFloat32, &MatMulKLastBlockedFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initMatmul_klastNEONAsm},
+			{Name: "fallback", Supported: true, Init: initMatmul_klastFallback},
+		},
+	})
 }
 
 func initMatmul_klastAll() {
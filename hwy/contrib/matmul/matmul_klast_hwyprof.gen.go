@@ -0,0 +1,72 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "MatMulKLast", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MatMulKLastFloat16; hwyImpl != nil {
+			MatMulKLastFloat16 = func(a []hwy.Float16, b []hwy.Float16, c []hwy.Float16, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := MatMulKLastBFloat16; hwyImpl != nil {
+			MatMulKLastBFloat16 = func(a []hwy.BFloat16, b []hwy.BFloat16, c []hwy.BFloat16, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := MatMulKLastFloat32; hwyImpl != nil {
+			MatMulKLastFloat32 = func(a []float32, b []float32, c []float32, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := MatMulKLastFloat64; hwyImpl != nil {
+			MatMulKLastFloat64 = func(a []float64, b []float64, c []float64, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "MatMulKLastBlocked", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MatMulKLastBlockedFloat16; hwyImpl != nil {
+			MatMulKLastBlockedFloat16 = func(a []hwy.Float16, b []hwy.Float16, c []hwy.Float16, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := MatMulKLastBlockedBFloat16; hwyImpl != nil {
+			MatMulKLastBlockedBFloat16 = func(a []hwy.BFloat16, b []hwy.BFloat16, c []hwy.BFloat16, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := MatMulKLastBlockedFloat32; hwyImpl != nil {
+			MatMulKLastBlockedFloat32 = func(a []float32, b []float32, c []float32, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := MatMulKLastBlockedFloat64; hwyImpl != nil {
+			MatMulKLastBlockedFloat64 = func(a []float64, b []float64, c []float64, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+	})
+}
@@ -47,6 +47,15 @@ func MatMul[T hwy.Floats](a []T, b []T, c []T, m int, n int, k int) {
 
 func init() {
 	initMatmulAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "MatMul", Vars: []any{&MatMulFloat16, &MatMulBFloat16, &MatMulFloat32, &MatMulFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initMatmulFallback},
+		},
+	})
 }
 
 func initMatmulAll() {
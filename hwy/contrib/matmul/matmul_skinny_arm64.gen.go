@@ -45,6 +45,16 @@ func SkinnyMatMul[T hwy.Floats](a []T, b []T, c []T, m int, n int, k int) {
 
 func init() {
 	initMatmul_skinnyAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "SkinnyMatMul", Vars: []any{&SkinnyMatMulFloat16, &SkinnyMatMulBFloat16, &SkinnyMatMulFloat32, &SkinnyMatMulFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initMatmul_skinnyNEONAsm},
+			{Name: "fallback", Supported: true, Init: initMatmul_skinnyFallback},
+		},
+	})
 }
 
 func initMatmul_skinnyAll() {
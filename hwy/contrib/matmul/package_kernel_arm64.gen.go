@@ -103,6 +103,18 @@ func PackedMicroKernelPartial[T hwy.Floats](packedA []T, packedB []T, c []T, n i
 
 func init() {
 	initPackage_kernelAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "PackedMicroKernel", Vars: []any{&PackedMicroKernelFloat16, &PackedMicroKernelBFloat16, &PackedMicroKernelFloat32, &PackedMicroKernelFloat64}},
+			{Name: "packedMicroKernelGeneral", Vars: []any{&packedMicroKernelGeneralFloat16, &packedMicroKernelGeneralBFloat16, &packedMicroKernelGeneralFloat32, &packedMicroKernelGeneralFloat64}},
+			{Name: "PackedMicroKernelPartial", Vars: []any{&PackedMicroKernelPartialFloat16, &PackedMicroKernelPartialBFloat16, &PackedMicroKernelPartialFloat32, &PackedMicroKernelPartialFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initPackage_kernelNEONAsm},
+			{Name: "fallback", Supported: true, Init: initPackage_kernelFallback},
+		},
+	})
 }
 
 func initPackage_kernelAll() {
@@ -0,0 +1,102 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "PackedMicroKernel", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PackedMicroKernelFloat16; hwyImpl != nil {
+			PackedMicroKernelFloat16 = func(packedA []hwy.Float16, packedB []hwy.Float16, c []hwy.Float16, n int, ir int, jr int, kc int, mr int, nr int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, c, n, ir, jr, kc, mr, nr)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := PackedMicroKernelBFloat16; hwyImpl != nil {
+			PackedMicroKernelBFloat16 = func(packedA []hwy.BFloat16, packedB []hwy.BFloat16, c []hwy.BFloat16, n int, ir int, jr int, kc int, mr int, nr int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, c, n, ir, jr, kc, mr, nr)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := PackedMicroKernelFloat32; hwyImpl != nil {
+			PackedMicroKernelFloat32 = func(packedA []float32, packedB []float32, c []float32, n int, ir int, jr int, kc int, mr int, nr int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, c, n, ir, jr, kc, mr, nr)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := PackedMicroKernelFloat64; hwyImpl != nil {
+			PackedMicroKernelFloat64 = func(packedA []float64, packedB []float64, c []float64, n int, ir int, jr int, kc int, mr int, nr int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, c, n, ir, jr, kc, mr, nr)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(c))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "packedMicroKernelGeneral", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := packedMicroKernelGeneralFloat16; hwyImpl != nil {
+			packedMicroKernelGeneralFloat16 = func(packedA []hwy.Float16, packedB []hwy.Float16, c []hwy.Float16, n int, ir int, jr int, kc int, mr int, nr int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, c, n, ir, jr, kc, mr, nr)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := packedMicroKernelGeneralBFloat16; hwyImpl != nil {
+			packedMicroKernelGeneralBFloat16 = func(packedA []hwy.BFloat16, packedB []hwy.BFloat16, c []hwy.BFloat16, n int, ir int, jr int, kc int, mr int, nr int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, c, n, ir, jr, kc, mr, nr)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := packedMicroKernelGeneralFloat32; hwyImpl != nil {
+			packedMicroKernelGeneralFloat32 = func(packedA []float32, packedB []float32, c []float32, n int, ir int, jr int, kc int, mr int, nr int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, c, n, ir, jr, kc, mr, nr)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := packedMicroKernelGeneralFloat64; hwyImpl != nil {
+			packedMicroKernelGeneralFloat64 = func(packedA []float64, packedB []float64, c []float64, n int, ir int, jr int, kc int, mr int, nr int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, c, n, ir, jr, kc, mr, nr)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(c))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "PackedMicroKernelPartial", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PackedMicroKernelPartialFloat16; hwyImpl != nil {
+			PackedMicroKernelPartialFloat16 = func(packedA []hwy.Float16, packedB []hwy.Float16, c []hwy.Float16, n int, ir int, jr int, kc int, mr int, nr int, activeRows int, activeCols int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, c, n, ir, jr, kc, mr, nr, activeRows, activeCols)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := PackedMicroKernelPartialBFloat16; hwyImpl != nil {
+			PackedMicroKernelPartialBFloat16 = func(packedA []hwy.BFloat16, packedB []hwy.BFloat16, c []hwy.BFloat16, n int, ir int, jr int, kc int, mr int, nr int, activeRows int, activeCols int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, c, n, ir, jr, kc, mr, nr, activeRows, activeCols)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := PackedMicroKernelPartialFloat32; hwyImpl != nil {
+			PackedMicroKernelPartialFloat32 = func(packedA []float32, packedB []float32, c []float32, n int, ir int, jr int, kc int, mr int, nr int, activeRows int, activeCols int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, c, n, ir, jr, kc, mr, nr, activeRows, activeCols)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := PackedMicroKernelPartialFloat64; hwyImpl != nil {
+			PackedMicroKernelPartialFloat64 = func(packedA []float64, packedB []float64, c []float64, n int, ir int, jr int, kc int, mr int, nr int, activeRows int, activeCols int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, c, n, ir, jr, kc, mr, nr, activeRows, activeCols)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(c))
+			}
+		}
+	})
+}
@@ -75,6 +75,18 @@ func ZeroSlice[T hwy.Floats](s []T, n int) {
 
 func init() {
 	initPacked_kernel_v2All()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "PackedMicroKernel4x2", Vars: []any{&PackedMicroKernel4x2Float16, &PackedMicroKernel4x2BFloat16, &PackedMicroKernel4x2Float32, &PackedMicroKernel4x2Float64}},
+			{Name: "ZeroSlice", Vars: []any{&ZeroSliceFloat16, &ZeroSliceBFloat16, &ZeroSliceFloat32, &ZeroSliceFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initPacked_kernel_v2AVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initPacked_kernel_v2AVX2},
+			{Name: "fallback", Supported: true, Init: initPacked_kernel_v2Fallback},
+		},
+	})
 }
 
 func initPacked_kernel_v2All() {
@@ -73,6 +73,17 @@ func ZeroSlice[T hwy.Floats](s []T, n int) {
 
 func init() {
 	initPacked_kernel_v2All()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "PackedMicroKernel4x2", Vars: []any{&PackedMicroKernel4x2Float16, &PackedMicroKernel4x2BFloat16, &PackedMicroKernel4x2Float32, &PackedMicroKernel4x2Float64}},
+			{Name: "ZeroSlice", Vars: []any{&ZeroSliceFloat16, &ZeroSliceBFloat16, &ZeroSliceFloat32, &ZeroSliceFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initPacked_kernel_v2NEONAsm},
+			{Name: "fallback", Supported: true, Init: initPacked_kernel_v2Fallback},
+		},
+	})
 }
 
 func initPacked_kernel_v2All() {
@@ -0,0 +1,72 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "PackedMicroKernel4x2", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PackedMicroKernel4x2Float16; hwyImpl != nil {
+			PackedMicroKernel4x2Float16 = func(packedA []hwy.Float16, packedB []hwy.Float16, output []hwy.Float16, outputStride int, outRowStart int, outColStart int, panelK int, lanes int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, output, outputStride, outRowStart, outColStart, panelK, lanes)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := PackedMicroKernel4x2BFloat16; hwyImpl != nil {
+			PackedMicroKernel4x2BFloat16 = func(packedA []hwy.BFloat16, packedB []hwy.BFloat16, output []hwy.BFloat16, outputStride int, outRowStart int, outColStart int, panelK int, lanes int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, output, outputStride, outRowStart, outColStart, panelK, lanes)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := PackedMicroKernel4x2Float32; hwyImpl != nil {
+			PackedMicroKernel4x2Float32 = func(packedA []float32, packedB []float32, output []float32, outputStride int, outRowStart int, outColStart int, panelK int, lanes int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, output, outputStride, outRowStart, outColStart, panelK, lanes)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := PackedMicroKernel4x2Float64; hwyImpl != nil {
+			PackedMicroKernel4x2Float64 = func(packedA []float64, packedB []float64, output []float64, outputStride int, outRowStart int, outColStart int, panelK int, lanes int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedA, packedB, output, outputStride, outRowStart, outColStart, panelK, lanes)
+				hwyCounter.Done(hwyStart, len(packedA), hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "ZeroSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ZeroSliceFloat16; hwyImpl != nil {
+			ZeroSliceFloat16 = func(s []hwy.Float16, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(s, n)
+				hwyCounter.Done(hwyStart, len(s), hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := ZeroSliceBFloat16; hwyImpl != nil {
+			ZeroSliceBFloat16 = func(s []hwy.BFloat16, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(s, n)
+				hwyCounter.Done(hwyStart, len(s), hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := ZeroSliceFloat32; hwyImpl != nil {
+			ZeroSliceFloat32 = func(s []float32, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(s, n)
+				hwyCounter.Done(hwyStart, len(s), hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := ZeroSliceFloat64; hwyImpl != nil {
+			ZeroSliceFloat64 = func(s []float64, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(s, n)
+				hwyCounter.Done(hwyStart, len(s), hwy.SliceBytes(s))
+			}
+		}
+	})
+}
@@ -0,0 +1,102 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "PackedMatMul", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PackedMatMulFloat16; hwyImpl != nil {
+			PackedMatMulFloat16 = func(a []hwy.Float16, b []hwy.Float16, c []hwy.Float16, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := PackedMatMulBFloat16; hwyImpl != nil {
+			PackedMatMulBFloat16 = func(a []hwy.BFloat16, b []hwy.BFloat16, c []hwy.BFloat16, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := PackedMatMulFloat32; hwyImpl != nil {
+			PackedMatMulFloat32 = func(a []float32, b []float32, c []float32, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+		if hwyImpl := PackedMatMulFloat64; hwyImpl != nil {
+			PackedMatMulFloat64 = func(a []float64, b []float64, c []float64, m int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "PackedMatMulStrip", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PackedMatMulStripFloat16; hwyImpl != nil {
+			PackedMatMulStripFloat16 = func(a []hwy.Float16, b []hwy.Float16, c []hwy.Float16, m int, n int, k int, rowStart int, rowEnd int, packedA []hwy.Float16, packedB []hwy.Float16, params CacheParams) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k, rowStart, rowEnd, packedA, packedB, params)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c)+hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB))
+			}
+		}
+		if hwyImpl := PackedMatMulStripBFloat16; hwyImpl != nil {
+			PackedMatMulStripBFloat16 = func(a []hwy.BFloat16, b []hwy.BFloat16, c []hwy.BFloat16, m int, n int, k int, rowStart int, rowEnd int, packedA []hwy.BFloat16, packedB []hwy.BFloat16, params CacheParams) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k, rowStart, rowEnd, packedA, packedB, params)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c)+hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB))
+			}
+		}
+		if hwyImpl := PackedMatMulStripFloat32; hwyImpl != nil {
+			PackedMatMulStripFloat32 = func(a []float32, b []float32, c []float32, m int, n int, k int, rowStart int, rowEnd int, packedA []float32, packedB []float32, params CacheParams) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k, rowStart, rowEnd, packedA, packedB, params)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c)+hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB))
+			}
+		}
+		if hwyImpl := PackedMatMulStripFloat64; hwyImpl != nil {
+			PackedMatMulStripFloat64 = func(a []float64, b []float64, c []float64, m int, n int, k int, rowStart int, rowEnd int, packedA []float64, packedB []float64, params CacheParams) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k, rowStart, rowEnd, packedA, packedB, params)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c)+hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "PackedMatMulWithBuffers", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PackedMatMulWithBuffersFloat16; hwyImpl != nil {
+			PackedMatMulWithBuffersFloat16 = func(a []hwy.Float16, b []hwy.Float16, c []hwy.Float16, m int, n int, k int, packedA []hwy.Float16, packedB []hwy.Float16, params CacheParams) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k, packedA, packedB, params)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c)+hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB))
+			}
+		}
+		if hwyImpl := PackedMatMulWithBuffersBFloat16; hwyImpl != nil {
+			PackedMatMulWithBuffersBFloat16 = func(a []hwy.BFloat16, b []hwy.BFloat16, c []hwy.BFloat16, m int, n int, k int, packedA []hwy.BFloat16, packedB []hwy.BFloat16, params CacheParams) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k, packedA, packedB, params)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c)+hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB))
+			}
+		}
+		if hwyImpl := PackedMatMulWithBuffersFloat32; hwyImpl != nil {
+			PackedMatMulWithBuffersFloat32 = func(a []float32, b []float32, c []float32, m int, n int, k int, packedA []float32, packedB []float32, params CacheParams) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k, packedA, packedB, params)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c)+hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB))
+			}
+		}
+		if hwyImpl := PackedMatMulWithBuffersFloat64; hwyImpl != nil {
+			PackedMatMulWithBuffersFloat64 = func(a []float64, b []float64, c []float64, m int, n int, k int, packedA []float64, packedB []float64, params CacheParams) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, b, c, m, n, k, packedA, packedB, params)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b)+hwy.SliceBytes(c)+hwy.SliceBytes(packedA)+hwy.SliceBytes(packedB))
+			}
+		}
+	})
+}
@@ -105,6 +105,17 @@ func PackedMatMulWithBuffers[T hwy.Floats](a []T, b []T, c []T, m int, n int, k
 
 func init() {
 	initPackedmatmulAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "PackedMatMul", Vars: []any{&PackedMatMulFloat16, &PackedMatMulBFloat16, &PackedMatMulFloat32, &PackedMatMulFloat64}},
+			{Name: "PackedMatMulStrip", Vars: []any{&PackedMatMulStripFloat16, &PackedMatMulStripBFloat16, &PackedMatMulStripFloat32, &PackedMatMulStripFloat64}},
+			{Name: "PackedMatMulWithBuffers", Vars: []any{&PackedMatMulWithBuffersFloat16, &PackedMatMulWithBuffersBFloat16, &PackedMatMulWithBuffersFloat32, &PackedMatMulWithBuffersFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initPackedmatmulFallback},
+		},
+	})
 }
 
 func initPackedmatmulAll() {
@@ -137,6 +137,19 @@ func PackRHSVec[T hwy.Floats](b []T, packed []T, n int, rowStart int, colStart i
 
 func init() {
 	initPackingAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "PackLHS", Vars: []any{&PackLHSFloat16, &PackLHSBFloat16, &PackLHSFloat32, &PackLHSFloat64}},
+			{Name: "PackLHSVec", Vars: []any{&PackLHSVecFloat16, &PackLHSVecBFloat16, &PackLHSVecFloat32, &PackLHSVecFloat64}},
+			{Name: "PackRHSVec", Vars: []any{&PackRHSVecFloat16, &PackRHSVecBFloat16, &PackRHSVecFloat32, &PackRHSVecFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initPackingAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initPackingAVX2},
+			{Name: "fallback", Supported: true, Init: initPackingFallback},
+		},
+	})
 }
 
 func initPackingAll() {
@@ -135,6 +135,18 @@ func PackRHSVec[T hwy.Floats](b []T, packed []T, n int, rowStart int, colStart i
 
 func init() {
 	initPackingAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "PackLHS", Vars: []any{&PackLHSFloat16, &PackLHSBFloat16, &PackLHSFloat32, &PackLHSFloat64}},
+			{Name: "PackLHSVec", Vars: []any{&PackLHSVecFloat16, &PackLHSVecBFloat16, &PackLHSVecFloat32, &PackLHSVecFloat64}},
+			{Name: "PackRHSVec", Vars: []any{&PackRHSVecFloat16, &PackRHSVecBFloat16, &PackRHSVecFloat32, &PackRHSVecFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initPackingNEONAsm},
+			{Name: "fallback", Supported: true, Init: initPackingFallback},
+		},
+	})
 }
 
 func initPackingAll() {
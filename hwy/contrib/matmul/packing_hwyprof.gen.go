@@ -0,0 +1,114 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "PackLHS", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PackLHSFloat16; hwyImpl != nil {
+			PackLHSFloat16 = func(a []hwy.Float16, packed []hwy.Float16, m int, k int, rowStart int, colStart int, panelRows int, panelK int, mr int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, packed, m, k, rowStart, colStart, panelRows, panelK, mr)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(packed))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PackLHSBFloat16; hwyImpl != nil {
+			PackLHSBFloat16 = func(a []hwy.BFloat16, packed []hwy.BFloat16, m int, k int, rowStart int, colStart int, panelRows int, panelK int, mr int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, packed, m, k, rowStart, colStart, panelRows, panelK, mr)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(packed))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PackLHSFloat32; hwyImpl != nil {
+			PackLHSFloat32 = func(a []float32, packed []float32, m int, k int, rowStart int, colStart int, panelRows int, panelK int, mr int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, packed, m, k, rowStart, colStart, panelRows, panelK, mr)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(packed))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PackLHSFloat64; hwyImpl != nil {
+			PackLHSFloat64 = func(a []float64, packed []float64, m int, k int, rowStart int, colStart int, panelRows int, panelK int, mr int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, packed, m, k, rowStart, colStart, panelRows, panelK, mr)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(packed))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "PackLHSVec", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PackLHSVecFloat16; hwyImpl != nil {
+			PackLHSVecFloat16 = func(a []hwy.Float16, packed []hwy.Float16, m int, k int, rowStart int, colStart int, panelRows int, panelK int, mr int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, packed, m, k, rowStart, colStart, panelRows, panelK, mr)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(packed))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PackLHSVecBFloat16; hwyImpl != nil {
+			PackLHSVecBFloat16 = func(a []hwy.BFloat16, packed []hwy.BFloat16, m int, k int, rowStart int, colStart int, panelRows int, panelK int, mr int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, packed, m, k, rowStart, colStart, panelRows, panelK, mr)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(packed))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PackLHSVecFloat32; hwyImpl != nil {
+			PackLHSVecFloat32 = func(a []float32, packed []float32, m int, k int, rowStart int, colStart int, panelRows int, panelK int, mr int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, packed, m, k, rowStart, colStart, panelRows, panelK, mr)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(packed))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PackLHSVecFloat64; hwyImpl != nil {
+			PackLHSVecFloat64 = func(a []float64, packed []float64, m int, k int, rowStart int, colStart int, panelRows int, panelK int, mr int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, packed, m, k, rowStart, colStart, panelRows, panelK, mr)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(packed))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "PackRHSVec", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PackRHSVecFloat16; hwyImpl != nil {
+			PackRHSVecFloat16 = func(b []hwy.Float16, packed []hwy.Float16, n int, rowStart int, colStart int, panelK int, panelCols int, nr int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(b, packed, n, rowStart, colStart, panelK, panelCols, nr)
+				hwyCounter.Done(hwyStart, len(b), hwy.SliceBytes(b)+hwy.SliceBytes(packed))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PackRHSVecBFloat16; hwyImpl != nil {
+			PackRHSVecBFloat16 = func(b []hwy.BFloat16, packed []hwy.BFloat16, n int, rowStart int, colStart int, panelK int, panelCols int, nr int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(b, packed, n, rowStart, colStart, panelK, panelCols, nr)
+				hwyCounter.Done(hwyStart, len(b), hwy.SliceBytes(b)+hwy.SliceBytes(packed))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PackRHSVecFloat32; hwyImpl != nil {
+			PackRHSVecFloat32 = func(b []float32, packed []float32, n int, rowStart int, colStart int, panelK int, panelCols int, nr int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(b, packed, n, rowStart, colStart, panelK, panelCols, nr)
+				hwyCounter.Done(hwyStart, len(b), hwy.SliceBytes(b)+hwy.SliceBytes(packed))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PackRHSVecFloat64; hwyImpl != nil {
+			PackRHSVecFloat64 = func(b []float64, packed []float64, n int, rowStart int, colStart int, panelK int, panelCols int, nr int) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(b, packed, n, rowStart, colStart, panelK, panelCols, nr)
+				hwyCounter.Done(hwyStart, len(b), hwy.SliceBytes(b)+hwy.SliceBytes(packed))
+				return hwyR0
+			}
+		}
+	})
+}
@@ -99,6 +99,19 @@ func ApplyPackedOutputSimple[T hwy.Floats](packedOutput []T, output []T, packedS
 
 func init() {
 	initPacking_opsAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "ApplyPackedOutput", Vars: []any{&ApplyPackedOutputFloat16, &ApplyPackedOutputBFloat16, &ApplyPackedOutputFloat32, &ApplyPackedOutputFloat64}},
+			{Name: "ApplyPackedOutputAccum", Vars: []any{&ApplyPackedOutputAccumFloat16, &ApplyPackedOutputAccumBFloat16, &ApplyPackedOutputAccumFloat32, &ApplyPackedOutputAccumFloat64}},
+			{Name: "ApplyPackedOutputSimple", Vars: []any{&ApplyPackedOutputSimpleFloat16, &ApplyPackedOutputSimpleBFloat16, &ApplyPackedOutputSimpleFloat32, &ApplyPackedOutputSimpleFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initPacking_opsAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initPacking_opsAVX2},
+			{Name: "fallback", Supported: true, Init: initPacking_opsFallback},
+		},
+	})
 }
 
 func initPacking_opsAll() {
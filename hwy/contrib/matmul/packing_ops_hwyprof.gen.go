@@ -0,0 +1,102 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "ApplyPackedOutput", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ApplyPackedOutputFloat16; hwyImpl != nil {
+			ApplyPackedOutputFloat16 = func(packedOutput []hwy.Float16, output []hwy.Float16, alpha hwy.Float16, beta hwy.Float16, packedStride int, outputRowOffset int, outputColOffset int, outputStride int, height int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedOutput, output, alpha, beta, packedStride, outputRowOffset, outputColOffset, outputStride, height, width)
+				hwyCounter.Done(hwyStart, len(packedOutput), hwy.SliceBytes(packedOutput)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ApplyPackedOutputBFloat16; hwyImpl != nil {
+			ApplyPackedOutputBFloat16 = func(packedOutput []hwy.BFloat16, output []hwy.BFloat16, alpha hwy.BFloat16, beta hwy.BFloat16, packedStride int, outputRowOffset int, outputColOffset int, outputStride int, height int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedOutput, output, alpha, beta, packedStride, outputRowOffset, outputColOffset, outputStride, height, width)
+				hwyCounter.Done(hwyStart, len(packedOutput), hwy.SliceBytes(packedOutput)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ApplyPackedOutputFloat32; hwyImpl != nil {
+			ApplyPackedOutputFloat32 = func(packedOutput []float32, output []float32, alpha float32, beta float32, packedStride int, outputRowOffset int, outputColOffset int, outputStride int, height int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedOutput, output, alpha, beta, packedStride, outputRowOffset, outputColOffset, outputStride, height, width)
+				hwyCounter.Done(hwyStart, len(packedOutput), hwy.SliceBytes(packedOutput)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ApplyPackedOutputFloat64; hwyImpl != nil {
+			ApplyPackedOutputFloat64 = func(packedOutput []float64, output []float64, alpha float64, beta float64, packedStride int, outputRowOffset int, outputColOffset int, outputStride int, height int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedOutput, output, alpha, beta, packedStride, outputRowOffset, outputColOffset, outputStride, height, width)
+				hwyCounter.Done(hwyStart, len(packedOutput), hwy.SliceBytes(packedOutput)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "ApplyPackedOutputAccum", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ApplyPackedOutputAccumFloat16; hwyImpl != nil {
+			ApplyPackedOutputAccumFloat16 = func(packedOutput []hwy.Float16, output []hwy.Float16, packedStride int, outputRowOffset int, outputColOffset int, outputStride int, height int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedOutput, output, packedStride, outputRowOffset, outputColOffset, outputStride, height, width)
+				hwyCounter.Done(hwyStart, len(packedOutput), hwy.SliceBytes(packedOutput)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ApplyPackedOutputAccumBFloat16; hwyImpl != nil {
+			ApplyPackedOutputAccumBFloat16 = func(packedOutput []hwy.BFloat16, output []hwy.BFloat16, packedStride int, outputRowOffset int, outputColOffset int, outputStride int, height int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedOutput, output, packedStride, outputRowOffset, outputColOffset, outputStride, height, width)
+				hwyCounter.Done(hwyStart, len(packedOutput), hwy.SliceBytes(packedOutput)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ApplyPackedOutputAccumFloat32; hwyImpl != nil {
+			ApplyPackedOutputAccumFloat32 = func(packedOutput []float32, output []float32, packedStride int, outputRowOffset int, outputColOffset int, outputStride int, height int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedOutput, output, packedStride, outputRowOffset, outputColOffset, outputStride, height, width)
+				hwyCounter.Done(hwyStart, len(packedOutput), hwy.SliceBytes(packedOutput)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ApplyPackedOutputAccumFloat64; hwyImpl != nil {
+			ApplyPackedOutputAccumFloat64 = func(packedOutput []float64, output []float64, packedStride int, outputRowOffset int, outputColOffset int, outputStride int, height int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedOutput, output, packedStride, outputRowOffset, outputColOffset, outputStride, height, width)
+				hwyCounter.Done(hwyStart, len(packedOutput), hwy.SliceBytes(packedOutput)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "ApplyPackedOutputSimple", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ApplyPackedOutputSimpleFloat16; hwyImpl != nil {
+			ApplyPackedOutputSimpleFloat16 = func(packedOutput []hwy.Float16, output []hwy.Float16, packedStride int, outputRowOffset int, outputColOffset int, outputStride int, height int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedOutput, output, packedStride, outputRowOffset, outputColOffset, outputStride, height, width)
+				hwyCounter.Done(hwyStart, len(packedOutput), hwy.SliceBytes(packedOutput)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ApplyPackedOutputSimpleBFloat16; hwyImpl != nil {
+			ApplyPackedOutputSimpleBFloat16 = func(packedOutput []hwy.BFloat16, output []hwy.BFloat16, packedStride int, outputRowOffset int, outputColOffset int, outputStride int, height int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedOutput, output, packedStride, outputRowOffset, outputColOffset, outputStride, height, width)
+				hwyCounter.Done(hwyStart, len(packedOutput), hwy.SliceBytes(packedOutput)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ApplyPackedOutputSimpleFloat32; hwyImpl != nil {
+			ApplyPackedOutputSimpleFloat32 = func(packedOutput []float32, output []float32, packedStride int, outputRowOffset int, outputColOffset int, outputStride int, height int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedOutput, output, packedStride, outputRowOffset, outputColOffset, outputStride, height, width)
+				hwyCounter.Done(hwyStart, len(packedOutput), hwy.SliceBytes(packedOutput)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := ApplyPackedOutputSimpleFloat64; hwyImpl != nil {
+			ApplyPackedOutputSimpleFloat64 = func(packedOutput []float64, output []float64, packedStride int, outputRowOffset int, outputColOffset int, outputStride int, height int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(packedOutput, output, packedStride, outputRowOffset, outputColOffset, outputStride, height, width)
+				hwyCounter.Done(hwyStart, len(packedOutput), hwy.SliceBytes(packedOutput)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
@@ -97,6 +97,17 @@ func ApplyPackedOutputSimple[T hwy.Floats](packedOutput []T, output []T, packedS
 
 func init() {
 	initPacking_opsAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "ApplyPackedOutput", Vars: []any{&ApplyPackedOutputFloat16, &ApplyPackedOutputBFloat16, &ApplyPackedOutputFloat32, &ApplyPackedOutputFloat64}},
+			{Name: "ApplyPackedOutputAccum", Vars: []any{&ApplyPackedOutputAccumFloat16, &ApplyPackedOutputAccumBFloat16, &ApplyPackedOutputAccumFloat32, &ApplyPackedOutputAccumFloat64}},
+			{Name: "ApplyPackedOutputSimple", Vars: []any{&ApplyPackedOutputSimpleFloat16, &ApplyPackedOutputSimpleBFloat16, &ApplyPackedOutputSimpleFloat32, &ApplyPackedOutputSimpleFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initPacking_opsFallback},
+		},
+	})
 }
 
 func initPacking_opsAll() {
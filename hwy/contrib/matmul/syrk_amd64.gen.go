@@ -47,6 +47,17 @@ func SyrkLN[T hwy.Floats](c []T, ldc int, a []T, lda int, n int, k int) {
 
 func init() {
 	initSyrkAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "SyrkLN", Vars: []any{&SyrkLNFloat16, &SyrkLNBFloat16, &SyrkLNFloat32, &SyrkLNFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initSyrkAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initSyrkAVX2},
+			{Name: "fallback", Supported: true, Init: initSyrkFallback},
+		},
+	})
 }
 
 func initSyrkAll() {
@@ -45,6 +45,16 @@ func SyrkLN[T hwy.Floats](c []T, ldc int, a []T, lda int, n int, k int) {
 
 func init() {
 	initSyrkAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "SyrkLN", Vars: []any{&SyrkLNFloat16, &SyrkLNBFloat16, &SyrkLNFloat32, &SyrkLNFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initSyrkNEONAsm},
+			{Name: "fallback", Supported: true, Init: initSyrkFallback},
+		},
+	})
 }
 
 func initSyrkAll() {
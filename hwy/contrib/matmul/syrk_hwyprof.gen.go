@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "SyrkLN", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SyrkLNFloat16; hwyImpl != nil {
+			SyrkLNFloat16 = func(c []hwy.Float16, ldc int, a []hwy.Float16, lda int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(c, ldc, a, lda, n, k)
+				hwyCounter.Done(hwyStart, len(c), hwy.SliceBytes(c)+hwy.SliceBytes(a))
+			}
+		}
+		if hwyImpl := SyrkLNBFloat16; hwyImpl != nil {
+			SyrkLNBFloat16 = func(c []hwy.BFloat16, ldc int, a []hwy.BFloat16, lda int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(c, ldc, a, lda, n, k)
+				hwyCounter.Done(hwyStart, len(c), hwy.SliceBytes(c)+hwy.SliceBytes(a))
+			}
+		}
+		if hwyImpl := SyrkLNFloat32; hwyImpl != nil {
+			SyrkLNFloat32 = func(c []float32, ldc int, a []float32, lda int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(c, ldc, a, lda, n, k)
+				hwyCounter.Done(hwyStart, len(c), hwy.SliceBytes(c)+hwy.SliceBytes(a))
+			}
+		}
+		if hwyImpl := SyrkLNFloat64; hwyImpl != nil {
+			SyrkLNFloat64 = func(c []float64, ldc int, a []float64, lda int, n int, k int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(c, ldc, a, lda, n, k)
+				hwyCounter.Done(hwyStart, len(c), hwy.SliceBytes(c)+hwy.SliceBytes(a))
+			}
+		}
+	})
+}
@@ -0,0 +1,72 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "Transpose2D", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Transpose2DFloat16; hwyImpl != nil {
+			Transpose2DFloat16 = func(src []hwy.Float16, m int, k int, dst []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, m, k, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := Transpose2DBFloat16; hwyImpl != nil {
+			Transpose2DBFloat16 = func(src []hwy.BFloat16, m int, k int, dst []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, m, k, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := Transpose2DFloat32; hwyImpl != nil {
+			Transpose2DFloat32 = func(src []float32, m int, k int, dst []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, m, k, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := Transpose2DFloat64; hwyImpl != nil {
+			Transpose2DFloat64 = func(src []float64, m int, k int, dst []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, m, k, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "Transpose2DStrided", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Transpose2DStridedFloat16; hwyImpl != nil {
+			Transpose2DStridedFloat16 = func(src []hwy.Float16, rowStart int, rowEnd int, k int, dstM int, dst []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, rowStart, rowEnd, k, dstM, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := Transpose2DStridedBFloat16; hwyImpl != nil {
+			Transpose2DStridedBFloat16 = func(src []hwy.BFloat16, rowStart int, rowEnd int, k int, dstM int, dst []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, rowStart, rowEnd, k, dstM, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := Transpose2DStridedFloat32; hwyImpl != nil {
+			Transpose2DStridedFloat32 = func(src []float32, rowStart int, rowEnd int, k int, dstM int, dst []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, rowStart, rowEnd, k, dstM, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := Transpose2DStridedFloat64; hwyImpl != nil {
+			Transpose2DStridedFloat64 = func(src []float64, rowStart int, rowEnd int, k int, dstM int, dst []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, rowStart, rowEnd, k, dstM, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+}
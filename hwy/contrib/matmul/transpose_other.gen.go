@@ -57,6 +57,16 @@ func Transpose2DStrided[T hwy.Floats](src []T, rowStart int, rowEnd int, k int,
 
 func init() {
 	initTransposeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Transpose2D", Vars: []any{&Transpose2DFloat16, &Transpose2DBFloat16, &Transpose2DFloat32, &Transpose2DFloat64}},
+			{Name: "Transpose2DStrided", Vars: []any{&Transpose2DStridedFloat16, &Transpose2DStridedBFloat16, &Transpose2DStridedFloat32, &Transpose2DStridedFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initTransposeFallback},
+		},
+	})
 }
 
 func initTransposeAll() {
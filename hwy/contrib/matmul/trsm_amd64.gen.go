@@ -75,6 +75,18 @@ func TrsmLT[T hwy.Floats](l []T, b []T, n int, nrhs int) {
 
 func init() {
 	initTrsmAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "TrsmLN", Vars: []any{&TrsmLNFloat16, &TrsmLNBFloat16, &TrsmLNFloat32, &TrsmLNFloat64}},
+			{Name: "TrsmLT", Vars: []any{&TrsmLTFloat16, &TrsmLTBFloat16, &TrsmLTFloat32, &TrsmLTFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initTrsmAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initTrsmAVX2},
+			{Name: "fallback", Supported: true, Init: initTrsmFallback},
+		},
+	})
 }
 
 func initTrsmAll() {
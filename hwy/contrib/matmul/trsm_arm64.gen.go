@@ -73,6 +73,17 @@ func TrsmLT[T hwy.Floats](l []T, b []T, n int, nrhs int) {
 
 func init() {
 	initTrsmAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matmul",
+		Groups: []hwy.DispatchGroup{
+			{Name: "TrsmLN", Vars: []any{&TrsmLNFloat16, &TrsmLNBFloat16, &TrsmLNFloat32, &TrsmLNFloat64}},
+			{Name: "TrsmLT", Vars: []any{&TrsmLTFloat16, &TrsmLTBFloat16, &TrsmLTFloat32, &TrsmLTFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initTrsmNEONAsm},
+			{Name: "fallback", Supported: true, Init: initTrsmFallback},
+		},
+	})
 }
 
 func initTrsmAll() {
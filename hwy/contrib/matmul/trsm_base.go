@@ -14,7 +14,7 @@
 
 package matmul
 
-//go:generate go run ../../../cmd/hwygen -input trsm_base.go -dispatch trsm -output . -targets avx2,avx512,neon:asm,fallback
+//go:generate go run ../../../cmd/hwygen -input trsm_base.go -dispatch trsm -output . -targets avx2,avx512,avx2:asm,avx512:asm,neon:asm,fallback
 
 import "github.com/ajroetker/go-highway/hwy"
 
@@ -0,0 +1,72 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matmul
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matmul", "TrsmLN", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := TrsmLNFloat16; hwyImpl != nil {
+			TrsmLNFloat16 = func(l []hwy.Float16, b []hwy.Float16, n int, nrhs int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n, nrhs)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := TrsmLNBFloat16; hwyImpl != nil {
+			TrsmLNBFloat16 = func(l []hwy.BFloat16, b []hwy.BFloat16, n int, nrhs int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n, nrhs)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := TrsmLNFloat32; hwyImpl != nil {
+			TrsmLNFloat32 = func(l []float32, b []float32, n int, nrhs int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n, nrhs)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := TrsmLNFloat64; hwyImpl != nil {
+			TrsmLNFloat64 = func(l []float64, b []float64, n int, nrhs int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n, nrhs)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matmul", "TrsmLT", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := TrsmLTFloat16; hwyImpl != nil {
+			TrsmLTFloat16 = func(l []hwy.Float16, b []hwy.Float16, n int, nrhs int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n, nrhs)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := TrsmLTBFloat16; hwyImpl != nil {
+			TrsmLTBFloat16 = func(l []hwy.BFloat16, b []hwy.BFloat16, n int, nrhs int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n, nrhs)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := TrsmLTFloat32; hwyImpl != nil {
+			TrsmLTFloat32 = func(l []float32, b []float32, n int, nrhs int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n, nrhs)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := TrsmLTFloat64; hwyImpl != nil {
+			TrsmLTFloat64 = func(l []float64, b []float64, n int, nrhs int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n, nrhs)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+	})
+}
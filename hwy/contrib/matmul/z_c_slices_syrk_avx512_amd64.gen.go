@@ -0,0 +1,78 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package matmul
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/matmul/asm"
+)
+
+func init() {
+	initSyrkAvx512CAsm()
+}
+
+func initSyrkAvx512CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX512() {
+		return
+	}
+	SyrkLNFloat32 = syrkLNAVX512AsmF32
+	SyrkLNFloat64 = syrkLNAVX512AsmF64
+}
+
+func syrkLNAVX512AsmF32(c []float32, ldc int, a []float32, lda, n, k int) {
+	var p_c unsafe.Pointer
+	if len(c) > 0 {
+		p_c = unsafe.Pointer(&c[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	ldcVal := int64(ldc)
+	ldaVal := int64(lda)
+	nVal := int64(n)
+	kVal := int64(k)
+	len_cVal := int64(len(c))
+	len_aVal := int64(len(a))
+	asm.SyrkLN_AVX512_F32(
+		p_c,
+		unsafe.Pointer(&ldcVal),
+		p_a,
+		unsafe.Pointer(&ldaVal),
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&kVal),
+		unsafe.Pointer(&len_cVal),
+		unsafe.Pointer(&len_aVal),
+	)
+}
+
+func syrkLNAVX512AsmF64(c []float64, ldc int, a []float64, lda, n, k int) {
+	var p_c unsafe.Pointer
+	if len(c) > 0 {
+		p_c = unsafe.Pointer(&c[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	ldcVal := int64(ldc)
+	ldaVal := int64(lda)
+	nVal := int64(n)
+	kVal := int64(k)
+	len_cVal := int64(len(c))
+	len_aVal := int64(len(a))
+	asm.SyrkLN_AVX512_F64(
+		p_c,
+		unsafe.Pointer(&ldcVal),
+		p_a,
+		unsafe.Pointer(&ldaVal),
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&kVal),
+		unsafe.Pointer(&len_cVal),
+		unsafe.Pointer(&len_aVal),
+	)
+}
@@ -0,0 +1,142 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package matmul
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/matmul/asm"
+)
+
+func init() {
+	initTrsmAvx512CAsm()
+}
+
+func initTrsmAvx512CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX512() {
+		return
+	}
+	TrsmLNFloat32 = trsmLNAVX512AsmF32
+	TrsmLNFloat64 = trsmLNAVX512AsmF64
+	TrsmLTFloat32 = trsmLTAVX512AsmF32
+	TrsmLTFloat64 = trsmLTAVX512AsmF64
+}
+
+func trsmLNAVX512AsmF32(l, b []float32, n, nrhs int) {
+	if len(l) < n*n {
+		panic("trsm: L slice too short")
+	}
+	if len(b) < n*nrhs {
+		panic("trsm: B slice too short")
+	}
+	var p_l unsafe.Pointer
+	if len(l) > 0 {
+		p_l = unsafe.Pointer(&l[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	nVal := int64(n)
+	nrhsVal := int64(nrhs)
+	len_lVal := int64(len(l))
+	len_bVal := int64(len(b))
+	asm.TrsmLN_AVX512_F32(
+		p_l,
+		p_b,
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&nrhsVal),
+		unsafe.Pointer(&len_lVal),
+		unsafe.Pointer(&len_bVal),
+	)
+}
+
+func trsmLNAVX512AsmF64(l, b []float64, n, nrhs int) {
+	if len(l) < n*n {
+		panic("trsm: L slice too short")
+	}
+	if len(b) < n*nrhs {
+		panic("trsm: B slice too short")
+	}
+	var p_l unsafe.Pointer
+	if len(l) > 0 {
+		p_l = unsafe.Pointer(&l[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	nVal := int64(n)
+	nrhsVal := int64(nrhs)
+	len_lVal := int64(len(l))
+	len_bVal := int64(len(b))
+	asm.TrsmLN_AVX512_F64(
+		p_l,
+		p_b,
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&nrhsVal),
+		unsafe.Pointer(&len_lVal),
+		unsafe.Pointer(&len_bVal),
+	)
+}
+
+func trsmLTAVX512AsmF32(l, b []float32, n, nrhs int) {
+	if len(l) < n*n {
+		panic("trsm: L slice too short")
+	}
+	if len(b) < n*nrhs {
+		panic("trsm: B slice too short")
+	}
+	var p_l unsafe.Pointer
+	if len(l) > 0 {
+		p_l = unsafe.Pointer(&l[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	nVal := int64(n)
+	nrhsVal := int64(nrhs)
+	len_lVal := int64(len(l))
+	len_bVal := int64(len(b))
+	asm.TrsmLT_AVX512_F32(
+		p_l,
+		p_b,
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&nrhsVal),
+		unsafe.Pointer(&len_lVal),
+		unsafe.Pointer(&len_bVal),
+	)
+}
+
+func trsmLTAVX512AsmF64(l, b []float64, n, nrhs int) {
+	if len(l) < n*n {
+		panic("trsm: L slice too short")
+	}
+	if len(b) < n*nrhs {
+		panic("trsm: B slice too short")
+	}
+	var p_l unsafe.Pointer
+	if len(l) > 0 {
+		p_l = unsafe.Pointer(&l[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	nVal := int64(n)
+	nrhsVal := int64(nrhs)
+	len_lVal := int64(len(l))
+	len_bVal := int64(len(b))
+	asm.TrsmLT_AVX512_F64(
+		p_l,
+		p_b,
+		unsafe.Pointer(&nVal),
+		unsafe.Pointer(&nrhsVal),
+		unsafe.Pointer(&len_lVal),
+		unsafe.Pointer(&len_bVal),
+	)
+}
@@ -0,0 +1,72 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package matvec
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		f16  = make([]hwy.Float16, allocTestLen)
+		bf16 = make([]hwy.BFloat16, allocTestLen)
+		f32  = make([]float32, allocTestLen)
+		f64  = make([]float64, allocTestLen)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseMatVec_fallback_Float16", func() { BaseMatVec_fallback_Float16(f16, allocTestDim, allocTestDim, f16, f16) }},
+		{"BaseMatVec_fallback_BFloat16", func() { BaseMatVec_fallback_BFloat16(bf16, allocTestDim, allocTestDim, bf16, bf16) }},
+		{"BaseMatVec_fallback", func() { BaseMatVec_fallback(f32, allocTestDim, allocTestDim, f32, f32) }},
+		{"BaseMatVec_fallback_Float64", func() { BaseMatVec_fallback_Float64(f64, allocTestDim, allocTestDim, f64, f64) }},
+		{"BaseSymvLN_fallback_Float16", func() { BaseSymvLN_fallback_Float16(f16, f16, f16, allocTestDim) }},
+		{"BaseSymvLN_fallback_BFloat16", func() { BaseSymvLN_fallback_BFloat16(bf16, bf16, bf16, allocTestDim) }},
+		{"BaseSymvLN_fallback", func() { BaseSymvLN_fallback(f32, f32, f32, allocTestDim) }},
+		{"BaseSymvLN_fallback_Float64", func() { BaseSymvLN_fallback_Float64(f64, f64, f64, allocTestDim) }},
+		{"BaseTrsvLN_fallback_Float16", func() { BaseTrsvLN_fallback_Float16(f16, f16, allocTestDim) }},
+		{"BaseTrsvLN_fallback_BFloat16", func() { BaseTrsvLN_fallback_BFloat16(bf16, bf16, allocTestDim) }},
+		{"BaseTrsvLN_fallback", func() { BaseTrsvLN_fallback(f32, f32, allocTestDim) }},
+		{"BaseTrsvLN_fallback_Float64", func() { BaseTrsvLN_fallback_Float64(f64, f64, allocTestDim) }},
+		{"BaseTrsvLT_fallback_Float16", func() { BaseTrsvLT_fallback_Float16(f16, f16, allocTestDim) }},
+		{"BaseTrsvLT_fallback_BFloat16", func() { BaseTrsvLT_fallback_BFloat16(bf16, bf16, allocTestDim) }},
+		{"BaseTrsvLT_fallback", func() { BaseTrsvLT_fallback(f32, f32, allocTestDim) }},
+		{"BaseTrsvLT_fallback_Float64", func() { BaseTrsvLT_fallback_Float64(f64, f64, allocTestDim) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
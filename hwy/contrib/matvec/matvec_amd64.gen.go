@@ -58,6 +58,17 @@ func MatVec[T hwy.Floats](m []T, rows int, cols int, v []T, result []T) {
 
 func init() {
 	initMatvecAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matvec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "MatVec", Vars: []any{&MatVecFloat16, &MatVecBFloat16, &MatVecFloat32, &MatVecFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initMatvecAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initMatvecAVX2},
+			{Name: "fallback", Supported: true, Init: initMatvecFallback},
+		},
+	})
 }
 
 func initMatvecAll() {
@@ -56,6 +56,16 @@ func MatVec[T hwy.Floats](m []T, rows int, cols int, v []T, result []T) {
 
 func init() {
 	initMatvecAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matvec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "MatVec", Vars: []any{&MatVecFloat16, &MatVecBFloat16, &MatVecFloat32, &MatVecFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initMatvecNEONAsm},
+			{Name: "fallback", Supported: true, Init: initMatvecFallback},
+		},
+	})
 }
 
 func initMatvecAll() {
@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matvec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matvec", "MatVec", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MatVecFloat16; hwyImpl != nil {
+			MatVecFloat16 = func(m []hwy.Float16, rows int, cols int, v []hwy.Float16, result []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(m, rows, cols, v, result)
+				hwyCounter.Done(hwyStart, len(m), hwy.SliceBytes(m)+hwy.SliceBytes(v)+hwy.SliceBytes(result))
+			}
+		}
+		if hwyImpl := MatVecBFloat16; hwyImpl != nil {
+			MatVecBFloat16 = func(m []hwy.BFloat16, rows int, cols int, v []hwy.BFloat16, result []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(m, rows, cols, v, result)
+				hwyCounter.Done(hwyStart, len(m), hwy.SliceBytes(m)+hwy.SliceBytes(v)+hwy.SliceBytes(result))
+			}
+		}
+		if hwyImpl := MatVecFloat32; hwyImpl != nil {
+			MatVecFloat32 = func(m []float32, rows int, cols int, v []float32, result []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(m, rows, cols, v, result)
+				hwyCounter.Done(hwyStart, len(m), hwy.SliceBytes(m)+hwy.SliceBytes(v)+hwy.SliceBytes(result))
+			}
+		}
+		if hwyImpl := MatVecFloat64; hwyImpl != nil {
+			MatVecFloat64 = func(m []float64, rows int, cols int, v []float64, result []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(m, rows, cols, v, result)
+				hwyCounter.Done(hwyStart, len(m), hwy.SliceBytes(m)+hwy.SliceBytes(v)+hwy.SliceBytes(result))
+			}
+		}
+	})
+}
@@ -44,6 +44,17 @@ func SymvLN[T hwy.Floats](a []T, x []T, y []T, n int) {
 
 func init() {
 	initSymvAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matvec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "SymvLN", Vars: []any{&SymvLNFloat16, &SymvLNBFloat16, &SymvLNFloat32, &SymvLNFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initSymvAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initSymvAVX2},
+			{Name: "fallback", Supported: true, Init: initSymvFallback},
+		},
+	})
 }
 
 func initSymvAll() {
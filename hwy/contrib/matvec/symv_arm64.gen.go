@@ -42,6 +42,16 @@ func SymvLN[T hwy.Floats](a []T, x []T, y []T, n int) {
 
 func init() {
 	initSymvAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matvec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "SymvLN", Vars: []any{&SymvLNFloat16, &SymvLNBFloat16, &SymvLNFloat32, &SymvLNFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initSymvNEONAsm},
+			{Name: "fallback", Supported: true, Init: initSymvFallback},
+		},
+	})
 }
 
 func initSymvAll() {
@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matvec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matvec", "SymvLN", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SymvLNFloat16; hwyImpl != nil {
+			SymvLNFloat16 = func(a []hwy.Float16, x []hwy.Float16, y []hwy.Float16, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, x, y, n)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(x)+hwy.SliceBytes(y))
+			}
+		}
+		if hwyImpl := SymvLNBFloat16; hwyImpl != nil {
+			SymvLNBFloat16 = func(a []hwy.BFloat16, x []hwy.BFloat16, y []hwy.BFloat16, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, x, y, n)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(x)+hwy.SliceBytes(y))
+			}
+		}
+		if hwyImpl := SymvLNFloat32; hwyImpl != nil {
+			SymvLNFloat32 = func(a []float32, x []float32, y []float32, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, x, y, n)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(x)+hwy.SliceBytes(y))
+			}
+		}
+		if hwyImpl := SymvLNFloat64; hwyImpl != nil {
+			SymvLNFloat64 = func(a []float64, x []float64, y []float64, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(a, x, y, n)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(x)+hwy.SliceBytes(y))
+			}
+		}
+	})
+}
@@ -42,6 +42,15 @@ func SymvLN[T hwy.Floats](a []T, x []T, y []T, n int) {
 
 func init() {
 	initSymvAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matvec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "SymvLN", Vars: []any{&SymvLNFloat16, &SymvLNBFloat16, &SymvLNFloat32, &SymvLNFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initSymvFallback},
+		},
+	})
 }
 
 func initSymvAll() {
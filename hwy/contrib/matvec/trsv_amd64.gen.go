@@ -75,6 +75,18 @@ func TrsvLT[T hwy.Floats](l []T, b []T, n int) {
 
 func init() {
 	initTrsvAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "matvec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "TrsvLN", Vars: []any{&TrsvLNFloat16, &TrsvLNBFloat16, &TrsvLNFloat32, &TrsvLNFloat64}},
+			{Name: "TrsvLT", Vars: []any{&TrsvLTFloat16, &TrsvLTBFloat16, &TrsvLTFloat32, &TrsvLTFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initTrsvAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initTrsvAVX2},
+			{Name: "fallback", Supported: true, Init: initTrsvFallback},
+		},
+	})
 }
 
 func initTrsvAll() {
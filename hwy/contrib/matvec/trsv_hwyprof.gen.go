@@ -0,0 +1,72 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package matvec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("matvec", "TrsvLN", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := TrsvLNFloat16; hwyImpl != nil {
+			TrsvLNFloat16 = func(l []hwy.Float16, b []hwy.Float16, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := TrsvLNBFloat16; hwyImpl != nil {
+			TrsvLNBFloat16 = func(l []hwy.BFloat16, b []hwy.BFloat16, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := TrsvLNFloat32; hwyImpl != nil {
+			TrsvLNFloat32 = func(l []float32, b []float32, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := TrsvLNFloat64; hwyImpl != nil {
+			TrsvLNFloat64 = func(l []float64, b []float64, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+	})
+	hwy.ProfileDispatch("matvec", "TrsvLT", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := TrsvLTFloat16; hwyImpl != nil {
+			TrsvLTFloat16 = func(l []hwy.Float16, b []hwy.Float16, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := TrsvLTBFloat16; hwyImpl != nil {
+			TrsvLTBFloat16 = func(l []hwy.BFloat16, b []hwy.BFloat16, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := TrsvLTFloat32; hwyImpl != nil {
+			TrsvLTFloat32 = func(l []float32, b []float32, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := TrsvLTFloat64; hwyImpl != nil {
+			TrsvLTFloat64 = func(l []float64, b []float64, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(l, b, n)
+				hwyCounter.Done(hwyStart, len(l), hwy.SliceBytes(l)+hwy.SliceBytes(b))
+			}
+		}
+	})
+}
@@ -0,0 +1,1174 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baseattentionweights_c_f32_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x7f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_10<>+0(SB)/4, $0xb95e8083
+DATA CPI0_10<>+4(SB)/4, $0xb95e8083
+DATA CPI0_10<>+8(SB)/4, $0xb95e8083
+DATA CPI0_10<>+12(SB)/4, $0xb95e8083
+DATA CPI0_10<>+16(SB)/4, $0xb95e8083
+DATA CPI0_10<>+20(SB)/4, $0xb95e8083
+DATA CPI0_10<>+24(SB)/4, $0xb95e8083
+DATA CPI0_10<>+28(SB)/4, $0xb95e8083
+GLOBL CPI0_10<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_13<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_13<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_14<>+0(SB)/4, $0x3c088889
+DATA CPI0_14<>+4(SB)/4, $0x3c088889
+DATA CPI0_14<>+8(SB)/4, $0x3c088889
+DATA CPI0_14<>+12(SB)/4, $0x3c088889
+DATA CPI0_14<>+16(SB)/4, $0x3c088889
+DATA CPI0_14<>+20(SB)/4, $0x3c088889
+DATA CPI0_14<>+24(SB)/4, $0x3c088889
+DATA CPI0_14<>+28(SB)/4, $0x3c088889
+GLOBL CPI0_14<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_16<>+0(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+4(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+8(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+12(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+16(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+20(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+24(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+28(SB)/4, $0x3d2aaaab
+GLOBL CPI0_16<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_19<>+0(SB)/4, $0x3e2aaaab
+GLOBL CPI0_19<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_21<>+0(SB)/4, $0x3f000000
+GLOBL CPI0_21<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_23<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_23<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_26<>+0(SB)/4, $0x44314000
+GLOBL CPI0_26<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_27<>+0(SB)/4, $0xc4314000
+GLOBL CPI0_27<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_28<>+0(SB)/4, $0x652b82fe
+DATA CPI0_28<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_28<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_29<>+0(SB)/4, $0x00000000
+DATA CPI0_29<>+4(SB)/4, $0x80000000
+DATA CPI0_29<>+8(SB)/4, $0x00000000
+DATA CPI0_29<>+12(SB)/4, $0x00000000
+GLOBL CPI0_29<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_3<>+0(SB)/4, $0x42b17218
+GLOBL CPI0_3<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_30<>+0(SB)/4, $0xffffffff
+DATA CPI0_30<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_30<>+8(SB)/4, $0x00000000
+DATA CPI0_30<>+12(SB)/4, $0x00000000
+GLOBL CPI0_30<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_31<>+0(SB)/4, $0xfee00000
+DATA CPI0_31<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_31<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_32<>+0(SB)/4, $0x35793c6c
+DATA CPI0_32<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_32<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_33<>+0(SB)/4, $0xeff8d898
+DATA CPI0_33<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_33<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_34<>+0(SB)/4, $0x67f544e4
+DATA CPI0_34<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_34<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_35<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_35<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_35<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_36<>+0(SB)/4, $0xa556c734
+DATA CPI0_36<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_36<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_37<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_37<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_37<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_38<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_38<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_38<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_39<>+0(SB)/4, $0x16c16c17
+DATA CPI0_39<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_39<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_40<>+0(SB)/4, $0x11111111
+DATA CPI0_40<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_40<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_41<>+0(SB)/4, $0x55555555
+DATA CPI0_41<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_41<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_42<>+0(SB)/4, $0x55555555
+DATA CPI0_42<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_42<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_43<>+0(SB)/4, $0x00000000
+DATA CPI0_43<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_43<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_44<>+0(SB)/4, $0x00000000
+DATA CPI0_44<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_44<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_5<>+0(SB)/4, $0xc2aeac50
+GLOBL CPI0_5<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_6<>+0(SB)/4, $0x3fb8aa3b
+DATA CPI0_6<>+4(SB)/4, $0x3fb8aa3b
+DATA CPI0_6<>+8(SB)/4, $0x3fb8aa3b
+DATA CPI0_6<>+12(SB)/4, $0x3fb8aa3b
+DATA CPI0_6<>+16(SB)/4, $0x3fb8aa3b
+DATA CPI0_6<>+20(SB)/4, $0x3fb8aa3b
+DATA CPI0_6<>+24(SB)/4, $0x3fb8aa3b
+DATA CPI0_6<>+28(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_6<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_8<>+0(SB)/4, $0x3f318000
+DATA CPI0_8<>+4(SB)/4, $0x3f318000
+DATA CPI0_8<>+8(SB)/4, $0x3f318000
+DATA CPI0_8<>+12(SB)/4, $0x3f318000
+DATA CPI0_8<>+16(SB)/4, $0x3f318000
+DATA CPI0_8<>+20(SB)/4, $0x3f318000
+DATA CPI0_8<>+24(SB)/4, $0x3f318000
+DATA CPI0_8<>+28(SB)/4, $0x3f318000
+GLOBL CPI0_8<>(SB), (RODATA|NOPTR), $32
+
+TEXT ·attentionweights_c_f32_avx2(SB), $368-96
+	MOVQ q+0(FP), DI
+	MOVQ k+8(FP), SI
+	MOVQ mask+16(FP), DX
+	MOVQ weights+24(FP), CX
+	MOVQ pseqLen+32(FP), R8
+	MOVQ pkvLen+40(FP), R9
+	MOVQ pheadDim+48(FP), R11
+	MOVQ R11, 320(SP)
+	MOVQ pscale+56(FP), R11
+	MOVQ R11, 328(SP)
+	MOVQ plen_q+64(FP), R11
+	MOVQ R11, 336(SP)
+	MOVQ plen_k+72(FP), R11
+	MOVQ R11, 344(SP)
+	MOVQ plen_mask+80(FP), R11
+	MOVQ R11, 352(SP)
+	MOVQ plen_weights+88(FP), R11
+	MOVQ R11, 360(SP)
+	WORD $0x894c; BYTE $0xc8                   // movq	%r9, %rax
+	QUAD $0x0000013024ac8d48                   // leaq	304(%rsp), %rbp
+	WORD $0x8948; BYTE $0xf3                   // movq	%rsi, %rbx
+	LONG $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348                           // andq	$-32, %rsp
+	WORD $0x8b48; BYTE $0x30                   // movq	(%rax), %rsi
+	LONG $0x24548948; BYTE $0x70               // movq	%rdx, 112(%rsp)
+	LONG $0x10558b48                           // movq	16(%rbp), %rdx
+	WORD $0x8548; BYTE $0xf6                   // testq	%rsi, %rsi
+	QUAD $0x0000010824bc8948                   // movq	%rdi, 264(%rsp)
+	WORD $0x8b4c; BYTE $0x0a                   // movq	(%rdx), %r9
+	WORD $0x8b49; BYTE $0x10                   // movq	(%r8), %rdx
+	WORD $0x940f; BYTE $0xc0                   // sete	%al
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	LONG $0x24548948; BYTE $0x48               // movq	%rdx, 72(%rsp)
+	WORD $0x9e0f; BYTE $0xc2                   // setle	%dl
+	WORD $0xd008                               // orb	%dl, %al
+	JNE  BB0_132
+	WORD $0x854d; BYTE $0xc9                   // testq	%r9, %r9
+	JE   BB0_132
+	LONG $0x18458b48                           // movq	24(%rbp), %rax
+	WORD $0x8949; BYTE $0xfb                   // movq	%rdi, %r11
+	WORD $0x8948; BYTE $0xcf                   // movq	%rcx, %rdi
+	WORD $0x3145; BYTE $0xed                   // xorl	%r13d, %r13d
+	QUAD $0x00000000b5148d48                   // leaq	0(,%rsi,4), %rdx
+	WORD $0x3145; BYTE $0xf6                   // xorl	%r14d, %r14d
+	WORD $0x8949; BYTE $0xda                   // movq	%rbx, %r10
+	QUAD $0x0000009824bc8948                   // movq	%rdi, 152(%rsp)
+	LONG $0x0a0c8d48                           // leaq	(%rdx,%rcx), %rcx
+	LONG $0x1010fac5                           // vmovss	(%rax), %xmm2
+	LONG $0x24548948; BYTE $0x40               // movq	%rdx, 64(%rsp)
+	WORD $0x8949; BYTE $0xfc                   // movq	%rdi, %r12
+	LONG $0x244c8948; BYTE $0x78               // movq	%rcx, 120(%rsp)
+	WORD $0x894c; BYTE $0xc9                   // movq	%r9, %rcx
+	QUAD $0x000000008d048d4a                   // leaq	0(,%r9,4), %rax
+	LONG $0x09148d4b                           // leaq	(%r9,%r9), %rdx
+	LONG $0x04e1c148                           // salq	$4, %rcx
+	QUAD $0x000000b024848948                   // movq	%rax, 176(%rsp)
+	LONG $0xc2c6e8c5; BYTE $0x00               // vshufps	$0, %xmm2, %xmm2, %xmm0
+	QUAD $0x00000088248c8948                   // movq	%rcx, 136(%rsp)
+	LONG $0x030c8d48                           // leaq	(%rbx,%rax), %rcx
+	WORD $0x894c; BYTE $0xcb                   // movq	%r9, %rbx
+	LONG $0x244c8948; BYTE $0x28               // movq	%rcx, 40(%rsp)
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x24548948; BYTE $0x20               // movq	%rdx, 32(%rsp)
+	WORD $0x014c; BYTE $0xca                   // addq	%r9, %rdx
+	LONG $0x24448948; BYTE $0x38               // movq	%rax, 56(%rsp)
+	LONG $0xf8418d49                           // leaq	-8(%r9), %rax
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	LONG $0x244c8948; BYTE $0x30               // movq	%rcx, 48(%rsp)
+	QUAD $0x00000008c5048d48                   // leaq	8(,%rax,8), %rax
+	LONG $0x24548948; BYTE $0x08               // movq	%rdx, 8(%rsp)
+	QUAD $0x000000a824848948                   // movq	%rax, 168(%rsp)
+	LONG $0xfc468d48                           // leaq	-4(%rsi), %rax
+	LONG $0x24448948; BYTE $0x18               // movq	%rax, 24(%rsp)
+	LONG $0x02e8c148                           // shrq	$2, %rax
+	QUAD $0x0000000485048d48                   // leaq	4(,%rax,4), %rax
+	QUAD $0x0000008024ac894c                   // movq	%r13, 128(%rsp)
+	LONG $0x24448948; BYTE $0x10               // movq	%rax, 16(%rsp)
+	LONG $0xf8468d48                           // leaq	-8(%rsi), %rax
+	QUAD $0x000001102484c748; LONG $0x00000000 // movq	$0, 272(%rsp)
+	LONG $0x24448948; BYTE $0x68               // movq	%rax, 104(%rsp)
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	QUAD $0x0000009024b4894c                   // movq	%r14, 144(%rsp)
+	QUAD $0x00000008c53c8d4c                   // leaq	8(,%rax,8), %r15
+	WORD $0x8949; BYTE $0xf6                   // movq	%rsi, %r14
+
+BB0_59:
+	LONG $0x03fe8349             // cmpq	$3, %r14
+	JLE  BB0_4
+	LONG $0x24448b48; BYTE $0x18 // movq	24(%rsp), %rax
+	LONG $0x247c894c; BYTE $0x58 // movq	%r15, 88(%rsp)
+	WORD $0x894c; BYTE $0xd7     // movq	%r10, %rdi
+	LONG $0x244c8b48; BYTE $0x30 // movq	48(%rsp), %rcx
+	LONG $0x244c8b4c; BYTE $0x28 // movq	40(%rsp), %r9
+	LONG $0x2464894c; BYTE $0x50 // movq	%r12, 80(%rsp)
+	QUAD $0x0000009024b48b48     // movq	144(%rsp), %rsi
+	LONG $0xfce08348             // andq	$-4, %rax
+	LONG $0x2474894c; BYTE $0x60 // movq	%r14, 96(%rsp)
+	QUAD $0x000000e8249c894c     // movq	%r11, 232(%rsp)
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	LONG $0x24748b48; BYTE $0x38 // movq	56(%rsp), %rsi
+	LONG $0x84448d49; BYTE $0x10 // leaq	16(%r12,%rax,4), %rax
+	QUAD $0x000000a024848948     // movq	%rax, 160(%rsp)
+	LONG $0x24448b48; BYTE $0x08 // movq	8(%rsp), %rax
+	QUAD $0x000000f024848948     // movq	%rax, 240(%rsp)
+	LONG $0x24448b48; BYTE $0x20 // movq	32(%rsp), %rax
+	QUAD $0x0000011824848948     // movq	%rax, 280(%rsp)
+	QUAD $0x0000009824848b48     // movq	152(%rsp), %rax
+	QUAD $0x000000d824848948     // movq	%rax, 216(%rsp)
+	WORD $0xc031                 // xorl	%eax, %eax
+	WORD $0x8949; BYTE $0xc6     // movq	%rax, %r14
+
+BB0_14:
+	LONG $0x1e048d49             // leaq	(%r14,%rbx), %rax
+	QUAD $0x0000010024848948     // movq	%rax, 256(%rsp)
+	LONG $0x07fb8348             // cmpq	$7, %rbx
+	JLE  BB0_70
+	LONG $0xdb57e0c5             // vxorps	%xmm3, %xmm3, %xmm3
+	QUAD $0x000000e8249c8b4c     // movq	232(%rsp), %r11
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	LONG $0xe328fcc5             // vmovaps	%ymm3, %ymm4
+	LONG $0xeb28fcc5             // vmovaps	%ymm3, %ymm5
+	LONG $0xf328fcc5             // vmovaps	%ymm3, %ymm6
+
+BB0_6:
+	LONG $0x107cc1c4; WORD $0x834c; BYTE $0xe0 // vmovups	-32(%r11,%rax,4), %ymm1
+	LONG $0xb875e2c4; WORD $0x8774; BYTE $0xe0 // vfmadd231ps	-32(%rdi,%rax,4), %ymm1, %ymm6
+	LONG $0xb875c2c4; WORD $0x816c; BYTE $0xe0 // vfmadd231ps	-32(%r9,%rax,4), %ymm1, %ymm5
+	LONG $0xb875e2c4; WORD $0x8164; BYTE $0xe0 // vfmadd231ps	-32(%rcx,%rax,4), %ymm1, %ymm4
+	LONG $0xb875e2c4; WORD $0x865c; BYTE $0xe0 // vfmadd231ps	-32(%rsi,%rax,4), %ymm1, %ymm3
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd8                   // cmpq	%rbx, %rax
+	JLE  BB0_6
+	QUAD $0x000000e8249c894c                   // movq	%r11, 232(%rsp)
+	QUAD $0x000000a824948b48                   // movq	168(%rsp), %rdx
+
+BB0_5:
+	LONG $0x197de3c4; WORD $0x01f1 // vextractf128	$0x1, %ymm6, %xmm1
+	LONG $0xce58f0c5               // vaddps	%xmm6, %xmm1, %xmm1
+	LONG $0xf112f0c5               // vmovhlps	%xmm1, %xmm1, %xmm6
+	LONG $0xce58f0c5               // vaddps	%xmm6, %xmm1, %xmm1
+	LONG $0xf116fac5               // vmovshdup	%xmm1, %xmm6
+	LONG $0xce58f2c5               // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0x197de3c4; WORD $0x01ee // vextractf128	$0x1, %ymm5, %xmm6
+	LONG $0xed58c8c5               // vaddps	%xmm5, %xmm6, %xmm5
+	LONG $0xf512d0c5               // vmovhlps	%xmm5, %xmm5, %xmm6
+	LONG $0xee58d0c5               // vaddps	%xmm6, %xmm5, %xmm5
+	LONG $0xf516fac5               // vmovshdup	%xmm5, %xmm6
+	LONG $0xf658d2c5               // vaddss	%xmm6, %xmm5, %xmm6
+	LONG $0x197de3c4; WORD $0x01e5 // vextractf128	$0x1, %ymm4, %xmm5
+	LONG $0xe458d0c5               // vaddps	%xmm4, %xmm5, %xmm4
+	LONG $0xce14f0c5               // vunpcklps	%xmm6, %xmm1, %xmm1
+	LONG $0xec12d8c5               // vmovhlps	%xmm4, %xmm4, %xmm5
+	LONG $0xe558d8c5               // vaddps	%xmm5, %xmm4, %xmm4
+	LONG $0xec16fac5               // vmovshdup	%xmm4, %xmm5
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01dd // vextractf128	$0x1, %ymm3, %xmm5
+	LONG $0xdd58e0c5               // vaddps	%xmm5, %xmm3, %xmm3
+	LONG $0xeb12e0c5               // vmovhlps	%xmm3, %xmm3, %xmm5
+	LONG $0xdb58d0c5               // vaddps	%xmm3, %xmm5, %xmm3
+	LONG $0xeb16fac5               // vmovshdup	%xmm3, %xmm5
+	LONG $0xdd58e2c5               // vaddss	%xmm5, %xmm3, %xmm3
+	LONG $0xe314d8c5               // vunpcklps	%xmm3, %xmm4, %xmm4
+	LONG $0xcc16f0c5               // vmovlhps	%xmm4, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xd3       // cmpq	%rdx, %rbx
+	JLE  BB0_7
+	WORD $0x8948; BYTE $0xd8       // movq	%rbx, %rax
+	WORD $0x8949; BYTE $0xd0       // movq	%rdx, %r8
+	WORD $0x2948; BYTE $0xd0       // subq	%rdx, %rax
+	QUAD $0x000000e024848948       // movq	%rax, 224(%rsp)
+	LONG $0x01e88348               // subq	$1, %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_71
+	QUAD $0x00000110249c8b4c       // movq	272(%rsp), %r11
+	QUAD $0x0000010024ac8b4c       // movq	256(%rsp), %r13
+	QUAD $0x000000c024b48948       // movq	%rsi, 192(%rsp)
+	QUAD $0x0000011824a48b4c       // movq	280(%rsp), %r12
+	QUAD $0x000000b8248c8948       // movq	%rcx, 184(%rsp)
+	LONG $0x1a048d4a               // leaq	(%rdx,%r11), %rax
+	QUAD $0x00000108249c8b4c       // movq	264(%rsp), %r11
+	LONG $0x833c8d4d               // leaq	(%r11,%rax,4), %r15
+	LONG $0x32048d4a               // leaq	(%rdx,%r14), %rax
+	LONG $0x821c8d4d               // leaq	(%r10,%rax,4), %r11
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	LONG $0x822c8d4d               // leaq	(%r10,%rax,4), %r13
+	LONG $0x14048d49               // leaq	(%r12,%rdx), %rax
+	WORD $0x894c; BYTE $0xde       // movq	%r11, %rsi
+	QUAD $0x000000e8249c8b4c       // movq	232(%rsp), %r11
+	LONG $0x82248d4d               // leaq	(%r10,%rax,4), %r12
+	QUAD $0x000000f024848b48       // movq	240(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x82048d49               // leaq	(%r10,%rax,4), %rax
+	QUAD $0x000000d024848948       // movq	%rax, 208(%rsp)
+	QUAD $0x000000e024848b48       // movq	224(%rsp), %rax
+	QUAD $0x000000d0248c8b48       // movq	208(%rsp), %rcx
+	QUAD $0x000000d024948948       // movq	%rdx, 208(%rsp)
+	LONG $0x03e8c148               // shrq	$3, %rax
+	LONG $0x05e0c148               // salq	$5, %rax
+	QUAD $0x000000c824848948       // movq	%rax, 200(%rsp)
+	QUAD $0x000000c824948b48       // movq	200(%rsp), %rdx
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_9:
+	LONG $0x107cc1c4; WORD $0x0734             // vmovups	(%r15,%rax), %ymm6
+	LONG $0x0c594cc5; BYTE $0x06               // vmulps	(%rsi,%rax), %ymm6, %ymm9
+	LONG $0x594cc1c4; WORD $0x043c             // vmulps	(%r12,%rax), %ymm6, %ymm7
+	LONG $0x594c41c4; WORD $0x0544; BYTE $0x00 // vmulps	0(%r13,%rax), %ymm6, %ymm8
+	LONG $0x3459ccc5; BYTE $0x01               // vmulps	(%rcx,%rax), %ymm6, %ymm6
+	LONG $0x20c08348                           // addq	$32, %rax
+	LONG $0xc630c1c4; WORD $0xffd9             // vshufps	$255, %xmm9, %xmm9, %xmm3
+	LONG $0xefc6c0c5; BYTE $0xff               // vshufps	$255, %xmm7, %xmm7, %xmm5
+	LONG $0x1430c1c4; BYTE $0xe0               // vunpcklps	%xmm8, %xmm9, %xmm4
+	LONG $0xc63841c4; WORD $0x55e8             // vshufps	$85, %xmm8, %xmm8, %xmm13
+	LONG $0xc63841c4; WORD $0xffd0             // vshufps	$255, %xmm8, %xmm8, %xmm10
+	LONG $0x1460c1c4; BYTE $0xda               // vunpcklps	%xmm10, %xmm3, %xmm3
+	LONG $0xe61440c5                           // vunpcklps	%xmm6, %xmm7, %xmm12
+	LONG $0xf6c648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm14
+	LONG $0xdec648c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm11
+	LONG $0x1450c1c4; BYTE $0xeb               // vunpcklps	%xmm11, %xmm5, %xmm5
+	LONG $0x1658c1c4; BYTE $0xe4               // vmovlhps	%xmm12, %xmm4, %xmm4
+	LONG $0xe7c640c5; BYTE $0x55               // vshufps	$85, %xmm7, %xmm7, %xmm12
+	LONG $0x141841c4; BYTE $0xe6               // vunpcklps	%xmm14, %xmm12, %xmm12
+	LONG $0xf61548c5                           // vunpckhps	%xmm6, %xmm6, %xmm14
+	LONG $0xe158d8c5                           // vaddps	%xmm1, %xmm4, %xmm4
+	LONG $0xc630c1c4; WORD $0x55c9             // vshufps	$85, %xmm9, %xmm9, %xmm1
+	LONG $0x1470c1c4; BYTE $0xcd               // vunpcklps	%xmm13, %xmm1, %xmm1
+	LONG $0x153841c4; BYTE $0xe8               // vunpckhps	%xmm8, %xmm8, %xmm13
+	LONG $0x1670c1c4; BYTE $0xcc               // vmovlhps	%xmm12, %xmm1, %xmm1
+	LONG $0xe71540c5                           // vunpckhps	%xmm7, %xmm7, %xmm12
+	LONG $0xdd16e0c5                           // vmovlhps	%xmm5, %xmm3, %xmm3
+	LONG $0x141841c4; BYTE $0xe6               // vunpcklps	%xmm14, %xmm12, %xmm12
+	LONG $0x197d43c4; WORD $0x01c0             // vextractf128	$0x1, %ymm8, %xmm8
+	LONG $0x197de3c4; WORD $0x01f6             // vextractf128	$0x1, %ymm6, %xmm6
+	LONG $0xe158d8c5                           // vaddps	%xmm1, %xmm4, %xmm4
+	LONG $0x1530c1c4; BYTE $0xc9               // vunpckhps	%xmm9, %xmm9, %xmm1
+	LONG $0xd6c648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm10
+	LONG $0x1470c1c4; BYTE $0xcd               // vunpcklps	%xmm13, %xmm1, %xmm1
+	LONG $0x1670c1c4; BYTE $0xcc               // vmovlhps	%xmm12, %xmm1, %xmm1
+	LONG $0xe158d8c5                           // vaddps	%xmm1, %xmm4, %xmm4
+	LONG $0x197d63c4; WORD $0x01c9             // vextractf128	$0x1, %ymm9, %xmm1
+	LONG $0xc63841c4; WORD $0x55c8             // vshufps	$85, %xmm8, %xmm8, %xmm9
+	LONG $0x1470c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm1, %xmm5
+	LONG $0xdb58d8c5                           // vaddps	%xmm3, %xmm4, %xmm3
+	LONG $0x197de3c4; WORD $0x01fc             // vextractf128	$0x1, %ymm7, %xmm4
+	LONG $0xfe14d8c5                           // vunpcklps	%xmm6, %xmm4, %xmm7
+	LONG $0xef16d0c5                           // vmovlhps	%xmm7, %xmm5, %xmm5
+	LONG $0xfcc6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm7
+	LONG $0x1440c1c4; BYTE $0xfa               // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0xd61548c5                           // vunpckhps	%xmm6, %xmm6, %xmm10
+	LONG $0xdd58e0c5                           // vaddps	%xmm5, %xmm3, %xmm3
+	LONG $0xe9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm5
+	LONG $0x1450c1c4; BYTE $0xe9               // vunpcklps	%xmm9, %xmm5, %xmm5
+	LONG $0x153841c4; BYTE $0xc8               // vunpckhps	%xmm8, %xmm8, %xmm9
+	LONG $0xef16d0c5                           // vmovlhps	%xmm7, %xmm5, %xmm5
+	LONG $0xfc15d8c5                           // vunpckhps	%xmm4, %xmm4, %xmm7
+	LONG $0xc63841c4; WORD $0xffc0             // vshufps	$255, %xmm8, %xmm8, %xmm8
+	LONG $0xe4c6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm4
+	LONG $0x1440c1c4; BYTE $0xfa               // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0xf6c6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm6
+	LONG $0xe614d8c5                           // vunpcklps	%xmm6, %xmm4, %xmm4
+	LONG $0xdd58e0c5                           // vaddps	%xmm5, %xmm3, %xmm3
+	LONG $0xe915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm5
+	LONG $0xc9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0x1470c1c4; BYTE $0xc8               // vunpcklps	%xmm8, %xmm1, %xmm1
+	LONG $0x1450c1c4; BYTE $0xe9               // vunpcklps	%xmm9, %xmm5, %xmm5
+	LONG $0xcc16f0c5                           // vmovlhps	%xmm4, %xmm1, %xmm1
+	LONG $0xef16d0c5                           // vmovlhps	%xmm7, %xmm5, %xmm5
+	LONG $0xdd58e0c5                           // vaddps	%xmm5, %xmm3, %xmm3
+	LONG $0xc958e0c5                           // vaddps	%xmm1, %xmm3, %xmm1
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JNE  BB0_9
+	QUAD $0x000000e024bc8b4c                   // movq	224(%rsp), %r15
+	QUAD $0x000000d024948b48                   // movq	208(%rsp), %rdx
+	QUAD $0x000000e8249c894c                   // movq	%r11, 232(%rsp)
+	QUAD $0x000000c024b48b48                   // movq	192(%rsp), %rsi
+	QUAD $0x000000b8248c8b48                   // movq	184(%rsp), %rcx
+	WORD $0x894c; BYTE $0xf8                   // movq	%r15, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x07e78341                           // andl	$7, %r15d
+	JE   BB0_7
+
+BB0_8:
+	QUAD $0x000000e024ac8b4c       // movq	224(%rsp), %r13
+	LONG $0xc11570c5               // vunpckhps	%xmm1, %xmm1, %xmm8
+	LONG $0xe128f8c5               // vmovaps	%xmm1, %xmm4
+	LONG $0xc9c670c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm9
+	LONG $0xe9c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm5
+	WORD $0x2949; BYTE $0xc5       // subq	%rax, %r13
+	LONG $0xff658d4d               // leaq	-1(%r13), %r12
+	LONG $0x02fc8349               // cmpq	$2, %r12
+	JBE  BB0_12
+	QUAD $0x0000011024bc8b4c       // movq	272(%rsp), %r15
+	LONG $0x00248d4e               // leaq	(%rax,%r8), %r12
+	WORD $0x014d; BYTE $0xfc       // addq	%r15, %r12
+	QUAD $0x0000010824bc8b4c       // movq	264(%rsp), %r15
+	LONG $0x107881c4; WORD $0xa71c // vmovups	(%r15,%r12,4), %xmm3
+	QUAD $0x0000010024bc8b4c       // movq	256(%rsp), %r15
+	LONG $0x06248d4d               // leaq	(%r14,%rax), %r12
+	WORD $0x014d; BYTE $0xc4       // addq	%r8, %r12
+	LONG $0x596081c4; WORD $0xa23c // vmulps	(%r10,%r12,4), %xmm3, %xmm7
+	LONG $0x07248d4d               // leaq	(%r15,%rax), %r12
+	QUAD $0x0000011824bc8b4c       // movq	280(%rsp), %r15
+	WORD $0x014d; BYTE $0xc4       // addq	%r8, %r12
+	LONG $0x596081c4; WORD $0xa234 // vmulps	(%r10,%r12,4), %xmm3, %xmm6
+	LONG $0x07248d4d               // leaq	(%r15,%rax), %r12
+	QUAD $0x000000f024bc8b4c       // movq	240(%rsp), %r15
+	WORD $0x014d; BYTE $0xc4       // addq	%r8, %r12
+	WORD $0x014c; BYTE $0xf8       // addq	%r15, %rax
+	LONG $0xcc58c2c5               // vaddss	%xmm4, %xmm7, %xmm1
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0xefc640c5; BYTE $0x55   // vshufps	$85, %xmm7, %xmm7, %xmm13
+	LONG $0xe558cac5               // vaddss	%xmm5, %xmm6, %xmm4
+	LONG $0x596081c4; WORD $0xa22c // vmulps	(%r10,%r12,4), %xmm3, %xmm5
+	LONG $0xe6c648c5; BYTE $0x55   // vshufps	$85, %xmm6, %xmm6, %xmm12
+	LONG $0xde1548c5               // vunpckhps	%xmm6, %xmm6, %xmm11
+	LONG $0x5960c1c4; WORD $0x821c // vmulps	(%r10,%rax,4), %xmm3, %xmm3
+	LONG $0xe95812c5               // vaddss	%xmm1, %xmm13, %xmm13
+	LONG $0xcf15c0c5               // vunpckhps	%xmm7, %xmm7, %xmm1
+	WORD $0x894c; BYTE $0xe8       // movq	%r13, %rax
+	LONG $0xffc6c0c5; BYTE $0xff   // vshufps	$255, %xmm7, %xmm7, %xmm7
+	LONG $0xf6c6c8c5; BYTE $0xff   // vshufps	$255, %xmm6, %xmm6, %xmm6
+	LONG $0xfce08348               // andq	$-4, %rax
+	LONG $0xe4581ac5               // vaddss	%xmm4, %xmm12, %xmm12
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x03e58341               // andl	$3, %r13d
+	LONG $0x5872c1c4; BYTE $0xcd   // vaddss	%xmm13, %xmm1, %xmm1
+	LONG $0x5852c1c4; BYTE $0xe0   // vaddss	%xmm8, %xmm5, %xmm4
+	LONG $0xd5c650c5; BYTE $0x55   // vshufps	$85, %xmm5, %xmm5, %xmm10
+	LONG $0x586241c4; BYTE $0xc1   // vaddss	%xmm9, %xmm3, %xmm8
+	LONG $0xcbc660c5; BYTE $0x55   // vshufps	$85, %xmm3, %xmm3, %xmm9
+	LONG $0xcf58f2c5               // vaddss	%xmm7, %xmm1, %xmm1
+	LONG $0x5822c1c4; BYTE $0xfc   // vaddss	%xmm12, %xmm11, %xmm7
+	LONG $0xd4582ac5               // vaddss	%xmm4, %xmm10, %xmm10
+	LONG $0xe515d0c5               // vunpckhps	%xmm5, %xmm5, %xmm4
+	LONG $0xedc6d0c5; BYTE $0xff   // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0x583241c4; BYTE $0xc8   // vaddss	%xmm8, %xmm9, %xmm9
+	LONG $0xc31560c5               // vunpckhps	%xmm3, %xmm3, %xmm8
+	LONG $0xdbc6e0c5; BYTE $0xff   // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xf658c2c5               // vaddss	%xmm6, %xmm7, %xmm6
+	LONG $0x585ac1c4; BYTE $0xe2   // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0xce14f0c5               // vunpcklps	%xmm6, %xmm1, %xmm1
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0x583ac1c4; BYTE $0xe9   // vaddss	%xmm9, %xmm8, %xmm5
+	LONG $0xeb58d2c5               // vaddss	%xmm3, %xmm5, %xmm5
+	LONG $0xe514d8c5               // vunpcklps	%xmm5, %xmm4, %xmm4
+	LONG $0xcc16f0c5               // vmovlhps	%xmm4, %xmm1, %xmm1
+	JE   BB0_7
+
+BB0_12:
+	QUAD $0x0000011024848b48                   // movq	272(%rsp), %rax
+	QUAD $0x0000010824bc8b4c                   // movq	264(%rsp), %r15
+	LONG $0x16048d4d                           // leaq	(%r14,%rdx), %r8
+	QUAD $0x0000011824a48b4c                   // movq	280(%rsp), %r12
+	QUAD $0x000000f0249c8b4c                   // movq	240(%rsp), %r11
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x107a81c4; WORD $0x821c             // vmovss	(%r10,%r8,4), %xmm3
+	LONG $0x1879c2c4; WORD $0x872c             // vbroadcastss	(%r15,%rax,4), %xmm5
+	QUAD $0x0000010024bc8b4c                   // movq	256(%rsp), %r15
+	LONG $0x142c8d4d                           // leaq	(%r12,%rdx), %r13
+	WORD $0x894d; BYTE $0xdc                   // movq	%r11, %r12
+	WORD $0x0149; BYTE $0xd4                   // addq	%rdx, %r12
+	LONG $0x107a81c4; WORD $0xaa24             // vmovss	(%r10,%r13,4), %xmm4
+	LONG $0x17048d49                           // leaq	(%r15,%rdx), %rax
+	LONG $0x215983c4; WORD $0xa224; BYTE $0x10 // vinsertps	$0x10, (%r10,%r12,4), %xmm4, %xmm4
+	LONG $0x2161c3c4; WORD $0x821c; BYTE $0x10 // vinsertps	$0x10, (%r10,%rax,4), %xmm3, %xmm3
+	LONG $0x01428d48                           // leaq	1(%rdx), %rax
+	LONG $0xdc16e0c5                           // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0xb851e2c4; BYTE $0xcb               // vfmadd231ps	%xmm3, %xmm5, %xmm1
+	WORD $0x3948; BYTE $0xc3                   // cmpq	%rax, %rbx
+	JLE  BB0_7
+	QUAD $0x0000011024848b4c                   // movq	272(%rsp), %r8
+	QUAD $0x0000010824ac8b4c                   // movq	264(%rsp), %r13
+	LONG $0x06248d4d                           // leaq	(%r14,%rax), %r12
+	LONG $0x02c28348                           // addq	$2, %rdx
+	LONG $0x107a81c4; WORD $0xa21c             // vmovss	(%r10,%r12,4), %xmm3
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x187982c4; WORD $0x856c; BYTE $0x00 // vbroadcastss	0(%r13,%r8,4), %xmm5
+	QUAD $0x0000011824ac8b4c                   // movq	280(%rsp), %r13
+	LONG $0x07048d4d                           // leaq	(%r15,%rax), %r8
+	LONG $0x216183c4; WORD $0x821c; BYTE $0x10 // vinsertps	$0x10, (%r10,%r8,4), %xmm3, %xmm3
+	WORD $0x0149; BYTE $0xc5                   // addq	%rax, %r13
+	WORD $0x014c; BYTE $0xd8                   // addq	%r11, %rax
+	LONG $0x107a81c4; WORD $0xaa24             // vmovss	(%r10,%r13,4), %xmm4
+	LONG $0x2159c3c4; WORD $0x8224; BYTE $0x10 // vinsertps	$0x10, (%r10,%rax,4), %xmm4, %xmm4
+	LONG $0xdc16e0c5                           // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0xb851e2c4; BYTE $0xcb               // vfmadd231ps	%xmm3, %xmm5, %xmm1
+	WORD $0x3948; BYTE $0xd3                   // cmpq	%rdx, %rbx
+	JLE  BB0_7
+	QUAD $0x0000011024848b4c                   // movq	272(%rsp), %r8
+	QUAD $0x0000010824ac8b4c                   // movq	264(%rsp), %r13
+	LONG $0x10048d49                           // leaq	(%r8,%rdx), %rax
+	LONG $0x16048d4d                           // leaq	(%r14,%rdx), %r8
+	LONG $0x1879c2c4; WORD $0x856c; BYTE $0x00 // vbroadcastss	0(%r13,%rax,4), %xmm5
+	WORD $0x894c; BYTE $0xf8                   // movq	%r15, %rax
+	QUAD $0x0000011824ac8b4c                   // movq	280(%rsp), %r13
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x107a81c4; WORD $0x821c             // vmovss	(%r10,%r8,4), %xmm3
+	LONG $0x15648d4d; BYTE $0x00               // leaq	0(%r13,%rdx), %r12
+	WORD $0x014c; BYTE $0xda                   // addq	%r11, %rdx
+	LONG $0x2161c3c4; WORD $0x821c; BYTE $0x10 // vinsertps	$0x10, (%r10,%rax,4), %xmm3, %xmm3
+	LONG $0x107a81c4; WORD $0xa224             // vmovss	(%r10,%r12,4), %xmm4
+	LONG $0x2159c3c4; WORD $0x9224; BYTE $0x10 // vinsertps	$0x10, (%r10,%rdx,4), %xmm4, %xmm4
+	LONG $0xdc16e0c5                           // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0xb851e2c4; BYTE $0xcb               // vfmadd231ps	%xmm3, %xmm5, %xmm1
+
+BB0_7:
+	LONG $0xc959f8c5             // vmulps	%xmm1, %xmm0, %xmm1
+	QUAD $0x000000d824848b48     // movq	216(%rsp), %rax
+	QUAD $0x0000008824948b48     // movq	136(%rsp), %rdx
+	QUAD $0x000000b024bc8b4c     // movq	176(%rsp), %r15
+	QUAD $0x0000011824bc014c     // addq	%r15, 280(%rsp)
+	LONG $0x10c08348             // addq	$16, %rax
+	WORD $0x0148; BYTE $0xd7     // addq	%rdx, %rdi
+	WORD $0x0149; BYTE $0xd1     // addq	%rdx, %r9
+	WORD $0x0148; BYTE $0xd1     // addq	%rdx, %rcx
+	QUAD $0x000000f024bc014c     // addq	%r15, 240(%rsp)
+	WORD $0x014d; BYTE $0xfe     // addq	%r15, %r14
+	WORD $0x0148; BYTE $0xd6     // addq	%rdx, %rsi
+	LONG $0x4811f8c5; BYTE $0xf0 // vmovups	%xmm1, -16(%rax)
+	QUAD $0x000000d824848948     // movq	%rax, 216(%rsp)
+	QUAD $0x000000a024843948     // cmpq	%rax, 160(%rsp)
+	JNE  BB0_14
+	LONG $0x24448b48; BYTE $0x10 // movq	16(%rsp), %rax
+	LONG $0x24748b4c; BYTE $0x60 // movq	96(%rsp), %r14
+	LONG $0x247c8b4c; BYTE $0x58 // movq	88(%rsp), %r15
+	QUAD $0x000000e8249c8b4c     // movq	232(%rsp), %r11
+	LONG $0x24648b4c; BYTE $0x50 // movq	80(%rsp), %r12
+	WORD $0x8948; BYTE $0xc7     // movq	%rax, %rdi
+	WORD $0x3949; BYTE $0xc6     // cmpq	%rax, %r14
+	JLE  BB0_135
+
+BB0_16:
+	WORD $0x8949; BYTE $0xf8 // movq	%rdi, %r8
+	QUAD $0x000000e824a4894c // movq	%r12, 232(%rsp)
+	LONG $0xc3af0f4c         // imulq	%rbx, %r8
+	QUAD $0x000000f024b4894c // movq	%r14, 240(%rsp)
+	QUAD $0x0000010824b48b4c // movq	264(%rsp), %r14
+	QUAD $0x0000010024bc894c // movq	%r15, 256(%rsp)
+	QUAD $0x0000011024bc8b4c // movq	272(%rsp), %r15
+	LONG $0x820c8d4b         // leaq	(%r10,%r8,4), %rcx
+
+BB0_32:
+	LONG $0x07fb8348             // cmpq	$7, %rbx
+	JLE  BB0_74
+	LONG $0xdb57e0c5             // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_24:
+	LONG $0x107cc1c4; WORD $0x837c; BYTE $0xe0 // vmovups	-32(%r11,%rax,4), %ymm7
+	LONG $0xb845e2c4; WORD $0x815c; BYTE $0xe0 // vfmadd231ps	-32(%rcx,%rax,4), %ymm7, %ymm3
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd8                   // cmpq	%rbx, %rax
+	JLE  BB0_24
+	QUAD $0x000000a824948b48                   // movq	168(%rsp), %rdx
+
+BB0_23:
+	LONG $0x197de3c4; WORD $0x01d9 // vextractf128	$0x1, %ymm3, %xmm1
+	LONG $0xcb58f0c5               // vaddps	%xmm3, %xmm1, %xmm1
+	LONG $0xd912f0c5               // vmovhlps	%xmm1, %xmm1, %xmm3
+	LONG $0xcb58f0c5               // vaddps	%xmm3, %xmm1, %xmm1
+	LONG $0xd916fac5               // vmovshdup	%xmm1, %xmm3
+	LONG $0xcb58f2c5               // vaddss	%xmm3, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xd3       // cmpq	%rdx, %rbx
+	JLE  BB0_25
+	WORD $0x8948; BYTE $0xde       // movq	%rbx, %rsi
+	QUAD $0x0000011824948948       // movq	%rdx, 280(%rsp)
+	WORD $0x2948; BYTE $0xd6       // subq	%rdx, %rsi
+	LONG $0xff468d48               // leaq	-1(%rsi), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_75
+	LONG $0x3a048d4a               // leaq	(%rdx,%r15), %rax
+	WORD $0x8949; BYTE $0xf1       // movq	%rsi, %r9
+	LONG $0x862c8d4d               // leaq	(%r14,%rax,4), %r13
+	LONG $0x03e9c149               // shrq	$3, %r9
+	LONG $0x02048d4a               // leaq	(%rdx,%r8), %rax
+	LONG $0x82248d4d               // leaq	(%r10,%rax,4), %r12
+	LONG $0x05e1c149               // salq	$5, %r9
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_27:
+	LONG $0x107cc1c4; WORD $0x043c             // vmovups	(%r12,%rax), %ymm7
+	LONG $0x5944c1c4; WORD $0x0564; BYTE $0x00 // vmulps	0(%r13,%rax), %ymm7, %ymm4
+	LONG $0x20c08348                           // addq	$32, %rax
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xdcc6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm3
+	LONG $0xecc6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm5
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0xcc15d8c5                           // vunpckhps	%xmm4, %xmm4, %xmm1
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0x197de3c4; WORD $0x01e3             // vextractf128	$0x1, %ymm4, %xmm3
+	LONG $0xe3c6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm4
+	LONG $0xe958d2c5                           // vaddss	%xmm1, %xmm5, %xmm5
+	LONG $0xcd58e2c5                           // vaddss	%xmm5, %xmm3, %xmm1
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0xcb15e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm1
+	LONG $0xdbc6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	WORD $0x394c; BYTE $0xc8                   // cmpq	%r9, %rax
+	JNE  BB0_27
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x07c6f640                           // testb	$7, %sil
+	JE   BB0_25
+
+BB0_26:
+	WORD $0x2948; BYTE $0xc6       // subq	%rax, %rsi
+	LONG $0xff4e8d4c               // leaq	-1(%rsi), %r9
+	LONG $0x02f98349               // cmpq	$2, %r9
+	JBE  BB0_30
+	QUAD $0x00000118248c8b4c       // movq	280(%rsp), %r9
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x000c8d4e               // leaq	(%rax,%r8), %r9
+	WORD $0x014c; BYTE $0xf8       // addq	%r15, %rax
+	LONG $0x1078c1c4; WORD $0x861c // vmovups	(%r14,%rax,4), %xmm3
+	LONG $0x596081c4; WORD $0x8a1c // vmulps	(%r10,%r9,4), %xmm3, %xmm3
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x03       // andl	$3, %esi
+	LONG $0xc958e2c5               // vaddss	%xmm1, %xmm3, %xmm1
+	LONG $0xe3c6e0c5; BYTE $0x55   // vshufps	$85, %xmm3, %xmm3, %xmm4
+	LONG $0xe158dac5               // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0xcb15e0c5               // vunpckhps	%xmm3, %xmm3, %xmm1
+	LONG $0xdbc6e0c5; BYTE $0xff   // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xcc58f2c5               // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xcb58f2c5               // vaddss	%xmm3, %xmm1, %xmm1
+	JE   BB0_25
+
+BB0_30:
+	LONG $0x10048d49               // leaq	(%r8,%rdx), %rax
+	LONG $0x17348d49               // leaq	(%r15,%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0xb63c // vmovss	(%r14,%rsi,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x820c // vfmadd231ss	(%r10,%rax,4), %xmm7, %xmm1
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3948; BYTE $0xc3       // cmpq	%rax, %rbx
+	JLE  BB0_25
+	LONG $0x07348d49               // leaq	(%r15,%rax), %rsi
+	LONG $0x02c28348               // addq	$2, %rdx
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x107ac1c4; WORD $0xb63c // vmovss	(%r14,%rsi,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x820c // vfmadd231ss	(%r10,%rax,4), %xmm7, %xmm1
+	WORD $0x3948; BYTE $0xd3       // cmpq	%rdx, %rbx
+	JLE  BB0_25
+	LONG $0x10048d49               // leaq	(%r8,%rdx), %rax
+	WORD $0x014c; BYTE $0xfa       // addq	%r15, %rdx
+	LONG $0x107ac1c4; WORD $0x823c // vmovss	(%r10,%rax,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x960c // vfmadd231ss	(%r14,%rdx,4), %xmm7, %xmm1
+
+BB0_25:
+	LONG $0xc959eac5               // vmulss	%xmm1, %xmm2, %xmm1
+	QUAD $0x0000009824848b48       // movq	152(%rsp), %rax
+	WORD $0x0149; BYTE $0xd8       // addq	%rbx, %r8
+	LONG $0x0c11fac5; BYTE $0xb8   // vmovss	%xmm1, (%rax,%rdi,4)
+	QUAD $0x000000b024848b48       // movq	176(%rsp), %rax
+	LONG $0x01c78348               // addq	$1, %rdi
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	QUAD $0x000000f024bc3948       // cmpq	%rdi, 240(%rsp)
+	JG   BB0_32
+	LONG $0x247c8348; WORD $0x0070 // cmpq	$0, 112(%rsp)
+	QUAD $0x000000f024b48b4c       // movq	240(%rsp), %r14
+	QUAD $0x0000010024bc8b4c       // movq	256(%rsp), %r15
+	QUAD $0x000000e824a48b4c       // movq	232(%rsp), %r12
+	JNE  BB0_136
+
+BB0_22:
+	QUAD $0x0000009824848b48 // movq	152(%rsp), %rax
+	LONG $0xed57d0c5         // vxorps	%xmm5, %xmm5, %xmm5
+	LONG $0x2010fac5         // vmovss	(%rax), %xmm4
+	WORD $0xc031             // xorl	%eax, %eax
+	LONG $0x01fe8349         // cmpq	$1, %r14
+	JLE  BB0_19
+
+BB0_18:
+	QUAD $0x0000009824848b48     // movq	152(%rsp), %rax
+	LONG $0x24548b48; BYTE $0x78 // movq	120(%rsp), %rdx
+	LONG $0x04c08348             // addq	$4, %rax
+
+BB0_49:
+	LONG         $0x0810fac5                     // vmovss	(%rax), %xmm1
+	LONG         $0x04c08348                     // addq	$4, %rax
+	LONG         $0xe45ff2c5                     // vmaxss	%xmm4, %xmm1, %xmm4
+	WORD         $0x3948; BYTE $0xc2             // cmpq	%rax, %rdx
+	JNE          BB0_49
+	LONG         $0x187d62c4; BYTE $0xcc         // vbroadcastss	%xmm4, %ymm9
+	LONG         $0x07fe8349                     // cmpq	$7, %r14
+	JLE          BB0_50
+	LONG         $0x24448b48; BYTE $0x68         // movq	104(%rsp), %rax
+	LONG         $0x00007fb9; BYTE $0x00         // movl	$127, %ecx
+	QUAD         $0x0000009024bc8b48             // movq	144(%rsp), %rdi
+	LONG         $0xed57d0c5                     // vxorps	%xmm5, %xmm5, %xmm5
+	LONG         $0xc16e79c5                     // vmovd	%ecx, %xmm8
+	LONG         $0xef2941c4; BYTE $0xd2         // vpxor	%xmm10, %xmm10, %xmm10
+	VBROADCASTSS CPI0_3<>(SB), Y15               // vbroadcastss	.LCPI0_3(%rip), %ymm15
+	VBROADCASTSS CPI0_5<>(SB), Y14               // vbroadcastss	.LCPI0_5(%rip), %ymm14
+	LONG         $0xf8e08348                     // andq	$-8, %rax
+	LONG         $0x587d42c4; BYTE $0xc0         // vpbroadcastd	%xmm8, %ymm8
+	VBROADCASTSS CPI0_19<>(SB), Y13              // vbroadcastss	.LCPI0_19(%rip), %ymm13
+	VBROADCASTSS CPI0_21<>(SB), Y12              // vbroadcastss	.LCPI0_21(%rip), %ymm12
+	VBROADCASTSS CPI0_23<>(SB), Y6               // vbroadcastss	.LCPI0_23(%rip), %ymm6
+	WORD         $0x0148; BYTE $0xf8             // addq	%rdi, %rax
+	VBROADCASTSS CPI0_0<>(SB), Y11               // vbroadcastss	.LCPI0_0(%rip), %ymm11
+	QUAD         $0x000118249411fac5; BYTE $0x00 // vmovss	%xmm2, 280(%rsp)
+	QUAD         $0x0000f0248429f8c5; BYTE $0x00 // vmovaps	%xmm0, 240(%rsp)
+	LONG         $0x84548d49; BYTE $0x20         // leaq	32(%r12,%rax,4), %rdx
+	QUAD         $0x0000009824848b48             // movq	152(%rsp), %rax
+
+BB0_51:
+	LONG         $0x1010fcc5                     // vmovups	(%rax), %ymm2
+	LONG         $0x20c08348                     // addq	$32, %rax
+	VBROADCASTSS CPI0_13<>(SB), Y0               // vbroadcastss	.LCPI0_13(%rip), %ymm0
+	LONG         $0x5c6cc1c4; BYTE $0xc9         // vsubps	%ymm9, %ymm2, %ymm1
+	VMULPS       CPI0_6<>(SB), Y1, Y2            // vmulps	.LCPI0_6(%rip), %ymm1, %ymm2
+	LONG         $0xc274c1c4; WORD $0x1eff       // vcmpps	$30, %ymm15, %ymm1, %ymm7
+	LONG         $0xc274c1c4; WORD $0x11de       // vcmpps	$17, %ymm14, %ymm1, %ymm3
+	LONG         $0x087de3c4; WORD $0x08d2       // vroundps	$8, %ymm2, %ymm2
+	VFNMADD231PS CPI0_8<>(SB), Y2, Y1            // vfnmadd231ps	.LCPI0_8(%rip), %ymm2, %ymm1
+	VFNMADD231PS CPI0_10<>(SB), Y2, Y1           // vfnmadd231ps	.LCPI0_10(%rip), %ymm2, %ymm1
+	LONG         $0xd25bfdc5                     // vcvtps2dq	%ymm2, %ymm2
+	LONG         $0xfe6dc1c4; BYTE $0xd0         // vpaddd	%ymm8, %ymm2, %ymm2
+	VFMADD213PS  CPI0_14<>(SB), Y1, Y0           // vfmadd213ps	.LCPI0_14(%rip), %ymm1, %ymm0
+	LONG         $0xf272edc5; BYTE $0x17         // vpslld	$23, %ymm2, %ymm2
+	VFMADD213PS  CPI0_16<>(SB), Y1, Y0           // vfmadd213ps	.LCPI0_16(%rip), %ymm1, %ymm0
+	LONG         $0xdb66adc5                     // vpcmpgtd	%ymm3, %ymm10, %ymm3
+	LONG         $0x9815e2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm13, %ymm0
+	LONG         $0x981de2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm12, %ymm0
+	LONG         $0x984de2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm6, %ymm0
+	LONG         $0x984de2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm6, %ymm0
+	LONG         $0xc259fcc5                     // vmulps	%ymm2, %ymm0, %ymm0
+	LONG         $0x4a7dc3c4; WORD $0x70c3       // vblendvps	%ymm7, %ymm11, %ymm0, %ymm0
+	LONG         $0xd855e4c5                     // vandnps	%ymm0, %ymm3, %ymm3
+	LONG         $0x5811fcc5; BYTE $0xe0         // vmovups	%ymm3, -32(%rax)
+	LONG         $0xeb58d4c5                     // vaddps	%ymm3, %ymm5, %ymm5
+	WORD         $0x3948; BYTE $0xc2             // cmpq	%rax, %rdx
+	JNE          BB0_51
+	QUAD         $0x000118249410fac5; BYTE $0x00 // vmovss	280(%rsp), %xmm2
+	WORD         $0x894c; BYTE $0xf8             // movq	%r15, %rax
+	QUAD         $0x0000f0248428f8c5; BYTE $0x00 // vmovaps	240(%rsp), %xmm0
+
+BB0_19:
+	LONG $0x197de3c4; WORD $0x01e9 // vextractf128	$0x1, %ymm5, %xmm1
+	LONG $0xcd58f0c5               // vaddps	%xmm5, %xmm1, %xmm1
+	LONG $0xd912f0c5               // vmovhlps	%xmm1, %xmm1, %xmm3
+	LONG $0xcb58f0c5               // vaddps	%xmm3, %xmm1, %xmm1
+	LONG $0xd916fac5               // vmovshdup	%xmm1, %xmm3
+	LONG $0xcb58f2c5               // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xd928f8c5               // vmovaps	%xmm1, %xmm3
+	WORD $0x3949; BYTE $0xc6       // cmpq	%rax, %r14
+	JLE  BB0_52
+
+BB0_67:
+	QUAD   $0x0000009024bc8b48     // movq	144(%rsp), %rdi
+	VMOVSD CPI0_31<>(SB), X9       // vmovsd	.LCPI0_31(%rip), %xmm9
+	VMOVSD CPI0_32<>(SB), X8       // vmovsd	.LCPI0_32(%rip), %xmm8
+	VMOVSD CPI0_33<>(SB), X7       // vmovsd	.LCPI0_33(%rip), %xmm7
+	WORD   $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	VMOVSD CPI0_34<>(SB), X6       // vmovsd	.LCPI0_34(%rip), %xmm6
+	LONG   $0x24548b48; BYTE $0x78 // movq	120(%rsp), %rdx
+	VMOVSD CPI0_35<>(SB), X5       // vmovsd	.LCPI0_35(%rip), %xmm5
+	LONG   $0x84048d49             // leaq	(%r12,%rax,4), %rax
+
+BB0_54:
+	LONG        $0x10107ac5                           // vmovss	(%rax), %xmm10
+	VMOVSS      CPI0_0<>(SB), X1                      // vmovss	.LCPI0_0(%rip), %xmm1
+	LONG        $0xd45c2ac5                           // vsubss	%xmm4, %xmm10, %xmm10
+	VCOMISS     CPI0_26<>(SB), X10                    // vcomiss	.LCPI0_26(%rip), %xmm10
+	JA          BB0_53
+	VMOVSS      CPI0_27<>(SB), X15                    // vmovss	.LCPI0_27(%rip), %xmm15
+	LONG        $0xc957f0c5                           // vxorps	%xmm1, %xmm1, %xmm1
+	LONG        $0x2f7841c4; BYTE $0xfa               // vcomiss	%xmm10, %xmm15
+	JA          BB0_53
+	LONG        $0x5a2a41c4; BYTE $0xda               // vcvtss2sd	%xmm10, %xmm10, %xmm11
+	VMULSD      CPI0_28<>(SB), X11, X10               // vmulsd	.LCPI0_28(%rip), %xmm11, %xmm10
+	VMOVSD      CPI0_44<>(SB), X12                    // vmovsd	.LCPI0_44(%rip), %xmm12
+	VANDPD      CPI0_29<>(SB), X10, X1                // vandpd	.LCPI0_29(%rip), %xmm10, %xmm1
+	VORPD       CPI0_30<>(SB), X1, X1                 // vorpd	.LCPI0_30(%rip), %xmm1, %xmm1
+	LONG        $0xd1582bc5                           // vaddsd	%xmm1, %xmm10, %xmm10
+	LONG        $0x0b2943c4; WORD $0x03d2             // vroundsd	$3, %xmm10, %xmm10, %xmm10
+	LONG        $0xbda942c4; BYTE $0xd9               // vfnmadd231sd	%xmm9, %xmm10, %xmm11
+	LONG        $0x2cfbc1c4; BYTE $0xca               // vcvttsd2siq	%xmm10, %rcx
+	LONG        $0xffc18148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rcx
+	LONG        $0xbda942c4; BYTE $0xd8               // vfnmadd231sd	%xmm8, %xmm10, %xmm11
+	LONG        $0x34e1c148                           // salq	$52, %rcx
+	LONG        $0x6ef961c4; BYTE $0xf9               // vmovq	%rcx, %xmm15
+	LONG        $0xd91123c5                           // vmovsd	%xmm11, %xmm11, %xmm1
+	LONG        $0x99c9e2c4; BYTE $0xcf               // vfmadd132sd	%xmm7, %xmm6, %xmm1
+	LONG        $0x99d1c2c4; BYTE $0xcb               // vfmadd132sd	%xmm11, %xmm5, %xmm1
+	VFMADD213SD CPI0_36<>(SB), X11, X1                // vfmadd213sd	.LCPI0_36(%rip), %xmm11, %xmm1
+	VFMADD213SD CPI0_37<>(SB), X11, X1                // vfmadd213sd	.LCPI0_37(%rip), %xmm11, %xmm1
+	VFMADD213SD CPI0_38<>(SB), X11, X1                // vfmadd213sd	.LCPI0_38(%rip), %xmm11, %xmm1
+	VFMADD213SD CPI0_39<>(SB), X11, X1                // vfmadd213sd	.LCPI0_39(%rip), %xmm11, %xmm1
+	VFMADD213SD CPI0_40<>(SB), X11, X1                // vfmadd213sd	.LCPI0_40(%rip), %xmm11, %xmm1
+	VFMADD213SD CPI0_41<>(SB), X11, X1                // vfmadd213sd	.LCPI0_41(%rip), %xmm11, %xmm1
+	VFMADD213SD CPI0_42<>(SB), X11, X1                // vfmadd213sd	.LCPI0_42(%rip), %xmm11, %xmm1
+	VFMADD213SD CPI0_43<>(SB), X11, X1                // vfmadd213sd	.LCPI0_43(%rip), %xmm11, %xmm1
+	LONG        $0x9999c2c4; BYTE $0xcb               // vfmadd132sd	%xmm11, %xmm12, %xmm1
+	LONG        $0x9999c2c4; BYTE $0xcb               // vfmadd132sd	%xmm11, %xmm12, %xmm1
+	LONG        $0x5973c1c4; BYTE $0xcf               // vmulsd	%xmm15, %xmm1, %xmm1
+	LONG        $0xc95af3c5                           // vcvtsd2ss	%xmm1, %xmm1, %xmm1
+
+BB0_53:
+	LONG   $0x0811fac5             // vmovss	%xmm1, (%rax)
+	LONG   $0x04c08348             // addq	$4, %rax
+	LONG   $0xd958e2c5             // vaddss	%xmm1, %xmm3, %xmm3
+	WORD   $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JNE    BB0_54
+	VMOVSS CPI0_23<>(SB), X7       // vmovss	.LCPI0_23(%rip), %xmm7
+	WORD   $0xc031                 // xorl	%eax, %eax
+	LONG   $0xdb5ec2c5             // vdivss	%xmm3, %xmm7, %xmm3
+	LONG   $0x187de2c4; BYTE $0xe3 // vbroadcastss	%xmm3, %ymm4
+	LONG   $0x07fe8349             // cmpq	$7, %r14
+	JLE    BB0_58
+
+BB0_66:
+	LONG $0x24448b48; BYTE $0x68 // movq	104(%rsp), %rax
+	QUAD $0x0000009024bc8b48     // movq	144(%rsp), %rdi
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	LONG $0x84548d49; BYTE $0x20 // leaq	32(%r12,%rax,4), %rdx
+	QUAD $0x0000009824848b48     // movq	152(%rsp), %rax
+
+BB0_57:
+	LONG $0x0859dcc5             // vmulps	(%rax), %ymm4, %ymm1
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4811fcc5; BYTE $0xe0 // vmovups	%ymm1, -32(%rax)
+	WORD $0x3948; BYTE $0xd0     // cmpq	%rdx, %rax
+	JNE  BB0_57
+	WORD $0x894c; BYTE $0xf8     // movq	%r15, %rax
+
+BB0_56:
+	WORD $0x3949; BYTE $0xc6 // cmpq	%rax, %r14
+	JLE  BB0_63
+
+BB0_58:
+	WORD $0x894c; BYTE $0xf2 // movq	%r14, %rdx
+	WORD $0x8948; BYTE $0xc1 // movq	%rax, %rcx
+	WORD $0x2948; BYTE $0xc2 // subq	%rax, %rdx
+	LONG $0xff728d48         // leaq	-1(%rdx), %rsi
+	LONG $0x06fe8348         // cmpq	$6, %rsi
+	JBE  BB0_81
+	QUAD $0x0000009024bc8b48 // movq	144(%rsp), %rdi
+	LONG $0x07348d48         // leaq	(%rdi,%rax), %rsi
+	LONG $0xb4348d49         // leaq	(%r12,%rsi,4), %rsi
+	LONG $0x2659dcc5         // vmulps	(%rsi), %ymm4, %ymm4
+	LONG $0x2611fcc5         // vmovups	%ymm4, (%rsi)
+	WORD $0x8948; BYTE $0xd6 // movq	%rdx, %rsi
+	LONG $0xf8e68348         // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0 // addq	%rsi, %rax
+	WORD $0xc2f6; BYTE $0x07 // testb	$7, %dl
+	JE   BB0_63
+
+BB0_61:
+	WORD $0x2948; BYTE $0xf2     // subq	%rsi, %rdx
+	LONG $0xff7a8d48             // leaq	-1(%rdx), %rdi
+	LONG $0x02ff8348             // cmpq	$2, %rdi
+	JBE  BB0_64
+	QUAD $0x0000009024bc8b48     // movq	144(%rsp), %rdi
+	LONG $0xcbc6e0c5; BYTE $0x00 // vshufps	$0, %xmm3, %xmm3, %xmm1
+	WORD $0x0148; BYTE $0xf9     // addq	%rdi, %rcx
+	WORD $0x0148; BYTE $0xf1     // addq	%rsi, %rcx
+	LONG $0x8c0c8d49             // leaq	(%r12,%rcx,4), %rcx
+	LONG $0x0959f0c5             // vmulps	(%rcx), %xmm1, %xmm1
+	LONG $0x0911f8c5             // vmovups	%xmm1, (%rcx)
+	WORD $0x8948; BYTE $0xd1     // movq	%rdx, %rcx
+	LONG $0xfce18348             // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xc8     // addq	%rcx, %rax
+	WORD $0xe283; BYTE $0x03     // andl	$3, %edx
+	JE   BB0_63
+
+BB0_64:
+	QUAD $0x0000009024bc8b48 // movq	144(%rsp), %rdi
+	LONG $0x07148d48         // leaq	(%rdi,%rax), %rdx
+	LONG $0x94148d49         // leaq	(%r12,%rdx,4), %rdx
+	LONG $0x0a59e2c5         // vmulss	(%rdx), %xmm3, %xmm1
+	LONG $0x0a11fac5         // vmovss	%xmm1, (%rdx)
+	LONG $0x01508d48         // leaq	1(%rax), %rdx
+	WORD $0x394c; BYTE $0xf2 // cmpq	%r14, %rdx
+	JGE  BB0_63
+	WORD $0x0148; BYTE $0xfa // addq	%rdi, %rdx
+	LONG $0x02c08348         // addq	$2, %rax
+	LONG $0x94148d49         // leaq	(%r12,%rdx,4), %rdx
+	LONG $0x0a59e2c5         // vmulss	(%rdx), %xmm3, %xmm1
+	LONG $0x0a11fac5         // vmovss	%xmm1, (%rdx)
+	WORD $0x394c; BYTE $0xf0 // cmpq	%r14, %rax
+	JGE  BB0_63
+	WORD $0x0148; BYTE $0xf8 // addq	%rdi, %rax
+	LONG $0x84048d49         // leaq	(%r12,%rax,4), %rax
+	LONG $0x1859e2c5         // vmulss	(%rax), %xmm3, %xmm3
+	LONG $0x1811fac5         // vmovss	%xmm3, (%rax)
+
+BB0_63:
+	QUAD $0x000000b024bc8b48             // movq	176(%rsp), %rdi
+	LONG $0x24748b48; BYTE $0x40         // movq	64(%rsp), %rsi
+	QUAD $0x0000008024848348; BYTE $0x01 // addq	$1, 128(%rsp)
+	QUAD $0x0000008024848b48             // movq	128(%rsp), %rax
+	QUAD $0x0000009024b4014c             // addq	%r14, 144(%rsp)
+	WORD $0x0149; BYTE $0xfb             // addq	%rdi, %r11
+	QUAD $0x0000009824b40148             // addq	%rsi, 152(%rsp)
+	QUAD $0x00000110249c0148             // addq	%rbx, 272(%rsp)
+	LONG $0x24740148; BYTE $0x78         // addq	%rsi, 120(%rsp)
+	LONG $0x24443948; BYTE $0x48         // cmpq	%rax, 72(%rsp)
+	JG   BB0_59
+	WORD $0xf8c5; BYTE $0x77             // vzeroupper
+
+BB0_132:
+	LONG $0xd0a58d48; WORD $0xfffe; BYTE $0xff // leaq	-304(%rbp), %rsp
+	RET
+
+BB0_70:
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xe328fcc5 // vmovaps	%ymm3, %ymm4
+	LONG $0xeb28fcc5 // vmovaps	%ymm3, %ymm5
+	LONG $0xf328fcc5 // vmovaps	%ymm3, %ymm6
+	JMP  BB0_5
+
+BB0_71:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_8
+
+BB0_136:
+	LONG $0x07fe8349 // cmpq	$7, %r14
+	JLE  BB0_36
+
+BB0_34:
+	QUAD $0x0000009024bc8b48     // movq	144(%rsp), %rdi
+	LONG $0x244c8b48; BYTE $0x70 // movq	112(%rsp), %rcx
+	LONG $0x3f148d49             // leaq	(%r15,%rdi), %rdx
+	QUAD $0x00000000bd048d48     // leaq	0(,%rdi,4), %rax
+	LONG $0x02e2c148             // salq	$2, %rdx
+
+BB0_37:
+	LONG $0x3c10fcc5; BYTE $0x01   // vmovups	(%rcx,%rax), %ymm7
+	LONG $0x5844c1c4; WORD $0x040c // vaddps	(%r12,%rax), %ymm7, %ymm1
+	LONG $0x117cc1c4; WORD $0x040c // vmovups	%ymm1, (%r12,%rax)
+	LONG $0x20c08348               // addq	$32, %rax
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JNE  BB0_37
+	WORD $0x394d; BYTE $0xfe       // cmpq	%r15, %r14
+	JLE  BB0_129
+	WORD $0x894c; BYTE $0xf8       // movq	%r15, %rax
+
+BB0_39:
+	WORD $0x894c; BYTE $0xf2     // movq	%r14, %rdx
+	QUAD $0x0000009024bc8b48     // movq	144(%rsp), %rdi
+	WORD $0x2948; BYTE $0xc2     // subq	%rax, %rdx
+	LONG $0xff6a8d4c             // leaq	-1(%rdx), %r13
+	LONG $0x380c8d48             // leaq	(%rax,%rdi), %rcx
+	LONG $0x02fd8349             // cmpq	$2, %r13
+	JBE  BB0_41
+	WORD $0x394c; BYTE $0xf0     // cmpq	%r14, %rax
+	JGE  BB0_41
+	LONG $0x247c8b48; BYTE $0x70 // movq	112(%rsp), %rdi
+	QUAD $0x000000008d348d48     // leaq	0(,%rcx,4), %rsi
+	LONG $0x34048d4d             // leaq	(%r12,%rsi), %r8
+	LONG $0x374c8d4c; BYTE $0x04 // leaq	4(%rdi,%rsi), %r9
+	WORD $0x894c; BYTE $0xc7     // movq	%r8, %rdi
+	WORD $0x294c; BYTE $0xcf     // subq	%r9, %rdi
+	LONG $0x18ff8348             // cmpq	$24, %rdi
+	JA   BB0_137
+
+BB0_41:
+	LONG $0x247c8b48; BYTE $0x70 // movq	112(%rsp), %rdi
+	LONG $0x8c148d49             // leaq	(%r12,%rcx,4), %rdx
+	LONG $0x0a10fac5             // vmovss	(%rdx), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x0a11fac5             // vmovss	%xmm1, (%rdx)
+	LONG $0x01508d48             // leaq	1(%rax), %rdx
+	WORD $0x394c; BYTE $0xf2     // cmpq	%r14, %rdx
+	JGE  BB0_22
+	QUAD $0x0000009024b48b48     // movq	144(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	LONG $0x940c8d49             // leaq	(%r12,%rdx,4), %rcx
+	LONG $0x0910fac5             // vmovss	(%rcx), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x97 // vaddss	(%rdi,%rdx,4), %xmm1, %xmm1
+	LONG $0x02508d48             // leaq	2(%rax), %rdx
+	LONG $0x0911fac5             // vmovss	%xmm1, (%rcx)
+	WORD $0x394c; BYTE $0xf2     // cmpq	%r14, %rdx
+	JGE  BB0_129
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	LONG $0x940c8d49             // leaq	(%r12,%rdx,4), %rcx
+	LONG $0x0910fac5             // vmovss	(%rcx), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x97 // vaddss	(%rdi,%rdx,4), %xmm1, %xmm1
+	LONG $0x03508d48             // leaq	3(%rax), %rdx
+	LONG $0x0911fac5             // vmovss	%xmm1, (%rcx)
+	WORD $0x3949; BYTE $0xd6     // cmpq	%rdx, %r14
+	JLE  BB0_129
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	LONG $0x940c8d49             // leaq	(%r12,%rdx,4), %rcx
+	LONG $0x0910fac5             // vmovss	(%rcx), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x97 // vaddss	(%rdi,%rdx,4), %xmm1, %xmm1
+	LONG $0x04508d48             // leaq	4(%rax), %rdx
+	LONG $0x0911fac5             // vmovss	%xmm1, (%rcx)
+	WORD $0x3949; BYTE $0xd6     // cmpq	%rdx, %r14
+	JLE  BB0_129
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	LONG $0x940c8d49             // leaq	(%r12,%rdx,4), %rcx
+	LONG $0x0910fac5             // vmovss	(%rcx), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x97 // vaddss	(%rdi,%rdx,4), %xmm1, %xmm1
+	LONG $0x05508d48             // leaq	5(%rax), %rdx
+	LONG $0x0911fac5             // vmovss	%xmm1, (%rcx)
+	WORD $0x394c; BYTE $0xf2     // cmpq	%r14, %rdx
+	JGE  BB0_129
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	LONG $0x940c8d49             // leaq	(%r12,%rdx,4), %rcx
+	LONG $0x0910fac5             // vmovss	(%rcx), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x97 // vaddss	(%rdi,%rdx,4), %xmm1, %xmm1
+	LONG $0x06508d48             // leaq	6(%rax), %rdx
+	LONG $0x0911fac5             // vmovss	%xmm1, (%rcx)
+	WORD $0x3949; BYTE $0xd6     // cmpq	%rdx, %r14
+	JLE  BB0_129
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	LONG $0x07c08348             // addq	$7, %rax
+	LONG $0x940c8d49             // leaq	(%r12,%rdx,4), %rcx
+	LONG $0x0910fac5             // vmovss	(%rcx), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x97 // vaddss	(%rdi,%rdx,4), %xmm1, %xmm1
+	LONG $0x0911fac5             // vmovss	%xmm1, (%rcx)
+	WORD $0x3949; BYTE $0xc6     // cmpq	%rax, %r14
+	JLE  BB0_129
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	LONG $0x84148d49             // leaq	(%r12,%rax,4), %rdx
+	LONG $0x0a10fac5             // vmovss	(%rdx), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x87 // vaddss	(%rdi,%rax,4), %xmm1, %xmm1
+	LONG $0x0a11fac5             // vmovss	%xmm1, (%rdx)
+
+BB0_129:
+	QUAD $0x0000009824848b48 // movq	152(%rsp), %rax
+	LONG $0x2010fac5         // vmovss	(%rax), %xmm4
+	JMP  BB0_18
+
+BB0_74:
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+	JMP  BB0_23
+
+BB0_75:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_26
+
+BB0_135:
+	LONG $0x247c8348; WORD $0x0070 // cmpq	$0, 112(%rsp)
+	JE   BB0_129
+	LONG $0x07fe8349               // cmpq	$7, %r14
+	JG   BB0_34
+	WORD $0xc031                   // xorl	%eax, %eax
+	JMP  BB0_39
+
+BB0_137:
+	WORD $0x394c; BYTE $0xf0     // cmpq	%r14, %rax
+	LONG $0x000001bf; BYTE $0x00 // movl	$1, %edi
+	LONG $0xd74d0f48             // cmovge	%rdi, %rdx
+	LONG $0x06fd8349             // cmpq	$6, %r13
+	JBE  BB0_76
+	LONG $0x247c8b48; BYTE $0x70 // movq	112(%rsp), %rdi
+	LONG $0x3c10fcc5; BYTE $0x37 // vmovups	(%rdi,%rsi), %ymm7
+	LONG $0x5844c1c4; BYTE $0x08 // vaddps	(%r8), %ymm7, %ymm1
+	WORD $0x8948; BYTE $0xd6     // movq	%rdx, %rsi
+	LONG $0xf8e68348             // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	LONG $0x117cc1c4; BYTE $0x08 // vmovups	%ymm1, (%r8)
+	WORD $0xc2f6; BYTE $0x07     // testb	$7, %dl
+	JE   BB0_22
+
+BB0_42:
+	WORD $0x2948; BYTE $0xf2     // subq	%rsi, %rdx
+	LONG $0xff7a8d48             // leaq	-1(%rdx), %rdi
+	LONG $0x02ff8348             // cmpq	$2, %rdi
+	JBE  BB0_44
+	WORD $0x0148; BYTE $0xce     // addq	%rcx, %rsi
+	LONG $0x247c8b48; BYTE $0x70 // movq	112(%rsp), %rdi
+	LONG $0xb40c8d49             // leaq	(%r12,%rsi,4), %rcx
+	LONG $0x3c10f8c5; BYTE $0xb7 // vmovups	(%rdi,%rsi,4), %xmm7
+	LONG $0x0958c0c5             // vaddps	(%rcx), %xmm7, %xmm1
+	LONG $0x0911f8c5             // vmovups	%xmm1, (%rcx)
+	WORD $0x8948; BYTE $0xd1     // movq	%rdx, %rcx
+	LONG $0xfce18348             // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xc8     // addq	%rcx, %rax
+	WORD $0xe283; BYTE $0x03     // andl	$3, %edx
+	JE   BB0_22
+
+BB0_44:
+	QUAD $0x0000009024bc8b48     // movq	144(%rsp), %rdi
+	LONG $0x24748b48; BYTE $0x70 // movq	112(%rsp), %rsi
+	LONG $0x070c8d48             // leaq	(%rdi,%rax), %rcx
+	LONG $0x8c148d49             // leaq	(%r12,%rcx,4), %rdx
+	LONG $0x0a10fac5             // vmovss	(%rdx), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8e // vaddss	(%rsi,%rcx,4), %xmm1, %xmm1
+	LONG $0x0a11fac5             // vmovss	%xmm1, (%rdx)
+	LONG $0x01508d48             // leaq	1(%rax), %rdx
+	WORD $0x3949; BYTE $0xd6     // cmpq	%rdx, %r14
+	JLE  BB0_22
+	WORD $0x0148; BYTE $0xfa     // addq	%rdi, %rdx
+	LONG $0x02c08348             // addq	$2, %rax
+	LONG $0x940c8d49             // leaq	(%r12,%rdx,4), %rcx
+	LONG $0x0910fac5             // vmovss	(%rcx), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x96 // vaddss	(%rsi,%rdx,4), %xmm1, %xmm1
+	LONG $0x0911fac5             // vmovss	%xmm1, (%rcx)
+	WORD $0x3949; BYTE $0xc6     // cmpq	%rax, %r14
+	JLE  BB0_22
+	WORD $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	LONG $0x84148d49             // leaq	(%r12,%rax,4), %rdx
+	LONG $0x0a10fac5             // vmovss	(%rdx), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x86 // vaddss	(%rsi,%rax,4), %xmm1, %xmm1
+	LONG $0x0a11fac5             // vmovss	%xmm1, (%rdx)
+	JMP  BB0_22
+
+BB0_4:
+	WORD $0xff31             // xorl	%edi, %edi
+	WORD $0x854d; BYTE $0xf6 // testq	%r14, %r14
+	JG   BB0_16
+
+BB0_17:
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+
+BB0_52:
+	VMOVSS CPI0_23<>(SB), X7       // vmovss	.LCPI0_23(%rip), %xmm7
+	LONG   $0xdb5ec2c5             // vdivss	%xmm3, %xmm7, %xmm3
+	LONG   $0x187de2c4; BYTE $0xe3 // vbroadcastss	%xmm3, %ymm4
+	LONG   $0x07fe8349             // cmpq	$7, %r14
+	JG     BB0_66
+	WORD   $0xc031                 // xorl	%eax, %eax
+	JMP    BB0_56
+
+BB0_81:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_61
+
+BB0_36:
+	WORD $0x854d; BYTE $0xf6 // testq	%r14, %r14
+	JLE  BB0_17
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_39
+
+BB0_50:
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+	WORD $0xc031     // xorl	%eax, %eax
+	JMP  BB0_67
+
+BB0_76:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_42
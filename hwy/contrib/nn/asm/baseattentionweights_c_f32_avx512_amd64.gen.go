@@ -0,0 +1,14 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baseattentionweights_c_f32_avx512_amd64.c
+
+package asm
+
+import "unsafe"
+
+//go:noescape
+func attentionweights_c_f32_avx512(q, k, mask, weights, pseqLen, pkvLen, pheadDim, pscale, plen_q, plen_k, plen_mask, plen_weights unsafe.Pointer)
@@ -0,0 +1,1745 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baseattentionweights_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x7f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_11<>+0(SB)/4, $0xb95e8083
+GLOBL CPI0_11<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_13<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_13<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_15<>+0(SB)/4, $0x3c088889
+GLOBL CPI0_15<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_17<>+0(SB)/4, $0x3d2aaaab
+GLOBL CPI0_17<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_19<>+0(SB)/4, $0x3e2aaaab
+GLOBL CPI0_19<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_21<>+0(SB)/4, $0x3f000000
+GLOBL CPI0_21<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_23<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_23<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_27<>+0(SB)/4, $0x652b82fe
+DATA CPI0_27<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_27<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_3<>+0(SB)/4, $0x42b17218
+GLOBL CPI0_3<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_33<>+0(SB)/4, $0xfee00000
+DATA CPI0_33<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_33<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_35<>+0(SB)/4, $0x35793c6c
+DATA CPI0_35<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_35<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_37<>+0(SB)/4, $0xeff8d898
+DATA CPI0_37<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_37<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_39<>+0(SB)/4, $0x67f544e4
+DATA CPI0_39<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_39<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_41<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_41<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_41<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_43<>+0(SB)/4, $0xa556c734
+DATA CPI0_43<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_43<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_45<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_45<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_45<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_47<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_47<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_47<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_49<>+0(SB)/4, $0x16c16c17
+DATA CPI0_49<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_49<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_5<>+0(SB)/4, $0xc2aeac50
+GLOBL CPI0_5<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_51<>+0(SB)/4, $0x11111111
+DATA CPI0_51<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_51<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_53<>+0(SB)/4, $0x55555555
+DATA CPI0_53<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_53<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_55<>+0(SB)/4, $0x55555555
+DATA CPI0_55<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_55<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_57<>+0(SB)/4, $0x00000000
+DATA CPI0_57<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_57<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_59<>+0(SB)/4, $0x00000000
+DATA CPI0_59<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_59<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_62<>+0(SB)/4, $0xc4314000
+GLOBL CPI0_62<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_64<>+0(SB)/4, $0x44314000
+GLOBL CPI0_64<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_7<>+0(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_7<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_86<>+0(SB)/4, $0x00000000
+DATA CPI0_86<>+4(SB)/4, $0x80000000
+DATA CPI0_86<>+8(SB)/4, $0x00000000
+DATA CPI0_86<>+12(SB)/4, $0x00000000
+GLOBL CPI0_86<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_87<>+0(SB)/4, $0xffffffff
+DATA CPI0_87<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_87<>+8(SB)/4, $0x00000000
+DATA CPI0_87<>+12(SB)/4, $0x00000000
+GLOBL CPI0_87<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_9<>+0(SB)/4, $0x3f318000
+GLOBL CPI0_9<>(SB), (RODATA|NOPTR), $4
+
+TEXT ·attentionweights_c_f32_avx512(SB), $368-96
+	MOVQ   q+0(FP), DI
+	MOVQ   k+8(FP), SI
+	MOVQ   mask+16(FP), DX
+	MOVQ   weights+24(FP), CX
+	MOVQ   pseqLen+32(FP), R8
+	MOVQ   pkvLen+40(FP), R9
+	MOVQ   pheadDim+48(FP), R11
+	MOVQ   R11, 320(SP)
+	MOVQ   pscale+56(FP), R11
+	MOVQ   R11, 328(SP)
+	MOVQ   plen_q+64(FP), R11
+	MOVQ   R11, 336(SP)
+	MOVQ   plen_k+72(FP), R11
+	MOVQ   R11, 344(SP)
+	MOVQ   plen_mask+80(FP), R11
+	MOVQ   R11, 352(SP)
+	MOVQ   plen_weights+88(FP), R11
+	MOVQ   R11, 360(SP)
+	QUAD   $0x0000013024ac8d48                   // leaq	304(%rsp), %rbp
+	WORD   $0x8949; BYTE $0xf4                   // movq	%rsi, %r12
+	LONG   $0x24648d48; BYTE $0x40               // leaq	64(%rsp), %rsp
+	LONG   $0xc0e48348                           // andq	$-64, %rsp
+	WORD   $0x8b49; BYTE $0x19                   // movq	(%r9), %rbx
+	LONG   $0x10458b48                           // movq	16(%rbp), %rax
+	WORD   $0x8b49; BYTE $0x30                   // movq	(%r8), %rsi
+	LONG   $0x24548948; BYTE $0x78               // movq	%rdx, 120(%rsp)
+	WORD   $0x8548; BYTE $0xdb                   // testq	%rbx, %rbx
+	WORD   $0x8b4c; BYTE $0x30                   // movq	(%rax), %r14
+	QUAD   $0x000000e824bc8948                   // movq	%rdi, 232(%rsp)
+	WORD   $0x940f; BYTE $0xc0                   // sete	%al
+	WORD   $0x8548; BYTE $0xf6                   // testq	%rsi, %rsi
+	LONG   $0x24748948; BYTE $0x40               // movq	%rsi, 64(%rsp)
+	WORD   $0x9e0f; BYTE $0xc2                   // setle	%dl
+	QUAD   $0x000000b0249c8948                   // movq	%rbx, 176(%rsp)
+	WORD   $0xd008                               // orb	%dl, %al
+	JNE    BB0_150
+	WORD   $0x854d; BYTE $0xf6                   // testq	%r14, %r14
+	JE     BB0_150
+	WORD   $0x8949; BYTE $0xf9                   // movq	%rdi, %r9
+	LONG   $0x18458b48                           // movq	24(%rbp), %rax
+	WORD   $0x3145; BYTE $0xff                   // xorl	%r15d, %r15d
+	WORD   $0x3145; BYTE $0xed                   // xorl	%r13d, %r13d
+	QUAD   $0x000000009d348d48                   // leaq	0(,%rbx,4), %rsi
+	QUAD   $0x0000008024ac894c                   // movq	%r13, 128(%rsp)
+	VMOVSS CPI0_0<>(SB), X29                     // vmovss	.LCPI0_0(%rip), %xmm29
+	WORD   $0x894d; BYTE $0xf5                   // movq	%r14, %r13
+	WORD   $0x8948; BYTE $0xf7                   // movq	%rsi, %rdi
+	LONG   $0x0810fac5                           // vmovss	(%rax), %xmm1
+	QUAD   $0x00000000b5048d4a                   // leaq	0(,%r14,4), %rax
+	LONG   $0x24748948; BYTE $0x38               // movq	%rsi, 56(%rsp)
+	WORD   $0x0148; BYTE $0xcf                   // addq	%rcx, %rdi
+	WORD   $0x8948; BYTE $0xce                   // movq	%rcx, %rsi
+	QUAD   $0x0000009824848948                   // movq	%rax, 152(%rsp)
+	LONG   $0x360c8d4b                           // leaq	(%r14,%r14), %rcx
+	LONG   $0x247c8948; BYTE $0x68               // movq	%rdi, 104(%rsp)
+	WORD   $0x894c; BYTE $0xf7                   // movq	%r14, %rdi
+	LONG   $0x1879e2c4; BYTE $0xf1               // vbroadcastss	%xmm1, %xmm6
+	LONG   $0x04e7c148                           // salq	$4, %rdi
+	LONG   $0x244c8948; BYTE $0x20               // movq	%rcx, 32(%rsp)
+	WORD   $0x014c; BYTE $0xf1                   // addq	%r14, %rcx
+	LONG   $0xe628f8c5                           // vmovaps	%xmm6, %xmm4
+	QUAD   $0x0000008824bc8948                   // movq	%rdi, 136(%rsp)
+	LONG   $0x043c8d49                           // leaq	(%r12,%rax), %rdi
+	LONG   $0x247c8948; BYTE $0x18               // movq	%rdi, 24(%rsp)
+	WORD   $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	WORD   $0x0148; BYTE $0xf8                   // addq	%rdi, %rax
+	LONG   $0x240c8948                           // movq	%rcx, (%rsp)
+	LONG   $0x24448948; BYTE $0x08               // movq	%rax, 8(%rsp)
+	LONG   $0xf0468d49                           // leaq	-16(%r14), %rax
+	WORD   $0x894d; BYTE $0xce                   // movq	%r9, %r14
+	WORD   $0x894d; BYTE $0xf9                   // movq	%r15, %r9
+	LONG   $0xf0e08348                           // andq	$-16, %rax
+	LONG   $0x247c8948; BYTE $0x10               // movq	%rdi, 16(%rsp)
+	WORD   $0x8949; BYTE $0xf7                   // movq	%rsi, %r15
+	QUAD   $0x000000f02484c748; LONG $0x00000000 // movq	$0, 240(%rsp)
+	LONG   $0x10c08348                           // addq	$16, %rax
+	QUAD   $0x0000009024848948                   // movq	%rax, 144(%rsp)
+	LONG   $0xfc438d48                           // leaq	-4(%rbx), %rax
+	LONG   $0x24448948; BYTE $0x28               // movq	%rax, 40(%rsp)
+	LONG   $0x02e8c148                           // shrq	$2, %rax
+	QUAD   $0x0000000485048d48                   // leaq	4(,%rax,4), %rax
+	LONG   $0x24448948; BYTE $0x30               // movq	%rax, 48(%rsp)
+	LONG   $0xf0438d48                           // leaq	-16(%rbx), %rax
+	LONG   $0x24448948; BYTE $0x60               // movq	%rax, 96(%rsp)
+	LONG   $0xf0e08348                           // andq	$-16, %rax
+	LONG   $0x10c08348                           // addq	$16, %rax
+	LONG   $0x24448948; BYTE $0x70               // movq	%rax, 112(%rsp)
+	WORD   $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+
+BB0_68:
+	QUAD $0x000000b024bc8348; BYTE $0x03 // cmpq	$3, 176(%rsp)
+	JLE  BB0_4
+	LONG $0x24548b48; BYTE $0x28         // movq	40(%rsp), %rdx
+	LONG $0x244c8b48; BYTE $0x18         // movq	24(%rsp), %rcx
+	WORD $0x894d; BYTE $0xe0             // movq	%r12, %r8
+	WORD $0x3145; BYTE $0xdb             // xorl	%r11d, %r11d
+	QUAD $0x000000b824848948             // movq	%rax, 184(%rsp)
+	LONG $0x247c8b48; BYTE $0x08         // movq	8(%rsp), %rdi
+	LONG $0xfce28348                     // andq	$-4, %rdx
+	LONG $0x244c894c; BYTE $0x58         // movq	%r9, 88(%rsp)
+	LONG $0x24748b48; BYTE $0x10         // movq	16(%rsp), %rsi
+	WORD $0x014c; BYTE $0xca             // addq	%r9, %rdx
+	QUAD $0x000000d0248c8948             // movq	%rcx, 208(%rsp)
+	LONG $0x975c8d49; BYTE $0x10         // leaq	16(%r15,%rdx,4), %rbx
+	LONG $0x24448948; BYTE $0x50         // movq	%rax, 80(%rsp)
+	LONG $0x08fde162; WORD $0xd36e       // vmovq	%rbx, %xmm18
+	LONG $0x241c8b48                     // movq	(%rsp), %rbx
+	LONG $0x247c894c; BYTE $0x48         // movq	%r15, 72(%rsp)
+	QUAD $0x000000d824b4894c             // movq	%r14, 216(%rsp)
+	QUAD $0x000000e0249c8948             // movq	%rbx, 224(%rsp)
+	LONG $0x245c8b48; BYTE $0x20         // movq	32(%rsp), %rbx
+
+BB0_14:
+	LONG $0x2b048d4b               // leaq	(%r11,%r13), %rax
+	QUAD $0x000000f824848948       // movq	%rax, 248(%rsp)
+	LONG $0x0ffd8349               // cmpq	$15, %r13
+	JLE  BB0_76
+	LONG $0xf657c8c5               // vxorps	%xmm6, %xmm6, %xmm6
+	QUAD $0x000000d0248c8b48       // movq	208(%rsp), %rcx
+	LONG $0x000010b8; BYTE $0x00   // movl	$16, %eax
+	QUAD $0x000000d824b48b4c       // movq	216(%rsp), %r14
+	LONG $0x487cf162; WORD $0xd628 // vmovaps	%zmm6, %zmm2
+	LONG $0x487cf162; WORD $0xde28 // vmovaps	%zmm6, %zmm3
+	LONG $0x487cf162; WORD $0xee28 // vmovaps	%zmm6, %zmm5
+
+BB0_6:
+	QUAD $0xff864410487cd162 // vmovups	-64(%r14,%rax,4), %zmm0
+	QUAD $0xff806cb8487dd262 // vfmadd231ps	-64(%r8,%rax,4), %zmm0, %zmm5
+	QUAD $0xff815cb8487df262 // vfmadd231ps	-64(%rcx,%rax,4), %zmm0, %zmm3
+	QUAD $0xff8654b8487df262 // vfmadd231ps	-64(%rsi,%rax,4), %zmm0, %zmm2
+	QUAD $0xff8774b8487df262 // vfmadd231ps	-64(%rdi,%rax,4), %zmm0, %zmm6
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x394c; BYTE $0xe8 // cmpq	%r13, %rax
+	JLE  BB0_6
+	QUAD $0x000000d0248c8948 // movq	%rcx, 208(%rsp)
+	QUAD $0x0000009024948b48 // movq	144(%rsp), %rdx
+	QUAD $0x000000d824b4894c // movq	%r14, 216(%rsp)
+
+BB0_5:
+	LONG $0x48fdf362; WORD $0xe81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm0
+	LONG $0xc558fcc5                           // vaddps	%ymm5, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c5             // vextractf128	$0x1, %ymm0, %xmm5
+	LONG $0xc058d0c5                           // vaddps	%xmm0, %xmm5, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ef8             // vpermilps	$78, %xmm0, %xmm7
+	LONG $0xf858c0c5                           // vaddps	%xmm0, %xmm7, %xmm7
+	LONG $0x48fdf362; WORD $0xd81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm3, %ymm0
+	LONG $0xc358fcc5                           // vaddps	%ymm3, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c3             // vextractf128	$0x1, %ymm0, %xmm3
+	LONG $0xc058e0c5                           // vaddps	%xmm0, %xmm3, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ee8             // vpermilps	$78, %xmm0, %xmm5
+	LONG $0xe858d0c5                           // vaddps	%xmm0, %xmm5, %xmm5
+	LONG $0x48fdf362; WORD $0xd01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm0
+	LONG $0xc258fcc5                           // vaddps	%ymm2, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c2             // vextractf128	$0x1, %ymm0, %xmm2
+	LONG $0xc058e8c5                           // vaddps	%xmm0, %xmm2, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ed8             // vpermilps	$78, %xmm0, %xmm3
+	LONG $0xd858e0c5                           // vaddps	%xmm0, %xmm3, %xmm3
+	LONG $0x48fdf362; WORD $0xf01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm6, %ymm0
+	LONG $0xf058ccc5                           // vaddps	%ymm0, %ymm6, %ymm6
+	LONG $0x197de3c4; WORD $0x01f0             // vextractf128	$0x1, %ymm6, %xmm0
+	LONG $0xc658f8c5                           // vaddps	%xmm6, %xmm0, %xmm0
+	LONG $0xf528f8c5                           // vmovaps	%xmm5, %xmm6
+	LONG $0xedc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm5
+	LONG $0xf558cac5                           // vaddss	%xmm5, %xmm6, %xmm6
+	LONG $0xeb28f8c5                           // vmovaps	%xmm3, %xmm5
+	LONG $0xdbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm3
+	LONG $0xeb58d2c5                           // vaddss	%xmm3, %xmm5, %xmm5
+	LONG $0x0479e3c4; WORD $0x4ed0             // vpermilps	$78, %xmm0, %xmm2
+	LONG $0xd058e8c5                           // vaddps	%xmm0, %xmm2, %xmm2
+	LONG $0xc728f8c5                           // vmovaps	%xmm7, %xmm0
+	LONG $0xffc6c0c5; BYTE $0x55               // vshufps	$85, %xmm7, %xmm7, %xmm7
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0xda28f8c5                           // vmovaps	%xmm2, %xmm3
+	LONG $0xd2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm2
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xc614f8c5                           // vunpcklps	%xmm6, %xmm0, %xmm0
+	LONG $0xdb14d0c5                           // vunpcklps	%xmm3, %xmm5, %xmm3
+	LONG $0xc316f8c5                           // vmovlhps	%xmm3, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd5                   // cmpq	%rdx, %r13
+	JLE  BB0_7
+	WORD $0x894d; BYTE $0xef                   // movq	%r13, %r15
+	QUAD $0x000000c024948948                   // movq	%rdx, 192(%rsp)
+	WORD $0x2949; BYTE $0xd7                   // subq	%rdx, %r15
+	LONG $0xff478d49                           // leaq	-1(%r15), %rax
+	QUAD $0x000000c824bc894c                   // movq	%r15, 200(%rsp)
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_77
+	QUAD $0x000000f024848b48                   // movq	240(%rsp), %rax
+	QUAD $0x000000e8248c8b48                   // movq	232(%rsp), %rcx
+	LONG $0x04efc149                           // shrq	$4, %r15
+	QUAD $0x000000a824ac894c                   // movq	%r13, 168(%rsp)
+	QUAD $0x000000d824b48b4c                   // movq	216(%rsp), %r14
+	QUAD $0x000000a024948948                   // movq	%rdx, 160(%rsp)
+	LONG $0x06e7c149                           // salq	$6, %r15
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x810c8d4c                           // leaq	(%rcx,%rax,4), %r9
+	LONG $0x13048d49                           // leaq	(%r11,%rdx), %rax
+	LONG $0x84048d49                           // leaq	(%r12,%rax,4), %rax
+	LONG $0x08fde162; WORD $0xc06e             // vmovq	%rax, %xmm16
+	QUAD $0x000000f824848b48                   // movq	248(%rsp), %rax
+	LONG $0x08fdc162; WORD $0xc57e             // vmovq	%xmm16, %r13
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x84048d49                           // leaq	(%r12,%rax,4), %rax
+	LONG $0x6ef961c4; BYTE $0xf8               // vmovq	%rax, %xmm15
+	LONG $0x1a048d48                           // leaq	(%rdx,%rbx), %rax
+	LONG $0x84148d4d                           // leaq	(%r12,%rax,4), %r10
+	QUAD $0x000000e024848b48                   // movq	224(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0x894c; BYTE $0xd2                   // movq	%r10, %rdx
+	LONG $0x7ef941c4; BYTE $0xfa               // vmovq	%xmm15, %r10
+	LONG $0x84048d49                           // leaq	(%r12,%rax,4), %rax
+	LONG $0x6ef961c4; BYTE $0xe8               // vmovq	%rax, %xmm13
+	WORD $0xc031                               // xorl	%eax, %eax
+	LONG $0x7ef961c4; BYTE $0xe9               // vmovq	%xmm13, %rcx
+
+BB0_9:
+	LONG $0x487cd162; WORD $0x1c10; BYTE $0x01 // vmovups	(%r9,%rax), %zmm3
+	QUAD $0x00056c594864d162                   // vmulps	0(%r13,%rax), %zmm3, %zmm5
+	LONG $0x48645162; WORD $0x0459; BYTE $0x02 // vmulps	(%r10,%rax), %zmm3, %zmm8
+	LONG $0x4864f162; WORD $0x3459; BYTE $0x02 // vmulps	(%rdx,%rax), %zmm3, %zmm6
+	LONG $0x4864f162; WORD $0x1c59; BYTE $0x01 // vmulps	(%rcx,%rax), %zmm3, %zmm3
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0xcdc650c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm9
+	LONG $0x2855f362; WORD $0xfd03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm7
+	LONG $0xc63841c4; WORD $0x55f8             // vshufps	$85, %xmm8, %xmm8, %xmm15
+	LONG $0x1450c1c4; BYTE $0xd0               // vunpcklps	%xmm8, %xmm5, %xmm2
+	LONG $0x083cc162; WORD $0xf0c6; BYTE $0xff // vshufps	$255, %xmm8, %xmm8, %xmm22
+	LONG $0x08343162; WORD $0xce14             // vunpcklps	%xmm22, %xmm9, %xmm9
+	LONG $0xdec648c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm11
+	LONG $0x283dc362; WORD $0xd803; BYTE $0x07 // valignd	$7, %ymm8, %ymm8, %ymm19
+	LONG $0x0864e162; WORD $0xc3c6; BYTE $0x55 // vshufps	$85, %xmm3, %xmm3, %xmm16
+	LONG $0xe31448c5                           // vunpcklps	%xmm3, %xmm6, %xmm12
+	LONG $0x0864e162; WORD $0xebc6; BYTE $0xff // vshufps	$255, %xmm3, %xmm3, %xmm21
+	LONG $0x08243162; WORD $0xdd14             // vunpcklps	%xmm21, %xmm11, %xmm11
+	LONG $0x284d7362; WORD $0xd603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm10
+	LONG $0x1668c1c4; BYTE $0xd4               // vmovlhps	%xmm12, %xmm2, %xmm2
+	LONG $0xe6c648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm12
+	LONG $0x081c3162; WORD $0xe014             // vunpcklps	%xmm16, %xmm12, %xmm12
+	LONG $0xc058e8c5                           // vaddps	%xmm0, %xmm2, %xmm0
+	LONG $0xd5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm2
+	LONG $0x1468c1c4; BYTE $0xd7               // vunpcklps	%xmm15, %xmm2, %xmm2
+	LONG $0x0864e162; WORD $0xc315             // vunpckhps	%xmm3, %xmm3, %xmm16
+	LONG $0x166841c4; BYTE $0xe4               // vmovlhps	%xmm12, %xmm2, %xmm12
+	LONG $0x153841c4; BYTE $0xf8               // vunpckhps	%xmm8, %xmm8, %xmm15
+	LONG $0xd515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm2
+	LONG $0x2865e362; WORD $0xe303; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm20
+	LONG $0x1468c1c4; BYTE $0xd7               // vunpcklps	%xmm15, %xmm2, %xmm2
+	LONG $0x163041c4; BYTE $0xcb               // vmovlhps	%xmm11, %xmm9, %xmm9
+	LONG $0x287d5362; WORD $0xc319; BYTE $0x01 // vextractf32x4	$1, %ymm8, %xmm11
+	LONG $0x5878c1c4; BYTE $0xc4               // vaddps	%xmm12, %xmm0, %xmm0
+	LONG $0xe61548c5                           // vunpckhps	%xmm6, %xmm6, %xmm12
+	LONG $0x0844b162; WORD $0xfb14             // vunpcklps	%xmm19, %xmm7, %xmm7
+	LONG $0x081c3162; WORD $0xe014             // vunpcklps	%xmm16, %xmm12, %xmm12
+	LONG $0x166841c4; BYTE $0xe4               // vmovlhps	%xmm12, %xmm2, %xmm12
+	LONG $0x287df362; WORD $0xea19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm2
+	LONG $0x5878c1c4; BYTE $0xc4               // vaddps	%xmm12, %xmm0, %xmm0
+	LONG $0x287dd362; WORD $0xdc19; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm12
+	LONG $0x082c3162; WORD $0xd414             // vunpcklps	%xmm20, %xmm10, %xmm10
+	LONG $0x5878c1c4; BYTE $0xc1               // vaddps	%xmm9, %xmm0, %xmm0
+	LONG $0x1640c1c4; BYTE $0xfa               // vmovlhps	%xmm10, %xmm7, %xmm7
+	LONG $0x287dd362; WORD $0xf119; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm9
+	LONG $0x1468c1c4; BYTE $0xd3               // vunpcklps	%xmm11, %xmm2, %xmm2
+	LONG $0x283d5362; WORD $0xd803; BYTE $0x05 // valignd	$5, %ymm8, %ymm8, %ymm11
+	LONG $0x143041c4; BYTE $0xcc               // vunpcklps	%xmm12, %xmm9, %xmm9
+	LONG $0x28657362; WORD $0xe303; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm12
+	LONG $0x1668c1c4; BYTE $0xd1               // vmovlhps	%xmm9, %xmm2, %xmm2
+	LONG $0x284d7362; WORD $0xce03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm9
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x2855f362; WORD $0xd503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm2
+	LONG $0x143041c4; BYTE $0xcc               // vunpcklps	%xmm12, %xmm9, %xmm9
+	LONG $0x28657362; WORD $0xe303; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm12
+	LONG $0x1468c1c4; BYTE $0xd3               // vunpcklps	%xmm11, %xmm2, %xmm2
+	LONG $0x487df362; WORD $0xdb1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm3, %ymm3
+	LONG $0x283d5362; WORD $0xd803; BYTE $0x06 // valignd	$6, %ymm8, %ymm8, %ymm11
+	LONG $0x1668c1c4; BYTE $0xd1               // vmovlhps	%xmm9, %xmm2, %xmm2
+	LONG $0x487d5362; WORD $0xc01b; BYTE $0x01 // vextractf32x8	$0x1, %zmm8, %ymm8
+	LONG $0x0864e162; WORD $0xc3c6; BYTE $0x55 // vshufps	$85, %xmm3, %xmm3, %xmm16
+	LONG $0x284d7362; WORD $0xce03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm9
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xf61b; BYTE $0x01 // vextractf32x8	$0x1, %zmm6, %ymm6
+	LONG $0xc63841c4; WORD $0x55f8             // vshufps	$85, %xmm8, %xmm8, %xmm15
+	LONG $0x2855f362; WORD $0xd503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm2
+	LONG $0x487df362; WORD $0xed1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm5, %ymm5
+	LONG $0xd3c660c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm10
+	LONG $0x143041c4; BYTE $0xcc               // vunpcklps	%xmm12, %xmm9, %xmm9
+	LONG $0xe31448c5                           // vunpcklps	%xmm3, %xmm6, %xmm12
+	LONG $0x1468c1c4; BYTE $0xd3               // vunpcklps	%xmm11, %xmm2, %xmm2
+	LONG $0x145041c4; BYTE $0xd8               // vunpcklps	%xmm8, %xmm5, %xmm11
+	LONG $0x1668c1c4; BYTE $0xd1               // vmovlhps	%xmm9, %xmm2, %xmm2
+	LONG $0x162041c4; BYTE $0xdc               // vmovlhps	%xmm12, %xmm11, %xmm11
+	LONG $0xe6c648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm12
+	LONG $0x081c3162; WORD $0xe014             // vunpcklps	%xmm16, %xmm12, %xmm12
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x0864e162; WORD $0xc315             // vunpckhps	%xmm3, %xmm3, %xmm16
+	LONG $0xc63841c4; WORD $0xffc8             // vshufps	$255, %xmm8, %xmm8, %xmm9
+	LONG $0xd5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm2
+	LONG $0x1468c1c4; BYTE $0xd1               // vunpcklps	%xmm9, %xmm2, %xmm2
+	LONG $0x287d5362; WORD $0xc119; BYTE $0x01 // vextractf32x4	$1, %ymm8, %xmm9
+	LONG $0xc758f8c5                           // vaddps	%xmm7, %xmm0, %xmm0
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0x1440c1c4; BYTE $0xfa               // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0x287dd362; WORD $0xda19; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm10
+	LONG $0xd716e8c5                           // vmovlhps	%xmm7, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xf719; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm7
+	LONG $0x5878c1c4; BYTE $0xc3               // vaddps	%xmm11, %xmm0, %xmm0
+	LONG $0xddc650c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm11
+	LONG $0x142041c4; BYTE $0xdf               // vunpcklps	%xmm15, %xmm11, %xmm11
+	LONG $0x153841c4; BYTE $0xf8               // vunpckhps	%xmm8, %xmm8, %xmm15
+	LONG $0x162041c4; BYTE $0xdc               // vmovlhps	%xmm12, %xmm11, %xmm11
+	LONG $0xe61548c5                           // vunpckhps	%xmm6, %xmm6, %xmm12
+	LONG $0x081c3162; WORD $0xe014             // vunpcklps	%xmm16, %xmm12, %xmm12
+	LONG $0x5878c1c4; BYTE $0xc3               // vaddps	%xmm11, %xmm0, %xmm0
+	LONG $0xdd1550c5                           // vunpckhps	%xmm5, %xmm5, %xmm11
+	LONG $0x142041c4; BYTE $0xdf               // vunpcklps	%xmm15, %xmm11, %xmm11
+	LONG $0x162041c4; BYTE $0xdc               // vmovlhps	%xmm12, %xmm11, %xmm11
+	LONG $0x1440c1c4; BYTE $0xfa               // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0x28657362; WORD $0xd303; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm10
+	LONG $0x5878c1c4; BYTE $0xc3               // vaddps	%xmm11, %xmm0, %xmm0
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xea19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm2
+	LONG $0x1468c1c4; BYTE $0xd1               // vunpcklps	%xmm9, %xmm2, %xmm2
+	LONG $0x283d5362; WORD $0xc803; BYTE $0x05 // valignd	$5, %ymm8, %ymm8, %ymm9
+	LONG $0xd716e8c5                           // vmovlhps	%xmm7, %xmm2, %xmm2
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm7
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x2855f362; WORD $0xd503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm2
+	LONG $0x1440c1c4; BYTE $0xfa               // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0x28657362; WORD $0xd303; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm10
+	LONG $0x1468c1c4; BYTE $0xd1               // vunpcklps	%xmm9, %xmm2, %xmm2
+	LONG $0x283d5362; WORD $0xc803; BYTE $0x06 // valignd	$6, %ymm8, %ymm8, %ymm9
+	LONG $0xd716e8c5                           // vmovlhps	%xmm7, %xmm2, %xmm2
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm7
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x2855f362; WORD $0xd503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm2
+	LONG $0x283d5362; WORD $0xc003; BYTE $0x07 // valignd	$7, %ymm8, %ymm8, %ymm8
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0x2865f362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm3
+	LONG $0x1440c1c4; BYTE $0xfa               // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0x1468c1c4; BYTE $0xd1               // vunpcklps	%xmm9, %xmm2, %xmm2
+	LONG $0xd716e8c5                           // vmovlhps	%xmm7, %xmm2, %xmm2
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x1450c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0xdb14c8c5                           // vunpcklps	%xmm3, %xmm6, %xmm3
+	LONG $0xeb16d0c5                           // vmovlhps	%xmm3, %xmm5, %xmm5
+	LONG $0xc558f8c5                           // vaddps	%xmm5, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JNE  BB0_9
+	QUAD $0x000000c824848b48                   // movq	200(%rsp), %rax
+	QUAD $0x000000a024948b48                   // movq	160(%rsp), %rdx
+	QUAD $0x000000d824b4894c                   // movq	%r14, 216(%rsp)
+	QUAD $0x000000a824ac8b4c                   // movq	168(%rsp), %r13
+	WORD $0x8949; BYTE $0xc7                   // movq	%rax, %r15
+	LONG $0xf0e78349                           // andq	$-16, %r15
+	WORD $0x014c; BYTE $0xfa                   // addq	%r15, %rdx
+	WORD $0x0fa8                               // testb	$15, %al
+	JE   BB0_7
+
+BB0_8:
+	QUAD $0x000000c824948b4c                   // movq	200(%rsp), %r10
+	WORD $0x294d; BYTE $0xfa                   // subq	%r15, %r10
+	LONG $0xff428d49                           // leaq	-1(%r10), %rax
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_12
+	QUAD $0x000000c0248c8b4c                   // movq	192(%rsp), %r9
+	QUAD $0x000000f024b48b4c                   // movq	240(%rsp), %r14
+	LONG $0x39048d4b                           // leaq	(%r9,%r15), %rax
+	WORD $0x014d; BYTE $0xd9                   // addq	%r11, %r9
+	WORD $0x0149; BYTE $0xc6                   // addq	%rax, %r14
+	WORD $0x014d; BYTE $0xf9                   // addq	%r15, %r9
+	LONG $0x6ef9c1c4; BYTE $0xd6               // vmovq	%r14, %xmm2
+	QUAD $0x000000e824b48b4c                   // movq	232(%rsp), %r14
+	LONG $0x7ef9e1c4; BYTE $0xd1               // vmovq	%xmm2, %rcx
+	LONG $0x107cc1c4; WORD $0x8e34             // vmovups	(%r14,%rcx,4), %ymm6
+	QUAD $0x000000f8248c8b48                   // movq	248(%rsp), %rcx
+	LONG $0x594c01c4; WORD $0x8c0c             // vmulps	(%r12,%r9,4), %ymm6, %ymm9
+	LONG $0x080c8d4c                           // leaq	(%rax,%rcx), %r9
+	QUAD $0x000000e0248c8b48                   // movq	224(%rsp), %rcx
+	LONG $0x594c01c4; WORD $0x8c1c             // vmulps	(%r12,%r9,4), %ymm6, %ymm11
+	LONG $0x180c8d4c                           // leaq	(%rax,%rbx), %r9
+	LONG $0x594c01c4; WORD $0x8c14             // vmulps	(%r12,%r9,4), %ymm6, %ymm10
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x594cc1c4; WORD $0x8434             // vmulps	(%r12,%rax,4), %ymm6, %ymm6
+	WORD $0x894c; BYTE $0xd0                   // movq	%r10, %rax
+	LONG $0xc630c1c4; WORD $0xffd9             // vshufps	$255, %xmm9, %xmm9, %xmm3
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x07e28341                           // andl	$7, %r10d
+	LONG $0x1430c1c4; BYTE $0xd3               // vunpcklps	%xmm11, %xmm9, %xmm2
+	LONG $0xc62041c4; WORD $0x55eb             // vshufps	$85, %xmm11, %xmm11, %xmm13
+	LONG $0xc620c1c4; WORD $0xfffb             // vshufps	$255, %xmm11, %xmm11, %xmm7
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0xc628c1c4; WORD $0xffea             // vshufps	$255, %xmm10, %xmm10, %xmm5
+	LONG $0xf6c648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm14
+	LONG $0xe61428c5                           // vunpcklps	%xmm6, %xmm10, %xmm12
+	LONG $0xc6c648c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm8
+	LONG $0x1450c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0x287df362; WORD $0xf719; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm7
+	LONG $0x1668c1c4; BYTE $0xd4               // vmovlhps	%xmm12, %xmm2, %xmm2
+	LONG $0xc62841c4; WORD $0x55e2             // vshufps	$85, %xmm10, %xmm10, %xmm12
+	LONG $0x141841c4; BYTE $0xe6               // vunpcklps	%xmm14, %xmm12, %xmm12
+	LONG $0xc058e8c5                           // vaddps	%xmm0, %xmm2, %xmm0
+	LONG $0xf61548c5                           // vunpckhps	%xmm6, %xmm6, %xmm14
+	LONG $0xc630c1c4; WORD $0x55d1             // vshufps	$85, %xmm9, %xmm9, %xmm2
+	LONG $0x1468c1c4; BYTE $0xd5               // vunpcklps	%xmm13, %xmm2, %xmm2
+	LONG $0x1668c1c4; BYTE $0xd4               // vmovlhps	%xmm12, %xmm2, %xmm2
+	LONG $0x152041c4; BYTE $0xeb               // vunpckhps	%xmm11, %xmm11, %xmm13
+	LONG $0x152841c4; BYTE $0xe2               // vunpckhps	%xmm10, %xmm10, %xmm12
+	LONG $0x141841c4; BYTE $0xe6               // vunpcklps	%xmm14, %xmm12, %xmm12
+	LONG $0xdd16e0c5                           // vmovlhps	%xmm5, %xmm3, %xmm3
+	LONG $0x287d7362; WORD $0xdd19; BYTE $0x01 // vextractf32x4	$1, %ymm11, %xmm5
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x1530c1c4; BYTE $0xd1               // vunpckhps	%xmm9, %xmm9, %xmm2
+	LONG $0x1468c1c4; BYTE $0xd5               // vunpcklps	%xmm13, %xmm2, %xmm2
+	LONG $0x1668c1c4; BYTE $0xd4               // vmovlhps	%xmm12, %xmm2, %xmm2
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x287d7362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm9, %xmm2
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0x287d7362; WORD $0xd319; BYTE $0x01 // vextractf32x4	$1, %ymm10, %xmm3
+	LONG $0xd514e8c5                           // vunpcklps	%xmm5, %xmm2, %xmm2
+	LONG $0x2825d362; WORD $0xeb03; BYTE $0x05 // valignd	$5, %ymm11, %ymm11, %ymm5
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm7
+	LONG $0xd316e8c5                           // vmovlhps	%xmm3, %xmm2, %xmm2
+	LONG $0x282dd362; WORD $0xda03; BYTE $0x05 // valignd	$5, %ymm10, %ymm10, %ymm3
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x2835d362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm9, %ymm9, %ymm2
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm7
+	LONG $0xd514e8c5                           // vunpcklps	%xmm5, %xmm2, %xmm2
+	LONG $0x2825d362; WORD $0xeb03; BYTE $0x06 // valignd	$6, %ymm11, %ymm11, %ymm5
+	LONG $0xd316e8c5                           // vmovlhps	%xmm3, %xmm2, %xmm2
+	LONG $0x282dd362; WORD $0xda03; BYTE $0x06 // valignd	$6, %ymm10, %ymm10, %ymm3
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x2835d362; WORD $0xd103; BYTE $0x06 // valignd	$6, %ymm9, %ymm9, %ymm2
+	LONG $0x28255362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm11, %ymm11, %ymm11
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0xd514e8c5                           // vunpcklps	%xmm5, %xmm2, %xmm2
+	LONG $0xd316e8c5                           // vmovlhps	%xmm3, %xmm2, %xmm2
+	LONG $0x282dd362; WORD $0xda03; BYTE $0x07 // valignd	$7, %ymm10, %ymm10, %ymm3
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0x2835d362; WORD $0xd103; BYTE $0x07 // valignd	$7, %ymm9, %ymm9, %ymm2
+	LONG $0xde14e0c5                           // vunpcklps	%xmm6, %xmm3, %xmm3
+	LONG $0x1468c1c4; BYTE $0xd3               // vunpcklps	%xmm11, %xmm2, %xmm2
+	LONG $0xd316e8c5                           // vmovlhps	%xmm3, %xmm2, %xmm2
+	LONG $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	JE   BB0_7
+
+BB0_12:
+	QUAD $0x000000e024b48b4c                   // movq	224(%rsp), %r14
+	QUAD $0x000000f8248c8b4c                   // movq	248(%rsp), %r9
+	LONG $0x13148d4d                           // leaq	(%r11,%rdx), %r10
+	LONG $0x130c8d48                           // leaq	(%rbx,%rdx), %rcx
+	LONG $0x107a81c4; WORD $0x9414             // vmovss	(%r12,%r10,4), %xmm2
+	QUAD $0x000000f024848b48                   // movq	240(%rsp), %rax
+	WORD $0x894d; BYTE $0xf7                   // movq	%r14, %r15
+	WORD $0x0149; BYTE $0xd1                   // addq	%rdx, %r9
+	LONG $0x107ac1c4; WORD $0x8c1c             // vmovss	(%r12,%rcx,4), %xmm3
+	QUAD $0x000000e824948b4c                   // movq	232(%rsp), %r10
+	WORD $0x0149; BYTE $0xd7                   // addq	%rdx, %r15
+	LONG $0x216983c4; WORD $0x8c14; BYTE $0x10 // vinsertps	$0x10, (%r12,%r9,4), %xmm2, %xmm2
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x216183c4; WORD $0xbc1c; BYTE $0x10 // vinsertps	$0x10, (%r12,%r15,4), %xmm3, %xmm3
+	LONG $0xd316e8c5                           // vmovlhps	%xmm3, %xmm2, %xmm2
+	LONG $0x186dd262; WORD $0x04b8; BYTE $0x82 // vfmadd231ps	(%r10,%rax,4){1to4}, %xmm2, %xmm0
+	LONG $0x01428d48                           // leaq	1(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_7
+	QUAD $0x000000f024bc8b4c                   // movq	240(%rsp), %r15
+	QUAD $0x000000f824948b4c                   // movq	248(%rsp), %r10
+	LONG $0x030c8d48                           // leaq	(%rbx,%rax), %rcx
+	LONG $0x107ac1c4; WORD $0x8c1c             // vmovss	(%r12,%rcx,4), %xmm3
+	LONG $0x070c8d4d                           // leaq	(%r15,%rax), %r9
+	WORD $0x0149; BYTE $0xc2                   // addq	%rax, %r10
+	LONG $0x033c8d4d                           // leaq	(%r11,%rax), %r15
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x2161c3c4; WORD $0x841c; BYTE $0x10 // vinsertps	$0x10, (%r12,%rax,4), %xmm3, %xmm3
+	LONG $0x107a81c4; WORD $0xbc14             // vmovss	(%r12,%r15,4), %xmm2
+	LONG $0x216983c4; WORD $0x9414; BYTE $0x10 // vinsertps	$0x10, (%r12,%r10,4), %xmm2, %xmm2
+	QUAD $0x000000e824848b48                   // movq	232(%rsp), %rax
+	LONG $0xd316e8c5                           // vmovlhps	%xmm3, %xmm2, %xmm2
+	LONG $0x186db262; WORD $0x04b8; BYTE $0x88 // vfmadd231ps	(%rax,%r9,4){1to4}, %xmm2, %xmm0
+	LONG $0x02428d48                           // leaq	2(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_7
+	QUAD $0x000000f024bc8b4c                   // movq	240(%rsp), %r15
+	QUAD $0x000000f824948b4c                   // movq	248(%rsp), %r10
+	LONG $0x030c8d48                           // leaq	(%rbx,%rax), %rcx
+	LONG $0x107ac1c4; WORD $0x8c1c             // vmovss	(%r12,%rcx,4), %xmm3
+	LONG $0x070c8d4d                           // leaq	(%r15,%rax), %r9
+	WORD $0x0149; BYTE $0xc2                   // addq	%rax, %r10
+	LONG $0x033c8d4d                           // leaq	(%r11,%rax), %r15
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x2161c3c4; WORD $0x841c; BYTE $0x10 // vinsertps	$0x10, (%r12,%rax,4), %xmm3, %xmm3
+	LONG $0x107a81c4; WORD $0xbc14             // vmovss	(%r12,%r15,4), %xmm2
+	LONG $0x216983c4; WORD $0x9414; BYTE $0x10 // vinsertps	$0x10, (%r12,%r10,4), %xmm2, %xmm2
+	QUAD $0x000000e824848b48                   // movq	232(%rsp), %rax
+	LONG $0xd316e8c5                           // vmovlhps	%xmm3, %xmm2, %xmm2
+	LONG $0x186db262; WORD $0x04b8; BYTE $0x88 // vfmadd231ps	(%rax,%r9,4){1to4}, %xmm2, %xmm0
+	LONG $0x03428d48                           // leaq	3(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_7
+	QUAD $0x000000f024bc8b4c                   // movq	240(%rsp), %r15
+	QUAD $0x000000f824948b4c                   // movq	248(%rsp), %r10
+	LONG $0x030c8d48                           // leaq	(%rbx,%rax), %rcx
+	LONG $0x107ac1c4; WORD $0x8c1c             // vmovss	(%r12,%rcx,4), %xmm3
+	LONG $0x070c8d4d                           // leaq	(%r15,%rax), %r9
+	WORD $0x0149; BYTE $0xc2                   // addq	%rax, %r10
+	LONG $0x033c8d4d                           // leaq	(%r11,%rax), %r15
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x2161c3c4; WORD $0x841c; BYTE $0x10 // vinsertps	$0x10, (%r12,%rax,4), %xmm3, %xmm3
+	LONG $0x107a81c4; WORD $0xbc14             // vmovss	(%r12,%r15,4), %xmm2
+	LONG $0x216983c4; WORD $0x9414; BYTE $0x10 // vinsertps	$0x10, (%r12,%r10,4), %xmm2, %xmm2
+	QUAD $0x000000e824848b48                   // movq	232(%rsp), %rax
+	LONG $0xd316e8c5                           // vmovlhps	%xmm3, %xmm2, %xmm2
+	LONG $0x186db262; WORD $0x04b8; BYTE $0x88 // vfmadd231ps	(%rax,%r9,4){1to4}, %xmm2, %xmm0
+	LONG $0x04428d48                           // leaq	4(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_7
+	QUAD $0x000000f024bc8b4c                   // movq	240(%rsp), %r15
+	QUAD $0x000000f824948b4c                   // movq	248(%rsp), %r10
+	LONG $0x030c8d48                           // leaq	(%rbx,%rax), %rcx
+	LONG $0x107ac1c4; WORD $0x8c1c             // vmovss	(%r12,%rcx,4), %xmm3
+	LONG $0x070c8d4d                           // leaq	(%r15,%rax), %r9
+	WORD $0x0149; BYTE $0xc2                   // addq	%rax, %r10
+	LONG $0x033c8d4d                           // leaq	(%r11,%rax), %r15
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x2161c3c4; WORD $0x841c; BYTE $0x10 // vinsertps	$0x10, (%r12,%rax,4), %xmm3, %xmm3
+	LONG $0x107a81c4; WORD $0xbc14             // vmovss	(%r12,%r15,4), %xmm2
+	LONG $0x216983c4; WORD $0x9414; BYTE $0x10 // vinsertps	$0x10, (%r12,%r10,4), %xmm2, %xmm2
+	QUAD $0x000000e824848b48                   // movq	232(%rsp), %rax
+	LONG $0xd316e8c5                           // vmovlhps	%xmm3, %xmm2, %xmm2
+	LONG $0x186db262; WORD $0x04b8; BYTE $0x88 // vfmadd231ps	(%rax,%r9,4){1to4}, %xmm2, %xmm0
+	LONG $0x05428d48                           // leaq	5(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_7
+	QUAD $0x000000f024bc8b4c                   // movq	240(%rsp), %r15
+	QUAD $0x000000f824948b4c                   // movq	248(%rsp), %r10
+	LONG $0x030c8d48                           // leaq	(%rbx,%rax), %rcx
+	LONG $0x06c28348                           // addq	$6, %rdx
+	LONG $0x107ac1c4; WORD $0x8c1c             // vmovss	(%r12,%rcx,4), %xmm3
+	QUAD $0x000000e8248c8b48                   // movq	232(%rsp), %rcx
+	LONG $0x070c8d4d                           // leaq	(%r15,%rax), %r9
+	WORD $0x0149; BYTE $0xc2                   // addq	%rax, %r10
+	LONG $0x033c8d4d                           // leaq	(%r11,%rax), %r15
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x2161c3c4; WORD $0x841c; BYTE $0x10 // vinsertps	$0x10, (%r12,%rax,4), %xmm3, %xmm3
+	LONG $0x107a81c4; WORD $0xbc14             // vmovss	(%r12,%r15,4), %xmm2
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	LONG $0x216983c4; WORD $0x9414; BYTE $0x10 // vinsertps	$0x10, (%r12,%r10,4), %xmm2, %xmm2
+	LONG $0xd316e8c5                           // vmovlhps	%xmm3, %xmm2, %xmm2
+	LONG $0x186db262; WORD $0x04b8; BYTE $0x88 // vfmadd231ps	(%rax,%r9,4){1to4}, %xmm2, %xmm0
+	WORD $0x3949; BYTE $0xd5                   // cmpq	%rdx, %r13
+	JLE  BB0_7
+	QUAD $0x000000f024bc8b4c                   // movq	240(%rsp), %r15
+	QUAD $0x000000f824848b48                   // movq	248(%rsp), %rax
+	LONG $0x13148d4d                           // leaq	(%r11,%rdx), %r10
+	LONG $0x107a81c4; WORD $0x9414             // vmovss	(%r12,%r10,4), %xmm2
+	LONG $0x170c8d4d                           // leaq	(%r15,%rdx), %r9
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x133c8d4c                           // leaq	(%rbx,%rdx), %r15
+	WORD $0x014c; BYTE $0xf2                   // addq	%r14, %rdx
+	LONG $0x2169c3c4; WORD $0x8414; BYTE $0x10 // vinsertps	$0x10, (%r12,%rax,4), %xmm2, %xmm2
+	LONG $0x107a81c4; WORD $0xbc1c             // vmovss	(%r12,%r15,4), %xmm3
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	LONG $0x2161c3c4; WORD $0x941c; BYTE $0x10 // vinsertps	$0x10, (%r12,%rdx,4), %xmm3, %xmm3
+	LONG $0xd316e8c5                           // vmovlhps	%xmm3, %xmm2, %xmm2
+	LONG $0x186db262; WORD $0x04b8; BYTE $0x88 // vfmadd231ps	(%rax,%r9,4){1to4}, %xmm2, %xmm0
+
+BB0_7:
+	LONG $0xc459f8c5               // vmulps	%xmm4, %xmm0, %xmm0
+	QUAD $0x000000b824848b48       // movq	184(%rsp), %rax
+	QUAD $0x0000008824948b48       // movq	136(%rsp), %rdx
+	LONG $0x08fde162; WORD $0xd17e // vmovq	%xmm18, %rcx
+	QUAD $0x0000009824b48b4c       // movq	152(%rsp), %r14
+	QUAD $0x000000d024940148       // addq	%rdx, 208(%rsp)
+	LONG $0x10c08348               // addq	$16, %rax
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	WORD $0x0148; BYTE $0xd7       // addq	%rdx, %rdi
+	QUAD $0x000000e024b4014c       // addq	%r14, 224(%rsp)
+	WORD $0x014d; BYTE $0xf3       // addq	%r14, %r11
+	WORD $0x014c; BYTE $0xf3       // addq	%r14, %rbx
+	LONG $0x4011f8c5; BYTE $0xf0   // vmovups	%xmm0, -16(%rax)
+	QUAD $0x000000b824848948       // movq	%rax, 184(%rsp)
+	WORD $0x3948; BYTE $0xc8       // cmpq	%rcx, %rax
+	JNE  BB0_14
+	LONG $0x245c8b48; BYTE $0x30   // movq	48(%rsp), %rbx
+	QUAD $0x000000b024bc8b48       // movq	176(%rsp), %rdi
+	LONG $0x244c8b4c; BYTE $0x58   // movq	88(%rsp), %r9
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	QUAD $0x000000d824b48b4c       // movq	216(%rsp), %r14
+	LONG $0x247c8b4c; BYTE $0x48   // movq	72(%rsp), %r15
+	WORD $0x8949; BYTE $0xda       // movq	%rbx, %r10
+	WORD $0x3948; BYTE $0xfb       // cmpq	%rdi, %rbx
+	JGE  BB0_153
+
+BB0_16:
+	WORD $0x894d; BYTE $0xd0 // movq	%r10, %r8
+	QUAD $0x000000e024848948 // movq	%rax, 224(%rsp)
+	QUAD $0x000000e8249c8b4c // movq	232(%rsp), %r11
+	LONG $0xc5af0f4d         // imulq	%r13, %r8
+	QUAD $0x000000d024bc894c // movq	%r15, 208(%rsp)
+	QUAD $0x000000d8248c894c // movq	%r9, 216(%rsp)
+	QUAD $0x000000f0248c8b4c // movq	240(%rsp), %r9
+	LONG $0x84348d4b         // leaq	(%r12,%r8,4), %rsi
+
+BB0_31:
+	LONG $0x0ffd8349             // cmpq	$15, %r13
+	JLE  BB0_80
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x000010ba; BYTE $0x00 // movl	$16, %edx
+
+BB0_23:
+	QUAD $0xff967410487cd162 // vmovups	-64(%r14,%rdx,4), %zmm6
+	QUAD $0xff9644b8484df262 // vfmadd231ps	-64(%rsi,%rdx,4), %zmm6, %zmm0
+	LONG $0x10c28348         // addq	$16, %rdx
+	WORD $0x394c; BYTE $0xea // cmpq	%r13, %rdx
+	JLE  BB0_23
+	QUAD $0x00000090248c8b48 // movq	144(%rsp), %rcx
+
+BB0_22:
+	LONG $0x48fdf362; WORD $0xc21b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm2
+	LONG $0xc058ecc5                           // vaddps	%ymm0, %ymm2, %ymm0
+	LONG $0x197de3c4; WORD $0x01c2             // vextractf128	$0x1, %ymm0, %xmm2
+	LONG $0xc058e8c5                           // vaddps	%xmm0, %xmm2, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ed0             // vpermilps	$78, %xmm0, %xmm2
+	LONG $0xd058e8c5                           // vaddps	%xmm0, %xmm2, %xmm2
+	LONG $0xc228f8c5                           // vmovaps	%xmm2, %xmm0
+	LONG $0xd2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xcd                   // cmpq	%rcx, %r13
+	JLE  BB0_24
+	WORD $0x894c; BYTE $0xeb                   // movq	%r13, %rbx
+	QUAD $0x000000f8248c8948                   // movq	%rcx, 248(%rsp)
+	WORD $0x2948; BYTE $0xcb                   // subq	%rcx, %rbx
+	LONG $0xff538d48                           // leaq	-1(%rbx), %rdx
+	LONG $0x0efa8348                           // cmpq	$14, %rdx
+	JBE  BB0_81
+	LONG $0x09148d4a                           // leaq	(%rcx,%r9), %rdx
+	WORD $0x8949; BYTE $0xdf                   // movq	%rbx, %r15
+	LONG $0x933c8d49                           // leaq	(%r11,%rdx,4), %rdi
+	LONG $0x04efc149                           // shrq	$4, %r15
+	LONG $0x08148d49                           // leaq	(%r8,%rcx), %rdx
+	LONG $0x94048d49                           // leaq	(%r12,%rdx,4), %rax
+	LONG $0x06e7c149                           // salq	$6, %r15
+	WORD $0xd231                               // xorl	%edx, %edx
+
+BB0_26:
+	LONG $0x487cf162; WORD $0x3410; BYTE $0x17 // vmovups	(%rdi,%rdx), %zmm6
+	LONG $0x484cf162; WORD $0x1c59; BYTE $0x10 // vmulps	(%rax,%rdx), %zmm6, %zmm3
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0xd3c6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm2
+	LONG $0xf3c6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm6
+	LONG $0x2865f362; WORD $0xeb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm5
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xd315e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xda19; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm2
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xd303; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xd303; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xda1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm3, %ymm2
+	LONG $0xdac6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xeac6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm5
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xea15e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xd319; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x286df362; WORD $0xda03; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x286df362; WORD $0xda03; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm3
+	LONG $0x286df362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm2
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xfa                   // cmpq	%r15, %rdx
+	JNE  BB0_26
+	WORD $0x8949; BYTE $0xdf                   // movq	%rbx, %r15
+	LONG $0xf0e78349                           // andq	$-16, %r15
+	WORD $0x014c; BYTE $0xf9                   // addq	%r15, %rcx
+	WORD $0xc3f6; BYTE $0x0f                   // testb	$15, %bl
+	JE   BB0_24
+
+BB0_25:
+	WORD $0x294c; BYTE $0xfb                   // subq	%r15, %rbx
+	WORD $0x8948; BYTE $0xda                   // movq	%rbx, %rdx
+	LONG $0xff5b8d48                           // leaq	-1(%rbx), %rbx
+	LONG $0x06fb8348                           // cmpq	$6, %rbx
+	JBE  BB0_29
+	QUAD $0x000000f824848b48                   // movq	248(%rsp), %rax
+	LONG $0x381c8d4a                           // leaq	(%rax,%r15), %rbx
+	LONG $0x003c8d49                           // leaq	(%r8,%rax), %rdi
+	WORD $0x014c; BYTE $0xff                   // addq	%r15, %rdi
+	WORD $0x014c; BYTE $0xcb                   // addq	%r9, %rbx
+	LONG $0x107cc1c4; WORD $0xbc14             // vmovups	(%r12,%rdi,4), %ymm2
+	LONG $0x596cc1c4; WORD $0x9b14             // vmulps	(%r11,%rbx,4), %ymm2, %ymm2
+	WORD $0x8948; BYTE $0xd7                   // movq	%rdx, %rdi
+	LONG $0xf8e78348                           // andq	$-8, %rdi
+	WORD $0x0148; BYTE $0xf9                   // addq	%rdi, %rcx
+	WORD $0xe283; BYTE $0x07                   // andl	$7, %edx
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xeac6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm5
+	LONG $0xdac6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xea15e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xd319; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x286df362; WORD $0xda03; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x286df362; WORD $0xda03; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm3
+	LONG $0x286df362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm2
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	JE   BB0_24
+
+BB0_29:
+	LONG $0x08148d49               // leaq	(%r8,%rcx), %rdx
+	LONG $0x093c8d49               // leaq	(%r9,%rcx), %rdi
+	LONG $0x107ac1c4; WORD $0xbb34 // vmovss	(%r11,%rdi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x9404 // vfmadd231ss	(%r12,%rdx,4), %xmm6, %xmm0
+	LONG $0x01518d48               // leaq	1(%rcx), %rdx
+	WORD $0x3949; BYTE $0xd5       // cmpq	%rdx, %r13
+	JLE  BB0_24
+	LONG $0x113c8d49               // leaq	(%r9,%rdx), %rdi
+	WORD $0x014c; BYTE $0xc2       // addq	%r8, %rdx
+	LONG $0x107ac1c4; WORD $0xbb34 // vmovss	(%r11,%rdi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x9404 // vfmadd231ss	(%r12,%rdx,4), %xmm6, %xmm0
+	LONG $0x02518d48               // leaq	2(%rcx), %rdx
+	WORD $0x3949; BYTE $0xd5       // cmpq	%rdx, %r13
+	JLE  BB0_24
+	LONG $0x113c8d49               // leaq	(%r9,%rdx), %rdi
+	WORD $0x014c; BYTE $0xc2       // addq	%r8, %rdx
+	LONG $0x107ac1c4; WORD $0xbb34 // vmovss	(%r11,%rdi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x9404 // vfmadd231ss	(%r12,%rdx,4), %xmm6, %xmm0
+	LONG $0x03518d48               // leaq	3(%rcx), %rdx
+	WORD $0x3949; BYTE $0xd5       // cmpq	%rdx, %r13
+	JLE  BB0_24
+	LONG $0x103c8d49               // leaq	(%r8,%rdx), %rdi
+	WORD $0x014c; BYTE $0xca       // addq	%r9, %rdx
+	LONG $0x107ac1c4; WORD $0xbc34 // vmovss	(%r12,%rdi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x9304 // vfmadd231ss	(%r11,%rdx,4), %xmm6, %xmm0
+	LONG $0x04518d48               // leaq	4(%rcx), %rdx
+	WORD $0x3949; BYTE $0xd5       // cmpq	%rdx, %r13
+	JLE  BB0_24
+	LONG $0x103c8d49               // leaq	(%r8,%rdx), %rdi
+	WORD $0x014c; BYTE $0xca       // addq	%r9, %rdx
+	LONG $0x107ac1c4; WORD $0xbc34 // vmovss	(%r12,%rdi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x9304 // vfmadd231ss	(%r11,%rdx,4), %xmm6, %xmm0
+	LONG $0x05518d48               // leaq	5(%rcx), %rdx
+	WORD $0x3949; BYTE $0xd5       // cmpq	%rdx, %r13
+	JLE  BB0_24
+	LONG $0x103c8d49               // leaq	(%r8,%rdx), %rdi
+	LONG $0x06c18348               // addq	$6, %rcx
+	WORD $0x014c; BYTE $0xca       // addq	%r9, %rdx
+	LONG $0x107ac1c4; WORD $0xbc34 // vmovss	(%r12,%rdi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x9304 // vfmadd231ss	(%r11,%rdx,4), %xmm6, %xmm0
+	WORD $0x3949; BYTE $0xcd       // cmpq	%rcx, %r13
+	JLE  BB0_24
+	LONG $0x09148d49               // leaq	(%r9,%rcx), %rdx
+	WORD $0x014c; BYTE $0xc1       // addq	%r8, %rcx
+	LONG $0x107ac1c4; WORD $0x9334 // vmovss	(%r11,%rdx,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8c04 // vfmadd231ss	(%r12,%rcx,4), %xmm6, %xmm0
+
+BB0_24:
+	LONG $0xc059f2c5               // vmulss	%xmm0, %xmm1, %xmm0
+	QUAD $0x000000e024848b48       // movq	224(%rsp), %rax
+	WORD $0x014d; BYTE $0xe8       // addq	%r13, %r8
+	LONG $0x117aa1c4; WORD $0x9004 // vmovss	%xmm0, (%rax,%r10,4)
+	QUAD $0x0000009824848b48       // movq	152(%rsp), %rax
+	LONG $0x01c28349               // addq	$1, %r10
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	QUAD $0x000000b02494394c       // cmpq	%r10, 176(%rsp)
+	JG   BB0_31
+	LONG $0x247c8348; WORD $0x0078 // cmpq	$0, 120(%rsp)
+	QUAD $0x000000d8248c8b4c       // movq	216(%rsp), %r9
+	QUAD $0x000000e024848b48       // movq	224(%rsp), %rax
+	QUAD $0x000000d024bc8b4c       // movq	208(%rsp), %r15
+	JNE  BB0_154
+
+BB0_21:
+	QUAD $0x000000b024bc8348; BYTE $0x01 // cmpq	$1, 176(%rsp)
+	LONG $0x00107ac5                     // vmovss	(%rax), %xmm8
+	JLE  BB0_84
+
+BB0_18:
+	LONG $0x244c8b48; BYTE $0x68 // movq	104(%rsp), %rcx
+	LONG $0x04508d48             // leaq	4(%rax), %rdx
+
+BB0_48:
+	LONG         $0x0210fac5                     // vmovss	(%rdx), %xmm0
+	LONG         $0x04c28348                     // addq	$4, %rdx
+	LONG         $0x5f7a41c4; BYTE $0xc0         // vmaxss	%xmm8, %xmm0, %xmm8
+	WORD         $0x3948; BYTE $0xca             // cmpq	%rcx, %rdx
+	JNE          BB0_48
+	QUAD         $0x000000b024bc8348; BYTE $0x0f // cmpq	$15, 176(%rsp)
+	LONG         $0x487dd262; WORD $0xf818       // vbroadcastss	%xmm8, %zmm7
+	JLE          BB0_84
+	LONG         $0x24548b48; BYTE $0x60         // movq	96(%rsp), %rdx
+	LONG         $0xdb57e0c5                     // vxorps	%xmm3, %xmm3, %xmm3
+	LONG         $0x00007fbe; BYTE $0x00         // movl	$127, %esi
+	VBROADCASTSS CPI0_3<>(SB), Z20               // vbroadcastss	.LCPI0_3(%rip), %zmm20
+	VBROADCASTSS CPI0_5<>(SB), Z19               // vbroadcastss	.LCPI0_5(%rip), %zmm19
+	LONG         $0x487df262; WORD $0xf67c       // vpbroadcastd	%esi, %zmm6
+	VBROADCASTSS CPI0_7<>(SB), Z18               // vbroadcastss	.LCPI0_7(%rip), %zmm18
+	LONG         $0x487c7162; WORD $0xcb28       // vmovaps	%zmm3, %zmm9
+	VBROADCASTSS CPI0_9<>(SB), Z17               // vbroadcastss	.LCPI0_9(%rip), %zmm17
+	LONG         $0xf0e28348                     // andq	$-16, %rdx
+	VBROADCASTSS CPI0_11<>(SB), Z16              // vbroadcastss	.LCPI0_11(%rip), %zmm16
+	VBROADCASTSS CPI0_13<>(SB), Z15              // vbroadcastss	.LCPI0_13(%rip), %zmm15
+	WORD         $0x014c; BYTE $0xca             // addq	%r9, %rdx
+	VBROADCASTSS CPI0_15<>(SB), Z14              // vbroadcastss	.LCPI0_15(%rip), %zmm14
+	VBROADCASTSS CPI0_17<>(SB), Z13              // vbroadcastss	.LCPI0_17(%rip), %zmm13
+	LONG         $0x974c8d49; BYTE $0x40         // leaq	64(%r15,%rdx,4), %rcx
+	VBROADCASTSS CPI0_19<>(SB), Z12              // vbroadcastss	.LCPI0_19(%rip), %zmm12
+	WORD         $0x8948; BYTE $0xc2             // movq	%rax, %rdx
+	VBROADCASTSS CPI0_21<>(SB), Z11              // vbroadcastss	.LCPI0_21(%rip), %zmm11
+	VBROADCASTSS CPI0_23<>(SB), Z5               // vbroadcastss	.LCPI0_23(%rip), %zmm5
+	VBROADCASTSS CPI0_0<>(SB), Z10               // vbroadcastss	.LCPI0_0(%rip), %zmm10
+
+BB0_51:
+	LONG $0x487cf162; WORD $0x0210             // vmovups	(%rdx), %zmm0
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x487cf162; WORD $0xd75c             // vsubps	%zmm7, %zmm0, %zmm2
+	LONG $0x487cd162; WORD $0xc728             // vmovaps	%zmm15, %zmm0
+	LONG $0x486ca162; WORD $0xea59             // vmulps	%zmm18, %zmm2, %zmm21
+	LONG $0x486cb162; WORD $0xd4c2; BYTE $0x1e // vcmpps	$30, %zmm20, %zmm2, %k2
+	LONG $0x486cb162; WORD $0xcbc2; BYTE $0x11 // vcmpps	$17, %zmm19, %zmm2, %k1
+	LONG $0x487da362; WORD $0xed08; BYTE $0x08 // vrndscaleps	$8, %zmm21, %zmm21
+	LONG $0x4055b262; WORD $0xd1bc             // vfnmadd231ps	%zmm17, %zmm21, %zmm2
+	LONG $0x4055b262; WORD $0xd0bc             // vfnmadd231ps	%zmm16, %zmm21, %zmm2
+	LONG $0x487da162; WORD $0xed5b             // vcvtps2dq	%zmm21, %zmm21
+	LONG $0x4055e162; WORD $0xeefe             // vpaddd	%zmm6, %zmm21, %zmm21
+	LONG $0x4055b162; WORD $0xf572; BYTE $0x17 // vpslld	$23, %zmm21, %zmm21
+	LONG $0x480df262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm14, %zmm0
+	LONG $0x4815f262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm13, %zmm0
+	LONG $0x481df262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm12, %zmm0
+	LONG $0x4825f262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm11, %zmm0
+	LONG $0x4855f262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm5, %zmm0
+	LONG $0x4855f262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm5, %zmm0
+	LONG $0x487cb162; WORD $0xc559             // vmulps	%zmm21, %zmm0, %zmm0
+	LONG $0x4a7cd162; WORD $0xc228             // vmovaps	%zmm10, %zmm0{%k2}
+	LONG $0x497cd162; WORD $0xc128             // vmovaps	%zmm9, %zmm0{%k1}
+	LONG $0x487cf162; WORD $0x4211; BYTE $0xff // vmovups	%zmm0, -64(%rdx)
+	LONG $0x4864f162; WORD $0xd858             // vaddps	%zmm0, %zmm3, %zmm3
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JNE  BB0_51
+	LONG $0x24548b48; BYTE $0x70               // movq	112(%rsp), %rdx
+
+BB0_50:
+	LONG         $0x48fdf362; WORD $0xd81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm3, %ymm0
+	QUAD         $0x000000b0249c8b48                   // movq	176(%rsp), %rbx
+	LONG         $0xc358fcc5                           // vaddps	%ymm3, %ymm0, %ymm0
+	LONG         $0x197de3c4; WORD $0x01c2             // vextractf128	$0x1, %ymm0, %xmm2
+	LONG         $0xd058e8c5                           // vaddps	%xmm0, %xmm2, %xmm2
+	LONG         $0x0479e3c4; WORD $0x4ec2             // vpermilps	$78, %xmm2, %xmm0
+	LONG         $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG         $0xe828f8c5                           // vmovaps	%xmm0, %xmm5
+	LONG         $0xc0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm0
+	LONG         $0xe858d2c5                           // vaddss	%xmm0, %xmm5, %xmm5
+	WORD         $0x3948; BYTE $0xd3                   // cmpq	%rdx, %rbx
+	JLE          BB0_52
+	WORD         $0x2948; BYTE $0xd3                   // subq	%rdx, %rbx
+	WORD         $0x8949; BYTE $0xd2                   // movq	%rdx, %r10
+	LONG         $0xff4b8d48                           // leaq	-1(%rbx), %rcx
+	WORD         $0x8949; BYTE $0xd8                   // movq	%rbx, %r8
+	LONG         $0x0ef98348                           // cmpq	$14, %rcx
+	JBE          BB0_85
+	WORD         $0x8948; BYTE $0xde                   // movq	%rbx, %rsi
+	LONG         $0x0a0c8d4a                           // leaq	(%rdx,%r9), %rcx
+	LONG         $0x0003ffbf; BYTE $0x00               // movl	$1023, %edi
+	VBROADCASTSS CPI0_0<>(SB), Z10                     // vbroadcastss	.LCPI0_0(%rip), %zmm10
+	LONG         $0x04eec148                           // shrq	$4, %rsi
+	LONG         $0x8f0c8d49                           // leaq	(%r15,%rcx,4), %rcx
+	VBROADCASTSD CPI0_27<>(SB), Z28                    // vbroadcastsd	.LCPI0_27(%rip), %zmm28
+	VBROADCASTSD CPI0_87<>(SB), Z27                    // vbroadcastsd	.LCPI0_87(%rip), %zmm27
+	LONG         $0x06e6c148                           // salq	$6, %rsi
+	LONG         $0x487d4262; WORD $0xf818             // vbroadcastss	%xmm8, %zmm31
+	VBROADCASTSD CPI0_86<>(SB), Z26                    // vbroadcastsd	.LCPI0_86(%rip), %zmm26
+	VBROADCASTSD CPI0_33<>(SB), Z25                    // vbroadcastsd	.LCPI0_33(%rip), %zmm25
+	VBROADCASTSD CPI0_35<>(SB), Z24                    // vbroadcastsd	.LCPI0_35(%rip), %zmm24
+	WORD         $0x0148; BYTE $0xce                   // addq	%rcx, %rsi
+	VBROADCASTSD CPI0_37<>(SB), Z23                    // vbroadcastsd	.LCPI0_37(%rip), %zmm23
+	LONG         $0x48fd7262; WORD $0xdf7c             // vpbroadcastq	%rdi, %zmm11
+	VBROADCASTSD CPI0_39<>(SB), Z22                    // vbroadcastsd	.LCPI0_39(%rip), %zmm22
+	VBROADCASTSD CPI0_41<>(SB), Z21                    // vbroadcastsd	.LCPI0_41(%rip), %zmm21
+	QUAD         $0x0000f8248c11fac5; BYTE $0x00       // vmovss	%xmm1, 248(%rsp)
+	VBROADCASTSD CPI0_43<>(SB), Z20                    // vbroadcastsd	.LCPI0_43(%rip), %zmm20
+	VBROADCASTSD CPI0_45<>(SB), Z19                    // vbroadcastsd	.LCPI0_45(%rip), %zmm19
+	QUAD         $0x0000e02484117ac5; BYTE $0x00       // vmovss	%xmm8, 224(%rsp)
+	VBROADCASTSD CPI0_47<>(SB), Z18                    // vbroadcastsd	.LCPI0_47(%rip), %zmm18
+	VBROADCASTSD CPI0_49<>(SB), Z17                    // vbroadcastsd	.LCPI0_49(%rip), %zmm17
+	VBROADCASTSD CPI0_51<>(SB), Z16                    // vbroadcastsd	.LCPI0_51(%rip), %zmm16
+	VBROADCASTSD CPI0_53<>(SB), Z15                    // vbroadcastsd	.LCPI0_53(%rip), %zmm15
+	VBROADCASTSD CPI0_55<>(SB), Z14                    // vbroadcastsd	.LCPI0_55(%rip), %zmm14
+	VBROADCASTSD CPI0_57<>(SB), Z13                    // vbroadcastsd	.LCPI0_57(%rip), %zmm13
+	VBROADCASTSD CPI0_59<>(SB), Z9                     // vbroadcastsd	.LCPI0_59(%rip), %zmm9
+	VBROADCASTSS CPI0_62<>(SB), Z30                    // vbroadcastss	.LCPI0_62(%rip), %zmm30
+	VBROADCASTSS CPI0_64<>(SB), Z12                    // vbroadcastss	.LCPI0_64(%rip), %zmm12
+
+BB0_54:
+	LONG $0x487cf162; WORD $0x0910             // vmovups	(%rcx), %zmm1
+	LONG $0x48fd9162; WORD $0xc328             // vmovapd	%zmm27, %zmm0
+	LONG $0x40c18348                           // addq	$64, %rcx
+	LONG $0x48741162; WORD $0xc75c             // vsubps	%zmm31, %zmm1, %zmm8
+	LONG $0x487cd162; WORD $0xf05a             // vcvtps2pd	%ymm8, %zmm6
+	LONG $0x48cd9162; WORD $0xd459             // vmulpd	%zmm28, %zmm6, %zmm2
+	LONG $0x487d7362; WORD $0xc31b; BYTE $0x01 // vextractf32x8	$0x1, %zmm8, %ymm3
+	LONG $0x487cf162; WORD $0xdb5a             // vcvtps2pd	%ymm3, %zmm3
+	LONG $0x48e59162; WORD $0xfc59             // vmulpd	%zmm28, %zmm3, %zmm7
+	LONG $0x483cd162; WORD $0xccc2; BYTE $0x0a // vcmpps	$10, %zmm12, %zmm8, %k1
+	LONG $0x481cd162; WORD $0xd0c2; BYTE $0x01 // vcmpps	$1, %zmm8, %zmm12, %k2
+	LONG $0x493c9162; WORD $0xcec2; BYTE $0x05 // vcmpps	$5, %zmm30, %zmm8, %k1{%k1}
+	LONG $0x48ed9362; WORD $0xc225; BYTE $0xf8 // vpternlogq	$248, %zmm26, %zmm2, %zmm0
+	LONG $0x48edf162; WORD $0xd058             // vaddpd	%zmm0, %zmm2, %zmm2
+	LONG $0x48fd9162; WORD $0xc328             // vmovapd	%zmm27, %zmm0
+	LONG $0x48c59362; WORD $0xc225; BYTE $0xf8 // vpternlogq	$248, %zmm26, %zmm7, %zmm0
+	LONG $0x48c5f162; WORD $0xf858             // vaddpd	%zmm0, %zmm7, %zmm7
+	LONG $0x48fdf362; WORD $0xd209; BYTE $0x03 // vrndscalepd	$3, %zmm2, %zmm2
+	LONG $0x48fdf362; WORD $0xff09; BYTE $0x03 // vrndscalepd	$3, %zmm7, %zmm7
+	LONG $0x48ed9262; WORD $0xf1bc             // vfnmadd231pd	%zmm25, %zmm2, %zmm6
+	LONG $0x48c59262; WORD $0xd9bc             // vfnmadd231pd	%zmm25, %zmm7, %zmm3
+	LONG $0x48ed9262; WORD $0xf0bc             // vfnmadd231pd	%zmm24, %zmm2, %zmm6
+	LONG $0x48fdf162; WORD $0xd27a             // vcvttpd2qq	%zmm2, %zmm2
+	LONG $0x48edd162; WORD $0xd3d4             // vpaddq	%zmm11, %zmm2, %zmm2
+	LONG $0x48edf162; WORD $0xf273; BYTE $0x34 // vpsllq	$52, %zmm2, %zmm2
+	LONG $0x48c59262; WORD $0xd8bc             // vfnmadd231pd	%zmm24, %zmm7, %zmm3
+	LONG $0x48fdf162; WORD $0xff7a             // vcvttpd2qq	%zmm7, %zmm7
+	LONG $0x48c5d162; WORD $0xfbd4             // vpaddq	%zmm11, %zmm7, %zmm7
+	LONG $0x48c5f162; WORD $0xf773; BYTE $0x34 // vpsllq	$52, %zmm7, %zmm7
+	LONG $0x48fdf162; WORD $0xce28             // vmovapd	%zmm6, %zmm1
+	LONG $0x40cdb262; WORD $0xcf98             // vfmadd132pd	%zmm23, %zmm22, %zmm1
+	LONG $0x48fdf162; WORD $0xc328             // vmovapd	%zmm3, %zmm0
+	LONG $0x40cdb262; WORD $0xc798             // vfmadd132pd	%zmm23, %zmm22, %zmm0
+	LONG $0x40d5f262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm21, %zmm1
+	LONG $0x40d5f262; WORD $0xc398             // vfmadd132pd	%zmm3, %zmm21, %zmm0
+	LONG $0x40ddf262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm20, %zmm1
+	LONG $0x40ddf262; WORD $0xc398             // vfmadd132pd	%zmm3, %zmm20, %zmm0
+	LONG $0x40e5f262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm19, %zmm1
+	LONG $0x40e5f262; WORD $0xc398             // vfmadd132pd	%zmm3, %zmm19, %zmm0
+	LONG $0x40edf262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm18, %zmm1
+	LONG $0x40edf262; WORD $0xc398             // vfmadd132pd	%zmm3, %zmm18, %zmm0
+	LONG $0x40f5f262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm17, %zmm1
+	LONG $0x40f5f262; WORD $0xc398             // vfmadd132pd	%zmm3, %zmm17, %zmm0
+	LONG $0x40fdf262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm16, %zmm1
+	LONG $0x40fdf262; WORD $0xc398             // vfmadd132pd	%zmm3, %zmm16, %zmm0
+	LONG $0x4885f262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm15, %zmm1
+	LONG $0x4885f262; WORD $0xc398             // vfmadd132pd	%zmm3, %zmm15, %zmm0
+	LONG $0x488df262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm14, %zmm1
+	LONG $0x488df262; WORD $0xc398             // vfmadd132pd	%zmm3, %zmm14, %zmm0
+	LONG $0x4895f262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm13, %zmm1
+	LONG $0x4895f262; WORD $0xc398             // vfmadd132pd	%zmm3, %zmm13, %zmm0
+	LONG $0x48b5f262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm9, %zmm1
+	LONG $0x48b5f262; WORD $0xc398             // vfmadd132pd	%zmm3, %zmm9, %zmm0
+	LONG $0x48b5f262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm9, %zmm1
+	LONG $0x48b5f262; WORD $0xc398             // vfmadd132pd	%zmm3, %zmm9, %zmm0
+	LONG $0x48f5f162; WORD $0xca59             // vmulpd	%zmm2, %zmm1, %zmm1
+	LONG $0x48fdf162; WORD $0xc759             // vmulpd	%zmm7, %zmm0, %zmm0
+	LONG $0x48fdf162; WORD $0xc95a             // vcvtpd2ps	%zmm1, %ymm1
+	LONG $0x48fdf162; WORD $0xc05a             // vcvtpd2ps	%zmm0, %ymm0
+	LONG $0x48f5f362; WORD $0xc81a; BYTE $0x01 // vinsertf64x4	$0x1, %ymm0, %zmm1, %zmm1
+	LONG $0xca7cd162; WORD $0xc228             // vmovaps	%zmm10, %zmm0{%k2}{z}
+	LONG $0x497cf162; WORD $0xc128             // vmovaps	%zmm1, %zmm0{%k1}
+	LONG $0xd0c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm2
+	LONG $0x287df362; WORD $0xc803; BYTE $0x07 // valignd	$7, %ymm0, %ymm0, %ymm1
+	LONG $0xd858d2c5                           // vaddss	%xmm0, %xmm5, %xmm3
+	LONG $0xe8c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm5
+	LONG $0x487cf162; WORD $0x4111; BYTE $0xff // vmovups	%zmm0, -64(%rcx)
+	LONG $0xeb58d2c5                           // vaddss	%xmm3, %xmm5, %xmm5
+	LONG $0xd815f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm3
+	LONG $0xdd58e2c5                           // vaddss	%xmm5, %xmm3, %xmm3
+	LONG $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xc319; BYTE $0x01 // vextractf32x4	$1, %ymm0, %xmm3
+	LONG $0xd258e2c5                           // vaddss	%xmm2, %xmm3, %xmm2
+	LONG $0x287df362; WORD $0xd803; BYTE $0x05 // valignd	$5, %ymm0, %ymm0, %ymm3
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xd003; BYTE $0x06 // valignd	$6, %ymm0, %ymm0, %ymm2
+	LONG $0x487df362; WORD $0xc01b; BYTE $0x01 // vextractf32x8	$0x1, %zmm0, %ymm0
+	LONG $0x287df362; WORD $0xe803; BYTE $0x06 // valignd	$6, %ymm0, %ymm0, %ymm5
+	LONG $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG $0xd8c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm3
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xd0c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm2
+	LONG $0xc958fac5                           // vaddss	%xmm1, %xmm0, %xmm1
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0xc815f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm1
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xc119; BYTE $0x01 // vextractf32x4	$1, %ymm0, %xmm1
+	LONG $0xd258f2c5                           // vaddss	%xmm2, %xmm1, %xmm2
+	LONG $0x287df362; WORD $0xc803; BYTE $0x05 // valignd	$5, %ymm0, %ymm0, %ymm1
+	LONG $0x287df362; WORD $0xc003; BYTE $0x07 // valignd	$7, %ymm0, %ymm0, %ymm0
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xe958d2c5                           // vaddss	%xmm1, %xmm5, %xmm5
+	LONG $0xe858d2c5                           // vaddss	%xmm0, %xmm5, %xmm5
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JNE  BB0_54
+	QUAD $0x0000f8248c10fac5; BYTE $0x00       // vmovss	248(%rsp), %xmm1
+	WORD $0x894c; BYTE $0xc7                   // movq	%r8, %rdi
+	QUAD $0x0000e02484107ac5; BYTE $0x00       // vmovss	224(%rsp), %xmm8
+	LONG $0xf0e78348                           // andq	$-16, %rdi
+	WORD $0x0148; BYTE $0xfa                   // addq	%rdi, %rdx
+	LONG $0x0fc0f641                           // testb	$15, %r8b
+	JE   BB0_58
+
+BB0_53:
+	WORD         $0x894c; BYTE $0xc6                   // movq	%r8, %rsi
+	WORD         $0x2948; BYTE $0xfe                   // subq	%rdi, %rsi
+	LONG         $0xff4e8d48                           // leaq	-1(%rsi), %rcx
+	LONG         $0x06f98348                           // cmpq	$6, %rcx
+	JBE          BB0_59
+	LONG         $0x0a0c8d4b                           // leaq	(%r10,%r9), %rcx
+	LONG         $0x187dc2c4; BYTE $0xc0               // vbroadcastss	%xmm8, %ymm0
+	VBROADCASTSD CPI0_27<>(SB), Y7                     // vbroadcastsd	.LCPI0_27(%rip), %ymm7
+	VBROADCASTSD CPI0_87<>(SB), Y2                     // vbroadcastsd	.LCPI0_87(%rip), %ymm2
+	WORD         $0x0148; BYTE $0xf9                   // addq	%rdi, %rcx
+	LONG         $0x0003ffbf; BYTE $0x00               // movl	$1023, %edi
+	LONG         $0x8f0c8d49                           // leaq	(%r15,%rcx,4), %rcx
+	LONG         $0xda287dc5                           // vmovapd	%ymm2, %ymm11
+	LONG         $0x3110fcc5                           // vmovups	(%rcx), %ymm6
+	LONG         $0xd05c4cc5                           // vsubps	%ymm0, %ymm6, %ymm10
+	VBROADCASTSD CPI0_86<>(SB), Y6                     // vbroadcastsd	.LCPI0_86(%rip), %ymm6
+	LONG         $0x5a7cc1c4; BYTE $0xc2               // vcvtps2pd	%xmm10, %ymm0
+	LONG         $0xcf597dc5                           // vmulpd	%ymm7, %ymm0, %ymm9
+	LONG         $0x197d63c4; WORD $0x01d3             // vextractf128	$0x1, %ymm10, %xmm3
+	LONG         $0xdb5afcc5                           // vcvtps2pd	%xmm3, %ymm3
+	LONG         $0xff59e5c5                           // vmulpd	%ymm7, %ymm3, %ymm7
+	LONG         $0x28b57362; WORD $0xde25; BYTE $0xf8 // vpternlogq	$248, %ymm6, %ymm9, %ymm11
+	LONG         $0x583541c4; BYTE $0xcb               // vaddpd	%ymm11, %ymm9, %ymm9
+	LONG         $0x28c5f362; WORD $0xd625; BYTE $0xf8 // vpternlogq	$248, %ymm6, %ymm7, %ymm2
+	VBROADCASTSD CPI0_39<>(SB), Y11                    // vbroadcastsd	.LCPI0_39(%rip), %ymm11
+	LONG         $0xfa58c5c5                           // vaddpd	%ymm2, %ymm7, %ymm7
+	VBROADCASTSD CPI0_33<>(SB), Y2                     // vbroadcastsd	.LCPI0_33(%rip), %ymm2
+	LONG         $0x28fd5362; WORD $0xc909; BYTE $0x03 // vrndscalepd	$3, %ymm9, %ymm9
+	LONG         $0x28fdf362; WORD $0xff09; BYTE $0x03 // vrndscalepd	$3, %ymm7, %ymm7
+	LONG         $0xbcb5e2c4; BYTE $0xc2               // vfnmadd231pd	%ymm2, %ymm9, %ymm0
+	LONG         $0x9ce5e2c4; BYTE $0xd7               // vfnmadd132pd	%ymm7, %ymm3, %ymm2
+	VBROADCASTSD CPI0_35<>(SB), Y3                     // vbroadcastsd	.LCPI0_35(%rip), %ymm3
+	LONG         $0xbcb5e2c4; BYTE $0xc3               // vfnmadd231pd	%ymm3, %ymm9, %ymm0
+	LONG         $0x9cede2c4; BYTE $0xdf               // vfnmadd132pd	%ymm7, %ymm2, %ymm3
+	VBROADCASTSD CPI0_37<>(SB), Y2                     // vbroadcastsd	.LCPI0_37(%rip), %ymm2
+	LONG         $0xf028fdc5                           // vmovapd	%ymm0, %ymm6
+	LONG         $0x98a5e2c4; BYTE $0xf2               // vfmadd132pd	%ymm2, %ymm11, %ymm6
+	LONG         $0x98a5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm11, %ymm2
+	VBROADCASTSD CPI0_41<>(SB), Y11                    // vbroadcastsd	.LCPI0_41(%rip), %ymm11
+	LONG         $0x98a5e2c4; BYTE $0xf0               // vfmadd132pd	%ymm0, %ymm11, %ymm6
+	LONG         $0x98a5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm11, %ymm2
+	VBROADCASTSD CPI0_43<>(SB), Y11                    // vbroadcastsd	.LCPI0_43(%rip), %ymm11
+	LONG         $0x98a5e2c4; BYTE $0xf0               // vfmadd132pd	%ymm0, %ymm11, %ymm6
+	LONG         $0x98a5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm11, %ymm2
+	VBROADCASTSD CPI0_45<>(SB), Y11                    // vbroadcastsd	.LCPI0_45(%rip), %ymm11
+	LONG         $0x98a5e2c4; BYTE $0xf0               // vfmadd132pd	%ymm0, %ymm11, %ymm6
+	LONG         $0x98a5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm11, %ymm2
+	VBROADCASTSD CPI0_47<>(SB), Y11                    // vbroadcastsd	.LCPI0_47(%rip), %ymm11
+	LONG         $0x98a5e2c4; BYTE $0xf0               // vfmadd132pd	%ymm0, %ymm11, %ymm6
+	LONG         $0x98a5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm11, %ymm2
+	VBROADCASTSD CPI0_49<>(SB), Y11                    // vbroadcastsd	.LCPI0_49(%rip), %ymm11
+	LONG         $0x98a5e2c4; BYTE $0xf0               // vfmadd132pd	%ymm0, %ymm11, %ymm6
+	LONG         $0x98a5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm11, %ymm2
+	VBROADCASTSD CPI0_51<>(SB), Y11                    // vbroadcastsd	.LCPI0_51(%rip), %ymm11
+	LONG         $0x98a5e2c4; BYTE $0xf0               // vfmadd132pd	%ymm0, %ymm11, %ymm6
+	LONG         $0x98a5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm11, %ymm2
+	VBROADCASTSD CPI0_53<>(SB), Y11                    // vbroadcastsd	.LCPI0_53(%rip), %ymm11
+	LONG         $0x98a5e2c4; BYTE $0xf0               // vfmadd132pd	%ymm0, %ymm11, %ymm6
+	LONG         $0x98a5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm11, %ymm2
+	VBROADCASTSD CPI0_55<>(SB), Y11                    // vbroadcastsd	.LCPI0_55(%rip), %ymm11
+	LONG         $0x98a5e2c4; BYTE $0xf0               // vfmadd132pd	%ymm0, %ymm11, %ymm6
+	LONG         $0x98a5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm11, %ymm2
+	VBROADCASTSD CPI0_57<>(SB), Y11                    // vbroadcastsd	.LCPI0_57(%rip), %ymm11
+	LONG         $0x98a5e2c4; BYTE $0xf0               // vfmadd132pd	%ymm0, %ymm11, %ymm6
+	LONG         $0x98a5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm11, %ymm2
+	VBROADCASTSD CPI0_59<>(SB), Y11                    // vbroadcastsd	.LCPI0_59(%rip), %ymm11
+	LONG         $0x98a5e2c4; BYTE $0xf0               // vfmadd132pd	%ymm0, %ymm11, %ymm6
+	LONG         $0x98a5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm11, %ymm2
+	LONG         $0x98a5e2c4; BYTE $0xc6               // vfmadd132pd	%ymm6, %ymm11, %ymm0
+	LONG         $0x98a5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm11, %ymm2
+	LONG         $0x28fdf262; WORD $0xf77c             // vpbroadcastq	%rdi, %ymm6
+	LONG         $0x28fdd162; WORD $0xd97a             // vcvttpd2qq	%ymm9, %ymm3
+	LONG         $0xded4e5c5                           // vpaddq	%ymm6, %ymm3, %ymm3
+	LONG         $0xf373e5c5; BYTE $0x34               // vpsllq	$52, %ymm3, %ymm3
+	LONG         $0xc359fdc5                           // vmulpd	%ymm3, %ymm0, %ymm0
+	LONG         $0x28fdf162; WORD $0xdf7a             // vcvttpd2qq	%ymm7, %ymm3
+	LONG         $0xded4e5c5                           // vpaddq	%ymm6, %ymm3, %ymm3
+	LONG         $0xf373e5c5; BYTE $0x34               // vpsllq	$52, %ymm3, %ymm3
+	LONG         $0xd359edc5                           // vmulpd	%ymm3, %ymm2, %ymm2
+	VBROADCASTSS CPI0_62<>(SB), Y3                     // vbroadcastss	.LCPI0_62(%rip), %ymm3
+	LONG         $0x282cf162; WORD $0xcbc2; BYTE $0x05 // vcmpps	$5, %ymm3, %ymm10, %k1
+	VBROADCASTSS CPI0_0<>(SB), Y3                      // vbroadcastss	.LCPI0_0(%rip), %ymm3
+	LONG         $0xc05afdc5                           // vcvtpd2psy	%ymm0, %xmm0
+	LONG         $0xd25afdc5                           // vcvtpd2psy	%ymm2, %xmm2
+	LONG         $0x187de3c4; WORD $0x01c2             // vinsertf128	$0x1, %xmm2, %ymm0, %ymm0
+	VBROADCASTSS CPI0_64<>(SB), Y2                     // vbroadcastss	.LCPI0_64(%rip), %ymm2
+	LONG         $0x292cf162; WORD $0xcac2; BYTE $0x0a // vcmpps	$10, %ymm2, %ymm10, %k1{%k1}
+	LONG         $0xc26cc1c4; WORD $0x01d2             // vcmpltps	%ymm10, %ymm2, %ymm2
+	LONG         $0xd354ecc5                           // vandps	%ymm3, %ymm2, %ymm2
+	LONG         $0x296df262; WORD $0xc065             // vblendmps	%ymm0, %ymm2, %ymm0{%k1}
+	LONG         $0xd058d2c5                           // vaddss	%xmm0, %xmm5, %xmm2
+	LONG         $0xe8c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm5
+	LONG         $0xd8c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm3
+	LONG         $0x0111fcc5                           // vmovups	%ymm0, (%rcx)
+	WORD         $0x8948; BYTE $0xf1                   // movq	%rsi, %rcx
+	LONG         $0xf8e18348                           // andq	$-8, %rcx
+	LONG         $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG         $0xe815f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm5
+	WORD         $0x0148; BYTE $0xca                   // addq	%rcx, %rdx
+	WORD         $0xe683; BYTE $0x07                   // andl	$7, %esi
+	LONG         $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG         $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG         $0x287df362; WORD $0xc319; BYTE $0x01 // vextractf32x4	$1, %ymm0, %xmm3
+	LONG         $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG         $0x287df362; WORD $0xd803; BYTE $0x05 // valignd	$5, %ymm0, %ymm0, %ymm3
+	LONG         $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG         $0x287df362; WORD $0xd803; BYTE $0x06 // valignd	$6, %ymm0, %ymm0, %ymm3
+	LONG         $0x287df362; WORD $0xc003; BYTE $0x07 // valignd	$7, %ymm0, %ymm0, %ymm0
+	LONG         $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG         $0xe858eac5                           // vaddss	%xmm0, %xmm2, %xmm5
+	JE           BB0_58
+
+BB0_59:
+	VMOVSD CPI0_33<>(SB), X11  // vmovsd	.LCPI0_33(%rip), %xmm11
+	VMOVSD CPI0_35<>(SB), X10  // vmovsd	.LCPI0_35(%rip), %xmm10
+	VMOVSD CPI0_37<>(SB), X9   // vmovsd	.LCPI0_37(%rip), %xmm9
+	QUAD   $0x000000b0248c8b48 // movq	176(%rsp), %rcx
+	VMOVSD CPI0_39<>(SB), X7   // vmovsd	.LCPI0_39(%rip), %xmm7
+	VMOVSD CPI0_41<>(SB), X6   // vmovsd	.LCPI0_41(%rip), %xmm6
+
+BB0_63:
+	LONG        $0x1410fac5; BYTE $0x90               // vmovss	(%rax,%rdx,4), %xmm2
+	LONG        $0x087c9162; WORD $0xc528             // vmovaps	%xmm29, %xmm0
+	LONG        $0x5c6ac1c4; BYTE $0xd0               // vsubss	%xmm8, %xmm2, %xmm2
+	VCOMISS     CPI0_64<>(SB), X2                     // vcomiss	.LCPI0_64(%rip), %xmm2
+	JA          BB0_64
+	VMOVSS      CPI0_62<>(SB), X3                     // vmovss	.LCPI0_62(%rip), %xmm3
+	LONG        $0xc057f8c5                           // vxorps	%xmm0, %xmm0, %xmm0
+	LONG        $0xda2ff8c5                           // vcomiss	%xmm2, %xmm3
+	JA          BB0_64
+	VMOVQ       CPI0_87<>(SB), X0                     // vmovq	.LCPI0_87(%rip), %xmm0
+	LONG        $0xd25aeac5                           // vcvtss2sd	%xmm2, %xmm2, %xmm2
+	VMULSD      CPI0_27<>(SB), X2, X3                 // vmulsd	.LCPI0_27(%rip), %xmm2, %xmm3
+	VMOVSD      CPI0_59<>(SB), X12                    // vmovsd	.LCPI0_59(%rip), %xmm12
+	VPTERNLOGQ  $248, CPI0_86<>(SB), X3, X0           // vpternlogq	$248, .LCPI0_86(%rip), %xmm3, %xmm0
+	LONG        $0xd858e3c5                           // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG        $0x08e5f362; WORD $0xdb0b; BYTE $0x03 // vrndscalesd	$3, %xmm3, %xmm3, %xmm3
+	LONG        $0xbde1c2c4; BYTE $0xd3               // vfnmadd231sd	%xmm11, %xmm3, %xmm2
+	LONG        $0x2cfbe1c4; BYTE $0xf3               // vcvttsd2siq	%xmm3, %rsi
+	LONG        $0xffc68148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rsi
+	LONG        $0xbde1c2c4; BYTE $0xd2               // vfnmadd231sd	%xmm10, %xmm3, %xmm2
+	LONG        $0x34e6c148                           // salq	$52, %rsi
+	LONG        $0x6ef9e1c4; BYTE $0xde               // vmovq	%rsi, %xmm3
+	LONG        $0xc210ebc5                           // vmovsd	%xmm2, %xmm2, %xmm0
+	LONG        $0x99c1c2c4; BYTE $0xc1               // vfmadd132sd	%xmm9, %xmm7, %xmm0
+	LONG        $0x99c9e2c4; BYTE $0xc2               // vfmadd132sd	%xmm2, %xmm6, %xmm0
+	VFMADD213SD CPI0_43<>(SB), X2, X0                 // vfmadd213sd	.LCPI0_43(%rip), %xmm2, %xmm0
+	VFMADD213SD CPI0_45<>(SB), X2, X0                 // vfmadd213sd	.LCPI0_45(%rip), %xmm2, %xmm0
+	VFMADD213SD CPI0_47<>(SB), X2, X0                 // vfmadd213sd	.LCPI0_47(%rip), %xmm2, %xmm0
+	VFMADD213SD CPI0_49<>(SB), X2, X0                 // vfmadd213sd	.LCPI0_49(%rip), %xmm2, %xmm0
+	VFMADD213SD CPI0_51<>(SB), X2, X0                 // vfmadd213sd	.LCPI0_51(%rip), %xmm2, %xmm0
+	VFMADD213SD CPI0_53<>(SB), X2, X0                 // vfmadd213sd	.LCPI0_53(%rip), %xmm2, %xmm0
+	VFMADD213SD CPI0_55<>(SB), X2, X0                 // vfmadd213sd	.LCPI0_55(%rip), %xmm2, %xmm0
+	VFMADD213SD CPI0_57<>(SB), X2, X0                 // vfmadd213sd	.LCPI0_57(%rip), %xmm2, %xmm0
+	LONG        $0x9999e2c4; BYTE $0xc2               // vfmadd132sd	%xmm2, %xmm12, %xmm0
+	LONG        $0x9999e2c4; BYTE $0xc2               // vfmadd132sd	%xmm2, %xmm12, %xmm0
+	LONG        $0xc359fbc5                           // vmulsd	%xmm3, %xmm0, %xmm0
+	LONG        $0xc05afbc5                           // vcvtsd2ss	%xmm0, %xmm0, %xmm0
+
+BB0_64:
+	LONG $0x0411fac5; BYTE $0x90 // vmovss	%xmm0, (%rax,%rdx,4)
+	LONG $0x01c28348             // addq	$1, %rdx
+	LONG $0xe858d2c5             // vaddss	%xmm0, %xmm5, %xmm5
+	WORD $0x3948; BYTE $0xd1     // cmpq	%rdx, %rcx
+	JG   BB0_63
+
+BB0_58:
+	VMOVSS CPI0_23<>(SB), X6               // vmovss	.LCPI0_23(%rip), %xmm6
+	QUAD   $0x000000b024bc8348; BYTE $0x0f // cmpq	$15, 176(%rsp)
+	LONG   $0xed5ecac5                     // vdivss	%xmm5, %xmm6, %xmm5
+	LONG   $0x487df262; WORD $0xd518       // vbroadcastss	%xmm5, %zmm2
+	JLE    BB0_155
+
+BB0_56:
+	LONG $0x24548b48; BYTE $0x60 // movq	96(%rsp), %rdx
+	LONG $0xf0e28348             // andq	$-16, %rdx
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x974c8d49; BYTE $0x40 // leaq	64(%r15,%rdx,4), %rcx
+	WORD $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+
+BB0_66:
+	LONG $0x486cf162; WORD $0x0259             // vmulps	(%rdx), %zmm2, %zmm0
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x487cf162; WORD $0x4211; BYTE $0xff // vmovups	%zmm0, -64(%rdx)
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JNE  BB0_66
+	LONG $0x24548b48; BYTE $0x70               // movq	112(%rsp), %rdx
+
+BB0_65:
+	QUAD $0x000000b024943948       // cmpq	%rdx, 176(%rsp)
+	JLE  BB0_71
+	QUAD $0x000000b0248c8b48       // movq	176(%rsp), %rcx
+	WORD $0x8948; BYTE $0xd6       // movq	%rdx, %rsi
+	WORD $0x2948; BYTE $0xd1       // subq	%rdx, %rcx
+	LONG $0xff798d48               // leaq	-1(%rcx), %rdi
+	LONG $0x0eff8348               // cmpq	$14, %rdi
+	JBE  BB0_88
+	LONG $0x0a3c8d4a               // leaq	(%rdx,%r9), %rdi
+	LONG $0xbf3c8d49               // leaq	(%r15,%rdi,4), %rdi
+	LONG $0x486cf162; WORD $0x1759 // vmulps	(%rdi), %zmm2, %zmm2
+	LONG $0x487cf162; WORD $0x1711 // vmovups	%zmm2, (%rdi)
+	WORD $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	LONG $0xf0e78348               // andq	$-16, %rdi
+	WORD $0x0148; BYTE $0xfa       // addq	%rdi, %rdx
+	WORD $0xc1f6; BYTE $0x0f       // testb	$15, %cl
+	JE   BB0_71
+
+BB0_57:
+	WORD $0x2948; BYTE $0xf9     // subq	%rdi, %rcx
+	LONG $0xff418d4c             // leaq	-1(%rcx), %r8
+	LONG $0x06f88349             // cmpq	$6, %r8
+	JBE  BB0_72
+	WORD $0x014c; BYTE $0xce     // addq	%r9, %rsi
+	LONG $0x187de2c4; BYTE $0xc5 // vbroadcastss	%xmm5, %ymm0
+	WORD $0x0148; BYTE $0xfe     // addq	%rdi, %rsi
+	LONG $0xb7348d49             // leaq	(%r15,%rsi,4), %rsi
+	LONG $0x0659fcc5             // vmulps	(%rsi), %ymm0, %ymm0
+	LONG $0x0611fcc5             // vmovups	%ymm0, (%rsi)
+	WORD $0x8948; BYTE $0xce     // movq	%rcx, %rsi
+	LONG $0xf8e68348             // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	WORD $0xe183; BYTE $0x07     // andl	$7, %ecx
+	JE   BB0_71
+
+BB0_72:
+	LONG $0x110c8d49         // leaq	(%r9,%rdx), %rcx
+	QUAD $0x000000b0249c8b48 // movq	176(%rsp), %rbx
+	LONG $0x8f0c8d49         // leaq	(%r15,%rcx,4), %rcx
+	LONG $0x0159d2c5         // vmulss	(%rcx), %xmm5, %xmm0
+	LONG $0x0111fac5         // vmovss	%xmm0, (%rcx)
+	LONG $0x014a8d48         // leaq	1(%rdx), %rcx
+	WORD $0x3948; BYTE $0xcb // cmpq	%rcx, %rbx
+	JLE  BB0_71
+	WORD $0x014c; BYTE $0xc9 // addq	%r9, %rcx
+	LONG $0x8f0c8d49         // leaq	(%r15,%rcx,4), %rcx
+	LONG $0x0159d2c5         // vmulss	(%rcx), %xmm5, %xmm0
+	LONG $0x0111fac5         // vmovss	%xmm0, (%rcx)
+	LONG $0x024a8d48         // leaq	2(%rdx), %rcx
+	WORD $0x3948; BYTE $0xcb // cmpq	%rcx, %rbx
+	JLE  BB0_71
+	WORD $0x014c; BYTE $0xc9 // addq	%r9, %rcx
+	LONG $0x8f0c8d49         // leaq	(%r15,%rcx,4), %rcx
+	LONG $0x0159d2c5         // vmulss	(%rcx), %xmm5, %xmm0
+	LONG $0x0111fac5         // vmovss	%xmm0, (%rcx)
+	LONG $0x034a8d48         // leaq	3(%rdx), %rcx
+	WORD $0x3948; BYTE $0xcb // cmpq	%rcx, %rbx
+	JLE  BB0_71
+	WORD $0x014c; BYTE $0xc9 // addq	%r9, %rcx
+	LONG $0x8f0c8d49         // leaq	(%r15,%rcx,4), %rcx
+	LONG $0x0159d2c5         // vmulss	(%rcx), %xmm5, %xmm0
+	LONG $0x0111fac5         // vmovss	%xmm0, (%rcx)
+	LONG $0x044a8d48         // leaq	4(%rdx), %rcx
+	WORD $0x3948; BYTE $0xcb // cmpq	%rcx, %rbx
+	JLE  BB0_71
+	WORD $0x014c; BYTE $0xc9 // addq	%r9, %rcx
+	LONG $0x8f0c8d49         // leaq	(%r15,%rcx,4), %rcx
+	LONG $0x0159d2c5         // vmulss	(%rcx), %xmm5, %xmm0
+	LONG $0x0111fac5         // vmovss	%xmm0, (%rcx)
+	LONG $0x054a8d48         // leaq	5(%rdx), %rcx
+	WORD $0x3948; BYTE $0xcb // cmpq	%rcx, %rbx
+	JLE  BB0_71
+	WORD $0x014c; BYTE $0xc9 // addq	%r9, %rcx
+	LONG $0x06c28348         // addq	$6, %rdx
+	LONG $0x8f0c8d49         // leaq	(%r15,%rcx,4), %rcx
+	LONG $0x0159d2c5         // vmulss	(%rcx), %xmm5, %xmm0
+	LONG $0x0111fac5         // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd3 // cmpq	%rdx, %rbx
+	JLE  BB0_71
+	WORD $0x014c; BYTE $0xca // addq	%r9, %rdx
+	LONG $0x97148d49         // leaq	(%r15,%rdx,4), %rdx
+	LONG $0x2a59d2c5         // vmulss	(%rdx), %xmm5, %xmm5
+	LONG $0x2a11fac5         // vmovss	%xmm5, (%rdx)
+
+BB0_71:
+	QUAD $0x000000b024bc8b48             // movq	176(%rsp), %rdi
+	QUAD $0x0000009824b48b48             // movq	152(%rsp), %rsi
+	QUAD $0x0000008024848348; BYTE $0x01 // addq	$1, 128(%rsp)
+	QUAD $0x00000080249c8b48             // movq	128(%rsp), %rbx
+	WORD $0x0149; BYTE $0xf9             // addq	%rdi, %r9
+	LONG $0x247c8b48; BYTE $0x38         // movq	56(%rsp), %rdi
+	WORD $0x0149; BYTE $0xf6             // addq	%rsi, %r14
+	LONG $0x247c0148; BYTE $0x68         // addq	%rdi, 104(%rsp)
+	QUAD $0x000000f024ac014c             // addq	%r13, 240(%rsp)
+	WORD $0x0148; BYTE $0xf8             // addq	%rdi, %rax
+	LONG $0x245c3948; BYTE $0x40         // cmpq	%rbx, 64(%rsp)
+	JG   BB0_68
+	WORD $0xf8c5; BYTE $0x77             // vzeroupper
+
+BB0_150:
+	LONG $0xd0a58d48; WORD $0xfffe; BYTE $0xff // leaq	-304(%rbp), %rsp
+	RET
+
+BB0_76:
+	LONG $0xed57d1c5               // vxorpd	%xmm5, %xmm5, %xmm5
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x48fdf162; WORD $0xdd28 // vmovapd	%zmm5, %zmm3
+	LONG $0x48fdf162; WORD $0xd528 // vmovapd	%zmm5, %zmm2
+	LONG $0x48fdf162; WORD $0xf528 // vmovapd	%zmm5, %zmm6
+	JMP  BB0_5
+
+BB0_77:
+	WORD $0x3145; BYTE $0xff // xorl	%r15d, %r15d
+	JMP  BB0_8
+
+BB0_154:
+	QUAD $0x000000b024bc8348; BYTE $0x0f // cmpq	$15, 176(%rsp)
+	JLE  BB0_35
+
+BB0_33:
+	LONG $0x245c8b48; BYTE $0x70 // movq	112(%rsp), %rbx
+	LONG $0x24748b48; BYTE $0x78 // movq	120(%rsp), %rsi
+	QUAD $0x000000008d148d4a     // leaq	0(,%r9,4), %rdx
+	LONG $0x0b0c8d4a             // leaq	(%rbx,%r9), %rcx
+	LONG $0x02e1c148             // salq	$2, %rcx
+
+BB0_36:
+	LONG $0x487cf162; WORD $0x3410; BYTE $0x16 // vmovups	(%rsi,%rdx), %zmm6
+	LONG $0x484cd162; WORD $0x0458; BYTE $0x17 // vaddps	(%r15,%rdx), %zmm6, %zmm0
+	LONG $0x487cd162; WORD $0x0411; BYTE $0x17 // vmovups	%zmm0, (%r15,%rdx)
+	LONG $0x40c28348                           // addq	$64, %rdx
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JNE  BB0_36
+	LONG $0x245c8b48; BYTE $0x70               // movq	112(%rsp), %rbx
+	QUAD $0x000000b0249c3948                   // cmpq	%rbx, 176(%rsp)
+	JLE  BB0_146
+	WORD $0x8949; BYTE $0xda                   // movq	%rbx, %r10
+
+BB0_38:
+	QUAD $0x000000b0249c8b48     // movq	176(%rsp), %rbx
+	LONG $0x0a0c8d4b             // leaq	(%r10,%r9), %rcx
+	WORD $0x8948; BYTE $0xdf     // movq	%rbx, %rdi
+	WORD $0x294c; BYTE $0xd7     // subq	%r10, %rdi
+	LONG $0xff478d4c             // leaq	-1(%rdi), %r8
+	WORD $0x3949; BYTE $0xda     // cmpq	%rbx, %r10
+	JGE  BB0_40
+	LONG $0x06f88349             // cmpq	$6, %r8
+	JBE  BB0_40
+	QUAD $0x000000008d1c8d4c     // leaq	0(,%rcx,4), %r11
+	LONG $0x245c8b48; BYTE $0x78 // movq	120(%rsp), %rbx
+	LONG $0x1f348d4b             // leaq	(%r15,%r11), %rsi
+	LONG $0x1b5c8d4a; BYTE $0x04 // leaq	4(%rbx,%r11), %rbx
+	WORD $0x8948; BYTE $0xf2     // movq	%rsi, %rdx
+	WORD $0x2948; BYTE $0xda     // subq	%rbx, %rdx
+	LONG $0x38fa8348             // cmpq	$56, %rdx
+	JA   BB0_156
+
+BB0_40:
+	LONG $0x245c8b48; BYTE $0x78 // movq	120(%rsp), %rbx
+	LONG $0x8f148d49             // leaq	(%r15,%rcx,4), %rdx
+	QUAD $0x000000b024bc8b48     // movq	176(%rsp), %rdi
+	LONG $0x0210fac5             // vmovss	(%rdx), %xmm0
+	LONG $0x0458fac5; BYTE $0x8b // vaddss	(%rbx,%rcx,4), %xmm0, %xmm0
+	LONG $0x0211fac5             // vmovss	%xmm0, (%rdx)
+	LONG $0x01528d49             // leaq	1(%r10), %rdx
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x02528d49             // leaq	2(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x03528d49             // leaq	3(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x04528d49             // leaq	4(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xfa     // cmpq	%rdi, %rdx
+	JGE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x05528d49             // leaq	5(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xfa     // cmpq	%rdi, %rdx
+	JGE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x06528d49             // leaq	6(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xfa     // cmpq	%rdi, %rdx
+	JGE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x07528d49             // leaq	7(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xfa     // cmpq	%rdi, %rdx
+	JGE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x08528d49             // leaq	8(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x09528d49             // leaq	9(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x0a528d49             // leaq	10(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xfa     // cmpq	%rdi, %rdx
+	JGE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x0b528d49             // leaq	11(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x0c528d49             // leaq	12(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x0d528d49             // leaq	13(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x0e528d49             // leaq	14(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x0f528d49             // leaq	15(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xfa     // cmpq	%rdi, %rdx
+	JGE  BB0_146
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+
+BB0_146:
+	LONG $0x00107ac5 // vmovss	(%rax), %xmm8
+	JMP  BB0_18
+
+BB0_80:
+	LONG $0xc057f9c5 // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0xc931     // xorl	%ecx, %ecx
+	JMP  BB0_22
+
+BB0_81:
+	WORD $0x3145; BYTE $0xff // xorl	%r15d, %r15d
+	JMP  BB0_25
+
+BB0_153:
+	LONG $0x247c8348; WORD $0x0078       // cmpq	$0, 120(%rsp)
+	JE   BB0_146
+	QUAD $0x000000b024bc8348; BYTE $0x0f // cmpq	$15, 176(%rsp)
+	JG   BB0_33
+
+BB0_34:
+	WORD $0x3145; BYTE $0xd2 // xorl	%r10d, %r10d
+	JMP  BB0_38
+
+BB0_156:
+	QUAD $0x000000b024948b48                   // movq	176(%rsp), %rdx
+	WORD $0x3949; BYTE $0xd2                   // cmpq	%rdx, %r10
+	LONG $0x000001ba; BYTE $0x00               // movl	$1, %edx
+	LONG $0xd74c0f48                           // cmovl	%rdi, %rdx
+	LONG $0x0ef88349                           // cmpq	$14, %r8
+	JBE  BB0_82
+	LONG $0x245c8b48; BYTE $0x78               // movq	120(%rsp), %rbx
+	LONG $0x487cb162; WORD $0x3410; BYTE $0x1b // vmovups	(%rbx,%r11), %zmm6
+	LONG $0x484cf162; WORD $0x0658             // vaddps	(%rsi), %zmm6, %zmm0
+	LONG $0x487cf162; WORD $0x0611             // vmovups	%zmm0, (%rsi)
+	WORD $0x8948; BYTE $0xd6                   // movq	%rdx, %rsi
+	LONG $0xf0e68348                           // andq	$-16, %rsi
+	WORD $0x0149; BYTE $0xf2                   // addq	%rsi, %r10
+	WORD $0xc2f6; BYTE $0x0f                   // testb	$15, %dl
+	JE   BB0_21
+
+BB0_41:
+	WORD $0x2948; BYTE $0xf2     // subq	%rsi, %rdx
+	LONG $0xff7a8d48             // leaq	-1(%rdx), %rdi
+	LONG $0x06ff8348             // cmpq	$6, %rdi
+	JBE  BB0_43
+	WORD $0x0148; BYTE $0xce     // addq	%rcx, %rsi
+	LONG $0x245c8b48; BYTE $0x78 // movq	120(%rsp), %rbx
+	LONG $0xb70c8d49             // leaq	(%r15,%rsi,4), %rcx
+	LONG $0x3410fcc5; BYTE $0xb3 // vmovups	(%rbx,%rsi,4), %ymm6
+	LONG $0x0158ccc5             // vaddps	(%rcx), %ymm6, %ymm0
+	LONG $0x0111fcc5             // vmovups	%ymm0, (%rcx)
+	WORD $0x8948; BYTE $0xd1     // movq	%rdx, %rcx
+	LONG $0xf8e18348             // andq	$-8, %rcx
+	WORD $0x0149; BYTE $0xca     // addq	%rcx, %r10
+	WORD $0xe283; BYTE $0x07     // andl	$7, %edx
+	JE   BB0_21
+
+BB0_43:
+	LONG $0x110c8d4b             // leaq	(%r9,%r10), %rcx
+	LONG $0x245c8b48; BYTE $0x78 // movq	120(%rsp), %rbx
+	QUAD $0x000000b024bc8b48     // movq	176(%rsp), %rdi
+	LONG $0x8f148d49             // leaq	(%r15,%rcx,4), %rdx
+	LONG $0x0210fac5             // vmovss	(%rdx), %xmm0
+	LONG $0x0458fac5; BYTE $0x8b // vaddss	(%rbx,%rcx,4), %xmm0, %xmm0
+	LONG $0x0211fac5             // vmovss	%xmm0, (%rdx)
+	LONG $0x01528d49             // leaq	1(%r10), %rdx
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x02528d49             // leaq	2(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x03528d49             // leaq	3(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x04528d49             // leaq	4(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x05528d49             // leaq	5(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x06528d49             // leaq	6(%r10), %rdx
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	WORD $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE  BB0_21
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0x970c8d49             // leaq	(%r15,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x93 // vaddss	(%rbx,%rdx,4), %xmm0, %xmm0
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	JMP  BB0_21
+
+BB0_4:
+	WORD $0x3145; BYTE $0xd2             // xorl	%r10d, %r10d
+	QUAD $0x000000b024bc8348; BYTE $0x00 // cmpq	$0, 176(%rsp)
+	JG   BB0_16
+	LONG $0x00107ac5                     // vmovss	(%rax), %xmm8
+
+BB0_84:
+	LONG $0xdb57e1c5 // vxorpd	%xmm3, %xmm3, %xmm3
+	WORD $0xd231     // xorl	%edx, %edx
+	JMP  BB0_50
+
+BB0_52:
+	VMOVSS CPI0_23<>(SB), X6               // vmovss	.LCPI0_23(%rip), %xmm6
+	QUAD   $0x000000b024bc8348; BYTE $0x0f // cmpq	$15, 176(%rsp)
+	LONG   $0xed5ecac5                     // vdivss	%xmm5, %xmm6, %xmm5
+	LONG   $0x487df262; WORD $0xd518       // vbroadcastss	%xmm5, %zmm2
+	JG     BB0_56
+	WORD   $0xd231                         // xorl	%edx, %edx
+	JMP    BB0_65
+
+BB0_155:
+	QUAD $0x000000b0248c8b48 // movq	176(%rsp), %rcx
+	WORD $0xf631             // xorl	%esi, %esi
+	WORD $0xff31             // xorl	%edi, %edi
+	WORD $0xd231             // xorl	%edx, %edx
+	JMP  BB0_57
+
+BB0_85:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_53
+
+BB0_35:
+	QUAD $0x000000b024bc8348; BYTE $0x00 // cmpq	$0, 176(%rsp)
+	LONG $0x00107ac5                     // vmovss	(%rax), %xmm8
+	JG   BB0_34
+	JMP  BB0_84
+
+BB0_88:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_57
+
+BB0_82:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_41
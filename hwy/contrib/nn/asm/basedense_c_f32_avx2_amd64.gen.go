@@ -0,0 +1,14 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basedense_c_f32_avx2_amd64.c
+
+package asm
+
+import "unsafe"
+
+//go:noescape
+func dense_c_f32_avx2(x, weight, bias, output, pbatchSize, pinFeatures, poutFeatures, plen_x, plen_weight, plen_bias, plen_output unsafe.Pointer)
@@ -0,0 +1,613 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basedense_c_f32_avx2_amd64.c
+
+TEXT ·dense_c_f32_avx2(SB), $304-88
+	MOVQ x+0(FP), DI
+	MOVQ weight+8(FP), SI
+	MOVQ bias+16(FP), DX
+	MOVQ output+24(FP), CX
+	MOVQ pbatchSize+32(FP), R8
+	MOVQ pinFeatures+40(FP), R9
+	MOVQ poutFeatures+48(FP), R11
+	MOVQ R11, 256(SP)
+	MOVQ plen_x+56(FP), R11
+	MOVQ R11, 264(SP)
+	MOVQ plen_weight+64(FP), R11
+	MOVQ R11, 272(SP)
+	MOVQ plen_bias+72(FP), R11
+	MOVQ R11, 280(SP)
+	MOVQ plen_output+80(FP), R11
+	MOVQ R11, 288(SP)
+	QUAD $0x000000f024ac8d48                   // leaq	240(%rsp), %rbp
+	WORD $0x8949; BYTE $0xfe                   // movq	%rdi, %r14
+	WORD $0x8949; BYTE $0xcc                   // movq	%rcx, %r12
+	LONG $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348                           // andq	$-32, %rsp
+	LONG $0x10458b48                           // movq	16(%rbp), %rax
+	WORD $0x8b49; BYTE $0x18                   // movq	(%r8), %rbx
+	QUAD $0x000000b024b48948                   // movq	%rsi, 176(%rsp)
+	WORD $0x8b4d; BYTE $0x39                   // movq	(%r9), %r15
+	WORD $0x8b48; BYTE $0x00                   // movq	(%rax), %rax
+	LONG $0x24548948; BYTE $0x70               // movq	%rdx, 112(%rsp)
+	LONG $0x245c8948; BYTE $0x30               // movq	%rbx, 48(%rsp)
+	LONG $0x24448948; BYTE $0x78               // movq	%rax, 120(%rsp)
+	LONG $0x03fb8348                           // cmpq	$3, %rbx
+	JLE  BB0_35
+	WORD $0x8949; BYTE $0xc0                   // movq	%rax, %r8
+	LONG $0x3f1c8d4b                           // leaq	(%r15,%r15), %rbx
+	WORD $0x894c; BYTE $0xfe                   // movq	%r15, %rsi
+	LONG $0x244c8948; BYTE $0x68               // movq	%rcx, 104(%rsp)
+	QUAD $0x0000000085148d4c                   // leaq	0(,%rax,4), %r10
+	LONG $0xc1048d48                           // leaq	(%rcx,%rax,8), %rax
+	LONG $0x04e0c149                           // salq	$4, %r8
+	LONG $0x04e6c148                           // salq	$4, %rsi
+	LONG $0x24448948; BYTE $0x60               // movq	%rax, 96(%rsp)
+	QUAD $0x00000000bd048d4a                   // leaq	0(,%r15,4), %rax
+	LONG $0x070c8d4c                           // leaq	(%rdi,%rax), %r9
+	QUAD $0x000000d0249c8948                   // movq	%rbx, 208(%rsp)
+	WORD $0x014c; BYTE $0xfb                   // addq	%r15, %rbx
+	LONG $0x012c8d4d                           // leaq	(%r9,%rax), %r13
+	LONG $0x24448948; BYTE $0x58               // movq	%rax, 88(%rsp)
+	QUAD $0x000000c8249c8948                   // movq	%rbx, 200(%rsp)
+	LONG $0x055c8d49; BYTE $0x00               // leaq	0(%r13,%rax), %rbx
+	LONG $0xf8478d49                           // leaq	-8(%r15), %rax
+	WORD $0x894d; BYTE $0xec                   // movq	%r13, %r12
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	QUAD $0x000000d824bc894c                   // movq	%r15, 216(%rsp)
+	WORD $0x8949; BYTE $0xfd                   // movq	%rdi, %r13
+	QUAD $0x00000008c5048d48                   // leaq	8(,%rax,8), %rax
+	LONG $0x2454894c; BYTE $0x18               // movq	%r10, 24(%rsp)
+	LONG $0x24448948; BYTE $0x40               // movq	%rax, 64(%rsp)
+	LONG $0x000003b8; BYTE $0x00               // movl	$3, %eax
+	QUAD $0x000000b82484c748; LONG $0x00000000 // movq	$0, 184(%rsp)
+	LONG $0x24448948; BYTE $0x38               // movq	%rax, 56(%rsp)
+	LONG $0x2444894c; BYTE $0x28               // movq	%r8, 40(%rsp)
+	LONG $0x24748948; BYTE $0x20               // movq	%rsi, 32(%rsp)
+	LONG $0x244c8948; BYTE $0x10               // movq	%rcx, 16(%rsp)
+
+BB0_4:
+	LONG $0x247c8348; WORD $0x0078             // cmpq	$0, 120(%rsp)
+	JLE  BB0_16
+	LONG $0x24448b48; BYTE $0x18               // movq	24(%rsp), %rax
+	LONG $0x24548b48; BYTE $0x68               // movq	104(%rsp), %rdx
+	WORD $0x894d; BYTE $0xca                   // movq	%r9, %r10
+	WORD $0x3145; BYTE $0xc0                   // xorl	%r8d, %r8d
+	QUAD $0x000000c02484c748; LONG $0x00000000 // movq	$0, 192(%rsp)
+	QUAD $0x000000b0248c8b48                   // movq	176(%rsp), %rcx
+	WORD $0x894d; BYTE $0xe9                   // movq	%r13, %r9
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x24548948; BYTE $0x48               // movq	%rdx, 72(%rsp)
+	LONG $0x24548b48; BYTE $0x60               // movq	96(%rsp), %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x24448948; BYTE $0x50               // movq	%rax, 80(%rsp)
+
+BB0_17:
+	LONG $0x07ff8349             // cmpq	$7, %r15
+	JLE  BB0_36
+	LONG $0xdb57e0c5             // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	LONG $0xe328fcc5             // vmovaps	%ymm3, %ymm4
+	LONG $0xcb28fcc5             // vmovaps	%ymm3, %ymm1
+	LONG $0xd328fcc5             // vmovaps	%ymm3, %ymm2
+
+BB0_6:
+	LONG $0x4410fcc5; WORD $0xe081             // vmovups	-32(%rcx,%rax,4), %ymm0
+	LONG $0xb87dc2c4; WORD $0x8154; BYTE $0xe0 // vfmadd231ps	-32(%r9,%rax,4), %ymm0, %ymm2
+	LONG $0xb87dc2c4; WORD $0x824c; BYTE $0xe0 // vfmadd231ps	-32(%r10,%rax,4), %ymm0, %ymm1
+	LONG $0xb87dc2c4; WORD $0x8464; BYTE $0xe0 // vfmadd231ps	-32(%r12,%rax,4), %ymm0, %ymm4
+	LONG $0xb87de2c4; WORD $0x835c; BYTE $0xe0 // vfmadd231ps	-32(%rbx,%rax,4), %ymm0, %ymm3
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_6
+	LONG $0x24548b48; BYTE $0x40               // movq	64(%rsp), %rdx
+
+BB0_5:
+	LONG $0x197de3c4; WORD $0x01d0 // vextractf128	$0x1, %ymm2, %xmm0
+	LONG $0xd258f8c5               // vaddps	%xmm2, %xmm0, %xmm2
+	LONG $0xc212e8c5               // vmovhlps	%xmm2, %xmm2, %xmm0
+	LONG $0xd058e8c5               // vaddps	%xmm0, %xmm2, %xmm2
+	LONG $0xc216fac5               // vmovshdup	%xmm2, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc958f8c5               // vaddps	%xmm1, %xmm0, %xmm1
+	LONG $0xc112f0c5               // vmovhlps	%xmm1, %xmm1, %xmm0
+	LONG $0xc858f0c5               // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc116fac5               // vmovshdup	%xmm1, %xmm0
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0x197de3c4; WORD $0x01e0 // vextractf128	$0x1, %ymm4, %xmm0
+	LONG $0xc458f8c5               // vaddps	%xmm4, %xmm0, %xmm0
+	LONG $0xe012f8c5               // vmovhlps	%xmm0, %xmm0, %xmm4
+	LONG $0xc458f8c5               // vaddps	%xmm4, %xmm0, %xmm0
+	LONG $0xe016fac5               // vmovshdup	%xmm0, %xmm4
+	LONG $0xc458fac5               // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01dc // vextractf128	$0x1, %ymm3, %xmm4
+	LONG $0xdc58e0c5               // vaddps	%xmm4, %xmm3, %xmm3
+	LONG $0xe312e0c5               // vmovhlps	%xmm3, %xmm3, %xmm4
+	LONG $0xe358d8c5               // vaddps	%xmm3, %xmm4, %xmm4
+	LONG $0xdc16fac5               // vmovshdup	%xmm4, %xmm3
+	LONG $0xe358dac5               // vaddss	%xmm3, %xmm4, %xmm4
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_7
+	WORD $0x894c; BYTE $0xff       // movq	%r15, %rdi
+	QUAD $0x000000a024948948       // movq	%rdx, 160(%rsp)
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	QUAD $0x000000a824bc8948       // movq	%rdi, 168(%rsp)
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_37
+	QUAD $0x000000b824848b48       // movq	184(%rsp), %rax
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	LONG $0x03efc148               // shrq	$3, %rdi
+	QUAD $0x00000088248c8948       // movq	%rcx, 136(%rsp)
+	QUAD $0x000000802484894c       // movq	%r8, 128(%rsp)
+	LONG $0x05e7c148               // salq	$5, %rdi
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x862c8d4d               // leaq	(%r14,%rax,4), %r13
+	QUAD $0x000000c024848b48       // movq	192(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x861c8d4c               // leaq	(%rsi,%rax,4), %r11
+	QUAD $0x000000d824848b48       // movq	216(%rsp), %rax
+	QUAD $0x000000d024b48b48       // movq	208(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x86048d49               // leaq	(%r14,%rax,4), %rax
+	QUAD $0x0000009024848948       // movq	%rax, 144(%rsp)
+	LONG $0x32048d48               // leaq	(%rdx,%rsi), %rax
+	QUAD $0x0000009024848b4c       // movq	144(%rsp), %r8
+	LONG $0x86348d49               // leaq	(%r14,%rax,4), %rsi
+	QUAD $0x000000c824848b48       // movq	200(%rsp), %rax
+	QUAD $0x0000009824b48948       // movq	%rsi, 152(%rsp)
+	QUAD $0x00000098248c8b48       // movq	152(%rsp), %rcx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x86348d49               // leaq	(%r14,%rax,4), %rsi
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_9:
+	LONG $0x107cc1c4; WORD $0x031c             // vmovups	(%r11,%rax), %ymm3
+	LONG $0x5964c1c4; WORD $0x056c; BYTE $0x00 // vmulps	0(%r13,%rax), %ymm3, %ymm5
+	LONG $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG $0xfdc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm7
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0xfa58c2c5                           // vaddss	%xmm2, %xmm7, %xmm7
+	LONG $0xd515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm2
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xd758eac5                           // vaddss	%xmm7, %xmm2, %xmm2
+	LONG $0xf258cac5                           // vaddss	%xmm2, %xmm6, %xmm6
+	LONG $0xd658d2c5                           // vaddss	%xmm6, %xmm5, %xmm2
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0xf258cac5                           // vaddss	%xmm2, %xmm6, %xmm6
+	LONG $0xd515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm2
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG $0x5964c1c4; WORD $0x002c             // vmulps	(%r8,%rax), %ymm3, %ymm5
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xfdc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm7
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0xf958c2c5                           // vaddss	%xmm1, %xmm7, %xmm7
+	LONG $0xcd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm1
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xcf58f2c5                           // vaddss	%xmm7, %xmm1, %xmm1
+	LONG $0xf158cac5                           // vaddss	%xmm1, %xmm6, %xmm6
+	LONG $0xce58d2c5                           // vaddss	%xmm6, %xmm5, %xmm1
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0xf158cac5                           // vaddss	%xmm1, %xmm6, %xmm6
+	LONG $0xcd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm1
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x2c59e4c5; BYTE $0x01               // vmulps	(%rcx,%rax), %ymm3, %ymm5
+	LONG $0x1c59e4c5; BYTE $0x06               // vmulps	(%rsi,%rax), %ymm3, %ymm3
+	LONG $0x20c08348                           // addq	$32, %rax
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xfdc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm7
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG $0xf858c2c5                           // vaddss	%xmm0, %xmm7, %xmm7
+	LONG $0xc515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm0
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0xf058cac5                           // vaddss	%xmm0, %xmm6, %xmm6
+	LONG $0xc658d2c5                           // vaddss	%xmm6, %xmm5, %xmm0
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0xf058cac5                           // vaddss	%xmm0, %xmm6, %xmm6
+	LONG $0xc515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm0
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xf3c6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm6
+	LONG $0xf458cac5                           // vaddss	%xmm4, %xmm6, %xmm6
+	LONG $0xe315e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm4
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xebc6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm5
+	LONG $0x197de3c4; WORD $0x01db             // vextractf128	$0x1, %ymm3, %xmm3
+	LONG $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG $0xe558e2c5                           // vaddss	%xmm5, %xmm3, %xmm4
+	LONG $0xebc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm5
+	LONG $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG $0xe315e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm4
+	LONG $0xdbc6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	WORD $0x3948; BYTE $0xc7                   // cmpq	%rax, %rdi
+	JNE  BB0_9
+	QUAD $0x000000a824b48b48                   // movq	168(%rsp), %rsi
+	QUAD $0x00000088248c8b48                   // movq	136(%rsp), %rcx
+	QUAD $0x0000008024848b4c                   // movq	128(%rsp), %r8
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x07                   // andl	$7, %esi
+	JE   BB0_7
+
+BB0_8:
+	QUAD $0x000000a824b48b48                   // movq	168(%rsp), %rsi
+	WORD $0x2948; BYTE $0xc6                   // subq	%rax, %rsi
+	LONG $0xff7e8d48                           // leaq	-1(%rsi), %rdi
+	LONG $0x02ff8348                           // cmpq	$2, %rdi
+	JBE  BB0_12
+	QUAD $0x000000c024bc8b48                   // movq	192(%rsp), %rdi
+	QUAD $0x000000a0249c8b4c                   // movq	160(%rsp), %r11
+	QUAD $0x000000b024ac8b4c                   // movq	176(%rsp), %r13
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	WORD $0x014c; BYTE $0xd8                   // addq	%r11, %rax
+	WORD $0x014c; BYTE $0xdf                   // addq	%r11, %rdi
+	LONG $0x1078c1c4; WORD $0xbd5c; BYTE $0x00 // vmovups	0(%r13,%rdi,4), %xmm3
+	QUAD $0x000000b824bc8b48                   // movq	184(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	LONG $0x5960c1c4; WORD $0xbe2c             // vmulps	(%r14,%rdi,4), %xmm3, %xmm5
+	QUAD $0x000000d824bc8b48                   // movq	216(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	LONG $0xd258d2c5                           // vaddss	%xmm2, %xmm5, %xmm2
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0xf258cac5                           // vaddss	%xmm2, %xmm6, %xmm6
+	LONG $0xd515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm2
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG $0x5960c1c4; WORD $0xbe2c             // vmulps	(%r14,%rdi,4), %xmm3, %xmm5
+	QUAD $0x000000d024bc8b48                   // movq	208(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	LONG $0xc958d2c5                           // vaddss	%xmm1, %xmm5, %xmm1
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0xf158cac5                           // vaddss	%xmm1, %xmm6, %xmm6
+	LONG $0xcd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm1
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x5960c1c4; WORD $0xbe2c             // vmulps	(%r14,%rdi,4), %xmm3, %xmm5
+	QUAD $0x000000c824bc8b48                   // movq	200(%rsp), %rdi
+	WORD $0x0148; BYTE $0xf8                   // addq	%rdi, %rax
+	LONG $0x5960c1c4; WORD $0x861c             // vmulps	(%r14,%rax,4), %xmm3, %xmm3
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xfce08348                           // andq	$-4, %rax
+	LONG $0xc058d2c5                           // vaddss	%xmm0, %xmm5, %xmm0
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x03                   // andl	$3, %esi
+	LONG $0xf058cac5                           // vaddss	%xmm0, %xmm6, %xmm6
+	LONG $0xc515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm0
+	LONG $0xe458e2c5                           // vaddss	%xmm4, %xmm3, %xmm4
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xebc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm5
+	LONG $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG $0xe315e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm4
+	LONG $0xdbc6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	JE   BB0_7
+
+BB0_12:
+	QUAD $0x000000c024bc8b48       // movq	192(%rsp), %rdi
+	QUAD $0x000000b0249c8b4c       // movq	176(%rsp), %r11
+	QUAD $0x000000b824ac8b4c       // movq	184(%rsp), %r13
+	QUAD $0x000000d024b48b48       // movq	208(%rsp), %rsi
+	LONG $0x17048d48               // leaq	(%rdi,%rdx), %rax
+	LONG $0x107ac1c4; WORD $0x831c // vmovss	(%r11,%rax,4), %xmm3
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	LONG $0xb961c2c4; WORD $0x8614 // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm2
+	QUAD $0x000000d824848b48       // movq	216(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb961c2c4; WORD $0x860c // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm1
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	LONG $0xb961c2c4; WORD $0x8604 // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm0
+	QUAD $0x000000c824848b48       // movq	200(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb961c2c4; WORD $0x8624 // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm4
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_7
+	LONG $0x07348d48               // leaq	(%rdi,%rax), %rsi
+	LONG $0x02c28348               // addq	$2, %rdx
+	LONG $0x107ac1c4; WORD $0xb31c // vmovss	(%r11,%rsi,4), %xmm3
+	LONG $0x05748d49; BYTE $0x00   // leaq	0(%r13,%rax), %rsi
+	LONG $0xb961c2c4; WORD $0xb614 // vfmadd231ss	(%r14,%rsi,4), %xmm3, %xmm2
+	QUAD $0x000000d824b48b48       // movq	216(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb961c2c4; WORD $0xb60c // vfmadd231ss	(%r14,%rsi,4), %xmm3, %xmm1
+	QUAD $0x000000d024b48b48       // movq	208(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb961c2c4; WORD $0xb604 // vfmadd231ss	(%r14,%rsi,4), %xmm3, %xmm0
+	QUAD $0x000000c824b48b48       // movq	200(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0xb961c2c4; WORD $0x8624 // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm4
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_7
+	LONG $0x17048d48               // leaq	(%rdi,%rdx), %rax
+	QUAD $0x000000d824b48b48       // movq	216(%rsp), %rsi
+	LONG $0x107ac1c4; WORD $0x831c // vmovss	(%r11,%rax,4), %xmm3
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	LONG $0xb961c2c4; WORD $0x8614 // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm2
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	QUAD $0x000000d024b48b48       // movq	208(%rsp), %rsi
+	LONG $0xb961c2c4; WORD $0x860c // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm1
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	QUAD $0x000000c824b48b48       // movq	200(%rsp), %rsi
+	LONG $0xb961c2c4; WORD $0x8604 // vfmadd231ss	(%r14,%rax,4), %xmm3, %xmm0
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+	LONG $0xb961c2c4; WORD $0x9624 // vfmadd231ss	(%r14,%rdx,4), %xmm3, %xmm4
+
+BB0_7:
+	LONG $0x24448b48; BYTE $0x70   // movq	112(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_14
+	LONG $0x107aa1c4; WORD $0x801c // vmovss	(%rax,%r8,4), %xmm3
+	LONG $0x24448b48; BYTE $0x68   // movq	104(%rsp), %rax
+	LONG $0xd258e2c5               // vaddss	%xmm2, %xmm3, %xmm2
+	LONG $0xc958e2c5               // vaddss	%xmm1, %xmm3, %xmm1
+	LONG $0xc058e2c5               // vaddss	%xmm0, %xmm3, %xmm0
+	LONG $0xdc58e2c5               // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0x117aa1c4; WORD $0x8014 // vmovss	%xmm2, (%rax,%r8,4)
+	LONG $0x24448b48; BYTE $0x48   // movq	72(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x800c // vmovss	%xmm1, (%rax,%r8,4)
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x8004 // vmovss	%xmm0, (%rax,%r8,4)
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x801c // vmovss	%xmm3, (%rax,%r8,4)
+
+BB0_61:
+	LONG $0x24448b48; BYTE $0x58 // movq	88(%rsp), %rax
+	QUAD $0x000000c024bc014c     // addq	%r15, 192(%rsp)
+	LONG $0x01c08349             // addq	$1, %r8
+	WORD $0x0148; BYTE $0xc1     // addq	%rax, %rcx
+	LONG $0x2444394c; BYTE $0x78 // cmpq	%r8, 120(%rsp)
+	JNE  BB0_17
+	WORD $0x894d; BYTE $0xcd     // movq	%r9, %r13
+	WORD $0x894d; BYTE $0xd1     // movq	%r10, %r9
+
+BB0_16:
+	LONG $0x244c8b48; BYTE $0x28   // movq	40(%rsp), %rcx
+	LONG $0x244c0148; BYTE $0x68   // addq	%rcx, 104(%rsp)
+	LONG $0x244c0148; BYTE $0x60   // addq	%rcx, 96(%rsp)
+	LONG $0x244c8b48; BYTE $0x20   // movq	32(%rsp), %rcx
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	LONG $0x24448348; WORD $0x0438 // addq	$4, 56(%rsp)
+	QUAD $0x000000b824840148       // addq	%rax, 184(%rsp)
+	LONG $0x24548b48; BYTE $0x38   // movq	56(%rsp), %rdx
+	WORD $0x0149; BYTE $0xcd       // addq	%rcx, %r13
+	WORD $0x0149; BYTE $0xc9       // addq	%rcx, %r9
+	QUAD $0x000000d824840148       // addq	%rax, 216(%rsp)
+	WORD $0x0149; BYTE $0xcc       // addq	%rcx, %r12
+	WORD $0x0148; BYTE $0xcb       // addq	%rcx, %rbx
+	QUAD $0x000000d024840148       // addq	%rax, 208(%rsp)
+	QUAD $0x000000c824840148       // addq	%rax, 200(%rsp)
+	LONG $0x24543948; BYTE $0x30   // cmpq	%rdx, 48(%rsp)
+	JG   BB0_4
+	LONG $0x24448b48; BYTE $0x30   // movq	48(%rsp), %rax
+	LONG $0x24648b4c; BYTE $0x10   // movq	16(%rsp), %r12
+	LONG $0x04e88348               // subq	$4, %rax
+	LONG $0x02e8c148               // shrq	$2, %rax
+	QUAD $0x0000000485048d48       // leaq	4(,%rax,4), %rax
+
+BB0_2:
+	LONG $0x24443948; BYTE $0x30 // cmpq	%rax, 48(%rsp)
+	JLE  BB0_58
+	LONG $0x245c8b48; BYTE $0x78 // movq	120(%rsp), %rbx
+	WORD $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE  BB0_58
+	LONG $0xd8af0f48             // imulq	%rax, %rbx
+	LONG $0xf8578d49             // leaq	-8(%r15), %rdx
+	WORD $0x894d; BYTE $0xfd     // movq	%r15, %r13
+	QUAD $0x000000b824848948     // movq	%rax, 184(%rsp)
+	LONG $0x03eac148             // shrq	$3, %rdx
+	LONG $0xe8af0f4c             // imulq	%rax, %r13
+	QUAD $0x000000a024a4894c     // movq	%r12, 160(%rsp)
+	QUAD $0x000000b024a48b4c     // movq	176(%rsp), %r12
+	WORD $0x8948; BYTE $0xde     // movq	%rbx, %rsi
+	QUAD $0x00000000bd1c8d4a     // leaq	0(,%r15,4), %rbx
+	QUAD $0x000000d0249c8948     // movq	%rbx, 208(%rsp)
+	QUAD $0x00000008d51c8d48     // leaq	8(,%rdx,8), %rbx
+	LONG $0xae3c8d4b             // leaq	(%r14,%r13,4), %rdi
+	QUAD $0x000000c0249c8948     // movq	%rbx, 192(%rsp)
+	QUAD $0x000000a824b48948     // movq	%rsi, 168(%rsp)
+
+BB0_34:
+	QUAD $0x000000a8249c8b48 // movq	168(%rsp), %rbx
+	QUAD $0x000000a024848b48 // movq	160(%rsp), %rax
+	WORD $0x894c; BYTE $0xe1 // movq	%r12, %rcx
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	LONG $0x98048d48         // leaq	(%rax,%rbx,4), %rax
+	WORD $0xdb31             // xorl	%ebx, %ebx
+	QUAD $0x000000c824848948 // movq	%rax, 200(%rsp)
+
+BB0_20:
+	LONG $0x07ff8349             // cmpq	$7, %r15
+	JLE  BB0_38
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_23:
+	LONG $0x7c10fcc5; WORD $0xe087             // vmovups	-32(%rdi,%rax,4), %ymm7
+	LONG $0xb845e2c4; WORD $0x814c; BYTE $0xe0 // vfmadd231ps	-32(%rcx,%rax,4), %ymm7, %ymm1
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_23
+	QUAD $0x000000c024948b48                   // movq	192(%rsp), %rdx
+
+BB0_22:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_24
+	WORD $0x894c; BYTE $0xfe       // movq	%r15, %rsi
+	QUAD $0x000000d824948948       // movq	%rdx, 216(%rsp)
+	WORD $0x2948; BYTE $0xd6       // subq	%rdx, %rsi
+	LONG $0xff468d48               // leaq	-1(%rsi), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_39
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	LONG $0x861c8d4d               // leaq	(%r14,%rax,4), %r11
+	LONG $0x03e8c149               // shrq	$3, %r8
+	LONG $0x11048d49               // leaq	(%r9,%rdx), %rax
+	LONG $0x84148d4d               // leaq	(%r12,%rax,4), %r10
+	LONG $0x05e0c149               // salq	$5, %r8
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_26:
+	LONG $0x107cc1c4; WORD $0x023c // vmovups	(%r10,%rax), %ymm7
+	LONG $0x5944c1c4; WORD $0x0314 // vmulps	(%r11,%rax), %ymm7, %ymm2
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xcac6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xdac6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xc215e8c5               // vunpckhps	%xmm2, %xmm2, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd858e2c5               // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f2c5               // vaddss	%xmm3, %xmm1, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc0       // cmpq	%r8, %rax
+	JNE  BB0_26
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x07c6f640               // testb	$7, %sil
+	JE   BB0_24
+
+BB0_25:
+	WORD $0x2948; BYTE $0xc6       // subq	%rax, %rsi
+	LONG $0xff468d4c               // leaq	-1(%rsi), %r8
+	LONG $0x02f88349               // cmpq	$2, %r8
+	JBE  BB0_29
+	QUAD $0x000000d824948b4c       // movq	216(%rsp), %r10
+	LONG $0x01048d4d               // leaq	(%r9,%rax), %r8
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+	WORD $0x014d; BYTE $0xd0       // addq	%r10, %r8
+	LONG $0x1078c1c4; WORD $0x860c // vmovups	(%r14,%rax,4), %xmm1
+	LONG $0x597081c4; WORD $0x840c // vmulps	(%r12,%r8,4), %xmm1, %xmm1
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x03       // andl	$3, %esi
+	LONG $0xc058f2c5               // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_24
+
+BB0_29:
+	LONG $0x11048d49               // leaq	(%r9,%rdx), %rax
+	LONG $0x15748d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0xb63c // vmovss	(%r14,%rsi,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x8404 // vfmadd231ss	(%r12,%rax,4), %xmm7, %xmm0
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x394c; BYTE $0xf8       // cmpq	%r15, %rax
+	JGE  BB0_24
+	LONG $0x28348d4a               // leaq	(%rax,%r13), %rsi
+	LONG $0x02c28348               // addq	$2, %rdx
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0x107ac1c4; WORD $0xb63c // vmovss	(%r14,%rsi,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x8404 // vfmadd231ss	(%r12,%rax,4), %xmm7, %xmm0
+	WORD $0x394c; BYTE $0xfa       // cmpq	%r15, %rdx
+	JGE  BB0_24
+	LONG $0x0a048d4a               // leaq	(%rdx,%r9), %rax
+	WORD $0x014c; BYTE $0xea       // addq	%r13, %rdx
+	LONG $0x107ac1c4; WORD $0x843c // vmovss	(%r12,%rax,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x9604 // vfmadd231ss	(%r14,%rdx,4), %xmm7, %xmm0
+
+BB0_24:
+	LONG $0x24448b48; BYTE $0x70 // movq	112(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_31
+	LONG $0x0458fac5; BYTE $0x98 // vaddss	(%rax,%rbx,4), %xmm0, %xmm0
+
+BB0_31:
+	QUAD $0x000000c824848b48             // movq	200(%rsp), %rax
+	WORD $0x014d; BYTE $0xf9             // addq	%r15, %r9
+	LONG $0x0411fac5; BYTE $0x98         // vmovss	%xmm0, (%rax,%rbx,4)
+	QUAD $0x000000d024848b48             // movq	208(%rsp), %rax
+	LONG $0x01c38348                     // addq	$1, %rbx
+	WORD $0x0148; BYTE $0xc1             // addq	%rax, %rcx
+	LONG $0x245c3948; BYTE $0x78         // cmpq	%rbx, 120(%rsp)
+	JNE  BB0_20
+	QUAD $0x000000d0249c8b48             // movq	208(%rsp), %rbx
+	LONG $0x244c8b48; BYTE $0x78         // movq	120(%rsp), %rcx
+	WORD $0x014d; BYTE $0xfd             // addq	%r15, %r13
+	QUAD $0x000000b824848348; BYTE $0x01 // addq	$1, 184(%rsp)
+	QUAD $0x000000b824848b48             // movq	184(%rsp), %rax
+	QUAD $0x000000a8248c0148             // addq	%rcx, 168(%rsp)
+	WORD $0x0148; BYTE $0xdf             // addq	%rbx, %rdi
+	LONG $0x24443948; BYTE $0x30         // cmpq	%rax, 48(%rsp)
+	JNE  BB0_34
+
+BB0_58:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x10a58d48; WORD $0xffff; BYTE $0xff // leaq	-240(%rbp), %rsp
+	RET
+
+BB0_14:
+	LONG $0x24448b48; BYTE $0x68   // movq	104(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x8014 // vmovss	%xmm2, (%rax,%r8,4)
+	LONG $0x24448b48; BYTE $0x48   // movq	72(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x800c // vmovss	%xmm1, (%rax,%r8,4)
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x8004 // vmovss	%xmm0, (%rax,%r8,4)
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x8024 // vmovss	%xmm4, (%rax,%r8,4)
+	JMP  BB0_61
+
+BB0_36:
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xe328fcc5 // vmovaps	%ymm3, %ymm4
+	LONG $0xcb28fcc5 // vmovaps	%ymm3, %ymm1
+	LONG $0xd328fcc5 // vmovaps	%ymm3, %ymm2
+	JMP  BB0_5
+
+BB0_37:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_8
+
+BB0_38:
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	JMP  BB0_22
+
+BB0_39:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_25
+
+BB0_35:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_2
@@ -0,0 +1,863 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basedense_c_f32_avx512_amd64.c
+
+TEXT ·dense_c_f32_avx512(SB), $304-88
+	MOVQ x+0(FP), DI
+	MOVQ weight+8(FP), SI
+	MOVQ bias+16(FP), DX
+	MOVQ output+24(FP), CX
+	MOVQ pbatchSize+32(FP), R8
+	MOVQ pinFeatures+40(FP), R9
+	MOVQ poutFeatures+48(FP), R11
+	MOVQ R11, 256(SP)
+	MOVQ plen_x+56(FP), R11
+	MOVQ R11, 264(SP)
+	MOVQ plen_weight+64(FP), R11
+	MOVQ R11, 272(SP)
+	MOVQ plen_bias+72(FP), R11
+	MOVQ R11, 280(SP)
+	MOVQ plen_output+80(FP), R11
+	MOVQ R11, 288(SP)
+	LONG $0x6ef961c4; BYTE $0xd2               // vmovq	%rdx, %xmm10
+	QUAD $0x000000f024ac8d48                   // leaq	240(%rsp), %rbp
+	WORD $0x8949; BYTE $0xcc                   // movq	%rcx, %r12
+	LONG $0x24648d48; BYTE $0x40               // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348                           // andq	$-64, %rsp
+	LONG $0x10458b48                           // movq	16(%rbp), %rax
+	WORD $0x8b4d; BYTE $0x38                   // movq	(%r8), %r15
+	QUAD $0x0000008824b48948                   // movq	%rsi, 136(%rsp)
+	WORD $0x8b49; BYTE $0x09                   // movq	(%r9), %rcx
+	WORD $0x8b48; BYTE $0x00                   // movq	(%rax), %rax
+	LONG $0x24448948; BYTE $0x60               // movq	%rax, 96(%rsp)
+	LONG $0x03ff8349                           // cmpq	$3, %r15
+	JLE  BB0_35
+	QUAD $0x0000000085148d48                   // leaq	0(,%rax,4), %rdx
+	WORD $0x8949; BYTE $0xc6                   // movq	%rax, %r14
+	LONG $0xc4048d49                           // leaq	(%r12,%rax,8), %rax
+	WORD $0x8948; BYTE $0xfb                   // movq	%rdi, %rbx
+	LONG $0x24448948; BYTE $0x50               // movq	%rax, 80(%rsp)
+	LONG $0x04e6c149                           // salq	$4, %r14
+	QUAD $0x000000008d048d48                   // leaq	0(,%rcx,4), %rax
+	LONG $0x0003b841; WORD $0x0000             // movl	$3, %r8d
+	LONG $0x6ef961c4; BYTE $0xd8               // vmovq	%rax, %xmm11
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	LONG $0x2464894c; BYTE $0x58               // movq	%r12, 88(%rsp)
+	LONG $0x08fde162; WORD $0xda6e             // vmovq	%rdx, %xmm19
+	LONG $0x04e0c148                           // salq	$4, %rax
+	LONG $0x7ef961c4; BYTE $0xde               // vmovq	%xmm11, %rsi
+	QUAD $0x000000b8248c8948                   // movq	%rcx, 184(%rsp)
+	LONG $0x24448948; BYTE $0x30               // movq	%rax, 48(%rsp)
+	LONG $0x7ef961c4; BYTE $0xd8               // vmovq	%xmm11, %rax
+	LONG $0x07148d4c                           // leaq	(%rdi,%rax), %r10
+	LONG $0x09048d48                           // leaq	(%rcx,%rcx), %rax
+	LONG $0x247c894c; BYTE $0x38               // movq	%r15, 56(%rsp)
+	QUAD $0x000000b024848948                   // movq	%rax, 176(%rsp)
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x320c8d4d                           // leaq	(%r10,%rsi), %r9
+	QUAD $0x0000009024848948                   // movq	%rax, 144(%rsp)
+	LONG $0xf0418d48                           // leaq	-16(%rcx), %rax
+	LONG $0x311c8d4d                           // leaq	(%r9,%rsi), %r11
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	LONG $0x2444894c; BYTE $0x40               // movq	%r8, 64(%rsp)
+	LONG $0x10c08348                           // addq	$16, %rax
+	LONG $0x2474894c; BYTE $0x28               // movq	%r14, 40(%rsp)
+	LONG $0x24448948; BYTE $0x48               // movq	%rax, 72(%rsp)
+	QUAD $0x000000982484c748; LONG $0x00000000 // movq	$0, 152(%rsp)
+	LONG $0x2464894c; BYTE $0x20               // movq	%r12, 32(%rsp)
+
+BB0_4:
+	LONG $0x247c8348; WORD $0x0060 // cmpq	$0, 96(%rsp)
+	JLE  BB0_16
+	LONG $0x24548b48; BYTE $0x58   // movq	88(%rsp), %rdx
+	WORD $0x3145; BYTE $0xed       // xorl	%r13d, %r13d
+	WORD $0x3145; BYTE $0xf6       // xorl	%r14d, %r14d
+	LONG $0x08fde162; WORD $0xd87e // vmovq	%xmm19, %rax
+	QUAD $0x000000a8248c894c       // movq	%r9, 168(%rsp)
+	QUAD $0x0000008824848b4c       // movq	136(%rsp), %r8
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x6ef961c4; BYTE $0xea   // vmovq	%rdx, %xmm13
+	LONG $0x24548b48; BYTE $0x50   // movq	80(%rsp), %rdx
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x6ef961c4; BYTE $0xe2   // vmovq	%rdx, %xmm12
+
+BB0_17:
+	LONG $0x0ff98348 // cmpq	$15, %rcx
+	JLE  BB0_36
+
+BB0_64:
+	LONG $0xe457d8c5               // vxorps	%xmm4, %xmm4, %xmm4
+	QUAD $0x000000a8248c8b4c       // movq	168(%rsp), %r9
+	LONG $0x000010b8; BYTE $0x00   // movl	$16, %eax
+	LONG $0x487cf162; WORD $0xdc28 // vmovaps	%zmm4, %zmm3
+	LONG $0x487cf162; WORD $0xcc28 // vmovaps	%zmm4, %zmm1
+	LONG $0x487cf162; WORD $0xd428 // vmovaps	%zmm4, %zmm2
+
+BB0_6:
+	QUAD $0xff804410487cd162       // vmovups	-64(%r8,%rax,4), %zmm0
+	QUAD $0xff8354b8487df262       // vfmadd231ps	-64(%rbx,%rax,4), %zmm0, %zmm2
+	QUAD $0xff824cb8487dd262       // vfmadd231ps	-64(%r10,%rax,4), %zmm0, %zmm1
+	QUAD $0xff815cb8487dd262       // vfmadd231ps	-64(%r9,%rax,4), %zmm0, %zmm3
+	QUAD $0xff8364b8487dd262       // vfmadd231ps	-64(%r11,%rax,4), %zmm0, %zmm4
+	LONG $0x10c08348               // addq	$16, %rax
+	WORD $0x3948; BYTE $0xc8       // cmpq	%rcx, %rax
+	JLE  BB0_6
+	QUAD $0x000000a8248c894c       // movq	%r9, 168(%rsp)
+	LONG $0x24548b48; BYTE $0x48   // movq	72(%rsp), %rdx
+	LONG $0x48fdf162; WORD $0xf428 // vmovapd	%zmm4, %zmm6
+	LONG $0x48fdf162; WORD $0xc328 // vmovapd	%zmm3, %zmm0
+
+BB0_5:
+	LONG $0x48fdf362; WORD $0xd31b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm3
+	LONG $0xd258e4c5                           // vaddps	%ymm2, %ymm3, %ymm2
+	LONG $0x197de3c4; WORD $0x01d3             // vextractf128	$0x1, %ymm2, %xmm3
+	LONG $0xda58e0c5                           // vaddps	%xmm2, %xmm3, %xmm3
+	LONG $0x0479e3c4; WORD $0x4ed3             // vpermilps	$78, %xmm3, %xmm2
+	LONG $0xd358e8c5                           // vaddps	%xmm3, %xmm2, %xmm2
+	LONG $0xe228f8c5                           // vmovaps	%xmm2, %xmm4
+	LONG $0xd2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm2
+	LONG $0xe258dac5                           // vaddss	%xmm2, %xmm4, %xmm4
+	LONG $0x48fdf362; WORD $0xca1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm2
+	LONG $0xc958ecc5                           // vaddps	%ymm1, %ymm2, %ymm1
+	LONG $0x197de3c4; WORD $0x01ca             // vextractf128	$0x1, %ymm1, %xmm2
+	LONG $0xd158e8c5                           // vaddps	%xmm1, %xmm2, %xmm2
+	LONG $0x0479e3c4; WORD $0x4eca             // vpermilps	$78, %xmm2, %xmm1
+	LONG $0xca58f0c5                           // vaddps	%xmm2, %xmm1, %xmm1
+	LONG $0xd928f8c5                           // vmovaps	%xmm1, %xmm3
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f4c5                           // vaddps	%ymm0, %ymm1, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0x0479e3c4; WORD $0x4ec1             // vpermilps	$78, %xmm1, %xmm0
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xd028f8c5                           // vmovaps	%xmm0, %xmm2
+	LONG $0xc0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm0
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x48fdf362; WORD $0xf01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm6, %ymm0
+	LONG $0xc658fcc5                           // vaddps	%ymm6, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc128f8c5                           // vmovaps	%xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_7
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	QUAD $0x0000008024948948                   // movq	%rdx, 128(%rsp)
+	WORD $0x2948; BYTE $0xd0                   // subq	%rdx, %rax
+	QUAD $0x000000a024848948                   // movq	%rax, 160(%rsp)
+	LONG $0x01e88348                           // subq	$1, %rax
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_37
+	QUAD $0x0000009824b48b48                   // movq	152(%rsp), %rsi
+	QUAD $0x000000b8248c8b4c                   // movq	184(%rsp), %r9
+	LONG $0x245c894c; BYTE $0x70               // movq	%r11, 112(%rsp)
+	QUAD $0x000000a8249c8b4c                   // movq	168(%rsp), %r11
+	LONG $0x244c8948; BYTE $0x78               // movq	%rcx, 120(%rsp)
+	LONG $0x32048d48                           // leaq	(%rdx,%rsi), %rax
+	LONG $0x247c8948; BYTE $0x68               // movq	%rdi, 104(%rsp)
+	LONG $0x87348d48                           // leaq	(%rdi,%rax,4), %rsi
+	LONG $0x2a048d4a                           // leaq	(%rdx,%r13), %rax
+	LONG $0x6ef961c4; BYTE $0xce               // vmovq	%rsi, %xmm9
+	QUAD $0x0000008824b48b48                   // movq	136(%rsp), %rsi
+	LONG $0x86348d48                           // leaq	(%rsi,%rax,4), %rsi
+	LONG $0x0a048d4a                           // leaq	(%rdx,%r9), %rax
+	LONG $0x870c8d4c                           // leaq	(%rdi,%rax,4), %r9
+	LONG $0x6ef9c1c4; BYTE $0xe9               // vmovq	%r9, %xmm5
+	QUAD $0x000000b0248c8b4c                   // movq	176(%rsp), %r9
+	LONG $0x0a048d4a                           // leaq	(%rdx,%r9), %rax
+	QUAD $0x00000090248c8b4c                   // movq	144(%rsp), %r9
+	LONG $0x873c8d4c                           // leaq	(%rdi,%rax,4), %r15
+	LONG $0x0a048d4a                           // leaq	(%rdx,%r9), %rax
+	LONG $0x87248d4c                           // leaq	(%rdi,%rax,4), %r12
+	QUAD $0x000000a024848b48                   // movq	160(%rsp), %rax
+	WORD $0x894c; BYTE $0xe7                   // movq	%r12, %rdi
+	LONG $0x7ef941c4; BYTE $0xcc               // vmovq	%xmm9, %r12
+	LONG $0x04e8c148                           // shrq	$4, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	WORD $0x8949; BYTE $0xc1                   // movq	%rax, %r9
+	WORD $0xc031                               // xorl	%eax, %eax
+	WORD $0x894c; BYTE $0xc9                   // movq	%r9, %rcx
+	WORD $0x8949; BYTE $0xd1                   // movq	%rdx, %r9
+	LONG $0x7ef9e1c4; BYTE $0xea               // vmovq	%xmm5, %rdx
+
+BB0_9:
+	LONG $0x487cf162; WORD $0x0c10; BYTE $0x06 // vmovups	(%rsi,%rax), %zmm1
+	LONG $0x48745162; WORD $0x3459; BYTE $0x04 // vmulps	(%r12,%rax), %zmm1, %zmm14
+	LONG $0x080cc162; WORD $0xcec6; BYTE $0x55 // vshufps	$85, %xmm14, %xmm14, %xmm17
+	LONG $0x080cc162; WORD $0xc6c6; BYTE $0xff // vshufps	$255, %xmm14, %xmm14, %xmm16
+	LONG $0x280d5362; WORD $0xfe03; BYTE $0x07 // valignd	$7, %ymm14, %ymm14, %ymm15
+	LONG $0x585ac1c4; BYTE $0xe6               // vaddss	%xmm14, %xmm4, %xmm4
+	LONG $0x0076e162; WORD $0xcc58             // vaddss	%xmm4, %xmm17, %xmm17
+	LONG $0x1508c1c4; BYTE $0xe6               // vunpckhps	%xmm14, %xmm14, %xmm4
+	LONG $0x085eb162; WORD $0xe158             // vaddss	%xmm17, %xmm4, %xmm4
+	LONG $0x007ee162; WORD $0xc458             // vaddss	%xmm4, %xmm16, %xmm16
+	LONG $0x287d7362; WORD $0xf419; BYTE $0x01 // vextractf32x4	$1, %ymm14, %xmm4
+	LONG $0x085eb162; WORD $0xe058             // vaddss	%xmm16, %xmm4, %xmm4
+	LONG $0x280dc362; WORD $0xc603; BYTE $0x05 // valignd	$5, %ymm14, %ymm14, %ymm16
+	LONG $0x007ee162; WORD $0xc458             // vaddss	%xmm4, %xmm16, %xmm16
+	LONG $0x280dd362; WORD $0xe603; BYTE $0x06 // valignd	$6, %ymm14, %ymm14, %ymm4
+	LONG $0x487d5362; WORD $0xf61b; BYTE $0x01 // vextractf32x8	$0x1, %zmm14, %ymm14
+	LONG $0x085eb162; WORD $0xe058             // vaddss	%xmm16, %xmm4, %xmm4
+	LONG $0x080cc162; WORD $0xc6c6; BYTE $0x55 // vshufps	$85, %xmm14, %xmm14, %xmm16
+	LONG $0xfc5802c5                           // vaddss	%xmm4, %xmm15, %xmm15
+	LONG $0xc608c1c4; WORD $0xffe6             // vshufps	$255, %xmm14, %xmm14, %xmm4
+	LONG $0x580a41c4; BYTE $0xff               // vaddss	%xmm15, %xmm14, %xmm15
+	LONG $0x007ec162; WORD $0xc758             // vaddss	%xmm15, %xmm16, %xmm16
+	LONG $0x150841c4; BYTE $0xfe               // vunpckhps	%xmm14, %xmm14, %xmm15
+	LONG $0x08063162; WORD $0xf858             // vaddss	%xmm16, %xmm15, %xmm15
+	LONG $0x585ac1c4; BYTE $0xe7               // vaddss	%xmm15, %xmm4, %xmm4
+	LONG $0x287d5362; WORD $0xf719; BYTE $0x01 // vextractf32x4	$1, %ymm14, %xmm15
+	LONG $0xe45882c5                           // vaddss	%xmm4, %xmm15, %xmm4
+	LONG $0x280d5362; WORD $0xfe03; BYTE $0x05 // valignd	$5, %ymm14, %ymm14, %ymm15
+	LONG $0xfc5802c5                           // vaddss	%xmm4, %xmm15, %xmm15
+	LONG $0x280dd362; WORD $0xe603; BYTE $0x06 // valignd	$6, %ymm14, %ymm14, %ymm4
+	LONG $0x280d5362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm14, %ymm14, %ymm14
+	LONG $0x585ac1c4; BYTE $0xe7               // vaddss	%xmm15, %xmm4, %xmm4
+	LONG $0x585ac1c4; BYTE $0xe6               // vaddss	%xmm14, %xmm4, %xmm4
+	LONG $0x48747162; WORD $0x3459; BYTE $0x02 // vmulps	(%rdx,%rax), %zmm1, %zmm14
+	LONG $0x080cc162; WORD $0xcec6; BYTE $0x55 // vshufps	$85, %xmm14, %xmm14, %xmm17
+	LONG $0x080cc162; WORD $0xc6c6; BYTE $0xff // vshufps	$255, %xmm14, %xmm14, %xmm16
+	LONG $0x280d5362; WORD $0xfe03; BYTE $0x07 // valignd	$7, %ymm14, %ymm14, %ymm15
+	LONG $0x5862c1c4; BYTE $0xde               // vaddss	%xmm14, %xmm3, %xmm3
+	LONG $0x0076e162; WORD $0xcb58             // vaddss	%xmm3, %xmm17, %xmm17
+	LONG $0x1508c1c4; BYTE $0xde               // vunpckhps	%xmm14, %xmm14, %xmm3
+	LONG $0x0866b162; WORD $0xd958             // vaddss	%xmm17, %xmm3, %xmm3
+	LONG $0x007ee162; WORD $0xc358             // vaddss	%xmm3, %xmm16, %xmm16
+	LONG $0x287d7362; WORD $0xf319; BYTE $0x01 // vextractf32x4	$1, %ymm14, %xmm3
+	LONG $0x0866b162; WORD $0xd858             // vaddss	%xmm16, %xmm3, %xmm3
+	LONG $0x280dc362; WORD $0xc603; BYTE $0x05 // valignd	$5, %ymm14, %ymm14, %ymm16
+	LONG $0x007ee162; WORD $0xc358             // vaddss	%xmm3, %xmm16, %xmm16
+	LONG $0x280dd362; WORD $0xde03; BYTE $0x06 // valignd	$6, %ymm14, %ymm14, %ymm3
+	LONG $0x487d5362; WORD $0xf61b; BYTE $0x01 // vextractf32x8	$0x1, %zmm14, %ymm14
+	LONG $0x0866b162; WORD $0xd858             // vaddss	%xmm16, %xmm3, %xmm3
+	LONG $0x080cc162; WORD $0xc6c6; BYTE $0x55 // vshufps	$85, %xmm14, %xmm14, %xmm16
+	LONG $0xfb5802c5                           // vaddss	%xmm3, %xmm15, %xmm15
+	LONG $0xc608c1c4; WORD $0xffde             // vshufps	$255, %xmm14, %xmm14, %xmm3
+	LONG $0x580a41c4; BYTE $0xff               // vaddss	%xmm15, %xmm14, %xmm15
+	LONG $0x007ec162; WORD $0xc758             // vaddss	%xmm15, %xmm16, %xmm16
+	LONG $0x150841c4; BYTE $0xfe               // vunpckhps	%xmm14, %xmm14, %xmm15
+	LONG $0x08063162; WORD $0xf858             // vaddss	%xmm16, %xmm15, %xmm15
+	LONG $0x5862c1c4; BYTE $0xdf               // vaddss	%xmm15, %xmm3, %xmm3
+	LONG $0x287d5362; WORD $0xf719; BYTE $0x01 // vextractf32x4	$1, %ymm14, %xmm15
+	LONG $0xdb5882c5                           // vaddss	%xmm3, %xmm15, %xmm3
+	LONG $0x280d5362; WORD $0xfe03; BYTE $0x05 // valignd	$5, %ymm14, %ymm14, %ymm15
+	LONG $0xfb5802c5                           // vaddss	%xmm3, %xmm15, %xmm15
+	LONG $0x280dd362; WORD $0xde03; BYTE $0x06 // valignd	$6, %ymm14, %ymm14, %ymm3
+	LONG $0x280d5362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm14, %ymm14, %ymm14
+	LONG $0x5862c1c4; BYTE $0xdf               // vaddss	%xmm15, %xmm3, %xmm3
+	LONG $0x5862c1c4; BYTE $0xde               // vaddss	%xmm14, %xmm3, %xmm3
+	LONG $0x48745162; WORD $0x3459; BYTE $0x07 // vmulps	(%r15,%rax), %zmm1, %zmm14
+	LONG $0x080cc162; WORD $0xcec6; BYTE $0x55 // vshufps	$85, %xmm14, %xmm14, %xmm17
+	LONG $0x080cc162; WORD $0xc6c6; BYTE $0xff // vshufps	$255, %xmm14, %xmm14, %xmm16
+	LONG $0x280d5362; WORD $0xfe03; BYTE $0x07 // valignd	$7, %ymm14, %ymm14, %ymm15
+	LONG $0xd2588ac5                           // vaddss	%xmm2, %xmm14, %xmm2
+	LONG $0x0076e162; WORD $0xca58             // vaddss	%xmm2, %xmm17, %xmm17
+	LONG $0x1508c1c4; BYTE $0xd6               // vunpckhps	%xmm14, %xmm14, %xmm2
+	LONG $0x086eb162; WORD $0xd158             // vaddss	%xmm17, %xmm2, %xmm2
+	LONG $0x007ee162; WORD $0xc258             // vaddss	%xmm2, %xmm16, %xmm16
+	LONG $0x287d7362; WORD $0xf219; BYTE $0x01 // vextractf32x4	$1, %ymm14, %xmm2
+	LONG $0x086eb162; WORD $0xd058             // vaddss	%xmm16, %xmm2, %xmm2
+	LONG $0x280dc362; WORD $0xc603; BYTE $0x05 // valignd	$5, %ymm14, %ymm14, %ymm16
+	LONG $0x007ee162; WORD $0xc258             // vaddss	%xmm2, %xmm16, %xmm16
+	LONG $0x280dd362; WORD $0xd603; BYTE $0x06 // valignd	$6, %ymm14, %ymm14, %ymm2
+	LONG $0x487d5362; WORD $0xf61b; BYTE $0x01 // vextractf32x8	$0x1, %zmm14, %ymm14
+	LONG $0x086eb162; WORD $0xd058             // vaddss	%xmm16, %xmm2, %xmm2
+	LONG $0x080cc162; WORD $0xc6c6; BYTE $0xff // vshufps	$255, %xmm14, %xmm14, %xmm16
+	LONG $0xfa5802c5                           // vaddss	%xmm2, %xmm15, %xmm15
+	LONG $0x580ac1c4; BYTE $0xd7               // vaddss	%xmm15, %xmm14, %xmm2
+	LONG $0xc60841c4; WORD $0x55fe             // vshufps	$85, %xmm14, %xmm14, %xmm15
+	LONG $0x586ac1c4; BYTE $0xd7               // vaddss	%xmm15, %xmm2, %xmm2
+	LONG $0x150841c4; BYTE $0xfe               // vunpckhps	%xmm14, %xmm14, %xmm15
+	LONG $0x586ac1c4; BYTE $0xd7               // vaddss	%xmm15, %xmm2, %xmm2
+	LONG $0x287d5362; WORD $0xf719; BYTE $0x01 // vextractf32x4	$1, %ymm14, %xmm15
+	LONG $0x086eb162; WORD $0xd058             // vaddss	%xmm16, %xmm2, %xmm2
+	LONG $0xfa5802c5                           // vaddss	%xmm2, %xmm15, %xmm15
+	LONG $0x280dd362; WORD $0xd603; BYTE $0x05 // valignd	$5, %ymm14, %ymm14, %ymm2
+	LONG $0x586ac1c4; BYTE $0xd7               // vaddss	%xmm15, %xmm2, %xmm2
+	LONG $0x280d5362; WORD $0xfe03; BYTE $0x06 // valignd	$6, %ymm14, %ymm14, %ymm15
+	LONG $0x280d5362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm14, %ymm14, %ymm14
+	LONG $0x586ac1c4; BYTE $0xd7               // vaddss	%xmm15, %xmm2, %xmm2
+	LONG $0x586ac1c4; BYTE $0xd6               // vaddss	%xmm14, %xmm2, %xmm2
+	LONG $0x48747162; WORD $0x3459; BYTE $0x07 // vmulps	(%rdi,%rax), %zmm1, %zmm14
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0xc608c1c4; WORD $0x55ce             // vshufps	$85, %xmm14, %xmm14, %xmm1
+	LONG $0x080cc162; WORD $0xc6c6; BYTE $0xff // vshufps	$255, %xmm14, %xmm14, %xmm16
+	LONG $0x280d5362; WORD $0xfe03; BYTE $0x07 // valignd	$7, %ymm14, %ymm14, %ymm15
+	LONG $0x587ac1c4; BYTE $0xc6               // vaddss	%xmm14, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x1508c1c4; BYTE $0xce               // vunpckhps	%xmm14, %xmm14, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x287d7362; WORD $0xf119; BYTE $0x01 // vextractf32x4	$1, %ymm14, %xmm1
+	LONG $0x087eb162; WORD $0xc058             // vaddss	%xmm16, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x280dd362; WORD $0xce03; BYTE $0x05 // valignd	$5, %ymm14, %ymm14, %ymm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x280dd362; WORD $0xce03; BYTE $0x06 // valignd	$6, %ymm14, %ymm14, %ymm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x487d7362; WORD $0xf11b; BYTE $0x01 // vextractf32x8	$0x1, %zmm14, %ymm1
+	LONG $0xf1c670c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm14
+	LONG $0x587ac1c4; BYTE $0xc7               // vaddss	%xmm15, %xmm0, %xmm0
+	LONG $0xf9c670c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm15
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc7               // vaddss	%xmm15, %xmm0, %xmm0
+	LONG $0xf91570c5                           // vunpckhps	%xmm1, %xmm1, %xmm15
+	LONG $0x587ac1c4; BYTE $0xc7               // vaddss	%xmm15, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc6               // vaddss	%xmm14, %xmm0, %xmm0
+	LONG $0x287dd362; WORD $0xce19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm14
+	LONG $0x587ac1c4; BYTE $0xc6               // vaddss	%xmm14, %xmm0, %xmm0
+	LONG $0x28757362; WORD $0xf103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm14
+	LONG $0x587ac1c4; BYTE $0xc6               // vaddss	%xmm14, %xmm0, %xmm0
+	LONG $0x28757362; WORD $0xf103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm14
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0x587ac1c4; BYTE $0xc6               // vaddss	%xmm14, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JNE  BB0_9
+	QUAD $0x000000a024b48b48                   // movq	160(%rsp), %rsi
+	WORD $0x894c; BYTE $0xca                   // movq	%r9, %rdx
+	LONG $0x244c8b48; BYTE $0x78               // movq	120(%rsp), %rcx
+	QUAD $0x000000a8249c894c                   // movq	%r11, 168(%rsp)
+	LONG $0x247c8b48; BYTE $0x68               // movq	104(%rsp), %rdi
+	LONG $0x245c8b4c; BYTE $0x70               // movq	112(%rsp), %r11
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x0f                   // andl	$15, %esi
+	JE   BB0_7
+
+BB0_8:
+	QUAD $0x000000a024b48b48                   // movq	160(%rsp), %rsi
+	WORD $0x2948; BYTE $0xc6                   // subq	%rax, %rsi
+	LONG $0xff668d4c                           // leaq	-1(%rsi), %r12
+	LONG $0x06fc8349                           // cmpq	$6, %r12
+	JBE  BB0_12
+	QUAD $0x0000008024bc8b4c                   // movq	128(%rsp), %r15
+	QUAD $0x00000088248c8b4c                   // movq	136(%rsp), %r9
+	LONG $0x05648d4d; BYTE $0x00               // leaq	0(%r13,%rax), %r12
+	WORD $0x014d; BYTE $0xfc                   // addq	%r15, %r12
+	WORD $0x014c; BYTE $0xf8                   // addq	%r15, %rax
+	LONG $0x107c81c4; WORD $0xa134             // vmovups	(%r9,%r12,4), %ymm6
+	QUAD $0x00000098248c8b4c                   // movq	152(%rsp), %r9
+	LONG $0x08248d4e                           // leaq	(%rax,%r9), %r12
+	QUAD $0x000000b8248c8b4c                   // movq	184(%rsp), %r9
+	LONG $0x594ca1c4; WORD $0xa73c             // vmulps	(%rdi,%r12,4), %ymm6, %ymm7
+	LONG $0x08248d4e                           // leaq	(%rax,%r9), %r12
+	QUAD $0x000000b0248c8b4c                   // movq	176(%rsp), %r9
+	LONG $0xcf58dac5                           // vaddss	%xmm7, %xmm4, %xmm1
+	LONG $0xe7c6c0c5; BYTE $0x55               // vshufps	$85, %xmm7, %xmm7, %xmm4
+	LONG $0xc7c640c5; BYTE $0xff               // vshufps	$255, %xmm7, %xmm7, %xmm8
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xe715c0c5                           // vunpckhps	%xmm7, %xmm7, %xmm4
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xfc19; BYTE $0x01 // vextractf32x4	$1, %ymm7, %xmm4
+	LONG $0x5872c1c4; BYTE $0xc8               // vaddss	%xmm8, %xmm1, %xmm1
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0x2845f362; WORD $0xe703; BYTE $0x05 // valignd	$5, %ymm7, %ymm7, %ymm4
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0x2845f362; WORD $0xe703; BYTE $0x06 // valignd	$6, %ymm7, %ymm7, %ymm4
+	LONG $0x2845f362; WORD $0xff03; BYTE $0x07 // valignd	$7, %ymm7, %ymm7, %ymm7
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xe758f2c5                           // vaddss	%xmm7, %xmm1, %xmm4
+	LONG $0x594ca1c4; WORD $0xa73c             // vmulps	(%rdi,%r12,4), %ymm6, %ymm7
+	LONG $0x08248d4e                           // leaq	(%rax,%r9), %r12
+	QUAD $0x00000090248c8b4c                   // movq	144(%rsp), %r9
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+	LONG $0xcf58e2c5                           // vaddss	%xmm7, %xmm3, %xmm1
+	LONG $0xdfc6c0c5; BYTE $0x55               // vshufps	$85, %xmm7, %xmm7, %xmm3
+	LONG $0xc7c640c5; BYTE $0xff               // vshufps	$255, %xmm7, %xmm7, %xmm8
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xdf15c0c5                           // vunpckhps	%xmm7, %xmm7, %xmm3
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xfb19; BYTE $0x01 // vextractf32x4	$1, %ymm7, %xmm3
+	LONG $0x5872c1c4; BYTE $0xc8               // vaddss	%xmm8, %xmm1, %xmm1
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0x2845f362; WORD $0xdf03; BYTE $0x05 // valignd	$5, %ymm7, %ymm7, %ymm3
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0x2845f362; WORD $0xdf03; BYTE $0x06 // valignd	$6, %ymm7, %ymm7, %ymm3
+	LONG $0x2845f362; WORD $0xff03; BYTE $0x07 // valignd	$7, %ymm7, %ymm7, %ymm7
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xdf58f2c5                           // vaddss	%xmm7, %xmm1, %xmm3
+	LONG $0x594ca1c4; WORD $0xa73c             // vmulps	(%rdi,%r12,4), %ymm6, %ymm7
+	LONG $0x3459ccc5; BYTE $0x87               // vmulps	(%rdi,%rax,4), %ymm6, %ymm6
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x07                   // andl	$7, %esi
+	LONG $0xcf58eac5                           // vaddss	%xmm7, %xmm2, %xmm1
+	LONG $0xd7c6c0c5; BYTE $0x55               // vshufps	$85, %xmm7, %xmm7, %xmm2
+	LONG $0xc7c640c5; BYTE $0xff               // vshufps	$255, %xmm7, %xmm7, %xmm8
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xd715c0c5                           // vunpckhps	%xmm7, %xmm7, %xmm2
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xfa19; BYTE $0x01 // vextractf32x4	$1, %ymm7, %xmm2
+	LONG $0x5872c1c4; BYTE $0xc8               // vaddss	%xmm8, %xmm1, %xmm1
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0x2845f362; WORD $0xd703; BYTE $0x05 // valignd	$5, %ymm7, %ymm7, %ymm2
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0x2845f362; WORD $0xd703; BYTE $0x06 // valignd	$6, %ymm7, %ymm7, %ymm2
+	LONG $0x2845f362; WORD $0xff03; BYTE $0x07 // valignd	$7, %ymm7, %ymm7, %ymm7
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xd758f2c5                           // vaddss	%xmm7, %xmm1, %xmm2
+	LONG $0xcec6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xce15c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm1
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xf119; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm1
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x284df362; WORD $0xce03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x284df362; WORD $0xce03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm1
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	JE   BB0_7
+
+BB0_12:
+	QUAD $0x0000008824bc8b4c       // movq	136(%rsp), %r15
+	QUAD $0x0000009824a48b4c       // movq	152(%rsp), %r12
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	QUAD $0x00000090248c8b4c       // movq	144(%rsp), %r9
+	LONG $0x107ac1c4; WORD $0x870c // vmovss	(%r15,%rax,4), %xmm1
+	LONG $0x14048d49               // leaq	(%r12,%rdx), %rax
+	LONG $0xb971e2c4; WORD $0x8724 // vfmadd231ss	(%rdi,%rax,4), %xmm1, %xmm4
+	QUAD $0x000000b824848b48       // movq	184(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb971e2c4; WORD $0x871c // vfmadd231ss	(%rdi,%rax,4), %xmm1, %xmm3
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	LONG $0xb971e2c4; WORD $0x8714 // vfmadd231ss	(%rdi,%rax,4), %xmm1, %xmm2
+	WORD $0x894c; BYTE $0xc8       // movq	%r9, %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb971e2c4; WORD $0x8704 // vfmadd231ss	(%rdi,%rax,4), %xmm1, %xmm0
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_7
+	LONG $0x05748d49; BYTE $0x00   // leaq	0(%r13,%rax), %rsi
+	LONG $0x107ac1c4; WORD $0xb70c // vmovss	(%r15,%rsi,4), %xmm1
+	LONG $0x04348d49               // leaq	(%r12,%rax), %rsi
+	LONG $0xb971e2c4; WORD $0xb724 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm4
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb971e2c4; WORD $0xb71c // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm3
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xb971e2c4; WORD $0x8704 // vfmadd231ss	(%rdi,%rax,4), %xmm1, %xmm0
+	LONG $0xb971e2c4; WORD $0xb714 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm2
+	LONG $0x02428d48               // leaq	2(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_7
+	LONG $0x05748d49; BYTE $0x00   // leaq	0(%r13,%rax), %rsi
+	LONG $0x107ac1c4; WORD $0xb70c // vmovss	(%r15,%rsi,4), %xmm1
+	LONG $0x04348d49               // leaq	(%r12,%rax), %rsi
+	LONG $0xb971e2c4; WORD $0xb724 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm4
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb971e2c4; WORD $0xb71c // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm3
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xb971e2c4; WORD $0x8704 // vfmadd231ss	(%rdi,%rax,4), %xmm1, %xmm0
+	LONG $0xb971e2c4; WORD $0xb714 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm2
+	LONG $0x03428d48               // leaq	3(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_7
+	LONG $0x05748d49; BYTE $0x00   // leaq	0(%r13,%rax), %rsi
+	LONG $0x107ac1c4; WORD $0xb70c // vmovss	(%r15,%rsi,4), %xmm1
+	LONG $0x04348d49               // leaq	(%r12,%rax), %rsi
+	LONG $0xb971e2c4; WORD $0xb724 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm4
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb971e2c4; WORD $0xb71c // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm3
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xb971e2c4; WORD $0x8704 // vfmadd231ss	(%rdi,%rax,4), %xmm1, %xmm0
+	LONG $0xb971e2c4; WORD $0xb714 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm2
+	LONG $0x04428d48               // leaq	4(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_7
+	LONG $0x05748d49; BYTE $0x00   // leaq	0(%r13,%rax), %rsi
+	LONG $0x107ac1c4; WORD $0xb70c // vmovss	(%r15,%rsi,4), %xmm1
+	LONG $0x04348d49               // leaq	(%r12,%rax), %rsi
+	LONG $0xb971e2c4; WORD $0xb724 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm4
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb971e2c4; WORD $0xb71c // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm3
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xb971e2c4; WORD $0x8704 // vfmadd231ss	(%rdi,%rax,4), %xmm1, %xmm0
+	LONG $0xb971e2c4; WORD $0xb714 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm2
+	LONG $0x05428d48               // leaq	5(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_7
+	LONG $0x05748d49; BYTE $0x00   // leaq	0(%r13,%rax), %rsi
+	LONG $0x06c28348               // addq	$6, %rdx
+	LONG $0x107ac1c4; WORD $0xb70c // vmovss	(%r15,%rsi,4), %xmm1
+	LONG $0x04348d49               // leaq	(%r12,%rax), %rsi
+	LONG $0xb971e2c4; WORD $0xb724 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm4
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb971e2c4; WORD $0xb71c // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm3
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xb971e2c4; WORD $0xb714 // vfmadd231ss	(%rdi,%rsi,4), %xmm1, %xmm2
+	LONG $0xb971e2c4; WORD $0x8704 // vfmadd231ss	(%rdi,%rax,4), %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_7
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	QUAD $0x000000b824b48b48       // movq	184(%rsp), %rsi
+	LONG $0x107ac1c4; WORD $0x870c // vmovss	(%r15,%rax,4), %xmm1
+	LONG $0x14048d49               // leaq	(%r12,%rdx), %rax
+	LONG $0xb971e2c4; WORD $0x8724 // vfmadd231ss	(%rdi,%rax,4), %xmm1, %xmm4
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	LONG $0xb971e2c4; WORD $0x871c // vfmadd231ss	(%rdi,%rax,4), %xmm1, %xmm3
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	WORD $0x014c; BYTE $0xca       // addq	%r9, %rdx
+	LONG $0xb971e2c4; WORD $0x8714 // vfmadd231ss	(%rdi,%rax,4), %xmm1, %xmm2
+	LONG $0xb971e2c4; WORD $0x9704 // vfmadd231ss	(%rdi,%rdx,4), %xmm1, %xmm0
+
+BB0_7:
+	LONG $0x7ef961c4; BYTE $0xd0   // vmovq	%xmm10, %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_14
+	LONG $0x107aa1c4; WORD $0xb00c // vmovss	(%rax,%r14,4), %xmm1
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	WORD $0x0149; BYTE $0xcd       // addq	%rcx, %r13
+	LONG $0xe458f2c5               // vaddss	%xmm4, %xmm1, %xmm4
+	LONG $0xdb58f2c5               // vaddss	%xmm3, %xmm1, %xmm3
+	LONG $0xd258f2c5               // vaddss	%xmm2, %xmm1, %xmm2
+	LONG $0xc058f2c5               // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0x117aa1c4; WORD $0xb024 // vmovss	%xmm4, (%rax,%r14,4)
+	LONG $0x7ef961c4; BYTE $0xe8   // vmovq	%xmm13, %rax
+	LONG $0x117aa1c4; WORD $0xb01c // vmovss	%xmm3, (%rax,%r14,4)
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0xb014 // vmovss	%xmm2, (%rax,%r14,4)
+	LONG $0x7ef961c4; BYTE $0xe0   // vmovq	%xmm12, %rax
+	LONG $0x117aa1c4; WORD $0xb004 // vmovss	%xmm0, (%rax,%r14,4)
+	LONG $0x7ef961c4; BYTE $0xd8   // vmovq	%xmm11, %rax
+	LONG $0x01c68349               // addq	$1, %r14
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+	WORD $0x3949; BYTE $0xc6       // cmpq	%rax, %r14
+	JNE  BB0_17
+
+BB0_60:
+	QUAD $0x000000a8248c8b4c // movq	168(%rsp), %r9
+
+BB0_16:
+	LONG $0x24448b48; BYTE $0x30   // movq	48(%rsp), %rax
+	LONG $0x24748b48; BYTE $0x28   // movq	40(%rsp), %rsi
+	LONG $0x24448348; WORD $0x0440 // addq	$4, 64(%rsp)
+	LONG $0x24548b48; BYTE $0x40   // movq	64(%rsp), %rdx
+	LONG $0x24740148; BYTE $0x58   // addq	%rsi, 88(%rsp)
+	WORD $0x0148; BYTE $0xc3       // addq	%rax, %rbx
+	WORD $0x0149; BYTE $0xc2       // addq	%rax, %r10
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+	LONG $0x24740148; BYTE $0x50   // addq	%rsi, 80(%rsp)
+	WORD $0x0149; BYTE $0xc3       // addq	%rax, %r11
+	LONG $0x7ef961c4; BYTE $0xde   // vmovq	%xmm11, %rsi
+	QUAD $0x0000009824b40148       // addq	%rsi, 152(%rsp)
+	QUAD $0x000000b824b40148       // addq	%rsi, 184(%rsp)
+	QUAD $0x000000b024b40148       // addq	%rsi, 176(%rsp)
+	QUAD $0x0000009024b40148       // addq	%rsi, 144(%rsp)
+	LONG $0x24543948; BYTE $0x38   // cmpq	%rdx, 56(%rsp)
+	JG   BB0_4
+	LONG $0x247c8b4c; BYTE $0x38   // movq	56(%rsp), %r15
+	LONG $0x24648b4c; BYTE $0x20   // movq	32(%rsp), %r12
+	LONG $0xfc478d49               // leaq	-4(%r15), %rax
+	LONG $0x02e8c148               // shrq	$2, %rax
+	QUAD $0x0000000485048d48       // leaq	4(,%rax,4), %rax
+
+BB0_2:
+	WORD $0x3949; BYTE $0xc7     // cmpq	%rax, %r15
+	JLE  BB0_58
+	LONG $0x245c8b48; BYTE $0x60 // movq	96(%rsp), %rbx
+	WORD $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE  BB0_58
+	LONG $0xd8af0f48             // imulq	%rax, %rbx
+	WORD $0x8949; BYTE $0xcb     // movq	%rcx, %r11
+	LONG $0xf0518d48             // leaq	-16(%rcx), %rdx
+	QUAD $0x0000009824bc894c     // movq	%r15, 152(%rsp)
+	LONG $0xd8af0f4c             // imulq	%rax, %r11
+	LONG $0xf0e28348             // andq	$-16, %rdx
+	QUAD $0x000000a824848948     // movq	%rax, 168(%rsp)
+	LONG $0xd77f79c5             // vmovdqa	%xmm10, %xmm7
+	QUAD $0x0000009024a4894c     // movq	%r12, 144(%rsp)
+	WORD $0x8949; BYTE $0xd8     // movq	%rbx, %r8
+	QUAD $0x000000008d1c8d48     // leaq	0(,%rcx,4), %rbx
+	LONG $0x6ef9e1c4; BYTE $0xdb // vmovq	%rbx, %xmm3
+	QUAD $0x000000a02484894c     // movq	%r8, 160(%rsp)
+	LONG $0x105a8d48             // leaq	16(%rdx), %rbx
+	LONG $0x9f0c8d4e             // leaq	(%rdi,%r11,4), %r9
+	QUAD $0x000000b0249c8948     // movq	%rbx, 176(%rsp)
+	QUAD $0x00000088249c8b48     // movq	136(%rsp), %rbx
+	LONG $0xf36ff9c5             // vmovdqa	%xmm3, %xmm6
+
+BB0_34:
+	QUAD $0x0000009024848b48                   // movq	144(%rsp), %rax
+	QUAD $0x000000a024948b48                   // movq	160(%rsp), %rdx
+	WORD $0x8948; BYTE $0xde                   // movq	%rbx, %rsi
+	WORD $0x3145; BYTE $0xd2                   // xorl	%r10d, %r10d
+	QUAD $0x000000b82484c748; LONG $0x00000000 // movq	$0, 184(%rsp)
+	LONG $0x90048d48                           // leaq	(%rax,%rdx,4), %rax
+	LONG $0x6ef961c4; BYTE $0xc8               // vmovq	%rax, %xmm9
+
+BB0_20:
+	LONG $0x0ff98348             // cmpq	$15, %rcx
+	JLE  BB0_38
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x000010b8; BYTE $0x00 // movl	$16, %eax
+
+BB0_23:
+	QUAD $0xff816c10487cd162 // vmovups	-64(%r9,%rax,4), %zmm5
+	QUAD $0xff8644b84855f262 // vfmadd231ps	-64(%rsi,%rax,4), %zmm5, %zmm0
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x3948; BYTE $0xc8 // cmpq	%rcx, %rax
+	JLE  BB0_23
+	QUAD $0x000000b024948b48 // movq	176(%rsp), %rdx
+
+BB0_22:
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f4c5                           // vaddps	%ymm0, %ymm1, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc128f8c5                           // vmovaps	%xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_24
+	WORD $0x8949; BYTE $0xc8                   // movq	%rcx, %r8
+	WORD $0x8949; BYTE $0xd6                   // movq	%rdx, %r14
+	WORD $0x2949; BYTE $0xd0                   // subq	%rdx, %r8
+	LONG $0xff408d49                           // leaq	-1(%r8), %rax
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_39
+	LONG $0x13048d49                           // leaq	(%r11,%rdx), %rax
+	WORD $0x894d; BYTE $0xc7                   // movq	%r8, %r15
+	LONG $0x87248d4c                           // leaq	(%rdi,%rax,4), %r12
+	LONG $0x04efc149                           // shrq	$4, %r15
+	LONG $0x12048d4a                           // leaq	(%rdx,%r10), %rax
+	LONG $0x832c8d4c                           // leaq	(%rbx,%rax,4), %r13
+	LONG $0x06e7c149                           // salq	$6, %r15
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_26:
+	QUAD $0x00056c10487cd162                   // vmovups	0(%r13,%rax), %zmm5
+	LONG $0x4854d162; WORD $0x1459; BYTE $0x04 // vmulps	(%r12,%rax), %zmm5, %zmm2
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0xcac6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xe2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm4
+	LONG $0x286df362; WORD $0xda03; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm3
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xc215e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x286df362; WORD $0xca03; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm1
+	LONG $0xe058dac5                           // vaddss	%xmm0, %xmm4, %xmm4
+	LONG $0x287df362; WORD $0xd019; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0x286df362; WORD $0xc203; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xd11b; BYTE $0x01 // vextractf32x8	$0x1, %zmm2, %ymm1
+	LONG $0xe9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm5
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm0
+	LONG $0xd358f2c5                           // vaddss	%xmm3, %xmm1, %xmm2
+	LONG $0xea58d2c5                           // vaddss	%xmm2, %xmm5, %xmm5
+	LONG $0xd115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm2
+	LONG $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG $0xc058eac5                           // vaddss	%xmm0, %xmm2, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x2875f362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm0
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JNE  BB0_26
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x0fc0f641                           // testb	$15, %r8b
+	JE   BB0_24
+
+BB0_25:
+	WORD $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG $0xff788d4d                           // leaq	-1(%r8), %r15
+	LONG $0x06ff8349                           // cmpq	$6, %r15
+	JBE  BB0_29
+	LONG $0x023c8d4d                           // leaq	(%r10,%rax), %r15
+	WORD $0x014c; BYTE $0xd8                   // addq	%r11, %rax
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	WORD $0x014d; BYTE $0xf7                   // addq	%r14, %r15
+	LONG $0x0c10fcc5; BYTE $0x87               // vmovups	(%rdi,%rax,4), %ymm1
+	LONG $0x5974a1c4; WORD $0xbb0c             // vmulps	(%rbx,%r15,4), %ymm1, %ymm1
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x07e08341                           // andl	$7, %r8d
+	LONG $0xc058f2c5                           // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xe9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm5
+	LONG $0xd1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0xe858d2c5                           // vaddss	%xmm0, %xmm5, %xmm5
+	LONG $0xc115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xc819; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x2875f362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm0
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_24
+
+BB0_29:
+	LONG $0x12048d49               // leaq	(%r10,%rdx), %rax
+	LONG $0x13048d4d               // leaq	(%r11,%rdx), %r8
+	LONG $0x107aa1c4; WORD $0x872c // vmovss	(%rdi,%r8,4), %xmm5
+	LONG $0xb951e2c4; WORD $0x8304 // vfmadd231ss	(%rbx,%rax,4), %xmm5, %xmm0
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3948; BYTE $0xc8       // cmpq	%rcx, %rax
+	JGE  BB0_24
+	LONG $0x18048d4e               // leaq	(%rax,%r11), %r8
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+	LONG $0x107aa1c4; WORD $0x872c // vmovss	(%rdi,%r8,4), %xmm5
+	LONG $0xb951e2c4; WORD $0x8304 // vfmadd231ss	(%rbx,%rax,4), %xmm5, %xmm0
+	LONG $0x02428d48               // leaq	2(%rdx), %rax
+	WORD $0x3948; BYTE $0xc8       // cmpq	%rcx, %rax
+	JGE  BB0_24
+	LONG $0x18048d4e               // leaq	(%rax,%r11), %r8
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+	LONG $0x107aa1c4; WORD $0x872c // vmovss	(%rdi,%r8,4), %xmm5
+	LONG $0xb951e2c4; WORD $0x8304 // vfmadd231ss	(%rbx,%rax,4), %xmm5, %xmm0
+	LONG $0x03428d48               // leaq	3(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_24
+	LONG $0x02048d4d               // leaq	(%r10,%rax), %r8
+	WORD $0x014c; BYTE $0xd8       // addq	%r11, %rax
+	LONG $0x107aa1c4; WORD $0x832c // vmovss	(%rbx,%r8,4), %xmm5
+	LONG $0xb951e2c4; WORD $0x8704 // vfmadd231ss	(%rdi,%rax,4), %xmm5, %xmm0
+	LONG $0x04428d48               // leaq	4(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_24
+	LONG $0x02048d4d               // leaq	(%r10,%rax), %r8
+	WORD $0x014c; BYTE $0xd8       // addq	%r11, %rax
+	LONG $0x107aa1c4; WORD $0x832c // vmovss	(%rbx,%r8,4), %xmm5
+	LONG $0xb951e2c4; WORD $0x8704 // vfmadd231ss	(%rdi,%rax,4), %xmm5, %xmm0
+	LONG $0x05428d48               // leaq	5(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_24
+	LONG $0x02048d4d               // leaq	(%r10,%rax), %r8
+	LONG $0x06c28348               // addq	$6, %rdx
+	WORD $0x014c; BYTE $0xd8       // addq	%r11, %rax
+	LONG $0x107aa1c4; WORD $0x832c // vmovss	(%rbx,%r8,4), %xmm5
+	LONG $0xb951e2c4; WORD $0x8704 // vfmadd231ss	(%rdi,%rax,4), %xmm5, %xmm0
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_24
+	LONG $0x12048d49               // leaq	(%r10,%rdx), %rax
+	WORD $0x014c; BYTE $0xda       // addq	%r11, %rdx
+	LONG $0x2c10fac5; BYTE $0x83   // vmovss	(%rbx,%rax,4), %xmm5
+	LONG $0xb951e2c4; WORD $0x9704 // vfmadd231ss	(%rdi,%rdx,4), %xmm5, %xmm0
+
+BB0_24:
+	LONG $0x7ef9e1c4; BYTE $0xf8 // vmovq	%xmm7, %rax
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_31
+	QUAD $0x000000b824848b48     // movq	184(%rsp), %rax
+	LONG $0x7ef9e1c4; BYTE $0xfa // vmovq	%xmm7, %rdx
+	LONG $0x0458fac5; BYTE $0x82 // vaddss	(%rdx,%rax,4), %xmm0, %xmm0
+	LONG $0x7ef961c4; BYTE $0xca // vmovq	%xmm9, %rdx
+
+BB0_61:
+	LONG $0x0411fac5; BYTE $0x82         // vmovss	%xmm0, (%rdx,%rax,4)
+	LONG $0x01c08348                     // addq	$1, %rax
+	LONG $0x7ef9e1c4; BYTE $0xf2         // vmovq	%xmm6, %rdx
+	WORD $0x0149; BYTE $0xca             // addq	%rcx, %r10
+	QUAD $0x000000b824848948             // movq	%rax, 184(%rsp)
+	WORD $0x0148; BYTE $0xd6             // addq	%rdx, %rsi
+	LONG $0x24443948; BYTE $0x60         // cmpq	%rax, 96(%rsp)
+	JNE  BB0_20
+	QUAD $0x000000a824848348; BYTE $0x01 // addq	$1, 168(%rsp)
+	LONG $0x24748b48; BYTE $0x60         // movq	96(%rsp), %rsi
+	WORD $0x0149; BYTE $0xcb             // addq	%rcx, %r11
+	WORD $0x0149; BYTE $0xd1             // addq	%rdx, %r9
+	QUAD $0x000000a024b40148             // addq	%rsi, 160(%rsp)
+	QUAD $0x000000a824848b48             // movq	168(%rsp), %rax
+	QUAD $0x0000009824843948             // cmpq	%rax, 152(%rsp)
+	JNE  BB0_34
+
+BB0_58:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x10a58d48; WORD $0xffff; BYTE $0xff // leaq	-240(%rbp), %rsp
+	RET
+
+BB0_14:
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	WORD $0x0149; BYTE $0xcd       // addq	%rcx, %r13
+	LONG $0x117aa1c4; WORD $0xb024 // vmovss	%xmm4, (%rax,%r14,4)
+	LONG $0x7ef961c4; BYTE $0xe8   // vmovq	%xmm13, %rax
+	LONG $0x117aa1c4; WORD $0xb01c // vmovss	%xmm3, (%rax,%r14,4)
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0xb014 // vmovss	%xmm2, (%rax,%r14,4)
+	LONG $0x7ef961c4; BYTE $0xe0   // vmovq	%xmm12, %rax
+	LONG $0x117aa1c4; WORD $0xb004 // vmovss	%xmm0, (%rax,%r14,4)
+	LONG $0x7ef961c4; BYTE $0xd8   // vmovq	%xmm11, %rax
+	LONG $0x01c68349               // addq	$1, %r14
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x2474394c; BYTE $0x60   // cmpq	%r14, 96(%rsp)
+	JE   BB0_60
+	LONG $0x0ff98348               // cmpq	$15, %rcx
+	JG   BB0_64
+
+BB0_36:
+	LONG $0xd257e9c5               // vxorpd	%xmm2, %xmm2, %xmm2
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x48fdf162; WORD $0xca28 // vmovapd	%zmm2, %zmm1
+	LONG $0x48fdf162; WORD $0xc228 // vmovapd	%zmm2, %zmm0
+	LONG $0x48fdf162; WORD $0xf228 // vmovapd	%zmm2, %zmm6
+	JMP  BB0_5
+
+BB0_31:
+	QUAD $0x000000b824848b48     // movq	184(%rsp), %rax
+	LONG $0x7ef961c4; BYTE $0xca // vmovq	%xmm9, %rdx
+	JMP  BB0_61
+
+BB0_37:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_8
+
+BB0_38:
+	LONG $0xc057f9c5 // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0xd231     // xorl	%edx, %edx
+	JMP  BB0_22
+
+BB0_39:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_25
+
+BB0_35:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_2
@@ -0,0 +1,515 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basedense_c_f64_avx2_amd64.c
+
+TEXT ·dense_c_f64_avx2(SB), $304-88
+	MOVQ x+0(FP), DI
+	MOVQ weight+8(FP), SI
+	MOVQ bias+16(FP), DX
+	MOVQ output+24(FP), CX
+	MOVQ pbatchSize+32(FP), R8
+	MOVQ pinFeatures+40(FP), R9
+	MOVQ poutFeatures+48(FP), R11
+	MOVQ R11, 256(SP)
+	MOVQ plen_x+56(FP), R11
+	MOVQ R11, 264(SP)
+	MOVQ plen_weight+64(FP), R11
+	MOVQ R11, 272(SP)
+	MOVQ plen_bias+72(FP), R11
+	MOVQ R11, 280(SP)
+	MOVQ plen_output+80(FP), R11
+	MOVQ R11, 288(SP)
+	QUAD $0x000000f024ac8d48                   // leaq	240(%rsp), %rbp
+	WORD $0x8949; BYTE $0xfc                   // movq	%rdi, %r12
+	WORD $0x8948; BYTE $0xcf                   // movq	%rcx, %rdi
+	WORD $0x8948; BYTE $0xf3                   // movq	%rsi, %rbx
+	LONG $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348                           // andq	$-32, %rsp
+	LONG $0x10458b48                           // movq	16(%rbp), %rax
+	WORD $0x8b4d; BYTE $0x39                   // movq	(%r9), %r15
+	LONG $0x240c8948                           // movq	%rcx, (%rsp)
+	WORD $0x8b49; BYTE $0x08                   // movq	(%r8), %rcx
+	WORD $0x8b48; BYTE $0x00                   // movq	(%rax), %rax
+	LONG $0x24548948; BYTE $0x68               // movq	%rdx, 104(%rsp)
+	LONG $0x244c8948; BYTE $0x28               // movq	%rcx, 40(%rsp)
+	LONG $0x24448948; BYTE $0x70               // movq	%rax, 112(%rsp)
+	LONG $0x03f98348                           // cmpq	$3, %rcx
+	JLE  BB0_35
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	LONG $0x247c8948; BYTE $0x58               // movq	%rdi, 88(%rsp)
+	QUAD $0x00000000bd148d4a                   // leaq	0(,%r15,4), %rdx
+	LONG $0x0003b941; WORD $0x0000             // movl	$3, %r9d
+	LONG $0x05e1c148                           // salq	$5, %rcx
+	QUAD $0x000000c824bc894c                   // movq	%r15, 200(%rsp)
+	WORD $0x894d; BYTE $0xe2                   // movq	%r12, %r10
+	LONG $0x244c8948; BYTE $0x18               // movq	%rcx, 24(%rsp)
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	LONG $0x04e0c148                           // salq	$4, %rax
+	WORD $0x0148; BYTE $0xf8                   // addq	%rdi, %rax
+	LONG $0x3f3c8d4b                           // leaq	(%r15,%r15), %rdi
+	LONG $0x244c894c; BYTE $0x30               // movq	%r9, 48(%rsp)
+	QUAD $0x00000000cd348d48                   // leaq	0(,%rcx,8), %rsi
+	LONG $0x24448948; BYTE $0x60               // movq	%rax, 96(%rsp)
+	WORD $0x894c; BYTE $0xf8                   // movq	%r15, %rax
+	LONG $0x05e0c148                           // salq	$5, %rax
+	QUAD $0x000000d024bc8948                   // movq	%rdi, 208(%rsp)
+	WORD $0x014c; BYTE $0xff                   // addq	%r15, %rdi
+	LONG $0x24448948; BYTE $0x20               // movq	%rax, 32(%rsp)
+	QUAD $0x00000000fd048d4a                   // leaq	0(,%r15,8), %rax
+	LONG $0x04348d4d                           // leaq	(%r12,%rax), %r14
+	LONG $0x24448948; BYTE $0x40               // movq	%rax, 64(%rsp)
+	LONG $0x061c8d4d                           // leaq	(%r14,%rax), %r11
+	QUAD $0x000000d824bc8948                   // movq	%rdi, 216(%rsp)
+	LONG $0x032c8d4d                           // leaq	(%r11,%rax), %r13
+	LONG $0xfc478d49                           // leaq	-4(%r15), %rax
+	QUAD $0x000000c02484c748; LONG $0x00000000 // movq	$0, 192(%rsp)
+	LONG $0x02e8c148                           // shrq	$2, %rax
+	LONG $0x24748948; BYTE $0x08               // movq	%rsi, 8(%rsp)
+	QUAD $0x0000000485048d48                   // leaq	4(,%rax,4), %rax
+	LONG $0x24548948; BYTE $0x10               // movq	%rdx, 16(%rsp)
+	LONG $0x24448948; BYTE $0x38               // movq	%rax, 56(%rsp)
+	QUAD $0x000000b8249c8948                   // movq	%rbx, 184(%rsp)
+	WORD $0x894c; BYTE $0xeb                   // movq	%r13, %rbx
+	WORD $0x894d; BYTE $0xf5                   // movq	%r14, %r13
+
+BB0_4:
+	LONG $0x247c8348; WORD $0x0070 // cmpq	$0, 112(%rsp)
+	JLE  BB0_16
+	LONG $0x24448b48; BYTE $0x08   // movq	8(%rsp), %rax
+	LONG $0x247c8b48; BYTE $0x58   // movq	88(%rsp), %rdi
+	WORD $0x3145; BYTE $0xc9       // xorl	%r9d, %r9d
+	WORD $0x8949; BYTE $0xde       // movq	%rbx, %r14
+	QUAD $0x000000b8248c8b48       // movq	184(%rsp), %rcx
+	WORD $0x0148; BYTE $0xc7       // addq	%rax, %rdi
+	LONG $0x247c8948; BYTE $0x50   // movq	%rdi, 80(%rsp)
+	LONG $0x247c8b48; BYTE $0x60   // movq	96(%rsp), %rdi
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+	WORD $0xff31                   // xorl	%edi, %edi
+	LONG $0x24448948; BYTE $0x48   // movq	%rax, 72(%rsp)
+	WORD $0x894c; BYTE $0xd0       // movq	%r10, %rax
+	WORD $0x8949; BYTE $0xfa       // movq	%rdi, %r10
+	QUAD $0x000000b024848948       // movq	%rax, 176(%rsp)
+
+BB0_17:
+	LONG $0x03ff8349 // cmpq	$3, %r15
+	JLE  BB0_36
+
+BB0_69:
+	LONG $0xe457d9c5             // vxorpd	%xmm4, %xmm4, %xmm4
+	QUAD $0x000000b024bc8b48     // movq	176(%rsp), %rdi
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+	LONG $0xec28fdc5             // vmovapd	%ymm4, %ymm5
+	LONG $0xcc28fdc5             // vmovapd	%ymm4, %ymm1
+	LONG $0xd428fdc5             // vmovapd	%ymm4, %ymm2
+
+BB0_6:
+	LONG $0x4410fdc5; WORD $0xe0c1             // vmovupd	-32(%rcx,%rax,8), %ymm0
+	LONG $0xb8fde2c4; WORD $0xc754; BYTE $0xe0 // vfmadd231pd	-32(%rdi,%rax,8), %ymm0, %ymm2
+	LONG $0xb8fdc2c4; WORD $0xc54c; BYTE $0xe0 // vfmadd231pd	-32(%r13,%rax,8), %ymm0, %ymm1
+	LONG $0xb8fdc2c4; WORD $0xc36c; BYTE $0xe0 // vfmadd231pd	-32(%r11,%rax,8), %ymm0, %ymm5
+	LONG $0xb8fdc2c4; WORD $0xc664; BYTE $0xe0 // vfmadd231pd	-32(%r14,%rax,8), %ymm0, %ymm4
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_6
+	QUAD $0x000000b024bc8948                   // movq	%rdi, 176(%rsp)
+	LONG $0x24448b48; BYTE $0x38               // movq	56(%rsp), %rax
+
+BB0_5:
+	LONG $0x197de3c4; WORD $0x01d3 // vextractf128	$0x1, %ymm2, %xmm3
+	LONG $0xda58e1c5               // vaddpd	%xmm2, %xmm3, %xmm3
+	LONG $0x197de3c4; WORD $0x01ca // vextractf128	$0x1, %ymm1, %xmm2
+	LONG $0xd158e9c5               // vaddpd	%xmm1, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01e9 // vextractf128	$0x1, %ymm5, %xmm1
+	LONG $0xcd58f1c5               // vaddpd	%xmm5, %xmm1, %xmm1
+	LONG $0x197de3c4; WORD $0x01e5 // vextractf128	$0x1, %ymm4, %xmm5
+	LONG $0xc315e1c5               // vunpckhpd	%xmm3, %xmm3, %xmm0
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc215e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm0
+	LONG $0xd058ebc5               // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm0
+	LONG $0xc858f3c5               // vaddsd	%xmm0, %xmm1, %xmm1
+	LONG $0xc558d9c5               // vaddpd	%xmm5, %xmm4, %xmm0
+	LONG $0xe015f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm4
+	LONG $0xc458fbc5               // vaddsd	%xmm4, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_7
+	WORD $0x894c; BYTE $0xfe       // movq	%r15, %rsi
+	QUAD $0x000000a024848948       // movq	%rax, 160(%rsp)
+	WORD $0x2948; BYTE $0xc6       // subq	%rax, %rsi
+	LONG $0xff568d48               // leaq	-1(%rsi), %rdx
+	QUAD $0x000000a824b48948       // movq	%rsi, 168(%rsp)
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_37
+	QUAD $0x000000c024bc8b48       // movq	192(%rsp), %rdi
+	QUAD $0x000000b8249c8b48       // movq	184(%rsp), %rbx
+	QUAD $0x00000088248c894c       // movq	%r9, 136(%rsp)
+	LONG $0x02eec148               // shrq	$2, %rsi
+	QUAD $0x000000d024848b4c       // movq	208(%rsp), %r8
+	QUAD $0x000000802494894c       // movq	%r10, 128(%rsp)
+	LONG $0x05e6c148               // salq	$5, %rsi
+	LONG $0x07148d48               // leaq	(%rdi,%rax), %rdx
+	LONG $0x244c8948; BYTE $0x78   // movq	%rcx, 120(%rsp)
+	LONG $0xd43c8d49               // leaq	(%r12,%rdx,8), %rdi
+	LONG $0x02148d49               // leaq	(%r10,%rax), %rdx
+	LONG $0xd31c8d48               // leaq	(%rbx,%rdx,8), %rbx
+	QUAD $0x000000c824948b48       // movq	200(%rsp), %rdx
+	WORD $0x8949; BYTE $0xfa       // movq	%rdi, %r10
+	QUAD $0x000000b024bc8b48       // movq	176(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0xd4148d49               // leaq	(%r12,%rdx,8), %rdx
+	QUAD $0x0000009024948948       // movq	%rdx, 144(%rsp)
+	LONG $0x00148d4a               // leaq	(%rax,%r8), %rdx
+	QUAD $0x00000090248c8b4c       // movq	144(%rsp), %r9
+	LONG $0xd4048d4d               // leaq	(%r12,%rdx,8), %r8
+	QUAD $0x000000d824948b48       // movq	216(%rsp), %rdx
+	QUAD $0x000000982484894c       // movq	%r8, 152(%rsp)
+	QUAD $0x00000098248c8b48       // movq	152(%rsp), %rcx
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0xd4048d4d               // leaq	(%r12,%rdx,8), %r8
+	WORD $0xd231                   // xorl	%edx, %edx
+
+BB0_9:
+	LONG $0x2410fdc5; BYTE $0x13   // vmovupd	(%rbx,%rdx), %ymm4
+	LONG $0x595dc1c4; WORD $0x122c // vmulpd	(%r10,%rdx), %ymm4, %ymm5
+	LONG $0xdd58e3c5               // vaddsd	%xmm5, %xmm3, %xmm3
+	LONG $0xf515d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm6
+	LONG $0x197de3c4; WORD $0x01ed // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xf358cbc5               // vaddsd	%xmm3, %xmm6, %xmm6
+	LONG $0xde58d3c5               // vaddsd	%xmm6, %xmm5, %xmm3
+	LONG $0xed15d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xdd58e3c5               // vaddsd	%xmm5, %xmm3, %xmm3
+	LONG $0x595dc1c4; WORD $0x112c // vmulpd	(%r9,%rdx), %ymm4, %ymm5
+	LONG $0xd558ebc5               // vaddsd	%xmm5, %xmm2, %xmm2
+	LONG $0xf515d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm6
+	LONG $0x197de3c4; WORD $0x01ed // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xf258cbc5               // vaddsd	%xmm2, %xmm6, %xmm6
+	LONG $0xd658d3c5               // vaddsd	%xmm6, %xmm5, %xmm2
+	LONG $0xed15d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xd558ebc5               // vaddsd	%xmm5, %xmm2, %xmm2
+	LONG $0x2c59ddc5; BYTE $0x11   // vmulpd	(%rcx,%rdx), %ymm4, %ymm5
+	LONG $0x595dc1c4; WORD $0x1024 // vmulpd	(%r8,%rdx), %ymm4, %ymm4
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xcd58f3c5               // vaddsd	%xmm5, %xmm1, %xmm1
+	LONG $0xf515d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm6
+	LONG $0x197de3c4; WORD $0x01ed // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xc458fbc5               // vaddsd	%xmm4, %xmm0, %xmm0
+	LONG $0xf158cbc5               // vaddsd	%xmm1, %xmm6, %xmm6
+	LONG $0xce58d3c5               // vaddsd	%xmm6, %xmm5, %xmm1
+	LONG $0xed15d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xcd58f3c5               // vaddsd	%xmm5, %xmm1, %xmm1
+	LONG $0xec15d9c5               // vunpckhpd	%xmm4, %xmm4, %xmm5
+	LONG $0x197de3c4; WORD $0x01e4 // vextractf128	$0x1, %ymm4, %xmm4
+	LONG $0xe858d3c5               // vaddsd	%xmm0, %xmm5, %xmm5
+	LONG $0xc558dbc5               // vaddsd	%xmm5, %xmm4, %xmm0
+	LONG $0xe415d9c5               // vunpckhpd	%xmm4, %xmm4, %xmm4
+	LONG $0xc458fbc5               // vaddsd	%xmm4, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd6       // cmpq	%rdx, %rsi
+	JNE  BB0_9
+	QUAD $0x000000a824b48b48       // movq	168(%rsp), %rsi
+	QUAD $0x000000b024bc8948       // movq	%rdi, 176(%rsp)
+	QUAD $0x00000088248c8b4c       // movq	136(%rsp), %r9
+	QUAD $0x0000008024948b4c       // movq	128(%rsp), %r10
+	LONG $0x244c8b48; BYTE $0x78   // movq	120(%rsp), %rcx
+	LONG $0x03c6f640               // testb	$3, %sil
+	JE   BB0_7
+	WORD $0x8948; BYTE $0xf2       // movq	%rsi, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+
+BB0_8:
+	WORD $0x2948; BYTE $0xd6       // subq	%rdx, %rsi
+	LONG $0x01fe8348               // cmpq	$1, %rsi
+	JE   BB0_12
+	QUAD $0x000000a0249c8b48       // movq	160(%rsp), %rbx
+	QUAD $0x000000b824bc8b48       // movq	184(%rsp), %rdi
+	LONG $0x12048d4d               // leaq	(%r10,%rdx), %r8
+	WORD $0x0149; BYTE $0xd8       // addq	%rbx, %r8
+	LONG $0x1079a1c4; WORD $0xc724 // vmovupd	(%rdi,%r8,8), %xmm4
+	QUAD $0x000000c024bc8b48       // movq	192(%rsp), %rdi
+	LONG $0x3a048d4c               // leaq	(%rdx,%rdi), %r8
+	QUAD $0x000000c824bc8b48       // movq	200(%rsp), %rdi
+	WORD $0x0149; BYTE $0xd8       // addq	%rbx, %r8
+	LONG $0x595981c4; WORD $0xc42c // vmulpd	(%r12,%r8,8), %xmm4, %xmm5
+	LONG $0x3a048d4c               // leaq	(%rdx,%rdi), %r8
+	QUAD $0x000000d024bc8b48       // movq	208(%rsp), %rdi
+	WORD $0x0149; BYTE $0xd8       // addq	%rbx, %r8
+	LONG $0xdb58d3c5               // vaddsd	%xmm3, %xmm5, %xmm3
+	LONG $0xed15d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xdb58d3c5               // vaddsd	%xmm3, %xmm5, %xmm3
+	LONG $0x595981c4; WORD $0xc42c // vmulpd	(%r12,%r8,8), %xmm4, %xmm5
+	LONG $0x17048d4c               // leaq	(%rdi,%rdx), %r8
+	QUAD $0x000000d824bc8b48       // movq	216(%rsp), %rdi
+	WORD $0x0149; BYTE $0xd8       // addq	%rbx, %r8
+	WORD $0x0148; BYTE $0xfa       // addq	%rdi, %rdx
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0xd258d3c5               // vaddsd	%xmm2, %xmm5, %xmm2
+	LONG $0xed15d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xd258d3c5               // vaddsd	%xmm2, %xmm5, %xmm2
+	LONG $0x595981c4; WORD $0xc42c // vmulpd	(%r12,%r8,8), %xmm4, %xmm5
+	LONG $0x5959c1c4; WORD $0xd424 // vmulpd	(%r12,%rdx,8), %xmm4, %xmm4
+	LONG $0xc958d3c5               // vaddsd	%xmm1, %xmm5, %xmm1
+	LONG $0xed15d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xc058dbc5               // vaddsd	%xmm0, %xmm4, %xmm0
+	LONG $0xe415d9c5               // vunpckhpd	%xmm4, %xmm4, %xmm4
+	LONG $0xc958d3c5               // vaddsd	%xmm1, %xmm5, %xmm1
+	LONG $0xc058dbc5               // vaddsd	%xmm0, %xmm4, %xmm0
+	LONG $0x01c6f640               // testb	$1, %sil
+	JE   BB0_7
+	LONG $0xfee68348               // andq	$-2, %rsi
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+
+BB0_12:
+	QUAD $0x000000b8249c8b48       // movq	184(%rsp), %rbx
+	LONG $0x02148d49               // leaq	(%r10,%rax), %rdx
+	QUAD $0x000000c024b48b48       // movq	192(%rsp), %rsi
+	LONG $0x2410fbc5; BYTE $0xd3   // vmovsd	(%rbx,%rdx,8), %xmm4
+	QUAD $0x000000c8249c8b48       // movq	200(%rsp), %rbx
+	LONG $0x06148d48               // leaq	(%rsi,%rax), %rdx
+	LONG $0xb9d9c2c4; WORD $0xd41c // vfmadd231sd	(%r12,%rdx,8), %xmm4, %xmm3
+	QUAD $0x000000d024b48b48       // movq	208(%rsp), %rsi
+	LONG $0x03148d48               // leaq	(%rbx,%rax), %rdx
+	QUAD $0x000000d8249c8b48       // movq	216(%rsp), %rbx
+	LONG $0xb9d9c2c4; WORD $0xd414 // vfmadd231sd	(%r12,%rdx,8), %xmm4, %xmm2
+	LONG $0x06148d48               // leaq	(%rsi,%rax), %rdx
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	LONG $0xb9d9c2c4; WORD $0xd40c // vfmadd231sd	(%r12,%rdx,8), %xmm4, %xmm1
+	LONG $0xb9d9c2c4; WORD $0xc404 // vfmadd231sd	(%r12,%rax,8), %xmm4, %xmm0
+
+BB0_7:
+	LONG $0x24448b48; BYTE $0x68   // movq	104(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_14
+	LONG $0x107ba1c4; WORD $0xc824 // vmovsd	(%rax,%r9,8), %xmm4
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	WORD $0x014d; BYTE $0xfa       // addq	%r15, %r10
+	LONG $0xdb58dbc5               // vaddsd	%xmm3, %xmm4, %xmm3
+	LONG $0xd258dbc5               // vaddsd	%xmm2, %xmm4, %xmm2
+	LONG $0xc958dbc5               // vaddsd	%xmm1, %xmm4, %xmm1
+	LONG $0xc058dbc5               // vaddsd	%xmm0, %xmm4, %xmm0
+	LONG $0x117ba1c4; WORD $0xc81c // vmovsd	%xmm3, (%rax,%r9,8)
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xc814 // vmovsd	%xmm2, (%rax,%r9,8)
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xc80c // vmovsd	%xmm1, (%rax,%r9,8)
+	LONG $0x24448b48; BYTE $0x48   // movq	72(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xc804 // vmovsd	%xmm0, (%rax,%r9,8)
+	LONG $0x24448b48; BYTE $0x40   // movq	64(%rsp), %rax
+	LONG $0x01c18349               // addq	$1, %r9
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0x24448b48; BYTE $0x70   // movq	112(%rsp), %rax
+	WORD $0x3949; BYTE $0xc1       // cmpq	%rax, %r9
+	JNE  BB0_17
+
+BB0_66:
+	QUAD $0x000000b024948b4c // movq	176(%rsp), %r10
+	WORD $0x894c; BYTE $0xf3 // movq	%r14, %rbx
+
+BB0_16:
+	LONG $0x244c8b48; BYTE $0x18   // movq	24(%rsp), %rcx
+	LONG $0x244c0148; BYTE $0x58   // addq	%rcx, 88(%rsp)
+	LONG $0x244c0148; BYTE $0x60   // addq	%rcx, 96(%rsp)
+	LONG $0x244c8b48; BYTE $0x20   // movq	32(%rsp), %rcx
+	LONG $0x24448b48; BYTE $0x10   // movq	16(%rsp), %rax
+	LONG $0x24448348; WORD $0x0430 // addq	$4, 48(%rsp)
+	QUAD $0x000000c024840148       // addq	%rax, 192(%rsp)
+	LONG $0x247c8b48; BYTE $0x30   // movq	48(%rsp), %rdi
+	WORD $0x0149; BYTE $0xca       // addq	%rcx, %r10
+	WORD $0x0149; BYTE $0xcd       // addq	%rcx, %r13
+	QUAD $0x000000c824840148       // addq	%rax, 200(%rsp)
+	WORD $0x0149; BYTE $0xcb       // addq	%rcx, %r11
+	WORD $0x0148; BYTE $0xcb       // addq	%rcx, %rbx
+	QUAD $0x000000d024840148       // addq	%rax, 208(%rsp)
+	QUAD $0x000000d824840148       // addq	%rax, 216(%rsp)
+	LONG $0x247c3948; BYTE $0x28   // cmpq	%rdi, 40(%rsp)
+	JG   BB0_4
+	LONG $0x24448b48; BYTE $0x28   // movq	40(%rsp), %rax
+	QUAD $0x000000b8249c8b48       // movq	184(%rsp), %rbx
+	LONG $0x04e88348               // subq	$4, %rax
+	LONG $0x02e8c148               // shrq	$2, %rax
+	QUAD $0x0000000485148d48       // leaq	4(,%rax,4), %rdx
+
+BB0_2:
+	LONG $0x24543948; BYTE $0x28 // cmpq	%rdx, 40(%rsp)
+	JLE  BB0_64
+	LONG $0x24448b48; BYTE $0x70 // movq	112(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JLE  BB0_64
+	LONG $0xc2af0f48             // imulq	%rdx, %rax
+	WORD $0x894d; BYTE $0xfe     // movq	%r15, %r14
+	QUAD $0x000000b824948948     // movq	%rdx, 184(%rsp)
+	LONG $0xf2af0f4c             // imulq	%rdx, %r14
+	WORD $0x8948; BYTE $0xc6     // movq	%rax, %rsi
+	QUAD $0x00000000fd048d4a     // leaq	0(,%r15,8), %rax
+	QUAD $0x000000d024848948     // movq	%rax, 208(%rsp)
+	LONG $0xfc478d49             // leaq	-4(%r15), %rax
+	LONG $0xf4048d4f             // leaq	(%r12,%r14,8), %r8
+	LONG $0x02e8c148             // shrq	$2, %rax
+	QUAD $0x000000b024b48948     // movq	%rsi, 176(%rsp)
+	QUAD $0x0000000485048d48     // leaq	4(,%rax,4), %rax
+	QUAD $0x000000c024848948     // movq	%rax, 192(%rsp)
+
+BB0_34:
+	QUAD $0x000000b024bc8b48 // movq	176(%rsp), %rdi
+	LONG $0x24048b48         // movq	(%rsp), %rax
+	WORD $0x8948; BYTE $0xd9 // movq	%rbx, %rcx
+	WORD $0x3145; BYTE $0xed // xorl	%r13d, %r13d
+	LONG $0xf8048d48         // leaq	(%rax,%rdi,8), %rax
+	WORD $0xff31             // xorl	%edi, %edi
+	QUAD $0x000000c824848948 // movq	%rax, 200(%rsp)
+
+BB0_20:
+	LONG $0x03ff8349             // cmpq	$3, %r15
+	JLE  BB0_38
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+
+BB0_23:
+	LONG $0x107dc1c4; WORD $0xc07c; BYTE $0xe0 // vmovupd	-32(%r8,%rax,8), %ymm7
+	LONG $0xb8c5e2c4; WORD $0xc14c; BYTE $0xe0 // vfmadd231pd	-32(%rcx,%rax,8), %ymm7, %ymm1
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_23
+	QUAD $0x000000c024848b48                   // movq	192(%rsp), %rax
+
+BB0_22:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_24
+	WORD $0x894c; BYTE $0xfe       // movq	%r15, %rsi
+	QUAD $0x000000d824848948       // movq	%rax, 216(%rsp)
+	WORD $0x2948; BYTE $0xc6       // subq	%rax, %rsi
+	LONG $0xff568d48               // leaq	-1(%rsi), %rdx
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_39
+	LONG $0x06148d49               // leaq	(%r14,%rax), %rdx
+	WORD $0x8949; BYTE $0xf1       // movq	%rsi, %r9
+	LONG $0xd41c8d4d               // leaq	(%r12,%rdx,8), %r11
+	LONG $0x02e9c149               // shrq	$2, %r9
+	LONG $0x07148d48               // leaq	(%rdi,%rax), %rdx
+	LONG $0xd3148d4c               // leaq	(%rbx,%rdx,8), %r10
+	LONG $0x05e1c149               // salq	$5, %r9
+	WORD $0xd231                   // xorl	%edx, %edx
+
+BB0_26:
+	LONG $0x107dc1c4; WORD $0x123c // vmovupd	(%r10,%rdx), %ymm7
+	LONG $0x5945c1c4; WORD $0x1314 // vmulpd	(%r11,%rdx), %ymm7, %ymm2
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xc258fbc5               // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xda15e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm3
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f3c5               // vaddsd	%xmm3, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xca       // cmpq	%r9, %rdx
+	JNE  BB0_26
+	LONG $0x03c6f640               // testb	$3, %sil
+	JE   BB0_24
+	WORD $0x8948; BYTE $0xf2       // movq	%rsi, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+
+BB0_25:
+	WORD $0x2948; BYTE $0xd6       // subq	%rdx, %rsi
+	LONG $0x01fe8348               // cmpq	$1, %rsi
+	JE   BB0_29
+	QUAD $0x000000d8249c8b4c       // movq	216(%rsp), %r11
+	LONG $0x170c8d4c               // leaq	(%rdi,%rdx), %r9
+	WORD $0x014c; BYTE $0xf2       // addq	%r14, %rdx
+	WORD $0x014d; BYTE $0xd9       // addq	%r11, %r9
+	WORD $0x014c; BYTE $0xda       // addq	%r11, %rdx
+	LONG $0x1079c1c4; WORD $0xd40c // vmovupd	(%r12,%rdx,8), %xmm1
+	LONG $0x5971a1c4; WORD $0xcb0c // vmulpd	(%rbx,%r9,8), %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0x01c6f640               // testb	$1, %sil
+	JE   BB0_24
+	LONG $0xfee68348               // andq	$-2, %rsi
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+
+BB0_29:
+	LONG $0x07148d48               // leaq	(%rdi,%rax), %rdx
+	WORD $0x014c; BYTE $0xf0       // addq	%r14, %rax
+	LONG $0x3c10fbc5; BYTE $0xd3   // vmovsd	(%rbx,%rdx,8), %xmm7
+	LONG $0xb9c1c2c4; WORD $0xc404 // vfmadd231sd	(%r12,%rax,8), %xmm7, %xmm0
+
+BB0_24:
+	LONG $0x24448b48; BYTE $0x68   // movq	104(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_31
+	LONG $0x587ba1c4; WORD $0xe804 // vaddsd	(%rax,%r13,8), %xmm0, %xmm0
+
+BB0_31:
+	QUAD $0x000000c824848b48             // movq	200(%rsp), %rax
+	WORD $0x014c; BYTE $0xff             // addq	%r15, %rdi
+	LONG $0x117ba1c4; WORD $0xe804       // vmovsd	%xmm0, (%rax,%r13,8)
+	QUAD $0x000000d024848b48             // movq	208(%rsp), %rax
+	LONG $0x01c58349                     // addq	$1, %r13
+	WORD $0x0148; BYTE $0xc1             // addq	%rax, %rcx
+	LONG $0x246c394c; BYTE $0x70         // cmpq	%r13, 112(%rsp)
+	JNE  BB0_20
+	QUAD $0x000000d0248c8b48             // movq	208(%rsp), %rcx
+	LONG $0x247c8b48; BYTE $0x70         // movq	112(%rsp), %rdi
+	WORD $0x014d; BYTE $0xfe             // addq	%r15, %r14
+	QUAD $0x000000b824848348; BYTE $0x01 // addq	$1, 184(%rsp)
+	QUAD $0x000000b824848b48             // movq	184(%rsp), %rax
+	QUAD $0x000000b024bc0148             // addq	%rdi, 176(%rsp)
+	WORD $0x0149; BYTE $0xc8             // addq	%rcx, %r8
+	LONG $0x24443948; BYTE $0x28         // cmpq	%rax, 40(%rsp)
+	JNE  BB0_34
+
+BB0_64:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x10a58d48; WORD $0xffff; BYTE $0xff // leaq	-240(%rbp), %rsp
+	RET
+
+BB0_14:
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	WORD $0x014d; BYTE $0xfa       // addq	%r15, %r10
+	LONG $0x117ba1c4; WORD $0xc81c // vmovsd	%xmm3, (%rax,%r9,8)
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xc814 // vmovsd	%xmm2, (%rax,%r9,8)
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xc80c // vmovsd	%xmm1, (%rax,%r9,8)
+	LONG $0x24448b48; BYTE $0x48   // movq	72(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xc804 // vmovsd	%xmm0, (%rax,%r9,8)
+	LONG $0x24448b48; BYTE $0x40   // movq	64(%rsp), %rax
+	LONG $0x01c18349               // addq	$1, %r9
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0x244c394c; BYTE $0x70   // cmpq	%r9, 112(%rsp)
+	JE   BB0_66
+	LONG $0x03ff8349               // cmpq	$3, %r15
+	JG   BB0_69
+
+BB0_36:
+	LONG $0xe457d9c5 // vxorpd	%xmm4, %xmm4, %xmm4
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xec28fdc5 // vmovapd	%ymm4, %ymm5
+	LONG $0xcc28fdc5 // vmovapd	%ymm4, %ymm1
+	LONG $0xd428fdc5 // vmovapd	%ymm4, %ymm2
+	JMP  BB0_5
+
+BB0_37:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_8
+
+BB0_38:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	JMP  BB0_22
+
+BB0_39:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_25
+
+BB0_35:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_2
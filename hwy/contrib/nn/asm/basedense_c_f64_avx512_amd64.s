@@ -0,0 +1,642 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basedense_c_f64_avx512_amd64.c
+
+TEXT ·dense_c_f64_avx512(SB), $304-88
+	MOVQ x+0(FP), DI
+	MOVQ weight+8(FP), SI
+	MOVQ bias+16(FP), DX
+	MOVQ output+24(FP), CX
+	MOVQ pbatchSize+32(FP), R8
+	MOVQ pinFeatures+40(FP), R9
+	MOVQ poutFeatures+48(FP), R11
+	MOVQ R11, 256(SP)
+	MOVQ plen_x+56(FP), R11
+	MOVQ R11, 264(SP)
+	MOVQ plen_weight+64(FP), R11
+	MOVQ R11, 272(SP)
+	MOVQ plen_bias+72(FP), R11
+	MOVQ R11, 280(SP)
+	MOVQ plen_output+80(FP), R11
+	MOVQ R11, 288(SP)
+	LONG $0x6ef9e1c4; BYTE $0xea               // vmovq	%rdx, %xmm5
+	QUAD $0x000000f024ac8d48                   // leaq	240(%rsp), %rbp
+	WORD $0x8949; BYTE $0xcd                   // movq	%rcx, %r13
+	LONG $0x24648d48; BYTE $0x40               // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348                           // andq	$-64, %rsp
+	LONG $0x10458b48                           // movq	16(%rbp), %rax
+	WORD $0x8b4d; BYTE $0x30                   // movq	(%r8), %r14
+	QUAD $0x000000b824b48948                   // movq	%rsi, 184(%rsp)
+	WORD $0x8b49; BYTE $0x09                   // movq	(%r9), %rcx
+	WORD $0x8b48; BYTE $0x00                   // movq	(%rax), %rax
+	LONG $0x24448948; BYTE $0x60               // movq	%rax, 96(%rsp)
+	LONG $0x03fe8349                           // cmpq	$3, %r14
+	JLE  BB0_35
+	WORD $0x8948; BYTE $0xc6                   // movq	%rax, %rsi
+	QUAD $0x00000000cd148d48                   // leaq	0(,%rcx,8), %rdx
+	WORD $0x8948; BYTE $0xfb                   // movq	%rdi, %rbx
+	LONG $0x0003b841; WORD $0x0000             // movl	$3, %r8d
+	LONG $0x05e6c148                           // salq	$5, %rsi
+	LONG $0x6ef961c4; BYTE $0xea               // vmovq	%rdx, %xmm13
+	LONG $0x17148d4c                           // leaq	(%rdi,%rdx), %r10
+	LONG $0x246c894c; BYTE $0x58               // movq	%r13, 88(%rsp)
+	WORD $0x8949; BYTE $0xf7                   // movq	%rsi, %r15
+	WORD $0x8948; BYTE $0xc6                   // movq	%rax, %rsi
+	LONG $0x04e0c148                           // salq	$4, %rax
+	LONG $0x09148d48                           // leaq	(%rcx,%rcx), %rdx
+	WORD $0x014c; BYTE $0xe8                   // addq	%r13, %rax
+	QUAD $0x000000b024948948                   // movq	%rdx, 176(%rsp)
+	WORD $0x0148; BYTE $0xca                   // addq	%rcx, %rdx
+	LONG $0x7ef941c4; BYTE $0xeb               // vmovq	%xmm13, %r11
+	LONG $0x24448948; BYTE $0x50               // movq	%rax, 80(%rsp)
+	LONG $0x1a0c8d4f                           // leaq	(%r10,%r11), %r9
+	QUAD $0x000000008d048d48                   // leaq	0(,%rcx,4), %rax
+	LONG $0xf56f79c5                           // vmovdqa	%xmm5, %xmm14
+	LONG $0x6ef9e1c4; BYTE $0xc0               // vmovq	%rax, %xmm0
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	QUAD $0x000000a824948948                   // movq	%rdx, 168(%rsp)
+	LONG $0xf8518d48                           // leaq	-8(%rcx), %rdx
+	LONG $0x05e0c148                           // salq	$5, %rax
+	LONG $0x03eac148                           // shrq	$3, %rdx
+	QUAD $0x00000088248c8948                   // movq	%rcx, 136(%rsp)
+	LONG $0x191c8d4f                           // leaq	(%r9,%r11), %r11
+	QUAD $0x00000008d5148d48                   // leaq	8(,%rdx,8), %rdx
+	LONG $0x2474894c; BYTE $0x38               // movq	%r14, 56(%rsp)
+	LONG $0xe06f79c5                           // vmovdqa	%xmm0, %xmm12
+	QUAD $0x000000902484c748; LONG $0x00000000 // movq	$0, 144(%rsp)
+	LONG $0x2444894c; BYTE $0x40               // movq	%r8, 64(%rsp)
+	LONG $0x247c894c; BYTE $0x30               // movq	%r15, 48(%rsp)
+	LONG $0x24448948; BYTE $0x28               // movq	%rax, 40(%rsp)
+	LONG $0x246c894c; BYTE $0x20               // movq	%r13, 32(%rsp)
+	LONG $0x24548948; BYTE $0x48               // movq	%rdx, 72(%rsp)
+	QUAD $0x00000000f5148d48                   // leaq	0(,%rsi,8), %rdx
+	LONG $0x6ef961c4; BYTE $0xd2               // vmovq	%rdx, %xmm10
+
+BB0_4:
+	LONG $0x247c8348; WORD $0x0060 // cmpq	$0, 96(%rsp)
+	JLE  BB0_16
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	WORD $0x3145; BYTE $0xf6       // xorl	%r14d, %r14d
+	WORD $0x3145; BYTE $0xed       // xorl	%r13d, %r13d
+	LONG $0x7ef961c4; BYTE $0xd6   // vmovq	%xmm10, %rsi
+	QUAD $0x000000a0248c894c       // movq	%r9, 160(%rsp)
+	QUAD $0x000000b824848b4c       // movq	184(%rsp), %r8
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0x08fde162; WORD $0xc86e // vmovq	%rax, %xmm17
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0x08fde162; WORD $0xc06e // vmovq	%rax, %xmm16
+
+BB0_17:
+	LONG $0x07f98348 // cmpq	$7, %rcx
+	JLE  BB0_36
+
+BB0_63:
+	LONG $0xe457d9c5               // vxorpd	%xmm4, %xmm4, %xmm4
+	QUAD $0x000000a0248c8b4c       // movq	160(%rsp), %r9
+	LONG $0x000008b8; BYTE $0x00   // movl	$8, %eax
+	LONG $0x48fdf162; WORD $0xcc28 // vmovapd	%zmm4, %zmm1
+	LONG $0x48fdf162; WORD $0xd428 // vmovapd	%zmm4, %zmm2
+	LONG $0x48fdf162; WORD $0xdc28 // vmovapd	%zmm4, %zmm3
+
+BB0_6:
+	QUAD $0xffc0441048fdd162     // vmovupd	-64(%r8,%rax,8), %zmm0
+	QUAD $0xffc35cb848fdf262     // vfmadd231pd	-64(%rbx,%rax,8), %zmm0, %zmm3
+	QUAD $0xffc254b848fdd262     // vfmadd231pd	-64(%r10,%rax,8), %zmm0, %zmm2
+	QUAD $0xffc14cb848fdd262     // vfmadd231pd	-64(%r9,%rax,8), %zmm0, %zmm1
+	QUAD $0xffc364b848fdd262     // vfmadd231pd	-64(%r11,%rax,8), %zmm0, %zmm4
+	LONG $0x08c08348             // addq	$8, %rax
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JLE  BB0_6
+	QUAD $0x000000a0248c894c     // movq	%r9, 160(%rsp)
+	LONG $0x24548b48; BYTE $0x48 // movq	72(%rsp), %rdx
+
+BB0_5:
+	LONG $0x48fdf362; WORD $0xde1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm3, %ymm6
+	LONG $0xdb58cdc5                           // vaddpd	%ymm3, %ymm6, %ymm3
+	LONG $0x28fdf362; WORD $0xde19; BYTE $0x01 // vextractf64x2	$0x1, %ymm3, %xmm6
+	LONG $0xf358c9c5                           // vaddpd	%xmm3, %xmm6, %xmm6
+	LONG $0xde10cbc5                           // vmovsd	%xmm6, %xmm6, %xmm3
+	LONG $0xf615c9c5                           // vunpckhpd	%xmm6, %xmm6, %xmm6
+	LONG $0xde58e3c5                           // vaddsd	%xmm6, %xmm3, %xmm3
+	LONG $0x48fdf362; WORD $0xd61b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm6
+	LONG $0xd258cdc5                           // vaddpd	%ymm2, %ymm6, %ymm2
+	LONG $0x28fdf362; WORD $0xd619; BYTE $0x01 // vextractf64x2	$0x1, %ymm2, %xmm6
+	LONG $0xf258c9c5                           // vaddpd	%xmm2, %xmm6, %xmm6
+	LONG $0xd610cbc5                           // vmovsd	%xmm6, %xmm6, %xmm2
+	LONG $0xf615c9c5                           // vunpckhpd	%xmm6, %xmm6, %xmm6
+	LONG $0xd658ebc5                           // vaddsd	%xmm6, %xmm2, %xmm2
+	LONG $0x48fdf362; WORD $0xce1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm6
+	LONG $0xc958cdc5                           // vaddpd	%ymm1, %ymm6, %ymm1
+	LONG $0x28fdf362; WORD $0xce19; BYTE $0x01 // vextractf64x2	$0x1, %ymm1, %xmm6
+	LONG $0xf158c9c5                           // vaddpd	%xmm1, %xmm6, %xmm6
+	LONG $0xce10cbc5                           // vmovsd	%xmm6, %xmm6, %xmm1
+	LONG $0xf615c9c5                           // vunpckhpd	%xmm6, %xmm6, %xmm6
+	LONG $0xce58f3c5                           // vaddsd	%xmm6, %xmm1, %xmm1
+	LONG $0x48fdf362; WORD $0xe61b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm6
+	LONG $0xe658ddc5                           // vaddpd	%ymm6, %ymm4, %ymm4
+	LONG $0x28fdf362; WORD $0xe619; BYTE $0x01 // vextractf64x2	$0x1, %ymm4, %xmm6
+	LONG $0xf458c9c5                           // vaddpd	%xmm4, %xmm6, %xmm6
+	LONG $0xe610cbc5                           // vmovsd	%xmm6, %xmm6, %xmm4
+	LONG $0xf615c9c5                           // vunpckhpd	%xmm6, %xmm6, %xmm6
+	LONG $0xe658dbc5                           // vaddsd	%xmm6, %xmm4, %xmm4
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_7
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	QUAD $0x0000008024948948                   // movq	%rdx, 128(%rsp)
+	WORD $0x2948; BYTE $0xd0                   // subq	%rdx, %rax
+	QUAD $0x0000009824848948                   // movq	%rax, 152(%rsp)
+	LONG $0x01e88348                           // subq	$1, %rax
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_37
+	QUAD $0x0000009024b48b48                   // movq	144(%rsp), %rsi
+	QUAD $0x00000088248c8b4c                   // movq	136(%rsp), %r9
+	LONG $0x24548948; BYTE $0x70               // movq	%rdx, 112(%rsp)
+	LONG $0x244c8948; BYTE $0x78               // movq	%rcx, 120(%rsp)
+	LONG $0x32048d48                           // leaq	(%rdx,%rsi), %rax
+	LONG $0x247c8948; BYTE $0x68               // movq	%rdi, 104(%rsp)
+	LONG $0xc7348d48                           // leaq	(%rdi,%rax,8), %rsi
+	LONG $0x32048d4a                           // leaq	(%rdx,%r14), %rax
+	LONG $0x08fde162; WORD $0xd66e             // vmovq	%rsi, %xmm18
+	QUAD $0x000000b824b48b48                   // movq	184(%rsp), %rsi
+	LONG $0xc6348d48                           // leaq	(%rsi,%rax,8), %rsi
+	LONG $0x0a048d4a                           // leaq	(%rdx,%r9), %rax
+	QUAD $0x000000b0248c8b4c                   // movq	176(%rsp), %r9
+	LONG $0xc73c8d4c                           // leaq	(%rdi,%rax,8), %r15
+	WORD $0x8948; BYTE $0xf1                   // movq	%rsi, %rcx
+	LONG $0x6ef9c1c4; BYTE $0xff               // vmovq	%r15, %xmm7
+	QUAD $0x000000a824bc8b4c                   // movq	168(%rsp), %r15
+	LONG $0x0a048d4a                           // leaq	(%rdx,%r9), %rax
+	LONG $0xc7248d4c                           // leaq	(%rdi,%rax,8), %r12
+	LONG $0x7ef9e1c4; BYTE $0xfe               // vmovq	%xmm7, %rsi
+	LONG $0x3a048d4a                           // leaq	(%rdx,%r15), %rax
+	LONG $0xc73c8d4c                           // leaq	(%rdi,%rax,8), %r15
+	QUAD $0x0000009824848b48                   // movq	152(%rsp), %rax
+	LONG $0x08fde162; WORD $0xd77e             // vmovq	%xmm18, %rdi
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	WORD $0x8949; BYTE $0xc1                   // movq	%rax, %r9
+	WORD $0xc031                               // xorl	%eax, %eax
+	WORD $0x894c; BYTE $0xca                   // movq	%r9, %rdx
+	QUAD $0x000000a0248c8b4c                   // movq	160(%rsp), %r9
+
+BB0_9:
+	LONG $0x48fdf162; WORD $0x0410; BYTE $0x01 // vmovupd	(%rcx,%rax), %zmm0
+	LONG $0x48fdf162; WORD $0x2c59; BYTE $0x07 // vmulpd	(%rdi,%rax), %zmm0, %zmm5
+	LONG $0x28d5f362; WORD $0xf503; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm6
+	LONG $0xdd58e3c5                           // vaddsd	%xmm5, %xmm3, %xmm3
+	LONG $0xfd1551c5                           // vunpckhpd	%xmm5, %xmm5, %xmm15
+	LONG $0xfb5803c5                           // vaddsd	%xmm3, %xmm15, %xmm15
+	LONG $0x28fdf362; WORD $0xeb19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm3
+	LONG $0x48fdf362; WORD $0xed1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm5
+	LONG $0x5863c1c4; BYTE $0xdf               // vaddsd	%xmm15, %xmm3, %xmm3
+	LONG $0xf358cbc5                           // vaddsd	%xmm3, %xmm6, %xmm6
+	LONG $0xdd15d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm3
+	LONG $0xf658d3c5                           // vaddsd	%xmm6, %xmm5, %xmm6
+	LONG $0xde58e3c5                           // vaddsd	%xmm6, %xmm3, %xmm3
+	LONG $0x28fdf362; WORD $0xee19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm6
+	LONG $0x28d5f362; WORD $0xed03; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm5
+	LONG $0xdb58cbc5                           // vaddsd	%xmm3, %xmm6, %xmm3
+	LONG $0xdd58e3c5                           // vaddsd	%xmm5, %xmm3, %xmm3
+	LONG $0x48fdf162; WORD $0x2c59; BYTE $0x06 // vmulpd	(%rsi,%rax), %zmm0, %zmm5
+	LONG $0x28d5f362; WORD $0xf503; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm6
+	LONG $0xd558ebc5                           // vaddsd	%xmm5, %xmm2, %xmm2
+	LONG $0xfd1551c5                           // vunpckhpd	%xmm5, %xmm5, %xmm15
+	LONG $0xfa5803c5                           // vaddsd	%xmm2, %xmm15, %xmm15
+	LONG $0x28fdf362; WORD $0xea19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm2
+	LONG $0x48fdf362; WORD $0xed1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm5
+	LONG $0x586bc1c4; BYTE $0xd7               // vaddsd	%xmm15, %xmm2, %xmm2
+	LONG $0xf258cbc5                           // vaddsd	%xmm2, %xmm6, %xmm6
+	LONG $0xd515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm2
+	LONG $0xf658d3c5                           // vaddsd	%xmm6, %xmm5, %xmm6
+	LONG $0xd658ebc5                           // vaddsd	%xmm6, %xmm2, %xmm2
+	LONG $0x28fdf362; WORD $0xee19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm6
+	LONG $0x28d5f362; WORD $0xed03; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm5
+	LONG $0xd258cbc5                           // vaddsd	%xmm2, %xmm6, %xmm2
+	LONG $0xd558ebc5                           // vaddsd	%xmm5, %xmm2, %xmm2
+	LONG $0x48fdd162; WORD $0x2c59; BYTE $0x04 // vmulpd	(%r12,%rax), %zmm0, %zmm5
+	LONG $0x48fdd162; WORD $0x0459; BYTE $0x07 // vmulpd	(%r15,%rax), %zmm0, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x28d5f362; WORD $0xf503; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm6
+	LONG $0xcd58f3c5                           // vaddsd	%xmm5, %xmm1, %xmm1
+	LONG $0xfd1551c5                           // vunpckhpd	%xmm5, %xmm5, %xmm15
+	LONG $0xe458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm4
+	LONG $0xf95803c5                           // vaddsd	%xmm1, %xmm15, %xmm15
+	LONG $0x28fdf362; WORD $0xe919; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm1
+	LONG $0x48fdf362; WORD $0xed1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm5
+	LONG $0x5873c1c4; BYTE $0xcf               // vaddsd	%xmm15, %xmm1, %xmm1
+	LONG $0xf158cbc5                           // vaddsd	%xmm1, %xmm6, %xmm6
+	LONG $0xcd15d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm1
+	LONG $0xf658d3c5                           // vaddsd	%xmm6, %xmm5, %xmm6
+	LONG $0xce58f3c5                           // vaddsd	%xmm6, %xmm1, %xmm1
+	LONG $0x28fdf362; WORD $0xee19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm6
+	LONG $0x28d5f362; WORD $0xed03; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm5
+	LONG $0xc958cbc5                           // vaddsd	%xmm1, %xmm6, %xmm1
+	LONG $0xf015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm6
+	LONG $0xf458cbc5                           // vaddsd	%xmm4, %xmm6, %xmm6
+	LONG $0x28fdf362; WORD $0xc419; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm4
+	LONG $0xcd58f3c5                           // vaddsd	%xmm5, %xmm1, %xmm1
+	LONG $0x28fdf362; WORD $0xe803; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm5
+	LONG $0x48fdf362; WORD $0xc01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm0
+	LONG $0xe658dbc5                           // vaddsd	%xmm6, %xmm4, %xmm4
+	LONG $0xec58d3c5                           // vaddsd	%xmm4, %xmm5, %xmm5
+	LONG $0xe015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm4
+	LONG $0xf558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm6
+	LONG $0xe658dbc5                           // vaddsd	%xmm6, %xmm4, %xmm4
+	LONG $0x28fdf362; WORD $0xc619; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm6
+	LONG $0x28fdf362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm0
+	LONG $0xe458cbc5                           // vaddsd	%xmm4, %xmm6, %xmm4
+	LONG $0xe058dbc5                           // vaddsd	%xmm0, %xmm4, %xmm4
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JNE  BB0_9
+	QUAD $0x0000009824b48b48                   // movq	152(%rsp), %rsi
+	LONG $0x24548b48; BYTE $0x70               // movq	112(%rsp), %rdx
+	QUAD $0x000000a0248c894c                   // movq	%r9, 160(%rsp)
+	LONG $0x244c8b48; BYTE $0x78               // movq	120(%rsp), %rcx
+	LONG $0x247c8b48; BYTE $0x68               // movq	104(%rsp), %rdi
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x07                   // andl	$7, %esi
+	JE   BB0_7
+
+BB0_8:
+	QUAD $0x0000009824b48b48                   // movq	152(%rsp), %rsi
+	WORD $0x2948; BYTE $0xc6                   // subq	%rax, %rsi
+	LONG $0xff668d4c                           // leaq	-1(%rsi), %r12
+	LONG $0x02fc8349                           // cmpq	$2, %r12
+	JBE  BB0_12
+	QUAD $0x0000008024bc8b4c                   // movq	128(%rsp), %r15
+	QUAD $0x000000b8248c8b4c                   // movq	184(%rsp), %r9
+	LONG $0x06248d4d                           // leaq	(%r14,%rax), %r12
+	WORD $0x014d; BYTE $0xfc                   // addq	%r15, %r12
+	WORD $0x014c; BYTE $0xf8                   // addq	%r15, %rax
+	QUAD $0x0000008824bc8b4c                   // movq	136(%rsp), %r15
+	LONG $0x107d81c4; WORD $0xe134             // vmovupd	(%r9,%r12,8), %ymm6
+	QUAD $0x00000090248c8b4c                   // movq	144(%rsp), %r9
+	LONG $0x08248d4e                           // leaq	(%rax,%r9), %r12
+	QUAD $0x000000b0248c8b4c                   // movq	176(%rsp), %r9
+	LONG $0x594d21c4; WORD $0xe704             // vmulpd	(%rdi,%r12,8), %ymm6, %ymm8
+	LONG $0x38248d4e                           // leaq	(%rax,%r15), %r12
+	QUAD $0x000000a824bc8b4c                   // movq	168(%rsp), %r15
+	LONG $0x28fd7362; WORD $0xc719; BYTE $0x01 // vextractf64x2	$1, %ymm8, %xmm7
+	LONG $0x5863c1c4; BYTE $0xd8               // vaddsd	%xmm8, %xmm3, %xmm3
+	LONG $0x153941c4; BYTE $0xc8               // vunpckhpd	%xmm8, %xmm8, %xmm9
+	LONG $0x28bd5362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm8, %ymm8, %ymm8
+	LONG $0x5863c1c4; BYTE $0xd9               // vaddsd	%xmm9, %xmm3, %xmm3
+	LONG $0xdf58e3c5                           // vaddsd	%xmm7, %xmm3, %xmm3
+	LONG $0x5863c1c4; BYTE $0xd8               // vaddsd	%xmm8, %xmm3, %xmm3
+	LONG $0x594d21c4; WORD $0xe704             // vmulpd	(%rdi,%r12,8), %ymm6, %ymm8
+	LONG $0x08248d4e                           // leaq	(%rax,%r9), %r12
+	WORD $0x014c; BYTE $0xf8                   // addq	%r15, %rax
+	LONG $0x28fd7362; WORD $0xc719; BYTE $0x01 // vextractf64x2	$1, %ymm8, %xmm7
+	LONG $0x586bc1c4; BYTE $0xd0               // vaddsd	%xmm8, %xmm2, %xmm2
+	LONG $0x153941c4; BYTE $0xc8               // vunpckhpd	%xmm8, %xmm8, %xmm9
+	LONG $0x28bd5362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm8, %ymm8, %ymm8
+	LONG $0x586bc1c4; BYTE $0xd1               // vaddsd	%xmm9, %xmm2, %xmm2
+	LONG $0xd758ebc5                           // vaddsd	%xmm7, %xmm2, %xmm2
+	LONG $0x586bc1c4; BYTE $0xd0               // vaddsd	%xmm8, %xmm2, %xmm2
+	LONG $0x594d21c4; WORD $0xe704             // vmulpd	(%rdi,%r12,8), %ymm6, %ymm8
+	LONG $0x3459cdc5; BYTE $0xc7               // vmulpd	(%rdi,%rax,8), %ymm6, %ymm6
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xfce08348                           // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x03                   // andl	$3, %esi
+	LONG $0x28fd7362; WORD $0xc719; BYTE $0x01 // vextractf64x2	$1, %ymm8, %xmm7
+	LONG $0x5873c1c4; BYTE $0xc8               // vaddsd	%xmm8, %xmm1, %xmm1
+	LONG $0x153941c4; BYTE $0xc8               // vunpckhpd	%xmm8, %xmm8, %xmm9
+	LONG $0x28bd5362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm8, %ymm8, %ymm8
+	LONG $0xe658dbc5                           // vaddsd	%xmm6, %xmm4, %xmm4
+	LONG $0x5873c1c4; BYTE $0xc9               // vaddsd	%xmm9, %xmm1, %xmm1
+	LONG $0xcf58f3c5                           // vaddsd	%xmm7, %xmm1, %xmm1
+	LONG $0x28fdf362; WORD $0xf719; BYTE $0x01 // vextractf64x2	$1, %ymm6, %xmm7
+	LONG $0x5873c1c4; BYTE $0xc8               // vaddsd	%xmm8, %xmm1, %xmm1
+	LONG $0xc61549c5                           // vunpckhpd	%xmm6, %xmm6, %xmm8
+	LONG $0x28cdf362; WORD $0xf603; BYTE $0x03 // valignq	$3, %ymm6, %ymm6, %ymm6
+	LONG $0x585bc1c4; BYTE $0xe0               // vaddsd	%xmm8, %xmm4, %xmm4
+	LONG $0xe758dbc5                           // vaddsd	%xmm7, %xmm4, %xmm4
+	LONG $0xe658dbc5                           // vaddsd	%xmm6, %xmm4, %xmm4
+	JE   BB0_7
+
+BB0_12:
+	QUAD $0x000000b8248c8b4c       // movq	184(%rsp), %r9
+	QUAD $0x0000009024bc8b4c       // movq	144(%rsp), %r15
+	LONG $0x16048d49               // leaq	(%r14,%rdx), %rax
+	QUAD $0x0000008824a48b4c       // movq	136(%rsp), %r12
+	QUAD $0x000000a824b48b48       // movq	168(%rsp), %rsi
+	LONG $0x107bc1c4; WORD $0xc104 // vmovsd	(%r9,%rax,8), %xmm0
+	LONG $0x17048d49               // leaq	(%r15,%rdx), %rax
+	LONG $0xb9f9e2c4; WORD $0xc71c // vfmadd231sd	(%rdi,%rax,8), %xmm0, %xmm3
+	LONG $0x14048d49               // leaq	(%r12,%rdx), %rax
+	LONG $0xb9f9e2c4; WORD $0xc714 // vfmadd231sd	(%rdi,%rax,8), %xmm0, %xmm2
+	QUAD $0x000000b024848b48       // movq	176(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb9f9e2c4; WORD $0xc70c // vfmadd231sd	(%rdi,%rax,8), %xmm0, %xmm1
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	LONG $0xb9f9e2c4; WORD $0xc724 // vfmadd231sd	(%rdi,%rax,8), %xmm0, %xmm4
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_7
+	LONG $0x06348d49               // leaq	(%r14,%rax), %rsi
+	LONG $0x02c28348               // addq	$2, %rdx
+	LONG $0x107bc1c4; WORD $0xf104 // vmovsd	(%r9,%rsi,8), %xmm0
+	LONG $0x07348d49               // leaq	(%r15,%rax), %rsi
+	LONG $0xb9f9e2c4; WORD $0xf71c // vfmadd231sd	(%rdi,%rsi,8), %xmm0, %xmm3
+	LONG $0x04348d49               // leaq	(%r12,%rax), %rsi
+	LONG $0xb9f9e2c4; WORD $0xf714 // vfmadd231sd	(%rdi,%rsi,8), %xmm0, %xmm2
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb9f9e2c4; WORD $0xf70c // vfmadd231sd	(%rdi,%rsi,8), %xmm0, %xmm1
+	QUAD $0x000000a824b48b48       // movq	168(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0xb9f9e2c4; WORD $0xc724 // vfmadd231sd	(%rdi,%rax,8), %xmm0, %xmm4
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_7
+	LONG $0x16048d49               // leaq	(%r14,%rdx), %rax
+	QUAD $0x000000b024b48b48       // movq	176(%rsp), %rsi
+	LONG $0x107bc1c4; WORD $0xc104 // vmovsd	(%r9,%rax,8), %xmm0
+	LONG $0x17048d49               // leaq	(%r15,%rdx), %rax
+	LONG $0xb9f9e2c4; WORD $0xc71c // vfmadd231sd	(%rdi,%rax,8), %xmm0, %xmm3
+	LONG $0x14048d49               // leaq	(%r12,%rdx), %rax
+	LONG $0xb9f9e2c4; WORD $0xc714 // vfmadd231sd	(%rdi,%rax,8), %xmm0, %xmm2
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	QUAD $0x000000a824b48b48       // movq	168(%rsp), %rsi
+	LONG $0xb9f9e2c4; WORD $0xc70c // vfmadd231sd	(%rdi,%rax,8), %xmm0, %xmm1
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+	LONG $0xb9f9e2c4; WORD $0xd724 // vfmadd231sd	(%rdi,%rdx,8), %xmm0, %xmm4
+
+BB0_7:
+	LONG $0x7ef961c4; BYTE $0xf0   // vmovq	%xmm14, %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_14
+	LONG $0x107ba1c4; WORD $0xe834 // vmovsd	(%rax,%r13,8), %xmm6
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	WORD $0x0149; BYTE $0xce       // addq	%rcx, %r14
+	LONG $0xdb58cbc5               // vaddsd	%xmm3, %xmm6, %xmm3
+	LONG $0xd258cbc5               // vaddsd	%xmm2, %xmm6, %xmm2
+	LONG $0xc958cbc5               // vaddsd	%xmm1, %xmm6, %xmm1
+	LONG $0xe458cbc5               // vaddsd	%xmm4, %xmm6, %xmm4
+	LONG $0x117ba1c4; WORD $0xe81c // vmovsd	%xmm3, (%rax,%r13,8)
+	LONG $0x08fde162; WORD $0xc87e // vmovq	%xmm17, %rax
+	LONG $0x117ba1c4; WORD $0xe814 // vmovsd	%xmm2, (%rax,%r13,8)
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xe80c // vmovsd	%xmm1, (%rax,%r13,8)
+	LONG $0x08fde162; WORD $0xc07e // vmovq	%xmm16, %rax
+	LONG $0x117ba1c4; WORD $0xe824 // vmovsd	%xmm4, (%rax,%r13,8)
+	LONG $0x7ef961c4; BYTE $0xe8   // vmovq	%xmm13, %rax
+	LONG $0x01c58349               // addq	$1, %r13
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x24448b48; BYTE $0x60   // movq	96(%rsp), %rax
+	WORD $0x3949; BYTE $0xc5       // cmpq	%rax, %r13
+	JNE  BB0_17
+
+BB0_60:
+	QUAD $0x000000a0248c8b4c // movq	160(%rsp), %r9
+
+BB0_16:
+	LONG $0x24748b48; BYTE $0x30   // movq	48(%rsp), %rsi
+	LONG $0x24740148; BYTE $0x58   // addq	%rsi, 88(%rsp)
+	LONG $0x7ef961c4; BYTE $0xe0   // vmovq	%xmm12, %rax
+	LONG $0x24740148; BYTE $0x50   // addq	%rsi, 80(%rsp)
+	LONG $0x24748b48; BYTE $0x28   // movq	40(%rsp), %rsi
+	LONG $0x24448348; WORD $0x0440 // addq	$4, 64(%rsp)
+	LONG $0x24548b48; BYTE $0x40   // movq	64(%rsp), %rdx
+	QUAD $0x0000009024840148       // addq	%rax, 144(%rsp)
+	WORD $0x0148; BYTE $0xf3       // addq	%rsi, %rbx
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	QUAD $0x0000008824840148       // addq	%rax, 136(%rsp)
+	WORD $0x0149; BYTE $0xf3       // addq	%rsi, %r11
+	QUAD $0x000000b024840148       // addq	%rax, 176(%rsp)
+	QUAD $0x000000a824840148       // addq	%rax, 168(%rsp)
+	LONG $0x24543948; BYTE $0x38   // cmpq	%rdx, 56(%rsp)
+	JG   BB0_4
+	LONG $0x24748b4c; BYTE $0x38   // movq	56(%rsp), %r14
+	LONG $0x246c8b4c; BYTE $0x20   // movq	32(%rsp), %r13
+	LONG $0xf57f79c5               // vmovdqa	%xmm14, %xmm5
+	LONG $0xfc468d49               // leaq	-4(%r14), %rax
+	LONG $0x02e8c148               // shrq	$2, %rax
+	QUAD $0x0000000485048d48       // leaq	4(,%rax,4), %rax
+
+BB0_2:
+	WORD $0x3949; BYTE $0xc6     // cmpq	%rax, %r14
+	JLE  BB0_58
+	LONG $0x245c8b48; BYTE $0x60 // movq	96(%rsp), %rbx
+	WORD $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE  BB0_58
+	LONG $0xd8af0f48             // imulq	%rax, %rbx
+	LONG $0xf8518d48             // leaq	-8(%rcx), %rdx
+	QUAD $0x0000009824b4894c     // movq	%r14, 152(%rsp)
+	LONG $0xfd6ff9c5             // vmovdqa	%xmm5, %xmm7
+	QUAD $0x00000000cd348d48     // leaq	0(,%rcx,8), %rsi
+	LONG $0x03eac148             // shrq	$3, %rdx
+	QUAD $0x000000a824848948     // movq	%rax, 168(%rsp)
+	LONG $0x6ef9e1c4; BYTE $0xd6 // vmovq	%rsi, %xmm2
+	QUAD $0x00000008d5348d48     // leaq	8(,%rdx,8), %rsi
+	QUAD $0x0000009024ac894c     // movq	%r13, 144(%rsp)
+	WORD $0x8949; BYTE $0xd8     // movq	%rbx, %r8
+	WORD $0x8948; BYTE $0xcb     // movq	%rcx, %rbx
+	QUAD $0x000000b024b48948     // movq	%rsi, 176(%rsp)
+	LONG $0xea6ff9c5             // vmovdqa	%xmm2, %xmm5
+	LONG $0xd8af0f48             // imulq	%rax, %rbx
+	QUAD $0x000000a02484894c     // movq	%r8, 160(%rsp)
+	LONG $0xdf0c8d4c             // leaq	(%rdi,%rbx,8), %r9
+
+BB0_34:
+	QUAD $0x0000009024848b48     // movq	144(%rsp), %rax
+	QUAD $0x000000a024948b48     // movq	160(%rsp), %rdx
+	WORD $0x3145; BYTE $0xd2     // xorl	%r10d, %r10d
+	WORD $0x3145; BYTE $0xdb     // xorl	%r11d, %r11d
+	QUAD $0x000000b824b48b48     // movq	184(%rsp), %rsi
+	LONG $0xd0048d48             // leaq	(%rax,%rdx,8), %rax
+	LONG $0x6ef961c4; BYTE $0xc8 // vmovq	%rax, %xmm9
+
+BB0_20:
+	LONG $0x07f98348             // cmpq	$7, %rcx
+	JLE  BB0_38
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x000008ba; BYTE $0x00 // movl	$8, %edx
+
+BB0_23:
+	QUAD $0xffd15c1048fdd162 // vmovupd	-64(%r9,%rdx,8), %zmm3
+	QUAD $0xffd644b848e5f262 // vfmadd231pd	-64(%rsi,%rdx,8), %zmm3, %zmm0
+	LONG $0x08c28348         // addq	$8, %rdx
+	WORD $0x3948; BYTE $0xca // cmpq	%rcx, %rdx
+	JLE  BB0_23
+	QUAD $0x000000b024848b4c // movq	176(%rsp), %r8
+
+BB0_22:
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f5c5                           // vaddpd	%ymm0, %ymm1, %ymm0
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm1
+	LONG $0xc858f1c5                           // vaddpd	%xmm0, %xmm1, %xmm1
+	LONG $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_24
+	WORD $0x8949; BYTE $0xcc                   // movq	%rcx, %r12
+	WORD $0x894d; BYTE $0xc6                   // movq	%r8, %r14
+	WORD $0x294d; BYTE $0xc4                   // subq	%r8, %r12
+	LONG $0x24548d49; BYTE $0xff               // leaq	-1(%r12), %rdx
+	LONG $0x06fa8348                           // cmpq	$6, %rdx
+	JBE  BB0_39
+	LONG $0x03148d4a                           // leaq	(%rbx,%r8), %rdx
+	QUAD $0x000000b824848b48                   // movq	184(%rsp), %rax
+	WORD $0x894d; BYTE $0xe7                   // movq	%r12, %r15
+	LONG $0xd72c8d4c                           // leaq	(%rdi,%rdx,8), %r13
+	LONG $0x03efc149                           // shrq	$3, %r15
+	LONG $0x10148d4b                           // leaq	(%r8,%r10), %rdx
+	LONG $0xd0048d48                           // leaq	(%rax,%rdx,8), %rax
+	LONG $0x06e7c149                           // salq	$6, %r15
+	WORD $0xd231                               // xorl	%edx, %edx
+
+BB0_26:
+	LONG $0x48fdf162; WORD $0x1410; BYTE $0x10 // vmovupd	(%rax,%rdx), %zmm2
+	QUAD $0x0015545948edd162                   // vmulpd	0(%r13,%rdx), %zmm2, %zmm2
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x28edf362; WORD $0xda03; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm3
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xe215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm4
+	LONG $0x48fdf362; WORD $0xd11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm1
+	LONG $0xe058dbc5                           // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0x28fdf362; WORD $0xd019; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm0
+	LONG $0xc458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm0
+	LONG $0xd858e3c5                           // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm0
+	LONG $0xd358f3c5                           // vaddsd	%xmm3, %xmm1, %xmm2
+	LONG $0xd258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm2
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm0
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xfa                   // cmpq	%r15, %rdx
+	JNE  BB0_26
+	WORD $0x894c; BYTE $0xe2                   // movq	%r12, %rdx
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x07c4f641                           // testb	$7, %r12b
+	JE   BB0_24
+
+BB0_25:
+	WORD $0x2949; BYTE $0xd4                   // subq	%rdx, %r12
+	LONG $0x247c8d4d; BYTE $0xff               // leaq	-1(%r12), %r15
+	LONG $0x02ff8349                           // cmpq	$2, %r15
+	JBE  BB0_29
+	LONG $0x123c8d4d                           // leaq	(%r10,%rdx), %r15
+	QUAD $0x000000b824848b48                   // movq	184(%rsp), %rax
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	WORD $0x014c; BYTE $0xf2                   // addq	%r14, %rdx
+	WORD $0x014d; BYTE $0xf7                   // addq	%r14, %r15
+	LONG $0x0c10fdc5; BYTE $0xd7               // vmovupd	(%rdi,%rdx,8), %ymm1
+	LONG $0x5975a1c4; WORD $0xf80c             // vmulpd	(%rax,%r15,8), %ymm1, %ymm1
+	WORD $0x894c; BYTE $0xe2                   // movq	%r12, %rdx
+	LONG $0xfce28348                           // andq	$-4, %rdx
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x03e48341                           // andl	$3, %r12d
+	LONG $0xc058f3c5                           // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xe115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm4
+	LONG $0xe058dbc5                           // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm0
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	JE   BB0_24
+
+BB0_29:
+	QUAD $0x000000b824848b48       // movq	184(%rsp), %rax
+	LONG $0x02148d4b               // leaq	(%r10,%r8), %rdx
+	LONG $0x03248d4e               // leaq	(%rbx,%r8), %r12
+	LONG $0x107ba1c4; WORD $0xe724 // vmovsd	(%rdi,%r12,8), %xmm4
+	LONG $0xb9d9e2c4; WORD $0xd004 // vfmadd231sd	(%rax,%rdx,8), %xmm4, %xmm0
+	LONG $0x01508d49               // leaq	1(%r8), %rdx
+	WORD $0x3948; BYTE $0xca       // cmpq	%rcx, %rdx
+	JGE  BB0_24
+	LONG $0x1a248d4c               // leaq	(%rdx,%rbx), %r12
+	LONG $0x02c08349               // addq	$2, %r8
+	WORD $0x014c; BYTE $0xd2       // addq	%r10, %rdx
+	LONG $0x107ba1c4; WORD $0xe724 // vmovsd	(%rdi,%r12,8), %xmm4
+	LONG $0xb9d9e2c4; WORD $0xd004 // vfmadd231sd	(%rax,%rdx,8), %xmm4, %xmm0
+	WORD $0x3949; BYTE $0xc8       // cmpq	%rcx, %r8
+	JGE  BB0_24
+	LONG $0x10148d4b               // leaq	(%r8,%r10), %rdx
+	WORD $0x0149; BYTE $0xd8       // addq	%rbx, %r8
+	LONG $0x2410fbc5; BYTE $0xd0   // vmovsd	(%rax,%rdx,8), %xmm4
+	LONG $0xb9d9a2c4; WORD $0xc704 // vfmadd231sd	(%rdi,%r8,8), %xmm4, %xmm0
+
+BB0_24:
+	LONG $0x7ef9e1c4; BYTE $0xf8   // vmovq	%xmm7, %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_31
+	LONG $0x587ba1c4; WORD $0xd804 // vaddsd	(%rax,%r11,8), %xmm0, %xmm0
+
+BB0_31:
+	LONG $0x7ef961c4; BYTE $0xc8         // vmovq	%xmm9, %rax
+	WORD $0x0149; BYTE $0xca             // addq	%rcx, %r10
+	LONG $0x117ba1c4; WORD $0xd804       // vmovsd	%xmm0, (%rax,%r11,8)
+	LONG $0x7ef9e1c4; BYTE $0xe8         // vmovq	%xmm5, %rax
+	LONG $0x01c38349                     // addq	$1, %r11
+	WORD $0x0148; BYTE $0xc6             // addq	%rax, %rsi
+	LONG $0x245c394c; BYTE $0x60         // cmpq	%r11, 96(%rsp)
+	JNE  BB0_20
+	LONG $0x7ef9e1c4; BYTE $0xee         // vmovq	%xmm5, %rsi
+	LONG $0x24548b48; BYTE $0x60         // movq	96(%rsp), %rdx
+	WORD $0x0148; BYTE $0xcb             // addq	%rcx, %rbx
+	QUAD $0x000000a824848348; BYTE $0x01 // addq	$1, 168(%rsp)
+	QUAD $0x000000a024940148             // addq	%rdx, 160(%rsp)
+	QUAD $0x000000a824848b48             // movq	168(%rsp), %rax
+	WORD $0x0149; BYTE $0xf1             // addq	%rsi, %r9
+	QUAD $0x0000009824843948             // cmpq	%rax, 152(%rsp)
+	JNE  BB0_34
+
+BB0_58:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x10a58d48; WORD $0xffff; BYTE $0xff // leaq	-240(%rbp), %rsp
+	RET
+
+BB0_14:
+	LONG $0x24448b48; BYTE $0x58   // movq	88(%rsp), %rax
+	WORD $0x0149; BYTE $0xce       // addq	%rcx, %r14
+	LONG $0x117ba1c4; WORD $0xe81c // vmovsd	%xmm3, (%rax,%r13,8)
+	LONG $0x08fde162; WORD $0xc87e // vmovq	%xmm17, %rax
+	LONG $0x117ba1c4; WORD $0xe814 // vmovsd	%xmm2, (%rax,%r13,8)
+	LONG $0x24448b48; BYTE $0x50   // movq	80(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xe80c // vmovsd	%xmm1, (%rax,%r13,8)
+	LONG $0x08fde162; WORD $0xc07e // vmovq	%xmm16, %rax
+	LONG $0x117ba1c4; WORD $0xe824 // vmovsd	%xmm4, (%rax,%r13,8)
+	LONG $0x7ef961c4; BYTE $0xe8   // vmovq	%xmm13, %rax
+	LONG $0x01c58349               // addq	$1, %r13
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x246c394c; BYTE $0x60   // cmpq	%r13, 96(%rsp)
+	JE   BB0_60
+	LONG $0x07f98348               // cmpq	$7, %rcx
+	JG   BB0_63
+
+BB0_36:
+	LONG $0xe457d9c5               // vxorpd	%xmm4, %xmm4, %xmm4
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x48fdf162; WORD $0xcc28 // vmovapd	%zmm4, %zmm1
+	LONG $0x48fdf162; WORD $0xd428 // vmovapd	%zmm4, %zmm2
+	LONG $0x48fdf162; WORD $0xdc28 // vmovapd	%zmm4, %zmm3
+	JMP  BB0_5
+
+BB0_37:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_8
+
+BB0_38:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	JMP  BB0_22
+
+BB0_39:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_25
+
+BB0_35:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_2
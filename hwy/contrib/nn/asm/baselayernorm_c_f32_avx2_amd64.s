@@ -0,0 +1,898 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baselayernorm_c_f32_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $8
+
+TEXT ·layernorm_c_f32_avx2(SB), $224-80
+	MOVQ   input+0(FP), DI
+	MOVQ   output+8(FP), SI
+	MOVQ   pnormSize+16(FP), DX
+	MOVQ   gamma+24(FP), CX
+	MOVQ   beta+32(FP), R8
+	MOVQ   pepsilon+40(FP), R9
+	MOVQ   plen_input+48(FP), R11
+	MOVQ   R11, 192(SP)
+	MOVQ   plen_output+56(FP), R11
+	MOVQ   R11, 200(SP)
+	MOVQ   plen_gamma+64(FP), R11
+	MOVQ   R11, 208(SP)
+	MOVQ   plen_beta+72(FP), R11
+	MOVQ   R11, 216(SP)
+	QUAD   $0x000000b024ac8d48                   // leaq	176(%rsp), %rbp
+	WORD   $0x8949; BYTE $0xcc                   // movq	%rcx, %r12
+	LONG   $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG   $0xe0e48348                           // andq	$-32, %rsp
+	WORD   $0x8b48; BYTE $0x0a                   // movq	(%rdx), %rcx
+	LONG   $0x10458b48                           // movq	16(%rbp), %rax
+	LONG   $0x18558b48                           // movq	24(%rbp), %rdx
+	WORD   $0x8b48; BYTE $0x00                   // movq	(%rax), %rax
+	WORD   $0x8b48; BYTE $0x12                   // movq	(%rdx), %rdx
+	WORD   $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	LONG   $0xc24f0f48                           // cmovg	%rdx, %rax
+	WORD   $0x8548; BYTE $0xc0                   // testq	%rax, %rax
+	JE     BB0_114
+	WORD   $0x8548; BYTE $0xc9                   // testq	%rcx, %rcx
+	JLE    BB0_114
+	WORD   $0x9948                               // cqto
+	LONG   $0xc057f8c5                           // vxorps	%xmm0, %xmm0, %xmm0
+	VMOVSS CPI0_0<>(SB), X1                      // vmovss	.LCPI0_0(%rip), %xmm1
+	WORD   $0xf748; BYTE $0xf9                   // idivq	%rcx
+	LONG   $0x2afae1c4; BYTE $0xc1               // vcvtsi2ssq	%rcx, %xmm0, %xmm0
+	LONG   $0xc85ef2c5                           // vdivss	%xmm0, %xmm1, %xmm1
+	LONG   $0x24448948; BYTE $0x70               // movq	%rax, 112(%rsp)
+	WORD   $0x8548; BYTE $0xc0                   // testq	%rax, %rax
+	JLE    BB0_114
+	WORD   $0x854d; BYTE $0xe4                   // testq	%r12, %r12
+	WORD   $0x8949; BYTE $0xf2                   // movq	%rsi, %r10
+	LONG   $0x107ac1c4; BYTE $0x19               // vmovss	(%r9), %xmm3
+	WORD   $0x8949; BYTE $0xfd                   // movq	%rdi, %r13
+	WORD   $0x950f; BYTE $0xc2                   // setne	%dl
+	WORD   $0x854d; BYTE $0xc0                   // testq	%r8, %r8
+	WORD   $0x894d; BYTE $0xd7                   // movq	%r10, %r15
+	WORD   $0x894d; BYTE $0xc3                   // movq	%r8, %r11
+	WORD   $0x950f; BYTE $0xc0                   // setne	%al
+	VMOVSD CPI0_1<>(SB), X2                      // vmovsd	.LCPI0_1(%rip), %xmm2
+	WORD   $0xdb31                               // xorl	%ebx, %ebx
+	QUAD   $0x000000982484c748; LONG $0x00000000 // movq	$0, 152(%rsp)
+	WORD   $0xc221                               // andl	%eax, %edx
+	QUAD   $0x000000008d048d48                   // leaq	0(,%rcx,4), %rax
+	LONG   $0x24448948; BYTE $0x60               // movq	%rax, 96(%rsp)
+	LONG   $0xf8418d48                           // leaq	-8(%rcx), %rax
+	LONG   $0x6f245488                           // movb	%dl, 111(%rsp)
+	WORD   $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	LONG   $0xf8e08348                           // andq	$-8, %rax
+	LONG   $0x03eac148                           // shrq	$3, %rdx
+	WORD   $0x8949; BYTE $0xc6                   // movq	%rax, %r14
+	QUAD   $0x0000008824848948                   // movq	%rax, 136(%rsp)
+	LONG   $0x20478d48                           // leaq	32(%rdi), %rax
+	QUAD   $0x00000008d5348d48                   // leaq	8(,%rdx,8), %rsi
+	QUAD   $0x0000008024848948                   // movq	%rax, 128(%rsp)
+	WORD   $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	WORD   $0x2948; BYTE $0xf0                   // subq	%rsi, %rax
+	QUAD   $0x0000009024b48948                   // movq	%rsi, 144(%rsp)
+	LONG   $0xff508d48                           // leaq	-1(%rax), %rdx
+	LONG   $0x24548948; BYTE $0x30               // movq	%rdx, 48(%rsp)
+	WORD   $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	LONG   $0x03eac148                           // shrq	$3, %rdx
+	LONG   $0x05e2c148                           // salq	$5, %rdx
+	LONG   $0x24548948; BYTE $0x48               // movq	%rdx, 72(%rsp)
+	WORD   $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	WORD   $0xe083; BYTE $0x07                   // andl	$7, %eax
+	LONG   $0x24448948; BYTE $0x38               // movq	%rax, 56(%rsp)
+	LONG   $0xf8e28348                           // andq	$-8, %rdx
+	LONG   $0x08468d49                           // leaq	8(%r14), %rax
+	WORD   $0x0148; BYTE $0xd6                   // addq	%rdx, %rsi
+	LONG   $0x24448948; BYTE $0x10               // movq	%rax, 16(%rsp)
+	LONG   $0x24748948; BYTE $0x40               // movq	%rsi, 64(%rsp)
+	WORD   $0x894c; BYTE $0xe6                   // movq	%r12, %rsi
+	WORD   $0x894d; BYTE $0xd4                   // movq	%r10, %r12
+	WORD   $0x8949; BYTE $0xf2                   // movq	%rsi, %r10
+
+BB0_26:
+	LONG $0x07f98348         // cmpq	$7, %rcx
+	JLE  BB0_5
+	QUAD $0x0000008824848b48 // movq	136(%rsp), %rax
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x18148d48         // leaq	(%rax,%rbx), %rdx
+	QUAD $0x0000008024848b48 // movq	128(%rsp), %rax
+	LONG $0x90348d48         // leaq	(%rax,%rdx,4), %rsi
+	WORD $0x894c; BYTE $0xe8 // movq	%r13, %rax
+
+BB0_6:
+	LONG $0x0058fcc5               // vaddps	(%rax), %ymm0, %ymm0
+	LONG $0x20c08348               // addq	$32, %rax
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JNE  BB0_6
+	LONG $0x197de3c4; WORD $0x01c4 // vextractf128	$0x1, %ymm0, %xmm4
+	QUAD $0x0000009024848b48       // movq	144(%rsp), %rax
+	LONG $0xc458f8c5               // vaddps	%xmm4, %xmm0, %xmm0
+	LONG $0xe012f8c5               // vmovhlps	%xmm0, %xmm0, %xmm4
+	LONG $0xc458f8c5               // vaddps	%xmm4, %xmm0, %xmm0
+	LONG $0xe016fac5               // vmovshdup	%xmm0, %xmm4
+	LONG $0xc458fac5               // vaddss	%xmm4, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_7
+	LONG $0x247c8348; WORD $0x0630 // cmpq	$6, 48(%rsp)
+	JBE  BB0_55
+	LONG $0x24748b48; BYTE $0x48   // movq	72(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	LONG $0x87048d48               // leaq	(%rdi,%rax,4), %rax
+	LONG $0x06148d48               // leaq	(%rsi,%rax), %rdx
+
+BB0_9:
+	LONG $0x0058fac5               // vaddss	(%rax), %xmm0, %xmm0
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0x4058fac5; BYTE $0xe4   // vaddss	-28(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xe8   // vaddss	-24(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xec   // vaddss	-20(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xf0   // vaddss	-16(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xf4   // vaddss	-12(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xf8   // vaddss	-8(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xfc   // vaddss	-4(%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JNE  BB0_9
+	LONG $0x247c8348; WORD $0x0038 // cmpq	$0, 56(%rsp)
+	LONG $0x24548b48; BYTE $0x40   // movq	64(%rsp), %rdx
+	QUAD $0x0000009024848b48       // movq	144(%rsp), %rax
+	JE   BB0_13
+
+BB0_8:
+	LONG $0x13348d48             // leaq	(%rbx,%rdx), %rsi
+	LONG $0x0458fac5; BYTE $0xb7 // vaddss	(%rdi,%rsi,4), %xmm0, %xmm0
+	LONG $0x01728d48             // leaq	1(%rdx), %rsi
+	WORD $0x3948; BYTE $0xf1     // cmpq	%rsi, %rcx
+	JLE  BB0_13
+	WORD $0x0148; BYTE $0xde     // addq	%rbx, %rsi
+	LONG $0x0458fac5; BYTE $0xb7 // vaddss	(%rdi,%rsi,4), %xmm0, %xmm0
+	LONG $0x02728d48             // leaq	2(%rdx), %rsi
+	WORD $0x3948; BYTE $0xf1     // cmpq	%rsi, %rcx
+	JLE  BB0_13
+	WORD $0x0148; BYTE $0xde     // addq	%rbx, %rsi
+	LONG $0x0458fac5; BYTE $0xb7 // vaddss	(%rdi,%rsi,4), %xmm0, %xmm0
+	LONG $0x03728d48             // leaq	3(%rdx), %rsi
+	WORD $0x3948; BYTE $0xf1     // cmpq	%rsi, %rcx
+	JLE  BB0_13
+	WORD $0x0148; BYTE $0xde     // addq	%rbx, %rsi
+	LONG $0x0458fac5; BYTE $0xb7 // vaddss	(%rdi,%rsi,4), %xmm0, %xmm0
+	LONG $0x04728d48             // leaq	4(%rdx), %rsi
+	WORD $0x3948; BYTE $0xf1     // cmpq	%rsi, %rcx
+	JLE  BB0_13
+	WORD $0x0148; BYTE $0xde     // addq	%rbx, %rsi
+	LONG $0x0458fac5; BYTE $0xb7 // vaddss	(%rdi,%rsi,4), %xmm0, %xmm0
+	LONG $0x05728d48             // leaq	5(%rdx), %rsi
+	WORD $0x3948; BYTE $0xf1     // cmpq	%rsi, %rcx
+	JLE  BB0_13
+	WORD $0x0148; BYTE $0xde     // addq	%rbx, %rsi
+	LONG $0x06c28348             // addq	$6, %rdx
+	LONG $0x0458fac5; BYTE $0xb7 // vaddss	(%rdi,%rsi,4), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd1     // cmpq	%rdx, %rcx
+	JLE  BB0_13
+	WORD $0x0148; BYTE $0xda     // addq	%rbx, %rdx
+	LONG $0x0458fac5; BYTE $0x97 // vaddss	(%rdi,%rdx,4), %xmm0, %xmm0
+
+BB0_13:
+	LONG $0xc059f2c5             // vmulss	%xmm0, %xmm1, %xmm0
+	QUAD $0x0000008824b48b48     // movq	136(%rsp), %rsi
+	LONG $0xed57d0c5             // vxorps	%xmm5, %xmm5, %xmm5
+	LONG $0x1e148d48             // leaq	(%rsi,%rbx), %rdx
+	LONG $0x187de2c4; BYTE $0xf8 // vbroadcastss	%xmm0, %ymm7
+	LONG $0x07f98348             // cmpq	$7, %rcx
+	JLE  BB0_12
+
+BB0_11:
+	QUAD $0x0000008024b48b48 // movq	128(%rsp), %rsi
+	LONG $0xed57d0c5         // vxorps	%xmm5, %xmm5, %xmm5
+	LONG $0x96348d48         // leaq	(%rsi,%rdx,4), %rsi
+	WORD $0x894c; BYTE $0xea // movq	%r13, %rdx
+
+BB0_14:
+	LONG $0x3210fcc5             // vmovups	(%rdx), %ymm6
+	LONG $0x20c28348             // addq	$32, %rdx
+	LONG $0xe75cccc5             // vsubps	%ymm7, %ymm6, %ymm4
+	LONG $0xb85de2c4; BYTE $0xec // vfmadd231ps	%ymm4, %ymm4, %ymm5
+	WORD $0x3948; BYTE $0xf2     // cmpq	%rsi, %rdx
+	JNE  BB0_14
+
+BB0_12:
+	LONG $0x197de3c4; WORD $0x01ec // vextractf128	$0x1, %ymm5, %xmm4
+	LONG $0xe558d8c5               // vaddps	%xmm5, %xmm4, %xmm4
+	LONG $0xec12d8c5               // vmovhlps	%xmm4, %xmm4, %xmm5
+	LONG $0xe558d8c5               // vaddps	%xmm5, %xmm4, %xmm4
+	LONG $0xec16fac5               // vmovshdup	%xmm4, %xmm5
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_15
+	WORD $0x8948; BYTE $0xce       // movq	%rcx, %rsi
+	WORD $0x2948; BYTE $0xc6       // subq	%rax, %rsi
+	LONG $0xff568d48               // leaq	-1(%rsi), %rdx
+	LONG $0x06fa8348               // cmpq	$6, %rdx
+	JBE  BB0_57
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	LONG $0x03148d48               // leaq	(%rbx,%rax), %rdx
+	LONG $0x03e8c149               // shrq	$3, %r8
+	LONG $0x97148d48               // leaq	(%rdi,%rdx,4), %rdx
+	LONG $0x05e0c149               // salq	$5, %r8
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+
+BB0_17:
+	LONG $0x3210fcc5               // vmovups	(%rdx), %ymm6
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xef5cccc5               // vsubps	%ymm7, %ymm6, %ymm5
+	LONG $0xf559d4c5               // vmulps	%ymm5, %ymm5, %ymm6
+	LONG $0xe658dac5               // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xeec6c8c5; BYTE $0x55   // vshufps	$85, %xmm6, %xmm6, %xmm5
+	LONG $0xc6c648c5; BYTE $0xff   // vshufps	$255, %xmm6, %xmm6, %xmm8
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xee15c8c5               // vunpckhps	%xmm6, %xmm6, %xmm5
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01f5 // vextractf128	$0x1, %ymm6, %xmm5
+	LONG $0xf5c6d0c5; BYTE $0x55   // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0x585ac1c4; BYTE $0xe0   // vaddss	%xmm8, %xmm4, %xmm4
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xe658dac5               // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xf515d0c5               // vunpckhps	%xmm5, %xmm5, %xmm6
+	LONG $0xedc6d0c5; BYTE $0xff   // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xe658dac5               // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JNE  BB0_17
+	WORD $0x8949; BYTE $0xf1       // movq	%rsi, %r9
+	LONG $0xf8e18349               // andq	$-8, %r9
+	LONG $0x01048d4d               // leaq	(%r9,%rax), %r8
+	LONG $0x07c6f640               // testb	$7, %sil
+	JE   BB0_15
+
+BB0_16:
+	WORD $0x294c; BYTE $0xce       // subq	%r9, %rsi
+	LONG $0xff568d48               // leaq	-1(%rsi), %rdx
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_20
+	LONG $0x03148d48               // leaq	(%rbx,%rax), %rdx
+	LONG $0xf0c6f8c5; BYTE $0x00   // vshufps	$0, %xmm0, %xmm0, %xmm6
+	WORD $0x0149; BYTE $0xd1       // addq	%rdx, %r9
+	WORD $0x8948; BYTE $0xf2       // movq	%rsi, %rdx
+	LONG $0x1078a1c4; WORD $0x8f2c // vmovups	(%rdi,%r9,4), %xmm5
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	WORD $0xe683; BYTE $0x03       // andl	$3, %esi
+	LONG $0xee5cd0c5               // vsubps	%xmm6, %xmm5, %xmm5
+	LONG $0xed59d0c5               // vmulps	%xmm5, %xmm5, %xmm5
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xf5c6d0c5; BYTE $0x55   // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0xe658dac5               // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xf515d0c5               // vunpckhps	%xmm5, %xmm5, %xmm6
+	LONG $0xedc6d0c5; BYTE $0xff   // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xe658dac5               // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	JE   BB0_15
+
+BB0_20:
+	LONG $0x03148d4a               // leaq	(%rbx,%r8), %rdx
+	LONG $0x2c10fac5; BYTE $0x97   // vmovss	(%rdi,%rdx,4), %xmm5
+	LONG $0x01508d49               // leaq	1(%r8), %rdx
+	LONG $0xe85cd2c5               // vsubss	%xmm0, %xmm5, %xmm5
+	LONG $0xb951e2c4; BYTE $0xe5   // vfmadd231ss	%xmm5, %xmm5, %xmm4
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_15
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x02c08349               // addq	$2, %r8
+	LONG $0x2c10fac5; BYTE $0x97   // vmovss	(%rdi,%rdx,4), %xmm5
+	LONG $0xe85cd2c5               // vsubss	%xmm0, %xmm5, %xmm5
+	LONG $0xb951e2c4; BYTE $0xe5   // vfmadd231ss	%xmm5, %xmm5, %xmm4
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_15
+	WORD $0x0149; BYTE $0xd8       // addq	%rbx, %r8
+	LONG $0x107aa1c4; WORD $0x872c // vmovss	(%rdi,%r8,4), %xmm5
+	LONG $0xe85cd2c5               // vsubss	%xmm0, %xmm5, %xmm5
+	LONG $0xb951e2c4; BYTE $0xe5   // vfmadd231ss	%xmm5, %xmm5, %xmm4
+
+BB0_15:
+	LONG $0xec28f8c5             // vmovaps	%xmm4, %xmm5
+	LONG $0x6f247c80; BYTE $0x00 // cmpb	$0, 111(%rsp)
+	LONG $0x9961e2c4; BYTE $0xe9 // vfmadd132ss	%xmm1, %xmm3, %xmm5
+	LONG $0xed5ad2c5             // vcvtss2sd	%xmm5, %xmm5, %xmm5
+	LONG $0xed51d3c5             // vsqrtsd	%xmm5, %xmm5, %xmm5
+	LONG $0xed5eebc5             // vdivsd	%xmm5, %xmm2, %xmm5
+	LONG $0xed5ad3c5             // vcvtsd2ss	%xmm5, %xmm5, %xmm5
+	LONG $0x187de2c4; BYTE $0xf5 // vbroadcastss	%xmm5, %ymm6
+	JNE  BB0_118
+	WORD $0x854d; BYTE $0xd2     // testq	%r10, %r10
+	JE   BB0_119
+	LONG $0x07f98348             // cmpq	$7, %rcx
+	JLE  BB0_38
+	LONG $0x000008ba; BYTE $0x00 // movl	$8, %edx
+
+BB0_39:
+	LONG $0x107cc1c4; WORD $0x9564; BYTE $0xe0 // vmovups	-32(%r13,%rdx,4), %ymm4
+	LONG $0xe75cdcc5                           // vsubps	%ymm7, %ymm4, %ymm4
+	LONG $0xe659dcc5                           // vmulps	%ymm6, %ymm4, %ymm4
+	LONG $0x595cc1c4; WORD $0x9264; BYTE $0xe0 // vmulps	-32(%r10,%rdx,4), %ymm4, %ymm4
+	LONG $0x117cc1c4; WORD $0x9764; BYTE $0xe0 // vmovups	%ymm4, -32(%r15,%rdx,4)
+	LONG $0x08c28348                           // addq	$8, %rdx
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_39
+
+BB0_38:
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x8949; BYTE $0xc8                   // movq	%rcx, %r8
+	LONG $0x24448948; BYTE $0x28               // movq	%rax, 40(%rsp)
+	LONG $0x18148d48                           // leaq	(%rax,%rbx), %rdx
+	WORD $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG $0xff708d49                           // leaq	-1(%r8), %rsi
+	LONG $0x24748948; BYTE $0x20               // movq	%rsi, 32(%rsp)
+	LONG $0x02fe8348                           // cmpq	$2, %rsi
+	JBE  BB0_120
+	LONG $0x01708d4c                           // leaq	1(%rax), %r14
+	QUAD $0x00000000950c8d4c                   // leaq	0(,%rdx,4), %r9
+	LONG $0x2474894c; BYTE $0x78               // movq	%r14, 120(%rsp)
+	LONG $0x02e6c149                           // salq	$2, %r14
+	LONG $0x0c348d4b                           // leaq	(%r12,%r9), %rsi
+	LONG $0x2474894c; BYTE $0x58               // movq	%r14, 88(%rsp)
+	LONG $0x0f748d4e; BYTE $0x04               // leaq	4(%rdi,%r9), %r14
+	LONG $0x24748948; BYTE $0x50               // movq	%rsi, 80(%rsp)
+	WORD $0x294c; BYTE $0xf6                   // subq	%r14, %rsi
+	LONG $0x18fe8348                           // cmpq	$24, %rsi
+	JBE  BB0_40
+	LONG $0x24748b4c; BYTE $0x58               // movq	88(%rsp), %r14
+	LONG $0x24748b48; BYTE $0x50               // movq	80(%rsp), %rsi
+	WORD $0x014d; BYTE $0xd6                   // addq	%r10, %r14
+	WORD $0x294c; BYTE $0xf6                   // subq	%r14, %rsi
+	LONG $0x18fe8348                           // cmpq	$24, %rsi
+	JBE  BB0_40
+	LONG $0x247c8348; WORD $0x0620             // cmpq	$6, 32(%rsp)
+	JBE  BB0_59
+	LONG $0x107ca1c4; WORD $0x0f24             // vmovups	(%rdi,%r9), %ymm4
+	LONG $0x24748b4c; BYTE $0x58               // movq	88(%rsp), %r14
+	LONG $0x24748b48; BYTE $0x50               // movq	80(%rsp), %rsi
+	LONG $0xe75cdcc5                           // vsubps	%ymm7, %ymm4, %ymm4
+	LONG $0xe659dcc5                           // vmulps	%ymm6, %ymm4, %ymm4
+	LONG $0x595c81c4; WORD $0x3264; BYTE $0xfc // vmulps	-4(%r10,%r14), %ymm4, %ymm4
+	LONG $0x2611fcc5                           // vmovups	%ymm4, (%rsi)
+	WORD $0x894c; BYTE $0xc6                   // movq	%r8, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x07c0f641                           // testb	$7, %r8b
+	JE   BB0_31
+	WORD $0x2949; BYTE $0xf0                   // subq	%rsi, %r8
+	LONG $0xff488d4d                           // leaq	-1(%r8), %r9
+	LONG $0x02f98349                           // cmpq	$2, %r9
+	JBE  BB0_44
+
+BB0_41:
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+	LONG $0xe0c6f8c5; BYTE $0x00   // vshufps	$0, %xmm0, %xmm0, %xmm4
+	LONG $0x24748b4c; BYTE $0x28   // movq	40(%rsp), %r14
+	LONG $0xf5c6d0c5; BYTE $0x00   // vshufps	$0, %xmm5, %xmm5, %xmm6
+	LONG $0x3c10f8c5; BYTE $0x97   // vmovups	(%rdi,%rdx,4), %xmm7
+	WORD $0x0149; BYTE $0xf6       // addq	%rsi, %r14
+	LONG $0xe45cc0c5               // vsubps	%xmm4, %xmm7, %xmm4
+	LONG $0xe659d8c5               // vmulps	%xmm6, %xmm4, %xmm4
+	LONG $0x595881c4; WORD $0xb224 // vmulps	(%r10,%r14,4), %xmm4, %xmm4
+	LONG $0x1178c1c4; WORD $0x9424 // vmovups	%xmm4, (%r12,%rdx,4)
+	WORD $0x894c; BYTE $0xc2       // movq	%r8, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x03e08341               // andl	$3, %r8d
+	JE   BB0_31
+
+BB0_44:
+	LONG $0x03148d48                           // leaq	(%rbx,%rax), %rdx
+	QUAD $0x0000000085348d48                   // leaq	0(,%rax,4), %rsi
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x595ac1c4; WORD $0x8224             // vmulss	(%r10,%rax,4), %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x01508d48                           // leaq	1(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x595ac1c4; WORD $0x3264; BYTE $0x04 // vmulss	4(%r10,%rsi), %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x2410fac5; BYTE $0x87               // vmovss	(%rdi,%rax,4), %xmm4
+	LONG $0xc05cdac5                           // vsubss	%xmm0, %xmm4, %xmm0
+	LONG $0xc559fac5                           // vmulss	%xmm5, %xmm0, %xmm0
+	LONG $0x597ac1c4; WORD $0x3244; BYTE $0x08 // vmulss	8(%r10,%rsi), %xmm0, %xmm0
+	LONG $0x117ac1c4; WORD $0x8404             // vmovss	%xmm0, (%r12,%rax,4)
+
+BB0_31:
+	LONG $0x24748b48; BYTE $0x60         // movq	96(%rsp), %rsi
+	WORD $0x0148; BYTE $0xcb             // addq	%rcx, %rbx
+	QUAD $0x0000009824848348; BYTE $0x01 // addq	$1, 152(%rsp)
+	QUAD $0x0000009824848b48             // movq	152(%rsp), %rax
+	WORD $0x0149; BYTE $0xf5             // addq	%rsi, %r13
+	WORD $0x0149; BYTE $0xf7             // addq	%rsi, %r15
+	LONG $0x24443948; BYTE $0x70         // cmpq	%rax, 112(%rsp)
+	JNE  BB0_26
+	WORD $0xf8c5; BYTE $0x77             // vzeroupper
+
+BB0_114:
+	LONG $0x50a58d48; WORD $0xffff; BYTE $0xff // leaq	-176(%rbp), %rsp
+	RET
+
+BB0_118:
+	LONG $0x07f98348             // cmpq	$7, %rcx
+	JLE  BB0_23
+	LONG $0x000008ba; BYTE $0x00 // movl	$8, %edx
+
+BB0_24:
+	LONG $0x107cc1c4; WORD $0x9564; BYTE $0xe0 // vmovups	-32(%r13,%rdx,4), %ymm4
+	LONG $0x107c41c4; WORD $0x934c; BYTE $0xe0 // vmovups	-32(%r11,%rdx,4), %ymm9
+	LONG $0xe75cdcc5                           // vsubps	%ymm7, %ymm4, %ymm4
+	LONG $0xe659dcc5                           // vmulps	%ymm6, %ymm4, %ymm4
+	LONG $0x9835c2c4; WORD $0x9264; BYTE $0xe0 // vfmadd132ps	-32(%r10,%rdx,4), %ymm9, %ymm4
+	LONG $0x117cc1c4; WORD $0x9764; BYTE $0xe0 // vmovups	%ymm4, -32(%r15,%rdx,4)
+	LONG $0x08c28348                           // addq	$8, %rdx
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_24
+
+BB0_23:
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x8949; BYTE $0xc9                   // movq	%rcx, %r9
+	LONG $0x24448948; BYTE $0x20               // movq	%rax, 32(%rsp)
+	LONG $0x18148d48                           // leaq	(%rax,%rbx), %rdx
+	WORD $0x2949; BYTE $0xc1                   // subq	%rax, %r9
+	LONG $0xff718d49                           // leaq	-1(%r9), %rsi
+	LONG $0x24748948; BYTE $0x18               // movq	%rsi, 24(%rsp)
+	LONG $0x02fe8348                           // cmpq	$2, %rsi
+	JBE  BB0_121
+	QUAD $0x0000000095348d48                   // leaq	0(,%rdx,4), %rsi
+	LONG $0x01708d4c                           // leaq	1(%rax), %r14
+	LONG $0x24748948; BYTE $0x50               // movq	%rsi, 80(%rsp)
+	WORD $0x014c; BYTE $0xe6                   // addq	%r12, %rsi
+	LONG $0x2474894c; BYTE $0x78               // movq	%r14, 120(%rsp)
+	LONG $0x02e6c149                           // salq	$2, %r14
+	WORD $0x8949; BYTE $0xf0                   // movq	%rsi, %r8
+	LONG $0x2474894c; BYTE $0x58               // movq	%r14, 88(%rsp)
+	WORD $0x014d; BYTE $0xde                   // addq	%r11, %r14
+	WORD $0x294d; BYTE $0xf0                   // subq	%r14, %r8
+	LONG $0x24748b4c; BYTE $0x58               // movq	88(%rsp), %r14
+	LONG $0x18f88349                           // cmpq	$24, %r8
+	WORD $0x8949; BYTE $0xf0                   // movq	%rsi, %r8
+	LONG $0x2444970f; BYTE $0x28               // seta	40(%rsp)
+	WORD $0x014d; BYTE $0xd6                   // addq	%r10, %r14
+	WORD $0x294d; BYTE $0xf0                   // subq	%r14, %r8
+	LONG $0x18f88349                           // cmpq	$24, %r8
+	LONG $0xc6970f41                           // seta	%r14b
+	LONG $0x24748444; BYTE $0x28               // testb	%r14b, 40(%rsp)
+	JE   BB0_27
+	LONG $0x24748b4c; BYTE $0x50               // movq	80(%rsp), %r14
+	WORD $0x8949; BYTE $0xf0                   // movq	%rsi, %r8
+	LONG $0x37748d4e; BYTE $0x04               // leaq	4(%rdi,%r14), %r14
+	WORD $0x294d; BYTE $0xf0                   // subq	%r14, %r8
+	LONG $0x18f88349                           // cmpq	$24, %r8
+	JBE  BB0_27
+	LONG $0x247c8348; WORD $0x0618             // cmpq	$6, 24(%rsp)
+	JBE  BB0_58
+	LONG $0x24748b4c; BYTE $0x50               // movq	80(%rsp), %r14
+	LONG $0x107ca1c4; WORD $0x3724             // vmovups	(%rdi,%r14), %ymm4
+	LONG $0x24748b4c; BYTE $0x58               // movq	88(%rsp), %r14
+	LONG $0xe75cdcc5                           // vsubps	%ymm7, %ymm4, %ymm4
+	LONG $0x107c81c4; WORD $0x337c; BYTE $0xfc // vmovups	-4(%r11,%r14), %ymm7
+	LONG $0xe659dcc5                           // vmulps	%ymm6, %ymm4, %ymm4
+	LONG $0x984582c4; WORD $0x3264; BYTE $0xfc // vfmadd132ps	-4(%r10,%r14), %ymm7, %ymm4
+	LONG $0x2611fcc5                           // vmovups	%ymm4, (%rsi)
+	WORD $0x894c; BYTE $0xce                   // movq	%r9, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x07c1f641                           // testb	$7, %r9b
+	JE   BB0_31
+	WORD $0x2949; BYTE $0xf1                   // subq	%rsi, %r9
+	LONG $0xff418d4d                           // leaq	-1(%r9), %r8
+	LONG $0x02f88349                           // cmpq	$2, %r8
+	JBE  BB0_32
+
+BB0_28:
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+	LONG $0xe0c6f8c5; BYTE $0x00   // vshufps	$0, %xmm0, %xmm0, %xmm4
+	LONG $0x24748b4c; BYTE $0x20   // movq	32(%rsp), %r14
+	LONG $0xf5c6d0c5; BYTE $0x00   // vshufps	$0, %xmm5, %xmm5, %xmm6
+	LONG $0x3c10f8c5; BYTE $0x97   // vmovups	(%rdi,%rdx,4), %xmm7
+	WORD $0x0149; BYTE $0xf6       // addq	%rsi, %r14
+	LONG $0xe45cc0c5               // vsubps	%xmm4, %xmm7, %xmm4
+	LONG $0x107881c4; WORD $0xb33c // vmovups	(%r11,%r14,4), %xmm7
+	LONG $0xe659d8c5               // vmulps	%xmm6, %xmm4, %xmm4
+	LONG $0x984182c4; WORD $0xb224 // vfmadd132ps	(%r10,%r14,4), %xmm7, %xmm4
+	LONG $0x1178c1c4; WORD $0x9424 // vmovups	%xmm4, (%r12,%rdx,4)
+	WORD $0x894c; BYTE $0xca       // movq	%r9, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x03e18341               // andl	$3, %r9d
+	JE   BB0_31
+
+BB0_32:
+	LONG $0x03148d48                           // leaq	(%rbx,%rax), %rdx
+	LONG $0x107ac1c4; WORD $0x833c             // vmovss	(%r11,%rax,4), %xmm7
+	QUAD $0x0000000085348d48                   // leaq	0(,%rax,4), %rsi
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x9941c2c4; WORD $0x8224             // vfmadd132ss	(%r10,%rax,4), %xmm7, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x01508d48                           // leaq	1(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x107ac1c4; WORD $0x337c; BYTE $0x04 // vmovss	4(%r11,%rsi), %xmm7
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x9941c2c4; WORD $0x3264; BYTE $0x04 // vfmadd132ss	4(%r10,%rsi), %xmm7, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x107ac1c4; WORD $0x337c; BYTE $0x08 // vmovss	8(%r11,%rsi), %xmm7
+	LONG $0x2410fac5; BYTE $0x87               // vmovss	(%rdi,%rax,4), %xmm4
+	LONG $0xc05cdac5                           // vsubss	%xmm0, %xmm4, %xmm0
+	LONG $0xc559fac5                           // vmulss	%xmm5, %xmm0, %xmm0
+	LONG $0x9941c2c4; WORD $0x3244; BYTE $0x08 // vfmadd132ss	8(%r10,%rsi), %xmm7, %xmm0
+	LONG $0x117ac1c4; WORD $0x8404             // vmovss	%xmm0, (%r12,%rax,4)
+	JMP  BB0_31
+
+BB0_120:
+	LONG $0x01708d48             // leaq	1(%rax), %rsi
+	LONG $0x24748948; BYTE $0x78 // movq	%rsi, 120(%rsp)
+
+BB0_40:
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0x24748b48; BYTE $0x78               // movq	120(%rsp), %rsi
+	QUAD $0x0000000085048d4c                   // leaq	0(,%rax,4), %r8
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x595ac1c4; WORD $0x8224             // vmulss	(%r10,%rax,4), %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xde                   // addq	%rbx, %rsi
+	LONG $0x02508d48                           // leaq	2(%rax), %rdx
+	LONG $0x2410fac5; BYTE $0xb7               // vmovss	(%rdi,%rsi,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x595a81c4; WORD $0x0264; BYTE $0x04 // vmulss	4(%r10,%r8), %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0xb424             // vmovss	%xmm4, (%r12,%rsi,4)
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x595a81c4; WORD $0x0264; BYTE $0x08 // vmulss	8(%r10,%r8), %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x03508d48                           // leaq	3(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x595a81c4; WORD $0x0264; BYTE $0x0c // vmulss	12(%r10,%r8), %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x04508d48                           // leaq	4(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x595a81c4; WORD $0x0264; BYTE $0x10 // vmulss	16(%r10,%r8), %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x05508d48                           // leaq	5(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x595a81c4; WORD $0x0264; BYTE $0x14 // vmulss	20(%r10,%r8), %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x06508d48                           // leaq	6(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x07c08348                           // addq	$7, %rax
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x595a81c4; WORD $0x0264; BYTE $0x18 // vmulss	24(%r10,%r8), %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x2410fac5; BYTE $0x87               // vmovss	(%rdi,%rax,4), %xmm4
+	LONG $0xc05cdac5                           // vsubss	%xmm0, %xmm4, %xmm0
+	LONG $0xc559fac5                           // vmulss	%xmm5, %xmm0, %xmm0
+	LONG $0x597a81c4; WORD $0x0244; BYTE $0x1c // vmulss	28(%r10,%r8), %xmm0, %xmm0
+	LONG $0x117ac1c4; WORD $0x8404             // vmovss	%xmm0, (%r12,%rax,4)
+	JMP  BB0_31
+
+BB0_119:
+	LONG $0x24748b48; BYTE $0x10 // movq	16(%rsp), %rsi
+	QUAD $0x000000009d148d48     // leaq	0(,%rbx,4), %rdx
+	WORD $0x0148; BYTE $0xde     // addq	%rbx, %rsi
+	LONG $0x02e6c148             // salq	$2, %rsi
+	LONG $0x07f98348             // cmpq	$7, %rcx
+	JLE  BB0_37
+
+BB0_47:
+	LONG $0x2410fcc5; BYTE $0x17   // vmovups	(%rdi,%rdx), %ymm4
+	LONG $0xe75cdcc5               // vsubps	%ymm7, %ymm4, %ymm4
+	LONG $0xe659dcc5               // vmulps	%ymm6, %ymm4, %ymm4
+	LONG $0x117cc1c4; WORD $0x1424 // vmovups	%ymm4, (%r12,%rdx)
+	LONG $0x20c28348               // addq	$32, %rdx
+	WORD $0x3948; BYTE $0xd6       // cmpq	%rdx, %rsi
+	JNE  BB0_47
+
+BB0_37:
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x8948; BYTE $0xce     // movq	%rcx, %rsi
+	WORD $0x2948; BYTE $0xc6     // subq	%rax, %rsi
+	LONG $0xff568d48             // leaq	-1(%rsi), %rdx
+	LONG $0x02fa8348             // cmpq	$2, %rdx
+	LONG $0x24548948; BYTE $0x78 // movq	%rdx, 120(%rsp)
+	LONG $0x18148d48             // leaq	(%rax,%rbx), %rdx
+	JBE  BB0_48
+	QUAD $0x0000000095048d4c     // leaq	0(,%rdx,4), %r8
+	LONG $0x040c8d4f             // leaq	(%r12,%r8), %r9
+	LONG $0x244c894c; BYTE $0x58 // movq	%r9, 88(%rsp)
+	LONG $0x074c8d4e; BYTE $0x04 // leaq	4(%rdi,%r8), %r9
+	WORD $0x894d; BYTE $0xce     // movq	%r9, %r14
+	LONG $0x040c8d4f             // leaq	(%r12,%r8), %r9
+	WORD $0x294d; BYTE $0xf1     // subq	%r14, %r9
+	LONG $0x18f98349             // cmpq	$24, %r9
+	JA   BB0_122
+
+BB0_48:
+	LONG $0x2410fac5; BYTE $0x97   // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5               // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5               // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424 // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x01508d48               // leaq	1(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x2410fac5; BYTE $0x97   // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5               // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5               // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424 // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x02508d48               // leaq	2(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x2410fac5; BYTE $0x97   // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5               // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5               // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424 // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x03508d48               // leaq	3(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x2410fac5; BYTE $0x97   // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5               // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5               // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424 // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x04508d48               // leaq	4(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x2410fac5; BYTE $0x97   // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5               // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5               // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424 // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x05508d48               // leaq	5(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x2410fac5; BYTE $0x97   // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5               // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5               // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424 // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x06508d48               // leaq	6(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x07c08348               // addq	$7, %rax
+	LONG $0x2410fac5; BYTE $0x97   // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5               // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5               // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424 // vmovss	%xmm4, (%r12,%rdx,4)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_31
+
+BB0_116:
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	LONG $0x2410fac5; BYTE $0x87   // vmovss	(%rdi,%rax,4), %xmm4
+	LONG $0xc05cdac5               // vsubss	%xmm0, %xmm4, %xmm0
+	LONG $0xc559fac5               // vmulss	%xmm5, %xmm0, %xmm0
+	LONG $0x117ac1c4; WORD $0x8404 // vmovss	%xmm0, (%r12,%rax,4)
+	JMP  BB0_31
+
+BB0_121:
+	LONG $0x01708d48             // leaq	1(%rax), %rsi
+	LONG $0x24748948; BYTE $0x78 // movq	%rsi, 120(%rsp)
+
+BB0_27:
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0x107ac1c4; WORD $0x833c             // vmovss	(%r11,%rax,4), %xmm7
+	QUAD $0x0000000085048d4c                   // leaq	0(,%rax,4), %r8
+	LONG $0x24748b48; BYTE $0x78               // movq	120(%rsp), %rsi
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x9941c2c4; WORD $0x8224             // vfmadd132ss	(%r10,%rax,4), %xmm7, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xde                   // addq	%rbx, %rsi
+	LONG $0x107a81c4; WORD $0x037c; BYTE $0x04 // vmovss	4(%r11,%r8), %xmm7
+	LONG $0x02508d48                           // leaq	2(%rax), %rdx
+	LONG $0x2410fac5; BYTE $0xb7               // vmovss	(%rdi,%rsi,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x994182c4; WORD $0x0264; BYTE $0x04 // vfmadd132ss	4(%r10,%r8), %xmm7, %xmm4
+	LONG $0x117ac1c4; WORD $0xb424             // vmovss	%xmm4, (%r12,%rsi,4)
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JGE  BB0_31
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x107a81c4; WORD $0x037c; BYTE $0x08 // vmovss	8(%r11,%r8), %xmm7
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x994182c4; WORD $0x0264; BYTE $0x08 // vfmadd132ss	8(%r10,%r8), %xmm7, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x03508d48                           // leaq	3(%rax), %rdx
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JGE  BB0_31
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x107a81c4; WORD $0x037c; BYTE $0x0c // vmovss	12(%r11,%r8), %xmm7
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x994182c4; WORD $0x0264; BYTE $0x0c // vfmadd132ss	12(%r10,%r8), %xmm7, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x04508d48                           // leaq	4(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x107a81c4; WORD $0x037c; BYTE $0x10 // vmovss	16(%r11,%r8), %xmm7
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x994182c4; WORD $0x0264; BYTE $0x10 // vfmadd132ss	16(%r10,%r8), %xmm7, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x05508d48                           // leaq	5(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x107a81c4; WORD $0x037c; BYTE $0x14 // vmovss	20(%r11,%r8), %xmm7
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x994182c4; WORD $0x0264; BYTE $0x14 // vfmadd132ss	20(%r10,%r8), %xmm7, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x06508d48                           // leaq	6(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x107a81c4; WORD $0x037c; BYTE $0x18 // vmovss	24(%r11,%r8), %xmm7
+	LONG $0x07c08348                           // addq	$7, %rax
+	LONG $0x2410fac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5                           // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5                           // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x994182c4; WORD $0x0264; BYTE $0x18 // vfmadd132ss	24(%r10,%r8), %xmm7, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424             // vmovss	%xmm4, (%r12,%rdx,4)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x107a81c4; WORD $0x037c; BYTE $0x1c // vmovss	28(%r11,%r8), %xmm7
+	LONG $0x2410fac5; BYTE $0x87               // vmovss	(%rdi,%rax,4), %xmm4
+	LONG $0xc05cdac5                           // vsubss	%xmm0, %xmm4, %xmm0
+	LONG $0xc559fac5                           // vmulss	%xmm5, %xmm0, %xmm0
+	LONG $0x994182c4; WORD $0x0244; BYTE $0x1c // vfmadd132ss	28(%r10,%r8), %xmm7, %xmm0
+	LONG $0x117ac1c4; WORD $0x8404             // vmovss	%xmm0, (%r12,%rax,4)
+	JMP  BB0_31
+
+BB0_7:
+	LONG $0xc059f2c5             // vmulss	%xmm0, %xmm1, %xmm0
+	LONG $0x187de2c4; BYTE $0xf8 // vbroadcastss	%xmm0, %ymm7
+	JMP  BB0_11
+
+BB0_5:
+	LONG $0xc057f8c5 // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0xc031     // xorl	%eax, %eax
+	WORD $0xd231     // xorl	%edx, %edx
+	JMP  BB0_8
+
+BB0_57:
+	WORD $0x8949; BYTE $0xc0 // movq	%rax, %r8
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	JMP  BB0_16
+
+BB0_122:
+	LONG $0x247c8348; WORD $0x0678 // cmpq	$6, 120(%rsp)
+	JBE  BB0_60
+	LONG $0x107ca1c4; WORD $0x0724 // vmovups	(%rdi,%r8), %ymm4
+	LONG $0x244c8b4c; BYTE $0x58   // movq	88(%rsp), %r9
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	LONG $0xf8e08349               // andq	$-8, %r8
+	LONG $0xe75cdcc5               // vsubps	%ymm7, %ymm4, %ymm4
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0xe659dcc5               // vmulps	%ymm6, %ymm4, %ymm4
+	LONG $0x117cc1c4; BYTE $0x21   // vmovups	%ymm4, (%r9)
+	LONG $0x07c6f640               // testb	$7, %sil
+	JE   BB0_31
+	WORD $0x294c; BYTE $0xc6       // subq	%r8, %rsi
+	LONG $0xff4e8d4c               // leaq	-1(%rsi), %r9
+	LONG $0x02f98349               // cmpq	$2, %r9
+	JBE  BB0_52
+
+BB0_49:
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0xe0c6f8c5; BYTE $0x00   // vshufps	$0, %xmm0, %xmm0, %xmm4
+	LONG $0xf5c6d0c5; BYTE $0x00   // vshufps	$0, %xmm5, %xmm5, %xmm6
+	WORD $0x8948; BYTE $0xf2       // movq	%rsi, %rdx
+	LONG $0x1078a1c4; WORD $0x873c // vmovups	(%rdi,%r8,4), %xmm7
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	WORD $0xe683; BYTE $0x03       // andl	$3, %esi
+	LONG $0xe45cc0c5               // vsubps	%xmm4, %xmm7, %xmm4
+	LONG $0xe659d8c5               // vmulps	%xmm6, %xmm4, %xmm4
+	LONG $0x117881c4; WORD $0x8424 // vmovups	%xmm4, (%r12,%r8,4)
+	JE   BB0_31
+
+BB0_52:
+	LONG $0x03148d48               // leaq	(%rbx,%rax), %rdx
+	LONG $0x2410fac5; BYTE $0x97   // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5               // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5               // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424 // vmovss	%xmm4, (%r12,%rdx,4)
+	LONG $0x01508d48               // leaq	1(%rax), %rdx
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x2410fac5; BYTE $0x97   // vmovss	(%rdi,%rdx,4), %xmm4
+	LONG $0xe05cdac5               // vsubss	%xmm0, %xmm4, %xmm4
+	LONG $0xe559dac5               // vmulss	%xmm5, %xmm4, %xmm4
+	LONG $0x117ac1c4; WORD $0x9424 // vmovss	%xmm4, (%r12,%rdx,4)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JG   BB0_116
+	JMP  BB0_31
+
+BB0_55:
+	WORD $0x8948; BYTE $0xc2 // movq	%rax, %rdx
+	JMP  BB0_8
+
+BB0_59:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_41
+
+BB0_58:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_28
+
+BB0_60:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_49
@@ -0,0 +1,1329 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baselayernorm_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $8
+
+TEXT ·layernorm_c_f32_avx512(SB), $96-80
+	MOVQ   input+0(FP), DI
+	MOVQ   output+8(FP), SI
+	MOVQ   pnormSize+16(FP), DX
+	MOVQ   gamma+24(FP), CX
+	MOVQ   beta+32(FP), R8
+	MOVQ   pepsilon+40(FP), R9
+	MOVQ   plen_input+48(FP), R11
+	MOVQ   R11, 64(SP)
+	MOVQ   plen_output+56(FP), R11
+	MOVQ   R11, 72(SP)
+	MOVQ   plen_gamma+64(FP), R11
+	MOVQ   R11, 80(SP)
+	MOVQ   plen_beta+72(FP), R11
+	MOVQ   R11, 88(SP)
+	LONG   $0x246c8d48; BYTE $0x30         // leaq	48(%rsp), %rbp
+	WORD   $0x8949; BYTE $0xcf             // movq	%rcx, %r15
+	LONG   $0x24648d48; BYTE $0x40         // leaq	64(%rsp), %rsp
+	LONG   $0xc0e48348                     // andq	$-64, %rsp
+	LONG   $0x80c48348                     // addq	$-128, %rsp
+	LONG   $0x10458b48                     // movq	16(%rbp), %rax
+	WORD   $0x8b48; BYTE $0x0a             // movq	(%rdx), %rcx
+	LONG   $0x007efac5                     // vmovq	(%rax), %xmm0
+	LONG   $0x18458b48                     // movq	24(%rbp), %rax
+	LONG   $0x187efac5                     // vmovq	(%rax), %xmm3
+	LONG   $0x08fdf262; WORD $0xc339       // vpminsq	%xmm3, %xmm0, %xmm0
+	LONG   $0x7ef9e1c4; BYTE $0xc0         // vmovq	%xmm0, %rax
+	WORD   $0x8548; BYTE $0xc0             // testq	%rax, %rax
+	JE     BB0_118
+	WORD   $0x8548; BYTE $0xc9             // testq	%rcx, %rcx
+	JLE    BB0_118
+	WORD   $0x9948                         // cqto
+	LONG   $0xc057f8c5                     // vxorps	%xmm0, %xmm0, %xmm0
+	VMOVSS CPI0_0<>(SB), X3                // vmovss	.LCPI0_0(%rip), %xmm3
+	WORD   $0xf748; BYTE $0xf9             // idivq	%rcx
+	LONG   $0x2afae1c4; BYTE $0xc1         // vcvtsi2ssq	%rcx, %xmm0, %xmm0
+	LONG   $0xd85ee2c5                     // vdivss	%xmm0, %xmm3, %xmm3
+	LONG   $0x24448948; BYTE $0x58         // movq	%rax, 88(%rsp)
+	WORD   $0x8548; BYTE $0xc0             // testq	%rax, %rax
+	JLE    BB0_118
+	WORD   $0x854d; BYTE $0xff             // testq	%r15, %r15
+	LONG   $0x405f8d48                     // leaq	64(%rdi), %rbx
+	LONG   $0x107ac1c4; BYTE $0x39         // vmovss	(%r9), %xmm7
+	WORD   $0x8949; BYTE $0xf2             // movq	%rsi, %r10
+	WORD   $0x950f; BYTE $0xc2             // setne	%dl
+	WORD   $0x854d; BYTE $0xc0             // testq	%r8, %r8
+	LONG   $0x6ef9e1c4; BYTE $0xeb         // vmovq	%rbx, %xmm5
+	WORD   $0x8948; BYTE $0xcb             // movq	%rcx, %rbx
+	WORD   $0x950f; BYTE $0xc0             // setne	%al
+	WORD   $0x8949; BYTE $0xf6             // movq	%rsi, %r14
+	WORD   $0x894d; BYTE $0xfd             // movq	%r15, %r13
+	WORD   $0x8948; BYTE $0xfe             // movq	%rdi, %rsi
+	QUAD   $0x000000782444c748; BYTE $0x00 // movq	$0, 120(%rsp)
+	WORD   $0xc221                         // andl	%eax, %edx
+	QUAD   $0x000000008d048d48             // leaq	0(,%rcx,4), %rax
+	WORD   $0x894d; BYTE $0xc7             // movq	%r8, %r15
+	LONG   $0x6ef9e1c4; BYTE $0xe0         // vmovq	%rax, %xmm4
+	LONG   $0xf0418d48                     // leaq	-16(%rcx), %rax
+	LONG   $0x57245488                     // movb	%dl, 87(%rsp)
+	VMOVSD CPI0_1<>(SB), X6                // vmovsd	.LCPI0_1(%rip), %xmm6
+	WORD   $0x8948; BYTE $0xc2             // movq	%rax, %rdx
+	LONG   $0xf0e08348                     // andq	$-16, %rax
+	LONG   $0xf0e28348                     // andq	$-16, %rdx
+	LONG   $0x24448948; BYTE $0x70         // movq	%rax, 112(%rsp)
+	WORD   $0xc031                         // xorl	%eax, %eax
+	LONG   $0x10c28348                     // addq	$16, %rdx
+	WORD   $0x2948; BYTE $0xd3             // subq	%rdx, %rbx
+	LONG   $0x24548948; BYTE $0x68         // movq	%rdx, 104(%rsp)
+	LONG   $0xff538d48                     // leaq	-1(%rbx), %rdx
+	LONG   $0x245c8948; BYTE $0x28         // movq	%rbx, 40(%rsp)
+	LONG   $0x24548948; BYTE $0x20         // movq	%rdx, 32(%rsp)
+	WORD   $0x8948; BYTE $0xda             // movq	%rbx, %rdx
+	LONG   $0x04eac148                     // shrq	$4, %rdx
+	LONG   $0x06e2c148                     // salq	$6, %rdx
+	LONG   $0x24548948; BYTE $0x40         // movq	%rdx, 64(%rsp)
+	WORD   $0x8948; BYTE $0xda             // movq	%rbx, %rdx
+	WORD   $0xe383; BYTE $0x0f             // andl	$15, %ebx
+	LONG   $0xf0e28348                     // andq	$-16, %rdx
+	LONG   $0x245c8948; BYTE $0x30         // movq	%rbx, 48(%rsp)
+	LONG   $0x24548948; BYTE $0x38         // movq	%rdx, 56(%rsp)
+
+BB0_28:
+	LONG $0x0ff98348             // cmpq	$15, %rcx
+	JLE  BB0_5
+	LONG $0x245c8b48; BYTE $0x70 // movq	112(%rsp), %rbx
+	WORD $0x8948; BYTE $0xf2     // movq	%rsi, %rdx
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x030c8d4c             // leaq	(%rbx,%rax), %r9
+	LONG $0x7ef9e1c4; BYTE $0xeb // vmovq	%xmm5, %rbx
+	LONG $0x8b048d4e             // leaq	(%rbx,%r9,4), %r8
+
+BB0_6:
+	LONG $0x487cf162; WORD $0x0258             // vaddps	(%rdx), %zmm0, %zmm0
+	LONG $0x40c28348                           // addq	$64, %rdx
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JNE  BB0_6
+	LONG $0x48fdd362; WORD $0xc01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm8
+	LONG $0x245c8b48; BYTE $0x68               // movq	104(%rsp), %rbx
+	LONG $0xc058bcc5                           // vaddps	%ymm0, %ymm8, %ymm0
+	LONG $0x197dc3c4; WORD $0x01c0             // vextractf128	$0x1, %ymm0, %xmm8
+	LONG $0xc058b8c5                           // vaddps	%xmm0, %xmm8, %xmm0
+	LONG $0x047963c4; WORD $0x4ec0             // vpermilps	$78, %xmm0, %xmm8
+	LONG $0xc05838c5                           // vaddps	%xmm0, %xmm8, %xmm8
+	LONG $0xc02978c5                           // vmovaps	%xmm8, %xmm0
+	LONG $0xc63841c4; WORD $0x55c0             // vshufps	$85, %xmm8, %xmm8, %xmm8
+	LONG $0x587ac1c4; BYTE $0xc0               // vaddss	%xmm8, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd9                   // cmpq	%rbx, %rcx
+	JLE  BB0_7
+	LONG $0x247c8348; WORD $0x0e20             // cmpq	$14, 32(%rsp)
+	LONG $0x245c8b4c; BYTE $0x28               // movq	40(%rsp), %r11
+	JBE  BB0_57
+	LONG $0x03148d48                           // leaq	(%rbx,%rax), %rdx
+	LONG $0x245c8b48; BYTE $0x40               // movq	64(%rsp), %rbx
+	LONG $0x97148d48                           // leaq	(%rdi,%rdx,4), %rdx
+	LONG $0x13048d4c                           // leaq	(%rbx,%rdx), %r8
+
+BB0_9:
+	LONG $0x0258fac5               // vaddss	(%rdx), %xmm0, %xmm0
+	LONG $0x40c28348               // addq	$64, %rdx
+	LONG $0x4258fac5; BYTE $0xc4   // vaddss	-60(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xc8   // vaddss	-56(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xcc   // vaddss	-52(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xd0   // vaddss	-48(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xd4   // vaddss	-44(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xd8   // vaddss	-40(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xdc   // vaddss	-36(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xe0   // vaddss	-32(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xe4   // vaddss	-28(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xe8   // vaddss	-24(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xec   // vaddss	-20(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xf0   // vaddss	-16(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xf4   // vaddss	-12(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xf8   // vaddss	-8(%rdx), %xmm0, %xmm0
+	LONG $0x4258fac5; BYTE $0xfc   // vaddss	-4(%rdx), %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JNE  BB0_9
+	LONG $0x244c8b4c; BYTE $0x38   // movq	56(%rsp), %r9
+	LONG $0x24548b48; BYTE $0x68   // movq	104(%rsp), %rdx
+	LONG $0x247c8348; WORD $0x0030 // cmpq	$0, 48(%rsp)
+	WORD $0x894c; BYTE $0xcb       // movq	%r9, %rbx
+	LONG $0x11048d4d               // leaq	(%r9,%rdx), %r8
+	JE   BB0_13
+	WORD $0x8949; BYTE $0xd1       // movq	%rdx, %r9
+
+BB0_8:
+	WORD $0x2949; BYTE $0xdb       // subq	%rbx, %r11
+	LONG $0xff638d4d               // leaq	-1(%r11), %r12
+	LONG $0x06fc8349               // cmpq	$6, %r12
+	JBE  BB0_14
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+	WORD $0x0149; BYTE $0xd9       // addq	%rbx, %r9
+	LONG $0x8f0c8d4e               // leaq	(%rdi,%r9,4), %r9
+	LONG $0x587ac1c4; BYTE $0x01   // vaddss	(%r9), %xmm0, %xmm0
+	LONG $0x587ac1c4; WORD $0x0441 // vaddss	4(%r9), %xmm0, %xmm0
+	LONG $0x587ac1c4; WORD $0x0841 // vaddss	8(%r9), %xmm0, %xmm0
+	LONG $0x587ac1c4; WORD $0x0c41 // vaddss	12(%r9), %xmm0, %xmm0
+	LONG $0x587ac1c4; WORD $0x1041 // vaddss	16(%r9), %xmm0, %xmm0
+	LONG $0x587ac1c4; WORD $0x1441 // vaddss	20(%r9), %xmm0, %xmm0
+	LONG $0x587ac1c4; WORD $0x1841 // vaddss	24(%r9), %xmm0, %xmm0
+	LONG $0x587ac1c4; WORD $0x1c41 // vaddss	28(%r9), %xmm0, %xmm0
+	WORD $0x894d; BYTE $0xd9       // movq	%r11, %r9
+	LONG $0xf8e18349               // andq	$-8, %r9
+	WORD $0x014d; BYTE $0xc8       // addq	%r9, %r8
+	LONG $0x07e38341               // andl	$7, %r11d
+	JE   BB0_13
+
+BB0_14:
+	LONG $0x000c8d4e               // leaq	(%rax,%r8), %r9
+	LONG $0x587aa1c4; WORD $0x8f04 // vaddss	(%rdi,%r9,4), %xmm0, %xmm0
+	LONG $0x01488d4d               // leaq	1(%r8), %r9
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+	LONG $0x587aa1c4; WORD $0x8f04 // vaddss	(%rdi,%r9,4), %xmm0, %xmm0
+	LONG $0x02488d4d               // leaq	2(%r8), %r9
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+	LONG $0x587aa1c4; WORD $0x8f04 // vaddss	(%rdi,%r9,4), %xmm0, %xmm0
+	LONG $0x03488d4d               // leaq	3(%r8), %r9
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+	LONG $0x587aa1c4; WORD $0x8f04 // vaddss	(%rdi,%r9,4), %xmm0, %xmm0
+	LONG $0x04488d4d               // leaq	4(%r8), %r9
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+	LONG $0x587aa1c4; WORD $0x8f04 // vaddss	(%rdi,%r9,4), %xmm0, %xmm0
+	LONG $0x05488d4d               // leaq	5(%r8), %r9
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+	LONG $0x06c08349               // addq	$6, %r8
+	LONG $0x587aa1c4; WORD $0x8f04 // vaddss	(%rdi,%r9,4), %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x587aa1c4; WORD $0x8704 // vaddss	(%rdi,%r8,4), %xmm0, %xmm0
+
+BB0_13:
+	LONG $0xc059e2c5               // vmulss	%xmm0, %xmm3, %xmm0
+	LONG $0x245c8b48; BYTE $0x70   // movq	112(%rsp), %rbx
+	LONG $0x573141c4; BYTE $0xc9   // vxorpd	%xmm9, %xmm9, %xmm9
+	LONG $0x030c8d4c               // leaq	(%rbx,%rax), %r9
+	LONG $0x487d7262; WORD $0xe018 // vbroadcastss	%xmm0, %zmm12
+	LONG $0x0ff98348               // cmpq	$15, %rcx
+	JLE  BB0_12
+
+BB0_11:
+	LONG $0x7ef9e1c4; BYTE $0xeb // vmovq	%xmm5, %rbx
+	WORD $0x8949; BYTE $0xf0     // movq	%rsi, %r8
+	LONG $0x573041c4; BYTE $0xc9 // vxorps	%xmm9, %xmm9, %xmm9
+	LONG $0x8b0c8d4e             // leaq	(%rbx,%r9,4), %r9
+
+BB0_16:
+	LONG $0x487cd162; WORD $0x1010 // vmovups	(%r8), %zmm2
+	LONG $0x40c08349               // addq	$64, %r8
+	LONG $0x486c5162; WORD $0xc45c // vsubps	%zmm12, %zmm2, %zmm8
+	LONG $0x483d5262; WORD $0xc8b8 // vfmadd231ps	%zmm8, %zmm8, %zmm9
+	WORD $0x394d; BYTE $0xc1       // cmpq	%r8, %r9
+	JNE  BB0_16
+
+BB0_12:
+	LONG $0x48fd5362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm9, %ymm8
+	LONG $0x583c41c4; BYTE $0xc1               // vaddps	%ymm9, %ymm8, %ymm8
+	LONG $0x197d43c4; WORD $0x01c1             // vextractf128	$0x1, %ymm8, %xmm9
+	LONG $0x583041c4; BYTE $0xc0               // vaddps	%xmm8, %xmm9, %xmm8
+	LONG $0x047943c4; WORD $0x4ec8             // vpermilps	$78, %xmm8, %xmm9
+	LONG $0x583041c4; BYTE $0xc8               // vaddps	%xmm8, %xmm9, %xmm9
+	LONG $0x287841c4; BYTE $0xc1               // vmovaps	%xmm9, %xmm8
+	LONG $0xc63041c4; WORD $0x55c9             // vshufps	$85, %xmm9, %xmm9, %xmm9
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JGE  BB0_17
+	WORD $0x8949; BYTE $0xcb                   // movq	%rcx, %r11
+	WORD $0x2949; BYTE $0xd3                   // subq	%rdx, %r11
+	LONG $0xff438d4d                           // leaq	-1(%r11), %r8
+	LONG $0x0ef88349                           // cmpq	$14, %r8
+	JBE  BB0_59
+	WORD $0x894d; BYTE $0xd9                   // movq	%r11, %r9
+	LONG $0x02048d4c                           // leaq	(%rdx,%rax), %r8
+	LONG $0x04e9c149                           // shrq	$4, %r9
+	LONG $0x87048d4e                           // leaq	(%rdi,%r8,4), %r8
+	LONG $0x06e1c149                           // salq	$6, %r9
+	WORD $0x014d; BYTE $0xc1                   // addq	%r8, %r9
+
+BB0_19:
+	LONG $0x487cd162; WORD $0x0810             // vmovups	(%r8), %zmm1
+	LONG $0x40c08349                           // addq	$64, %r8
+	LONG $0x48745162; WORD $0xcc5c             // vsubps	%zmm12, %zmm1, %zmm9
+	LONG $0x48345162; WORD $0xd159             // vmulps	%zmm9, %zmm9, %zmm10
+	LONG $0xc62841c4; WORD $0x55ca             // vshufps	$85, %xmm10, %xmm10, %xmm9
+	LONG $0xc62841c4; WORD $0xffea             // vshufps	$255, %xmm10, %xmm10, %xmm13
+	LONG $0x282d5362; WORD $0xda03; BYTE $0x07 // valignd	$7, %ymm10, %ymm10, %ymm11
+	LONG $0x583a41c4; BYTE $0xc2               // vaddss	%xmm10, %xmm8, %xmm8
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	LONG $0x152841c4; BYTE $0xca               // vunpckhps	%xmm10, %xmm10, %xmm9
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	LONG $0x287d5362; WORD $0xd119; BYTE $0x01 // vextractf32x4	$1, %ymm10, %xmm9
+	LONG $0x583a41c4; BYTE $0xc5               // vaddss	%xmm13, %xmm8, %xmm8
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	LONG $0x282d5362; WORD $0xca03; BYTE $0x05 // valignd	$5, %ymm10, %ymm10, %ymm9
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	LONG $0x282d5362; WORD $0xca03; BYTE $0x06 // valignd	$6, %ymm10, %ymm10, %ymm9
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	LONG $0x487d5362; WORD $0xd11b; BYTE $0x01 // vextractf32x8	$0x1, %zmm10, %ymm9
+	LONG $0xc63041c4; WORD $0xffd1             // vshufps	$255, %xmm9, %xmm9, %xmm10
+	LONG $0x583a41c4; BYTE $0xc3               // vaddss	%xmm11, %xmm8, %xmm8
+	LONG $0xc63041c4; WORD $0x55d9             // vshufps	$85, %xmm9, %xmm9, %xmm11
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	LONG $0x583a41c4; BYTE $0xc3               // vaddss	%xmm11, %xmm8, %xmm8
+	LONG $0x153041c4; BYTE $0xd9               // vunpckhps	%xmm9, %xmm9, %xmm11
+	LONG $0x583a41c4; BYTE $0xc3               // vaddss	%xmm11, %xmm8, %xmm8
+	LONG $0x583a41c4; BYTE $0xc2               // vaddss	%xmm10, %xmm8, %xmm8
+	LONG $0x287d5362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm9, %xmm10
+	LONG $0x583a41c4; BYTE $0xc2               // vaddss	%xmm10, %xmm8, %xmm8
+	LONG $0x28355362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm9, %ymm9, %ymm10
+	LONG $0x583a41c4; BYTE $0xc2               // vaddss	%xmm10, %xmm8, %xmm8
+	LONG $0x28355362; WORD $0xd103; BYTE $0x06 // valignd	$6, %ymm9, %ymm9, %ymm10
+	LONG $0x28355362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm9, %ymm9, %ymm9
+	LONG $0x583a41c4; BYTE $0xc2               // vaddss	%xmm10, %xmm8, %xmm8
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	WORD $0x394d; BYTE $0xc1                   // cmpq	%r8, %r9
+	JNE  BB0_19
+	WORD $0x894c; BYTE $0xdb                   // movq	%r11, %rbx
+	LONG $0xf0e38348                           // andq	$-16, %rbx
+	LONG $0x130c8d4c                           // leaq	(%rbx,%rdx), %r9
+	LONG $0x0fc3f641                           // testb	$15, %r11b
+	JE   BB0_17
+
+BB0_18:
+	WORD $0x2949; BYTE $0xdb                   // subq	%rbx, %r11
+	LONG $0xff438d4d                           // leaq	-1(%r11), %r8
+	LONG $0x06f88349                           // cmpq	$6, %r8
+	JBE  BB0_22
+	LONG $0x10048d4c                           // leaq	(%rax,%rdx), %r8
+	LONG $0x187d62c4; BYTE $0xc8               // vbroadcastss	%xmm0, %ymm9
+	WORD $0x014c; BYTE $0xc3                   // addq	%r8, %rbx
+	WORD $0x894d; BYTE $0xd8                   // movq	%r11, %r8
+	LONG $0x14107cc5; BYTE $0x9f               // vmovups	(%rdi,%rbx,4), %ymm10
+	LONG $0xf8e08349                           // andq	$-8, %r8
+	WORD $0x014d; BYTE $0xc1                   // addq	%r8, %r9
+	LONG $0x07e38341                           // andl	$7, %r11d
+	LONG $0x5c2c41c4; BYTE $0xd1               // vsubps	%ymm9, %ymm10, %ymm10
+	LONG $0x592c41c4; BYTE $0xd2               // vmulps	%ymm10, %ymm10, %ymm10
+	LONG $0x583a41c4; BYTE $0xc2               // vaddss	%xmm10, %xmm8, %xmm8
+	LONG $0xc62841c4; WORD $0x55ca             // vshufps	$85, %xmm10, %xmm10, %xmm9
+	LONG $0xc62841c4; WORD $0xffda             // vshufps	$255, %xmm10, %xmm10, %xmm11
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	LONG $0x152841c4; BYTE $0xca               // vunpckhps	%xmm10, %xmm10, %xmm9
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	LONG $0x287d5362; WORD $0xd119; BYTE $0x01 // vextractf32x4	$1, %ymm10, %xmm9
+	LONG $0x583a41c4; BYTE $0xc3               // vaddss	%xmm11, %xmm8, %xmm8
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	LONG $0x282d5362; WORD $0xca03; BYTE $0x05 // valignd	$5, %ymm10, %ymm10, %ymm9
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	LONG $0x282d5362; WORD $0xca03; BYTE $0x06 // valignd	$6, %ymm10, %ymm10, %ymm9
+	LONG $0x282d5362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm10, %ymm10, %ymm10
+	LONG $0x583a41c4; BYTE $0xc1               // vaddss	%xmm9, %xmm8, %xmm8
+	LONG $0x583a41c4; BYTE $0xc2               // vaddss	%xmm10, %xmm8, %xmm8
+	JE   BB0_17
+
+BB0_22:
+	LONG $0x08048d4e               // leaq	(%rax,%r9), %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0x01418d4d               // leaq	1(%r9), %r8
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0xb93142c4; BYTE $0xc1   // vfmadd231ss	%xmm9, %xmm9, %xmm8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_17
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0x02418d4d               // leaq	2(%r9), %r8
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0xb93142c4; BYTE $0xc1   // vfmadd231ss	%xmm9, %xmm9, %xmm8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_17
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0x03418d4d               // leaq	3(%r9), %r8
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0xb93142c4; BYTE $0xc1   // vfmadd231ss	%xmm9, %xmm9, %xmm8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_17
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0x04418d4d               // leaq	4(%r9), %r8
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0xb93142c4; BYTE $0xc1   // vfmadd231ss	%xmm9, %xmm9, %xmm8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_17
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0x05418d4d               // leaq	5(%r9), %r8
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0xb93142c4; BYTE $0xc1   // vfmadd231ss	%xmm9, %xmm9, %xmm8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_17
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x06c18349               // addq	$6, %r9
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0xb93142c4; BYTE $0xc1   // vfmadd231ss	%xmm9, %xmm9, %xmm8
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_17
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+	LONG $0x107a21c4; WORD $0x8f0c // vmovss	(%rdi,%r9,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0xb93142c4; BYTE $0xc1   // vfmadd231ss	%xmm9, %xmm9, %xmm8
+
+BB0_17:
+	LONG $0x994162c4; BYTE $0xc3   // vfmadd132ss	%xmm3, %xmm7, %xmm8
+	LONG $0x57247c80; BYTE $0x00   // cmpb	$0, 87(%rsp)
+	LONG $0x5a3a41c4; BYTE $0xc0   // vcvtss2sd	%xmm8, %xmm8, %xmm8
+	LONG $0x513b41c4; BYTE $0xc0   // vsqrtsd	%xmm8, %xmm8, %xmm8
+	LONG $0x5e4b41c4; BYTE $0xc0   // vdivsd	%xmm8, %xmm6, %xmm8
+	LONG $0x5a3b41c4; BYTE $0xc0   // vcvtsd2ss	%xmm8, %xmm8, %xmm8
+	LONG $0x487d5262; WORD $0xd018 // vbroadcastss	%xmm8, %zmm10
+	JNE  BB0_122
+	WORD $0x854d; BYTE $0xed       // testq	%r13, %r13
+	JE   BB0_123
+	LONG $0x0ff98348               // cmpq	$15, %rcx
+	JLE  BB0_40
+	LONG $0x0010b841; WORD $0x0000 // movl	$16, %r8d
+
+BB0_41:
+	QUAD $0xff864c10487cb162       // vmovups	-64(%rsi,%r8,4), %zmm1
+	LONG $0x48745162; WORD $0xcc5c // vsubps	%zmm12, %zmm1, %zmm9
+	LONG $0x48345162; WORD $0xca59 // vmulps	%zmm10, %zmm9, %zmm9
+	QUAD $0xff854c5948341162       // vmulps	-64(%r13,%r8,4), %zmm9, %zmm9
+	QUAD $0xff864c11487c1162       // vmovups	%zmm9, -64(%r14,%r8,4)
+	LONG $0x10c08349               // addq	$16, %r8
+	WORD $0x3949; BYTE $0xc8       // cmpq	%rcx, %r8
+	JLE  BB0_41
+
+BB0_40:
+	WORD $0x3948; BYTE $0xca                           // cmpq	%rcx, %rdx
+	JGE  BB0_33
+	WORD $0x8949; BYTE $0xcb                           // movq	%rcx, %r11
+	LONG $0x24548948; BYTE $0x18                       // movq	%rdx, 24(%rsp)
+	LONG $0x02048d4c                                   // leaq	(%rdx,%rax), %r8
+	WORD $0x2949; BYTE $0xd3                           // subq	%rdx, %r11
+	LONG $0xff5b8d49                                   // leaq	-1(%r11), %rbx
+	LONG $0x245c8948; BYTE $0x10                       // movq	%rbx, 16(%rsp)
+	LONG $0x06fb8348                                   // cmpq	$6, %rbx
+	JBE  BB0_124
+	LONG $0x014a8d4c                                   // leaq	1(%rdx), %r9
+	QUAD $0x00000000851c8d4a                           // leaq	0(,%r8,4), %rbx
+	LONG $0x244c894c; BYTE $0x60                       // movq	%r9, 96(%rsp)
+	LONG $0x02e1c149                                   // salq	$2, %r9
+	LONG $0x1a248d4d                                   // leaq	(%r10,%rbx), %r12
+	LONG $0x6ef9c1c4; BYTE $0xc9                       // vmovq	%r9, %xmm1
+	LONG $0x1f4c8d4c; BYTE $0x04                       // leaq	4(%rdi,%rbx), %r9
+	LONG $0x2464894c; BYTE $0x48                       // movq	%r12, 72(%rsp)
+	LONG $0x6ef941c4; BYTE $0xe9                       // vmovq	%r9, %xmm13
+	WORD $0x894d; BYTE $0xe1                           // movq	%r12, %r9
+	LONG $0x7ef941c4; BYTE $0xec                       // vmovq	%xmm13, %r12
+	WORD $0x294d; BYTE $0xe1                           // subq	%r12, %r9
+	LONG $0x38f98349                                   // cmpq	$56, %r9
+	JBE  BB0_42
+	LONG $0x7ef9c1c4; BYTE $0xc9                       // vmovq	%xmm1, %r9
+	WORD $0x014d; BYTE $0xe9                           // addq	%r13, %r9
+	LONG $0x6ef941c4; BYTE $0xe9                       // vmovq	%r9, %xmm13
+	LONG $0x244c8b4c; BYTE $0x48                       // movq	72(%rsp), %r9
+	LONG $0x7ef941c4; BYTE $0xec                       // vmovq	%xmm13, %r12
+	WORD $0x294d; BYTE $0xe1                           // subq	%r12, %r9
+	LONG $0x38f98349                                   // cmpq	$56, %r9
+	JBE  BB0_42
+	LONG $0x247c8348; WORD $0x0e10                     // cmpq	$14, 16(%rsp)
+	JBE  BB0_61
+	LONG $0x487c7162; WORD $0x0c10; BYTE $0x1f         // vmovups	(%rdi,%rbx), %zmm9
+	LONG $0x7ef9e1c4; BYTE $0xcb                       // vmovq	%xmm1, %rbx
+	LONG $0x24648b4c; BYTE $0x48                       // movq	72(%rsp), %r12
+	WORD $0x894d; BYTE $0xd9                           // movq	%r11, %r9
+	LONG $0xf0e18349                                   // andq	$-16, %r9
+	LONG $0x48345162; WORD $0xcc5c                     // vsubps	%zmm12, %zmm9, %zmm9
+	WORD $0x014c; BYTE $0xca                           // addq	%r9, %rdx
+	LONG $0x48345162; WORD $0xca59                     // vmulps	%zmm10, %zmm9, %zmm9
+	QUAD $0xfc1d8c5948345162; WORD $0xffff; BYTE $0xff // vmulps	-4(%r13,%rbx), %zmm9, %zmm9
+	LONG $0x487c5162; WORD $0x0c11; BYTE $0x24         // vmovups	%zmm9, (%r12)
+	LONG $0x0fc3f641                                   // testb	$15, %r11b
+	JE   BB0_33
+	WORD $0x294d; BYTE $0xcb                           // subq	%r9, %r11
+	LONG $0xff638d4d                                   // leaq	-1(%r11), %r12
+	LONG $0x06fc8349                                   // cmpq	$6, %r12
+	JBE  BB0_46
+
+BB0_43:
+	WORD $0x014d; BYTE $0xc8                   // addq	%r9, %r8
+	LONG $0x187d62c4; BYTE $0xc8               // vbroadcastss	%xmm0, %ymm9
+	LONG $0x245c8b48; BYTE $0x18               // movq	24(%rsp), %rbx
+	LONG $0x187d42c4; BYTE $0xd0               // vbroadcastss	%xmm8, %ymm10
+	LONG $0x107ca1c4; WORD $0x8714             // vmovups	(%rdi,%r8,4), %ymm2
+	WORD $0x014c; BYTE $0xcb                   // addq	%r9, %rbx
+	LONG $0x5c6c41c4; BYTE $0xc9               // vsubps	%ymm9, %ymm2, %ymm9
+	LONG $0x593441c4; BYTE $0xca               // vmulps	%ymm10, %ymm9, %ymm9
+	LONG $0x593441c4; WORD $0x9d4c; BYTE $0x00 // vmulps	0(%r13,%rbx,4), %ymm9, %ymm9
+	LONG $0x117c01c4; WORD $0x820c             // vmovups	%ymm9, (%r10,%r8,4)
+	WORD $0x894d; BYTE $0xd8                   // movq	%r11, %r8
+	LONG $0xf8e08349                           // andq	$-8, %r8
+	WORD $0x014c; BYTE $0xc2                   // addq	%r8, %rdx
+	LONG $0x07e38341                           // andl	$7, %r11d
+	JE   BB0_33
+
+BB0_46:
+	LONG $0x10048d4c                           // leaq	(%rax,%rdx), %r8
+	QUAD $0x00000000950c8d4c                   // leaq	0(,%rdx,4), %r9
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593241c4; WORD $0x954c; BYTE $0x00 // vmulss	0(%r13,%rdx,4), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x01428d4c                           // leaq	1(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x0d4c; BYTE $0x04 // vmulss	4(%r13,%r9), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x02428d4c                           // leaq	2(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x0d4c; BYTE $0x08 // vmulss	8(%r13,%r9), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x03428d4c                           // leaq	3(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x0d4c; BYTE $0x0c // vmulss	12(%r13,%r9), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x04428d4c                           // leaq	4(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x0d4c; BYTE $0x10 // vmulss	16(%r13,%r9), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x05428d4c                           // leaq	5(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x06c28348                           // addq	$6, %rdx
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x0d4c; BYTE $0x14 // vmulss	20(%r13,%r9), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_33
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x0c107ac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm9
+	LONG $0xc05cb2c5                           // vsubss	%xmm0, %xmm9, %xmm0
+	LONG $0x597ac1c4; BYTE $0xc0               // vmulss	%xmm8, %xmm0, %xmm0
+	LONG $0x597a81c4; WORD $0x0d44; BYTE $0x18 // vmulss	24(%r13,%r9), %xmm0, %xmm0
+	LONG $0x117ac1c4; WORD $0x9204             // vmovss	%xmm0, (%r10,%rdx,4)
+
+BB0_33:
+	LONG $0x7ef9e1c4; BYTE $0xe2   // vmovq	%xmm4, %rdx
+	LONG $0x24448348; WORD $0x0178 // addq	$1, 120(%rsp)
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	LONG $0x245c8b48; BYTE $0x78   // movq	120(%rsp), %rbx
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	WORD $0x0149; BYTE $0xd6       // addq	%rdx, %r14
+	LONG $0x245c3948; BYTE $0x58   // cmpq	%rbx, 88(%rsp)
+	JNE  BB0_28
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+
+BB0_118:
+	LONG $0xd0658d48 // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_122:
+	LONG $0x0ff98348               // cmpq	$15, %rcx
+	JLE  BB0_25
+	LONG $0x0010b841; WORD $0x0000 // movl	$16, %r8d
+
+BB0_26:
+	QUAD $0xff865410487cb162       // vmovups	-64(%rsi,%r8,4), %zmm2
+	QUAD $0xff874c10487c9162       // vmovups	-64(%r15,%r8,4), %zmm1
+	LONG $0x486c5162; WORD $0xcc5c // vsubps	%zmm12, %zmm2, %zmm9
+	LONG $0x48345162; WORD $0xca59 // vmulps	%zmm10, %zmm9, %zmm9
+	QUAD $0xff854c9848751262       // vfmadd132ps	-64(%r13,%r8,4), %zmm1, %zmm9
+	QUAD $0xff864c11487c1162       // vmovups	%zmm9, -64(%r14,%r8,4)
+	LONG $0x10c08349               // addq	$16, %r8
+	WORD $0x3949; BYTE $0xc8       // cmpq	%rcx, %r8
+	JLE  BB0_26
+
+BB0_25:
+	WORD $0x3948; BYTE $0xca                           // cmpq	%rcx, %rdx
+	JGE  BB0_33
+	WORD $0x8949; BYTE $0xcb                           // movq	%rcx, %r11
+	LONG $0x24548948; BYTE $0x10                       // movq	%rdx, 16(%rsp)
+	LONG $0x02048d4c                                   // leaq	(%rdx,%rax), %r8
+	WORD $0x2949; BYTE $0xd3                           // subq	%rdx, %r11
+	LONG $0xff5b8d49                                   // leaq	-1(%r11), %rbx
+	LONG $0x245c8948; BYTE $0x08                       // movq	%rbx, 8(%rsp)
+	LONG $0x06fb8348                                   // cmpq	$6, %rbx
+	JBE  BB0_125
+	LONG $0x014a8d4c                                   // leaq	1(%rdx), %r9
+	QUAD $0x00000000851c8d4a                           // leaq	0(,%r8,4), %rbx
+	LONG $0x244c894c; BYTE $0x60                       // movq	%r9, 96(%rsp)
+	LONG $0x02e1c149                                   // salq	$2, %r9
+	LONG $0x6ef961c4; BYTE $0xdb                       // vmovq	%rbx, %xmm11
+	WORD $0x014c; BYTE $0xd3                           // addq	%r10, %rbx
+	LONG $0x6ef9c1c4; BYTE $0xd1                       // vmovq	%r9, %xmm2
+	WORD $0x014d; BYTE $0xf9                           // addq	%r15, %r9
+	LONG $0x6ef9c1c4; BYTE $0xc9                       // vmovq	%r9, %xmm1
+	WORD $0x8949; BYTE $0xd9                           // movq	%rbx, %r9
+	LONG $0x7ef9c1c4; BYTE $0xcc                       // vmovq	%xmm1, %r12
+	WORD $0x294d; BYTE $0xe1                           // subq	%r12, %r9
+	LONG $0x38f98349                                   // cmpq	$56, %r9
+	LONG $0x7ef9c1c4; BYTE $0xd1                       // vmovq	%xmm2, %r9
+	LONG $0x2444970f; BYTE $0x48                       // seta	72(%rsp)
+	WORD $0x014d; BYTE $0xe9                           // addq	%r13, %r9
+	LONG $0x6ef941c4; BYTE $0xe9                       // vmovq	%r9, %xmm13
+	WORD $0x8949; BYTE $0xd9                           // movq	%rbx, %r9
+	LONG $0x7ef941c4; BYTE $0xec                       // vmovq	%xmm13, %r12
+	WORD $0x294d; BYTE $0xe1                           // subq	%r12, %r9
+	LONG $0x38f98349                                   // cmpq	$56, %r9
+	LONG $0x2444970f; BYTE $0x18                       // seta	24(%rsp)
+	LONG $0x4cb60f44; WORD $0x1824                     // movzbl	24(%rsp), %r9d
+	LONG $0x244c8444; BYTE $0x48                       // testb	%r9b, 72(%rsp)
+	JE   BB0_29
+	LONG $0x7ef941c4; BYTE $0xd9                       // vmovq	%xmm11, %r9
+	LONG $0x0f4c8d4e; BYTE $0x04                       // leaq	4(%rdi,%r9), %r9
+	LONG $0x6ef9c1c4; BYTE $0xc9                       // vmovq	%r9, %xmm1
+	WORD $0x8949; BYTE $0xd9                           // movq	%rbx, %r9
+	LONG $0x7ef9c1c4; BYTE $0xcc                       // vmovq	%xmm1, %r12
+	WORD $0x294d; BYTE $0xe1                           // subq	%r12, %r9
+	LONG $0x38f98349                                   // cmpq	$56, %r9
+	JBE  BB0_29
+	LONG $0x247c8348; WORD $0x0e08                     // cmpq	$14, 8(%rsp)
+	JBE  BB0_60
+	LONG $0x7ef941c4; BYTE $0xd9                       // vmovq	%xmm11, %r9
+	LONG $0x487c3162; WORD $0x1c10; BYTE $0x0f         // vmovups	(%rdi,%r9), %zmm11
+	LONG $0x7ef9c1c4; BYTE $0xd1                       // vmovq	%xmm2, %r9
+	QUAD $0xfc0d8c10487c1162; WORD $0xffff; BYTE $0xff // vmovups	-4(%r13,%r9), %zmm9
+	LONG $0x48245162; WORD $0xdc5c                     // vsubps	%zmm12, %zmm11, %zmm11
+	LONG $0x48245162; WORD $0xd259                     // vmulps	%zmm10, %zmm11, %zmm10
+	QUAD $0xfc0f8ca8482d1262; WORD $0xffff; BYTE $0xff // vfmadd213ps	-4(%r15,%r9), %zmm10, %zmm9
+	WORD $0x894d; BYTE $0xd9                           // movq	%r11, %r9
+	LONG $0xf0e18349                                   // andq	$-16, %r9
+	WORD $0x014c; BYTE $0xca                           // addq	%r9, %rdx
+	LONG $0x487c7162; WORD $0x0b11                     // vmovups	%zmm9, (%rbx)
+	LONG $0x0fc3f641                                   // testb	$15, %r11b
+	JE   BB0_33
+	WORD $0x294d; BYTE $0xcb                           // subq	%r9, %r11
+	LONG $0xff5b8d49                                   // leaq	-1(%r11), %rbx
+	LONG $0x06fb8348                                   // cmpq	$6, %rbx
+	JBE  BB0_34
+
+BB0_30:
+	WORD $0x014d; BYTE $0xc8                   // addq	%r9, %r8
+	LONG $0x187d62c4; BYTE $0xc8               // vbroadcastss	%xmm0, %ymm9
+	LONG $0x245c8b48; BYTE $0x10               // movq	16(%rsp), %rbx
+	LONG $0x187d42c4; BYTE $0xd0               // vbroadcastss	%xmm8, %ymm10
+	LONG $0x107ca1c4; WORD $0x870c             // vmovups	(%rdi,%r8,4), %ymm1
+	WORD $0x014c; BYTE $0xcb                   // addq	%r9, %rbx
+	LONG $0x5c7441c4; BYTE $0xc9               // vsubps	%ymm9, %ymm1, %ymm9
+	LONG $0x107cc1c4; WORD $0x9f0c             // vmovups	(%r15,%rbx,4), %ymm1
+	LONG $0x593441c4; BYTE $0xca               // vmulps	%ymm10, %ymm9, %ymm9
+	LONG $0x987542c4; WORD $0x9d4c; BYTE $0x00 // vfmadd132ps	0(%r13,%rbx,4), %ymm1, %ymm9
+	LONG $0x117c01c4; WORD $0x820c             // vmovups	%ymm9, (%r10,%r8,4)
+	WORD $0x894d; BYTE $0xd8                   // movq	%r11, %r8
+	LONG $0xf8e08349                           // andq	$-8, %r8
+	WORD $0x014c; BYTE $0xc2                   // addq	%r8, %rdx
+	LONG $0x07e38341                           // andl	$7, %r11d
+	JE   BB0_33
+
+BB0_34:
+	LONG $0x10048d4c                           // leaq	(%rax,%rdx), %r8
+	LONG $0x107ac1c4; WORD $0x9714             // vmovss	(%r15,%rdx,4), %xmm2
+	QUAD $0x00000000950c8d4c                   // leaq	0(,%rdx,4), %r9
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x996942c4; WORD $0x954c; BYTE $0x00 // vfmadd132ss	0(%r13,%rdx,4), %xmm2, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x01428d4c                           // leaq	1(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x0f54; BYTE $0x04 // vmovss	4(%r15,%r9), %xmm2
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x996902c4; WORD $0x0d4c; BYTE $0x04 // vfmadd132ss	4(%r13,%r9), %xmm2, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x02428d4c                           // leaq	2(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x0f54; BYTE $0x08 // vmovss	8(%r15,%r9), %xmm2
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x996902c4; WORD $0x0d4c; BYTE $0x08 // vfmadd132ss	8(%r13,%r9), %xmm2, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x03428d4c                           // leaq	3(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x0f54; BYTE $0x0c // vmovss	12(%r15,%r9), %xmm2
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x996902c4; WORD $0x0d4c; BYTE $0x0c // vfmadd132ss	12(%r13,%r9), %xmm2, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x04428d4c                           // leaq	4(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x0f4c; BYTE $0x10 // vmovss	16(%r15,%r9), %xmm1
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x997102c4; WORD $0x0d4c; BYTE $0x10 // vfmadd132ss	16(%r13,%r9), %xmm1, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x05428d4c                           // leaq	5(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x0f4c; BYTE $0x14 // vmovss	20(%r15,%r9), %xmm1
+	LONG $0x06c28348                           // addq	$6, %rdx
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x997102c4; WORD $0x0d4c; BYTE $0x14 // vfmadd132ss	20(%r13,%r9), %xmm1, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_33
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x107a81c4; WORD $0x0f54; BYTE $0x18 // vmovss	24(%r15,%r9), %xmm2
+	LONG $0x0c107ac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm9
+	LONG $0xc05cb2c5                           // vsubss	%xmm0, %xmm9, %xmm0
+	LONG $0x597ac1c4; BYTE $0xc0               // vmulss	%xmm8, %xmm0, %xmm0
+	LONG $0x996982c4; WORD $0x0d44; BYTE $0x18 // vfmadd132ss	24(%r13,%r9), %xmm2, %xmm0
+	LONG $0x117ac1c4; WORD $0x9204             // vmovss	%xmm0, (%r10,%rdx,4)
+	JMP  BB0_33
+
+BB0_124:
+	LONG $0x015a8d48             // leaq	1(%rdx), %rbx
+	LONG $0x245c8948; BYTE $0x60 // movq	%rbx, 96(%rsp)
+
+BB0_42:
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0x244c8b4c; BYTE $0x60               // movq	96(%rsp), %r9
+	QUAD $0x00000000951c8d4c                   // leaq	0(,%rdx,4), %r11
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593241c4; WORD $0x954c; BYTE $0x00 // vmulss	0(%r13,%rdx,4), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	WORD $0x394c; BYTE $0xc9                   // cmpq	%r9, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc1                   // addq	%rax, %r9
+	LONG $0x02428d4c                           // leaq	2(%rdx), %r8
+	LONG $0x107a21c4; WORD $0x8f0c             // vmovss	(%rdi,%r9,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x04 // vmulss	4(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x8a0c             // vmovss	%xmm9, (%r10,%r9,4)
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x08 // vmulss	8(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x03428d4c                           // leaq	3(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x0c // vmulss	12(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x04428d4c                           // leaq	4(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x10 // vmulss	16(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x05428d4c                           // leaq	5(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x14 // vmulss	20(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x06428d4c                           // leaq	6(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x18 // vmulss	24(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x07428d4c                           // leaq	7(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x1c // vmulss	28(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x08428d4c                           // leaq	8(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x20 // vmulss	32(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x09428d4c                           // leaq	9(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x24 // vmulss	36(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0a428d4c                           // leaq	10(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x28 // vmulss	40(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0b428d4c                           // leaq	11(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x2c // vmulss	44(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0c428d4c                           // leaq	12(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x30 // vmulss	48(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0d428d4c                           // leaq	13(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x34 // vmulss	52(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0e428d4c                           // leaq	14(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x0fc28348                           // addq	$15, %rdx
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x593201c4; WORD $0x1d4c; BYTE $0x38 // vmulss	56(%r13,%r11), %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_33
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x0c107ac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm9
+	LONG $0xc05cb2c5                           // vsubss	%xmm0, %xmm9, %xmm0
+	LONG $0x597ac1c4; BYTE $0xc0               // vmulss	%xmm8, %xmm0, %xmm0
+	LONG $0x597a81c4; WORD $0x1d44; BYTE $0x3c // vmulss	60(%r13,%r11), %xmm0, %xmm0
+	LONG $0x117ac1c4; WORD $0x9204             // vmovss	%xmm0, (%r10,%rdx,4)
+	JMP  BB0_33
+
+BB0_123:
+	LONG $0x0ff98348             // cmpq	$15, %rcx
+	JLE  BB0_39
+	LONG $0x245c8b48; BYTE $0x70 // movq	112(%rsp), %rbx
+	QUAD $0x0000000085048d4c     // leaq	0(,%rax,4), %r8
+	LONG $0x034c8d4c; BYTE $0x10 // leaq	16(%rbx,%rax), %r9
+	LONG $0x02e1c149             // salq	$2, %r9
+
+BB0_49:
+	LONG $0x487cb162; WORD $0x1410; BYTE $0x07 // vmovups	(%rdi,%r8), %zmm2
+	LONG $0x486c5162; WORD $0xcc5c             // vsubps	%zmm12, %zmm2, %zmm9
+	LONG $0x48345162; WORD $0xca59             // vmulps	%zmm10, %zmm9, %zmm9
+	LONG $0x487c1162; WORD $0x0c11; BYTE $0x02 // vmovups	%zmm9, (%r10,%r8)
+	LONG $0x40c08349                           // addq	$64, %r8
+	WORD $0x394d; BYTE $0xc1                   // cmpq	%r8, %r9
+	JNE  BB0_49
+
+BB0_39:
+	WORD $0x3948; BYTE $0xca     // cmpq	%rcx, %rdx
+	JGE  BB0_33
+	WORD $0x8949; BYTE $0xc9     // movq	%rcx, %r9
+	LONG $0x02048d4c             // leaq	(%rdx,%rax), %r8
+	WORD $0x2949; BYTE $0xd1     // subq	%rdx, %r9
+	LONG $0xff598d49             // leaq	-1(%r9), %rbx
+	LONG $0x245c8948; BYTE $0x60 // movq	%rbx, 96(%rsp)
+	LONG $0x06fb8348             // cmpq	$6, %rbx
+	JBE  BB0_50
+	QUAD $0x0000000085248d4e     // leaq	0(,%r8,4), %r12
+	LONG $0x275c8d4e; BYTE $0x04 // leaq	4(%rdi,%r12), %r11
+	LONG $0x221c8d4b             // leaq	(%r10,%r12), %rbx
+	LONG $0x6ef9c1c4; BYTE $0xcb // vmovq	%r11, %xmm1
+	LONG $0x245c8948; BYTE $0x48 // movq	%rbx, 72(%rsp)
+	WORD $0x8949; BYTE $0xdb     // movq	%rbx, %r11
+	LONG $0x7ef9e1c4; BYTE $0xcb // vmovq	%xmm1, %rbx
+	WORD $0x2949; BYTE $0xdb     // subq	%rbx, %r11
+	LONG $0x38fb8349             // cmpq	$56, %r11
+	JA   BB0_126
+
+BB0_50:
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x01428d4c               // leaq	1(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x02428d4c               // leaq	2(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x03428d4c               // leaq	3(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x04428d4c               // leaq	4(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x05428d4c               // leaq	5(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x06428d4c               // leaq	6(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x07428d4c               // leaq	7(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x08428d4c               // leaq	8(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x09428d4c               // leaq	9(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0a428d4c               // leaq	10(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0b428d4c               // leaq	11(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0c428d4c               // leaq	12(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0d428d4c               // leaq	13(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0e428d4c               // leaq	14(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x0fc28348               // addq	$15, %rdx
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_33
+
+BB0_120:
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x0c107ac5; BYTE $0x97   // vmovss	(%rdi,%rdx,4), %xmm9
+	LONG $0xc05cb2c5               // vsubss	%xmm0, %xmm9, %xmm0
+	LONG $0x597ac1c4; BYTE $0xc0   // vmulss	%xmm8, %xmm0, %xmm0
+	LONG $0x117ac1c4; WORD $0x9204 // vmovss	%xmm0, (%r10,%rdx,4)
+	JMP  BB0_33
+
+BB0_125:
+	LONG $0x015a8d48             // leaq	1(%rdx), %rbx
+	LONG $0x245c8948; BYTE $0x60 // movq	%rbx, 96(%rsp)
+
+BB0_29:
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0x107ac1c4; WORD $0x9714             // vmovss	(%r15,%rdx,4), %xmm2
+	QUAD $0x00000000951c8d4c                   // leaq	0(,%rdx,4), %r11
+	LONG $0x244c8b4c; BYTE $0x60               // movq	96(%rsp), %r9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x996942c4; WORD $0x954c; BYTE $0x00 // vfmadd132ss	0(%r13,%rdx,4), %xmm2, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	WORD $0x3949; BYTE $0xc9                   // cmpq	%rcx, %r9
+	JGE  BB0_33
+	WORD $0x0149; BYTE $0xc1                   // addq	%rax, %r9
+	LONG $0x107a81c4; WORD $0x1f4c; BYTE $0x04 // vmovss	4(%r15,%r11), %xmm1
+	LONG $0x02428d4c                           // leaq	2(%rdx), %r8
+	LONG $0x107a21c4; WORD $0x8f0c             // vmovss	(%rdi,%r9,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x997102c4; WORD $0x1d4c; BYTE $0x04 // vfmadd132ss	4(%r13,%r11), %xmm1, %xmm9
+	LONG $0x117a01c4; WORD $0x8a0c             // vmovss	%xmm9, (%r10,%r9,4)
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f54; BYTE $0x08 // vmovss	8(%r15,%r11), %xmm2
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x996902c4; WORD $0x1d4c; BYTE $0x08 // vfmadd132ss	8(%r13,%r11), %xmm2, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x03428d4c                           // leaq	3(%rdx), %r8
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JGE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f4c; BYTE $0x0c // vmovss	12(%r15,%r11), %xmm1
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x997102c4; WORD $0x1d4c; BYTE $0x0c // vfmadd132ss	12(%r13,%r11), %xmm1, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x04428d4c                           // leaq	4(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f4c; BYTE $0x10 // vmovss	16(%r15,%r11), %xmm1
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x997102c4; WORD $0x1d4c; BYTE $0x10 // vfmadd132ss	16(%r13,%r11), %xmm1, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x05428d4c                           // leaq	5(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f4c; BYTE $0x14 // vmovss	20(%r15,%r11), %xmm1
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x997102c4; WORD $0x1d4c; BYTE $0x14 // vfmadd132ss	20(%r13,%r11), %xmm1, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x06428d4c                           // leaq	6(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f4c; BYTE $0x18 // vmovss	24(%r15,%r11), %xmm1
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x997102c4; WORD $0x1d4c; BYTE $0x18 // vfmadd132ss	24(%r13,%r11), %xmm1, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x07428d4c                           // leaq	7(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f54; BYTE $0x1c // vmovss	28(%r15,%r11), %xmm2
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x996902c4; WORD $0x1d4c; BYTE $0x1c // vfmadd132ss	28(%r13,%r11), %xmm2, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x08428d4c                           // leaq	8(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f54; BYTE $0x20 // vmovss	32(%r15,%r11), %xmm2
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x996902c4; WORD $0x1d4c; BYTE $0x20 // vfmadd132ss	32(%r13,%r11), %xmm2, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x09428d4c                           // leaq	9(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f4c; BYTE $0x24 // vmovss	36(%r15,%r11), %xmm1
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x997102c4; WORD $0x1d4c; BYTE $0x24 // vfmadd132ss	36(%r13,%r11), %xmm1, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0a428d4c                           // leaq	10(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f4c; BYTE $0x28 // vmovss	40(%r15,%r11), %xmm1
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x997102c4; WORD $0x1d4c; BYTE $0x28 // vfmadd132ss	40(%r13,%r11), %xmm1, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0b428d4c                           // leaq	11(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f54; BYTE $0x2c // vmovss	44(%r15,%r11), %xmm2
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x996902c4; WORD $0x1d4c; BYTE $0x2c // vfmadd132ss	44(%r13,%r11), %xmm2, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0c428d4c                           // leaq	12(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f4c; BYTE $0x30 // vmovss	48(%r15,%r11), %xmm1
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x997102c4; WORD $0x1d4c; BYTE $0x30 // vfmadd132ss	48(%r13,%r11), %xmm1, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0d428d4c                           // leaq	13(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f4c; BYTE $0x34 // vmovss	52(%r15,%r11), %xmm1
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x997102c4; WORD $0x1d4c; BYTE $0x34 // vfmadd132ss	52(%r13,%r11), %xmm1, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x0e428d4c                           // leaq	14(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	LONG $0x107a81c4; WORD $0x1f54; BYTE $0x38 // vmovss	56(%r15,%r11), %xmm2
+	LONG $0x0fc28348                           // addq	$15, %rdx
+	LONG $0x107a21c4; WORD $0x870c             // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5                           // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8               // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x996902c4; WORD $0x1d4c; BYTE $0x38 // vfmadd132ss	56(%r13,%r11), %xmm2, %xmm9
+	LONG $0x117a01c4; WORD $0x820c             // vmovss	%xmm9, (%r10,%r8,4)
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_33
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x107a81c4; WORD $0x1f54; BYTE $0x3c // vmovss	60(%r15,%r11), %xmm2
+	LONG $0x0c107ac5; BYTE $0x97               // vmovss	(%rdi,%rdx,4), %xmm9
+	LONG $0xc05cb2c5                           // vsubss	%xmm0, %xmm9, %xmm0
+	LONG $0x597ac1c4; BYTE $0xc0               // vmulss	%xmm8, %xmm0, %xmm0
+	LONG $0x996982c4; WORD $0x1d44; BYTE $0x3c // vfmadd132ss	60(%r13,%r11), %xmm2, %xmm0
+	LONG $0x117ac1c4; WORD $0x9204             // vmovss	%xmm0, (%r10,%rdx,4)
+	JMP  BB0_33
+
+BB0_7:
+	LONG $0xc059e2c5               // vmulss	%xmm0, %xmm3, %xmm0
+	WORD $0x8948; BYTE $0xda       // movq	%rbx, %rdx
+	LONG $0x487d7262; WORD $0xe018 // vbroadcastss	%xmm0, %zmm12
+	JMP  BB0_11
+
+BB0_5:
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x8949; BYTE $0xcb // movq	%rcx, %r11
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	WORD $0xd231             // xorl	%edx, %edx
+	WORD $0xdb31             // xorl	%ebx, %ebx
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_8
+
+BB0_59:
+	WORD $0x8949; BYTE $0xd1 // movq	%rdx, %r9
+	WORD $0xdb31             // xorl	%ebx, %ebx
+	JMP  BB0_18
+
+BB0_126:
+	LONG $0x247c8348; WORD $0x0e60             // cmpq	$14, 96(%rsp)
+	JBE  BB0_62
+	LONG $0x487c3162; WORD $0x0c10; BYTE $0x27 // vmovups	(%rdi,%r12), %zmm9
+	LONG $0x245c8b48; BYTE $0x48               // movq	72(%rsp), %rbx
+	WORD $0x894d; BYTE $0xcb                   // movq	%r9, %r11
+	LONG $0xf0e38349                           // andq	$-16, %r11
+	LONG $0x48345162; WORD $0xcc5c             // vsubps	%zmm12, %zmm9, %zmm9
+	WORD $0x014c; BYTE $0xda                   // addq	%r11, %rdx
+	LONG $0x48345162; WORD $0xca59             // vmulps	%zmm10, %zmm9, %zmm9
+	LONG $0x487c7162; WORD $0x0b11             // vmovups	%zmm9, (%rbx)
+	LONG $0x0fc1f641                           // testb	$15, %r9b
+	JE   BB0_33
+	WORD $0x294d; BYTE $0xd9                   // subq	%r11, %r9
+	LONG $0xff598d49                           // leaq	-1(%r9), %rbx
+	LONG $0x06fb8348                           // cmpq	$6, %rbx
+	JBE  BB0_54
+
+BB0_51:
+	WORD $0x014d; BYTE $0xc3       // addq	%r8, %r11
+	LONG $0x187d62c4; BYTE $0xc8   // vbroadcastss	%xmm0, %ymm9
+	LONG $0x187d42c4; BYTE $0xd0   // vbroadcastss	%xmm8, %ymm10
+	WORD $0x894d; BYTE $0xc8       // movq	%r9, %r8
+	LONG $0x107ca1c4; WORD $0x9f14 // vmovups	(%rdi,%r11,4), %ymm2
+	LONG $0xf8e08349               // andq	$-8, %r8
+	WORD $0x014c; BYTE $0xc2       // addq	%r8, %rdx
+	LONG $0x07e18341               // andl	$7, %r9d
+	LONG $0x5c6c41c4; BYTE $0xc9   // vsubps	%ymm9, %ymm2, %ymm9
+	LONG $0x593441c4; BYTE $0xca   // vmulps	%ymm10, %ymm9, %ymm9
+	LONG $0x117c01c4; WORD $0x9a0c // vmovups	%ymm9, (%r10,%r11,4)
+	JE   BB0_33
+
+BB0_54:
+	LONG $0x10048d4c               // leaq	(%rax,%rdx), %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x01428d4c               // leaq	1(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x02428d4c               // leaq	2(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x03428d4c               // leaq	3(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x04428d4c               // leaq	4(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	LONG $0x05428d4c               // leaq	5(%rdx), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_33
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x06c28348               // addq	$6, %rdx
+	LONG $0x107a21c4; WORD $0x870c // vmovss	(%rdi,%r8,4), %xmm9
+	LONG $0xc85c32c5               // vsubss	%xmm0, %xmm9, %xmm9
+	LONG $0x593241c4; BYTE $0xc8   // vmulss	%xmm8, %xmm9, %xmm9
+	LONG $0x117a01c4; WORD $0x820c // vmovss	%xmm9, (%r10,%r8,4)
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JG   BB0_120
+	JMP  BB0_33
+
+BB0_57:
+	WORD $0x8949; BYTE $0xd8 // movq	%rbx, %r8
+	WORD $0x8949; BYTE $0xd9 // movq	%rbx, %r9
+	WORD $0x8948; BYTE $0xda // movq	%rbx, %rdx
+	WORD $0xdb31             // xorl	%ebx, %ebx
+	JMP  BB0_8
+
+BB0_61:
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	JMP  BB0_43
+
+BB0_60:
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	JMP  BB0_30
+
+BB0_62:
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	JMP  BB0_51
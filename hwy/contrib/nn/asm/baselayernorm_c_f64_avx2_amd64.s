@@ -0,0 +1,677 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baselayernorm_c_f64_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x00000000
+DATA CPI0_0<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $8
+
+TEXT ·layernorm_c_f64_avx2(SB), $224-80
+	MOVQ   input+0(FP), DI
+	MOVQ   output+8(FP), SI
+	MOVQ   pnormSize+16(FP), DX
+	MOVQ   gamma+24(FP), CX
+	MOVQ   beta+32(FP), R8
+	MOVQ   pepsilon+40(FP), R9
+	MOVQ   plen_input+48(FP), R11
+	MOVQ   R11, 192(SP)
+	MOVQ   plen_output+56(FP), R11
+	MOVQ   R11, 200(SP)
+	MOVQ   plen_gamma+64(FP), R11
+	MOVQ   R11, 208(SP)
+	MOVQ   plen_beta+72(FP), R11
+	MOVQ   R11, 216(SP)
+	QUAD   $0x000000b024ac8d48                   // leaq	176(%rsp), %rbp
+	WORD   $0x8949; BYTE $0xcf                   // movq	%rcx, %r15
+	LONG   $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG   $0xe0e48348                           // andq	$-32, %rsp
+	WORD   $0x8b48; BYTE $0x0a                   // movq	(%rdx), %rcx
+	LONG   $0x10458b48                           // movq	16(%rbp), %rax
+	LONG   $0x18558b48                           // movq	24(%rbp), %rdx
+	WORD   $0x8b48; BYTE $0x00                   // movq	(%rax), %rax
+	WORD   $0x8b48; BYTE $0x12                   // movq	(%rdx), %rdx
+	WORD   $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	LONG   $0xc24f0f48                           // cmovg	%rdx, %rax
+	WORD   $0x8548; BYTE $0xc0                   // testq	%rax, %rax
+	JE     BB0_132
+	WORD   $0x8548; BYTE $0xc9                   // testq	%rcx, %rcx
+	JLE    BB0_132
+	WORD   $0x9948                               // cqto
+	LONG   $0xdb57e0c5                           // vxorps	%xmm3, %xmm3, %xmm3
+	VMOVSD CPI0_0<>(SB), X4                      // vmovsd	.LCPI0_0(%rip), %xmm4
+	WORD   $0xf748; BYTE $0xf9                   // idivq	%rcx
+	LONG   $0x2ae3e1c4; BYTE $0xd9               // vcvtsi2sdq	%rcx, %xmm3, %xmm3
+	LONG   $0xdb5edbc5                           // vdivsd	%xmm3, %xmm4, %xmm3
+	LONG   $0x24448948; BYTE $0x78               // movq	%rax, 120(%rsp)
+	WORD   $0x8548; BYTE $0xc0                   // testq	%rax, %rax
+	JLE    BB0_132
+	WORD   $0x854d; BYTE $0xff                   // testq	%r15, %r15
+	WORD   $0x8949; BYTE $0xf3                   // movq	%rsi, %r11
+	WORD   $0x8949; BYTE $0xf5                   // movq	%rsi, %r13
+	LONG   $0x107bc1c4; BYTE $0x29               // vmovsd	(%r9), %xmm5
+	WORD   $0x950f; BYTE $0xc2                   // setne	%dl
+	WORD   $0x854d; BYTE $0xc0                   // testq	%r8, %r8
+	WORD   $0x894d; BYTE $0xc6                   // movq	%r8, %r14
+	QUAD   $0x000000982484c748; LONG $0x00000000 // movq	$0, 152(%rsp)
+	WORD   $0x950f; BYTE $0xc0                   // setne	%al
+	WORD   $0xdb31                               // xorl	%ebx, %ebx
+	WORD   $0xc221                               // andl	%eax, %edx
+	QUAD   $0x00000000cd048d48                   // leaq	0(,%rcx,8), %rax
+	LONG   $0x24448948; BYTE $0x68               // movq	%rax, 104(%rsp)
+	LONG   $0xfc418d48                           // leaq	-4(%rcx), %rax
+	LONG   $0x77245488                           // movb	%dl, 119(%rsp)
+	WORD   $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	LONG   $0xfce08348                           // andq	$-4, %rax
+	LONG   $0x02eac148                           // shrq	$2, %rdx
+	WORD   $0x8949; BYTE $0xc2                   // movq	%rax, %r10
+	QUAD   $0x0000009024848948                   // movq	%rax, 144(%rsp)
+	LONG   $0x20478d48                           // leaq	32(%rdi), %rax
+	QUAD   $0x0000000495248d4c                   // leaq	4(,%rdx,4), %r12
+	QUAD   $0x0000008824848948                   // movq	%rax, 136(%rsp)
+	WORD   $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	WORD   $0x8948; BYTE $0xfa                   // movq	%rdi, %rdx
+	WORD   $0x294c; BYTE $0xe0                   // subq	%r12, %rax
+	LONG   $0xff708d48                           // leaq	-1(%rax), %rsi
+	LONG   $0x24748948; BYTE $0x48               // movq	%rsi, 72(%rsp)
+	WORD   $0x8948; BYTE $0xc6                   // movq	%rax, %rsi
+	LONG   $0x02eec148                           // shrq	$2, %rsi
+	LONG   $0x05e6c148                           // salq	$5, %rsi
+	LONG   $0x24748948; BYTE $0x58               // movq	%rsi, 88(%rsp)
+	WORD   $0x8948; BYTE $0xc6                   // movq	%rax, %rsi
+	LONG   $0xfce08348                           // andq	$-4, %rax
+	WORD   $0x014c; BYTE $0xe0                   // addq	%r12, %rax
+	WORD   $0xe683; BYTE $0x03                   // andl	$3, %esi
+	LONG   $0x24448948; BYTE $0x38               // movq	%rax, 56(%rsp)
+	LONG   $0x04428d49                           // leaq	4(%r10), %rax
+	LONG   $0x24748948; BYTE $0x50               // movq	%rsi, 80(%rsp)
+	LONG   $0x24448948; BYTE $0x20               // movq	%rax, 32(%rsp)
+
+BB0_26:
+	LONG $0x03f98348         // cmpq	$3, %rcx
+	JLE  BB0_5
+	QUAD $0x0000009024848b48 // movq	144(%rsp), %rax
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x18348d48         // leaq	(%rax,%rbx), %rsi
+	QUAD $0x0000008824848b48 // movq	136(%rsp), %rax
+	LONG $0xf0048d4c         // leaq	(%rax,%rsi,8), %r8
+	WORD $0x8948; BYTE $0xd0 // movq	%rdx, %rax
+
+BB0_6:
+	LONG $0x0058fdc5               // vaddpd	(%rax), %ymm0, %ymm0
+	LONG $0x20c08348               // addq	$32, %rax
+	WORD $0x394c; BYTE $0xc0       // cmpq	%r8, %rax
+	JNE  BB0_6
+	LONG $0x197de3c4; WORD $0x01c1 // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xe1       // cmpq	%r12, %rcx
+	JLE  BB0_7
+	LONG $0x247c8348; WORD $0x0248 // cmpq	$2, 72(%rsp)
+	JBE  BB0_56
+	LONG $0x24748b48; BYTE $0x58   // movq	88(%rsp), %rsi
+	LONG $0x1c048d49               // leaq	(%r12,%rbx), %rax
+	LONG $0xc7048d48               // leaq	(%rdi,%rax,8), %rax
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+
+BB0_9:
+	LONG $0x0058fbc5               // vaddsd	(%rax), %xmm0, %xmm0
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0x4058fbc5; BYTE $0xe8   // vaddsd	-24(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xf0   // vaddsd	-16(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xf8   // vaddsd	-8(%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xf0       // cmpq	%rsi, %rax
+	JNE  BB0_9
+	LONG $0x247c8348; WORD $0x0050 // cmpq	$0, 80(%rsp)
+	WORD $0x894c; BYTE $0xe0       // movq	%r12, %rax
+	JE   BB0_13
+	LONG $0x24748b48; BYTE $0x38   // movq	56(%rsp), %rsi
+
+BB0_8:
+	LONG $0x33048d4c               // leaq	(%rbx,%rsi), %r8
+	LONG $0x587ba1c4; WORD $0xc704 // vaddsd	(%rdi,%r8,8), %xmm0, %xmm0
+	LONG $0x01468d4c               // leaq	1(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xd8       // addq	%rbx, %r8
+	LONG $0x02c68348               // addq	$2, %rsi
+	LONG $0x587ba1c4; WORD $0xc704 // vaddsd	(%rdi,%r8,8), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xce       // cmpq	%rcx, %rsi
+	JGE  BB0_13
+	WORD $0x0148; BYTE $0xde       // addq	%rbx, %rsi
+	LONG $0x0458fbc5; BYTE $0xf7   // vaddsd	(%rdi,%rsi,8), %xmm0, %xmm0
+
+BB0_13:
+	LONG $0xc059e3c5             // vmulsd	%xmm0, %xmm3, %xmm0
+	QUAD $0x0000009024b48b48     // movq	144(%rsp), %rsi
+	WORD $0x0148; BYTE $0xde     // addq	%rbx, %rsi
+	LONG $0x197de2c4; BYTE $0xf8 // vbroadcastsd	%xmm0, %ymm7
+	LONG $0x03f98348             // cmpq	$3, %rcx
+	JLE  BB0_136
+
+BB0_11:
+	QUAD $0x0000008824948b4c // movq	136(%rsp), %r10
+	LONG $0xd257e9c5         // vxorpd	%xmm2, %xmm2, %xmm2
+	LONG $0xf2048d4d         // leaq	(%r10,%rsi,8), %r8
+	WORD $0x8948; BYTE $0xd6 // movq	%rdx, %rsi
+
+BB0_14:
+	LONG $0x3610fdc5               // vmovupd	(%rsi), %ymm6
+	LONG $0x20c68348               // addq	$32, %rsi
+	LONG $0xcf5ccdc5               // vsubpd	%ymm7, %ymm6, %ymm1
+	LONG $0xb8f5e2c4; BYTE $0xd1   // vfmadd231pd	%ymm1, %ymm1, %ymm2
+	WORD $0x3949; BYTE $0xf0       // cmpq	%rsi, %r8
+	JNE  BB0_14
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xca58f1c5               // vaddpd	%xmm2, %xmm1, %xmm1
+	LONG $0xd115f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0xca58f3c5               // vaddsd	%xmm2, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xc8       // cmpq	%rcx, %rax
+	JGE  BB0_15
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	WORD $0x2949; BYTE $0xc1       // subq	%rax, %r9
+	LONG $0xff718d49               // leaq	-1(%r9), %rsi
+	LONG $0x02fe8348               // cmpq	$2, %rsi
+	JBE  BB0_58
+
+BB0_142:
+	WORD $0x894d; BYTE $0xc8 // movq	%r9, %r8
+	LONG $0x03348d48         // leaq	(%rbx,%rax), %rsi
+	LONG $0x02e8c149         // shrq	$2, %r8
+	LONG $0xf7348d48         // leaq	(%rdi,%rsi,8), %rsi
+	LONG $0x05e0c149         // salq	$5, %r8
+	WORD $0x0149; BYTE $0xf0 // addq	%rsi, %r8
+
+BB0_17:
+	LONG $0x3610fdc5               // vmovupd	(%rsi), %ymm6
+	LONG $0x20c68348               // addq	$32, %rsi
+	LONG $0xd75ccdc5               // vsubpd	%ymm7, %ymm6, %ymm2
+	LONG $0xd259edc5               // vmulpd	%ymm2, %ymm2, %ymm2
+	LONG $0xca58f3c5               // vaddsd	%xmm2, %xmm1, %xmm1
+	LONG $0xc21569c5               // vunpckhpd	%xmm2, %xmm2, %xmm8
+	LONG $0x197de3c4; WORD $0x01d2 // vextractf128	$0x1, %ymm2, %xmm2
+	LONG $0x5873c1c4; BYTE $0xc8   // vaddsd	%xmm8, %xmm1, %xmm1
+	LONG $0xca58f3c5               // vaddsd	%xmm2, %xmm1, %xmm1
+	LONG $0xd215e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xca58f3c5               // vaddsd	%xmm2, %xmm1, %xmm1
+	WORD $0x3949; BYTE $0xf0       // cmpq	%rsi, %r8
+	JNE  BB0_17
+	LONG $0x03c1f641               // testb	$3, %r9b
+	JE   BB0_15
+	WORD $0x894d; BYTE $0xca       // movq	%r9, %r10
+	LONG $0xfce28349               // andq	$-4, %r10
+	LONG $0x02048d4d               // leaq	(%r10,%rax), %r8
+
+BB0_16:
+	WORD $0x294d; BYTE $0xd1       // subq	%r10, %r9
+	LONG $0x01f98349               // cmpq	$1, %r9
+	JE   BB0_20
+	LONG $0x03348d48               // leaq	(%rbx,%rax), %rsi
+	LONG $0xf012fbc5               // vmovddup	%xmm0, %xmm6
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	LONG $0x1079a1c4; WORD $0xd714 // vmovupd	(%rdi,%r10,8), %xmm2
+	LONG $0xd65ce9c5               // vsubpd	%xmm6, %xmm2, %xmm2
+	LONG $0xd259e9c5               // vmulpd	%xmm2, %xmm2, %xmm2
+	LONG $0xca58f3c5               // vaddsd	%xmm2, %xmm1, %xmm1
+	LONG $0xd215e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xc958ebc5               // vaddsd	%xmm1, %xmm2, %xmm1
+	LONG $0x01c1f641               // testb	$1, %r9b
+	JE   BB0_15
+	LONG $0xfee18349               // andq	$-2, %r9
+	WORD $0x014d; BYTE $0xc8       // addq	%r9, %r8
+
+BB0_20:
+	WORD $0x0149; BYTE $0xd8       // addq	%rbx, %r8
+	LONG $0x107ba1c4; WORD $0xc714 // vmovsd	(%rdi,%r8,8), %xmm2
+	LONG $0xd05cebc5               // vsubsd	%xmm0, %xmm2, %xmm2
+	LONG $0xb9e9e2c4; BYTE $0xca   // vfmadd231sd	%xmm2, %xmm2, %xmm1
+
+BB0_15:
+	LONG $0x99d1e2c4; BYTE $0xcb // vfmadd132sd	%xmm3, %xmm5, %xmm1
+	LONG $0x77247c80; BYTE $0x00 // cmpb	$0, 119(%rsp)
+	LONG $0xc951f3c5             // vsqrtsd	%xmm1, %xmm1, %xmm1
+	LONG $0xc95edbc5             // vdivsd	%xmm1, %xmm4, %xmm1
+	LONG $0x197de2c4; BYTE $0xf1 // vbroadcastsd	%xmm1, %ymm6
+	JNE  BB0_137
+	WORD $0x854d; BYTE $0xff     // testq	%r15, %r15
+	JE   BB0_138
+	LONG $0x03f98348             // cmpq	$3, %rcx
+	JLE  BB0_38
+	LONG $0x000004be; BYTE $0x00 // movl	$4, %esi
+
+BB0_39:
+	LONG $0x5410fdc5; WORD $0xe0f2             // vmovupd	-32(%rdx,%rsi,8), %ymm2
+	LONG $0xd75cedc5                           // vsubpd	%ymm7, %ymm2, %ymm2
+	LONG $0xd659edc5                           // vmulpd	%ymm6, %ymm2, %ymm2
+	LONG $0x596dc1c4; WORD $0xf754; BYTE $0xe0 // vmulpd	-32(%r15,%rsi,8), %ymm2, %ymm2
+	LONG $0x117dc1c4; WORD $0xf354; BYTE $0xe0 // vmovupd	%ymm2, -32(%r11,%rsi,8)
+	LONG $0x04c68348                           // addq	$4, %rsi
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_39
+
+BB0_38:
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JGE  BB0_31
+	WORD $0x8949; BYTE $0xc9                   // movq	%rcx, %r9
+	LONG $0x24448948; BYTE $0x30               // movq	%rax, 48(%rsp)
+	LONG $0x18348d48                           // leaq	(%rax,%rbx), %rsi
+	WORD $0x2949; BYTE $0xc1                   // subq	%rax, %r9
+	LONG $0x01f98349                           // cmpq	$1, %r9
+	JE   BB0_139
+	QUAD $0x00000000f5148d4c                   // leaq	0(,%rsi,8), %r10
+	LONG $0x15448d4f; BYTE $0x00               // leaq	0(%r13,%r10), %r8
+	LONG $0x2454894c; BYTE $0x28               // movq	%r10, 40(%rsp)
+	QUAD $0x000000802484894c                   // movq	%r8, 128(%rsp)
+	LONG $0x01408d4c                           // leaq	1(%rax), %r8
+	LONG $0x2444894c; BYTE $0x60               // movq	%r8, 96(%rsp)
+	LONG $0x03e0c149                           // salq	$3, %r8
+	LONG $0x2444894c; BYTE $0x40               // movq	%r8, 64(%rsp)
+	LONG $0x17448d4e; BYTE $0x08               // leaq	8(%rdi,%r10), %r8
+	WORD $0x894d; BYTE $0xc2                   // movq	%r8, %r10
+	QUAD $0x0000008024848b4c                   // movq	128(%rsp), %r8
+	WORD $0x294d; BYTE $0xd0                   // subq	%r10, %r8
+	LONG $0x10f88349                           // cmpq	$16, %r8
+	JBE  BB0_40
+	LONG $0x24448b4c; BYTE $0x40               // movq	64(%rsp), %r8
+	LONG $0x07148d4f                           // leaq	(%r15,%r8), %r10
+	QUAD $0x0000008024848b4c                   // movq	128(%rsp), %r8
+	WORD $0x294d; BYTE $0xd0                   // subq	%r10, %r8
+	LONG $0x10f88349                           // cmpq	$16, %r8
+	JBE  BB0_40
+	LONG $0xff418d4d                           // leaq	-1(%r9), %r8
+	LONG $0x02f88349                           // cmpq	$2, %r8
+	JBE  BB0_60
+	LONG $0x24548b4c; BYTE $0x28               // movq	40(%rsp), %r10
+	QUAD $0x0000008024848b4c                   // movq	128(%rsp), %r8
+	LONG $0x107da1c4; WORD $0x1714             // vmovupd	(%rdi,%r10), %ymm2
+	LONG $0x24548b4c; BYTE $0x40               // movq	64(%rsp), %r10
+	LONG $0xd75cedc5                           // vsubpd	%ymm7, %ymm2, %ymm2
+	LONG $0xd659edc5                           // vmulpd	%ymm6, %ymm2, %ymm2
+	LONG $0x596d81c4; WORD $0x1754; BYTE $0xf8 // vmulpd	-8(%r15,%r10), %ymm2, %ymm2
+	LONG $0x117dc1c4; BYTE $0x10               // vmovupd	%ymm2, (%r8)
+	WORD $0x894d; BYTE $0xc8                   // movq	%r9, %r8
+	LONG $0xfce08349                           // andq	$-4, %r8
+	WORD $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+	LONG $0x03c1f641                           // testb	$3, %r9b
+	JE   BB0_31
+	WORD $0x294d; BYTE $0xc1                   // subq	%r8, %r9
+	LONG $0x01f98349                           // cmpq	$1, %r9
+	JE   BB0_44
+
+BB0_41:
+	WORD $0x014c; BYTE $0xc6                   // addq	%r8, %rsi
+	LONG $0xd012fbc5                           // vmovddup	%xmm0, %xmm2
+	LONG $0x24548b4c; BYTE $0x30               // movq	48(%rsp), %r10
+	LONG $0xf112fbc5                           // vmovddup	%xmm1, %xmm6
+	LONG $0x3c10f9c5; BYTE $0xf7               // vmovupd	(%rdi,%rsi,8), %xmm7
+	WORD $0x014d; BYTE $0xc2                   // addq	%r8, %r10
+	LONG $0xd25cc1c5                           // vsubpd	%xmm2, %xmm7, %xmm2
+	LONG $0xd659e9c5                           // vmulpd	%xmm6, %xmm2, %xmm2
+	LONG $0x596981c4; WORD $0xd714             // vmulpd	(%r15,%r10,8), %xmm2, %xmm2
+	LONG $0x1179c1c4; WORD $0xf554; BYTE $0x00 // vmovupd	%xmm2, 0(%r13,%rsi,8)
+	LONG $0x01c1f641                           // testb	$1, %r9b
+	JE   BB0_31
+	LONG $0xfee18349                           // andq	$-2, %r9
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+
+BB0_44:
+	LONG $0x03348d48                           // leaq	(%rbx,%rax), %rsi
+	LONG $0x1410fbc5; BYTE $0xf7               // vmovsd	(%rdi,%rsi,8), %xmm2
+	LONG $0xc05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm0
+	LONG $0xc159fbc5                           // vmulsd	%xmm1, %xmm0, %xmm0
+	LONG $0x597bc1c4; WORD $0xc704             // vmulsd	(%r15,%rax,8), %xmm0, %xmm0
+	LONG $0x117bc1c4; WORD $0xf544; BYTE $0x00 // vmovsd	%xmm0, 0(%r13,%rsi,8)
+
+BB0_31:
+	LONG $0x24748b48; BYTE $0x68         // movq	104(%rsp), %rsi
+	WORD $0x0148; BYTE $0xcb             // addq	%rcx, %rbx
+	QUAD $0x0000009824848348; BYTE $0x01 // addq	$1, 152(%rsp)
+	QUAD $0x0000009824848b48             // movq	152(%rsp), %rax
+	WORD $0x0148; BYTE $0xf2             // addq	%rsi, %rdx
+	WORD $0x0149; BYTE $0xf3             // addq	%rsi, %r11
+	LONG $0x24443948; BYTE $0x78         // cmpq	%rax, 120(%rsp)
+	JNE  BB0_26
+	WORD $0xf8c5; BYTE $0x77             // vzeroupper
+
+BB0_132:
+	LONG $0x50a58d48; WORD $0xffff; BYTE $0xff // leaq	-176(%rbp), %rsp
+	RET
+
+BB0_137:
+	LONG $0x03f98348             // cmpq	$3, %rcx
+	JLE  BB0_23
+	LONG $0x000004be; BYTE $0x00 // movl	$4, %esi
+
+BB0_24:
+	LONG $0x5410fdc5; WORD $0xe0f2             // vmovupd	-32(%rdx,%rsi,8), %ymm2
+	LONG $0x107d41c4; WORD $0xf64c; BYTE $0xe0 // vmovupd	-32(%r14,%rsi,8), %ymm9
+	LONG $0xd75cedc5                           // vsubpd	%ymm7, %ymm2, %ymm2
+	LONG $0xd659edc5                           // vmulpd	%ymm6, %ymm2, %ymm2
+	LONG $0x98b5c2c4; WORD $0xf754; BYTE $0xe0 // vfmadd132pd	-32(%r15,%rsi,8), %ymm9, %ymm2
+	LONG $0x117dc1c4; WORD $0xf354; BYTE $0xe0 // vmovupd	%ymm2, -32(%r11,%rsi,8)
+	LONG $0x04c68348                           // addq	$4, %rsi
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_24
+
+BB0_23:
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JGE  BB0_31
+	WORD $0x8949; BYTE $0xc9                   // movq	%rcx, %r9
+	LONG $0x24448948; BYTE $0x18               // movq	%rax, 24(%rsp)
+	LONG $0x18348d48                           // leaq	(%rax,%rbx), %rsi
+	WORD $0x2949; BYTE $0xc1                   // subq	%rax, %r9
+	LONG $0x01f98349                           // cmpq	$1, %r9
+	LONG $0x244c894c; BYTE $0x40               // movq	%r9, 64(%rsp)
+	JE   BB0_140
+	QUAD $0x00000000f5148d4c                   // leaq	0(,%rsi,8), %r10
+	LONG $0x15448d4f; BYTE $0x00               // leaq	0(%r13,%r10), %r8
+	LONG $0x2454894c; BYTE $0x30               // movq	%r10, 48(%rsp)
+	LONG $0x01508d4c                           // leaq	1(%rax), %r10
+	LONG $0x2454894c; BYTE $0x60               // movq	%r10, 96(%rsp)
+	LONG $0x03e2c149                           // salq	$3, %r10
+	WORD $0x894d; BYTE $0xc1                   // movq	%r8, %r9
+	QUAD $0x000000802484894c                   // movq	%r8, 128(%rsp)
+	LONG $0x16048d4f                           // leaq	(%r14,%r10), %r8
+	WORD $0x294d; BYTE $0xc1                   // subq	%r8, %r9
+	LONG $0x17048d4f                           // leaq	(%r15,%r10), %r8
+	LONG $0x10f98349                           // cmpq	$16, %r9
+	QUAD $0x00000080248c8b4c                   // movq	128(%rsp), %r9
+	LONG $0x2444970f; BYTE $0x28               // seta	40(%rsp)
+	WORD $0x294d; BYTE $0xc1                   // subq	%r8, %r9
+	LONG $0x10f98349                           // cmpq	$16, %r9
+	LONG $0x2444970f; BYTE $0x76               // seta	118(%rsp)
+	LONG $0x44b60f44; WORD $0x7624             // movzbl	118(%rsp), %r8d
+	LONG $0x24448444; BYTE $0x28               // testb	%r8b, 40(%rsp)
+	JE   BB0_27
+	LONG $0x244c8b4c; BYTE $0x30               // movq	48(%rsp), %r9
+	LONG $0x0f448d4e; BYTE $0x08               // leaq	8(%rdi,%r9), %r8
+	QUAD $0x00000080248c8b4c                   // movq	128(%rsp), %r9
+	WORD $0x294d; BYTE $0xc1                   // subq	%r8, %r9
+	LONG $0x10f98349                           // cmpq	$16, %r9
+	JBE  BB0_27
+	LONG $0x244c8b4c; BYTE $0x40               // movq	64(%rsp), %r9
+	LONG $0xff418d4d                           // leaq	-1(%r9), %r8
+	LONG $0x02f88349                           // cmpq	$2, %r8
+	JBE  BB0_59
+	LONG $0x24448b4c; BYTE $0x30               // movq	48(%rsp), %r8
+	QUAD $0x00000080248c8b4c                   // movq	128(%rsp), %r9
+	LONG $0x107da1c4; WORD $0x0714             // vmovupd	(%rdi,%r8), %ymm2
+	LONG $0xd75cedc5                           // vsubpd	%ymm7, %ymm2, %ymm2
+	LONG $0x107d81c4; WORD $0x167c; BYTE $0xf8 // vmovupd	-8(%r14,%r10), %ymm7
+	LONG $0xd659edc5                           // vmulpd	%ymm6, %ymm2, %ymm2
+	LONG $0x98c582c4; WORD $0x1754; BYTE $0xf8 // vfmadd132pd	-8(%r15,%r10), %ymm7, %ymm2
+	LONG $0x24548b4c; BYTE $0x40               // movq	64(%rsp), %r10
+	LONG $0x117dc1c4; BYTE $0x11               // vmovupd	%ymm2, (%r9)
+	WORD $0x894d; BYTE $0xd1                   // movq	%r10, %r9
+	LONG $0xfce18349                           // andq	$-4, %r9
+	WORD $0x894d; BYTE $0xc8                   // movq	%r9, %r8
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+	LONG $0x03c2f641                           // testb	$3, %r10b
+	JE   BB0_31
+	WORD $0x294d; BYTE $0xca                   // subq	%r9, %r10
+	LONG $0x2454894c; BYTE $0x40               // movq	%r10, 64(%rsp)
+	LONG $0x01fa8349                           // cmpq	$1, %r10
+	JE   BB0_32
+
+BB0_28:
+	WORD $0x014c; BYTE $0xc6                   // addq	%r8, %rsi
+	LONG $0xd012fbc5                           // vmovddup	%xmm0, %xmm2
+	LONG $0x24548b4c; BYTE $0x18               // movq	24(%rsp), %r10
+	LONG $0xf112fbc5                           // vmovddup	%xmm1, %xmm6
+	LONG $0x3c10f9c5; BYTE $0xf7               // vmovupd	(%rdi,%rsi,8), %xmm7
+	WORD $0x014d; BYTE $0xc2                   // addq	%r8, %r10
+	LONG $0xd25cc1c5                           // vsubpd	%xmm2, %xmm7, %xmm2
+	LONG $0x107981c4; WORD $0xd63c             // vmovupd	(%r14,%r10,8), %xmm7
+	LONG $0xd659e9c5                           // vmulpd	%xmm6, %xmm2, %xmm2
+	LONG $0x98c182c4; WORD $0xd714             // vfmadd132pd	(%r15,%r10,8), %xmm7, %xmm2
+	LONG $0x1179c1c4; WORD $0xf554; BYTE $0x00 // vmovupd	%xmm2, 0(%r13,%rsi,8)
+	LONG $0x24748b48; BYTE $0x40               // movq	64(%rsp), %rsi
+	LONG $0x01c6f640                           // testb	$1, %sil
+	JE   BB0_31
+	LONG $0xfee68348                           // andq	$-2, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+
+BB0_32:
+	LONG $0x03348d48                           // leaq	(%rbx,%rax), %rsi
+	LONG $0x107bc1c4; WORD $0xc63c             // vmovsd	(%r14,%rax,8), %xmm7
+	LONG $0x1410fbc5; BYTE $0xf7               // vmovsd	(%rdi,%rsi,8), %xmm2
+	LONG $0xc05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm0
+	LONG $0xc159fbc5                           // vmulsd	%xmm1, %xmm0, %xmm0
+	LONG $0x99c1c2c4; WORD $0xc704             // vfmadd132sd	(%r15,%rax,8), %xmm7, %xmm0
+	LONG $0x117bc1c4; WORD $0xf544; BYTE $0x00 // vmovsd	%xmm0, 0(%r13,%rsi,8)
+	JMP  BB0_31
+
+BB0_140:
+	LONG $0x01508d4c             // leaq	1(%rax), %r10
+	LONG $0x2454894c; BYTE $0x60 // movq	%r10, 96(%rsp)
+
+BB0_27:
+	LONG $0x1410fbc5; BYTE $0xf7               // vmovsd	(%rdi,%rsi,8), %xmm2
+	LONG $0x107bc1c4; WORD $0xc63c             // vmovsd	(%r14,%rax,8), %xmm7
+	QUAD $0x00000000c50c8d4c                   // leaq	0(,%rax,8), %r9
+	LONG $0x24448b4c; BYTE $0x60               // movq	96(%rsp), %r8
+	LONG $0xd05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm2
+	LONG $0xd159ebc5                           // vmulsd	%xmm1, %xmm2, %xmm2
+	LONG $0x99c1c2c4; WORD $0xc714             // vfmadd132sd	(%r15,%rax,8), %xmm7, %xmm2
+	LONG $0x117bc1c4; WORD $0xf554; BYTE $0x00 // vmovsd	%xmm2, 0(%r13,%rsi,8)
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd8                   // addq	%rbx, %r8
+	LONG $0x107b81c4; WORD $0x0e7c; BYTE $0x08 // vmovsd	8(%r14,%r9), %xmm7
+	LONG $0x02708d48                           // leaq	2(%rax), %rsi
+	LONG $0x107ba1c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm2
+	LONG $0xd05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm2
+	LONG $0xd159ebc5                           // vmulsd	%xmm1, %xmm2, %xmm2
+	LONG $0x99c182c4; WORD $0x0f54; BYTE $0x08 // vfmadd132sd	8(%r15,%r9), %xmm7, %xmm2
+	LONG $0x117b81c4; WORD $0xc554; BYTE $0x00 // vmovsd	%xmm2, 0(%r13,%r8,8)
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JGE  BB0_31
+	WORD $0x0148; BYTE $0xde                   // addq	%rbx, %rsi
+	LONG $0x107b81c4; WORD $0x0e7c; BYTE $0x10 // vmovsd	16(%r14,%r9), %xmm7
+	LONG $0x03c08348                           // addq	$3, %rax
+	LONG $0x1410fbc5; BYTE $0xf7               // vmovsd	(%rdi,%rsi,8), %xmm2
+	LONG $0xd05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm2
+	LONG $0xd159ebc5                           // vmulsd	%xmm1, %xmm2, %xmm2
+	LONG $0x99c182c4; WORD $0x0f54; BYTE $0x10 // vfmadd132sd	16(%r15,%r9), %xmm7, %xmm2
+	LONG $0x117bc1c4; WORD $0xf554; BYTE $0x00 // vmovsd	%xmm2, 0(%r13,%rsi,8)
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JGE  BB0_31
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x107b81c4; WORD $0x0e7c; BYTE $0x18 // vmovsd	24(%r14,%r9), %xmm7
+	LONG $0x1410fbc5; BYTE $0xc7               // vmovsd	(%rdi,%rax,8), %xmm2
+	LONG $0xc05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm0
+	LONG $0xc159fbc5                           // vmulsd	%xmm1, %xmm0, %xmm0
+	LONG $0x99c182c4; WORD $0x0f44; BYTE $0x18 // vfmadd132sd	24(%r15,%r9), %xmm7, %xmm0
+	LONG $0x117bc1c4; WORD $0xc544; BYTE $0x00 // vmovsd	%xmm0, 0(%r13,%rax,8)
+	JMP  BB0_31
+
+BB0_138:
+	LONG $0x24548b4c; BYTE $0x20 // movq	32(%rsp), %r10
+	QUAD $0x00000000dd348d48     // leaq	0(,%rbx,8), %rsi
+	LONG $0x1a048d4d             // leaq	(%r10,%rbx), %r8
+	LONG $0x03e0c149             // salq	$3, %r8
+	LONG $0x03f98348             // cmpq	$3, %rcx
+	JLE  BB0_37
+
+BB0_47:
+	LONG $0x1410fdc5; BYTE $0x37               // vmovupd	(%rdi,%rsi), %ymm2
+	LONG $0xd75cedc5                           // vsubpd	%ymm7, %ymm2, %ymm2
+	LONG $0xd659edc5                           // vmulpd	%ymm6, %ymm2, %ymm2
+	LONG $0x117dc1c4; WORD $0x3554; BYTE $0x00 // vmovupd	%ymm2, 0(%r13,%rsi)
+	LONG $0x20c68348                           // addq	$32, %rsi
+	WORD $0x394c; BYTE $0xc6                   // cmpq	%r8, %rsi
+	JNE  BB0_47
+
+BB0_37:
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JGE  BB0_31
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x18348d48             // leaq	(%rax,%rbx), %rsi
+	WORD $0x2949; BYTE $0xc0     // subq	%rax, %r8
+	LONG $0x01f88349             // cmpq	$1, %r8
+	JE   BB0_48
+	QUAD $0x00000000f5148d4c     // leaq	0(,%rsi,8), %r10
+	LONG $0x154c8d4f; BYTE $0x00 // leaq	0(%r13,%r10), %r9
+	LONG $0x2454894c; BYTE $0x60 // movq	%r10, 96(%rsp)
+	QUAD $0x00000080248c894c     // movq	%r9, 128(%rsp)
+	LONG $0x174c8d4e; BYTE $0x08 // leaq	8(%rdi,%r10), %r9
+	WORD $0x894d; BYTE $0xca     // movq	%r9, %r10
+	QUAD $0x00000080248c8b4c     // movq	128(%rsp), %r9
+	WORD $0x294d; BYTE $0xd1     // subq	%r10, %r9
+	LONG $0x10f98349             // cmpq	$16, %r9
+	JA   BB0_141
+
+BB0_48:
+	LONG $0x1410fbc5; BYTE $0xf7               // vmovsd	(%rdi,%rsi,8), %xmm2
+	LONG $0xd05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm2
+	LONG $0xd159ebc5                           // vmulsd	%xmm1, %xmm2, %xmm2
+	LONG $0x117bc1c4; WORD $0xf554; BYTE $0x00 // vmovsd	%xmm2, 0(%r13,%rsi,8)
+	LONG $0x01708d48                           // leaq	1(%rax), %rsi
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xde                   // addq	%rbx, %rsi
+	LONG $0x1410fbc5; BYTE $0xf7               // vmovsd	(%rdi,%rsi,8), %xmm2
+	LONG $0xd05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm2
+	LONG $0xd159ebc5                           // vmulsd	%xmm1, %xmm2, %xmm2
+	LONG $0x117bc1c4; WORD $0xf554; BYTE $0x00 // vmovsd	%xmm2, 0(%r13,%rsi,8)
+	LONG $0x02708d48                           // leaq	2(%rax), %rsi
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xde                   // addq	%rbx, %rsi
+	LONG $0x03c08348                           // addq	$3, %rax
+	LONG $0x1410fbc5; BYTE $0xf7               // vmovsd	(%rdi,%rsi,8), %xmm2
+	LONG $0xd05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm2
+	LONG $0xd159ebc5                           // vmulsd	%xmm1, %xmm2, %xmm2
+	LONG $0x117bc1c4; WORD $0xf554; BYTE $0x00 // vmovsd	%xmm2, 0(%r13,%rsi,8)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_31
+
+BB0_134:
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x1410fbc5; BYTE $0xc7               // vmovsd	(%rdi,%rax,8), %xmm2
+	LONG $0xc05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm0
+	LONG $0xc159fbc5                           // vmulsd	%xmm1, %xmm0, %xmm0
+	LONG $0x117bc1c4; WORD $0xc544; BYTE $0x00 // vmovsd	%xmm0, 0(%r13,%rax,8)
+	JMP  BB0_31
+
+BB0_139:
+	LONG $0x01508d4c             // leaq	1(%rax), %r10
+	LONG $0x2454894c; BYTE $0x60 // movq	%r10, 96(%rsp)
+
+BB0_40:
+	LONG $0x1410fbc5; BYTE $0xf7               // vmovsd	(%rdi,%rsi,8), %xmm2
+	LONG $0x24448b4c; BYTE $0x60               // movq	96(%rsp), %r8
+	QUAD $0x00000000c50c8d4c                   // leaq	0(,%rax,8), %r9
+	LONG $0xd05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm2
+	LONG $0xd159ebc5                           // vmulsd	%xmm1, %xmm2, %xmm2
+	LONG $0x596bc1c4; WORD $0xc714             // vmulsd	(%r15,%rax,8), %xmm2, %xmm2
+	LONG $0x117bc1c4; WORD $0xf554; BYTE $0x00 // vmovsd	%xmm2, 0(%r13,%rsi,8)
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd8                   // addq	%rbx, %r8
+	LONG $0x02708d48                           // leaq	2(%rax), %rsi
+	LONG $0x107ba1c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm2
+	LONG $0xd05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm2
+	LONG $0xd159ebc5                           // vmulsd	%xmm1, %xmm2, %xmm2
+	LONG $0x596b81c4; WORD $0x0f54; BYTE $0x08 // vmulsd	8(%r15,%r9), %xmm2, %xmm2
+	LONG $0x117b81c4; WORD $0xc554; BYTE $0x00 // vmovsd	%xmm2, 0(%r13,%r8,8)
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JGE  BB0_31
+	WORD $0x0148; BYTE $0xde                   // addq	%rbx, %rsi
+	LONG $0x03c08348                           // addq	$3, %rax
+	LONG $0x1410fbc5; BYTE $0xf7               // vmovsd	(%rdi,%rsi,8), %xmm2
+	LONG $0xd05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm2
+	LONG $0xd159ebc5                           // vmulsd	%xmm1, %xmm2, %xmm2
+	LONG $0x596b81c4; WORD $0x0f54; BYTE $0x10 // vmulsd	16(%r15,%r9), %xmm2, %xmm2
+	LONG $0x117bc1c4; WORD $0xf554; BYTE $0x00 // vmovsd	%xmm2, 0(%r13,%rsi,8)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x1410fbc5; BYTE $0xc7               // vmovsd	(%rdi,%rax,8), %xmm2
+	LONG $0xc05cebc5                           // vsubsd	%xmm0, %xmm2, %xmm0
+	LONG $0xc159fbc5                           // vmulsd	%xmm1, %xmm0, %xmm0
+	LONG $0x597b81c4; WORD $0x0f44; BYTE $0x18 // vmulsd	24(%r15,%r9), %xmm0, %xmm0
+	LONG $0x117bc1c4; WORD $0xc544; BYTE $0x00 // vmovsd	%xmm0, 0(%r13,%rax,8)
+	JMP  BB0_31
+
+BB0_5:
+	LONG $0xc057f9c5 // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0xc031     // xorl	%eax, %eax
+	WORD $0xf631     // xorl	%esi, %esi
+	JMP  BB0_8
+
+BB0_7:
+	LONG $0xc059e3c5             // vmulsd	%xmm0, %xmm3, %xmm0
+	WORD $0x894c; BYTE $0xe0     // movq	%r12, %rax
+	LONG $0x197de2c4; BYTE $0xf8 // vbroadcastsd	%xmm0, %ymm7
+	JMP  BB0_11
+
+BB0_136:
+	WORD $0x8949; BYTE $0xc9 // movq	%rcx, %r9
+	LONG $0xc957f1c5         // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0x2949; BYTE $0xc1 // subq	%rax, %r9
+	LONG $0xff718d49         // leaq	-1(%r9), %rsi
+	LONG $0x02fe8348         // cmpq	$2, %rsi
+	JA   BB0_142
+
+BB0_58:
+	WORD $0x8949; BYTE $0xc0 // movq	%rax, %r8
+	WORD $0x3145; BYTE $0xd2 // xorl	%r10d, %r10d
+	JMP  BB0_16
+
+BB0_141:
+	LONG $0xff508d4d               // leaq	-1(%r8), %r10
+	LONG $0x02fa8349               // cmpq	$2, %r10
+	JBE  BB0_61
+	LONG $0x24548b4c; BYTE $0x60   // movq	96(%rsp), %r10
+	WORD $0x894d; BYTE $0xc1       // movq	%r8, %r9
+	LONG $0xfce18349               // andq	$-4, %r9
+	LONG $0x107da1c4; WORD $0x1714 // vmovupd	(%rdi,%r10), %ymm2
+	QUAD $0x0000008024948b4c       // movq	128(%rsp), %r10
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+	LONG $0xd75cedc5               // vsubpd	%ymm7, %ymm2, %ymm2
+	LONG $0xd659edc5               // vmulpd	%ymm6, %ymm2, %ymm2
+	LONG $0x117dc1c4; BYTE $0x12   // vmovupd	%ymm2, (%r10)
+	LONG $0x03c0f641               // testb	$3, %r8b
+	JE   BB0_31
+	WORD $0x294d; BYTE $0xc8       // subq	%r9, %r8
+	LONG $0x01f88349               // cmpq	$1, %r8
+	JE   BB0_134
+
+BB0_49:
+	WORD $0x0149; BYTE $0xf1                   // addq	%rsi, %r9
+	LONG $0xd012fbc5                           // vmovddup	%xmm0, %xmm2
+	LONG $0xf112fbc5                           // vmovddup	%xmm1, %xmm6
+	LONG $0x1079a1c4; WORD $0xcf3c             // vmovupd	(%rdi,%r9,8), %xmm7
+	LONG $0xd25cc1c5                           // vsubpd	%xmm2, %xmm7, %xmm2
+	LONG $0xd659e9c5                           // vmulpd	%xmm6, %xmm2, %xmm2
+	LONG $0x117981c4; WORD $0xcd54; BYTE $0x00 // vmovupd	%xmm2, 0(%r13,%r9,8)
+	LONG $0x01c0f641                           // testb	$1, %r8b
+	JE   BB0_31
+	LONG $0xfee08349                           // andq	$-2, %r8
+	WORD $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+	JMP  BB0_134
+
+BB0_56:
+	WORD $0x894c; BYTE $0xe0 // movq	%r12, %rax
+	WORD $0x894c; BYTE $0xe6 // movq	%r12, %rsi
+	JMP  BB0_8
+
+BB0_60:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_41
+
+BB0_59:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_28
+
+BB0_61:
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	JMP  BB0_49
@@ -0,0 +1,899 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baselayernorm_c_f64_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x00000000
+DATA CPI0_0<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $8
+
+TEXT ·layernorm_c_f64_avx512(SB), $96-80
+	MOVQ   input+0(FP), DI
+	MOVQ   output+8(FP), SI
+	MOVQ   pnormSize+16(FP), DX
+	MOVQ   gamma+24(FP), CX
+	MOVQ   beta+32(FP), R8
+	MOVQ   pepsilon+40(FP), R9
+	MOVQ   plen_input+48(FP), R11
+	MOVQ   R11, 64(SP)
+	MOVQ   plen_output+56(FP), R11
+	MOVQ   R11, 72(SP)
+	MOVQ   plen_gamma+64(FP), R11
+	MOVQ   R11, 80(SP)
+	MOVQ   plen_beta+72(FP), R11
+	MOVQ   R11, 88(SP)
+	LONG   $0x246c8d48; BYTE $0x30         // leaq	48(%rsp), %rbp
+	WORD   $0x8949; BYTE $0xce             // movq	%rcx, %r14
+	LONG   $0x24648d48; BYTE $0x40         // leaq	64(%rsp), %rsp
+	LONG   $0xc0e48348                     // andq	$-64, %rsp
+	LONG   $0x80c48348                     // addq	$-128, %rsp
+	LONG   $0x10458b48                     // movq	16(%rbp), %rax
+	WORD   $0x8b48; BYTE $0x0a             // movq	(%rdx), %rcx
+	LONG   $0x007efac5                     // vmovq	(%rax), %xmm0
+	LONG   $0x18458b48                     // movq	24(%rbp), %rax
+	LONG   $0x187efac5                     // vmovq	(%rax), %xmm3
+	LONG   $0x08fdf262; WORD $0xc339       // vpminsq	%xmm3, %xmm0, %xmm0
+	LONG   $0x7ef9e1c4; BYTE $0xc0         // vmovq	%xmm0, %rax
+	WORD   $0x8548; BYTE $0xc0             // testq	%rax, %rax
+	JE     BB0_114
+	WORD   $0x8548; BYTE $0xc9             // testq	%rcx, %rcx
+	JLE    BB0_114
+	WORD   $0x9948                         // cqto
+	LONG   $0xdb57e0c5                     // vxorps	%xmm3, %xmm3, %xmm3
+	VMOVSD CPI0_0<>(SB), X6                // vmovsd	.LCPI0_0(%rip), %xmm6
+	WORD   $0xf748; BYTE $0xf9             // idivq	%rcx
+	LONG   $0x2ae3e1c4; BYTE $0xd9         // vcvtsi2sdq	%rcx, %xmm3, %xmm3
+	LONG   $0xdb5ecbc5                     // vdivsd	%xmm3, %xmm6, %xmm3
+	LONG   $0x24448948; BYTE $0x58         // movq	%rax, 88(%rsp)
+	WORD   $0x8548; BYTE $0xc0             // testq	%rax, %rax
+	JLE    BB0_114
+	WORD   $0x854d; BYTE $0xf6             // testq	%r14, %r14
+	LONG   $0x107bc1c4; BYTE $0x39         // vmovsd	(%r9), %xmm7
+	WORD   $0x8949; BYTE $0xf7             // movq	%rsi, %r15
+	WORD   $0x8949; BYTE $0xf2             // movq	%rsi, %r10
+	WORD   $0x950f; BYTE $0xc2             // setne	%dl
+	WORD   $0x854d; BYTE $0xc0             // testq	%r8, %r8
+	WORD   $0x894d; BYTE $0xf4             // movq	%r14, %r12
+	WORD   $0x8948; BYTE $0xfe             // movq	%rdi, %rsi
+	QUAD   $0x000000782444c748; BYTE $0x00 // movq	$0, 120(%rsp)
+	WORD   $0x950f; BYTE $0xc0             // setne	%al
+	WORD   $0x894d; BYTE $0xc6             // movq	%r8, %r14
+	WORD   $0xc221                         // andl	%eax, %edx
+	QUAD   $0x00000000cd048d48             // leaq	0(,%rcx,8), %rax
+	LONG   $0x6ef9e1c4; BYTE $0xe0         // vmovq	%rax, %xmm4
+	LONG   $0xf8418d48                     // leaq	-8(%rcx), %rax
+	LONG   $0x57245488                     // movb	%dl, 87(%rsp)
+	WORD   $0x8948; BYTE $0xc2             // movq	%rax, %rdx
+	LONG   $0xf8e08348                     // andq	$-8, %rax
+	LONG   $0x03eac148                     // shrq	$3, %rdx
+	WORD   $0x8949; BYTE $0xc3             // movq	%rax, %r11
+	LONG   $0x24448948; BYTE $0x68         // movq	%rax, 104(%rsp)
+	LONG   $0x40478d48                     // leaq	64(%rdi), %rax
+	QUAD   $0x00000008d51c8d48             // leaq	8(,%rdx,8), %rbx
+	LONG   $0x6ef9e1c4; BYTE $0xe8         // vmovq	%rax, %xmm5
+	WORD   $0xd231                         // xorl	%edx, %edx
+	WORD   $0x8948; BYTE $0xc8             // movq	%rcx, %rax
+	WORD   $0x2948; BYTE $0xd8             // subq	%rbx, %rax
+	LONG   $0x245c8948; BYTE $0x70         // movq	%rbx, 112(%rsp)
+	LONG   $0xff488d4c                     // leaq	-1(%rax), %r9
+	LONG   $0x244c894c; BYTE $0x28         // movq	%r9, 40(%rsp)
+	WORD   $0x8949; BYTE $0xc1             // movq	%rax, %r9
+	LONG   $0x03e9c149                     // shrq	$3, %r9
+	LONG   $0x06e1c149                     // salq	$6, %r9
+	LONG   $0x244c894c; BYTE $0x40         // movq	%r9, 64(%rsp)
+	WORD   $0x8949; BYTE $0xc1             // movq	%rax, %r9
+	WORD   $0xe083; BYTE $0x07             // andl	$7, %eax
+	LONG   $0xf8e18349                     // andq	$-8, %r9
+	LONG   $0x24448948; BYTE $0x30         // movq	%rax, 48(%rsp)
+	LONG   $0x08438d49                     // leaq	8(%r11), %rax
+	WORD   $0x014c; BYTE $0xcb             // addq	%r9, %rbx
+	LONG   $0x6ef961c4; BYTE $0xc0         // vmovq	%rax, %xmm8
+	LONG   $0x245c8948; BYTE $0x38         // movq	%rbx, 56(%rsp)
+
+BB0_26:
+	LONG $0x07f98348             // cmpq	$7, %rcx
+	JLE  BB0_5
+	LONG $0x24448b48; BYTE $0x68 // movq	104(%rsp), %rax
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x100c8d4c             // leaq	(%rax,%rdx), %r9
+	LONG $0x7ef9e1c4; BYTE $0xe8 // vmovq	%xmm5, %rax
+	LONG $0xc8048d4e             // leaq	(%rax,%r9,8), %r8
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+
+BB0_6:
+	LONG $0x48fdf162; WORD $0x0058             // vaddpd	(%rax), %zmm0, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	WORD $0x3949; BYTE $0xc0                   // cmpq	%rax, %r8
+	JNE  BB0_6
+	LONG $0x48fdd362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm9
+	LONG $0x24448b48; BYTE $0x70               // movq	112(%rsp), %rax
+	LONG $0xc058b5c5                           // vaddpd	%ymm0, %ymm9, %ymm0
+	LONG $0x28fdd362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm9
+	LONG $0xc85831c5                           // vaddpd	%xmm0, %xmm9, %xmm9
+	LONG $0xc81133c5                           // vmovsd	%xmm9, %xmm9, %xmm0
+	LONG $0x153141c4; BYTE $0xc9               // vunpckhpd	%xmm9, %xmm9, %xmm9
+	LONG $0x587bc1c4; BYTE $0xc1               // vaddsd	%xmm9, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_7
+	LONG $0x247c8348; WORD $0x0628             // cmpq	$6, 40(%rsp)
+	JBE  BB0_55
+	LONG $0x245c8b48; BYTE $0x40               // movq	64(%rsp), %rbx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0xc7048d48                           // leaq	(%rdi,%rax,8), %rax
+	LONG $0x03048d4c                           // leaq	(%rbx,%rax), %r8
+
+BB0_9:
+	LONG $0x0058fbc5               // vaddsd	(%rax), %xmm0, %xmm0
+	LONG $0x40c08348               // addq	$64, %rax
+	LONG $0x4058fbc5; BYTE $0xc8   // vaddsd	-56(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xd0   // vaddsd	-48(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xd8   // vaddsd	-40(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xe0   // vaddsd	-32(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xe8   // vaddsd	-24(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xf0   // vaddsd	-16(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xf8   // vaddsd	-8(%rax), %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc0       // cmpq	%rax, %r8
+	JNE  BB0_9
+	LONG $0x247c8348; WORD $0x0030 // cmpq	$0, 48(%rsp)
+	LONG $0x24448b4c; BYTE $0x38   // movq	56(%rsp), %r8
+	LONG $0x24448b48; BYTE $0x70   // movq	112(%rsp), %rax
+	JE   BB0_13
+
+BB0_8:
+	LONG $0x020c8d4e               // leaq	(%rdx,%r8), %r9
+	LONG $0x587ba1c4; WORD $0xcf04 // vaddsd	(%rdi,%r9,8), %xmm0, %xmm0
+	LONG $0x01488d4d               // leaq	1(%r8), %r9
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xd1       // addq	%rdx, %r9
+	LONG $0x587ba1c4; WORD $0xcf04 // vaddsd	(%rdi,%r9,8), %xmm0, %xmm0
+	LONG $0x02488d4d               // leaq	2(%r8), %r9
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xd1       // addq	%rdx, %r9
+	LONG $0x587ba1c4; WORD $0xcf04 // vaddsd	(%rdi,%r9,8), %xmm0, %xmm0
+	LONG $0x03488d4d               // leaq	3(%r8), %r9
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xd1       // addq	%rdx, %r9
+	LONG $0x587ba1c4; WORD $0xcf04 // vaddsd	(%rdi,%r9,8), %xmm0, %xmm0
+	LONG $0x04488d4d               // leaq	4(%r8), %r9
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xd1       // addq	%rdx, %r9
+	LONG $0x587ba1c4; WORD $0xcf04 // vaddsd	(%rdi,%r9,8), %xmm0, %xmm0
+	LONG $0x05488d4d               // leaq	5(%r8), %r9
+	WORD $0x394c; BYTE $0xc9       // cmpq	%r9, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xd1       // addq	%rdx, %r9
+	LONG $0x06c08349               // addq	$6, %r8
+	LONG $0x587ba1c4; WORD $0xcf04 // vaddsd	(%rdi,%r9,8), %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_13
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0x587ba1c4; WORD $0xc704 // vaddsd	(%rdi,%r8,8), %xmm0, %xmm0
+
+BB0_13:
+	LONG $0xc85963c5               // vmulsd	%xmm0, %xmm3, %xmm9
+	LONG $0x245c8b48; BYTE $0x68   // movq	104(%rsp), %rbx
+	LONG $0x572941c4; BYTE $0xd2   // vxorpd	%xmm10, %xmm10, %xmm10
+	LONG $0x130c8d4c               // leaq	(%rbx,%rdx), %r9
+	LONG $0x48fd5262; WORD $0xd919 // vbroadcastsd	%xmm9, %zmm11
+	LONG $0x07f98348               // cmpq	$7, %rcx
+	JLE  BB0_12
+
+BB0_11:
+	LONG $0x7ef9e1c4; BYTE $0xeb // vmovq	%xmm5, %rbx
+	WORD $0x8949; BYTE $0xf0     // movq	%rsi, %r8
+	LONG $0x572941c4; BYTE $0xd2 // vxorpd	%xmm10, %xmm10, %xmm10
+	LONG $0xcb0c8d4e             // leaq	(%rbx,%r9,8), %r9
+
+BB0_14:
+	LONG $0x48fdd162; WORD $0x1010 // vmovupd	(%r8), %zmm2
+	LONG $0x40c08349               // addq	$64, %r8
+	LONG $0x48edd162; WORD $0xc35c // vsubpd	%zmm11, %zmm2, %zmm0
+	LONG $0x48fd7262; WORD $0xd0b8 // vfmadd231pd	%zmm0, %zmm0, %zmm10
+	WORD $0x394d; BYTE $0xc8       // cmpq	%r9, %r8
+	JNE  BB0_14
+
+BB0_12:
+	LONG $0x48fd7362; WORD $0xd01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm10, %ymm0
+	LONG $0x587dc1c4; BYTE $0xc2               // vaddpd	%ymm10, %ymm0, %ymm0
+	LONG $0x28fdd362; WORD $0xc219; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm10
+	LONG $0xd05829c5                           // vaddpd	%xmm0, %xmm10, %xmm10
+	LONG $0xd0112bc5                           // vmovsd	%xmm10, %xmm10, %xmm0
+	LONG $0x152941c4; BYTE $0xd2               // vunpckhpd	%xmm10, %xmm10, %xmm10
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_15
+	WORD $0x8949; BYTE $0xc9                   // movq	%rcx, %r9
+	WORD $0x2949; BYTE $0xc1                   // subq	%rax, %r9
+	LONG $0xff418d4d                           // leaq	-1(%r9), %r8
+	LONG $0x06f88349                           // cmpq	$6, %r8
+	JBE  BB0_57
+	WORD $0x894d; BYTE $0xcb                   // movq	%r9, %r11
+	LONG $0x02048d4c                           // leaq	(%rdx,%rax), %r8
+	LONG $0x03ebc149                           // shrq	$3, %r11
+	LONG $0xc7048d4e                           // leaq	(%rdi,%r8,8), %r8
+	LONG $0x06e3c149                           // salq	$6, %r11
+	WORD $0x014d; BYTE $0xc3                   // addq	%r8, %r11
+
+BB0_17:
+	LONG $0x48fdd162; WORD $0x0810             // vmovupd	(%r8), %zmm1
+	LONG $0x40c08349                           // addq	$64, %r8
+	LONG $0x48f55162; WORD $0xd35c             // vsubpd	%zmm11, %zmm1, %zmm10
+	LONG $0x48ad5162; WORD $0xd259             // vmulpd	%zmm10, %zmm10, %zmm10
+	LONG $0x28ad5362; WORD $0xe203; BYTE $0x03 // valignq	$3, %ymm10, %ymm10, %ymm12
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	LONG $0x152941c4; BYTE $0xea               // vunpckhpd	%xmm10, %xmm10, %xmm13
+	LONG $0x587bc1c4; BYTE $0xc5               // vaddsd	%xmm13, %xmm0, %xmm0
+	LONG $0x28fd5362; WORD $0xd519; BYTE $0x01 // vextractf64x2	$1, %ymm10, %xmm13
+	LONG $0x48fd5362; WORD $0xd21b; BYTE $0x01 // vextractf64x4	$0x1, %zmm10, %ymm10
+	LONG $0x587bc1c4; BYTE $0xc5               // vaddsd	%xmm13, %xmm0, %xmm0
+	LONG $0x587bc1c4; BYTE $0xc4               // vaddsd	%xmm12, %xmm0, %xmm0
+	LONG $0x152941c4; BYTE $0xe2               // vunpckhpd	%xmm10, %xmm10, %xmm12
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	LONG $0x587bc1c4; BYTE $0xc4               // vaddsd	%xmm12, %xmm0, %xmm0
+	LONG $0x28fd5362; WORD $0xd419; BYTE $0x01 // vextractf64x2	$1, %ymm10, %xmm12
+	LONG $0x28ad5362; WORD $0xd203; BYTE $0x03 // valignq	$3, %ymm10, %ymm10, %ymm10
+	LONG $0x587bc1c4; BYTE $0xc4               // vaddsd	%xmm12, %xmm0, %xmm0
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	WORD $0x394d; BYTE $0xc3                   // cmpq	%r8, %r11
+	JNE  BB0_17
+	WORD $0x894c; BYTE $0xcb                   // movq	%r9, %rbx
+	LONG $0xf8e38348                           // andq	$-8, %rbx
+	LONG $0x031c8d4c                           // leaq	(%rbx,%rax), %r11
+	LONG $0x07c1f641                           // testb	$7, %r9b
+	JE   BB0_15
+
+BB0_16:
+	WORD $0x2949; BYTE $0xd9                   // subq	%rbx, %r9
+	LONG $0xff418d4d                           // leaq	-1(%r9), %r8
+	LONG $0x02f88349                           // cmpq	$2, %r8
+	JBE  BB0_20
+	LONG $0x02048d4c                           // leaq	(%rdx,%rax), %r8
+	LONG $0x197d42c4; BYTE $0xe1               // vbroadcastsd	%xmm9, %ymm12
+	WORD $0x014c; BYTE $0xc3                   // addq	%r8, %rbx
+	WORD $0x894d; BYTE $0xc8                   // movq	%r9, %r8
+	LONG $0x14107dc5; BYTE $0xdf               // vmovupd	(%rdi,%rbx,8), %ymm10
+	LONG $0xfce08349                           // andq	$-4, %r8
+	WORD $0x014d; BYTE $0xc3                   // addq	%r8, %r11
+	LONG $0x03e18341                           // andl	$3, %r9d
+	LONG $0x5c2d41c4; BYTE $0xd4               // vsubpd	%ymm12, %ymm10, %ymm10
+	LONG $0x592d41c4; BYTE $0xd2               // vmulpd	%ymm10, %ymm10, %ymm10
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	LONG $0x152941c4; BYTE $0xe2               // vunpckhpd	%xmm10, %xmm10, %xmm12
+	LONG $0x587bc1c4; BYTE $0xc4               // vaddsd	%xmm12, %xmm0, %xmm0
+	LONG $0x28fd5362; WORD $0xd419; BYTE $0x01 // vextractf64x2	$1, %ymm10, %xmm12
+	LONG $0x28ad5362; WORD $0xd203; BYTE $0x03 // valignq	$3, %ymm10, %ymm10, %ymm10
+	LONG $0x587bc1c4; BYTE $0xc4               // vaddsd	%xmm12, %xmm0, %xmm0
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	JE   BB0_15
+
+BB0_20:
+	LONG $0x1a048d4e               // leaq	(%rdx,%r11), %r8
+	LONG $0x107b21c4; WORD $0xc714 // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x01438d4d               // leaq	1(%r11), %r8
+	LONG $0x5c2b41c4; BYTE $0xd1   // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xb9a9c2c4; BYTE $0xc2   // vfmadd231sd	%xmm10, %xmm10, %xmm0
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_15
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0x02c38349               // addq	$2, %r11
+	LONG $0x107b21c4; WORD $0xc714 // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1   // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xb9a9c2c4; BYTE $0xc2   // vfmadd231sd	%xmm10, %xmm10, %xmm0
+	WORD $0x394c; BYTE $0xd9       // cmpq	%r11, %rcx
+	JLE  BB0_15
+	WORD $0x0149; BYTE $0xd3       // addq	%rdx, %r11
+	LONG $0x107b21c4; WORD $0xdf14 // vmovsd	(%rdi,%r11,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1   // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xb9a9c2c4; BYTE $0xc2   // vfmadd231sd	%xmm10, %xmm10, %xmm0
+
+BB0_15:
+	LONG $0x99c1e2c4; BYTE $0xc3   // vfmadd132sd	%xmm3, %xmm7, %xmm0
+	LONG $0x57247c80; BYTE $0x00   // cmpb	$0, 87(%rsp)
+	LONG $0xc051fbc5               // vsqrtsd	%xmm0, %xmm0, %xmm0
+	LONG $0xc05ecbc5               // vdivsd	%xmm0, %xmm6, %xmm0
+	LONG $0x48fd7262; WORD $0xe019 // vbroadcastsd	%xmm0, %zmm12
+	JNE  BB0_117
+	WORD $0x854d; BYTE $0xe4       // testq	%r12, %r12
+	JE   BB0_118
+	LONG $0x07f98348               // cmpq	$7, %rcx
+	JLE  BB0_38
+	LONG $0x0008b841; WORD $0x0000 // movl	$8, %r8d
+
+BB0_39:
+	QUAD $0xffc6541048fdb162       // vmovupd	-64(%rsi,%r8,8), %zmm2
+	LONG $0x48ed5162; WORD $0xd35c // vsubpd	%zmm11, %zmm2, %zmm10
+	LONG $0x48ad5162; WORD $0xd459 // vmulpd	%zmm12, %zmm10, %zmm10
+	QUAD $0xffc4545948ad1162       // vmulpd	-64(%r12,%r8,8), %zmm10, %zmm10
+	QUAD $0xffc2541148fd1162       // vmovupd	%zmm10, -64(%r10,%r8,8)
+	LONG $0x08c08349               // addq	$8, %r8
+	WORD $0x3949; BYTE $0xc8       // cmpq	%rcx, %r8
+	JLE  BB0_39
+
+BB0_38:
+	WORD $0x3948; BYTE $0xc1                           // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x8949; BYTE $0xcb                           // movq	%rcx, %r11
+	LONG $0x24448948; BYTE $0x20                       // movq	%rax, 32(%rsp)
+	LONG $0x10048d4c                                   // leaq	(%rax,%rdx), %r8
+	WORD $0x2949; BYTE $0xc3                           // subq	%rax, %r11
+	LONG $0xff5b8d49                                   // leaq	-1(%r11), %rbx
+	LONG $0x245c8948; BYTE $0x18                       // movq	%rbx, 24(%rsp)
+	LONG $0x02fb8348                                   // cmpq	$2, %rbx
+	JBE  BB0_119
+	LONG $0x01488d4c                                   // leaq	1(%rax), %r9
+	QUAD $0x00000000c52c8d4e                           // leaq	0(,%r8,8), %r13
+	LONG $0x244c894c; BYTE $0x60                       // movq	%r9, 96(%rsp)
+	LONG $0x03e1c149                                   // salq	$3, %r9
+	LONG $0x2f1c8d4b                                   // leaq	(%r15,%r13), %rbx
+	LONG $0x6ef941c4; BYTE $0xe9                       // vmovq	%r9, %xmm13
+	LONG $0x2f4c8d4e; BYTE $0x08                       // leaq	8(%rdi,%r13), %r9
+	LONG $0x245c8948; BYTE $0x48                       // movq	%rbx, 72(%rsp)
+	LONG $0x6ef941c4; BYTE $0xd1                       // vmovq	%r9, %xmm10
+	WORD $0x8949; BYTE $0xd9                           // movq	%rbx, %r9
+	LONG $0x7ef961c4; BYTE $0xd3                       // vmovq	%xmm10, %rbx
+	WORD $0x2949; BYTE $0xd9                           // subq	%rbx, %r9
+	LONG $0x30f98349                                   // cmpq	$48, %r9
+	JBE  BB0_40
+	LONG $0x244c8b4c; BYTE $0x48                       // movq	72(%rsp), %r9
+	LONG $0x7ef961c4; BYTE $0xeb                       // vmovq	%xmm13, %rbx
+	WORD $0x014c; BYTE $0xe3                           // addq	%r12, %rbx
+	WORD $0x2949; BYTE $0xd9                           // subq	%rbx, %r9
+	LONG $0x30f98349                                   // cmpq	$48, %r9
+	JBE  BB0_40
+	LONG $0x247c8348; WORD $0x0618                     // cmpq	$6, 24(%rsp)
+	JBE  BB0_59
+	LONG $0x48fd3162; WORD $0x1410; BYTE $0x2f         // vmovupd	(%rdi,%r13), %zmm10
+	LONG $0x7ef961c4; BYTE $0xeb                       // vmovq	%xmm13, %rbx
+	WORD $0x894d; BYTE $0xd9                           // movq	%r11, %r9
+	LONG $0xf8e18349                                   // andq	$-8, %r9
+	LONG $0x48ad5162; WORD $0xd35c                     // vsubpd	%zmm11, %zmm10, %zmm10
+	WORD $0x014c; BYTE $0xc8                           // addq	%r9, %rax
+	LONG $0x48ad5162; WORD $0xd459                     // vmulpd	%zmm12, %zmm10, %zmm10
+	QUAD $0xf81c945948ad5162; WORD $0xffff; BYTE $0xff // vmulpd	-8(%r12,%rbx), %zmm10, %zmm10
+	LONG $0x245c8b48; BYTE $0x48                       // movq	72(%rsp), %rbx
+	LONG $0x48fd7162; WORD $0x1311                     // vmovupd	%zmm10, (%rbx)
+	LONG $0x07c3f641                                   // testb	$7, %r11b
+	JE   BB0_31
+	WORD $0x294d; BYTE $0xcb                           // subq	%r9, %r11
+	LONG $0xff5b8d49                                   // leaq	-1(%r11), %rbx
+	LONG $0x02fb8348                                   // cmpq	$2, %rbx
+	JBE  BB0_44
+
+BB0_41:
+	WORD $0x014d; BYTE $0xc8       // addq	%r9, %r8
+	LONG $0x197d42c4; BYTE $0xd1   // vbroadcastsd	%xmm9, %ymm10
+	LONG $0x245c8b48; BYTE $0x20   // movq	32(%rsp), %rbx
+	LONG $0x197d62c4; BYTE $0xd8   // vbroadcastsd	%xmm0, %ymm11
+	LONG $0x107da1c4; WORD $0xc714 // vmovupd	(%rdi,%r8,8), %ymm2
+	WORD $0x014c; BYTE $0xcb       // addq	%r9, %rbx
+	LONG $0x5c6d41c4; BYTE $0xd2   // vsubpd	%ymm10, %ymm2, %ymm10
+	LONG $0x592d41c4; BYTE $0xd3   // vmulpd	%ymm11, %ymm10, %ymm10
+	LONG $0x592d41c4; WORD $0xdc14 // vmulpd	(%r12,%rbx,8), %ymm10, %ymm10
+	LONG $0x117d01c4; WORD $0xc714 // vmovupd	%ymm10, (%r15,%r8,8)
+	WORD $0x894d; BYTE $0xd8       // movq	%r11, %r8
+	LONG $0xfce08349               // andq	$-4, %r8
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x03e38341               // andl	$3, %r11d
+	JE   BB0_31
+
+BB0_44:
+	LONG $0x02048d4c                           // leaq	(%rdx,%rax), %r8
+	QUAD $0x00000000c50c8d4c                   // leaq	0(,%rax,8), %r9
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x592b41c4; WORD $0xc414             // vmulsd	(%r12,%rax,8), %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x01408d4c                           // leaq	1(%rax), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x592b01c4; WORD $0x0c54; BYTE $0x08 // vmulsd	8(%r12,%r9), %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x14107bc5; BYTE $0xc7               // vmovsd	(%rdi,%rax,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xc9               // vsubsd	%xmm9, %xmm10, %xmm9
+	LONG $0xc059b3c5                           // vmulsd	%xmm0, %xmm9, %xmm0
+	LONG $0x597b81c4; WORD $0x0c44; BYTE $0x10 // vmulsd	16(%r12,%r9), %xmm0, %xmm0
+	LONG $0x117bc1c4; WORD $0xc704             // vmovsd	%xmm0, (%r15,%rax,8)
+
+BB0_31:
+	LONG $0x7ef9e1c4; BYTE $0xe3   // vmovq	%xmm4, %rbx
+	LONG $0x24448348; WORD $0x0178 // addq	$1, 120(%rsp)
+	WORD $0x0148; BYTE $0xca       // addq	%rcx, %rdx
+	LONG $0x24448b48; BYTE $0x78   // movq	120(%rsp), %rax
+	WORD $0x0148; BYTE $0xde       // addq	%rbx, %rsi
+	WORD $0x0149; BYTE $0xda       // addq	%rbx, %r10
+	LONG $0x24443948; BYTE $0x58   // cmpq	%rax, 88(%rsp)
+	JNE  BB0_26
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+
+BB0_114:
+	LONG $0xd0658d48 // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_117:
+	LONG $0x07f98348               // cmpq	$7, %rcx
+	JLE  BB0_23
+	LONG $0x0008b841; WORD $0x0000 // movl	$8, %r8d
+
+BB0_24:
+	QUAD $0xffc64c1048fdb162       // vmovupd	-64(%rsi,%r8,8), %zmm1
+	LONG $0x48f55162; WORD $0xd35c // vsubpd	%zmm11, %zmm1, %zmm10
+	QUAD $0xffc64c1048fd9162       // vmovupd	-64(%r14,%r8,8), %zmm1
+	LONG $0x48ad5162; WORD $0xd459 // vmulpd	%zmm12, %zmm10, %zmm10
+	QUAD $0xffc4549848f51262       // vfmadd132pd	-64(%r12,%r8,8), %zmm1, %zmm10
+	QUAD $0xffc2541148fd1162       // vmovupd	%zmm10, -64(%r10,%r8,8)
+	LONG $0x08c08349               // addq	$8, %r8
+	WORD $0x3949; BYTE $0xc8       // cmpq	%rcx, %r8
+	JLE  BB0_24
+
+BB0_23:
+	WORD $0x3948; BYTE $0xc1                           // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x8949; BYTE $0xcb                           // movq	%rcx, %r11
+	LONG $0x24448948; BYTE $0x18                       // movq	%rax, 24(%rsp)
+	LONG $0x10048d4c                                   // leaq	(%rax,%rdx), %r8
+	WORD $0x2949; BYTE $0xc3                           // subq	%rax, %r11
+	LONG $0xff5b8d49                                   // leaq	-1(%r11), %rbx
+	LONG $0x245c8948; BYTE $0x10                       // movq	%rbx, 16(%rsp)
+	LONG $0x02fb8348                                   // cmpq	$2, %rbx
+	JBE  BB0_120
+	QUAD $0x00000000c51c8d4a                           // leaq	0(,%r8,8), %rbx
+	LONG $0x6ef961c4; BYTE $0xd3                       // vmovq	%rbx, %xmm10
+	WORD $0x014c; BYTE $0xfb                           // addq	%r15, %rbx
+	WORD $0x8949; BYTE $0xd9                           // movq	%rbx, %r9
+	LONG $0x01588d48                                   // leaq	1(%rax), %rbx
+	LONG $0x245c8948; BYTE $0x60                       // movq	%rbx, 96(%rsp)
+	LONG $0x03e3c148                                   // salq	$3, %rbx
+	LONG $0x1e2c8d4d                                   // leaq	(%r14,%rbx), %r13
+	LONG $0x244c894c; BYTE $0x48                       // movq	%r9, 72(%rsp)
+	WORD $0x294d; BYTE $0xe9                           // subq	%r13, %r9
+	LONG $0x1c2c8d4d                                   // leaq	(%r12,%rbx), %r13
+	LONG $0x30f98349                                   // cmpq	$48, %r9
+	LONG $0x244c8b4c; BYTE $0x48                       // movq	72(%rsp), %r9
+	LONG $0x2444970f; BYTE $0x20                       // seta	32(%rsp)
+	WORD $0x294d; BYTE $0xe9                           // subq	%r13, %r9
+	LONG $0x30f98349                                   // cmpq	$48, %r9
+	LONG $0xc5970f41                                   // seta	%r13b
+	LONG $0x246c8444; BYTE $0x20                       // testb	%r13b, 32(%rsp)
+	JE   BB0_27
+	LONG $0x244c8b4c; BYTE $0x48                       // movq	72(%rsp), %r9
+	LONG $0x7ef941c4; BYTE $0xd5                       // vmovq	%xmm10, %r13
+	LONG $0x2f6c8d4e; BYTE $0x08                       // leaq	8(%rdi,%r13), %r13
+	WORD $0x294d; BYTE $0xe9                           // subq	%r13, %r9
+	LONG $0x30f98349                                   // cmpq	$48, %r9
+	JBE  BB0_27
+	LONG $0x247c8348; WORD $0x0610                     // cmpq	$6, 16(%rsp)
+	JBE  BB0_58
+	LONG $0x7ef941c4; BYTE $0xd5                       // vmovq	%xmm10, %r13
+	QUAD $0xf81c941048fd5162; WORD $0xffff; BYTE $0xff // vmovupd	-8(%r12,%rbx), %zmm10
+	LONG $0x244c8b4c; BYTE $0x48                       // movq	72(%rsp), %r9
+	LONG $0x48fd3162; WORD $0x2c10; BYTE $0x2f         // vmovupd	(%rdi,%r13), %zmm13
+	LONG $0x48955162; WORD $0xdb5c                     // vsubpd	%zmm11, %zmm13, %zmm11
+	LONG $0x48a55162; WORD $0xdc59                     // vmulpd	%zmm12, %zmm11, %zmm11
+	QUAD $0xf81e94a848a55262; WORD $0xffff; BYTE $0xff // vfmadd213pd	-8(%r14,%rbx), %zmm11, %zmm10
+	LONG $0x48fd5162; WORD $0x1111                     // vmovupd	%zmm10, (%r9)
+	WORD $0x894d; BYTE $0xd9                           // movq	%r11, %r9
+	LONG $0xf8e18349                                   // andq	$-8, %r9
+	WORD $0x014c; BYTE $0xc8                           // addq	%r9, %rax
+	LONG $0x07c3f641                                   // testb	$7, %r11b
+	JE   BB0_31
+	WORD $0x294d; BYTE $0xcb                           // subq	%r9, %r11
+	LONG $0xff5b8d49                                   // leaq	-1(%r11), %rbx
+	LONG $0x02fb8348                                   // cmpq	$2, %rbx
+	JBE  BB0_32
+
+BB0_28:
+	WORD $0x014d; BYTE $0xc8       // addq	%r9, %r8
+	LONG $0x197d42c4; BYTE $0xd1   // vbroadcastsd	%xmm9, %ymm10
+	LONG $0x245c8b48; BYTE $0x18   // movq	24(%rsp), %rbx
+	LONG $0x197d62c4; BYTE $0xd8   // vbroadcastsd	%xmm0, %ymm11
+	LONG $0x107da1c4; WORD $0xc70c // vmovupd	(%rdi,%r8,8), %ymm1
+	WORD $0x014c; BYTE $0xcb       // addq	%r9, %rbx
+	LONG $0x5c7541c4; BYTE $0xd2   // vsubpd	%ymm10, %ymm1, %ymm10
+	LONG $0x107dc1c4; WORD $0xde14 // vmovupd	(%r14,%rbx,8), %ymm2
+	LONG $0x592d41c4; BYTE $0xd3   // vmulpd	%ymm11, %ymm10, %ymm10
+	LONG $0x98ed42c4; WORD $0xdc14 // vfmadd132pd	(%r12,%rbx,8), %ymm2, %ymm10
+	LONG $0x117d01c4; WORD $0xc714 // vmovupd	%ymm10, (%r15,%r8,8)
+	WORD $0x894d; BYTE $0xd8       // movq	%r11, %r8
+	LONG $0xfce08349               // andq	$-4, %r8
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x03e38341               // andl	$3, %r11d
+	JE   BB0_31
+
+BB0_32:
+	LONG $0x02048d4c                           // leaq	(%rdx,%rax), %r8
+	LONG $0x107bc1c4; WORD $0xc614             // vmovsd	(%r14,%rax,8), %xmm2
+	QUAD $0x00000000c50c8d4c                   // leaq	0(,%rax,8), %r9
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x99e942c4; WORD $0xc414             // vfmadd132sd	(%r12,%rax,8), %xmm2, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x01408d4c                           // leaq	1(%rax), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x107b81c4; WORD $0x0e54; BYTE $0x08 // vmovsd	8(%r14,%r9), %xmm2
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x99e902c4; WORD $0x0c54; BYTE $0x08 // vfmadd132sd	8(%r12,%r9), %xmm2, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x107b81c4; WORD $0x0e54; BYTE $0x10 // vmovsd	16(%r14,%r9), %xmm2
+	LONG $0x14107bc5; BYTE $0xc7               // vmovsd	(%rdi,%rax,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xc9               // vsubsd	%xmm9, %xmm10, %xmm9
+	LONG $0xc059b3c5                           // vmulsd	%xmm0, %xmm9, %xmm0
+	LONG $0x99e982c4; WORD $0x0c44; BYTE $0x10 // vfmadd132sd	16(%r12,%r9), %xmm2, %xmm0
+	LONG $0x117bc1c4; WORD $0xc704             // vmovsd	%xmm0, (%r15,%rax,8)
+	JMP  BB0_31
+
+BB0_119:
+	LONG $0x01588d48             // leaq	1(%rax), %rbx
+	LONG $0x245c8948; BYTE $0x60 // movq	%rbx, 96(%rsp)
+
+BB0_40:
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x244c8b4c; BYTE $0x60               // movq	96(%rsp), %r9
+	QUAD $0x00000000c51c8d4c                   // leaq	0(,%rax,8), %r11
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x592b41c4; WORD $0xc414             // vmulsd	(%r12,%rax,8), %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	WORD $0x394c; BYTE $0xc9                   // cmpq	%r9, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd1                   // addq	%rdx, %r9
+	LONG $0x02408d4c                           // leaq	2(%rax), %r8
+	LONG $0x107b21c4; WORD $0xcf14             // vmovsd	(%rdi,%r9,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x592b01c4; WORD $0x1c54; BYTE $0x08 // vmulsd	8(%r12,%r11), %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xcf14             // vmovsd	%xmm10, (%r15,%r9,8)
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x592b01c4; WORD $0x1c54; BYTE $0x10 // vmulsd	16(%r12,%r11), %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x03408d4c                           // leaq	3(%rax), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x592b01c4; WORD $0x1c54; BYTE $0x18 // vmulsd	24(%r12,%r11), %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x04408d4c                           // leaq	4(%rax), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x592b01c4; WORD $0x1c54; BYTE $0x20 // vmulsd	32(%r12,%r11), %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x05408d4c                           // leaq	5(%rax), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x592b01c4; WORD $0x1c54; BYTE $0x28 // vmulsd	40(%r12,%r11), %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x06408d4c                           // leaq	6(%rax), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x07c08348                           // addq	$7, %rax
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x592b01c4; WORD $0x1c54; BYTE $0x30 // vmulsd	48(%r12,%r11), %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x14107bc5; BYTE $0xc7               // vmovsd	(%rdi,%rax,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xc9               // vsubsd	%xmm9, %xmm10, %xmm9
+	LONG $0xc059b3c5                           // vmulsd	%xmm0, %xmm9, %xmm0
+	LONG $0x597b81c4; WORD $0x1c44; BYTE $0x38 // vmulsd	56(%r12,%r11), %xmm0, %xmm0
+	LONG $0x117bc1c4; WORD $0xc704             // vmovsd	%xmm0, (%r15,%rax,8)
+	JMP  BB0_31
+
+BB0_118:
+	LONG $0x7ef961c4; BYTE $0xc3 // vmovq	%xmm8, %rbx
+	QUAD $0x00000000d5048d4c     // leaq	0(,%rdx,8), %r8
+	LONG $0x130c8d4c             // leaq	(%rbx,%rdx), %r9
+	LONG $0x03e1c149             // salq	$3, %r9
+	LONG $0x07f98348             // cmpq	$7, %rcx
+	JLE  BB0_37
+
+BB0_47:
+	LONG $0x48fdb162; WORD $0x1410; BYTE $0x07 // vmovupd	(%rdi,%r8), %zmm2
+	LONG $0x48ed5162; WORD $0xd35c             // vsubpd	%zmm11, %zmm2, %zmm10
+	LONG $0x48ad5162; WORD $0xd459             // vmulpd	%zmm12, %zmm10, %zmm10
+	LONG $0x48fd1162; WORD $0x1411; BYTE $0x07 // vmovupd	%zmm10, (%r15,%r8)
+	LONG $0x40c08349                           // addq	$64, %r8
+	WORD $0x394d; BYTE $0xc8                   // cmpq	%r9, %r8
+	JNE  BB0_47
+
+BB0_37:
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x8949; BYTE $0xc9     // movq	%rcx, %r9
+	LONG $0x02048d4c             // leaq	(%rdx,%rax), %r8
+	WORD $0x2949; BYTE $0xc1     // subq	%rax, %r9
+	LONG $0xff598d49             // leaq	-1(%r9), %rbx
+	LONG $0x245c8948; BYTE $0x60 // movq	%rbx, 96(%rsp)
+	LONG $0x02fb8348             // cmpq	$2, %rbx
+	JBE  BB0_48
+	QUAD $0x00000000c52c8d4e     // leaq	0(,%r8,8), %r13
+	LONG $0x2f5c8d4e; BYTE $0x08 // leaq	8(%rdi,%r13), %r11
+	LONG $0x2f1c8d4b             // leaq	(%r15,%r13), %rbx
+	LONG $0x6ef9c1c4; BYTE $0xcb // vmovq	%r11, %xmm1
+	LONG $0x245c8948; BYTE $0x48 // movq	%rbx, 72(%rsp)
+	WORD $0x8949; BYTE $0xdb     // movq	%rbx, %r11
+	LONG $0x7ef9e1c4; BYTE $0xcb // vmovq	%xmm1, %rbx
+	WORD $0x2949; BYTE $0xdb     // subq	%rbx, %r11
+	LONG $0x30fb8349             // cmpq	$48, %r11
+	JA   BB0_121
+
+BB0_48:
+	LONG $0x107b21c4; WORD $0xc714 // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1   // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5               // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714 // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0x107b21c4; WORD $0xc714 // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1   // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5               // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714 // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0x107b21c4; WORD $0xc714 // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1   // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5               // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714 // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0x107b21c4; WORD $0xc714 // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1   // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5               // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714 // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0x107b21c4; WORD $0xc714 // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1   // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5               // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714 // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0x107b21c4; WORD $0xc714 // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1   // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5               // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714 // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x06408d4c               // leaq	6(%rax), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0x07c08348               // addq	$7, %rax
+	LONG $0x107b21c4; WORD $0xc714 // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1   // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5               // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714 // vmovsd	%xmm10, (%r15,%r8,8)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x14107bc5; BYTE $0xc7   // vmovsd	(%rdi,%rax,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xc9   // vsubsd	%xmm9, %xmm10, %xmm9
+	LONG $0xc059b3c5               // vmulsd	%xmm0, %xmm9, %xmm0
+	LONG $0x117bc1c4; WORD $0xc704 // vmovsd	%xmm0, (%r15,%rax,8)
+	JMP  BB0_31
+
+BB0_120:
+	LONG $0x01588d48             // leaq	1(%rax), %rbx
+	LONG $0x245c8948; BYTE $0x60 // movq	%rbx, 96(%rsp)
+
+BB0_27:
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x107bc1c4; WORD $0xc60c             // vmovsd	(%r14,%rax,8), %xmm1
+	QUAD $0x00000000c51c8d4c                   // leaq	0(,%rax,8), %r11
+	LONG $0x244c8b4c; BYTE $0x60               // movq	96(%rsp), %r9
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x99f142c4; WORD $0xc414             // vfmadd132sd	(%r12,%rax,8), %xmm1, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	WORD $0x394c; BYTE $0xc9                   // cmpq	%r9, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd1                   // addq	%rdx, %r9
+	LONG $0x107b81c4; WORD $0x1e54; BYTE $0x08 // vmovsd	8(%r14,%r11), %xmm2
+	LONG $0x02408d4c                           // leaq	2(%rax), %r8
+	LONG $0x107b21c4; WORD $0xcf14             // vmovsd	(%rdi,%r9,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x99e902c4; WORD $0x1c54; BYTE $0x08 // vfmadd132sd	8(%r12,%r11), %xmm2, %xmm10
+	LONG $0x117b01c4; WORD $0xcf14             // vmovsd	%xmm10, (%r15,%r9,8)
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JGE  BB0_31
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x107b81c4; WORD $0x1e54; BYTE $0x10 // vmovsd	16(%r14,%r11), %xmm2
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x99e902c4; WORD $0x1c54; BYTE $0x10 // vfmadd132sd	16(%r12,%r11), %xmm2, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x03408d4c                           // leaq	3(%rax), %r8
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JGE  BB0_31
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x107b81c4; WORD $0x1e4c; BYTE $0x18 // vmovsd	24(%r14,%r11), %xmm1
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x99f102c4; WORD $0x1c54; BYTE $0x18 // vfmadd132sd	24(%r12,%r11), %xmm1, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x04408d4c                           // leaq	4(%rax), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x107b81c4; WORD $0x1e4c; BYTE $0x20 // vmovsd	32(%r14,%r11), %xmm1
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x99f102c4; WORD $0x1c54; BYTE $0x20 // vfmadd132sd	32(%r12,%r11), %xmm1, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x05408d4c                           // leaq	5(%rax), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x107b81c4; WORD $0x1e4c; BYTE $0x28 // vmovsd	40(%r14,%r11), %xmm1
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x99f102c4; WORD $0x1c54; BYTE $0x28 // vfmadd132sd	40(%r12,%r11), %xmm1, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x06408d4c                           // leaq	6(%rax), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+	LONG $0x107b81c4; WORD $0x1e4c; BYTE $0x30 // vmovsd	48(%r14,%r11), %xmm1
+	LONG $0x07c08348                           // addq	$7, %rax
+	LONG $0x107b21c4; WORD $0xc714             // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1               // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5                           // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x99f102c4; WORD $0x1c54; BYTE $0x30 // vfmadd132sd	48(%r12,%r11), %xmm1, %xmm10
+	LONG $0x117b01c4; WORD $0xc714             // vmovsd	%xmm10, (%r15,%r8,8)
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JGE  BB0_31
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x107b81c4; WORD $0x1e54; BYTE $0x38 // vmovsd	56(%r14,%r11), %xmm2
+	LONG $0x14107bc5; BYTE $0xc7               // vmovsd	(%rdi,%rax,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xc9               // vsubsd	%xmm9, %xmm10, %xmm9
+	LONG $0xc059b3c5                           // vmulsd	%xmm0, %xmm9, %xmm0
+	LONG $0x99e982c4; WORD $0x1c44; BYTE $0x38 // vfmadd132sd	56(%r12,%r11), %xmm2, %xmm0
+	LONG $0x117bc1c4; WORD $0xc704             // vmovsd	%xmm0, (%r15,%rax,8)
+	JMP  BB0_31
+
+BB0_7:
+	LONG $0xc85963c5               // vmulsd	%xmm0, %xmm3, %xmm9
+	LONG $0x48fd5262; WORD $0xd919 // vbroadcastsd	%xmm9, %zmm11
+	JMP  BB0_11
+
+BB0_5:
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0xc031             // xorl	%eax, %eax
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_8
+
+BB0_57:
+	WORD $0x8949; BYTE $0xc3 // movq	%rax, %r11
+	WORD $0xdb31             // xorl	%ebx, %ebx
+	JMP  BB0_16
+
+BB0_121:
+	LONG $0x247c8348; WORD $0x0660             // cmpq	$6, 96(%rsp)
+	JBE  BB0_60
+	LONG $0x48fd3162; WORD $0x1410; BYTE $0x2f // vmovupd	(%rdi,%r13), %zmm10
+	LONG $0x245c8b48; BYTE $0x48               // movq	72(%rsp), %rbx
+	WORD $0x894d; BYTE $0xcb                   // movq	%r9, %r11
+	LONG $0xf8e38349                           // andq	$-8, %r11
+	LONG $0x48ad5162; WORD $0xd35c             // vsubpd	%zmm11, %zmm10, %zmm10
+	WORD $0x014c; BYTE $0xd8                   // addq	%r11, %rax
+	LONG $0x48ad5162; WORD $0xd459             // vmulpd	%zmm12, %zmm10, %zmm10
+	LONG $0x48fd7162; WORD $0x1311             // vmovupd	%zmm10, (%rbx)
+	LONG $0x07c1f641                           // testb	$7, %r9b
+	JE   BB0_31
+	WORD $0x294d; BYTE $0xd9                   // subq	%r11, %r9
+	LONG $0xff598d49                           // leaq	-1(%r9), %rbx
+	LONG $0x02fb8348                           // cmpq	$2, %rbx
+	JBE  BB0_52
+
+BB0_49:
+	WORD $0x014d; BYTE $0xc3       // addq	%r8, %r11
+	LONG $0x197d42c4; BYTE $0xd1   // vbroadcastsd	%xmm9, %ymm10
+	LONG $0x197d62c4; BYTE $0xd8   // vbroadcastsd	%xmm0, %ymm11
+	WORD $0x894d; BYTE $0xc8       // movq	%r9, %r8
+	LONG $0x107da1c4; WORD $0xdf0c // vmovupd	(%rdi,%r11,8), %ymm1
+	LONG $0xfce08349               // andq	$-4, %r8
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x03e18341               // andl	$3, %r9d
+	LONG $0x5c7541c4; BYTE $0xd2   // vsubpd	%ymm10, %ymm1, %ymm10
+	LONG $0x592d41c4; BYTE $0xd3   // vmulpd	%ymm11, %ymm10, %ymm10
+	LONG $0x117d01c4; WORD $0xdf14 // vmovupd	%ymm10, (%r15,%r11,8)
+	JE   BB0_31
+
+BB0_52:
+	LONG $0x02048d4c               // leaq	(%rdx,%rax), %r8
+	LONG $0x107b21c4; WORD $0xc714 // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1   // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5               // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714 // vmovsd	%xmm10, (%r15,%r8,8)
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_31
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x107b21c4; WORD $0xc714 // vmovsd	(%rdi,%r8,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xd1   // vsubsd	%xmm9, %xmm10, %xmm10
+	LONG $0xd0592bc5               // vmulsd	%xmm0, %xmm10, %xmm10
+	LONG $0x117b01c4; WORD $0xc714 // vmovsd	%xmm10, (%r15,%r8,8)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_31
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x14107bc5; BYTE $0xc7   // vmovsd	(%rdi,%rax,8), %xmm10
+	LONG $0x5c2b41c4; BYTE $0xc9   // vsubsd	%xmm9, %xmm10, %xmm9
+	LONG $0xc85933c5               // vmulsd	%xmm0, %xmm9, %xmm9
+	LONG $0x117b41c4; WORD $0xc70c // vmovsd	%xmm9, (%r15,%rax,8)
+	JMP  BB0_31
+
+BB0_55:
+	WORD $0x8949; BYTE $0xc0 // movq	%rax, %r8
+	JMP  BB0_8
+
+BB0_59:
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	JMP  BB0_41
+
+BB0_58:
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	JMP  BB0_28
+
+BB0_60:
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	JMP  BB0_49
@@ -0,0 +1,499 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baselogsoftmax_c_f32_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_11<>+0(SB)/4, $0xb95e8083
+GLOBL CPI0_11<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_13<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_13<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_14<>+0(SB)/4, $0x3c088889
+DATA CPI0_14<>+4(SB)/4, $0x3c088889
+DATA CPI0_14<>+8(SB)/4, $0x3c088889
+DATA CPI0_14<>+12(SB)/4, $0x3c088889
+DATA CPI0_14<>+16(SB)/4, $0x3c088889
+DATA CPI0_14<>+20(SB)/4, $0x3c088889
+DATA CPI0_14<>+24(SB)/4, $0x3c088889
+DATA CPI0_14<>+28(SB)/4, $0x3c088889
+GLOBL CPI0_14<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_16<>+0(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+4(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+8(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+12(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+16(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+20(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+24(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+28(SB)/4, $0x3d2aaaab
+GLOBL CPI0_16<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_18<>+0(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+4(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+8(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+12(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+16(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+20(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+24(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+28(SB)/4, $0x3e2aaaab
+GLOBL CPI0_18<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_20<>+0(SB)/4, $0x3f000000
+DATA CPI0_20<>+4(SB)/4, $0x3f000000
+DATA CPI0_20<>+8(SB)/4, $0x3f000000
+DATA CPI0_20<>+12(SB)/4, $0x3f000000
+DATA CPI0_20<>+16(SB)/4, $0x3f000000
+DATA CPI0_20<>+20(SB)/4, $0x3f000000
+DATA CPI0_20<>+24(SB)/4, $0x3f000000
+DATA CPI0_20<>+28(SB)/4, $0x3f000000
+GLOBL CPI0_20<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_23<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_23<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_25<>+0(SB)/4, $0x7f800000
+DATA CPI0_25<>+4(SB)/4, $0x7f800000
+DATA CPI0_25<>+8(SB)/4, $0x7f800000
+DATA CPI0_25<>+12(SB)/4, $0x7f800000
+DATA CPI0_25<>+16(SB)/4, $0x7f800000
+DATA CPI0_25<>+20(SB)/4, $0x7f800000
+DATA CPI0_25<>+24(SB)/4, $0x7f800000
+DATA CPI0_25<>+28(SB)/4, $0x7f800000
+GLOBL CPI0_25<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_26<>+0(SB)/4, $0x44314000
+GLOBL CPI0_26<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_27<>+0(SB)/4, $0xc4314000
+GLOBL CPI0_27<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_28<>+0(SB)/4, $0x652b82fe
+DATA CPI0_28<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_28<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_29<>+0(SB)/4, $0x00000000
+DATA CPI0_29<>+4(SB)/4, $0x80000000
+DATA CPI0_29<>+8(SB)/4, $0x00000000
+DATA CPI0_29<>+12(SB)/4, $0x00000000
+GLOBL CPI0_29<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_3<>+0(SB)/4, $0x42b17218
+GLOBL CPI0_3<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_30<>+0(SB)/4, $0xffffffff
+DATA CPI0_30<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_30<>+8(SB)/4, $0x00000000
+DATA CPI0_30<>+12(SB)/4, $0x00000000
+GLOBL CPI0_30<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_31<>+0(SB)/4, $0xfee00000
+DATA CPI0_31<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_31<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_32<>+0(SB)/4, $0x35793c6c
+DATA CPI0_32<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_32<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_33<>+0(SB)/4, $0xeff8d898
+DATA CPI0_33<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_33<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_34<>+0(SB)/4, $0x67f544e4
+DATA CPI0_34<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_34<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_35<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_35<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_35<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_36<>+0(SB)/4, $0xa556c734
+DATA CPI0_36<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_36<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_37<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_37<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_37<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_38<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_38<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_38<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_39<>+0(SB)/4, $0x16c16c17
+DATA CPI0_39<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_39<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_40<>+0(SB)/4, $0x11111111
+DATA CPI0_40<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_40<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_41<>+0(SB)/4, $0x55555555
+DATA CPI0_41<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_41<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_42<>+0(SB)/4, $0x55555555
+DATA CPI0_42<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_42<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_43<>+0(SB)/4, $0x00000000
+DATA CPI0_43<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_43<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_44<>+0(SB)/4, $0x00000000
+DATA CPI0_44<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_44<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_45<>+0(SB)/4, $0x667f3bcd
+DATA CPI0_45<>+4(SB)/4, $0x3ff6a09e
+GLOBL CPI0_45<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_46<>+0(SB)/4, $0xd078c69f
+DATA CPI0_46<>+4(SB)/4, $0x3fb39a09
+GLOBL CPI0_46<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_47<>+0(SB)/4, $0x96cb03de
+DATA CPI0_47<>+4(SB)/4, $0x3fb74664
+GLOBL CPI0_47<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_48<>+0(SB)/4, $0x1d8e78af
+DATA CPI0_48<>+4(SB)/4, $0x3fbc71c5
+GLOBL CPI0_48<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_49<>+0(SB)/4, $0x94229359
+DATA CPI0_49<>+4(SB)/4, $0x3fc24924
+GLOBL CPI0_49<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_5<>+0(SB)/4, $0xc2aeac50
+GLOBL CPI0_5<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_50<>+0(SB)/4, $0x9997fa04
+DATA CPI0_50<>+4(SB)/4, $0x3fc99999
+GLOBL CPI0_50<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_51<>+0(SB)/4, $0x55555593
+DATA CPI0_51<>+4(SB)/4, $0x3fd55555
+GLOBL CPI0_51<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_52<>+0(SB)/4, $0x35793c76
+DATA CPI0_52<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_52<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_7<>+0(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_7<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_9<>+0(SB)/4, $0x3f318000
+GLOBL CPI0_9<>(SB), (RODATA|NOPTR), $4
+
+TEXT ·logsoftmax_c_f32_avx2(SB), $64-24
+	MOVQ input+0(FP), DI
+	MOVQ output+8(FP), SI
+	MOVQ plen_input+16(FP), DX
+	WORD $0x8b48; BYTE $0x12     // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_58
+	WORD $0x8948; BYTE $0xf9     // movq	%rdi, %rcx
+	LONG $0x246c8d48; BYTE $0x30 // leaq	48(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348             // andq	$-32, %rsp
+	LONG $0x2710fac5             // vmovss	(%rdi), %xmm4
+	LONG $0x01fa8348             // cmpq	$1, %rdx
+	JLE  BB0_24
+	LONG $0x04478d4c             // leaq	4(%rdi), %r8
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	QUAD $0x00000000953c8d48     // leaq	0(,%rdx,4), %rdi
+	LONG $0x390c8d4c             // leaq	(%rcx,%rdi), %r9
+
+BB0_5:
+	LONG         $0x107ac1c4; BYTE $0x00   // vmovss	(%r8), %xmm0
+	LONG         $0x04c08349               // addq	$4, %r8
+	LONG         $0xe45ffac5               // vmaxss	%xmm4, %xmm0, %xmm4
+	WORD         $0x394d; BYTE $0xc8       // cmpq	%r9, %r8
+	JNE          BB0_5
+	LONG         $0x187d62c4; BYTE $0xc4   // vbroadcastss	%xmm4, %ymm8
+	LONG         $0x07fa8348               // cmpq	$7, %rdx
+	JLE          BB0_6
+	LONG         $0xf8428d4c               // leaq	-8(%rdx), %r8
+	LONG         $0x007fb941; WORD $0x0000 // movl	$127, %r9d
+	VBROADCASTSS CPI0_3<>(SB), Y15         // vbroadcastss	.LCPI0_3(%rip), %ymm15
+	VBROADCASTSS CPI0_5<>(SB), Y14         // vbroadcastss	.LCPI0_5(%rip), %ymm14
+	LONG         $0x6e79c1c4; BYTE $0xf9   // vmovd	%r9d, %xmm7
+	LONG         $0x03e8c149               // shrq	$3, %r8
+	LONG         $0xed57d0c5               // vxorps	%xmm5, %xmm5, %xmm5
+	LONG         $0xef3141c4; BYTE $0xc9   // vpxor	%xmm9, %xmm9, %xmm9
+	WORD         $0x894c; BYTE $0xc7       // movq	%r8, %rdi
+	LONG         $0x587de2c4; BYTE $0xff   // vpbroadcastd	%xmm7, %ymm7
+	VBROADCASTSS CPI0_7<>(SB), Y13         // vbroadcastss	.LCPI0_7(%rip), %ymm13
+	VBROADCASTSS CPI0_9<>(SB), Y12         // vbroadcastss	.LCPI0_9(%rip), %ymm12
+	LONG         $0x05e7c148               // salq	$5, %rdi
+	LONG         $0x3c7ffdc5; BYTE $0x24   // vmovdqa	%ymm7, (%rsp)
+	VBROADCASTSS CPI0_11<>(SB), Y11        // vbroadcastss	.LCPI0_11(%rip), %ymm11
+	VBROADCASTSS CPI0_13<>(SB), Y10        // vbroadcastss	.LCPI0_13(%rip), %ymm10
+	VBROADCASTSS CPI0_23<>(SB), Y6         // vbroadcastss	.LCPI0_23(%rip), %ymm6
+	LONG         $0x397c8d48; BYTE $0x20   // leaq	32(%rcx,%rdi), %rdi
+
+BB0_7:
+	LONG        $0x3810fcc5               // vmovups	(%rax), %ymm7
+	LONG        $0xd0297cc5               // vmovaps	%ymm10, %ymm0
+	LONG        $0x20c08348               // addq	$32, %rax
+	LONG        $0x5c44c1c4; BYTE $0xc8   // vsubps	%ymm8, %ymm7, %ymm1
+	LONG        $0x5974c1c4; BYTE $0xd5   // vmulps	%ymm13, %ymm1, %ymm2
+	LONG        $0xc274c1c4; WORD $0x1eff // vcmpps	$30, %ymm15, %ymm1, %ymm7
+	LONG        $0xc274c1c4; WORD $0x11de // vcmpps	$17, %ymm14, %ymm1, %ymm3
+	LONG        $0xdb66b5c5               // vpcmpgtd	%ymm3, %ymm9, %ymm3
+	LONG        $0x087de3c4; WORD $0x08d2 // vroundps	$8, %ymm2, %ymm2
+	LONG        $0xbc6dc2c4; BYTE $0xcc   // vfnmadd231ps	%ymm12, %ymm2, %ymm1
+	LONG        $0xbc6dc2c4; BYTE $0xcb   // vfnmadd231ps	%ymm11, %ymm2, %ymm1
+	LONG        $0xd25bfdc5               // vcvtps2dq	%ymm2, %ymm2
+	LONG        $0x14feedc5; BYTE $0x24   // vpaddd	(%rsp), %ymm2, %ymm2
+	VFMADD213PS CPI0_14<>(SB), Y1, Y0     // vfmadd213ps	.LCPI0_14(%rip), %ymm1, %ymm0
+	VFMADD213PS CPI0_16<>(SB), Y1, Y0     // vfmadd213ps	.LCPI0_16(%rip), %ymm1, %ymm0
+	LONG        $0xf272edc5; BYTE $0x17   // vpslld	$23, %ymm2, %ymm2
+	VFMADD213PS CPI0_18<>(SB), Y1, Y0     // vfmadd213ps	.LCPI0_18(%rip), %ymm1, %ymm0
+	VFMADD213PS CPI0_20<>(SB), Y1, Y0     // vfmadd213ps	.LCPI0_20(%rip), %ymm1, %ymm0
+	LONG        $0x984de2c4; BYTE $0xc1   // vfmadd132ps	%ymm1, %ymm6, %ymm0
+	LONG        $0x984de2c4; BYTE $0xc1   // vfmadd132ps	%ymm1, %ymm6, %ymm0
+	LONG        $0xc259fcc5               // vmulps	%ymm2, %ymm0, %ymm0
+	VBLENDVPS   Y7, CPI0_25<>(SB), Y0, Y0 // vblendvps	%ymm7, .LCPI0_25(%rip), %ymm0, %ymm0
+	LONG        $0xd855e4c5               // vandnps	%ymm0, %ymm3, %ymm3
+	LONG        $0xeb58d4c5               // vaddps	%ymm3, %ymm5, %ymm5
+	WORD        $0x3948; BYTE $0xc7       // cmpq	%rax, %rdi
+	JNE         BB0_7
+	QUAD        $0x00000008c5048d4a       // leaq	8(,%r8,8), %rax
+
+BB0_3:
+	LONG   $0x197de3c4; WORD $0x01e8 // vextractf128	$0x1, %ymm5, %xmm0
+	VMOVSD CPI0_31<>(SB), X7         // vmovsd	.LCPI0_31(%rip), %xmm7
+	LONG   $0xe858d0c5               // vaddps	%xmm0, %xmm5, %xmm5
+	LONG   $0xd512d0c5               // vmovhlps	%xmm5, %xmm5, %xmm2
+	LONG   $0xd558e8c5               // vaddps	%xmm5, %xmm2, %xmm2
+	VMOVSD CPI0_44<>(SB), X5         // vmovsd	.LCPI0_44(%rip), %xmm5
+	LONG   $0xc216fac5               // vmovshdup	%xmm2, %xmm0
+	LONG   $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	WORD   $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE    BB0_8
+	QUAD   $0x00000000953c8d48       // leaq	0(,%rdx,4), %rdi
+
+BB0_23:
+	VMOVSD CPI0_31<>(SB), X7   // vmovsd	.LCPI0_31(%rip), %xmm7
+	VMOVSD CPI0_44<>(SB), X5   // vmovsd	.LCPI0_44(%rip), %xmm5
+	LONG   $0x81048d48         // leaq	(%rcx,%rax,4), %rax
+	WORD   $0x0148; BYTE $0xcf // addq	%rcx, %rdi
+	VMOVSS CPI0_25<>(SB), X6   // vmovss	.LCPI0_25(%rip), %xmm6
+	VMOVSS CPI0_27<>(SB), X8   // vmovss	.LCPI0_27(%rip), %xmm8
+	VMOVSD CPI0_28<>(SB), X15  // vmovsd	.LCPI0_28(%rip), %xmm15
+	VMOVQ  CPI0_29<>(SB), X14  // vmovq	.LCPI0_29(%rip), %xmm14
+	VMOVQ  CPI0_30<>(SB), X13  // vmovq	.LCPI0_30(%rip), %xmm13
+	VMOVSD CPI0_32<>(SB), X12  // vmovsd	.LCPI0_32(%rip), %xmm12
+	VMOVSD CPI0_33<>(SB), X11  // vmovsd	.LCPI0_33(%rip), %xmm11
+	VMOVSD CPI0_34<>(SB), X10  // vmovsd	.LCPI0_34(%rip), %xmm10
+	VMOVSD CPI0_35<>(SB), X9   // vmovsd	.LCPI0_35(%rip), %xmm9
+
+BB0_10:
+	LONG        $0x0810fac5                           // vmovss	(%rax), %xmm1
+	LONG        $0xc628f8c5                           // vmovaps	%xmm6, %xmm0
+	LONG        $0xcc5cf2c5                           // vsubss	%xmm4, %xmm1, %xmm1
+	VCOMISS     CPI0_26<>(SB), X1                     // vcomiss	.LCPI0_26(%rip), %xmm1
+	JA          BB0_9
+	LONG        $0xc12f78c5                           // vcomiss	%xmm1, %xmm8
+	LONG        $0xc057f8c5                           // vxorps	%xmm0, %xmm0, %xmm0
+	JA          BB0_9
+	LONG        $0xc95af2c5                           // vcvtss2sd	%xmm1, %xmm1, %xmm1
+	LONG        $0x5973c1c4; BYTE $0xc7               // vmulsd	%xmm15, %xmm1, %xmm0
+	LONG        $0xd85489c5                           // vandpd	%xmm0, %xmm14, %xmm3
+	LONG        $0xdb5691c5                           // vorpd	%xmm3, %xmm13, %xmm3
+	LONG        $0xdb58fbc5                           // vaddsd	%xmm3, %xmm0, %xmm3
+	LONG        $0x0b61e3c4; WORD $0x03db             // vroundsd	$3, %xmm3, %xmm3, %xmm3
+	LONG        $0xbde1e2c4; BYTE $0xcf               // vfnmadd231sd	%xmm7, %xmm3, %xmm1
+	LONG        $0x2cfb61c4; BYTE $0xc3               // vcvttsd2siq	%xmm3, %r8
+	LONG        $0xffc08149; WORD $0x0003; BYTE $0x00 // addq	$1023, %r8
+	LONG        $0xbde1c2c4; BYTE $0xcc               // vfnmadd231sd	%xmm12, %xmm3, %xmm1
+	LONG        $0x34e0c149                           // salq	$52, %r8
+	LONG        $0x6ef9c1c4; BYTE $0xd8               // vmovq	%r8, %xmm3
+	LONG        $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG        $0x99a9c2c4; BYTE $0xc3               // vfmadd132sd	%xmm11, %xmm10, %xmm0
+	LONG        $0x99b1e2c4; BYTE $0xc1               // vfmadd132sd	%xmm1, %xmm9, %xmm0
+	VFMADD213SD CPI0_36<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_36(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_37<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_37(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_38<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_38(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_39<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_39(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_40<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_40(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_41<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_41(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_42<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_42(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_43<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_43(%rip), %xmm1, %xmm0
+	LONG        $0x99d1e2c4; BYTE $0xc1               // vfmadd132sd	%xmm1, %xmm5, %xmm0
+	LONG        $0x99d1e2c4; BYTE $0xc1               // vfmadd132sd	%xmm1, %xmm5, %xmm0
+	LONG        $0xc359fbc5                           // vmulsd	%xmm3, %xmm0, %xmm0
+	LONG        $0xc05afbc5                           // vcvtsd2ss	%xmm0, %xmm0, %xmm0
+
+BB0_9:
+	LONG $0x04c08348         // addq	$4, %rax
+	LONG $0xd058eac5         // vaddss	%xmm0, %xmm2, %xmm2
+	WORD $0x3948; BYTE $0xf8 // cmpq	%rdi, %rax
+	JNE  BB0_10
+
+BB0_8:
+	LONG    $0xf25aeac5                           // vcvtss2sd	%xmm2, %xmm2, %xmm6
+	LONG    $0x7ef9e1c4; BYTE $0xf0               // vmovq	%xmm6, %rax
+	LONG    $0xc957f0c5                           // vxorps	%xmm1, %xmm1, %xmm1
+	WORD    $0x8948; BYTE $0xc7                   // movq	%rax, %rdi
+	LONG    $0x34efc148                           // shrq	$52, %rdi
+	LONG    $0x07ffe781; WORD $0x0000             // andl	$2047, %edi
+	LONG    $0xffef8148; WORD $0x0003; BYTE $0x00 // subq	$1023, %rdi
+	LONG    $0x2af3e1c4; BYTE $0xcf               // vcvtsi2sdq	%rdi, %xmm1, %xmm1
+	QUAD    $0xffffffffffffbf48; WORD $0x000f     // movabsq	$4503599627370495, %rdi
+	WORD    $0x2148; BYTE $0xf8                   // andq	%rdi, %rax
+	QUAD    $0x000000000000bf48; WORD $0x3ff0     // movabsq	$4607182418800017408, %rdi
+	WORD    $0x0948; BYTE $0xf8                   // orq	%rdi, %rax
+	LONG    $0x6ef9e1c4; BYTE $0xc0               // vmovq	%rax, %xmm0
+	VCOMISD CPI0_45<>(SB), X0                     // vcomisd	.LCPI0_45(%rip), %xmm0
+	JA      BB0_62
+
+BB0_12:
+	LONG        $0xdd5cfbc5             // vsubsd	%xmm5, %xmm0, %xmm3
+	LONG        $0xc558fbc5             // vaddsd	%xmm5, %xmm0, %xmm0
+	VMOVSD      CPI0_46<>(SB), X2       // vmovsd	.LCPI0_46(%rip), %xmm2
+	LONG        $0xff59f3c5             // vmulsd	%xmm7, %xmm1, %xmm7
+	LONG        $0xd85ee3c5             // vdivsd	%xmm0, %xmm3, %xmm3
+	LONG        $0xc359e3c5             // vmulsd	%xmm3, %xmm3, %xmm0
+	LONG        $0xdb58e3c5             // vaddsd	%xmm3, %xmm3, %xmm3
+	VFMADD213SD CPI0_47<>(SB), X0, X2   // vfmadd213sd	.LCPI0_47(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_48<>(SB), X0, X2   // vfmadd213sd	.LCPI0_48(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_49<>(SB), X0, X2   // vfmadd213sd	.LCPI0_49(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_50<>(SB), X0, X2   // vfmadd213sd	.LCPI0_50(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_51<>(SB), X0, X2   // vfmadd213sd	.LCPI0_51(%rip), %xmm0, %xmm2
+	LONG        $0x99d1e2c4; BYTE $0xc2 // vfmadd132sd	%xmm2, %xmm5, %xmm0
+	LONG        $0x99c1e2c4; BYTE $0xc3 // vfmadd132sd	%xmm3, %xmm7, %xmm0
+	VFMADD132SD CPI0_52<>(SB), X0, X1   // vfmadd132sd	.LCPI0_52(%rip), %xmm0, %xmm1
+	LONG        $0xc95af3c5             // vcvtsd2ss	%xmm1, %xmm1, %xmm1
+	LONG        $0xcc58f2c5             // vaddss	%xmm4, %xmm1, %xmm1
+	LONG        $0x187de2c4; BYTE $0xd1 // vbroadcastss	%xmm1, %ymm2
+	LONG        $0x07fa8348             // cmpq	$7, %rdx
+	JLE         BB0_28
+	LONG        $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_14:
+	LONG $0x7410fcc5; WORD $0xe081 // vmovups	-32(%rcx,%rax,4), %ymm6
+	LONG $0xc25cccc5               // vsubps	%ymm2, %ymm6, %ymm0
+	LONG $0x4411fcc5; WORD $0xe086 // vmovups	%ymm0, -32(%rsi,%rax,4)
+	LONG $0x08c08348               // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JLE  BB0_14
+	LONG $0xf8428d48               // leaq	-8(%rdx), %rax
+	LONG $0x03e8c148               // shrq	$3, %rax
+	QUAD $0x00000008c5048d48       // leaq	8(,%rax,8), %rax
+
+BB0_13:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_55
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	WORD $0x8949; BYTE $0xc4     // movq	%rax, %r12
+	QUAD $0x00000000853c8d48     // leaq	0(,%rax,4), %rdi
+	WORD $0x2949; BYTE $0xc0     // subq	%rax, %r8
+	LONG $0xff488d4d             // leaq	-1(%r8), %r9
+	LONG $0x02f98349             // cmpq	$2, %r9
+	JBE  BB0_16
+	QUAD $0x00000000853c8d48     // leaq	0(,%rax,4), %rdi
+	LONG $0x3e148d4c             // leaq	(%rsi,%rdi), %r10
+	LONG $0x395c8d48; BYTE $0x04 // leaq	4(%rcx,%rdi), %rbx
+	WORD $0x894d; BYTE $0xd3     // movq	%r10, %r11
+	WORD $0x2949; BYTE $0xdb     // subq	%rbx, %r11
+	LONG $0x18fb8349             // cmpq	$24, %r11
+	JA   BB0_63
+
+BB0_16:
+	LONG $0x0410fac5; BYTE $0x81   // vmovss	(%rcx,%rax,4), %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x0411fac5; BYTE $0x86   // vmovss	%xmm0, (%rsi,%rax,4)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_55
+	LONG $0x4410fac5; WORD $0x0439 // vmovss	4(%rcx,%rdi), %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x043e // vmovss	%xmm0, 4(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_55
+	LONG $0x4410fac5; WORD $0x0839 // vmovss	8(%rcx,%rdi), %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x083e // vmovss	%xmm0, 8(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_55
+	LONG $0x4410fac5; WORD $0x0c39 // vmovss	12(%rcx,%rdi), %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x0c3e // vmovss	%xmm0, 12(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_55
+	LONG $0x4410fac5; WORD $0x1039 // vmovss	16(%rcx,%rdi), %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x103e // vmovss	%xmm0, 16(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_55
+	LONG $0x4410fac5; WORD $0x1439 // vmovss	20(%rcx,%rdi), %xmm0
+	LONG $0x06408d4c               // leaq	6(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x143e // vmovss	%xmm0, 20(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_55
+	LONG $0x4410fac5; WORD $0x1839 // vmovss	24(%rcx,%rdi), %xmm0
+	LONG $0x07c08348               // addq	$7, %rax
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x183e // vmovss	%xmm0, 24(%rsi,%rdi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_55
+	LONG $0x4410fac5; WORD $0x1c39 // vmovss	28(%rcx,%rdi), %xmm0
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x1c3e // vmovss	%xmm0, 28(%rsi,%rdi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	LONG $0xd0658d48               // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_62:
+	VMULSD CPI0_43<>(SB), X0, X0 // vmulsd	.LCPI0_43(%rip), %xmm0, %xmm0
+	LONG   $0xcd58f3c5           // vaddsd	%xmm5, %xmm1, %xmm1
+	JMP    BB0_12
+
+BB0_63:
+	LONG $0x06f98349             // cmpq	$6, %r9
+	JBE  BB0_29
+	LONG $0x0410fcc5; BYTE $0x39 // vmovups	(%rcx,%rdi), %ymm0
+	WORD $0x894c; BYTE $0xc7     // movq	%r8, %rdi
+	LONG $0xf8e78348             // andq	$-8, %rdi
+	LONG $0xc25cfcc5             // vsubps	%ymm2, %ymm0, %ymm0
+	WORD $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	LONG $0x117cc1c4; BYTE $0x02 // vmovups	%ymm0, (%r10)
+	LONG $0x07c0f641             // testb	$7, %r8b
+	JE   BB0_55
+	WORD $0x2949; BYTE $0xf8     // subq	%rdi, %r8
+	LONG $0xff488d4d             // leaq	-1(%r8), %r9
+	LONG $0x02f98349             // cmpq	$2, %r9
+	JBE  BB0_20
+
+BB0_17:
+	WORD $0x014c; BYTE $0xe7     // addq	%r12, %rdi
+	LONG $0xc1c6f0c5; BYTE $0x00 // vshufps	$0, %xmm1, %xmm1, %xmm0
+	LONG $0x2410f8c5; BYTE $0xb9 // vmovups	(%rcx,%rdi,4), %xmm4
+	LONG $0xc05cd8c5             // vsubps	%xmm0, %xmm4, %xmm0
+	LONG $0x0411f8c5; BYTE $0xbe // vmovups	%xmm0, (%rsi,%rdi,4)
+	WORD $0x894c; BYTE $0xc7     // movq	%r8, %rdi
+	LONG $0xfce78348             // andq	$-4, %rdi
+	WORD $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	LONG $0x03e08341             // andl	$3, %r8d
+	JE   BB0_55
+
+BB0_20:
+	LONG $0x0410fac5; BYTE $0x81   // vmovss	(%rcx,%rax,4), %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x00000000853c8d48       // leaq	0(,%rax,4), %rdi
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x0411fac5; BYTE $0x86   // vmovss	%xmm0, (%rsi,%rax,4)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_55
+	LONG $0x4410fac5; WORD $0x0439 // vmovss	4(%rcx,%rdi), %xmm0
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x043e // vmovss	%xmm0, 4(%rsi,%rdi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_55
+	LONG $0x4410fac5; WORD $0x0839 // vmovss	8(%rcx,%rdi), %xmm0
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x083e // vmovss	%xmm0, 8(%rsi,%rdi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	LONG $0xd0658d48               // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_55:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	LONG $0xd0658d48         // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_58:
+	RET
+
+BB0_24:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xed57d0c5 // vxorps	%xmm5, %xmm5, %xmm5
+	JMP  BB0_3
+
+BB0_28:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_13
+
+BB0_29:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_17
+
+BB0_6:
+	LONG $0xd257e8c5 // vxorps	%xmm2, %xmm2, %xmm2
+	WORD $0xc031     // xorl	%eax, %eax
+	JMP  BB0_23
@@ -0,0 +1,786 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baselogsoftmax_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x7f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_11<>+0(SB)/4, $0xb95e8083
+GLOBL CPI0_11<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_13<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_13<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_15<>+0(SB)/4, $0x3c088889
+GLOBL CPI0_15<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_17<>+0(SB)/4, $0x3d2aaaab
+GLOBL CPI0_17<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_19<>+0(SB)/4, $0x3e2aaaab
+GLOBL CPI0_19<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_21<>+0(SB)/4, $0x3f000000
+GLOBL CPI0_21<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_23<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_23<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_27<>+0(SB)/4, $0x652b82fe
+DATA CPI0_27<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_27<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_3<>+0(SB)/4, $0x42b17218
+GLOBL CPI0_3<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_33<>+0(SB)/4, $0xfee00000
+DATA CPI0_33<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_33<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_35<>+0(SB)/4, $0x35793c6c
+DATA CPI0_35<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_35<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_37<>+0(SB)/4, $0xeff8d898
+DATA CPI0_37<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_37<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_39<>+0(SB)/4, $0x67f544e4
+DATA CPI0_39<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_39<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_41<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_41<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_41<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_43<>+0(SB)/4, $0xa556c734
+DATA CPI0_43<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_43<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_45<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_45<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_45<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_47<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_47<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_47<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_49<>+0(SB)/4, $0x16c16c17
+DATA CPI0_49<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_49<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_5<>+0(SB)/4, $0xc2aeac50
+GLOBL CPI0_5<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_51<>+0(SB)/4, $0x11111111
+DATA CPI0_51<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_51<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_53<>+0(SB)/4, $0x55555555
+DATA CPI0_53<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_53<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_55<>+0(SB)/4, $0x55555555
+DATA CPI0_55<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_55<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_57<>+0(SB)/4, $0x00000000
+DATA CPI0_57<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_57<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_59<>+0(SB)/4, $0x00000000
+DATA CPI0_59<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_59<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_62<>+0(SB)/4, $0x44314000
+GLOBL CPI0_62<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_64<>+0(SB)/4, $0xc4314000
+GLOBL CPI0_64<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_7<>+0(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_7<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_86<>+0(SB)/4, $0x00000000
+DATA CPI0_86<>+4(SB)/4, $0x80000000
+DATA CPI0_86<>+8(SB)/4, $0x00000000
+DATA CPI0_86<>+12(SB)/4, $0x00000000
+GLOBL CPI0_86<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_87<>+0(SB)/4, $0xffffffff
+DATA CPI0_87<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_87<>+8(SB)/4, $0x00000000
+DATA CPI0_87<>+12(SB)/4, $0x00000000
+GLOBL CPI0_87<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_88<>+0(SB)/4, $0x667f3bcd
+DATA CPI0_88<>+4(SB)/4, $0x3ff6a09e
+GLOBL CPI0_88<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_89<>+0(SB)/4, $0xd078c69f
+DATA CPI0_89<>+4(SB)/4, $0x3fb39a09
+GLOBL CPI0_89<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_9<>+0(SB)/4, $0x3f318000
+GLOBL CPI0_9<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_90<>+0(SB)/4, $0x96cb03de
+DATA CPI0_90<>+4(SB)/4, $0x3fb74664
+GLOBL CPI0_90<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_91<>+0(SB)/4, $0x1d8e78af
+DATA CPI0_91<>+4(SB)/4, $0x3fbc71c5
+GLOBL CPI0_91<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_92<>+0(SB)/4, $0x94229359
+DATA CPI0_92<>+4(SB)/4, $0x3fc24924
+GLOBL CPI0_92<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_93<>+0(SB)/4, $0x9997fa04
+DATA CPI0_93<>+4(SB)/4, $0x3fc99999
+GLOBL CPI0_93<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_94<>+0(SB)/4, $0x55555593
+DATA CPI0_94<>+4(SB)/4, $0x3fd55555
+GLOBL CPI0_94<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_95<>+0(SB)/4, $0x35793c76
+DATA CPI0_95<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_95<>(SB), (RODATA|NOPTR), $8
+
+TEXT ·logsoftmax_c_f32_avx512(SB), $0-24
+	MOVQ input+0(FP), DI
+	MOVQ output+8(FP), SI
+	MOVQ plen_input+16(FP), DX
+	WORD $0x8b48; BYTE $0x12 // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2 // testq	%rdx, %rdx
+	JE   BB0_84
+	LONG $0x0f10fac5         // vmovss	(%rdi), %xmm1
+	WORD $0x8948; BYTE $0xf9 // movq	%rdi, %rcx
+	LONG $0x01fa8348         // cmpq	$1, %rdx
+	JLE  BB0_32
+	LONG $0x04478d48         // leaq	4(%rdi), %rax
+	LONG $0x97048d4c         // leaq	(%rdi,%rdx,4), %r8
+
+BB0_5:
+	LONG         $0x0010fac5               // vmovss	(%rax), %xmm0
+	LONG         $0x04c08348               // addq	$4, %rax
+	LONG         $0xc95ffac5               // vmaxss	%xmm1, %xmm0, %xmm1
+	WORD         $0x3949; BYTE $0xc0       // cmpq	%rax, %r8
+	JNE          BB0_5
+	LONG         $0x487d7262; WORD $0xc118 // vbroadcastss	%xmm1, %zmm8
+	LONG         $0x0ffa8348               // cmpq	$15, %rdx
+	JLE          BB0_32
+	LONG         $0xf0428d48               // leaq	-16(%rdx), %rax
+	LONG         $0xed57d0c5               // vxorps	%xmm5, %xmm5, %xmm5
+	LONG         $0x007fb941; WORD $0x0000 // movl	$127, %r9d
+	VBROADCASTSS CPI0_3<>(SB), Z19         // vbroadcastss	.LCPI0_3(%rip), %zmm19
+	LONG         $0x04e8c148               // shrq	$4, %rax
+	LONG         $0x487dd262; WORD $0xf97c // vpbroadcastd	%r9d, %zmm7
+	VBROADCASTSS CPI0_5<>(SB), Z18         // vbroadcastss	.LCPI0_5(%rip), %zmm18
+	VBROADCASTSS CPI0_7<>(SB), Z17         // vbroadcastss	.LCPI0_7(%rip), %zmm17
+	WORD         $0x8949; BYTE $0xc0       // movq	%rax, %r8
+	LONG         $0x487c7162; WORD $0xcd28 // vmovaps	%zmm5, %zmm9
+	VBROADCASTSS CPI0_9<>(SB), Z16         // vbroadcastss	.LCPI0_9(%rip), %zmm16
+	VBROADCASTSS CPI0_11<>(SB), Z15        // vbroadcastss	.LCPI0_11(%rip), %zmm15
+	VBROADCASTSS CPI0_13<>(SB), Z14        // vbroadcastss	.LCPI0_13(%rip), %zmm14
+	LONG         $0x06e0c149               // salq	$6, %r8
+	VBROADCASTSS CPI0_15<>(SB), Z13        // vbroadcastss	.LCPI0_15(%rip), %zmm13
+	VBROADCASTSS CPI0_17<>(SB), Z12        // vbroadcastss	.LCPI0_17(%rip), %zmm12
+	LONG         $0x01448d4e; BYTE $0x40   // leaq	64(%rcx,%r8), %r8
+	VBROADCASTSS CPI0_19<>(SB), Z11        // vbroadcastss	.LCPI0_19(%rip), %zmm11
+	VBROADCASTSS CPI0_21<>(SB), Z10        // vbroadcastss	.LCPI0_21(%rip), %zmm10
+	VBROADCASTSS CPI0_23<>(SB), Z6         // vbroadcastss	.LCPI0_23(%rip), %zmm6
+	VBROADCASTSS CPI0_0<>(SB), Z3          // vbroadcastss	.LCPI0_0(%rip), %zmm3
+
+BB0_6:
+	LONG $0x487cf162; WORD $0x2710             // vmovups	(%rdi), %zmm4
+	LONG $0x487cd162; WORD $0xc628             // vmovaps	%zmm14, %zmm0
+	LONG $0x40c78348                           // addq	$64, %rdi
+	LONG $0x485cd162; WORD $0xd05c             // vsubps	%zmm8, %zmm4, %zmm2
+	LONG $0x486cb162; WORD $0xe159             // vmulps	%zmm17, %zmm2, %zmm4
+	LONG $0x486cb162; WORD $0xd3c2; BYTE $0x1e // vcmpps	$30, %zmm19, %zmm2, %k2
+	LONG $0x486cb162; WORD $0xcac2; BYTE $0x11 // vcmpps	$17, %zmm18, %zmm2, %k1
+	LONG $0x487df362; WORD $0xe408; BYTE $0x08 // vrndscaleps	$8, %zmm4, %zmm4
+	LONG $0x485db262; WORD $0xd0bc             // vfnmadd231ps	%zmm16, %zmm4, %zmm2
+	LONG $0x485dd262; WORD $0xd7bc             // vfnmadd231ps	%zmm15, %zmm4, %zmm2
+	LONG $0x487df162; WORD $0xe45b             // vcvtps2dq	%zmm4, %zmm4
+	LONG $0x485df162; WORD $0xe7fe             // vpaddd	%zmm7, %zmm4, %zmm4
+	LONG $0x485df162; WORD $0xf472; BYTE $0x17 // vpslld	$23, %zmm4, %zmm4
+	LONG $0x4815f262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm13, %zmm0
+	LONG $0x481df262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm12, %zmm0
+	LONG $0x4825f262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm11, %zmm0
+	LONG $0x482df262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm10, %zmm0
+	LONG $0x484df262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm6, %zmm0
+	LONG $0x484df262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm6, %zmm0
+	LONG $0x487cf162; WORD $0xc459             // vmulps	%zmm4, %zmm0, %zmm0
+	LONG $0x4a7cf162; WORD $0xc328             // vmovaps	%zmm3, %zmm0{%k2}
+	LONG $0x497cd162; WORD $0xc128             // vmovaps	%zmm9, %zmm0{%k1}
+	LONG $0x4854f162; WORD $0xe858             // vaddps	%zmm0, %zmm5, %zmm5
+	WORD $0x394c; BYTE $0xc7                   // cmpq	%r8, %rdi
+	JNE  BB0_6
+	LONG $0x01c08348                           // addq	$1, %rax
+	LONG $0x04e0c148                           // salq	$4, %rax
+
+BB0_3:
+	LONG         $0x48fdf362; WORD $0xe81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm0
+	LONG         $0xc558fcc5                           // vaddps	%ymm5, %ymm0, %ymm0
+	LONG         $0x197de3c4; WORD $0x01c2             // vextractf128	$0x1, %ymm0, %xmm2
+	LONG         $0xd058e8c5                           // vaddps	%xmm0, %xmm2, %xmm2
+	LONG         $0x0479e3c4; WORD $0x4ec2             // vpermilps	$78, %xmm2, %xmm0
+	LONG         $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG         $0x087c6162; WORD $0xd028             // vmovaps	%xmm0, %xmm26
+	LONG         $0xc0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm0
+	LONG         $0x002e6162; WORD $0xd058             // vaddss	%xmm0, %xmm26, %xmm26
+	WORD         $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE          BB0_87
+	WORD         $0x8949; BYTE $0xd0                   // movq	%rdx, %r8
+	WORD         $0x8949; BYTE $0xc2                   // movq	%rax, %r10
+	WORD         $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG         $0xff788d49                           // leaq	-1(%r8), %rdi
+	LONG         $0x0eff8348                           // cmpq	$14, %rdi
+	JBE          BB0_33
+	WORD         $0x894d; BYTE $0xc1                   // movq	%r8, %r9
+	LONG         $0x813c8d48                           // leaq	(%rcx,%rax,4), %rdi
+	LONG         $0x03ffbb41; WORD $0x0000             // movl	$1023, %r11d
+	VBROADCASTSS CPI0_0<>(SB), Z3                      // vbroadcastss	.LCPI0_0(%rip), %zmm3
+	LONG         $0x04e9c149                           // shrq	$4, %r9
+	LONG         $0x487de262; WORD $0xf918             // vbroadcastss	%xmm1, %zmm23
+	VBROADCASTSD CPI0_27<>(SB), Z21                    // vbroadcastsd	.LCPI0_27(%rip), %zmm21
+	VBROADCASTSD CPI0_87<>(SB), Z20                    // vbroadcastsd	.LCPI0_87(%rip), %zmm20
+	LONG         $0x06e1c149                           // salq	$6, %r9
+	LONG         $0x48fdd262; WORD $0xe37c             // vpbroadcastq	%r11, %zmm4
+	VBROADCASTSD CPI0_86<>(SB), Z19                    // vbroadcastsd	.LCPI0_86(%rip), %zmm19
+	VBROADCASTSD CPI0_33<>(SB), Z18                    // vbroadcastsd	.LCPI0_33(%rip), %zmm18
+	VBROADCASTSD CPI0_35<>(SB), Z17                    // vbroadcastsd	.LCPI0_35(%rip), %zmm17
+	WORD         $0x0149; BYTE $0xf9                   // addq	%rdi, %r9
+	VBROADCASTSD CPI0_37<>(SB), Z16                    // vbroadcastsd	.LCPI0_37(%rip), %zmm16
+	VBROADCASTSD CPI0_39<>(SB), Z15                    // vbroadcastsd	.LCPI0_39(%rip), %zmm15
+	VBROADCASTSD CPI0_41<>(SB), Z14                    // vbroadcastsd	.LCPI0_41(%rip), %zmm14
+	VBROADCASTSD CPI0_43<>(SB), Z13                    // vbroadcastsd	.LCPI0_43(%rip), %zmm13
+	VBROADCASTSD CPI0_45<>(SB), Z12                    // vbroadcastsd	.LCPI0_45(%rip), %zmm12
+	VBROADCASTSD CPI0_47<>(SB), Z11                    // vbroadcastsd	.LCPI0_47(%rip), %zmm11
+	VBROADCASTSD CPI0_49<>(SB), Z10                    // vbroadcastsd	.LCPI0_49(%rip), %zmm10
+	VBROADCASTSD CPI0_51<>(SB), Z9                     // vbroadcastsd	.LCPI0_51(%rip), %zmm9
+	VBROADCASTSD CPI0_53<>(SB), Z8                     // vbroadcastsd	.LCPI0_53(%rip), %zmm8
+	VBROADCASTSD CPI0_55<>(SB), Z7                     // vbroadcastsd	.LCPI0_55(%rip), %zmm7
+	VBROADCASTSD CPI0_57<>(SB), Z6                     // vbroadcastsd	.LCPI0_57(%rip), %zmm6
+	VBROADCASTSD CPI0_59<>(SB), Z2                     // vbroadcastsd	.LCPI0_59(%rip), %zmm2
+	VBROADCASTSS CPI0_62<>(SB), Z5                     // vbroadcastss	.LCPI0_62(%rip), %zmm5
+	VBROADCASTSS CPI0_64<>(SB), Z22                    // vbroadcastss	.LCPI0_64(%rip), %zmm22
+
+BB0_9:
+	LONG $0x487cf162; WORD $0x0710             // vmovups	(%rdi), %zmm0
+	LONG $0x40c78348                           // addq	$64, %rdi
+	LONG $0x487c2162; WORD $0xf75c             // vsubps	%zmm23, %zmm0, %zmm30
+	LONG $0x48fdb162; WORD $0xc428             // vmovapd	%zmm20, %zmm0
+	LONG $0x487c0162; WORD $0xe65a             // vcvtps2pd	%ymm30, %zmm28
+	LONG $0x409d2162; WORD $0xcd59             // vmulpd	%zmm21, %zmm28, %zmm25
+	LONG $0x487d0362; WORD $0xf31b; BYTE $0x01 // vextractf32x8	$0x1, %zmm30, %ymm27
+	LONG $0x487c0162; WORD $0xdb5a             // vcvtps2pd	%ymm27, %zmm27
+	LONG $0x40a52162; WORD $0xed59             // vmulpd	%zmm21, %zmm27, %zmm29
+	LONG $0x400cb162; WORD $0xcec2; BYTE $0x05 // vcmpps	$5, %zmm22, %zmm30, %k1
+	LONG $0x48549162; WORD $0xd6c2; BYTE $0x01 // vcmpps	$1, %zmm30, %zmm5, %k2
+	LONG $0x410cf162; WORD $0xcdc2; BYTE $0x0a // vcmpps	$10, %zmm5, %zmm30, %k1{%k1}
+	LONG $0x40b5b362; WORD $0xc325; BYTE $0xf8 // vpternlogq	$248, %zmm19, %zmm25, %zmm0
+	LONG $0x40b56162; WORD $0xc858             // vaddpd	%zmm0, %zmm25, %zmm25
+	LONG $0x48fdb162; WORD $0xc428             // vmovapd	%zmm20, %zmm0
+	LONG $0x4095b362; WORD $0xc325; BYTE $0xf8 // vpternlogq	$248, %zmm19, %zmm29, %zmm0
+	LONG $0x40956162; WORD $0xe858             // vaddpd	%zmm0, %zmm29, %zmm29
+	LONG $0x48fd0362; WORD $0xc909; BYTE $0x03 // vrndscalepd	$3, %zmm25, %zmm25
+	LONG $0x48fd0362; WORD $0xed09; BYTE $0x03 // vrndscalepd	$3, %zmm29, %zmm29
+	LONG $0x40b52262; WORD $0xe2bc             // vfnmadd231pd	%zmm18, %zmm25, %zmm28
+	LONG $0x40952262; WORD $0xdabc             // vfnmadd231pd	%zmm18, %zmm29, %zmm27
+	LONG $0x40b52262; WORD $0xe1bc             // vfnmadd231pd	%zmm17, %zmm25, %zmm28
+	LONG $0x48fd0162; WORD $0xc97a             // vcvttpd2qq	%zmm25, %zmm25
+	LONG $0x40b56162; WORD $0xccd4             // vpaddq	%zmm4, %zmm25, %zmm25
+	LONG $0x40b59162; WORD $0xf173; BYTE $0x34 // vpsllq	$52, %zmm25, %zmm25
+	LONG $0x40952262; WORD $0xd9bc             // vfnmadd231pd	%zmm17, %zmm29, %zmm27
+	LONG $0x48fd0162; WORD $0xed7a             // vcvttpd2qq	%zmm29, %zmm29
+	LONG $0x40956162; WORD $0xecd4             // vpaddq	%zmm4, %zmm29, %zmm29
+	LONG $0x40959162; WORD $0xf573; BYTE $0x34 // vpsllq	$52, %zmm29, %zmm29
+	LONG $0x48fd0162; WORD $0xc428             // vmovapd	%zmm28, %zmm24
+	LONG $0x48852262; WORD $0xc098             // vfmadd132pd	%zmm16, %zmm15, %zmm24
+	LONG $0x48fd9162; WORD $0xc328             // vmovapd	%zmm27, %zmm0
+	LONG $0x4885b262; WORD $0xc098             // vfmadd132pd	%zmm16, %zmm15, %zmm0
+	LONG $0x488d0262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm14, %zmm24
+	LONG $0x488d9262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm14, %zmm0
+	LONG $0x48950262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm13, %zmm24
+	LONG $0x48959262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm13, %zmm0
+	LONG $0x489d0262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm12, %zmm24
+	LONG $0x489d9262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm12, %zmm0
+	LONG $0x48a50262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm11, %zmm24
+	LONG $0x48a59262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm11, %zmm0
+	LONG $0x48ad0262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm10, %zmm24
+	LONG $0x48ad9262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm10, %zmm0
+	LONG $0x48b50262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm9, %zmm24
+	LONG $0x48b59262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm9, %zmm0
+	LONG $0x48bd0262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm8, %zmm24
+	LONG $0x48bd9262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm8, %zmm0
+	LONG $0x48c50262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm7, %zmm24
+	LONG $0x48c59262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm7, %zmm0
+	LONG $0x48cd0262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm6, %zmm24
+	LONG $0x48cd9262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm6, %zmm0
+	LONG $0x48ed0262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm2, %zmm24
+	LONG $0x48ed9262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm2, %zmm0
+	LONG $0x48ed0262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm2, %zmm24
+	LONG $0x48ed9262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm2, %zmm0
+	LONG $0x40bd0162; WORD $0xc959             // vmulpd	%zmm25, %zmm24, %zmm25
+	LONG $0xca7c6162; WORD $0xc328             // vmovaps	%zmm3, %zmm24{%k2}{z}
+	LONG $0x48fd9162; WORD $0xc559             // vmulpd	%zmm29, %zmm0, %zmm0
+	LONG $0x48fd0162; WORD $0xc95a             // vcvtpd2ps	%zmm25, %ymm25
+	LONG $0x48fdf162; WORD $0xc05a             // vcvtpd2ps	%zmm0, %ymm0
+	LONG $0x40356362; WORD $0xc81a; BYTE $0x01 // vinsertf32x8	$0x1, %ymm0, %zmm25, %zmm25
+	LONG $0x497c0162; WORD $0xc128             // vmovaps	%zmm25, %zmm24{%k1}
+	LONG $0x203d0362; WORD $0xc803; BYTE $0x07 // valignd	$7, %ymm24, %ymm24, %ymm25
+	LONG $0x002e9162; WORD $0xc058             // vaddss	%xmm24, %xmm26, %xmm0
+	LONG $0x003c0162; WORD $0xd0c6; BYTE $0x55 // vshufps	$85, %xmm24, %xmm24, %xmm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x003c0162; WORD $0xd015             // vunpckhps	%xmm24, %xmm24, %xmm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x003c0162; WORD $0xd0c6; BYTE $0xff // vshufps	$255, %xmm24, %xmm24, %xmm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x287d0362; WORD $0xc219; BYTE $0x01 // vextractf32x4	$1, %ymm24, %xmm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x203d0362; WORD $0xd003; BYTE $0x05 // valignd	$5, %ymm24, %ymm24, %ymm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x203d0362; WORD $0xd003; BYTE $0x06 // valignd	$6, %ymm24, %ymm24, %ymm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x487d0362; WORD $0xc21b; BYTE $0x01 // vextractf32x8	$0x1, %zmm24, %ymm26
+	LONG $0x002c0162; WORD $0xc2c6; BYTE $0xff // vshufps	$255, %xmm26, %xmm26, %xmm24
+	LONG $0x087e9162; WORD $0xc158             // vaddss	%xmm25, %xmm0, %xmm0
+	LONG $0x002c0162; WORD $0xcac6; BYTE $0x55 // vshufps	$85, %xmm26, %xmm26, %xmm25
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x087e9162; WORD $0xc158             // vaddss	%xmm25, %xmm0, %xmm0
+	LONG $0x002c0162; WORD $0xca15             // vunpckhps	%xmm26, %xmm26, %xmm25
+	LONG $0x087e9162; WORD $0xc158             // vaddss	%xmm25, %xmm0, %xmm0
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x287d0362; WORD $0xd019; BYTE $0x01 // vextractf32x4	$1, %ymm26, %xmm24
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x202d0362; WORD $0xc203; BYTE $0x05 // valignd	$5, %ymm26, %ymm26, %ymm24
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x202d0362; WORD $0xc203; BYTE $0x06 // valignd	$6, %ymm26, %ymm26, %ymm24
+	LONG $0x202d0362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm26, %ymm26, %ymm26
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x087e0162; WORD $0xd258             // vaddss	%xmm26, %xmm0, %xmm26
+	WORD $0x394c; BYTE $0xcf                   // cmpq	%r9, %rdi
+	JNE  BB0_9
+	WORD $0x894c; BYTE $0xc7                   // movq	%r8, %rdi
+	LONG $0xf0e78348                           // andq	$-16, %rdi
+	WORD $0x0148; BYTE $0xf8                   // addq	%rdi, %rax
+	LONG $0x0fc0f641                           // testb	$15, %r8b
+	JE   BB0_87
+
+BB0_8:
+	WORD         $0x2949; BYTE $0xf8                   // subq	%rdi, %r8
+	LONG         $0xff488d4d                           // leaq	-1(%r8), %r9
+	LONG         $0x06f98349                           // cmpq	$6, %r9
+	JBE          BB0_12
+	WORD         $0x014c; BYTE $0xd7                   // addq	%r10, %rdi
+	LONG         $0x187de2c4; BYTE $0xc1               // vbroadcastss	%xmm1, %ymm0
+	VBROADCASTSD CPI0_27<>(SB), Y6                     // vbroadcastsd	.LCPI0_27(%rip), %ymm6
+	VBROADCASTSD CPI0_87<>(SB), Y2                     // vbroadcastsd	.LCPI0_87(%rip), %ymm2
+	LONG         $0x2410fcc5; BYTE $0xb9               // vmovups	(%rcx,%rdi,4), %ymm4
+	LONG         $0x0003ffbf; BYTE $0x00               // movl	$1023, %edi
+	VBROADCASTSD CPI0_86<>(SB), Y5                     // vbroadcastsd	.LCPI0_86(%rip), %ymm5
+	LONG         $0xc2287dc5                           // vmovapd	%ymm2, %ymm8
+	LONG         $0xe05cdcc5                           // vsubps	%ymm0, %ymm4, %ymm4
+	LONG         $0xc45afcc5                           // vcvtps2pd	%xmm4, %ymm0
+	LONG         $0xfe59fdc5                           // vmulpd	%ymm6, %ymm0, %ymm7
+	LONG         $0x197de3c4; WORD $0x01e3             // vextractf128	$0x1, %ymm4, %xmm3
+	LONG         $0xdb5afcc5                           // vcvtps2pd	%xmm3, %ymm3
+	LONG         $0xf659e5c5                           // vmulpd	%ymm6, %ymm3, %ymm6
+	LONG         $0x28c57362; WORD $0xc525; BYTE $0xf8 // vpternlogq	$248, %ymm5, %ymm7, %ymm8
+	LONG         $0x28cdf362; WORD $0xd525; BYTE $0xf8 // vpternlogq	$248, %ymm5, %ymm6, %ymm2
+	LONG         $0x5845c1c4; BYTE $0xf8               // vaddpd	%ymm8, %ymm7, %ymm7
+	VBROADCASTSD CPI0_35<>(SB), Y5                     // vbroadcastsd	.LCPI0_35(%rip), %ymm5
+	VBROADCASTSD CPI0_39<>(SB), Y8                     // vbroadcastsd	.LCPI0_39(%rip), %ymm8
+	LONG         $0xf258cdc5                           // vaddpd	%ymm2, %ymm6, %ymm6
+	VBROADCASTSD CPI0_33<>(SB), Y2                     // vbroadcastsd	.LCPI0_33(%rip), %ymm2
+	LONG         $0x28fdf362; WORD $0xff09; BYTE $0x03 // vrndscalepd	$3, %ymm7, %ymm7
+	LONG         $0x28fdf362; WORD $0xf609; BYTE $0x03 // vrndscalepd	$3, %ymm6, %ymm6
+	LONG         $0xbcc5e2c4; BYTE $0xc2               // vfnmadd231pd	%ymm2, %ymm7, %ymm0
+	LONG         $0x9ce5e2c4; BYTE $0xd6               // vfnmadd132pd	%ymm6, %ymm3, %ymm2
+	LONG         $0xbcc5e2c4; BYTE $0xc5               // vfnmadd231pd	%ymm5, %ymm7, %ymm0
+	LONG         $0x28fdf162; WORD $0xff7a             // vcvttpd2qq	%ymm7, %ymm7
+	LONG         $0x9cede2c4; BYTE $0xee               // vfnmadd132pd	%ymm6, %ymm2, %ymm5
+	LONG         $0x28fdf162; WORD $0xf67a             // vcvttpd2qq	%ymm6, %ymm6
+	VBROADCASTSD CPI0_37<>(SB), Y2                     // vbroadcastsd	.LCPI0_37(%rip), %ymm2
+	LONG         $0xd828fdc5                           // vmovapd	%ymm0, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xda               // vfmadd132pd	%ymm2, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xd5               // vfmadd132pd	%ymm5, %ymm8, %ymm2
+	VBROADCASTSD CPI0_41<>(SB), Y8                     // vbroadcastsd	.LCPI0_41(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xd5               // vfmadd132pd	%ymm5, %ymm8, %ymm2
+	VBROADCASTSD CPI0_43<>(SB), Y8                     // vbroadcastsd	.LCPI0_43(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xd5               // vfmadd132pd	%ymm5, %ymm8, %ymm2
+	VBROADCASTSD CPI0_45<>(SB), Y8                     // vbroadcastsd	.LCPI0_45(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xd5               // vfmadd132pd	%ymm5, %ymm8, %ymm2
+	VBROADCASTSD CPI0_47<>(SB), Y8                     // vbroadcastsd	.LCPI0_47(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xd5               // vfmadd132pd	%ymm5, %ymm8, %ymm2
+	VBROADCASTSD CPI0_49<>(SB), Y8                     // vbroadcastsd	.LCPI0_49(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xd5               // vfmadd132pd	%ymm5, %ymm8, %ymm2
+	VBROADCASTSD CPI0_51<>(SB), Y8                     // vbroadcastsd	.LCPI0_51(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xd5               // vfmadd132pd	%ymm5, %ymm8, %ymm2
+	VBROADCASTSD CPI0_53<>(SB), Y8                     // vbroadcastsd	.LCPI0_53(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xd5               // vfmadd132pd	%ymm5, %ymm8, %ymm2
+	VBROADCASTSD CPI0_55<>(SB), Y8                     // vbroadcastsd	.LCPI0_55(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xd5               // vfmadd132pd	%ymm5, %ymm8, %ymm2
+	VBROADCASTSD CPI0_57<>(SB), Y8                     // vbroadcastsd	.LCPI0_57(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xd5               // vfmadd132pd	%ymm5, %ymm8, %ymm2
+	VBROADCASTSD CPI0_59<>(SB), Y8                     // vbroadcastsd	.LCPI0_59(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xd5               // vfmadd132pd	%ymm5, %ymm8, %ymm2
+	LONG         $0x98bde2c4; BYTE $0xc3               // vfmadd132pd	%ymm3, %ymm8, %ymm0
+	LONG         $0x98bde2c4; BYTE $0xea               // vfmadd132pd	%ymm2, %ymm8, %ymm5
+	LONG         $0x28fdf262; WORD $0xd77c             // vpbroadcastq	%rdi, %ymm2
+	VBROADCASTSS CPI0_64<>(SB), Y3                     // vbroadcastss	.LCPI0_64(%rip), %ymm3
+	LONG         $0xfad4c5c5                           // vpaddq	%ymm2, %ymm7, %ymm7
+	LONG         $0xf2d4cdc5                           // vpaddq	%ymm2, %ymm6, %ymm6
+	WORD         $0x894c; BYTE $0xc7                   // movq	%r8, %rdi
+	VBROADCASTSS CPI0_62<>(SB), Y2                     // vbroadcastss	.LCPI0_62(%rip), %ymm2
+	LONG         $0x285cf162; WORD $0xcbc2; BYTE $0x05 // vcmpps	$5, %ymm3, %ymm4, %k1
+	LONG         $0xf773c5c5; BYTE $0x34               // vpsllq	$52, %ymm7, %ymm7
+	LONG         $0xf8e78348                           // andq	$-8, %rdi
+	VBROADCASTSS CPI0_0<>(SB), Y3                      // vbroadcastss	.LCPI0_0(%rip), %ymm3
+	LONG         $0xf673cdc5; BYTE $0x34               // vpsllq	$52, %ymm6, %ymm6
+	WORD         $0x0148; BYTE $0xf8                   // addq	%rdi, %rax
+	LONG         $0x07e08341                           // andl	$7, %r8d
+	LONG         $0xc759fdc5                           // vmulpd	%ymm7, %ymm0, %ymm0
+	LONG         $0x295cf162; WORD $0xcac2; BYTE $0x0a // vcmpps	$10, %ymm2, %ymm4, %k1{%k1}
+	LONG         $0xee59d5c5                           // vmulpd	%ymm6, %ymm5, %ymm5
+	LONG         $0xd4c2ecc5; BYTE $0x01               // vcmpltps	%ymm4, %ymm2, %ymm2
+	LONG         $0xd354ecc5                           // vandps	%ymm3, %ymm2, %ymm2
+	LONG         $0xc05afdc5                           // vcvtpd2psy	%ymm0, %xmm0
+	LONG         $0xed5afdc5                           // vcvtpd2psy	%ymm5, %xmm5
+	LONG         $0x187de3c4; WORD $0x01c5             // vinsertf128	$0x1, %xmm5, %ymm0, %ymm0
+	LONG         $0x297cf162; WORD $0xd028             // vmovaps	%ymm0, %ymm2{%k1}
+	LONG         $0x002ef162; WORD $0xc258             // vaddss	%xmm2, %xmm26, %xmm0
+	LONG         $0xe2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm4
+	LONG         $0xdac6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG         $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG         $0xe215e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm4
+	LONG         $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG         $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG         $0x287df362; WORD $0xd319; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm3
+	LONG         $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG         $0x286df362; WORD $0xda03; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm3
+	LONG         $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG         $0x286df362; WORD $0xda03; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm3
+	LONG         $0x286df362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm2
+	LONG         $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG         $0x087e6162; WORD $0xd258             // vaddss	%xmm2, %xmm0, %xmm26
+	JE           BB0_87
+
+BB0_12:
+	VMOVSD CPI0_33<>(SB), X5  // vmovsd	.LCPI0_33(%rip), %xmm5
+	VMOVSD CPI0_59<>(SB), X3  // vmovsd	.LCPI0_59(%rip), %xmm3
+	VMOVSS CPI0_0<>(SB), X4   // vmovss	.LCPI0_0(%rip), %xmm4
+	VMOVSS CPI0_64<>(SB), X6  // vmovss	.LCPI0_64(%rip), %xmm6
+	VMOVSD CPI0_27<>(SB), X14 // vmovsd	.LCPI0_27(%rip), %xmm14
+	VMOVQ  CPI0_86<>(SB), X13 // vmovq	.LCPI0_86(%rip), %xmm13
+	VMOVQ  CPI0_87<>(SB), X12 // vmovq	.LCPI0_87(%rip), %xmm12
+	VMOVSD CPI0_35<>(SB), X11 // vmovsd	.LCPI0_35(%rip), %xmm11
+	VMOVSD CPI0_37<>(SB), X10 // vmovsd	.LCPI0_37(%rip), %xmm10
+	VMOVSD CPI0_39<>(SB), X9  // vmovsd	.LCPI0_39(%rip), %xmm9
+	VMOVSD CPI0_41<>(SB), X8  // vmovsd	.LCPI0_41(%rip), %xmm8
+	VMOVSD CPI0_43<>(SB), X7  // vmovsd	.LCPI0_43(%rip), %xmm7
+
+BB0_16:
+	LONG        $0x0410fac5; BYTE $0x81               // vmovss	(%rcx,%rax,4), %xmm0
+	LONG        $0xd428f8c5                           // vmovaps	%xmm4, %xmm2
+	LONG        $0xc15cfac5                           // vsubss	%xmm1, %xmm0, %xmm0
+	VCOMISS     CPI0_62<>(SB), X0                     // vcomiss	.LCPI0_62(%rip), %xmm0
+	JA          BB0_17
+	LONG        $0xf02ff8c5                           // vcomiss	%xmm0, %xmm6
+	LONG        $0xd257e8c5                           // vxorps	%xmm2, %xmm2, %xmm2
+	JA          BB0_17
+	LONG        $0xc05afac5                           // vcvtss2sd	%xmm0, %xmm0, %xmm0
+	LONG        $0x597b41c4; BYTE $0xfe               // vmulsd	%xmm14, %xmm0, %xmm15
+	LONG        $0xe22979c5                           // vmovapd	%xmm12, %xmm2
+	LONG        $0x0885d362; WORD $0xd525; BYTE $0xf8 // vpternlogq	$248, %xmm13, %xmm15, %xmm2
+	LONG        $0xfa5803c5                           // vaddsd	%xmm2, %xmm15, %xmm15
+	LONG        $0x08855362; WORD $0xff0b; BYTE $0x03 // vrndscalesd	$3, %xmm15, %xmm15, %xmm15
+	LONG        $0xbd81e2c4; BYTE $0xc5               // vfnmadd231sd	%xmm5, %xmm15, %xmm0
+	LONG        $0x2cfbc1c4; BYTE $0xff               // vcvttsd2siq	%xmm15, %rdi
+	LONG        $0xffc78148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rdi
+	LONG        $0xbd81c2c4; BYTE $0xc3               // vfnmadd231sd	%xmm11, %xmm15, %xmm0
+	LONG        $0x34e7c148                           // salq	$52, %rdi
+	LONG        $0xd010fbc5                           // vmovsd	%xmm0, %xmm0, %xmm2
+	LONG        $0x99b1c2c4; BYTE $0xd2               // vfmadd132sd	%xmm10, %xmm9, %xmm2
+	LONG        $0x99b9e2c4; BYTE $0xd0               // vfmadd132sd	%xmm0, %xmm8, %xmm2
+	LONG        $0x99c1e2c4; BYTE $0xd0               // vfmadd132sd	%xmm0, %xmm7, %xmm2
+	VFMADD213SD CPI0_45<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_45(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_47<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_47(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_49<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_49(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_51<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_51(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_53<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_53(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_55<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_55(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_57<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_57(%rip), %xmm0, %xmm2
+	LONG        $0x99e1e2c4; BYTE $0xd0               // vfmadd132sd	%xmm0, %xmm3, %xmm2
+	LONG        $0x99e1e2c4; BYTE $0xc2               // vfmadd132sd	%xmm2, %xmm3, %xmm0
+	LONG        $0x6ef9e1c4; BYTE $0xd7               // vmovq	%rdi, %xmm2
+	LONG        $0xc259fbc5                           // vmulsd	%xmm2, %xmm0, %xmm0
+	LONG        $0xd05afbc5                           // vcvtsd2ss	%xmm0, %xmm0, %xmm2
+
+BB0_17:
+	LONG $0x01c08348               // addq	$1, %rax
+	LONG $0x002e6162; WORD $0xd258 // vaddss	%xmm2, %xmm26, %xmm26
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JG   BB0_16
+
+BB0_7:
+	LONG    $0x002e9162; WORD $0xfa5a             // vcvtss2sd	%xmm26, %xmm26, %xmm7
+	LONG    $0x7ef9e1c4; BYTE $0xf8               // vmovq	%xmm7, %rax
+	LONG    $0xd257e8c5                           // vxorps	%xmm2, %xmm2, %xmm2
+	WORD    $0x8948; BYTE $0xc7                   // movq	%rax, %rdi
+	LONG    $0x34efc148                           // shrq	$52, %rdi
+	LONG    $0x07ffe781; WORD $0x0000             // andl	$2047, %edi
+	LONG    $0xffef8148; WORD $0x0003; BYTE $0x00 // subq	$1023, %rdi
+	LONG    $0x2aebe1c4; BYTE $0xd7               // vcvtsi2sdq	%rdi, %xmm2, %xmm2
+	QUAD    $0xffffffffffffbf48; WORD $0x000f     // movabsq	$4503599627370495, %rdi
+	WORD    $0x2148; BYTE $0xf8                   // andq	%rdi, %rax
+	QUAD    $0x000000000000bf48; WORD $0x3ff0     // movabsq	$4607182418800017408, %rdi
+	WORD    $0x0948; BYTE $0xf8                   // orq	%rdi, %rax
+	LONG    $0x6ef9e1c4; BYTE $0xc0               // vmovq	%rax, %xmm0
+	VCOMISD CPI0_88<>(SB), X0                     // vcomisd	.LCPI0_88(%rip), %xmm0
+	JA      BB0_89
+
+BB0_19:
+	LONG        $0xf35cfbc5               // vsubsd	%xmm3, %xmm0, %xmm6
+	LONG        $0xc358fbc5               // vaddsd	%xmm3, %xmm0, %xmm0
+	LONG        $0xed59ebc5               // vmulsd	%xmm5, %xmm2, %xmm5
+	VMOVSD      CPI0_89<>(SB), X4         // vmovsd	.LCPI0_89(%rip), %xmm4
+	LONG        $0xf05ecbc5               // vdivsd	%xmm0, %xmm6, %xmm6
+	LONG        $0xc659cbc5               // vmulsd	%xmm6, %xmm6, %xmm0
+	LONG        $0xf658cbc5               // vaddsd	%xmm6, %xmm6, %xmm6
+	VFMADD213SD CPI0_90<>(SB), X0, X4     // vfmadd213sd	.LCPI0_90(%rip), %xmm0, %xmm4
+	VFMADD213SD CPI0_91<>(SB), X0, X4     // vfmadd213sd	.LCPI0_91(%rip), %xmm0, %xmm4
+	VFMADD213SD CPI0_92<>(SB), X0, X4     // vfmadd213sd	.LCPI0_92(%rip), %xmm0, %xmm4
+	VFMADD213SD CPI0_93<>(SB), X0, X4     // vfmadd213sd	.LCPI0_93(%rip), %xmm0, %xmm4
+	VFMADD213SD CPI0_94<>(SB), X0, X4     // vfmadd213sd	.LCPI0_94(%rip), %xmm0, %xmm4
+	LONG        $0x99e1e2c4; BYTE $0xc4   // vfmadd132sd	%xmm4, %xmm3, %xmm0
+	LONG        $0x99d1e2c4; BYTE $0xc6   // vfmadd132sd	%xmm6, %xmm5, %xmm0
+	VFMADD132SD CPI0_95<>(SB), X0, X2     // vfmadd132sd	.LCPI0_95(%rip), %xmm0, %xmm2
+	LONG        $0xd25aebc5               // vcvtsd2ss	%xmm2, %xmm2, %xmm2
+	LONG        $0xc958eac5               // vaddss	%xmm1, %xmm2, %xmm1
+	LONG        $0x487df262; WORD $0xd118 // vbroadcastss	%xmm1, %zmm2
+	LONG        $0x0ffa8348               // cmpq	$15, %rdx
+	JLE         BB0_35
+	LONG        $0x000010b8; BYTE $0x00   // movl	$16, %eax
+
+BB0_21:
+	QUAD $0xff817c10487cf162       // vmovups	-64(%rcx,%rax,4), %zmm7
+	LONG $0x4844f162; WORD $0xc25c // vsubps	%zmm2, %zmm7, %zmm0
+	QUAD $0xff864411487cf162       // vmovups	%zmm0, -64(%rsi,%rax,4)
+	LONG $0x10c08348               // addq	$16, %rax
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JLE  BB0_21
+	LONG $0xf0428d48               // leaq	-16(%rdx), %rax
+	LONG $0xf0e08348               // andq	$-16, %rax
+	LONG $0x10c08348               // addq	$16, %rax
+
+BB0_20:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_58
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	QUAD $0x00000000853c8d48     // leaq	0(,%rax,4), %rdi
+	WORD $0x2949; BYTE $0xc0     // subq	%rax, %r8
+	LONG $0xff508d4d             // leaq	-1(%r8), %r10
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x06fa8349             // cmpq	$6, %r10
+	JBE  BB0_23
+	QUAD $0x00000000853c8d48     // leaq	0(,%rax,4), %rdi
+	LONG $0x3e1c8d4c             // leaq	(%rsi,%rdi), %r11
+	LONG $0x39648d4c; BYTE $0x04 // leaq	4(%rcx,%rdi), %r12
+	WORD $0x894c; BYTE $0xdb     // movq	%r11, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x38fb8348             // cmpq	$56, %rbx
+	JA   BB0_90
+
+BB0_23:
+	LONG $0x0410fac5; BYTE $0x81   // vmovss	(%rcx,%rax,4), %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x0411fac5; BYTE $0x86   // vmovss	%xmm0, (%rsi,%rax,4)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x0439 // vmovss	4(%rcx,%rdi), %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x043e // vmovss	%xmm0, 4(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x0839 // vmovss	8(%rcx,%rdi), %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x083e // vmovss	%xmm0, 8(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x0c39 // vmovss	12(%rcx,%rdi), %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x0c3e // vmovss	%xmm0, 12(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x1039 // vmovss	16(%rcx,%rdi), %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x103e // vmovss	%xmm0, 16(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x1439 // vmovss	20(%rcx,%rdi), %xmm0
+	LONG $0x06408d4c               // leaq	6(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x143e // vmovss	%xmm0, 20(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x1839 // vmovss	24(%rcx,%rdi), %xmm0
+	LONG $0x07408d4c               // leaq	7(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x183e // vmovss	%xmm0, 24(%rsi,%rdi)
+	WORD $0x3949; BYTE $0xd0       // cmpq	%rdx, %r8
+	JGE  BB0_81
+	LONG $0x4410fac5; WORD $0x1c39 // vmovss	28(%rcx,%rdi), %xmm0
+	LONG $0x08408d4c               // leaq	8(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x1c3e // vmovss	%xmm0, 28(%rsi,%rdi)
+	WORD $0x3949; BYTE $0xd0       // cmpq	%rdx, %r8
+	JGE  BB0_81
+	LONG $0x4410fac5; WORD $0x2039 // vmovss	32(%rcx,%rdi), %xmm0
+	LONG $0x09408d4c               // leaq	9(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x203e // vmovss	%xmm0, 32(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x2439 // vmovss	36(%rcx,%rdi), %xmm0
+	LONG $0x0a408d4c               // leaq	10(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x243e // vmovss	%xmm0, 36(%rsi,%rdi)
+	WORD $0x3949; BYTE $0xd0       // cmpq	%rdx, %r8
+	JGE  BB0_81
+	LONG $0x4410fac5; WORD $0x2839 // vmovss	40(%rcx,%rdi), %xmm0
+	LONG $0x0b408d4c               // leaq	11(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x283e // vmovss	%xmm0, 40(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x2c39 // vmovss	44(%rcx,%rdi), %xmm0
+	LONG $0x0c408d4c               // leaq	12(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x2c3e // vmovss	%xmm0, 44(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x3039 // vmovss	48(%rcx,%rdi), %xmm0
+	LONG $0x0d408d4c               // leaq	13(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x303e // vmovss	%xmm0, 48(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x3439 // vmovss	52(%rcx,%rdi), %xmm0
+	LONG $0x0e408d4c               // leaq	14(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x343e // vmovss	%xmm0, 52(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x3839 // vmovss	56(%rcx,%rdi), %xmm0
+	LONG $0x0fc08348               // addq	$15, %rax
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x383e // vmovss	%xmm0, 56(%rsi,%rdi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x3c39 // vmovss	60(%rcx,%rdi), %xmm0
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x3c3e // vmovss	%xmm0, 60(%rsi,%rdi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	JMP  BB0_82
+
+BB0_89:
+	VMULSD CPI0_57<>(SB), X0, X0 // vmulsd	.LCPI0_57(%rip), %xmm0, %xmm0
+	LONG   $0xd358ebc5           // vaddsd	%xmm3, %xmm2, %xmm2
+	JMP    BB0_19
+
+BB0_90:
+	LONG $0x0efa8349                           // cmpq	$14, %r10
+	JBE  BB0_36
+	LONG $0x487cf162; WORD $0x0410; BYTE $0x39 // vmovups	(%rcx,%rdi), %zmm0
+	WORD $0x894c; BYTE $0xc7                   // movq	%r8, %rdi
+	LONG $0xf0e78348                           // andq	$-16, %rdi
+	LONG $0x487cf162; WORD $0xc25c             // vsubps	%zmm2, %zmm0, %zmm0
+	WORD $0x0148; BYTE $0xf8                   // addq	%rdi, %rax
+	LONG $0x487cd162; WORD $0x0311             // vmovups	%zmm0, (%r11)
+	LONG $0x0fc0f641                           // testb	$15, %r8b
+	JE   BB0_81
+	WORD $0x2949; BYTE $0xf8                   // subq	%rdi, %r8
+	LONG $0xff508d4d                           // leaq	-1(%r8), %r10
+	LONG $0x06fa8349                           // cmpq	$6, %r10
+	JBE  BB0_27
+
+BB0_24:
+	WORD $0x014c; BYTE $0xcf     // addq	%r9, %rdi
+	LONG $0x187de2c4; BYTE $0xc1 // vbroadcastss	%xmm1, %ymm0
+	LONG $0x3c10fcc5; BYTE $0xb9 // vmovups	(%rcx,%rdi,4), %ymm7
+	LONG $0xc05cc4c5             // vsubps	%ymm0, %ymm7, %ymm0
+	LONG $0x0411fcc5; BYTE $0xbe // vmovups	%ymm0, (%rsi,%rdi,4)
+	WORD $0x894c; BYTE $0xc7     // movq	%r8, %rdi
+	LONG $0xf8e78348             // andq	$-8, %rdi
+	WORD $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	LONG $0x07e08341             // andl	$7, %r8d
+	JE   BB0_81
+
+BB0_27:
+	LONG $0x0410fac5; BYTE $0x81   // vmovss	(%rcx,%rax,4), %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x00000000853c8d48       // leaq	0(,%rax,4), %rdi
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x0411fac5; BYTE $0x86   // vmovss	%xmm0, (%rsi,%rax,4)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x0439 // vmovss	4(%rcx,%rdi), %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x043e // vmovss	%xmm0, 4(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x0839 // vmovss	8(%rcx,%rdi), %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x083e // vmovss	%xmm0, 8(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x0c39 // vmovss	12(%rcx,%rdi), %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x0c3e // vmovss	%xmm0, 12(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x1039 // vmovss	16(%rcx,%rdi), %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x103e // vmovss	%xmm0, 16(%rsi,%rdi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x1439 // vmovss	20(%rcx,%rdi), %xmm0
+	LONG $0x06c08348               // addq	$6, %rax
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x143e // vmovss	%xmm0, 20(%rsi,%rdi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_81
+	LONG $0x4410fac5; WORD $0x1839 // vmovss	24(%rcx,%rdi), %xmm0
+	LONG $0xc15cfac5               // vsubss	%xmm1, %xmm0, %xmm0
+	LONG $0x4411fac5; WORD $0x183e // vmovss	%xmm0, 24(%rsi,%rdi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_87:
+	VMOVSD CPI0_33<>(SB), X5 // vmovsd	.LCPI0_33(%rip), %xmm5
+	VMOVSD CPI0_59<>(SB), X3 // vmovsd	.LCPI0_59(%rip), %xmm3
+	JMP    BB0_7
+
+BB0_81:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_82:
+	RET
+
+BB0_84:
+	RET
+
+BB0_32:
+	LONG $0xed57d1c5 // vxorpd	%xmm5, %xmm5, %xmm5
+	WORD $0xc031     // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_35:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_20
+
+BB0_58:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_33:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_8
+
+BB0_36:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_24
@@ -0,0 +1,1348 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baseqkvdense_c_f32_avx2_amd64.c
+
+TEXT ·qkvdense_c_f32_avx2(SB), $560-160
+	MOVQ x+0(FP), DI
+	MOVQ wQKV+8(FP), SI
+	MOVQ biasQ+16(FP), DX
+	MOVQ biasK+24(FP), CX
+	MOVQ biasV+32(FP), R8
+	MOVQ q+40(FP), R9
+	MOVQ k+48(FP), R11
+	MOVQ R11, 448(SP)
+	MOVQ v+56(FP), R11
+	MOVQ R11, 456(SP)
+	MOVQ pbatchSize+64(FP), R11
+	MOVQ R11, 464(SP)
+	MOVQ pinFeatures+72(FP), R11
+	MOVQ R11, 472(SP)
+	MOVQ pqDim+80(FP), R11
+	MOVQ R11, 480(SP)
+	MOVQ pkvDim+88(FP), R11
+	MOVQ R11, 488(SP)
+	MOVQ plen_x+96(FP), R11
+	MOVQ R11, 496(SP)
+	MOVQ plen_wQKV+104(FP), R11
+	MOVQ R11, 504(SP)
+	MOVQ plen_biasQ+112(FP), R11
+	MOVQ R11, 512(SP)
+	MOVQ plen_biasK+120(FP), R11
+	MOVQ R11, 520(SP)
+	MOVQ plen_biasV+128(FP), R11
+	MOVQ R11, 528(SP)
+	MOVQ plen_q+136(FP), R11
+	MOVQ R11, 536(SP)
+	MOVQ plen_k+144(FP), R11
+	MOVQ R11, 544(SP)
+	MOVQ plen_v+152(FP), R11
+	MOVQ R11, 552(SP)
+	QUAD $0x000001b024ac8d48                   // leaq	432(%rsp), %rbp
+	WORD $0x8949; BYTE $0xfe                   // movq	%rdi, %r14
+	LONG $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348                           // andq	$-32, %rsp
+	LONG $0x20458b48                           // movq	32(%rbp), %rax
+	QUAD $0x0000017824b48948                   // movq	%rsi, 376(%rsp)
+	WORD $0x8b48; BYTE $0x38                   // movq	(%rax), %rdi
+	LONG $0x28458b48                           // movq	40(%rbp), %rax
+	QUAD $0x000000e0248c8948                   // movq	%rcx, 224(%rsp)
+	QUAD $0x0000011024948948                   // movq	%rdx, 272(%rsp)
+	LONG $0x104d8b48                           // movq	16(%rbp), %rcx
+	WORD $0x8b4c; BYTE $0x38                   // movq	(%rax), %r15
+	LONG $0x38458b48                           // movq	56(%rbp), %rax
+	QUAD $0x000000d82484894c                   // movq	%r8, 216(%rsp)
+	LONG $0x244c894c; BYTE $0x60               // movq	%r9, 96(%rsp)
+	WORD $0x8b4c; BYTE $0x10                   // movq	(%rax), %r10
+	LONG $0x30458b48                           // movq	48(%rbp), %rax
+	QUAD $0x0000009824bc8948                   // movq	%rdi, 152(%rsp)
+	WORD $0x8b48; BYTE $0x18                   // movq	(%rax), %rbx
+	LONG $0x12048d4b                           // leaq	(%r10,%r10), %rax
+	QUAD $0x000000d02494894c                   // movq	%r10, 208(%rsp)
+	LONG $0x18348d48                           // leaq	(%rax,%rbx), %rsi
+	QUAD $0x00000168249c8948                   // movq	%rbx, 360(%rsp)
+	QUAD $0x0000014824b48948                   // movq	%rsi, 328(%rsp)
+	LONG $0x03ff8348                           // cmpq	$3, %rdi
+	JLE  BB0_71
+	QUAD $0x00000000953c8d4a                   // leaq	0(,%r10,4), %rdi
+	QUAD $0x000000009d148d48                   // leaq	0(,%rbx,4), %rdx
+	QUAD $0x0000019824bc894c                   // movq	%r15, 408(%rsp)
+	LONG $0x247c8948; BYTE $0x50               // movq	%rdi, 80(%rsp)
+	WORD $0x8948; BYTE $0xc7                   // movq	%rax, %rdi
+	LONG $0x10048d4a                           // leaq	(%rax,%r10), %rax
+	LONG $0x3f1c8d4f                           // leaq	(%r15,%r15), %r11
+	QUAD $0x000000a024848948                   // movq	%rax, 160(%rsp)
+	WORD $0x8948; BYTE $0xd8                   // movq	%rbx, %rax
+	QUAD $0x00000000bd1c8d4a                   // leaq	0(,%r15,4), %rbx
+	WORD $0x8948; BYTE $0xde                   // movq	%rbx, %rsi
+	QUAD $0x00000150249c8948                   // movq	%rbx, 336(%rsp)
+	LONG $0x1e1c8d49                           // leaq	(%r14,%rbx), %rbx
+	LONG $0x332c8d4c                           // leaq	(%rbx,%rsi), %r13
+	QUAD $0x00000190249c894c                   // movq	%r11, 400(%rsp)
+	WORD $0x014d; BYTE $0xfb                   // addq	%r15, %r11
+	LONG $0x354c8d4d; BYTE $0x00               // leaq	0(%r13,%rsi), %r9
+	WORD $0x8948; BYTE $0xc6                   // movq	%rax, %rsi
+	QUAD $0x00000188249c894c                   // movq	%r11, 392(%rsp)
+	WORD $0x894d; BYTE $0xfb                   // movq	%r15, %r11
+	LONG $0x04e6c148                           // salq	$4, %rsi
+	LONG $0x04e3c149                           // salq	$4, %r11
+	QUAD $0x000001802484c748; LONG $0x00000000 // movq	$0, 384(%rsp)
+	LONG $0x24748948; BYTE $0x48               // movq	%rsi, 72(%rsp)
+	WORD $0x894c; BYTE $0xd6                   // movq	%r10, %rsi
+	LONG $0x04e2c149                           // salq	$4, %r10
+	WORD $0x894d; BYTE $0xd8                   // movq	%r11, %r8
+	LONG $0x2454894c; BYTE $0x40               // movq	%r10, 64(%rsp)
+	WORD $0x8949; BYTE $0xf2                   // movq	%rsi, %r10
+	WORD $0x8948; BYTE $0xc6                   // movq	%rax, %rsi
+	LONG $0x02248d4d                           // leaq	(%r10,%rax), %r12
+	LONG $0xf8478d49                           // leaq	-8(%r15), %rax
+	WORD $0x2949; BYTE $0xf2                   // subq	%rsi, %r10
+	QUAD $0x000000802484c748; LONG $0x00000000 // movq	$0, 128(%rsp)
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	LONG $0x91148d4e                           // leaq	(%rcx,%r10,4), %r10
+	LONG $0x247c8948; BYTE $0x78               // movq	%rdi, 120(%rsp)
+	QUAD $0x00000008c5048d48                   // leaq	8(,%rax,8), %rax
+	LONG $0x2454894c; BYTE $0x18               // movq	%r10, 24(%rsp)
+	WORD $0x8949; BYTE $0xfa                   // movq	%rdi, %r10
+	QUAD $0x0000014024848948                   // movq	%rax, 320(%rsp)
+	QUAD $0x000000e024848b48                   // movq	224(%rsp), %rax
+	WORD $0x2949; BYTE $0xf2                   // subq	%rsi, %r10
+	LONG $0x91148d4e                           // leaq	(%rcx,%r10,4), %r10
+	LONG $0x2464894c; BYTE $0x68               // movq	%r12, 104(%rsp)
+	WORD $0x2948; BYTE $0xd0                   // subq	%rdx, %rax
+	LONG $0x2454894c; BYTE $0x10               // movq	%r10, 16(%rsp)
+	QUAD $0x0000008824848948                   // movq	%rax, 136(%rsp)
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	QUAD $0x000000e82484c748; LONG $0x00000003 // movq	$3, 232(%rsp)
+	WORD $0x2948; BYTE $0xd0                   // subq	%rdx, %rax
+	LONG $0x24448948; BYTE $0x20               // movq	%rax, 32(%rsp)
+	QUAD $0x000000a024848b48                   // movq	160(%rsp), %rax
+	WORD $0x2948; BYTE $0xf0                   // subq	%rsi, %rax
+	LONG $0x81148d4c                           // leaq	(%rcx,%rax,4), %r10
+	LONG $0x24448b48; BYTE $0x60               // movq	96(%rsp), %rax
+	LONG $0x2454894c; BYTE $0x08               // movq	%r10, 8(%rsp)
+	LONG $0x02148d4c                           // leaq	(%rdx,%rax), %r10
+	WORD $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	LONG $0x2454894c; BYTE $0x38               // movq	%r10, 56(%rsp)
+	LONG $0xf0148d4c                           // leaq	(%rax,%rsi,8), %r10
+	LONG $0x76048d48                           // leaq	(%rsi,%rsi,2), %rax
+	WORD $0x894c; BYTE $0xe6                   // movq	%r12, %rsi
+	LONG $0x2454894c; BYTE $0x30               // movq	%r10, 48(%rsp)
+	LONG $0x82148d4c                           // leaq	(%rdx,%rax,4), %r10
+	WORD $0x894c; BYTE $0xe0                   // movq	%r12, %rax
+	QUAD $0x000000d824948b48                   // movq	216(%rsp), %rdx
+	WORD $0xf748; BYTE $0xd8                   // negq	%rax
+	LONG $0x2454894c; BYTE $0x28               // movq	%r10, 40(%rsp)
+	WORD $0x3145; BYTE $0xd2                   // xorl	%r10d, %r10d
+	LONG $0x82148d48                           // leaq	(%rdx,%rax,4), %rdx
+	QUAD $0x0000014824848b48                   // movq	328(%rsp), %rax
+	LONG $0x2454894c; BYTE $0x70               // movq	%r10, 112(%rsp)
+	QUAD $0x0000009024948948                   // movq	%rdx, 144(%rsp)
+	WORD $0xd231                               // xorl	%edx, %edx
+	WORD $0x394c; BYTE $0xe0                   // cmpq	%r12, %rax
+	QUAD $0x000000a824948948                   // movq	%rdx, 168(%rsp)
+	WORD $0x8949; BYTE $0xdc                   // movq	%rbx, %r12
+	LONG $0xf04e0f48                           // cmovle	%rax, %rsi
+	WORD $0x894c; BYTE $0xe8                   // movq	%r13, %rax
+	WORD $0x894d; BYTE $0xf5                   // movq	%r14, %r13
+	WORD $0x8949; BYTE $0xc3                   // movq	%rax, %r11
+	QUAD $0x000000f024b48948                   // movq	%rsi, 240(%rsp)
+
+BB0_4:
+	QUAD $0x0000014824bc8348; BYTE $0x00       // cmpq	$0, 328(%rsp)
+	JLE  BB0_20
+	LONG $0x247c8348; WORD $0x0068             // cmpq	$0, 104(%rsp)
+	JLE  BB0_72
+	LONG $0x24448b48; BYTE $0x70               // movq	112(%rsp), %rax
+	LONG $0x245c8b48; BYTE $0x20               // movq	32(%rsp), %rbx
+	LONG $0x2444894c; BYTE $0x58               // movq	%r8, 88(%rsp)
+	WORD $0x3145; BYTE $0xd2                   // xorl	%r10d, %r10d
+	QUAD $0x000001702484c748; LONG $0x00000000 // movq	$0, 368(%rsp)
+	QUAD $0x00000178248c8b48                   // movq	376(%rsp), %rcx
+	WORD $0x894d; BYTE $0xe8                   // movq	%r13, %r8
+	WORD $0x0148; BYTE $0xc3                   // addq	%rax, %rbx
+	QUAD $0x00000118249c8948                   // movq	%rbx, 280(%rsp)
+	LONG $0x245c8b48; BYTE $0x18               // movq	24(%rsp), %rbx
+	WORD $0x0148; BYTE $0xc3                   // addq	%rax, %rbx
+	QUAD $0x000000c8249c8948                   // movq	%rbx, 200(%rsp)
+	LONG $0x245c8b48; BYTE $0x10               // movq	16(%rsp), %rbx
+	WORD $0x0148; BYTE $0xc3                   // addq	%rax, %rbx
+	QUAD $0x000000c0249c8948                   // movq	%rbx, 192(%rsp)
+	LONG $0x245c8b48; BYTE $0x08               // movq	8(%rsp), %rbx
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x245c8b48; BYTE $0x38               // movq	56(%rsp), %rbx
+	QUAD $0x000000b824848948                   // movq	%rax, 184(%rsp)
+	QUAD $0x000000a824848b48                   // movq	168(%rsp), %rax
+	WORD $0x0148; BYTE $0xc3                   // addq	%rax, %rbx
+	QUAD $0x00000108249c8948                   // movq	%rbx, 264(%rsp)
+	LONG $0x245c8b48; BYTE $0x30               // movq	48(%rsp), %rbx
+	WORD $0x0148; BYTE $0xc3                   // addq	%rax, %rbx
+	QUAD $0x00000100249c8948                   // movq	%rbx, 256(%rsp)
+	LONG $0x245c8b48; BYTE $0x28               // movq	40(%rsp), %rbx
+	WORD $0x0148; BYTE $0xc3                   // addq	%rax, %rbx
+	QUAD $0x000000f8249c8948                   // movq	%rbx, 248(%rsp)
+	LONG $0x245c8b48; BYTE $0x60               // movq	96(%rsp), %rbx
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	WORD $0x894c; BYTE $0xdb                   // movq	%r11, %rbx
+	WORD $0x894d; BYTE $0xe3                   // movq	%r12, %r11
+	QUAD $0x000000b024848948                   // movq	%rax, 176(%rsp)
+
+BB0_19:
+	LONG $0x07ff8349             // cmpq	$7, %r15
+	JLE  BB0_73
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	LONG $0xd128fcc5             // vmovaps	%ymm1, %ymm2
+	LONG $0xd928fcc5             // vmovaps	%ymm1, %ymm3
+	LONG $0xe128fcc5             // vmovaps	%ymm1, %ymm4
+
+BB0_7:
+	LONG $0x4410fcc5; WORD $0xe081             // vmovups	-32(%rcx,%rax,4), %ymm0
+	LONG $0xb87dc2c4; WORD $0x8064; BYTE $0xe0 // vfmadd231ps	-32(%r8,%rax,4), %ymm0, %ymm4
+	LONG $0xb87dc2c4; WORD $0x835c; BYTE $0xe0 // vfmadd231ps	-32(%r11,%rax,4), %ymm0, %ymm3
+	LONG $0xb87de2c4; WORD $0x8354; BYTE $0xe0 // vfmadd231ps	-32(%rbx,%rax,4), %ymm0, %ymm2
+	LONG $0xb87dc2c4; WORD $0x814c; BYTE $0xe0 // vfmadd231ps	-32(%r9,%rax,4), %ymm0, %ymm1
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_7
+	QUAD $0x0000014024948b48                   // movq	320(%rsp), %rdx
+
+BB0_6:
+	LONG $0x197de3c4; WORD $0x01e0 // vextractf128	$0x1, %ymm4, %xmm0
+	LONG $0xe458f8c5               // vaddps	%xmm4, %xmm0, %xmm4
+	LONG $0xc412d8c5               // vmovhlps	%xmm4, %xmm4, %xmm0
+	LONG $0xe058d8c5               // vaddps	%xmm0, %xmm4, %xmm4
+	LONG $0xc416fac5               // vmovshdup	%xmm4, %xmm0
+	LONG $0xe058dac5               // vaddss	%xmm0, %xmm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01d8 // vextractf128	$0x1, %ymm3, %xmm0
+	LONG $0xdb58f8c5               // vaddps	%xmm3, %xmm0, %xmm3
+	LONG $0xc312e0c5               // vmovhlps	%xmm3, %xmm3, %xmm0
+	LONG $0xd858e0c5               // vaddps	%xmm0, %xmm3, %xmm3
+	LONG $0xc316fac5               // vmovshdup	%xmm3, %xmm0
+	LONG $0xd858e2c5               // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0x197de3c4; WORD $0x01d0 // vextractf128	$0x1, %ymm2, %xmm0
+	LONG $0xc258f8c5               // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0xd012f8c5               // vmovhlps	%xmm0, %xmm0, %xmm2
+	LONG $0xc258f8c5               // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0xd016fac5               // vmovshdup	%xmm0, %xmm2
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01ca // vextractf128	$0x1, %ymm1, %xmm2
+	LONG $0xca58f0c5               // vaddps	%xmm2, %xmm1, %xmm1
+	LONG $0xd112f0c5               // vmovhlps	%xmm1, %xmm1, %xmm2
+	LONG $0xc958e8c5               // vaddps	%xmm1, %xmm2, %xmm1
+	LONG $0xd116fac5               // vmovshdup	%xmm1, %xmm2
+	LONG $0xca58f2c5               // vaddss	%xmm2, %xmm1, %xmm1
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_8
+	WORD $0x894c; BYTE $0xff       // movq	%r15, %rdi
+	QUAD $0x0000015824948948       // movq	%rdx, 344(%rsp)
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	QUAD $0x0000016024bc8948       // movq	%rdi, 352(%rsp)
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_74
+	QUAD $0x0000018024848b48       // movq	384(%rsp), %rax
+	QUAD $0x0000017824b48b48       // movq	376(%rsp), %rsi
+	LONG $0x03efc148               // shrq	$3, %rdi
+	QUAD $0x0000012824bc894c       // movq	%r15, 296(%rsp)
+	QUAD $0x000001202494894c       // movq	%r10, 288(%rsp)
+	LONG $0x05e7c148               // salq	$5, %rdi
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x862c8d4d               // leaq	(%r14,%rax,4), %r13
+	QUAD $0x0000017024848b48       // movq	368(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x86248d4c               // leaq	(%rsi,%rax,4), %r12
+	QUAD $0x0000019824848b48       // movq	408(%rsp), %rax
+	QUAD $0x0000019024b48b48       // movq	400(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x86048d49               // leaq	(%r14,%rax,4), %rax
+	QUAD $0x0000013824848948       // movq	%rax, 312(%rsp)
+	LONG $0x32048d48               // leaq	(%rdx,%rsi), %rax
+	QUAD $0x0000013824948b4c       // movq	312(%rsp), %r10
+	LONG $0x86348d49               // leaq	(%r14,%rax,4), %rsi
+	QUAD $0x0000018824848b48       // movq	392(%rsp), %rax
+	QUAD $0x0000013024b48948       // movq	%rsi, 304(%rsp)
+	QUAD $0x0000013024bc8b4c       // movq	304(%rsp), %r15
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x86348d49               // leaq	(%r14,%rax,4), %rsi
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_10:
+	LONG $0x107cc1c4; WORD $0x042c             // vmovups	(%r12,%rax), %ymm5
+	LONG $0x5954c1c4; WORD $0x0574; BYTE $0x00 // vmulps	0(%r13,%rax), %ymm5, %ymm6
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xd6c6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm2
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0xe258dac5                           // vaddss	%xmm2, %xmm4, %xmm4
+	LONG $0xd615c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm2
+	LONG $0xe258dac5                           // vaddss	%xmm2, %xmm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01f2             // vextractf128	$0x1, %ymm6, %xmm2
+	LONG $0xf2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm6
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0xe258dac5                           // vaddss	%xmm2, %xmm4, %xmm4
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xf215e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm6
+	LONG $0xd2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm2
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0x5954c1c4; WORD $0x0234             // vmulps	(%r10,%rax), %ymm5, %ymm6
+	LONG $0xe258dac5                           // vaddss	%xmm2, %xmm4, %xmm4
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0xd6c6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm2
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xd615c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm2
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0x197de3c4; WORD $0x01f2             // vextractf128	$0x1, %ymm6, %xmm2
+	LONG $0xf2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm6
+	LONG $0xdf58e2c5                           // vaddss	%xmm7, %xmm3, %xmm3
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0xf215e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm6
+	LONG $0xd2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm2
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0x5954c1c4; WORD $0x0734             // vmulps	(%r15,%rax), %ymm5, %ymm6
+	LONG $0x2c59d4c5; BYTE $0x06               // vmulps	(%rsi,%rax), %ymm5, %ymm5
+	LONG $0x20c08348                           // addq	$32, %rax
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xd6c6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm2
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xd615c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01f2             // vextractf128	$0x1, %ymm6, %xmm2
+	LONG $0xf2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm6
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xf215e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm6
+	LONG $0xd2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm2
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xd5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm2
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xd515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm2
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xd5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm2
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xd515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm2
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xf8                   // cmpq	%rdi, %rax
+	JNE  BB0_10
+	QUAD $0x0000016024b48b48                   // movq	352(%rsp), %rsi
+	QUAD $0x0000012824bc8b4c                   // movq	296(%rsp), %r15
+	QUAD $0x0000012024948b4c                   // movq	288(%rsp), %r10
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x07                   // andl	$7, %esi
+	JE   BB0_8
+
+BB0_9:
+	QUAD $0x0000016024b48b48       // movq	352(%rsp), %rsi
+	WORD $0x2948; BYTE $0xc6       // subq	%rax, %rsi
+	LONG $0xff7e8d48               // leaq	-1(%rsi), %rdi
+	LONG $0x02ff8348               // cmpq	$2, %rdi
+	JBE  BB0_13
+	QUAD $0x0000015824bc8b48       // movq	344(%rsp), %rdi
+	QUAD $0x0000017824a48b4c       // movq	376(%rsp), %r12
+	WORD $0x0148; BYTE $0xc7       // addq	%rax, %rdi
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	QUAD $0x0000017024bc8b48       // movq	368(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7       // addq	%rax, %rdi
+	LONG $0x1078c1c4; WORD $0xbc14 // vmovups	(%r12,%rdi,4), %xmm2
+	QUAD $0x0000018024bc8b48       // movq	384(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7       // addq	%rax, %rdi
+	LONG $0x5968c1c4; WORD $0xbe34 // vmulps	(%r14,%rdi,4), %xmm2, %xmm6
+	QUAD $0x0000019824bc8b48       // movq	408(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7       // addq	%rax, %rdi
+	LONG $0xe658dac5               // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xeec6c8c5; BYTE $0x55   // vshufps	$85, %xmm6, %xmm6, %xmm5
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xee15c8c5               // vunpckhps	%xmm6, %xmm6, %xmm5
+	LONG $0xf6c6c8c5; BYTE $0xff   // vshufps	$255, %xmm6, %xmm6, %xmm6
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xe658dac5               // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0x5968c1c4; WORD $0xbe34 // vmulps	(%r14,%rdi,4), %xmm2, %xmm6
+	QUAD $0x0000019024bc8b48       // movq	400(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7       // addq	%rax, %rdi
+	LONG $0xde58e2c5               // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0xeec6c8c5; BYTE $0x55   // vshufps	$85, %xmm6, %xmm6, %xmm5
+	LONG $0xdd58e2c5               // vaddss	%xmm5, %xmm3, %xmm3
+	LONG $0xee15c8c5               // vunpckhps	%xmm6, %xmm6, %xmm5
+	LONG $0xf6c6c8c5; BYTE $0xff   // vshufps	$255, %xmm6, %xmm6, %xmm6
+	LONG $0xdd58e2c5               // vaddss	%xmm5, %xmm3, %xmm3
+	LONG $0xde58e2c5               // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0x5968c1c4; WORD $0xbe34 // vmulps	(%r14,%rdi,4), %xmm2, %xmm6
+	QUAD $0x0000018824bc8b48       // movq	392(%rsp), %rdi
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+	LONG $0x5968c1c4; WORD $0x8614 // vmulps	(%r14,%rax,4), %xmm2, %xmm2
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	LONG $0xc658fac5               // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xeec6c8c5; BYTE $0x55   // vshufps	$85, %xmm6, %xmm6, %xmm5
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x03       // andl	$3, %esi
+	LONG $0xc558fac5               // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xca58f2c5               // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xee15c8c5               // vunpckhps	%xmm6, %xmm6, %xmm5
+	LONG $0xf6c6c8c5; BYTE $0xff   // vshufps	$255, %xmm6, %xmm6, %xmm6
+	LONG $0xc558fac5               // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xeac6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm5
+	LONG $0xcd58f2c5               // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xea15e8c5               // vunpckhps	%xmm2, %xmm2, %xmm5
+	LONG $0xd2c6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm2
+	LONG $0xcd58f2c5               // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xc658fac5               // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xca58f2c5               // vaddss	%xmm2, %xmm1, %xmm1
+	JE   BB0_8
+
+BB0_13:
+	QUAD $0x0000017024bc8b48       // movq	368(%rsp), %rdi
+	QUAD $0x0000017824a48b4c       // movq	376(%rsp), %r12
+	QUAD $0x0000018024ac8b4c       // movq	384(%rsp), %r13
+	QUAD $0x0000019024b48b48       // movq	400(%rsp), %rsi
+	LONG $0x17048d48               // leaq	(%rdi,%rdx), %rax
+	LONG $0x107ac1c4; WORD $0x8414 // vmovss	(%r12,%rax,4), %xmm2
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	LONG $0xb969c2c4; WORD $0x8624 // vfmadd231ss	(%r14,%rax,4), %xmm2, %xmm4
+	QUAD $0x0000019824848b48       // movq	408(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb969c2c4; WORD $0x861c // vfmadd231ss	(%r14,%rax,4), %xmm2, %xmm3
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	LONG $0xb969c2c4; WORD $0x8604 // vfmadd231ss	(%r14,%rax,4), %xmm2, %xmm0
+	QUAD $0x0000018824848b48       // movq	392(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb969c2c4; WORD $0x860c // vfmadd231ss	(%r14,%rax,4), %xmm2, %xmm1
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_8
+	LONG $0x07348d48               // leaq	(%rdi,%rax), %rsi
+	LONG $0x02c28348               // addq	$2, %rdx
+	LONG $0x107ac1c4; WORD $0xb414 // vmovss	(%r12,%rsi,4), %xmm2
+	LONG $0x05748d49; BYTE $0x00   // leaq	0(%r13,%rax), %rsi
+	LONG $0xb969c2c4; WORD $0xb624 // vfmadd231ss	(%r14,%rsi,4), %xmm2, %xmm4
+	QUAD $0x0000019824b48b48       // movq	408(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb969c2c4; WORD $0xb61c // vfmadd231ss	(%r14,%rsi,4), %xmm2, %xmm3
+	QUAD $0x0000019024b48b48       // movq	400(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb969c2c4; WORD $0xb604 // vfmadd231ss	(%r14,%rsi,4), %xmm2, %xmm0
+	QUAD $0x0000018824b48b48       // movq	392(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0xb969c2c4; WORD $0x860c // vfmadd231ss	(%r14,%rax,4), %xmm2, %xmm1
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_8
+	LONG $0x17048d48               // leaq	(%rdi,%rdx), %rax
+	QUAD $0x0000019824b48b48       // movq	408(%rsp), %rsi
+	LONG $0x107ac1c4; WORD $0x8414 // vmovss	(%r12,%rax,4), %xmm2
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	LONG $0xb969c2c4; WORD $0x8624 // vfmadd231ss	(%r14,%rax,4), %xmm2, %xmm4
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	QUAD $0x0000019024b48b48       // movq	400(%rsp), %rsi
+	LONG $0xb969c2c4; WORD $0x861c // vfmadd231ss	(%r14,%rax,4), %xmm2, %xmm3
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	QUAD $0x0000018824b48b48       // movq	392(%rsp), %rsi
+	LONG $0xb969c2c4; WORD $0x8604 // vfmadd231ss	(%r14,%rax,4), %xmm2, %xmm0
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+	LONG $0xb969c2c4; WORD $0x960c // vfmadd231ss	(%r14,%rdx,4), %xmm2, %xmm1
+
+BB0_8:
+	QUAD $0x000001682494394c       // cmpq	%r10, 360(%rsp)
+	JLE  BB0_15
+	QUAD $0x0000011024848b48       // movq	272(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_16
+	LONG $0x107aa1c4; WORD $0x9014 // vmovss	(%rax,%r10,4), %xmm2
+	LONG $0xe258dac5               // vaddss	%xmm2, %xmm4, %xmm4
+	LONG $0xda58e2c5               // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xca58f2c5               // vaddss	%xmm2, %xmm1, %xmm1
+
+BB0_16:
+	QUAD $0x000000b024848b48       // movq	176(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x9024 // vmovss	%xmm4, (%rax,%r10,4)
+	QUAD $0x0000010824848b48       // movq	264(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x901c // vmovss	%xmm3, (%rax,%r10,4)
+	QUAD $0x0000010024848b48       // movq	256(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x9004 // vmovss	%xmm0, (%rax,%r10,4)
+	QUAD $0x000000f824848b48       // movq	248(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x900c // vmovss	%xmm1, (%rax,%r10,4)
+
+BB0_17:
+	QUAD $0x0000015024848b48     // movq	336(%rsp), %rax
+	LONG $0x01c28349             // addq	$1, %r10
+	QUAD $0x0000017024bc014c     // addq	%r15, 368(%rsp)
+	WORD $0x0148; BYTE $0xc1     // addq	%rax, %rcx
+	QUAD $0x000000f024848b48     // movq	240(%rsp), %rax
+	WORD $0x3949; BYTE $0xc2     // cmpq	%rax, %r10
+	JL   BB0_19
+	WORD $0x894d; BYTE $0xc5     // movq	%r8, %r13
+	WORD $0x894d; BYTE $0xdc     // movq	%r11, %r12
+	LONG $0x24448b4c; BYTE $0x58 // movq	88(%rsp), %r8
+	WORD $0x8949; BYTE $0xdb     // movq	%rbx, %r11
+	QUAD $0x000001482494394c     // cmpq	%r10, 328(%rsp)
+	JLE  BB0_20
+
+BB0_5:
+	QUAD $0x00000080249c8b48     // movq	128(%rsp), %rbx
+	LONG $0x244c8b48; BYTE $0x68 // movq	104(%rsp), %rcx
+	QUAD $0x000000b02484894c     // movq	%r8, 176(%rsp)
+	WORD $0x894d; BYTE $0xd0     // movq	%r10, %r8
+	WORD $0x8948; BYTE $0xd8     // movq	%rbx, %rax
+	WORD $0x2948; BYTE $0xc8     // subq	%rcx, %rax
+	LONG $0x184d8b48             // movq	24(%rbp), %rcx
+	WORD $0x014c; BYTE $0xd0     // addq	%r10, %rax
+	LONG $0x81048d48             // leaq	(%rcx,%rax,4), %rax
+	QUAD $0x00000178248c8b48     // movq	376(%rsp), %rcx
+	QUAD $0x0000012824848948     // movq	%rax, 296(%rsp)
+	WORD $0x894c; BYTE $0xf8     // movq	%r15, %rax
+	LONG $0xc2af0f49             // imulq	%r10, %rax
+	WORD $0x894d; BYTE $0xea     // movq	%r13, %r10
+	QUAD $0x0000017024848948     // movq	%rax, 368(%rsp)
+	LONG $0x810c8d48             // leaq	(%rcx,%rax,4), %rcx
+	LONG $0x24448b48; BYTE $0x78 // movq	120(%rsp), %rax
+	WORD $0x2948; BYTE $0xd8     // subq	%rbx, %rax
+	QUAD $0x000000c824848948     // movq	%rax, 200(%rsp)
+	QUAD $0x000000a024848b48     // movq	160(%rsp), %rax
+	WORD $0x2948; BYTE $0xd8     // subq	%rbx, %rax
+	QUAD $0x000000a8249c8b48     // movq	168(%rsp), %rbx
+	QUAD $0x000000c024848948     // movq	%rax, 192(%rsp)
+	LONG $0x24448b48; BYTE $0x60 // movq	96(%rsp), %rax
+	WORD $0x0148; BYTE $0xd8     // addq	%rbx, %rax
+	WORD $0x894c; BYTE $0xe3     // movq	%r12, %rbx
+	QUAD $0x000000b824848948     // movq	%rax, 184(%rsp)
+
+BB0_34:
+	LONG $0x07ff8349             // cmpq	$7, %r15
+	JLE  BB0_75
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	LONG $0xd128fcc5             // vmovaps	%ymm1, %ymm2
+	LONG $0xd928fcc5             // vmovaps	%ymm1, %ymm3
+	LONG $0xe128fcc5             // vmovaps	%ymm1, %ymm4
+
+BB0_22:
+	LONG $0x4410fcc5; WORD $0xe081             // vmovups	-32(%rcx,%rax,4), %ymm0
+	LONG $0xb87dc2c4; WORD $0x8264; BYTE $0xe0 // vfmadd231ps	-32(%r10,%rax,4), %ymm0, %ymm4
+	LONG $0xb87de2c4; WORD $0x835c; BYTE $0xe0 // vfmadd231ps	-32(%rbx,%rax,4), %ymm0, %ymm3
+	LONG $0xb87dc2c4; WORD $0x8354; BYTE $0xe0 // vfmadd231ps	-32(%r11,%rax,4), %ymm0, %ymm2
+	LONG $0xb87dc2c4; WORD $0x814c; BYTE $0xe0 // vfmadd231ps	-32(%r9,%rax,4), %ymm0, %ymm1
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x3949; BYTE $0xc7                   // cmpq	%rax, %r15
+	JGE  BB0_22
+	QUAD $0x0000014024948b48                   // movq	320(%rsp), %rdx
+
+BB0_21:
+	LONG $0x197de3c4; WORD $0x01e0 // vextractf128	$0x1, %ymm4, %xmm0
+	LONG $0xe058d8c5               // vaddps	%xmm0, %xmm4, %xmm4
+	LONG $0xc412d8c5               // vmovhlps	%xmm4, %xmm4, %xmm0
+	LONG $0xe458f8c5               // vaddps	%xmm4, %xmm0, %xmm4
+	LONG $0xc416fac5               // vmovshdup	%xmm4, %xmm0
+	LONG $0xe058dac5               // vaddss	%xmm0, %xmm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01d8 // vextractf128	$0x1, %ymm3, %xmm0
+	LONG $0xd858e0c5               // vaddps	%xmm0, %xmm3, %xmm3
+	LONG $0xc312e0c5               // vmovhlps	%xmm3, %xmm3, %xmm0
+	LONG $0xdb58f8c5               // vaddps	%xmm3, %xmm0, %xmm3
+	LONG $0xc316fac5               // vmovshdup	%xmm3, %xmm0
+	LONG $0xd858e2c5               // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0x197de3c4; WORD $0x01d0 // vextractf128	$0x1, %ymm2, %xmm0
+	LONG $0xd058e8c5               // vaddps	%xmm0, %xmm2, %xmm2
+	LONG $0xc212e8c5               // vmovhlps	%xmm2, %xmm2, %xmm0
+	LONG $0xd258f8c5               // vaddps	%xmm2, %xmm0, %xmm2
+	LONG $0xc216fac5               // vmovshdup	%xmm2, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc858f0c5               // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc112f0c5               // vmovhlps	%xmm1, %xmm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_23
+	WORD $0x894c; BYTE $0xff       // movq	%r15, %rdi
+	QUAD $0x0000015824948948       // movq	%rdx, 344(%rsp)
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	QUAD $0x0000016024bc8948       // movq	%rdi, 352(%rsp)
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_76
+	QUAD $0x0000018024848b48       // movq	384(%rsp), %rax
+	QUAD $0x0000017824b48b48       // movq	376(%rsp), %rsi
+	LONG $0x03efc148               // shrq	$3, %rdi
+	QUAD $0x0000012024bc894c       // movq	%r15, 288(%rsp)
+	QUAD $0x000001182484894c       // movq	%r8, 280(%rsp)
+	LONG $0x05e7c148               // salq	$5, %rdi
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x862c8d4d               // leaq	(%r14,%rax,4), %r13
+	QUAD $0x0000017024848b48       // movq	368(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x86248d4c               // leaq	(%rsi,%rax,4), %r12
+	QUAD $0x0000019824848b48       // movq	408(%rsp), %rax
+	QUAD $0x0000019024b48b48       // movq	400(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x86048d49               // leaq	(%r14,%rax,4), %rax
+	QUAD $0x0000013824848948       // movq	%rax, 312(%rsp)
+	LONG $0x32048d48               // leaq	(%rdx,%rsi), %rax
+	QUAD $0x0000013824848b4c       // movq	312(%rsp), %r8
+	LONG $0x86348d49               // leaq	(%r14,%rax,4), %rsi
+	QUAD $0x0000018824848b48       // movq	392(%rsp), %rax
+	QUAD $0x0000013024b48948       // movq	%rsi, 304(%rsp)
+	QUAD $0x0000013024bc8b4c       // movq	304(%rsp), %r15
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x86348d49               // leaq	(%r14,%rax,4), %rsi
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_25:
+	LONG $0x107cc1c4; WORD $0x042c             // vmovups	(%r12,%rax), %ymm5
+	LONG $0x5954c1c4; WORD $0x0574; BYTE $0x00 // vmulps	0(%r13,%rax), %ymm5, %ymm6
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xcec6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm1
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0xce15c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm1
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01f1             // vextractf128	$0x1, %ymm6, %xmm1
+	LONG $0xf1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm6
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xf115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm6
+	LONG $0xc9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0x5954c1c4; WORD $0x0034             // vmulps	(%r8,%rax), %ymm5, %ymm6
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0xcec6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm1
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0xce15c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm1
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0x197de3c4; WORD $0x01f1             // vextractf128	$0x1, %ymm6, %xmm1
+	LONG $0xf1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm6
+	LONG $0xdf58e2c5                           // vaddss	%xmm7, %xmm3, %xmm3
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0xf115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm6
+	LONG $0xc9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0x5954c1c4; WORD $0x0734             // vmulps	(%r15,%rax), %ymm5, %ymm6
+	LONG $0x2c59d4c5; BYTE $0x06               // vmulps	(%rsi,%rax), %ymm5, %ymm5
+	LONG $0x20c08348                           // addq	$32, %rax
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xcec6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm1
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xce15c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm1
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01f1             // vextractf128	$0x1, %ymm6, %xmm1
+	LONG $0xf1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm6
+	LONG $0xd758eac5                           // vaddss	%xmm7, %xmm2, %xmm2
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xf115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm6
+	LONG $0xc9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xcdc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xcd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm1
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xcdc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm1
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xcd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm1
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xf8                   // cmpq	%rdi, %rax
+	JNE  BB0_25
+	QUAD $0x0000016024b48b48                   // movq	352(%rsp), %rsi
+	QUAD $0x0000012024bc8b4c                   // movq	288(%rsp), %r15
+	QUAD $0x0000011824848b4c                   // movq	280(%rsp), %r8
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x07                   // andl	$7, %esi
+	JE   BB0_23
+
+BB0_24:
+	QUAD $0x0000016024b48b48                   // movq	352(%rsp), %rsi
+	WORD $0x2948; BYTE $0xc6                   // subq	%rax, %rsi
+	LONG $0xff7e8d48                           // leaq	-1(%rsi), %rdi
+	LONG $0x02ff8348                           // cmpq	$2, %rdi
+	JBE  BB0_28
+	QUAD $0x0000015824bc8b48                   // movq	344(%rsp), %rdi
+	QUAD $0x0000017824ac8b4c                   // movq	376(%rsp), %r13
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	QUAD $0x0000017024bc8b48                   // movq	368(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	LONG $0x1078c1c4; WORD $0xbd4c; BYTE $0x00 // vmovups	0(%r13,%rdi,4), %xmm1
+	QUAD $0x0000018024bc8b48                   // movq	384(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	LONG $0x5970c1c4; WORD $0xbe34             // vmulps	(%r14,%rdi,4), %xmm1, %xmm6
+	QUAD $0x0000019824bc8b48                   // movq	408(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xeec6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm5
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xee15c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm5
+	LONG $0xf6c6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm6
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0x5970c1c4; WORD $0xbe34             // vmulps	(%r14,%rdi,4), %xmm1, %xmm6
+	QUAD $0x0000019024bc8b48                   // movq	400(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0xeec6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm5
+	LONG $0xdd58e2c5                           // vaddss	%xmm5, %xmm3, %xmm3
+	LONG $0xee15c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm5
+	LONG $0xf6c6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm6
+	LONG $0xdd58e2c5                           // vaddss	%xmm5, %xmm3, %xmm3
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0x5970c1c4; WORD $0xbe34             // vmulps	(%r14,%rdi,4), %xmm1, %xmm6
+	QUAD $0x0000018824bc8b48                   // movq	392(%rsp), %rdi
+	WORD $0x0148; BYTE $0xf8                   // addq	%rdi, %rax
+	LONG $0x5970c1c4; WORD $0x860c             // vmulps	(%r14,%rax,4), %xmm1, %xmm1
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xfce08348                           // andq	$-4, %rax
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xeec6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm5
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x03                   // andl	$3, %esi
+	LONG $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xee15c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm5
+	LONG $0xf6c6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm6
+	LONG $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG $0xe9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xe915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm5
+	LONG $0xc9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_23
+
+BB0_28:
+	QUAD $0x0000017024bc8b48       // movq	368(%rsp), %rdi
+	QUAD $0x0000017824a48b4c       // movq	376(%rsp), %r12
+	QUAD $0x0000018024ac8b4c       // movq	384(%rsp), %r13
+	QUAD $0x0000019024b48b48       // movq	400(%rsp), %rsi
+	LONG $0x17048d48               // leaq	(%rdi,%rdx), %rax
+	LONG $0x107ac1c4; WORD $0x840c // vmovss	(%r12,%rax,4), %xmm1
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	LONG $0xb971c2c4; WORD $0x8624 // vfmadd231ss	(%r14,%rax,4), %xmm1, %xmm4
+	QUAD $0x0000019824848b48       // movq	408(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb971c2c4; WORD $0x861c // vfmadd231ss	(%r14,%rax,4), %xmm1, %xmm3
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	LONG $0xb971c2c4; WORD $0x8614 // vfmadd231ss	(%r14,%rax,4), %xmm1, %xmm2
+	QUAD $0x0000018824848b48       // movq	392(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xb971c2c4; WORD $0x8604 // vfmadd231ss	(%r14,%rax,4), %xmm1, %xmm0
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_23
+	LONG $0x07348d48               // leaq	(%rdi,%rax), %rsi
+	LONG $0x02c28348               // addq	$2, %rdx
+	LONG $0x107ac1c4; WORD $0xb40c // vmovss	(%r12,%rsi,4), %xmm1
+	LONG $0x05748d49; BYTE $0x00   // leaq	0(%r13,%rax), %rsi
+	LONG $0xb971c2c4; WORD $0xb624 // vfmadd231ss	(%r14,%rsi,4), %xmm1, %xmm4
+	QUAD $0x0000019824b48b48       // movq	408(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb971c2c4; WORD $0xb61c // vfmadd231ss	(%r14,%rsi,4), %xmm1, %xmm3
+	QUAD $0x0000019024b48b48       // movq	400(%rsp), %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0xb971c2c4; WORD $0xb614 // vfmadd231ss	(%r14,%rsi,4), %xmm1, %xmm2
+	QUAD $0x0000018824b48b48       // movq	392(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0xb971c2c4; WORD $0x8604 // vfmadd231ss	(%r14,%rax,4), %xmm1, %xmm0
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_23
+	LONG $0x17048d48               // leaq	(%rdi,%rdx), %rax
+	QUAD $0x0000019824b48b48       // movq	408(%rsp), %rsi
+	LONG $0x107ac1c4; WORD $0x840c // vmovss	(%r12,%rax,4), %xmm1
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	LONG $0xb971c2c4; WORD $0x8624 // vfmadd231ss	(%r14,%rax,4), %xmm1, %xmm4
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	QUAD $0x0000019024b48b48       // movq	400(%rsp), %rsi
+	LONG $0xb971c2c4; WORD $0x861c // vfmadd231ss	(%r14,%rax,4), %xmm1, %xmm3
+	LONG $0x16048d48               // leaq	(%rsi,%rdx), %rax
+	QUAD $0x0000018824b48b48       // movq	392(%rsp), %rsi
+	LONG $0xb971c2c4; WORD $0x8614 // vfmadd231ss	(%r14,%rax,4), %xmm1, %xmm2
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+	LONG $0xb971c2c4; WORD $0x9604 // vfmadd231ss	(%r14,%rdx,4), %xmm1, %xmm0
+
+BB0_23:
+	QUAD $0x000001682484394c       // cmpq	%r8, 360(%rsp)
+	JLE  BB0_30
+	QUAD $0x0000011024848b48       // movq	272(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_31
+	LONG $0x107aa1c4; WORD $0x800c // vmovss	(%rax,%r8,4), %xmm1
+	LONG $0xe158dac5               // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0xd958e2c5               // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0xd158eac5               // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+
+BB0_31:
+	QUAD $0x000000b824848b48       // movq	184(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x8024 // vmovss	%xmm4, (%rax,%r8,4)
+	QUAD $0x0000010824848b48       // movq	264(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x801c // vmovss	%xmm3, (%rax,%r8,4)
+	QUAD $0x0000010024848b48       // movq	256(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x8014 // vmovss	%xmm2, (%rax,%r8,4)
+	QUAD $0x000000f824848b48       // movq	248(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x8004 // vmovss	%xmm0, (%rax,%r8,4)
+
+BB0_32:
+	QUAD $0x0000015024848b48             // movq	336(%rsp), %rax
+	QUAD $0x0000017024bc014c             // addq	%r15, 368(%rsp)
+	LONG $0x01c08349                     // addq	$1, %r8
+	QUAD $0x0000012824848348; BYTE $0x04 // addq	$4, 296(%rsp)
+	WORD $0x0148; BYTE $0xc1             // addq	%rax, %rcx
+	QUAD $0x000001482484394c             // cmpq	%r8, 328(%rsp)
+	JG   BB0_34
+	QUAD $0x000000b024848b4c             // movq	176(%rsp), %r8
+	WORD $0x894d; BYTE $0xd5             // movq	%r10, %r13
+	WORD $0x8949; BYTE $0xdc             // movq	%rbx, %r12
+
+BB0_20:
+	LONG $0x24448b48; BYTE $0x50         // movq	80(%rsp), %rax
+	LONG $0x244c8b48; BYTE $0x48         // movq	72(%rsp), %rcx
+	WORD $0x014d; BYTE $0xc5             // addq	%r8, %r13
+	WORD $0x014d; BYTE $0xc4             // addq	%r8, %r12
+	QUAD $0x000000e824848348; BYTE $0x04 // addq	$4, 232(%rsp)
+	WORD $0x014d; BYTE $0xc3             // addq	%r8, %r11
+	QUAD $0x000000e8249c8b48             // movq	232(%rsp), %rbx
+	WORD $0x014d; BYTE $0xc1             // addq	%r8, %r9
+	QUAD $0x0000008024840148             // addq	%rax, 128(%rsp)
+	LONG $0x24440148; BYTE $0x78         // addq	%rax, 120(%rsp)
+	QUAD $0x000000a024840148             // addq	%rax, 160(%rsp)
+	QUAD $0x0000015024848b48             // movq	336(%rsp), %rax
+	QUAD $0x000000a8248c0148             // addq	%rcx, 168(%rsp)
+	LONG $0x244c8b48; BYTE $0x40         // movq	64(%rsp), %rcx
+	QUAD $0x0000018024840148             // addq	%rax, 384(%rsp)
+	QUAD $0x0000019824840148             // addq	%rax, 408(%rsp)
+	QUAD $0x0000019024840148             // addq	%rax, 400(%rsp)
+	QUAD $0x0000018824840148             // addq	%rax, 392(%rsp)
+	LONG $0x244c0148; BYTE $0x70         // addq	%rcx, 112(%rsp)
+	QUAD $0x00000098249c3948             // cmpq	%rbx, 152(%rsp)
+	JG   BB0_4
+	QUAD $0x0000009824848b48             // movq	152(%rsp), %rax
+	LONG $0x104d8b48                     // movq	16(%rbp), %rcx
+	LONG $0x04e88348                     // subq	$4, %rax
+	LONG $0x02e8c148                     // shrq	$2, %rax
+	QUAD $0x0000000485048d4c             // leaq	4(,%rax,4), %r8
+
+BB0_2:
+	QUAD $0x000000982484394c // cmpq	%r8, 152(%rsp)
+	JLE  BB0_143
+	QUAD $0x00000148248c8b4c // movq	328(%rsp), %r9
+	WORD $0x854d; BYTE $0xc9 // testq	%r9, %r9
+	JLE  BB0_143
+	QUAD $0x0000016824848b48 // movq	360(%rsp), %rax
+	QUAD $0x000000d0249c8b4c // movq	208(%rsp), %r11
+	WORD $0x894d; BYTE $0xfc // movq	%r15, %r12
+	QUAD $0x00000000bd148d4a // leaq	0(,%r15,4), %rdx
+	QUAD $0x0000019024948948 // movq	%rdx, 400(%rsp)
+	QUAD $0x000000e024948b48 // movq	224(%rsp), %rdx
+	LONG $0xe0af0f4d         // imulq	%r8, %r12
+	WORD $0x8948; BYTE $0xc6 // movq	%rax, %rsi
+	LONG $0x033c8d49         // leaq	(%r11,%rax), %rdi
+	WORD $0x894c; BYTE $0xdb // movq	%r11, %rbx
+	QUAD $0x000001702484894c // movq	%r8, 368(%rsp)
+	LONG $0xf0af0f49         // imulq	%r8, %rsi
+	QUAD $0x0000012024bc8948 // movq	%rdi, 288(%rsp)
+	QUAD $0x0000017824ac8b4c // movq	376(%rsp), %r13
+	LONG $0xd8af0f49         // imulq	%r8, %rbx
+	LONG $0xa6148d4f         // leaq	(%r14,%r12,4), %r10
+	QUAD $0x0000015824b48948 // movq	%rsi, 344(%rsp)
+	WORD $0x8948; BYTE $0xc6 // movq	%rax, %rsi
+	LONG $0xf8478d49         // leaq	-8(%r15), %rax
+	LONG $0x03e8c148         // shrq	$3, %rax
+	QUAD $0x00000150249c8948 // movq	%rbx, 336(%rsp)
+	QUAD $0x00000008c5048d48 // leaq	8(,%rax,8), %rax
+	QUAD $0x0000018824848948 // movq	%rax, 392(%rsp)
+	WORD $0x8948; BYTE $0xf0 // movq	%rsi, %rax
+	WORD $0xf748; BYTE $0xd8 // negq	%rax
+	LONG $0x82048d48         // leaq	(%rdx,%rax,4), %rax
+	QUAD $0x00000000b5148d48 // leaq	0(,%rsi,4), %rdx
+	QUAD $0x000000d824b48b48 // movq	216(%rsp), %rsi
+	QUAD $0x0000013824848948 // movq	%rax, 312(%rsp)
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	WORD $0x2948; BYTE $0xd1 // subq	%rdx, %rcx
+	WORD $0xf748; BYTE $0xd8 // negq	%rax
+	QUAD $0x00000118248c8948 // movq	%rcx, 280(%rsp)
+	WORD $0x8948; BYTE $0xf9 // movq	%rdi, %rcx
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	QUAD $0x0000014024848948 // movq	%rax, 320(%rsp)
+	LONG $0x18458b48         // movq	24(%rbp), %rax
+	WORD $0x2948; BYTE $0xd0 // subq	%rdx, %rax
+	QUAD $0x000000009d148d4a // leaq	0(,%r11,4), %rdx
+	WORD $0x2948; BYTE $0xd0 // subq	%rdx, %rax
+	WORD $0x3949; BYTE $0xf9 // cmpq	%rdi, %r9
+	WORD $0x894c; BYTE $0xd2 // movq	%r10, %rdx
+	LONG $0xc94e0f49         // cmovle	%r9, %rcx
+	QUAD $0x0000010824848948 // movq	%rax, 264(%rsp)
+	QUAD $0x00000180248c8948 // movq	%rcx, 384(%rsp)
+
+BB0_55:
+	QUAD $0x0000012024bc8348; BYTE $0x00 // cmpq	$0, 288(%rsp)
+	JG   BB0_38
+	QUAD $0x0000015024848b48             // movq	336(%rsp), %rax
+	QUAD $0x00000158249c8b48             // movq	344(%rsp), %rbx
+	WORD $0xf631                         // xorl	%esi, %esi
+	QUAD $0x0000000085048d48             // leaq	0(,%rax,4), %rax
+	QUAD $0x000000009d0c8d4c             // leaq	0(,%rbx,4), %r9
+
+BB0_39:
+	QUAD $0x00000108249c8b48     // movq	264(%rsp), %rbx
+	WORD $0x894d; BYTE $0xfa     // movq	%r15, %r10
+	LONG $0xd6af0f4c             // imulq	%rsi, %r10
+	WORD $0x0148; BYTE $0xd8     // addq	%rbx, %rax
+	QUAD $0x0000017824848948     // movq	%rax, 376(%rsp)
+	LONG $0x24448b48; BYTE $0x60 // movq	96(%rsp), %rax
+	LONG $0x957c8d4b; BYTE $0x00 // leaq	0(%r13,%r10,4), %rdi
+	WORD $0x014c; BYTE $0xc8     // addq	%r9, %rax
+	QUAD $0x0000016024848948     // movq	%rax, 352(%rsp)
+
+BB0_69:
+	LONG $0x07ff8349             // cmpq	$7, %r15
+	JLE  BB0_79
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_57:
+	LONG $0x7c10fcc5; WORD $0xe082             // vmovups	-32(%rdx,%rax,4), %ymm7
+	LONG $0xb845e2c4; WORD $0x8744; BYTE $0xe0 // vfmadd231ps	-32(%rdi,%rax,4), %ymm7, %ymm0
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x3949; BYTE $0xc7                   // cmpq	%rax, %r15
+	JGE  BB0_57
+	QUAD $0x00000188248c8b48                   // movq	392(%rsp), %rcx
+
+BB0_56:
+	LONG $0x197de3c4; WORD $0x01c1 // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc958f8c5               // vaddps	%xmm1, %xmm0, %xmm1
+	LONG $0xc112f0c5               // vmovhlps	%xmm1, %xmm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xcf       // cmpq	%rcx, %r15
+	JLE  BB0_58
+	WORD $0x894d; BYTE $0xf8       // movq	%r15, %r8
+	QUAD $0x00000198248c8948       // movq	%rcx, 408(%rsp)
+	WORD $0x2949; BYTE $0xc8       // subq	%rcx, %r8
+	LONG $0xff408d49               // leaq	-1(%r8), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_80
+	LONG $0x21048d4a               // leaq	(%rcx,%r12), %rax
+	WORD $0x894d; BYTE $0xc1       // movq	%r8, %r9
+	LONG $0x861c8d49               // leaq	(%r14,%rax,4), %rbx
+	LONG $0x03e9c149               // shrq	$3, %r9
+	LONG $0x11048d4a               // leaq	(%rcx,%r10), %rax
+	LONG $0x855c8d4d; BYTE $0x00   // leaq	0(%r13,%rax,4), %r11
+	LONG $0x05e1c149               // salq	$5, %r9
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_60:
+	LONG $0x3c10fcc5; BYTE $0x03   // vmovups	(%rbx,%rax), %ymm7
+	LONG $0x5944c1c4; WORD $0x0314 // vmulps	(%r11,%rax), %ymm7, %ymm2
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xc058eac5               // vaddss	%xmm0, %xmm2, %xmm0
+	LONG $0xcac6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xdac6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xca15e8c5               // vunpckhps	%xmm2, %xmm2, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xc358fac5               // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc8       // cmpq	%r9, %rax
+	JNE  BB0_60
+	WORD $0x894c; BYTE $0xc0       // movq	%r8, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0x07c0f641               // testb	$7, %r8b
+	JE   BB0_58
+
+BB0_59:
+	WORD $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG $0xff488d4d                           // leaq	-1(%r8), %r9
+	LONG $0x02f98349                           // cmpq	$2, %r9
+	JBE  BB0_63
+	QUAD $0x00000198249c8b48                   // movq	408(%rsp), %rbx
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x100c8d4e                           // leaq	(%rax,%r10), %r9
+	WORD $0x014c; BYTE $0xe0                   // addq	%r12, %rax
+	LONG $0x1078c1c4; WORD $0x860c             // vmovups	(%r14,%rax,4), %xmm1
+	LONG $0x597081c4; WORD $0x8d4c; BYTE $0x00 // vmulps	0(%r13,%r9,4), %xmm1, %xmm1
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	LONG $0xfce08348                           // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x03e08341                           // andl	$3, %r8d
+	LONG $0xc058f2c5                           // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_58
+
+BB0_63:
+	LONG $0x11048d4a                           // leaq	(%rcx,%r10), %rax
+	LONG $0x0c048d4d                           // leaq	(%r12,%rcx), %r8
+	LONG $0x107a81c4; WORD $0x862c             // vmovss	(%r14,%r8,4), %xmm5
+	LONG $0xb951c2c4; WORD $0x8544; BYTE $0x00 // vfmadd231ss	0(%r13,%rax,4), %xmm5, %xmm0
+	LONG $0x01418d48                           // leaq	1(%rcx), %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JGE  BB0_58
+	LONG $0x20048d4e                           // leaq	(%rax,%r12), %r8
+	LONG $0x02c18348                           // addq	$2, %rcx
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+	LONG $0x107a81c4; WORD $0x862c             // vmovss	(%r14,%r8,4), %xmm5
+	LONG $0xb951c2c4; WORD $0x8544; BYTE $0x00 // vfmadd231ss	0(%r13,%rax,4), %xmm5, %xmm0
+	WORD $0x394c; BYTE $0xf9                   // cmpq	%r15, %rcx
+	JGE  BB0_58
+	LONG $0x21048d4a                           // leaq	(%rcx,%r12), %rax
+	WORD $0x014c; BYTE $0xd1                   // addq	%r10, %rcx
+	LONG $0x107ac1c4; WORD $0x862c             // vmovss	(%r14,%rax,4), %xmm5
+	LONG $0xb951c2c4; WORD $0x8d44; BYTE $0x00 // vfmadd231ss	0(%r13,%rcx,4), %xmm5, %xmm0
+
+BB0_58:
+	QUAD $0x0000016824b43948     // cmpq	%rsi, 360(%rsp)
+	JLE  BB0_65
+	QUAD $0x0000011024848b48     // movq	272(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_66
+	LONG $0x0458fac5; BYTE $0xb0 // vaddss	(%rax,%rsi,4), %xmm0, %xmm0
+
+BB0_66:
+	QUAD $0x0000016024848b48     // movq	352(%rsp), %rax
+	LONG $0x0411fac5; BYTE $0xb0 // vmovss	%xmm0, (%rax,%rsi,4)
+
+BB0_67:
+	QUAD $0x0000019024848b48 // movq	400(%rsp), %rax
+	LONG $0x01c68348         // addq	$1, %rsi
+	WORD $0x014d; BYTE $0xfa // addq	%r15, %r10
+	WORD $0x0148; BYTE $0xc7 // addq	%rax, %rdi
+	QUAD $0x0000014824b43948 // cmpq	%rsi, 328(%rsp)
+	JG   BB0_69
+
+BB0_70:
+	QUAD $0x00000190249c8b48             // movq	400(%rsp), %rbx
+	QUAD $0x000000d0248c8b48             // movq	208(%rsp), %rcx
+	WORD $0x014d; BYTE $0xfc             // addq	%r15, %r12
+	QUAD $0x0000017024848348; BYTE $0x01 // addq	$1, 368(%rsp)
+	QUAD $0x0000017024848b48             // movq	368(%rsp), %rax
+	QUAD $0x00000150248c0148             // addq	%rcx, 336(%rsp)
+	WORD $0x0148; BYTE $0xda             // addq	%rbx, %rdx
+	QUAD $0x00000168248c8b48             // movq	360(%rsp), %rcx
+	QUAD $0x00000158248c0148             // addq	%rcx, 344(%rsp)
+	QUAD $0x0000009824843948             // cmpq	%rax, 152(%rsp)
+	JNE  BB0_55
+
+BB0_143:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x50a58d48; WORD $0xfffe; BYTE $0xff // leaq	-432(%rbp), %rsp
+	RET
+
+BB0_30:
+	QUAD $0x000000d824bc8348; BYTE $0x00 // cmpq	$0, 216(%rsp)
+	JE   BB0_33
+	QUAD $0x0000009024848b48             // movq	144(%rsp), %rax
+	LONG $0x107aa1c4; WORD $0x800c       // vmovss	(%rax,%r8,4), %xmm1
+	LONG $0xe158dac5                     // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0xd958e2c5                     // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0xd158eac5                     // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xc158fac5                     // vaddss	%xmm1, %xmm0, %xmm0
+
+BB0_33:
+	QUAD $0x0000012824848b48     // movq	296(%rsp), %rax
+	QUAD $0x000000d024948b48     // movq	208(%rsp), %rdx
+	LONG $0x2011fac5             // vmovss	%xmm4, (%rax)
+	LONG $0x1c11fac5; BYTE $0x90 // vmovss	%xmm3, (%rax,%rdx,4)
+	QUAD $0x000000c824948b48     // movq	200(%rsp), %rdx
+	LONG $0x1411fac5; BYTE $0x90 // vmovss	%xmm2, (%rax,%rdx,4)
+	QUAD $0x000000c024948b48     // movq	192(%rsp), %rdx
+	LONG $0x0411fac5; BYTE $0x90 // vmovss	%xmm0, (%rax,%rdx,4)
+	JMP  BB0_32
+
+BB0_15:
+	QUAD $0x000000e024bc8348; BYTE $0x00 // cmpq	$0, 224(%rsp)
+	JE   BB0_18
+	QUAD $0x0000008824848b48             // movq	136(%rsp), %rax
+	LONG $0x107aa1c4; WORD $0x9014       // vmovss	(%rax,%r10,4), %xmm2
+	LONG $0xe258dac5                     // vaddss	%xmm2, %xmm4, %xmm4
+	LONG $0xda58e2c5                     // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xc258fac5                     // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xca58f2c5                     // vaddss	%xmm2, %xmm1, %xmm1
+
+BB0_18:
+	QUAD $0x0000011824848b48       // movq	280(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x9024 // vmovss	%xmm4, (%rax,%r10,4)
+	QUAD $0x000000c824848b48       // movq	200(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x901c // vmovss	%xmm3, (%rax,%r10,4)
+	QUAD $0x000000c024848b48       // movq	192(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x9004 // vmovss	%xmm0, (%rax,%r10,4)
+	QUAD $0x000000b824848b48       // movq	184(%rsp), %rax
+	LONG $0x117aa1c4; WORD $0x900c // vmovss	%xmm1, (%rax,%r10,4)
+	JMP  BB0_17
+
+BB0_65:
+	QUAD $0x000000d824bc8348; BYTE $0x00 // cmpq	$0, 216(%rsp)
+	JE   BB0_68
+	QUAD $0x0000014024848b48             // movq	320(%rsp), %rax
+	LONG $0x0458fac5; BYTE $0xb0         // vaddss	(%rax,%rsi,4), %xmm0, %xmm0
+
+BB0_68:
+	QUAD $0x0000017824848b48     // movq	376(%rsp), %rax
+	LONG $0x0411fac5; BYTE $0xb0 // vmovss	%xmm0, (%rax,%rsi,4)
+	JMP  BB0_67
+
+BB0_75:
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xd128fcc5 // vmovaps	%ymm1, %ymm2
+	LONG $0xd928fcc5 // vmovaps	%ymm1, %ymm3
+	LONG $0xe128fcc5 // vmovaps	%ymm1, %ymm4
+	JMP  BB0_21
+
+BB0_72:
+	QUAD $0x000000a824848b48     // movq	168(%rsp), %rax
+	LONG $0x245c8b48; BYTE $0x38 // movq	56(%rsp), %rbx
+	WORD $0x3145; BYTE $0xd2     // xorl	%r10d, %r10d
+	WORD $0x0148; BYTE $0xc3     // addq	%rax, %rbx
+	QUAD $0x00000108249c8948     // movq	%rbx, 264(%rsp)
+	LONG $0x245c8b48; BYTE $0x30 // movq	48(%rsp), %rbx
+	WORD $0x0148; BYTE $0xc3     // addq	%rax, %rbx
+	QUAD $0x00000100249c8948     // movq	%rbx, 256(%rsp)
+	LONG $0x245c8b48; BYTE $0x28 // movq	40(%rsp), %rbx
+	WORD $0x0148; BYTE $0xd8     // addq	%rbx, %rax
+	QUAD $0x000000f824848948     // movq	%rax, 248(%rsp)
+	JMP  BB0_5
+
+BB0_73:
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xd128fcc5 // vmovaps	%ymm1, %ymm2
+	LONG $0xd928fcc5 // vmovaps	%ymm1, %ymm3
+	LONG $0xe128fcc5 // vmovaps	%ymm1, %ymm4
+	JMP  BB0_6
+
+BB0_74:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_9
+
+BB0_76:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_24
+
+BB0_79:
+	WORD $0xc931     // xorl	%ecx, %ecx
+	LONG $0xc057f8c5 // vxorps	%xmm0, %xmm0, %xmm0
+	JMP  BB0_56
+
+BB0_38:
+	QUAD $0x0000015024848b48     // movq	336(%rsp), %rax
+	WORD $0x894c; BYTE $0xef     // movq	%r13, %rdi
+	WORD $0x3145; BYTE $0xd2     // xorl	%r10d, %r10d
+	WORD $0xf631                 // xorl	%esi, %esi
+	QUAD $0x00000118249c8b48     // movq	280(%rsp), %rbx
+	LONG $0x02e0c148             // salq	$2, %rax
+	WORD $0x0148; BYTE $0xc3     // addq	%rax, %rbx
+	QUAD $0x0000012824848948     // movq	%rax, 296(%rsp)
+	QUAD $0x00000160249c8948     // movq	%rbx, 352(%rsp)
+	QUAD $0x00000158249c8b48     // movq	344(%rsp), %rbx
+	QUAD $0x000000009d0c8d4c     // leaq	0(,%rbx,4), %r9
+	LONG $0x245c8b48; BYTE $0x60 // movq	96(%rsp), %rbx
+	QUAD $0x00000130248c894c     // movq	%r9, 304(%rsp)
+	WORD $0x014c; BYTE $0xcb     // addq	%r9, %rbx
+	QUAD $0x00000178249c8948     // movq	%rbx, 376(%rsp)
+
+BB0_54:
+	LONG $0x07ff8349             // cmpq	$7, %r15
+	JLE  BB0_77
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_42:
+	LONG $0x7c10fcc5; WORD $0xe082             // vmovups	-32(%rdx,%rax,4), %ymm7
+	LONG $0xb845e2c4; WORD $0x874c; BYTE $0xe0 // vfmadd231ps	-32(%rdi,%rax,4), %ymm7, %ymm1
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_42
+	QUAD $0x00000188248c8b48                   // movq	392(%rsp), %rcx
+
+BB0_41:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xcf       // cmpq	%rcx, %r15
+	JLE  BB0_43
+	WORD $0x894d; BYTE $0xf8       // movq	%r15, %r8
+	QUAD $0x00000198248c8948       // movq	%rcx, 408(%rsp)
+	WORD $0x2949; BYTE $0xc8       // subq	%rcx, %r8
+	LONG $0xff408d49               // leaq	-1(%r8), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_78
+	LONG $0x21048d4a               // leaq	(%rcx,%r12), %rax
+	WORD $0x894d; BYTE $0xc1       // movq	%r8, %r9
+	LONG $0x861c8d49               // leaq	(%r14,%rax,4), %rbx
+	LONG $0x03e9c149               // shrq	$3, %r9
+	LONG $0x11048d4a               // leaq	(%rcx,%r10), %rax
+	LONG $0x855c8d4d; BYTE $0x00   // leaq	0(%r13,%rax,4), %r11
+	LONG $0x05e1c149               // salq	$5, %r9
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_45:
+	LONG $0x107cc1c4; WORD $0x032c // vmovups	(%r11,%rax), %ymm5
+	LONG $0x1459d4c5; BYTE $0x03   // vmulps	(%rbx,%rax), %ymm5, %ymm2
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xcac6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xdac6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xc215e8c5               // vunpckhps	%xmm2, %xmm2, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd858e2c5               // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f2c5               // vaddss	%xmm3, %xmm1, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc1       // cmpq	%rax, %r9
+	JNE  BB0_45
+	WORD $0x894c; BYTE $0xc0       // movq	%r8, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0x07c0f641               // testb	$7, %r8b
+	JE   BB0_43
+
+BB0_44:
+	WORD $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG $0xff488d4d                           // leaq	-1(%r8), %r9
+	LONG $0x02f98349                           // cmpq	$2, %r9
+	JBE  BB0_48
+	QUAD $0x00000198249c8b48                   // movq	408(%rsp), %rbx
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x200c8d4e                           // leaq	(%rax,%r12), %r9
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+	LONG $0x1078c1c4; WORD $0x854c; BYTE $0x00 // vmovups	0(%r13,%rax,4), %xmm1
+	LONG $0x597081c4; WORD $0x8e0c             // vmulps	(%r14,%r9,4), %xmm1, %xmm1
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	LONG $0xfce08348                           // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x03e08341                           // andl	$3, %r8d
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xd115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm2
+	LONG $0xc9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_43
+
+BB0_48:
+	LONG $0x21048d4a                           // leaq	(%rcx,%r12), %rax
+	LONG $0x11048d4e                           // leaq	(%rcx,%r10), %r8
+	LONG $0x107a81c4; WORD $0x856c; BYTE $0x00 // vmovss	0(%r13,%r8,4), %xmm5
+	LONG $0xb951c2c4; WORD $0x8604             // vfmadd231ss	(%r14,%rax,4), %xmm5, %xmm0
+	LONG $0x01418d48                           // leaq	1(%rcx), %rax
+	WORD $0x3949; BYTE $0xc7                   // cmpq	%rax, %r15
+	JLE  BB0_43
+	LONG $0x02048d4d                           // leaq	(%r10,%rax), %r8
+	LONG $0x02c18348                           // addq	$2, %rcx
+	WORD $0x014c; BYTE $0xe0                   // addq	%r12, %rax
+	LONG $0x107a81c4; WORD $0x856c; BYTE $0x00 // vmovss	0(%r13,%r8,4), %xmm5
+	LONG $0xb951c2c4; WORD $0x8604             // vfmadd231ss	(%r14,%rax,4), %xmm5, %xmm0
+	WORD $0x3949; BYTE $0xcf                   // cmpq	%rcx, %r15
+	JLE  BB0_43
+	LONG $0x0c048d49                           // leaq	(%r12,%rcx), %rax
+	WORD $0x014c; BYTE $0xd1                   // addq	%r10, %rcx
+	LONG $0x107ac1c4; WORD $0x863c             // vmovss	(%r14,%rax,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x8d44; BYTE $0x00 // vfmadd231ss	0(%r13,%rcx,4), %xmm7, %xmm0
+
+BB0_43:
+	QUAD $0x0000016824b43948     // cmpq	%rsi, 360(%rsp)
+	JLE  BB0_50
+	QUAD $0x0000011024848b48     // movq	272(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_51
+	LONG $0x0458fac5; BYTE $0xb0 // vaddss	(%rax,%rsi,4), %xmm0, %xmm0
+
+BB0_51:
+	QUAD $0x0000017824848b48     // movq	376(%rsp), %rax
+	LONG $0x0411fac5; BYTE $0xb0 // vmovss	%xmm0, (%rax,%rsi,4)
+
+BB0_52:
+	QUAD $0x0000019024848b48 // movq	400(%rsp), %rax
+	LONG $0x01c68348         // addq	$1, %rsi
+	WORD $0x014d; BYTE $0xfa // addq	%r15, %r10
+	WORD $0x0148; BYTE $0xc7 // addq	%rax, %rdi
+	QUAD $0x0000018024848b48 // movq	384(%rsp), %rax
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JL   BB0_54
+	QUAD $0x00000130248c8b4c // movq	304(%rsp), %r9
+	QUAD $0x0000012824848b48 // movq	296(%rsp), %rax
+	QUAD $0x0000014824b43948 // cmpq	%rsi, 328(%rsp)
+	JG   BB0_39
+	JMP  BB0_70
+
+BB0_50:
+	QUAD $0x000000e024bc8348; BYTE $0x00 // cmpq	$0, 224(%rsp)
+	JE   BB0_53
+	QUAD $0x0000013824848b48             // movq	312(%rsp), %rax
+	LONG $0x0458fac5; BYTE $0xb0         // vaddss	(%rax,%rsi,4), %xmm0, %xmm0
+
+BB0_53:
+	QUAD $0x0000016024848b48     // movq	352(%rsp), %rax
+	LONG $0x0411fac5; BYTE $0xb0 // vmovss	%xmm0, (%rax,%rsi,4)
+	JMP  BB0_52
+
+BB0_77:
+	WORD $0xc931     // xorl	%ecx, %ecx
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	JMP  BB0_41
+
+BB0_78:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_44
+
+BB0_80:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_59
+
+BB0_71:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_2
@@ -0,0 +1,1806 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baseqkvdense_c_f32_avx512_amd64.c
+
+TEXT ·qkvdense_c_f32_avx512(SB), $496-160
+	MOVQ x+0(FP), DI
+	MOVQ wQKV+8(FP), SI
+	MOVQ biasQ+16(FP), DX
+	MOVQ biasK+24(FP), CX
+	MOVQ biasV+32(FP), R8
+	MOVQ q+40(FP), R9
+	MOVQ k+48(FP), R11
+	MOVQ R11, 384(SP)
+	MOVQ v+56(FP), R11
+	MOVQ R11, 392(SP)
+	MOVQ pbatchSize+64(FP), R11
+	MOVQ R11, 400(SP)
+	MOVQ pinFeatures+72(FP), R11
+	MOVQ R11, 408(SP)
+	MOVQ pqDim+80(FP), R11
+	MOVQ R11, 416(SP)
+	MOVQ pkvDim+88(FP), R11
+	MOVQ R11, 424(SP)
+	MOVQ plen_x+96(FP), R11
+	MOVQ R11, 432(SP)
+	MOVQ plen_wQKV+104(FP), R11
+	MOVQ R11, 440(SP)
+	MOVQ plen_biasQ+112(FP), R11
+	MOVQ R11, 448(SP)
+	MOVQ plen_biasK+120(FP), R11
+	MOVQ R11, 456(SP)
+	MOVQ plen_biasV+128(FP), R11
+	MOVQ R11, 464(SP)
+	MOVQ plen_q+136(FP), R11
+	MOVQ R11, 472(SP)
+	MOVQ plen_k+144(FP), R11
+	MOVQ R11, 480(SP)
+	MOVQ plen_v+152(FP), R11
+	MOVQ R11, 488(SP)
+	LONG $0x6ef961c4; BYTE $0xd2               // vmovq	%rdx, %xmm10
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	LONG $0x6ef9c1c4; BYTE $0xf8               // vmovq	%r8, %xmm7
+	LONG $0x6ef941c4; BYTE $0xc1               // vmovq	%r9, %xmm8
+	QUAD $0x0000017024ac8d48                   // leaq	368(%rsp), %rbp
+	WORD $0x8949; BYTE $0xf7                   // movq	%rsi, %r15
+	LONG $0x24648d48; BYTE $0x40               // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348                           // andq	$-64, %rsp
+	LONG $0x20558b48                           // movq	32(%rbp), %rdx
+	LONG $0x105d8b4c                           // movq	16(%rbp), %r11
+	QUAD $0x000000c8248c8948                   // movq	%rcx, 200(%rsp)
+	LONG $0x384d8b48                           // movq	56(%rbp), %rcx
+	WORD $0x8b48; BYTE $0x1a                   // movq	(%rdx), %rbx
+	LONG $0x28558b48                           // movq	40(%rbp), %rdx
+	WORD $0x8b4c; BYTE $0x29                   // movq	(%rcx), %r13
+	LONG $0x304d8b48                           // movq	48(%rbp), %rcx
+	QUAD $0x00000080249c8948                   // movq	%rbx, 128(%rsp)
+	WORD $0x8b48; BYTE $0x12                   // movq	(%rdx), %rdx
+	WORD $0x8b48; BYTE $0x39                   // movq	(%rcx), %rdi
+	LONG $0x2d4c8d4b; BYTE $0x00               // leaq	(%r13,%r13), %rcx
+	QUAD $0x000000b824ac894c                   // movq	%r13, 184(%rsp)
+	LONG $0x39148d4c                           // leaq	(%rcx,%rdi), %r10
+	QUAD $0x0000011024bc8948                   // movq	%rdi, 272(%rsp)
+	QUAD $0x000000f02494894c                   // movq	%r10, 240(%rsp)
+	LONG $0x03fb8348                           // cmpq	$3, %rbx
+	JLE  BB0_71
+	LONG $0x290c8d4e                           // leaq	(%rcx,%r13), %r9
+	QUAD $0x00000000ad348d4a                   // leaq	0(,%r13,4), %rsi
+	QUAD $0x00000090248c8948                   // movq	%rcx, 144(%rsp)
+	WORD $0x8948; BYTE $0xc3                   // movq	%rax, %rbx
+	QUAD $0x00000088248c894c                   // movq	%r9, 136(%rsp)
+	WORD $0x8949; BYTE $0xf9                   // movq	%rdi, %r9
+	QUAD $0x00000000bd048d4c                   // leaq	0(,%rdi,4), %r8
+	QUAD $0x00000000953c8d48                   // leaq	0(,%rdx,4), %rdi
+	WORD $0x894d; BYTE $0xca                   // movq	%r9, %r10
+	LONG $0x6ef961c4; BYTE $0xcf               // vmovq	%rdi, %xmm9
+	LONG $0x123c8d48                           // leaq	(%rdx,%rdx), %rdi
+	QUAD $0x0000013824948948                   // movq	%rdx, 312(%rsp)
+	LONG $0x04e2c149                           // salq	$4, %r10
+	LONG $0x7ef941c4; BYTE $0xce               // vmovq	%xmm9, %r14
+	QUAD $0x0000012824bc8948                   // movq	%rdi, 296(%rsp)
+	WORD $0x0148; BYTE $0xd7                   // addq	%rdx, %rdi
+	LONG $0x2454894c; BYTE $0x50               // movq	%r10, 80(%rsp)
+	WORD $0x894d; BYTE $0xea                   // movq	%r13, %r10
+	LONG $0x04e5c149                           // salq	$4, %r13
+	LONG $0x246c894c; BYTE $0x48               // movq	%r13, 72(%rsp)
+	WORD $0x894d; BYTE $0xd5                   // movq	%r10, %r13
+	WORD $0x894d; BYTE $0xca                   // movq	%r9, %r10
+	WORD $0x014d; BYTE $0xe9                   // addq	%r13, %r9
+	WORD $0x294d; BYTE $0xd5                   // subq	%r10, %r13
+	QUAD $0x0000012024bc8948                   // movq	%rdi, 288(%rsp)
+	WORD $0x8948; BYTE $0xd7                   // movq	%rdx, %rdi
+	WORD $0x894d; BYTE $0xcc                   // movq	%r9, %r12
+	LONG $0x244c894c; BYTE $0x60               // movq	%r9, 96(%rsp)
+	LONG $0xf04a8d4c                           // leaq	-16(%rdx), %r9
+	LONG $0xab2c8d4f                           // leaq	(%r11,%r13,4), %r13
+	LONG $0xf0e18349                           // andq	$-16, %r9
+	LONG $0x08fdc162; WORD $0xfd6e             // vmovq	%r13, %xmm23
+	QUAD $0x0000009024ac8b4c                   // movq	144(%rsp), %r13
+	LONG $0x04e7c148                           // salq	$4, %rdi
+	LONG $0x10c18349                           // addq	$16, %r9
+	LONG $0x247c8948; BYTE $0x58               // movq	%rdi, 88(%rsp)
+	LONG $0x303c8d4a                           // leaq	(%rax,%r14), %rdi
+	LONG $0x08fd3162; WORD $0xef6f             // vmovdqa64	%xmm23, %xmm13
+	QUAD $0x000000e8248c894c                   // movq	%r9, 232(%rsp)
+	WORD $0x294d; BYTE $0xd5                   // subq	%r10, %r13
+	LONG $0x370c8d4a                           // leaq	(%rdi,%r14), %rcx
+	QUAD $0x000000c8248c8b4c                   // movq	200(%rsp), %r9
+	LONG $0xab2c8d4f                           // leaq	(%r11,%r13,4), %r13
+	WORD $0x0149; BYTE $0xce                   // addq	%rcx, %r14
+	QUAD $0x000000682444c748; BYTE $0x00       // movq	$0, 104(%rsp)
+	WORD $0x294d; BYTE $0xc1                   // subq	%r8, %r9
+	LONG $0x08fd4162; WORD $0xd56e             // vmovq	%r13, %xmm26
+	LONG $0x7ef9c1c4; BYTE $0xfd               // vmovq	%xmm7, %r13
+	QUAD $0x000000a02484c748; LONG $0x00000000 // movq	$0, 160(%rsp)
+	LONG $0x244c894c; BYTE $0x78               // movq	%r9, 120(%rsp)
+	WORD $0x894d; BYTE $0xd9                   // movq	%r11, %r9
+	LONG $0x08fd1162; WORD $0xe26f             // vmovdqa64	%xmm26, %xmm12
+	WORD $0x294d; BYTE $0xc1                   // subq	%r8, %r9
+	QUAD $0x0000009824b48948                   // movq	%rsi, 152(%rsp)
+	LONG $0x244c894c; BYTE $0x38               // movq	%r9, 56(%rsp)
+	QUAD $0x00000088248c8b4c                   // movq	136(%rsp), %r9
+	QUAD $0x000001302484c748; LONG $0x00000000 // movq	$0, 304(%rsp)
+	QUAD $0x000000702444c748; BYTE $0x00       // movq	$0, 112(%rsp)
+	WORD $0x294d; BYTE $0xd1                   // subq	%r10, %r9
+	LONG $0x8b0c8d4f                           // leaq	(%r11,%r9,4), %r9
+	LONG $0x08fd4162; WORD $0xc96e             // vmovq	%r9, %xmm25
+	LONG $0x7ef941c4; BYTE $0xc1               // vmovq	%xmm8, %r9
+	WORD $0x014d; BYTE $0xc8                   // addq	%r9, %r8
+	LONG $0x08fd1162; WORD $0xd96f             // vmovdqa64	%xmm25, %xmm11
+	LONG $0x2444894c; BYTE $0x40               // movq	%r8, 64(%rsp)
+	LONG $0xd1048d4f                           // leaq	(%r9,%r10,8), %r8
+	LONG $0x08fdc162; WORD $0xf06e             // vmovq	%r8, %xmm22
+	LONG $0x52048d4f                           // leaq	(%r10,%r10,2), %r8
+	QUAD $0x000000f024948b4c                   // movq	240(%rsp), %r10
+	LONG $0x81048d4f                           // leaq	(%r9,%r8,4), %r8
+	WORD $0x894d; BYTE $0xe1                   // movq	%r12, %r9
+	LONG $0x08fdc162; WORD $0xe86e             // vmovq	%r8, %xmm21
+	WORD $0x894d; BYTE $0xe0                   // movq	%r12, %r8
+	LONG $0x0003bc41; WORD $0x0000             // movl	$3, %r12d
+	WORD $0xf749; BYTE $0xd8                   // negq	%r8
+	WORD $0x394d; BYTE $0xca                   // cmpq	%r9, %r10
+	QUAD $0x000000c024a4894c                   // movq	%r12, 192(%rsp)
+	QUAD $0x0000012024a48b4c                   // movq	288(%rsp), %r12
+	LONG $0x85448d4f; BYTE $0x00               // leaq	0(%r13,%r8,4), %r8
+	QUAD $0x0000012024bc894c                   // movq	%r15, 288(%rsp)
+	LONG $0x08fdc162; WORD $0xe06e             // vmovq	%r8, %xmm20
+	WORD $0x894d; BYTE $0xc8                   // movq	%r9, %r8
+	LONG $0xc24e0f4d                           // cmovle	%r10, %r8
+	LONG $0x6ef941c4; BYTE $0xf0               // vmovq	%r8, %xmm14
+
+BB0_4:
+	QUAD $0x000000f024bc8348; BYTE $0x00 // cmpq	$0, 240(%rsp)
+	JLE  BB0_20
+	LONG $0x247c8348; WORD $0x0060       // cmpq	$0, 96(%rsp)
+	JLE  BB0_72
+	LONG $0x24748b48; BYTE $0x68         // movq	104(%rsp), %rsi
+	LONG $0x247c8b4c; BYTE $0x38         // movq	56(%rsp), %r15
+	LONG $0x7ef941c4; BYTE $0xc0         // vmovq	%xmm8, %r8
+	QUAD $0x00000100248c8948             // movq	%rcx, 256(%rsp)
+	QUAD $0x0000012024ac8b4c             // movq	288(%rsp), %r13
+	WORD $0x3145; BYTE $0xd2             // xorl	%r10d, %r10d
+	WORD $0x0149; BYTE $0xf7             // addq	%rsi, %r15
+	LONG $0x08fd4162; WORD $0xef6e       // vmovq	%r15, %xmm29
+	LONG $0x7ef941c4; BYTE $0xef         // vmovq	%xmm13, %r15
+	WORD $0x0149; BYTE $0xf7             // addq	%rsi, %r15
+	LONG $0x08fd1162; WORD $0xfd6f       // vmovdqa64	%xmm29, %xmm15
+	LONG $0x08fd4162; WORD $0xe76e       // vmovq	%r15, %xmm28
+	LONG $0x7ef941c4; BYTE $0xe7         // vmovq	%xmm12, %r15
+	WORD $0x0149; BYTE $0xf7             // addq	%rsi, %r15
+	LONG $0x08fd8162; WORD $0xc46f       // vmovdqa64	%xmm28, %xmm16
+	LONG $0x08fd4162; WORD $0xdf6e       // vmovq	%r15, %xmm27
+	LONG $0x7ef941c4; BYTE $0xdf         // vmovq	%xmm11, %r15
+	WORD $0x014c; BYTE $0xfe             // addq	%r15, %rsi
+	LONG $0x247c8b4c; BYTE $0x40         // movq	64(%rsp), %r15
+	LONG $0x08fde162; WORD $0xde6e       // vmovq	%rsi, %xmm19
+	QUAD $0x000000a024b48b48             // movq	160(%rsp), %rsi
+	WORD $0x0149; BYTE $0xf7             // addq	%rsi, %r15
+	LONG $0x08fdc162; WORD $0xcf6e       // vmovq	%r15, %xmm17
+	LONG $0x08fdc162; WORD $0xf77e       // vmovq	%xmm22, %r15
+	WORD $0x0149; BYTE $0xf7             // addq	%rsi, %r15
+	LONG $0x08fdc162; WORD $0xff6e       // vmovq	%r15, %xmm23
+	LONG $0x08fdc162; WORD $0xef7e       // vmovq	%xmm21, %r15
+	WORD $0x0149; BYTE $0xf7             // addq	%rsi, %r15
+	WORD $0x014c; BYTE $0xc6             // addq	%r8, %rsi
+	LONG $0x08fd4162; WORD $0xd76e       // vmovq	%r15, %xmm26
+	LONG $0x08fde162; WORD $0xd66e       // vmovq	%rsi, %xmm18
+	WORD $0x3145; BYTE $0xff             // xorl	%r15d, %r15d
+
+BB0_19:
+	LONG $0x0ffa8348               // cmpq	$15, %rdx
+	JLE  BB0_73
+	LONG $0xe457d8c5               // vxorps	%xmm4, %xmm4, %xmm4
+	QUAD $0x00000100248c8b48       // movq	256(%rsp), %rcx
+	LONG $0x000010be; BYTE $0x00   // movl	$16, %esi
+	LONG $0x487cf162; WORD $0xdc28 // vmovaps	%zmm4, %zmm3
+	LONG $0x487cf162; WORD $0xd428 // vmovaps	%zmm4, %zmm2
+	LONG $0x487cf162; WORD $0xcc28 // vmovaps	%zmm4, %zmm1
+
+BB0_7:
+	QUAD $0xffb54410487cd162       // vmovups	-64(%r13,%rsi,4), %zmm0
+	QUAD $0xffb34cb8487df262       // vfmadd231ps	-64(%rbx,%rsi,4), %zmm0, %zmm1
+	QUAD $0xffb754b8487df262       // vfmadd231ps	-64(%rdi,%rsi,4), %zmm0, %zmm2
+	QUAD $0xffb15cb8487df262       // vfmadd231ps	-64(%rcx,%rsi,4), %zmm0, %zmm3
+	QUAD $0xffb664b8487dd262       // vfmadd231ps	-64(%r14,%rsi,4), %zmm0, %zmm4
+	LONG $0x10c68348               // addq	$16, %rsi
+	WORD $0x3948; BYTE $0xd6       // cmpq	%rdx, %rsi
+	JLE  BB0_7
+	QUAD $0x00000100248c8948       // movq	%rcx, 256(%rsp)
+	QUAD $0x000000e824848b4c       // movq	232(%rsp), %r8
+	LONG $0x48fdf162; WORD $0xc328 // vmovapd	%zmm3, %zmm0
+
+BB0_6:
+	LONG $0x48fdf362; WORD $0xcb1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm3
+	LONG $0xc958e4c5                           // vaddps	%ymm1, %ymm3, %ymm1
+	LONG $0x197de3c4; WORD $0x01cb             // vextractf128	$0x1, %ymm1, %xmm3
+	LONG $0xd958e0c5                           // vaddps	%xmm1, %xmm3, %xmm3
+	LONG $0x0479e3c4; WORD $0x4ecb             // vpermilps	$78, %xmm3, %xmm1
+	LONG $0xcb58f0c5                           // vaddps	%xmm3, %xmm1, %xmm1
+	LONG $0xd928f8c5                           // vmovaps	%xmm1, %xmm3
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0x48fdf362; WORD $0xd11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm1
+	LONG $0xca58f4c5                           // vaddps	%ymm2, %ymm1, %ymm1
+	LONG $0x197de3c4; WORD $0x01ca             // vextractf128	$0x1, %ymm1, %xmm2
+	LONG $0xd158e8c5                           // vaddps	%xmm1, %xmm2, %xmm2
+	LONG $0x0479e3c4; WORD $0x4eca             // vpermilps	$78, %xmm2, %xmm1
+	LONG $0xca58f0c5                           // vaddps	%xmm2, %xmm1, %xmm1
+	LONG $0xd128f8c5                           // vmovaps	%xmm1, %xmm2
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f4c5                           // vaddps	%ymm0, %ymm1, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0x0479e3c4; WORD $0x4ec1             // vpermilps	$78, %xmm1, %xmm0
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc828f8c5                           // vmovaps	%xmm0, %xmm1
+	LONG $0xc0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm0
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0x48fdf362; WORD $0xe01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm0
+	LONG $0xc458fcc5                           // vaddps	%ymm4, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c4             // vextractf128	$0x1, %ymm0, %xmm4
+	LONG $0xc058d8c5                           // vaddps	%xmm0, %xmm4, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ee0             // vpermilps	$78, %xmm0, %xmm4
+	LONG $0xe058d8c5                           // vaddps	%xmm0, %xmm4, %xmm4
+	LONG $0xc428f8c5                           // vmovaps	%xmm4, %xmm0
+	LONG $0xe4c6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm4
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_8
+	WORD $0x8948; BYTE $0xd6                   // movq	%rdx, %rsi
+	QUAD $0x000001082484894c                   // movq	%r8, 264(%rsp)
+	WORD $0x294c; BYTE $0xc6                   // subq	%r8, %rsi
+	QUAD $0x0000011824b48948                   // movq	%rsi, 280(%rsp)
+	LONG $0x01ee8348                           // subq	$1, %rsi
+	LONG $0x0efe8348                           // cmpq	$14, %rsi
+	JBE  BB0_74
+	QUAD $0x00000130248c8b48                   // movq	304(%rsp), %rcx
+	QUAD $0x000000d024848948                   // movq	%rax, 208(%rsp)
+	QUAD $0x000000e024948948                   // movq	%rdx, 224(%rsp)
+	LONG $0x08348d49                           // leaq	(%r8,%rcx), %rsi
+	QUAD $0x000000d824bc8948                   // movq	%rdi, 216(%rsp)
+	LONG $0xb00c8d48                           // leaq	(%rax,%rsi,4), %rcx
+	LONG $0x38348d4b                           // leaq	(%r8,%r15), %rsi
+	LONG $0x08fd6162; WORD $0xf16e             // vmovq	%rcx, %xmm30
+	QUAD $0x00000120248c8b48                   // movq	288(%rsp), %rcx
+	LONG $0x08fd6162; WORD $0xf27e             // vmovq	%xmm30, %rdx
+	LONG $0xb10c8d4c                           // leaq	(%rcx,%rsi,4), %r9
+	QUAD $0x00000138248c8b48                   // movq	312(%rsp), %rcx
+	LONG $0x08348d49                           // leaq	(%r8,%rcx), %rsi
+	LONG $0xb00c8d48                           // leaq	(%rax,%rsi,4), %rcx
+	LONG $0x08fd6162; WORD $0xe16e             // vmovq	%rcx, %xmm28
+	QUAD $0x00000128248c8b48                   // movq	296(%rsp), %rcx
+	LONG $0x08348d49                           // leaq	(%r8,%rcx), %rsi
+	LONG $0xb00c8d48                           // leaq	(%rax,%rsi,4), %rcx
+	LONG $0x20348d4b                           // leaq	(%r8,%r12), %rsi
+	LONG $0xb01c8d4c                           // leaq	(%rax,%rsi,4), %r11
+	QUAD $0x0000011824b48b48                   // movq	280(%rsp), %rsi
+	WORD $0x894c; BYTE $0xdf                   // movq	%r11, %rdi
+	LONG $0x08fd4162; WORD $0xe37e             // vmovq	%xmm28, %r11
+	LONG $0x04eec148                           // shrq	$4, %rsi
+	LONG $0x06e6c148                           // salq	$6, %rsi
+	QUAD $0x000000f824b48948                   // movq	%rsi, 248(%rsp)
+	QUAD $0x000000f824848b48                   // movq	248(%rsp), %rax
+	WORD $0xf631                               // xorl	%esi, %esi
+
+BB0_10:
+	LONG $0x487cd162; WORD $0x2410; BYTE $0x31 // vmovups	(%r9,%rsi), %zmm4
+	LONG $0x485cf162; WORD $0x2c59; BYTE $0x32 // vmulps	(%rdx,%rsi), %zmm4, %zmm5
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0x28556362; WORD $0xc503; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm24
+	LONG $0x08666162; WORD $0xcd58             // vaddss	%xmm5, %xmm3, %xmm25
+	LONG $0xddc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm3
+	LONG $0x0036f162; WORD $0xdb58             // vaddss	%xmm3, %xmm25, %xmm3
+	LONG $0x08546162; WORD $0xcd15             // vunpckhps	%xmm5, %xmm5, %xmm25
+	LONG $0x08660162; WORD $0xc958             // vaddss	%xmm25, %xmm3, %xmm25
+	LONG $0x287df362; WORD $0xeb19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm3
+	LONG $0x0036f162; WORD $0xf658             // vaddss	%xmm6, %xmm25, %xmm6
+	LONG $0xdb58cac5                           // vaddss	%xmm3, %xmm6, %xmm3
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm6
+	LONG $0xf658e2c5                           // vaddss	%xmm6, %xmm3, %xmm6
+	LONG $0x2855f362; WORD $0xdd03; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm3
+	LONG $0x487df362; WORD $0xed1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm5, %ymm5
+	LONG $0xdb58cac5                           // vaddss	%xmm3, %xmm6, %xmm3
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0x08660162; WORD $0xc058             // vaddss	%xmm24, %xmm3, %xmm24
+	LONG $0x003ef162; WORD $0xdd58             // vaddss	%xmm5, %xmm24, %xmm3
+	LONG $0x08546162; WORD $0xc5c6; BYTE $0x55 // vshufps	$85, %xmm5, %xmm5, %xmm24
+	LONG $0x08660162; WORD $0xc058             // vaddss	%xmm24, %xmm3, %xmm24
+	LONG $0xdd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm3
+	LONG $0x003ef162; WORD $0xdb58             // vaddss	%xmm3, %xmm24, %xmm3
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xee19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm6
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm6
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm6
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0xdd58e2c5                           // vaddss	%xmm5, %xmm3, %xmm3
+	LONG $0x485cd162; WORD $0x2c59; BYTE $0x33 // vmulps	(%r11,%rsi), %zmm4, %zmm5
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0x28556362; WORD $0xc503; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm24
+	LONG $0x086e6162; WORD $0xcd58             // vaddss	%xmm5, %xmm2, %xmm25
+	LONG $0xd5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm2
+	LONG $0x0036f162; WORD $0xd258             // vaddss	%xmm2, %xmm25, %xmm2
+	LONG $0x08546162; WORD $0xcd15             // vunpckhps	%xmm5, %xmm5, %xmm25
+	LONG $0x086e0162; WORD $0xc958             // vaddss	%xmm25, %xmm2, %xmm25
+	LONG $0x287df362; WORD $0xea19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm2
+	LONG $0x0036f162; WORD $0xf658             // vaddss	%xmm6, %xmm25, %xmm6
+	LONG $0xd258cac5                           // vaddss	%xmm2, %xmm6, %xmm2
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm6
+	LONG $0xf658eac5                           // vaddss	%xmm6, %xmm2, %xmm6
+	LONG $0x2855f362; WORD $0xd503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm2
+	LONG $0x487df362; WORD $0xed1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm5, %ymm5
+	LONG $0xd258cac5                           // vaddss	%xmm2, %xmm6, %xmm2
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0x086e0162; WORD $0xc058             // vaddss	%xmm24, %xmm2, %xmm24
+	LONG $0x003ef162; WORD $0xd558             // vaddss	%xmm5, %xmm24, %xmm2
+	LONG $0x08546162; WORD $0xc5c6; BYTE $0x55 // vshufps	$85, %xmm5, %xmm5, %xmm24
+	LONG $0x086e0162; WORD $0xc058             // vaddss	%xmm24, %xmm2, %xmm24
+	LONG $0xd515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm2
+	LONG $0x003ef162; WORD $0xd258             // vaddss	%xmm2, %xmm24, %xmm2
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xee19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm6
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm6
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm6
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG $0x485cf162; WORD $0x2c59; BYTE $0x31 // vmulps	(%rcx,%rsi), %zmm4, %zmm5
+	LONG $0x485cf162; WORD $0x2459; BYTE $0x37 // vmulps	(%rdi,%rsi), %zmm4, %zmm4
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0x28556362; WORD $0xc503; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm24
+	LONG $0x08766162; WORD $0xcd58             // vaddss	%xmm5, %xmm1, %xmm25
+	LONG $0xcdc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm1
+	LONG $0x0036f162; WORD $0xc958             // vaddss	%xmm1, %xmm25, %xmm1
+	LONG $0x08546162; WORD $0xcd15             // vunpckhps	%xmm5, %xmm5, %xmm25
+	LONG $0x08760162; WORD $0xc958             // vaddss	%xmm25, %xmm1, %xmm25
+	LONG $0x287df362; WORD $0xe919; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm1
+	LONG $0x0036f162; WORD $0xf658             // vaddss	%xmm6, %xmm25, %xmm6
+	LONG $0xc958cac5                           // vaddss	%xmm1, %xmm6, %xmm1
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm6
+	LONG $0xf658f2c5                           // vaddss	%xmm6, %xmm1, %xmm6
+	LONG $0x2855f362; WORD $0xcd03; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm1
+	LONG $0x487df362; WORD $0xed1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm5, %ymm5
+	LONG $0xc958cac5                           // vaddss	%xmm1, %xmm6, %xmm1
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0x08760162; WORD $0xc058             // vaddss	%xmm24, %xmm1, %xmm24
+	LONG $0x003ef162; WORD $0xcd58             // vaddss	%xmm5, %xmm24, %xmm1
+	LONG $0x08546162; WORD $0xc5c6; BYTE $0x55 // vshufps	$85, %xmm5, %xmm5, %xmm24
+	LONG $0x08760162; WORD $0xc058             // vaddss	%xmm24, %xmm1, %xmm24
+	LONG $0xcd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm1
+	LONG $0x003ef162; WORD $0xc958             // vaddss	%xmm1, %xmm24, %xmm1
+	LONG $0x085c6162; WORD $0xc4c6; BYTE $0xff // vshufps	$255, %xmm4, %xmm4, %xmm24
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xee19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm6
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm6
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm6
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0x285df362; WORD $0xf403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm6
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xec58fac5                           // vaddss	%xmm4, %xmm0, %xmm5
+	LONG $0xc4c6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm0
+	LONG $0xc058d2c5                           // vaddss	%xmm0, %xmm5, %xmm0
+	LONG $0xec15d8c5                           // vunpckhps	%xmm4, %xmm4, %xmm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xe519; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm5
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0x285df362; WORD $0xec03; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0x285df362; WORD $0xec03; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm5
+	LONG $0x487df362; WORD $0xe41b; BYTE $0x01 // vextractf32x8	$0x1, %zmm4, %ymm4
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xecc6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm5
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xf4c6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm6
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xf415d8c5                           // vunpckhps	%xmm4, %xmm4, %xmm6
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xe519; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0x285df362; WORD $0xec03; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0x285df362; WORD $0xec03; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm5
+	LONG $0x285df362; WORD $0xe403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm4
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JNE  BB0_10
+	QUAD $0x00000118249c8b4c                   // movq	280(%rsp), %r11
+	QUAD $0x000000e024948b48                   // movq	224(%rsp), %rdx
+	QUAD $0x000000d824bc8b48                   // movq	216(%rsp), %rdi
+	QUAD $0x000000d024848b48                   // movq	208(%rsp), %rax
+	WORD $0x894c; BYTE $0xde                   // movq	%r11, %rsi
+	LONG $0xf0e68348                           // andq	$-16, %rsi
+	WORD $0x0149; BYTE $0xf0                   // addq	%rsi, %r8
+	LONG $0x0fe38341                           // andl	$15, %r11d
+	JE   BB0_8
+
+BB0_9:
+	QUAD $0x00000118249c8b4c                   // movq	280(%rsp), %r11
+	WORD $0x2949; BYTE $0xf3                   // subq	%rsi, %r11
+	LONG $0xff4b8d4d                           // leaq	-1(%r11), %r9
+	LONG $0x06f98349                           // cmpq	$6, %r9
+	JBE  BB0_13
+	QUAD $0x00000108248c8b4c                   // movq	264(%rsp), %r9
+	QUAD $0x00000120248c8b48                   // movq	288(%rsp), %rcx
+	WORD $0x0149; BYTE $0xf1                   // addq	%rsi, %r9
+	WORD $0x894c; BYTE $0xce                   // movq	%r9, %rsi
+	LONG $0x390c8d4f                           // leaq	(%r9,%r15), %r9
+	LONG $0x107ca1c4; WORD $0x8924             // vmovups	(%rcx,%r9,4), %ymm4
+	QUAD $0x00000130248c8b48                   // movq	304(%rsp), %rcx
+	LONG $0x0e0c8d4c                           // leaq	(%rsi,%rcx), %r9
+	QUAD $0x00000138248c8b48                   // movq	312(%rsp), %rcx
+	LONG $0x595ca1c4; WORD $0x882c             // vmulps	(%rax,%r9,4), %ymm4, %ymm5
+	LONG $0x0e0c8d4c                           // leaq	(%rsi,%rcx), %r9
+	QUAD $0x00000128248c8b48                   // movq	296(%rsp), %rcx
+	LONG $0xdd58e2c5                           // vaddss	%xmm5, %xmm3, %xmm3
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0x08546162; WORD $0xc5c6; BYTE $0xff // vshufps	$255, %xmm5, %xmm5, %xmm24
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0xf515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm6
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xee19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm6
+	LONG $0x08669162; WORD $0xd858             // vaddss	%xmm24, %xmm3, %xmm3
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm6
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm6
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0xdd58e2c5                           // vaddss	%xmm5, %xmm3, %xmm3
+	LONG $0x595ca1c4; WORD $0x882c             // vmulps	(%rax,%r9,4), %ymm4, %ymm5
+	LONG $0x0e0c8d4c                           // leaq	(%rsi,%rcx), %r9
+	WORD $0x014c; BYTE $0xe6                   // addq	%r12, %rsi
+	LONG $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0x08546162; WORD $0xc5c6; BYTE $0xff // vshufps	$255, %xmm5, %xmm5, %xmm24
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xf515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm6
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xee19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm6
+	LONG $0x086e9162; WORD $0xd058             // vaddss	%xmm24, %xmm2, %xmm2
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm6
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm6
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xd558eac5                           // vaddss	%xmm5, %xmm2, %xmm2
+	LONG $0x595ca1c4; WORD $0x882c             // vmulps	(%rax,%r9,4), %ymm4, %ymm5
+	LONG $0x2459dcc5; BYTE $0xb0               // vmulps	(%rax,%rsi,4), %ymm4, %ymm4
+	WORD $0x894c; BYTE $0xde                   // movq	%r11, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	WORD $0x0149; BYTE $0xf0                   // addq	%rsi, %r8
+	LONG $0x07e38341                           // andl	$7, %r11d
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xf5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm6
+	LONG $0x08546162; WORD $0xc5c6; BYTE $0xff // vshufps	$255, %xmm5, %xmm5, %xmm24
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xf515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm6
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xee19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm6
+	LONG $0x08769162; WORD $0xc858             // vaddss	%xmm24, %xmm1, %xmm1
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm6
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm6
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xf4c6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm6
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xecc6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xec15d8c5                           // vunpckhps	%xmm4, %xmm4, %xmm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xe519; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm5
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0x285df362; WORD $0xec03; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0x285df362; WORD $0xec03; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm5
+	LONG $0x285df362; WORD $0xe403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm4
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	JE   BB0_8
+
+BB0_13:
+	QUAD $0x00000120249c8b4c       // movq	288(%rsp), %r11
+	LONG $0x07348d4b               // leaq	(%r15,%r8), %rsi
+	QUAD $0x00000138248c8b4c       // movq	312(%rsp), %r9
+	QUAD $0x00000128248c8b48       // movq	296(%rsp), %rcx
+	LONG $0x107ac1c4; WORD $0xb324 // vmovss	(%r11,%rsi,4), %xmm4
+	QUAD $0x0000013024b48b48       // movq	304(%rsp), %rsi
+	WORD $0x014c; BYTE $0xc6       // addq	%r8, %rsi
+	LONG $0xb959e2c4; WORD $0xb01c // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm3
+	LONG $0x01348d4b               // leaq	(%r9,%r8), %rsi
+	LONG $0xb959e2c4; WORD $0xb014 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm2
+	WORD $0x8948; BYTE $0xce       // movq	%rcx, %rsi
+	WORD $0x014c; BYTE $0xc6       // addq	%r8, %rsi
+	LONG $0xb959e2c4; WORD $0xb00c // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm1
+	LONG $0x04348d4b               // leaq	(%r12,%r8), %rsi
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	LONG $0x01708d49               // leaq	1(%r8), %rsi
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_8
+	LONG $0x370c8d4d               // leaq	(%r15,%rsi), %r9
+	LONG $0x107a81c4; WORD $0x8b24 // vmovss	(%r11,%r9,4), %xmm4
+	QUAD $0x00000130248c8b4c       // movq	304(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	LONG $0xb959a2c4; WORD $0x881c // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm3
+	QUAD $0x00000138248c8b4c       // movq	312(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	LONG $0xb959a2c4; WORD $0x8814 // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm2
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	WORD $0x014c; BYTE $0xe6       // addq	%r12, %rsi
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	LONG $0x02708d49               // leaq	2(%r8), %rsi
+	LONG $0xb959a2c4; WORD $0x880c // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm1
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_8
+	LONG $0x370c8d4d               // leaq	(%r15,%rsi), %r9
+	LONG $0x107a81c4; WORD $0x8b24 // vmovss	(%r11,%r9,4), %xmm4
+	QUAD $0x00000130248c8b4c       // movq	304(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	LONG $0xb959a2c4; WORD $0x881c // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm3
+	QUAD $0x00000138248c8b4c       // movq	312(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	LONG $0xb959a2c4; WORD $0x8814 // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm2
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	WORD $0x014c; BYTE $0xe6       // addq	%r12, %rsi
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	LONG $0x03708d49               // leaq	3(%r8), %rsi
+	LONG $0xb959a2c4; WORD $0x880c // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm1
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_8
+	LONG $0x370c8d4d               // leaq	(%r15,%rsi), %r9
+	LONG $0x107a81c4; WORD $0x8b24 // vmovss	(%r11,%r9,4), %xmm4
+	QUAD $0x00000130248c8b4c       // movq	304(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	LONG $0xb959a2c4; WORD $0x881c // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm3
+	QUAD $0x00000138248c8b4c       // movq	312(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	LONG $0xb959a2c4; WORD $0x8814 // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm2
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	WORD $0x014c; BYTE $0xe6       // addq	%r12, %rsi
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	LONG $0x04708d49               // leaq	4(%r8), %rsi
+	LONG $0xb959a2c4; WORD $0x880c // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm1
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_8
+	LONG $0x370c8d4d               // leaq	(%r15,%rsi), %r9
+	LONG $0x107a81c4; WORD $0x8b24 // vmovss	(%r11,%r9,4), %xmm4
+	QUAD $0x00000130248c8b4c       // movq	304(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	LONG $0xb959a2c4; WORD $0x881c // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm3
+	QUAD $0x00000138248c8b4c       // movq	312(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	LONG $0xb959a2c4; WORD $0x8814 // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm2
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	WORD $0x014c; BYTE $0xe6       // addq	%r12, %rsi
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	LONG $0x05708d49               // leaq	5(%r8), %rsi
+	LONG $0xb959a2c4; WORD $0x880c // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm1
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_8
+	LONG $0x370c8d4d               // leaq	(%r15,%rsi), %r9
+	LONG $0x06c08349               // addq	$6, %r8
+	LONG $0x107a81c4; WORD $0x8b24 // vmovss	(%r11,%r9,4), %xmm4
+	QUAD $0x00000130248c8b4c       // movq	304(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	LONG $0xb959a2c4; WORD $0x881c // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm3
+	QUAD $0x00000138248c8b4c       // movq	312(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	LONG $0xb959a2c4; WORD $0x8814 // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm2
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	WORD $0x014c; BYTE $0xe6       // addq	%r12, %rsi
+	LONG $0xb959a2c4; WORD $0x880c // vfmadd231ss	(%rax,%r9,4), %xmm4, %xmm1
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_8
+	QUAD $0x00000130248c8b4c       // movq	304(%rsp), %r9
+	LONG $0x07348d4b               // leaq	(%r15,%r8), %rsi
+	LONG $0x107ac1c4; WORD $0xb324 // vmovss	(%r11,%rsi,4), %xmm4
+	LONG $0x01348d4b               // leaq	(%r9,%r8), %rsi
+	QUAD $0x00000138248c8b4c       // movq	312(%rsp), %r9
+	LONG $0xb959e2c4; WORD $0xb01c // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm3
+	LONG $0x01348d4b               // leaq	(%r9,%r8), %rsi
+	LONG $0xb959e2c4; WORD $0xb014 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm2
+	LONG $0x01348d4a               // leaq	(%rcx,%r8), %rsi
+	WORD $0x014d; BYTE $0xe0       // addq	%r12, %r8
+	LONG $0xb959e2c4; WORD $0xb00c // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm1
+	LONG $0xb959a2c4; WORD $0x8004 // vfmadd231ss	(%rax,%r8,4), %xmm4, %xmm0
+
+BB0_8:
+	QUAD $0x000001102494394c       // cmpq	%r10, 272(%rsp)
+	JLE  BB0_15
+	LONG $0x7ef961c4; BYTE $0xd1   // vmovq	%xmm10, %rcx
+	WORD $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JE   BB0_16
+	LONG $0x107aa1c4; WORD $0x9124 // vmovss	(%rcx,%r10,4), %xmm4
+	LONG $0xdc58e2c5               // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0xd458eac5               // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0xcc58f2c5               // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xc458fac5               // vaddss	%xmm4, %xmm0, %xmm0
+
+BB0_16:
+	LONG $0x08fde162; WORD $0xd17e // vmovq	%xmm18, %rcx
+	LONG $0x117aa1c4; WORD $0x911c // vmovss	%xmm3, (%rcx,%r10,4)
+	LONG $0x08fde162; WORD $0xc97e // vmovq	%xmm17, %rcx
+	LONG $0x117aa1c4; WORD $0x9114 // vmovss	%xmm2, (%rcx,%r10,4)
+	LONG $0x08fde162; WORD $0xf97e // vmovq	%xmm23, %rcx
+	LONG $0x117aa1c4; WORD $0x910c // vmovss	%xmm1, (%rcx,%r10,4)
+	LONG $0x08fd6162; WORD $0xd17e // vmovq	%xmm26, %rcx
+	LONG $0x117aa1c4; WORD $0x9104 // vmovss	%xmm0, (%rcx,%r10,4)
+
+BB0_17:
+	LONG $0x7ef961c4; BYTE $0xc9 // vmovq	%xmm9, %rcx
+	LONG $0x01c28349             // addq	$1, %r10
+	WORD $0x0149; BYTE $0xd7     // addq	%rdx, %r15
+	WORD $0x0149; BYTE $0xcd     // addq	%rcx, %r13
+	LONG $0x7ef961c4; BYTE $0xf1 // vmovq	%xmm14, %rcx
+	WORD $0x3949; BYTE $0xca     // cmpq	%rcx, %r10
+	JL   BB0_19
+	QUAD $0x00000100248c8b48     // movq	256(%rsp), %rcx
+	QUAD $0x000000f02494394c     // cmpq	%r10, 240(%rsp)
+	JLE  BB0_20
+
+BB0_5:
+	LONG $0x24448b4c; BYTE $0x70   // movq	112(%rsp), %r8
+	LONG $0x247c8b4c; BYTE $0x60   // movq	96(%rsp), %r15
+	WORD $0x894d; BYTE $0xd1       // movq	%r10, %r9
+	QUAD $0x0000011824a4894c       // movq	%r12, 280(%rsp)
+	QUAD $0x000000f8248c8948       // movq	%rcx, 248(%rsp)
+	WORD $0x894c; BYTE $0xc6       // movq	%r8, %rsi
+	WORD $0x294c; BYTE $0xfe       // subq	%r15, %rsi
+	LONG $0x187d8b4c               // movq	24(%rbp), %r15
+	WORD $0x014c; BYTE $0xd6       // addq	%r10, %rsi
+	LONG $0xb7348d49               // leaq	(%r15,%rsi,4), %rsi
+	WORD $0x8949; BYTE $0xd7       // movq	%rdx, %r15
+	LONG $0xfaaf0f4d               // imulq	%r10, %r15
+	QUAD $0x000000e024b48948       // movq	%rsi, 224(%rsp)
+	QUAD $0x0000012024b48b48       // movq	288(%rsp), %rsi
+	LONG $0xbe2c8d4e               // leaq	(%rsi,%r15,4), %r13
+	QUAD $0x0000009024b48b48       // movq	144(%rsp), %rsi
+	WORD $0x294c; BYTE $0xc6       // subq	%r8, %rsi
+	QUAD $0x000000b024b48948       // movq	%rsi, 176(%rsp)
+	QUAD $0x0000008824b48b48       // movq	136(%rsp), %rsi
+	WORD $0x294c; BYTE $0xc6       // subq	%r8, %rsi
+	QUAD $0x000000a024848b4c       // movq	160(%rsp), %r8
+	QUAD $0x000000a824b48948       // movq	%rsi, 168(%rsp)
+	LONG $0x7ef961c4; BYTE $0xc6   // vmovq	%xmm8, %rsi
+	WORD $0x014c; BYTE $0xc6       // addq	%r8, %rsi
+	LONG $0x08fde162; WORD $0xc66e // vmovq	%rsi, %xmm16
+
+BB0_34:
+	LONG $0x0ffa8348               // cmpq	$15, %rdx
+	JLE  BB0_75
+	LONG $0xe457d8c5               // vxorps	%xmm4, %xmm4, %xmm4
+	QUAD $0x000000f8248c8b48       // movq	248(%rsp), %rcx
+	LONG $0x000010be; BYTE $0x00   // movl	$16, %esi
+	LONG $0x487cf162; WORD $0xdc28 // vmovaps	%zmm4, %zmm3
+	LONG $0x487cf162; WORD $0xd428 // vmovaps	%zmm4, %zmm2
+	LONG $0x487cf162; WORD $0xcc28 // vmovaps	%zmm4, %zmm1
+
+BB0_22:
+	QUAD $0xffb54410487cd162       // vmovups	-64(%r13,%rsi,4), %zmm0
+	QUAD $0xffb34cb8487df262       // vfmadd231ps	-64(%rbx,%rsi,4), %zmm0, %zmm1
+	QUAD $0xffb754b8487df262       // vfmadd231ps	-64(%rdi,%rsi,4), %zmm0, %zmm2
+	QUAD $0xffb15cb8487df262       // vfmadd231ps	-64(%rcx,%rsi,4), %zmm0, %zmm3
+	QUAD $0xffb664b8487dd262       // vfmadd231ps	-64(%r14,%rsi,4), %zmm0, %zmm4
+	LONG $0x10c68348               // addq	$16, %rsi
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JGE  BB0_22
+	QUAD $0x000000f8248c8948       // movq	%rcx, 248(%rsp)
+	QUAD $0x000000e824848b4c       // movq	232(%rsp), %r8
+	LONG $0x48fdf162; WORD $0xeb28 // vmovapd	%zmm3, %zmm5
+
+BB0_21:
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc058f4c5                           // vaddps	%ymm0, %ymm1, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0xd8c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm3
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0x48fdf362; WORD $0xd01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm0
+	LONG $0xc058ecc5                           // vaddps	%ymm0, %ymm2, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x48fdf362; WORD $0xe91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm1
+	LONG $0xd0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm2
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc158d4c5                           // vaddps	%ymm1, %ymm5, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0xc8c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm1
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0x48fdf362; WORD $0xe01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm0
+	LONG $0xc058dcc5                           // vaddps	%ymm0, %ymm4, %ymm0
+	LONG $0x197de3c4; WORD $0x01c4             // vextractf128	$0x1, %ymm0, %xmm4
+	LONG $0xc458f8c5                           // vaddps	%xmm4, %xmm0, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ee0             // vpermilps	$78, %xmm0, %xmm4
+	LONG $0xe058d8c5                           // vaddps	%xmm0, %xmm4, %xmm4
+	LONG $0xc4c6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_23
+	WORD $0x8949; BYTE $0xd2                   // movq	%rdx, %r10
+	QUAD $0x000001002484894c                   // movq	%r8, 256(%rsp)
+	WORD $0x294d; BYTE $0xc2                   // subq	%r8, %r10
+	LONG $0xff728d49                           // leaq	-1(%r10), %rsi
+	QUAD $0x000001082494894c                   // movq	%r10, 264(%rsp)
+	LONG $0x0efe8348                           // cmpq	$14, %rsi
+	JBE  BB0_76
+	QUAD $0x00000130248c8b48                   // movq	304(%rsp), %rcx
+	LONG $0x04eac149                           // shrq	$4, %r10
+	QUAD $0x000000d824948948                   // movq	%rdx, 216(%rsp)
+	LONG $0x06e2c149                           // salq	$6, %r10
+	QUAD $0x000000d024848948                   // movq	%rax, 208(%rsp)
+	LONG $0x08348d49                           // leaq	(%r8,%rcx), %rsi
+	LONG $0xb00c8d48                           // leaq	(%rax,%rsi,4), %rcx
+	LONG $0x38348d4b                           // leaq	(%r8,%r15), %rsi
+	LONG $0x08fd6162; WORD $0xe96e             // vmovq	%rcx, %xmm29
+	QUAD $0x00000120248c8b48                   // movq	288(%rsp), %rcx
+	LONG $0xb11c8d4c                           // leaq	(%rcx,%rsi,4), %r11
+	QUAD $0x00000138248c8b48                   // movq	312(%rsp), %rcx
+	LONG $0x08348d49                           // leaq	(%r8,%rcx), %rsi
+	LONG $0xb00c8d48                           // leaq	(%rax,%rsi,4), %rcx
+	LONG $0x6ef9e1c4; BYTE $0xf1               // vmovq	%rcx, %xmm6
+	QUAD $0x00000128248c8b48                   // movq	296(%rsp), %rcx
+	LONG $0x08348d49                           // leaq	(%r8,%rcx), %rsi
+	QUAD $0x00000118248c8b48                   // movq	280(%rsp), %rcx
+	LONG $0xb0248d4c                           // leaq	(%rax,%rsi,4), %r12
+	LONG $0x08348d49                           // leaq	(%r8,%rcx), %rsi
+	WORD $0x894c; BYTE $0xe2                   // movq	%r12, %rdx
+	LONG $0x7ef9c1c4; BYTE $0xf4               // vmovq	%xmm6, %r12
+	LONG $0xb00c8d48                           // leaq	(%rax,%rsi,4), %rcx
+	WORD $0x894c; BYTE $0xd0                   // movq	%r10, %rax
+	LONG $0x08fd4162; WORD $0xea7e             // vmovq	%xmm29, %r10
+	WORD $0xf631                               // xorl	%esi, %esi
+
+BB0_25:
+	LONG $0x487cc162; WORD $0x1410; BYTE $0x33 // vmovups	(%r11,%rsi), %zmm18
+	LONG $0x406cc162; WORD $0x1c59; BYTE $0x32 // vmulps	(%r10,%rsi), %zmm18, %zmm19
+	LONG $0x00642162; WORD $0xe3c6; BYTE $0x55 // vshufps	$85, %xmm19, %xmm19, %xmm28
+	LONG $0x00642162; WORD $0xdbc6; BYTE $0xff // vshufps	$255, %xmm19, %xmm19, %xmm27
+	LONG $0x20652362; WORD $0xc303; BYTE $0x07 // valignd	$7, %ymm19, %ymm19, %ymm24
+	LONG $0x0866b162; WORD $0xdb58             // vaddss	%xmm19, %xmm3, %xmm3
+	LONG $0x08669162; WORD $0xdc58             // vaddss	%xmm28, %xmm3, %xmm3
+	LONG $0x00642162; WORD $0xe315             // vunpckhps	%xmm19, %xmm19, %xmm28
+	LONG $0x08669162; WORD $0xdc58             // vaddss	%xmm28, %xmm3, %xmm3
+	LONG $0x08669162; WORD $0xdb58             // vaddss	%xmm27, %xmm3, %xmm3
+	LONG $0x287d8362; WORD $0xdb19; BYTE $0x01 // vextractf32x4	$1, %ymm19, %xmm27
+	LONG $0x08669162; WORD $0xdb58             // vaddss	%xmm27, %xmm3, %xmm3
+	LONG $0x20652362; WORD $0xdb03; BYTE $0x05 // valignd	$5, %ymm19, %ymm19, %ymm27
+	LONG $0x08669162; WORD $0xdb58             // vaddss	%xmm27, %xmm3, %xmm3
+	LONG $0x20652362; WORD $0xdb03; BYTE $0x06 // valignd	$6, %ymm19, %ymm19, %ymm27
+	LONG $0x487da362; WORD $0xdb1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm19, %ymm19
+	LONG $0x08669162; WORD $0xdb58             // vaddss	%xmm27, %xmm3, %xmm3
+	LONG $0x00642162; WORD $0xdbc6; BYTE $0x55 // vshufps	$85, %xmm19, %xmm19, %xmm27
+	LONG $0x08669162; WORD $0xd858             // vaddss	%xmm24, %xmm3, %xmm3
+	LONG $0x00642162; WORD $0xc3c6; BYTE $0xff // vshufps	$255, %xmm19, %xmm19, %xmm24
+	LONG $0x0866b162; WORD $0xdb58             // vaddss	%xmm19, %xmm3, %xmm3
+	LONG $0x08669162; WORD $0xdb58             // vaddss	%xmm27, %xmm3, %xmm3
+	LONG $0x00642162; WORD $0xdb15             // vunpckhps	%xmm19, %xmm19, %xmm27
+	LONG $0x08669162; WORD $0xdb58             // vaddss	%xmm27, %xmm3, %xmm3
+	LONG $0x08669162; WORD $0xd858             // vaddss	%xmm24, %xmm3, %xmm3
+	LONG $0x287d8362; WORD $0xd819; BYTE $0x01 // vextractf32x4	$1, %ymm19, %xmm24
+	LONG $0x08669162; WORD $0xd858             // vaddss	%xmm24, %xmm3, %xmm3
+	LONG $0x20652362; WORD $0xc303; BYTE $0x05 // valignd	$5, %ymm19, %ymm19, %ymm24
+	LONG $0x08669162; WORD $0xd858             // vaddss	%xmm24, %xmm3, %xmm3
+	LONG $0x20652362; WORD $0xc303; BYTE $0x06 // valignd	$6, %ymm19, %ymm19, %ymm24
+	LONG $0x2065a362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm19, %ymm19, %ymm19
+	LONG $0x08669162; WORD $0xd858             // vaddss	%xmm24, %xmm3, %xmm3
+	LONG $0x0866b162; WORD $0xdb58             // vaddss	%xmm19, %xmm3, %xmm3
+	LONG $0x406cc162; WORD $0x1c59; BYTE $0x34 // vmulps	(%r12,%rsi), %zmm18, %zmm19
+	LONG $0x00642162; WORD $0xe3c6; BYTE $0x55 // vshufps	$85, %xmm19, %xmm19, %xmm28
+	LONG $0x00642162; WORD $0xdbc6; BYTE $0xff // vshufps	$255, %xmm19, %xmm19, %xmm27
+	LONG $0x20652362; WORD $0xc303; BYTE $0x07 // valignd	$7, %ymm19, %ymm19, %ymm24
+	LONG $0x086eb162; WORD $0xd358             // vaddss	%xmm19, %xmm2, %xmm2
+	LONG $0x086e9162; WORD $0xd458             // vaddss	%xmm28, %xmm2, %xmm2
+	LONG $0x00642162; WORD $0xe315             // vunpckhps	%xmm19, %xmm19, %xmm28
+	LONG $0x086e9162; WORD $0xd458             // vaddss	%xmm28, %xmm2, %xmm2
+	LONG $0x086e9162; WORD $0xd358             // vaddss	%xmm27, %xmm2, %xmm2
+	LONG $0x287d8362; WORD $0xdb19; BYTE $0x01 // vextractf32x4	$1, %ymm19, %xmm27
+	LONG $0x086e9162; WORD $0xd358             // vaddss	%xmm27, %xmm2, %xmm2
+	LONG $0x20652362; WORD $0xdb03; BYTE $0x05 // valignd	$5, %ymm19, %ymm19, %ymm27
+	LONG $0x086e9162; WORD $0xd358             // vaddss	%xmm27, %xmm2, %xmm2
+	LONG $0x20652362; WORD $0xdb03; BYTE $0x06 // valignd	$6, %ymm19, %ymm19, %ymm27
+	LONG $0x487da362; WORD $0xdb1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm19, %ymm19
+	LONG $0x086e9162; WORD $0xd358             // vaddss	%xmm27, %xmm2, %xmm2
+	LONG $0x00642162; WORD $0xdbc6; BYTE $0x55 // vshufps	$85, %xmm19, %xmm19, %xmm27
+	LONG $0x086e9162; WORD $0xd058             // vaddss	%xmm24, %xmm2, %xmm2
+	LONG $0x00642162; WORD $0xc3c6; BYTE $0xff // vshufps	$255, %xmm19, %xmm19, %xmm24
+	LONG $0x086eb162; WORD $0xd358             // vaddss	%xmm19, %xmm2, %xmm2
+	LONG $0x086e9162; WORD $0xd358             // vaddss	%xmm27, %xmm2, %xmm2
+	LONG $0x00642162; WORD $0xdb15             // vunpckhps	%xmm19, %xmm19, %xmm27
+	LONG $0x086e9162; WORD $0xd358             // vaddss	%xmm27, %xmm2, %xmm2
+	LONG $0x086e9162; WORD $0xd058             // vaddss	%xmm24, %xmm2, %xmm2
+	LONG $0x287d8362; WORD $0xd819; BYTE $0x01 // vextractf32x4	$1, %ymm19, %xmm24
+	LONG $0x086e9162; WORD $0xd058             // vaddss	%xmm24, %xmm2, %xmm2
+	LONG $0x20652362; WORD $0xc303; BYTE $0x05 // valignd	$5, %ymm19, %ymm19, %ymm24
+	LONG $0x086e9162; WORD $0xd058             // vaddss	%xmm24, %xmm2, %xmm2
+	LONG $0x20652362; WORD $0xc303; BYTE $0x06 // valignd	$6, %ymm19, %ymm19, %ymm24
+	LONG $0x2065a362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm19, %ymm19, %ymm19
+	LONG $0x086e9162; WORD $0xd058             // vaddss	%xmm24, %xmm2, %xmm2
+	LONG $0x086eb162; WORD $0xd358             // vaddss	%xmm19, %xmm2, %xmm2
+	LONG $0x406ce162; WORD $0x1c59; BYTE $0x32 // vmulps	(%rdx,%rsi), %zmm18, %zmm19
+	LONG $0x406ce162; WORD $0x1459; BYTE $0x31 // vmulps	(%rcx,%rsi), %zmm18, %zmm18
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0x00642162; WORD $0xe3c6; BYTE $0x55 // vshufps	$85, %xmm19, %xmm19, %xmm28
+	LONG $0x00642162; WORD $0xdbc6; BYTE $0xff // vshufps	$255, %xmm19, %xmm19, %xmm27
+	LONG $0x20652362; WORD $0xc303; BYTE $0x07 // valignd	$7, %ymm19, %ymm19, %ymm24
+	LONG $0x0876b162; WORD $0xcb58             // vaddss	%xmm19, %xmm1, %xmm1
+	LONG $0x087eb162; WORD $0xc258             // vaddss	%xmm18, %xmm0, %xmm0
+	LONG $0x08769162; WORD $0xcc58             // vaddss	%xmm28, %xmm1, %xmm1
+	LONG $0x00642162; WORD $0xe315             // vunpckhps	%xmm19, %xmm19, %xmm28
+	LONG $0x08769162; WORD $0xcc58             // vaddss	%xmm28, %xmm1, %xmm1
+	LONG $0x08769162; WORD $0xcb58             // vaddss	%xmm27, %xmm1, %xmm1
+	LONG $0x287d8362; WORD $0xdb19; BYTE $0x01 // vextractf32x4	$1, %ymm19, %xmm27
+	LONG $0x08769162; WORD $0xcb58             // vaddss	%xmm27, %xmm1, %xmm1
+	LONG $0x20652362; WORD $0xdb03; BYTE $0x05 // valignd	$5, %ymm19, %ymm19, %ymm27
+	LONG $0x08769162; WORD $0xcb58             // vaddss	%xmm27, %xmm1, %xmm1
+	LONG $0x20652362; WORD $0xdb03; BYTE $0x06 // valignd	$6, %ymm19, %ymm19, %ymm27
+	LONG $0x487da362; WORD $0xdb1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm19, %ymm19
+	LONG $0x08769162; WORD $0xcb58             // vaddss	%xmm27, %xmm1, %xmm1
+	LONG $0x00642162; WORD $0xdbc6; BYTE $0x55 // vshufps	$85, %xmm19, %xmm19, %xmm27
+	LONG $0x08769162; WORD $0xc858             // vaddss	%xmm24, %xmm1, %xmm1
+	LONG $0x00642162; WORD $0xc3c6; BYTE $0xff // vshufps	$255, %xmm19, %xmm19, %xmm24
+	LONG $0x0876b162; WORD $0xcb58             // vaddss	%xmm19, %xmm1, %xmm1
+	LONG $0x08769162; WORD $0xcb58             // vaddss	%xmm27, %xmm1, %xmm1
+	LONG $0x00642162; WORD $0xdb15             // vunpckhps	%xmm19, %xmm19, %xmm27
+	LONG $0x08769162; WORD $0xcb58             // vaddss	%xmm27, %xmm1, %xmm1
+	LONG $0x006c2162; WORD $0xdac6; BYTE $0xff // vshufps	$255, %xmm18, %xmm18, %xmm27
+	LONG $0x08769162; WORD $0xc858             // vaddss	%xmm24, %xmm1, %xmm1
+	LONG $0x287d8362; WORD $0xd819; BYTE $0x01 // vextractf32x4	$1, %ymm19, %xmm24
+	LONG $0x08769162; WORD $0xc858             // vaddss	%xmm24, %xmm1, %xmm1
+	LONG $0x20652362; WORD $0xc303; BYTE $0x05 // valignd	$5, %ymm19, %ymm19, %ymm24
+	LONG $0x08769162; WORD $0xc858             // vaddss	%xmm24, %xmm1, %xmm1
+	LONG $0x20652362; WORD $0xc303; BYTE $0x06 // valignd	$6, %ymm19, %ymm19, %ymm24
+	LONG $0x2065a362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm19, %ymm19, %ymm19
+	LONG $0x08769162; WORD $0xc858             // vaddss	%xmm24, %xmm1, %xmm1
+	LONG $0x006c2162; WORD $0xc2c6; BYTE $0x55 // vshufps	$85, %xmm18, %xmm18, %xmm24
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x006c2162; WORD $0xc215             // vunpckhps	%xmm18, %xmm18, %xmm24
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x0876b162; WORD $0xcb58             // vaddss	%xmm19, %xmm1, %xmm1
+	LONG $0x287d8362; WORD $0xd019; BYTE $0x01 // vextractf32x4	$1, %ymm18, %xmm24
+	LONG $0x206da362; WORD $0xda03; BYTE $0x07 // valignd	$7, %ymm18, %ymm18, %ymm19
+	LONG $0x087e9162; WORD $0xc358             // vaddss	%xmm27, %xmm0, %xmm0
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x206d2362; WORD $0xc203; BYTE $0x05 // valignd	$5, %ymm18, %ymm18, %ymm24
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x206d2362; WORD $0xc203; BYTE $0x06 // valignd	$6, %ymm18, %ymm18, %ymm24
+	LONG $0x487da362; WORD $0xd21b; BYTE $0x01 // vextractf32x8	$0x1, %zmm18, %ymm18
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x006c2162; WORD $0xc2c6; BYTE $0x55 // vshufps	$85, %xmm18, %xmm18, %xmm24
+	LONG $0x087eb162; WORD $0xc358             // vaddss	%xmm19, %xmm0, %xmm0
+	LONG $0x006ca162; WORD $0xdac6; BYTE $0xff // vshufps	$255, %xmm18, %xmm18, %xmm19
+	LONG $0x087eb162; WORD $0xc258             // vaddss	%xmm18, %xmm0, %xmm0
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x006c2162; WORD $0xc215             // vunpckhps	%xmm18, %xmm18, %xmm24
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x087eb162; WORD $0xc358             // vaddss	%xmm19, %xmm0, %xmm0
+	LONG $0x287da362; WORD $0xd319; BYTE $0x01 // vextractf32x4	$1, %ymm18, %xmm19
+	LONG $0x087eb162; WORD $0xc358             // vaddss	%xmm19, %xmm0, %xmm0
+	LONG $0x206da362; WORD $0xda03; BYTE $0x05 // valignd	$5, %ymm18, %ymm18, %ymm19
+	LONG $0x087eb162; WORD $0xc358             // vaddss	%xmm19, %xmm0, %xmm0
+	LONG $0x206da362; WORD $0xda03; BYTE $0x06 // valignd	$6, %ymm18, %ymm18, %ymm19
+	LONG $0x206da362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm18, %ymm18, %ymm18
+	LONG $0x087eb162; WORD $0xc358             // vaddss	%xmm19, %xmm0, %xmm0
+	LONG $0x087eb162; WORD $0xc258             // vaddss	%xmm18, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JNE  BB0_25
+	QUAD $0x0000010824b48b48                   // movq	264(%rsp), %rsi
+	QUAD $0x000000d824948b48                   // movq	216(%rsp), %rdx
+	QUAD $0x000000d024848b48                   // movq	208(%rsp), %rax
+	WORD $0x8949; BYTE $0xf2                   // movq	%rsi, %r10
+	LONG $0xf0e28349                           // andq	$-16, %r10
+	WORD $0x014d; BYTE $0xd0                   // addq	%r10, %r8
+	WORD $0xe683; BYTE $0x0f                   // andl	$15, %esi
+	JE   BB0_23
+
+BB0_24:
+	QUAD $0x0000010824a48b4c                   // movq	264(%rsp), %r12
+	WORD $0x294d; BYTE $0xd4                   // subq	%r10, %r12
+	LONG $0x24748d49; BYTE $0xff               // leaq	-1(%r12), %rsi
+	LONG $0x06fe8348                           // cmpq	$6, %rsi
+	JBE  BB0_28
+	QUAD $0x00000100249c8b4c                   // movq	256(%rsp), %r11
+	QUAD $0x00000120248c8b48                   // movq	288(%rsp), %rcx
+	LONG $0x1f348d4b                           // leaq	(%r15,%r11), %rsi
+	WORD $0x014d; BYTE $0xd3                   // addq	%r10, %r11
+	WORD $0x014c; BYTE $0xd6                   // addq	%r10, %rsi
+	LONG $0x2c10fcc5; BYTE $0xb1               // vmovups	(%rcx,%rsi,4), %ymm5
+	QUAD $0x00000130248c8b48                   // movq	304(%rsp), %rcx
+	LONG $0x0b348d49                           // leaq	(%r11,%rcx), %rsi
+	QUAD $0x00000138248c8b48                   // movq	312(%rsp), %rcx
+	LONG $0x3459d4c5; BYTE $0xb0               // vmulps	(%rax,%rsi,4), %ymm5, %ymm6
+	LONG $0x0b348d49                           // leaq	(%r11,%rcx), %rsi
+	QUAD $0x00000128248c8b48                   // movq	296(%rsp), %rcx
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0xe6c6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm4
+	LONG $0xfec648c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm15
+	LONG $0xdc58e2c5                           // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0xe615c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm4
+	LONG $0xdc58e2c5                           // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xf419; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm4
+	LONG $0x5862c1c4; BYTE $0xdf               // vaddss	%xmm15, %xmm3, %xmm3
+	LONG $0xdc58e2c5                           // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0x284df362; WORD $0xe603; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm4
+	LONG $0xdc58e2c5                           // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0x284df362; WORD $0xe603; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm4
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0xdc58e2c5                           // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0xde58e2c5                           // vaddss	%xmm6, %xmm3, %xmm3
+	LONG $0x3459d4c5; BYTE $0xb0               // vmulps	(%rax,%rsi,4), %ymm5, %ymm6
+	LONG $0x0b348d49                           // leaq	(%r11,%rcx), %rsi
+	QUAD $0x00000118248c8b48                   // movq	280(%rsp), %rcx
+	WORD $0x0149; BYTE $0xcb                   // addq	%rcx, %r11
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0xe6c6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm4
+	LONG $0xfec648c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm15
+	LONG $0xd458eac5                           // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0xe615c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm4
+	LONG $0xd458eac5                           // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xf419; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm4
+	LONG $0x586ac1c4; BYTE $0xd7               // vaddss	%xmm15, %xmm2, %xmm2
+	LONG $0xd458eac5                           // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0x284df362; WORD $0xe603; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm4
+	LONG $0xd458eac5                           // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0x284df362; WORD $0xe603; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm4
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0xd458eac5                           // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0xd658eac5                           // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0x3459d4c5; BYTE $0xb0               // vmulps	(%rax,%rsi,4), %ymm5, %ymm6
+	WORD $0x894c; BYTE $0xe6                   // movq	%r12, %rsi
+	LONG $0x5954a1c4; WORD $0x982c             // vmulps	(%rax,%r11,4), %ymm5, %ymm5
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	WORD $0x0149; BYTE $0xf0                   // addq	%rsi, %r8
+	LONG $0x07e48341                           // andl	$7, %r12d
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xe6c6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm4
+	LONG $0xfec648c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm15
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xe615c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm4
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xf419; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm4
+	LONG $0x5872c1c4; BYTE $0xcf               // vaddss	%xmm15, %xmm1, %xmm1
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0x284df362; WORD $0xe603; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm4
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0x284df362; WORD $0xe603; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm4
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xe5c6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm4
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xe515d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm4
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0x287df362; WORD $0xec19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm4
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0x2855f362; WORD $0xe503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm4
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0x2855f362; WORD $0xe503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm4
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	JE   BB0_23
+
+BB0_28:
+	QUAD $0x00000120249c8b4c       // movq	288(%rsp), %r11
+	QUAD $0x0000013024a48b4c       // movq	304(%rsp), %r12
+	LONG $0x07348d4b               // leaq	(%r15,%r8), %rsi
+	QUAD $0x0000012824948b4c       // movq	296(%rsp), %r10
+	QUAD $0x00000118248c8b48       // movq	280(%rsp), %rcx
+	LONG $0x107ac1c4; WORD $0xb324 // vmovss	(%r11,%rsi,4), %xmm4
+	LONG $0x04348d4b               // leaq	(%r12,%r8), %rsi
+	LONG $0xb959e2c4; WORD $0xb01c // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm3
+	QUAD $0x0000013824b48b48       // movq	312(%rsp), %rsi
+	WORD $0x014c; BYTE $0xc6       // addq	%r8, %rsi
+	LONG $0xb959e2c4; WORD $0xb014 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm2
+	LONG $0x02348d4b               // leaq	(%r10,%r8), %rsi
+	LONG $0xb959e2c4; WORD $0xb00c // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm1
+	WORD $0x8948; BYTE $0xce       // movq	%rcx, %rsi
+	WORD $0x014c; BYTE $0xc6       // addq	%r8, %rsi
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	LONG $0x01708d49               // leaq	1(%r8), %rsi
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_23
+	LONG $0x37148d4d               // leaq	(%r15,%rsi), %r10
+	LONG $0x107a81c4; WORD $0x9324 // vmovss	(%r11,%r10,4), %xmm4
+	LONG $0x34148d4d               // leaq	(%r12,%rsi), %r10
+	LONG $0xb959a2c4; WORD $0x901c // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm3
+	QUAD $0x0000013824948b4c       // movq	312(%rsp), %r10
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	LONG $0xb959a2c4; WORD $0x9014 // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm2
+	QUAD $0x0000012824948b4c       // movq	296(%rsp), %r10
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	WORD $0x0148; BYTE $0xce       // addq	%rcx, %rsi
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	LONG $0x02708d49               // leaq	2(%r8), %rsi
+	LONG $0xb959a2c4; WORD $0x900c // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm1
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_23
+	LONG $0x37148d4d               // leaq	(%r15,%rsi), %r10
+	LONG $0x107a81c4; WORD $0x9324 // vmovss	(%r11,%r10,4), %xmm4
+	LONG $0x34148d4d               // leaq	(%r12,%rsi), %r10
+	LONG $0xb959a2c4; WORD $0x901c // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm3
+	QUAD $0x0000013824948b4c       // movq	312(%rsp), %r10
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	LONG $0xb959a2c4; WORD $0x9014 // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm2
+	QUAD $0x0000012824948b4c       // movq	296(%rsp), %r10
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	WORD $0x0148; BYTE $0xce       // addq	%rcx, %rsi
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	LONG $0x03708d49               // leaq	3(%r8), %rsi
+	LONG $0xb959a2c4; WORD $0x900c // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm1
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_23
+	LONG $0x37148d4d               // leaq	(%r15,%rsi), %r10
+	LONG $0x107a81c4; WORD $0x9324 // vmovss	(%r11,%r10,4), %xmm4
+	LONG $0x34148d4d               // leaq	(%r12,%rsi), %r10
+	LONG $0xb959a2c4; WORD $0x901c // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm3
+	QUAD $0x0000013824948b4c       // movq	312(%rsp), %r10
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	LONG $0xb959a2c4; WORD $0x9014 // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm2
+	QUAD $0x0000012824948b4c       // movq	296(%rsp), %r10
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	WORD $0x0148; BYTE $0xce       // addq	%rcx, %rsi
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	LONG $0x04708d49               // leaq	4(%r8), %rsi
+	LONG $0xb959a2c4; WORD $0x900c // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm1
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_23
+	LONG $0x37148d4d               // leaq	(%r15,%rsi), %r10
+	LONG $0x107a81c4; WORD $0x9324 // vmovss	(%r11,%r10,4), %xmm4
+	LONG $0x34148d4d               // leaq	(%r12,%rsi), %r10
+	LONG $0xb959a2c4; WORD $0x901c // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm3
+	QUAD $0x0000013824948b4c       // movq	312(%rsp), %r10
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	LONG $0xb959a2c4; WORD $0x9014 // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm2
+	QUAD $0x0000012824948b4c       // movq	296(%rsp), %r10
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	WORD $0x0148; BYTE $0xce       // addq	%rcx, %rsi
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	LONG $0x05708d49               // leaq	5(%r8), %rsi
+	LONG $0xb959a2c4; WORD $0x900c // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm1
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_23
+	LONG $0x37148d4d               // leaq	(%r15,%rsi), %r10
+	LONG $0x06c08349               // addq	$6, %r8
+	LONG $0x107a81c4; WORD $0x9324 // vmovss	(%r11,%r10,4), %xmm4
+	LONG $0x34148d4d               // leaq	(%r12,%rsi), %r10
+	LONG $0xb959a2c4; WORD $0x901c // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm3
+	QUAD $0x0000013824948b4c       // movq	312(%rsp), %r10
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	LONG $0xb959a2c4; WORD $0x9014 // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm2
+	QUAD $0x0000012824948b4c       // movq	296(%rsp), %r10
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	WORD $0x0148; BYTE $0xce       // addq	%rcx, %rsi
+	LONG $0xb959a2c4; WORD $0x900c // vfmadd231ss	(%rax,%r10,4), %xmm4, %xmm1
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_23
+	LONG $0x07348d4b               // leaq	(%r15,%r8), %rsi
+	QUAD $0x0000013824948b4c       // movq	312(%rsp), %r10
+	LONG $0x107ac1c4; WORD $0xb324 // vmovss	(%r11,%rsi,4), %xmm4
+	LONG $0x04348d4b               // leaq	(%r12,%r8), %rsi
+	LONG $0xb959e2c4; WORD $0xb01c // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm3
+	LONG $0x02348d4b               // leaq	(%r10,%r8), %rsi
+	QUAD $0x0000012824948b4c       // movq	296(%rsp), %r10
+	LONG $0xb959e2c4; WORD $0xb014 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm2
+	LONG $0x02348d4b               // leaq	(%r10,%r8), %rsi
+	WORD $0x0149; BYTE $0xc8       // addq	%rcx, %r8
+	LONG $0xb959e2c4; WORD $0xb00c // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm1
+	LONG $0xb959a2c4; WORD $0x8004 // vfmadd231ss	(%rax,%r8,4), %xmm4, %xmm0
+
+BB0_23:
+	QUAD $0x00000110248c394c       // cmpq	%r9, 272(%rsp)
+	JLE  BB0_30
+	LONG $0x7ef961c4; BYTE $0xd1   // vmovq	%xmm10, %rcx
+	WORD $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JE   BB0_31
+	LONG $0x107aa1c4; WORD $0x8924 // vmovss	(%rcx,%r9,4), %xmm4
+	LONG $0xdc58e2c5               // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0xd458eac5               // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0xcc58f2c5               // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xc458fac5               // vaddss	%xmm4, %xmm0, %xmm0
+
+BB0_31:
+	LONG $0x08fde162; WORD $0xc17e // vmovq	%xmm16, %rcx
+	LONG $0x117aa1c4; WORD $0x891c // vmovss	%xmm3, (%rcx,%r9,4)
+	LONG $0x08fde162; WORD $0xc97e // vmovq	%xmm17, %rcx
+	LONG $0x117aa1c4; WORD $0x8914 // vmovss	%xmm2, (%rcx,%r9,4)
+	LONG $0x08fde162; WORD $0xf97e // vmovq	%xmm23, %rcx
+	LONG $0x117aa1c4; WORD $0x890c // vmovss	%xmm1, (%rcx,%r9,4)
+	LONG $0x08fd6162; WORD $0xd17e // vmovq	%xmm26, %rcx
+	LONG $0x117aa1c4; WORD $0x8904 // vmovss	%xmm0, (%rcx,%r9,4)
+
+BB0_32:
+	LONG $0x7ef961c4; BYTE $0xc9         // vmovq	%xmm9, %rcx
+	LONG $0x01c18349                     // addq	$1, %r9
+	WORD $0x0149; BYTE $0xd7             // addq	%rdx, %r15
+	QUAD $0x000000e024848348; BYTE $0x04 // addq	$4, 224(%rsp)
+	WORD $0x0149; BYTE $0xcd             // addq	%rcx, %r13
+	QUAD $0x000000f0248c394c             // cmpq	%r9, 240(%rsp)
+	JG   BB0_34
+	QUAD $0x0000011824a48b4c             // movq	280(%rsp), %r12
+	QUAD $0x000000f8248c8b48             // movq	248(%rsp), %rcx
+
+BB0_20:
+	QUAD $0x0000009824b48b48             // movq	152(%rsp), %rsi
+	LONG $0x24740148; BYTE $0x70         // addq	%rsi, 112(%rsp)
+	LONG $0x7ef941c4; BYTE $0xc8         // vmovq	%xmm9, %r8
+	QUAD $0x0000009024b40148             // addq	%rsi, 144(%rsp)
+	WORD $0x014d; BYTE $0xc4             // addq	%r8, %r12
+	QUAD $0x0000008824b40148             // addq	%rsi, 136(%rsp)
+	LONG $0x24748b48; BYTE $0x58         // movq	88(%rsp), %rsi
+	QUAD $0x000000c024848348; BYTE $0x04 // addq	$4, 192(%rsp)
+	QUAD $0x000000c024bc8b4c             // movq	192(%rsp), %r15
+	WORD $0x0148; BYTE $0xf3             // addq	%rsi, %rbx
+	WORD $0x0148; BYTE $0xf7             // addq	%rsi, %rdi
+	WORD $0x0148; BYTE $0xf1             // addq	%rsi, %rcx
+	WORD $0x0149; BYTE $0xf6             // addq	%rsi, %r14
+	QUAD $0x000001302484014c             // addq	%r8, 304(%rsp)
+	QUAD $0x000001382484014c             // addq	%r8, 312(%rsp)
+	QUAD $0x000001282484014c             // addq	%r8, 296(%rsp)
+	LONG $0x24448b4c; BYTE $0x50         // movq	80(%rsp), %r8
+	QUAD $0x000000a02484014c             // addq	%r8, 160(%rsp)
+	LONG $0x24448b4c; BYTE $0x48         // movq	72(%rsp), %r8
+	LONG $0x2444014c; BYTE $0x68         // addq	%r8, 104(%rsp)
+	QUAD $0x0000008024bc394c             // cmpq	%r15, 128(%rsp)
+	JG   BB0_4
+	QUAD $0x0000008024bc8b48             // movq	128(%rsp), %rdi
+	QUAD $0x0000012024bc8b4c             // movq	288(%rsp), %r15
+	LONG $0x105d8b4c                     // movq	16(%rbp), %r11
+	LONG $0xfc4f8d48                     // leaq	-4(%rdi), %rcx
+	LONG $0x02e9c148                     // shrq	$2, %rcx
+	QUAD $0x000000048d0c8d48             // leaq	4(,%rcx,4), %rcx
+
+BB0_2:
+	QUAD $0x00000080248c3948     // cmpq	%rcx, 128(%rsp)
+	JLE  BB0_143
+	QUAD $0x000000f024a48b4c     // movq	240(%rsp), %r12
+	WORD $0x854d; BYTE $0xe4     // testq	%r12, %r12
+	JLE  BB0_143
+	LONG $0xf0728d48             // leaq	-16(%rdx), %rsi
+	QUAD $0x00000110249c8b48     // movq	272(%rsp), %rbx
+	WORD $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	QUAD $0x0000000095048d4c     // leaq	0(,%rdx,4), %r8
+	LONG $0xf0e68348             // andq	$-16, %rsi
+	QUAD $0x000000b824ac8b4c     // movq	184(%rsp), %r13
+	LONG $0xf9af0f48             // imulq	%rcx, %rdi
+	LONG $0x6ef9c1c4; BYTE $0xc8 // vmovq	%r8, %xmm1
+	LONG $0x10c68348             // addq	$16, %rsi
+	QUAD $0x000000c824848b4c     // movq	200(%rsp), %r8
+	WORD $0x8949; BYTE $0xde     // movq	%rbx, %r14
+	QUAD $0x00000128248c8948     // movq	%rcx, 296(%rsp)
+	QUAD $0x0000013024b48948     // movq	%rsi, 304(%rsp)
+	WORD $0x8948; BYTE $0xde     // movq	%rbx, %rsi
+	LONG $0x2b0c8d4e             // leaq	(%rbx,%r13), %r9
+	WORD $0x894d; BYTE $0xea     // movq	%r13, %r10
+	WORD $0xf748; BYTE $0xde     // negq	%rsi
+	QUAD $0x000000f8248c894c     // movq	%r9, 248(%rsp)
+	LONG $0xd1af0f4c             // imulq	%rcx, %r10
+	LONG $0x6f7941c4; BYTE $0xf0 // vmovdqa	%xmm8, %xmm14
+	LONG $0xf1af0f4c             // imulq	%rcx, %r14
+	LONG $0xb0348d49             // leaq	(%r8,%rsi,4), %rsi
+	QUAD $0x0000013824bc8948     // movq	%rdi, 312(%rsp)
+	LONG $0xc16f79c5             // vmovdqa	%xmm1, %xmm8
+	LONG $0x6ef9e1c4; BYTE $0xf6 // vmovq	%rsi, %xmm6
+	WORD $0x894c; BYTE $0xce     // movq	%r9, %rsi
+	QUAD $0x000000009d048d4c     // leaq	0(,%rbx,4), %r8
+	WORD $0x894c; BYTE $0xcb     // movq	%r9, %rbx
+	WORD $0xf748; BYTE $0xde     // negq	%rsi
+	LONG $0x7ef9c1c4; BYTE $0xf9 // vmovq	%xmm7, %r9
+	LONG $0xb83c8d48             // leaq	(%rax,%rdi,4), %rdi
+	WORD $0x294d; BYTE $0xc3     // subq	%r8, %r11
+	LONG $0xb1348d49             // leaq	(%r9,%rsi,4), %rsi
+	WORD $0x8949; BYTE $0xd9     // movq	%rbx, %r9
+	QUAD $0x000000e0249c894c     // movq	%r11, 224(%rsp)
+	LONG $0x6ef9e1c4; BYTE $0xee // vmovq	%rsi, %xmm5
+	LONG $0x18758b48             // movq	24(%rbp), %rsi
+	QUAD $0x0000010824b4894c     // movq	%r14, 264(%rsp)
+	QUAD $0x000001002494894c     // movq	%r10, 256(%rsp)
+	WORD $0x294c; BYTE $0xc6     // subq	%r8, %rsi
+	QUAD $0x00000000ad048d4e     // leaq	0(,%r13,4), %r8
+	WORD $0x294c; BYTE $0xc6     // subq	%r8, %rsi
+	WORD $0x3949; BYTE $0xdc     // cmpq	%rbx, %r12
+	QUAD $0x0000013824848b4c     // movq	312(%rsp), %r8
+	LONG $0xcc4e0f4d             // cmovle	%r12, %r9
+	QUAD $0x000000e824b48948     // movq	%rsi, 232(%rsp)
+	LONG $0x6ef9c1c4; BYTE $0xd1 // vmovq	%r9, %xmm2
+
+BB0_55:
+	QUAD $0x000000f824bc8348; BYTE $0x00 // cmpq	$0, 248(%rsp)
+	JG   BB0_38
+	QUAD $0x00000100249c8b48             // movq	256(%rsp), %rbx
+	WORD $0x3145; BYTE $0xc9             // xorl	%r9d, %r9d
+	QUAD $0x000000009d1c8d48             // leaq	0(,%rbx,4), %rbx
+	QUAD $0x00000120249c8948             // movq	%rbx, 288(%rsp)
+	QUAD $0x00000108249c8b48             // movq	264(%rsp), %rbx
+	QUAD $0x000000009d1c8d48             // leaq	0(,%rbx,4), %rbx
+	QUAD $0x00000118249c8948             // movq	%rbx, 280(%rsp)
+
+BB0_39:
+	QUAD $0x00000120249c8b48     // movq	288(%rsp), %rbx
+	WORD $0x8949; BYTE $0xd4     // movq	%rdx, %r12
+	QUAD $0x000000e8248c8b48     // movq	232(%rsp), %rcx
+	LONG $0xc17f79c5             // vmovdqa	%xmm8, %xmm1
+	LONG $0xe1af0f4d             // imulq	%r9, %r12
+	WORD $0x0148; BYTE $0xcb     // addq	%rcx, %rbx
+	LONG $0x7ef961c4; BYTE $0xf1 // vmovq	%xmm14, %rcx
+	QUAD $0x00000120249c8948     // movq	%rbx, 288(%rsp)
+	QUAD $0x00000118249c8b48     // movq	280(%rsp), %rbx
+	LONG $0xa7148d4f             // leaq	(%r15,%r12,4), %r10
+	WORD $0x0148; BYTE $0xcb     // addq	%rcx, %rbx
+	QUAD $0x00000118249c8948     // movq	%rbx, 280(%rsp)
+
+BB0_69:
+	LONG $0x0ffa8348             // cmpq	$15, %rdx
+	JLE  BB0_79
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x000010be; BYTE $0x00 // movl	$16, %esi
+
+BB0_57:
+	QUAD $0xffb76410487cf162 // vmovups	-64(%rdi,%rsi,4), %zmm4
+	QUAD $0xffb244b8485dd262 // vfmadd231ps	-64(%r10,%rsi,4), %zmm4, %zmm0
+	LONG $0x10c68348         // addq	$16, %rsi
+	WORD $0x3948; BYTE $0xf2 // cmpq	%rsi, %rdx
+	JGE  BB0_57
+	QUAD $0x00000130249c8b4c // movq	304(%rsp), %r11
+
+BB0_56:
+	LONG $0x48fdf362; WORD $0xc31b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm3
+	LONG $0xc358fcc5                           // vaddps	%ymm3, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c3             // vextractf128	$0x1, %ymm0, %xmm3
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ed8             // vpermilps	$78, %xmm0, %xmm3
+	LONG $0xd858e0c5                           // vaddps	%xmm0, %xmm3, %xmm3
+	LONG $0xc3c6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xda                   // cmpq	%r11, %rdx
+	JLE  BB0_58
+	WORD $0x8948; BYTE $0xd3                   // movq	%rdx, %rbx
+	QUAD $0x00000138249c894c                   // movq	%r11, 312(%rsp)
+	WORD $0x294c; BYTE $0xdb                   // subq	%r11, %rbx
+	LONG $0xff738d48                           // leaq	-1(%rbx), %rsi
+	LONG $0x0efe8348                           // cmpq	$14, %rsi
+	JBE  BB0_80
+	LONG $0x03348d4b                           // leaq	(%r11,%r8), %rsi
+	LONG $0xb02c8d4c                           // leaq	(%rax,%rsi,4), %r13
+	LONG $0x23348d4b                           // leaq	(%r11,%r12), %rsi
+	LONG $0xb7348d4d                           // leaq	(%r15,%rsi,4), %r14
+	WORD $0x8948; BYTE $0xde                   // movq	%rbx, %rsi
+	LONG $0x04eec148                           // shrq	$4, %rsi
+	WORD $0x8948; BYTE $0xf1                   // movq	%rsi, %rcx
+	WORD $0xf631                               // xorl	%esi, %esi
+	LONG $0x06e1c148                           // salq	$6, %rcx
+
+BB0_60:
+	QUAD $0x00356410487cd162                   // vmovups	0(%r13,%rsi), %zmm4
+	LONG $0x485c5162; WORD $0x0c59; BYTE $0x36 // vmulps	(%r14,%rsi), %zmm4, %zmm9
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0xc058b2c5                           // vaddss	%xmm0, %xmm9, %xmm0
+	LONG $0xc630c1c4; WORD $0x55d9             // vshufps	$85, %xmm9, %xmm9, %xmm3
+	LONG $0xc63041c4; WORD $0xffe9             // vshufps	$255, %xmm9, %xmm9, %xmm13
+	LONG $0x487d7362; WORD $0xcc1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm9, %ymm4
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x1530c1c4; BYTE $0xd9               // vunpckhps	%xmm9, %xmm9, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x287d7362; WORD $0xcb19; BYTE $0x01 // vextractf32x4	$1, %ymm9, %xmm3
+	LONG $0x587ac1c4; BYTE $0xc5               // vaddss	%xmm13, %xmm0, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2835d362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm9, %ymm9, %ymm3
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0x2835d362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm9, %ymm9, %ymm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2835d362; WORD $0xd903; BYTE $0x07 // valignd	$7, %ymm9, %ymm9, %ymm3
+	LONG $0xccc658c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm9
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc4c6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm0
+	LONG $0xdc58e2c5                           // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc415d8c5                           // vunpckhps	%xmm4, %xmm4, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xe319; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm3
+	LONG $0x587ac1c4; BYTE $0xc1               // vaddss	%xmm9, %xmm0, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x285df362; WORD $0xdc03; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x285df362; WORD $0xdc03; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm3
+	LONG $0x285df362; WORD $0xe403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm4
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JNE  BB0_60
+	WORD $0x8948; BYTE $0xde                   // movq	%rbx, %rsi
+	LONG $0xf0e68348                           // andq	$-16, %rsi
+	WORD $0x0149; BYTE $0xf3                   // addq	%rsi, %r11
+	WORD $0xc3f6; BYTE $0x0f                   // testb	$15, %bl
+	JE   BB0_58
+
+BB0_59:
+	WORD $0x2948; BYTE $0xf3                   // subq	%rsi, %rbx
+	LONG $0xff4b8d48                           // leaq	-1(%rbx), %rcx
+	LONG $0x06f98348                           // cmpq	$6, %rcx
+	JBE  BB0_63
+	QUAD $0x00000138248c8b48                   // movq	312(%rsp), %rcx
+	WORD $0x0148; BYTE $0xce                   // addq	%rcx, %rsi
+	LONG $0x062c8d4e                           // leaq	(%rsi,%r8), %r13
+	WORD $0x014c; BYTE $0xe6                   // addq	%r12, %rsi
+	LONG $0x107cc1c4; WORD $0xb71c             // vmovups	(%r15,%rsi,4), %ymm3
+	LONG $0x5964a1c4; WORD $0xa81c             // vmulps	(%rax,%r13,4), %ymm3, %ymm3
+	WORD $0x8948; BYTE $0xde                   // movq	%rbx, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	WORD $0x0149; BYTE $0xf3                   // addq	%rsi, %r11
+	WORD $0xe383; BYTE $0x07                   // andl	$7, %ebx
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xcbc660c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm9
+	LONG $0xe3c6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm4
+	LONG $0x587ac1c4; BYTE $0xc1               // vaddss	%xmm9, %xmm0, %xmm0
+	LONG $0xcb1560c5                           // vunpckhps	%xmm3, %xmm3, %xmm9
+	LONG $0x587ac1c4; BYTE $0xc1               // vaddss	%xmm9, %xmm0, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xdc19; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm4
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xe303; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm4
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xe303; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm4
+	LONG $0x2865f362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm3
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	JE   BB0_58
+
+BB0_63:
+	LONG $0x1c348d4b               // leaq	(%r12,%r11), %rsi
+	LONG $0x181c8d4b               // leaq	(%r8,%r11), %rbx
+	LONG $0x2410fac5; BYTE $0x98   // vmovss	(%rax,%rbx,4), %xmm4
+	LONG $0xb959c2c4; WORD $0xb704 // vfmadd231ss	(%r15,%rsi,4), %xmm4, %xmm0
+	LONG $0x01738d49               // leaq	1(%r11), %rsi
+	WORD $0x3948; BYTE $0xd6       // cmpq	%rdx, %rsi
+	JGE  BB0_58
+	LONG $0x061c8d4a               // leaq	(%rsi,%r8), %rbx
+	WORD $0x014c; BYTE $0xe6       // addq	%r12, %rsi
+	LONG $0x2410fac5; BYTE $0x98   // vmovss	(%rax,%rbx,4), %xmm4
+	LONG $0xb959c2c4; WORD $0xb704 // vfmadd231ss	(%r15,%rsi,4), %xmm4, %xmm0
+	LONG $0x02738d49               // leaq	2(%r11), %rsi
+	WORD $0x3948; BYTE $0xd6       // cmpq	%rdx, %rsi
+	JGE  BB0_58
+	LONG $0x261c8d4a               // leaq	(%rsi,%r12), %rbx
+	WORD $0x014c; BYTE $0xc6       // addq	%r8, %rsi
+	LONG $0x107ac1c4; WORD $0x9f24 // vmovss	(%r15,%rbx,4), %xmm4
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	LONG $0x03738d49               // leaq	3(%r11), %rsi
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_58
+	LONG $0x261c8d4a               // leaq	(%rsi,%r12), %rbx
+	WORD $0x014c; BYTE $0xc6       // addq	%r8, %rsi
+	LONG $0x107ac1c4; WORD $0x9f24 // vmovss	(%r15,%rbx,4), %xmm4
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	LONG $0x04738d49               // leaq	4(%r11), %rsi
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_58
+	LONG $0x301c8d49               // leaq	(%r8,%rsi), %rbx
+	WORD $0x014c; BYTE $0xe6       // addq	%r12, %rsi
+	LONG $0x2410fac5; BYTE $0x98   // vmovss	(%rax,%rbx,4), %xmm4
+	LONG $0xb959c2c4; WORD $0xb704 // vfmadd231ss	(%r15,%rsi,4), %xmm4, %xmm0
+	LONG $0x05738d49               // leaq	5(%r11), %rsi
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_58
+	LONG $0x261c8d4a               // leaq	(%rsi,%r12), %rbx
+	LONG $0x06c38349               // addq	$6, %r11
+	WORD $0x014c; BYTE $0xc6       // addq	%r8, %rsi
+	LONG $0x107ac1c4; WORD $0x9f24 // vmovss	(%r15,%rbx,4), %xmm4
+	LONG $0xb959e2c4; WORD $0xb004 // vfmadd231ss	(%rax,%rsi,4), %xmm4, %xmm0
+	WORD $0x394c; BYTE $0xda       // cmpq	%r11, %rdx
+	JLE  BB0_58
+	LONG $0x18348d4b               // leaq	(%r8,%r11), %rsi
+	WORD $0x014d; BYTE $0xe3       // addq	%r12, %r11
+	LONG $0x2410fac5; BYTE $0xb0   // vmovss	(%rax,%rsi,4), %xmm4
+	LONG $0xb95982c4; WORD $0x9f04 // vfmadd231ss	(%r15,%r11,4), %xmm4, %xmm0
+
+BB0_58:
+	QUAD $0x00000110248c394c       // cmpq	%r9, 272(%rsp)
+	JLE  BB0_65
+	LONG $0x7ef961c4; BYTE $0xd3   // vmovq	%xmm10, %rbx
+	WORD $0x8548; BYTE $0xdb       // testq	%rbx, %rbx
+	JE   BB0_66
+	LONG $0x587aa1c4; WORD $0x8b04 // vaddss	(%rbx,%r9,4), %xmm0, %xmm0
+
+BB0_66:
+	QUAD $0x00000118249c8b48       // movq	280(%rsp), %rbx
+	LONG $0x117aa1c4; WORD $0x8b04 // vmovss	%xmm0, (%rbx,%r9,4)
+
+BB0_67:
+	LONG $0x7ef9e1c4; BYTE $0xcb // vmovq	%xmm1, %rbx
+	LONG $0x01c18349             // addq	$1, %r9
+	WORD $0x0149; BYTE $0xd4     // addq	%rdx, %r12
+	WORD $0x0149; BYTE $0xda     // addq	%rbx, %r10
+	QUAD $0x000000f0248c394c     // cmpq	%r9, 240(%rsp)
+	JG   BB0_69
+	LONG $0xc16f79c5             // vmovdqa	%xmm1, %xmm8
+
+BB0_70:
+	LONG $0x7ef961c4; BYTE $0xc1         // vmovq	%xmm8, %rcx
+	QUAD $0x000000b824b48b48             // movq	184(%rsp), %rsi
+	WORD $0x0149; BYTE $0xd0             // addq	%rdx, %r8
+	QUAD $0x0000012824848348; BYTE $0x01 // addq	$1, 296(%rsp)
+	QUAD $0x0000010024b40148             // addq	%rsi, 256(%rsp)
+	QUAD $0x00000128249c8b48             // movq	296(%rsp), %rbx
+	WORD $0x0148; BYTE $0xcf             // addq	%rcx, %rdi
+	QUAD $0x0000011024b48b48             // movq	272(%rsp), %rsi
+	QUAD $0x0000010824b40148             // addq	%rsi, 264(%rsp)
+	QUAD $0x00000080249c3948             // cmpq	%rbx, 128(%rsp)
+	JNE  BB0_55
+
+BB0_143:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x90a58d48; WORD $0xfffe; BYTE $0xff // leaq	-368(%rbp), %rsp
+	RET
+
+BB0_30:
+	LONG $0x7ef9e1c4; BYTE $0xf9   // vmovq	%xmm7, %rcx
+	WORD $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JE   BB0_33
+	LONG $0x08fde162; WORD $0xe17e // vmovq	%xmm20, %rcx
+	LONG $0x107aa1c4; WORD $0x8924 // vmovss	(%rcx,%r9,4), %xmm4
+	LONG $0xdc58e2c5               // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0xd458eac5               // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0xcc58f2c5               // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xc458fac5               // vaddss	%xmm4, %xmm0, %xmm0
+
+BB0_33:
+	QUAD $0x000000e0248c8b48     // movq	224(%rsp), %rcx
+	QUAD $0x000000b824b48b48     // movq	184(%rsp), %rsi
+	LONG $0x1911fac5             // vmovss	%xmm3, (%rcx)
+	LONG $0x1411fac5; BYTE $0xb1 // vmovss	%xmm2, (%rcx,%rsi,4)
+	QUAD $0x000000b024b48b48     // movq	176(%rsp), %rsi
+	LONG $0x0c11fac5; BYTE $0xb1 // vmovss	%xmm1, (%rcx,%rsi,4)
+	QUAD $0x000000a824b48b48     // movq	168(%rsp), %rsi
+	LONG $0x0411fac5; BYTE $0xb1 // vmovss	%xmm0, (%rcx,%rsi,4)
+	JMP  BB0_32
+
+BB0_15:
+	QUAD $0x000000c824bc8348; BYTE $0x00 // cmpq	$0, 200(%rsp)
+	JE   BB0_18
+	LONG $0x244c8b48; BYTE $0x78         // movq	120(%rsp), %rcx
+	LONG $0x107aa1c4; WORD $0x9124       // vmovss	(%rcx,%r10,4), %xmm4
+	LONG $0xdc58e2c5                     // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0xd458eac5                     // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0xcc58f2c5                     // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xc458fac5                     // vaddss	%xmm4, %xmm0, %xmm0
+
+BB0_18:
+	LONG $0x7ef961c4; BYTE $0xf9   // vmovq	%xmm15, %rcx
+	LONG $0x117aa1c4; WORD $0x911c // vmovss	%xmm3, (%rcx,%r10,4)
+	LONG $0x08fde162; WORD $0xc17e // vmovq	%xmm16, %rcx
+	LONG $0x117aa1c4; WORD $0x9114 // vmovss	%xmm2, (%rcx,%r10,4)
+	LONG $0x08fd6162; WORD $0xd97e // vmovq	%xmm27, %rcx
+	LONG $0x117aa1c4; WORD $0x910c // vmovss	%xmm1, (%rcx,%r10,4)
+	LONG $0x08fde162; WORD $0xd97e // vmovq	%xmm19, %rcx
+	LONG $0x117aa1c4; WORD $0x9104 // vmovss	%xmm0, (%rcx,%r10,4)
+	JMP  BB0_17
+
+BB0_65:
+	LONG $0x7ef9e1c4; BYTE $0xfb   // vmovq	%xmm7, %rbx
+	WORD $0x8548; BYTE $0xdb       // testq	%rbx, %rbx
+	JE   BB0_68
+	LONG $0x7ef9e1c4; BYTE $0xeb   // vmovq	%xmm5, %rbx
+	LONG $0x587aa1c4; WORD $0x8b04 // vaddss	(%rbx,%r9,4), %xmm0, %xmm0
+
+BB0_68:
+	QUAD $0x00000120249c8b48       // movq	288(%rsp), %rbx
+	LONG $0x117aa1c4; WORD $0x8b04 // vmovss	%xmm0, (%rbx,%r9,4)
+	JMP  BB0_67
+
+BB0_75:
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0x3145; BYTE $0xc0       // xorl	%r8d, %r8d
+	LONG $0x48fdf162; WORD $0xd128 // vmovapd	%zmm1, %zmm2
+	LONG $0x48fdf162; WORD $0xe928 // vmovapd	%zmm1, %zmm5
+	LONG $0x48fdf162; WORD $0xe128 // vmovapd	%zmm1, %zmm4
+	JMP  BB0_21
+
+BB0_72:
+	QUAD $0x000000a024b48b48       // movq	160(%rsp), %rsi
+	LONG $0x247c8b4c; BYTE $0x40   // movq	64(%rsp), %r15
+	WORD $0x3145; BYTE $0xd2       // xorl	%r10d, %r10d
+	WORD $0x0149; BYTE $0xf7       // addq	%rsi, %r15
+	LONG $0x08fdc162; WORD $0xcf6e // vmovq	%r15, %xmm17
+	LONG $0x08fdc162; WORD $0xf77e // vmovq	%xmm22, %r15
+	WORD $0x0149; BYTE $0xf7       // addq	%rsi, %r15
+	LONG $0x08fdc162; WORD $0xff6e // vmovq	%r15, %xmm23
+	LONG $0x08fdc162; WORD $0xef7e // vmovq	%xmm21, %r15
+	WORD $0x014c; BYTE $0xfe       // addq	%r15, %rsi
+	LONG $0x08fd6162; WORD $0xd66e // vmovq	%rsi, %xmm26
+	JMP  BB0_5
+
+BB0_73:
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0x3145; BYTE $0xc0       // xorl	%r8d, %r8d
+	LONG $0x48fdf162; WORD $0xd128 // vmovapd	%zmm1, %zmm2
+	LONG $0x48fdf162; WORD $0xc128 // vmovapd	%zmm1, %zmm0
+	LONG $0x48fdf162; WORD $0xe128 // vmovapd	%zmm1, %zmm4
+	JMP  BB0_6
+
+BB0_74:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_9
+
+BB0_76:
+	WORD $0x3145; BYTE $0xd2 // xorl	%r10d, %r10d
+	JMP  BB0_24
+
+BB0_79:
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	JMP  BB0_56
+
+BB0_38:
+	QUAD $0x00000100249c8b48       // movq	256(%rsp), %rbx
+	WORD $0x894d; BYTE $0xfa       // movq	%r15, %r10
+	WORD $0x3145; BYTE $0xed       // xorl	%r13d, %r13d
+	WORD $0x8949; BYTE $0xc1       // movq	%rax, %r9
+	QUAD $0x000000e0248c8b48       // movq	224(%rsp), %rcx
+	LONG $0x02e3c148               // salq	$2, %rbx
+	QUAD $0x00000120249c8948       // movq	%rbx, 288(%rsp)
+	WORD $0x0148; BYTE $0xcb       // addq	%rcx, %rbx
+	LONG $0x7ef961c4; BYTE $0xf1   // vmovq	%xmm14, %rcx
+	LONG $0x08fde162; WORD $0xc36e // vmovq	%rbx, %xmm16
+	QUAD $0x00000108249c8b48       // movq	264(%rsp), %rbx
+	LONG $0x02e3c148               // salq	$2, %rbx
+	QUAD $0x00000118249c8948       // movq	%rbx, 280(%rsp)
+	WORD $0x0148; BYTE $0xcb       // addq	%rcx, %rbx
+	LONG $0x6ef961c4; BYTE $0xfb   // vmovq	%rbx, %xmm15
+	WORD $0xdb31                   // xorl	%ebx, %ebx
+
+BB0_54:
+	LONG $0x0ffa8348             // cmpq	$15, %rdx
+	JLE  BB0_77
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x000010b8; BYTE $0x00 // movl	$16, %eax
+
+BB0_42:
+	QUAD $0xff875c10487cf162 // vmovups	-64(%rdi,%rax,4), %zmm3
+	QUAD $0xff8244b84865d262 // vfmadd231ps	-64(%r10,%rax,4), %zmm3, %zmm0
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JLE  BB0_42
+	QUAD $0x00000130249c8b4c // movq	304(%rsp), %r11
+
+BB0_41:
+	LONG $0x48fdd362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm9
+	LONG $0xc058b4c5                           // vaddps	%ymm0, %ymm9, %ymm0
+	LONG $0x197dc3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm9
+	LONG $0xc058b0c5                           // vaddps	%xmm0, %xmm9, %xmm0
+	LONG $0x047963c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm9
+	LONG $0xc85830c5                           // vaddps	%xmm0, %xmm9, %xmm9
+	LONG $0xc82978c5                           // vmovaps	%xmm9, %xmm0
+	LONG $0xc63041c4; WORD $0x55c9             // vshufps	$85, %xmm9, %xmm9, %xmm9
+	LONG $0x587ac1c4; BYTE $0xc1               // vaddss	%xmm9, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xda                   // cmpq	%r11, %rdx
+	JLE  BB0_43
+	WORD $0x8949; BYTE $0xd6                   // movq	%rdx, %r14
+	QUAD $0x00000138249c894c                   // movq	%r11, 312(%rsp)
+	WORD $0x294d; BYTE $0xde                   // subq	%r11, %r14
+	LONG $0xff468d49                           // leaq	-1(%r14), %rax
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_78
+	LONG $0x18048d4b                           // leaq	(%r8,%r11), %rax
+	WORD $0xf631                               // xorl	%esi, %esi
+	LONG $0x81248d4d                           // leaq	(%r9,%rax,4), %r12
+	LONG $0x2b048d4b                           // leaq	(%r11,%r13), %rax
+	LONG $0x870c8d49                           // leaq	(%r15,%rax,4), %rcx
+	WORD $0x894c; BYTE $0xf0                   // movq	%r14, %rax
+	LONG $0x04e8c148                           // shrq	$4, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+
+BB0_45:
+	LONG $0x487cd162; WORD $0x0c10; BYTE $0x34 // vmovups	(%r12,%rsi), %zmm1
+	LONG $0x48747162; WORD $0x0c59; BYTE $0x31 // vmulps	(%rcx,%rsi), %zmm1, %zmm9
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0xc63041c4; WORD $0x55e9             // vshufps	$85, %xmm9, %xmm9, %xmm13
+	LONG $0xc63041c4; WORD $0xffe1             // vshufps	$255, %xmm9, %xmm9, %xmm12
+	LONG $0x28355362; WORD $0xd903; BYTE $0x07 // valignd	$7, %ymm9, %ymm9, %ymm11
+	LONG $0x587ac1c4; BYTE $0xc1               // vaddss	%xmm9, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc5               // vaddss	%xmm13, %xmm0, %xmm0
+	LONG $0x153041c4; BYTE $0xe9               // vunpckhps	%xmm9, %xmm9, %xmm13
+	LONG $0x587ac1c4; BYTE $0xc5               // vaddss	%xmm13, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0x287d5362; WORD $0xcc19; BYTE $0x01 // vextractf32x4	$1, %ymm9, %xmm12
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0x28355362; WORD $0xe103; BYTE $0x05 // valignd	$5, %ymm9, %ymm9, %ymm12
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0x28355362; WORD $0xe103; BYTE $0x06 // valignd	$6, %ymm9, %ymm9, %ymm12
+	LONG $0x487d5362; WORD $0xc91b; BYTE $0x01 // vextractf32x8	$0x1, %zmm9, %ymm9
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0xc63041c4; WORD $0x55e1             // vshufps	$85, %xmm9, %xmm9, %xmm12
+	LONG $0x587ac1c4; BYTE $0xc3               // vaddss	%xmm11, %xmm0, %xmm0
+	LONG $0xc63041c4; WORD $0xffd9             // vshufps	$255, %xmm9, %xmm9, %xmm11
+	LONG $0x587ac1c4; BYTE $0xc1               // vaddss	%xmm9, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0x153041c4; BYTE $0xe1               // vunpckhps	%xmm9, %xmm9, %xmm12
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc3               // vaddss	%xmm11, %xmm0, %xmm0
+	LONG $0x287d5362; WORD $0xcb19; BYTE $0x01 // vextractf32x4	$1, %ymm9, %xmm11
+	LONG $0x587ac1c4; BYTE $0xc3               // vaddss	%xmm11, %xmm0, %xmm0
+	LONG $0x28355362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm9, %ymm9, %ymm11
+	LONG $0x587ac1c4; BYTE $0xc3               // vaddss	%xmm11, %xmm0, %xmm0
+	LONG $0x28355362; WORD $0xd903; BYTE $0x06 // valignd	$6, %ymm9, %ymm9, %ymm11
+	LONG $0x28355362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm9, %ymm9, %ymm9
+	LONG $0x587ac1c4; BYTE $0xc3               // vaddss	%xmm11, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc1               // vaddss	%xmm9, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JNE  BB0_45
+	WORD $0x894c; BYTE $0xf6                   // movq	%r14, %rsi
+	LONG $0xf0e68348                           // andq	$-16, %rsi
+	WORD $0x0149; BYTE $0xf3                   // addq	%rsi, %r11
+	LONG $0x0fc6f641                           // testb	$15, %r14b
+	JE   BB0_43
+
+BB0_44:
+	WORD $0x2949; BYTE $0xf6                   // subq	%rsi, %r14
+	LONG $0xff468d49                           // leaq	-1(%r14), %rax
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_48
+	QUAD $0x00000138248c8b48                   // movq	312(%rsp), %rcx
+	LONG $0x08048d49                           // leaq	(%r8,%rcx), %rax
+	LONG $0x31248d4c                           // leaq	(%rcx,%rsi), %r12
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	WORD $0x014d; BYTE $0xec                   // addq	%r13, %r12
+	LONG $0x107c01c4; WORD $0xa70c             // vmovups	(%r15,%r12,4), %ymm9
+	LONG $0x593441c4; WORD $0x810c             // vmulps	(%r9,%rax,4), %ymm9, %ymm9
+	WORD $0x894c; BYTE $0xf0                   // movq	%r14, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0149; BYTE $0xc3                   // addq	%rax, %r11
+	LONG $0x07e68341                           // andl	$7, %r14d
+	LONG $0x587ac1c4; BYTE $0xc1               // vaddss	%xmm9, %xmm0, %xmm0
+	LONG $0xc63041c4; WORD $0x55e1             // vshufps	$85, %xmm9, %xmm9, %xmm12
+	LONG $0xc63041c4; WORD $0xffd9             // vshufps	$255, %xmm9, %xmm9, %xmm11
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0x153041c4; BYTE $0xe1               // vunpckhps	%xmm9, %xmm9, %xmm12
+	LONG $0x587ac1c4; BYTE $0xc4               // vaddss	%xmm12, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc3               // vaddss	%xmm11, %xmm0, %xmm0
+	LONG $0x287d5362; WORD $0xcb19; BYTE $0x01 // vextractf32x4	$1, %ymm9, %xmm11
+	LONG $0x587ac1c4; BYTE $0xc3               // vaddss	%xmm11, %xmm0, %xmm0
+	LONG $0x28355362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm9, %ymm9, %ymm11
+	LONG $0x587ac1c4; BYTE $0xc3               // vaddss	%xmm11, %xmm0, %xmm0
+	LONG $0x28355362; WORD $0xd903; BYTE $0x06 // valignd	$6, %ymm9, %ymm9, %ymm11
+	LONG $0x28355362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm9, %ymm9, %ymm9
+	LONG $0x587ac1c4; BYTE $0xc3               // vaddss	%xmm11, %xmm0, %xmm0
+	LONG $0x587ac1c4; BYTE $0xc1               // vaddss	%xmm9, %xmm0, %xmm0
+	JE   BB0_43
+
+BB0_48:
+	LONG $0x1d448d4b; BYTE $0x00   // leaq	0(%r13,%r11), %rax
+	LONG $0x18348d4b               // leaq	(%r8,%r11), %rsi
+	LONG $0x107ac1c4; WORD $0xb10c // vmovss	(%r9,%rsi,4), %xmm1
+	LONG $0xb971c2c4; WORD $0x8704 // vfmadd231ss	(%r15,%rax,4), %xmm1, %xmm0
+	LONG $0x01438d49               // leaq	1(%r11), %rax
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_43
+	LONG $0x00348d49               // leaq	(%r8,%rax), %rsi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0x107ac1c4; WORD $0xb10c // vmovss	(%r9,%rsi,4), %xmm1
+	LONG $0xb971c2c4; WORD $0x8704 // vfmadd231ss	(%r15,%rax,4), %xmm1, %xmm0
+	LONG $0x02438d49               // leaq	2(%r11), %rax
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_43
+	LONG $0x00348d49               // leaq	(%r8,%rax), %rsi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0x107ac1c4; WORD $0xb10c // vmovss	(%r9,%rsi,4), %xmm1
+	LONG $0xb971c2c4; WORD $0x8704 // vfmadd231ss	(%r15,%rax,4), %xmm1, %xmm0
+	LONG $0x03438d49               // leaq	3(%r11), %rax
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_43
+	LONG $0x00348d49               // leaq	(%r8,%rax), %rsi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0x107ac1c4; WORD $0xb10c // vmovss	(%r9,%rsi,4), %xmm1
+	LONG $0xb971c2c4; WORD $0x8704 // vfmadd231ss	(%r15,%rax,4), %xmm1, %xmm0
+	LONG $0x04438d49               // leaq	4(%r11), %rax
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_43
+	LONG $0x00348d49               // leaq	(%r8,%rax), %rsi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0x107ac1c4; WORD $0xb11c // vmovss	(%r9,%rsi,4), %xmm3
+	LONG $0xb961c2c4; WORD $0x8704 // vfmadd231ss	(%r15,%rax,4), %xmm3, %xmm0
+	LONG $0x05438d49               // leaq	5(%r11), %rax
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JGE  BB0_43
+	LONG $0x00348d4a               // leaq	(%rax,%r8), %rsi
+	LONG $0x06c38349               // addq	$6, %r11
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0x107ac1c4; WORD $0xb10c // vmovss	(%r9,%rsi,4), %xmm1
+	LONG $0xb971c2c4; WORD $0x8704 // vfmadd231ss	(%r15,%rax,4), %xmm1, %xmm0
+	WORD $0x394c; BYTE $0xda       // cmpq	%r11, %rdx
+	JLE  BB0_43
+	LONG $0x18048d4b               // leaq	(%r8,%r11), %rax
+	WORD $0x014d; BYTE $0xeb       // addq	%r13, %r11
+	LONG $0x107ac1c4; WORD $0x811c // vmovss	(%r9,%rax,4), %xmm3
+	LONG $0xb96182c4; WORD $0x9f04 // vfmadd231ss	(%r15,%r11,4), %xmm3, %xmm0
+
+BB0_43:
+	QUAD $0x00000110249c3948     // cmpq	%rbx, 272(%rsp)
+	JLE  BB0_50
+	LONG $0x7ef961c4; BYTE $0xd0 // vmovq	%xmm10, %rax
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_51
+	LONG $0x0458fac5; BYTE $0x98 // vaddss	(%rax,%rbx,4), %xmm0, %xmm0
+
+BB0_51:
+	LONG $0x7ef961c4; BYTE $0xf8 // vmovq	%xmm15, %rax
+	LONG $0x0411fac5; BYTE $0x98 // vmovss	%xmm0, (%rax,%rbx,4)
+
+BB0_52:
+	LONG $0x7ef961c4; BYTE $0xc0 // vmovq	%xmm8, %rax
+	LONG $0x01c38348             // addq	$1, %rbx
+	WORD $0x0149; BYTE $0xd5     // addq	%rdx, %r13
+	WORD $0x0149; BYTE $0xc2     // addq	%rax, %r10
+	LONG $0x7ef9e1c4; BYTE $0xd0 // vmovq	%xmm2, %rax
+	WORD $0x3948; BYTE $0xc3     // cmpq	%rax, %rbx
+	JL   BB0_54
+	WORD $0x894c; BYTE $0xc8     // movq	%r9, %rax
+	WORD $0x8949; BYTE $0xd9     // movq	%rbx, %r9
+	QUAD $0x000000f0249c3948     // cmpq	%rbx, 240(%rsp)
+	JG   BB0_39
+	JMP  BB0_70
+
+BB0_50:
+	QUAD $0x000000c824bc8348; BYTE $0x00 // cmpq	$0, 200(%rsp)
+	JE   BB0_53
+	LONG $0x7ef9e1c4; BYTE $0xf0         // vmovq	%xmm6, %rax
+	LONG $0x0458fac5; BYTE $0x98         // vaddss	(%rax,%rbx,4), %xmm0, %xmm0
+
+BB0_53:
+	LONG $0x08fde162; WORD $0xc07e // vmovq	%xmm16, %rax
+	LONG $0x0411fac5; BYTE $0x98   // vmovss	%xmm0, (%rax,%rbx,4)
+	JMP  BB0_52
+
+BB0_77:
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	JMP  BB0_41
+
+BB0_78:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_44
+
+BB0_80:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_59
+
+BB0_71:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_2
@@ -0,0 +1,14 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baseqkvdense_c_f64_avx2_amd64.c
+
+package asm
+
+import "unsafe"
+
+//go:noescape
+func qkvdense_c_f64_avx2(x, wQKV, biasQ, biasK, biasV, q, k, v, pbatchSize, pinFeatures, pqDim, pkvDim, plen_x, plen_wQKV, plen_biasQ, plen_biasK, plen_biasV, plen_q, plen_k, plen_v unsafe.Pointer)
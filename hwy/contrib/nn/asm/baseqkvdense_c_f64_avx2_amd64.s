@@ -0,0 +1,1128 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baseqkvdense_c_f64_avx2_amd64.c
+
+TEXT ·qkvdense_c_f64_avx2(SB), $592-160
+	MOVQ x+0(FP), DI
+	MOVQ wQKV+8(FP), SI
+	MOVQ biasQ+16(FP), DX
+	MOVQ biasK+24(FP), CX
+	MOVQ biasV+32(FP), R8
+	MOVQ q+40(FP), R9
+	MOVQ k+48(FP), R11
+	MOVQ R11, 480(SP)
+	MOVQ v+56(FP), R11
+	MOVQ R11, 488(SP)
+	MOVQ pbatchSize+64(FP), R11
+	MOVQ R11, 496(SP)
+	MOVQ pinFeatures+72(FP), R11
+	MOVQ R11, 504(SP)
+	MOVQ pqDim+80(FP), R11
+	MOVQ R11, 512(SP)
+	MOVQ pkvDim+88(FP), R11
+	MOVQ R11, 520(SP)
+	MOVQ plen_x+96(FP), R11
+	MOVQ R11, 528(SP)
+	MOVQ plen_wQKV+104(FP), R11
+	MOVQ R11, 536(SP)
+	MOVQ plen_biasQ+112(FP), R11
+	MOVQ R11, 544(SP)
+	MOVQ plen_biasK+120(FP), R11
+	MOVQ R11, 552(SP)
+	MOVQ plen_biasV+128(FP), R11
+	MOVQ R11, 560(SP)
+	MOVQ plen_q+136(FP), R11
+	MOVQ R11, 568(SP)
+	MOVQ plen_k+144(FP), R11
+	MOVQ R11, 576(SP)
+	MOVQ plen_v+152(FP), R11
+	MOVQ R11, 584(SP)
+	QUAD $0x000001d024ac8d48                   // leaq	464(%rsp), %rbp
+	WORD $0x8949; BYTE $0xfc                   // movq	%rdi, %r12
+	WORD $0x8948; BYTE $0xf3                   // movq	%rsi, %rbx
+	LONG $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348                           // andq	$-32, %rsp
+	LONG $0x20458b48                           // movq	32(%rbp), %rax
+	QUAD $0x0000013024948948                   // movq	%rdx, 304(%rsp)
+	WORD $0x8b4c; BYTE $0x18                   // movq	(%rax), %r11
+	LONG $0x28458b48                           // movq	40(%rbp), %rax
+	LONG $0x244c894c; BYTE $0x70               // movq	%r9, 112(%rsp)
+	QUAD $0x000001002484894c                   // movq	%r8, 256(%rsp)
+	LONG $0x10458b4c                           // movq	16(%rbp), %r8
+	WORD $0x8b4c; BYTE $0x38                   // movq	(%rax), %r15
+	LONG $0x38458b48                           // movq	56(%rbp), %rax
+	QUAD $0x000000f8248c8948                   // movq	%rcx, 248(%rsp)
+	QUAD $0x000000b0249c894c                   // movq	%r11, 176(%rsp)
+	WORD $0x8b48; BYTE $0x10                   // movq	(%rax), %rdx
+	LONG $0x30458b48                           // movq	48(%rbp), %rax
+	WORD $0x8b48; BYTE $0x38                   // movq	(%rax), %rdi
+	LONG $0x12048d48                           // leaq	(%rdx,%rdx), %rax
+	QUAD $0x000000f024948948                   // movq	%rdx, 240(%rsp)
+	LONG $0x38348d48                           // leaq	(%rax,%rdi), %rsi
+	QUAD $0x0000018024bc8948                   // movq	%rdi, 384(%rsp)
+	QUAD $0x0000016824b48948                   // movq	%rsi, 360(%rsp)
+	LONG $0x03fb8349                           // cmpq	$3, %r11
+	JLE  BB0_71
+	QUAD $0x00000000951c8d4c                   // leaq	0(,%rdx,4), %r11
+	LONG $0x3f348d4f                           // leaq	(%r15,%r15), %r14
+	WORD $0x894d; BYTE $0xca                   // movq	%r9, %r10
+	QUAD $0x000000c024848948                   // movq	%rax, 192(%rsp)
+	LONG $0x245c894c; BYTE $0x68               // movq	%r11, 104(%rsp)
+	LONG $0x101c8d4c                           // leaq	(%rax,%rdx), %r11
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	LONG $0x05e7c148                           // salq	$5, %rdi
+	QUAD $0x000001b824b4894c                   // movq	%r14, 440(%rsp)
+	WORD $0x014d; BYTE $0xfe                   // addq	%r15, %r14
+	QUAD $0x00000000bd348d4a                   // leaq	0(,%r15,4), %rsi
+	QUAD $0x000000b8249c894c                   // movq	%r11, 184(%rsp)
+	QUAD $0x00000000fd1c8d4e                   // leaq	0(,%r15,8), %r11
+	QUAD $0x000001a024b4894c                   // movq	%r14, 416(%rsp)
+	WORD $0x894d; BYTE $0xfe                   // movq	%r15, %r14
+	LONG $0x1c0c8d4f                           // leaq	(%r12,%r11), %r9
+	LONG $0x05e6c149                           // salq	$5, %r14
+	LONG $0x247c8948; BYTE $0x58               // movq	%rdi, 88(%rsp)
+	WORD $0x8948; BYTE $0xd7                   // movq	%rdx, %rdi
+	LONG $0x05e2c148                           // salq	$5, %rdx
+	LONG $0x2474894c; BYTE $0x60               // movq	%r14, 96(%rsp)
+	LONG $0x19348d4f                           // leaq	(%r9,%r11), %r14
+	LONG $0x24548948; BYTE $0x50               // movq	%rdx, 80(%rsp)
+	WORD $0x8948; BYTE $0xfa                   // movq	%rdi, %rdx
+	WORD $0x8948; BYTE $0xc7                   // movq	%rax, %rdi
+	LONG $0x1e2c8d4f                           // leaq	(%r14,%r11), %r13
+	QUAD $0x00000170249c894c                   // movq	%r11, 368(%rsp)
+	LONG $0x021c8d4c                           // leaq	(%rdx,%rax), %r11
+	WORD $0x2948; BYTE $0xfa                   // subq	%rdi, %rdx
+	LONG $0xfc478d49                           // leaq	-4(%r15), %rax
+	LONG $0x02e8c148                           // shrq	$2, %rax
+	LONG $0xd0148d49                           // leaq	(%r8,%rdx,8), %rdx
+	QUAD $0x0000019024a4894c                   // movq	%r12, 400(%rsp)
+	QUAD $0x0000000485048d48                   // leaq	4(,%rax,4), %rax
+	LONG $0x24548948; BYTE $0x28               // movq	%rdx, 40(%rsp)
+	QUAD $0x000000c024948b48                   // movq	192(%rsp), %rdx
+	QUAD $0x0000016024848948                   // movq	%rax, 352(%rsp)
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	WORD $0x2948; BYTE $0xfa                   // subq	%rdi, %rdx
+	WORD $0xf748; BYTE $0xd8                   // negq	%rax
+	QUAD $0x000001b024bc894c                   // movq	%r15, 432(%rsp)
+	LONG $0x03e0c148                           // salq	$3, %rax
+	LONG $0xd0148d49                           // leaq	(%r8,%rdx,8), %rdx
+	QUAD $0x000001a82484c748; LONG $0x00000000 // movq	$0, 424(%rsp)
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x24548948; BYTE $0x20               // movq	%rdx, 32(%rsp)
+	QUAD $0x000000b824948b48                   // movq	184(%rsp), %rdx
+	QUAD $0x000000a8248c8948                   // movq	%rcx, 168(%rsp)
+	LONG $0x000c8d4a                           // leaq	(%rax,%r8), %rcx
+	LONG $0xd1148d48                           // leaq	(%rcx,%rdx,8), %rdx
+	LONG $0x244c8948; BYTE $0x30               // movq	%rcx, 48(%rsp)
+	QUAD $0x00000100248c8b48                   // movq	256(%rsp), %rcx
+	LONG $0x24548948; BYTE $0x18               // movq	%rdx, 24(%rsp)
+	WORD $0x894c; BYTE $0xd2                   // movq	%r10, %rdx
+	WORD $0x2949; BYTE $0xc2                   // subq	%rax, %r10
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	LONG $0x04e0c148                           // salq	$4, %rax
+	LONG $0x2454894c; BYTE $0x48               // movq	%r10, 72(%rsp)
+	WORD $0x8949; BYTE $0xd2                   // movq	%rdx, %r10
+	LONG $0x10148d48                           // leaq	(%rax,%rdx), %rdx
+	LONG $0x7f048d48                           // leaq	(%rdi,%rdi,2), %rax
+	QUAD $0x000000a02484c748; LONG $0x00000000 // movq	$0, 160(%rsp)
+	LONG $0xc23c8d49                           // leaq	(%r10,%rax,8), %rdi
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	WORD $0x3145; BYTE $0xd2                   // xorl	%r10d, %r10d
+	LONG $0x24548948; BYTE $0x40               // movq	%rdx, 64(%rsp)
+	WORD $0xf748; BYTE $0xd8                   // negq	%rax
+	WORD $0xd231                               // xorl	%edx, %edx
+	LONG $0x247c8948; BYTE $0x38               // movq	%rdi, 56(%rsp)
+	WORD $0x894c; BYTE $0xdf                   // movq	%r11, %rdi
+	LONG $0xc10c8d48                           // leaq	(%rcx,%rax,8), %rcx
+	QUAD $0x0000016824848b48                   // movq	360(%rsp), %rax
+	QUAD $0x000001082484c748; LONG $0x00000003 // movq	$3, 264(%rsp)
+	QUAD $0x000000902494894c                   // movq	%r10, 144(%rsp)
+	WORD $0x394c; BYTE $0xd8                   // cmpq	%r11, %rax
+	QUAD $0x00000088249c894c                   // movq	%r11, 136(%rsp)
+	WORD $0x894d; BYTE $0xcb                   // movq	%r9, %r11
+	LONG $0xf84e0f48                           // cmovle	%rax, %rdi
+	QUAD $0x00000098248c8948                   // movq	%rcx, 152(%rsp)
+	WORD $0x894c; BYTE $0xe9                   // movq	%r13, %rcx
+	QUAD $0x00000198249c8948                   // movq	%rbx, 408(%rsp)
+	WORD $0x894c; BYTE $0xe3                   // movq	%r12, %rbx
+	QUAD $0x0000011024bc8948                   // movq	%rdi, 272(%rsp)
+
+BB0_4:
+	QUAD $0x0000016824bc8348; BYTE $0x00       // cmpq	$0, 360(%rsp)
+	JLE  BB0_20
+	QUAD $0x0000008824bc8348; BYTE $0x00       // cmpq	$0, 136(%rsp)
+	JLE  BB0_72
+	QUAD $0x0000009024848b48                   // movq	144(%rsp), %rax
+	LONG $0x24448b4c; BYTE $0x30               // movq	48(%rsp), %r8
+	LONG $0x24548948; BYTE $0x78               // movq	%rdx, 120(%rsp)
+	WORD $0x3145; BYTE $0xd2                   // xorl	%r10d, %r10d
+	QUAD $0x0000008024b48948                   // movq	%rsi, 128(%rsp)
+	QUAD $0x0000019824bc8b48                   // movq	408(%rsp), %rdi
+	QUAD $0x000001902484c748; LONG $0x00000000 // movq	$0, 400(%rsp)
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	QUAD $0x000000e02484894c                   // movq	%r8, 224(%rsp)
+	LONG $0x24448b4c; BYTE $0x28               // movq	40(%rsp), %r8
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	QUAD $0x000000d82484894c                   // movq	%r8, 216(%rsp)
+	LONG $0x24448b4c; BYTE $0x20               // movq	32(%rsp), %r8
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+	QUAD $0x000000d02484894c                   // movq	%r8, 208(%rsp)
+	LONG $0x24448b4c; BYTE $0x18               // movq	24(%rsp), %r8
+	WORD $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+	QUAD $0x000000e824848948                   // movq	%rax, 232(%rsp)
+	LONG $0x24448b48; BYTE $0x48               // movq	72(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	QUAD $0x0000012824848948                   // movq	%rax, 296(%rsp)
+	LONG $0x24448b48; BYTE $0x40               // movq	64(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	QUAD $0x0000012024848948                   // movq	%rax, 288(%rsp)
+	LONG $0x24448b48; BYTE $0x38               // movq	56(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	QUAD $0x0000011824848948                   // movq	%rax, 280(%rsp)
+	LONG $0x24448b48; BYTE $0x70               // movq	112(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	QUAD $0x000000c824848948                   // movq	%rax, 200(%rsp)
+	WORD $0x894c; BYTE $0xf0                   // movq	%r14, %rax
+	WORD $0x894d; BYTE $0xd6                   // movq	%r10, %r14
+	WORD $0x894d; BYTE $0xda                   // movq	%r11, %r10
+	WORD $0x8949; BYTE $0xc3                   // movq	%rax, %r11
+
+BB0_19:
+	LONG $0x03ff8349             // cmpq	$3, %r15
+	JLE  BB0_73
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+	LONG $0xd128fdc5             // vmovapd	%ymm1, %ymm2
+	LONG $0xd928fdc5             // vmovapd	%ymm1, %ymm3
+	LONG $0xe128fdc5             // vmovapd	%ymm1, %ymm4
+
+BB0_7:
+	LONG $0x4410fdc5; WORD $0xe0c7             // vmovupd	-32(%rdi,%rax,8), %ymm0
+	LONG $0xb8fde2c4; WORD $0xc364; BYTE $0xe0 // vfmadd231pd	-32(%rbx,%rax,8), %ymm0, %ymm4
+	LONG $0xb8fdc2c4; WORD $0xc25c; BYTE $0xe0 // vfmadd231pd	-32(%r10,%rax,8), %ymm0, %ymm3
+	LONG $0xb8fdc2c4; WORD $0xc354; BYTE $0xe0 // vfmadd231pd	-32(%r11,%rax,8), %ymm0, %ymm2
+	LONG $0xb8fde2c4; WORD $0xc14c; BYTE $0xe0 // vfmadd231pd	-32(%rcx,%rax,8), %ymm0, %ymm1
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_7
+	QUAD $0x0000016024848b48                   // movq	352(%rsp), %rax
+
+BB0_6:
+	LONG $0x197de3c4; WORD $0x01e5 // vextractf128	$0x1, %ymm4, %xmm5
+	LONG $0xec58d1c5               // vaddpd	%xmm4, %xmm5, %xmm5
+	LONG $0x197de3c4; WORD $0x01dc // vextractf128	$0x1, %ymm3, %xmm4
+	LONG $0xe358d9c5               // vaddpd	%xmm3, %xmm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01d3 // vextractf128	$0x1, %ymm2, %xmm3
+	LONG $0xda58e1c5               // vaddpd	%xmm2, %xmm3, %xmm3
+	LONG $0x197de3c4; WORD $0x01ca // vextractf128	$0x1, %ymm1, %xmm2
+	LONG $0xc515d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm0
+	LONG $0xe858d3c5               // vaddsd	%xmm0, %xmm5, %xmm5
+	LONG $0xc415d9c5               // vunpckhpd	%xmm4, %xmm4, %xmm0
+	LONG $0xe058dbc5               // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0xc315e1c5               // vunpckhpd	%xmm3, %xmm3, %xmm0
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc258f1c5               // vaddpd	%xmm2, %xmm1, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_8
+	WORD $0x894d; BYTE $0xf9       // movq	%r15, %r9
+	WORD $0x8948; BYTE $0xc6       // movq	%rax, %rsi
+	WORD $0x2949; BYTE $0xc1       // subq	%rax, %r9
+	LONG $0xff518d49               // leaq	-1(%r9), %rdx
+	QUAD $0x00000188248c894c       // movq	%r9, 392(%rsp)
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_74
+	QUAD $0x000001a824948b48       // movq	424(%rsp), %rdx
+	QUAD $0x0000019824848b4c       // movq	408(%rsp), %r8
+	QUAD $0x0000014824bc894c       // movq	%r15, 328(%rsp)
+	LONG $0x02e9c149               // shrq	$2, %r9
+	QUAD $0x00000140249c8948       // movq	%rbx, 320(%rsp)
+	LONG $0x05e1c149               // salq	$5, %r9
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	QUAD $0x000001382494894c       // movq	%r10, 312(%rsp)
+	LONG $0xd4148d49               // leaq	(%r12,%rdx,8), %rdx
+	QUAD $0x0000017824948948       // movq	%rdx, 376(%rsp)
+	LONG $0x30148d4a               // leaq	(%rax,%r14), %rdx
+	QUAD $0x0000017824948b4c       // movq	376(%rsp), %r10
+	LONG $0xd02c8d4d               // leaq	(%r8,%rdx,8), %r13
+	QUAD $0x000001b024848b4c       // movq	432(%rsp), %r8
+	LONG $0x00148d49               // leaq	(%r8,%rax), %rdx
+	LONG $0xd4048d4d               // leaq	(%r12,%rdx,8), %r8
+	QUAD $0x000001b824948b48       // movq	440(%rsp), %rdx
+	QUAD $0x000001582484894c       // movq	%r8, 344(%rsp)
+	QUAD $0x000001a024848b4c       // movq	416(%rsp), %r8
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	QUAD $0x00000158249c8b48       // movq	344(%rsp), %rbx
+	LONG $0xd4148d49               // leaq	(%r12,%rdx,8), %rdx
+	QUAD $0x0000015024948948       // movq	%rdx, 336(%rsp)
+	LONG $0x00148d4a               // leaq	(%rax,%r8), %rdx
+	QUAD $0x0000015024bc8b4c       // movq	336(%rsp), %r15
+	LONG $0xd4048d4d               // leaq	(%r12,%rdx,8), %r8
+	WORD $0xd231                   // xorl	%edx, %edx
+
+BB0_10:
+	LONG $0x107dc1c4; WORD $0x154c; BYTE $0x00 // vmovupd	0(%r13,%rdx), %ymm1
+	LONG $0x5975c1c4; WORD $0x1214             // vmulpd	(%r10,%rdx), %ymm1, %ymm2
+	LONG $0xea58d3c5                           // vaddsd	%xmm2, %xmm5, %xmm5
+	LONG $0xfa15e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm7
+	LONG $0x197de3c4; WORD $0x01d2             // vextractf128	$0x1, %ymm2, %xmm2
+	LONG $0xef58d3c5                           // vaddsd	%xmm7, %xmm5, %xmm5
+	LONG $0xea58d3c5                           // vaddsd	%xmm2, %xmm5, %xmm5
+	LONG $0xd215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xea58d3c5                           // vaddsd	%xmm2, %xmm5, %xmm5
+	LONG $0x1459f5c5; BYTE $0x13               // vmulpd	(%rbx,%rdx), %ymm1, %ymm2
+	LONG $0xe258dbc5                           // vaddsd	%xmm2, %xmm4, %xmm4
+	LONG $0xfa15e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm7
+	LONG $0x197de3c4; WORD $0x01d2             // vextractf128	$0x1, %ymm2, %xmm2
+	LONG $0xe758dbc5                           // vaddsd	%xmm7, %xmm4, %xmm4
+	LONG $0xe258dbc5                           // vaddsd	%xmm2, %xmm4, %xmm4
+	LONG $0xd215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xe258dbc5                           // vaddsd	%xmm2, %xmm4, %xmm4
+	LONG $0x5975c1c4; WORD $0x1714             // vmulpd	(%r15,%rdx), %ymm1, %ymm2
+	LONG $0x5975c1c4; WORD $0x100c             // vmulpd	(%r8,%rdx), %ymm1, %ymm1
+	LONG $0x20c28348                           // addq	$32, %rdx
+	LONG $0xda58e3c5                           // vaddsd	%xmm2, %xmm3, %xmm3
+	LONG $0xfa15e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm7
+	LONG $0x197de3c4; WORD $0x01d2             // vextractf128	$0x1, %ymm2, %xmm2
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xf115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm6
+	LONG $0x197de3c4; WORD $0x01c9             // vextractf128	$0x1, %ymm1, %xmm1
+	LONG $0xdf58e3c5                           // vaddsd	%xmm7, %xmm3, %xmm3
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0xda58e3c5                           // vaddsd	%xmm2, %xmm3, %xmm3
+	LONG $0xd215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xda58e3c5                           // vaddsd	%xmm2, %xmm3, %xmm3
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JNE  BB0_10
+	QUAD $0x0000018824848b4c                   // movq	392(%rsp), %r8
+	QUAD $0x0000014824bc8b4c                   // movq	328(%rsp), %r15
+	QUAD $0x00000140249c8b48                   // movq	320(%rsp), %rbx
+	QUAD $0x0000013824948b4c                   // movq	312(%rsp), %r10
+	WORD $0x894c; BYTE $0xc2                   // movq	%r8, %rdx
+	LONG $0xfce28348                           // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x03e08341                           // andl	$3, %r8d
+	JE   BB0_8
+
+BB0_9:
+	QUAD $0x0000018824848b4c                   // movq	392(%rsp), %r8
+	WORD $0x2949; BYTE $0xd0                   // subq	%rdx, %r8
+	LONG $0x01f88349                           // cmpq	$1, %r8
+	JE   BB0_13
+	LONG $0x360c8d4e                           // leaq	(%rsi,%r14), %r9
+	QUAD $0x0000019824ac8b4c                   // movq	408(%rsp), %r13
+	WORD $0x0149; BYTE $0xd1                   // addq	%rdx, %r9
+	LONG $0x107981c4; WORD $0xcd4c; BYTE $0x00 // vmovupd	0(%r13,%r9,8), %xmm1
+	QUAD $0x000001a8248c8b4c                   // movq	424(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1                   // addq	%rsi, %r9
+	WORD $0x0149; BYTE $0xd1                   // addq	%rdx, %r9
+	LONG $0x597181c4; WORD $0xcc14             // vmulpd	(%r12,%r9,8), %xmm1, %xmm2
+	QUAD $0x000001b0248c8b4c                   // movq	432(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1                   // addq	%rsi, %r9
+	WORD $0x0149; BYTE $0xd1                   // addq	%rdx, %r9
+	LONG $0xea58d3c5                           // vaddsd	%xmm2, %xmm5, %xmm5
+	LONG $0xd215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xed58ebc5                           // vaddsd	%xmm5, %xmm2, %xmm5
+	LONG $0x597181c4; WORD $0xcc14             // vmulpd	(%r12,%r9,8), %xmm1, %xmm2
+	QUAD $0x000001b8248c8b4c                   // movq	440(%rsp), %r9
+	WORD $0x0149; BYTE $0xf1                   // addq	%rsi, %r9
+	WORD $0x0149; BYTE $0xd1                   // addq	%rdx, %r9
+	LONG $0xe258dbc5                           // vaddsd	%xmm2, %xmm4, %xmm4
+	LONG $0xd215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xe458ebc5                           // vaddsd	%xmm4, %xmm2, %xmm4
+	LONG $0x597181c4; WORD $0xcc14             // vmulpd	(%r12,%r9,8), %xmm1, %xmm2
+	QUAD $0x000001a0248c8b4c                   // movq	416(%rsp), %r9
+	WORD $0x014c; BYTE $0xce                   // addq	%r9, %rsi
+	WORD $0x0148; BYTE $0xd6                   // addq	%rdx, %rsi
+	LONG $0x5971c1c4; WORD $0xf40c             // vmulpd	(%r12,%rsi,8), %xmm1, %xmm1
+	LONG $0xda58e3c5                           // vaddsd	%xmm2, %xmm3, %xmm3
+	LONG $0xd215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xdb58ebc5                           // vaddsd	%xmm3, %xmm2, %xmm3
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5                           // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0x01c0f641                           // testb	$1, %r8b
+	JE   BB0_8
+	LONG $0xfee08349                           // andq	$-2, %r8
+	WORD $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+
+BB0_13:
+	QUAD $0x0000019824b48b48       // movq	408(%rsp), %rsi
+	LONG $0x06148d49               // leaq	(%r14,%rax), %rdx
+	LONG $0x0c10fbc5; BYTE $0xd6   // vmovsd	(%rsi,%rdx,8), %xmm1
+	QUAD $0x000001a824b48b48       // movq	424(%rsp), %rsi
+	LONG $0x06148d48               // leaq	(%rsi,%rax), %rdx
+	QUAD $0x000001b024b48b48       // movq	432(%rsp), %rsi
+	LONG $0xb9f1c2c4; WORD $0xd42c // vfmadd231sd	(%r12,%rdx,8), %xmm1, %xmm5
+	LONG $0x06148d48               // leaq	(%rsi,%rax), %rdx
+	QUAD $0x000001b824b48b48       // movq	440(%rsp), %rsi
+	LONG $0xb9f1c2c4; WORD $0xd424 // vfmadd231sd	(%r12,%rdx,8), %xmm1, %xmm4
+	LONG $0x06148d48               // leaq	(%rsi,%rax), %rdx
+	QUAD $0x000001a024b48b48       // movq	416(%rsp), %rsi
+	LONG $0xb9f1c2c4; WORD $0xd41c // vfmadd231sd	(%r12,%rdx,8), %xmm1, %xmm3
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0xb9f1c2c4; WORD $0xc404 // vfmadd231sd	(%r12,%rax,8), %xmm1, %xmm0
+
+BB0_8:
+	QUAD $0x0000019024848b48     // movq	400(%rsp), %rax
+	QUAD $0x0000018024843948     // cmpq	%rax, 384(%rsp)
+	JLE  BB0_15
+	QUAD $0x0000013024b48b48     // movq	304(%rsp), %rsi
+	WORD $0x8548; BYTE $0xf6     // testq	%rsi, %rsi
+	JE   BB0_16
+	LONG $0x0c10fbc5; BYTE $0xc6 // vmovsd	(%rsi,%rax,8), %xmm1
+	LONG $0xe958d3c5             // vaddsd	%xmm1, %xmm5, %xmm5
+	LONG $0xe158dbc5             // vaddsd	%xmm1, %xmm4, %xmm4
+	LONG $0xd958e3c5             // vaddsd	%xmm1, %xmm3, %xmm3
+	LONG $0xc158fbc5             // vaddsd	%xmm1, %xmm0, %xmm0
+
+BB0_16:
+	QUAD $0x0000019024848b48     // movq	400(%rsp), %rax
+	QUAD $0x000000c824b48b48     // movq	200(%rsp), %rsi
+	LONG $0x2c11fbc5; BYTE $0xc6 // vmovsd	%xmm5, (%rsi,%rax,8)
+	QUAD $0x0000012824b48b48     // movq	296(%rsp), %rsi
+	LONG $0x2411fbc5; BYTE $0xc6 // vmovsd	%xmm4, (%rsi,%rax,8)
+	QUAD $0x0000012024b48b48     // movq	288(%rsp), %rsi
+	LONG $0x1c11fbc5; BYTE $0xc6 // vmovsd	%xmm3, (%rsi,%rax,8)
+	QUAD $0x0000011824b48b48     // movq	280(%rsp), %rsi
+	LONG $0x0411fbc5; BYTE $0xc6 // vmovsd	%xmm0, (%rsi,%rax,8)
+
+BB0_17:
+	QUAD $0x0000017024b48b48             // movq	368(%rsp), %rsi
+	WORD $0x014d; BYTE $0xfe             // addq	%r15, %r14
+	QUAD $0x0000019024848348; BYTE $0x01 // addq	$1, 400(%rsp)
+	QUAD $0x0000019024848b48             // movq	400(%rsp), %rax
+	WORD $0x0148; BYTE $0xf7             // addq	%rsi, %rdi
+	QUAD $0x0000011024b48b48             // movq	272(%rsp), %rsi
+	WORD $0x3948; BYTE $0xf0             // cmpq	%rsi, %rax
+	JL   BB0_19
+	WORD $0x894d; BYTE $0xde             // movq	%r11, %r14
+	QUAD $0x0000008024b48b48             // movq	128(%rsp), %rsi
+	LONG $0x24548b48; BYTE $0x78         // movq	120(%rsp), %rdx
+	WORD $0x894d; BYTE $0xd3             // movq	%r10, %r11
+	QUAD $0x0000016824843948             // cmpq	%rax, 360(%rsp)
+	JLE  BB0_20
+
+BB0_5:
+	QUAD $0x000000a024848b4c     // movq	160(%rsp), %r8
+	QUAD $0x0000008824bc8b48     // movq	136(%rsp), %rdi
+	QUAD $0x000000d024b48948     // movq	%rsi, 208(%rsp)
+	LONG $0x18558b4c             // movq	24(%rbp), %r10
+	QUAD $0x000000c824948948     // movq	%rdx, 200(%rsp)
+	WORD $0x894c; BYTE $0xc0     // movq	%r8, %rax
+	WORD $0x2948; BYTE $0xf8     // subq	%rdi, %rax
+	QUAD $0x0000019024bc8b48     // movq	400(%rsp), %rdi
+	WORD $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	LONG $0xffaf0f49             // imulq	%r15, %rdi
+	LONG $0xc2048d49             // leaq	(%r10,%rax,8), %rax
+	QUAD $0x0000015824848948     // movq	%rax, 344(%rsp)
+	QUAD $0x0000019824848b48     // movq	408(%rsp), %rax
+	QUAD $0x0000018824bc8948     // movq	%rdi, 392(%rsp)
+	LONG $0xf83c8d48             // leaq	(%rax,%rdi,8), %rdi
+	QUAD $0x000000c024848b48     // movq	192(%rsp), %rax
+	WORD $0x294c; BYTE $0xc0     // subq	%r8, %rax
+	QUAD $0x000000e824848948     // movq	%rax, 232(%rsp)
+	QUAD $0x000000b824848b48     // movq	184(%rsp), %rax
+	WORD $0x294c; BYTE $0xc0     // subq	%r8, %rax
+	QUAD $0x000000e024848948     // movq	%rax, 224(%rsp)
+	LONG $0x24448b48; BYTE $0x70 // movq	112(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0     // addq	%rdx, %rax
+	QUAD $0x000000d824848948     // movq	%rax, 216(%rsp)
+	WORD $0x894c; BYTE $0xf0     // movq	%r14, %rax
+	WORD $0x8949; BYTE $0xde     // movq	%rbx, %r14
+	WORD $0x894c; BYTE $0xdb     // movq	%r11, %rbx
+	WORD $0x8949; BYTE $0xc3     // movq	%rax, %r11
+
+BB0_34:
+	LONG $0x03ff8349             // cmpq	$3, %r15
+	JLE  BB0_75
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+	LONG $0xd128fdc5             // vmovapd	%ymm1, %ymm2
+	LONG $0xd928fdc5             // vmovapd	%ymm1, %ymm3
+	LONG $0xe128fdc5             // vmovapd	%ymm1, %ymm4
+
+BB0_22:
+	LONG $0x4410fdc5; WORD $0xe0c7             // vmovupd	-32(%rdi,%rax,8), %ymm0
+	LONG $0xb8fdc2c4; WORD $0xc664; BYTE $0xe0 // vfmadd231pd	-32(%r14,%rax,8), %ymm0, %ymm4
+	LONG $0xb8fde2c4; WORD $0xc35c; BYTE $0xe0 // vfmadd231pd	-32(%rbx,%rax,8), %ymm0, %ymm3
+	LONG $0xb8fdc2c4; WORD $0xc354; BYTE $0xe0 // vfmadd231pd	-32(%r11,%rax,8), %ymm0, %ymm2
+	LONG $0xb8fde2c4; WORD $0xc14c; BYTE $0xe0 // vfmadd231pd	-32(%rcx,%rax,8), %ymm0, %ymm1
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x3949; BYTE $0xc7                   // cmpq	%rax, %r15
+	JGE  BB0_22
+	QUAD $0x0000016024848b48                   // movq	352(%rsp), %rax
+
+BB0_21:
+	LONG $0x197de3c4; WORD $0x01e0 // vextractf128	$0x1, %ymm4, %xmm0
+	LONG $0xe058d9c5               // vaddpd	%xmm0, %xmm4, %xmm4
+	LONG $0xc415d9c5               // vunpckhpd	%xmm4, %xmm4, %xmm0
+	LONG $0xe058dbc5               // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01d8 // vextractf128	$0x1, %ymm3, %xmm0
+	LONG $0xd858e1c5               // vaddpd	%xmm0, %xmm3, %xmm3
+	LONG $0xec10dbc5               // vmovsd	%xmm4, %xmm4, %xmm5
+	LONG $0xc315e1c5               // vunpckhpd	%xmm3, %xmm3, %xmm0
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0x197de3c4; WORD $0x01d0 // vextractf128	$0x1, %ymm2, %xmm0
+	LONG $0xd058e9c5               // vaddpd	%xmm0, %xmm2, %xmm2
+	LONG $0xe310e3c5               // vmovsd	%xmm3, %xmm3, %xmm4
+	LONG $0xc215e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm0
+	LONG $0xd058ebc5               // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0xda10ebc5               // vmovsd	%xmm2, %xmm2, %xmm3
+	LONG $0x197de3c4; WORD $0x01ca // vextractf128	$0x1, %ymm1, %xmm2
+	LONG $0xc258f1c5               // vaddpd	%xmm2, %xmm1, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_23
+	WORD $0x894d; BYTE $0xf9       // movq	%r15, %r9
+	WORD $0x8948; BYTE $0xc6       // movq	%rax, %rsi
+	WORD $0x2949; BYTE $0xc1       // subq	%rax, %r9
+	LONG $0xff518d49               // leaq	-1(%r9), %rdx
+	QUAD $0x00000178248c894c       // movq	%r9, 376(%rsp)
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_76
+	QUAD $0x000001a824948b48       // movq	424(%rsp), %rdx
+	QUAD $0x0000018824948b4c       // movq	392(%rsp), %r10
+	QUAD $0x0000014024bc894c       // movq	%r15, 320(%rsp)
+	LONG $0x02e9c149               // shrq	$2, %r9
+	QUAD $0x0000019824848b4c       // movq	408(%rsp), %r8
+	QUAD $0x0000013824b4894c       // movq	%r14, 312(%rsp)
+	LONG $0x05e1c149               // salq	$5, %r9
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0xd4148d49               // leaq	(%r12,%rdx,8), %rdx
+	QUAD $0x0000015024948948       // movq	%rdx, 336(%rsp)
+	LONG $0x02148d49               // leaq	(%r10,%rax), %rdx
+	QUAD $0x000001b024948b4c       // movq	432(%rsp), %r10
+	LONG $0xd02c8d4d               // leaq	(%r8,%rdx,8), %r13
+	QUAD $0x0000015024b48b4c       // movq	336(%rsp), %r14
+	LONG $0x02148d49               // leaq	(%r10,%rax), %rdx
+	QUAD $0x000001b824948b4c       // movq	440(%rsp), %r10
+	LONG $0xd4048d4d               // leaq	(%r12,%rdx,8), %r8
+	LONG $0x02148d49               // leaq	(%r10,%rax), %rdx
+	QUAD $0x000001a024948b4c       // movq	416(%rsp), %r10
+	QUAD $0x000001482484894c       // movq	%r8, 328(%rsp)
+	LONG $0xd4048d4d               // leaq	(%r12,%rdx,8), %r8
+	QUAD $0x0000014824bc8b4c       // movq	328(%rsp), %r15
+	LONG $0x10148d4a               // leaq	(%rax,%r10), %rdx
+	LONG $0xd4148d4d               // leaq	(%r12,%rdx,8), %r10
+	WORD $0xd231                   // xorl	%edx, %edx
+
+BB0_25:
+	LONG $0x107dc1c4; WORD $0x154c; BYTE $0x00 // vmovupd	0(%r13,%rdx), %ymm1
+	LONG $0x5975c1c4; WORD $0x1614             // vmulpd	(%r14,%rdx), %ymm1, %ymm2
+	LONG $0xea58d3c5                           // vaddsd	%xmm2, %xmm5, %xmm5
+	LONG $0xfa15e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm7
+	LONG $0x197de3c4; WORD $0x01d2             // vextractf128	$0x1, %ymm2, %xmm2
+	LONG $0xef58d3c5                           // vaddsd	%xmm7, %xmm5, %xmm5
+	LONG $0xea58d3c5                           // vaddsd	%xmm2, %xmm5, %xmm5
+	LONG $0xd215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xea58d3c5                           // vaddsd	%xmm2, %xmm5, %xmm5
+	LONG $0x5975c1c4; WORD $0x1714             // vmulpd	(%r15,%rdx), %ymm1, %ymm2
+	LONG $0xe258dbc5                           // vaddsd	%xmm2, %xmm4, %xmm4
+	LONG $0xfa15e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm7
+	LONG $0x197de3c4; WORD $0x01d2             // vextractf128	$0x1, %ymm2, %xmm2
+	LONG $0xe758dbc5                           // vaddsd	%xmm7, %xmm4, %xmm4
+	LONG $0xe258dbc5                           // vaddsd	%xmm2, %xmm4, %xmm4
+	LONG $0xd215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xe258dbc5                           // vaddsd	%xmm2, %xmm4, %xmm4
+	LONG $0x5975c1c4; WORD $0x1014             // vmulpd	(%r8,%rdx), %ymm1, %ymm2
+	LONG $0x5975c1c4; WORD $0x120c             // vmulpd	(%r10,%rdx), %ymm1, %ymm1
+	LONG $0x20c28348                           // addq	$32, %rdx
+	LONG $0xda58e3c5                           // vaddsd	%xmm2, %xmm3, %xmm3
+	LONG $0xfa15e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm7
+	LONG $0x197de3c4; WORD $0x01d2             // vextractf128	$0x1, %ymm2, %xmm2
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xf115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm6
+	LONG $0x197de3c4; WORD $0x01c9             // vextractf128	$0x1, %ymm1, %xmm1
+	LONG $0xdf58e3c5                           // vaddsd	%xmm7, %xmm3, %xmm3
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0xda58e3c5                           // vaddsd	%xmm2, %xmm3, %xmm3
+	LONG $0xd215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xda58e3c5                           // vaddsd	%xmm2, %xmm3, %xmm3
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JNE  BB0_25
+	QUAD $0x0000017824848b4c                   // movq	376(%rsp), %r8
+	QUAD $0x0000014024bc8b4c                   // movq	320(%rsp), %r15
+	QUAD $0x0000013824b48b4c                   // movq	312(%rsp), %r14
+	WORD $0x894c; BYTE $0xc2                   // movq	%r8, %rdx
+	LONG $0xfce28348                           // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x03e08341                           // andl	$3, %r8d
+	JE   BB0_23
+
+BB0_24:
+	QUAD $0x0000017824848b4c       // movq	376(%rsp), %r8
+	WORD $0x2949; BYTE $0xd0       // subq	%rdx, %r8
+	LONG $0x01f88349               // cmpq	$1, %r8
+	JE   BB0_28
+	QUAD $0x0000018824948b4c       // movq	392(%rsp), %r10
+	LONG $0x320c8d4d               // leaq	(%r10,%rsi), %r9
+	QUAD $0x0000019824948b4c       // movq	408(%rsp), %r10
+	WORD $0x0149; BYTE $0xd1       // addq	%rdx, %r9
+	LONG $0x107981c4; WORD $0xca0c // vmovupd	(%r10,%r9,8), %xmm1
+	QUAD $0x000001a824948b4c       // movq	424(%rsp), %r10
+	LONG $0x160c8d4c               // leaq	(%rsi,%rdx), %r9
+	WORD $0x014d; BYTE $0xca       // addq	%r9, %r10
+	LONG $0x597181c4; WORD $0xd414 // vmulpd	(%r12,%r10,8), %xmm1, %xmm2
+	QUAD $0x000001b024948b4c       // movq	432(%rsp), %r10
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	WORD $0x0149; BYTE $0xd2       // addq	%rdx, %r10
+	LONG $0xea58d3c5               // vaddsd	%xmm2, %xmm5, %xmm5
+	LONG $0xd215e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xed58ebc5               // vaddsd	%xmm5, %xmm2, %xmm5
+	LONG $0x597181c4; WORD $0xd414 // vmulpd	(%r12,%r10,8), %xmm1, %xmm2
+	QUAD $0x000001b824948b4c       // movq	440(%rsp), %r10
+	WORD $0x014c; BYTE $0xd6       // addq	%r10, %rsi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	LONG $0xe258dbc5               // vaddsd	%xmm2, %xmm4, %xmm4
+	LONG $0xd215e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xe458ebc5               // vaddsd	%xmm4, %xmm2, %xmm4
+	LONG $0x5971c1c4; WORD $0xf414 // vmulpd	(%r12,%rsi,8), %xmm1, %xmm2
+	QUAD $0x000001a024b48b48       // movq	416(%rsp), %rsi
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+	LONG $0x597181c4; WORD $0xcc0c // vmulpd	(%r12,%r9,8), %xmm1, %xmm1
+	LONG $0xda58e3c5               // vaddsd	%xmm2, %xmm3, %xmm3
+	LONG $0xd215e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xdb58ebc5               // vaddsd	%xmm3, %xmm2, %xmm3
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0x01c0f641               // testb	$1, %r8b
+	JE   BB0_23
+	LONG $0xfee08349               // andq	$-2, %r8
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+
+BB0_28:
+	QUAD $0x0000018824b48b48       // movq	392(%rsp), %rsi
+	LONG $0x06148d48               // leaq	(%rsi,%rax), %rdx
+	QUAD $0x0000019824b48b48       // movq	408(%rsp), %rsi
+	LONG $0x0c10fbc5; BYTE $0xd6   // vmovsd	(%rsi,%rdx,8), %xmm1
+	QUAD $0x000001a824b48b48       // movq	424(%rsp), %rsi
+	LONG $0x06148d48               // leaq	(%rsi,%rax), %rdx
+	QUAD $0x000001b024b48b48       // movq	432(%rsp), %rsi
+	LONG $0xb9f1c2c4; WORD $0xd42c // vfmadd231sd	(%r12,%rdx,8), %xmm1, %xmm5
+	LONG $0x06148d48               // leaq	(%rsi,%rax), %rdx
+	QUAD $0x000001b824b48b48       // movq	440(%rsp), %rsi
+	LONG $0xb9f1c2c4; WORD $0xd424 // vfmadd231sd	(%r12,%rdx,8), %xmm1, %xmm4
+	LONG $0x06148d48               // leaq	(%rsi,%rax), %rdx
+	QUAD $0x000001a024b48b48       // movq	416(%rsp), %rsi
+	LONG $0xb9f1c2c4; WORD $0xd41c // vfmadd231sd	(%r12,%rdx,8), %xmm1, %xmm3
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0xb9f1c2c4; WORD $0xc404 // vfmadd231sd	(%r12,%rax,8), %xmm1, %xmm0
+
+BB0_23:
+	QUAD $0x0000019024848b48     // movq	400(%rsp), %rax
+	QUAD $0x0000018024843948     // cmpq	%rax, 384(%rsp)
+	JLE  BB0_30
+	QUAD $0x0000013024b48b48     // movq	304(%rsp), %rsi
+	WORD $0x8548; BYTE $0xf6     // testq	%rsi, %rsi
+	JE   BB0_31
+	LONG $0x0c10fbc5; BYTE $0xc6 // vmovsd	(%rsi,%rax,8), %xmm1
+	LONG $0xe958d3c5             // vaddsd	%xmm1, %xmm5, %xmm5
+	LONG $0xe158dbc5             // vaddsd	%xmm1, %xmm4, %xmm4
+	LONG $0xd958e3c5             // vaddsd	%xmm1, %xmm3, %xmm3
+	LONG $0xc158fbc5             // vaddsd	%xmm1, %xmm0, %xmm0
+
+BB0_31:
+	QUAD $0x0000019024848b48     // movq	400(%rsp), %rax
+	QUAD $0x000000d824b48b48     // movq	216(%rsp), %rsi
+	LONG $0x2c11fbc5; BYTE $0xc6 // vmovsd	%xmm5, (%rsi,%rax,8)
+	QUAD $0x0000012824b48b48     // movq	296(%rsp), %rsi
+	LONG $0x2411fbc5; BYTE $0xc6 // vmovsd	%xmm4, (%rsi,%rax,8)
+	QUAD $0x0000012024b48b48     // movq	288(%rsp), %rsi
+	LONG $0x1c11fbc5; BYTE $0xc6 // vmovsd	%xmm3, (%rsi,%rax,8)
+	QUAD $0x0000011824b48b48     // movq	280(%rsp), %rsi
+	LONG $0x0411fbc5; BYTE $0xc6 // vmovsd	%xmm0, (%rsi,%rax,8)
+
+BB0_32:
+	QUAD $0x0000017024b48b48             // movq	368(%rsp), %rsi
+	QUAD $0x0000018824bc014c             // addq	%r15, 392(%rsp)
+	QUAD $0x0000019024848348; BYTE $0x01 // addq	$1, 400(%rsp)
+	QUAD $0x0000019024848b48             // movq	400(%rsp), %rax
+	QUAD $0x0000015824848348; BYTE $0x08 // addq	$8, 344(%rsp)
+	WORD $0x0148; BYTE $0xf7             // addq	%rsi, %rdi
+	QUAD $0x0000016824843948             // cmpq	%rax, 360(%rsp)
+	JG   BB0_34
+	WORD $0x894c; BYTE $0xd8             // movq	%r11, %rax
+	QUAD $0x000000d024b48b48             // movq	208(%rsp), %rsi
+	WORD $0x8949; BYTE $0xdb             // movq	%rbx, %r11
+	QUAD $0x000000c824948b48             // movq	200(%rsp), %rdx
+	WORD $0x894c; BYTE $0xf3             // movq	%r14, %rbx
+	WORD $0x8949; BYTE $0xc6             // movq	%rax, %r14
+
+BB0_20:
+	LONG $0x24448b48; BYTE $0x68         // movq	104(%rsp), %rax
+	QUAD $0x000000a024840148             // addq	%rax, 160(%rsp)
+	QUAD $0x000000c024840148             // addq	%rax, 192(%rsp)
+	LONG $0x24448b4c; BYTE $0x50         // movq	80(%rsp), %r8
+	QUAD $0x000000b824840148             // addq	%rax, 184(%rsp)
+	LONG $0x24448b48; BYTE $0x60         // movq	96(%rsp), %rax
+	QUAD $0x0000010824848348; BYTE $0x04 // addq	$4, 264(%rsp)
+	QUAD $0x0000010824bc8b48             // movq	264(%rsp), %rdi
+	WORD $0x0148; BYTE $0xc3             // addq	%rax, %rbx
+	WORD $0x0149; BYTE $0xc3             // addq	%rax, %r11
+	WORD $0x0149; BYTE $0xc6             // addq	%rax, %r14
+	WORD $0x0148; BYTE $0xc1             // addq	%rax, %rcx
+	LONG $0x24448b48; BYTE $0x58         // movq	88(%rsp), %rax
+	QUAD $0x000001a824b40148             // addq	%rsi, 424(%rsp)
+	QUAD $0x000001b024b40148             // addq	%rsi, 432(%rsp)
+	QUAD $0x000001b824b40148             // addq	%rsi, 440(%rsp)
+	WORD $0x0148; BYTE $0xc2             // addq	%rax, %rdx
+	QUAD $0x000001a024b40148             // addq	%rsi, 416(%rsp)
+	QUAD $0x000000902484014c             // addq	%r8, 144(%rsp)
+	QUAD $0x000000b024bc3948             // cmpq	%rdi, 176(%rsp)
+	JG   BB0_4
+	QUAD $0x000000b024848b48             // movq	176(%rsp), %rax
+	QUAD $0x00000198249c8b48             // movq	408(%rsp), %rbx
+	LONG $0x10458b4c                     // movq	16(%rbp), %r8
+	LONG $0x04e88348                     // subq	$4, %rax
+	LONG $0x02e8c148                     // shrq	$2, %rax
+	QUAD $0x00000004851c8d4c             // leaq	4(,%rax,4), %r11
+
+BB0_2:
+	QUAD $0x000000b0249c394c // cmpq	%r11, 176(%rsp)
+	JLE  BB0_155
+	QUAD $0x0000016824948b4c // movq	360(%rsp), %r10
+	WORD $0x854d; BYTE $0xd2 // testq	%r10, %r10
+	JLE  BB0_155
+	QUAD $0x000000f024848b48 // movq	240(%rsp), %rax
+	QUAD $0x00000180248c8b48 // movq	384(%rsp), %rcx
+	WORD $0x894d; BYTE $0xfd // movq	%r15, %r13
+	QUAD $0x00000198249c894c // movq	%r11, 408(%rsp)
+	LONG $0xebaf0f4d         // imulq	%r11, %r13
+	WORD $0x8948; BYTE $0xc7 // movq	%rax, %rdi
+	WORD $0x8948; BYTE $0xce // movq	%rcx, %rsi
+	LONG $0xfbaf0f49         // imulq	%r11, %rdi
+	LONG $0xf3af0f49         // imulq	%r11, %rsi
+	LONG $0xec348d4f         // leaq	(%r12,%r13,8), %r14
+	QUAD $0x0000017024bc8948 // movq	%rdi, 368(%rsp)
+	QUAD $0x00000000fd3c8d4a // leaq	0(,%r15,8), %rdi
+	QUAD $0x0000017824b48948 // movq	%rsi, 376(%rsp)
+	WORD $0x8948; BYTE $0xce // movq	%rcx, %rsi
+	LONG $0x010c8d48         // leaq	(%rcx,%rax), %rcx
+	QUAD $0x000001b824bc8948 // movq	%rdi, 440(%rsp)
+	WORD $0x8948; BYTE $0xc7 // movq	%rax, %rdi
+	LONG $0xfc478d49         // leaq	-4(%r15), %rax
+	WORD $0x8948; BYTE $0xca // movq	%rcx, %rdx
+	LONG $0x02e8c148         // shrq	$2, %rax
+	WORD $0xf748; BYTE $0xda // negq	%rdx
+	WORD $0xf748; BYTE $0xdf // negq	%rdi
+	QUAD $0x00000140248c8948 // movq	%rcx, 320(%rsp)
+	QUAD $0x0000000485048d48 // leaq	4(,%rax,4), %rax
+	QUAD $0x000001a824848948 // movq	%rax, 424(%rsp)
+	WORD $0x8948; BYTE $0xf0 // movq	%rsi, %rax
+	QUAD $0x000000f824b48b48 // movq	248(%rsp), %rsi
+	WORD $0xf748; BYTE $0xd8 // negq	%rax
+	LONG $0x03e0c148         // salq	$3, %rax
+	WORD $0x0148; BYTE $0xc6 // addq	%rax, %rsi
+	QUAD $0x0000015824b48948 // movq	%rsi, 344(%rsp)
+	LONG $0x00348d49         // leaq	(%r8,%rax), %rsi
+	LONG $0x18450348         // addq	24(%rbp), %rax
+	WORD $0x3949; BYTE $0xca // cmpq	%rcx, %r10
+	QUAD $0x0000012824b48948 // movq	%rsi, 296(%rsp)
+	LONG $0xca4e0f49         // cmovle	%r10, %rcx
+	LONG $0xf8048d48         // leaq	(%rax,%rdi,8), %rax
+	QUAD $0x0000010024b48b48 // movq	256(%rsp), %rsi
+	QUAD $0x0000013824848948 // movq	%rax, 312(%rsp)
+	LONG $0xd6348d48         // leaq	(%rsi,%rdx,8), %rsi
+	QUAD $0x000001a0248c8948 // movq	%rcx, 416(%rsp)
+	QUAD $0x0000016024b48948 // movq	%rsi, 352(%rsp)
+
+BB0_55:
+	QUAD $0x0000014024bc8348; BYTE $0x00 // cmpq	$0, 320(%rsp)
+	JG   BB0_38
+	QUAD $0x0000017024848b48             // movq	368(%rsp), %rax
+	WORD $0x3145; BYTE $0xdb             // xorl	%r11d, %r11d
+	QUAD $0x00000000c5148d48             // leaq	0(,%rax,8), %rdx
+	QUAD $0x0000017824848b48             // movq	376(%rsp), %rax
+	QUAD $0x00000000c5348d48             // leaq	0(,%rax,8), %rsi
+
+BB0_39:
+	QUAD $0x0000013824848b48     // movq	312(%rsp), %rax
+	WORD $0x894c; BYTE $0xff     // movq	%r15, %rdi
+	LONG $0xfbaf0f49             // imulq	%r11, %rdi
+	WORD $0x0148; BYTE $0xd0     // addq	%rdx, %rax
+	QUAD $0x0000019024848948     // movq	%rax, 400(%rsp)
+	LONG $0x24448b48; BYTE $0x70 // movq	112(%rsp), %rax
+	LONG $0xfb0c8d48             // leaq	(%rbx,%rdi,8), %rcx
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	QUAD $0x0000018824848948     // movq	%rax, 392(%rsp)
+
+BB0_69:
+	LONG $0x03ff8349             // cmpq	$3, %r15
+	JLE  BB0_79
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+
+BB0_57:
+	LONG $0x107dc1c4; WORD $0xc66c; BYTE $0xe0 // vmovupd	-32(%r14,%rax,8), %ymm5
+	LONG $0xb8d5e2c4; WORD $0xc144; BYTE $0xe0 // vfmadd231pd	-32(%rcx,%rax,8), %ymm5, %ymm0
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x3949; BYTE $0xc7                   // cmpq	%rax, %r15
+	JGE  BB0_57
+	QUAD $0x000001a824848b48                   // movq	424(%rsp), %rax
+
+BB0_56:
+	LONG $0x197de3c4; WORD $0x01c1 // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_58
+	WORD $0x894c; BYTE $0xfe       // movq	%r15, %rsi
+	QUAD $0x000001b024848948       // movq	%rax, 432(%rsp)
+	WORD $0x2948; BYTE $0xc6       // subq	%rax, %rsi
+	LONG $0xff568d48               // leaq	-1(%rsi), %rdx
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_80
+	LONG $0x05548d49; BYTE $0x00   // leaq	0(%r13,%rax), %rdx
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	LONG $0xd4148d4d               // leaq	(%r12,%rdx,8), %r10
+	LONG $0x02e8c149               // shrq	$2, %r8
+	LONG $0x07148d48               // leaq	(%rdi,%rax), %rdx
+	LONG $0xd30c8d4c               // leaq	(%rbx,%rdx,8), %r9
+	LONG $0x05e0c149               // salq	$5, %r8
+	WORD $0xd231                   // xorl	%edx, %edx
+
+BB0_60:
+	LONG $0x107dc1c4; WORD $0x122c // vmovupd	(%r10,%rdx), %ymm5
+	LONG $0x5955c1c4; WORD $0x1114 // vmulpd	(%r9,%rdx), %ymm5, %ymm2
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xc058ebc5               // vaddsd	%xmm0, %xmm2, %xmm0
+	LONG $0xda15e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm3
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xc358fbc5               // vaddsd	%xmm3, %xmm0, %xmm0
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd0       // cmpq	%rdx, %r8
+	JNE  BB0_60
+	WORD $0x8948; BYTE $0xf2       // movq	%rsi, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x03c6f640               // testb	$3, %sil
+	JE   BB0_58
+
+BB0_59:
+	WORD $0x2948; BYTE $0xd6       // subq	%rdx, %rsi
+	LONG $0x01fe8348               // cmpq	$1, %rsi
+	JE   BB0_63
+	QUAD $0x000001b024948b4c       // movq	432(%rsp), %r10
+	LONG $0x17048d4c               // leaq	(%rdi,%rdx), %r8
+	WORD $0x014c; BYTE $0xea       // addq	%r13, %rdx
+	WORD $0x014d; BYTE $0xd0       // addq	%r10, %r8
+	WORD $0x014c; BYTE $0xd2       // addq	%r10, %rdx
+	LONG $0x1079c1c4; WORD $0xd40c // vmovupd	(%r12,%rdx,8), %xmm1
+	LONG $0x5971a1c4; WORD $0xc30c // vmulpd	(%rbx,%r8,8), %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0x01c6f640               // testb	$1, %sil
+	JE   BB0_58
+	LONG $0xfee68348               // andq	$-2, %rsi
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+
+BB0_63:
+	LONG $0x28148d4a               // leaq	(%rax,%r13), %rdx
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+	LONG $0x107bc1c4; WORD $0xd42c // vmovsd	(%r12,%rdx,8), %xmm5
+	LONG $0xb9d1e2c4; WORD $0xc304 // vfmadd231sd	(%rbx,%rax,8), %xmm5, %xmm0
+
+BB0_58:
+	QUAD $0x00000180249c394c       // cmpq	%r11, 384(%rsp)
+	JLE  BB0_65
+	QUAD $0x0000013024848b48       // movq	304(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_66
+	LONG $0x587ba1c4; WORD $0xd804 // vaddsd	(%rax,%r11,8), %xmm0, %xmm0
+
+BB0_66:
+	QUAD $0x0000018824848b48       // movq	392(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xd804 // vmovsd	%xmm0, (%rax,%r11,8)
+
+BB0_67:
+	QUAD $0x000001b824848b48 // movq	440(%rsp), %rax
+	LONG $0x01c38349         // addq	$1, %r11
+	WORD $0x014c; BYTE $0xff // addq	%r15, %rdi
+	WORD $0x0148; BYTE $0xc1 // addq	%rax, %rcx
+	QUAD $0x00000168249c394c // cmpq	%r11, 360(%rsp)
+	JG   BB0_69
+
+BB0_70:
+	QUAD $0x000001b8248c8b48             // movq	440(%rsp), %rcx
+	QUAD $0x000000f024bc8b48             // movq	240(%rsp), %rdi
+	WORD $0x014d; BYTE $0xfd             // addq	%r15, %r13
+	QUAD $0x0000019824848348; BYTE $0x01 // addq	$1, 408(%rsp)
+	QUAD $0x0000019824848b48             // movq	408(%rsp), %rax
+	QUAD $0x0000017024bc0148             // addq	%rdi, 368(%rsp)
+	WORD $0x0149; BYTE $0xce             // addq	%rcx, %r14
+	QUAD $0x0000018024bc8b48             // movq	384(%rsp), %rdi
+	QUAD $0x0000017824bc0148             // addq	%rdi, 376(%rsp)
+	QUAD $0x000000b024843948             // cmpq	%rax, 176(%rsp)
+	JNE  BB0_55
+
+BB0_155:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x30a58d48; WORD $0xfffe; BYTE $0xff // leaq	-464(%rbp), %rsp
+	RET
+
+BB0_30:
+	QUAD $0x0000010024bc8348; BYTE $0x00 // cmpq	$0, 256(%rsp)
+	JE   BB0_33
+	WORD $0x8948; BYTE $0xc6             // movq	%rax, %rsi
+	QUAD $0x0000009824848b48             // movq	152(%rsp), %rax
+	LONG $0x0c10fbc5; BYTE $0xf0         // vmovsd	(%rax,%rsi,8), %xmm1
+	LONG $0xe958d3c5                     // vaddsd	%xmm1, %xmm5, %xmm5
+	LONG $0xe158dbc5                     // vaddsd	%xmm1, %xmm4, %xmm4
+	LONG $0xd958e3c5                     // vaddsd	%xmm1, %xmm3, %xmm3
+	LONG $0xc158fbc5                     // vaddsd	%xmm1, %xmm0, %xmm0
+
+BB0_33:
+	QUAD $0x0000015824848b48     // movq	344(%rsp), %rax
+	QUAD $0x000000f024b48b48     // movq	240(%rsp), %rsi
+	LONG $0x2811fbc5             // vmovsd	%xmm5, (%rax)
+	LONG $0x2411fbc5; BYTE $0xf0 // vmovsd	%xmm4, (%rax,%rsi,8)
+	QUAD $0x000000e824b48b48     // movq	232(%rsp), %rsi
+	LONG $0x1c11fbc5; BYTE $0xf0 // vmovsd	%xmm3, (%rax,%rsi,8)
+	QUAD $0x000000e024b48b48     // movq	224(%rsp), %rsi
+	LONG $0x0411fbc5; BYTE $0xf0 // vmovsd	%xmm0, (%rax,%rsi,8)
+	JMP  BB0_32
+
+BB0_15:
+	QUAD $0x000000f824bc8348; BYTE $0x00 // cmpq	$0, 248(%rsp)
+	JE   BB0_18
+	WORD $0x8948; BYTE $0xc6             // movq	%rax, %rsi
+	QUAD $0x000000a824848b48             // movq	168(%rsp), %rax
+	LONG $0x0c10fbc5; BYTE $0xf0         // vmovsd	(%rax,%rsi,8), %xmm1
+	LONG $0xe958d3c5                     // vaddsd	%xmm1, %xmm5, %xmm5
+	LONG $0xe158dbc5                     // vaddsd	%xmm1, %xmm4, %xmm4
+	LONG $0xd958e3c5                     // vaddsd	%xmm1, %xmm3, %xmm3
+	LONG $0xc158fbc5                     // vaddsd	%xmm1, %xmm0, %xmm0
+
+BB0_18:
+	QUAD $0x0000019024848b48     // movq	400(%rsp), %rax
+	QUAD $0x000000e024b48b48     // movq	224(%rsp), %rsi
+	LONG $0x2c11fbc5; BYTE $0xc6 // vmovsd	%xmm5, (%rsi,%rax,8)
+	QUAD $0x000000d824b48b48     // movq	216(%rsp), %rsi
+	LONG $0x2411fbc5; BYTE $0xc6 // vmovsd	%xmm4, (%rsi,%rax,8)
+	QUAD $0x000000d024b48b48     // movq	208(%rsp), %rsi
+	LONG $0x1c11fbc5; BYTE $0xc6 // vmovsd	%xmm3, (%rsi,%rax,8)
+	QUAD $0x000000e824b48b48     // movq	232(%rsp), %rsi
+	LONG $0x0411fbc5; BYTE $0xc6 // vmovsd	%xmm0, (%rsi,%rax,8)
+	JMP  BB0_17
+
+BB0_65:
+	QUAD $0x0000010024bc8348; BYTE $0x00 // cmpq	$0, 256(%rsp)
+	JE   BB0_68
+	QUAD $0x0000016024848b48             // movq	352(%rsp), %rax
+	LONG $0x587ba1c4; WORD $0xd804       // vaddsd	(%rax,%r11,8), %xmm0, %xmm0
+
+BB0_68:
+	QUAD $0x0000019024848b48       // movq	400(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xd804 // vmovsd	%xmm0, (%rax,%r11,8)
+	JMP  BB0_67
+
+BB0_75:
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xd128fdc5 // vmovapd	%ymm1, %ymm2
+	LONG $0xd928fdc5 // vmovapd	%ymm1, %ymm3
+	LONG $0xe128fdc5 // vmovapd	%ymm1, %ymm4
+	JMP  BB0_21
+
+BB0_72:
+	LONG $0x24448b48; BYTE $0x48               // movq	72(%rsp), %rax
+	QUAD $0x000001902484c748; LONG $0x00000000 // movq	$0, 400(%rsp)
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	QUAD $0x0000012824848948                   // movq	%rax, 296(%rsp)
+	LONG $0x24448b48; BYTE $0x40               // movq	64(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	QUAD $0x0000012024848948                   // movq	%rax, 288(%rsp)
+	LONG $0x24448b48; BYTE $0x38               // movq	56(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	QUAD $0x0000011824848948                   // movq	%rax, 280(%rsp)
+	JMP  BB0_5
+
+BB0_73:
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xd128fdc5 // vmovapd	%ymm1, %ymm2
+	LONG $0xd928fdc5 // vmovapd	%ymm1, %ymm3
+	LONG $0xe128fdc5 // vmovapd	%ymm1, %ymm4
+	JMP  BB0_6
+
+BB0_74:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_9
+
+BB0_76:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_24
+
+BB0_79:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xc057f9c5 // vxorpd	%xmm0, %xmm0, %xmm0
+	JMP  BB0_56
+
+BB0_38:
+	QUAD $0x0000017024848b48     // movq	368(%rsp), %rax
+	WORD $0x8948; BYTE $0xd9     // movq	%rbx, %rcx
+	WORD $0xff31                 // xorl	%edi, %edi
+	WORD $0x3145; BYTE $0xdb     // xorl	%r11d, %r11d
+	QUAD $0x00000000c5148d48     // leaq	0(,%rax,8), %rdx
+	QUAD $0x0000012824848b48     // movq	296(%rsp), %rax
+	QUAD $0x0000014824948948     // movq	%rdx, 328(%rsp)
+	WORD $0x0148; BYTE $0xd0     // addq	%rdx, %rax
+	QUAD $0x0000019024848948     // movq	%rax, 400(%rsp)
+	QUAD $0x0000017824848b48     // movq	376(%rsp), %rax
+	QUAD $0x00000000c5348d48     // leaq	0(,%rax,8), %rsi
+	LONG $0x24448b48; BYTE $0x70 // movq	112(%rsp), %rax
+	QUAD $0x0000015024b48948     // movq	%rsi, 336(%rsp)
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	QUAD $0x0000018824848948     // movq	%rax, 392(%rsp)
+
+BB0_54:
+	LONG $0x03ff8349             // cmpq	$3, %r15
+	JLE  BB0_77
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+
+BB0_42:
+	LONG $0x107dc1c4; WORD $0xc66c; BYTE $0xe0 // vmovupd	-32(%r14,%rax,8), %ymm5
+	LONG $0xb8d5e2c4; WORD $0xc14c; BYTE $0xe0 // vfmadd231pd	-32(%rcx,%rax,8), %ymm5, %ymm1
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_42
+	QUAD $0x000001a824848b48                   // movq	424(%rsp), %rax
+
+BB0_41:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc7       // cmpq	%rax, %r15
+	JLE  BB0_43
+	WORD $0x894c; BYTE $0xfe       // movq	%r15, %rsi
+	QUAD $0x000001b024848948       // movq	%rax, 432(%rsp)
+	WORD $0x2948; BYTE $0xc6       // subq	%rax, %rsi
+	LONG $0xff568d48               // leaq	-1(%rsi), %rdx
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_78
+	LONG $0x05548d49; BYTE $0x00   // leaq	0(%r13,%rax), %rdx
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	LONG $0xd4148d4d               // leaq	(%r12,%rdx,8), %r10
+	LONG $0x02e8c149               // shrq	$2, %r8
+	LONG $0x38148d48               // leaq	(%rax,%rdi), %rdx
+	LONG $0xd30c8d4c               // leaq	(%rbx,%rdx,8), %r9
+	LONG $0x05e0c149               // salq	$5, %r8
+	WORD $0xd231                   // xorl	%edx, %edx
+
+BB0_45:
+	LONG $0x107dc1c4; WORD $0x112c // vmovupd	(%r9,%rdx), %ymm5
+	LONG $0x5955c1c4; WORD $0x1214 // vmulpd	(%r10,%rdx), %ymm5, %ymm2
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xc058ebc5               // vaddsd	%xmm0, %xmm2, %xmm0
+	LONG $0xda15e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm3
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f3c5               // vaddsd	%xmm3, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd0       // cmpq	%rdx, %r8
+	JNE  BB0_45
+	WORD $0x8948; BYTE $0xf2       // movq	%rsi, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x03c6f640               // testb	$3, %sil
+	JE   BB0_43
+
+BB0_44:
+	WORD $0x2948; BYTE $0xd6       // subq	%rdx, %rsi
+	LONG $0x01fe8348               // cmpq	$1, %rsi
+	JE   BB0_48
+	QUAD $0x000001b024948b4c       // movq	432(%rsp), %r10
+	LONG $0x15448d4d; BYTE $0x00   // leaq	0(%r13,%rdx), %r8
+	WORD $0x014c; BYTE $0xd2       // addq	%r10, %rdx
+	WORD $0x014d; BYTE $0xd0       // addq	%r10, %r8
+	WORD $0x0148; BYTE $0xfa       // addq	%rdi, %rdx
+	LONG $0x0c10f9c5; BYTE $0xd3   // vmovupd	(%rbx,%rdx,8), %xmm1
+	LONG $0x597181c4; WORD $0xc40c // vmulpd	(%r12,%r8,8), %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0x01c6f640               // testb	$1, %sil
+	JE   BB0_43
+	LONG $0xfee68348               // andq	$-2, %rsi
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+
+BB0_48:
+	LONG $0x28148d4a               // leaq	(%rax,%r13), %rdx
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+	LONG $0x107bc1c4; WORD $0xd42c // vmovsd	(%r12,%rdx,8), %xmm5
+	LONG $0xb9d1e2c4; WORD $0xc304 // vfmadd231sd	(%rbx,%rax,8), %xmm5, %xmm0
+
+BB0_43:
+	QUAD $0x00000180249c394c       // cmpq	%r11, 384(%rsp)
+	JLE  BB0_50
+	QUAD $0x0000013024848b48       // movq	304(%rsp), %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_51
+	LONG $0x587ba1c4; WORD $0xd804 // vaddsd	(%rax,%r11,8), %xmm0, %xmm0
+
+BB0_51:
+	QUAD $0x0000018824848b48       // movq	392(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xd804 // vmovsd	%xmm0, (%rax,%r11,8)
+
+BB0_52:
+	QUAD $0x000001b824848b48 // movq	440(%rsp), %rax
+	LONG $0x01c38349         // addq	$1, %r11
+	WORD $0x014c; BYTE $0xff // addq	%r15, %rdi
+	WORD $0x0148; BYTE $0xc1 // addq	%rax, %rcx
+	QUAD $0x000001a024848b48 // movq	416(%rsp), %rax
+	WORD $0x3949; BYTE $0xc3 // cmpq	%rax, %r11
+	JL   BB0_54
+	QUAD $0x0000015024b48b48 // movq	336(%rsp), %rsi
+	QUAD $0x0000014824948b48 // movq	328(%rsp), %rdx
+	QUAD $0x00000168249c394c // cmpq	%r11, 360(%rsp)
+	JG   BB0_39
+	JMP  BB0_70
+
+BB0_50:
+	QUAD $0x000000f824bc8348; BYTE $0x00 // cmpq	$0, 248(%rsp)
+	JE   BB0_53
+	QUAD $0x0000015824848b48             // movq	344(%rsp), %rax
+	LONG $0x587ba1c4; WORD $0xd804       // vaddsd	(%rax,%r11,8), %xmm0, %xmm0
+
+BB0_53:
+	QUAD $0x0000019024848b48       // movq	400(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xd804 // vmovsd	%xmm0, (%rax,%r11,8)
+	JMP  BB0_52
+
+BB0_77:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	JMP  BB0_41
+
+BB0_78:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_44
+
+BB0_80:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_59
+
+BB0_71:
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	JMP  BB0_2
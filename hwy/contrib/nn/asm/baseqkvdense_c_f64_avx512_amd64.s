@@ -0,0 +1,1368 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/baseqkvdense_c_f64_avx512_amd64.c
+
+TEXT ·qkvdense_c_f64_avx512(SB), $432-160
+	MOVQ x+0(FP), DI
+	MOVQ wQKV+8(FP), SI
+	MOVQ biasQ+16(FP), DX
+	MOVQ biasK+24(FP), CX
+	MOVQ biasV+32(FP), R8
+	MOVQ q+40(FP), R9
+	MOVQ k+48(FP), R11
+	MOVQ R11, 320(SP)
+	MOVQ v+56(FP), R11
+	MOVQ R11, 328(SP)
+	MOVQ pbatchSize+64(FP), R11
+	MOVQ R11, 336(SP)
+	MOVQ pinFeatures+72(FP), R11
+	MOVQ R11, 344(SP)
+	MOVQ pqDim+80(FP), R11
+	MOVQ R11, 352(SP)
+	MOVQ pkvDim+88(FP), R11
+	MOVQ R11, 360(SP)
+	MOVQ plen_x+96(FP), R11
+	MOVQ R11, 368(SP)
+	MOVQ plen_wQKV+104(FP), R11
+	MOVQ R11, 376(SP)
+	MOVQ plen_biasQ+112(FP), R11
+	MOVQ R11, 384(SP)
+	MOVQ plen_biasK+120(FP), R11
+	MOVQ R11, 392(SP)
+	MOVQ plen_biasV+128(FP), R11
+	MOVQ R11, 400(SP)
+	MOVQ plen_q+136(FP), R11
+	MOVQ R11, 408(SP)
+	MOVQ plen_k+144(FP), R11
+	MOVQ R11, 416(SP)
+	MOVQ plen_v+152(FP), R11
+	MOVQ R11, 424(SP)
+	LONG $0x6ef961c4; BYTE $0xca               // vmovq	%rdx, %xmm9
+	LONG $0x6ef9c1c4; BYTE $0xf8               // vmovq	%r8, %xmm7
+	LONG $0x6ef961c4; BYTE $0xf9               // vmovq	%rcx, %xmm15
+	QUAD $0x0000013024ac8d48                   // leaq	304(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x40               // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348                           // andq	$-64, %rsp
+	LONG $0x20458b48                           // movq	32(%rbp), %rax
+	LONG $0x105d8b48                           // movq	16(%rbp), %rbx
+	QUAD $0x000000d824b48948                   // movq	%rsi, 216(%rsp)
+	WORD $0x8b48; BYTE $0x30                   // movq	(%rax), %rsi
+	LONG $0x28458b48                           // movq	40(%rbp), %rax
+	LONG $0x244c894c; BYTE $0x28               // movq	%r9, 40(%rsp)
+	WORD $0x8b48; BYTE $0x10                   // movq	(%rax), %rdx
+	LONG $0x38458b48                           // movq	56(%rbp), %rax
+	LONG $0x24748948; BYTE $0x48               // movq	%rsi, 72(%rsp)
+	WORD $0x8b4c; BYTE $0x18                   // movq	(%rax), %r11
+	LONG $0x30458b48                           // movq	48(%rbp), %rax
+	WORD $0x8b4c; BYTE $0x38                   // movq	(%rax), %r15
+	LONG $0x1b048d4b                           // leaq	(%r11,%r11), %rax
+	QUAD $0x00000080249c894c                   // movq	%r11, 128(%rsp)
+	LONG $0x38048d4e                           // leaq	(%rax,%r15), %r8
+	QUAD $0x000000c824bc894c                   // movq	%r15, 200(%rsp)
+	QUAD $0x000000b82484894c                   // movq	%r8, 184(%rsp)
+	LONG $0x03fe8348                           // cmpq	$3, %rsi
+	JLE  BB0_71
+	LONG $0x12148d4c                           // leaq	(%rdx,%rdx), %r10
+	LONG $0xf8428d4c                           // leaq	-8(%rdx), %r8
+	LONG $0x24448948; BYTE $0x58               // movq	%rax, 88(%rsp)
+	WORD $0x894d; BYTE $0xcc                   // movq	%r9, %r12
+	QUAD $0x000000f02494894c                   // movq	%r10, 240(%rsp)
+	WORD $0x0149; BYTE $0xd2                   // addq	%rdx, %r10
+	LONG $0x03e8c149                           // shrq	$3, %r8
+	WORD $0x8949; BYTE $0xfd                   // movq	%rdi, %r13
+	QUAD $0x000000e82494894c                   // movq	%r10, 232(%rsp)
+	WORD $0x8949; BYTE $0xd2                   // movq	%rdx, %r10
+	QUAD $0x000000009d348d4a                   // leaq	0(,%r11,4), %rsi
+	QUAD $0x00000008c5048d4e                   // leaq	8(,%r8,8), %r8
+	LONG $0x05e2c149                           // salq	$5, %r10
+	LONG $0x6ef961c4; BYTE $0xc6               // vmovq	%rsi, %xmm8
+	LONG $0x18348d4a                           // leaq	(%rax,%r11), %rsi
+	QUAD $0x000000b02484894c                   // movq	%r8, 176(%rsp)
+	LONG $0x2454894c; BYTE $0x20               // movq	%r10, 32(%rsp)
+	WORD $0x894d; BYTE $0xf8                   // movq	%r15, %r8
+	QUAD $0x00000000d5148d4c                   // leaq	0(,%rdx,8), %r10
+	LONG $0x7ef941c4; BYTE $0xf9               // vmovq	%xmm15, %r9
+	LONG $0x24748948; BYTE $0x50               // movq	%rsi, 80(%rsp)
+	LONG $0x17348d4a                           // leaq	(%rdi,%r10), %rsi
+	WORD $0xf749; BYTE $0xd8                   // negq	%r8
+	LONG $0x6ef941c4; BYTE $0xd2               // vmovq	%r10, %xmm10
+	LONG $0x16048d4a                           // leaq	(%rsi,%r10), %rax
+	LONG $0x03e0c149                           // salq	$3, %r8
+	QUAD $0x00000000950c8d48                   // leaq	0(,%rdx,4), %rcx
+	QUAD $0x000000f824948948                   // movq	%rdx, 248(%rsp)
+	LONG $0x10348d4e                           // leaq	(%rax,%r10), %r14
+	WORD $0x894d; BYTE $0xfa                   // movq	%r15, %r10
+	WORD $0x014d; BYTE $0xc1                   // addq	%r8, %r9
+	QUAD $0x000000682444c748; BYTE $0x00       // movq	$0, 104(%rsp)
+	LONG $0x05e2c149                           // salq	$5, %r10
+	LONG $0x08fdc162; WORD $0xf16e             // vmovq	%r9, %xmm22
+	LONG $0x180c8d4d                           // leaq	(%r8,%rbx), %r9
+	QUAD $0x000000e02484c748; LONG $0x00000000 // movq	$0, 224(%rsp)
+	LONG $0x2454894c; BYTE $0x18               // movq	%r10, 24(%rsp)
+	WORD $0x894d; BYTE $0xda                   // movq	%r11, %r10
+	LONG $0x05e3c149                           // salq	$5, %r11
+	LONG $0x08fd4162; WORD $0xc96e             // vmovq	%r9, %xmm25
+	LONG $0x245c894c; BYTE $0x10               // movq	%r11, 16(%rsp)
+	LONG $0x244c8b4c; BYTE $0x58               // movq	88(%rsp), %r9
+	WORD $0x894d; BYTE $0xd3                   // movq	%r10, %r11
+	LONG $0x3a148d4f                           // leaq	(%r10,%r15), %r10
+	WORD $0x294d; BYTE $0xfb                   // subq	%r15, %r11
+	LONG $0x2454894c; BYTE $0x30               // movq	%r10, 48(%rsp)
+	LONG $0x08fd0162; WORD $0xf96f             // vmovdqa64	%xmm25, %xmm31
+	LONG $0x08fdc162; WORD $0xd16f             // vmovdqa64	%xmm9, %xmm18
+	WORD $0x294d; BYTE $0xf9                   // subq	%r15, %r9
+	LONG $0xdb1c8d4e                           // leaq	(%rbx,%r11,8), %r11
+	LONG $0x244c8948; BYTE $0x60               // movq	%rcx, 96(%rsp)
+	LONG $0x08fd4162; WORD $0xd36e             // vmovq	%r11, %xmm26
+	LONG $0xcb1c8d4e                           // leaq	(%rbx,%r9,8), %r11
+	LONG $0x244c8b4c; BYTE $0x50               // movq	80(%rsp), %r9
+	LONG $0x08fd4162; WORD $0xc36e             // vmovq	%r11, %xmm24
+	LONG $0x08fd1162; WORD $0xea6f             // vmovdqa64	%xmm26, %xmm13
+	WORD $0x294d; BYTE $0xf9                   // subq	%r15, %r9
+	LONG $0x08fd1162; WORD $0xe06f             // vmovdqa64	%xmm24, %xmm12
+	LONG $0xcb1c8d4e                           // leaq	(%rbx,%r9,8), %r11
+	LONG $0x6ef9c1c4; BYTE $0xf3               // vmovq	%r11, %xmm6
+	WORD $0x894d; BYTE $0xe3                   // movq	%r12, %r11
+	WORD $0x294d; BYTE $0xc4                   // subq	%r8, %r12
+	WORD $0x894d; BYTE $0xf8                   // movq	%r15, %r8
+	LONG $0x04e0c149                           // salq	$4, %r8
+	LONG $0x2464894c; BYTE $0x08               // movq	%r12, 8(%rsp)
+	WORD $0x894d; BYTE $0xdc                   // movq	%r11, %r12
+	LONG $0xde6f79c5                           // vmovdqa	%xmm6, %xmm11
+	LONG $0x181c8d4f                           // leaq	(%r8,%r11), %r11
+	LONG $0x7f048d4f                           // leaq	(%r15,%r15,2), %r8
+	LONG $0xc43c8d4f                           // leaq	(%r12,%r8,8), %r15
+	WORD $0x894d; BYTE $0xd0                   // movq	%r10, %r8
+	WORD $0x3145; BYTE $0xe4                   // xorl	%r12d, %r12d
+	LONG $0x241c894c                           // movq	%r11, (%rsp)
+	WORD $0xf749; BYTE $0xd8                   // negq	%r8
+	LONG $0x08fdc162; WORD $0xff6e             // vmovq	%r15, %xmm23
+	LONG $0x7ef9c1c4; BYTE $0xff               // vmovq	%xmm7, %r15
+	LONG $0x0003bb41; WORD $0x0000             // movl	$3, %r11d
+	LONG $0xc73c8d4f                           // leaq	(%r15,%r8,8), %r15
+	QUAD $0x000000b824848b4c                   // movq	184(%rsp), %r8
+	LONG $0x2464894c; BYTE $0x40               // movq	%r12, 64(%rsp)
+	LONG $0x08fdc162; WORD $0xef6e             // vmovq	%r15, %xmm21
+	WORD $0x3145; BYTE $0xff                   // xorl	%r15d, %r15d
+	QUAD $0x00000088249c894c                   // movq	%r11, 136(%rsp)
+	WORD $0x394d; BYTE $0xd0                   // cmpq	%r10, %r8
+	LONG $0x247c894c; BYTE $0x38               // movq	%r15, 56(%rsp)
+	LONG $0xd04e0f4d                           // cmovle	%r8, %r10
+	LONG $0x6ef941c4; BYTE $0xf2               // vmovq	%r10, %xmm14
+
+BB0_4:
+	QUAD $0x000000b824bc8348; BYTE $0x00 // cmpq	$0, 184(%rsp)
+	JLE  BB0_20
+	LONG $0x247c8348; WORD $0x0030       // cmpq	$0, 48(%rsp)
+	JLE  BB0_72
+	LONG $0x244c8b48; BYTE $0x38         // movq	56(%rsp), %rcx
+	LONG $0x08fd4162; WORD $0xff7e       // vmovq	%xmm31, %r15
+	LONG $0x245c8b4c; BYTE $0x28         // movq	40(%rsp), %r11
+	QUAD $0x000000d8249c8b48             // movq	216(%rsp), %rbx
+	WORD $0x0149; BYTE $0xcf             // addq	%rcx, %r15
+	LONG $0x08fd4162; WORD $0xf76e       // vmovq	%r15, %xmm30
+	LONG $0x7ef941c4; BYTE $0xef         // vmovq	%xmm13, %r15
+	WORD $0x0149; BYTE $0xcf             // addq	%rcx, %r15
+	LONG $0x08fd4162; WORD $0xef6e       // vmovq	%r15, %xmm29
+	LONG $0x7ef941c4; BYTE $0xe7         // vmovq	%xmm12, %r15
+	WORD $0x0149; BYTE $0xcf             // addq	%rcx, %r15
+	LONG $0x08fdc162; WORD $0xe76e       // vmovq	%r15, %xmm20
+	LONG $0x7ef941c4; BYTE $0xdf         // vmovq	%xmm11, %r15
+	WORD $0x014c; BYTE $0xf9             // addq	%r15, %rcx
+	LONG $0x247c8b4c; BYTE $0x08         // movq	8(%rsp), %r15
+	LONG $0x08fde162; WORD $0xc96e       // vmovq	%rcx, %xmm17
+	LONG $0x244c8b48; BYTE $0x68         // movq	104(%rsp), %rcx
+	QUAD $0x0f244c7e08fde162             // vmovq	%xmm17, 120(%rsp)
+	LONG $0x08fd8162; WORD $0xce6f       // vmovdqa64	%xmm30, %xmm17
+	LONG $0x08fd2162; WORD $0xf46f       // vmovdqa64	%xmm20, %xmm30
+	LONG $0x08fd8162; WORD $0xe56f       // vmovdqa64	%xmm29, %xmm20
+	WORD $0x0149; BYTE $0xcf             // addq	%rcx, %r15
+	LONG $0x08fdc162; WORD $0xdf6e       // vmovq	%r15, %xmm19
+	LONG $0x243c8b4c                     // movq	(%rsp), %r15
+	LONG $0x39148d4e                     // leaq	(%rcx,%r15), %r10
+	LONG $0x08fdc162; WORD $0xff7e       // vmovq	%xmm23, %r15
+	LONG $0x08fd4162; WORD $0xca6e       // vmovq	%r10, %xmm25
+	LONG $0x39148d4e                     // leaq	(%rcx,%r15), %r10
+	WORD $0x014c; BYTE $0xd9             // addq	%r11, %rcx
+	WORD $0x3145; BYTE $0xff             // xorl	%r15d, %r15d
+	LONG $0x08fd4162; WORD $0xd26e       // vmovq	%r10, %xmm26
+	LONG $0x08fde162; WORD $0xc16e       // vmovq	%rcx, %xmm16
+	WORD $0x3145; BYTE $0xd2             // xorl	%r10d, %r10d
+
+BB0_19:
+	LONG $0x07fa8348               // cmpq	$7, %rdx
+	JLE  BB0_73
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b9; BYTE $0x00   // movl	$8, %ecx
+	LONG $0x48fdf162; WORD $0xd128 // vmovapd	%zmm1, %zmm2
+	LONG $0x48fdf162; WORD $0xd928 // vmovapd	%zmm1, %zmm3
+	LONG $0x48fdf162; WORD $0xe128 // vmovapd	%zmm1, %zmm4
+
+BB0_7:
+	QUAD $0xffcb441048fdf162 // vmovupd	-64(%rbx,%rcx,8), %zmm0
+	QUAD $0xffcd64b848fdd262 // vfmadd231pd	-64(%r13,%rcx,8), %zmm0, %zmm4
+	QUAD $0xffce5cb848fdf262 // vfmadd231pd	-64(%rsi,%rcx,8), %zmm0, %zmm3
+	QUAD $0xffc854b848fdf262 // vfmadd231pd	-64(%rax,%rcx,8), %zmm0, %zmm2
+	QUAD $0xffce4cb848fdd262 // vfmadd231pd	-64(%r14,%rcx,8), %zmm0, %zmm1
+	LONG $0x08c18348         // addq	$8, %rcx
+	WORD $0x3948; BYTE $0xd1 // cmpq	%rdx, %rcx
+	JLE  BB0_7
+	QUAD $0x000000b0249c8b4c // movq	176(%rsp), %r11
+
+BB0_6:
+	LONG $0x48fdf362; WORD $0xe01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm0
+	LONG $0xe458fdc5                           // vaddpd	%ymm4, %ymm0, %ymm4
+	LONG $0x28fdf362; WORD $0xe019; BYTE $0x01 // vextractf64x2	$0x1, %ymm4, %xmm0
+	LONG $0xc458f9c5                           // vaddpd	%xmm4, %xmm0, %xmm0
+	LONG $0xe010fbc5                           // vmovsd	%xmm0, %xmm0, %xmm4
+	LONG $0xc015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xe058dbc5                           // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0x48fdf362; WORD $0xd81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm3, %ymm0
+	LONG $0xdb58fdc5                           // vaddpd	%ymm3, %ymm0, %ymm3
+	LONG $0x28fdf362; WORD $0xd819; BYTE $0x01 // vextractf64x2	$0x1, %ymm3, %xmm0
+	LONG $0xc358f9c5                           // vaddpd	%xmm3, %xmm0, %xmm0
+	LONG $0xd810fbc5                           // vmovsd	%xmm0, %xmm0, %xmm3
+	LONG $0xc015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xd858e3c5                           // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0x48fdf362; WORD $0xd01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm0
+	LONG $0xd258fdc5                           // vaddpd	%ymm2, %ymm0, %ymm2
+	LONG $0x28fdf362; WORD $0xd019; BYTE $0x01 // vextractf64x2	$0x1, %ymm2, %xmm0
+	LONG $0xc258f9c5                           // vaddpd	%xmm2, %xmm0, %xmm0
+	LONG $0xd010fbc5                           // vmovsd	%xmm0, %xmm0, %xmm2
+	LONG $0xc015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xd058ebc5                           // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc858f5c5                           // vaddpd	%ymm0, %ymm1, %ymm1
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5                           // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc810fbc5                           // vmovsd	%xmm0, %xmm0, %xmm1
+	LONG $0xc015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	WORD $0x394c; BYTE $0xda                   // cmpq	%r11, %rdx
+	JLE  BB0_8
+	WORD $0x8948; BYTE $0xd1                   // movq	%rdx, %rcx
+	QUAD $0x000000c0249c894c                   // movq	%r11, 192(%rsp)
+	WORD $0x294c; BYTE $0xd9                   // subq	%r11, %rcx
+	QUAD $0x000000d0248c8948                   // movq	%rcx, 208(%rsp)
+	LONG $0x01e98348                           // subq	$1, %rcx
+	LONG $0x06f98348                           // cmpq	$6, %rcx
+	JBE  BB0_74
+	QUAD $0x000000e024848b4c                   // movq	224(%rsp), %r8
+	QUAD $0x000000d8248c8b4c                   // movq	216(%rsp), %r9
+	QUAD $0x0000009024bc8948                   // movq	%rdi, 144(%rsp)
+	QUAD $0x000000f024a48b4c                   // movq	240(%rsp), %r12
+	QUAD $0x000000a024948948                   // movq	%rdx, 160(%rsp)
+	LONG $0x030c8d4b                           // leaq	(%r11,%r8), %rcx
+	QUAD $0x0000009824b48948                   // movq	%rsi, 152(%rsp)
+	LONG $0xcf048d4c                           // leaq	(%rdi,%rcx,8), %r8
+	LONG $0x3b0c8d4b                           // leaq	(%r11,%r15), %rcx
+	LONG $0x08fd4162; WORD $0xe06e             // vmovq	%r8, %xmm28
+	LONG $0xc9048d4d                           // leaq	(%r9,%rcx,8), %r8
+	QUAD $0x000000f8248c8b4c                   // movq	248(%rsp), %r9
+	LONG $0x08fd6162; WORD $0xe27e             // vmovq	%xmm28, %rdx
+	LONG $0x0b0c8d4b                           // leaq	(%r11,%r9), %rcx
+	LONG $0xcf0c8d4c                           // leaq	(%rdi,%rcx,8), %r9
+	LONG $0x230c8d4b                           // leaq	(%r11,%r12), %rcx
+	LONG $0xcf248d4c                           // leaq	(%rdi,%rcx,8), %r12
+	LONG $0x08fd4162; WORD $0xdc6e             // vmovq	%r12, %xmm27
+	QUAD $0x000000e824a48b4c                   // movq	232(%rsp), %r12
+	LONG $0x230c8d4b                           // leaq	(%r11,%r12), %rcx
+	LONG $0xcf248d4c                           // leaq	(%rdi,%rcx,8), %r12
+	QUAD $0x000000d0248c8b48                   // movq	208(%rsp), %rcx
+	WORD $0x8948; BYTE $0xc7                   // movq	%rax, %rdi
+	WORD $0x894c; BYTE $0xe6                   // movq	%r12, %rsi
+	LONG $0x08fd4162; WORD $0xdc7e             // vmovq	%xmm27, %r12
+	LONG $0x03e9c148                           // shrq	$3, %rcx
+	LONG $0x06e1c148                           // salq	$6, %rcx
+	QUAD $0x000000a8248c8948                   // movq	%rcx, 168(%rsp)
+	QUAD $0x000000a824848b48                   // movq	168(%rsp), %rax
+	WORD $0xc931                               // xorl	%ecx, %ecx
+
+BB0_10:
+	LONG $0x48fdd162; WORD $0x0410; BYTE $0x08 // vmovupd	(%r8,%rcx), %zmm0
+	LONG $0x48fdf162; WORD $0x2c59; BYTE $0x0a // vmulpd	(%rdx,%rcx), %zmm0, %zmm5
+	LONG $0x28d56362; WORD $0xc503; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm24
+	LONG $0xe558dbc5                           // vaddsd	%xmm5, %xmm4, %xmm4
+	LONG $0xf515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm6
+	LONG $0xf658dbc5                           // vaddsd	%xmm6, %xmm4, %xmm6
+	LONG $0x28fdf362; WORD $0xec19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm4
+	LONG $0x48fdf362; WORD $0xed1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm5
+	LONG $0xe458cbc5                           // vaddsd	%xmm4, %xmm6, %xmm4
+	LONG $0x08df0162; WORD $0xc058             // vaddsd	%xmm24, %xmm4, %xmm24
+	LONG $0xe515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm4
+	LONG $0x00bff162; WORD $0xf558             // vaddsd	%xmm5, %xmm24, %xmm6
+	LONG $0xe458cbc5                           // vaddsd	%xmm4, %xmm6, %xmm4
+	LONG $0x28fdf362; WORD $0xee19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm6
+	LONG $0x28d5f362; WORD $0xed03; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm5
+	LONG $0xe658dbc5                           // vaddsd	%xmm6, %xmm4, %xmm4
+	LONG $0xe558dbc5                           // vaddsd	%xmm5, %xmm4, %xmm4
+	LONG $0x48fdd162; WORD $0x2c59; BYTE $0x09 // vmulpd	(%r9,%rcx), %zmm0, %zmm5
+	LONG $0x28d56362; WORD $0xc503; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm24
+	LONG $0xdd58e3c5                           // vaddsd	%xmm5, %xmm3, %xmm3
+	LONG $0xf515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm6
+	LONG $0xf658e3c5                           // vaddsd	%xmm6, %xmm3, %xmm6
+	LONG $0x28fdf362; WORD $0xeb19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm3
+	LONG $0x48fdf362; WORD $0xed1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm5
+	LONG $0xdb58cbc5                           // vaddsd	%xmm3, %xmm6, %xmm3
+	LONG $0x08e70162; WORD $0xc058             // vaddsd	%xmm24, %xmm3, %xmm24
+	LONG $0xdd15d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm3
+	LONG $0x00bff162; WORD $0xf558             // vaddsd	%xmm5, %xmm24, %xmm6
+	LONG $0xdb58cbc5                           // vaddsd	%xmm3, %xmm6, %xmm3
+	LONG $0x28fdf362; WORD $0xee19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm6
+	LONG $0x28d5f362; WORD $0xed03; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm5
+	LONG $0xde58e3c5                           // vaddsd	%xmm6, %xmm3, %xmm3
+	LONG $0xdd58e3c5                           // vaddsd	%xmm5, %xmm3, %xmm3
+	LONG $0x48fdd162; WORD $0x2c59; BYTE $0x0c // vmulpd	(%r12,%rcx), %zmm0, %zmm5
+	LONG $0x48fdf162; WORD $0x0459; BYTE $0x0e // vmulpd	(%rsi,%rcx), %zmm0, %zmm0
+	LONG $0x40c18348                           // addq	$64, %rcx
+	LONG $0x28d56362; WORD $0xc503; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm24
+	LONG $0xd558ebc5                           // vaddsd	%xmm5, %xmm2, %xmm2
+	LONG $0xf515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm6
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	LONG $0xf658ebc5                           // vaddsd	%xmm6, %xmm2, %xmm6
+	LONG $0x28fdf362; WORD $0xea19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm2
+	LONG $0x48fdf362; WORD $0xed1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm5
+	LONG $0xd258cbc5                           // vaddsd	%xmm2, %xmm6, %xmm2
+	LONG $0x08ef0162; WORD $0xc058             // vaddsd	%xmm24, %xmm2, %xmm24
+	LONG $0xd515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm2
+	LONG $0x00bff162; WORD $0xf558             // vaddsd	%xmm5, %xmm24, %xmm6
+	LONG $0xd258cbc5                           // vaddsd	%xmm2, %xmm6, %xmm2
+	LONG $0x28fdf362; WORD $0xee19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm6
+	LONG $0x28d5f362; WORD $0xed03; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm5
+	LONG $0xd658ebc5                           // vaddsd	%xmm6, %xmm2, %xmm2
+	LONG $0x28fdf362; WORD $0xf003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm6
+	LONG $0xd558ebc5                           // vaddsd	%xmm5, %xmm2, %xmm2
+	LONG $0xe815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm5
+	LONG $0xed58f3c5                           // vaddsd	%xmm5, %xmm1, %xmm5
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm1
+	LONG $0x48fdf362; WORD $0xc01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm0
+	LONG $0xc958d3c5                           // vaddsd	%xmm1, %xmm5, %xmm1
+	LONG $0xf658f3c5                           // vaddsd	%xmm6, %xmm1, %xmm6
+	LONG $0xc815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xe858cbc5                           // vaddsd	%xmm0, %xmm6, %xmm5
+	LONG $0xc958d3c5                           // vaddsd	%xmm1, %xmm5, %xmm1
+	LONG $0x28fdf362; WORD $0xc519; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm5
+	LONG $0x28fdf362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm0
+	LONG $0xcd58f3c5                           // vaddsd	%xmm5, %xmm1, %xmm1
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JNE  BB0_10
+	QUAD $0x000000d024848b4c                   // movq	208(%rsp), %r8
+	WORD $0x8948; BYTE $0xf8                   // movq	%rdi, %rax
+	QUAD $0x000000a024948b48                   // movq	160(%rsp), %rdx
+	QUAD $0x0000009824b48b48                   // movq	152(%rsp), %rsi
+	QUAD $0x0000009024bc8b48                   // movq	144(%rsp), %rdi
+	WORD $0x894c; BYTE $0xc1                   // movq	%r8, %rcx
+	LONG $0xf8e18348                           // andq	$-8, %rcx
+	WORD $0x0149; BYTE $0xcb                   // addq	%rcx, %r11
+	LONG $0x07e08341                           // andl	$7, %r8d
+	JE   BB0_8
+
+BB0_9:
+	QUAD $0x000000d024a48b4c                   // movq	208(%rsp), %r12
+	WORD $0x2949; BYTE $0xcc                   // subq	%rcx, %r12
+	LONG $0x244c8d4d; BYTE $0xff               // leaq	-1(%r12), %r9
+	LONG $0x02f98349                           // cmpq	$2, %r9
+	JBE  BB0_13
+	QUAD $0x000000c024848b4c                   // movq	192(%rsp), %r8
+	WORD $0x0149; BYTE $0xc8                   // addq	%rcx, %r8
+	WORD $0x894c; BYTE $0xc1                   // movq	%r8, %rcx
+	LONG $0x380c8d4f                           // leaq	(%r8,%r15), %r9
+	QUAD $0x000000d824848b4c                   // movq	216(%rsp), %r8
+	LONG $0x107d81c4; WORD $0xc804             // vmovupd	(%r8,%r9,8), %ymm0
+	QUAD $0x000000e024848b4c                   // movq	224(%rsp), %r8
+	LONG $0x010c8d4e                           // leaq	(%rcx,%r8), %r9
+	QUAD $0x000000f824848b4c                   // movq	248(%rsp), %r8
+	LONG $0x28fd2162; WORD $0x1c59; BYTE $0xcf // vmulpd	(%rdi,%r9,8), %ymm0, %ymm27
+	LONG $0x010c8d4e                           // leaq	(%rcx,%r8), %r9
+	QUAD $0x000000f024848b4c                   // movq	240(%rsp), %r8
+	LONG $0x28fd6362; WORD $0xdd19; BYTE $0x01 // vextractf64x2	$1, %ymm27, %xmm5
+	LONG $0x08df9162; WORD $0xe358             // vaddsd	%xmm27, %xmm4, %xmm4
+	LONG $0x00a50162; WORD $0xe315             // vunpckhpd	%xmm27, %xmm27, %xmm28
+	LONG $0x20a50362; WORD $0xdb03; BYTE $0x03 // valignq	$3, %ymm27, %ymm27, %ymm27
+	LONG $0x08df9162; WORD $0xe458             // vaddsd	%xmm28, %xmm4, %xmm4
+	LONG $0xe558dbc5                           // vaddsd	%xmm5, %xmm4, %xmm4
+	LONG $0x08df9162; WORD $0xe358             // vaddsd	%xmm27, %xmm4, %xmm4
+	LONG $0x28fd2162; WORD $0x1c59; BYTE $0xcf // vmulpd	(%rdi,%r9,8), %ymm0, %ymm27
+	LONG $0x010c8d4e                           // leaq	(%rcx,%r8), %r9
+	QUAD $0x000000e824848b4c                   // movq	232(%rsp), %r8
+	WORD $0x014c; BYTE $0xc1                   // addq	%r8, %rcx
+	LONG $0x28fd6362; WORD $0xdd19; BYTE $0x01 // vextractf64x2	$1, %ymm27, %xmm5
+	LONG $0x08e79162; WORD $0xdb58             // vaddsd	%xmm27, %xmm3, %xmm3
+	LONG $0x00a50162; WORD $0xe315             // vunpckhpd	%xmm27, %xmm27, %xmm28
+	LONG $0x20a50362; WORD $0xdb03; BYTE $0x03 // valignq	$3, %ymm27, %ymm27, %ymm27
+	LONG $0x08e79162; WORD $0xdc58             // vaddsd	%xmm28, %xmm3, %xmm3
+	LONG $0xdd58e3c5                           // vaddsd	%xmm5, %xmm3, %xmm3
+	LONG $0x08e79162; WORD $0xdb58             // vaddsd	%xmm27, %xmm3, %xmm3
+	LONG $0x28fd2162; WORD $0x1c59; BYTE $0xcf // vmulpd	(%rdi,%r9,8), %ymm0, %ymm27
+	LONG $0x0459fdc5; BYTE $0xcf               // vmulpd	(%rdi,%rcx,8), %ymm0, %ymm0
+	WORD $0x894c; BYTE $0xe1                   // movq	%r12, %rcx
+	LONG $0xfce18348                           // andq	$-4, %rcx
+	WORD $0x0149; BYTE $0xcb                   // addq	%rcx, %r11
+	LONG $0x03e48341                           // andl	$3, %r12d
+	LONG $0x28fd6362; WORD $0xdd19; BYTE $0x01 // vextractf64x2	$1, %ymm27, %xmm5
+	LONG $0x08ef9162; WORD $0xd358             // vaddsd	%xmm27, %xmm2, %xmm2
+	LONG $0x00a50162; WORD $0xe315             // vunpckhpd	%xmm27, %xmm27, %xmm28
+	LONG $0x20a50362; WORD $0xdb03; BYTE $0x03 // valignq	$3, %ymm27, %ymm27, %ymm27
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	LONG $0x08ef9162; WORD $0xd458             // vaddsd	%xmm28, %xmm2, %xmm2
+	LONG $0xd558ebc5                           // vaddsd	%xmm5, %xmm2, %xmm2
+	LONG $0x28fdf362; WORD $0xc519; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm5
+	LONG $0x08ef9162; WORD $0xd358             // vaddsd	%xmm27, %xmm2, %xmm2
+	LONG $0x08fd6162; WORD $0xd815             // vunpckhpd	%xmm0, %xmm0, %xmm27
+	LONG $0x28fdf362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm0
+	LONG $0x08f79162; WORD $0xcb58             // vaddsd	%xmm27, %xmm1, %xmm1
+	LONG $0xcd58f3c5                           // vaddsd	%xmm5, %xmm1, %xmm1
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	JE   BB0_8
+
+BB0_13:
+	QUAD $0x000000d824848b4c       // movq	216(%rsp), %r8
+	QUAD $0x000000e024a48b4c       // movq	224(%rsp), %r12
+	LONG $0x1f0c8d4b               // leaq	(%r15,%r11), %rcx
+	QUAD $0x000000f0248c8b4c       // movq	240(%rsp), %r9
+	LONG $0x107bc1c4; WORD $0xc804 // vmovsd	(%r8,%rcx,8), %xmm0
+	LONG $0x1c0c8d4b               // leaq	(%r12,%r11), %rcx
+	LONG $0xb9f9e2c4; WORD $0xcf24 // vfmadd231sd	(%rdi,%rcx,8), %xmm0, %xmm4
+	QUAD $0x000000f8248c8b48       // movq	248(%rsp), %rcx
+	WORD $0x014c; BYTE $0xd9       // addq	%r11, %rcx
+	LONG $0xb9f9e2c4; WORD $0xcf1c // vfmadd231sd	(%rdi,%rcx,8), %xmm0, %xmm3
+	LONG $0x190c8d4b               // leaq	(%r9,%r11), %rcx
+	LONG $0xb9f9e2c4; WORD $0xcf14 // vfmadd231sd	(%rdi,%rcx,8), %xmm0, %xmm2
+	QUAD $0x000000e8248c8b48       // movq	232(%rsp), %rcx
+	WORD $0x014c; BYTE $0xd9       // addq	%r11, %rcx
+	LONG $0xb9f9e2c4; WORD $0xcf0c // vfmadd231sd	(%rdi,%rcx,8), %xmm0, %xmm1
+	LONG $0x014b8d49               // leaq	1(%r11), %rcx
+	WORD $0x3948; BYTE $0xca       // cmpq	%rcx, %rdx
+	JLE  BB0_8
+	LONG $0x0f0c8d4d               // leaq	(%r15,%rcx), %r9
+	LONG $0x02c38349               // addq	$2, %r11
+	LONG $0x107b81c4; WORD $0xc804 // vmovsd	(%r8,%r9,8), %xmm0
+	LONG $0x0c0c8d4d               // leaq	(%r12,%rcx), %r9
+	LONG $0xb9f9a2c4; WORD $0xcf24 // vfmadd231sd	(%rdi,%r9,8), %xmm0, %xmm4
+	QUAD $0x000000f8248c8b4c       // movq	248(%rsp), %r9
+	WORD $0x0149; BYTE $0xc9       // addq	%rcx, %r9
+	LONG $0xb9f9a2c4; WORD $0xcf1c // vfmadd231sd	(%rdi,%r9,8), %xmm0, %xmm3
+	QUAD $0x000000f0248c8b4c       // movq	240(%rsp), %r9
+	WORD $0x0149; BYTE $0xc9       // addq	%rcx, %r9
+	LONG $0xb9f9a2c4; WORD $0xcf14 // vfmadd231sd	(%rdi,%r9,8), %xmm0, %xmm2
+	QUAD $0x000000e8248c8b4c       // movq	232(%rsp), %r9
+	WORD $0x014c; BYTE $0xc9       // addq	%r9, %rcx
+	LONG $0xb9f9e2c4; WORD $0xcf0c // vfmadd231sd	(%rdi,%rcx,8), %xmm0, %xmm1
+	WORD $0x394c; BYTE $0xda       // cmpq	%r11, %rdx
+	JLE  BB0_8
+	LONG $0x1f0c8d4b               // leaq	(%r15,%r11), %rcx
+	QUAD $0x000000f8248c8b4c       // movq	248(%rsp), %r9
+	LONG $0x107bc1c4; WORD $0xc804 // vmovsd	(%r8,%rcx,8), %xmm0
+	LONG $0x1c0c8d4b               // leaq	(%r12,%r11), %rcx
+	LONG $0xb9f9e2c4; WORD $0xcf24 // vfmadd231sd	(%rdi,%rcx,8), %xmm0, %xmm4
+	LONG $0x190c8d4b               // leaq	(%r9,%r11), %rcx
+	QUAD $0x000000f0248c8b4c       // movq	240(%rsp), %r9
+	LONG $0xb9f9e2c4; WORD $0xcf1c // vfmadd231sd	(%rdi,%rcx,8), %xmm0, %xmm3
+	LONG $0x190c8d4b               // leaq	(%r9,%r11), %rcx
+	QUAD $0x000000e8248c8b4c       // movq	232(%rsp), %r9
+	LONG $0xb9f9e2c4; WORD $0xcf14 // vfmadd231sd	(%rdi,%rcx,8), %xmm0, %xmm2
+	WORD $0x014d; BYTE $0xcb       // addq	%r9, %r11
+	LONG $0xb9f9a2c4; WORD $0xdf0c // vfmadd231sd	(%rdi,%r11,8), %xmm0, %xmm1
+
+BB0_8:
+	QUAD $0x000000c82494394c       // cmpq	%r10, 200(%rsp)
+	JLE  BB0_15
+	LONG $0x08fde162; WORD $0xd17e // vmovq	%xmm18, %rcx
+	WORD $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JE   BB0_16
+	LONG $0x107ba1c4; WORD $0xd104 // vmovsd	(%rcx,%r10,8), %xmm0
+	LONG $0xe058dbc5               // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xd058ebc5               // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0xc858f3c5               // vaddsd	%xmm0, %xmm1, %xmm1
+
+BB0_16:
+	LONG $0x08fde162; WORD $0xc17e // vmovq	%xmm16, %rcx
+	LONG $0x117ba1c4; WORD $0xd124 // vmovsd	%xmm4, (%rcx,%r10,8)
+	LONG $0x08fde162; WORD $0xd97e // vmovq	%xmm19, %rcx
+	LONG $0x117ba1c4; WORD $0xd11c // vmovsd	%xmm3, (%rcx,%r10,8)
+	LONG $0x08fd6162; WORD $0xc97e // vmovq	%xmm25, %rcx
+	LONG $0x117ba1c4; WORD $0xd114 // vmovsd	%xmm2, (%rcx,%r10,8)
+	LONG $0x08fd6162; WORD $0xd17e // vmovq	%xmm26, %rcx
+	LONG $0x117ba1c4; WORD $0xd10c // vmovsd	%xmm1, (%rcx,%r10,8)
+
+BB0_17:
+	LONG $0x7ef961c4; BYTE $0xd1 // vmovq	%xmm10, %rcx
+	LONG $0x01c28349             // addq	$1, %r10
+	WORD $0x0149; BYTE $0xd7     // addq	%rdx, %r15
+	WORD $0x0148; BYTE $0xcb     // addq	%rcx, %rbx
+	LONG $0x7ef961c4; BYTE $0xf1 // vmovq	%xmm14, %rcx
+	WORD $0x3949; BYTE $0xca     // cmpq	%rcx, %r10
+	JL   BB0_19
+	QUAD $0x000000b82494394c     // cmpq	%r10, 184(%rsp)
+	JLE  BB0_20
+
+BB0_5:
+	LONG $0x245c8b4c; BYTE $0x40 // movq	64(%rsp), %r11
+	LONG $0x245c8b48; BYTE $0x30 // movq	48(%rsp), %rbx
+	WORD $0x8949; BYTE $0xd7     // movq	%rdx, %r15
+	LONG $0xfaaf0f4d             // imulq	%r10, %r15
+	WORD $0x894c; BYTE $0xd9     // movq	%r11, %rcx
+	WORD $0x2948; BYTE $0xd9     // subq	%rbx, %rcx
+	LONG $0x185d8b48             // movq	24(%rbp), %rbx
+	WORD $0x014c; BYTE $0xd1     // addq	%r10, %rcx
+	LONG $0xcb1c8d48             // leaq	(%rbx,%rcx,8), %rbx
+	LONG $0x244c8b48; BYTE $0x58 // movq	88(%rsp), %rcx
+	QUAD $0x000000a0249c8948     // movq	%rbx, 160(%rsp)
+	QUAD $0x000000d8249c8b48     // movq	216(%rsp), %rbx
+	WORD $0x294c; BYTE $0xd9     // subq	%r11, %rcx
+	LONG $0x244c8948; BYTE $0x78 // movq	%rcx, 120(%rsp)
+	LONG $0x244c8b48; BYTE $0x50 // movq	80(%rsp), %rcx
+	LONG $0xfb1c8d4a             // leaq	(%rbx,%r15,8), %rbx
+	WORD $0x294c; BYTE $0xd9     // subq	%r11, %rcx
+	LONG $0x245c8b4c; BYTE $0x68 // movq	104(%rsp), %r11
+	LONG $0x244c8948; BYTE $0x70 // movq	%rcx, 112(%rsp)
+	LONG $0x244c8b48; BYTE $0x28 // movq	40(%rsp), %rcx
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x6ef961c4; BYTE $0xc9 // vmovq	%rcx, %xmm9
+
+BB0_34:
+	LONG $0x07fa8348               // cmpq	$7, %rdx
+	JLE  BB0_75
+	LONG $0xe457d9c5               // vxorpd	%xmm4, %xmm4, %xmm4
+	LONG $0x000008b9; BYTE $0x00   // movl	$8, %ecx
+	LONG $0x48fdf162; WORD $0xcc28 // vmovapd	%zmm4, %zmm1
+	LONG $0x48fdf162; WORD $0xd428 // vmovapd	%zmm4, %zmm2
+	LONG $0x48fdf162; WORD $0xdc28 // vmovapd	%zmm4, %zmm3
+
+BB0_22:
+	QUAD $0xffcb441048fdf162 // vmovupd	-64(%rbx,%rcx,8), %zmm0
+	QUAD $0xffcd5cb848fdd262 // vfmadd231pd	-64(%r13,%rcx,8), %zmm0, %zmm3
+	QUAD $0xffce54b848fdf262 // vfmadd231pd	-64(%rsi,%rcx,8), %zmm0, %zmm2
+	QUAD $0xffc84cb848fdf262 // vfmadd231pd	-64(%rax,%rcx,8), %zmm0, %zmm1
+	QUAD $0xffce64b848fdd262 // vfmadd231pd	-64(%r14,%rcx,8), %zmm0, %zmm4
+	LONG $0x08c18348         // addq	$8, %rcx
+	WORD $0x3948; BYTE $0xca // cmpq	%rcx, %rdx
+	JGE  BB0_22
+	QUAD $0x000000b0249c8b4c // movq	176(%rsp), %r11
+
+BB0_21:
+	LONG $0x48fdf362; WORD $0xd81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm3, %ymm0
+	LONG $0xd858e5c5                           // vaddpd	%ymm0, %ymm3, %ymm3
+	LONG $0x28fdf362; WORD $0xdd19; BYTE $0x01 // vextractf64x2	$0x1, %ymm3, %xmm5
+	LONG $0xc558e1c5                           // vaddpd	%xmm5, %xmm3, %xmm0
+	LONG $0xd815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm3
+	LONG $0xd858e3c5                           // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0x48fdf362; WORD $0xd01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm0
+	LONG $0xd058edc5                           // vaddpd	%ymm0, %ymm2, %ymm2
+	LONG $0x28fdf362; WORD $0xd519; BYTE $0x01 // vextractf64x2	$0x1, %ymm2, %xmm5
+	LONG $0xc558e9c5                           // vaddpd	%xmm5, %xmm2, %xmm0
+	LONG $0xd015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm2
+	LONG $0xd058ebc5                           // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc858f5c5                           // vaddpd	%ymm0, %ymm1, %ymm1
+	LONG $0x28fdf362; WORD $0xcd19; BYTE $0x01 // vextractf64x2	$0x1, %ymm1, %xmm5
+	LONG $0xc558f1c5                           // vaddpd	%xmm5, %xmm1, %xmm0
+	LONG $0xc815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	LONG $0x48fdf362; WORD $0xe01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm0
+	LONG $0xe058ddc5                           // vaddpd	%ymm0, %ymm4, %ymm4
+	LONG $0x28fdf362; WORD $0xe019; BYTE $0x01 // vextractf64x2	$0x1, %ymm4, %xmm0
+	LONG $0xe058d9c5                           // vaddpd	%xmm0, %xmm4, %xmm4
+	LONG $0xc415d9c5                           // vunpckhpd	%xmm4, %xmm4, %xmm0
+	LONG $0xc458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xda                   // cmpq	%r11, %rdx
+	JLE  BB0_23
+	WORD $0x8948; BYTE $0xd1                   // movq	%rdx, %rcx
+	QUAD $0x000000c0249c894c                   // movq	%r11, 192(%rsp)
+	WORD $0x294c; BYTE $0xd9                   // subq	%r11, %rcx
+	QUAD $0x000000d0248c8948                   // movq	%rcx, 208(%rsp)
+	LONG $0x01e98348                           // subq	$1, %rcx
+	LONG $0x06f98348                           // cmpq	$6, %rcx
+	JBE  BB0_76
+	QUAD $0x000000e024848b4c                   // movq	224(%rsp), %r8
+	QUAD $0x000000d8248c8b4c                   // movq	216(%rsp), %r9
+	QUAD $0x0000009824948948                   // movq	%rdx, 152(%rsp)
+	QUAD $0x000000f024a48b4c                   // movq	240(%rsp), %r12
+	QUAD $0x0000009024b4894c                   // movq	%r14, 144(%rsp)
+	WORD $0x8949; BYTE $0xc6                   // movq	%rax, %r14
+	LONG $0x030c8d4b                           // leaq	(%r11,%r8), %rcx
+	LONG $0xcf048d4c                           // leaq	(%rdi,%rcx,8), %r8
+	LONG $0x3b0c8d4b                           // leaq	(%r11,%r15), %rcx
+	LONG $0x08fd4162; WORD $0xf06e             // vmovq	%r8, %xmm30
+	LONG $0xc9048d4d                           // leaq	(%r9,%rcx,8), %r8
+	QUAD $0x000000f8248c8b4c                   // movq	248(%rsp), %r9
+	LONG $0x08fd6162; WORD $0xf27e             // vmovq	%xmm30, %rdx
+	LONG $0x0b0c8d4b                           // leaq	(%r11,%r9), %rcx
+	LONG $0xcf0c8d4c                           // leaq	(%rdi,%rcx,8), %r9
+	LONG $0x230c8d4b                           // leaq	(%r11,%r12), %rcx
+	LONG $0xcf248d4c                           // leaq	(%rdi,%rcx,8), %r12
+	QUAD $0x000000e8248c8b48                   // movq	232(%rsp), %rcx
+	WORD $0x014c; BYTE $0xd9                   // addq	%r11, %rcx
+	LONG $0xcf0c8d48                           // leaq	(%rdi,%rcx,8), %rcx
+	LONG $0x6ef9e1c4; BYTE $0xe1               // vmovq	%rcx, %xmm4
+	QUAD $0x000000d0248c8b48                   // movq	208(%rsp), %rcx
+	LONG $0x03e9c148                           // shrq	$3, %rcx
+	LONG $0x06e1c148                           // salq	$6, %rcx
+	QUAD $0x000000a8248c8948                   // movq	%rcx, 168(%rsp)
+	WORD $0xc931                               // xorl	%ecx, %ecx
+	QUAD $0x000000a824848b48                   // movq	168(%rsp), %rax
+	QUAD $0x000000a824bc8948                   // movq	%rdi, 168(%rsp)
+	WORD $0x8948; BYTE $0xf7                   // movq	%rsi, %rdi
+	LONG $0x7ef9e1c4; BYTE $0xe6               // vmovq	%xmm4, %rsi
+
+BB0_25:
+	LONG $0x48fdc162; WORD $0x2410; BYTE $0x08 // vmovupd	(%r8,%rcx), %zmm20
+	LONG $0x40dd6162; WORD $0x1c59; BYTE $0x0a // vmulpd	(%rdx,%rcx), %zmm20, %zmm27
+	LONG $0x20a50362; WORD $0xe303; BYTE $0x03 // valignq	$3, %ymm27, %ymm27, %ymm28
+	LONG $0x08e79162; WORD $0xdb58             // vaddsd	%xmm27, %xmm3, %xmm3
+	LONG $0x00a50162; WORD $0xeb15             // vunpckhpd	%xmm27, %xmm27, %xmm29
+	LONG $0x08e79162; WORD $0xdd58             // vaddsd	%xmm29, %xmm3, %xmm3
+	LONG $0x28fd0362; WORD $0xdd19; BYTE $0x01 // vextractf64x2	$1, %ymm27, %xmm29
+	LONG $0x48fd0362; WORD $0xdb1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm27, %ymm27
+	LONG $0x08e79162; WORD $0xdd58             // vaddsd	%xmm29, %xmm3, %xmm3
+	LONG $0x08e79162; WORD $0xdc58             // vaddsd	%xmm28, %xmm3, %xmm3
+	LONG $0x00a50162; WORD $0xe315             // vunpckhpd	%xmm27, %xmm27, %xmm28
+	LONG $0x08e79162; WORD $0xdb58             // vaddsd	%xmm27, %xmm3, %xmm3
+	LONG $0x08e79162; WORD $0xdc58             // vaddsd	%xmm28, %xmm3, %xmm3
+	LONG $0x28fd0362; WORD $0xdc19; BYTE $0x01 // vextractf64x2	$1, %ymm27, %xmm28
+	LONG $0x20a50362; WORD $0xdb03; BYTE $0x03 // valignq	$3, %ymm27, %ymm27, %ymm27
+	LONG $0x08e79162; WORD $0xdc58             // vaddsd	%xmm28, %xmm3, %xmm3
+	LONG $0x08e79162; WORD $0xdb58             // vaddsd	%xmm27, %xmm3, %xmm3
+	LONG $0x40dd4162; WORD $0x1c59; BYTE $0x09 // vmulpd	(%r9,%rcx), %zmm20, %zmm27
+	LONG $0x20a50362; WORD $0xe303; BYTE $0x03 // valignq	$3, %ymm27, %ymm27, %ymm28
+	LONG $0x08ef9162; WORD $0xd358             // vaddsd	%xmm27, %xmm2, %xmm2
+	LONG $0x00a50162; WORD $0xeb15             // vunpckhpd	%xmm27, %xmm27, %xmm29
+	LONG $0x08ef9162; WORD $0xd558             // vaddsd	%xmm29, %xmm2, %xmm2
+	LONG $0x28fd0362; WORD $0xdd19; BYTE $0x01 // vextractf64x2	$1, %ymm27, %xmm29
+	LONG $0x48fd0362; WORD $0xdb1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm27, %ymm27
+	LONG $0x08ef9162; WORD $0xd558             // vaddsd	%xmm29, %xmm2, %xmm2
+	LONG $0x08ef9162; WORD $0xd458             // vaddsd	%xmm28, %xmm2, %xmm2
+	LONG $0x00a50162; WORD $0xe315             // vunpckhpd	%xmm27, %xmm27, %xmm28
+	LONG $0x08ef9162; WORD $0xd358             // vaddsd	%xmm27, %xmm2, %xmm2
+	LONG $0x08ef9162; WORD $0xd458             // vaddsd	%xmm28, %xmm2, %xmm2
+	LONG $0x28fd0362; WORD $0xdc19; BYTE $0x01 // vextractf64x2	$1, %ymm27, %xmm28
+	LONG $0x20a50362; WORD $0xdb03; BYTE $0x03 // valignq	$3, %ymm27, %ymm27, %ymm27
+	LONG $0x08ef9162; WORD $0xd458             // vaddsd	%xmm28, %xmm2, %xmm2
+	LONG $0x08ef9162; WORD $0xd358             // vaddsd	%xmm27, %xmm2, %xmm2
+	LONG $0x40dd4162; WORD $0x1c59; BYTE $0x0c // vmulpd	(%r12,%rcx), %zmm20, %zmm27
+	LONG $0x40dde162; WORD $0x2459; BYTE $0x0e // vmulpd	(%rsi,%rcx), %zmm20, %zmm20
+	LONG $0x40c18348                           // addq	$64, %rcx
+	LONG $0x20a50362; WORD $0xe303; BYTE $0x03 // valignq	$3, %ymm27, %ymm27, %ymm28
+	LONG $0x08f79162; WORD $0xcb58             // vaddsd	%xmm27, %xmm1, %xmm1
+	LONG $0x00a50162; WORD $0xeb15             // vunpckhpd	%xmm27, %xmm27, %xmm29
+	LONG $0x08ffb162; WORD $0xc458             // vaddsd	%xmm20, %xmm0, %xmm0
+	LONG $0x08f79162; WORD $0xcd58             // vaddsd	%xmm29, %xmm1, %xmm1
+	LONG $0x28fd0362; WORD $0xdd19; BYTE $0x01 // vextractf64x2	$1, %ymm27, %xmm29
+	LONG $0x48fd0362; WORD $0xdb1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm27, %ymm27
+	LONG $0x08f79162; WORD $0xcd58             // vaddsd	%xmm29, %xmm1, %xmm1
+	LONG $0x08f79162; WORD $0xcc58             // vaddsd	%xmm28, %xmm1, %xmm1
+	LONG $0x00a50162; WORD $0xe315             // vunpckhpd	%xmm27, %xmm27, %xmm28
+	LONG $0x08f79162; WORD $0xcb58             // vaddsd	%xmm27, %xmm1, %xmm1
+	LONG $0x08f79162; WORD $0xcc58             // vaddsd	%xmm28, %xmm1, %xmm1
+	LONG $0x28fd0362; WORD $0xdc19; BYTE $0x01 // vextractf64x2	$1, %ymm27, %xmm28
+	LONG $0x20a50362; WORD $0xdb03; BYTE $0x03 // valignq	$3, %ymm27, %ymm27, %ymm27
+	LONG $0x08f79162; WORD $0xcc58             // vaddsd	%xmm28, %xmm1, %xmm1
+	LONG $0x00dd2162; WORD $0xe415             // vunpckhpd	%xmm20, %xmm20, %xmm28
+	LONG $0x08ff9162; WORD $0xc458             // vaddsd	%xmm28, %xmm0, %xmm0
+	LONG $0x28fd8362; WORD $0xe419; BYTE $0x01 // vextractf64x2	$1, %ymm20, %xmm28
+	LONG $0x08f79162; WORD $0xcb58             // vaddsd	%xmm27, %xmm1, %xmm1
+	LONG $0x20dd2362; WORD $0xdc03; BYTE $0x03 // valignq	$3, %ymm20, %ymm20, %ymm27
+	LONG $0x48fda362; WORD $0xe41b; BYTE $0x01 // vextractf64x4	$0x1, %zmm20, %ymm20
+	LONG $0x08ff9162; WORD $0xc458             // vaddsd	%xmm28, %xmm0, %xmm0
+	LONG $0x08ff9162; WORD $0xc358             // vaddsd	%xmm27, %xmm0, %xmm0
+	LONG $0x00dd2162; WORD $0xdc15             // vunpckhpd	%xmm20, %xmm20, %xmm27
+	LONG $0x08ffb162; WORD $0xc458             // vaddsd	%xmm20, %xmm0, %xmm0
+	LONG $0x08ff9162; WORD $0xc358             // vaddsd	%xmm27, %xmm0, %xmm0
+	LONG $0x28fd8362; WORD $0xe319; BYTE $0x01 // vextractf64x2	$1, %ymm20, %xmm27
+	LONG $0x20dda362; WORD $0xe403; BYTE $0x03 // valignq	$3, %ymm20, %ymm20, %ymm20
+	LONG $0x08ff9162; WORD $0xc358             // vaddsd	%xmm27, %xmm0, %xmm0
+	LONG $0x08ffb162; WORD $0xc458             // vaddsd	%xmm20, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JNE  BB0_25
+	QUAD $0x000000d024848b4c                   // movq	208(%rsp), %r8
+	WORD $0x8948; BYTE $0xfe                   // movq	%rdi, %rsi
+	WORD $0x894c; BYTE $0xf0                   // movq	%r14, %rax
+	QUAD $0x0000009824948b48                   // movq	152(%rsp), %rdx
+	QUAD $0x0000009024b48b4c                   // movq	144(%rsp), %r14
+	QUAD $0x000000a824bc8b48                   // movq	168(%rsp), %rdi
+	WORD $0x894c; BYTE $0xc1                   // movq	%r8, %rcx
+	LONG $0xf8e18348                           // andq	$-8, %rcx
+	WORD $0x0149; BYTE $0xcb                   // addq	%rcx, %r11
+	LONG $0x07e08341                           // andl	$7, %r8d
+	JE   BB0_23
+
+BB0_24:
+	QUAD $0x000000d024a48b4c                   // movq	208(%rsp), %r12
+	WORD $0x2949; BYTE $0xcc                   // subq	%rcx, %r12
+	LONG $0x244c8d4d; BYTE $0xff               // leaq	-1(%r12), %r9
+	LONG $0x02f98349                           // cmpq	$2, %r9
+	JBE  BB0_28
+	QUAD $0x000000c024848b4c                   // movq	192(%rsp), %r8
+	WORD $0x0149; BYTE $0xc8                   // addq	%rcx, %r8
+	WORD $0x894c; BYTE $0xc1                   // movq	%r8, %rcx
+	LONG $0x380c8d4f                           // leaq	(%r8,%r15), %r9
+	QUAD $0x000000d824848b4c                   // movq	216(%rsp), %r8
+	LONG $0x107d81c4; WORD $0xc824             // vmovupd	(%r8,%r9,8), %ymm4
+	QUAD $0x000000e024848b4c                   // movq	224(%rsp), %r8
+	LONG $0x010c8d4e                           // leaq	(%rcx,%r8), %r9
+	QUAD $0x000000f024848b4c                   // movq	240(%rsp), %r8
+	LONG $0x28dda162; WORD $0x0459; BYTE $0xcf // vmulpd	(%rdi,%r9,8), %ymm4, %ymm16
+	QUAD $0x000000f8248c8b4c                   // movq	248(%rsp), %r9
+	WORD $0x0149; BYTE $0xc9                   // addq	%rcx, %r9
+	LONG $0x28fde362; WORD $0xc519; BYTE $0x01 // vextractf64x2	$1, %ymm16, %xmm5
+	LONG $0x08e7b162; WORD $0xd858             // vaddsd	%xmm16, %xmm3, %xmm3
+	LONG $0x00fda162; WORD $0xc815             // vunpckhpd	%xmm16, %xmm16, %xmm17
+	LONG $0x20fda362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm16, %ymm16, %ymm16
+	LONG $0x08e7b162; WORD $0xd958             // vaddsd	%xmm17, %xmm3, %xmm3
+	LONG $0xdd58e3c5                           // vaddsd	%xmm5, %xmm3, %xmm3
+	LONG $0x08e7b162; WORD $0xd858             // vaddsd	%xmm16, %xmm3, %xmm3
+	LONG $0x28dda162; WORD $0x0459; BYTE $0xcf // vmulpd	(%rdi,%r9,8), %ymm4, %ymm16
+	LONG $0x010c8d4e                           // leaq	(%rcx,%r8), %r9
+	LONG $0x28fde362; WORD $0xc519; BYTE $0x01 // vextractf64x2	$1, %ymm16, %xmm5
+	LONG $0x08efb162; WORD $0xd058             // vaddsd	%xmm16, %xmm2, %xmm2
+	LONG $0x00fda162; WORD $0xc815             // vunpckhpd	%xmm16, %xmm16, %xmm17
+	LONG $0x20fda362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm16, %ymm16, %ymm16
+	LONG $0x08efb162; WORD $0xd158             // vaddsd	%xmm17, %xmm2, %xmm2
+	LONG $0xd558ebc5                           // vaddsd	%xmm5, %xmm2, %xmm2
+	LONG $0x08efb162; WORD $0xd058             // vaddsd	%xmm16, %xmm2, %xmm2
+	LONG $0x28dda162; WORD $0x0459; BYTE $0xcf // vmulpd	(%rdi,%r9,8), %ymm4, %ymm16
+	QUAD $0x000000e8248c8b4c                   // movq	232(%rsp), %r9
+	WORD $0x014c; BYTE $0xc9                   // addq	%r9, %rcx
+	LONG $0x2459ddc5; BYTE $0xcf               // vmulpd	(%rdi,%rcx,8), %ymm4, %ymm4
+	WORD $0x894c; BYTE $0xe1                   // movq	%r12, %rcx
+	LONG $0xfce18348                           // andq	$-4, %rcx
+	LONG $0x28fde362; WORD $0xc519; BYTE $0x01 // vextractf64x2	$1, %ymm16, %xmm5
+	LONG $0x08f7b162; WORD $0xc858             // vaddsd	%xmm16, %xmm1, %xmm1
+	LONG $0x00fda162; WORD $0xc815             // vunpckhpd	%xmm16, %xmm16, %xmm17
+	WORD $0x0149; BYTE $0xcb                   // addq	%rcx, %r11
+	LONG $0x20fda362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm16, %ymm16, %ymm16
+	LONG $0x03e48341                           // andl	$3, %r12d
+	LONG $0x08f7b162; WORD $0xc958             // vaddsd	%xmm17, %xmm1, %xmm1
+	LONG $0xc458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm0
+	LONG $0xcd58f3c5                           // vaddsd	%xmm5, %xmm1, %xmm1
+	LONG $0x28fdf362; WORD $0xe519; BYTE $0x01 // vextractf64x2	$1, %ymm4, %xmm5
+	LONG $0x08f7b162; WORD $0xc858             // vaddsd	%xmm16, %xmm1, %xmm1
+	LONG $0x08dde162; WORD $0xc415             // vunpckhpd	%xmm4, %xmm4, %xmm16
+	LONG $0x28ddf362; WORD $0xe403; BYTE $0x03 // valignq	$3, %ymm4, %ymm4, %ymm4
+	LONG $0x08ffb162; WORD $0xc058             // vaddsd	%xmm16, %xmm0, %xmm0
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	LONG $0xc458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm0
+	JE   BB0_23
+
+BB0_28:
+	QUAD $0x000000d824848b4c       // movq	216(%rsp), %r8
+	QUAD $0x000000e024a48b4c       // movq	224(%rsp), %r12
+	LONG $0x1f0c8d4b               // leaq	(%r15,%r11), %rcx
+	QUAD $0x000000f0248c8b4c       // movq	240(%rsp), %r9
+	LONG $0x107bc1c4; WORD $0xc824 // vmovsd	(%r8,%rcx,8), %xmm4
+	LONG $0x1c0c8d4b               // leaq	(%r12,%r11), %rcx
+	LONG $0xb9d9e2c4; WORD $0xcf1c // vfmadd231sd	(%rdi,%rcx,8), %xmm4, %xmm3
+	QUAD $0x000000f8248c8b48       // movq	248(%rsp), %rcx
+	WORD $0x014c; BYTE $0xd9       // addq	%r11, %rcx
+	LONG $0xb9d9e2c4; WORD $0xcf14 // vfmadd231sd	(%rdi,%rcx,8), %xmm4, %xmm2
+	LONG $0x190c8d4b               // leaq	(%r9,%r11), %rcx
+	LONG $0xb9d9e2c4; WORD $0xcf0c // vfmadd231sd	(%rdi,%rcx,8), %xmm4, %xmm1
+	QUAD $0x000000e8248c8b48       // movq	232(%rsp), %rcx
+	WORD $0x014c; BYTE $0xd9       // addq	%r11, %rcx
+	LONG $0xb9d9e2c4; WORD $0xcf04 // vfmadd231sd	(%rdi,%rcx,8), %xmm4, %xmm0
+	LONG $0x014b8d49               // leaq	1(%r11), %rcx
+	WORD $0x3948; BYTE $0xca       // cmpq	%rcx, %rdx
+	JLE  BB0_23
+	LONG $0x0f0c8d4d               // leaq	(%r15,%rcx), %r9
+	LONG $0x02c38349               // addq	$2, %r11
+	LONG $0x107b81c4; WORD $0xc824 // vmovsd	(%r8,%r9,8), %xmm4
+	LONG $0x0c0c8d4d               // leaq	(%r12,%rcx), %r9
+	LONG $0xb9d9a2c4; WORD $0xcf1c // vfmadd231sd	(%rdi,%r9,8), %xmm4, %xmm3
+	QUAD $0x000000f8248c8b4c       // movq	248(%rsp), %r9
+	WORD $0x0149; BYTE $0xc9       // addq	%rcx, %r9
+	LONG $0xb9d9a2c4; WORD $0xcf14 // vfmadd231sd	(%rdi,%r9,8), %xmm4, %xmm2
+	QUAD $0x000000f0248c8b4c       // movq	240(%rsp), %r9
+	WORD $0x0149; BYTE $0xc9       // addq	%rcx, %r9
+	LONG $0xb9d9a2c4; WORD $0xcf0c // vfmadd231sd	(%rdi,%r9,8), %xmm4, %xmm1
+	QUAD $0x000000e8248c8b4c       // movq	232(%rsp), %r9
+	WORD $0x014c; BYTE $0xc9       // addq	%r9, %rcx
+	LONG $0xb9d9e2c4; WORD $0xcf04 // vfmadd231sd	(%rdi,%rcx,8), %xmm4, %xmm0
+	WORD $0x394c; BYTE $0xda       // cmpq	%r11, %rdx
+	JLE  BB0_23
+	LONG $0x1f0c8d4b               // leaq	(%r15,%r11), %rcx
+	QUAD $0x000000f8248c8b4c       // movq	248(%rsp), %r9
+	LONG $0x107bc1c4; WORD $0xc824 // vmovsd	(%r8,%rcx,8), %xmm4
+	LONG $0x1c0c8d4b               // leaq	(%r12,%r11), %rcx
+	LONG $0xb9d9e2c4; WORD $0xcf1c // vfmadd231sd	(%rdi,%rcx,8), %xmm4, %xmm3
+	LONG $0x190c8d4b               // leaq	(%r9,%r11), %rcx
+	QUAD $0x000000f0248c8b4c       // movq	240(%rsp), %r9
+	LONG $0xb9d9e2c4; WORD $0xcf14 // vfmadd231sd	(%rdi,%rcx,8), %xmm4, %xmm2
+	LONG $0x190c8d4b               // leaq	(%r9,%r11), %rcx
+	QUAD $0x000000e8248c8b4c       // movq	232(%rsp), %r9
+	LONG $0xb9d9e2c4; WORD $0xcf0c // vfmadd231sd	(%rdi,%rcx,8), %xmm4, %xmm1
+	WORD $0x014d; BYTE $0xcb       // addq	%r9, %r11
+	LONG $0xb9d9a2c4; WORD $0xdf04 // vfmadd231sd	(%rdi,%r11,8), %xmm4, %xmm0
+
+BB0_23:
+	QUAD $0x000000c82494394c       // cmpq	%r10, 200(%rsp)
+	JLE  BB0_30
+	LONG $0x08fde162; WORD $0xd17e // vmovq	%xmm18, %rcx
+	WORD $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JE   BB0_31
+	LONG $0x107ba1c4; WORD $0xd124 // vmovsd	(%rcx,%r10,8), %xmm4
+	LONG $0xdc58e3c5               // vaddsd	%xmm4, %xmm3, %xmm3
+	LONG $0xd458ebc5               // vaddsd	%xmm4, %xmm2, %xmm2
+	LONG $0xcc58f3c5               // vaddsd	%xmm4, %xmm1, %xmm1
+	LONG $0xc458fbc5               // vaddsd	%xmm4, %xmm0, %xmm0
+
+BB0_31:
+	LONG $0x7ef961c4; BYTE $0xc9   // vmovq	%xmm9, %rcx
+	LONG $0x117ba1c4; WORD $0xd11c // vmovsd	%xmm3, (%rcx,%r10,8)
+	LONG $0x08fde162; WORD $0xd97e // vmovq	%xmm19, %rcx
+	LONG $0x117ba1c4; WORD $0xd114 // vmovsd	%xmm2, (%rcx,%r10,8)
+	LONG $0x08fd6162; WORD $0xc97e // vmovq	%xmm25, %rcx
+	LONG $0x117ba1c4; WORD $0xd10c // vmovsd	%xmm1, (%rcx,%r10,8)
+	LONG $0x08fd6162; WORD $0xd17e // vmovq	%xmm26, %rcx
+	LONG $0x117ba1c4; WORD $0xd104 // vmovsd	%xmm0, (%rcx,%r10,8)
+
+BB0_32:
+	LONG $0x7ef961c4; BYTE $0xd1         // vmovq	%xmm10, %rcx
+	LONG $0x01c28349                     // addq	$1, %r10
+	WORD $0x0149; BYTE $0xd7             // addq	%rdx, %r15
+	QUAD $0x000000a024848348; BYTE $0x08 // addq	$8, 160(%rsp)
+	WORD $0x0148; BYTE $0xcb             // addq	%rcx, %rbx
+	QUAD $0x000000b82494394c             // cmpq	%r10, 184(%rsp)
+	JG   BB0_34
+
+BB0_20:
+	LONG $0x245c8b48; BYTE $0x60         // movq	96(%rsp), %rbx
+	LONG $0x7ef941c4; BYTE $0xc7         // vmovq	%xmm8, %r15
+	QUAD $0x000000e0249c0148             // addq	%rbx, 224(%rsp)
+	QUAD $0x000000f8249c0148             // addq	%rbx, 248(%rsp)
+	QUAD $0x000000f0249c0148             // addq	%rbx, 240(%rsp)
+	QUAD $0x000000e8249c0148             // addq	%rbx, 232(%rsp)
+	LONG $0x245c8b48; BYTE $0x20         // movq	32(%rsp), %rbx
+	QUAD $0x0000008824848348; BYTE $0x04 // addq	$4, 136(%rsp)
+	QUAD $0x00000088248c8b48             // movq	136(%rsp), %rcx
+	LONG $0x247c014c; BYTE $0x40         // addq	%r15, 64(%rsp)
+	WORD $0x0149; BYTE $0xdd             // addq	%rbx, %r13
+	WORD $0x0148; BYTE $0xde             // addq	%rbx, %rsi
+	WORD $0x0148; BYTE $0xd8             // addq	%rbx, %rax
+	LONG $0x247c014c; BYTE $0x58         // addq	%r15, 88(%rsp)
+	WORD $0x0149; BYTE $0xde             // addq	%rbx, %r14
+	LONG $0x247c014c; BYTE $0x50         // addq	%r15, 80(%rsp)
+	LONG $0x247c8b4c; BYTE $0x18         // movq	24(%rsp), %r15
+	LONG $0x247c014c; BYTE $0x68         // addq	%r15, 104(%rsp)
+	LONG $0x247c8b4c; BYTE $0x10         // movq	16(%rsp), %r15
+	LONG $0x247c014c; BYTE $0x38         // addq	%r15, 56(%rsp)
+	LONG $0x244c3948; BYTE $0x48         // cmpq	%rcx, 72(%rsp)
+	JG   BB0_4
+	LONG $0x24448b48; BYTE $0x48         // movq	72(%rsp), %rax
+	LONG $0x105d8b48                     // movq	16(%rbp), %rbx
+	LONG $0x08fd3162; WORD $0xca6f       // vmovdqa64	%xmm18, %xmm9
+	LONG $0x04e88348                     // subq	$4, %rax
+	LONG $0x02e8c148                     // shrq	$2, %rax
+	QUAD $0x0000000485048d48             // leaq	4(,%rax,4), %rax
+
+BB0_2:
+	LONG $0x24443948; BYTE $0x48   // cmpq	%rax, 72(%rsp)
+	JLE  BB0_143
+	QUAD $0x000000b824ac8b4c       // movq	184(%rsp), %r13
+	WORD $0x854d; BYTE $0xed       // testq	%r13, %r13
+	JLE  BB0_143
+	LONG $0xf8728d48               // leaq	-8(%rdx), %rsi
+	QUAD $0x000000c824848b4c       // movq	200(%rsp), %r8
+	WORD $0x8949; BYTE $0xd7       // movq	%rdx, %r15
+	QUAD $0x00000080248c8b4c       // movq	128(%rsp), %r9
+	LONG $0x03eec148               // shrq	$3, %rsi
+	LONG $0xf8af0f4c               // imulq	%rax, %r15
+	QUAD $0x00000000d50c8d48       // leaq	0(,%rdx,8), %rcx
+	QUAD $0x000000e824848948       // movq	%rax, 232(%rsp)
+	LONG $0x011c8d4f               // leaq	(%r9,%r8), %r11
+	WORD $0x894d; BYTE $0xc6       // movq	%r8, %r14
+	LONG $0x6ef9e1c4; BYTE $0xc9   // vmovq	%rcx, %xmm1
+	WORD $0x894d; BYTE $0xca       // movq	%r9, %r10
+	QUAD $0x00000008f5348d48       // leaq	8(,%rsi,8), %rsi
+	QUAD $0x000000b0249c894c       // movq	%r11, 176(%rsp)
+	LONG $0xe16f79c5               // vmovdqa	%xmm1, %xmm12
+	QUAD $0x000000f024b48948       // movq	%rsi, 240(%rsp)
+	WORD $0x894c; BYTE $0xc6       // movq	%r8, %rsi
+	LONG $0xd0af0f4c               // imulq	%rax, %r10
+	LONG $0xff0c8d4a               // leaq	(%rdi,%r15,8), %rcx
+	WORD $0xf748; BYTE $0xde       // negq	%rsi
+	LONG $0xf0af0f4c               // imulq	%rax, %r14
+	LONG $0x7ef941c4; BYTE $0xf8   // vmovq	%xmm15, %r8
+	LONG $0x03e6c148               // salq	$3, %rsi
+	WORD $0x0148; BYTE $0xf3       // addq	%rsi, %rbx
+	WORD $0x0149; BYTE $0xf0       // addq	%rsi, %r8
+	LONG $0x18750348               // addq	24(%rbp), %rsi
+	QUAD $0x000000c02494894c       // movq	%r10, 192(%rsp)
+	QUAD $0x000000a8249c8948       // movq	%rbx, 168(%rsp)
+	WORD $0x894c; BYTE $0xdb       // movq	%r11, %rbx
+	WORD $0xf749; BYTE $0xdb       // negq	%r11
+	LONG $0x6ef9c1c4; BYTE $0xe0   // vmovq	%r8, %xmm4
+	WORD $0x894d; BYTE $0xd8       // movq	%r11, %r8
+	LONG $0x7ef9c1c4; BYTE $0xfb   // vmovq	%xmm7, %r11
+	QUAD $0x000000d024b4894c       // movq	%r14, 208(%rsp)
+	LONG $0xc31c8d4f               // leaq	(%r11,%r8,8), %r11
+	WORD $0x894d; BYTE $0xc8       // movq	%r9, %r8
+	WORD $0xf749; BYTE $0xd8       // negq	%r8
+	LONG $0x6ef9c1c4; BYTE $0xdb   // vmovq	%r11, %xmm3
+	WORD $0x3949; BYTE $0xdd       // cmpq	%rbx, %r13
+	WORD $0x8949; BYTE $0xdb       // movq	%rbx, %r11
+	LONG $0xdd4e0f4d               // cmovle	%r13, %r11
+	LONG $0xc6348d4a               // leaq	(%rsi,%r8,8), %rsi
+	QUAD $0x000000d8249c8b48       // movq	216(%rsp), %rbx
+	LONG $0x08fd6162; WORD $0xf66e // vmovq	%rsi, %xmm30
+	LONG $0x6ef9c1c4; BYTE $0xd3   // vmovq	%r11, %xmm2
+
+BB0_55:
+	QUAD $0x000000b024bc8348; BYTE $0x00 // cmpq	$0, 176(%rsp)
+	JG   BB0_38
+	QUAD $0x000000c024848b48             // movq	192(%rsp), %rax
+	WORD $0x3145; BYTE $0xc9             // xorl	%r9d, %r9d
+	QUAD $0x00000000c5048d48             // leaq	0(,%rax,8), %rax
+	QUAD $0x000000e024848948             // movq	%rax, 224(%rsp)
+	QUAD $0x000000d024848b48             // movq	208(%rsp), %rax
+	QUAD $0x00000000c5048d48             // leaq	0(,%rax,8), %rax
+	QUAD $0x000000d824848948             // movq	%rax, 216(%rsp)
+
+BB0_39:
+	QUAD $0x000000e024848b48       // movq	224(%rsp), %rax
+	LONG $0x08fd6162; WORD $0xf67e // vmovq	%xmm30, %rsi
+	LONG $0x24748b4c; BYTE $0x28   // movq	40(%rsp), %r14
+	WORD $0x8949; BYTE $0xd5       // movq	%rdx, %r13
+	LONG $0xe9af0f4d               // imulq	%r9, %r13
+	LONG $0x6f7941c4; BYTE $0xd4   // vmovdqa	%xmm12, %xmm10
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	QUAD $0x000000e024848948       // movq	%rax, 224(%rsp)
+	QUAD $0x000000d824848b48       // movq	216(%rsp), %rax
+	LONG $0xeb148d4e               // leaq	(%rbx,%r13,8), %r10
+	WORD $0x014c; BYTE $0xf0       // addq	%r14, %rax
+	QUAD $0x000000d824848948       // movq	%rax, 216(%rsp)
+
+BB0_69:
+	LONG $0x07fa8348             // cmpq	$7, %rdx
+	JLE  BB0_79
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_57:
+	QUAD $0xffc14c1048fdf162 // vmovupd	-64(%rcx,%rax,8), %zmm1
+	QUAD $0xffc244b848f5d262 // vfmadd231pd	-64(%r10,%rax,8), %zmm1, %zmm0
+	LONG $0x08c08348         // addq	$8, %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JGE  BB0_57
+	QUAD $0x000000f024b48b48 // movq	240(%rsp), %rsi
+
+BB0_56:
+	LONG $0x48fdf362; WORD $0xc51b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm5
+	LONG $0xc558fdc5                           // vaddpd	%ymm5, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc519; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm5
+	LONG $0xed58f9c5                           // vaddpd	%xmm5, %xmm0, %xmm5
+	LONG $0xc515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm0
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_58
+	WORD $0x8949; BYTE $0xd3                   // movq	%rdx, %r11
+	QUAD $0x000000f824b48948                   // movq	%rsi, 248(%rsp)
+	WORD $0x2949; BYTE $0xf3                   // subq	%rsi, %r11
+	LONG $0xff438d49                           // leaq	-1(%r11), %rax
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_80
+	LONG $0x3e048d4a                           // leaq	(%rsi,%r15), %rax
+	LONG $0xc7248d4c                           // leaq	(%rdi,%rax,8), %r12
+	LONG $0x35448d49; BYTE $0x00               // leaq	0(%r13,%rsi), %rax
+	LONG $0xc3348d4c                           // leaq	(%rbx,%rax,8), %r14
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	WORD $0x8949; BYTE $0xc0                   // movq	%rax, %r8
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_60:
+	LONG $0x48fdd162; WORD $0x0c10; BYTE $0x04 // vmovupd	(%r12,%rax), %zmm1
+	LONG $0x48f5d162; WORD $0x2c59; BYTE $0x06 // vmulpd	(%r14,%rax), %zmm1, %zmm5
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x28d5f362; WORD $0xf503; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm6
+	LONG $0xc058d3c5                           // vaddsd	%xmm0, %xmm5, %xmm0
+	LONG $0xc51551c5                           // vunpckhpd	%xmm5, %xmm5, %xmm8
+	LONG $0x587bc1c4; BYTE $0xc0               // vaddsd	%xmm8, %xmm0, %xmm0
+	LONG $0x28fdd362; WORD $0xe819; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm8
+	LONG $0x48fdf362; WORD $0xed1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm5
+	LONG $0x587bc1c4; BYTE $0xc0               // vaddsd	%xmm8, %xmm0, %xmm0
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0xf515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm6
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	LONG $0xf058cbc5                           // vaddsd	%xmm0, %xmm6, %xmm6
+	LONG $0x28fdf362; WORD $0xe819; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm0
+	LONG $0x28d5f362; WORD $0xed03; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm5
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc0                   // cmpq	%rax, %r8
+	JNE  BB0_60
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc6                   // addq	%rax, %rsi
+	LONG $0x07c3f641                           // testb	$7, %r11b
+	JE   BB0_58
+
+BB0_59:
+	WORD $0x2949; BYTE $0xc3                   // subq	%rax, %r11
+	LONG $0xff438d4d                           // leaq	-1(%r11), %r8
+	LONG $0x02f88349                           // cmpq	$2, %r8
+	JBE  BB0_63
+	QUAD $0x000000f824b48b4c                   // movq	248(%rsp), %r14
+	LONG $0x30048d4e                           // leaq	(%rax,%r14), %r8
+	WORD $0x014c; BYTE $0xe8                   // addq	%r13, %rax
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	WORD $0x014d; BYTE $0xf8                   // addq	%r15, %r8
+	LONG $0x2c10fdc5; BYTE $0xc3               // vmovupd	(%rbx,%rax,8), %ymm5
+	LONG $0x5955a1c4; WORD $0xc72c             // vmulpd	(%rdi,%r8,8), %ymm5, %ymm5
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	LONG $0xfce08348                           // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc6                   // addq	%rax, %rsi
+	LONG $0x03e38341                           // andl	$3, %r11d
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	LONG $0xf515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm6
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0x28fdf362; WORD $0xee19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm6
+	LONG $0x28d5f362; WORD $0xed03; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm5
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	JE   BB0_58
+
+BB0_63:
+	LONG $0x35448d49; BYTE $0x00   // leaq	0(%r13,%rsi), %rax
+	LONG $0x371c8d4d               // leaq	(%r15,%rsi), %r11
+	LONG $0x107ba1c4; WORD $0xdf0c // vmovsd	(%rdi,%r11,8), %xmm1
+	LONG $0xb9f1e2c4; WORD $0xc304 // vfmadd231sd	(%rbx,%rax,8), %xmm1, %xmm0
+	LONG $0x01468d48               // leaq	1(%rsi), %rax
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JGE  BB0_58
+	LONG $0x381c8d4e               // leaq	(%rax,%r15), %r11
+	LONG $0x02c68348               // addq	$2, %rsi
+	WORD $0x014c; BYTE $0xe8       // addq	%r13, %rax
+	LONG $0x107ba1c4; WORD $0xdf0c // vmovsd	(%rdi,%r11,8), %xmm1
+	LONG $0xb9f1e2c4; WORD $0xc304 // vfmadd231sd	(%rbx,%rax,8), %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xd6       // cmpq	%rdx, %rsi
+	JGE  BB0_58
+	LONG $0x3e048d4a               // leaq	(%rsi,%r15), %rax
+	WORD $0x014c; BYTE $0xee       // addq	%r13, %rsi
+	LONG $0x0c10fbc5; BYTE $0xc7   // vmovsd	(%rdi,%rax,8), %xmm1
+	LONG $0xb9f1e2c4; WORD $0xf304 // vfmadd231sd	(%rbx,%rsi,8), %xmm1, %xmm0
+
+BB0_58:
+	QUAD $0x000000c8248c394c       // cmpq	%r9, 200(%rsp)
+	JLE  BB0_65
+	LONG $0x7ef961c4; BYTE $0xc8   // vmovq	%xmm9, %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_66
+	LONG $0x587ba1c4; WORD $0xc804 // vaddsd	(%rax,%r9,8), %xmm0, %xmm0
+
+BB0_66:
+	QUAD $0x000000d824848b48       // movq	216(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xc804 // vmovsd	%xmm0, (%rax,%r9,8)
+
+BB0_67:
+	LONG $0x7ef961c4; BYTE $0xd0 // vmovq	%xmm10, %rax
+	LONG $0x01c18349             // addq	$1, %r9
+	WORD $0x0149; BYTE $0xd5     // addq	%rdx, %r13
+	WORD $0x0149; BYTE $0xc2     // addq	%rax, %r10
+	QUAD $0x000000b8248c394c     // cmpq	%r9, 184(%rsp)
+	JG   BB0_69
+	LONG $0x6f7941c4; BYTE $0xe2 // vmovdqa	%xmm10, %xmm12
+
+BB0_70:
+	LONG $0x7ef961c4; BYTE $0xe6         // vmovq	%xmm12, %rsi
+	QUAD $0x0000008024948b4c             // movq	128(%rsp), %r10
+	WORD $0x0149; BYTE $0xd7             // addq	%rdx, %r15
+	QUAD $0x000000e824848348; BYTE $0x01 // addq	$1, 232(%rsp)
+	QUAD $0x000000c02494014c             // addq	%r10, 192(%rsp)
+	QUAD $0x000000e824848b48             // movq	232(%rsp), %rax
+	WORD $0x0148; BYTE $0xf1             // addq	%rsi, %rcx
+	QUAD $0x000000c824948b4c             // movq	200(%rsp), %r10
+	QUAD $0x000000d02494014c             // addq	%r10, 208(%rsp)
+	LONG $0x24443948; BYTE $0x48         // cmpq	%rax, 72(%rsp)
+	JNE  BB0_55
+
+BB0_143:
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0xd0a58d48; WORD $0xfffe; BYTE $0xff // leaq	-304(%rbp), %rsp
+	RET
+
+BB0_30:
+	LONG $0x7ef9e1c4; BYTE $0xf9   // vmovq	%xmm7, %rcx
+	WORD $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JE   BB0_33
+	LONG $0x08fde162; WORD $0xe97e // vmovq	%xmm21, %rcx
+	LONG $0x107ba1c4; WORD $0xd124 // vmovsd	(%rcx,%r10,8), %xmm4
+	LONG $0xdc58e3c5               // vaddsd	%xmm4, %xmm3, %xmm3
+	LONG $0xd458ebc5               // vaddsd	%xmm4, %xmm2, %xmm2
+	LONG $0xcc58f3c5               // vaddsd	%xmm4, %xmm1, %xmm1
+	LONG $0xc458fbc5               // vaddsd	%xmm4, %xmm0, %xmm0
+
+BB0_33:
+	QUAD $0x000000a0248c8b48       // movq	160(%rsp), %rcx
+	QUAD $0x00000080249c8b4c       // movq	128(%rsp), %r11
+	LONG $0x1911fbc5               // vmovsd	%xmm3, (%rcx)
+	LONG $0x117ba1c4; WORD $0xd914 // vmovsd	%xmm2, (%rcx,%r11,8)
+	LONG $0x245c8b4c; BYTE $0x78   // movq	120(%rsp), %r11
+	LONG $0x117ba1c4; WORD $0xd90c // vmovsd	%xmm1, (%rcx,%r11,8)
+	LONG $0x245c8b4c; BYTE $0x70   // movq	112(%rsp), %r11
+	LONG $0x117ba1c4; WORD $0xd904 // vmovsd	%xmm0, (%rcx,%r11,8)
+	JMP  BB0_32
+
+BB0_15:
+	LONG $0x7ef961c4; BYTE $0xf9   // vmovq	%xmm15, %rcx
+	WORD $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JE   BB0_18
+	LONG $0x08fde162; WORD $0xf17e // vmovq	%xmm22, %rcx
+	LONG $0x107ba1c4; WORD $0xd104 // vmovsd	(%rcx,%r10,8), %xmm0
+	LONG $0xe058dbc5               // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xd058ebc5               // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0xc858f3c5               // vaddsd	%xmm0, %xmm1, %xmm1
+
+BB0_18:
+	LONG $0x08fde162; WORD $0xc97e // vmovq	%xmm17, %rcx
+	LONG $0x117ba1c4; WORD $0xd124 // vmovsd	%xmm4, (%rcx,%r10,8)
+	LONG $0x08fde162; WORD $0xe17e // vmovq	%xmm20, %rcx
+	LONG $0x117ba1c4; WORD $0xd11c // vmovsd	%xmm3, (%rcx,%r10,8)
+	LONG $0x08fd6162; WORD $0xf17e // vmovq	%xmm30, %rcx
+	LONG $0x117ba1c4; WORD $0xd114 // vmovsd	%xmm2, (%rcx,%r10,8)
+	LONG $0x244c8b48; BYTE $0x78   // movq	120(%rsp), %rcx
+	LONG $0x117ba1c4; WORD $0xd10c // vmovsd	%xmm1, (%rcx,%r10,8)
+	JMP  BB0_17
+
+BB0_65:
+	LONG $0x7ef9e1c4; BYTE $0xf8   // vmovq	%xmm7, %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_68
+	LONG $0x7ef9e1c4; BYTE $0xd8   // vmovq	%xmm3, %rax
+	LONG $0x587ba1c4; WORD $0xc804 // vaddsd	(%rax,%r9,8), %xmm0, %xmm0
+
+BB0_68:
+	QUAD $0x000000e024848b48       // movq	224(%rsp), %rax
+	LONG $0x117ba1c4; WORD $0xc804 // vmovsd	%xmm0, (%rax,%r9,8)
+	JMP  BB0_67
+
+BB0_75:
+	LONG $0xe457d9c5               // vxorpd	%xmm4, %xmm4, %xmm4
+	WORD $0x3145; BYTE $0xdb       // xorl	%r11d, %r11d
+	LONG $0x48fdf162; WORD $0xcc28 // vmovapd	%zmm4, %zmm1
+	LONG $0x48fdf162; WORD $0xd428 // vmovapd	%zmm4, %zmm2
+	LONG $0x48fdf162; WORD $0xdc28 // vmovapd	%zmm4, %zmm3
+	JMP  BB0_21
+
+BB0_72:
+	LONG $0x245c8b48; BYTE $0x68   // movq	104(%rsp), %rbx
+	LONG $0x244c8b48; BYTE $0x08   // movq	8(%rsp), %rcx
+	WORD $0x3145; BYTE $0xd2       // xorl	%r10d, %r10d
+	WORD $0x0148; BYTE $0xd9       // addq	%rbx, %rcx
+	LONG $0x08fde162; WORD $0xd96e // vmovq	%rcx, %xmm19
+	LONG $0x240c8b48               // movq	(%rsp), %rcx
+	WORD $0x0148; BYTE $0xd9       // addq	%rbx, %rcx
+	LONG $0x08fd6162; WORD $0xc96e // vmovq	%rcx, %xmm25
+	LONG $0x08fde162; WORD $0xf97e // vmovq	%xmm23, %rcx
+	WORD $0x0148; BYTE $0xcb       // addq	%rcx, %rbx
+	LONG $0x08fd6162; WORD $0xd36e // vmovq	%rbx, %xmm26
+	JMP  BB0_5
+
+BB0_73:
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0x3145; BYTE $0xdb       // xorl	%r11d, %r11d
+	LONG $0x48fdf162; WORD $0xd128 // vmovapd	%zmm1, %zmm2
+	LONG $0x48fdf162; WORD $0xd928 // vmovapd	%zmm1, %zmm3
+	LONG $0x48fdf162; WORD $0xe128 // vmovapd	%zmm1, %zmm4
+	JMP  BB0_6
+
+BB0_74:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_9
+
+BB0_76:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_24
+
+BB0_79:
+	WORD $0xf631     // xorl	%esi, %esi
+	LONG $0xc057f9c5 // vxorpd	%xmm0, %xmm0, %xmm0
+	JMP  BB0_56
+
+BB0_38:
+	QUAD $0x000000c024848b48       // movq	192(%rsp), %rax
+	WORD $0x8949; BYTE $0xda       // movq	%rbx, %r10
+	WORD $0x3145; BYTE $0xf6       // xorl	%r14d, %r14d
+	WORD $0x3145; BYTE $0xc9       // xorl	%r9d, %r9d
+	QUAD $0x000000a824b48b48       // movq	168(%rsp), %rsi
+	LONG $0x03e0c148               // salq	$3, %rax
+	QUAD $0x000000e024848948       // movq	%rax, 224(%rsp)
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0x24748b48; BYTE $0x28   // movq	40(%rsp), %rsi
+	LONG $0x08fde162; WORD $0xc06e // vmovq	%rax, %xmm16
+	QUAD $0x000000d024848b48       // movq	208(%rsp), %rax
+	LONG $0x03e0c148               // salq	$3, %rax
+	QUAD $0x000000d824848948       // movq	%rax, 216(%rsp)
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0x6ef961c4; BYTE $0xf0   // vmovq	%rax, %xmm14
+
+BB0_54:
+	LONG $0x07fa8348             // cmpq	$7, %rdx
+	JLE  BB0_77
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x000008be; BYTE $0x00 // movl	$8, %esi
+
+BB0_42:
+	QUAD $0xfff14c1048fdf162 // vmovupd	-64(%rcx,%rsi,8), %zmm1
+	QUAD $0xfff244b848f5d262 // vfmadd231pd	-64(%r10,%rsi,8), %zmm1, %zmm0
+	LONG $0x08c68348         // addq	$8, %rsi
+	WORD $0x3948; BYTE $0xd6 // cmpq	%rdx, %rsi
+	JLE  BB0_42
+	QUAD $0x000000f0249c8b4c // movq	240(%rsp), %r11
+
+BB0_41:
+	LONG $0x48fdf362; WORD $0xc51b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm5
+	LONG $0xc058d5c5                           // vaddpd	%ymm0, %ymm5, %ymm0
+	LONG $0x28fdf362; WORD $0xc519; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm5
+	LONG $0xe858d1c5                           // vaddpd	%xmm0, %xmm5, %xmm5
+	LONG $0xc510d3c5                           // vmovsd	%xmm5, %xmm5, %xmm0
+	LONG $0xed15d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xda                   // cmpq	%r11, %rdx
+	JLE  BB0_43
+	WORD $0x8949; BYTE $0xd5                   // movq	%rdx, %r13
+	QUAD $0x000000f8249c894c                   // movq	%r11, 248(%rsp)
+	WORD $0x294d; BYTE $0xdd                   // subq	%r11, %r13
+	LONG $0xff758d49                           // leaq	-1(%r13), %rsi
+	LONG $0x06fe8348                           // cmpq	$6, %rsi
+	JBE  BB0_78
+	LONG $0x3b348d4b                           // leaq	(%r11,%r15), %rsi
+	LONG $0xf7248d4c                           // leaq	(%rdi,%rsi,8), %r12
+	LONG $0x33348d4b                           // leaq	(%r11,%r14), %rsi
+	LONG $0xf3048d48                           // leaq	(%rbx,%rsi,8), %rax
+	WORD $0x894c; BYTE $0xee                   // movq	%r13, %rsi
+	LONG $0x03eec148                           // shrq	$3, %rsi
+	LONG $0x06e6c148                           // salq	$6, %rsi
+	WORD $0x8949; BYTE $0xf0                   // movq	%rsi, %r8
+	WORD $0xf631                               // xorl	%esi, %esi
+
+BB0_45:
+	LONG $0x48fdd162; WORD $0x0c10; BYTE $0x34 // vmovupd	(%r12,%rsi), %zmm1
+	LONG $0x48f5f162; WORD $0x2c59; BYTE $0x30 // vmulpd	(%rax,%rsi), %zmm1, %zmm5
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0x28fdd362; WORD $0xea19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm10
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	LONG $0xc51551c5                           // vunpckhpd	%xmm5, %xmm5, %xmm8
+	LONG $0x28d5f362; WORD $0xf503; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm6
+	LONG $0x48fdf362; WORD $0xed1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm5
+	LONG $0x587bc1c4; BYTE $0xc0               // vaddsd	%xmm8, %xmm0, %xmm0
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	LONG $0x28fdd362; WORD $0xea19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm10
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0xf515d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm6
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	LONG $0x28d5f362; WORD $0xed03; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm5
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JNE  BB0_45
+	WORD $0x894c; BYTE $0xee                   // movq	%r13, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	WORD $0x0149; BYTE $0xf3                   // addq	%rsi, %r11
+	LONG $0x07c5f641                           // testb	$7, %r13b
+	JE   BB0_43
+
+BB0_44:
+	WORD $0x2949; BYTE $0xf5                   // subq	%rsi, %r13
+	LONG $0xff458d4d                           // leaq	-1(%r13), %r8
+	LONG $0x02f88349                           // cmpq	$2, %r8
+	JBE  BB0_48
+	QUAD $0x000000f824a48b4c                   // movq	248(%rsp), %r12
+	WORD $0x0149; BYTE $0xf4                   // addq	%rsi, %r12
+	LONG $0x3c348d4b                           // leaq	(%r12,%r15), %rsi
+	WORD $0x014d; BYTE $0xf4                   // addq	%r14, %r12
+	LONG $0x107da1c4; WORD $0xe32c             // vmovupd	(%rbx,%r12,8), %ymm5
+	LONG $0x2c59d5c5; BYTE $0xf7               // vmulpd	(%rdi,%rsi,8), %ymm5, %ymm5
+	WORD $0x894c; BYTE $0xee                   // movq	%r13, %rsi
+	LONG $0xfce68348                           // andq	$-4, %rsi
+	WORD $0x0149; BYTE $0xf3                   // addq	%rsi, %r11
+	LONG $0x03e58341                           // andl	$3, %r13d
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	LONG $0xd51551c5                           // vunpckhpd	%xmm5, %xmm5, %xmm10
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	LONG $0x28fdd362; WORD $0xea19; BYTE $0x01 // vextractf64x2	$1, %ymm5, %xmm10
+	LONG $0x28d5f362; WORD $0xed03; BYTE $0x03 // valignq	$3, %ymm5, %ymm5, %ymm5
+	LONG $0x587bc1c4; BYTE $0xc2               // vaddsd	%xmm10, %xmm0, %xmm0
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	JE   BB0_43
+
+BB0_48:
+	LONG $0x1f348d4b               // leaq	(%r15,%r11), %rsi
+	LONG $0x1e248d4f               // leaq	(%r14,%r11), %r12
+	LONG $0x107ba1c4; WORD $0xe30c // vmovsd	(%rbx,%r12,8), %xmm1
+	LONG $0xb9f1e2c4; WORD $0xf704 // vfmadd231sd	(%rdi,%rsi,8), %xmm1, %xmm0
+	LONG $0x01738d49               // leaq	1(%r11), %rsi
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_43
+	LONG $0x36248d4d               // leaq	(%r14,%rsi), %r12
+	LONG $0x02c38349               // addq	$2, %r11
+	WORD $0x014c; BYTE $0xfe       // addq	%r15, %rsi
+	LONG $0x107ba1c4; WORD $0xe30c // vmovsd	(%rbx,%r12,8), %xmm1
+	LONG $0xb9f1e2c4; WORD $0xf704 // vfmadd231sd	(%rdi,%rsi,8), %xmm1, %xmm0
+	WORD $0x394c; BYTE $0xda       // cmpq	%r11, %rdx
+	JLE  BB0_43
+	LONG $0x1f348d4b               // leaq	(%r15,%r11), %rsi
+	WORD $0x014d; BYTE $0xf3       // addq	%r14, %r11
+	LONG $0x0c10fbc5; BYTE $0xf7   // vmovsd	(%rdi,%rsi,8), %xmm1
+	LONG $0xb9f1a2c4; WORD $0xdb04 // vfmadd231sd	(%rbx,%r11,8), %xmm1, %xmm0
+
+BB0_43:
+	QUAD $0x000000c8248c394c       // cmpq	%r9, 200(%rsp)
+	JLE  BB0_50
+	LONG $0x7ef961c4; BYTE $0xc8   // vmovq	%xmm9, %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_51
+	LONG $0x587ba1c4; WORD $0xc804 // vaddsd	(%rax,%r9,8), %xmm0, %xmm0
+
+BB0_51:
+	LONG $0x7ef961c4; BYTE $0xf0   // vmovq	%xmm14, %rax
+	LONG $0x117ba1c4; WORD $0xc804 // vmovsd	%xmm0, (%rax,%r9,8)
+
+BB0_52:
+	LONG $0x7ef961c4; BYTE $0xe0 // vmovq	%xmm12, %rax
+	LONG $0x01c18349             // addq	$1, %r9
+	WORD $0x0149; BYTE $0xd6     // addq	%rdx, %r14
+	WORD $0x0149; BYTE $0xc2     // addq	%rax, %r10
+	LONG $0x7ef9e1c4; BYTE $0xd0 // vmovq	%xmm2, %rax
+	WORD $0x3949; BYTE $0xc1     // cmpq	%rax, %r9
+	JL   BB0_54
+	QUAD $0x000000b8248c394c     // cmpq	%r9, 184(%rsp)
+	JG   BB0_39
+	JMP  BB0_70
+
+BB0_50:
+	LONG $0x7ef961c4; BYTE $0xf8   // vmovq	%xmm15, %rax
+	WORD $0x8548; BYTE $0xc0       // testq	%rax, %rax
+	JE   BB0_53
+	LONG $0x7ef9e1c4; BYTE $0xe0   // vmovq	%xmm4, %rax
+	LONG $0x587ba1c4; WORD $0xc804 // vaddsd	(%rax,%r9,8), %xmm0, %xmm0
+
+BB0_53:
+	LONG $0x08fde162; WORD $0xc07e // vmovq	%xmm16, %rax
+	LONG $0x117ba1c4; WORD $0xc804 // vmovsd	%xmm0, (%rax,%r9,8)
+	JMP  BB0_52
+
+BB0_77:
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	JMP  BB0_41
+
+BB0_78:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_44
+
+BB0_80:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_59
+
+BB0_71:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_2
@@ -0,0 +1,1525 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basesdpa_c_f32_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x7f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_10<>+0(SB)/4, $0x00000000
+DATA CPI0_10<>+4(SB)/4, $0x00000006
+DATA CPI0_10<>+8(SB)/4, $0x00000002
+DATA CPI0_10<>+12(SB)/4, $0x00000003
+DATA CPI0_10<>+16(SB)/4, $0x00000004
+DATA CPI0_10<>+20(SB)/4, $0x00000005
+DATA CPI0_10<>+24(SB)/4, $0x00000006
+DATA CPI0_10<>+28(SB)/4, $0x00000007
+GLOBL CPI0_10<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_11<>+0(SB)/4, $0x00000007
+DATA CPI0_11<>+4(SB)/4, $0x00000001
+DATA CPI0_11<>+8(SB)/4, $0x00000002
+DATA CPI0_11<>+12(SB)/4, $0x00000003
+DATA CPI0_11<>+16(SB)/4, $0x00000003
+DATA CPI0_11<>+20(SB)/4, $0x00000005
+DATA CPI0_11<>+24(SB)/4, $0x00000006
+DATA CPI0_11<>+28(SB)/4, $0x00000007
+GLOBL CPI0_11<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_12<>+0(SB)/4, $0x00000000
+DATA CPI0_12<>+4(SB)/4, $0x00000007
+DATA CPI0_12<>+8(SB)/4, $0x00000002
+DATA CPI0_12<>+12(SB)/4, $0x00000003
+DATA CPI0_12<>+16(SB)/4, $0x00000004
+DATA CPI0_12<>+20(SB)/4, $0x00000005
+DATA CPI0_12<>+24(SB)/4, $0x00000006
+DATA CPI0_12<>+28(SB)/4, $0x00000007
+GLOBL CPI0_12<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_13<>+0(SB)/4, $0x42b17218
+DATA CPI0_13<>+4(SB)/4, $0x42b17218
+DATA CPI0_13<>+8(SB)/4, $0x42b17218
+DATA CPI0_13<>+12(SB)/4, $0x42b17218
+DATA CPI0_13<>+16(SB)/4, $0x42b17218
+DATA CPI0_13<>+20(SB)/4, $0x42b17218
+DATA CPI0_13<>+24(SB)/4, $0x42b17218
+DATA CPI0_13<>+28(SB)/4, $0x42b17218
+GLOBL CPI0_13<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_15<>+0(SB)/4, $0xc2aeac50
+DATA CPI0_15<>+4(SB)/4, $0xc2aeac50
+DATA CPI0_15<>+8(SB)/4, $0xc2aeac50
+DATA CPI0_15<>+12(SB)/4, $0xc2aeac50
+DATA CPI0_15<>+16(SB)/4, $0xc2aeac50
+DATA CPI0_15<>+20(SB)/4, $0xc2aeac50
+DATA CPI0_15<>+24(SB)/4, $0xc2aeac50
+DATA CPI0_15<>+28(SB)/4, $0xc2aeac50
+GLOBL CPI0_15<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_17<>+0(SB)/4, $0x3fb8aa3b
+DATA CPI0_17<>+4(SB)/4, $0x3fb8aa3b
+DATA CPI0_17<>+8(SB)/4, $0x3fb8aa3b
+DATA CPI0_17<>+12(SB)/4, $0x3fb8aa3b
+DATA CPI0_17<>+16(SB)/4, $0x3fb8aa3b
+DATA CPI0_17<>+20(SB)/4, $0x3fb8aa3b
+DATA CPI0_17<>+24(SB)/4, $0x3fb8aa3b
+DATA CPI0_17<>+28(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_17<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_19<>+0(SB)/4, $0x3f318000
+DATA CPI0_19<>+4(SB)/4, $0x3f318000
+DATA CPI0_19<>+8(SB)/4, $0x3f318000
+DATA CPI0_19<>+12(SB)/4, $0x3f318000
+DATA CPI0_19<>+16(SB)/4, $0x3f318000
+DATA CPI0_19<>+20(SB)/4, $0x3f318000
+DATA CPI0_19<>+24(SB)/4, $0x3f318000
+DATA CPI0_19<>+28(SB)/4, $0x3f318000
+GLOBL CPI0_19<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_2<>+0(SB)/4, $0x00000000
+DATA CPI0_2<>+4(SB)/4, $0x00000000
+DATA CPI0_2<>+8(SB)/4, $0x00000002
+DATA CPI0_2<>+12(SB)/4, $0x00000003
+DATA CPI0_2<>+16(SB)/4, $0x00000000
+DATA CPI0_2<>+20(SB)/4, $0x00000001
+DATA CPI0_2<>+24(SB)/4, $0x00000002
+DATA CPI0_2<>+28(SB)/4, $0x00000003
+GLOBL CPI0_2<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_21<>+0(SB)/4, $0xb95e8083
+DATA CPI0_21<>+4(SB)/4, $0xb95e8083
+DATA CPI0_21<>+8(SB)/4, $0xb95e8083
+DATA CPI0_21<>+12(SB)/4, $0xb95e8083
+DATA CPI0_21<>+16(SB)/4, $0xb95e8083
+DATA CPI0_21<>+20(SB)/4, $0xb95e8083
+DATA CPI0_21<>+24(SB)/4, $0xb95e8083
+DATA CPI0_21<>+28(SB)/4, $0xb95e8083
+GLOBL CPI0_21<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_24<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_24<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_25<>+0(SB)/4, $0x3c088889
+DATA CPI0_25<>+4(SB)/4, $0x3c088889
+DATA CPI0_25<>+8(SB)/4, $0x3c088889
+DATA CPI0_25<>+12(SB)/4, $0x3c088889
+DATA CPI0_25<>+16(SB)/4, $0x3c088889
+DATA CPI0_25<>+20(SB)/4, $0x3c088889
+DATA CPI0_25<>+24(SB)/4, $0x3c088889
+DATA CPI0_25<>+28(SB)/4, $0x3c088889
+GLOBL CPI0_25<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_27<>+0(SB)/4, $0x3d2aaaab
+DATA CPI0_27<>+4(SB)/4, $0x3d2aaaab
+DATA CPI0_27<>+8(SB)/4, $0x3d2aaaab
+DATA CPI0_27<>+12(SB)/4, $0x3d2aaaab
+DATA CPI0_27<>+16(SB)/4, $0x3d2aaaab
+DATA CPI0_27<>+20(SB)/4, $0x3d2aaaab
+DATA CPI0_27<>+24(SB)/4, $0x3d2aaaab
+DATA CPI0_27<>+28(SB)/4, $0x3d2aaaab
+GLOBL CPI0_27<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_3<>+0(SB)/4, $0x00000000
+DATA CPI0_3<>+4(SB)/4, $0x00000002
+DATA CPI0_3<>+8(SB)/4, $0x00000002
+DATA CPI0_3<>+12(SB)/4, $0x00000003
+DATA CPI0_3<>+16(SB)/4, $0x00000000
+DATA CPI0_3<>+20(SB)/4, $0x00000001
+DATA CPI0_3<>+24(SB)/4, $0x00000002
+DATA CPI0_3<>+28(SB)/4, $0x00000003
+GLOBL CPI0_3<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_30<>+0(SB)/4, $0x3e2aaaab
+GLOBL CPI0_30<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_32<>+0(SB)/4, $0x3f000000
+GLOBL CPI0_32<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_34<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_34<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_37<>+0(SB)/4, $0x44314000
+GLOBL CPI0_37<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_38<>+0(SB)/4, $0xc4314000
+GLOBL CPI0_38<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_39<>+0(SB)/4, $0x652b82fe
+DATA CPI0_39<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_39<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_4<>+0(SB)/4, $0x00000000
+DATA CPI0_4<>+4(SB)/4, $0x00000003
+DATA CPI0_4<>+8(SB)/4, $0x00000002
+DATA CPI0_4<>+12(SB)/4, $0x00000003
+DATA CPI0_4<>+16(SB)/4, $0x00000000
+DATA CPI0_4<>+20(SB)/4, $0x00000001
+DATA CPI0_4<>+24(SB)/4, $0x00000002
+DATA CPI0_4<>+28(SB)/4, $0x00000003
+GLOBL CPI0_4<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_40<>+0(SB)/4, $0x00000000
+DATA CPI0_40<>+4(SB)/4, $0x80000000
+DATA CPI0_40<>+8(SB)/4, $0x00000000
+DATA CPI0_40<>+12(SB)/4, $0x00000000
+GLOBL CPI0_40<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_41<>+0(SB)/4, $0xffffffff
+DATA CPI0_41<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_41<>+8(SB)/4, $0x00000000
+DATA CPI0_41<>+12(SB)/4, $0x00000000
+GLOBL CPI0_41<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_42<>+0(SB)/4, $0xfee00000
+DATA CPI0_42<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_42<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_43<>+0(SB)/4, $0x35793c6c
+DATA CPI0_43<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_43<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_44<>+0(SB)/4, $0xeff8d898
+DATA CPI0_44<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_44<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_45<>+0(SB)/4, $0x67f544e4
+DATA CPI0_45<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_45<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_46<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_46<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_46<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_47<>+0(SB)/4, $0xa556c734
+DATA CPI0_47<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_47<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_48<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_48<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_48<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_49<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_49<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_49<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_5<>+0(SB)/4, $0x00000004
+DATA CPI0_5<>+4(SB)/4, $0x00000001
+DATA CPI0_5<>+8(SB)/4, $0x00000002
+DATA CPI0_5<>+12(SB)/4, $0x00000003
+DATA CPI0_5<>+16(SB)/4, $0x00000000
+DATA CPI0_5<>+20(SB)/4, $0x00000005
+DATA CPI0_5<>+24(SB)/4, $0x00000006
+DATA CPI0_5<>+28(SB)/4, $0x00000007
+GLOBL CPI0_5<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_50<>+0(SB)/4, $0x16c16c17
+DATA CPI0_50<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_50<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_51<>+0(SB)/4, $0x11111111
+DATA CPI0_51<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_51<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_52<>+0(SB)/4, $0x55555555
+DATA CPI0_52<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_52<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_53<>+0(SB)/4, $0x55555555
+DATA CPI0_53<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_53<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_54<>+0(SB)/4, $0x00000000
+DATA CPI0_54<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_54<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_55<>+0(SB)/4, $0x00000000
+DATA CPI0_55<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_55<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_6<>+0(SB)/4, $0x00000000
+DATA CPI0_6<>+4(SB)/4, $0x00000004
+DATA CPI0_6<>+8(SB)/4, $0x00000002
+DATA CPI0_6<>+12(SB)/4, $0x00000003
+DATA CPI0_6<>+16(SB)/4, $0x00000004
+DATA CPI0_6<>+20(SB)/4, $0x00000005
+DATA CPI0_6<>+24(SB)/4, $0x00000006
+DATA CPI0_6<>+28(SB)/4, $0x00000007
+GLOBL CPI0_6<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_7<>+0(SB)/4, $0x00000005
+DATA CPI0_7<>+4(SB)/4, $0x00000001
+DATA CPI0_7<>+8(SB)/4, $0x00000002
+DATA CPI0_7<>+12(SB)/4, $0x00000003
+DATA CPI0_7<>+16(SB)/4, $0x00000001
+DATA CPI0_7<>+20(SB)/4, $0x00000005
+DATA CPI0_7<>+24(SB)/4, $0x00000006
+DATA CPI0_7<>+28(SB)/4, $0x00000007
+GLOBL CPI0_7<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_8<>+0(SB)/4, $0x00000000
+DATA CPI0_8<>+4(SB)/4, $0x00000005
+DATA CPI0_8<>+8(SB)/4, $0x00000002
+DATA CPI0_8<>+12(SB)/4, $0x00000003
+DATA CPI0_8<>+16(SB)/4, $0x00000004
+DATA CPI0_8<>+20(SB)/4, $0x00000005
+DATA CPI0_8<>+24(SB)/4, $0x00000006
+DATA CPI0_8<>+28(SB)/4, $0x00000007
+GLOBL CPI0_8<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_9<>+0(SB)/4, $0x00000006
+DATA CPI0_9<>+4(SB)/4, $0x00000001
+DATA CPI0_9<>+8(SB)/4, $0x00000002
+DATA CPI0_9<>+12(SB)/4, $0x00000003
+DATA CPI0_9<>+16(SB)/4, $0x00000002
+DATA CPI0_9<>+20(SB)/4, $0x00000005
+DATA CPI0_9<>+24(SB)/4, $0x00000006
+DATA CPI0_9<>+28(SB)/4, $0x00000007
+GLOBL CPI0_9<>(SB), (RODATA|NOPTR), $32
+
+TEXT ·sdpa_c_f32_avx2(SB), $496-128
+	MOVQ    q+0(FP), DI
+	MOVQ    k+8(FP), SI
+	MOVQ    v+16(FP), DX
+	MOVQ    mask+24(FP), CX
+	MOVQ    scores+32(FP), R8
+	MOVQ    output+40(FP), R9
+	MOVQ    pseqLen+48(FP), R11
+	MOVQ    R11, 416(SP)
+	MOVQ    pkvLen+56(FP), R11
+	MOVQ    R11, 424(SP)
+	MOVQ    pheadDim+64(FP), R11
+	MOVQ    R11, 432(SP)
+	MOVQ    pscale+72(FP), R11
+	MOVQ    R11, 440(SP)
+	MOVQ    plen_q+80(FP), R11
+	MOVQ    R11, 448(SP)
+	MOVQ    plen_k+88(FP), R11
+	MOVQ    R11, 456(SP)
+	MOVQ    plen_v+96(FP), R11
+	MOVQ    R11, 464(SP)
+	MOVQ    plen_mask+104(FP), R11
+	MOVQ    R11, 472(SP)
+	MOVQ    plen_scores+112(FP), R11
+	MOVQ    R11, 480(SP)
+	MOVQ    plen_output+120(FP), R11
+	MOVQ    R11, 488(SP)
+	QUAD    $0x0000019024ac8d48                   // leaq	400(%rsp), %rbp
+	WORD    $0x8949; BYTE $0xf5                   // movq	%rsi, %r13
+	LONG    $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG    $0xe0e48348                           // andq	$-32, %rsp
+	LONG    $0x20458b48                           // movq	32(%rbp), %rax
+	QUAD    $0x000000f024948948                   // movq	%rdx, 240(%rsp)
+	WORD    $0x8b4c; BYTE $0x10                   // movq	(%rax), %r10
+	LONG    $0x18458b48                           // movq	24(%rbp), %rax
+	QUAD    $0x0000016024bc8948                   // movq	%rdi, 352(%rsp)
+	QUAD    $0x00000098248c8948                   // movq	%rcx, 152(%rsp)
+	WORD    $0x8b4c; BYTE $0x20                   // movq	(%rax), %r12
+	LONG    $0x10458b48                           // movq	16(%rbp), %rax
+	LONG    $0x244c894c; BYTE $0x20               // movq	%r9, 32(%rsp)
+	QUAD    $0x000000e82484894c                   // movq	%r8, 232(%rsp)
+	WORD    $0x8b48; BYTE $0x00                   // movq	(%rax), %rax
+	WORD    $0x854d; BYTE $0xe4                   // testq	%r12, %r12
+	WORD    $0x8948; BYTE $0xc6                   // movq	%rax, %rsi
+	LONG    $0x24448948; BYTE $0x78               // movq	%rax, 120(%rsp)
+	WORD    $0x940f; BYTE $0xc0                   // sete	%al
+	WORD    $0x8548; BYTE $0xf6                   // testq	%rsi, %rsi
+	WORD    $0x9e0f; BYTE $0xc2                   // setle	%dl
+	WORD    $0xd008                               // orb	%dl, %al
+	JNE     BB0_160
+	WORD    $0x854d; BYTE $0xd2                   // testq	%r10, %r10
+	JE      BB0_160
+	LONG    $0xf8528d49                           // leaq	-8(%r10), %rdx
+	LONG    $0x28458b48                           // movq	40(%rbp), %rax
+	WORD    $0x8949; BYTE $0xfb                   // movq	%rdi, %r11
+	LONG    $0x123c8d4b                           // leaq	(%r10,%r10), %rdi
+	LONG    $0x03eac148                           // shrq	$3, %rdx
+	LONG    $0x247c8948; BYTE $0x40               // movq	%rdi, 64(%rsp)
+	WORD    $0x014c; BYTE $0xd7                   // addq	%r10, %rdi
+	WORD    $0x3145; BYTE $0xff                   // xorl	%r15d, %r15d
+	QUAD    $0x00000000a5348d4a                   // leaq	0(,%r12,4), %rsi
+	QUAD    $0x00000000951c8d4a                   // leaq	0(,%r10,4), %rbx
+	WORD    $0x3145; BYTE $0xf6                   // xorl	%r14d, %r14d
+	LONG    $0x3810fac5                           // vmovss	(%rax), %xmm7
+	LONG    $0x24748948; BYTE $0x70               // movq	%rsi, 112(%rsp)
+	WORD    $0x014c; BYTE $0xc6                   // addq	%r8, %rsi
+	VMOVDQA CPI0_4<>(SB), Y14                     // vmovdqa	.LCPI0_4(%rip), %ymm14
+	QUAD    $0x000000b024b48948                   // movq	%rsi, 176(%rsp)
+	WORD    $0x894c; BYTE $0xd6                   // movq	%r10, %rsi
+	LONG    $0xd712fac5                           // vmovsldup	%xmm7, %xmm2
+	VMOVDQA CPI0_5<>(SB), Y13                     // vmovdqa	.LCPI0_5(%rip), %ymm13
+	LONG    $0x04e6c148                           // salq	$4, %rsi
+	LONG    $0x247c8948; BYTE $0x18               // movq	%rdi, 24(%rsp)
+	LONG    $0x02e7c148                           // salq	$2, %rdi
+	VMOVDQA CPI0_6<>(SB), Y15                     // vmovdqa	.LCPI0_6(%rip), %ymm15
+	QUAD    $0x000000d824b48948                   // movq	%rsi, 216(%rsp)
+	LONG    $0x1d748d49; BYTE $0x00               // leaq	0(%r13,%rbx), %rsi
+	LONG    $0x24748948; BYTE $0x68               // movq	%rsi, 104(%rsp)
+	WORD    $0x0148; BYTE $0xde                   // addq	%rbx, %rsi
+	LONG    $0x24748948; BYTE $0x48               // movq	%rsi, 72(%rsp)
+	WORD    $0x0148; BYTE $0xde                   // addq	%rbx, %rsi
+	LONG    $0x24748948; BYTE $0x58               // movq	%rsi, 88(%rsp)
+	QUAD    $0x00000008d5348d48                   // leaq	8(,%rdx,8), %rsi
+	LONG    $0xe0528d49                           // leaq	-32(%r10), %rdx
+	QUAD    $0x0000010024b48948                   // movq	%rsi, 256(%rsp)
+	LONG    $0x24748d49; BYTE $0xfc               // leaq	-4(%r12), %rsi
+	LONG    $0x05eac148                           // shrq	$5, %rdx
+	LONG    $0x24748948; BYTE $0x38               // movq	%rsi, 56(%rsp)
+	LONG    $0x02eec148                           // shrq	$2, %rsi
+	LONG    $0x01c28348                           // addq	$1, %rdx
+	QUAD    $0x00000004b5348d48                   // leaq	4(,%rsi,4), %rsi
+	QUAD    $0x000000d0248c894c                   // movq	%r9, 208(%rsp)
+	LONG    $0x24748948; BYTE $0x28               // movq	%rsi, 40(%rsp)
+	LONG    $0x24748d49; BYTE $0xf8               // leaq	-8(%r12), %rsi
+	QUAD    $0x0000009024b48948                   // movq	%rsi, 144(%rsp)
+	LONG    $0x03eec148                           // shrq	$3, %rsi
+	QUAD    $0x00000008f5348d48                   // leaq	8(,%rsi,8), %rsi
+	LONG    $0x247c8948; BYTE $0x08               // movq	%rdi, 8(%rsp)
+	QUAD    $0x000000a024b48948                   // movq	%rsi, 160(%rsp)
+	WORD    $0x8948; BYTE $0xd6                   // movq	%rdx, %rsi
+	LONG    $0x05e2c148                           // salq	$5, %rdx
+	LONG    $0x07e6c148                           // salq	$7, %rsi
+	LONG    $0x24548948; BYTE $0x60               // movq	%rdx, 96(%rsp)
+	LONG    $0x24748948; BYTE $0x50               // movq	%rsi, 80(%rsp)
+	LONG    $0x08728d48                           // leaq	8(%rdx), %rsi
+	WORD    $0x894c; BYTE $0xe2                   // movq	%r12, %rdx
+	LONG    $0x24748948; BYTE $0x30               // movq	%rsi, 48(%rsp)
+	LONG    $0x02eac148                           // shrq	$2, %rdx
+	LONG    $0x24748d49; BYTE $0xff               // leaq	-1(%r12), %rsi
+	QUAD    $0x000000c024b48948                   // movq	%rsi, 192(%rsp)
+	WORD    $0x894c; BYTE $0xe6                   // movq	%r12, %rsi
+	LONG    $0x04e2c148                           // salq	$4, %rdx
+	LONG    $0xfce68348                           // andq	$-4, %rsi
+	LONG    $0x24548948; BYTE $0x10               // movq	%rdx, 16(%rsp)
+	QUAD    $0x000000b824b48948                   // movq	%rsi, 184(%rsp)
+	QUAD    $0x000001402484894c                   // movq	%r8, 320(%rsp)
+	QUAD    $0x000001682484c748; LONG $0x00000000 // movq	$0, 360(%rsp)
+	QUAD    $0x000000e02494894c                   // movq	%r10, 224(%rsp)
+	QUAD    $0x000000a824bc894c                   // movq	%r15, 168(%rsp)
+	WORD    $0x894d; BYTE $0xe7                   // movq	%r12, %r15
+	WORD    $0x894d; BYTE $0xec                   // movq	%r13, %r12
+	LONG    $0x7c11fac5; WORD $0x0424             // vmovss	%xmm7, 4(%rsp)
+
+BB0_81:
+	LONG    $0x03ff8349             // cmpq	$3, %r15
+	JLE     BB0_4
+	LONG    $0x24548b48; BYTE $0x38 // movq	56(%rsp), %rdx
+	QUAD    $0x000000e824848b48     // movq	232(%rsp), %rax
+	QUAD    $0x0000008824b4894c     // movq	%r14, 136(%rsp)
+	WORD    $0x894c; BYTE $0xe7     // movq	%r12, %rdi
+	QUAD    $0x0000008024bc894c     // movq	%r15, 128(%rsp)
+	LONG    $0x244c8b4c; BYTE $0x58 // movq	88(%rsp), %r9
+	WORD    $0xf631                 // xorl	%esi, %esi
+	LONG    $0xfce28348             // andq	$-4, %rdx
+	LONG    $0x24448b4c; BYTE $0x48 // movq	72(%rsp), %r8
+	QUAD    $0x000000f8249c8948     // movq	%rbx, 248(%rsp)
+	WORD    $0x014c; BYTE $0xf2     // addq	%r14, %rdx
+	LONG    $0x246c8b4c; BYTE $0x68 // movq	104(%rsp), %r13
+	VMOVDQA CPI0_7<>(SB), Y10       // vmovdqa	.LCPI0_7(%rip), %ymm10
+	LONG    $0x90448d48; BYTE $0x10 // leaq	16(%rax,%rdx,4), %rax
+	VMOVDQA CPI0_8<>(SB), Y9        // vmovdqa	.LCPI0_8(%rip), %ymm9
+	VMOVDQA CPI0_9<>(SB), Y8        // vmovdqa	.LCPI0_9(%rip), %ymm8
+	QUAD    $0x000000c824848948     // movq	%rax, 200(%rsp)
+	LONG    $0x24448b48; BYTE $0x18 // movq	24(%rsp), %rax
+	VMOVDQA CPI0_10<>(SB), Y7       // vmovdqa	.LCPI0_10(%rip), %ymm7
+	VMOVDQA CPI0_11<>(SB), Y6       // vmovdqa	.LCPI0_11(%rip), %ymm6
+	QUAD    $0x0000017024848948     // movq	%rax, 368(%rsp)
+	LONG    $0x24448b48; BYTE $0x40 // movq	64(%rsp), %rax
+	QUAD    $0x000000e0248c8b48     // movq	224(%rsp), %rcx
+	QUAD    $0x0000017824848948     // movq	%rax, 376(%rsp)
+	QUAD    $0x0000014024848b48     // movq	320(%rsp), %rax
+	QUAD    $0x0000014824848948     // movq	%rax, 328(%rsp)
+
+BB0_14:
+	LONG $0x31048d48             // leaq	(%rcx,%rsi), %rax
+	QUAD $0x0000015824848948     // movq	%rax, 344(%rsp)
+	LONG $0x07f98348             // cmpq	$7, %rcx
+	JLE  BB0_87
+	LONG $0xdb57e0c5             // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	LONG $0xcb28fcc5             // vmovaps	%ymm3, %ymm1
+	LONG $0xe328fcc5             // vmovaps	%ymm3, %ymm4
+	LONG $0xeb28fcc5             // vmovaps	%ymm3, %ymm5
+
+BB0_6:
+	LONG $0x107cc1c4; WORD $0x8344; BYTE $0xe0 // vmovups	-32(%r11,%rax,4), %ymm0
+	LONG $0xb87de2c4; WORD $0x876c; BYTE $0xe0 // vfmadd231ps	-32(%rdi,%rax,4), %ymm0, %ymm5
+	LONG $0xb87dc2c4; WORD $0x8564; BYTE $0xe0 // vfmadd231ps	-32(%r13,%rax,4), %ymm0, %ymm4
+	LONG $0xb87dc2c4; WORD $0x804c; BYTE $0xe0 // vfmadd231ps	-32(%r8,%rax,4), %ymm0, %ymm1
+	LONG $0xb87dc2c4; WORD $0x815c; BYTE $0xe0 // vfmadd231ps	-32(%r9,%rax,4), %ymm0, %ymm3
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JLE  BB0_6
+	QUAD $0x0000010024948b48                   // movq	256(%rsp), %rdx
+
+BB0_5:
+	LONG    $0x197dc3c4; WORD $0x01eb       // vextractf128	$0x1, %ymm5, %xmm11
+	LONG    $0xdd5820c5                     // vaddps	%xmm5, %xmm11, %xmm11
+	LONG    $0x1220c1c4; BYTE $0xc3         // vmovhlps	%xmm11, %xmm11, %xmm0
+	LONG    $0xd85820c5                     // vaddps	%xmm0, %xmm11, %xmm11
+	LONG    $0x167ac1c4; BYTE $0xc3         // vmovshdup	%xmm11, %xmm0
+	LONG    $0xd85822c5                     // vaddss	%xmm0, %xmm11, %xmm11
+	LONG    $0x197de3c4; WORD $0x01e0       // vextractf128	$0x1, %ymm4, %xmm0
+	LONG    $0xc458f8c5                     // vaddps	%xmm4, %xmm0, %xmm0
+	LONG    $0xe012f8c5                     // vmovhlps	%xmm0, %xmm0, %xmm4
+	LONG    $0xc458f8c5                     // vaddps	%xmm4, %xmm0, %xmm0
+	LONG    $0xe016fac5                     // vmovshdup	%xmm0, %xmm4
+	LONG    $0xc458fac5                     // vaddss	%xmm4, %xmm0, %xmm0
+	LONG    $0x0479e3c4; WORD $0xe0c0       // vpermilps	$224, %xmm0, %xmm0
+	LONG    $0x0c2163c4; WORD $0x02d8       // vblendps	$2, %xmm0, %xmm11, %xmm11
+	LONG    $0x197de3c4; WORD $0x01c8       // vextractf128	$0x1, %ymm1, %xmm0
+	LONG    $0xc958f8c5                     // vaddps	%xmm1, %xmm0, %xmm1
+	LONG    $0xc112f0c5                     // vmovhlps	%xmm1, %xmm1, %xmm0
+	LONG    $0xc858f0c5                     // vaddps	%xmm0, %xmm1, %xmm1
+	LONG    $0xc116fac5                     // vmovshdup	%xmm1, %xmm0
+	LONG    $0xc858f2c5                     // vaddss	%xmm0, %xmm1, %xmm1
+	LONG    $0x197de3c4; WORD $0x01d8       // vextractf128	$0x1, %ymm3, %xmm0
+	LONG    $0xd858e0c5                     // vaddps	%xmm0, %xmm3, %xmm3
+	LONG    $0xc312e0c5                     // vmovhlps	%xmm3, %xmm3, %xmm0
+	LONG    $0xc358f8c5                     // vaddps	%xmm3, %xmm0, %xmm0
+	LONG    $0xd816fac5                     // vmovshdup	%xmm0, %xmm3
+	LONG    $0xc358fac5                     // vaddss	%xmm3, %xmm0, %xmm0
+	LONG    $0x0479e3c4; WORD $0xe0c0       // vpermilps	$224, %xmm0, %xmm0
+	LONG    $0x0c71e3c4; WORD $0x02c8       // vblendps	$2, %xmm0, %xmm1, %xmm1
+	WORD    $0x3948; BYTE $0xd1             // cmpq	%rdx, %rcx
+	JLE     BB0_7
+	WORD    $0x8948; BYTE $0xc8             // movq	%rcx, %rax
+	WORD    $0x8949; BYTE $0xd2             // movq	%rdx, %r10
+	WORD    $0x2948; BYTE $0xd0             // subq	%rdx, %rax
+	QUAD    $0x0000015024848948             // movq	%rax, 336(%rsp)
+	LONG    $0x01e88348                     // subq	$1, %rax
+	LONG    $0x06f88348                     // cmpq	$6, %rax
+	JBE     BB0_88
+	QUAD    $0x00000168249c8b48             // movq	360(%rsp), %rbx
+	QUAD    $0x0000011824ac894c             // movq	%r13, 280(%rsp)
+	QUAD    $0x00000110249c894c             // movq	%r11, 272(%rsp)
+	VMOVDQA CPI0_12<>(SB), Y5               // vmovdqa	.LCPI0_12(%rip), %ymm5
+	LONG    $0x13048d48                     // leaq	(%rbx,%rdx), %rax
+	QUAD    $0x00000160249c8b48             // movq	352(%rsp), %rbx
+	QUAD    $0x00000108248c8948             // movq	%rcx, 264(%rsp)
+	QUAD    $0x000120249413f8c5; BYTE $0x00 // vmovlps	%xmm2, 288(%rsp)
+	LONG    $0x833c8d4c                     // leaq	(%rbx,%rax,4), %r15
+	QUAD    $0x00000158249c8b48             // movq	344(%rsp), %rbx
+	LONG    $0x16048d48                     // leaq	(%rsi,%rdx), %rax
+	LONG    $0x84348d4d                     // leaq	(%r12,%rax,4), %r14
+	LONG    $0x1a048d48                     // leaq	(%rdx,%rbx), %rax
+	LONG    $0x841c8d49                     // leaq	(%r12,%rax,4), %rbx
+	QUAD    $0x0000017824848b48             // movq	376(%rsp), %rax
+	WORD    $0x0148; BYTE $0xd0             // addq	%rdx, %rax
+	LONG    $0x84048d49                     // leaq	(%r12,%rax,4), %rax
+	QUAD    $0x0000012824848948             // movq	%rax, 296(%rsp)
+	QUAD    $0x0000017024848b48             // movq	368(%rsp), %rax
+	QUAD    $0x0000012824ac8b4c             // movq	296(%rsp), %r13
+	WORD    $0x0148; BYTE $0xd0             // addq	%rdx, %rax
+	LONG    $0x84048d49                     // leaq	(%r12,%rax,4), %rax
+	QUAD    $0x0000013024848948             // movq	%rax, 304(%rsp)
+	QUAD    $0x0000015024848b48             // movq	336(%rsp), %rax
+	QUAD    $0x00000130249c8b4c             // movq	304(%rsp), %r11
+	LONG    $0x03e8c148                     // shrq	$3, %rax
+	LONG    $0x05e0c148                     // salq	$5, %rax
+	QUAD    $0x0000013824848948             // movq	%rax, 312(%rsp)
+	QUAD    $0x00000138248c8b48             // movq	312(%rsp), %rcx
+	WORD    $0xc031                         // xorl	%eax, %eax
+
+BB0_9:
+	LONG      $0x107cc1c4; WORD $0x0714             // vmovups	(%r15,%rax), %ymm2
+	LONG      $0x596cc1c4; WORD $0x0604             // vmulps	(%r14,%rax), %ymm2, %ymm0
+	LONG      $0x2459ecc5; BYTE $0x03               // vmulps	(%rbx,%rax), %ymm2, %ymm4
+	VPERMILPS CPI0_2<>(SB), Y4, Y3                  // vpermilps	.LCPI0_2(%rip), %ymm4, %ymm3
+	VPERMILPS CPI0_3<>(SB), Y4, Y12                 // vpermilps	.LCPI0_3(%rip), %ymm4, %ymm12
+	LONG      $0x0c7de3c4; WORD $0x02db             // vblendps	$2, %ymm3, %ymm0, %ymm3
+	LONG      $0xdb5820c5                           // vaddps	%xmm3, %xmm11, %xmm11
+	LONG      $0x047de3c4; WORD $0xe5d8             // vpermilps	$229, %ymm0, %ymm3
+	LONG      $0x0c65e3c4; WORD $0xfedc             // vblendps	$254, %ymm4, %ymm3, %ymm3
+	LONG      $0xdb5820c5                           // vaddps	%xmm3, %xmm11, %xmm11
+	LONG      $0x047de3c4; WORD $0xe6d8             // vpermilps	$230, %ymm0, %ymm3
+	LONG      $0x0c65c3c4; WORD $0xfedc             // vblendps	$254, %ymm12, %ymm3, %ymm3
+	LONG      $0xe35820c5                           // vaddps	%xmm3, %xmm11, %xmm12
+	LONG      $0x0c5d42c4; BYTE $0xde               // vpermilps	%ymm14, %ymm4, %ymm11
+	LONG      $0x047de3c4; WORD $0xe7d8             // vpermilps	$231, %ymm0, %ymm3
+	LONG      $0x0c65c3c4; WORD $0xfedb             // vblendps	$254, %ymm11, %ymm3, %ymm3
+	LONG      $0xdb5818c5                           // vaddps	%xmm3, %xmm12, %xmm11
+	LONG      $0x360562c4; BYTE $0xe4               // vpermd	%ymm4, %ymm15, %ymm12
+	LONG      $0x3615e2c4; BYTE $0xd8               // vpermd	%ymm0, %ymm13, %ymm3
+	LONG      $0x0c65c3c4; WORD $0xfedc             // vblendps	$254, %ymm12, %ymm3, %ymm3
+	LONG      $0xe35820c5                           // vaddps	%xmm3, %xmm11, %xmm12
+	LONG      $0x363562c4; BYTE $0xdc               // vpermd	%ymm4, %ymm9, %ymm11
+	LONG      $0x362de2c4; BYTE $0xd8               // vpermd	%ymm0, %ymm10, %ymm3
+	LONG      $0x0c65c3c4; WORD $0xfedb             // vblendps	$254, %ymm11, %ymm3, %ymm3
+	LONG      $0xdb5818c5                           // vaddps	%xmm3, %xmm12, %xmm11
+	LONG      $0x363de2c4; BYTE $0xd8               // vpermd	%ymm0, %ymm8, %ymm3
+	LONG      $0x364562c4; BYTE $0xe4               // vpermd	%ymm4, %ymm7, %ymm12
+	LONG      $0x0c65c3c4; WORD $0xfedc             // vblendps	$254, %ymm12, %ymm3, %ymm3
+	LONG      $0x3655e2c4; BYTE $0xe4               // vpermd	%ymm4, %ymm5, %ymm4
+	LONG      $0x364de2c4; BYTE $0xc0               // vpermd	%ymm0, %ymm6, %ymm0
+	LONG      $0x0c7de3c4; WORD $0xfec4             // vblendps	$254, %ymm4, %ymm0, %ymm0
+	LONG      $0xdb5820c5                           // vaddps	%xmm3, %xmm11, %xmm11
+	LONG      $0x596cc1c4; WORD $0x055c; BYTE $0x00 // vmulps	0(%r13,%rax), %ymm2, %ymm3
+	LONG      $0x596cc1c4; WORD $0x0314             // vmulps	(%r11,%rax), %ymm2, %ymm2
+	LONG      $0x20c08348                           // addq	$32, %rax
+	VPERMILPS CPI0_3<>(SB), Y2, Y4                  // vpermilps	.LCPI0_3(%rip), %ymm2, %ymm4
+	LONG      $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	VPERMILPS CPI0_2<>(SB), Y2, Y0                  // vpermilps	.LCPI0_2(%rip), %ymm2, %ymm0
+	LONG      $0x0c65e3c4; WORD $0x02c0             // vblendps	$2, %ymm0, %ymm3, %ymm0
+	LONG      $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG      $0x047de3c4; WORD $0xe5cb             // vpermilps	$229, %ymm3, %ymm1
+	LONG      $0x0c75e3c4; WORD $0xfeca             // vblendps	$254, %ymm2, %ymm1, %ymm1
+	LONG      $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG      $0x047de3c4; WORD $0xe6cb             // vpermilps	$230, %ymm3, %ymm1
+	LONG      $0x0c75e3c4; WORD $0xfecc             // vblendps	$254, %ymm4, %ymm1, %ymm1
+	LONG      $0x0c6dc2c4; BYTE $0xe6               // vpermilps	%ymm14, %ymm2, %ymm4
+	LONG      $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG      $0x047de3c4; WORD $0xe7cb             // vpermilps	$231, %ymm3, %ymm1
+	LONG      $0x0c75e3c4; WORD $0xfecc             // vblendps	$254, %ymm4, %ymm1, %ymm1
+	LONG      $0x3605e2c4; BYTE $0xe2               // vpermd	%ymm2, %ymm15, %ymm4
+	LONG      $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG      $0x3615e2c4; BYTE $0xcb               // vpermd	%ymm3, %ymm13, %ymm1
+	LONG      $0x0c75e3c4; WORD $0xfecc             // vblendps	$254, %ymm4, %ymm1, %ymm1
+	LONG      $0x3635e2c4; BYTE $0xe2               // vpermd	%ymm2, %ymm9, %ymm4
+	LONG      $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG      $0x362de2c4; BYTE $0xcb               // vpermd	%ymm3, %ymm10, %ymm1
+	LONG      $0x0c75e3c4; WORD $0xfecc             // vblendps	$254, %ymm4, %ymm1, %ymm1
+	LONG      $0x3645e2c4; BYTE $0xe2               // vpermd	%ymm2, %ymm7, %ymm4
+	LONG      $0x3655e2c4; BYTE $0xd2               // vpermd	%ymm2, %ymm5, %ymm2
+	LONG      $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG      $0x363de2c4; BYTE $0xcb               // vpermd	%ymm3, %ymm8, %ymm1
+	LONG      $0x364de2c4; BYTE $0xdb               // vpermd	%ymm3, %ymm6, %ymm3
+	LONG      $0x0c75e3c4; WORD $0xfecc             // vblendps	$254, %ymm4, %ymm1, %ymm1
+	LONG      $0x0c65e3c4; WORD $0xfeda             // vblendps	$254, %ymm2, %ymm3, %ymm3
+	LONG      $0xc958f8c5                           // vaddps	%xmm1, %xmm0, %xmm1
+	LONG      $0xcb58f0c5                           // vaddps	%xmm3, %xmm1, %xmm1
+	WORD      $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JNE       BB0_9
+	QUAD      $0x00000150249c8b48                   // movq	336(%rsp), %rbx
+	QUAD      $0x0000011824ac8b4c                   // movq	280(%rsp), %r13
+	QUAD      $0x00000110249c8b4c                   // movq	272(%rsp), %r11
+	QUAD      $0x00000108248c8b48                   // movq	264(%rsp), %rcx
+	QUAD      $0x00012024947efac5; BYTE $0x00       // vmovq	288(%rsp), %xmm2
+	WORD      $0x8948; BYTE $0xd8                   // movq	%rbx, %rax
+	LONG      $0xf8e08348                           // andq	$-8, %rax
+	WORD      $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD      $0xe383; BYTE $0x07                   // andl	$7, %ebx
+	JE        BB0_7
+
+BB0_8:
+	QUAD $0x00000150249c8b48       // movq	336(%rsp), %rbx
+	WORD $0x2948; BYTE $0xc3       // subq	%rax, %rbx
+	LONG $0xff738d4c               // leaq	-1(%rbx), %r14
+	LONG $0x02fe8349               // cmpq	$2, %r14
+	JBE  BB0_12
+	QUAD $0x0000016824bc8b4c       // movq	360(%rsp), %r15
+	LONG $0x07348d4d               // leaq	(%r15,%rax), %r14
+	QUAD $0x0000016024bc8b4c       // movq	352(%rsp), %r15
+	WORD $0x014d; BYTE $0xd6       // addq	%r10, %r14
+	LONG $0x107881c4; WORD $0xb724 // vmovups	(%r15,%r14,4), %xmm4
+	LONG $0x06348d4c               // leaq	(%rsi,%rax), %r14
+	QUAD $0x0000015824bc8b4c       // movq	344(%rsp), %r15
+	WORD $0x014d; BYTE $0xd6       // addq	%r10, %r14
+	LONG $0x595881c4; WORD $0xb41c // vmulps	(%r12,%r14,4), %xmm4, %xmm3
+	LONG $0x10348d4e               // leaq	(%rax,%r10), %r14
+	WORD $0x014d; BYTE $0xf7       // addq	%r14, %r15
+	LONG $0x595881c4; WORD $0xbc2c // vmulps	(%r12,%r15,4), %xmm4, %xmm5
+	QUAD $0x0000017824bc8b4c       // movq	376(%rsp), %r15
+	WORD $0x014c; BYTE $0xf8       // addq	%r15, %rax
+	LONG $0x0479e3c4; WORD $0xe5c3 // vpermilps	$229, %xmm3, %xmm0
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+	LONG $0x047963c4; WORD $0xe0e5 // vpermilps	$224, %xmm5, %xmm12
+	LONG $0x0c79e3c4; WORD $0x0ec5 // vblendps	$14, %xmm5, %xmm0, %xmm0
+	LONG $0x0c6143c4; WORD $0x02e4 // vblendps	$2, %xmm12, %xmm3, %xmm12
+	LONG $0xdd15e0c5               // vunpckhps	%xmm5, %xmm3, %xmm3
+	LONG $0x582041c4; BYTE $0xe4   // vaddps	%xmm12, %xmm11, %xmm12
+	LONG $0x0479e3c4; WORD $0xd4eb // vpermilps	$212, %xmm3, %xmm5
+	LONG $0x0479e3c4; WORD $0xdedb // vpermilps	$222, %xmm3, %xmm3
+	LONG $0xc05898c5               // vaddps	%xmm0, %xmm12, %xmm0
+	LONG $0xdd5878c5               // vaddps	%xmm5, %xmm0, %xmm11
+	LONG $0xdb5820c5               // vaddps	%xmm3, %xmm11, %xmm11
+	LONG $0x5958c1c4; WORD $0x841c // vmulps	(%r12,%rax,4), %xmm4, %xmm3
+	QUAD $0x0000017024848b48       // movq	368(%rsp), %rax
+	WORD $0x0149; BYTE $0xc6       // addq	%rax, %r14
+	WORD $0x8948; BYTE $0xd8       // movq	%rbx, %rax
+	LONG $0x595881c4; WORD $0xb424 // vmulps	(%r12,%r14,4), %xmm4, %xmm4
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	WORD $0xe383; BYTE $0x03       // andl	$3, %ebx
+	LONG $0x0479e3c4; WORD $0xe0c4 // vpermilps	$224, %xmm4, %xmm0
+	LONG $0x0c61e3c4; WORD $0x02c0 // vblendps	$2, %xmm0, %xmm3, %xmm0
+	LONG $0xc058f0c5               // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0xe5cb // vpermilps	$229, %xmm3, %xmm1
+	LONG $0xdc15e0c5               // vunpckhps	%xmm4, %xmm3, %xmm3
+	LONG $0x0c71e3c4; WORD $0x0ecc // vblendps	$14, %xmm4, %xmm1, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x0479e3c4; WORD $0xd4cb // vpermilps	$212, %xmm3, %xmm1
+	LONG $0x0479e3c4; WORD $0xdedb // vpermilps	$222, %xmm3, %xmm3
+	LONG $0xc958f8c5               // vaddps	%xmm1, %xmm0, %xmm1
+	LONG $0xcb58f0c5               // vaddps	%xmm3, %xmm1, %xmm1
+	JE   BB0_7
+
+BB0_12:
+	QUAD $0x0000016824bc8b4c                   // movq	360(%rsp), %r15
+	QUAD $0x00000160249c8b48                   // movq	352(%rsp), %rbx
+	LONG $0x16148d4c                           // leaq	(%rsi,%rdx), %r10
+	QUAD $0x0000015824b48b4c                   // movq	344(%rsp), %r14
+	LONG $0x107a81c4; WORD $0x941c             // vmovss	(%r12,%r10,4), %xmm3
+	LONG $0x17048d49                           // leaq	(%r15,%rdx), %rax
+	LONG $0x0410fac5; BYTE $0x83               // vmovss	(%rbx,%rax,4), %xmm0
+	LONG $0x16048d49                           // leaq	(%r14,%rdx), %rax
+	LONG $0x2161c3c4; WORD $0x841c; BYTE $0x10 // vinsertps	$0x10, (%r12,%rax,4), %xmm3, %xmm3
+	QUAD $0x0000017824848b48                   // movq	376(%rsp), %rax
+	LONG $0xc012fac5                           // vmovsldup	%xmm0, %xmm0
+	LONG $0x10148d4c                           // leaq	(%rax,%rdx), %r10
+	QUAD $0x0000017024848b48                   // movq	368(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0xb87962c4; BYTE $0xdb               // vfmadd231ps	%xmm3, %xmm0, %xmm11
+	LONG $0x107a81c4; WORD $0x941c             // vmovss	(%r12,%r10,4), %xmm3
+	LONG $0x2161c3c4; WORD $0x841c; BYTE $0x10 // vinsertps	$0x10, (%r12,%rax,4), %xmm3, %xmm3
+	LONG $0x01428d48                           // leaq	1(%rdx), %rax
+	LONG $0xb879e2c4; BYTE $0xcb               // vfmadd231ps	%xmm3, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_7
+	LONG $0x07148d4d                           // leaq	(%r15,%rax), %r10
+	LONG $0x02c28348                           // addq	$2, %rdx
+	LONG $0x107aa1c4; WORD $0x9304             // vmovss	(%rbx,%r10,4), %xmm0
+	LONG $0x301c8d48                           // leaq	(%rax,%rsi), %rbx
+	LONG $0x30148d4e                           // leaq	(%rax,%r14), %r10
+	LONG $0x107ac1c4; WORD $0x9c1c             // vmovss	(%r12,%rbx,4), %xmm3
+	QUAD $0x00000170249c8b48                   // movq	368(%rsp), %rbx
+	LONG $0xc012fac5                           // vmovsldup	%xmm0, %xmm0
+	LONG $0x216183c4; WORD $0x941c; BYTE $0x10 // vinsertps	$0x10, (%r12,%r10,4), %xmm3, %xmm3
+	QUAD $0x0000017824948b4c                   // movq	376(%rsp), %r10
+	WORD $0x0149; BYTE $0xc2                   // addq	%rax, %r10
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0xb86162c4; BYTE $0xd8               // vfmadd231ps	%xmm0, %xmm3, %xmm11
+	LONG $0x107a81c4; WORD $0x941c             // vmovss	(%r12,%r10,4), %xmm3
+	LONG $0x2161c3c4; WORD $0x841c; BYTE $0x10 // vinsertps	$0x10, (%r12,%rax,4), %xmm3, %xmm3
+	LONG $0xb879e2c4; BYTE $0xcb               // vfmadd231ps	%xmm3, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_7
+	QUAD $0x00000160249c8b48                   // movq	352(%rsp), %rbx
+	LONG $0x17048d49                           // leaq	(%r15,%rdx), %rax
+	WORD $0x894d; BYTE $0xf2                   // movq	%r14, %r10
+	WORD $0x0149; BYTE $0xd2                   // addq	%rdx, %r10
+	LONG $0x0410fac5; BYTE $0x83               // vmovss	(%rbx,%rax,4), %xmm0
+	LONG $0x16048d48                           // leaq	(%rsi,%rdx), %rax
+	QUAD $0x00000170249c8b48                   // movq	368(%rsp), %rbx
+	LONG $0x107ac1c4; WORD $0x841c             // vmovss	(%r12,%rax,4), %xmm3
+	LONG $0x216183c4; WORD $0x941c; BYTE $0x10 // vinsertps	$0x10, (%r12,%r10,4), %xmm3, %xmm3
+	LONG $0xc012fac5                           // vmovsldup	%xmm0, %xmm0
+	QUAD $0x0000017824948b4c                   // movq	376(%rsp), %r10
+	LONG $0x12048d49                           // leaq	(%r10,%rdx), %rax
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0xb86162c4; BYTE $0xd8               // vfmadd231ps	%xmm0, %xmm3, %xmm11
+	LONG $0x107ac1c4; WORD $0x841c             // vmovss	(%r12,%rax,4), %xmm3
+	LONG $0x2161c3c4; WORD $0x941c; BYTE $0x10 // vinsertps	$0x10, (%r12,%rdx,4), %xmm3, %xmm3
+	LONG $0xb879e2c4; BYTE $0xcb               // vfmadd231ps	%xmm3, %xmm0, %xmm1
+
+BB0_7:
+	LONG $0x596841c4; BYTE $0xdb // vmulps	%xmm11, %xmm2, %xmm11
+	QUAD $0x000000d8249c8b48     // movq	216(%rsp), %rbx
+	QUAD $0x0000014824848b48     // movq	328(%rsp), %rax
+	LONG $0xc959e8c5             // vmulps	%xmm1, %xmm2, %xmm1
+	QUAD $0x000000f824948b48     // movq	248(%rsp), %rdx
+	QUAD $0x0000017824940148     // addq	%rdx, 376(%rsp)
+	WORD $0x0148; BYTE $0xdf     // addq	%rbx, %rdi
+	WORD $0x0149; BYTE $0xdd     // addq	%rbx, %r13
+	WORD $0x0149; BYTE $0xd8     // addq	%rbx, %r8
+	WORD $0x0149; BYTE $0xd9     // addq	%rbx, %r9
+	QUAD $0x000000c8249c8b48     // movq	200(%rsp), %rbx
+	LONG $0x10c08348             // addq	$16, %rax
+	QUAD $0x0000017024940148     // addq	%rdx, 368(%rsp)
+	WORD $0x0148; BYTE $0xd6     // addq	%rdx, %rsi
+	LONG $0x581378c5; BYTE $0xf0 // vmovlps	%xmm11, -16(%rax)
+	LONG $0x4813f8c5; BYTE $0xf8 // vmovlps	%xmm1, -8(%rax)
+	QUAD $0x0000014824848948     // movq	%rax, 328(%rsp)
+	WORD $0x3948; BYTE $0xd8     // cmpq	%rbx, %rax
+	JNE  BB0_14
+	LONG $0x24448b48; BYTE $0x28 // movq	40(%rsp), %rax
+	QUAD $0x0000008024bc8b4c     // movq	128(%rsp), %r15
+	WORD $0x8948; BYTE $0xd3     // movq	%rdx, %rbx
+	QUAD $0x0000008824b48b4c     // movq	136(%rsp), %r14
+	WORD $0x8949; BYTE $0xc5     // movq	%rax, %r13
+	WORD $0x3949; BYTE $0xc7     // cmpq	%rax, %r15
+	JLE  BB0_163
+
+BB0_16:
+	QUAD $0x000000e024b48b48       // movq	224(%rsp), %rsi
+	QUAD $0x0000017824bc894c       // movq	%r15, 376(%rsp)
+	QUAD $0x00000170249c8948       // movq	%rbx, 368(%rsp)
+	LONG $0x4c10fac5; WORD $0x0424 // vmovss	4(%rsp), %xmm1
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	QUAD $0x0000015824b4894c       // movq	%r14, 344(%rsp)
+	QUAD $0x0000016024b48b4c       // movq	352(%rsp), %r14
+	LONG $0xc5af0f4d               // imulq	%r13, %r8
+	LONG $0x840c8d4b               // leaq	(%r12,%r8,4), %rcx
+
+BB0_32:
+	LONG $0x07fe8348             // cmpq	$7, %rsi
+	JLE  BB0_91
+	LONG $0xdb57e0c5             // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_24:
+	LONG $0x107cc1c4; WORD $0x837c; BYTE $0xe0 // vmovups	-32(%r11,%rax,4), %ymm7
+	LONG $0xb845e2c4; WORD $0x815c; BYTE $0xe0 // vfmadd231ps	-32(%rcx,%rax,4), %ymm7, %ymm3
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_24
+	QUAD $0x0000010024948b48                   // movq	256(%rsp), %rdx
+
+BB0_23:
+	LONG $0x197de3c4; WORD $0x01d8 // vextractf128	$0x1, %ymm3, %xmm0
+	LONG $0xc358f8c5               // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xd812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm3
+	LONG $0xc358f8c5               // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xd816fac5               // vmovshdup	%xmm0, %xmm3
+	LONG $0xc358fac5               // vaddss	%xmm3, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd6       // cmpq	%rdx, %rsi
+	JLE  BB0_25
+	WORD $0x8948; BYTE $0xf7       // movq	%rsi, %rdi
+	WORD $0x8949; BYTE $0xd7       // movq	%rdx, %r15
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_92
+	QUAD $0x0000016824848b48       // movq	360(%rsp), %rax
+	WORD $0x8949; BYTE $0xf9       // movq	%rdi, %r9
+	LONG $0xf128f8c5               // vmovaps	%xmm1, %xmm6
+	LONG $0x03e9c149               // shrq	$3, %r9
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x05e1c149               // salq	$5, %r9
+	LONG $0x861c8d49               // leaq	(%r14,%rax,4), %rbx
+	LONG $0x10048d49               // leaq	(%r8,%rdx), %rax
+	LONG $0x84148d4d               // leaq	(%r12,%rax,4), %r10
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_27:
+	LONG $0x107cc1c4; WORD $0x023c // vmovups	(%r10,%rax), %ymm7
+	LONG $0x1c59c4c5; BYTE $0x03   // vmulps	(%rbx,%rax), %ymm7, %ymm3
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xc358fac5               // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xebc6e0c5; BYTE $0x55   // vshufps	$85, %xmm3, %xmm3, %xmm5
+	LONG $0xe3c6e0c5; BYTE $0xff   // vshufps	$255, %xmm3, %xmm3, %xmm4
+	LONG $0xe858d2c5               // vaddss	%xmm0, %xmm5, %xmm5
+	LONG $0xc315e0c5               // vunpckhps	%xmm3, %xmm3, %xmm0
+	LONG $0x197de3c4; WORD $0x01db // vextractf128	$0x1, %ymm3, %xmm3
+	LONG $0xc558fac5               // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xe058dac5               // vaddss	%xmm0, %xmm4, %xmm4
+	LONG $0xc458e2c5               // vaddss	%xmm4, %xmm3, %xmm0
+	LONG $0xe3c6e0c5; BYTE $0x55   // vshufps	$85, %xmm3, %xmm3, %xmm4
+	LONG $0xe058dac5               // vaddss	%xmm0, %xmm4, %xmm4
+	LONG $0xc315e0c5               // vunpckhps	%xmm3, %xmm3, %xmm0
+	LONG $0xdbc6e0c5; BYTE $0xff   // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xc458fac5               // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xc358fac5               // vaddss	%xmm3, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc1       // cmpq	%rax, %r9
+	JNE  BB0_27
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xce28f8c5               // vmovaps	%xmm6, %xmm1
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x07c7f640               // testb	$7, %dil
+	JE   BB0_25
+
+BB0_26:
+	WORD $0x2948; BYTE $0xc7       // subq	%rax, %rdi
+	LONG $0xff4f8d4c               // leaq	-1(%rdi), %r9
+	LONG $0x02f98349               // cmpq	$2, %r9
+	JBE  BB0_30
+	QUAD $0x00000168249c8b48       // movq	360(%rsp), %rbx
+	LONG $0x000c8d4d               // leaq	(%r8,%rax), %r9
+	WORD $0x014d; BYTE $0xf9       // addq	%r15, %r9
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	WORD $0x014c; BYTE $0xf8       // addq	%r15, %rax
+	LONG $0x1078c1c4; WORD $0x861c // vmovups	(%r14,%rax,4), %xmm3
+	LONG $0x596081c4; WORD $0x8c1c // vmulps	(%r12,%r9,4), %xmm3, %xmm3
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	WORD $0xe783; BYTE $0x03       // andl	$3, %edi
+	LONG $0xc058e2c5               // vaddss	%xmm0, %xmm3, %xmm0
+	LONG $0xe3c6e0c5; BYTE $0x55   // vshufps	$85, %xmm3, %xmm3, %xmm4
+	LONG $0xe058dac5               // vaddss	%xmm0, %xmm4, %xmm4
+	LONG $0xc315e0c5               // vunpckhps	%xmm3, %xmm3, %xmm0
+	LONG $0xdbc6e0c5; BYTE $0xff   // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xc458fac5               // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xc358fac5               // vaddss	%xmm3, %xmm0, %xmm0
+	JE   BB0_25
+
+BB0_30:
+	QUAD $0x00000168249c8b48       // movq	360(%rsp), %rbx
+	LONG $0x10048d49               // leaq	(%r8,%rdx), %rax
+	LONG $0x133c8d48               // leaq	(%rbx,%rdx), %rdi
+	LONG $0x107ac1c4; WORD $0xbe34 // vmovss	(%r14,%rdi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8404 // vfmadd231ss	(%r12,%rax,4), %xmm6, %xmm0
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3948; BYTE $0xf0       // cmpq	%rsi, %rax
+	JGE  BB0_25
+	LONG $0x183c8d48               // leaq	(%rax,%rbx), %rdi
+	LONG $0x02c28348               // addq	$2, %rdx
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x107ac1c4; WORD $0xbe34 // vmovss	(%r14,%rdi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8404 // vfmadd231ss	(%r12,%rax,4), %xmm6, %xmm0
+	WORD $0x3948; BYTE $0xd6       // cmpq	%rdx, %rsi
+	JLE  BB0_25
+	LONG $0x10048d49               // leaq	(%r8,%rdx), %rax
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x107ac1c4; WORD $0x843c // vmovss	(%r12,%rax,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x9604 // vfmadd231ss	(%r14,%rdx,4), %xmm7, %xmm0
+
+BB0_25:
+	LONG $0xc059f2c5                     // vmulss	%xmm0, %xmm1, %xmm0
+	QUAD $0x0000014024848b48             // movq	320(%rsp), %rax
+	WORD $0x0149; BYTE $0xf0             // addq	%rsi, %r8
+	LONG $0x117aa1c4; WORD $0xa804       // vmovss	%xmm0, (%rax,%r13,4)
+	QUAD $0x0000017024848b48             // movq	368(%rsp), %rax
+	LONG $0x01c58349                     // addq	$1, %r13
+	WORD $0x0148; BYTE $0xc1             // addq	%rax, %rcx
+	QUAD $0x0000017824ac394c             // cmpq	%r13, 376(%rsp)
+	JG   BB0_32
+	QUAD $0x0000009824bc8348; BYTE $0x00 // cmpq	$0, 152(%rsp)
+	QUAD $0x0000015824b48b4c             // movq	344(%rsp), %r14
+	WORD $0x8948; BYTE $0xc3             // movq	%rax, %rbx
+	QUAD $0x0000017824bc8b4c             // movq	376(%rsp), %r15
+	JNE  BB0_164
+
+BB0_22:
+	QUAD $0x0000014024848b48 // movq	320(%rsp), %rax
+	WORD $0xd231             // xorl	%edx, %edx
+	LONG $0xe457d8c5         // vxorps	%xmm4, %xmm4, %xmm4
+	LONG $0x0010fac5         // vmovss	(%rax), %xmm0
+	LONG $0x01ff8349         // cmpq	$1, %r15
+	JLE  BB0_19
+
+BB0_18:
+	QUAD $0x0000014024848b48 // movq	320(%rsp), %rax
+	LONG $0x04508d48         // leaq	4(%rax), %rdx
+	QUAD $0x000000b024848b48 // movq	176(%rsp), %rax
+
+BB0_49:
+	LONG         $0x0a10fac5                     // vmovss	(%rdx), %xmm1
+	LONG         $0x04c28348                     // addq	$4, %rdx
+	LONG         $0xc05ff2c5                     // vmaxss	%xmm0, %xmm1, %xmm0
+	WORD         $0x3948; BYTE $0xd0             // cmpq	%rdx, %rax
+	JNE          BB0_49
+	LONG         $0x187d62c4; BYTE $0xc0         // vbroadcastss	%xmm0, %ymm8
+	LONG         $0x07ff8349                     // cmpq	$7, %r15
+	JLE          BB0_50
+	QUAD         $0x0000009024948b48             // movq	144(%rsp), %rdx
+	LONG         $0x00007fbe; BYTE $0x00         // movl	$127, %esi
+	QUAD         $0x000000e824848b48             // movq	232(%rsp), %rax
+	LONG         $0xe457d8c5                     // vxorps	%xmm4, %xmm4, %xmm4
+	LONG         $0xfe6ef9c5                     // vmovd	%esi, %xmm7
+	LONG         $0xef3141c4; BYTE $0xc9         // vpxor	%xmm9, %xmm9, %xmm9
+	VBROADCASTSS CPI0_30<>(SB), Y12              // vbroadcastss	.LCPI0_30(%rip), %ymm12
+	VBROADCASTSS CPI0_32<>(SB), Y11              // vbroadcastss	.LCPI0_32(%rip), %ymm11
+	LONG         $0xf8e28348                     // andq	$-8, %rdx
+	LONG         $0x587de2c4; BYTE $0xff         // vpbroadcastd	%xmm7, %ymm7
+	VBROADCASTSS CPI0_34<>(SB), Y5               // vbroadcastss	.LCPI0_34(%rip), %ymm5
+	VBROADCASTSS CPI0_0<>(SB), Y10               // vbroadcastss	.LCPI0_0(%rip), %ymm10
+	QUAD         $0x000178248411fac5; BYTE $0x00 // vmovss	%xmm0, 376(%rsp)
+	WORD         $0x014c; BYTE $0xf2             // addq	%r14, %rdx
+	LONG         $0x904c8d48; BYTE $0x20         // leaq	32(%rax,%rdx,4), %rcx
+	QUAD         $0x0000014024948b48             // movq	320(%rsp), %rdx
+	LONG         $0x7ef9e1c4; BYTE $0xd0         // vmovq	%xmm2, %rax
+	LONG         $0xc2297cc5                     // vmovaps	%ymm8, %ymm2
+
+BB0_51:
+	LONG         $0x3210fcc5                     // vmovups	(%rdx), %ymm6
+	LONG         $0x20c28348                     // addq	$32, %rdx
+	VBROADCASTSS CPI0_24<>(SB), Y0               // vbroadcastss	.LCPI0_24(%rip), %ymm0
+	LONG         $0xca5cccc5                     // vsubps	%ymm2, %ymm6, %ymm1
+	VMULPS       CPI0_17<>(SB), Y1, Y3           // vmulps	.LCPI0_17(%rip), %ymm1, %ymm3
+	VCMPPS       $30, CPI0_13<>(SB), Y1, Y8      // vcmpps	$30, .LCPI0_13(%rip), %ymm1, %ymm8
+	VCMPPS       $17, CPI0_15<>(SB), Y1, Y6      // vcmpps	$17, .LCPI0_15(%rip), %ymm1, %ymm6
+	LONG         $0x087de3c4; WORD $0x08db       // vroundps	$8, %ymm3, %ymm3
+	VFNMADD231PS CPI0_19<>(SB), Y3, Y1           // vfnmadd231ps	.LCPI0_19(%rip), %ymm3, %ymm1
+	VFNMADD231PS CPI0_21<>(SB), Y3, Y1           // vfnmadd231ps	.LCPI0_21(%rip), %ymm3, %ymm1
+	LONG         $0xdb5bfdc5                     // vcvtps2dq	%ymm3, %ymm3
+	LONG         $0xdffee5c5                     // vpaddd	%ymm7, %ymm3, %ymm3
+	VFMADD213PS  CPI0_25<>(SB), Y1, Y0           // vfmadd213ps	.LCPI0_25(%rip), %ymm1, %ymm0
+	LONG         $0xf372e5c5; BYTE $0x17         // vpslld	$23, %ymm3, %ymm3
+	VFMADD213PS  CPI0_27<>(SB), Y1, Y0           // vfmadd213ps	.LCPI0_27(%rip), %ymm1, %ymm0
+	LONG         $0xf666b5c5                     // vpcmpgtd	%ymm6, %ymm9, %ymm6
+	LONG         $0x981de2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm12, %ymm0
+	LONG         $0x9825e2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm11, %ymm0
+	LONG         $0x9855e2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm5, %ymm0
+	LONG         $0x9855e2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm5, %ymm0
+	LONG         $0xc359fcc5                     // vmulps	%ymm3, %ymm0, %ymm0
+	LONG         $0x4a7dc3c4; WORD $0x80c2       // vblendvps	%ymm8, %ymm10, %ymm0, %ymm0
+	LONG         $0xf055ccc5                     // vandnps	%ymm0, %ymm6, %ymm6
+	LONG         $0x7211fcc5; BYTE $0xe0         // vmovups	%ymm6, -32(%rdx)
+	LONG         $0xe658dcc5                     // vaddps	%ymm6, %ymm4, %ymm4
+	WORD         $0x3948; BYTE $0xd1             // cmpq	%rdx, %rcx
+	JNE          BB0_51
+	QUAD         $0x000178248410fac5; BYTE $0x00 // vmovss	376(%rsp), %xmm0
+	QUAD         $0x000000a024948b48             // movq	160(%rsp), %rdx
+	LONG         $0x6ef9e1c4; BYTE $0xd0         // vmovq	%rax, %xmm2
+
+BB0_19:
+	LONG $0x197de3c4; WORD $0x01e1 // vextractf128	$0x1, %ymm4, %xmm1
+	LONG $0xcc58f0c5               // vaddps	%xmm4, %xmm1, %xmm1
+	LONG $0xd912f0c5               // vmovhlps	%xmm1, %xmm1, %xmm3
+	LONG $0xcb58f0c5               // vaddps	%xmm3, %xmm1, %xmm1
+	LONG $0xd916fac5               // vmovshdup	%xmm1, %xmm3
+	LONG $0xcb58f2c5               // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xd928f8c5               // vmovaps	%xmm1, %xmm3
+	WORD $0x3949; BYTE $0xd7       // cmpq	%rdx, %r15
+	JLE  BB0_52
+
+BB0_84:
+	QUAD   $0x000000e824848b48     // movq	232(%rsp), %rax
+	WORD   $0x014c; BYTE $0xf2     // addq	%r14, %rdx
+	VMOVSS CPI0_0<>(SB), X6        // vmovss	.LCPI0_0(%rip), %xmm6
+	LONG   $0x7ef9e1c4; BYTE $0xd7 // vmovq	%xmm2, %rdi
+	VMOVSS CPI0_38<>(SB), X7       // vmovss	.LCPI0_38(%rip), %xmm7
+	VMOVSD CPI0_39<>(SB), X12      // vmovsd	.LCPI0_39(%rip), %xmm12
+	LONG   $0xd028f8c5             // vmovaps	%xmm0, %xmm2
+	LONG   $0x90148d48             // leaq	(%rax,%rdx,4), %rdx
+	VMOVQ  CPI0_40<>(SB), X11      // vmovq	.LCPI0_40(%rip), %xmm11
+	VMOVQ  CPI0_41<>(SB), X10      // vmovq	.LCPI0_41(%rip), %xmm10
+	VMOVSD CPI0_42<>(SB), X9       // vmovsd	.LCPI0_42(%rip), %xmm9
+	VMOVSD CPI0_43<>(SB), X8       // vmovsd	.LCPI0_43(%rip), %xmm8
+	QUAD   $0x000000b024848b48     // movq	176(%rsp), %rax
+
+BB0_54:
+	LONG        $0x0a10fac5                           // vmovss	(%rdx), %xmm1
+	LONG        $0xc628f8c5                           // vmovaps	%xmm6, %xmm0
+	LONG        $0xca5cf2c5                           // vsubss	%xmm2, %xmm1, %xmm1
+	VCOMISS     CPI0_37<>(SB), X1                     // vcomiss	.LCPI0_37(%rip), %xmm1
+	JA          BB0_53
+	LONG        $0xf92ff8c5                           // vcomiss	%xmm1, %xmm7
+	LONG        $0xc057f8c5                           // vxorps	%xmm0, %xmm0, %xmm0
+	JA          BB0_53
+	LONG        $0xc95af2c5                           // vcvtss2sd	%xmm1, %xmm1, %xmm1
+	LONG        $0x5973c1c4; BYTE $0xec               // vmulsd	%xmm12, %xmm1, %xmm5
+	LONG        $0xc554a1c5                           // vandpd	%xmm5, %xmm11, %xmm0
+	LONG        $0xc056a9c5                           // vorpd	%xmm0, %xmm10, %xmm0
+	LONG        $0xe858d3c5                           // vaddsd	%xmm0, %xmm5, %xmm5
+	VMOVSD      CPI0_55<>(SB), X0                     // vmovsd	.LCPI0_55(%rip), %xmm0
+	LONG        $0x0b51e3c4; WORD $0x03ed             // vroundsd	$3, %xmm5, %xmm5, %xmm5
+	LONG        $0xbdd1c2c4; BYTE $0xc9               // vfnmadd231sd	%xmm9, %xmm5, %xmm1
+	LONG        $0x2cfbe1c4; BYTE $0xf5               // vcvttsd2siq	%xmm5, %rsi
+	LONG        $0xffc68148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rsi
+	LONG        $0xe110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm4
+	VMOVSD      CPI0_44<>(SB), X1                     // vmovsd	.LCPI0_44(%rip), %xmm1
+	LONG        $0x34e6c148                           // salq	$52, %rsi
+	LONG        $0xbdd1c2c4; BYTE $0xe0               // vfnmadd231sd	%xmm8, %xmm5, %xmm4
+	LONG        $0x6ef9e1c4; BYTE $0xee               // vmovq	%rsi, %xmm5
+	VFMADD213SD CPI0_45<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_45(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_46<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_46(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_47<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_47(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_48<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_48(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_49<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_49(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_50<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_50(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_51<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_51(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_52<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_52(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_53<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_53(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_54<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_54(%rip), %xmm4, %xmm1
+	LONG        $0x99f9e2c4; BYTE $0xcc               // vfmadd132sd	%xmm4, %xmm0, %xmm1
+	LONG        $0x99f9e2c4; BYTE $0xcc               // vfmadd132sd	%xmm4, %xmm0, %xmm1
+	LONG        $0xcd59f3c5                           // vmulsd	%xmm5, %xmm1, %xmm1
+	LONG        $0xc15af3c5                           // vcvtsd2ss	%xmm1, %xmm1, %xmm0
+
+BB0_53:
+	LONG   $0x0211fac5             // vmovss	%xmm0, (%rdx)
+	LONG   $0x04c28348             // addq	$4, %rdx
+	LONG   $0xd858e2c5             // vaddss	%xmm0, %xmm3, %xmm3
+	WORD   $0x3948; BYTE $0xd0     // cmpq	%rdx, %rax
+	JNE    BB0_54
+	VMOVSS CPI0_34<>(SB), X6       // vmovss	.LCPI0_34(%rip), %xmm6
+	LONG   $0x6ef9e1c4; BYTE $0xd7 // vmovq	%rdi, %xmm2
+	WORD   $0xd231                 // xorl	%edx, %edx
+	LONG   $0xdb5ecac5             // vdivss	%xmm3, %xmm6, %xmm3
+	LONG   $0x187de2c4; BYTE $0xcb // vbroadcastss	%xmm3, %ymm1
+	LONG   $0x07ff8349             // cmpq	$7, %r15
+	JLE    BB0_58
+
+BB0_83:
+	QUAD $0x0000009024948b48     // movq	144(%rsp), %rdx
+	QUAD $0x000000e824848b48     // movq	232(%rsp), %rax
+	LONG $0xf8e28348             // andq	$-8, %rdx
+	WORD $0x014c; BYTE $0xf2     // addq	%r14, %rdx
+	LONG $0x904c8d48; BYTE $0x20 // leaq	32(%rax,%rdx,4), %rcx
+	QUAD $0x0000014024948b48     // movq	320(%rsp), %rdx
+
+BB0_57:
+	LONG $0x0259f4c5             // vmulps	(%rdx), %ymm1, %ymm0
+	LONG $0x20c28348             // addq	$32, %rdx
+	LONG $0x4211fcc5; BYTE $0xe0 // vmovups	%ymm0, -32(%rdx)
+	WORD $0x3948; BYTE $0xd1     // cmpq	%rdx, %rcx
+	JNE  BB0_57
+	QUAD $0x000000a024948b48     // movq	160(%rsp), %rdx
+
+BB0_56:
+	WORD $0x3949; BYTE $0xd7 // cmpq	%rdx, %r15
+	JLE  BB0_63
+
+BB0_58:
+	WORD $0x894c; BYTE $0xf9 // movq	%r15, %rcx
+	WORD $0x8948; BYTE $0xd6 // movq	%rdx, %rsi
+	WORD $0x2948; BYTE $0xd1 // subq	%rdx, %rcx
+	LONG $0xff798d48         // leaq	-1(%rcx), %rdi
+	LONG $0x06ff8348         // cmpq	$6, %rdi
+	JBE  BB0_99
+	QUAD $0x000000e824848b48 // movq	232(%rsp), %rax
+	LONG $0x163c8d49         // leaq	(%r14,%rdx), %rdi
+	LONG $0xb83c8d48         // leaq	(%rax,%rdi,4), %rdi
+	LONG $0x0f59f4c5         // vmulps	(%rdi), %ymm1, %ymm1
+	LONG $0x0f11fcc5         // vmovups	%ymm1, (%rdi)
+	WORD $0x8948; BYTE $0xcf // movq	%rcx, %rdi
+	LONG $0xf8e78348         // andq	$-8, %rdi
+	WORD $0x0148; BYTE $0xfa // addq	%rdi, %rdx
+	WORD $0xc1f6; BYTE $0x07 // testb	$7, %cl
+	JE   BB0_63
+
+BB0_61:
+	WORD $0x2948; BYTE $0xf9     // subq	%rdi, %rcx
+	LONG $0xff418d4c             // leaq	-1(%rcx), %r8
+	LONG $0x02f88349             // cmpq	$2, %r8
+	JBE  BB0_64
+	WORD $0x014c; BYTE $0xf6     // addq	%r14, %rsi
+	QUAD $0x000000e824848b48     // movq	232(%rsp), %rax
+	LONG $0xc3c6e0c5; BYTE $0x00 // vshufps	$0, %xmm3, %xmm3, %xmm0
+	WORD $0x0148; BYTE $0xfe     // addq	%rdi, %rsi
+	LONG $0xb0348d48             // leaq	(%rax,%rsi,4), %rsi
+	LONG $0x0659f8c5             // vmulps	(%rsi), %xmm0, %xmm0
+	LONG $0x0611f8c5             // vmovups	%xmm0, (%rsi)
+	WORD $0x8948; BYTE $0xce     // movq	%rcx, %rsi
+	LONG $0xfce68348             // andq	$-4, %rsi
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	WORD $0xe183; BYTE $0x03     // andl	$3, %ecx
+	JE   BB0_63
+
+BB0_64:
+	QUAD $0x000000e824848b48 // movq	232(%rsp), %rax
+	LONG $0x160c8d49         // leaq	(%r14,%rdx), %rcx
+	LONG $0x880c8d48         // leaq	(%rax,%rcx,4), %rcx
+	LONG $0x0159e2c5         // vmulss	(%rcx), %xmm3, %xmm0
+	LONG $0x0111fac5         // vmovss	%xmm0, (%rcx)
+	LONG $0x014a8d48         // leaq	1(%rdx), %rcx
+	WORD $0x394c; BYTE $0xf9 // cmpq	%r15, %rcx
+	JGE  BB0_63
+	WORD $0x014c; BYTE $0xf1 // addq	%r14, %rcx
+	LONG $0x02c28348         // addq	$2, %rdx
+	LONG $0x880c8d48         // leaq	(%rax,%rcx,4), %rcx
+	LONG $0x0159e2c5         // vmulss	(%rcx), %xmm3, %xmm0
+	LONG $0x0111fac5         // vmovss	%xmm0, (%rcx)
+	WORD $0x394c; BYTE $0xfa // cmpq	%r15, %rdx
+	JGE  BB0_63
+	WORD $0x014c; BYTE $0xf2 // addq	%r14, %rdx
+	LONG $0x90148d48         // leaq	(%rax,%rdx,4), %rdx
+	LONG $0x1a59e2c5         // vmulss	(%rdx), %xmm3, %xmm3
+	LONG $0x1a11fac5         // vmovss	%xmm3, (%rdx)
+
+BB0_63:
+	WORD $0xff31                         // xorl	%edi, %edi
+	WORD $0xf631                         // xorl	%esi, %esi
+	LONG $0x000008ba; BYTE $0x00         // movl	$8, %edx
+	QUAD $0x000000e024bc8348; BYTE $0x1f // cmpq	$31, 224(%rsp)
+	QUAD $0x000000d024ac8b4c             // movq	208(%rsp), %r13
+	JLE  BB0_60
+	QUAD $0x0000017824b4894c             // movq	%r14, 376(%rsp)
+	QUAD $0x000000b024948b4c             // movq	176(%rsp), %r10
+	QUAD $0x00000170249c894c             // movq	%r11, 368(%rsp)
+	QUAD $0x000000f024b48b4c             // movq	240(%rsp), %r14
+	QUAD $0x0000015824a4894c             // movq	%r12, 344(%rsp)
+	QUAD $0x00000140249c8b4c             // movq	320(%rsp), %r11
+	LONG $0x24648b4c; BYTE $0x50         // movq	80(%rsp), %r12
+
+BB0_59:
+	WORD $0x854d; BYTE $0xff // testq	%r15, %r15
+	JLE  BB0_165
+	LONG $0xed57d0c5         // vxorps	%xmm5, %xmm5, %xmm5
+	LONG $0x204f8d4c         // leaq	32(%rdi), %r9
+	LONG $0x40478d4c         // leaq	64(%rdi), %r8
+	WORD $0x894c; BYTE $0xd8 // movq	%r11, %rax
+	LONG $0x60778d48         // leaq	96(%rdi), %rsi
+	LONG $0x3e148d49         // leaq	(%r14,%rdi), %rdx
+	LONG $0xe528fcc5         // vmovaps	%ymm5, %ymm4
+	LONG $0xdd28fcc5         // vmovaps	%ymm5, %ymm3
+	LONG $0xcd28fcc5         // vmovaps	%ymm5, %ymm1
+
+BB0_66:
+	WORD $0x8948; BYTE $0xd1       // movq	%rdx, %rcx
+	LONG $0x187de2c4; BYTE $0x00   // vbroadcastss	(%rax), %ymm0
+	LONG $0x04c08348               // addq	$4, %rax
+	WORD $0x2948; BYTE $0xf9       // subq	%rdi, %rcx
+	LONG $0xb87de2c4; BYTE $0x0a   // vfmadd231ps	(%rdx), %ymm0, %ymm1
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0xb87da2c4; WORD $0x091c // vfmadd231ps	(%rcx,%r9), %ymm0, %ymm3
+	LONG $0xb87da2c4; WORD $0x0124 // vfmadd231ps	(%rcx,%r8), %ymm0, %ymm4
+	LONG $0xb87de2c4; WORD $0x312c // vfmadd231ps	(%rcx,%rsi), %ymm0, %ymm5
+	WORD $0x3949; BYTE $0xc2       // cmpq	%rax, %r10
+	JNE  BB0_66
+
+BB0_68:
+	LONG $0x80ef8348               // subq	$-128, %rdi
+	LONG $0x117cc1c4; WORD $0x004d // vmovups	%ymm1, 0(%r13)
+	LONG $0x80ed8349               // subq	$-128, %r13
+	LONG $0x117cc1c4; WORD $0xa05d // vmovups	%ymm3, -96(%r13)
+	LONG $0x117cc1c4; WORD $0xc065 // vmovups	%ymm4, -64(%r13)
+	LONG $0x117cc1c4; WORD $0xe06d // vmovups	%ymm5, -32(%r13)
+	WORD $0x3949; BYTE $0xfc       // cmpq	%rdi, %r12
+	JNE  BB0_59
+	QUAD $0x0000017824b48b4c       // movq	376(%rsp), %r14
+	QUAD $0x00000170249c8b4c       // movq	368(%rsp), %r11
+	QUAD $0x0000015824a48b4c       // movq	344(%rsp), %r12
+	LONG $0x24548b48; BYTE $0x30   // movq	48(%rsp), %rdx
+	LONG $0x24748b48; BYTE $0x60   // movq	96(%rsp), %rsi
+
+BB0_60:
+	QUAD $0x000000e024943948     // cmpq	%rdx, 224(%rsp)
+	JL   BB0_69
+	QUAD $0x000000e824848b48     // movq	232(%rsp), %rax
+	QUAD $0x000000b0248c8b4c     // movq	176(%rsp), %r9
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	LONG $0x246c8b4c; BYTE $0x20 // movq	32(%rsp), %r13
+	LONG $0xb0048d4a             // leaq	(%rax,%r14,4), %rax
+
+BB0_70:
+	WORD $0x8949; BYTE $0xf2 // movq	%rsi, %r10
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x894c; BYTE $0xc6 // movq	%r8, %rsi
+	WORD $0x854d; BYTE $0xff // testq	%r15, %r15
+	JLE  BB0_73
+	QUAD $0x000000f024bc8b48 // movq	240(%rsp), %rdi
+	WORD $0x8948; BYTE $0xc1 // movq	%rax, %rcx
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x973c8d4a         // leaq	(%rdi,%r10,4), %rdi
+
+BB0_71:
+	LONG $0x187de2c4; BYTE $0x09 // vbroadcastss	(%rcx), %ymm1
+	LONG $0x04c18348             // addq	$4, %rcx
+	LONG $0xb875e2c4; BYTE $0x07 // vfmadd231ps	(%rdi), %ymm1, %ymm0
+	WORD $0x0148; BYTE $0xdf     // addq	%rbx, %rdi
+	WORD $0x3949; BYTE $0xc9     // cmpq	%rcx, %r9
+	JNE  BB0_71
+
+BB0_73:
+	QUAD $0x0000016824bc8b48                   // movq	360(%rsp), %rdi
+	LONG $0x08c08349                           // addq	$8, %r8
+	WORD $0x0149; BYTE $0xfa                   // addq	%rdi, %r10
+	LONG $0x117c81c4; WORD $0x9544; BYTE $0x00 // vmovups	%ymm0, 0(%r13,%r10,4)
+	QUAD $0x000000e02484394c                   // cmpq	%r8, 224(%rsp)
+	JGE  BB0_70
+	QUAD $0x000000e024b48b48                   // movq	224(%rsp), %rsi
+	WORD $0x2948; BYTE $0xd6                   // subq	%rdx, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xd6                   // addq	%rdx, %rsi
+
+BB0_69:
+	QUAD $0x000000e024848b48     // movq	224(%rsp), %rax
+	WORD $0x3948; BYTE $0xf0     // cmpq	%rsi, %rax
+	JLE  BB0_74
+	QUAD $0x000000f024bc8b48     // movq	240(%rsp), %rdi
+	LONG $0x24548b48; BYTE $0x10 // movq	16(%rsp), %rdx
+	QUAD $0x0000015824a4894c     // movq	%r12, 344(%rsp)
+	QUAD $0x000000e824a48b4c     // movq	232(%rsp), %r12
+	QUAD $0x00000170249c894c     // movq	%r11, 368(%rsp)
+	WORD $0x8949; BYTE $0xc3     // movq	%rax, %r11
+	LONG $0xb70c8d4c             // leaq	(%rdi,%rsi,4), %r9
+	QUAD $0x0000014024bc8b48     // movq	320(%rsp), %rdi
+	LONG $0x170c8d48             // leaq	(%rdi,%rdx), %rcx
+	QUAD $0x000000d824bc8b48     // movq	216(%rsp), %rdi
+	QUAD $0x0000017824bc8948     // movq	%rdi, 376(%rsp)
+	LONG $0x247c8b48; BYTE $0x08 // movq	8(%rsp), %rdi
+
+BB0_75:
+	LONG $0xc957f0c5                     // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0x854d; BYTE $0xff             // testq	%r15, %r15
+	JLE  BB0_80
+	QUAD $0x000000c024bc8348; BYTE $0x02 // cmpq	$2, 192(%rsp)
+	JBE  BB0_101
+	QUAD $0x0000014024848b4c             // movq	320(%rsp), %r8
+	QUAD $0x0000017824948b48             // movq	376(%rsp), %rdx
+	WORD $0x894c; BYTE $0xc8             // movq	%r9, %rax
+	LONG $0xc957f0c5                     // vxorps	%xmm1, %xmm1, %xmm1
+
+BB0_77:
+	LONG $0x0410fac5; BYTE $0x58               // vmovss	(%rax,%rbx,2), %xmm0
+	LONG $0x2179e3c4; WORD $0x381c; BYTE $0x10 // vinsertps	$0x10, (%rax,%rdi), %xmm0, %xmm3
+	LONG $0x10c08349                           // addq	$16, %r8
+	LONG $0x0010fac5                           // vmovss	(%rax), %xmm0
+	LONG $0x2179e3c4; WORD $0x1804; BYTE $0x10 // vinsertps	$0x10, (%rax,%rbx), %xmm0, %xmm0
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0xc316f8c5                           // vmovlhps	%xmm3, %xmm0, %xmm0
+	LONG $0x5978c1c4; WORD $0xf040             // vmulps	-16(%r8), %xmm0, %xmm0
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xd8c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm3
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0xc815f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm1
+	LONG $0xc0c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm0
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JNE  BB0_77
+	QUAD $0x000000b824848b48                   // movq	184(%rsp), %rax
+	QUAD $0x0000017824948948                   // movq	%rdx, 376(%rsp)
+	WORD $0x3949; BYTE $0xc7                   // cmpq	%rax, %r15
+	JE   BB0_80
+
+BB0_76:
+	WORD $0x894d; BYTE $0xd8       // movq	%r11, %r8
+	QUAD $0x000000f024948b48       // movq	240(%rsp), %rdx
+	LONG $0x06148d4d               // leaq	(%r14,%rax), %r10
+	LONG $0xc0af0f4c               // imulq	%rax, %r8
+	LONG $0x302c8d4d               // leaq	(%r8,%rsi), %r13
+	LONG $0x107aa1c4; WORD $0xaa34 // vmovss	(%rdx,%r13,4), %xmm6
+	LONG $0xb94982c4; WORD $0x940c // vfmadd231ss	(%r12,%r10,4), %xmm6, %xmm1
+	LONG $0x01508d4c               // leaq	1(%rax), %r10
+	WORD $0x394d; BYTE $0xfa       // cmpq	%r15, %r10
+	JGE  BB0_80
+	WORD $0x014d; BYTE $0xd8       // addq	%r11, %r8
+	WORD $0x014d; BYTE $0xf2       // addq	%r14, %r10
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x302c8d4d               // leaq	(%r8,%rsi), %r13
+	LONG $0x107aa1c4; WORD $0xaa3c // vmovss	(%rdx,%r13,4), %xmm7
+	LONG $0xb94182c4; WORD $0x940c // vfmadd231ss	(%r12,%r10,4), %xmm7, %xmm1
+	WORD $0x394c; BYTE $0xf8       // cmpq	%r15, %rax
+	JGE  BB0_80
+	LONG $0x33148d4d               // leaq	(%r11,%rsi), %r10
+	WORD $0x014c; BYTE $0xf0       // addq	%r14, %rax
+	WORD $0x014d; BYTE $0xc2       // addq	%r8, %r10
+	LONG $0x107aa1c4; WORD $0x9234 // vmovss	(%rdx,%r10,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x840c // vfmadd231ss	(%r12,%rax,4), %xmm6, %xmm1
+
+BB0_80:
+	QUAD $0x000000d024848b48     // movq	208(%rsp), %rax
+	LONG $0x04c18349             // addq	$4, %r9
+	LONG $0x0c11fac5; BYTE $0xb0 // vmovss	%xmm1, (%rax,%rsi,4)
+	LONG $0x01c68348             // addq	$1, %rsi
+	WORD $0x3949; BYTE $0xf3     // cmpq	%rsi, %r11
+	JNE  BB0_75
+	QUAD $0x00000170249c8b4c     // movq	368(%rsp), %r11
+	QUAD $0x0000015824a48b4c     // movq	344(%rsp), %r12
+
+BB0_74:
+	QUAD $0x000000e024bc8b48             // movq	224(%rsp), %rdi
+	QUAD $0x000000d0249c0148             // addq	%rbx, 208(%rsp)
+	WORD $0x014d; BYTE $0xfe             // addq	%r15, %r14
+	WORD $0x0149; BYTE $0xdb             // addq	%rbx, %r11
+	QUAD $0x000000a824848348; BYTE $0x01 // addq	$1, 168(%rsp)
+	QUAD $0x000000a824848b48             // movq	168(%rsp), %rax
+	QUAD $0x0000016824bc0148             // addq	%rdi, 360(%rsp)
+	LONG $0x247c8b48; BYTE $0x70         // movq	112(%rsp), %rdi
+	QUAD $0x0000014024bc0148             // addq	%rdi, 320(%rsp)
+	QUAD $0x000000b024bc0148             // addq	%rdi, 176(%rsp)
+	LONG $0x24443948; BYTE $0x78         // cmpq	%rax, 120(%rsp)
+	JG   BB0_81
+	WORD $0xf8c5; BYTE $0x77             // vzeroupper
+
+BB0_160:
+	LONG $0x70a58d48; WORD $0xfffe; BYTE $0xff // leaq	-400(%rbp), %rsp
+	RET
+
+BB0_165:
+	LONG $0xed57d0c5 // vxorps	%xmm5, %xmm5, %xmm5
+	LONG $0xe528fcc5 // vmovaps	%ymm5, %ymm4
+	LONG $0xdd28fcc5 // vmovaps	%ymm5, %ymm3
+	LONG $0xcd28fcc5 // vmovaps	%ymm5, %ymm1
+	JMP  BB0_68
+
+BB0_87:
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xcb28fcc5 // vmovaps	%ymm3, %ymm1
+	LONG $0xe328fcc5 // vmovaps	%ymm3, %ymm4
+	LONG $0xeb28fcc5 // vmovaps	%ymm3, %ymm5
+	JMP  BB0_5
+
+BB0_88:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_8
+
+BB0_101:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	JMP  BB0_76
+
+BB0_164:
+	LONG $0x07ff8349 // cmpq	$7, %r15
+	JLE  BB0_36
+
+BB0_34:
+	QUAD $0x000000a024b48b48 // movq	160(%rsp), %rsi
+	QUAD $0x0000014024948b48 // movq	320(%rsp), %rdx
+	QUAD $0x000000e824848b48 // movq	232(%rsp), %rax
+	LONG $0x360c8d49         // leaq	(%r14,%rsi), %rcx
+	QUAD $0x0000009824b48b48 // movq	152(%rsp), %rsi
+	WORD $0x2948; BYTE $0xc2 // subq	%rax, %rdx
+	LONG $0x02e1c148         // salq	$2, %rcx
+
+BB0_37:
+	LONG $0x3c10fcc5; BYTE $0x10 // vmovups	(%rax,%rdx), %ymm7
+	LONG $0x0458c4c5; BYTE $0x16 // vaddps	(%rsi,%rdx), %ymm7, %ymm0
+	LONG $0x0411fcc5; BYTE $0x10 // vmovups	%ymm0, (%rax,%rdx)
+	LONG $0x20c28348             // addq	$32, %rdx
+	WORD $0x3948; BYTE $0xd1     // cmpq	%rdx, %rcx
+	JNE  BB0_37
+	QUAD $0x000000a024848b48     // movq	160(%rsp), %rax
+	WORD $0x3949; BYTE $0xc7     // cmpq	%rax, %r15
+	JLE  BB0_154
+	WORD $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+
+BB0_39:
+	WORD $0x894c; BYTE $0xf9     // movq	%r15, %rcx
+	LONG $0x16348d49             // leaq	(%r14,%rdx), %rsi
+	WORD $0x2948; BYTE $0xd1     // subq	%rdx, %rcx
+	LONG $0xff518d4c             // leaq	-1(%rcx), %r10
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_41
+	WORD $0x394c; BYTE $0xfa     // cmpq	%r15, %rdx
+	JGE  BB0_41
+	QUAD $0x000000e824848b48     // movq	232(%rsp), %rax
+	QUAD $0x00000000b53c8d48     // leaq	0(,%rsi,4), %rdi
+	QUAD $0x0000009824ac8b4c     // movq	152(%rsp), %r13
+	LONG $0x38048d4c             // leaq	(%rax,%rdi), %r8
+	LONG $0x3d4c8d4d; BYTE $0x04 // leaq	4(%r13,%rdi), %r9
+	WORD $0x894c; BYTE $0xc0     // movq	%r8, %rax
+	WORD $0x294c; BYTE $0xc8     // subq	%r9, %rax
+	LONG $0x18f88348             // cmpq	$24, %rax
+	JA   BB0_166
+
+BB0_41:
+	QUAD $0x000000e824848b48     // movq	232(%rsp), %rax
+	QUAD $0x0000009824bc8b48     // movq	152(%rsp), %rdi
+	LONG $0xb00c8d48             // leaq	(%rax,%rsi,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0xb7 // vaddss	(%rdi,%rsi,4), %xmm0, %xmm0
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	LONG $0x014a8d48             // leaq	1(%rdx), %rcx
+	WORD $0x3949; BYTE $0xcf     // cmpq	%rcx, %r15
+	JLE  BB0_22
+	WORD $0x014c; BYTE $0xf1     // addq	%r14, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0610fac5             // vmovss	(%rsi), %xmm0
+	LONG $0x0458fac5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm0, %xmm0
+	LONG $0x024a8d48             // leaq	2(%rdx), %rcx
+	LONG $0x0611fac5             // vmovss	%xmm0, (%rsi)
+	WORD $0x3949; BYTE $0xcf     // cmpq	%rcx, %r15
+	JLE  BB0_154
+	WORD $0x014c; BYTE $0xf1     // addq	%r14, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0610fac5             // vmovss	(%rsi), %xmm0
+	LONG $0x0458fac5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm0, %xmm0
+	LONG $0x034a8d48             // leaq	3(%rdx), %rcx
+	LONG $0x0611fac5             // vmovss	%xmm0, (%rsi)
+	WORD $0x3949; BYTE $0xcf     // cmpq	%rcx, %r15
+	JLE  BB0_154
+	WORD $0x014c; BYTE $0xf1     // addq	%r14, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0610fac5             // vmovss	(%rsi), %xmm0
+	LONG $0x0458fac5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm0, %xmm0
+	LONG $0x044a8d48             // leaq	4(%rdx), %rcx
+	LONG $0x0611fac5             // vmovss	%xmm0, (%rsi)
+	WORD $0x3949; BYTE $0xcf     // cmpq	%rcx, %r15
+	JLE  BB0_154
+	WORD $0x014c; BYTE $0xf1     // addq	%r14, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0610fac5             // vmovss	(%rsi), %xmm0
+	LONG $0x0458fac5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm0, %xmm0
+	LONG $0x054a8d48             // leaq	5(%rdx), %rcx
+	LONG $0x0611fac5             // vmovss	%xmm0, (%rsi)
+	WORD $0x3949; BYTE $0xcf     // cmpq	%rcx, %r15
+	JLE  BB0_154
+	WORD $0x014c; BYTE $0xf1     // addq	%r14, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0610fac5             // vmovss	(%rsi), %xmm0
+	LONG $0x0458fac5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm0, %xmm0
+	LONG $0x064a8d48             // leaq	6(%rdx), %rcx
+	LONG $0x0611fac5             // vmovss	%xmm0, (%rsi)
+	WORD $0x3949; BYTE $0xcf     // cmpq	%rcx, %r15
+	JLE  BB0_154
+	WORD $0x014c; BYTE $0xf1     // addq	%r14, %rcx
+	LONG $0x07c28348             // addq	$7, %rdx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0610fac5             // vmovss	(%rsi), %xmm0
+	LONG $0x0458fac5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm0, %xmm0
+	LONG $0x0611fac5             // vmovss	%xmm0, (%rsi)
+	WORD $0x394c; BYTE $0xfa     // cmpq	%r15, %rdx
+	JGE  BB0_154
+	WORD $0x014c; BYTE $0xf2     // addq	%r14, %rdx
+	LONG $0x900c8d48             // leaq	(%rax,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x97 // vaddss	(%rdi,%rdx,4), %xmm0, %xmm0
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+
+BB0_154:
+	QUAD $0x0000014024848b48 // movq	320(%rsp), %rax
+	LONG $0x0010fac5         // vmovss	(%rax), %xmm0
+	JMP  BB0_18
+
+BB0_91:
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+	JMP  BB0_23
+
+BB0_92:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_26
+
+BB0_163:
+	QUAD $0x0000009824bc8348; BYTE $0x00 // cmpq	$0, 152(%rsp)
+	JE   BB0_154
+	LONG $0x07ff8349                     // cmpq	$7, %r15
+	JG   BB0_34
+	WORD $0xd231                         // xorl	%edx, %edx
+	JMP  BB0_39
+
+BB0_166:
+	WORD $0x394c; BYTE $0xfa                   // cmpq	%r15, %rdx
+	LONG $0x000001b8; BYTE $0x00               // movl	$1, %eax
+	LONG $0xc84d0f48                           // cmovge	%rax, %rcx
+	LONG $0x06fa8349                           // cmpq	$6, %r10
+	JBE  BB0_93
+	LONG $0x107cc1c4; WORD $0x3d7c; BYTE $0x00 // vmovups	0(%r13,%rdi), %ymm7
+	LONG $0x5844c1c4; BYTE $0x00               // vaddps	(%r8), %ymm7, %ymm0
+	WORD $0x8948; BYTE $0xcf                   // movq	%rcx, %rdi
+	LONG $0xf8e78348                           // andq	$-8, %rdi
+	WORD $0x0148; BYTE $0xfa                   // addq	%rdi, %rdx
+	LONG $0x117cc1c4; BYTE $0x00               // vmovups	%ymm0, (%r8)
+	WORD $0xc1f6; BYTE $0x07                   // testb	$7, %cl
+	JE   BB0_22
+
+BB0_42:
+	WORD $0x2948; BYTE $0xf9     // subq	%rdi, %rcx
+	LONG $0xff418d4c             // leaq	-1(%rcx), %r8
+	LONG $0x02f88349             // cmpq	$2, %r8
+	JBE  BB0_44
+	QUAD $0x000000e824848b48     // movq	232(%rsp), %rax
+	WORD $0x0148; BYTE $0xf7     // addq	%rsi, %rdi
+	LONG $0xb8348d48             // leaq	(%rax,%rdi,4), %rsi
+	QUAD $0x0000009824848b48     // movq	152(%rsp), %rax
+	LONG $0x3c10f8c5; BYTE $0xb8 // vmovups	(%rax,%rdi,4), %xmm7
+	LONG $0x0658c0c5             // vaddps	(%rsi), %xmm7, %xmm0
+	LONG $0x0611f8c5             // vmovups	%xmm0, (%rsi)
+	WORD $0x8948; BYTE $0xce     // movq	%rcx, %rsi
+	LONG $0xfce68348             // andq	$-4, %rsi
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	WORD $0xe183; BYTE $0x03     // andl	$3, %ecx
+	JE   BB0_22
+
+BB0_44:
+	QUAD $0x000000e824848b48     // movq	232(%rsp), %rax
+	LONG $0x16348d49             // leaq	(%r14,%rdx), %rsi
+	QUAD $0x0000009824bc8b48     // movq	152(%rsp), %rdi
+	LONG $0xb00c8d48             // leaq	(%rax,%rsi,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0xb7 // vaddss	(%rdi,%rsi,4), %xmm0, %xmm0
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	LONG $0x014a8d48             // leaq	1(%rdx), %rcx
+	WORD $0x3949; BYTE $0xcf     // cmpq	%rcx, %r15
+	JLE  BB0_22
+	WORD $0x014c; BYTE $0xf1     // addq	%r14, %rcx
+	LONG $0x02c28348             // addq	$2, %rdx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0610fac5             // vmovss	(%rsi), %xmm0
+	LONG $0x0458fac5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm0, %xmm0
+	LONG $0x0611fac5             // vmovss	%xmm0, (%rsi)
+	WORD $0x3949; BYTE $0xd7     // cmpq	%rdx, %r15
+	JLE  BB0_22
+	WORD $0x014c; BYTE $0xf2     // addq	%r14, %rdx
+	LONG $0x900c8d48             // leaq	(%rax,%rdx,4), %rcx
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0458fac5; BYTE $0x97 // vaddss	(%rdi,%rdx,4), %xmm0, %xmm0
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	JMP  BB0_22
+
+BB0_4:
+	WORD $0x3145; BYTE $0xed // xorl	%r13d, %r13d
+	WORD $0x854d; BYTE $0xff // testq	%r15, %r15
+	JG   BB0_16
+
+BB0_17:
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+
+BB0_52:
+	VMOVSS CPI0_34<>(SB), X6       // vmovss	.LCPI0_34(%rip), %xmm6
+	LONG   $0xdb5ecac5             // vdivss	%xmm3, %xmm6, %xmm3
+	LONG   $0x187de2c4; BYTE $0xcb // vbroadcastss	%xmm3, %ymm1
+	LONG   $0x07ff8349             // cmpq	$7, %r15
+	JG     BB0_83
+	WORD   $0xd231                 // xorl	%edx, %edx
+	JMP    BB0_56
+
+BB0_99:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_61
+
+BB0_36:
+	WORD $0x854d; BYTE $0xff // testq	%r15, %r15
+	JLE  BB0_17
+	WORD $0xd231             // xorl	%edx, %edx
+	JMP  BB0_39
+
+BB0_50:
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+	WORD $0xd231     // xorl	%edx, %edx
+	JMP  BB0_84
+
+BB0_93:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_42
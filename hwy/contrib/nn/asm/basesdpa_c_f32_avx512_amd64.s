@@ -0,0 +1,2025 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basesdpa_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x7f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_11<>+0(SB)/4, $0xb95e8083
+GLOBL CPI0_11<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_13<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_13<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_15<>+0(SB)/4, $0x3c088889
+GLOBL CPI0_15<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_17<>+0(SB)/4, $0x3d2aaaab
+GLOBL CPI0_17<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_19<>+0(SB)/4, $0x3e2aaaab
+GLOBL CPI0_19<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_21<>+0(SB)/4, $0x3f000000
+GLOBL CPI0_21<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_23<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_23<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_27<>+0(SB)/4, $0x652b82fe
+DATA CPI0_27<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_27<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_3<>+0(SB)/4, $0x42b17218
+GLOBL CPI0_3<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_33<>+0(SB)/4, $0xfee00000
+DATA CPI0_33<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_33<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_35<>+0(SB)/4, $0x35793c6c
+DATA CPI0_35<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_35<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_37<>+0(SB)/4, $0xeff8d898
+DATA CPI0_37<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_37<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_39<>+0(SB)/4, $0x67f544e4
+DATA CPI0_39<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_39<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_41<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_41<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_41<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_43<>+0(SB)/4, $0xa556c734
+DATA CPI0_43<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_43<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_45<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_45<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_45<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_47<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_47<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_47<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_49<>+0(SB)/4, $0x16c16c17
+DATA CPI0_49<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_49<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_5<>+0(SB)/4, $0xc2aeac50
+GLOBL CPI0_5<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_51<>+0(SB)/4, $0x11111111
+DATA CPI0_51<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_51<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_53<>+0(SB)/4, $0x55555555
+DATA CPI0_53<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_53<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_55<>+0(SB)/4, $0x55555555
+DATA CPI0_55<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_55<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_57<>+0(SB)/4, $0x00000000
+DATA CPI0_57<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_57<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_59<>+0(SB)/4, $0x00000000
+DATA CPI0_59<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_59<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_62<>+0(SB)/4, $0xc4314000
+GLOBL CPI0_62<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_64<>+0(SB)/4, $0x44314000
+GLOBL CPI0_64<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_7<>+0(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_7<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_86<>+0(SB)/4, $0x00000000
+DATA CPI0_86<>+4(SB)/4, $0x80000000
+DATA CPI0_86<>+8(SB)/4, $0x00000000
+DATA CPI0_86<>+12(SB)/4, $0x00000000
+GLOBL CPI0_86<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_87<>+0(SB)/4, $0xffffffff
+DATA CPI0_87<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_87<>+8(SB)/4, $0x00000000
+DATA CPI0_87<>+12(SB)/4, $0x00000000
+GLOBL CPI0_87<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_9<>+0(SB)/4, $0x3f318000
+GLOBL CPI0_9<>(SB), (RODATA|NOPTR), $4
+
+TEXT ·sdpa_c_f32_avx512(SB), $528-128
+	MOVQ   q+0(FP), DI
+	MOVQ   k+8(FP), SI
+	MOVQ   v+16(FP), DX
+	MOVQ   mask+24(FP), CX
+	MOVQ   scores+32(FP), R8
+	MOVQ   output+40(FP), R9
+	MOVQ   pseqLen+48(FP), R11
+	MOVQ   R11, 448(SP)
+	MOVQ   pkvLen+56(FP), R11
+	MOVQ   R11, 456(SP)
+	MOVQ   pheadDim+64(FP), R11
+	MOVQ   R11, 464(SP)
+	MOVQ   pscale+72(FP), R11
+	MOVQ   R11, 472(SP)
+	MOVQ   plen_q+80(FP), R11
+	MOVQ   R11, 480(SP)
+	MOVQ   plen_k+88(FP), R11
+	MOVQ   R11, 488(SP)
+	MOVQ   plen_v+96(FP), R11
+	MOVQ   R11, 496(SP)
+	MOVQ   plen_mask+104(FP), R11
+	MOVQ   R11, 504(SP)
+	MOVQ   plen_scores+112(FP), R11
+	MOVQ   R11, 512(SP)
+	MOVQ   plen_output+120(FP), R11
+	MOVQ   R11, 520(SP)
+	QUAD   $0x000001b024ac8d48                   // leaq	432(%rsp), %rbp
+	LONG   $0x24648d48; BYTE $0x40               // leaq	64(%rsp), %rsp
+	LONG   $0xc0e48348                           // andq	$-64, %rsp
+	LONG   $0x20458b48                           // movq	32(%rbp), %rax
+	QUAD   $0x000000e824948948                   // movq	%rdx, 232(%rsp)
+	WORD   $0x8b4c; BYTE $0x30                   // movq	(%rax), %r14
+	LONG   $0x18458b48                           // movq	24(%rbp), %rax
+	QUAD   $0x0000016824bc8948                   // movq	%rdi, 360(%rsp)
+	QUAD   $0x000000c8248c8948                   // movq	%rcx, 200(%rsp)
+	WORD   $0x8b4c; BYTE $0x28                   // movq	(%rax), %r13
+	LONG   $0x10458b48                           // movq	16(%rbp), %rax
+	QUAD   $0x000001182484894c                   // movq	%r8, 280(%rsp)
+	QUAD   $0x000000d8248c894c                   // movq	%r9, 216(%rsp)
+	WORD   $0x8b48; BYTE $0x00                   // movq	(%rax), %rax
+	WORD   $0x854d; BYTE $0xed                   // testq	%r13, %r13
+	WORD   $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	QUAD   $0x000000a024848948                   // movq	%rax, 160(%rsp)
+	WORD   $0x940f; BYTE $0xc0                   // sete	%al
+	WORD   $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	WORD   $0x9e0f; BYTE $0xc2                   // setle	%dl
+	WORD   $0xd008                               // orb	%dl, %al
+	JNE    BB0_180
+	WORD   $0x854d; BYTE $0xf6                   // testq	%r14, %r14
+	JE     BB0_180
+	LONG   $0x28458b48                           // movq	40(%rbp), %rax
+	LONG   $0xf0568d49                           // leaq	-16(%r14), %rdx
+	WORD   $0x8949; BYTE $0xfb                   // movq	%rdi, %r11
+	LONG   $0x363c8d4b                           // leaq	(%r14,%r14), %rdi
+	QUAD   $0x00000000b5248d4e                   // leaq	0(,%r14,4), %r12
+	LONG   $0xf0e28348                           // andq	$-16, %rdx
+	WORD   $0x8948; BYTE $0xf3                   // movq	%rsi, %rbx
+	QUAD   $0x0000008824bc8948                   // movq	%rdi, 136(%rsp)
+	LONG   $0x3010fac5                           // vmovss	(%rax), %xmm6
+	WORD   $0x014c; BYTE $0xf7                   // addq	%r14, %rdi
+	QUAD   $0x00000000ad048d4a                   // leaq	0(,%r13,4), %rax
+	QUAD   $0x00000110248c894c                   // movq	%r9, 272(%rsp)
+	QUAD   $0x0000009824848948                   // movq	%rax, 152(%rsp)
+	WORD   $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+	VMOVSS CPI0_0<>(SB), X0                      // vmovss	.LCPI0_0(%rip), %xmm0
+	WORD   $0x894d; BYTE $0xc7                   // movq	%r8, %r15
+	QUAD   $0x000000e024848948                   // movq	%rax, 224(%rsp)
+	WORD   $0x894c; BYTE $0xf0                   // movq	%r14, %rax
+	LONG   $0x1879e2c4; BYTE $0xde               // vbroadcastss	%xmm6, %xmm3
+	LONG   $0x04e0c148                           // salq	$4, %rax
+	LONG   $0x247c8948; BYTE $0x40               // movq	%rdi, 64(%rsp)
+	LONG   $0x02e7c148                           // salq	$2, %rdi
+	LONG   $0xd328f8c5                           // vmovaps	%xmm3, %xmm2
+	QUAD   $0x0000010024848948                   // movq	%rax, 256(%rsp)
+	LONG   $0x26048d4a                           // leaq	(%rsi,%r12), %rax
+	LONG   $0x24448948; BYTE $0x58               // movq	%rax, 88(%rsp)
+	WORD   $0x014c; BYTE $0xe0                   // addq	%r12, %rax
+	LONG   $0x24448948; BYTE $0x50               // movq	%rax, 80(%rsp)
+	WORD   $0x014c; BYTE $0xe0                   // addq	%r12, %rax
+	LONG   $0x24448948; BYTE $0x48               // movq	%rax, 72(%rsp)
+	LONG   $0x10428d48                           // leaq	16(%rdx), %rax
+	LONG   $0xc0568d49                           // leaq	-64(%r14), %rdx
+	QUAD   $0x0000010824848948                   // movq	%rax, 264(%rsp)
+	LONG   $0xfc458d49                           // leaq	-4(%r13), %rax
+	LONG   $0x06eac148                           // shrq	$6, %rdx
+	LONG   $0x24448948; BYTE $0x78               // movq	%rax, 120(%rsp)
+	LONG   $0x02e8c148                           // shrq	$2, %rax
+	LONG   $0x01c28348                           // addq	$1, %rdx
+	QUAD   $0x0000000485048d48                   // leaq	4(,%rax,4), %rax
+	LONG   $0x247c8948; BYTE $0x38               // movq	%rdi, 56(%rsp)
+	LONG   $0x24448948; BYTE $0x68               // movq	%rax, 104(%rsp)
+	LONG   $0xf0458d49                           // leaq	-16(%r13), %rax
+	QUAD   $0x000000b824848948                   // movq	%rax, 184(%rsp)
+	LONG   $0xf0e08348                           // andq	$-16, %rax
+	QUAD   $0x000001202484c748; LONG $0x00000000 // movq	$0, 288(%rsp)
+	LONG   $0x10408d48                           // leaq	16(%rax), %rax
+	QUAD   $0x000000c024848948                   // movq	%rax, 192(%rsp)
+	WORD   $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG   $0x06e2c148                           // salq	$6, %rdx
+	LONG   $0x08e0c148                           // salq	$8, %rax
+	QUAD   $0x0000009024948948                   // movq	%rdx, 144(%rsp)
+	QUAD   $0x0000008024848948                   // movq	%rax, 128(%rsp)
+	LONG   $0x10428d48                           // leaq	16(%rdx), %rax
+	WORD   $0x894c; BYTE $0xea                   // movq	%r13, %rdx
+	LONG   $0x24448948; BYTE $0x70               // movq	%rax, 112(%rsp)
+	LONG   $0xff458d49                           // leaq	-1(%r13), %rax
+	LONG   $0x02eac148                           // shrq	$2, %rdx
+	QUAD   $0x000000f824848948                   // movq	%rax, 248(%rsp)
+	WORD   $0x894c; BYTE $0xe8                   // movq	%r13, %rax
+	LONG   $0x04e2c148                           // salq	$4, %rdx
+	LONG   $0xfce08348                           // andq	$-4, %rax
+	LONG   $0x24548948; BYTE $0x60               // movq	%rdx, 96(%rsp)
+	WORD   $0x894c; BYTE $0xe2                   // movq	%r12, %rdx
+	WORD   $0x894d; BYTE $0xdc                   // movq	%r11, %r12
+	QUAD   $0x000001702484c748; LONG $0x00000000 // movq	$0, 368(%rsp)
+	QUAD   $0x000000d02484c748; LONG $0x00000000 // movq	$0, 208(%rsp)
+	QUAD   $0x000000f024848948                   // movq	%rax, 240(%rsp)
+	WORD   $0x894c; BYTE $0xe8                   // movq	%r13, %rax
+	WORD   $0x894d; BYTE $0xf5                   // movq	%r14, %r13
+	WORD   $0x8949; BYTE $0xc6                   // movq	%rax, %r14
+
+BB0_89:
+	LONG $0x03fe8349               // cmpq	$3, %r14
+	JLE  BB0_4
+	LONG $0x244c8b48; BYTE $0x78   // movq	120(%rsp), %rcx
+	LONG $0x244c8b4c; BYTE $0x48   // movq	72(%rsp), %r9
+	WORD $0x8949; BYTE $0xda       // movq	%rbx, %r10
+	WORD $0x3145; BYTE $0xdb       // xorl	%r11d, %r11d
+	LONG $0x24448b4c; BYTE $0x50   // movq	80(%rsp), %r8
+	LONG $0x247c8b48; BYTE $0x58   // movq	88(%rsp), %rdi
+	QUAD $0x0000016024a4894c       // movq	%r12, 352(%rsp)
+	LONG $0x08fde162; WORD $0xf26e // vmovq	%rdx, %xmm22
+	QUAD $0x0000012024848b48       // movq	288(%rsp), %rax
+	LONG $0xfce18348               // andq	$-4, %rcx
+	QUAD $0x0000014824bc894c       // movq	%r15, 328(%rsp)
+	QUAD $0x000000b024b4894c       // movq	%r14, 176(%rsp)
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	QUAD $0x0000011824848b48       // movq	280(%rsp), %rax
+	QUAD $0x000000a824bc894c       // movq	%r15, 168(%rsp)
+	LONG $0x88448d48; BYTE $0x10   // leaq	16(%rax,%rcx,4), %rax
+	QUAD $0x00000088248c8b48       // movq	136(%rsp), %rcx
+	LONG $0x08fde162; WORD $0xe86e // vmovq	%rax, %xmm21
+	LONG $0x24448b48; BYTE $0x40   // movq	64(%rsp), %rax
+	WORD $0x8949; BYTE $0xce       // movq	%rcx, %r14
+	WORD $0x8949; BYTE $0xc7       // movq	%rax, %r15
+
+BB0_14:
+	LONG $0x2b048d4b               // leaq	(%r11,%r13), %rax
+	QUAD $0x0000017824848948       // movq	%rax, 376(%rsp)
+	LONG $0x0ffd8349               // cmpq	$15, %r13
+	JLE  BB0_93
+	LONG $0xff57c0c5               // vxorps	%xmm7, %xmm7, %xmm7
+	QUAD $0x0000016024a48b4c       // movq	352(%rsp), %r12
+	LONG $0x000010b8; BYTE $0x00   // movl	$16, %eax
+	LONG $0x487cf162; WORD $0xdf28 // vmovaps	%zmm7, %zmm3
+	LONG $0x487cf162; WORD $0xe728 // vmovaps	%zmm7, %zmm4
+	LONG $0x487cf162; WORD $0xef28 // vmovaps	%zmm7, %zmm5
+
+BB0_6:
+	QUAD $0xff844c10487cd162 // vmovups	-64(%r12,%rax,4), %zmm1
+	QUAD $0xff826cb84875d262 // vfmadd231ps	-64(%r10,%rax,4), %zmm1, %zmm5
+	QUAD $0xff8764b84875f262 // vfmadd231ps	-64(%rdi,%rax,4), %zmm1, %zmm4
+	QUAD $0xff805cb84875d262 // vfmadd231ps	-64(%r8,%rax,4), %zmm1, %zmm3
+	QUAD $0xff817cb84875d262 // vfmadd231ps	-64(%r9,%rax,4), %zmm1, %zmm7
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x394c; BYTE $0xe8 // cmpq	%r13, %rax
+	JLE  BB0_6
+	QUAD $0x0000016024a4894c // movq	%r12, 352(%rsp)
+	QUAD $0x00000108248c8b48 // movq	264(%rsp), %rcx
+
+BB0_5:
+	LONG $0x48fdf362; WORD $0xe91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm1
+	LONG $0xcd58f4c5                           // vaddps	%ymm5, %ymm1, %ymm1
+	LONG $0x197de3c4; WORD $0x01cd             // vextractf128	$0x1, %ymm1, %xmm5
+	LONG $0xe958d0c5                           // vaddps	%xmm1, %xmm5, %xmm5
+	LONG $0x0479e3c4; WORD $0x4ecd             // vpermilps	$78, %xmm5, %xmm1
+	LONG $0xcd58f0c5                           // vaddps	%xmm5, %xmm1, %xmm1
+	LONG $0x48fdf362; WORD $0xe51b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm5
+	LONG $0xe458d4c5                           // vaddps	%ymm4, %ymm5, %ymm4
+	LONG $0xf92878c5                           // vmovaps	%xmm1, %xmm15
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0x197de3c4; WORD $0x01e5             // vextractf128	$0x1, %ymm4, %xmm5
+	LONG $0xf95802c5                           // vaddss	%xmm1, %xmm15, %xmm15
+	LONG $0xe458d0c5                           // vaddps	%xmm4, %xmm5, %xmm4
+	LONG $0x0479e3c4; WORD $0x4eec             // vpermilps	$78, %xmm4, %xmm5
+	LONG $0xec58d0c5                           // vaddps	%xmm4, %xmm5, %xmm5
+	LONG $0x48fdf362; WORD $0xdc1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm3, %ymm4
+	LONG $0xdb58dcc5                           // vaddps	%ymm3, %ymm4, %ymm3
+	LONG $0xcd28f8c5                           // vmovaps	%xmm5, %xmm1
+	LONG $0xedc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm5
+	LONG $0x197de3c4; WORD $0x01dc             // vextractf128	$0x1, %ymm3, %xmm4
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xdb58d8c5                           // vaddps	%xmm3, %xmm4, %xmm3
+	LONG $0xf91400c5                           // vunpcklps	%xmm1, %xmm15, %xmm15
+	LONG $0x0479e3c4; WORD $0x4ee3             // vpermilps	$78, %xmm3, %xmm4
+	LONG $0xe358d8c5                           // vaddps	%xmm3, %xmm4, %xmm4
+	LONG $0x48fdf362; WORD $0xfb1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm7, %ymm3
+	LONG $0xfb58c4c5                           // vaddps	%ymm3, %ymm7, %ymm7
+	LONG $0xec28f8c5                           // vmovaps	%xmm4, %xmm5
+	LONG $0xe4c6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01fb             // vextractf128	$0x1, %ymm7, %xmm3
+	LONG $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG $0xff58e0c5                           // vaddps	%xmm7, %xmm3, %xmm7
+	LONG $0x0479e3c4; WORD $0x4edf             // vpermilps	$78, %xmm7, %xmm3
+	LONG $0xdf58e0c5                           // vaddps	%xmm7, %xmm3, %xmm3
+	LONG $0xe328f8c5                           // vmovaps	%xmm3, %xmm4
+	LONG $0xdbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm3
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG $0xe414d0c5                           // vunpcklps	%xmm4, %xmm5, %xmm4
+	LONG $0xfc1600c5                           // vmovlhps	%xmm4, %xmm15, %xmm15
+	WORD $0x3949; BYTE $0xcd                   // cmpq	%rcx, %r13
+	JLE  BB0_7
+	WORD $0x894c; BYTE $0xe8                   // movq	%r13, %rax
+	QUAD $0x00000150248c8948                   // movq	%rcx, 336(%rsp)
+	WORD $0x2948; BYTE $0xc8                   // subq	%rcx, %rax
+	QUAD $0x0000015824848948                   // movq	%rax, 344(%rsp)
+	WORD $0x8949; BYTE $0xc4                   // movq	%rax, %r12
+	LONG $0x01e88348                           // subq	$1, %rax
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_94
+	QUAD $0x0000017024948b48                   // movq	368(%rsp), %rdx
+	QUAD $0x00000140248c8948                   // movq	%rcx, 320(%rsp)
+	QUAD $0x0000013824bc8948                   // movq	%rdi, 312(%rsp)
+	LONG $0x11048d48                           // leaq	(%rcx,%rdx), %rax
+	QUAD $0x0000016824948b48                   // movq	360(%rsp), %rdx
+	QUAD $0x000001302484894c                   // movq	%r8, 304(%rsp)
+	QUAD $0x00000128249c8948                   // movq	%rbx, 296(%rsp)
+	LONG $0x82148d48                           // leaq	(%rdx,%rax,4), %rdx
+	LONG $0x19048d4a                           // leaq	(%rcx,%r11), %rax
+	LONG $0x83348d48                           // leaq	(%rbx,%rax,4), %rsi
+	LONG $0x08fde162; WORD $0xde6e             // vmovq	%rsi, %xmm19
+	QUAD $0x0000017824b48b48                   // movq	376(%rsp), %rsi
+	LONG $0x31048d48                           // leaq	(%rcx,%rsi), %rax
+	LONG $0x83348d48                           // leaq	(%rbx,%rax,4), %rsi
+	LONG $0x31048d4a                           // leaq	(%rcx,%r14), %rax
+	LONG $0x08fde162; WORD $0xd66e             // vmovq	%rsi, %xmm18
+	LONG $0x83348d48                           // leaq	(%rbx,%rax,4), %rsi
+	LONG $0x39048d4a                           // leaq	(%rcx,%r15), %rax
+	LONG $0x08fde162; WORD $0xc66e             // vmovq	%rsi, %xmm16
+	LONG $0x83348d48                           // leaq	(%rbx,%rax,4), %rsi
+	WORD $0x894c; BYTE $0xe0                   // movq	%r12, %rax
+	WORD $0x894c; BYTE $0xcb                   // movq	%r9, %rbx
+	LONG $0x04e8c148                           // shrq	$4, %rax
+	WORD $0x8949; BYTE $0xf1                   // movq	%rsi, %r9
+	LONG $0x08fde162; WORD $0xd77e             // vmovq	%xmm18, %rdi
+	LONG $0x06e0c148                           // salq	$6, %rax
+	LONG $0x08fdc162; WORD $0xc07e             // vmovq	%xmm16, %r8
+	LONG $0x08fde162; WORD $0xde7e             // vmovq	%xmm19, %rsi
+	WORD $0x8949; BYTE $0xc4                   // movq	%rax, %r12
+	WORD $0xc031                               // xorl	%eax, %eax
+	WORD $0x894c; BYTE $0xe1                   // movq	%r12, %rcx
+	QUAD $0x0000016024a48b4c                   // movq	352(%rsp), %r12
+
+BB0_9:
+	LONG $0x487cf162; WORD $0x1c10; BYTE $0x02 // vmovups	(%rdx,%rax), %zmm3
+	LONG $0x4864f162; WORD $0x2459; BYTE $0x06 // vmulps	(%rsi,%rax), %zmm3, %zmm4
+	LONG $0x48647162; WORD $0x0459; BYTE $0x07 // vmulps	(%rdi,%rax), %zmm3, %zmm8
+	LONG $0x4864d162; WORD $0x2c59; BYTE $0x00 // vmulps	(%r8,%rax), %zmm3, %zmm5
+	LONG $0x4864d162; WORD $0x1c59; BYTE $0x01 // vmulps	(%r9,%rax), %zmm3, %zmm3
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0xccc658c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm9
+	LONG $0x285df362; WORD $0xfc03; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm7
+	LONG $0x083cc162; WORD $0xd8c6; BYTE $0x55 // vshufps	$85, %xmm8, %xmm8, %xmm19
+	LONG $0x1458c1c4; BYTE $0xc8               // vunpcklps	%xmm8, %xmm4, %xmm1
+	LONG $0x083cc162; WORD $0xf8c6; BYTE $0xff // vshufps	$255, %xmm8, %xmm8, %xmm23
+	LONG $0x08343162; WORD $0xcf14             // vunpcklps	%xmm23, %xmm9, %xmm9
+	LONG $0xddc650c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm11
+	LONG $0x283d5362; WORD $0xe003; BYTE $0x07 // valignd	$7, %ymm8, %ymm8, %ymm12
+	LONG $0x0864e162; WORD $0xe3c6; BYTE $0x55 // vshufps	$85, %xmm3, %xmm3, %xmm20
+	LONG $0xf31450c5                           // vunpcklps	%xmm3, %xmm5, %xmm14
+	LONG $0x08646162; WORD $0xc3c6; BYTE $0xff // vshufps	$255, %xmm3, %xmm3, %xmm24
+	LONG $0x08241162; WORD $0xd814             // vunpcklps	%xmm24, %xmm11, %xmm11
+	LONG $0x28657362; WORD $0xeb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm13
+	LONG $0x1670c1c4; BYTE $0xce               // vmovlhps	%xmm14, %xmm1, %xmm1
+	LONG $0xf4c658c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm14
+	LONG $0x080c3162; WORD $0xf314             // vunpcklps	%xmm19, %xmm14, %xmm14
+	LONG $0x5870c1c4; BYTE $0xcf               // vaddps	%xmm15, %xmm1, %xmm1
+	LONG $0xfdc650c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm15
+	LONG $0x08043162; WORD $0xfc14             // vunpcklps	%xmm20, %xmm15, %xmm15
+	LONG $0x083cc162; WORD $0xd815             // vunpckhps	%xmm8, %xmm8, %xmm19
+	LONG $0x160841c4; BYTE $0xf7               // vmovlhps	%xmm15, %xmm14, %xmm14
+	LONG $0x0864e162; WORD $0xe315             // vunpckhps	%xmm3, %xmm3, %xmm20
+	LONG $0xfd1550c5                           // vunpckhps	%xmm5, %xmm5, %xmm15
+	LONG $0x28557362; WORD $0xd503; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm10
+	LONG $0x08043162; WORD $0xfc14             // vunpcklps	%xmm20, %xmm15, %xmm15
+	LONG $0x163041c4; BYTE $0xcb               // vmovlhps	%xmm11, %xmm9, %xmm9
+	LONG $0x287d5362; WORD $0xc319; BYTE $0x01 // vextractf32x4	$1, %ymm8, %xmm11
+	LONG $0x5870c1c4; BYTE $0xce               // vaddps	%xmm14, %xmm1, %xmm1
+	LONG $0xf41558c5                           // vunpckhps	%xmm4, %xmm4, %xmm14
+	LONG $0x1440c1c4; BYTE $0xfc               // vunpcklps	%xmm12, %xmm7, %xmm7
+	LONG $0x080c3162; WORD $0xf314             // vunpcklps	%xmm19, %xmm14, %xmm14
+	LONG $0x160841c4; BYTE $0xf7               // vmovlhps	%xmm15, %xmm14, %xmm14
+	LONG $0x587041c4; BYTE $0xfe               // vaddps	%xmm14, %xmm1, %xmm15
+	LONG $0x287dd362; WORD $0xde19; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm14
+	LONG $0x287df362; WORD $0xe119; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm1
+	LONG $0x142841c4; BYTE $0xd5               // vunpcklps	%xmm13, %xmm10, %xmm10
+	LONG $0x580041c4; BYTE $0xf9               // vaddps	%xmm9, %xmm15, %xmm15
+	LONG $0x1640c1c4; BYTE $0xfa               // vmovlhps	%xmm10, %xmm7, %xmm7
+	LONG $0x287dd362; WORD $0xe919; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm9
+	LONG $0x1470c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0x283d5362; WORD $0xd803; BYTE $0x05 // valignd	$5, %ymm8, %ymm8, %ymm11
+	LONG $0x143041c4; BYTE $0xce               // vunpcklps	%xmm14, %xmm9, %xmm9
+	LONG $0x28657362; WORD $0xf303; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm14
+	LONG $0x1670c1c4; BYTE $0xc9               // vmovlhps	%xmm9, %xmm1, %xmm1
+	LONG $0x28557362; WORD $0xcd03; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm9
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x285df362; WORD $0xcc03; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm1
+	LONG $0x143041c4; BYTE $0xce               // vunpcklps	%xmm14, %xmm9, %xmm9
+	LONG $0x28657362; WORD $0xf303; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm14
+	LONG $0x1470c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0x487df362; WORD $0xdb1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm3, %ymm3
+	LONG $0x283d5362; WORD $0xd803; BYTE $0x06 // valignd	$6, %ymm8, %ymm8, %ymm11
+	LONG $0x1670c1c4; BYTE $0xc9               // vmovlhps	%xmm9, %xmm1, %xmm1
+	LONG $0x487d5362; WORD $0xc01b; BYTE $0x01 // vextractf32x8	$0x1, %zmm8, %ymm8
+	LONG $0xe3c660c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm12
+	LONG $0x28557362; WORD $0xcd03; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm9
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x487df362; WORD $0xed1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm5, %ymm5
+	LONG $0xc63841c4; WORD $0x55e8             // vshufps	$85, %xmm8, %xmm8, %xmm13
+	LONG $0x285df362; WORD $0xcc03; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm1
+	LONG $0x487df362; WORD $0xe41b; BYTE $0x01 // vextractf32x8	$0x1, %zmm4, %ymm4
+	LONG $0xd31450c5                           // vunpcklps	%xmm3, %xmm5, %xmm10
+	LONG $0x143041c4; BYTE $0xce               // vunpcklps	%xmm14, %xmm9, %xmm9
+	LONG $0xf3c660c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm14
+	LONG $0x1470c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0xc63841c4; WORD $0xffd8             // vshufps	$255, %xmm8, %xmm8, %xmm11
+	LONG $0x1670c1c4; BYTE $0xc9               // vmovlhps	%xmm9, %xmm1, %xmm1
+	LONG $0x145841c4; BYTE $0xc8               // vunpcklps	%xmm8, %xmm4, %xmm9
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x163041c4; BYTE $0xca               // vmovlhps	%xmm10, %xmm9, %xmm9
+	LONG $0xd5c650c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm10
+	LONG $0x142841c4; BYTE $0xd6               // vunpcklps	%xmm14, %xmm10, %xmm10
+	LONG $0xf31560c5                           // vunpckhps	%xmm3, %xmm3, %xmm14
+	LONG $0xccc6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm1
+	LONG $0x1470c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0xff5800c5                           // vaddps	%xmm7, %xmm15, %xmm15
+	LONG $0xfdc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm7
+	LONG $0x1440c1c4; BYTE $0xfc               // vunpcklps	%xmm12, %xmm7, %xmm7
+	LONG $0xcf16f0c5                           // vmovlhps	%xmm7, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xef19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm7
+	LONG $0x580041c4; BYTE $0xf9               // vaddps	%xmm9, %xmm15, %xmm15
+	LONG $0xccc658c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm9
+	LONG $0x143041c4; BYTE $0xcd               // vunpcklps	%xmm13, %xmm9, %xmm9
+	LONG $0x153841c4; BYTE $0xe8               // vunpckhps	%xmm8, %xmm8, %xmm13
+	LONG $0x163041c4; BYTE $0xca               // vmovlhps	%xmm10, %xmm9, %xmm9
+	LONG $0xd51550c5                           // vunpckhps	%xmm5, %xmm5, %xmm10
+	LONG $0x142841c4; BYTE $0xd6               // vunpcklps	%xmm14, %xmm10, %xmm10
+	LONG $0x580041c4; BYTE $0xf9               // vaddps	%xmm9, %xmm15, %xmm15
+	LONG $0xcc1558c5                           // vunpckhps	%xmm4, %xmm4, %xmm9
+	LONG $0x143041c4; BYTE $0xcd               // vunpcklps	%xmm13, %xmm9, %xmm9
+	LONG $0x163041c4; BYTE $0xca               // vmovlhps	%xmm10, %xmm9, %xmm9
+	LONG $0x287dd362; WORD $0xda19; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm10
+	LONG $0x580041c4; BYTE $0xf9               // vaddps	%xmm9, %xmm15, %xmm15
+	LONG $0x287d5362; WORD $0xc119; BYTE $0x01 // vextractf32x4	$1, %ymm8, %xmm9
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x287df362; WORD $0xe119; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm1
+	LONG $0x1440c1c4; BYTE $0xfa               // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0x28657362; WORD $0xd303; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm10
+	LONG $0x1470c1c4; BYTE $0xc9               // vunpcklps	%xmm9, %xmm1, %xmm1
+	LONG $0x283d5362; WORD $0xc803; BYTE $0x05 // valignd	$5, %ymm8, %ymm8, %ymm9
+	LONG $0xcf16f0c5                           // vmovlhps	%xmm7, %xmm1, %xmm1
+	LONG $0x2855f362; WORD $0xfd03; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm7
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x285df362; WORD $0xcc03; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm1
+	LONG $0x1440c1c4; BYTE $0xfa               // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0x28657362; WORD $0xd303; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm10
+	LONG $0x1470c1c4; BYTE $0xc9               // vunpcklps	%xmm9, %xmm1, %xmm1
+	LONG $0x283d5362; WORD $0xc803; BYTE $0x06 // valignd	$6, %ymm8, %ymm8, %ymm9
+	LONG $0xcf16f0c5                           // vmovlhps	%xmm7, %xmm1, %xmm1
+	LONG $0x2855f362; WORD $0xfd03; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm7
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x285df362; WORD $0xcc03; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm1
+	LONG $0x283d5362; WORD $0xc003; BYTE $0x07 // valignd	$7, %ymm8, %ymm8, %ymm8
+	LONG $0x285df362; WORD $0xe403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm4
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0x2865f362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm3
+	LONG $0x1440c1c4; BYTE $0xfa               // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0x1470c1c4; BYTE $0xc9               // vunpcklps	%xmm9, %xmm1, %xmm1
+	LONG $0xcf16f0c5                           // vmovlhps	%xmm7, %xmm1, %xmm1
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x1458c1c4; BYTE $0xe0               // vunpcklps	%xmm8, %xmm4, %xmm4
+	LONG $0xdb14d0c5                           // vunpcklps	%xmm3, %xmm5, %xmm3
+	LONG $0xe316d8c5                           // vmovlhps	%xmm3, %xmm4, %xmm4
+	LONG $0xfc5800c5                           // vaddps	%xmm4, %xmm15, %xmm15
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JNE  BB0_9
+	QUAD $0x0000015824948b48                   // movq	344(%rsp), %rdx
+	QUAD $0x00000140248c8b48                   // movq	320(%rsp), %rcx
+	WORD $0x8949; BYTE $0xd9                   // movq	%rbx, %r9
+	QUAD $0x0000016024a4894c                   // movq	%r12, 352(%rsp)
+	QUAD $0x0000013824bc8b48                   // movq	312(%rsp), %rdi
+	QUAD $0x0000013024848b4c                   // movq	304(%rsp), %r8
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	QUAD $0x00000128249c8b48                   // movq	296(%rsp), %rbx
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	WORD $0xe283; BYTE $0x0f                   // andl	$15, %edx
+	JE   BB0_7
+
+BB0_8:
+	QUAD $0x0000015824b48b48                   // movq	344(%rsp), %rsi
+	WORD $0x2948; BYTE $0xc6                   // subq	%rax, %rsi
+	LONG $0xff568d48                           // leaq	-1(%rsi), %rdx
+	LONG $0x06fa8348                           // cmpq	$6, %rdx
+	JBE  BB0_12
+	QUAD $0x0000015024948b48                   // movq	336(%rsp), %rdx
+	QUAD $0x0000016824a48b4c                   // movq	360(%rsp), %r12
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	QUAD $0x0000017024948b48                   // movq	368(%rsp), %rdx
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x107cc1c4; WORD $0x943c             // vmovups	(%r12,%rdx,4), %ymm7
+	LONG $0x18148d4a                           // leaq	(%rax,%r11), %rdx
+	LONG $0x1c59c4c5; BYTE $0x93               // vmulps	(%rbx,%rdx,4), %ymm7, %ymm3
+	QUAD $0x0000017824948b48                   // movq	376(%rsp), %rdx
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x1c5944c5; BYTE $0x93               // vmulps	(%rbx,%rdx,4), %ymm7, %ymm11
+	LONG $0x30148d4a                           // leaq	(%rax,%r14), %rdx
+	WORD $0x014c; BYTE $0xf8                   // addq	%r15, %rax
+	LONG $0x145944c5; BYTE $0x93               // vmulps	(%rbx,%rdx,4), %ymm7, %ymm10
+	LONG $0x3c59c4c5; BYTE $0x83               // vmulps	(%rbx,%rax,4), %ymm7, %ymm7
+	LONG $0xe3c6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm4
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	WORD $0xe683; BYTE $0x07                   // andl	$7, %esi
+	LONG $0x1460c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm3, %xmm1
+	LONG $0xc62041c4; WORD $0x55f3             // vshufps	$85, %xmm11, %xmm11, %xmm14
+	LONG $0xc62041c4; WORD $0xffc3             // vshufps	$255, %xmm11, %xmm11, %xmm8
+	LONG $0x1458c1c4; BYTE $0xe0               // vunpcklps	%xmm8, %xmm4, %xmm4
+	LONG $0xc62841c4; WORD $0x55ea             // vshufps	$85, %xmm10, %xmm10, %xmm13
+	LONG $0xc628c1c4; WORD $0xffea             // vshufps	$255, %xmm10, %xmm10, %xmm5
+	LONG $0x287d5362; WORD $0xd819; BYTE $0x01 // vextractf32x4	$1, %ymm11, %xmm8
+	LONG $0xe71428c5                           // vunpcklps	%xmm7, %xmm10, %xmm12
+	LONG $0xcfc640c5; BYTE $0xff               // vshufps	$255, %xmm7, %xmm7, %xmm9
+	LONG $0x1450c1c4; BYTE $0xe9               // vunpcklps	%xmm9, %xmm5, %xmm5
+	LONG $0x287dd362; WORD $0xf919; BYTE $0x01 // vextractf32x4	$1, %ymm7, %xmm9
+	LONG $0x1670c1c4; BYTE $0xcc               // vmovlhps	%xmm12, %xmm1, %xmm1
+	LONG $0xe3c660c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm12
+	LONG $0x141841c4; BYTE $0xe6               // vunpcklps	%xmm14, %xmm12, %xmm12
+	LONG $0x5870c1c4; BYTE $0xcf               // vaddps	%xmm15, %xmm1, %xmm1
+	LONG $0x152041c4; BYTE $0xf3               // vunpckhps	%xmm11, %xmm11, %xmm14
+	LONG $0xffc640c5; BYTE $0x55               // vshufps	$85, %xmm7, %xmm7, %xmm15
+	LONG $0x141041c4; BYTE $0xef               // vunpcklps	%xmm15, %xmm13, %xmm13
+	LONG $0x161841c4; BYTE $0xe5               // vmovlhps	%xmm13, %xmm12, %xmm12
+	LONG $0xff1540c5                           // vunpckhps	%xmm7, %xmm7, %xmm15
+	LONG $0x152841c4; BYTE $0xea               // vunpckhps	%xmm10, %xmm10, %xmm13
+	LONG $0x141041c4; BYTE $0xef               // vunpcklps	%xmm15, %xmm13, %xmm13
+	LONG $0xe516d8c5                           // vmovlhps	%xmm5, %xmm4, %xmm4
+	LONG $0x287d7362; WORD $0xd519; BYTE $0x01 // vextractf32x4	$1, %ymm10, %xmm5
+	LONG $0x5870c1c4; BYTE $0xcc               // vaddps	%xmm12, %xmm1, %xmm1
+	LONG $0xe31560c5                           // vunpckhps	%xmm3, %xmm3, %xmm12
+	LONG $0x141841c4; BYTE $0xe6               // vunpcklps	%xmm14, %xmm12, %xmm12
+	LONG $0x161841c4; BYTE $0xe5               // vmovlhps	%xmm13, %xmm12, %xmm12
+	LONG $0x5870c1c4; BYTE $0xcc               // vaddps	%xmm12, %xmm1, %xmm1
+	LONG $0xcc58f0c5                           // vaddps	%xmm4, %xmm1, %xmm1
+	LONG $0x1450c1c4; BYTE $0xe9               // vunpcklps	%xmm9, %xmm5, %xmm5
+	LONG $0x287df362; WORD $0xdc19; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm4
+	LONG $0x28457362; WORD $0xcf03; BYTE $0x05 // valignd	$5, %ymm7, %ymm7, %ymm9
+	LONG $0x1458c1c4; BYTE $0xe0               // vunpcklps	%xmm8, %xmm4, %xmm4
+	LONG $0x28255362; WORD $0xc303; BYTE $0x05 // valignd	$5, %ymm11, %ymm11, %ymm8
+	LONG $0xe516d8c5                           // vmovlhps	%xmm5, %xmm4, %xmm4
+	LONG $0x282dd362; WORD $0xea03; BYTE $0x05 // valignd	$5, %ymm10, %ymm10, %ymm5
+	LONG $0xcc58f0c5                           // vaddps	%xmm4, %xmm1, %xmm1
+	LONG $0x2865f362; WORD $0xe303; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm4
+	LONG $0x1450c1c4; BYTE $0xe9               // vunpcklps	%xmm9, %xmm5, %xmm5
+	LONG $0x28457362; WORD $0xcf03; BYTE $0x06 // valignd	$6, %ymm7, %ymm7, %ymm9
+	LONG $0x1458c1c4; BYTE $0xe0               // vunpcklps	%xmm8, %xmm4, %xmm4
+	LONG $0x28255362; WORD $0xc303; BYTE $0x06 // valignd	$6, %ymm11, %ymm11, %ymm8
+	LONG $0xe516d8c5                           // vmovlhps	%xmm5, %xmm4, %xmm4
+	LONG $0x282dd362; WORD $0xea03; BYTE $0x06 // valignd	$6, %ymm10, %ymm10, %ymm5
+	LONG $0xcc58f0c5                           // vaddps	%xmm4, %xmm1, %xmm1
+	LONG $0x2865f362; WORD $0xe303; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm4
+	LONG $0x28255362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm11, %ymm11, %ymm11
+	LONG $0x2865f362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm3
+	LONG $0x2845f362; WORD $0xff03; BYTE $0x07 // valignd	$7, %ymm7, %ymm7, %ymm7
+	LONG $0x1450c1c4; BYTE $0xe9               // vunpcklps	%xmm9, %xmm5, %xmm5
+	LONG $0x1458c1c4; BYTE $0xe0               // vunpcklps	%xmm8, %xmm4, %xmm4
+	LONG $0xe516d8c5                           // vmovlhps	%xmm5, %xmm4, %xmm4
+	LONG $0xcc58f0c5                           // vaddps	%xmm4, %xmm1, %xmm1
+	LONG $0x1460c1c4; BYTE $0xdb               // vunpcklps	%xmm11, %xmm3, %xmm3
+	LONG $0x282dd362; WORD $0xe203; BYTE $0x07 // valignd	$7, %ymm10, %ymm10, %ymm4
+	LONG $0xe714d8c5                           // vunpcklps	%xmm7, %xmm4, %xmm4
+	LONG $0xdc16e0c5                           // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0xfb5870c5                           // vaddps	%xmm3, %xmm1, %xmm15
+	JE   BB0_7
+
+BB0_12:
+	LONG $0x0e248d4d                           // leaq	(%r14,%rcx), %r12
+	QUAD $0x0000017824948b48                   // movq	376(%rsp), %rdx
+	LONG $0x0b348d49                           // leaq	(%r11,%rcx), %rsi
+	QUAD $0x0000017024848b48                   // movq	368(%rsp), %rax
+	LONG $0x6ef9c1c4; BYTE $0xdc               // vmovq	%r12, %xmm3
+	LONG $0x0f248d4d                           // leaq	(%r15,%rcx), %r12
+	LONG $0x6ef9c1c4; BYTE $0xcc               // vmovq	%r12, %xmm1
+	LONG $0x7ef9c1c4; BYTE $0xdc               // vmovq	%xmm3, %r12
+	WORD $0x0148; BYTE $0xca                   // addq	%rcx, %rdx
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x107aa1c4; WORD $0xa31c             // vmovss	(%rbx,%r12,4), %xmm3
+	LONG $0x7ef9c1c4; BYTE $0xcc               // vmovq	%xmm1, %r12
+	LONG $0x0c10fac5; BYTE $0xb3               // vmovss	(%rbx,%rsi,4), %xmm1
+	LONG $0x2161a3c4; WORD $0xa31c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%r12,4), %xmm3, %xmm3
+	LONG $0x2171e3c4; WORD $0x930c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rdx,4), %xmm1, %xmm1
+	QUAD $0x0000016824948b48                   // movq	360(%rsp), %rdx
+	LONG $0xcb16f0c5                           // vmovlhps	%xmm3, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x82 // vfmadd231ps	(%rdx,%rax,4){1to4}, %xmm1, %xmm15
+	LONG $0x01418d48                           // leaq	1(%rcx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_7
+	QUAD $0x0000017024b48b48                   // movq	368(%rsp), %rsi
+	LONG $0x03248d4d                           // leaq	(%r11,%rax), %r12
+	LONG $0x6ef9c1c4; BYTE $0xcc               // vmovq	%r12, %xmm1
+	LONG $0x06248d4d                           // leaq	(%r14,%rax), %r12
+	LONG $0x06148d48                           // leaq	(%rsi,%rax), %rdx
+	QUAD $0x0000017824b48b48                   // movq	376(%rsp), %rsi
+	LONG $0x107aa1c4; WORD $0xa31c             // vmovss	(%rbx,%r12,4), %xmm3
+	LONG $0x7ef9c1c4; BYTE $0xcc               // vmovq	%xmm1, %r12
+	LONG $0x107aa1c4; WORD $0xa30c             // vmovss	(%rbx,%r12,4), %xmm1
+	WORD $0x0148; BYTE $0xc6                   // addq	%rax, %rsi
+	WORD $0x014c; BYTE $0xf8                   // addq	%r15, %rax
+	LONG $0x2161e3c4; WORD $0x831c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rax,4), %xmm3, %xmm3
+	LONG $0x2171e3c4; WORD $0xb30c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rsi,4), %xmm1, %xmm1
+	QUAD $0x0000016824848b48                   // movq	360(%rsp), %rax
+	LONG $0xcb16f0c5                           // vmovlhps	%xmm3, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x90 // vfmadd231ps	(%rax,%rdx,4){1to4}, %xmm1, %xmm15
+	LONG $0x02418d48                           // leaq	2(%rcx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_7
+	LONG $0x03248d4d                           // leaq	(%r11,%rax), %r12
+	QUAD $0x0000017024948b48                   // movq	368(%rsp), %rdx
+	QUAD $0x0000017824b48b48                   // movq	376(%rsp), %rsi
+	LONG $0x6ef9c1c4; BYTE $0xcc               // vmovq	%r12, %xmm1
+	LONG $0x06248d4d                           // leaq	(%r14,%rax), %r12
+	LONG $0x107aa1c4; WORD $0xa31c             // vmovss	(%rbx,%r12,4), %xmm3
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0x0148; BYTE $0xc6                   // addq	%rax, %rsi
+	LONG $0x7ef9c1c4; BYTE $0xcc               // vmovq	%xmm1, %r12
+	WORD $0x014c; BYTE $0xf8                   // addq	%r15, %rax
+	LONG $0x107aa1c4; WORD $0xa30c             // vmovss	(%rbx,%r12,4), %xmm1
+	LONG $0x2171e3c4; WORD $0xb30c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rsi,4), %xmm1, %xmm1
+	LONG $0x2161e3c4; WORD $0x831c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rax,4), %xmm3, %xmm3
+	QUAD $0x0000016824848b48                   // movq	360(%rsp), %rax
+	LONG $0xcb16f0c5                           // vmovlhps	%xmm3, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x90 // vfmadd231ps	(%rax,%rdx,4){1to4}, %xmm1, %xmm15
+	LONG $0x03418d48                           // leaq	3(%rcx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_7
+	LONG $0x03248d4d                           // leaq	(%r11,%rax), %r12
+	QUAD $0x0000017024948b48                   // movq	368(%rsp), %rdx
+	QUAD $0x0000017824b48b48                   // movq	376(%rsp), %rsi
+	LONG $0x6ef9c1c4; BYTE $0xcc               // vmovq	%r12, %xmm1
+	LONG $0x06248d4d                           // leaq	(%r14,%rax), %r12
+	LONG $0x107aa1c4; WORD $0xa31c             // vmovss	(%rbx,%r12,4), %xmm3
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0x0148; BYTE $0xc6                   // addq	%rax, %rsi
+	LONG $0x7ef9c1c4; BYTE $0xcc               // vmovq	%xmm1, %r12
+	WORD $0x014c; BYTE $0xf8                   // addq	%r15, %rax
+	LONG $0x107aa1c4; WORD $0xa30c             // vmovss	(%rbx,%r12,4), %xmm1
+	LONG $0x2171e3c4; WORD $0xb30c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rsi,4), %xmm1, %xmm1
+	LONG $0x2161e3c4; WORD $0x831c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rax,4), %xmm3, %xmm3
+	QUAD $0x0000016824848b48                   // movq	360(%rsp), %rax
+	LONG $0xcb16f0c5                           // vmovlhps	%xmm3, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x90 // vfmadd231ps	(%rax,%rdx,4){1to4}, %xmm1, %xmm15
+	LONG $0x04418d48                           // leaq	4(%rcx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_7
+	LONG $0x03248d4d                           // leaq	(%r11,%rax), %r12
+	QUAD $0x0000017024948b48                   // movq	368(%rsp), %rdx
+	QUAD $0x0000017824b48b48                   // movq	376(%rsp), %rsi
+	LONG $0x6ef9c1c4; BYTE $0xcc               // vmovq	%r12, %xmm1
+	LONG $0x06248d4d                           // leaq	(%r14,%rax), %r12
+	LONG $0x107aa1c4; WORD $0xa31c             // vmovss	(%rbx,%r12,4), %xmm3
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0x0148; BYTE $0xc6                   // addq	%rax, %rsi
+	LONG $0x7ef9c1c4; BYTE $0xcc               // vmovq	%xmm1, %r12
+	WORD $0x014c; BYTE $0xf8                   // addq	%r15, %rax
+	LONG $0x107aa1c4; WORD $0xa30c             // vmovss	(%rbx,%r12,4), %xmm1
+	LONG $0x2171e3c4; WORD $0xb30c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rsi,4), %xmm1, %xmm1
+	LONG $0x2161e3c4; WORD $0x831c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rax,4), %xmm3, %xmm3
+	QUAD $0x0000016824848b48                   // movq	360(%rsp), %rax
+	LONG $0xcb16f0c5                           // vmovlhps	%xmm3, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x90 // vfmadd231ps	(%rax,%rdx,4){1to4}, %xmm1, %xmm15
+	LONG $0x05418d48                           // leaq	5(%rcx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_7
+	LONG $0x03248d4d                           // leaq	(%r11,%rax), %r12
+	QUAD $0x0000017024948b48                   // movq	368(%rsp), %rdx
+	QUAD $0x0000017824b48b48                   // movq	376(%rsp), %rsi
+	LONG $0x06c18348                           // addq	$6, %rcx
+	LONG $0x6ef9c1c4; BYTE $0xcc               // vmovq	%r12, %xmm1
+	LONG $0x06248d4d                           // leaq	(%r14,%rax), %r12
+	LONG $0x107aa1c4; WORD $0xa31c             // vmovss	(%rbx,%r12,4), %xmm3
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0x0148; BYTE $0xc6                   // addq	%rax, %rsi
+	LONG $0x7ef9c1c4; BYTE $0xcc               // vmovq	%xmm1, %r12
+	WORD $0x014c; BYTE $0xf8                   // addq	%r15, %rax
+	LONG $0x107aa1c4; WORD $0xa30c             // vmovss	(%rbx,%r12,4), %xmm1
+	QUAD $0x0000016824a48b4c                   // movq	360(%rsp), %r12
+	LONG $0x2161e3c4; WORD $0x831c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rax,4), %xmm3, %xmm3
+	LONG $0x2171e3c4; WORD $0xb30c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rsi,4), %xmm1, %xmm1
+	WORD $0x894c; BYTE $0xe0                   // movq	%r12, %rax
+	LONG $0xcb16f0c5                           // vmovlhps	%xmm3, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x90 // vfmadd231ps	(%rax,%rdx,4){1to4}, %xmm1, %xmm15
+	WORD $0x3949; BYTE $0xcd                   // cmpq	%rcx, %r13
+	JLE  BB0_7
+	QUAD $0x0000017824848b48                   // movq	376(%rsp), %rax
+	QUAD $0x0000017024948b48                   // movq	368(%rsp), %rdx
+	LONG $0x0b348d49                           // leaq	(%r11,%rcx), %rsi
+	LONG $0x0c10fac5; BYTE $0xb3               // vmovss	(%rbx,%rsi,4), %xmm1
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	WORD $0x0148; BYTE $0xca                   // addq	%rcx, %rdx
+	QUAD $0x0000017824848948                   // movq	%rax, 376(%rsp)
+	LONG $0x0e048d49                           // leaq	(%r14,%rcx), %rax
+	WORD $0x014c; BYTE $0xf9                   // addq	%r15, %rcx
+	LONG $0x1c10fac5; BYTE $0x83               // vmovss	(%rbx,%rax,4), %xmm3
+	QUAD $0x0000017824848b48                   // movq	376(%rsp), %rax
+	LONG $0x2161e3c4; WORD $0x8b1c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rcx,4), %xmm3, %xmm3
+	LONG $0x2171e3c4; WORD $0x830c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rax,4), %xmm1, %xmm1
+	WORD $0x894c; BYTE $0xe0                   // movq	%r12, %rax
+	LONG $0xcb16f0c5                           // vmovlhps	%xmm3, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x90 // vfmadd231ps	(%rax,%rdx,4){1to4}, %xmm1, %xmm15
+
+BB0_7:
+	LONG $0xfa5900c5               // vmulps	%xmm2, %xmm15, %xmm15
+	QUAD $0x0000010024948b48       // movq	256(%rsp), %rdx
+	QUAD $0x0000014824848b48       // movq	328(%rsp), %rax
+	LONG $0x08fde162; WORD $0xf17e // vmovq	%xmm22, %rcx
+	WORD $0x0149; BYTE $0xcb       // addq	%rcx, %r11
+	WORD $0x0149; BYTE $0xce       // addq	%rcx, %r14
+	WORD $0x0149; BYTE $0xcf       // addq	%rcx, %r15
+	LONG $0x10c08348               // addq	$16, %rax
+	WORD $0x0149; BYTE $0xd2       // addq	%rdx, %r10
+	WORD $0x0148; BYTE $0xd7       // addq	%rdx, %rdi
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	WORD $0x0149; BYTE $0xd1       // addq	%rdx, %r9
+	LONG $0x08fde162; WORD $0xea7e // vmovq	%xmm21, %rdx
+	LONG $0x781178c5; BYTE $0xf0   // vmovups	%xmm15, -16(%rax)
+	QUAD $0x0000014824848948       // movq	%rax, 328(%rsp)
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JNE  BB0_14
+	LONG $0x24448b48; BYTE $0x68   // movq	104(%rsp), %rax
+	QUAD $0x000000b024b48b4c       // movq	176(%rsp), %r14
+	LONG $0x08fde162; WORD $0xf27e // vmovq	%xmm22, %rdx
+	QUAD $0x000000a824bc8b4c       // movq	168(%rsp), %r15
+	QUAD $0x0000016024a48b4c       // movq	352(%rsp), %r12
+	WORD $0x8948; BYTE $0xc7       // movq	%rax, %rdi
+	WORD $0x3949; BYTE $0xc6       // cmpq	%rax, %r14
+	JLE  BB0_183
+
+BB0_16:
+	WORD $0x8949; BYTE $0xfa     // movq	%rdi, %r10
+	QUAD $0x0000016024b4894c     // movq	%r14, 352(%rsp)
+	QUAD $0x0000017024848b4c     // movq	368(%rsp), %r8
+	WORD $0x8949; BYTE $0xfb     // movq	%rdi, %r11
+	LONG $0xd5af0f4d             // imulq	%r13, %r10
+	QUAD $0x0000015824bc894c     // movq	%r15, 344(%rsp)
+	QUAD $0x00000168248c8b4c     // movq	360(%rsp), %r9
+	LONG $0x6ef961c4; BYTE $0xea // vmovq	%rdx, %xmm13
+	LONG $0x933c8d4a             // leaq	(%rbx,%r10,4), %rdi
+
+BB0_31:
+	LONG $0x0ffd8349             // cmpq	$15, %r13
+	JLE  BB0_97
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000010b8; BYTE $0x00 // movl	$16, %eax
+
+BB0_23:
+	QUAD $0xff846c10487cd162 // vmovups	-64(%r12,%rax,4), %zmm5
+	QUAD $0xff874cb84855f262 // vfmadd231ps	-64(%rdi,%rax,4), %zmm5, %zmm1
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x394c; BYTE $0xe8 // cmpq	%r13, %rax
+	JLE  BB0_23
+	QUAD $0x00000108248c8b48 // movq	264(%rsp), %rcx
+
+BB0_22:
+	LONG $0x48fdf362; WORD $0xcb1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm3
+	LONG $0xc958e4c5                           // vaddps	%ymm1, %ymm3, %ymm1
+	LONG $0x197de3c4; WORD $0x01cb             // vextractf128	$0x1, %ymm1, %xmm3
+	LONG $0xc958e0c5                           // vaddps	%xmm1, %xmm3, %xmm1
+	LONG $0x0479e3c4; WORD $0x4ed9             // vpermilps	$78, %xmm1, %xmm3
+	LONG $0xd958e0c5                           // vaddps	%xmm1, %xmm3, %xmm3
+	LONG $0xcb28f8c5                           // vmovaps	%xmm3, %xmm1
+	LONG $0xdbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm3
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	WORD $0x3949; BYTE $0xcd                   // cmpq	%rcx, %r13
+	JLE  BB0_24
+	WORD $0x894c; BYTE $0xee                   // movq	%r13, %rsi
+	QUAD $0x00000178248c8948                   // movq	%rcx, 376(%rsp)
+	WORD $0x2948; BYTE $0xce                   // subq	%rcx, %rsi
+	LONG $0xff468d48                           // leaq	-1(%rsi), %rax
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_98
+	LONG $0x01048d4a                           // leaq	(%rcx,%r8), %rax
+	LONG $0x81348d4d                           // leaq	(%r9,%rax,4), %r14
+	LONG $0x11048d4a                           // leaq	(%rcx,%r10), %rax
+	LONG $0x833c8d4c                           // leaq	(%rbx,%rax,4), %r15
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0x04e8c148                           // shrq	$4, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	WORD $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_26:
+	LONG $0x487cd162; WORD $0x2c10; BYTE $0x06 // vmovups	(%r14,%rax), %zmm5
+	LONG $0x4854d162; WORD $0x2459; BYTE $0x07 // vmulps	(%r15,%rax), %zmm5, %zmm4
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0xdcc6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm3
+	LONG $0xfcc6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm7
+	LONG $0x285df362; WORD $0xec03; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm5
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xdc15d8c5                           // vunpckhps	%xmm4, %xmm4, %xmm3
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xe319; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm3
+	LONG $0xcf58f2c5                           // vaddss	%xmm7, %xmm1, %xmm1
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0x285df362; WORD $0xdc03; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm3
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0x285df362; WORD $0xdc03; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm3
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0x487df362; WORD $0xe31b; BYTE $0x01 // vextractf32x8	$0x1, %zmm4, %ymm3
+	LONG $0xfbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm7
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xebc6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm5
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xcf58f2c5                           // vaddss	%xmm7, %xmm1, %xmm1
+	LONG $0xfb15e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm7
+	LONG $0xcf58f2c5                           // vaddss	%xmm7, %xmm1, %xmm1
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xdd19; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm5
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x2865f362; WORD $0xeb03; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm5
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x2865f362; WORD $0xeb03; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm5
+	LONG $0x2865f362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm3
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JNE  BB0_26
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x0fc6f640                           // testb	$15, %sil
+	JE   BB0_24
+
+BB0_25:
+	WORD $0x2948; BYTE $0xc6                   // subq	%rax, %rsi
+	LONG $0xff568d48                           // leaq	-1(%rsi), %rdx
+	LONG $0x06fa8348                           // cmpq	$6, %rdx
+	JBE  BB0_29
+	QUAD $0x0000017824948b48                   // movq	376(%rsp), %rdx
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x02148d4a                           // leaq	(%rdx,%r8), %rdx
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+	LONG $0x1c10fcc5; BYTE $0x83               // vmovups	(%rbx,%rax,4), %ymm3
+	LONG $0x5964c1c4; WORD $0x911c             // vmulps	(%r9,%rdx,4), %ymm3, %ymm3
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	WORD $0xe683; BYTE $0x07                   // andl	$7, %esi
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xfbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm7
+	LONG $0xebc6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm5
+	LONG $0xcf58f2c5                           // vaddss	%xmm7, %xmm1, %xmm1
+	LONG $0xfb15e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm7
+	LONG $0xcf58f2c5                           // vaddss	%xmm7, %xmm1, %xmm1
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xdd19; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm5
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x2865f362; WORD $0xeb03; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm5
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0x2865f362; WORD $0xeb03; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm5
+	LONG $0x2865f362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm3
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	JE   BB0_24
+
+BB0_29:
+	LONG $0x08048d49               // leaq	(%r8,%rcx), %rax
+	LONG $0x0a148d49               // leaq	(%r10,%rcx), %rdx
+	LONG $0x2c10fac5; BYTE $0x93   // vmovss	(%rbx,%rdx,4), %xmm5
+	LONG $0xb951c2c4; WORD $0x810c // vfmadd231ss	(%r9,%rax,4), %xmm5, %xmm1
+	LONG $0x01418d48               // leaq	1(%rcx), %rax
+	WORD $0x394c; BYTE $0xe8       // cmpq	%r13, %rax
+	JGE  BB0_24
+	LONG $0x10148d4a               // leaq	(%rax,%r10), %rdx
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x2c10fac5; BYTE $0x93   // vmovss	(%rbx,%rdx,4), %xmm5
+	LONG $0xb951c2c4; WORD $0x810c // vfmadd231ss	(%r9,%rax,4), %xmm5, %xmm1
+	LONG $0x02418d48               // leaq	2(%rcx), %rax
+	WORD $0x394c; BYTE $0xe8       // cmpq	%r13, %rax
+	JGE  BB0_24
+	LONG $0x10148d4a               // leaq	(%rax,%r10), %rdx
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x2c10fac5; BYTE $0x93   // vmovss	(%rbx,%rdx,4), %xmm5
+	LONG $0xb951c2c4; WORD $0x810c // vfmadd231ss	(%r9,%rax,4), %xmm5, %xmm1
+	LONG $0x03418d48               // leaq	3(%rcx), %rax
+	WORD $0x3949; BYTE $0xc5       // cmpq	%rax, %r13
+	JLE  BB0_24
+	LONG $0x02148d49               // leaq	(%r10,%rax), %rdx
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x2c10fac5; BYTE $0x93   // vmovss	(%rbx,%rdx,4), %xmm5
+	LONG $0xb951c2c4; WORD $0x810c // vfmadd231ss	(%r9,%rax,4), %xmm5, %xmm1
+	LONG $0x04418d48               // leaq	4(%rcx), %rax
+	WORD $0x3949; BYTE $0xc5       // cmpq	%rax, %r13
+	JLE  BB0_24
+	LONG $0x02148d49               // leaq	(%r10,%rax), %rdx
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x2c10fac5; BYTE $0x93   // vmovss	(%rbx,%rdx,4), %xmm5
+	LONG $0xb951c2c4; WORD $0x810c // vfmadd231ss	(%r9,%rax,4), %xmm5, %xmm1
+	LONG $0x05418d48               // leaq	5(%rcx), %rax
+	WORD $0x3949; BYTE $0xc5       // cmpq	%rax, %r13
+	JLE  BB0_24
+	LONG $0x02148d49               // leaq	(%r10,%rax), %rdx
+	LONG $0x06c18348               // addq	$6, %rcx
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x2c10fac5; BYTE $0x93   // vmovss	(%rbx,%rdx,4), %xmm5
+	LONG $0xb951c2c4; WORD $0x810c // vfmadd231ss	(%r9,%rax,4), %xmm5, %xmm1
+	WORD $0x3949; BYTE $0xcd       // cmpq	%rcx, %r13
+	JLE  BB0_24
+	LONG $0x08048d49               // leaq	(%r8,%rcx), %rax
+	WORD $0x014c; BYTE $0xd1       // addq	%r10, %rcx
+	LONG $0x107ac1c4; WORD $0x812c // vmovss	(%r9,%rax,4), %xmm5
+	LONG $0xb951e2c4; WORD $0x8b0c // vfmadd231ss	(%rbx,%rcx,4), %xmm5, %xmm1
+
+BB0_24:
+	LONG $0xc959cac5                     // vmulss	%xmm1, %xmm6, %xmm1
+	QUAD $0x0000015824848b48             // movq	344(%rsp), %rax
+	WORD $0x014d; BYTE $0xea             // addq	%r13, %r10
+	LONG $0x117aa1c4; WORD $0x980c       // vmovss	%xmm1, (%rax,%r11,4)
+	LONG $0x7ef961c4; BYTE $0xe8         // vmovq	%xmm13, %rax
+	LONG $0x01c38349                     // addq	$1, %r11
+	WORD $0x0148; BYTE $0xc7             // addq	%rax, %rdi
+	QUAD $0x00000160249c394c             // cmpq	%r11, 352(%rsp)
+	JG   BB0_31
+	QUAD $0x000000c824bc8348; BYTE $0x00 // cmpq	$0, 200(%rsp)
+	QUAD $0x0000016024b48b4c             // movq	352(%rsp), %r14
+	LONG $0x7ef961c4; BYTE $0xea         // vmovq	%xmm13, %rdx
+	QUAD $0x0000015824bc8b4c             // movq	344(%rsp), %r15
+	JNE  BB0_184
+
+BB0_21:
+	LONG $0x107a41c4; BYTE $0x0f // vmovss	(%r15), %xmm9
+	LONG $0x01fe8349             // cmpq	$1, %r14
+	JLE  BB0_101
+
+BB0_18:
+	QUAD $0x000000e024848b48 // movq	224(%rsp), %rax
+	LONG $0x044f8d49         // leaq	4(%r15), %rcx
+
+BB0_48:
+	LONG         $0x0910fac5               // vmovss	(%rcx), %xmm1
+	LONG         $0x04c18348               // addq	$4, %rcx
+	LONG         $0x5f7241c4; BYTE $0xc9   // vmaxss	%xmm9, %xmm1, %xmm9
+	WORD         $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JNE          BB0_48
+	LONG         $0x487d5262; WORD $0xc118 // vbroadcastss	%xmm9, %zmm8
+	LONG         $0x0ffe8349               // cmpq	$15, %r14
+	JLE          BB0_101
+	QUAD         $0x000000b8248c8b48       // movq	184(%rsp), %rcx
+	LONG         $0xe457d8c5               // vxorps	%xmm4, %xmm4, %xmm4
+	LONG         $0x00007fbf; BYTE $0x00   // movl	$127, %edi
+	QUAD         $0x0000012024848b48       // movq	288(%rsp), %rax
+	VBROADCASTSS CPI0_3<>(SB), Z21         // vbroadcastss	.LCPI0_3(%rip), %zmm21
+	LONG         $0x487df262; WORD $0xff7c // vpbroadcastd	%edi, %zmm7
+	VBROADCASTSS CPI0_5<>(SB), Z20         // vbroadcastss	.LCPI0_5(%rip), %zmm20
+	LONG         $0x487c7162; WORD $0xd428 // vmovaps	%zmm4, %zmm10
+	VBROADCASTSS CPI0_7<>(SB), Z19         // vbroadcastss	.LCPI0_7(%rip), %zmm19
+	LONG         $0xf0e18348               // andq	$-16, %rcx
+	VBROADCASTSS CPI0_9<>(SB), Z18         // vbroadcastss	.LCPI0_9(%rip), %zmm18
+	VBROADCASTSS CPI0_11<>(SB), Z17        // vbroadcastss	.LCPI0_11(%rip), %zmm17
+	WORD         $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	QUAD         $0x0000011824848b48       // movq	280(%rsp), %rax
+	VBROADCASTSS CPI0_13<>(SB), Z16        // vbroadcastss	.LCPI0_13(%rip), %zmm16
+	VBROADCASTSS CPI0_15<>(SB), Z15        // vbroadcastss	.LCPI0_15(%rip), %zmm15
+	VBROADCASTSS CPI0_17<>(SB), Z14        // vbroadcastss	.LCPI0_17(%rip), %zmm14
+	LONG         $0x88748d48; BYTE $0x40   // leaq	64(%rax,%rcx,4), %rsi
+	VBROADCASTSS CPI0_19<>(SB), Z13        // vbroadcastss	.LCPI0_19(%rip), %zmm13
+	WORD         $0x894c; BYTE $0xf9       // movq	%r15, %rcx
+	VBROADCASTSS CPI0_21<>(SB), Z12        // vbroadcastss	.LCPI0_21(%rip), %zmm12
+	VBROADCASTSS CPI0_23<>(SB), Z5         // vbroadcastss	.LCPI0_23(%rip), %zmm5
+	VBROADCASTSS CPI0_0<>(SB), Z11         // vbroadcastss	.LCPI0_0(%rip), %zmm11
+
+BB0_51:
+	LONG $0x487cf162; WORD $0x1910             // vmovups	(%rcx), %zmm3
+	LONG $0x487cb162; WORD $0xc828             // vmovaps	%zmm16, %zmm1
+	LONG $0x40c18348                           // addq	$64, %rcx
+	LONG $0x4864d162; WORD $0xd85c             // vsubps	%zmm8, %zmm3, %zmm3
+	LONG $0x4864a162; WORD $0xf359             // vmulps	%zmm19, %zmm3, %zmm22
+	LONG $0x4864b162; WORD $0xd5c2; BYTE $0x1e // vcmpps	$30, %zmm21, %zmm3, %k2
+	LONG $0x4864b162; WORD $0xccc2; BYTE $0x11 // vcmpps	$17, %zmm20, %zmm3, %k1
+	LONG $0x487da362; WORD $0xf608; BYTE $0x08 // vrndscaleps	$8, %zmm22, %zmm22
+	LONG $0x404db262; WORD $0xdabc             // vfnmadd231ps	%zmm18, %zmm22, %zmm3
+	LONG $0x404db262; WORD $0xd9bc             // vfnmadd231ps	%zmm17, %zmm22, %zmm3
+	LONG $0x487da162; WORD $0xf65b             // vcvtps2dq	%zmm22, %zmm22
+	LONG $0x404de162; WORD $0xf7fe             // vpaddd	%zmm7, %zmm22, %zmm22
+	LONG $0x404db162; WORD $0xf672; BYTE $0x17 // vpslld	$23, %zmm22, %zmm22
+	LONG $0x4805f262; WORD $0xcb98             // vfmadd132ps	%zmm3, %zmm15, %zmm1
+	LONG $0x480df262; WORD $0xcb98             // vfmadd132ps	%zmm3, %zmm14, %zmm1
+	LONG $0x4815f262; WORD $0xcb98             // vfmadd132ps	%zmm3, %zmm13, %zmm1
+	LONG $0x481df262; WORD $0xcb98             // vfmadd132ps	%zmm3, %zmm12, %zmm1
+	LONG $0x4855f262; WORD $0xcb98             // vfmadd132ps	%zmm3, %zmm5, %zmm1
+	LONG $0x4855f262; WORD $0xcb98             // vfmadd132ps	%zmm3, %zmm5, %zmm1
+	LONG $0x4874b162; WORD $0xce59             // vmulps	%zmm22, %zmm1, %zmm1
+	LONG $0x4a7cd162; WORD $0xcb28             // vmovaps	%zmm11, %zmm1{%k2}
+	LONG $0x497cd162; WORD $0xca28             // vmovaps	%zmm10, %zmm1{%k1}
+	LONG $0x487cf162; WORD $0x4911; BYTE $0xff // vmovups	%zmm1, -64(%rcx)
+	LONG $0x485cf162; WORD $0xe158             // vaddps	%zmm1, %zmm4, %zmm4
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JNE  BB0_51
+	QUAD $0x000000c0248c8b48                   // movq	192(%rsp), %rcx
+
+BB0_50:
+	LONG         $0x48fdf362; WORD $0xe11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm1
+	LONG         $0xcc58f4c5                           // vaddps	%ymm4, %ymm1, %ymm1
+	LONG         $0x197de3c4; WORD $0x01cb             // vextractf128	$0x1, %ymm1, %xmm3
+	LONG         $0xd958e0c5                           // vaddps	%xmm1, %xmm3, %xmm3
+	LONG         $0x0479e3c4; WORD $0x4ecb             // vpermilps	$78, %xmm3, %xmm1
+	LONG         $0xcb58f0c5                           // vaddps	%xmm3, %xmm1, %xmm1
+	LONG         $0xe128f8c5                           // vmovaps	%xmm1, %xmm4
+	LONG         $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG         $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	WORD         $0x3949; BYTE $0xce                   // cmpq	%rcx, %r14
+	JLE          BB0_52
+	WORD         $0x894d; BYTE $0xf1                   // movq	%r14, %r9
+	WORD         $0x8949; BYTE $0xca                   // movq	%rcx, %r10
+	WORD         $0x2949; BYTE $0xc9                   // subq	%rcx, %r9
+	LONG         $0xff718d49                           // leaq	-1(%r9), %rsi
+	LONG         $0x0efe8348                           // cmpq	$14, %rsi
+	JBE          BB0_102
+	WORD         $0x894c; BYTE $0xcf                   // movq	%r9, %rdi
+	LONG         $0x03ffb841; WORD $0x0000             // movl	$1023, %r8d
+	QUAD         $0x0000012024848b48                   // movq	288(%rsp), %rax
+	VBROADCASTSS CPI0_0<>(SB), Z11                     // vbroadcastss	.LCPI0_0(%rip), %zmm11
+	LONG         $0x04efc148                           // shrq	$4, %rdi
+	LONG         $0x487d4262; WORD $0xf918             // vbroadcastss	%xmm9, %zmm31
+	VBROADCASTSD CPI0_27<>(SB), Z29                    // vbroadcastsd	.LCPI0_27(%rip), %zmm29
+	VBROADCASTSD CPI0_87<>(SB), Z28                    // vbroadcastsd	.LCPI0_87(%rip), %zmm28
+	LONG         $0x01348d48                           // leaq	(%rcx,%rax), %rsi
+	LONG         $0x06e7c148                           // salq	$6, %rdi
+	QUAD         $0x0000011824848b48                   // movq	280(%rsp), %rax
+	VBROADCASTSD CPI0_86<>(SB), Z27                    // vbroadcastsd	.LCPI0_86(%rip), %zmm27
+	VBROADCASTSD CPI0_33<>(SB), Z26                    // vbroadcastsd	.LCPI0_33(%rip), %zmm26
+	LONG         $0x48fd5262; WORD $0xe07c             // vpbroadcastq	%r8, %zmm12
+	VBROADCASTSD CPI0_35<>(SB), Z25                    // vbroadcastsd	.LCPI0_35(%rip), %zmm25
+	QUAD         $0x00017824b411fac5; BYTE $0x00       // vmovss	%xmm6, 376(%rsp)
+	VBROADCASTSD CPI0_37<>(SB), Z24                    // vbroadcastsd	.LCPI0_37(%rip), %zmm24
+	LONG         $0xb0348d48                           // leaq	(%rax,%rsi,4), %rsi
+	VBROADCASTSD CPI0_39<>(SB), Z23                    // vbroadcastsd	.LCPI0_39(%rip), %zmm23
+	QUAD         $0x000160248c117ac5; BYTE $0x00       // vmovss	%xmm9, 352(%rsp)
+	VBROADCASTSD CPI0_41<>(SB), Z22                    // vbroadcastsd	.LCPI0_41(%rip), %zmm22
+	WORD         $0x0148; BYTE $0xf7                   // addq	%rsi, %rdi
+	VBROADCASTSD CPI0_43<>(SB), Z21                    // vbroadcastsd	.LCPI0_43(%rip), %zmm21
+	VBROADCASTSD CPI0_45<>(SB), Z20                    // vbroadcastsd	.LCPI0_45(%rip), %zmm20
+	VBROADCASTSD CPI0_47<>(SB), Z19                    // vbroadcastsd	.LCPI0_47(%rip), %zmm19
+	VBROADCASTSD CPI0_49<>(SB), Z18                    // vbroadcastsd	.LCPI0_49(%rip), %zmm18
+	VBROADCASTSD CPI0_51<>(SB), Z17                    // vbroadcastsd	.LCPI0_51(%rip), %zmm17
+	VBROADCASTSD CPI0_53<>(SB), Z16                    // vbroadcastsd	.LCPI0_53(%rip), %zmm16
+	VBROADCASTSD CPI0_55<>(SB), Z15                    // vbroadcastsd	.LCPI0_55(%rip), %zmm15
+	VBROADCASTSD CPI0_57<>(SB), Z14                    // vbroadcastsd	.LCPI0_57(%rip), %zmm14
+	VBROADCASTSD CPI0_59<>(SB), Z10                    // vbroadcastsd	.LCPI0_59(%rip), %zmm10
+	VBROADCASTSS CPI0_62<>(SB), Z30                    // vbroadcastss	.LCPI0_62(%rip), %zmm30
+	VBROADCASTSS CPI0_64<>(SB), Z13                    // vbroadcastss	.LCPI0_64(%rip), %zmm13
+
+BB0_54:
+	LONG $0x487cf162; WORD $0x3610             // vmovups	(%rsi), %zmm6
+	LONG $0x48fd9162; WORD $0xcc28             // vmovapd	%zmm28, %zmm1
+	LONG $0x48fd1162; WORD $0xc428             // vmovapd	%zmm28, %zmm8
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0x484c1162; WORD $0xcf5c             // vsubps	%zmm31, %zmm6, %zmm9
+	LONG $0x487cd162; WORD $0xf95a             // vcvtps2pd	%ymm9, %zmm7
+	LONG $0x48c59162; WORD $0xed59             // vmulpd	%zmm29, %zmm7, %zmm5
+	LONG $0x487d7362; WORD $0xce1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm9, %ymm6
+	LONG $0x487cf162; WORD $0xf65a             // vcvtps2pd	%ymm6, %zmm6
+	LONG $0x4834d162; WORD $0xcdc2; BYTE $0x0a // vcmpps	$10, %zmm13, %zmm9, %k1
+	LONG $0x4814d162; WORD $0xd1c2; BYTE $0x01 // vcmpps	$1, %zmm9, %zmm13, %k2
+	LONG $0x49349162; WORD $0xcec2; BYTE $0x05 // vcmpps	$5, %zmm30, %zmm9, %k1{%k1}
+	LONG $0x48d59362; WORD $0xcb25; BYTE $0xf8 // vpternlogq	$248, %zmm27, %zmm5, %zmm1
+	LONG $0x48d5f162; WORD $0xe958             // vaddpd	%zmm1, %zmm5, %zmm5
+	LONG $0x48cd9162; WORD $0xcd59             // vmulpd	%zmm29, %zmm6, %zmm1
+	LONG $0x48fdf362; WORD $0xed09; BYTE $0x03 // vrndscalepd	$3, %zmm5, %zmm5
+	LONG $0x48f51362; WORD $0xc325; BYTE $0xf8 // vpternlogq	$248, %zmm27, %zmm1, %zmm8
+	LONG $0x48f55162; WORD $0xc058             // vaddpd	%zmm8, %zmm1, %zmm8
+	LONG $0x48fd5362; WORD $0xc009; BYTE $0x03 // vrndscalepd	$3, %zmm8, %zmm8
+	LONG $0x48d59262; WORD $0xfabc             // vfnmadd231pd	%zmm26, %zmm5, %zmm7
+	LONG $0x48d59262; WORD $0xf9bc             // vfnmadd231pd	%zmm25, %zmm5, %zmm7
+	LONG $0x48fdf162; WORD $0xed7a             // vcvttpd2qq	%zmm5, %zmm5
+	LONG $0x48d5d162; WORD $0xecd4             // vpaddq	%zmm12, %zmm5, %zmm5
+	LONG $0x48bd9262; WORD $0xf2bc             // vfnmadd231pd	%zmm26, %zmm8, %zmm6
+	LONG $0x48d5f162; WORD $0xf573; BYTE $0x34 // vpsllq	$52, %zmm5, %zmm5
+	LONG $0x48fdf162; WORD $0xdf28             // vmovapd	%zmm7, %zmm3
+	LONG $0x48bd9262; WORD $0xf1bc             // vfnmadd231pd	%zmm25, %zmm8, %zmm6
+	LONG $0x40c59262; WORD $0xd898             // vfmadd132pd	%zmm24, %zmm23, %zmm3
+	LONG $0x48fd5162; WORD $0xc07a             // vcvttpd2qq	%zmm8, %zmm8
+	LONG $0x48bd5162; WORD $0xc4d4             // vpaddq	%zmm12, %zmm8, %zmm8
+	LONG $0x48bdd162; WORD $0xf073; BYTE $0x34 // vpsllq	$52, %zmm8, %zmm8
+	LONG $0x48fdf162; WORD $0xce28             // vmovapd	%zmm6, %zmm1
+	LONG $0x40cdf262; WORD $0xdf98             // vfmadd132pd	%zmm7, %zmm22, %zmm3
+	LONG $0x40c59262; WORD $0xc898             // vfmadd132pd	%zmm24, %zmm23, %zmm1
+	LONG $0x40d5f262; WORD $0xdf98             // vfmadd132pd	%zmm7, %zmm21, %zmm3
+	LONG $0x40cdf262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm22, %zmm1
+	LONG $0x40ddf262; WORD $0xdf98             // vfmadd132pd	%zmm7, %zmm20, %zmm3
+	LONG $0x40d5f262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm21, %zmm1
+	LONG $0x40e5f262; WORD $0xdf98             // vfmadd132pd	%zmm7, %zmm19, %zmm3
+	LONG $0x40ddf262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm20, %zmm1
+	LONG $0x40edf262; WORD $0xdf98             // vfmadd132pd	%zmm7, %zmm18, %zmm3
+	LONG $0x40e5f262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm19, %zmm1
+	LONG $0x40f5f262; WORD $0xdf98             // vfmadd132pd	%zmm7, %zmm17, %zmm3
+	LONG $0x40edf262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm18, %zmm1
+	LONG $0x40fdf262; WORD $0xdf98             // vfmadd132pd	%zmm7, %zmm16, %zmm3
+	LONG $0x40f5f262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm17, %zmm1
+	LONG $0x4885f262; WORD $0xdf98             // vfmadd132pd	%zmm7, %zmm15, %zmm3
+	LONG $0x40fdf262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm16, %zmm1
+	LONG $0x488df262; WORD $0xdf98             // vfmadd132pd	%zmm7, %zmm14, %zmm3
+	LONG $0x4885f262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm15, %zmm1
+	LONG $0x48adf262; WORD $0xdf98             // vfmadd132pd	%zmm7, %zmm10, %zmm3
+	LONG $0x488df262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm14, %zmm1
+	LONG $0x48adf262; WORD $0xdf98             // vfmadd132pd	%zmm7, %zmm10, %zmm3
+	LONG $0x48adf262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm10, %zmm1
+	LONG $0x48e5f162; WORD $0xdd59             // vmulpd	%zmm5, %zmm3, %zmm3
+	LONG $0x48adf262; WORD $0xce98             // vfmadd132pd	%zmm6, %zmm10, %zmm1
+	LONG $0x48fdf162; WORD $0xdb5a             // vcvtpd2ps	%zmm3, %ymm3
+	LONG $0x48f5d162; WORD $0xc859             // vmulpd	%zmm8, %zmm1, %zmm1
+	LONG $0x48fdf162; WORD $0xc95a             // vcvtpd2ps	%zmm1, %ymm1
+	LONG $0x48e5f362; WORD $0xd91a; BYTE $0x01 // vinsertf64x4	$0x1, %ymm1, %zmm3, %zmm3
+	LONG $0xca7cd162; WORD $0xcb28             // vmovaps	%zmm11, %zmm1{%k2}{z}
+	LONG $0x497cf162; WORD $0xcb28             // vmovaps	%zmm3, %zmm1{%k1}
+	LONG $0xf1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm6
+	LONG $0xe9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm5
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm3
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0x487cf162; WORD $0x4e11; BYTE $0xff // vmovups	%zmm1, -64(%rsi)
+	LONG $0xf458cac5                           // vaddss	%xmm4, %xmm6, %xmm6
+	LONG $0xe115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm4
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG $0x287df362; WORD $0xcc19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm4
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0x2875f362; WORD $0xe903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm5
+	LONG $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG $0x2875f362; WORD $0xe103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm4
+	LONG $0x487df362; WORD $0xc91b; BYTE $0x01 // vextractf32x8	$0x1, %zmm1, %ymm1
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xe9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm5
+	LONG $0xdc58e2c5                           // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0xe1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm4
+	LONG $0xdb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm3
+	LONG $0xeb58d2c5                           // vaddss	%xmm3, %xmm5, %xmm5
+	LONG $0xd915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0xdd58e2c5                           // vaddss	%xmm5, %xmm3, %xmm3
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG $0x287df362; WORD $0xcb19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm3
+	LONG $0xe458e2c5                           // vaddss	%xmm4, %xmm3, %xmm4
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm3
+	LONG $0xdc58e2c5                           // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0x2875f362; WORD $0xe103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm4
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	WORD $0x3948; BYTE $0xf7                   // cmpq	%rsi, %rdi
+	JNE  BB0_54
+	QUAD $0x00017824b410fac5; BYTE $0x00       // vmovss	376(%rsp), %xmm6
+	WORD $0x894d; BYTE $0xc8                   // movq	%r9, %r8
+	QUAD $0x000160248c107ac5; BYTE $0x00       // vmovss	352(%rsp), %xmm9
+	LONG $0xf0e08349                           // andq	$-16, %r8
+	WORD $0x014c; BYTE $0xc1                   // addq	%r8, %rcx
+	LONG $0x0fc1f641                           // testb	$15, %r9b
+	JE   BB0_58
+
+BB0_53:
+	WORD         $0x894c; BYTE $0xcf                   // movq	%r9, %rdi
+	WORD         $0x294c; BYTE $0xc7                   // subq	%r8, %rdi
+	LONG         $0xff778d48                           // leaq	-1(%rdi), %rsi
+	LONG         $0x06fe8348                           // cmpq	$6, %rsi
+	JBE          BB0_59
+	QUAD         $0x0000012024848b48                   // movq	288(%rsp), %rax
+	LONG         $0x187dc2c4; BYTE $0xc9               // vbroadcastss	%xmm9, %ymm1
+	VBROADCASTSD CPI0_27<>(SB), Y7                     // vbroadcastsd	.LCPI0_27(%rip), %ymm7
+	VBROADCASTSD CPI0_86<>(SB), Y10                    // vbroadcastsd	.LCPI0_86(%rip), %ymm10
+	LONG         $0x02348d49                           // leaq	(%r10,%rax), %rsi
+	QUAD         $0x0000011824848b48                   // movq	280(%rsp), %rax
+	WORD         $0x014c; BYTE $0xc6                   // addq	%r8, %rsi
+	LONG         $0x03ffb841; WORD $0x0000             // movl	$1023, %r8d
+	LONG         $0xb0348d48                           // leaq	(%rax,%rsi,4), %rsi
+	LONG         $0x2e10fcc5                           // vmovups	(%rsi), %ymm5
+	LONG         $0xe95cd4c5                           // vsubps	%ymm1, %ymm5, %ymm5
+	VBROADCASTSD CPI0_87<>(SB), Y1                     // vbroadcastsd	.LCPI0_87(%rip), %ymm1
+	LONG         $0xe1287dc5                           // vmovapd	%ymm1, %ymm12
+	LONG         $0xdd5a7cc5                           // vcvtps2pd	%xmm5, %ymm11
+	LONG         $0xc75925c5                           // vmulpd	%ymm7, %ymm11, %ymm8
+	LONG         $0x197de3c4; WORD $0x01eb             // vextractf128	$0x1, %ymm5, %xmm3
+	LONG         $0xdb5afcc5                           // vcvtps2pd	%xmm3, %ymm3
+	LONG         $0xff59e5c5                           // vmulpd	%ymm7, %ymm3, %ymm7
+	LONG         $0x28bd5362; WORD $0xe225; BYTE $0xf8 // vpternlogq	$248, %ymm10, %ymm8, %ymm12
+	LONG         $0x28c5d362; WORD $0xca25; BYTE $0xf8 // vpternlogq	$248, %ymm10, %ymm7, %ymm1
+	LONG         $0x583d41c4; BYTE $0xc4               // vaddpd	%ymm12, %ymm8, %ymm8
+	VBROADCASTSD CPI0_35<>(SB), Y10                    // vbroadcastsd	.LCPI0_35(%rip), %ymm10
+	VBROADCASTSD CPI0_39<>(SB), Y12                    // vbroadcastsd	.LCPI0_39(%rip), %ymm12
+	LONG         $0xf958c5c5                           // vaddpd	%ymm1, %ymm7, %ymm7
+	VBROADCASTSD CPI0_33<>(SB), Y1                     // vbroadcastsd	.LCPI0_33(%rip), %ymm1
+	LONG         $0x28fd5362; WORD $0xc009; BYTE $0x03 // vrndscalepd	$3, %ymm8, %ymm8
+	LONG         $0x28fdf362; WORD $0xff09; BYTE $0x03 // vrndscalepd	$3, %ymm7, %ymm7
+	LONG         $0xbcbd62c4; BYTE $0xd9               // vfnmadd231pd	%ymm1, %ymm8, %ymm11
+	LONG         $0x9ce5e2c4; BYTE $0xcf               // vfnmadd132pd	%ymm7, %ymm3, %ymm1
+	LONG         $0xbcbd42c4; BYTE $0xda               // vfnmadd231pd	%ymm10, %ymm8, %ymm11
+	LONG         $0x28fd5162; WORD $0xc07a             // vcvttpd2qq	%ymm8, %ymm8
+	LONG         $0x9cf562c4; BYTE $0xd7               // vfnmadd132pd	%ymm7, %ymm1, %ymm10
+	LONG         $0x28fdf162; WORD $0xff7a             // vcvttpd2qq	%ymm7, %ymm7
+	VBROADCASTSD CPI0_37<>(SB), Y1                     // vbroadcastsd	.LCPI0_37(%rip), %ymm1
+	LONG         $0xdb297dc5                           // vmovapd	%ymm11, %ymm3
+	LONG         $0x989de2c4; BYTE $0xd9               // vfmadd132pd	%ymm1, %ymm12, %ymm3
+	LONG         $0x989dc2c4; BYTE $0xca               // vfmadd132pd	%ymm10, %ymm12, %ymm1
+	VBROADCASTSD CPI0_41<>(SB), Y12                    // vbroadcastsd	.LCPI0_41(%rip), %ymm12
+	LONG         $0x989dc2c4; BYTE $0xca               // vfmadd132pd	%ymm10, %ymm12, %ymm1
+	LONG         $0x989dc2c4; BYTE $0xdb               // vfmadd132pd	%ymm11, %ymm12, %ymm3
+	VBROADCASTSD CPI0_43<>(SB), Y12                    // vbroadcastsd	.LCPI0_43(%rip), %ymm12
+	LONG         $0x989dc2c4; BYTE $0xca               // vfmadd132pd	%ymm10, %ymm12, %ymm1
+	LONG         $0x989dc2c4; BYTE $0xdb               // vfmadd132pd	%ymm11, %ymm12, %ymm3
+	VBROADCASTSD CPI0_45<>(SB), Y12                    // vbroadcastsd	.LCPI0_45(%rip), %ymm12
+	LONG         $0x989dc2c4; BYTE $0xca               // vfmadd132pd	%ymm10, %ymm12, %ymm1
+	LONG         $0x989dc2c4; BYTE $0xdb               // vfmadd132pd	%ymm11, %ymm12, %ymm3
+	VBROADCASTSD CPI0_47<>(SB), Y12                    // vbroadcastsd	.LCPI0_47(%rip), %ymm12
+	LONG         $0x989dc2c4; BYTE $0xca               // vfmadd132pd	%ymm10, %ymm12, %ymm1
+	LONG         $0x989dc2c4; BYTE $0xdb               // vfmadd132pd	%ymm11, %ymm12, %ymm3
+	VBROADCASTSD CPI0_49<>(SB), Y12                    // vbroadcastsd	.LCPI0_49(%rip), %ymm12
+	LONG         $0x989dc2c4; BYTE $0xca               // vfmadd132pd	%ymm10, %ymm12, %ymm1
+	LONG         $0x989dc2c4; BYTE $0xdb               // vfmadd132pd	%ymm11, %ymm12, %ymm3
+	VBROADCASTSD CPI0_51<>(SB), Y12                    // vbroadcastsd	.LCPI0_51(%rip), %ymm12
+	LONG         $0x989dc2c4; BYTE $0xca               // vfmadd132pd	%ymm10, %ymm12, %ymm1
+	LONG         $0x989dc2c4; BYTE $0xdb               // vfmadd132pd	%ymm11, %ymm12, %ymm3
+	VBROADCASTSD CPI0_53<>(SB), Y12                    // vbroadcastsd	.LCPI0_53(%rip), %ymm12
+	LONG         $0x989dc2c4; BYTE $0xca               // vfmadd132pd	%ymm10, %ymm12, %ymm1
+	LONG         $0x989dc2c4; BYTE $0xdb               // vfmadd132pd	%ymm11, %ymm12, %ymm3
+	VBROADCASTSD CPI0_55<>(SB), Y12                    // vbroadcastsd	.LCPI0_55(%rip), %ymm12
+	LONG         $0x989dc2c4; BYTE $0xca               // vfmadd132pd	%ymm10, %ymm12, %ymm1
+	LONG         $0x989dc2c4; BYTE $0xdb               // vfmadd132pd	%ymm11, %ymm12, %ymm3
+	VBROADCASTSD CPI0_57<>(SB), Y12                    // vbroadcastsd	.LCPI0_57(%rip), %ymm12
+	LONG         $0x989dc2c4; BYTE $0xca               // vfmadd132pd	%ymm10, %ymm12, %ymm1
+	LONG         $0x989dc2c4; BYTE $0xdb               // vfmadd132pd	%ymm11, %ymm12, %ymm3
+	VBROADCASTSD CPI0_59<>(SB), Y12                    // vbroadcastsd	.LCPI0_59(%rip), %ymm12
+	LONG         $0x989dc2c4; BYTE $0xca               // vfmadd132pd	%ymm10, %ymm12, %ymm1
+	LONG         $0x989dc2c4; BYTE $0xdb               // vfmadd132pd	%ymm11, %ymm12, %ymm3
+	LONG         $0x989dc2c4; BYTE $0xca               // vfmadd132pd	%ymm10, %ymm12, %ymm1
+	LONG         $0x989dc2c4; BYTE $0xdb               // vfmadd132pd	%ymm11, %ymm12, %ymm3
+	LONG         $0x28fd5262; WORD $0xd07c             // vpbroadcastq	%r8, %ymm10
+	LONG         $0xd43d41c4; BYTE $0xc2               // vpaddq	%ymm10, %ymm8, %ymm8
+	LONG         $0xd445c1c4; BYTE $0xfa               // vpaddq	%ymm10, %ymm7, %ymm7
+	LONG         $0xf773c5c5; BYTE $0x34               // vpsllq	$52, %ymm7, %ymm7
+	LONG         $0x733dc1c4; WORD $0x34f0             // vpsllq	$52, %ymm8, %ymm8
+	LONG         $0xcf59f5c5                           // vmulpd	%ymm7, %ymm1, %ymm1
+	VBROADCASTSS CPI0_62<>(SB), Y7                     // vbroadcastss	.LCPI0_62(%rip), %ymm7
+	LONG         $0x5965c1c4; BYTE $0xd8               // vmulpd	%ymm8, %ymm3, %ymm3
+	LONG         $0xc95afdc5                           // vcvtpd2psy	%ymm1, %xmm1
+	LONG         $0xdb5afdc5                           // vcvtpd2psy	%ymm3, %xmm3
+	LONG         $0x1865e3c4; WORD $0x01c9             // vinsertf128	$0x1, %xmm1, %ymm3, %ymm1
+	VBROADCASTSS CPI0_64<>(SB), Y3                     // vbroadcastss	.LCPI0_64(%rip), %ymm3
+	LONG         $0x2854f162; WORD $0xcbc2; BYTE $0x0a // vcmpps	$10, %ymm3, %ymm5, %k1
+	LONG         $0xddc2e4c5; BYTE $0x01               // vcmpltps	%ymm5, %ymm3, %ymm3
+	LONG         $0x2954f162; WORD $0xcfc2; BYTE $0x05 // vcmpps	$5, %ymm7, %ymm5, %k1{%k1}
+	VBROADCASTSS CPI0_0<>(SB), Y5                      // vbroadcastss	.LCPI0_0(%rip), %ymm5
+	LONG         $0xdd54e4c5                           // vandps	%ymm5, %ymm3, %ymm3
+	LONG         $0x2965f262; WORD $0xc965             // vblendmps	%ymm1, %ymm3, %ymm1{%k1}
+	LONG         $0xe958dac5                           // vaddss	%xmm1, %xmm4, %xmm5
+	LONG         $0xe1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm4
+	LONG         $0xd9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm3
+	LONG         $0x0e11fcc5                           // vmovups	%ymm1, (%rsi)
+	WORD         $0x8948; BYTE $0xfe                   // movq	%rdi, %rsi
+	LONG         $0xf8e68348                           // andq	$-8, %rsi
+	LONG         $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG         $0xe115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm4
+	WORD         $0x0148; BYTE $0xf1                   // addq	%rsi, %rcx
+	WORD         $0xe783; BYTE $0x07                   // andl	$7, %edi
+	LONG         $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG         $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG         $0x287df362; WORD $0xcb19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm3
+	LONG         $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG         $0x2875f362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm3
+	LONG         $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG         $0x2875f362; WORD $0xd903; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm3
+	LONG         $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG         $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG         $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	JE           BB0_58
+
+BB0_59:
+	VMOVSD CPI0_33<>(SB), X12 // vmovsd	.LCPI0_33(%rip), %xmm12
+	VMOVSD CPI0_35<>(SB), X11 // vmovsd	.LCPI0_35(%rip), %xmm11
+	VMOVSD CPI0_37<>(SB), X10 // vmovsd	.LCPI0_37(%rip), %xmm10
+	VMOVSD CPI0_39<>(SB), X8  // vmovsd	.LCPI0_39(%rip), %xmm8
+	VMOVSD CPI0_41<>(SB), X7  // vmovsd	.LCPI0_41(%rip), %xmm7
+
+BB0_63:
+	LONG        $0x107ac1c4; WORD $0x8f1c             // vmovss	(%r15,%rcx,4), %xmm3
+	LONG        $0xc828f8c5                           // vmovaps	%xmm0, %xmm1
+	LONG        $0x5c62c1c4; BYTE $0xd9               // vsubss	%xmm9, %xmm3, %xmm3
+	VCOMISS     CPI0_64<>(SB), X3                     // vcomiss	.LCPI0_64(%rip), %xmm3
+	JA          BB0_64
+	VMOVSS      CPI0_62<>(SB), X5                     // vmovss	.LCPI0_62(%rip), %xmm5
+	LONG        $0xc957f0c5                           // vxorps	%xmm1, %xmm1, %xmm1
+	LONG        $0xeb2ff8c5                           // vcomiss	%xmm3, %xmm5
+	JA          BB0_64
+	VMOVQ       CPI0_87<>(SB), X1                     // vmovq	.LCPI0_87(%rip), %xmm1
+	LONG        $0xdb5ae2c5                           // vcvtss2sd	%xmm3, %xmm3, %xmm3
+	VMULSD      CPI0_27<>(SB), X3, X5                 // vmulsd	.LCPI0_27(%rip), %xmm3, %xmm5
+	VMOVSD      CPI0_59<>(SB), X13                    // vmovsd	.LCPI0_59(%rip), %xmm13
+	VPTERNLOGQ  $248, CPI0_86<>(SB), X5, X1           // vpternlogq	$248, .LCPI0_86(%rip), %xmm5, %xmm1
+	LONG        $0xe958d3c5                           // vaddsd	%xmm1, %xmm5, %xmm5
+	LONG        $0x08d5f362; WORD $0xed0b; BYTE $0x03 // vrndscalesd	$3, %xmm5, %xmm5, %xmm5
+	LONG        $0xbdd1c2c4; BYTE $0xdc               // vfnmadd231sd	%xmm12, %xmm5, %xmm3
+	LONG        $0x2cfbe1c4; BYTE $0xc5               // vcvttsd2siq	%xmm5, %rax
+	LONG        $0x03ff0548; WORD $0x0000             // addq	$1023, %rax
+	LONG        $0xbdd1c2c4; BYTE $0xdb               // vfnmadd231sd	%xmm11, %xmm5, %xmm3
+	LONG        $0x34e0c148                           // salq	$52, %rax
+	LONG        $0x6ef9e1c4; BYTE $0xe8               // vmovq	%rax, %xmm5
+	LONG        $0xcb10e3c5                           // vmovsd	%xmm3, %xmm3, %xmm1
+	LONG        $0x99b9c2c4; BYTE $0xca               // vfmadd132sd	%xmm10, %xmm8, %xmm1
+	LONG        $0x99c1e2c4; BYTE $0xcb               // vfmadd132sd	%xmm3, %xmm7, %xmm1
+	VFMADD213SD CPI0_43<>(SB), X3, X1                 // vfmadd213sd	.LCPI0_43(%rip), %xmm3, %xmm1
+	VFMADD213SD CPI0_45<>(SB), X3, X1                 // vfmadd213sd	.LCPI0_45(%rip), %xmm3, %xmm1
+	VFMADD213SD CPI0_47<>(SB), X3, X1                 // vfmadd213sd	.LCPI0_47(%rip), %xmm3, %xmm1
+	VFMADD213SD CPI0_49<>(SB), X3, X1                 // vfmadd213sd	.LCPI0_49(%rip), %xmm3, %xmm1
+	VFMADD213SD CPI0_51<>(SB), X3, X1                 // vfmadd213sd	.LCPI0_51(%rip), %xmm3, %xmm1
+	VFMADD213SD CPI0_53<>(SB), X3, X1                 // vfmadd213sd	.LCPI0_53(%rip), %xmm3, %xmm1
+	VFMADD213SD CPI0_55<>(SB), X3, X1                 // vfmadd213sd	.LCPI0_55(%rip), %xmm3, %xmm1
+	VFMADD213SD CPI0_57<>(SB), X3, X1                 // vfmadd213sd	.LCPI0_57(%rip), %xmm3, %xmm1
+	LONG        $0x9991e2c4; BYTE $0xcb               // vfmadd132sd	%xmm3, %xmm13, %xmm1
+	LONG        $0x9991e2c4; BYTE $0xcb               // vfmadd132sd	%xmm3, %xmm13, %xmm1
+	LONG        $0xcd59f3c5                           // vmulsd	%xmm5, %xmm1, %xmm1
+	LONG        $0xc95af3c5                           // vcvtsd2ss	%xmm1, %xmm1, %xmm1
+
+BB0_64:
+	LONG $0x117ac1c4; WORD $0x8f0c // vmovss	%xmm1, (%r15,%rcx,4)
+	LONG $0x01c18348               // addq	$1, %rcx
+	LONG $0xe158dac5               // vaddss	%xmm1, %xmm4, %xmm4
+	WORD $0x3949; BYTE $0xce       // cmpq	%rcx, %r14
+	JG   BB0_63
+
+BB0_58:
+	VMOVSS CPI0_23<>(SB), X5         // vmovss	.LCPI0_23(%rip), %xmm5
+	LONG   $0xe45ed2c5               // vdivss	%xmm4, %xmm5, %xmm4
+	LONG   $0x487df262; WORD $0xdc18 // vbroadcastss	%xmm4, %zmm3
+	LONG   $0x0ffe8349               // cmpq	$15, %r14
+	JLE    BB0_185
+
+BB0_56:
+	QUAD $0x000000b8248c8b48     // movq	184(%rsp), %rcx
+	QUAD $0x0000012024848b48     // movq	288(%rsp), %rax
+	LONG $0xf0e18348             // andq	$-16, %rcx
+	WORD $0x0148; BYTE $0xc1     // addq	%rax, %rcx
+	QUAD $0x0000011824848b48     // movq	280(%rsp), %rax
+	LONG $0x88748d48; BYTE $0x40 // leaq	64(%rax,%rcx,4), %rsi
+	WORD $0x894c; BYTE $0xf9     // movq	%r15, %rcx
+
+BB0_66:
+	LONG $0x4864f162; WORD $0x0959             // vmulps	(%rcx), %zmm3, %zmm1
+	LONG $0x40c18348                           // addq	$64, %rcx
+	LONG $0x487cf162; WORD $0x4911; BYTE $0xff // vmovups	%zmm1, -64(%rcx)
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JNE  BB0_66
+	QUAD $0x000000c0248c8b48                   // movq	192(%rsp), %rcx
+
+BB0_65:
+	WORD $0x3949; BYTE $0xce       // cmpq	%rcx, %r14
+	JLE  BB0_71
+	WORD $0x894c; BYTE $0xf6       // movq	%r14, %rsi
+	WORD $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	WORD $0x2948; BYTE $0xce       // subq	%rcx, %rsi
+	LONG $0xff468d4c               // leaq	-1(%rsi), %r8
+	LONG $0x0ef88349               // cmpq	$14, %r8
+	JBE  BB0_106
+	QUAD $0x0000012024848b48       // movq	288(%rsp), %rax
+	LONG $0x01048d4c               // leaq	(%rcx,%rax), %r8
+	QUAD $0x0000011824848b48       // movq	280(%rsp), %rax
+	LONG $0x80048d4e               // leaq	(%rax,%r8,4), %r8
+	LONG $0x4864d162; WORD $0x1859 // vmulps	(%r8), %zmm3, %zmm3
+	LONG $0x487cd162; WORD $0x1811 // vmovups	%zmm3, (%r8)
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	LONG $0xf0e08349               // andq	$-16, %r8
+	WORD $0x014c; BYTE $0xc1       // addq	%r8, %rcx
+	LONG $0x0fc6f640               // testb	$15, %sil
+	JE   BB0_71
+
+BB0_57:
+	WORD $0x294c; BYTE $0xc6     // subq	%r8, %rsi
+	LONG $0xff4e8d4c             // leaq	-1(%rsi), %r9
+	LONG $0x06f98349             // cmpq	$6, %r9
+	JBE  BB0_72
+	QUAD $0x0000012024848b48     // movq	288(%rsp), %rax
+	LONG $0x187de2c4; BYTE $0xcc // vbroadcastss	%xmm4, %ymm1
+	WORD $0x0148; BYTE $0xc7     // addq	%rax, %rdi
+	QUAD $0x0000011824848b48     // movq	280(%rsp), %rax
+	WORD $0x014c; BYTE $0xc7     // addq	%r8, %rdi
+	LONG $0xb83c8d48             // leaq	(%rax,%rdi,4), %rdi
+	LONG $0x0f59f4c5             // vmulps	(%rdi), %ymm1, %ymm1
+	LONG $0x0f11fcc5             // vmovups	%ymm1, (%rdi)
+	WORD $0x8948; BYTE $0xf7     // movq	%rsi, %rdi
+	LONG $0xf8e78348             // andq	$-8, %rdi
+	WORD $0x0148; BYTE $0xf9     // addq	%rdi, %rcx
+	WORD $0xe683; BYTE $0x07     // andl	$7, %esi
+	JE   BB0_71
+
+BB0_72:
+	QUAD $0x0000012024848b48 // movq	288(%rsp), %rax
+	QUAD $0x0000011824bc8b48 // movq	280(%rsp), %rdi
+	LONG $0x08348d48         // leaq	(%rax,%rcx), %rsi
+	LONG $0xb7348d48         // leaq	(%rdi,%rsi,4), %rsi
+	LONG $0x0e59dac5         // vmulss	(%rsi), %xmm4, %xmm1
+	LONG $0x0e11fac5         // vmovss	%xmm1, (%rsi)
+	LONG $0x01718d48         // leaq	1(%rcx), %rsi
+	WORD $0x3949; BYTE $0xf6 // cmpq	%rsi, %r14
+	JLE  BB0_71
+	WORD $0x0148; BYTE $0xc6 // addq	%rax, %rsi
+	LONG $0xb7348d48         // leaq	(%rdi,%rsi,4), %rsi
+	LONG $0x0e59dac5         // vmulss	(%rsi), %xmm4, %xmm1
+	LONG $0x0e11fac5         // vmovss	%xmm1, (%rsi)
+	LONG $0x02718d48         // leaq	2(%rcx), %rsi
+	WORD $0x3949; BYTE $0xf6 // cmpq	%rsi, %r14
+	JLE  BB0_71
+	WORD $0x0148; BYTE $0xc6 // addq	%rax, %rsi
+	LONG $0xb7348d48         // leaq	(%rdi,%rsi,4), %rsi
+	LONG $0x0e59dac5         // vmulss	(%rsi), %xmm4, %xmm1
+	LONG $0x0e11fac5         // vmovss	%xmm1, (%rsi)
+	LONG $0x03718d48         // leaq	3(%rcx), %rsi
+	WORD $0x3949; BYTE $0xf6 // cmpq	%rsi, %r14
+	JLE  BB0_71
+	WORD $0x0148; BYTE $0xc6 // addq	%rax, %rsi
+	LONG $0xb7348d48         // leaq	(%rdi,%rsi,4), %rsi
+	LONG $0x0e59dac5         // vmulss	(%rsi), %xmm4, %xmm1
+	LONG $0x0e11fac5         // vmovss	%xmm1, (%rsi)
+	LONG $0x04718d48         // leaq	4(%rcx), %rsi
+	WORD $0x3949; BYTE $0xf6 // cmpq	%rsi, %r14
+	JLE  BB0_71
+	WORD $0x0148; BYTE $0xc6 // addq	%rax, %rsi
+	LONG $0xb7348d48         // leaq	(%rdi,%rsi,4), %rsi
+	LONG $0x0e59dac5         // vmulss	(%rsi), %xmm4, %xmm1
+	LONG $0x0e11fac5         // vmovss	%xmm1, (%rsi)
+	LONG $0x05718d48         // leaq	5(%rcx), %rsi
+	WORD $0x3949; BYTE $0xf6 // cmpq	%rsi, %r14
+	JLE  BB0_71
+	WORD $0x0148; BYTE $0xc6 // addq	%rax, %rsi
+	LONG $0x06c18348         // addq	$6, %rcx
+	LONG $0xb7348d48         // leaq	(%rdi,%rsi,4), %rsi
+	LONG $0x0e59dac5         // vmulss	(%rsi), %xmm4, %xmm1
+	LONG $0x0e11fac5         // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce // cmpq	%rcx, %r14
+	JLE  BB0_71
+	WORD $0x0148; BYTE $0xc1 // addq	%rax, %rcx
+	LONG $0x8f0c8d48         // leaq	(%rdi,%rcx,4), %rcx
+	LONG $0x2159dac5         // vmulss	(%rcx), %xmm4, %xmm4
+	LONG $0x2111fac5         // vmovss	%xmm4, (%rcx)
+
+BB0_71:
+	QUAD $0x00000110248c8b4c     // movq	272(%rsp), %r9
+	WORD $0x3145; BYTE $0xc0     // xorl	%r8d, %r8d
+	LONG $0x000010b9; BYTE $0x00 // movl	$16, %ecx
+	WORD $0xff31                 // xorl	%edi, %edi
+	LONG $0x3ffd8349             // cmpq	$63, %r13
+	JLE  BB0_69
+	QUAD $0x0000017824ac894c     // movq	%r13, 376(%rsp)
+	QUAD $0x00000080249c8b4c     // movq	128(%rsp), %r11
+	QUAD $0x00000158249c8948     // movq	%rbx, 344(%rsp)
+	QUAD $0x000000e024948b4c     // movq	224(%rsp), %r10
+	QUAD $0x000000e8249c8b48     // movq	232(%rsp), %rbx
+	QUAD $0x0000016024a4894c     // movq	%r12, 352(%rsp)
+	WORD $0x8949; BYTE $0xd4     // movq	%rdx, %r12
+
+BB0_68:
+	WORD $0x854d; BYTE $0xf6                   // testq	%r14, %r14
+	JLE  BB0_186
+	LONG $0xff57c0c5                           // vxorps	%xmm7, %xmm7, %xmm7
+	LONG $0x40688d4d                           // leaq	64(%r8), %r13
+	LONG $0x030c8d4a                           // leaq	(%rbx,%r8), %rcx
+	WORD $0x894c; BYTE $0xf8                   // movq	%r15, %rax
+	LONG $0x80908d49; WORD $0x0000; BYTE $0x00 // leaq	128(%r8), %rdx
+	LONG $0xc0b88d49; WORD $0x0000; BYTE $0x00 // leaq	192(%r8), %rdi
+	LONG $0x487cf162; WORD $0xef28             // vmovaps	%zmm7, %zmm5
+	LONG $0x487cf162; WORD $0xe728             // vmovaps	%zmm7, %zmm4
+	LONG $0x487cf162; WORD $0xdf28             // vmovaps	%zmm7, %zmm3
+
+BB0_74:
+	WORD $0x8948; BYTE $0xce                   // movq	%rcx, %rsi
+	LONG $0x487df262; WORD $0x0818             // vbroadcastss	(%rax), %zmm1
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x294c; BYTE $0xc6                   // subq	%r8, %rsi
+	LONG $0x4875f262; WORD $0x19b8             // vfmadd231ps	(%rcx), %zmm1, %zmm3
+	WORD $0x014c; BYTE $0xe1                   // addq	%r12, %rcx
+	LONG $0x4875b262; WORD $0x24b8; BYTE $0x2e // vfmadd231ps	(%rsi,%r13), %zmm1, %zmm4
+	LONG $0x4875f262; WORD $0x2cb8; BYTE $0x16 // vfmadd231ps	(%rsi,%rdx), %zmm1, %zmm5
+	LONG $0x4875f262; WORD $0x3cb8; BYTE $0x3e // vfmadd231ps	(%rsi,%rdi), %zmm1, %zmm7
+	WORD $0x394c; BYTE $0xd0                   // cmpq	%r10, %rax
+	JNE  BB0_74
+
+BB0_76:
+	LONG $0x00c08149; WORD $0x0001; BYTE $0x00 // addq	$256, %r8
+	LONG $0x487cd162; WORD $0x1911             // vmovups	%zmm3, (%r9)
+	LONG $0x00c18149; WORD $0x0001; BYTE $0x00 // addq	$256, %r9
+	LONG $0x487cd162; WORD $0x6111; BYTE $0xfd // vmovups	%zmm4, -192(%r9)
+	LONG $0x487cd162; WORD $0x6911; BYTE $0xfe // vmovups	%zmm5, -128(%r9)
+	LONG $0x487cd162; WORD $0x7911; BYTE $0xff // vmovups	%zmm7, -64(%r9)
+	WORD $0x394d; BYTE $0xc3                   // cmpq	%r8, %r11
+	JNE  BB0_68
+	WORD $0x894c; BYTE $0xe2                   // movq	%r12, %rdx
+	QUAD $0x0000017824ac8b4c                   // movq	376(%rsp), %r13
+	QUAD $0x0000016024a48b4c                   // movq	352(%rsp), %r12
+	QUAD $0x00000158249c8b48                   // movq	344(%rsp), %rbx
+	LONG $0x244c8b48; BYTE $0x70               // movq	112(%rsp), %rcx
+	QUAD $0x0000009024bc8b48                   // movq	144(%rsp), %rdi
+
+BB0_69:
+	WORD $0x3949; BYTE $0xcd // cmpq	%rcx, %r13
+	JL   BB0_77
+	QUAD $0x0000011824848b48 // movq	280(%rsp), %rax
+	QUAD $0x0000012024b48b48 // movq	288(%rsp), %rsi
+	WORD $0x8949; BYTE $0xc9 // movq	%rcx, %r9
+	QUAD $0x000000e024848b4c // movq	224(%rsp), %r8
+	LONG $0xb0148d4c         // leaq	(%rax,%rsi,4), %r10
+	WORD $0x8948; BYTE $0xd8 // movq	%rbx, %rax
+	WORD $0x8948; BYTE $0xcb // movq	%rcx, %rbx
+	WORD $0x894c; BYTE $0xd1 // movq	%r10, %rcx
+	WORD $0x8949; BYTE $0xc2 // movq	%rax, %r10
+
+BB0_78:
+	WORD $0x8949; BYTE $0xfb // movq	%rdi, %r11
+	LONG $0xc957f0c5         // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0x894c; BYTE $0xcf // movq	%r9, %rdi
+	WORD $0x854d; BYTE $0xf6 // testq	%r14, %r14
+	JLE  BB0_81
+	QUAD $0x000000e824848b48 // movq	232(%rsp), %rax
+	LONG $0xc957f0c5         // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x98348d4a         // leaq	(%rax,%r11,4), %rsi
+	WORD $0x8948; BYTE $0xc8 // movq	%rcx, %rax
+
+BB0_79:
+	LONG $0x487df262; WORD $0x2818 // vbroadcastss	(%rax), %zmm5
+	LONG $0x04c08348               // addq	$4, %rax
+	LONG $0x4855f262; WORD $0x0eb8 // vfmadd231ps	(%rsi), %zmm5, %zmm1
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	WORD $0x394c; BYTE $0xc0       // cmpq	%r8, %rax
+	JNE  BB0_79
+
+BB0_81:
+	QUAD $0x0000017024848b48                   // movq	368(%rsp), %rax
+	LONG $0x10c18349                           // addq	$16, %r9
+	WORD $0x0149; BYTE $0xc3                   // addq	%rax, %r11
+	QUAD $0x000000d824848b48                   // movq	216(%rsp), %rax
+	LONG $0x487cb162; WORD $0x0c11; BYTE $0x98 // vmovups	%zmm1, (%rax,%r11,4)
+	WORD $0x394d; BYTE $0xcd                   // cmpq	%r9, %r13
+	JGE  BB0_78
+	WORD $0x8948; BYTE $0xd9                   // movq	%rbx, %rcx
+	WORD $0x894c; BYTE $0xef                   // movq	%r13, %rdi
+	WORD $0x894c; BYTE $0xd3                   // movq	%r10, %rbx
+	WORD $0x2948; BYTE $0xcf                   // subq	%rcx, %rdi
+	LONG $0xf0e78348                           // andq	$-16, %rdi
+	WORD $0x0148; BYTE $0xcf                   // addq	%rcx, %rdi
+
+BB0_77:
+	WORD $0x3949; BYTE $0xfd     // cmpq	%rdi, %r13
+	JLE  BB0_82
+	LONG $0x244c8b48; BYTE $0x60 // movq	96(%rsp), %rcx
+	WORD $0x894d; BYTE $0xf2     // movq	%r14, %r10
+	QUAD $0x000000e824848b48     // movq	232(%rsp), %rax
+	QUAD $0x0000015024a4894c     // movq	%r12, 336(%rsp)
+	LONG $0x03e28341             // andl	$3, %r10d
+	QUAD $0x00000120249c8b4c     // movq	288(%rsp), %r11
+	QUAD $0x0000011824a48b4c     // movq	280(%rsp), %r12
+	QUAD $0x0000016024bc894c     // movq	%r15, 352(%rsp)
+	LONG $0x39348d4a             // leaq	(%rcx,%r15), %rsi
+	LONG $0x24448b4c; BYTE $0x38 // movq	56(%rsp), %r8
+	QUAD $0x00000100248c8b48     // movq	256(%rsp), %rcx
+	QUAD $0x000001582494894c     // movq	%r10, 344(%rsp)
+	QUAD $0x00000148249c8948     // movq	%rbx, 328(%rsp)
+	LONG $0xb80c8d4c             // leaq	(%rax,%rdi,4), %r9
+	WORD $0x8949; BYTE $0xd7     // movq	%rdx, %r15
+	WORD $0x8948; BYTE $0xc3     // movq	%rax, %rbx
+	QUAD $0x00000178248c8948     // movq	%rcx, 376(%rsp)
+
+BB0_83:
+	LONG $0xdb57e0c5                     // vxorps	%xmm3, %xmm3, %xmm3
+	WORD $0x854d; BYTE $0xf6             // testq	%r14, %r14
+	JLE  BB0_88
+	QUAD $0x000000f824bc8348; BYTE $0x02 // cmpq	$2, 248(%rsp)
+	JBE  BB0_108
+	QUAD $0x0000016024948b4c             // movq	352(%rsp), %r10
+	WORD $0x894c; BYTE $0xc8             // movq	%r9, %rax
+	QUAD $0x00000178248c8b48             // movq	376(%rsp), %rcx
+	LONG $0xdb57e0c5                     // vxorps	%xmm3, %xmm3, %xmm3
+
+BB0_85:
+	LONG $0x107aa1c4; WORD $0x7824             // vmovss	(%rax,%r15,2), %xmm4
+	LONG $0x0810fac5                           // vmovss	(%rax), %xmm1
+	LONG $0x10c28349                           // addq	$16, %r10
+	LONG $0x2159a3c4; WORD $0x0024; BYTE $0x10 // vinsertps	$0x10, (%rax,%r8), %xmm4, %xmm4
+	LONG $0x2171a3c4; WORD $0x380c; BYTE $0x10 // vinsertps	$0x10, (%rax,%r15), %xmm1, %xmm1
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0xcc16f0c5                           // vmovlhps	%xmm4, %xmm1, %xmm1
+	LONG $0x5970c1c4; WORD $0xf04a             // vmulps	-16(%r10), %xmm1, %xmm1
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0xe1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm4
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG $0xd915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0xc9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xdc58e2c5                           // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	WORD $0x394c; BYTE $0xd6                   // cmpq	%r10, %rsi
+	JNE  BB0_85
+	QUAD $0x0000015824bc8348; BYTE $0x00       // cmpq	$0, 344(%rsp)
+	QUAD $0x00000178248c8948                   // movq	%rcx, 376(%rsp)
+	JE   BB0_88
+	QUAD $0x000000f024848b48                   // movq	240(%rsp), %rax
+
+BB0_84:
+	WORD $0x894d; BYTE $0xea       // movq	%r13, %r10
+	LONG $0x03148d49               // leaq	(%r11,%rax), %rdx
+	LONG $0xd0af0f4c               // imulq	%rax, %r10
+	LONG $0x6ef9e1c4; BYTE $0xca   // vmovq	%rdx, %xmm1
+	LONG $0x7ef9e1c4; BYTE $0xc9   // vmovq	%xmm1, %rcx
+	LONG $0x107ac1c4; WORD $0x8c2c // vmovss	(%r12,%rcx,4), %xmm5
+	LONG $0x3a148d49               // leaq	(%r10,%rdi), %rdx
+	LONG $0xb951e2c4; WORD $0x931c // vfmadd231ss	(%rbx,%rdx,4), %xmm5, %xmm3
+	LONG $0x01508d48               // leaq	1(%rax), %rdx
+	WORD $0x394c; BYTE $0xf2       // cmpq	%r14, %rdx
+	JGE  BB0_88
+	WORD $0x014d; BYTE $0xea       // addq	%r13, %r10
+	LONG $0x1a0c8d4a               // leaq	(%rdx,%r11), %rcx
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x3a148d49               // leaq	(%r10,%rdi), %rdx
+	LONG $0x107ac1c4; WORD $0x8c2c // vmovss	(%r12,%rcx,4), %xmm5
+	LONG $0xb951e2c4; WORD $0x931c // vfmadd231ss	(%rbx,%rdx,4), %xmm5, %xmm3
+	WORD $0x3949; BYTE $0xc6       // cmpq	%rax, %r14
+	JLE  BB0_88
+	LONG $0x3d548d49; BYTE $0x00   // leaq	0(%r13,%rdi), %rdx
+	WORD $0x014c; BYTE $0xd8       // addq	%r11, %rax
+	WORD $0x0149; BYTE $0xd2       // addq	%rdx, %r10
+	LONG $0x107aa1c4; WORD $0x932c // vmovss	(%rbx,%r10,4), %xmm5
+	LONG $0xb951c2c4; WORD $0x841c // vfmadd231ss	(%r12,%rax,4), %xmm5, %xmm3
+
+BB0_88:
+	QUAD $0x0000011024848b48     // movq	272(%rsp), %rax
+	LONG $0x04c18349             // addq	$4, %r9
+	LONG $0x1c11fac5; BYTE $0xb8 // vmovss	%xmm3, (%rax,%rdi,4)
+	LONG $0x01c78348             // addq	$1, %rdi
+	WORD $0x3949; BYTE $0xfd     // cmpq	%rdi, %r13
+	JNE  BB0_83
+	WORD $0x894c; BYTE $0xfa     // movq	%r15, %rdx
+	QUAD $0x0000015024a48b4c     // movq	336(%rsp), %r12
+	QUAD $0x0000016024bc8b4c     // movq	352(%rsp), %r15
+	QUAD $0x00000148249c8b48     // movq	328(%rsp), %rbx
+
+BB0_82:
+	QUAD $0x0000009824bc8b48             // movq	152(%rsp), %rdi
+	QUAD $0x0000017024ac014c             // addq	%r13, 368(%rsp)
+	WORD $0x0149; BYTE $0xd4             // addq	%rdx, %r12
+	QUAD $0x000000d024848348; BYTE $0x01 // addq	$1, 208(%rsp)
+	QUAD $0x000000d024848b48             // movq	208(%rsp), %rax
+	QUAD $0x0000011024940148             // addq	%rdx, 272(%rsp)
+	WORD $0x0149; BYTE $0xff             // addq	%rdi, %r15
+	QUAD $0x0000012024b4014c             // addq	%r14, 288(%rsp)
+	QUAD $0x000000e024bc0148             // addq	%rdi, 224(%rsp)
+	QUAD $0x000000a024843948             // cmpq	%rax, 160(%rsp)
+	JG   BB0_89
+	WORD $0xf8c5; BYTE $0x77             // vzeroupper
+
+BB0_180:
+	LONG $0x50a58d48; WORD $0xfffe; BYTE $0xff // leaq	-432(%rbp), %rsp
+	RET
+
+BB0_186:
+	LONG $0xff57c0c5               // vxorps	%xmm7, %xmm7, %xmm7
+	LONG $0x487cf162; WORD $0xef28 // vmovaps	%zmm7, %zmm5
+	LONG $0x487cf162; WORD $0xe728 // vmovaps	%zmm7, %zmm4
+	LONG $0x487cf162; WORD $0xdf28 // vmovaps	%zmm7, %zmm3
+	JMP  BB0_76
+
+BB0_93:
+	LONG $0xed57d1c5               // vxorpd	%xmm5, %xmm5, %xmm5
+	WORD $0xc931                   // xorl	%ecx, %ecx
+	LONG $0x48fdf162; WORD $0xe528 // vmovapd	%zmm5, %zmm4
+	LONG $0x48fdf162; WORD $0xdd28 // vmovapd	%zmm5, %zmm3
+	LONG $0x48fdf162; WORD $0xfd28 // vmovapd	%zmm5, %zmm7
+	JMP  BB0_5
+
+BB0_94:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_8
+
+BB0_108:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+	JMP  BB0_84
+
+BB0_184:
+	LONG $0x0ffe8349 // cmpq	$15, %r14
+	JLE  BB0_35
+
+BB0_33:
+	QUAD $0x000000c024bc8b48 // movq	192(%rsp), %rdi
+	QUAD $0x0000012024b48b48 // movq	288(%rsp), %rsi
+	WORD $0x894c; BYTE $0xf9 // movq	%r15, %rcx
+	QUAD $0x0000011824848b48 // movq	280(%rsp), %rax
+	WORD $0x0148; BYTE $0xfe // addq	%rdi, %rsi
+	QUAD $0x000000c824bc8b48 // movq	200(%rsp), %rdi
+	WORD $0x2948; BYTE $0xc1 // subq	%rax, %rcx
+	LONG $0x02e6c148         // salq	$2, %rsi
+
+BB0_36:
+	LONG $0x487cf162; WORD $0x2c10; BYTE $0x08 // vmovups	(%rax,%rcx), %zmm5
+	LONG $0x4854f162; WORD $0x0c58; BYTE $0x0f // vaddps	(%rdi,%rcx), %zmm5, %zmm1
+	LONG $0x487cf162; WORD $0x0c11; BYTE $0x08 // vmovups	%zmm1, (%rax,%rcx)
+	LONG $0x40c18348                           // addq	$64, %rcx
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JNE  BB0_36
+	QUAD $0x000000c024848b48                   // movq	192(%rsp), %rax
+	WORD $0x3949; BYTE $0xc6                   // cmpq	%rax, %r14
+	JLE  BB0_174
+	WORD $0x8949; BYTE $0xc2                   // movq	%rax, %r10
+
+BB0_38:
+	WORD $0x894d; BYTE $0xf1     // movq	%r14, %r9
+	QUAD $0x0000012024848b48     // movq	288(%rsp), %rax
+	WORD $0x294d; BYTE $0xd1     // subq	%r10, %r9
+	LONG $0xff418d4d             // leaq	-1(%r9), %r8
+	LONG $0x02348d49             // leaq	(%r10,%rax), %rsi
+	LONG $0x06f88349             // cmpq	$6, %r8
+	JBE  BB0_40
+	WORD $0x394d; BYTE $0xf2     // cmpq	%r14, %r10
+	JGE  BB0_40
+	QUAD $0x0000011824848b48     // movq	280(%rsp), %rax
+	QUAD $0x00000000b51c8d4c     // leaq	0(,%rsi,4), %r11
+	LONG $0x183c8d4a             // leaq	(%rax,%r11), %rdi
+	QUAD $0x000000c824848b48     // movq	200(%rsp), %rax
+	LONG $0x184c8d4a; BYTE $0x04 // leaq	4(%rax,%r11), %rcx
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	WORD $0x2948; BYTE $0xc8     // subq	%rcx, %rax
+	LONG $0x38f88348             // cmpq	$56, %rax
+	JA   BB0_187
+
+BB0_40:
+	QUAD $0x0000011824848b48     // movq	280(%rsp), %rax
+	QUAD $0x000000c824bc8b48     // movq	200(%rsp), %rdi
+	LONG $0xb00c8d48             // leaq	(%rax,%rsi,4), %rcx
+	LONG $0x0910fac5             // vmovss	(%rcx), %xmm1
+	LONG $0x0c58f2c5; BYTE $0xb7 // vaddss	(%rdi,%rsi,4), %xmm1, %xmm1
+	LONG $0x0911fac5             // vmovss	%xmm1, (%rcx)
+	LONG $0x014a8d49             // leaq	1(%r10), %rcx
+	WORD $0x394c; BYTE $0xf1     // cmpq	%r14, %rcx
+	JGE  BB0_21
+	QUAD $0x00000120249c8b4c     // movq	288(%rsp), %r11
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x024a8d49             // leaq	2(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x394c; BYTE $0xf1     // cmpq	%r14, %rcx
+	JGE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x034a8d49             // leaq	3(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x394c; BYTE $0xf1     // cmpq	%r14, %rcx
+	JGE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x044a8d49             // leaq	4(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x394c; BYTE $0xf1     // cmpq	%r14, %rcx
+	JGE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x054a8d49             // leaq	5(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x394c; BYTE $0xf1     // cmpq	%r14, %rcx
+	JGE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x064a8d49             // leaq	6(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce     // cmpq	%rcx, %r14
+	JLE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x074a8d49             // leaq	7(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce     // cmpq	%rcx, %r14
+	JLE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x084a8d49             // leaq	8(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce     // cmpq	%rcx, %r14
+	JLE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x094a8d49             // leaq	9(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce     // cmpq	%rcx, %r14
+	JLE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x0a4a8d49             // leaq	10(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce     // cmpq	%rcx, %r14
+	JLE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x0b4a8d49             // leaq	11(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x394c; BYTE $0xf1     // cmpq	%r14, %rcx
+	JGE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x0c4a8d49             // leaq	12(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x394c; BYTE $0xf1     // cmpq	%r14, %rcx
+	JGE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x0d4a8d49             // leaq	13(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce     // cmpq	%rcx, %r14
+	JLE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x0e4a8d49             // leaq	14(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce     // cmpq	%rcx, %r14
+	JLE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x0f4a8d49             // leaq	15(%r10), %rcx
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce     // cmpq	%rcx, %r14
+	JLE  BB0_174
+	WORD $0x014c; BYTE $0xd9     // addq	%r11, %rcx
+	LONG $0x88348d48             // leaq	(%rax,%rcx,4), %rsi
+	LONG $0x0e10fac5             // vmovss	(%rsi), %xmm1
+	LONG $0x0c58f2c5; BYTE $0x8f // vaddss	(%rdi,%rcx,4), %xmm1, %xmm1
+	LONG $0x0e11fac5             // vmovss	%xmm1, (%rsi)
+
+BB0_174:
+	LONG $0x107a41c4; BYTE $0x0f // vmovss	(%r15), %xmm9
+	JMP  BB0_18
+
+BB0_97:
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0xc931     // xorl	%ecx, %ecx
+	JMP  BB0_22
+
+BB0_98:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_25
+
+BB0_183:
+	QUAD $0x000000c824bc8348; BYTE $0x00 // cmpq	$0, 200(%rsp)
+	JE   BB0_174
+	LONG $0x0ffe8349                     // cmpq	$15, %r14
+	JG   BB0_33
+
+BB0_34:
+	WORD $0x3145; BYTE $0xd2 // xorl	%r10d, %r10d
+	JMP  BB0_38
+
+BB0_187:
+	WORD $0x394d; BYTE $0xf2                   // cmpq	%r14, %r10
+	LONG $0x000001b9; BYTE $0x00               // movl	$1, %ecx
+	LONG $0xc94c0f49                           // cmovl	%r9, %rcx
+	LONG $0x0ef88349                           // cmpq	$14, %r8
+	JBE  BB0_99
+	QUAD $0x000000c824848b48                   // movq	200(%rsp), %rax
+	LONG $0x487cb162; WORD $0x2c10; BYTE $0x18 // vmovups	(%rax,%r11), %zmm5
+	LONG $0x4854f162; WORD $0x0f58             // vaddps	(%rdi), %zmm5, %zmm1
+	LONG $0x487cf162; WORD $0x0f11             // vmovups	%zmm1, (%rdi)
+	WORD $0x8948; BYTE $0xcf                   // movq	%rcx, %rdi
+	LONG $0xf0e78348                           // andq	$-16, %rdi
+	WORD $0x0149; BYTE $0xfa                   // addq	%rdi, %r10
+	WORD $0xc1f6; BYTE $0x0f                   // testb	$15, %cl
+	JE   BB0_21
+
+BB0_41:
+	WORD $0x2948; BYTE $0xf9     // subq	%rdi, %rcx
+	LONG $0xff418d4c             // leaq	-1(%rcx), %r8
+	LONG $0x06f88349             // cmpq	$6, %r8
+	JBE  BB0_43
+	QUAD $0x0000011824848b48     // movq	280(%rsp), %rax
+	WORD $0x0148; BYTE $0xf7     // addq	%rsi, %rdi
+	LONG $0xb8348d48             // leaq	(%rax,%rdi,4), %rsi
+	QUAD $0x000000c824848b48     // movq	200(%rsp), %rax
+	LONG $0x2c10fcc5; BYTE $0xb8 // vmovups	(%rax,%rdi,4), %ymm5
+	LONG $0x0e58d4c5             // vaddps	(%rsi), %ymm5, %ymm1
+	LONG $0x0e11fcc5             // vmovups	%ymm1, (%rsi)
+	WORD $0x8948; BYTE $0xce     // movq	%rcx, %rsi
+	LONG $0xf8e68348             // andq	$-8, %rsi
+	WORD $0x0149; BYTE $0xf2     // addq	%rsi, %r10
+	WORD $0xe183; BYTE $0x07     // andl	$7, %ecx
+	JE   BB0_21
+
+BB0_43:
+	QUAD $0x0000012024848b48       // movq	288(%rsp), %rax
+	QUAD $0x0000011824bc8b48       // movq	280(%rsp), %rdi
+	QUAD $0x000000c8249c8b4c       // movq	200(%rsp), %r11
+	LONG $0x10348d4a               // leaq	(%rax,%r10), %rsi
+	LONG $0xb70c8d48               // leaq	(%rdi,%rsi,4), %rcx
+	LONG $0x0910fac5               // vmovss	(%rcx), %xmm1
+	LONG $0x5872c1c4; WORD $0xb30c // vaddss	(%r11,%rsi,4), %xmm1, %xmm1
+	LONG $0x0911fac5               // vmovss	%xmm1, (%rcx)
+	LONG $0x014a8d49               // leaq	1(%r10), %rcx
+	WORD $0x3949; BYTE $0xce       // cmpq	%rcx, %r14
+	JLE  BB0_21
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0x8f348d48               // leaq	(%rdi,%rcx,4), %rsi
+	LONG $0x0e10fac5               // vmovss	(%rsi), %xmm1
+	LONG $0x5872c1c4; WORD $0x8b0c // vaddss	(%r11,%rcx,4), %xmm1, %xmm1
+	LONG $0x024a8d49               // leaq	2(%r10), %rcx
+	LONG $0x0e11fac5               // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce       // cmpq	%rcx, %r14
+	JLE  BB0_21
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0x8f348d48               // leaq	(%rdi,%rcx,4), %rsi
+	LONG $0x0e10fac5               // vmovss	(%rsi), %xmm1
+	LONG $0x5872c1c4; WORD $0x8b0c // vaddss	(%r11,%rcx,4), %xmm1, %xmm1
+	LONG $0x034a8d49               // leaq	3(%r10), %rcx
+	LONG $0x0e11fac5               // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce       // cmpq	%rcx, %r14
+	JLE  BB0_21
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0x8f348d48               // leaq	(%rdi,%rcx,4), %rsi
+	LONG $0x0e10fac5               // vmovss	(%rsi), %xmm1
+	LONG $0x5872c1c4; WORD $0x8b0c // vaddss	(%r11,%rcx,4), %xmm1, %xmm1
+	LONG $0x044a8d49               // leaq	4(%r10), %rcx
+	LONG $0x0e11fac5               // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce       // cmpq	%rcx, %r14
+	JLE  BB0_21
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0x8f348d48               // leaq	(%rdi,%rcx,4), %rsi
+	LONG $0x0e10fac5               // vmovss	(%rsi), %xmm1
+	LONG $0x5872c1c4; WORD $0x8b0c // vaddss	(%r11,%rcx,4), %xmm1, %xmm1
+	LONG $0x054a8d49               // leaq	5(%r10), %rcx
+	LONG $0x0e11fac5               // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce       // cmpq	%rcx, %r14
+	JLE  BB0_21
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0x8f348d48               // leaq	(%rdi,%rcx,4), %rsi
+	LONG $0x0e10fac5               // vmovss	(%rsi), %xmm1
+	LONG $0x5872c1c4; WORD $0x8b0c // vaddss	(%r11,%rcx,4), %xmm1, %xmm1
+	LONG $0x064a8d49               // leaq	6(%r10), %rcx
+	LONG $0x0e11fac5               // vmovss	%xmm1, (%rsi)
+	WORD $0x3949; BYTE $0xce       // cmpq	%rcx, %r14
+	JLE  BB0_21
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+	LONG $0x8f348d48               // leaq	(%rdi,%rcx,4), %rsi
+	LONG $0x0e10fac5               // vmovss	(%rsi), %xmm1
+	LONG $0x5872c1c4; WORD $0x8b0c // vaddss	(%r11,%rcx,4), %xmm1, %xmm1
+	LONG $0x0e11fac5               // vmovss	%xmm1, (%rsi)
+	LONG $0x107a41c4; BYTE $0x0f   // vmovss	(%r15), %xmm9
+	LONG $0x01fe8349               // cmpq	$1, %r14
+	JG   BB0_18
+
+BB0_101:
+	LONG $0xe457d9c5 // vxorpd	%xmm4, %xmm4, %xmm4
+	WORD $0xc931     // xorl	%ecx, %ecx
+	JMP  BB0_50
+
+BB0_4:
+	WORD $0xff31                 // xorl	%edi, %edi
+	WORD $0x854d; BYTE $0xf6     // testq	%r14, %r14
+	JG   BB0_16
+	LONG $0x107a41c4; BYTE $0x0f // vmovss	(%r15), %xmm9
+	JMP  BB0_101
+
+BB0_52:
+	VMOVSS CPI0_23<>(SB), X5         // vmovss	.LCPI0_23(%rip), %xmm5
+	LONG   $0xe45ed2c5               // vdivss	%xmm4, %xmm5, %xmm4
+	LONG   $0x487df262; WORD $0xdc18 // vbroadcastss	%xmm4, %zmm3
+	LONG   $0x0ffe8349               // cmpq	$15, %r14
+	JG     BB0_56
+	WORD   $0xc931                   // xorl	%ecx, %ecx
+	JMP    BB0_65
+
+BB0_185:
+	WORD $0x894c; BYTE $0xf6 // movq	%r14, %rsi
+	WORD $0xff31             // xorl	%edi, %edi
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	WORD $0xc931             // xorl	%ecx, %ecx
+	JMP  BB0_57
+
+BB0_102:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_53
+
+BB0_35:
+	LONG $0x107a41c4; BYTE $0x0f // vmovss	(%r15), %xmm9
+	WORD $0x854d; BYTE $0xf6     // testq	%r14, %r14
+	JG   BB0_34
+	JMP  BB0_101
+
+BB0_106:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_57
+
+BB0_99:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_41
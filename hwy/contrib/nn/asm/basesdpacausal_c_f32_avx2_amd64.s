@@ -0,0 +1,1308 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basesdpacausal_c_f32_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x7f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_10<>+0(SB)/4, $0x3fb8aa3b
+DATA CPI0_10<>+4(SB)/4, $0x3fb8aa3b
+DATA CPI0_10<>+8(SB)/4, $0x3fb8aa3b
+DATA CPI0_10<>+12(SB)/4, $0x3fb8aa3b
+DATA CPI0_10<>+16(SB)/4, $0x3fb8aa3b
+DATA CPI0_10<>+20(SB)/4, $0x3fb8aa3b
+DATA CPI0_10<>+24(SB)/4, $0x3fb8aa3b
+DATA CPI0_10<>+28(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_10<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_12<>+0(SB)/4, $0x3f318000
+DATA CPI0_12<>+4(SB)/4, $0x3f318000
+DATA CPI0_12<>+8(SB)/4, $0x3f318000
+DATA CPI0_12<>+12(SB)/4, $0x3f318000
+DATA CPI0_12<>+16(SB)/4, $0x3f318000
+DATA CPI0_12<>+20(SB)/4, $0x3f318000
+DATA CPI0_12<>+24(SB)/4, $0x3f318000
+DATA CPI0_12<>+28(SB)/4, $0x3f318000
+GLOBL CPI0_12<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_14<>+0(SB)/4, $0xb95e8083
+DATA CPI0_14<>+4(SB)/4, $0xb95e8083
+DATA CPI0_14<>+8(SB)/4, $0xb95e8083
+DATA CPI0_14<>+12(SB)/4, $0xb95e8083
+DATA CPI0_14<>+16(SB)/4, $0xb95e8083
+DATA CPI0_14<>+20(SB)/4, $0xb95e8083
+DATA CPI0_14<>+24(SB)/4, $0xb95e8083
+DATA CPI0_14<>+28(SB)/4, $0xb95e8083
+GLOBL CPI0_14<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_17<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_17<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_18<>+0(SB)/4, $0x3c088889
+DATA CPI0_18<>+4(SB)/4, $0x3c088889
+DATA CPI0_18<>+8(SB)/4, $0x3c088889
+DATA CPI0_18<>+12(SB)/4, $0x3c088889
+DATA CPI0_18<>+16(SB)/4, $0x3c088889
+DATA CPI0_18<>+20(SB)/4, $0x3c088889
+DATA CPI0_18<>+24(SB)/4, $0x3c088889
+DATA CPI0_18<>+28(SB)/4, $0x3c088889
+GLOBL CPI0_18<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_2<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_2<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_21<>+0(SB)/4, $0x3d2aaaab
+GLOBL CPI0_21<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_23<>+0(SB)/4, $0x3e2aaaab
+GLOBL CPI0_23<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_25<>+0(SB)/4, $0x3f000000
+GLOBL CPI0_25<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_29<>+0(SB)/4, $0x44314000
+GLOBL CPI0_29<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_30<>+0(SB)/4, $0xc4314000
+GLOBL CPI0_30<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_31<>+0(SB)/4, $0x652b82fe
+DATA CPI0_31<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_31<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_32<>+0(SB)/4, $0x00000000
+DATA CPI0_32<>+4(SB)/4, $0x80000000
+DATA CPI0_32<>+8(SB)/4, $0x00000000
+DATA CPI0_32<>+12(SB)/4, $0x00000000
+GLOBL CPI0_32<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_33<>+0(SB)/4, $0xffffffff
+DATA CPI0_33<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_33<>+8(SB)/4, $0x00000000
+DATA CPI0_33<>+12(SB)/4, $0x00000000
+GLOBL CPI0_33<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_34<>+0(SB)/4, $0xfee00000
+DATA CPI0_34<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_34<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_35<>+0(SB)/4, $0x35793c6c
+DATA CPI0_35<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_35<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_36<>+0(SB)/4, $0xeff8d898
+DATA CPI0_36<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_36<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_37<>+0(SB)/4, $0x67f544e4
+DATA CPI0_37<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_37<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_38<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_38<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_38<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_39<>+0(SB)/4, $0xa556c734
+DATA CPI0_39<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_39<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_4<>+0(SB)/4, $0xff800000
+GLOBL CPI0_4<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_40<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_40<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_40<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_41<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_41<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_41<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_42<>+0(SB)/4, $0x16c16c17
+DATA CPI0_42<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_42<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_43<>+0(SB)/4, $0x11111111
+DATA CPI0_43<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_43<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_44<>+0(SB)/4, $0x55555555
+DATA CPI0_44<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_44<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_45<>+0(SB)/4, $0x55555555
+DATA CPI0_45<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_45<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_46<>+0(SB)/4, $0x00000000
+DATA CPI0_46<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_46<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_47<>+0(SB)/4, $0x00000000
+DATA CPI0_47<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_47<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_7<>+0(SB)/4, $0x42b17218
+GLOBL CPI0_7<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_8<>+0(SB)/4, $0xc2aeac50
+DATA CPI0_8<>+4(SB)/4, $0xc2aeac50
+DATA CPI0_8<>+8(SB)/4, $0xc2aeac50
+DATA CPI0_8<>+12(SB)/4, $0xc2aeac50
+DATA CPI0_8<>+16(SB)/4, $0xc2aeac50
+DATA CPI0_8<>+20(SB)/4, $0xc2aeac50
+DATA CPI0_8<>+24(SB)/4, $0xc2aeac50
+DATA CPI0_8<>+28(SB)/4, $0xc2aeac50
+GLOBL CPI0_8<>(SB), (RODATA|NOPTR), $32
+
+TEXT ·sdpacausal_c_f32_avx2(SB), $448-112
+	MOVQ q+0(FP), DI
+	MOVQ k+8(FP), SI
+	MOVQ v+16(FP), DX
+	MOVQ scores+24(FP), CX
+	MOVQ output+32(FP), R8
+	MOVQ pseqLen+40(FP), R9
+	MOVQ pkvLen+48(FP), R11
+	MOVQ R11, 384(SP)
+	MOVQ pheadDim+56(FP), R11
+	MOVQ R11, 392(SP)
+	MOVQ pscale+64(FP), R11
+	MOVQ R11, 400(SP)
+	MOVQ plen_q+72(FP), R11
+	MOVQ R11, 408(SP)
+	MOVQ plen_k+80(FP), R11
+	MOVQ R11, 416(SP)
+	MOVQ plen_v+88(FP), R11
+	MOVQ R11, 424(SP)
+	MOVQ plen_scores+96(FP), R11
+	MOVQ R11, 432(SP)
+	MOVQ plen_output+104(FP), R11
+	MOVQ R11, 440(SP)
+	WORD $0x8949; BYTE $0xca                   // movq	%rcx, %r10
+	QUAD $0x0000017024ac8d48                   // leaq	368(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348                           // andq	$-32, %rsp
+	LONG $0x18458b48                           // movq	24(%rbp), %rax
+	QUAD $0x000000d024948948                   // movq	%rdx, 208(%rsp)
+	WORD $0x8b49; BYTE $0x11                   // movq	(%r9), %rdx
+	WORD $0x8b48; BYTE $0x18                   // movq	(%rax), %rbx
+	LONG $0x10458b48                           // movq	16(%rbp), %rax
+	QUAD $0x000000b0248c8948                   // movq	%rcx, 176(%rsp)
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	QUAD $0x0000014824bc8948                   // movq	%rdi, 328(%rsp)
+	WORD $0x8b4c; BYTE $0x20                   // movq	(%rax), %r12
+	WORD $0x940f; BYTE $0xc0                   // sete	%al
+	QUAD $0x000000902484894c                   // movq	%r8, 144(%rsp)
+	WORD $0x854d; BYTE $0xe4                   // testq	%r12, %r12
+	WORD $0x940f; BYTE $0xc1                   // sete	%cl
+	WORD $0xc808                               // orb	%cl, %al
+	JNE  BB0_138
+	WORD $0x8548; BYTE $0xdb                   // testq	%rbx, %rbx
+	JE   BB0_138
+	WORD $0x894c; BYTE $0xe1                   // movq	%r12, %rcx
+	WORD $0x2948; BYTE $0xd1                   // subq	%rdx, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JLE  BB0_138
+	LONG $0x0a548d48; BYTE $0x01               // leaq	1(%rdx,%rcx), %rdx
+	LONG $0x03fc8349                           // cmpq	$3, %r12
+	LONG $0x20458b48                           // movq	32(%rbp), %rax
+	WORD $0x8949; BYTE $0xff                   // movq	%rdi, %r15
+	LONG $0x24548948; BYTE $0x68               // movq	%rdx, 104(%rsp)
+	WORD $0x8948; BYTE $0xda                   // movq	%rbx, %rdx
+	LONG $0x01598d4c                           // leaq	1(%rcx), %r11
+	QUAD $0x000000009d348d4c                   // leaq	0(,%rbx,4), %r14
+	LONG $0x24449f0f; BYTE $0x5f               // setg	95(%rsp)
+	LONG $0x04e2c148                           // salq	$4, %rdx
+	LONG $0x0810fac5                           // vmovss	(%rax), %xmm1
+	WORD $0xff31                               // xorl	%edi, %edi
+	QUAD $0x000000c824948948                   // movq	%rdx, 200(%rsp)
+	LONG $0x1b148d48                           // leaq	(%rbx,%rbx), %rdx
+	QUAD $0x00000000a5048d4a                   // leaq	0(,%r12,4), %rax
+	QUAD $0x000000b82484894c                   // movq	%r8, 184(%rsp)
+	WORD $0x8949; BYTE $0xf0                   // movq	%rsi, %r8
+	LONG $0x36348d4a                           // leaq	(%rsi,%r14), %rsi
+	LONG $0xc1c6f0c5; BYTE $0x00               // vshufps	$0, %xmm1, %xmm1, %xmm0
+	LONG $0x24548948; BYTE $0x20               // movq	%rdx, 32(%rsp)
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	QUAD $0x00000000952c8d4c                   // leaq	0(,%rdx,4), %r13
+	LONG $0x24748948; BYTE $0x30               // movq	%rsi, 48(%rsp)
+	WORD $0x014c; BYTE $0xf6                   // addq	%r14, %rsi
+	LONG $0x24548948; BYTE $0x10               // movq	%rdx, 16(%rsp)
+	LONG $0xf8538d48                           // leaq	-8(%rbx), %rdx
+	LONG $0x03eac148                           // shrq	$3, %rdx
+	LONG $0x24748948; BYTE $0x38               // movq	%rsi, 56(%rsp)
+	WORD $0x014c; BYTE $0xf6                   // addq	%r14, %rsi
+	LONG $0x24748948; BYTE $0x40               // movq	%rsi, 64(%rsp)
+	QUAD $0x00000008d5348d48                   // leaq	8(,%rdx,8), %rsi
+	LONG $0xe0538d48                           // leaq	-32(%rbx), %rdx
+	QUAD $0x000000c024b48948                   // movq	%rsi, 192(%rsp)
+	LONG $0x24748d49; BYTE $0xf8               // leaq	-8(%r12), %rsi
+	LONG $0x05eac148                           // shrq	$5, %rdx
+	QUAD $0x0000008824b48948                   // movq	%rsi, 136(%rsp)
+	LONG $0x03eec148                           // shrq	$3, %rsi
+	LONG $0x01c28348                           // addq	$1, %rdx
+	QUAD $0x00000008f5348d48                   // leaq	8(,%rsi,8), %rsi
+	LONG $0x24448948; BYTE $0x60               // movq	%rax, 96(%rsp)
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+	QUAD $0x0000008024b48948                   // movq	%rsi, 128(%rsp)
+	WORD $0x8948; BYTE $0xd6                   // movq	%rdx, %rsi
+	LONG $0x05e2c148                           // salq	$5, %rdx
+	LONG $0x07e6c148                           // salq	$7, %rsi
+	LONG $0x24548948; BYTE $0x50               // movq	%rdx, 80(%rsp)
+	LONG $0x24748948; BYTE $0x48               // movq	%rsi, 72(%rsp)
+	LONG $0x08728d48                           // leaq	8(%rdx), %rsi
+	WORD $0x894c; BYTE $0xe2                   // movq	%r12, %rdx
+	LONG $0x24748948; BYTE $0x18               // movq	%rsi, 24(%rsp)
+	LONG $0x02eac148                           // shrq	$2, %rdx
+	LONG $0x24748d49; BYTE $0xff               // leaq	-1(%r12), %rsi
+	QUAD $0x000000a824b48948                   // movq	%rsi, 168(%rsp)
+	WORD $0x894c; BYTE $0xe6                   // movq	%r12, %rsi
+	LONG $0x04e2c148                           // salq	$4, %rdx
+	LONG $0xfce68348                           // andq	$-4, %rsi
+	LONG $0x24548948; BYTE $0x28               // movq	%rdx, 40(%rsp)
+	QUAD $0x000000a024b48948                   // movq	%rsi, 160(%rsp)
+	QUAD $0x000001182494894c                   // movq	%r10, 280(%rsp)
+	QUAD $0x000001502484c748; LONG $0x00000000 // movq	$0, 336(%rsp)
+	QUAD $0x0000009824848948                   // movq	%rax, 152(%rsp)
+	QUAD $0x0000010024a4894c                   // movq	%r12, 256(%rsp)
+	WORD $0x8949; BYTE $0xdc                   // movq	%rbx, %r12
+	WORD $0x8948; BYTE $0xfb                   // movq	%rdi, %rbx
+	LONG $0x246c894c; BYTE $0x08               // movq	%r13, 8(%rsp)
+	WORD $0x894d; BYTE $0xfd                   // movq	%r15, %r13
+
+BB0_70:
+	LONG $0x03fb8349                           // cmpq	$3, %r11
+	JLE  BB0_5
+	LONG $0x5f247c80; BYTE $0x00               // cmpb	$0, 95(%rsp)
+	JE   BB0_5
+	QUAD $0x0000010024848b48                   // movq	256(%rsp), %rax
+	LONG $0x245c8948; BYTE $0x78               // movq	%rbx, 120(%rsp)
+	WORD $0x894d; BYTE $0xc7                   // movq	%r8, %r15
+	QUAD $0x0000012024ac894c                   // movq	%r13, 288(%rsp)
+	LONG $0x24748b48; BYTE $0x40               // movq	64(%rsp), %rsi
+	WORD $0x394c; BYTE $0xd8                   // cmpq	%r11, %rax
+	QUAD $0x000000d824b4894c                   // movq	%r14, 216(%rsp)
+	LONG $0x244c8b48; BYTE $0x38               // movq	56(%rsp), %rcx
+	LONG $0xc34f0f49                           // cmovg	%r11, %rax
+	LONG $0x245c894c; BYTE $0x70               // movq	%r11, 112(%rsp)
+	LONG $0x24548b4c; BYTE $0x30               // movq	48(%rsp), %r10
+	QUAD $0x000001582484c748; LONG $0x00000000 // movq	$0, 344(%rsp)
+	QUAD $0x000000e024848948                   // movq	%rax, 224(%rsp)
+	LONG $0x24448b48; BYTE $0x10               // movq	16(%rsp), %rax
+	QUAD $0x000001082484c748; LONG $0x00000003 // movq	$3, 264(%rsp)
+	QUAD $0x0000014024848948                   // movq	%rax, 320(%rsp)
+	LONG $0x24448b48; BYTE $0x20               // movq	32(%rsp), %rax
+	QUAD $0x0000013024848948                   // movq	%rax, 304(%rsp)
+
+BB0_14:
+	QUAD $0x0000015824848b48     // movq	344(%rsp), %rax
+	WORD $0x014c; BYTE $0xe0     // addq	%r12, %rax
+	QUAD $0x0000012824848948     // movq	%rax, 296(%rsp)
+	LONG $0x07fc8349             // cmpq	$7, %r12
+	JLE  BB0_72
+	LONG $0xdb57e0c5             // vxorps	%xmm3, %xmm3, %xmm3
+	QUAD $0x0000012024ac8b4c     // movq	288(%rsp), %r13
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	LONG $0xe328fcc5             // vmovaps	%ymm3, %ymm4
+	LONG $0xeb28fcc5             // vmovaps	%ymm3, %ymm5
+	LONG $0xf328fcc5             // vmovaps	%ymm3, %ymm6
+
+BB0_7:
+	LONG $0x107cc1c4; WORD $0x8554; BYTE $0xe0 // vmovups	-32(%r13,%rax,4), %ymm2
+	LONG $0xb86dc2c4; WORD $0x8774; BYTE $0xe0 // vfmadd231ps	-32(%r15,%rax,4), %ymm2, %ymm6
+	LONG $0xb86dc2c4; WORD $0x826c; BYTE $0xe0 // vfmadd231ps	-32(%r10,%rax,4), %ymm2, %ymm5
+	LONG $0xb86de2c4; WORD $0x8164; BYTE $0xe0 // vfmadd231ps	-32(%rcx,%rax,4), %ymm2, %ymm4
+	LONG $0xb86de2c4; WORD $0x865c; BYTE $0xe0 // vfmadd231ps	-32(%rsi,%rax,4), %ymm2, %ymm3
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x394c; BYTE $0xe0                   // cmpq	%r12, %rax
+	JLE  BB0_7
+	QUAD $0x0000012024ac894c                   // movq	%r13, 288(%rsp)
+	QUAD $0x000000c024948b48                   // movq	192(%rsp), %rdx
+
+BB0_6:
+	LONG $0x197de3c4; WORD $0x01f2 // vextractf128	$0x1, %ymm6, %xmm2
+	LONG $0xd658e8c5               // vaddps	%xmm6, %xmm2, %xmm2
+	LONG $0xf212e8c5               // vmovhlps	%xmm2, %xmm2, %xmm6
+	LONG $0xd658e8c5               // vaddps	%xmm6, %xmm2, %xmm2
+	LONG $0xf216fac5               // vmovshdup	%xmm2, %xmm6
+	LONG $0xd658eac5               // vaddss	%xmm6, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01ee // vextractf128	$0x1, %ymm5, %xmm6
+	LONG $0xed58c8c5               // vaddps	%xmm5, %xmm6, %xmm5
+	LONG $0xf512d0c5               // vmovhlps	%xmm5, %xmm5, %xmm6
+	LONG $0xee58d0c5               // vaddps	%xmm6, %xmm5, %xmm5
+	LONG $0xf516fac5               // vmovshdup	%xmm5, %xmm6
+	LONG $0xf658d2c5               // vaddss	%xmm6, %xmm5, %xmm6
+	LONG $0x197de3c4; WORD $0x01e5 // vextractf128	$0x1, %ymm4, %xmm5
+	LONG $0xe458d0c5               // vaddps	%xmm4, %xmm5, %xmm4
+	LONG $0xd614e8c5               // vunpcklps	%xmm6, %xmm2, %xmm2
+	LONG $0xec12d8c5               // vmovhlps	%xmm4, %xmm4, %xmm5
+	LONG $0xe558d8c5               // vaddps	%xmm5, %xmm4, %xmm4
+	LONG $0xec16fac5               // vmovshdup	%xmm4, %xmm5
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0x197de3c4; WORD $0x01dd // vextractf128	$0x1, %ymm3, %xmm5
+	LONG $0xdd58e0c5               // vaddps	%xmm5, %xmm3, %xmm3
+	LONG $0xeb12e0c5               // vmovhlps	%xmm3, %xmm3, %xmm5
+	LONG $0xdb58d0c5               // vaddps	%xmm3, %xmm5, %xmm3
+	LONG $0xeb16fac5               // vmovshdup	%xmm3, %xmm5
+	LONG $0xdd58e2c5               // vaddss	%xmm5, %xmm3, %xmm3
+	LONG $0xe314d8c5               // vunpcklps	%xmm3, %xmm4, %xmm4
+	LONG $0xd416e8c5               // vmovlhps	%xmm4, %xmm2, %xmm2
+	WORD $0x3949; BYTE $0xd4       // cmpq	%rdx, %r12
+	JLE  BB0_8
+	WORD $0x894c; BYTE $0xe0       // movq	%r12, %rax
+	WORD $0x8948; BYTE $0xd7       // movq	%rdx, %rdi
+	WORD $0x2948; BYTE $0xd0       // subq	%rdx, %rax
+	QUAD $0x0000011024848948       // movq	%rax, 272(%rsp)
+	LONG $0x01e88348               // subq	$1, %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_73
+	QUAD $0x00000150249c8b48       // movq	336(%rsp), %rbx
+	QUAD $0x00000128249c8b4c       // movq	296(%rsp), %r11
+	QUAD $0x000000e824a4894c       // movq	%r12, 232(%rsp)
+	QUAD $0x00000130248c8b4c       // movq	304(%rsp), %r9
+	QUAD $0x0000014024ac8b4c       // movq	320(%rsp), %r13
+	LONG $0x13048d48               // leaq	(%rbx,%rdx), %rax
+	QUAD $0x00000148249c8b48       // movq	328(%rsp), %rbx
+	LONG $0x83348d4c               // leaq	(%rbx,%rax,4), %r14
+	QUAD $0x00000158249c8b48       // movq	344(%rsp), %rbx
+	LONG $0x13048d48               // leaq	(%rbx,%rdx), %rax
+	LONG $0x801c8d49               // leaq	(%r8,%rax,4), %rbx
+	LONG $0x13048d49               // leaq	(%r11,%rdx), %rax
+	LONG $0x801c8d4d               // leaq	(%r8,%rax,4), %r11
+	LONG $0x11048d49               // leaq	(%r9,%rdx), %rax
+	LONG $0x800c8d4d               // leaq	(%r8,%rax,4), %r9
+	LONG $0x15448d49; BYTE $0x00   // leaq	0(%r13,%rdx), %rax
+	LONG $0x802c8d4d               // leaq	(%r8,%rax,4), %r13
+	QUAD $0x0000011024848b48       // movq	272(%rsp), %rax
+	QUAD $0x000000f024ac894c       // movq	%r13, 240(%rsp)
+	QUAD $0x0000012024ac8b4c       // movq	288(%rsp), %r13
+	LONG $0x03e8c148               // shrq	$3, %rax
+	QUAD $0x000000f024a48b4c       // movq	240(%rsp), %r12
+	QUAD $0x000000f024948948       // movq	%rdx, 240(%rsp)
+	LONG $0x05e0c148               // salq	$5, %rax
+	QUAD $0x000000f824848948       // movq	%rax, 248(%rsp)
+	QUAD $0x000000f824948b48       // movq	248(%rsp), %rdx
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_10:
+	LONG $0x107cc1c4; WORD $0x0634 // vmovups	(%r14,%rax), %ymm6
+	LONG $0x0c594cc5; BYTE $0x03   // vmulps	(%rbx,%rax), %ymm6, %ymm9
+	LONG $0x594cc1c4; WORD $0x013c // vmulps	(%r9,%rax), %ymm6, %ymm7
+	LONG $0x594c41c4; WORD $0x0304 // vmulps	(%r11,%rax), %ymm6, %ymm8
+	LONG $0x594cc1c4; WORD $0x0434 // vmulps	(%r12,%rax), %ymm6, %ymm6
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xc630c1c4; WORD $0xffd9 // vshufps	$255, %xmm9, %xmm9, %xmm3
+	LONG $0xefc6c0c5; BYTE $0xff   // vshufps	$255, %xmm7, %xmm7, %xmm5
+	LONG $0x1430c1c4; BYTE $0xe0   // vunpcklps	%xmm8, %xmm9, %xmm4
+	LONG $0xc63841c4; WORD $0x55e8 // vshufps	$85, %xmm8, %xmm8, %xmm13
+	LONG $0xc63841c4; WORD $0xffd0 // vshufps	$255, %xmm8, %xmm8, %xmm10
+	LONG $0x1460c1c4; BYTE $0xda   // vunpcklps	%xmm10, %xmm3, %xmm3
+	LONG $0xe61440c5               // vunpcklps	%xmm6, %xmm7, %xmm12
+	LONG $0xf6c648c5; BYTE $0x55   // vshufps	$85, %xmm6, %xmm6, %xmm14
+	LONG $0xdec648c5; BYTE $0xff   // vshufps	$255, %xmm6, %xmm6, %xmm11
+	LONG $0x1450c1c4; BYTE $0xeb   // vunpcklps	%xmm11, %xmm5, %xmm5
+	LONG $0x1658c1c4; BYTE $0xe4   // vmovlhps	%xmm12, %xmm4, %xmm4
+	LONG $0xe7c640c5; BYTE $0x55   // vshufps	$85, %xmm7, %xmm7, %xmm12
+	LONG $0x141841c4; BYTE $0xe6   // vunpcklps	%xmm14, %xmm12, %xmm12
+	LONG $0xf61548c5               // vunpckhps	%xmm6, %xmm6, %xmm14
+	LONG $0xe258d8c5               // vaddps	%xmm2, %xmm4, %xmm4
+	LONG $0xc630c1c4; WORD $0x55d1 // vshufps	$85, %xmm9, %xmm9, %xmm2
+	LONG $0x1468c1c4; BYTE $0xd5   // vunpcklps	%xmm13, %xmm2, %xmm2
+	LONG $0x153841c4; BYTE $0xe8   // vunpckhps	%xmm8, %xmm8, %xmm13
+	LONG $0x1668c1c4; BYTE $0xd4   // vmovlhps	%xmm12, %xmm2, %xmm2
+	LONG $0xe71540c5               // vunpckhps	%xmm7, %xmm7, %xmm12
+	LONG $0xdd16e0c5               // vmovlhps	%xmm5, %xmm3, %xmm3
+	LONG $0x141841c4; BYTE $0xe6   // vunpcklps	%xmm14, %xmm12, %xmm12
+	LONG $0x197d43c4; WORD $0x01c0 // vextractf128	$0x1, %ymm8, %xmm8
+	LONG $0x197de3c4; WORD $0x01f6 // vextractf128	$0x1, %ymm6, %xmm6
+	LONG $0xe258d8c5               // vaddps	%xmm2, %xmm4, %xmm4
+	LONG $0x1530c1c4; BYTE $0xd1   // vunpckhps	%xmm9, %xmm9, %xmm2
+	LONG $0xd6c648c5; BYTE $0x55   // vshufps	$85, %xmm6, %xmm6, %xmm10
+	LONG $0x1468c1c4; BYTE $0xd5   // vunpcklps	%xmm13, %xmm2, %xmm2
+	LONG $0x1668c1c4; BYTE $0xd4   // vmovlhps	%xmm12, %xmm2, %xmm2
+	LONG $0xe258d8c5               // vaddps	%xmm2, %xmm4, %xmm4
+	LONG $0x197d63c4; WORD $0x01ca // vextractf128	$0x1, %ymm9, %xmm2
+	LONG $0xc63841c4; WORD $0x55c8 // vshufps	$85, %xmm8, %xmm8, %xmm9
+	LONG $0x1468c1c4; BYTE $0xe8   // vunpcklps	%xmm8, %xmm2, %xmm5
+	LONG $0xdb58d8c5               // vaddps	%xmm3, %xmm4, %xmm3
+	LONG $0x197de3c4; WORD $0x01fc // vextractf128	$0x1, %ymm7, %xmm4
+	LONG $0xfe14d8c5               // vunpcklps	%xmm6, %xmm4, %xmm7
+	LONG $0xef16d0c5               // vmovlhps	%xmm7, %xmm5, %xmm5
+	LONG $0xfcc6d8c5; BYTE $0x55   // vshufps	$85, %xmm4, %xmm4, %xmm7
+	LONG $0x1440c1c4; BYTE $0xfa   // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0xd61548c5               // vunpckhps	%xmm6, %xmm6, %xmm10
+	LONG $0xdd58e0c5               // vaddps	%xmm5, %xmm3, %xmm3
+	LONG $0xeac6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm5
+	LONG $0x1450c1c4; BYTE $0xe9   // vunpcklps	%xmm9, %xmm5, %xmm5
+	LONG $0x153841c4; BYTE $0xc8   // vunpckhps	%xmm8, %xmm8, %xmm9
+	LONG $0xef16d0c5               // vmovlhps	%xmm7, %xmm5, %xmm5
+	LONG $0xfc15d8c5               // vunpckhps	%xmm4, %xmm4, %xmm7
+	LONG $0xc63841c4; WORD $0xffc0 // vshufps	$255, %xmm8, %xmm8, %xmm8
+	LONG $0xe4c6d8c5; BYTE $0xff   // vshufps	$255, %xmm4, %xmm4, %xmm4
+	LONG $0x1440c1c4; BYTE $0xfa   // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0xf6c6c8c5; BYTE $0xff   // vshufps	$255, %xmm6, %xmm6, %xmm6
+	LONG $0xe614d8c5               // vunpcklps	%xmm6, %xmm4, %xmm4
+	LONG $0xdd58e0c5               // vaddps	%xmm5, %xmm3, %xmm3
+	LONG $0xea15e8c5               // vunpckhps	%xmm2, %xmm2, %xmm5
+	LONG $0xd2c6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm2
+	LONG $0x1468c1c4; BYTE $0xd0   // vunpcklps	%xmm8, %xmm2, %xmm2
+	LONG $0x1450c1c4; BYTE $0xe9   // vunpcklps	%xmm9, %xmm5, %xmm5
+	LONG $0xd416e8c5               // vmovlhps	%xmm4, %xmm2, %xmm2
+	LONG $0xef16d0c5               // vmovlhps	%xmm7, %xmm5, %xmm5
+	LONG $0xdd58e0c5               // vaddps	%xmm5, %xmm3, %xmm3
+	LONG $0xd258e0c5               // vaddps	%xmm2, %xmm3, %xmm2
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JNE  BB0_10
+	QUAD $0x00000110249c8b48       // movq	272(%rsp), %rbx
+	QUAD $0x000000f024948b48       // movq	240(%rsp), %rdx
+	QUAD $0x0000012024ac894c       // movq	%r13, 288(%rsp)
+	QUAD $0x000000e824a48b4c       // movq	232(%rsp), %r12
+	WORD $0x8948; BYTE $0xd8       // movq	%rbx, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	WORD $0xe383; BYTE $0x07       // andl	$7, %ebx
+	JE   BB0_8
+
+BB0_9:
+	QUAD $0x00000110249c8b4c       // movq	272(%rsp), %r11
+	LONG $0xc21568c5               // vunpckhps	%xmm2, %xmm2, %xmm8
+	LONG $0xe228f8c5               // vmovaps	%xmm2, %xmm4
+	LONG $0xcac668c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm9
+	LONG $0xeac6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm5
+	WORD $0x2949; BYTE $0xc3       // subq	%rax, %r11
+	LONG $0xff4b8d4d               // leaq	-1(%r11), %r9
+	LONG $0x02f98349               // cmpq	$2, %r9
+	JBE  BB0_12
+	QUAD $0x00000150249c8b48       // movq	336(%rsp), %rbx
+	LONG $0x030c8d4c               // leaq	(%rbx,%rax), %r9
+	QUAD $0x00000148249c8b48       // movq	328(%rsp), %rbx
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x1078a1c4; WORD $0x8b1c // vmovups	(%rbx,%r9,4), %xmm3
+	QUAD $0x00000158249c8b48       // movq	344(%rsp), %rbx
+	LONG $0x030c8d4c               // leaq	(%rbx,%rax), %r9
+	QUAD $0x00000128249c8b48       // movq	296(%rsp), %rbx
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x596081c4; WORD $0x883c // vmulps	(%r8,%r9,4), %xmm3, %xmm7
+	LONG $0x030c8d4c               // leaq	(%rbx,%rax), %r9
+	QUAD $0x00000130249c8b48       // movq	304(%rsp), %rbx
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	LONG $0x596081c4; WORD $0x8834 // vmulps	(%r8,%r9,4), %xmm3, %xmm6
+	LONG $0x030c8d4c               // leaq	(%rbx,%rax), %r9
+	QUAD $0x00000140249c8b48       // movq	320(%rsp), %rbx
+	WORD $0x0149; BYTE $0xf9       // addq	%rdi, %r9
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	LONG $0xd458c2c5               // vaddss	%xmm4, %xmm7, %xmm2
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+	LONG $0xefc640c5; BYTE $0x55   // vshufps	$85, %xmm7, %xmm7, %xmm13
+	LONG $0xe558cac5               // vaddss	%xmm5, %xmm6, %xmm4
+	LONG $0x596081c4; WORD $0x882c // vmulps	(%r8,%r9,4), %xmm3, %xmm5
+	LONG $0xe6c648c5; BYTE $0x55   // vshufps	$85, %xmm6, %xmm6, %xmm12
+	LONG $0xde1548c5               // vunpckhps	%xmm6, %xmm6, %xmm11
+	LONG $0x5960c1c4; WORD $0x801c // vmulps	(%r8,%rax,4), %xmm3, %xmm3
+	LONG $0xea5812c5               // vaddss	%xmm2, %xmm13, %xmm13
+	LONG $0xd715c0c5               // vunpckhps	%xmm7, %xmm7, %xmm2
+	WORD $0x894c; BYTE $0xd8       // movq	%r11, %rax
+	LONG $0xffc6c0c5; BYTE $0xff   // vshufps	$255, %xmm7, %xmm7, %xmm7
+	LONG $0xf6c6c8c5; BYTE $0xff   // vshufps	$255, %xmm6, %xmm6, %xmm6
+	LONG $0xfce08348               // andq	$-4, %rax
+	LONG $0xe4581ac5               // vaddss	%xmm4, %xmm12, %xmm12
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	LONG $0x03e38341               // andl	$3, %r11d
+	LONG $0x586ac1c4; BYTE $0xd5   // vaddss	%xmm13, %xmm2, %xmm2
+	LONG $0x5852c1c4; BYTE $0xe0   // vaddss	%xmm8, %xmm5, %xmm4
+	LONG $0xd5c650c5; BYTE $0x55   // vshufps	$85, %xmm5, %xmm5, %xmm10
+	LONG $0x586241c4; BYTE $0xc1   // vaddss	%xmm9, %xmm3, %xmm8
+	LONG $0xcbc660c5; BYTE $0x55   // vshufps	$85, %xmm3, %xmm3, %xmm9
+	LONG $0xd758eac5               // vaddss	%xmm7, %xmm2, %xmm2
+	LONG $0x5822c1c4; BYTE $0xfc   // vaddss	%xmm12, %xmm11, %xmm7
+	LONG $0xd4582ac5               // vaddss	%xmm4, %xmm10, %xmm10
+	LONG $0xe515d0c5               // vunpckhps	%xmm5, %xmm5, %xmm4
+	LONG $0xedc6d0c5; BYTE $0xff   // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0x583241c4; BYTE $0xc8   // vaddss	%xmm8, %xmm9, %xmm9
+	LONG $0xc31560c5               // vunpckhps	%xmm3, %xmm3, %xmm8
+	LONG $0xdbc6e0c5; BYTE $0xff   // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xf658c2c5               // vaddss	%xmm6, %xmm7, %xmm6
+	LONG $0x585ac1c4; BYTE $0xe2   // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0xd614e8c5               // vunpcklps	%xmm6, %xmm2, %xmm2
+	LONG $0xe558dac5               // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0x583ac1c4; BYTE $0xe9   // vaddss	%xmm9, %xmm8, %xmm5
+	LONG $0xeb58d2c5               // vaddss	%xmm3, %xmm5, %xmm5
+	LONG $0xe514d8c5               // vunpcklps	%xmm5, %xmm4, %xmm4
+	LONG $0xd416e8c5               // vmovlhps	%xmm4, %xmm2, %xmm2
+	JE   BB0_8
+
+BB0_12:
+	QUAD $0x00000158249c8b48                   // movq	344(%rsp), %rbx
+	QUAD $0x00000130249c8b4c                   // movq	304(%rsp), %r11
+	QUAD $0x0000014024ac8b4c                   // movq	320(%rsp), %r13
+	QUAD $0x0000012824b48b4c                   // movq	296(%rsp), %r14
+	LONG $0x130c8d4c                           // leaq	(%rbx,%rdx), %r9
+	LONG $0x131c8d49                           // leaq	(%r11,%rdx), %rbx
+	QUAD $0x0000015024848b48                   // movq	336(%rsp), %rax
+	WORD $0x894d; BYTE $0xeb                   // movq	%r13, %r11
+	LONG $0x163c8d49                           // leaq	(%r14,%rdx), %rdi
+	LONG $0x107a81c4; WORD $0x881c             // vmovss	(%r8,%r9,4), %xmm3
+	LONG $0x107ac1c4; WORD $0x9824             // vmovss	(%r8,%rbx,4), %xmm4
+	WORD $0x0149; BYTE $0xd3                   // addq	%rdx, %r11
+	LONG $0x2161c3c4; WORD $0xb81c; BYTE $0x10 // vinsertps	$0x10, (%r8,%rdi,4), %xmm3, %xmm3
+	QUAD $0x00000148248c8b4c                   // movq	328(%rsp), %r9
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x215983c4; WORD $0x9824; BYTE $0x10 // vinsertps	$0x10, (%r8,%r11,4), %xmm4, %xmm4
+	LONG $0xdc16e0c5                           // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0x1879c2c4; WORD $0x8124             // vbroadcastss	(%r9,%rax,4), %xmm4
+	LONG $0x01428d48                           // leaq	1(%rdx), %rax
+	LONG $0xb861e2c4; BYTE $0xd4               // vfmadd231ps	%xmm4, %xmm3, %xmm2
+	WORD $0x394c; BYTE $0xe0                   // cmpq	%r12, %rax
+	JGE  BB0_8
+	QUAD $0x0000015024bc8b48                   // movq	336(%rsp), %rdi
+	QUAD $0x00000158249c8b48                   // movq	344(%rsp), %rbx
+	LONG $0x02c28348                           // addq	$2, %rdx
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+	LONG $0x1879c2c4; WORD $0xb92c             // vbroadcastss	(%r9,%rdi,4), %xmm5
+	LONG $0x180c8d4c                           // leaq	(%rax,%rbx), %r9
+	LONG $0x303c8d4a                           // leaq	(%rax,%r14), %rdi
+	WORD $0x894c; BYTE $0xf3                   // movq	%r14, %rbx
+	QUAD $0x0000013024b48b4c                   // movq	304(%rsp), %r14
+	LONG $0x107a81c4; WORD $0x881c             // vmovss	(%r8,%r9,4), %xmm3
+	LONG $0x2161c3c4; WORD $0xb81c; BYTE $0x10 // vinsertps	$0x10, (%r8,%rdi,4), %xmm3, %xmm3
+	LONG $0x301c8d4e                           // leaq	(%rax,%r14), %r11
+	WORD $0x014c; BYTE $0xe8                   // addq	%r13, %rax
+	LONG $0x107a81c4; WORD $0x9824             // vmovss	(%r8,%r11,4), %xmm4
+	LONG $0x2159c3c4; WORD $0x8024; BYTE $0x10 // vinsertps	$0x10, (%r8,%rax,4), %xmm4, %xmm4
+	LONG $0xdc16e0c5                           // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0xb851e2c4; BYTE $0xd3               // vfmadd231ps	%xmm3, %xmm5, %xmm2
+	WORD $0x3949; BYTE $0xd4                   // cmpq	%rdx, %r12
+	JLE  BB0_8
+	QUAD $0x0000015024bc8b48                   // movq	336(%rsp), %rdi
+	QUAD $0x00000148248c8b4c                   // movq	328(%rsp), %r9
+	LONG $0x17048d48                           // leaq	(%rdi,%rdx), %rax
+	LONG $0x1879c2c4; WORD $0x812c             // vbroadcastss	(%r9,%rax,4), %xmm5
+	QUAD $0x0000015824848b48                   // movq	344(%rsp), %rax
+	LONG $0x160c8d4d                           // leaq	(%r14,%rdx), %r9
+	LONG $0x107a81c4; WORD $0x8824             // vmovss	(%r8,%r9,4), %xmm4
+	LONG $0x103c8d48                           // leaq	(%rax,%rdx), %rdi
+	WORD $0x8948; BYTE $0xd8                   // movq	%rbx, %rax
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0x014c; BYTE $0xea                   // addq	%r13, %rdx
+	LONG $0x107ac1c4; WORD $0xb81c             // vmovss	(%r8,%rdi,4), %xmm3
+	LONG $0x2159c3c4; WORD $0x9024; BYTE $0x10 // vinsertps	$0x10, (%r8,%rdx,4), %xmm4, %xmm4
+	LONG $0x2161c3c4; WORD $0x801c; BYTE $0x10 // vinsertps	$0x10, (%r8,%rax,4), %xmm3, %xmm3
+	LONG $0xdc16e0c5                           // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0xb851e2c4; BYTE $0xd3               // vfmadd231ps	%xmm3, %xmm5, %xmm2
+
+BB0_8:
+	LONG $0xd259f8c5               // vmulps	%xmm2, %xmm0, %xmm2
+	QUAD $0x0000010824848b48       // movq	264(%rsp), %rax
+	QUAD $0x0000011824bc8b48       // movq	280(%rsp), %rdi
+	QUAD $0x000000c8249c8b48       // movq	200(%rsp), %rbx
+	WORD $0x0149; BYTE $0xdf       // addq	%rbx, %r15
+	WORD $0x0149; BYTE $0xda       // addq	%rbx, %r10
+	WORD $0x0148; BYTE $0xd9       // addq	%rbx, %rcx
+	WORD $0x0148; BYTE $0xde       // addq	%rbx, %rsi
+	LONG $0x5411f8c5; WORD $0xf487 // vmovups	%xmm2, -12(%rdi,%rax,4)
+	QUAD $0x000000d824bc8b48       // movq	216(%rsp), %rdi
+	LONG $0x04c08348               // addq	$4, %rax
+	QUAD $0x0000015824bc0148       // addq	%rdi, 344(%rsp)
+	QUAD $0x0000013024bc0148       // addq	%rdi, 304(%rsp)
+	QUAD $0x0000014024bc0148       // addq	%rdi, 320(%rsp)
+	QUAD $0x000000e024bc8b48       // movq	224(%rsp), %rdi
+	QUAD $0x0000010824848948       // movq	%rax, 264(%rsp)
+	WORD $0x3948; BYTE $0xf8       // cmpq	%rdi, %rax
+	JL   BB0_14
+	LONG $0xfc478d48               // leaq	-4(%rdi), %rax
+	QUAD $0x0000012024ac8b4c       // movq	288(%rsp), %r13
+	LONG $0x245c8b48; BYTE $0x78   // movq	120(%rsp), %rbx
+	LONG $0x02e8c148               // shrq	$2, %rax
+	LONG $0x03ff8348               // cmpq	$3, %rdi
+	LONG $0x245c8b4c; BYTE $0x70   // movq	112(%rsp), %r11
+	QUAD $0x000000d824b48b4c       // movq	216(%rsp), %r14
+	QUAD $0x0000000485148d48       // leaq	4(,%rax,4), %rdx
+	LONG $0x000004b8; BYTE $0x00   // movl	$4, %eax
+	LONG $0xd04e0f48               // cmovle	%rax, %rdx
+	QUAD $0x0000010024943948       // cmpq	%rdx, 256(%rsp)
+	JLE  BB0_140
+
+BB0_16:
+	WORD $0x394c; BYTE $0xda // cmpq	%r11, %rdx
+	JGE  BB0_19
+	QUAD $0x0000010024bc8b4c // movq	256(%rsp), %r15
+	WORD $0x8948; BYTE $0xd7 // movq	%rdx, %rdi
+	QUAD $0x00000130249c8948 // movq	%rbx, 304(%rsp)
+	QUAD $0x00000140249c894c // movq	%r11, 320(%rsp)
+	WORD $0x394d; BYTE $0xdf // cmpq	%r11, %r15
+	LONG $0xfb4f0f4d         // cmovg	%r11, %r15
+	LONG $0xfcaf0f49         // imulq	%r12, %rdi
+	LONG $0xb80c8d49         // leaq	(%r8,%rdi,4), %rcx
+
+BB0_28:
+	LONG $0x07fc8349             // cmpq	$7, %r12
+	JLE  BB0_75
+	LONG $0xdb57e0c5             // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_21:
+	LONG $0x107cc1c4; WORD $0x857c; BYTE $0xe0 // vmovups	-32(%r13,%rax,4), %ymm7
+	LONG $0xb845e2c4; WORD $0x815c; BYTE $0xe0 // vfmadd231ps	-32(%rcx,%rax,4), %ymm7, %ymm3
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x394c; BYTE $0xe0                   // cmpq	%r12, %rax
+	JLE  BB0_21
+	QUAD $0x000000c024b48b48                   // movq	192(%rsp), %rsi
+
+BB0_20:
+	LONG $0x197de3c4; WORD $0x01da // vextractf128	$0x1, %ymm3, %xmm2
+	LONG $0xd358e8c5               // vaddps	%xmm3, %xmm2, %xmm2
+	LONG $0xda12e8c5               // vmovhlps	%xmm2, %xmm2, %xmm3
+	LONG $0xd358e8c5               // vaddps	%xmm3, %xmm2, %xmm2
+	LONG $0xda16fac5               // vmovshdup	%xmm2, %xmm3
+	LONG $0xd358eac5               // vaddss	%xmm3, %xmm2, %xmm2
+	WORD $0x3949; BYTE $0xf4       // cmpq	%rsi, %r12
+	JLE  BB0_22
+	WORD $0x894d; BYTE $0xe1       // movq	%r12, %r9
+	QUAD $0x0000015824b48948       // movq	%rsi, 344(%rsp)
+	WORD $0x2949; BYTE $0xf1       // subq	%rsi, %r9
+	LONG $0xff418d49               // leaq	-1(%r9), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_76
+	QUAD $0x0000015024848b48       // movq	336(%rsp), %rax
+	QUAD $0x00000148249c8b48       // movq	328(%rsp), %rbx
+	WORD $0x894d; BYTE $0xca       // movq	%r9, %r10
+	LONG $0x03eac149               // shrq	$3, %r10
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0x05e2c149               // salq	$5, %r10
+	LONG $0x831c8d48               // leaq	(%rbx,%rax,4), %rbx
+	LONG $0x37048d48               // leaq	(%rdi,%rsi), %rax
+	LONG $0x801c8d4d               // leaq	(%r8,%rax,4), %r11
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_24:
+	LONG $0x107cc1c4; WORD $0x033c // vmovups	(%r11,%rax), %ymm7
+	LONG $0x2459c4c5; BYTE $0x03   // vmulps	(%rbx,%rax), %ymm7, %ymm4
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0xd458eac5               // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0xdcc6d8c5; BYTE $0x55   // vshufps	$85, %xmm4, %xmm4, %xmm3
+	LONG $0xecc6d8c5; BYTE $0xff   // vshufps	$255, %xmm4, %xmm4, %xmm5
+	LONG $0xda58e2c5               // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xd415d8c5               // vunpckhps	%xmm4, %xmm4, %xmm2
+	LONG $0xd358eac5               // vaddss	%xmm3, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01e3 // vextractf128	$0x1, %ymm4, %xmm3
+	LONG $0xe3c6e0c5; BYTE $0x55   // vshufps	$85, %xmm3, %xmm3, %xmm4
+	LONG $0xea58d2c5               // vaddss	%xmm2, %xmm5, %xmm5
+	LONG $0xd558e2c5               // vaddss	%xmm5, %xmm3, %xmm2
+	LONG $0xe258dac5               // vaddss	%xmm2, %xmm4, %xmm4
+	LONG $0xd315e0c5               // vunpckhps	%xmm3, %xmm3, %xmm2
+	LONG $0xdbc6e0c5; BYTE $0xff   // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xd458eac5               // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0xd358eac5               // vaddss	%xmm3, %xmm2, %xmm2
+	WORD $0x3949; BYTE $0xc2       // cmpq	%rax, %r10
+	JNE  BB0_24
+	WORD $0x894c; BYTE $0xc8       // movq	%r9, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0x07c1f641               // testb	$7, %r9b
+	JE   BB0_22
+
+BB0_23:
+	WORD $0x2949; BYTE $0xc1       // subq	%rax, %r9
+	LONG $0xff518d4d               // leaq	-1(%r9), %r10
+	LONG $0x02fa8349               // cmpq	$2, %r10
+	JBE  BB0_26
+	QUAD $0x00000150249c8b4c       // movq	336(%rsp), %r11
+	QUAD $0x00000158249c8b48       // movq	344(%rsp), %rbx
+	LONG $0x07148d4c               // leaq	(%rdi,%rax), %r10
+	WORD $0x014c; BYTE $0xd8       // addq	%r11, %rax
+	WORD $0x0149; BYTE $0xda       // addq	%rbx, %r10
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	QUAD $0x00000148249c8b48       // movq	328(%rsp), %rbx
+	LONG $0x1c10f8c5; BYTE $0x83   // vmovups	(%rbx,%rax,4), %xmm3
+	LONG $0x596081c4; WORD $0x901c // vmulps	(%r8,%r10,4), %xmm3, %xmm3
+	WORD $0x894c; BYTE $0xc8       // movq	%r9, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+	LONG $0x03e18341               // andl	$3, %r9d
+	LONG $0xd258e2c5               // vaddss	%xmm2, %xmm3, %xmm2
+	LONG $0xe3c6e0c5; BYTE $0x55   // vshufps	$85, %xmm3, %xmm3, %xmm4
+	LONG $0xe258dac5               // vaddss	%xmm2, %xmm4, %xmm4
+	LONG $0xd315e0c5               // vunpckhps	%xmm3, %xmm3, %xmm2
+	LONG $0xdbc6e0c5; BYTE $0xff   // vshufps	$255, %xmm3, %xmm3, %xmm3
+	LONG $0xd458eac5               // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0xd358eac5               // vaddss	%xmm3, %xmm2, %xmm2
+	JE   BB0_22
+
+BB0_26:
+	QUAD $0x00000150249c8b48       // movq	336(%rsp), %rbx
+	QUAD $0x0000014824948b4c       // movq	328(%rsp), %r10
+	LONG $0x37048d48               // leaq	(%rdi,%rsi), %rax
+	LONG $0x330c8d4c               // leaq	(%rbx,%rsi), %r9
+	LONG $0x107a81c4; WORD $0x8a3c // vmovss	(%r10,%r9,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x8014 // vfmadd231ss	(%r8,%rax,4), %xmm7, %xmm2
+	LONG $0x01468d48               // leaq	1(%rsi), %rax
+	WORD $0x3949; BYTE $0xc4       // cmpq	%rax, %r12
+	JLE  BB0_22
+	LONG $0x070c8d4c               // leaq	(%rdi,%rax), %r9
+	LONG $0x02c68348               // addq	$2, %rsi
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	LONG $0x107a81c4; WORD $0x883c // vmovss	(%r8,%r9,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x8214 // vfmadd231ss	(%r10,%rax,4), %xmm7, %xmm2
+	WORD $0x3949; BYTE $0xf4       // cmpq	%rsi, %r12
+	JLE  BB0_22
+	LONG $0x37048d48               // leaq	(%rdi,%rsi), %rax
+	WORD $0x0148; BYTE $0xde       // addq	%rbx, %rsi
+	LONG $0x107ac1c4; WORD $0x803c // vmovss	(%r8,%rax,4), %xmm7
+	LONG $0xb941c2c4; WORD $0xb214 // vfmadd231ss	(%r10,%rsi,4), %xmm7, %xmm2
+
+BB0_22:
+	LONG $0xd259f2c5             // vmulss	%xmm2, %xmm1, %xmm2
+	QUAD $0x0000011824848b48     // movq	280(%rsp), %rax
+	WORD $0x014c; BYTE $0xe7     // addq	%r12, %rdi
+	WORD $0x014c; BYTE $0xf1     // addq	%r14, %rcx
+	LONG $0x1411fac5; BYTE $0x90 // vmovss	%xmm2, (%rax,%rdx,4)
+	LONG $0x01c28348             // addq	$1, %rdx
+	WORD $0x394c; BYTE $0xfa     // cmpq	%r15, %rdx
+	JL   BB0_28
+	QUAD $0x00000130249c8b48     // movq	304(%rsp), %rbx
+	QUAD $0x00000140249c8b4c     // movq	320(%rsp), %r11
+	QUAD $0x0000010024943948     // cmpq	%rdx, 256(%rsp)
+	JLE  BB0_34
+
+BB0_19:
+	QUAD         $0x0000010024b48b48     // movq	256(%rsp), %rsi
+	LONG         $0x000001b9; BYTE $0x00 // movl	$1, %ecx
+	WORD         $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	WORD         $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	WORD         $0x2948; BYTE $0xd0     // subq	%rdx, %rax
+	WORD         $0x3948; BYTE $0xd6     // cmpq	%rdx, %rsi
+	LONG         $0xc84f0f48             // cmovg	%rax, %rcx
+	LONG         $0x01e88348             // subq	$1, %rax
+	LONG         $0x06f88348             // cmpq	$6, %rax
+	JBE          BB0_77
+	WORD         $0x3948; BYTE $0xd6     // cmpq	%rdx, %rsi
+	JLE          BB0_77
+	QUAD         $0x000000b024b48b48     // movq	176(%rsp), %rsi
+	LONG         $0x13048d48             // leaq	(%rbx,%rdx), %rax
+	VBROADCASTSS CPI0_4<>(SB), Y2        // vbroadcastss	.LCPI0_4(%rip), %ymm2
+	LONG         $0x86048d48             // leaq	(%rsi,%rax,4), %rax
+	WORD         $0x8948; BYTE $0xce     // movq	%rcx, %rsi
+	LONG         $0x03eec148             // shrq	$3, %rsi
+	LONG         $0x05e6c148             // salq	$5, %rsi
+	WORD         $0x0148; BYTE $0xc6     // addq	%rax, %rsi
+
+BB0_32:
+	LONG $0x1011fcc5         // vmovups	%ymm2, (%rax)
+	LONG $0x20c08348         // addq	$32, %rax
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JNE  BB0_32
+	WORD $0x8948; BYTE $0xc8 // movq	%rcx, %rax
+	LONG $0xf8e08348         // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2 // addq	%rax, %rdx
+	WORD $0xc1f6; BYTE $0x07 // testb	$7, %cl
+	JE   BB0_34
+
+BB0_31:
+	WORD         $0x2948; BYTE $0xc1     // subq	%rax, %rcx
+	LONG         $0xff718d48             // leaq	-1(%rcx), %rsi
+	LONG         $0x02fe8348             // cmpq	$2, %rsi
+	JBE          BB0_36
+	WORD         $0x0148; BYTE $0xd8     // addq	%rbx, %rax
+	QUAD         $0x000000b024b48b48     // movq	176(%rsp), %rsi
+	VBROADCASTSS CPI0_4<>(SB), X2        // vbroadcastss	.LCPI0_4(%rip), %xmm2
+	WORD         $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	LONG         $0x1411f8c5; BYTE $0x86 // vmovups	%xmm2, (%rsi,%rax,4)
+	WORD         $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	LONG         $0xfce08348             // andq	$-4, %rax
+	WORD         $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	WORD         $0xe183; BYTE $0x03     // andl	$3, %ecx
+	JE           BB0_34
+
+BB0_36:
+	VMOVSS CPI0_4<>(SB), X2        // vmovss	.LCPI0_4(%rip), %xmm2
+	QUAD   $0x000000b024b48b48     // movq	176(%rsp), %rsi
+	LONG   $0x13048d48             // leaq	(%rbx,%rdx), %rax
+	QUAD   $0x0000010024bc8b48     // movq	256(%rsp), %rdi
+	LONG   $0x1411fac5; BYTE $0x86 // vmovss	%xmm2, (%rsi,%rax,4)
+	LONG   $0x01428d48             // leaq	1(%rdx), %rax
+	WORD   $0x3948; BYTE $0xc7     // cmpq	%rax, %rdi
+	JLE    BB0_34
+	WORD   $0x0148; BYTE $0xd8     // addq	%rbx, %rax
+	LONG   $0x02c28348             // addq	$2, %rdx
+	LONG   $0x1411fac5; BYTE $0x86 // vmovss	%xmm2, (%rsi,%rax,4)
+	WORD   $0x3948; BYTE $0xfa     // cmpq	%rdi, %rdx
+	JGE    BB0_34
+	WORD   $0x0148; BYTE $0xda     // addq	%rbx, %rdx
+	LONG   $0x1411fac5; BYTE $0x96 // vmovss	%xmm2, (%rsi,%rdx,4)
+
+BB0_140:
+	QUAD $0x0000011824848b48 // movq	280(%rsp), %rax
+	LONG $0x2010fac5         // vmovss	(%rax), %xmm4
+
+BB0_29:
+	QUAD $0x0000011824848b48 // movq	280(%rsp), %rax
+	QUAD $0x0000009824948b48 // movq	152(%rsp), %rdx
+	LONG $0x04c08348         // addq	$4, %rax
+
+BB0_39:
+	LONG         $0x1010fac5                     // vmovss	(%rax), %xmm2
+	LONG         $0x04c08348                     // addq	$4, %rax
+	LONG         $0xe45feac5                     // vmaxss	%xmm4, %xmm2, %xmm4
+	WORD         $0x3948; BYTE $0xc2             // cmpq	%rax, %rdx
+	JNE          BB0_39
+	QUAD         $0x0000010024bc8348; BYTE $0x07 // cmpq	$7, 256(%rsp)
+	LONG         $0x187d62c4; BYTE $0xfc         // vbroadcastss	%xmm4, %ymm15
+	JLE          BB0_79
+	QUAD         $0x0000008824848b48             // movq	136(%rsp), %rax
+	LONG         $0x00007fb9; BYTE $0x00         // movl	$127, %ecx
+	QUAD         $0x000000b024bc8b48             // movq	176(%rsp), %rdi
+	LONG         $0xed57d0c5                     // vxorps	%xmm5, %xmm5, %xmm5
+	LONG         $0xc16e79c5                     // vmovd	%ecx, %xmm8
+	LONG         $0xef3141c4; BYTE $0xc9         // vpxor	%xmm9, %xmm9, %xmm9
+	VBROADCASTSS CPI0_7<>(SB), Y14               // vbroadcastss	.LCPI0_7(%rip), %ymm14
+	VBROADCASTSS CPI0_21<>(SB), Y13              // vbroadcastss	.LCPI0_21(%rip), %ymm13
+	LONG         $0xf8e08348                     // andq	$-8, %rax
+	LONG         $0x587d42c4; BYTE $0xc0         // vpbroadcastd	%xmm8, %ymm8
+	VBROADCASTSS CPI0_23<>(SB), Y12              // vbroadcastss	.LCPI0_23(%rip), %ymm12
+	VBROADCASTSS CPI0_25<>(SB), Y11              // vbroadcastss	.LCPI0_25(%rip), %ymm11
+	VBROADCASTSS CPI0_2<>(SB), Y6                // vbroadcastss	.LCPI0_2(%rip), %ymm6
+	WORD         $0x0148; BYTE $0xd8             // addq	%rbx, %rax
+	VBROADCASTSS CPI0_0<>(SB), Y10               // vbroadcastss	.LCPI0_0(%rip), %ymm10
+	QUAD         $0x000158248c11fac5; BYTE $0x00 // vmovss	%xmm1, 344(%rsp)
+	QUAD         $0x000130248429f8c5; BYTE $0x00 // vmovaps	%xmm0, 304(%rsp)
+	LONG         $0x87548d48; BYTE $0x20         // leaq	32(%rdi,%rax,4), %rdx
+	QUAD         $0x0000011824848b48             // movq	280(%rsp), %rax
+
+BB0_40:
+	LONG         $0x0810fcc5                     // vmovups	(%rax), %ymm1
+	LONG         $0x20c08348                     // addq	$32, %rax
+	VBROADCASTSS CPI0_17<>(SB), Y0               // vbroadcastss	.LCPI0_17(%rip), %ymm0
+	LONG         $0x5c74c1c4; BYTE $0xcf         // vsubps	%ymm15, %ymm1, %ymm1
+	VMULPS       CPI0_10<>(SB), Y1, Y2           // vmulps	.LCPI0_10(%rip), %ymm1, %ymm2
+	VCMPPS       $17, CPI0_8<>(SB), Y1, Y3       // vcmpps	$17, .LCPI0_8(%rip), %ymm1, %ymm3
+	LONG         $0xc274c1c4; WORD $0x1efe       // vcmpps	$30, %ymm14, %ymm1, %ymm7
+	LONG         $0x087de3c4; WORD $0x08d2       // vroundps	$8, %ymm2, %ymm2
+	VFNMADD231PS CPI0_12<>(SB), Y2, Y1           // vfnmadd231ps	.LCPI0_12(%rip), %ymm2, %ymm1
+	VFNMADD231PS CPI0_14<>(SB), Y2, Y1           // vfnmadd231ps	.LCPI0_14(%rip), %ymm2, %ymm1
+	LONG         $0xd25bfdc5                     // vcvtps2dq	%ymm2, %ymm2
+	LONG         $0xfe6dc1c4; BYTE $0xd0         // vpaddd	%ymm8, %ymm2, %ymm2
+	VFMADD213PS  CPI0_18<>(SB), Y1, Y0           // vfmadd213ps	.LCPI0_18(%rip), %ymm1, %ymm0
+	LONG         $0xf272edc5; BYTE $0x17         // vpslld	$23, %ymm2, %ymm2
+	LONG         $0xdb66b5c5                     // vpcmpgtd	%ymm3, %ymm9, %ymm3
+	LONG         $0x9815e2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm13, %ymm0
+	LONG         $0x981de2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm12, %ymm0
+	LONG         $0x9825e2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm11, %ymm0
+	LONG         $0x984de2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm6, %ymm0
+	LONG         $0x984de2c4; BYTE $0xc1         // vfmadd132ps	%ymm1, %ymm6, %ymm0
+	LONG         $0xc259fcc5                     // vmulps	%ymm2, %ymm0, %ymm0
+	LONG         $0x4a7dc3c4; WORD $0x70c2       // vblendvps	%ymm7, %ymm10, %ymm0, %ymm0
+	LONG         $0xd855e4c5                     // vandnps	%ymm0, %ymm3, %ymm3
+	LONG         $0x5811fcc5; BYTE $0xe0         // vmovups	%ymm3, -32(%rax)
+	LONG         $0xeb58d4c5                     // vaddps	%ymm3, %ymm5, %ymm5
+	WORD         $0x3948; BYTE $0xd0             // cmpq	%rdx, %rax
+	JNE          BB0_40
+	QUAD         $0x000158248c10fac5; BYTE $0x00 // vmovss	344(%rsp), %xmm1
+	QUAD         $0x0000008024848b48             // movq	128(%rsp), %rax
+	QUAD         $0x000130248428f8c5; BYTE $0x00 // vmovaps	304(%rsp), %xmm0
+
+BB0_30:
+	LONG   $0x197de3c4; WORD $0x01ea // vextractf128	$0x1, %ymm5, %xmm2
+	LONG   $0xd558e8c5               // vaddps	%xmm5, %xmm2, %xmm2
+	LONG   $0xda12e8c5               // vmovhlps	%xmm2, %xmm2, %xmm3
+	LONG   $0xd358e8c5               // vaddps	%xmm3, %xmm2, %xmm2
+	LONG   $0xda16fac5               // vmovshdup	%xmm2, %xmm3
+	LONG   $0xd358eac5               // vaddss	%xmm3, %xmm2, %xmm2
+	LONG   $0xea28f8c5               // vmovaps	%xmm2, %xmm5
+	QUAD   $0x0000010024843948       // cmpq	%rax, 256(%rsp)
+	JLE    BB0_41
+	QUAD   $0x000000b024bc8b48       // movq	176(%rsp), %rdi
+	WORD   $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	VMOVSD CPI0_34<>(SB), X10        // vmovsd	.LCPI0_34(%rip), %xmm10
+	VMOVSD CPI0_35<>(SB), X9         // vmovsd	.LCPI0_35(%rip), %xmm9
+	VMOVSD CPI0_36<>(SB), X8         // vmovsd	.LCPI0_36(%rip), %xmm8
+	VMOVSD CPI0_37<>(SB), X7         // vmovsd	.LCPI0_37(%rip), %xmm7
+	VMOVSD CPI0_38<>(SB), X6         // vmovsd	.LCPI0_38(%rip), %xmm6
+	LONG   $0x87048d48               // leaq	(%rdi,%rax,4), %rax
+	QUAD   $0x0000009824948b48       // movq	152(%rsp), %rdx
+
+BB0_43:
+	LONG        $0x1810fac5                           // vmovss	(%rax), %xmm3
+	VMOVSS      CPI0_0<>(SB), X2                      // vmovss	.LCPI0_0(%rip), %xmm2
+	LONG        $0xdc5ce2c5                           // vsubss	%xmm4, %xmm3, %xmm3
+	VCOMISS     CPI0_29<>(SB), X3                     // vcomiss	.LCPI0_29(%rip), %xmm3
+	JA          BB0_42
+	VMOVSS      CPI0_30<>(SB), X15                    // vmovss	.LCPI0_30(%rip), %xmm15
+	LONG        $0xd257e8c5                           // vxorps	%xmm2, %xmm2, %xmm2
+	LONG        $0xfb2f78c5                           // vcomiss	%xmm3, %xmm15
+	JA          BB0_42
+	LONG        $0xdb5ae2c5                           // vcvtss2sd	%xmm3, %xmm3, %xmm3
+	VMULSD      CPI0_31<>(SB), X3, X11                // vmulsd	.LCPI0_31(%rip), %xmm3, %xmm11
+	VMOVSD      CPI0_47<>(SB), X12                    // vmovsd	.LCPI0_47(%rip), %xmm12
+	VANDPD      CPI0_32<>(SB), X11, X2                // vandpd	.LCPI0_32(%rip), %xmm11, %xmm2
+	VORPD       CPI0_33<>(SB), X2, X2                 // vorpd	.LCPI0_33(%rip), %xmm2, %xmm2
+	LONG        $0xda5823c5                           // vaddsd	%xmm2, %xmm11, %xmm11
+	LONG        $0x0b2143c4; WORD $0x03db             // vroundsd	$3, %xmm11, %xmm11, %xmm11
+	LONG        $0xbda1c2c4; BYTE $0xda               // vfnmadd231sd	%xmm10, %xmm11, %xmm3
+	LONG        $0x2cfbc1c4; BYTE $0xcb               // vcvttsd2siq	%xmm11, %rcx
+	LONG        $0xffc18148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rcx
+	LONG        $0xbda1c2c4; BYTE $0xd9               // vfnmadd231sd	%xmm9, %xmm11, %xmm3
+	LONG        $0x34e1c148                           // salq	$52, %rcx
+	LONG        $0xd310e3c5                           // vmovsd	%xmm3, %xmm3, %xmm2
+	LONG        $0x99c1c2c4; BYTE $0xd8               // vfmadd132sd	%xmm8, %xmm7, %xmm3
+	LONG        $0x99c9e2c4; BYTE $0xda               // vfmadd132sd	%xmm2, %xmm6, %xmm3
+	VFMADD213SD CPI0_39<>(SB), X2, X3                 // vfmadd213sd	.LCPI0_39(%rip), %xmm2, %xmm3
+	VFMADD213SD CPI0_40<>(SB), X2, X3                 // vfmadd213sd	.LCPI0_40(%rip), %xmm2, %xmm3
+	VFMADD213SD CPI0_41<>(SB), X2, X3                 // vfmadd213sd	.LCPI0_41(%rip), %xmm2, %xmm3
+	VFMADD213SD CPI0_42<>(SB), X2, X3                 // vfmadd213sd	.LCPI0_42(%rip), %xmm2, %xmm3
+	VFMADD213SD CPI0_43<>(SB), X2, X3                 // vfmadd213sd	.LCPI0_43(%rip), %xmm2, %xmm3
+	VFMADD213SD CPI0_44<>(SB), X2, X3                 // vfmadd213sd	.LCPI0_44(%rip), %xmm2, %xmm3
+	VFMADD213SD CPI0_45<>(SB), X2, X3                 // vfmadd213sd	.LCPI0_45(%rip), %xmm2, %xmm3
+	VFMADD213SD CPI0_46<>(SB), X2, X3                 // vfmadd213sd	.LCPI0_46(%rip), %xmm2, %xmm3
+	LONG        $0x9999e2c4; BYTE $0xda               // vfmadd132sd	%xmm2, %xmm12, %xmm3
+	LONG        $0x9999e2c4; BYTE $0xd3               // vfmadd132sd	%xmm3, %xmm12, %xmm2
+	LONG        $0x6ef9e1c4; BYTE $0xd9               // vmovq	%rcx, %xmm3
+	LONG        $0xd359ebc5                           // vmulsd	%xmm3, %xmm2, %xmm2
+	LONG        $0xd25aebc5                           // vcvtsd2ss	%xmm2, %xmm2, %xmm2
+
+BB0_42:
+	LONG   $0x1011fac5                     // vmovss	%xmm2, (%rax)
+	LONG   $0x04c08348                     // addq	$4, %rax
+	LONG   $0xea58d2c5                     // vaddss	%xmm2, %xmm5, %xmm5
+	WORD   $0x3948; BYTE $0xc2             // cmpq	%rax, %rdx
+	JNE    BB0_43
+	VMOVSS CPI0_2<>(SB), X7                // vmovss	.LCPI0_2(%rip), %xmm7
+	QUAD   $0x0000010024bc8348; BYTE $0x07 // cmpq	$7, 256(%rsp)
+	LONG   $0xed5ec2c5                     // vdivss	%xmm5, %xmm7, %xmm5
+	LONG   $0x187de2c4; BYTE $0xdd         // vbroadcastss	%xmm5, %ymm3
+	JLE    BB0_142
+
+BB0_71:
+	QUAD $0x0000008824848b48     // movq	136(%rsp), %rax
+	QUAD $0x000000b024b48b48     // movq	176(%rsp), %rsi
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xd8     // addq	%rbx, %rax
+	LONG $0x86548d48; BYTE $0x20 // leaq	32(%rsi,%rax,4), %rdx
+	QUAD $0x0000011824848b48     // movq	280(%rsp), %rax
+
+BB0_45:
+	LONG $0x1059e4c5             // vmulps	(%rax), %ymm3, %ymm2
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x5011fcc5; BYTE $0xe0 // vmovups	%ymm2, -32(%rax)
+	WORD $0x3948; BYTE $0xd0     // cmpq	%rdx, %rax
+	JNE  BB0_45
+	QUAD $0x0000008024848b48     // movq	128(%rsp), %rax
+
+BB0_17:
+	QUAD $0x0000010024843948 // cmpq	%rax, 256(%rsp)
+	JLE  BB0_51
+	QUAD $0x0000010024948b48 // movq	256(%rsp), %rdx
+	WORD $0x8948; BYTE $0xc1 // movq	%rax, %rcx
+	WORD $0x2948; BYTE $0xc2 // subq	%rax, %rdx
+	LONG $0xff728d48         // leaq	-1(%rdx), %rsi
+	LONG $0x06fe8348         // cmpq	$6, %rsi
+	JBE  BB0_84
+	QUAD $0x000000b024bc8b48 // movq	176(%rsp), %rdi
+	LONG $0x03348d48         // leaq	(%rbx,%rax), %rsi
+	LONG $0xb7348d48         // leaq	(%rdi,%rsi,4), %rsi
+	LONG $0x1e59e4c5         // vmulps	(%rsi), %ymm3, %ymm3
+	LONG $0x1e11fcc5         // vmovups	%ymm3, (%rsi)
+	WORD $0x8948; BYTE $0xd6 // movq	%rdx, %rsi
+	LONG $0xf8e68348         // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0 // addq	%rsi, %rax
+	WORD $0xc2f6; BYTE $0x07 // testb	$7, %dl
+	JE   BB0_51
+
+BB0_49:
+	WORD $0x2948; BYTE $0xf2     // subq	%rsi, %rdx
+	LONG $0xff7a8d48             // leaq	-1(%rdx), %rdi
+	LONG $0x02ff8348             // cmpq	$2, %rdi
+	JBE  BB0_52
+	WORD $0x0148; BYTE $0xd9     // addq	%rbx, %rcx
+	LONG $0xd5c6d0c5; BYTE $0x00 // vshufps	$0, %xmm5, %xmm5, %xmm2
+	WORD $0x0148; BYTE $0xf1     // addq	%rsi, %rcx
+	QUAD $0x000000b024b48b48     // movq	176(%rsp), %rsi
+	LONG $0x8e0c8d48             // leaq	(%rsi,%rcx,4), %rcx
+	LONG $0x1159e8c5             // vmulps	(%rcx), %xmm2, %xmm2
+	LONG $0x1111f8c5             // vmovups	%xmm2, (%rcx)
+	WORD $0x8948; BYTE $0xd1     // movq	%rdx, %rcx
+	LONG $0xfce18348             // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xc8     // addq	%rcx, %rax
+	WORD $0xe283; BYTE $0x03     // andl	$3, %edx
+	JE   BB0_51
+
+BB0_52:
+	QUAD $0x000000b024b48b48 // movq	176(%rsp), %rsi
+	LONG $0x03148d48         // leaq	(%rbx,%rax), %rdx
+	QUAD $0x0000010024bc8b48 // movq	256(%rsp), %rdi
+	LONG $0x96148d48         // leaq	(%rsi,%rdx,4), %rdx
+	LONG $0x1259d2c5         // vmulss	(%rdx), %xmm5, %xmm2
+	LONG $0x1211fac5         // vmovss	%xmm2, (%rdx)
+	LONG $0x01508d48         // leaq	1(%rax), %rdx
+	WORD $0x3948; BYTE $0xfa // cmpq	%rdi, %rdx
+	JGE  BB0_51
+	WORD $0x0148; BYTE $0xda // addq	%rbx, %rdx
+	LONG $0x02c08348         // addq	$2, %rax
+	LONG $0x96148d48         // leaq	(%rsi,%rdx,4), %rdx
+	LONG $0x1259d2c5         // vmulss	(%rdx), %xmm5, %xmm2
+	LONG $0x1211fac5         // vmovss	%xmm2, (%rdx)
+	WORD $0x3948; BYTE $0xf8 // cmpq	%rdi, %rax
+	JGE  BB0_51
+	WORD $0x0148; BYTE $0xd8 // addq	%rbx, %rax
+	LONG $0x86048d48         // leaq	(%rsi,%rax,4), %rax
+	LONG $0x2859d2c5         // vmulss	(%rax), %xmm5, %xmm5
+	LONG $0x2811fac5         // vmovss	%xmm5, (%rax)
+
+BB0_51:
+	QUAD $0x000000b824948b4c     // movq	184(%rsp), %r10
+	WORD $0xf631                 // xorl	%esi, %esi
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	WORD $0xc931                 // xorl	%ecx, %ecx
+	LONG $0x1ffc8349             // cmpq	$31, %r12
+	JLE  BB0_48
+	QUAD $0x00000128249c894c     // movq	%r11, 296(%rsp)
+	QUAD $0x000000d024bc8b4c     // movq	208(%rsp), %r15
+	QUAD $0x0000015824a4894c     // movq	%r12, 344(%rsp)
+	QUAD $0x0000010024a48b4c     // movq	256(%rsp), %r12
+	QUAD $0x0000013024ac894c     // movq	%r13, 304(%rsp)
+	LONG $0x246c8b4c; BYTE $0x48 // movq	72(%rsp), %r13
+	QUAD $0x00000140249c8948     // movq	%rbx, 320(%rsp)
+	QUAD $0x00000098249c8b48     // movq	152(%rsp), %rbx
+	QUAD $0x000001202484894c     // movq	%r8, 288(%rsp)
+	QUAD $0x0000011824848b4c     // movq	280(%rsp), %r8
+
+BB0_47:
+	WORD $0x854d; BYTE $0xe4 // testq	%r12, %r12
+	JLE  BB0_143
+	LONG $0xf657c8c5         // vxorps	%xmm6, %xmm6, %xmm6
+	LONG $0x205e8d4c         // leaq	32(%rsi), %r11
+	LONG $0x404e8d4c         // leaq	64(%rsi), %r9
+	WORD $0x894c; BYTE $0xc0 // movq	%r8, %rax
+	LONG $0x607e8d48         // leaq	96(%rsi), %rdi
+	LONG $0x37148d49         // leaq	(%r15,%rsi), %rdx
+	LONG $0xee28fcc5         // vmovaps	%ymm6, %ymm5
+	LONG $0xe628fcc5         // vmovaps	%ymm6, %ymm4
+	LONG $0xde28fcc5         // vmovaps	%ymm6, %ymm3
+
+BB0_54:
+	WORD $0x8948; BYTE $0xd1       // movq	%rdx, %rcx
+	LONG $0x187de2c4; BYTE $0x10   // vbroadcastss	(%rax), %ymm2
+	LONG $0x04c08348               // addq	$4, %rax
+	WORD $0x2948; BYTE $0xf1       // subq	%rsi, %rcx
+	LONG $0xb86de2c4; BYTE $0x1a   // vfmadd231ps	(%rdx), %ymm2, %ymm3
+	WORD $0x014c; BYTE $0xf2       // addq	%r14, %rdx
+	LONG $0xb86da2c4; WORD $0x1924 // vfmadd231ps	(%rcx,%r11), %ymm2, %ymm4
+	LONG $0xb86da2c4; WORD $0x092c // vfmadd231ps	(%rcx,%r9), %ymm2, %ymm5
+	LONG $0xb86de2c4; WORD $0x3934 // vfmadd231ps	(%rcx,%rdi), %ymm2, %ymm6
+	WORD $0x3948; BYTE $0xc3       // cmpq	%rax, %rbx
+	JNE  BB0_54
+
+BB0_56:
+	LONG $0x80ee8348               // subq	$-128, %rsi
+	LONG $0x117cc1c4; BYTE $0x1a   // vmovups	%ymm3, (%r10)
+	LONG $0x80ea8349               // subq	$-128, %r10
+	LONG $0x117cc1c4; WORD $0xa062 // vmovups	%ymm4, -96(%r10)
+	LONG $0x117cc1c4; WORD $0xc06a // vmovups	%ymm5, -64(%r10)
+	LONG $0x117cc1c4; WORD $0xe072 // vmovups	%ymm6, -32(%r10)
+	WORD $0x3949; BYTE $0xf5       // cmpq	%rsi, %r13
+	JNE  BB0_47
+	QUAD $0x0000015824a48b4c       // movq	344(%rsp), %r12
+	QUAD $0x0000013024ac8b4c       // movq	304(%rsp), %r13
+	QUAD $0x00000140249c8b48       // movq	320(%rsp), %rbx
+	QUAD $0x00000128249c8b4c       // movq	296(%rsp), %r11
+	QUAD $0x0000012024848b4c       // movq	288(%rsp), %r8
+	LONG $0x24448b48; BYTE $0x18   // movq	24(%rsp), %rax
+	LONG $0x244c8b48; BYTE $0x50   // movq	80(%rsp), %rcx
+
+BB0_48:
+	WORD $0x3949; BYTE $0xc4 // cmpq	%rax, %r12
+	JL   BB0_57
+	QUAD $0x000000b024b48b48 // movq	176(%rsp), %rsi
+	QUAD $0x0000009824948b4c // movq	152(%rsp), %r10
+	WORD $0x8948; BYTE $0xc7 // movq	%rax, %rdi
+	LONG $0x9e0c8d4c         // leaq	(%rsi,%rbx,4), %r9
+
+BB0_58:
+	QUAD $0x0000010024bc8348; BYTE $0x00 // cmpq	$0, 256(%rsp)
+	WORD $0x8949; BYTE $0xcf             // movq	%rcx, %r15
+	LONG $0xd257e8c5                     // vxorps	%xmm2, %xmm2, %xmm2
+	WORD $0x8948; BYTE $0xf9             // movq	%rdi, %rcx
+	JLE  BB0_62
+	QUAD $0x000000d024b48b48             // movq	208(%rsp), %rsi
+	WORD $0x894c; BYTE $0xca             // movq	%r9, %rdx
+	LONG $0xd257e8c5                     // vxorps	%xmm2, %xmm2, %xmm2
+	LONG $0xbe348d4a                     // leaq	(%rsi,%r15,4), %rsi
+
+BB0_59:
+	LONG $0x187de2c4; BYTE $0x1a // vbroadcastss	(%rdx), %ymm3
+	LONG $0x04c28348             // addq	$4, %rdx
+	LONG $0xb865e2c4; BYTE $0x16 // vfmadd231ps	(%rsi), %ymm3, %ymm2
+	WORD $0x014c; BYTE $0xf6     // addq	%r14, %rsi
+	WORD $0x3949; BYTE $0xd2     // cmpq	%rdx, %r10
+	JNE  BB0_59
+
+BB0_62:
+	QUAD $0x0000015024b48b48       // movq	336(%rsp), %rsi
+	LONG $0x08c78348               // addq	$8, %rdi
+	WORD $0x0149; BYTE $0xf7       // addq	%rsi, %r15
+	QUAD $0x0000009024b48b48       // movq	144(%rsp), %rsi
+	LONG $0x117ca1c4; WORD $0xbe14 // vmovups	%ymm2, (%rsi,%r15,4)
+	WORD $0x394c; BYTE $0xe7       // cmpq	%r12, %rdi
+	JLE  BB0_58
+	WORD $0x894c; BYTE $0xe1       // movq	%r12, %rcx
+	WORD $0x2948; BYTE $0xc1       // subq	%rax, %rcx
+	LONG $0xf8e18348               // andq	$-8, %rcx
+	WORD $0x0148; BYTE $0xc1       // addq	%rax, %rcx
+
+BB0_57:
+	WORD $0x3949; BYTE $0xcc     // cmpq	%rcx, %r12
+	JLE  BB0_63
+	QUAD $0x000000d024848b48     // movq	208(%rsp), %rax
+	LONG $0x24748b48; BYTE $0x28 // movq	40(%rsp), %rsi
+	QUAD $0x000001282484894c     // movq	%r8, 296(%rsp)
+	QUAD $0x0000013024ac894c     // movq	%r13, 304(%rsp)
+	LONG $0x247c8b48; BYTE $0x08 // movq	8(%rsp), %rdi
+	LONG $0x88148d4c             // leaq	(%rax,%rcx,4), %r10
+	QUAD $0x0000011824848b48     // movq	280(%rsp), %rax
+	QUAD $0x00000140249c894c     // movq	%r11, 320(%rsp)
+	QUAD $0x000000b024ac8b4c     // movq	176(%rsp), %r13
+	QUAD $0x00000100249c8b4c     // movq	256(%rsp), %r11
+	LONG $0x30148d48             // leaq	(%rax,%rsi), %rdx
+	QUAD $0x000000c824b48b48     // movq	200(%rsp), %rsi
+	QUAD $0x0000015824948948     // movq	%rdx, 344(%rsp)
+
+BB0_64:
+	LONG $0xdb57e0c5                     // vxorps	%xmm3, %xmm3, %xmm3
+	WORD $0x854d; BYTE $0xdb             // testq	%r11, %r11
+	JLE  BB0_69
+	QUAD $0x000000a824bc8348; BYTE $0x02 // cmpq	$2, 168(%rsp)
+	JBE  BB0_86
+	QUAD $0x0000011824848b4c             // movq	280(%rsp), %r8
+	QUAD $0x0000015824948b48             // movq	344(%rsp), %rdx
+	WORD $0x894c; BYTE $0xd0             // movq	%r10, %rax
+	LONG $0xdb57e0c5                     // vxorps	%xmm3, %xmm3, %xmm3
+
+BB0_66:
+	LONG $0x107aa1c4; WORD $0x7014             // vmovss	(%rax,%r14,2), %xmm2
+	LONG $0x2169e3c4; WORD $0x3824; BYTE $0x10 // vinsertps	$0x10, (%rax,%rdi), %xmm2, %xmm4
+	LONG $0x10c08349                           // addq	$16, %r8
+	LONG $0x1010fac5                           // vmovss	(%rax), %xmm2
+	LONG $0x2169a3c4; WORD $0x3014; BYTE $0x10 // vinsertps	$0x10, (%rax,%r14), %xmm2, %xmm2
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0xd416e8c5                           // vmovlhps	%xmm4, %xmm2, %xmm2
+	LONG $0x5968c1c4; WORD $0xf050             // vmulps	-16(%r8), %xmm2, %xmm2
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xe2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm4
+	LONG $0xe358dac5                           // vaddss	%xmm3, %xmm4, %xmm4
+	LONG $0xda15e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm3
+	LONG $0xd2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm2
+	LONG $0xdc58e2c5                           // vaddss	%xmm4, %xmm3, %xmm3
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	WORD $0x3949; BYTE $0xd0                   // cmpq	%rdx, %r8
+	JNE  BB0_66
+	QUAD $0x000000a024848b48                   // movq	160(%rsp), %rax
+	QUAD $0x0000015824948948                   // movq	%rdx, 344(%rsp)
+	WORD $0x3949; BYTE $0xc3                   // cmpq	%rax, %r11
+	JE   BB0_69
+
+BB0_65:
+	WORD $0x894d; BYTE $0xe0                   // movq	%r12, %r8
+	QUAD $0x000000d024948b48                   // movq	208(%rsp), %rdx
+	LONG $0x030c8d4c                           // leaq	(%rbx,%rax), %r9
+	LONG $0xc0af0f4c                           // imulq	%rax, %r8
+	LONG $0x013c8d4e                           // leaq	(%rcx,%r8), %r15
+	LONG $0x107aa1c4; WORD $0xba3c             // vmovss	(%rdx,%r15,4), %xmm7
+	LONG $0xb94182c4; WORD $0x8d5c; BYTE $0x00 // vfmadd231ss	0(%r13,%r9,4), %xmm7, %xmm3
+	LONG $0x01488d4c                           // leaq	1(%rax), %r9
+	WORD $0x394d; BYTE $0xcb                   // cmpq	%r9, %r11
+	JLE  BB0_69
+	WORD $0x014d; BYTE $0xe0                   // addq	%r12, %r8
+	WORD $0x0149; BYTE $0xd9                   // addq	%rbx, %r9
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0x083c8d4d                           // leaq	(%r8,%rcx), %r15
+	LONG $0x107aa1c4; WORD $0xba3c             // vmovss	(%rdx,%r15,4), %xmm7
+	LONG $0xb94182c4; WORD $0x8d5c; BYTE $0x00 // vfmadd231ss	0(%r13,%r9,4), %xmm7, %xmm3
+	WORD $0x394c; BYTE $0xd8                   // cmpq	%r11, %rax
+	JGE  BB0_69
+	LONG $0x0c0c8d4d                           // leaq	(%r12,%rcx), %r9
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	WORD $0x014d; BYTE $0xc1                   // addq	%r8, %r9
+	LONG $0x107aa1c4; WORD $0x8a3c             // vmovss	(%rdx,%r9,4), %xmm7
+	LONG $0xb941c2c4; WORD $0x855c; BYTE $0x00 // vfmadd231ss	0(%r13,%rax,4), %xmm7, %xmm3
+
+BB0_69:
+	QUAD $0x000000b824848b48     // movq	184(%rsp), %rax
+	LONG $0x04c28349             // addq	$4, %r10
+	LONG $0x1c11fac5; BYTE $0x88 // vmovss	%xmm3, (%rax,%rcx,4)
+	LONG $0x01c18348             // addq	$1, %rcx
+	WORD $0x3949; BYTE $0xcc     // cmpq	%rcx, %r12
+	JNE  BB0_64
+	QUAD $0x0000013024ac8b4c     // movq	304(%rsp), %r13
+	QUAD $0x00000140249c8b4c     // movq	320(%rsp), %r11
+	QUAD $0x0000012824848b4c     // movq	296(%rsp), %r8
+
+BB0_63:
+	QUAD $0x0000010024848b48     // movq	256(%rsp), %rax
+	LONG $0x24748b48; BYTE $0x60 // movq	96(%rsp), %rsi
+	LONG $0x01c38349             // addq	$1, %r11
+	WORD $0x014d; BYTE $0xf5     // addq	%r14, %r13
+	QUAD $0x0000015024a4014c     // addq	%r12, 336(%rsp)
+	QUAD $0x000000b824b4014c     // addq	%r14, 184(%rsp)
+	WORD $0x0148; BYTE $0xc3     // addq	%rax, %rbx
+	QUAD $0x0000011824b40148     // addq	%rsi, 280(%rsp)
+	QUAD $0x0000009824b40148     // addq	%rsi, 152(%rsp)
+	LONG $0x245c394c; BYTE $0x68 // cmpq	%r11, 104(%rsp)
+	JNE  BB0_70
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+
+BB0_138:
+	LONG $0x90a58d48; WORD $0xfffe; BYTE $0xff // leaq	-368(%rbp), %rsp
+	RET
+
+BB0_72:
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xe328fcc5 // vmovaps	%ymm3, %ymm4
+	LONG $0xeb28fcc5 // vmovaps	%ymm3, %ymm5
+	LONG $0xf328fcc5 // vmovaps	%ymm3, %ymm6
+	JMP  BB0_6
+
+BB0_143:
+	LONG $0xf657c8c5 // vxorps	%xmm6, %xmm6, %xmm6
+	LONG $0xee28fcc5 // vmovaps	%ymm6, %ymm5
+	LONG $0xe628fcc5 // vmovaps	%ymm6, %ymm4
+	LONG $0xde28fcc5 // vmovaps	%ymm6, %ymm3
+	JMP  BB0_56
+
+BB0_73:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_9
+
+BB0_34:
+	QUAD $0x0000011824848b48             // movq	280(%rsp), %rax
+	QUAD $0x0000010024bc8348; BYTE $0x01 // cmpq	$1, 256(%rsp)
+	LONG $0x2010fac5                     // vmovss	(%rax), %xmm4
+	JG   BB0_29
+
+BB0_79:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xed57d0c5 // vxorps	%xmm5, %xmm5, %xmm5
+	JMP  BB0_30
+
+BB0_86:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+	JMP  BB0_65
+
+BB0_75:
+	WORD $0xf631     // xorl	%esi, %esi
+	LONG $0xdb57e0c5 // vxorps	%xmm3, %xmm3, %xmm3
+	JMP  BB0_20
+
+BB0_76:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_23
+
+BB0_5:
+	WORD   $0xd231                         // xorl	%edx, %edx
+	QUAD   $0x0000010024bc8348; BYTE $0x00 // cmpq	$0, 256(%rsp)
+	JG     BB0_16
+	VMOVSS CPI0_2<>(SB), X7                // vmovss	.LCPI0_2(%rip), %xmm7
+	LONG   $0xed57d0c5                     // vxorps	%xmm5, %xmm5, %xmm5
+	WORD   $0xc031                         // xorl	%eax, %eax
+	LONG   $0xed5ec2c5                     // vdivss	%xmm5, %xmm7, %xmm5
+	LONG   $0x187de2c4; BYTE $0xdd         // vbroadcastss	%xmm5, %ymm3
+	JMP    BB0_17
+
+BB0_142:
+	QUAD $0x0000010024948b48 // movq	256(%rsp), %rdx
+	WORD $0xc931             // xorl	%ecx, %ecx
+	WORD $0xf631             // xorl	%esi, %esi
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_49
+
+BB0_41:
+	VMOVSS CPI0_2<>(SB), X7                // vmovss	.LCPI0_2(%rip), %xmm7
+	QUAD   $0x0000010024bc8348; BYTE $0x07 // cmpq	$7, 256(%rsp)
+	LONG   $0xea5ec2c5                     // vdivss	%xmm2, %xmm7, %xmm5
+	LONG   $0x187de2c4; BYTE $0xdd         // vbroadcastss	%xmm5, %ymm3
+	JG     BB0_71
+	WORD   $0xc031                         // xorl	%eax, %eax
+	JMP    BB0_17
+
+BB0_77:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_31
+
+BB0_84:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_49
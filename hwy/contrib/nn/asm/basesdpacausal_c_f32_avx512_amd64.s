@@ -0,0 +1,1859 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basesdpacausal_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x7f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_10<>+0(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_10<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_12<>+0(SB)/4, $0x3f318000
+GLOBL CPI0_12<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_14<>+0(SB)/4, $0xb95e8083
+GLOBL CPI0_14<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_16<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_16<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_18<>+0(SB)/4, $0x3c088889
+GLOBL CPI0_18<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_20<>+0(SB)/4, $0x3d2aaaab
+GLOBL CPI0_20<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_22<>+0(SB)/4, $0x3e2aaaab
+GLOBL CPI0_22<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_24<>+0(SB)/4, $0x3f000000
+GLOBL CPI0_24<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_26<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_26<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_3<>+0(SB)/4, $0xff800000
+GLOBL CPI0_3<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_30<>+0(SB)/4, $0x652b82fe
+DATA CPI0_30<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_30<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_36<>+0(SB)/4, $0xfee00000
+DATA CPI0_36<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_36<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_38<>+0(SB)/4, $0x35793c6c
+DATA CPI0_38<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_38<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_40<>+0(SB)/4, $0xeff8d898
+DATA CPI0_40<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_40<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_42<>+0(SB)/4, $0x67f544e4
+DATA CPI0_42<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_42<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_44<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_44<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_44<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_46<>+0(SB)/4, $0xa556c734
+DATA CPI0_46<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_46<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_48<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_48<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_48<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_50<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_50<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_50<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_52<>+0(SB)/4, $0x16c16c17
+DATA CPI0_52<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_52<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_54<>+0(SB)/4, $0x11111111
+DATA CPI0_54<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_54<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_56<>+0(SB)/4, $0x55555555
+DATA CPI0_56<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_56<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_58<>+0(SB)/4, $0x55555555
+DATA CPI0_58<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_58<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_6<>+0(SB)/4, $0x42b17218
+GLOBL CPI0_6<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_60<>+0(SB)/4, $0x00000000
+DATA CPI0_60<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_60<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_62<>+0(SB)/4, $0x00000000
+DATA CPI0_62<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_62<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_65<>+0(SB)/4, $0xc4314000
+GLOBL CPI0_65<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_67<>+0(SB)/4, $0x44314000
+GLOBL CPI0_67<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_8<>+0(SB)/4, $0xc2aeac50
+GLOBL CPI0_8<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_89<>+0(SB)/4, $0x00000000
+DATA CPI0_89<>+4(SB)/4, $0x80000000
+DATA CPI0_89<>+8(SB)/4, $0x00000000
+DATA CPI0_89<>+12(SB)/4, $0x00000000
+GLOBL CPI0_89<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_90<>+0(SB)/4, $0xffffffff
+DATA CPI0_90<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_90<>+8(SB)/4, $0x00000000
+DATA CPI0_90<>+12(SB)/4, $0x00000000
+GLOBL CPI0_90<>(SB), (RODATA|NOPTR), $16
+
+TEXT ·sdpacausal_c_f32_avx512(SB), $448-112
+	MOVQ   q+0(FP), DI
+	MOVQ   k+8(FP), SI
+	MOVQ   v+16(FP), DX
+	MOVQ   scores+24(FP), CX
+	MOVQ   output+32(FP), R8
+	MOVQ   pseqLen+40(FP), R9
+	MOVQ   pkvLen+48(FP), R11
+	MOVQ   R11, 384(SP)
+	MOVQ   pheadDim+56(FP), R11
+	MOVQ   R11, 392(SP)
+	MOVQ   pscale+64(FP), R11
+	MOVQ   R11, 400(SP)
+	MOVQ   plen_q+72(FP), R11
+	MOVQ   R11, 408(SP)
+	MOVQ   plen_k+80(FP), R11
+	MOVQ   R11, 416(SP)
+	MOVQ   plen_v+88(FP), R11
+	MOVQ   R11, 424(SP)
+	MOVQ   plen_scores+96(FP), R11
+	MOVQ   R11, 432(SP)
+	MOVQ   plen_output+104(FP), R11
+	MOVQ   R11, 440(SP)
+	WORD   $0x8949; BYTE $0xca                   // movq	%rcx, %r10
+	QUAD   $0x0000017024ac8d48                   // leaq	368(%rsp), %rbp
+	WORD   $0x8948; BYTE $0xf3                   // movq	%rsi, %rbx
+	LONG   $0x24648d48; BYTE $0x40               // leaq	64(%rsp), %rsp
+	LONG   $0xc0e48348                           // andq	$-64, %rsp
+	LONG   $0x18458b48                           // movq	24(%rbp), %rax
+	QUAD   $0x000000b8248c8948                   // movq	%rcx, 184(%rsp)
+	WORD   $0x8b49; BYTE $0x09                   // movq	(%r9), %rcx
+	WORD   $0x8b4c; BYTE $0x30                   // movq	(%rax), %r14
+	LONG   $0x10458b48                           // movq	16(%rbp), %rax
+	LONG   $0x2444894c; BYTE $0x78               // movq	%r8, 120(%rsp)
+	WORD   $0x8548; BYTE $0xc9                   // testq	%rcx, %rcx
+	QUAD   $0x0000008824948948                   // movq	%rdx, 136(%rsp)
+	WORD   $0x8b48; BYTE $0x30                   // movq	(%rax), %rsi
+	WORD   $0x940f; BYTE $0xc0                   // sete	%al
+	QUAD   $0x0000012824bc8948                   // movq	%rdi, 296(%rsp)
+	WORD   $0x8548; BYTE $0xf6                   // testq	%rsi, %rsi
+	QUAD   $0x000000f824b48948                   // movq	%rsi, 248(%rsp)
+	WORD   $0x940f; BYTE $0xc2                   // sete	%dl
+	WORD   $0xd008                               // orb	%dl, %al
+	JNE    BB0_155
+	WORD   $0x854d; BYTE $0xf6                   // testq	%r14, %r14
+	JE     BB0_155
+	WORD   $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	WORD   $0x2948; BYTE $0xc8                   // subq	%rcx, %rax
+	WORD   $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	WORD   $0x8548; BYTE $0xc9                   // testq	%rcx, %rcx
+	JLE    BB0_155
+	LONG   $0x20458b48                           // movq	32(%rbp), %rax
+	LONG   $0x03fe8348                           // cmpq	$3, %rsi
+	WORD   $0x8949; BYTE $0xfb                   // movq	%rdi, %r11
+	QUAD   $0x00000000b5248d4e                   // leaq	0(,%r14,4), %r12
+	LONG   $0x24449f0f; BYTE $0x4f               // setg	79(%rsp)
+	VMOVSS CPI0_0<>(SB), X0                      // vmovss	.LCPI0_0(%rip), %xmm0
+	LONG   $0x1010fac5                           // vmovss	(%rax), %xmm2
+	WORD   $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG   $0x01728d48                           // leaq	1(%rdx), %rsi
+	QUAD   $0x000000c82484894c                   // movq	%r8, 200(%rsp)
+	QUAD   $0x0000009024b48948                   // movq	%rsi, 144(%rsp)
+	QUAD   $0x0000000085348d48                   // leaq	0(,%rax,4), %rsi
+	WORD   $0x8948; BYTE $0xf7                   // movq	%rsi, %rdi
+	LONG   $0x24748948; BYTE $0x58               // movq	%rsi, 88(%rsp)
+	LONG   $0x1879e2c4; BYTE $0xda               // vbroadcastss	%xmm2, %xmm3
+	WORD   $0x014c; BYTE $0xd7                   // addq	%r10, %rdi
+	QUAD   $0x000001202494894c                   // movq	%r10, 288(%rsp)
+	QUAD   $0x0000008024bc8948                   // movq	%rdi, 128(%rsp)
+	LONG   $0x117c8d48; BYTE $0x01               // leaq	1(%rcx,%rdx), %rdi
+	LONG   $0x36148d4b                           // leaq	(%r14,%r14), %rdx
+	LONG   $0x247c8948; BYTE $0x50               // movq	%rdi, 80(%rsp)
+	WORD   $0x894c; BYTE $0xf7                   // movq	%r14, %rdi
+	LONG   $0x04e7c148                           // salq	$4, %rdi
+	LONG   $0x24548948; BYTE $0x40               // movq	%rdx, 64(%rsp)
+	WORD   $0x014c; BYTE $0xf2                   // addq	%r14, %rdx
+	QUAD   $0x000000b024bc8948                   // movq	%rdi, 176(%rsp)
+	LONG   $0x233c8d4a                           // leaq	(%rbx,%r12), %rdi
+	QUAD   $0x00000000953c8d4c                   // leaq	0(,%rdx,4), %r15
+	LONG   $0x247c8948; BYTE $0x20               // movq	%rdi, 32(%rsp)
+	WORD   $0x014c; BYTE $0xe7                   // addq	%r12, %rdi
+	LONG   $0x24548948; BYTE $0x08               // movq	%rdx, 8(%rsp)
+	LONG   $0xf0568d49                           // leaq	-16(%r14), %rdx
+	LONG   $0xf0e28348                           // andq	$-16, %rdx
+	LONG   $0x247c8948; BYTE $0x18               // movq	%rdi, 24(%rsp)
+	WORD   $0x014c; BYTE $0xe7                   // addq	%r12, %rdi
+	LONG   $0x247c8948; BYTE $0x10               // movq	%rdi, 16(%rsp)
+	LONG   $0x107a8d48                           // leaq	16(%rdx), %rdi
+	LONG   $0xc0568d49                           // leaq	-64(%r14), %rdx
+	QUAD   $0x000000a824bc8948                   // movq	%rdi, 168(%rsp)
+	LONG   $0x06eac148                           // shrq	$6, %rdx
+	LONG   $0xf0788d48                           // leaq	-16(%rax), %rdi
+	LONG   $0x01c28348                           // addq	$1, %rdx
+	LONG   $0x247c8948; BYTE $0x68               // movq	%rdi, 104(%rsp)
+	LONG   $0xf0e78348                           // andq	$-16, %rdi
+	LONG   $0x107f8d48                           // leaq	16(%rdi), %rdi
+	WORD   $0x8949; BYTE $0xd5                   // movq	%rdx, %r13
+	LONG   $0x06e2c148                           // salq	$6, %rdx
+	QUAD   $0x000000d02484c748; LONG $0x00000000 // movq	$0, 208(%rsp)
+	LONG   $0x247c8948; BYTE $0x70               // movq	%rdi, 112(%rsp)
+	LONG   $0x107a8d48                           // leaq	16(%rdx), %rdi
+	LONG   $0x08e5c149                           // salq	$8, %r13
+	LONG   $0x24548948; BYTE $0x38               // movq	%rdx, 56(%rsp)
+	WORD   $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	LONG   $0x02eac148                           // shrq	$2, %rdx
+	LONG   $0x247c8948; BYTE $0x30               // movq	%rdi, 48(%rsp)
+	LONG   $0xff788d48                           // leaq	-1(%rax), %rdi
+	LONG   $0xfce08348                           // andq	$-4, %rax
+	LONG   $0x04e2c148                           // salq	$4, %rdx
+	QUAD   $0x000000a024bc8948                   // movq	%rdi, 160(%rsp)
+	LONG   $0x24548948; BYTE $0x28               // movq	%rdx, 40(%rsp)
+	QUAD   $0x000001382484c748; LONG $0x00000000 // movq	$0, 312(%rsp)
+	QUAD   $0x0000009824848948                   // movq	%rax, 152(%rsp)
+	WORD   $0x894c; BYTE $0xe0                   // movq	%r12, %rax
+	WORD   $0x894d; BYTE $0xec                   // movq	%r13, %r12
+	WORD   $0x894d; BYTE $0xf5                   // movq	%r14, %r13
+	WORD   $0x8949; BYTE $0xc6                   // movq	%rax, %r14
+
+BB0_77:
+	QUAD $0x0000009024848b48                   // movq	144(%rsp), %rax
+	LONG $0x03f88348                           // cmpq	$3, %rax
+	JLE  BB0_5
+	LONG $0x4f247c80; BYTE $0x00               // cmpb	$0, 79(%rsp)
+	JE   BB0_5
+	QUAD $0x000000f824b48b48                   // movq	248(%rsp), %rsi
+	LONG $0x24548b48; BYTE $0x40               // movq	64(%rsp), %rdx
+	WORD $0x8949; BYTE $0xd9                   // movq	%rbx, %r9
+	QUAD $0x000001002484c748; LONG $0x00000003 // movq	$3, 256(%rsp)
+	LONG $0x24448b4c; BYTE $0x10               // movq	16(%rsp), %r8
+	LONG $0x247c8b48; BYTE $0x18               // movq	24(%rsp), %rdi
+	LONG $0x2464894c; BYTE $0x60               // movq	%r12, 96(%rsp)
+	LONG $0x08fdc162; WORD $0xee6e             // vmovq	%r14, %xmm21
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	WORD $0x8949; BYTE $0xd4                   // movq	%rdx, %r12
+	QUAD $0x00000118249c894c                   // movq	%r11, 280(%rsp)
+	LONG $0x08fdc162; WORD $0xf76e             // vmovq	%r15, %xmm22
+	LONG $0xc64e0f48                           // cmovle	%rsi, %rax
+	LONG $0x24748b48; BYTE $0x20               // movq	32(%rsp), %rsi
+	WORD $0x3145; BYTE $0xd2                   // xorl	%r10d, %r10d
+	QUAD $0x000000c024848948                   // movq	%rax, 192(%rsp)
+	LONG $0x24448b48; BYTE $0x08               // movq	8(%rsp), %rax
+	WORD $0x8949; BYTE $0xc6                   // movq	%rax, %r14
+
+BB0_14:
+	LONG $0x2a048d4b               // leaq	(%r10,%r13), %rax
+	QUAD $0x0000013024848948       // movq	%rax, 304(%rsp)
+	LONG $0x0ffd8349               // cmpq	$15, %r13
+	JLE  BB0_78
+	LONG $0xff57c0c5               // vxorps	%xmm7, %xmm7, %xmm7
+	QUAD $0x00000118249c8b4c       // movq	280(%rsp), %r11
+	LONG $0x000010b8; BYTE $0x00   // movl	$16, %eax
+	LONG $0x487cf162; WORD $0xe728 // vmovaps	%zmm7, %zmm4
+	LONG $0x487cf162; WORD $0xef28 // vmovaps	%zmm7, %zmm5
+	LONG $0x487cf162; WORD $0xf728 // vmovaps	%zmm7, %zmm6
+
+BB0_7:
+	QUAD $0xff834c10487cd162 // vmovups	-64(%r11,%rax,4), %zmm1
+	QUAD $0xff8174b84875d262 // vfmadd231ps	-64(%r9,%rax,4), %zmm1, %zmm6
+	QUAD $0xff866cb84875f262 // vfmadd231ps	-64(%rsi,%rax,4), %zmm1, %zmm5
+	QUAD $0xff8764b84875f262 // vfmadd231ps	-64(%rdi,%rax,4), %zmm1, %zmm4
+	QUAD $0xff807cb84875d262 // vfmadd231ps	-64(%r8,%rax,4), %zmm1, %zmm7
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x394c; BYTE $0xe8 // cmpq	%r13, %rax
+	JLE  BB0_7
+	QUAD $0x00000118249c894c // movq	%r11, 280(%rsp)
+	QUAD $0x000000a824948b48 // movq	168(%rsp), %rdx
+
+BB0_6:
+	LONG $0x48fdf362; WORD $0xf11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm6, %ymm1
+	LONG $0xce58f4c5                           // vaddps	%ymm6, %ymm1, %ymm1
+	LONG $0x197de3c4; WORD $0x01ce             // vextractf128	$0x1, %ymm1, %xmm6
+	LONG $0xf158c8c5                           // vaddps	%xmm1, %xmm6, %xmm6
+	LONG $0x0479e3c4; WORD $0x4ece             // vpermilps	$78, %xmm6, %xmm1
+	LONG $0xce58f0c5                           // vaddps	%xmm6, %xmm1, %xmm1
+	LONG $0x48fdf362; WORD $0xee1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm6
+	LONG $0xed58ccc5                           // vaddps	%ymm5, %ymm6, %ymm5
+	LONG $0xf92878c5                           // vmovaps	%xmm1, %xmm15
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0x197de3c4; WORD $0x01ee             // vextractf128	$0x1, %ymm5, %xmm6
+	LONG $0xf95802c5                           // vaddss	%xmm1, %xmm15, %xmm15
+	LONG $0xed58c8c5                           // vaddps	%xmm5, %xmm6, %xmm5
+	LONG $0x0479e3c4; WORD $0x4ef5             // vpermilps	$78, %xmm5, %xmm6
+	LONG $0xf558c8c5                           // vaddps	%xmm5, %xmm6, %xmm6
+	LONG $0x48fdf362; WORD $0xe51b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm5
+	LONG $0xe458d4c5                           // vaddps	%ymm4, %ymm5, %ymm4
+	LONG $0xce28f8c5                           // vmovaps	%xmm6, %xmm1
+	LONG $0xf6c6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm6
+	LONG $0x197de3c4; WORD $0x01e5             // vextractf128	$0x1, %ymm4, %xmm5
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xe458d0c5                           // vaddps	%xmm4, %xmm5, %xmm4
+	LONG $0xf91400c5                           // vunpcklps	%xmm1, %xmm15, %xmm15
+	LONG $0x0479e3c4; WORD $0x4eec             // vpermilps	$78, %xmm4, %xmm5
+	LONG $0xec58d0c5                           // vaddps	%xmm4, %xmm5, %xmm5
+	LONG $0x48fdf362; WORD $0xfc1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm7, %ymm4
+	LONG $0xfc58c4c5                           // vaddps	%ymm4, %ymm7, %ymm7
+	LONG $0xf528f8c5                           // vmovaps	%xmm5, %xmm6
+	LONG $0xedc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm5
+	LONG $0x197de3c4; WORD $0x01fc             // vextractf128	$0x1, %ymm7, %xmm4
+	LONG $0xf558cac5                           // vaddss	%xmm5, %xmm6, %xmm6
+	LONG $0xff58d8c5                           // vaddps	%xmm7, %xmm4, %xmm7
+	LONG $0x0479e3c4; WORD $0x4ee7             // vpermilps	$78, %xmm7, %xmm4
+	LONG $0xe758d8c5                           // vaddps	%xmm7, %xmm4, %xmm4
+	LONG $0xec28f8c5                           // vmovaps	%xmm4, %xmm5
+	LONG $0xe4c6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm4
+	LONG $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG $0xed14c8c5                           // vunpcklps	%xmm5, %xmm6, %xmm5
+	LONG $0xfd1600c5                           // vmovlhps	%xmm5, %xmm15, %xmm15
+	WORD $0x3949; BYTE $0xd5                   // cmpq	%rdx, %r13
+	JLE  BB0_8
+	WORD $0x894c; BYTE $0xe8                   // movq	%r13, %rax
+	QUAD $0x0000010824948948                   // movq	%rdx, 264(%rsp)
+	WORD $0x2948; BYTE $0xd0                   // subq	%rdx, %rax
+	QUAD $0x0000011024848948                   // movq	%rax, 272(%rsp)
+	LONG $0x01e88348                           // subq	$1, %rax
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_79
+	QUAD $0x00000138248c8b48                   // movq	312(%rsp), %rcx
+	QUAD $0x000000d8249c8948                   // movq	%rbx, 216(%rsp)
+	QUAD $0x000000f024948948                   // movq	%rdx, 240(%rsp)
+	LONG $0x0a048d48                           // leaq	(%rdx,%rcx), %rax
+	QUAD $0x00000128248c8b48                   // movq	296(%rsp), %rcx
+	QUAD $0x000000e824b48948                   // movq	%rsi, 232(%rsp)
+	QUAD $0x000000e024bc8948                   // movq	%rdi, 224(%rsp)
+	LONG $0x810c8d48                           // leaq	(%rcx,%rax,4), %rcx
+	LONG $0x12048d4a                           // leaq	(%rdx,%r10), %rax
+	LONG $0x831c8d4c                           // leaq	(%rbx,%rax,4), %r11
+	LONG $0x08fdc162; WORD $0xdb6e             // vmovq	%r11, %xmm19
+	QUAD $0x00000130249c8b4c                   // movq	304(%rsp), %r11
+	LONG $0x1a048d4a                           // leaq	(%rdx,%r11), %rax
+	LONG $0x831c8d4c                           // leaq	(%rbx,%rax,4), %r11
+	LONG $0x22048d4a                           // leaq	(%rdx,%r12), %rax
+	LONG $0x833c8d4c                           // leaq	(%rbx,%rax,4), %r15
+	LONG $0x32048d4a                           // leaq	(%rdx,%r14), %rax
+	LONG $0x08fdc162; WORD $0xd36e             // vmovq	%r11, %xmm18
+	LONG $0x831c8d4c                           // leaq	(%rbx,%rax,4), %r11
+	QUAD $0x0000011024848b48                   // movq	272(%rsp), %rax
+	WORD $0x894c; BYTE $0xff                   // movq	%r15, %rdi
+	QUAD $0x00000118249c8b48                   // movq	280(%rsp), %rbx
+	LONG $0x08fdc162; WORD $0xc36e             // vmovq	%r11, %xmm16
+	LONG $0x08fde162; WORD $0xd67e             // vmovq	%xmm18, %rsi
+	LONG $0x08fdc162; WORD $0xdf7e             // vmovq	%xmm19, %r15
+	LONG $0x04e8c148                           // shrq	$4, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	WORD $0x8949; BYTE $0xc3                   // movq	%rax, %r11
+	WORD $0xc031                               // xorl	%eax, %eax
+	WORD $0x894c; BYTE $0xda                   // movq	%r11, %rdx
+	WORD $0x894d; BYTE $0xc3                   // movq	%r8, %r11
+	LONG $0x08fdc162; WORD $0xc07e             // vmovq	%xmm16, %r8
+
+BB0_10:
+	LONG $0x487cf162; WORD $0x2410; BYTE $0x01 // vmovups	(%rcx,%rax), %zmm4
+	LONG $0x485cd162; WORD $0x2c59; BYTE $0x07 // vmulps	(%r15,%rax), %zmm4, %zmm5
+	LONG $0x485c7162; WORD $0x0459; BYTE $0x06 // vmulps	(%rsi,%rax), %zmm4, %zmm8
+	LONG $0x485cf162; WORD $0x3459; BYTE $0x07 // vmulps	(%rdi,%rax), %zmm4, %zmm6
+	LONG $0x485cd162; WORD $0x2459; BYTE $0x00 // vmulps	(%r8,%rax), %zmm4, %zmm4
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0xcdc650c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm9
+	LONG $0x2855f362; WORD $0xfd03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm7
+	LONG $0x083cc162; WORD $0xd8c6; BYTE $0x55 // vshufps	$85, %xmm8, %xmm8, %xmm19
+	LONG $0x1450c1c4; BYTE $0xc8               // vunpcklps	%xmm8, %xmm5, %xmm1
+	LONG $0x083cc162; WORD $0xf8c6; BYTE $0xff // vshufps	$255, %xmm8, %xmm8, %xmm23
+	LONG $0x08343162; WORD $0xcf14             // vunpcklps	%xmm23, %xmm9, %xmm9
+	LONG $0xdec648c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm11
+	LONG $0x283d5362; WORD $0xe003; BYTE $0x07 // valignd	$7, %ymm8, %ymm8, %ymm12
+	LONG $0x085ce162; WORD $0xe4c6; BYTE $0x55 // vshufps	$85, %xmm4, %xmm4, %xmm20
+	LONG $0xf41448c5                           // vunpcklps	%xmm4, %xmm6, %xmm14
+	LONG $0x085c6162; WORD $0xc4c6; BYTE $0xff // vshufps	$255, %xmm4, %xmm4, %xmm24
+	LONG $0x08241162; WORD $0xd814             // vunpcklps	%xmm24, %xmm11, %xmm11
+	LONG $0x285d7362; WORD $0xec03; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm13
+	LONG $0x1670c1c4; BYTE $0xce               // vmovlhps	%xmm14, %xmm1, %xmm1
+	LONG $0xf5c650c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm14
+	LONG $0x080c3162; WORD $0xf314             // vunpcklps	%xmm19, %xmm14, %xmm14
+	LONG $0x5870c1c4; BYTE $0xcf               // vaddps	%xmm15, %xmm1, %xmm1
+	LONG $0xfec648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm15
+	LONG $0x08043162; WORD $0xfc14             // vunpcklps	%xmm20, %xmm15, %xmm15
+	LONG $0x083cc162; WORD $0xd815             // vunpckhps	%xmm8, %xmm8, %xmm19
+	LONG $0x160841c4; BYTE $0xf7               // vmovlhps	%xmm15, %xmm14, %xmm14
+	LONG $0x085ce162; WORD $0xe415             // vunpckhps	%xmm4, %xmm4, %xmm20
+	LONG $0xfe1548c5                           // vunpckhps	%xmm6, %xmm6, %xmm15
+	LONG $0x284d7362; WORD $0xd603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm10
+	LONG $0x08043162; WORD $0xfc14             // vunpcklps	%xmm20, %xmm15, %xmm15
+	LONG $0x163041c4; BYTE $0xcb               // vmovlhps	%xmm11, %xmm9, %xmm9
+	LONG $0x287d5362; WORD $0xc319; BYTE $0x01 // vextractf32x4	$1, %ymm8, %xmm11
+	LONG $0x5870c1c4; BYTE $0xce               // vaddps	%xmm14, %xmm1, %xmm1
+	LONG $0xf51550c5                           // vunpckhps	%xmm5, %xmm5, %xmm14
+	LONG $0x1440c1c4; BYTE $0xfc               // vunpcklps	%xmm12, %xmm7, %xmm7
+	LONG $0x080c3162; WORD $0xf314             // vunpcklps	%xmm19, %xmm14, %xmm14
+	LONG $0x160841c4; BYTE $0xf7               // vmovlhps	%xmm15, %xmm14, %xmm14
+	LONG $0x587041c4; BYTE $0xfe               // vaddps	%xmm14, %xmm1, %xmm15
+	LONG $0x287dd362; WORD $0xe619; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm14
+	LONG $0x287df362; WORD $0xe919; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm1
+	LONG $0x142841c4; BYTE $0xd5               // vunpcklps	%xmm13, %xmm10, %xmm10
+	LONG $0x580041c4; BYTE $0xf9               // vaddps	%xmm9, %xmm15, %xmm15
+	LONG $0x1640c1c4; BYTE $0xfa               // vmovlhps	%xmm10, %xmm7, %xmm7
+	LONG $0x287dd362; WORD $0xf119; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm9
+	LONG $0x1470c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0x283d5362; WORD $0xd803; BYTE $0x05 // valignd	$5, %ymm8, %ymm8, %ymm11
+	LONG $0x143041c4; BYTE $0xce               // vunpcklps	%xmm14, %xmm9, %xmm9
+	LONG $0x285d7362; WORD $0xf403; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm14
+	LONG $0x1670c1c4; BYTE $0xc9               // vmovlhps	%xmm9, %xmm1, %xmm1
+	LONG $0x284d7362; WORD $0xce03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm9
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x2855f362; WORD $0xcd03; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm1
+	LONG $0x143041c4; BYTE $0xce               // vunpcklps	%xmm14, %xmm9, %xmm9
+	LONG $0x285d7362; WORD $0xf403; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm14
+	LONG $0x1470c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0x487df362; WORD $0xe41b; BYTE $0x01 // vextractf32x8	$0x1, %zmm4, %ymm4
+	LONG $0x283d5362; WORD $0xd803; BYTE $0x06 // valignd	$6, %ymm8, %ymm8, %ymm11
+	LONG $0x1670c1c4; BYTE $0xc9               // vmovlhps	%xmm9, %xmm1, %xmm1
+	LONG $0x487d5362; WORD $0xc01b; BYTE $0x01 // vextractf32x8	$0x1, %zmm8, %ymm8
+	LONG $0xe4c658c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm12
+	LONG $0x284d7362; WORD $0xce03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm9
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x487df362; WORD $0xf61b; BYTE $0x01 // vextractf32x8	$0x1, %zmm6, %ymm6
+	LONG $0xc63841c4; WORD $0x55e8             // vshufps	$85, %xmm8, %xmm8, %xmm13
+	LONG $0x2855f362; WORD $0xcd03; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm1
+	LONG $0x487df362; WORD $0xed1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm5, %ymm5
+	LONG $0xd41448c5                           // vunpcklps	%xmm4, %xmm6, %xmm10
+	LONG $0x143041c4; BYTE $0xce               // vunpcklps	%xmm14, %xmm9, %xmm9
+	LONG $0xf4c658c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm14
+	LONG $0x1470c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0xc63841c4; WORD $0xffd8             // vshufps	$255, %xmm8, %xmm8, %xmm11
+	LONG $0x1670c1c4; BYTE $0xc9               // vmovlhps	%xmm9, %xmm1, %xmm1
+	LONG $0x145041c4; BYTE $0xc8               // vunpcklps	%xmm8, %xmm5, %xmm9
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x163041c4; BYTE $0xca               // vmovlhps	%xmm10, %xmm9, %xmm9
+	LONG $0xd6c648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm10
+	LONG $0x142841c4; BYTE $0xd6               // vunpcklps	%xmm14, %xmm10, %xmm10
+	LONG $0xf41558c5                           // vunpckhps	%xmm4, %xmm4, %xmm14
+	LONG $0xcdc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm1
+	LONG $0x1470c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0xff5800c5                           // vaddps	%xmm7, %xmm15, %xmm15
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0x1440c1c4; BYTE $0xfc               // vunpcklps	%xmm12, %xmm7, %xmm7
+	LONG $0xcf16f0c5                           // vmovlhps	%xmm7, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xf719; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm7
+	LONG $0x580041c4; BYTE $0xf9               // vaddps	%xmm9, %xmm15, %xmm15
+	LONG $0xcdc650c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm9
+	LONG $0x143041c4; BYTE $0xcd               // vunpcklps	%xmm13, %xmm9, %xmm9
+	LONG $0x153841c4; BYTE $0xe8               // vunpckhps	%xmm8, %xmm8, %xmm13
+	LONG $0x163041c4; BYTE $0xca               // vmovlhps	%xmm10, %xmm9, %xmm9
+	LONG $0xd61548c5                           // vunpckhps	%xmm6, %xmm6, %xmm10
+	LONG $0x142841c4; BYTE $0xd6               // vunpcklps	%xmm14, %xmm10, %xmm10
+	LONG $0x580041c4; BYTE $0xf9               // vaddps	%xmm9, %xmm15, %xmm15
+	LONG $0xcd1550c5                           // vunpckhps	%xmm5, %xmm5, %xmm9
+	LONG $0x143041c4; BYTE $0xcd               // vunpcklps	%xmm13, %xmm9, %xmm9
+	LONG $0x163041c4; BYTE $0xca               // vmovlhps	%xmm10, %xmm9, %xmm9
+	LONG $0x287dd362; WORD $0xe219; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm10
+	LONG $0x580041c4; BYTE $0xf9               // vaddps	%xmm9, %xmm15, %xmm15
+	LONG $0x287d5362; WORD $0xc119; BYTE $0x01 // vextractf32x4	$1, %ymm8, %xmm9
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x287df362; WORD $0xe919; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm1
+	LONG $0x1440c1c4; BYTE $0xfa               // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0x285d7362; WORD $0xd403; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm10
+	LONG $0x1470c1c4; BYTE $0xc9               // vunpcklps	%xmm9, %xmm1, %xmm1
+	LONG $0x283d5362; WORD $0xc803; BYTE $0x05 // valignd	$5, %ymm8, %ymm8, %ymm9
+	LONG $0xcf16f0c5                           // vmovlhps	%xmm7, %xmm1, %xmm1
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm7
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x2855f362; WORD $0xcd03; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm1
+	LONG $0x1440c1c4; BYTE $0xfa               // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0x285d7362; WORD $0xd403; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm10
+	LONG $0x1470c1c4; BYTE $0xc9               // vunpcklps	%xmm9, %xmm1, %xmm1
+	LONG $0x283d5362; WORD $0xc803; BYTE $0x06 // valignd	$6, %ymm8, %ymm8, %ymm9
+	LONG $0xcf16f0c5                           // vmovlhps	%xmm7, %xmm1, %xmm1
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm7
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x2855f362; WORD $0xcd03; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm1
+	LONG $0x283d5362; WORD $0xc003; BYTE $0x07 // valignd	$7, %ymm8, %ymm8, %ymm8
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0x285df362; WORD $0xe403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm4
+	LONG $0x1440c1c4; BYTE $0xfa               // vunpcklps	%xmm10, %xmm7, %xmm7
+	LONG $0x1470c1c4; BYTE $0xc9               // vunpcklps	%xmm9, %xmm1, %xmm1
+	LONG $0xcf16f0c5                           // vmovlhps	%xmm7, %xmm1, %xmm1
+	LONG $0xf95800c5                           // vaddps	%xmm1, %xmm15, %xmm15
+	LONG $0x1450c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0xe414c8c5                           // vunpcklps	%xmm4, %xmm6, %xmm4
+	LONG $0xec16d0c5                           // vmovlhps	%xmm4, %xmm5, %xmm5
+	LONG $0xfd5800c5                           // vaddps	%xmm5, %xmm15, %xmm15
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JNE  BB0_10
+	QUAD $0x00000110248c8b48                   // movq	272(%rsp), %rcx
+	QUAD $0x000000f024948b48                   // movq	240(%rsp), %rdx
+	QUAD $0x00000118249c8948                   // movq	%rbx, 280(%rsp)
+	WORD $0x894d; BYTE $0xd8                   // movq	%r11, %r8
+	QUAD $0x000000e824b48b48                   // movq	232(%rsp), %rsi
+	QUAD $0x000000e024bc8b48                   // movq	224(%rsp), %rdi
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	QUAD $0x000000d8249c8b48                   // movq	216(%rsp), %rbx
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe183; BYTE $0x0f                   // andl	$15, %ecx
+	JE   BB0_8
+
+BB0_9:
+	QUAD $0x00000110248c8b48                   // movq	272(%rsp), %rcx
+	WORD $0x2948; BYTE $0xc1                   // subq	%rax, %rcx
+	LONG $0xff798d4c                           // leaq	-1(%rcx), %r15
+	LONG $0x06ff8349                           // cmpq	$6, %r15
+	JBE  BB0_12
+	QUAD $0x0000010824bc8b4c                   // movq	264(%rsp), %r15
+	QUAD $0x00000128249c8b4c                   // movq	296(%rsp), %r11
+	WORD $0x0149; BYTE $0xc7                   // addq	%rax, %r15
+	WORD $0x894c; BYTE $0xf8                   // movq	%r15, %rax
+	QUAD $0x0000013824bc8b4c                   // movq	312(%rsp), %r15
+	WORD $0x0149; BYTE $0xc7                   // addq	%rax, %r15
+	LONG $0x107c81c4; WORD $0xbb3c             // vmovups	(%r11,%r15,4), %ymm7
+	QUAD $0x00000130249c8b4c                   // movq	304(%rsp), %r11
+	LONG $0x103c8d4e                           // leaq	(%rax,%r10), %r15
+	LONG $0x5944a1c4; WORD $0xbb24             // vmulps	(%rbx,%r15,4), %ymm7, %ymm4
+	LONG $0x183c8d4e                           // leaq	(%rax,%r11), %r15
+	LONG $0x594421c4; WORD $0xbb1c             // vmulps	(%rbx,%r15,4), %ymm7, %ymm11
+	LONG $0x203c8d4e                           // leaq	(%rax,%r12), %r15
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x594421c4; WORD $0xbb14             // vmulps	(%rbx,%r15,4), %ymm7, %ymm10
+	LONG $0x3c59c4c5; BYTE $0x83               // vmulps	(%rbx,%rax,4), %ymm7, %ymm7
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	LONG $0xecc6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm5
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe183; BYTE $0x07                   // andl	$7, %ecx
+	LONG $0x1458c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm4, %xmm1
+	LONG $0xc62041c4; WORD $0x55f3             // vshufps	$85, %xmm11, %xmm11, %xmm14
+	LONG $0xc62041c4; WORD $0xffc3             // vshufps	$255, %xmm11, %xmm11, %xmm8
+	LONG $0x1450c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0xc62841c4; WORD $0x55ea             // vshufps	$85, %xmm10, %xmm10, %xmm13
+	LONG $0xc628c1c4; WORD $0xfff2             // vshufps	$255, %xmm10, %xmm10, %xmm6
+	LONG $0x287d5362; WORD $0xd819; BYTE $0x01 // vextractf32x4	$1, %ymm11, %xmm8
+	LONG $0xe71428c5                           // vunpcklps	%xmm7, %xmm10, %xmm12
+	LONG $0xcfc640c5; BYTE $0xff               // vshufps	$255, %xmm7, %xmm7, %xmm9
+	LONG $0x1448c1c4; BYTE $0xf1               // vunpcklps	%xmm9, %xmm6, %xmm6
+	LONG $0x287dd362; WORD $0xf919; BYTE $0x01 // vextractf32x4	$1, %ymm7, %xmm9
+	LONG $0x1670c1c4; BYTE $0xcc               // vmovlhps	%xmm12, %xmm1, %xmm1
+	LONG $0xe4c658c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm12
+	LONG $0x141841c4; BYTE $0xe6               // vunpcklps	%xmm14, %xmm12, %xmm12
+	LONG $0x5870c1c4; BYTE $0xcf               // vaddps	%xmm15, %xmm1, %xmm1
+	LONG $0x152041c4; BYTE $0xf3               // vunpckhps	%xmm11, %xmm11, %xmm14
+	LONG $0xffc640c5; BYTE $0x55               // vshufps	$85, %xmm7, %xmm7, %xmm15
+	LONG $0x141041c4; BYTE $0xef               // vunpcklps	%xmm15, %xmm13, %xmm13
+	LONG $0x161841c4; BYTE $0xe5               // vmovlhps	%xmm13, %xmm12, %xmm12
+	LONG $0xff1540c5                           // vunpckhps	%xmm7, %xmm7, %xmm15
+	LONG $0x152841c4; BYTE $0xea               // vunpckhps	%xmm10, %xmm10, %xmm13
+	LONG $0x141041c4; BYTE $0xef               // vunpcklps	%xmm15, %xmm13, %xmm13
+	LONG $0xee16d0c5                           // vmovlhps	%xmm6, %xmm5, %xmm5
+	LONG $0x287d7362; WORD $0xd619; BYTE $0x01 // vextractf32x4	$1, %ymm10, %xmm6
+	LONG $0x5870c1c4; BYTE $0xcc               // vaddps	%xmm12, %xmm1, %xmm1
+	LONG $0xe41558c5                           // vunpckhps	%xmm4, %xmm4, %xmm12
+	LONG $0x141841c4; BYTE $0xe6               // vunpcklps	%xmm14, %xmm12, %xmm12
+	LONG $0x161841c4; BYTE $0xe5               // vmovlhps	%xmm13, %xmm12, %xmm12
+	LONG $0x5870c1c4; BYTE $0xcc               // vaddps	%xmm12, %xmm1, %xmm1
+	LONG $0xcd58f0c5                           // vaddps	%xmm5, %xmm1, %xmm1
+	LONG $0x1448c1c4; BYTE $0xf1               // vunpcklps	%xmm9, %xmm6, %xmm6
+	LONG $0x287df362; WORD $0xe519; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm5
+	LONG $0x28457362; WORD $0xcf03; BYTE $0x05 // valignd	$5, %ymm7, %ymm7, %ymm9
+	LONG $0x1450c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0x28255362; WORD $0xc303; BYTE $0x05 // valignd	$5, %ymm11, %ymm11, %ymm8
+	LONG $0xee16d0c5                           // vmovlhps	%xmm6, %xmm5, %xmm5
+	LONG $0x282dd362; WORD $0xf203; BYTE $0x05 // valignd	$5, %ymm10, %ymm10, %ymm6
+	LONG $0xcd58f0c5                           // vaddps	%xmm5, %xmm1, %xmm1
+	LONG $0x285df362; WORD $0xec03; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm5
+	LONG $0x1448c1c4; BYTE $0xf1               // vunpcklps	%xmm9, %xmm6, %xmm6
+	LONG $0x28457362; WORD $0xcf03; BYTE $0x06 // valignd	$6, %ymm7, %ymm7, %ymm9
+	LONG $0x1450c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0x28255362; WORD $0xc303; BYTE $0x06 // valignd	$6, %ymm11, %ymm11, %ymm8
+	LONG $0xee16d0c5                           // vmovlhps	%xmm6, %xmm5, %xmm5
+	LONG $0x282dd362; WORD $0xf203; BYTE $0x06 // valignd	$6, %ymm10, %ymm10, %ymm6
+	LONG $0xcd58f0c5                           // vaddps	%xmm5, %xmm1, %xmm1
+	LONG $0x285df362; WORD $0xec03; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm5
+	LONG $0x28255362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm11, %ymm11, %ymm11
+	LONG $0x285df362; WORD $0xe403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm4
+	LONG $0x2845f362; WORD $0xff03; BYTE $0x07 // valignd	$7, %ymm7, %ymm7, %ymm7
+	LONG $0x1448c1c4; BYTE $0xf1               // vunpcklps	%xmm9, %xmm6, %xmm6
+	LONG $0x1450c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0xee16d0c5                           // vmovlhps	%xmm6, %xmm5, %xmm5
+	LONG $0xcd58f0c5                           // vaddps	%xmm5, %xmm1, %xmm1
+	LONG $0x1458c1c4; BYTE $0xe3               // vunpcklps	%xmm11, %xmm4, %xmm4
+	LONG $0x282dd362; WORD $0xea03; BYTE $0x07 // valignd	$7, %ymm10, %ymm10, %ymm5
+	LONG $0xef14d0c5                           // vunpcklps	%xmm7, %xmm5, %xmm5
+	LONG $0xe516d8c5                           // vmovlhps	%xmm5, %xmm4, %xmm4
+	LONG $0xfc5870c5                           // vaddps	%xmm4, %xmm1, %xmm15
+	JE   BB0_8
+
+BB0_12:
+	LONG $0x141c8d4d                           // leaq	(%r12,%rdx), %r11
+	QUAD $0x00000130248c8b48                   // movq	304(%rsp), %rcx
+	LONG $0x123c8d4d                           // leaq	(%r10,%rdx), %r15
+	QUAD $0x0000013824848b48                   // movq	312(%rsp), %rax
+	LONG $0x6ef9c1c4; BYTE $0xe3               // vmovq	%r11, %xmm4
+	LONG $0x161c8d4d                           // leaq	(%r14,%rdx), %r11
+	LONG $0x6ef9c1c4; BYTE $0xcb               // vmovq	%r11, %xmm1
+	LONG $0x7ef9c1c4; BYTE $0xe3               // vmovq	%xmm4, %r11
+	WORD $0x0148; BYTE $0xd1                   // addq	%rdx, %rcx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x107aa1c4; WORD $0x9b24             // vmovss	(%rbx,%r11,4), %xmm4
+	LONG $0x7ef9c1c4; BYTE $0xcb               // vmovq	%xmm1, %r11
+	LONG $0x107aa1c4; WORD $0xbb0c             // vmovss	(%rbx,%r15,4), %xmm1
+	LONG $0x2159a3c4; WORD $0x9b24; BYTE $0x10 // vinsertps	$0x10, (%rbx,%r11,4), %xmm4, %xmm4
+	LONG $0x2171e3c4; WORD $0x8b0c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rcx,4), %xmm1, %xmm1
+	QUAD $0x00000128248c8b48                   // movq	296(%rsp), %rcx
+	LONG $0xcc16f0c5                           // vmovlhps	%xmm4, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x81 // vfmadd231ps	(%rcx,%rax,4){1to4}, %xmm1, %xmm15
+	LONG $0x01428d48                           // leaq	1(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_8
+	QUAD $0x0000013824bc8b4c                   // movq	312(%rsp), %r15
+	LONG $0x021c8d4d                           // leaq	(%r10,%rax), %r11
+	LONG $0x6ef9c1c4; BYTE $0xcb               // vmovq	%r11, %xmm1
+	LONG $0x041c8d4d                           // leaq	(%r12,%rax), %r11
+	LONG $0x070c8d49                           // leaq	(%r15,%rax), %rcx
+	QUAD $0x0000013024bc8b4c                   // movq	304(%rsp), %r15
+	LONG $0x107aa1c4; WORD $0x9b24             // vmovss	(%rbx,%r11,4), %xmm4
+	LONG $0x7ef9c1c4; BYTE $0xcb               // vmovq	%xmm1, %r11
+	LONG $0x107aa1c4; WORD $0x9b0c             // vmovss	(%rbx,%r11,4), %xmm1
+	WORD $0x0149; BYTE $0xc7                   // addq	%rax, %r15
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x2159e3c4; WORD $0x8324; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rax,4), %xmm4, %xmm4
+	LONG $0x2171a3c4; WORD $0xbb0c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%r15,4), %xmm1, %xmm1
+	QUAD $0x0000012824848b48                   // movq	296(%rsp), %rax
+	LONG $0xcc16f0c5                           // vmovlhps	%xmm4, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x88 // vfmadd231ps	(%rax,%rcx,4){1to4}, %xmm1, %xmm15
+	LONG $0x02428d48                           // leaq	2(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_8
+	LONG $0x021c8d4d                           // leaq	(%r10,%rax), %r11
+	QUAD $0x00000138248c8b48                   // movq	312(%rsp), %rcx
+	QUAD $0x0000013024bc8b4c                   // movq	304(%rsp), %r15
+	LONG $0x6ef9c1c4; BYTE $0xcb               // vmovq	%r11, %xmm1
+	LONG $0x041c8d4d                           // leaq	(%r12,%rax), %r11
+	LONG $0x107aa1c4; WORD $0x9b24             // vmovss	(%rbx,%r11,4), %xmm4
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	WORD $0x0149; BYTE $0xc7                   // addq	%rax, %r15
+	LONG $0x7ef9c1c4; BYTE $0xcb               // vmovq	%xmm1, %r11
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x107aa1c4; WORD $0x9b0c             // vmovss	(%rbx,%r11,4), %xmm1
+	LONG $0x2171a3c4; WORD $0xbb0c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%r15,4), %xmm1, %xmm1
+	LONG $0x2159e3c4; WORD $0x8324; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rax,4), %xmm4, %xmm4
+	QUAD $0x0000012824848b48                   // movq	296(%rsp), %rax
+	LONG $0xcc16f0c5                           // vmovlhps	%xmm4, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x88 // vfmadd231ps	(%rax,%rcx,4){1to4}, %xmm1, %xmm15
+	LONG $0x03428d48                           // leaq	3(%rdx), %rax
+	WORD $0x394c; BYTE $0xe8                   // cmpq	%r13, %rax
+	JGE  BB0_8
+	LONG $0x101c8d4e                           // leaq	(%rax,%r10), %r11
+	QUAD $0x00000138248c8b48                   // movq	312(%rsp), %rcx
+	QUAD $0x0000013024bc8b4c                   // movq	304(%rsp), %r15
+	LONG $0x6ef9c1c4; BYTE $0xcb               // vmovq	%r11, %xmm1
+	LONG $0x201c8d4e                           // leaq	(%rax,%r12), %r11
+	LONG $0x107aa1c4; WORD $0x9b24             // vmovss	(%rbx,%r11,4), %xmm4
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	WORD $0x0149; BYTE $0xc7                   // addq	%rax, %r15
+	LONG $0x7ef9c1c4; BYTE $0xcb               // vmovq	%xmm1, %r11
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x107aa1c4; WORD $0x9b0c             // vmovss	(%rbx,%r11,4), %xmm1
+	LONG $0x2171a3c4; WORD $0xbb0c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%r15,4), %xmm1, %xmm1
+	LONG $0x2159e3c4; WORD $0x8324; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rax,4), %xmm4, %xmm4
+	QUAD $0x0000012824848b48                   // movq	296(%rsp), %rax
+	LONG $0xcc16f0c5                           // vmovlhps	%xmm4, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x88 // vfmadd231ps	(%rax,%rcx,4){1to4}, %xmm1, %xmm15
+	LONG $0x04428d48                           // leaq	4(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_8
+	LONG $0x021c8d4d                           // leaq	(%r10,%rax), %r11
+	QUAD $0x00000138248c8b48                   // movq	312(%rsp), %rcx
+	QUAD $0x0000013024bc8b4c                   // movq	304(%rsp), %r15
+	LONG $0x6ef9c1c4; BYTE $0xcb               // vmovq	%r11, %xmm1
+	LONG $0x041c8d4d                           // leaq	(%r12,%rax), %r11
+	LONG $0x107aa1c4; WORD $0x9b24             // vmovss	(%rbx,%r11,4), %xmm4
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	WORD $0x0149; BYTE $0xc7                   // addq	%rax, %r15
+	LONG $0x7ef9c1c4; BYTE $0xcb               // vmovq	%xmm1, %r11
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x107aa1c4; WORD $0x9b0c             // vmovss	(%rbx,%r11,4), %xmm1
+	LONG $0x2171a3c4; WORD $0xbb0c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%r15,4), %xmm1, %xmm1
+	LONG $0x2159e3c4; WORD $0x8324; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rax,4), %xmm4, %xmm4
+	QUAD $0x0000012824848b48                   // movq	296(%rsp), %rax
+	LONG $0xcc16f0c5                           // vmovlhps	%xmm4, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x88 // vfmadd231ps	(%rax,%rcx,4){1to4}, %xmm1, %xmm15
+	LONG $0x05428d48                           // leaq	5(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5                   // cmpq	%rax, %r13
+	JLE  BB0_8
+	LONG $0x021c8d4d                           // leaq	(%r10,%rax), %r11
+	QUAD $0x00000138248c8b48                   // movq	312(%rsp), %rcx
+	QUAD $0x0000013024bc8b4c                   // movq	304(%rsp), %r15
+	LONG $0x06c28348                           // addq	$6, %rdx
+	LONG $0x6ef9c1c4; BYTE $0xcb               // vmovq	%r11, %xmm1
+	LONG $0x041c8d4d                           // leaq	(%r12,%rax), %r11
+	LONG $0x107aa1c4; WORD $0x9b24             // vmovss	(%rbx,%r11,4), %xmm4
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	WORD $0x0149; BYTE $0xc7                   // addq	%rax, %r15
+	LONG $0x7ef9c1c4; BYTE $0xcb               // vmovq	%xmm1, %r11
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x107aa1c4; WORD $0x9b0c             // vmovss	(%rbx,%r11,4), %xmm1
+	QUAD $0x00000128249c8b4c                   // movq	296(%rsp), %r11
+	LONG $0x2159e3c4; WORD $0x8324; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rax,4), %xmm4, %xmm4
+	LONG $0x2171a3c4; WORD $0xbb0c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%r15,4), %xmm1, %xmm1
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	LONG $0xcc16f0c5                           // vmovlhps	%xmm4, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x88 // vfmadd231ps	(%rax,%rcx,4){1to4}, %xmm1, %xmm15
+	WORD $0x3949; BYTE $0xd5                   // cmpq	%rdx, %r13
+	JLE  BB0_8
+	QUAD $0x0000013024848b48                   // movq	304(%rsp), %rax
+	QUAD $0x00000138248c8b48                   // movq	312(%rsp), %rcx
+	LONG $0x123c8d4d                           // leaq	(%r10,%rdx), %r15
+	LONG $0x107aa1c4; WORD $0xbb0c             // vmovss	(%rbx,%r15,4), %xmm1
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0x0148; BYTE $0xd1                   // addq	%rdx, %rcx
+	QUAD $0x0000013024848948                   // movq	%rax, 304(%rsp)
+	LONG $0x14048d49                           // leaq	(%r12,%rdx), %rax
+	WORD $0x014c; BYTE $0xf2                   // addq	%r14, %rdx
+	LONG $0x2410fac5; BYTE $0x83               // vmovss	(%rbx,%rax,4), %xmm4
+	QUAD $0x0000013024848b48                   // movq	304(%rsp), %rax
+	LONG $0x2159e3c4; WORD $0x9324; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rdx,4), %xmm4, %xmm4
+	LONG $0x2171e3c4; WORD $0x830c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rax,4), %xmm1, %xmm1
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	LONG $0xcc16f0c5                           // vmovlhps	%xmm4, %xmm1, %xmm1
+	LONG $0x18757262; WORD $0x3cb8; BYTE $0x88 // vfmadd231ps	(%rax,%rcx,4){1to4}, %xmm1, %xmm15
+
+BB0_8:
+	LONG $0xfb5900c5               // vmulps	%xmm3, %xmm15, %xmm15
+	QUAD $0x0000010024848b48       // movq	256(%rsp), %rax
+	QUAD $0x0000012024948b48       // movq	288(%rsp), %rdx
+	LONG $0x08fde162; WORD $0xe97e // vmovq	%xmm21, %rcx
+	WORD $0x0149; BYTE $0xcc       // addq	%rcx, %r12
+	WORD $0x0149; BYTE $0xce       // addq	%rcx, %r14
+	LONG $0x7c1178c5; WORD $0xf482 // vmovups	%xmm15, -12(%rdx,%rax,4)
+	LONG $0x08fde162; WORD $0xea7e // vmovq	%xmm21, %rdx
+	LONG $0x04c08348               // addq	$4, %rax
+	WORD $0x0149; BYTE $0xd2       // addq	%rdx, %r10
+	QUAD $0x000000b024948b48       // movq	176(%rsp), %rdx
+	QUAD $0x0000010024848948       // movq	%rax, 256(%rsp)
+	WORD $0x0149; BYTE $0xd1       // addq	%rdx, %r9
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+	WORD $0x0148; BYTE $0xd7       // addq	%rdx, %rdi
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	QUAD $0x000000c024948b48       // movq	192(%rsp), %rdx
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JL   BB0_14
+	WORD $0x8948; BYTE $0xd0       // movq	%rdx, %rax
+	LONG $0xfc528d48               // leaq	-4(%rdx), %rdx
+	LONG $0x24648b4c; BYTE $0x60   // movq	96(%rsp), %r12
+	QUAD $0x00000118249c8b4c       // movq	280(%rsp), %r11
+	LONG $0x02eac148               // shrq	$2, %rdx
+	LONG $0x03f88348               // cmpq	$3, %rax
+	LONG $0x08fdc162; WORD $0xee7e // vmovq	%xmm21, %r14
+	QUAD $0x00000004950c8d48       // leaq	4(,%rdx,4), %rcx
+	LONG $0x000004ba; BYTE $0x00   // movl	$4, %edx
+	LONG $0x08fdc162; WORD $0xf77e // vmovq	%xmm22, %r15
+	LONG $0xca4e0f48               // cmovle	%rdx, %rcx
+	QUAD $0x000000f8248c3948       // cmpq	%rcx, 248(%rsp)
+	JLE  BB0_157
+
+BB0_16:
+	QUAD $0x0000009024848b48     // movq	144(%rsp), %rax
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JGE  BB0_19
+	QUAD $0x000000f824b48b48     // movq	248(%rsp), %rsi
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	QUAD $0x0000011824a4894c     // movq	%r12, 280(%rsp)
+	WORD $0x894d; BYTE $0xf2     // movq	%r14, %r10
+	WORD $0x3948; BYTE $0xc6     // cmpq	%rax, %rsi
+	LONG $0xc64e0f48             // cmovle	%rsi, %rax
+	LONG $0xc5af0f4d             // imulq	%r13, %r8
+	LONG $0x6ef9e1c4; BYTE $0xc8 // vmovq	%rax, %xmm1
+	LONG $0x833c8d4a             // leaq	(%rbx,%r8,4), %rdi
+
+BB0_28:
+	LONG $0x0ffd8349             // cmpq	$15, %r13
+	JLE  BB0_81
+	LONG $0xe457d8c5             // vxorps	%xmm4, %xmm4, %xmm4
+	LONG $0x000010b8; BYTE $0x00 // movl	$16, %eax
+
+BB0_21:
+	QUAD $0xff837410487cd162 // vmovups	-64(%r11,%rax,4), %zmm6
+	QUAD $0xff8764b8484df262 // vfmadd231ps	-64(%rdi,%rax,4), %zmm6, %zmm4
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x394c; BYTE $0xe8 // cmpq	%r13, %rax
+	JLE  BB0_21
+	QUAD $0x000000a824948b48 // movq	168(%rsp), %rdx
+
+BB0_20:
+	LONG $0x48fdf362; WORD $0xe61b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm6
+	LONG $0xe458ccc5                           // vaddps	%ymm4, %ymm6, %ymm4
+	LONG $0x197de3c4; WORD $0x01e6             // vextractf128	$0x1, %ymm4, %xmm6
+	LONG $0xe458c8c5                           // vaddps	%xmm4, %xmm6, %xmm4
+	LONG $0x0479e3c4; WORD $0x4ef4             // vpermilps	$78, %xmm4, %xmm6
+	LONG $0xf458c8c5                           // vaddps	%xmm4, %xmm6, %xmm6
+	LONG $0xe628f8c5                           // vmovaps	%xmm6, %xmm4
+	LONG $0xf6c6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm6
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	WORD $0x3949; BYTE $0xd5                   // cmpq	%rdx, %r13
+	JLE  BB0_22
+	WORD $0x894c; BYTE $0xee                   // movq	%r13, %rsi
+	QUAD $0x0000013024948948                   // movq	%rdx, 304(%rsp)
+	WORD $0x2948; BYTE $0xd6                   // subq	%rdx, %rsi
+	LONG $0xff468d48                           // leaq	-1(%rsi), %rax
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_82
+	QUAD $0x0000013824848b48                   // movq	312(%rsp), %rax
+	QUAD $0x0000012824b48b4c                   // movq	296(%rsp), %r14
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x860c8d4d                           // leaq	(%r14,%rax,4), %r9
+	LONG $0x02048d4a                           // leaq	(%rdx,%r8), %rax
+	LONG $0x83248d4c                           // leaq	(%rbx,%rax,4), %r12
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0x04e8c148                           // shrq	$4, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	WORD $0x8949; BYTE $0xc6                   // movq	%rax, %r14
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_24:
+	LONG $0x487cd162; WORD $0x3410; BYTE $0x01 // vmovups	(%r9,%rax), %zmm6
+	LONG $0x484cd162; WORD $0x3459; BYTE $0x04 // vmulps	(%r12,%rax), %zmm6, %zmm6
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0xdec648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm11
+	LONG $0xd6c648c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm10
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm7
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0x585ac1c4; BYTE $0xe3               // vaddss	%xmm11, %xmm4, %xmm4
+	LONG $0xde1548c5                           // vunpckhps	%xmm6, %xmm6, %xmm11
+	LONG $0x585ac1c4; BYTE $0xe3               // vaddss	%xmm11, %xmm4, %xmm4
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0x287dd362; WORD $0xf219; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm10
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0x284d7362; WORD $0xd603; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm10
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0x284d7362; WORD $0xd603; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm10
+	LONG $0x487df362; WORD $0xf61b; BYTE $0x01 // vextractf32x8	$0x1, %zmm6, %ymm6
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0xd6c648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm10
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0xd61548c5                           // vunpckhps	%xmm6, %xmm6, %xmm10
+	LONG $0x585ac1c4; BYTE $0xe2               // vaddss	%xmm10, %xmm4, %xmm4
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0x287df362; WORD $0xf719; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm7
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm7
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm7
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	WORD $0x394c; BYTE $0xf0                   // cmpq	%r14, %rax
+	JNE  BB0_24
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	LONG $0x0fc6f640                           // testb	$15, %sil
+	JE   BB0_22
+
+BB0_23:
+	WORD $0x2948; BYTE $0xc6                   // subq	%rax, %rsi
+	LONG $0xff768d4c                           // leaq	-1(%rsi), %r14
+	LONG $0x06fe8349                           // cmpq	$6, %r14
+	JBE  BB0_26
+	QUAD $0x0000013024b48b4c                   // movq	304(%rsp), %r14
+	WORD $0x0149; BYTE $0xc6                   // addq	%rax, %r14
+	WORD $0x894c; BYTE $0xf0                   // movq	%r14, %rax
+	QUAD $0x0000013824b48b4c                   // movq	312(%rsp), %r14
+	LONG $0x30248d4e                           // leaq	(%rax,%r14), %r12
+	WORD $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+	LONG $0x3410fcc5; BYTE $0x83               // vmovups	(%rbx,%rax,4), %ymm6
+	QUAD $0x0000012824848b48                   // movq	296(%rsp), %rax
+	LONG $0x594ca1c4; WORD $0xa034             // vmulps	(%rax,%r12,4), %ymm6, %ymm6
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe683; BYTE $0x07                   // andl	$7, %esi
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xc6c648c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm8
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0x585ac1c4; BYTE $0xe0               // vaddss	%xmm8, %xmm4, %xmm4
+	LONG $0xc61548c5                           // vunpckhps	%xmm6, %xmm6, %xmm8
+	LONG $0x585ac1c4; BYTE $0xe0               // vaddss	%xmm8, %xmm4, %xmm4
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0x287df362; WORD $0xf719; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm7
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm7
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm7
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0xe758dac5                           // vaddss	%xmm7, %xmm4, %xmm4
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	JE   BB0_22
+
+BB0_26:
+	QUAD $0x0000013824b48b4c       // movq	312(%rsp), %r14
+	QUAD $0x00000128248c8b4c       // movq	296(%rsp), %r9
+	LONG $0x10048d49               // leaq	(%r8,%rdx), %rax
+	LONG $0x16348d49               // leaq	(%r14,%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0xb134 // vmovss	(%r9,%rsi,4), %xmm6
+	LONG $0xb949e2c4; WORD $0x8324 // vfmadd231ss	(%rbx,%rax,4), %xmm6, %xmm4
+	LONG $0x01428d48               // leaq	1(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5       // cmpq	%rax, %r13
+	JLE  BB0_22
+	LONG $0x00348d4a               // leaq	(%rax,%r8), %rsi
+	WORD $0x014c; BYTE $0xf0       // addq	%r14, %rax
+	LONG $0x3410fac5; BYTE $0xb3   // vmovss	(%rbx,%rsi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8124 // vfmadd231ss	(%r9,%rax,4), %xmm6, %xmm4
+	LONG $0x02428d48               // leaq	2(%rdx), %rax
+	WORD $0x394c; BYTE $0xe8       // cmpq	%r13, %rax
+	JGE  BB0_22
+	LONG $0x30348d4a               // leaq	(%rax,%r14), %rsi
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x107ac1c4; WORD $0xb134 // vmovss	(%r9,%rsi,4), %xmm6
+	LONG $0xb949e2c4; WORD $0x8324 // vfmadd231ss	(%rbx,%rax,4), %xmm6, %xmm4
+	LONG $0x03428d48               // leaq	3(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5       // cmpq	%rax, %r13
+	JLE  BB0_22
+	LONG $0x06348d49               // leaq	(%r14,%rax), %rsi
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x107ac1c4; WORD $0xb134 // vmovss	(%r9,%rsi,4), %xmm6
+	LONG $0xb949e2c4; WORD $0x8324 // vfmadd231ss	(%rbx,%rax,4), %xmm6, %xmm4
+	LONG $0x04428d48               // leaq	4(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5       // cmpq	%rax, %r13
+	JLE  BB0_22
+	LONG $0x00348d49               // leaq	(%r8,%rax), %rsi
+	WORD $0x014c; BYTE $0xf0       // addq	%r14, %rax
+	LONG $0x3410fac5; BYTE $0xb3   // vmovss	(%rbx,%rsi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8124 // vfmadd231ss	(%r9,%rax,4), %xmm6, %xmm4
+	LONG $0x05428d48               // leaq	5(%rdx), %rax
+	WORD $0x3949; BYTE $0xc5       // cmpq	%rax, %r13
+	JLE  BB0_22
+	LONG $0x00348d49               // leaq	(%r8,%rax), %rsi
+	LONG $0x06c28348               // addq	$6, %rdx
+	WORD $0x014c; BYTE $0xf0       // addq	%r14, %rax
+	LONG $0x3410fac5; BYTE $0xb3   // vmovss	(%rbx,%rsi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8124 // vfmadd231ss	(%r9,%rax,4), %xmm6, %xmm4
+	WORD $0x394c; BYTE $0xea       // cmpq	%r13, %rdx
+	JGE  BB0_22
+	LONG $0x32048d4a               // leaq	(%rdx,%r14), %rax
+	WORD $0x014c; BYTE $0xc2       // addq	%r8, %rdx
+	LONG $0x107ac1c4; WORD $0x8134 // vmovss	(%r9,%rax,4), %xmm6
+	LONG $0xb949e2c4; WORD $0x9324 // vfmadd231ss	(%rbx,%rdx,4), %xmm6, %xmm4
+
+BB0_22:
+	LONG $0xe459eac5             // vmulss	%xmm4, %xmm2, %xmm4
+	QUAD $0x0000012024848b48     // movq	288(%rsp), %rax
+	WORD $0x014d; BYTE $0xe8     // addq	%r13, %r8
+	WORD $0x014c; BYTE $0xd7     // addq	%r10, %rdi
+	LONG $0x2411fac5; BYTE $0x88 // vmovss	%xmm4, (%rax,%rcx,4)
+	LONG $0x01c18348             // addq	$1, %rcx
+	LONG $0x7ef9e1c4; BYTE $0xc8 // vmovq	%xmm1, %rax
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JL   BB0_28
+	QUAD $0x0000011824a48b4c     // movq	280(%rsp), %r12
+	WORD $0x894d; BYTE $0xd6     // movq	%r10, %r14
+	QUAD $0x000000f8248c3948     // cmpq	%rcx, 248(%rsp)
+	JLE  BB0_33
+
+BB0_19:
+	QUAD         $0x000000f824848b48     // movq	248(%rsp), %rax
+	LONG         $0x000001be; BYTE $0x00 // movl	$1, %esi
+	WORD         $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	WORD         $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+	WORD         $0x2948; BYTE $0xca     // subq	%rcx, %rdx
+	WORD         $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	LONG         $0xf24f0f48             // cmovg	%rdx, %rsi
+	LONG         $0x01ea8348             // subq	$1, %rdx
+	LONG         $0x0efa8348             // cmpq	$14, %rdx
+	JBE          BB0_83
+	WORD         $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JLE          BB0_83
+	QUAD         $0x000000d024848b48     // movq	208(%rsp), %rax
+	WORD         $0x8948; BYTE $0xf7     // movq	%rsi, %rdi
+	VBROADCASTSS CPI0_3<>(SB), Z4        // vbroadcastss	.LCPI0_3(%rip), %zmm4
+	LONG         $0x04efc148             // shrq	$4, %rdi
+	LONG         $0x01148d48             // leaq	(%rcx,%rax), %rdx
+	QUAD         $0x000000b824848b48     // movq	184(%rsp), %rax
+	LONG         $0x06e7c148             // salq	$6, %rdi
+	LONG         $0x90148d48             // leaq	(%rax,%rdx,4), %rdx
+	WORD         $0x0148; BYTE $0xd7     // addq	%rdx, %rdi
+
+BB0_31:
+	LONG $0x487cf162; WORD $0x2211 // vmovups	%zmm4, (%rdx)
+	LONG $0x40c28348               // addq	$64, %rdx
+	WORD $0x3948; BYTE $0xfa       // cmpq	%rdi, %rdx
+	JNE  BB0_31
+	WORD $0x8948; BYTE $0xf2       // movq	%rsi, %rdx
+	LONG $0xf0e28348               // andq	$-16, %rdx
+	WORD $0x0148; BYTE $0xd1       // addq	%rdx, %rcx
+	LONG $0x0fc6f640               // testb	$15, %sil
+	JE   BB0_33
+
+BB0_30:
+	WORD         $0x2948; BYTE $0xd6     // subq	%rdx, %rsi
+	LONG         $0xff7e8d48             // leaq	-1(%rsi), %rdi
+	LONG         $0x06ff8348             // cmpq	$6, %rdi
+	JBE          BB0_35
+	QUAD         $0x000000d024848b48     // movq	208(%rsp), %rax
+	WORD         $0x014c; BYTE $0xc2     // addq	%r8, %rdx
+	VBROADCASTSS CPI0_3<>(SB), Y4        // vbroadcastss	.LCPI0_3(%rip), %ymm4
+	WORD         $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	QUAD         $0x000000b824848b48     // movq	184(%rsp), %rax
+	LONG         $0x2411fcc5; BYTE $0x90 // vmovups	%ymm4, (%rax,%rdx,4)
+	WORD         $0x8948; BYTE $0xf2     // movq	%rsi, %rdx
+	LONG         $0xf8e28348             // andq	$-8, %rdx
+	WORD         $0x0148; BYTE $0xd1     // addq	%rdx, %rcx
+	WORD         $0xe683; BYTE $0x07     // andl	$7, %esi
+	JE           BB0_33
+
+BB0_35:
+	QUAD   $0x000000d024848b48     // movq	208(%rsp), %rax
+	QUAD   $0x000000b824b48b48     // movq	184(%rsp), %rsi
+	VMOVSS CPI0_3<>(SB), X4        // vmovss	.LCPI0_3(%rip), %xmm4
+	QUAD   $0x000000f824bc8b48     // movq	248(%rsp), %rdi
+	LONG   $0x08148d48             // leaq	(%rax,%rcx), %rdx
+	LONG   $0x2411fac5; BYTE $0x96 // vmovss	%xmm4, (%rsi,%rdx,4)
+	LONG   $0x01518d48             // leaq	1(%rcx), %rdx
+	WORD   $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE    BB0_33
+	WORD   $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	LONG   $0x2411fac5; BYTE $0x96 // vmovss	%xmm4, (%rsi,%rdx,4)
+	LONG   $0x02518d48             // leaq	2(%rcx), %rdx
+	WORD   $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE    BB0_33
+	WORD   $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	LONG   $0x2411fac5; BYTE $0x96 // vmovss	%xmm4, (%rsi,%rdx,4)
+	LONG   $0x03518d48             // leaq	3(%rcx), %rdx
+	WORD   $0x3948; BYTE $0xfa     // cmpq	%rdi, %rdx
+	JGE    BB0_33
+	WORD   $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	LONG   $0x2411fac5; BYTE $0x96 // vmovss	%xmm4, (%rsi,%rdx,4)
+	LONG   $0x04518d48             // leaq	4(%rcx), %rdx
+	WORD   $0x3948; BYTE $0xd7     // cmpq	%rdx, %rdi
+	JLE    BB0_33
+	WORD   $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	LONG   $0x2411fac5; BYTE $0x96 // vmovss	%xmm4, (%rsi,%rdx,4)
+	LONG   $0x05518d48             // leaq	5(%rcx), %rdx
+	WORD   $0x3948; BYTE $0xfa     // cmpq	%rdi, %rdx
+	JGE    BB0_33
+	WORD   $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	LONG   $0x06c18348             // addq	$6, %rcx
+	LONG   $0x2411fac5; BYTE $0x96 // vmovss	%xmm4, (%rsi,%rdx,4)
+	WORD   $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JGE    BB0_33
+	WORD   $0x0148; BYTE $0xc1     // addq	%rax, %rcx
+	LONG   $0x2411fac5; BYTE $0x8e // vmovss	%xmm4, (%rsi,%rcx,4)
+
+BB0_157:
+	QUAD $0x0000012024848b48 // movq	288(%rsp), %rax
+	LONG $0x10107ac5         // vmovss	(%rax), %xmm10
+
+BB0_29:
+	QUAD $0x0000012024848b48 // movq	288(%rsp), %rax
+	LONG $0x04508d48         // leaq	4(%rax), %rdx
+	QUAD $0x0000008024848b48 // movq	128(%rsp), %rax
+
+BB0_38:
+	LONG         $0x0a10fac5                     // vmovss	(%rdx), %xmm1
+	LONG         $0x04c28348                     // addq	$4, %rdx
+	LONG         $0x5f7241c4; BYTE $0xd2         // vmaxss	%xmm10, %xmm1, %xmm10
+	WORD         $0x3948; BYTE $0xc2             // cmpq	%rax, %rdx
+	JNE          BB0_38
+	QUAD         $0x000000f824bc8348; BYTE $0x0f // cmpq	$15, 248(%rsp)
+	LONG         $0x487dc262; WORD $0xea18       // vbroadcastss	%xmm10, %zmm21
+	JLE          BB0_85
+	LONG         $0x24548b48; BYTE $0x68         // movq	104(%rsp), %rdx
+	LONG         $0xed57d0c5                     // vxorps	%xmm5, %xmm5, %xmm5
+	LONG         $0x00007fbe; BYTE $0x00         // movl	$127, %esi
+	QUAD         $0x000000d024848b48             // movq	208(%rsp), %rax
+	VBROADCASTSS CPI0_6<>(SB), Z20               // vbroadcastss	.LCPI0_6(%rip), %zmm20
+	LONG         $0x487df262; WORD $0xfe7c       // vpbroadcastd	%esi, %zmm7
+	VBROADCASTSS CPI0_8<>(SB), Z19               // vbroadcastss	.LCPI0_8(%rip), %zmm19
+	LONG         $0x487c7162; WORD $0xc528       // vmovaps	%zmm5, %zmm8
+	VBROADCASTSS CPI0_10<>(SB), Z18              // vbroadcastss	.LCPI0_10(%rip), %zmm18
+	LONG         $0xf0e28348                     // andq	$-16, %rdx
+	VBROADCASTSS CPI0_12<>(SB), Z17              // vbroadcastss	.LCPI0_12(%rip), %zmm17
+	VBROADCASTSS CPI0_14<>(SB), Z16              // vbroadcastss	.LCPI0_14(%rip), %zmm16
+	WORD         $0x0148; BYTE $0xc2             // addq	%rax, %rdx
+	QUAD         $0x000000b824848b48             // movq	184(%rsp), %rax
+	VBROADCASTSS CPI0_16<>(SB), Z15              // vbroadcastss	.LCPI0_16(%rip), %zmm15
+	VBROADCASTSS CPI0_18<>(SB), Z14              // vbroadcastss	.LCPI0_18(%rip), %zmm14
+	VBROADCASTSS CPI0_20<>(SB), Z13              // vbroadcastss	.LCPI0_20(%rip), %zmm13
+	LONG         $0x904c8d48; BYTE $0x40         // leaq	64(%rax,%rdx,4), %rcx
+	VBROADCASTSS CPI0_22<>(SB), Z11              // vbroadcastss	.LCPI0_22(%rip), %zmm11
+	QUAD         $0x0000012024948b48             // movq	288(%rsp), %rdx
+	VBROADCASTSS CPI0_24<>(SB), Z9               // vbroadcastss	.LCPI0_24(%rip), %zmm9
+	VBROADCASTSS CPI0_26<>(SB), Z6               // vbroadcastss	.LCPI0_26(%rip), %zmm6
+	VBROADCASTSS CPI0_0<>(SB), Z12               // vbroadcastss	.LCPI0_0(%rip), %zmm12
+
+BB0_39:
+	LONG $0x487cf162; WORD $0x2210             // vmovups	(%rdx), %zmm4
+	LONG $0x487cd162; WORD $0xcf28             // vmovaps	%zmm15, %zmm1
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x485cb162; WORD $0xe55c             // vsubps	%zmm21, %zmm4, %zmm4
+	LONG $0x485ca162; WORD $0xf259             // vmulps	%zmm18, %zmm4, %zmm22
+	LONG $0x485cb162; WORD $0xd4c2; BYTE $0x1e // vcmpps	$30, %zmm20, %zmm4, %k2
+	LONG $0x485cb162; WORD $0xcbc2; BYTE $0x11 // vcmpps	$17, %zmm19, %zmm4, %k1
+	LONG $0x487da362; WORD $0xf608; BYTE $0x08 // vrndscaleps	$8, %zmm22, %zmm22
+	LONG $0x404db262; WORD $0xe1bc             // vfnmadd231ps	%zmm17, %zmm22, %zmm4
+	LONG $0x404db262; WORD $0xe0bc             // vfnmadd231ps	%zmm16, %zmm22, %zmm4
+	LONG $0x487da162; WORD $0xf65b             // vcvtps2dq	%zmm22, %zmm22
+	LONG $0x404de162; WORD $0xf7fe             // vpaddd	%zmm7, %zmm22, %zmm22
+	LONG $0x404db162; WORD $0xf672; BYTE $0x17 // vpslld	$23, %zmm22, %zmm22
+	LONG $0x480df262; WORD $0xcc98             // vfmadd132ps	%zmm4, %zmm14, %zmm1
+	LONG $0x4815f262; WORD $0xcc98             // vfmadd132ps	%zmm4, %zmm13, %zmm1
+	LONG $0x4825f262; WORD $0xcc98             // vfmadd132ps	%zmm4, %zmm11, %zmm1
+	LONG $0x4835f262; WORD $0xcc98             // vfmadd132ps	%zmm4, %zmm9, %zmm1
+	LONG $0x484df262; WORD $0xcc98             // vfmadd132ps	%zmm4, %zmm6, %zmm1
+	LONG $0x484df262; WORD $0xcc98             // vfmadd132ps	%zmm4, %zmm6, %zmm1
+	LONG $0x4874b162; WORD $0xce59             // vmulps	%zmm22, %zmm1, %zmm1
+	LONG $0x4a7cd162; WORD $0xcc28             // vmovaps	%zmm12, %zmm1{%k2}
+	LONG $0x497cd162; WORD $0xc828             // vmovaps	%zmm8, %zmm1{%k1}
+	LONG $0x487cf162; WORD $0x4a11; BYTE $0xff // vmovups	%zmm1, -64(%rdx)
+	LONG $0x4854f162; WORD $0xe958             // vaddps	%zmm1, %zmm5, %zmm5
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JNE  BB0_39
+	LONG $0x24548b48; BYTE $0x70               // movq	112(%rsp), %rdx
+
+BB0_17:
+	LONG         $0x48fdf362; WORD $0xec1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm4
+	QUAD         $0x000000f824848b48                   // movq	248(%rsp), %rax
+	LONG         $0xe558dcc5                           // vaddps	%ymm5, %ymm4, %ymm4
+	LONG         $0x197de3c4; WORD $0x01e5             // vextractf128	$0x1, %ymm4, %xmm5
+	LONG         $0xec58d0c5                           // vaddps	%xmm4, %xmm5, %xmm5
+	LONG         $0x0479e3c4; WORD $0x4ee5             // vpermilps	$78, %xmm5, %xmm4
+	LONG         $0xe558d8c5                           // vaddps	%xmm5, %xmm4, %xmm4
+	LONG         $0xec28f8c5                           // vmovaps	%xmm4, %xmm5
+	LONG         $0xe4c6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm4
+	LONG         $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	WORD         $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JLE          BB0_40
+	WORD         $0x2948; BYTE $0xd0                   // subq	%rdx, %rax
+	WORD         $0x8949; BYTE $0xd1                   // movq	%rdx, %r9
+	LONG         $0xff488d48                           // leaq	-1(%rax), %rcx
+	WORD         $0x8949; BYTE $0xc0                   // movq	%rax, %r8
+	LONG         $0x0ef98348                           // cmpq	$14, %rcx
+	JBE          BB0_86
+	QUAD         $0x000000d024848b48                   // movq	208(%rsp), %rax
+	WORD         $0x894c; BYTE $0xc6                   // movq	%r8, %rsi
+	LONG         $0x0003ffbf; BYTE $0x00               // movl	$1023, %edi
+	VBROADCASTSS CPI0_0<>(SB), Z12                     // vbroadcastss	.LCPI0_0(%rip), %zmm12
+	LONG         $0x04eec148                           // shrq	$4, %rsi
+	LONG         $0x487d4262; WORD $0xfa18             // vbroadcastss	%xmm10, %zmm31
+	VBROADCASTSD CPI0_30<>(SB), Z30                    // vbroadcastsd	.LCPI0_30(%rip), %zmm30
+	VBROADCASTSD CPI0_90<>(SB), Z29                    // vbroadcastsd	.LCPI0_90(%rip), %zmm29
+	LONG         $0x020c8d48                           // leaq	(%rdx,%rax), %rcx
+	LONG         $0x06e6c148                           // salq	$6, %rsi
+	QUAD         $0x000000b824848b48                   // movq	184(%rsp), %rax
+	VBROADCASTSD CPI0_89<>(SB), Z28                    // vbroadcastsd	.LCPI0_89(%rip), %zmm28
+	VBROADCASTSD CPI0_36<>(SB), Z27                    // vbroadcastsd	.LCPI0_36(%rip), %zmm27
+	LONG         $0x48fd7262; WORD $0xef7c             // vpbroadcastq	%rdi, %zmm13
+	VBROADCASTSD CPI0_38<>(SB), Z26                    // vbroadcastsd	.LCPI0_38(%rip), %zmm26
+	QUAD         $0x000130249411fac5; BYTE $0x00       // vmovss	%xmm2, 304(%rsp)
+	VBROADCASTSD CPI0_40<>(SB), Z25                    // vbroadcastsd	.LCPI0_40(%rip), %zmm25
+	LONG         $0x880c8d48                           // leaq	(%rax,%rcx,4), %rcx
+	VBROADCASTSD CPI0_42<>(SB), Z24                    // vbroadcastsd	.LCPI0_42(%rip), %zmm24
+	QUAD         $0x0001182494117ac5; BYTE $0x00       // vmovss	%xmm10, 280(%rsp)
+	VBROADCASTSD CPI0_44<>(SB), Z23                    // vbroadcastsd	.LCPI0_44(%rip), %zmm23
+	WORD         $0x0148; BYTE $0xce                   // addq	%rcx, %rsi
+	VBROADCASTSD CPI0_46<>(SB), Z22                    // vbroadcastsd	.LCPI0_46(%rip), %zmm22
+	VBROADCASTSD CPI0_48<>(SB), Z21                    // vbroadcastsd	.LCPI0_48(%rip), %zmm21
+	VBROADCASTSD CPI0_50<>(SB), Z20                    // vbroadcastsd	.LCPI0_50(%rip), %zmm20
+	VBROADCASTSD CPI0_52<>(SB), Z19                    // vbroadcastsd	.LCPI0_52(%rip), %zmm19
+	VBROADCASTSD CPI0_54<>(SB), Z18                    // vbroadcastsd	.LCPI0_54(%rip), %zmm18
+	VBROADCASTSD CPI0_56<>(SB), Z17                    // vbroadcastsd	.LCPI0_56(%rip), %zmm17
+	VBROADCASTSD CPI0_58<>(SB), Z16                    // vbroadcastsd	.LCPI0_58(%rip), %zmm16
+	VBROADCASTSD CPI0_60<>(SB), Z15                    // vbroadcastsd	.LCPI0_60(%rip), %zmm15
+	VBROADCASTSD CPI0_62<>(SB), Z11                    // vbroadcastsd	.LCPI0_62(%rip), %zmm11
+	VBROADCASTSS CPI0_65<>(SB), Z1                     // vbroadcastss	.LCPI0_65(%rip), %zmm1
+	VBROADCASTSS CPI0_67<>(SB), Z14                    // vbroadcastss	.LCPI0_67(%rip), %zmm14
+
+BB0_42:
+	LONG $0x487cf162; WORD $0x1110             // vmovups	(%rcx), %zmm2
+	LONG $0x48fd9162; WORD $0xf528             // vmovapd	%zmm29, %zmm6
+	LONG $0x48fd1162; WORD $0xc528             // vmovapd	%zmm29, %zmm8
+	LONG $0x40c18348                           // addq	$64, %rcx
+	LONG $0x486c1162; WORD $0xd75c             // vsubps	%zmm31, %zmm2, %zmm10
+	LONG $0x487c5162; WORD $0xca5a             // vcvtps2pd	%ymm10, %zmm9
+	LONG $0x48b59162; WORD $0xd659             // vmulpd	%zmm30, %zmm9, %zmm2
+	LONG $0x487d7362; WORD $0xd71b; BYTE $0x01 // vextractf32x8	$0x1, %zmm10, %ymm7
+	LONG $0x487cf162; WORD $0xff5a             // vcvtps2pd	%ymm7, %zmm7
+	LONG $0x482cd162; WORD $0xcec2; BYTE $0x0a // vcmpps	$10, %zmm14, %zmm10, %k1
+	LONG $0x480cd162; WORD $0xd2c2; BYTE $0x01 // vcmpps	$1, %zmm10, %zmm14, %k2
+	LONG $0x492cf162; WORD $0xc9c2; BYTE $0x05 // vcmpps	$5, %zmm1, %zmm10, %k1{%k1}
+	LONG $0x48ed9362; WORD $0xf425; BYTE $0xf8 // vpternlogq	$248, %zmm28, %zmm2, %zmm6
+	LONG $0x48edf162; WORD $0xf658             // vaddpd	%zmm6, %zmm2, %zmm6
+	LONG $0x48c59162; WORD $0xd659             // vmulpd	%zmm30, %zmm7, %zmm2
+	LONG $0x48fdf362; WORD $0xf609; BYTE $0x03 // vrndscalepd	$3, %zmm6, %zmm6
+	LONG $0x48ed1362; WORD $0xc425; BYTE $0xf8 // vpternlogq	$248, %zmm28, %zmm2, %zmm8
+	LONG $0x48ed5162; WORD $0xc058             // vaddpd	%zmm8, %zmm2, %zmm8
+	LONG $0x48fd5362; WORD $0xc009; BYTE $0x03 // vrndscalepd	$3, %zmm8, %zmm8
+	LONG $0x48cd1262; WORD $0xcbbc             // vfnmadd231pd	%zmm27, %zmm6, %zmm9
+	LONG $0x48cd1262; WORD $0xcabc             // vfnmadd231pd	%zmm26, %zmm6, %zmm9
+	LONG $0x48fdf162; WORD $0xf67a             // vcvttpd2qq	%zmm6, %zmm6
+	LONG $0x48cdd162; WORD $0xf5d4             // vpaddq	%zmm13, %zmm6, %zmm6
+	LONG $0x48bd9262; WORD $0xfbbc             // vfnmadd231pd	%zmm27, %zmm8, %zmm7
+	LONG $0x48cdf162; WORD $0xf673; BYTE $0x34 // vpsllq	$52, %zmm6, %zmm6
+	LONG $0x48fdd162; WORD $0xe128             // vmovapd	%zmm9, %zmm4
+	LONG $0x48bd9262; WORD $0xfabc             // vfnmadd231pd	%zmm26, %zmm8, %zmm7
+	LONG $0x40bd9262; WORD $0xe198             // vfmadd132pd	%zmm25, %zmm24, %zmm4
+	LONG $0x48fd5162; WORD $0xc07a             // vcvttpd2qq	%zmm8, %zmm8
+	LONG $0x48bd5162; WORD $0xc5d4             // vpaddq	%zmm13, %zmm8, %zmm8
+	LONG $0x48bdd162; WORD $0xf073; BYTE $0x34 // vpsllq	$52, %zmm8, %zmm8
+	LONG $0x48fdf162; WORD $0xd728             // vmovapd	%zmm7, %zmm2
+	LONG $0x40c5d262; WORD $0xe198             // vfmadd132pd	%zmm9, %zmm23, %zmm4
+	LONG $0x40bd9262; WORD $0xd198             // vfmadd132pd	%zmm25, %zmm24, %zmm2
+	LONG $0x40cdd262; WORD $0xe198             // vfmadd132pd	%zmm9, %zmm22, %zmm4
+	LONG $0x40c5f262; WORD $0xd798             // vfmadd132pd	%zmm7, %zmm23, %zmm2
+	LONG $0x40d5d262; WORD $0xe198             // vfmadd132pd	%zmm9, %zmm21, %zmm4
+	LONG $0x40cdf262; WORD $0xd798             // vfmadd132pd	%zmm7, %zmm22, %zmm2
+	LONG $0x40ddd262; WORD $0xe198             // vfmadd132pd	%zmm9, %zmm20, %zmm4
+	LONG $0x40d5f262; WORD $0xd798             // vfmadd132pd	%zmm7, %zmm21, %zmm2
+	LONG $0x40e5d262; WORD $0xe198             // vfmadd132pd	%zmm9, %zmm19, %zmm4
+	LONG $0x40ddf262; WORD $0xd798             // vfmadd132pd	%zmm7, %zmm20, %zmm2
+	LONG $0x40edd262; WORD $0xe198             // vfmadd132pd	%zmm9, %zmm18, %zmm4
+	LONG $0x40e5f262; WORD $0xd798             // vfmadd132pd	%zmm7, %zmm19, %zmm2
+	LONG $0x40f5d262; WORD $0xe198             // vfmadd132pd	%zmm9, %zmm17, %zmm4
+	LONG $0x40edf262; WORD $0xd798             // vfmadd132pd	%zmm7, %zmm18, %zmm2
+	LONG $0x40fdd262; WORD $0xe198             // vfmadd132pd	%zmm9, %zmm16, %zmm4
+	LONG $0x40f5f262; WORD $0xd798             // vfmadd132pd	%zmm7, %zmm17, %zmm2
+	LONG $0x4885d262; WORD $0xe198             // vfmadd132pd	%zmm9, %zmm15, %zmm4
+	LONG $0x40fdf262; WORD $0xd798             // vfmadd132pd	%zmm7, %zmm16, %zmm2
+	LONG $0x48a5d262; WORD $0xe198             // vfmadd132pd	%zmm9, %zmm11, %zmm4
+	LONG $0x4885f262; WORD $0xd798             // vfmadd132pd	%zmm7, %zmm15, %zmm2
+	LONG $0x48a5d262; WORD $0xe198             // vfmadd132pd	%zmm9, %zmm11, %zmm4
+	LONG $0x48a5f262; WORD $0xd798             // vfmadd132pd	%zmm7, %zmm11, %zmm2
+	LONG $0x48ddf162; WORD $0xe659             // vmulpd	%zmm6, %zmm4, %zmm4
+	LONG $0x48a5f262; WORD $0xd798             // vfmadd132pd	%zmm7, %zmm11, %zmm2
+	LONG $0x48fdf162; WORD $0xe45a             // vcvtpd2ps	%zmm4, %ymm4
+	LONG $0x48edd162; WORD $0xd059             // vmulpd	%zmm8, %zmm2, %zmm2
+	LONG $0x48fdf162; WORD $0xd25a             // vcvtpd2ps	%zmm2, %ymm2
+	LONG $0x48ddf362; WORD $0xe21a; BYTE $0x01 // vinsertf64x4	$0x1, %ymm2, %zmm4, %zmm4
+	LONG $0xca7cd162; WORD $0xd428             // vmovaps	%zmm12, %zmm2{%k2}{z}
+	LONG $0x497cf162; WORD $0xd428             // vmovaps	%zmm4, %zmm2{%k1}
+	LONG $0x287df362; WORD $0xd619; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm6
+	LONG $0xfa58d2c5                           // vaddss	%xmm2, %xmm5, %xmm7
+	LONG $0xeac6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm5
+	LONG $0x487cf162; WORD $0x5111; BYTE $0xff // vmovups	%zmm2, -64(%rcx)
+	LONG $0x286df362; WORD $0xe203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm4
+	LONG $0xff58d2c5                           // vaddss	%xmm7, %xmm5, %xmm7
+	LONG $0xea15e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm5
+	LONG $0xff58d2c5                           // vaddss	%xmm7, %xmm5, %xmm7
+	LONG $0xeac6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm5
+	LONG $0xef58d2c5                           // vaddss	%xmm7, %xmm5, %xmm5
+	LONG $0xed58cac5                           // vaddss	%xmm5, %xmm6, %xmm5
+	LONG $0x286df362; WORD $0xf203; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm6
+	LONG $0xf558cac5                           // vaddss	%xmm5, %xmm6, %xmm6
+	LONG $0x286df362; WORD $0xea03; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm5
+	LONG $0x487df362; WORD $0xd21b; BYTE $0x01 // vextractf32x8	$0x1, %zmm2, %ymm2
+	LONG $0xee58d2c5                           // vaddss	%xmm6, %xmm5, %xmm5
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0x287df362; WORD $0xd519; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm5
+	LONG $0xf458eac5                           // vaddss	%xmm4, %xmm2, %xmm6
+	LONG $0xe2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm4
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xf215e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm6
+	LONG $0xf458cac5                           // vaddss	%xmm4, %xmm6, %xmm6
+	LONG $0xe2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm4
+	LONG $0xe658dac5                           // vaddss	%xmm6, %xmm4, %xmm4
+	LONG $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG $0x286df362; WORD $0xe203; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm4
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0x286df362; WORD $0xea03; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm5
+	LONG $0x286df362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm2
+	LONG $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG $0xea58d2c5                           // vaddss	%xmm2, %xmm5, %xmm5
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JNE  BB0_42
+	QUAD $0x000130249410fac5; BYTE $0x00       // vmovss	304(%rsp), %xmm2
+	WORD $0x894c; BYTE $0xc7                   // movq	%r8, %rdi
+	QUAD $0x0001182494107ac5; BYTE $0x00       // vmovss	280(%rsp), %xmm10
+	LONG $0xf0e78348                           // andq	$-16, %rdi
+	WORD $0x0148; BYTE $0xfa                   // addq	%rdi, %rdx
+	LONG $0x0fc0f641                           // testb	$15, %r8b
+	JE   BB0_43
+
+BB0_41:
+	WORD         $0x894c; BYTE $0xc6                   // movq	%r8, %rsi
+	WORD         $0x2948; BYTE $0xfe                   // subq	%rdi, %rsi
+	LONG         $0xff4e8d48                           // leaq	-1(%rsi), %rcx
+	LONG         $0x06f98348                           // cmpq	$6, %rcx
+	JBE          BB0_44
+	QUAD         $0x000000d024848b48                   // movq	208(%rsp), %rax
+	LONG         $0x187dc2c4; BYTE $0xe2               // vbroadcastss	%xmm10, %ymm4
+	VBROADCASTSD CPI0_30<>(SB), Y9                     // vbroadcastsd	.LCPI0_30(%rip), %ymm9
+	VBROADCASTSD CPI0_89<>(SB), Y12                    // vbroadcastsd	.LCPI0_89(%rip), %ymm12
+	LONG         $0x010c8d49                           // leaq	(%r9,%rax), %rcx
+	QUAD         $0x000000b824848b48                   // movq	184(%rsp), %rax
+	WORD         $0x0148; BYTE $0xf9                   // addq	%rdi, %rcx
+	LONG         $0x0003ffbf; BYTE $0x00               // movl	$1023, %edi
+	LONG         $0x880c8d48                           // leaq	(%rax,%rcx,4), %rcx
+	LONG         $0x3110fcc5                           // vmovups	(%rcx), %ymm6
+	LONG         $0xc45c4cc5                           // vsubps	%ymm4, %ymm6, %ymm8
+	VBROADCASTSD CPI0_90<>(SB), Y4                     // vbroadcastsd	.LCPI0_90(%rip), %ymm4
+	LONG         $0xec287dc5                           // vmovapd	%ymm4, %ymm13
+	LONG         $0x5a7cc1c4; BYTE $0xf0               // vcvtps2pd	%xmm8, %ymm6
+	LONG         $0x594d41c4; BYTE $0xd9               // vmulpd	%ymm9, %ymm6, %ymm11
+	LONG         $0x197d63c4; WORD $0x01c7             // vextractf128	$0x1, %ymm8, %xmm7
+	LONG         $0xff5afcc5                           // vcvtps2pd	%xmm7, %ymm7
+	LONG         $0x594541c4; BYTE $0xc9               // vmulpd	%ymm9, %ymm7, %ymm9
+	LONG         $0x28a55362; WORD $0xec25; BYTE $0xf8 // vpternlogq	$248, %ymm12, %ymm11, %ymm13
+	LONG         $0x582541c4; BYTE $0xdd               // vaddpd	%ymm13, %ymm11, %ymm11
+	LONG         $0x28b5d362; WORD $0xe425; BYTE $0xf8 // vpternlogq	$248, %ymm12, %ymm9, %ymm4
+	VBROADCASTSD CPI0_38<>(SB), Y12                    // vbroadcastsd	.LCPI0_38(%rip), %ymm12
+	VBROADCASTSD CPI0_42<>(SB), Y13                    // vbroadcastsd	.LCPI0_42(%rip), %ymm13
+	LONG         $0xcc5835c5                           // vaddpd	%ymm4, %ymm9, %ymm9
+	VBROADCASTSD CPI0_36<>(SB), Y4                     // vbroadcastsd	.LCPI0_36(%rip), %ymm4
+	LONG         $0x28fd5362; WORD $0xdb09; BYTE $0x03 // vrndscalepd	$3, %ymm11, %ymm11
+	LONG         $0x28fd5362; WORD $0xc909; BYTE $0x03 // vrndscalepd	$3, %ymm9, %ymm9
+	LONG         $0xbca5e2c4; BYTE $0xf4               // vfnmadd231pd	%ymm4, %ymm11, %ymm6
+	LONG         $0x9cc5c2c4; BYTE $0xe1               // vfnmadd132pd	%ymm9, %ymm7, %ymm4
+	LONG         $0xbca5c2c4; BYTE $0xf4               // vfnmadd231pd	%ymm12, %ymm11, %ymm6
+	LONG         $0x9cdd42c4; BYTE $0xe1               // vfnmadd132pd	%ymm9, %ymm4, %ymm12
+	VBROADCASTSD CPI0_40<>(SB), Y4                     // vbroadcastsd	.LCPI0_40(%rip), %ymm4
+	LONG         $0xfe28fdc5                           // vmovapd	%ymm6, %ymm7
+	LONG         $0x9895e2c4; BYTE $0xfc               // vfmadd132pd	%ymm4, %ymm13, %ymm7
+	LONG         $0x9895c2c4; BYTE $0xe4               // vfmadd132pd	%ymm12, %ymm13, %ymm4
+	VBROADCASTSD CPI0_44<>(SB), Y13                    // vbroadcastsd	.LCPI0_44(%rip), %ymm13
+	LONG         $0x9895e2c4; BYTE $0xfe               // vfmadd132pd	%ymm6, %ymm13, %ymm7
+	LONG         $0x9895c2c4; BYTE $0xe4               // vfmadd132pd	%ymm12, %ymm13, %ymm4
+	VBROADCASTSD CPI0_46<>(SB), Y13                    // vbroadcastsd	.LCPI0_46(%rip), %ymm13
+	LONG         $0x9895e2c4; BYTE $0xfe               // vfmadd132pd	%ymm6, %ymm13, %ymm7
+	LONG         $0x9895c2c4; BYTE $0xe4               // vfmadd132pd	%ymm12, %ymm13, %ymm4
+	VBROADCASTSD CPI0_48<>(SB), Y13                    // vbroadcastsd	.LCPI0_48(%rip), %ymm13
+	LONG         $0x9895e2c4; BYTE $0xfe               // vfmadd132pd	%ymm6, %ymm13, %ymm7
+	LONG         $0x9895c2c4; BYTE $0xe4               // vfmadd132pd	%ymm12, %ymm13, %ymm4
+	VBROADCASTSD CPI0_50<>(SB), Y13                    // vbroadcastsd	.LCPI0_50(%rip), %ymm13
+	LONG         $0x9895e2c4; BYTE $0xfe               // vfmadd132pd	%ymm6, %ymm13, %ymm7
+	LONG         $0x9895c2c4; BYTE $0xe4               // vfmadd132pd	%ymm12, %ymm13, %ymm4
+	VBROADCASTSD CPI0_52<>(SB), Y13                    // vbroadcastsd	.LCPI0_52(%rip), %ymm13
+	LONG         $0x9895e2c4; BYTE $0xfe               // vfmadd132pd	%ymm6, %ymm13, %ymm7
+	LONG         $0x9895c2c4; BYTE $0xe4               // vfmadd132pd	%ymm12, %ymm13, %ymm4
+	VBROADCASTSD CPI0_54<>(SB), Y13                    // vbroadcastsd	.LCPI0_54(%rip), %ymm13
+	LONG         $0x9895e2c4; BYTE $0xfe               // vfmadd132pd	%ymm6, %ymm13, %ymm7
+	LONG         $0x9895c2c4; BYTE $0xe4               // vfmadd132pd	%ymm12, %ymm13, %ymm4
+	VBROADCASTSD CPI0_56<>(SB), Y13                    // vbroadcastsd	.LCPI0_56(%rip), %ymm13
+	LONG         $0x9895e2c4; BYTE $0xfe               // vfmadd132pd	%ymm6, %ymm13, %ymm7
+	LONG         $0x9895c2c4; BYTE $0xe4               // vfmadd132pd	%ymm12, %ymm13, %ymm4
+	VBROADCASTSD CPI0_58<>(SB), Y13                    // vbroadcastsd	.LCPI0_58(%rip), %ymm13
+	LONG         $0x9895e2c4; BYTE $0xfe               // vfmadd132pd	%ymm6, %ymm13, %ymm7
+	LONG         $0x9895c2c4; BYTE $0xe4               // vfmadd132pd	%ymm12, %ymm13, %ymm4
+	VBROADCASTSD CPI0_60<>(SB), Y13                    // vbroadcastsd	.LCPI0_60(%rip), %ymm13
+	LONG         $0x9895e2c4; BYTE $0xfe               // vfmadd132pd	%ymm6, %ymm13, %ymm7
+	LONG         $0x9895c2c4; BYTE $0xe4               // vfmadd132pd	%ymm12, %ymm13, %ymm4
+	VBROADCASTSD CPI0_62<>(SB), Y13                    // vbroadcastsd	.LCPI0_62(%rip), %ymm13
+	LONG         $0x9895e2c4; BYTE $0xfe               // vfmadd132pd	%ymm6, %ymm13, %ymm7
+	LONG         $0x9895c2c4; BYTE $0xe4               // vfmadd132pd	%ymm12, %ymm13, %ymm4
+	LONG         $0x9895e2c4; BYTE $0xf7               // vfmadd132pd	%ymm7, %ymm13, %ymm6
+	LONG         $0x9895c2c4; BYTE $0xe4               // vfmadd132pd	%ymm12, %ymm13, %ymm4
+	LONG         $0x28fdd162; WORD $0xfb7a             // vcvttpd2qq	%ymm11, %ymm7
+	LONG         $0x28fd7262; WORD $0xdf7c             // vpbroadcastq	%rdi, %ymm11
+	LONG         $0xd445c1c4; BYTE $0xfb               // vpaddq	%ymm11, %ymm7, %ymm7
+	LONG         $0xf773c5c5; BYTE $0x34               // vpsllq	$52, %ymm7, %ymm7
+	LONG         $0xf759cdc5                           // vmulpd	%ymm7, %ymm6, %ymm6
+	LONG         $0x28fdd162; WORD $0xf97a             // vcvttpd2qq	%ymm9, %ymm7
+	LONG         $0xd445c1c4; BYTE $0xfb               // vpaddq	%ymm11, %ymm7, %ymm7
+	LONG         $0xf773c5c5; BYTE $0x34               // vpsllq	$52, %ymm7, %ymm7
+	LONG         $0xe759ddc5                           // vmulpd	%ymm7, %ymm4, %ymm4
+	VBROADCASTSS CPI0_65<>(SB), Y7                     // vbroadcastss	.LCPI0_65(%rip), %ymm7
+	LONG         $0xf65afdc5                           // vcvtpd2psy	%ymm6, %xmm6
+	LONG         $0xe45afdc5                           // vcvtpd2psy	%ymm4, %xmm4
+	LONG         $0x184de3c4; WORD $0x01e4             // vinsertf128	$0x1, %xmm4, %ymm6, %ymm4
+	VBROADCASTSS CPI0_67<>(SB), Y6                     // vbroadcastss	.LCPI0_67(%rip), %ymm6
+	LONG         $0x283cf162; WORD $0xcec2; BYTE $0x0a // vcmpps	$10, %ymm6, %ymm8, %k1
+	LONG         $0xc24cc1c4; WORD $0x01f0             // vcmpltps	%ymm8, %ymm6, %ymm6
+	LONG         $0x293cf162; WORD $0xcfc2; BYTE $0x05 // vcmpps	$5, %ymm7, %ymm8, %k1{%k1}
+	VBROADCASTSS CPI0_0<>(SB), Y7                      // vbroadcastss	.LCPI0_0(%rip), %ymm7
+	LONG         $0xf754ccc5                           // vandps	%ymm7, %ymm6, %ymm6
+	LONG         $0x294df262; WORD $0xe465             // vblendmps	%ymm4, %ymm6, %ymm4{%k1}
+	LONG         $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG         $0xf4c6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm6
+	LONG         $0xfcc6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm7
+	LONG         $0x2111fcc5                           // vmovups	%ymm4, (%rcx)
+	WORD         $0x8948; BYTE $0xf1                   // movq	%rsi, %rcx
+	LONG         $0xf8e18348                           // andq	$-8, %rcx
+	LONG         $0xee58d2c5                           // vaddss	%xmm6, %xmm5, %xmm5
+	LONG         $0xf415d8c5                           // vunpckhps	%xmm4, %xmm4, %xmm6
+	WORD         $0x0148; BYTE $0xca                   // addq	%rcx, %rdx
+	WORD         $0xe683; BYTE $0x07                   // andl	$7, %esi
+	LONG         $0xee58d2c5                           // vaddss	%xmm6, %xmm5, %xmm5
+	LONG         $0x287df362; WORD $0xe619; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm6
+	LONG         $0xef58d2c5                           // vaddss	%xmm7, %xmm5, %xmm5
+	LONG         $0xee58d2c5                           // vaddss	%xmm6, %xmm5, %xmm5
+	LONG         $0x285df362; WORD $0xf403; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm6
+	LONG         $0xee58d2c5                           // vaddss	%xmm6, %xmm5, %xmm5
+	LONG         $0x285df362; WORD $0xf403; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm6
+	LONG         $0x285df362; WORD $0xe403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm4
+	LONG         $0xee58d2c5                           // vaddss	%xmm6, %xmm5, %xmm5
+	LONG         $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	JE           BB0_43
+
+BB0_44:
+	VMOVSD CPI0_36<>(SB), X13  // vmovsd	.LCPI0_36(%rip), %xmm13
+	VMOVSD CPI0_38<>(SB), X12  // vmovsd	.LCPI0_38(%rip), %xmm12
+	QUAD   $0x000000f8248c8b48 // movq	248(%rsp), %rcx
+	QUAD   $0x0000012024848b48 // movq	288(%rsp), %rax
+	VMOVSD CPI0_40<>(SB), X11  // vmovsd	.LCPI0_40(%rip), %xmm11
+	VMOVSD CPI0_42<>(SB), X9   // vmovsd	.LCPI0_42(%rip), %xmm9
+	VMOVSD CPI0_44<>(SB), X8   // vmovsd	.LCPI0_44(%rip), %xmm8
+
+BB0_48:
+	LONG        $0x2410fac5; BYTE $0x90               // vmovss	(%rax,%rdx,4), %xmm4
+	LONG        $0xc828f8c5                           // vmovaps	%xmm0, %xmm1
+	LONG        $0x5c5ac1c4; BYTE $0xe2               // vsubss	%xmm10, %xmm4, %xmm4
+	VCOMISS     CPI0_67<>(SB), X4                     // vcomiss	.LCPI0_67(%rip), %xmm4
+	JA          BB0_49
+	VMOVSS      CPI0_65<>(SB), X6                     // vmovss	.LCPI0_65(%rip), %xmm6
+	LONG        $0xc957f0c5                           // vxorps	%xmm1, %xmm1, %xmm1
+	LONG        $0xf42ff8c5                           // vcomiss	%xmm4, %xmm6
+	JA          BB0_49
+	VMOVQ       CPI0_90<>(SB), X7                     // vmovq	.LCPI0_90(%rip), %xmm7
+	LONG        $0xe45adac5                           // vcvtss2sd	%xmm4, %xmm4, %xmm4
+	VMULSD      CPI0_30<>(SB), X4, X6                 // vmulsd	.LCPI0_30(%rip), %xmm4, %xmm6
+	VPTERNLOGQ  $248, CPI0_89<>(SB), X6, X7           // vpternlogq	$248, .LCPI0_89(%rip), %xmm6, %xmm7
+	LONG        $0xf758cbc5                           // vaddsd	%xmm7, %xmm6, %xmm6
+	VMOVSD      CPI0_62<>(SB), X7                     // vmovsd	.LCPI0_62(%rip), %xmm7
+	LONG        $0x08cdf362; WORD $0xf60b; BYTE $0x03 // vrndscalesd	$3, %xmm6, %xmm6, %xmm6
+	LONG        $0xbdc9c2c4; BYTE $0xe5               // vfnmadd231sd	%xmm13, %xmm6, %xmm4
+	LONG        $0x2cfbe1c4; BYTE $0xf6               // vcvttsd2siq	%xmm6, %rsi
+	LONG        $0xffc68148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rsi
+	LONG        $0xbdc9c2c4; BYTE $0xe4               // vfnmadd231sd	%xmm12, %xmm6, %xmm4
+	LONG        $0x34e6c148                           // salq	$52, %rsi
+	LONG        $0x6ef9e1c4; BYTE $0xf6               // vmovq	%rsi, %xmm6
+	LONG        $0xcc10dbc5                           // vmovsd	%xmm4, %xmm4, %xmm1
+	LONG        $0x99b1c2c4; BYTE $0xcb               // vfmadd132sd	%xmm11, %xmm9, %xmm1
+	LONG        $0x99b9e2c4; BYTE $0xcc               // vfmadd132sd	%xmm4, %xmm8, %xmm1
+	VFMADD213SD CPI0_46<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_46(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_48<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_48(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_50<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_50(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_52<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_52(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_54<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_54(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_56<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_56(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_58<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_58(%rip), %xmm4, %xmm1
+	VFMADD213SD CPI0_60<>(SB), X4, X1                 // vfmadd213sd	.LCPI0_60(%rip), %xmm4, %xmm1
+	LONG        $0x99c1e2c4; BYTE $0xcc               // vfmadd132sd	%xmm4, %xmm7, %xmm1
+	LONG        $0x99c1e2c4; BYTE $0xcc               // vfmadd132sd	%xmm4, %xmm7, %xmm1
+	LONG        $0xce59f3c5                           // vmulsd	%xmm6, %xmm1, %xmm1
+	LONG        $0xc95af3c5                           // vcvtsd2ss	%xmm1, %xmm1, %xmm1
+
+BB0_49:
+	LONG $0x0c11fac5; BYTE $0x90 // vmovss	%xmm1, (%rax,%rdx,4)
+	LONG $0x01c28348             // addq	$1, %rdx
+	LONG $0xe958d2c5             // vaddss	%xmm1, %xmm5, %xmm5
+	WORD $0x3948; BYTE $0xd1     // cmpq	%rdx, %rcx
+	JG   BB0_48
+
+BB0_43:
+	VMOVSS CPI0_26<>(SB), X6               // vmovss	.LCPI0_26(%rip), %xmm6
+	QUAD   $0x000000f824bc8348; BYTE $0x0f // cmpq	$15, 248(%rsp)
+	LONG   $0xed5ecac5                     // vdivss	%xmm5, %xmm6, %xmm5
+	LONG   $0x487df262; WORD $0xf518       // vbroadcastss	%xmm5, %zmm6
+	JLE    BB0_159
+
+BB0_50:
+	LONG $0x24548b48; BYTE $0x68 // movq	104(%rsp), %rdx
+	QUAD $0x000000d024848b48     // movq	208(%rsp), %rax
+	LONG $0xf0e28348             // andq	$-16, %rdx
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	QUAD $0x000000b824848b48     // movq	184(%rsp), %rax
+	LONG $0x904c8d48; BYTE $0x40 // leaq	64(%rax,%rdx,4), %rcx
+	QUAD $0x0000012024948b48     // movq	288(%rsp), %rdx
+
+BB0_53:
+	LONG $0x484cf162; WORD $0x0a59             // vmulps	(%rdx), %zmm6, %zmm1
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x487cf162; WORD $0x4a11; BYTE $0xff // vmovups	%zmm1, -64(%rdx)
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JNE  BB0_53
+	LONG $0x24548b48; BYTE $0x70               // movq	112(%rsp), %rdx
+
+BB0_52:
+	QUAD $0x000000f824943948       // cmpq	%rdx, 248(%rsp)
+	JLE  BB0_58
+	QUAD $0x000000f8248c8b48       // movq	248(%rsp), %rcx
+	WORD $0x8948; BYTE $0xd6       // movq	%rdx, %rsi
+	WORD $0x2948; BYTE $0xd1       // subq	%rdx, %rcx
+	LONG $0xff798d48               // leaq	-1(%rcx), %rdi
+	LONG $0x0eff8348               // cmpq	$14, %rdi
+	JBE  BB0_90
+	QUAD $0x000000d024848b48       // movq	208(%rsp), %rax
+	LONG $0x023c8d48               // leaq	(%rdx,%rax), %rdi
+	QUAD $0x000000b824848b48       // movq	184(%rsp), %rax
+	LONG $0xb83c8d48               // leaq	(%rax,%rdi,4), %rdi
+	LONG $0x484cf162; WORD $0x3759 // vmulps	(%rdi), %zmm6, %zmm6
+	LONG $0x487cf162; WORD $0x3711 // vmovups	%zmm6, (%rdi)
+	WORD $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	LONG $0xf0e78348               // andq	$-16, %rdi
+	WORD $0x0148; BYTE $0xfa       // addq	%rdi, %rdx
+	WORD $0xc1f6; BYTE $0x0f       // testb	$15, %cl
+	JE   BB0_58
+
+BB0_51:
+	WORD $0x2948; BYTE $0xf9     // subq	%rdi, %rcx
+	LONG $0xff418d4c             // leaq	-1(%rcx), %r8
+	LONG $0x06f88349             // cmpq	$6, %r8
+	JBE  BB0_59
+	QUAD $0x000000d024848b48     // movq	208(%rsp), %rax
+	LONG $0x187de2c4; BYTE $0xe5 // vbroadcastss	%xmm5, %ymm4
+	WORD $0x0148; BYTE $0xc6     // addq	%rax, %rsi
+	QUAD $0x000000b824848b48     // movq	184(%rsp), %rax
+	WORD $0x0148; BYTE $0xfe     // addq	%rdi, %rsi
+	LONG $0xb0348d48             // leaq	(%rax,%rsi,4), %rsi
+	LONG $0x2659dcc5             // vmulps	(%rsi), %ymm4, %ymm4
+	LONG $0x2611fcc5             // vmovups	%ymm4, (%rsi)
+	WORD $0x8948; BYTE $0xce     // movq	%rcx, %rsi
+	LONG $0xf8e68348             // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	WORD $0xe183; BYTE $0x07     // andl	$7, %ecx
+	JE   BB0_58
+
+BB0_59:
+	QUAD $0x000000d024848b48 // movq	208(%rsp), %rax
+	QUAD $0x000000b824b48b48 // movq	184(%rsp), %rsi
+	QUAD $0x000000f824bc8b48 // movq	248(%rsp), %rdi
+	LONG $0x100c8d48         // leaq	(%rax,%rdx), %rcx
+	LONG $0x8e0c8d48         // leaq	(%rsi,%rcx,4), %rcx
+	LONG $0x2159d2c5         // vmulss	(%rcx), %xmm5, %xmm4
+	LONG $0x2111fac5         // vmovss	%xmm4, (%rcx)
+	LONG $0x014a8d48         // leaq	1(%rdx), %rcx
+	WORD $0x3948; BYTE $0xcf // cmpq	%rcx, %rdi
+	JLE  BB0_58
+	WORD $0x0148; BYTE $0xc1 // addq	%rax, %rcx
+	LONG $0x8e0c8d48         // leaq	(%rsi,%rcx,4), %rcx
+	LONG $0x2159d2c5         // vmulss	(%rcx), %xmm5, %xmm4
+	LONG $0x2111fac5         // vmovss	%xmm4, (%rcx)
+	LONG $0x024a8d48         // leaq	2(%rdx), %rcx
+	WORD $0x3948; BYTE $0xcf // cmpq	%rcx, %rdi
+	JLE  BB0_58
+	WORD $0x0148; BYTE $0xc1 // addq	%rax, %rcx
+	LONG $0x8e0c8d48         // leaq	(%rsi,%rcx,4), %rcx
+	LONG $0x2159d2c5         // vmulss	(%rcx), %xmm5, %xmm4
+	LONG $0x2111fac5         // vmovss	%xmm4, (%rcx)
+	LONG $0x034a8d48         // leaq	3(%rdx), %rcx
+	WORD $0x3948; BYTE $0xcf // cmpq	%rcx, %rdi
+	JLE  BB0_58
+	WORD $0x0148; BYTE $0xc1 // addq	%rax, %rcx
+	LONG $0x8e0c8d48         // leaq	(%rsi,%rcx,4), %rcx
+	LONG $0x2159d2c5         // vmulss	(%rcx), %xmm5, %xmm4
+	LONG $0x2111fac5         // vmovss	%xmm4, (%rcx)
+	LONG $0x044a8d48         // leaq	4(%rdx), %rcx
+	WORD $0x3948; BYTE $0xcf // cmpq	%rcx, %rdi
+	JLE  BB0_58
+	WORD $0x0148; BYTE $0xc1 // addq	%rax, %rcx
+	LONG $0x8e0c8d48         // leaq	(%rsi,%rcx,4), %rcx
+	LONG $0x2159d2c5         // vmulss	(%rcx), %xmm5, %xmm4
+	LONG $0x2111fac5         // vmovss	%xmm4, (%rcx)
+	LONG $0x054a8d48         // leaq	5(%rdx), %rcx
+	WORD $0x3948; BYTE $0xcf // cmpq	%rcx, %rdi
+	JLE  BB0_58
+	WORD $0x0148; BYTE $0xc1 // addq	%rax, %rcx
+	LONG $0x06c28348         // addq	$6, %rdx
+	LONG $0x8e0c8d48         // leaq	(%rsi,%rcx,4), %rcx
+	LONG $0x2159d2c5         // vmulss	(%rcx), %xmm5, %xmm4
+	LONG $0x2111fac5         // vmovss	%xmm4, (%rcx)
+	WORD $0x3948; BYTE $0xd7 // cmpq	%rdx, %rdi
+	JLE  BB0_58
+	WORD $0x0148; BYTE $0xc2 // addq	%rax, %rdx
+	LONG $0x96148d48         // leaq	(%rsi,%rdx,4), %rdx
+	LONG $0x2a59d2c5         // vmulss	(%rdx), %xmm5, %xmm5
+	LONG $0x2a11fac5         // vmovss	%xmm5, (%rdx)
+
+BB0_58:
+	QUAD $0x000000c824848b4c     // movq	200(%rsp), %r8
+	WORD $0xff31                 // xorl	%edi, %edi
+	LONG $0x000010ba; BYTE $0x00 // movl	$16, %edx
+	WORD $0xf631                 // xorl	%esi, %esi
+	LONG $0x3ffd8349             // cmpq	$63, %r13
+	JLE  BB0_56
+	QUAD $0x00000118249c894c     // movq	%r11, 280(%rsp)
+	QUAD $0x000000f824948b4c     // movq	248(%rsp), %r10
+	LONG $0x6ef941c4; BYTE $0xc7 // vmovq	%r15, %xmm8
+	QUAD $0x00000110249c8948     // movq	%rbx, 272(%rsp)
+	QUAD $0x00000120249c8b4c     // movq	288(%rsp), %r11
+	QUAD $0x00000080248c8b4c     // movq	128(%rsp), %r9
+	QUAD $0x00000088249c8b48     // movq	136(%rsp), %rbx
+	QUAD $0x0000013024ac894c     // movq	%r13, 304(%rsp)
+	WORD $0x894d; BYTE $0xf5     // movq	%r14, %r13
+
+BB0_55:
+	WORD $0x854d; BYTE $0xd2                   // testq	%r10, %r10
+	JLE  BB0_160
+	LONG $0xff57c0c5                           // vxorps	%xmm7, %xmm7, %xmm7
+	LONG $0x407f8d4c                           // leaq	64(%rdi), %r15
+	LONG $0x3b148d48                           // leaq	(%rbx,%rdi), %rdx
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	LONG $0x80b78d4c; WORD $0x0000; BYTE $0x00 // leaq	128(%rdi), %r14
+	LONG $0xc0b78d48; WORD $0x0000; BYTE $0x00 // leaq	192(%rdi), %rsi
+	LONG $0x487cf162; WORD $0xf728             // vmovaps	%zmm7, %zmm6
+	LONG $0x487cf162; WORD $0xef28             // vmovaps	%zmm7, %zmm5
+	LONG $0x487cf162; WORD $0xe728             // vmovaps	%zmm7, %zmm4
+
+BB0_61:
+	WORD $0x8948; BYTE $0xd1                   // movq	%rdx, %rcx
+	LONG $0x487df262; WORD $0x0818             // vbroadcastss	(%rax), %zmm1
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x2948; BYTE $0xf9                   // subq	%rdi, %rcx
+	LONG $0x4875f262; WORD $0x22b8             // vfmadd231ps	(%rdx), %zmm1, %zmm4
+	WORD $0x014c; BYTE $0xea                   // addq	%r13, %rdx
+	LONG $0x4875b262; WORD $0x2cb8; BYTE $0x39 // vfmadd231ps	(%rcx,%r15), %zmm1, %zmm5
+	LONG $0x4875b262; WORD $0x34b8; BYTE $0x31 // vfmadd231ps	(%rcx,%r14), %zmm1, %zmm6
+	LONG $0x4875f262; WORD $0x3cb8; BYTE $0x31 // vfmadd231ps	(%rcx,%rsi), %zmm1, %zmm7
+	WORD $0x394c; BYTE $0xc8                   // cmpq	%r9, %rax
+	JNE  BB0_61
+
+BB0_63:
+	LONG $0x00c78148; WORD $0x0001; BYTE $0x00 // addq	$256, %rdi
+	LONG $0x487cd162; WORD $0x2011             // vmovups	%zmm4, (%r8)
+	LONG $0x00c08149; WORD $0x0001; BYTE $0x00 // addq	$256, %r8
+	LONG $0x487cd162; WORD $0x6811; BYTE $0xfd // vmovups	%zmm5, -192(%r8)
+	LONG $0x487cd162; WORD $0x7011; BYTE $0xfe // vmovups	%zmm6, -128(%r8)
+	LONG $0x487cd162; WORD $0x7811; BYTE $0xff // vmovups	%zmm7, -64(%r8)
+	WORD $0x3949; BYTE $0xfc                   // cmpq	%rdi, %r12
+	JNE  BB0_55
+	WORD $0x894d; BYTE $0xee                   // movq	%r13, %r14
+	LONG $0x24548b48; BYTE $0x30               // movq	48(%rsp), %rdx
+	LONG $0x24748b48; BYTE $0x38               // movq	56(%rsp), %rsi
+	LONG $0x7ef941c4; BYTE $0xc7               // vmovq	%xmm8, %r15
+	QUAD $0x0000013024ac8b4c                   // movq	304(%rsp), %r13
+	QUAD $0x00000118249c8b4c                   // movq	280(%rsp), %r11
+	QUAD $0x00000110249c8b48                   // movq	272(%rsp), %rbx
+
+BB0_56:
+	WORD $0x3949; BYTE $0xd5 // cmpq	%rdx, %r13
+	JL   BB0_64
+	QUAD $0x000000b824848b48 // movq	184(%rsp), %rax
+	QUAD $0x000000d024bc8b48 // movq	208(%rsp), %rdi
+	WORD $0x8949; BYTE $0xd0 // movq	%rdx, %r8
+	LONG $0xb80c8d4c         // leaq	(%rax,%rdi,4), %r9
+	WORD $0x8948; BYTE $0xd8 // movq	%rbx, %rax
+	QUAD $0x0000008024bc8b48 // movq	128(%rsp), %rdi
+	WORD $0x8948; BYTE $0xd3 // movq	%rdx, %rbx
+	WORD $0x894c; BYTE $0xda // movq	%r11, %rdx
+	WORD $0x894d; BYTE $0xcb // movq	%r9, %r11
+	WORD $0x8949; BYTE $0xc1 // movq	%rax, %r9
+
+BB0_65:
+	QUAD $0x000000f824bc8348; BYTE $0x00 // cmpq	$0, 248(%rsp)
+	WORD $0x8949; BYTE $0xf2             // movq	%rsi, %r10
+	LONG $0xc957f0c5                     // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0x894c; BYTE $0xc6             // movq	%r8, %rsi
+	JLE  BB0_69
+	QUAD $0x0000008824848b48             // movq	136(%rsp), %rax
+	LONG $0xc957f0c5                     // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x900c8d4a                     // leaq	(%rax,%r10,4), %rcx
+	WORD $0x894c; BYTE $0xd8             // movq	%r11, %rax
+
+BB0_66:
+	LONG $0x487df262; WORD $0x3018 // vbroadcastss	(%rax), %zmm6
+	LONG $0x04c08348               // addq	$4, %rax
+	LONG $0x484df262; WORD $0x09b8 // vfmadd231ps	(%rcx), %zmm6, %zmm1
+	WORD $0x014c; BYTE $0xf1       // addq	%r14, %rcx
+	WORD $0x3948; BYTE $0xf8       // cmpq	%rdi, %rax
+	JNE  BB0_66
+
+BB0_69:
+	QUAD $0x0000013824848b48                   // movq	312(%rsp), %rax
+	LONG $0x10c08349                           // addq	$16, %r8
+	WORD $0x0149; BYTE $0xc2                   // addq	%rax, %r10
+	LONG $0x24448b48; BYTE $0x78               // movq	120(%rsp), %rax
+	LONG $0x487cb162; WORD $0x0c11; BYTE $0x90 // vmovups	%zmm1, (%rax,%r10,4)
+	WORD $0x394d; BYTE $0xc5                   // cmpq	%r8, %r13
+	JGE  BB0_65
+	WORD $0x8949; BYTE $0xd3                   // movq	%rdx, %r11
+	WORD $0x894c; BYTE $0xee                   // movq	%r13, %rsi
+	WORD $0x8948; BYTE $0xda                   // movq	%rbx, %rdx
+	WORD $0x894c; BYTE $0xcb                   // movq	%r9, %rbx
+	WORD $0x2948; BYTE $0xd6                   // subq	%rdx, %rsi
+	LONG $0xf0e68348                           // andq	$-16, %rsi
+	WORD $0x0148; BYTE $0xd6                   // addq	%rdx, %rsi
+
+BB0_64:
+	WORD $0x3949; BYTE $0xf5     // cmpq	%rsi, %r13
+	JLE  BB0_70
+	LONG $0x247c8b48; BYTE $0x28 // movq	40(%rsp), %rdi
+	QUAD $0x0000012024948b48     // movq	288(%rsp), %rdx
+	QUAD $0x0000011024a4894c     // movq	%r12, 272(%rsp)
+	QUAD $0x000000f824948b4c     // movq	248(%rsp), %r10
+	QUAD $0x0000008824848b48     // movq	136(%rsp), %rax
+	QUAD $0x00000108249c894c     // movq	%r11, 264(%rsp)
+	LONG $0x170c8d48             // leaq	(%rdi,%rdx), %rcx
+	QUAD $0x000000b024bc8b48     // movq	176(%rsp), %rdi
+	QUAD $0x000000d0249c8b4c     // movq	208(%rsp), %r11
+	QUAD $0x00000100249c8948     // movq	%rbx, 256(%rsp)
+	WORD $0x894d; BYTE $0xd1     // movq	%r10, %r9
+	QUAD $0x000000b824a48b4c     // movq	184(%rsp), %r12
+	LONG $0xb0048d4c             // leaq	(%rax,%rsi,4), %r8
+	WORD $0x8948; BYTE $0xc3     // movq	%rax, %rbx
+	QUAD $0x0000013024bc8948     // movq	%rdi, 304(%rsp)
+	LONG $0x03e18341             // andl	$3, %r9d
+	QUAD $0x00000118248c894c     // movq	%r9, 280(%rsp)
+	WORD $0x894d; BYTE $0xf1     // movq	%r14, %r9
+	WORD $0x894d; BYTE $0xfe     // movq	%r15, %r14
+
+BB0_71:
+	LONG $0xe457d8c5                     // vxorps	%xmm4, %xmm4, %xmm4
+	WORD $0x854d; BYTE $0xd2             // testq	%r10, %r10
+	JLE  BB0_76
+	QUAD $0x000000a024bc8348; BYTE $0x02 // cmpq	$2, 160(%rsp)
+	JBE  BB0_92
+	QUAD $0x0000012024bc8b48             // movq	288(%rsp), %rdi
+	WORD $0x894c; BYTE $0xc0             // movq	%r8, %rax
+	QUAD $0x0000013024948b48             // movq	304(%rsp), %rdx
+	LONG $0xe457d8c5                     // vxorps	%xmm4, %xmm4, %xmm4
+
+BB0_73:
+	LONG $0x107aa1c4; WORD $0x482c             // vmovss	(%rax,%r9,2), %xmm5
+	LONG $0x0810fac5                           // vmovss	(%rax), %xmm1
+	LONG $0x10c78348                           // addq	$16, %rdi
+	LONG $0x2151a3c4; WORD $0x302c; BYTE $0x10 // vinsertps	$0x10, (%rax,%r14), %xmm5, %xmm5
+	LONG $0x2171a3c4; WORD $0x080c; BYTE $0x10 // vinsertps	$0x10, (%rax,%r9), %xmm1, %xmm1
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0xcd16f0c5                           // vmovlhps	%xmm5, %xmm1, %xmm1
+	LONG $0x4f59f0c5; BYTE $0xf0               // vmulps	-16(%rdi), %xmm1, %xmm1
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0xe9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm5
+	LONG $0xec58d2c5                           // vaddss	%xmm4, %xmm5, %xmm5
+	LONG $0xe115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm4
+	LONG $0xc9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	WORD $0x3948; BYTE $0xf9                   // cmpq	%rdi, %rcx
+	JNE  BB0_73
+	QUAD $0x0000011824bc8348; BYTE $0x00       // cmpq	$0, 280(%rsp)
+	QUAD $0x0000013024948948                   // movq	%rdx, 304(%rsp)
+	JE   BB0_76
+	QUAD $0x0000009824848b48                   // movq	152(%rsp), %rax
+
+BB0_72:
+	WORD $0x894c; BYTE $0xef       // movq	%r13, %rdi
+	LONG $0x033c8d4d               // leaq	(%r11,%rax), %r15
+	LONG $0xf8af0f48               // imulq	%rax, %rdi
+	LONG $0x6ef9c1c4; BYTE $0xcf   // vmovq	%r15, %xmm1
+	LONG $0x7ef9e1c4; BYTE $0xca   // vmovq	%xmm1, %rdx
+	LONG $0x107ac1c4; WORD $0x9434 // vmovss	(%r12,%rdx,4), %xmm6
+	LONG $0x373c8d4c               // leaq	(%rdi,%rsi), %r15
+	LONG $0xb949a2c4; WORD $0xbb24 // vfmadd231ss	(%rbx,%r15,4), %xmm6, %xmm4
+	LONG $0x01788d4c               // leaq	1(%rax), %r15
+	WORD $0x394d; BYTE $0xd7       // cmpq	%r10, %r15
+	JGE  BB0_76
+	WORD $0x014c; BYTE $0xef       // addq	%r13, %rdi
+	LONG $0x1f148d4b               // leaq	(%r15,%r11), %rdx
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x373c8d4c               // leaq	(%rdi,%rsi), %r15
+	LONG $0x107ac1c4; WORD $0x9434 // vmovss	(%r12,%rdx,4), %xmm6
+	LONG $0xb949a2c4; WORD $0xbb24 // vfmadd231ss	(%rbx,%r15,4), %xmm6, %xmm4
+	WORD $0x3949; BYTE $0xc2       // cmpq	%rax, %r10
+	JLE  BB0_76
+	LONG $0x357c8d4d; BYTE $0x00   // leaq	0(%r13,%rsi), %r15
+	WORD $0x014c; BYTE $0xd8       // addq	%r11, %rax
+	WORD $0x014c; BYTE $0xff       // addq	%r15, %rdi
+	LONG $0x3410fac5; BYTE $0xbb   // vmovss	(%rbx,%rdi,4), %xmm6
+	LONG $0xb949c2c4; WORD $0x8424 // vfmadd231ss	(%r12,%rax,4), %xmm6, %xmm4
+
+BB0_76:
+	QUAD $0x000000c824848b48     // movq	200(%rsp), %rax
+	LONG $0x04c08349             // addq	$4, %r8
+	LONG $0x2411fac5; BYTE $0xb0 // vmovss	%xmm4, (%rax,%rsi,4)
+	LONG $0x01c68348             // addq	$1, %rsi
+	WORD $0x3949; BYTE $0xf5     // cmpq	%rsi, %r13
+	JNE  BB0_71
+	QUAD $0x0000011024a48b4c     // movq	272(%rsp), %r12
+	QUAD $0x00000108249c8b4c     // movq	264(%rsp), %r11
+	WORD $0x894d; BYTE $0xf7     // movq	%r14, %r15
+	WORD $0x894d; BYTE $0xce     // movq	%r9, %r14
+	QUAD $0x00000100249c8b48     // movq	256(%rsp), %rbx
+
+BB0_70:
+	LONG $0x24748b48; BYTE $0x50         // movq	80(%rsp), %rsi
+	QUAD $0x000000f824bc8b48             // movq	248(%rsp), %rdi
+	WORD $0x014d; BYTE $0xf3             // addq	%r14, %r11
+	QUAD $0x0000009024848348; BYTE $0x01 // addq	$1, 144(%rsp)
+	QUAD $0x0000009024848b48             // movq	144(%rsp), %rax
+	QUAD $0x000000d024bc0148             // addq	%rdi, 208(%rsp)
+	LONG $0x247c8b48; BYTE $0x58         // movq	88(%rsp), %rdi
+	QUAD $0x0000013824ac014c             // addq	%r13, 312(%rsp)
+	QUAD $0x000000c824b4014c             // addq	%r14, 200(%rsp)
+	QUAD $0x0000012024bc0148             // addq	%rdi, 288(%rsp)
+	QUAD $0x0000008024bc0148             // addq	%rdi, 128(%rsp)
+	WORD $0x3948; BYTE $0xf0             // cmpq	%rsi, %rax
+	JNE  BB0_77
+	WORD $0xf8c5; BYTE $0x77             // vzeroupper
+
+BB0_155:
+	LONG $0x90a58d48; WORD $0xfffe; BYTE $0xff // leaq	-368(%rbp), %rsp
+	RET
+
+BB0_78:
+	LONG $0xf657c9c5               // vxorpd	%xmm6, %xmm6, %xmm6
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x48fdf162; WORD $0xee28 // vmovapd	%zmm6, %zmm5
+	LONG $0x48fdf162; WORD $0xe628 // vmovapd	%zmm6, %zmm4
+	LONG $0x48fdf162; WORD $0xfe28 // vmovapd	%zmm6, %zmm7
+	JMP  BB0_6
+
+BB0_160:
+	LONG $0xff57c0c5               // vxorps	%xmm7, %xmm7, %xmm7
+	LONG $0x487cf162; WORD $0xf728 // vmovaps	%zmm7, %zmm6
+	LONG $0x487cf162; WORD $0xef28 // vmovaps	%zmm7, %zmm5
+	LONG $0x487cf162; WORD $0xe728 // vmovaps	%zmm7, %zmm4
+	JMP  BB0_63
+
+BB0_79:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_9
+
+BB0_33:
+	QUAD $0x0000012024848b48             // movq	288(%rsp), %rax
+	QUAD $0x000000f824bc8348; BYTE $0x01 // cmpq	$1, 248(%rsp)
+	LONG $0x10107ac5                     // vmovss	(%rax), %xmm10
+	JG   BB0_29
+
+BB0_85:
+	LONG $0xed57d1c5 // vxorpd	%xmm5, %xmm5, %xmm5
+	WORD $0xd231     // xorl	%edx, %edx
+	JMP  BB0_17
+
+BB0_92:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xe457d8c5 // vxorps	%xmm4, %xmm4, %xmm4
+	JMP  BB0_72
+
+BB0_81:
+	LONG $0xe457d9c5 // vxorpd	%xmm4, %xmm4, %xmm4
+	WORD $0xd231     // xorl	%edx, %edx
+	JMP  BB0_20
+
+BB0_82:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_23
+
+BB0_5:
+	WORD $0xc931                         // xorl	%ecx, %ecx
+	QUAD $0x000000f824bc8348; BYTE $0x00 // cmpq	$0, 248(%rsp)
+	JG   BB0_16
+	QUAD $0x0000012024848b48             // movq	288(%rsp), %rax
+	LONG $0xed57d1c5                     // vxorpd	%xmm5, %xmm5, %xmm5
+	WORD $0xd231                         // xorl	%edx, %edx
+	LONG $0x10107ac5                     // vmovss	(%rax), %xmm10
+	JMP  BB0_17
+
+BB0_40:
+	VMOVSS CPI0_26<>(SB), X6               // vmovss	.LCPI0_26(%rip), %xmm6
+	QUAD   $0x000000f824bc8348; BYTE $0x0f // cmpq	$15, 248(%rsp)
+	LONG   $0xed5ecac5                     // vdivss	%xmm5, %xmm6, %xmm5
+	LONG   $0x487df262; WORD $0xf518       // vbroadcastss	%xmm5, %zmm6
+	JG     BB0_50
+	WORD   $0xd231                         // xorl	%edx, %edx
+	JMP    BB0_52
+
+BB0_159:
+	QUAD $0x000000f8248c8b48 // movq	248(%rsp), %rcx
+	WORD $0xf631             // xorl	%esi, %esi
+	WORD $0xff31             // xorl	%edi, %edi
+	WORD $0xd231             // xorl	%edx, %edx
+	JMP  BB0_51
+
+BB0_86:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_41
+
+BB0_83:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_30
+
+BB0_90:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_51
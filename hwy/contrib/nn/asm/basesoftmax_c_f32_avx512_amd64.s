@@ -0,0 +1,690 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basesoftmax_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x7f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_11<>+0(SB)/4, $0xb95e8083
+GLOBL CPI0_11<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_13<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_13<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_15<>+0(SB)/4, $0x3c088889
+GLOBL CPI0_15<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_17<>+0(SB)/4, $0x3d2aaaab
+GLOBL CPI0_17<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_19<>+0(SB)/4, $0x3e2aaaab
+GLOBL CPI0_19<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_21<>+0(SB)/4, $0x3f000000
+GLOBL CPI0_21<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_23<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_23<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_27<>+0(SB)/4, $0x652b82fe
+DATA CPI0_27<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_27<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_3<>+0(SB)/4, $0x42b17218
+GLOBL CPI0_3<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_33<>+0(SB)/4, $0xfee00000
+DATA CPI0_33<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_33<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_35<>+0(SB)/4, $0x35793c6c
+DATA CPI0_35<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_35<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_37<>+0(SB)/4, $0xeff8d898
+DATA CPI0_37<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_37<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_39<>+0(SB)/4, $0x67f544e4
+DATA CPI0_39<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_39<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_41<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_41<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_41<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_43<>+0(SB)/4, $0xa556c734
+DATA CPI0_43<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_43<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_45<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_45<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_45<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_47<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_47<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_47<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_49<>+0(SB)/4, $0x16c16c17
+DATA CPI0_49<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_49<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_5<>+0(SB)/4, $0xc2aeac50
+GLOBL CPI0_5<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_51<>+0(SB)/4, $0x11111111
+DATA CPI0_51<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_51<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_53<>+0(SB)/4, $0x55555555
+DATA CPI0_53<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_53<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_55<>+0(SB)/4, $0x55555555
+DATA CPI0_55<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_55<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_57<>+0(SB)/4, $0x00000000
+DATA CPI0_57<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_57<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_59<>+0(SB)/4, $0x00000000
+DATA CPI0_59<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_59<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_62<>+0(SB)/4, $0x44314000
+GLOBL CPI0_62<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_64<>+0(SB)/4, $0xc4314000
+GLOBL CPI0_64<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_7<>+0(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_7<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_86<>+0(SB)/4, $0x00000000
+DATA CPI0_86<>+4(SB)/4, $0x80000000
+DATA CPI0_86<>+8(SB)/4, $0x00000000
+DATA CPI0_86<>+12(SB)/4, $0x00000000
+GLOBL CPI0_86<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_87<>+0(SB)/4, $0xffffffff
+DATA CPI0_87<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_87<>+8(SB)/4, $0x00000000
+DATA CPI0_87<>+12(SB)/4, $0x00000000
+GLOBL CPI0_87<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_9<>+0(SB)/4, $0x3f318000
+GLOBL CPI0_9<>(SB), (RODATA|NOPTR), $4
+
+TEXT ·softmax_c_f32_avx512(SB), $0-24
+	MOVQ input+0(FP), DI
+	MOVQ output+8(FP), SI
+	MOVQ plen_input+16(FP), DX
+	WORD $0x8b48; BYTE $0x12 // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2 // testq	%rdx, %rdx
+	JE   BB0_69
+	WORD $0x8948; BYTE $0xf9 // movq	%rdi, %rcx
+	WORD $0x8948; BYTE $0xe5 // movq	%rsp, %rbp
+	LONG $0x1710fac5         // vmovss	(%rdi), %xmm2
+	LONG $0x01fa8348         // cmpq	$1, %rdx
+	JLE  BB0_31
+	LONG $0x04478d48         // leaq	4(%rdi), %rax
+	LONG $0x973c8d48         // leaq	(%rdi,%rdx,4), %rdi
+
+BB0_5:
+	LONG         $0x0010fac5               // vmovss	(%rax), %xmm0
+	LONG         $0x04c08348               // addq	$4, %rax
+	LONG         $0xd25ffac5               // vmaxss	%xmm2, %xmm0, %xmm2
+	WORD         $0x3948; BYTE $0xc7       // cmpq	%rax, %rdi
+	JNE          BB0_5
+	LONG         $0x487d7262; WORD $0xc218 // vbroadcastss	%xmm2, %zmm8
+	LONG         $0x0ffa8348               // cmpq	$15, %rdx
+	JLE          BB0_31
+	LONG         $0xed57d0c5               // vxorps	%xmm5, %xmm5, %xmm5
+	LONG         $0x00007fbf; BYTE $0x00   // movl	$127, %edi
+	VBROADCASTSS CPI0_3<>(SB), Z19         // vbroadcastss	.LCPI0_3(%rip), %zmm19
+	VBROADCASTSS CPI0_5<>(SB), Z18         // vbroadcastss	.LCPI0_5(%rip), %zmm18
+	VBROADCASTSS CPI0_7<>(SB), Z17         // vbroadcastss	.LCPI0_7(%rip), %zmm17
+	LONG         $0x000010b8; BYTE $0x00   // movl	$16, %eax
+	VBROADCASTSS CPI0_9<>(SB), Z16         // vbroadcastss	.LCPI0_9(%rip), %zmm16
+	LONG         $0x487df262; WORD $0xff7c // vpbroadcastd	%edi, %zmm7
+	VBROADCASTSS CPI0_11<>(SB), Z15        // vbroadcastss	.LCPI0_11(%rip), %zmm15
+	LONG         $0x487c7162; WORD $0xcd28 // vmovaps	%zmm5, %zmm9
+	VBROADCASTSS CPI0_13<>(SB), Z14        // vbroadcastss	.LCPI0_13(%rip), %zmm14
+	VBROADCASTSS CPI0_15<>(SB), Z13        // vbroadcastss	.LCPI0_15(%rip), %zmm13
+	VBROADCASTSS CPI0_17<>(SB), Z12        // vbroadcastss	.LCPI0_17(%rip), %zmm12
+	VBROADCASTSS CPI0_19<>(SB), Z11        // vbroadcastss	.LCPI0_19(%rip), %zmm11
+	VBROADCASTSS CPI0_21<>(SB), Z10        // vbroadcastss	.LCPI0_21(%rip), %zmm10
+	VBROADCASTSS CPI0_23<>(SB), Z6         // vbroadcastss	.LCPI0_23(%rip), %zmm6
+	VBROADCASTSS CPI0_0<>(SB), Z3          // vbroadcastss	.LCPI0_0(%rip), %zmm3
+
+BB0_6:
+	QUAD $0xff816410487cf162                   // vmovups	-64(%rcx,%rax,4), %zmm4
+	LONG $0x487cd162; WORD $0xc628             // vmovaps	%zmm14, %zmm0
+	LONG $0x485cd162; WORD $0xc85c             // vsubps	%zmm8, %zmm4, %zmm1
+	LONG $0x4874b162; WORD $0xe159             // vmulps	%zmm17, %zmm1, %zmm4
+	LONG $0x4874b162; WORD $0xd3c2; BYTE $0x1e // vcmpps	$30, %zmm19, %zmm1, %k2
+	LONG $0x4874b162; WORD $0xcac2; BYTE $0x11 // vcmpps	$17, %zmm18, %zmm1, %k1
+	LONG $0x487df362; WORD $0xe408; BYTE $0x08 // vrndscaleps	$8, %zmm4, %zmm4
+	LONG $0x485db262; WORD $0xc8bc             // vfnmadd231ps	%zmm16, %zmm4, %zmm1
+	LONG $0x485dd262; WORD $0xcfbc             // vfnmadd231ps	%zmm15, %zmm4, %zmm1
+	LONG $0x487df162; WORD $0xe45b             // vcvtps2dq	%zmm4, %zmm4
+	LONG $0x485df162; WORD $0xe7fe             // vpaddd	%zmm7, %zmm4, %zmm4
+	LONG $0x485df162; WORD $0xf472; BYTE $0x17 // vpslld	$23, %zmm4, %zmm4
+	LONG $0x4815f262; WORD $0xc198             // vfmadd132ps	%zmm1, %zmm13, %zmm0
+	LONG $0x481df262; WORD $0xc198             // vfmadd132ps	%zmm1, %zmm12, %zmm0
+	LONG $0x4825f262; WORD $0xc198             // vfmadd132ps	%zmm1, %zmm11, %zmm0
+	LONG $0x482df262; WORD $0xc198             // vfmadd132ps	%zmm1, %zmm10, %zmm0
+	LONG $0x484df262; WORD $0xc198             // vfmadd132ps	%zmm1, %zmm6, %zmm0
+	LONG $0x484df262; WORD $0xc198             // vfmadd132ps	%zmm1, %zmm6, %zmm0
+	LONG $0x487cf162; WORD $0xc459             // vmulps	%zmm4, %zmm0, %zmm0
+	LONG $0x4a7cf162; WORD $0xc328             // vmovaps	%zmm3, %zmm0{%k2}
+	LONG $0x497cd162; WORD $0xc128             // vmovaps	%zmm9, %zmm0{%k1}
+	QUAD $0xff864411487cf162                   // vmovups	%zmm0, -64(%rsi,%rax,4)
+	LONG $0x10c08348                           // addq	$16, %rax
+	LONG $0x4854f162; WORD $0xe858             // vaddps	%zmm0, %zmm5, %zmm5
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JLE  BB0_6
+	LONG $0xf0428d48                           // leaq	-16(%rdx), %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	LONG $0x10c08348                           // addq	$16, %rax
+
+BB0_3:
+	LONG $0x48fdf362; WORD $0xe81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm0
+	LONG $0xc558fcc5                           // vaddps	%ymm5, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0x0479e3c4; WORD $0x4ec1             // vpermilps	$78, %xmm1, %xmm0
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x087c6162; WORD $0xd028             // vmovaps	%xmm0, %xmm26
+	LONG $0xc0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm0
+	LONG $0x002e6162; WORD $0xd058             // vaddss	%xmm0, %xmm26, %xmm26
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_7
+	WORD $0x8949; BYTE $0xd0                   // movq	%rdx, %r8
+	WORD $0x8949; BYTE $0xc3                   // movq	%rax, %r11
+	WORD $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG $0xff788d49                           // leaq	-1(%r8), %rdi
+	LONG $0x06ff8348                           // cmpq	$6, %rdi
+	JBE  BB0_8
+	QUAD $0x00000000850c8d4c                   // leaq	0(,%rax,4), %r9
+	LONG $0x0e1c8d4a                           // leaq	(%rsi,%r9), %rbx
+	LONG $0x09648d4e; BYTE $0x04               // leaq	4(%rcx,%r9), %r12
+	WORD $0x8949; BYTE $0xda                   // movq	%rbx, %r10
+	WORD $0x294d; BYTE $0xe2                   // subq	%r12, %r10
+	LONG $0x38fa8349                           // cmpq	$56, %r10
+	JA   BB0_75
+
+BB0_8:
+	VMOVSS CPI0_64<>(SB), X4  // vmovss	.LCPI0_64(%rip), %xmm4
+	VMOVSD CPI0_27<>(SB), X12 // vmovsd	.LCPI0_27(%rip), %xmm12
+	VMOVQ  CPI0_86<>(SB), X11 // vmovq	.LCPI0_86(%rip), %xmm11
+	VMOVQ  CPI0_87<>(SB), X10 // vmovq	.LCPI0_87(%rip), %xmm10
+	VMOVSD CPI0_33<>(SB), X9  // vmovsd	.LCPI0_33(%rip), %xmm9
+	VMOVSD CPI0_35<>(SB), X8  // vmovsd	.LCPI0_35(%rip), %xmm8
+	VMOVSD CPI0_37<>(SB), X7  // vmovsd	.LCPI0_37(%rip), %xmm7
+	VMOVSD CPI0_39<>(SB), X6  // vmovsd	.LCPI0_39(%rip), %xmm6
+	VMOVSD CPI0_41<>(SB), X5  // vmovsd	.LCPI0_41(%rip), %xmm5
+
+BB0_22:
+	LONG        $0x0c10fac5; BYTE $0x81               // vmovss	(%rcx,%rax,4), %xmm1
+	VMOVSS      CPI0_0<>(SB), X0                      // vmovss	.LCPI0_0(%rip), %xmm0
+	LONG        $0xca5cf2c5                           // vsubss	%xmm2, %xmm1, %xmm1
+	VCOMISS     CPI0_62<>(SB), X1                     // vcomiss	.LCPI0_62(%rip), %xmm1
+	JA          BB0_21
+	LONG        $0xe12ff8c5                           // vcomiss	%xmm1, %xmm4
+	LONG        $0xc057f8c5                           // vxorps	%xmm0, %xmm0, %xmm0
+	JA          BB0_21
+	LONG        $0xc95af2c5                           // vcvtss2sd	%xmm1, %xmm1, %xmm1
+	LONG        $0x5973c1c4; BYTE $0xdc               // vmulsd	%xmm12, %xmm1, %xmm3
+	LONG        $0xd02979c5                           // vmovapd	%xmm10, %xmm0
+	VMOVSD      CPI0_59<>(SB), X13                    // vmovsd	.LCPI0_59(%rip), %xmm13
+	LONG        $0x08e5d362; WORD $0xc325; BYTE $0xf8 // vpternlogq	$248, %xmm11, %xmm3, %xmm0
+	LONG        $0xd858e3c5                           // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG        $0x08e5f362; WORD $0xdb0b; BYTE $0x03 // vrndscalesd	$3, %xmm3, %xmm3, %xmm3
+	LONG        $0xbde1c2c4; BYTE $0xc9               // vfnmadd231sd	%xmm9, %xmm3, %xmm1
+	LONG        $0x2cfbe1c4; BYTE $0xfb               // vcvttsd2siq	%xmm3, %rdi
+	LONG        $0xffc78148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rdi
+	LONG        $0xbde1c2c4; BYTE $0xc8               // vfnmadd231sd	%xmm8, %xmm3, %xmm1
+	LONG        $0x34e7c148                           // salq	$52, %rdi
+	LONG        $0x6ef9e1c4; BYTE $0xdf               // vmovq	%rdi, %xmm3
+	LONG        $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG        $0x99c9e2c4; BYTE $0xc7               // vfmadd132sd	%xmm7, %xmm6, %xmm0
+	LONG        $0x99d1e2c4; BYTE $0xc1               // vfmadd132sd	%xmm1, %xmm5, %xmm0
+	VFMADD213SD CPI0_43<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_43(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_45<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_45(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_47<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_47(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_49<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_49(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_51<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_51(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_53<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_53(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_55<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_55(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_57<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_57(%rip), %xmm1, %xmm0
+	LONG        $0x9991e2c4; BYTE $0xc1               // vfmadd132sd	%xmm1, %xmm13, %xmm0
+	LONG        $0x9991e2c4; BYTE $0xc1               // vfmadd132sd	%xmm1, %xmm13, %xmm0
+	LONG        $0xc359fbc5                           // vmulsd	%xmm3, %xmm0, %xmm0
+	LONG        $0xc05afbc5                           // vcvtsd2ss	%xmm0, %xmm0, %xmm0
+
+BB0_21:
+	LONG $0x0411fac5; BYTE $0x86   // vmovss	%xmm0, (%rsi,%rax,4)
+	LONG $0x01c08348               // addq	$1, %rax
+	LONG $0x002e6162; WORD $0xd058 // vaddss	%xmm0, %xmm26, %xmm26
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JNE  BB0_22
+
+BB0_73:
+	VMOVSS CPI0_23<>(SB), X0         // vmovss	.LCPI0_23(%rip), %xmm0
+	LONG   $0x087e0162; WORD $0xd25e // vdivss	%xmm26, %xmm0, %xmm26
+	LONG   $0x487d9262; WORD $0xca18 // vbroadcastss	%xmm26, %zmm1
+	LONG   $0x0ffa8348               // cmpq	$15, %rdx
+	JLE    BB0_13
+
+BB0_12:
+	LONG $0xf04a8d48             // leaq	-16(%rdx), %rcx
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	LONG $0x04e9c148             // shrq	$4, %rcx
+	WORD $0x8948; BYTE $0xcf     // movq	%rcx, %rdi
+	LONG $0x06e7c148             // salq	$6, %rdi
+	LONG $0x3e7c8d48; BYTE $0x40 // leaq	64(%rsi,%rdi), %rdi
+
+BB0_25:
+	LONG $0x4874f162; WORD $0x0059             // vmulps	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xc7                   // cmpq	%rax, %rdi
+	JNE  BB0_25
+	LONG $0x01c18348                           // addq	$1, %rcx
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	LONG $0x04e0c148                           // salq	$4, %rax
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_66
+	WORD $0x8948; BYTE $0xd7                   // movq	%rdx, %rdi
+	WORD $0x8949; BYTE $0xc0                   // movq	%rax, %r8
+	WORD $0x2948; BYTE $0xc7                   // subq	%rax, %rdi
+	LONG $0xff4f8d4c                           // leaq	-1(%rdi), %r9
+	LONG $0x0ef98349                           // cmpq	$14, %r9
+	JBE  BB0_36
+	LONG $0x06e1c148                           // salq	$6, %rcx
+	WORD $0x8949; BYTE $0xf9                   // movq	%rdi, %r9
+	WORD $0x0148; BYTE $0xf1                   // addq	%rsi, %rcx
+	LONG $0xf0e18349                           // andq	$-16, %r9
+	LONG $0x4874f162; WORD $0x0959             // vmulps	(%rcx), %zmm1, %zmm1
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+	LONG $0x487cf162; WORD $0x0911             // vmovups	%zmm1, (%rcx)
+	LONG $0x0fc7f640                           // testb	$15, %dil
+	JE   BB0_66
+
+BB0_23:
+	WORD $0x8948; BYTE $0xf9       // movq	%rdi, %rcx
+	WORD $0x294c; BYTE $0xc9       // subq	%r9, %rcx
+	LONG $0xff798d48               // leaq	-1(%rcx), %rdi
+	LONG $0x06ff8348               // cmpq	$6, %rdi
+	JBE  BB0_27
+	LONG $0x083c8d4b               // leaq	(%r8,%r9), %rdi
+	LONG $0x287d9262; WORD $0xc218 // vbroadcastss	%xmm26, %ymm0
+	LONG $0xbe3c8d48               // leaq	(%rsi,%rdi,4), %rdi
+	LONG $0x0759fcc5               // vmulps	(%rdi), %ymm0, %ymm0
+	LONG $0x0711fcc5               // vmovups	%ymm0, (%rdi)
+	WORD $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	LONG $0xf8e78348               // andq	$-8, %rdi
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+	WORD $0xe183; BYTE $0x07       // andl	$7, %ecx
+	JE   BB0_66
+
+BB0_27:
+	QUAD $0x00000000850c8d48       // leaq	0(,%rax,4), %rcx
+	LONG $0x0e3c8d48               // leaq	(%rsi,%rcx), %rdi
+	LONG $0x002ef162; WORD $0x0759 // vmulss	(%rdi), %xmm26, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	WORD $0x3948; BYTE $0xfa       // cmpq	%rdi, %rdx
+	JLE  BB0_66
+	LONG $0x0e7c8d48; BYTE $0x04   // leaq	4(%rsi,%rcx), %rdi
+	LONG $0x002ef162; WORD $0x0759 // vmulss	(%rdi), %xmm26, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x02788d48               // leaq	2(%rax), %rdi
+	WORD $0x3948; BYTE $0xfa       // cmpq	%rdi, %rdx
+	JLE  BB0_66
+	LONG $0x0e7c8d48; BYTE $0x08   // leaq	8(%rsi,%rcx), %rdi
+	LONG $0x002ef162; WORD $0x0759 // vmulss	(%rdi), %xmm26, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x03788d48               // leaq	3(%rax), %rdi
+	WORD $0x3948; BYTE $0xfa       // cmpq	%rdi, %rdx
+	JLE  BB0_66
+	LONG $0x0e7c8d48; BYTE $0x0c   // leaq	12(%rsi,%rcx), %rdi
+	LONG $0x002ef162; WORD $0x0759 // vmulss	(%rdi), %xmm26, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x04788d48               // leaq	4(%rax), %rdi
+	WORD $0x3948; BYTE $0xfa       // cmpq	%rdi, %rdx
+	JLE  BB0_66
+	LONG $0x0e7c8d48; BYTE $0x10   // leaq	16(%rsi,%rcx), %rdi
+	LONG $0x002ef162; WORD $0x0759 // vmulss	(%rdi), %xmm26, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x05788d48               // leaq	5(%rax), %rdi
+	WORD $0x3948; BYTE $0xfa       // cmpq	%rdi, %rdx
+	JLE  BB0_66
+	LONG $0x0e7c8d48; BYTE $0x14   // leaq	20(%rsi,%rcx), %rdi
+	LONG $0x06c08348               // addq	$6, %rax
+	LONG $0x002ef162; WORD $0x0759 // vmulss	(%rdi), %xmm26, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_66
+	LONG $0x0e448d48; BYTE $0x18   // leaq	24(%rsi,%rcx), %rax
+	LONG $0x002e6162; WORD $0x1059 // vmulss	(%rax), %xmm26, %xmm26
+	LONG $0x087e6162; WORD $0x1011 // vmovss	%xmm26, (%rax)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_75:
+	LONG         $0x0eff8348               // cmpq	$14, %rdi
+	JBE          BB0_32
+	WORD         $0x894d; BYTE $0xc2       // movq	%r8, %r10
+	LONG         $0x03ffbc41; WORD $0x0000 // movl	$1023, %r12d
+	WORD         $0x0149; BYTE $0xc9       // addq	%rcx, %r9
+	WORD         $0xff31                   // xorl	%edi, %edi
+	LONG         $0x04eac149               // shrq	$4, %r10
+	LONG         $0x487de262; WORD $0xfa18 // vbroadcastss	%xmm2, %zmm23
+	VBROADCASTSS CPI0_0<>(SB), Z3          // vbroadcastss	.LCPI0_0(%rip), %zmm3
+	VBROADCASTSD CPI0_27<>(SB), Z21        // vbroadcastsd	.LCPI0_27(%rip), %zmm21
+	VBROADCASTSD CPI0_87<>(SB), Z20        // vbroadcastsd	.LCPI0_87(%rip), %zmm20
+	LONG         $0x06e2c149               // salq	$6, %r10
+	VBROADCASTSD CPI0_86<>(SB), Z19        // vbroadcastsd	.LCPI0_86(%rip), %zmm19
+	LONG         $0x48fdd262; WORD $0xe47c // vpbroadcastq	%r12, %zmm4
+	VBROADCASTSD CPI0_33<>(SB), Z18        // vbroadcastsd	.LCPI0_33(%rip), %zmm18
+	VBROADCASTSD CPI0_35<>(SB), Z17        // vbroadcastsd	.LCPI0_35(%rip), %zmm17
+	VBROADCASTSD CPI0_37<>(SB), Z16        // vbroadcastsd	.LCPI0_37(%rip), %zmm16
+	VBROADCASTSD CPI0_39<>(SB), Z15        // vbroadcastsd	.LCPI0_39(%rip), %zmm15
+	VBROADCASTSD CPI0_41<>(SB), Z14        // vbroadcastsd	.LCPI0_41(%rip), %zmm14
+	VBROADCASTSD CPI0_43<>(SB), Z13        // vbroadcastsd	.LCPI0_43(%rip), %zmm13
+	VBROADCASTSD CPI0_45<>(SB), Z12        // vbroadcastsd	.LCPI0_45(%rip), %zmm12
+	VBROADCASTSD CPI0_47<>(SB), Z11        // vbroadcastsd	.LCPI0_47(%rip), %zmm11
+	VBROADCASTSD CPI0_49<>(SB), Z10        // vbroadcastsd	.LCPI0_49(%rip), %zmm10
+	VBROADCASTSD CPI0_51<>(SB), Z9         // vbroadcastsd	.LCPI0_51(%rip), %zmm9
+	VBROADCASTSD CPI0_53<>(SB), Z8         // vbroadcastsd	.LCPI0_53(%rip), %zmm8
+	VBROADCASTSD CPI0_55<>(SB), Z7         // vbroadcastsd	.LCPI0_55(%rip), %zmm7
+	VBROADCASTSD CPI0_57<>(SB), Z6         // vbroadcastsd	.LCPI0_57(%rip), %zmm6
+	VBROADCASTSD CPI0_59<>(SB), Z1         // vbroadcastsd	.LCPI0_59(%rip), %zmm1
+	VBROADCASTSS CPI0_62<>(SB), Z5         // vbroadcastss	.LCPI0_62(%rip), %zmm5
+	VBROADCASTSS CPI0_64<>(SB), Z22        // vbroadcastss	.LCPI0_64(%rip), %zmm22
+
+BB0_10:
+	LONG $0x487cd162; WORD $0x0410; BYTE $0x39 // vmovups	(%r9,%rdi), %zmm0
+	LONG $0x487c2162; WORD $0xf75c             // vsubps	%zmm23, %zmm0, %zmm30
+	LONG $0x48fdb162; WORD $0xc428             // vmovapd	%zmm20, %zmm0
+	LONG $0x487c0162; WORD $0xe65a             // vcvtps2pd	%ymm30, %zmm28
+	LONG $0x409d2162; WORD $0xcd59             // vmulpd	%zmm21, %zmm28, %zmm25
+	LONG $0x487d0362; WORD $0xf31b; BYTE $0x01 // vextractf32x8	$0x1, %zmm30, %ymm27
+	LONG $0x487c0162; WORD $0xdb5a             // vcvtps2pd	%ymm27, %zmm27
+	LONG $0x40a52162; WORD $0xed59             // vmulpd	%zmm21, %zmm27, %zmm29
+	LONG $0x400cb162; WORD $0xcec2; BYTE $0x05 // vcmpps	$5, %zmm22, %zmm30, %k1
+	LONG $0x48549162; WORD $0xd6c2; BYTE $0x01 // vcmpps	$1, %zmm30, %zmm5, %k2
+	LONG $0x410cf162; WORD $0xcdc2; BYTE $0x0a // vcmpps	$10, %zmm5, %zmm30, %k1{%k1}
+	LONG $0x40b5b362; WORD $0xc325; BYTE $0xf8 // vpternlogq	$248, %zmm19, %zmm25, %zmm0
+	LONG $0x40b56162; WORD $0xc858             // vaddpd	%zmm0, %zmm25, %zmm25
+	LONG $0x48fdb162; WORD $0xc428             // vmovapd	%zmm20, %zmm0
+	LONG $0x4095b362; WORD $0xc325; BYTE $0xf8 // vpternlogq	$248, %zmm19, %zmm29, %zmm0
+	LONG $0x40956162; WORD $0xe858             // vaddpd	%zmm0, %zmm29, %zmm29
+	LONG $0x48fd0362; WORD $0xc909; BYTE $0x03 // vrndscalepd	$3, %zmm25, %zmm25
+	LONG $0x48fd0362; WORD $0xed09; BYTE $0x03 // vrndscalepd	$3, %zmm29, %zmm29
+	LONG $0x40b52262; WORD $0xe2bc             // vfnmadd231pd	%zmm18, %zmm25, %zmm28
+	LONG $0x40952262; WORD $0xdabc             // vfnmadd231pd	%zmm18, %zmm29, %zmm27
+	LONG $0x40b52262; WORD $0xe1bc             // vfnmadd231pd	%zmm17, %zmm25, %zmm28
+	LONG $0x48fd0162; WORD $0xc97a             // vcvttpd2qq	%zmm25, %zmm25
+	LONG $0x40b56162; WORD $0xccd4             // vpaddq	%zmm4, %zmm25, %zmm25
+	LONG $0x40b59162; WORD $0xf173; BYTE $0x34 // vpsllq	$52, %zmm25, %zmm25
+	LONG $0x40952262; WORD $0xd9bc             // vfnmadd231pd	%zmm17, %zmm29, %zmm27
+	LONG $0x48fd0162; WORD $0xed7a             // vcvttpd2qq	%zmm29, %zmm29
+	LONG $0x40956162; WORD $0xecd4             // vpaddq	%zmm4, %zmm29, %zmm29
+	LONG $0x40959162; WORD $0xf573; BYTE $0x34 // vpsllq	$52, %zmm29, %zmm29
+	LONG $0x48fd0162; WORD $0xc428             // vmovapd	%zmm28, %zmm24
+	LONG $0x48852262; WORD $0xc098             // vfmadd132pd	%zmm16, %zmm15, %zmm24
+	LONG $0x48fd9162; WORD $0xc328             // vmovapd	%zmm27, %zmm0
+	LONG $0x4885b262; WORD $0xc098             // vfmadd132pd	%zmm16, %zmm15, %zmm0
+	LONG $0x488d0262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm14, %zmm24
+	LONG $0x488d9262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm14, %zmm0
+	LONG $0x48950262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm13, %zmm24
+	LONG $0x48959262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm13, %zmm0
+	LONG $0x489d0262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm12, %zmm24
+	LONG $0x489d9262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm12, %zmm0
+	LONG $0x48a50262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm11, %zmm24
+	LONG $0x48a59262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm11, %zmm0
+	LONG $0x48ad0262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm10, %zmm24
+	LONG $0x48ad9262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm10, %zmm0
+	LONG $0x48b50262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm9, %zmm24
+	LONG $0x48b59262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm9, %zmm0
+	LONG $0x48bd0262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm8, %zmm24
+	LONG $0x48bd9262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm8, %zmm0
+	LONG $0x48c50262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm7, %zmm24
+	LONG $0x48c59262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm7, %zmm0
+	LONG $0x48cd0262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm6, %zmm24
+	LONG $0x48cd9262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm6, %zmm0
+	LONG $0x48f50262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm1, %zmm24
+	LONG $0x48f59262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm1, %zmm0
+	LONG $0x48f50262; WORD $0xc498             // vfmadd132pd	%zmm28, %zmm1, %zmm24
+	LONG $0x48f59262; WORD $0xc398             // vfmadd132pd	%zmm27, %zmm1, %zmm0
+	LONG $0x40bd0162; WORD $0xc959             // vmulpd	%zmm25, %zmm24, %zmm25
+	LONG $0xca7c6162; WORD $0xc328             // vmovaps	%zmm3, %zmm24{%k2}{z}
+	LONG $0x48fd9162; WORD $0xc559             // vmulpd	%zmm29, %zmm0, %zmm0
+	LONG $0x48fd0162; WORD $0xc95a             // vcvtpd2ps	%zmm25, %ymm25
+	LONG $0x48fdf162; WORD $0xc05a             // vcvtpd2ps	%zmm0, %ymm0
+	LONG $0x40356362; WORD $0xc81a; BYTE $0x01 // vinsertf32x8	$0x1, %ymm0, %zmm25, %zmm25
+	LONG $0x497c0162; WORD $0xc128             // vmovaps	%zmm25, %zmm24{%k1}
+	LONG $0x003c0162; WORD $0xd8c6; BYTE $0xff // vshufps	$255, %xmm24, %xmm24, %xmm27
+	LONG $0x203d0362; WORD $0xc803; BYTE $0x07 // valignd	$7, %ymm24, %ymm24, %ymm25
+	LONG $0x002e9162; WORD $0xc058             // vaddss	%xmm24, %xmm26, %xmm0
+	LONG $0x003c0162; WORD $0xd0c6; BYTE $0x55 // vshufps	$85, %xmm24, %xmm24, %xmm26
+	LONG $0x487c6162; WORD $0x0411; BYTE $0x3b // vmovups	%zmm24, (%rbx,%rdi)
+	LONG $0x40c78348                           // addq	$64, %rdi
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x003c0162; WORD $0xd015             // vunpckhps	%xmm24, %xmm24, %xmm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x287d0362; WORD $0xc219; BYTE $0x01 // vextractf32x4	$1, %ymm24, %xmm26
+	LONG $0x087e9162; WORD $0xc358             // vaddss	%xmm27, %xmm0, %xmm0
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x203d0362; WORD $0xd003; BYTE $0x05 // valignd	$5, %ymm24, %ymm24, %ymm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x203d0362; WORD $0xd003; BYTE $0x06 // valignd	$6, %ymm24, %ymm24, %ymm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x487d0362; WORD $0xc21b; BYTE $0x01 // vextractf32x8	$0x1, %zmm24, %ymm26
+	LONG $0x002c0162; WORD $0xc2c6; BYTE $0xff // vshufps	$255, %xmm26, %xmm26, %xmm24
+	LONG $0x087e9162; WORD $0xc158             // vaddss	%xmm25, %xmm0, %xmm0
+	LONG $0x002c0162; WORD $0xcac6; BYTE $0x55 // vshufps	$85, %xmm26, %xmm26, %xmm25
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x087e9162; WORD $0xc158             // vaddss	%xmm25, %xmm0, %xmm0
+	LONG $0x002c0162; WORD $0xca15             // vunpckhps	%xmm26, %xmm26, %xmm25
+	LONG $0x087e9162; WORD $0xc158             // vaddss	%xmm25, %xmm0, %xmm0
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x287d0362; WORD $0xd019; BYTE $0x01 // vextractf32x4	$1, %ymm26, %xmm24
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x202d0362; WORD $0xc203; BYTE $0x05 // valignd	$5, %ymm26, %ymm26, %ymm24
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x202d0362; WORD $0xc203; BYTE $0x06 // valignd	$6, %ymm26, %ymm26, %ymm24
+	LONG $0x202d0362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm26, %ymm26, %ymm26
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x087e0162; WORD $0xd258             // vaddss	%xmm26, %xmm0, %xmm26
+	WORD $0x3949; BYTE $0xfa                   // cmpq	%rdi, %r10
+	JNE  BB0_10
+	WORD $0x894c; BYTE $0xc7                   // movq	%r8, %rdi
+	LONG $0xf0e78348                           // andq	$-16, %rdi
+	WORD $0x0148; BYTE $0xf8                   // addq	%rdi, %rax
+	LONG $0x0fc0f641                           // testb	$15, %r8b
+	JE   BB0_73
+	WORD $0x2949; BYTE $0xf8                   // subq	%rdi, %r8
+	LONG $0xff488d4d                           // leaq	-1(%r8), %r9
+	LONG $0x06f98349                           // cmpq	$6, %r9
+	JBE  BB0_15
+
+BB0_9:
+	WORD         $0x014c; BYTE $0xdf                   // addq	%r11, %rdi
+	LONG         $0x187de2c4; BYTE $0xc2               // vbroadcastss	%xmm2, %ymm0
+	VBROADCASTSD CPI0_27<>(SB), Y6                     // vbroadcastsd	.LCPI0_27(%rip), %ymm6
+	VBROADCASTSD CPI0_87<>(SB), Y1                     // vbroadcastsd	.LCPI0_87(%rip), %ymm1
+	LONG         $0x3c10fcc5; BYTE $0xb9               // vmovups	(%rcx,%rdi,4), %ymm7
+	LONG         $0x03ffb941; WORD $0x0000             // movl	$1023, %r9d
+	VBROADCASTSD CPI0_86<>(SB), Y5                     // vbroadcastsd	.LCPI0_86(%rip), %ymm5
+	LONG         $0xc1287dc5                           // vmovapd	%ymm1, %ymm8
+	LONG         $0xe05cc4c5                           // vsubps	%ymm0, %ymm7, %ymm4
+	LONG         $0xc45afcc5                           // vcvtps2pd	%xmm4, %ymm0
+	LONG         $0xfe59fdc5                           // vmulpd	%ymm6, %ymm0, %ymm7
+	LONG         $0x197de3c4; WORD $0x01e3             // vextractf128	$0x1, %ymm4, %xmm3
+	LONG         $0xdb5afcc5                           // vcvtps2pd	%xmm3, %ymm3
+	LONG         $0xf659e5c5                           // vmulpd	%ymm6, %ymm3, %ymm6
+	LONG         $0x28c57362; WORD $0xc525; BYTE $0xf8 // vpternlogq	$248, %ymm5, %ymm7, %ymm8
+	LONG         $0x28cdf362; WORD $0xcd25; BYTE $0xf8 // vpternlogq	$248, %ymm5, %ymm6, %ymm1
+	LONG         $0x5845c1c4; BYTE $0xf8               // vaddpd	%ymm8, %ymm7, %ymm7
+	VBROADCASTSD CPI0_35<>(SB), Y5                     // vbroadcastsd	.LCPI0_35(%rip), %ymm5
+	VBROADCASTSD CPI0_39<>(SB), Y8                     // vbroadcastsd	.LCPI0_39(%rip), %ymm8
+	LONG         $0xf158cdc5                           // vaddpd	%ymm1, %ymm6, %ymm6
+	VBROADCASTSD CPI0_33<>(SB), Y1                     // vbroadcastsd	.LCPI0_33(%rip), %ymm1
+	LONG         $0x28fdf362; WORD $0xff09; BYTE $0x03 // vrndscalepd	$3, %ymm7, %ymm7
+	LONG         $0x28fdf362; WORD $0xf609; BYTE $0x03 // vrndscalepd	$3, %ymm6, %ymm6
+	LONG         $0xbcc5e2c4; BYTE $0xc1               // vfnmadd231pd	%ymm1, %ymm7, %ymm0
+	LONG         $0x9ce5e2c4; BYTE $0xce               // vfnmadd132pd	%ymm6, %ymm3, %ymm1
+	LONG         $0xbcc5e2c4; BYTE $0xc5               // vfnmadd231pd	%ymm5, %ymm7, %ymm0
+	LONG         $0x28fdf162; WORD $0xff7a             // vcvttpd2qq	%ymm7, %ymm7
+	LONG         $0x9cf5e2c4; BYTE $0xee               // vfnmadd132pd	%ymm6, %ymm1, %ymm5
+	LONG         $0x28fdf162; WORD $0xf67a             // vcvttpd2qq	%ymm6, %ymm6
+	VBROADCASTSD CPI0_37<>(SB), Y1                     // vbroadcastsd	.LCPI0_37(%rip), %ymm1
+	LONG         $0xd828fdc5                           // vmovapd	%ymm0, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xd9               // vfmadd132pd	%ymm1, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xcd               // vfmadd132pd	%ymm5, %ymm8, %ymm1
+	VBROADCASTSD CPI0_41<>(SB), Y8                     // vbroadcastsd	.LCPI0_41(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xcd               // vfmadd132pd	%ymm5, %ymm8, %ymm1
+	VBROADCASTSD CPI0_43<>(SB), Y8                     // vbroadcastsd	.LCPI0_43(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xcd               // vfmadd132pd	%ymm5, %ymm8, %ymm1
+	VBROADCASTSD CPI0_45<>(SB), Y8                     // vbroadcastsd	.LCPI0_45(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xcd               // vfmadd132pd	%ymm5, %ymm8, %ymm1
+	VBROADCASTSD CPI0_47<>(SB), Y8                     // vbroadcastsd	.LCPI0_47(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xcd               // vfmadd132pd	%ymm5, %ymm8, %ymm1
+	VBROADCASTSD CPI0_49<>(SB), Y8                     // vbroadcastsd	.LCPI0_49(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xcd               // vfmadd132pd	%ymm5, %ymm8, %ymm1
+	VBROADCASTSD CPI0_51<>(SB), Y8                     // vbroadcastsd	.LCPI0_51(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xcd               // vfmadd132pd	%ymm5, %ymm8, %ymm1
+	VBROADCASTSD CPI0_53<>(SB), Y8                     // vbroadcastsd	.LCPI0_53(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xcd               // vfmadd132pd	%ymm5, %ymm8, %ymm1
+	VBROADCASTSD CPI0_55<>(SB), Y8                     // vbroadcastsd	.LCPI0_55(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xcd               // vfmadd132pd	%ymm5, %ymm8, %ymm1
+	VBROADCASTSD CPI0_57<>(SB), Y8                     // vbroadcastsd	.LCPI0_57(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xcd               // vfmadd132pd	%ymm5, %ymm8, %ymm1
+	VBROADCASTSD CPI0_59<>(SB), Y8                     // vbroadcastsd	.LCPI0_59(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xd8               // vfmadd132pd	%ymm0, %ymm8, %ymm3
+	LONG         $0x98bde2c4; BYTE $0xcd               // vfmadd132pd	%ymm5, %ymm8, %ymm1
+	LONG         $0x98bde2c4; BYTE $0xc3               // vfmadd132pd	%ymm3, %ymm8, %ymm0
+	LONG         $0x98bde2c4; BYTE $0xe9               // vfmadd132pd	%ymm1, %ymm8, %ymm5
+	LONG         $0x28fdd262; WORD $0xc97c             // vpbroadcastq	%r9, %ymm1
+	VBROADCASTSS CPI0_64<>(SB), Y3                     // vbroadcastss	.LCPI0_64(%rip), %ymm3
+	LONG         $0xf9d4c5c5                           // vpaddq	%ymm1, %ymm7, %ymm7
+	LONG         $0xf1d4cdc5                           // vpaddq	%ymm1, %ymm6, %ymm6
+	VBROADCASTSS CPI0_62<>(SB), Y1                     // vbroadcastss	.LCPI0_62(%rip), %ymm1
+	LONG         $0x285cf162; WORD $0xcbc2; BYTE $0x05 // vcmpps	$5, %ymm3, %ymm4, %k1
+	LONG         $0xf773c5c5; BYTE $0x34               // vpsllq	$52, %ymm7, %ymm7
+	VBROADCASTSS CPI0_0<>(SB), Y3                      // vbroadcastss	.LCPI0_0(%rip), %ymm3
+	LONG         $0xf673cdc5; BYTE $0x34               // vpsllq	$52, %ymm6, %ymm6
+	LONG         $0xc759fdc5                           // vmulpd	%ymm7, %ymm0, %ymm0
+	LONG         $0x295cf162; WORD $0xc9c2; BYTE $0x0a // vcmpps	$10, %ymm1, %ymm4, %k1{%k1}
+	LONG         $0xee59d5c5                           // vmulpd	%ymm6, %ymm5, %ymm5
+	LONG         $0xccc2f4c5; BYTE $0x01               // vcmpltps	%ymm4, %ymm1, %ymm1
+	LONG         $0xcb54f4c5                           // vandps	%ymm3, %ymm1, %ymm1
+	LONG         $0xc05afdc5                           // vcvtpd2psy	%ymm0, %xmm0
+	LONG         $0xed5afdc5                           // vcvtpd2psy	%ymm5, %xmm5
+	LONG         $0x187de3c4; WORD $0x01c5             // vinsertf128	$0x1, %xmm5, %ymm0, %ymm0
+	LONG         $0x2975f262; WORD $0xc065             // vblendmps	%ymm0, %ymm1, %ymm0{%k1}
+	LONG         $0x002ef162; WORD $0xc858             // vaddss	%xmm0, %xmm26, %xmm1
+	LONG         $0xe0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm4
+	LONG         $0xd8c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm3
+	LONG         $0x0411fcc5; BYTE $0xbe               // vmovups	%ymm0, (%rsi,%rdi,4)
+	WORD         $0x894c; BYTE $0xc7                   // movq	%r8, %rdi
+	LONG         $0xf8e78348                           // andq	$-8, %rdi
+	LONG         $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG         $0xe015f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm4
+	WORD         $0x0148; BYTE $0xf8                   // addq	%rdi, %rax
+	LONG         $0x07e08341                           // andl	$7, %r8d
+	LONG         $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG         $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG         $0x287df362; WORD $0xc319; BYTE $0x01 // vextractf32x4	$1, %ymm0, %xmm3
+	LONG         $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG         $0x287df362; WORD $0xd803; BYTE $0x05 // valignd	$5, %ymm0, %ymm0, %ymm3
+	LONG         $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG         $0x287df362; WORD $0xd803; BYTE $0x06 // valignd	$6, %ymm0, %ymm0, %ymm3
+	LONG         $0x287df362; WORD $0xc003; BYTE $0x07 // valignd	$7, %ymm0, %ymm0, %ymm0
+	LONG         $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG         $0x08766162; WORD $0xd058             // vaddss	%xmm0, %xmm1, %xmm26
+	JE           BB0_73
+
+BB0_15:
+	VMOVSS CPI0_64<>(SB), X4  // vmovss	.LCPI0_64(%rip), %xmm4
+	VMOVSD CPI0_27<>(SB), X12 // vmovsd	.LCPI0_27(%rip), %xmm12
+	VMOVQ  CPI0_86<>(SB), X11 // vmovq	.LCPI0_86(%rip), %xmm11
+	VMOVQ  CPI0_87<>(SB), X10 // vmovq	.LCPI0_87(%rip), %xmm10
+	VMOVSD CPI0_33<>(SB), X9  // vmovsd	.LCPI0_33(%rip), %xmm9
+	VMOVSD CPI0_35<>(SB), X8  // vmovsd	.LCPI0_35(%rip), %xmm8
+	VMOVSD CPI0_37<>(SB), X7  // vmovsd	.LCPI0_37(%rip), %xmm7
+	VMOVSD CPI0_39<>(SB), X6  // vmovsd	.LCPI0_39(%rip), %xmm6
+	VMOVSD CPI0_41<>(SB), X5  // vmovsd	.LCPI0_41(%rip), %xmm5
+
+BB0_19:
+	LONG        $0x0410fac5; BYTE $0x81               // vmovss	(%rcx,%rax,4), %xmm0
+	VMOVSS      CPI0_0<>(SB), X1                      // vmovss	.LCPI0_0(%rip), %xmm1
+	LONG        $0xc25cfac5                           // vsubss	%xmm2, %xmm0, %xmm0
+	VCOMISS     CPI0_62<>(SB), X0                     // vcomiss	.LCPI0_62(%rip), %xmm0
+	JA          BB0_20
+	LONG        $0xe02ff8c5                           // vcomiss	%xmm0, %xmm4
+	LONG        $0xc957f0c5                           // vxorps	%xmm1, %xmm1, %xmm1
+	JA          BB0_20
+	LONG        $0xc05afac5                           // vcvtss2sd	%xmm0, %xmm0, %xmm0
+	LONG        $0x597bc1c4; BYTE $0xdc               // vmulsd	%xmm12, %xmm0, %xmm3
+	LONG        $0xd12979c5                           // vmovapd	%xmm10, %xmm1
+	VMOVSD      CPI0_59<>(SB), X13                    // vmovsd	.LCPI0_59(%rip), %xmm13
+	LONG        $0x08e5d362; WORD $0xcb25; BYTE $0xf8 // vpternlogq	$248, %xmm11, %xmm3, %xmm1
+	LONG        $0xd958e3c5                           // vaddsd	%xmm1, %xmm3, %xmm3
+	LONG        $0x08e5f362; WORD $0xdb0b; BYTE $0x03 // vrndscalesd	$3, %xmm3, %xmm3, %xmm3
+	LONG        $0xbde1c2c4; BYTE $0xc1               // vfnmadd231sd	%xmm9, %xmm3, %xmm0
+	LONG        $0x2cfbe1c4; BYTE $0xfb               // vcvttsd2siq	%xmm3, %rdi
+	LONG        $0xffc78148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rdi
+	LONG        $0xbde1c2c4; BYTE $0xc0               // vfnmadd231sd	%xmm8, %xmm3, %xmm0
+	LONG        $0x34e7c148                           // salq	$52, %rdi
+	LONG        $0x6ef9e1c4; BYTE $0xdf               // vmovq	%rdi, %xmm3
+	LONG        $0xc810fbc5                           // vmovsd	%xmm0, %xmm0, %xmm1
+	LONG        $0x99c9e2c4; BYTE $0xcf               // vfmadd132sd	%xmm7, %xmm6, %xmm1
+	LONG        $0x99d1e2c4; BYTE $0xc8               // vfmadd132sd	%xmm0, %xmm5, %xmm1
+	VFMADD213SD CPI0_43<>(SB), X0, X1                 // vfmadd213sd	.LCPI0_43(%rip), %xmm0, %xmm1
+	VFMADD213SD CPI0_45<>(SB), X0, X1                 // vfmadd213sd	.LCPI0_45(%rip), %xmm0, %xmm1
+	VFMADD213SD CPI0_47<>(SB), X0, X1                 // vfmadd213sd	.LCPI0_47(%rip), %xmm0, %xmm1
+	VFMADD213SD CPI0_49<>(SB), X0, X1                 // vfmadd213sd	.LCPI0_49(%rip), %xmm0, %xmm1
+	VFMADD213SD CPI0_51<>(SB), X0, X1                 // vfmadd213sd	.LCPI0_51(%rip), %xmm0, %xmm1
+	VFMADD213SD CPI0_53<>(SB), X0, X1                 // vfmadd213sd	.LCPI0_53(%rip), %xmm0, %xmm1
+	VFMADD213SD CPI0_55<>(SB), X0, X1                 // vfmadd213sd	.LCPI0_55(%rip), %xmm0, %xmm1
+	VFMADD213SD CPI0_57<>(SB), X0, X1                 // vfmadd213sd	.LCPI0_57(%rip), %xmm0, %xmm1
+	LONG        $0x9991e2c4; BYTE $0xc8               // vfmadd132sd	%xmm0, %xmm13, %xmm1
+	LONG        $0x9991e2c4; BYTE $0xc1               // vfmadd132sd	%xmm1, %xmm13, %xmm0
+	LONG        $0xc359fbc5                           // vmulsd	%xmm3, %xmm0, %xmm0
+	LONG        $0xc85afbc5                           // vcvtsd2ss	%xmm0, %xmm0, %xmm1
+
+BB0_20:
+	LONG $0x0c11fac5; BYTE $0x86   // vmovss	%xmm1, (%rsi,%rax,4)
+	LONG $0x01c08348               // addq	$1, %rax
+	LONG $0x002e6162; WORD $0xd158 // vaddss	%xmm1, %xmm26, %xmm26
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JG   BB0_19
+	JMP  BB0_73
+
+BB0_7:
+	VMOVSS CPI0_23<>(SB), X0         // vmovss	.LCPI0_23(%rip), %xmm0
+	LONG   $0x087e0162; WORD $0xd25e // vdivss	%xmm26, %xmm0, %xmm26
+	LONG   $0x487d9262; WORD $0xca18 // vbroadcastss	%xmm26, %zmm1
+	LONG   $0x0ffa8348               // cmpq	$15, %rdx
+	JG     BB0_12
+	WORD   $0x8548; BYTE $0xd2       // testq	%rdx, %rdx
+	JG     BB0_13
+
+BB0_66:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_69:
+	RET
+
+BB0_31:
+	LONG $0xed57d1c5 // vxorpd	%xmm5, %xmm5, %xmm5
+	WORD $0xc031     // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_13:
+	WORD $0x8948; BYTE $0xd7 // movq	%rdx, %rdi
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_23
+
+BB0_32:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_9
+
+BB0_36:
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	JMP  BB0_23
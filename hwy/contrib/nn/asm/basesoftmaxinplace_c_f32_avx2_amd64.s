@@ -0,0 +1,388 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basesoftmaxinplace_c_f32_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_11<>+0(SB)/4, $0xb95e8083
+GLOBL CPI0_11<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_13<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_13<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_14<>+0(SB)/4, $0x3c088889
+DATA CPI0_14<>+4(SB)/4, $0x3c088889
+DATA CPI0_14<>+8(SB)/4, $0x3c088889
+DATA CPI0_14<>+12(SB)/4, $0x3c088889
+DATA CPI0_14<>+16(SB)/4, $0x3c088889
+DATA CPI0_14<>+20(SB)/4, $0x3c088889
+DATA CPI0_14<>+24(SB)/4, $0x3c088889
+DATA CPI0_14<>+28(SB)/4, $0x3c088889
+GLOBL CPI0_14<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_16<>+0(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+4(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+8(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+12(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+16(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+20(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+24(SB)/4, $0x3d2aaaab
+DATA CPI0_16<>+28(SB)/4, $0x3d2aaaab
+GLOBL CPI0_16<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_18<>+0(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+4(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+8(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+12(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+16(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+20(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+24(SB)/4, $0x3e2aaaab
+DATA CPI0_18<>+28(SB)/4, $0x3e2aaaab
+GLOBL CPI0_18<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_20<>+0(SB)/4, $0x3f000000
+DATA CPI0_20<>+4(SB)/4, $0x3f000000
+DATA CPI0_20<>+8(SB)/4, $0x3f000000
+DATA CPI0_20<>+12(SB)/4, $0x3f000000
+DATA CPI0_20<>+16(SB)/4, $0x3f000000
+DATA CPI0_20<>+20(SB)/4, $0x3f000000
+DATA CPI0_20<>+24(SB)/4, $0x3f000000
+DATA CPI0_20<>+28(SB)/4, $0x3f000000
+GLOBL CPI0_20<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_23<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_23<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_25<>+0(SB)/4, $0x7f800000
+DATA CPI0_25<>+4(SB)/4, $0x7f800000
+DATA CPI0_25<>+8(SB)/4, $0x7f800000
+DATA CPI0_25<>+12(SB)/4, $0x7f800000
+DATA CPI0_25<>+16(SB)/4, $0x7f800000
+DATA CPI0_25<>+20(SB)/4, $0x7f800000
+DATA CPI0_25<>+24(SB)/4, $0x7f800000
+DATA CPI0_25<>+28(SB)/4, $0x7f800000
+GLOBL CPI0_25<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_26<>+0(SB)/4, $0x44314000
+GLOBL CPI0_26<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_27<>+0(SB)/4, $0xc4314000
+GLOBL CPI0_27<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_28<>+0(SB)/4, $0x652b82fe
+DATA CPI0_28<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_28<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_29<>+0(SB)/4, $0x00000000
+DATA CPI0_29<>+4(SB)/4, $0x80000000
+DATA CPI0_29<>+8(SB)/4, $0x00000000
+DATA CPI0_29<>+12(SB)/4, $0x00000000
+GLOBL CPI0_29<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_3<>+0(SB)/4, $0x42b17218
+GLOBL CPI0_3<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_30<>+0(SB)/4, $0xffffffff
+DATA CPI0_30<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_30<>+8(SB)/4, $0x00000000
+DATA CPI0_30<>+12(SB)/4, $0x00000000
+GLOBL CPI0_30<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_31<>+0(SB)/4, $0xfee00000
+DATA CPI0_31<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_31<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_32<>+0(SB)/4, $0x35793c6c
+DATA CPI0_32<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_32<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_33<>+0(SB)/4, $0xeff8d898
+DATA CPI0_33<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_33<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_34<>+0(SB)/4, $0x67f544e4
+DATA CPI0_34<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_34<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_35<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_35<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_35<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_36<>+0(SB)/4, $0xa556c734
+DATA CPI0_36<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_36<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_37<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_37<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_37<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_38<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_38<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_38<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_39<>+0(SB)/4, $0x16c16c17
+DATA CPI0_39<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_39<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_40<>+0(SB)/4, $0x11111111
+DATA CPI0_40<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_40<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_41<>+0(SB)/4, $0x55555555
+DATA CPI0_41<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_41<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_42<>+0(SB)/4, $0x55555555
+DATA CPI0_42<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_42<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_43<>+0(SB)/4, $0x00000000
+DATA CPI0_43<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_43<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_44<>+0(SB)/4, $0x00000000
+DATA CPI0_44<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_44<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_5<>+0(SB)/4, $0xc2aeac50
+GLOBL CPI0_5<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_7<>+0(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_7<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_9<>+0(SB)/4, $0x3f318000
+GLOBL CPI0_9<>(SB), (RODATA|NOPTR), $4
+
+TEXT ·softmaxinplace_c_f32_avx2(SB), $64-16
+	MOVQ x+0(FP), DI
+	MOVQ plen_x+8(FP), SI
+	WORD $0x8b48; BYTE $0x0e     // movq	(%rsi), %rcx
+	WORD $0x8548; BYTE $0xc9     // testq	%rcx, %rcx
+	JE   BB0_44
+	WORD $0x8948; BYTE $0xfa     // movq	%rdi, %rdx
+	LONG $0x246c8d48; BYTE $0x30 // leaq	48(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348             // andq	$-32, %rsp
+	LONG $0x2710fac5             // vmovss	(%rdi), %xmm4
+	LONG $0x01f98348             // cmpq	$1, %rcx
+	JLE  BB0_21
+	QUAD $0x000000008d348d48     // leaq	0(,%rcx,4), %rsi
+	LONG $0x047f8d48             // leaq	4(%rdi), %rdi
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	LONG $0x32048d4c             // leaq	(%rdx,%rsi), %r8
+
+BB0_5:
+	LONG         $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG         $0x04c78348               // addq	$4, %rdi
+	LONG         $0xe45ffac5               // vmaxss	%xmm4, %xmm0, %xmm4
+	WORD         $0x394c; BYTE $0xc7       // cmpq	%r8, %rdi
+	JNE          BB0_5
+	LONG         $0x187d62c4; BYTE $0xc4   // vbroadcastss	%xmm4, %ymm8
+	LONG         $0x07f98348               // cmpq	$7, %rcx
+	JLE          BB0_6
+	LONG         $0xf8798d48               // leaq	-8(%rcx), %rdi
+	LONG         $0x007fb841; WORD $0x0000 // movl	$127, %r8d
+	VBROADCASTSS CPI0_3<>(SB), Y15         // vbroadcastss	.LCPI0_3(%rip), %ymm15
+	VBROADCASTSS CPI0_5<>(SB), Y14         // vbroadcastss	.LCPI0_5(%rip), %ymm14
+	LONG         $0x6e79c1c4; BYTE $0xf8   // vmovd	%r8d, %xmm7
+	LONG         $0x03efc148               // shrq	$3, %rdi
+	LONG         $0xed57d0c5               // vxorps	%xmm5, %xmm5, %xmm5
+	LONG         $0xef3141c4; BYTE $0xc9   // vpxor	%xmm9, %xmm9, %xmm9
+	WORD         $0x8948; BYTE $0xfe       // movq	%rdi, %rsi
+	LONG         $0x587de2c4; BYTE $0xff   // vpbroadcastd	%xmm7, %ymm7
+	VBROADCASTSS CPI0_7<>(SB), Y13         // vbroadcastss	.LCPI0_7(%rip), %ymm13
+	VBROADCASTSS CPI0_9<>(SB), Y12         // vbroadcastss	.LCPI0_9(%rip), %ymm12
+	LONG         $0x05e6c148               // salq	$5, %rsi
+	LONG         $0x3c7ffdc5; BYTE $0x24   // vmovdqa	%ymm7, (%rsp)
+	VBROADCASTSS CPI0_11<>(SB), Y11        // vbroadcastss	.LCPI0_11(%rip), %ymm11
+	VBROADCASTSS CPI0_13<>(SB), Y10        // vbroadcastss	.LCPI0_13(%rip), %ymm10
+	VBROADCASTSS CPI0_23<>(SB), Y6         // vbroadcastss	.LCPI0_23(%rip), %ymm6
+	LONG         $0x32748d48; BYTE $0x20   // leaq	32(%rdx,%rsi), %rsi
+
+BB0_7:
+	LONG        $0x3810fcc5               // vmovups	(%rax), %ymm7
+	LONG        $0xd0297cc5               // vmovaps	%ymm10, %ymm0
+	LONG        $0x20c08348               // addq	$32, %rax
+	LONG        $0x5c44c1c4; BYTE $0xc8   // vsubps	%ymm8, %ymm7, %ymm1
+	LONG        $0x5974c1c4; BYTE $0xd5   // vmulps	%ymm13, %ymm1, %ymm2
+	LONG        $0xc274c1c4; WORD $0x1eff // vcmpps	$30, %ymm15, %ymm1, %ymm7
+	LONG        $0xc274c1c4; WORD $0x11de // vcmpps	$17, %ymm14, %ymm1, %ymm3
+	LONG        $0xdb66b5c5               // vpcmpgtd	%ymm3, %ymm9, %ymm3
+	LONG        $0x087de3c4; WORD $0x08d2 // vroundps	$8, %ymm2, %ymm2
+	LONG        $0xbc6dc2c4; BYTE $0xcc   // vfnmadd231ps	%ymm12, %ymm2, %ymm1
+	LONG        $0xbc6dc2c4; BYTE $0xcb   // vfnmadd231ps	%ymm11, %ymm2, %ymm1
+	LONG        $0xd25bfdc5               // vcvtps2dq	%ymm2, %ymm2
+	LONG        $0x14feedc5; BYTE $0x24   // vpaddd	(%rsp), %ymm2, %ymm2
+	VFMADD213PS CPI0_14<>(SB), Y1, Y0     // vfmadd213ps	.LCPI0_14(%rip), %ymm1, %ymm0
+	VFMADD213PS CPI0_16<>(SB), Y1, Y0     // vfmadd213ps	.LCPI0_16(%rip), %ymm1, %ymm0
+	LONG        $0xf272edc5; BYTE $0x17   // vpslld	$23, %ymm2, %ymm2
+	VFMADD213PS CPI0_18<>(SB), Y1, Y0     // vfmadd213ps	.LCPI0_18(%rip), %ymm1, %ymm0
+	VFMADD213PS CPI0_20<>(SB), Y1, Y0     // vfmadd213ps	.LCPI0_20(%rip), %ymm1, %ymm0
+	LONG        $0x984de2c4; BYTE $0xc1   // vfmadd132ps	%ymm1, %ymm6, %ymm0
+	LONG        $0x984de2c4; BYTE $0xc1   // vfmadd132ps	%ymm1, %ymm6, %ymm0
+	LONG        $0xc259fcc5               // vmulps	%ymm2, %ymm0, %ymm0
+	VBLENDVPS   Y7, CPI0_25<>(SB), Y0, Y0 // vblendvps	%ymm7, .LCPI0_25(%rip), %ymm0, %ymm0
+	LONG        $0xd855e4c5               // vandnps	%ymm0, %ymm3, %ymm3
+	LONG        $0x5811fcc5; BYTE $0xe0   // vmovups	%ymm3, -32(%rax)
+	LONG        $0xeb58d4c5               // vaddps	%ymm3, %ymm5, %ymm5
+	WORD        $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JNE         BB0_7
+	QUAD        $0x00000008fd048d48       // leaq	8(,%rdi,8), %rax
+
+BB0_3:
+	LONG $0x197de3c4; WORD $0x01e9 // vextractf128	$0x1, %ymm5, %xmm1
+	LONG $0xcd58f0c5               // vaddps	%xmm5, %xmm1, %xmm1
+	LONG $0xc112f0c5               // vmovhlps	%xmm1, %xmm1, %xmm0
+	LONG $0xc858f0c5               // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc116fac5               // vmovshdup	%xmm1, %xmm0
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_8
+	QUAD $0x000000008d348d48       // leaq	0(,%rcx,4), %rsi
+
+BB0_20:
+	VMOVSS CPI0_25<>(SB), X2   // vmovss	.LCPI0_25(%rip), %xmm2
+	VMOVSS CPI0_27<>(SB), X3   // vmovss	.LCPI0_27(%rip), %xmm3
+	LONG   $0x82048d48         // leaq	(%rdx,%rax,4), %rax
+	WORD   $0x0148; BYTE $0xd6 // addq	%rdx, %rsi
+	VMOVSD CPI0_28<>(SB), X12  // vmovsd	.LCPI0_28(%rip), %xmm12
+	VMOVQ  CPI0_29<>(SB), X11  // vmovq	.LCPI0_29(%rip), %xmm11
+	VMOVQ  CPI0_30<>(SB), X10  // vmovq	.LCPI0_30(%rip), %xmm10
+	VMOVSD CPI0_31<>(SB), X9   // vmovsd	.LCPI0_31(%rip), %xmm9
+	VMOVSD CPI0_32<>(SB), X8   // vmovsd	.LCPI0_32(%rip), %xmm8
+	VMOVSD CPI0_33<>(SB), X7   // vmovsd	.LCPI0_33(%rip), %xmm7
+	VMOVSD CPI0_34<>(SB), X6   // vmovsd	.LCPI0_34(%rip), %xmm6
+	VMOVSD CPI0_35<>(SB), X5   // vmovsd	.LCPI0_35(%rip), %xmm5
+
+BB0_10:
+	LONG        $0x28107ac5                           // vmovss	(%rax), %xmm13
+	LONG        $0xc228f8c5                           // vmovaps	%xmm2, %xmm0
+	LONG        $0xec5c12c5                           // vsubss	%xmm4, %xmm13, %xmm13
+	VCOMISS     CPI0_26<>(SB), X13                    // vcomiss	.LCPI0_26(%rip), %xmm13
+	JA          BB0_9
+	LONG        $0x2f78c1c4; BYTE $0xdd               // vcomiss	%xmm13, %xmm3
+	LONG        $0xc057f8c5                           // vxorps	%xmm0, %xmm0, %xmm0
+	JA          BB0_9
+	LONG        $0x5a1241c4; BYTE $0xed               // vcvtss2sd	%xmm13, %xmm13, %xmm13
+	LONG        $0x591341c4; BYTE $0xf4               // vmulsd	%xmm12, %xmm13, %xmm14
+	VMOVSD      CPI0_44<>(SB), X15                    // vmovsd	.LCPI0_44(%rip), %xmm15
+	LONG        $0x5421c1c4; BYTE $0xc6               // vandpd	%xmm14, %xmm11, %xmm0
+	LONG        $0xc056a9c5                           // vorpd	%xmm0, %xmm10, %xmm0
+	LONG        $0xf0580bc5                           // vaddsd	%xmm0, %xmm14, %xmm14
+	LONG        $0x0b0943c4; WORD $0x03f6             // vroundsd	$3, %xmm14, %xmm14, %xmm14
+	LONG        $0xbd8942c4; BYTE $0xe9               // vfnmadd231sd	%xmm9, %xmm14, %xmm13
+	LONG        $0x2cfbc1c4; BYTE $0xfe               // vcvttsd2siq	%xmm14, %rdi
+	LONG        $0xffc78148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rdi
+	LONG        $0xbd8942c4; BYTE $0xe8               // vfnmadd231sd	%xmm8, %xmm14, %xmm13
+	LONG        $0x34e7c148                           // salq	$52, %rdi
+	LONG        $0xe81113c5                           // vmovsd	%xmm13, %xmm13, %xmm0
+	LONG        $0x99c9e2c4; BYTE $0xc7               // vfmadd132sd	%xmm7, %xmm6, %xmm0
+	LONG        $0x99d1c2c4; BYTE $0xc5               // vfmadd132sd	%xmm13, %xmm5, %xmm0
+	VFMADD213SD CPI0_36<>(SB), X13, X0                // vfmadd213sd	.LCPI0_36(%rip), %xmm13, %xmm0
+	VFMADD213SD CPI0_37<>(SB), X13, X0                // vfmadd213sd	.LCPI0_37(%rip), %xmm13, %xmm0
+	VFMADD213SD CPI0_38<>(SB), X13, X0                // vfmadd213sd	.LCPI0_38(%rip), %xmm13, %xmm0
+	VFMADD213SD CPI0_39<>(SB), X13, X0                // vfmadd213sd	.LCPI0_39(%rip), %xmm13, %xmm0
+	VFMADD213SD CPI0_40<>(SB), X13, X0                // vfmadd213sd	.LCPI0_40(%rip), %xmm13, %xmm0
+	VFMADD213SD CPI0_41<>(SB), X13, X0                // vfmadd213sd	.LCPI0_41(%rip), %xmm13, %xmm0
+	VFMADD213SD CPI0_42<>(SB), X13, X0                // vfmadd213sd	.LCPI0_42(%rip), %xmm13, %xmm0
+	VFMADD213SD CPI0_43<>(SB), X13, X0                // vfmadd213sd	.LCPI0_43(%rip), %xmm13, %xmm0
+	LONG        $0x9981c2c4; BYTE $0xc5               // vfmadd132sd	%xmm13, %xmm15, %xmm0
+	LONG        $0x9981c2c4; BYTE $0xc5               // vfmadd132sd	%xmm13, %xmm15, %xmm0
+	LONG        $0x6ef961c4; BYTE $0xff               // vmovq	%rdi, %xmm15
+	LONG        $0x597bc1c4; BYTE $0xc7               // vmulsd	%xmm15, %xmm0, %xmm0
+	LONG        $0xc05afbc5                           // vcvtsd2ss	%xmm0, %xmm0, %xmm0
+
+BB0_9:
+	LONG   $0x0011fac5             // vmovss	%xmm0, (%rax)
+	LONG   $0x04c08348             // addq	$4, %rax
+	LONG   $0xc858f2c5             // vaddss	%xmm0, %xmm1, %xmm1
+	WORD   $0x3948; BYTE $0xf0     // cmpq	%rsi, %rax
+	JNE    BB0_10
+	VMOVSS CPI0_23<>(SB), X2       // vmovss	.LCPI0_23(%rip), %xmm2
+	LONG   $0xd15eeac5             // vdivss	%xmm1, %xmm2, %xmm2
+	LONG   $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG   $0x07f98348             // cmpq	$7, %rcx
+	JLE    BB0_19
+
+BB0_12:
+	LONG $0xf8718d48             // leaq	-8(%rcx), %rsi
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	LONG $0x03eec148             // shrq	$3, %rsi
+	WORD $0x8948; BYTE $0xf7     // movq	%rsi, %rdi
+	LONG $0x05e7c148             // salq	$5, %rdi
+	LONG $0x3a7c8d48; BYTE $0x20 // leaq	32(%rdx,%rdi), %rdi
+
+BB0_15:
+	LONG $0x0059f4c5             // vmulps	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fcc5; BYTE $0xe0 // vmovups	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xf8     // cmpq	%rdi, %rax
+	JNE  BB0_15
+	LONG $0x01c68348             // addq	$1, %rsi
+	QUAD $0x00000000f53c8d48     // leaq	0(,%rsi,8), %rdi
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_41
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	WORD $0x8949; BYTE $0xf8     // movq	%rdi, %r8
+	WORD $0x2948; BYTE $0xf8     // subq	%rdi, %rax
+	LONG $0xff488d4c             // leaq	-1(%rax), %r9
+	LONG $0x06f98349             // cmpq	$6, %r9
+	JBE  BB0_25
+	LONG $0x05e6c148             // salq	$5, %rsi
+	WORD $0x0148; BYTE $0xd6     // addq	%rdx, %rsi
+	LONG $0x0e59f4c5             // vmulps	(%rsi), %ymm1, %ymm1
+	LONG $0x0e11fcc5             // vmovups	%ymm1, (%rsi)
+	WORD $0x8948; BYTE $0xc6     // movq	%rax, %rsi
+	LONG $0xf8e68348             // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf7     // addq	%rsi, %rdi
+	WORD $0x07a8                 // testb	$7, %al
+	JE   BB0_41
+
+BB0_14:
+	WORD $0x2948; BYTE $0xf0     // subq	%rsi, %rax
+	LONG $0xff488d4c             // leaq	-1(%rax), %r9
+	LONG $0x02f98349             // cmpq	$2, %r9
+	JBE  BB0_17
+	WORD $0x014c; BYTE $0xc6     // addq	%r8, %rsi
+	LONG $0xc2c6e8c5; BYTE $0x00 // vshufps	$0, %xmm2, %xmm2, %xmm0
+	LONG $0xb2348d48             // leaq	(%rdx,%rsi,4), %rsi
+	LONG $0x0659f8c5             // vmulps	(%rsi), %xmm0, %xmm0
+	LONG $0x0611f8c5             // vmovups	%xmm0, (%rsi)
+	WORD $0x03a8                 // testb	$3, %al
+	JE   BB0_41
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc7     // addq	%rax, %rdi
+
+BB0_17:
+	QUAD $0x00000000bd048d48     // leaq	0(,%rdi,4), %rax
+	LONG $0x02348d48             // leaq	(%rdx,%rax), %rsi
+	LONG $0x0659eac5             // vmulss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5             // vmovss	%xmm0, (%rsi)
+	LONG $0x01778d48             // leaq	1(%rdi), %rsi
+	WORD $0x3948; BYTE $0xf1     // cmpq	%rsi, %rcx
+	JLE  BB0_41
+	LONG $0x02748d48; BYTE $0x04 // leaq	4(%rdx,%rax), %rsi
+	LONG $0x02c78348             // addq	$2, %rdi
+	LONG $0x0659eac5             // vmulss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5             // vmovss	%xmm0, (%rsi)
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_41
+	LONG $0x02448d48; BYTE $0x08 // leaq	8(%rdx,%rax), %rax
+	LONG $0x1059eac5             // vmulss	(%rax), %xmm2, %xmm2
+	LONG $0x1011fac5             // vmovss	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0xd0658d48             // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_8:
+	VMOVSS CPI0_23<>(SB), X2       // vmovss	.LCPI0_23(%rip), %xmm2
+	LONG   $0xd15eeac5             // vdivss	%xmm1, %xmm2, %xmm2
+	LONG   $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG   $0x07f98348             // cmpq	$7, %rcx
+	JG     BB0_12
+	WORD   $0x8548; BYTE $0xc9     // testq	%rcx, %rcx
+	JG     BB0_19
+
+BB0_41:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	LONG $0xd0658d48         // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_44:
+	RET
+
+BB0_21:
+	LONG $0xed57d0c5 // vxorps	%xmm5, %xmm5, %xmm5
+	WORD $0xc031     // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_19:
+	WORD $0x8948; BYTE $0xc8 // movq	%rcx, %rax
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	WORD $0xf631             // xorl	%esi, %esi
+	WORD $0xff31             // xorl	%edi, %edi
+	JMP  BB0_14
+
+BB0_6:
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0xc031     // xorl	%eax, %eax
+	JMP  BB0_20
+
+BB0_25:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_14
@@ -0,0 +1,625 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basesoftmaxinplace_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x7f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_11<>+0(SB)/4, $0xb95e8083
+GLOBL CPI0_11<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_13<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_13<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_15<>+0(SB)/4, $0x3c088889
+GLOBL CPI0_15<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_17<>+0(SB)/4, $0x3d2aaaab
+GLOBL CPI0_17<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_19<>+0(SB)/4, $0x3e2aaaab
+GLOBL CPI0_19<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_21<>+0(SB)/4, $0x3f000000
+GLOBL CPI0_21<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_23<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_23<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_27<>+0(SB)/4, $0x652b82fe
+DATA CPI0_27<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_27<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_3<>+0(SB)/4, $0x42b17218
+GLOBL CPI0_3<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_33<>+0(SB)/4, $0xfee00000
+DATA CPI0_33<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_33<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_35<>+0(SB)/4, $0x35793c6c
+DATA CPI0_35<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_35<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_37<>+0(SB)/4, $0xeff8d898
+DATA CPI0_37<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_37<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_39<>+0(SB)/4, $0x67f544e4
+DATA CPI0_39<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_39<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_41<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_41<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_41<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_43<>+0(SB)/4, $0xa556c734
+DATA CPI0_43<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_43<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_45<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_45<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_45<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_47<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_47<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_47<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_49<>+0(SB)/4, $0x16c16c17
+DATA CPI0_49<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_49<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_5<>+0(SB)/4, $0xc2aeac50
+GLOBL CPI0_5<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_51<>+0(SB)/4, $0x11111111
+DATA CPI0_51<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_51<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_53<>+0(SB)/4, $0x55555555
+DATA CPI0_53<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_53<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_55<>+0(SB)/4, $0x55555555
+DATA CPI0_55<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_55<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_57<>+0(SB)/4, $0x00000000
+DATA CPI0_57<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_57<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_59<>+0(SB)/4, $0x00000000
+DATA CPI0_59<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_59<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_62<>+0(SB)/4, $0x44314000
+GLOBL CPI0_62<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_64<>+0(SB)/4, $0xc4314000
+GLOBL CPI0_64<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_7<>+0(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_7<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_86<>+0(SB)/4, $0x00000000
+DATA CPI0_86<>+4(SB)/4, $0x80000000
+DATA CPI0_86<>+8(SB)/4, $0x00000000
+DATA CPI0_86<>+12(SB)/4, $0x00000000
+GLOBL CPI0_86<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_87<>+0(SB)/4, $0xffffffff
+DATA CPI0_87<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_87<>+8(SB)/4, $0x00000000
+DATA CPI0_87<>+12(SB)/4, $0x00000000
+GLOBL CPI0_87<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_9<>+0(SB)/4, $0x3f318000
+GLOBL CPI0_9<>(SB), (RODATA|NOPTR), $4
+
+TEXT ·softmaxinplace_c_f32_avx512(SB), $0-16
+	MOVQ x+0(FP), DI
+	MOVQ plen_x+8(FP), SI
+	WORD $0x8b48; BYTE $0x0e // movq	(%rsi), %rcx
+	WORD $0x8948; BYTE $0xfa // movq	%rdi, %rdx
+	WORD $0x8548; BYTE $0xc9 // testq	%rcx, %rcx
+	JE   BB0_61
+	LONG $0x0f10fac5         // vmovss	(%rdi), %xmm1
+	LONG $0x01f98348         // cmpq	$1, %rcx
+	JLE  BB0_28
+	LONG $0x04478d48         // leaq	4(%rdi), %rax
+	WORD $0x8948; BYTE $0xfe // movq	%rdi, %rsi
+	LONG $0x8f3c8d48         // leaq	(%rdi,%rcx,4), %rdi
+
+BB0_5:
+	LONG         $0x0010fac5               // vmovss	(%rax), %xmm0
+	LONG         $0x04c08348               // addq	$4, %rax
+	LONG         $0xc95ffac5               // vmaxss	%xmm1, %xmm0, %xmm1
+	WORD         $0x3948; BYTE $0xc7       // cmpq	%rax, %rdi
+	JNE          BB0_5
+	LONG         $0x487d7262; WORD $0xc118 // vbroadcastss	%xmm1, %zmm8
+	LONG         $0x0ff98348               // cmpq	$15, %rcx
+	JLE          BB0_28
+	LONG         $0xf0418d48               // leaq	-16(%rcx), %rax
+	LONG         $0xed57d0c5               // vxorps	%xmm5, %xmm5, %xmm5
+	LONG         $0x007fb841; WORD $0x0000 // movl	$127, %r8d
+	VBROADCASTSS CPI0_3<>(SB), Z19         // vbroadcastss	.LCPI0_3(%rip), %zmm19
+	LONG         $0x04e8c148               // shrq	$4, %rax
+	LONG         $0x487dd262; WORD $0xf87c // vpbroadcastd	%r8d, %zmm7
+	VBROADCASTSS CPI0_5<>(SB), Z18         // vbroadcastss	.LCPI0_5(%rip), %zmm18
+	VBROADCASTSS CPI0_7<>(SB), Z17         // vbroadcastss	.LCPI0_7(%rip), %zmm17
+	WORD         $0x8948; BYTE $0xc7       // movq	%rax, %rdi
+	LONG         $0x487c7162; WORD $0xcd28 // vmovaps	%zmm5, %zmm9
+	VBROADCASTSS CPI0_9<>(SB), Z16         // vbroadcastss	.LCPI0_9(%rip), %zmm16
+	VBROADCASTSS CPI0_11<>(SB), Z15        // vbroadcastss	.LCPI0_11(%rip), %zmm15
+	VBROADCASTSS CPI0_13<>(SB), Z14        // vbroadcastss	.LCPI0_13(%rip), %zmm14
+	LONG         $0x06e7c148               // salq	$6, %rdi
+	VBROADCASTSS CPI0_15<>(SB), Z13        // vbroadcastss	.LCPI0_15(%rip), %zmm13
+	VBROADCASTSS CPI0_17<>(SB), Z12        // vbroadcastss	.LCPI0_17(%rip), %zmm12
+	LONG         $0x3a7c8d48; BYTE $0x40   // leaq	64(%rdx,%rdi), %rdi
+	VBROADCASTSS CPI0_19<>(SB), Z11        // vbroadcastss	.LCPI0_19(%rip), %zmm11
+	VBROADCASTSS CPI0_21<>(SB), Z10        // vbroadcastss	.LCPI0_21(%rip), %zmm10
+	VBROADCASTSS CPI0_23<>(SB), Z6         // vbroadcastss	.LCPI0_23(%rip), %zmm6
+	VBROADCASTSS CPI0_0<>(SB), Z3          // vbroadcastss	.LCPI0_0(%rip), %zmm3
+
+BB0_6:
+	LONG $0x487cf162; WORD $0x2610             // vmovups	(%rsi), %zmm4
+	LONG $0x487cd162; WORD $0xc628             // vmovaps	%zmm14, %zmm0
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0x485cd162; WORD $0xd05c             // vsubps	%zmm8, %zmm4, %zmm2
+	LONG $0x486cb162; WORD $0xe159             // vmulps	%zmm17, %zmm2, %zmm4
+	LONG $0x486cb162; WORD $0xd3c2; BYTE $0x1e // vcmpps	$30, %zmm19, %zmm2, %k2
+	LONG $0x486cb162; WORD $0xcac2; BYTE $0x11 // vcmpps	$17, %zmm18, %zmm2, %k1
+	LONG $0x487df362; WORD $0xe408; BYTE $0x08 // vrndscaleps	$8, %zmm4, %zmm4
+	LONG $0x485db262; WORD $0xd0bc             // vfnmadd231ps	%zmm16, %zmm4, %zmm2
+	LONG $0x485dd262; WORD $0xd7bc             // vfnmadd231ps	%zmm15, %zmm4, %zmm2
+	LONG $0x487df162; WORD $0xe45b             // vcvtps2dq	%zmm4, %zmm4
+	LONG $0x485df162; WORD $0xe7fe             // vpaddd	%zmm7, %zmm4, %zmm4
+	LONG $0x485df162; WORD $0xf472; BYTE $0x17 // vpslld	$23, %zmm4, %zmm4
+	LONG $0x4815f262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm13, %zmm0
+	LONG $0x481df262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm12, %zmm0
+	LONG $0x4825f262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm11, %zmm0
+	LONG $0x482df262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm10, %zmm0
+	LONG $0x484df262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm6, %zmm0
+	LONG $0x484df262; WORD $0xc298             // vfmadd132ps	%zmm2, %zmm6, %zmm0
+	LONG $0x487cf162; WORD $0xc459             // vmulps	%zmm4, %zmm0, %zmm0
+	LONG $0x4a7cf162; WORD $0xc328             // vmovaps	%zmm3, %zmm0{%k2}
+	LONG $0x497cd162; WORD $0xc128             // vmovaps	%zmm9, %zmm0{%k1}
+	LONG $0x487cf162; WORD $0x4611; BYTE $0xff // vmovups	%zmm0, -64(%rsi)
+	LONG $0x4854f162; WORD $0xe858             // vaddps	%zmm0, %zmm5, %zmm5
+	WORD $0x3948; BYTE $0xfe                   // cmpq	%rdi, %rsi
+	JNE  BB0_6
+	LONG $0x01c08348                           // addq	$1, %rax
+	LONG $0x04e0c148                           // salq	$4, %rax
+
+BB0_3:
+	LONG         $0x48fdf362; WORD $0xe81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm0
+	LONG         $0xc558fcc5                           // vaddps	%ymm5, %ymm0, %ymm0
+	LONG         $0x197de3c4; WORD $0x01c2             // vextractf128	$0x1, %ymm0, %xmm2
+	LONG         $0xd058e8c5                           // vaddps	%xmm0, %xmm2, %xmm2
+	LONG         $0x0479e3c4; WORD $0x4ec2             // vpermilps	$78, %xmm2, %xmm0
+	LONG         $0xc258f8c5                           // vaddps	%xmm2, %xmm0, %xmm0
+	LONG         $0x087c6162; WORD $0xd028             // vmovaps	%xmm0, %xmm26
+	LONG         $0xc0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm0
+	LONG         $0x002e6162; WORD $0xd058             // vaddss	%xmm0, %xmm26, %xmm26
+	WORD         $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE          BB0_7
+	WORD         $0x8948; BYTE $0xcf                   // movq	%rcx, %rdi
+	WORD         $0x8949; BYTE $0xc1                   // movq	%rax, %r9
+	WORD         $0x2948; BYTE $0xc7                   // subq	%rax, %rdi
+	LONG         $0xff778d48                           // leaq	-1(%rdi), %rsi
+	LONG         $0x0efe8348                           // cmpq	$14, %rsi
+	JBE          BB0_29
+	WORD         $0x8949; BYTE $0xf8                   // movq	%rdi, %r8
+	LONG         $0x82348d48                           // leaq	(%rdx,%rax,4), %rsi
+	LONG         $0x03ffba41; WORD $0x0000             // movl	$1023, %r10d
+	VBROADCASTSS CPI0_0<>(SB), Z3                      // vbroadcastss	.LCPI0_0(%rip), %zmm3
+	LONG         $0x04e8c149                           // shrq	$4, %r8
+	LONG         $0x487de262; WORD $0xf918             // vbroadcastss	%xmm1, %zmm23
+	VBROADCASTSD CPI0_27<>(SB), Z21                    // vbroadcastsd	.LCPI0_27(%rip), %zmm21
+	VBROADCASTSD CPI0_87<>(SB), Z20                    // vbroadcastsd	.LCPI0_87(%rip), %zmm20
+	LONG         $0x06e0c149                           // salq	$6, %r8
+	LONG         $0x48fdd262; WORD $0xe27c             // vpbroadcastq	%r10, %zmm4
+	VBROADCASTSD CPI0_86<>(SB), Z19                    // vbroadcastsd	.LCPI0_86(%rip), %zmm19
+	VBROADCASTSD CPI0_33<>(SB), Z18                    // vbroadcastsd	.LCPI0_33(%rip), %zmm18
+	VBROADCASTSD CPI0_35<>(SB), Z17                    // vbroadcastsd	.LCPI0_35(%rip), %zmm17
+	WORD         $0x0149; BYTE $0xf0                   // addq	%rsi, %r8
+	VBROADCASTSD CPI0_37<>(SB), Z16                    // vbroadcastsd	.LCPI0_37(%rip), %zmm16
+	VBROADCASTSD CPI0_39<>(SB), Z15                    // vbroadcastsd	.LCPI0_39(%rip), %zmm15
+	VBROADCASTSD CPI0_41<>(SB), Z14                    // vbroadcastsd	.LCPI0_41(%rip), %zmm14
+	VBROADCASTSD CPI0_43<>(SB), Z13                    // vbroadcastsd	.LCPI0_43(%rip), %zmm13
+	VBROADCASTSD CPI0_45<>(SB), Z12                    // vbroadcastsd	.LCPI0_45(%rip), %zmm12
+	VBROADCASTSD CPI0_47<>(SB), Z11                    // vbroadcastsd	.LCPI0_47(%rip), %zmm11
+	VBROADCASTSD CPI0_49<>(SB), Z10                    // vbroadcastsd	.LCPI0_49(%rip), %zmm10
+	VBROADCASTSD CPI0_51<>(SB), Z9                     // vbroadcastsd	.LCPI0_51(%rip), %zmm9
+	VBROADCASTSD CPI0_53<>(SB), Z8                     // vbroadcastsd	.LCPI0_53(%rip), %zmm8
+	VBROADCASTSD CPI0_55<>(SB), Z7                     // vbroadcastsd	.LCPI0_55(%rip), %zmm7
+	VBROADCASTSD CPI0_57<>(SB), Z6                     // vbroadcastsd	.LCPI0_57(%rip), %zmm6
+	VBROADCASTSD CPI0_59<>(SB), Z2                     // vbroadcastsd	.LCPI0_59(%rip), %zmm2
+	VBROADCASTSS CPI0_62<>(SB), Z5                     // vbroadcastss	.LCPI0_62(%rip), %zmm5
+	VBROADCASTSS CPI0_64<>(SB), Z22                    // vbroadcastss	.LCPI0_64(%rip), %zmm22
+
+BB0_9:
+	LONG $0x487cf162; WORD $0x0610             // vmovups	(%rsi), %zmm0
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0x487c2162; WORD $0xef5c             // vsubps	%zmm23, %zmm0, %zmm29
+	LONG $0x48fdb162; WORD $0xc428             // vmovapd	%zmm20, %zmm0
+	LONG $0x487c0162; WORD $0xf55a             // vcvtps2pd	%ymm29, %zmm30
+	LONG $0x408d2162; WORD $0xe559             // vmulpd	%zmm21, %zmm30, %zmm28
+	LONG $0x487d0362; WORD $0xe91b; BYTE $0x01 // vextractf32x8	$0x1, %zmm29, %ymm25
+	LONG $0x487c0162; WORD $0xc95a             // vcvtps2pd	%ymm25, %zmm25
+	LONG $0x40b52162; WORD $0xdd59             // vmulpd	%zmm21, %zmm25, %zmm27
+	LONG $0x4014b162; WORD $0xcec2; BYTE $0x05 // vcmpps	$5, %zmm22, %zmm29, %k1
+	LONG $0x48549162; WORD $0xd5c2; BYTE $0x01 // vcmpps	$1, %zmm29, %zmm5, %k2
+	LONG $0x4114f162; WORD $0xcdc2; BYTE $0x0a // vcmpps	$10, %zmm5, %zmm29, %k1{%k1}
+	LONG $0x409db362; WORD $0xc325; BYTE $0xf8 // vpternlogq	$248, %zmm19, %zmm28, %zmm0
+	LONG $0x409d6162; WORD $0xe058             // vaddpd	%zmm0, %zmm28, %zmm28
+	LONG $0x48fdb162; WORD $0xc428             // vmovapd	%zmm20, %zmm0
+	LONG $0x40a5b362; WORD $0xc325; BYTE $0xf8 // vpternlogq	$248, %zmm19, %zmm27, %zmm0
+	LONG $0x40a56162; WORD $0xd858             // vaddpd	%zmm0, %zmm27, %zmm27
+	LONG $0x48fd0362; WORD $0xe409; BYTE $0x03 // vrndscalepd	$3, %zmm28, %zmm28
+	LONG $0x48fd0362; WORD $0xdb09; BYTE $0x03 // vrndscalepd	$3, %zmm27, %zmm27
+	LONG $0x409d2262; WORD $0xf2bc             // vfnmadd231pd	%zmm18, %zmm28, %zmm30
+	LONG $0x40a52262; WORD $0xcabc             // vfnmadd231pd	%zmm18, %zmm27, %zmm25
+	LONG $0x409d2262; WORD $0xf1bc             // vfnmadd231pd	%zmm17, %zmm28, %zmm30
+	LONG $0x48fd0162; WORD $0xe47a             // vcvttpd2qq	%zmm28, %zmm28
+	LONG $0x409d6162; WORD $0xe4d4             // vpaddq	%zmm4, %zmm28, %zmm28
+	LONG $0x409d9162; WORD $0xf473; BYTE $0x34 // vpsllq	$52, %zmm28, %zmm28
+	LONG $0x40a52262; WORD $0xc9bc             // vfnmadd231pd	%zmm17, %zmm27, %zmm25
+	LONG $0x48fd0162; WORD $0xdb7a             // vcvttpd2qq	%zmm27, %zmm27
+	LONG $0x40a56162; WORD $0xdcd4             // vpaddq	%zmm4, %zmm27, %zmm27
+	LONG $0x40a59162; WORD $0xf373; BYTE $0x34 // vpsllq	$52, %zmm27, %zmm27
+	LONG $0x48fd9162; WORD $0xc628             // vmovapd	%zmm30, %zmm0
+	LONG $0x4885b262; WORD $0xc098             // vfmadd132pd	%zmm16, %zmm15, %zmm0
+	LONG $0x48fd0162; WORD $0xc128             // vmovapd	%zmm25, %zmm24
+	LONG $0x48852262; WORD $0xc098             // vfmadd132pd	%zmm16, %zmm15, %zmm24
+	LONG $0x488d9262; WORD $0xc698             // vfmadd132pd	%zmm30, %zmm14, %zmm0
+	LONG $0x488d0262; WORD $0xc198             // vfmadd132pd	%zmm25, %zmm14, %zmm24
+	LONG $0x48959262; WORD $0xc698             // vfmadd132pd	%zmm30, %zmm13, %zmm0
+	LONG $0x48950262; WORD $0xc198             // vfmadd132pd	%zmm25, %zmm13, %zmm24
+	LONG $0x489d9262; WORD $0xc698             // vfmadd132pd	%zmm30, %zmm12, %zmm0
+	LONG $0x489d0262; WORD $0xc198             // vfmadd132pd	%zmm25, %zmm12, %zmm24
+	LONG $0x48a59262; WORD $0xc698             // vfmadd132pd	%zmm30, %zmm11, %zmm0
+	LONG $0x48a50262; WORD $0xc198             // vfmadd132pd	%zmm25, %zmm11, %zmm24
+	LONG $0x48ad9262; WORD $0xc698             // vfmadd132pd	%zmm30, %zmm10, %zmm0
+	LONG $0x48ad0262; WORD $0xc198             // vfmadd132pd	%zmm25, %zmm10, %zmm24
+	LONG $0x48b59262; WORD $0xc698             // vfmadd132pd	%zmm30, %zmm9, %zmm0
+	LONG $0x48b50262; WORD $0xc198             // vfmadd132pd	%zmm25, %zmm9, %zmm24
+	LONG $0x48bd9262; WORD $0xc698             // vfmadd132pd	%zmm30, %zmm8, %zmm0
+	LONG $0x48bd0262; WORD $0xc198             // vfmadd132pd	%zmm25, %zmm8, %zmm24
+	LONG $0x48c59262; WORD $0xc698             // vfmadd132pd	%zmm30, %zmm7, %zmm0
+	LONG $0x48c50262; WORD $0xc198             // vfmadd132pd	%zmm25, %zmm7, %zmm24
+	LONG $0x48cd9262; WORD $0xc698             // vfmadd132pd	%zmm30, %zmm6, %zmm0
+	LONG $0x48cd0262; WORD $0xc198             // vfmadd132pd	%zmm25, %zmm6, %zmm24
+	LONG $0x48ed9262; WORD $0xc698             // vfmadd132pd	%zmm30, %zmm2, %zmm0
+	LONG $0x48ed0262; WORD $0xc198             // vfmadd132pd	%zmm25, %zmm2, %zmm24
+	LONG $0x48ed9262; WORD $0xc698             // vfmadd132pd	%zmm30, %zmm2, %zmm0
+	LONG $0x48ed0262; WORD $0xc198             // vfmadd132pd	%zmm25, %zmm2, %zmm24
+	LONG $0x48fd9162; WORD $0xc459             // vmulpd	%zmm28, %zmm0, %zmm0
+	LONG $0x40bd0162; WORD $0xc359             // vmulpd	%zmm27, %zmm24, %zmm24
+	LONG $0x48fdf162; WORD $0xc05a             // vcvtpd2ps	%zmm0, %ymm0
+	LONG $0x48fd0162; WORD $0xc05a             // vcvtpd2ps	%zmm24, %ymm24
+	LONG $0x487d9362; WORD $0xc01a; BYTE $0x01 // vinsertf32x8	$0x1, %ymm24, %zmm0, %zmm0
+	LONG $0xca7c6162; WORD $0xc328             // vmovaps	%zmm3, %zmm24{%k2}{z}
+	LONG $0x497c6162; WORD $0xc028             // vmovaps	%zmm0, %zmm24{%k1}
+	LONG $0x203d0362; WORD $0xc803; BYTE $0x07 // valignd	$7, %ymm24, %ymm24, %ymm25
+	LONG $0x002e9162; WORD $0xc058             // vaddss	%xmm24, %xmm26, %xmm0
+	LONG $0x003c0162; WORD $0xd0c6; BYTE $0x55 // vshufps	$85, %xmm24, %xmm24, %xmm26
+	LONG $0x487c6162; WORD $0x4611; BYTE $0xff // vmovups	%zmm24, -64(%rsi)
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x003c0162; WORD $0xd015             // vunpckhps	%xmm24, %xmm24, %xmm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x003c0162; WORD $0xd0c6; BYTE $0xff // vshufps	$255, %xmm24, %xmm24, %xmm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x287d0362; WORD $0xc219; BYTE $0x01 // vextractf32x4	$1, %ymm24, %xmm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x203d0362; WORD $0xd003; BYTE $0x05 // valignd	$5, %ymm24, %ymm24, %ymm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x203d0362; WORD $0xd003; BYTE $0x06 // valignd	$6, %ymm24, %ymm24, %ymm26
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x487d0362; WORD $0xc21b; BYTE $0x01 // vextractf32x8	$0x1, %zmm24, %ymm26
+	LONG $0x002c0162; WORD $0xc2c6; BYTE $0xff // vshufps	$255, %xmm26, %xmm26, %xmm24
+	LONG $0x087e9162; WORD $0xc158             // vaddss	%xmm25, %xmm0, %xmm0
+	LONG $0x002c0162; WORD $0xcac6; BYTE $0x55 // vshufps	$85, %xmm26, %xmm26, %xmm25
+	LONG $0x087e9162; WORD $0xc258             // vaddss	%xmm26, %xmm0, %xmm0
+	LONG $0x087e9162; WORD $0xc158             // vaddss	%xmm25, %xmm0, %xmm0
+	LONG $0x002c0162; WORD $0xca15             // vunpckhps	%xmm26, %xmm26, %xmm25
+	LONG $0x087e9162; WORD $0xc158             // vaddss	%xmm25, %xmm0, %xmm0
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x287d0362; WORD $0xd019; BYTE $0x01 // vextractf32x4	$1, %ymm26, %xmm24
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x202d0362; WORD $0xc203; BYTE $0x05 // valignd	$5, %ymm26, %ymm26, %ymm24
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x202d0362; WORD $0xc203; BYTE $0x06 // valignd	$6, %ymm26, %ymm26, %ymm24
+	LONG $0x202d0362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm26, %ymm26, %ymm26
+	LONG $0x087e9162; WORD $0xc058             // vaddss	%xmm24, %xmm0, %xmm0
+	LONG $0x087e0162; WORD $0xd258             // vaddss	%xmm26, %xmm0, %xmm26
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xfe                   // movq	%rdi, %rsi
+	LONG $0xf0e68348                           // andq	$-16, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x0fc7f640                           // testb	$15, %dil
+	JE   BB0_13
+
+BB0_8:
+	WORD         $0x2948; BYTE $0xf7                   // subq	%rsi, %rdi
+	LONG         $0xff478d4c                           // leaq	-1(%rdi), %r8
+	LONG         $0x06f88349                           // cmpq	$6, %r8
+	JBE          BB0_14
+	WORD         $0x014c; BYTE $0xce                   // addq	%r9, %rsi
+	LONG         $0x187de2c4; BYTE $0xc1               // vbroadcastss	%xmm1, %ymm0
+	VBROADCASTSD CPI0_27<>(SB), Y6                     // vbroadcastsd	.LCPI0_27(%rip), %ymm6
+	VBROADCASTSD CPI0_87<>(SB), Y2                     // vbroadcastsd	.LCPI0_87(%rip), %ymm2
+	VBROADCASTSD CPI0_86<>(SB), Y4                     // vbroadcastsd	.LCPI0_86(%rip), %ymm4
+	LONG         $0xb2048d4c                           // leaq	(%rdx,%rsi,4), %r8
+	LONG         $0x0003ffbe; BYTE $0x00               // movl	$1023, %esi
+	LONG         $0x107cc1c4; BYTE $0x28               // vmovups	(%r8), %ymm5
+	LONG         $0xc2287dc5                           // vmovapd	%ymm2, %ymm8
+	LONG         $0xe85cd4c5                           // vsubps	%ymm0, %ymm5, %ymm5
+	LONG         $0xc55afcc5                           // vcvtps2pd	%xmm5, %ymm0
+	LONG         $0xfe59fdc5                           // vmulpd	%ymm6, %ymm0, %ymm7
+	LONG         $0x197de3c4; WORD $0x01eb             // vextractf128	$0x1, %ymm5, %xmm3
+	LONG         $0xdb5afcc5                           // vcvtps2pd	%xmm3, %ymm3
+	LONG         $0xf659e5c5                           // vmulpd	%ymm6, %ymm3, %ymm6
+	LONG         $0x28c57362; WORD $0xc425; BYTE $0xf8 // vpternlogq	$248, %ymm4, %ymm7, %ymm8
+	LONG         $0x28cdf362; WORD $0xd425; BYTE $0xf8 // vpternlogq	$248, %ymm4, %ymm6, %ymm2
+	LONG         $0x5845c1c4; BYTE $0xf8               // vaddpd	%ymm8, %ymm7, %ymm7
+	VBROADCASTSD CPI0_39<>(SB), Y8                     // vbroadcastsd	.LCPI0_39(%rip), %ymm8
+	LONG         $0xf258cdc5                           // vaddpd	%ymm2, %ymm6, %ymm6
+	VBROADCASTSD CPI0_33<>(SB), Y2                     // vbroadcastsd	.LCPI0_33(%rip), %ymm2
+	LONG         $0x28fdf362; WORD $0xff09; BYTE $0x03 // vrndscalepd	$3, %ymm7, %ymm7
+	LONG         $0x28fdf362; WORD $0xf609; BYTE $0x03 // vrndscalepd	$3, %ymm6, %ymm6
+	LONG         $0xbcc5e2c4; BYTE $0xc2               // vfnmadd231pd	%ymm2, %ymm7, %ymm0
+	LONG         $0x9ce5e2c4; BYTE $0xd6               // vfnmadd132pd	%ymm6, %ymm3, %ymm2
+	VBROADCASTSD CPI0_35<>(SB), Y3                     // vbroadcastsd	.LCPI0_35(%rip), %ymm3
+	LONG         $0xbcc5e2c4; BYTE $0xc3               // vfnmadd231pd	%ymm3, %ymm7, %ymm0
+	LONG         $0x28fdf162; WORD $0xff7a             // vcvttpd2qq	%ymm7, %ymm7
+	LONG         $0x9cede2c4; BYTE $0xde               // vfnmadd132pd	%ymm6, %ymm2, %ymm3
+	LONG         $0x28fdf162; WORD $0xf67a             // vcvttpd2qq	%ymm6, %ymm6
+	VBROADCASTSD CPI0_37<>(SB), Y2                     // vbroadcastsd	.LCPI0_37(%rip), %ymm2
+	LONG         $0xe028fdc5                           // vmovapd	%ymm0, %ymm4
+	LONG         $0x98bde2c4; BYTE $0xe2               // vfmadd132pd	%ymm2, %ymm8, %ymm4
+	LONG         $0x98bde2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm8, %ymm2
+	VBROADCASTSD CPI0_41<>(SB), Y8                     // vbroadcastsd	.LCPI0_41(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xe0               // vfmadd132pd	%ymm0, %ymm8, %ymm4
+	LONG         $0x98bde2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm8, %ymm2
+	VBROADCASTSD CPI0_43<>(SB), Y8                     // vbroadcastsd	.LCPI0_43(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xe0               // vfmadd132pd	%ymm0, %ymm8, %ymm4
+	LONG         $0x98bde2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm8, %ymm2
+	VBROADCASTSD CPI0_45<>(SB), Y8                     // vbroadcastsd	.LCPI0_45(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xe0               // vfmadd132pd	%ymm0, %ymm8, %ymm4
+	LONG         $0x98bde2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm8, %ymm2
+	VBROADCASTSD CPI0_47<>(SB), Y8                     // vbroadcastsd	.LCPI0_47(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xe0               // vfmadd132pd	%ymm0, %ymm8, %ymm4
+	LONG         $0x98bde2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm8, %ymm2
+	VBROADCASTSD CPI0_49<>(SB), Y8                     // vbroadcastsd	.LCPI0_49(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xe0               // vfmadd132pd	%ymm0, %ymm8, %ymm4
+	LONG         $0x98bde2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm8, %ymm2
+	VBROADCASTSD CPI0_51<>(SB), Y8                     // vbroadcastsd	.LCPI0_51(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xe0               // vfmadd132pd	%ymm0, %ymm8, %ymm4
+	LONG         $0x98bde2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm8, %ymm2
+	VBROADCASTSD CPI0_53<>(SB), Y8                     // vbroadcastsd	.LCPI0_53(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xe0               // vfmadd132pd	%ymm0, %ymm8, %ymm4
+	LONG         $0x98bde2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm8, %ymm2
+	VBROADCASTSD CPI0_55<>(SB), Y8                     // vbroadcastsd	.LCPI0_55(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xe0               // vfmadd132pd	%ymm0, %ymm8, %ymm4
+	LONG         $0x98bde2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm8, %ymm2
+	VBROADCASTSD CPI0_57<>(SB), Y8                     // vbroadcastsd	.LCPI0_57(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xe0               // vfmadd132pd	%ymm0, %ymm8, %ymm4
+	LONG         $0x98bde2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm8, %ymm2
+	VBROADCASTSD CPI0_59<>(SB), Y8                     // vbroadcastsd	.LCPI0_59(%rip), %ymm8
+	LONG         $0x98bde2c4; BYTE $0xe0               // vfmadd132pd	%ymm0, %ymm8, %ymm4
+	LONG         $0x98bde2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm8, %ymm2
+	LONG         $0x98bde2c4; BYTE $0xc4               // vfmadd132pd	%ymm4, %ymm8, %ymm0
+	LONG         $0x98bde2c4; BYTE $0xda               // vfmadd132pd	%ymm2, %ymm8, %ymm3
+	LONG         $0x28fdf262; WORD $0xd67c             // vpbroadcastq	%rsi, %ymm2
+	WORD         $0x8948; BYTE $0xfe                   // movq	%rdi, %rsi
+	LONG         $0xfad4c5c5                           // vpaddq	%ymm2, %ymm7, %ymm7
+	LONG         $0xf2d4cdc5                           // vpaddq	%ymm2, %ymm6, %ymm6
+	LONG         $0xf8e68348                           // andq	$-8, %rsi
+	VBROADCASTSS CPI0_62<>(SB), Y2                     // vbroadcastss	.LCPI0_62(%rip), %ymm2
+	LONG         $0xf773c5c5; BYTE $0x34               // vpsllq	$52, %ymm7, %ymm7
+	LONG         $0xf673cdc5; BYTE $0x34               // vpsllq	$52, %ymm6, %ymm6
+	WORD         $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	WORD         $0xe783; BYTE $0x07                   // andl	$7, %edi
+	LONG         $0xc759fdc5                           // vmulpd	%ymm7, %ymm0, %ymm0
+	LONG         $0xde59e5c5                           // vmulpd	%ymm6, %ymm3, %ymm3
+	LONG         $0xc05afdc5                           // vcvtpd2psy	%ymm0, %xmm0
+	LONG         $0xdb5afdc5                           // vcvtpd2psy	%ymm3, %xmm3
+	LONG         $0x187de3c4; WORD $0x01c3             // vinsertf128	$0x1, %xmm3, %ymm0, %ymm0
+	VBROADCASTSS CPI0_64<>(SB), Y3                     // vbroadcastss	.LCPI0_64(%rip), %ymm3
+	LONG         $0x2854f162; WORD $0xcbc2; BYTE $0x05 // vcmpps	$5, %ymm3, %ymm5, %k1
+	VBROADCASTSS CPI0_0<>(SB), Y3                      // vbroadcastss	.LCPI0_0(%rip), %ymm3
+	LONG         $0x2954f162; WORD $0xcac2; BYTE $0x0a // vcmpps	$10, %ymm2, %ymm5, %k1{%k1}
+	LONG         $0xd5c2ecc5; BYTE $0x01               // vcmpltps	%ymm5, %ymm2, %ymm2
+	LONG         $0xd354ecc5                           // vandps	%ymm3, %ymm2, %ymm2
+	LONG         $0x296df262; WORD $0xc065             // vblendmps	%ymm0, %ymm2, %ymm0{%k1}
+	LONG         $0x002ef162; WORD $0xd058             // vaddss	%xmm0, %xmm26, %xmm2
+	LONG         $0xe0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm4
+	LONG         $0xd8c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm3
+	LONG         $0x117cc1c4; BYTE $0x00               // vmovups	%ymm0, (%r8)
+	LONG         $0xd458eac5                           // vaddss	%xmm4, %xmm2, %xmm2
+	LONG         $0xe015f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm4
+	LONG         $0xd458eac5                           // vaddss	%xmm4, %xmm2, %xmm2
+	LONG         $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG         $0x287df362; WORD $0xc319; BYTE $0x01 // vextractf32x4	$1, %ymm0, %xmm3
+	LONG         $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG         $0x287df362; WORD $0xd803; BYTE $0x05 // valignd	$5, %ymm0, %ymm0, %ymm3
+	LONG         $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG         $0x287df362; WORD $0xd803; BYTE $0x06 // valignd	$6, %ymm0, %ymm0, %ymm3
+	LONG         $0x287df362; WORD $0xc003; BYTE $0x07 // valignd	$7, %ymm0, %ymm0, %ymm0
+	LONG         $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG         $0x086e6162; WORD $0xd058             // vaddss	%xmm0, %xmm2, %xmm26
+	JE           BB0_13
+
+BB0_14:
+	VMOVSS CPI0_0<>(SB), X4   // vmovss	.LCPI0_0(%rip), %xmm4
+	VMOVSS CPI0_64<>(SB), X5  // vmovss	.LCPI0_64(%rip), %xmm5
+	VMOVSD CPI0_27<>(SB), X13 // vmovsd	.LCPI0_27(%rip), %xmm13
+	VMOVQ  CPI0_86<>(SB), X12 // vmovq	.LCPI0_86(%rip), %xmm12
+	VMOVQ  CPI0_87<>(SB), X11 // vmovq	.LCPI0_87(%rip), %xmm11
+	VMOVSD CPI0_33<>(SB), X10 // vmovsd	.LCPI0_33(%rip), %xmm10
+	VMOVSD CPI0_35<>(SB), X9  // vmovsd	.LCPI0_35(%rip), %xmm9
+	VMOVSD CPI0_37<>(SB), X8  // vmovsd	.LCPI0_37(%rip), %xmm8
+	VMOVSD CPI0_39<>(SB), X7  // vmovsd	.LCPI0_39(%rip), %xmm7
+	VMOVSD CPI0_41<>(SB), X6  // vmovsd	.LCPI0_41(%rip), %xmm6
+
+BB0_18:
+	LONG        $0x0410fac5; BYTE $0x82               // vmovss	(%rdx,%rax,4), %xmm0
+	LONG        $0xd428f8c5                           // vmovaps	%xmm4, %xmm2
+	LONG        $0xc15cfac5                           // vsubss	%xmm1, %xmm0, %xmm0
+	VCOMISS     CPI0_62<>(SB), X0                     // vcomiss	.LCPI0_62(%rip), %xmm0
+	JA          BB0_19
+	LONG        $0xe82ff8c5                           // vcomiss	%xmm0, %xmm5
+	LONG        $0xd257e8c5                           // vxorps	%xmm2, %xmm2, %xmm2
+	JA          BB0_19
+	LONG        $0xc05afac5                           // vcvtss2sd	%xmm0, %xmm0, %xmm0
+	LONG        $0x597bc1c4; BYTE $0xdd               // vmulsd	%xmm13, %xmm0, %xmm3
+	LONG        $0xda2979c5                           // vmovapd	%xmm11, %xmm2
+	VMOVSD      CPI0_59<>(SB), X14                    // vmovsd	.LCPI0_59(%rip), %xmm14
+	LONG        $0x08e5d362; WORD $0xd425; BYTE $0xf8 // vpternlogq	$248, %xmm12, %xmm3, %xmm2
+	LONG        $0xda58e3c5                           // vaddsd	%xmm2, %xmm3, %xmm3
+	LONG        $0x08e5f362; WORD $0xdb0b; BYTE $0x03 // vrndscalesd	$3, %xmm3, %xmm3, %xmm3
+	LONG        $0xbde1c2c4; BYTE $0xc2               // vfnmadd231sd	%xmm10, %xmm3, %xmm0
+	LONG        $0x2cfbe1c4; BYTE $0xf3               // vcvttsd2siq	%xmm3, %rsi
+	LONG        $0xffc68148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rsi
+	LONG        $0xbde1c2c4; BYTE $0xc1               // vfnmadd231sd	%xmm9, %xmm3, %xmm0
+	LONG        $0x34e6c148                           // salq	$52, %rsi
+	LONG        $0x6ef9e1c4; BYTE $0xde               // vmovq	%rsi, %xmm3
+	LONG        $0xd010fbc5                           // vmovsd	%xmm0, %xmm0, %xmm2
+	LONG        $0x99c1c2c4; BYTE $0xd0               // vfmadd132sd	%xmm8, %xmm7, %xmm2
+	LONG        $0x99c9e2c4; BYTE $0xd0               // vfmadd132sd	%xmm0, %xmm6, %xmm2
+	VFMADD213SD CPI0_43<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_43(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_45<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_45(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_47<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_47(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_49<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_49(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_51<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_51(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_53<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_53(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_55<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_55(%rip), %xmm0, %xmm2
+	VFMADD213SD CPI0_57<>(SB), X0, X2                 // vfmadd213sd	.LCPI0_57(%rip), %xmm0, %xmm2
+	LONG        $0x9989e2c4; BYTE $0xd0               // vfmadd132sd	%xmm0, %xmm14, %xmm2
+	LONG        $0x9989e2c4; BYTE $0xc2               // vfmadd132sd	%xmm2, %xmm14, %xmm0
+	LONG        $0xc359fbc5                           // vmulsd	%xmm3, %xmm0, %xmm0
+	LONG        $0xd05afbc5                           // vcvtsd2ss	%xmm0, %xmm0, %xmm2
+
+BB0_19:
+	LONG $0x1411fac5; BYTE $0x82   // vmovss	%xmm2, (%rdx,%rax,4)
+	LONG $0x01c08348               // addq	$1, %rax
+	LONG $0x002e6162; WORD $0xd258 // vaddss	%xmm2, %xmm26, %xmm26
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JG   BB0_18
+
+BB0_13:
+	VMOVSS CPI0_23<>(SB), X0         // vmovss	.LCPI0_23(%rip), %xmm0
+	LONG   $0x087e0162; WORD $0xd25e // vdivss	%xmm26, %xmm0, %xmm26
+	LONG   $0x487d9262; WORD $0xca18 // vbroadcastss	%xmm26, %zmm1
+	LONG   $0x0ff98348               // cmpq	$15, %rcx
+	JLE    BB0_12
+
+BB0_11:
+	LONG $0xf0718d48             // leaq	-16(%rcx), %rsi
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	LONG $0x04eec148             // shrq	$4, %rsi
+	WORD $0x8948; BYTE $0xf7     // movq	%rsi, %rdi
+	LONG $0x06e7c148             // salq	$6, %rdi
+	LONG $0x3a7c8d48; BYTE $0x40 // leaq	64(%rdx,%rdi), %rdi
+
+BB0_22:
+	LONG $0x4874f162; WORD $0x0059             // vmulps	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xf8                   // cmpq	%rdi, %rax
+	JNE  BB0_22
+	LONG $0x01c68348                           // addq	$1, %rsi
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0x04e0c148                           // salq	$4, %rax
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_60
+	WORD $0x8948; BYTE $0xcf                   // movq	%rcx, %rdi
+	WORD $0x8949; BYTE $0xc1                   // movq	%rax, %r9
+	WORD $0x2948; BYTE $0xc7                   // subq	%rax, %rdi
+	LONG $0xff478d4c                           // leaq	-1(%rdi), %r8
+	LONG $0x0ef88349                           // cmpq	$14, %r8
+	JBE  BB0_31
+	LONG $0x06e6c148                           // salq	$6, %rsi
+	WORD $0x8949; BYTE $0xf8                   // movq	%rdi, %r8
+	WORD $0x0148; BYTE $0xd6                   // addq	%rdx, %rsi
+	LONG $0xf0e08349                           // andq	$-16, %r8
+	LONG $0x4874f162; WORD $0x0e59             // vmulps	(%rsi), %zmm1, %zmm1
+	WORD $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+	LONG $0x487cf162; WORD $0x0e11             // vmovups	%zmm1, (%rsi)
+	LONG $0x0fc7f640                           // testb	$15, %dil
+	JE   BB0_60
+
+BB0_21:
+	WORD $0x294c; BYTE $0xc7       // subq	%r8, %rdi
+	WORD $0x8948; BYTE $0xfe       // movq	%rdi, %rsi
+	LONG $0xff7f8d48               // leaq	-1(%rdi), %rdi
+	LONG $0x06ff8348               // cmpq	$6, %rdi
+	JBE  BB0_24
+	WORD $0x014d; BYTE $0xc8       // addq	%r9, %r8
+	LONG $0x287d9262; WORD $0xc218 // vbroadcastss	%xmm26, %ymm0
+	LONG $0x823c8d4a               // leaq	(%rdx,%r8,4), %rdi
+	LONG $0x0759fcc5               // vmulps	(%rdi), %ymm0, %ymm0
+	LONG $0x0711fcc5               // vmovups	%ymm0, (%rdi)
+	WORD $0x8948; BYTE $0xf7       // movq	%rsi, %rdi
+	LONG $0xf8e78348               // andq	$-8, %rdi
+	WORD $0x0148; BYTE $0xf8       // addq	%rdi, %rax
+	WORD $0xe683; BYTE $0x07       // andl	$7, %esi
+	JE   BB0_60
+
+BB0_24:
+	QUAD $0x0000000085348d48       // leaq	0(,%rax,4), %rsi
+	LONG $0x323c8d48               // leaq	(%rdx,%rsi), %rdi
+	LONG $0x002ef162; WORD $0x0759 // vmulss	(%rdi), %xmm26, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_60
+	LONG $0x327c8d48; BYTE $0x04   // leaq	4(%rdx,%rsi), %rdi
+	LONG $0x002ef162; WORD $0x0759 // vmulss	(%rdi), %xmm26, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x02788d48               // leaq	2(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_60
+	LONG $0x327c8d48; BYTE $0x08   // leaq	8(%rdx,%rsi), %rdi
+	LONG $0x002ef162; WORD $0x0759 // vmulss	(%rdi), %xmm26, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x03788d48               // leaq	3(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_60
+	LONG $0x327c8d48; BYTE $0x0c   // leaq	12(%rdx,%rsi), %rdi
+	LONG $0x002ef162; WORD $0x0759 // vmulss	(%rdi), %xmm26, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x04788d48               // leaq	4(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_60
+	LONG $0x327c8d48; BYTE $0x10   // leaq	16(%rdx,%rsi), %rdi
+	LONG $0x002ef162; WORD $0x0759 // vmulss	(%rdi), %xmm26, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x05788d48               // leaq	5(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_60
+	LONG $0x327c8d48; BYTE $0x14   // leaq	20(%rdx,%rsi), %rdi
+	LONG $0x06c08348               // addq	$6, %rax
+	LONG $0x002ef162; WORD $0x0759 // vmulss	(%rdi), %xmm26, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_60
+	LONG $0x32448d48; BYTE $0x18   // leaq	24(%rdx,%rsi), %rax
+	LONG $0x002e6162; WORD $0x1059 // vmulss	(%rax), %xmm26, %xmm26
+	LONG $0x087e6162; WORD $0x1011 // vmovss	%xmm26, (%rax)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_7:
+	VMOVSS CPI0_23<>(SB), X0         // vmovss	.LCPI0_23(%rip), %xmm0
+	LONG   $0x087e0162; WORD $0xd25e // vdivss	%xmm26, %xmm0, %xmm26
+	LONG   $0x487d9262; WORD $0xca18 // vbroadcastss	%xmm26, %zmm1
+	LONG   $0x0ff98348               // cmpq	$15, %rcx
+	JG     BB0_11
+	WORD   $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JG     BB0_12
+
+BB0_60:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_61:
+	RET
+
+BB0_28:
+	LONG $0xed57d1c5 // vxorpd	%xmm5, %xmm5, %xmm5
+	WORD $0xc031     // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0x8948; BYTE $0xcf // movq	%rcx, %rdi
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_21
+
+BB0_29:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_8
+
+BB0_31:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_21
@@ -0,0 +1,390 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basesoftmaxwithtemperature_c_f32_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x7f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_11<>+0(SB)/4, $0xb95e8083
+DATA CPI0_11<>+4(SB)/4, $0xb95e8083
+DATA CPI0_11<>+8(SB)/4, $0xb95e8083
+DATA CPI0_11<>+12(SB)/4, $0xb95e8083
+DATA CPI0_11<>+16(SB)/4, $0xb95e8083
+DATA CPI0_11<>+20(SB)/4, $0xb95e8083
+DATA CPI0_11<>+24(SB)/4, $0xb95e8083
+DATA CPI0_11<>+28(SB)/4, $0xb95e8083
+GLOBL CPI0_11<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_14<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_14<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_15<>+0(SB)/4, $0x3c088889
+DATA CPI0_15<>+4(SB)/4, $0x3c088889
+DATA CPI0_15<>+8(SB)/4, $0x3c088889
+DATA CPI0_15<>+12(SB)/4, $0x3c088889
+DATA CPI0_15<>+16(SB)/4, $0x3c088889
+DATA CPI0_15<>+20(SB)/4, $0x3c088889
+DATA CPI0_15<>+24(SB)/4, $0x3c088889
+DATA CPI0_15<>+28(SB)/4, $0x3c088889
+GLOBL CPI0_15<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_17<>+0(SB)/4, $0x3d2aaaab
+DATA CPI0_17<>+4(SB)/4, $0x3d2aaaab
+DATA CPI0_17<>+8(SB)/4, $0x3d2aaaab
+DATA CPI0_17<>+12(SB)/4, $0x3d2aaaab
+DATA CPI0_17<>+16(SB)/4, $0x3d2aaaab
+DATA CPI0_17<>+20(SB)/4, $0x3d2aaaab
+DATA CPI0_17<>+24(SB)/4, $0x3d2aaaab
+DATA CPI0_17<>+28(SB)/4, $0x3d2aaaab
+GLOBL CPI0_17<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_19<>+0(SB)/4, $0x3e2aaaab
+DATA CPI0_19<>+4(SB)/4, $0x3e2aaaab
+DATA CPI0_19<>+8(SB)/4, $0x3e2aaaab
+DATA CPI0_19<>+12(SB)/4, $0x3e2aaaab
+DATA CPI0_19<>+16(SB)/4, $0x3e2aaaab
+DATA CPI0_19<>+20(SB)/4, $0x3e2aaaab
+DATA CPI0_19<>+24(SB)/4, $0x3e2aaaab
+DATA CPI0_19<>+28(SB)/4, $0x3e2aaaab
+GLOBL CPI0_19<>(SB), (RODATA|NOPTR), $32
+DATA CPI0_2<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_2<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_22<>+0(SB)/4, $0x3f000000
+GLOBL CPI0_22<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_26<>+0(SB)/4, $0x44314000
+GLOBL CPI0_26<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_27<>+0(SB)/4, $0xc4314000
+GLOBL CPI0_27<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_28<>+0(SB)/4, $0x652b82fe
+DATA CPI0_28<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_28<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_29<>+0(SB)/4, $0x00000000
+DATA CPI0_29<>+4(SB)/4, $0x80000000
+DATA CPI0_29<>+8(SB)/4, $0x00000000
+DATA CPI0_29<>+12(SB)/4, $0x00000000
+GLOBL CPI0_29<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_30<>+0(SB)/4, $0xffffffff
+DATA CPI0_30<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_30<>+8(SB)/4, $0x00000000
+DATA CPI0_30<>+12(SB)/4, $0x00000000
+GLOBL CPI0_30<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_31<>+0(SB)/4, $0xfee00000
+DATA CPI0_31<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_31<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_32<>+0(SB)/4, $0x35793c6c
+DATA CPI0_32<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_32<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_33<>+0(SB)/4, $0xeff8d898
+DATA CPI0_33<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_33<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_34<>+0(SB)/4, $0x67f544e4
+DATA CPI0_34<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_34<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_35<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_35<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_35<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_36<>+0(SB)/4, $0xa556c734
+DATA CPI0_36<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_36<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_37<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_37<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_37<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_38<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_38<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_38<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_39<>+0(SB)/4, $0x16c16c17
+DATA CPI0_39<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_39<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_4<>+0(SB)/4, $0x42b17218
+GLOBL CPI0_4<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_40<>+0(SB)/4, $0x11111111
+DATA CPI0_40<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_40<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_41<>+0(SB)/4, $0x55555555
+DATA CPI0_41<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_41<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_42<>+0(SB)/4, $0x55555555
+DATA CPI0_42<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_42<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_43<>+0(SB)/4, $0x00000000
+DATA CPI0_43<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_43<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_44<>+0(SB)/4, $0x00000000
+DATA CPI0_44<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_44<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_6<>+0(SB)/4, $0xc2aeac50
+GLOBL CPI0_6<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_8<>+0(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_8<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_9<>+0(SB)/4, $0x3f318000
+DATA CPI0_9<>+4(SB)/4, $0x3f318000
+DATA CPI0_9<>+8(SB)/4, $0x3f318000
+DATA CPI0_9<>+12(SB)/4, $0x3f318000
+DATA CPI0_9<>+16(SB)/4, $0x3f318000
+DATA CPI0_9<>+20(SB)/4, $0x3f318000
+DATA CPI0_9<>+24(SB)/4, $0x3f318000
+DATA CPI0_9<>+28(SB)/4, $0x3f318000
+GLOBL CPI0_9<>(SB), (RODATA|NOPTR), $32
+
+TEXT ·softmaxwithtemperature_c_f32_avx2(SB), $64-32
+	MOVQ   input+0(FP), DI
+	MOVQ   output+8(FP), SI
+	MOVQ   ptemperature+16(FP), DX
+	MOVQ   plen_input+24(FP), CX
+	WORD   $0x8b48; BYTE $0x09       // movq	(%rcx), %rcx
+	WORD   $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JE     BB0_41
+	WORD   $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG   $0x246c8d48; BYTE $0x30   // leaq	48(%rsp), %rbp
+	LONG   $0x24648d48; BYTE $0x20   // leaq	32(%rsp), %rsp
+	LONG   $0xe0e48348               // andq	$-32, %rsp
+	LONG   $0x0710fac5               // vmovss	(%rdi), %xmm0
+	VMOVSS CPI0_2<>(SB), X7          // vmovss	.LCPI0_2(%rip), %xmm7
+	LONG   $0x3a5ec2c5               // vdivss	(%rdx), %xmm7, %xmm7
+	LONG   $0x7c11fac5; WORD $0x1824 // vmovss	%xmm7, 24(%rsp)
+	LONG   $0x4411fac5; WORD $0x1c24 // vmovss	%xmm0, 28(%rsp)
+	LONG   $0x01f98348               // cmpq	$1, %rcx
+	JLE    BB0_19
+	LONG   $0x04578d48               // leaq	4(%rdi), %rdx
+	LONG   $0x8f3c8d48               // leaq	(%rdi,%rcx,4), %rdi
+
+BB0_5:
+	LONG         $0x0a10fac5                           // vmovss	(%rdx), %xmm1
+	LONG         $0x04c28348                           // addq	$4, %rdx
+	LONG         $0xc05ff2c5                           // vmaxss	%xmm0, %xmm1, %xmm0
+	WORD         $0x3948; BYTE $0xfa                   // cmpq	%rdi, %rdx
+	JNE          BB0_5
+	LONG         $0x187d62c4; WORD $0x2454; BYTE $0x18 // vbroadcastss	24(%rsp), %ymm10
+	LONG         $0x4411fac5; WORD $0x1c24             // vmovss	%xmm0, 28(%rsp)
+	LONG         $0x187d62c4; BYTE $0xc8               // vbroadcastss	%xmm0, %ymm9
+	LONG         $0x07f98348                           // cmpq	$7, %rcx
+	JLE          BB0_6
+	LONG         $0x00007fbf; BYTE $0x00               // movl	$127, %edi
+	LONG         $0xe457d8c5                           // vxorps	%xmm4, %xmm4, %xmm4
+	VBROADCASTSS CPI0_4<>(SB), Y15                     // vbroadcastss	.LCPI0_4(%rip), %ymm15
+	VBROADCASTSS CPI0_6<>(SB), Y14                     // vbroadcastss	.LCPI0_6(%rip), %ymm14
+	LONG         $0xc76e79c5                           // vmovd	%edi, %xmm8
+	LONG         $0x000008ba; BYTE $0x00               // movl	$8, %edx
+	VBROADCASTSS CPI0_8<>(SB), Y13                     // vbroadcastss	.LCPI0_8(%rip), %ymm13
+	VBROADCASTSS CPI0_22<>(SB), Y7                     // vbroadcastss	.LCPI0_22(%rip), %ymm7
+	VBROADCASTSS CPI0_2<>(SB), Y6                      // vbroadcastss	.LCPI0_2(%rip), %ymm6
+	LONG         $0x587d42c4; BYTE $0xc0               // vpbroadcastd	%xmm8, %ymm8
+	LONG         $0xef2141c4; BYTE $0xdb               // vpxor	%xmm11, %xmm11, %xmm11
+	VBROADCASTSS CPI0_0<>(SB), Y12                     // vbroadcastss	.LCPI0_0(%rip), %ymm12
+
+BB0_7:
+	VBROADCASTSS CPI0_14<>(SB), Y5         // vbroadcastss	.LCPI0_14(%rip), %ymm5
+	LONG         $0x5c10fcc5; WORD $0xe090 // vmovups	-32(%rax,%rdx,4), %ymm3
+	LONG         $0x5c64c1c4; BYTE $0xc1   // vsubps	%ymm9, %ymm3, %ymm0
+	LONG         $0x597cc1c4; BYTE $0xc2   // vmulps	%ymm10, %ymm0, %ymm0
+	LONG         $0x597cc1c4; BYTE $0xcd   // vmulps	%ymm13, %ymm0, %ymm1
+	LONG         $0xc27cc1c4; WORD $0x1edf // vcmpps	$30, %ymm15, %ymm0, %ymm3
+	LONG         $0xc27cc1c4; WORD $0x11d6 // vcmpps	$17, %ymm14, %ymm0, %ymm2
+	LONG         $0xd266a5c5               // vpcmpgtd	%ymm2, %ymm11, %ymm2
+	LONG         $0x087de3c4; WORD $0x08c9 // vroundps	$8, %ymm1, %ymm1
+	VFNMADD231PS CPI0_9<>(SB), Y1, Y0      // vfnmadd231ps	.LCPI0_9(%rip), %ymm1, %ymm0
+	VFNMADD231PS CPI0_11<>(SB), Y1, Y0     // vfnmadd231ps	.LCPI0_11(%rip), %ymm1, %ymm0
+	LONG         $0xc95bfdc5               // vcvtps2dq	%ymm1, %ymm1
+	LONG         $0xfe75c1c4; BYTE $0xc8   // vpaddd	%ymm8, %ymm1, %ymm1
+	VFMADD213PS  CPI0_15<>(SB), Y0, Y5     // vfmadd213ps	.LCPI0_15(%rip), %ymm0, %ymm5
+	LONG         $0xf172f5c5; BYTE $0x17   // vpslld	$23, %ymm1, %ymm1
+	VFMADD213PS  CPI0_17<>(SB), Y0, Y5     // vfmadd213ps	.LCPI0_17(%rip), %ymm0, %ymm5
+	VFMADD213PS  CPI0_19<>(SB), Y0, Y5     // vfmadd213ps	.LCPI0_19(%rip), %ymm0, %ymm5
+	LONG         $0x9845e2c4; BYTE $0xe8   // vfmadd132ps	%ymm0, %ymm7, %ymm5
+	LONG         $0x984de2c4; BYTE $0xe8   // vfmadd132ps	%ymm0, %ymm6, %ymm5
+	LONG         $0x984de2c4; BYTE $0xc5   // vfmadd132ps	%ymm5, %ymm6, %ymm0
+	LONG         $0xc159fcc5               // vmulps	%ymm1, %ymm0, %ymm0
+	LONG         $0x4a7dc3c4; WORD $0x30c4 // vblendvps	%ymm3, %ymm12, %ymm0, %ymm0
+	LONG         $0xd055ecc5               // vandnps	%ymm0, %ymm2, %ymm2
+	LONG         $0x5411fcc5; WORD $0xe096 // vmovups	%ymm2, -32(%rsi,%rdx,4)
+	LONG         $0x08c28348               // addq	$8, %rdx
+	LONG         $0xe258dcc5               // vaddps	%ymm2, %ymm4, %ymm4
+	WORD         $0x3948; BYTE $0xca       // cmpq	%rcx, %rdx
+	JLE          BB0_7
+	LONG         $0xf8518d48               // leaq	-8(%rcx), %rdx
+	LONG         $0x03eac148               // shrq	$3, %rdx
+	QUAD         $0x00000008d5148d48       // leaq	8(,%rdx,8), %rdx
+
+BB0_3:
+	LONG $0x197de3c4; WORD $0x01e0 // vextractf128	$0x1, %ymm4, %xmm0
+	LONG $0xd058d8c5               // vaddps	%xmm0, %xmm4, %xmm2
+	LONG $0xc212e8c5               // vmovhlps	%xmm2, %xmm2, %xmm0
+	LONG $0xd058e8c5               // vaddps	%xmm0, %xmm2, %xmm2
+	LONG $0xc216fac5               // vmovshdup	%xmm2, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_8
+
+BB0_18:
+	VMOVSS CPI0_0<>(SB), X6          // vmovss	.LCPI0_0(%rip), %xmm6
+	VMOVSS CPI0_27<>(SB), X7         // vmovss	.LCPI0_27(%rip), %xmm7
+	VMOVSD CPI0_28<>(SB), X15        // vmovsd	.LCPI0_28(%rip), %xmm15
+	VMOVQ  CPI0_29<>(SB), X14        // vmovq	.LCPI0_29(%rip), %xmm14
+	VMOVQ  CPI0_30<>(SB), X13        // vmovq	.LCPI0_30(%rip), %xmm13
+	VMOVSD CPI0_31<>(SB), X12        // vmovsd	.LCPI0_31(%rip), %xmm12
+	VMOVSD CPI0_32<>(SB), X11        // vmovsd	.LCPI0_32(%rip), %xmm11
+	VMOVSD CPI0_33<>(SB), X10        // vmovsd	.LCPI0_33(%rip), %xmm10
+	VMOVSD CPI0_34<>(SB), X9         // vmovsd	.LCPI0_34(%rip), %xmm9
+	VMOVSD CPI0_35<>(SB), X5         // vmovsd	.LCPI0_35(%rip), %xmm5
+	LONG   $0x6410fac5; WORD $0x1c24 // vmovss	28(%rsp), %xmm4
+	LONG   $0x44107ac5; WORD $0x1824 // vmovss	24(%rsp), %xmm8
+
+BB0_10:
+	LONG        $0x0c10fac5; BYTE $0x90               // vmovss	(%rax,%rdx,4), %xmm1
+	LONG        $0xc628f8c5                           // vmovaps	%xmm6, %xmm0
+	LONG        $0xcc5cf2c5                           // vsubss	%xmm4, %xmm1, %xmm1
+	LONG        $0x5972c1c4; BYTE $0xc8               // vmulss	%xmm8, %xmm1, %xmm1
+	VCOMISS     CPI0_26<>(SB), X1                     // vcomiss	.LCPI0_26(%rip), %xmm1
+	JA          BB0_9
+	LONG        $0xf92ff8c5                           // vcomiss	%xmm1, %xmm7
+	LONG        $0xc057f8c5                           // vxorps	%xmm0, %xmm0, %xmm0
+	JA          BB0_9
+	LONG        $0xc95af2c5                           // vcvtss2sd	%xmm1, %xmm1, %xmm1
+	LONG        $0x5973c1c4; BYTE $0xc7               // vmulsd	%xmm15, %xmm1, %xmm0
+	LONG        $0xd85489c5                           // vandpd	%xmm0, %xmm14, %xmm3
+	LONG        $0xdb5691c5                           // vorpd	%xmm3, %xmm13, %xmm3
+	LONG        $0xdb58fbc5                           // vaddsd	%xmm3, %xmm0, %xmm3
+	LONG        $0x0b61e3c4; WORD $0x03db             // vroundsd	$3, %xmm3, %xmm3, %xmm3
+	LONG        $0xbde1c2c4; BYTE $0xcc               // vfnmadd231sd	%xmm12, %xmm3, %xmm1
+	LONG        $0x2cfbe1c4; BYTE $0xfb               // vcvttsd2siq	%xmm3, %rdi
+	LONG        $0xffc78148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rdi
+	LONG        $0xbde1c2c4; BYTE $0xcb               // vfnmadd231sd	%xmm11, %xmm3, %xmm1
+	LONG        $0x34e7c148                           // salq	$52, %rdi
+	LONG        $0x6ef9e1c4; BYTE $0xdf               // vmovq	%rdi, %xmm3
+	LONG        $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG        $0x99b1c2c4; BYTE $0xc2               // vfmadd132sd	%xmm10, %xmm9, %xmm0
+	LONG        $0x99d1e2c4; BYTE $0xc1               // vfmadd132sd	%xmm1, %xmm5, %xmm0
+	VFMADD213SD CPI0_36<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_36(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_37<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_37(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_38<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_38(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_39<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_39(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_40<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_40(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_41<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_41(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_42<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_42(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_43<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_43(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_44<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_44(%rip), %xmm1, %xmm0
+	VFMADD213SD CPI0_44<>(SB), X1, X0                 // vfmadd213sd	.LCPI0_44(%rip), %xmm1, %xmm0
+	LONG        $0xc359fbc5                           // vmulsd	%xmm3, %xmm0, %xmm0
+	LONG        $0xc05afbc5                           // vcvtsd2ss	%xmm0, %xmm0, %xmm0
+
+BB0_9:
+	LONG   $0x0411fac5; BYTE $0x96 // vmovss	%xmm0, (%rsi,%rdx,4)
+	LONG   $0x01c28348             // addq	$1, %rdx
+	LONG   $0xd058eac5             // vaddss	%xmm0, %xmm2, %xmm2
+	WORD   $0x3948; BYTE $0xd1     // cmpq	%rdx, %rcx
+	JNE    BB0_10
+	VMOVSS CPI0_2<>(SB), X7        // vmovss	.LCPI0_2(%rip), %xmm7
+	LONG   $0xd25ec2c5             // vdivss	%xmm2, %xmm7, %xmm2
+	LONG   $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG   $0x07f98348             // cmpq	$7, %rcx
+	JLE    BB0_44
+
+BB0_11:
+	LONG $0xf8518d48             // leaq	-8(%rcx), %rdx
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	LONG $0x03eac148             // shrq	$3, %rdx
+	WORD $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	LONG $0x05e7c148             // salq	$5, %rdi
+	LONG $0x3e7c8d48; BYTE $0x20 // leaq	32(%rsi,%rdi), %rdi
+
+BB0_14:
+	LONG $0x0059f4c5             // vmulps	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fcc5; BYTE $0xe0 // vmovups	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xf8     // cmpq	%rdi, %rax
+	JNE  BB0_14
+	LONG $0x01c28348             // addq	$1, %rdx
+	QUAD $0x00000000d53c8d48     // leaq	0(,%rdx,8), %rdi
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_38
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	WORD $0x8949; BYTE $0xf8     // movq	%rdi, %r8
+	WORD $0x2948; BYTE $0xf8     // subq	%rdi, %rax
+	LONG $0xff488d4c             // leaq	-1(%rax), %r9
+	LONG $0x06f98349             // cmpq	$6, %r9
+	JBE  BB0_23
+	LONG $0x05e2c148             // salq	$5, %rdx
+	WORD $0x0148; BYTE $0xf2     // addq	%rsi, %rdx
+	LONG $0x0a59f4c5             // vmulps	(%rdx), %ymm1, %ymm1
+	LONG $0x0a11fcc5             // vmovups	%ymm1, (%rdx)
+	WORD $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+	LONG $0xf8e28348             // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd7     // addq	%rdx, %rdi
+	WORD $0x07a8                 // testb	$7, %al
+	JE   BB0_38
+
+BB0_12:
+	WORD $0x2948; BYTE $0xd0     // subq	%rdx, %rax
+	LONG $0xff488d4c             // leaq	-1(%rax), %r9
+	LONG $0x02f98349             // cmpq	$2, %r9
+	JBE  BB0_16
+	WORD $0x014c; BYTE $0xc2     // addq	%r8, %rdx
+	LONG $0xc2c6e8c5; BYTE $0x00 // vshufps	$0, %xmm2, %xmm2, %xmm0
+	LONG $0x96148d48             // leaq	(%rsi,%rdx,4), %rdx
+	LONG $0x0259f8c5             // vmulps	(%rdx), %xmm0, %xmm0
+	LONG $0x0211f8c5             // vmovups	%xmm0, (%rdx)
+	WORD $0x03a8                 // testb	$3, %al
+	JE   BB0_38
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc7     // addq	%rax, %rdi
+
+BB0_16:
+	QUAD $0x00000000bd048d48     // leaq	0(,%rdi,4), %rax
+	LONG $0x06148d48             // leaq	(%rsi,%rax), %rdx
+	LONG $0x0259eac5             // vmulss	(%rdx), %xmm2, %xmm0
+	LONG $0x0211fac5             // vmovss	%xmm0, (%rdx)
+	LONG $0x01578d48             // leaq	1(%rdi), %rdx
+	WORD $0x3948; BYTE $0xca     // cmpq	%rcx, %rdx
+	JGE  BB0_38
+	LONG $0x06548d48; BYTE $0x04 // leaq	4(%rsi,%rax), %rdx
+	LONG $0x02c78348             // addq	$2, %rdi
+	LONG $0x0259eac5             // vmulss	(%rdx), %xmm2, %xmm0
+	LONG $0x0211fac5             // vmovss	%xmm0, (%rdx)
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_38
+	LONG $0x06448d48; BYTE $0x08 // leaq	8(%rsi,%rax), %rax
+	LONG $0x1059eac5             // vmulss	(%rax), %xmm2, %xmm2
+	LONG $0x1011fac5             // vmovss	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0xd0658d48             // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_8:
+	VMOVSS CPI0_2<>(SB), X7        // vmovss	.LCPI0_2(%rip), %xmm7
+	LONG   $0xd25ec2c5             // vdivss	%xmm2, %xmm7, %xmm2
+	LONG   $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG   $0x07f98348             // cmpq	$7, %rcx
+	JG     BB0_11
+	WORD   $0x8548; BYTE $0xc9     // testq	%rcx, %rcx
+	JG     BB0_44
+
+BB0_38:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	LONG $0xd0658d48         // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_41:
+	RET
+
+BB0_19:
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xe457d8c5 // vxorps	%xmm4, %xmm4, %xmm4
+	JMP  BB0_3
+
+BB0_44:
+	WORD $0x8948; BYTE $0xc8 // movq	%rcx, %rax
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	WORD $0xd231             // xorl	%edx, %edx
+	WORD $0xff31             // xorl	%edi, %edi
+	JMP  BB0_12
+
+BB0_6:
+	LONG $0xd257e8c5 // vxorps	%xmm2, %xmm2, %xmm2
+	WORD $0xd231     // xorl	%edx, %edx
+	JMP  BB0_18
+
+BB0_23:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_12
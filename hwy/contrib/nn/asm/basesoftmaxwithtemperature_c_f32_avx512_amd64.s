@@ -0,0 +1,715 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/nn/asm/basesoftmaxwithtemperature_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_0<>+0(SB)/4, $0x7f800000
+GLOBL CPI0_0<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_10<>+0(SB)/4, $0x3f318000
+GLOBL CPI0_10<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_12<>+0(SB)/4, $0xb95e8083
+GLOBL CPI0_12<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_14<>+0(SB)/4, $0x3ab60b61
+GLOBL CPI0_14<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_16<>+0(SB)/4, $0x3c088889
+GLOBL CPI0_16<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_18<>+0(SB)/4, $0x3d2aaaab
+GLOBL CPI0_18<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_2<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_2<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_20<>+0(SB)/4, $0x3e2aaaab
+GLOBL CPI0_20<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_22<>+0(SB)/4, $0x3f000000
+GLOBL CPI0_22<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_27<>+0(SB)/4, $0x652b82fe
+DATA CPI0_27<>+4(SB)/4, $0x3ff71547
+GLOBL CPI0_27<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_33<>+0(SB)/4, $0xfee00000
+DATA CPI0_33<>+4(SB)/4, $0x3fe62e42
+GLOBL CPI0_33<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_35<>+0(SB)/4, $0x35793c6c
+DATA CPI0_35<>+4(SB)/4, $0x3dea39ef
+GLOBL CPI0_35<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_37<>+0(SB)/4, $0xeff8d898
+DATA CPI0_37<>+4(SB)/4, $0x3e21eed8
+GLOBL CPI0_37<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_39<>+0(SB)/4, $0x67f544e4
+DATA CPI0_39<>+4(SB)/4, $0x3e5ae645
+GLOBL CPI0_39<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_4<>+0(SB)/4, $0x42b17218
+GLOBL CPI0_4<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_41<>+0(SB)/4, $0xb7789f5c
+DATA CPI0_41<>+4(SB)/4, $0x3e927e4f
+GLOBL CPI0_41<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_43<>+0(SB)/4, $0xa556c734
+DATA CPI0_43<>+4(SB)/4, $0x3ec71de3
+GLOBL CPI0_43<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_45<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_45<>+4(SB)/4, $0x3efa01a0
+GLOBL CPI0_45<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_47<>+0(SB)/4, $0x1a01a01a
+DATA CPI0_47<>+4(SB)/4, $0x3f2a01a0
+GLOBL CPI0_47<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_49<>+0(SB)/4, $0x16c16c17
+DATA CPI0_49<>+4(SB)/4, $0x3f56c16c
+GLOBL CPI0_49<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_51<>+0(SB)/4, $0x11111111
+DATA CPI0_51<>+4(SB)/4, $0x3f811111
+GLOBL CPI0_51<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_53<>+0(SB)/4, $0x55555555
+DATA CPI0_53<>+4(SB)/4, $0x3fa55555
+GLOBL CPI0_53<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_55<>+0(SB)/4, $0x55555555
+DATA CPI0_55<>+4(SB)/4, $0x3fc55555
+GLOBL CPI0_55<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_57<>+0(SB)/4, $0x00000000
+DATA CPI0_57<>+4(SB)/4, $0x3fe00000
+GLOBL CPI0_57<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_59<>+0(SB)/4, $0x00000000
+DATA CPI0_59<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_59<>(SB), (RODATA|NOPTR), $8
+DATA CPI0_6<>+0(SB)/4, $0xc2aeac50
+GLOBL CPI0_6<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_62<>+0(SB)/4, $0x44314000
+GLOBL CPI0_62<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_63<>+0(SB)/4, $0xc4314000
+DATA CPI0_63<>+4(SB)/4, $0xc4314000
+DATA CPI0_63<>+8(SB)/4, $0xc4314000
+DATA CPI0_63<>+12(SB)/4, $0xc4314000
+DATA CPI0_63<>+16(SB)/4, $0xc4314000
+DATA CPI0_63<>+20(SB)/4, $0xc4314000
+DATA CPI0_63<>+24(SB)/4, $0xc4314000
+DATA CPI0_63<>+28(SB)/4, $0xc4314000
+DATA CPI0_63<>+32(SB)/4, $0xc4314000
+DATA CPI0_63<>+36(SB)/4, $0xc4314000
+DATA CPI0_63<>+40(SB)/4, $0xc4314000
+DATA CPI0_63<>+44(SB)/4, $0xc4314000
+DATA CPI0_63<>+48(SB)/4, $0xc4314000
+DATA CPI0_63<>+52(SB)/4, $0xc4314000
+DATA CPI0_63<>+56(SB)/4, $0xc4314000
+DATA CPI0_63<>+60(SB)/4, $0xc4314000
+GLOBL CPI0_63<>(SB), (RODATA|NOPTR), $64
+DATA CPI0_8<>+0(SB)/4, $0x3fb8aa3b
+GLOBL CPI0_8<>(SB), (RODATA|NOPTR), $4
+DATA CPI0_86<>+0(SB)/4, $0x00000000
+DATA CPI0_86<>+4(SB)/4, $0x80000000
+DATA CPI0_86<>+8(SB)/4, $0x00000000
+DATA CPI0_86<>+12(SB)/4, $0x00000000
+GLOBL CPI0_86<>(SB), (RODATA|NOPTR), $16
+DATA CPI0_87<>+0(SB)/4, $0xffffffff
+DATA CPI0_87<>+4(SB)/4, $0x3fdfffff
+DATA CPI0_87<>+8(SB)/4, $0x00000000
+DATA CPI0_87<>+12(SB)/4, $0x00000000
+GLOBL CPI0_87<>(SB), (RODATA|NOPTR), $16
+
+TEXT ·softmaxwithtemperature_c_f32_avx512(SB), $0-32
+	MOVQ   input+0(FP), DI
+	MOVQ   output+8(FP), SI
+	MOVQ   ptemperature+16(FP), DX
+	MOVQ   plen_input+24(FP), CX
+	WORD   $0x8b48; BYTE $0x09 // movq	(%rcx), %rcx
+	WORD   $0x8548; BYTE $0xc9 // testq	%rcx, %rcx
+	JE     BB0_69
+	VMOVSS CPI0_2<>(SB), X7    // vmovss	.LCPI0_2(%rip), %xmm7
+	WORD   $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	WORD   $0x8948; BYTE $0xe5 // movq	%rsp, %rbp
+	LONG   $0x07107ac5         // vmovss	(%rdi), %xmm8
+	LONG   $0x125e42c5         // vdivss	(%rdx), %xmm7, %xmm10
+	LONG   $0x01f98348         // cmpq	$1, %rcx
+	JLE    BB0_31
+	LONG   $0x04578d48         // leaq	4(%rdi), %rdx
+	LONG   $0x8f3c8d48         // leaq	(%rdi,%rcx,4), %rdi
+
+BB0_5:
+	LONG         $0x0210fac5               // vmovss	(%rdx), %xmm0
+	LONG         $0x04c28348               // addq	$4, %rdx
+	LONG         $0x5f7a41c4; BYTE $0xc0   // vmaxss	%xmm8, %xmm0, %xmm8
+	WORD         $0x3948; BYTE $0xd7       // cmpq	%rdx, %rdi
+	JNE          BB0_5
+	LONG         $0x487dd262; WORD $0xe818 // vbroadcastss	%xmm8, %zmm5
+	LONG         $0x487dd262; WORD $0xf218 // vbroadcastss	%xmm10, %zmm6
+	LONG         $0x0ff98348               // cmpq	$15, %rcx
+	JLE          BB0_31
+	LONG         $0xd257e8c5               // vxorps	%xmm2, %xmm2, %xmm2
+	LONG         $0x00007fbf; BYTE $0x00   // movl	$127, %edi
+	VBROADCASTSS CPI0_4<>(SB), Z20         // vbroadcastss	.LCPI0_4(%rip), %zmm20
+	VBROADCASTSS CPI0_6<>(SB), Z19         // vbroadcastss	.LCPI0_6(%rip), %zmm19
+	VBROADCASTSS CPI0_8<>(SB), Z18         // vbroadcastss	.LCPI0_8(%rip), %zmm18
+	LONG         $0x000010ba; BYTE $0x00   // movl	$16, %edx
+	VBROADCASTSS CPI0_10<>(SB), Z17        // vbroadcastss	.LCPI0_10(%rip), %zmm17
+	LONG         $0x487df262; WORD $0xe77c // vpbroadcastd	%edi, %zmm4
+	VBROADCASTSS CPI0_12<>(SB), Z16        // vbroadcastss	.LCPI0_12(%rip), %zmm16
+	LONG         $0x487cf162; WORD $0xfa28 // vmovaps	%zmm2, %zmm7
+	VBROADCASTSS CPI0_14<>(SB), Z15        // vbroadcastss	.LCPI0_14(%rip), %zmm15
+	VBROADCASTSS CPI0_16<>(SB), Z14        // vbroadcastss	.LCPI0_16(%rip), %zmm14
+	VBROADCASTSS CPI0_18<>(SB), Z13        // vbroadcastss	.LCPI0_18(%rip), %zmm13
+	VBROADCASTSS CPI0_20<>(SB), Z12        // vbroadcastss	.LCPI0_20(%rip), %zmm12
+	VBROADCASTSS CPI0_22<>(SB), Z9         // vbroadcastss	.LCPI0_22(%rip), %zmm9
+	VBROADCASTSS CPI0_2<>(SB), Z3          // vbroadcastss	.LCPI0_2(%rip), %zmm3
+	VBROADCASTSS CPI0_0<>(SB), Z11         // vbroadcastss	.LCPI0_0(%rip), %zmm11
+
+BB0_6:
+	QUAD $0xff904410487cf162                   // vmovups	-64(%rax,%rdx,4), %zmm0
+	LONG $0x487cf162; WORD $0xcd5c             // vsubps	%zmm5, %zmm0, %zmm1
+	LONG $0x487cd162; WORD $0xc728             // vmovaps	%zmm15, %zmm0
+	LONG $0x4874f162; WORD $0xce59             // vmulps	%zmm6, %zmm1, %zmm1
+	LONG $0x4874a162; WORD $0xea59             // vmulps	%zmm18, %zmm1, %zmm21
+	LONG $0x4874b162; WORD $0xd4c2; BYTE $0x1e // vcmpps	$30, %zmm20, %zmm1, %k2
+	LONG $0x4874b162; WORD $0xcbc2; BYTE $0x11 // vcmpps	$17, %zmm19, %zmm1, %k1
+	LONG $0x487da362; WORD $0xed08; BYTE $0x08 // vrndscaleps	$8, %zmm21, %zmm21
+	LONG $0x4055b262; WORD $0xc9bc             // vfnmadd231ps	%zmm17, %zmm21, %zmm1
+	LONG $0x4055b262; WORD $0xc8bc             // vfnmadd231ps	%zmm16, %zmm21, %zmm1
+	LONG $0x487da162; WORD $0xed5b             // vcvtps2dq	%zmm21, %zmm21
+	LONG $0x4055e162; WORD $0xecfe             // vpaddd	%zmm4, %zmm21, %zmm21
+	LONG $0x4055b162; WORD $0xf572; BYTE $0x17 // vpslld	$23, %zmm21, %zmm21
+	LONG $0x480df262; WORD $0xc198             // vfmadd132ps	%zmm1, %zmm14, %zmm0
+	LONG $0x4815f262; WORD $0xc198             // vfmadd132ps	%zmm1, %zmm13, %zmm0
+	LONG $0x481df262; WORD $0xc198             // vfmadd132ps	%zmm1, %zmm12, %zmm0
+	LONG $0x4835f262; WORD $0xc198             // vfmadd132ps	%zmm1, %zmm9, %zmm0
+	LONG $0x4865f262; WORD $0xc198             // vfmadd132ps	%zmm1, %zmm3, %zmm0
+	LONG $0x4865f262; WORD $0xc198             // vfmadd132ps	%zmm1, %zmm3, %zmm0
+	LONG $0x487cb162; WORD $0xc559             // vmulps	%zmm21, %zmm0, %zmm0
+	LONG $0x4a7cd162; WORD $0xc328             // vmovaps	%zmm11, %zmm0{%k2}
+	LONG $0x497cf162; WORD $0xc728             // vmovaps	%zmm7, %zmm0{%k1}
+	QUAD $0xff964411487cf162                   // vmovups	%zmm0, -64(%rsi,%rdx,4)
+	LONG $0x10c28348                           // addq	$16, %rdx
+	LONG $0x486cf162; WORD $0xd058             // vaddps	%zmm0, %zmm2, %zmm2
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_6
+	LONG $0xf0518d48                           // leaq	-16(%rcx), %rdx
+	LONG $0xf0e28348                           // andq	$-16, %rdx
+	LONG $0x10c28348                           // addq	$16, %rdx
+
+BB0_3:
+	LONG $0x48fdf362; WORD $0xd01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm0
+	LONG $0xc258fcc5                           // vaddps	%ymm2, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc128f8c5                           // vmovaps	%xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JLE  BB0_7
+	WORD $0x8949; BYTE $0xc8                   // movq	%rcx, %r8
+	WORD $0x8949; BYTE $0xd3                   // movq	%rdx, %r11
+	WORD $0x2949; BYTE $0xd0                   // subq	%rdx, %r8
+	LONG $0xff788d49                           // leaq	-1(%r8), %rdi
+	LONG $0x06ff8348                           // cmpq	$6, %rdi
+	JBE  BB0_8
+	QUAD $0x00000000950c8d4c                   // leaq	0(,%rdx,4), %r9
+	LONG $0x0e1c8d4a                           // leaq	(%rsi,%r9), %rbx
+	LONG $0x08648d4e; BYTE $0x04               // leaq	4(%rax,%r9), %r12
+	WORD $0x8949; BYTE $0xda                   // movq	%rbx, %r10
+	WORD $0x294d; BYTE $0xe2                   // subq	%r12, %r10
+	LONG $0x38fa8349                           // cmpq	$56, %r10
+	JA   BB0_75
+
+BB0_8:
+	VMOVSS CPI0_63<>(SB), X3  // vmovss	.LCPI0_63(%rip), %xmm3
+	VMOVSD CPI0_27<>(SB), X13 // vmovsd	.LCPI0_27(%rip), %xmm13
+	VMOVQ  CPI0_86<>(SB), X12 // vmovq	.LCPI0_86(%rip), %xmm12
+	VMOVQ  CPI0_87<>(SB), X11 // vmovq	.LCPI0_87(%rip), %xmm11
+	VMOVSD CPI0_33<>(SB), X9  // vmovsd	.LCPI0_33(%rip), %xmm9
+	VMOVSD CPI0_35<>(SB), X7  // vmovsd	.LCPI0_35(%rip), %xmm7
+	VMOVSD CPI0_37<>(SB), X6  // vmovsd	.LCPI0_37(%rip), %xmm6
+	VMOVSD CPI0_39<>(SB), X5  // vmovsd	.LCPI0_39(%rip), %xmm5
+	VMOVSD CPI0_41<>(SB), X4  // vmovsd	.LCPI0_41(%rip), %xmm4
+
+BB0_22:
+	LONG        $0x1410fac5; BYTE $0x90               // vmovss	(%rax,%rdx,4), %xmm2
+	VMOVSS      CPI0_0<>(SB), X1                      // vmovss	.LCPI0_0(%rip), %xmm1
+	LONG        $0x5c6ac1c4; BYTE $0xd0               // vsubss	%xmm8, %xmm2, %xmm2
+	LONG        $0x596ac1c4; BYTE $0xd2               // vmulss	%xmm10, %xmm2, %xmm2
+	VCOMISS     CPI0_62<>(SB), X2                     // vcomiss	.LCPI0_62(%rip), %xmm2
+	JA          BB0_21
+	LONG        $0xda2ff8c5                           // vcomiss	%xmm2, %xmm3
+	LONG        $0xc957f0c5                           // vxorps	%xmm1, %xmm1, %xmm1
+	JA          BB0_21
+	LONG        $0xd25aeac5                           // vcvtss2sd	%xmm2, %xmm2, %xmm2
+	LONG        $0x596bc1c4; BYTE $0xcd               // vmulsd	%xmm13, %xmm2, %xmm1
+	LONG        $0x287941c4; BYTE $0xfb               // vmovapd	%xmm11, %xmm15
+	LONG        $0x08f55362; WORD $0xfc25; BYTE $0xf8 // vpternlogq	$248, %xmm12, %xmm1, %xmm15
+	LONG        $0x587341c4; BYTE $0xf7               // vaddsd	%xmm15, %xmm1, %xmm14
+	VMOVSD      CPI0_59<>(SB), X15                    // vmovsd	.LCPI0_59(%rip), %xmm15
+	LONG        $0x088d5362; WORD $0xf60b; BYTE $0x03 // vrndscalesd	$3, %xmm14, %xmm14, %xmm14
+	LONG        $0xbd89c2c4; BYTE $0xd1               // vfnmadd231sd	%xmm9, %xmm14, %xmm2
+	LONG        $0x2cfbc1c4; BYTE $0xfe               // vcvttsd2siq	%xmm14, %rdi
+	LONG        $0xffc78148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rdi
+	LONG        $0xbd89e2c4; BYTE $0xd7               // vfnmadd231sd	%xmm7, %xmm14, %xmm2
+	LONG        $0x34e7c148                           // salq	$52, %rdi
+	LONG        $0xca10ebc5                           // vmovsd	%xmm2, %xmm2, %xmm1
+	LONG        $0x99d1e2c4; BYTE $0xce               // vfmadd132sd	%xmm6, %xmm5, %xmm1
+	LONG        $0x99d9e2c4; BYTE $0xca               // vfmadd132sd	%xmm2, %xmm4, %xmm1
+	VFMADD213SD CPI0_43<>(SB), X2, X1                 // vfmadd213sd	.LCPI0_43(%rip), %xmm2, %xmm1
+	VFMADD213SD CPI0_45<>(SB), X2, X1                 // vfmadd213sd	.LCPI0_45(%rip), %xmm2, %xmm1
+	VFMADD213SD CPI0_47<>(SB), X2, X1                 // vfmadd213sd	.LCPI0_47(%rip), %xmm2, %xmm1
+	VFMADD213SD CPI0_49<>(SB), X2, X1                 // vfmadd213sd	.LCPI0_49(%rip), %xmm2, %xmm1
+	VFMADD213SD CPI0_51<>(SB), X2, X1                 // vfmadd213sd	.LCPI0_51(%rip), %xmm2, %xmm1
+	VFMADD213SD CPI0_53<>(SB), X2, X1                 // vfmadd213sd	.LCPI0_53(%rip), %xmm2, %xmm1
+	VFMADD213SD CPI0_55<>(SB), X2, X1                 // vfmadd213sd	.LCPI0_55(%rip), %xmm2, %xmm1
+	VFMADD213SD CPI0_57<>(SB), X2, X1                 // vfmadd213sd	.LCPI0_57(%rip), %xmm2, %xmm1
+	LONG        $0x9981e2c4; BYTE $0xca               // vfmadd132sd	%xmm2, %xmm15, %xmm1
+	LONG        $0x9981e2c4; BYTE $0xca               // vfmadd132sd	%xmm2, %xmm15, %xmm1
+	LONG        $0x6ef9e1c4; BYTE $0xd7               // vmovq	%rdi, %xmm2
+	LONG        $0xca59f3c5                           // vmulsd	%xmm2, %xmm1, %xmm1
+	LONG        $0xc95af3c5                           // vcvtsd2ss	%xmm1, %xmm1, %xmm1
+
+BB0_21:
+	LONG $0x0c11fac5; BYTE $0x96 // vmovss	%xmm1, (%rsi,%rdx,4)
+	LONG $0x01c28348             // addq	$1, %rdx
+	LONG $0xc158fac5             // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd1     // cmpq	%rdx, %rcx
+	JNE  BB0_22
+
+BB0_73:
+	VMOVSS CPI0_2<>(SB), X7          // vmovss	.LCPI0_2(%rip), %xmm7
+	LONG   $0xc85ec2c5               // vdivss	%xmm0, %xmm7, %xmm1
+	LONG   $0x487df262; WORD $0xd118 // vbroadcastss	%xmm1, %zmm2
+	LONG   $0x0ff98348               // cmpq	$15, %rcx
+	JLE    BB0_13
+
+BB0_12:
+	LONG $0xf0518d48             // leaq	-16(%rcx), %rdx
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	LONG $0x04eac148             // shrq	$4, %rdx
+	WORD $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	LONG $0x06e7c148             // salq	$6, %rdi
+	LONG $0x3e7c8d48; BYTE $0x40 // leaq	64(%rsi,%rdi), %rdi
+
+BB0_25:
+	LONG $0x486cf162; WORD $0x0059             // vmulps	(%rax), %zmm2, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xc7                   // cmpq	%rax, %rdi
+	JNE  BB0_25
+	LONG $0x01c28348                           // addq	$1, %rdx
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x04e0c148                           // salq	$4, %rax
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_66
+	WORD $0x8948; BYTE $0xcf                   // movq	%rcx, %rdi
+	WORD $0x8949; BYTE $0xc0                   // movq	%rax, %r8
+	WORD $0x2948; BYTE $0xc7                   // subq	%rax, %rdi
+	LONG $0xff4f8d4c                           // leaq	-1(%rdi), %r9
+	LONG $0x0ef98349                           // cmpq	$14, %r9
+	JBE  BB0_36
+	LONG $0x06e2c148                           // salq	$6, %rdx
+	WORD $0x8949; BYTE $0xf9                   // movq	%rdi, %r9
+	WORD $0x0148; BYTE $0xf2                   // addq	%rsi, %rdx
+	LONG $0xf0e18349                           // andq	$-16, %r9
+	LONG $0x486cf162; WORD $0x1259             // vmulps	(%rdx), %zmm2, %zmm2
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+	LONG $0x487cf162; WORD $0x1211             // vmovups	%zmm2, (%rdx)
+	LONG $0x0fc7f640                           // testb	$15, %dil
+	JE   BB0_66
+
+BB0_23:
+	WORD $0x294c; BYTE $0xcf     // subq	%r9, %rdi
+	WORD $0x8948; BYTE $0xfa     // movq	%rdi, %rdx
+	LONG $0xff7f8d48             // leaq	-1(%rdi), %rdi
+	LONG $0x06ff8348             // cmpq	$6, %rdi
+	JBE  BB0_27
+	LONG $0x083c8d4b             // leaq	(%r8,%r9), %rdi
+	LONG $0x187de2c4; BYTE $0xc1 // vbroadcastss	%xmm1, %ymm0
+	LONG $0xbe3c8d48             // leaq	(%rsi,%rdi,4), %rdi
+	LONG $0x0759fcc5             // vmulps	(%rdi), %ymm0, %ymm0
+	LONG $0x0711fcc5             // vmovups	%ymm0, (%rdi)
+	WORD $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	LONG $0xf8e78348             // andq	$-8, %rdi
+	WORD $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	WORD $0xe283; BYTE $0x07     // andl	$7, %edx
+	JE   BB0_66
+
+BB0_27:
+	QUAD $0x0000000085148d48     // leaq	0(,%rax,4), %rdx
+	LONG $0x163c8d48             // leaq	(%rsi,%rdx), %rdi
+	LONG $0x0759f2c5             // vmulss	(%rdi), %xmm1, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x01788d48             // leaq	1(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_66
+	LONG $0x167c8d48; BYTE $0x04 // leaq	4(%rsi,%rdx), %rdi
+	LONG $0x0759f2c5             // vmulss	(%rdi), %xmm1, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x02788d48             // leaq	2(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_66
+	LONG $0x167c8d48; BYTE $0x08 // leaq	8(%rsi,%rdx), %rdi
+	LONG $0x0759f2c5             // vmulss	(%rdi), %xmm1, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x03788d48             // leaq	3(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_66
+	LONG $0x167c8d48; BYTE $0x0c // leaq	12(%rsi,%rdx), %rdi
+	LONG $0x0759f2c5             // vmulss	(%rdi), %xmm1, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x04788d48             // leaq	4(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_66
+	LONG $0x167c8d48; BYTE $0x10 // leaq	16(%rsi,%rdx), %rdi
+	LONG $0x0759f2c5             // vmulss	(%rdi), %xmm1, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x05788d48             // leaq	5(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_66
+	LONG $0x167c8d48; BYTE $0x14 // leaq	20(%rsi,%rdx), %rdi
+	LONG $0x06c08348             // addq	$6, %rax
+	LONG $0x0759f2c5             // vmulss	(%rdi), %xmm1, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JLE  BB0_66
+	LONG $0x16448d48; BYTE $0x18 // leaq	24(%rsi,%rdx), %rax
+	LONG $0x0859f2c5             // vmulss	(%rax), %xmm1, %xmm1
+	LONG $0x0811fac5             // vmovss	%xmm1, (%rax)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_75:
+	LONG         $0x0eff8348               // cmpq	$14, %rdi
+	JBE          BB0_32
+	WORD         $0x894d; BYTE $0xc2       // movq	%r8, %r10
+	LONG         $0x03ffbc41; WORD $0x0000 // movl	$1023, %r12d
+	WORD         $0x0149; BYTE $0xc1       // addq	%rax, %r9
+	WORD         $0xff31                   // xorl	%edi, %edi
+	LONG         $0x04eac149               // shrq	$4, %r10
+	LONG         $0x487d4262; WORD $0xf818 // vbroadcastss	%xmm8, %zmm31
+	VBROADCASTSS CPI0_0<>(SB), Z11         // vbroadcastss	.LCPI0_0(%rip), %zmm11
+	VBROADCASTSD CPI0_27<>(SB), Z29        // vbroadcastsd	.LCPI0_27(%rip), %zmm29
+	VBROADCASTSD CPI0_87<>(SB), Z28        // vbroadcastsd	.LCPI0_87(%rip), %zmm28
+	LONG         $0x487d4262; WORD $0xf218 // vbroadcastss	%xmm10, %zmm30
+	VBROADCASTSD CPI0_86<>(SB), Z27        // vbroadcastsd	.LCPI0_86(%rip), %zmm27
+	LONG         $0x06e2c149               // salq	$6, %r10
+	VBROADCASTSD CPI0_33<>(SB), Z26        // vbroadcastsd	.LCPI0_33(%rip), %zmm26
+	LONG         $0x48fd5262; WORD $0xe47c // vpbroadcastq	%r12, %zmm12
+	VBROADCASTSD CPI0_35<>(SB), Z25        // vbroadcastsd	.LCPI0_35(%rip), %zmm25
+	VBROADCASTSD CPI0_37<>(SB), Z24        // vbroadcastsd	.LCPI0_37(%rip), %zmm24
+	VBROADCASTSD CPI0_39<>(SB), Z23        // vbroadcastsd	.LCPI0_39(%rip), %zmm23
+	VBROADCASTSD CPI0_41<>(SB), Z22        // vbroadcastsd	.LCPI0_41(%rip), %zmm22
+	VBROADCASTSD CPI0_43<>(SB), Z21        // vbroadcastsd	.LCPI0_43(%rip), %zmm21
+	VBROADCASTSD CPI0_45<>(SB), Z20        // vbroadcastsd	.LCPI0_45(%rip), %zmm20
+	VBROADCASTSD CPI0_47<>(SB), Z19        // vbroadcastsd	.LCPI0_47(%rip), %zmm19
+	VBROADCASTSD CPI0_49<>(SB), Z18        // vbroadcastsd	.LCPI0_49(%rip), %zmm18
+	VBROADCASTSD CPI0_51<>(SB), Z17        // vbroadcastsd	.LCPI0_51(%rip), %zmm17
+	VBROADCASTSD CPI0_53<>(SB), Z16        // vbroadcastsd	.LCPI0_53(%rip), %zmm16
+	VBROADCASTSD CPI0_55<>(SB), Z15        // vbroadcastsd	.LCPI0_55(%rip), %zmm15
+	VBROADCASTSD CPI0_57<>(SB), Z14        // vbroadcastsd	.LCPI0_57(%rip), %zmm14
+	VBROADCASTSD CPI0_59<>(SB), Z9         // vbroadcastsd	.LCPI0_59(%rip), %zmm9
+	VBROADCASTSS CPI0_62<>(SB), Z13        // vbroadcastss	.LCPI0_62(%rip), %zmm13
+
+BB0_10:
+	LONG   $0x487cd162; WORD $0x3c10; BYTE $0x39 // vmovups	(%r9,%rdi), %zmm7
+	LONG   $0x48fd9162; WORD $0xd428             // vmovapd	%zmm28, %zmm2
+	LONG   $0x48449162; WORD $0xff5c             // vsubps	%zmm31, %zmm7, %zmm7
+	LONG   $0x48449162; WORD $0xfe59             // vmulps	%zmm30, %zmm7, %zmm7
+	LONG   $0x487cf162; WORD $0xcf5a             // vcvtps2pd	%ymm7, %zmm1
+	LONG   $0x48f59162; WORD $0xe559             // vmulpd	%zmm29, %zmm1, %zmm4
+	LONG   $0x487df362; WORD $0xfd1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm7, %ymm5
+	LONG   $0x487cf162; WORD $0xed5a             // vcvtps2pd	%ymm5, %zmm5
+	LONG   $0x48d59162; WORD $0xf559             // vmulpd	%zmm29, %zmm5, %zmm6
+	VCMPPS $5, CPI0_63<>(SB), Z7, K1             // vcmpps	$5, .LCPI0_63(%rip), %zmm7, %k1
+	LONG   $0x4814f162; WORD $0xd7c2; BYTE $0x01 // vcmpps	$1, %zmm7, %zmm13, %k2
+	LONG   $0x4944d162; WORD $0xcdc2; BYTE $0x0a // vcmpps	$10, %zmm13, %zmm7, %k1{%k1}
+	LONG   $0x48dd9362; WORD $0xd325; BYTE $0xf8 // vpternlogq	$248, %zmm27, %zmm4, %zmm2
+	LONG   $0x48ddf162; WORD $0xe258             // vaddpd	%zmm2, %zmm4, %zmm4
+	LONG   $0x48fd9162; WORD $0xd428             // vmovapd	%zmm28, %zmm2
+	LONG   $0x48cd9362; WORD $0xd325; BYTE $0xf8 // vpternlogq	$248, %zmm27, %zmm6, %zmm2
+	LONG   $0x48cdf162; WORD $0xf258             // vaddpd	%zmm2, %zmm6, %zmm6
+	LONG   $0x48fdf362; WORD $0xe409; BYTE $0x03 // vrndscalepd	$3, %zmm4, %zmm4
+	LONG   $0x48fdf362; WORD $0xf609; BYTE $0x03 // vrndscalepd	$3, %zmm6, %zmm6
+	LONG   $0x48dd9262; WORD $0xcabc             // vfnmadd231pd	%zmm26, %zmm4, %zmm1
+	LONG   $0x48cd9262; WORD $0xeabc             // vfnmadd231pd	%zmm26, %zmm6, %zmm5
+	LONG   $0x48dd9262; WORD $0xc9bc             // vfnmadd231pd	%zmm25, %zmm4, %zmm1
+	LONG   $0x48fdf162; WORD $0xe47a             // vcvttpd2qq	%zmm4, %zmm4
+	LONG   $0x48ddd162; WORD $0xe4d4             // vpaddq	%zmm12, %zmm4, %zmm4
+	LONG   $0x48ddf162; WORD $0xf473; BYTE $0x34 // vpsllq	$52, %zmm4, %zmm4
+	LONG   $0x48cd9262; WORD $0xe9bc             // vfnmadd231pd	%zmm25, %zmm6, %zmm5
+	LONG   $0x48fdf162; WORD $0xf67a             // vcvttpd2qq	%zmm6, %zmm6
+	LONG   $0x48cdd162; WORD $0xf4d4             // vpaddq	%zmm12, %zmm6, %zmm6
+	LONG   $0x48cdf162; WORD $0xf673; BYTE $0x34 // vpsllq	$52, %zmm6, %zmm6
+	LONG   $0x48fdf162; WORD $0xd928             // vmovapd	%zmm1, %zmm3
+	LONG   $0x40c59262; WORD $0xd898             // vfmadd132pd	%zmm24, %zmm23, %zmm3
+	LONG   $0x48fdf162; WORD $0xd528             // vmovapd	%zmm5, %zmm2
+	LONG   $0x40c59262; WORD $0xd098             // vfmadd132pd	%zmm24, %zmm23, %zmm2
+	LONG   $0x40cdf262; WORD $0xd998             // vfmadd132pd	%zmm1, %zmm22, %zmm3
+	LONG   $0x40cdf262; WORD $0xd598             // vfmadd132pd	%zmm5, %zmm22, %zmm2
+	LONG   $0x40d5f262; WORD $0xd998             // vfmadd132pd	%zmm1, %zmm21, %zmm3
+	LONG   $0x40d5f262; WORD $0xd598             // vfmadd132pd	%zmm5, %zmm21, %zmm2
+	LONG   $0x40ddf262; WORD $0xd998             // vfmadd132pd	%zmm1, %zmm20, %zmm3
+	LONG   $0x40ddf262; WORD $0xd598             // vfmadd132pd	%zmm5, %zmm20, %zmm2
+	LONG   $0x40e5f262; WORD $0xd998             // vfmadd132pd	%zmm1, %zmm19, %zmm3
+	LONG   $0x40e5f262; WORD $0xd598             // vfmadd132pd	%zmm5, %zmm19, %zmm2
+	LONG   $0x40edf262; WORD $0xd998             // vfmadd132pd	%zmm1, %zmm18, %zmm3
+	LONG   $0x40edf262; WORD $0xd598             // vfmadd132pd	%zmm5, %zmm18, %zmm2
+	LONG   $0x40f5f262; WORD $0xd998             // vfmadd132pd	%zmm1, %zmm17, %zmm3
+	LONG   $0x40f5f262; WORD $0xd598             // vfmadd132pd	%zmm5, %zmm17, %zmm2
+	LONG   $0x40fdf262; WORD $0xd998             // vfmadd132pd	%zmm1, %zmm16, %zmm3
+	LONG   $0x40fdf262; WORD $0xd598             // vfmadd132pd	%zmm5, %zmm16, %zmm2
+	LONG   $0x4885f262; WORD $0xd998             // vfmadd132pd	%zmm1, %zmm15, %zmm3
+	LONG   $0x4885f262; WORD $0xd598             // vfmadd132pd	%zmm5, %zmm15, %zmm2
+	LONG   $0x488df262; WORD $0xd998             // vfmadd132pd	%zmm1, %zmm14, %zmm3
+	LONG   $0x488df262; WORD $0xd598             // vfmadd132pd	%zmm5, %zmm14, %zmm2
+	LONG   $0x48b5f262; WORD $0xd998             // vfmadd132pd	%zmm1, %zmm9, %zmm3
+	LONG   $0x48b5f262; WORD $0xd598             // vfmadd132pd	%zmm5, %zmm9, %zmm2
+	LONG   $0x48b5f262; WORD $0xd998             // vfmadd132pd	%zmm1, %zmm9, %zmm3
+	LONG   $0x48b5f262; WORD $0xd598             // vfmadd132pd	%zmm5, %zmm9, %zmm2
+	LONG   $0x48e5f162; WORD $0xe459             // vmulpd	%zmm4, %zmm3, %zmm4
+	LONG   $0x48edf162; WORD $0xd659             // vmulpd	%zmm6, %zmm2, %zmm2
+	LONG   $0x48fdf162; WORD $0xe45a             // vcvtpd2ps	%zmm4, %ymm4
+	LONG   $0x48fdf162; WORD $0xd25a             // vcvtpd2ps	%zmm2, %ymm2
+	LONG   $0x48ddf362; WORD $0xe21a; BYTE $0x01 // vinsertf64x4	$0x1, %ymm2, %zmm4, %zmm4
+	LONG   $0xca7cd162; WORD $0xd328             // vmovaps	%zmm11, %zmm2{%k2}{z}
+	LONG   $0x497cf162; WORD $0xd428             // vmovaps	%zmm4, %zmm2{%k1}
+	LONG   $0xe2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm4
+	LONG   $0xcac6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm1
+	LONG   $0x286df362; WORD $0xda03; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm3
+	LONG   $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG   $0x487cf162; WORD $0x1411; BYTE $0x3b // vmovups	%zmm2, (%rbx,%rdi)
+	LONG   $0x40c78348                           // addq	$64, %rdi
+	LONG   $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG   $0xe215e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm4
+	LONG   $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG   $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG   $0x287df362; WORD $0xd119; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm1
+	LONG   $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG   $0x286df362; WORD $0xca03; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm1
+	LONG   $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG   $0x286df362; WORD $0xca03; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm1
+	LONG   $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG   $0x487df362; WORD $0xd11b; BYTE $0x01 // vextractf32x8	$0x1, %zmm2, %ymm1
+	LONG   $0xd1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG   $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG   $0xd9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG   $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG   $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG   $0xd915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG   $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG   $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG   $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG   $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG   $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG   $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG   $0x2875f362; WORD $0xd103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm2
+	LONG   $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG   $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG   $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD   $0x3949; BYTE $0xfa                   // cmpq	%rdi, %r10
+	JNE    BB0_10
+	WORD   $0x894c; BYTE $0xc7                   // movq	%r8, %rdi
+	LONG   $0xf0e78348                           // andq	$-16, %rdi
+	WORD   $0x0148; BYTE $0xfa                   // addq	%rdi, %rdx
+	LONG   $0x0fc0f641                           // testb	$15, %r8b
+	JE     BB0_73
+	WORD   $0x2949; BYTE $0xf8                   // subq	%rdi, %r8
+	LONG   $0xff488d4d                           // leaq	-1(%r8), %r9
+	LONG   $0x06f98349                           // cmpq	$6, %r9
+	JBE    BB0_15
+
+BB0_9:
+	WORD         $0x014c; BYTE $0xdf                   // addq	%r11, %rdi
+	LONG         $0x187dc2c4; BYTE $0xc8               // vbroadcastss	%xmm8, %ymm1
+	VBROADCASTSD CPI0_27<>(SB), Y5                     // vbroadcastsd	.LCPI0_27(%rip), %ymm5
+	VBROADCASTSD CPI0_87<>(SB), Y2                     // vbroadcastsd	.LCPI0_87(%rip), %ymm2
+	LONG         $0x3c10fcc5; BYTE $0xb8               // vmovups	(%rax,%rdi,4), %ymm7
+	LONG         $0x03ffb941; WORD $0x0000             // movl	$1023, %r9d
+	VBROADCASTSD CPI0_86<>(SB), Y4                     // vbroadcastsd	.LCPI0_86(%rip), %ymm4
+	LONG         $0xca287dc5                           // vmovapd	%ymm2, %ymm9
+	LONG         $0xf95cc4c5                           // vsubps	%ymm1, %ymm7, %ymm7
+	LONG         $0x187dc2c4; BYTE $0xca               // vbroadcastss	%xmm10, %ymm1
+	LONG         $0xf959c4c5                           // vmulps	%ymm1, %ymm7, %ymm7
+	LONG         $0xcf5afcc5                           // vcvtps2pd	%xmm7, %ymm1
+	LONG         $0xf559f5c5                           // vmulpd	%ymm5, %ymm1, %ymm6
+	LONG         $0x197de3c4; WORD $0x01fb             // vextractf128	$0x1, %ymm7, %xmm3
+	LONG         $0xdb5afcc5                           // vcvtps2pd	%xmm3, %ymm3
+	LONG         $0xed59e5c5                           // vmulpd	%ymm5, %ymm3, %ymm5
+	LONG         $0x28cd7362; WORD $0xcc25; BYTE $0xf8 // vpternlogq	$248, %ymm4, %ymm6, %ymm9
+	LONG         $0x28d5f362; WORD $0xd425; BYTE $0xf8 // vpternlogq	$248, %ymm4, %ymm5, %ymm2
+	LONG         $0x584dc1c4; BYTE $0xf1               // vaddpd	%ymm9, %ymm6, %ymm6
+	VBROADCASTSD CPI0_39<>(SB), Y9                     // vbroadcastsd	.LCPI0_39(%rip), %ymm9
+	LONG         $0xea58d5c5                           // vaddpd	%ymm2, %ymm5, %ymm5
+	VBROADCASTSD CPI0_33<>(SB), Y2                     // vbroadcastsd	.LCPI0_33(%rip), %ymm2
+	LONG         $0x28fdf362; WORD $0xf609; BYTE $0x03 // vrndscalepd	$3, %ymm6, %ymm6
+	LONG         $0x28fdf362; WORD $0xed09; BYTE $0x03 // vrndscalepd	$3, %ymm5, %ymm5
+	LONG         $0xbccde2c4; BYTE $0xca               // vfnmadd231pd	%ymm2, %ymm6, %ymm1
+	LONG         $0x9ce5e2c4; BYTE $0xd5               // vfnmadd132pd	%ymm5, %ymm3, %ymm2
+	VBROADCASTSD CPI0_35<>(SB), Y3                     // vbroadcastsd	.LCPI0_35(%rip), %ymm3
+	LONG         $0xbccde2c4; BYTE $0xcb               // vfnmadd231pd	%ymm3, %ymm6, %ymm1
+	LONG         $0x28fdf162; WORD $0xf67a             // vcvttpd2qq	%ymm6, %ymm6
+	LONG         $0x9cede2c4; BYTE $0xdd               // vfnmadd132pd	%ymm5, %ymm2, %ymm3
+	LONG         $0x28fdf162; WORD $0xed7a             // vcvttpd2qq	%ymm5, %ymm5
+	VBROADCASTSD CPI0_37<>(SB), Y2                     // vbroadcastsd	.LCPI0_37(%rip), %ymm2
+	LONG         $0xe128fdc5                           // vmovapd	%ymm1, %ymm4
+	LONG         $0x98b5e2c4; BYTE $0xe2               // vfmadd132pd	%ymm2, %ymm9, %ymm4
+	LONG         $0x98b5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm9, %ymm2
+	VBROADCASTSD CPI0_41<>(SB), Y9                     // vbroadcastsd	.LCPI0_41(%rip), %ymm9
+	LONG         $0x98b5e2c4; BYTE $0xe1               // vfmadd132pd	%ymm1, %ymm9, %ymm4
+	LONG         $0x98b5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm9, %ymm2
+	VBROADCASTSD CPI0_43<>(SB), Y9                     // vbroadcastsd	.LCPI0_43(%rip), %ymm9
+	LONG         $0x98b5e2c4; BYTE $0xe1               // vfmadd132pd	%ymm1, %ymm9, %ymm4
+	LONG         $0x98b5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm9, %ymm2
+	VBROADCASTSD CPI0_45<>(SB), Y9                     // vbroadcastsd	.LCPI0_45(%rip), %ymm9
+	LONG         $0x98b5e2c4; BYTE $0xe1               // vfmadd132pd	%ymm1, %ymm9, %ymm4
+	LONG         $0x98b5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm9, %ymm2
+	VBROADCASTSD CPI0_47<>(SB), Y9                     // vbroadcastsd	.LCPI0_47(%rip), %ymm9
+	LONG         $0x98b5e2c4; BYTE $0xe1               // vfmadd132pd	%ymm1, %ymm9, %ymm4
+	LONG         $0x98b5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm9, %ymm2
+	VBROADCASTSD CPI0_49<>(SB), Y9                     // vbroadcastsd	.LCPI0_49(%rip), %ymm9
+	LONG         $0x98b5e2c4; BYTE $0xe1               // vfmadd132pd	%ymm1, %ymm9, %ymm4
+	LONG         $0x98b5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm9, %ymm2
+	VBROADCASTSD CPI0_51<>(SB), Y9                     // vbroadcastsd	.LCPI0_51(%rip), %ymm9
+	LONG         $0x98b5e2c4; BYTE $0xe1               // vfmadd132pd	%ymm1, %ymm9, %ymm4
+	LONG         $0x98b5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm9, %ymm2
+	VBROADCASTSD CPI0_53<>(SB), Y9                     // vbroadcastsd	.LCPI0_53(%rip), %ymm9
+	LONG         $0x98b5e2c4; BYTE $0xe1               // vfmadd132pd	%ymm1, %ymm9, %ymm4
+	LONG         $0x98b5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm9, %ymm2
+	VBROADCASTSD CPI0_55<>(SB), Y9                     // vbroadcastsd	.LCPI0_55(%rip), %ymm9
+	LONG         $0x98b5e2c4; BYTE $0xe1               // vfmadd132pd	%ymm1, %ymm9, %ymm4
+	LONG         $0x98b5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm9, %ymm2
+	VBROADCASTSD CPI0_57<>(SB), Y9                     // vbroadcastsd	.LCPI0_57(%rip), %ymm9
+	LONG         $0x98b5e2c4; BYTE $0xe1               // vfmadd132pd	%ymm1, %ymm9, %ymm4
+	LONG         $0x98b5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm9, %ymm2
+	VBROADCASTSD CPI0_59<>(SB), Y9                     // vbroadcastsd	.LCPI0_59(%rip), %ymm9
+	LONG         $0x98b5e2c4; BYTE $0xd3               // vfmadd132pd	%ymm3, %ymm9, %ymm2
+	LONG         $0x98b5e2c4; BYTE $0xe1               // vfmadd132pd	%ymm1, %ymm9, %ymm4
+	LONG         $0x98b5e2c4; BYTE $0xda               // vfmadd132pd	%ymm2, %ymm9, %ymm3
+	LONG         $0x98b5e2c4; BYTE $0xcc               // vfmadd132pd	%ymm4, %ymm9, %ymm1
+	LONG         $0x28fdd262; WORD $0xd17c             // vpbroadcastq	%r9, %ymm2
+	LONG         $0xf2d4cdc5                           // vpaddq	%ymm2, %ymm6, %ymm6
+	LONG         $0xead4d5c5                           // vpaddq	%ymm2, %ymm5, %ymm5
+	VBROADCASTSS CPI0_62<>(SB), Y2                     // vbroadcastss	.LCPI0_62(%rip), %ymm2
+	LONG         $0xf673cdc5; BYTE $0x34               // vpsllq	$52, %ymm6, %ymm6
+	LONG         $0xf573d5c5; BYTE $0x34               // vpsllq	$52, %ymm5, %ymm5
+	LONG         $0xce59f5c5                           // vmulpd	%ymm6, %ymm1, %ymm1
+	LONG         $0xdd59e5c5                           // vmulpd	%ymm5, %ymm3, %ymm3
+	LONG         $0xc95afdc5                           // vcvtpd2psy	%ymm1, %xmm1
+	LONG         $0xdb5afdc5                           // vcvtpd2psy	%ymm3, %xmm3
+	LONG         $0x1875e3c4; WORD $0x01cb             // vinsertf128	$0x1, %xmm3, %ymm1, %ymm1
+	VBROADCASTSS CPI0_63<>(SB), Y3                     // vbroadcastss	.LCPI0_63(%rip), %ymm3
+	LONG         $0x2844f162; WORD $0xcbc2; BYTE $0x05 // vcmpps	$5, %ymm3, %ymm7, %k1
+	VBROADCASTSS CPI0_0<>(SB), Y3                      // vbroadcastss	.LCPI0_0(%rip), %ymm3
+	LONG         $0x2944f162; WORD $0xcac2; BYTE $0x0a // vcmpps	$10, %ymm2, %ymm7, %k1{%k1}
+	LONG         $0xd7c2ecc5; BYTE $0x01               // vcmpltps	%ymm7, %ymm2, %ymm2
+	LONG         $0xd354ecc5                           // vandps	%ymm3, %ymm2, %ymm2
+	LONG         $0x296df262; WORD $0xc965             // vblendmps	%ymm1, %ymm2, %ymm1{%k1}
+	LONG         $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG         $0xd1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG         $0xd9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm3
+	LONG         $0x0c11fcc5; BYTE $0xbe               // vmovups	%ymm1, (%rsi,%rdi,4)
+	WORD         $0x894c; BYTE $0xc7                   // movq	%r8, %rdi
+	LONG         $0xf8e78348                           // andq	$-8, %rdi
+	LONG         $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG         $0xd115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm2
+	WORD         $0x0148; BYTE $0xfa                   // addq	%rdi, %rdx
+	LONG         $0x07e08341                           // andl	$7, %r8d
+	LONG         $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG         $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG         $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG         $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG         $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG         $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG         $0x2875f362; WORD $0xd103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm2
+	LONG         $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG         $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG         $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	JE           BB0_73
+
+BB0_15:
+	VMOVSS CPI0_63<>(SB), X3  // vmovss	.LCPI0_63(%rip), %xmm3
+	VMOVSD CPI0_27<>(SB), X13 // vmovsd	.LCPI0_27(%rip), %xmm13
+	VMOVQ  CPI0_86<>(SB), X12 // vmovq	.LCPI0_86(%rip), %xmm12
+	VMOVQ  CPI0_87<>(SB), X11 // vmovq	.LCPI0_87(%rip), %xmm11
+	VMOVSD CPI0_33<>(SB), X9  // vmovsd	.LCPI0_33(%rip), %xmm9
+	VMOVSD CPI0_35<>(SB), X7  // vmovsd	.LCPI0_35(%rip), %xmm7
+	VMOVSD CPI0_37<>(SB), X6  // vmovsd	.LCPI0_37(%rip), %xmm6
+	VMOVSD CPI0_39<>(SB), X5  // vmovsd	.LCPI0_39(%rip), %xmm5
+	VMOVSD CPI0_41<>(SB), X4  // vmovsd	.LCPI0_41(%rip), %xmm4
+
+BB0_19:
+	LONG        $0x1410fac5; BYTE $0x90               // vmovss	(%rax,%rdx,4), %xmm2
+	VMOVSS      CPI0_0<>(SB), X1                      // vmovss	.LCPI0_0(%rip), %xmm1
+	LONG        $0x5c6ac1c4; BYTE $0xd0               // vsubss	%xmm8, %xmm2, %xmm2
+	LONG        $0x596ac1c4; BYTE $0xd2               // vmulss	%xmm10, %xmm2, %xmm2
+	VCOMISS     CPI0_62<>(SB), X2                     // vcomiss	.LCPI0_62(%rip), %xmm2
+	JA          BB0_20
+	LONG        $0xda2ff8c5                           // vcomiss	%xmm2, %xmm3
+	LONG        $0xc957f0c5                           // vxorps	%xmm1, %xmm1, %xmm1
+	JA          BB0_20
+	LONG        $0xca5aeac5                           // vcvtss2sd	%xmm2, %xmm2, %xmm1
+	LONG        $0x5973c1c4; BYTE $0xd5               // vmulsd	%xmm13, %xmm1, %xmm2
+	LONG        $0x287941c4; BYTE $0xfb               // vmovapd	%xmm11, %xmm15
+	LONG        $0x08ed5362; WORD $0xfc25; BYTE $0xf8 // vpternlogq	$248, %xmm12, %xmm2, %xmm15
+	LONG        $0x586b41c4; BYTE $0xf7               // vaddsd	%xmm15, %xmm2, %xmm14
+	VMOVSD      CPI0_59<>(SB), X15                    // vmovsd	.LCPI0_59(%rip), %xmm15
+	LONG        $0x088d5362; WORD $0xf60b; BYTE $0x03 // vrndscalesd	$3, %xmm14, %xmm14, %xmm14
+	LONG        $0xbd89c2c4; BYTE $0xc9               // vfnmadd231sd	%xmm9, %xmm14, %xmm1
+	LONG        $0x2cfbc1c4; BYTE $0xfe               // vcvttsd2siq	%xmm14, %rdi
+	LONG        $0xffc78148; WORD $0x0003; BYTE $0x00 // addq	$1023, %rdi
+	LONG        $0xbd89e2c4; BYTE $0xcf               // vfnmadd231sd	%xmm7, %xmm14, %xmm1
+	LONG        $0x34e7c148                           // salq	$52, %rdi
+	LONG        $0xd110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm2
+	LONG        $0x99d1e2c4; BYTE $0xd6               // vfmadd132sd	%xmm6, %xmm5, %xmm2
+	LONG        $0x99d9e2c4; BYTE $0xd1               // vfmadd132sd	%xmm1, %xmm4, %xmm2
+	VFMADD213SD CPI0_43<>(SB), X1, X2                 // vfmadd213sd	.LCPI0_43(%rip), %xmm1, %xmm2
+	VFMADD213SD CPI0_45<>(SB), X1, X2                 // vfmadd213sd	.LCPI0_45(%rip), %xmm1, %xmm2
+	VFMADD213SD CPI0_47<>(SB), X1, X2                 // vfmadd213sd	.LCPI0_47(%rip), %xmm1, %xmm2
+	VFMADD213SD CPI0_49<>(SB), X1, X2                 // vfmadd213sd	.LCPI0_49(%rip), %xmm1, %xmm2
+	VFMADD213SD CPI0_51<>(SB), X1, X2                 // vfmadd213sd	.LCPI0_51(%rip), %xmm1, %xmm2
+	VFMADD213SD CPI0_53<>(SB), X1, X2                 // vfmadd213sd	.LCPI0_53(%rip), %xmm1, %xmm2
+	VFMADD213SD CPI0_55<>(SB), X1, X2                 // vfmadd213sd	.LCPI0_55(%rip), %xmm1, %xmm2
+	VFMADD213SD CPI0_57<>(SB), X1, X2                 // vfmadd213sd	.LCPI0_57(%rip), %xmm1, %xmm2
+	LONG        $0x9981e2c4; BYTE $0xd1               // vfmadd132sd	%xmm1, %xmm15, %xmm2
+	LONG        $0x9981e2c4; BYTE $0xca               // vfmadd132sd	%xmm2, %xmm15, %xmm1
+	LONG        $0x6ef9e1c4; BYTE $0xd7               // vmovq	%rdi, %xmm2
+	LONG        $0xca59f3c5                           // vmulsd	%xmm2, %xmm1, %xmm1
+	LONG        $0xc95af3c5                           // vcvtsd2ss	%xmm1, %xmm1, %xmm1
+
+BB0_20:
+	LONG $0x0c11fac5; BYTE $0x96 // vmovss	%xmm1, (%rsi,%rdx,4)
+	LONG $0x01c28348             // addq	$1, %rdx
+	LONG $0xc158fac5             // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd1     // cmpq	%rdx, %rcx
+	JG   BB0_19
+	JMP  BB0_73
+
+BB0_7:
+	VMOVSS CPI0_2<>(SB), X7          // vmovss	.LCPI0_2(%rip), %xmm7
+	LONG   $0xc85ec2c5               // vdivss	%xmm0, %xmm7, %xmm1
+	LONG   $0x487df262; WORD $0xd118 // vbroadcastss	%xmm1, %zmm2
+	LONG   $0x0ff98348               // cmpq	$15, %rcx
+	JG     BB0_12
+	WORD   $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JG     BB0_13
+
+BB0_66:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_69:
+	RET
+
+BB0_31:
+	LONG $0xd257e9c5 // vxorpd	%xmm2, %xmm2, %xmm2
+	WORD $0xd231     // xorl	%edx, %edx
+	JMP  BB0_3
+
+BB0_13:
+	WORD $0x8948; BYTE $0xcf // movq	%rcx, %rdi
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_23
+
+BB0_32:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_9
+
+BB0_36:
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	JMP  BB0_23
@@ -0,0 +1,17 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Dense_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func Dense_AVX512_F32(x unsafe.Pointer, weight unsafe.Pointer, bias unsafe.Pointer, output unsafe.Pointer, pbatchSize unsafe.Pointer, pinFeatures unsafe.Pointer, poutFeatures unsafe.Pointer, plen_x unsafe.Pointer, plen_weight unsafe.Pointer, plen_bias unsafe.Pointer, plen_output unsafe.Pointer) {
+	dense_c_f32_avx512(x, weight, bias, output, pbatchSize, pinFeatures, poutFeatures, plen_x, plen_weight, plen_bias, plen_output)
+}
+
+// Dense_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func Dense_AVX512_F64(x unsafe.Pointer, weight unsafe.Pointer, bias unsafe.Pointer, output unsafe.Pointer, pbatchSize unsafe.Pointer, pinFeatures unsafe.Pointer, poutFeatures unsafe.Pointer, plen_x unsafe.Pointer, plen_weight unsafe.Pointer, plen_bias unsafe.Pointer, plen_output unsafe.Pointer) {
+	dense_c_f64_avx512(x, weight, bias, output, pbatchSize, pinFeatures, poutFeatures, plen_x, plen_weight, plen_bias, plen_output)
+}
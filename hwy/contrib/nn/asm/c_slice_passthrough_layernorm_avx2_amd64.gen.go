@@ -0,0 +1,17 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// LayerNorm_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func LayerNorm_AVX2_F32(input unsafe.Pointer, output unsafe.Pointer, pnormSize unsafe.Pointer, gamma unsafe.Pointer, beta unsafe.Pointer, pepsilon unsafe.Pointer, plen_input unsafe.Pointer, plen_output unsafe.Pointer, plen_gamma unsafe.Pointer, plen_beta unsafe.Pointer) {
+	layernorm_c_f32_avx2(input, output, pnormSize, gamma, beta, pepsilon, plen_input, plen_output, plen_gamma, plen_beta)
+}
+
+// LayerNorm_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func LayerNorm_AVX2_F64(input unsafe.Pointer, output unsafe.Pointer, pnormSize unsafe.Pointer, gamma unsafe.Pointer, beta unsafe.Pointer, pepsilon unsafe.Pointer, plen_input unsafe.Pointer, plen_output unsafe.Pointer, plen_gamma unsafe.Pointer, plen_beta unsafe.Pointer) {
+	layernorm_c_f64_avx2(input, output, pnormSize, gamma, beta, pepsilon, plen_input, plen_output, plen_gamma, plen_beta)
+}
@@ -0,0 +1,17 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// QKVDense_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func QKVDense_AVX2_F32(x unsafe.Pointer, wQKV unsafe.Pointer, biasQ unsafe.Pointer, biasK unsafe.Pointer, biasV unsafe.Pointer, q unsafe.Pointer, k unsafe.Pointer, v unsafe.Pointer, pbatchSize unsafe.Pointer, pinFeatures unsafe.Pointer, pqDim unsafe.Pointer, pkvDim unsafe.Pointer, plen_x unsafe.Pointer, plen_wQKV unsafe.Pointer, plen_biasQ unsafe.Pointer, plen_biasK unsafe.Pointer, plen_biasV unsafe.Pointer, plen_q unsafe.Pointer, plen_k unsafe.Pointer, plen_v unsafe.Pointer) {
+	qkvdense_c_f32_avx2(x, wQKV, biasQ, biasK, biasV, q, k, v, pbatchSize, pinFeatures, pqDim, pkvDim, plen_x, plen_wQKV, plen_biasQ, plen_biasK, plen_biasV, plen_q, plen_k, plen_v)
+}
+
+// QKVDense_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func QKVDense_AVX2_F64(x unsafe.Pointer, wQKV unsafe.Pointer, biasQ unsafe.Pointer, biasK unsafe.Pointer, biasV unsafe.Pointer, q unsafe.Pointer, k unsafe.Pointer, v unsafe.Pointer, pbatchSize unsafe.Pointer, pinFeatures unsafe.Pointer, pqDim unsafe.Pointer, pkvDim unsafe.Pointer, plen_x unsafe.Pointer, plen_wQKV unsafe.Pointer, plen_biasQ unsafe.Pointer, plen_biasK unsafe.Pointer, plen_biasV unsafe.Pointer, plen_q unsafe.Pointer, plen_k unsafe.Pointer, plen_v unsafe.Pointer) {
+	qkvdense_c_f64_avx2(x, wQKV, biasQ, biasK, biasV, q, k, v, pbatchSize, pinFeatures, pqDim, pkvDim, plen_x, plen_wQKV, plen_biasQ, plen_biasK, plen_biasV, plen_q, plen_k, plen_v)
+}
@@ -0,0 +1,22 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// AttentionWeights_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func AttentionWeights_AVX2_F32(q unsafe.Pointer, k unsafe.Pointer, mask unsafe.Pointer, weights unsafe.Pointer, pseqLen unsafe.Pointer, pkvLen unsafe.Pointer, pheadDim unsafe.Pointer, pscale unsafe.Pointer, plen_q unsafe.Pointer, plen_k unsafe.Pointer, plen_mask unsafe.Pointer, plen_weights unsafe.Pointer) {
+	attentionweights_c_f32_avx2(q, k, mask, weights, pseqLen, pkvLen, pheadDim, pscale, plen_q, plen_k, plen_mask, plen_weights)
+}
+
+// SDPA_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func SDPA_AVX2_F32(q unsafe.Pointer, k unsafe.Pointer, v unsafe.Pointer, mask unsafe.Pointer, scores unsafe.Pointer, output unsafe.Pointer, pseqLen unsafe.Pointer, pkvLen unsafe.Pointer, pheadDim unsafe.Pointer, pscale unsafe.Pointer, plen_q unsafe.Pointer, plen_k unsafe.Pointer, plen_v unsafe.Pointer, plen_mask unsafe.Pointer, plen_scores unsafe.Pointer, plen_output unsafe.Pointer) {
+	sdpa_c_f32_avx2(q, k, v, mask, scores, output, pseqLen, pkvLen, pheadDim, pscale, plen_q, plen_k, plen_v, plen_mask, plen_scores, plen_output)
+}
+
+// SDPACausal_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func SDPACausal_AVX2_F32(q unsafe.Pointer, k unsafe.Pointer, v unsafe.Pointer, scores unsafe.Pointer, output unsafe.Pointer, pseqLen unsafe.Pointer, pkvLen unsafe.Pointer, pheadDim unsafe.Pointer, pscale unsafe.Pointer, plen_q unsafe.Pointer, plen_k unsafe.Pointer, plen_v unsafe.Pointer, plen_scores unsafe.Pointer, plen_output unsafe.Pointer) {
+	sdpacausal_c_f32_avx2(q, k, v, scores, output, pseqLen, pkvLen, pheadDim, pscale, plen_q, plen_k, plen_v, plen_scores, plen_output)
+}
@@ -0,0 +1,32 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// LogSoftmax_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func LogSoftmax_AVX2_F32(input unsafe.Pointer, output unsafe.Pointer, plen unsafe.Pointer) {
+	logsoftmax_c_f32_avx2(input, output, plen)
+}
+
+// LogSoftmaxInPlace_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func LogSoftmaxInPlace_AVX2_F32(x unsafe.Pointer, plen unsafe.Pointer) {
+	logsoftmaxinplace_c_f32_avx2(x, plen)
+}
+
+// Softmax_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Softmax_AVX2_F32(input unsafe.Pointer, output unsafe.Pointer, plen unsafe.Pointer) {
+	softmax_c_f32_avx2(input, output, plen)
+}
+
+// SoftmaxInPlace_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func SoftmaxInPlace_AVX2_F32(x unsafe.Pointer, plen unsafe.Pointer) {
+	softmaxinplace_c_f32_avx2(x, plen)
+}
+
+// SoftmaxWithTemperature_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func SoftmaxWithTemperature_AVX2_F32(input unsafe.Pointer, output unsafe.Pointer, ptemperature unsafe.Pointer, plen unsafe.Pointer) {
+	softmaxwithtemperature_c_f32_avx2(input, output, ptemperature, plen)
+}
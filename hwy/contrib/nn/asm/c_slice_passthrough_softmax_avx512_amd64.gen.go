@@ -0,0 +1,32 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// LogSoftmax_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func LogSoftmax_AVX512_F32(input unsafe.Pointer, output unsafe.Pointer, plen unsafe.Pointer) {
+	logsoftmax_c_f32_avx512(input, output, plen)
+}
+
+// LogSoftmaxInPlace_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func LogSoftmaxInPlace_AVX512_F32(x unsafe.Pointer, plen unsafe.Pointer) {
+	logsoftmaxinplace_c_f32_avx512(x, plen)
+}
+
+// Softmax_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func Softmax_AVX512_F32(input unsafe.Pointer, output unsafe.Pointer, plen unsafe.Pointer) {
+	softmax_c_f32_avx512(input, output, plen)
+}
+
+// SoftmaxInPlace_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func SoftmaxInPlace_AVX512_F32(x unsafe.Pointer, plen unsafe.Pointer) {
+	softmaxinplace_c_f32_avx512(x, plen)
+}
+
+// SoftmaxWithTemperature_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func SoftmaxWithTemperature_AVX512_F32(input unsafe.Pointer, output unsafe.Pointer, ptemperature unsafe.Pointer, plen unsafe.Pointer) {
+	softmaxwithtemperature_c_f32_avx512(input, output, ptemperature, plen)
+}
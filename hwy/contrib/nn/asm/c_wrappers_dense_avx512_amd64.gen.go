@@ -0,0 +1,88 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// DenseCAVX512F32 computes Dense using AVX512 SIMD assembly.
+func DenseCAVX512F32(x, weight, bias, output []float32, batchSize, inFeatures, outFeatures int) {
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	var p_weight unsafe.Pointer
+	if len(weight) > 0 {
+		p_weight = unsafe.Pointer(&weight[0])
+	}
+	var p_bias unsafe.Pointer
+	if len(bias) > 0 {
+		p_bias = unsafe.Pointer(&bias[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	batchSizeVal := int64(batchSize)
+	inFeaturesVal := int64(inFeatures)
+	outFeaturesVal := int64(outFeatures)
+	len_xVal := int64(len(x))
+	len_weightVal := int64(len(weight))
+	len_biasVal := int64(len(bias))
+	len_outputVal := int64(len(output))
+	dense_c_f32_avx512(
+		p_x,
+		p_weight,
+		p_bias,
+		p_output,
+		unsafe.Pointer(&batchSizeVal),
+		unsafe.Pointer(&inFeaturesVal),
+		unsafe.Pointer(&outFeaturesVal),
+		unsafe.Pointer(&len_xVal),
+		unsafe.Pointer(&len_weightVal),
+		unsafe.Pointer(&len_biasVal),
+		unsafe.Pointer(&len_outputVal),
+	)
+}
+
+// DenseCAVX512F64 computes Dense using AVX512 SIMD assembly.
+func DenseCAVX512F64(x, weight, bias, output []float64, batchSize, inFeatures, outFeatures int) {
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	var p_weight unsafe.Pointer
+	if len(weight) > 0 {
+		p_weight = unsafe.Pointer(&weight[0])
+	}
+	var p_bias unsafe.Pointer
+	if len(bias) > 0 {
+		p_bias = unsafe.Pointer(&bias[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	batchSizeVal := int64(batchSize)
+	inFeaturesVal := int64(inFeatures)
+	outFeaturesVal := int64(outFeatures)
+	len_xVal := int64(len(x))
+	len_weightVal := int64(len(weight))
+	len_biasVal := int64(len(bias))
+	len_outputVal := int64(len(output))
+	dense_c_f64_avx512(
+		p_x,
+		p_weight,
+		p_bias,
+		p_output,
+		unsafe.Pointer(&batchSizeVal),
+		unsafe.Pointer(&inFeaturesVal),
+		unsafe.Pointer(&outFeaturesVal),
+		unsafe.Pointer(&len_xVal),
+		unsafe.Pointer(&len_weightVal),
+		unsafe.Pointer(&len_biasVal),
+		unsafe.Pointer(&len_outputVal),
+	)
+}
@@ -0,0 +1,84 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// LayerNormCAVX2F32 computes LayerNorm using AVX2 SIMD assembly.
+func LayerNormCAVX2F32(input, output []float32, normSize int, gamma, beta []float32, epsilon float32) {
+	var p_input unsafe.Pointer
+	if len(input) > 0 {
+		p_input = unsafe.Pointer(&input[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	var p_gamma unsafe.Pointer
+	if len(gamma) > 0 {
+		p_gamma = unsafe.Pointer(&gamma[0])
+	}
+	var p_beta unsafe.Pointer
+	if len(beta) > 0 {
+		p_beta = unsafe.Pointer(&beta[0])
+	}
+	normSizeVal := int64(normSize)
+	epsilonVal := epsilon
+	len_inputVal := int64(len(input))
+	len_outputVal := int64(len(output))
+	len_gammaVal := int64(len(gamma))
+	len_betaVal := int64(len(beta))
+	layernorm_c_f32_avx2(
+		p_input,
+		p_output,
+		unsafe.Pointer(&normSizeVal),
+		p_gamma,
+		p_beta,
+		unsafe.Pointer(&epsilonVal),
+		unsafe.Pointer(&len_inputVal),
+		unsafe.Pointer(&len_outputVal),
+		unsafe.Pointer(&len_gammaVal),
+		unsafe.Pointer(&len_betaVal),
+	)
+}
+
+// LayerNormCAVX2F64 computes LayerNorm using AVX2 SIMD assembly.
+func LayerNormCAVX2F64(input, output []float64, normSize int, gamma, beta []float64, epsilon float64) {
+	var p_input unsafe.Pointer
+	if len(input) > 0 {
+		p_input = unsafe.Pointer(&input[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	var p_gamma unsafe.Pointer
+	if len(gamma) > 0 {
+		p_gamma = unsafe.Pointer(&gamma[0])
+	}
+	var p_beta unsafe.Pointer
+	if len(beta) > 0 {
+		p_beta = unsafe.Pointer(&beta[0])
+	}
+	normSizeVal := int64(normSize)
+	epsilonVal := epsilon
+	len_inputVal := int64(len(input))
+	len_outputVal := int64(len(output))
+	len_gammaVal := int64(len(gamma))
+	len_betaVal := int64(len(beta))
+	layernorm_c_f64_avx2(
+		p_input,
+		p_output,
+		unsafe.Pointer(&normSizeVal),
+		p_gamma,
+		p_beta,
+		unsafe.Pointer(&epsilonVal),
+		unsafe.Pointer(&len_inputVal),
+		unsafe.Pointer(&len_outputVal),
+		unsafe.Pointer(&len_gammaVal),
+		unsafe.Pointer(&len_betaVal),
+	)
+}
@@ -0,0 +1,155 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// AttentionWeightsCAVX512F32 computes AttentionWeights using AVX512 SIMD assembly.
+func AttentionWeightsCAVX512F32(q, k, mask, weights []float32, seqLen, kvLen, headDim int, scale float32) {
+	var p_q unsafe.Pointer
+	if len(q) > 0 {
+		p_q = unsafe.Pointer(&q[0])
+	}
+	var p_k unsafe.Pointer
+	if len(k) > 0 {
+		p_k = unsafe.Pointer(&k[0])
+	}
+	var p_mask unsafe.Pointer
+	if len(mask) > 0 {
+		p_mask = unsafe.Pointer(&mask[0])
+	}
+	var p_weights unsafe.Pointer
+	if len(weights) > 0 {
+		p_weights = unsafe.Pointer(&weights[0])
+	}
+	seqLenVal := int64(seqLen)
+	kvLenVal := int64(kvLen)
+	headDimVal := int64(headDim)
+	scaleVal := scale
+	len_qVal := int64(len(q))
+	len_kVal := int64(len(k))
+	len_maskVal := int64(len(mask))
+	len_weightsVal := int64(len(weights))
+	attentionweights_c_f32_avx512(
+		p_q,
+		p_k,
+		p_mask,
+		p_weights,
+		unsafe.Pointer(&seqLenVal),
+		unsafe.Pointer(&kvLenVal),
+		unsafe.Pointer(&headDimVal),
+		unsafe.Pointer(&scaleVal),
+		unsafe.Pointer(&len_qVal),
+		unsafe.Pointer(&len_kVal),
+		unsafe.Pointer(&len_maskVal),
+		unsafe.Pointer(&len_weightsVal),
+	)
+}
+
+// SDPACAVX512F32 computes SDPA using AVX512 SIMD assembly.
+func SDPACAVX512F32(q, k, v, mask, scores, output []float32, seqLen, kvLen, headDim int, scale float32) {
+	var p_q unsafe.Pointer
+	if len(q) > 0 {
+		p_q = unsafe.Pointer(&q[0])
+	}
+	var p_k unsafe.Pointer
+	if len(k) > 0 {
+		p_k = unsafe.Pointer(&k[0])
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var p_mask unsafe.Pointer
+	if len(mask) > 0 {
+		p_mask = unsafe.Pointer(&mask[0])
+	}
+	var p_scores unsafe.Pointer
+	if len(scores) > 0 {
+		p_scores = unsafe.Pointer(&scores[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	seqLenVal := int64(seqLen)
+	kvLenVal := int64(kvLen)
+	headDimVal := int64(headDim)
+	scaleVal := scale
+	len_qVal := int64(len(q))
+	len_kVal := int64(len(k))
+	len_vVal := int64(len(v))
+	len_maskVal := int64(len(mask))
+	len_scoresVal := int64(len(scores))
+	len_outputVal := int64(len(output))
+	sdpa_c_f32_avx512(
+		p_q,
+		p_k,
+		p_v,
+		p_mask,
+		p_scores,
+		p_output,
+		unsafe.Pointer(&seqLenVal),
+		unsafe.Pointer(&kvLenVal),
+		unsafe.Pointer(&headDimVal),
+		unsafe.Pointer(&scaleVal),
+		unsafe.Pointer(&len_qVal),
+		unsafe.Pointer(&len_kVal),
+		unsafe.Pointer(&len_vVal),
+		unsafe.Pointer(&len_maskVal),
+		unsafe.Pointer(&len_scoresVal),
+		unsafe.Pointer(&len_outputVal),
+	)
+}
+
+// SDPACausalCAVX512F32 computes SDPACausal using AVX512 SIMD assembly.
+func SDPACausalCAVX512F32(q, k, v, scores, output []float32, seqLen, kvLen, headDim int, scale float32) {
+	var p_q unsafe.Pointer
+	if len(q) > 0 {
+		p_q = unsafe.Pointer(&q[0])
+	}
+	var p_k unsafe.Pointer
+	if len(k) > 0 {
+		p_k = unsafe.Pointer(&k[0])
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var p_scores unsafe.Pointer
+	if len(scores) > 0 {
+		p_scores = unsafe.Pointer(&scores[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	seqLenVal := int64(seqLen)
+	kvLenVal := int64(kvLen)
+	headDimVal := int64(headDim)
+	scaleVal := scale
+	len_qVal := int64(len(q))
+	len_kVal := int64(len(k))
+	len_vVal := int64(len(v))
+	len_scoresVal := int64(len(scores))
+	len_outputVal := int64(len(output))
+	sdpacausal_c_f32_avx512(
+		p_q,
+		p_k,
+		p_v,
+		p_scores,
+		p_output,
+		unsafe.Pointer(&seqLenVal),
+		unsafe.Pointer(&kvLenVal),
+		unsafe.Pointer(&headDimVal),
+		unsafe.Pointer(&scaleVal),
+		unsafe.Pointer(&len_qVal),
+		unsafe.Pointer(&len_kVal),
+		unsafe.Pointer(&len_vVal),
+		unsafe.Pointer(&len_scoresVal),
+		unsafe.Pointer(&len_outputVal),
+	)
+}
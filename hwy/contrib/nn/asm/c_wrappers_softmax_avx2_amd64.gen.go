@@ -0,0 +1,105 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// LogSoftmaxCAVX2F32 computes LogSoftmax using AVX2 SIMD assembly.
+func LogSoftmaxCAVX2F32(input, output []float32) {
+	lenVal := int64(min(len(input), len(output)))
+	if lenVal == 0 {
+		return
+	}
+	var p_input unsafe.Pointer
+	if len(input) > 0 {
+		p_input = unsafe.Pointer(&input[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	logsoftmax_c_f32_avx2(
+		p_input,
+		p_output,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// LogSoftmaxInPlaceCAVX2F32 computes LogSoftmaxInPlace using AVX2 SIMD assembly.
+func LogSoftmaxInPlaceCAVX2F32(x []float32) {
+	lenVal := int64(len(x))
+	if lenVal == 0 {
+		return
+	}
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	logsoftmaxinplace_c_f32_avx2(
+		p_x,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// SoftmaxCAVX2F32 computes Softmax using AVX2 SIMD assembly.
+func SoftmaxCAVX2F32(input, output []float32) {
+	lenVal := int64(min(len(input), len(output)))
+	if lenVal == 0 {
+		return
+	}
+	var p_input unsafe.Pointer
+	if len(input) > 0 {
+		p_input = unsafe.Pointer(&input[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	softmax_c_f32_avx2(
+		p_input,
+		p_output,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// SoftmaxInPlaceCAVX2F32 computes SoftmaxInPlace using AVX2 SIMD assembly.
+func SoftmaxInPlaceCAVX2F32(x []float32) {
+	lenVal := int64(len(x))
+	if lenVal == 0 {
+		return
+	}
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	softmaxinplace_c_f32_avx2(
+		p_x,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// SoftmaxWithTemperatureCAVX2F32 computes SoftmaxWithTemperature using AVX2 SIMD assembly.
+func SoftmaxWithTemperatureCAVX2F32(input, output []float32, temperature float32) {
+	lenVal := int64(min(len(input), len(output)))
+	if lenVal == 0 {
+		return
+	}
+	var p_input unsafe.Pointer
+	if len(input) > 0 {
+		p_input = unsafe.Pointer(&input[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	temperatureVal := temperature
+	softmaxwithtemperature_c_f32_avx2(
+		p_input,
+		p_output,
+		unsafe.Pointer(&temperatureVal),
+		unsafe.Pointer(&lenVal),
+	)
+}
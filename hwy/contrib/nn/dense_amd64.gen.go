@@ -41,6 +41,17 @@ func Dense[T hwy.Floats](x []T, weight []T, bias []T, output []T, batchSize int,
 
 func init() {
 	initDenseAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "nn",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Dense", Vars: []any{&DenseFloat16, &DenseBFloat16, &DenseFloat32, &DenseFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initDenseAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initDenseAVX2},
+			{Name: "fallback", Supported: true, Init: initDenseFallback},
+		},
+	})
 }
 
 func initDenseAll() {
@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package nn
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("nn", "Dense", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DenseFloat16; hwyImpl != nil {
+			DenseFloat16 = func(x []hwy.Float16, weight []hwy.Float16, bias []hwy.Float16, output []hwy.Float16, batchSize int, inFeatures int, outFeatures int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, weight, bias, output, batchSize, inFeatures, outFeatures)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(weight)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := DenseBFloat16; hwyImpl != nil {
+			DenseBFloat16 = func(x []hwy.BFloat16, weight []hwy.BFloat16, bias []hwy.BFloat16, output []hwy.BFloat16, batchSize int, inFeatures int, outFeatures int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, weight, bias, output, batchSize, inFeatures, outFeatures)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(weight)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := DenseFloat32; hwyImpl != nil {
+			DenseFloat32 = func(x []float32, weight []float32, bias []float32, output []float32, batchSize int, inFeatures int, outFeatures int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, weight, bias, output, batchSize, inFeatures, outFeatures)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(weight)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := DenseFloat64; hwyImpl != nil {
+			DenseFloat64 = func(x []float64, weight []float64, bias []float64, output []float64, batchSize int, inFeatures int, outFeatures int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, weight, bias, output, batchSize, inFeatures, outFeatures)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(weight)+hwy.SliceBytes(bias)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
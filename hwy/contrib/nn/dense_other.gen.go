@@ -39,6 +39,15 @@ func Dense[T hwy.Floats](x []T, weight []T, bias []T, output []T, batchSize int,
 
 func init() {
 	initDenseAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "nn",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Dense", Vars: []any{&DenseFloat16, &DenseBFloat16, &DenseFloat32, &DenseFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initDenseFallback},
+		},
+	})
 }
 
 func initDenseAll() {
@@ -0,0 +1,140 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package nn
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		f16        = make([]hwy.Float16, allocTestLen)
+		bf16       = make([]hwy.BFloat16, allocTestLen)
+		f32        = make([]float32, allocTestLen)
+		f64        = make([]float64, allocTestLen)
+		f16Scalar  = hwy.NewFloat16(1)
+		bf16Scalar = hwy.NewBFloat16(1)
+		f32Scalar  = float32(1)
+		f64Scalar  = float64(1)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseDense_fallback_Float16", func() { BaseDense_fallback_Float16(f16, f16, f16, f16, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseDense_fallback_BFloat16", func() { BaseDense_fallback_BFloat16(bf16, bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseDense_fallback", func() { BaseDense_fallback(f32, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseDense_fallback_Float64", func() { BaseDense_fallback_Float64(f64, f64, f64, f64, allocTestDim, allocTestDim, allocTestDim) }},
+		{"BaseLayerNorm_fallback_Float16", func() { BaseLayerNorm_fallback_Float16(f16, f16, allocTestDim, f16, f16, f16Scalar) }},
+		{"BaseLayerNorm_fallback_BFloat16", func() { BaseLayerNorm_fallback_BFloat16(bf16, bf16, allocTestDim, bf16, bf16, bf16Scalar) }},
+		{"BaseLayerNorm_fallback", func() { BaseLayerNorm_fallback(f32, f32, allocTestDim, f32, f32, f32Scalar) }},
+		{"BaseLayerNorm_fallback_Float64", func() { BaseLayerNorm_fallback_Float64(f64, f64, allocTestDim, f64, f64, f64Scalar) }},
+		{"BaseQKVDense_fallback_Float16", func() {
+			BaseQKVDense_fallback_Float16(f16, f16, f16, f16, f16, f16, f16, f16, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseQKVDense_fallback_BFloat16", func() {
+			BaseQKVDense_fallback_BFloat16(bf16, bf16, bf16, bf16, bf16, bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseQKVDense_fallback", func() {
+			BaseQKVDense_fallback(f32, f32, f32, f32, f32, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseQKVDense_fallback_Float64", func() {
+			BaseQKVDense_fallback_Float64(f64, f64, f64, f64, f64, f64, f64, f64, allocTestDim, allocTestDim, allocTestDim, allocTestDim)
+		}},
+		{"BaseAttentionWeights_fallback_Float16", func() {
+			BaseAttentionWeights_fallback_Float16(f16, f16, f16, f16, allocTestDim, allocTestDim, allocTestDim, f16Scalar)
+		}},
+		{"BaseAttentionWeights_fallback_BFloat16", func() {
+			BaseAttentionWeights_fallback_BFloat16(bf16, bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim, bf16Scalar)
+		}},
+		{"BaseAttentionWeights_fallback", func() {
+			BaseAttentionWeights_fallback(f32, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, f32Scalar)
+		}},
+		{"BaseAttentionWeights_fallback_Float64", func() {
+			BaseAttentionWeights_fallback_Float64(f64, f64, f64, f64, allocTestDim, allocTestDim, allocTestDim, f64Scalar)
+		}},
+		{"BaseSDPA_fallback_Float16", func() {
+			BaseSDPA_fallback_Float16(f16, f16, f16, f16, f16, f16, allocTestDim, allocTestDim, allocTestDim, f16Scalar)
+		}},
+		{"BaseSDPA_fallback_BFloat16", func() {
+			BaseSDPA_fallback_BFloat16(bf16, bf16, bf16, bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim, bf16Scalar)
+		}},
+		{"BaseSDPA_fallback", func() {
+			BaseSDPA_fallback(f32, f32, f32, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, f32Scalar)
+		}},
+		{"BaseSDPA_fallback_Float64", func() {
+			BaseSDPA_fallback_Float64(f64, f64, f64, f64, f64, f64, allocTestDim, allocTestDim, allocTestDim, f64Scalar)
+		}},
+		{"BaseSDPACausal_fallback_Float16", func() {
+			BaseSDPACausal_fallback_Float16(f16, f16, f16, f16, f16, allocTestDim, allocTestDim, allocTestDim, f16Scalar)
+		}},
+		{"BaseSDPACausal_fallback_BFloat16", func() {
+			BaseSDPACausal_fallback_BFloat16(bf16, bf16, bf16, bf16, bf16, allocTestDim, allocTestDim, allocTestDim, bf16Scalar)
+		}},
+		{"BaseSDPACausal_fallback", func() {
+			BaseSDPACausal_fallback(f32, f32, f32, f32, f32, allocTestDim, allocTestDim, allocTestDim, f32Scalar)
+		}},
+		{"BaseSDPACausal_fallback_Float64", func() {
+			BaseSDPACausal_fallback_Float64(f64, f64, f64, f64, f64, allocTestDim, allocTestDim, allocTestDim, f64Scalar)
+		}},
+		{"BaseLogSoftmax_fallback_Float16", func() { BaseLogSoftmax_fallback_Float16(f16, f16) }},
+		{"BaseLogSoftmax_fallback_BFloat16", func() { BaseLogSoftmax_fallback_BFloat16(bf16, bf16) }},
+		{"BaseLogSoftmax_fallback", func() { BaseLogSoftmax_fallback(f32, f32) }},
+		{"BaseLogSoftmax_fallback_Float64", func() { BaseLogSoftmax_fallback_Float64(f64, f64) }},
+		{"BaseLogSoftmaxInPlace_fallback_Float16", func() { BaseLogSoftmaxInPlace_fallback_Float16(f16) }},
+		{"BaseLogSoftmaxInPlace_fallback_BFloat16", func() { BaseLogSoftmaxInPlace_fallback_BFloat16(bf16) }},
+		{"BaseLogSoftmaxInPlace_fallback", func() { BaseLogSoftmaxInPlace_fallback(f32) }},
+		{"BaseLogSoftmaxInPlace_fallback_Float64", func() { BaseLogSoftmaxInPlace_fallback_Float64(f64) }},
+		{"BaseSoftmax_fallback_Float16", func() { BaseSoftmax_fallback_Float16(f16, f16) }},
+		{"BaseSoftmax_fallback_BFloat16", func() { BaseSoftmax_fallback_BFloat16(bf16, bf16) }},
+		{"BaseSoftmax_fallback", func() { BaseSoftmax_fallback(f32, f32) }},
+		{"BaseSoftmax_fallback_Float64", func() { BaseSoftmax_fallback_Float64(f64, f64) }},
+		{"BaseSoftmaxInPlace_fallback_Float16", func() { BaseSoftmaxInPlace_fallback_Float16(f16) }},
+		{"BaseSoftmaxInPlace_fallback_BFloat16", func() { BaseSoftmaxInPlace_fallback_BFloat16(bf16) }},
+		{"BaseSoftmaxInPlace_fallback", func() { BaseSoftmaxInPlace_fallback(f32) }},
+		{"BaseSoftmaxInPlace_fallback_Float64", func() { BaseSoftmaxInPlace_fallback_Float64(f64) }},
+		{"BaseSoftmaxScalar_fallback_Float16", func() { BaseSoftmaxScalar_fallback_Float16(f16, f16) }},
+		{"BaseSoftmaxScalar_fallback_BFloat16", func() { BaseSoftmaxScalar_fallback_BFloat16(bf16, bf16) }},
+		{"BaseSoftmaxScalar_fallback", func() { BaseSoftmaxScalar_fallback(f32, f32) }},
+		{"BaseSoftmaxScalar_fallback_Float64", func() { BaseSoftmaxScalar_fallback_Float64(f64, f64) }},
+		{"BaseSoftmaxWithTemperature_fallback_Float16", func() { BaseSoftmaxWithTemperature_fallback_Float16(f16, f16, f16Scalar) }},
+		{"BaseSoftmaxWithTemperature_fallback_BFloat16", func() { BaseSoftmaxWithTemperature_fallback_BFloat16(bf16, bf16, bf16Scalar) }},
+		{"BaseSoftmaxWithTemperature_fallback", func() { BaseSoftmaxWithTemperature_fallback(f32, f32, f32Scalar) }},
+		{"BaseSoftmaxWithTemperature_fallback_Float64", func() { BaseSoftmaxWithTemperature_fallback_Float64(f64, f64, f64Scalar) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
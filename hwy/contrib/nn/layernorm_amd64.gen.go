@@ -41,6 +41,17 @@ func LayerNorm[T hwy.Floats](input []T, output []T, normSize int, gamma []T, bet
 
 func init() {
 	initLayernormAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "nn",
+		Groups: []hwy.DispatchGroup{
+			{Name: "LayerNorm", Vars: []any{&LayerNormFloat16, &LayerNormBFloat16, &LayerNormFloat32, &LayerNormFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initLayernormAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initLayernormAVX2},
+			{Name: "fallback", Supported: true, Init: initLayernormFallback},
+		},
+	})
 }
 
 func initLayernormAll() {
@@ -39,6 +39,16 @@ func LayerNorm[T hwy.Floats](input []T, output []T, normSize int, gamma []T, bet
 
 func init() {
 	initLayernormAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "nn",
+		Groups: []hwy.DispatchGroup{
+			{Name: "LayerNorm", Vars: []any{&LayerNormFloat16, &LayerNormBFloat16, &LayerNormFloat32, &LayerNormFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initLayernormNEONAsm},
+			{Name: "fallback", Supported: true, Init: initLayernormFallback},
+		},
+	})
 }
 
 func initLayernormAll() {
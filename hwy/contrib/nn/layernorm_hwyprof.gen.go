@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package nn
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("nn", "LayerNorm", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := LayerNormFloat16; hwyImpl != nil {
+			LayerNormFloat16 = func(input []hwy.Float16, output []hwy.Float16, normSize int, gamma []hwy.Float16, beta []hwy.Float16, epsilon hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, normSize, gamma, beta, epsilon)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output)+hwy.SliceBytes(gamma)+hwy.SliceBytes(beta))
+			}
+		}
+		if hwyImpl := LayerNormBFloat16; hwyImpl != nil {
+			LayerNormBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16, normSize int, gamma []hwy.BFloat16, beta []hwy.BFloat16, epsilon hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, normSize, gamma, beta, epsilon)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output)+hwy.SliceBytes(gamma)+hwy.SliceBytes(beta))
+			}
+		}
+		if hwyImpl := LayerNormFloat32; hwyImpl != nil {
+			LayerNormFloat32 = func(input []float32, output []float32, normSize int, gamma []float32, beta []float32, epsilon float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, normSize, gamma, beta, epsilon)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output)+hwy.SliceBytes(gamma)+hwy.SliceBytes(beta))
+			}
+		}
+		if hwyImpl := LayerNormFloat64; hwyImpl != nil {
+			LayerNormFloat64 = func(input []float64, output []float64, normSize int, gamma []float64, beta []float64, epsilon float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, normSize, gamma, beta, epsilon)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output)+hwy.SliceBytes(gamma)+hwy.SliceBytes(beta))
+			}
+		}
+	})
+}
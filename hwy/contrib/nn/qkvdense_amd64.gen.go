@@ -47,6 +47,17 @@ func QKVDense[T hwy.Floats](x []T, wQKV []T, biasQ []T, biasK []T, biasV []T, q
 
 func init() {
 	initQkvdenseAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "nn",
+		Groups: []hwy.DispatchGroup{
+			{Name: "QKVDense", Vars: []any{&QKVDenseFloat16, &QKVDenseBFloat16, &QKVDenseFloat32, &QKVDenseFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initQkvdenseAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initQkvdenseAVX2},
+			{Name: "fallback", Supported: true, Init: initQkvdenseFallback},
+		},
+	})
 }
 
 func initQkvdenseAll() {
@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package nn
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("nn", "QKVDense", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := QKVDenseFloat16; hwyImpl != nil {
+			QKVDenseFloat16 = func(x []hwy.Float16, wQKV []hwy.Float16, biasQ []hwy.Float16, biasK []hwy.Float16, biasV []hwy.Float16, q []hwy.Float16, k []hwy.Float16, v []hwy.Float16, batchSize int, inFeatures int, qDim int, kvDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, wQKV, biasQ, biasK, biasV, q, k, v, batchSize, inFeatures, qDim, kvDim)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(wQKV)+hwy.SliceBytes(biasQ)+hwy.SliceBytes(biasK)+hwy.SliceBytes(biasV)+hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(v))
+			}
+		}
+		if hwyImpl := QKVDenseBFloat16; hwyImpl != nil {
+			QKVDenseBFloat16 = func(x []hwy.BFloat16, wQKV []hwy.BFloat16, biasQ []hwy.BFloat16, biasK []hwy.BFloat16, biasV []hwy.BFloat16, q []hwy.BFloat16, k []hwy.BFloat16, v []hwy.BFloat16, batchSize int, inFeatures int, qDim int, kvDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, wQKV, biasQ, biasK, biasV, q, k, v, batchSize, inFeatures, qDim, kvDim)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(wQKV)+hwy.SliceBytes(biasQ)+hwy.SliceBytes(biasK)+hwy.SliceBytes(biasV)+hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(v))
+			}
+		}
+		if hwyImpl := QKVDenseFloat32; hwyImpl != nil {
+			QKVDenseFloat32 = func(x []float32, wQKV []float32, biasQ []float32, biasK []float32, biasV []float32, q []float32, k []float32, v []float32, batchSize int, inFeatures int, qDim int, kvDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, wQKV, biasQ, biasK, biasV, q, k, v, batchSize, inFeatures, qDim, kvDim)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(wQKV)+hwy.SliceBytes(biasQ)+hwy.SliceBytes(biasK)+hwy.SliceBytes(biasV)+hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(v))
+			}
+		}
+		if hwyImpl := QKVDenseFloat64; hwyImpl != nil {
+			QKVDenseFloat64 = func(x []float64, wQKV []float64, biasQ []float64, biasK []float64, biasV []float64, q []float64, k []float64, v []float64, batchSize int, inFeatures int, qDim int, kvDim int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, wQKV, biasQ, biasK, biasV, q, k, v, batchSize, inFeatures, qDim, kvDim)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(wQKV)+hwy.SliceBytes(biasQ)+hwy.SliceBytes(biasK)+hwy.SliceBytes(biasV)+hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(v))
+			}
+		}
+	})
+}
@@ -45,6 +45,15 @@ func QKVDense[T hwy.Floats](x []T, wQKV []T, biasQ []T, biasK []T, biasV []T, q
 
 func init() {
 	initQkvdenseAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "nn",
+		Groups: []hwy.DispatchGroup{
+			{Name: "QKVDense", Vars: []any{&QKVDenseFloat16, &QKVDenseBFloat16, &QKVDenseFloat32, &QKVDenseFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initQkvdenseFallback},
+		},
+	})
 }
 
 func initQkvdenseAll() {
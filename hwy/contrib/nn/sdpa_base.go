@@ -21,7 +21,7 @@ import (
 	"github.com/ajroetker/go-highway/hwy/contrib/math"
 )
 
-//go:generate go run ../../../cmd/hwygen -input sdpa_base.go -output . -targets avx2,avx512,neon:asm,fallback -dispatch sdpa
+//go:generate go run ../../../cmd/hwygen -input sdpa_base.go -output . -targets avx2,avx512,avx2:asm,avx512:asm,neon:asm,fallback -dispatch sdpa
 
 // BaseSDPA computes single-head scaled dot-product attention.
 //
@@ -0,0 +1,102 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package nn
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("nn", "AttentionWeights", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := AttentionWeightsFloat16; hwyImpl != nil {
+			AttentionWeightsFloat16 = func(q []hwy.Float16, k []hwy.Float16, mask []hwy.Float16, weights []hwy.Float16, seqLen int, kvLen int, headDim int, scale hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(q, k, mask, weights, seqLen, kvLen, headDim, scale)
+				hwyCounter.Done(hwyStart, len(q), hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(mask)+hwy.SliceBytes(weights))
+			}
+		}
+		if hwyImpl := AttentionWeightsBFloat16; hwyImpl != nil {
+			AttentionWeightsBFloat16 = func(q []hwy.BFloat16, k []hwy.BFloat16, mask []hwy.BFloat16, weights []hwy.BFloat16, seqLen int, kvLen int, headDim int, scale hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(q, k, mask, weights, seqLen, kvLen, headDim, scale)
+				hwyCounter.Done(hwyStart, len(q), hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(mask)+hwy.SliceBytes(weights))
+			}
+		}
+		if hwyImpl := AttentionWeightsFloat32; hwyImpl != nil {
+			AttentionWeightsFloat32 = func(q []float32, k []float32, mask []float32, weights []float32, seqLen int, kvLen int, headDim int, scale float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(q, k, mask, weights, seqLen, kvLen, headDim, scale)
+				hwyCounter.Done(hwyStart, len(q), hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(mask)+hwy.SliceBytes(weights))
+			}
+		}
+		if hwyImpl := AttentionWeightsFloat64; hwyImpl != nil {
+			AttentionWeightsFloat64 = func(q []float64, k []float64, mask []float64, weights []float64, seqLen int, kvLen int, headDim int, scale float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(q, k, mask, weights, seqLen, kvLen, headDim, scale)
+				hwyCounter.Done(hwyStart, len(q), hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(mask)+hwy.SliceBytes(weights))
+			}
+		}
+	})
+	hwy.ProfileDispatch("nn", "SDPA", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SDPAFloat16; hwyImpl != nil {
+			SDPAFloat16 = func(q []hwy.Float16, k []hwy.Float16, v []hwy.Float16, mask []hwy.Float16, scores []hwy.Float16, output []hwy.Float16, seqLen int, kvLen int, headDim int, scale hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(q, k, v, mask, scores, output, seqLen, kvLen, headDim, scale)
+				hwyCounter.Done(hwyStart, len(q), hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(v)+hwy.SliceBytes(mask)+hwy.SliceBytes(scores)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SDPABFloat16; hwyImpl != nil {
+			SDPABFloat16 = func(q []hwy.BFloat16, k []hwy.BFloat16, v []hwy.BFloat16, mask []hwy.BFloat16, scores []hwy.BFloat16, output []hwy.BFloat16, seqLen int, kvLen int, headDim int, scale hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(q, k, v, mask, scores, output, seqLen, kvLen, headDim, scale)
+				hwyCounter.Done(hwyStart, len(q), hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(v)+hwy.SliceBytes(mask)+hwy.SliceBytes(scores)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SDPAFloat32; hwyImpl != nil {
+			SDPAFloat32 = func(q []float32, k []float32, v []float32, mask []float32, scores []float32, output []float32, seqLen int, kvLen int, headDim int, scale float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(q, k, v, mask, scores, output, seqLen, kvLen, headDim, scale)
+				hwyCounter.Done(hwyStart, len(q), hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(v)+hwy.SliceBytes(mask)+hwy.SliceBytes(scores)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SDPAFloat64; hwyImpl != nil {
+			SDPAFloat64 = func(q []float64, k []float64, v []float64, mask []float64, scores []float64, output []float64, seqLen int, kvLen int, headDim int, scale float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(q, k, v, mask, scores, output, seqLen, kvLen, headDim, scale)
+				hwyCounter.Done(hwyStart, len(q), hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(v)+hwy.SliceBytes(mask)+hwy.SliceBytes(scores)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("nn", "SDPACausal", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SDPACausalFloat16; hwyImpl != nil {
+			SDPACausalFloat16 = func(q []hwy.Float16, k []hwy.Float16, v []hwy.Float16, scores []hwy.Float16, output []hwy.Float16, seqLen int, kvLen int, headDim int, scale hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(q, k, v, scores, output, seqLen, kvLen, headDim, scale)
+				hwyCounter.Done(hwyStart, len(q), hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(v)+hwy.SliceBytes(scores)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SDPACausalBFloat16; hwyImpl != nil {
+			SDPACausalBFloat16 = func(q []hwy.BFloat16, k []hwy.BFloat16, v []hwy.BFloat16, scores []hwy.BFloat16, output []hwy.BFloat16, seqLen int, kvLen int, headDim int, scale hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(q, k, v, scores, output, seqLen, kvLen, headDim, scale)
+				hwyCounter.Done(hwyStart, len(q), hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(v)+hwy.SliceBytes(scores)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SDPACausalFloat32; hwyImpl != nil {
+			SDPACausalFloat32 = func(q []float32, k []float32, v []float32, scores []float32, output []float32, seqLen int, kvLen int, headDim int, scale float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(q, k, v, scores, output, seqLen, kvLen, headDim, scale)
+				hwyCounter.Done(hwyStart, len(q), hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(v)+hwy.SliceBytes(scores)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SDPACausalFloat64; hwyImpl != nil {
+			SDPACausalFloat64 = func(q []float64, k []float64, v []float64, scores []float64, output []float64, seqLen int, kvLen int, headDim int, scale float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(q, k, v, scores, output, seqLen, kvLen, headDim, scale)
+				hwyCounter.Done(hwyStart, len(q), hwy.SliceBytes(q)+hwy.SliceBytes(k)+hwy.SliceBytes(v)+hwy.SliceBytes(scores)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
@@ -95,6 +95,17 @@ func SDPACausal[T hwy.Floats](q []T, k []T, v []T, scores []T, output []T, seqLe
 
 func init() {
 	initSdpaAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "nn",
+		Groups: []hwy.DispatchGroup{
+			{Name: "AttentionWeights", Vars: []any{&AttentionWeightsFloat16, &AttentionWeightsBFloat16, &AttentionWeightsFloat32, &AttentionWeightsFloat64}},
+			{Name: "SDPA", Vars: []any{&SDPAFloat16, &SDPABFloat16, &SDPAFloat32, &SDPAFloat64}},
+			{Name: "SDPACausal", Vars: []any{&SDPACausalFloat16, &SDPACausalBFloat16, &SDPACausalFloat32, &SDPACausalFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initSdpaFallback},
+		},
+	})
 }
 
 func initSdpaAll() {
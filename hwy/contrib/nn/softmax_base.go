@@ -21,7 +21,7 @@ import (
 	"github.com/ajroetker/go-highway/hwy/contrib/math"
 )
 
-//go:generate go run ../../../cmd/hwygen -input softmax_base.go -output . -targets avx2,avx512,neon:asm,fallback -dispatch softmax
+//go:generate go run ../../../cmd/hwygen -input softmax_base.go -output . -targets avx2,avx512,avx2:asm,avx512:asm,neon:asm,fallback -dispatch softmax
 
 // BaseSoftmax computes the softmax function over the input slice.
 //
@@ -0,0 +1,192 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package nn
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("nn", "LogSoftmax", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := LogSoftmaxFloat16; hwyImpl != nil {
+			LogSoftmaxFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := LogSoftmaxBFloat16; hwyImpl != nil {
+			LogSoftmaxBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := LogSoftmaxFloat32; hwyImpl != nil {
+			LogSoftmaxFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := LogSoftmaxFloat64; hwyImpl != nil {
+			LogSoftmaxFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("nn", "LogSoftmaxInPlace", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := LogSoftmaxInPlaceFloat16; hwyImpl != nil {
+			LogSoftmaxInPlaceFloat16 = func(x []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+			}
+		}
+		if hwyImpl := LogSoftmaxInPlaceBFloat16; hwyImpl != nil {
+			LogSoftmaxInPlaceBFloat16 = func(x []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+			}
+		}
+		if hwyImpl := LogSoftmaxInPlaceFloat32; hwyImpl != nil {
+			LogSoftmaxInPlaceFloat32 = func(x []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+			}
+		}
+		if hwyImpl := LogSoftmaxInPlaceFloat64; hwyImpl != nil {
+			LogSoftmaxInPlaceFloat64 = func(x []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+			}
+		}
+	})
+	hwy.ProfileDispatch("nn", "Softmax", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SoftmaxFloat16; hwyImpl != nil {
+			SoftmaxFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxBFloat16; hwyImpl != nil {
+			SoftmaxBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxFloat32; hwyImpl != nil {
+			SoftmaxFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxFloat64; hwyImpl != nil {
+			SoftmaxFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("nn", "SoftmaxInPlace", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SoftmaxInPlaceFloat16; hwyImpl != nil {
+			SoftmaxInPlaceFloat16 = func(x []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+			}
+		}
+		if hwyImpl := SoftmaxInPlaceBFloat16; hwyImpl != nil {
+			SoftmaxInPlaceBFloat16 = func(x []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+			}
+		}
+		if hwyImpl := SoftmaxInPlaceFloat32; hwyImpl != nil {
+			SoftmaxInPlaceFloat32 = func(x []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+			}
+		}
+		if hwyImpl := SoftmaxInPlaceFloat64; hwyImpl != nil {
+			SoftmaxInPlaceFloat64 = func(x []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+			}
+		}
+	})
+	hwy.ProfileDispatch("nn", "SoftmaxScalar", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SoftmaxScalarFloat16; hwyImpl != nil {
+			SoftmaxScalarFloat16 = func(input []hwy.Float16, output []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxScalarBFloat16; hwyImpl != nil {
+			SoftmaxScalarBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxScalarFloat32; hwyImpl != nil {
+			SoftmaxScalarFloat32 = func(input []float32, output []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxScalarFloat64; hwyImpl != nil {
+			SoftmaxScalarFloat64 = func(input []float64, output []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("nn", "SoftmaxWithTemperature", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SoftmaxWithTemperatureFloat16; hwyImpl != nil {
+			SoftmaxWithTemperatureFloat16 = func(input []hwy.Float16, output []hwy.Float16, temperature hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, temperature)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxWithTemperatureBFloat16; hwyImpl != nil {
+			SoftmaxWithTemperatureBFloat16 = func(input []hwy.BFloat16, output []hwy.BFloat16, temperature hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, temperature)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxWithTemperatureFloat32; hwyImpl != nil {
+			SoftmaxWithTemperatureFloat32 = func(input []float32, output []float32, temperature float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, temperature)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+		if hwyImpl := SoftmaxWithTemperatureFloat64; hwyImpl != nil {
+			SoftmaxWithTemperatureFloat64 = func(input []float64, output []float64, temperature float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, temperature)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
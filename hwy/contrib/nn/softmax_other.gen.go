@@ -163,6 +163,20 @@ func SoftmaxWithTemperature[T hwy.Floats](input []T, output []T, temperature T)
 
 func init() {
 	initSoftmaxAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "nn",
+		Groups: []hwy.DispatchGroup{
+			{Name: "LogSoftmax", Vars: []any{&LogSoftmaxFloat16, &LogSoftmaxBFloat16, &LogSoftmaxFloat32, &LogSoftmaxFloat64}},
+			{Name: "LogSoftmaxInPlace", Vars: []any{&LogSoftmaxInPlaceFloat16, &LogSoftmaxInPlaceBFloat16, &LogSoftmaxInPlaceFloat32, &LogSoftmaxInPlaceFloat64}},
+			{Name: "Softmax", Vars: []any{&SoftmaxFloat16, &SoftmaxBFloat16, &SoftmaxFloat32, &SoftmaxFloat64}},
+			{Name: "SoftmaxInPlace", Vars: []any{&SoftmaxInPlaceFloat16, &SoftmaxInPlaceBFloat16, &SoftmaxInPlaceFloat32, &SoftmaxInPlaceFloat64}},
+			{Name: "SoftmaxScalar", Vars: []any{&SoftmaxScalarFloat16, &SoftmaxScalarBFloat16, &SoftmaxScalarFloat32, &SoftmaxScalarFloat64}},
+			{Name: "SoftmaxWithTemperature", Vars: []any{&SoftmaxWithTemperatureFloat16, &SoftmaxWithTemperatureBFloat16, &SoftmaxWithTemperatureFloat32, &SoftmaxWithTemperatureFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initSoftmaxFallback},
+		},
+	})
 }
 
 func initSoftmaxAll() {
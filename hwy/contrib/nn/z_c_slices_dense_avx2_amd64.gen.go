@@ -0,0 +1,126 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package nn
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/nn/asm"
+)
+
+func init() {
+	initDenseAvx2CAsm()
+}
+
+func initDenseAvx2CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX2() {
+		return
+	}
+	DenseFloat32 = denseAVX2AsmF32
+	DenseFloat64 = denseAVX2AsmF64
+}
+
+func denseAVX2AsmF32(x, weight, bias, output []float32, batchSize, inFeatures, outFeatures int) {
+	if len(x) < batchSize*inFeatures {
+		panic("dense: x slice too short")
+	}
+	if len(weight) < outFeatures*inFeatures {
+		panic("dense: weight slice too short")
+	}
+	if len(output) < batchSize*outFeatures {
+		panic("dense: output slice too short")
+	}
+	if bias != nil && len(bias) < outFeatures {
+		panic("dense: bias slice too short")
+	}
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	var p_weight unsafe.Pointer
+	if len(weight) > 0 {
+		p_weight = unsafe.Pointer(&weight[0])
+	}
+	var p_bias unsafe.Pointer
+	if len(bias) > 0 {
+		p_bias = unsafe.Pointer(&bias[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	batchSizeVal := int64(batchSize)
+	inFeaturesVal := int64(inFeatures)
+	outFeaturesVal := int64(outFeatures)
+	len_xVal := int64(len(x))
+	len_weightVal := int64(len(weight))
+	len_biasVal := int64(len(bias))
+	len_outputVal := int64(len(output))
+	asm.Dense_AVX2_F32(
+		p_x,
+		p_weight,
+		p_bias,
+		p_output,
+		unsafe.Pointer(&batchSizeVal),
+		unsafe.Pointer(&inFeaturesVal),
+		unsafe.Pointer(&outFeaturesVal),
+		unsafe.Pointer(&len_xVal),
+		unsafe.Pointer(&len_weightVal),
+		unsafe.Pointer(&len_biasVal),
+		unsafe.Pointer(&len_outputVal),
+	)
+}
+
+func denseAVX2AsmF64(x, weight, bias, output []float64, batchSize, inFeatures, outFeatures int) {
+	if len(x) < batchSize*inFeatures {
+		panic("dense: x slice too short")
+	}
+	if len(weight) < outFeatures*inFeatures {
+		panic("dense: weight slice too short")
+	}
+	if len(output) < batchSize*outFeatures {
+		panic("dense: output slice too short")
+	}
+	if bias != nil && len(bias) < outFeatures {
+		panic("dense: bias slice too short")
+	}
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	var p_weight unsafe.Pointer
+	if len(weight) > 0 {
+		p_weight = unsafe.Pointer(&weight[0])
+	}
+	var p_bias unsafe.Pointer
+	if len(bias) > 0 {
+		p_bias = unsafe.Pointer(&bias[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	batchSizeVal := int64(batchSize)
+	inFeaturesVal := int64(inFeatures)
+	outFeaturesVal := int64(outFeatures)
+	len_xVal := int64(len(x))
+	len_weightVal := int64(len(weight))
+	len_biasVal := int64(len(bias))
+	len_outputVal := int64(len(output))
+	asm.Dense_AVX2_F64(
+		p_x,
+		p_weight,
+		p_bias,
+		p_output,
+		unsafe.Pointer(&batchSizeVal),
+		unsafe.Pointer(&inFeaturesVal),
+		unsafe.Pointer(&outFeaturesVal),
+		unsafe.Pointer(&len_xVal),
+		unsafe.Pointer(&len_weightVal),
+		unsafe.Pointer(&len_biasVal),
+		unsafe.Pointer(&len_outputVal),
+	)
+}
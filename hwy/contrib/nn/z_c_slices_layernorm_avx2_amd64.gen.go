@@ -0,0 +1,98 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package nn
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/nn/asm"
+)
+
+func init() {
+	initLayernormAvx2CAsm()
+}
+
+func initLayernormAvx2CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX2() {
+		return
+	}
+	LayerNormFloat32 = layerNormAVX2AsmF32
+	LayerNormFloat64 = layerNormAVX2AsmF64
+}
+
+func layerNormAVX2AsmF32(input, output []float32, normSize int, gamma, beta []float32, epsilon float32) {
+	var p_input unsafe.Pointer
+	if len(input) > 0 {
+		p_input = unsafe.Pointer(&input[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	var p_gamma unsafe.Pointer
+	if len(gamma) > 0 {
+		p_gamma = unsafe.Pointer(&gamma[0])
+	}
+	var p_beta unsafe.Pointer
+	if len(beta) > 0 {
+		p_beta = unsafe.Pointer(&beta[0])
+	}
+	normSizeVal := int64(normSize)
+	epsilonVal := epsilon
+	len_inputVal := int64(len(input))
+	len_outputVal := int64(len(output))
+	len_gammaVal := int64(len(gamma))
+	len_betaVal := int64(len(beta))
+	asm.LayerNorm_AVX2_F32(
+		p_input,
+		p_output,
+		unsafe.Pointer(&normSizeVal),
+		p_gamma,
+		p_beta,
+		unsafe.Pointer(&epsilonVal),
+		unsafe.Pointer(&len_inputVal),
+		unsafe.Pointer(&len_outputVal),
+		unsafe.Pointer(&len_gammaVal),
+		unsafe.Pointer(&len_betaVal),
+	)
+}
+
+func layerNormAVX2AsmF64(input, output []float64, normSize int, gamma, beta []float64, epsilon float64) {
+	var p_input unsafe.Pointer
+	if len(input) > 0 {
+		p_input = unsafe.Pointer(&input[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	var p_gamma unsafe.Pointer
+	if len(gamma) > 0 {
+		p_gamma = unsafe.Pointer(&gamma[0])
+	}
+	var p_beta unsafe.Pointer
+	if len(beta) > 0 {
+		p_beta = unsafe.Pointer(&beta[0])
+	}
+	normSizeVal := int64(normSize)
+	epsilonVal := epsilon
+	len_inputVal := int64(len(input))
+	len_outputVal := int64(len(output))
+	len_gammaVal := int64(len(gamma))
+	len_betaVal := int64(len(beta))
+	asm.LayerNorm_AVX2_F64(
+		p_input,
+		p_output,
+		unsafe.Pointer(&normSizeVal),
+		p_gamma,
+		p_beta,
+		unsafe.Pointer(&epsilonVal),
+		unsafe.Pointer(&len_inputVal),
+		unsafe.Pointer(&len_outputVal),
+		unsafe.Pointer(&len_gammaVal),
+		unsafe.Pointer(&len_betaVal),
+	)
+}
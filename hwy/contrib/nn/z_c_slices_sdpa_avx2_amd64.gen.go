@@ -0,0 +1,169 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package nn
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/nn/asm"
+)
+
+func init() {
+	initSdpaAvx2CAsm()
+}
+
+func initSdpaAvx2CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX2() {
+		return
+	}
+	AttentionWeightsFloat32 = attentionWeightsAVX2AsmF32
+	SDPAFloat32 = sDPAAVX2AsmF32
+	SDPACausalFloat32 = sDPACausalAVX2AsmF32
+}
+
+func attentionWeightsAVX2AsmF32(q, k, mask, weights []float32, seqLen, kvLen, headDim int, scale float32) {
+	var p_q unsafe.Pointer
+	if len(q) > 0 {
+		p_q = unsafe.Pointer(&q[0])
+	}
+	var p_k unsafe.Pointer
+	if len(k) > 0 {
+		p_k = unsafe.Pointer(&k[0])
+	}
+	var p_mask unsafe.Pointer
+	if len(mask) > 0 {
+		p_mask = unsafe.Pointer(&mask[0])
+	}
+	var p_weights unsafe.Pointer
+	if len(weights) > 0 {
+		p_weights = unsafe.Pointer(&weights[0])
+	}
+	seqLenVal := int64(seqLen)
+	kvLenVal := int64(kvLen)
+	headDimVal := int64(headDim)
+	scaleVal := scale
+	len_qVal := int64(len(q))
+	len_kVal := int64(len(k))
+	len_maskVal := int64(len(mask))
+	len_weightsVal := int64(len(weights))
+	asm.AttentionWeights_AVX2_F32(
+		p_q,
+		p_k,
+		p_mask,
+		p_weights,
+		unsafe.Pointer(&seqLenVal),
+		unsafe.Pointer(&kvLenVal),
+		unsafe.Pointer(&headDimVal),
+		unsafe.Pointer(&scaleVal),
+		unsafe.Pointer(&len_qVal),
+		unsafe.Pointer(&len_kVal),
+		unsafe.Pointer(&len_maskVal),
+		unsafe.Pointer(&len_weightsVal),
+	)
+}
+
+func sDPAAVX2AsmF32(q, k, v, mask, scores, output []float32, seqLen, kvLen, headDim int, scale float32) {
+	var p_q unsafe.Pointer
+	if len(q) > 0 {
+		p_q = unsafe.Pointer(&q[0])
+	}
+	var p_k unsafe.Pointer
+	if len(k) > 0 {
+		p_k = unsafe.Pointer(&k[0])
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var p_mask unsafe.Pointer
+	if len(mask) > 0 {
+		p_mask = unsafe.Pointer(&mask[0])
+	}
+	var p_scores unsafe.Pointer
+	if len(scores) > 0 {
+		p_scores = unsafe.Pointer(&scores[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	seqLenVal := int64(seqLen)
+	kvLenVal := int64(kvLen)
+	headDimVal := int64(headDim)
+	scaleVal := scale
+	len_qVal := int64(len(q))
+	len_kVal := int64(len(k))
+	len_vVal := int64(len(v))
+	len_maskVal := int64(len(mask))
+	len_scoresVal := int64(len(scores))
+	len_outputVal := int64(len(output))
+	asm.SDPA_AVX2_F32(
+		p_q,
+		p_k,
+		p_v,
+		p_mask,
+		p_scores,
+		p_output,
+		unsafe.Pointer(&seqLenVal),
+		unsafe.Pointer(&kvLenVal),
+		unsafe.Pointer(&headDimVal),
+		unsafe.Pointer(&scaleVal),
+		unsafe.Pointer(&len_qVal),
+		unsafe.Pointer(&len_kVal),
+		unsafe.Pointer(&len_vVal),
+		unsafe.Pointer(&len_maskVal),
+		unsafe.Pointer(&len_scoresVal),
+		unsafe.Pointer(&len_outputVal),
+	)
+}
+
+func sDPACausalAVX2AsmF32(q, k, v, scores, output []float32, seqLen, kvLen, headDim int, scale float32) {
+	var p_q unsafe.Pointer
+	if len(q) > 0 {
+		p_q = unsafe.Pointer(&q[0])
+	}
+	var p_k unsafe.Pointer
+	if len(k) > 0 {
+		p_k = unsafe.Pointer(&k[0])
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var p_scores unsafe.Pointer
+	if len(scores) > 0 {
+		p_scores = unsafe.Pointer(&scores[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	seqLenVal := int64(seqLen)
+	kvLenVal := int64(kvLen)
+	headDimVal := int64(headDim)
+	scaleVal := scale
+	len_qVal := int64(len(q))
+	len_kVal := int64(len(k))
+	len_vVal := int64(len(v))
+	len_scoresVal := int64(len(scores))
+	len_outputVal := int64(len(output))
+	asm.SDPACausal_AVX2_F32(
+		p_q,
+		p_k,
+		p_v,
+		p_scores,
+		p_output,
+		unsafe.Pointer(&seqLenVal),
+		unsafe.Pointer(&kvLenVal),
+		unsafe.Pointer(&headDimVal),
+		unsafe.Pointer(&scaleVal),
+		unsafe.Pointer(&len_qVal),
+		unsafe.Pointer(&len_kVal),
+		unsafe.Pointer(&len_vVal),
+		unsafe.Pointer(&len_scoresVal),
+		unsafe.Pointer(&len_outputVal),
+	)
+}
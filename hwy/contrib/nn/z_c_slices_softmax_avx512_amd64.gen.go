@@ -0,0 +1,119 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package nn
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/nn/asm"
+)
+
+func init() {
+	initSoftmaxAvx512CAsm()
+}
+
+func initSoftmaxAvx512CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX512() {
+		return
+	}
+	LogSoftmaxFloat32 = logSoftmaxAVX512AsmF32
+	LogSoftmaxInPlaceFloat32 = logSoftmaxInPlaceAVX512AsmF32
+	SoftmaxFloat32 = softmaxAVX512AsmF32
+	SoftmaxInPlaceFloat32 = softmaxInPlaceAVX512AsmF32
+	SoftmaxWithTemperatureFloat32 = softmaxWithTemperatureAVX512AsmF32
+}
+
+func logSoftmaxAVX512AsmF32(input, output []float32) {
+	var p_input unsafe.Pointer
+	if len(input) > 0 {
+		p_input = unsafe.Pointer(&input[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	lenVal := int64(min(len(input), len(output)))
+	if lenVal == 0 {
+		return
+	}
+	asm.LogSoftmax_AVX512_F32(
+		p_input,
+		p_output,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func logSoftmaxInPlaceAVX512AsmF32(x []float32) {
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	lenVal := int64(len(x))
+	if lenVal == 0 {
+		return
+	}
+	asm.LogSoftmaxInPlace_AVX512_F32(
+		p_x,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func softmaxAVX512AsmF32(input, output []float32) {
+	var p_input unsafe.Pointer
+	if len(input) > 0 {
+		p_input = unsafe.Pointer(&input[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	lenVal := int64(min(len(input), len(output)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Softmax_AVX512_F32(
+		p_input,
+		p_output,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func softmaxInPlaceAVX512AsmF32(x []float32) {
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	lenVal := int64(len(x))
+	if lenVal == 0 {
+		return
+	}
+	asm.SoftmaxInPlace_AVX512_F32(
+		p_x,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func softmaxWithTemperatureAVX512AsmF32(input, output []float32, temperature float32) {
+	var p_input unsafe.Pointer
+	if len(input) > 0 {
+		p_input = unsafe.Pointer(&input[0])
+	}
+	var p_output unsafe.Pointer
+	if len(output) > 0 {
+		p_output = unsafe.Pointer(&output[0])
+	}
+	temperatureVal := temperature
+	lenVal := int64(min(len(input), len(output)))
+	if lenVal == 0 {
+		return
+	}
+	asm.SoftmaxWithTemperature_AVX512_F32(
+		p_input,
+		p_output,
+		unsafe.Pointer(&temperatureVal),
+		unsafe.Pointer(&lenVal),
+	)
+}
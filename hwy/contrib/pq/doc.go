@@ -0,0 +1,47 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package pq implements product quantization (PQ) with asymmetric distance
+// computation (ADC) and a 4-bit FastScan path.
+//
+// A Quantizer splits vectors into M sub-vectors and encodes each as the
+// index of its nearest centroid in a per-sub-space codebook of 2^Bits
+// centroids learned with k-means (ivf.KMeans over the vec kernels):
+//
+//	q := pq.Train(pool, data, count, dims, m, 4, ivf.KMeansConfig{})
+//	codes := make([]uint8, count*q.M())
+//	q.Encode(pool, data, count, codes)
+//
+// # Asymmetric Distance Computation
+//
+// The query is kept in float32. DistanceTable computes the squared distance
+// from every query sub-vector to every centroid of its sub-space, and the
+// distance to an encoded vector is the sum of M table entries (ADC).
+//
+// # FastScan
+//
+// With 4-bit codes each sub-space has 16 centroids, so its distance table
+// fits a single 16-byte register. QuantizeTable turns the float table into
+// uint8 entries, PackCodes transposes codes into blocks of 32, and ScanBlock
+// scores 16 codes per byte-shuffle instruction (PSHUFB on x86, TBL on ARM),
+// widening the looked-up bytes into 16-bit sums kept in registers for the
+// whole block (see the fastscan package).
+// FastScanCodes wraps these into a k-nearest-neighbor search that only
+// computes exact ADC distances for codes the quantized estimate cannot
+// rule out:
+//
+//	fs := q.NewFastScanCodes(codes, count)
+//	neighbors := fs.Search(query, 10)
+//	batch := fs.SearchBatch(pool, queries, 10)
+package pq
@@ -0,0 +1,232 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package pq
+
+import (
+	"math"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/fastscan"
+	"github.com/ajroetker/go-highway/hwy/contrib/topk"
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// BlockSize is the number of codes scored together by ScanBlock.
+const BlockSize = fastscan.BlockSize
+
+// LUTMax is the largest entry of a quantized LUT. It trades LUT resolution
+// against MaxFastScanM.
+const LUTMax = 127
+
+// MaxFastScanM is the largest number of sub-quantizers supported by the
+// FastScan path; M*LUTMax must fit in the uint16 accumulators.
+const MaxFastScanM = math.MaxUint16 / LUTMax
+
+// PackedSize returns the size in bytes of count packed 4-bit codes of m
+// sub-quantizers, rounded up to whole blocks.
+func PackedSize(count, m int) int {
+	blocks := (count + BlockSize - 1) / BlockSize
+	return blocks * BlockSize * m
+}
+
+// PackCodes transposes count 4-bit codes (as produced by Encode with
+// Bits() == 4, m bytes each) into the blocked layout read by ScanBlock.
+//
+// Codes are grouped in blocks of BlockSize. Within a block, each
+// sub-quantizer occupies 32 bytes; byte j holds the code of vector j. The
+// last block is zero padded. dst must hold PackedSize(count, m) bytes.
+func PackCodes(codes []uint8, count, m int, dst []uint8) {
+	size := PackedSize(count, m)
+	if size == 0 {
+		return
+	}
+	_ = dst[size-1]
+	clear(dst[:size])
+	for i := range count {
+		block := dst[(i/BlockSize)*BlockSize*m:]
+		j := i % BlockSize
+		for s, c := range codes[i*m : (i+1)*m] {
+			block[s*BlockSize+j] = c & 0xf
+		}
+	}
+}
+
+// QuantizeTable quantizes a float distance table of m sub-quantizers with 16
+// centroids each (see Quantizer.DistanceTable) to uint8 entries in
+// [0, LUTMax], writing 16*m bytes to lut. m must not exceed MaxFastScanM.
+//
+// Each sub-quantizer's entries are shifted by their minimum, and all entries
+// share one step chosen so the largest shifted entry maps to LUTMax. A sum of
+// quantized entries s approximates the float distance as bias + scale*s, off
+// by at most m*scale/2.
+func QuantizeTable(table []float32, m int, lut []uint8) (bias, scale float32) {
+	if m == 0 {
+		return 0, 0
+	}
+	_ = table[m*16-1]
+	_ = lut[m*16-1]
+	var mins [MaxFastScanM]float32
+	var span float32
+	for s := range m {
+		entries := table[s*16 : s*16+16]
+		lo, hi := entries[0], entries[0]
+		for _, v := range entries[1:] {
+			lo = min(lo, v)
+			hi = max(hi, v)
+		}
+		mins[s] = lo
+		bias += lo
+		span = max(span, hi-lo)
+	}
+	scale = span / LUTMax
+	var inv float32
+	if scale > 0 {
+		inv = 1 / scale
+	}
+	for s := range m {
+		for c := range 16 {
+			lut[s*16+c] = uint8(min(LUTMax, int((table[s*16+c]-mins[s])*inv+0.5)))
+		}
+	}
+	return bias, scale
+}
+
+// ScanBlock computes the quantized asymmetric distances of one block of
+// BlockSize 4-bit PQ codes against a uint8 query LUT.
+//
+// codes holds the block in the layout produced by PackCodes: for each
+// sub-quantizer, 32 bytes whose byte j is the code of vector j. lut holds 16
+// entries per sub-quantizer (see QuantizeTable). m is the number of
+// sub-quantizers. The block is scored by fastscan.ScanBlock, which keeps the
+// sums in uint16 vector lanes for the whole block.
+func ScanBlock(codes []uint8, lut []uint8, m int, out []uint16) {
+	fastscan.ScanBlock(codes, lut, m, out)
+}
+
+// Scan computes the quantized distances of count packed codes against a
+// query LUT, writing one value per code to out. It is the batched
+// equivalent of summing the LUT entries selected by every code.
+func Scan(packed []uint8, lut []uint8, m, count int, out []uint16) {
+	if count == 0 {
+		return
+	}
+	_ = out[count-1]
+	var tail [BlockSize]uint16
+	for start := 0; start < count; start += BlockSize {
+		block := packed[(start/BlockSize)*BlockSize*m:]
+		if start+BlockSize <= count {
+			ScanBlock(block, lut, m, out[start:start+BlockSize])
+			continue
+		}
+		ScanBlock(block, lut, m, tail[:])
+		copy(out[start:count], tail[:])
+	}
+}
+
+// FastScanCodes holds 4-bit PQ codes in the blocked FastScan layout and
+// answers k-nearest-neighbor queries over them.
+//
+// Search scores every code with the quantized LUT, and computes the exact
+// asymmetric distance (the float table sum) only for codes whose quantized
+// estimate, minus its error bound, beats the current k-th best distance.
+// Results are therefore identical to an exhaustive float ADC scan.
+type FastScanCodes struct {
+	q      *Quantizer
+	count  int
+	packed []uint8
+}
+
+// NewFastScanCodes packs count codes produced by Encode. The quantizer must
+// use 4-bit codes and at most MaxFastScanM sub-quantizers.
+func (q *Quantizer) NewFastScanCodes(codes []uint8, count int) *FastScanCodes {
+	if q.bits != 4 {
+		panic("pq: FastScan requires 4-bit codes")
+	}
+	if q.m > MaxFastScanM {
+		panic("pq: too many sub-quantizers for FastScan")
+	}
+	c := &FastScanCodes{q: q, count: count, packed: make([]uint8, PackedSize(count, q.m))}
+	PackCodes(codes, count, q.m, c.packed)
+	return c
+}
+
+// Len returns the number of codes.
+func (c *FastScanCodes) Len() int { return c.count }
+
+// Search returns the k codes nearest to query in asymmetric distance, as
+// neighbors whose ID is the code's index, in order of increasing distance.
+func (c *FastScanCodes) Search(query []float32, k int) []topk.Neighbor {
+	h := topk.New(k)
+	c.search(query, h, c.newScratch())
+	return h.Sorted(nil)
+}
+
+// SearchBatch runs Search for each of the len(queries)/Dims() queries, in
+// parallel on pool, and returns their results in query order.
+func (c *FastScanCodes) SearchBatch(pool workerpool.Executor, queries []float32, k int) [][]topk.Neighbor {
+	d := c.q.dims
+	nq := len(queries) / d
+	results := make([][]topk.Neighbor, nq)
+	run := func(start, end int) {
+		h := topk.New(k)
+		s := c.newScratch()
+		for qi := start; qi < end; qi++ {
+			h.Reset()
+			c.search(queries[qi*d:(qi+1)*d], h, s)
+			results[qi] = h.Sorted(nil)
+		}
+	}
+	if pool == nil {
+		run(0, nq)
+	} else {
+		pool.ParallelForAtomicBatched(nq, 1, run)
+	}
+	return results
+}
+
+// scanScratch holds the per-query tables of a FastScan search.
+type scanScratch struct {
+	table []float32
+	lut   []uint8
+}
+
+func (c *FastScanCodes) newScratch() *scanScratch {
+	return &scanScratch{table: make([]float32, c.q.m*16), lut: make([]uint8, c.q.m*16)}
+}
+
+func (c *FastScanCodes) search(query []float32, h *topk.Heap, s *scanScratch) {
+	m := c.q.m
+	c.q.DistanceTable(query, s.table)
+	bias, scale := QuantizeTable(s.table, m, s.lut)
+	// Rounding error of the quantized sum, with slack for float rounding.
+	slack := scale * (float32(m)/2 + 1)
+
+	blockBytes := BlockSize * m
+	var sums [BlockSize]uint16
+	for start := 0; start < c.count; start += BlockSize {
+		block := c.packed[(start/BlockSize)*blockBytes:][:blockBytes]
+		ScanBlock(block, s.lut, m, sums[:])
+		n := min(BlockSize, c.count-start)
+		for j := range n {
+			if bias+scale*float32(sums[j])-slack > h.Threshold() {
+				continue
+			}
+			var dist float32
+			for sq := range m {
+				dist += s.table[sq*16+int(block[sq*BlockSize+j])]
+			}
+			h.Push(int64(start+j), dist)
+		}
+	}
+}
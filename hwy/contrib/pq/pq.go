@@ -0,0 +1,185 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package pq
+
+import (
+	"github.com/ajroetker/go-highway/hwy/contrib/ivf"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec"
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// MaxBits is the largest supported number of bits per sub-quantizer code.
+const MaxBits = 8
+
+// MinParallelEncode is the minimum number of vectors before Encode splits
+// the work across the pool.
+const MinParallelEncode = 256
+
+// encodeBatch is the number of vectors handed to a worker at a time.
+const encodeBatch = 64
+
+// Quantizer is a product quantizer. A vector of Dims components is split
+// into M contiguous sub-vectors of Dims/M components, and each sub-vector is
+// replaced by the index of its nearest centroid in that sub-space's codebook
+// of 2^Bits centroids.
+//
+// A Quantizer is immutable after construction and safe for concurrent use.
+type Quantizer struct {
+	dims, m, bits int
+	dsub, ksub    int
+	// codebooks holds m codebooks of ksub centroids of dsub components.
+	codebooks []float32
+}
+
+// New returns a quantizer using the given codebooks, laid out as m
+// codebooks of 2^bits centroids of dims/m components each.
+func New(codebooks []float32, dims, m, bits int) *Quantizer {
+	if dims <= 0 || m <= 0 || dims%m != 0 {
+		panic("pq: dims must be a positive multiple of m")
+	}
+	if bits <= 0 || bits > MaxBits {
+		panic("pq: bits must be in [1, 8]")
+	}
+	q := &Quantizer{dims: dims, m: m, bits: bits, dsub: dims / m, ksub: 1 << bits}
+	if len(codebooks) != m*q.ksub*q.dsub {
+		panic("pq: codebooks must hold m * 2^bits * dims/m values")
+	}
+	q.codebooks = codebooks
+	return q
+}
+
+// Train learns a product quantizer with m sub-quantizers of 2^bits centroids
+// from count training vectors of dims components, by running KMeans
+// independently in every sub-space. Sub-spaces are trained one after the
+// other, each over the whole pool.
+func Train(pool workerpool.Executor, data []float32, count, dims, m, bits int, cfg ivf.KMeansConfig) *Quantizer {
+	if dims <= 0 || m <= 0 || dims%m != 0 {
+		panic("pq: dims must be a positive multiple of m")
+	}
+	if bits <= 0 || bits > MaxBits {
+		panic("pq: bits must be in [1, 8]")
+	}
+	dsub, ksub := dims/m, 1<<bits
+	codebooks := make([]float32, m*ksub*dsub)
+	sub := make([]float32, count*dsub)
+	for s := range m {
+		for i := range count {
+			copy(sub[i*dsub:(i+1)*dsub], data[i*dims+s*dsub:i*dims+(s+1)*dsub])
+		}
+		subCfg := cfg
+		subCfg.Seed += uint64(s)
+		copy(codebooks[s*ksub*dsub:], ivf.KMeans(pool, sub, count, dsub, ksub, subCfg))
+	}
+	return New(codebooks, dims, m, bits)
+}
+
+// Dims returns the vector dimensionality.
+func (q *Quantizer) Dims() int { return q.dims }
+
+// M returns the number of sub-quantizers, which is also the code size in
+// bytes as produced by Encode.
+func (q *Quantizer) M() int { return q.m }
+
+// Bits returns the number of bits per sub-quantizer code.
+func (q *Quantizer) Bits() int { return q.bits }
+
+// Codebooks returns the codebooks (see New for the layout).
+func (q *Quantizer) Codebooks() []float32 { return q.codebooks }
+
+// TableSize returns the number of entries of a distance table,
+// M * 2^Bits.
+func (q *Quantizer) TableSize() int { return q.m * q.ksub }
+
+// codebook returns the centroids of sub-space s.
+func (q *Quantizer) codebook(s int) []float32 {
+	return q.codebooks[s*q.ksub*q.dsub : (s+1)*q.ksub*q.dsub]
+}
+
+// Encode writes the M-byte codes of count vectors to codes (count*M bytes),
+// one byte per sub-quantizer holding the index of the nearest centroid.
+//
+// Falls back to sequential execution when pool is nil or count is below
+// MinParallelEncode.
+func (q *Quantizer) Encode(pool workerpool.Executor, vectors []float32, count int, codes []uint8) {
+	if count == 0 {
+		return
+	}
+	_ = vectors[count*q.dims-1]
+	_ = codes[count*q.m-1]
+	run := func(start, end int) {
+		dist := make([]float32, q.ksub)
+		for i := start; i < end; i++ {
+			v := vectors[i*q.dims : (i+1)*q.dims]
+			for s := range q.m {
+				vec.BatchL2SquaredDistanceFloat32(v[s*q.dsub:(s+1)*q.dsub], q.codebook(s), dist, q.ksub, q.dsub)
+				codes[i*q.m+s] = uint8(vec.ArgminFloat32(dist))
+			}
+		}
+	}
+	if pool == nil || count < MinParallelEncode {
+		run(0, count)
+		return
+	}
+	pool.ParallelForAtomicBatched(count, encodeBatch, run)
+}
+
+// Decode reconstructs count vectors from their codes into dst
+// (count*Dims values).
+func (q *Quantizer) Decode(codes []uint8, count int, dst []float32) {
+	if count == 0 {
+		return
+	}
+	_ = codes[count*q.m-1]
+	_ = dst[count*q.dims-1]
+	for i := range count {
+		for s := range q.m {
+			c := int(codes[i*q.m+s])
+			copy(dst[i*q.dims+s*q.dsub:i*q.dims+(s+1)*q.dsub], q.codebook(s)[c*q.dsub:(c+1)*q.dsub])
+		}
+	}
+}
+
+// DistanceTable writes the asymmetric distance table of query to table
+// (TableSize entries): entry s*2^Bits+c is the squared distance from
+// sub-vector s of the query to centroid c of sub-space s. The squared
+// distance from the query to a decoded vector is the sum of the entries
+// selected by its code.
+func (q *Quantizer) DistanceTable(query []float32, table []float32) {
+	_ = query[q.dims-1]
+	_ = table[q.m*q.ksub-1]
+	for s := range q.m {
+		vec.BatchL2SquaredDistanceFloat32(query[s*q.dsub:(s+1)*q.dsub], q.codebook(s), table[s*q.ksub:(s+1)*q.ksub], q.ksub, q.dsub)
+	}
+}
+
+// ADC computes the asymmetric distances of count codes (as produced by
+// Encode) from the query whose distance table is table, writing one
+// squared distance per code to dist.
+func (q *Quantizer) ADC(table []float32, codes []uint8, count int, dist []float32) {
+	if count == 0 {
+		return
+	}
+	_ = table[q.m*q.ksub-1]
+	_ = codes[count*q.m-1]
+	_ = dist[count-1]
+	for i := range count {
+		code := codes[i*q.m : (i+1)*q.m]
+		var sum float32
+		for s, c := range code {
+			sum += table[s*q.ksub+int(c)]
+		}
+		dist[i] = sum
+	}
+}
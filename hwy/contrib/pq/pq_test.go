@@ -0,0 +1,234 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package pq
+
+import (
+	"math/rand/v2"
+	"slices"
+	"strconv"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/ivf"
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// clustered returns count vectors of dims components drawn around a few
+// random centers.
+func clustered(rng *rand.Rand, count, dims int) []float32 {
+	const centers = 8
+	c := make([]float32, centers*dims)
+	for i := range c {
+		c[i] = 4 * float32(rng.NormFloat64())
+	}
+	data := make([]float32, count*dims)
+	for i := range count {
+		k := rng.IntN(centers)
+		for d := range dims {
+			data[i*dims+d] = c[k*dims+d] + float32(rng.NormFloat64())
+		}
+	}
+	return data
+}
+
+func TestScanBlockMatchesTableSum(t *testing.T) {
+	rng := rand.New(rand.NewPCG(1, 1))
+	for _, m := range []int{1, 2, 3, 8, 16, 33, 64} {
+		for _, count := range []int{1, 31, 32, 33, 100} {
+			codes := make([]uint8, count*m)
+			for i := range codes {
+				codes[i] = uint8(rng.IntN(16))
+			}
+			lut := make([]uint8, 16*m)
+			for i := range lut {
+				lut[i] = uint8(rng.IntN(LUTMax + 1))
+			}
+			packed := make([]uint8, PackedSize(count, m))
+			PackCodes(codes, count, m, packed)
+			out := make([]uint16, count)
+			Scan(packed, lut, m, count, out)
+			for i := range count {
+				var want uint16
+				for s := range m {
+					want += uint16(lut[s*16+int(codes[i*m+s])])
+				}
+				if out[i] != want {
+					t.Fatalf("m=%d count=%d code %d: got %d, want %d", m, count, i, out[i], want)
+				}
+			}
+		}
+	}
+}
+
+func TestQuantizeTable(t *testing.T) {
+	rng := rand.New(rand.NewPCG(2, 1))
+	const m = 24
+	table := make([]float32, m*16)
+	for i := range table {
+		table[i] = rng.Float32() * 10
+	}
+	lut := make([]uint8, m*16)
+	bias, scale := QuantizeTable(table, m, lut)
+	for trial := range 1000 {
+		var exact, sum float32
+		for s := range m {
+			c := (trial*7 + s*3) % 16
+			exact += table[s*16+c]
+			sum += float32(lut[s*16+c])
+		}
+		if est := bias + scale*sum; abs(est-exact) > scale*m/2*1.001 {
+			t.Fatalf("trial %d: estimate %v, exact %v, bound %v", trial, est, exact, scale*m/2)
+		}
+	}
+	if slices.Max(lut) != LUTMax {
+		t.Errorf("largest entry %d, want %d", slices.Max(lut), LUTMax)
+	}
+}
+
+func abs(x float32) float32 {
+	if x < 0 {
+		return -x
+	}
+	return x
+}
+
+func TestTrainEncodeDecode(t *testing.T) {
+	const count, dims, m = 2000, 32, 8
+	rng := rand.New(rand.NewPCG(3, 1))
+	data := clustered(rng, count, dims)
+	pool := workerpool.New(4)
+	defer pool.Close()
+
+	q := Train(pool, data, count, dims, m, 4, ivf.KMeansConfig{Seed: 1})
+	codes := make([]uint8, count*m)
+	q.Encode(pool, data, count, codes)
+	seqCodes := make([]uint8, count*m)
+	q.Encode(nil, data, count, seqCodes)
+	if !slices.Equal(codes, seqCodes) {
+		t.Fatal("parallel and sequential encodings differ")
+	}
+
+	decoded := make([]float32, count*dims)
+	q.Decode(codes, count, decoded)
+	var errSum, normSum float64
+	for i := range data {
+		d := float64(data[i] - decoded[i])
+		errSum += d * d
+		normSum += float64(data[i]) * float64(data[i])
+	}
+	if rel := errSum / normSum; rel > 0.1 {
+		t.Errorf("relative reconstruction error %.4f, want <= 0.1", rel)
+	}
+
+	// ADC equals the distance to the decoded vector.
+	query := clustered(rng, 1, dims)
+	table := make([]float32, q.TableSize())
+	q.DistanceTable(query, table)
+	dist := make([]float32, count)
+	q.ADC(table, codes, count, dist)
+	for i := range count {
+		var want float32
+		for d := range dims {
+			diff := query[d] - decoded[i*dims+d]
+			want += diff * diff
+		}
+		if abs(dist[i]-want) > 1e-4*want+1e-4 {
+			t.Fatalf("ADC[%d] = %v, want %v", i, dist[i], want)
+		}
+	}
+}
+
+func TestFastScanSearchMatchesADC(t *testing.T) {
+	const count, dims, m, k = 3000, 64, 16, 10
+	rng := rand.New(rand.NewPCG(4, 1))
+	data := clustered(rng, count, dims)
+	q := Train(nil, data, count, dims, m, 4, ivf.KMeansConfig{Seed: 2, Iterations: 8})
+	codes := make([]uint8, count*m)
+	q.Encode(nil, data, count, codes)
+	fs := q.NewFastScanCodes(codes, count)
+
+	const nq = 8
+	queries := clustered(rng, nq, dims)
+	pool := workerpool.New(4)
+	defer pool.Close()
+	batch := fs.SearchBatch(pool, queries, k)
+
+	table := make([]float32, q.TableSize())
+	dist := make([]float32, count)
+	for qi := range nq {
+		query := queries[qi*dims : (qi+1)*dims]
+		q.DistanceTable(query, table)
+		q.ADC(table, codes, count, dist)
+		order := make([]int, count)
+		for i := range order {
+			order[i] = i
+		}
+		slices.SortStableFunc(order, func(a, b int) int {
+			switch {
+			case dist[a] < dist[b]:
+				return -1
+			case dist[a] > dist[b]:
+				return 1
+			}
+			return 0
+		})
+
+		got := fs.Search(query, k)
+		if !slices.Equal(got, batch[qi]) {
+			t.Fatalf("query %d: Search and SearchBatch differ", qi)
+		}
+		for r := range k {
+			if got[r].ID != int64(order[r]) || got[r].Dist != dist[order[r]] {
+				t.Fatalf("query %d rank %d: got %+v, want {%d %v}", qi, r, got[r], order[r], dist[order[r]])
+			}
+		}
+	}
+}
+
+func BenchmarkFastScan(b *testing.B) {
+	const count = 1 << 16
+	for _, m := range []int{16, 32, 64} {
+		rng := rand.New(rand.NewPCG(1, 1))
+		codes := make([]uint8, count*m)
+		for i := range codes {
+			codes[i] = uint8(rng.IntN(16))
+		}
+		lut := make([]uint8, 16*m)
+		for i := range lut {
+			lut[i] = uint8(rng.IntN(LUTMax + 1))
+		}
+		packed := make([]uint8, PackedSize(count, m))
+		PackCodes(codes, count, m, packed)
+		out := make([]uint16, count)
+		table := make([]float32, 16*m)
+		for i := range table {
+			table[i] = rng.Float32()
+		}
+		dist := make([]float32, count)
+		q := &Quantizer{m: m, ksub: 16}
+
+		b.Run("Scan/m="+strconv.Itoa(m), func(b *testing.B) {
+			b.SetBytes(count)
+			for i := 0; i < b.N; i++ {
+				Scan(packed, lut, m, count, out)
+			}
+		})
+		b.Run("ADC/m="+strconv.Itoa(m), func(b *testing.B) {
+			b.SetBytes(count)
+			for i := 0; i < b.N; i++ {
+				q.ADC(table, codes, count, dist)
+			}
+		})
+	}
+}
@@ -48,6 +48,26 @@
 //	packed := make([]uint8, len(floats))
 //	quantize.QuantizeFloat32(floats, packed, -1.0, 2.0/255.0)
 //
+// # Scalar Quantization (SQ8 / SQ4)
+//
+// ScalarQuantizer stores embeddings with 8 or 4 bits per dimension, over a
+// per-vector range (NewScalarQuantizer) or per-dimension ranges learned from
+// training data (TrainScalarQuantizer). Encode writes the codes and a small
+// ScalarFactors record per vector:
+//
+//	q := quantize.NewScalarQuantizer(dims, 8)
+//	codes := make([]uint8, count*q.CodeSize())
+//	factors := make([]quantize.ScalarFactors, count)
+//	q.Encode(pool, data, count, codes, factors)
+//
+// Distances are asymmetric: the float32 query is prepared once by NewQuery,
+// which folds in the per-dimension scales, quantizes it to uint8 and keeps
+// the query-side corrections, so each code is scored with one integer dot
+// product (vec.DotIntUint8) and a few multiply-adds:
+//
+//	sq := q.NewQuery(query)
+//	sq.ParallelBatchL2SquaredDistance(pool, codes, factors, dist, count)
+//
 // # Build Requirements
 //
 // The SIMD implementations require:
@@ -15,6 +15,18 @@ var QuantizeFloat32 func(input []float32, output []uint8, min float32, scale flo
 
 func init() {
 	initQuantizeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "quantize",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DequantizeUint8", Vars: []any{&DequantizeUint8}},
+			{Name: "QuantizeFloat32", Vars: []any{&QuantizeFloat32}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initQuantizeAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initQuantizeAVX2},
+			{Name: "fallback", Supported: true, Init: initQuantizeFallback},
+		},
+	})
 }
 
 func initQuantizeAll() {
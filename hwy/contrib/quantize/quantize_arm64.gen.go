@@ -13,6 +13,17 @@ var QuantizeFloat32 func(input []float32, output []uint8, min float32, scale flo
 
 func init() {
 	initQuantizeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "quantize",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DequantizeUint8", Vars: []any{&DequantizeUint8}},
+			{Name: "QuantizeFloat32", Vars: []any{&QuantizeFloat32}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initQuantizeNEONAsm},
+			{Name: "fallback", Supported: true, Init: initQuantizeFallback},
+		},
+	})
 }
 
 func initQuantizeAll() {
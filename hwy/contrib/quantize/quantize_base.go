@@ -36,7 +36,9 @@ func BaseDequantizeUint8(input []uint8, output []float32, min, scale float32) {
 	minVec := hwy.Set[float32](min)
 	scaleVec := hwy.Set[float32](scale)
 
-	buf := make([]float32, lanes)
+	// A vector has at most 16 float32 lanes; the constant capacity keeps
+	// buf on the stack.
+	buf := make([]float32, lanes, 16)
 
 	i := 0
 	for ; i+lanes <= n; i += lanes {
@@ -75,7 +77,9 @@ func BaseQuantizeFloat32(input []float32, output []uint8, min, scale float32) {
 	zeroVec := hwy.Zero[float32]()
 	max255Vec := hwy.Set[float32](255.0)
 
-	buf := make([]float32, lanes)
+	// A vector has at most 16 float32 lanes; the constant capacity keeps
+	// buf on the stack.
+	buf := make([]float32, lanes, 16)
 
 	i := 0
 	for ; i+lanes <= n; i += lanes {
@@ -16,7 +16,7 @@ func BaseDequantizeUint8_fallback(input []uint8, output []float32, min float32,
 	}
 	minVec := float32(min)
 	scaleVec := float32(scale)
-	buf := make([]float32, 1)
+	buf := make([]float32, 1, 16)
 	i := 0
 	for ; i < n; i++ {
 		for j := range 1 {
@@ -44,7 +44,7 @@ func BaseQuantizeFloat32_fallback(input []float32, output []uint8, min float32,
 	invScaleVec := hwy.Set[float32](1.0 / scale)
 	zeroVec := hwy.Zero[float32]()
 	max255Vec := hwy.Set[float32](255.0)
-	buf := make([]float32, lanes)
+	buf := make([]float32, lanes, 16)
 	i := 0
 	for ; i+lanes <= n; i += lanes {
 		v := hwy.Load(input[i:])
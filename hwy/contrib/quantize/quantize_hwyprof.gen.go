@@ -0,0 +1,30 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package quantize
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("quantize", "DequantizeUint8", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DequantizeUint8; hwyImpl != nil {
+			DequantizeUint8 = func(input []uint8, output []float32, min float32, scale float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, min, scale)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+	hwy.ProfileDispatch("quantize", "QuantizeFloat32", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := QuantizeFloat32; hwyImpl != nil {
+			QuantizeFloat32 = func(input []float32, output []uint8, min float32, scale float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(input, output, min, scale)
+				hwyCounter.Done(hwyStart, len(input), hwy.SliceBytes(input)+hwy.SliceBytes(output))
+			}
+		}
+	})
+}
@@ -4,11 +4,25 @@
 
 package quantize
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var DequantizeUint8 func(input []uint8, output []float32, min float32, scale float32)
 var QuantizeFloat32 func(input []float32, output []uint8, min float32, scale float32)
 
 func init() {
 	initQuantizeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "quantize",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DequantizeUint8", Vars: []any{&DequantizeUint8}},
+			{Name: "QuantizeFloat32", Vars: []any{&QuantizeFloat32}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initQuantizeFallback},
+		},
+	})
 }
 
 func initQuantizeAll() {
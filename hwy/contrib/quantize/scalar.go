@@ -0,0 +1,385 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package quantize
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/vec"
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// RangeMode selects where a ScalarQuantizer takes its value ranges from.
+type RangeMode int
+
+const (
+	// PerVector quantizes each vector over its own [min, max] range.
+	PerVector RangeMode = iota
+	// PerDimension quantizes each dimension over a [min, max] range learned
+	// from training data by TrainScalarQuantizer.
+	PerDimension
+)
+
+const (
+	// MinParallelEncode is the minimum vector count before Encode splits
+	// work across the pool.
+	MinParallelEncode = 256
+
+	// MinParallelScalarOps is the minimum count*dims before the parallel
+	// batch distance methods of ScalarQuery split work across the pool.
+	MinParallelScalarOps = 1 << 16
+
+	// scalarChunk is the number of 4-bit codes unpacked at a time before
+	// the integer dot product; the buffer lives on the stack.
+	scalarChunk = 1024
+)
+
+// ScalarFactors holds the per-vector constants of a scalar-quantized vector,
+// written by Encode alongside its codes.
+type ScalarFactors struct {
+	// Lo and Scale map codes back to values, v = Lo + Scale*code, in
+	// PerVector mode. PerDimension vectors have Lo = 0 and Scale = 1.
+	Lo, Scale float32
+	// NormSq is the squared norm of the reconstructed vector.
+	NormSq float32
+	// CodeSum is the sum of the vector's codes.
+	CodeSum int32
+}
+
+// ScalarQuantizer encodes float32 vectors as 8-bit (SQ8) or 4-bit (SQ4)
+// codes per dimension. SQ8 stores one byte per dimension, code^0x80 so that
+// the byte reads as the int8 code−128; SQ4 packs two dimensions per byte,
+// dimension 2j in the low nibble of byte j.
+type ScalarQuantizer struct {
+	dims, bits int
+	mode       RangeMode
+	lo, scale  []float32 // per-dimension ranges (PerDimension only)
+}
+
+// NewScalarQuantizer returns a PerVector quantizer for dims-dimensional
+// vectors with 4 or 8 bits per dimension. It needs no training.
+func NewScalarQuantizer(dims, bits int) *ScalarQuantizer {
+	checkScalar(dims, bits)
+	return &ScalarQuantizer{dims: dims, bits: bits, mode: PerVector}
+}
+
+// TrainScalarQuantizer returns a PerDimension quantizer whose per-dimension
+// ranges are the minimum and maximum of each dimension over count training
+// vectors in data. Values outside the trained range are clamped on encode.
+func TrainScalarQuantizer(data []float32, count, dims, bits int) *ScalarQuantizer {
+	checkScalar(dims, bits)
+	if count <= 0 {
+		panic("quantize: training needs at least one vector")
+	}
+	lo := make([]float32, dims)
+	hi := make([]float32, dims)
+	copy(lo, data[:dims])
+	copy(hi, data[:dims])
+	for i := 1; i < count; i++ {
+		v := data[i*dims : (i+1)*dims]
+		for d, x := range v {
+			lo[d] = min(lo[d], x)
+			hi[d] = max(hi[d], x)
+		}
+	}
+	levels := float32(levelsFor(bits))
+	scale := make([]float32, dims)
+	for d := range scale {
+		scale[d] = rangeScale(lo[d], hi[d], levels)
+	}
+	return &ScalarQuantizer{dims: dims, bits: bits, mode: PerDimension, lo: lo, scale: scale}
+}
+
+func checkScalar(dims, bits int) {
+	if dims <= 0 {
+		panic("quantize: dims must be positive")
+	}
+	if bits != 4 && bits != 8 {
+		panic("quantize: bits must be 4 or 8")
+	}
+}
+
+func levelsFor(bits int) int { return 1<<bits - 1 }
+
+// rangeScale returns the code step for [lo, hi], using 1 for an empty range
+// so that every value encodes to code 0.
+func rangeScale(lo, hi, levels float32) float32 {
+	if hi > lo {
+		return (hi - lo) / levels
+	}
+	return 1
+}
+
+// Dims returns the vector dimensionality.
+func (q *ScalarQuantizer) Dims() int { return q.dims }
+
+// Bits returns the number of bits per dimension, 4 or 8.
+func (q *ScalarQuantizer) Bits() int { return q.bits }
+
+// Mode returns the quantizer's RangeMode.
+func (q *ScalarQuantizer) Mode() RangeMode { return q.mode }
+
+// CodeSize returns the number of bytes per encoded vector.
+func (q *ScalarQuantizer) CodeSize() int {
+	if q.bits == 4 {
+		return (q.dims + 1) / 2
+	}
+	return q.dims
+}
+
+// Encode quantizes count vectors, writing CodeSize() bytes per vector to
+// codes and one ScalarFactors per vector to factors. Work is split across
+// pool for at least MinParallelEncode vectors; pool may be nil.
+func (q *ScalarQuantizer) Encode(pool workerpool.Executor, vectors []float32, count int, codes []uint8, factors []ScalarFactors) {
+	encode := func(start, end int) {
+		norm := make([]float32, q.dims)
+		unpacked := make([]uint8, q.dims)
+		recon := make([]float32, q.dims)
+		for i := start; i < end; i++ {
+			q.encodeOne(vectors[i*q.dims:(i+1)*q.dims], codes[i*q.CodeSize():(i+1)*q.CodeSize()], &factors[i], norm, unpacked, recon)
+		}
+	}
+	if pool == nil || count < MinParallelEncode {
+		encode(0, count)
+		return
+	}
+	pool.ParallelForAtomicBatched(count, 64, encode)
+}
+
+func (q *ScalarQuantizer) encodeOne(v []float32, code []uint8, f *ScalarFactors, norm []float32, unpacked []uint8, recon []float32) {
+	levels := levelsFor(q.bits)
+	if q.mode == PerVector {
+		lo, hi := vec.MinMax(v)
+		f.Lo, f.Scale = lo, rangeScale(lo, hi, float32(levels))
+		QuantizeFloat32(v, unpacked, f.Lo, f.Scale)
+	} else {
+		f.Lo, f.Scale = 0, 1
+		vec.SubTo(norm, v, q.lo)
+		vec.Div(norm, q.scale)
+		QuantizeFloat32(norm, unpacked, 0, 1)
+	}
+
+	var sum int32
+	for d, c := range unpacked {
+		c = min(c, uint8(levels))
+		unpacked[d] = c
+		sum += int32(c)
+	}
+	f.CodeSum = sum
+
+	q.decodeUnpacked(unpacked, *f, recon)
+	f.NormSq = vec.SquaredNorm(recon)
+
+	if q.bits == 8 {
+		for d, c := range unpacked {
+			code[d] = c ^ 0x80
+		}
+		return
+	}
+	packNibbles(unpacked, code)
+}
+
+// Decode reconstructs one encoded vector into dst (Dims() values).
+func (q *ScalarQuantizer) Decode(code []uint8, f ScalarFactors, dst []float32) {
+	unpacked := make([]uint8, q.dims)
+	if q.bits == 8 {
+		for d, c := range code[:q.dims] {
+			unpacked[d] = c ^ 0x80
+		}
+	} else {
+		unpackNibbles(code, unpacked)
+	}
+	q.decodeUnpacked(unpacked, f, dst)
+}
+
+func (q *ScalarQuantizer) decodeUnpacked(codes []uint8, f ScalarFactors, dst []float32) {
+	if q.mode == PerVector {
+		DequantizeUint8(codes, dst[:q.dims], f.Lo, f.Scale)
+		return
+	}
+	DequantizeUint8(codes, dst[:q.dims], 0, 1)
+	vec.Mul(dst[:q.dims], q.scale)
+	vec.Add(dst[:q.dims], q.lo)
+}
+
+// packNibbles packs 4-bit codes two per byte, code 2j in the low nibble of
+// byte j.
+func packNibbles(codes, dst []uint8) {
+	n := len(codes)
+	j := 0
+	for ; 2*j+1 < n; j++ {
+		dst[j] = codes[2*j] | codes[2*j+1]<<4
+	}
+	if n%2 != 0 {
+		dst[j] = codes[n-1]
+	}
+}
+
+// unpackNibbles expands len(dst) 4-bit codes packed by packNibbles.
+func unpackNibbles(src, dst []uint8) {
+	n := len(dst)
+	j := 0
+	for ; 2*j+1 < n; j++ {
+		b := src[j]
+		dst[2*j] = b & 0x0f
+		dst[2*j+1] = b >> 4
+	}
+	if n%2 != 0 {
+		dst[n-1] = src[j] & 0x0f
+	}
+}
+
+// ScalarQuery is a float32 query prepared for asymmetric distances to
+// vectors encoded by a ScalarQuantizer.
+//
+// The query is folded with the per-dimension scales and quantized to 8 bits
+// once, so scoring a code is a single int8 integer dot product
+// (vec.DotIntInt8, SDOT on ARM) plus a few per-vector corrections:
+//
+//	Σ w_d·c_d ≈ wLo·CodeSum + wScale·Σ u_d·c_d
+//	<q, v>   ≈ offset + Lo·Σq + Scale·Σ w_d·c_d
+//	‖q − v‖² = ‖q‖² − 2<q, v> + NormSq
+//
+// where w is the query (PerVector) or the query times the per-dimension
+// scales (PerDimension), u its 8-bit codes, and offset = Σ q_d·lo_d for
+// PerDimension quantizers. The query codes, and SQ8 data codes, are kept
+// offset by 128 so they fit int8; the offsets fold into the same
+// corrections.
+type ScalarQuery struct {
+	q     *ScalarQuantizer
+	codes []int8 // u - 128
+
+	// Σ w_d·c_d = codeSumCoef·CodeSum + constant + wScale·Σ codes·stored.
+	codeSumCoef, constant, wScale float64
+
+	offset, sum, normSq float64
+}
+
+// NewQuery prepares query (Dims() values) for asymmetric distances.
+func (q *ScalarQuantizer) NewQuery(query []float32) *ScalarQuery {
+	query = query[:q.dims]
+	w := query
+	sq := &ScalarQuery{q: q}
+	if q.mode == PerDimension {
+		w = make([]float32, q.dims)
+		vec.MulTo(w, query, q.scale)
+		sq.offset = float64(vec.Dot(query, q.lo))
+	}
+	lo, hi := vec.MinMax(w)
+	wScale := rangeScale(lo, hi, 255)
+	u := make([]uint8, q.dims)
+	QuantizeFloat32(w, u, lo, wScale)
+	var tSum int64
+	for d, c := range u {
+		u[d] = c ^ 0x80
+		tSum += int64(c) - 128
+	}
+	sq.codes = byteSliceAsInt8(u)
+
+	// Σ u·c = Σ t·s + 128·CodeSum (+ 128·Σt for SQ8), with t = u−128 and
+	// s = c−128 (SQ8) or c (SQ4).
+	sq.wScale = float64(wScale)
+	sq.codeSumCoef = float64(lo) + 128*sq.wScale
+	if q.bits == 8 {
+		sq.constant = 128 * sq.wScale * float64(tSum)
+	}
+	sq.sum = float64(vec.Sum(query))
+	sq.normSq = float64(vec.SquaredNorm(query))
+	return sq
+}
+
+// byteSliceAsInt8 reinterprets a []byte as []int8 with the same backing array.
+func byteSliceAsInt8(b []byte) []int8 {
+	return unsafe.Slice((*int8)(unsafe.Pointer(unsafe.SliceData(b))), len(b))
+}
+
+// codeDot returns the int8 dot product of the query codes with one code.
+func (sq *ScalarQuery) codeDot(code []uint8) int32 {
+	dims := sq.q.dims
+	if sq.q.bits == 8 {
+		return vec.DotIntInt8(sq.codes, byteSliceAsInt8(code[:dims]))
+	}
+	var buf [scalarChunk]uint8
+	var acc int32
+	for start := 0; start < dims; start += scalarChunk {
+		n := min(scalarChunk, dims-start)
+		unpackNibbles(code[start/2:], buf[:n])
+		acc += vec.DotIntInt8(sq.codes[start:start+n], byteSliceAsInt8(buf[:n]))
+	}
+	return acc
+}
+
+func (sq *ScalarQuery) dot(code []uint8, f ScalarFactors) float64 {
+	wc := sq.codeSumCoef*float64(f.CodeSum) + sq.constant + sq.wScale*float64(sq.codeDot(code))
+	return sq.offset + float64(f.Lo)*sq.sum + float64(f.Scale)*wc
+}
+
+func (sq *ScalarQuery) l2(code []uint8, f ScalarFactors) float32 {
+	return float32(max(0, sq.normSq-2*sq.dot(code, f)+float64(f.NormSq)))
+}
+
+// Dot returns the approximate dot product of the query with one encoded
+// vector.
+func (sq *ScalarQuery) Dot(code []uint8, f ScalarFactors) float32 {
+	return float32(sq.dot(code, f))
+}
+
+// L2SquaredDistance returns the approximate squared Euclidean distance from
+// the query to one encoded vector.
+func (sq *ScalarQuery) L2SquaredDistance(code []uint8, f ScalarFactors) float32 {
+	return sq.l2(code, f)
+}
+
+// BatchDot computes the dot products of the query with count encoded
+// vectors (CodeSize() bytes each in codes), writing them to dots.
+func (sq *ScalarQuery) BatchDot(codes []uint8, factors []ScalarFactors, dots []float32, count int) {
+	size := sq.q.CodeSize()
+	for i := range count {
+		dots[i] = float32(sq.dot(codes[i*size:(i+1)*size], factors[i]))
+	}
+}
+
+// BatchL2SquaredDistance computes the squared distances from the query to
+// count encoded vectors, writing them to dist.
+func (sq *ScalarQuery) BatchL2SquaredDistance(codes []uint8, factors []ScalarFactors, dist []float32, count int) {
+	size := sq.q.CodeSize()
+	for i := range count {
+		dist[i] = sq.l2(codes[i*size:(i+1)*size], factors[i])
+	}
+}
+
+// ParallelBatchDot is BatchDot with the encoded vectors split across pool
+// once count*Dims() reaches MinParallelScalarOps. pool may be nil.
+func (sq *ScalarQuery) ParallelBatchDot(pool workerpool.Executor, codes []uint8, factors []ScalarFactors, dots []float32, count int) {
+	sq.parallel(pool, codes, factors, dots, count, sq.BatchDot)
+}
+
+// ParallelBatchL2SquaredDistance is BatchL2SquaredDistance with the encoded
+// vectors split across pool (see ParallelBatchDot).
+func (sq *ScalarQuery) ParallelBatchL2SquaredDistance(pool workerpool.Executor, codes []uint8, factors []ScalarFactors, dist []float32, count int) {
+	sq.parallel(pool, codes, factors, dist, count, sq.BatchL2SquaredDistance)
+}
+
+func (sq *ScalarQuery) parallel(pool workerpool.Executor, codes []uint8, factors []ScalarFactors, out []float32, count int,
+	batch func(codes []uint8, factors []ScalarFactors, out []float32, count int)) {
+	if pool == nil || count*sq.q.dims < MinParallelScalarOps {
+		batch(codes, factors, out, count)
+		return
+	}
+	size := sq.q.CodeSize()
+	pool.ParallelForAtomicBatched(count, 64, func(start, end int) {
+		batch(codes[start*size:end*size], factors[start:end], out[start:end], end-start)
+	})
+}
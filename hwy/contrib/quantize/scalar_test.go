@@ -0,0 +1,222 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package quantize
+
+import (
+	"fmt"
+	"math"
+	"math/rand"
+	"sort"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+func randomVectors(rng *rand.Rand, count, dims int) []float32 {
+	data := make([]float32, count*dims)
+	for i := range data {
+		// Per-dimension offsets and spreads exercise PerDimension ranges.
+		d := i % dims
+		data[i] = float32(d%7) - 3 + float32(rng.NormFloat64())*float32(1+d%3)
+	}
+	return data
+}
+
+func scalarQuantizers(data []float32, count, dims int) map[string]*ScalarQuantizer {
+	return map[string]*ScalarQuantizer{
+		"SQ8/PerVector":    NewScalarQuantizer(dims, 8),
+		"SQ4/PerVector":    NewScalarQuantizer(dims, 4),
+		"SQ8/PerDimension": TrainScalarQuantizer(data, count, dims, 8),
+		"SQ4/PerDimension": TrainScalarQuantizer(data, count, dims, 4),
+	}
+}
+
+func TestScalarRoundTrip(t *testing.T) {
+	rng := rand.New(rand.NewSource(1))
+	for _, dims := range []int{1, 7, 64, 129, 1500} {
+		const count = 50
+		data := randomVectors(rng, count, dims)
+		for name, q := range scalarQuantizers(data, count, dims) {
+			codes := make([]uint8, count*q.CodeSize())
+			factors := make([]ScalarFactors, count)
+			q.Encode(nil, data, count, codes, factors)
+			got := make([]float32, dims)
+			for i := range count {
+				code := codes[i*q.CodeSize() : (i+1)*q.CodeSize()]
+				q.Decode(code, factors[i], got)
+				var normSq float32
+				for d := range dims {
+					step := factors[i].Scale
+					if q.Mode() == PerDimension {
+						step = q.scale[d]
+					}
+					if diff := math.Abs(float64(got[d] - data[i*dims+d])); diff > float64(step)*0.51 {
+						t.Fatalf("%s dims=%d vector %d dim %d: decoded %v, want %v (step %v)", name, dims, i, d, got[d], data[i*dims+d], step)
+					}
+					normSq += got[d] * got[d]
+				}
+				if math.Abs(float64(normSq-factors[i].NormSq)) > 1e-3*float64(normSq)+1e-4 {
+					t.Fatalf("%s dims=%d vector %d: NormSq %v, want %v", name, dims, i, factors[i].NormSq, normSq)
+				}
+			}
+		}
+	}
+}
+
+func TestScalarQueryDistances(t *testing.T) {
+	rng := rand.New(rand.NewSource(2))
+	pool := workerpool.New(4)
+	defer pool.Close()
+	for _, dims := range []int{3, 64, 129, 1500} {
+		const count = 300
+		data := randomVectors(rng, count, dims)
+		query := randomVectors(rng, 1, dims)
+		for name, q := range scalarQuantizers(data, count, dims) {
+			size := q.CodeSize()
+			codes := make([]uint8, count*size)
+			factors := make([]ScalarFactors, count)
+			q.Encode(pool, data, count, codes, factors)
+			sq := q.NewQuery(query)
+
+			dist := make([]float32, count)
+			dots := make([]float32, count)
+			pdist := make([]float32, count)
+			pdots := make([]float32, count)
+			sq.BatchL2SquaredDistance(codes, factors, dist, count)
+			sq.BatchDot(codes, factors, dots, count)
+			sq.ParallelBatchL2SquaredDistance(pool, codes, factors, pdist, count)
+			sq.ParallelBatchDot(pool, codes, factors, pdots, count)
+
+			recon := make([]float32, dims)
+			for i := range count {
+				code := codes[i*size : (i+1)*size]
+				q.Decode(code, factors[i], recon)
+				var wantDot, wantDist, qNorm float64
+				for d := range dims {
+					wantDot += float64(query[d]) * float64(recon[d])
+					diff := float64(query[d] - recon[d])
+					wantDist += diff * diff
+					qNorm += float64(query[d]) * float64(query[d])
+				}
+				// The query is quantized to 8 bits, so allow for its step.
+				tol := 0.02*math.Sqrt(qNorm*float64(factors[i].NormSq)) + 1e-3
+				if math.Abs(float64(dots[i])-wantDot) > tol {
+					t.Fatalf("%s dims=%d vector %d: dot %v, want %v", name, dims, i, dots[i], wantDot)
+				}
+				if math.Abs(float64(dist[i])-wantDist) > 2*tol {
+					t.Fatalf("%s dims=%d vector %d: distance %v, want %v", name, dims, i, dist[i], wantDist)
+				}
+				if sq.Dot(code, factors[i]) != dots[i] || sq.L2SquaredDistance(code, factors[i]) != dist[i] {
+					t.Fatalf("%s dims=%d vector %d: single-vector result differs from batch", name, dims, i)
+				}
+				if pdots[i] != dots[i] || pdist[i] != dist[i] {
+					t.Fatalf("%s dims=%d vector %d: parallel result differs from batch", name, dims, i)
+				}
+			}
+		}
+	}
+}
+
+func TestScalarRecall(t *testing.T) {
+	const count, dims, queries, k = 2000, 96, 20, 10
+	rng := rand.New(rand.NewSource(3))
+	data := randomVectors(rng, count, dims)
+	minRecall := map[string]float64{
+		"SQ8/PerVector": 0.9, "SQ8/PerDimension": 0.9,
+		"SQ4/PerVector": 0.6, "SQ4/PerDimension": 0.6,
+	}
+	for name, q := range scalarQuantizers(data, count, dims) {
+		codes := make([]uint8, count*q.CodeSize())
+		factors := make([]ScalarFactors, count)
+		q.Encode(nil, data, count, codes, factors)
+		dist := make([]float32, count)
+		exact := make([]float32, count)
+		hits := 0
+		for range queries {
+			query := randomVectors(rng, 1, dims)
+			q.NewQuery(query).BatchL2SquaredDistance(codes, factors, dist, count)
+			for i := range count {
+				var s float32
+				for d := range dims {
+					diff := query[d] - data[i*dims+d]
+					s += diff * diff
+				}
+				exact[i] = s
+			}
+			truth := topIDs(exact, k)
+			for id := range topIDs(dist, k) {
+				if truth[id] {
+					hits++
+				}
+			}
+		}
+		recall := float64(hits) / (queries * k)
+		if recall < minRecall[name] {
+			t.Errorf("%s: recall@%d = %.2f, want >= %.2f", name, k, recall, minRecall[name])
+		}
+	}
+}
+
+func topIDs(dist []float32, k int) map[int]bool {
+	ids := make([]int, len(dist))
+	for i := range ids {
+		ids[i] = i
+	}
+	sort.Slice(ids, func(a, b int) bool { return dist[ids[a]] < dist[ids[b]] })
+	top := make(map[int]bool, k)
+	for _, id := range ids[:k] {
+		top[id] = true
+	}
+	return top
+}
+
+func TestScalarConstantVector(t *testing.T) {
+	q := NewScalarQuantizer(5, 4)
+	v := []float32{2, 2, 2, 2, 2}
+	codes := make([]uint8, q.CodeSize())
+	factors := make([]ScalarFactors, 1)
+	q.Encode(nil, v, 1, codes, factors)
+	got := make([]float32, 5)
+	q.Decode(codes, factors[0], got)
+	for d := range got {
+		if got[d] != 2 {
+			t.Fatalf("decoded %v, want all 2", got)
+		}
+	}
+	if d := q.NewQuery(v).L2SquaredDistance(codes, factors[0]); d > 1e-4 {
+		t.Errorf("distance to itself = %v, want 0", d)
+	}
+}
+
+func BenchmarkScalarQuery(b *testing.B) {
+	const count, dims = 10000, 768
+	rng := rand.New(rand.NewSource(1))
+	data := randomVectors(rng, count, dims)
+	query := randomVectors(rng, 1, dims)
+	dist := make([]float32, count)
+	for _, bits := range []int{8, 4} {
+		q := NewScalarQuantizer(dims, bits)
+		codes := make([]uint8, count*q.CodeSize())
+		factors := make([]ScalarFactors, count)
+		q.Encode(nil, data, count, codes, factors)
+		sq := q.NewQuery(query)
+		b.Run(fmt.Sprintf("SQ%d", bits), func(b *testing.B) {
+			b.SetBytes(int64(len(codes)))
+			for i := 0; i < b.N; i++ {
+				sq.BatchL2SquaredDistance(codes, factors, dist, count)
+			}
+		})
+	}
+}
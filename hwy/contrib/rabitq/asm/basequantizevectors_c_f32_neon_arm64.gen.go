@@ -1,14 +0,0 @@
-//go:build !noasm && arm64
-// Code generated by GoAT. DO NOT EDIT.
-// versions:
-// 	clang   22.1.1
-// 	objdump 2.46.0.20260210
-// flags: -march=armv8-a+simd+fp -fno-builtin-memset -O3
-// source: /Users/ajroetker/go/src/github.com/ajroetker/go-highway/hwy/contrib/rabitq/asm/basequantizevectors_c_f32_neon_arm64.c
-
-package asm
-
-import "unsafe"
-
-//go:noescape
-func quantizevectors_c_f32_neon(unitVectors, codes, dotProducts, codeCounts, psqrtDimsInv, pcount, pdims, pwidth, plen_unitVectors, plen_codes, plen_dotProducts, plen_codeCounts unsafe.Pointer)
@@ -1,223 +0,0 @@
-//go:build !noasm && arm64
-// Code generated by GoAT. DO NOT EDIT.
-// versions:
-// 	clang   22.1.1
-// 	objdump 2.46.0.20260210
-// flags: -march=armv8-a+simd+fp -fno-builtin-memset -O3
-// source: /Users/ajroetker/go/src/github.com/ajroetker/go-highway/hwy/contrib/rabitq/asm/basequantizevectors_c_f32_neon_arm64.c
-
-TEXT ·quantizevectors_c_f32_neon(SB), $48-96
-	MOVD unitVectors+0(FP), R0
-	MOVD codes+8(FP), R1
-	MOVD dotProducts+16(FP), R2
-	MOVD codeCounts+24(FP), R3
-	MOVD psqrtDimsInv+32(FP), R4
-	MOVD pcount+40(FP), R5
-	MOVD pdims+48(FP), R6
-	MOVD pwidth+56(FP), R7
-	MOVD plen_unitVectors+64(FP), R8
-	MOVD R8, 16(RSP)
-	MOVD plen_codes+72(FP), R8
-	MOVD R8, 24(RSP)
-	MOVD plen_dotProducts+80(FP), R8
-	MOVD R8, 32(RSP)
-	MOVD plen_codeCounts+88(FP), R8
-	MOVD R8, 40(RSP)
-	WORD $0xf94000a8                 // ldr	x8, [x5]
-	WORD $0xf100051f                 // cmp	x8, #1
-	BLT  BB0_24
-	WORD $0xd2800009                 // mov	x9, #0                          ; =0x0
-	WORD $0xf94000ca                 // ldr	x10, [x6]
-	WORD $0xbd400080                 // ldr	s0, [x4]
-	WORD $0xf94000eb                 // ldr	x11, [x7]
-	WORD $0x1e214001                 // fneg	s1, s0
-	WORD $0x4e040422                 // dup.4s	v2, v1[0]
-	WORD $0x4e040403                 // dup.4s	v3, v0[0]
-	WORD $0xd37ef54c                 // lsl	x12, x10, #2
-	WORD $0x1e2e1004                 // fmov	s4, #1.00000000
-	B    BB0_3
-
-BB0_2:
-	WORD $0x1e6240a5 // fcvt	s5, d5
-	WORD $0x1e251885 // fdiv	s5, s4, s5
-	WORD $0xbc297845 // str	s5, [x2, x9, lsl #2]
-	WORD $0x91000529 // add	x9, x9, #1
-	WORD $0x8b0c0000 // add	x0, x0, x12
-	WORD $0xeb08013f // cmp	x9, x8
-	BEQ  BB0_23
-
-BB0_3:
-	WORD $0x9b0b7d2d // mul	x13, x9, x11
-	WORD $0x8b0d0c2e // add	x14, x1, x13, lsl #3
-	WORD $0xf100115f // cmp	x10, #4
-	BGE  BB0_13
-	WORD $0xd2800006 // mov	x6, #0                          ; =0x0
-	WORD $0xd2800004 // mov	x4, #0                          ; =0x0
-	WORD $0xd280000f // mov	x15, #0                         ; =0x0
-	WORD $0x5280000d // mov	w13, #0                         ; =0x0
-	WORD $0xd2800005 // mov	x5, #0                          ; =0x0
-	WORD $0x6f00e405 // movi.2d	v5, #0000000000000000
-
-BB0_5:
-	WORD $0xeb0a00df // cmp	x6, x10
-	BLT  BB0_11
-
-BB0_6:
-	WORD $0xf100049f // cmp	x4, #1
-	BLT  BB0_8
-	WORD $0xcb0403f0 // neg	x16, x4
-	WORD $0x9ad020b0 // lsl	x16, x5, x16
-	WORD $0xf82f79d0 // str	x16, [x14, x15, lsl #3]
-	WORD $0x9e670206 // fmov	d6, x16
-	WORD $0x0e2058c6 // cnt.8b	v6, v6
-	WORD $0x0e31b8c6 // addv.8b	b6, v6
-	WORD $0x1e2600ce // fmov	w14, s6
-	WORD $0x0b0e01ad // add	w13, w13, w14
-
-BB0_8:
-	WORD $0xb829786d // str	w13, [x3, x9, lsl #2]
-	WORD $0x1e6020a8 // fcmp	d5, #0.0
-	BNE  BB0_2
-	WORD $0x6f00e405 // movi.2d	v5, #0000000000000000
-	WORD $0xbc297845 // str	s5, [x2, x9, lsl #2]
-	WORD $0x91000529 // add	x9, x9, #1
-	WORD $0x8b0c0000 // add	x0, x0, x12
-	WORD $0xeb08013f // cmp	x9, x8
-	BNE  BB0_3
-	B    BB0_23
-
-BB0_10:
-	WORD $0x1e22c0c6 // fcvt	d6, s6
-	WORD $0x1e22c0e7 // fcvt	d7, s7
-	WORD $0x1f4714c5 // fmadd	d5, d6, d7, d5
-	WORD $0x910004c6 // add	x6, x6, #1
-	WORD $0xeb06015f // cmp	x10, x6
-	BEQ  BB0_6
-
-BB0_11:
-	WORD $0xbc667806 // ldr	s6, [x0, x6, lsl #2]
-	WORD $0x1e2600d0 // fmov	w16, s6
-	WORD $0x3100061f // cmn	w16, #1
-	WORD $0x1e21cc07 // fcsel	s7, s0, s1, gt
-	WORD $0x2a3003f0 // mvn	w16, w16
-	WORD $0x531f7e10 // lsr	w16, w16, #31
-	WORD $0xaa050605 // orr	x5, x16, x5, lsl #1
-	WORD $0x91000484 // add	x4, x4, #1
-	WORD $0xf101009f // cmp	x4, #64
-	BNE  BB0_10
-	WORD $0xd2800004 // mov	x4, #0                          ; =0x0
-	WORD $0xf82f79c5 // str	x5, [x14, x15, lsl #3]
-	WORD $0x9e6700b0 // fmov	d16, x5
-	WORD $0x0e205a10 // cnt.8b	v16, v16
-	WORD $0x0e31ba10 // addv.8b	b16, v16
-	WORD $0x1e260210 // fmov	w16, s16
-	WORD $0x0b1001ad // add	w13, w13, w16
-	WORD $0x910005ef // add	x15, x15, #1
-	WORD $0xd2800005 // mov	x5, #0                          ; =0x0
-	B    BB0_10
-
-BB0_13:
-	WORD $0xd2800010 // mov	x16, #0                         ; =0x0
-	WORD $0xd2800005 // mov	x5, #0                          ; =0x0
-	WORD $0x5280000d // mov	w13, #0                         ; =0x0
-	WORD $0xd280000f // mov	x15, #0                         ; =0x0
-	WORD $0xd2800004 // mov	x4, #0                          ; =0x0
-	WORD $0x6f00e405 // movi.2d	v5, #0000000000000000
-	WORD $0xaa0003f1 // mov	x17, x0
-	B    BB0_15
-
-BB0_14:
-	WORD $0x4ea0e8c7 // fcmlt.4s	v7, v6, #0.0
-	WORD $0x6e631c47 // bsl.16b	v7, v2, v3
-	WORD $0x6e27dcc6 // fmul.4s	v6, v6, v7
-	WORD $0x6e26d4c6 // faddp.4s	v6, v6, v6
-	WORD $0x7e30d8c6 // faddp.2s	s6, v6
-	WORD $0x1e22c0c6 // fcvt	d6, s6
-	WORD $0x1e6628a5 // fadd	d5, d5, d6
-	WORD $0x91001206 // add	x6, x16, #4
-	WORD $0x91002207 // add	x7, x16, #8
-	WORD $0xaa0603f0 // mov	x16, x6
-	WORD $0xeb0a00ff // cmp	x7, x10
-	BGT  BB0_5
-
-BB0_15:
-	WORD $0x3cc10626 // ldr	q6, [x17], #16
-	WORD $0x3d8003e6 // str	q6, [sp]
-	WORD $0xb94003e6 // ldr	w6, [sp]
-	WORD $0x2a2603e6 // mvn	w6, w6
-	WORD $0x531f7cc6 // lsr	w6, w6, #31
-	WORD $0xaa0504c5 // orr	x5, x6, x5, lsl #1
-	WORD $0x91000484 // add	x4, x4, #1
-	WORD $0xf101009f // cmp	x4, #64
-	BNE  BB0_17
-	WORD $0xd2800004 // mov	x4, #0                          ; =0x0
-	WORD $0xf82f79c5 // str	x5, [x14, x15, lsl #3]
-	WORD $0x9e6700a7 // fmov	d7, x5
-	WORD $0x0e2058e7 // cnt.8b	v7, v7
-	WORD $0x0e31b8e7 // addv.8b	b7, v7
-	WORD $0x1e2600e5 // fmov	w5, s7
-	WORD $0x0b0501ad // add	w13, w13, w5
-	WORD $0x910005ef // add	x15, x15, #1
-	WORD $0xd2800005 // mov	x5, #0                          ; =0x0
-
-BB0_17:
-	WORD $0x3d8003e6 // str	q6, [sp]
-	WORD $0xb94007e6 // ldr	w6, [sp, #4]
-	WORD $0x2a2603e6 // mvn	w6, w6
-	WORD $0x531f7cc6 // lsr	w6, w6, #31
-	WORD $0xaa0504c5 // orr	x5, x6, x5, lsl #1
-	WORD $0x91000484 // add	x4, x4, #1
-	WORD $0xf101009f // cmp	x4, #64
-	BNE  BB0_19
-	WORD $0xd2800004 // mov	x4, #0                          ; =0x0
-	WORD $0xf82f79c5 // str	x5, [x14, x15, lsl #3]
-	WORD $0x9e6700a7 // fmov	d7, x5
-	WORD $0x0e2058e7 // cnt.8b	v7, v7
-	WORD $0x0e31b8e7 // addv.8b	b7, v7
-	WORD $0x1e2600e5 // fmov	w5, s7
-	WORD $0x0b0501ad // add	w13, w13, w5
-	WORD $0x910005ef // add	x15, x15, #1
-	WORD $0xd2800005 // mov	x5, #0                          ; =0x0
-
-BB0_19:
-	WORD $0x3d8003e6 // str	q6, [sp]
-	WORD $0xb9400be6 // ldr	w6, [sp, #8]
-	WORD $0x2a2603e6 // mvn	w6, w6
-	WORD $0x531f7cc6 // lsr	w6, w6, #31
-	WORD $0xaa0504c5 // orr	x5, x6, x5, lsl #1
-	WORD $0x91000484 // add	x4, x4, #1
-	WORD $0xf101009f // cmp	x4, #64
-	BNE  BB0_21
-	WORD $0xd2800004 // mov	x4, #0                          ; =0x0
-	WORD $0xf82f79c5 // str	x5, [x14, x15, lsl #3]
-	WORD $0x9e6700a7 // fmov	d7, x5
-	WORD $0x0e2058e7 // cnt.8b	v7, v7
-	WORD $0x0e31b8e7 // addv.8b	b7, v7
-	WORD $0x1e2600e5 // fmov	w5, s7
-	WORD $0x0b0501ad // add	w13, w13, w5
-	WORD $0x910005ef // add	x15, x15, #1
-	WORD $0xd2800005 // mov	x5, #0                          ; =0x0
-
-BB0_21:
-	WORD $0x3d8003e6 // str	q6, [sp]
-	WORD $0xb9400fe6 // ldr	w6, [sp, #12]
-	WORD $0x2a2603e6 // mvn	w6, w6
-	WORD $0x531f7cc6 // lsr	w6, w6, #31
-	WORD $0xaa0504c5 // orr	x5, x6, x5, lsl #1
-	WORD $0x91000484 // add	x4, x4, #1
-	WORD $0xf101009f // cmp	x4, #64
-	BNE  BB0_14
-	WORD $0xd2800004 // mov	x4, #0                          ; =0x0
-	WORD $0xf82f79c5 // str	x5, [x14, x15, lsl #3]
-	WORD $0x9e6700a7 // fmov	d7, x5
-	WORD $0x0e2058e7 // cnt.8b	v7, v7
-	WORD $0x0e31b8e7 // addv.8b	b7, v7
-	WORD $0x1e2600e5 // fmov	w5, s7
-	WORD $0x0b0501ad // add	w13, w13, w5
-	WORD $0x910005ef // add	x15, x15, #1
-	WORD $0xd2800005 // mov	x5, #0                          ; =0x0
-	B    BB0_14
-
-BB0_23:
-BB0_24:
-	RET
@@ -10,8 +10,3 @@ import "unsafe"
 func BitProduct_U64(code unsafe.Pointer, q1 unsafe.Pointer, q2 unsafe.Pointer, q3 unsafe.Pointer, q4 unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
 	bitproduct_c_u64_neon(code, q1, q2, q3, q4, plen, pout_result)
 }
-
-// QuantizeVectors_F32 calls the NEON SIMD assembly implementation.
-func QuantizeVectors_F32(unitVectors unsafe.Pointer, codes unsafe.Pointer, dotProducts unsafe.Pointer, codeCounts unsafe.Pointer, psqrtDimsInv unsafe.Pointer, pcount unsafe.Pointer, pdims unsafe.Pointer, pwidth unsafe.Pointer, plen_unitVectors unsafe.Pointer, plen_codes unsafe.Pointer, plen_dotProducts unsafe.Pointer, plen_codeCounts unsafe.Pointer) {
-	quantizevectors_c_f32_neon(unitVectors, codes, dotProducts, codeCounts, psqrtDimsInv, pcount, pdims, pwidth, plen_unitVectors, plen_codes, plen_dotProducts, plen_codeCounts)
-}
@@ -45,45 +45,3 @@ func BitProductCU64(code, q1, q2, q3, q4 []uint64) uint32 {
 	)
 	return uint32(out_result)
 }
-
-// QuantizeVectorsCF32 computes QuantizeVectors using NEON SIMD assembly.
-func QuantizeVectorsCF32(unitVectors []float32, codes []uint64, dotProducts []float32, codeCounts []uint32, sqrtDimsInv float32, count, dims, width int) {
-	var p_unitVectors unsafe.Pointer
-	if len(unitVectors) > 0 {
-		p_unitVectors = unsafe.Pointer(&unitVectors[0])
-	}
-	var p_codes unsafe.Pointer
-	if len(codes) > 0 {
-		p_codes = unsafe.Pointer(&codes[0])
-	}
-	var p_dotProducts unsafe.Pointer
-	if len(dotProducts) > 0 {
-		p_dotProducts = unsafe.Pointer(&dotProducts[0])
-	}
-	var p_codeCounts unsafe.Pointer
-	if len(codeCounts) > 0 {
-		p_codeCounts = unsafe.Pointer(&codeCounts[0])
-	}
-	countVal := int64(count)
-	dimsVal := int64(dims)
-	widthVal := int64(width)
-	sqrtDimsInvVal := sqrtDimsInv
-	len_unitVectorsVal := int64(len(unitVectors))
-	len_codesVal := int64(len(codes))
-	len_dotProductsVal := int64(len(dotProducts))
-	len_codeCountsVal := int64(len(codeCounts))
-	quantizevectors_c_f32_neon(
-		p_unitVectors,
-		p_codes,
-		p_dotProducts,
-		p_codeCounts,
-		unsafe.Pointer(&sqrtDimsInvVal),
-		unsafe.Pointer(&countVal),
-		unsafe.Pointer(&dimsVal),
-		unsafe.Pointer(&widthVal),
-		unsafe.Pointer(&len_unitVectorsVal),
-		unsafe.Pointer(&len_codesVal),
-		unsafe.Pointer(&len_dotProductsVal),
-		unsafe.Pointer(&len_codeCountsVal),
-	)
-}
@@ -40,6 +40,36 @@
 //   - Computes dot products between unit vectors and their quantized form
 //   - Counts the number of 1-bits in each code
 //
+// Sign bits are packed a whole SIMD vector at a time from the comparison
+// mask. ParallelQuantizeVectors runs the same quantization over a
+// workerpool.Executor for large batches.
+//
+// # Extended Codes
+//
+// QuantizeVectorsExtended quantizes to 2-4 bits per dimension, trading code
+// size for accuracy. Codes are stored as bit planes compatible with
+// BitProduct; ExtendedBitProduct and EstimateExtendedDistances are the
+// multi-bit counterparts of BitProduct and EstimateDistances.
+//
+// # FastScan
+//
+// For scanning many candidates (e.g. an IVF list) codes are transposed into
+// blocks of 32 with PackFastScanCodes. A query is quantized to 4 bits per
+// dimension with QuantizeQuery and turned into a 16-entry table per group of
+// 4 dimensions with BuildFastScanLUT. FastScan then scores 16 codes per
+// byte-shuffle instruction and produces the same values as BitProduct.
+// EstimateDistances converts the products into estimated squared distances
+// and lower bounds for re-ranking:
+//
+//	packed := make([]uint8, rabitq.FastScanPackedSize(count, dims))
+//	rabitq.PackFastScanCodes(codes, count, dims, packed)
+//
+//	f := rabitq.QuantizeQuery(unitQuery, queryNorm, q1, q2, q3, q4)
+//	lut := make([]uint8, 16*rabitq.FastScanGroups(dims))
+//	rabitq.BuildFastScanLUT(q1, q2, q3, q4, dims, lut)
+//	rabitq.FastScan(packed, lut, dims, count, products)
+//	rabitq.EstimateDistances(products, codeCounts, dotProducts, norms, f, dist, lower)
+//
 // # Usage
 //
 // These primitives are designed to be used by higher-level quantizer implementations.
@@ -0,0 +1,189 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package rabitq
+
+import "math"
+
+// MaxExtendedBits is the largest number of bits per dimension supported by
+// the extended quantizer.
+const MaxExtendedBits = 4
+
+// extendedScaleSteps is the number of candidate scales tried per vector by
+// QuantizeVectorsExtended.
+const extendedScaleSteps = 64
+
+// extendedLevel maps v to the odd integer nearest to scale*v, clamped to
+// [-levels, levels]. It is the scalar form of the mapping in
+// BaseExtendedScore and must round the same way.
+func extendedLevel(v, scale, levels float32) float32 {
+	x := (v*scale - 1) * 0.5
+	r := float32(math.RoundToEven(float64(x)))
+	return min(max(r+r+1, -levels), levels)
+}
+
+// ExtendedCodeWidth returns the number of uint64s of one extended code with
+// bitsPerDim bit planes, bitsPerDim*CodeWidth(dims).
+func ExtendedCodeWidth(dims, bitsPerDim int) int {
+	return bitsPerDim * CodeWidth(dims)
+}
+
+// QuantizeVectorsExtended quantizes unit vectors into extended RaBitQ codes
+// with bitsPerDim (1 to MaxExtendedBits) bits per dimension.
+//
+// Each component is quantized to an unsigned level u in [0, 2^B-1]; the
+// quantized vector is ō = (2u - m)/‖2u - m‖ with m = 2^B-1, and the scale
+// of the level grid is chosen per vector to maximize <ō, o>. With one bit
+// per dimension this reduces to the sign code of QuantizeVectors.
+//
+// Parameters:
+//   - unitVectors: flattened array of unit vectors (count × dims float32s)
+//   - codes: output bit planes (count × ExtendedCodeWidth(dims, bitsPerDim)
+//     uint64s). Plane b of a code holds bit b of every level, MSB-first like
+//     the 1-bit codes, so each plane can be scored with BitProduct.
+//   - dotProducts: output 1/<ō,o> (count float32s), 0 if <ō,o> is zero
+//   - rescale: output 1/‖2u - m‖ (count float32s)
+//   - codeSums: output sum of the levels u (count uint32s)
+func QuantizeVectorsExtended(unitVectors []float32, bitsPerDim int, codes []uint64, dotProducts, rescale []float32, codeSums []uint32, count, dims int) {
+	if bitsPerDim < 1 || bitsPerDim > MaxExtendedBits {
+		panic("rabitq: bitsPerDim out of range")
+	}
+	if count == 0 {
+		return
+	}
+	width := CodeWidth(dims)
+	codeWidth := bitsPerDim * width
+	_ = codes[count*codeWidth-1]
+	_ = dotProducts[count-1]
+	_ = rescale[count-1]
+	_ = codeSums[count-1]
+	for i := range count {
+		quantizeExtended(unitVectors[i*dims:(i+1)*dims], bitsPerDim, codes[i*codeWidth:(i+1)*codeWidth],
+			&dotProducts[i], &rescale[i], &codeSums[i])
+	}
+}
+
+// quantizeExtended quantizes a single vector for QuantizeVectorsExtended.
+func quantizeExtended(vec []float32, bitsPerDim int, code []uint64, dotProduct, rescale *float32, codeSum *uint32) {
+	levels := float32(int(1)<<bitsPerDim - 1)
+	var maxAbs float32
+	for _, v := range vec {
+		maxAbs = max(maxAbs, float32(math.Abs(float64(v))))
+	}
+	clear(code)
+	if maxAbs == 0 {
+		// The vector is the centroid; every scale yields the same code.
+		maxAbs = 1
+	}
+
+	// Search scales up to the point where the largest component reaches
+	// twice the top level; beyond that the code only loses resolution.
+	// The smallest scale maps every component to ±1, the 1-bit code.
+	bestScale := float32(0)
+	bestCos := float32(-1)
+	var bestDot, bestNormSq float32
+	step := 2 * (levels + 1) / maxAbs / extendedScaleSteps
+	for k := 1; k <= extendedScaleSteps; k++ {
+		scale := step * float32(k)
+		dot, normSq := ExtendedScore(vec, scale, levels)
+		if cos := dot / float32(math.Sqrt(float64(normSq))); cos > bestCos {
+			bestScale, bestCos = scale, cos
+			bestDot, bestNormSq = dot, normSq
+		}
+	}
+
+	width := len(code) / bitsPerDim
+	var sum uint32
+	for d, v := range vec {
+		u := uint64(extendedLevel(v, bestScale, levels)+levels) / 2
+		sum += uint32(u)
+		w, shift := d/64, uint(63-d%64)
+		for b := range bitsPerDim {
+			code[b*width+w] |= (u >> uint(b) & 1) << shift
+		}
+	}
+
+	invNorm := 1 / float32(math.Sqrt(float64(bestNormSq)))
+	*rescale = invNorm
+	*codeSum = sum
+	if cos := bestDot * invNorm; cos != 0 {
+		*dotProduct = 1 / cos
+	} else {
+		*dotProduct = 0
+	}
+}
+
+// ExtendedBitProduct returns Σ_u·q over all dimensions for an extended code
+// with bitsPerDim planes, where q is the 4-bit query encoded in the planes
+// q1..q4 (see QuantizeQuery). It is the multi-bit counterpart of BitProduct.
+func ExtendedBitProduct(code []uint64, bitsPerDim int, q1, q2, q3, q4 []uint64) uint32 {
+	width := len(q1)
+	var sum uint32
+	for b := range bitsPerDim {
+		sum += BitProduct(code[b*width:(b+1)*width], q1, q2, q3, q4) << uint(b)
+	}
+	return sum
+}
+
+// EstimateExtendedDistances is EstimateDistances for extended codes.
+//
+// bitProducts[i] is the ExtendedBitProduct of code i and the query;
+// codeSums, dotProducts and rescale are the outputs of
+// QuantizeVectorsExtended for the same bitsPerDim; norms[i] is the distance
+// from the raw data vector to the centroid.
+func EstimateExtendedDistances(bitProducts, codeSums []uint32, dotProducts, rescale, norms []float32, bitsPerDim int, q QueryFactors, dist, lower []float32) {
+	n := len(dist)
+	if n == 0 {
+		return
+	}
+	_ = bitProducts[n-1]
+	_ = codeSums[n-1]
+	_ = dotProducts[n-1]
+	_ = rescale[n-1]
+	_ = norms[n-1]
+	_ = lower[n-1]
+
+	levels := float32(int(1)<<bitsPerDim - 1)
+	// <ō, q̄> = rescale·(2Δ·ip + 2vl·Σu − mΔ·ΣQ − m·D·vl)
+	scaleBP := 2 * q.Delta
+	scaleSum := 2 * q.Lower
+	bias := levels * (q.Delta*float32(q.SumQ) + float32(q.Dims)*q.Lower)
+	invSqrtDimsM1 := float32(0)
+	if q.Dims > 1 {
+		invSqrtDimsM1 = 1 / float32(math.Sqrt(float64(q.Dims-1)))
+	}
+	// With multi-bit codes the 4-bit rounding of the query is no longer
+	// negligible next to the code error. Rounding errors are uniform in
+	// [-Δ/2, Δ/2], so their contribution to <ō, q̄> has deviation Δ/√12.
+	queryErr := q.Epsilon * q.Delta / float32(math.Sqrt(12))
+	qNormSq := q.Norm * q.Norm
+
+	for i := range n {
+		oNorm := norms[i]
+		base := oNorm*oNorm + qNormSq
+		invDot := dotProducts[i]
+		if invDot == 0 {
+			// The data vector is the centroid; its distance is exact.
+			dist[i] = base
+			lower[i] = base
+			continue
+		}
+		ip := (scaleBP*float32(bitProducts[i]) + scaleSum*float32(codeSums[i]) - bias) * rescale[i] * invDot
+		cross := 2 * oNorm * q.Norm
+		dist[i] = base - cross*ip
+
+		bound := q.Epsilon*float32(math.Sqrt(float64(max(0, invDot*invDot-1))))*invSqrtDimsM1 + queryErr*invDot
+		lower[i] = dist[i] - cross*bound
+	}
+}
@@ -0,0 +1,56 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package rabitq
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var ExtendedScore func(vec []float32, scale float32, levels float32) (dot float32, normSq float32)
+
+func init() {
+	initExtendedAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "rabitq",
+		Groups: []hwy.DispatchGroup{
+			{Name: "ExtendedScore", Vars: []any{&ExtendedScore}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initExtendedAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initExtendedAVX2},
+			{Name: "fallback", Supported: true, Init: initExtendedFallback},
+		},
+	})
+}
+
+func initExtendedAll() {
+	if hwy.NoSimdEnv() {
+		initExtendedFallback()
+		return
+	}
+	if archsimd.X86.AVX512() {
+		initExtendedAVX512()
+		return
+	}
+	if archsimd.X86.AVX2() {
+		initExtendedAVX2()
+		return
+	}
+	initExtendedFallback()
+}
+
+func initExtendedAVX2() {
+	ExtendedScore = BaseExtendedScore_avx2
+}
+
+func initExtendedAVX512() {
+	ExtendedScore = BaseExtendedScore_avx512
+}
+
+func initExtendedFallback() {
+	ExtendedScore = BaseExtendedScore_fallback
+}
@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package rabitq
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var ExtendedScore func(vec []float32, scale float32, levels float32) (dot float32, normSq float32)
+
+func init() {
+	initExtendedAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "rabitq",
+		Groups: []hwy.DispatchGroup{
+			{Name: "ExtendedScore", Vars: []any{&ExtendedScore}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initExtendedNEON},
+			{Name: "fallback", Supported: true, Init: initExtendedFallback},
+		},
+	})
+}
+
+func initExtendedAll() {
+	if hwy.NoSimdEnv() {
+		initExtendedFallback()
+		return
+	}
+	initExtendedNEON()
+	return
+}
+
+func initExtendedNEON() {
+	ExtendedScore = BaseExtendedScore_neon
+}
+
+func initExtendedFallback() {
+	ExtendedScore = BaseExtendedScore_fallback
+}
@@ -0,0 +1,59 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package rabitq
+
+//go:generate go run ../../../cmd/hwygen -input extended_base.go -output . -targets avx2,avx512,neon,fallback -dispatch extended
+
+import "github.com/ajroetker/go-highway/hwy"
+
+// BaseExtendedScore evaluates one candidate scale of the extended
+// (multi-bit) RaBitQ quantizer for a unit vector.
+//
+// Each component is mapped to the odd integer y nearest to scale*v,
+// clamped to [-levels, levels] (levels = 2^B-1 for B bits per dimension).
+// It returns <y, v> and ‖y‖², from which the cosine between the vector and
+// its quantized form is <y, v>/‖y‖.
+func BaseExtendedScore(vec []float32, scale, levels float32) (dot, normSq float32) {
+	n := len(vec)
+	scaleVec := hwy.Set[float32](scale)
+	hiVec := hwy.Set[float32](levels)
+	loVec := hwy.Set[float32](-levels)
+	oneVec := hwy.Set[float32](1)
+	halfVec := hwy.Set[float32](0.5)
+	dotAcc := hwy.Zero[float32]()
+	normAcc := hwy.Zero[float32]()
+
+	lanes := dotAcc.NumLanes()
+	i := 0
+	for ; i+lanes <= n; i += lanes {
+		v := hwy.LoadSlice(vec[i:])
+		// Nearest odd integer: 2*round((x-1)/2) + 1.
+		x := hwy.Mul(hwy.Sub(hwy.Mul(v, scaleVec), oneVec), halfVec)
+		r := hwy.RoundToEven(x)
+		y := hwy.Add(hwy.Add(r, r), oneVec)
+		y = hwy.Max(hwy.Min(y, hiVec), loVec)
+		dotAcc = hwy.MulAdd(y, v, dotAcc)
+		normAcc = hwy.MulAdd(y, y, normAcc)
+	}
+	dot = hwy.ReduceSum(dotAcc)
+	normSq = hwy.ReduceSum(normAcc)
+
+	for ; i < n; i++ {
+		y := extendedLevel(vec[i], scale, levels)
+		dot += y * vec[i]
+		normSq += y * y
+	}
+	return dot, normSq
+}
@@ -0,0 +1,54 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package rabitq
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+// Hoisted constants - pre-broadcasted at package init time
+var (
+	BaseExtendedScore_AVX2_halfVec_f32 = archsimd.BroadcastFloat32x8(0.5)
+	BaseExtendedScore_AVX2_oneVec_f32  = archsimd.BroadcastFloat32x8(1)
+)
+
+func BaseExtendedScore_avx2(vec []float32, scale float32, levels float32) (dot float32, normSq float32) {
+	n := len(vec)
+	scaleVec := archsimd.BroadcastFloat32x8(scale)
+	hiVec := archsimd.BroadcastFloat32x8(levels)
+	loVec := archsimd.BroadcastFloat32x8(-levels)
+	oneVec := BaseExtendedScore_AVX2_oneVec_f32
+	halfVec := BaseExtendedScore_AVX2_halfVec_f32
+	dotAcc := archsimd.BroadcastFloat32x8(0)
+	normAcc := archsimd.BroadcastFloat32x8(0)
+	lanes := 8
+	i := 0
+	for ; i+lanes*2 <= n; i += lanes * 2 {
+		v := archsimd.LoadFloat32x8Slice(vec[i:])
+		x := v.Mul(scaleVec).Sub(oneVec).Mul(halfVec)
+		r := x.RoundToEven()
+		y := r.Add(r).Add(oneVec)
+		y = y.Min(hiVec).Max(loVec)
+		dotAcc = y.MulAdd(v, dotAcc)
+		normAcc = y.MulAdd(y, normAcc)
+		v1 := archsimd.LoadFloat32x8Slice(vec[i+8:])
+		x1 := v1.Mul(scaleVec).Sub(oneVec).Mul(halfVec)
+		r1 := x1.RoundToEven()
+		y1 := r1.Add(r1).Add(oneVec)
+		y1 = y1.Min(hiVec).Max(loVec)
+		dotAcc = y1.MulAdd(v1, dotAcc)
+		normAcc = y1.MulAdd(y1, normAcc)
+	}
+	dot = hwy.ReduceSum_AVX2_F32x8(dotAcc)
+	normSq = hwy.ReduceSum_AVX2_F32x8(normAcc)
+	for ; i < n; i++ {
+		y := extendedLevel(vec[i], scale, levels)
+		dot += y * vec[i]
+		normSq += y * y
+	}
+	return dot, normSq
+}
@@ -0,0 +1,71 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package rabitq
+
+import (
+	"simd/archsimd"
+	"sync"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+// Hoisted constants - lazily initialized on first use to avoid init-time crashes
+var (
+	BaseExtendedScore_AVX512_halfVec_f32 archsimd.Float32x16
+	BaseExtendedScore_AVX512_oneVec_f32  archsimd.Float32x16
+	_extendedBaseHoistOnce               sync.Once
+)
+
+func _extendedBaseInitHoistedConstants() {
+	_extendedBaseHoistOnce.Do(func() {
+		BaseExtendedScore_AVX512_halfVec_f32 = archsimd.BroadcastFloat32x16(0.5)
+		BaseExtendedScore_AVX512_oneVec_f32 = archsimd.BroadcastFloat32x16(1)
+	})
+}
+
+func BaseExtendedScore_avx512(vec []float32, scale float32, levels float32) (dot float32, normSq float32) {
+	_extendedBaseInitHoistedConstants()
+	n := len(vec)
+	scaleVec := archsimd.BroadcastFloat32x16(scale)
+	hiVec := archsimd.BroadcastFloat32x16(levels)
+	loVec := archsimd.BroadcastFloat32x16(-levels)
+	oneVec := BaseExtendedScore_AVX512_oneVec_f32
+	halfVec := BaseExtendedScore_AVX512_halfVec_f32
+	dotAcc := archsimd.BroadcastFloat32x16(0)
+	normAcc := archsimd.BroadcastFloat32x16(0)
+	lanes := 16
+	i := 0
+	for ; i+lanes*3 <= n; i += lanes * 3 {
+		v := archsimd.LoadFloat32x16Slice(vec[i:])
+		x := v.Mul(scaleVec).Sub(oneVec).Mul(halfVec)
+		r := hwy.RoundToEven_AVX512_F32x16(x)
+		y := r.Add(r).Add(oneVec)
+		y = y.Min(hiVec).Max(loVec)
+		dotAcc = y.MulAdd(v, dotAcc)
+		normAcc = y.MulAdd(y, normAcc)
+		v1 := archsimd.LoadFloat32x16Slice(vec[i+16:])
+		x1 := v1.Mul(scaleVec).Sub(oneVec).Mul(halfVec)
+		r1 := hwy.RoundToEven_AVX512_F32x16(x1)
+		y1 := r1.Add(r1).Add(oneVec)
+		y1 = y1.Min(hiVec).Max(loVec)
+		dotAcc = y1.MulAdd(v1, dotAcc)
+		normAcc = y1.MulAdd(y1, normAcc)
+		v2 := archsimd.LoadFloat32x16Slice(vec[i+32:])
+		x2 := v2.Mul(scaleVec).Sub(oneVec).Mul(halfVec)
+		r2 := hwy.RoundToEven_AVX512_F32x16(x2)
+		y2 := r2.Add(r2).Add(oneVec)
+		y2 = y2.Min(hiVec).Max(loVec)
+		dotAcc = y2.MulAdd(v2, dotAcc)
+		normAcc = y2.MulAdd(y2, normAcc)
+	}
+	dot = hwy.ReduceSum_AVX512_F32x16(dotAcc)
+	normSq = hwy.ReduceSum_AVX512_F32x16(normAcc)
+	for ; i < n; i++ {
+		y := extendedLevel(vec[i], scale, levels)
+		dot += y * vec[i]
+		normSq += y * y
+	}
+	return dot, normSq
+}
@@ -0,0 +1,37 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package rabitq
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func BaseExtendedScore_fallback(vec []float32, scale float32, levels float32) (dot float32, normSq float32) {
+	n := len(vec)
+	scaleVec := hwy.Set[float32](scale)
+	hiVec := hwy.Set[float32](levels)
+	loVec := hwy.Set[float32](-levels)
+	oneVec := hwy.Set[float32](1)
+	halfVec := hwy.Set[float32](0.5)
+	dotAcc := hwy.Zero[float32]()
+	normAcc := hwy.Zero[float32]()
+	lanes := dotAcc.NumLanes()
+	i := 0
+	for ; i+lanes <= n; i += lanes {
+		v := hwy.LoadSlice(vec[i:])
+		x := hwy.Mul(hwy.Sub(hwy.Mul(v, scaleVec), oneVec), halfVec)
+		r := hwy.RoundToEven(x)
+		y := hwy.Add(hwy.Add(r, r), oneVec)
+		y = hwy.Max(hwy.Min(y, hiVec), loVec)
+		dotAcc = hwy.MulAdd(y, v, dotAcc)
+		normAcc = hwy.MulAdd(y, y, normAcc)
+	}
+	dot = hwy.ReduceSum(dotAcc)
+	normSq = hwy.ReduceSum(normAcc)
+	for ; i < n; i++ {
+		y := extendedLevel(vec[i], scale, levels)
+		dot += y * vec[i]
+		normSq += y * y
+	}
+	return dot, normSq
+}
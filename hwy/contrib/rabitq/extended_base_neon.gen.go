@@ -0,0 +1,52 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package rabitq
+
+import (
+	"github.com/ajroetker/go-highway/hwy/asm"
+)
+
+// Hoisted constants - pre-broadcasted at package init time
+var (
+	BaseExtendedScore_NEON_halfVec_f32 = asm.BroadcastFloat32x4(0.5)
+	BaseExtendedScore_NEON_oneVec_f32  = asm.BroadcastFloat32x4(1)
+)
+
+func BaseExtendedScore_neon(vec []float32, scale float32, levels float32) (dot float32, normSq float32) {
+	n := len(vec)
+	scaleVec := asm.BroadcastFloat32x4(scale)
+	hiVec := asm.BroadcastFloat32x4(levels)
+	loVec := asm.BroadcastFloat32x4(-levels)
+	oneVec := BaseExtendedScore_NEON_oneVec_f32
+	halfVec := BaseExtendedScore_NEON_halfVec_f32
+	dotAcc := asm.ZeroFloat32x4()
+	normAcc := asm.ZeroFloat32x4()
+	lanes := 4
+	i := 0
+	for ; i+lanes*2 <= n; i += lanes * 2 {
+		v := asm.LoadFloat32x4Slice(vec[i:])
+		x := v.Mul(scaleVec).Sub(oneVec).Mul(halfVec)
+		r := x.RoundToEven()
+		y := r.Add(r).Add(oneVec)
+		y = y.Min(hiVec).Max(loVec)
+		dotAcc = y.MulAdd(v, dotAcc)
+		normAcc = y.MulAdd(y, normAcc)
+		v1 := asm.LoadFloat32x4Slice(vec[i+4:])
+		x1 := v1.Mul(scaleVec).Sub(oneVec).Mul(halfVec)
+		r1 := x1.RoundToEven()
+		y1 := r1.Add(r1).Add(oneVec)
+		y1 = y1.Min(hiVec).Max(loVec)
+		dotAcc = y1.MulAdd(v1, dotAcc)
+		normAcc = y1.MulAdd(y1, normAcc)
+	}
+	dot = dotAcc.ReduceSum()
+	normSq = normAcc.ReduceSum()
+	for ; i < n; i++ {
+		y := extendedLevel(vec[i], scale, levels)
+		dot += y * vec[i]
+		normSq += y * y
+	}
+	return dot, normSq
+}
@@ -0,0 +1,22 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package rabitq
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("rabitq", "ExtendedScore", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ExtendedScore; hwyImpl != nil {
+			ExtendedScore = func(vec []float32, scale float32, levels float32) (dot float32, normSq float32) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(vec, scale, levels)
+				hwyCounter.Done(hwyStart, len(vec), hwy.SliceBytes(vec))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+}
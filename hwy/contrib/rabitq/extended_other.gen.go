@@ -0,0 +1,32 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build !arm64 && !(amd64 && goexperiment.simd)
+
+package rabitq
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var ExtendedScore func(vec []float32, scale float32, levels float32) (dot float32, normSq float32)
+
+func init() {
+	initExtendedAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "rabitq",
+		Groups: []hwy.DispatchGroup{
+			{Name: "ExtendedScore", Vars: []any{&ExtendedScore}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initExtendedFallback},
+		},
+	})
+}
+
+func initExtendedAll() {
+	initExtendedFallback()
+}
+
+func initExtendedFallback() {
+	ExtendedScore = BaseExtendedScore_fallback
+}
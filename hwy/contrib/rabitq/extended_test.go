@@ -0,0 +1,275 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package rabitq
+
+import (
+	"math"
+	"math/rand/v2"
+	"slices"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// randomUnitVectors returns count random unit vectors of dims components.
+func randomUnitVectors(rng *rand.Rand, count, dims int) []float32 {
+	zero := make([]float32, dims)
+	data := make([]float32, count*dims)
+	for i := range data {
+		data[i] = float32(rng.NormFloat64())
+	}
+	for i := range count {
+		v := data[i*dims : (i+1)*dims]
+		residual(v, zero, v)
+	}
+	return data
+}
+
+func TestParallelQuantizeVectors(t *testing.T) {
+	const count, dims = 1000, 100
+	rng := rand.New(rand.NewPCG(11, 1))
+	unit := randomUnitVectors(rng, count, dims)
+	width := CodeWidth(dims)
+	sqrtDimsInv := float32(1 / math.Sqrt(dims))
+
+	wantCodes := make([]uint64, count*width)
+	wantDots := make([]float32, count)
+	wantCounts := make([]uint32, count)
+	QuantizeVectors(unit, wantCodes, wantDots, wantCounts, sqrtDimsInv, count, dims, width)
+
+	pool := workerpool.New(4)
+	defer pool.Close()
+	for _, p := range []workerpool.Executor{nil, pool} {
+		codes := make([]uint64, count*width)
+		dots := make([]float32, count)
+		counts := make([]uint32, count)
+		ParallelQuantizeVectors(p, unit, codes, dots, counts, sqrtDimsInv, count, dims, width)
+		if !slices.Equal(codes, wantCodes) || !slices.Equal(dots, wantDots) || !slices.Equal(counts, wantCounts) {
+			t.Fatalf("pool=%v: parallel output differs from QuantizeVectors", p != nil)
+		}
+	}
+
+	const bitsPerDim = 3
+	codeWidth := ExtendedCodeWidth(dims, bitsPerDim)
+	wantCodes = make([]uint64, count*codeWidth)
+	wantRescale := make([]float32, count)
+	QuantizeVectorsExtended(unit, bitsPerDim, wantCodes, wantDots, wantRescale, wantCounts, count, dims)
+	codes := make([]uint64, count*codeWidth)
+	dots := make([]float32, count)
+	rescale := make([]float32, count)
+	sums := make([]uint32, count)
+	ParallelQuantizeVectorsExtended(pool, unit, bitsPerDim, codes, dots, rescale, sums, count, dims)
+	if !slices.Equal(codes, wantCodes) || !slices.Equal(dots, wantDots) ||
+		!slices.Equal(rescale, wantRescale) || !slices.Equal(sums, wantCounts) {
+		t.Fatal("parallel extended output differs from QuantizeVectorsExtended")
+	}
+}
+
+func TestExtendedScoreMatchesScalar(t *testing.T) {
+	rng := rand.New(rand.NewPCG(12, 1))
+	for _, dims := range []int{1, 7, 16, 33, 128} {
+		vec := randomUnitVectors(rng, 1, dims)
+		for _, levels := range []float32{1, 3, 7, 15} {
+			scale := float32(rng.Float64()) * 4 * levels
+			var wantDot, wantNorm float32
+			for _, v := range vec {
+				y := extendedLevel(v, scale, levels)
+				if y < -levels || y > levels || math.Mod(float64(y), 2) == 0 {
+					t.Fatalf("level %v is not an odd integer in [-%v, %v]", y, levels, levels)
+				}
+				wantDot += y * v
+				wantNorm += y * y
+			}
+			dot, normSq := ExtendedScore(vec, scale, levels)
+			if math.Abs(float64(dot-wantDot)) > 1e-3 || normSq != wantNorm {
+				t.Errorf("dims=%d levels=%v: got (%v, %v), want (%v, %v)", dims, levels, dot, normSq, wantDot, wantNorm)
+			}
+		}
+	}
+}
+
+func TestQuantizeVectorsExtended(t *testing.T) {
+	const count, dims = 200, 128
+	rng := rand.New(rand.NewPCG(13, 1))
+	unit := randomUnitVectors(rng, count, dims)
+	width := CodeWidth(dims)
+
+	// One bit per dimension reproduces the sign code.
+	signCodes := make([]uint64, count*width)
+	signDots := make([]float32, count)
+	signCounts := make([]uint32, count)
+	QuantizeVectors(unit, signCodes, signDots, signCounts, float32(1/math.Sqrt(dims)), count, dims, width)
+
+	prevCos := 0.0
+	for bitsPerDim := 1; bitsPerDim <= MaxExtendedBits; bitsPerDim++ {
+		codeWidth := ExtendedCodeWidth(dims, bitsPerDim)
+		codes := make([]uint64, count*codeWidth)
+		dots := make([]float32, count)
+		rescale := make([]float32, count)
+		sums := make([]uint32, count)
+		QuantizeVectorsExtended(unit, bitsPerDim, codes, dots, rescale, sums, count, dims)
+
+		if bitsPerDim == 1 {
+			if !slices.Equal(codes, signCodes) || !slices.Equal(sums, signCounts) {
+				t.Fatal("1-bit extended code differs from QuantizeVectors")
+			}
+		}
+
+		var meanCos float64
+		levels := float64(int(1)<<bitsPerDim - 1)
+		for i := range count {
+			code := codes[i*codeWidth : (i+1)*codeWidth]
+			vec := unit[i*dims : (i+1)*dims]
+			// Reconstruct ō from the planes and check the stored factors.
+			var dot, normSq float64
+			var sum uint32
+			for d := range dims {
+				var u uint64
+				for b := range bitsPerDim {
+					u |= uint64(codeBit(code[b*width:(b+1)*width], d)) << b
+				}
+				sum += uint32(u)
+				y := 2*float64(u) - levels
+				dot += y * float64(vec[d])
+				normSq += y * y
+			}
+			if sums[i] != sum {
+				t.Fatalf("bits=%d vector %d: code sum %d, want %d", bitsPerDim, i, sums[i], sum)
+			}
+			cos := dot / math.Sqrt(normSq)
+			if math.Abs(float64(rescale[i])*math.Sqrt(normSq)-1) > 1e-4 || math.Abs(float64(dots[i])*cos-1) > 1e-3 {
+				t.Fatalf("bits=%d vector %d: inconsistent factors", bitsPerDim, i)
+			}
+			meanCos += cos
+		}
+		meanCos /= count
+		if meanCos <= prevCos {
+			t.Errorf("bits=%d: mean <ō,o> %.4f did not improve on %.4f", bitsPerDim, meanCos, prevCos)
+		}
+		prevCos = meanCos
+	}
+	if prevCos < 0.98 {
+		t.Errorf("4-bit mean <ō,o> %.4f, want >= 0.98", prevCos)
+	}
+}
+
+func TestEstimateExtendedDistances(t *testing.T) {
+	const dims, count = 256, 500
+	rng := rand.New(rand.NewPCG(14, 1))
+	width := CodeWidth(dims)
+
+	centroid := make([]float32, dims)
+	data := make([]float32, count*dims)
+	for i := range data {
+		data[i] = float32(rng.NormFloat64())
+	}
+	query := make([]float32, dims)
+	for d := range query {
+		query[d] = float32(rng.NormFloat64())
+	}
+	unit := make([]float32, count*dims)
+	norms := make([]float32, count)
+	for i := range count {
+		norms[i] = residual(data[i*dims:(i+1)*dims], centroid, unit[i*dims:(i+1)*dims])
+	}
+	unitQuery := make([]float32, dims)
+	qNorm := residual(query, centroid, unitQuery)
+	planes := make([]uint64, 4*width)
+	q1, q2, q3, q4 := planes[:width], planes[width:2*width], planes[2*width:3*width], planes[3*width:]
+	f := QuantizeQuery(unitQuery, qNorm, q1, q2, q3, q4)
+	f.Epsilon = 3
+
+	prevErr := math.Inf(1)
+	for bitsPerDim := 1; bitsPerDim <= MaxExtendedBits; bitsPerDim++ {
+		codeWidth := ExtendedCodeWidth(dims, bitsPerDim)
+		codes := make([]uint64, count*codeWidth)
+		dots := make([]float32, count)
+		rescale := make([]float32, count)
+		sums := make([]uint32, count)
+		QuantizeVectorsExtended(unit, bitsPerDim, codes, dots, rescale, sums, count, dims)
+
+		products := make([]uint32, count)
+		for i := range count {
+			products[i] = ExtendedBitProduct(codes[i*codeWidth:(i+1)*codeWidth], bitsPerDim, q1, q2, q3, q4)
+		}
+		dist := make([]float32, count)
+		lower := make([]float32, count)
+		EstimateExtendedDistances(products, sums, dots, rescale, norms, bitsPerDim, f, dist, lower)
+
+		var relErr float64
+		violations := 0
+		for i := range count {
+			var exact float64
+			for d := range dims {
+				diff := float64(data[i*dims+d] - query[d])
+				exact += diff * diff
+			}
+			relErr += math.Abs(float64(dist[i])-exact) / exact
+			if float64(lower[i]) > exact*(1+1e-5) {
+				violations++
+			}
+		}
+		relErr /= count
+		if relErr >= prevErr {
+			t.Errorf("bits=%d: mean relative error %.4f did not improve on %.4f", bitsPerDim, relErr, prevErr)
+		}
+		if violations > count/100 {
+			t.Errorf("bits=%d: lower bound exceeded exact distance for %d of %d codes", bitsPerDim, violations, count)
+		}
+		prevErr = relErr
+	}
+}
+
+func BenchmarkQuantizeVectorsExtended(b *testing.B) {
+	const count, dims = 100, 768
+	rng := rand.New(rand.NewPCG(42, 1))
+	unit := randomUnitVectors(rng, count, dims)
+	dots := make([]float32, count)
+	rescale := make([]float32, count)
+	sums := make([]uint32, count)
+	for _, bitsPerDim := range []int{2, 4} {
+		codes := make([]uint64, count*ExtendedCodeWidth(dims, bitsPerDim))
+		b.Run("bits_"+itoa(bitsPerDim), func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				QuantizeVectorsExtended(unit, bitsPerDim, codes, dots, rescale, sums, count, dims)
+			}
+		})
+	}
+}
+
+func BenchmarkParallelQuantizeVectors(b *testing.B) {
+	const count, dims = 10000, 768
+	rng := rand.New(rand.NewPCG(42, 1))
+	unit := randomUnitVectors(rng, count, dims)
+	width := CodeWidth(dims)
+	codes := make([]uint64, count*width)
+	dots := make([]float32, count)
+	counts := make([]uint32, count)
+	sqrtDimsInv := float32(1 / math.Sqrt(dims))
+	pool := workerpool.New(0)
+	defer pool.Close()
+	for _, p := range []workerpool.Executor{nil, pool} {
+		name := "Sequential"
+		if p != nil {
+			name = "Parallel"
+		}
+		b.Run(name, func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				ParallelQuantizeVectors(p, unit, codes, dots, counts, sqrtDimsInv, count, dims, width)
+			}
+		})
+	}
+}
@@ -0,0 +1,276 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package rabitq
+
+import (
+	"math"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/fastscan"
+)
+
+// FastScanBlockSize is the number of codes scored together by FastScanBlock.
+const FastScanBlockSize = fastscan.BlockSize
+
+// fastScanChunkGroups is the number of groups summed in uint16 lanes per
+// fastscan.ScanBlock call. A LUT entry is at most 4*15 = 60, so 1092 groups
+// cannot saturate; dims up to 4368 are scored in a single call.
+const fastScanChunkGroups = math.MaxUint16 / 60
+
+// DefaultEpsilon is the default ε₀ of the RaBitQ error bound, the value
+// recommended by the paper. Larger values widen the bound and make it hold
+// with higher probability (about 97% of lower bounds hold at 1.9, over 99.8%
+// at 3).
+const DefaultEpsilon = 1.9
+
+// FastScanGroups returns the number of 4-dimension groups for dims, ⌈dims/4⌉.
+func FastScanGroups(dims int) int {
+	return (dims + 3) / 4
+}
+
+// FastScanBlockBytes returns the size in bytes of one packed FastScan block.
+func FastScanBlockBytes(dims int) int {
+	return FastScanBlockSize * FastScanGroups(dims)
+}
+
+// FastScanPackedSize returns the size in bytes of count packed codes,
+// rounded up to whole blocks.
+func FastScanPackedSize(count, dims int) int {
+	blocks := (count + FastScanBlockSize - 1) / FastScanBlockSize
+	return blocks * FastScanBlockBytes(dims)
+}
+
+// codeBit returns bit d of an MSB-first code.
+func codeBit(code []uint64, d int) uint8 {
+	return uint8(code[d/64]>>(63-d%64)) & 1
+}
+
+// PackFastScanCodes transposes count codes (as produced by QuantizeVectors,
+// CodeWidth(dims) uint64s each) into the blocked layout read by
+// FastScanBlock.
+//
+// Codes are grouped in blocks of FastScanBlockSize. Within a block, each
+// group of 4 dimensions occupies 32 bytes; byte j holds the nibble of code j
+// with dimension 4g+k in bit k. The last block is zero padded. dst must hold
+// FastScanPackedSize(count, dims) bytes.
+func PackFastScanCodes(codes []uint64, count, dims int, dst []uint8) {
+	width := CodeWidth(dims)
+	groups := FastScanGroups(dims)
+	blockBytes := FastScanBlockBytes(dims)
+	size := FastScanPackedSize(count, dims)
+	_ = dst[size-1]
+	clear(dst[:size])
+
+	for i := range count {
+		code := codes[i*width : (i+1)*width]
+		block := dst[(i/FastScanBlockSize)*blockBytes:]
+		j := i % FastScanBlockSize
+		for g := range groups {
+			var nibble uint8
+			for k := range 4 {
+				if d := 4*g + k; d < dims {
+					nibble |= codeBit(code, d) << k
+				}
+			}
+			block[g*FastScanBlockSize+j] = nibble
+		}
+	}
+}
+
+// BuildFastScanLUT builds the per-query lookup table for FastScanBlock from
+// the four query bit planes passed to BitProduct.
+//
+// For every group of 4 dimensions the table has 16 entries; entry n is the
+// sum of the 4-bit query values of the dimensions whose bit is set in n,
+// so looking up a code nibble yields that group's share of the bit product.
+// lut must hold 16*FastScanGroups(dims) bytes.
+func BuildFastScanLUT(q1, q2, q3, q4 []uint64, dims int, lut []uint8) {
+	groups := FastScanGroups(dims)
+	_ = lut[groups*16-1]
+	for g := range groups {
+		var qv [4]uint8
+		for k := range 4 {
+			if d := 4*g + k; d < dims {
+				qv[k] = codeBit(q1, d) | codeBit(q2, d)<<1 | codeBit(q3, d)<<2 | codeBit(q4, d)<<3
+			}
+		}
+		entries := lut[g*16 : g*16+16]
+		for n := range 16 {
+			var sum uint8
+			for k := range 4 {
+				if n&(1<<k) != 0 {
+					sum += qv[k]
+				}
+			}
+			entries[n] = sum
+		}
+	}
+}
+
+// FastScanBlock computes the bit products of one FastScan block of
+// FastScanBlockSize codes against a query LUT.
+//
+// codes holds the block in the layout produced by PackFastScanCodes: for each
+// group of 4 dimensions, 32 bytes whose byte j is the 4-bit code nibble of
+// vector j. lut holds 16 entries per group (see BuildFastScanLUT). groups is
+// the number of groups, ⌈dims/4⌉.
+//
+// The block is scored by fastscan.ScanBlock, which keeps the sums in uint16
+// vector lanes; they are widened to out once per fastScanChunkGroups groups.
+// out[j] receives the same value as BitProduct for vector j of the block.
+func FastScanBlock(codes []uint8, lut []uint8, groups int, out []uint32) {
+	if len(out) < FastScanBlockSize {
+		return
+	}
+	out = out[:FastScanBlockSize]
+	clear(out)
+	var sums [FastScanBlockSize]uint16
+	for g0 := 0; g0 < groups; g0 += fastScanChunkGroups {
+		n := min(fastScanChunkGroups, groups-g0)
+		fastscan.ScanBlock(codes[g0*FastScanBlockSize:], lut[g0*16:], n, sums[:])
+		for j, s := range sums {
+			out[j] += uint32(s)
+		}
+	}
+}
+
+// FastScan computes the bit products of count packed codes against a query
+// LUT, writing one value per code to out. It is the batched equivalent of
+// calling BitProduct for every code.
+func FastScan(packed []uint8, lut []uint8, dims, count int, out []uint32) {
+	if count == 0 {
+		return
+	}
+	_ = out[count-1]
+	groups := FastScanGroups(dims)
+	blockBytes := FastScanBlockBytes(dims)
+	var tail [FastScanBlockSize]uint32
+	for start := 0; start < count; start += FastScanBlockSize {
+		block := packed[(start/FastScanBlockSize)*blockBytes:]
+		if start+FastScanBlockSize <= count {
+			FastScanBlock(block, lut, groups, out[start:start+FastScanBlockSize])
+			continue
+		}
+		FastScanBlock(block, lut, groups, tail[:])
+		copy(out[start:count], tail[:])
+	}
+}
+
+// QueryFactors holds the per-query constants of the RaBitQ distance
+// estimator, as returned by QuantizeQuery.
+type QueryFactors struct {
+	// Lower is the smallest component of the unit query vector.
+	Lower float32
+	// Delta is the step of the 4-bit scalar quantization of the query.
+	Delta float32
+	// SumQ is the sum of the quantized query components.
+	SumQ uint32
+	// Norm is the distance from the raw query to the centroid.
+	Norm float32
+	// Dims is the vector dimensionality.
+	Dims int
+	// Epsilon is ε₀ of the error bound used for lower bounds.
+	Epsilon float32
+}
+
+// QuantizeQuery scalar-quantizes a unit query vector (the query minus the
+// centroid, normalized) to 4 bits per dimension and writes its bit planes to
+// q1..q4 (weights 1, 2, 4, 8; CodeWidth(dims) uint64s each, MSB-first like
+// the data codes). norm is the distance from the raw query to the centroid.
+func QuantizeQuery(unitQuery []float32, norm float32, q1, q2, q3, q4 []uint64) QueryFactors {
+	dims := len(unitQuery)
+	f := QueryFactors{Norm: norm, Dims: dims, Epsilon: DefaultEpsilon}
+	if dims == 0 {
+		return f
+	}
+	lo, hi := unitQuery[0], unitQuery[0]
+	for _, v := range unitQuery[1:] {
+		lo = min(lo, v)
+		hi = max(hi, v)
+	}
+	f.Lower = lo
+	f.Delta = (hi - lo) / 15
+
+	width := CodeWidth(dims)
+	clear(q1[:width])
+	clear(q2[:width])
+	clear(q3[:width])
+	clear(q4[:width])
+	var inv float32
+	if f.Delta > 0 {
+		inv = 1 / f.Delta
+	}
+	for d, v := range unitQuery {
+		qu := uint64(min(15, max(0, int((v-lo)*inv+0.5))))
+		f.SumQ += uint32(qu)
+		w, shift := d/64, uint(63-d%64)
+		q1[w] |= (qu & 1) << shift
+		q2[w] |= (qu >> 1 & 1) << shift
+		q3[w] |= (qu >> 2 & 1) << shift
+		q4[w] |= (qu >> 3 & 1) << shift
+	}
+	return f
+}
+
+// EstimateDistances turns bit products into estimated squared distances and
+// their lower bounds for re-ranking.
+//
+// For code i, codeCounts[i] and dotProducts[i] are the outputs of
+// QuantizeVectors and norms[i] is the distance from the raw data vector to
+// the centroid. The estimate of ‖o−q‖² is written to dist[i] and a lower
+// bound that holds with high probability (see QueryFactors.Epsilon) to
+// lower[i]; candidates whose lower bound exceeds the current k-th best exact
+// distance can be skipped.
+func EstimateDistances(bitProducts, codeCounts []uint32, dotProducts, norms []float32, q QueryFactors, dist, lower []float32) {
+	n := len(dist)
+	if n == 0 {
+		return
+	}
+	_ = bitProducts[n-1]
+	_ = codeCounts[n-1]
+	_ = dotProducts[n-1]
+	_ = norms[n-1]
+	_ = lower[n-1]
+
+	dims := float32(q.Dims)
+	invSqrtDims := 1 / float32(math.Sqrt(float64(q.Dims)))
+	// <ō, q̄> = (2Δ·bp + 2vl·popcount − Δ·ΣQ − D·vl) / √D
+	scaleBP := 2 * q.Delta * invSqrtDims
+	scaleCount := 2 * q.Lower * invSqrtDims
+	bias := (q.Delta*float32(q.SumQ) + dims*q.Lower) * invSqrtDims
+	invSqrtDimsM1 := float32(0)
+	if q.Dims > 1 {
+		invSqrtDimsM1 = 1 / float32(math.Sqrt(float64(q.Dims-1)))
+	}
+	qNormSq := q.Norm * q.Norm
+
+	for i := range n {
+		oNorm := norms[i]
+		base := oNorm*oNorm + qNormSq
+		invDot := dotProducts[i]
+		if invDot == 0 {
+			// The data vector is the centroid; its distance is exact.
+			dist[i] = base
+			lower[i] = base
+			continue
+		}
+		ip := (scaleBP*float32(bitProducts[i]) + scaleCount*float32(codeCounts[i]) - bias) * invDot
+		cross := 2 * oNorm * q.Norm
+		dist[i] = base - cross*ip
+
+		// |<o,q> − est| ≤ ε₀·√((1 − <ō,o>²) / (<ō,o>²·(D−1)))
+		bound := q.Epsilon * float32(math.Sqrt(float64(max(0, invDot*invDot-1)))) * invSqrtDimsM1
+		lower[i] = dist[i] - cross*bound
+	}
+}
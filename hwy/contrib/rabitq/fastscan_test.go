@@ -0,0 +1,233 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package rabitq
+
+import (
+	"math"
+	"math/rand/v2"
+	"testing"
+)
+
+// randomCodes returns count random codes with the padding bits beyond dims
+// cleared, as QuantizeVectors produces them.
+func randomCodes(rng *rand.Rand, count, dims int) []uint64 {
+	width := CodeWidth(dims)
+	codes := make([]uint64, count*width)
+	for i := range codes {
+		codes[i] = rng.Uint64()
+	}
+	if rem := dims % 64; rem != 0 {
+		for i := range count {
+			codes[i*width+width-1] &^= (1 << (64 - rem)) - 1
+		}
+	}
+	return codes
+}
+
+func TestFastScanMatchesBitProduct(t *testing.T) {
+	rng := rand.New(rand.NewPCG(42, 1))
+	for _, dims := range []int{1, 4, 63, 64, 100, 128, 768, 1024} {
+		for _, count := range []int{1, 31, 32, 33, 100} {
+			width := CodeWidth(dims)
+			codes := randomCodes(rng, count, dims)
+			planes := randomCodes(rng, 4, dims)
+			q1, q2, q3, q4 := planes[:width], planes[width:2*width], planes[2*width:3*width], planes[3*width:]
+
+			packed := make([]uint8, FastScanPackedSize(count, dims))
+			PackFastScanCodes(codes, count, dims, packed)
+			lut := make([]uint8, 16*FastScanGroups(dims))
+			BuildFastScanLUT(q1, q2, q3, q4, dims, lut)
+
+			out := make([]uint32, count)
+			FastScan(packed, lut, dims, count, out)
+			for i := range count {
+				want := bitProductReference(codes[i*width:(i+1)*width], q1, q2, q3, q4)
+				if out[i] != want {
+					t.Fatalf("dims=%d count=%d code %d: got %d, want %d", dims, count, i, out[i], want)
+				}
+			}
+		}
+	}
+}
+
+// TestFastScanWideSaturating checks the all-ones worst case past the point
+// where one group chunk would saturate the uint16 lanes.
+func TestFastScanWideSaturating(t *testing.T) {
+	const dims, count = 8192, 32
+	width := CodeWidth(dims)
+	codes := make([]uint64, count*width)
+	planes := make([]uint64, 4*width)
+	for i := range codes {
+		codes[i] = ^uint64(0)
+	}
+	for i := range planes {
+		planes[i] = ^uint64(0)
+	}
+	q1, q2, q3, q4 := planes[:width], planes[width:2*width], planes[2*width:3*width], planes[3*width:]
+
+	packed := make([]uint8, FastScanPackedSize(count, dims))
+	PackFastScanCodes(codes, count, dims, packed)
+	lut := make([]uint8, 16*FastScanGroups(dims))
+	BuildFastScanLUT(q1, q2, q3, q4, dims, lut)
+
+	out := make([]uint32, count)
+	FastScan(packed, lut, dims, count, out)
+	for i, got := range out {
+		if got != 15*dims {
+			t.Fatalf("code %d: got %d, want %d", i, got, 15*dims)
+		}
+	}
+}
+
+func TestQuantizeQuery(t *testing.T) {
+	query := []float32{-0.5, 0.5, 0.1, 0.3}
+	width := CodeWidth(len(query))
+	planes := make([]uint64, 4*width)
+	f := QuantizeQuery(query, 2, planes[:width], planes[width:2*width], planes[2*width:3*width], planes[3*width:])
+	if f.Lower != -0.5 || f.Delta != 1.0/15 || f.Dims != 4 || f.Norm != 2 {
+		t.Fatalf("unexpected factors %+v", f)
+	}
+	// Quantized values: (v + 0.5) * 15, rounded.
+	want := []uint64{0, 15, 9, 12}
+	var sum uint32
+	for d, w := range want {
+		var got uint64
+		for p := range 4 {
+			got |= uint64(codeBit(planes[p*width:(p+1)*width], d)) << p
+		}
+		if got != w {
+			t.Errorf("dim %d: quantized %d, want %d", d, got, w)
+		}
+		sum += uint32(w)
+	}
+	if f.SumQ != sum {
+		t.Errorf("SumQ = %d, want %d", f.SumQ, sum)
+	}
+}
+
+func TestEstimateDistances(t *testing.T) {
+	const dims, count = 256, 500
+	rng := rand.New(rand.NewPCG(7, 1))
+	width := CodeWidth(dims)
+
+	centroid := make([]float32, dims)
+	for d := range centroid {
+		centroid[d] = rng.Float32()
+	}
+	data := make([]float32, count*dims)
+	for i := range data {
+		data[i] = centroid[i%dims] + float32(rng.NormFloat64())
+	}
+	query := make([]float32, dims)
+	for d := range query {
+		query[d] = centroid[d] + float32(rng.NormFloat64())
+	}
+
+	// Normalize residuals and quantize.
+	unit := make([]float32, count*dims)
+	norms := make([]float32, count)
+	for i := range count {
+		norms[i] = residual(data[i*dims:(i+1)*dims], centroid, unit[i*dims:(i+1)*dims])
+	}
+	codes := make([]uint64, count*width)
+	dotProducts := make([]float32, count)
+	codeCounts := make([]uint32, count)
+	QuantizeVectors(unit, codes, dotProducts, codeCounts, float32(1/math.Sqrt(dims)), count, dims, width)
+
+	unitQuery := make([]float32, dims)
+	qNorm := residual(query, centroid, unitQuery)
+	planes := make([]uint64, 4*width)
+	f := QuantizeQuery(unitQuery, qNorm, planes[:width], planes[width:2*width], planes[2*width:3*width], planes[3*width:])
+	f.Epsilon = 3
+
+	packed := make([]uint8, FastScanPackedSize(count, dims))
+	PackFastScanCodes(codes, count, dims, packed)
+	lut := make([]uint8, 16*FastScanGroups(dims))
+	BuildFastScanLUT(planes[:width], planes[width:2*width], planes[2*width:3*width], planes[3*width:], dims, lut)
+	products := make([]uint32, count)
+	FastScan(packed, lut, dims, count, products)
+
+	dist := make([]float32, count)
+	lower := make([]float32, count)
+	EstimateDistances(products, codeCounts, dotProducts, norms, f, dist, lower)
+
+	var relErr float64
+	violations := 0
+	for i := range count {
+		var exact float64
+		for d := range dims {
+			diff := float64(data[i*dims+d] - query[d])
+			exact += diff * diff
+		}
+		relErr += math.Abs(float64(dist[i])-exact) / exact
+		if float64(lower[i]) > exact*(1+1e-5) {
+			violations++
+		}
+		if lower[i] > dist[i] {
+			t.Fatalf("code %d: lower bound %v above estimate %v", i, lower[i], dist[i])
+		}
+	}
+	if mean := relErr / count; mean > 0.05 {
+		t.Errorf("mean relative error %.4f, want <= 0.05", mean)
+	}
+	if violations > count/100 {
+		t.Errorf("lower bound exceeded exact distance for %d of %d codes", violations, count)
+	}
+}
+
+// residual writes (v - c) / ‖v - c‖ to unit and returns ‖v - c‖.
+func residual(v, c, unit []float32) float32 {
+	var norm float64
+	for d := range v {
+		unit[d] = v[d] - c[d]
+		norm += float64(unit[d]) * float64(unit[d])
+	}
+	norm = math.Sqrt(norm)
+	for d := range unit {
+		unit[d] /= float32(norm)
+	}
+	return float32(norm)
+}
+
+func BenchmarkFastScan(b *testing.B) {
+	const count = 1024
+	for _, dims := range []int{128, 256, 768} {
+		rng := rand.New(rand.NewPCG(42, 1))
+		width := CodeWidth(dims)
+		codes := randomCodes(rng, count, dims)
+		planes := randomCodes(rng, 4, dims)
+		q1, q2, q3, q4 := planes[:width], planes[width:2*width], planes[2*width:3*width], planes[3*width:]
+		packed := make([]uint8, FastScanPackedSize(count, dims))
+		PackFastScanCodes(codes, count, dims, packed)
+		lut := make([]uint8, 16*FastScanGroups(dims))
+		BuildFastScanLUT(q1, q2, q3, q4, dims, lut)
+		out := make([]uint32, count)
+
+		b.Run("FastScan/"+sizeToName(dims), func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				FastScan(packed, lut, dims, count, out)
+			}
+		})
+		b.Run("BitProduct/"+sizeToName(dims), func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				for j := range count {
+					out[j] = BitProduct(codes[j*width:(j+1)*width], q1, q2, q3, q4)
+				}
+			}
+		})
+	}
+}
@@ -0,0 +1,59 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package rabitq
+
+import "github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+
+// MinParallelQuantizeVectors is the minimum number of vectors before
+// ParallelQuantizeVectors and ParallelQuantizeVectorsExtended split the
+// work across the pool.
+const MinParallelQuantizeVectors = 256
+
+// quantizeBatch is the number of vectors handed to a worker at a time.
+const quantizeBatch = 64
+
+// ParallelQuantizeVectors is QuantizeVectors with the vectors quantized in
+// parallel batches on pool. Each vector is independent, so the output is
+// identical to QuantizeVectors.
+//
+// Falls back to sequential execution when pool is nil or count is below
+// MinParallelQuantizeVectors.
+func ParallelQuantizeVectors(pool workerpool.Executor, unitVectors []float32, codes []uint64, dotProducts []float32, codeCounts []uint32, sqrtDimsInv float32, count, dims, width int) {
+	if pool == nil || count < MinParallelQuantizeVectors {
+		QuantizeVectors(unitVectors, codes, dotProducts, codeCounts, sqrtDimsInv, count, dims, width)
+		return
+	}
+	pool.ParallelForAtomicBatched(count, quantizeBatch, func(start, end int) {
+		QuantizeVectors(unitVectors[start*dims:end*dims], codes[start*width:end*width],
+			dotProducts[start:end], codeCounts[start:end], sqrtDimsInv, end-start, dims, width)
+	})
+}
+
+// ParallelQuantizeVectorsExtended is QuantizeVectorsExtended with the
+// vectors quantized in parallel batches on pool.
+//
+// Falls back to sequential execution when pool is nil or count is below
+// MinParallelQuantizeVectors.
+func ParallelQuantizeVectorsExtended(pool workerpool.Executor, unitVectors []float32, bitsPerDim int, codes []uint64, dotProducts, rescale []float32, codeSums []uint32, count, dims int) {
+	if pool == nil || count < MinParallelQuantizeVectors {
+		QuantizeVectorsExtended(unitVectors, bitsPerDim, codes, dotProducts, rescale, codeSums, count, dims)
+		return
+	}
+	codeWidth := ExtendedCodeWidth(dims, bitsPerDim)
+	pool.ParallelForAtomicBatched(count, quantizeBatch, func(start, end int) {
+		QuantizeVectorsExtended(unitVectors[start*dims:end*dims], bitsPerDim, codes[start*codeWidth:end*codeWidth],
+			dotProducts[start:end], rescale[start:end], codeSums[start:end], end-start, dims)
+	})
+}
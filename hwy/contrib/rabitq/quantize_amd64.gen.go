@@ -0,0 +1,56 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package rabitq
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var QuantizeVectors func(unitVectors []float32, codes []uint64, dotProducts []float32, codeCounts []uint32, sqrtDimsInv float32, count int, dims int, width int)
+
+func init() {
+	initQuantizeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "rabitq",
+		Groups: []hwy.DispatchGroup{
+			{Name: "QuantizeVectors", Vars: []any{&QuantizeVectors}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initQuantizeAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initQuantizeAVX2},
+			{Name: "fallback", Supported: true, Init: initQuantizeFallback},
+		},
+	})
+}
+
+func initQuantizeAll() {
+	if hwy.NoSimdEnv() {
+		initQuantizeFallback()
+		return
+	}
+	if archsimd.X86.AVX512() {
+		initQuantizeAVX512()
+		return
+	}
+	if archsimd.X86.AVX2() {
+		initQuantizeAVX2()
+		return
+	}
+	initQuantizeFallback()
+}
+
+func initQuantizeAVX2() {
+	QuantizeVectors = BaseQuantizeVectors_avx2
+}
+
+func initQuantizeAVX512() {
+	QuantizeVectors = BaseQuantizeVectors_avx512
+}
+
+func initQuantizeFallback() {
+	QuantizeVectors = BaseQuantizeVectors_fallback
+}
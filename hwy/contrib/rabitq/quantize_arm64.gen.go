@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package rabitq
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var QuantizeVectors func(unitVectors []float32, codes []uint64, dotProducts []float32, codeCounts []uint32, sqrtDimsInv float32, count int, dims int, width int)
+
+func init() {
+	initQuantizeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "rabitq",
+		Groups: []hwy.DispatchGroup{
+			{Name: "QuantizeVectors", Vars: []any{&QuantizeVectors}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initQuantizeNEON},
+			{Name: "fallback", Supported: true, Init: initQuantizeFallback},
+		},
+	})
+}
+
+func initQuantizeAll() {
+	if hwy.NoSimdEnv() {
+		initQuantizeFallback()
+		return
+	}
+	initQuantizeNEON()
+	return
+}
+
+func initQuantizeNEON() {
+	QuantizeVectors = BaseQuantizeVectors_neon
+}
+
+func initQuantizeFallback() {
+	QuantizeVectors = BaseQuantizeVectors_fallback
+}
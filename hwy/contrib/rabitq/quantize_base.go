@@ -0,0 +1,147 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package rabitq
+
+//go:generate go run ../../../cmd/hwygen -input quantize_base.go -output . -targets avx2,avx512,neon,fallback -dispatch quantize
+
+import (
+	"math/bits"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+// BaseQuantizeVectors quantizes unit vectors into 1-bit codes.
+//
+// For each input unit vector, this function:
+//  1. Extracts sign bits (1 for positive/zero, 0 for negative), a whole
+//     SIMD vector at a time
+//  2. Packs bits into uint64 codes (MSB-first within each uint64)
+//  3. Computes the dot product between the unit vector and its quantized form
+//  4. Counts the number of 1-bits in the code
+//
+// Parameters:
+//   - unitVectors: flattened array of unit vectors (count × dims float32s)
+//   - codes: output buffer for quantization codes (count × width uint64s)
+//   - dotProducts: output buffer for inverted dot products (count float32s)
+//   - codeCounts: output buffer for bit counts (count uint32s)
+//   - sqrtDimsInv: precomputed 1/√dims
+//   - count: number of vectors to process
+//   - dims: dimensions per vector
+//   - width: number of uint64s per code (typically ⌈dims/64⌉)
+//
+// The dotProducts output contains 1/<o̅,o> (inverted) for use in distance estimation.
+// If the dot product is zero (vector equals centroid), dotProducts[i] is set to 0.
+func BaseQuantizeVectors(
+	unitVectors []float32,
+	codes []uint64,
+	dotProducts []float32,
+	codeCounts []uint32,
+	sqrtDimsInv float32,
+	count, dims, width int,
+) {
+	negSqrtDimsInv := -sqrtDimsInv
+
+	lanes := hwy.Zero[float32]().NumLanes()
+	zeroVec := hwy.Zero[float32]()
+	posMultVec := hwy.Set[float32](sqrtDimsInv)
+	negMultVec := hwy.Set[float32](negSqrtDimsInv)
+	// laneMask keeps the low lanes bits of a BitsFromMask result.
+	laneMask := uint64(1)<<uint(lanes) - 1
+
+	for i := range count {
+		vec := unitVectors[i*dims : (i+1)*dims]
+		code := codes[i*width : (i+1)*width]
+
+		var dotProduct float64
+		var codeBits uint64
+		var codeCount uint32
+		codeIdx := 0
+		bitPos := 0
+		dim := 0
+
+		// Process full SIMD vectors. The sign bits of a whole vector are
+		// extracted with one mask-to-bits operation and appended to the code.
+		for dim+lanes <= dims {
+			vecData := hwy.LoadSlice(vec[dim:])
+			negMask := hwy.LessThan(vecData, zeroVec)
+
+			// Compute dot product contribution
+			// If positive: element * sqrtDimsInv
+			// If negative: element * (-sqrtDimsInv)
+			multVec := hwy.IfThenElse(negMask, negMultVec, posMultVec)
+			prodVec := hwy.Mul(vecData, multVec)
+			dotProduct += float64(hwy.ReduceSum(prodVec))
+
+			// BitsFromMask puts lane j in bit j; codes are MSB-first, so the
+			// lane order is reversed before appending. Bits are inverted to
+			// get 1 for positive/zero, 0 for negative.
+			signs := ^hwy.BitsFromMask(negMask) & laneMask
+			codeBits = codeBits<<uint(lanes) | bits.Reverse64(signs)>>uint(64-lanes)
+			bitPos += lanes
+
+			if bitPos == 64 {
+				code[codeIdx] = codeBits
+				codeCount += uint32(bits.OnesCount64(codeBits))
+				codeIdx++
+				codeBits = 0
+				bitPos = 0
+			}
+
+			dim += lanes
+		}
+
+		// Process remaining elements
+		for ; dim < dims; dim++ {
+			element := vec[dim]
+
+			// Compute dot product contribution and pack bit
+			// (1 for positive/zero, 0 for negative)
+			var mult float32
+			var bit uint64
+			if element < 0 {
+				mult = negSqrtDimsInv
+			} else {
+				mult = sqrtDimsInv
+				bit = 1
+			}
+			dotProduct += float64(element) * float64(mult)
+			codeBits = (codeBits << 1) | bit
+			bitPos++
+
+			if bitPos == 64 {
+				code[codeIdx] = codeBits
+				codeCount += uint32(bits.OnesCount64(codeBits))
+				codeIdx++
+				codeBits = 0
+				bitPos = 0
+			}
+		}
+
+		// Handle remaining bits - shift to MSB positions
+		if bitPos > 0 {
+			codeBits = codeBits << (64 - bitPos)
+			code[codeIdx] = codeBits
+			codeCount += uint32(bits.OnesCount64(codeBits))
+		}
+
+		// Store results
+		codeCounts[i] = codeCount
+		if dotProduct != 0 {
+			dotProducts[i] = 1.0 / float32(dotProduct)
+		} else {
+			dotProducts[i] = 0
+		}
+	}
+}
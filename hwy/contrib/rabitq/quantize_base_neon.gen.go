@@ -0,0 +1,81 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package rabitq
+
+import (
+	"math/bits"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/asm"
+)
+
+func BaseQuantizeVectors_neon(unitVectors []float32, codes []uint64, dotProducts []float32, codeCounts []uint32, sqrtDimsInv float32, count int, dims int, width int) {
+	negSqrtDimsInv := -sqrtDimsInv
+	lanes := 4
+	zeroVec := asm.ZeroFloat32x4()
+	posMultVec := asm.BroadcastFloat32x4(sqrtDimsInv)
+	negMultVec := asm.BroadcastFloat32x4(negSqrtDimsInv)
+	laneMask := uint64(1)<<uint(lanes) - 1
+	for i := int(0); i < int(count); i++ {
+		vec := unitVectors[i*dims : (i+1)*dims]
+		code := codes[i*width : (i+1)*width]
+		var dotProduct float64
+		var codeBits uint64
+		var codeCount uint32
+		codeIdx := 0
+		bitPos := 0
+		dim := 0
+		for dim+lanes <= dims {
+			vecData := asm.LoadFloat32x4Slice(vec[dim:])
+			negMask := vecData.LessThan(zeroVec)
+			multVec := asm.IfThenElse(negMask, negMultVec, posMultVec)
+			prodVec := vecData.Mul(multVec)
+			dotProduct += float64(prodVec.ReduceSum())
+			signs := ^hwy.BitsFromMask_NEON_F32x4(negMask) & laneMask
+			codeBits = codeBits<<uint(lanes) | bits.Reverse64(signs)>>uint(64-lanes)
+			bitPos += lanes
+			if bitPos == 64 {
+				code[codeIdx] = codeBits
+				codeCount += uint32(bits.OnesCount64(codeBits))
+				codeIdx++
+				codeBits = 0
+				bitPos = 0
+			}
+			dim += lanes
+		}
+		for ; dim < dims; dim++ {
+			element := vec[dim]
+			var mult float32
+			var bit uint64
+			if element < 0 {
+				mult = negSqrtDimsInv
+			} else {
+				mult = sqrtDimsInv
+				bit = 1
+			}
+			dotProduct += float64(element) * float64(mult)
+			codeBits = (codeBits << 1) | bit
+			bitPos++
+			if bitPos == 64 {
+				code[codeIdx] = codeBits
+				codeCount += uint32(bits.OnesCount64(codeBits))
+				codeIdx++
+				codeBits = 0
+				bitPos = 0
+			}
+		}
+		if bitPos > 0 {
+			codeBits = codeBits << (64 - bitPos)
+			code[codeIdx] = codeBits
+			codeCount += uint32(bits.OnesCount64(codeBits))
+		}
+		codeCounts[i] = codeCount
+		if dotProduct != 0 {
+			dotProducts[i] = 1.0 / float32(dotProduct)
+		} else {
+			dotProducts[i] = 0
+		}
+	}
+}
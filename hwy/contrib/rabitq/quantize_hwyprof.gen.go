@@ -0,0 +1,21 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package rabitq
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("rabitq", "QuantizeVectors", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := QuantizeVectors; hwyImpl != nil {
+			QuantizeVectors = func(unitVectors []float32, codes []uint64, dotProducts []float32, codeCounts []uint32, sqrtDimsInv float32, count int, dims int, width int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(unitVectors, codes, dotProducts, codeCounts, sqrtDimsInv, count, dims, width)
+				hwyCounter.Done(hwyStart, len(unitVectors), hwy.SliceBytes(unitVectors)+hwy.SliceBytes(codes)+hwy.SliceBytes(dotProducts)+hwy.SliceBytes(codeCounts))
+			}
+		}
+	})
+}
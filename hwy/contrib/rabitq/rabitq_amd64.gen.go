@@ -11,10 +11,20 @@ import (
 )
 
 var BitProduct func(code []uint64, q1 []uint64, q2 []uint64, q3 []uint64, q4 []uint64) uint32
-var QuantizeVectors func(unitVectors []float32, codes []uint64, dotProducts []float32, codeCounts []uint32, sqrtDimsInv float32, count int, dims int, width int)
 
 func init() {
 	initRabitqAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "rabitq",
+		Groups: []hwy.DispatchGroup{
+			{Name: "BitProduct", Vars: []any{&BitProduct}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initRabitqAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initRabitqAVX2},
+			{Name: "fallback", Supported: true, Init: initRabitqFallback},
+		},
+	})
 }
 
 func initRabitqAll() {
@@ -35,15 +45,12 @@ func initRabitqAll() {
 
 func initRabitqAVX2() {
 	BitProduct = BaseBitProduct_avx2
-	QuantizeVectors = BaseQuantizeVectors_avx2
 }
 
 func initRabitqAVX512() {
 	BitProduct = BaseBitProduct_avx512
-	QuantizeVectors = BaseQuantizeVectors_avx512
 }
 
 func initRabitqFallback() {
 	BitProduct = BaseBitProduct_fallback
-	QuantizeVectors = BaseQuantizeVectors_fallback
 }
@@ -101,139 +101,6 @@ func BaseBitProduct(code, q1, q2, q3, q4 []uint64) uint32 {
 	return uint32(sum1 + (sum2 << 1) + (sum4 << 2) + (sum8 << 3))
 }
 
-// BaseQuantizeVectors quantizes unit vectors into 1-bit codes.
-//
-// For each input unit vector, this function:
-//  1. Extracts sign bits (1 for positive/zero, 0 for negative)
-//  2. Packs bits into uint64 codes (MSB-first within each uint64)
-//  3. Computes the dot product between the unit vector and its quantized form
-//  4. Counts the number of 1-bits in the code
-//
-// Parameters:
-//   - unitVectors: flattened array of unit vectors (count × dims float32s)
-//   - codes: output buffer for quantization codes (count × width uint64s)
-//   - dotProducts: output buffer for inverted dot products (count float32s)
-//   - codeCounts: output buffer for bit counts (count uint32s)
-//   - sqrtDimsInv: precomputed 1/√dims
-//   - count: number of vectors to process
-//   - dims: dimensions per vector
-//   - width: number of uint64s per code (typically ⌈dims/64⌉)
-//
-// The dotProducts output contains 1/<o̅,o> (inverted) for use in distance estimation.
-// If the dot product is zero (vector equals centroid), dotProducts[i] is set to 0.
-func BaseQuantizeVectors(
-	unitVectors []float32,
-	codes []uint64,
-	dotProducts []float32,
-	codeCounts []uint32,
-	sqrtDimsInv float32,
-	count, dims, width int,
-) {
-	negSqrtDimsInv := -sqrtDimsInv
-
-	for i := range count {
-		vec := unitVectors[i*dims : (i+1)*dims]
-		code := codes[i*width : (i+1)*width]
-
-		var dotProduct float64
-		var codeBits uint64
-		var codeCount uint32
-		codeIdx := 0
-		bitPos := 0
-
-		// Process using SIMD where beneficial
-		lanes := hwy.Zero[float32]().NumLanes()
-		dim := 0
-
-		// Process full SIMD vectors
-		for dim+lanes <= dims {
-			vecData := hwy.LoadSlice(vec[dim:])
-
-			// Get sign bits: 1 if negative, 0 otherwise
-			// We'll compute this by checking if value < 0
-			zeroVec := hwy.Zero[float32]()
-			negMask := hwy.LessThan(vecData, zeroVec)
-
-			// Compute dot product contribution
-			// If positive: element * sqrtDimsInv
-			// If negative: element * (-sqrtDimsInv)
-			posMultVec := hwy.Set[float32](sqrtDimsInv)
-			negMultVec := hwy.Set[float32](negSqrtDimsInv)
-			multVec := hwy.IfThenElse(negMask, negMultVec, posMultVec)
-			prodVec := hwy.Mul(vecData, multVec)
-			dotProduct += float64(hwy.ReduceSum(prodVec))
-
-			// Extract sign bits and pack into code
-			// Sign bit in IEEE 754: bit 31 is 1 for negative
-			// We want: 1 for positive/zero, 0 for negative
-			for j := range lanes {
-				element := hwy.GetLane(vecData, j)
-				signBit := getSignBit(element)
-				// Invert: 1 for positive, 0 for negative
-				codeBits = (codeBits << 1) | uint64(1-signBit)
-				bitPos++
-
-				if bitPos == 64 {
-					code[codeIdx] = codeBits
-					codeCount += uint32(bits.OnesCount64(codeBits))
-					codeIdx++
-					codeBits = 0
-					bitPos = 0
-				}
-			}
-
-			dim += lanes
-		}
-
-		// Process remaining elements
-		for ; dim < dims; dim++ {
-			element := vec[dim]
-			signBit := getSignBit(element)
-
-			// Compute dot product contribution
-			var mult float32
-			if signBit == 1 {
-				mult = negSqrtDimsInv
-			} else {
-				mult = sqrtDimsInv
-			}
-			dotProduct += float64(element) * float64(mult)
-
-			// Pack bit (inverted: 1 for positive, 0 for negative)
-			codeBits = (codeBits << 1) | uint64(1-signBit)
-			bitPos++
-
-			if bitPos == 64 {
-				code[codeIdx] = codeBits
-				codeCount += uint32(bits.OnesCount64(codeBits))
-				codeIdx++
-				codeBits = 0
-				bitPos = 0
-			}
-		}
-
-		// Handle remaining bits - shift to MSB positions
-		if bitPos > 0 {
-			codeBits = codeBits << (64 - bitPos)
-			code[codeIdx] = codeBits
-			codeCount += uint32(bits.OnesCount64(codeBits))
-		}
-
-		// Store results
-		codeCounts[i] = codeCount
-		if dotProduct != 0 {
-			dotProducts[i] = 1.0 / float32(dotProduct)
-		} else {
-			dotProducts[i] = 0
-		}
-	}
-}
-
-// getSignBit returns 1 if the float is negative (including -0), 0 otherwise.
-func getSignBit(f float32) uint32 {
-	return math.Float32bits(f) >> 31
-}
-
 // MultiplySigns returns a float32 with the magnitude of x and a sign
 // that is the product of the signs of x and y.
 // This is equivalent to: sign(x) * sign(y) * |x|
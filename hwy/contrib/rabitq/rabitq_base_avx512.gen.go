@@ -63,73 +63,3 @@ func BaseBitProduct_avx512(code []uint64, q1 []uint64, q2 []uint64, q3 []uint64,
 	}
 	return uint32(sum1 + (sum2 << 1) + (sum4 << 2) + (sum8 << 3))
 }
-
-func BaseQuantizeVectors_avx512(unitVectors []float32, codes []uint64, dotProducts []float32, codeCounts []uint32, sqrtDimsInv float32, count int, dims int, width int) {
-	negSqrtDimsInv := -sqrtDimsInv
-	for i := range count {
-		vec := unitVectors[i*dims : (i+1)*dims]
-		code := codes[i*width : (i+1)*width]
-		var dotProduct float64
-		var codeBits uint64
-		var codeCount uint32
-		codeIdx := 0
-		bitPos := 0
-		lanes := 16
-		dim := 0
-		for dim+lanes <= dims {
-			vecData := archsimd.LoadFloat32x16Slice(vec[dim:])
-			zeroVec := archsimd.BroadcastFloat32x16(0)
-			negMask := vecData.Less(zeroVec)
-			posMultVec := archsimd.BroadcastFloat32x16(sqrtDimsInv)
-			negMultVec := archsimd.BroadcastFloat32x16(negSqrtDimsInv)
-			multVec := hwy.IfThenElse_AVX512_F32x16(negMask, negMultVec, posMultVec)
-			prodVec := vecData.Mul(multVec)
-			dotProduct += float64(hwy.ReduceSum_AVX512_F32x16(prodVec))
-			for j := range lanes {
-				element := hwy.GetLane_AVX512_F32x16(vecData, j)
-				signBit := getSignBit(element)
-				codeBits = (codeBits << 1) | uint64(1-signBit)
-				bitPos++
-				if bitPos == 64 {
-					code[codeIdx] = codeBits
-					codeCount += uint32(bits.OnesCount64(codeBits))
-					codeIdx++
-					codeBits = 0
-					bitPos = 0
-				}
-			}
-			dim += lanes
-		}
-		for ; dim < dims; dim++ {
-			element := vec[dim]
-			signBit := getSignBit(element)
-			var mult float32
-			if signBit == 1 {
-				mult = negSqrtDimsInv
-			} else {
-				mult = sqrtDimsInv
-			}
-			dotProduct += float64(element) * float64(mult)
-			codeBits = (codeBits << 1) | uint64(1-signBit)
-			bitPos++
-			if bitPos == 64 {
-				code[codeIdx] = codeBits
-				codeCount += uint32(bits.OnesCount64(codeBits))
-				codeIdx++
-				codeBits = 0
-				bitPos = 0
-			}
-		}
-		if bitPos > 0 {
-			codeBits = codeBits << (64 - bitPos)
-			code[codeIdx] = codeBits
-			codeCount += uint32(bits.OnesCount64(codeBits))
-		}
-		codeCounts[i] = codeCount
-		if dotProduct != 0 {
-			dotProducts[i] = 1.0 / float32(dotProduct)
-		} else {
-			dotProducts[i] = 0
-		}
-	}
-}
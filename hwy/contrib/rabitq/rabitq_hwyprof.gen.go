@@ -0,0 +1,22 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package rabitq
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("rabitq", "BitProduct", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := BitProduct; hwyImpl != nil {
+			BitProduct = func(code []uint64, q1 []uint64, q2 []uint64, q3 []uint64, q4 []uint64) uint32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(code, q1, q2, q3, q4)
+				hwyCounter.Done(hwyStart, len(code), hwy.SliceBytes(code)+hwy.SliceBytes(q1)+hwy.SliceBytes(q2)+hwy.SliceBytes(q3)+hwy.SliceBytes(q4))
+				return hwyR0
+			}
+		}
+	})
+}
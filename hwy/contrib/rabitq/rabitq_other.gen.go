@@ -4,11 +4,23 @@
 
 package rabitq
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var BitProduct func(code []uint64, q1 []uint64, q2 []uint64, q3 []uint64, q4 []uint64) uint32
-var QuantizeVectors func(unitVectors []float32, codes []uint64, dotProducts []float32, codeCounts []uint32, sqrtDimsInv float32, count int, dims int, width int)
 
 func init() {
 	initRabitqAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "rabitq",
+		Groups: []hwy.DispatchGroup{
+			{Name: "BitProduct", Vars: []any{&BitProduct}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initRabitqFallback},
+		},
+	})
 }
 
 func initRabitqAll() {
@@ -17,5 +29,4 @@ func initRabitqAll() {
 
 func initRabitqFallback() {
 	BitProduct = BaseBitProduct_fallback
-	QuantizeVectors = BaseQuantizeVectors_fallback
 }
@@ -304,6 +304,63 @@ func TestQuantizeVectors_NonAlignedDims(t *testing.T) {
 	}
 }
 
+// quantizeReference is a scalar reference for QuantizeVectors that packs
+// one sign bit at a time.
+func quantizeReference(vec []float32, code []uint64) (invDot float32, count uint32) {
+	clear(code)
+	var dot float64
+	for d, v := range vec {
+		if v < 0 {
+			dot -= float64(v)
+			continue
+		}
+		dot += float64(v)
+		code[d/64] |= 1 << (63 - d%64)
+		count++
+	}
+	dot /= math.Sqrt(float64(len(vec)))
+	if dot == 0 {
+		return 0, count
+	}
+	return float32(1 / dot), count
+}
+
+func TestQuantizeVectors_MatchesReference(t *testing.T) {
+	rng := rand.New(rand.NewPCG(3, 1))
+	const count = 5
+	for _, dims := range []int{1, 3, 4, 8, 15, 16, 31, 64, 65, 100, 128, 200, 768} {
+		width := CodeWidth(dims)
+		unitVectors := make([]float32, count*dims)
+		for i := range unitVectors {
+			unitVectors[i] = float32(rng.NormFloat64())
+		}
+		// Exact zeros of both signs map to bit 1.
+		unitVectors[0] = 0
+		unitVectors[len(unitVectors)-1] = float32(math.Copysign(0, -1))
+
+		codes := make([]uint64, count*width)
+		dotProducts := make([]float32, count)
+		codeCounts := make([]uint32, count)
+		QuantizeVectors(unitVectors, codes, dotProducts, codeCounts, float32(1/math.Sqrt(float64(dims))), count, dims, width)
+
+		want := make([]uint64, width)
+		for i := range count {
+			invDot, cnt := quantizeReference(unitVectors[i*dims:(i+1)*dims], want)
+			for w := range width {
+				if codes[i*width+w] != want[w] {
+					t.Fatalf("dims=%d vector %d word %d: got %016x, want %016x", dims, i, w, codes[i*width+w], want[w])
+				}
+			}
+			if codeCounts[i] != cnt {
+				t.Errorf("dims=%d vector %d: code count %d, want %d", dims, i, codeCounts[i], cnt)
+			}
+			if math.Abs(float64(dotProducts[i]-invDot)) > 1e-4*math.Abs(float64(invDot)) {
+				t.Errorf("dims=%d vector %d: inverted dot %v, want %v", dims, i, dotProducts[i], invDot)
+			}
+		}
+	}
+}
+
 func TestMultiplySigns(t *testing.T) {
 	tests := []struct {
 		x, y, want float32
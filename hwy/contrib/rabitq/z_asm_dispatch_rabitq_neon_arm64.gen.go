@@ -6,5 +6,4 @@ package rabitq
 
 func initRabitqNeonCAsm() {
 	BitProduct = bitProductAsmU64
-	QuantizeVectors = quantizeVectorsAsmF32
 }
@@ -17,6 +17,20 @@ var XorSlice func(dst []uint64, a []uint64, b []uint64)
 
 func init() {
 	initBitwiseAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "roaring",
+		Groups: []hwy.DispatchGroup{
+			{Name: "AndNotSlice", Vars: []any{&AndNotSlice}},
+			{Name: "AndSlice", Vars: []any{&AndSlice}},
+			{Name: "OrSlice", Vars: []any{&OrSlice}},
+			{Name: "XorSlice", Vars: []any{&XorSlice}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initBitwiseAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initBitwiseAVX2},
+			{Name: "fallback", Supported: true, Init: initBitwiseFallback},
+		},
+	})
 }
 
 func initBitwiseAll() {
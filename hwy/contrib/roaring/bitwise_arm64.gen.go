@@ -15,6 +15,19 @@ var XorSlice func(dst []uint64, a []uint64, b []uint64)
 
 func init() {
 	initBitwiseAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "roaring",
+		Groups: []hwy.DispatchGroup{
+			{Name: "AndNotSlice", Vars: []any{&AndNotSlice}},
+			{Name: "AndSlice", Vars: []any{&AndSlice}},
+			{Name: "OrSlice", Vars: []any{&OrSlice}},
+			{Name: "XorSlice", Vars: []any{&XorSlice}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initBitwiseNEONAsm},
+			{Name: "fallback", Supported: true, Init: initBitwiseFallback},
+		},
+	})
 }
 
 func initBitwiseAll() {
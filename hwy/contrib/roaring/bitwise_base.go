@@ -50,6 +50,20 @@ func BaseAndSlice(dst, a, b []uint64) {
 	}
 }
 
+// BaseAndSliceSWAR is the fallback specialization of BaseAndSlice. A
+// uint64 already holds 64 bitmap bits, so a plain word loop is the widest
+// operation available without vector registers.
+//
+//hwy:specializes AndSlice
+//hwy:targets fallback
+func BaseAndSliceSWAR(dst, a, b []uint64) {
+	n := min(len(dst), min(len(a), len(b)))
+	dst, a, b = dst[:n], a[:n], b[:n]
+	for i := range dst {
+		dst[i] = a[i] & b[i]
+	}
+}
+
 // BaseOrSlice computes dst[i] = a[i] | b[i] for all i up to min(len(dst), len(a), len(b)).
 // This is the core operation for bitmap container OR in roaring bitmaps.
 func BaseOrSlice(dst, a, b []uint64) {
@@ -82,6 +96,18 @@ func BaseOrSlice(dst, a, b []uint64) {
 	}
 }
 
+// BaseOrSliceSWAR is the word-at-a-time fallback of BaseOrSlice.
+//
+//hwy:specializes OrSlice
+//hwy:targets fallback
+func BaseOrSliceSWAR(dst, a, b []uint64) {
+	n := min(len(dst), min(len(a), len(b)))
+	dst, a, b = dst[:n], a[:n], b[:n]
+	for i := range dst {
+		dst[i] = a[i] | b[i]
+	}
+}
+
 // BaseXorSlice computes dst[i] = a[i] ^ b[i] for all i up to min(len(dst), len(a), len(b)).
 // This is the core operation for bitmap container XOR in roaring bitmaps.
 func BaseXorSlice(dst, a, b []uint64) {
@@ -114,6 +140,18 @@ func BaseXorSlice(dst, a, b []uint64) {
 	}
 }
 
+// BaseXorSliceSWAR is the word-at-a-time fallback of BaseXorSlice.
+//
+//hwy:specializes XorSlice
+//hwy:targets fallback
+func BaseXorSliceSWAR(dst, a, b []uint64) {
+	n := min(len(dst), min(len(a), len(b)))
+	dst, a, b = dst[:n], a[:n], b[:n]
+	for i := range dst {
+		dst[i] = a[i] ^ b[i]
+	}
+}
+
 // BaseAndNotSlice computes dst[i] = a[i] &^ b[i] for all i up to min(len(dst), len(a), len(b)).
 // This is the core operation for bitmap container ANDNOT in roaring bitmaps.
 // Note: Go's &^ means "a AND (NOT b)".
@@ -147,3 +185,15 @@ func BaseAndNotSlice(dst, a, b []uint64) {
 		dst[i] = a[i] &^ b[i]
 	}
 }
+
+// BaseAndNotSliceSWAR is the word-at-a-time fallback of BaseAndNotSlice.
+//
+//hwy:specializes AndNotSlice
+//hwy:targets fallback
+func BaseAndNotSliceSWAR(dst, a, b []uint64) {
+	n := min(len(dst), min(len(a), len(b)))
+	dst, a, b = dst[:n], a[:n], b[:n]
+	for i := range dst {
+		dst[i] = a[i] &^ b[i]
+	}
+}
@@ -2,110 +2,34 @@
 
 package roaring
 
-import (
-	"github.com/ajroetker/go-highway/hwy"
-)
-
 func BaseAndNotSlice_fallback(dst []uint64, a []uint64, b []uint64) {
 	n := min(len(dst), min(len(a), len(b)))
-	if n == 0 {
-		return
-	}
-	lanes := hwy.Zero[uint64]().NumLanes()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= n; i += stride {
-		a0, a1, a2, a3 := hwy.Load4(a[i:])
-		b0, b1, b2, b3 := hwy.Load4(b[i:])
-		hwy.Store(hwy.AndNot(b0, a0), dst[i:])
-		hwy.Store(hwy.AndNot(b1, a1), dst[i+lanes:])
-		hwy.Store(hwy.AndNot(b2, a2), dst[i+lanes*2:])
-		hwy.Store(hwy.AndNot(b3, a3), dst[i+lanes*3:])
-	}
-	for ; i+lanes <= n; i += lanes {
-		va := hwy.Load(a[i:])
-		vb := hwy.Load(b[i:])
-		hwy.Store(hwy.AndNot(vb, va), dst[i:])
-	}
-	for ; i < n; i++ {
+	dst, a, b = dst[:n], a[:n], b[:n]
+	for i := range dst {
 		dst[i] = a[i] &^ b[i]
 	}
 }
 
 func BaseAndSlice_fallback(dst []uint64, a []uint64, b []uint64) {
 	n := min(len(dst), min(len(a), len(b)))
-	if n == 0 {
-		return
-	}
-	lanes := hwy.Zero[uint64]().NumLanes()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= n; i += stride {
-		a0, a1, a2, a3 := hwy.Load4(a[i:])
-		b0, b1, b2, b3 := hwy.Load4(b[i:])
-		hwy.Store(hwy.And(a0, b0), dst[i:])
-		hwy.Store(hwy.And(a1, b1), dst[i+lanes:])
-		hwy.Store(hwy.And(a2, b2), dst[i+lanes*2:])
-		hwy.Store(hwy.And(a3, b3), dst[i+lanes*3:])
-	}
-	for ; i+lanes <= n; i += lanes {
-		va := hwy.Load(a[i:])
-		vb := hwy.Load(b[i:])
-		hwy.Store(hwy.And(va, vb), dst[i:])
-	}
-	for ; i < n; i++ {
+	dst, a, b = dst[:n], a[:n], b[:n]
+	for i := range dst {
 		dst[i] = a[i] & b[i]
 	}
 }
 
 func BaseOrSlice_fallback(dst []uint64, a []uint64, b []uint64) {
 	n := min(len(dst), min(len(a), len(b)))
-	if n == 0 {
-		return
-	}
-	lanes := hwy.Zero[uint64]().NumLanes()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= n; i += stride {
-		a0, a1, a2, a3 := hwy.Load4(a[i:])
-		b0, b1, b2, b3 := hwy.Load4(b[i:])
-		hwy.Store(hwy.Or(a0, b0), dst[i:])
-		hwy.Store(hwy.Or(a1, b1), dst[i+lanes:])
-		hwy.Store(hwy.Or(a2, b2), dst[i+lanes*2:])
-		hwy.Store(hwy.Or(a3, b3), dst[i+lanes*3:])
-	}
-	for ; i+lanes <= n; i += lanes {
-		va := hwy.Load(a[i:])
-		vb := hwy.Load(b[i:])
-		hwy.Store(hwy.Or(va, vb), dst[i:])
-	}
-	for ; i < n; i++ {
+	dst, a, b = dst[:n], a[:n], b[:n]
+	for i := range dst {
 		dst[i] = a[i] | b[i]
 	}
 }
 
 func BaseXorSlice_fallback(dst []uint64, a []uint64, b []uint64) {
 	n := min(len(dst), min(len(a), len(b)))
-	if n == 0 {
-		return
-	}
-	lanes := hwy.Zero[uint64]().NumLanes()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= n; i += stride {
-		a0, a1, a2, a3 := hwy.Load4(a[i:])
-		b0, b1, b2, b3 := hwy.Load4(b[i:])
-		hwy.Store(hwy.Xor(a0, b0), dst[i:])
-		hwy.Store(hwy.Xor(a1, b1), dst[i+lanes:])
-		hwy.Store(hwy.Xor(a2, b2), dst[i+lanes*2:])
-		hwy.Store(hwy.Xor(a3, b3), dst[i+lanes*3:])
-	}
-	for ; i+lanes <= n; i += lanes {
-		va := hwy.Load(a[i:])
-		vb := hwy.Load(b[i:])
-		hwy.Store(hwy.Xor(va, vb), dst[i:])
-	}
-	for ; i < n; i++ {
+	dst, a, b = dst[:n], a[:n], b[:n]
+	for i := range dst {
 		dst[i] = a[i] ^ b[i]
 	}
 }
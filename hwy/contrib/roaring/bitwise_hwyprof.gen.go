@@ -0,0 +1,48 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package roaring
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("roaring", "AndNotSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := AndNotSlice; hwyImpl != nil {
+			AndNotSlice = func(dst []uint64, a []uint64, b []uint64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+	})
+	hwy.ProfileDispatch("roaring", "AndSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := AndSlice; hwyImpl != nil {
+			AndSlice = func(dst []uint64, a []uint64, b []uint64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+	})
+	hwy.ProfileDispatch("roaring", "OrSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := OrSlice; hwyImpl != nil {
+			OrSlice = func(dst []uint64, a []uint64, b []uint64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+	})
+	hwy.ProfileDispatch("roaring", "XorSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := XorSlice; hwyImpl != nil {
+			XorSlice = func(dst []uint64, a []uint64, b []uint64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+	})
+}
@@ -4,6 +4,10 @@
 
 package roaring
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var AndNotSlice func(dst []uint64, a []uint64, b []uint64)
 var AndSlice func(dst []uint64, a []uint64, b []uint64)
 var OrSlice func(dst []uint64, a []uint64, b []uint64)
@@ -11,6 +15,18 @@ var XorSlice func(dst []uint64, a []uint64, b []uint64)
 
 func init() {
 	initBitwiseAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "roaring",
+		Groups: []hwy.DispatchGroup{
+			{Name: "AndNotSlice", Vars: []any{&AndNotSlice}},
+			{Name: "AndSlice", Vars: []any{&AndSlice}},
+			{Name: "OrSlice", Vars: []any{&OrSlice}},
+			{Name: "XorSlice", Vars: []any{&XorSlice}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initBitwiseFallback},
+		},
+	})
 }
 
 func initBitwiseAll() {
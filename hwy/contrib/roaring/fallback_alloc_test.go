@@ -0,0 +1,65 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package roaring
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		u64 = make([]uint64, allocTestLen)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseAndNotSlice_fallback", func() { BaseAndNotSlice_fallback(u64, u64, u64) }},
+		{"BaseAndSlice_fallback", func() { BaseAndSlice_fallback(u64, u64, u64) }},
+		{"BaseOrSlice_fallback", func() { BaseOrSlice_fallback(u64, u64, u64) }},
+		{"BaseXorSlice_fallback", func() { BaseXorSlice_fallback(u64, u64, u64) }},
+		{"BaseAndNotPopcntSlice_fallback", func() { BaseAndNotPopcntSlice_fallback(u64, u64, u64) }},
+		{"BaseAndPopcntSlice_fallback", func() { BaseAndPopcntSlice_fallback(u64, u64, u64) }},
+		{"BaseOrPopcntSlice_fallback", func() { BaseOrPopcntSlice_fallback(u64, u64, u64) }},
+		{"BaseXorPopcntSlice_fallback", func() { BaseXorPopcntSlice_fallback(u64, u64, u64) }},
+		{"BasePopcntAndNotSlice_fallback", func() { BasePopcntAndNotSlice_fallback(u64, u64) }},
+		{"BasePopcntAndSlice_fallback", func() { BasePopcntAndSlice_fallback(u64, u64) }},
+		{"BasePopcntOrSlice_fallback", func() { BasePopcntOrSlice_fallback(u64, u64) }},
+		{"BasePopcntSlice_fallback", func() { BasePopcntSlice_fallback(u64) }},
+		{"BasePopcntXorSlice_fallback", func() { BasePopcntXorSlice_fallback(u64, u64) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
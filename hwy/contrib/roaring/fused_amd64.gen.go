@@ -17,6 +17,20 @@ var XorPopcntSlice func(dst []uint64, a []uint64, b []uint64) uint64
 
 func init() {
 	initFusedAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "roaring",
+		Groups: []hwy.DispatchGroup{
+			{Name: "AndNotPopcntSlice", Vars: []any{&AndNotPopcntSlice}},
+			{Name: "AndPopcntSlice", Vars: []any{&AndPopcntSlice}},
+			{Name: "OrPopcntSlice", Vars: []any{&OrPopcntSlice}},
+			{Name: "XorPopcntSlice", Vars: []any{&XorPopcntSlice}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initFusedAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initFusedAVX2},
+			{Name: "fallback", Supported: true, Init: initFusedFallback},
+		},
+	})
 }
 
 func initFusedAll() {
@@ -15,6 +15,19 @@ var XorPopcntSlice func(dst []uint64, a []uint64, b []uint64) uint64
 
 func init() {
 	initFusedAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "roaring",
+		Groups: []hwy.DispatchGroup{
+			{Name: "AndNotPopcntSlice", Vars: []any{&AndNotPopcntSlice}},
+			{Name: "AndPopcntSlice", Vars: []any{&AndPopcntSlice}},
+			{Name: "OrPopcntSlice", Vars: []any{&OrPopcntSlice}},
+			{Name: "XorPopcntSlice", Vars: []any{&XorPopcntSlice}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initFusedNEONAsm},
+			{Name: "fallback", Supported: true, Init: initFusedFallback},
+		},
+	})
 }
 
 func initFusedAll() {
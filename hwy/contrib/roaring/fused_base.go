@@ -71,6 +71,24 @@ func BaseAndPopcntSlice(dst, a, b []uint64) uint64 {
 	return result
 }
 
+// BaseAndPopcntSliceSWAR is the fallback specialization of
+// BaseAndPopcntSlice. It streams the slices a word at a time; each result
+// is stored and counted while it is still in a register.
+//
+//hwy:specializes AndPopcntSlice
+//hwy:targets fallback
+func BaseAndPopcntSliceSWAR(dst, a, b []uint64) uint64 {
+	n := min(len(dst), min(len(a), len(b)))
+	dst, a, b = dst[:n], a[:n], b[:n]
+	var count int
+	for i := range dst {
+		v := a[i] & b[i]
+		dst[i] = v
+		count += bits.OnesCount64(v)
+	}
+	return uint64(count)
+}
+
 // BaseOrPopcntSlice computes dst[i] = a[i] | b[i] and returns the total
 // popcount of the result in a single pass.
 func BaseOrPopcntSlice(dst, a, b []uint64) uint64 {
@@ -119,6 +137,22 @@ func BaseOrPopcntSlice(dst, a, b []uint64) uint64 {
 	return result
 }
 
+// BaseOrPopcntSliceSWAR is the word-at-a-time fallback of BaseOrPopcntSlice.
+//
+//hwy:specializes OrPopcntSlice
+//hwy:targets fallback
+func BaseOrPopcntSliceSWAR(dst, a, b []uint64) uint64 {
+	n := min(len(dst), min(len(a), len(b)))
+	dst, a, b = dst[:n], a[:n], b[:n]
+	var count int
+	for i := range dst {
+		v := a[i] | b[i]
+		dst[i] = v
+		count += bits.OnesCount64(v)
+	}
+	return uint64(count)
+}
+
 // BaseXorPopcntSlice computes dst[i] = a[i] ^ b[i] and returns the total
 // popcount of the result in a single pass.
 func BaseXorPopcntSlice(dst, a, b []uint64) uint64 {
@@ -167,6 +201,22 @@ func BaseXorPopcntSlice(dst, a, b []uint64) uint64 {
 	return result
 }
 
+// BaseXorPopcntSliceSWAR is the word-at-a-time fallback of BaseXorPopcntSlice.
+//
+//hwy:specializes XorPopcntSlice
+//hwy:targets fallback
+func BaseXorPopcntSliceSWAR(dst, a, b []uint64) uint64 {
+	n := min(len(dst), min(len(a), len(b)))
+	dst, a, b = dst[:n], a[:n], b[:n]
+	var count int
+	for i := range dst {
+		v := a[i] ^ b[i]
+		dst[i] = v
+		count += bits.OnesCount64(v)
+	}
+	return uint64(count)
+}
+
 // BaseAndNotPopcntSlice computes dst[i] = a[i] &^ b[i] and returns the total
 // popcount of the result in a single pass.
 func BaseAndNotPopcntSlice(dst, a, b []uint64) uint64 {
@@ -216,3 +266,18 @@ func BaseAndNotPopcntSlice(dst, a, b []uint64) uint64 {
 	return result
 }
 
+// BaseAndNotPopcntSliceSWAR is the word-at-a-time fallback of BaseAndNotPopcntSlice.
+//
+//hwy:specializes AndNotPopcntSlice
+//hwy:targets fallback
+func BaseAndNotPopcntSliceSWAR(dst, a, b []uint64) uint64 {
+	n := min(len(dst), min(len(a), len(b)))
+	dst, a, b = dst[:n], a[:n], b[:n]
+	var count int
+	for i := range dst {
+		v := a[i] &^ b[i]
+		dst[i] = v
+		count += bits.OnesCount64(v)
+	}
+	return uint64(count)
+}
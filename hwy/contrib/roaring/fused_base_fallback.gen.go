@@ -4,170 +4,52 @@ package roaring
 
 import (
 	"math/bits"
-
-	"github.com/ajroetker/go-highway/hwy"
 )
 
 func BaseAndNotPopcntSlice_fallback(dst []uint64, a []uint64, b []uint64) uint64 {
 	n := min(len(dst), min(len(a), len(b)))
-	if n == 0 {
-		return 0
-	}
-	lanes := hwy.Zero[uint64]().NumLanes()
-	acc := hwy.Zero[uint64]()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= n; i += stride {
-		a0, a1, a2, a3 := hwy.Load4(a[i:])
-		b0, b1, b2, b3 := hwy.Load4(b[i:])
-		r0 := hwy.AndNot(b0, a0)
-		r1 := hwy.AndNot(b1, a1)
-		r2 := hwy.AndNot(b2, a2)
-		r3 := hwy.AndNot(b3, a3)
-		hwy.Store(r0, dst[i:])
-		hwy.Store(r1, dst[i+lanes:])
-		hwy.Store(r2, dst[i+lanes*2:])
-		hwy.Store(r3, dst[i+lanes*3:])
-		acc = hwy.Add(acc, hwy.PopCount(r0))
-		acc = hwy.Add(acc, hwy.PopCount(r1))
-		acc = hwy.Add(acc, hwy.PopCount(r2))
-		acc = hwy.Add(acc, hwy.PopCount(r3))
-	}
-	for ; i+lanes <= n; i += lanes {
-		va := hwy.Load(a[i:])
-		vb := hwy.Load(b[i:])
-		r := hwy.AndNot(vb, va)
-		hwy.Store(r, dst[i:])
-		acc = hwy.Add(acc, hwy.PopCount(r))
-	}
-	result := uint64(hwy.ReduceSum(acc))
-	for ; i < n; i++ {
+	dst, a, b = dst[:n], a[:n], b[:n]
+	var count int
+	for i := range dst {
 		v := a[i] &^ b[i]
 		dst[i] = v
-		result += uint64(bits.OnesCount64(v))
+		count += bits.OnesCount64(v)
 	}
-	return result
+	return uint64(count)
 }
 
 func BaseAndPopcntSlice_fallback(dst []uint64, a []uint64, b []uint64) uint64 {
 	n := min(len(dst), min(len(a), len(b)))
-	if n == 0 {
-		return 0
-	}
-	lanes := hwy.Zero[uint64]().NumLanes()
-	acc := hwy.Zero[uint64]()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= n; i += stride {
-		a0, a1, a2, a3 := hwy.Load4(a[i:])
-		b0, b1, b2, b3 := hwy.Load4(b[i:])
-		r0 := hwy.And(a0, b0)
-		r1 := hwy.And(a1, b1)
-		r2 := hwy.And(a2, b2)
-		r3 := hwy.And(a3, b3)
-		hwy.Store(r0, dst[i:])
-		hwy.Store(r1, dst[i+lanes:])
-		hwy.Store(r2, dst[i+lanes*2:])
-		hwy.Store(r3, dst[i+lanes*3:])
-		acc = hwy.Add(acc, hwy.PopCount(r0))
-		acc = hwy.Add(acc, hwy.PopCount(r1))
-		acc = hwy.Add(acc, hwy.PopCount(r2))
-		acc = hwy.Add(acc, hwy.PopCount(r3))
-	}
-	for ; i+lanes <= n; i += lanes {
-		va := hwy.Load(a[i:])
-		vb := hwy.Load(b[i:])
-		r := hwy.And(va, vb)
-		hwy.Store(r, dst[i:])
-		acc = hwy.Add(acc, hwy.PopCount(r))
-	}
-	result := uint64(hwy.ReduceSum(acc))
-	for ; i < n; i++ {
+	dst, a, b = dst[:n], a[:n], b[:n]
+	var count int
+	for i := range dst {
 		v := a[i] & b[i]
 		dst[i] = v
-		result += uint64(bits.OnesCount64(v))
+		count += bits.OnesCount64(v)
 	}
-	return result
+	return uint64(count)
 }
 
 func BaseOrPopcntSlice_fallback(dst []uint64, a []uint64, b []uint64) uint64 {
 	n := min(len(dst), min(len(a), len(b)))
-	if n == 0 {
-		return 0
-	}
-	lanes := hwy.Zero[uint64]().NumLanes()
-	acc := hwy.Zero[uint64]()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= n; i += stride {
-		a0, a1, a2, a3 := hwy.Load4(a[i:])
-		b0, b1, b2, b3 := hwy.Load4(b[i:])
-		r0 := hwy.Or(a0, b0)
-		r1 := hwy.Or(a1, b1)
-		r2 := hwy.Or(a2, b2)
-		r3 := hwy.Or(a3, b3)
-		hwy.Store(r0, dst[i:])
-		hwy.Store(r1, dst[i+lanes:])
-		hwy.Store(r2, dst[i+lanes*2:])
-		hwy.Store(r3, dst[i+lanes*3:])
-		acc = hwy.Add(acc, hwy.PopCount(r0))
-		acc = hwy.Add(acc, hwy.PopCount(r1))
-		acc = hwy.Add(acc, hwy.PopCount(r2))
-		acc = hwy.Add(acc, hwy.PopCount(r3))
-	}
-	for ; i+lanes <= n; i += lanes {
-		va := hwy.Load(a[i:])
-		vb := hwy.Load(b[i:])
-		r := hwy.Or(va, vb)
-		hwy.Store(r, dst[i:])
-		acc = hwy.Add(acc, hwy.PopCount(r))
-	}
-	result := uint64(hwy.ReduceSum(acc))
-	for ; i < n; i++ {
+	dst, a, b = dst[:n], a[:n], b[:n]
+	var count int
+	for i := range dst {
 		v := a[i] | b[i]
 		dst[i] = v
-		result += uint64(bits.OnesCount64(v))
+		count += bits.OnesCount64(v)
 	}
-	return result
+	return uint64(count)
 }
 
 func BaseXorPopcntSlice_fallback(dst []uint64, a []uint64, b []uint64) uint64 {
 	n := min(len(dst), min(len(a), len(b)))
-	if n == 0 {
-		return 0
-	}
-	lanes := hwy.Zero[uint64]().NumLanes()
-	acc := hwy.Zero[uint64]()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= n; i += stride {
-		a0, a1, a2, a3 := hwy.Load4(a[i:])
-		b0, b1, b2, b3 := hwy.Load4(b[i:])
-		r0 := hwy.Xor(a0, b0)
-		r1 := hwy.Xor(a1, b1)
-		r2 := hwy.Xor(a2, b2)
-		r3 := hwy.Xor(a3, b3)
-		hwy.Store(r0, dst[i:])
-		hwy.Store(r1, dst[i+lanes:])
-		hwy.Store(r2, dst[i+lanes*2:])
-		hwy.Store(r3, dst[i+lanes*3:])
-		acc = hwy.Add(acc, hwy.PopCount(r0))
-		acc = hwy.Add(acc, hwy.PopCount(r1))
-		acc = hwy.Add(acc, hwy.PopCount(r2))
-		acc = hwy.Add(acc, hwy.PopCount(r3))
-	}
-	for ; i+lanes <= n; i += lanes {
-		va := hwy.Load(a[i:])
-		vb := hwy.Load(b[i:])
-		r := hwy.Xor(va, vb)
-		hwy.Store(r, dst[i:])
-		acc = hwy.Add(acc, hwy.PopCount(r))
-	}
-	result := uint64(hwy.ReduceSum(acc))
-	for ; i < n; i++ {
+	dst, a, b = dst[:n], a[:n], b[:n]
+	var count int
+	for i := range dst {
 		v := a[i] ^ b[i]
 		dst[i] = v
-		result += uint64(bits.OnesCount64(v))
+		count += bits.OnesCount64(v)
 	}
-	return result
+	return uint64(count)
 }
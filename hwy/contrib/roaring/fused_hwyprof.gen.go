@@ -0,0 +1,52 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package roaring
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("roaring", "AndNotPopcntSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := AndNotPopcntSlice; hwyImpl != nil {
+			AndNotPopcntSlice = func(dst []uint64, a []uint64, b []uint64) uint64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("roaring", "AndPopcntSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := AndPopcntSlice; hwyImpl != nil {
+			AndPopcntSlice = func(dst []uint64, a []uint64, b []uint64) uint64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("roaring", "OrPopcntSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := OrPopcntSlice; hwyImpl != nil {
+			OrPopcntSlice = func(dst []uint64, a []uint64, b []uint64) uint64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("roaring", "XorPopcntSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := XorPopcntSlice; hwyImpl != nil {
+			XorPopcntSlice = func(dst []uint64, a []uint64, b []uint64) uint64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+	})
+}
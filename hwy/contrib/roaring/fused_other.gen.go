@@ -4,6 +4,10 @@
 
 package roaring
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var AndNotPopcntSlice func(dst []uint64, a []uint64, b []uint64) uint64
 var AndPopcntSlice func(dst []uint64, a []uint64, b []uint64) uint64
 var OrPopcntSlice func(dst []uint64, a []uint64, b []uint64) uint64
@@ -11,6 +15,18 @@ var XorPopcntSlice func(dst []uint64, a []uint64, b []uint64) uint64
 
 func init() {
 	initFusedAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "roaring",
+		Groups: []hwy.DispatchGroup{
+			{Name: "AndNotPopcntSlice", Vars: []any{&AndNotPopcntSlice}},
+			{Name: "AndPopcntSlice", Vars: []any{&AndPopcntSlice}},
+			{Name: "OrPopcntSlice", Vars: []any{&OrPopcntSlice}},
+			{Name: "XorPopcntSlice", Vars: []any{&XorPopcntSlice}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initFusedFallback},
+		},
+	})
 }
 
 func initFusedAll() {
@@ -62,6 +62,21 @@ func BasePopcntSlice(s []uint64) uint64 {
 	return result
 }
 
+// BasePopcntSliceSWAR is the fallback specialization of BasePopcntSlice.
+// Without vector registers the popcount is done a word at a time with
+// bits.OnesCount64, which is a single instruction where the CPU has one and
+// a SWAR bit count otherwise.
+//
+//hwy:specializes PopcntSlice
+//hwy:targets fallback
+func BasePopcntSliceSWAR(s []uint64) uint64 {
+	var count int
+	for _, v := range s {
+		count += bits.OnesCount64(v)
+	}
+	return uint64(count)
+}
+
 // BasePopcntAndSlice returns the total popcount of the bitwise AND of two slices.
 // This is equivalent to sum(popcount(s[i] & m[i])) for all i.
 func BasePopcntAndSlice(s, m []uint64) uint64 {
@@ -99,6 +114,20 @@ func BasePopcntAndSlice(s, m []uint64) uint64 {
 	return result
 }
 
+// BasePopcntAndSliceSWAR is the word-at-a-time fallback of BasePopcntAndSlice.
+//
+//hwy:specializes PopcntAndSlice
+//hwy:targets fallback
+func BasePopcntAndSliceSWAR(s, m []uint64) uint64 {
+	n := min(len(s), len(m))
+	s, m = s[:n], m[:n]
+	var count int
+	for i := range s {
+		count += bits.OnesCount64(s[i] & m[i])
+	}
+	return uint64(count)
+}
+
 // BasePopcntOrSlice returns the total popcount of the bitwise OR of two slices.
 // This is equivalent to sum(popcount(s[i] | m[i])) for all i.
 func BasePopcntOrSlice(s, m []uint64) uint64 {
@@ -136,6 +165,20 @@ func BasePopcntOrSlice(s, m []uint64) uint64 {
 	return result
 }
 
+// BasePopcntOrSliceSWAR is the word-at-a-time fallback of BasePopcntOrSlice.
+//
+//hwy:specializes PopcntOrSlice
+//hwy:targets fallback
+func BasePopcntOrSliceSWAR(s, m []uint64) uint64 {
+	n := min(len(s), len(m))
+	s, m = s[:n], m[:n]
+	var count int
+	for i := range s {
+		count += bits.OnesCount64(s[i] | m[i])
+	}
+	return uint64(count)
+}
+
 // BasePopcntXorSlice returns the total popcount of the bitwise XOR of two slices.
 // This is equivalent to sum(popcount(s[i] ^ m[i])) for all i.
 func BasePopcntXorSlice(s, m []uint64) uint64 {
@@ -173,6 +216,20 @@ func BasePopcntXorSlice(s, m []uint64) uint64 {
 	return result
 }
 
+// BasePopcntXorSliceSWAR is the word-at-a-time fallback of BasePopcntXorSlice.
+//
+//hwy:specializes PopcntXorSlice
+//hwy:targets fallback
+func BasePopcntXorSliceSWAR(s, m []uint64) uint64 {
+	n := min(len(s), len(m))
+	s, m = s[:n], m[:n]
+	var count int
+	for i := range s {
+		count += bits.OnesCount64(s[i] ^ m[i])
+	}
+	return uint64(count)
+}
+
 // BasePopcntAndNotSlice returns the total popcount of the bitwise ANDNOT of two slices.
 // This is equivalent to sum(popcount(s[i] &^ m[i])) for all i.
 // Note: Go's &^ operator means "s AND (NOT m)".
@@ -211,3 +268,17 @@ func BasePopcntAndNotSlice(s, m []uint64) uint64 {
 	}
 	return result
 }
+
+// BasePopcntAndNotSliceSWAR is the word-at-a-time fallback of BasePopcntAndNotSlice.
+//
+//hwy:specializes PopcntAndNotSlice
+//hwy:targets fallback
+func BasePopcntAndNotSliceSWAR(s, m []uint64) uint64 {
+	n := min(len(s), len(m))
+	s, m = s[:n], m[:n]
+	var count int
+	for i := range s {
+		count += bits.OnesCount64(s[i] &^ m[i])
+	}
+	return uint64(count)
+}
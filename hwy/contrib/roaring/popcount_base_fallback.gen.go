@@ -4,153 +4,52 @@ package roaring
 
 import (
 	"math/bits"
-
-	"github.com/ajroetker/go-highway/hwy"
 )
 
 func BasePopcntAndNotSlice_fallback(s []uint64, m []uint64) uint64 {
 	n := min(len(s), len(m))
-	if n == 0 {
-		return 0
-	}
-	var result uint64
-	lanes := hwy.Zero[uint64]().NumLanes()
-	acc := hwy.Zero[uint64]()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= n; i += stride {
-		s0, s1, s2, s3 := hwy.Load4(s[i:])
-		m0, m1, m2, m3 := hwy.Load4(m[i:])
-		acc = hwy.Add(acc, hwy.PopCount(hwy.AndNot(m0, s0)))
-		acc = hwy.Add(acc, hwy.PopCount(hwy.AndNot(m1, s1)))
-		acc = hwy.Add(acc, hwy.PopCount(hwy.AndNot(m2, s2)))
-		acc = hwy.Add(acc, hwy.PopCount(hwy.AndNot(m3, s3)))
-	}
-	for ; i+lanes <= n; i += lanes {
-		vs := hwy.Load(s[i:])
-		vm := hwy.Load(m[i:])
-		acc = hwy.Add(acc, hwy.PopCount(hwy.AndNot(vm, vs)))
-	}
-	result = uint64(hwy.ReduceSum(acc))
-	for ; i < n; i++ {
-		result += uint64(bits.OnesCount64(s[i] &^ m[i]))
+	s, m = s[:n], m[:n]
+	var count int
+	for i := range s {
+		count += bits.OnesCount64(s[i] &^ m[i])
 	}
-	return result
+	return uint64(count)
 }
 
 func BasePopcntAndSlice_fallback(s []uint64, m []uint64) uint64 {
 	n := min(len(s), len(m))
-	if n == 0 {
-		return 0
+	s, m = s[:n], m[:n]
+	var count int
+	for i := range s {
+		count += bits.OnesCount64(s[i] & m[i])
 	}
-	var result uint64
-	lanes := hwy.Zero[uint64]().NumLanes()
-	acc := hwy.Zero[uint64]()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= n; i += stride {
-		s0, s1, s2, s3 := hwy.Load4(s[i:])
-		m0, m1, m2, m3 := hwy.Load4(m[i:])
-		acc = hwy.Add(acc, hwy.PopCount(hwy.And(s0, m0)))
-		acc = hwy.Add(acc, hwy.PopCount(hwy.And(s1, m1)))
-		acc = hwy.Add(acc, hwy.PopCount(hwy.And(s2, m2)))
-		acc = hwy.Add(acc, hwy.PopCount(hwy.And(s3, m3)))
-	}
-	for ; i+lanes <= n; i += lanes {
-		vs := hwy.Load(s[i:])
-		vm := hwy.Load(m[i:])
-		acc = hwy.Add(acc, hwy.PopCount(hwy.And(vs, vm)))
-	}
-	result = uint64(hwy.ReduceSum(acc))
-	for ; i < n; i++ {
-		result += uint64(bits.OnesCount64(s[i] & m[i]))
-	}
-	return result
+	return uint64(count)
 }
 
 func BasePopcntOrSlice_fallback(s []uint64, m []uint64) uint64 {
 	n := min(len(s), len(m))
-	if n == 0 {
-		return 0
-	}
-	var result uint64
-	lanes := hwy.Zero[uint64]().NumLanes()
-	acc := hwy.Zero[uint64]()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= n; i += stride {
-		s0, s1, s2, s3 := hwy.Load4(s[i:])
-		m0, m1, m2, m3 := hwy.Load4(m[i:])
-		acc = hwy.Add(acc, hwy.PopCount(hwy.Or(s0, m0)))
-		acc = hwy.Add(acc, hwy.PopCount(hwy.Or(s1, m1)))
-		acc = hwy.Add(acc, hwy.PopCount(hwy.Or(s2, m2)))
-		acc = hwy.Add(acc, hwy.PopCount(hwy.Or(s3, m3)))
+	s, m = s[:n], m[:n]
+	var count int
+	for i := range s {
+		count += bits.OnesCount64(s[i] | m[i])
 	}
-	for ; i+lanes <= n; i += lanes {
-		vs := hwy.Load(s[i:])
-		vm := hwy.Load(m[i:])
-		acc = hwy.Add(acc, hwy.PopCount(hwy.Or(vs, vm)))
-	}
-	result = uint64(hwy.ReduceSum(acc))
-	for ; i < n; i++ {
-		result += uint64(bits.OnesCount64(s[i] | m[i]))
-	}
-	return result
+	return uint64(count)
 }
 
 func BasePopcntSlice_fallback(s []uint64) uint64 {
-	if len(s) == 0 {
-		return 0
-	}
-	var result uint64
-	lanes := hwy.Zero[uint64]().NumLanes()
-	acc := hwy.Zero[uint64]()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= len(s); i += stride {
-		v0, v1, v2, v3 := hwy.Load4(s[i:])
-		acc = hwy.Add(acc, hwy.PopCount(v0))
-		acc = hwy.Add(acc, hwy.PopCount(v1))
-		acc = hwy.Add(acc, hwy.PopCount(v2))
-		acc = hwy.Add(acc, hwy.PopCount(v3))
-	}
-	for ; i+lanes <= len(s); i += lanes {
-		v := hwy.Load(s[i:])
-		acc = hwy.Add(acc, hwy.PopCount(v))
+	var count int
+	for _, v := range s {
+		count += bits.OnesCount64(v)
 	}
-	result = uint64(hwy.ReduceSum(acc))
-	for ; i < len(s); i++ {
-		result += uint64(bits.OnesCount64(s[i]))
-	}
-	return result
+	return uint64(count)
 }
 
 func BasePopcntXorSlice_fallback(s []uint64, m []uint64) uint64 {
 	n := min(len(s), len(m))
-	if n == 0 {
-		return 0
-	}
-	var result uint64
-	lanes := hwy.Zero[uint64]().NumLanes()
-	acc := hwy.Zero[uint64]()
-	stride := lanes * 4
-	var i int
-	for i = 0; i+stride <= n; i += stride {
-		s0, s1, s2, s3 := hwy.Load4(s[i:])
-		m0, m1, m2, m3 := hwy.Load4(m[i:])
-		acc = hwy.Add(acc, hwy.PopCount(hwy.Xor(s0, m0)))
-		acc = hwy.Add(acc, hwy.PopCount(hwy.Xor(s1, m1)))
-		acc = hwy.Add(acc, hwy.PopCount(hwy.Xor(s2, m2)))
-		acc = hwy.Add(acc, hwy.PopCount(hwy.Xor(s3, m3)))
-	}
-	for ; i+lanes <= n; i += lanes {
-		vs := hwy.Load(s[i:])
-		vm := hwy.Load(m[i:])
-		acc = hwy.Add(acc, hwy.PopCount(hwy.Xor(vs, vm)))
-	}
-	result = uint64(hwy.ReduceSum(acc))
-	for ; i < n; i++ {
-		result += uint64(bits.OnesCount64(s[i] ^ m[i]))
+	s, m = s[:n], m[:n]
+	var count int
+	for i := range s {
+		count += bits.OnesCount64(s[i] ^ m[i])
 	}
-	return result
+	return uint64(count)
 }
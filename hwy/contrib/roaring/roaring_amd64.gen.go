@@ -18,6 +18,21 @@ var PopcntXorSlice func(s []uint64, m []uint64) uint64
 
 func init() {
 	initRoaringAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "roaring",
+		Groups: []hwy.DispatchGroup{
+			{Name: "PopcntAndNotSlice", Vars: []any{&PopcntAndNotSlice}},
+			{Name: "PopcntAndSlice", Vars: []any{&PopcntAndSlice}},
+			{Name: "PopcntOrSlice", Vars: []any{&PopcntOrSlice}},
+			{Name: "PopcntSlice", Vars: []any{&PopcntSlice}},
+			{Name: "PopcntXorSlice", Vars: []any{&PopcntXorSlice}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initRoaringAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initRoaringAVX2},
+			{Name: "fallback", Supported: true, Init: initRoaringFallback},
+		},
+	})
 }
 
 func initRoaringAll() {
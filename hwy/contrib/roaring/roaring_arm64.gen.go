@@ -16,6 +16,20 @@ var PopcntXorSlice func(s []uint64, m []uint64) uint64
 
 func init() {
 	initRoaringAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "roaring",
+		Groups: []hwy.DispatchGroup{
+			{Name: "PopcntAndNotSlice", Vars: []any{&PopcntAndNotSlice}},
+			{Name: "PopcntAndSlice", Vars: []any{&PopcntAndSlice}},
+			{Name: "PopcntOrSlice", Vars: []any{&PopcntOrSlice}},
+			{Name: "PopcntSlice", Vars: []any{&PopcntSlice}},
+			{Name: "PopcntXorSlice", Vars: []any{&PopcntXorSlice}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initRoaringNEONAsm},
+			{Name: "fallback", Supported: true, Init: initRoaringFallback},
+		},
+	})
 }
 
 func initRoaringAll() {
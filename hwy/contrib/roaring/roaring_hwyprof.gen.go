@@ -0,0 +1,62 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package roaring
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("roaring", "PopcntAndNotSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PopcntAndNotSlice; hwyImpl != nil {
+			PopcntAndNotSlice = func(s []uint64, m []uint64) uint64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(s, m)
+				hwyCounter.Done(hwyStart, len(s), hwy.SliceBytes(s)+hwy.SliceBytes(m))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("roaring", "PopcntAndSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PopcntAndSlice; hwyImpl != nil {
+			PopcntAndSlice = func(s []uint64, m []uint64) uint64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(s, m)
+				hwyCounter.Done(hwyStart, len(s), hwy.SliceBytes(s)+hwy.SliceBytes(m))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("roaring", "PopcntOrSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PopcntOrSlice; hwyImpl != nil {
+			PopcntOrSlice = func(s []uint64, m []uint64) uint64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(s, m)
+				hwyCounter.Done(hwyStart, len(s), hwy.SliceBytes(s)+hwy.SliceBytes(m))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("roaring", "PopcntSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PopcntSlice; hwyImpl != nil {
+			PopcntSlice = func(s []uint64) uint64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(s)
+				hwyCounter.Done(hwyStart, len(s), hwy.SliceBytes(s))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("roaring", "PopcntXorSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PopcntXorSlice; hwyImpl != nil {
+			PopcntXorSlice = func(s []uint64, m []uint64) uint64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(s, m)
+				hwyCounter.Done(hwyStart, len(s), hwy.SliceBytes(s)+hwy.SliceBytes(m))
+				return hwyR0
+			}
+		}
+	})
+}
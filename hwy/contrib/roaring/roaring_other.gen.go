@@ -4,6 +4,10 @@
 
 package roaring
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var PopcntAndNotSlice func(s []uint64, m []uint64) uint64
 var PopcntAndSlice func(s []uint64, m []uint64) uint64
 var PopcntOrSlice func(s []uint64, m []uint64) uint64
@@ -12,6 +16,19 @@ var PopcntXorSlice func(s []uint64, m []uint64) uint64
 
 func init() {
 	initRoaringAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "roaring",
+		Groups: []hwy.DispatchGroup{
+			{Name: "PopcntAndNotSlice", Vars: []any{&PopcntAndNotSlice}},
+			{Name: "PopcntAndSlice", Vars: []any{&PopcntAndSlice}},
+			{Name: "PopcntOrSlice", Vars: []any{&PopcntOrSlice}},
+			{Name: "PopcntSlice", Vars: []any{&PopcntSlice}},
+			{Name: "PopcntXorSlice", Vars: []any{&PopcntXorSlice}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initRoaringFallback},
+		},
+	})
 }
 
 func initRoaringAll() {
@@ -25,7 +25,7 @@ func andNotPopcntSliceAsmU64(dst, a, b []uint64) uint64 {
 	}
 	lenVal := int64(min(len(dst), min(len(a), len(b))))
 	if lenVal == 0 {
-		return 0
+		return BaseAndNotPopcntSlice_fallback(dst, a, b)
 	}
 	var out_result int64
 	asm.AndNotPopcntSlice_U64(
@@ -53,7 +53,7 @@ func andPopcntSliceAsmU64(dst, a, b []uint64) uint64 {
 	}
 	lenVal := int64(min(len(dst), min(len(a), len(b))))
 	if lenVal == 0 {
-		return 0
+		return BaseAndPopcntSlice_fallback(dst, a, b)
 	}
 	var out_result int64
 	asm.AndPopcntSlice_U64(
@@ -81,7 +81,7 @@ func orPopcntSliceAsmU64(dst, a, b []uint64) uint64 {
 	}
 	lenVal := int64(min(len(dst), min(len(a), len(b))))
 	if lenVal == 0 {
-		return 0
+		return BaseOrPopcntSlice_fallback(dst, a, b)
 	}
 	var out_result int64
 	asm.OrPopcntSlice_U64(
@@ -109,7 +109,7 @@ func xorPopcntSliceAsmU64(dst, a, b []uint64) uint64 {
 	}
 	lenVal := int64(min(len(dst), min(len(a), len(b))))
 	if lenVal == 0 {
-		return 0
+		return BaseXorPopcntSlice_fallback(dst, a, b)
 	}
 	var out_result int64
 	asm.XorPopcntSlice_U64(
@@ -21,7 +21,7 @@ func popcntAndNotSliceAsmU64(s, m []uint64) uint64 {
 	}
 	lenVal := int64(min(len(s), len(m)))
 	if lenVal == 0 {
-		return 0
+		return BasePopcntAndNotSlice_fallback(s, m)
 	}
 	var out_result int64
 	asm.PopcntAndNotSlice_U64(
@@ -44,7 +44,7 @@ func popcntAndSliceAsmU64(s, m []uint64) uint64 {
 	}
 	lenVal := int64(min(len(s), len(m)))
 	if lenVal == 0 {
-		return 0
+		return BasePopcntAndSlice_fallback(s, m)
 	}
 	var out_result int64
 	asm.PopcntAndSlice_U64(
@@ -67,7 +67,7 @@ func popcntOrSliceAsmU64(s, m []uint64) uint64 {
 	}
 	lenVal := int64(min(len(s), len(m)))
 	if lenVal == 0 {
-		return 0
+		return BasePopcntOrSlice_fallback(s, m)
 	}
 	var out_result int64
 	asm.PopcntOrSlice_U64(
@@ -86,7 +86,7 @@ func popcntSliceAsmU64(s []uint64) uint64 {
 	}
 	lenVal := int64(len(s))
 	if lenVal == 0 {
-		return 0
+		return BasePopcntSlice_fallback(s)
 	}
 	var out_result int64
 	asm.PopcntSlice_U64(
@@ -108,7 +108,7 @@ func popcntXorSliceAsmU64(s, m []uint64) uint64 {
 	}
 	lenVal := int64(min(len(s), len(m)))
 	if lenVal == 0 {
-		return 0
+		return BasePopcntXorSlice_fallback(s, m)
 	}
 	var out_result int64
 	asm.PopcntXorSlice_U64(
@@ -0,0 +1,145 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/sort/asm/baseissorted_c_f32_avx512_amd64.c
+
+TEXT ·issorted_c_f32_avx512(SB), $0-24
+	MOVQ data+0(FP), DI
+	MOVQ plen_data+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x0e     // movq	(%rsi), %rcx
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	WORD $0xf631                 // xorl	%esi, %esi
+	LONG $0x01f98348             // cmpq	$1, %rcx
+	JLE  BB0_2
+
+BB0_3:
+	LONG $0x10468d48                           // leaq	16(%rsi), %rax
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JGE  BB0_39
+	QUAD $0xff875410487cf162                   // vmovups	-64(%rdi,%rax,4), %zmm2
+	QUAD $0xc48784c2486cf162; LONG $0x1effffff // vcmpps	$30, -60(%rdi,%rax,4), %zmm2, %k0
+	LONG $0xc098f8c5                           // kortestw	%k0, %k0
+	JE   BB0_40
+
+BB0_36:
+	WORD $0xc031             // xorl	%eax, %eax
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_2:
+	WORD $0x8948; BYTE $0x02 // movq	%rax, (%rdx)
+	RET
+
+BB0_39:
+	LONG $0x01e98348               // subq	$1, %rcx
+	WORD $0x3948; BYTE $0xce       // cmpq	%rcx, %rsi
+	JGE  BB0_37
+	QUAD $0x00000000b5048d48       // leaq	0(,%rsi,4), %rax
+	LONG $0x0c10fac5; BYTE $0xb7   // vmovss	(%rdi,%rsi,4), %xmm1
+	LONG $0x4410fac5; WORD $0x0407 // vmovss	4(%rdi,%rax), %xmm0
+	LONG $0xc82ff8c5               // vcomiss	%xmm0, %xmm1
+	JA   BB0_36
+	LONG $0x01468d4c               // leaq	1(%rsi), %r8
+	WORD $0x3949; BYTE $0xc8       // cmpq	%rcx, %r8
+	JGE  BB0_37
+	LONG $0x4c10fac5; WORD $0x0807 // vmovss	8(%rdi,%rax), %xmm1
+	LONG $0xc12ff8c5               // vcomiss	%xmm1, %xmm0
+	JA   BB0_36
+	LONG $0x02468d4c               // leaq	2(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4410fac5; WORD $0x0c07 // vmovss	12(%rdi,%rax), %xmm0
+	LONG $0xc82ff8c5               // vcomiss	%xmm0, %xmm1
+	JA   BB0_36
+	LONG $0x03468d4c               // leaq	3(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4c10fac5; WORD $0x1007 // vmovss	16(%rdi,%rax), %xmm1
+	LONG $0xc12ff8c5               // vcomiss	%xmm1, %xmm0
+	JA   BB0_36
+	LONG $0x04468d4c               // leaq	4(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4410fac5; WORD $0x1407 // vmovss	20(%rdi,%rax), %xmm0
+	LONG $0xc82ff8c5               // vcomiss	%xmm0, %xmm1
+	JA   BB0_36
+	LONG $0x05468d4c               // leaq	5(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4c10fac5; WORD $0x1807 // vmovss	24(%rdi,%rax), %xmm1
+	LONG $0xc12ff8c5               // vcomiss	%xmm1, %xmm0
+	JA   BB0_36
+	LONG $0x06468d4c               // leaq	6(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4410fac5; WORD $0x1c07 // vmovss	28(%rdi,%rax), %xmm0
+	LONG $0xc82ff8c5               // vcomiss	%xmm0, %xmm1
+	JA   BB0_36
+	LONG $0x07468d4c               // leaq	7(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4c10fac5; WORD $0x2007 // vmovss	32(%rdi,%rax), %xmm1
+	LONG $0xc12ff8c5               // vcomiss	%xmm1, %xmm0
+	JA   BB0_36
+	LONG $0x08468d4c               // leaq	8(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4410fac5; WORD $0x2407 // vmovss	36(%rdi,%rax), %xmm0
+	LONG $0xc82ff8c5               // vcomiss	%xmm0, %xmm1
+	JA   BB0_36
+	LONG $0x09468d4c               // leaq	9(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4c10fac5; WORD $0x2807 // vmovss	40(%rdi,%rax), %xmm1
+	LONG $0xc12ff8c5               // vcomiss	%xmm1, %xmm0
+	JA   BB0_36
+	LONG $0x0a468d4c               // leaq	10(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4410fac5; WORD $0x2c07 // vmovss	44(%rdi,%rax), %xmm0
+	LONG $0xc82ff8c5               // vcomiss	%xmm0, %xmm1
+	JA   BB0_36
+	LONG $0x0b468d4c               // leaq	11(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4c10fac5; WORD $0x3007 // vmovss	48(%rdi,%rax), %xmm1
+	LONG $0xc12ff8c5               // vcomiss	%xmm1, %xmm0
+	JA   BB0_36
+	LONG $0x0c468d4c               // leaq	12(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4410fac5; WORD $0x3407 // vmovss	52(%rdi,%rax), %xmm0
+	LONG $0xc82ff8c5               // vcomiss	%xmm0, %xmm1
+	JA   BB0_36
+	LONG $0x0d468d4c               // leaq	13(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4c10fac5; WORD $0x3807 // vmovss	56(%rdi,%rax), %xmm1
+	LONG $0xc12ff8c5               // vcomiss	%xmm1, %xmm0
+	JA   BB0_36
+	LONG $0x0e468d4c               // leaq	14(%rsi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_37
+	LONG $0x4410fac5; WORD $0x3c07 // vmovss	60(%rdi,%rax), %xmm0
+	LONG $0xc82ff8c5               // vcomiss	%xmm0, %xmm1
+	JA   BB0_36
+	LONG $0x0fc68348               // addq	$15, %rsi
+	WORD $0x3948; BYTE $0xf1       // cmpq	%rsi, %rcx
+	JLE  BB0_37
+	LONG $0x442ef8c5; WORD $0x4007 // vucomiss	64(%rdi,%rax), %xmm0
+	WORD $0x960f; BYTE $0xc0       // setbe	%al
+	WORD $0xb60f; BYTE $0xc0       // movzbl	%al, %eax
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	JMP  BB0_2
+
+BB0_37:
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	JMP  BB0_2
+
+BB0_40:
+	WORD $0x8948; BYTE $0xc6 // movq	%rax, %rsi
+	JMP  BB0_3
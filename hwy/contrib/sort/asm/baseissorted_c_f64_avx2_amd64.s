@@ -0,0 +1,75 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/sort/asm/baseissorted_c_f64_avx2_amd64.c
+
+TEXT ·issorted_c_f64_avx2(SB), $0-24
+	MOVQ data+0(FP), DI
+	MOVQ plen_data+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x0e     // movq	(%rsi), %rcx
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0x000001be; BYTE $0x00 // movl	$1, %esi
+	WORD $0xff31                 // xorl	%edi, %edi
+	LONG $0x01f98348             // cmpq	$1, %rcx
+	JLE  BB0_2
+
+BB0_3:
+	LONG $0x04778d48                           // leaq	4(%rdi), %rsi
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JGE  BB0_15
+	LONG $0x5410fdc5; WORD $0xe0f0             // vmovupd	-32(%rax,%rsi,8), %ymm2
+	LONG $0x44c2edc5; WORD $0xe8f0; BYTE $0x1e // vcmppd	$30, -24(%rax,%rsi,8), %ymm2, %ymm0
+	LONG $0xf850fdc5                           // vmovmskpd	%ymm0, %edi
+	WORD $0xff85                               // testl	%edi, %edi
+	JE   BB0_16
+
+BB0_12:
+	WORD $0xf631             // xorl	%esi, %esi
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_2:
+	WORD $0x8948; BYTE $0x32 // movq	%rsi, (%rdx)
+	RET
+
+BB0_15:
+	LONG $0x01e98348               // subq	$1, %rcx
+	WORD $0x3948; BYTE $0xcf       // cmpq	%rcx, %rdi
+	JGE  BB0_13
+	QUAD $0x00000000fd348d48       // leaq	0(,%rdi,8), %rsi
+	LONG $0x0c10fbc5; BYTE $0xf8   // vmovsd	(%rax,%rdi,8), %xmm1
+	LONG $0x4410fbc5; WORD $0x0830 // vmovsd	8(%rax,%rsi), %xmm0
+	LONG $0xc82ff9c5               // vcomisd	%xmm0, %xmm1
+	JA   BB0_12
+	LONG $0x01478d4c               // leaq	1(%rdi), %r8
+	WORD $0x3949; BYTE $0xc8       // cmpq	%rcx, %r8
+	JGE  BB0_13
+	LONG $0x4c10fbc5; WORD $0x1030 // vmovsd	16(%rax,%rsi), %xmm1
+	LONG $0xc12ff9c5               // vcomisd	%xmm1, %xmm0
+	JA   BB0_12
+	LONG $0x02478d4c               // leaq	2(%rdi), %r8
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_13
+	LONG $0x4410fbc5; WORD $0x1830 // vmovsd	24(%rax,%rsi), %xmm0
+	LONG $0xc82ff9c5               // vcomisd	%xmm0, %xmm1
+	JA   BB0_12
+	LONG $0x03c78348               // addq	$3, %rdi
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_13
+	LONG $0x442ef9c5; WORD $0x2030 // vucomisd	32(%rax,%rsi), %xmm0
+	LONG $0xc6960f40               // setbe	%sil
+	LONG $0xf6b60f40               // movzbl	%sil, %esi
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	JMP  BB0_2
+
+BB0_16:
+	WORD $0x8948; BYTE $0xf7 // movq	%rsi, %rdi
+	JMP  BB0_3
+
+BB0_13:
+	LONG $0x000001be; BYTE $0x00 // movl	$1, %esi
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	JMP  BB0_2
@@ -0,0 +1,97 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/sort/asm/baseissorted_c_f64_avx512_amd64.c
+
+TEXT ·issorted_c_f64_avx512(SB), $0-24
+	MOVQ data+0(FP), DI
+	MOVQ plen_data+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x06     // movq	(%rsi), %rax
+	LONG $0x000001b9; BYTE $0x00 // movl	$1, %ecx
+	WORD $0xf631                 // xorl	%esi, %esi
+	LONG $0x01f88348             // cmpq	$1, %rax
+	JLE  BB0_2
+
+BB0_3:
+	LONG $0x084e8d48                           // leaq	8(%rsi), %rcx
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JGE  BB0_23
+	QUAD $0xffcf541048fdf162                   // vmovupd	-64(%rdi,%rcx,8), %zmm2
+	QUAD $0xc8cf84c248edf162; LONG $0x1effffff // vcmppd	$30, -56(%rdi,%rcx,8), %zmm2, %k0
+	LONG $0xc098f9c5                           // kortestb	%k0, %k0
+	JE   BB0_24
+
+BB0_20:
+	WORD $0xc931             // xorl	%ecx, %ecx
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_2:
+	WORD $0x8948; BYTE $0x0a // movq	%rcx, (%rdx)
+	RET
+
+BB0_23:
+	LONG $0x01e88348               // subq	$1, %rax
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JGE  BB0_21
+	QUAD $0x00000000f50c8d48       // leaq	0(,%rsi,8), %rcx
+	LONG $0x0c10fbc5; BYTE $0xf7   // vmovsd	(%rdi,%rsi,8), %xmm1
+	LONG $0x4410fbc5; WORD $0x080f // vmovsd	8(%rdi,%rcx), %xmm0
+	LONG $0xc82ff9c5               // vcomisd	%xmm0, %xmm1
+	JA   BB0_20
+	LONG $0x01468d4c               // leaq	1(%rsi), %r8
+	WORD $0x3949; BYTE $0xc0       // cmpq	%rax, %r8
+	JGE  BB0_21
+	LONG $0x4c10fbc5; WORD $0x100f // vmovsd	16(%rdi,%rcx), %xmm1
+	LONG $0xc12ff9c5               // vcomisd	%xmm1, %xmm0
+	JA   BB0_20
+	LONG $0x02468d4c               // leaq	2(%rsi), %r8
+	WORD $0x394c; BYTE $0xc0       // cmpq	%r8, %rax
+	JLE  BB0_21
+	LONG $0x4410fbc5; WORD $0x180f // vmovsd	24(%rdi,%rcx), %xmm0
+	LONG $0xc82ff9c5               // vcomisd	%xmm0, %xmm1
+	JA   BB0_20
+	LONG $0x03468d4c               // leaq	3(%rsi), %r8
+	WORD $0x394c; BYTE $0xc0       // cmpq	%r8, %rax
+	JLE  BB0_21
+	LONG $0x4c10fbc5; WORD $0x200f // vmovsd	32(%rdi,%rcx), %xmm1
+	LONG $0xc12ff9c5               // vcomisd	%xmm1, %xmm0
+	JA   BB0_20
+	LONG $0x04468d4c               // leaq	4(%rsi), %r8
+	WORD $0x394c; BYTE $0xc0       // cmpq	%r8, %rax
+	JLE  BB0_21
+	LONG $0x4410fbc5; WORD $0x280f // vmovsd	40(%rdi,%rcx), %xmm0
+	LONG $0xc82ff9c5               // vcomisd	%xmm0, %xmm1
+	JA   BB0_20
+	LONG $0x05468d4c               // leaq	5(%rsi), %r8
+	WORD $0x394c; BYTE $0xc0       // cmpq	%r8, %rax
+	JLE  BB0_21
+	LONG $0x4c10fbc5; WORD $0x300f // vmovsd	48(%rdi,%rcx), %xmm1
+	LONG $0xc12ff9c5               // vcomisd	%xmm1, %xmm0
+	JA   BB0_20
+	LONG $0x06468d4c               // leaq	6(%rsi), %r8
+	WORD $0x394c; BYTE $0xc0       // cmpq	%r8, %rax
+	JLE  BB0_21
+	LONG $0x4410fbc5; WORD $0x380f // vmovsd	56(%rdi,%rcx), %xmm0
+	LONG $0xc82ff9c5               // vcomisd	%xmm0, %xmm1
+	JA   BB0_20
+	LONG $0x07c68348               // addq	$7, %rsi
+	WORD $0x3948; BYTE $0xf0       // cmpq	%rsi, %rax
+	JLE  BB0_21
+	LONG $0x442ef9c5; WORD $0x400f // vucomisd	64(%rdi,%rcx), %xmm0
+	WORD $0x960f; BYTE $0xc1       // setbe	%cl
+	WORD $0xb60f; BYTE $0xc9       // movzbl	%cl, %ecx
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	JMP  BB0_2
+
+BB0_24:
+	WORD $0x8948; BYTE $0xce // movq	%rcx, %rsi
+	JMP  BB0_3
+
+BB0_21:
+	LONG $0x000001b9; BYTE $0x00 // movl	$1, %ecx
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	JMP  BB0_2
@@ -0,0 +1,19 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import (
+	"unsafe"
+)
+
+// IsSorted_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func IsSorted_AVX2_F32(data unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	issorted_c_f32_avx2(data, plen, pout_result)
+}
+
+// IsSorted_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func IsSorted_AVX2_F64(data unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	issorted_c_f64_avx2(data, plen, pout_result)
+}
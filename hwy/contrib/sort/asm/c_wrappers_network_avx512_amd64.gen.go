@@ -0,0 +1,48 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import (
+	"unsafe"
+)
+
+// Public wrapper functions
+// IsSortedCAVX512F32 computes IsSorted using AVX512 SIMD assembly.
+func IsSortedCAVX512F32(data []float32) bool {
+	lenVal := int64(len(data))
+	if lenVal == 0 {
+		return false
+	}
+	var p_data unsafe.Pointer
+	if len(data) > 0 {
+		p_data = unsafe.Pointer(&data[0])
+	}
+	var out_result int64
+	issorted_c_f32_avx512(
+		p_data,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return out_result != 0
+}
+
+// IsSortedCAVX512F64 computes IsSorted using AVX512 SIMD assembly.
+func IsSortedCAVX512F64(data []float64) bool {
+	lenVal := int64(len(data))
+	if lenVal == 0 {
+		return false
+	}
+	var p_data unsafe.Pointer
+	if len(data) > 0 {
+		p_data = unsafe.Pointer(&data[0])
+	}
+	var out_result int64
+	issorted_c_f64_avx512(
+		p_data,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return out_result != 0
+}
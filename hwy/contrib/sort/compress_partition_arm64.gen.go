@@ -81,6 +81,17 @@ func CompressPartition3Way[T hwy.Lanes](data []T, pivot T) (int, int) {
 
 func init() {
 	initCompress_partitionAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "sort",
+		Groups: []hwy.DispatchGroup{
+			{Name: "CompressPartition", Vars: []any{&CompressPartitionFloat32, &CompressPartitionFloat64, &CompressPartitionInt32, &CompressPartitionInt64, &CompressPartitionUint32, &CompressPartitionUint64}},
+			{Name: "CompressPartition3Way", Vars: []any{&CompressPartition3WayFloat32, &CompressPartition3WayFloat64, &CompressPartition3WayInt32, &CompressPartition3WayInt64, &CompressPartition3WayUint32, &CompressPartition3WayUint64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initCompress_partitionNEON},
+			{Name: "fallback", Supported: true, Init: initCompress_partitionFallback},
+		},
+	})
 }
 
 func initCompress_partitionAll() {
@@ -73,9 +73,10 @@ func BaseCompressPartition[T hwy.Lanes](data []T, pivot T) int {
 	pivotVec := hwy.Set(pivot)
 
 	// Preload kUnroll vectors from each end to avoid overwriting unread data
-	// We store them in a buffer and process after the main loop
-	preloadL := make([]T, preloadSize)
-	preloadR := make([]T, preloadSize)
+	// We store them in a buffer and process after the main loop. A vector has
+	// at most 64 lanes; the constant capacity keeps the buffers on the stack.
+	preloadL := make([]T, preloadSize, 4*64)
+	preloadR := make([]T, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 
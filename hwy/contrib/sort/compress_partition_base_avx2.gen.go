@@ -27,8 +27,8 @@ func BaseCompressPartition_avx2(data []float32, pivot float32) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := archsimd.BroadcastFloat32x8(pivot)
-	preloadL := make([]float32, preloadSize)
-	preloadR := make([]float32, preloadSize)
+	preloadL := make([]float32, preloadSize, 4*64)
+	preloadR := make([]float32, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -116,8 +116,8 @@ func BaseCompressPartition_avx2_Float64(data []float64, pivot float64) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := archsimd.BroadcastFloat64x4(pivot)
-	preloadL := make([]float64, preloadSize)
-	preloadR := make([]float64, preloadSize)
+	preloadL := make([]float64, preloadSize, 4*64)
+	preloadR := make([]float64, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -205,8 +205,8 @@ func BaseCompressPartition_avx2_Int32(data []int32, pivot int32) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := archsimd.BroadcastInt32x8(pivot)
-	preloadL := make([]int32, preloadSize)
-	preloadR := make([]int32, preloadSize)
+	preloadL := make([]int32, preloadSize, 4*64)
+	preloadR := make([]int32, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -294,8 +294,8 @@ func BaseCompressPartition_avx2_Int64(data []int64, pivot int64) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := archsimd.BroadcastInt64x4(pivot)
-	preloadL := make([]int64, preloadSize)
-	preloadR := make([]int64, preloadSize)
+	preloadL := make([]int64, preloadSize, 4*64)
+	preloadR := make([]int64, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -383,8 +383,8 @@ func BaseCompressPartition_avx2_Uint32(data []uint32, pivot uint32) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := archsimd.BroadcastUint32x8(pivot)
-	preloadL := make([]uint32, preloadSize)
-	preloadR := make([]uint32, preloadSize)
+	preloadL := make([]uint32, preloadSize, 4*64)
+	preloadR := make([]uint32, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -472,8 +472,8 @@ func BaseCompressPartition_avx2_Uint64(data []uint64, pivot uint64) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := archsimd.BroadcastUint64x4(pivot)
-	preloadL := make([]uint64, preloadSize)
-	preloadR := make([]uint64, preloadSize)
+	preloadL := make([]uint64, preloadSize, 4*64)
+	preloadR := make([]uint64, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -22,8 +22,8 @@ func BaseCompressPartition_fallback(data []float32, pivot float32) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := hwy.Set(pivot)
-	preloadL := make([]float32, preloadSize)
-	preloadR := make([]float32, preloadSize)
+	preloadL := make([]float32, preloadSize, 4*64)
+	preloadR := make([]float32, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -102,8 +102,8 @@ func BaseCompressPartition_fallback_Float64(data []float64, pivot float64) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := hwy.Set(pivot)
-	preloadL := make([]float64, preloadSize)
-	preloadR := make([]float64, preloadSize)
+	preloadL := make([]float64, preloadSize, 4*64)
+	preloadR := make([]float64, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -182,8 +182,8 @@ func BaseCompressPartition_fallback_Int32(data []int32, pivot int32) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := hwy.Set(pivot)
-	preloadL := make([]int32, preloadSize)
-	preloadR := make([]int32, preloadSize)
+	preloadL := make([]int32, preloadSize, 4*64)
+	preloadR := make([]int32, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -262,8 +262,8 @@ func BaseCompressPartition_fallback_Int64(data []int64, pivot int64) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := hwy.Set(pivot)
-	preloadL := make([]int64, preloadSize)
-	preloadR := make([]int64, preloadSize)
+	preloadL := make([]int64, preloadSize, 4*64)
+	preloadR := make([]int64, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -342,8 +342,8 @@ func BaseCompressPartition_fallback_Uint32(data []uint32, pivot uint32) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := hwy.Set(pivot)
-	preloadL := make([]uint32, preloadSize)
-	preloadR := make([]uint32, preloadSize)
+	preloadL := make([]uint32, preloadSize, 4*64)
+	preloadR := make([]uint32, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -422,8 +422,8 @@ func BaseCompressPartition_fallback_Uint64(data []uint64, pivot uint64) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := hwy.Set(pivot)
-	preloadL := make([]uint64, preloadSize)
-	preloadR := make([]uint64, preloadSize)
+	preloadL := make([]uint64, preloadSize, 4*64)
+	preloadR := make([]uint64, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -26,8 +26,8 @@ func BaseCompressPartition_neon(data []float32, pivot float32) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := asm.BroadcastFloat32x4(pivot)
-	preloadL := make([]float32, preloadSize)
-	preloadR := make([]float32, preloadSize)
+	preloadL := make([]float32, preloadSize, 4*64)
+	preloadR := make([]float32, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -115,8 +115,8 @@ func BaseCompressPartition_neon_Float64(data []float64, pivot float64) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := asm.BroadcastFloat64x2(pivot)
-	preloadL := make([]float64, preloadSize)
-	preloadR := make([]float64, preloadSize)
+	preloadL := make([]float64, preloadSize, 4*64)
+	preloadR := make([]float64, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -204,8 +204,8 @@ func BaseCompressPartition_neon_Int32(data []int32, pivot int32) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := asm.BroadcastInt32x4(pivot)
-	preloadL := make([]int32, preloadSize)
-	preloadR := make([]int32, preloadSize)
+	preloadL := make([]int32, preloadSize, 4*64)
+	preloadR := make([]int32, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -293,8 +293,8 @@ func BaseCompressPartition_neon_Int64(data []int64, pivot int64) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := asm.BroadcastInt64x2(pivot)
-	preloadL := make([]int64, preloadSize)
-	preloadR := make([]int64, preloadSize)
+	preloadL := make([]int64, preloadSize, 4*64)
+	preloadR := make([]int64, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -382,8 +382,8 @@ func BaseCompressPartition_neon_Uint32(data []uint32, pivot uint32) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := asm.BroadcastUint32x4(pivot)
-	preloadL := make([]uint32, preloadSize)
-	preloadR := make([]uint32, preloadSize)
+	preloadL := make([]uint32, preloadSize, 4*64)
+	preloadR := make([]uint32, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -471,8 +471,8 @@ func BaseCompressPartition_neon_Uint64(data []uint64, pivot uint64) int {
 		return scalarPartition2Way(data, pivot)
 	}
 	pivotVec := asm.BroadcastUint64x2(pivot)
-	preloadL := make([]uint64, preloadSize)
-	preloadR := make([]uint64, preloadSize)
+	preloadL := make([]uint64, preloadSize, 4*64)
+	preloadR := make([]uint64, preloadSize, 4*64)
 	copy(preloadL, data[:preloadSize])
 	copy(preloadR, data[n-preloadSize:])
 	readL := preloadSize
@@ -0,0 +1,112 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package sort
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("sort", "CompressPartition", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := CompressPartitionFloat32; hwyImpl != nil {
+			CompressPartitionFloat32 = func(data []float32, pivot float32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CompressPartitionFloat64; hwyImpl != nil {
+			CompressPartitionFloat64 = func(data []float64, pivot float64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CompressPartitionInt32; hwyImpl != nil {
+			CompressPartitionInt32 = func(data []int32, pivot int32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CompressPartitionInt64; hwyImpl != nil {
+			CompressPartitionInt64 = func(data []int64, pivot int64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CompressPartitionUint32; hwyImpl != nil {
+			CompressPartitionUint32 = func(data []uint32, pivot uint32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := CompressPartitionUint64; hwyImpl != nil {
+			CompressPartitionUint64 = func(data []uint64, pivot uint64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("sort", "CompressPartition3Way", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := CompressPartition3WayFloat32; hwyImpl != nil {
+			CompressPartition3WayFloat32 = func(data []float32, pivot float32) (int, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := CompressPartition3WayFloat64; hwyImpl != nil {
+			CompressPartition3WayFloat64 = func(data []float64, pivot float64) (int, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := CompressPartition3WayInt32; hwyImpl != nil {
+			CompressPartition3WayInt32 = func(data []int32, pivot int32) (int, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := CompressPartition3WayInt64; hwyImpl != nil {
+			CompressPartition3WayInt64 = func(data []int64, pivot int64) (int, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := CompressPartition3WayUint32; hwyImpl != nil {
+			CompressPartition3WayUint32 = func(data []uint32, pivot uint32) (int, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := CompressPartition3WayUint64; hwyImpl != nil {
+			CompressPartition3WayUint64 = func(data []uint64, pivot uint64) (int, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+}
@@ -0,0 +1,118 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package sort
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		f32       = make([]float32, allocTestLen)
+		f64       = make([]float64, allocTestLen)
+		i32       = make([]int32, allocTestLen)
+		i64       = make([]int64, allocTestLen)
+		u32       = make([]uint32, allocTestLen)
+		u64       = make([]uint64, allocTestLen)
+		f16       = make([]hwy.Float16, allocTestLen)
+		bf16      = make([]hwy.BFloat16, allocTestLen)
+		f32Scalar = float32(1)
+		f64Scalar = float64(1)
+		i32Scalar = int32(1)
+		i64Scalar = int64(1)
+		u32Scalar = uint32(1)
+		u64Scalar = uint64(1)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseCompressPartition_fallback", func() { BaseCompressPartition_fallback(f32, f32Scalar) }},
+		{"BaseCompressPartition_fallback_Float64", func() { BaseCompressPartition_fallback_Float64(f64, f64Scalar) }},
+		{"BaseCompressPartition_fallback_Int32", func() { BaseCompressPartition_fallback_Int32(i32, i32Scalar) }},
+		{"BaseCompressPartition_fallback_Int64", func() { BaseCompressPartition_fallback_Int64(i64, i64Scalar) }},
+		{"BaseCompressPartition_fallback_Uint32", func() { BaseCompressPartition_fallback_Uint32(u32, u32Scalar) }},
+		{"BaseCompressPartition_fallback_Uint64", func() { BaseCompressPartition_fallback_Uint64(u64, u64Scalar) }},
+		{"BaseCompressPartition3Way_fallback", func() { BaseCompressPartition3Way_fallback(f32, f32Scalar) }},
+		{"BaseCompressPartition3Way_fallback_Float64", func() { BaseCompressPartition3Way_fallback_Float64(f64, f64Scalar) }},
+		{"BaseCompressPartition3Way_fallback_Int32", func() { BaseCompressPartition3Way_fallback_Int32(i32, i32Scalar) }},
+		{"BaseCompressPartition3Way_fallback_Int64", func() { BaseCompressPartition3Way_fallback_Int64(i64, i64Scalar) }},
+		{"BaseCompressPartition3Way_fallback_Uint32", func() { BaseCompressPartition3Way_fallback_Uint32(u32, u32Scalar) }},
+		{"BaseCompressPartition3Way_fallback_Uint64", func() { BaseCompressPartition3Way_fallback_Uint64(u64, u64Scalar) }},
+		{"BaseIsSorted_fallback", func() { BaseIsSorted_fallback(f32) }},
+		{"BaseIsSorted_fallback_Float64", func() { BaseIsSorted_fallback_Float64(f64) }},
+		{"BaseIsSorted_fallback_Int32", func() { BaseIsSorted_fallback_Int32(i32) }},
+		{"BaseIsSorted_fallback_Int64", func() { BaseIsSorted_fallback_Int64(i64) }},
+		{"BaseIsSorted_fallback_Uint32", func() { BaseIsSorted_fallback_Uint32(u32) }},
+		{"BaseIsSorted_fallback_Uint64", func() { BaseIsSorted_fallback_Uint64(u64) }},
+		{"BaseSortSmall_fallback", func() { BaseSortSmall_fallback(f32) }},
+		{"BaseSortSmall_fallback_Float64", func() { BaseSortSmall_fallback_Float64(f64) }},
+		{"BaseSortSmall_fallback_Int32", func() { BaseSortSmall_fallback_Int32(i32) }},
+		{"BaseSortSmall_fallback_Int64", func() { BaseSortSmall_fallback_Int64(i64) }},
+		{"BaseSortSmall_fallback_Uint32", func() { BaseSortSmall_fallback_Uint32(u32) }},
+		{"BaseSortSmall_fallback_Uint64", func() { BaseSortSmall_fallback_Uint64(u64) }},
+		{"BasePartition_fallback", func() { BasePartition_fallback(f32, f32Scalar) }},
+		{"BasePartition_fallback_Float64", func() { BasePartition_fallback_Float64(f64, f64Scalar) }},
+		{"BasePartition_fallback_Int32", func() { BasePartition_fallback_Int32(i32, i32Scalar) }},
+		{"BasePartition_fallback_Int64", func() { BasePartition_fallback_Int64(i64, i64Scalar) }},
+		{"BasePartition_fallback_Uint32", func() { BasePartition_fallback_Uint32(u32, u32Scalar) }},
+		{"BasePartition_fallback_Uint64", func() { BasePartition_fallback_Uint64(u64, u64Scalar) }},
+		{"BasePartition3Way_fallback", func() { BasePartition3Way_fallback(f32, f32Scalar) }},
+		{"BasePartition3Way_fallback_Float64", func() { BasePartition3Way_fallback_Float64(f64, f64Scalar) }},
+		{"BasePartition3Way_fallback_Int32", func() { BasePartition3Way_fallback_Int32(i32, i32Scalar) }},
+		{"BasePartition3Way_fallback_Int64", func() { BasePartition3Way_fallback_Int64(i64, i64Scalar) }},
+		{"BasePartition3Way_fallback_Uint32", func() { BasePartition3Way_fallback_Uint32(u32, u32Scalar) }},
+		{"BasePartition3Way_fallback_Uint64", func() { BasePartition3Way_fallback_Uint64(u64, u64Scalar) }},
+		{"BaseRadixPass_fallback_Int32", func() { BaseRadixPass_fallback_Int32(i32, i32, allocTestDim) }},
+		{"BaseRadixPass_fallback_Int64", func() { BaseRadixPass_fallback_Int64(i64, i64, allocTestDim) }},
+		{"BaseRadixPass16_fallback_Int32", func() { BaseRadixPass16_fallback_Int32(i32, i32, allocTestDim) }},
+		{"BaseRadixPass16_fallback_Int64", func() { BaseRadixPass16_fallback_Int64(i64, i64, allocTestDim) }},
+		{"BaseRadixPass16Signed_fallback_Int32", func() { BaseRadixPass16Signed_fallback_Int32(i32, i32, allocTestDim) }},
+		{"BaseRadixPass16Signed_fallback_Int64", func() { BaseRadixPass16Signed_fallback_Int64(i64, i64, allocTestDim) }},
+		{"BaseRadixPassSigned_fallback_Int32", func() { BaseRadixPassSigned_fallback_Int32(i32, i32, allocTestDim) }},
+		{"BaseRadixPassSigned_fallback_Int64", func() { BaseRadixPassSigned_fallback_Int64(i64, i64, allocTestDim) }},
+		{"BaseFloatToSortable_fallback_Float16", func() { BaseFloatToSortable_fallback_Float16(f16) }},
+		{"BaseFloatToSortable_fallback_BFloat16", func() { BaseFloatToSortable_fallback_BFloat16(bf16) }},
+		{"BaseFloatToSortable_fallback", func() { BaseFloatToSortable_fallback(f32) }},
+		{"BaseFloatToSortable_fallback_Float64", func() { BaseFloatToSortable_fallback_Float64(f64) }},
+		{"BaseSortableToFloat_fallback_Float16", func() { BaseSortableToFloat_fallback_Float16(f16) }},
+		{"BaseSortableToFloat_fallback_BFloat16", func() { BaseSortableToFloat_fallback_BFloat16(bf16) }},
+		{"BaseSortableToFloat_fallback", func() { BaseSortableToFloat_fallback(f32) }},
+		{"BaseSortableToFloat_fallback_Float64", func() { BaseSortableToFloat_fallback_Float64(f64) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
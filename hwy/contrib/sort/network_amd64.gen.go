@@ -72,6 +72,18 @@ func SortSmall[T hwy.Lanes](data []T) {
 
 func init() {
 	initNetworkAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "sort",
+		Groups: []hwy.DispatchGroup{
+			{Name: "IsSorted", Vars: []any{&IsSortedFloat32, &IsSortedFloat64, &IsSortedInt32, &IsSortedInt64, &IsSortedUint32, &IsSortedUint64}},
+			{Name: "SortSmall", Vars: []any{&SortSmallFloat32, &SortSmallFloat64, &SortSmallInt32, &SortSmallInt64, &SortSmallUint32, &SortSmallUint64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initNetworkAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initNetworkAVX2},
+			{Name: "fallback", Supported: true, Init: initNetworkFallback},
+		},
+	})
 }
 
 func initNetworkAll() {
@@ -70,6 +70,17 @@ func SortSmall[T hwy.Lanes](data []T) {
 
 func init() {
 	initNetworkAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "sort",
+		Groups: []hwy.DispatchGroup{
+			{Name: "IsSorted", Vars: []any{&IsSortedFloat32, &IsSortedFloat64, &IsSortedInt32, &IsSortedInt64, &IsSortedUint32, &IsSortedUint64}},
+			{Name: "SortSmall", Vars: []any{&SortSmallFloat32, &SortSmallFloat64, &SortSmallInt32, &SortSmallInt64, &SortSmallUint32, &SortSmallUint64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initNetworkNEON},
+			{Name: "fallback", Supported: true, Init: initNetworkFallback},
+		},
+	})
 }
 
 func initNetworkAll() {
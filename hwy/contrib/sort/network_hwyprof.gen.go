@@ -0,0 +1,106 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package sort
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("sort", "IsSorted", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := IsSortedFloat32; hwyImpl != nil {
+			IsSortedFloat32 = func(data []float32) bool {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := IsSortedFloat64; hwyImpl != nil {
+			IsSortedFloat64 = func(data []float64) bool {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := IsSortedInt32; hwyImpl != nil {
+			IsSortedInt32 = func(data []int32) bool {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := IsSortedInt64; hwyImpl != nil {
+			IsSortedInt64 = func(data []int64) bool {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := IsSortedUint32; hwyImpl != nil {
+			IsSortedUint32 = func(data []uint32) bool {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := IsSortedUint64; hwyImpl != nil {
+			IsSortedUint64 = func(data []uint64) bool {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("sort", "SortSmall", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SortSmallFloat32; hwyImpl != nil {
+			SortSmallFloat32 = func(data []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := SortSmallFloat64; hwyImpl != nil {
+			SortSmallFloat64 = func(data []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := SortSmallInt32; hwyImpl != nil {
+			SortSmallInt32 = func(data []int32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := SortSmallInt64; hwyImpl != nil {
+			SortSmallInt64 = func(data []int64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := SortSmallUint32; hwyImpl != nil {
+			SortSmallUint32 = func(data []uint32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := SortSmallUint64; hwyImpl != nil {
+			SortSmallUint64 = func(data []uint64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+	})
+}
@@ -0,0 +1,112 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package sort
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("sort", "Partition", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := PartitionFloat32; hwyImpl != nil {
+			PartitionFloat32 = func(data []float32, pivot float32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PartitionFloat64; hwyImpl != nil {
+			PartitionFloat64 = func(data []float64, pivot float64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PartitionInt32; hwyImpl != nil {
+			PartitionInt32 = func(data []int32, pivot int32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PartitionInt64; hwyImpl != nil {
+			PartitionInt64 = func(data []int64, pivot int64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PartitionUint32; hwyImpl != nil {
+			PartitionUint32 = func(data []uint32, pivot uint32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+		if hwyImpl := PartitionUint64; hwyImpl != nil {
+			PartitionUint64 = func(data []uint64, pivot uint64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("sort", "Partition3Way", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Partition3WayFloat32; hwyImpl != nil {
+			Partition3WayFloat32 = func(data []float32, pivot float32) (int, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := Partition3WayFloat64; hwyImpl != nil {
+			Partition3WayFloat64 = func(data []float64, pivot float64) (int, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := Partition3WayInt32; hwyImpl != nil {
+			Partition3WayInt32 = func(data []int32, pivot int32) (int, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := Partition3WayInt64; hwyImpl != nil {
+			Partition3WayInt64 = func(data []int64, pivot int64) (int, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := Partition3WayUint32; hwyImpl != nil {
+			Partition3WayUint32 = func(data []uint32, pivot uint32) (int, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := Partition3WayUint64; hwyImpl != nil {
+			Partition3WayUint64 = func(data []uint64, pivot uint64) (int, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(data, pivot)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+}
@@ -78,6 +78,16 @@ func Partition3Way[T hwy.Lanes](data []T, pivot T) (int, int) {
 
 func init() {
 	initPartitionAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "sort",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Partition", Vars: []any{&PartitionFloat32, &PartitionFloat64, &PartitionInt32, &PartitionInt64, &PartitionUint32, &PartitionUint64}},
+			{Name: "Partition3Way", Vars: []any{&Partition3WayFloat32, &Partition3WayFloat64, &Partition3WayInt32, &Partition3WayInt64, &Partition3WayUint32, &Partition3WayUint64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initPartitionFallback},
+		},
+	})
 }
 
 func initPartitionAll() {
@@ -54,6 +54,18 @@ func SortableToFloat[T hwy.Floats](data []T) {
 
 func init() {
 	initRadix_floatAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "sort",
+		Groups: []hwy.DispatchGroup{
+			{Name: "FloatToSortable", Vars: []any{&FloatToSortableFloat16, &FloatToSortableBFloat16, &FloatToSortableFloat32, &FloatToSortableFloat64}},
+			{Name: "SortableToFloat", Vars: []any{&SortableToFloatFloat16, &SortableToFloatBFloat16, &SortableToFloatFloat32, &SortableToFloatFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initRadix_floatAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initRadix_floatAVX2},
+			{Name: "fallback", Supported: true, Init: initRadix_floatFallback},
+		},
+	})
 }
 
 func initRadix_floatAll() {
@@ -0,0 +1,72 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package sort
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("sort", "FloatToSortable", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FloatToSortableFloat16; hwyImpl != nil {
+			FloatToSortableFloat16 = func(data []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := FloatToSortableBFloat16; hwyImpl != nil {
+			FloatToSortableBFloat16 = func(data []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := FloatToSortableFloat32; hwyImpl != nil {
+			FloatToSortableFloat32 = func(data []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := FloatToSortableFloat64; hwyImpl != nil {
+			FloatToSortableFloat64 = func(data []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+	})
+	hwy.ProfileDispatch("sort", "SortableToFloat", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SortableToFloatFloat16; hwyImpl != nil {
+			SortableToFloatFloat16 = func(data []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := SortableToFloatBFloat16; hwyImpl != nil {
+			SortableToFloatBFloat16 = func(data []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := SortableToFloatFloat32; hwyImpl != nil {
+			SortableToFloatFloat32 = func(data []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := SortableToFloatFloat64; hwyImpl != nil {
+			SortableToFloatFloat64 = func(data []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+	})
+}
@@ -0,0 +1,76 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package sort
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("sort", "RadixPass", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := RadixPassInt32; hwyImpl != nil {
+			RadixPassInt32 = func(src []int32, dst []int32, shift int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, dst, shift)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := RadixPassInt64; hwyImpl != nil {
+			RadixPassInt64 = func(src []int64, dst []int64, shift int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, dst, shift)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("sort", "RadixPass16", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := RadixPass16Int32; hwyImpl != nil {
+			RadixPass16Int32 = func(src []int32, dst []int32, shift int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, dst, shift)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := RadixPass16Int64; hwyImpl != nil {
+			RadixPass16Int64 = func(src []int64, dst []int64, shift int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, dst, shift)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("sort", "RadixPass16Signed", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := RadixPass16SignedInt32; hwyImpl != nil {
+			RadixPass16SignedInt32 = func(src []int32, dst []int32, shift int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, dst, shift)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := RadixPass16SignedInt64; hwyImpl != nil {
+			RadixPass16SignedInt64 = func(src []int64, dst []int64, shift int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, dst, shift)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("sort", "RadixPassSigned", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := RadixPassSignedInt32; hwyImpl != nil {
+			RadixPassSignedInt32 = func(src []int32, dst []int32, shift int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, dst, shift)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := RadixPassSignedInt64; hwyImpl != nil {
+			RadixPassSignedInt64 = func(src []int64, dst []int64, shift int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, dst, shift)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+			}
+		}
+	})
+}
@@ -73,6 +73,18 @@ func RadixPassSigned[T hwy.SignedInts](src []T, dst []T, shift int) {
 
 func init() {
 	initRadixAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "sort",
+		Groups: []hwy.DispatchGroup{
+			{Name: "RadixPass", Vars: []any{&RadixPassInt32, &RadixPassInt64}},
+			{Name: "RadixPass16", Vars: []any{&RadixPass16Int32, &RadixPass16Int64}},
+			{Name: "RadixPass16Signed", Vars: []any{&RadixPass16SignedInt32, &RadixPass16SignedInt64}},
+			{Name: "RadixPassSigned", Vars: []any{&RadixPassSignedInt32, &RadixPassSignedInt64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initRadixFallback},
+		},
+	})
 }
 
 func initRadixAll() {
@@ -0,0 +1,60 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package sort
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/sort/asm"
+)
+
+func init() {
+	initNetworkAvx512CAsm()
+}
+
+func initNetworkAvx512CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX512() {
+		return
+	}
+	IsSortedFloat32 = isSortedAVX512AsmF32
+	IsSortedFloat64 = isSortedAVX512AsmF64
+}
+
+func isSortedAVX512AsmF32(data []float32) bool {
+	var p_data unsafe.Pointer
+	if len(data) > 0 {
+		p_data = unsafe.Pointer(&data[0])
+	}
+	lenVal := int64(len(data))
+	if lenVal == 0 {
+		return BaseIsSorted_fallback(data)
+	}
+	var out_result int64
+	asm.IsSorted_AVX512_F32(
+		p_data,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return out_result != 0
+}
+
+func isSortedAVX512AsmF64(data []float64) bool {
+	var p_data unsafe.Pointer
+	if len(data) > 0 {
+		p_data = unsafe.Pointer(&data[0])
+	}
+	lenVal := int64(len(data))
+	if lenVal == 0 {
+		return BaseIsSorted_fallback_Float64(data)
+	}
+	var out_result int64
+	asm.IsSorted_AVX512_F64(
+		p_data,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return out_result != 0
+}
@@ -0,0 +1,46 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package stats provides streaming statistics over float streams: a
+// mergeable mean/variance/min/max accumulator and fixed-width and
+// logarithmic histograms, computed with SIMD kernels.
+//
+// # Moments
+//
+// Stats accumulates count, mean, variance, minimum and maximum. Each chunk
+// of input is reduced by one fused pass (Moments) to a shifted sum, sum of
+// squares, minimum and maximum, and folded into the running totals with the
+// pairwise update of Chan et al., so accumulators over chunks, workers or
+// time windows combine exactly with Merge:
+//
+//	var s stats.Stats[float32]
+//	s.Add(batch1)
+//	s.Add(batch2)
+//	mean, sd := s.Mean(), s.StdDev()
+//
+//	total := stats.Compute(pool, data) // split across workers and merged
+//
+// # Histograms
+//
+// NewHistogram builds equal-width bins over [lo, hi) and NewLogHistogram
+// bins a fixed number of times per doubling. Bin slots are computed a
+// vector at a time (BinIndices, LogBinIndices); values below the range,
+// above it and NaN are counted separately.
+//
+//	h := stats.NewLogHistogram(1e-3, 10, 8) // latency in seconds
+//	h.Add(latencies)
+//
+// Accumulate updates a Stats and a Histogram together one L1-sized chunk at
+// a time, so each chunk is read from memory once.
+package stats
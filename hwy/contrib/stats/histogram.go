@@ -0,0 +1,166 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package stats
+
+import "math"
+
+// Histogram counts float32 values into fixed-width or logarithmic bins,
+// with separate counters for values below the first bin, at or above the
+// last bin edge, and NaN.
+//
+// Bin slots are computed a vector at a time (BaseBinIndices,
+// BaseLogBinIndices) into a chunk-sized index buffer, which is then
+// counted with scalar increments.
+type Histogram struct {
+	lo, hi float32
+	bins   int
+	log    bool
+	// Fixed-width: scale is 1/width and offset is unused. Logarithmic:
+	// scale is bins per octave and offset is log2(lo) * scale.
+	scale, offset float32
+	// counts[0] is underflow, counts[1:bins+1] the bins, counts[bins+1]
+	// overflow and counts[bins+2] NaN.
+	counts []uint64
+	idx    []int32
+}
+
+// NewHistogram returns a histogram with bins equal-width bins over
+// [lo, hi).
+func NewHistogram(lo, hi float32, bins int) *Histogram {
+	if bins <= 0 || !(hi > lo) {
+		panic("stats: histogram needs bins > 0 and hi > lo")
+	}
+	return &Histogram{
+		lo: lo, hi: hi, bins: bins,
+		scale:  float32(bins) / (hi - lo),
+		counts: make([]uint64, bins+3),
+	}
+}
+
+// NewLogHistogram returns a histogram with logarithmic bins over [lo, hi),
+// binsPerOctave bins per doubling. The number of bins is rounded up so the
+// last bin covers hi. lo must be positive.
+func NewLogHistogram(lo, hi float32, binsPerOctave int) *Histogram {
+	if binsPerOctave <= 0 || !(lo > 0) || !(hi > lo) {
+		panic("stats: log histogram needs binsPerOctave > 0 and 0 < lo < hi")
+	}
+	scale := float32(binsPerOctave)
+	bins := int(math.Ceil(math.Log2(float64(hi)/float64(lo)) * float64(binsPerOctave)))
+	return &Histogram{
+		lo: lo, hi: hi, bins: bins, log: true,
+		scale:  scale,
+		offset: float32(math.Log2(float64(lo))) * scale,
+		counts: make([]uint64, bins+3),
+	}
+}
+
+// Add counts the values of x.
+func (h *Histogram) Add(x []float32) {
+	if h.idx == nil {
+		h.idx = make([]int32, ChunkSize)
+	}
+	for start := 0; start < len(x); start += ChunkSize {
+		h.addChunk(x[start:min(start+ChunkSize, len(x))])
+	}
+}
+
+func (h *Histogram) addChunk(x []float32) {
+	idx := h.idx[:len(x)]
+	if h.log {
+		LogBinIndices(x, h.offset, h.scale, h.bins, idx)
+	} else {
+		BinIndices(x, h.lo, h.scale, h.bins, idx)
+	}
+	counts := h.counts
+	for _, j := range idx {
+		counts[j]++
+	}
+}
+
+// Merge adds the counts of o, which must have the same bins, to h.
+func (h *Histogram) Merge(o *Histogram) {
+	if o.lo != h.lo || o.hi != h.hi || o.bins != h.bins || o.log != h.log {
+		panic("stats: merging histograms with different bins")
+	}
+	for i, c := range o.counts {
+		h.counts[i] += c
+	}
+}
+
+// Reset clears all counts.
+func (h *Histogram) Reset() { clear(h.counts) }
+
+// Bins returns the number of bins.
+func (h *Histogram) Bins() int { return h.bins }
+
+// Counts returns the per-bin counts. The slice aliases the histogram.
+func (h *Histogram) Counts() []uint64 { return h.counts[1 : h.bins+1] }
+
+// Underflow returns the number of values below the first bin.
+func (h *Histogram) Underflow() uint64 { return h.counts[0] }
+
+// Overflow returns the number of values at or above the last bin's upper
+// edge.
+func (h *Histogram) Overflow() uint64 { return h.counts[h.bins+1] }
+
+// NaN returns the number of NaN values.
+func (h *Histogram) NaN() uint64 { return h.counts[h.bins+2] }
+
+// Edge returns the lower edge of bin i; Edge(Bins()) is the upper edge of
+// the last bin.
+func (h *Histogram) Edge(i int) float64 {
+	if h.log {
+		return float64(h.lo) * math.Exp2(float64(i)/float64(h.scale))
+	}
+	return float64(h.lo) + float64(i)*float64(h.hi-h.lo)/float64(h.bins)
+}
+
+// binSlot is the scalar form of the slot computation in BaseBinIndices.
+func binSlot(t float32, nan bool, bins int) int32 {
+	if nan {
+		return int32(bins + 2)
+	}
+	return int32(min(max(t+1, 0), float32(bins+1)))
+}
+
+// logBinSlot is the scalar form of the slot computation in
+// BaseLogBinIndices.
+func logBinSlot(x, offset, binsPerOctave float32, bins int) int32 {
+	if x != x {
+		return int32(bins + 2)
+	}
+	if x <= 0 {
+		return 0
+	}
+	return binSlot(float32(math.Log2(float64(x)))*binsPerOctave-offset, false, bins)
+}
+
+// Accumulate folds x into s and counts it in h (either may be nil), one
+// ChunkSize chunk at a time, so each chunk is read from memory once for
+// both.
+func Accumulate(x []float32, s *Stats[float32], h *Histogram) {
+	if h != nil && h.idx == nil {
+		h.idx = make([]int32, ChunkSize)
+	}
+	for start := 0; start < len(x); start += ChunkSize {
+		chunk := x[start:min(start+ChunkSize, len(x))]
+		if s != nil {
+			s.addChunk(chunk)
+		}
+		if h != nil {
+			h.addChunk(chunk)
+		}
+	}
+}
@@ -0,0 +1,154 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package stats
+
+import (
+	"math"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+const (
+	// ChunkSize is the number of elements Stats.Add and Accumulate process
+	// per kernel call. A chunk of float32 fits comfortably in L1, so the
+	// histogram pass after the moments pass does not touch memory again.
+	ChunkSize = 1024
+
+	// MinParallelElements is the minimum input length before Compute splits
+	// the input across the pool.
+	MinParallelElements = 1 << 16
+)
+
+// Stats is a streaming accumulator of count, mean, variance, minimum and
+// maximum. The zero value is an empty accumulator.
+//
+// Add consumes a slice in one fused SIMD pass per chunk (see BaseMoments)
+// and folds each chunk into the running totals with the pairwise update of
+// Chan et al., the batched form of Welford's algorithm. Accumulators over
+// different parts of a stream combine with Merge, in any grouping.
+type Stats[T float32 | float64] struct {
+	count    int64
+	mean, m2 float64
+	min, max T
+}
+
+// Add folds the values of x into s.
+func (s *Stats[T]) Add(x []T) {
+	for start := 0; start < len(x); start += ChunkSize {
+		s.addChunk(x[start:min(start+ChunkSize, len(x))])
+	}
+}
+
+func (s *Stats[T]) addChunk(x []T) {
+	if len(x) == 0 {
+		return
+	}
+	shift := x[0]
+	if s.count > 0 {
+		shift = T(s.mean)
+	}
+	sum, sumSq, lo, hi := Moments(x, shift)
+	n := float64(len(x))
+	mean := float64(shift) + float64(sum)/n
+	m2 := max(0, float64(sumSq)-float64(sum)*float64(sum)/n)
+	s.merge(int64(len(x)), mean, m2, lo, hi)
+}
+
+// Merge folds the values accumulated by o into s.
+func (s *Stats[T]) Merge(o Stats[T]) {
+	if o.count == 0 {
+		return
+	}
+	s.merge(o.count, o.mean, o.m2, o.min, o.max)
+}
+
+func (s *Stats[T]) merge(count int64, mean, m2 float64, lo, hi T) {
+	if s.count == 0 {
+		*s = Stats[T]{count: count, mean: mean, m2: m2, min: lo, max: hi}
+		return
+	}
+	na, nb := float64(s.count), float64(count)
+	n := na + nb
+	delta := mean - s.mean
+	s.mean += delta * nb / n
+	s.m2 += m2 + delta*delta*na*nb/n
+	s.count += count
+	s.min = min(s.min, lo)
+	s.max = max(s.max, hi)
+}
+
+// Reset empties s.
+func (s *Stats[T]) Reset() { *s = Stats[T]{} }
+
+// Count returns the number of values added.
+func (s *Stats[T]) Count() int64 { return s.count }
+
+// Mean returns the mean of the values, or NaN if there are none.
+func (s *Stats[T]) Mean() float64 {
+	if s.count == 0 {
+		return math.NaN()
+	}
+	return s.mean
+}
+
+// Variance returns the population variance of the values, or NaN if there
+// are none.
+func (s *Stats[T]) Variance() float64 {
+	if s.count == 0 {
+		return math.NaN()
+	}
+	return s.m2 / float64(s.count)
+}
+
+// SampleVariance returns the unbiased sample variance of the values, or NaN
+// if there are fewer than two.
+func (s *Stats[T]) SampleVariance() float64 {
+	if s.count < 2 {
+		return math.NaN()
+	}
+	return s.m2 / float64(s.count-1)
+}
+
+// StdDev returns the population standard deviation of the values.
+func (s *Stats[T]) StdDev() float64 { return math.Sqrt(s.Variance()) }
+
+// Min returns the smallest value, or 0 if there are none.
+func (s *Stats[T]) Min() T { return s.min }
+
+// Max returns the largest value, or 0 if there are none.
+func (s *Stats[T]) Max() T { return s.max }
+
+// Compute returns the statistics of x, splitting it across pool for at
+// least MinParallelElements values. The per-worker accumulators are merged
+// in input order, so the result does not depend on scheduling. pool may be
+// nil.
+func Compute[T float32 | float64](pool workerpool.Executor, x []T) Stats[T] {
+	var s Stats[T]
+	if pool == nil || len(x) < MinParallelElements {
+		s.Add(x)
+		return s
+	}
+	chunks := (len(x) + ChunkSize - 1) / ChunkSize
+	parts := make([]Stats[T], chunks)
+	pool.ParallelForAtomicBatched(chunks, 16, func(start, end int) {
+		for c := start; c < end; c++ {
+			parts[c].addChunk(x[c*ChunkSize : min((c+1)*ChunkSize, len(x))])
+		}
+	})
+	for _, p := range parts {
+		s.Merge(p)
+	}
+	return s
+}
@@ -0,0 +1,93 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package stats
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var BinIndices func(x []float32, lo float32, invWidth float32, bins int, idx []int32)
+var LogBinIndices func(x []float32, offset float32, binsPerOctave float32, bins int, idx []int32)
+var MomentsFloat32 func(x []float32, shift float32) (sum float32, sumSq float32, minVal float32, maxVal float32)
+var MomentsFloat64 func(x []float64, shift float64) (sum float64, sumSq float64, minVal float64, maxVal float64)
+
+// Moments computes, in a single pass over x, the sum and sum of squares
+// of x - shift together with the minimum and maximum of x. x must not be
+// empty.
+//
+// Shifting by a value close to the mean (the running mean of the stream, or
+// the first element) keeps the sum of squares well conditioned, so the
+// chunk's squared deviation from its mean, sumSq - sum²/n, stays accurate.
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:gen T={float32, float64}
+func Moments[T float32 | float64](x []T, shift T) (sum T, sumSq T, minVal T, maxVal T) {
+	if _, ok := any(x).([]float32); ok {
+		_r0, _r1, _r2, _r3 := MomentsFloat32(any(x).([]float32), any(shift).(float32))
+		return any(_r0).(T), any(_r1).(T), any(_r2).(T), any(_r3).(T)
+	}
+	if _, ok := any(x).([]float64); ok {
+		_r0, _r1, _r2, _r3 := MomentsFloat64(any(x).([]float64), any(shift).(float64))
+		return any(_r0).(T), any(_r1).(T), any(_r2).(T), any(_r3).(T)
+	}
+	panic("unsupported type")
+}
+
+func init() {
+	initStatsAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "stats",
+		Groups: []hwy.DispatchGroup{
+			{Name: "BinIndices", Vars: []any{&BinIndices}},
+			{Name: "LogBinIndices", Vars: []any{&LogBinIndices}},
+			{Name: "Moments", Vars: []any{&MomentsFloat32, &MomentsFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initStatsAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initStatsAVX2},
+			{Name: "fallback", Supported: true, Init: initStatsFallback},
+		},
+	})
+}
+
+func initStatsAll() {
+	if hwy.NoSimdEnv() {
+		initStatsFallback()
+		return
+	}
+	if archsimd.X86.AVX512() {
+		initStatsAVX512()
+		return
+	}
+	if archsimd.X86.AVX2() {
+		initStatsAVX2()
+		return
+	}
+	initStatsFallback()
+}
+
+func initStatsAVX2() {
+	BinIndices = BaseBinIndices_avx2
+	LogBinIndices = BaseLogBinIndices_avx2
+	MomentsFloat32 = BaseMoments_avx2
+	MomentsFloat64 = BaseMoments_avx2_Float64
+}
+
+func initStatsAVX512() {
+	BinIndices = BaseBinIndices_avx512
+	LogBinIndices = BaseLogBinIndices_avx512
+	MomentsFloat32 = BaseMoments_avx512
+	MomentsFloat64 = BaseMoments_avx512_Float64
+}
+
+func initStatsFallback() {
+	BinIndices = BaseBinIndices_fallback
+	LogBinIndices = BaseLogBinIndices_fallback
+	MomentsFloat32 = BaseMoments_fallback
+	MomentsFloat64 = BaseMoments_fallback_Float64
+}
@@ -0,0 +1,138 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package stats
+
+//go:generate go run ../../../cmd/hwygen -input stats_base.go -output . -targets avx2,avx512,neon,fallback -dispatch stats
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/math"
+)
+
+// BaseMoments computes, in a single pass over x, the sum and sum of squares
+// of x - shift together with the minimum and maximum of x. x must not be
+// empty.
+//
+// Shifting by a value close to the mean (the running mean of the stream, or
+// the first element) keeps the sum of squares well conditioned, so the
+// chunk's squared deviation from its mean, sumSq - sum²/n, stays accurate.
+//
+//hwy:gen T={float32, float64}
+func BaseMoments[T float32 | float64](x []T, shift T) (sum, sumSq, minVal, maxVal T) {
+	n := len(x)
+	vShift := hwy.Set(shift)
+	vSum := hwy.Zero[T]()
+	vSq := hwy.Zero[T]()
+	lanes := vSum.NumLanes()
+
+	minVal, maxVal = x[0], x[0]
+	var i int
+	if n >= lanes {
+		vMin := hwy.Load(x)
+		vMax := vMin
+		for i = 0; i+lanes <= n; i += lanes {
+			v := hwy.Load(x[i:])
+			d := hwy.Sub(v, vShift)
+			vSum = hwy.Add(vSum, d)
+			vSq = hwy.MulAdd(d, d, vSq)
+			vMin = hwy.Min(vMin, v)
+			vMax = hwy.Max(vMax, v)
+		}
+		minVal = hwy.ReduceMin(vMin)
+		maxVal = hwy.ReduceMax(vMax)
+	}
+	sum = hwy.ReduceSum(vSum)
+	sumSq = hwy.ReduceSum(vSq)
+
+	for ; i < n; i++ {
+		d := x[i] - shift
+		sum += d
+		sumSq += d * d
+		minVal = min(minVal, x[i])
+		maxVal = max(maxVal, x[i])
+	}
+	return sum, sumSq, minVal, maxVal
+}
+
+// BaseBinIndices computes the fixed-width histogram slot of every element of
+// x, writing it to idx. The value t = (x - lo) * invWidth falls in slot
+// floor(t) + 1 clamped to [0, bins+1], so slot 0 counts values below lo,
+// slots 1..bins the bins and slot bins+1 values at or above the upper edge.
+// NaN values go to slot bins+2. idx must have room for len(x) entries.
+//
+// t + 1 is clamped before the conversion, so the truncating float-to-int
+// conversion only sees non-negative values, where it equals floor.
+func BaseBinIndices(x []float32, lo, invWidth float32, bins int, idx []int32) {
+	n := len(x)
+	if n == 0 {
+		return
+	}
+	_ = idx[n-1]
+	vLo := hwy.Set[float32](lo)
+	vInv := hwy.Set[float32](invWidth)
+	vOne := hwy.Set[float32](1)
+	vZero := hwy.Zero[float32]()
+	vTop := hwy.Set(float32(bins + 1))
+	vNaN := hwy.Set(float32(bins + 2))
+	lanes := vLo.NumLanes()
+
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		v := hwy.Load(x[i:])
+		t := hwy.MulAdd(hwy.Sub(v, vLo), vInv, vOne)
+		t = hwy.Clamp(t, vZero, vTop)
+		t = hwy.Merge(vNaN, t, hwy.IsNaN(v))
+		slot := hwy.ConvertToInt32(t)
+		hwy.StoreSlice(slot, idx[i:])
+	}
+	for ; i < n; i++ {
+		idx[i] = binSlot((x[i]-lo)*invWidth, x[i] != x[i], bins)
+	}
+}
+
+// BaseLogBinIndices is BaseBinIndices for logarithmic bins: t is
+// log2(x) * binsPerOctave - offset, with offset = log2(lo) * binsPerOctave.
+// Zero and negative values count as below lo.
+func BaseLogBinIndices(x []float32, offset, binsPerOctave float32, bins int, idx []int32) {
+	n := len(x)
+	if n == 0 {
+		return
+	}
+	_ = idx[n-1]
+	vOffset := hwy.Set[float32](offset)
+	vScale := hwy.Set[float32](binsPerOctave)
+	vOne := hwy.Set[float32](1)
+	vZero := hwy.Zero[float32]()
+	vTop := hwy.Set(float32(bins + 1))
+	vNaN := hwy.Set(float32(bins + 2))
+	lanes := vOne.NumLanes()
+
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		v := hwy.Load(x[i:])
+		pos := hwy.Greater(v, vZero)
+		// Keep the logarithm's argument positive; those lanes are replaced.
+		l := math.BaseLog2Vec(hwy.Merge(v, vOne, pos))
+		t := hwy.Add(hwy.Sub(hwy.Mul(l, vScale), vOffset), vOne)
+		t = hwy.Clamp(t, vZero, vTop)
+		t = hwy.Merge(t, vZero, pos)
+		t = hwy.Merge(vNaN, t, hwy.IsNaN(v))
+		slot := hwy.ConvertToInt32(t)
+		hwy.StoreSlice(slot, idx[i:])
+	}
+	for ; i < n; i++ {
+		idx[i] = logBinSlot(x[i], offset, binsPerOctave, bins)
+	}
+}
@@ -0,0 +1,161 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package stats
+
+import (
+	"simd/archsimd"
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/math"
+)
+
+// Hoisted constants - pre-broadcasted at package init time
+var (
+	BaseBinIndices_AVX2_vOne_f32    = archsimd.BroadcastFloat32x8(1)
+	BaseLogBinIndices_AVX2_vOne_f32 = archsimd.BroadcastFloat32x8(1)
+)
+
+func BaseBinIndices_avx2(x []float32, lo float32, invWidth float32, bins int, idx []int32) {
+	n := len(x)
+	if n == 0 {
+		return
+	}
+	_ = idx[n-1]
+	vLo := archsimd.BroadcastFloat32x8(lo)
+	vInv := archsimd.BroadcastFloat32x8(invWidth)
+	vOne := BaseBinIndices_AVX2_vOne_f32
+	vZero := archsimd.BroadcastFloat32x8(0)
+	vTop := archsimd.BroadcastFloat32x8(float32(bins + 1))
+	vNaN := archsimd.BroadcastFloat32x8(float32(bins + 2))
+	lanes := 8
+	var i int
+	i = 0
+	for ; i+lanes*2 <= n; i += lanes * 2 {
+		v := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[i])))
+		t := v.Sub(vLo).MulAdd(vInv, vOne)
+		t = t.Max(vZero).Min(vTop)
+		t = vNaN.Merge(t, v.Equal(v).Xor(archsimd.BroadcastFloat32x8(1.0).Equal(archsimd.BroadcastFloat32x8(1.0))))
+		slot := t.ConvertToInt32()
+		slot.StoreSlice(idx[i:])
+		v1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[i+8])))
+		t1 := v1.Sub(vLo).MulAdd(vInv, vOne)
+		t1 = t1.Max(vZero).Min(vTop)
+		t1 = vNaN.Merge(t1, v1.Equal(v1).Xor(archsimd.BroadcastFloat32x8(1.0).Equal(archsimd.BroadcastFloat32x8(1.0))))
+		slot1 := t1.ConvertToInt32()
+		slot1.StoreSlice(idx[i+8:])
+	}
+	for ; i < n; i++ {
+		idx[i] = binSlot((x[i]-lo)*invWidth, x[i] != x[i], bins)
+	}
+}
+
+func BaseLogBinIndices_avx2(x []float32, offset float32, binsPerOctave float32, bins int, idx []int32) {
+	n := len(x)
+	if n == 0 {
+		return
+	}
+	_ = idx[n-1]
+	vOffset := archsimd.BroadcastFloat32x8(offset)
+	vScale := archsimd.BroadcastFloat32x8(binsPerOctave)
+	vOne := BaseLogBinIndices_AVX2_vOne_f32
+	vZero := archsimd.BroadcastFloat32x8(0)
+	vTop := archsimd.BroadcastFloat32x8(float32(bins + 1))
+	vNaN := archsimd.BroadcastFloat32x8(float32(bins + 2))
+	lanes := 8
+	var i int
+	i = 0
+	for ; i+lanes*2 <= n; i += lanes * 2 {
+		v := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[i])))
+		pos := v.Greater(vZero)
+		l := math.BaseLog2Vec_avx2(v.Merge(vOne, pos))
+		t := l.Mul(vScale).Sub(vOffset).Add(vOne)
+		t = t.Max(vZero).Min(vTop)
+		t = t.Merge(vZero, pos)
+		t = vNaN.Merge(t, v.Equal(v).Xor(archsimd.BroadcastFloat32x8(1.0).Equal(archsimd.BroadcastFloat32x8(1.0))))
+		slot := t.ConvertToInt32()
+		slot.StoreSlice(idx[i:])
+		v1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[i+8])))
+		pos1 := v1.Greater(vZero)
+		l1 := math.BaseLog2Vec_avx2(v1.Merge(vOne, pos1))
+		t1 := l1.Mul(vScale).Sub(vOffset).Add(vOne)
+		t1 = t1.Max(vZero).Min(vTop)
+		t1 = t1.Merge(vZero, pos1)
+		t1 = vNaN.Merge(t1, v1.Equal(v1).Xor(archsimd.BroadcastFloat32x8(1.0).Equal(archsimd.BroadcastFloat32x8(1.0))))
+		slot1 := t1.ConvertToInt32()
+		slot1.StoreSlice(idx[i+8:])
+	}
+	for ; i < n; i++ {
+		idx[i] = logBinSlot(x[i], offset, binsPerOctave, bins)
+	}
+}
+
+func BaseMoments_avx2(x []float32, shift float32) (sum float32, sumSq float32, minVal float32, maxVal float32) {
+	n := len(x)
+	vShift := archsimd.BroadcastFloat32x8(shift)
+	vSum := archsimd.BroadcastFloat32x8(0)
+	vSq := archsimd.BroadcastFloat32x8(0)
+	lanes := 8
+	minVal, maxVal = x[0], x[0]
+	var i int
+	if n >= lanes {
+		vMin := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[0])))
+		vMax := vMin
+		for i = 0; i+lanes <= n; i += lanes {
+			v := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[i])))
+			d := v.Sub(vShift)
+			vSum = vSum.Add(d)
+			vSq = d.MulAdd(d, vSq)
+			vMin = vMin.Min(v)
+			vMax = vMax.Max(v)
+		}
+		minVal = hwy.ReduceMin_AVX2_F32x8(vMin)
+		maxVal = hwy.ReduceMax_AVX2_F32x8(vMax)
+	}
+	sum = hwy.ReduceSum_AVX2_F32x8(vSum)
+	sumSq = hwy.ReduceSum_AVX2_F32x8(vSq)
+	for ; i < n; i++ {
+		d := x[i] - shift
+		sum += d
+		sumSq += d * d
+		minVal = min(minVal, x[i])
+		maxVal = max(maxVal, x[i])
+	}
+	return sum, sumSq, minVal, maxVal
+}
+
+func BaseMoments_avx2_Float64(x []float64, shift float64) (sum float64, sumSq float64, minVal float64, maxVal float64) {
+	n := len(x)
+	vShift := archsimd.BroadcastFloat64x4(shift)
+	vSum := archsimd.BroadcastFloat64x4(0)
+	vSq := archsimd.BroadcastFloat64x4(0)
+	lanes := 4
+	minVal, maxVal = x[0], x[0]
+	var i int
+	if n >= lanes {
+		vMin := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&x[0])))
+		vMax := vMin
+		for i = 0; i+lanes <= n; i += lanes {
+			v := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&x[i])))
+			d := v.Sub(vShift)
+			vSum = vSum.Add(d)
+			vSq = d.MulAdd(d, vSq)
+			vMin = vMin.Min(v)
+			vMax = vMax.Max(v)
+		}
+		minVal = hwy.ReduceMin_AVX2_F64x4(vMin)
+		maxVal = hwy.ReduceMax_AVX2_F64x4(vMax)
+	}
+	sum = hwy.ReduceSum_AVX2_F64x4(vSum)
+	sumSq = hwy.ReduceSum_AVX2_F64x4(vSq)
+	for ; i < n; i++ {
+		d := x[i] - shift
+		sum += d
+		sumSq += d * d
+		minVal = min(minVal, x[i])
+		maxVal = max(maxVal, x[i])
+	}
+	return sum, sumSq, minVal, maxVal
+}
@@ -0,0 +1,189 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package stats
+
+import (
+	"simd/archsimd"
+	"sync"
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/math"
+)
+
+// Hoisted constants - lazily initialized on first use to avoid init-time crashes
+var (
+	BaseBinIndices_AVX512_vOne_f32    archsimd.Float32x16
+	BaseLogBinIndices_AVX512_vOne_f32 archsimd.Float32x16
+	_statsBaseHoistOnce               sync.Once
+)
+
+func _statsBaseInitHoistedConstants() {
+	_statsBaseHoistOnce.Do(func() {
+		BaseBinIndices_AVX512_vOne_f32 = archsimd.BroadcastFloat32x16(1)
+		BaseLogBinIndices_AVX512_vOne_f32 = archsimd.BroadcastFloat32x16(1)
+	})
+}
+
+func BaseBinIndices_avx512(x []float32, lo float32, invWidth float32, bins int, idx []int32) {
+	_statsBaseInitHoistedConstants()
+	n := len(x)
+	if n == 0 {
+		return
+	}
+	_ = idx[n-1]
+	vLo := archsimd.BroadcastFloat32x16(lo)
+	vInv := archsimd.BroadcastFloat32x16(invWidth)
+	vOne := BaseBinIndices_AVX512_vOne_f32
+	vZero := archsimd.BroadcastFloat32x16(0)
+	vTop := archsimd.BroadcastFloat32x16(float32(bins + 1))
+	vNaN := archsimd.BroadcastFloat32x16(float32(bins + 2))
+	lanes := 16
+	var i int
+	i = 0
+	for ; i+lanes*3 <= n; i += lanes * 3 {
+		v := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&x[i])))
+		t := v.Sub(vLo).MulAdd(vInv, vOne)
+		t = t.Max(vZero).Min(vTop)
+		t = vNaN.Merge(t, v.Equal(v).Xor(archsimd.BroadcastFloat32x16(1.0).Equal(archsimd.BroadcastFloat32x16(1.0))))
+		slot := t.ConvertToInt32()
+		slot.StoreSlice(idx[i:])
+		v1 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&x[i+16])))
+		t1 := v1.Sub(vLo).MulAdd(vInv, vOne)
+		t1 = t1.Max(vZero).Min(vTop)
+		t1 = vNaN.Merge(t1, v1.Equal(v1).Xor(archsimd.BroadcastFloat32x16(1.0).Equal(archsimd.BroadcastFloat32x16(1.0))))
+		slot1 := t1.ConvertToInt32()
+		slot1.StoreSlice(idx[i+16:])
+		v2 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&x[i+32])))
+		t2 := v2.Sub(vLo).MulAdd(vInv, vOne)
+		t2 = t2.Max(vZero).Min(vTop)
+		t2 = vNaN.Merge(t2, v2.Equal(v2).Xor(archsimd.BroadcastFloat32x16(1.0).Equal(archsimd.BroadcastFloat32x16(1.0))))
+		slot2 := t2.ConvertToInt32()
+		slot2.StoreSlice(idx[i+32:])
+	}
+	for ; i < n; i++ {
+		idx[i] = binSlot((x[i]-lo)*invWidth, x[i] != x[i], bins)
+	}
+}
+
+func BaseLogBinIndices_avx512(x []float32, offset float32, binsPerOctave float32, bins int, idx []int32) {
+	_statsBaseInitHoistedConstants()
+	n := len(x)
+	if n == 0 {
+		return
+	}
+	_ = idx[n-1]
+	vOffset := archsimd.BroadcastFloat32x16(offset)
+	vScale := archsimd.BroadcastFloat32x16(binsPerOctave)
+	vOne := BaseLogBinIndices_AVX512_vOne_f32
+	vZero := archsimd.BroadcastFloat32x16(0)
+	vTop := archsimd.BroadcastFloat32x16(float32(bins + 1))
+	vNaN := archsimd.BroadcastFloat32x16(float32(bins + 2))
+	lanes := 16
+	var i int
+	i = 0
+	for ; i+lanes*3 <= n; i += lanes * 3 {
+		v := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&x[i])))
+		pos := v.Greater(vZero)
+		l := math.BaseLog2Vec_avx512(v.Merge(vOne, pos))
+		t := l.Mul(vScale).Sub(vOffset).Add(vOne)
+		t = t.Max(vZero).Min(vTop)
+		t = t.Merge(vZero, pos)
+		t = vNaN.Merge(t, v.Equal(v).Xor(archsimd.BroadcastFloat32x16(1.0).Equal(archsimd.BroadcastFloat32x16(1.0))))
+		slot := t.ConvertToInt32()
+		slot.StoreSlice(idx[i:])
+		v1 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&x[i+16])))
+		pos1 := v1.Greater(vZero)
+		l1 := math.BaseLog2Vec_avx512(v1.Merge(vOne, pos1))
+		t1 := l1.Mul(vScale).Sub(vOffset).Add(vOne)
+		t1 = t1.Max(vZero).Min(vTop)
+		t1 = t1.Merge(vZero, pos1)
+		t1 = vNaN.Merge(t1, v1.Equal(v1).Xor(archsimd.BroadcastFloat32x16(1.0).Equal(archsimd.BroadcastFloat32x16(1.0))))
+		slot1 := t1.ConvertToInt32()
+		slot1.StoreSlice(idx[i+16:])
+		v2 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&x[i+32])))
+		pos2 := v2.Greater(vZero)
+		l2 := math.BaseLog2Vec_avx512(v2.Merge(vOne, pos2))
+		t2 := l2.Mul(vScale).Sub(vOffset).Add(vOne)
+		t2 = t2.Max(vZero).Min(vTop)
+		t2 = t2.Merge(vZero, pos2)
+		t2 = vNaN.Merge(t2, v2.Equal(v2).Xor(archsimd.BroadcastFloat32x16(1.0).Equal(archsimd.BroadcastFloat32x16(1.0))))
+		slot2 := t2.ConvertToInt32()
+		slot2.StoreSlice(idx[i+32:])
+	}
+	for ; i < n; i++ {
+		idx[i] = logBinSlot(x[i], offset, binsPerOctave, bins)
+	}
+}
+
+func BaseMoments_avx512(x []float32, shift float32) (sum float32, sumSq float32, minVal float32, maxVal float32) {
+	_statsBaseInitHoistedConstants()
+	n := len(x)
+	vShift := archsimd.BroadcastFloat32x16(shift)
+	vSum := archsimd.BroadcastFloat32x16(0)
+	vSq := archsimd.BroadcastFloat32x16(0)
+	lanes := 16
+	minVal, maxVal = x[0], x[0]
+	var i int
+	if n >= lanes {
+		vMin := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&x[0])))
+		vMax := vMin
+		for i = 0; i+lanes <= n; i += lanes {
+			v := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&x[i])))
+			d := v.Sub(vShift)
+			vSum = vSum.Add(d)
+			vSq = d.MulAdd(d, vSq)
+			vMin = vMin.Min(v)
+			vMax = vMax.Max(v)
+		}
+		minVal = hwy.ReduceMin_AVX512_F32x16(vMin)
+		maxVal = hwy.ReduceMax_AVX512_F32x16(vMax)
+	}
+	sum = hwy.ReduceSum_AVX512_F32x16(vSum)
+	sumSq = hwy.ReduceSum_AVX512_F32x16(vSq)
+	for ; i < n; i++ {
+		d := x[i] - shift
+		sum += d
+		sumSq += d * d
+		minVal = min(minVal, x[i])
+		maxVal = max(maxVal, x[i])
+	}
+	return sum, sumSq, minVal, maxVal
+}
+
+func BaseMoments_avx512_Float64(x []float64, shift float64) (sum float64, sumSq float64, minVal float64, maxVal float64) {
+	_statsBaseInitHoistedConstants()
+	n := len(x)
+	vShift := archsimd.BroadcastFloat64x8(shift)
+	vSum := archsimd.BroadcastFloat64x8(0)
+	vSq := archsimd.BroadcastFloat64x8(0)
+	lanes := 8
+	minVal, maxVal = x[0], x[0]
+	var i int
+	if n >= lanes {
+		vMin := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&x[0])))
+		vMax := vMin
+		for i = 0; i+lanes <= n; i += lanes {
+			v := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&x[i])))
+			d := v.Sub(vShift)
+			vSum = vSum.Add(d)
+			vSq = d.MulAdd(d, vSq)
+			vMin = vMin.Min(v)
+			vMax = vMax.Max(v)
+		}
+		minVal = hwy.ReduceMin_AVX512_F64x8(vMin)
+		maxVal = hwy.ReduceMax_AVX512_F64x8(vMax)
+	}
+	sum = hwy.ReduceSum_AVX512_F64x8(vSum)
+	sumSq = hwy.ReduceSum_AVX512_F64x8(vSq)
+	for ; i < n; i++ {
+		d := x[i] - shift
+		sum += d
+		sumSq += d * d
+		minVal = min(minVal, x[i])
+		maxVal = max(maxVal, x[i])
+	}
+	return sum, sumSq, minVal, maxVal
+}
@@ -0,0 +1,131 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package stats
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/math"
+)
+
+func BaseBinIndices_fallback(x []float32, lo float32, invWidth float32, bins int, idx []int32) {
+	n := len(x)
+	if n == 0 {
+		return
+	}
+	_ = idx[n-1]
+	vLo := hwy.Set[float32](lo)
+	vInv := hwy.Set[float32](invWidth)
+	vOne := hwy.Set[float32](1)
+	vZero := hwy.Zero[float32]()
+	vTop := hwy.Set(float32(bins + 1))
+	vNaN := hwy.Set(float32(bins + 2))
+	lanes := vLo.NumLanes()
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		v := hwy.Load(x[i:])
+		t := hwy.MulAdd(hwy.Sub(v, vLo), vInv, vOne)
+		t = hwy.Clamp(t, vZero, vTop)
+		t = hwy.Merge(vNaN, t, hwy.IsNaN(v))
+		slot := hwy.ConvertToInt32(t)
+		hwy.StoreSlice(slot, idx[i:])
+	}
+	for ; i < n; i++ {
+		idx[i] = binSlot((x[i]-lo)*invWidth, x[i] != x[i], bins)
+	}
+}
+
+func BaseLogBinIndices_fallback(x []float32, offset float32, binsPerOctave float32, bins int, idx []int32) {
+	n := len(x)
+	if n == 0 {
+		return
+	}
+	_ = idx[n-1]
+	vOffset := hwy.Set[float32](offset)
+	vScale := hwy.Set[float32](binsPerOctave)
+	vOne := hwy.Set[float32](1)
+	vZero := hwy.Zero[float32]()
+	vTop := hwy.Set(float32(bins + 1))
+	vNaN := hwy.Set(float32(bins + 2))
+	lanes := vOne.NumLanes()
+	var i int
+	for i = 0; i+lanes <= n; i += lanes {
+		v := hwy.Load(x[i:])
+		pos := hwy.Greater(v, vZero)
+		l := math.BaseLog2Vec_fallback(hwy.Merge(v, vOne, pos))
+		t := hwy.Add(hwy.Sub(hwy.Mul(l, vScale), vOffset), vOne)
+		t = hwy.Clamp(t, vZero, vTop)
+		t = hwy.Merge(t, vZero, pos)
+		t = hwy.Merge(vNaN, t, hwy.IsNaN(v))
+		slot := hwy.ConvertToInt32(t)
+		hwy.StoreSlice(slot, idx[i:])
+	}
+	for ; i < n; i++ {
+		idx[i] = logBinSlot(x[i], offset, binsPerOctave, bins)
+	}
+}
+
+func BaseMoments_fallback(x []float32, shift float32) (sum float32, sumSq float32, minVal float32, maxVal float32) {
+	n := len(x)
+	vShift := float32(shift)
+	vSum := float32(0)
+	vSq := float32(0)
+	minVal, maxVal = x[0], x[0]
+	var i int
+	if n >= 1 {
+		vMin := x[0]
+		vMax := vMin
+		for i = 0; i < n; i++ {
+			v := x[i]
+			d := v - vShift
+			vSum = vSum + d
+			vSq = d*d + vSq
+			vMin = min(vMin, v)
+			vMax = max(vMax, v)
+		}
+		minVal = vMin
+		maxVal = vMax
+	}
+	sum = vSum
+	sumSq = vSq
+	for ; i < n; i++ {
+		d := x[i] - shift
+		sum += d
+		sumSq += d * d
+		minVal = min(minVal, x[i])
+		maxVal = max(maxVal, x[i])
+	}
+	return sum, sumSq, minVal, maxVal
+}
+
+func BaseMoments_fallback_Float64(x []float64, shift float64) (sum float64, sumSq float64, minVal float64, maxVal float64) {
+	n := len(x)
+	vShift := float64(shift)
+	vSum := float64(0)
+	vSq := float64(0)
+	minVal, maxVal = x[0], x[0]
+	var i int
+	if n >= 1 {
+		vMin := x[0]
+		vMax := vMin
+		for i = 0; i < n; i++ {
+			v := x[i]
+			d := v - vShift
+			vSum = vSum + d
+			vSq = d*d + vSq
+			vMin = min(vMin, v)
+			vMax = max(vMax, v)
+		}
+		minVal = vMin
+		maxVal = vMax
+	}
+	sum = vSum
+	sumSq = vSq
+	for ; i < n; i++ {
+		d := x[i] - shift
+		sum += d
+		sumSq += d * d
+		minVal = min(minVal, x[i])
+		maxVal = max(maxVal, x[i])
+	}
+	return sum, sumSq, minVal, maxVal
+}
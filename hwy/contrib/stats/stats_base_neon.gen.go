@@ -0,0 +1,160 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package stats
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy/asm"
+	"github.com/ajroetker/go-highway/hwy/contrib/math"
+)
+
+// Hoisted constants - pre-broadcasted at package init time
+var (
+	BaseBinIndices_NEON_vOne_f32    = asm.BroadcastFloat32x4(1)
+	BaseLogBinIndices_NEON_vOne_f32 = asm.BroadcastFloat32x4(1)
+)
+
+func BaseBinIndices_neon(x []float32, lo float32, invWidth float32, bins int, idx []int32) {
+	n := len(x)
+	if n == 0 {
+		return
+	}
+	_ = idx[n-1]
+	vLo := asm.BroadcastFloat32x4(lo)
+	vInv := asm.BroadcastFloat32x4(invWidth)
+	vOne := BaseBinIndices_NEON_vOne_f32
+	vZero := asm.ZeroFloat32x4()
+	vTop := asm.BroadcastFloat32x4(float32(bins + 1))
+	vNaN := asm.BroadcastFloat32x4(float32(bins + 2))
+	lanes := 4
+	var i int
+	i = 0
+	for ; i+lanes*2 <= n; i += lanes * 2 {
+		v := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&x[i])))
+		t := v.Sub(vLo).MulAdd(vInv, vOne)
+		t = t.Max(vZero).Min(vTop)
+		t = vNaN.Merge(t, v.Equal(v).Xor(asm.BroadcastFloat32x4(1.0).Equal(asm.BroadcastFloat32x4(1.0))))
+		slot := t.ConvertToInt32()
+		slot.StoreSlice(idx[i:])
+		v1 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&x[i+4])))
+		t1 := v1.Sub(vLo).MulAdd(vInv, vOne)
+		t1 = t1.Max(vZero).Min(vTop)
+		t1 = vNaN.Merge(t1, v1.Equal(v1).Xor(asm.BroadcastFloat32x4(1.0).Equal(asm.BroadcastFloat32x4(1.0))))
+		slot1 := t1.ConvertToInt32()
+		slot1.StoreSlice(idx[i+4:])
+	}
+	for ; i < n; i++ {
+		idx[i] = binSlot((x[i]-lo)*invWidth, x[i] != x[i], bins)
+	}
+}
+
+func BaseLogBinIndices_neon(x []float32, offset float32, binsPerOctave float32, bins int, idx []int32) {
+	n := len(x)
+	if n == 0 {
+		return
+	}
+	_ = idx[n-1]
+	vOffset := asm.BroadcastFloat32x4(offset)
+	vScale := asm.BroadcastFloat32x4(binsPerOctave)
+	vOne := BaseLogBinIndices_NEON_vOne_f32
+	vZero := asm.ZeroFloat32x4()
+	vTop := asm.BroadcastFloat32x4(float32(bins + 1))
+	vNaN := asm.BroadcastFloat32x4(float32(bins + 2))
+	lanes := 4
+	var i int
+	i = 0
+	for ; i+lanes*2 <= n; i += lanes * 2 {
+		v := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&x[i])))
+		pos := v.Greater(vZero)
+		l := math.BaseLog2Vec_neon(v.Merge(vOne, pos))
+		t := l.Mul(vScale).Sub(vOffset).Add(vOne)
+		t = t.Max(vZero).Min(vTop)
+		t = t.Merge(vZero, pos)
+		t = vNaN.Merge(t, v.Equal(v).Xor(asm.BroadcastFloat32x4(1.0).Equal(asm.BroadcastFloat32x4(1.0))))
+		slot := t.ConvertToInt32()
+		slot.StoreSlice(idx[i:])
+		v1 := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&x[i+4])))
+		pos1 := v1.Greater(vZero)
+		l1 := math.BaseLog2Vec_neon(v1.Merge(vOne, pos1))
+		t1 := l1.Mul(vScale).Sub(vOffset).Add(vOne)
+		t1 = t1.Max(vZero).Min(vTop)
+		t1 = t1.Merge(vZero, pos1)
+		t1 = vNaN.Merge(t1, v1.Equal(v1).Xor(asm.BroadcastFloat32x4(1.0).Equal(asm.BroadcastFloat32x4(1.0))))
+		slot1 := t1.ConvertToInt32()
+		slot1.StoreSlice(idx[i+4:])
+	}
+	for ; i < n; i++ {
+		idx[i] = logBinSlot(x[i], offset, binsPerOctave, bins)
+	}
+}
+
+func BaseMoments_neon(x []float32, shift float32) (sum float32, sumSq float32, minVal float32, maxVal float32) {
+	n := len(x)
+	vShift := asm.BroadcastFloat32x4(shift)
+	vSum := asm.ZeroFloat32x4()
+	vSq := asm.ZeroFloat32x4()
+	lanes := 4
+	minVal, maxVal = x[0], x[0]
+	var i int
+	if n >= lanes {
+		vMin := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&x[0])))
+		vMax := vMin
+		for i = 0; i+lanes <= n; i += lanes {
+			v := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&x[i])))
+			d := v.Sub(vShift)
+			vSum = vSum.Add(d)
+			d.MulAddAcc(d, &vSq)
+			vMin = vMin.Min(v)
+			vMax = vMax.Max(v)
+		}
+		minVal = vMin.ReduceMin()
+		maxVal = vMax.ReduceMax()
+	}
+	sum = vSum.ReduceSum()
+	sumSq = vSq.ReduceSum()
+	for ; i < n; i++ {
+		d := x[i] - shift
+		sum += d
+		sumSq += d * d
+		minVal = min(minVal, x[i])
+		maxVal = max(maxVal, x[i])
+	}
+	return sum, sumSq, minVal, maxVal
+}
+
+func BaseMoments_neon_Float64(x []float64, shift float64) (sum float64, sumSq float64, minVal float64, maxVal float64) {
+	n := len(x)
+	vShift := asm.BroadcastFloat64x2(shift)
+	vSum := asm.ZeroFloat64x2()
+	vSq := asm.ZeroFloat64x2()
+	lanes := 2
+	minVal, maxVal = x[0], x[0]
+	var i int
+	if n >= lanes {
+		vMin := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&x[0])))
+		vMax := vMin
+		for i = 0; i+lanes <= n; i += lanes {
+			v := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&x[i])))
+			d := v.Sub(vShift)
+			vSum = vSum.Add(d)
+			vSq = d.MulAdd(d, vSq)
+			vMin = vMin.Min(v)
+			vMax = vMax.Max(v)
+		}
+		minVal = vMin.ReduceMin()
+		maxVal = vMax.ReduceMax()
+	}
+	sum = vSum.ReduceSum()
+	sumSq = vSq.ReduceSum()
+	for ; i < n; i++ {
+		d := x[i] - shift
+		sum += d
+		sumSq += d * d
+		minVal = min(minVal, x[i])
+		maxVal = max(maxVal, x[i])
+	}
+	return sum, sumSq, minVal, maxVal
+}
@@ -0,0 +1,48 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package stats
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("stats", "BinIndices", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := BinIndices; hwyImpl != nil {
+			BinIndices = func(x []float32, lo float32, invWidth float32, bins int, idx []int32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, lo, invWidth, bins, idx)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(idx))
+			}
+		}
+	})
+	hwy.ProfileDispatch("stats", "LogBinIndices", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := LogBinIndices; hwyImpl != nil {
+			LogBinIndices = func(x []float32, offset float32, binsPerOctave float32, bins int, idx []int32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(x, offset, binsPerOctave, bins, idx)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x)+hwy.SliceBytes(idx))
+			}
+		}
+	})
+	hwy.ProfileDispatch("stats", "Moments", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MomentsFloat32; hwyImpl != nil {
+			MomentsFloat32 = func(x []float32, shift float32) (sum float32, sumSq float32, minVal float32, maxVal float32) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1, hwyR2, hwyR3 := hwyImpl(x, shift)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+				return hwyR0, hwyR1, hwyR2, hwyR3
+			}
+		}
+		if hwyImpl := MomentsFloat64; hwyImpl != nil {
+			MomentsFloat64 = func(x []float64, shift float64) (sum float64, sumSq float64, minVal float64, maxVal float64) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1, hwyR2, hwyR3 := hwyImpl(x, shift)
+				hwyCounter.Done(hwyStart, len(x), hwy.SliceBytes(x))
+				return hwyR0, hwyR1, hwyR2, hwyR3
+			}
+		}
+	})
+}
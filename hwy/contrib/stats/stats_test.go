@@ -0,0 +1,260 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package stats
+
+import (
+	"fmt"
+	"math"
+	"math/rand"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// reference returns the mean, population variance, min and max of x in
+// float64 with the two-pass algorithm.
+func reference[T float32 | float64](x []T) (mean, variance float64, lo, hi T) {
+	lo, hi = x[0], x[0]
+	for _, v := range x {
+		mean += float64(v)
+		lo = min(lo, v)
+		hi = max(hi, v)
+	}
+	mean /= float64(len(x))
+	for _, v := range x {
+		d := float64(v) - mean
+		variance += d * d
+	}
+	return mean, variance / float64(len(x)), lo, hi
+}
+
+func checkStats[T float32 | float64](t *testing.T, name string, s *Stats[T], x []T, tol float64) {
+	t.Helper()
+	mean, variance, lo, hi := reference(x)
+	if s.Count() != int64(len(x)) {
+		t.Fatalf("%s: Count = %d, want %d", name, s.Count(), len(x))
+	}
+	if math.Abs(s.Mean()-mean) > tol*(1+math.Abs(mean)) {
+		t.Errorf("%s: Mean = %v, want %v", name, s.Mean(), mean)
+	}
+	if math.Abs(s.Variance()-variance) > tol*(1+variance) {
+		t.Errorf("%s: Variance = %v, want %v", name, s.Variance(), variance)
+	}
+	if s.Min() != lo || s.Max() != hi {
+		t.Errorf("%s: Min/Max = %v/%v, want %v/%v", name, s.Min(), s.Max(), lo, hi)
+	}
+}
+
+func TestStats(t *testing.T) {
+	rng := rand.New(rand.NewSource(1))
+	for _, n := range []int{1, 3, 8, 17, 1023, 1024, 1025, 5000} {
+		x32 := make([]float32, n)
+		x64 := make([]float64, n)
+		for i := range x32 {
+			// A large offset stresses the numerical stability of the update.
+			x64[i] = 1e4 + rng.NormFloat64()*3
+			x32[i] = float32(x64[i])
+		}
+		var s32 Stats[float32]
+		s32.Add(x32)
+		checkStats(t, fmt.Sprintf("float32/n=%d", n), &s32, x32, 1e-4)
+		var s64 Stats[float64]
+		s64.Add(x64)
+		checkStats(t, fmt.Sprintf("float64/n=%d", n), &s64, x64, 1e-9)
+	}
+}
+
+func TestStatsMerge(t *testing.T) {
+	rng := rand.New(rand.NewSource(2))
+	x := make([]float64, 3000)
+	for i := range x {
+		x[i] = rng.ExpFloat64()
+	}
+	// Uneven pieces added in small slices, merged in a tree.
+	var a, b, c Stats[float64]
+	for i := 0; i < 700; i += 7 {
+		a.Add(x[i : i+7])
+	}
+	b.Add(x[700:701])
+	c.Add(x[701:])
+	var empty Stats[float64]
+	b.Merge(empty)
+	b.Merge(c)
+	a.Merge(b)
+	checkStats(t, "merged", &a, x, 1e-12)
+
+	empty.Merge(a)
+	checkStats(t, "merged into empty", &empty, x, 1e-12)
+	if a.SampleVariance() <= a.Variance() {
+		t.Errorf("SampleVariance %v not above Variance %v", a.SampleVariance(), a.Variance())
+	}
+	a.Reset()
+	if a.Count() != 0 || !math.IsNaN(a.Mean()) {
+		t.Errorf("Reset left count %d mean %v", a.Count(), a.Mean())
+	}
+}
+
+func TestCompute(t *testing.T) {
+	pool := workerpool.New(4)
+	defer pool.Close()
+	rng := rand.New(rand.NewSource(3))
+	x := make([]float32, 300001)
+	for i := range x {
+		x[i] = rng.Float32()*10 - 5
+	}
+	s := Compute(pool, x)
+	checkStats(t, "parallel", &s, x, 1e-5)
+	if again := Compute(pool, x); again != s {
+		t.Errorf("parallel result not deterministic: %+v vs %+v", again, s)
+	}
+}
+
+func TestHistogram(t *testing.T) {
+	rng := rand.New(rand.NewSource(4))
+	h := NewHistogram(-2, 2, 16)
+	x := make([]float32, 5003)
+	for i := range x {
+		x[i] = float32(rng.NormFloat64())
+	}
+	x[0] = float32(math.NaN())
+	x[1] = float32(math.Inf(1))
+	x[2] = float32(math.Inf(-1))
+	x[3] = 2 // upper edge is exclusive
+	x[4] = -2
+	h.Add(x[:100])
+	h.Add(x[100:])
+
+	want := make([]uint64, 16)
+	var under, over, nan uint64
+	for _, v := range x {
+		switch {
+		case v != v:
+			nan++
+		case v < -2:
+			under++
+		case v >= 2:
+			over++
+		default:
+			want[int((float64(v)+2)/0.25)]++
+		}
+	}
+	for i, c := range h.Counts() {
+		if c != want[i] {
+			t.Errorf("bin %d [%v, %v): count %d, want %d", i, h.Edge(i), h.Edge(i+1), c, want[i])
+		}
+	}
+	if h.Underflow() != under || h.Overflow() != over || h.NaN() != nan {
+		t.Errorf("under/over/NaN = %d/%d/%d, want %d/%d/%d", h.Underflow(), h.Overflow(), h.NaN(), under, over, nan)
+	}
+
+	other := NewHistogram(-2, 2, 16)
+	other.Add(x)
+	h.Merge(other)
+	if h.Counts()[8] != 2*want[8] {
+		t.Errorf("merged bin 8 count %d, want %d", h.Counts()[8], 2*want[8])
+	}
+}
+
+func TestLogHistogram(t *testing.T) {
+	rng := rand.New(rand.NewSource(5))
+	h := NewLogHistogram(1e-3, 1e3, 4)
+	if h.Bins() != 80 {
+		t.Fatalf("Bins = %d, want 80", h.Bins())
+	}
+	x := make([]float32, 4099)
+	for i := range x {
+		x[i] = float32(math.Exp(rng.Float64()*20 - 10))
+	}
+	x[0], x[1], x[2] = 0, -1, float32(math.NaN())
+	h.Add(x)
+
+	want := make([]uint64, h.Bins())
+	var under, over uint64
+	for _, v := range x[3:] {
+		switch b := math.Floor(math.Log2(float64(v)/1e-3) * 4); {
+		case b < 0:
+			under++
+		case b >= float64(h.Bins()):
+			over++
+		default:
+			want[int(b)]++
+		}
+	}
+	under += 2
+	// The vector log2 is approximate, so values within rounding of an edge
+	// may land in the neighboring bin.
+	var diff uint64
+	for i, c := range h.Counts() {
+		if c > want[i] {
+			diff += c - want[i]
+		} else {
+			diff += want[i] - c
+		}
+	}
+	if diff > 4 {
+		t.Errorf("counts differ from reference by %d: got %v, want %v", diff, h.Counts(), want)
+	}
+	if h.Underflow() < under-2 || h.Underflow() > under+2 || h.NaN() != 1 {
+		t.Errorf("under/NaN = %d/%d, want %d/1", h.Underflow(), h.NaN(), under)
+	}
+	if over != 0 && h.Overflow() == 0 {
+		t.Errorf("Overflow = 0, want about %d", over)
+	}
+	if e := h.Edge(4); math.Abs(e-2e-3) > 1e-9 {
+		t.Errorf("Edge(4) = %v, want 0.002", e)
+	}
+}
+
+func TestAccumulate(t *testing.T) {
+	rng := rand.New(rand.NewSource(6))
+	x := make([]float32, 10000)
+	for i := range x {
+		x[i] = rng.Float32()
+	}
+	var s Stats[float32]
+	h := NewHistogram(0, 1, 10)
+	Accumulate(x, &s, h)
+	checkStats(t, "accumulate", &s, x, 1e-5)
+	var total uint64
+	for _, c := range h.Counts() {
+		total += c
+	}
+	if total != uint64(len(x)) {
+		t.Errorf("histogram total %d, want %d", total, len(x))
+	}
+}
+
+func BenchmarkAccumulate(b *testing.B) {
+	rng := rand.New(rand.NewSource(1))
+	x := make([]float32, 1<<16)
+	for i := range x {
+		x[i] = rng.Float32()
+	}
+	b.Run("Stats", func(b *testing.B) {
+		b.SetBytes(int64(len(x) * 4))
+		for i := 0; i < b.N; i++ {
+			var s Stats[float32]
+			s.Add(x)
+		}
+	})
+	b.Run("StatsHistogram", func(b *testing.B) {
+		h := NewHistogram(0, 1, 64)
+		b.SetBytes(int64(len(x) * 4))
+		for i := 0; i < b.N; i++ {
+			var s Stats[float32]
+			Accumulate(x, &s, h)
+		}
+	})
+}
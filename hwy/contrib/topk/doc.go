@@ -0,0 +1,41 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Package topk provides SIMD-assisted top-k selection over float32
+// distances, the final step of every nearest-neighbor search.
+//
+// # Selection
+//
+// Heap keeps the k smallest distances seen so far. Batches of distances are
+// filtered against the current k-th best distance with the SelectLess
+// kernel, which compares a whole vector per instruction and extracts the
+// passing lanes from the comparison mask; only those candidates touch the
+// heap.
+//
+//	h := topk.New(10)
+//	vec.BatchL2SquaredDistance(query, data, dists, count, dims)
+//	h.PushRange(dists, 0)
+//	best := h.Sorted(nil) // []topk.Neighbor by increasing distance
+//
+// # Kernels
+//
+//   - SelectLess(dist, threshold, idx) - Indices of all elements below a
+//     threshold
+//
+// # Build Requirements
+//
+// The SIMD implementations require:
+//   - GOEXPERIMENT=simd build flag
+//   - AMD64 architecture with AVX2 or AVX-512 support, or ARM64 with NEON
+package topk
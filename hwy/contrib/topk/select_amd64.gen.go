@@ -0,0 +1,56 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package topk
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var SelectLess func(dist []float32, threshold float32, idx []int32) int
+
+func init() {
+	initSelectAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "topk",
+		Groups: []hwy.DispatchGroup{
+			{Name: "SelectLess", Vars: []any{&SelectLess}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initSelectAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initSelectAVX2},
+			{Name: "fallback", Supported: true, Init: initSelectFallback},
+		},
+	})
+}
+
+func initSelectAll() {
+	if hwy.NoSimdEnv() {
+		initSelectFallback()
+		return
+	}
+	if archsimd.X86.AVX512() {
+		initSelectAVX512()
+		return
+	}
+	if archsimd.X86.AVX2() {
+		initSelectAVX2()
+		return
+	}
+	initSelectFallback()
+}
+
+func initSelectAVX2() {
+	SelectLess = BaseSelectLess_avx2
+}
+
+func initSelectAVX512() {
+	SelectLess = BaseSelectLess_avx512
+}
+
+func initSelectFallback() {
+	SelectLess = BaseSelectLess_fallback
+}
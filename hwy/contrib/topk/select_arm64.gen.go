@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package topk
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var SelectLess func(dist []float32, threshold float32, idx []int32) int
+
+func init() {
+	initSelectAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "topk",
+		Groups: []hwy.DispatchGroup{
+			{Name: "SelectLess", Vars: []any{&SelectLess}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initSelectNEON},
+			{Name: "fallback", Supported: true, Init: initSelectFallback},
+		},
+	})
+}
+
+func initSelectAll() {
+	if hwy.NoSimdEnv() {
+		initSelectFallback()
+		return
+	}
+	initSelectNEON()
+	return
+}
+
+func initSelectNEON() {
+	SelectLess = BaseSelectLess_neon
+}
+
+func initSelectFallback() {
+	SelectLess = BaseSelectLess_fallback
+}
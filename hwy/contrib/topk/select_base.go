@@ -0,0 +1,58 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package topk
+
+//go:generate go run ../../../cmd/hwygen -input select_base.go -output . -targets avx2,avx512,neon,fallback -dispatch select
+
+import (
+	"math/bits"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+// BaseSelectLess writes the indices of the elements of dist that are less
+// than threshold to idx, in increasing order, and returns their number.
+// idx must have room for len(dist) entries.
+//
+// Each vector is compared against the threshold at once and only the lanes
+// that pass are visited, so the cost is dominated by the comparison when
+// few elements qualify, as is typical once a top-k heap has filled up.
+func BaseSelectLess(dist []float32, threshold float32, idx []int32) int {
+	n := len(dist)
+	if n == 0 {
+		return 0
+	}
+	_ = idx[n-1]
+	thrVec := hwy.Set[float32](threshold)
+	lanes := thrVec.NumLanes()
+	count := 0
+	i := 0
+	//hwy:unroll 1
+	for ; i+lanes <= n; i += lanes {
+		mask := hwy.BitsFromMask(hwy.LessThan(hwy.LoadSlice(dist[i:]), thrVec))
+		for mask != 0 {
+			idx[count] = int32(i + bits.TrailingZeros64(mask))
+			count++
+			mask &= mask - 1
+		}
+	}
+	for ; i < n; i++ {
+		if dist[i] < threshold {
+			idx[count] = int32(i)
+			count++
+		}
+	}
+	return count
+}
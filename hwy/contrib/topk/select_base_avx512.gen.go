@@ -0,0 +1,39 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package topk
+
+import (
+	"math/bits"
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func BaseSelectLess_avx512(dist []float32, threshold float32, idx []int32) int {
+	n := len(dist)
+	if n == 0 {
+		return 0
+	}
+	_ = idx[n-1]
+	thrVec := archsimd.BroadcastFloat32x16(threshold)
+	lanes := 16
+	count := 0
+	i := 0
+	for ; i+lanes <= n; i += lanes {
+		mask := hwy.BitsFromMask_AVX512_F32x16(archsimd.LoadFloat32x16Slice(dist[i:]).Less(thrVec))
+		for mask != 0 {
+			idx[count] = int32(i + bits.TrailingZeros64(mask))
+			count++
+			mask &= mask - 1
+		}
+	}
+	for ; i < n; i++ {
+		if dist[i] < threshold {
+			idx[count] = int32(i)
+			count++
+		}
+	}
+	return count
+}
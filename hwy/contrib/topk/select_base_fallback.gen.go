@@ -0,0 +1,36 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package topk
+
+import (
+	"math/bits"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func BaseSelectLess_fallback(dist []float32, threshold float32, idx []int32) int {
+	n := len(dist)
+	if n == 0 {
+		return 0
+	}
+	_ = idx[n-1]
+	thrVec := hwy.Set[float32](threshold)
+	lanes := thrVec.NumLanes()
+	count := 0
+	i := 0
+	for ; i+lanes <= n; i += lanes {
+		mask := hwy.BitsFromMask(hwy.LessThan(hwy.LoadSlice(dist[i:]), thrVec))
+		for mask != 0 {
+			idx[count] = int32(i + bits.TrailingZeros64(mask))
+			count++
+			mask &= mask - 1
+		}
+	}
+	for ; i < n; i++ {
+		if dist[i] < threshold {
+			idx[count] = int32(i)
+			count++
+		}
+	}
+	return count
+}
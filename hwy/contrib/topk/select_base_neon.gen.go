@@ -0,0 +1,39 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package topk
+
+import (
+	"math/bits"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/asm"
+)
+
+func BaseSelectLess_neon(dist []float32, threshold float32, idx []int32) int {
+	n := len(dist)
+	if n == 0 {
+		return 0
+	}
+	_ = idx[n-1]
+	thrVec := asm.BroadcastFloat32x4(threshold)
+	lanes := 4
+	count := 0
+	i := 0
+	for ; i+lanes <= n; i += lanes {
+		mask := hwy.BitsFromMask_NEON_F32x4(asm.LoadFloat32x4Slice(dist[i:]).LessThan(thrVec))
+		for mask != 0 {
+			idx[count] = int32(i + bits.TrailingZeros64(mask))
+			count++
+			mask &= mask - 1
+		}
+	}
+	for ; i < n; i++ {
+		if dist[i] < threshold {
+			idx[count] = int32(i)
+			count++
+		}
+	}
+	return count
+}
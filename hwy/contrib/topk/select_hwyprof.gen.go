@@ -0,0 +1,22 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package topk
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("topk", "SelectLess", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SelectLess; hwyImpl != nil {
+			SelectLess = func(dist []float32, threshold float32, idx []int32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(dist, threshold, idx)
+				hwyCounter.Done(hwyStart, len(dist), hwy.SliceBytes(dist)+hwy.SliceBytes(idx))
+				return hwyR0
+			}
+		}
+	})
+}
@@ -0,0 +1,32 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build !arm64 && !(amd64 && goexperiment.simd)
+
+package topk
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var SelectLess func(dist []float32, threshold float32, idx []int32) int
+
+func init() {
+	initSelectAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "topk",
+		Groups: []hwy.DispatchGroup{
+			{Name: "SelectLess", Vars: []any{&SelectLess}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initSelectFallback},
+		},
+	})
+}
+
+func initSelectAll() {
+	initSelectFallback()
+}
+
+func initSelectFallback() {
+	SelectLess = BaseSelectLess_fallback
+}
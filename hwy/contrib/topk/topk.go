@@ -0,0 +1,199 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package topk
+
+import (
+	"math"
+	"slices"
+)
+
+// Neighbor is a candidate id together with its distance.
+type Neighbor struct {
+	ID   int64
+	Dist float32
+}
+
+// pushBatch is the number of distances filtered by SelectLess at a time.
+// The threshold is refreshed between batches as the heap tightens.
+const pushBatch = 256
+
+// Heap keeps the k candidates with the smallest distances seen so far.
+//
+// It is a bounded max-heap: the root is the current k-th best distance,
+// which is the admission threshold for new candidates. Batches of distances
+// are first filtered against the threshold with the SIMD SelectLess kernel,
+// so only the few candidates that can enter the heap are handled one by one.
+//
+// A Heap is not safe for concurrent use.
+type Heap struct {
+	k       int
+	items   []Neighbor
+	scratch [pushBatch]int32
+}
+
+// New returns an empty heap that keeps the k best candidates.
+func New(k int) *Heap {
+	if k < 0 {
+		panic("topk: negative k")
+	}
+	return &Heap{k: k, items: make([]Neighbor, 0, k)}
+}
+
+// K returns the number of candidates the heap keeps.
+func (h *Heap) K() int {
+	return h.k
+}
+
+// Len returns the number of candidates currently held.
+func (h *Heap) Len() int {
+	return len(h.items)
+}
+
+// Reset empties the heap, keeping its capacity.
+func (h *Heap) Reset() {
+	h.items = h.items[:0]
+}
+
+// Threshold returns the distance a new candidate must beat to be admitted:
+// +Inf until the heap is full, then the current k-th best distance.
+func (h *Heap) Threshold() float32 {
+	if len(h.items) < h.k {
+		return float32(math.Inf(1))
+	}
+	if h.k == 0 {
+		return float32(math.Inf(-1))
+	}
+	return h.items[0].Dist
+}
+
+// Push offers one candidate and reports whether it was admitted.
+func (h *Heap) Push(id int64, dist float32) bool {
+	if len(h.items) < h.k {
+		h.items = append(h.items, Neighbor{ID: id, Dist: dist})
+		h.up(len(h.items) - 1)
+		return true
+	}
+	if h.k == 0 || !(dist < h.items[0].Dist) {
+		return false
+	}
+	h.items[0] = Neighbor{ID: id, Dist: dist}
+	h.down(0)
+	return true
+}
+
+// PushRange offers candidates with consecutive ids: dists[i] belongs to
+// id firstID+i.
+func (h *Heap) PushRange(dists []float32, firstID int64) {
+	i := h.fill(dists, nil, firstID)
+	for start := i; start < len(dists); start += pushBatch {
+		end := min(start+pushBatch, len(dists))
+		n := SelectLess(dists[start:end], h.Threshold(), h.scratch[:])
+		for _, j := range h.scratch[:n] {
+			i := start + int(j)
+			h.Push(firstID+int64(i), dists[i])
+		}
+	}
+}
+
+// PushBatch offers candidates with explicit ids: dists[i] belongs to ids[i].
+func (h *Heap) PushBatch(dists []float32, ids []int64) {
+	if len(dists) == 0 {
+		return
+	}
+	ids = ids[:len(dists)]
+	i := h.fill(dists, ids, 0)
+	for start := i; start < len(dists); start += pushBatch {
+		end := min(start+pushBatch, len(dists))
+		n := SelectLess(dists[start:end], h.Threshold(), h.scratch[:])
+		for _, j := range h.scratch[:n] {
+			i := start + int(j)
+			h.Push(ids[i], dists[i])
+		}
+	}
+}
+
+// fill pushes candidates directly until the heap is full, since filtering
+// only pays off once there is a threshold, and returns how many it took.
+// Ids come from ids, or count up from firstID if ids is nil.
+func (h *Heap) fill(dists []float32, ids []int64, firstID int64) int {
+	i := 0
+	for ; i < len(dists) && len(h.items) < h.k; i++ {
+		if ids != nil {
+			h.Push(ids[i], dists[i])
+		} else {
+			h.Push(firstID+int64(i), dists[i])
+		}
+	}
+	return i
+}
+
+// Sorted appends the held candidates to dst in order of increasing
+// distance and returns the extended slice. The heap is left unchanged.
+func (h *Heap) Sorted(dst []Neighbor) []Neighbor {
+	start := len(dst)
+	dst = append(dst, h.items...)
+	slices.SortFunc(dst[start:], func(a, b Neighbor) int {
+		switch {
+		case a.Dist < b.Dist:
+			return -1
+		case a.Dist > b.Dist:
+			return 1
+		case a.ID < b.ID:
+			return -1
+		case a.ID > b.ID:
+			return 1
+		}
+		return 0
+	})
+	return dst
+}
+
+// Merge offers every candidate held by other to h.
+func (h *Heap) Merge(other *Heap) {
+	for _, n := range other.items {
+		h.Push(n.ID, n.Dist)
+	}
+}
+
+func (h *Heap) up(i int) {
+	items := h.items
+	for i > 0 {
+		parent := (i - 1) / 2
+		if !(items[parent].Dist < items[i].Dist) {
+			break
+		}
+		items[parent], items[i] = items[i], items[parent]
+		i = parent
+	}
+}
+
+func (h *Heap) down(i int) {
+	items := h.items
+	n := len(items)
+	for {
+		largest := i
+		if l := 2*i + 1; l < n && items[l].Dist > items[largest].Dist {
+			largest = l
+		}
+		if r := 2*i + 2; r < n && items[r].Dist > items[largest].Dist {
+			largest = r
+		}
+		if largest == i {
+			return
+		}
+		items[i], items[largest] = items[largest], items[i]
+		i = largest
+	}
+}
@@ -0,0 +1,144 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package topk
+
+import (
+	"fmt"
+	"math/rand"
+	"slices"
+	"testing"
+)
+
+func TestSelectLess(t *testing.T) {
+	rng := rand.New(rand.NewSource(1))
+	for _, n := range []int{0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 64, 100, 257} {
+		dist := make([]float32, n)
+		for i := range dist {
+			dist[i] = rng.Float32()
+		}
+		for _, thr := range []float32{-1, 0.1, 0.5, 0.9, 2} {
+			var want []int32
+			for i, d := range dist {
+				if d < thr {
+					want = append(want, int32(i))
+				}
+			}
+			idx := make([]int32, n)
+			got := idx[:SelectLess(dist, thr, idx)]
+			if !slices.Equal(got, want) {
+				t.Fatalf("n=%d thr=%v: got %v, want %v", n, thr, got, want)
+			}
+		}
+	}
+}
+
+// referenceTopK returns the k best neighbors by sorting everything.
+func referenceTopK(dists []float32, k int) []Neighbor {
+	all := make([]Neighbor, len(dists))
+	for i, d := range dists {
+		all[i] = Neighbor{ID: int64(i), Dist: d}
+	}
+	h := &Heap{k: len(all), items: all}
+	sorted := h.Sorted(nil)
+	return sorted[:min(k, len(sorted))]
+}
+
+func TestHeap(t *testing.T) {
+	rng := rand.New(rand.NewSource(2))
+	for _, n := range []int{0, 1, 5, 100, 1000, 5000} {
+		dists := make([]float32, n)
+		for i := range dists {
+			// Few distinct values so ties are exercised.
+			dists[i] = float32(rng.Intn(n/4 + 1))
+		}
+		for _, k := range []int{0, 1, 10, 100, 10000} {
+			t.Run(fmt.Sprintf("n=%d/k=%d", n, k), func(t *testing.T) {
+				want := referenceTopK(dists, k)
+
+				h := New(k)
+				h.PushRange(dists, 0)
+				got := h.Sorted(nil)
+				if len(got) != len(want) {
+					t.Fatalf("got %d neighbors, want %d", len(got), len(want))
+				}
+				for i := range got {
+					if got[i].Dist != want[i].Dist {
+						t.Fatalf("rank %d: distance %v, want %v", i, got[i].Dist, want[i].Dist)
+					}
+					if dists[got[i].ID] != got[i].Dist {
+						t.Fatalf("rank %d: id %d does not have distance %v", i, got[i].ID, got[i].Dist)
+					}
+				}
+
+				// Explicit ids and one-at-a-time pushes agree.
+				ids := make([]int64, n)
+				for i := range ids {
+					ids[i] = int64(i)
+				}
+				h2 := New(k)
+				h2.PushBatch(dists, ids)
+				h3 := New(k)
+				for i, d := range dists {
+					h3.Push(int64(i), d)
+				}
+				got2, got3 := h2.Sorted(nil), h3.Sorted(nil)
+				for i := range got {
+					if got2[i].Dist != got[i].Dist || got3[i].Dist != got[i].Dist {
+						t.Fatalf("rank %d: PushBatch %v, Push %v, PushRange %v", i, got2[i], got3[i], got[i])
+					}
+				}
+			})
+		}
+	}
+}
+
+func TestHeapMerge(t *testing.T) {
+	rng := rand.New(rand.NewSource(3))
+	dists := make([]float32, 2000)
+	for i := range dists {
+		dists[i] = rng.Float32()
+	}
+	a, b := New(20), New(20)
+	a.PushRange(dists[:1000], 0)
+	b.PushRange(dists[1000:], 1000)
+	a.Merge(b)
+	got := a.Sorted(nil)
+	want := referenceTopK(dists, 20)
+	if !slices.Equal(got, want) {
+		t.Fatalf("merged %v, want %v", got, want)
+	}
+	if th := a.Threshold(); th != want[19].Dist {
+		t.Errorf("Threshold = %v, want %v", th, want[19].Dist)
+	}
+}
+
+func BenchmarkPushRange(b *testing.B) {
+	rng := rand.New(rand.NewSource(1))
+	dists := make([]float32, 1<<16)
+	for i := range dists {
+		dists[i] = rng.Float32()
+	}
+	for _, k := range []int{10, 100} {
+		b.Run(fmt.Sprintf("k=%d", k), func(b *testing.B) {
+			h := New(k)
+			b.SetBytes(int64(len(dists) * 4))
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				h.Reset()
+				h.PushRange(dists, 0)
+			}
+		})
+	}
+}
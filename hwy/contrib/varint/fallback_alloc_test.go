@@ -0,0 +1,71 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package varint
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		u8        = make([]byte, allocTestLen)
+		u32       = make([]uint32, allocTestLen)
+		u64       = make([]uint64, allocTestLen)
+		u8Scalar  = byte(1)
+		u32Scalar = uint32(1)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseDecodeGroupVarint32_fallback", func() { BaseDecodeGroupVarint32_fallback(u8) }},
+		{"BaseDecodeGroupVarint64_fallback", func() { BaseDecodeGroupVarint64_fallback(u8) }},
+		{"BaseMaskedVByteDecodeBatch32_fallback", func() { BaseMaskedVByteDecodeBatch32_fallback(u8, u32, allocTestDim) }},
+		{"BaseMaskedVByteDecodeBatch64_fallback", func() { BaseMaskedVByteDecodeBatch64_fallback(u8, u64, allocTestDim) }},
+		{"BaseMaskedVByteDecodeGroup_fallback", func() { BaseMaskedVByteDecodeGroup_fallback(u8, u32) }},
+		{"baseMaskedVByteDecodeOne32_fallback", func() { baseMaskedVByteDecodeOne32_fallback(u8) }},
+		{"baseMaskedVByteDecodeOne64_fallback", func() { baseMaskedVByteDecodeOne64_fallback(u8) }},
+		{"BaseDecodeStreamVByte32GroupSIMD_fallback", func() { BaseDecodeStreamVByte32GroupSIMD_fallback(u8Scalar, u8, u32) }},
+		{"BaseDecodeStreamVByte32Into_fallback", func() { BaseDecodeStreamVByte32Into_fallback(u8, u8, u32) }},
+		{"BaseEncodeStreamVByte32Group_fallback", func() { BaseEncodeStreamVByte32Group_fallback(u32, u8) }},
+		{"BaseDecode2Uvarint64_fallback", func() { BaseDecode2Uvarint64_fallback(u8) }},
+		{"BaseDecode5Uvarint64_fallback", func() { BaseDecode5Uvarint64_fallback(u8) }},
+		{"BaseDecodeUvarint64Batch_fallback", func() { BaseDecodeUvarint64Batch_fallback(u8, u64, allocTestDim) }},
+		{"BaseDecodeUvarint64BatchWithMask_fallback", func() { BaseDecodeUvarint64BatchWithMask_fallback(u8, u64, u32Scalar, allocTestDim) }},
+		{"BaseFindVarintEnds_fallback", func() { BaseFindVarintEnds_fallback(u8) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
@@ -15,6 +15,18 @@ var DecodeGroupVarint64 func(src []byte) (values [4]uint64, consumed int)
 
 func init() {
 	initGroupvarintAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "varint",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DecodeGroupVarint32", Vars: []any{&DecodeGroupVarint32}},
+			{Name: "DecodeGroupVarint64", Vars: []any{&DecodeGroupVarint64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initGroupvarintAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initGroupvarintAVX2},
+			{Name: "fallback", Supported: true, Init: initGroupvarintFallback},
+		},
+	})
 }
 
 func initGroupvarintAll() {
@@ -13,6 +13,17 @@ var DecodeGroupVarint64 func(src []byte) (values [4]uint64, consumed int)
 
 func init() {
 	initGroupvarintAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "varint",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DecodeGroupVarint32", Vars: []any{&DecodeGroupVarint32}},
+			{Name: "DecodeGroupVarint64", Vars: []any{&DecodeGroupVarint64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initGroupvarintNEONAsm},
+			{Name: "fallback", Supported: true, Init: initGroupvarintFallback},
+		},
+	})
 }
 
 func initGroupvarintAll() {
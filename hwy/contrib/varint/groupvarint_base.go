@@ -16,7 +16,11 @@ package varint
 
 //go:generate go run ../../../cmd/hwygen -input groupvarint_base.go -output . -targets avx2,avx512,neon:asm,fallback -dispatch groupvarint
 
-import "github.com/ajroetker/go-highway/hwy"
+import (
+	"encoding/binary"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
 
 // Group Varint encoding is a SIMD-friendly alternative to standard LEB128 varint encoding.
 // It encodes 4 values with a single control byte, providing ~4x throughput compared to
@@ -215,6 +219,39 @@ func BaseDecodeGroupVarint32(src []byte) (values [4]uint32, consumed int) {
 	return values, totalLen
 }
 
+// BaseDecodeGroupVarint32SWAR is the fallback of BaseDecodeGroupVarint32.
+// With 17 bytes available every value is read with one 32-bit
+// little-endian load and masked to its length.
+//
+//hwy:specializes DecodeGroupVarint32
+//hwy:targets fallback
+func BaseDecodeGroupVarint32SWAR(src []byte) (values [4]uint32, consumed int) {
+	if len(src) < 1 {
+		return [4]uint32{}, 0
+	}
+
+	control := src[0]
+	totalLen := int(groupVarint32TotalLen[control])
+
+	if len(src) < totalLen {
+		return [4]uint32{}, 0
+	}
+
+	offsets := groupVarint32Offsets[control]
+	if len(src) >= 17 {
+		for i := range 4 {
+			shift := uint(control>>(2*i)) & 0x3
+			values[i] = binary.LittleEndian.Uint32(src[offsets[i]:]) & (^uint32(0) >> (24 - 8*shift))
+		}
+		return values, totalLen
+	}
+
+	for i := range 4 {
+		values[i] = decodeValue32(src, int(offsets[i]), int(control>>(2*i))&0x3+1)
+	}
+	return values, totalLen
+}
+
 // decodeValue32 reads a little-endian uint32 of the specified byte length.
 func decodeValue32(src []byte, offset, length int) uint32 {
 	var v uint32
@@ -271,6 +308,37 @@ func BaseDecodeGroupVarint64(src []byte) (values [4]uint64, consumed int) {
 	return values, totalLen
 }
 
+// BaseDecodeGroupVarint64SWAR is the fallback of BaseDecodeGroupVarint64.
+// Values with eight readable bytes behind them are read with one 64-bit
+// little-endian load and masked to their length.
+//
+//hwy:specializes DecodeGroupVarint64
+//hwy:targets fallback
+func BaseDecodeGroupVarint64SWAR(src []byte) (values [4]uint64, consumed int) {
+	if len(src) < 2 {
+		return [4]uint64{}, 0
+	}
+
+	control := uint16(src[0]) | (uint16(src[1]) << 8)
+	totalLen := 2 + int(control&0x7) + int(control>>3&0x7) + int(control>>6&0x7) + int(control>>9&0x7) + 4 // lengths are stored minus 1
+
+	if len(src) < totalLen {
+		return [4]uint64{}, 0
+	}
+
+	offset := 2
+	for i := range 4 {
+		shift := uint(control>>(3*i)) & 0x7
+		if offset+8 <= len(src) {
+			values[i] = binary.LittleEndian.Uint64(src[offset:]) & (^uint64(0) >> (56 - 8*shift))
+		} else {
+			values[i] = decodeValue64(src, offset, int(shift)+1)
+		}
+		offset += int(shift) + 1
+	}
+	return values, totalLen
+}
+
 // decodeValue64 reads a little-endian uint64 of the specified byte length.
 func decodeValue64(src []byte, offset, length int) uint64 {
 	var v uint64
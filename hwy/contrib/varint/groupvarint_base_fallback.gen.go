@@ -3,7 +3,7 @@
 package varint
 
 import (
-	"github.com/ajroetker/go-highway/hwy"
+	"encoding/binary"
 )
 
 func BaseDecodeGroupVarint32_fallback(src []byte) (values [4]uint32, consumed int) {
@@ -15,24 +15,17 @@ func BaseDecodeGroupVarint32_fallback(src []byte) (values [4]uint32, consumed in
 	if len(src) < totalLen {
 		return [4]uint32{}, 0
 	}
+	offsets := groupVarint32Offsets[control]
 	if len(src) >= 17 {
-		dataVec := hwy.LoadSlice[uint8](src[1:17])
-		maskSlice := groupVarint32ShuffleMasks[control][:]
-		maskVec := hwy.LoadSlice[uint8](maskSlice)
-		shuffled := hwy.TableLookupBytes(dataVec, maskVec)
-		var result [16]uint8
-		hwy.StoreSlice(shuffled, result[:])
-		values[0] = uint32(result[0]) | uint32(result[1])<<8 | uint32(result[2])<<16 | uint32(result[3])<<24
-		values[1] = uint32(result[4]) | uint32(result[5])<<8 | uint32(result[6])<<16 | uint32(result[7])<<24
-		values[2] = uint32(result[8]) | uint32(result[9])<<8 | uint32(result[10])<<16 | uint32(result[11])<<24
-		values[3] = uint32(result[12]) | uint32(result[13])<<8 | uint32(result[14])<<16 | uint32(result[15])<<24
+		for i := range 4 {
+			shift := uint(control>>(2*i)) & 0x3
+			values[i] = binary.LittleEndian.Uint32(src[offsets[i]:]) & (^uint32(0) >> (24 - 8*shift))
+		}
 		return values, totalLen
 	}
-	offsets := groupVarint32Offsets[control]
-	values[0] = decodeValue32(src, int(offsets[0]), ((int(control)>>0)&0x3)+1)
-	values[1] = decodeValue32(src, int(offsets[1]), ((int(control)>>2)&0x3)+1)
-	values[2] = decodeValue32(src, int(offsets[2]), ((int(control)>>4)&0x3)+1)
-	values[3] = decodeValue32(src, int(offsets[3]), ((int(control)>>6)&0x3)+1)
+	for i := range 4 {
+		values[i] = decodeValue32(src, int(offsets[i]), int(control>>(2*i))&0x3+1)
+	}
 	return values, totalLen
 }
 
@@ -41,21 +34,19 @@ func BaseDecodeGroupVarint64_fallback(src []byte) (values [4]uint64, consumed in
 		return [4]uint64{}, 0
 	}
 	control := uint16(src[0]) | (uint16(src[1]) << 8)
-	len0 := int((control>>0)&0x7) + 1
-	len1 := int((control>>3)&0x7) + 1
-	len2 := int((control>>6)&0x7) + 1
-	len3 := int((control>>9)&0x7) + 1
-	totalLen := 2 + len0 + len1 + len2 + len3
+	totalLen := 2 + int(control&0x7) + int(control>>3&0x7) + int(control>>6&0x7) + int(control>>9&0x7) + 4
 	if len(src) < totalLen {
 		return [4]uint64{}, 0
 	}
 	offset := 2
-	values[0] = decodeValue64(src, offset, len0)
-	offset += len0
-	values[1] = decodeValue64(src, offset, len1)
-	offset += len1
-	values[2] = decodeValue64(src, offset, len2)
-	offset += len2
-	values[3] = decodeValue64(src, offset, len3)
+	for i := range 4 {
+		shift := uint(control>>(3*i)) & 0x7
+		if offset+8 <= len(src) {
+			values[i] = binary.LittleEndian.Uint64(src[offset:]) & (^uint64(0) >> (56 - 8*shift))
+		} else {
+			values[i] = decodeValue64(src, offset, int(shift)+1)
+		}
+		offset += int(shift) + 1
+	}
 	return values, totalLen
 }
@@ -0,0 +1,32 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package varint
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("varint", "DecodeGroupVarint32", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DecodeGroupVarint32; hwyImpl != nil {
+			DecodeGroupVarint32 = func(src []byte) (values [4]uint32, consumed int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(src)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+	hwy.ProfileDispatch("varint", "DecodeGroupVarint64", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DecodeGroupVarint64; hwyImpl != nil {
+			DecodeGroupVarint64 = func(src []byte) (values [4]uint64, consumed int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(src)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+}
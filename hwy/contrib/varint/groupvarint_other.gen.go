@@ -4,11 +4,25 @@
 
 package varint
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var DecodeGroupVarint32 func(src []byte) (values [4]uint32, consumed int)
 var DecodeGroupVarint64 func(src []byte) (values [4]uint64, consumed int)
 
 func init() {
 	initGroupvarintAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "varint",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DecodeGroupVarint32", Vars: []any{&DecodeGroupVarint32}},
+			{Name: "DecodeGroupVarint64", Vars: []any{&DecodeGroupVarint64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initGroupvarintFallback},
+		},
+	})
 }
 
 func initGroupvarintAll() {
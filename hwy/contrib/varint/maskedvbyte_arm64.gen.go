@@ -16,6 +16,20 @@ var maskedVByteDecodeOne64 func(src []byte) (uint64, int)
 
 func init() {
 	initMaskedvbyteAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "varint",
+		Groups: []hwy.DispatchGroup{
+			{Name: "MaskedVByteDecodeBatch32", Vars: []any{&MaskedVByteDecodeBatch32}},
+			{Name: "MaskedVByteDecodeBatch64", Vars: []any{&MaskedVByteDecodeBatch64}},
+			{Name: "MaskedVByteDecodeGroup", Vars: []any{&MaskedVByteDecodeGroup}},
+			{Name: "maskedVByteDecodeOne32", Vars: []any{&maskedVByteDecodeOne32}},
+			{Name: "maskedVByteDecodeOne64", Vars: []any{&maskedVByteDecodeOne64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initMaskedvbyteNEONAsm},
+			{Name: "fallback", Supported: true, Init: initMaskedvbyteFallback},
+		},
+	})
 }
 
 func initMaskedvbyteAll() {
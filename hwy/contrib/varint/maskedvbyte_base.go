@@ -15,7 +15,11 @@
 
 package varint
 
-import "github.com/ajroetker/go-highway/hwy"
+import (
+	"encoding/binary"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
 
 //go:generate go run ../../../cmd/hwygen -input maskedvbyte_base.go -output . -targets avx2,avx512,neon:asm,fallback -dispatch maskedvbyte
 
@@ -180,6 +184,45 @@ func BaseMaskedVByteDecodeGroup(src []byte, dst []uint32) (decoded int, consumed
 	return int(lookup.numValues), int(lookup.bytesConsumed)
 }
 
+// BaseMaskedVByteDecodeGroupSWAR is the fallback of
+// BaseMaskedVByteDecodeGroup. The terminator pattern comes from two
+// little-endian words, and each value is decoded from a single 32-bit load
+// by dropping the continuation bits with shifts and masks instead of a byte
+// shuffle.
+//
+//hwy:specializes MaskedVByteDecodeGroup
+//hwy:targets fallback
+func BaseMaskedVByteDecodeGroupSWAR(src []byte, dst []uint32) (decoded int, consumed int) {
+	if len(src) < 16 || len(dst) < 4 {
+		return 0, 0
+	}
+
+	lo := binary.LittleEndian.Uint64(src)
+	hi := binary.LittleEndian.Uint32(src[8:])
+	pattern := uint16((^lo&0x8080808080808080)*0x0002040810204081>>56) |
+		uint16((^hi&0x80808080)*0x00204081>>28)<<8
+
+	lookup := &maskedVByte12LookupTable[pattern]
+	if lookup.numValues == 0 {
+		return 0, 0
+	}
+
+	var values [4]uint32
+	start := 0
+	for k := range int(lookup.numValues) {
+		end := int(lookup.valueEnds[k])
+		x := binary.LittleEndian.Uint32(src[start:])
+		if n := end - start; n < 4 {
+			x &= 1<<(8*uint(n)) - 1
+		}
+		values[k] = x&0x7f | x>>1&0x3f80 | x>>2&0x1fc000 | x>>3&0x1fe00000
+		start = end
+	}
+	dst[0], dst[1], dst[2], dst[3] = values[0], values[1], values[2], values[3]
+
+	return int(lookup.numValues), int(lookup.bytesConsumed)
+}
+
 // maskedVByteCombine combines varint bytes into a uint32.
 // Bytes are already shuffled into position; we need to mask continuation bits
 // and shift to combine. length is the number of actual bytes (1-4).
@@ -3,7 +3,7 @@
 package varint
 
 import (
-	"github.com/ajroetker/go-highway/hwy"
+	"encoding/binary"
 )
 
 func BaseMaskedVByteDecodeBatch32_fallback(src []byte, dst []uint32, n int) (decoded int, consumed int) {
@@ -54,26 +54,25 @@ func BaseMaskedVByteDecodeGroup_fallback(src []byte, dst []uint32) (decoded int,
 	if len(src) < 16 || len(dst) < 4 {
 		return 0, 0
 	}
-	srcVec := hwy.LoadSlice[uint8](src[:16])
-	threshold := hwy.Set[uint8](0x80)
-	terminatorMask := hwy.LessThan(srcVec, threshold)
-	pattern := uint16(hwy.BitsFromMask(terminatorMask)) & 0x0FFF
-	if pattern == 0 {
-		return 0, 0
-	}
+	lo := binary.LittleEndian.Uint64(src)
+	hi := binary.LittleEndian.Uint32(src[8:])
+	pattern := uint16((^lo&0x8080808080808080)*0x0002040810204081>>56) | uint16((^hi&0x80808080)*0x00204081>>28)<<8
 	lookup := &maskedVByte12LookupTable[pattern]
 	if lookup.numValues == 0 {
 		return 0, 0
 	}
-	shuffleMask := maskedVByte12ShuffleMasks[pattern][:]
-	maskVec := hwy.LoadSlice[uint8](shuffleMask)
-	shuffled := hwy.TableLookupBytes(srcVec, maskVec)
-	var result [16]uint8
-	hwy.StoreSlice(shuffled, result[:])
-	dst[0] = uint32(result[0]&0x7f) | uint32(result[1]&0x7f)<<7 | uint32(result[2]&0x7f)<<14 | uint32(result[3])<<21
-	dst[1] = uint32(result[4]&0x7f) | uint32(result[5]&0x7f)<<7 | uint32(result[6]&0x7f)<<14 | uint32(result[7])<<21
-	dst[2] = uint32(result[8]&0x7f) | uint32(result[9]&0x7f)<<7 | uint32(result[10]&0x7f)<<14 | uint32(result[11])<<21
-	dst[3] = uint32(result[12]&0x7f) | uint32(result[13]&0x7f)<<7 | uint32(result[14]&0x7f)<<14 | uint32(result[15])<<21
+	var values [4]uint32
+	start := 0
+	for k := range int(lookup.numValues) {
+		end := int(lookup.valueEnds[k])
+		x := binary.LittleEndian.Uint32(src[start:])
+		if n := end - start; n < 4 {
+			x &= 1<<(8*uint(n)) - 1
+		}
+		values[k] = x&0x7f | x>>1&0x3f80 | x>>2&0x1fc000 | x>>3&0x1fe00000
+		start = end
+	}
+	dst[0], dst[1], dst[2], dst[3] = values[0], values[1], values[2], values[3]
 	return int(lookup.numValues), int(lookup.bytesConsumed)
 }
 
@@ -0,0 +1,62 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package varint
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("varint", "MaskedVByteDecodeBatch32", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MaskedVByteDecodeBatch32; hwyImpl != nil {
+			MaskedVByteDecodeBatch32 = func(src []byte, dst []uint32, n int) (decoded int, consumed int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(src, dst, n)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+	hwy.ProfileDispatch("varint", "MaskedVByteDecodeBatch64", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MaskedVByteDecodeBatch64; hwyImpl != nil {
+			MaskedVByteDecodeBatch64 = func(src []byte, dst []uint64, n int) (decoded int, consumed int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(src, dst, n)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+	hwy.ProfileDispatch("varint", "MaskedVByteDecodeGroup", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MaskedVByteDecodeGroup; hwyImpl != nil {
+			MaskedVByteDecodeGroup = func(src []byte, dst []uint32) (decoded int, consumed int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(src, dst)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+	hwy.ProfileDispatch("varint", "maskedVByteDecodeOne32", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := maskedVByteDecodeOne32; hwyImpl != nil {
+			maskedVByteDecodeOne32 = func(src []byte) (uint32, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(src)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+	hwy.ProfileDispatch("varint", "maskedVByteDecodeOne64", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := maskedVByteDecodeOne64; hwyImpl != nil {
+			maskedVByteDecodeOne64 = func(src []byte) (uint64, int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(src)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+}
@@ -4,6 +4,10 @@
 
 package varint
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var MaskedVByteDecodeBatch32 func(src []byte, dst []uint32, n int) (decoded int, consumed int)
 var MaskedVByteDecodeBatch64 func(src []byte, dst []uint64, n int) (decoded int, consumed int)
 var MaskedVByteDecodeGroup func(src []byte, dst []uint32) (decoded int, consumed int)
@@ -12,6 +16,19 @@ var maskedVByteDecodeOne64 func(src []byte) (uint64, int)
 
 func init() {
 	initMaskedvbyteAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "varint",
+		Groups: []hwy.DispatchGroup{
+			{Name: "MaskedVByteDecodeBatch32", Vars: []any{&MaskedVByteDecodeBatch32}},
+			{Name: "MaskedVByteDecodeBatch64", Vars: []any{&MaskedVByteDecodeBatch64}},
+			{Name: "MaskedVByteDecodeGroup", Vars: []any{&MaskedVByteDecodeGroup}},
+			{Name: "maskedVByteDecodeOne32", Vars: []any{&maskedVByteDecodeOne32}},
+			{Name: "maskedVByteDecodeOne64", Vars: []any{&maskedVByteDecodeOne64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initMaskedvbyteFallback},
+		},
+	})
 }
 
 func initMaskedvbyteAll() {
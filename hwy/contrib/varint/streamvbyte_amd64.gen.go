@@ -16,6 +16,19 @@ var EncodeStreamVByte32Group func(values []uint32, dst []uint8) (ctrl byte, n in
 
 func init() {
 	initStreamvbyteAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "varint",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DecodeStreamVByte32GroupSIMD", Vars: []any{&DecodeStreamVByte32GroupSIMD}},
+			{Name: "DecodeStreamVByte32Into", Vars: []any{&DecodeStreamVByte32Into}},
+			{Name: "EncodeStreamVByte32Group", Vars: []any{&EncodeStreamVByte32Group}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initStreamvbyteAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initStreamvbyteAVX2},
+			{Name: "fallback", Supported: true, Init: initStreamvbyteFallback},
+		},
+	})
 }
 
 func initStreamvbyteAll() {
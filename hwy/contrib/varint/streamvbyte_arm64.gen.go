@@ -14,6 +14,18 @@ var EncodeStreamVByte32Group func(values []uint32, dst []uint8) (ctrl byte, n in
 
 func init() {
 	initStreamvbyteAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "varint",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DecodeStreamVByte32GroupSIMD", Vars: []any{&DecodeStreamVByte32GroupSIMD}},
+			{Name: "DecodeStreamVByte32Into", Vars: []any{&DecodeStreamVByte32Into}},
+			{Name: "EncodeStreamVByte32Group", Vars: []any{&EncodeStreamVByte32Group}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initStreamvbyteNEONAsm},
+			{Name: "fallback", Supported: true, Init: initStreamvbyteFallback},
+		},
+	})
 }
 
 func initStreamvbyteAll() {
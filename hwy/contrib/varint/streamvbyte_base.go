@@ -16,6 +16,7 @@
 package varint
 
 import (
+	"encoding/binary"
 	"math/bits"
 	"unsafe"
 
@@ -199,6 +200,30 @@ func BaseDecodeStreamVByte32GroupSIMD(ctrl byte, data []uint8, dst []uint32) int
 	return dataLen
 }
 
+// BaseDecodeStreamVByte32GroupSWAR is the fallback of
+// BaseDecodeStreamVByte32GroupSIMD. Each value is read with one 32-bit
+// little-endian load and masked to its length, replacing the byte shuffle.
+//
+//hwy:specializes DecodeStreamVByte32GroupSIMD
+//hwy:targets fallback
+func BaseDecodeStreamVByte32GroupSWAR(ctrl byte, data []uint8, dst []uint32) int {
+	dataLen := int(streamVByte32DataLen[ctrl])
+	if len(data) < dataLen || len(dst) < 4 {
+		return 0
+	}
+	if len(data) < 16 {
+		return decodeGroupScalarInto(ctrl, data, dst)
+	}
+
+	pos := 0
+	for i := range 4 {
+		shift := uint(ctrl>>(2*i)) & 0x3
+		dst[i] = binary.LittleEndian.Uint32(data[pos:]) & (^uint32(0) >> (24 - 8*shift))
+		pos += int(shift) + 1
+	}
+	return dataLen
+}
+
 // decodeGroupScalarInto is a scalar fallback for small buffers.
 func decodeGroupScalarInto(ctrl byte, data []uint8, dst []uint32) int {
 	pos := 0
@@ -317,6 +342,38 @@ func BaseEncodeStreamVByte32Group(values []uint32, dst []uint8) (ctrl byte, n in
 	return ctrl, n
 }
 
+// BaseEncodeStreamVByte32GroupSWAR is the fallback of
+// BaseEncodeStreamVByte32Group. Each value is stored with one 32-bit
+// little-endian write and the output position advances by its length, so
+// the next value overwrites the unused high bytes.
+//
+//hwy:specializes EncodeStreamVByte32Group
+//hwy:targets fallback
+func BaseEncodeStreamVByte32GroupSWAR(values []uint32, dst []uint8) (ctrl byte, n int) {
+	if len(values) < 4 || len(dst) < 16 {
+		return 0, 0
+	}
+	values = values[:4]
+
+	if values[0]|values[1]|values[2]|values[3] <= 0xFF {
+		dst[0] = byte(values[0])
+		dst[1] = byte(values[1])
+		dst[2] = byte(values[2])
+		dst[3] = byte(values[3])
+		return 0, 4
+	}
+
+	for i, v := range values {
+		length := encodedLengthU32(v)
+		binary.LittleEndian.PutUint32(dst[n:], v)
+		ctrl |= byte(length-1) << (i * 2)
+		n += length
+	}
+	// Match the shuffle store, which zeroes the bytes past the group.
+	clear(dst[n:16])
+	return ctrl, n
+}
+
 // encodeGroupScalarInto is scalar fallback for encoding directly into a buffer.
 func encodeGroupScalarInto(values []uint32, dst []byte) (ctrl byte, n int) {
 	pos := 0
@@ -3,9 +3,7 @@
 package varint
 
 import (
-	"unsafe"
-
-	"github.com/ajroetker/go-highway/hwy"
+	"encoding/binary"
 )
 
 func BaseDecodeStreamVByte32GroupSIMD_fallback(ctrl byte, data []uint8, dst []uint32) int {
@@ -16,16 +14,12 @@ func BaseDecodeStreamVByte32GroupSIMD_fallback(ctrl byte, data []uint8, dst []ui
 	if len(data) < 16 {
 		return decodeGroupScalarInto(ctrl, data, dst)
 	}
-	dataVec := hwy.LoadSlice[uint8](data[:16])
-	maskSlice := streamVByte32ShuffleMasks[ctrl][:]
-	maskVec := hwy.LoadSlice[uint8](maskSlice)
-	shuffled := hwy.TableLookupBytes(dataVec, maskVec)
-	var result [16]uint8
-	hwy.StoreSlice(shuffled, result[:])
-	dst[0] = uint32(result[0]) | uint32(result[1])<<8 | uint32(result[2])<<16 | uint32(result[3])<<24
-	dst[1] = uint32(result[4]) | uint32(result[5])<<8 | uint32(result[6])<<16 | uint32(result[7])<<24
-	dst[2] = uint32(result[8]) | uint32(result[9])<<8 | uint32(result[10])<<16 | uint32(result[11])<<24
-	dst[3] = uint32(result[12]) | uint32(result[13])<<8 | uint32(result[14])<<16 | uint32(result[15])<<24
+	pos := 0
+	for i := range 4 {
+		shift := uint(ctrl>>(2*i)) & 0x3
+		dst[i] = binary.LittleEndian.Uint32(data[pos:]) & (^uint32(0) >> (24 - 8*shift))
+		pos += int(shift) + 1
+	}
 	return dataLen
 }
 
@@ -76,24 +70,20 @@ func BaseEncodeStreamVByte32Group_fallback(values []uint32, dst []uint8) (ctrl b
 	if len(values) < 4 || len(dst) < 16 {
 		return 0, 0
 	}
-	combined := values[0] | values[1] | values[2] | values[3]
-	if combined <= 0xFF {
+	values = values[:4]
+	if values[0]|values[1]|values[2]|values[3] <= 0xFF {
 		dst[0] = byte(values[0])
 		dst[1] = byte(values[1])
 		dst[2] = byte(values[2])
 		dst[3] = byte(values[3])
 		return 0, 4
 	}
-	ctrl = 0
-	for i := range 4 {
-		length := encodedLengthU32(values[i])
+	for i, v := range values {
+		length := encodedLengthU32(v)
+		binary.LittleEndian.PutUint32(dst[n:], v)
 		ctrl |= byte(length-1) << (i * 2)
+		n += length
 	}
-	n = int(streamVByte32DataLen[ctrl])
-	inputBytes := unsafe.Slice((*uint8)(unsafe.Pointer(&values[0])), 16)
-	inputVec := hwy.LoadSlice[uint8](inputBytes[:16])
-	maskVec := hwy.LoadSlice[uint8](streamVByte32EncodeShuffleMasks[ctrl][:16])
-	shuffled := hwy.TableLookupBytes(inputVec, maskVec)
-	hwy.StoreSlice(shuffled, dst[:16])
+	clear(dst[n:16])
 	return ctrl, n
 }
@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package varint
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("varint", "DecodeStreamVByte32GroupSIMD", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DecodeStreamVByte32GroupSIMD; hwyImpl != nil {
+			DecodeStreamVByte32GroupSIMD = func(ctrl byte, data []uint8, dst []uint32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(ctrl, data, dst)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data)+hwy.SliceBytes(dst))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("varint", "DecodeStreamVByte32Into", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DecodeStreamVByte32Into; hwyImpl != nil {
+			DecodeStreamVByte32Into = func(control []byte, data []uint8, dst []uint32) (decoded int, dataConsumed int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(control, data, dst)
+				hwyCounter.Done(hwyStart, len(control), hwy.SliceBytes(control)+hwy.SliceBytes(data)+hwy.SliceBytes(dst))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+	hwy.ProfileDispatch("varint", "EncodeStreamVByte32Group", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := EncodeStreamVByte32Group; hwyImpl != nil {
+			EncodeStreamVByte32Group = func(values []uint32, dst []uint8) (ctrl byte, n int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(values, dst)
+				hwyCounter.Done(hwyStart, len(values), hwy.SliceBytes(values)+hwy.SliceBytes(dst))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+}
@@ -4,12 +4,27 @@
 
 package varint
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var DecodeStreamVByte32GroupSIMD func(ctrl byte, data []uint8, dst []uint32) int
 var DecodeStreamVByte32Into func(control []byte, data []uint8, dst []uint32) (decoded int, dataConsumed int)
 var EncodeStreamVByte32Group func(values []uint32, dst []uint8) (ctrl byte, n int)
 
 func init() {
 	initStreamvbyteAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "varint",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DecodeStreamVByte32GroupSIMD", Vars: []any{&DecodeStreamVByte32GroupSIMD}},
+			{Name: "DecodeStreamVByte32Into", Vars: []any{&DecodeStreamVByte32Into}},
+			{Name: "EncodeStreamVByte32Group", Vars: []any{&EncodeStreamVByte32Group}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initStreamvbyteFallback},
+		},
+	})
 }
 
 func initStreamvbyteAll() {
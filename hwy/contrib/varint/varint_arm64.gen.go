@@ -16,6 +16,20 @@ var FindVarintEnds func(src []byte) uint32
 
 func init() {
 	initVarintAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "varint",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Decode2Uvarint64", Vars: []any{&Decode2Uvarint64}},
+			{Name: "Decode5Uvarint64", Vars: []any{&Decode5Uvarint64}},
+			{Name: "DecodeUvarint64Batch", Vars: []any{&DecodeUvarint64Batch}},
+			{Name: "DecodeUvarint64BatchWithMask", Vars: []any{&DecodeUvarint64BatchWithMask}},
+			{Name: "FindVarintEnds", Vars: []any{&FindVarintEnds}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initVarintNEONAsm},
+			{Name: "fallback", Supported: true, Init: initVarintFallback},
+		},
+	})
 }
 
 func initVarintAll() {
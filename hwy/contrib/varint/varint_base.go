@@ -38,7 +38,11 @@
 //	loc, n := varint.Decode5Uvarint64(data)
 package varint
 
-import "github.com/ajroetker/go-highway/hwy"
+import (
+	"encoding/binary"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
 
 // BaseFindVarintEnds examines up to 32 bytes and returns a bitmask where
 // bit i is set if src[i] is the last byte of a varint (i.e., src[i] < 0x80).
@@ -96,6 +100,29 @@ func BaseFindVarintEnds(src []byte) uint32 {
 	return mask
 }
 
+// BaseFindVarintEndsSWAR is the fallback of BaseFindVarintEnds. It tests
+// eight bytes per step: the inverted high bits of a little-endian word are
+// the terminator flags, and multiplying them by 0x0002040810204081 gathers
+// the eight flags into the top byte.
+//
+//hwy:specializes FindVarintEnds
+//hwy:targets fallback
+func BaseFindVarintEndsSWAR(src []byte) uint32 {
+	n := min(len(src), 32)
+	var mask uint32
+	i := 0
+	for ; i+8 <= n; i += 8 {
+		w := binary.LittleEndian.Uint64(src[i:])
+		mask |= uint32((^w&0x8080808080808080)*0x0002040810204081>>56) << uint(i)
+	}
+	for ; i < n; i++ {
+		if src[i] < 0x80 {
+			mask |= 1 << uint(i)
+		}
+	}
+	return mask
+}
+
 // BaseDecodeUvarint64Batch decodes up to n varints from src into dst.
 // Returns (values decoded, bytes consumed).
 //
@@ -3,7 +3,7 @@
 package varint
 
 import (
-	"github.com/ajroetker/go-highway/hwy"
+	"encoding/binary"
 )
 
 func BaseDecode2Uvarint64_fallback(src []byte) (v1 uint64, v2 uint64, consumed int) {
@@ -87,22 +87,14 @@ func BaseDecodeUvarint64BatchWithMask_fallback(src []byte, dst []uint64, mask ui
 }
 
 func BaseFindVarintEnds_fallback(src []byte) uint32 {
-	if len(src) == 0 {
-		return 0
-	}
 	n := min(len(src), 32)
-	if n == 32 {
-		threshold := hwy.Set[uint8](0x80)
-		v0 := hwy.LoadSlice[uint8](src[:16])
-		isTerminator0 := hwy.LessThan(v0, threshold)
-		mask0 := uint32(hwy.BitsFromMask(isTerminator0))
-		v1 := hwy.LoadSlice[uint8](src[16:32])
-		isTerminator1 := hwy.LessThan(v1, threshold)
-		mask1 := uint32(hwy.BitsFromMask(isTerminator1))
-		return mask0 | (mask1 << 16)
-	}
 	var mask uint32
-	for i := range n {
+	i := 0
+	for ; i+8 <= n; i += 8 {
+		w := binary.LittleEndian.Uint64(src[i:])
+		mask |= uint32((^w&0x8080808080808080)*0x0002040810204081>>56) << uint(i)
+	}
+	for ; i < n; i++ {
 		if src[i] < 0x80 {
 			mask |= 1 << uint(i)
 		}
@@ -0,0 +1,62 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package varint
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("varint", "Decode2Uvarint64", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Decode2Uvarint64; hwyImpl != nil {
+			Decode2Uvarint64 = func(src []byte) (v1 uint64, v2 uint64, consumed int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1, hwyR2 := hwyImpl(src)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src))
+				return hwyR0, hwyR1, hwyR2
+			}
+		}
+	})
+	hwy.ProfileDispatch("varint", "Decode5Uvarint64", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Decode5Uvarint64; hwyImpl != nil {
+			Decode5Uvarint64 = func(src []byte) (values [5]uint64, consumed int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(src)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+	hwy.ProfileDispatch("varint", "DecodeUvarint64Batch", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DecodeUvarint64Batch; hwyImpl != nil {
+			DecodeUvarint64Batch = func(src []byte, dst []uint64, n int) (decoded int, consumed int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(src, dst, n)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+	hwy.ProfileDispatch("varint", "DecodeUvarint64BatchWithMask", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DecodeUvarint64BatchWithMask; hwyImpl != nil {
+			DecodeUvarint64BatchWithMask = func(src []byte, dst []uint64, mask uint32, n int) (decoded int, consumed int) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(src, dst, mask, n)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(dst))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+	hwy.ProfileDispatch("varint", "FindVarintEnds", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := FindVarintEnds; hwyImpl != nil {
+			FindVarintEnds = func(src []byte) uint32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(src)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src))
+				return hwyR0
+			}
+		}
+	})
+}
@@ -4,6 +4,10 @@
 
 package varint
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var Decode2Uvarint64 func(src []byte) (v1 uint64, v2 uint64, consumed int)
 var Decode5Uvarint64 func(src []byte) (values [5]uint64, consumed int)
 var DecodeUvarint64Batch func(src []byte, dst []uint64, n int) (decoded int, consumed int)
@@ -12,6 +16,19 @@ var FindVarintEnds func(src []byte) uint32
 
 func init() {
 	initVarintAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "varint",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Decode2Uvarint64", Vars: []any{&Decode2Uvarint64}},
+			{Name: "Decode5Uvarint64", Vars: []any{&Decode5Uvarint64}},
+			{Name: "DecodeUvarint64Batch", Vars: []any{&DecodeUvarint64Batch}},
+			{Name: "DecodeUvarint64BatchWithMask", Vars: []any{&DecodeUvarint64BatchWithMask}},
+			{Name: "FindVarintEnds", Vars: []any{&FindVarintEnds}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initVarintFallback},
+		},
+	})
 }
 
 func initVarintAll() {
@@ -17,7 +17,7 @@ func decodeGroupVarint32AsmU8(src []byte) ([4]uint32, int) {
 	}
 	lenVal := int64(len(src))
 	if lenVal == 0 {
-		return [4]uint32{}, 0
+		return BaseDecodeGroupVarint32_fallback(src)
 	}
 	var out_values [4]uint32
 	var out_consumed int64
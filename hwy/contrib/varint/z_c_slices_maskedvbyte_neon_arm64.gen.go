@@ -73,7 +73,7 @@ func maskedVByteDecodeGroupAsmU8(src []byte, dst []uint32) (int, int) {
 	}
 	lenVal := int64(len(src))
 	if lenVal == 0 {
-		return 0, 0
+		return BaseMaskedVByteDecodeGroup_fallback(src, dst)
 	}
 	var out_decoded int64
 	var out_consumed int64
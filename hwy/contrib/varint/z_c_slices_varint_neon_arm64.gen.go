@@ -17,7 +17,7 @@ func findVarintEndsAsmU8(src []byte) uint32 {
 	}
 	lenVal := int64(len(src))
 	if lenVal == 0 {
-		return 0
+		return BaseFindVarintEnds_fallback(src)
 	}
 	var out_result int64
 	asm.FindVarintEnds_U8(
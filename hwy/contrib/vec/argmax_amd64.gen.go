@@ -81,6 +81,18 @@ func Argmin[T hwy.Floats](v []T) int {
 
 func init() {
 	initArgmaxAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Argmax", Vars: []any{&ArgmaxFloat16, &ArgmaxBFloat16, &ArgmaxFloat32, &ArgmaxFloat64}},
+			{Name: "Argmin", Vars: []any{&ArgminFloat16, &ArgminBFloat16, &ArgminFloat32, &ArgminFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initArgmaxAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initArgmaxAVX2},
+			{Name: "fallback", Supported: true, Init: initArgmaxFallback},
+		},
+	})
 }
 
 func initArgmaxAll() {
@@ -0,0 +1,80 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("vec", "Argmax", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ArgmaxFloat16; hwyImpl != nil {
+			ArgmaxFloat16 = func(v []hwy.Float16) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ArgmaxBFloat16; hwyImpl != nil {
+			ArgmaxBFloat16 = func(v []hwy.BFloat16) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ArgmaxFloat32; hwyImpl != nil {
+			ArgmaxFloat32 = func(v []float32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ArgmaxFloat64; hwyImpl != nil {
+			ArgmaxFloat64 = func(v []float64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "Argmin", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ArgminFloat16; hwyImpl != nil {
+			ArgminFloat16 = func(v []hwy.Float16) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ArgminBFloat16; hwyImpl != nil {
+			ArgminBFloat16 = func(v []hwy.BFloat16) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ArgminFloat32; hwyImpl != nil {
+			ArgminFloat32 = func(v []float32) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := ArgminFloat64; hwyImpl != nil {
+			ArgminFloat64 = func(v []float64) int {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+	})
+}
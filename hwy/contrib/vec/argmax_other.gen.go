@@ -79,6 +79,16 @@ func Argmin[T hwy.Floats](v []T) int {
 
 func init() {
 	initArgmaxAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Argmax", Vars: []any{&ArgmaxFloat16, &ArgmaxBFloat16, &ArgmaxFloat32, &ArgmaxFloat64}},
+			{Name: "Argmin", Vars: []any{&ArgminFloat16, &ArgminBFloat16, &ArgminFloat32, &ArgminFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initArgmaxFallback},
+		},
+	})
 }
 
 func initArgmaxAll() {
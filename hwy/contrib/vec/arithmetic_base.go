@@ -23,7 +23,7 @@
 // All functions use SIMD acceleration when available via the hwy package.
 package vec
 
-//go:generate go run ../../../cmd/hwygen -input arithmetic_base.go -output . -targets avx2,avx512,neon:asm,fallback -dispatch arithmetic
+//go:generate go run ../../../cmd/hwygen -input arithmetic_base.go -output . -targets avx2,avx512,avx2:asm,avx512:asm,neon:asm,fallback -dispatch arithmetic
 
 import "github.com/ajroetker/go-highway/hwy"
 
@@ -39,6 +39,8 @@ import "github.com/ajroetker/go-highway/hwy"
 //	dst := []float32{1, 2, 3, 4}
 //	s := []float32{5, 6, 7, 8}
 //	BaseAdd(dst, s)  // dst is now {6, 8, 10, 12}
+//
+//hwy:maskedtail
 func BaseAdd[T hwy.Floats](dst, s []T) {
 	if len(dst) == 0 || len(s) == 0 {
 		return
@@ -75,6 +77,8 @@ func BaseAdd[T hwy.Floats](dst, s []T) {
 //	b := []float32{5, 6, 7, 8}
 //	dst := make([]float32, 4)
 //	BaseAddTo(dst, a, b)  // dst is now {6, 8, 10, 12}
+//
+//hwy:maskedtail
 func BaseAddTo[T hwy.Floats](dst, a, b []T) {
 	if len(dst) == 0 || len(a) == 0 || len(b) == 0 {
 		return
@@ -110,6 +114,8 @@ func BaseAddTo[T hwy.Floats](dst, a, b []T) {
 //	dst := []float32{10, 20, 30, 40}
 //	s := []float32{1, 2, 3, 4}
 //	BaseSub(dst, s)  // dst is now {9, 18, 27, 36}
+//
+//hwy:maskedtail
 func BaseSub[T hwy.Floats](dst, s []T) {
 	if len(dst) == 0 || len(s) == 0 {
 		return
@@ -146,6 +152,8 @@ func BaseSub[T hwy.Floats](dst, s []T) {
 //	b := []float32{1, 2, 3, 4}
 //	dst := make([]float32, 4)
 //	BaseSubTo(dst, a, b)  // dst is now {9, 18, 27, 36}
+//
+//hwy:maskedtail
 func BaseSubTo[T hwy.Floats](dst, a, b []T) {
 	if len(dst) == 0 || len(a) == 0 || len(b) == 0 {
 		return
@@ -181,6 +189,8 @@ func BaseSubTo[T hwy.Floats](dst, a, b []T) {
 //	dst := []float32{1, 2, 3, 4}
 //	s := []float32{2, 3, 4, 5}
 //	BaseMul(dst, s)  // dst is now {2, 6, 12, 20}
+//
+//hwy:maskedtail
 func BaseMul[T hwy.Floats](dst, s []T) {
 	if len(dst) == 0 || len(s) == 0 {
 		return
@@ -217,6 +227,8 @@ func BaseMul[T hwy.Floats](dst, s []T) {
 //	b := []float32{2, 3, 4, 5}
 //	dst := make([]float32, 4)
 //	BaseMulTo(dst, a, b)  // dst is now {2, 6, 12, 20}
+//
+//hwy:maskedtail
 func BaseMulTo[T hwy.Floats](dst, a, b []T) {
 	if len(dst) == 0 || len(a) == 0 || len(b) == 0 {
 		return
@@ -255,6 +267,8 @@ func BaseMulTo[T hwy.Floats](dst, a, b []T) {
 //	dst := []float32{10, 20, 30, 40}
 //	s := []float32{2, 4, 5, 8}
 //	BaseDiv(dst, s)  // dst is now {5, 5, 6, 5}
+//
+//hwy:maskedtail
 func BaseDiv[T hwy.Floats](dst, s []T) {
 	if len(dst) == 0 || len(s) == 0 {
 		return
@@ -294,6 +308,8 @@ func BaseDiv[T hwy.Floats](dst, s []T) {
 //	b := []float32{2, 4, 5, 8}
 //	dst := make([]float32, 4)
 //	BaseDivTo(dst, a, b)  // dst is now {5, 5, 6, 5}
+//
+//hwy:maskedtail
 func BaseDivTo[T hwy.Floats](dst, a, b []T) {
 	if len(dst) == 0 || len(a) == 0 || len(b) == 0 {
 		return
@@ -327,6 +343,8 @@ func BaseDivTo[T hwy.Floats](dst, a, b []T) {
 //
 //	dst := []float32{1, 2, 3, 4}
 //	BaseScale(2.5, dst)  // dst is now {2.5, 5, 7.5, 10}
+//
+//hwy:maskedtail
 func BaseScale[T hwy.Floats](c T, dst []T) {
 	if len(dst) == 0 {
 		return
@@ -362,6 +380,8 @@ func BaseScale[T hwy.Floats](c T, dst []T) {
 //	s := []float32{1, 2, 3, 4}
 //	dst := make([]float32, 4)
 //	BaseScaleTo(dst, 2.5, s)  // dst is now {2.5, 5, 7.5, 10}
+//
+//hwy:maskedtail
 func BaseScaleTo[T hwy.Floats](dst []T, c T, s []T) {
 	if len(dst) == 0 || len(s) == 0 {
 		return
@@ -395,6 +415,8 @@ func BaseScaleTo[T hwy.Floats](dst []T, c T, s []T) {
 //
 //	dst := []float32{1, 2, 3, 4}
 //	BaseAddConst(10, dst)  // dst is now {11, 12, 13, 14}
+//
+//hwy:maskedtail
 func BaseAddConst[T hwy.Floats](c T, dst []T) {
 	if len(dst) == 0 {
 		return
@@ -434,6 +456,8 @@ func BaseAddConst[T hwy.Floats](c T, dst []T) {
 //	dst := []float32{1, 2, 3, 4}
 //	x := []float32{1, 1, 1, 1}
 //	BaseMulConstAddTo(dst, 10, x)  // dst is now {11, 12, 13, 14}
+//
+//hwy:maskedtail
 func BaseMulConstAddTo[T hwy.Floats](dst []T, a T, x []T) {
 	if len(dst) == 0 || len(x) == 0 {
 		return
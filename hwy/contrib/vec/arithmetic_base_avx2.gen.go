@@ -81,8 +81,7 @@ func BaseAdd_avx2(dst []float32, s []float32) {
 	n := min(len(dst), len(s))
 	lanes := 8
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
 		vs := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&s[i])))
 		result := vd.Add(vs)
@@ -100,8 +99,18 @@ func BaseAdd_avx2(dst []float32, s []float32) {
 		result3 := vd3.Add(vs3)
 		result3.Store((*[8]float32)(unsafe.Pointer(&dst[i+24])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
+		vs := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&s[i])))
+		result := vd.Add(vs)
+		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseAdd_fallback(dst[i:n], s[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		vd := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, dst[i:])
+		vs := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, s[i:])
+		result := vd.Add(vs)
+		hwy.MaskStore_AVX2_F32x8(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -112,8 +121,7 @@ func BaseAdd_avx2_Float64(dst []float64, s []float64) {
 	n := min(len(dst), len(s))
 	lanes := 4
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
 		vs := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&s[i])))
 		result := vd.Add(vs)
@@ -131,8 +139,18 @@ func BaseAdd_avx2_Float64(dst []float64, s []float64) {
 		result3 := vd3.Add(vs3)
 		result3.Store((*[4]float64)(unsafe.Pointer(&dst[i+12])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
+		vs := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&s[i])))
+		result := vd.Add(vs)
+		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseAdd_fallback_Float64(dst[i:n], s[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		vd := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, dst[i:])
+		vs := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, s[i:])
+		result := vd.Add(vs)
+		hwy.MaskStore_AVX2_F64x4(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -200,8 +218,7 @@ func BaseAddConst_avx2(c float32, dst []float32) {
 	vc := archsimd.BroadcastFloat32x8(c)
 	lanes := 8
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
 		result := vd.Add(vc)
 		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
@@ -215,8 +232,16 @@ func BaseAddConst_avx2(c float32, dst []float32) {
 		result3 := vd3.Add(vc)
 		result3.Store((*[8]float32)(unsafe.Pointer(&dst[i+24])))
 	}
-	for ; i < n; i++ {
-		dst[i] += c
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
+		result := vd.Add(vc)
+		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
+	}
+	if i < n {
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		vd := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, dst[i:])
+		result := vd.Add(vc)
+		hwy.MaskStore_AVX2_F32x8(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -228,8 +253,7 @@ func BaseAddConst_avx2_Float64(c float64, dst []float64) {
 	vc := archsimd.BroadcastFloat64x4(c)
 	lanes := 4
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
 		result := vd.Add(vc)
 		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
@@ -243,8 +267,16 @@ func BaseAddConst_avx2_Float64(c float64, dst []float64) {
 		result3 := vd3.Add(vc)
 		result3.Store((*[4]float64)(unsafe.Pointer(&dst[i+12])))
 	}
-	for ; i < n; i++ {
-		dst[i] += c
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
+		result := vd.Add(vc)
+		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
+	}
+	if i < n {
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		vd := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, dst[i:])
+		result := vd.Add(vc)
+		hwy.MaskStore_AVX2_F64x4(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -317,8 +349,7 @@ func BaseAddTo_avx2(dst []float32, a []float32, b []float32) {
 	n := min(len(dst), min(len(a), len(b)))
 	lanes := 8
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&a[i])))
 		vb := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&b[i])))
 		result := va.Add(vb)
@@ -336,8 +367,18 @@ func BaseAddTo_avx2(dst []float32, a []float32, b []float32) {
 		result3 := va3.Add(vb3)
 		result3.Store((*[8]float32)(unsafe.Pointer(&dst[i+24])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&a[i])))
+		vb := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&b[i])))
+		result := va.Add(vb)
+		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseAddTo_fallback(dst[i:n], a[i:n], b[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		va := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, a[i:])
+		vb := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, b[i:])
+		result := va.Add(vb)
+		hwy.MaskStore_AVX2_F32x8(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -348,8 +389,7 @@ func BaseAddTo_avx2_Float64(dst []float64, a []float64, b []float64) {
 	n := min(len(dst), min(len(a), len(b)))
 	lanes := 4
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&a[i])))
 		vb := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&b[i])))
 		result := va.Add(vb)
@@ -367,8 +407,18 @@ func BaseAddTo_avx2_Float64(dst []float64, a []float64, b []float64) {
 		result3 := va3.Add(vb3)
 		result3.Store((*[4]float64)(unsafe.Pointer(&dst[i+12])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&a[i])))
+		vb := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&b[i])))
+		result := va.Add(vb)
+		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseAddTo_fallback_Float64(dst[i:n], a[i:n], b[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		va := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, a[i:])
+		vb := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, b[i:])
+		result := va.Add(vb)
+		hwy.MaskStore_AVX2_F64x4(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -441,8 +491,7 @@ func BaseDiv_avx2(dst []float32, s []float32) {
 	n := min(len(dst), len(s))
 	lanes := 8
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
 		vs := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&s[i])))
 		result := vd.Div(vs)
@@ -460,8 +509,18 @@ func BaseDiv_avx2(dst []float32, s []float32) {
 		result3 := vd3.Div(vs3)
 		result3.Store((*[8]float32)(unsafe.Pointer(&dst[i+24])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
+		vs := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&s[i])))
+		result := vd.Div(vs)
+		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseDiv_fallback(dst[i:n], s[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		vd := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, dst[i:])
+		vs := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, s[i:])
+		result := vd.Div(vs)
+		hwy.MaskStore_AVX2_F32x8(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -472,8 +531,7 @@ func BaseDiv_avx2_Float64(dst []float64, s []float64) {
 	n := min(len(dst), len(s))
 	lanes := 4
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
 		vs := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&s[i])))
 		result := vd.Div(vs)
@@ -491,8 +549,18 @@ func BaseDiv_avx2_Float64(dst []float64, s []float64) {
 		result3 := vd3.Div(vs3)
 		result3.Store((*[4]float64)(unsafe.Pointer(&dst[i+12])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
+		vs := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&s[i])))
+		result := vd.Div(vs)
+		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseDiv_fallback_Float64(dst[i:n], s[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		vd := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, dst[i:])
+		vs := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, s[i:])
+		result := vd.Div(vs)
+		hwy.MaskStore_AVX2_F64x4(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -565,8 +633,7 @@ func BaseDivTo_avx2(dst []float32, a []float32, b []float32) {
 	n := min(len(dst), min(len(a), len(b)))
 	lanes := 8
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&a[i])))
 		vb := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&b[i])))
 		result := va.Div(vb)
@@ -584,8 +651,18 @@ func BaseDivTo_avx2(dst []float32, a []float32, b []float32) {
 		result3 := va3.Div(vb3)
 		result3.Store((*[8]float32)(unsafe.Pointer(&dst[i+24])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&a[i])))
+		vb := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&b[i])))
+		result := va.Div(vb)
+		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseDivTo_fallback(dst[i:n], a[i:n], b[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		va := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, a[i:])
+		vb := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, b[i:])
+		result := va.Div(vb)
+		hwy.MaskStore_AVX2_F32x8(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -596,8 +673,7 @@ func BaseDivTo_avx2_Float64(dst []float64, a []float64, b []float64) {
 	n := min(len(dst), min(len(a), len(b)))
 	lanes := 4
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&a[i])))
 		vb := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&b[i])))
 		result := va.Div(vb)
@@ -615,8 +691,18 @@ func BaseDivTo_avx2_Float64(dst []float64, a []float64, b []float64) {
 		result3 := va3.Div(vb3)
 		result3.Store((*[4]float64)(unsafe.Pointer(&dst[i+12])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&a[i])))
+		vb := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&b[i])))
+		result := va.Div(vb)
+		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseDivTo_fallback_Float64(dst[i:n], a[i:n], b[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		va := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, a[i:])
+		vb := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, b[i:])
+		result := va.Div(vb)
+		hwy.MaskStore_AVX2_F64x4(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -689,8 +775,7 @@ func BaseMul_avx2(dst []float32, s []float32) {
 	n := min(len(dst), len(s))
 	lanes := 8
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
 		vs := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&s[i])))
 		result := vd.Mul(vs)
@@ -708,8 +793,18 @@ func BaseMul_avx2(dst []float32, s []float32) {
 		result3 := vd3.Mul(vs3)
 		result3.Store((*[8]float32)(unsafe.Pointer(&dst[i+24])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
+		vs := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&s[i])))
+		result := vd.Mul(vs)
+		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseMul_fallback(dst[i:n], s[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		vd := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, dst[i:])
+		vs := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, s[i:])
+		result := vd.Mul(vs)
+		hwy.MaskStore_AVX2_F32x8(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -720,8 +815,7 @@ func BaseMul_avx2_Float64(dst []float64, s []float64) {
 	n := min(len(dst), len(s))
 	lanes := 4
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
 		vs := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&s[i])))
 		result := vd.Mul(vs)
@@ -739,8 +833,18 @@ func BaseMul_avx2_Float64(dst []float64, s []float64) {
 		result3 := vd3.Mul(vs3)
 		result3.Store((*[4]float64)(unsafe.Pointer(&dst[i+12])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
+		vs := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&s[i])))
+		result := vd.Mul(vs)
+		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseMul_fallback_Float64(dst[i:n], s[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		vd := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, dst[i:])
+		vs := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, s[i:])
+		result := vd.Mul(vs)
+		hwy.MaskStore_AVX2_F64x4(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -816,8 +920,7 @@ func BaseMulConstAddTo_avx2(dst []float32, a float32, x []float32) {
 	va := archsimd.BroadcastFloat32x8(a)
 	lanes := 8
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
 		vx := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[i])))
 		result := va.MulAdd(vx, vd)
@@ -835,8 +938,18 @@ func BaseMulConstAddTo_avx2(dst []float32, a float32, x []float32) {
 		result3 := va.MulAdd(vx3, vd3)
 		result3.Store((*[8]float32)(unsafe.Pointer(&dst[i+24])))
 	}
-	for ; i < n; i++ {
-		dst[i] += a * x[i]
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
+		vx := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&x[i])))
+		result := va.MulAdd(vx, vd)
+		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
+	}
+	if i < n {
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		vd := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, dst[i:])
+		vx := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, x[i:])
+		result := va.MulAdd(vx, vd)
+		hwy.MaskStore_AVX2_F32x8(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -848,8 +961,7 @@ func BaseMulConstAddTo_avx2_Float64(dst []float64, a float64, x []float64) {
 	va := archsimd.BroadcastFloat64x4(a)
 	lanes := 4
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
 		vx := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&x[i])))
 		result := va.MulAdd(vx, vd)
@@ -867,8 +979,18 @@ func BaseMulConstAddTo_avx2_Float64(dst []float64, a float64, x []float64) {
 		result3 := va.MulAdd(vx3, vd3)
 		result3.Store((*[4]float64)(unsafe.Pointer(&dst[i+12])))
 	}
-	for ; i < n; i++ {
-		dst[i] += a * x[i]
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
+		vx := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&x[i])))
+		result := va.MulAdd(vx, vd)
+		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
+	}
+	if i < n {
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		vd := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, dst[i:])
+		vx := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, x[i:])
+		result := va.MulAdd(vx, vd)
+		hwy.MaskStore_AVX2_F64x4(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -941,8 +1063,7 @@ func BaseMulTo_avx2(dst []float32, a []float32, b []float32) {
 	n := min(len(dst), min(len(a), len(b)))
 	lanes := 8
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&a[i])))
 		vb := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&b[i])))
 		result := va.Mul(vb)
@@ -960,8 +1081,18 @@ func BaseMulTo_avx2(dst []float32, a []float32, b []float32) {
 		result3 := va3.Mul(vb3)
 		result3.Store((*[8]float32)(unsafe.Pointer(&dst[i+24])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&a[i])))
+		vb := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&b[i])))
+		result := va.Mul(vb)
+		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseMulTo_fallback(dst[i:n], a[i:n], b[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		va := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, a[i:])
+		vb := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, b[i:])
+		result := va.Mul(vb)
+		hwy.MaskStore_AVX2_F32x8(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -972,8 +1103,7 @@ func BaseMulTo_avx2_Float64(dst []float64, a []float64, b []float64) {
 	n := min(len(dst), min(len(a), len(b)))
 	lanes := 4
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&a[i])))
 		vb := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&b[i])))
 		result := va.Mul(vb)
@@ -991,8 +1121,18 @@ func BaseMulTo_avx2_Float64(dst []float64, a []float64, b []float64) {
 		result3 := va3.Mul(vb3)
 		result3.Store((*[4]float64)(unsafe.Pointer(&dst[i+12])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&a[i])))
+		vb := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&b[i])))
+		result := va.Mul(vb)
+		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseMulTo_fallback_Float64(dst[i:n], a[i:n], b[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		va := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, a[i:])
+		vb := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, b[i:])
+		result := va.Mul(vb)
+		hwy.MaskStore_AVX2_F64x4(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -1060,8 +1200,7 @@ func BaseScale_avx2(c float32, dst []float32) {
 	vc := archsimd.BroadcastFloat32x8(c)
 	lanes := 8
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
 		result := vd.Mul(vc)
 		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
@@ -1075,8 +1214,16 @@ func BaseScale_avx2(c float32, dst []float32) {
 		result3 := vd3.Mul(vc)
 		result3.Store((*[8]float32)(unsafe.Pointer(&dst[i+24])))
 	}
-	for ; i < n; i++ {
-		dst[i] *= c
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
+		result := vd.Mul(vc)
+		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
+	}
+	if i < n {
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		vd := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, dst[i:])
+		result := vd.Mul(vc)
+		hwy.MaskStore_AVX2_F32x8(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -1088,8 +1235,7 @@ func BaseScale_avx2_Float64(c float64, dst []float64) {
 	vc := archsimd.BroadcastFloat64x4(c)
 	lanes := 4
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
 		result := vd.Mul(vc)
 		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
@@ -1103,8 +1249,16 @@ func BaseScale_avx2_Float64(c float64, dst []float64) {
 		result3 := vd3.Mul(vc)
 		result3.Store((*[4]float64)(unsafe.Pointer(&dst[i+12])))
 	}
-	for ; i < n; i++ {
-		dst[i] *= c
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
+		result := vd.Mul(vc)
+		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
+	}
+	if i < n {
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		vd := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, dst[i:])
+		result := vd.Mul(vc)
+		hwy.MaskStore_AVX2_F64x4(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -1172,8 +1326,7 @@ func BaseScaleTo_avx2(dst []float32, c float32, s []float32) {
 	vc := archsimd.BroadcastFloat32x8(c)
 	lanes := 8
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vs := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&s[i])))
 		result := vc.Mul(vs)
 		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
@@ -1187,8 +1340,16 @@ func BaseScaleTo_avx2(dst []float32, c float32, s []float32) {
 		result3 := vc.Mul(vs3)
 		result3.Store((*[8]float32)(unsafe.Pointer(&dst[i+24])))
 	}
-	for ; i < n; i++ {
-		dst[i] = c * s[i]
+	for ; i+lanes <= n; i += lanes {
+		vs := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&s[i])))
+		result := vc.Mul(vs)
+		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
+	}
+	if i < n {
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		vs := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, s[i:])
+		result := vc.Mul(vs)
+		hwy.MaskStore_AVX2_F32x8(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -1200,8 +1361,7 @@ func BaseScaleTo_avx2_Float64(dst []float64, c float64, s []float64) {
 	vc := archsimd.BroadcastFloat64x4(c)
 	lanes := 4
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vs := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&s[i])))
 		result := vc.Mul(vs)
 		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
@@ -1215,8 +1375,16 @@ func BaseScaleTo_avx2_Float64(dst []float64, c float64, s []float64) {
 		result3 := vc.Mul(vs3)
 		result3.Store((*[4]float64)(unsafe.Pointer(&dst[i+12])))
 	}
-	for ; i < n; i++ {
-		dst[i] = c * s[i]
+	for ; i+lanes <= n; i += lanes {
+		vs := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&s[i])))
+		result := vc.Mul(vs)
+		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
+	}
+	if i < n {
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		vs := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, s[i:])
+		result := vc.Mul(vs)
+		hwy.MaskStore_AVX2_F64x4(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -1289,8 +1457,7 @@ func BaseSub_avx2(dst []float32, s []float32) {
 	n := min(len(dst), len(s))
 	lanes := 8
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
 		vs := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&s[i])))
 		result := vd.Sub(vs)
@@ -1308,8 +1475,18 @@ func BaseSub_avx2(dst []float32, s []float32) {
 		result3 := vd3.Sub(vs3)
 		result3.Store((*[8]float32)(unsafe.Pointer(&dst[i+24])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&dst[i])))
+		vs := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&s[i])))
+		result := vd.Sub(vs)
+		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseSub_fallback(dst[i:n], s[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		vd := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, dst[i:])
+		vs := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, s[i:])
+		result := vd.Sub(vs)
+		hwy.MaskStore_AVX2_F32x8(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -1320,8 +1497,7 @@ func BaseSub_avx2_Float64(dst []float64, s []float64) {
 	n := min(len(dst), len(s))
 	lanes := 4
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
 		vs := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&s[i])))
 		result := vd.Sub(vs)
@@ -1339,8 +1515,18 @@ func BaseSub_avx2_Float64(dst []float64, s []float64) {
 		result3 := vd3.Sub(vs3)
 		result3.Store((*[4]float64)(unsafe.Pointer(&dst[i+12])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		vd := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&dst[i])))
+		vs := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&s[i])))
+		result := vd.Sub(vs)
+		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseSub_fallback_Float64(dst[i:n], s[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		vd := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, dst[i:])
+		vs := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, s[i:])
+		result := vd.Sub(vs)
+		hwy.MaskStore_AVX2_F64x4(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -1413,8 +1599,7 @@ func BaseSubTo_avx2(dst []float32, a []float32, b []float32) {
 	n := min(len(dst), min(len(a), len(b)))
 	lanes := 8
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&a[i])))
 		vb := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&b[i])))
 		result := va.Sub(vb)
@@ -1432,8 +1617,18 @@ func BaseSubTo_avx2(dst []float32, a []float32, b []float32) {
 		result3 := va3.Sub(vb3)
 		result3.Store((*[8]float32)(unsafe.Pointer(&dst[i+24])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&a[i])))
+		vb := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&b[i])))
+		result := va.Sub(vb)
+		result.Store((*[8]float32)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseSubTo_fallback(dst[i:n], a[i:n], b[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		va := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, a[i:])
+		vb := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, b[i:])
+		result := va.Sub(vb)
+		hwy.MaskStore_AVX2_F32x8(hwyTailMask, result, dst[i:])
 	}
 }
 
@@ -1444,8 +1639,7 @@ func BaseSubTo_avx2_Float64(dst []float64, a []float64, b []float64) {
 	n := min(len(dst), min(len(a), len(b)))
 	lanes := 4
 	var i int
-	i = 0
-	for ; i+lanes*4 <= n; i += lanes * 4 {
+	for i = 0; i+lanes*4 <= n; i += lanes * 4 {
 		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&a[i])))
 		vb := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&b[i])))
 		result := va.Sub(vb)
@@ -1463,7 +1657,17 @@ func BaseSubTo_avx2_Float64(dst []float64, a []float64, b []float64) {
 		result3 := va3.Sub(vb3)
 		result3.Store((*[4]float64)(unsafe.Pointer(&dst[i+12])))
 	}
+	for ; i+lanes <= n; i += lanes {
+		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&a[i])))
+		vb := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&b[i])))
+		result := va.Sub(vb)
+		result.Store((*[4]float64)(unsafe.Pointer(&dst[i])))
+	}
 	if i < n {
-		BaseSubTo_fallback_Float64(dst[i:n], a[i:n], b[i:n])
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		va := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, a[i:])
+		vb := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, b[i:])
+		result := va.Sub(vb)
+		hwy.MaskStore_AVX2_F64x4(hwyTailMask, result, dst[i:])
 	}
 }
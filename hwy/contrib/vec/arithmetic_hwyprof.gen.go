@@ -0,0 +1,372 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("vec", "Add", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := AddFloat16; hwyImpl != nil {
+			AddFloat16 = func(dst []hwy.Float16, s []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := AddBFloat16; hwyImpl != nil {
+			AddBFloat16 = func(dst []hwy.BFloat16, s []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := AddFloat32; hwyImpl != nil {
+			AddFloat32 = func(dst []float32, s []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := AddFloat64; hwyImpl != nil {
+			AddFloat64 = func(dst []float64, s []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "AddConst", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := AddConstFloat16; hwyImpl != nil {
+			AddConstFloat16 = func(c hwy.Float16, dst []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(c, dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := AddConstBFloat16; hwyImpl != nil {
+			AddConstBFloat16 = func(c hwy.BFloat16, dst []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(c, dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := AddConstFloat32; hwyImpl != nil {
+			AddConstFloat32 = func(c float32, dst []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(c, dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := AddConstFloat64; hwyImpl != nil {
+			AddConstFloat64 = func(c float64, dst []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(c, dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "AddTo", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := AddToFloat16; hwyImpl != nil {
+			AddToFloat16 = func(dst []hwy.Float16, a []hwy.Float16, b []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := AddToBFloat16; hwyImpl != nil {
+			AddToBFloat16 = func(dst []hwy.BFloat16, a []hwy.BFloat16, b []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := AddToFloat32; hwyImpl != nil {
+			AddToFloat32 = func(dst []float32, a []float32, b []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := AddToFloat64; hwyImpl != nil {
+			AddToFloat64 = func(dst []float64, a []float64, b []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "Div", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DivFloat16; hwyImpl != nil {
+			DivFloat16 = func(dst []hwy.Float16, s []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := DivBFloat16; hwyImpl != nil {
+			DivBFloat16 = func(dst []hwy.BFloat16, s []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := DivFloat32; hwyImpl != nil {
+			DivFloat32 = func(dst []float32, s []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := DivFloat64; hwyImpl != nil {
+			DivFloat64 = func(dst []float64, s []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "DivTo", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DivToFloat16; hwyImpl != nil {
+			DivToFloat16 = func(dst []hwy.Float16, a []hwy.Float16, b []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := DivToBFloat16; hwyImpl != nil {
+			DivToBFloat16 = func(dst []hwy.BFloat16, a []hwy.BFloat16, b []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := DivToFloat32; hwyImpl != nil {
+			DivToFloat32 = func(dst []float32, a []float32, b []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := DivToFloat64; hwyImpl != nil {
+			DivToFloat64 = func(dst []float64, a []float64, b []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "Mul", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MulFloat16; hwyImpl != nil {
+			MulFloat16 = func(dst []hwy.Float16, s []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := MulBFloat16; hwyImpl != nil {
+			MulBFloat16 = func(dst []hwy.BFloat16, s []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := MulFloat32; hwyImpl != nil {
+			MulFloat32 = func(dst []float32, s []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := MulFloat64; hwyImpl != nil {
+			MulFloat64 = func(dst []float64, s []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "MulConstAddTo", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MulConstAddToFloat16; hwyImpl != nil {
+			MulConstAddToFloat16 = func(dst []hwy.Float16, a hwy.Float16, x []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, x)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(x))
+			}
+		}
+		if hwyImpl := MulConstAddToBFloat16; hwyImpl != nil {
+			MulConstAddToBFloat16 = func(dst []hwy.BFloat16, a hwy.BFloat16, x []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, x)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(x))
+			}
+		}
+		if hwyImpl := MulConstAddToFloat32; hwyImpl != nil {
+			MulConstAddToFloat32 = func(dst []float32, a float32, x []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, x)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(x))
+			}
+		}
+		if hwyImpl := MulConstAddToFloat64; hwyImpl != nil {
+			MulConstAddToFloat64 = func(dst []float64, a float64, x []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, x)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(x))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "MulTo", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MulToFloat16; hwyImpl != nil {
+			MulToFloat16 = func(dst []hwy.Float16, a []hwy.Float16, b []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := MulToBFloat16; hwyImpl != nil {
+			MulToBFloat16 = func(dst []hwy.BFloat16, a []hwy.BFloat16, b []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := MulToFloat32; hwyImpl != nil {
+			MulToFloat32 = func(dst []float32, a []float32, b []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := MulToFloat64; hwyImpl != nil {
+			MulToFloat64 = func(dst []float64, a []float64, b []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "Scale", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ScaleFloat16; hwyImpl != nil {
+			ScaleFloat16 = func(c hwy.Float16, dst []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(c, dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := ScaleBFloat16; hwyImpl != nil {
+			ScaleBFloat16 = func(c hwy.BFloat16, dst []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(c, dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := ScaleFloat32; hwyImpl != nil {
+			ScaleFloat32 = func(c float32, dst []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(c, dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := ScaleFloat64; hwyImpl != nil {
+			ScaleFloat64 = func(c float64, dst []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(c, dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "ScaleTo", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ScaleToFloat16; hwyImpl != nil {
+			ScaleToFloat16 = func(dst []hwy.Float16, c hwy.Float16, s []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, c, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := ScaleToBFloat16; hwyImpl != nil {
+			ScaleToBFloat16 = func(dst []hwy.BFloat16, c hwy.BFloat16, s []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, c, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := ScaleToFloat32; hwyImpl != nil {
+			ScaleToFloat32 = func(dst []float32, c float32, s []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, c, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := ScaleToFloat64; hwyImpl != nil {
+			ScaleToFloat64 = func(dst []float64, c float64, s []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, c, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "Sub", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SubFloat16; hwyImpl != nil {
+			SubFloat16 = func(dst []hwy.Float16, s []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := SubBFloat16; hwyImpl != nil {
+			SubBFloat16 = func(dst []hwy.BFloat16, s []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := SubFloat32; hwyImpl != nil {
+			SubFloat32 = func(dst []float32, s []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+		if hwyImpl := SubFloat64; hwyImpl != nil {
+			SubFloat64 = func(dst []float64, s []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, s)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(s))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "SubTo", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SubToFloat16; hwyImpl != nil {
+			SubToFloat16 = func(dst []hwy.Float16, a []hwy.Float16, b []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := SubToBFloat16; hwyImpl != nil {
+			SubToBFloat16 = func(dst []hwy.BFloat16, a []hwy.BFloat16, b []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := SubToFloat32; hwyImpl != nil {
+			SubToFloat32 = func(dst []float32, a []float32, b []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+		if hwyImpl := SubToFloat64; hwyImpl != nil {
+			SubToFloat64 = func(dst []float64, a []float64, b []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, a, b)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(a)+hwy.SliceBytes(b))
+			}
+		}
+	})
+}
@@ -393,6 +393,26 @@ func SubTo[T hwy.Floats](dst []T, a []T, b []T) {
 
 func init() {
 	initArithmeticAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Add", Vars: []any{&AddFloat16, &AddBFloat16, &AddFloat32, &AddFloat64}},
+			{Name: "AddConst", Vars: []any{&AddConstFloat16, &AddConstBFloat16, &AddConstFloat32, &AddConstFloat64}},
+			{Name: "AddTo", Vars: []any{&AddToFloat16, &AddToBFloat16, &AddToFloat32, &AddToFloat64}},
+			{Name: "Div", Vars: []any{&DivFloat16, &DivBFloat16, &DivFloat32, &DivFloat64}},
+			{Name: "DivTo", Vars: []any{&DivToFloat16, &DivToBFloat16, &DivToFloat32, &DivToFloat64}},
+			{Name: "Mul", Vars: []any{&MulFloat16, &MulBFloat16, &MulFloat32, &MulFloat64}},
+			{Name: "MulConstAddTo", Vars: []any{&MulConstAddToFloat16, &MulConstAddToBFloat16, &MulConstAddToFloat32, &MulConstAddToFloat64}},
+			{Name: "MulTo", Vars: []any{&MulToFloat16, &MulToBFloat16, &MulToFloat32, &MulToFloat64}},
+			{Name: "Scale", Vars: []any{&ScaleFloat16, &ScaleBFloat16, &ScaleFloat32, &ScaleFloat64}},
+			{Name: "ScaleTo", Vars: []any{&ScaleToFloat16, &ScaleToBFloat16, &ScaleToFloat32, &ScaleToFloat64}},
+			{Name: "Sub", Vars: []any{&SubFloat16, &SubBFloat16, &SubFloat32, &SubFloat64}},
+			{Name: "SubTo", Vars: []any{&SubToFloat16, &SubToBFloat16, &SubToFloat32, &SubToFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initArithmeticFallback},
+		},
+	})
 }
 
 func initArithmeticAll() {
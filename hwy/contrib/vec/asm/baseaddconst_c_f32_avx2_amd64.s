@@ -0,0 +1,106 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/baseaddconst_c_f32_avx2_amd64.c
+
+TEXT ·addconst_c_f32_avx2(SB), $0-24
+	MOVQ pc+0(FP), DI
+	MOVQ dst+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b4c; BYTE $0x02     // movq	(%rdx), %r8
+	WORD $0x8948; BYTE $0xf1     // movq	%rsi, %rcx
+	WORD $0x854d; BYTE $0xc0     // testq	%r8, %r8
+	JE   BB0_25
+	LONG $0x1710fac5             // vmovss	(%rdi), %xmm2
+	LONG $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG $0x07f88349             // cmpq	$7, %r8
+	JLE  BB0_27
+	LONG $0xf8508d49             // leaq	-8(%r8), %rdx
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	LONG $0x03eac148             // shrq	$3, %rdx
+	WORD $0x8948; BYTE $0xd6     // movq	%rdx, %rsi
+	LONG $0x05e6c148             // salq	$5, %rsi
+	LONG $0x31748d48; BYTE $0x20 // leaq	32(%rcx,%rsi), %rsi
+
+BB0_5:
+	LONG $0x0058f4c5             // vaddps	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fcc5; BYTE $0xe0 // vmovups	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc6     // cmpq	%rax, %rsi
+	JNE  BB0_5
+	LONG $0x01c28348             // addq	$1, %rdx
+	QUAD $0x00000000d5348d48     // leaq	0(,%rdx,8), %rsi
+	WORD $0x3949; BYTE $0xf0     // cmpq	%rsi, %r8
+	JLE  BB0_24
+	WORD $0x894c; BYTE $0xc0     // movq	%r8, %rax
+	WORD $0x8948; BYTE $0xf7     // movq	%rsi, %rdi
+	WORD $0x2948; BYTE $0xf0     // subq	%rsi, %rax
+	LONG $0xff488d4c             // leaq	-1(%rax), %r9
+	LONG $0x06f98349             // cmpq	$6, %r9
+	JBE  BB0_9
+	LONG $0x05e2c148             // salq	$5, %rdx
+	WORD $0x0148; BYTE $0xca     // addq	%rcx, %rdx
+	LONG $0x0a58f4c5             // vaddps	(%rdx), %ymm1, %ymm1
+	LONG $0x0a11fcc5             // vmovups	%ymm1, (%rdx)
+	WORD $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+	LONG $0xf8e28348             // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd6     // addq	%rdx, %rsi
+	WORD $0x07a8                 // testb	$7, %al
+	JE   BB0_24
+
+BB0_4:
+	WORD $0x2948; BYTE $0xd0     // subq	%rdx, %rax
+	LONG $0xff488d4c             // leaq	-1(%rax), %r9
+	LONG $0x02f98349             // cmpq	$2, %r9
+	JBE  BB0_7
+	WORD $0x0148; BYTE $0xfa     // addq	%rdi, %rdx
+	LONG $0xc2c6e8c5; BYTE $0x00 // vshufps	$0, %xmm2, %xmm2, %xmm0
+	LONG $0x91148d48             // leaq	(%rcx,%rdx,4), %rdx
+	LONG $0x0258f8c5             // vaddps	(%rdx), %xmm0, %xmm0
+	LONG $0x0211f8c5             // vmovups	%xmm0, (%rdx)
+	WORD $0x03a8                 // testb	$3, %al
+	JE   BB0_24
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc6     // addq	%rax, %rsi
+
+BB0_7:
+	QUAD $0x00000000b5048d48     // leaq	0(,%rsi,4), %rax
+	LONG $0x01148d48             // leaq	(%rcx,%rax), %rdx
+	LONG $0x0258eac5             // vaddss	(%rdx), %xmm2, %xmm0
+	LONG $0x0211fac5             // vmovss	%xmm0, (%rdx)
+	LONG $0x01568d48             // leaq	1(%rsi), %rdx
+	WORD $0x3949; BYTE $0xd0     // cmpq	%rdx, %r8
+	JLE  BB0_24
+	LONG $0x01548d48; BYTE $0x04 // leaq	4(%rcx,%rax), %rdx
+	LONG $0x02c68348             // addq	$2, %rsi
+	LONG $0x0258eac5             // vaddss	(%rdx), %xmm2, %xmm0
+	LONG $0x0211fac5             // vmovss	%xmm0, (%rdx)
+	WORD $0x3949; BYTE $0xf0     // cmpq	%rsi, %r8
+	JLE  BB0_24
+	LONG $0x01448d48; BYTE $0x08 // leaq	8(%rcx,%rax), %rax
+	LONG $0x1058eac5             // vaddss	(%rax), %xmm2, %xmm2
+	LONG $0x1011fac5             // vmovss	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_24:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_25:
+	RET
+
+BB0_27:
+	WORD $0x854d; BYTE $0xc0 // testq	%r8, %r8
+	JLE  BB0_24
+	WORD $0x894c; BYTE $0xc0 // movq	%r8, %rax
+	WORD $0xff31             // xorl	%edi, %edi
+	WORD $0xd231             // xorl	%edx, %edx
+	WORD $0xf631             // xorl	%esi, %esi
+	JMP  BB0_4
+
+BB0_9:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_4
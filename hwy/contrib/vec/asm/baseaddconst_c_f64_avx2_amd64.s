@@ -0,0 +1,89 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/baseaddconst_c_f64_avx2_amd64.c
+
+TEXT ·addconst_c_f64_avx2(SB), $0-24
+	MOVQ pc+0(FP), DI
+	MOVQ dst+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b48; BYTE $0x12     // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_26
+	LONG $0x1710fbc5             // vmovsd	(%rdi), %xmm2
+	LONG $0x197de2c4; BYTE $0xca // vbroadcastsd	%xmm2, %ymm1
+	LONG $0x03fa8348             // cmpq	$3, %rdx
+	JLE  BB0_28
+	LONG $0xfc4a8d48             // leaq	-4(%rdx), %rcx
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	LONG $0x02e9c148             // shrq	$2, %rcx
+	WORD $0x8948; BYTE $0xcf     // movq	%rcx, %rdi
+	LONG $0x05e7c148             // salq	$5, %rdi
+	LONG $0x3e7c8d48; BYTE $0x20 // leaq	32(%rsi,%rdi), %rdi
+
+BB0_5:
+	LONG $0x0058f5c5             // vaddpd	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fdc5; BYTE $0xe0 // vmovupd	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc7     // cmpq	%rax, %rdi
+	JNE  BB0_5
+	LONG $0x01c18348             // addq	$1, %rcx
+	QUAD $0x000000008d048d48     // leaq	0(,%rcx,4), %rax
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_25
+	WORD $0x2948; BYTE $0xc2     // subq	%rax, %rdx
+	WORD $0x8948; BYTE $0xc7     // movq	%rax, %rdi
+	LONG $0xff428d4c             // leaq	-1(%rdx), %r8
+	LONG $0x02f88349             // cmpq	$2, %r8
+	JBE  BB0_9
+	LONG $0x05e1c148             // salq	$5, %rcx
+	WORD $0x0148; BYTE $0xf1     // addq	%rsi, %rcx
+	LONG $0x0958f5c5             // vaddpd	(%rcx), %ymm1, %ymm1
+	LONG $0x0911fdc5             // vmovupd	%ymm1, (%rcx)
+	WORD $0x8948; BYTE $0xd1     // movq	%rdx, %rcx
+	LONG $0xfce18348             // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xc8     // addq	%rcx, %rax
+	WORD $0xc2f6; BYTE $0x03     // testb	$3, %dl
+	JE   BB0_25
+
+BB0_4:
+	WORD $0x2948; BYTE $0xca // subq	%rcx, %rdx
+	LONG $0x01fa8348         // cmpq	$1, %rdx
+	JE   BB0_7
+	WORD $0x0148; BYTE $0xf9 // addq	%rdi, %rcx
+	LONG $0xc212fbc5         // vmovddup	%xmm2, %xmm0
+	LONG $0xce0c8d48         // leaq	(%rsi,%rcx,8), %rcx
+	LONG $0x0158f9c5         // vaddpd	(%rcx), %xmm0, %xmm0
+	LONG $0x0111f9c5         // vmovupd	%xmm0, (%rcx)
+	WORD $0xc2f6; BYTE $0x01 // testb	$1, %dl
+	JE   BB0_25
+	LONG $0xfee28348         // andq	$-2, %rdx
+	WORD $0x0148; BYTE $0xd0 // addq	%rdx, %rax
+
+BB0_7:
+	LONG $0xc6048d48         // leaq	(%rsi,%rax,8), %rax
+	LONG $0x1058ebc5         // vaddsd	(%rax), %xmm2, %xmm2
+	LONG $0x1011fbc5         // vmovsd	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_26:
+	RET
+
+BB0_28:
+	WORD $0x8548; BYTE $0xd2 // testq	%rdx, %rdx
+	JLE  BB0_25
+	WORD $0xff31             // xorl	%edi, %edi
+	WORD $0xc931             // xorl	%ecx, %ecx
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_4
+
+BB0_9:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_4
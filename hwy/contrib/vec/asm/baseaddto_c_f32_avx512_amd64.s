@@ -0,0 +1,244 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/baseaddto_c_f32_avx512_amd64.c
+
+TEXT ·addto_c_f32_avx512(SB), $0-32
+	MOVQ dst+0(FP), DI
+	MOVQ a+8(FP), SI
+	MOVQ b+16(FP), DX
+	MOVQ plen_dst+24(FP), CX
+	WORD $0x8949; BYTE $0xf8     // movq	%rdi, %r8
+	WORD $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	WORD $0x8b48; BYTE $0x11     // movq	(%rcx), %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_57
+	LONG $0x0ffa8348             // cmpq	$15, %rdx
+	JLE  BB0_11
+	LONG $0x000010b8; BYTE $0x00 // movl	$16, %eax
+
+BB0_4:
+	QUAD $0xff864c10487cf162 // vmovups	-64(%rsi,%rax,4), %zmm1
+	QUAD $0xff8744584874f162 // vaddps	-64(%rdi,%rax,4), %zmm1, %zmm0
+	QUAD $0xff804411487cd162 // vmovups	%zmm0, -64(%r8,%rax,4)
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JLE  BB0_4
+	LONG $0xf0428d48         // leaq	-16(%rdx), %rax
+	LONG $0xf0e08348         // andq	$-16, %rax
+	LONG $0x10c08348         // addq	$16, %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_31
+	WORD $0x8949; BYTE $0xd2                   // movq	%rdx, %r10
+	QUAD $0x00000000850c8d48                   // leaq	0(,%rax,4), %rcx
+	WORD $0x2949; BYTE $0xc2                   // subq	%rax, %r10
+	WORD $0x8948; BYTE $0xe5                   // movq	%rsp, %rbp
+	WORD $0x8949; BYTE $0xc5                   // movq	%rax, %r13
+	LONG $0xff5a8d49                           // leaq	-1(%r10), %rbx
+	LONG $0x06fb8348                           // cmpq	$6, %rbx
+	JBE  BB0_5
+	QUAD $0x00000000850c8d48                   // leaq	0(,%rax,4), %rcx
+	LONG $0x081c8d4d                           // leaq	(%r8,%rcx), %r11
+	LONG $0x04498d4c                           // leaq	4(%rcx), %r9
+	LONG $0x0e348d4e                           // leaq	(%rsi,%r9), %r14
+	WORD $0x894d; BYTE $0xdc                   // movq	%r11, %r12
+	WORD $0x294d; BYTE $0xf4                   // subq	%r14, %r12
+	LONG $0x38fc8349                           // cmpq	$56, %r12
+	JBE  BB0_5
+	WORD $0x0149; BYTE $0xf9                   // addq	%rdi, %r9
+	WORD $0x894d; BYTE $0xdc                   // movq	%r11, %r12
+	WORD $0x294d; BYTE $0xcc                   // subq	%r9, %r12
+	LONG $0x38fc8349                           // cmpq	$56, %r12
+	JBE  BB0_5
+	LONG $0x0efb8348                           // cmpq	$14, %rbx
+	JBE  BB0_12
+	LONG $0x487cf162; WORD $0x1c10; BYTE $0x0e // vmovups	(%rsi,%rcx), %zmm3
+	LONG $0x4864f162; WORD $0x0458; BYTE $0x0f // vaddps	(%rdi,%rcx), %zmm3, %zmm0
+	WORD $0x894c; BYTE $0xd1                   // movq	%r10, %rcx
+	LONG $0xf0e18348                           // andq	$-16, %rcx
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x487cd162; WORD $0x0311             // vmovups	%zmm0, (%r11)
+	LONG $0x0fc2f641                           // testb	$15, %r10b
+	JE   BB0_54
+	WORD $0x2949; BYTE $0xca                   // subq	%rcx, %r10
+	LONG $0xff4a8d4d                           // leaq	-1(%r10), %r9
+	LONG $0x06f98349                           // cmpq	$6, %r9
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x014c; BYTE $0xe9       // addq	%r13, %rcx
+	LONG $0x1410fcc5; BYTE $0x8e   // vmovups	(%rsi,%rcx,4), %ymm2
+	LONG $0x0458ecc5; BYTE $0x8f   // vaddps	(%rdi,%rcx,4), %ymm2, %ymm0
+	LONG $0x117cc1c4; WORD $0x8804 // vmovups	%ymm0, (%r8,%rcx,4)
+	WORD $0x894c; BYTE $0xd1       // movq	%r10, %rcx
+	LONG $0xf8e18348               // andq	$-8, %rcx
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	LONG $0x07e28341               // andl	$7, %r10d
+	JE   BB0_54
+
+BB0_8:
+	LONG $0x0410fac5; BYTE $0x86               // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x0458fac5; BYTE $0x87               // vaddss	(%rdi,%rax,4), %xmm0, %xmm0
+	LONG $0x01488d4c                           // leaq	1(%rax), %r9
+	QUAD $0x00000000850c8d48                   // leaq	0(,%rax,4), %rcx
+	LONG $0x117ac1c4; WORD $0x8004             // vmovss	%xmm0, (%r8,%rax,4)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x040e             // vmovss	4(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x040f             // vaddss	4(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x02488d4c                           // leaq	2(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x04 // vmovss	%xmm0, 4(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x080e             // vmovss	8(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x080f             // vaddss	8(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x03488d4c                           // leaq	3(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x08 // vmovss	%xmm0, 8(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x0c0e             // vmovss	12(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x0c0f             // vaddss	12(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x04488d4c                           // leaq	4(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x0c // vmovss	%xmm0, 12(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x100e             // vmovss	16(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x100f             // vaddss	16(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x05488d4c                           // leaq	5(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x10 // vmovss	%xmm0, 16(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x140e             // vmovss	20(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x140f             // vaddss	20(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x06c08348                           // addq	$6, %rax
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x14 // vmovss	%xmm0, 20(%r8,%rcx)
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x180e             // vmovss	24(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x180f             // vaddss	24(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x18 // vmovss	%xmm0, 24(%r8,%rcx)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_5:
+	LONG $0x0410fac5; BYTE $0x86               // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x0458fac5; BYTE $0x87               // vaddss	(%rdi,%rax,4), %xmm0, %xmm0
+	LONG $0x01488d4c                           // leaq	1(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x8004             // vmovss	%xmm0, (%r8,%rax,4)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x040e             // vmovss	4(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x040f             // vaddss	4(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x02488d4c                           // leaq	2(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x04 // vmovss	%xmm0, 4(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x080f             // vmovss	8(%rdi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x080e             // vaddss	8(%rsi,%rcx), %xmm0, %xmm0
+	LONG $0x03488d4c                           // leaq	3(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x08 // vmovss	%xmm0, 8(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x0c0e             // vmovss	12(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x0c0f             // vaddss	12(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x04488d4c                           // leaq	4(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x0c // vmovss	%xmm0, 12(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x100e             // vmovss	16(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x100f             // vaddss	16(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x05488d4c                           // leaq	5(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x10 // vmovss	%xmm0, 16(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x140e             // vmovss	20(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x140f             // vaddss	20(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x06488d4c                           // leaq	6(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x14 // vmovss	%xmm0, 20(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x180e             // vmovss	24(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x180f             // vaddss	24(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x07488d4c                           // leaq	7(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x18 // vmovss	%xmm0, 24(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x1c0e             // vmovss	28(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x1c0f             // vaddss	28(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x08488d4c                           // leaq	8(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x1c // vmovss	%xmm0, 28(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x200e             // vmovss	32(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x200f             // vaddss	32(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x09488d4c                           // leaq	9(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x20 // vmovss	%xmm0, 32(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x240e             // vmovss	36(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x240f             // vaddss	36(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x0a488d4c                           // leaq	10(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x24 // vmovss	%xmm0, 36(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x280e             // vmovss	40(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x280f             // vaddss	40(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x0b488d4c                           // leaq	11(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x28 // vmovss	%xmm0, 40(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x2c0e             // vmovss	44(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x2c0f             // vaddss	44(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x0c488d4c                           // leaq	12(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x2c // vmovss	%xmm0, 44(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x300e             // vmovss	48(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x300f             // vaddss	48(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x0d488d4c                           // leaq	13(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x30 // vmovss	%xmm0, 48(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x340e             // vmovss	52(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x340f             // vaddss	52(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x0e488d4c                           // leaq	14(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x34 // vmovss	%xmm0, 52(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x380e             // vmovss	56(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x380f             // vaddss	56(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x0fc08348                           // addq	$15, %rax
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x38 // vmovss	%xmm0, 56(%r8,%rcx)
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_54
+	LONG $0x4410fac5; WORD $0x3c0e             // vmovss	60(%rsi,%rcx), %xmm0
+	LONG $0x4458fac5; WORD $0x3c0f             // vaddss	60(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x3c // vmovss	%xmm0, 60(%r8,%rcx)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	JMP  BB0_55
+
+BB0_54:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_55:
+	RET
+
+BB0_57:
+	RET
+
+BB0_31:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_6
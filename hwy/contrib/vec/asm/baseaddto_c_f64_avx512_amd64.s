@@ -0,0 +1,170 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/baseaddto_c_f64_avx512_amd64.c
+
+TEXT ·addto_c_f64_avx512(SB), $0-32
+	MOVQ dst+0(FP), DI
+	MOVQ a+8(FP), SI
+	MOVQ b+16(FP), DX
+	MOVQ plen_dst+24(FP), CX
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	WORD $0x8b48; BYTE $0x11     // movq	(%rcx), %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_45
+	WORD $0x8949; BYTE $0xf9     // movq	%rdi, %r9
+	LONG $0x07fa8348             // cmpq	$7, %rdx
+	JLE  BB0_11
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_4:
+	QUAD $0xffc64c1048fdf162 // vmovupd	-64(%rsi,%rax,8), %zmm1
+	QUAD $0xffc0445848f5d162 // vaddpd	-64(%r8,%rax,8), %zmm1, %zmm0
+	QUAD $0xffc1441148fdd162 // vmovupd	%zmm0, -64(%r9,%rax,8)
+	LONG $0x08c08348         // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JLE  BB0_4
+	LONG $0xf8428d48         // leaq	-8(%rdx), %rax
+	LONG $0x03e8c148         // shrq	$3, %rax
+	QUAD $0x00000008c5048d48 // leaq	8(,%rax,8), %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_31
+	WORD $0x8949; BYTE $0xd2                   // movq	%rdx, %r10
+	QUAD $0x00000000c50c8d48                   // leaq	0(,%rax,8), %rcx
+	WORD $0x2949; BYTE $0xc2                   // subq	%rax, %r10
+	WORD $0x8948; BYTE $0xe5                   // movq	%rsp, %rbp
+	WORD $0x8949; BYTE $0xc5                   // movq	%rax, %r13
+	LONG $0xff5a8d49                           // leaq	-1(%r10), %rbx
+	LONG $0x02fb8348                           // cmpq	$2, %rbx
+	JBE  BB0_5
+	QUAD $0x00000000c50c8d48                   // leaq	0(,%rax,8), %rcx
+	LONG $0x091c8d4d                           // leaq	(%r9,%rcx), %r11
+	LONG $0x08798d48                           // leaq	8(%rcx), %rdi
+	LONG $0x3e348d4c                           // leaq	(%rsi,%rdi), %r14
+	WORD $0x894d; BYTE $0xdc                   // movq	%r11, %r12
+	WORD $0x294d; BYTE $0xf4                   // subq	%r14, %r12
+	LONG $0x30fc8349                           // cmpq	$48, %r12
+	JBE  BB0_5
+	WORD $0x014c; BYTE $0xc7                   // addq	%r8, %rdi
+	WORD $0x894d; BYTE $0xdc                   // movq	%r11, %r12
+	WORD $0x2949; BYTE $0xfc                   // subq	%rdi, %r12
+	LONG $0x30fc8349                           // cmpq	$48, %r12
+	JBE  BB0_5
+	LONG $0x06fb8348                           // cmpq	$6, %rbx
+	JBE  BB0_12
+	LONG $0x48fdf162; WORD $0x1c10; BYTE $0x0e // vmovupd	(%rsi,%rcx), %zmm3
+	LONG $0x48e5d162; WORD $0x0458; BYTE $0x08 // vaddpd	(%r8,%rcx), %zmm3, %zmm0
+	WORD $0x894c; BYTE $0xd1                   // movq	%r10, %rcx
+	LONG $0xf8e18348                           // andq	$-8, %rcx
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x48fdd162; WORD $0x0311             // vmovupd	%zmm0, (%r11)
+	LONG $0x07c2f641                           // testb	$7, %r10b
+	JE   BB0_42
+	WORD $0x2949; BYTE $0xca                   // subq	%rcx, %r10
+	LONG $0xff7a8d49                           // leaq	-1(%r10), %rdi
+	LONG $0x02ff8348                           // cmpq	$2, %rdi
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x014c; BYTE $0xe9       // addq	%r13, %rcx
+	LONG $0x1410fdc5; BYTE $0xce   // vmovupd	(%rsi,%rcx,8), %ymm2
+	LONG $0x586dc1c4; WORD $0xc804 // vaddpd	(%r8,%rcx,8), %ymm2, %ymm0
+	LONG $0x117dc1c4; WORD $0xc904 // vmovupd	%ymm0, (%r9,%rcx,8)
+	WORD $0x894c; BYTE $0xd1       // movq	%r10, %rcx
+	LONG $0xfce18348               // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	LONG $0x03e28341               // andl	$3, %r10d
+	JE   BB0_42
+
+BB0_8:
+	LONG $0x0410fbc5; BYTE $0xc6               // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0x587bc1c4; WORD $0xc004             // vaddsd	(%r8,%rax,8), %xmm0, %xmm0
+	LONG $0x01788d48                           // leaq	1(%rax), %rdi
+	QUAD $0x00000000c50c8d48                   // leaq	0(,%rax,8), %rcx
+	LONG $0x117bc1c4; WORD $0xc104             // vmovsd	%xmm0, (%r9,%rax,8)
+	WORD $0x3948; BYTE $0xfa                   // cmpq	%rdi, %rdx
+	JLE  BB0_42
+	LONG $0x4410fbc5; WORD $0x080e             // vmovsd	8(%rsi,%rcx), %xmm0
+	LONG $0x587bc1c4; WORD $0x0844; BYTE $0x08 // vaddsd	8(%r8,%rcx), %xmm0, %xmm0
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0x117bc1c4; WORD $0x0944; BYTE $0x08 // vmovsd	%xmm0, 8(%r9,%rcx)
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_42
+	LONG $0x4410fbc5; WORD $0x100e             // vmovsd	16(%rsi,%rcx), %xmm0
+	LONG $0x587bc1c4; WORD $0x0844; BYTE $0x10 // vaddsd	16(%r8,%rcx), %xmm0, %xmm0
+	LONG $0x117bc1c4; WORD $0x0944; BYTE $0x10 // vmovsd	%xmm0, 16(%r9,%rcx)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_5:
+	LONG $0x0410fbc5; BYTE $0xc6               // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0x587bc1c4; WORD $0xc004             // vaddsd	(%r8,%rax,8), %xmm0, %xmm0
+	LONG $0x01788d48                           // leaq	1(%rax), %rdi
+	LONG $0x117bc1c4; WORD $0xc104             // vmovsd	%xmm0, (%r9,%rax,8)
+	WORD $0x3948; BYTE $0xfa                   // cmpq	%rdi, %rdx
+	JLE  BB0_42
+	LONG $0x4410fbc5; WORD $0x080e             // vmovsd	8(%rsi,%rcx), %xmm0
+	LONG $0x587bc1c4; WORD $0x0844; BYTE $0x08 // vaddsd	8(%r8,%rcx), %xmm0, %xmm0
+	LONG $0x02788d48                           // leaq	2(%rax), %rdi
+	LONG $0x117bc1c4; WORD $0x0944; BYTE $0x08 // vmovsd	%xmm0, 8(%r9,%rcx)
+	WORD $0x3948; BYTE $0xfa                   // cmpq	%rdi, %rdx
+	JLE  BB0_42
+	LONG $0x107bc1c4; WORD $0x0844; BYTE $0x10 // vmovsd	16(%r8,%rcx), %xmm0
+	LONG $0x4458fbc5; WORD $0x100e             // vaddsd	16(%rsi,%rcx), %xmm0, %xmm0
+	LONG $0x03788d48                           // leaq	3(%rax), %rdi
+	LONG $0x117bc1c4; WORD $0x0944; BYTE $0x10 // vmovsd	%xmm0, 16(%r9,%rcx)
+	WORD $0x3948; BYTE $0xfa                   // cmpq	%rdi, %rdx
+	JLE  BB0_42
+	LONG $0x4410fbc5; WORD $0x180e             // vmovsd	24(%rsi,%rcx), %xmm0
+	LONG $0x587bc1c4; WORD $0x0844; BYTE $0x18 // vaddsd	24(%r8,%rcx), %xmm0, %xmm0
+	LONG $0x04788d48                           // leaq	4(%rax), %rdi
+	LONG $0x117bc1c4; WORD $0x0944; BYTE $0x18 // vmovsd	%xmm0, 24(%r9,%rcx)
+	WORD $0x3948; BYTE $0xfa                   // cmpq	%rdi, %rdx
+	JLE  BB0_42
+	LONG $0x4410fbc5; WORD $0x200e             // vmovsd	32(%rsi,%rcx), %xmm0
+	LONG $0x587bc1c4; WORD $0x0844; BYTE $0x20 // vaddsd	32(%r8,%rcx), %xmm0, %xmm0
+	LONG $0x05788d48                           // leaq	5(%rax), %rdi
+	LONG $0x117bc1c4; WORD $0x0944; BYTE $0x20 // vmovsd	%xmm0, 32(%r9,%rcx)
+	WORD $0x3948; BYTE $0xfa                   // cmpq	%rdi, %rdx
+	JLE  BB0_42
+	LONG $0x4410fbc5; WORD $0x280e             // vmovsd	40(%rsi,%rcx), %xmm0
+	LONG $0x587bc1c4; WORD $0x0844; BYTE $0x28 // vaddsd	40(%r8,%rcx), %xmm0, %xmm0
+	LONG $0x06788d48                           // leaq	6(%rax), %rdi
+	LONG $0x117bc1c4; WORD $0x0944; BYTE $0x28 // vmovsd	%xmm0, 40(%r9,%rcx)
+	WORD $0x3948; BYTE $0xfa                   // cmpq	%rdi, %rdx
+	JLE  BB0_42
+	LONG $0x4410fbc5; WORD $0x300e             // vmovsd	48(%rsi,%rcx), %xmm0
+	LONG $0x587bc1c4; WORD $0x0844; BYTE $0x30 // vaddsd	48(%r8,%rcx), %xmm0, %xmm0
+	LONG $0x07c08348                           // addq	$7, %rax
+	LONG $0x117bc1c4; WORD $0x0944; BYTE $0x30 // vmovsd	%xmm0, 48(%r9,%rcx)
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_42
+	LONG $0x4410fbc5; WORD $0x380e             // vmovsd	56(%rsi,%rcx), %xmm0
+	LONG $0x587bc1c4; WORD $0x0844; BYTE $0x38 // vaddsd	56(%r8,%rcx), %xmm0, %xmm0
+	LONG $0x117bc1c4; WORD $0x0944; BYTE $0x38 // vmovsd	%xmm0, 56(%r9,%rcx)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_42:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_45:
+	RET
+
+BB0_31:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_6
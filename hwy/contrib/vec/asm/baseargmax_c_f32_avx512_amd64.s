@@ -0,0 +1,525 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/baseargmax_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x3f800000
+DATA CPI0_1<>+8(SB)/4, $0x40000000
+DATA CPI0_1<>+12(SB)/4, $0x40400000
+DATA CPI0_1<>+16(SB)/4, $0x40800000
+DATA CPI0_1<>+20(SB)/4, $0x40a00000
+DATA CPI0_1<>+24(SB)/4, $0x40c00000
+DATA CPI0_1<>+28(SB)/4, $0x40e00000
+DATA CPI0_1<>+32(SB)/4, $0x41000000
+DATA CPI0_1<>+36(SB)/4, $0x41100000
+DATA CPI0_1<>+40(SB)/4, $0x41200000
+DATA CPI0_1<>+44(SB)/4, $0x41300000
+DATA CPI0_1<>+48(SB)/4, $0x41400000
+DATA CPI0_1<>+52(SB)/4, $0x41500000
+DATA CPI0_1<>+56(SB)/4, $0x41600000
+DATA CPI0_1<>+60(SB)/4, $0x41700000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $64
+
+TEXT ·argmax_c_f32_avx512(SB), $0-24
+	MOVQ    v+0(FP), DI
+	MOVQ    plen_v+8(FP), SI
+	MOVQ    pout_result+16(FP), DX
+	WORD    $0x8b48; BYTE $0x36       // movq	(%rsi), %rsi
+	WORD    $0x8949; BYTE $0xd1       // movq	%rdx, %r9
+	LONG    $0x0ffe8348               // cmpq	$15, %rsi
+	JLE     BB0_157
+	LONG    $0x487cf162; WORD $0x0f10 // vmovups	(%rdi), %zmm1
+	LONG    $0x1ffe8348               // cmpq	$31, %rsi
+	JLE     BB0_31
+	LONG    $0xe04e8d48               // leaq	-32(%rsi), %rcx
+	LONG    $0xdb57e0c5               // vxorps	%xmm3, %xmm3, %xmm3
+	LONG    $0x000010b8; BYTE $0x00   // movl	$16, %eax
+	VMOVUPS CPI0_1<>(SB), Z2          // vmovaps	.LCPI0_1(%rip), %zmm2
+	WORD    $0x8948; BYTE $0xca       // movq	%rcx, %rdx
+	LONG    $0xf0e28348               // andq	$-16, %rdx
+	LONG    $0x487cf162; WORD $0xe228 // vmovaps	%zmm2, %zmm4
+	LONG    $0x20c28348               // addq	$32, %rdx
+
+BB0_8:
+	LONG $0x487cf162; WORD $0x3410; BYTE $0x87 // vmovups	(%rdi,%rax,4), %zmm6
+	LONG $0x2ae2e1c4; BYTE $0xc0               // vcvtsi2ssq	%rax, %xmm3, %xmm0
+	LONG $0x10c08348                           // addq	$16, %rax
+	LONG $0x484cf162; WORD $0xc9c2; BYTE $0x1e // vcmpps	$30, %zmm1, %zmm6, %k1
+	LONG $0x487df262; WORD $0xc018             // vbroadcastss	%xmm0, %zmm0
+	LONG $0x497cf162; WORD $0xe258             // vaddps	%zmm2, %zmm0, %zmm4{%k1}
+	LONG $0x497cf162; WORD $0xce28             // vmovaps	%zmm6, %zmm1{%k1}
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JNE  BB0_8
+	LONG $0xf0e18348                           // andq	$-16, %rcx
+	LONG $0x20418d48                           // leaq	32(%rcx), %rax
+
+BB0_7:
+	LONG $0xc92ef8c5             // vucomiss	%xmm1, %xmm1
+	LONG $0xd128fcc5             // vmovaps	%ymm1, %ymm2
+	LONG $0xc128f8c5             // vmovaps	%xmm1, %xmm0
+	JP   BB0_32
+	LONG $0x2cfa61c4; BYTE $0xc4 // vcvttss2siq	%xmm4, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_9:
+	LONG $0xdac6e8c5; BYTE $0x55 // vshufps	$85, %xmm2, %xmm2, %xmm3
+	LONG $0xdb2ef8c5             // vucomiss	%xmm3, %xmm3
+	JP   BB0_10
+	LONG $0xd82ff8c5             // vcomiss	%xmm0, %xmm3
+	LONG $0xecc6d8c5; BYTE $0x55 // vshufps	$85, %xmm4, %xmm4, %xmm5
+	LONG $0x2cfae1c4; BYTE $0xcd // vcvttss2siq	%xmm5, %rcx
+	JA   BB0_33
+	WORD $0x8941; BYTE $0xd3     // movl	%edx, %r11d
+	LONG $0x01f38041             // xorb	$1, %r11b
+	JNE  BB0_33
+	WORD $0x3949; BYTE $0xc8     // cmpq	%rcx, %r8
+	JLE  BB0_10
+	LONG $0xc32ef8c5             // vucomiss	%xmm3, %xmm0
+	LONG $0xc29b0f41             // setnp	%r10b
+	LONG $0xd3450f45             // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2     // testb	%r10b, %r10b
+	JE   BB0_10
+
+BB0_33:
+	LONG $0xc328f8c5             // vmovaps	%xmm3, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_10:
+	LONG $0xda15e8c5             // vunpckhps	%xmm2, %xmm2, %xmm3
+	LONG $0xdb2ef8c5             // vucomiss	%xmm3, %xmm3
+	JP   BB0_11
+	LONG $0xec15d8c5             // vunpckhps	%xmm4, %xmm4, %xmm5
+	LONG $0x2cfae1c4; BYTE $0xcd // vcvttss2siq	%xmm5, %rcx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_34
+	LONG $0xd82ff8c5             // vcomiss	%xmm0, %xmm3
+	LONG $0xc3970f41             // seta	%r11b
+	JA   BB0_34
+	LONG $0xc32ef8c5             // vucomiss	%xmm3, %xmm0
+	LONG $0xc29b0f41             // setnp	%r10b
+	LONG $0xd3450f45             // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2     // testb	%r10b, %r10b
+	JE   BB0_11
+	WORD $0x3949; BYTE $0xc8     // cmpq	%rcx, %r8
+	JLE  BB0_11
+
+BB0_34:
+	LONG $0xc328f8c5             // vmovaps	%xmm3, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_11:
+	LONG $0xdac6e8c5; BYTE $0xff // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xdb2ef8c5             // vucomiss	%xmm3, %xmm3
+	JP   BB0_12
+	LONG $0xecc6d8c5; BYTE $0xff // vshufps	$255, %xmm4, %xmm4, %xmm5
+	LONG $0x2cfae1c4; BYTE $0xcd // vcvttss2siq	%xmm5, %rcx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_35
+	LONG $0xd82ff8c5             // vcomiss	%xmm0, %xmm3
+	LONG $0xc3970f41             // seta	%r11b
+	JA   BB0_35
+	WORD $0x394c; BYTE $0xc1     // cmpq	%r8, %rcx
+	JGE  BB0_12
+	LONG $0xc32ef8c5             // vucomiss	%xmm3, %xmm0
+	LONG $0xc29b0f41             // setnp	%r10b
+	LONG $0xd3450f45             // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2     // testb	%r10b, %r10b
+	JE   BB0_12
+
+BB0_35:
+	LONG $0xc328f8c5             // vmovaps	%xmm3, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_12:
+	LONG $0x287df362; WORD $0xd319; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm3
+	LONG $0xdb2ef8c5                           // vucomiss	%xmm3, %xmm3
+	JP   BB0_13
+	LONG $0x287df362; WORD $0xe519; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm5
+	LONG $0xd82ff8c5                           // vcomiss	%xmm0, %xmm3
+	LONG $0x2cfae1c4; BYTE $0xcd               // vcvttss2siq	%xmm5, %rcx
+	JA   BB0_36
+	WORD $0x8941; BYTE $0xd3                   // movl	%edx, %r11d
+	LONG $0x01f38041                           // xorb	$1, %r11b
+	JNE  BB0_36
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_13
+	LONG $0xc32ef8c5                           // vucomiss	%xmm3, %xmm0
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_13
+
+BB0_36:
+	LONG $0xc328f8c5             // vmovaps	%xmm3, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_13:
+	LONG $0x286df362; WORD $0xda03; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm3
+	LONG $0xdb2ef8c5                           // vucomiss	%xmm3, %xmm3
+	JP   BB0_14
+	LONG $0x485df362; WORD $0xec03; BYTE $0x05 // valignd	$5, %zmm4, %zmm4, %zmm5
+	LONG $0xd82ff8c5                           // vcomiss	%xmm0, %xmm3
+	LONG $0x2cfae1c4; BYTE $0xcd               // vcvttss2siq	%xmm5, %rcx
+	JA   BB0_37
+	WORD $0x8941; BYTE $0xd3                   // movl	%edx, %r11d
+	LONG $0x01f38041                           // xorb	$1, %r11b
+	JNE  BB0_37
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JGE  BB0_14
+	LONG $0xc32ef8c5                           // vucomiss	%xmm3, %xmm0
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_14
+
+BB0_37:
+	LONG $0xc328f8c5             // vmovaps	%xmm3, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_14:
+	LONG $0x286df362; WORD $0xda03; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm3
+	LONG $0xdb2ef8c5                           // vucomiss	%xmm3, %xmm3
+	JP   BB0_15
+	LONG $0x485df362; WORD $0xec03; BYTE $0x06 // valignd	$6, %zmm4, %zmm4, %zmm5
+	LONG $0xd82ff8c5                           // vcomiss	%xmm0, %xmm3
+	LONG $0x2cfae1c4; BYTE $0xcd               // vcvttss2siq	%xmm5, %rcx
+	JA   BB0_38
+	WORD $0x8941; BYTE $0xd3                   // movl	%edx, %r11d
+	LONG $0x01f38041                           // xorb	$1, %r11b
+	JNE  BB0_38
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JGE  BB0_15
+	LONG $0xc32ef8c5                           // vucomiss	%xmm3, %xmm0
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_15
+
+BB0_38:
+	LONG $0xc328f8c5             // vmovaps	%xmm3, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_15:
+	LONG $0x286df362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm2
+	LONG $0xd22ef8c5                           // vucomiss	%xmm2, %xmm2
+	JP   BB0_16
+	LONG $0x485df362; WORD $0xdc03; BYTE $0x07 // valignd	$7, %zmm4, %zmm4, %zmm3
+	LONG $0xd02ff8c5                           // vcomiss	%xmm0, %xmm2
+	LONG $0x2cfae1c4; BYTE $0xcb               // vcvttss2siq	%xmm3, %rcx
+	JA   BB0_39
+	WORD $0x8941; BYTE $0xd3                   // movl	%edx, %r11d
+	LONG $0x01f38041                           // xorb	$1, %r11b
+	JNE  BB0_39
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JGE  BB0_16
+	LONG $0xc22ef8c5                           // vucomiss	%xmm2, %xmm0
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_16
+
+BB0_39:
+	LONG $0xc228f8c5             // vmovaps	%xmm2, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_16:
+	LONG $0x487df362; WORD $0xca1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm1, %ymm2
+	LONG $0x487df362; WORD $0xc919; BYTE $0x02 // vextractf32x4	$2, %zmm1, %xmm1
+	LONG $0xc92ef8c5                           // vucomiss	%xmm1, %xmm1
+	JP   BB0_17
+	LONG $0x487df362; WORD $0xe319; BYTE $0x02 // vextractf32x4	$2, %zmm4, %xmm3
+	LONG $0x2cfae1c4; BYTE $0xcb               // vcvttss2siq	%xmm3, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_40
+	LONG $0xc82ff8c5                           // vcomiss	%xmm0, %xmm1
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_40
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_17
+	LONG $0xc12ef8c5                           // vucomiss	%xmm1, %xmm0
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_17
+
+BB0_40:
+	LONG $0xc128f8c5             // vmovaps	%xmm1, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_17:
+	LONG $0xdac6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm3
+	LONG $0xdb2ef8c5                           // vucomiss	%xmm3, %xmm3
+	JP   BB0_18
+	LONG $0x485df362; WORD $0xcc03; BYTE $0x09 // valignd	$9, %zmm4, %zmm4, %zmm1
+	LONG $0x2cfae1c4; BYTE $0xc9               // vcvttss2siq	%xmm1, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_41
+	LONG $0xd82ff8c5                           // vcomiss	%xmm0, %xmm3
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_41
+	LONG $0xd82ef8c5                           // vucomiss	%xmm0, %xmm3
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_18
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_18
+
+BB0_41:
+	LONG $0xc328f8c5             // vmovaps	%xmm3, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_18:
+	LONG $0xda15e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm3
+	LONG $0xdb2ef8c5                           // vucomiss	%xmm3, %xmm3
+	JP   BB0_19
+	LONG $0x485df362; WORD $0xcc03; BYTE $0x0a // valignd	$10, %zmm4, %zmm4, %zmm1
+	LONG $0x2cfae1c4; BYTE $0xc9               // vcvttss2siq	%xmm1, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_42
+	LONG $0xd82ff8c5                           // vcomiss	%xmm0, %xmm3
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_42
+	LONG $0xd82ef8c5                           // vucomiss	%xmm0, %xmm3
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_19
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_19
+
+BB0_42:
+	LONG $0xc328f8c5             // vmovaps	%xmm3, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_19:
+	LONG $0xdac6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xdb2ef8c5                           // vucomiss	%xmm3, %xmm3
+	JP   BB0_20
+	LONG $0x485df362; WORD $0xcc03; BYTE $0x0b // valignd	$11, %zmm4, %zmm4, %zmm1
+	LONG $0x2cfae1c4; BYTE $0xc9               // vcvttss2siq	%xmm1, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_43
+	LONG $0xd82ff8c5                           // vcomiss	%xmm0, %xmm3
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_43
+	LONG $0xd82ef8c5                           // vucomiss	%xmm0, %xmm3
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_20
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_20
+
+BB0_43:
+	LONG $0xc328f8c5             // vmovaps	%xmm3, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_20:
+	LONG $0x287df362; WORD $0xd119; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm1
+	LONG $0xc92ef8c5                           // vucomiss	%xmm1, %xmm1
+	JP   BB0_21
+	LONG $0x487df362; WORD $0xe319; BYTE $0x03 // vextractf32x4	$3, %zmm4, %xmm3
+	LONG $0x2cfae1c4; BYTE $0xcb               // vcvttss2siq	%xmm3, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_44
+	LONG $0xc82ff8c5                           // vcomiss	%xmm0, %xmm1
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_44
+	LONG $0xc82ef8c5                           // vucomiss	%xmm0, %xmm1
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_21
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_21
+
+BB0_44:
+	LONG $0xc128f8c5             // vmovaps	%xmm1, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_21:
+	LONG $0x286df362; WORD $0xca03; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm1
+	LONG $0xc92ef8c5                           // vucomiss	%xmm1, %xmm1
+	JP   BB0_22
+	LONG $0x485df362; WORD $0xdc03; BYTE $0x0d // valignd	$13, %zmm4, %zmm4, %zmm3
+	LONG $0x2cfae1c4; BYTE $0xcb               // vcvttss2siq	%xmm3, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_45
+	LONG $0xc82ff8c5                           // vcomiss	%xmm0, %xmm1
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_45
+	LONG $0xc82ef8c5                           // vucomiss	%xmm0, %xmm1
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_22
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_22
+
+BB0_45:
+	LONG $0xc128f8c5             // vmovaps	%xmm1, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_22:
+	LONG $0x286df362; WORD $0xca03; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm1
+	LONG $0xc92ef8c5                           // vucomiss	%xmm1, %xmm1
+	JP   BB0_23
+	LONG $0x485df362; WORD $0xdc03; BYTE $0x0e // valignd	$14, %zmm4, %zmm4, %zmm3
+	LONG $0x2cfae1c4; BYTE $0xcb               // vcvttss2siq	%xmm3, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_46
+	LONG $0xc82ff8c5                           // vcomiss	%xmm0, %xmm1
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_46
+	LONG $0xc82ef8c5                           // vucomiss	%xmm0, %xmm1
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_23
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_23
+
+BB0_46:
+	LONG $0xc128f8c5             // vmovaps	%xmm1, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_23:
+	LONG $0x286df362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm2
+	LONG $0xd22ef8c5                           // vucomiss	%xmm2, %xmm2
+	JP   BB0_24
+	LONG $0x485df362; WORD $0xe403; BYTE $0x0f // valignd	$15, %zmm4, %zmm4, %zmm4
+	LONG $0x2cfae1c4; BYTE $0xcc               // vcvttss2siq	%xmm4, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_47
+	LONG $0xd02ff8c5                           // vcomiss	%xmm0, %xmm2
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_47
+	LONG $0xd02ef8c5                           // vucomiss	%xmm0, %xmm2
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_24
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JGE  BB0_24
+
+BB0_47:
+	LONG $0xc228f8c5             // vmovaps	%xmm2, %xmm0
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_24:
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JG   BB0_27
+	JMP  BB0_155
+
+BB0_48:
+	LONG $0xc128f8c5             // vmovaps	%xmm1, %xmm0
+	WORD $0x8949; BYTE $0xc0     // movq	%rax, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_26:
+	LONG $0x01c08348         // addq	$1, %rax
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JE   BB0_155
+
+BB0_27:
+	LONG $0x0c10fac5; BYTE $0x87 // vmovss	(%rdi,%rax,4), %xmm1
+	LONG $0xc92ef8c5             // vucomiss	%xmm1, %xmm1
+	JP   BB0_26
+	LONG $0xc82ff8c5             // vcomiss	%xmm0, %xmm1
+	JA   BB0_48
+	WORD $0xf280; BYTE $0x01     // xorb	$1, %dl
+	JNE  BB0_48
+	WORD $0x394c; BYTE $0xc0     // cmpq	%r8, %rax
+	JGE  BB0_49
+	LONG $0xc12ef8c5             // vucomiss	%xmm1, %xmm0
+	WORD $0x9b0f; BYTE $0xc1     // setnp	%cl
+	WORD $0x450f; BYTE $0xca     // cmovne	%edx, %ecx
+	WORD $0xc984                 // testb	%cl, %cl
+	JNE  BB0_48
+
+BB0_49:
+	LONG $0x01c08348             // addq	$1, %rax
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+	WORD $0x3948; BYTE $0xc6     // cmpq	%rax, %rsi
+	JNE  BB0_27
+
+BB0_155:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_6:
+	WORD $0x894d; BYTE $0x01 // movq	%r8, (%r9)
+	RET
+
+BB0_32:
+	WORD $0xd231             // xorl	%edx, %edx
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_9
+
+BB0_157:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	WORD $0x8548; BYTE $0xf6 // testq	%rsi, %rsi
+	JLE  BB0_6
+	LONG $0xc957f0c5         // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0xd231             // xorl	%edx, %edx
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_5
+
+BB0_29:
+	LONG $0xc828f8c5             // vmovaps	%xmm0, %xmm1
+	WORD $0x8949; BYTE $0xc0     // movq	%rax, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_4:
+	LONG $0x01c08348         // addq	$1, %rax
+	WORD $0x3948; BYTE $0xf0 // cmpq	%rsi, %rax
+	JE   BB0_6
+
+BB0_5:
+	LONG $0x0410fac5; BYTE $0x87 // vmovss	(%rdi,%rax,4), %xmm0
+	LONG $0xc02ef8c5             // vucomiss	%xmm0, %xmm0
+	JP   BB0_4
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_29
+	LONG $0xc12ff8c5             // vcomiss	%xmm1, %xmm0
+	WORD $0x970f; BYTE $0xc1     // seta	%cl
+	JA   BB0_29
+	LONG $0xc12ef8c5             // vucomiss	%xmm1, %xmm0
+	WORD $0x9b0f; BYTE $0xc2     // setnp	%dl
+	WORD $0x450f; BYTE $0xd1     // cmovne	%ecx, %edx
+	WORD $0xd284                 // testb	%dl, %dl
+	JE   BB0_30
+	WORD $0x3949; BYTE $0xc0     // cmpq	%rax, %r8
+	JG   BB0_29
+
+BB0_30:
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+	JMP  BB0_4
+
+BB0_31:
+	VMOVUPS CPI0_1<>(SB), Z4        // vmovaps	.LCPI0_1(%rip), %zmm4
+	LONG    $0x000010b8; BYTE $0x00 // movl	$16, %eax
+	JMP     BB0_7
@@ -0,0 +1,445 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/baseargmin_c_f32_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x3f800000
+DATA CPI0_1<>+8(SB)/4, $0x40000000
+DATA CPI0_1<>+12(SB)/4, $0x40400000
+DATA CPI0_1<>+16(SB)/4, $0x40800000
+DATA CPI0_1<>+20(SB)/4, $0x40a00000
+DATA CPI0_1<>+24(SB)/4, $0x40c00000
+DATA CPI0_1<>+28(SB)/4, $0x40e00000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $32
+
+TEXT ·argmin_c_f32_avx2(SB), $0-24
+	MOVQ    v+0(FP), DI
+	MOVQ    plen_v+8(FP), SI
+	MOVQ    pout_result+16(FP), DX
+	WORD    $0x8b48; BYTE $0x36     // movq	(%rsi), %rsi
+	WORD    $0x8949; BYTE $0xd1     // movq	%rdx, %r9
+	LONG    $0x07fe8348             // cmpq	$7, %rsi
+	JLE     BB0_119
+	LONG    $0x1710fcc5             // vmovups	(%rdi), %ymm2
+	LONG    $0x0ffe8348             // cmpq	$15, %rsi
+	JLE     BB0_40
+	LONG    $0xf04e8d48             // leaq	-16(%rsi), %rcx
+	LONG    $0xed57d0c5             // vxorps	%xmm5, %xmm5, %xmm5
+	LONG    $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	VMOVAPS CPI0_1<>(SB), Y3        // vmovaps	.LCPI0_1(%rip), %ymm3
+	WORD    $0x8948; BYTE $0xca     // movq	%rcx, %rdx
+	LONG    $0xe4efd9c5             // vpxor	%xmm4, %xmm4, %xmm4
+	LONG    $0xf8e28348             // andq	$-8, %rdx
+	LONG    $0xf328fcc5             // vmovaps	%ymm3, %ymm6
+	LONG    $0x10c28348             // addq	$16, %rdx
+
+BB0_15:
+	LONG $0x3c10fcc5; BYTE $0x87   // vmovups	(%rdi,%rax,4), %ymm7
+	LONG $0x2ad2e1c4; BYTE $0xc0   // vcvtsi2ssq	%rax, %xmm5, %xmm0
+	LONG $0x08c08348               // addq	$8, %rax
+	LONG $0xcac2c4c5; BYTE $0x11   // vcmpps	$17, %ymm2, %ymm7, %ymm1
+	LONG $0x187de2c4; BYTE $0xc0   // vbroadcastss	%xmm0, %ymm0
+	LONG $0xc966ddc5               // vpcmpgtd	%ymm1, %ymm4, %ymm1
+	LONG $0xc358fcc5               // vaddps	%ymm3, %ymm0, %ymm0
+	LONG $0x4a6de3c4; WORD $0x10d7 // vblendvps	%ymm1, %ymm7, %ymm2, %ymm2
+	LONG $0x4a4de3c4; WORD $0x10f0 // vblendvps	%ymm1, %ymm0, %ymm6, %ymm6
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JNE  BB0_15
+	LONG $0x03e9c148               // shrq	$3, %rcx
+	QUAD $0x00000010cd048d48       // leaq	16(,%rcx,8), %rax
+
+BB0_14:
+	LONG $0xd22ef8c5             // vucomiss	%xmm2, %xmm2
+	LONG $0xca28f8c5             // vmovaps	%xmm2, %xmm1
+	LONG $0xda28f8c5             // vmovaps	%xmm2, %xmm3
+	JP   BB0_41
+	LONG $0x2cfa61c4; BYTE $0xc6 // vcvttss2siq	%xmm6, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_16:
+	LONG $0xc1c6f0c5; BYTE $0x55 // vshufps	$85, %xmm1, %xmm1, %xmm0
+	LONG $0xc02ef8c5             // vucomiss	%xmm0, %xmm0
+	JP   BB0_17
+	LONG $0xe6c6c8c5; BYTE $0x55 // vshufps	$85, %xmm6, %xmm6, %xmm4
+	LONG $0x2cfae1c4; BYTE $0xcc // vcvttss2siq	%xmm4, %rcx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_42
+	LONG $0xd82ff8c5             // vcomiss	%xmm0, %xmm3
+	LONG $0xc3970f41             // seta	%r11b
+	JA   BB0_42
+	WORD $0x394c; BYTE $0xc1     // cmpq	%r8, %rcx
+	JGE  BB0_17
+	LONG $0xd82ef8c5             // vucomiss	%xmm0, %xmm3
+	LONG $0xc29b0f41             // setnp	%r10b
+	LONG $0xd3450f45             // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2     // testb	%r10b, %r10b
+	JE   BB0_17
+
+BB0_42:
+	LONG $0xd828f8c5             // vmovaps	%xmm0, %xmm3
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_17:
+	LONG $0xc115f0c5             // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc02ef8c5             // vucomiss	%xmm0, %xmm0
+	JP   BB0_18
+	LONG $0xd82ff8c5             // vcomiss	%xmm0, %xmm3
+	LONG $0xe615c8c5             // vunpckhps	%xmm6, %xmm6, %xmm4
+	LONG $0x2cfae1c4; BYTE $0xcc // vcvttss2siq	%xmm4, %rcx
+	JA   BB0_43
+	WORD $0x8941; BYTE $0xd3     // movl	%edx, %r11d
+	LONG $0x01f38041             // xorb	$1, %r11b
+	JNE  BB0_43
+	LONG $0xd82ef8c5             // vucomiss	%xmm0, %xmm3
+	LONG $0xc29b0f41             // setnp	%r10b
+	LONG $0xd3450f45             // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2     // testb	%r10b, %r10b
+	JE   BB0_18
+	WORD $0x3949; BYTE $0xc8     // cmpq	%rcx, %r8
+	JLE  BB0_18
+
+BB0_43:
+	LONG $0xd828f8c5             // vmovaps	%xmm0, %xmm3
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_18:
+	LONG $0xc9c6f0c5; BYTE $0xff // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc92ef8c5             // vucomiss	%xmm1, %xmm1
+	JP   BB0_19
+	LONG $0xc6c6c8c5; BYTE $0xff // vshufps	$255, %xmm6, %xmm6, %xmm0
+	LONG $0x2cfae1c4; BYTE $0xc8 // vcvttss2siq	%xmm0, %rcx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_44
+	LONG $0xd92ff8c5             // vcomiss	%xmm1, %xmm3
+	LONG $0xc3970f41             // seta	%r11b
+	JA   BB0_44
+	LONG $0xd92ef8c5             // vucomiss	%xmm1, %xmm3
+	LONG $0xc29b0f41             // setnp	%r10b
+	LONG $0xd3450f45             // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2     // testb	%r10b, %r10b
+	JE   BB0_19
+	WORD $0x3949; BYTE $0xc8     // cmpq	%rcx, %r8
+	JLE  BB0_19
+
+BB0_44:
+	LONG $0xd928f8c5             // vmovaps	%xmm1, %xmm3
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_19:
+	LONG $0x197de3c4; WORD $0x01d2 // vextractf128	$0x1, %ymm2, %xmm2
+	LONG $0xd22ef8c5               // vucomiss	%xmm2, %xmm2
+	LONG $0xc228f8c5               // vmovaps	%xmm2, %xmm0
+	JP   BB0_20
+	LONG $0x197de3c4; WORD $0x01f1 // vextractf128	$0x1, %ymm6, %xmm1
+	LONG $0x2cfae1c4; BYTE $0xc9   // vcvttss2siq	%xmm1, %rcx
+	WORD $0x8548; BYTE $0xd2       // testq	%rdx, %rdx
+	JE   BB0_45
+	LONG $0xda2ff8c5               // vcomiss	%xmm2, %xmm3
+	LONG $0xc3970f41               // seta	%r11b
+	JA   BB0_45
+	LONG $0xda2ef8c5               // vucomiss	%xmm2, %xmm3
+	LONG $0xc29b0f41               // setnp	%r10b
+	LONG $0xd3450f45               // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2       // testb	%r10b, %r10b
+	JE   BB0_20
+	WORD $0x3949; BYTE $0xc8       // cmpq	%rcx, %r8
+	JLE  BB0_20
+
+BB0_45:
+	LONG $0xd828f8c5             // vmovaps	%xmm0, %xmm3
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_20:
+	LONG $0xc2c6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm0
+	LONG $0xc02ef8c5               // vucomiss	%xmm0, %xmm0
+	JP   BB0_21
+	LONG $0x197de3c4; WORD $0x01f1 // vextractf128	$0x1, %ymm6, %xmm1
+	LONG $0xc9c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0x2cfae1c4; BYTE $0xc9   // vcvttss2siq	%xmm1, %rcx
+	WORD $0x8548; BYTE $0xd2       // testq	%rdx, %rdx
+	JE   BB0_46
+	LONG $0xd82ff8c5               // vcomiss	%xmm0, %xmm3
+	LONG $0xc3970f41               // seta	%r11b
+	JA   BB0_46
+	LONG $0xc32ef8c5               // vucomiss	%xmm3, %xmm0
+	LONG $0xc29b0f41               // setnp	%r10b
+	LONG $0xd3450f45               // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2       // testb	%r10b, %r10b
+	JE   BB0_21
+	WORD $0x3949; BYTE $0xc8       // cmpq	%rcx, %r8
+	JLE  BB0_21
+
+BB0_46:
+	LONG $0xd828f8c5             // vmovaps	%xmm0, %xmm3
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_21:
+	LONG $0xc215e8c5               // vunpckhps	%xmm2, %xmm2, %xmm0
+	LONG $0xc02ef8c5               // vucomiss	%xmm0, %xmm0
+	JP   BB0_22
+	LONG $0x197de3c4; WORD $0x01f1 // vextractf128	$0x1, %ymm6, %xmm1
+	LONG $0xc915f0c5               // vunpckhps	%xmm1, %xmm1, %xmm1
+	LONG $0x2cfae1c4; BYTE $0xc9   // vcvttss2siq	%xmm1, %rcx
+	WORD $0x8548; BYTE $0xd2       // testq	%rdx, %rdx
+	JE   BB0_47
+	LONG $0xd82ff8c5               // vcomiss	%xmm0, %xmm3
+	LONG $0xc3970f41               // seta	%r11b
+	JA   BB0_47
+	LONG $0xc32ef8c5               // vucomiss	%xmm3, %xmm0
+	LONG $0xc29b0f41               // setnp	%r10b
+	LONG $0xd3450f45               // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2       // testb	%r10b, %r10b
+	JE   BB0_22
+	WORD $0x3949; BYTE $0xc8       // cmpq	%rcx, %r8
+	JLE  BB0_22
+
+BB0_47:
+	LONG $0xd828f8c5             // vmovaps	%xmm0, %xmm3
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_22:
+	LONG $0xd2c6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm2
+	LONG $0xd22ef8c5               // vucomiss	%xmm2, %xmm2
+	JP   BB0_23
+	LONG $0x197de3c4; WORD $0x01f0 // vextractf128	$0x1, %ymm6, %xmm0
+	LONG $0xc0c6f8c5; BYTE $0xff   // vshufps	$255, %xmm0, %xmm0, %xmm0
+	LONG $0x2cfae1c4; BYTE $0xc8   // vcvttss2siq	%xmm0, %rcx
+	WORD $0x8548; BYTE $0xd2       // testq	%rdx, %rdx
+	JE   BB0_48
+	LONG $0xda2ff8c5               // vcomiss	%xmm2, %xmm3
+	LONG $0xc3970f41               // seta	%r11b
+	JA   BB0_48
+	LONG $0xd32ef8c5               // vucomiss	%xmm3, %xmm2
+	LONG $0xc29b0f41               // setnp	%r10b
+	LONG $0xd3450f45               // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2       // testb	%r10b, %r10b
+	JE   BB0_23
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JGE  BB0_23
+
+BB0_48:
+	LONG $0xda28f8c5             // vmovaps	%xmm2, %xmm3
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_23:
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JG   BB0_26
+	JMP  BB0_117
+
+BB0_49:
+	LONG $0xd828f8c5             // vmovaps	%xmm0, %xmm3
+	WORD $0x8949; BYTE $0xc0     // movq	%rax, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_25:
+	LONG $0x01c08348         // addq	$1, %rax
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JE   BB0_117
+
+BB0_26:
+	LONG $0x0410fac5; BYTE $0x87 // vmovss	(%rdi,%rax,4), %xmm0
+	LONG $0xc02ef8c5             // vucomiss	%xmm0, %xmm0
+	JP   BB0_25
+	LONG $0xd82ff8c5             // vcomiss	%xmm0, %xmm3
+	JA   BB0_49
+	WORD $0xf280; BYTE $0x01     // xorb	$1, %dl
+	JNE  BB0_49
+	WORD $0x394c; BYTE $0xc0     // cmpq	%r8, %rax
+	JGE  BB0_50
+	LONG $0xd82ef8c5             // vucomiss	%xmm0, %xmm3
+	WORD $0x9b0f; BYTE $0xc1     // setnp	%cl
+	WORD $0x440f; BYTE $0xd1     // cmove	%ecx, %edx
+	WORD $0xd284                 // testb	%dl, %dl
+	JNE  BB0_49
+
+BB0_50:
+	LONG $0x01c08348             // addq	$1, %rax
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+	WORD $0x3948; BYTE $0xc6     // cmpq	%rax, %rsi
+	JNE  BB0_26
+
+BB0_117:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_13:
+	WORD $0x894d; BYTE $0x01 // movq	%r8, (%r9)
+	RET
+
+BB0_41:
+	WORD $0xd231             // xorl	%edx, %edx
+	LONG $0xdb57e0c5         // vxorps	%xmm3, %xmm3, %xmm3
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_16
+
+BB0_119:
+	WORD $0x8548; BYTE $0xf6     // testq	%rsi, %rsi
+	JLE  BB0_27
+	LONG $0x0f10fac5             // vmovss	(%rdi), %xmm1
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	LONG $0xc92ef8c5             // vucomiss	%xmm1, %xmm1
+	JP   BB0_120
+
+BB0_4:
+	LONG $0x01fe8348             // cmpq	$1, %rsi
+	JE   BB0_27
+	LONG $0x4710fac5; BYTE $0x04 // vmovss	4(%rdi), %xmm0
+	LONG $0xc02ef8c5             // vucomiss	%xmm0, %xmm0
+	JP   BB0_30
+	LONG $0xc82ff8c5             // vcomiss	%xmm0, %xmm1
+	JA   BB0_31
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JNE  BB0_121
+
+BB0_31:
+	LONG $0x000001b8; BYTE $0x00   // movl	$1, %eax
+	LONG $0x0001b841; WORD $0x0000 // movl	$1, %r8d
+
+BB0_6:
+	LONG $0x02fe8348             // cmpq	$2, %rsi
+	JE   BB0_13
+	LONG $0x4f10fac5; BYTE $0x08 // vmovss	8(%rdi), %xmm1
+	LONG $0xc92ef8c5             // vucomiss	%xmm1, %xmm1
+	JP   BB0_32
+	LONG $0xc12ff8c5             // vcomiss	%xmm1, %xmm0
+	JA   BB0_33
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JNE  BB0_122
+
+BB0_33:
+	LONG $0x000001b8; BYTE $0x00   // movl	$1, %eax
+	LONG $0x0002b841; WORD $0x0000 // movl	$2, %r8d
+
+BB0_7:
+	LONG $0x03fe8348             // cmpq	$3, %rsi
+	JE   BB0_13
+	LONG $0x4710fac5; BYTE $0x0c // vmovss	12(%rdi), %xmm0
+	LONG $0xc02ef8c5             // vucomiss	%xmm0, %xmm0
+	JP   BB0_34
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_35
+	LONG $0xc82ff8c5             // vcomiss	%xmm0, %xmm1
+	JBE  BB0_123
+
+BB0_35:
+	LONG $0x000001b8; BYTE $0x00   // movl	$1, %eax
+	LONG $0x0003b841; WORD $0x0000 // movl	$3, %r8d
+
+BB0_8:
+	LONG $0x04fe8348             // cmpq	$4, %rsi
+	JE   BB0_13
+	LONG $0x4f10fac5; BYTE $0x10 // vmovss	16(%rdi), %xmm1
+	LONG $0xc92ef8c5             // vucomiss	%xmm1, %xmm1
+	JP   BB0_36
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_37
+	LONG $0xc12ff8c5             // vcomiss	%xmm1, %xmm0
+	JBE  BB0_124
+
+BB0_37:
+	LONG $0x000001b8; BYTE $0x00   // movl	$1, %eax
+	LONG $0x0004b841; WORD $0x0000 // movl	$4, %r8d
+
+BB0_9:
+	LONG $0x05fe8348             // cmpq	$5, %rsi
+	JE   BB0_13
+	LONG $0x4710fac5; BYTE $0x14 // vmovss	20(%rdi), %xmm0
+	LONG $0xc02ef8c5             // vucomiss	%xmm0, %xmm0
+	JP   BB0_38
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_39
+	LONG $0xc82ff8c5             // vcomiss	%xmm0, %xmm1
+	JBE  BB0_125
+
+BB0_39:
+	LONG $0x000001b8; BYTE $0x00   // movl	$1, %eax
+	LONG $0x0005b841; WORD $0x0000 // movl	$5, %r8d
+
+BB0_10:
+	LONG $0x07fe8348             // cmpq	$7, %rsi
+	JNE  BB0_13
+	LONG $0x4f10fac5; BYTE $0x18 // vmovss	24(%rdi), %xmm1
+	LONG $0xc92ef8c5             // vucomiss	%xmm1, %xmm1
+	JP   BB0_13
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_51
+	LONG $0xc12ff8c5             // vcomiss	%xmm1, %xmm0
+	JBE  BB0_13
+
+BB0_51:
+	LONG $0x0006b841; WORD $0x0000 // movl	$6, %r8d
+	JMP  BB0_13
+
+BB0_30:
+	LONG $0xc128f8c5         // vmovaps	%xmm1, %xmm0
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_6
+
+BB0_120:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	JMP  BB0_4
+
+BB0_32:
+	LONG $0xc828f8c5 // vmovaps	%xmm0, %xmm1
+	JMP  BB0_7
+
+BB0_40:
+	VMOVAPS CPI0_1<>(SB), Y6        // vmovaps	.LCPI0_1(%rip), %ymm6
+	LONG    $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	JMP     BB0_14
+
+BB0_27:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_13
+
+BB0_34:
+	LONG $0xc128f8c5 // vmovaps	%xmm1, %xmm0
+	JMP  BB0_8
+
+BB0_36:
+	LONG $0xc828f8c5 // vmovaps	%xmm0, %xmm1
+	JMP  BB0_9
+
+BB0_38:
+	LONG $0xc128f8c5 // vmovaps	%xmm1, %xmm0
+	JMP  BB0_10
+
+BB0_124:
+	LONG $0xc828f8c5             // vmovaps	%xmm0, %xmm1
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	JMP  BB0_9
+
+BB0_125:
+	LONG $0xc128f8c5             // vmovaps	%xmm1, %xmm0
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	JMP  BB0_10
+
+BB0_121:
+	LONG $0xc128f8c5             // vmovaps	%xmm1, %xmm0
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	WORD $0x3145; BYTE $0xc0     // xorl	%r8d, %r8d
+	JMP  BB0_6
+
+BB0_122:
+	LONG $0xc828f8c5             // vmovaps	%xmm0, %xmm1
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	JMP  BB0_7
+
+BB0_123:
+	LONG $0xc128f8c5             // vmovaps	%xmm1, %xmm0
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	JMP  BB0_8
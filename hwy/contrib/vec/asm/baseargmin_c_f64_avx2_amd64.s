@@ -0,0 +1,253 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/baseargmin_c_f64_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x00000000
+DATA CPI0_1<>+8(SB)/4, $0x00000000
+DATA CPI0_1<>+12(SB)/4, $0x3ff00000
+DATA CPI0_1<>+16(SB)/4, $0x00000000
+DATA CPI0_1<>+20(SB)/4, $0x40000000
+DATA CPI0_1<>+24(SB)/4, $0x00000000
+DATA CPI0_1<>+28(SB)/4, $0x40080000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $32
+
+TEXT ·argmin_c_f64_avx2(SB), $0-24
+	MOVQ    v+0(FP), DI
+	MOVQ    plen_v+8(FP), SI
+	MOVQ    pout_result+16(FP), DX
+	WORD    $0x8948; BYTE $0xf9     // movq	%rdi, %rcx
+	WORD    $0x8b48; BYTE $0x3e     // movq	(%rsi), %rdi
+	WORD    $0x8949; BYTE $0xd1     // movq	%rdx, %r9
+	LONG    $0x03ff8348             // cmpq	$3, %rdi
+	JLE     BB0_63
+	LONG    $0x1110fdc5             // vmovupd	(%rcx), %ymm2
+	LONG    $0x07ff8348             // cmpq	$7, %rdi
+	JLE     BB0_24
+	LONG    $0xf8778d48             // leaq	-8(%rdi), %rsi
+	LONG    $0xf657c8c5             // vxorps	%xmm6, %xmm6, %xmm6
+	LONG    $0x000004b8; BYTE $0x00 // movl	$4, %eax
+	VMOVAPD CPI0_1<>(SB), Y4        // vmovapd	.LCPI0_1(%rip), %ymm4
+	WORD    $0x8948; BYTE $0xf2     // movq	%rsi, %rdx
+	LONG    $0xedefd1c5             // vpxor	%xmm5, %xmm5, %xmm5
+	LONG    $0xfce28348             // andq	$-4, %rdx
+	LONG    $0xdc28fdc5             // vmovapd	%ymm4, %ymm3
+	LONG    $0x08c28348             // addq	$8, %rdx
+
+BB0_11:
+	LONG $0x3c10fdc5; BYTE $0xc1   // vmovupd	(%rcx,%rax,8), %ymm7
+	LONG $0x2acbe1c4; BYTE $0xc0   // vcvtsi2sdq	%rax, %xmm6, %xmm0
+	LONG $0x04c08348               // addq	$4, %rax
+	LONG $0xcac2c5c5; BYTE $0x11   // vcmppd	$17, %ymm2, %ymm7, %ymm1
+	LONG $0x197de2c4; BYTE $0xc0   // vbroadcastsd	%xmm0, %ymm0
+	LONG $0x3755e2c4; BYTE $0xc9   // vpcmpgtq	%ymm1, %ymm5, %ymm1
+	LONG $0xc458fdc5               // vaddpd	%ymm4, %ymm0, %ymm0
+	LONG $0x4b6de3c4; WORD $0x10d7 // vblendvpd	%ymm1, %ymm7, %ymm2, %ymm2
+	LONG $0x4b65e3c4; WORD $0x10d8 // vblendvpd	%ymm1, %ymm0, %ymm3, %ymm3
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JNE  BB0_11
+	LONG $0x02eec148               // shrq	$2, %rsi
+	QUAD $0x00000008b5048d48       // leaq	8(,%rsi,4), %rax
+
+BB0_10:
+	LONG $0xd22ef9c5             // vucomisd	%xmm2, %xmm2
+	LONG $0xc228f9c5             // vmovapd	%xmm2, %xmm0
+	LONG $0xca10ebc5             // vmovsd	%xmm2, %xmm2, %xmm1
+	JP   BB0_25
+	LONG $0x2cfb61c4; BYTE $0xc3 // vcvttsd2siq	%xmm3, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_12:
+	LONG $0xc015f9c5             // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xc02ef9c5             // vucomisd	%xmm0, %xmm0
+	JP   BB0_13
+	LONG $0xc82ff9c5             // vcomisd	%xmm0, %xmm1
+	LONG $0xe315e1c5             // vunpckhpd	%xmm3, %xmm3, %xmm4
+	LONG $0x2cfbe1c4; BYTE $0xf4 // vcvttsd2siq	%xmm4, %rsi
+	JA   BB0_26
+	WORD $0x8941; BYTE $0xd3     // movl	%edx, %r11d
+	LONG $0x01f38041             // xorb	$1, %r11b
+	JNE  BB0_26
+	LONG $0xc82ef9c5             // vucomisd	%xmm0, %xmm1
+	LONG $0xc29b0f41             // setnp	%r10b
+	LONG $0xd3450f45             // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2     // testb	%r10b, %r10b
+	JE   BB0_13
+	WORD $0x394c; BYTE $0xc6     // cmpq	%r8, %rsi
+	JGE  BB0_13
+
+BB0_26:
+	LONG $0xc810fbc5             // vmovsd	%xmm0, %xmm0, %xmm1
+	WORD $0x8949; BYTE $0xf0     // movq	%rsi, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_13:
+	LONG $0x197de3c4; WORD $0x01d2 // vextractf128	$0x1, %ymm2, %xmm2
+	LONG $0xd22ef9c5               // vucomisd	%xmm2, %xmm2
+	LONG $0xc210ebc5               // vmovsd	%xmm2, %xmm2, %xmm0
+	JP   BB0_14
+	LONG $0x197de3c4; WORD $0x01dc // vextractf128	$0x1, %ymm3, %xmm4
+	LONG $0x2cfbe1c4; BYTE $0xf4   // vcvttsd2siq	%xmm4, %rsi
+	WORD $0x8548; BYTE $0xd2       // testq	%rdx, %rdx
+	JE   BB0_27
+	LONG $0xca2ff9c5               // vcomisd	%xmm2, %xmm1
+	LONG $0xc3970f41               // seta	%r11b
+	JA   BB0_27
+	WORD $0x3949; BYTE $0xf0       // cmpq	%rsi, %r8
+	JLE  BB0_14
+	LONG $0xd12ef9c5               // vucomisd	%xmm1, %xmm2
+	LONG $0xc29b0f41               // setnp	%r10b
+	LONG $0xd3450f45               // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2       // testb	%r10b, %r10b
+	JE   BB0_14
+
+BB0_27:
+	LONG $0xc810fbc5             // vmovsd	%xmm0, %xmm0, %xmm1
+	WORD $0x8949; BYTE $0xf0     // movq	%rsi, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_14:
+	LONG $0xd215e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xd22ef9c5               // vucomisd	%xmm2, %xmm2
+	JP   BB0_15
+	LONG $0x197de3c4; WORD $0x01db // vextractf128	$0x1, %ymm3, %xmm3
+	LONG $0xdb15e1c5               // vunpckhpd	%xmm3, %xmm3, %xmm3
+	LONG $0x2cfbe1c4; BYTE $0xf3   // vcvttsd2siq	%xmm3, %rsi
+	WORD $0x8548; BYTE $0xd2       // testq	%rdx, %rdx
+	JE   BB0_28
+	LONG $0xca2ff9c5               // vcomisd	%xmm2, %xmm1
+	LONG $0xc3970f41               // seta	%r11b
+	JA   BB0_28
+	LONG $0xd12ef9c5               // vucomisd	%xmm1, %xmm2
+	LONG $0xc29b0f41               // setnp	%r10b
+	LONG $0xd3450f45               // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2       // testb	%r10b, %r10b
+	JE   BB0_15
+	WORD $0x3949; BYTE $0xf0       // cmpq	%rsi, %r8
+	JLE  BB0_15
+
+BB0_28:
+	LONG $0xca10ebc5             // vmovsd	%xmm2, %xmm2, %xmm1
+	WORD $0x8949; BYTE $0xf0     // movq	%rsi, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_15:
+	WORD $0x3948; BYTE $0xc7 // cmpq	%rax, %rdi
+	JG   BB0_18
+	JMP  BB0_61
+
+BB0_29:
+	LONG $0xc810fbc5             // vmovsd	%xmm0, %xmm0, %xmm1
+	WORD $0x8949; BYTE $0xc0     // movq	%rax, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_17:
+	LONG $0x01c08348         // addq	$1, %rax
+	WORD $0x3948; BYTE $0xc7 // cmpq	%rax, %rdi
+	JE   BB0_61
+
+BB0_18:
+	LONG $0x0410fbc5; BYTE $0xc1 // vmovsd	(%rcx,%rax,8), %xmm0
+	LONG $0xc02ef9c5             // vucomisd	%xmm0, %xmm0
+	JP   BB0_17
+	LONG $0xc82ff9c5             // vcomisd	%xmm0, %xmm1
+	JA   BB0_29
+	WORD $0xf280; BYTE $0x01     // xorb	$1, %dl
+	JNE  BB0_29
+	WORD $0x394c; BYTE $0xc0     // cmpq	%r8, %rax
+	JGE  BB0_30
+	LONG $0xc82ef9c5             // vucomisd	%xmm0, %xmm1
+	LONG $0xc69b0f40             // setnp	%sil
+	WORD $0x440f; BYTE $0xd6     // cmove	%esi, %edx
+	WORD $0xd284                 // testb	%dl, %dl
+	JNE  BB0_29
+
+BB0_30:
+	LONG $0x01c08348             // addq	$1, %rax
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+	WORD $0x3948; BYTE $0xc7     // cmpq	%rax, %rdi
+	JNE  BB0_18
+
+BB0_61:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_9:
+	WORD $0x894d; BYTE $0x01 // movq	%r8, (%r9)
+	RET
+
+BB0_25:
+	WORD $0xd231             // xorl	%edx, %edx
+	LONG $0xc957f1c5         // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_12
+
+BB0_63:
+	WORD $0x8548; BYTE $0xff     // testq	%rdi, %rdi
+	JLE  BB0_19
+	LONG $0x0110fbc5             // vmovsd	(%rcx), %xmm0
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	LONG $0xc02ef9c5             // vucomisd	%xmm0, %xmm0
+	JP   BB0_64
+
+BB0_4:
+	LONG $0x01ff8348             // cmpq	$1, %rdi
+	JE   BB0_19
+	LONG $0x4910fbc5; BYTE $0x08 // vmovsd	8(%rcx), %xmm1
+	LONG $0xc92ef9c5             // vucomisd	%xmm1, %xmm1
+	JP   BB0_22
+	LONG $0xc12ff9c5             // vcomisd	%xmm1, %xmm0
+	JA   BB0_23
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JNE  BB0_65
+
+BB0_23:
+	LONG $0x000001b8; BYTE $0x00   // movl	$1, %eax
+	LONG $0x0001b841; WORD $0x0000 // movl	$1, %r8d
+
+BB0_6:
+	LONG $0x03ff8348             // cmpq	$3, %rdi
+	JNE  BB0_9
+	LONG $0x4110fbc5; BYTE $0x10 // vmovsd	16(%rcx), %xmm0
+	LONG $0xc02ef9c5             // vucomisd	%xmm0, %xmm0
+	JP   BB0_9
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_31
+	LONG $0xc82ff9c5             // vcomisd	%xmm0, %xmm1
+	JBE  BB0_9
+
+BB0_31:
+	LONG $0x0002b841; WORD $0x0000 // movl	$2, %r8d
+	WORD $0x894d; BYTE $0x01       // movq	%r8, (%r9)
+	RET
+
+BB0_22:
+	LONG $0xc810fbc5         // vmovsd	%xmm0, %xmm0, %xmm1
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_6
+
+BB0_64:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xc057f9c5 // vxorpd	%xmm0, %xmm0, %xmm0
+	JMP  BB0_4
+
+BB0_24:
+	VMOVAPD CPI0_1<>(SB), Y3        // vmovapd	.LCPI0_1(%rip), %ymm3
+	LONG    $0x000004b8; BYTE $0x00 // movl	$4, %eax
+	JMP     BB0_10
+
+BB0_19:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_9
+
+BB0_65:
+	LONG $0xc810fbc5             // vmovsd	%xmm0, %xmm0, %xmm1
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	WORD $0x3145; BYTE $0xc0     // xorl	%r8d, %r8d
+	JMP  BB0_6
@@ -0,0 +1,447 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/baseargmin_c_f64_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x00000000
+DATA CPI0_1<>+8(SB)/4, $0x00000000
+DATA CPI0_1<>+12(SB)/4, $0x3ff00000
+DATA CPI0_1<>+16(SB)/4, $0x00000000
+DATA CPI0_1<>+20(SB)/4, $0x40000000
+DATA CPI0_1<>+24(SB)/4, $0x00000000
+DATA CPI0_1<>+28(SB)/4, $0x40080000
+DATA CPI0_1<>+32(SB)/4, $0x00000000
+DATA CPI0_1<>+36(SB)/4, $0x40100000
+DATA CPI0_1<>+40(SB)/4, $0x00000000
+DATA CPI0_1<>+44(SB)/4, $0x40140000
+DATA CPI0_1<>+48(SB)/4, $0x00000000
+DATA CPI0_1<>+52(SB)/4, $0x40180000
+DATA CPI0_1<>+56(SB)/4, $0x00000000
+DATA CPI0_1<>+60(SB)/4, $0x401c0000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $64
+
+TEXT ·argmin_c_f64_avx512(SB), $0-24
+	MOVQ    v+0(FP), DI
+	MOVQ    plen_v+8(FP), SI
+	MOVQ    pout_result+16(FP), DX
+	WORD    $0x8b48; BYTE $0x36       // movq	(%rsi), %rsi
+	WORD    $0x8949; BYTE $0xd1       // movq	%rdx, %r9
+	LONG    $0x07fe8348               // cmpq	$7, %rsi
+	JLE     BB0_119
+	LONG    $0x48fdf162; WORD $0x0f10 // vmovupd	(%rdi), %zmm1
+	LONG    $0x0ffe8348               // cmpq	$15, %rsi
+	JLE     BB0_40
+	LONG    $0xf04e8d48               // leaq	-16(%rsi), %rcx
+	LONG    $0xe457d8c5               // vxorps	%xmm4, %xmm4, %xmm4
+	LONG    $0x000008b8; BYTE $0x00   // movl	$8, %eax
+	VMOVUPD CPI0_1<>(SB), Z2          // vmovapd	.LCPI0_1(%rip), %zmm2
+	WORD    $0x8948; BYTE $0xca       // movq	%rcx, %rdx
+	LONG    $0xf8e28348               // andq	$-8, %rdx
+	LONG    $0x48fdf162; WORD $0xda28 // vmovapd	%zmm2, %zmm3
+	LONG    $0x10c28348               // addq	$16, %rdx
+
+BB0_15:
+	LONG $0x48fdf162; WORD $0x3410; BYTE $0xc7 // vmovupd	(%rdi,%rax,8), %zmm6
+	LONG $0x2adbe1c4; BYTE $0xc0               // vcvtsi2sdq	%rax, %xmm4, %xmm0
+	LONG $0x08c08348                           // addq	$8, %rax
+	LONG $0x48cdf162; WORD $0xc9c2; BYTE $0x11 // vcmppd	$17, %zmm1, %zmm6, %k1
+	LONG $0x48fdf262; WORD $0xc019             // vbroadcastsd	%xmm0, %zmm0
+	LONG $0x49fdf162; WORD $0xda58             // vaddpd	%zmm2, %zmm0, %zmm3{%k1}
+	LONG $0x49fdf162; WORD $0xce28             // vmovapd	%zmm6, %zmm1{%k1}
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JNE  BB0_15
+	LONG $0x03e9c148                           // shrq	$3, %rcx
+	QUAD $0x00000010cd048d48                   // leaq	16(,%rcx,8), %rax
+
+BB0_14:
+	LONG $0xc92ef9c5             // vucomisd	%xmm1, %xmm1
+	LONG $0xc128fdc5             // vmovapd	%ymm1, %ymm0
+	LONG $0xd128f9c5             // vmovapd	%xmm1, %xmm2
+	JP   BB0_41
+	LONG $0x2cfb61c4; BYTE $0xc3 // vcvttsd2siq	%xmm3, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_16:
+	LONG $0xe015f9c5             // vunpckhpd	%xmm0, %xmm0, %xmm4
+	LONG $0xe42ef9c5             // vucomisd	%xmm4, %xmm4
+	JP   BB0_17
+	LONG $0xeb15e1c5             // vunpckhpd	%xmm3, %xmm3, %xmm5
+	LONG $0x2cfbe1c4; BYTE $0xcd // vcvttsd2siq	%xmm5, %rcx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_42
+	LONG $0xd42ff9c5             // vcomisd	%xmm4, %xmm2
+	LONG $0xc3970f41             // seta	%r11b
+	JA   BB0_42
+	LONG $0xd42ef9c5             // vucomisd	%xmm4, %xmm2
+	LONG $0xc29b0f41             // setnp	%r10b
+	LONG $0xd3450f45             // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2     // testb	%r10b, %r10b
+	JE   BB0_17
+	WORD $0x3949; BYTE $0xc8     // cmpq	%rcx, %r8
+	JLE  BB0_17
+
+BB0_42:
+	LONG $0xd410dbc5             // vmovsd	%xmm4, %xmm4, %xmm2
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_17:
+	LONG $0x28fdf362; WORD $0xc419; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm4
+	LONG $0xe42ef9c5                           // vucomisd	%xmm4, %xmm4
+	JP   BB0_18
+	LONG $0x28fdf362; WORD $0xdd19; BYTE $0x01 // vextractf64x2	$1, %ymm3, %xmm5
+	LONG $0x2cfbe1c4; BYTE $0xcd               // vcvttsd2siq	%xmm5, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_43
+	LONG $0xd42ff9c5                           // vcomisd	%xmm4, %xmm2
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_43
+	LONG $0xd42ef9c5                           // vucomisd	%xmm4, %xmm2
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_18
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_18
+
+BB0_43:
+	LONG $0xd410dbc5             // vmovsd	%xmm4, %xmm4, %xmm2
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_18:
+	LONG $0x28fdf362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm0
+	LONG $0xc02ef9c5                           // vucomisd	%xmm0, %xmm0
+	JP   BB0_19
+	LONG $0x48e5f362; WORD $0xe303; BYTE $0x03 // valignq	$3, %zmm3, %zmm3, %zmm4
+	LONG $0x2cfbe1c4; BYTE $0xcc               // vcvttsd2siq	%xmm4, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_44
+	LONG $0xd02ff9c5                           // vcomisd	%xmm0, %xmm2
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_44
+	LONG $0xd02ef9c5                           // vucomisd	%xmm0, %xmm2
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_19
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_19
+
+BB0_44:
+	LONG $0xd010fbc5             // vmovsd	%xmm0, %xmm0, %xmm2
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_19:
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0x48fdf362; WORD $0xc919; BYTE $0x02 // vextractf64x2	$2, %zmm1, %xmm1
+	LONG $0xc92ef9c5                           // vucomisd	%xmm1, %xmm1
+	JP   BB0_20
+	LONG $0x48fdf362; WORD $0xdc19; BYTE $0x02 // vextractf64x2	$2, %zmm3, %xmm4
+	LONG $0x2cfbe1c4; BYTE $0xcc               // vcvttsd2siq	%xmm4, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_45
+	LONG $0xd12ff9c5                           // vcomisd	%xmm1, %xmm2
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_45
+	LONG $0xd12ef9c5                           // vucomisd	%xmm1, %xmm2
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_20
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_20
+
+BB0_45:
+	LONG $0xd110f3c5             // vmovsd	%xmm1, %xmm1, %xmm2
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_20:
+	LONG $0xc815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc92ef9c5                           // vucomisd	%xmm1, %xmm1
+	JP   BB0_21
+	LONG $0x48e5f362; WORD $0xe303; BYTE $0x05 // valignq	$5, %zmm3, %zmm3, %zmm4
+	LONG $0x2cfbe1c4; BYTE $0xcc               // vcvttsd2siq	%xmm4, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_46
+	LONG $0xd12ff9c5                           // vcomisd	%xmm1, %xmm2
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_46
+	LONG $0xca2ef9c5                           // vucomisd	%xmm2, %xmm1
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_21
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_21
+
+BB0_46:
+	LONG $0xd110f3c5             // vmovsd	%xmm1, %xmm1, %xmm2
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_21:
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm1
+	LONG $0xc92ef9c5                           // vucomisd	%xmm1, %xmm1
+	JP   BB0_22
+	LONG $0x48fdf362; WORD $0xdc19; BYTE $0x03 // vextractf64x2	$3, %zmm3, %xmm4
+	LONG $0x2cfbe1c4; BYTE $0xcc               // vcvttsd2siq	%xmm4, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_47
+	LONG $0xd12ff9c5                           // vcomisd	%xmm1, %xmm2
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_47
+	LONG $0xca2ef9c5                           // vucomisd	%xmm2, %xmm1
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_22
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_22
+
+BB0_47:
+	LONG $0xd110f3c5             // vmovsd	%xmm1, %xmm1, %xmm2
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_22:
+	LONG $0x28fdf362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm0
+	LONG $0xc02ef9c5                           // vucomisd	%xmm0, %xmm0
+	JP   BB0_23
+	LONG $0x48e5f362; WORD $0xdb03; BYTE $0x07 // valignq	$7, %zmm3, %zmm3, %zmm3
+	LONG $0x2cfbe1c4; BYTE $0xcb               // vcvttsd2siq	%xmm3, %rcx
+	WORD $0x8548; BYTE $0xd2                   // testq	%rdx, %rdx
+	JE   BB0_48
+	LONG $0xd02ff9c5                           // vcomisd	%xmm0, %xmm2
+	LONG $0xc3970f41                           // seta	%r11b
+	JA   BB0_48
+	LONG $0xc22ef9c5                           // vucomisd	%xmm2, %xmm0
+	LONG $0xc29b0f41                           // setnp	%r10b
+	LONG $0xd3450f45                           // cmovne	%r11d, %r10d
+	WORD $0x8445; BYTE $0xd2                   // testb	%r10b, %r10b
+	JE   BB0_23
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JGE  BB0_23
+
+BB0_48:
+	LONG $0xd010fbc5             // vmovsd	%xmm0, %xmm0, %xmm2
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_23:
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JG   BB0_26
+	JMP  BB0_117
+
+BB0_49:
+	LONG $0xd010fbc5             // vmovsd	%xmm0, %xmm0, %xmm2
+	WORD $0x8949; BYTE $0xc0     // movq	%rax, %r8
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+
+BB0_25:
+	LONG $0x01c08348         // addq	$1, %rax
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JE   BB0_117
+
+BB0_26:
+	LONG $0x0410fbc5; BYTE $0xc7 // vmovsd	(%rdi,%rax,8), %xmm0
+	LONG $0xc02ef9c5             // vucomisd	%xmm0, %xmm0
+	JP   BB0_25
+	LONG $0xd02ff9c5             // vcomisd	%xmm0, %xmm2
+	JA   BB0_49
+	WORD $0xf280; BYTE $0x01     // xorb	$1, %dl
+	JNE  BB0_49
+	WORD $0x394c; BYTE $0xc0     // cmpq	%r8, %rax
+	JGE  BB0_50
+	LONG $0xd02ef9c5             // vucomisd	%xmm0, %xmm2
+	WORD $0x9b0f; BYTE $0xc1     // setnp	%cl
+	WORD $0x450f; BYTE $0xca     // cmovne	%edx, %ecx
+	WORD $0xc984                 // testb	%cl, %cl
+	JNE  BB0_49
+
+BB0_50:
+	LONG $0x01c08348             // addq	$1, %rax
+	LONG $0x000001ba; BYTE $0x00 // movl	$1, %edx
+	WORD $0x3948; BYTE $0xc6     // cmpq	%rax, %rsi
+	JNE  BB0_26
+
+BB0_117:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_13:
+	WORD $0x894d; BYTE $0x01 // movq	%r8, (%r9)
+	RET
+
+BB0_41:
+	WORD $0xd231             // xorl	%edx, %edx
+	LONG $0xd257e9c5         // vxorpd	%xmm2, %xmm2, %xmm2
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_16
+
+BB0_119:
+	WORD $0x8548; BYTE $0xf6     // testq	%rsi, %rsi
+	JLE  BB0_27
+	LONG $0x0f10fbc5             // vmovsd	(%rdi), %xmm1
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	LONG $0xc92ef9c5             // vucomisd	%xmm1, %xmm1
+	JP   BB0_120
+
+BB0_4:
+	LONG $0x01fe8348             // cmpq	$1, %rsi
+	JE   BB0_27
+	LONG $0x4710fbc5; BYTE $0x08 // vmovsd	8(%rdi), %xmm0
+	LONG $0xc02ef9c5             // vucomisd	%xmm0, %xmm0
+	JP   BB0_30
+	LONG $0xc82ff9c5             // vcomisd	%xmm0, %xmm1
+	JA   BB0_31
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JNE  BB0_121
+
+BB0_31:
+	LONG $0x000001b8; BYTE $0x00   // movl	$1, %eax
+	LONG $0x0001b841; WORD $0x0000 // movl	$1, %r8d
+
+BB0_6:
+	LONG $0x02fe8348             // cmpq	$2, %rsi
+	JE   BB0_13
+	LONG $0x4f10fbc5; BYTE $0x10 // vmovsd	16(%rdi), %xmm1
+	LONG $0xc92ef9c5             // vucomisd	%xmm1, %xmm1
+	JP   BB0_32
+	LONG $0xc12ff9c5             // vcomisd	%xmm1, %xmm0
+	JA   BB0_33
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JNE  BB0_122
+
+BB0_33:
+	LONG $0x000001b8; BYTE $0x00   // movl	$1, %eax
+	LONG $0x0002b841; WORD $0x0000 // movl	$2, %r8d
+
+BB0_7:
+	LONG $0x03fe8348             // cmpq	$3, %rsi
+	JE   BB0_13
+	LONG $0x4710fbc5; BYTE $0x18 // vmovsd	24(%rdi), %xmm0
+	LONG $0xc02ef9c5             // vucomisd	%xmm0, %xmm0
+	JP   BB0_34
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_35
+	LONG $0xc82ff9c5             // vcomisd	%xmm0, %xmm1
+	JBE  BB0_123
+
+BB0_35:
+	LONG $0x000001b8; BYTE $0x00   // movl	$1, %eax
+	LONG $0x0003b841; WORD $0x0000 // movl	$3, %r8d
+
+BB0_8:
+	LONG $0x04fe8348             // cmpq	$4, %rsi
+	JE   BB0_13
+	LONG $0x4f10fbc5; BYTE $0x20 // vmovsd	32(%rdi), %xmm1
+	LONG $0xc92ef9c5             // vucomisd	%xmm1, %xmm1
+	JP   BB0_36
+	LONG $0xc12ff9c5             // vcomisd	%xmm1, %xmm0
+	JA   BB0_37
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JNE  BB0_124
+
+BB0_37:
+	LONG $0x000001b8; BYTE $0x00   // movl	$1, %eax
+	LONG $0x0004b841; WORD $0x0000 // movl	$4, %r8d
+
+BB0_9:
+	LONG $0x05fe8348             // cmpq	$5, %rsi
+	JE   BB0_13
+	LONG $0x4710fbc5; BYTE $0x28 // vmovsd	40(%rdi), %xmm0
+	LONG $0xc02ef9c5             // vucomisd	%xmm0, %xmm0
+	JP   BB0_38
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_39
+	LONG $0xc82ff9c5             // vcomisd	%xmm0, %xmm1
+	JBE  BB0_125
+
+BB0_39:
+	LONG $0x000001b8; BYTE $0x00   // movl	$1, %eax
+	LONG $0x0005b841; WORD $0x0000 // movl	$5, %r8d
+
+BB0_10:
+	LONG $0x07fe8348             // cmpq	$7, %rsi
+	JNE  BB0_13
+	LONG $0x4f10fbc5; BYTE $0x30 // vmovsd	48(%rdi), %xmm1
+	LONG $0xc92ef9c5             // vucomisd	%xmm1, %xmm1
+	JP   BB0_13
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JE   BB0_51
+	LONG $0xc12ff9c5             // vcomisd	%xmm1, %xmm0
+	JBE  BB0_13
+
+BB0_51:
+	LONG $0x0006b841; WORD $0x0000 // movl	$6, %r8d
+	JMP  BB0_13
+
+BB0_30:
+	LONG $0xc110f3c5         // vmovsd	%xmm1, %xmm1, %xmm0
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_6
+
+BB0_120:
+	WORD $0xc031     // xorl	%eax, %eax
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	JMP  BB0_4
+
+BB0_32:
+	LONG $0xc810fbc5 // vmovsd	%xmm0, %xmm0, %xmm1
+	JMP  BB0_7
+
+BB0_40:
+	VMOVUPD CPI0_1<>(SB), Z3        // vmovapd	.LCPI0_1(%rip), %zmm3
+	LONG    $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	JMP     BB0_14
+
+BB0_27:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_13
+
+BB0_34:
+	LONG $0xc110f3c5 // vmovsd	%xmm1, %xmm1, %xmm0
+	JMP  BB0_8
+
+BB0_36:
+	LONG $0xc810fbc5 // vmovsd	%xmm0, %xmm0, %xmm1
+	JMP  BB0_9
+
+BB0_38:
+	LONG $0xc110f3c5 // vmovsd	%xmm1, %xmm1, %xmm0
+	JMP  BB0_10
+
+BB0_124:
+	LONG $0xc810fbc5             // vmovsd	%xmm0, %xmm0, %xmm1
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	JMP  BB0_9
+
+BB0_125:
+	LONG $0xc110f3c5             // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	JMP  BB0_10
+
+BB0_121:
+	LONG $0xc110f3c5             // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	WORD $0x3145; BYTE $0xc0     // xorl	%r8d, %r8d
+	JMP  BB0_6
+
+BB0_122:
+	LONG $0xc810fbc5             // vmovsd	%xmm0, %xmm0, %xmm1
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	JMP  BB0_7
+
+BB0_123:
+	LONG $0xc110f3c5             // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0x000001b8; BYTE $0x00 // movl	$1, %eax
+	JMP  BB0_8
@@ -0,0 +1,188 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basebatchdot_c_f32_avx2_amd64.c
+
+TEXT ·batchdot_c_f32_avx2(SB), $112-64
+	MOVQ query+0(FP), DI
+	MOVQ data+8(FP), SI
+	MOVQ dots+16(FP), DX
+	MOVQ pcount+24(FP), CX
+	MOVQ pdims+32(FP), R8
+	MOVQ plen_query+40(FP), R9
+	MOVQ plen_data+48(FP), R11
+	MOVQ R11, 96(SP)
+	MOVQ plen_dots+56(FP), R11
+	MOVQ R11, 104(SP)
+	LONG $0x246c8d48; BYTE $0x50 // leaq	80(%rsp), %rbp
+	WORD $0x8948; BYTE $0xf3     // movq	%rsi, %rbx
+	LONG $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348             // andq	$-32, %rsp
+	WORD $0x8b48; BYTE $0x31     // movq	(%rcx), %rsi
+	WORD $0x8b49; BYTE $0x00     // movq	(%r8), %rax
+	LONG $0x24548948; BYTE $0x30 // movq	%rdx, 48(%rsp)
+	LONG $0x24748948; BYTE $0x38 // movq	%rsi, 56(%rsp)
+	WORD $0x8548; BYTE $0xf6     // testq	%rsi, %rsi
+	JLE  BB0_22
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JLE  BB0_22
+	LONG $0x18558b48             // movq	24(%rbp), %rdx
+	WORD $0x3b48; BYTE $0x32     // cmpq	(%rdx), %rsi
+	WORD $0x9f0f; BYTE $0xc2     // setg	%dl
+	WORD $0x3b49; BYTE $0x01     // cmpq	(%r9), %rax
+	WORD $0x9f0f; BYTE $0xc1     // setg	%cl
+	WORD $0xca08                 // orb	%cl, %dl
+	JNE  BB0_22
+	LONG $0x10558b48             // movq	16(%rbp), %rdx
+	LONG $0xf0af0f48             // imulq	%rax, %rsi
+	WORD $0x3b48; BYTE $0x32     // cmpq	(%rdx), %rsi
+	JLE  BB0_25
+
+BB0_22:
+	LONG $0xb0658d48 // leaq	-80(%rbp), %rsp
+	RET
+
+BB0_25:
+	LONG $0xf8488d4c             // leaq	-8(%rax), %r9
+	WORD $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+	WORD $0x3145; BYTE $0xdb     // xorl	%r11d, %r11d
+	WORD $0x3145; BYTE $0xed     // xorl	%r13d, %r13d
+	LONG $0x03e9c149             // shrq	$3, %r9
+	LONG $0x01c18349             // addq	$1, %r9
+	QUAD $0x00000000cd3c8d4e     // leaq	0(,%r9,8), %r15
+	LONG $0x05e1c149             // salq	$5, %r9
+	WORD $0x294c; BYTE $0xfa     // subq	%r15, %rdx
+	WORD $0x0149; BYTE $0xf9     // addq	%rdi, %r9
+	LONG $0xff728d48             // leaq	-1(%rdx), %rsi
+	WORD $0x8949; BYTE $0xd4     // movq	%rdx, %r12
+	LONG $0x24548948; BYTE $0x18 // movq	%rdx, 24(%rsp)
+	LONG $0x24748948; BYTE $0x10 // movq	%rsi, 16(%rsp)
+	WORD $0x8948; BYTE $0xd6     // movq	%rdx, %rsi
+	WORD $0xe283; BYTE $0x07     // andl	$7, %edx
+	LONG $0x03ecc149             // shrq	$3, %r12
+	LONG $0xf8e68348             // andq	$-8, %rsi
+	LONG $0x24548948; BYTE $0x20 // movq	%rdx, 32(%rsp)
+	LONG $0x05e4c149             // salq	$5, %r12
+	LONG $0x24748948; BYTE $0x28 // movq	%rsi, 40(%rsp)
+
+BB0_11:
+	LONG $0x9b148d4a             // leaq	(%rbx,%r11,4), %rdx
+	LONG $0x07f88348             // cmpq	$7, %rax
+	JLE  BB0_3
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b9; BYTE $0x00 // movl	$8, %ecx
+
+BB0_4:
+	LONG $0x6410fcc5; WORD $0xe08f             // vmovups	-32(%rdi,%rcx,4), %ymm4
+	LONG $0xb85de2c4; WORD $0x8a4c; BYTE $0xe0 // vfmadd231ps	-32(%rdx,%rcx,4), %ymm4, %ymm1
+	LONG $0x08c18348                           // addq	$8, %rcx
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_4
+	LONG $0x197de3c4; WORD $0x01c8             // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5                           // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5                           // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xf8                   // cmpq	%r15, %rax
+	JLE  BB0_5
+	LONG $0x247c8348; WORD $0x0610             // cmpq	$6, 16(%rsp)
+	LONG $0x24448b4c; BYTE $0x18               // movq	24(%rsp), %r8
+	JBE  BB0_12
+	LONG $0x3b0c8d4b                           // leaq	(%r11,%r15), %rcx
+	LONG $0x8b348d48                           // leaq	(%rbx,%rcx,4), %rsi
+	WORD $0xc931                               // xorl	%ecx, %ecx
+
+BB0_7:
+	LONG $0x2c10fcc5; BYTE $0x0e   // vmovups	(%rsi,%rcx), %ymm5
+	LONG $0x5954c1c4; WORD $0x0914 // vmulps	(%r9,%rcx), %ymm5, %ymm2
+	LONG $0x20c18348               // addq	$32, %rcx
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xcac6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xdac6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xc215e8c5               // vunpckhps	%xmm2, %xmm2, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd858e2c5               // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f2c5               // vaddss	%xmm3, %xmm1, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xe1       // cmpq	%r12, %rcx
+	JNE  BB0_7
+	LONG $0x244c8b48; BYTE $0x28   // movq	40(%rsp), %rcx
+	WORD $0x8948; BYTE $0xce       // movq	%rcx, %rsi
+	WORD $0x014c; BYTE $0xf9       // addq	%r15, %rcx
+	LONG $0x247c8348; WORD $0x0020 // cmpq	$0, 32(%rsp)
+	JE   BB0_5
+	WORD $0x894d; BYTE $0xfe       // movq	%r15, %r14
+
+BB0_6:
+	WORD $0x2949; BYTE $0xf0       // subq	%rsi, %r8
+	LONG $0xff508d4d               // leaq	-1(%r8), %r10
+	LONG $0x02fa8349               // cmpq	$2, %r10
+	JBE  BB0_9
+	LONG $0x33148d4f               // leaq	(%r11,%r14), %r10
+	WORD $0x0149; BYTE $0xf2       // addq	%rsi, %r10
+	WORD $0x014c; BYTE $0xf6       // addq	%r14, %rsi
+	LONG $0x0c10f8c5; BYTE $0xb7   // vmovups	(%rdi,%rsi,4), %xmm1
+	LONG $0x5970a1c4; WORD $0x930c // vmulps	(%rbx,%r10,4), %xmm1, %xmm1
+	WORD $0x894c; BYTE $0xc6       // movq	%r8, %rsi
+	LONG $0xfce68348               // andq	$-4, %rsi
+	WORD $0x0148; BYTE $0xf1       // addq	%rsi, %rcx
+	LONG $0x03e08341               // andl	$3, %r8d
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xd115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm2
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_5
+
+BB0_9:
+	LONG $0x01418d4c                           // leaq	1(%rcx), %r8
+	LONG $0x3410fac5; BYTE $0x8f               // vmovss	(%rdi,%rcx,4), %xmm6
+	QUAD $0x000000008d348d48                   // leaq	0(,%rcx,4), %rsi
+	LONG $0xb949e2c4; WORD $0x8a04             // vfmadd231ss	(%rdx,%rcx,4), %xmm6, %xmm0
+	WORD $0x394c; BYTE $0xc0                   // cmpq	%r8, %rax
+	JLE  BB0_5
+	LONG $0x02c18348                           // addq	$2, %rcx
+	LONG $0x7c10fac5; WORD $0x0432             // vmovss	4(%rdx,%rsi), %xmm7
+	LONG $0xb941e2c4; WORD $0x3744; BYTE $0x04 // vfmadd231ss	4(%rdi,%rsi), %xmm7, %xmm0
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JLE  BB0_5
+	LONG $0x7c10fac5; WORD $0x0832             // vmovss	8(%rdx,%rsi), %xmm7
+	LONG $0xb941e2c4; WORD $0x3744; BYTE $0x08 // vfmadd231ss	8(%rdi,%rsi), %xmm7, %xmm0
+
+BB0_5:
+	LONG $0x24548b48; BYTE $0x30   // movq	48(%rsp), %rdx
+	WORD $0x0149; BYTE $0xc3       // addq	%rax, %r11
+	LONG $0x117aa1c4; WORD $0xaa04 // vmovss	%xmm0, (%rdx,%r13,4)
+	LONG $0x01c58349               // addq	$1, %r13
+	LONG $0x246c394c; BYTE $0x38   // cmpq	%r13, 56(%rsp)
+	JG   BB0_11
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	LONG $0xb0658d48               // leaq	-80(%rbp), %rsp
+	RET
+
+BB0_3:
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x8949; BYTE $0xc0 // movq	%rax, %r8
+	WORD $0x3145; BYTE $0xf6 // xorl	%r14d, %r14d
+	WORD $0xf631             // xorl	%esi, %esi
+	WORD $0xc931             // xorl	%ecx, %ecx
+	JMP  BB0_6
+
+BB0_12:
+	WORD $0x894d; BYTE $0xfe // movq	%r15, %r14
+	WORD $0x894c; BYTE $0xf9 // movq	%r15, %rcx
+	WORD $0xf631             // xorl	%esi, %esi
+	JMP  BB0_6
@@ -0,0 +1,238 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basebatchdot_c_f32_avx512_amd64.c
+
+TEXT ·batchdot_c_f32_avx512(SB), $144-64
+	MOVQ query+0(FP), DI
+	MOVQ data+8(FP), SI
+	MOVQ dots+16(FP), DX
+	MOVQ pcount+24(FP), CX
+	MOVQ pdims+32(FP), R8
+	MOVQ plen_query+40(FP), R9
+	MOVQ plen_data+48(FP), R11
+	MOVQ R11, 128(SP)
+	MOVQ plen_dots+56(FP), R11
+	MOVQ R11, 136(SP)
+	LONG $0x246c8d48; BYTE $0x70 // leaq	112(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x40 // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348             // andq	$-64, %rsp
+	WORD $0x8b48; BYTE $0x19     // movq	(%rcx), %rbx
+	WORD $0x8b49; BYTE $0x00     // movq	(%r8), %rax
+	WORD $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE  BB0_25
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JLE  BB0_25
+	LONG $0x6ef9e1c4; BYTE $0xc2 // vmovq	%rdx, %xmm0
+	LONG $0x18558b48             // movq	24(%rbp), %rdx
+	WORD $0x3b48; BYTE $0x1a     // cmpq	(%rdx), %rbx
+	WORD $0x9f0f; BYTE $0xc2     // setg	%dl
+	WORD $0x3b49; BYTE $0x01     // cmpq	(%r9), %rax
+	WORD $0x9f0f; BYTE $0xc1     // setg	%cl
+	WORD $0xca08                 // orb	%cl, %dl
+	JNE  BB0_25
+	LONG $0x10558b48             // movq	16(%rbp), %rdx
+	WORD $0x8948; BYTE $0xd9     // movq	%rbx, %rcx
+	LONG $0xc8af0f48             // imulq	%rax, %rcx
+	WORD $0x3b48; BYTE $0x0a     // cmpq	(%rdx), %rcx
+	JLE  BB0_28
+
+BB0_25:
+	LONG $0x90658d48 // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_28:
+	WORD $0x8949; BYTE $0xff     // movq	%rdi, %r15
+	LONG $0xf0788d48             // leaq	-16(%rax), %rdi
+	WORD $0x8949; BYTE $0xf6     // movq	%rsi, %r14
+	WORD $0x8948; BYTE $0xc6     // movq	%rax, %rsi
+	LONG $0x04efc148             // shrq	$4, %rdi
+	LONG $0x245c8948; BYTE $0x38 // movq	%rbx, 56(%rsp)
+	WORD $0x3145; BYTE $0xc0     // xorl	%r8d, %r8d
+	WORD $0x3145; BYTE $0xd2     // xorl	%r10d, %r10d
+	LONG $0x01c78348             // addq	$1, %rdi
+	LONG $0xd06f79c5             // vmovdqa	%xmm0, %xmm10
+	WORD $0x8949; BYTE $0xfb     // movq	%rdi, %r11
+	LONG $0x06e7c148             // salq	$6, %rdi
+	LONG $0x04e3c149             // salq	$4, %r11
+	WORD $0x014c; BYTE $0xff     // addq	%r15, %rdi
+	WORD $0x294c; BYTE $0xde     // subq	%r11, %rsi
+	LONG $0xff4e8d48             // leaq	-1(%rsi), %rcx
+	WORD $0x8949; BYTE $0xf1     // movq	%rsi, %r9
+	LONG $0x24748948; BYTE $0x20 // movq	%rsi, 32(%rsp)
+	LONG $0x244c8948; BYTE $0x18 // movq	%rcx, 24(%rsp)
+	WORD $0x8948; BYTE $0xf1     // movq	%rsi, %rcx
+	WORD $0xe683; BYTE $0x0f     // andl	$15, %esi
+	LONG $0x04e9c149             // shrq	$4, %r9
+	LONG $0xf0e18348             // andq	$-16, %rcx
+	LONG $0x24748948; BYTE $0x28 // movq	%rsi, 40(%rsp)
+	LONG $0x06e1c149             // salq	$6, %r9
+	LONG $0x244c8948; BYTE $0x30 // movq	%rcx, 48(%rsp)
+
+BB0_14:
+	LONG $0x861c8d4b             // leaq	(%r14,%r8,4), %rbx
+	LONG $0x0ff88348             // cmpq	$15, %rax
+	JLE  BB0_5
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000010ba; BYTE $0x00 // movl	$16, %edx
+
+BB0_6:
+	QUAD $0xff976410487cd162                   // vmovups	-64(%r15,%rdx,4), %zmm4
+	QUAD $0xff934cb8485df262                   // vfmadd231ps	-64(%rbx,%rdx,4), %zmm4, %zmm1
+	LONG $0x10c28348                           // addq	$16, %rdx
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_6
+	LONG $0x48fdf362; WORD $0xcd1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm5
+	LONG $0xc958d4c5                           // vaddps	%ymm1, %ymm5, %ymm1
+	LONG $0x197de3c4; WORD $0x01cd             // vextractf128	$0x1, %ymm1, %xmm5
+	LONG $0xc958d0c5                           // vaddps	%xmm1, %xmm5, %xmm1
+	LONG $0x0479e3c4; WORD $0x4ee9             // vpermilps	$78, %xmm1, %xmm5
+	LONG $0xe958d0c5                           // vaddps	%xmm1, %xmm5, %xmm5
+	LONG $0xcd28f8c5                           // vmovaps	%xmm5, %xmm1
+	LONG $0xedc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm5
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	WORD $0x394c; BYTE $0xd8                   // cmpq	%r11, %rax
+	JLE  BB0_7
+	LONG $0x247c8348; WORD $0x0e18             // cmpq	$14, 24(%rsp)
+	LONG $0x24748b48; BYTE $0x20               // movq	32(%rsp), %rsi
+	JBE  BB0_15
+	LONG $0x03148d4b                           // leaq	(%r11,%r8), %rdx
+	LONG $0x960c8d49                           // leaq	(%r14,%rdx,4), %rcx
+	WORD $0xd231                               // xorl	%edx, %edx
+
+BB0_9:
+	LONG $0x487cf162; WORD $0x3c10; BYTE $0x11 // vmovups	(%rcx,%rdx), %zmm7
+	LONG $0x4844f162; WORD $0x1c59; BYTE $0x17 // vmulps	(%rdi,%rdx), %zmm7, %zmm3
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0xf3c6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm6
+	LONG $0xc3c6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm0
+	LONG $0x2865f362; WORD $0xeb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm5
+	LONG $0xc958e2c5                           // vaddss	%xmm1, %xmm3, %xmm1
+	LONG $0xf158cac5                           // vaddss	%xmm1, %xmm6, %xmm6
+	LONG $0xcb15e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm1
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xd919; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xcb03; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xcb03; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xd91b; BYTE $0x01 // vextractf32x8	$0x1, %zmm3, %ymm1
+	LONG $0xf1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm6
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xe9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm5
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xf115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm6
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xcd19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xe903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm5
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xe903; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm5
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xc958fac5                           // vaddss	%xmm1, %xmm0, %xmm1
+	WORD $0x3949; BYTE $0xd1                   // cmpq	%rdx, %r9
+	JNE  BB0_9
+	LONG $0x24548b48; BYTE $0x30               // movq	48(%rsp), %rdx
+	WORD $0x8948; BYTE $0xd1                   // movq	%rdx, %rcx
+	WORD $0x014c; BYTE $0xda                   // addq	%r11, %rdx
+	LONG $0x247c8348; WORD $0x0028             // cmpq	$0, 40(%rsp)
+	JE   BB0_7
+	WORD $0x894d; BYTE $0xdc                   // movq	%r11, %r12
+
+BB0_8:
+	WORD $0x2948; BYTE $0xce                   // subq	%rcx, %rsi
+	LONG $0xff6e8d4c                           // leaq	-1(%rsi), %r13
+	LONG $0x06fd8349                           // cmpq	$6, %r13
+	JBE  BB0_12
+	WORD $0x014c; BYTE $0xe1                   // addq	%r12, %rcx
+	LONG $0x01248d4e                           // leaq	(%rcx,%r8), %r12
+	LONG $0x107cc1c4; WORD $0x8f2c             // vmovups	(%r15,%rcx,4), %ymm5
+	WORD $0x8948; BYTE $0xf1                   // movq	%rsi, %rcx
+	LONG $0x595481c4; WORD $0xa62c             // vmulps	(%r14,%r12,4), %ymm5, %ymm5
+	LONG $0xf8e18348                           // andq	$-8, %rcx
+	WORD $0x0148; BYTE $0xca                   // addq	%rcx, %rdx
+	WORD $0xe683; BYTE $0x07                   // andl	$7, %esi
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xfdc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm7
+	LONG $0xf5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm6
+	LONG $0xcf58f2c5                           // vaddss	%xmm7, %xmm1, %xmm1
+	LONG $0xfd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm7
+	LONG $0xcf58f2c5                           // vaddss	%xmm7, %xmm1, %xmm1
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xee19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm6
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm6
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm6
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0xce58f2c5                           // vaddss	%xmm6, %xmm1, %xmm1
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	JE   BB0_7
+
+BB0_12:
+	LONG $0x01728d48                           // leaq	1(%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0x9714             // vmovss	(%r15,%rdx,4), %xmm2
+	QUAD $0x00000000950c8d48                   // leaq	0(,%rdx,4), %rcx
+	LONG $0xb969e2c4; WORD $0x930c             // vfmadd231ss	(%rbx,%rdx,4), %xmm2, %xmm1
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_7
+	LONG $0x02728d48                           // leaq	2(%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0x0f54; BYTE $0x04 // vmovss	4(%r15,%rcx), %xmm2
+	LONG $0xb969e2c4; WORD $0x0b4c; BYTE $0x04 // vfmadd231ss	4(%rbx,%rcx), %xmm2, %xmm1
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_7
+	LONG $0x03728d48                           // leaq	3(%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0x0f54; BYTE $0x08 // vmovss	8(%r15,%rcx), %xmm2
+	LONG $0xb969e2c4; WORD $0x0b4c; BYTE $0x08 // vfmadd231ss	8(%rbx,%rcx), %xmm2, %xmm1
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_7
+	LONG $0x04728d48                           // leaq	4(%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0x0f54; BYTE $0x0c // vmovss	12(%r15,%rcx), %xmm2
+	LONG $0xb969e2c4; WORD $0x0b4c; BYTE $0x0c // vfmadd231ss	12(%rbx,%rcx), %xmm2, %xmm1
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_7
+	LONG $0x05728d48                           // leaq	5(%rdx), %rsi
+	LONG $0x107ac1c4; WORD $0x0f5c; BYTE $0x10 // vmovss	16(%r15,%rcx), %xmm3
+	LONG $0xb961e2c4; WORD $0x0b4c; BYTE $0x10 // vfmadd231ss	16(%rbx,%rcx), %xmm3, %xmm1
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_7
+	LONG $0x06c28348                           // addq	$6, %rdx
+	LONG $0x107ac1c4; WORD $0x0f54; BYTE $0x14 // vmovss	20(%r15,%rcx), %xmm2
+	LONG $0xb969e2c4; WORD $0x0b4c; BYTE $0x14 // vfmadd231ss	20(%rbx,%rcx), %xmm2, %xmm1
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JLE  BB0_7
+	LONG $0x107ac1c4; WORD $0x0f5c; BYTE $0x18 // vmovss	24(%r15,%rcx), %xmm3
+	LONG $0xb961e2c4; WORD $0x0b4c; BYTE $0x18 // vfmadd231ss	24(%rbx,%rcx), %xmm3, %xmm1
+
+BB0_7:
+	LONG $0x7ef961c4; BYTE $0xd6   // vmovq	%xmm10, %rsi
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x117aa1c4; WORD $0x960c // vmovss	%xmm1, (%rsi,%r10,4)
+	LONG $0x01c28349               // addq	$1, %r10
+	LONG $0x2454394c; BYTE $0x38   // cmpq	%r10, 56(%rsp)
+	JG   BB0_14
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	LONG $0x90658d48               // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_5:
+	LONG $0xc957f0c5         // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0x8948; BYTE $0xc6 // movq	%rax, %rsi
+	WORD $0x3145; BYTE $0xe4 // xorl	%r12d, %r12d
+	WORD $0xc931             // xorl	%ecx, %ecx
+	WORD $0xd231             // xorl	%edx, %edx
+	JMP  BB0_8
+
+BB0_15:
+	WORD $0x894d; BYTE $0xdc // movq	%r11, %r12
+	WORD $0x894c; BYTE $0xda // movq	%r11, %rdx
+	WORD $0xc931             // xorl	%ecx, %ecx
+	JMP  BB0_8
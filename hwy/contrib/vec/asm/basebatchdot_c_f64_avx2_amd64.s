@@ -0,0 +1,162 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basebatchdot_c_f64_avx2_amd64.c
+
+TEXT ·batchdot_c_f64_avx2(SB), $112-64
+	MOVQ query+0(FP), DI
+	MOVQ data+8(FP), SI
+	MOVQ dots+16(FP), DX
+	MOVQ pcount+24(FP), CX
+	MOVQ pdims+32(FP), R8
+	MOVQ plen_query+40(FP), R9
+	MOVQ plen_data+48(FP), R11
+	MOVQ R11, 96(SP)
+	MOVQ plen_dots+56(FP), R11
+	MOVQ R11, 104(SP)
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0x246c8d48; BYTE $0x50 // leaq	80(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348             // andq	$-32, %rsp
+	WORD $0x8b48; BYTE $0x39     // movq	(%rcx), %rdi
+	WORD $0x8b49; BYTE $0x08     // movq	(%r8), %rcx
+	LONG $0x24548948; BYTE $0x30 // movq	%rdx, 48(%rsp)
+	LONG $0x247c8948; BYTE $0x38 // movq	%rdi, 56(%rsp)
+	WORD $0x8548; BYTE $0xff     // testq	%rdi, %rdi
+	JLE  BB0_25
+	WORD $0x8548; BYTE $0xc9     // testq	%rcx, %rcx
+	JLE  BB0_25
+	LONG $0x18558b48             // movq	24(%rbp), %rdx
+	WORD $0x8948; BYTE $0xf3     // movq	%rsi, %rbx
+	WORD $0x3b48; BYTE $0x3a     // cmpq	(%rdx), %rdi
+	WORD $0x9f0f; BYTE $0xc2     // setg	%dl
+	WORD $0x3b49; BYTE $0x09     // cmpq	(%r9), %rcx
+	LONG $0xc69f0f40             // setg	%sil
+	WORD $0x0840; BYTE $0xf2     // orb	%sil, %dl
+	JNE  BB0_25
+	LONG $0x10558b48             // movq	16(%rbp), %rdx
+	LONG $0xf9af0f48             // imulq	%rcx, %rdi
+	WORD $0x3b48; BYTE $0x3a     // cmpq	(%rdx), %rdi
+	JLE  BB0_28
+
+BB0_25:
+	LONG $0xb0658d48 // leaq	-80(%rbp), %rsp
+	RET
+
+BB0_28:
+	LONG $0xfc498d4c             // leaq	-4(%rcx), %r9
+	WORD $0x8948; BYTE $0xca     // movq	%rcx, %rdx
+	WORD $0x3145; BYTE $0xdb     // xorl	%r11d, %r11d
+	WORD $0x3145; BYTE $0xed     // xorl	%r13d, %r13d
+	LONG $0x02e9c149             // shrq	$2, %r9
+	LONG $0x01c18349             // addq	$1, %r9
+	QUAD $0x000000008d3c8d4e     // leaq	0(,%r9,4), %r15
+	LONG $0x05e1c149             // salq	$5, %r9
+	WORD $0x294c; BYTE $0xfa     // subq	%r15, %rdx
+	WORD $0x0149; BYTE $0xc1     // addq	%rax, %r9
+	LONG $0xff7a8d48             // leaq	-1(%rdx), %rdi
+	WORD $0x8949; BYTE $0xd2     // movq	%rdx, %r10
+	LONG $0x24548948; BYTE $0x20 // movq	%rdx, 32(%rsp)
+	LONG $0x247c8948; BYTE $0x18 // movq	%rdi, 24(%rsp)
+	WORD $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	LONG $0xfce28348             // andq	$-4, %rdx
+	LONG $0x02eac149             // shrq	$2, %r10
+	WORD $0xe783; BYTE $0x03     // andl	$3, %edi
+	LONG $0x24548948; BYTE $0x10 // movq	%rdx, 16(%rsp)
+	LONG $0x05e2c149             // salq	$5, %r10
+	LONG $0x247c8948; BYTE $0x28 // movq	%rdi, 40(%rsp)
+
+BB0_11:
+	LONG $0xdb148d4a             // leaq	(%rbx,%r11,8), %rdx
+	LONG $0x03f98348             // cmpq	$3, %rcx
+	JLE  BB0_3
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000004be; BYTE $0x00 // movl	$4, %esi
+
+BB0_4:
+	LONG $0x6410fdc5; WORD $0xe0f0             // vmovupd	-32(%rax,%rsi,8), %ymm4
+	LONG $0xb8dde2c4; WORD $0xf24c; BYTE $0xe0 // vfmadd231pd	-32(%rdx,%rsi,8), %ymm4, %ymm1
+	LONG $0x04c68348                           // addq	$4, %rsi
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_4
+	LONG $0x197de3c4; WORD $0x01c8             // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5                           // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xf9                   // cmpq	%r15, %rcx
+	JLE  BB0_5
+	LONG $0x247c8348; WORD $0x0218             // cmpq	$2, 24(%rsp)
+	LONG $0x247c8b48; BYTE $0x20               // movq	32(%rsp), %rdi
+	JBE  BB0_12
+	LONG $0x3b348d4b                           // leaq	(%r11,%r15), %rsi
+	LONG $0xf3048d4c                           // leaq	(%rbx,%rsi,8), %r8
+	WORD $0xf631                               // xorl	%esi, %esi
+
+BB0_7:
+	LONG $0x107dc1c4; WORD $0x302c // vmovupd	(%r8,%rsi), %ymm5
+	LONG $0x5955c1c4; WORD $0x3114 // vmulpd	(%r9,%rsi), %ymm5, %ymm2
+	LONG $0x20c68348               // addq	$32, %rsi
+	LONG $0xc258fbc5               // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xda15e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm3
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f3c5               // vaddsd	%xmm3, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xd6       // cmpq	%r10, %rsi
+	JNE  BB0_7
+	LONG $0x247c8348; WORD $0x0028 // cmpq	$0, 40(%rsp)
+	JE   BB0_5
+	LONG $0x24748b48; BYTE $0x10   // movq	16(%rsp), %rsi
+	WORD $0x894d; BYTE $0xfe       // movq	%r15, %r14
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	WORD $0x014c; BYTE $0xfe       // addq	%r15, %rsi
+
+BB0_6:
+	WORD $0x294c; BYTE $0xc7       // subq	%r8, %rdi
+	LONG $0x01ff8348               // cmpq	$1, %rdi
+	JE   BB0_9
+	LONG $0x1e248d4f               // leaq	(%r14,%r11), %r12
+	WORD $0x014d; BYTE $0xc4       // addq	%r8, %r12
+	WORD $0x014d; BYTE $0xf0       // addq	%r14, %r8
+	LONG $0x1079a1c4; WORD $0xc00c // vmovupd	(%rax,%r8,8), %xmm1
+	LONG $0x5971a1c4; WORD $0xe30c // vmulpd	(%rbx,%r12,8), %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0x01c7f640               // testb	$1, %dil
+	JE   BB0_5
+	LONG $0xfee78348               // andq	$-2, %rdi
+	WORD $0x0148; BYTE $0xfe       // addq	%rdi, %rsi
+
+BB0_9:
+	LONG $0x3410fbc5; BYTE $0xf2   // vmovsd	(%rdx,%rsi,8), %xmm6
+	LONG $0xb9c9e2c4; WORD $0xf004 // vfmadd231sd	(%rax,%rsi,8), %xmm6, %xmm0
+
+BB0_5:
+	LONG $0x247c8b48; BYTE $0x30   // movq	48(%rsp), %rdi
+	WORD $0x0149; BYTE $0xcb       // addq	%rcx, %r11
+	LONG $0x117ba1c4; WORD $0xef04 // vmovsd	%xmm0, (%rdi,%r13,8)
+	LONG $0x01c58349               // addq	$1, %r13
+	LONG $0x246c394c; BYTE $0x38   // cmpq	%r13, 56(%rsp)
+	JG   BB0_11
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	LONG $0xb0658d48               // leaq	-80(%rbp), %rsp
+	RET
+
+BB0_3:
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x8948; BYTE $0xcf // movq	%rcx, %rdi
+	WORD $0x3145; BYTE $0xf6 // xorl	%r14d, %r14d
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	WORD $0xf631             // xorl	%esi, %esi
+	JMP  BB0_6
+
+BB0_12:
+	WORD $0x894d; BYTE $0xfe // movq	%r15, %r14
+	WORD $0x894c; BYTE $0xfe // movq	%r15, %rsi
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_6
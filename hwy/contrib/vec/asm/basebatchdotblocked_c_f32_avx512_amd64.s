@@ -0,0 +1,713 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basebatchdotblocked_c_f32_avx512_amd64.c
+
+TEXT ·batchdotblocked_c_f32_avx512(SB), $80-64
+	MOVQ query+0(FP), DI
+	MOVQ data+8(FP), SI
+	MOVQ dots+16(FP), DX
+	MOVQ pcount+24(FP), CX
+	MOVQ pdims+32(FP), R8
+	MOVQ plen_query+40(FP), R9
+	MOVQ plen_data+48(FP), R11
+	MOVQ R11, 64(SP)
+	MOVQ plen_dots+56(FP), R11
+	MOVQ R11, 72(SP)
+	WORD $0x8b4c; BYTE $0x19             // movq	(%rcx), %r11
+	WORD $0x8948; BYTE $0xd0             // movq	%rdx, %rax
+	WORD $0x8b49; BYTE $0x10             // movq	(%r8), %rdx
+	WORD $0x854d; BYTE $0xdb             // testq	%r11, %r11
+	JLE  BB0_50
+	WORD $0x8548; BYTE $0xd2             // testq	%rdx, %rdx
+	JLE  BB0_50
+	WORD $0x8949; BYTE $0xf2             // movq	%rsi, %r10
+	WORD $0x894c; BYTE $0xde             // movq	%r11, %rsi
+	LONG $0xf2af0f48                     // imulq	%rdx, %rsi
+	LONG $0x246c8d48; BYTE $0x30         // leaq	48(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x40         // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348                     // andq	$-64, %rsp
+	LONG $0x80c48348                     // addq	$-128, %rsp
+	LONG $0x104d8b48                     // movq	16(%rbp), %rcx
+	WORD $0x3b48; BYTE $0x31             // cmpq	(%rcx), %rsi
+	JG   BB0_48
+	LONG $0x184d8b48                     // movq	24(%rbp), %rcx
+	WORD $0x3b4c; BYTE $0x19             // cmpq	(%rcx), %r11
+	JG   BB0_48
+	WORD $0x3b49; BYTE $0x11             // cmpq	(%r9), %rdx
+	JG   BB0_48
+	WORD $0x8949; BYTE $0xfe             // movq	%rdi, %r14
+	LONG $0x03fb8349                     // cmpq	$3, %r11
+	JLE  BB0_26
+	LONG $0xfc4b8d49                     // leaq	-4(%r11), %rcx
+	LONG $0xf0428d4c                     // leaq	-16(%rdx), %r8
+	WORD $0x8948; BYTE $0xd7             // movq	%rdx, %rdi
+	LONG $0x24448948; BYTE $0x48         // movq	%rax, 72(%rsp)
+	LONG $0x02e9c148                     // shrq	$2, %rcx
+	LONG $0x245c894c; BYTE $0x20         // movq	%r11, 32(%rsp)
+	LONG $0x04e7c148                     // salq	$4, %rdi
+	WORD $0x894d; BYTE $0xf7             // movq	%r14, %r15
+	WORD $0x8949; BYTE $0xc9             // movq	%rcx, %r9
+	LONG $0x04e1c148                     // salq	$4, %rcx
+	LONG $0x24448948; BYTE $0x10         // movq	%rax, 16(%rsp)
+	QUAD $0x00000000951c8d48             // leaq	0(,%rdx,4), %rbx
+	LONG $0x084c8d48; BYTE $0x10         // leaq	16(%rax,%rcx), %rcx
+	LONG $0x08fde162; WORD $0xe36e       // vmovq	%rbx, %xmm20
+	LONG $0x244c894c; BYTE $0x18         // movq	%r9, 24(%rsp)
+	LONG $0x121c8d48                     // leaq	(%rdx,%rdx), %rbx
+	LONG $0x08fde162; WORD $0xf96e       // vmovq	%rcx, %xmm23
+	WORD $0x894c; BYTE $0xc1             // movq	%r8, %rcx
+	LONG $0x2444894c; BYTE $0x08         // movq	%r8, 8(%rsp)
+	LONG $0xd2348d49                     // leaq	(%r10,%rdx,8), %rsi
+	LONG $0xf0e18348                     // andq	$-16, %rcx
+	LONG $0x245c8948; BYTE $0x70         // movq	%rbx, 112(%rsp)
+	WORD $0x0148; BYTE $0xd3             // addq	%rdx, %rbx
+	LONG $0x10c18348                     // addq	$16, %rcx
+	LONG $0x247c8948; BYTE $0x30         // movq	%rdi, 48(%rsp)
+	WORD $0x894c; BYTE $0xd7             // movq	%r10, %rdi
+	LONG $0x6ef961c4; BYTE $0xd3         // vmovq	%rbx, %xmm10
+	LONG $0x244c8948; BYTE $0x28         // movq	%rcx, 40(%rsp)
+	QUAD $0x000000782444c748; BYTE $0x00 // movq	$0, 120(%rsp)
+
+BB0_15:
+	LONG $0x24448b48; BYTE $0x78   // movq	120(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x24448948; BYTE $0x68   // movq	%rax, 104(%rsp)
+	LONG $0x08fde162; WORD $0xe07e // vmovq	%xmm20, %rax
+	LONG $0x072c8d4c               // leaq	(%rdi,%rax), %r13
+	LONG $0x24448b48; BYTE $0x70   // movq	112(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x24448948; BYTE $0x60   // movq	%rax, 96(%rsp)
+	LONG $0x08fde162; WORD $0xe07e // vmovq	%xmm20, %rax
+	LONG $0x061c8d48               // leaq	(%rsi,%rax), %rbx
+	LONG $0x0ffa8348               // cmpq	$15, %rdx
+	JLE  BB0_27
+	LONG $0xe457d8c5               // vxorps	%xmm4, %xmm4, %xmm4
+	LONG $0x000010b8; BYTE $0x00   // movl	$16, %eax
+	LONG $0x487cf162; WORD $0xcc28 // vmovaps	%zmm4, %zmm1
+	LONG $0x487cf162; WORD $0xd428 // vmovaps	%zmm4, %zmm2
+	LONG $0x487cf162; WORD $0xdc28 // vmovaps	%zmm4, %zmm3
+
+BB0_7:
+	QUAD $0xff874410487cd162     // vmovups	-64(%r15,%rax,4), %zmm0
+	QUAD $0xff875cb8487df262     // vfmadd231ps	-64(%rdi,%rax,4), %zmm0, %zmm3
+	QUAD $0xff8554b8487dd262     // vfmadd231ps	-64(%r13,%rax,4), %zmm0, %zmm2
+	QUAD $0xff864cb8487df262     // vfmadd231ps	-64(%rsi,%rax,4), %zmm0, %zmm1
+	QUAD $0xff8364b8487df262     // vfmadd231ps	-64(%rbx,%rax,4), %zmm0, %zmm4
+	LONG $0x10c08348             // addq	$16, %rax
+	WORD $0x3948; BYTE $0xd0     // cmpq	%rdx, %rax
+	JLE  BB0_7
+	LONG $0x244c8b48; BYTE $0x28 // movq	40(%rsp), %rcx
+
+BB0_6:
+	LONG $0x48fdf362; WORD $0xd81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm3, %ymm0
+	LONG $0xc358fcc5                           // vaddps	%ymm3, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c3             // vextractf128	$0x1, %ymm0, %xmm3
+	LONG $0xd858e0c5                           // vaddps	%xmm0, %xmm3, %xmm3
+	LONG $0x0479e3c4; WORD $0x4ec3             // vpermilps	$78, %xmm3, %xmm0
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0x48fdf362; WORD $0xd31b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm3
+	LONG $0xd258e4c5                           // vaddps	%ymm2, %ymm3, %ymm2
+	LONG $0xd82878c5                           // vmovaps	%xmm0, %xmm11
+	LONG $0xc0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01d3             // vextractf128	$0x1, %ymm2, %xmm3
+	LONG $0xd85822c5                           // vaddss	%xmm0, %xmm11, %xmm11
+	LONG $0xd258e0c5                           // vaddps	%xmm2, %xmm3, %xmm2
+	LONG $0x0479e3c4; WORD $0x4eda             // vpermilps	$78, %xmm2, %xmm3
+	LONG $0xda58e0c5                           // vaddps	%xmm2, %xmm3, %xmm3
+	LONG $0x48fdf362; WORD $0xca1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm2
+	LONG $0xc958ecc5                           // vaddps	%ymm1, %ymm2, %ymm1
+	LONG $0xc328f8c5                           // vmovaps	%xmm3, %xmm0
+	LONG $0xdbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm3
+	LONG $0x197de3c4; WORD $0x01ca             // vextractf128	$0x1, %ymm1, %xmm2
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc958e8c5                           // vaddps	%xmm1, %xmm2, %xmm1
+	LONG $0xd81420c5                           // vunpcklps	%xmm0, %xmm11, %xmm11
+	LONG $0x0479e3c4; WORD $0x4ed1             // vpermilps	$78, %xmm1, %xmm2
+	LONG $0xd158e8c5                           // vaddps	%xmm1, %xmm2, %xmm2
+	LONG $0x48fdf362; WORD $0xe11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm1
+	LONG $0xe458f4c5                           // vaddps	%ymm4, %ymm1, %ymm4
+	LONG $0xda28f8c5                           // vmovaps	%xmm2, %xmm3
+	LONG $0xd2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01e1             // vextractf128	$0x1, %ymm4, %xmm1
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xe458f0c5                           // vaddps	%xmm4, %xmm1, %xmm4
+	LONG $0x0479e3c4; WORD $0x4ecc             // vpermilps	$78, %xmm4, %xmm1
+	LONG $0xcc58f0c5                           // vaddps	%xmm4, %xmm1, %xmm1
+	LONG $0xd128f8c5                           // vmovaps	%xmm1, %xmm2
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xd214e0c5                           // vunpcklps	%xmm2, %xmm3, %xmm2
+	LONG $0xda1620c5                           // vmovlhps	%xmm2, %xmm11, %xmm11
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_8
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x244c8948; BYTE $0x50               // movq	%rcx, 80(%rsp)
+	WORD $0x2948; BYTE $0xc8                   // subq	%rcx, %rax
+	LONG $0x24448948; BYTE $0x58               // movq	%rax, 88(%rsp)
+	LONG $0x01e88348                           // subq	$1, %rax
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_28
+	LONG $0x245c8b4c; BYTE $0x78               // movq	120(%rsp), %r11
+	LONG $0x244c8b4c; BYTE $0x68               // movq	104(%rsp), %r9
+	LONG $0x2454894c; BYTE $0x38               // movq	%r10, 56(%rsp)
+	LONG $0x8f348d4d                           // leaq	(%r15,%rcx,4), %r14
+	LONG $0x19048d4a                           // leaq	(%rcx,%r11), %rax
+	LONG $0x245c8b4c; BYTE $0x70               // movq	112(%rsp), %r11
+	LONG $0x82048d4d                           // leaq	(%r10,%rax,4), %r8
+	LONG $0x09048d4a                           // leaq	(%rcx,%r9), %rax
+	LONG $0x244c8b4c; BYTE $0x60               // movq	96(%rsp), %r9
+	LONG $0x82248d4d                           // leaq	(%r10,%rax,4), %r12
+	LONG $0x19048d4a                           // leaq	(%rcx,%r11), %rax
+	LONG $0x821c8d4d                           // leaq	(%r10,%rax,4), %r11
+	LONG $0x09048d4a                           // leaq	(%rcx,%r9), %rax
+	LONG $0x820c8d4d                           // leaq	(%r10,%rax,4), %r9
+	LONG $0x24448b48; BYTE $0x58               // movq	88(%rsp), %rax
+	WORD $0x8949; BYTE $0xf2                   // movq	%rsi, %r10
+	WORD $0x8948; BYTE $0xd6                   // movq	%rdx, %rsi
+	LONG $0x04e8c148                           // shrq	$4, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	LONG $0x24448948; BYTE $0x40               // movq	%rax, 64(%rsp)
+	LONG $0x24548b48; BYTE $0x40               // movq	64(%rsp), %rdx
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_10:
+	LONG $0x487cd162; WORD $0x0c10; BYTE $0x06 // vmovups	(%r14,%rax), %zmm1
+	LONG $0x4874d162; WORD $0x1459; BYTE $0x00 // vmulps	(%r8,%rax), %zmm1, %zmm2
+	LONG $0x4874d162; WORD $0x2c59; BYTE $0x04 // vmulps	(%r12,%rax), %zmm1, %zmm5
+	LONG $0x4874d162; WORD $0x1c59; BYTE $0x03 // vmulps	(%r11,%rax), %zmm1, %zmm3
+	LONG $0x4874d162; WORD $0x0c59; BYTE $0x01 // vmulps	(%r9,%rax), %zmm1, %zmm1
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0xf2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm6
+	LONG $0x286df362; WORD $0xe203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm4
+	LONG $0xedc650c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm13
+	LONG $0xc514e8c5                           // vunpcklps	%xmm5, %xmm2, %xmm0
+	LONG $0x08546162; WORD $0xc5c6; BYTE $0xff // vshufps	$255, %xmm5, %xmm5, %xmm24
+	LONG $0x084c9162; WORD $0xf014             // vunpcklps	%xmm24, %xmm6, %xmm6
+	LONG $0xe3c660c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm12
+	LONG $0xc3c660c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm8
+	LONG $0x2855e362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm21
+	LONG $0x08746162; WORD $0xc9c6; BYTE $0xff // vshufps	$255, %xmm1, %xmm1, %xmm25
+	LONG $0x2865f362; WORD $0xfb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm7
+	LONG $0xc91460c5                           // vunpcklps	%xmm1, %xmm3, %xmm9
+	LONG $0x083c1162; WORD $0xc114             // vunpcklps	%xmm25, %xmm8, %xmm8
+	LONG $0x2875e362; WORD $0xf103; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm22
+	LONG $0x1678c1c4; BYTE $0xc1               // vmovlhps	%xmm9, %xmm0, %xmm0
+	LONG $0xcac668c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm9
+	LONG $0x143041c4; BYTE $0xcd               // vunpcklps	%xmm13, %xmm9, %xmm9
+	LONG $0x5878c1c4; BYTE $0xc3               // vaddps	%xmm11, %xmm0, %xmm0
+	LONG $0xed1550c5                           // vunpckhps	%xmm5, %xmm5, %xmm13
+	LONG $0xd9c670c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm11
+	LONG $0x141841c4; BYTE $0xe3               // vunpcklps	%xmm11, %xmm12, %xmm12
+	LONG $0x163041c4; BYTE $0xcc               // vmovlhps	%xmm12, %xmm9, %xmm9
+	LONG $0xd91570c5                           // vunpckhps	%xmm1, %xmm1, %xmm11
+	LONG $0xe31560c5                           // vunpckhps	%xmm3, %xmm3, %xmm12
+	LONG $0x141841c4; BYTE $0xe3               // vunpcklps	%xmm11, %xmm12, %xmm12
+	LONG $0x1648c1c4; BYTE $0xf0               // vmovlhps	%xmm8, %xmm6, %xmm6
+	LONG $0x287dd362; WORD $0xe819; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm8
+	LONG $0x5878c1c4; BYTE $0xc1               // vaddps	%xmm9, %xmm0, %xmm0
+	LONG $0xca1568c5                           // vunpckhps	%xmm2, %xmm2, %xmm9
+	LONG $0x085cb162; WORD $0xe514             // vunpcklps	%xmm21, %xmm4, %xmm4
+	LONG $0x143041c4; BYTE $0xcd               // vunpcklps	%xmm13, %xmm9, %xmm9
+	LONG $0x163041c4; BYTE $0xcc               // vmovlhps	%xmm12, %xmm9, %xmm9
+	LONG $0x0844b162; WORD $0xfe14             // vunpcklps	%xmm22, %xmm7, %xmm7
+	LONG $0x587841c4; BYTE $0xd9               // vaddps	%xmm9, %xmm0, %xmm11
+	LONG $0xe716d8c5                           // vmovlhps	%xmm7, %xmm4, %xmm4
+	LONG $0x287dd362; WORD $0xc919; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm9
+	LONG $0x287df362; WORD $0xd019; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm0
+	LONG $0xde5820c5                           // vaddps	%xmm6, %xmm11, %xmm11
+	LONG $0x287df362; WORD $0xde19; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm6
+	LONG $0x1478c1c4; BYTE $0xc0               // vunpcklps	%xmm8, %xmm0, %xmm0
+	LONG $0x28557362; WORD $0xc503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm8
+	LONG $0x1448c1c4; BYTE $0xf1               // vunpcklps	%xmm9, %xmm6, %xmm6
+	LONG $0x28757362; WORD $0xc903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm9
+	LONG $0xc616f8c5                           // vmovlhps	%xmm6, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xf303; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm6
+	LONG $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	LONG $0x286df362; WORD $0xc203; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm0
+	LONG $0x1448c1c4; BYTE $0xf1               // vunpcklps	%xmm9, %xmm6, %xmm6
+	LONG $0x28757362; WORD $0xc903; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm9
+	LONG $0x1478c1c4; BYTE $0xc0               // vunpcklps	%xmm8, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xc91b; BYTE $0x01 // vextractf32x8	$0x1, %zmm1, %ymm1
+	LONG $0x28557362; WORD $0xc503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm8
+	LONG $0xc616f8c5                           // vmovlhps	%xmm6, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xed1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm5, %ymm5
+	LONG $0xe9c670c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm13
+	LONG $0x2865f362; WORD $0xf303; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm6
+	LONG $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	LONG $0x487df362; WORD $0xdb1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm3, %ymm3
+	LONG $0xe5c650c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm12
+	LONG $0x286df362; WORD $0xc203; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm0
+	LONG $0x487df362; WORD $0xd21b; BYTE $0x01 // vextractf32x8	$0x1, %zmm2, %ymm2
+	LONG $0xf914e0c5                           // vunpcklps	%xmm1, %xmm3, %xmm7
+	LONG $0x1448c1c4; BYTE $0xf1               // vunpcklps	%xmm9, %xmm6, %xmm6
+	LONG $0xc9c670c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm9
+	LONG $0x1478c1c4; BYTE $0xc0               // vunpcklps	%xmm8, %xmm0, %xmm0
+	LONG $0xc5c650c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm8
+	LONG $0xc616f8c5                           // vmovlhps	%xmm6, %xmm0, %xmm0
+	LONG $0xf514e8c5                           // vunpcklps	%xmm5, %xmm2, %xmm6
+	LONG $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	LONG $0xf716c8c5                           // vmovlhps	%xmm7, %xmm6, %xmm6
+	LONG $0xfbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm7
+	LONG $0x1440c1c4; BYTE $0xfd               // vunpcklps	%xmm13, %xmm7, %xmm7
+	LONG $0xe91570c5                           // vunpckhps	%xmm1, %xmm1, %xmm13
+	LONG $0xc2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm0
+	LONG $0x1478c1c4; BYTE $0xc0               // vunpcklps	%xmm8, %xmm0, %xmm0
+	LONG $0xdc5820c5                           // vaddps	%xmm4, %xmm11, %xmm11
+	LONG $0xe3c6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm4
+	LONG $0x1458c1c4; BYTE $0xe1               // vunpcklps	%xmm9, %xmm4, %xmm4
+	LONG $0xc416f8c5                           // vmovlhps	%xmm4, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xd419; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm4
+	LONG $0xde5820c5                           // vaddps	%xmm6, %xmm11, %xmm11
+	LONG $0xf2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm6
+	LONG $0x1448c1c4; BYTE $0xf4               // vunpcklps	%xmm12, %xmm6, %xmm6
+	LONG $0xe51550c5                           // vunpckhps	%xmm5, %xmm5, %xmm12
+	LONG $0xf716c8c5                           // vmovlhps	%xmm7, %xmm6, %xmm6
+	LONG $0xfb15e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm7
+	LONG $0x1440c1c4; BYTE $0xfd               // vunpcklps	%xmm13, %xmm7, %xmm7
+	LONG $0xde5820c5                           // vaddps	%xmm6, %xmm11, %xmm11
+	LONG $0xf215e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm6
+	LONG $0x1448c1c4; BYTE $0xf4               // vunpcklps	%xmm12, %xmm6, %xmm6
+	LONG $0xf716c8c5                           // vmovlhps	%xmm7, %xmm6, %xmm6
+	LONG $0x287df362; WORD $0xcf19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm7
+	LONG $0xde5820c5                           // vaddps	%xmm6, %xmm11, %xmm11
+	LONG $0x287df362; WORD $0xee19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm6
+	LONG $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	LONG $0x287df362; WORD $0xd819; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm0
+	LONG $0xe614d8c5                           // vunpcklps	%xmm6, %xmm4, %xmm4
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm6
+	LONG $0xc714f8c5                           // vunpcklps	%xmm7, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xf903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm7
+	LONG $0xe016d8c5                           // vmovlhps	%xmm0, %xmm4, %xmm4
+	LONG $0x286df362; WORD $0xc203; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm0
+	LONG $0xdc5820c5                           // vaddps	%xmm4, %xmm11, %xmm11
+	LONG $0x2865f362; WORD $0xe303; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm4
+	LONG $0xc614f8c5                           // vunpcklps	%xmm6, %xmm0, %xmm0
+	LONG $0x2855f362; WORD $0xf503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm6
+	LONG $0xe714d8c5                           // vunpcklps	%xmm7, %xmm4, %xmm4
+	LONG $0x2875f362; WORD $0xf903; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm7
+	LONG $0xc416f8c5                           // vmovlhps	%xmm4, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xe303; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm4
+	LONG $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	LONG $0x286df362; WORD $0xc203; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm0
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0x286df362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm2
+	LONG $0x2865f362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm3
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xe714d8c5                           // vunpcklps	%xmm7, %xmm4, %xmm4
+	LONG $0xc614f8c5                           // vunpcklps	%xmm6, %xmm0, %xmm0
+	LONG $0xc416f8c5                           // vmovlhps	%xmm4, %xmm0, %xmm0
+	LONG $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	LONG $0xd514e8c5                           // vunpcklps	%xmm5, %xmm2, %xmm2
+	LONG $0xc914e0c5                           // vunpcklps	%xmm1, %xmm3, %xmm1
+	LONG $0xd116e8c5                           // vmovlhps	%xmm1, %xmm2, %xmm2
+	LONG $0xda5820c5                           // vaddps	%xmm2, %xmm11, %xmm11
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JNE  BB0_10
+	LONG $0x24748b4c; BYTE $0x58               // movq	88(%rsp), %r14
+	WORD $0x8948; BYTE $0xf2                   // movq	%rsi, %rdx
+	WORD $0x894c; BYTE $0xd6                   // movq	%r10, %rsi
+	LONG $0x24548b4c; BYTE $0x38               // movq	56(%rsp), %r10
+	WORD $0x894c; BYTE $0xf0                   // movq	%r14, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x0fe68341                           // andl	$15, %r14d
+	JE   BB0_8
+
+BB0_9:
+	LONG $0x24448b4c; BYTE $0x58               // movq	88(%rsp), %r8
+	WORD $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG $0xff708d4d                           // leaq	-1(%r8), %r14
+	LONG $0x06fe8349                           // cmpq	$6, %r14
+	JBE  BB0_13
+	LONG $0x245c8b4c; BYTE $0x50               // movq	80(%rsp), %r11
+	LONG $0x244c8b4c; BYTE $0x78               // movq	120(%rsp), %r9
+	LONG $0x24748b4c; BYTE $0x68               // movq	104(%rsp), %r14
+	WORD $0x0149; BYTE $0xc3                   // addq	%rax, %r11
+	WORD $0x014d; BYTE $0xd9                   // addq	%r11, %r9
+	LONG $0x107c81c4; WORD $0x9f14             // vmovups	(%r15,%r11,4), %ymm2
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	LONG $0x596c81c4; WORD $0x8a0c             // vmulps	(%r10,%r9,4), %ymm2, %ymm1
+	LONG $0x330c8d4f                           // leaq	(%r11,%r14), %r9
+	LONG $0x245c8b4c; BYTE $0x70               // movq	112(%rsp), %r11
+	LONG $0x596c81c4; WORD $0x8a34             // vmulps	(%r10,%r9,4), %ymm2, %ymm6
+	LONG $0x244c8b4c; BYTE $0x60               // movq	96(%rsp), %r9
+	WORD $0x0149; BYTE $0xc3                   // addq	%rax, %r11
+	LONG $0x596c81c4; WORD $0x9a24             // vmulps	(%r10,%r11,4), %ymm2, %ymm4
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+	LONG $0x596cc1c4; WORD $0x8214             // vmulps	(%r10,%rax,4), %ymm2, %ymm2
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	LONG $0xd9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm3
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	LONG $0xc614f0c5                           // vunpcklps	%xmm6, %xmm1, %xmm0
+	LONG $0x084ce162; WORD $0xc6c6; BYTE $0x55 // vshufps	$85, %xmm6, %xmm6, %xmm16
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0x07e08341                           // andl	$7, %r8d
+	LONG $0xccc658c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm9
+	LONG $0xecc6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm5
+	LONG $0x287df362; WORD $0xf719; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm7
+	LONG $0xc21458c5                           // vunpcklps	%xmm2, %xmm4, %xmm8
+	LONG $0xf2c668c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm14
+	LONG $0x1450c1c4; BYTE $0xee               // vunpcklps	%xmm14, %xmm5, %xmm5
+	LONG $0x1678c1c4; BYTE $0xc0               // vmovlhps	%xmm8, %xmm0, %xmm0
+	LONG $0xc1c670c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm8
+	LONG $0x083c3162; WORD $0xc014             // vunpcklps	%xmm16, %xmm8, %xmm8
+	LONG $0x086ce162; WORD $0xc215             // vunpckhps	%xmm2, %xmm2, %xmm16
+	LONG $0x5878c1c4; BYTE $0xc3               // vaddps	%xmm11, %xmm0, %xmm0
+	LONG $0xdac668c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm11
+	LONG $0x143041c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm9, %xmm9
+	LONG $0xde1548c5                           // vunpckhps	%xmm6, %xmm6, %xmm11
+	LONG $0x163841c4; BYTE $0xc1               // vmovlhps	%xmm9, %xmm8, %xmm8
+	LONG $0xcc1558c5                           // vunpckhps	%xmm4, %xmm4, %xmm9
+	LONG $0xdd16e0c5                           // vmovlhps	%xmm5, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xe519; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm5
+	LONG $0x08343162; WORD $0xc814             // vunpcklps	%xmm16, %xmm9, %xmm9
+	LONG $0x5878c1c4; BYTE $0xc0               // vaddps	%xmm8, %xmm0, %xmm0
+	LONG $0xc11570c5                           // vunpckhps	%xmm1, %xmm1, %xmm8
+	LONG $0x143841c4; BYTE $0xc3               // vunpcklps	%xmm11, %xmm8, %xmm8
+	LONG $0x286d7362; WORD $0xda03; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm11
+	LONG $0x163841c4; BYTE $0xc1               // vmovlhps	%xmm9, %xmm8, %xmm8
+	LONG $0x5878c1c4; BYTE $0xc0               // vaddps	%xmm8, %xmm0, %xmm0
+	LONG $0x287dd362; WORD $0xd019; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm8
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xcb19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm3
+	LONG $0x1450c1c4; BYTE $0xe8               // vunpcklps	%xmm8, %xmm5, %xmm5
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm7
+	LONG $0xdd16e0c5                           // vmovlhps	%xmm5, %xmm3, %xmm3
+	LONG $0x285df362; WORD $0xec03; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm5
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm3
+	LONG $0x1450c1c4; BYTE $0xeb               // vunpcklps	%xmm11, %xmm5, %xmm5
+	LONG $0x286d7362; WORD $0xda03; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm11
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm7
+	LONG $0xdd16e0c5                           // vmovlhps	%xmm5, %xmm3, %xmm3
+	LONG $0x285df362; WORD $0xec03; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm5
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm3
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0x285df362; WORD $0xe403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm4
+	LONG $0x286df362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm2
+	LONG $0x1450c1c4; BYTE $0xeb               // vunpcklps	%xmm11, %xmm5, %xmm5
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0xdd16e0c5                           // vmovlhps	%xmm5, %xmm3, %xmm3
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xce14f0c5                           // vunpcklps	%xmm6, %xmm1, %xmm1
+	LONG $0xd214d8c5                           // vunpcklps	%xmm2, %xmm4, %xmm2
+	LONG $0xca16f0c5                           // vmovlhps	%xmm2, %xmm1, %xmm1
+	LONG $0xd95878c5                           // vaddps	%xmm1, %xmm0, %xmm11
+	JE   BB0_8
+
+BB0_13:
+	LONG $0x0c10fac5; BYTE $0x8e               // vmovss	(%rsi,%rcx,4), %xmm1
+	LONG $0x0410fac5; BYTE $0x8f               // vmovss	(%rdi,%rcx,4), %xmm0
+	LONG $0x01418d4c                           // leaq	1(%rcx), %r8
+	QUAD $0x000000008d048d48                   // leaq	0(,%rcx,4), %rax
+	LONG $0x2171e3c4; WORD $0x8b0c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rcx,4), %xmm1, %xmm1
+	QUAD $0x10008d442179c3c4                   // vinsertps	$0x10, 0(%r13,%rcx,4), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	LONG $0x187d5262; WORD $0x1cb8; BYTE $0x8f // vfmadd231ps	(%r15,%rcx,4){1to4}, %xmm0, %xmm11
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_8
+	LONG $0x4c10fac5; WORD $0x0430             // vmovss	4(%rax,%rsi), %xmm1
+	LONG $0x4410fac5; WORD $0x0438             // vmovss	4(%rax,%rdi), %xmm0
+	LONG $0x02418d4c                           // leaq	2(%rcx), %r8
+	QUAD $0x1004034c2171e3c4                   // vinsertps	$0x10, 4(%rbx,%rax), %xmm1, %xmm1
+	QUAD $0x100405442179c3c4                   // vinsertps	$0x10, 4(%r13,%rax), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	QUAD $0x01075cb8187d5262                   // vfmadd231ps	4(%r15,%rax){1to4}, %xmm0, %xmm11
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_8
+	LONG $0x4c10fac5; WORD $0x0830             // vmovss	8(%rax,%rsi), %xmm1
+	LONG $0x4410fac5; WORD $0x0838             // vmovss	8(%rax,%rdi), %xmm0
+	LONG $0x03418d4c                           // leaq	3(%rcx), %r8
+	QUAD $0x1008034c2171e3c4                   // vinsertps	$0x10, 8(%rbx,%rax), %xmm1, %xmm1
+	QUAD $0x100805442179c3c4                   // vinsertps	$0x10, 8(%r13,%rax), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	QUAD $0x02075cb8187d5262                   // vfmadd231ps	8(%r15,%rax){1to4}, %xmm0, %xmm11
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_8
+	LONG $0x4c10fac5; WORD $0x0c30             // vmovss	12(%rax,%rsi), %xmm1
+	LONG $0x4410fac5; WORD $0x0c38             // vmovss	12(%rax,%rdi), %xmm0
+	LONG $0x04418d4c                           // leaq	4(%rcx), %r8
+	QUAD $0x100c034c2171e3c4                   // vinsertps	$0x10, 12(%rbx,%rax), %xmm1, %xmm1
+	QUAD $0x100c05442179c3c4                   // vinsertps	$0x10, 12(%r13,%rax), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	QUAD $0x03075cb8187d5262                   // vfmadd231ps	12(%r15,%rax){1to4}, %xmm0, %xmm11
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_8
+	LONG $0x4c10fac5; WORD $0x1030             // vmovss	16(%rax,%rsi), %xmm1
+	LONG $0x4410fac5; WORD $0x1038             // vmovss	16(%rax,%rdi), %xmm0
+	LONG $0x05418d4c                           // leaq	5(%rcx), %r8
+	QUAD $0x1010034c2171e3c4                   // vinsertps	$0x10, 16(%rbx,%rax), %xmm1, %xmm1
+	QUAD $0x101005442179c3c4                   // vinsertps	$0x10, 16(%r13,%rax), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	QUAD $0x04075cb8187d5262                   // vfmadd231ps	16(%r15,%rax){1to4}, %xmm0, %xmm11
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_8
+	LONG $0x4c10fac5; WORD $0x1430             // vmovss	20(%rax,%rsi), %xmm1
+	LONG $0x4410fac5; WORD $0x1438             // vmovss	20(%rax,%rdi), %xmm0
+	LONG $0x06c18348                           // addq	$6, %rcx
+	QUAD $0x1014034c2171e3c4                   // vinsertps	$0x10, 20(%rbx,%rax), %xmm1, %xmm1
+	QUAD $0x101405442179c3c4                   // vinsertps	$0x10, 20(%r13,%rax), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	QUAD $0x05075cb8187d5262                   // vfmadd231ps	20(%r15,%rax){1to4}, %xmm0, %xmm11
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_8
+	LONG $0x4c10fac5; WORD $0x1830             // vmovss	24(%rax,%rsi), %xmm1
+	LONG $0x4410fac5; WORD $0x1838             // vmovss	24(%rax,%rdi), %xmm0
+	QUAD $0x1018034c2171e3c4                   // vinsertps	$0x10, 24(%rbx,%rax), %xmm1, %xmm1
+	QUAD $0x101805442179c3c4                   // vinsertps	$0x10, 24(%r13,%rax), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	QUAD $0x06075cb8187d5262                   // vfmadd231ps	24(%r15,%rax){1to4}, %xmm0, %xmm11
+
+BB0_8:
+	LONG $0x245c8b48; BYTE $0x30   // movq	48(%rsp), %rbx
+	LONG $0x7ef961c4; BYTE $0xd1   // vmovq	%xmm10, %rcx
+	LONG $0x24448b48; BYTE $0x48   // movq	72(%rsp), %rax
+	WORD $0x0148; BYTE $0xdf       // addq	%rbx, %rdi
+	WORD $0x0148; BYTE $0xde       // addq	%rbx, %rsi
+	LONG $0x245c8b48; BYTE $0x68   // movq	104(%rsp), %rbx
+	LONG $0x10c08348               // addq	$16, %rax
+	LONG $0x581178c5; BYTE $0xf0   // vmovups	%xmm11, -16(%rax)
+	WORD $0x0148; BYTE $0xcb       // addq	%rcx, %rbx
+	LONG $0x24448948; BYTE $0x48   // movq	%rax, 72(%rsp)
+	LONG $0x245c8948; BYTE $0x78   // movq	%rbx, 120(%rsp)
+	LONG $0x245c8b48; BYTE $0x60   // movq	96(%rsp), %rbx
+	WORD $0x0148; BYTE $0xcb       // addq	%rcx, %rbx
+	LONG $0x245c8948; BYTE $0x70   // movq	%rbx, 112(%rsp)
+	LONG $0x08fde162; WORD $0xfb7e // vmovq	%xmm23, %rbx
+	WORD $0x3948; BYTE $0xd8       // cmpq	%rbx, %rax
+	JNE  BB0_15
+	LONG $0x244c8b4c; BYTE $0x18   // movq	24(%rsp), %r9
+	LONG $0x245c8b4c; BYTE $0x20   // movq	32(%rsp), %r11
+	WORD $0x894d; BYTE $0xfe       // movq	%r15, %r14
+	LONG $0x24448b48; BYTE $0x10   // movq	16(%rsp), %rax
+	LONG $0x24448b4c; BYTE $0x08   // movq	8(%rsp), %r8
+	QUAD $0x000000048d3c8d4a       // leaq	4(,%r9,4), %rdi
+	WORD $0x3949; BYTE $0xfb       // cmpq	%rdi, %r11
+	JLE  BB0_53
+
+BB0_5:
+	LONG $0xb8248d4c             // leaq	(%rax,%rdi,4), %r12
+	LONG $0x98048d4a             // leaq	(%rax,%r11,4), %rax
+	LONG $0x6ef9e1c4; BYTE $0xe0 // vmovq	%rax, %xmm4
+	LONG $0xfaaf0f48             // imulq	%rdx, %rdi
+	WORD $0x894c; BYTE $0xc0     // movq	%r8, %rax
+	LONG $0x04e8c148             // shrq	$4, %rax
+	LONG $0xfc6ff9c5             // vmovdqa	%xmm4, %xmm7
+	LONG $0x01708d48             // leaq	1(%rax), %rsi
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	WORD $0x8949; BYTE $0xf5     // movq	%rsi, %r13
+	LONG $0x06e6c148             // salq	$6, %rsi
+	LONG $0x04e5c149             // salq	$4, %r13
+	WORD $0x014c; BYTE $0xf6     // addq	%r14, %rsi
+	WORD $0x294c; BYTE $0xe8     // subq	%r13, %rax
+	LONG $0xff588d48             // leaq	-1(%rax), %rbx
+	WORD $0x8949; BYTE $0xc3     // movq	%rax, %r11
+	LONG $0x24448948; BYTE $0x68 // movq	%rax, 104(%rsp)
+	LONG $0x245c8948; BYTE $0x60 // movq	%rbx, 96(%rsp)
+	WORD $0x8948; BYTE $0xc3     // movq	%rax, %rbx
+	WORD $0xe083; BYTE $0x0f     // andl	$15, %eax
+	LONG $0x04ebc149             // shrq	$4, %r11
+	LONG $0xf0e38348             // andq	$-16, %rbx
+	LONG $0x24448948; BYTE $0x70 // movq	%rax, 112(%rsp)
+	LONG $0x06e3c149             // salq	$6, %r11
+	LONG $0x245c8948; BYTE $0x78 // movq	%rbx, 120(%rsp)
+
+BB0_25:
+	LONG $0xba3c8d4d             // leaq	(%r10,%rdi,4), %r15
+	LONG $0x0ffa8348             // cmpq	$15, %rdx
+	JLE  BB0_16
+	LONG $0xc057f8c5             // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x000010b8; BYTE $0x00 // movl	$16, %eax
+
+BB0_17:
+	QUAD $0xff866c10487cd162                   // vmovups	-64(%r14,%rax,4), %zmm5
+	QUAD $0xff8744b84855d262                   // vfmadd231ps	-64(%r15,%rax,4), %zmm5, %zmm0
+	LONG $0x10c08348                           // addq	$16, %rax
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JLE  BB0_17
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f4c5                           // vaddps	%ymm0, %ymm1, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc128f8c5                           // vmovaps	%xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xea                   // cmpq	%r13, %rdx
+	JLE  BB0_18
+	LONG $0x247c8348; WORD $0x0e60             // cmpq	$14, 96(%rsp)
+	LONG $0x24448b4c; BYTE $0x68               // movq	104(%rsp), %r8
+	JBE  BB0_29
+	LONG $0x2f048d4a                           // leaq	(%rdi,%r13), %rax
+	LONG $0x820c8d49                           // leaq	(%r10,%rax,4), %rcx
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_20:
+	LONG $0x487cf162; WORD $0x2c10; BYTE $0x01 // vmovups	(%rcx,%rax), %zmm5
+	LONG $0x4854f162; WORD $0x1459; BYTE $0x06 // vmulps	(%rsi,%rax), %zmm5, %zmm2
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0xcac6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xe2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm4
+	LONG $0x286df362; WORD $0xda03; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm3
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xc215e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x286df362; WORD $0xca03; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm1
+	LONG $0xe058dac5                           // vaddss	%xmm0, %xmm4, %xmm4
+	LONG $0x287df362; WORD $0xd019; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0x286df362; WORD $0xc203; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xd11b; BYTE $0x01 // vextractf32x8	$0x1, %zmm2, %ymm1
+	LONG $0xd115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm2
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm0
+	LONG $0xeb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm5
+	LONG $0xd9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xdd58e2c5                           // vaddss	%xmm5, %xmm3, %xmm3
+	LONG $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG $0xc058eac5                           // vaddss	%xmm0, %xmm2, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x2875f362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm0
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xd8                   // cmpq	%r11, %rax
+	JNE  BB0_20
+	LONG $0x24448b48; BYTE $0x78               // movq	120(%rsp), %rax
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	WORD $0x014c; BYTE $0xe8                   // addq	%r13, %rax
+	LONG $0x247c8348; WORD $0x0070             // cmpq	$0, 112(%rsp)
+	JE   BB0_18
+	WORD $0x894c; BYTE $0xeb                   // movq	%r13, %rbx
+
+BB0_19:
+	WORD $0x2949; BYTE $0xc8                   // subq	%rcx, %r8
+	LONG $0xff488d4d                           // leaq	-1(%r8), %r9
+	LONG $0x06f98349                           // cmpq	$6, %r9
+	JBE  BB0_23
+	LONG $0x1f0c8d4c                           // leaq	(%rdi,%rbx), %r9
+	WORD $0x0149; BYTE $0xc9                   // addq	%rcx, %r9
+	WORD $0x0148; BYTE $0xd9                   // addq	%rbx, %rcx
+	LONG $0x107cc1c4; WORD $0x8e0c             // vmovups	(%r14,%rcx,4), %ymm1
+	LONG $0x597481c4; WORD $0x8a0c             // vmulps	(%r10,%r9,4), %ymm1, %ymm1
+	WORD $0x894c; BYTE $0xc1                   // movq	%r8, %rcx
+	LONG $0xf8e18348                           // andq	$-8, %rcx
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x07e08341                           // andl	$7, %r8d
+	LONG $0xc058f2c5                           // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xe9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm5
+	LONG $0xd9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm3
+	LONG $0xe858d2c5                           // vaddss	%xmm0, %xmm5, %xmm5
+	LONG $0xc115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc558fac5                           // vaddss	%xmm5, %xmm0, %xmm0
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xc819; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm3
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0x2875f362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm0
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_18
+
+BB0_23:
+	LONG $0x01488d48                           // leaq	1(%rax), %rcx
+	LONG $0x107ac1c4; WORD $0x862c             // vmovss	(%r14,%rax,4), %xmm5
+	QUAD $0x0000000085048d4c                   // leaq	0(,%rax,4), %r8
+	LONG $0xb951c2c4; WORD $0x8704             // vfmadd231ss	(%r15,%rax,4), %xmm5, %xmm0
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JGE  BB0_18
+	LONG $0x02488d48                           // leaq	2(%rax), %rcx
+	LONG $0x107a81c4; WORD $0x066c; BYTE $0x04 // vmovss	4(%r14,%r8), %xmm5
+	LONG $0xb95182c4; WORD $0x0744; BYTE $0x04 // vfmadd231ss	4(%r15,%r8), %xmm5, %xmm0
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JGE  BB0_18
+	LONG $0x03488d48                           // leaq	3(%rax), %rcx
+	LONG $0x107a81c4; WORD $0x076c; BYTE $0x08 // vmovss	8(%r15,%r8), %xmm5
+	LONG $0xb95182c4; WORD $0x0644; BYTE $0x08 // vfmadd231ss	8(%r14,%r8), %xmm5, %xmm0
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JGE  BB0_18
+	LONG $0x04488d48                           // leaq	4(%rax), %rcx
+	LONG $0x107a81c4; WORD $0x066c; BYTE $0x0c // vmovss	12(%r14,%r8), %xmm5
+	LONG $0xb95182c4; WORD $0x0744; BYTE $0x0c // vfmadd231ss	12(%r15,%r8), %xmm5, %xmm0
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JGE  BB0_18
+	LONG $0x05488d48                           // leaq	5(%rax), %rcx
+	LONG $0x107a81c4; WORD $0x076c; BYTE $0x10 // vmovss	16(%r15,%r8), %xmm5
+	LONG $0xb95182c4; WORD $0x0644; BYTE $0x10 // vfmadd231ss	16(%r14,%r8), %xmm5, %xmm0
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_18
+	LONG $0x06c08348                           // addq	$6, %rax
+	LONG $0x107a81c4; WORD $0x076c; BYTE $0x14 // vmovss	20(%r15,%r8), %xmm5
+	LONG $0xb95182c4; WORD $0x0644; BYTE $0x14 // vfmadd231ss	20(%r14,%r8), %xmm5, %xmm0
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_18
+	LONG $0x107a81c4; WORD $0x076c; BYTE $0x18 // vmovss	24(%r15,%r8), %xmm5
+	LONG $0xb95182c4; WORD $0x0644; BYTE $0x18 // vfmadd231ss	24(%r14,%r8), %xmm5, %xmm0
+
+BB0_18:
+	LONG $0x117ac1c4; WORD $0x2404 // vmovss	%xmm0, (%r12)
+	LONG $0x7ef9e1c4; BYTE $0xf8   // vmovq	%xmm7, %rax
+	LONG $0x04c48349               // addq	$4, %r12
+	WORD $0x0148; BYTE $0xd7       // addq	%rdx, %rdi
+	WORD $0x3949; BYTE $0xc4       // cmpq	%rax, %r12
+	JNE  BB0_25
+
+BB0_53:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_48:
+	LONG $0xd0658d48 // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_27:
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	WORD $0xc931                   // xorl	%ecx, %ecx
+	LONG $0x48fdf162; WORD $0xd328 // vmovapd	%zmm3, %zmm2
+	LONG $0x48fdf162; WORD $0xcb28 // vmovapd	%zmm3, %zmm1
+	LONG $0x48fdf162; WORD $0xe328 // vmovapd	%zmm3, %zmm4
+	JMP  BB0_6
+
+BB0_28:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_9
+
+BB0_50:
+	RET
+
+BB0_16:
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x8949; BYTE $0xd0 // movq	%rdx, %r8
+	WORD $0xdb31             // xorl	%ebx, %ebx
+	WORD $0xc931             // xorl	%ecx, %ecx
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_19
+
+BB0_26:
+	WORD $0xff31     // xorl	%edi, %edi
+	LONG $0xf0428d4c // leaq	-16(%rdx), %r8
+	JMP  BB0_5
+
+BB0_29:
+	WORD $0x894c; BYTE $0xeb // movq	%r13, %rbx
+	WORD $0x894c; BYTE $0xe8 // movq	%r13, %rax
+	WORD $0xc931             // xorl	%ecx, %ecx
+	JMP  BB0_19
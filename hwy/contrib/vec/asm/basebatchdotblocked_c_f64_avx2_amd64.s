@@ -0,0 +1,407 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basebatchdotblocked_c_f64_avx2_amd64.c
+
+TEXT ·batchdotblocked_c_f64_avx2(SB), $208-64
+	MOVQ query+0(FP), DI
+	MOVQ data+8(FP), SI
+	MOVQ dots+16(FP), DX
+	MOVQ pcount+24(FP), CX
+	MOVQ pdims+32(FP), R8
+	MOVQ plen_query+40(FP), R9
+	MOVQ plen_data+48(FP), R11
+	MOVQ R11, 192(SP)
+	MOVQ plen_dots+56(FP), R11
+	MOVQ R11, 200(SP)
+	QUAD $0x000000b024ac8d48                   // leaq	176(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348                           // andq	$-32, %rsp
+	WORD $0x8b48; BYTE $0x01                   // movq	(%rcx), %rax
+	WORD $0x8b4d; BYTE $0x30                   // movq	(%r8), %r14
+	WORD $0x8548; BYTE $0xc0                   // testq	%rax, %rax
+	JLE  BB0_50
+	WORD $0x854d; BYTE $0xf6                   // testq	%r14, %r14
+	JLE  BB0_50
+	WORD $0x8949; BYTE $0xf4                   // movq	%rsi, %r12
+	WORD $0x8948; BYTE $0xd6                   // movq	%rdx, %rsi
+	LONG $0x10558b48                           // movq	16(%rbp), %rdx
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	LONG $0xceaf0f49                           // imulq	%r14, %rcx
+	WORD $0x3b48; BYTE $0x0a                   // cmpq	(%rdx), %rcx
+	JG   BB0_50
+	LONG $0x18558b48                           // movq	24(%rbp), %rdx
+	WORD $0x3b48; BYTE $0x02                   // cmpq	(%rdx), %rax
+	JG   BB0_50
+	WORD $0x3b4d; BYTE $0x31                   // cmpq	(%r9), %r14
+	JG   BB0_50
+	WORD $0x8949; BYTE $0xff                   // movq	%rdi, %r15
+	LONG $0x03f88348                           // cmpq	$3, %rax
+	JLE  BB0_22
+	WORD $0x894c; BYTE $0xf2                   // movq	%r14, %rdx
+	WORD $0x894c; BYTE $0xf3                   // movq	%r14, %rbx
+	LONG $0x24748948; BYTE $0x70               // movq	%rsi, 112(%rsp)
+	WORD $0x894d; BYTE $0xe3                   // movq	%r12, %r11
+	LONG $0x04e2c148                           // salq	$4, %rdx
+	LONG $0x05e3c148                           // salq	$5, %rbx
+	LONG $0x24448948; BYTE $0x20               // movq	%rax, 32(%rsp)
+	LONG $0x14148d4d                           // leaq	(%r12,%rdx), %r10
+	LONG $0xfc508d48                           // leaq	-4(%rax), %rdx
+	LONG $0x245c8948; BYTE $0x48               // movq	%rbx, 72(%rsp)
+	WORD $0x8948; BYTE $0xd1                   // movq	%rdx, %rcx
+	LONG $0x361c8d4b                           // leaq	(%r14,%r14), %rbx
+	LONG $0x24748948; BYTE $0x10               // movq	%rsi, 16(%rsp)
+	LONG $0x02e9c148                           // shrq	$2, %rcx
+	QUAD $0x00000090249c8948                   // movq	%rbx, 144(%rsp)
+	WORD $0x014c; BYTE $0xf3                   // addq	%r14, %rbx
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	LONG $0x244c8948; BYTE $0x18               // movq	%rcx, 24(%rsp)
+	LONG $0x05e2c148                           // salq	$5, %rdx
+	LONG $0x245c8948; BYTE $0x30               // movq	%rbx, 48(%rsp)
+	WORD $0x894c; BYTE $0xf3                   // movq	%r14, %rbx
+	LONG $0x167c8d48; BYTE $0x20               // leaq	32(%rsi,%rdx), %rdi
+	QUAD $0x000000982484c748; LONG $0x00000000 // movq	$0, 152(%rsp)
+	LONG $0x247c8948; BYTE $0x38               // movq	%rdi, 56(%rsp)
+	QUAD $0x00000000f53c8d4a                   // leaq	0(,%r14,8), %rdi
+	LONG $0x247c8948; BYTE $0x40               // movq	%rdi, 64(%rsp)
+	LONG $0xfc7e8d49                           // leaq	-4(%r14), %rdi
+	WORD $0x8948; BYTE $0xfa                   // movq	%rdi, %rdx
+	LONG $0x247c8948; BYTE $0x08               // movq	%rdi, 8(%rsp)
+	LONG $0x02eac148                           // shrq	$2, %rdx
+	QUAD $0x0000000495148d48                   // leaq	4(,%rdx,4), %rdx
+	LONG $0x24548948; BYTE $0x28               // movq	%rdx, 40(%rsp)
+
+BB0_12:
+	QUAD $0x0000009824848b48     // movq	152(%rsp), %rax
+	QUAD $0x0000009024b48b48     // movq	144(%rsp), %rsi
+	WORD $0x0148; BYTE $0xd8     // addq	%rbx, %rax
+	WORD $0x0148; BYTE $0xde     // addq	%rbx, %rsi
+	QUAD $0x0000008024848948     // movq	%rax, 128(%rsp)
+	LONG $0x24448b48; BYTE $0x40 // movq	64(%rsp), %rax
+	QUAD $0x0000008824b48948     // movq	%rsi, 136(%rsp)
+	LONG $0x030c8d49             // leaq	(%r11,%rax), %rcx
+	LONG $0x02348d49             // leaq	(%r10,%rax), %rsi
+	LONG $0x03fb8348             // cmpq	$3, %rbx
+	JLE  BB0_23
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+	LONG $0xd128fdc5             // vmovapd	%ymm1, %ymm2
+	LONG $0xd928fdc5             // vmovapd	%ymm1, %ymm3
+	LONG $0xe128fdc5             // vmovapd	%ymm1, %ymm4
+
+BB0_5:
+	LONG $0x107dc1c4; WORD $0xc744; BYTE $0xe0 // vmovupd	-32(%r15,%rax,8), %ymm0
+	LONG $0xb8fdc2c4; WORD $0xc364; BYTE $0xe0 // vfmadd231pd	-32(%r11,%rax,8), %ymm0, %ymm4
+	LONG $0xb8fde2c4; WORD $0xc15c; BYTE $0xe0 // vfmadd231pd	-32(%rcx,%rax,8), %ymm0, %ymm3
+	LONG $0xb8fdc2c4; WORD $0xc254; BYTE $0xe0 // vfmadd231pd	-32(%r10,%rax,8), %ymm0, %ymm2
+	LONG $0xb8fde2c4; WORD $0xc64c; BYTE $0xe0 // vfmadd231pd	-32(%rsi,%rax,8), %ymm0, %ymm1
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x3948; BYTE $0xd8                   // cmpq	%rbx, %rax
+	JLE  BB0_5
+	LONG $0x24548b48; BYTE $0x28               // movq	40(%rsp), %rdx
+
+BB0_4:
+	LONG $0x197de3c4; WORD $0x01e0 // vextractf128	$0x1, %ymm4, %xmm0
+	LONG $0xc458f9c5               // vaddpd	%xmm4, %xmm0, %xmm0
+	LONG $0xe015f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm4
+	LONG $0xc458fbc5               // vaddsd	%xmm4, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01dc // vextractf128	$0x1, %ymm3, %xmm4
+	LONG $0xdb58d9c5               // vaddpd	%xmm3, %xmm4, %xmm3
+	LONG $0xe315e1c5               // vunpckhpd	%xmm3, %xmm3, %xmm4
+	LONG $0xe458e3c5               // vaddsd	%xmm4, %xmm3, %xmm4
+	LONG $0x197de3c4; WORD $0x01d3 // vextractf128	$0x1, %ymm2, %xmm3
+	LONG $0xd258e1c5               // vaddpd	%xmm2, %xmm3, %xmm2
+	LONG $0xc414f9c5               // vunpcklpd	%xmm4, %xmm0, %xmm0
+	LONG $0xda15e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm3
+	LONG $0xd358ebc5               // vaddsd	%xmm3, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01cb // vextractf128	$0x1, %ymm1, %xmm3
+	LONG $0xcb58f1c5               // vaddpd	%xmm3, %xmm1, %xmm1
+	LONG $0xd915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm3
+	LONG $0xcb58f3c5               // vaddsd	%xmm3, %xmm1, %xmm1
+	LONG $0xd114e9c5               // vunpcklpd	%xmm1, %xmm2, %xmm2
+	LONG $0x187de3c4; WORD $0x01c2 // vinsertf128	$0x1, %xmm2, %ymm0, %ymm0
+	WORD $0x3948; BYTE $0xd3       // cmpq	%rdx, %rbx
+	JLE  BB0_6
+	WORD $0x8948; BYTE $0xdf       // movq	%rbx, %rdi
+	WORD $0x8949; BYTE $0xd0       // movq	%rdx, %r8
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	LONG $0x247c8948; BYTE $0x78   // movq	%rdi, 120(%rsp)
+	LONG $0x02f88348               // cmpq	$2, %rax
+	JBE  BB0_24
+	QUAD $0x0000009824848b48       // movq	152(%rsp), %rax
+	LONG $0x2454894c; BYTE $0x58   // movq	%r10, 88(%rsp)
+	LONG $0x02efc148               // shrq	$2, %rdi
+	LONG $0xd7348d4d               // leaq	(%r15,%rdx,8), %r14
+	QUAD $0x00000090248c8b4c       // movq	144(%rsp), %r9
+	LONG $0x245c8948; BYTE $0x50   // movq	%rbx, 80(%rsp)
+	LONG $0x05e7c148               // salq	$5, %rdi
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xc42c8d4d               // leaq	(%r12,%rax,8), %r13
+	QUAD $0x0000008024848b48       // movq	128(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xc4048d49               // leaq	(%r12,%rax,8), %rax
+	LONG $0x24448948; BYTE $0x60   // movq	%rax, 96(%rsp)
+	LONG $0x11048d49               // leaq	(%r9,%rdx), %rax
+	LONG $0x245c8b48; BYTE $0x60   // movq	96(%rsp), %rbx
+	LONG $0xc40c8d4d               // leaq	(%r12,%rax,8), %r9
+	QUAD $0x0000008824848b48       // movq	136(%rsp), %rax
+	LONG $0x244c894c; BYTE $0x68   // movq	%r9, 104(%rsp)
+	LONG $0x24548b4c; BYTE $0x68   // movq	104(%rsp), %r10
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0xc40c8d4d               // leaq	(%r12,%rax,8), %r9
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_8:
+	LONG $0x107dc1c4; WORD $0x061c             // vmovupd	(%r14,%rax), %ymm3
+	LONG $0x1459e5c5; BYTE $0x03               // vmulpd	(%rbx,%rax), %ymm3, %ymm2
+	LONG $0x5965c1c4; WORD $0x0564; BYTE $0x00 // vmulpd	0(%r13,%rax), %ymm3, %ymm4
+	LONG $0x5965c1c4; WORD $0x022c             // vmulpd	(%r10,%rax), %ymm3, %ymm5
+	LONG $0x5965c1c4; WORD $0x011c             // vmulpd	(%r9,%rax), %ymm3, %ymm3
+	LONG $0x20c08348                           // addq	$32, %rax
+	LONG $0xca14d9c5                           // vunpcklpd	%xmm2, %xmm4, %xmm1
+	LONG $0xc41559c5                           // vunpckhpd	%xmm4, %xmm4, %xmm8
+	LONG $0x197de3c4; WORD $0x01e4             // vextractf128	$0x1, %ymm4, %xmm4
+	LONG $0xcd1551c5                           // vunpckhpd	%xmm5, %xmm5, %xmm9
+	LONG $0xc6116bc5                           // vmovsd	%xmm8, %xmm2, %xmm6
+	LONG $0xd31451c5                           // vunpcklpd	%xmm3, %xmm5, %xmm10
+	LONG $0xcf1163c5                           // vmovsd	%xmm9, %xmm3, %xmm7
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0x1875c3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm10, %ymm1, %ymm1
+	LONG $0x184de3c4; WORD $0x01f7             // vinsertf128	$0x1, %xmm7, %ymm6, %ymm6
+	LONG $0xc058f5c5                           // vaddpd	%ymm0, %ymm1, %ymm0
+	LONG $0x197de3c4; WORD $0x01d1             // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0x197de3c4; WORD $0x01da             // vextractf128	$0x1, %ymm3, %xmm2
+	LONG $0xfa14d1c5                           // vunpcklpd	%xmm2, %xmm5, %xmm7
+	LONG $0xd914d9c5                           // vunpcklpd	%xmm1, %xmm4, %xmm3
+	LONG $0xed15d1c5                           // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0x1865e3c4; WORD $0x01df             // vinsertf128	$0x1, %xmm7, %ymm3, %ymm3
+	LONG $0xe415d9c5                           // vunpckhpd	%xmm4, %xmm4, %xmm4
+	LONG $0xd510ebc5                           // vmovsd	%xmm5, %xmm2, %xmm2
+	LONG $0xc658fdc5                           // vaddpd	%ymm6, %ymm0, %ymm0
+	LONG $0xcc10f3c5                           // vmovsd	%xmm4, %xmm1, %xmm1
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	LONG $0xc358fdc5                           // vaddpd	%ymm3, %ymm0, %ymm0
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	WORD $0x3948; BYTE $0xf8                   // cmpq	%rdi, %rax
+	JNE  BB0_8
+	LONG $0x24448b48; BYTE $0x78               // movq	120(%rsp), %rax
+	LONG $0x24548b4c; BYTE $0x58               // movq	88(%rsp), %r10
+	LONG $0x245c8b48; BYTE $0x50               // movq	80(%rsp), %rbx
+	WORD $0x03a8                               // testb	$3, %al
+	JE   BB0_6
+	LONG $0xfce08348                           // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+
+BB0_7:
+	LONG $0x247c8b48; BYTE $0x78   // movq	120(%rsp), %rdi
+	WORD $0x2948; BYTE $0xc7       // subq	%rax, %rdi
+	LONG $0x01ff8348               // cmpq	$1, %rdi
+	JE   BB0_10
+	LONG $0x000c8d4e               // leaq	(%rax,%r8), %r9
+	QUAD $0x0000008024b48b4c       // movq	128(%rsp), %r14
+	LONG $0x107981c4; WORD $0xcf0c // vmovupd	(%r15,%r9,8), %xmm1
+	QUAD $0x00000098248c8b4c       // movq	152(%rsp), %r9
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+	WORD $0x014d; BYTE $0xc1       // addq	%r8, %r9
+	LONG $0x597181c4; WORD $0xcc24 // vmulpd	(%r12,%r9,8), %xmm1, %xmm4
+	LONG $0x300c8d4e               // leaq	(%rax,%r14), %r9
+	QUAD $0x0000008824b48b4c       // movq	136(%rsp), %r14
+	WORD $0x014d; BYTE $0xc1       // addq	%r8, %r9
+	LONG $0x597181c4; WORD $0xcc1c // vmulpd	(%r12,%r9,8), %xmm1, %xmm3
+	QUAD $0x00000090248c8b4c       // movq	144(%rsp), %r9
+	WORD $0x0149; BYTE $0xc1       // addq	%rax, %r9
+	WORD $0x014c; BYTE $0xf0       // addq	%r14, %rax
+	WORD $0x014d; BYTE $0xc1       // addq	%r8, %r9
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+	LONG $0x597181c4; WORD $0xcc2c // vmulpd	(%r12,%r9,8), %xmm1, %xmm5
+	LONG $0x5971c1c4; WORD $0xc40c // vmulpd	(%r12,%rax,8), %xmm1, %xmm1
+	LONG $0xd314d9c5               // vunpcklpd	%xmm3, %xmm4, %xmm2
+	LONG $0xe415d9c5               // vunpckhpd	%xmm4, %xmm4, %xmm4
+	LONG $0xdc10e3c5               // vmovsd	%xmm4, %xmm3, %xmm3
+	LONG $0xf114d1c5               // vunpcklpd	%xmm1, %xmm5, %xmm6
+	LONG $0xed15d1c5               // vunpckhpd	%xmm5, %xmm5, %xmm5
+	LONG $0x186de3c4; WORD $0x01d6 // vinsertf128	$0x1, %xmm6, %ymm2, %ymm2
+	LONG $0xcd10f3c5               // vmovsd	%xmm5, %xmm1, %xmm1
+	LONG $0xc058edc5               // vaddpd	%ymm0, %ymm2, %ymm0
+	LONG $0x1865e3c4; WORD $0x01d9 // vinsertf128	$0x1, %xmm1, %ymm3, %ymm3
+	LONG $0xc358fdc5               // vaddpd	%ymm3, %ymm0, %ymm0
+	LONG $0x01c7f640               // testb	$1, %dil
+	JE   BB0_6
+	LONG $0xfee78348               // andq	$-2, %rdi
+	WORD $0x0148; BYTE $0xfa       // addq	%rdi, %rdx
+
+BB0_10:
+	LONG $0x107bc1c4; WORD $0xd214 // vmovsd	(%r10,%rdx,8), %xmm2
+	LONG $0x107bc1c4; WORD $0xd30c // vmovsd	(%r11,%rdx,8), %xmm1
+	LONG $0x197dc2c4; WORD $0xd71c // vbroadcastsd	(%r15,%rdx,8), %ymm3
+	LONG $0x1416e9c5; BYTE $0xd6   // vmovhpd	(%rsi,%rdx,8), %xmm2, %xmm2
+	LONG $0x0c16f1c5; BYTE $0xd1   // vmovhpd	(%rcx,%rdx,8), %xmm1, %xmm1
+	LONG $0x1875e3c4; WORD $0x01ca // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	LONG $0xb8e5e2c4; BYTE $0xc1   // vfmadd231pd	%ymm1, %ymm3, %ymm0
+
+BB0_6:
+	LONG $0x247c8b48; BYTE $0x30 // movq	48(%rsp), %rdi
+	QUAD $0x00000080248c8b48     // movq	128(%rsp), %rcx
+	LONG $0x24448b48; BYTE $0x70 // movq	112(%rsp), %rax
+	LONG $0x24748b48; BYTE $0x48 // movq	72(%rsp), %rsi
+	WORD $0x0148; BYTE $0xf9     // addq	%rdi, %rcx
+	LONG $0x0011fdc5             // vmovupd	%ymm0, (%rax)
+	LONG $0x20c08348             // addq	$32, %rax
+	WORD $0x0149; BYTE $0xf3     // addq	%rsi, %r11
+	WORD $0x0149; BYTE $0xf2     // addq	%rsi, %r10
+	QUAD $0x00000098248c8948     // movq	%rcx, 152(%rsp)
+	QUAD $0x00000088248c8b48     // movq	136(%rsp), %rcx
+	LONG $0x24448948; BYTE $0x70 // movq	%rax, 112(%rsp)
+	WORD $0x0148; BYTE $0xf9     // addq	%rdi, %rcx
+	QUAD $0x00000090248c8948     // movq	%rcx, 144(%rsp)
+	LONG $0x244c8b48; BYTE $0x38 // movq	56(%rsp), %rcx
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JNE  BB0_12
+	LONG $0x244c8b48; BYTE $0x18 // movq	24(%rsp), %rcx
+	LONG $0x24448b48; BYTE $0x20 // movq	32(%rsp), %rax
+	WORD $0x8949; BYTE $0xde     // movq	%rbx, %r14
+	LONG $0x24748b48; BYTE $0x10 // movq	16(%rsp), %rsi
+	LONG $0x247c8b48; BYTE $0x08 // movq	8(%rsp), %rdi
+	QUAD $0x000000048d048d4c     // leaq	4(,%rcx,4), %r8
+	WORD $0x394c; BYTE $0xc0     // cmpq	%r8, %rax
+	JLE  BB0_52
+
+BB0_3:
+	LONG $0x02efc148             // shrq	$2, %rdi
+	LONG $0xc6048d48             // leaq	(%rsi,%rax,8), %rax
+	LONG $0xc61c8d4e             // leaq	(%rsi,%r8,8), %r11
+	QUAD $0x0000009824848948     // movq	%rax, 152(%rsp)
+	LONG $0x014f8d48             // leaq	1(%rdi), %rcx
+	WORD $0x894c; BYTE $0xf0     // movq	%r14, %rax
+	LONG $0xc6af0f4d             // imulq	%r14, %r8
+	QUAD $0x000000008d1c8d48     // leaq	0(,%rcx,4), %rbx
+	LONG $0x05e1c148             // salq	$5, %rcx
+	WORD $0x2948; BYTE $0xd8     // subq	%rbx, %rax
+	WORD $0x014c; BYTE $0xf9     // addq	%r15, %rcx
+	LONG $0xff708d48             // leaq	-1(%rax), %rsi
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	QUAD $0x0000008024848948     // movq	%rax, 128(%rsp)
+	LONG $0x24748948; BYTE $0x78 // movq	%rsi, 120(%rsp)
+	WORD $0x8948; BYTE $0xc6     // movq	%rax, %rsi
+	WORD $0xe083; BYTE $0x03     // andl	$3, %eax
+	LONG $0x02e9c149             // shrq	$2, %r9
+	LONG $0xfce68348             // andq	$-4, %rsi
+	QUAD $0x0000008824848948     // movq	%rax, 136(%rsp)
+	LONG $0x05e1c149             // salq	$5, %r9
+	QUAD $0x0000009024b48948     // movq	%rsi, 144(%rsp)
+
+BB0_21:
+	LONG $0xc4048d4b             // leaq	(%r12,%r8,8), %rax
+	LONG $0x03fe8349             // cmpq	$3, %r14
+	JLE  BB0_13
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000004ba; BYTE $0x00 // movl	$4, %edx
+
+BB0_14:
+	LONG $0x107dc1c4; WORD $0xd77c; BYTE $0xe0 // vmovupd	-32(%r15,%rdx,8), %ymm7
+	LONG $0xb8c5e2c4; WORD $0xd04c; BYTE $0xe0 // vfmadd231pd	-32(%rax,%rdx,8), %ymm7, %ymm1
+	LONG $0x04c28348                           // addq	$4, %rdx
+	WORD $0x394c; BYTE $0xf2                   // cmpq	%r14, %rdx
+	JLE  BB0_14
+	LONG $0x197de3c4; WORD $0x01c8             // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5                           // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xde                   // cmpq	%rbx, %r14
+	JLE  BB0_15
+	LONG $0x247c8348; WORD $0x0278             // cmpq	$2, 120(%rsp)
+	QUAD $0x0000008024b48b48                   // movq	128(%rsp), %rsi
+	JBE  BB0_25
+	LONG $0x18148d49                           // leaq	(%r8,%rbx), %rdx
+	LONG $0xd43c8d49                           // leaq	(%r12,%rdx,8), %rdi
+	WORD $0xd231                               // xorl	%edx, %edx
+
+BB0_17:
+	LONG $0x2c10fdc5; BYTE $0x17         // vmovupd	(%rdi,%rdx), %ymm5
+	LONG $0x1459d5c5; BYTE $0x11         // vmulpd	(%rcx,%rdx), %ymm5, %ymm2
+	LONG $0x20c28348                     // addq	$32, %rdx
+	LONG $0xc258fbc5                     // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xda15e9c5                     // vunpckhpd	%xmm2, %xmm2, %xmm3
+	LONG $0x197de3c4; WORD $0x01d1       // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd858e3c5                     // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f3c5                     // vaddsd	%xmm3, %xmm1, %xmm0
+	LONG $0xc915f1c5                     // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5                     // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xca             // cmpq	%r9, %rdx
+	JNE  BB0_17
+	QUAD $0x0000009024948b48             // movq	144(%rsp), %rdx
+	WORD $0x8949; BYTE $0xdd             // movq	%rbx, %r13
+	WORD $0x8948; BYTE $0xd7             // movq	%rdx, %rdi
+	WORD $0x0148; BYTE $0xda             // addq	%rbx, %rdx
+	QUAD $0x0000008824bc8348; BYTE $0x00 // cmpq	$0, 136(%rsp)
+	JE   BB0_15
+
+BB0_16:
+	WORD $0x2948; BYTE $0xfe       // subq	%rdi, %rsi
+	LONG $0x01fe8348               // cmpq	$1, %rsi
+	JE   BB0_19
+	LONG $0x38148d4d               // leaq	(%r8,%rdi), %r10
+	WORD $0x014c; BYTE $0xef       // addq	%r13, %rdi
+	WORD $0x014d; BYTE $0xea       // addq	%r13, %r10
+	LONG $0x1079c1c4; WORD $0xff0c // vmovupd	(%r15,%rdi,8), %xmm1
+	LONG $0x597181c4; WORD $0xd40c // vmulpd	(%r12,%r10,8), %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0x01c6f640               // testb	$1, %sil
+	JE   BB0_15
+	LONG $0xfee68348               // andq	$-2, %rsi
+	WORD $0x0148; BYTE $0xf2       // addq	%rsi, %rdx
+
+BB0_19:
+	LONG $0x2c10fbc5; BYTE $0xd0   // vmovsd	(%rax,%rdx,8), %xmm5
+	LONG $0xb9d1c2c4; WORD $0xd704 // vfmadd231sd	(%r15,%rdx,8), %xmm5, %xmm0
+
+BB0_15:
+	LONG $0x117bc1c4; BYTE $0x03 // vmovsd	%xmm0, (%r11)
+	WORD $0x014d; BYTE $0xf0     // addq	%r14, %r8
+	LONG $0x08c38349             // addq	$8, %r11
+	QUAD $0x00000098249c394c     // cmpq	%r11, 152(%rsp)
+	JNE  BB0_21
+
+BB0_52:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_50:
+	LONG $0x50a58d48; WORD $0xffff; BYTE $0xff // leaq	-176(%rbp), %rsp
+	RET
+
+BB0_23:
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xd128fdc5 // vmovapd	%ymm1, %ymm2
+	LONG $0xd928fdc5 // vmovapd	%ymm1, %ymm3
+	LONG $0xe128fdc5 // vmovapd	%ymm1, %ymm4
+	JMP  BB0_4
+
+BB0_24:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_7
+
+BB0_13:
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x894c; BYTE $0xf6 // movq	%r14, %rsi
+	WORD $0x3145; BYTE $0xed // xorl	%r13d, %r13d
+	WORD $0xff31             // xorl	%edi, %edi
+	WORD $0xd231             // xorl	%edx, %edx
+	JMP  BB0_16
+
+BB0_22:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	LONG $0xfc7e8d49         // leaq	-4(%r14), %rdi
+	JMP  BB0_3
+
+BB0_25:
+	WORD $0x8949; BYTE $0xdd // movq	%rbx, %r13
+	WORD $0x8948; BYTE $0xda // movq	%rbx, %rdx
+	WORD $0xff31             // xorl	%edi, %edi
+	JMP  BB0_16
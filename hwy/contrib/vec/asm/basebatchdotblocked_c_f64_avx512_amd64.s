@@ -0,0 +1,517 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basebatchdotblocked_c_f64_avx512_amd64.c
+
+TEXT ·batchdotblocked_c_f64_avx512(SB), $80-64
+	MOVQ query+0(FP), DI
+	MOVQ data+8(FP), SI
+	MOVQ dots+16(FP), DX
+	MOVQ pcount+24(FP), CX
+	MOVQ pdims+32(FP), R8
+	MOVQ plen_query+40(FP), R9
+	MOVQ plen_data+48(FP), R11
+	MOVQ R11, 64(SP)
+	MOVQ plen_dots+56(FP), R11
+	MOVQ R11, 72(SP)
+	WORD $0x8949; BYTE $0xd3             // movq	%rdx, %r11
+	LONG $0x246c8d48; BYTE $0x30         // leaq	48(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x40         // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348                     // andq	$-64, %rsp
+	LONG $0x80c48348                     // addq	$-128, %rsp
+	WORD $0x8b48; BYTE $0x19             // movq	(%rcx), %rbx
+	WORD $0x8b49; BYTE $0x10             // movq	(%r8), %rdx
+	WORD $0x8548; BYTE $0xdb             // testq	%rbx, %rbx
+	JLE  BB0_44
+	WORD $0x8548; BYTE $0xd2             // testq	%rdx, %rdx
+	JLE  BB0_44
+	LONG $0x10458b48                     // movq	16(%rbp), %rax
+	WORD $0x8948; BYTE $0xd9             // movq	%rbx, %rcx
+	LONG $0xcaaf0f48                     // imulq	%rdx, %rcx
+	WORD $0x3b48; BYTE $0x08             // cmpq	(%rax), %rcx
+	JG   BB0_44
+	LONG $0x18458b48                     // movq	24(%rbp), %rax
+	WORD $0x3b48; BYTE $0x18             // cmpq	(%rax), %rbx
+	JG   BB0_44
+	WORD $0x3b49; BYTE $0x11             // cmpq	(%r9), %rdx
+	JG   BB0_44
+	WORD $0x8949; BYTE $0xfe             // movq	%rdi, %r14
+	WORD $0x8949; BYTE $0xf2             // movq	%rsi, %r10
+	LONG $0x03fb8348                     // cmpq	$3, %rbx
+	JLE  BB0_22
+	WORD $0x8948; BYTE $0xd0             // movq	%rdx, %rax
+	LONG $0xf84a8d4c                     // leaq	-8(%rdx), %r9
+	LONG $0x12048d4c                     // leaq	(%rdx,%rdx), %r8
+	WORD $0x8948; BYTE $0xf7             // movq	%rsi, %rdi
+	LONG $0x05e0c148                     // salq	$5, %rax
+	WORD $0x8948; BYTE $0xd6             // movq	%rdx, %rsi
+	LONG $0x245c894c; BYTE $0x48         // movq	%r11, 72(%rsp)
+	WORD $0x894d; BYTE $0xf7             // movq	%r14, %r15
+	LONG $0x24448948; BYTE $0x30         // movq	%rax, 48(%rsp)
+	LONG $0xfc438d48                     // leaq	-4(%rbx), %rax
+	LONG $0x04e6c148                     // salq	$4, %rsi
+	LONG $0x02e8c148                     // shrq	$2, %rax
+	LONG $0x2444894c; BYTE $0x70         // movq	%r8, 112(%rsp)
+	WORD $0x014c; BYTE $0xd6             // addq	%r10, %rsi
+	WORD $0x8948; BYTE $0xc1             // movq	%rax, %rcx
+	LONG $0x245c8948; BYTE $0x20         // movq	%rbx, 32(%rsp)
+	LONG $0x05e1c148                     // salq	$5, %rcx
+	LONG $0x24448948; BYTE $0x18         // movq	%rax, 24(%rsp)
+	LONG $0x0b4c8d49; BYTE $0x20         // leaq	32(%r11,%rcx), %rcx
+	LONG $0x245c894c; BYTE $0x10         // movq	%r11, 16(%rsp)
+	LONG $0x6ef961c4; BYTE $0xe9         // vmovq	%rcx, %xmm13
+	QUAD $0x00000000d50c8d48             // leaq	0(,%rdx,8), %rcx
+	LONG $0x244c894c; BYTE $0x08         // movq	%r9, 8(%rsp)
+	QUAD $0x000000782444c748; BYTE $0x00 // movq	$0, 120(%rsp)
+	LONG $0x6ef961c4; BYTE $0xe1         // vmovq	%rcx, %xmm12
+	WORD $0x894c; BYTE $0xc9             // movq	%r9, %rcx
+	LONG $0x03e9c148                     // shrq	$3, %rcx
+	QUAD $0x00000008cd0c8d48             // leaq	8(,%rcx,8), %rcx
+	LONG $0x244c8948; BYTE $0x28         // movq	%rcx, 40(%rsp)
+	LONG $0x100c8d49                     // leaq	(%r8,%rdx), %rcx
+	LONG $0x6ef9e1c4; BYTE $0xe1         // vmovq	%rcx, %xmm4
+	LONG $0x08fd6162; WORD $0xcc6f       // vmovdqa64	%xmm4, %xmm25
+
+BB0_12:
+	LONG $0x24448b48; BYTE $0x78   // movq	120(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x24448948; BYTE $0x68   // movq	%rax, 104(%rsp)
+	LONG $0x7ef961c4; BYTE $0xe0   // vmovq	%xmm12, %rax
+	LONG $0x072c8d4c               // leaq	(%rdi,%rax), %r13
+	LONG $0x24448b48; BYTE $0x70   // movq	112(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x24448948; BYTE $0x60   // movq	%rax, 96(%rsp)
+	LONG $0x7ef961c4; BYTE $0xe0   // vmovq	%xmm12, %rax
+	LONG $0x061c8d48               // leaq	(%rsi,%rax), %rbx
+	LONG $0x07fa8348               // cmpq	$7, %rdx
+	JLE  BB0_23
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b8; BYTE $0x00   // movl	$8, %eax
+	LONG $0x48fdf162; WORD $0xd128 // vmovapd	%zmm1, %zmm2
+	LONG $0x48fdf162; WORD $0xf128 // vmovapd	%zmm1, %zmm6
+	LONG $0x48fdf162; WORD $0xf928 // vmovapd	%zmm1, %zmm7
+
+BB0_5:
+	QUAD $0xffc7441048fdd162     // vmovupd	-64(%r15,%rax,8), %zmm0
+	QUAD $0xffc77cb848fdf262     // vfmadd231pd	-64(%rdi,%rax,8), %zmm0, %zmm7
+	QUAD $0xffc574b848fdd262     // vfmadd231pd	-64(%r13,%rax,8), %zmm0, %zmm6
+	QUAD $0xffc654b848fdf262     // vfmadd231pd	-64(%rsi,%rax,8), %zmm0, %zmm2
+	QUAD $0xffc34cb848fdf262     // vfmadd231pd	-64(%rbx,%rax,8), %zmm0, %zmm1
+	LONG $0x08c08348             // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd0     // cmpq	%rdx, %rax
+	JLE  BB0_5
+	LONG $0x244c8b48; BYTE $0x28 // movq	40(%rsp), %rcx
+
+BB0_4:
+	LONG $0x48fdf362; WORD $0xf81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm7, %ymm0
+	LONG $0xc758fdc5                           // vaddpd	%ymm7, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc719; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm7
+	LONG $0xf858c1c5                           // vaddpd	%xmm0, %xmm7, %xmm7
+	LONG $0x48fdf362; WORD $0xf01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm6, %ymm0
+	LONG $0xc658fdc5                           // vaddpd	%ymm6, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc619; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm6
+	LONG $0xf058c9c5                           // vaddpd	%xmm0, %xmm6, %xmm6
+	LONG $0x48fdf362; WORD $0xd01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm0
+	LONG $0xc258fdc5                           // vaddpd	%ymm2, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc219; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm2
+	LONG $0xd058e9c5                           // vaddpd	%xmm0, %xmm2, %xmm2
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc858f5c5                           // vaddpd	%ymm0, %ymm1, %ymm1
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$0x1, %ymm1, %xmm0
+	LONG $0xc958f9c5                           // vaddpd	%xmm1, %xmm0, %xmm1
+	LONG $0xc710c3c5                           // vmovsd	%xmm7, %xmm7, %xmm0
+	LONG $0xff15c1c5                           // vunpckhpd	%xmm7, %xmm7, %xmm7
+	LONG $0xc758fbc5                           // vaddsd	%xmm7, %xmm0, %xmm0
+	LONG $0xfe10cbc5                           // vmovsd	%xmm6, %xmm6, %xmm7
+	LONG $0xf615c9c5                           // vunpckhpd	%xmm6, %xmm6, %xmm6
+	LONG $0xfe58c3c5                           // vaddsd	%xmm6, %xmm7, %xmm7
+	LONG $0xf210ebc5                           // vmovsd	%xmm2, %xmm2, %xmm6
+	LONG $0xd215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xf258cbc5                           // vaddsd	%xmm2, %xmm6, %xmm6
+	LONG $0xd110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm2
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc958ebc5                           // vaddsd	%xmm1, %xmm2, %xmm1
+	LONG $0xc714f9c5                           // vunpcklpd	%xmm7, %xmm0, %xmm0
+	LONG $0xc914c9c5                           // vunpcklpd	%xmm1, %xmm6, %xmm1
+	LONG $0x187de3c4; WORD $0x01c1             // vinsertf128	$0x1, %xmm1, %ymm0, %ymm0
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_6
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x244c8948; BYTE $0x50               // movq	%rcx, 80(%rsp)
+	WORD $0x2948; BYTE $0xc8                   // subq	%rcx, %rax
+	LONG $0x24448948; BYTE $0x58               // movq	%rax, 88(%rsp)
+	LONG $0x01e88348                           // subq	$1, %rax
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_24
+	LONG $0x24448b4c; BYTE $0x78               // movq	120(%rsp), %r8
+	LONG $0x245c8b4c; BYTE $0x68               // movq	104(%rsp), %r11
+	LONG $0x2454894c; BYTE $0x38               // movq	%r10, 56(%rsp)
+	LONG $0xcf348d4d                           // leaq	(%r15,%rcx,8), %r14
+	LONG $0x244c8b4c; BYTE $0x70               // movq	112(%rsp), %r9
+	LONG $0x01048d4a                           // leaq	(%rcx,%r8), %rax
+	LONG $0xc2048d4d                           // leaq	(%r10,%rax,8), %r8
+	LONG $0x19048d4a                           // leaq	(%rcx,%r11), %rax
+	LONG $0xc2248d4d                           // leaq	(%r10,%rax,8), %r12
+	LONG $0x09048d4a                           // leaq	(%rcx,%r9), %rax
+	LONG $0x244c8b4c; BYTE $0x60               // movq	96(%rsp), %r9
+	LONG $0xc21c8d4d                           // leaq	(%r10,%rax,8), %r11
+	LONG $0x09048d4a                           // leaq	(%rcx,%r9), %rax
+	LONG $0xc20c8d4d                           // leaq	(%r10,%rax,8), %r9
+	LONG $0x24448b48; BYTE $0x58               // movq	88(%rsp), %rax
+	WORD $0x8949; BYTE $0xf2                   // movq	%rsi, %r10
+	WORD $0x8948; BYTE $0xd6                   // movq	%rdx, %rsi
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	LONG $0x24448948; BYTE $0x40               // movq	%rax, 64(%rsp)
+	LONG $0x24548b48; BYTE $0x40               // movq	64(%rsp), %rdx
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_8:
+	LONG $0x48fdd162; WORD $0x1410; BYTE $0x06 // vmovupd	(%r14,%rax), %zmm2
+	LONG $0x48edd162; WORD $0x1c59; BYTE $0x00 // vmulpd	(%r8,%rax), %zmm2, %zmm3
+	LONG $0x48ed5162; WORD $0x3459; BYTE $0x04 // vmulpd	(%r12,%rax), %zmm2, %zmm14
+	LONG $0x48ed5162; WORD $0x3c59; BYTE $0x03 // vmulpd	(%r11,%rax), %zmm2, %zmm15
+	LONG $0x48edd162; WORD $0x1459; BYTE $0x01 // vmulpd	(%r9,%rax), %zmm2, %zmm2
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x28e5f362; WORD $0xe303; BYTE $0x03 // valignq	$3, %ymm3, %ymm3, %ymm4
+	LONG $0x08e5e162; WORD $0xeb15             // vunpckhpd	%xmm3, %xmm3, %xmm21
+	LONG $0x28fd7362; WORD $0xf519; BYTE $0x01 // vextractf64x2	$1, %ymm14, %xmm5
+	LONG $0x1461c1c4; BYTE $0xce               // vunpcklpd	%xmm14, %xmm3, %xmm1
+	LONG $0x088fa162; WORD $0xcd10             // vmovsd	%xmm21, %xmm14, %xmm17
+	LONG $0x288dc362; WORD $0xd603; BYTE $0x03 // valignq	$3, %ymm14, %ymm14, %ymm18
+	LONG $0x0885c162; WORD $0xf715             // vunpckhpd	%xmm15, %xmm15, %xmm22
+	LONG $0x48fd5362; WORD $0xf61b; BYTE $0x01 // vextractf64x4	$0x1, %zmm14, %ymm14
+	LONG $0x28fdf362; WORD $0xd619; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm6
+	LONG $0x0885e162; WORD $0xfa14             // vunpcklpd	%xmm2, %xmm15, %xmm23
+	LONG $0x08efa162; WORD $0xe610             // vmovsd	%xmm22, %xmm2, %xmm20
+	LONG $0x28ede362; WORD $0xda03; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm19
+	LONG $0x28f5b362; WORD $0xcf18; BYTE $0x01 // vinsertf64x2	$0x1, %xmm23, %ymm1, %ymm1
+	LONG $0x20f5a362; WORD $0xcc18; BYTE $0x01 // vinsertf64x2	$0x1, %xmm20, %ymm17, %ymm17
+	LONG $0x48fdf362; WORD $0xd21b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm2
+	LONG $0x2885c362; WORD $0xc703; BYTE $0x03 // valignq	$3, %ymm15, %ymm15, %ymm16
+	LONG $0xc058f5c5                           // vaddpd	%ymm0, %ymm1, %ymm0
+	LONG $0x28fdf362; WORD $0xd919; BYTE $0x01 // vextractf64x2	$1, %ymm3, %xmm1
+	LONG $0x28fdb162; WORD $0xc158             // vaddpd	%ymm17, %ymm0, %ymm0
+	LONG $0x08ddb162; WORD $0xe214             // vunpcklpd	%xmm18, %xmm4, %xmm4
+	LONG $0x28fd3362; WORD $0xf919; BYTE $0x01 // vextractf64x2	$1, %ymm15, %xmm17
+	LONG $0x48fd5362; WORD $0xff1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm15, %ymm15
+	LONG $0x0885e162; WORD $0xea14             // vunpcklpd	%xmm2, %xmm15, %xmm21
+	LONG $0x0885c162; WORD $0xe715             // vunpckhpd	%xmm15, %xmm15, %xmm20
+	LONG $0x00fda162; WORD $0xc314             // vunpcklpd	%xmm19, %xmm16, %xmm16
+	LONG $0x08efa162; WORD $0xd410             // vmovsd	%xmm20, %xmm2, %xmm18
+	LONG $0xcd14f1c5                           // vunpcklpd	%xmm5, %xmm1, %xmm1
+	LONG $0x28ddb362; WORD $0xe018; BYTE $0x01 // vinsertf64x2	$0x1, %xmm16, %ymm4, %ymm4
+	LONG $0x00f5e162; WORD $0xce14             // vunpcklpd	%xmm6, %xmm17, %xmm17
+	LONG $0x28f5b362; WORD $0xc918; BYTE $0x01 // vinsertf64x2	$0x1, %xmm17, %ymm1, %ymm1
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	LONG $0x48fdf362; WORD $0xd91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm3, %ymm1
+	LONG $0x28fd7362; WORD $0xf319; BYTE $0x01 // vextractf64x2	$1, %ymm14, %xmm3
+	LONG $0x08f5c162; WORD $0xce14             // vunpcklpd	%xmm14, %xmm1, %xmm17
+	LONG $0x08f5e162; WORD $0xd915             // vunpckhpd	%xmm1, %xmm1, %xmm19
+	LONG $0x20f5a362; WORD $0xcd18; BYTE $0x01 // vinsertf64x2	$0x1, %xmm21, %ymm17, %ymm17
+	LONG $0x088fa162; WORD $0xc310             // vmovsd	%xmm19, %xmm14, %xmm16
+	LONG $0x288d5362; WORD $0xf603; BYTE $0x03 // valignq	$3, %ymm14, %ymm14, %ymm14
+	LONG $0xc458fdc5                           // vaddpd	%ymm4, %ymm0, %ymm0
+	LONG $0x20fda362; WORD $0xc218; BYTE $0x01 // vinsertf64x2	$0x1, %xmm18, %ymm16, %ymm16
+	LONG $0x28fdf362; WORD $0xd419; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm4
+	LONG $0x28edf362; WORD $0xd203; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm2
+	LONG $0x28fdb162; WORD $0xc158             // vaddpd	%ymm17, %ymm0, %ymm0
+	LONG $0x28fd3362; WORD $0xf919; BYTE $0x01 // vextractf64x2	$1, %ymm15, %xmm17
+	LONG $0x28855362; WORD $0xff03; BYTE $0x03 // valignq	$3, %ymm15, %ymm15, %ymm15
+	LONG $0x28fdb162; WORD $0xc058             // vaddpd	%ymm16, %ymm0, %ymm0
+	LONG $0x28fdb362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm16
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0x00f5e162; WORD $0xcc14             // vunpcklpd	%xmm4, %xmm17, %xmm17
+	LONG $0xfa1401c5                           // vunpcklpd	%xmm2, %xmm15, %xmm15
+	LONG $0x00fde162; WORD $0xc314             // vunpcklpd	%xmm3, %xmm16, %xmm16
+	LONG $0x20fda362; WORD $0xc118; BYTE $0x01 // vinsertf64x2	$0x1, %xmm17, %ymm16, %ymm16
+	LONG $0x1471c1c4; BYTE $0xce               // vunpcklpd	%xmm14, %xmm1, %xmm1
+	LONG $0x28fdb162; WORD $0xc058             // vaddpd	%ymm16, %ymm0, %ymm0
+	LONG $0x1875c3c4; WORD $0x01cf             // vinsertf128	$0x1, %xmm15, %ymm1, %ymm1
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JNE  BB0_8
+	LONG $0x24748b4c; BYTE $0x58               // movq	88(%rsp), %r14
+	WORD $0x8948; BYTE $0xf2                   // movq	%rsi, %rdx
+	WORD $0x894c; BYTE $0xd6                   // movq	%r10, %rsi
+	LONG $0x24548b4c; BYTE $0x38               // movq	56(%rsp), %r10
+	WORD $0x894c; BYTE $0xf0                   // movq	%r14, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x07e68341                           // andl	$7, %r14d
+	JE   BB0_6
+
+BB0_7:
+	LONG $0x24448b4c; BYTE $0x58               // movq	88(%rsp), %r8
+	WORD $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG $0xff708d4d                           // leaq	-1(%r8), %r14
+	LONG $0x02fe8349                           // cmpq	$2, %r14
+	JBE  BB0_10
+	LONG $0x245c8b4c; BYTE $0x50               // movq	80(%rsp), %r11
+	LONG $0x244c8b4c; BYTE $0x78               // movq	120(%rsp), %r9
+	LONG $0x24748b4c; BYTE $0x68               // movq	104(%rsp), %r14
+	WORD $0x0149; BYTE $0xc3                   // addq	%rax, %r11
+	WORD $0x014d; BYTE $0xd9                   // addq	%r11, %r9
+	LONG $0x107d81c4; WORD $0xdf34             // vmovupd	(%r15,%r11,8), %ymm6
+	WORD $0x894c; BYTE $0xd8                   // movq	%r11, %rax
+	LONG $0x594d81c4; WORD $0xca14             // vmulpd	(%r10,%r9,8), %ymm6, %ymm2
+	LONG $0x330c8d4f                           // leaq	(%r11,%r14), %r9
+	LONG $0x245c8b4c; BYTE $0x70               // movq	112(%rsp), %r11
+	LONG $0x594d81c4; WORD $0xca3c             // vmulpd	(%r10,%r9,8), %ymm6, %ymm7
+	LONG $0x244c8b4c; BYTE $0x60               // movq	96(%rsp), %r9
+	WORD $0x0149; BYTE $0xc3                   // addq	%rax, %r11
+	LONG $0x594d01c4; WORD $0xda3c             // vmulpd	(%r10,%r11,8), %ymm6, %ymm15
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+	LONG $0x594d41c4; WORD $0xc234             // vmulpd	(%r10,%rax,8), %ymm6, %ymm14
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	LONG $0xca1569c5                           // vunpckhpd	%xmm2, %xmm2, %xmm9
+	LONG $0xfce08348                           // andq	$-4, %rax
+	LONG $0xcf14e9c5                           // vunpcklpd	%xmm7, %xmm2, %xmm1
+	LONG $0xce1143c5                           // vmovsd	%xmm9, %xmm7, %xmm6
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x03e08341                           // andl	$3, %r8d
+	LONG $0x28fdf362; WORD $0xfb19; BYTE $0x01 // vextractf64x2	$1, %ymm7, %xmm3
+	LONG $0x28fd7362; WORD $0xfc19; BYTE $0x01 // vextractf64x2	$1, %ymm15, %xmm4
+	LONG $0x150141c4; BYTE $0xd7               // vunpckhpd	%xmm15, %xmm15, %xmm10
+	LONG $0x28c5f362; WORD $0xff03; BYTE $0x03 // valignq	$3, %ymm7, %ymm7, %ymm7
+	LONG $0x0885c162; WORD $0xc614             // vunpcklpd	%xmm14, %xmm15, %xmm16
+	LONG $0x100b41c4; BYTE $0xc2               // vmovsd	%xmm10, %xmm14, %xmm8
+	LONG $0x28f5b362; WORD $0xc818; BYTE $0x01 // vinsertf64x2	$0x1, %xmm16, %ymm1, %ymm1
+	LONG $0x184dc3c4; WORD $0x01f0             // vinsertf128	$0x1, %xmm8, %ymm6, %ymm6
+	LONG $0x28fdd362; WORD $0xd019; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm8
+	LONG $0xc058f5c5                           // vaddpd	%ymm0, %ymm1, %ymm0
+	LONG $0x28fd7362; WORD $0xf119; BYTE $0x01 // vextractf64x2	$1, %ymm14, %xmm1
+	LONG $0x28edf362; WORD $0xd203; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm2
+	LONG $0x288d5362; WORD $0xf603; BYTE $0x03 // valignq	$3, %ymm14, %ymm14, %ymm14
+	LONG $0xc658fdc5                           // vaddpd	%ymm6, %ymm0, %ymm0
+	LONG $0xc31439c5                           // vunpcklpd	%xmm3, %xmm8, %xmm8
+	LONG $0xc914d9c5                           // vunpcklpd	%xmm1, %xmm4, %xmm1
+	LONG $0x183d63c4; WORD $0x01c1             // vinsertf128	$0x1, %xmm1, %ymm8, %ymm8
+	LONG $0xd714e9c5                           // vunpcklpd	%xmm7, %xmm2, %xmm2
+	LONG $0x2885d362; WORD $0xcf03; BYTE $0x03 // valignq	$3, %ymm15, %ymm15, %ymm1
+	LONG $0x587dc1c4; BYTE $0xc0               // vaddpd	%ymm8, %ymm0, %ymm0
+	LONG $0x1471c1c4; BYTE $0xce               // vunpcklpd	%xmm14, %xmm1, %xmm1
+	LONG $0x186de3c4; WORD $0x01d1             // vinsertf128	$0x1, %xmm1, %ymm2, %ymm2
+	LONG $0xc258fdc5                           // vaddpd	%ymm2, %ymm0, %ymm0
+	JE   BB0_6
+
+BB0_10:
+	LONG $0x0c10fbc5; BYTE $0xce               // vmovsd	(%rsi,%rcx,8), %xmm1
+	LONG $0x01418d4c                           // leaq	1(%rcx), %r8
+	QUAD $0x00000000cd048d48                   // leaq	0(,%rcx,8), %rax
+	LONG $0x1416f1c5; BYTE $0xcb               // vmovhpd	(%rbx,%rcx,8), %xmm1, %xmm2
+	LONG $0x0c10fbc5; BYTE $0xcf               // vmovsd	(%rdi,%rcx,8), %xmm1
+	LONG $0x1671c1c4; WORD $0xcd4c; BYTE $0x00 // vmovhpd	0(%r13,%rcx,8), %xmm1, %xmm1
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	LONG $0x38f5d262; WORD $0x04b8; BYTE $0xcf // vfmadd231pd	(%r15,%rcx,8){1to4}, %ymm1, %ymm0
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_6
+	LONG $0x4c10fbc5; WORD $0x0830             // vmovsd	8(%rax,%rsi), %xmm1
+	LONG $0x02c18348                           // addq	$2, %rcx
+	LONG $0x5416f1c5; WORD $0x0803             // vmovhpd	8(%rbx,%rax), %xmm1, %xmm2
+	LONG $0x4c10fbc5; WORD $0x0838             // vmovsd	8(%rax,%rdi), %xmm1
+	LONG $0x1671c1c4; WORD $0x054c; BYTE $0x08 // vmovhpd	8(%r13,%rax), %xmm1, %xmm1
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	QUAD $0x010744b838f5d262                   // vfmadd231pd	8(%r15,%rax){1to4}, %ymm1, %ymm0
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_6
+	LONG $0x4c10fbc5; WORD $0x1030             // vmovsd	16(%rax,%rsi), %xmm1
+	LONG $0x5416f1c5; WORD $0x1003             // vmovhpd	16(%rbx,%rax), %xmm1, %xmm2
+	LONG $0x4c10fbc5; WORD $0x1038             // vmovsd	16(%rax,%rdi), %xmm1
+	LONG $0x1671c1c4; WORD $0x054c; BYTE $0x10 // vmovhpd	16(%r13,%rax), %xmm1, %xmm1
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	QUAD $0x020744b838f5d262                   // vfmadd231pd	16(%r15,%rax){1to4}, %ymm1, %ymm0
+
+BB0_6:
+	LONG $0x245c8b48; BYTE $0x30   // movq	48(%rsp), %rbx
+	LONG $0x244c8b48; BYTE $0x68   // movq	104(%rsp), %rcx
+	LONG $0x24448b48; BYTE $0x48   // movq	72(%rsp), %rax
+	WORD $0x0148; BYTE $0xdf       // addq	%rbx, %rdi
+	WORD $0x0148; BYTE $0xde       // addq	%rbx, %rsi
+	LONG $0x08fd6162; WORD $0xcb7e // vmovq	%xmm25, %rbx
+	WORD $0x0148; BYTE $0xd9       // addq	%rbx, %rcx
+	LONG $0x0011fdc5               // vmovupd	%ymm0, (%rax)
+	LONG $0x20c08348               // addq	$32, %rax
+	LONG $0x244c8948; BYTE $0x78   // movq	%rcx, 120(%rsp)
+	LONG $0x244c8b48; BYTE $0x60   // movq	96(%rsp), %rcx
+	LONG $0x24448948; BYTE $0x48   // movq	%rax, 72(%rsp)
+	WORD $0x0148; BYTE $0xd9       // addq	%rbx, %rcx
+	LONG $0x244c8948; BYTE $0x70   // movq	%rcx, 112(%rsp)
+	LONG $0x7ef961c4; BYTE $0xe9   // vmovq	%xmm13, %rcx
+	WORD $0x3948; BYTE $0xc8       // cmpq	%rcx, %rax
+	JNE  BB0_12
+	LONG $0x24448b48; BYTE $0x18   // movq	24(%rsp), %rax
+	LONG $0x245c8b48; BYTE $0x20   // movq	32(%rsp), %rbx
+	WORD $0x894d; BYTE $0xfe       // movq	%r15, %r14
+	LONG $0x245c8b4c; BYTE $0x10   // movq	16(%rsp), %r11
+	LONG $0x244c8b4c; BYTE $0x08   // movq	8(%rsp), %r9
+	QUAD $0x0000000485048d4c       // leaq	4(,%rax,4), %r8
+	WORD $0x394c; BYTE $0xc3       // cmpq	%r8, %rbx
+	JLE  BB0_46
+
+BB0_3:
+	LONG $0xdb048d49             // leaq	(%r11,%rbx,8), %rax
+	LONG $0xc32c8d4f             // leaq	(%r11,%r8,8), %r13
+	LONG $0x24448948; BYTE $0x78 // movq	%rax, 120(%rsp)
+	WORD $0x894c; BYTE $0xc8     // movq	%r9, %rax
+	LONG $0xc2af0f4c             // imulq	%rdx, %r8
+	LONG $0x03e8c148             // shrq	$3, %rax
+	LONG $0x01488d48             // leaq	1(%rax), %rcx
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	QUAD $0x00000000cd1c8d48     // leaq	0(,%rcx,8), %rbx
+	LONG $0x06e1c148             // salq	$6, %rcx
+	WORD $0x2948; BYTE $0xd8     // subq	%rbx, %rax
+	WORD $0x014c; BYTE $0xf1     // addq	%r14, %rcx
+	LONG $0xff788d48             // leaq	-1(%rax), %rdi
+	WORD $0x8949; BYTE $0xc3     // movq	%rax, %r11
+	LONG $0x24448948; BYTE $0x60 // movq	%rax, 96(%rsp)
+	LONG $0x247c8948; BYTE $0x58 // movq	%rdi, 88(%rsp)
+	WORD $0x8948; BYTE $0xc7     // movq	%rax, %rdi
+	WORD $0xe083; BYTE $0x07     // andl	$7, %eax
+	LONG $0x03ebc149             // shrq	$3, %r11
+	LONG $0xf8e78348             // andq	$-8, %rdi
+	LONG $0x24448948; BYTE $0x68 // movq	%rax, 104(%rsp)
+	LONG $0x06e3c149             // salq	$6, %r11
+	LONG $0x247c8948; BYTE $0x70 // movq	%rdi, 112(%rsp)
+
+BB0_21:
+	LONG $0xc23c8d4f             // leaq	(%r10,%r8,8), %r15
+	LONG $0x07fa8348             // cmpq	$7, %rdx
+	JLE  BB0_13
+	LONG $0xc057f9c5             // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_14:
+	QUAD $0xffc66c1048fdd162                   // vmovupd	-64(%r14,%rax,8), %zmm5
+	QUAD $0xffc744b848d5d262                   // vfmadd231pd	-64(%r15,%rax,8), %zmm5, %zmm0
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JLE  BB0_14
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f5c5                           // vaddpd	%ymm0, %ymm1, %ymm0
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm1
+	LONG $0xc858f1c5                           // vaddpd	%xmm0, %xmm1, %xmm1
+	LONG $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xda                   // cmpq	%rbx, %rdx
+	JLE  BB0_15
+	LONG $0x247c8348; WORD $0x0658             // cmpq	$6, 88(%rsp)
+	LONG $0x24448b48; BYTE $0x60               // movq	96(%rsp), %rax
+	JBE  BB0_25
+	LONG $0x18348d49                           // leaq	(%r8,%rbx), %rsi
+	LONG $0xf23c8d49                           // leaq	(%r10,%rsi,8), %rdi
+	WORD $0xf631                               // xorl	%esi, %esi
+
+BB0_17:
+	LONG $0x48fdf162; WORD $0x2c10; BYTE $0x37 // vmovupd	(%rdi,%rsi), %zmm5
+	LONG $0x48d5f162; WORD $0x1459; BYTE $0x31 // vmulpd	(%rcx,%rsi), %zmm5, %zmm2
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0x28edf362; WORD $0xe203; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm4
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xea15e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm5
+	LONG $0x48fdf362; WORD $0xd11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm1
+	LONG $0xe858d3c5                           // vaddsd	%xmm0, %xmm5, %xmm5
+	LONG $0x28fdf362; WORD $0xd019; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm0
+	LONG $0xc558fbc5                           // vaddsd	%xmm5, %xmm0, %xmm0
+	LONG $0xe058dbc5                           // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0xc115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm0
+	LONG $0xd458f3c5                           // vaddsd	%xmm4, %xmm1, %xmm2
+	LONG $0xd258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm2
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm0
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xde                   // cmpq	%r11, %rsi
+	JNE  BB0_17
+	LONG $0x247c8b48; BYTE $0x70               // movq	112(%rsp), %rdi
+	WORD $0x8948; BYTE $0xfe                   // movq	%rdi, %rsi
+	WORD $0x0148; BYTE $0xdf                   // addq	%rbx, %rdi
+	LONG $0x247c8348; WORD $0x0068             // cmpq	$0, 104(%rsp)
+	JE   BB0_15
+	WORD $0x8949; BYTE $0xdc                   // movq	%rbx, %r12
+
+BB0_16:
+	WORD $0x2948; BYTE $0xf0                   // subq	%rsi, %rax
+	LONG $0xff488d4c                           // leaq	-1(%rax), %r9
+	LONG $0x02f98349                           // cmpq	$2, %r9
+	JBE  BB0_19
+	LONG $0x300c8d4d                           // leaq	(%r8,%rsi), %r9
+	WORD $0x014c; BYTE $0xe6                   // addq	%r12, %rsi
+	WORD $0x014d; BYTE $0xe1                   // addq	%r12, %r9
+	LONG $0x107dc1c4; WORD $0xf60c             // vmovupd	(%r14,%rsi,8), %ymm1
+	LONG $0x597581c4; WORD $0xca0c             // vmulpd	(%r10,%r9,8), %ymm1, %ymm1
+	LONG $0xc058f3c5                           // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xe115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm4
+	LONG $0xe058dbc5                           // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm0
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x03a8                               // testb	$3, %al
+	JE   BB0_15
+	LONG $0xfce08348                           // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc7                   // addq	%rax, %rdi
+
+BB0_19:
+	LONG $0x01478d48                           // leaq	1(%rdi), %rax
+	LONG $0x107bc1c4; WORD $0xfe1c             // vmovsd	(%r14,%rdi,8), %xmm3
+	QUAD $0x00000000fd348d48                   // leaq	0(,%rdi,8), %rsi
+	LONG $0xb9e1c2c4; WORD $0xff04             // vfmadd231sd	(%r15,%rdi,8), %xmm3, %xmm0
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JGE  BB0_15
+	LONG $0x02c78348                           // addq	$2, %rdi
+	LONG $0x107bc1c4; WORD $0x365c; BYTE $0x08 // vmovsd	8(%r14,%rsi), %xmm3
+	LONG $0xb9e1c2c4; WORD $0x3744; BYTE $0x08 // vfmadd231sd	8(%r15,%rsi), %xmm3, %xmm0
+	WORD $0x3948; BYTE $0xfa                   // cmpq	%rdi, %rdx
+	JLE  BB0_15
+	LONG $0x107bc1c4; WORD $0x375c; BYTE $0x10 // vmovsd	16(%r15,%rsi), %xmm3
+	LONG $0xb9e1c2c4; WORD $0x3644; BYTE $0x10 // vfmadd231sd	16(%r14,%rsi), %xmm3, %xmm0
+
+BB0_15:
+	LONG $0x117bc1c4; WORD $0x0045 // vmovsd	%xmm0, 0(%r13)
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0x08c58349               // addq	$8, %r13
+	LONG $0x246c394c; BYTE $0x78   // cmpq	%r13, 120(%rsp)
+	JNE  BB0_21
+
+BB0_46:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_44:
+	LONG $0xd0658d48 // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_23:
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0xc931                   // xorl	%ecx, %ecx
+	LONG $0x48fdf162; WORD $0xd128 // vmovapd	%zmm1, %zmm2
+	LONG $0x48fdf162; WORD $0xf128 // vmovapd	%zmm1, %zmm6
+	LONG $0x48fdf162; WORD $0xf928 // vmovapd	%zmm1, %zmm7
+	JMP  BB0_4
+
+BB0_24:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_7
+
+BB0_13:
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x8948; BYTE $0xd0 // movq	%rdx, %rax
+	WORD $0x3145; BYTE $0xe4 // xorl	%r12d, %r12d
+	WORD $0xf631             // xorl	%esi, %esi
+	WORD $0xff31             // xorl	%edi, %edi
+	JMP  BB0_16
+
+BB0_22:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	LONG $0xf84a8d4c         // leaq	-8(%rdx), %r9
+	JMP  BB0_3
+
+BB0_25:
+	WORD $0x8949; BYTE $0xdc // movq	%rbx, %r12
+	WORD $0x8948; BYTE $0xdf // movq	%rbx, %rdi
+	WORD $0xf631             // xorl	%esi, %esi
+	JMP  BB0_16
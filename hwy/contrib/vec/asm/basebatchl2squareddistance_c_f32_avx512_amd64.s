@@ -0,0 +1,248 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basebatchl2squareddistance_c_f32_avx512_amd64.c
+
+TEXT ·batchl2squareddistance_c_f32_avx512(SB), $144-64
+	MOVQ query+0(FP), DI
+	MOVQ data+8(FP), SI
+	MOVQ distances+16(FP), DX
+	MOVQ pcount+24(FP), CX
+	MOVQ pdims+32(FP), R8
+	MOVQ plen_query+40(FP), R9
+	MOVQ plen_data+48(FP), R11
+	MOVQ R11, 128(SP)
+	MOVQ plen_distances+56(FP), R11
+	MOVQ R11, 136(SP)
+	LONG $0x246c8d48; BYTE $0x70 // leaq	112(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x40 // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348             // andq	$-64, %rsp
+	WORD $0x8b48; BYTE $0x19     // movq	(%rcx), %rbx
+	WORD $0x8b49; BYTE $0x00     // movq	(%r8), %rax
+	WORD $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE  BB0_25
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JLE  BB0_25
+	LONG $0x6ef9e1c4; BYTE $0xd2 // vmovq	%rdx, %xmm2
+	LONG $0x18558b48             // movq	24(%rbp), %rdx
+	WORD $0x3b48; BYTE $0x1a     // cmpq	(%rdx), %rbx
+	WORD $0x9f0f; BYTE $0xc2     // setg	%dl
+	WORD $0x3b49; BYTE $0x01     // cmpq	(%r9), %rax
+	WORD $0x9f0f; BYTE $0xc1     // setg	%cl
+	WORD $0xca08                 // orb	%cl, %dl
+	JNE  BB0_25
+	LONG $0x10558b48             // movq	16(%rbp), %rdx
+	WORD $0x8948; BYTE $0xd9     // movq	%rbx, %rcx
+	LONG $0xc8af0f48             // imulq	%rax, %rcx
+	WORD $0x3b48; BYTE $0x0a     // cmpq	(%rdx), %rcx
+	JLE  BB0_28
+
+BB0_25:
+	LONG $0x90658d48 // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_28:
+	WORD $0x8949; BYTE $0xff     // movq	%rdi, %r15
+	LONG $0xf0788d48             // leaq	-16(%rax), %rdi
+	WORD $0x8949; BYTE $0xf6     // movq	%rsi, %r14
+	WORD $0x8948; BYTE $0xc6     // movq	%rax, %rsi
+	LONG $0x04efc148             // shrq	$4, %rdi
+	LONG $0x245c8948; BYTE $0x38 // movq	%rbx, 56(%rsp)
+	WORD $0x3145; BYTE $0xc0     // xorl	%r8d, %r8d
+	WORD $0x3145; BYTE $0xd2     // xorl	%r10d, %r10d
+	LONG $0x01c78348             // addq	$1, %rdi
+	LONG $0xca6f79c5             // vmovdqa	%xmm2, %xmm9
+	WORD $0x8949; BYTE $0xfb     // movq	%rdi, %r11
+	LONG $0x06e7c148             // salq	$6, %rdi
+	LONG $0x04e3c149             // salq	$4, %r11
+	WORD $0x014c; BYTE $0xff     // addq	%r15, %rdi
+	WORD $0x294c; BYTE $0xde     // subq	%r11, %rsi
+	LONG $0xff4e8d48             // leaq	-1(%rsi), %rcx
+	WORD $0x8949; BYTE $0xf1     // movq	%rsi, %r9
+	LONG $0x24748948; BYTE $0x20 // movq	%rsi, 32(%rsp)
+	LONG $0x244c8948; BYTE $0x18 // movq	%rcx, 24(%rsp)
+	WORD $0x8948; BYTE $0xf1     // movq	%rsi, %rcx
+	WORD $0xe683; BYTE $0x0f     // andl	$15, %esi
+	LONG $0x04e9c149             // shrq	$4, %r9
+	LONG $0xf0e18348             // andq	$-16, %rcx
+	LONG $0x24748948; BYTE $0x28 // movq	%rsi, 40(%rsp)
+	LONG $0x06e1c149             // salq	$6, %r9
+	LONG $0x244c8948; BYTE $0x30 // movq	%rcx, 48(%rsp)
+
+BB0_14:
+	LONG $0x861c8d4b             // leaq	(%r14,%r8,4), %rbx
+	LONG $0x0ff88348             // cmpq	$15, %rax
+	JLE  BB0_5
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000010ba; BYTE $0x00 // movl	$16, %edx
+
+BB0_6:
+	QUAD $0xff976410487cd162                   // vmovups	-64(%r15,%rdx,4), %zmm4
+	QUAD $0xff93445c485cf162                   // vsubps	-64(%rbx,%rdx,4), %zmm4, %zmm0
+	LONG $0x10c28348                           // addq	$16, %rdx
+	LONG $0x487df262; WORD $0xc8b8             // vfmadd231ps	%zmm0, %zmm0, %zmm1
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_6
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc158fcc5                           // vaddps	%ymm1, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc128f8c5                           // vmovaps	%xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xd8                   // cmpq	%r11, %rax
+	JLE  BB0_7
+	LONG $0x247c8348; WORD $0x0e18             // cmpq	$14, 24(%rsp)
+	LONG $0x24748b48; BYTE $0x20               // movq	32(%rsp), %rsi
+	JBE  BB0_15
+	LONG $0x03148d4b                           // leaq	(%r11,%r8), %rdx
+	LONG $0x960c8d49                           // leaq	(%r14,%rdx,4), %rcx
+	WORD $0xd231                               // xorl	%edx, %edx
+
+BB0_9:
+	LONG $0x487cf162; WORD $0x2c10; BYTE $0x17 // vmovups	(%rdi,%rdx), %zmm5
+	LONG $0x4854f162; WORD $0x0c5c; BYTE $0x11 // vsubps	(%rcx,%rdx), %zmm5, %zmm1
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x4874f162; WORD $0xc959             // vmulps	%zmm1, %zmm1, %zmm1
+	LONG $0xf1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm6
+	LONG $0xd1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm3
+	LONG $0xc058f2c5                           // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xf058cac5                           // vaddss	%xmm0, %xmm6, %xmm6
+	LONG $0xc115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xf103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm6
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xc819; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xf058cac5                           // vaddss	%xmm0, %xmm6, %xmm6
+	LONG $0x2875f362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm0
+	LONG $0x487df362; WORD $0xc91b; BYTE $0x01 // vextractf32x8	$0x1, %zmm1, %ymm1
+	LONG $0xd1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xf1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm6
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xf115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm6
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xce19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm6
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xf103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm6
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xf103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm6
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd1                   // cmpq	%rdx, %r9
+	JNE  BB0_9
+	LONG $0x244c8b48; BYTE $0x30               // movq	48(%rsp), %rcx
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	WORD $0x014c; BYTE $0xd9                   // addq	%r11, %rcx
+	LONG $0x247c8348; WORD $0x0028             // cmpq	$0, 40(%rsp)
+	JE   BB0_7
+	WORD $0x894d; BYTE $0xdc                   // movq	%r11, %r12
+
+BB0_8:
+	WORD $0x2948; BYTE $0xd6                   // subq	%rdx, %rsi
+	LONG $0xff6e8d4c                           // leaq	-1(%rsi), %r13
+	LONG $0x06fd8349                           // cmpq	$6, %r13
+	JBE  BB0_12
+	WORD $0x014c; BYTE $0xe2                   // addq	%r12, %rdx
+	LONG $0x107cc1c4; WORD $0x9734             // vmovups	(%r15,%rdx,4), %ymm6
+	WORD $0x014c; BYTE $0xc2                   // addq	%r8, %rdx
+	LONG $0x5c4cc1c4; WORD $0x9634             // vsubps	(%r14,%rdx,4), %ymm6, %ymm6
+	WORD $0x8948; BYTE $0xf2                   // movq	%rsi, %rdx
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd1                   // addq	%rdx, %rcx
+	WORD $0xe683; BYTE $0x07                   // andl	$7, %esi
+	LONG $0xf659ccc5                           // vmulps	%ymm6, %ymm6, %ymm6
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	LONG $0xcec6c8c5; BYTE $0x55               // vshufps	$85, %xmm6, %xmm6, %xmm1
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xce15c8c5                           // vunpckhps	%xmm6, %xmm6, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xf119; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm1
+	LONG $0xc758fac5                           // vaddss	%xmm7, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x284df362; WORD $0xce03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x284df362; WORD $0xce03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm1
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xc658fac5                           // vaddss	%xmm6, %xmm0, %xmm0
+	JE   BB0_7
+
+BB0_12:
+	LONG $0x107ac1c4; WORD $0x8f0c             // vmovss	(%r15,%rcx,4), %xmm1
+	LONG $0x0c5cf2c5; BYTE $0x8b               // vsubss	(%rbx,%rcx,4), %xmm1, %xmm1
+	LONG $0x01718d48                           // leaq	1(%rcx), %rsi
+	QUAD $0x000000008d148d48                   // leaq	0(,%rcx,4), %rdx
+	LONG $0xb971e2c4; BYTE $0xc1               // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_7
+	LONG $0x107ac1c4; WORD $0x174c; BYTE $0x04 // vmovss	4(%r15,%rdx), %xmm1
+	LONG $0x4c5cf2c5; WORD $0x0413             // vsubss	4(%rbx,%rdx), %xmm1, %xmm1
+	LONG $0x02718d48                           // leaq	2(%rcx), %rsi
+	LONG $0xb971e2c4; BYTE $0xc1               // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_7
+	LONG $0x107ac1c4; WORD $0x174c; BYTE $0x08 // vmovss	8(%r15,%rdx), %xmm1
+	LONG $0x4c5cf2c5; WORD $0x0813             // vsubss	8(%rbx,%rdx), %xmm1, %xmm1
+	LONG $0x03718d48                           // leaq	3(%rcx), %rsi
+	LONG $0xb971e2c4; BYTE $0xc1               // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_7
+	LONG $0x107ac1c4; WORD $0x174c; BYTE $0x0c // vmovss	12(%r15,%rdx), %xmm1
+	LONG $0x4c5cf2c5; WORD $0x0c13             // vsubss	12(%rbx,%rdx), %xmm1, %xmm1
+	LONG $0x04718d48                           // leaq	4(%rcx), %rsi
+	LONG $0xb971e2c4; BYTE $0xc1               // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_7
+	LONG $0x107ac1c4; WORD $0x174c; BYTE $0x10 // vmovss	16(%r15,%rdx), %xmm1
+	LONG $0x4c5cf2c5; WORD $0x1013             // vsubss	16(%rbx,%rdx), %xmm1, %xmm1
+	LONG $0x05718d48                           // leaq	5(%rcx), %rsi
+	LONG $0xb971e2c4; BYTE $0xc1               // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_7
+	LONG $0x107ac1c4; WORD $0x174c; BYTE $0x14 // vmovss	20(%r15,%rdx), %xmm1
+	LONG $0x4c5cf2c5; WORD $0x1413             // vsubss	20(%rbx,%rdx), %xmm1, %xmm1
+	LONG $0x06c18348                           // addq	$6, %rcx
+	LONG $0xb971e2c4; BYTE $0xc1               // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JLE  BB0_7
+	LONG $0x107ac1c4; WORD $0x174c; BYTE $0x18 // vmovss	24(%r15,%rdx), %xmm1
+	LONG $0x4c5cf2c5; WORD $0x1813             // vsubss	24(%rbx,%rdx), %xmm1, %xmm1
+	LONG $0xb971e2c4; BYTE $0xc1               // vfmadd231ss	%xmm1, %xmm1, %xmm0
+
+BB0_7:
+	LONG $0x7ef961c4; BYTE $0xce   // vmovq	%xmm9, %rsi
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x117aa1c4; WORD $0x9604 // vmovss	%xmm0, (%rsi,%r10,4)
+	LONG $0x01c28349               // addq	$1, %r10
+	LONG $0x2454394c; BYTE $0x38   // cmpq	%r10, 56(%rsp)
+	JG   BB0_14
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	LONG $0x90658d48               // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_5:
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x8948; BYTE $0xc6 // movq	%rax, %rsi
+	WORD $0x3145; BYTE $0xe4 // xorl	%r12d, %r12d
+	WORD $0xd231             // xorl	%edx, %edx
+	WORD $0xc931             // xorl	%ecx, %ecx
+	JMP  BB0_8
+
+BB0_15:
+	WORD $0x894d; BYTE $0xdc // movq	%r11, %r12
+	WORD $0x894c; BYTE $0xd9 // movq	%r11, %rcx
+	WORD $0xd231             // xorl	%edx, %edx
+	JMP  BB0_8
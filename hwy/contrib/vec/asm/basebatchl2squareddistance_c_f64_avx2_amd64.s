@@ -0,0 +1,167 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basebatchl2squareddistance_c_f64_avx2_amd64.c
+
+TEXT ·batchl2squareddistance_c_f64_avx2(SB), $112-64
+	MOVQ query+0(FP), DI
+	MOVQ data+8(FP), SI
+	MOVQ distances+16(FP), DX
+	MOVQ pcount+24(FP), CX
+	MOVQ pdims+32(FP), R8
+	MOVQ plen_query+40(FP), R9
+	MOVQ plen_data+48(FP), R11
+	MOVQ R11, 96(SP)
+	MOVQ plen_distances+56(FP), R11
+	MOVQ R11, 104(SP)
+	LONG $0x246c8d48; BYTE $0x50 // leaq	80(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x20 // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348             // andq	$-32, %rsp
+	WORD $0x8b4c; BYTE $0x39     // movq	(%rcx), %r15
+	WORD $0x8b49; BYTE $0x08     // movq	(%r8), %rcx
+	LONG $0x24548948; BYTE $0x38 // movq	%rdx, 56(%rsp)
+	WORD $0x854d; BYTE $0xff     // testq	%r15, %r15
+	JLE  BB0_25
+	WORD $0x8548; BYTE $0xc9     // testq	%rcx, %rcx
+	JLE  BB0_25
+	LONG $0x18558b48             // movq	24(%rbp), %rdx
+	WORD $0x8948; BYTE $0xf3     // movq	%rsi, %rbx
+	WORD $0x3b4c; BYTE $0x3a     // cmpq	(%rdx), %r15
+	WORD $0x9f0f; BYTE $0xc2     // setg	%dl
+	WORD $0x3b49; BYTE $0x09     // cmpq	(%r9), %rcx
+	LONG $0xc69f0f40             // setg	%sil
+	WORD $0x0840; BYTE $0xf2     // orb	%sil, %dl
+	JNE  BB0_25
+	LONG $0x10558b48             // movq	16(%rbp), %rdx
+	WORD $0x894c; BYTE $0xfe     // movq	%r15, %rsi
+	LONG $0xf1af0f48             // imulq	%rcx, %rsi
+	WORD $0x3b48; BYTE $0x32     // cmpq	(%rdx), %rsi
+	JLE  BB0_28
+
+BB0_25:
+	LONG $0xb0658d48 // leaq	-80(%rbp), %rsp
+	RET
+
+BB0_28:
+	LONG $0xfc498d4c             // leaq	-4(%rcx), %r9
+	WORD $0x8948; BYTE $0xca     // movq	%rcx, %rdx
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0x247c894c; BYTE $0x30 // movq	%r15, 48(%rsp)
+	LONG $0x02e9c149             // shrq	$2, %r9
+	WORD $0x3145; BYTE $0xdb     // xorl	%r11d, %r11d
+	WORD $0x3145; BYTE $0xe4     // xorl	%r12d, %r12d
+	LONG $0x01c18349             // addq	$1, %r9
+	QUAD $0x000000008d348d4e     // leaq	0(,%r9,4), %r14
+	LONG $0x05e1c149             // salq	$5, %r9
+	WORD $0x294c; BYTE $0xf2     // subq	%r14, %rdx
+	WORD $0x0149; BYTE $0xc1     // addq	%rax, %r9
+	LONG $0xff7a8d48             // leaq	-1(%rdx), %rdi
+	WORD $0x8949; BYTE $0xd2     // movq	%rdx, %r10
+	LONG $0x24548948; BYTE $0x20 // movq	%rdx, 32(%rsp)
+	LONG $0x247c8948; BYTE $0x18 // movq	%rdi, 24(%rsp)
+	WORD $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	LONG $0xfce28348             // andq	$-4, %rdx
+	LONG $0x02eac149             // shrq	$2, %r10
+	WORD $0xe783; BYTE $0x03     // andl	$3, %edi
+	LONG $0x24548948; BYTE $0x10 // movq	%rdx, 16(%rsp)
+	LONG $0x05e2c149             // salq	$5, %r10
+	LONG $0x247c8948; BYTE $0x28 // movq	%rdi, 40(%rsp)
+
+BB0_11:
+	LONG $0xdb148d4a             // leaq	(%rbx,%r11,8), %rdx
+	LONG $0x03f98348             // cmpq	$3, %rcx
+	JLE  BB0_3
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000004be; BYTE $0x00 // movl	$4, %esi
+
+BB0_4:
+	LONG $0x6410fdc5; WORD $0xe0f0 // vmovupd	-32(%rax,%rsi,8), %ymm4
+	LONG $0x445cddc5; WORD $0xe0f2 // vsubpd	-32(%rdx,%rsi,8), %ymm4, %ymm0
+	LONG $0x04c68348               // addq	$4, %rsi
+	LONG $0xb8fde2c4; BYTE $0xc8   // vfmadd231pd	%ymm0, %ymm0, %ymm1
+	WORD $0x3948; BYTE $0xce       // cmpq	%rcx, %rsi
+	JLE  BB0_4
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xf1       // cmpq	%r14, %rcx
+	JLE  BB0_5
+	LONG $0x247c8348; WORD $0x0218 // cmpq	$2, 24(%rsp)
+	LONG $0x24448b4c; BYTE $0x20   // movq	32(%rsp), %r8
+	JBE  BB0_12
+	LONG $0x33348d4b               // leaq	(%r11,%r14), %rsi
+	LONG $0xf33c8d48               // leaq	(%rbx,%rsi,8), %rdi
+	WORD $0xf631                   // xorl	%esi, %esi
+
+BB0_7:
+	LONG $0x107dc1c4; WORD $0x312c // vmovupd	(%r9,%rsi), %ymm5
+	LONG $0x0c5cd5c5; BYTE $0x37   // vsubpd	(%rdi,%rsi), %ymm5, %ymm1
+	LONG $0x20c68348               // addq	$32, %rsi
+	LONG $0xd159f5c5               // vmulpd	%ymm1, %ymm1, %ymm2
+	LONG $0xc258fbc5               // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xda15e9c5               // vunpckhpd	%xmm2, %xmm2, %xmm3
+	LONG $0x197de3c4; WORD $0x01d1 // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd858e3c5               // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f3c5               // vaddsd	%xmm3, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xd6       // cmpq	%r10, %rsi
+	JNE  BB0_7
+	LONG $0x247c8348; WORD $0x0028 // cmpq	$0, 40(%rsp)
+	JE   BB0_5
+	LONG $0x247c8b48; BYTE $0x10   // movq	16(%rsp), %rdi
+	WORD $0x8949; BYTE $0xfd       // movq	%rdi, %r13
+	LONG $0x37348d4a               // leaq	(%rdi,%r14), %rsi
+	WORD $0x894c; BYTE $0xf7       // movq	%r14, %rdi
+
+BB0_6:
+	WORD $0x294d; BYTE $0xe8       // subq	%r13, %r8
+	LONG $0x01f88349               // cmpq	$1, %r8
+	JE   BB0_9
+	LONG $0x2f3c8d4e               // leaq	(%rdi,%r13), %r15
+	WORD $0x014c; BYTE $0xdf       // addq	%r11, %rdi
+	WORD $0x014c; BYTE $0xef       // addq	%r13, %rdi
+	LONG $0x1079a1c4; WORD $0xf80c // vmovupd	(%rax,%r15,8), %xmm1
+	LONG $0x0c5cf1c5; BYTE $0xfb   // vsubpd	(%rbx,%rdi,8), %xmm1, %xmm1
+	LONG $0xc959f1c5               // vmulpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0x01c0f641               // testb	$1, %r8b
+	JE   BB0_5
+	LONG $0xfee08349               // andq	$-2, %r8
+	WORD $0x014c; BYTE $0xc6       // addq	%r8, %rsi
+
+BB0_9:
+	LONG $0x0c10fbc5; BYTE $0xf0 // vmovsd	(%rax,%rsi,8), %xmm1
+	LONG $0x0c5cf3c5; BYTE $0xf2 // vsubsd	(%rdx,%rsi,8), %xmm1, %xmm1
+	LONG $0xb9f1e2c4; BYTE $0xc1 // vfmadd231sd	%xmm1, %xmm1, %xmm0
+
+BB0_5:
+	LONG $0x247c8b48; BYTE $0x38   // movq	56(%rsp), %rdi
+	WORD $0x0149; BYTE $0xcb       // addq	%rcx, %r11
+	LONG $0x117ba1c4; WORD $0xe704 // vmovsd	%xmm0, (%rdi,%r12,8)
+	LONG $0x01c48349               // addq	$1, %r12
+	LONG $0x2464394c; BYTE $0x30   // cmpq	%r12, 48(%rsp)
+	JG   BB0_11
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	LONG $0xb0658d48               // leaq	-80(%rbp), %rsp
+	RET
+
+BB0_3:
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x8949; BYTE $0xc8 // movq	%rcx, %r8
+	WORD $0xff31             // xorl	%edi, %edi
+	WORD $0x3145; BYTE $0xed // xorl	%r13d, %r13d
+	WORD $0xf631             // xorl	%esi, %esi
+	JMP  BB0_6
+
+BB0_12:
+	WORD $0x894c; BYTE $0xf7 // movq	%r14, %rdi
+	WORD $0x894c; BYTE $0xf6 // movq	%r14, %rsi
+	WORD $0x3145; BYTE $0xed // xorl	%r13d, %r13d
+	JMP  BB0_6
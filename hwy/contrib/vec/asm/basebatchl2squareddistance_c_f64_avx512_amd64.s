@@ -0,0 +1,197 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basebatchl2squareddistance_c_f64_avx512_amd64.c
+
+TEXT ·batchl2squareddistance_c_f64_avx512(SB), $144-64
+	MOVQ query+0(FP), DI
+	MOVQ data+8(FP), SI
+	MOVQ distances+16(FP), DX
+	MOVQ pcount+24(FP), CX
+	MOVQ pdims+32(FP), R8
+	MOVQ plen_query+40(FP), R9
+	MOVQ plen_data+48(FP), R11
+	MOVQ R11, 128(SP)
+	MOVQ plen_distances+56(FP), R11
+	MOVQ R11, 136(SP)
+	LONG $0x246c8d48; BYTE $0x70 // leaq	112(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x40 // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348             // andq	$-64, %rsp
+	WORD $0x8b48; BYTE $0x19     // movq	(%rcx), %rbx
+	WORD $0x8b49; BYTE $0x00     // movq	(%r8), %rax
+	WORD $0x8548; BYTE $0xdb     // testq	%rbx, %rbx
+	JLE  BB0_22
+	WORD $0x8548; BYTE $0xc0     // testq	%rax, %rax
+	JLE  BB0_22
+	LONG $0x6ef9e1c4; BYTE $0xd2 // vmovq	%rdx, %xmm2
+	LONG $0x18558b48             // movq	24(%rbp), %rdx
+	WORD $0x3b48; BYTE $0x1a     // cmpq	(%rdx), %rbx
+	WORD $0x9f0f; BYTE $0xc2     // setg	%dl
+	WORD $0x3b49; BYTE $0x01     // cmpq	(%r9), %rax
+	WORD $0x9f0f; BYTE $0xc1     // setg	%cl
+	WORD $0xca08                 // orb	%cl, %dl
+	JNE  BB0_22
+	LONG $0x10558b48             // movq	16(%rbp), %rdx
+	WORD $0x8948; BYTE $0xd9     // movq	%rbx, %rcx
+	LONG $0xc8af0f48             // imulq	%rax, %rcx
+	WORD $0x3b48; BYTE $0x0a     // cmpq	(%rdx), %rcx
+	JLE  BB0_25
+
+BB0_22:
+	LONG $0x90658d48 // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_25:
+	WORD $0x8949; BYTE $0xff     // movq	%rdi, %r15
+	LONG $0xf8788d48             // leaq	-8(%rax), %rdi
+	WORD $0x8949; BYTE $0xf6     // movq	%rsi, %r14
+	WORD $0x8948; BYTE $0xc6     // movq	%rax, %rsi
+	LONG $0x03efc148             // shrq	$3, %rdi
+	LONG $0x245c8948; BYTE $0x38 // movq	%rbx, 56(%rsp)
+	WORD $0x3145; BYTE $0xc0     // xorl	%r8d, %r8d
+	WORD $0x3145; BYTE $0xd2     // xorl	%r10d, %r10d
+	LONG $0x01c78348             // addq	$1, %rdi
+	LONG $0xd26f79c5             // vmovdqa	%xmm2, %xmm10
+	QUAD $0x00000000fd1c8d4c     // leaq	0(,%rdi,8), %r11
+	LONG $0x06e7c148             // salq	$6, %rdi
+	WORD $0x294c; BYTE $0xde     // subq	%r11, %rsi
+	WORD $0x014c; BYTE $0xff     // addq	%r15, %rdi
+	LONG $0xff4e8d48             // leaq	-1(%rsi), %rcx
+	WORD $0x8949; BYTE $0xf1     // movq	%rsi, %r9
+	LONG $0x24748948; BYTE $0x20 // movq	%rsi, 32(%rsp)
+	LONG $0x244c8948; BYTE $0x18 // movq	%rcx, 24(%rsp)
+	WORD $0x8948; BYTE $0xf1     // movq	%rsi, %rcx
+	WORD $0xe683; BYTE $0x07     // andl	$7, %esi
+	LONG $0x03e9c149             // shrq	$3, %r9
+	LONG $0xf8e18348             // andq	$-8, %rcx
+	LONG $0x24748948; BYTE $0x28 // movq	%rsi, 40(%rsp)
+	LONG $0x06e1c149             // salq	$6, %r9
+	LONG $0x244c8948; BYTE $0x30 // movq	%rcx, 48(%rsp)
+
+BB0_11:
+	LONG $0xc62c8d4f             // leaq	(%r14,%r8,8), %r13
+	LONG $0x07f88348             // cmpq	$7, %rax
+	JLE  BB0_3
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000008ba; BYTE $0x00 // movl	$8, %edx
+
+BB0_4:
+	QUAD $0xffd76c1048fdd162                   // vmovupd	-64(%r15,%rdx,8), %zmm5
+	QUAD $0xffd5445c48d5d162                   // vsubpd	-64(%r13,%rdx,8), %zmm5, %zmm0
+	LONG $0x08c28348                           // addq	$8, %rdx
+	LONG $0x48fdf262; WORD $0xc8b8             // vfmadd231pd	%zmm0, %zmm0, %zmm1
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_4
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm1
+	LONG $0xc858f1c5                           // vaddpd	%xmm0, %xmm1, %xmm1
+	LONG $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xd8                   // cmpq	%r11, %rax
+	JLE  BB0_5
+	LONG $0x247c8348; WORD $0x0618             // cmpq	$6, 24(%rsp)
+	LONG $0x24748b48; BYTE $0x20               // movq	32(%rsp), %rsi
+	JBE  BB0_12
+	LONG $0x03148d4b                           // leaq	(%r11,%r8), %rdx
+	LONG $0xd60c8d49                           // leaq	(%r14,%rdx,8), %rcx
+	WORD $0xd231                               // xorl	%edx, %edx
+
+BB0_7:
+	LONG $0x48fdf162; WORD $0x3c10; BYTE $0x17 // vmovupd	(%rdi,%rdx), %zmm7
+	LONG $0x48c5f162; WORD $0x0c5c; BYTE $0x11 // vsubpd	(%rcx,%rdx), %zmm7, %zmm1
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x48f5f162; WORD $0xd159             // vmulpd	%zmm1, %zmm1, %zmm2
+	LONG $0x28edf362; WORD $0xda03; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm3
+	LONG $0xc058ebc5                           // vaddsd	%xmm0, %xmm2, %xmm0
+	LONG $0xe215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm4
+	LONG $0x48fdf362; WORD $0xd11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm1
+	LONG $0x28fdf362; WORD $0xce19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm6
+	LONG $0xe058dbc5                           // vaddsd	%xmm0, %xmm4, %xmm4
+	LONG $0x28fdf362; WORD $0xd019; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm0
+	LONG $0xd115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0xc458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm0
+	LONG $0xd858e3c5                           // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f3c5                           // vaddsd	%xmm3, %xmm1, %xmm0
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd1                   // cmpq	%rdx, %r9
+	JNE  BB0_7
+	LONG $0x245c8b48; BYTE $0x30               // movq	48(%rsp), %rbx
+	LONG $0x247c8348; WORD $0x0028             // cmpq	$0, 40(%rsp)
+	WORD $0x8948; BYTE $0xda                   // movq	%rbx, %rdx
+	LONG $0x1b0c8d4a                           // leaq	(%rbx,%r11), %rcx
+	JE   BB0_5
+	WORD $0x894d; BYTE $0xdc                   // movq	%r11, %r12
+
+BB0_6:
+	WORD $0x2948; BYTE $0xd6                   // subq	%rdx, %rsi
+	LONG $0xff5e8d48                           // leaq	-1(%rsi), %rbx
+	LONG $0x02fb8348                           // cmpq	$2, %rbx
+	JBE  BB0_9
+	WORD $0x014c; BYTE $0xe2                   // addq	%r12, %rdx
+	LONG $0x107dc1c4; WORD $0xd70c             // vmovupd	(%r15,%rdx,8), %ymm1
+	WORD $0x014c; BYTE $0xc2                   // addq	%r8, %rdx
+	LONG $0x5c75c1c4; WORD $0xd60c             // vsubpd	(%r14,%rdx,8), %ymm1, %ymm1
+	WORD $0x8948; BYTE $0xf2                   // movq	%rsi, %rdx
+	LONG $0xfce28348                           // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd1                   // addq	%rdx, %rcx
+	WORD $0xe683; BYTE $0x03                   // andl	$3, %esi
+	LONG $0xc959f5c5                           // vmulpd	%ymm1, %ymm1, %ymm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xf115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm6
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0x28fdf362; WORD $0xce19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm6
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc658fbc5                           // vaddsd	%xmm6, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	JE   BB0_5
+
+BB0_9:
+	LONG $0x107bc1c4; WORD $0xcf0c             // vmovsd	(%r15,%rcx,8), %xmm1
+	LONG $0x5c73c1c4; WORD $0xcd4c; BYTE $0x00 // vsubsd	0(%r13,%rcx,8), %xmm1, %xmm1
+	LONG $0x01718d48                           // leaq	1(%rcx), %rsi
+	QUAD $0x00000000cd148d48                   // leaq	0(,%rcx,8), %rdx
+	LONG $0xb9f1e2c4; BYTE $0xc1               // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_5
+	LONG $0x107bc1c4; WORD $0x174c; BYTE $0x08 // vmovsd	8(%r15,%rdx), %xmm1
+	LONG $0x5c73c1c4; WORD $0x154c; BYTE $0x08 // vsubsd	8(%r13,%rdx), %xmm1, %xmm1
+	LONG $0x02c18348                           // addq	$2, %rcx
+	LONG $0xb9f1e2c4; BYTE $0xc1               // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JLE  BB0_5
+	LONG $0x107bc1c4; WORD $0x174c; BYTE $0x10 // vmovsd	16(%r15,%rdx), %xmm1
+	LONG $0x5c73c1c4; WORD $0x154c; BYTE $0x10 // vsubsd	16(%r13,%rdx), %xmm1, %xmm1
+	LONG $0xb9f1e2c4; BYTE $0xc1               // vfmadd231sd	%xmm1, %xmm1, %xmm0
+
+BB0_5:
+	LONG $0x7ef961c4; BYTE $0xd3   // vmovq	%xmm10, %rbx
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x117ba1c4; WORD $0xd304 // vmovsd	%xmm0, (%rbx,%r10,8)
+	LONG $0x01c28349               // addq	$1, %r10
+	LONG $0x2454394c; BYTE $0x38   // cmpq	%r10, 56(%rsp)
+	JG   BB0_11
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	LONG $0x90658d48               // leaq	-112(%rbp), %rsp
+	RET
+
+BB0_3:
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x8948; BYTE $0xc6 // movq	%rax, %rsi
+	WORD $0x3145; BYTE $0xe4 // xorl	%r12d, %r12d
+	WORD $0xd231             // xorl	%edx, %edx
+	WORD $0xc931             // xorl	%ecx, %ecx
+	JMP  BB0_6
+
+BB0_12:
+	WORD $0x894d; BYTE $0xdc // movq	%r11, %r12
+	WORD $0x894c; BYTE $0xd9 // movq	%r11, %rcx
+	WORD $0xd231             // xorl	%edx, %edx
+	JMP  BB0_6
@@ -0,0 +1,531 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basebatchl2squareddistanceblocked_c_f32_avx2_amd64.c
+
+TEXT ·batchl2squareddistanceblocked_c_f32_avx2(SB), $208-64
+	MOVQ query+0(FP), DI
+	MOVQ data+8(FP), SI
+	MOVQ distances+16(FP), DX
+	MOVQ pcount+24(FP), CX
+	MOVQ pdims+32(FP), R8
+	MOVQ plen_query+40(FP), R9
+	MOVQ plen_data+48(FP), R11
+	MOVQ R11, 192(SP)
+	MOVQ plen_distances+56(FP), R11
+	MOVQ R11, 200(SP)
+	QUAD $0x000000b024ac8d48                   // leaq	176(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x20               // leaq	32(%rsp), %rsp
+	LONG $0xe0e48348                           // andq	$-32, %rsp
+	WORD $0x8b48; BYTE $0x01                   // movq	(%rcx), %rax
+	WORD $0x8b4d; BYTE $0x30                   // movq	(%r8), %r14
+	WORD $0x8548; BYTE $0xc0                   // testq	%rax, %rax
+	JLE  BB0_44
+	WORD $0x854d; BYTE $0xf6                   // testq	%r14, %r14
+	JLE  BB0_44
+	WORD $0x8949; BYTE $0xf5                   // movq	%rsi, %r13
+	WORD $0x8948; BYTE $0xd6                   // movq	%rdx, %rsi
+	LONG $0x10558b48                           // movq	16(%rbp), %rdx
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	LONG $0xceaf0f49                           // imulq	%r14, %rcx
+	WORD $0x3b48; BYTE $0x0a                   // cmpq	(%rdx), %rcx
+	JG   BB0_44
+	LONG $0x18558b48                           // movq	24(%rbp), %rdx
+	WORD $0x3b48; BYTE $0x02                   // cmpq	(%rdx), %rax
+	JG   BB0_44
+	WORD $0x3b4d; BYTE $0x31                   // cmpq	(%r9), %r14
+	JG   BB0_44
+	WORD $0x8949; BYTE $0xff                   // movq	%rdi, %r15
+	LONG $0x03f88348                           // cmpq	$3, %rax
+	JLE  BB0_22
+	LONG $0xfc508d48                           // leaq	-4(%rax), %rdx
+	WORD $0x894c; BYTE $0xf3                   // movq	%r14, %rbx
+	LONG $0x24748948; BYTE $0x68               // movq	%rsi, 104(%rsp)
+	WORD $0x894d; BYTE $0xea                   // movq	%r13, %r10
+	QUAD $0x00000000b50c8d4a                   // leaq	0(,%r14,4), %rcx
+	LONG $0x04e3c148                           // salq	$4, %rbx
+	LONG $0x24448948; BYTE $0x28               // movq	%rax, 40(%rsp)
+	WORD $0x894d; BYTE $0xeb                   // movq	%r13, %r11
+	LONG $0x244c8948; BYTE $0x48               // movq	%rcx, 72(%rsp)
+	WORD $0x8948; BYTE $0xd1                   // movq	%rdx, %rcx
+	LONG $0xf54c8d4f; BYTE $0x00               // leaq	0(%r13,%r14,8), %r9
+	LONG $0x02e9c148                           // shrq	$2, %rcx
+	LONG $0x245c8948; BYTE $0x50               // movq	%rbx, 80(%rsp)
+	LONG $0x361c8d4b                           // leaq	(%r14,%r14), %rbx
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	QUAD $0x00000090249c8948                   // movq	%rbx, 144(%rsp)
+	WORD $0x014c; BYTE $0xf3                   // addq	%r14, %rbx
+	LONG $0x04e2c148                           // salq	$4, %rdx
+	LONG $0x245c8948; BYTE $0x38               // movq	%rbx, 56(%rsp)
+	LONG $0x167c8d48; BYTE $0x10               // leaq	16(%rsi,%rdx), %rdi
+	LONG $0x244c8948; BYTE $0x20               // movq	%rcx, 32(%rsp)
+	LONG $0x247c8948; BYTE $0x40               // movq	%rdi, 64(%rsp)
+	LONG $0xf87e8d49                           // leaq	-8(%r14), %rdi
+	WORD $0x8948; BYTE $0xfa                   // movq	%rdi, %rdx
+	LONG $0x24748948; BYTE $0x18               // movq	%rsi, 24(%rsp)
+	LONG $0x03eac148                           // shrq	$3, %rdx
+	LONG $0x247c8948; BYTE $0x10               // movq	%rdi, 16(%rsp)
+	QUAD $0x00000008d5148d48                   // leaq	8(,%rdx,8), %rdx
+	QUAD $0x000000982484c748; LONG $0x00000000 // movq	$0, 152(%rsp)
+	LONG $0x24548948; BYTE $0x30               // movq	%rdx, 48(%rsp)
+
+BB0_12:
+	QUAD $0x0000009824848b48     // movq	152(%rsp), %rax
+	QUAD $0x0000009024b48b48     // movq	144(%rsp), %rsi
+	WORD $0x014c; BYTE $0xf0     // addq	%r14, %rax
+	WORD $0x014c; BYTE $0xf6     // addq	%r14, %rsi
+	QUAD $0x0000008824848948     // movq	%rax, 136(%rsp)
+	LONG $0x24448b48; BYTE $0x48 // movq	72(%rsp), %rax
+	QUAD $0x0000008024b48948     // movq	%rsi, 128(%rsp)
+	LONG $0x020c8d49             // leaq	(%r10,%rax), %rcx
+	LONG $0x01348d49             // leaq	(%r9,%rax), %rsi
+	LONG $0x07fe8349             // cmpq	$7, %r14
+	JLE  BB0_23
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	LONG $0xf928fcc5             // vmovaps	%ymm1, %ymm7
+	LONG $0xe928fcc5             // vmovaps	%ymm1, %ymm5
+	LONG $0xf128fcc5             // vmovaps	%ymm1, %ymm6
+
+BB0_5:
+	LONG $0x107cc1c4; WORD $0x8744; BYTE $0xe0 // vmovups	-32(%r15,%rax,4), %ymm0
+	LONG $0x5c7cc1c4; WORD $0x8264; BYTE $0xe0 // vsubps	-32(%r10,%rax,4), %ymm0, %ymm4
+	LONG $0x5c5cfcc5; WORD $0xe081             // vsubps	-32(%rcx,%rax,4), %ymm0, %ymm3
+	LONG $0x5c7cc1c4; WORD $0x8154; BYTE $0xe0 // vsubps	-32(%r9,%rax,4), %ymm0, %ymm2
+	LONG $0x445cfcc5; WORD $0xe086             // vsubps	-32(%rsi,%rax,4), %ymm0, %ymm0
+	LONG $0x08c08348                           // addq	$8, %rax
+	LONG $0xb85de2c4; BYTE $0xf4               // vfmadd231ps	%ymm4, %ymm4, %ymm6
+	LONG $0xb865e2c4; BYTE $0xeb               // vfmadd231ps	%ymm3, %ymm3, %ymm5
+	LONG $0xb86de2c4; BYTE $0xfa               // vfmadd231ps	%ymm2, %ymm2, %ymm7
+	LONG $0xb87de2c4; BYTE $0xc8               // vfmadd231ps	%ymm0, %ymm0, %ymm1
+	WORD $0x394c; BYTE $0xf0                   // cmpq	%r14, %rax
+	JLE  BB0_5
+	LONG $0x24548b48; BYTE $0x30               // movq	48(%rsp), %rdx
+
+BB0_4:
+	LONG $0x197de3c4; WORD $0x01f0 // vextractf128	$0x1, %ymm6, %xmm0
+	LONG $0xc658f8c5               // vaddps	%xmm6, %xmm0, %xmm0
+	LONG $0xd012f8c5               // vmovhlps	%xmm0, %xmm0, %xmm2
+	LONG $0xc258f8c5               // vaddps	%xmm2, %xmm0, %xmm0
+	LONG $0xd016fac5               // vmovshdup	%xmm0, %xmm2
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01ea // vextractf128	$0x1, %ymm5, %xmm2
+	LONG $0xd558e8c5               // vaddps	%xmm5, %xmm2, %xmm2
+	LONG $0xda12e8c5               // vmovhlps	%xmm2, %xmm2, %xmm3
+	LONG $0xd358e8c5               // vaddps	%xmm3, %xmm2, %xmm2
+	LONG $0xda16fac5               // vmovshdup	%xmm2, %xmm3
+	LONG $0xe358eac5               // vaddss	%xmm3, %xmm2, %xmm4
+	LONG $0x197de3c4; WORD $0x01fb // vextractf128	$0x1, %ymm7, %xmm3
+	LONG $0xd758e0c5               // vaddps	%xmm7, %xmm3, %xmm2
+	LONG $0xc414f8c5               // vunpcklps	%xmm4, %xmm0, %xmm0
+	LONG $0xda12e8c5               // vmovhlps	%xmm2, %xmm2, %xmm3
+	LONG $0xd358e8c5               // vaddps	%xmm3, %xmm2, %xmm2
+	LONG $0xda16fac5               // vmovshdup	%xmm2, %xmm3
+	LONG $0xd358eac5               // vaddss	%xmm3, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01cb // vextractf128	$0x1, %ymm1, %xmm3
+	LONG $0xcb58f0c5               // vaddps	%xmm3, %xmm1, %xmm1
+	LONG $0xd912f0c5               // vmovhlps	%xmm1, %xmm1, %xmm3
+	LONG $0xc958e0c5               // vaddps	%xmm1, %xmm3, %xmm1
+	LONG $0xd916fac5               // vmovshdup	%xmm1, %xmm3
+	LONG $0xcb58f2c5               // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xd114e8c5               // vunpcklps	%xmm1, %xmm2, %xmm2
+	LONG $0xc216f8c5               // vmovlhps	%xmm2, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd6       // cmpq	%rdx, %r14
+	JLE  BB0_6
+	WORD $0x894c; BYTE $0xf7       // movq	%r14, %rdi
+	LONG $0x24548948; BYTE $0x70   // movq	%rdx, 112(%rsp)
+	WORD $0x2948; BYTE $0xd7       // subq	%rdx, %rdi
+	LONG $0xff478d48               // leaq	-1(%rdi), %rax
+	LONG $0x247c8948; BYTE $0x78   // movq	%rdi, 120(%rsp)
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_24
+	QUAD $0x0000009824848b48       // movq	152(%rsp), %rax
+	QUAD $0x0000008024848b4c       // movq	128(%rsp), %r8
+	LONG $0x03efc148               // shrq	$3, %rdi
+	LONG $0x972c8d4d               // leaq	(%r15,%rdx,4), %r13
+	LONG $0x2474894c; BYTE $0x58   // movq	%r14, 88(%rsp)
+	LONG $0x05e7c148               // salq	$5, %rdi
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x83248d4d               // leaq	(%r11,%rax,4), %r12
+	QUAD $0x0000008824848b48       // movq	136(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x831c8d49               // leaq	(%r11,%rax,4), %rbx
+	QUAD $0x0000009024848b48       // movq	144(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x83048d49               // leaq	(%r11,%rax,4), %rax
+	LONG $0x24448948; BYTE $0x60   // movq	%rax, 96(%rsp)
+	LONG $0x02048d4a               // leaq	(%rdx,%r8), %rax
+	LONG $0x24748b4c; BYTE $0x60   // movq	96(%rsp), %r14
+	LONG $0x83048d4d               // leaq	(%r11,%rax,4), %r8
+	WORD $0xc031                   // xorl	%eax, %eax
+
+BB0_8:
+	LONG $0x107cc1c4; WORD $0x0554; BYTE $0x00 // vmovups	0(%r13,%rax), %ymm2
+	LONG $0x5c6cc1c4; WORD $0x040c             // vsubps	(%r12,%rax), %ymm2, %ymm1
+	LONG $0x2c5cecc5; BYTE $0x03               // vsubps	(%rbx,%rax), %ymm2, %ymm5
+	LONG $0x5c6cc1c4; WORD $0x0624             // vsubps	(%r14,%rax), %ymm2, %ymm4
+	LONG $0x5c6cc1c4; WORD $0x0014             // vsubps	(%r8,%rax), %ymm2, %ymm2
+	LONG $0x20c08348                           // addq	$32, %rax
+	LONG $0xd959f4c5                           // vmulps	%ymm1, %ymm1, %ymm3
+	LONG $0xed59d4c5                           // vmulps	%ymm5, %ymm5, %ymm5
+	LONG $0xe459dcc5                           // vmulps	%ymm4, %ymm4, %ymm4
+	LONG $0xd259ecc5                           // vmulps	%ymm2, %ymm2, %ymm2
+	LONG $0xf3c6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm6
+	LONG $0xcd14e0c5                           // vunpcklps	%xmm5, %xmm3, %xmm1
+	LONG $0xddc650c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm11
+	LONG $0xcdc650c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm9
+	LONG $0x1448c1c4; BYTE $0xf1               // vunpcklps	%xmm9, %xmm6, %xmm6
+	LONG $0xfcc6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm7
+	LONG $0xd21458c5                           // vunpcklps	%xmm2, %xmm4, %xmm10
+	LONG $0xe2c668c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm12
+	LONG $0xc2c668c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm8
+	LONG $0x1440c1c4; BYTE $0xf8               // vunpcklps	%xmm8, %xmm7, %xmm7
+	LONG $0x1670c1c4; BYTE $0xca               // vmovlhps	%xmm10, %xmm1, %xmm1
+	LONG $0xd4c658c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm10
+	LONG $0x142841c4; BYTE $0xd4               // vunpcklps	%xmm12, %xmm10, %xmm10
+	LONG $0xe21568c5                           // vunpckhps	%xmm2, %xmm2, %xmm12
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0xcbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm1
+	LONG $0x1470c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0xdd1550c5                           // vunpckhps	%xmm5, %xmm5, %xmm11
+	LONG $0x1670c1c4; BYTE $0xca               // vmovlhps	%xmm10, %xmm1, %xmm1
+	LONG $0xd41558c5                           // vunpckhps	%xmm4, %xmm4, %xmm10
+	LONG $0xf716c8c5                           // vmovlhps	%xmm7, %xmm6, %xmm6
+	LONG $0x142841c4; BYTE $0xd4               // vunpcklps	%xmm12, %xmm10, %xmm10
+	LONG $0x197de3c4; WORD $0x01ed             // vextractf128	$0x1, %ymm5, %xmm5
+	LONG $0x197de3c4; WORD $0x01e4             // vextractf128	$0x1, %ymm4, %xmm4
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xcb15e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm1
+	LONG $0x197de3c4; WORD $0x01d2             // vextractf128	$0x1, %ymm2, %xmm2
+	LONG $0xfdc6d0c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm7
+	LONG $0x1470c1c4; BYTE $0xcb               // vunpcklps	%xmm11, %xmm1, %xmm1
+	LONG $0xc2c668c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm8
+	LONG $0x1670c1c4; BYTE $0xca               // vmovlhps	%xmm10, %xmm1, %xmm1
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01d9             // vextractf128	$0x1, %ymm3, %xmm1
+	LONG $0xdd14f0c5                           // vunpcklps	%xmm5, %xmm1, %xmm3
+	LONG $0xc658f8c5                           // vaddps	%xmm6, %xmm0, %xmm0
+	LONG $0xf214d8c5                           // vunpcklps	%xmm2, %xmm4, %xmm6
+	LONG $0xde16e0c5                           // vmovlhps	%xmm6, %xmm3, %xmm3
+	LONG $0xf4c6d8c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm6
+	LONG $0x1448c1c4; BYTE $0xf0               // vunpcklps	%xmm8, %xmm6, %xmm6
+	LONG $0xc21568c5                           // vunpckhps	%xmm2, %xmm2, %xmm8
+	LONG $0xd2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm2
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0xfd15d0c5                           // vunpckhps	%xmm5, %xmm5, %xmm7
+	LONG $0xde16e0c5                           // vmovlhps	%xmm6, %xmm3, %xmm3
+	LONG $0xf415d8c5                           // vunpckhps	%xmm4, %xmm4, %xmm6
+	LONG $0xedc6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0xe4c6d8c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm4
+	LONG $0x1448c1c4; BYTE $0xf0               // vunpcklps	%xmm8, %xmm6, %xmm6
+	LONG $0xe214d8c5                           // vunpcklps	%xmm2, %xmm4, %xmm4
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xd915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0xc9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xcd14f0c5                           // vunpcklps	%xmm5, %xmm1, %xmm1
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0xcc16f0c5                           // vmovlhps	%xmm4, %xmm1, %xmm1
+	LONG $0xde16e0c5                           // vmovlhps	%xmm6, %xmm3, %xmm3
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc7                   // cmpq	%rax, %rdi
+	JNE  BB0_8
+	LONG $0x245c8b48; BYTE $0x78               // movq	120(%rsp), %rbx
+	LONG $0x24748b4c; BYTE $0x58               // movq	88(%rsp), %r14
+	WORD $0x8948; BYTE $0xd8                   // movq	%rbx, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2                   // addq	%rax, %rdx
+	WORD $0xe383; BYTE $0x07                   // andl	$7, %ebx
+	JE   BB0_6
+
+BB0_7:
+	LONG $0x247c8b48; BYTE $0x78   // movq	120(%rsp), %rdi
+	WORD $0x2948; BYTE $0xc7       // subq	%rax, %rdi
+	LONG $0xff478d4c               // leaq	-1(%rdi), %r8
+	LONG $0x02f88349               // cmpq	$2, %r8
+	JBE  BB0_10
+	LONG $0x245c8b48; BYTE $0x70   // movq	112(%rsp), %rbx
+	QUAD $0x0000009824848b4c       // movq	152(%rsp), %r8
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	QUAD $0x00000088249c8b48       // movq	136(%rsp), %rbx
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	LONG $0x1078c1c4; WORD $0x8724 // vmovups	(%r15,%rax,4), %xmm4
+	LONG $0x5c5881c4; WORD $0x8314 // vsubps	(%r11,%r8,4), %xmm4, %xmm2
+	LONG $0x18048d4c               // leaq	(%rax,%rbx), %r8
+	QUAD $0x00000080249c8b48       // movq	128(%rsp), %rbx
+	LONG $0x5c5881c4; WORD $0x8334 // vsubps	(%r11,%r8,4), %xmm4, %xmm6
+	QUAD $0x0000009024848b4c       // movq	144(%rsp), %r8
+	LONG $0xd259e8c5               // vmulps	%xmm2, %xmm2, %xmm2
+	WORD $0x0149; BYTE $0xc0       // addq	%rax, %r8
+	WORD $0x0148; BYTE $0xd8       // addq	%rbx, %rax
+	LONG $0x5c5881c4; WORD $0x831c // vsubps	(%r11,%r8,4), %xmm4, %xmm3
+	LONG $0x5c58c1c4; WORD $0x830c // vsubps	(%r11,%rax,4), %xmm4, %xmm1
+	LONG $0xf659c8c5               // vmulps	%xmm6, %xmm6, %xmm6
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc2       // addq	%rax, %rdx
+	WORD $0xe783; BYTE $0x03       // andl	$3, %edi
+	LONG $0xeb59e0c5               // vmulps	%xmm3, %xmm3, %xmm5
+	LONG $0xc959f0c5               // vmulps	%xmm1, %xmm1, %xmm1
+	LONG $0xde14e8c5               // vunpcklps	%xmm6, %xmm2, %xmm3
+	LONG $0xfec6c8c5; BYTE $0x55   // vshufps	$85, %xmm6, %xmm6, %xmm7
+	LONG $0xe114d0c5               // vunpcklps	%xmm1, %xmm5, %xmm4
+	LONG $0xc1c670c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm8
+	LONG $0xdc16e0c5               // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0xe5c6d0c5; BYTE $0x55   // vshufps	$85, %xmm5, %xmm5, %xmm4
+	LONG $0x1458c1c4; BYTE $0xe0   // vunpcklps	%xmm8, %xmm4, %xmm4
+	LONG $0xc11570c5               // vunpckhps	%xmm1, %xmm1, %xmm8
+	LONG $0xc058e0c5               // vaddps	%xmm0, %xmm3, %xmm0
+	LONG $0xdac6e8c5; BYTE $0x55   // vshufps	$85, %xmm2, %xmm2, %xmm3
+	LONG $0xdf14e0c5               // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0xfe15c8c5               // vunpckhps	%xmm6, %xmm6, %xmm7
+	LONG $0xdc16e0c5               // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0xe515d0c5               // vunpckhps	%xmm5, %xmm5, %xmm4
+	LONG $0xf6c6c8c5; BYTE $0xff   // vshufps	$255, %xmm6, %xmm6, %xmm6
+	LONG $0xedc6d0c5; BYTE $0xff   // vshufps	$255, %xmm5, %xmm5, %xmm5
+	LONG $0x1458c1c4; BYTE $0xe0   // vunpcklps	%xmm8, %xmm4, %xmm4
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xe914d0c5               // vunpcklps	%xmm1, %xmm5, %xmm5
+	LONG $0xc358f8c5               // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xda15e8c5               // vunpckhps	%xmm2, %xmm2, %xmm3
+	LONG $0xd2c6e8c5; BYTE $0xff   // vshufps	$255, %xmm2, %xmm2, %xmm2
+	LONG $0xd614e8c5               // vunpcklps	%xmm6, %xmm2, %xmm2
+	LONG $0xdf14e0c5               // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0xd516e8c5               // vmovlhps	%xmm5, %xmm2, %xmm2
+	LONG $0xdc16e0c5               // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0xc358f8c5               // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xc258f8c5               // vaddps	%xmm2, %xmm0, %xmm0
+	JE   BB0_6
+
+BB0_10:
+	LONG $0x107ac1c4; WORD $0x910c             // vmovss	(%r9,%rdx,4), %xmm1
+	LONG $0x2171e3c4; WORD $0x961c; BYTE $0x10 // vinsertps	$0x10, (%rsi,%rdx,4), %xmm1, %xmm3
+	LONG $0x017a8d48                           // leaq	1(%rdx), %rdi
+	QUAD $0x0000000095048d48                   // leaq	0(,%rdx,4), %rax
+	LONG $0x107ac1c4; WORD $0x920c             // vmovss	(%r10,%rdx,4), %xmm1
+	LONG $0x2171e3c4; WORD $0x910c; BYTE $0x10 // vinsertps	$0x10, (%rcx,%rdx,4), %xmm1, %xmm1
+	LONG $0x1879c2c4; WORD $0x9714             // vbroadcastss	(%r15,%rdx,4), %xmm2
+	LONG $0xcb16f0c5                           // vmovlhps	%xmm3, %xmm1, %xmm1
+	LONG $0xc95ce8c5                           // vsubps	%xmm1, %xmm2, %xmm1
+	LONG $0xb871e2c4; BYTE $0xc1               // vfmadd231ps	%xmm1, %xmm1, %xmm0
+	WORD $0x3949; BYTE $0xfe                   // cmpq	%rdi, %r14
+	JLE  BB0_6
+	LONG $0x107aa1c4; WORD $0x084c; BYTE $0x04 // vmovss	4(%rax,%r9), %xmm1
+	QUAD $0x1004065c2171e3c4                   // vinsertps	$0x10, 4(%rsi,%rax), %xmm1, %xmm3
+	LONG $0x02c28348                           // addq	$2, %rdx
+	LONG $0x107aa1c4; WORD $0x104c; BYTE $0x04 // vmovss	4(%rax,%r10), %xmm1
+	QUAD $0x1004014c2171e3c4                   // vinsertps	$0x10, 4(%rcx,%rax), %xmm1, %xmm1
+	LONG $0x1879c2c4; WORD $0x0754; BYTE $0x04 // vbroadcastss	4(%r15,%rax), %xmm2
+	LONG $0xcb16f0c5                           // vmovlhps	%xmm3, %xmm1, %xmm1
+	LONG $0xc95ce8c5                           // vsubps	%xmm1, %xmm2, %xmm1
+	LONG $0xb871e2c4; BYTE $0xc1               // vfmadd231ps	%xmm1, %xmm1, %xmm0
+	WORD $0x3949; BYTE $0xd6                   // cmpq	%rdx, %r14
+	JLE  BB0_6
+	LONG $0x107aa1c4; WORD $0x084c; BYTE $0x08 // vmovss	8(%rax,%r9), %xmm1
+	QUAD $0x1008065c2171e3c4                   // vinsertps	$0x10, 8(%rsi,%rax), %xmm1, %xmm3
+	LONG $0x107aa1c4; WORD $0x104c; BYTE $0x08 // vmovss	8(%rax,%r10), %xmm1
+	QUAD $0x1008014c2171e3c4                   // vinsertps	$0x10, 8(%rcx,%rax), %xmm1, %xmm1
+	LONG $0x1879c2c4; WORD $0x0754; BYTE $0x08 // vbroadcastss	8(%r15,%rax), %xmm2
+	LONG $0xcb16f0c5                           // vmovlhps	%xmm3, %xmm1, %xmm1
+	LONG $0xc95ce8c5                           // vsubps	%xmm1, %xmm2, %xmm1
+	LONG $0xb871e2c4; BYTE $0xc1               // vfmadd231ps	%xmm1, %xmm1, %xmm0
+
+BB0_6:
+	LONG $0x245c8b48; BYTE $0x50 // movq	80(%rsp), %rbx
+	LONG $0x244c8b48; BYTE $0x38 // movq	56(%rsp), %rcx
+	QUAD $0x0000008024b48b48     // movq	128(%rsp), %rsi
+	LONG $0x24448b48; BYTE $0x68 // movq	104(%rsp), %rax
+	WORD $0x0149; BYTE $0xda     // addq	%rbx, %r10
+	WORD $0x0149; BYTE $0xd9     // addq	%rbx, %r9
+	QUAD $0x00000088249c8b48     // movq	136(%rsp), %rbx
+	WORD $0x0148; BYTE $0xce     // addq	%rcx, %rsi
+	LONG $0x0011f8c5             // vmovups	%xmm0, (%rax)
+	LONG $0x10c08348             // addq	$16, %rax
+	WORD $0x0148; BYTE $0xcb     // addq	%rcx, %rbx
+	LONG $0x244c8b48; BYTE $0x40 // movq	64(%rsp), %rcx
+	LONG $0x24448948; BYTE $0x68 // movq	%rax, 104(%rsp)
+	QUAD $0x00000098249c8948     // movq	%rbx, 152(%rsp)
+	QUAD $0x0000009024b48948     // movq	%rsi, 144(%rsp)
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JNE  BB0_12
+	LONG $0x244c8b48; BYTE $0x20 // movq	32(%rsp), %rcx
+	LONG $0x24448b48; BYTE $0x28 // movq	40(%rsp), %rax
+	WORD $0x894d; BYTE $0xdd     // movq	%r11, %r13
+	LONG $0x24748b48; BYTE $0x18 // movq	24(%rsp), %rsi
+	LONG $0x247c8b48; BYTE $0x10 // movq	16(%rsp), %rdi
+	QUAD $0x000000048d048d4c     // leaq	4(,%rcx,4), %r8
+	WORD $0x394c; BYTE $0xc0     // cmpq	%r8, %rax
+	JLE  BB0_46
+
+BB0_3:
+	LONG $0x03efc148             // shrq	$3, %rdi
+	LONG $0x86048d48             // leaq	(%rsi,%rax,4), %rax
+	LONG $0x861c8d4e             // leaq	(%rsi,%r8,4), %r11
+	QUAD $0x0000009824848948     // movq	%rax, 152(%rsp)
+	LONG $0x01778d48             // leaq	1(%rdi), %rsi
+	WORD $0x894c; BYTE $0xf0     // movq	%r14, %rax
+	LONG $0xc6af0f4d             // imulq	%r14, %r8
+	QUAD $0x00000000f51c8d48     // leaq	0(,%rsi,8), %rbx
+	LONG $0x05e6c148             // salq	$5, %rsi
+	WORD $0x2948; BYTE $0xd8     // subq	%rbx, %rax
+	WORD $0x014c; BYTE $0xfe     // addq	%r15, %rsi
+	LONG $0xff488d48             // leaq	-1(%rax), %rcx
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	QUAD $0x0000008024848948     // movq	%rax, 128(%rsp)
+	LONG $0x244c8948; BYTE $0x78 // movq	%rcx, 120(%rsp)
+	WORD $0x8948; BYTE $0xc1     // movq	%rax, %rcx
+	WORD $0xe083; BYTE $0x07     // andl	$7, %eax
+	LONG $0x03e9c149             // shrq	$3, %r9
+	LONG $0xf8e18348             // andq	$-8, %rcx
+	QUAD $0x0000008824848948     // movq	%rax, 136(%rsp)
+	LONG $0x05e1c149             // salq	$5, %r9
+	QUAD $0x00000090248c8948     // movq	%rcx, 144(%rsp)
+
+BB0_21:
+	LONG $0x85448d4b; BYTE $0x00 // leaq	0(%r13,%r8,4), %rax
+	LONG $0x07fe8349             // cmpq	$7, %r14
+	JLE  BB0_13
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000008ba; BYTE $0x00 // movl	$8, %edx
+
+BB0_14:
+	LONG $0x107cc1c4; WORD $0x976c; BYTE $0xe0 // vmovups	-32(%r15,%rdx,4), %ymm5
+	LONG $0x445cd4c5; WORD $0xe090             // vsubps	-32(%rax,%rdx,4), %ymm5, %ymm0
+	LONG $0x08c28348                           // addq	$8, %rdx
+	LONG $0xb87de2c4; BYTE $0xc8               // vfmadd231ps	%ymm0, %ymm0, %ymm1
+	WORD $0x394c; BYTE $0xf2                   // cmpq	%r14, %rdx
+	JLE  BB0_14
+	LONG $0x197de3c4; WORD $0x01c8             // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5                           // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5                           // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xde                   // cmpq	%rbx, %r14
+	JLE  BB0_15
+	LONG $0x247c8348; WORD $0x0678             // cmpq	$6, 120(%rsp)
+	QUAD $0x00000080248c8b48                   // movq	128(%rsp), %rcx
+	JBE  BB0_25
+	LONG $0x18148d49                           // leaq	(%r8,%rbx), %rdx
+	LONG $0x957c8d49; BYTE $0x00               // leaq	0(%r13,%rdx,4), %rdi
+	WORD $0xd231                               // xorl	%edx, %edx
+
+BB0_17:
+	LONG $0x2c10fcc5; BYTE $0x16         // vmovups	(%rsi,%rdx), %ymm5
+	LONG $0x0c5cd4c5; BYTE $0x17         // vsubps	(%rdi,%rdx), %ymm5, %ymm1
+	LONG $0x20c28348                     // addq	$32, %rdx
+	LONG $0xd159f4c5                     // vmulps	%ymm1, %ymm1, %ymm2
+	LONG $0xc258fac5                     // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xcac6e8c5; BYTE $0x55         // vshufps	$85, %xmm2, %xmm2, %xmm1
+	LONG $0xdac6e8c5; BYTE $0xff         // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xc858f2c5                     // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xc215e8c5                     // vunpckhps	%xmm2, %xmm2, %xmm0
+	LONG $0xc158fac5                     // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01d1       // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xd1c6f0c5; BYTE $0x55         // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd858e2c5                     // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc358f2c5                     // vaddss	%xmm3, %xmm1, %xmm0
+	LONG $0xd058eac5                     // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5                     // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff         // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5                     // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                     // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xca             // cmpq	%r9, %rdx
+	JNE  BB0_17
+	QUAD $0x0000009024bc8b48             // movq	144(%rsp), %rdi
+	WORD $0x8949; BYTE $0xfa             // movq	%rdi, %r10
+	WORD $0x0148; BYTE $0xdf             // addq	%rbx, %rdi
+	QUAD $0x0000008824bc8348; BYTE $0x00 // cmpq	$0, 136(%rsp)
+	JE   BB0_15
+	WORD $0x8948; BYTE $0xda             // movq	%rbx, %rdx
+
+BB0_16:
+	WORD $0x294c; BYTE $0xd1                   // subq	%r10, %rcx
+	LONG $0xff618d4c                           // leaq	-1(%rcx), %r12
+	LONG $0x02fc8349                           // cmpq	$2, %r12
+	JBE  BB0_19
+	LONG $0x12248d4e                           // leaq	(%rdx,%r10), %r12
+	WORD $0x014c; BYTE $0xc2                   // addq	%r8, %rdx
+	WORD $0x014c; BYTE $0xd2                   // addq	%r10, %rdx
+	LONG $0x107881c4; WORD $0xa70c             // vmovups	(%r15,%r12,4), %xmm1
+	LONG $0x5c70c1c4; WORD $0x954c; BYTE $0x00 // vsubps	0(%r13,%rdx,4), %xmm1, %xmm1
+	LONG $0xc959f0c5                           // vmulps	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f2c5                           // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0xc1f6; BYTE $0x03                   // testb	$3, %cl
+	JE   BB0_15
+	LONG $0xfce18348                           // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xcf                   // addq	%rcx, %rdi
+
+BB0_19:
+	LONG $0x107ac1c4; WORD $0xbf0c             // vmovss	(%r15,%rdi,4), %xmm1
+	LONG $0x0c5cf2c5; BYTE $0xb8               // vsubss	(%rax,%rdi,4), %xmm1, %xmm1
+	LONG $0x014f8d48                           // leaq	1(%rdi), %rcx
+	QUAD $0x00000000bd148d48                   // leaq	0(,%rdi,4), %rdx
+	LONG $0xb971e2c4; BYTE $0xc1               // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x394c; BYTE $0xf1                   // cmpq	%r14, %rcx
+	JGE  BB0_15
+	LONG $0x107ac1c4; WORD $0x174c; BYTE $0x04 // vmovss	4(%r15,%rdx), %xmm1
+	LONG $0x4c5cf2c5; WORD $0x0410             // vsubss	4(%rax,%rdx), %xmm1, %xmm1
+	LONG $0x02c78348                           // addq	$2, %rdi
+	LONG $0xb971e2c4; BYTE $0xc1               // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3949; BYTE $0xfe                   // cmpq	%rdi, %r14
+	JLE  BB0_15
+	LONG $0x107ac1c4; WORD $0x174c; BYTE $0x08 // vmovss	8(%r15,%rdx), %xmm1
+	LONG $0x4c5cf2c5; WORD $0x0810             // vsubss	8(%rax,%rdx), %xmm1, %xmm1
+	LONG $0xb971e2c4; BYTE $0xc1               // vfmadd231ss	%xmm1, %xmm1, %xmm0
+
+BB0_15:
+	LONG $0x117ac1c4; BYTE $0x03 // vmovss	%xmm0, (%r11)
+	WORD $0x014d; BYTE $0xf0     // addq	%r14, %r8
+	LONG $0x04c38349             // addq	$4, %r11
+	QUAD $0x00000098249c394c     // cmpq	%r11, 152(%rsp)
+	JNE  BB0_21
+
+BB0_46:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_44:
+	LONG $0x50a58d48; WORD $0xffff; BYTE $0xff // leaq	-176(%rbp), %rsp
+	RET
+
+BB0_23:
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0xd231     // xorl	%edx, %edx
+	LONG $0xf928fcc5 // vmovaps	%ymm1, %ymm7
+	LONG $0xe928fcc5 // vmovaps	%ymm1, %ymm5
+	LONG $0xf128fcc5 // vmovaps	%ymm1, %ymm6
+	JMP  BB0_4
+
+BB0_24:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_7
+
+BB0_13:
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x894c; BYTE $0xf1 // movq	%r14, %rcx
+	WORD $0xd231             // xorl	%edx, %edx
+	WORD $0x3145; BYTE $0xd2 // xorl	%r10d, %r10d
+	WORD $0xff31             // xorl	%edi, %edi
+	JMP  BB0_16
+
+BB0_22:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	LONG $0xf87e8d49         // leaq	-8(%r14), %rdi
+	JMP  BB0_3
+
+BB0_25:
+	WORD $0x8948; BYTE $0xda // movq	%rbx, %rdx
+	WORD $0x8948; BYTE $0xdf // movq	%rbx, %rdi
+	WORD $0x3145; BYTE $0xd2 // xorl	%r10d, %r10d
+	JMP  BB0_16
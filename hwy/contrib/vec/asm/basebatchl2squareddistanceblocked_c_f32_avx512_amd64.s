@@ -0,0 +1,748 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basebatchl2squareddistanceblocked_c_f32_avx512_amd64.c
+
+TEXT ·batchl2squareddistanceblocked_c_f32_avx512(SB), $80-64
+	MOVQ query+0(FP), DI
+	MOVQ data+8(FP), SI
+	MOVQ distances+16(FP), DX
+	MOVQ pcount+24(FP), CX
+	MOVQ pdims+32(FP), R8
+	MOVQ plen_query+40(FP), R9
+	MOVQ plen_data+48(FP), R11
+	MOVQ R11, 64(SP)
+	MOVQ plen_distances+56(FP), R11
+	MOVQ R11, 72(SP)
+	WORD $0x8b4c; BYTE $0x19             // movq	(%rcx), %r11
+	WORD $0x8948; BYTE $0xd0             // movq	%rdx, %rax
+	WORD $0x8b49; BYTE $0x10             // movq	(%r8), %rdx
+	WORD $0x854d; BYTE $0xdb             // testq	%r11, %r11
+	JLE  BB0_50
+	WORD $0x8548; BYTE $0xd2             // testq	%rdx, %rdx
+	JLE  BB0_50
+	WORD $0x8949; BYTE $0xf2             // movq	%rsi, %r10
+	WORD $0x894c; BYTE $0xde             // movq	%r11, %rsi
+	LONG $0xf2af0f48                     // imulq	%rdx, %rsi
+	LONG $0x246c8d48; BYTE $0x30         // leaq	48(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x40         // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348                     // andq	$-64, %rsp
+	LONG $0x80c48348                     // addq	$-128, %rsp
+	LONG $0x104d8b48                     // movq	16(%rbp), %rcx
+	WORD $0x3b48; BYTE $0x31             // cmpq	(%rcx), %rsi
+	JG   BB0_48
+	LONG $0x184d8b48                     // movq	24(%rbp), %rcx
+	WORD $0x3b4c; BYTE $0x19             // cmpq	(%rcx), %r11
+	JG   BB0_48
+	WORD $0x3b49; BYTE $0x11             // cmpq	(%r9), %rdx
+	JG   BB0_48
+	WORD $0x8949; BYTE $0xfe             // movq	%rdi, %r14
+	LONG $0x03fb8349                     // cmpq	$3, %r11
+	JLE  BB0_26
+	LONG $0xfc4b8d49                     // leaq	-4(%r11), %rcx
+	LONG $0xf0428d4c                     // leaq	-16(%rdx), %r8
+	WORD $0x8948; BYTE $0xd7             // movq	%rdx, %rdi
+	LONG $0x24448948; BYTE $0x48         // movq	%rax, 72(%rsp)
+	LONG $0x02e9c148                     // shrq	$2, %rcx
+	LONG $0x245c894c; BYTE $0x20         // movq	%r11, 32(%rsp)
+	LONG $0x04e7c148                     // salq	$4, %rdi
+	WORD $0x894d; BYTE $0xf7             // movq	%r14, %r15
+	WORD $0x8949; BYTE $0xc9             // movq	%rcx, %r9
+	LONG $0x04e1c148                     // salq	$4, %rcx
+	LONG $0x24448948; BYTE $0x10         // movq	%rax, 16(%rsp)
+	QUAD $0x00000000951c8d48             // leaq	0(,%rdx,4), %rbx
+	LONG $0x084c8d48; BYTE $0x10         // leaq	16(%rax,%rcx), %rcx
+	LONG $0x08fde162; WORD $0xe36e       // vmovq	%rbx, %xmm20
+	LONG $0x244c894c; BYTE $0x18         // movq	%r9, 24(%rsp)
+	LONG $0x121c8d48                     // leaq	(%rdx,%rdx), %rbx
+	LONG $0x08fde162; WORD $0xf96e       // vmovq	%rcx, %xmm23
+	WORD $0x894c; BYTE $0xc1             // movq	%r8, %rcx
+	LONG $0x2444894c; BYTE $0x08         // movq	%r8, 8(%rsp)
+	LONG $0xd2348d49                     // leaq	(%r10,%rdx,8), %rsi
+	LONG $0xf0e18348                     // andq	$-16, %rcx
+	LONG $0x245c8948; BYTE $0x70         // movq	%rbx, 112(%rsp)
+	WORD $0x0148; BYTE $0xd3             // addq	%rdx, %rbx
+	LONG $0x10c18348                     // addq	$16, %rcx
+	LONG $0x247c8948; BYTE $0x30         // movq	%rdi, 48(%rsp)
+	WORD $0x894c; BYTE $0xd7             // movq	%r10, %rdi
+	LONG $0x6ef961c4; BYTE $0xd3         // vmovq	%rbx, %xmm10
+	LONG $0x244c8948; BYTE $0x28         // movq	%rcx, 40(%rsp)
+	QUAD $0x000000782444c748; BYTE $0x00 // movq	$0, 120(%rsp)
+
+BB0_15:
+	LONG $0x24448b48; BYTE $0x78   // movq	120(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x24448948; BYTE $0x68   // movq	%rax, 104(%rsp)
+	LONG $0x08fde162; WORD $0xe07e // vmovq	%xmm20, %rax
+	LONG $0x072c8d4c               // leaq	(%rdi,%rax), %r13
+	LONG $0x24448b48; BYTE $0x70   // movq	112(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x24448948; BYTE $0x60   // movq	%rax, 96(%rsp)
+	LONG $0x08fde162; WORD $0xe07e // vmovq	%xmm20, %rax
+	LONG $0x061c8d48               // leaq	(%rsi,%rax), %rbx
+	LONG $0x0ffa8348               // cmpq	$15, %rdx
+	JLE  BB0_27
+	LONG $0xff57c0c5               // vxorps	%xmm7, %xmm7, %xmm7
+	LONG $0x000010b8; BYTE $0x00   // movl	$16, %eax
+	LONG $0x487cf162; WORD $0xe728 // vmovaps	%zmm7, %zmm4
+	LONG $0x487cf162; WORD $0xef28 // vmovaps	%zmm7, %zmm5
+	LONG $0x487cf162; WORD $0xf728 // vmovaps	%zmm7, %zmm6
+
+BB0_7:
+	QUAD $0xff874410487cd162       // vmovups	-64(%r15,%rax,4), %zmm0
+	QUAD $0xff875c5c487cf162       // vsubps	-64(%rdi,%rax,4), %zmm0, %zmm3
+	QUAD $0xff85545c487cd162       // vsubps	-64(%r13,%rax,4), %zmm0, %zmm2
+	QUAD $0xff864c5c487cf162       // vsubps	-64(%rsi,%rax,4), %zmm0, %zmm1
+	QUAD $0xff83445c487cf162       // vsubps	-64(%rbx,%rax,4), %zmm0, %zmm0
+	LONG $0x10c08348               // addq	$16, %rax
+	LONG $0x4865f262; WORD $0xf3b8 // vfmadd231ps	%zmm3, %zmm3, %zmm6
+	LONG $0x486df262; WORD $0xeab8 // vfmadd231ps	%zmm2, %zmm2, %zmm5
+	LONG $0x4875f262; WORD $0xe1b8 // vfmadd231ps	%zmm1, %zmm1, %zmm4
+	LONG $0x487df262; WORD $0xf8b8 // vfmadd231ps	%zmm0, %zmm0, %zmm7
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JLE  BB0_7
+	LONG $0x244c8b48; BYTE $0x28   // movq	40(%rsp), %rcx
+
+BB0_6:
+	LONG $0x48fdf362; WORD $0xf01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm6, %ymm0
+	LONG $0xc658fcc5                           // vaddps	%ymm6, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0x0479e3c4; WORD $0x4ec1             // vpermilps	$78, %xmm1, %xmm0
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0x48fdf362; WORD $0xe91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm1
+	LONG $0xcd58f4c5                           // vaddps	%ymm5, %ymm1, %ymm1
+	LONG $0xd82878c5                           // vmovaps	%xmm0, %xmm11
+	LONG $0xc0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01ca             // vextractf128	$0x1, %ymm1, %xmm2
+	LONG $0xd85822c5                           // vaddss	%xmm0, %xmm11, %xmm11
+	LONG $0xc958e8c5                           // vaddps	%xmm1, %xmm2, %xmm1
+	LONG $0x0479e3c4; WORD $0x4ed9             // vpermilps	$78, %xmm1, %xmm3
+	LONG $0xd958e0c5                           // vaddps	%xmm1, %xmm3, %xmm3
+	LONG $0x48fdf362; WORD $0xe11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm4, %ymm1
+	LONG $0xcc58f4c5                           // vaddps	%ymm4, %ymm1, %ymm1
+	LONG $0xc328f8c5                           // vmovaps	%xmm3, %xmm0
+	LONG $0xdbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm3
+	LONG $0x197de3c4; WORD $0x01ca             // vextractf128	$0x1, %ymm1, %xmm2
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc958e8c5                           // vaddps	%xmm1, %xmm2, %xmm1
+	LONG $0xd81420c5                           // vunpcklps	%xmm0, %xmm11, %xmm11
+	LONG $0x0479e3c4; WORD $0x4ed1             // vpermilps	$78, %xmm1, %xmm2
+	LONG $0xd158e8c5                           // vaddps	%xmm1, %xmm2, %xmm2
+	LONG $0x48fdf362; WORD $0xf91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm7, %ymm1
+	LONG $0xff58f4c5                           // vaddps	%ymm7, %ymm1, %ymm7
+	LONG $0xda28f8c5                           // vmovaps	%xmm2, %xmm3
+	LONG $0xd2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm2
+	LONG $0x197de3c4; WORD $0x01fc             // vextractf128	$0x1, %ymm7, %xmm4
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xe758d8c5                           // vaddps	%xmm7, %xmm4, %xmm4
+	LONG $0x0479e3c4; WORD $0x4ecc             // vpermilps	$78, %xmm4, %xmm1
+	LONG $0xcc58f0c5                           // vaddps	%xmm4, %xmm1, %xmm1
+	LONG $0xd128f8c5                           // vmovaps	%xmm1, %xmm2
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xd214e0c5                           // vunpcklps	%xmm2, %xmm3, %xmm2
+	LONG $0xda1620c5                           // vmovlhps	%xmm2, %xmm11, %xmm11
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_8
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x244c8948; BYTE $0x50               // movq	%rcx, 80(%rsp)
+	WORD $0x2948; BYTE $0xc8                   // subq	%rcx, %rax
+	LONG $0x24448948; BYTE $0x58               // movq	%rax, 88(%rsp)
+	LONG $0x01e88348                           // subq	$1, %rax
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_28
+	LONG $0x245c8b4c; BYTE $0x78               // movq	120(%rsp), %r11
+	LONG $0x244c8b4c; BYTE $0x68               // movq	104(%rsp), %r9
+	LONG $0x2454894c; BYTE $0x38               // movq	%r10, 56(%rsp)
+	LONG $0x8f348d4d                           // leaq	(%r15,%rcx,4), %r14
+	LONG $0x19048d4a                           // leaq	(%rcx,%r11), %rax
+	LONG $0x245c8b4c; BYTE $0x70               // movq	112(%rsp), %r11
+	LONG $0x82048d4d                           // leaq	(%r10,%rax,4), %r8
+	LONG $0x09048d4a                           // leaq	(%rcx,%r9), %rax
+	LONG $0x244c8b4c; BYTE $0x60               // movq	96(%rsp), %r9
+	LONG $0x82248d4d                           // leaq	(%r10,%rax,4), %r12
+	LONG $0x19048d4a                           // leaq	(%rcx,%r11), %rax
+	LONG $0x821c8d4d                           // leaq	(%r10,%rax,4), %r11
+	LONG $0x09048d4a                           // leaq	(%rcx,%r9), %rax
+	LONG $0x820c8d4d                           // leaq	(%r10,%rax,4), %r9
+	LONG $0x24448b48; BYTE $0x58               // movq	88(%rsp), %rax
+	WORD $0x8949; BYTE $0xf2                   // movq	%rsi, %r10
+	WORD $0x8948; BYTE $0xd6                   // movq	%rdx, %rsi
+	LONG $0x04e8c148                           // shrq	$4, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	LONG $0x24448948; BYTE $0x40               // movq	%rax, 64(%rsp)
+	LONG $0x24548b48; BYTE $0x40               // movq	64(%rsp), %rdx
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_10:
+	LONG $0x487cd162; WORD $0x0c10; BYTE $0x06 // vmovups	(%r14,%rax), %zmm1
+	LONG $0x4874d162; WORD $0x145c; BYTE $0x00 // vsubps	(%r8,%rax), %zmm1, %zmm2
+	LONG $0x4874d162; WORD $0x245c; BYTE $0x04 // vsubps	(%r12,%rax), %zmm1, %zmm4
+	LONG $0x4874d162; WORD $0x1c5c; BYTE $0x03 // vsubps	(%r11,%rax), %zmm1, %zmm3
+	LONG $0x4874d162; WORD $0x0c5c; BYTE $0x01 // vsubps	(%r9,%rax), %zmm1, %zmm1
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x486cf162; WORD $0xd259             // vmulps	%zmm2, %zmm2, %zmm2
+	LONG $0x485cf162; WORD $0xe459             // vmulps	%zmm4, %zmm4, %zmm4
+	LONG $0x4864f162; WORD $0xdb59             // vmulps	%zmm3, %zmm3, %zmm3
+	LONG $0x4874f162; WORD $0xc959             // vmulps	%zmm1, %zmm1, %zmm1
+	LONG $0xf2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm6
+	LONG $0x286df362; WORD $0xea03; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm5
+	LONG $0xecc658c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm13
+	LONG $0xc414e8c5                           // vunpcklps	%xmm4, %xmm2, %xmm0
+	LONG $0x085c6162; WORD $0xc4c6; BYTE $0xff // vshufps	$255, %xmm4, %xmm4, %xmm24
+	LONG $0x084c9162; WORD $0xf014             // vunpcklps	%xmm24, %xmm6, %xmm6
+	LONG $0xe3c660c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm12
+	LONG $0xc3c660c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm8
+	LONG $0x285de362; WORD $0xec03; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm21
+	LONG $0x08746162; WORD $0xc9c6; BYTE $0xff // vshufps	$255, %xmm1, %xmm1, %xmm25
+	LONG $0x2865f362; WORD $0xfb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm7
+	LONG $0xc91460c5                           // vunpcklps	%xmm1, %xmm3, %xmm9
+	LONG $0x083c1162; WORD $0xc114             // vunpcklps	%xmm25, %xmm8, %xmm8
+	LONG $0x2875e362; WORD $0xf103; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm22
+	LONG $0x1678c1c4; BYTE $0xc1               // vmovlhps	%xmm9, %xmm0, %xmm0
+	LONG $0xcac668c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm9
+	LONG $0x143041c4; BYTE $0xcd               // vunpcklps	%xmm13, %xmm9, %xmm9
+	LONG $0x5878c1c4; BYTE $0xc3               // vaddps	%xmm11, %xmm0, %xmm0
+	LONG $0xec1558c5                           // vunpckhps	%xmm4, %xmm4, %xmm13
+	LONG $0xd9c670c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm11
+	LONG $0x141841c4; BYTE $0xe3               // vunpcklps	%xmm11, %xmm12, %xmm12
+	LONG $0x163041c4; BYTE $0xcc               // vmovlhps	%xmm12, %xmm9, %xmm9
+	LONG $0xd91570c5                           // vunpckhps	%xmm1, %xmm1, %xmm11
+	LONG $0xe31560c5                           // vunpckhps	%xmm3, %xmm3, %xmm12
+	LONG $0x141841c4; BYTE $0xe3               // vunpcklps	%xmm11, %xmm12, %xmm12
+	LONG $0x1648c1c4; BYTE $0xf0               // vmovlhps	%xmm8, %xmm6, %xmm6
+	LONG $0x287dd362; WORD $0xe019; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm8
+	LONG $0x5878c1c4; BYTE $0xc1               // vaddps	%xmm9, %xmm0, %xmm0
+	LONG $0xca1568c5                           // vunpckhps	%xmm2, %xmm2, %xmm9
+	LONG $0x0854b162; WORD $0xed14             // vunpcklps	%xmm21, %xmm5, %xmm5
+	LONG $0x143041c4; BYTE $0xcd               // vunpcklps	%xmm13, %xmm9, %xmm9
+	LONG $0x163041c4; BYTE $0xcc               // vmovlhps	%xmm12, %xmm9, %xmm9
+	LONG $0x0844b162; WORD $0xfe14             // vunpcklps	%xmm22, %xmm7, %xmm7
+	LONG $0x587841c4; BYTE $0xd9               // vaddps	%xmm9, %xmm0, %xmm11
+	LONG $0xef16d0c5                           // vmovlhps	%xmm7, %xmm5, %xmm5
+	LONG $0x287dd362; WORD $0xc919; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm9
+	LONG $0x287df362; WORD $0xd019; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm0
+	LONG $0xde5820c5                           // vaddps	%xmm6, %xmm11, %xmm11
+	LONG $0x287df362; WORD $0xde19; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm6
+	LONG $0x1478c1c4; BYTE $0xc0               // vunpcklps	%xmm8, %xmm0, %xmm0
+	LONG $0x285d7362; WORD $0xc403; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm8
+	LONG $0x1448c1c4; BYTE $0xf1               // vunpcklps	%xmm9, %xmm6, %xmm6
+	LONG $0x28757362; WORD $0xc903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm9
+	LONG $0xc616f8c5                           // vmovlhps	%xmm6, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xf303; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm6
+	LONG $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	LONG $0x286df362; WORD $0xc203; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm0
+	LONG $0x1448c1c4; BYTE $0xf1               // vunpcklps	%xmm9, %xmm6, %xmm6
+	LONG $0x28757362; WORD $0xc903; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm9
+	LONG $0x1478c1c4; BYTE $0xc0               // vunpcklps	%xmm8, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xc91b; BYTE $0x01 // vextractf32x8	$0x1, %zmm1, %ymm1
+	LONG $0x285d7362; WORD $0xc403; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm8
+	LONG $0xc616f8c5                           // vmovlhps	%xmm6, %xmm0, %xmm0
+	LONG $0x487df362; WORD $0xe41b; BYTE $0x01 // vextractf32x8	$0x1, %zmm4, %ymm4
+	LONG $0xe9c670c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm13
+	LONG $0x2865f362; WORD $0xf303; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm6
+	LONG $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	LONG $0x487df362; WORD $0xdb1b; BYTE $0x01 // vextractf32x8	$0x1, %zmm3, %ymm3
+	LONG $0xe4c658c5; BYTE $0x55               // vshufps	$85, %xmm4, %xmm4, %xmm12
+	LONG $0x286df362; WORD $0xc203; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm0
+	LONG $0x487df362; WORD $0xd21b; BYTE $0x01 // vextractf32x8	$0x1, %zmm2, %ymm2
+	LONG $0xf914e0c5                           // vunpcklps	%xmm1, %xmm3, %xmm7
+	LONG $0x1448c1c4; BYTE $0xf1               // vunpcklps	%xmm9, %xmm6, %xmm6
+	LONG $0xc9c670c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm9
+	LONG $0x1478c1c4; BYTE $0xc0               // vunpcklps	%xmm8, %xmm0, %xmm0
+	LONG $0xc4c658c5; BYTE $0xff               // vshufps	$255, %xmm4, %xmm4, %xmm8
+	LONG $0xc616f8c5                           // vmovlhps	%xmm6, %xmm0, %xmm0
+	LONG $0xf414e8c5                           // vunpcklps	%xmm4, %xmm2, %xmm6
+	LONG $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	LONG $0xf716c8c5                           // vmovlhps	%xmm7, %xmm6, %xmm6
+	LONG $0xfbc6e0c5; BYTE $0x55               // vshufps	$85, %xmm3, %xmm3, %xmm7
+	LONG $0x1440c1c4; BYTE $0xfd               // vunpcklps	%xmm13, %xmm7, %xmm7
+	LONG $0xe91570c5                           // vunpckhps	%xmm1, %xmm1, %xmm13
+	LONG $0xc2c6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm0
+	LONG $0x1478c1c4; BYTE $0xc0               // vunpcklps	%xmm8, %xmm0, %xmm0
+	LONG $0xdd5820c5                           // vaddps	%xmm5, %xmm11, %xmm11
+	LONG $0xebc6e0c5; BYTE $0xff               // vshufps	$255, %xmm3, %xmm3, %xmm5
+	LONG $0x1450c1c4; BYTE $0xe9               // vunpcklps	%xmm9, %xmm5, %xmm5
+	LONG $0xc516f8c5                           // vmovlhps	%xmm5, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xd519; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm5
+	LONG $0xde5820c5                           // vaddps	%xmm6, %xmm11, %xmm11
+	LONG $0xf2c6e8c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm6
+	LONG $0x1448c1c4; BYTE $0xf4               // vunpcklps	%xmm12, %xmm6, %xmm6
+	LONG $0xe41558c5                           // vunpckhps	%xmm4, %xmm4, %xmm12
+	LONG $0xf716c8c5                           // vmovlhps	%xmm7, %xmm6, %xmm6
+	LONG $0xfb15e0c5                           // vunpckhps	%xmm3, %xmm3, %xmm7
+	LONG $0x1440c1c4; BYTE $0xfd               // vunpcklps	%xmm13, %xmm7, %xmm7
+	LONG $0xde5820c5                           // vaddps	%xmm6, %xmm11, %xmm11
+	LONG $0xf215e8c5                           // vunpckhps	%xmm2, %xmm2, %xmm6
+	LONG $0x1448c1c4; BYTE $0xf4               // vunpcklps	%xmm12, %xmm6, %xmm6
+	LONG $0xf716c8c5                           // vmovlhps	%xmm7, %xmm6, %xmm6
+	LONG $0x287df362; WORD $0xcf19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm7
+	LONG $0xde5820c5                           // vaddps	%xmm6, %xmm11, %xmm11
+	LONG $0x287df362; WORD $0xe619; BYTE $0x01 // vextractf32x4	$1, %ymm4, %xmm6
+	LONG $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	LONG $0x287df362; WORD $0xd819; BYTE $0x01 // vextractf32x4	$1, %ymm3, %xmm0
+	LONG $0xee14d0c5                           // vunpcklps	%xmm6, %xmm5, %xmm5
+	LONG $0x285df362; WORD $0xf403; BYTE $0x05 // valignd	$5, %ymm4, %ymm4, %ymm6
+	LONG $0xc714f8c5                           // vunpcklps	%xmm7, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xf903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm7
+	LONG $0xe816d0c5                           // vmovlhps	%xmm0, %xmm5, %xmm5
+	LONG $0x286df362; WORD $0xc203; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm0
+	LONG $0xdd5820c5                           // vaddps	%xmm5, %xmm11, %xmm11
+	LONG $0x2865f362; WORD $0xeb03; BYTE $0x05 // valignd	$5, %ymm3, %ymm3, %ymm5
+	LONG $0xc614f8c5                           // vunpcklps	%xmm6, %xmm0, %xmm0
+	LONG $0x285df362; WORD $0xf403; BYTE $0x06 // valignd	$6, %ymm4, %ymm4, %ymm6
+	LONG $0xef14d0c5                           // vunpcklps	%xmm7, %xmm5, %xmm5
+	LONG $0x2875f362; WORD $0xf903; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm7
+	LONG $0xc516f8c5                           // vmovlhps	%xmm5, %xmm0, %xmm0
+	LONG $0x2865f362; WORD $0xeb03; BYTE $0x06 // valignd	$6, %ymm3, %ymm3, %ymm5
+	LONG $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	LONG $0x286df362; WORD $0xc203; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm0
+	LONG $0x285df362; WORD $0xe403; BYTE $0x07 // valignd	$7, %ymm4, %ymm4, %ymm4
+	LONG $0x286df362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm2
+	LONG $0x2865f362; WORD $0xdb03; BYTE $0x07 // valignd	$7, %ymm3, %ymm3, %ymm3
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xef14d0c5                           // vunpcklps	%xmm7, %xmm5, %xmm5
+	LONG $0xc614f8c5                           // vunpcklps	%xmm6, %xmm0, %xmm0
+	LONG $0xc516f8c5                           // vmovlhps	%xmm5, %xmm0, %xmm0
+	LONG $0xd85820c5                           // vaddps	%xmm0, %xmm11, %xmm11
+	LONG $0xd414e8c5                           // vunpcklps	%xmm4, %xmm2, %xmm2
+	LONG $0xc914e0c5                           // vunpcklps	%xmm1, %xmm3, %xmm1
+	LONG $0xd116e8c5                           // vmovlhps	%xmm1, %xmm2, %xmm2
+	LONG $0xda5820c5                           // vaddps	%xmm2, %xmm11, %xmm11
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JNE  BB0_10
+	LONG $0x24748b4c; BYTE $0x58               // movq	88(%rsp), %r14
+	WORD $0x8948; BYTE $0xf2                   // movq	%rsi, %rdx
+	WORD $0x894c; BYTE $0xd6                   // movq	%r10, %rsi
+	LONG $0x24548b4c; BYTE $0x38               // movq	56(%rsp), %r10
+	WORD $0x894c; BYTE $0xf0                   // movq	%r14, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x0fe68341                           // andl	$15, %r14d
+	JE   BB0_8
+
+BB0_9:
+	LONG $0x24448b4c; BYTE $0x58               // movq	88(%rsp), %r8
+	WORD $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG $0xff708d4d                           // leaq	-1(%r8), %r14
+	LONG $0x06fe8349                           // cmpq	$6, %r14
+	JBE  BB0_13
+	LONG $0x245c8b4c; BYTE $0x50               // movq	80(%rsp), %r11
+	LONG $0x244c8b4c; BYTE $0x78               // movq	120(%rsp), %r9
+	LONG $0x24748b4c; BYTE $0x68               // movq	104(%rsp), %r14
+	WORD $0x014c; BYTE $0xd8                   // addq	%r11, %rax
+	LONG $0x245c8b4c; BYTE $0x70               // movq	112(%rsp), %r11
+	LONG $0x107cc1c4; WORD $0x8704             // vmovups	(%r15,%rax,4), %ymm0
+	WORD $0x0149; BYTE $0xc1                   // addq	%rax, %r9
+	WORD $0x0149; BYTE $0xc3                   // addq	%rax, %r11
+	LONG $0x5c7c81c4; WORD $0x8a14             // vsubps	(%r10,%r9,4), %ymm0, %ymm2
+	LONG $0x300c8d4e                           // leaq	(%rax,%r14), %r9
+	LONG $0x5c7c81c4; WORD $0x9a1c             // vsubps	(%r10,%r11,4), %ymm0, %ymm3
+	LONG $0x245c8b4c; BYTE $0x60               // movq	96(%rsp), %r11
+	LONG $0x5c7c81c4; WORD $0x8a24             // vsubps	(%r10,%r9,4), %ymm0, %ymm4
+	LONG $0xd259ecc5                           // vmulps	%ymm2, %ymm2, %ymm2
+	WORD $0x014c; BYTE $0xd8                   // addq	%r11, %rax
+	LONG $0x5c7cc1c4; WORD $0x820c             // vsubps	(%r10,%rax,4), %ymm0, %ymm1
+	LONG $0xeb59e4c5                           // vmulps	%ymm3, %ymm3, %ymm5
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	LONG $0xf459dcc5                           // vmulps	%ymm4, %ymm4, %ymm6
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x07e08341                           // andl	$7, %r8d
+	LONG $0xc959f4c5                           // vmulps	%ymm1, %ymm1, %ymm1
+	LONG $0xdac6e8c5; BYTE $0xff               // vshufps	$255, %xmm2, %xmm2, %xmm3
+	LONG $0xfdc650c5; BYTE $0x55               // vshufps	$85, %xmm5, %xmm5, %xmm15
+	LONG $0xe5c6d0c5; BYTE $0xff               // vshufps	$255, %xmm5, %xmm5, %xmm4
+	LONG $0xc614e8c5                           // vunpcklps	%xmm6, %xmm2, %xmm0
+	LONG $0x084ce162; WORD $0xc6c6; BYTE $0x55 // vshufps	$85, %xmm6, %xmm6, %xmm16
+	LONG $0xfec6c8c5; BYTE $0xff               // vshufps	$255, %xmm6, %xmm6, %xmm7
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xf719; BYTE $0x01 // vextractf32x4	$1, %ymm6, %xmm7
+	LONG $0xc91450c5                           // vunpcklps	%xmm1, %xmm5, %xmm9
+	LONG $0xc1c670c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm8
+	LONG $0x1458c1c4; BYTE $0xe0               // vunpcklps	%xmm8, %xmm4, %xmm4
+	LONG $0x287dd362; WORD $0xc819; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm8
+	LONG $0x1678c1c4; BYTE $0xc1               // vmovlhps	%xmm9, %xmm0, %xmm0
+	LONG $0xcac668c5; BYTE $0x55               // vshufps	$85, %xmm2, %xmm2, %xmm9
+	LONG $0x08343162; WORD $0xc814             // vunpcklps	%xmm16, %xmm9, %xmm9
+	LONG $0x5878c1c4; BYTE $0xc3               // vaddps	%xmm11, %xmm0, %xmm0
+	LONG $0x0874e162; WORD $0xc115             // vunpckhps	%xmm1, %xmm1, %xmm16
+	LONG $0xd9c670c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm11
+	LONG $0x140041c4; BYTE $0xfb               // vunpcklps	%xmm11, %xmm15, %xmm15
+	LONG $0x163041c4; BYTE $0xcf               // vmovlhps	%xmm15, %xmm9, %xmm9
+	LONG $0xdd1550c5                           // vunpckhps	%xmm5, %xmm5, %xmm11
+	LONG $0xfe1548c5                           // vunpckhps	%xmm6, %xmm6, %xmm15
+	LONG $0x08243162; WORD $0xd814             // vunpcklps	%xmm16, %xmm11, %xmm11
+	LONG $0xdc16e0c5                           // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xec19; BYTE $0x01 // vextractf32x4	$1, %ymm5, %xmm4
+	LONG $0x5878c1c4; BYTE $0xc1               // vaddps	%xmm9, %xmm0, %xmm0
+	LONG $0xca1568c5                           // vunpckhps	%xmm2, %xmm2, %xmm9
+	LONG $0x143041c4; BYTE $0xcf               // vunpcklps	%xmm15, %xmm9, %xmm9
+	LONG $0x163041c4; BYTE $0xcb               // vmovlhps	%xmm11, %xmm9, %xmm9
+	LONG $0x28757362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm11
+	LONG $0x5878c1c4; BYTE $0xc1               // vaddps	%xmm9, %xmm0, %xmm0
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0x1458c1c4; BYTE $0xe0               // vunpcklps	%xmm8, %xmm4, %xmm4
+	LONG $0x287df362; WORD $0xd319; BYTE $0x01 // vextractf32x4	$1, %ymm2, %xmm3
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x05 // valignd	$5, %ymm6, %ymm6, %ymm7
+	LONG $0xdc16e0c5                           // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0x2855f362; WORD $0xe503; BYTE $0x05 // valignd	$5, %ymm5, %ymm5, %ymm4
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0x286df362; WORD $0xda03; BYTE $0x05 // valignd	$5, %ymm2, %ymm2, %ymm3
+	LONG $0x1458c1c4; BYTE $0xe3               // vunpcklps	%xmm11, %xmm4, %xmm4
+	LONG $0x28757362; WORD $0xd903; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm11
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0x284df362; WORD $0xfe03; BYTE $0x06 // valignd	$6, %ymm6, %ymm6, %ymm7
+	LONG $0xdc16e0c5                           // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0x2855f362; WORD $0xe503; BYTE $0x06 // valignd	$6, %ymm5, %ymm5, %ymm4
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0x286df362; WORD $0xda03; BYTE $0x06 // valignd	$6, %ymm2, %ymm2, %ymm3
+	LONG $0x284df362; WORD $0xf603; BYTE $0x07 // valignd	$7, %ymm6, %ymm6, %ymm6
+	LONG $0x286df362; WORD $0xd203; BYTE $0x07 // valignd	$7, %ymm2, %ymm2, %ymm2
+	LONG $0x2855f362; WORD $0xed03; BYTE $0x07 // valignd	$7, %ymm5, %ymm5, %ymm5
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0x1458c1c4; BYTE $0xe3               // vunpcklps	%xmm11, %xmm4, %xmm4
+	LONG $0xdf14e0c5                           // vunpcklps	%xmm7, %xmm3, %xmm3
+	LONG $0xdc16e0c5                           // vmovlhps	%xmm4, %xmm3, %xmm3
+	LONG $0xc358f8c5                           // vaddps	%xmm3, %xmm0, %xmm0
+	LONG $0xd614e8c5                           // vunpcklps	%xmm6, %xmm2, %xmm2
+	LONG $0xc914d0c5                           // vunpcklps	%xmm1, %xmm5, %xmm1
+	LONG $0xd116e8c5                           // vmovlhps	%xmm1, %xmm2, %xmm2
+	LONG $0xda5878c5                           // vaddps	%xmm2, %xmm0, %xmm11
+	JE   BB0_8
+
+BB0_13:
+	LONG $0x0c10fac5; BYTE $0x8e               // vmovss	(%rsi,%rcx,4), %xmm1
+	LONG $0x0410fac5; BYTE $0x8f               // vmovss	(%rdi,%rcx,4), %xmm0
+	LONG $0x01418d4c                           // leaq	1(%rcx), %r8
+	QUAD $0x000000008d048d48                   // leaq	0(,%rcx,4), %rax
+	LONG $0x2171e3c4; WORD $0x8b0c; BYTE $0x10 // vinsertps	$0x10, (%rbx,%rcx,4), %xmm1, %xmm1
+	LONG $0x1879c2c4; WORD $0x8f24             // vbroadcastss	(%r15,%rcx,4), %xmm4
+	QUAD $0x10008d442179c3c4                   // vinsertps	$0x10, 0(%r13,%rcx,4), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	LONG $0xc05cd8c5                           // vsubps	%xmm0, %xmm4, %xmm0
+	LONG $0xb87962c4; BYTE $0xd8               // vfmadd231ps	%xmm0, %xmm0, %xmm11
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_8
+	LONG $0x4c10fac5; WORD $0x0430             // vmovss	4(%rax,%rsi), %xmm1
+	LONG $0x4410fac5; WORD $0x0438             // vmovss	4(%rax,%rdi), %xmm0
+	LONG $0x02418d4c                           // leaq	2(%rcx), %r8
+	QUAD $0x1004034c2171e3c4                   // vinsertps	$0x10, 4(%rbx,%rax), %xmm1, %xmm1
+	LONG $0x1879c2c4; WORD $0x075c; BYTE $0x04 // vbroadcastss	4(%r15,%rax), %xmm3
+	QUAD $0x100405442179c3c4                   // vinsertps	$0x10, 4(%r13,%rax), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	LONG $0xc05ce0c5                           // vsubps	%xmm0, %xmm3, %xmm0
+	LONG $0xb87962c4; BYTE $0xd8               // vfmadd231ps	%xmm0, %xmm0, %xmm11
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_8
+	LONG $0x4c10fac5; WORD $0x0830             // vmovss	8(%rax,%rsi), %xmm1
+	LONG $0x4410fac5; WORD $0x0838             // vmovss	8(%rax,%rdi), %xmm0
+	LONG $0x03418d4c                           // leaq	3(%rcx), %r8
+	QUAD $0x1008034c2171e3c4                   // vinsertps	$0x10, 8(%rbx,%rax), %xmm1, %xmm1
+	LONG $0x1879c2c4; WORD $0x0764; BYTE $0x08 // vbroadcastss	8(%r15,%rax), %xmm4
+	QUAD $0x100805442179c3c4                   // vinsertps	$0x10, 8(%r13,%rax), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	LONG $0xc05cd8c5                           // vsubps	%xmm0, %xmm4, %xmm0
+	LONG $0xb87962c4; BYTE $0xd8               // vfmadd231ps	%xmm0, %xmm0, %xmm11
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_8
+	LONG $0x4c10fac5; WORD $0x0c30             // vmovss	12(%rax,%rsi), %xmm1
+	LONG $0x4410fac5; WORD $0x0c38             // vmovss	12(%rax,%rdi), %xmm0
+	LONG $0x04418d4c                           // leaq	4(%rcx), %r8
+	QUAD $0x100c034c2171e3c4                   // vinsertps	$0x10, 12(%rbx,%rax), %xmm1, %xmm1
+	LONG $0x1879c2c4; WORD $0x075c; BYTE $0x0c // vbroadcastss	12(%r15,%rax), %xmm3
+	QUAD $0x100c05442179c3c4                   // vinsertps	$0x10, 12(%r13,%rax), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	LONG $0xc05ce0c5                           // vsubps	%xmm0, %xmm3, %xmm0
+	LONG $0xb87962c4; BYTE $0xd8               // vfmadd231ps	%xmm0, %xmm0, %xmm11
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_8
+	LONG $0x4c10fac5; WORD $0x1030             // vmovss	16(%rax,%rsi), %xmm1
+	LONG $0x4410fac5; WORD $0x1038             // vmovss	16(%rax,%rdi), %xmm0
+	LONG $0x05418d4c                           // leaq	5(%rcx), %r8
+	QUAD $0x1010034c2171e3c4                   // vinsertps	$0x10, 16(%rbx,%rax), %xmm1, %xmm1
+	LONG $0x1879c2c4; WORD $0x0764; BYTE $0x10 // vbroadcastss	16(%r15,%rax), %xmm4
+	QUAD $0x101005442179c3c4                   // vinsertps	$0x10, 16(%r13,%rax), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	LONG $0xc05cd8c5                           // vsubps	%xmm0, %xmm4, %xmm0
+	LONG $0xb87962c4; BYTE $0xd8               // vfmadd231ps	%xmm0, %xmm0, %xmm11
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_8
+	LONG $0x4c10fac5; WORD $0x1430             // vmovss	20(%rax,%rsi), %xmm1
+	LONG $0x4410fac5; WORD $0x1438             // vmovss	20(%rax,%rdi), %xmm0
+	LONG $0x06c18348                           // addq	$6, %rcx
+	QUAD $0x1014034c2171e3c4                   // vinsertps	$0x10, 20(%rbx,%rax), %xmm1, %xmm1
+	LONG $0x1879c2c4; WORD $0x075c; BYTE $0x14 // vbroadcastss	20(%r15,%rax), %xmm3
+	QUAD $0x101405442179c3c4                   // vinsertps	$0x10, 20(%r13,%rax), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	LONG $0xc05ce0c5                           // vsubps	%xmm0, %xmm3, %xmm0
+	LONG $0xb87962c4; BYTE $0xd8               // vfmadd231ps	%xmm0, %xmm0, %xmm11
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_8
+	LONG $0x4c10fac5; WORD $0x1830             // vmovss	24(%rax,%rsi), %xmm1
+	LONG $0x4410fac5; WORD $0x1838             // vmovss	24(%rax,%rdi), %xmm0
+	QUAD $0x1018034c2171e3c4                   // vinsertps	$0x10, 24(%rbx,%rax), %xmm1, %xmm1
+	LONG $0x1879c2c4; WORD $0x0764; BYTE $0x18 // vbroadcastss	24(%r15,%rax), %xmm4
+	QUAD $0x101805442179c3c4                   // vinsertps	$0x10, 24(%r13,%rax), %xmm0, %xmm0
+	LONG $0xc116f8c5                           // vmovlhps	%xmm1, %xmm0, %xmm0
+	LONG $0xc05cd8c5                           // vsubps	%xmm0, %xmm4, %xmm0
+	LONG $0xb87962c4; BYTE $0xd8               // vfmadd231ps	%xmm0, %xmm0, %xmm11
+
+BB0_8:
+	LONG $0x245c8b48; BYTE $0x30   // movq	48(%rsp), %rbx
+	LONG $0x7ef961c4; BYTE $0xd1   // vmovq	%xmm10, %rcx
+	LONG $0x24448b48; BYTE $0x48   // movq	72(%rsp), %rax
+	WORD $0x0148; BYTE $0xdf       // addq	%rbx, %rdi
+	WORD $0x0148; BYTE $0xde       // addq	%rbx, %rsi
+	LONG $0x245c8b48; BYTE $0x68   // movq	104(%rsp), %rbx
+	LONG $0x10c08348               // addq	$16, %rax
+	LONG $0x581178c5; BYTE $0xf0   // vmovups	%xmm11, -16(%rax)
+	WORD $0x0148; BYTE $0xcb       // addq	%rcx, %rbx
+	LONG $0x24448948; BYTE $0x48   // movq	%rax, 72(%rsp)
+	LONG $0x245c8948; BYTE $0x78   // movq	%rbx, 120(%rsp)
+	LONG $0x245c8b48; BYTE $0x60   // movq	96(%rsp), %rbx
+	WORD $0x0148; BYTE $0xcb       // addq	%rcx, %rbx
+	LONG $0x245c8948; BYTE $0x70   // movq	%rbx, 112(%rsp)
+	LONG $0x08fde162; WORD $0xfb7e // vmovq	%xmm23, %rbx
+	WORD $0x3948; BYTE $0xd8       // cmpq	%rbx, %rax
+	JNE  BB0_15
+	LONG $0x244c8b4c; BYTE $0x18   // movq	24(%rsp), %r9
+	LONG $0x245c8b4c; BYTE $0x20   // movq	32(%rsp), %r11
+	WORD $0x894d; BYTE $0xfe       // movq	%r15, %r14
+	LONG $0x24448b48; BYTE $0x10   // movq	16(%rsp), %rax
+	LONG $0x24448b4c; BYTE $0x08   // movq	8(%rsp), %r8
+	QUAD $0x000000048d3c8d4a       // leaq	4(,%r9,4), %rdi
+	WORD $0x394c; BYTE $0xdf       // cmpq	%r11, %rdi
+	JGE  BB0_53
+
+BB0_5:
+	LONG $0xb8248d4c             // leaq	(%rax,%rdi,4), %r12
+	LONG $0x98048d4a             // leaq	(%rax,%r11,4), %rax
+	LONG $0x6ef9e1c4; BYTE $0xd8 // vmovq	%rax, %xmm3
+	LONG $0xfaaf0f48             // imulq	%rdx, %rdi
+	WORD $0x894c; BYTE $0xc0     // movq	%r8, %rax
+	LONG $0x04e8c148             // shrq	$4, %rax
+	LONG $0xfb6ff9c5             // vmovdqa	%xmm3, %xmm7
+	LONG $0x01708d48             // leaq	1(%rax), %rsi
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	WORD $0x8948; BYTE $0xf3     // movq	%rsi, %rbx
+	LONG $0x06e6c148             // salq	$6, %rsi
+	LONG $0x04e3c148             // salq	$4, %rbx
+	WORD $0x014c; BYTE $0xf6     // addq	%r14, %rsi
+	WORD $0x2948; BYTE $0xd8     // subq	%rbx, %rax
+	LONG $0xff488d48             // leaq	-1(%rax), %rcx
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	LONG $0x24448948; BYTE $0x68 // movq	%rax, 104(%rsp)
+	LONG $0x244c8948; BYTE $0x60 // movq	%rcx, 96(%rsp)
+	WORD $0x8948; BYTE $0xc1     // movq	%rax, %rcx
+	WORD $0xe083; BYTE $0x0f     // andl	$15, %eax
+	LONG $0x04e9c149             // shrq	$4, %r9
+	LONG $0xf0e18348             // andq	$-16, %rcx
+	LONG $0x24448948; BYTE $0x70 // movq	%rax, 112(%rsp)
+	LONG $0x06e1c149             // salq	$6, %r9
+	LONG $0x244c8948; BYTE $0x78 // movq	%rcx, 120(%rsp)
+
+BB0_25:
+	LONG $0xba3c8d4d             // leaq	(%r10,%rdi,4), %r15
+	LONG $0x0ffa8348             // cmpq	$15, %rdx
+	JLE  BB0_16
+	LONG $0xc957f0c5             // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x000010b8; BYTE $0x00 // movl	$16, %eax
+
+BB0_17:
+	QUAD $0xff866410487cd162                   // vmovups	-64(%r14,%rax,4), %zmm4
+	QUAD $0xff87445c485cd162                   // vsubps	-64(%r15,%rax,4), %zmm4, %zmm0
+	LONG $0x10c08348                           // addq	$16, %rax
+	LONG $0x487df262; WORD $0xc8b8             // vfmadd231ps	%zmm0, %zmm0, %zmm1
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JLE  BB0_17
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc158fcc5                           // vaddps	%ymm1, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0x0479e3c4; WORD $0x4ec1             // vpermilps	$78, %xmm1, %xmm0
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc828f8c5                           // vmovaps	%xmm0, %xmm1
+	LONG $0xc0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm0
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xda                   // cmpq	%rbx, %rdx
+	JLE  BB0_18
+	LONG $0x247c8348; WORD $0x0e60             // cmpq	$14, 96(%rsp)
+	LONG $0x24448b4c; BYTE $0x68               // movq	104(%rsp), %r8
+	JBE  BB0_29
+	LONG $0x1f048d48                           // leaq	(%rdi,%rbx), %rax
+	LONG $0x820c8d49                           // leaq	(%r10,%rax,4), %rcx
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_20:
+	LONG $0x487cf162; WORD $0x1c10; BYTE $0x06 // vmovups	(%rsi,%rax), %zmm3
+	LONG $0x4864f162; WORD $0x045c; BYTE $0x01 // vsubps	(%rcx,%rax), %zmm3, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0xc059             // vmulps	%zmm0, %zmm0, %zmm0
+	LONG $0xe0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm4
+	LONG $0xd8c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm3
+	LONG $0x287df362; WORD $0xd003; BYTE $0x07 // valignd	$7, %ymm0, %ymm0, %ymm2
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0xc815f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm1
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xe003; BYTE $0x05 // valignd	$5, %ymm0, %ymm0, %ymm4
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xc119; BYTE $0x01 // vextractf32x4	$1, %ymm0, %xmm1
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0x287df362; WORD $0xc803; BYTE $0x06 // valignd	$6, %ymm0, %ymm0, %ymm1
+	LONG $0x487df362; WORD $0xc01b; BYTE $0x01 // vextractf32x8	$0x1, %zmm0, %ymm0
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xe0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm4
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xc8c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm1
+	LONG $0xea58fac5                           // vaddss	%xmm2, %xmm0, %xmm5
+	LONG $0xd015f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm2
+	LONG $0xe558dac5                           // vaddss	%xmm5, %xmm4, %xmm4
+	LONG $0xd458eac5                           // vaddss	%xmm4, %xmm2, %xmm2
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xc219; BYTE $0x01 // vextractf32x4	$1, %ymm0, %xmm2
+	LONG $0xc958eac5                           // vaddss	%xmm1, %xmm2, %xmm1
+	LONG $0x287df362; WORD $0xd003; BYTE $0x05 // valignd	$5, %ymm0, %ymm0, %ymm2
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xc803; BYTE $0x06 // valignd	$6, %ymm0, %ymm0, %ymm1
+	LONG $0x287df362; WORD $0xc003; BYTE $0x07 // valignd	$7, %ymm0, %ymm0, %ymm0
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	WORD $0x394c; BYTE $0xc8                   // cmpq	%r9, %rax
+	JNE  BB0_20
+	LONG $0x24448b48; BYTE $0x78               // movq	120(%rsp), %rax
+	WORD $0x8949; BYTE $0xc3                   // movq	%rax, %r11
+	WORD $0x0148; BYTE $0xd8                   // addq	%rbx, %rax
+	LONG $0x247c8348; WORD $0x0070             // cmpq	$0, 112(%rsp)
+	JE   BB0_18
+	WORD $0x8948; BYTE $0xd9                   // movq	%rbx, %rcx
+
+BB0_19:
+	WORD $0x294d; BYTE $0xd8                   // subq	%r11, %r8
+	LONG $0xff688d4d                           // leaq	-1(%r8), %r13
+	LONG $0x06fd8349                           // cmpq	$6, %r13
+	JBE  BB0_23
+	LONG $0x192c8d4e                           // leaq	(%rcx,%r11), %r13
+	WORD $0x0148; BYTE $0xf9                   // addq	%rdi, %rcx
+	WORD $0x014c; BYTE $0xd9                   // addq	%r11, %rcx
+	LONG $0x107c81c4; WORD $0xae04             // vmovups	(%r14,%r13,4), %ymm0
+	LONG $0x5c7cc1c4; WORD $0x8a04             // vsubps	(%r10,%rcx,4), %ymm0, %ymm0
+	WORD $0x894c; BYTE $0xc1                   // movq	%r8, %rcx
+	LONG $0xf8e18348                           // andq	$-8, %rcx
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x07e08341                           // andl	$7, %r8d
+	LONG $0xc059fcc5                           // vmulps	%ymm0, %ymm0, %ymm0
+	LONG $0xc958fac5                           // vaddss	%xmm1, %xmm0, %xmm1
+	LONG $0xe8c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm5
+	LONG $0xe0c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm4
+	LONG $0xe958d2c5                           // vaddss	%xmm1, %xmm5, %xmm5
+	LONG $0xc815f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm1
+	LONG $0xcd58f2c5                           // vaddss	%xmm5, %xmm1, %xmm1
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0x287df362; WORD $0xc119; BYTE $0x01 // vextractf32x4	$1, %ymm0, %xmm1
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xe003; BYTE $0x05 // valignd	$5, %ymm0, %ymm0, %ymm4
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0x287df362; WORD $0xc803; BYTE $0x06 // valignd	$6, %ymm0, %ymm0, %ymm1
+	LONG $0x287df362; WORD $0xc003; BYTE $0x07 // valignd	$7, %ymm0, %ymm0, %ymm0
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	JE   BB0_18
+
+BB0_23:
+	LONG $0x107ac1c4; WORD $0x8604             // vmovss	(%r14,%rax,4), %xmm0
+	LONG $0x5c7ac1c4; WORD $0x8704             // vsubss	(%r15,%rax,4), %xmm0, %xmm0
+	LONG $0x01488d48                           // leaq	1(%rax), %rcx
+	QUAD $0x0000000085048d4c                   // leaq	0(,%rax,4), %r8
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JGE  BB0_18
+	LONG $0x107a81c4; WORD $0x0644; BYTE $0x04 // vmovss	4(%r14,%r8), %xmm0
+	LONG $0x5c7a81c4; WORD $0x0744; BYTE $0x04 // vsubss	4(%r15,%r8), %xmm0, %xmm0
+	LONG $0x02488d48                           // leaq	2(%rax), %rcx
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_18
+	LONG $0x107a81c4; WORD $0x0644; BYTE $0x08 // vmovss	8(%r14,%r8), %xmm0
+	LONG $0x5c7a81c4; WORD $0x0744; BYTE $0x08 // vsubss	8(%r15,%r8), %xmm0, %xmm0
+	LONG $0x03488d48                           // leaq	3(%rax), %rcx
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_18
+	LONG $0x107a81c4; WORD $0x0644; BYTE $0x0c // vmovss	12(%r14,%r8), %xmm0
+	LONG $0x5c7a81c4; WORD $0x0744; BYTE $0x0c // vsubss	12(%r15,%r8), %xmm0, %xmm0
+	LONG $0x04488d48                           // leaq	4(%rax), %rcx
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xd1                   // cmpq	%rdx, %rcx
+	JGE  BB0_18
+	LONG $0x107a81c4; WORD $0x0644; BYTE $0x10 // vmovss	16(%r14,%r8), %xmm0
+	LONG $0x5c7a81c4; WORD $0x0744; BYTE $0x10 // vsubss	16(%r15,%r8), %xmm0, %xmm0
+	LONG $0x05488d48                           // leaq	5(%rax), %rcx
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_18
+	LONG $0x107a81c4; WORD $0x0644; BYTE $0x14 // vmovss	20(%r14,%r8), %xmm0
+	LONG $0x5c7a81c4; WORD $0x0744; BYTE $0x14 // vsubss	20(%r15,%r8), %xmm0, %xmm0
+	LONG $0x06c08348                           // addq	$6, %rax
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_18
+	LONG $0x107a81c4; WORD $0x0644; BYTE $0x18 // vmovss	24(%r14,%r8), %xmm0
+	LONG $0x5c7a81c4; WORD $0x0744; BYTE $0x18 // vsubss	24(%r15,%r8), %xmm0, %xmm0
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+
+BB0_18:
+	LONG $0x117ac1c4; WORD $0x240c // vmovss	%xmm1, (%r12)
+	LONG $0x7ef9e1c4; BYTE $0xf8   // vmovq	%xmm7, %rax
+	LONG $0x04c48349               // addq	$4, %r12
+	WORD $0x0148; BYTE $0xd7       // addq	%rdx, %rdi
+	WORD $0x3949; BYTE $0xc4       // cmpq	%rax, %r12
+	JNE  BB0_25
+
+BB0_53:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_48:
+	LONG $0xd0658d48 // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_27:
+	LONG $0xf657c9c5               // vxorpd	%xmm6, %xmm6, %xmm6
+	WORD $0xc931                   // xorl	%ecx, %ecx
+	LONG $0x48fdf162; WORD $0xee28 // vmovapd	%zmm6, %zmm5
+	LONG $0x48fdf162; WORD $0xe628 // vmovapd	%zmm6, %zmm4
+	LONG $0x48fdf162; WORD $0xfe28 // vmovapd	%zmm6, %zmm7
+	JMP  BB0_6
+
+BB0_28:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_9
+
+BB0_50:
+	RET
+
+BB0_16:
+	LONG $0xc957f0c5         // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0x8949; BYTE $0xd0 // movq	%rdx, %r8
+	WORD $0xc931             // xorl	%ecx, %ecx
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_19
+
+BB0_26:
+	WORD $0xff31     // xorl	%edi, %edi
+	LONG $0xf0428d4c // leaq	-16(%rdx), %r8
+	JMP  BB0_5
+
+BB0_29:
+	WORD $0x8948; BYTE $0xd9 // movq	%rbx, %rcx
+	WORD $0x8948; BYTE $0xd8 // movq	%rbx, %rax
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	JMP  BB0_19
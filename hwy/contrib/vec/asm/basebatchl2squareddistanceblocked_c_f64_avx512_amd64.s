@@ -0,0 +1,539 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basebatchl2squareddistanceblocked_c_f64_avx512_amd64.c
+
+TEXT ·batchl2squareddistanceblocked_c_f64_avx512(SB), $80-64
+	MOVQ query+0(FP), DI
+	MOVQ data+8(FP), SI
+	MOVQ distances+16(FP), DX
+	MOVQ pcount+24(FP), CX
+	MOVQ pdims+32(FP), R8
+	MOVQ plen_query+40(FP), R9
+	MOVQ plen_data+48(FP), R11
+	MOVQ R11, 64(SP)
+	MOVQ plen_distances+56(FP), R11
+	MOVQ R11, 72(SP)
+	WORD $0x8949; BYTE $0xd3             // movq	%rdx, %r11
+	LONG $0x246c8d48; BYTE $0x30         // leaq	48(%rsp), %rbp
+	LONG $0x24648d48; BYTE $0x40         // leaq	64(%rsp), %rsp
+	LONG $0xc0e48348                     // andq	$-64, %rsp
+	LONG $0x80c48348                     // addq	$-128, %rsp
+	WORD $0x8b48; BYTE $0x19             // movq	(%rcx), %rbx
+	WORD $0x8b49; BYTE $0x10             // movq	(%r8), %rdx
+	WORD $0x8548; BYTE $0xdb             // testq	%rbx, %rbx
+	JLE  BB0_44
+	WORD $0x8548; BYTE $0xd2             // testq	%rdx, %rdx
+	JLE  BB0_44
+	LONG $0x10458b48                     // movq	16(%rbp), %rax
+	WORD $0x8948; BYTE $0xd9             // movq	%rbx, %rcx
+	LONG $0xcaaf0f48                     // imulq	%rdx, %rcx
+	WORD $0x3b48; BYTE $0x08             // cmpq	(%rax), %rcx
+	JG   BB0_44
+	LONG $0x18458b48                     // movq	24(%rbp), %rax
+	WORD $0x3b48; BYTE $0x18             // cmpq	(%rax), %rbx
+	JG   BB0_44
+	WORD $0x3b49; BYTE $0x11             // cmpq	(%r9), %rdx
+	JG   BB0_44
+	WORD $0x8949; BYTE $0xfe             // movq	%rdi, %r14
+	WORD $0x8949; BYTE $0xf2             // movq	%rsi, %r10
+	LONG $0x03fb8348                     // cmpq	$3, %rbx
+	JLE  BB0_22
+	WORD $0x8948; BYTE $0xd0             // movq	%rdx, %rax
+	LONG $0xf84a8d4c                     // leaq	-8(%rdx), %r9
+	LONG $0x123c8d4c                     // leaq	(%rdx,%rdx), %r15
+	WORD $0x8948; BYTE $0xf7             // movq	%rsi, %rdi
+	LONG $0x05e0c148                     // salq	$5, %rax
+	WORD $0x8948; BYTE $0xd6             // movq	%rdx, %rsi
+	LONG $0x245c894c; BYTE $0x48         // movq	%r11, 72(%rsp)
+	LONG $0x24448948; BYTE $0x30         // movq	%rax, 48(%rsp)
+	LONG $0xfc438d48                     // leaq	-4(%rbx), %rax
+	LONG $0x04e6c148                     // salq	$4, %rsi
+	LONG $0x02e8c148                     // shrq	$2, %rax
+	LONG $0x245c8948; BYTE $0x20         // movq	%rbx, 32(%rsp)
+	WORD $0x014c; BYTE $0xd6             // addq	%r10, %rsi
+	WORD $0x8948; BYTE $0xc1             // movq	%rax, %rcx
+	LONG $0x24448948; BYTE $0x18         // movq	%rax, 24(%rsp)
+	LONG $0x05e1c148                     // salq	$5, %rcx
+	LONG $0x245c894c; BYTE $0x10         // movq	%r11, 16(%rsp)
+	LONG $0x0b4c8d49; BYTE $0x20         // leaq	32(%r11,%rcx), %rcx
+	LONG $0x244c894c; BYTE $0x08         // movq	%r9, 8(%rsp)
+	LONG $0x6ef961c4; BYTE $0xd9         // vmovq	%rcx, %xmm11
+	QUAD $0x00000000d50c8d48             // leaq	0(,%rdx,8), %rcx
+	LONG $0x247c894c; BYTE $0x70         // movq	%r15, 112(%rsp)
+	QUAD $0x000000782444c748; BYTE $0x00 // movq	$0, 120(%rsp)
+	LONG $0x6ef961c4; BYTE $0xd1         // vmovq	%rcx, %xmm10
+	WORD $0x894c; BYTE $0xc9             // movq	%r9, %rcx
+	LONG $0x03e9c148                     // shrq	$3, %rcx
+	QUAD $0x00000008cd0c8d48             // leaq	8(,%rcx,8), %rcx
+	LONG $0x244c8948; BYTE $0x28         // movq	%rcx, 40(%rsp)
+	LONG $0x170c8d49                     // leaq	(%r15,%rdx), %rcx
+	WORD $0x894d; BYTE $0xf7             // movq	%r14, %r15
+	LONG $0x6ef9e1c4; BYTE $0xe1         // vmovq	%rcx, %xmm4
+
+BB0_12:
+	LONG $0x24448b48; BYTE $0x78   // movq	120(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x24448948; BYTE $0x68   // movq	%rax, 104(%rsp)
+	LONG $0x7ef961c4; BYTE $0xd0   // vmovq	%xmm10, %rax
+	LONG $0x072c8d4c               // leaq	(%rdi,%rax), %r13
+	LONG $0x24448b48; BYTE $0x70   // movq	112(%rsp), %rax
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x24448948; BYTE $0x60   // movq	%rax, 96(%rsp)
+	LONG $0x7ef961c4; BYTE $0xd0   // vmovq	%xmm10, %rax
+	LONG $0x061c8d48               // leaq	(%rsi,%rax), %rbx
+	LONG $0x07fa8348               // cmpq	$7, %rdx
+	JLE  BB0_23
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b8; BYTE $0x00   // movl	$8, %eax
+	LONG $0x48fd7162; WORD $0xc128 // vmovapd	%zmm1, %zmm8
+	LONG $0x48fd7162; WORD $0xe128 // vmovapd	%zmm1, %zmm12
+	LONG $0x48fd7162; WORD $0xe928 // vmovapd	%zmm1, %zmm13
+
+BB0_5:
+	QUAD $0xffc7441048fdd162       // vmovupd	-64(%r15,%rax,8), %zmm0
+	QUAD $0xffc77c5c48fdf162       // vsubpd	-64(%rdi,%rax,8), %zmm0, %zmm7
+	QUAD $0xffc5745c48fdd162       // vsubpd	-64(%r13,%rax,8), %zmm0, %zmm6
+	QUAD $0xffc6545c48fdf162       // vsubpd	-64(%rsi,%rax,8), %zmm0, %zmm2
+	QUAD $0xffc3445c48fdf162       // vsubpd	-64(%rbx,%rax,8), %zmm0, %zmm0
+	LONG $0x08c08348               // addq	$8, %rax
+	LONG $0x48c57262; WORD $0xefb8 // vfmadd231pd	%zmm7, %zmm7, %zmm13
+	LONG $0x48cd7262; WORD $0xe6b8 // vfmadd231pd	%zmm6, %zmm6, %zmm12
+	LONG $0x48ed7262; WORD $0xc2b8 // vfmadd231pd	%zmm2, %zmm2, %zmm8
+	LONG $0x48fdf262; WORD $0xc8b8 // vfmadd231pd	%zmm0, %zmm0, %zmm1
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JLE  BB0_5
+	LONG $0x244c8b48; BYTE $0x28   // movq	40(%rsp), %rcx
+
+BB0_4:
+	LONG $0x48fd7362; WORD $0xe81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm13, %ymm0
+	LONG $0x587dc1c4; BYTE $0xc5               // vaddpd	%ymm13, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc719; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm7
+	LONG $0xf858c1c5                           // vaddpd	%xmm0, %xmm7, %xmm7
+	LONG $0x48fd7362; WORD $0xe01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm12, %ymm0
+	LONG $0x587dc1c4; BYTE $0xc4               // vaddpd	%ymm12, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc619; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm6
+	LONG $0xf058c9c5                           // vaddpd	%xmm0, %xmm6, %xmm6
+	LONG $0x48fd7362; WORD $0xc01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm8, %ymm0
+	LONG $0x587dc1c4; BYTE $0xc0               // vaddpd	%ymm8, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc219; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm2
+	LONG $0xd058e9c5                           // vaddpd	%xmm0, %xmm2, %xmm2
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc858f5c5                           // vaddpd	%ymm0, %ymm1, %ymm1
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$0x1, %ymm1, %xmm0
+	LONG $0xc958f9c5                           // vaddpd	%xmm1, %xmm0, %xmm1
+	LONG $0xc710c3c5                           // vmovsd	%xmm7, %xmm7, %xmm0
+	LONG $0xff15c1c5                           // vunpckhpd	%xmm7, %xmm7, %xmm7
+	LONG $0xc758fbc5                           // vaddsd	%xmm7, %xmm0, %xmm0
+	LONG $0xfe10cbc5                           // vmovsd	%xmm6, %xmm6, %xmm7
+	LONG $0xf615c9c5                           // vunpckhpd	%xmm6, %xmm6, %xmm6
+	LONG $0xfe58c3c5                           // vaddsd	%xmm6, %xmm7, %xmm7
+	LONG $0xf210ebc5                           // vmovsd	%xmm2, %xmm2, %xmm6
+	LONG $0xd215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm2
+	LONG $0xf258cbc5                           // vaddsd	%xmm2, %xmm6, %xmm6
+	LONG $0xd110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm2
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc958ebc5                           // vaddsd	%xmm1, %xmm2, %xmm1
+	LONG $0xc714f9c5                           // vunpcklpd	%xmm7, %xmm0, %xmm0
+	LONG $0xc914c9c5                           // vunpcklpd	%xmm1, %xmm6, %xmm1
+	LONG $0x187de3c4; WORD $0x01c1             // vinsertf128	$0x1, %xmm1, %ymm0, %ymm0
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_6
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x244c8948; BYTE $0x50               // movq	%rcx, 80(%rsp)
+	WORD $0x2948; BYTE $0xc8                   // subq	%rcx, %rax
+	LONG $0x24448948; BYTE $0x58               // movq	%rax, 88(%rsp)
+	LONG $0x01e88348                           // subq	$1, %rax
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_24
+	LONG $0x24448b4c; BYTE $0x78               // movq	120(%rsp), %r8
+	LONG $0x245c8b4c; BYTE $0x68               // movq	104(%rsp), %r11
+	LONG $0x2454894c; BYTE $0x38               // movq	%r10, 56(%rsp)
+	LONG $0xcf348d4d                           // leaq	(%r15,%rcx,8), %r14
+	LONG $0x244c8b4c; BYTE $0x70               // movq	112(%rsp), %r9
+	LONG $0x01048d4a                           // leaq	(%rcx,%r8), %rax
+	LONG $0xc2048d4d                           // leaq	(%r10,%rax,8), %r8
+	LONG $0x19048d4a                           // leaq	(%rcx,%r11), %rax
+	LONG $0xc2248d4d                           // leaq	(%r10,%rax,8), %r12
+	LONG $0x09048d4a                           // leaq	(%rcx,%r9), %rax
+	LONG $0x244c8b4c; BYTE $0x60               // movq	96(%rsp), %r9
+	LONG $0xc21c8d4d                           // leaq	(%r10,%rax,8), %r11
+	LONG $0x09048d4a                           // leaq	(%rcx,%r9), %rax
+	LONG $0xc20c8d4d                           // leaq	(%r10,%rax,8), %r9
+	LONG $0x24448b48; BYTE $0x58               // movq	88(%rsp), %rax
+	WORD $0x8949; BYTE $0xf2                   // movq	%rsi, %r10
+	WORD $0x8948; BYTE $0xd6                   // movq	%rdx, %rsi
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	LONG $0x06e0c148                           // salq	$6, %rax
+	LONG $0x24448948; BYTE $0x40               // movq	%rax, 64(%rsp)
+	LONG $0x24548b48; BYTE $0x40               // movq	64(%rsp), %rdx
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_8:
+	LONG $0x48fd5162; WORD $0x3410; BYTE $0x06 // vmovupd	(%r14,%rax), %zmm14
+	LONG $0x488dd162; WORD $0x0c5c; BYTE $0x00 // vsubpd	(%r8,%rax), %zmm14, %zmm1
+	LONG $0x488dc162; WORD $0x0c5c; BYTE $0x04 // vsubpd	(%r12,%rax), %zmm14, %zmm17
+	LONG $0x488dc162; WORD $0x045c; BYTE $0x03 // vsubpd	(%r11,%rax), %zmm14, %zmm16
+	LONG $0x488d5162; WORD $0x3c5c; BYTE $0x01 // vsubpd	(%r9,%rax), %zmm14, %zmm15
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x48f5f162; WORD $0xd159             // vmulpd	%zmm1, %zmm1, %zmm2
+	LONG $0x40fda162; WORD $0xc059             // vmulpd	%zmm16, %zmm16, %zmm16
+	LONG $0x40f5a162; WORD $0xc959             // vmulpd	%zmm17, %zmm17, %zmm17
+	LONG $0x48855162; WORD $0xff59             // vmulpd	%zmm15, %zmm15, %zmm15
+	LONG $0x28edf362; WORD $0xda03; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm3
+	LONG $0x08ede162; WORD $0xf215             // vunpckhpd	%xmm2, %xmm2, %xmm22
+	LONG $0x20fd3362; WORD $0xf003; BYTE $0x03 // valignq	$3, %ymm16, %ymm16, %ymm14
+	LONG $0x00fda162; WORD $0xf815             // vunpckhpd	%xmm16, %xmm16, %xmm23
+	LONG $0x28fde362; WORD $0xcd19; BYTE $0x01 // vextractf64x2	$1, %ymm17, %xmm5
+	LONG $0x08edb162; WORD $0xc914             // vunpcklpd	%xmm17, %xmm2, %xmm1
+	LONG $0x00f7a162; WORD $0xd610             // vmovsd	%xmm22, %xmm17, %xmm18
+	LONG $0x28fd7362; WORD $0xfe19; BYTE $0x01 // vextractf64x2	$1, %ymm15, %xmm6
+	LONG $0x00fd4162; WORD $0xc714             // vunpcklpd	%xmm15, %xmm16, %xmm24
+	LONG $0x0887a162; WORD $0xef10             // vmovsd	%xmm23, %xmm15, %xmm21
+	LONG $0x20f5a362; WORD $0xd903; BYTE $0x03 // valignq	$3, %ymm17, %ymm17, %ymm19
+	LONG $0x28f59362; WORD $0xc818; BYTE $0x01 // vinsertf64x2	$0x1, %xmm24, %ymm1, %ymm1
+	LONG $0x20eda362; WORD $0xd518; BYTE $0x01 // vinsertf64x2	$0x1, %xmm21, %ymm18, %ymm18
+	LONG $0x48fda362; WORD $0xc91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm17, %ymm17
+	LONG $0x2885c362; WORD $0xe703; BYTE $0x03 // valignq	$3, %ymm15, %ymm15, %ymm20
+	LONG $0xc058f5c5                           // vaddpd	%ymm0, %ymm1, %ymm0
+	LONG $0x48fd5362; WORD $0xff1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm15, %ymm15
+	LONG $0x28fdf362; WORD $0xd119; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm1
+	LONG $0x28fdb162; WORD $0xc258             // vaddpd	%ymm18, %ymm0, %ymm0
+	LONG $0x28fda362; WORD $0xc219; BYTE $0x01 // vextractf64x2	$1, %ymm16, %xmm18
+	LONG $0x08e5b162; WORD $0xdb14             // vunpcklpd	%xmm19, %xmm3, %xmm3
+	LONG $0x088d3162; WORD $0xf414             // vunpcklpd	%xmm20, %xmm14, %xmm14
+	LONG $0xcd14f1c5                           // vunpcklpd	%xmm5, %xmm1, %xmm1
+	LONG $0x1865c3c4; WORD $0x01de             // vinsertf128	$0x1, %xmm14, %ymm3, %ymm3
+	LONG $0x28fd7362; WORD $0xfd19; BYTE $0x01 // vextractf64x2	$1, %ymm15, %xmm5
+	LONG $0x00ede162; WORD $0xd614             // vunpcklpd	%xmm6, %xmm18, %xmm18
+	LONG $0x28f5b362; WORD $0xca18; BYTE $0x01 // vinsertf64x2	$0x1, %xmm18, %ymm1, %ymm1
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	LONG $0x48fdf362; WORD $0xd11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm1
+	LONG $0x48fde362; WORD $0xc21b; BYTE $0x01 // vextractf64x4	$0x1, %zmm16, %ymm2
+	LONG $0x08edc162; WORD $0xef14             // vunpcklpd	%xmm15, %xmm2, %xmm21
+	LONG $0x08f53162; WORD $0xf114             // vunpcklpd	%xmm17, %xmm1, %xmm14
+	LONG $0x08f5e162; WORD $0xd915             // vunpckhpd	%xmm1, %xmm1, %xmm19
+	LONG $0x08ede162; WORD $0xe215             // vunpckhpd	%xmm2, %xmm2, %xmm20
+	LONG $0x288d3362; WORD $0xf518; BYTE $0x01 // vinsertf64x2	$0x1, %xmm21, %ymm14, %ymm14
+	LONG $0x00f7a162; WORD $0xd310             // vmovsd	%xmm19, %xmm17, %xmm18
+	LONG $0xc358fdc5                           // vaddpd	%ymm3, %ymm0, %ymm0
+	LONG $0x0887a162; WORD $0xc410             // vmovsd	%xmm20, %xmm15, %xmm16
+	LONG $0x28fde362; WORD $0xcb19; BYTE $0x01 // vextractf64x2	$1, %ymm17, %xmm3
+	LONG $0x20eda362; WORD $0xd018; BYTE $0x01 // vinsertf64x2	$0x1, %xmm16, %ymm18, %ymm18
+	LONG $0x28fdb362; WORD $0xd019; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm16
+	LONG $0x20f5a362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm17, %ymm17, %ymm17
+	LONG $0x587dc1c4; BYTE $0xc6               // vaddpd	%ymm14, %ymm0, %ymm0
+	LONG $0x28fdd362; WORD $0xce19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm14
+	LONG $0x28edf362; WORD $0xd203; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm2
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0x28fdb162; WORD $0xc258             // vaddpd	%ymm18, %ymm0, %ymm0
+	LONG $0x28855362; WORD $0xff03; BYTE $0x03 // valignq	$3, %ymm15, %ymm15, %ymm15
+	LONG $0x00fde162; WORD $0xc514             // vunpcklpd	%xmm5, %xmm16, %xmm16
+	LONG $0xf31409c5                           // vunpcklpd	%xmm3, %xmm14, %xmm14
+	LONG $0x288d3362; WORD $0xf018; BYTE $0x01 // vinsertf64x2	$0x1, %xmm16, %ymm14, %ymm14
+	LONG $0x587dc1c4; BYTE $0xc6               // vaddpd	%ymm14, %ymm0, %ymm0
+	LONG $0x08f5b162; WORD $0xc914             // vunpcklpd	%xmm17, %xmm1, %xmm1
+	LONG $0x1469c1c4; BYTE $0xd7               // vunpcklpd	%xmm15, %xmm2, %xmm2
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JNE  BB0_8
+	LONG $0x24748b4c; BYTE $0x58               // movq	88(%rsp), %r14
+	WORD $0x8948; BYTE $0xf2                   // movq	%rsi, %rdx
+	WORD $0x894c; BYTE $0xd6                   // movq	%r10, %rsi
+	LONG $0x24548b4c; BYTE $0x38               // movq	56(%rsp), %r10
+	WORD $0x894c; BYTE $0xf0                   // movq	%r14, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x07e68341                           // andl	$7, %r14d
+	JE   BB0_6
+
+BB0_7:
+	LONG $0x24448b4c; BYTE $0x58               // movq	88(%rsp), %r8
+	WORD $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG $0xff708d4d                           // leaq	-1(%r8), %r14
+	LONG $0x02fe8349                           // cmpq	$2, %r14
+	JBE  BB0_10
+	LONG $0x245c8b4c; BYTE $0x50               // movq	80(%rsp), %r11
+	LONG $0x244c8b4c; BYTE $0x78               // movq	120(%rsp), %r9
+	LONG $0x24748b4c; BYTE $0x60               // movq	96(%rsp), %r14
+	WORD $0x014c; BYTE $0xd8                   // addq	%r11, %rax
+	LONG $0x245c8b4c; BYTE $0x68               // movq	104(%rsp), %r11
+	WORD $0x0149; BYTE $0xc1                   // addq	%rax, %r9
+	LONG $0x107dc1c4; WORD $0xc734             // vmovupd	(%r15,%rax,8), %ymm6
+	LONG $0x5c4d81c4; WORD $0xca0c             // vsubpd	(%r10,%r9,8), %ymm6, %ymm1
+	LONG $0x180c8d4e                           // leaq	(%rax,%r11), %r9
+	LONG $0x245c8b4c; BYTE $0x70               // movq	112(%rsp), %r11
+	LONG $0x5c4d81c4; WORD $0xca3c             // vsubpd	(%r10,%r9,8), %ymm6, %ymm7
+	WORD $0x0149; BYTE $0xc3                   // addq	%rax, %r11
+	WORD $0x014c; BYTE $0xf0                   // addq	%r14, %rax
+	LONG $0x5c4d81c4; WORD $0xda14             // vsubpd	(%r10,%r11,8), %ymm6, %ymm2
+	LONG $0x5c4dc1c4; WORD $0xc234             // vsubpd	(%r10,%rax,8), %ymm6, %ymm6
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	LONG $0xc959f5c5                           // vmulpd	%ymm1, %ymm1, %ymm1
+	LONG $0xfce08348                           // andq	$-4, %rax
+	LONG $0xe75945c5                           // vmulpd	%ymm7, %ymm7, %ymm12
+	WORD $0x0148; BYTE $0xc1                   // addq	%rax, %rcx
+	LONG $0x03e08341                           // andl	$3, %r8d
+	LONG $0xc2596dc5                           // vmulpd	%ymm2, %ymm2, %ymm8
+	LONG $0xf659cdc5                           // vmulpd	%ymm6, %ymm6, %ymm6
+	LONG $0xf11571c5                           // vunpckhpd	%xmm1, %xmm1, %xmm14
+	LONG $0x28fd7362; WORD $0xe319; BYTE $0x01 // vextractf64x2	$1, %ymm12, %xmm3
+	LONG $0x1471c1c4; BYTE $0xd4               // vunpcklpd	%xmm12, %xmm1, %xmm2
+	LONG $0xf7111bc5                           // vmovsd	%xmm14, %xmm12, %xmm7
+	LONG $0x289d5362; WORD $0xe403; BYTE $0x03 // valignq	$3, %ymm12, %ymm12, %ymm12
+	LONG $0x153941c4; BYTE $0xf8               // vunpckhpd	%xmm8, %xmm8, %xmm15
+	LONG $0x08bde162; WORD $0xc614             // vunpcklpd	%xmm6, %xmm8, %xmm16
+	LONG $0x104b41c4; BYTE $0xef               // vmovsd	%xmm15, %xmm6, %xmm13
+	LONG $0x28edb362; WORD $0xd018; BYTE $0x01 // vinsertf64x2	$0x1, %xmm16, %ymm2, %ymm2
+	LONG $0x1845c3c4; WORD $0x01fd             // vinsertf128	$0x1, %xmm13, %ymm7, %ymm7
+	LONG $0x28fd5362; WORD $0xc519; BYTE $0x01 // vextractf64x2	$1, %ymm8, %xmm13
+	LONG $0xc058edc5                           // vaddpd	%ymm0, %ymm2, %ymm0
+	LONG $0x28fdf362; WORD $0xca19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm2
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc758fdc5                           // vaddpd	%ymm7, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xf719; BYTE $0x01 // vextractf64x2	$1, %ymm6, %xmm7
+	LONG $0x28cdf362; WORD $0xf603; BYTE $0x03 // valignq	$3, %ymm6, %ymm6, %ymm6
+	LONG $0xd314e9c5                           // vunpcklpd	%xmm3, %xmm2, %xmm2
+	LONG $0x1471c1c4; BYTE $0xcc               // vunpcklpd	%xmm12, %xmm1, %xmm1
+	LONG $0xff1491c5                           // vunpcklpd	%xmm7, %xmm13, %xmm7
+	LONG $0x186de3c4; WORD $0x01d7             // vinsertf128	$0x1, %xmm7, %ymm2, %ymm2
+	LONG $0xc258fdc5                           // vaddpd	%ymm2, %ymm0, %ymm0
+	LONG $0x28bdd362; WORD $0xd003; BYTE $0x03 // valignq	$3, %ymm8, %ymm8, %ymm2
+	LONG $0xd614e9c5                           // vunpcklpd	%xmm6, %xmm2, %xmm2
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	JE   BB0_6
+
+BB0_10:
+	LONG $0x0c10fbc5; BYTE $0xce               // vmovsd	(%rsi,%rcx,8), %xmm1
+	LONG $0x197dc2c4; WORD $0xcf3c             // vbroadcastsd	(%r15,%rcx,8), %ymm7
+	LONG $0x01418d4c                           // leaq	1(%rcx), %r8
+	QUAD $0x00000000cd048d48                   // leaq	0(,%rcx,8), %rax
+	LONG $0x1416f1c5; BYTE $0xcb               // vmovhpd	(%rbx,%rcx,8), %xmm1, %xmm2
+	LONG $0x0c10fbc5; BYTE $0xcf               // vmovsd	(%rdi,%rcx,8), %xmm1
+	LONG $0x1671c1c4; WORD $0xcd4c; BYTE $0x00 // vmovhpd	0(%r13,%rcx,8), %xmm1, %xmm1
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	LONG $0xc95cc5c5                           // vsubpd	%ymm1, %ymm7, %ymm1
+	LONG $0xb8f5e2c4; BYTE $0xc1               // vfmadd231pd	%ymm1, %ymm1, %ymm0
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JLE  BB0_6
+	LONG $0x4c10fbc5; WORD $0x0830             // vmovsd	8(%rax,%rsi), %xmm1
+	LONG $0x197dc2c4; WORD $0x077c; BYTE $0x08 // vbroadcastsd	8(%r15,%rax), %ymm7
+	LONG $0x02c18348                           // addq	$2, %rcx
+	LONG $0x5416f1c5; WORD $0x0803             // vmovhpd	8(%rbx,%rax), %xmm1, %xmm2
+	LONG $0x4c10fbc5; WORD $0x0838             // vmovsd	8(%rax,%rdi), %xmm1
+	LONG $0x1671c1c4; WORD $0x054c; BYTE $0x08 // vmovhpd	8(%r13,%rax), %xmm1, %xmm1
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	LONG $0xc95cc5c5                           // vsubpd	%ymm1, %ymm7, %ymm1
+	LONG $0xb8f5e2c4; BYTE $0xc1               // vfmadd231pd	%ymm1, %ymm1, %ymm0
+	WORD $0x3948; BYTE $0xca                   // cmpq	%rcx, %rdx
+	JLE  BB0_6
+	LONG $0x4c10fbc5; WORD $0x1030             // vmovsd	16(%rax,%rsi), %xmm1
+	LONG $0x197dc2c4; WORD $0x077c; BYTE $0x10 // vbroadcastsd	16(%r15,%rax), %ymm7
+	LONG $0x5416f1c5; WORD $0x1003             // vmovhpd	16(%rbx,%rax), %xmm1, %xmm2
+	LONG $0x4c10fbc5; WORD $0x1038             // vmovsd	16(%rax,%rdi), %xmm1
+	LONG $0x1671c1c4; WORD $0x054c; BYTE $0x10 // vmovhpd	16(%r13,%rax), %xmm1, %xmm1
+	LONG $0x1875e3c4; WORD $0x01ca             // vinsertf128	$0x1, %xmm2, %ymm1, %ymm1
+	LONG $0xc95cc5c5                           // vsubpd	%ymm1, %ymm7, %ymm1
+	LONG $0xb8f5e2c4; BYTE $0xc1               // vfmadd231pd	%ymm1, %ymm1, %ymm0
+
+BB0_6:
+	LONG $0x245c8b48; BYTE $0x30 // movq	48(%rsp), %rbx
+	LONG $0x244c8b48; BYTE $0x68 // movq	104(%rsp), %rcx
+	LONG $0x24448b48; BYTE $0x48 // movq	72(%rsp), %rax
+	WORD $0x0148; BYTE $0xdf     // addq	%rbx, %rdi
+	WORD $0x0148; BYTE $0xde     // addq	%rbx, %rsi
+	LONG $0x7ef9e1c4; BYTE $0xe3 // vmovq	%xmm4, %rbx
+	WORD $0x0148; BYTE $0xd9     // addq	%rbx, %rcx
+	LONG $0x0011fdc5             // vmovupd	%ymm0, (%rax)
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x244c8948; BYTE $0x78 // movq	%rcx, 120(%rsp)
+	LONG $0x244c8b48; BYTE $0x60 // movq	96(%rsp), %rcx
+	LONG $0x24448948; BYTE $0x48 // movq	%rax, 72(%rsp)
+	WORD $0x0148; BYTE $0xd9     // addq	%rbx, %rcx
+	LONG $0x244c8948; BYTE $0x70 // movq	%rcx, 112(%rsp)
+	LONG $0x7ef961c4; BYTE $0xd9 // vmovq	%xmm11, %rcx
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JNE  BB0_12
+	LONG $0x24448b48; BYTE $0x18 // movq	24(%rsp), %rax
+	LONG $0x245c8b48; BYTE $0x20 // movq	32(%rsp), %rbx
+	WORD $0x894d; BYTE $0xfe     // movq	%r15, %r14
+	LONG $0x245c8b4c; BYTE $0x10 // movq	16(%rsp), %r11
+	LONG $0x244c8b4c; BYTE $0x08 // movq	8(%rsp), %r9
+	QUAD $0x0000000485048d4c     // leaq	4(,%rax,4), %r8
+	WORD $0x394c; BYTE $0xc3     // cmpq	%r8, %rbx
+	JLE  BB0_46
+
+BB0_3:
+	WORD $0x894d; BYTE $0xcf     // movq	%r9, %r15
+	LONG $0xdb048d49             // leaq	(%r11,%rbx,8), %rax
+	LONG $0xc3248d4f             // leaq	(%r11,%r8,8), %r12
+	LONG $0x03efc149             // shrq	$3, %r15
+	LONG $0x24448948; BYTE $0x78 // movq	%rax, 120(%rsp)
+	LONG $0xc2af0f4c             // imulq	%rdx, %r8
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	LONG $0x01778d49             // leaq	1(%r15), %rsi
+	QUAD $0x00000000f51c8d48     // leaq	0(,%rsi,8), %rbx
+	LONG $0x06e6c148             // salq	$6, %rsi
+	WORD $0x2948; BYTE $0xd8     // subq	%rbx, %rax
+	WORD $0x014c; BYTE $0xf6     // addq	%r14, %rsi
+	LONG $0xff788d48             // leaq	-1(%rax), %rdi
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	LONG $0x24448948; BYTE $0x60 // movq	%rax, 96(%rsp)
+	LONG $0x247c8948; BYTE $0x58 // movq	%rdi, 88(%rsp)
+	WORD $0x8948; BYTE $0xc7     // movq	%rax, %rdi
+	WORD $0xe083; BYTE $0x07     // andl	$7, %eax
+	LONG $0x03e9c149             // shrq	$3, %r9
+	LONG $0xf8e78348             // andq	$-8, %rdi
+	LONG $0x24448948; BYTE $0x68 // movq	%rax, 104(%rsp)
+	LONG $0x06e1c149             // salq	$6, %r9
+	LONG $0x247c8948; BYTE $0x70 // movq	%rdi, 112(%rsp)
+
+BB0_21:
+	LONG $0xc22c8d4f             // leaq	(%r10,%r8,8), %r13
+	LONG $0x07fa8348             // cmpq	$7, %rdx
+	JLE  BB0_13
+	LONG $0xc957f1c5             // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_14:
+	QUAD $0xffc6641048fdd162                   // vmovupd	-64(%r14,%rax,8), %zmm4
+	QUAD $0xffc5445c48ddd162                   // vsubpd	-64(%r13,%rax,8), %zmm4, %zmm0
+	LONG $0x08c08348                           // addq	$8, %rax
+	LONG $0x48fdf262; WORD $0xc8b8             // vfmadd231pd	%zmm0, %zmm0, %zmm1
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JLE  BB0_14
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc958fdc5                           // vaddpd	%ymm1, %ymm0, %ymm1
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5                           // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc810fbc5                           // vmovsd	%xmm0, %xmm0, %xmm1
+	LONG $0xc015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xda                   // cmpq	%rbx, %rdx
+	JLE  BB0_15
+	LONG $0x247c8348; WORD $0x0658             // cmpq	$6, 88(%rsp)
+	LONG $0x244c8b48; BYTE $0x60               // movq	96(%rsp), %rcx
+	JBE  BB0_25
+	LONG $0x18048d49                           // leaq	(%r8,%rbx), %rax
+	LONG $0xc23c8d49                           // leaq	(%r10,%rax,8), %rdi
+	WORD $0xc031                               // xorl	%eax, %eax
+
+BB0_17:
+	LONG $0x48fdf162; WORD $0x2410; BYTE $0x06 // vmovupd	(%rsi,%rax), %zmm4
+	LONG $0x48ddf162; WORD $0x045c; BYTE $0x07 // vsubpd	(%rdi,%rax), %zmm4, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x48fdf162; WORD $0xc059             // vmulpd	%zmm0, %zmm0, %zmm0
+	LONG $0x28fdf362; WORD $0xe003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm4
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	LONG $0xe815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm5
+	LONG $0xe958d3c5                           // vaddsd	%xmm1, %xmm5, %xmm5
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm1
+	LONG $0x48fdf362; WORD $0xc01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm0
+	LONG $0xcd58f3c5                           // vaddsd	%xmm5, %xmm1, %xmm1
+	LONG $0xe158dbc5                           // vaddsd	%xmm1, %xmm4, %xmm4
+	LONG $0xc815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xd458fbc5                           // vaddsd	%xmm4, %xmm0, %xmm2
+	LONG $0xd258f3c5                           // vaddsd	%xmm2, %xmm1, %xmm2
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm1
+	LONG $0x28fdf362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm0
+	LONG $0xca58f3c5                           // vaddsd	%xmm2, %xmm1, %xmm1
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	WORD $0x394c; BYTE $0xc8                   // cmpq	%r9, %rax
+	JNE  BB0_17
+	LONG $0x24448b48; BYTE $0x70               // movq	112(%rsp), %rax
+	LONG $0x247c8348; WORD $0x0068             // cmpq	$0, 104(%rsp)
+	WORD $0x8949; BYTE $0xc3                   // movq	%rax, %r11
+	LONG $0x183c8d48                           // leaq	(%rax,%rbx), %rdi
+	JE   BB0_15
+	WORD $0x8948; BYTE $0xd8                   // movq	%rbx, %rax
+
+BB0_16:
+	WORD $0x294c; BYTE $0xd9                   // subq	%r11, %rcx
+	LONG $0xff798d4c                           // leaq	-1(%rcx), %r15
+	LONG $0x02ff8349                           // cmpq	$2, %r15
+	JBE  BB0_19
+	LONG $0x183c8d4e                           // leaq	(%rax,%r11), %r15
+	WORD $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+	WORD $0x014c; BYTE $0xd8                   // addq	%r11, %rax
+	LONG $0x107d81c4; WORD $0xfe04             // vmovupd	(%r14,%r15,8), %ymm0
+	LONG $0x5c7dc1c4; WORD $0xc204             // vsubpd	(%r10,%rax,8), %ymm0, %ymm0
+	LONG $0xc059fdc5                           // vmulpd	%ymm0, %ymm0, %ymm0
+	LONG $0xc958fbc5                           // vaddsd	%xmm1, %xmm0, %xmm1
+	LONG $0xe015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm4
+	LONG $0xe158dbc5                           // vaddsd	%xmm1, %xmm4, %xmm4
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm1
+	LONG $0x28fdf362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm0
+	LONG $0xcc58f3c5                           // vaddsd	%xmm4, %xmm1, %xmm1
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	WORD $0xc1f6; BYTE $0x03                   // testb	$3, %cl
+	JE   BB0_15
+	LONG $0xfce18348                           // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xcf                   // addq	%rcx, %rdi
+
+BB0_19:
+	LONG $0x107bc1c4; WORD $0xfe04             // vmovsd	(%r14,%rdi,8), %xmm0
+	LONG $0x5c7bc1c4; WORD $0xfd44; BYTE $0x00 // vsubsd	0(%r13,%rdi,8), %xmm0, %xmm0
+	LONG $0x01478d48                           // leaq	1(%rdi), %rax
+	QUAD $0x00000000fd0c8d48                   // leaq	0(,%rdi,8), %rcx
+	LONG $0xb9f9e2c4; BYTE $0xc8               // vfmadd231sd	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JGE  BB0_15
+	LONG $0x107bc1c4; WORD $0x0e44; BYTE $0x08 // vmovsd	8(%r14,%rcx), %xmm0
+	LONG $0x5c7bc1c4; WORD $0x0d44; BYTE $0x08 // vsubsd	8(%r13,%rcx), %xmm0, %xmm0
+	LONG $0x02c78348                           // addq	$2, %rdi
+	LONG $0xb9f9e2c4; BYTE $0xc8               // vfmadd231sd	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xfa                   // cmpq	%rdi, %rdx
+	JLE  BB0_15
+	LONG $0x107bc1c4; WORD $0x0e44; BYTE $0x10 // vmovsd	16(%r14,%rcx), %xmm0
+	LONG $0x5c7bc1c4; WORD $0x0d44; BYTE $0x10 // vsubsd	16(%r13,%rcx), %xmm0, %xmm0
+	LONG $0xb9f9e2c4; BYTE $0xc8               // vfmadd231sd	%xmm0, %xmm0, %xmm1
+
+BB0_15:
+	LONG $0x117bc1c4; WORD $0x240c // vmovsd	%xmm1, (%r12)
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+	LONG $0x08c48349               // addq	$8, %r12
+	LONG $0x2464394c; BYTE $0x78   // cmpq	%r12, 120(%rsp)
+	JNE  BB0_21
+
+BB0_46:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_44:
+	LONG $0xd0658d48 // leaq	-48(%rbp), %rsp
+	RET
+
+BB0_23:
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0xc931                   // xorl	%ecx, %ecx
+	LONG $0x48fd7162; WORD $0xc128 // vmovapd	%zmm1, %zmm8
+	LONG $0x48fd7162; WORD $0xe128 // vmovapd	%zmm1, %zmm12
+	LONG $0x48fd7162; WORD $0xe928 // vmovapd	%zmm1, %zmm13
+	JMP  BB0_4
+
+BB0_24:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_7
+
+BB0_13:
+	LONG $0xc957f1c5         // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0x8948; BYTE $0xd1 // movq	%rdx, %rcx
+	WORD $0xc031             // xorl	%eax, %eax
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	WORD $0xff31             // xorl	%edi, %edi
+	JMP  BB0_16
+
+BB0_22:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	LONG $0xf84a8d4c         // leaq	-8(%rdx), %r9
+	JMP  BB0_3
+
+BB0_25:
+	WORD $0x8948; BYTE $0xd8 // movq	%rbx, %rax
+	WORD $0x8948; BYTE $0xdf // movq	%rbx, %rdi
+	WORD $0x3145; BYTE $0xdb // xorl	%r11d, %r11d
+	JMP  BB0_16
@@ -0,0 +1,150 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basecopy_c_f32_avx2_amd64.c
+
+TEXT ·copy_c_f32_avx2(SB), $0-24
+	MOVQ dst+0(FP), DI
+	MOVQ src+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b48; BYTE $0x12     // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_39
+	WORD $0x8948; BYTE $0xf1     // movq	%rsi, %rcx
+	LONG $0x07fa8348             // cmpq	$7, %rdx
+	JLE  BB0_11
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_4:
+	LONG $0x4c10fcc5; WORD $0xe081 // vmovups	-32(%rcx,%rax,4), %ymm1
+	LONG $0x4c11fcc5; WORD $0xe087 // vmovups	%ymm1, -32(%rdi,%rax,4)
+	LONG $0x08c08348               // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JLE  BB0_4
+	LONG $0xf8428d48               // leaq	-8(%rdx), %rax
+	LONG $0x03e8c148               // shrq	$3, %rax
+	QUAD $0x00000008c5048d48       // leaq	8(,%rax,8), %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_25
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	QUAD $0x0000000085348d48     // leaq	0(,%rax,4), %rsi
+	WORD $0x2949; BYTE $0xc0     // subq	%rax, %r8
+	LONG $0xff508d4d             // leaq	-1(%r8), %r10
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_5
+	QUAD $0x0000000085348d48     // leaq	0(,%rax,4), %rsi
+	LONG $0x371c8d4c             // leaq	(%rdi,%rsi), %r11
+	LONG $0x31648d4c; BYTE $0x04 // leaq	4(%rcx,%rsi), %r12
+	WORD $0x894c; BYTE $0xdb     // movq	%r11, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x18fb8348             // cmpq	$24, %rbx
+	JA   BB0_43
+
+BB0_5:
+	LONG $0x0410fac5; BYTE $0x81   // vmovss	(%rcx,%rax,4), %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	LONG $0x0411fac5; BYTE $0x87   // vmovss	%xmm0, (%rdi,%rax,4)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fac5; WORD $0x0431 // vmovss	4(%rcx,%rsi), %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0437 // vmovss	%xmm0, 4(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fac5; WORD $0x0831 // vmovss	8(%rcx,%rsi), %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0837 // vmovss	%xmm0, 8(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fac5; WORD $0x0c31 // vmovss	12(%rcx,%rsi), %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0c37 // vmovss	%xmm0, 12(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fac5; WORD $0x1031 // vmovss	16(%rcx,%rsi), %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1037 // vmovss	%xmm0, 16(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fac5; WORD $0x1431 // vmovss	20(%rcx,%rsi), %xmm0
+	LONG $0x06408d4c               // leaq	6(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1437 // vmovss	%xmm0, 20(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fac5; WORD $0x1831 // vmovss	24(%rcx,%rsi), %xmm0
+	LONG $0x07c08348               // addq	$7, %rax
+	LONG $0x4411fac5; WORD $0x1837 // vmovss	%xmm0, 24(%rdi,%rsi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_36
+	LONG $0x4410fac5; WORD $0x1c31 // vmovss	28(%rcx,%rsi), %xmm0
+	LONG $0x4411fac5; WORD $0x1c37 // vmovss	%xmm0, 28(%rdi,%rsi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_43:
+	LONG $0x06fa8349             // cmpq	$6, %r10
+	JBE  BB0_12
+	LONG $0x1c10fcc5; BYTE $0x31 // vmovups	(%rcx,%rsi), %ymm3
+	WORD $0x894c; BYTE $0xc6     // movq	%r8, %rsi
+	LONG $0xf8e68348             // andq	$-8, %rsi
+	LONG $0x117cc1c4; BYTE $0x1b // vmovups	%ymm3, (%r11)
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	LONG $0x07c0f641             // testb	$7, %r8b
+	JE   BB0_36
+	WORD $0x2949; BYTE $0xf0     // subq	%rsi, %r8
+	LONG $0xff508d4d             // leaq	-1(%r8), %r10
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x014c; BYTE $0xce     // addq	%r9, %rsi
+	LONG $0x1410f8c5; BYTE $0xb1 // vmovups	(%rcx,%rsi,4), %xmm2
+	LONG $0x1411f8c5; BYTE $0xb7 // vmovups	%xmm2, (%rdi,%rsi,4)
+	WORD $0x894c; BYTE $0xc6     // movq	%r8, %rsi
+	LONG $0xfce68348             // andq	$-4, %rsi
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	LONG $0x03e08341             // andl	$3, %r8d
+	JE   BB0_36
+
+BB0_8:
+	LONG $0x0410fac5; BYTE $0x81   // vmovss	(%rcx,%rax,4), %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x0000000085348d48       // leaq	0(,%rax,4), %rsi
+	LONG $0x0411fac5; BYTE $0x87   // vmovss	%xmm0, (%rdi,%rax,4)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fac5; WORD $0x0431 // vmovss	4(%rcx,%rsi), %xmm0
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x4411fac5; WORD $0x0437 // vmovss	%xmm0, 4(%rdi,%rsi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_36
+	LONG $0x4410fac5; WORD $0x0831 // vmovss	8(%rcx,%rsi), %xmm0
+	LONG $0x4411fac5; WORD $0x0837 // vmovss	%xmm0, 8(%rdi,%rsi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_36:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_39:
+	RET
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_6
@@ -0,0 +1,212 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basecopy_c_f32_avx512_amd64.c
+
+TEXT ·copy_c_f32_avx512(SB), $0-24
+	MOVQ dst+0(FP), DI
+	MOVQ src+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b48; BYTE $0x12     // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_51
+	WORD $0x8948; BYTE $0xf1     // movq	%rsi, %rcx
+	LONG $0x0ffa8348             // cmpq	$15, %rdx
+	JLE  BB0_11
+	LONG $0x000010b8; BYTE $0x00 // movl	$16, %eax
+
+BB0_4:
+	QUAD $0xff814c10487cf162 // vmovups	-64(%rcx,%rax,4), %zmm1
+	QUAD $0xff874c11487cf162 // vmovups	%zmm1, -64(%rdi,%rax,4)
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JLE  BB0_4
+	LONG $0xf0428d48         // leaq	-16(%rdx), %rax
+	LONG $0xf0e08348         // andq	$-16, %rax
+	LONG $0x10c08348         // addq	$16, %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_25
+	WORD $0x8949; BYTE $0xd1     // movq	%rdx, %r9
+	WORD $0x8949; BYTE $0xc0     // movq	%rax, %r8
+	QUAD $0x0000000085348d48     // leaq	0(,%rax,4), %rsi
+	WORD $0x2949; BYTE $0xc1     // subq	%rax, %r9
+	LONG $0xff518d4d             // leaq	-1(%r9), %r10
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x06fa8349             // cmpq	$6, %r10
+	JBE  BB0_5
+	QUAD $0x0000000085348d48     // leaq	0(,%rax,4), %rsi
+	LONG $0x371c8d4c             // leaq	(%rdi,%rsi), %r11
+	LONG $0x31648d4c; BYTE $0x04 // leaq	4(%rcx,%rsi), %r12
+	WORD $0x894c; BYTE $0xdb     // movq	%r11, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x38fb8348             // cmpq	$56, %rbx
+	JA   BB0_55
+
+BB0_5:
+	LONG $0x0410fac5; BYTE $0x81   // vmovss	(%rcx,%rax,4), %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	LONG $0x0411fac5; BYTE $0x87   // vmovss	%xmm0, (%rdi,%rax,4)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x0431 // vmovss	4(%rcx,%rsi), %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0437 // vmovss	%xmm0, 4(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x0831 // vmovss	8(%rcx,%rsi), %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0837 // vmovss	%xmm0, 8(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x0c31 // vmovss	12(%rcx,%rsi), %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0c37 // vmovss	%xmm0, 12(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x1031 // vmovss	16(%rcx,%rsi), %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1037 // vmovss	%xmm0, 16(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x1431 // vmovss	20(%rcx,%rsi), %xmm0
+	LONG $0x06408d4c               // leaq	6(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1437 // vmovss	%xmm0, 20(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x1831 // vmovss	24(%rcx,%rsi), %xmm0
+	LONG $0x07408d4c               // leaq	7(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1837 // vmovss	%xmm0, 24(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x1c31 // vmovss	28(%rcx,%rsi), %xmm0
+	LONG $0x08408d4c               // leaq	8(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1c37 // vmovss	%xmm0, 28(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x2031 // vmovss	32(%rcx,%rsi), %xmm0
+	LONG $0x09408d4c               // leaq	9(%rax), %r8
+	LONG $0x4411fac5; WORD $0x2037 // vmovss	%xmm0, 32(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x2431 // vmovss	36(%rcx,%rsi), %xmm0
+	LONG $0x0a408d4c               // leaq	10(%rax), %r8
+	LONG $0x4411fac5; WORD $0x2437 // vmovss	%xmm0, 36(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x2831 // vmovss	40(%rcx,%rsi), %xmm0
+	LONG $0x0b408d4c               // leaq	11(%rax), %r8
+	LONG $0x4411fac5; WORD $0x2837 // vmovss	%xmm0, 40(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x2c31 // vmovss	44(%rcx,%rsi), %xmm0
+	LONG $0x0c408d4c               // leaq	12(%rax), %r8
+	LONG $0x4411fac5; WORD $0x2c37 // vmovss	%xmm0, 44(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x3031 // vmovss	48(%rcx,%rsi), %xmm0
+	LONG $0x0d408d4c               // leaq	13(%rax), %r8
+	LONG $0x4411fac5; WORD $0x3037 // vmovss	%xmm0, 48(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x3431 // vmovss	52(%rcx,%rsi), %xmm0
+	LONG $0x0e408d4c               // leaq	14(%rax), %r8
+	LONG $0x4411fac5; WORD $0x3437 // vmovss	%xmm0, 52(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x3831 // vmovss	56(%rcx,%rsi), %xmm0
+	LONG $0x0fc08348               // addq	$15, %rax
+	LONG $0x4411fac5; WORD $0x3837 // vmovss	%xmm0, 56(%rdi,%rsi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x3c31 // vmovss	60(%rcx,%rsi), %xmm0
+	LONG $0x4411fac5; WORD $0x3c37 // vmovss	%xmm0, 60(%rdi,%rsi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	JMP  BB0_49
+
+BB0_55:
+	LONG $0x0efa8349                           // cmpq	$14, %r10
+	JBE  BB0_12
+	LONG $0x487cf162; WORD $0x1c10; BYTE $0x31 // vmovups	(%rcx,%rsi), %zmm3
+	WORD $0x894c; BYTE $0xce                   // movq	%r9, %rsi
+	LONG $0xf0e68348                           // andq	$-16, %rsi
+	LONG $0x487cd162; WORD $0x1b11             // vmovups	%zmm3, (%r11)
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x0fc1f641                           // testb	$15, %r9b
+	JE   BB0_48
+	WORD $0x2949; BYTE $0xf1                   // subq	%rsi, %r9
+	LONG $0xff518d4d                           // leaq	-1(%r9), %r10
+	LONG $0x06fa8349                           // cmpq	$6, %r10
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x014c; BYTE $0xc6     // addq	%r8, %rsi
+	LONG $0x1410fcc5; BYTE $0xb1 // vmovups	(%rcx,%rsi,4), %ymm2
+	LONG $0x1411fcc5; BYTE $0xb7 // vmovups	%ymm2, (%rdi,%rsi,4)
+	WORD $0x894c; BYTE $0xce     // movq	%r9, %rsi
+	LONG $0xf8e68348             // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	LONG $0x07e18341             // andl	$7, %r9d
+	JE   BB0_48
+
+BB0_8:
+	LONG $0x0410fac5; BYTE $0x81   // vmovss	(%rcx,%rax,4), %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x0000000085348d48       // leaq	0(,%rax,4), %rsi
+	LONG $0x0411fac5; BYTE $0x87   // vmovss	%xmm0, (%rdi,%rax,4)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x0431 // vmovss	4(%rcx,%rsi), %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0437 // vmovss	%xmm0, 4(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x0831 // vmovss	8(%rcx,%rsi), %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0837 // vmovss	%xmm0, 8(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x0c31 // vmovss	12(%rcx,%rsi), %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0c37 // vmovss	%xmm0, 12(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x1031 // vmovss	16(%rcx,%rsi), %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1037 // vmovss	%xmm0, 16(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x1431 // vmovss	20(%rcx,%rsi), %xmm0
+	LONG $0x06c08348               // addq	$6, %rax
+	LONG $0x4411fac5; WORD $0x1437 // vmovss	%xmm0, 20(%rdi,%rsi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_48
+	LONG $0x4410fac5; WORD $0x1831 // vmovss	24(%rcx,%rsi), %xmm0
+	LONG $0x4411fac5; WORD $0x1837 // vmovss	%xmm0, 24(%rdi,%rsi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_48:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_49:
+	RET
+
+BB0_51:
+	RET
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_6
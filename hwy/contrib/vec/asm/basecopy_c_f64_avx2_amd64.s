@@ -0,0 +1,98 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basecopy_c_f64_avx2_amd64.c
+
+TEXT ·copy_c_f64_avx2(SB), $0-24
+	MOVQ dst+0(FP), DI
+	MOVQ src+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b48; BYTE $0x12     // movq	(%rdx), %rdx
+	WORD $0x8948; BYTE $0xf1     // movq	%rsi, %rcx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_21
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+	LONG $0x03fa8348             // cmpq	$3, %rdx
+	JLE  BB0_23
+
+BB0_3:
+	LONG $0x4c10fdc5; WORD $0xe0c1 // vmovupd	-32(%rcx,%rax,8), %ymm1
+	LONG $0x4c11fdc5; WORD $0xe0c7 // vmovupd	%ymm1, -32(%rdi,%rax,8)
+	LONG $0x04c08348               // addq	$4, %rax
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JLE  BB0_3
+	LONG $0xfc428d48               // leaq	-4(%rdx), %rax
+	LONG $0x02e8c148               // shrq	$2, %rax
+	LONG $0x01c08348               // addq	$1, %rax
+	QUAD $0x0000000085348d48       // leaq	0(,%rax,4), %rsi
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_20
+	WORD $0x8949; BYTE $0xd2       // movq	%rdx, %r10
+	WORD $0x8949; BYTE $0xf1       // movq	%rsi, %r9
+	WORD $0x2949; BYTE $0xf2       // subq	%rsi, %r10
+	LONG $0xff428d4d               // leaq	-1(%r10), %r8
+	LONG $0x02f88349               // cmpq	$2, %r8
+	JBE  BB0_19
+	LONG $0x05e0c148               // salq	$5, %rax
+	LONG $0x07048d4c               // leaq	(%rdi,%rax), %r8
+	LONG $0x015c8d4c; BYTE $0x08   // leaq	8(%rcx,%rax), %r11
+	WORD $0x394d; BYTE $0xd8       // cmpq	%r11, %r8
+	JNE  BB0_24
+
+BB0_19:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_4:
+	LONG $0x107ba1c4; WORD $0xc904 // vmovsd	(%rcx,%r9,8), %xmm0
+	LONG $0x01468d4c               // leaq	1(%rsi), %r8
+	QUAD $0x00000000cd048d4a       // leaq	0(,%r9,8), %rax
+	LONG $0x117ba1c4; WORD $0xcf04 // vmovsd	%xmm0, (%rdi,%r9,8)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_21
+	LONG $0x4410fbc5; WORD $0x0801 // vmovsd	8(%rcx,%rax), %xmm0
+	LONG $0x02468d4c               // leaq	2(%rsi), %r8
+	LONG $0x4411fbc5; WORD $0x0807 // vmovsd	%xmm0, 8(%rdi,%rax)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_21
+	LONG $0x4410fbc5; WORD $0x1001 // vmovsd	16(%rcx,%rax), %xmm0
+	LONG $0x03c68348               // addq	$3, %rsi
+	LONG $0x4411fbc5; WORD $0x1007 // vmovsd	%xmm0, 16(%rdi,%rax)
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JLE  BB0_21
+	LONG $0x4410fbc5; WORD $0x1801 // vmovsd	24(%rcx,%rax), %xmm0
+	LONG $0x4411fbc5; WORD $0x1807 // vmovsd	%xmm0, 24(%rdi,%rax)
+	RET
+
+BB0_24:
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	LONG $0x1010f9c5               // vmovupd	(%rax), %xmm2
+	LONG $0x1179c1c4; BYTE $0x10   // vmovupd	%xmm2, (%r8)
+	LONG $0x5810f9c5; BYTE $0x10   // vmovupd	16(%rax), %xmm3
+	WORD $0x894c; BYTE $0xd0       // movq	%r10, %rax
+	LONG $0xfee08348               // andq	$-2, %rax
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0x01e28341               // andl	$1, %r10d
+	LONG $0x1179c1c4; WORD $0x1058 // vmovupd	%xmm3, 16(%r8)
+	JNE  BB0_25
+
+BB0_20:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_21:
+	RET
+
+BB0_25:
+	LONG $0x0410fbc5; BYTE $0xc1 // vmovsd	(%rcx,%rax,8), %xmm0
+	LONG $0x0411fbc5; BYTE $0xc7 // vmovsd	%xmm0, (%rdi,%rax,8)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_23:
+	WORD $0xf631             // xorl	%esi, %esi
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	WORD $0x8548; BYTE $0xd2 // testq	%rdx, %rdx
+	JG   BB0_4
+	RET
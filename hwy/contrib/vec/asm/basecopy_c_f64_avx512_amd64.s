@@ -0,0 +1,149 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basecopy_c_f64_avx512_amd64.c
+
+TEXT ·copy_c_f64_avx512(SB), $0-24
+	MOVQ dst+0(FP), DI
+	MOVQ src+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b48; BYTE $0x12     // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_39
+	LONG $0x07fa8348             // cmpq	$7, %rdx
+	JLE  BB0_11
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_4:
+	QUAD $0xffc64c1048fdf162 // vmovupd	-64(%rsi,%rax,8), %zmm1
+	QUAD $0xffc74c1148fdf162 // vmovupd	%zmm1, -64(%rdi,%rax,8)
+	LONG $0x08c08348         // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JLE  BB0_4
+	LONG $0xf8428d48         // leaq	-8(%rdx), %rax
+	LONG $0x03e8c148         // shrq	$3, %rax
+	QUAD $0x00000008c5048d48 // leaq	8(,%rax,8), %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_25
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	QUAD $0x00000000c50c8d48     // leaq	0(,%rax,8), %rcx
+	WORD $0x2949; BYTE $0xc0     // subq	%rax, %r8
+	LONG $0xff508d4d             // leaq	-1(%r8), %r10
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_5
+	QUAD $0x00000000c50c8d48     // leaq	0(,%rax,8), %rcx
+	LONG $0x0f1c8d4c             // leaq	(%rdi,%rcx), %r11
+	LONG $0x0e648d4c; BYTE $0x08 // leaq	8(%rsi,%rcx), %r12
+	WORD $0x894c; BYTE $0xdb     // movq	%r11, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x30fb8348             // cmpq	$48, %rbx
+	JA   BB0_43
+
+BB0_5:
+	LONG $0x0410fbc5; BYTE $0xc6   // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	LONG $0x0411fbc5; BYTE $0xc7   // vmovsd	%xmm0, (%rdi,%rax,8)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fbc5; WORD $0x080e // vmovsd	8(%rsi,%rcx), %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x080f // vmovsd	%xmm0, 8(%rdi,%rcx)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fbc5; WORD $0x100e // vmovsd	16(%rsi,%rcx), %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x100f // vmovsd	%xmm0, 16(%rdi,%rcx)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fbc5; WORD $0x180e // vmovsd	24(%rsi,%rcx), %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x180f // vmovsd	%xmm0, 24(%rdi,%rcx)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fbc5; WORD $0x200e // vmovsd	32(%rsi,%rcx), %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x200f // vmovsd	%xmm0, 32(%rdi,%rcx)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fbc5; WORD $0x280e // vmovsd	40(%rsi,%rcx), %xmm0
+	LONG $0x06408d4c               // leaq	6(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x280f // vmovsd	%xmm0, 40(%rdi,%rcx)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fbc5; WORD $0x300e // vmovsd	48(%rsi,%rcx), %xmm0
+	LONG $0x07c08348               // addq	$7, %rax
+	LONG $0x4411fbc5; WORD $0x300f // vmovsd	%xmm0, 48(%rdi,%rcx)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_36
+	LONG $0x4410fbc5; WORD $0x380e // vmovsd	56(%rsi,%rcx), %xmm0
+	LONG $0x4411fbc5; WORD $0x380f // vmovsd	%xmm0, 56(%rdi,%rcx)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_43:
+	LONG $0x06fa8349                           // cmpq	$6, %r10
+	JBE  BB0_12
+	LONG $0x48fdf162; WORD $0x1c10; BYTE $0x0e // vmovupd	(%rsi,%rcx), %zmm3
+	WORD $0x894c; BYTE $0xc1                   // movq	%r8, %rcx
+	LONG $0xf8e18348                           // andq	$-8, %rcx
+	LONG $0x48fdd162; WORD $0x1b11             // vmovupd	%zmm3, (%r11)
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x07c0f641                           // testb	$7, %r8b
+	JE   BB0_36
+	WORD $0x2949; BYTE $0xc8                   // subq	%rcx, %r8
+	LONG $0xff508d4d                           // leaq	-1(%r8), %r10
+	LONG $0x02fa8349                           // cmpq	$2, %r10
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x014c; BYTE $0xc9     // addq	%r9, %rcx
+	LONG $0x1410fdc5; BYTE $0xce // vmovupd	(%rsi,%rcx,8), %ymm2
+	LONG $0x1411fdc5; BYTE $0xcf // vmovupd	%ymm2, (%rdi,%rcx,8)
+	WORD $0x894c; BYTE $0xc1     // movq	%r8, %rcx
+	LONG $0xfce18348             // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xc8     // addq	%rcx, %rax
+	LONG $0x03e08341             // andl	$3, %r8d
+	JE   BB0_36
+
+BB0_8:
+	LONG $0x0410fbc5; BYTE $0xc6   // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x00000000c50c8d48       // leaq	0(,%rax,8), %rcx
+	LONG $0x0411fbc5; BYTE $0xc7   // vmovsd	%xmm0, (%rdi,%rax,8)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x4410fbc5; WORD $0x080e // vmovsd	8(%rsi,%rcx), %xmm0
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x4411fbc5; WORD $0x080f // vmovsd	%xmm0, 8(%rdi,%rcx)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_36
+	LONG $0x4410fbc5; WORD $0x100e // vmovsd	16(%rsi,%rcx), %xmm0
+	LONG $0x4411fbc5; WORD $0x100f // vmovsd	%xmm0, 16(%rdi,%rcx)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_36:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_39:
+	RET
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_6
@@ -0,0 +1,176 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basediv_c_f64_avx512_amd64.c
+
+TEXT ·div_c_f64_avx512(SB), $0-24
+	MOVQ dst+0(FP), DI
+	MOVQ s+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b4c; BYTE $0x02     // movq	(%rdx), %r8
+	WORD $0x854d; BYTE $0xc0     // testq	%r8, %r8
+	JE   BB0_39
+	WORD $0x8948; BYTE $0xf9     // movq	%rdi, %rcx
+	LONG $0x07f88349             // cmpq	$7, %r8
+	JLE  BB0_11
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_4:
+	QUAD $0xffc14c1048fdf162 // vmovupd	-64(%rcx,%rax,8), %zmm1
+	QUAD $0xffc6445e48f5f162 // vdivpd	-64(%rsi,%rax,8), %zmm1, %zmm0
+	QUAD $0xffc1441148fdf162 // vmovupd	%zmm0, -64(%rcx,%rax,8)
+	LONG $0x08c08348         // addq	$8, %rax
+	WORD $0x394c; BYTE $0xc0 // cmpq	%r8, %rax
+	JLE  BB0_4
+	LONG $0xf8408d49         // leaq	-8(%r8), %rax
+	LONG $0x03e8c148         // shrq	$3, %rax
+	QUAD $0x00000008c5048d48 // leaq	8(,%rax,8), %rax
+
+BB0_3:
+	WORD $0x3949; BYTE $0xc0     // cmpq	%rax, %r8
+	JLE  BB0_25
+	WORD $0x894d; BYTE $0xc1     // movq	%r8, %r9
+	WORD $0x8948; BYTE $0xc7     // movq	%rax, %rdi
+	QUAD $0x00000000c5148d48     // leaq	0(,%rax,8), %rdx
+	WORD $0x2949; BYTE $0xc1     // subq	%rax, %r9
+	LONG $0xff598d4d             // leaq	-1(%r9), %r11
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x02fb8349             // cmpq	$2, %r11
+	JBE  BB0_5
+	QUAD $0x00000000c5148d48     // leaq	0(,%rax,8), %rdx
+	LONG $0x11148d4c             // leaq	(%rcx,%rdx), %r10
+	LONG $0x16648d4c; BYTE $0x08 // leaq	8(%rsi,%rdx), %r12
+	WORD $0x894c; BYTE $0xd3     // movq	%r10, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x30fb8348             // cmpq	$48, %rbx
+	JA   BB0_43
+
+BB0_5:
+	LONG $0x113c8d48               // leaq	(%rcx,%rdx), %rdi
+	LONG $0x0710fbc5               // vmovsd	(%rdi), %xmm0
+	LONG $0x045efbc5; BYTE $0xc6   // vdivsd	(%rsi,%rax,8), %xmm0, %xmm0
+	LONG $0x0711fbc5               // vmovsd	%xmm0, (%rdi)
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_36
+	LONG $0x117c8d48; BYTE $0x08   // leaq	8(%rcx,%rdx), %rdi
+	LONG $0x0710fbc5               // vmovsd	(%rdi), %xmm0
+	LONG $0x445efbc5; WORD $0x0816 // vdivsd	8(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fbc5               // vmovsd	%xmm0, (%rdi)
+	LONG $0x02788d48               // leaq	2(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_36
+	LONG $0x117c8d48; BYTE $0x10   // leaq	16(%rcx,%rdx), %rdi
+	LONG $0x0710fbc5               // vmovsd	(%rdi), %xmm0
+	LONG $0x445efbc5; WORD $0x1016 // vdivsd	16(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fbc5               // vmovsd	%xmm0, (%rdi)
+	LONG $0x03788d48               // leaq	3(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_36
+	LONG $0x117c8d48; BYTE $0x18   // leaq	24(%rcx,%rdx), %rdi
+	LONG $0x0710fbc5               // vmovsd	(%rdi), %xmm0
+	LONG $0x445efbc5; WORD $0x1816 // vdivsd	24(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fbc5               // vmovsd	%xmm0, (%rdi)
+	LONG $0x04788d48               // leaq	4(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_36
+	LONG $0x117c8d48; BYTE $0x20   // leaq	32(%rcx,%rdx), %rdi
+	LONG $0x0710fbc5               // vmovsd	(%rdi), %xmm0
+	LONG $0x445efbc5; WORD $0x2016 // vdivsd	32(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fbc5               // vmovsd	%xmm0, (%rdi)
+	LONG $0x05788d48               // leaq	5(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_36
+	LONG $0x117c8d48; BYTE $0x28   // leaq	40(%rcx,%rdx), %rdi
+	LONG $0x0710fbc5               // vmovsd	(%rdi), %xmm0
+	LONG $0x445efbc5; WORD $0x2816 // vdivsd	40(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fbc5               // vmovsd	%xmm0, (%rdi)
+	LONG $0x06788d48               // leaq	6(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_36
+	LONG $0x117c8d48; BYTE $0x30   // leaq	48(%rcx,%rdx), %rdi
+	LONG $0x07c08348               // addq	$7, %rax
+	LONG $0x0710fbc5               // vmovsd	(%rdi), %xmm0
+	LONG $0x445efbc5; WORD $0x3016 // vdivsd	48(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fbc5               // vmovsd	%xmm0, (%rdi)
+	WORD $0x3949; BYTE $0xc0       // cmpq	%rax, %r8
+	JLE  BB0_36
+	LONG $0x11448d48; BYTE $0x38   // leaq	56(%rcx,%rdx), %rax
+	LONG $0x0010fbc5               // vmovsd	(%rax), %xmm0
+	LONG $0x445efbc5; WORD $0x3816 // vdivsd	56(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0011fbc5               // vmovsd	%xmm0, (%rax)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_43:
+	LONG $0x06fb8349                           // cmpq	$6, %r11
+	JBE  BB0_12
+	LONG $0x48fdd162; WORD $0x1a10             // vmovupd	(%r10), %zmm3
+	LONG $0x48e5f162; WORD $0x045e; BYTE $0x16 // vdivpd	(%rsi,%rdx), %zmm3, %zmm0
+	WORD $0x894c; BYTE $0xca                   // movq	%r9, %rdx
+	LONG $0x48fdd162; WORD $0x0211             // vmovupd	%zmm0, (%r10)
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x07c1f641                           // testb	$7, %r9b
+	JE   BB0_36
+	WORD $0x2949; BYTE $0xd1                   // subq	%rdx, %r9
+	LONG $0xff518d4d                           // leaq	-1(%r9), %r10
+	LONG $0x02fa8349                           // cmpq	$2, %r10
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x0148; BYTE $0xfa     // addq	%rdi, %rdx
+	LONG $0xd13c8d48             // leaq	(%rcx,%rdx,8), %rdi
+	LONG $0x1710fdc5             // vmovupd	(%rdi), %ymm2
+	LONG $0x045eedc5; BYTE $0xd6 // vdivpd	(%rsi,%rdx,8), %ymm2, %ymm0
+	WORD $0x894c; BYTE $0xca     // movq	%r9, %rdx
+	LONG $0x0711fdc5             // vmovupd	%ymm0, (%rdi)
+	LONG $0xfce28348             // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0     // addq	%rdx, %rax
+	LONG $0x03e18341             // andl	$3, %r9d
+	JE   BB0_36
+
+BB0_8:
+	QUAD $0x00000000c5148d48       // leaq	0(,%rax,8), %rdx
+	LONG $0x113c8d48               // leaq	(%rcx,%rdx), %rdi
+	LONG $0x0710fbc5               // vmovsd	(%rdi), %xmm0
+	LONG $0x045efbc5; BYTE $0xc6   // vdivsd	(%rsi,%rax,8), %xmm0, %xmm0
+	LONG $0x0711fbc5               // vmovsd	%xmm0, (%rdi)
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_36
+	LONG $0x117c8d48; BYTE $0x08   // leaq	8(%rcx,%rdx), %rdi
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x0710fbc5               // vmovsd	(%rdi), %xmm0
+	LONG $0x445efbc5; WORD $0x0816 // vdivsd	8(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fbc5               // vmovsd	%xmm0, (%rdi)
+	WORD $0x3949; BYTE $0xc0       // cmpq	%rax, %r8
+	JLE  BB0_36
+	LONG $0x11448d48; BYTE $0x10   // leaq	16(%rcx,%rdx), %rax
+	LONG $0x0010fbc5               // vmovsd	(%rax), %xmm0
+	LONG $0x445efbc5; WORD $0x1016 // vdivsd	16(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0011fbc5               // vmovsd	%xmm0, (%rax)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_36:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_39:
+	RET
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_6
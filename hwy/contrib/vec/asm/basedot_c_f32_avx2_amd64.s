@@ -0,0 +1,184 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basedot_c_f32_avx2_amd64.c
+
+TEXT ·dot_c_f32_avx2(SB), $0-32
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ plen_a+16(FP), DX
+	MOVQ pout_result+24(FP), CX
+	WORD $0x8949; BYTE $0xf0 // movq	%rsi, %r8
+	WORD $0x8b48; BYTE $0x32 // movq	(%rdx), %rsi
+	WORD $0x8949; BYTE $0xc9 // movq	%rcx, %r9
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x8548; BYTE $0xf6 // testq	%rsi, %rsi
+	JE   BB0_31
+	LONG $0x1ffe8348         // cmpq	$31, %rsi
+	JLE  BB0_14
+	LONG $0xe0568d4c         // leaq	-32(%rsi), %r10
+	LONG $0xdb57e0c5         // vxorps	%xmm3, %xmm3, %xmm3
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	WORD $0x894c; BYTE $0xc2 // movq	%r8, %rdx
+	LONG $0xcb28fcc5         // vmovaps	%ymm3, %ymm1
+	LONG $0x05eac149         // shrq	$5, %r10
+	LONG $0xd328fcc5         // vmovaps	%ymm3, %ymm2
+	LONG $0xc328fcc5         // vmovaps	%ymm3, %ymm0
+	WORD $0x894c; BYTE $0xd1 // movq	%r10, %rcx
+	LONG $0x07e1c148         // salq	$7, %rcx
+	QUAD $0x000000800f8c8d48 // leaq	128(%rdi,%rcx), %rcx
+
+BB0_4:
+	LONG $0x2010fcc5               // vmovups	(%rax), %ymm4
+	LONG $0x6810fcc5; BYTE $0x20   // vmovups	32(%rax), %ymm5
+	LONG $0x80e88348               // subq	$-128, %rax
+	LONG $0x80ea8348               // subq	$-128, %rdx
+	LONG $0x7010fcc5; BYTE $0xc0   // vmovups	-64(%rax), %ymm6
+	LONG $0x7810fcc5; BYTE $0xe0   // vmovups	-32(%rax), %ymm7
+	LONG $0xb85de2c4; WORD $0x8042 // vfmadd231ps	-128(%rdx), %ymm4, %ymm0
+	LONG $0xb855e2c4; WORD $0xa052 // vfmadd231ps	-96(%rdx), %ymm5, %ymm2
+	LONG $0xb84de2c4; WORD $0xc04a // vfmadd231ps	-64(%rdx), %ymm6, %ymm1
+	LONG $0xb845e2c4; WORD $0xe05a // vfmadd231ps	-32(%rdx), %ymm7, %ymm3
+	WORD $0x3948; BYTE $0xc8       // cmpq	%rcx, %rax
+	JNE  BB0_4
+	LONG $0x01428d49               // leaq	1(%r10), %rax
+	LONG $0xcb58f4c5               // vaddps	%ymm3, %ymm1, %ymm1
+	LONG $0x05e0c148               // salq	$5, %rax
+	LONG $0x08508d4c               // leaq	8(%rax), %r10
+
+BB0_3:
+	WORD $0x394c; BYTE $0xd6 // cmpq	%r10, %rsi
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xd2 // movq	%r10, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc1       // movq	%rax, %rcx
+	WORD $0x8948; BYTE $0xd0       // movq	%rdx, %rax
+	LONG $0x08528d48               // leaq	8(%rdx), %rdx
+	LONG $0x2410fcc5; BYTE $0x8f   // vmovups	(%rdi,%rcx,4), %ymm4
+	LONG $0xb85dc2c4; WORD $0x8804 // vfmadd231ps	(%r8,%rcx,4), %ymm4, %ymm0
+	WORD $0x3948; BYTE $0xd6       // cmpq	%rdx, %rsi
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xd0       // subq	%r10, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+
+BB0_5:
+	LONG $0xc258fcc5               // vaddps	%ymm2, %ymm0, %ymm0
+	LONG $0xc958fcc5               // vaddps	%ymm1, %ymm0, %ymm1
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_26
+	WORD $0x8948; BYTE $0xf1       // movq	%rsi, %rcx
+	WORD $0x2948; BYTE $0xc1       // subq	%rax, %rcx
+	LONG $0xff518d48               // leaq	-1(%rcx), %rdx
+	WORD $0x8948; BYTE $0xe5       // movq	%rsp, %rbp
+	WORD $0x8948; BYTE $0xc3       // movq	%rax, %rbx
+	LONG $0x06fa8348               // cmpq	$6, %rdx
+	JBE  BB0_15
+	WORD $0x8949; BYTE $0xcb       // movq	%rcx, %r11
+	QUAD $0x0000000085148d4c       // leaq	0(,%rax,4), %r10
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x03ebc149               // shrq	$3, %r11
+	LONG $0x17248d4e               // leaq	(%rdi,%r10), %r12
+	WORD $0x014d; BYTE $0xc2       // addq	%r8, %r10
+	LONG $0x05e3c149               // salq	$5, %r11
+
+BB0_9:
+	LONG $0x107cc1c4; WORD $0x122c // vmovups	(%r10,%rdx), %ymm5
+	LONG $0x5954c1c4; WORD $0x140c // vmulps	(%r12,%rdx), %ymm5, %ymm1
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xd1c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0xd858e2c5               // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0x197de3c4; WORD $0x01c9 // vextractf128	$0x1, %ymm1, %xmm1
+	LONG $0xc358fac5               // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc258f2c5               // vaddss	%xmm2, %xmm1, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xda       // cmpq	%r11, %rdx
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xca       // movq	%rcx, %rdx
+	LONG $0xf8e28348               // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	WORD $0xc1f6; BYTE $0x07       // testb	$7, %cl
+	JE   BB0_29
+
+BB0_8:
+	WORD $0x2948; BYTE $0xd1       // subq	%rdx, %rcx
+	LONG $0xff518d4c               // leaq	-1(%rcx), %r10
+	LONG $0x02fa8349               // cmpq	$2, %r10
+	JBE  BB0_11
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x1078c1c4; WORD $0x9034 // vmovups	(%r8,%rdx,4), %xmm6
+	LONG $0x0c59c8c5; BYTE $0x97   // vmulps	(%rdi,%rdx,4), %xmm6, %xmm1
+	WORD $0x8948; BYTE $0xca       // movq	%rcx, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	WORD $0xe183; BYTE $0x03       // andl	$3, %ecx
+	LONG $0xc058f2c5               // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_29
+
+BB0_11:
+	LONG $0x01488d48                           // leaq	1(%rax), %rcx
+	LONG $0x3c10fac5; BYTE $0x87               // vmovss	(%rdi,%rax,4), %xmm7
+	QUAD $0x0000000085148d48                   // leaq	0(,%rax,4), %rdx
+	LONG $0xb941c2c4; WORD $0x8004             // vfmadd231ss	(%r8,%rax,4), %xmm7, %xmm0
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_29
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0x107ac1c4; WORD $0x107c; BYTE $0x04 // vmovss	4(%r8,%rdx), %xmm7
+	LONG $0xb941e2c4; WORD $0x1744; BYTE $0x04 // vfmadd231ss	4(%rdi,%rdx), %xmm7, %xmm0
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_29
+	LONG $0x107ac1c4; WORD $0x107c; BYTE $0x08 // vmovss	8(%r8,%rdx), %xmm7
+	LONG $0xb941e2c4; WORD $0x1744; BYTE $0x08 // vfmadd231ss	8(%rdi,%rdx), %xmm7, %xmm0
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x117ac1c4; BYTE $0x01               // vmovss	%xmm0, (%r9)
+	RET
+
+BB0_29:
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117ac1c4; BYTE $0x01 // vmovss	%xmm0, (%r9)
+	RET
+
+BB0_26:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_31:
+	LONG $0x117ac1c4; BYTE $0x01 // vmovss	%xmm0, (%r9)
+	RET
+
+BB0_14:
+	LONG $0xc957f0c5               // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x0008ba41; WORD $0x0000 // movl	$8, %r10d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0xd128fcc5               // vmovaps	%ymm1, %ymm2
+	LONG $0xc128fcc5               // vmovaps	%ymm1, %ymm0
+	JMP  BB0_3
+
+BB0_15:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_8
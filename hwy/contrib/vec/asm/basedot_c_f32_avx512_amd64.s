@@ -0,0 +1,231 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basedot_c_f32_avx512_amd64.c
+
+TEXT ·dot_c_f32_avx512(SB), $0-32
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ plen_a+16(FP), DX
+	MOVQ pout_result+24(FP), CX
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	WORD $0x8b48; BYTE $0x32       // movq	(%rdx), %rsi
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	LONG $0xc057f8c5               // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x8548; BYTE $0xf6       // testq	%rsi, %rsi
+	JE   BB0_35
+	LONG $0x3ffe8348               // cmpq	$63, %rsi
+	JLE  BB0_14
+	LONG $0xc0568d4c               // leaq	-64(%rsi), %r10
+	LONG $0xdb57e0c5               // vxorps	%xmm3, %xmm3, %xmm3
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	WORD $0x894c; BYTE $0xc2       // movq	%r8, %rdx
+	LONG $0x06eac149               // shrq	$6, %r10
+	LONG $0x487cf162; WORD $0xcb28 // vmovaps	%zmm3, %zmm1
+	LONG $0x487cf162; WORD $0xd328 // vmovaps	%zmm3, %zmm2
+	WORD $0x894c; BYTE $0xd1       // movq	%r10, %rcx
+	LONG $0x487cf162; WORD $0xc328 // vmovaps	%zmm3, %zmm0
+	LONG $0x08e1c148               // salq	$8, %rcx
+	QUAD $0x000001000f8c8d48       // leaq	256(%rdi,%rcx), %rcx
+
+BB0_4:
+	LONG $0x487cf162; WORD $0x2810             // vmovups	(%rax), %zmm5
+	LONG $0x487cf162; WORD $0x7010; BYTE $0x01 // vmovups	64(%rax), %zmm6
+	LONG $0x01000548; WORD $0x0000             // addq	$256, %rax
+	LONG $0x00c28148; WORD $0x0001; BYTE $0x00 // addq	$256, %rdx
+	LONG $0x4855f262; WORD $0x42b8; BYTE $0xfc // vfmadd231ps	-256(%rdx), %zmm5, %zmm0
+	LONG $0x487cf162; WORD $0x7810; BYTE $0xfe // vmovups	-128(%rax), %zmm7
+	LONG $0x487cf162; WORD $0x6810; BYTE $0xff // vmovups	-64(%rax), %zmm5
+	LONG $0x4845f262; WORD $0x4ab8; BYTE $0xfe // vfmadd231ps	-128(%rdx), %zmm7, %zmm1
+	LONG $0x484df262; WORD $0x52b8; BYTE $0xfd // vfmadd231ps	-192(%rdx), %zmm6, %zmm2
+	LONG $0x4855f262; WORD $0x5ab8; BYTE $0xff // vfmadd231ps	-64(%rdx), %zmm5, %zmm3
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JNE  BB0_4
+	LONG $0x01428d49                           // leaq	1(%r10), %rax
+	LONG $0x4874f162; WORD $0xcb58             // vaddps	%zmm3, %zmm1, %zmm1
+	LONG $0x06e0c148                           // salq	$6, %rax
+	LONG $0x10508d4c                           // leaq	16(%rax), %r10
+
+BB0_3:
+	WORD $0x394c; BYTE $0xd6 // cmpq	%r10, %rsi
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xd2 // movq	%r10, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x10528d48                           // leaq	16(%rdx), %rdx
+	LONG $0x487cf162; WORD $0x3410; BYTE $0x8f // vmovups	(%rdi,%rcx,4), %zmm6
+	LONG $0x484dd262; WORD $0x04b8; BYTE $0x88 // vfmadd231ps	(%r8,%rcx,4), %zmm6, %zmm0
+	WORD $0x3948; BYTE $0xd6                   // cmpq	%rdx, %rsi
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xd0                   // subq	%r10, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+
+BB0_5:
+	LONG $0x487cf162; WORD $0xc258             // vaddps	%zmm2, %zmm0, %zmm0
+	LONG $0x487cf162; WORD $0xc158             // vaddps	%zmm1, %zmm0, %zmm0
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f4c5                           // vaddps	%ymm0, %ymm1, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc128f8c5                           // vmovaps	%xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_26
+	WORD $0x8948; BYTE $0xf1                   // movq	%rsi, %rcx
+	WORD $0x2948; BYTE $0xc1                   // subq	%rax, %rcx
+	LONG $0xff518d48                           // leaq	-1(%rcx), %rdx
+	WORD $0x8948; BYTE $0xe5                   // movq	%rsp, %rbp
+	WORD $0x8948; BYTE $0xc3                   // movq	%rax, %rbx
+	LONG $0x0efa8348                           // cmpq	$14, %rdx
+	JBE  BB0_15
+	WORD $0x8949; BYTE $0xcb                   // movq	%rcx, %r11
+	QUAD $0x0000000085148d4c                   // leaq	0(,%rax,4), %r10
+	WORD $0xd231                               // xorl	%edx, %edx
+	LONG $0x04ebc149                           // shrq	$4, %r11
+	LONG $0x17248d4e                           // leaq	(%rdi,%r10), %r12
+	WORD $0x014d; BYTE $0xc2                   // addq	%r8, %r10
+	LONG $0x06e3c149                           // salq	$6, %r11
+
+BB0_9:
+	LONG $0x487cd162; WORD $0x3c10; BYTE $0x12 // vmovups	(%r10,%rdx), %zmm7
+	LONG $0x4844d162; WORD $0x0c59; BYTE $0x14 // vmulps	(%r12,%rdx), %zmm7, %zmm1
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0xe1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm4
+	LONG $0xd9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm3
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm2
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xe058dac5                           // vaddss	%xmm0, %xmm4, %xmm4
+	LONG $0xc115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xc819; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm3
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0x2875f362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm0
+	LONG $0x487df362; WORD $0xc91b; BYTE $0x01 // vextractf32x8	$0x1, %zmm1, %ymm1
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm0
+	LONG $0xd258f2c5                           // vaddss	%xmm2, %xmm1, %xmm2
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xd115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm2
+	LONG $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG $0xc058eac5                           // vaddss	%xmm0, %xmm2, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x2875f362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm0
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd3                   // cmpq	%rdx, %r11
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	LONG $0xf0e28348                           // andq	$-16, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0xc1f6; BYTE $0x0f                   // testb	$15, %cl
+	JE   BB0_33
+
+BB0_8:
+	WORD $0x2948; BYTE $0xd1                   // subq	%rdx, %rcx
+	LONG $0xff518d4c                           // leaq	-1(%rcx), %r10
+	LONG $0x06fa8349                           // cmpq	$6, %r10
+	JBE  BB0_11
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x3c10fcc5; BYTE $0x97               // vmovups	(%rdi,%rdx,4), %ymm7
+	LONG $0x5944c1c4; WORD $0x900c             // vmulps	(%r8,%rdx,4), %ymm7, %ymm1
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0xe183; BYTE $0x07                   // andl	$7, %ecx
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xd1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm2
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_33
+
+BB0_11:
+	LONG $0x01488d48                           // leaq	1(%rax), %rcx
+	LONG $0x2410fac5; BYTE $0x87               // vmovss	(%rdi,%rax,4), %xmm4
+	QUAD $0x0000000085148d48                   // leaq	0(,%rax,4), %rdx
+	LONG $0xb959c2c4; WORD $0x8004             // vfmadd231ss	(%r8,%rax,4), %xmm4, %xmm0
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_33
+	LONG $0x02488d48                           // leaq	2(%rax), %rcx
+	LONG $0x107ac1c4; WORD $0x107c; BYTE $0x04 // vmovss	4(%r8,%rdx), %xmm7
+	LONG $0xb941e2c4; WORD $0x1744; BYTE $0x04 // vfmadd231ss	4(%rdi,%rdx), %xmm7, %xmm0
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JGE  BB0_33
+	LONG $0x03488d48                           // leaq	3(%rax), %rcx
+	LONG $0x7c10fac5; WORD $0x0817             // vmovss	8(%rdi,%rdx), %xmm7
+	LONG $0xb941c2c4; WORD $0x1044; BYTE $0x08 // vfmadd231ss	8(%r8,%rdx), %xmm7, %xmm0
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_33
+	LONG $0x04488d48                           // leaq	4(%rax), %rcx
+	LONG $0x6410fac5; WORD $0x0c17             // vmovss	12(%rdi,%rdx), %xmm4
+	LONG $0xb959c2c4; WORD $0x1044; BYTE $0x0c // vfmadd231ss	12(%r8,%rdx), %xmm4, %xmm0
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_33
+	LONG $0x05488d48                           // leaq	5(%rax), %rcx
+	LONG $0x7c10fac5; WORD $0x1017             // vmovss	16(%rdi,%rdx), %xmm7
+	LONG $0xb941c2c4; WORD $0x1044; BYTE $0x10 // vfmadd231ss	16(%r8,%rdx), %xmm7, %xmm0
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_33
+	LONG $0x06c08348                           // addq	$6, %rax
+	LONG $0x6410fac5; WORD $0x1417             // vmovss	20(%rdi,%rdx), %xmm4
+	LONG $0xb959c2c4; WORD $0x1044; BYTE $0x14 // vfmadd231ss	20(%r8,%rdx), %xmm4, %xmm0
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_33
+	LONG $0x107ac1c4; WORD $0x1064; BYTE $0x18 // vmovss	24(%r8,%rdx), %xmm4
+	LONG $0xb959e2c4; WORD $0x1744; BYTE $0x18 // vfmadd231ss	24(%rdi,%rdx), %xmm4, %xmm0
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x117ac1c4; BYTE $0x01               // vmovss	%xmm0, (%r9)
+	RET
+
+BB0_33:
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117ac1c4; BYTE $0x01 // vmovss	%xmm0, (%r9)
+	RET
+
+BB0_26:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_35:
+	LONG $0x117ac1c4; BYTE $0x01 // vmovss	%xmm0, (%r9)
+	RET
+
+BB0_14:
+	LONG $0xc957f0c5               // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x0010ba41; WORD $0x0000 // movl	$16, %r10d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x487cf162; WORD $0xd128 // vmovaps	%zmm1, %zmm2
+	LONG $0x487cf162; WORD $0xc128 // vmovaps	%zmm1, %zmm0
+	JMP  BB0_3
+
+BB0_15:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_8
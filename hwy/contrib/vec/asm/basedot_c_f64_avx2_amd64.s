@@ -0,0 +1,156 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basedot_c_f64_avx2_amd64.c
+
+TEXT ·dot_c_f64_avx2(SB), $0-32
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ plen_a+16(FP), DX
+	MOVQ pout_result+24(FP), CX
+	WORD $0x8949; BYTE $0xc9 // movq	%rcx, %r9
+	WORD $0x8b48; BYTE $0x0a // movq	(%rdx), %rcx
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x8548; BYTE $0xc9 // testq	%rcx, %rcx
+	JE   BB0_33
+	WORD $0x8949; BYTE $0xf0 // movq	%rsi, %r8
+	LONG $0x0ff98348         // cmpq	$15, %rcx
+	JLE  BB0_14
+	LONG $0xf0518d4c         // leaq	-16(%rcx), %r10
+	WORD $0x8948; BYTE $0xf2 // movq	%rsi, %rdx
+	LONG $0xdb57e1c5         // vxorpd	%xmm3, %xmm3, %xmm3
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	LONG $0xcb28fdc5         // vmovapd	%ymm3, %ymm1
+	LONG $0x04eac149         // shrq	$4, %r10
+	LONG $0xd328fdc5         // vmovapd	%ymm3, %ymm2
+	LONG $0xc328fdc5         // vmovapd	%ymm3, %ymm0
+	WORD $0x894c; BYTE $0xd6 // movq	%r10, %rsi
+	LONG $0x07e6c148         // salq	$7, %rsi
+	QUAD $0x0000008037b48d48 // leaq	128(%rdi,%rsi), %rsi
+
+BB0_4:
+	LONG $0x2010fdc5               // vmovupd	(%rax), %ymm4
+	LONG $0x6810fdc5; BYTE $0x20   // vmovupd	32(%rax), %ymm5
+	LONG $0x80e88348               // subq	$-128, %rax
+	LONG $0x80ea8348               // subq	$-128, %rdx
+	LONG $0x7010fdc5; BYTE $0xc0   // vmovupd	-64(%rax), %ymm6
+	LONG $0x7810fdc5; BYTE $0xe0   // vmovupd	-32(%rax), %ymm7
+	LONG $0xb8dde2c4; WORD $0x8042 // vfmadd231pd	-128(%rdx), %ymm4, %ymm0
+	LONG $0xb8d5e2c4; WORD $0xa052 // vfmadd231pd	-96(%rdx), %ymm5, %ymm2
+	LONG $0xb8cde2c4; WORD $0xc04a // vfmadd231pd	-64(%rdx), %ymm6, %ymm1
+	LONG $0xb8c5e2c4; WORD $0xe05a // vfmadd231pd	-32(%rdx), %ymm7, %ymm3
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JNE  BB0_4
+	LONG $0x01428d49               // leaq	1(%r10), %rax
+	LONG $0xcb58f5c5               // vaddpd	%ymm3, %ymm1, %ymm1
+	LONG $0x04e0c148               // salq	$4, %rax
+	LONG $0x04508d4c               // leaq	4(%rax), %r10
+
+BB0_3:
+	WORD $0x394c; BYTE $0xd1 // cmpq	%r10, %rcx
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xd2 // movq	%r10, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc6       // movq	%rax, %rsi
+	WORD $0x8948; BYTE $0xd0       // movq	%rdx, %rax
+	LONG $0x04528d48               // leaq	4(%rdx), %rdx
+	LONG $0x2410fdc5; BYTE $0xf7   // vmovupd	(%rdi,%rsi,8), %ymm4
+	LONG $0xb8ddc2c4; WORD $0xf004 // vfmadd231pd	(%r8,%rsi,8), %ymm4, %ymm0
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xc8       // movq	%rcx, %rax
+	WORD $0x294c; BYTE $0xd0       // subq	%r10, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+
+BB0_5:
+	LONG $0xc258fdc5               // vaddpd	%ymm2, %ymm0, %ymm0
+	LONG $0xc958fdc5               // vaddpd	%ymm1, %ymm0, %ymm1
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_29
+	WORD $0x2948; BYTE $0xc1       // subq	%rax, %rcx
+	WORD $0x8949; BYTE $0xc3       // movq	%rax, %r11
+	LONG $0xff518d48               // leaq	-1(%rcx), %rdx
+	WORD $0x8948; BYTE $0xe5       // movq	%rsp, %rbp
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_15
+	WORD $0x8949; BYTE $0xca       // movq	%rcx, %r10
+	QUAD $0x00000000c5348d48       // leaq	0(,%rax,8), %rsi
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x02eac149               // shrq	$2, %r10
+	LONG $0x371c8d48               // leaq	(%rdi,%rsi), %rbx
+	WORD $0x014c; BYTE $0xc6       // addq	%r8, %rsi
+	LONG $0x05e2c149               // salq	$5, %r10
+
+BB0_9:
+	LONG $0x2c10fdc5; BYTE $0x16   // vmovupd	(%rsi,%rdx), %ymm5
+	LONG $0x0c59d5c5; BYTE $0x13   // vmulpd	(%rbx,%rdx), %ymm5, %ymm1
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xd115f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0x197de3c4; WORD $0x01c9 // vextractf128	$0x1, %ymm1, %xmm1
+	LONG $0xd058ebc5               // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0xc258f3c5               // vaddsd	%xmm2, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xd2       // cmpq	%r10, %rdx
+	JNE  BB0_9
+	WORD $0xc1f6; BYTE $0x03       // testb	$3, %cl
+	JE   BB0_31
+	WORD $0x8948; BYTE $0xca       // movq	%rcx, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+
+BB0_8:
+	WORD $0x2948; BYTE $0xd1       // subq	%rdx, %rcx
+	LONG $0x01f98348               // cmpq	$1, %rcx
+	JE   BB0_11
+	WORD $0x014c; BYTE $0xda       // addq	%r11, %rdx
+	LONG $0x1079c1c4; WORD $0xd03c // vmovupd	(%r8,%rdx,8), %xmm7
+	LONG $0x0c59c1c5; BYTE $0xd7   // vmulpd	(%rdi,%rdx,8), %xmm7, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	WORD $0xc1f6; BYTE $0x01       // testb	$1, %cl
+	JE   BB0_31
+	LONG $0xfee18348               // andq	$-2, %rcx
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+
+BB0_11:
+	LONG $0x107bc1c4; WORD $0xc034 // vmovsd	(%r8,%rax,8), %xmm6
+	LONG $0xb9c9e2c4; WORD $0xc704 // vfmadd231sd	(%rdi,%rax,8), %xmm6, %xmm0
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	LONG $0x117bc1c4; BYTE $0x01   // vmovsd	%xmm0, (%r9)
+	RET
+
+BB0_31:
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117bc1c4; BYTE $0x01 // vmovsd	%xmm0, (%r9)
+	RET
+
+BB0_29:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_33:
+	LONG $0x117bc1c4; BYTE $0x01 // vmovsd	%xmm0, (%r9)
+	RET
+
+BB0_14:
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x0004ba41; WORD $0x0000 // movl	$4, %r10d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0xd128fdc5               // vmovapd	%ymm1, %ymm2
+	LONG $0xc128fdc5               // vmovapd	%ymm1, %ymm0
+	JMP  BB0_3
+
+BB0_15:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_8
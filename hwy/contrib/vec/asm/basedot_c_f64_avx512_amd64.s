@@ -0,0 +1,185 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basedot_c_f64_avx512_amd64.c
+
+TEXT ·dot_c_f64_avx512(SB), $0-32
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ plen_a+16(FP), DX
+	MOVQ pout_result+24(FP), CX
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	WORD $0x8b48; BYTE $0x32       // movq	(%rdx), %rsi
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0x8548; BYTE $0xf6       // testq	%rsi, %rsi
+	JE   BB0_31
+	LONG $0x1ffe8348               // cmpq	$31, %rsi
+	JLE  BB0_14
+	LONG $0xe0568d4c               // leaq	-32(%rsi), %r10
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	WORD $0x894c; BYTE $0xc2       // movq	%r8, %rdx
+	LONG $0x05eac149               // shrq	$5, %r10
+	LONG $0x48fdf162; WORD $0xcb28 // vmovapd	%zmm3, %zmm1
+	LONG $0x48fdf162; WORD $0xd328 // vmovapd	%zmm3, %zmm2
+	WORD $0x894c; BYTE $0xd1       // movq	%r10, %rcx
+	LONG $0x48fdf162; WORD $0xc328 // vmovapd	%zmm3, %zmm0
+	LONG $0x08e1c148               // salq	$8, %rcx
+	QUAD $0x000001000f8c8d48       // leaq	256(%rdi,%rcx), %rcx
+
+BB0_4:
+	LONG $0x48fdf162; WORD $0x2810             // vmovupd	(%rax), %zmm5
+	LONG $0x01000548; WORD $0x0000             // addq	$256, %rax
+	LONG $0x48fdf162; WORD $0x7010; BYTE $0xfd // vmovupd	-192(%rax), %zmm6
+	LONG $0x00c28148; WORD $0x0001; BYTE $0x00 // addq	$256, %rdx
+	LONG $0x48fdf162; WORD $0x7810; BYTE $0xfe // vmovupd	-128(%rax), %zmm7
+	LONG $0x48fdf162; WORD $0x6010; BYTE $0xff // vmovupd	-64(%rax), %zmm4
+	LONG $0x48c5f262; WORD $0x4ab8; BYTE $0xfe // vfmadd231pd	-128(%rdx), %zmm7, %zmm1
+	LONG $0x48ddf262; WORD $0x5ab8; BYTE $0xff // vfmadd231pd	-64(%rdx), %zmm4, %zmm3
+	LONG $0x48d5f262; WORD $0x42b8; BYTE $0xfc // vfmadd231pd	-256(%rdx), %zmm5, %zmm0
+	LONG $0x48cdf262; WORD $0x52b8; BYTE $0xfd // vfmadd231pd	-192(%rdx), %zmm6, %zmm2
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JNE  BB0_4
+	LONG $0x01428d49                           // leaq	1(%r10), %rax
+	LONG $0x48f5f162; WORD $0xcb58             // vaddpd	%zmm3, %zmm1, %zmm1
+	LONG $0x05e0c148                           // salq	$5, %rax
+	LONG $0x08508d4c                           // leaq	8(%rax), %r10
+
+BB0_3:
+	WORD $0x394c; BYTE $0xd6 // cmpq	%r10, %rsi
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xd2 // movq	%r10, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x08528d48                           // leaq	8(%rdx), %rdx
+	LONG $0x48fdf162; WORD $0x2c10; BYTE $0xcf // vmovupd	(%rdi,%rcx,8), %zmm5
+	LONG $0x48d5d262; WORD $0x04b8; BYTE $0xc8 // vfmadd231pd	(%r8,%rcx,8), %zmm5, %zmm0
+	WORD $0x3948; BYTE $0xd6                   // cmpq	%rdx, %rsi
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xd0                   // subq	%r10, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+
+BB0_5:
+	LONG $0x48fdf162; WORD $0xc258             // vaddpd	%zmm2, %zmm0, %zmm0
+	LONG $0x48fdf162; WORD $0xc158             // vaddpd	%zmm1, %zmm0, %zmm0
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc858f5c5                           // vaddpd	%ymm0, %ymm1, %ymm1
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5                           // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc810fbc5                           // vmovsd	%xmm0, %xmm0, %xmm1
+	LONG $0xc015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_26
+	WORD $0x8948; BYTE $0xf1                   // movq	%rsi, %rcx
+	WORD $0x2948; BYTE $0xc1                   // subq	%rax, %rcx
+	LONG $0xff518d48                           // leaq	-1(%rcx), %rdx
+	WORD $0x8948; BYTE $0xe5                   // movq	%rsp, %rbp
+	WORD $0x8948; BYTE $0xc3                   // movq	%rax, %rbx
+	LONG $0x06fa8348                           // cmpq	$6, %rdx
+	JBE  BB0_15
+	WORD $0x8949; BYTE $0xcb                   // movq	%rcx, %r11
+	QUAD $0x00000000c5148d4c                   // leaq	0(,%rax,8), %r10
+	WORD $0xd231                               // xorl	%edx, %edx
+	LONG $0x03ebc149                           // shrq	$3, %r11
+	LONG $0x17248d4e                           // leaq	(%rdi,%r10), %r12
+	WORD $0x014d; BYTE $0xc2                   // addq	%r8, %r10
+	LONG $0x06e3c149                           // salq	$6, %r11
+
+BB0_9:
+	LONG $0x48fdd162; WORD $0x3410; BYTE $0x12 // vmovupd	(%r10,%rdx), %zmm6
+	LONG $0x48cdd162; WORD $0x0459; BYTE $0x14 // vmulpd	(%r12,%rdx), %zmm6, %zmm0
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x28fdf362; WORD $0xd003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm2
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	LONG $0xd815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm3
+	LONG $0xd958e3c5                           // vaddsd	%xmm1, %xmm3, %xmm3
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm1
+	LONG $0x48fdf362; WORD $0xc01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm0
+	LONG $0xcb58f3c5                           // vaddsd	%xmm3, %xmm1, %xmm1
+	LONG $0xd158ebc5                           // vaddsd	%xmm1, %xmm2, %xmm2
+	LONG $0xc815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xd258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm2
+	LONG $0xd258f3c5                           // vaddsd	%xmm2, %xmm1, %xmm2
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm1
+	LONG $0x28fdf362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm0
+	LONG $0xca58f3c5                           // vaddsd	%xmm2, %xmm1, %xmm1
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	WORD $0x394c; BYTE $0xda                   // cmpq	%r11, %rdx
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0xc1f6; BYTE $0x07                   // testb	$7, %cl
+	JE   BB0_29
+
+BB0_8:
+	WORD $0x2948; BYTE $0xd1                   // subq	%rdx, %rcx
+	LONG $0xff518d4c                           // leaq	-1(%rcx), %r10
+	LONG $0x02fa8349                           // cmpq	$2, %r10
+	JBE  BB0_11
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x107dc1c4; WORD $0xd03c             // vmovupd	(%r8,%rdx,8), %ymm7
+	LONG $0x1459c5c5; BYTE $0xd7               // vmulpd	(%rdi,%rdx,8), %ymm7, %ymm2
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	LONG $0xfce28348                           // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0xe183; BYTE $0x03                   // andl	$3, %ecx
+	LONG $0xc958ebc5                           // vaddsd	%xmm1, %xmm2, %xmm1
+	LONG $0xc215e9c5                           // vunpckhpd	%xmm2, %xmm2, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0x28fdf362; WORD $0xd119; BYTE $0x01 // vextractf64x2	$1, %ymm2, %xmm1
+	LONG $0x28edf362; WORD $0xd203; BYTE $0x03 // valignq	$3, %ymm2, %ymm2, %ymm2
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xca58fbc5                           // vaddsd	%xmm2, %xmm0, %xmm1
+	JE   BB0_29
+
+BB0_11:
+	LONG $0x01488d48                           // leaq	1(%rax), %rcx
+	LONG $0x3c10fbc5; BYTE $0xc7               // vmovsd	(%rdi,%rax,8), %xmm7
+	QUAD $0x00000000c5148d48                   // leaq	0(,%rax,8), %rdx
+	LONG $0xb9c1c2c4; WORD $0xc00c             // vfmadd231sd	(%r8,%rax,8), %xmm7, %xmm1
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_29
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0x107bc1c4; WORD $0x107c; BYTE $0x08 // vmovsd	8(%r8,%rdx), %xmm7
+	LONG $0xb9c1e2c4; WORD $0x174c; BYTE $0x08 // vfmadd231sd	8(%rdi,%rdx), %xmm7, %xmm1
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JGE  BB0_29
+	LONG $0x107bc1c4; WORD $0x107c; BYTE $0x10 // vmovsd	16(%r8,%rdx), %xmm7
+	LONG $0xb9c1e2c4; WORD $0x174c; BYTE $0x10 // vfmadd231sd	16(%rdi,%rdx), %xmm7, %xmm1
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x117bc1c4; BYTE $0x09               // vmovsd	%xmm1, (%r9)
+	RET
+
+BB0_29:
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117bc1c4; BYTE $0x09 // vmovsd	%xmm1, (%r9)
+	RET
+
+BB0_26:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_31:
+	LONG $0x117bc1c4; BYTE $0x09 // vmovsd	%xmm1, (%r9)
+	RET
+
+BB0_14:
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x0008ba41; WORD $0x0000 // movl	$8, %r10d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x48fdf162; WORD $0xd128 // vmovapd	%zmm1, %zmm2
+	LONG $0x48fdf162; WORD $0xc128 // vmovapd	%zmm1, %zmm0
+	JMP  BB0_3
+
+BB0_15:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_8
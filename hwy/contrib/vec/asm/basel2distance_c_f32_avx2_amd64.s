@@ -0,0 +1,193 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basel2distance_c_f32_avx2_amd64.c
+
+TEXT ·l2distance_c_f32_avx2(SB), $0-32
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ plen_a+16(FP), DX
+	MOVQ pout_result+24(FP), CX
+	WORD $0x8949; BYTE $0xf0 // movq	%rsi, %r8
+	WORD $0x8b48; BYTE $0x32 // movq	(%rdx), %rsi
+	WORD $0x8949; BYTE $0xc9 // movq	%rcx, %r9
+	LONG $0xc957f0c5         // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0x8548; BYTE $0xf6 // testq	%rsi, %rsi
+	JE   BB0_27
+	LONG $0x1ffe8348         // cmpq	$31, %rsi
+	JLE  BB0_14
+	LONG $0xe0568d4c         // leaq	-32(%rsi), %r10
+	LONG $0xff57c0c5         // vxorps	%xmm7, %xmm7, %xmm7
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	WORD $0x894c; BYTE $0xc2 // movq	%r8, %rdx
+	LONG $0xf728fcc5         // vmovaps	%ymm7, %ymm6
+	LONG $0x05eac149         // shrq	$5, %r10
+	LONG $0xef28fcc5         // vmovaps	%ymm7, %ymm5
+	LONG $0xe728fcc5         // vmovaps	%ymm7, %ymm4
+	WORD $0x894c; BYTE $0xd1 // movq	%r10, %rcx
+	LONG $0x07e1c148         // salq	$7, %rcx
+	QUAD $0x000000800f8c8d48 // leaq	128(%rdi,%rcx), %rcx
+
+BB0_4:
+	LONG $0x4010fcc5; BYTE $0x40 // vmovups	64(%rax), %ymm0
+	LONG $0x1810fcc5             // vmovups	(%rax), %ymm3
+	LONG $0x80e88348             // subq	$-128, %rax
+	LONG $0x80ea8348             // subq	$-128, %rdx
+	LONG $0x4a5cfcc5; BYTE $0xc0 // vsubps	-64(%rdx), %ymm0, %ymm1
+	LONG $0x5a5ce4c5; BYTE $0x80 // vsubps	-128(%rdx), %ymm3, %ymm3
+	LONG $0x5010fcc5; BYTE $0xa0 // vmovups	-96(%rax), %ymm2
+	LONG $0x4010fcc5; BYTE $0xe0 // vmovups	-32(%rax), %ymm0
+	LONG $0x525cecc5; BYTE $0xa0 // vsubps	-96(%rdx), %ymm2, %ymm2
+	LONG $0x425cfcc5; BYTE $0xe0 // vsubps	-32(%rdx), %ymm0, %ymm0
+	LONG $0xb865e2c4; BYTE $0xe3 // vfmadd231ps	%ymm3, %ymm3, %ymm4
+	LONG $0xb875e2c4; BYTE $0xf1 // vfmadd231ps	%ymm1, %ymm1, %ymm6
+	LONG $0xb86de2c4; BYTE $0xea // vfmadd231ps	%ymm2, %ymm2, %ymm5
+	LONG $0xb87de2c4; BYTE $0xf8 // vfmadd231ps	%ymm0, %ymm0, %ymm7
+	WORD $0x3948; BYTE $0xc8     // cmpq	%rcx, %rax
+	JNE  BB0_4
+	LONG $0x01428d49             // leaq	1(%r10), %rax
+	LONG $0xf758ccc5             // vaddps	%ymm7, %ymm6, %ymm6
+	LONG $0x05e0c148             // salq	$5, %rax
+	LONG $0x08508d4c             // leaq	8(%rax), %r10
+
+BB0_3:
+	WORD $0x394c; BYTE $0xd6 // cmpq	%r10, %rsi
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xd2 // movq	%r10, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc1       // movq	%rax, %rcx
+	WORD $0x8948; BYTE $0xd0       // movq	%rdx, %rax
+	LONG $0x08528d48               // leaq	8(%rdx), %rdx
+	LONG $0x3c10fcc5; BYTE $0x8f   // vmovups	(%rdi,%rcx,4), %ymm7
+	LONG $0x5c44c1c4; WORD $0x8804 // vsubps	(%r8,%rcx,4), %ymm7, %ymm0
+	LONG $0xb87de2c4; BYTE $0xe0   // vfmadd231ps	%ymm0, %ymm0, %ymm4
+	WORD $0x3948; BYTE $0xd6       // cmpq	%rdx, %rsi
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xd0       // subq	%r10, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+
+BB0_5:
+	LONG $0xec58d4c5               // vaddps	%ymm4, %ymm5, %ymm5
+	LONG $0xee58d4c5               // vaddps	%ymm6, %ymm5, %ymm5
+	LONG $0x197de3c4; WORD $0x01e9 // vextractf128	$0x1, %ymm5, %xmm1
+	LONG $0xcd58f0c5               // vaddps	%xmm5, %xmm1, %xmm1
+	LONG $0xc112f0c5               // vmovhlps	%xmm1, %xmm1, %xmm0
+	LONG $0xc858f0c5               // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc116fac5               // vmovshdup	%xmm1, %xmm0
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_30
+	WORD $0x8948; BYTE $0xf1       // movq	%rsi, %rcx
+	WORD $0x2948; BYTE $0xc1       // subq	%rax, %rcx
+	LONG $0xff518d48               // leaq	-1(%rcx), %rdx
+	WORD $0x8948; BYTE $0xe5       // movq	%rsp, %rbp
+	WORD $0x8948; BYTE $0xc3       // movq	%rax, %rbx
+	LONG $0x06fa8348               // cmpq	$6, %rdx
+	JBE  BB0_15
+	WORD $0x8949; BYTE $0xcb       // movq	%rcx, %r11
+	QUAD $0x0000000085148d4c       // leaq	0(,%rax,4), %r10
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x03ebc149               // shrq	$3, %r11
+	LONG $0x17248d4e               // leaq	(%rdi,%r10), %r12
+	WORD $0x014d; BYTE $0xc2       // addq	%r8, %r10
+	LONG $0x05e3c149               // salq	$5, %r11
+
+BB0_9:
+	LONG $0x107cc1c4; WORD $0x1434 // vmovups	(%r12,%rdx), %ymm6
+	LONG $0x5c4cc1c4; WORD $0x1204 // vsubps	(%r10,%rdx), %ymm6, %ymm0
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xc059fcc5               // vmulps	%ymm0, %ymm0, %ymm0
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xd8c6f8c5; BYTE $0x55   // vshufps	$85, %xmm0, %xmm0, %xmm3
+	LONG $0xd0c6f8c5; BYTE $0xff   // vshufps	$255, %xmm0, %xmm0, %xmm2
+	LONG $0xd958e2c5               // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0xc815f8c5               // vunpckhps	%xmm0, %xmm0, %xmm1
+	LONG $0x197de3c4; WORD $0x01c0 // vextractf128	$0x1, %ymm0, %xmm0
+	LONG $0xcb58f2c5               // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xd158eac5               // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xca58fac5               // vaddss	%xmm2, %xmm0, %xmm1
+	LONG $0xd0c6f8c5; BYTE $0x55   // vshufps	$85, %xmm0, %xmm0, %xmm2
+	LONG $0xd158eac5               // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xc815f8c5               // vunpckhps	%xmm0, %xmm0, %xmm1
+	LONG $0xc0c6f8c5; BYTE $0xff   // vshufps	$255, %xmm0, %xmm0, %xmm0
+	LONG $0xca58f2c5               // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	WORD $0x394c; BYTE $0xda       // cmpq	%r11, %rdx
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xca       // movq	%rcx, %rdx
+	LONG $0xf8e28348               // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	WORD $0xc1f6; BYTE $0x07       // testb	$7, %cl
+	JE   BB0_10
+
+BB0_8:
+	WORD $0x2948; BYTE $0xd1       // subq	%rdx, %rcx
+	LONG $0xff518d4c               // leaq	-1(%rcx), %r10
+	LONG $0x02fa8349               // cmpq	$2, %r10
+	JBE  BB0_11
+	WORD $0x0148; BYTE $0xda       // addq	%rbx, %rdx
+	LONG $0x2c10f8c5; BYTE $0x97   // vmovups	(%rdi,%rdx,4), %xmm5
+	LONG $0x5c50c1c4; WORD $0x9004 // vsubps	(%r8,%rdx,4), %xmm5, %xmm0
+	WORD $0x8948; BYTE $0xca       // movq	%rcx, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	WORD $0xe183; BYTE $0x03       // andl	$3, %ecx
+	LONG $0xc059f8c5               // vmulps	%xmm0, %xmm0, %xmm0
+	LONG $0xc958fac5               // vaddss	%xmm1, %xmm0, %xmm1
+	LONG $0xd0c6f8c5; BYTE $0x55   // vshufps	$85, %xmm0, %xmm0, %xmm2
+	LONG $0xd158eac5               // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xc815f8c5               // vunpckhps	%xmm0, %xmm0, %xmm1
+	LONG $0xc0c6f8c5; BYTE $0xff   // vshufps	$255, %xmm0, %xmm0, %xmm0
+	LONG $0xca58f2c5               // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xc858f2c5               // vaddss	%xmm0, %xmm1, %xmm1
+	JE   BB0_10
+
+BB0_11:
+	LONG $0x0410fac5; BYTE $0x87               // vmovss	(%rdi,%rax,4), %xmm0
+	LONG $0x5c7ac1c4; WORD $0x8004             // vsubss	(%r8,%rax,4), %xmm0, %xmm0
+	LONG $0x01488d48                           // leaq	1(%rax), %rcx
+	QUAD $0x0000000085148d48                   // leaq	0(,%rax,4), %rdx
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_10
+	LONG $0x4410fac5; WORD $0x0417             // vmovss	4(%rdi,%rdx), %xmm0
+	LONG $0x5c7ac1c4; WORD $0x1044; BYTE $0x04 // vsubss	4(%r8,%rdx), %xmm0, %xmm0
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_10
+	LONG $0x4410fac5; WORD $0x0817             // vmovss	8(%rdi,%rdx), %xmm0
+	LONG $0x5c7ac1c4; WORD $0x1044; BYTE $0x08 // vsubss	8(%r8,%rdx), %xmm0, %xmm0
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+
+BB0_10:
+	LONG $0xc951f2c5             // vsqrtss	%xmm1, %xmm1, %xmm1
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117ac1c4; BYTE $0x09 // vmovss	%xmm1, (%r9)
+	RET
+
+BB0_30:
+	LONG $0xc951f2c5         // vsqrtss	%xmm1, %xmm1, %xmm1
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_27:
+	LONG $0x117ac1c4; BYTE $0x09 // vmovss	%xmm1, (%r9)
+	RET
+
+BB0_14:
+	LONG $0xf657c8c5               // vxorps	%xmm6, %xmm6, %xmm6
+	LONG $0x0008ba41; WORD $0x0000 // movl	$8, %r10d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0xee28fcc5               // vmovaps	%ymm6, %ymm5
+	LONG $0xe628fcc5               // vmovaps	%ymm6, %ymm4
+	JMP  BB0_3
+
+BB0_15:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_8
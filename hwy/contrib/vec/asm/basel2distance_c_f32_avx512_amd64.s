@@ -0,0 +1,244 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basel2distance_c_f32_avx512_amd64.c
+
+TEXT ·l2distance_c_f32_avx512(SB), $0-32
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ plen_a+16(FP), DX
+	MOVQ pout_result+24(FP), CX
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	WORD $0x8b48; BYTE $0x32       // movq	(%rdx), %rsi
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	LONG $0xc957f0c5               // vxorps	%xmm1, %xmm1, %xmm1
+	WORD $0x8548; BYTE $0xf6       // testq	%rsi, %rsi
+	JE   BB0_27
+	LONG $0x3ffe8348               // cmpq	$63, %rsi
+	JLE  BB0_14
+	LONG $0xc0568d4c               // leaq	-64(%rsi), %r10
+	LONG $0xff57c0c5               // vxorps	%xmm7, %xmm7, %xmm7
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	WORD $0x894c; BYTE $0xc2       // movq	%r8, %rdx
+	LONG $0x06eac149               // shrq	$6, %r10
+	LONG $0x487cf162; WORD $0xf728 // vmovaps	%zmm7, %zmm6
+	LONG $0x487cf162; WORD $0xef28 // vmovaps	%zmm7, %zmm5
+	WORD $0x894c; BYTE $0xd1       // movq	%r10, %rcx
+	LONG $0x487cf162; WORD $0xe728 // vmovaps	%zmm7, %zmm4
+	LONG $0x08e1c148               // salq	$8, %rcx
+	QUAD $0x000001000f8c8d48       // leaq	256(%rdi,%rcx), %rcx
+
+BB0_4:
+	LONG $0x487cf162; WORD $0x4010; BYTE $0x01 // vmovups	64(%rax), %zmm0
+	LONG $0x487cf162; WORD $0x1810             // vmovups	(%rax), %zmm3
+	LONG $0x01000548; WORD $0x0000             // addq	$256, %rax
+	LONG $0x00c28148; WORD $0x0001; BYTE $0x00 // addq	$256, %rdx
+	LONG $0x487cf162; WORD $0x525c; BYTE $0xfd // vsubps	-192(%rdx), %zmm0, %zmm2
+	LONG $0x4864f162; WORD $0x5a5c; BYTE $0xfc // vsubps	-256(%rdx), %zmm3, %zmm3
+	LONG $0x487cf162; WORD $0x4010; BYTE $0xfe // vmovups	-128(%rax), %zmm0
+	LONG $0x487cf162; WORD $0x4a5c; BYTE $0xfe // vsubps	-128(%rdx), %zmm0, %zmm1
+	LONG $0x487cf162; WORD $0x4010; BYTE $0xff // vmovups	-64(%rax), %zmm0
+	LONG $0x487cf162; WORD $0x425c; BYTE $0xff // vsubps	-64(%rdx), %zmm0, %zmm0
+	LONG $0x4865f262; WORD $0xe3b8             // vfmadd231ps	%zmm3, %zmm3, %zmm4
+	LONG $0x486df262; WORD $0xeab8             // vfmadd231ps	%zmm2, %zmm2, %zmm5
+	LONG $0x4875f262; WORD $0xf1b8             // vfmadd231ps	%zmm1, %zmm1, %zmm6
+	LONG $0x487df262; WORD $0xf8b8             // vfmadd231ps	%zmm0, %zmm0, %zmm7
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JNE  BB0_4
+	LONG $0x01428d49                           // leaq	1(%r10), %rax
+	LONG $0x484cf162; WORD $0xf758             // vaddps	%zmm7, %zmm6, %zmm6
+	LONG $0x06e0c148                           // salq	$6, %rax
+	LONG $0x10508d4c                           // leaq	16(%rax), %r10
+
+BB0_3:
+	WORD $0x394c; BYTE $0xd6 // cmpq	%r10, %rsi
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xd2 // movq	%r10, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x10528d48                           // leaq	16(%rdx), %rdx
+	LONG $0x487cf162; WORD $0x3c10; BYTE $0x8f // vmovups	(%rdi,%rcx,4), %zmm7
+	LONG $0x4844d162; WORD $0x045c; BYTE $0x88 // vsubps	(%r8,%rcx,4), %zmm7, %zmm0
+	LONG $0x487df262; WORD $0xe0b8             // vfmadd231ps	%zmm0, %zmm0, %zmm4
+	WORD $0x3948; BYTE $0xd6                   // cmpq	%rdx, %rsi
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xd0                   // subq	%r10, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+
+BB0_5:
+	LONG $0x4854f162; WORD $0xec58             // vaddps	%zmm4, %zmm5, %zmm5
+	LONG $0x4854f162; WORD $0xee58             // vaddps	%zmm6, %zmm5, %zmm5
+	LONG $0x48fdf362; WORD $0xe81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm5, %ymm0
+	LONG $0xc558fcc5                           // vaddps	%ymm5, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0x0479e3c4; WORD $0x4ec1             // vpermilps	$78, %xmm1, %xmm0
+	LONG $0xc158f8c5                           // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc828f8c5                           // vmovaps	%xmm0, %xmm1
+	LONG $0xc0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm0
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_30
+	WORD $0x8948; BYTE $0xf1                   // movq	%rsi, %rcx
+	WORD $0x2948; BYTE $0xc1                   // subq	%rax, %rcx
+	LONG $0xff518d48                           // leaq	-1(%rcx), %rdx
+	WORD $0x8948; BYTE $0xe5                   // movq	%rsp, %rbp
+	WORD $0x8948; BYTE $0xc3                   // movq	%rax, %rbx
+	LONG $0x0efa8348                           // cmpq	$14, %rdx
+	JBE  BB0_15
+	WORD $0x8949; BYTE $0xcb                   // movq	%rcx, %r11
+	QUAD $0x0000000085148d4c                   // leaq	0(,%rax,4), %r10
+	WORD $0xd231                               // xorl	%edx, %edx
+	LONG $0x04ebc149                           // shrq	$4, %r11
+	LONG $0x17248d4e                           // leaq	(%rdi,%r10), %r12
+	WORD $0x014d; BYTE $0xc2                   // addq	%r8, %r10
+	LONG $0x06e3c149                           // salq	$6, %r11
+
+BB0_9:
+	LONG $0x487cd162; WORD $0x3410; BYTE $0x14 // vmovups	(%r12,%rdx), %zmm6
+	LONG $0x484cd162; WORD $0x045c; BYTE $0x12 // vsubps	(%r10,%rdx), %zmm6, %zmm0
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x487cf162; WORD $0xc059             // vmulps	%zmm0, %zmm0, %zmm0
+	LONG $0xe0c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm4
+	LONG $0xd8c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm3
+	LONG $0x287df362; WORD $0xd003; BYTE $0x07 // valignd	$7, %ymm0, %ymm0, %ymm2
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	LONG $0xe158dac5                           // vaddss	%xmm1, %xmm4, %xmm4
+	LONG $0xc815f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm1
+	LONG $0xcc58f2c5                           // vaddss	%xmm4, %xmm1, %xmm1
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xc119; BYTE $0x01 // vextractf32x4	$1, %ymm0, %xmm1
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xd803; BYTE $0x05 // valignd	$5, %ymm0, %ymm0, %ymm3
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xc803; BYTE $0x06 // valignd	$6, %ymm0, %ymm0, %ymm1
+	LONG $0x487df362; WORD $0xc01b; BYTE $0x01 // vextractf32x8	$0x1, %zmm0, %ymm0
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xd8c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm3
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0xc8c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm1
+	LONG $0xd258fac5                           // vaddss	%xmm2, %xmm0, %xmm2
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xd015f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm2
+	LONG $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0x287df362; WORD $0xc219; BYTE $0x01 // vextractf32x4	$1, %ymm0, %xmm2
+	LONG $0xc958eac5                           // vaddss	%xmm1, %xmm2, %xmm1
+	LONG $0x287df362; WORD $0xd003; BYTE $0x05 // valignd	$5, %ymm0, %ymm0, %ymm2
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xc803; BYTE $0x06 // valignd	$6, %ymm0, %ymm0, %ymm1
+	LONG $0x287df362; WORD $0xc003; BYTE $0x07 // valignd	$7, %ymm0, %ymm0, %ymm0
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	WORD $0x394c; BYTE $0xda                   // cmpq	%r11, %rdx
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	LONG $0xf0e28348                           // andq	$-16, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0xc1f6; BYTE $0x0f                   // testb	$15, %cl
+	JE   BB0_10
+
+BB0_8:
+	WORD $0x2948; BYTE $0xd1                   // subq	%rdx, %rcx
+	LONG $0xff518d4c                           // leaq	-1(%rcx), %r10
+	LONG $0x06fa8349                           // cmpq	$6, %r10
+	JBE  BB0_11
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x2c10fcc5; BYTE $0x97               // vmovups	(%rdi,%rdx,4), %ymm5
+	LONG $0x5c54c1c4; WORD $0x9004             // vsubps	(%r8,%rdx,4), %ymm5, %ymm0
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0xe183; BYTE $0x07                   // andl	$7, %ecx
+	LONG $0xc059fcc5                           // vmulps	%ymm0, %ymm0, %ymm0
+	LONG $0xc958fac5                           // vaddss	%xmm1, %xmm0, %xmm1
+	LONG $0xd8c6f8c5; BYTE $0x55               // vshufps	$85, %xmm0, %xmm0, %xmm3
+	LONG $0xd0c6f8c5; BYTE $0xff               // vshufps	$255, %xmm0, %xmm0, %xmm2
+	LONG $0xd958e2c5                           // vaddss	%xmm1, %xmm3, %xmm3
+	LONG $0xc815f8c5                           // vunpckhps	%xmm0, %xmm0, %xmm1
+	LONG $0xcb58f2c5                           // vaddss	%xmm3, %xmm1, %xmm1
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xc119; BYTE $0x01 // vextractf32x4	$1, %ymm0, %xmm1
+	LONG $0xd258f2c5                           // vaddss	%xmm2, %xmm1, %xmm2
+	LONG $0x287df362; WORD $0xc803; BYTE $0x05 // valignd	$5, %ymm0, %ymm0, %ymm1
+	LONG $0xd158eac5                           // vaddss	%xmm1, %xmm2, %xmm2
+	LONG $0x287df362; WORD $0xc803; BYTE $0x06 // valignd	$6, %ymm0, %ymm0, %ymm1
+	LONG $0x287df362; WORD $0xc003; BYTE $0x07 // valignd	$7, %ymm0, %ymm0, %ymm0
+	LONG $0xca58f2c5                           // vaddss	%xmm2, %xmm1, %xmm1
+	LONG $0xc858f2c5                           // vaddss	%xmm0, %xmm1, %xmm1
+	JE   BB0_10
+
+BB0_11:
+	LONG $0x0410fac5; BYTE $0x87               // vmovss	(%rdi,%rax,4), %xmm0
+	LONG $0x5c7ac1c4; WORD $0x8004             // vsubss	(%r8,%rax,4), %xmm0, %xmm0
+	LONG $0x01488d48                           // leaq	1(%rax), %rcx
+	QUAD $0x0000000085148d48                   // leaq	0(,%rax,4), %rdx
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_10
+	LONG $0x4410fac5; WORD $0x0417             // vmovss	4(%rdi,%rdx), %xmm0
+	LONG $0x5c7ac1c4; WORD $0x1044; BYTE $0x04 // vsubss	4(%r8,%rdx), %xmm0, %xmm0
+	LONG $0x02488d48                           // leaq	2(%rax), %rcx
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_10
+	LONG $0x4410fac5; WORD $0x0817             // vmovss	8(%rdi,%rdx), %xmm0
+	LONG $0x5c7ac1c4; WORD $0x1044; BYTE $0x08 // vsubss	8(%r8,%rdx), %xmm0, %xmm0
+	LONG $0x03488d48                           // leaq	3(%rax), %rcx
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_10
+	LONG $0x4410fac5; WORD $0x0c17             // vmovss	12(%rdi,%rdx), %xmm0
+	LONG $0x5c7ac1c4; WORD $0x1044; BYTE $0x0c // vsubss	12(%r8,%rdx), %xmm0, %xmm0
+	LONG $0x04488d48                           // leaq	4(%rax), %rcx
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_10
+	LONG $0x4410fac5; WORD $0x1017             // vmovss	16(%rdi,%rdx), %xmm0
+	LONG $0x5c7ac1c4; WORD $0x1044; BYTE $0x10 // vsubss	16(%r8,%rdx), %xmm0, %xmm0
+	LONG $0x05488d48                           // leaq	5(%rax), %rcx
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_10
+	LONG $0x4410fac5; WORD $0x1417             // vmovss	20(%rdi,%rdx), %xmm0
+	LONG $0x5c7ac1c4; WORD $0x1044; BYTE $0x14 // vsubss	20(%r8,%rdx), %xmm0, %xmm0
+	LONG $0x06c08348                           // addq	$6, %rax
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_10
+	LONG $0x4410fac5; WORD $0x1817             // vmovss	24(%rdi,%rdx), %xmm0
+	LONG $0x5c7ac1c4; WORD $0x1044; BYTE $0x18 // vsubss	24(%r8,%rdx), %xmm0, %xmm0
+	LONG $0xb979e2c4; BYTE $0xc8               // vfmadd231ss	%xmm0, %xmm0, %xmm1
+
+BB0_10:
+	LONG $0xc951f2c5             // vsqrtss	%xmm1, %xmm1, %xmm1
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117ac1c4; BYTE $0x09 // vmovss	%xmm1, (%r9)
+	RET
+
+BB0_30:
+	LONG $0xc951f2c5         // vsqrtss	%xmm1, %xmm1, %xmm1
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_27:
+	LONG $0x117ac1c4; BYTE $0x09 // vmovss	%xmm1, (%r9)
+	RET
+
+BB0_14:
+	LONG $0xf657c8c5               // vxorps	%xmm6, %xmm6, %xmm6
+	LONG $0x0010ba41; WORD $0x0000 // movl	$16, %r10d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x487cf162; WORD $0xee28 // vmovaps	%zmm6, %zmm5
+	LONG $0x487cf162; WORD $0xe628 // vmovaps	%zmm6, %zmm4
+	JMP  BB0_3
+
+BB0_15:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_8
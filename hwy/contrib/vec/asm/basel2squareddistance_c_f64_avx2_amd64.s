@@ -0,0 +1,164 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basel2squareddistance_c_f64_avx2_amd64.c
+
+TEXT ·l2squareddistance_c_f64_avx2(SB), $0-32
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ plen_a+16(FP), DX
+	MOVQ pout_result+24(FP), CX
+	WORD $0x8949; BYTE $0xc9 // movq	%rcx, %r9
+	WORD $0x8b48; BYTE $0x0a // movq	(%rdx), %rcx
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x8548; BYTE $0xc9 // testq	%rcx, %rcx
+	JE   BB0_33
+	WORD $0x8949; BYTE $0xf0 // movq	%rsi, %r8
+	LONG $0x0ff98348         // cmpq	$15, %rcx
+	JLE  BB0_14
+	LONG $0xf0518d4c         // leaq	-16(%rcx), %r10
+	WORD $0x8948; BYTE $0xf2 // movq	%rsi, %rdx
+	LONG $0xff57c1c5         // vxorpd	%xmm7, %xmm7, %xmm7
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	LONG $0xef28fdc5         // vmovapd	%ymm7, %ymm5
+	LONG $0x04eac149         // shrq	$4, %r10
+	LONG $0xf728fdc5         // vmovapd	%ymm7, %ymm6
+	LONG $0xc728fdc5         // vmovapd	%ymm7, %ymm0
+	WORD $0x894c; BYTE $0xd6 // movq	%r10, %rsi
+	LONG $0x07e6c148         // salq	$7, %rsi
+	QUAD $0x0000008037b48d48 // leaq	128(%rdi,%rsi), %rsi
+
+BB0_4:
+	LONG $0x2010fdc5             // vmovupd	(%rax), %ymm4
+	LONG $0x5810fdc5; BYTE $0x20 // vmovupd	32(%rax), %ymm3
+	LONG $0x80e88348             // subq	$-128, %rax
+	LONG $0x80ea8348             // subq	$-128, %rdx
+	LONG $0x625cddc5; BYTE $0x80 // vsubpd	-128(%rdx), %ymm4, %ymm4
+	LONG $0x5a5ce5c5; BYTE $0xa0 // vsubpd	-96(%rdx), %ymm3, %ymm3
+	LONG $0x5010fdc5; BYTE $0xc0 // vmovupd	-64(%rax), %ymm2
+	LONG $0x4810fdc5; BYTE $0xe0 // vmovupd	-32(%rax), %ymm1
+	LONG $0x525cedc5; BYTE $0xc0 // vsubpd	-64(%rdx), %ymm2, %ymm2
+	LONG $0x4a5cf5c5; BYTE $0xe0 // vsubpd	-32(%rdx), %ymm1, %ymm1
+	LONG $0xb8dde2c4; BYTE $0xc4 // vfmadd231pd	%ymm4, %ymm4, %ymm0
+	LONG $0xb8e5e2c4; BYTE $0xf3 // vfmadd231pd	%ymm3, %ymm3, %ymm6
+	LONG $0xb8ede2c4; BYTE $0xea // vfmadd231pd	%ymm2, %ymm2, %ymm5
+	LONG $0xb8f5e2c4; BYTE $0xf9 // vfmadd231pd	%ymm1, %ymm1, %ymm7
+	WORD $0x3948; BYTE $0xc6     // cmpq	%rax, %rsi
+	JNE  BB0_4
+	LONG $0x01428d49             // leaq	1(%r10), %rax
+	LONG $0xef58d5c5             // vaddpd	%ymm7, %ymm5, %ymm5
+	LONG $0x04e0c148             // salq	$4, %rax
+	LONG $0x04508d4c             // leaq	4(%rax), %r10
+
+BB0_3:
+	WORD $0x394c; BYTE $0xd1 // cmpq	%r10, %rcx
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xd2 // movq	%r10, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc6       // movq	%rax, %rsi
+	WORD $0x8948; BYTE $0xd0       // movq	%rdx, %rax
+	LONG $0x04528d48               // leaq	4(%rdx), %rdx
+	LONG $0x3c10fdc5; BYTE $0xf7   // vmovupd	(%rdi,%rsi,8), %ymm7
+	LONG $0x5c45c1c4; WORD $0xf00c // vsubpd	(%r8,%rsi,8), %ymm7, %ymm1
+	LONG $0xb8f5e2c4; BYTE $0xc1   // vfmadd231pd	%ymm1, %ymm1, %ymm0
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xc8       // movq	%rcx, %rax
+	WORD $0x294c; BYTE $0xd0       // subq	%r10, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x014c; BYTE $0xd0       // addq	%r10, %rax
+
+BB0_5:
+	LONG $0xc658fdc5               // vaddpd	%ymm6, %ymm0, %ymm0
+	LONG $0xcd58fdc5               // vaddpd	%ymm5, %ymm0, %ymm1
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_29
+	WORD $0x2948; BYTE $0xc1       // subq	%rax, %rcx
+	WORD $0x8949; BYTE $0xc3       // movq	%rax, %r11
+	LONG $0xff518d48               // leaq	-1(%rcx), %rdx
+	WORD $0x8948; BYTE $0xe5       // movq	%rsp, %rbp
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_15
+	WORD $0x8949; BYTE $0xca       // movq	%rcx, %r10
+	QUAD $0x00000000c5348d48       // leaq	0(,%rax,8), %rsi
+	WORD $0xd231                   // xorl	%edx, %edx
+	LONG $0x02eac149               // shrq	$2, %r10
+	LONG $0x371c8d48               // leaq	(%rdi,%rsi), %rbx
+	WORD $0x014c; BYTE $0xc6       // addq	%r8, %rsi
+	LONG $0x05e2c149               // salq	$5, %r10
+
+BB0_9:
+	LONG $0x3410fdc5; BYTE $0x13   // vmovupd	(%rbx,%rdx), %ymm6
+	LONG $0x0c5ccdc5; BYTE $0x16   // vsubpd	(%rsi,%rdx), %ymm6, %ymm1
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xc959f5c5               // vmulpd	%ymm1, %ymm1, %ymm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xd115f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0x197de3c4; WORD $0x01c9 // vextractf128	$0x1, %ymm1, %xmm1
+	LONG $0xd058ebc5               // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0xc258f3c5               // vaddsd	%xmm2, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xd2       // cmpq	%r10, %rdx
+	JNE  BB0_9
+	WORD $0xc1f6; BYTE $0x03       // testb	$3, %cl
+	JE   BB0_31
+	WORD $0x8948; BYTE $0xca       // movq	%rcx, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+
+BB0_8:
+	WORD $0x2948; BYTE $0xd1       // subq	%rdx, %rcx
+	LONG $0x01f98348               // cmpq	$1, %rcx
+	JE   BB0_11
+	WORD $0x014c; BYTE $0xda       // addq	%r11, %rdx
+	LONG $0x2c10f9c5; BYTE $0xd7   // vmovupd	(%rdi,%rdx,8), %xmm5
+	LONG $0x5c51c1c4; WORD $0xd00c // vsubpd	(%r8,%rdx,8), %xmm5, %xmm1
+	LONG $0xc959f1c5               // vmulpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc058f3c5               // vaddsd	%xmm0, %xmm1, %xmm0
+	WORD $0xc1f6; BYTE $0x01       // testb	$1, %cl
+	JE   BB0_31
+	LONG $0xfee18348               // andq	$-2, %rcx
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+
+BB0_11:
+	LONG $0x0c10fbc5; BYTE $0xc7   // vmovsd	(%rdi,%rax,8), %xmm1
+	LONG $0x5c73c1c4; WORD $0xc00c // vsubsd	(%r8,%rax,8), %xmm1, %xmm1
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	LONG $0x117bc1c4; BYTE $0x01   // vmovsd	%xmm0, (%r9)
+	RET
+
+BB0_31:
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117bc1c4; BYTE $0x01 // vmovsd	%xmm0, (%r9)
+	RET
+
+BB0_29:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_33:
+	LONG $0x117bc1c4; BYTE $0x01 // vmovsd	%xmm0, (%r9)
+	RET
+
+BB0_14:
+	LONG $0xed57d1c5               // vxorpd	%xmm5, %xmm5, %xmm5
+	LONG $0x0004ba41; WORD $0x0000 // movl	$4, %r10d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0xf528fdc5               // vmovapd	%ymm5, %ymm6
+	LONG $0xc528fdc5               // vmovapd	%ymm5, %ymm0
+	JMP  BB0_3
+
+BB0_15:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_8
@@ -0,0 +1,195 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basel2squareddistance_c_f64_avx512_amd64.c
+
+TEXT ·l2squareddistance_c_f64_avx512(SB), $0-32
+	MOVQ a+0(FP), DI
+	MOVQ b+8(FP), SI
+	MOVQ plen_a+16(FP), DX
+	MOVQ pout_result+24(FP), CX
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	WORD $0x8b48; BYTE $0x32       // movq	(%rdx), %rsi
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0x8548; BYTE $0xf6       // testq	%rsi, %rsi
+	JE   BB0_31
+	LONG $0x1ffe8348               // cmpq	$31, %rsi
+	JLE  BB0_14
+	LONG $0xe0568d4c               // leaq	-32(%rsi), %r10
+	LONG $0xff57c1c5               // vxorpd	%xmm7, %xmm7, %xmm7
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	WORD $0x894c; BYTE $0xc2       // movq	%r8, %rdx
+	LONG $0x05eac149               // shrq	$5, %r10
+	LONG $0x48fdf162; WORD $0xef28 // vmovapd	%zmm7, %zmm5
+	LONG $0x48fdf162; WORD $0xf728 // vmovapd	%zmm7, %zmm6
+	WORD $0x894c; BYTE $0xd1       // movq	%r10, %rcx
+	LONG $0x48fdf162; WORD $0xc728 // vmovapd	%zmm7, %zmm0
+	LONG $0x08e1c148               // salq	$8, %rcx
+	QUAD $0x000001000f8c8d48       // leaq	256(%rdi,%rcx), %rcx
+
+BB0_4:
+	LONG $0x48fdf162; WORD $0x2010             // vmovupd	(%rax), %zmm4
+	LONG $0x48ddf162; WORD $0x225c             // vsubpd	(%rdx), %zmm4, %zmm4
+	LONG $0x01000548; WORD $0x0000             // addq	$256, %rax
+	LONG $0x00c28148; WORD $0x0001; BYTE $0x00 // addq	$256, %rdx
+	LONG $0x48fdf162; WORD $0x5010; BYTE $0xfe // vmovupd	-128(%rax), %zmm2
+	LONG $0x48fdf162; WORD $0x4810; BYTE $0xff // vmovupd	-64(%rax), %zmm1
+	LONG $0x48edf162; WORD $0x525c; BYTE $0xfe // vsubpd	-128(%rdx), %zmm2, %zmm2
+	LONG $0x48f5f162; WORD $0x4a5c; BYTE $0xff // vsubpd	-64(%rdx), %zmm1, %zmm1
+	LONG $0x48fdf162; WORD $0x5810; BYTE $0xfd // vmovupd	-192(%rax), %zmm3
+	LONG $0x48ddf262; WORD $0xc4b8             // vfmadd231pd	%zmm4, %zmm4, %zmm0
+	LONG $0x48e5f162; WORD $0x5a5c; BYTE $0xfd // vsubpd	-192(%rdx), %zmm3, %zmm3
+	LONG $0x48edf262; WORD $0xeab8             // vfmadd231pd	%zmm2, %zmm2, %zmm5
+	LONG $0x48f5f262; WORD $0xf9b8             // vfmadd231pd	%zmm1, %zmm1, %zmm7
+	LONG $0x48e5f262; WORD $0xf3b8             // vfmadd231pd	%zmm3, %zmm3, %zmm6
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JNE  BB0_4
+	LONG $0x01428d49                           // leaq	1(%r10), %rax
+	LONG $0x48d5f162; WORD $0xef58             // vaddpd	%zmm7, %zmm5, %zmm5
+	LONG $0x05e0c148                           // salq	$5, %rax
+	LONG $0x08508d4c                           // leaq	8(%rax), %r10
+
+BB0_3:
+	WORD $0x394c; BYTE $0xd6 // cmpq	%r10, %rsi
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xd2 // movq	%r10, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x08528d48                           // leaq	8(%rdx), %rdx
+	LONG $0x48fdf162; WORD $0x3c10; BYTE $0xcf // vmovupd	(%rdi,%rcx,8), %zmm7
+	LONG $0x48c5d162; WORD $0x0c5c; BYTE $0xc8 // vsubpd	(%r8,%rcx,8), %zmm7, %zmm1
+	LONG $0x48f5f262; WORD $0xc1b8             // vfmadd231pd	%zmm1, %zmm1, %zmm0
+	WORD $0x3948; BYTE $0xd6                   // cmpq	%rdx, %rsi
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xd0                   // subq	%r10, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x014c; BYTE $0xd0                   // addq	%r10, %rax
+
+BB0_5:
+	LONG $0x48fdf162; WORD $0xc658             // vaddpd	%zmm6, %zmm0, %zmm0
+	LONG $0x48fdf162; WORD $0xc558             // vaddpd	%zmm5, %zmm0, %zmm0
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc858f5c5                           // vaddpd	%ymm0, %ymm1, %ymm1
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5                           // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc810fbc5                           // vmovsd	%xmm0, %xmm0, %xmm1
+	LONG $0xc015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_26
+	WORD $0x8948; BYTE $0xf1                   // movq	%rsi, %rcx
+	WORD $0x2948; BYTE $0xc1                   // subq	%rax, %rcx
+	LONG $0xff518d48                           // leaq	-1(%rcx), %rdx
+	WORD $0x8948; BYTE $0xe5                   // movq	%rsp, %rbp
+	WORD $0x8948; BYTE $0xc3                   // movq	%rax, %rbx
+	LONG $0x06fa8348                           // cmpq	$6, %rdx
+	JBE  BB0_15
+	WORD $0x8949; BYTE $0xcb                   // movq	%rcx, %r11
+	QUAD $0x00000000c5148d4c                   // leaq	0(,%rax,8), %r10
+	WORD $0xd231                               // xorl	%edx, %edx
+	LONG $0x03ebc149                           // shrq	$3, %r11
+	LONG $0x17248d4e                           // leaq	(%rdi,%r10), %r12
+	WORD $0x014d; BYTE $0xc2                   // addq	%r8, %r10
+	LONG $0x06e3c149                           // salq	$6, %r11
+
+BB0_9:
+	LONG $0x48fdd162; WORD $0x3410; BYTE $0x14 // vmovupd	(%r12,%rdx), %zmm6
+	LONG $0x48cdd162; WORD $0x045c; BYTE $0x12 // vsubpd	(%r10,%rdx), %zmm6, %zmm0
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x48fdf162; WORD $0xc059             // vmulpd	%zmm0, %zmm0, %zmm0
+	LONG $0x28fdf362; WORD $0xd003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm2
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	LONG $0xd815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm3
+	LONG $0xd958e3c5                           // vaddsd	%xmm1, %xmm3, %xmm3
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm1
+	LONG $0x48fdf362; WORD $0xc01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm0
+	LONG $0xcb58f3c5                           // vaddsd	%xmm3, %xmm1, %xmm1
+	LONG $0xd158ebc5                           // vaddsd	%xmm1, %xmm2, %xmm2
+	LONG $0xc815f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xd258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm2
+	LONG $0xd258f3c5                           // vaddsd	%xmm2, %xmm1, %xmm2
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm1
+	LONG $0x28fdf362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm0
+	LONG $0xca58f3c5                           // vaddsd	%xmm2, %xmm1, %xmm1
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	WORD $0x394c; BYTE $0xda                   // cmpq	%r11, %rdx
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0xc1f6; BYTE $0x07                   // testb	$7, %cl
+	JE   BB0_29
+
+BB0_8:
+	WORD $0x2948; BYTE $0xd1                   // subq	%rdx, %rcx
+	LONG $0xff518d4c                           // leaq	-1(%rcx), %r10
+	LONG $0x02fa8349                           // cmpq	$2, %r10
+	JBE  BB0_11
+	WORD $0x0148; BYTE $0xda                   // addq	%rbx, %rdx
+	LONG $0x2c10fdc5; BYTE $0xd7               // vmovupd	(%rdi,%rdx,8), %ymm5
+	LONG $0x5c55c1c4; WORD $0xd004             // vsubpd	(%r8,%rdx,8), %ymm5, %ymm0
+	WORD $0x8948; BYTE $0xca                   // movq	%rcx, %rdx
+	LONG $0xfce28348                           // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0xe183; BYTE $0x03                   // andl	$3, %ecx
+	LONG $0xc059fdc5                           // vmulpd	%ymm0, %ymm0, %ymm0
+	LONG $0xc958fbc5                           // vaddsd	%xmm1, %xmm0, %xmm1
+	LONG $0xd015f9c5                           // vunpckhpd	%xmm0, %xmm0, %xmm2
+	LONG $0xd158ebc5                           // vaddsd	%xmm1, %xmm2, %xmm2
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$1, %ymm0, %xmm1
+	LONG $0x28fdf362; WORD $0xc003; BYTE $0x03 // valignq	$3, %ymm0, %ymm0, %ymm0
+	LONG $0xca58f3c5                           // vaddsd	%xmm2, %xmm1, %xmm1
+	LONG $0xc858f3c5                           // vaddsd	%xmm0, %xmm1, %xmm1
+	JE   BB0_29
+
+BB0_11:
+	LONG $0x0410fbc5; BYTE $0xc7               // vmovsd	(%rdi,%rax,8), %xmm0
+	LONG $0x5c7bc1c4; WORD $0xc004             // vsubsd	(%r8,%rax,8), %xmm0, %xmm0
+	LONG $0x01488d48                           // leaq	1(%rax), %rcx
+	QUAD $0x00000000c5148d48                   // leaq	0(,%rax,8), %rdx
+	LONG $0xb9f9e2c4; BYTE $0xc8               // vfmadd231sd	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_29
+	LONG $0x4410fbc5; WORD $0x0817             // vmovsd	8(%rdi,%rdx), %xmm0
+	LONG $0x5c7bc1c4; WORD $0x1044; BYTE $0x08 // vsubsd	8(%r8,%rdx), %xmm0, %xmm0
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0xb9f9e2c4; BYTE $0xc8               // vfmadd231sd	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_29
+	LONG $0x4410fbc5; WORD $0x1017             // vmovsd	16(%rdi,%rdx), %xmm0
+	LONG $0x5c7bc1c4; WORD $0x1044; BYTE $0x10 // vsubsd	16(%r8,%rdx), %xmm0, %xmm0
+	LONG $0xb9f9e2c4; BYTE $0xc8               // vfmadd231sd	%xmm0, %xmm0, %xmm1
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	LONG $0x117bc1c4; BYTE $0x09               // vmovsd	%xmm1, (%r9)
+	RET
+
+BB0_29:
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117bc1c4; BYTE $0x09 // vmovsd	%xmm1, (%r9)
+	RET
+
+BB0_26:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_31:
+	LONG $0x117bc1c4; BYTE $0x09 // vmovsd	%xmm1, (%r9)
+	RET
+
+BB0_14:
+	LONG $0xed57d1c5               // vxorpd	%xmm5, %xmm5, %xmm5
+	LONG $0x0008ba41; WORD $0x0000 // movl	$8, %r10d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x48fdf162; WORD $0xf528 // vmovapd	%zmm5, %zmm6
+	LONG $0x48fdf162; WORD $0xc528 // vmovapd	%zmm5, %zmm0
+	JMP  BB0_3
+
+BB0_15:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_8
@@ -0,0 +1,99 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basemax_c_f64_avx2_amd64.c
+
+TEXT ·max_c_f64_avx2(SB), $0-24
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x36     // movq	(%rsi), %rsi
+	WORD $0x8948; BYTE $0xf9     // movq	%rdi, %rcx
+	WORD $0x8949; BYTE $0xd1     // movq	%rdx, %r9
+	LONG $0x03fe8348             // cmpq	$3, %rsi
+	JLE  BB0_23
+	LONG $0x0710fdc5             // vmovupd	(%rdi), %ymm0
+	LONG $0x0bfe8348             // cmpq	$11, %rsi
+	JLE  BB0_16
+	LONG $0xf4468d4c             // leaq	-12(%rsi), %r8
+	LONG $0x20478d48             // leaq	32(%rdi), %rax
+	LONG $0xc828fdc5             // vmovapd	%ymm0, %ymm1
+	LONG $0x03e8c149             // shrq	$3, %r8
+	WORD $0x894c; BYTE $0xc2     // movq	%r8, %rdx
+	LONG $0x06e2c148             // salq	$6, %rdx
+	LONG $0x17548d48; BYTE $0x60 // leaq	96(%rdi,%rdx), %rdx
+
+BB0_9:
+	LONG $0x005ffdc5             // vmaxpd	(%rax), %ymm0, %ymm0
+	LONG $0x485ff5c5; BYTE $0x20 // vmaxpd	32(%rax), %ymm1, %ymm1
+	LONG $0x40c08348             // addq	$64, %rax
+	WORD $0x3948; BYTE $0xd0     // cmpq	%rdx, %rax
+	JNE  BB0_9
+	LONG $0x03e0c149             // salq	$3, %r8
+	LONG $0x0c408d49             // leaq	12(%r8), %rax
+	LONG $0x10c08349             // addq	$16, %r8
+
+BB0_8:
+	LONG $0xc15ffdc5         // vmaxpd	%ymm1, %ymm0, %ymm0
+	WORD $0x394c; BYTE $0xc6 // cmpq	%r8, %rsi
+	JL   BB0_10
+	WORD $0x894c; BYTE $0xc2 // movq	%r8, %rdx
+
+BB0_11:
+	WORD $0x8948; BYTE $0xc7     // movq	%rax, %rdi
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	LONG $0x04528d48             // leaq	4(%rdx), %rdx
+	LONG $0x045ffdc5; BYTE $0xf9 // vmaxpd	(%rcx,%rdi,8), %ymm0, %ymm0
+	WORD $0x3948; BYTE $0xf2     // cmpq	%rsi, %rdx
+	JLE  BB0_11
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xc0     // subq	%r8, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x014c; BYTE $0xc0     // addq	%r8, %rax
+
+BB0_10:
+	LONG $0x197de3c4; WORD $0x01c1 // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc15ff9c5               // vmaxpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc15ffbc5               // vmaxsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_21
+	LONG $0xc1048d48               // leaq	(%rcx,%rax,8), %rax
+	LONG $0xf1148d48               // leaq	(%rcx,%rsi,8), %rdx
+
+BB0_14:
+	LONG $0x0810fbc5         // vmovsd	(%rax), %xmm1
+	LONG $0x08c08348         // addq	$8, %rax
+	LONG $0xc05ff3c5         // vmaxsd	%xmm0, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JNE  BB0_14
+
+BB0_21:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_7:
+	LONG $0x117bc1c4; BYTE $0x01 // vmovsd	%xmm0, (%r9)
+	RET
+
+BB0_23:
+	LONG $0x0710fbc5             // vmovsd	(%rdi), %xmm0
+	LONG $0x01fe8348             // cmpq	$1, %rsi
+	JLE  BB0_7
+	LONG $0x4f10fbc5; BYTE $0x08 // vmovsd	8(%rdi), %xmm1
+	LONG $0xc05ff3c5             // vmaxsd	%xmm0, %xmm1, %xmm0
+	LONG $0xc810fbc5             // vmovsd	%xmm0, %xmm0, %xmm1
+	LONG $0x03fe8348             // cmpq	$3, %rsi
+	JNE  BB0_7
+	LONG $0x4710fbc5; BYTE $0x10 // vmovsd	16(%rdi), %xmm0
+	LONG $0xc15ffbc5             // vmaxsd	%xmm1, %xmm0, %xmm0
+	LONG $0x117bc1c4; BYTE $0x01 // vmovsd	%xmm0, (%r9)
+	RET
+
+BB0_16:
+	LONG $0xc828fdc5               // vmovapd	%ymm0, %ymm1
+	LONG $0x0008b841; WORD $0x0000 // movl	$8, %r8d
+	LONG $0x000004b8; BYTE $0x00   // movl	$4, %eax
+	JMP  BB0_8
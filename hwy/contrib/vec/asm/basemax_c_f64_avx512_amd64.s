@@ -0,0 +1,118 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basemax_c_f64_avx512_amd64.c
+
+TEXT ·max_c_f64_avx512(SB), $0-24
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x36       // movq	(%rsi), %rsi
+	LONG $0x07fe8348               // cmpq	$7, %rsi
+	JLE  BB0_35
+	LONG $0x48fdf162; WORD $0x0710 // vmovupd	(%rdi), %zmm0
+	LONG $0x17fe8348               // cmpq	$23, %rsi
+	JLE  BB0_22
+	LONG $0xe84e8d4c               // leaq	-24(%rsi), %r9
+	LONG $0x40478d48               // leaq	64(%rdi), %rax
+	LONG $0x48fdf162; WORD $0xc828 // vmovapd	%zmm0, %zmm1
+	LONG $0x04e9c149               // shrq	$4, %r9
+	WORD $0x894c; BYTE $0xc9       // movq	%r9, %rcx
+	LONG $0x07e1c148               // salq	$7, %rcx
+	QUAD $0x000000c00f8c8d48       // leaq	192(%rdi,%rcx), %rcx
+
+BB0_13:
+	LONG $0x48fdf162; WORD $0x005f             // vmaxpd	(%rax), %zmm0, %zmm0
+	LONG $0x48f5f162; WORD $0x485f; BYTE $0x01 // vmaxpd	64(%rax), %zmm1, %zmm1
+	LONG $0x80e88348                           // subq	$-128, %rax
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JNE  BB0_13
+	LONG $0x04e1c149                           // salq	$4, %r9
+	LONG $0x18418d49                           // leaq	24(%r9), %rax
+	LONG $0x20c18349                           // addq	$32, %r9
+
+BB0_12:
+	LONG $0x48fdf162; WORD $0xc15f // vmaxpd	%zmm1, %zmm0, %zmm0
+	WORD $0x394c; BYTE $0xce       // cmpq	%r9, %rsi
+	JL   BB0_14
+	WORD $0x894c; BYTE $0xc9       // movq	%r9, %rcx
+
+BB0_15:
+	WORD $0x8949; BYTE $0xc0                   // movq	%rax, %r8
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	LONG $0x08498d48                           // leaq	8(%rcx), %rcx
+	LONG $0x48fdb162; WORD $0x045f; BYTE $0xc7 // vmaxpd	(%rdi,%r8,8), %zmm0, %zmm0
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JLE  BB0_15
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xc8                   // subq	%r9, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+
+BB0_14:
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc85ff5c5                           // vmaxpd	%ymm0, %ymm1, %ymm1
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$0x1, %ymm1, %xmm0
+	LONG $0xc15ff9c5                           // vmaxpd	%xmm1, %xmm0, %xmm0
+	LONG $0x0579e3c4; WORD $0x01c8             // vpermilpd	$1, %xmm0, %xmm1
+	LONG $0xc15ff9c5                           // vmaxpd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_33
+	LONG $0xc7048d48                           // leaq	(%rdi,%rax,8), %rax
+	LONG $0xf70c8d48                           // leaq	(%rdi,%rsi,8), %rcx
+
+BB0_18:
+	LONG $0x0810fbc5         // vmovsd	(%rax), %xmm1
+	LONG $0x08c08348         // addq	$8, %rax
+	LONG $0xc05ff3c5         // vmaxsd	%xmm0, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc1 // cmpq	%rax, %rcx
+	JNE  BB0_18
+
+BB0_33:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_11:
+	LONG $0x0211fbc5 // vmovsd	%xmm0, (%rdx)
+	RET
+
+BB0_35:
+	LONG $0x0710fbc5             // vmovsd	(%rdi), %xmm0
+	LONG $0x01fe8348             // cmpq	$1, %rsi
+	JLE  BB0_11
+	LONG $0x4f10fbc5; BYTE $0x08 // vmovsd	8(%rdi), %xmm1
+	LONG $0xc85ff3c5             // vmaxsd	%xmm0, %xmm1, %xmm1
+	LONG $0x02fe8348             // cmpq	$2, %rsi
+	JE   BB0_21
+	LONG $0x4710fbc5; BYTE $0x10 // vmovsd	16(%rdi), %xmm0
+	LONG $0xc15ffbc5             // vmaxsd	%xmm1, %xmm0, %xmm0
+	LONG $0x03fe8348             // cmpq	$3, %rsi
+	JE   BB0_11
+	LONG $0x4f10fbc5; BYTE $0x18 // vmovsd	24(%rdi), %xmm1
+	LONG $0xc85ff3c5             // vmaxsd	%xmm0, %xmm1, %xmm1
+	LONG $0x04fe8348             // cmpq	$4, %rsi
+	JE   BB0_21
+	LONG $0x4710fbc5; BYTE $0x20 // vmovsd	32(%rdi), %xmm0
+	LONG $0xc15ffbc5             // vmaxsd	%xmm1, %xmm0, %xmm0
+	LONG $0x05fe8348             // cmpq	$5, %rsi
+	JE   BB0_11
+	LONG $0x4f10fbc5; BYTE $0x28 // vmovsd	40(%rdi), %xmm1
+	LONG $0xc85ff3c5             // vmaxsd	%xmm0, %xmm1, %xmm1
+	LONG $0x07fe8348             // cmpq	$7, %rsi
+	JNE  BB0_21
+	LONG $0x4710fbc5; BYTE $0x30 // vmovsd	48(%rdi), %xmm0
+	LONG $0xc15ffbc5             // vmaxsd	%xmm1, %xmm0, %xmm0
+	LONG $0x0211fbc5             // vmovsd	%xmm0, (%rdx)
+	RET
+
+BB0_21:
+	LONG $0xc110f3c5 // vmovsd	%xmm1, %xmm1, %xmm0
+	JMP  BB0_11
+
+BB0_22:
+	LONG $0x48fdf162; WORD $0xc828 // vmovapd	%zmm0, %zmm1
+	LONG $0x0010b941; WORD $0x0000 // movl	$16, %r9d
+	LONG $0x000008b8; BYTE $0x00   // movl	$8, %eax
+	JMP  BB0_12
@@ -0,0 +1,120 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basemin_c_f32_avx2_amd64.c
+
+TEXT ·min_c_f32_avx2(SB), $0-24
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x36     // movq	(%rsi), %rsi
+	WORD $0x8948; BYTE $0xf9     // movq	%rdi, %rcx
+	WORD $0x8949; BYTE $0xd1     // movq	%rdx, %r9
+	LONG $0x07fe8348             // cmpq	$7, %rsi
+	JLE  BB0_35
+	LONG $0x0710fcc5             // vmovups	(%rdi), %ymm0
+	LONG $0x17fe8348             // cmpq	$23, %rsi
+	JLE  BB0_22
+	LONG $0xe8468d4c             // leaq	-24(%rsi), %r8
+	LONG $0x20478d48             // leaq	32(%rdi), %rax
+	LONG $0xc828fcc5             // vmovaps	%ymm0, %ymm1
+	LONG $0x04e8c149             // shrq	$4, %r8
+	WORD $0x894c; BYTE $0xc2     // movq	%r8, %rdx
+	LONG $0x06e2c148             // salq	$6, %rdx
+	LONG $0x17548d48; BYTE $0x60 // leaq	96(%rdi,%rdx), %rdx
+
+BB0_13:
+	LONG $0x005dfcc5             // vminps	(%rax), %ymm0, %ymm0
+	LONG $0x485df4c5; BYTE $0x20 // vminps	32(%rax), %ymm1, %ymm1
+	LONG $0x40c08348             // addq	$64, %rax
+	WORD $0x3948; BYTE $0xd0     // cmpq	%rdx, %rax
+	JNE  BB0_13
+	LONG $0x04e0c149             // salq	$4, %r8
+	LONG $0x18408d49             // leaq	24(%r8), %rax
+	LONG $0x20c08349             // addq	$32, %r8
+
+BB0_12:
+	LONG $0xc15dfcc5         // vminps	%ymm1, %ymm0, %ymm0
+	WORD $0x394c; BYTE $0xc6 // cmpq	%r8, %rsi
+	JL   BB0_14
+	WORD $0x894c; BYTE $0xc2 // movq	%r8, %rdx
+
+BB0_15:
+	WORD $0x8948; BYTE $0xc7     // movq	%rax, %rdi
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	LONG $0x08528d48             // leaq	8(%rdx), %rdx
+	LONG $0x045dfcc5; BYTE $0xb9 // vminps	(%rcx,%rdi,4), %ymm0, %ymm0
+	WORD $0x3948; BYTE $0xd6     // cmpq	%rdx, %rsi
+	JGE  BB0_15
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xc0     // subq	%r8, %rax
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x014c; BYTE $0xc0     // addq	%r8, %rax
+
+BB0_14:
+	LONG $0x197de3c4; WORD $0x01c1 // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc15df8c5               // vminps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc15df8c5               // vminps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc15dfac5               // vminss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_33
+	LONG $0x81048d48               // leaq	(%rcx,%rax,4), %rax
+	LONG $0xb1148d48               // leaq	(%rcx,%rsi,4), %rdx
+
+BB0_18:
+	LONG $0x0810fac5         // vmovss	(%rax), %xmm1
+	LONG $0x04c08348         // addq	$4, %rax
+	LONG $0xc05df2c5         // vminss	%xmm0, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JNE  BB0_18
+
+BB0_33:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_11:
+	LONG $0x117ac1c4; BYTE $0x01 // vmovss	%xmm0, (%r9)
+	RET
+
+BB0_35:
+	LONG $0x0710fac5             // vmovss	(%rdi), %xmm0
+	LONG $0x01fe8348             // cmpq	$1, %rsi
+	JLE  BB0_11
+	LONG $0x4f10fac5; BYTE $0x04 // vmovss	4(%rdi), %xmm1
+	LONG $0xc85df2c5             // vminss	%xmm0, %xmm1, %xmm1
+	LONG $0x02fe8348             // cmpq	$2, %rsi
+	JE   BB0_21
+	LONG $0x4710fac5; BYTE $0x08 // vmovss	8(%rdi), %xmm0
+	LONG $0xc15dfac5             // vminss	%xmm1, %xmm0, %xmm0
+	LONG $0x03fe8348             // cmpq	$3, %rsi
+	JE   BB0_11
+	LONG $0x4f10fac5; BYTE $0x0c // vmovss	12(%rdi), %xmm1
+	LONG $0xc85df2c5             // vminss	%xmm0, %xmm1, %xmm1
+	LONG $0x04fe8348             // cmpq	$4, %rsi
+	JE   BB0_21
+	LONG $0x4710fac5; BYTE $0x10 // vmovss	16(%rdi), %xmm0
+	LONG $0xc15dfac5             // vminss	%xmm1, %xmm0, %xmm0
+	LONG $0x05fe8348             // cmpq	$5, %rsi
+	JE   BB0_11
+	LONG $0x4f10fac5; BYTE $0x14 // vmovss	20(%rdi), %xmm1
+	LONG $0xc85df2c5             // vminss	%xmm0, %xmm1, %xmm1
+	LONG $0x07fe8348             // cmpq	$7, %rsi
+	JNE  BB0_21
+	LONG $0x4710fac5; BYTE $0x18 // vmovss	24(%rdi), %xmm0
+	LONG $0xc15dfac5             // vminss	%xmm1, %xmm0, %xmm0
+	LONG $0x117ac1c4; BYTE $0x01 // vmovss	%xmm0, (%r9)
+	RET
+
+BB0_21:
+	LONG $0xc128f8c5 // vmovaps	%xmm1, %xmm0
+	JMP  BB0_11
+
+BB0_22:
+	LONG $0xc828fcc5               // vmovaps	%ymm0, %ymm1
+	LONG $0x0010b841; WORD $0x0000 // movl	$16, %r8d
+	LONG $0x000008b8; BYTE $0x00   // movl	$8, %eax
+	JMP  BB0_12
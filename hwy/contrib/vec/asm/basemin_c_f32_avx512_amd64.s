@@ -0,0 +1,152 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basemin_c_f32_avx512_amd64.c
+
+TEXT ·min_c_f32_avx512(SB), $0-24
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x36       // movq	(%rsi), %rsi
+	LONG $0x0ffe8348               // cmpq	$15, %rsi
+	JLE  BB0_59
+	LONG $0x487cf162; WORD $0x0710 // vmovups	(%rdi), %zmm0
+	LONG $0x2ffe8348               // cmpq	$47, %rsi
+	JLE  BB0_34
+	LONG $0xd04e8d4c               // leaq	-48(%rsi), %r9
+	LONG $0x40478d48               // leaq	64(%rdi), %rax
+	LONG $0x487cf162; WORD $0xc828 // vmovaps	%zmm0, %zmm1
+	LONG $0x05e9c149               // shrq	$5, %r9
+	WORD $0x894c; BYTE $0xc9       // movq	%r9, %rcx
+	LONG $0x07e1c148               // salq	$7, %rcx
+	QUAD $0x000000c00f8c8d48       // leaq	192(%rdi,%rcx), %rcx
+
+BB0_21:
+	LONG $0x487cf162; WORD $0x005d             // vminps	(%rax), %zmm0, %zmm0
+	LONG $0x4874f162; WORD $0x485d; BYTE $0x01 // vminps	64(%rax), %zmm1, %zmm1
+	LONG $0x80e88348                           // subq	$-128, %rax
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JNE  BB0_21
+	LONG $0x05e1c149                           // salq	$5, %r9
+	LONG $0x30418d49                           // leaq	48(%r9), %rax
+	LONG $0x40c18349                           // addq	$64, %r9
+
+BB0_20:
+	LONG $0x487cf162; WORD $0xc15d // vminps	%zmm1, %zmm0, %zmm0
+	WORD $0x394c; BYTE $0xce       // cmpq	%r9, %rsi
+	JL   BB0_22
+	WORD $0x894c; BYTE $0xc9       // movq	%r9, %rcx
+
+BB0_23:
+	WORD $0x8949; BYTE $0xc0                   // movq	%rax, %r8
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	LONG $0x10498d48                           // leaq	16(%rcx), %rcx
+	LONG $0x487cb162; WORD $0x045d; BYTE $0x87 // vminps	(%rdi,%r8,4), %zmm0, %zmm0
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JLE  BB0_23
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xc8                   // subq	%r9, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+
+BB0_22:
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc85df4c5                           // vminps	%ymm0, %ymm1, %ymm1
+	LONG $0x197de3c4; WORD $0x01c8             // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc15df8c5                           // vminps	%xmm1, %xmm0, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc15df8c5                           // vminps	%xmm1, %xmm0, %xmm0
+	LONG $0x0479e3c4; WORD $0x11c8             // vpermilps	$17, %xmm0, %xmm1
+	LONG $0xc15df8c5                           // vminps	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_57
+	LONG $0x87048d48                           // leaq	(%rdi,%rax,4), %rax
+	LONG $0xb70c8d48                           // leaq	(%rdi,%rsi,4), %rcx
+
+BB0_26:
+	LONG $0x0810fac5         // vmovss	(%rax), %xmm1
+	LONG $0x04c08348         // addq	$4, %rax
+	LONG $0xc05df2c5         // vminss	%xmm0, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc1 // cmpq	%rax, %rcx
+	JNE  BB0_26
+
+BB0_57:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_19:
+	LONG $0x0211fac5 // vmovss	%xmm0, (%rdx)
+	RET
+
+BB0_59:
+	LONG $0x0710fac5             // vmovss	(%rdi), %xmm0
+	LONG $0x01fe8348             // cmpq	$1, %rsi
+	JLE  BB0_19
+	LONG $0x4f10fac5; BYTE $0x04 // vmovss	4(%rdi), %xmm1
+	LONG $0xc85df2c5             // vminss	%xmm0, %xmm1, %xmm1
+	LONG $0x02fe8348             // cmpq	$2, %rsi
+	JE   BB0_33
+	LONG $0x4710fac5; BYTE $0x08 // vmovss	8(%rdi), %xmm0
+	LONG $0xc15dfac5             // vminss	%xmm1, %xmm0, %xmm0
+	LONG $0x03fe8348             // cmpq	$3, %rsi
+	JE   BB0_19
+	LONG $0x4f10fac5; BYTE $0x0c // vmovss	12(%rdi), %xmm1
+	LONG $0xc85df2c5             // vminss	%xmm0, %xmm1, %xmm1
+	LONG $0x04fe8348             // cmpq	$4, %rsi
+	JE   BB0_33
+	LONG $0x4710fac5; BYTE $0x10 // vmovss	16(%rdi), %xmm0
+	LONG $0xc15dfac5             // vminss	%xmm1, %xmm0, %xmm0
+	LONG $0x05fe8348             // cmpq	$5, %rsi
+	JE   BB0_19
+	LONG $0x4f10fac5; BYTE $0x14 // vmovss	20(%rdi), %xmm1
+	LONG $0xc85df2c5             // vminss	%xmm0, %xmm1, %xmm1
+	LONG $0x06fe8348             // cmpq	$6, %rsi
+	JE   BB0_33
+	LONG $0x4710fac5; BYTE $0x18 // vmovss	24(%rdi), %xmm0
+	LONG $0xc15dfac5             // vminss	%xmm1, %xmm0, %xmm0
+	LONG $0x07fe8348             // cmpq	$7, %rsi
+	JE   BB0_19
+	LONG $0x4f10fac5; BYTE $0x1c // vmovss	28(%rdi), %xmm1
+	LONG $0xc85df2c5             // vminss	%xmm0, %xmm1, %xmm1
+	LONG $0x08fe8348             // cmpq	$8, %rsi
+	JE   BB0_33
+	LONG $0x4710fac5; BYTE $0x20 // vmovss	32(%rdi), %xmm0
+	LONG $0xc15dfac5             // vminss	%xmm1, %xmm0, %xmm0
+	LONG $0x09fe8348             // cmpq	$9, %rsi
+	JE   BB0_19
+	LONG $0x4f10fac5; BYTE $0x24 // vmovss	36(%rdi), %xmm1
+	LONG $0xc85df2c5             // vminss	%xmm0, %xmm1, %xmm1
+	LONG $0x0afe8348             // cmpq	$10, %rsi
+	JE   BB0_33
+	LONG $0x4710fac5; BYTE $0x28 // vmovss	40(%rdi), %xmm0
+	LONG $0xc15dfac5             // vminss	%xmm1, %xmm0, %xmm0
+	LONG $0x0bfe8348             // cmpq	$11, %rsi
+	JE   BB0_19
+	LONG $0x4f10fac5; BYTE $0x2c // vmovss	44(%rdi), %xmm1
+	LONG $0xc85df2c5             // vminss	%xmm0, %xmm1, %xmm1
+	LONG $0x0cfe8348             // cmpq	$12, %rsi
+	JE   BB0_33
+	LONG $0x4710fac5; BYTE $0x30 // vmovss	48(%rdi), %xmm0
+	LONG $0xc15dfac5             // vminss	%xmm1, %xmm0, %xmm0
+	LONG $0x0dfe8348             // cmpq	$13, %rsi
+	JE   BB0_19
+	LONG $0x4f10fac5; BYTE $0x34 // vmovss	52(%rdi), %xmm1
+	LONG $0xc85df2c5             // vminss	%xmm0, %xmm1, %xmm1
+	LONG $0x0ffe8348             // cmpq	$15, %rsi
+	JNE  BB0_33
+	LONG $0x4710fac5; BYTE $0x38 // vmovss	56(%rdi), %xmm0
+	LONG $0xc15dfac5             // vminss	%xmm1, %xmm0, %xmm0
+	JMP  BB0_19
+
+BB0_33:
+	LONG $0xc128f8c5 // vmovaps	%xmm1, %xmm0
+	LONG $0x0211fac5 // vmovss	%xmm0, (%rdx)
+	RET
+
+BB0_34:
+	LONG $0x487cf162; WORD $0xc828 // vmovaps	%zmm0, %zmm1
+	LONG $0x0020b941; WORD $0x0000 // movl	$32, %r9d
+	LONG $0x000010b8; BYTE $0x00   // movl	$16, %eax
+	JMP  BB0_20
@@ -0,0 +1,126 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/baseminmax_c_f32_avx2_amd64.c
+
+TEXT ·minmax_c_f32_avx2(SB), $0-32
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_minVal+16(FP), DX
+	MOVQ pout_maxVal+24(FP), CX
+	WORD $0x8b48; BYTE $0x36     // movq	(%rsi), %rsi
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	LONG $0x07fe8348             // cmpq	$7, %rsi
+	JLE  BB0_44
+	LONG $0x0f10fcc5             // vmovups	(%rdi), %ymm1
+	LONG $0x0ffe8348             // cmpq	$15, %rsi
+	JLE  BB0_36
+	LONG $0xf04e8d4c             // leaq	-16(%rsi), %r9
+	LONG $0x20478d48             // leaq	32(%rdi), %rax
+	LONG $0xc128fcc5             // vmovaps	%ymm1, %ymm0
+	LONG $0x03e9c149             // shrq	$3, %r9
+	WORD $0x894c; BYTE $0xca     // movq	%r9, %rdx
+	LONG $0x05e2c148             // salq	$5, %rdx
+	LONG $0x17548d48; BYTE $0x40 // leaq	64(%rdi,%rdx), %rdx
+
+BB0_19:
+	LONG $0x085df4c5         // vminps	(%rax), %ymm1, %ymm1
+	LONG $0x005ffcc5         // vmaxps	(%rax), %ymm0, %ymm0
+	LONG $0x20c08348         // addq	$32, %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JNE  BB0_19
+	QUAD $0x00000010cd048d4a // leaq	16(,%r9,8), %rax
+
+BB0_18:
+	LONG $0x197de3c4; WORD $0x01ca // vextractf128	$0x1, %ymm1, %xmm2
+	LONG $0xca5df0c5               // vminps	%xmm2, %xmm1, %xmm1
+	LONG $0xd112f0c5               // vmovhlps	%xmm1, %xmm1, %xmm2
+	LONG $0xca5df0c5               // vminps	%xmm2, %xmm1, %xmm1
+	LONG $0xd116fac5               // vmovshdup	%xmm1, %xmm2
+	LONG $0xca5df2c5               // vminss	%xmm2, %xmm1, %xmm1
+	LONG $0x197de3c4; WORD $0x01c2 // vextractf128	$0x1, %ymm0, %xmm2
+	LONG $0xc25ff8c5               // vmaxps	%xmm2, %xmm0, %xmm0
+	LONG $0xd012f8c5               // vmovhlps	%xmm0, %xmm0, %xmm2
+	LONG $0xc25ff8c5               // vmaxps	%xmm2, %xmm0, %xmm0
+	LONG $0xd016fac5               // vmovshdup	%xmm0, %xmm2
+	LONG $0xc25ffac5               // vmaxss	%xmm2, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_41
+	LONG $0x87048d48               // leaq	(%rdi,%rax,4), %rax
+	LONG $0xb7148d48               // leaq	(%rdi,%rsi,4), %rdx
+
+BB0_23:
+	LONG $0x1010fac5         // vmovss	(%rax), %xmm2
+	LONG $0x04c08348         // addq	$4, %rax
+	LONG $0xc95deac5         // vminss	%xmm1, %xmm2, %xmm1
+	LONG $0xc05feac5         // vmaxss	%xmm0, %xmm2, %xmm0
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JNE  BB0_23
+
+BB0_41:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_17:
+	LONG $0x117ac1c4; BYTE $0x08 // vmovss	%xmm1, (%r8)
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	RET
+
+BB0_44:
+	LONG $0x0f10fac5             // vmovss	(%rdi), %xmm1
+	LONG $0x01fe8348             // cmpq	$1, %rsi
+	JLE  BB0_24
+	LONG $0x4710fac5; BYTE $0x04 // vmovss	4(%rdi), %xmm0
+	LONG $0xd15dfac5             // vminss	%xmm1, %xmm0, %xmm2
+	LONG $0xc15ffac5             // vmaxss	%xmm1, %xmm0, %xmm0
+	LONG $0x02fe8348             // cmpq	$2, %rsi
+	JE   BB0_42
+	LONG $0x4f10fac5; BYTE $0x08 // vmovss	8(%rdi), %xmm1
+	LONG $0xd25df2c5             // vminss	%xmm2, %xmm1, %xmm2
+	LONG $0xc85ff2c5             // vmaxss	%xmm0, %xmm1, %xmm1
+	LONG $0x03fe8348             // cmpq	$3, %rsi
+	JE   BB0_32
+	LONG $0x4710fac5; BYTE $0x0c // vmovss	12(%rdi), %xmm0
+	LONG $0xd25dfac5             // vminss	%xmm2, %xmm0, %xmm2
+	LONG $0xc15ffac5             // vmaxss	%xmm1, %xmm0, %xmm0
+	LONG $0x04fe8348             // cmpq	$4, %rsi
+	JE   BB0_42
+	LONG $0x4f10fac5; BYTE $0x10 // vmovss	16(%rdi), %xmm1
+	LONG $0xd25df2c5             // vminss	%xmm2, %xmm1, %xmm2
+	LONG $0xc85ff2c5             // vmaxss	%xmm0, %xmm1, %xmm1
+	LONG $0x05fe8348             // cmpq	$5, %rsi
+	JE   BB0_32
+	LONG $0x5f10fac5; BYTE $0x14 // vmovss	20(%rdi), %xmm3
+	LONG $0xd25de2c5             // vminss	%xmm2, %xmm3, %xmm2
+	LONG $0xd95fe2c5             // vmaxss	%xmm1, %xmm3, %xmm3
+	LONG $0x07fe8348             // cmpq	$7, %rsi
+	JNE  BB0_34
+	LONG $0x4710fac5; BYTE $0x18 // vmovss	24(%rdi), %xmm0
+	LONG $0xca5dfac5             // vminss	%xmm2, %xmm0, %xmm1
+	LONG $0xc35ffac5             // vmaxss	%xmm3, %xmm0, %xmm0
+	LONG $0x117ac1c4; BYTE $0x08 // vmovss	%xmm1, (%r8)
+	LONG $0x0111fac5             // vmovss	%xmm0, (%rcx)
+	RET
+
+BB0_34:
+	LONG $0xc328f8c5 // vmovaps	%xmm3, %xmm0
+
+BB0_42:
+	LONG $0xca28f8c5 // vmovaps	%xmm2, %xmm1
+	JMP  BB0_17
+
+BB0_36:
+	LONG $0xc128fcc5             // vmovaps	%ymm1, %ymm0
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+	JMP  BB0_18
+
+BB0_32:
+	LONG $0xc128f8c5 // vmovaps	%xmm1, %xmm0
+	LONG $0xca28f8c5 // vmovaps	%xmm2, %xmm1
+	JMP  BB0_17
+
+BB0_24:
+	LONG $0xc128f8c5 // vmovaps	%xmm1, %xmm0
+	JMP  BB0_17
@@ -0,0 +1,101 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/baseminmax_c_f32_avx512_amd64.c
+
+TEXT ·minmax_c_f32_avx512(SB), $0-32
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_minVal+16(FP), DX
+	MOVQ pout_maxVal+24(FP), CX
+	WORD $0x8b4c; BYTE $0x0e       // movq	(%rsi), %r9
+	LONG $0x0ff98349               // cmpq	$15, %r9
+	JLE  BB0_25
+	LONG $0x487cf162; WORD $0x0710 // vmovups	(%rdi), %zmm0
+	LONG $0x1ff98349               // cmpq	$31, %r9
+	JLE  BB0_17
+	LONG $0xe0718d49               // leaq	-32(%r9), %rsi
+	LONG $0x40478d48               // leaq	64(%rdi), %rax
+	LONG $0x487cf162; WORD $0xc828 // vmovaps	%zmm0, %zmm1
+	LONG $0x04eec148               // shrq	$4, %rsi
+	WORD $0x8949; BYTE $0xf0       // movq	%rsi, %r8
+	LONG $0x06e0c149               // salq	$6, %r8
+	QUAD $0x0000008007848d4e       // leaq	128(%rdi,%r8), %r8
+
+BB0_9:
+	LONG $0x487cf162; WORD $0x005d // vminps	(%rax), %zmm0, %zmm0
+	LONG $0x4874f162; WORD $0x085f // vmaxps	(%rax), %zmm1, %zmm1
+	LONG $0x40c08348               // addq	$64, %rax
+	WORD $0x394c; BYTE $0xc0       // cmpq	%r8, %rax
+	JNE  BB0_9
+	LONG $0x02468d48               // leaq	2(%rsi), %rax
+	LONG $0x04e0c148               // salq	$4, %rax
+
+BB0_8:
+	LONG $0x48fdf362; WORD $0xc21b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm2
+	LONG $0xd05decc5                           // vminps	%ymm0, %ymm2, %ymm2
+	LONG $0x197de3c4; WORD $0x01d0             // vextractf128	$0x1, %ymm2, %xmm0
+	LONG $0xc25df8c5                           // vminps	%xmm2, %xmm0, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ed0             // vpermilps	$78, %xmm0, %xmm2
+	LONG $0xc25df8c5                           // vminps	%xmm2, %xmm0, %xmm0
+	LONG $0x0479e3c4; WORD $0x11d0             // vpermilps	$17, %xmm0, %xmm2
+	LONG $0xc25df8c5                           // vminps	%xmm2, %xmm0, %xmm0
+	LONG $0x48fdf362; WORD $0xca1b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm2
+	LONG $0xd15fecc5                           // vmaxps	%ymm1, %ymm2, %ymm2
+	LONG $0x197de3c4; WORD $0x01d1             // vextractf128	$0x1, %ymm2, %xmm1
+	LONG $0xca5ff0c5                           // vmaxps	%xmm2, %xmm1, %xmm1
+	LONG $0x0479e3c4; WORD $0x4ed1             // vpermilps	$78, %xmm1, %xmm2
+	LONG $0xca5ff0c5                           // vmaxps	%xmm2, %xmm1, %xmm1
+	LONG $0x0479e3c4; WORD $0x11d1             // vpermilps	$17, %xmm1, %xmm2
+	LONG $0xca5ff0c5                           // vmaxps	%xmm2, %xmm1, %xmm1
+	WORD $0x3949; BYTE $0xc1                   // cmpq	%rax, %r9
+	JLE  BB0_23
+	LONG $0x87048d48                           // leaq	(%rdi,%rax,4), %rax
+	LONG $0x8f348d4a                           // leaq	(%rdi,%r9,4), %rsi
+
+BB0_13:
+	LONG $0x1010fac5         // vmovss	(%rax), %xmm2
+	LONG $0x04c08348         // addq	$4, %rax
+	LONG $0xc05deac5         // vminss	%xmm0, %xmm2, %xmm0
+	LONG $0xc95feac5         // vmaxss	%xmm1, %xmm2, %xmm1
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JNE  BB0_13
+
+BB0_23:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_7:
+	LONG $0x0211fac5 // vmovss	%xmm0, (%rdx)
+	LONG $0x0911fac5 // vmovss	%xmm1, (%rcx)
+	RET
+
+BB0_25:
+	LONG $0x0710fac5 // vmovss	(%rdi), %xmm0
+	LONG $0x01f98349 // cmpq	$1, %r9
+	JLE  BB0_14
+	LONG $0x04478d48 // leaq	4(%rdi), %rax
+	LONG $0x8f348d4a // leaq	(%rdi,%r9,4), %rsi
+	LONG $0xc828f8c5 // vmovaps	%xmm0, %xmm1
+
+BB0_6:
+	LONG $0x1010fac5         // vmovss	(%rax), %xmm2
+	LONG $0x04c08348         // addq	$4, %rax
+	LONG $0xc05deac5         // vminss	%xmm0, %xmm2, %xmm0
+	LONG $0xc95feac5         // vmaxss	%xmm1, %xmm2, %xmm1
+	WORD $0x3948; BYTE $0xc6 // cmpq	%rax, %rsi
+	JNE  BB0_6
+	LONG $0x0211fac5         // vmovss	%xmm0, (%rdx)
+	LONG $0x0911fac5         // vmovss	%xmm1, (%rcx)
+	RET
+
+BB0_17:
+	LONG $0x487cf162; WORD $0xc828 // vmovaps	%zmm0, %zmm1
+	LONG $0x000010b8; BYTE $0x00   // movl	$16, %eax
+	JMP  BB0_8
+
+BB0_14:
+	LONG $0xc828f8c5 // vmovaps	%xmm0, %xmm1
+	JMP  BB0_7
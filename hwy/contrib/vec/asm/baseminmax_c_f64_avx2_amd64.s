@@ -0,0 +1,92 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/baseminmax_c_f64_avx2_amd64.c
+
+TEXT ·minmax_c_f64_avx2(SB), $0-32
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_minVal+16(FP), DX
+	MOVQ pout_maxVal+24(FP), CX
+	WORD $0x8b48; BYTE $0x36     // movq	(%rsi), %rsi
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	LONG $0x03fe8348             // cmpq	$3, %rsi
+	JLE  BB0_27
+	LONG $0x0710fdc5             // vmovupd	(%rdi), %ymm0
+	LONG $0x07fe8348             // cmpq	$7, %rsi
+	JLE  BB0_20
+	LONG $0xf84e8d4c             // leaq	-8(%rsi), %r9
+	LONG $0x20478d48             // leaq	32(%rdi), %rax
+	LONG $0xc828fdc5             // vmovapd	%ymm0, %ymm1
+	LONG $0x02e9c149             // shrq	$2, %r9
+	WORD $0x894c; BYTE $0xca     // movq	%r9, %rdx
+	LONG $0x05e2c148             // salq	$5, %rdx
+	LONG $0x17548d48; BYTE $0x40 // leaq	64(%rdi,%rdx), %rdx
+
+BB0_11:
+	LONG $0x005dfdc5         // vminpd	(%rax), %ymm0, %ymm0
+	LONG $0x085ff5c5         // vmaxpd	(%rax), %ymm1, %ymm1
+	LONG $0x20c08348         // addq	$32, %rax
+	WORD $0x3948; BYTE $0xc2 // cmpq	%rax, %rdx
+	JNE  BB0_11
+	QUAD $0x000000088d048d4a // leaq	8(,%r9,4), %rax
+
+BB0_10:
+	LONG $0x197de3c4; WORD $0x01c2 // vextractf128	$0x1, %ymm0, %xmm2
+	LONG $0xc25df9c5               // vminpd	%xmm2, %xmm0, %xmm0
+	LONG $0xd015f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm2
+	LONG $0xc25dfbc5               // vminsd	%xmm2, %xmm0, %xmm0
+	LONG $0x197de3c4; WORD $0x01ca // vextractf128	$0x1, %ymm1, %xmm2
+	LONG $0xca5ff1c5               // vmaxpd	%xmm2, %xmm1, %xmm1
+	LONG $0xd115f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0xca5ff3c5               // vmaxsd	%xmm2, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_25
+	LONG $0xc7048d48               // leaq	(%rdi,%rax,8), %rax
+	LONG $0xf7148d48               // leaq	(%rdi,%rsi,8), %rdx
+
+BB0_15:
+	LONG $0x1010fbc5         // vmovsd	(%rax), %xmm2
+	LONG $0x08c08348         // addq	$8, %rax
+	LONG $0xc05debc5         // vminsd	%xmm0, %xmm2, %xmm0
+	LONG $0xc95febc5         // vmaxsd	%xmm1, %xmm2, %xmm1
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JNE  BB0_15
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_9:
+	LONG $0x117bc1c4; BYTE $0x00 // vmovsd	%xmm0, (%r8)
+	LONG $0x0911fbc5             // vmovsd	%xmm1, (%rcx)
+	RET
+
+BB0_27:
+	LONG $0x0710fbc5             // vmovsd	(%rdi), %xmm0
+	LONG $0xc810fbc5             // vmovsd	%xmm0, %xmm0, %xmm1
+	LONG $0x01fe8348             // cmpq	$1, %rsi
+	JLE  BB0_9
+	LONG $0x5710fbc5; BYTE $0x08 // vmovsd	8(%rdi), %xmm2
+	LONG $0xd85debc5             // vminsd	%xmm0, %xmm2, %xmm3
+	LONG $0xd05febc5             // vmaxsd	%xmm0, %xmm2, %xmm2
+	LONG $0x03fe8348             // cmpq	$3, %rsi
+	JNE  BB0_18
+	LONG $0x4f10fbc5; BYTE $0x10 // vmovsd	16(%rdi), %xmm1
+	LONG $0xc35df3c5             // vminsd	%xmm3, %xmm1, %xmm0
+	LONG $0xca5ff3c5             // vmaxsd	%xmm2, %xmm1, %xmm1
+	LONG $0x117bc1c4; BYTE $0x00 // vmovsd	%xmm0, (%r8)
+	LONG $0x0911fbc5             // vmovsd	%xmm1, (%rcx)
+	RET
+
+BB0_18:
+	LONG $0xca10ebc5 // vmovsd	%xmm2, %xmm2, %xmm1
+	LONG $0xc310e3c5 // vmovsd	%xmm3, %xmm3, %xmm0
+	JMP  BB0_9
+
+BB0_20:
+	LONG $0xc828fdc5             // vmovapd	%ymm0, %ymm1
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+	JMP  BB0_10
@@ -0,0 +1,125 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/baseminmax_c_f64_avx512_amd64.c
+
+TEXT ·minmax_c_f64_avx512(SB), $0-32
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_minVal+16(FP), DX
+	MOVQ pout_maxVal+24(FP), CX
+	WORD $0x8b4c; BYTE $0x06       // movq	(%rsi), %r8
+	LONG $0x07f88349               // cmpq	$7, %r8
+	JLE  BB0_44
+	LONG $0x48fdf162; WORD $0x0710 // vmovupd	(%rdi), %zmm0
+	LONG $0x0ff88349               // cmpq	$15, %r8
+	JLE  BB0_36
+	LONG $0xf0488d4d               // leaq	-16(%r8), %r9
+	LONG $0x40478d48               // leaq	64(%rdi), %rax
+	LONG $0x48fdf162; WORD $0xd028 // vmovapd	%zmm0, %zmm2
+	LONG $0x03e9c149               // shrq	$3, %r9
+	WORD $0x894c; BYTE $0xce       // movq	%r9, %rsi
+	LONG $0x06e6c148               // salq	$6, %rsi
+	QUAD $0x0000008037b48d48       // leaq	128(%rdi,%rsi), %rsi
+
+BB0_19:
+	LONG $0x48fdf162; WORD $0x005d // vminpd	(%rax), %zmm0, %zmm0
+	LONG $0x48edf162; WORD $0x105f // vmaxpd	(%rax), %zmm2, %zmm2
+	LONG $0x40c08348               // addq	$64, %rax
+	WORD $0x3948; BYTE $0xf0       // cmpq	%rsi, %rax
+	JNE  BB0_19
+	QUAD $0x00000010cd048d4a       // leaq	16(,%r9,8), %rax
+
+BB0_18:
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc05df5c5                           // vminpd	%ymm0, %ymm1, %ymm0
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm1
+	LONG $0xc85df1c5                           // vminpd	%xmm0, %xmm1, %xmm1
+	LONG $0x0579e3c4; WORD $0x01c1             // vpermilpd	$1, %xmm1, %xmm0
+	LONG $0xc85df1c5                           // vminpd	%xmm0, %xmm1, %xmm1
+	LONG $0x48fdf362; WORD $0xd01b; BYTE $0x01 // vextractf64x4	$0x1, %zmm2, %ymm0
+	LONG $0xd25ffdc5                           // vmaxpd	%ymm2, %ymm0, %ymm2
+	LONG $0x28fdf362; WORD $0xd019; BYTE $0x01 // vextractf64x2	$0x1, %ymm2, %xmm0
+	LONG $0xc25ff9c5                           // vmaxpd	%xmm2, %xmm0, %xmm0
+	LONG $0x0579e3c4; WORD $0x01d0             // vpermilpd	$1, %xmm0, %xmm2
+	LONG $0xc25ff9c5                           // vmaxpd	%xmm2, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc0                   // cmpq	%rax, %r8
+	JLE  BB0_41
+	LONG $0xc7048d48                           // leaq	(%rdi,%rax,8), %rax
+	LONG $0xc7348d4a                           // leaq	(%rdi,%r8,8), %rsi
+
+BB0_23:
+	LONG $0x1010fbc5         // vmovsd	(%rax), %xmm2
+	LONG $0x08c08348         // addq	$8, %rax
+	LONG $0xc95debc5         // vminsd	%xmm1, %xmm2, %xmm1
+	LONG $0xc05febc5         // vmaxsd	%xmm0, %xmm2, %xmm0
+	WORD $0x3948; BYTE $0xf0 // cmpq	%rsi, %rax
+	JNE  BB0_23
+
+BB0_41:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_17:
+	LONG $0x0a11fbc5 // vmovsd	%xmm1, (%rdx)
+	LONG $0x0111fbc5 // vmovsd	%xmm0, (%rcx)
+	RET
+
+BB0_44:
+	LONG $0x0f10fbc5             // vmovsd	(%rdi), %xmm1
+	LONG $0x01f88349             // cmpq	$1, %r8
+	JLE  BB0_24
+	LONG $0x4710fbc5; BYTE $0x08 // vmovsd	8(%rdi), %xmm0
+	LONG $0xd15dfbc5             // vminsd	%xmm1, %xmm0, %xmm2
+	LONG $0xc15ffbc5             // vmaxsd	%xmm1, %xmm0, %xmm0
+	LONG $0x02f88349             // cmpq	$2, %r8
+	JE   BB0_42
+	LONG $0x4f10fbc5; BYTE $0x10 // vmovsd	16(%rdi), %xmm1
+	LONG $0xd25df3c5             // vminsd	%xmm2, %xmm1, %xmm2
+	LONG $0xc85ff3c5             // vmaxsd	%xmm0, %xmm1, %xmm1
+	LONG $0x03f88349             // cmpq	$3, %r8
+	JE   BB0_32
+	LONG $0x4710fbc5; BYTE $0x18 // vmovsd	24(%rdi), %xmm0
+	LONG $0xd25dfbc5             // vminsd	%xmm2, %xmm0, %xmm2
+	LONG $0xc15ffbc5             // vmaxsd	%xmm1, %xmm0, %xmm0
+	LONG $0x04f88349             // cmpq	$4, %r8
+	JE   BB0_42
+	LONG $0x4f10fbc5; BYTE $0x20 // vmovsd	32(%rdi), %xmm1
+	LONG $0xd25df3c5             // vminsd	%xmm2, %xmm1, %xmm2
+	LONG $0xc85ff3c5             // vmaxsd	%xmm0, %xmm1, %xmm1
+	LONG $0x05f88349             // cmpq	$5, %r8
+	JE   BB0_32
+	LONG $0x5f10fbc5; BYTE $0x28 // vmovsd	40(%rdi), %xmm3
+	LONG $0xd25de3c5             // vminsd	%xmm2, %xmm3, %xmm2
+	LONG $0xd95fe3c5             // vmaxsd	%xmm1, %xmm3, %xmm3
+	LONG $0x07f88349             // cmpq	$7, %r8
+	JNE  BB0_34
+	LONG $0x4710fbc5; BYTE $0x30 // vmovsd	48(%rdi), %xmm0
+	LONG $0xca5dfbc5             // vminsd	%xmm2, %xmm0, %xmm1
+	LONG $0xc35ffbc5             // vmaxsd	%xmm3, %xmm0, %xmm0
+	LONG $0x0a11fbc5             // vmovsd	%xmm1, (%rdx)
+	LONG $0x0111fbc5             // vmovsd	%xmm0, (%rcx)
+	RET
+
+BB0_34:
+	LONG $0xc310e3c5 // vmovsd	%xmm3, %xmm3, %xmm0
+
+BB0_42:
+	LONG $0xca10ebc5 // vmovsd	%xmm2, %xmm2, %xmm1
+	JMP  BB0_17
+
+BB0_36:
+	LONG $0x48fdf162; WORD $0xd028 // vmovapd	%zmm0, %zmm2
+	LONG $0x000008b8; BYTE $0x00   // movl	$8, %eax
+	JMP  BB0_18
+
+BB0_32:
+	LONG $0xc110f3c5 // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0xca10ebc5 // vmovsd	%xmm2, %xmm2, %xmm1
+	JMP  BB0_17
+
+BB0_24:
+	LONG $0xc110f3c5 // vmovsd	%xmm1, %xmm1, %xmm0
+	JMP  BB0_17
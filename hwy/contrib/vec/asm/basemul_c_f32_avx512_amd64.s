@@ -0,0 +1,262 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basemul_c_f32_avx512_amd64.c
+
+TEXT ·mul_c_f32_avx512(SB), $0-24
+	MOVQ dst+0(FP), DI
+	MOVQ s+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b4c; BYTE $0x02     // movq	(%rdx), %r8
+	WORD $0x854d; BYTE $0xc0     // testq	%r8, %r8
+	JE   BB0_51
+	WORD $0x8948; BYTE $0xf9     // movq	%rdi, %rcx
+	LONG $0x0ff88349             // cmpq	$15, %r8
+	JLE  BB0_11
+	LONG $0x000010b8; BYTE $0x00 // movl	$16, %eax
+
+BB0_4:
+	QUAD $0xff814c10487cf162 // vmovups	-64(%rcx,%rax,4), %zmm1
+	QUAD $0xff8644594874f162 // vmulps	-64(%rsi,%rax,4), %zmm1, %zmm0
+	QUAD $0xff814411487cf162 // vmovups	%zmm0, -64(%rcx,%rax,4)
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x394c; BYTE $0xc0 // cmpq	%r8, %rax
+	JLE  BB0_4
+	LONG $0xf0408d49         // leaq	-16(%r8), %rax
+	LONG $0xf0e08348         // andq	$-16, %rax
+	LONG $0x10c08348         // addq	$16, %rax
+
+BB0_3:
+	WORD $0x3949; BYTE $0xc0     // cmpq	%rax, %r8
+	JLE  BB0_25
+	WORD $0x894d; BYTE $0xc1     // movq	%r8, %r9
+	WORD $0x8948; BYTE $0xc7     // movq	%rax, %rdi
+	QUAD $0x0000000085148d48     // leaq	0(,%rax,4), %rdx
+	WORD $0x2949; BYTE $0xc1     // subq	%rax, %r9
+	LONG $0xff598d4d             // leaq	-1(%r9), %r11
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x06fb8349             // cmpq	$6, %r11
+	JBE  BB0_5
+	QUAD $0x0000000085148d48     // leaq	0(,%rax,4), %rdx
+	LONG $0x11148d4c             // leaq	(%rcx,%rdx), %r10
+	LONG $0x16648d4c; BYTE $0x04 // leaq	4(%rsi,%rdx), %r12
+	WORD $0x894c; BYTE $0xd3     // movq	%r10, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x38fb8348             // cmpq	$56, %rbx
+	JA   BB0_55
+
+BB0_5:
+	LONG $0x113c8d48               // leaq	(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x0459fac5; BYTE $0x86   // vmulss	(%rsi,%rax,4), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x04   // leaq	4(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x0416 // vmulss	4(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x02788d48               // leaq	2(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x08   // leaq	8(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x0816 // vmulss	8(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x03788d48               // leaq	3(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x0c   // leaq	12(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x0c16 // vmulss	12(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x04788d48               // leaq	4(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x10   // leaq	16(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x1016 // vmulss	16(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x05788d48               // leaq	5(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x14   // leaq	20(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x1416 // vmulss	20(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x06788d48               // leaq	6(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x18   // leaq	24(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x1816 // vmulss	24(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x07788d48               // leaq	7(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x1c   // leaq	28(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x1c16 // vmulss	28(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x08788d48               // leaq	8(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x20   // leaq	32(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x2016 // vmulss	32(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x09788d48               // leaq	9(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x24   // leaq	36(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x2416 // vmulss	36(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x0a788d48               // leaq	10(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x28   // leaq	40(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x2816 // vmulss	40(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x0b788d48               // leaq	11(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x2c   // leaq	44(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x2c16 // vmulss	44(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x0c788d48               // leaq	12(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x30   // leaq	48(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x3016 // vmulss	48(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x0d788d48               // leaq	13(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x34   // leaq	52(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x3416 // vmulss	52(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x0e788d48               // leaq	14(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x38   // leaq	56(%rcx,%rdx), %rdi
+	LONG $0x0fc08348               // addq	$15, %rax
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x3816 // vmulss	56(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	WORD $0x3949; BYTE $0xc0       // cmpq	%rax, %r8
+	JLE  BB0_48
+	LONG $0x11448d48; BYTE $0x3c   // leaq	60(%rcx,%rdx), %rax
+	LONG $0x0010fac5               // vmovss	(%rax), %xmm0
+	LONG $0x4459fac5; WORD $0x3c16 // vmulss	60(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0011fac5               // vmovss	%xmm0, (%rax)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	JMP  BB0_49
+
+BB0_55:
+	LONG $0x0efb8349                           // cmpq	$14, %r11
+	JBE  BB0_12
+	LONG $0x487cf162; WORD $0x1c10; BYTE $0x16 // vmovups	(%rsi,%rdx), %zmm3
+	LONG $0x4864d162; WORD $0x0259             // vmulps	(%r10), %zmm3, %zmm0
+	WORD $0x894c; BYTE $0xca                   // movq	%r9, %rdx
+	LONG $0xf0e28348                           // andq	$-16, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x487cd162; WORD $0x0211             // vmovups	%zmm0, (%r10)
+	LONG $0x0fc1f641                           // testb	$15, %r9b
+	JE   BB0_48
+	WORD $0x2949; BYTE $0xd1                   // subq	%rdx, %r9
+	LONG $0xff518d4d                           // leaq	-1(%r9), %r10
+	LONG $0x06fa8349                           // cmpq	$6, %r10
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x0148; BYTE $0xfa     // addq	%rdi, %rdx
+	LONG $0x913c8d48             // leaq	(%rcx,%rdx,4), %rdi
+	LONG $0x1410fcc5; BYTE $0x96 // vmovups	(%rsi,%rdx,4), %ymm2
+	WORD $0x894c; BYTE $0xca     // movq	%r9, %rdx
+	LONG $0x0759ecc5             // vmulps	(%rdi), %ymm2, %ymm0
+	LONG $0xf8e28348             // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd0     // addq	%rdx, %rax
+	LONG $0x07e18341             // andl	$7, %r9d
+	LONG $0x0711fcc5             // vmovups	%ymm0, (%rdi)
+	JE   BB0_48
+
+BB0_8:
+	QUAD $0x0000000085148d48       // leaq	0(,%rax,4), %rdx
+	LONG $0x113c8d48               // leaq	(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x0459fac5; BYTE $0x86   // vmulss	(%rsi,%rax,4), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x04   // leaq	4(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x0416 // vmulss	4(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x02788d48               // leaq	2(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x08   // leaq	8(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x0816 // vmulss	8(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x03788d48               // leaq	3(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x0c   // leaq	12(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x0c16 // vmulss	12(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x04788d48               // leaq	4(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x10   // leaq	16(%rcx,%rdx), %rdi
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x1016 // vmulss	16(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	LONG $0x05788d48               // leaq	5(%rax), %rdi
+	WORD $0x3949; BYTE $0xf8       // cmpq	%rdi, %r8
+	JLE  BB0_48
+	LONG $0x117c8d48; BYTE $0x14   // leaq	20(%rcx,%rdx), %rdi
+	LONG $0x06c08348               // addq	$6, %rax
+	LONG $0x0710fac5               // vmovss	(%rdi), %xmm0
+	LONG $0x4459fac5; WORD $0x1416 // vmulss	20(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0711fac5               // vmovss	%xmm0, (%rdi)
+	WORD $0x3949; BYTE $0xc0       // cmpq	%rax, %r8
+	JLE  BB0_48
+	LONG $0x11448d48; BYTE $0x18   // leaq	24(%rcx,%rdx), %rax
+	LONG $0x0010fac5               // vmovss	(%rax), %xmm0
+	LONG $0x4459fac5; WORD $0x1816 // vmulss	24(%rsi,%rdx), %xmm0, %xmm0
+	LONG $0x0011fac5               // vmovss	%xmm0, (%rax)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_48:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_49:
+	RET
+
+BB0_51:
+	RET
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_6
@@ -0,0 +1,131 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basemul_c_f64_avx2_amd64.c
+
+TEXT ·mul_c_f64_avx2(SB), $0-24
+	MOVQ dst+0(FP), DI
+	MOVQ s+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b48; BYTE $0x12     // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_37
+	WORD $0x8948; BYTE $0xf9     // movq	%rdi, %rcx
+	LONG $0x03fa8348             // cmpq	$3, %rdx
+	JLE  BB0_11
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+
+BB0_4:
+	LONG $0x4c10fdc5; WORD $0xe0c1 // vmovupd	-32(%rcx,%rax,8), %ymm1
+	LONG $0x4459f5c5; WORD $0xe0c6 // vmulpd	-32(%rsi,%rax,8), %ymm1, %ymm0
+	LONG $0x4411fdc5; WORD $0xe0c1 // vmovupd	%ymm0, -32(%rcx,%rax,8)
+	LONG $0x04c08348               // addq	$4, %rax
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JLE  BB0_4
+	LONG $0xfc428d48               // leaq	-4(%rdx), %rax
+	LONG $0x02e8c148               // shrq	$2, %rax
+	QUAD $0x0000000485048d48       // leaq	4(,%rax,4), %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_29
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	QUAD $0x00000000c53c8d48     // leaq	0(,%rax,8), %rdi
+	WORD $0x2949; BYTE $0xc0     // subq	%rax, %r8
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	WORD $0x8948; BYTE $0xc3     // movq	%rax, %rbx
+	LONG $0x01f88349             // cmpq	$1, %r8
+	JE   BB0_5
+	QUAD $0x00000000c53c8d48     // leaq	0(,%rax,8), %rdi
+	LONG $0x390c8d4c             // leaq	(%rcx,%rdi), %r9
+	LONG $0x3e5c8d4c; BYTE $0x08 // leaq	8(%rsi,%rdi), %r11
+	WORD $0x894d; BYTE $0xca     // movq	%r9, %r10
+	WORD $0x294d; BYTE $0xda     // subq	%r11, %r10
+	LONG $0x10fa8349             // cmpq	$16, %r10
+	JA   BB0_41
+
+BB0_5:
+	LONG $0x39048d4c               // leaq	(%rcx,%rdi), %r8
+	LONG $0x107bc1c4; BYTE $0x00   // vmovsd	(%r8), %xmm0
+	LONG $0x0459fbc5; BYTE $0xc6   // vmulsd	(%rsi,%rax,8), %xmm0, %xmm0
+	LONG $0x117bc1c4; BYTE $0x00   // vmovsd	%xmm0, (%r8)
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_34
+	LONG $0x39448d4c; BYTE $0x08   // leaq	8(%rcx,%rdi), %r8
+	LONG $0x107bc1c4; BYTE $0x00   // vmovsd	(%r8), %xmm0
+	LONG $0x4459fbc5; WORD $0x083e // vmulsd	8(%rsi,%rdi), %xmm0, %xmm0
+	LONG $0x117bc1c4; BYTE $0x00   // vmovsd	%xmm0, (%r8)
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_34
+	LONG $0x39448d4c; BYTE $0x10   // leaq	16(%rcx,%rdi), %r8
+	LONG $0x03c08348               // addq	$3, %rax
+	LONG $0x107bc1c4; BYTE $0x00   // vmovsd	(%r8), %xmm0
+	LONG $0x4459fbc5; WORD $0x103e // vmulsd	16(%rsi,%rdi), %xmm0, %xmm0
+	LONG $0x117bc1c4; BYTE $0x00   // vmovsd	%xmm0, (%r8)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_34
+	LONG $0x39448d48; BYTE $0x18   // leaq	24(%rcx,%rdi), %rax
+	LONG $0x0010fbc5               // vmovsd	(%rax), %xmm0
+	LONG $0x4459fbc5; WORD $0x183e // vmulsd	24(%rsi,%rdi), %xmm0, %xmm0
+	LONG $0x0011fbc5               // vmovsd	%xmm0, (%rax)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_34:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_37:
+	RET
+
+BB0_41:
+	LONG $0xff508d49             // leaq	-1(%r8), %rdx
+	LONG $0x02fa8348             // cmpq	$2, %rdx
+	JBE  BB0_12
+	LONG $0x1c10fdc5; BYTE $0x3e // vmovupd	(%rsi,%rdi), %ymm3
+	LONG $0x5965c1c4; BYTE $0x01 // vmulpd	(%r9), %ymm3, %ymm0
+	WORD $0x894c; BYTE $0xc2     // movq	%r8, %rdx
+	LONG $0xfce28348             // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0     // addq	%rdx, %rax
+	LONG $0x117dc1c4; BYTE $0x01 // vmovupd	%ymm0, (%r9)
+	LONG $0x03c0f641             // testb	$3, %r8b
+	JE   BB0_34
+	WORD $0x2949; BYTE $0xd0     // subq	%rdx, %r8
+	LONG $0x01f88349             // cmpq	$1, %r8
+	JE   BB0_8
+
+BB0_6:
+	WORD $0x0148; BYTE $0xda     // addq	%rbx, %rdx
+	LONG $0xd13c8d48             // leaq	(%rcx,%rdx,8), %rdi
+	LONG $0x1410f9c5; BYTE $0xd6 // vmovupd	(%rsi,%rdx,8), %xmm2
+	LONG $0x0759e9c5             // vmulpd	(%rdi), %xmm2, %xmm0
+	LONG $0x0711f9c5             // vmovupd	%xmm0, (%rdi)
+	LONG $0x01c0f641             // testb	$1, %r8b
+	JE   BB0_34
+	LONG $0xfee08349             // andq	$-2, %r8
+	WORD $0x014c; BYTE $0xc0     // addq	%r8, %rax
+
+BB0_8:
+	LONG $0xc1148d48             // leaq	(%rcx,%rax,8), %rdx
+	LONG $0x0210fbc5             // vmovsd	(%rdx), %xmm0
+	LONG $0x0459fbc5; BYTE $0xc6 // vmulsd	(%rsi,%rax,8), %xmm0, %xmm0
+	LONG $0x0211fbc5             // vmovsd	%xmm0, (%rdx)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_29:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_6
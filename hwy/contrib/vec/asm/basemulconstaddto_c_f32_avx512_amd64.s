@@ -0,0 +1,265 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basemulconstaddto_c_f32_avx512_amd64.c
+
+TEXT ·mulconstaddto_c_f32_avx512(SB), $0-32
+	MOVQ dst+0(FP), DI
+	MOVQ pa+8(FP), SI
+	MOVQ x+16(FP), DX
+	MOVQ plen_dst+24(FP), CX
+	WORD $0x8b4c; BYTE $0x01       // movq	(%rcx), %r8
+	WORD $0x854d; BYTE $0xc0       // testq	%r8, %r8
+	JE   BB0_51
+	LONG $0x1610fac5               // vmovss	(%rsi), %xmm2
+	LONG $0x487df262; WORD $0xca18 // vbroadcastss	%xmm2, %zmm1
+	LONG $0x0ff88349               // cmpq	$15, %r8
+	JLE  BB0_11
+	LONG $0x000010b8; BYTE $0x00   // movl	$16, %eax
+
+BB0_4:
+	QUAD $0xff824410487cf162 // vmovups	-64(%rdx,%rax,4), %zmm0
+	QUAD $0xff8744a84875f262 // vfmadd213ps	-64(%rdi,%rax,4), %zmm1, %zmm0
+	QUAD $0xff874411487cf162 // vmovups	%zmm0, -64(%rdi,%rax,4)
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x394c; BYTE $0xc0 // cmpq	%r8, %rax
+	JLE  BB0_4
+	LONG $0xf0408d49         // leaq	-16(%r8), %rax
+	LONG $0xf0e08348         // andq	$-16, %rax
+	LONG $0x10c08348         // addq	$16, %rax
+
+BB0_3:
+	WORD $0x3949; BYTE $0xc0     // cmpq	%rax, %r8
+	JLE  BB0_25
+	WORD $0x894d; BYTE $0xc1     // movq	%r8, %r9
+	WORD $0x8948; BYTE $0xc6     // movq	%rax, %rsi
+	QUAD $0x00000000850c8d48     // leaq	0(,%rax,4), %rcx
+	WORD $0x2949; BYTE $0xc1     // subq	%rax, %r9
+	LONG $0xff598d4d             // leaq	-1(%r9), %r11
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x06fb8349             // cmpq	$6, %r11
+	JBE  BB0_5
+	QUAD $0x00000000850c8d48     // leaq	0(,%rax,4), %rcx
+	LONG $0x0f148d4c             // leaq	(%rdi,%rcx), %r10
+	LONG $0x0a648d4c; BYTE $0x04 // leaq	4(%rdx,%rcx), %r12
+	WORD $0x894c; BYTE $0xd3     // movq	%r10, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x38fb8348             // cmpq	$56, %rbx
+	JA   BB0_55
+
+BB0_5:
+	LONG $0x0f348d48                           // leaq	(%rdi,%rcx), %rsi
+	LONG $0x0410fac5; BYTE $0x82               // vmovss	(%rdx,%rax,4), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x01708d48                           // leaq	1(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x04               // leaq	4(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x040a             // vmovss	4(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x02708d48                           // leaq	2(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x08               // leaq	8(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x080a             // vmovss	8(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x03708d48                           // leaq	3(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x0c               // leaq	12(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x0c0a             // vmovss	12(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x04708d48                           // leaq	4(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x10               // leaq	16(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x100a             // vmovss	16(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x05708d48                           // leaq	5(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x14               // leaq	20(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x140a             // vmovss	20(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x06708d48                           // leaq	6(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x18               // leaq	24(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x180a             // vmovss	24(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x07708d48                           // leaq	7(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x1c               // leaq	28(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x1c0a             // vmovss	28(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x08708d48                           // leaq	8(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x20               // leaq	32(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x200a             // vmovss	32(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x09708d48                           // leaq	9(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x24               // leaq	36(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x240a             // vmovss	36(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x0a708d48                           // leaq	10(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x28               // leaq	40(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x280a             // vmovss	40(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x0b708d48                           // leaq	11(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x2c               // leaq	44(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x2c0a             // vmovss	44(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x0c708d48                           // leaq	12(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x30               // leaq	48(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x300a             // vmovss	48(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x0d708d48                           // leaq	13(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x34               // leaq	52(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x340a             // vmovss	52(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x0e708d48                           // leaq	14(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x38               // leaq	56(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x380a             // vmovss	56(%rdx,%rcx), %xmm0
+	LONG $0x0fc08348                           // addq	$15, %rax
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	WORD $0x3949; BYTE $0xc0                   // cmpq	%rax, %r8
+	JLE  BB0_48
+	LONG $0x0f448d48; BYTE $0x3c               // leaq	60(%rdi,%rcx), %rax
+	LONG $0x3010fac5                           // vmovss	(%rax), %xmm6
+	LONG $0x9949e2c4; WORD $0x0a54; BYTE $0x3c // vfmadd132ss	60(%rdx,%rcx), %xmm6, %xmm2
+	LONG $0x1011fac5                           // vmovss	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	JMP  BB0_49
+
+BB0_55:
+	LONG $0x0efb8349                           // cmpq	$14, %r11
+	JBE  BB0_12
+	LONG $0x487cd162; WORD $0x2210             // vmovups	(%r10), %zmm4
+	LONG $0x485df262; WORD $0x0c98; BYTE $0x0a // vfmadd132ps	(%rdx,%rcx), %zmm4, %zmm1
+	WORD $0x894c; BYTE $0xc9                   // movq	%r9, %rcx
+	LONG $0xf0e18348                           // andq	$-16, %rcx
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x487cd162; WORD $0x0a11             // vmovups	%zmm1, (%r10)
+	LONG $0x0fc1f641                           // testb	$15, %r9b
+	JE   BB0_48
+	WORD $0x2949; BYTE $0xc9                   // subq	%rcx, %r9
+	LONG $0xff518d4d                           // leaq	-1(%r9), %r10
+	LONG $0x06fa8349                           // cmpq	$6, %r10
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x0148; BYTE $0xf1       // addq	%rsi, %rcx
+	LONG $0x187de2c4; BYTE $0xc2   // vbroadcastss	%xmm2, %ymm0
+	LONG $0x8f348d48               // leaq	(%rdi,%rcx,4), %rsi
+	LONG $0x1e10fcc5               // vmovups	(%rsi), %ymm3
+	LONG $0x9865e2c4; WORD $0x8a04 // vfmadd132ps	(%rdx,%rcx,4), %ymm3, %ymm0
+	WORD $0x894c; BYTE $0xc9       // movq	%r9, %rcx
+	LONG $0xf8e18348               // andq	$-8, %rcx
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	LONG $0x07e18341               // andl	$7, %r9d
+	LONG $0x0611fcc5               // vmovups	%ymm0, (%rsi)
+	JE   BB0_48
+
+BB0_8:
+	QUAD $0x00000000850c8d48                   // leaq	0(,%rax,4), %rcx
+	LONG $0x0410fac5; BYTE $0x82               // vmovss	(%rdx,%rax,4), %xmm0
+	LONG $0x0f348d48                           // leaq	(%rdi,%rcx), %rsi
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x01708d48                           // leaq	1(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x04               // leaq	4(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x040a             // vmovss	4(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x02708d48                           // leaq	2(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x08               // leaq	8(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x080a             // vmovss	8(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x03708d48                           // leaq	3(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x0c               // leaq	12(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x0c0a             // vmovss	12(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x04708d48                           // leaq	4(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x10               // leaq	16(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x100a             // vmovss	16(%rdx,%rcx), %xmm0
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	LONG $0x05708d48                           // leaq	5(%rax), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_48
+	LONG $0x0f748d48; BYTE $0x14               // leaq	20(%rdi,%rcx), %rsi
+	LONG $0x4410fac5; WORD $0x140a             // vmovss	20(%rdx,%rcx), %xmm0
+	LONG $0x06c08348                           // addq	$6, %rax
+	LONG $0xa969e2c4; BYTE $0x06               // vfmadd213ss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5                           // vmovss	%xmm0, (%rsi)
+	WORD $0x3949; BYTE $0xc0                   // cmpq	%rax, %r8
+	JLE  BB0_48
+	LONG $0x0f448d48; BYTE $0x18               // leaq	24(%rdi,%rcx), %rax
+	LONG $0x2810fac5                           // vmovss	(%rax), %xmm5
+	LONG $0x9951e2c4; WORD $0x0a54; BYTE $0x18 // vfmadd132ss	24(%rdx,%rcx), %xmm5, %xmm2
+	LONG $0x1011fac5                           // vmovss	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_48:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_49:
+	RET
+
+BB0_51:
+	RET
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_6
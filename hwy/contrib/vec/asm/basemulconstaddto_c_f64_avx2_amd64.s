@@ -0,0 +1,134 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basemulconstaddto_c_f64_avx2_amd64.c
+
+TEXT ·mulconstaddto_c_f64_avx2(SB), $0-32
+	MOVQ dst+0(FP), DI
+	MOVQ pa+8(FP), SI
+	MOVQ x+16(FP), DX
+	MOVQ plen_dst+24(FP), CX
+	WORD $0x8b48; BYTE $0x09     // movq	(%rcx), %rcx
+	WORD $0x8548; BYTE $0xc9     // testq	%rcx, %rcx
+	JE   BB0_37
+	LONG $0x1610fbc5             // vmovsd	(%rsi), %xmm2
+	LONG $0x197de2c4; BYTE $0xca // vbroadcastsd	%xmm2, %ymm1
+	LONG $0x03f98348             // cmpq	$3, %rcx
+	JLE  BB0_11
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+
+BB0_4:
+	LONG $0x4410fdc5; WORD $0xe0c2             // vmovupd	-32(%rdx,%rax,8), %ymm0
+	LONG $0xa8f5e2c4; WORD $0xc744; BYTE $0xe0 // vfmadd213pd	-32(%rdi,%rax,8), %ymm1, %ymm0
+	LONG $0x4411fdc5; WORD $0xe0c7             // vmovupd	%ymm0, -32(%rdi,%rax,8)
+	LONG $0x04c08348                           // addq	$4, %rax
+	WORD $0x3948; BYTE $0xc8                   // cmpq	%rcx, %rax
+	JLE  BB0_4
+	LONG $0xfc418d48                           // leaq	-4(%rcx), %rax
+	LONG $0x02e8c148                           // shrq	$2, %rax
+	QUAD $0x0000000485048d48                   // leaq	4(,%rax,4), %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JLE  BB0_29
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	QUAD $0x00000000c5348d48     // leaq	0(,%rax,8), %rsi
+	WORD $0x2949; BYTE $0xc0     // subq	%rax, %r8
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	WORD $0x8948; BYTE $0xc3     // movq	%rax, %rbx
+	LONG $0x01f88349             // cmpq	$1, %r8
+	JE   BB0_5
+	QUAD $0x00000000c5348d48     // leaq	0(,%rax,8), %rsi
+	LONG $0x370c8d4c             // leaq	(%rdi,%rsi), %r9
+	LONG $0x325c8d4c; BYTE $0x08 // leaq	8(%rdx,%rsi), %r11
+	WORD $0x894d; BYTE $0xca     // movq	%r9, %r10
+	WORD $0x294d; BYTE $0xda     // subq	%r11, %r10
+	LONG $0x10fa8349             // cmpq	$16, %r10
+	JA   BB0_41
+
+BB0_5:
+	LONG $0x37048d4c                           // leaq	(%rdi,%rsi), %r8
+	LONG $0x0410fbc5; BYTE $0xc2               // vmovsd	(%rdx,%rax,8), %xmm0
+	LONG $0xa9e9c2c4; BYTE $0x00               // vfmadd213sd	(%r8), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x00               // vmovsd	%xmm0, (%r8)
+	LONG $0x01408d4c                           // leaq	1(%rax), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_34
+	LONG $0x37448d4c; BYTE $0x08               // leaq	8(%rdi,%rsi), %r8
+	LONG $0x4410fbc5; WORD $0x0832             // vmovsd	8(%rdx,%rsi), %xmm0
+	LONG $0xa9e9c2c4; BYTE $0x00               // vfmadd213sd	(%r8), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x00               // vmovsd	%xmm0, (%r8)
+	LONG $0x02408d4c                           // leaq	2(%rax), %r8
+	WORD $0x394c; BYTE $0xc1                   // cmpq	%r8, %rcx
+	JLE  BB0_34
+	LONG $0x37448d4c; BYTE $0x10               // leaq	16(%rdi,%rsi), %r8
+	LONG $0x4410fbc5; WORD $0x1032             // vmovsd	16(%rdx,%rsi), %xmm0
+	LONG $0x03c08348                           // addq	$3, %rax
+	LONG $0xa9e9c2c4; BYTE $0x00               // vfmadd213sd	(%r8), %xmm2, %xmm0
+	LONG $0x117bc1c4; BYTE $0x00               // vmovsd	%xmm0, (%r8)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_34
+	LONG $0x37448d48; BYTE $0x18               // leaq	24(%rdi,%rsi), %rax
+	LONG $0x3010fbc5                           // vmovsd	(%rax), %xmm6
+	LONG $0x99c9e2c4; WORD $0x3254; BYTE $0x18 // vfmadd132sd	24(%rdx,%rsi), %xmm6, %xmm2
+	LONG $0x1011fbc5                           // vmovsd	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_34:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_37:
+	RET
+
+BB0_41:
+	LONG $0xff488d49               // leaq	-1(%r8), %rcx
+	LONG $0x02f98348               // cmpq	$2, %rcx
+	JBE  BB0_12
+	LONG $0x107dc1c4; BYTE $0x29   // vmovupd	(%r9), %ymm5
+	LONG $0x98d5e2c4; WORD $0x320c // vfmadd132pd	(%rdx,%rsi), %ymm5, %ymm1
+	WORD $0x894c; BYTE $0xc1       // movq	%r8, %rcx
+	LONG $0xfce18348               // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	LONG $0x117dc1c4; BYTE $0x09   // vmovupd	%ymm1, (%r9)
+	LONG $0x03c0f641               // testb	$3, %r8b
+	JE   BB0_34
+	WORD $0x2949; BYTE $0xc8       // subq	%rcx, %r8
+	LONG $0x01f88349               // cmpq	$1, %r8
+	JE   BB0_8
+
+BB0_6:
+	WORD $0x0148; BYTE $0xd9       // addq	%rbx, %rcx
+	LONG $0xc212fbc5               // vmovddup	%xmm2, %xmm0
+	LONG $0xcf348d48               // leaq	(%rdi,%rcx,8), %rsi
+	LONG $0x2610f9c5               // vmovupd	(%rsi), %xmm4
+	LONG $0x98d9e2c4; WORD $0xca04 // vfmadd132pd	(%rdx,%rcx,8), %xmm4, %xmm0
+	LONG $0x0611f9c5               // vmovupd	%xmm0, (%rsi)
+	LONG $0x01c0f641               // testb	$1, %r8b
+	JE   BB0_34
+	LONG $0xfee08349               // andq	$-2, %r8
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+
+BB0_8:
+	LONG $0xc70c8d48               // leaq	(%rdi,%rax,8), %rcx
+	LONG $0x1910fbc5               // vmovsd	(%rcx), %xmm3
+	LONG $0x99e1e2c4; WORD $0xc214 // vfmadd132sd	(%rdx,%rax,8), %xmm3, %xmm2
+	LONG $0x1111fbc5               // vmovsd	%xmm2, (%rcx)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_29:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_6
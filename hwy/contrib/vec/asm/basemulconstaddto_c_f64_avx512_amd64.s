@@ -0,0 +1,180 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basemulconstaddto_c_f64_avx512_amd64.c
+
+TEXT ·mulconstaddto_c_f64_avx512(SB), $0-32
+	MOVQ dst+0(FP), DI
+	MOVQ pa+8(FP), SI
+	MOVQ x+16(FP), DX
+	MOVQ plen_dst+24(FP), CX
+	WORD $0x8b4c; BYTE $0x01       // movq	(%rcx), %r8
+	WORD $0x854d; BYTE $0xc0       // testq	%r8, %r8
+	JE   BB0_39
+	LONG $0x1610fbc5               // vmovsd	(%rsi), %xmm2
+	WORD $0x8949; BYTE $0xd1       // movq	%rdx, %r9
+	LONG $0x48fdf262; WORD $0xca19 // vbroadcastsd	%xmm2, %zmm1
+	LONG $0x07f88349               // cmpq	$7, %r8
+	JLE  BB0_11
+	LONG $0x000008b8; BYTE $0x00   // movl	$8, %eax
+
+BB0_4:
+	QUAD $0xffc1441048fdd162 // vmovupd	-64(%r9,%rax,8), %zmm0
+	QUAD $0xffc744a848f5f262 // vfmadd213pd	-64(%rdi,%rax,8), %zmm1, %zmm0
+	QUAD $0xffc7441148fdf162 // vmovupd	%zmm0, -64(%rdi,%rax,8)
+	LONG $0x08c08348         // addq	$8, %rax
+	WORD $0x394c; BYTE $0xc0 // cmpq	%r8, %rax
+	JLE  BB0_4
+	LONG $0xf8408d49         // leaq	-8(%r8), %rax
+	LONG $0x03e8c148         // shrq	$3, %rax
+	QUAD $0x00000008c5048d48 // leaq	8(,%rax,8), %rax
+
+BB0_3:
+	WORD $0x3949; BYTE $0xc0     // cmpq	%rax, %r8
+	JLE  BB0_25
+	WORD $0x894c; BYTE $0xc6     // movq	%r8, %rsi
+	WORD $0x8948; BYTE $0xc1     // movq	%rax, %rcx
+	QUAD $0x00000000c5148d48     // leaq	0(,%rax,8), %rdx
+	WORD $0x2948; BYTE $0xc6     // subq	%rax, %rsi
+	LONG $0xff5e8d4c             // leaq	-1(%rsi), %r11
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x02fb8349             // cmpq	$2, %r11
+	JBE  BB0_5
+	QUAD $0x00000000c5148d48     // leaq	0(,%rax,8), %rdx
+	LONG $0x17148d4c             // leaq	(%rdi,%rdx), %r10
+	LONG $0x11648d4d; BYTE $0x08 // leaq	8(%r9,%rdx), %r12
+	WORD $0x894c; BYTE $0xd3     // movq	%r10, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x30fb8348             // cmpq	$48, %rbx
+	JA   BB0_43
+
+BB0_5:
+	LONG $0x170c8d48                           // leaq	(%rdi,%rdx), %rcx
+	LONG $0x107bc1c4; WORD $0xc104             // vmovsd	(%r9,%rax,8), %xmm0
+	LONG $0xa9e9e2c4; BYTE $0x01               // vfmadd213sd	(%rcx), %xmm2, %xmm0
+	LONG $0x0111fbc5                           // vmovsd	%xmm0, (%rcx)
+	LONG $0x01488d48                           // leaq	1(%rax), %rcx
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_36
+	LONG $0x174c8d48; BYTE $0x08               // leaq	8(%rdi,%rdx), %rcx
+	LONG $0x107bc1c4; WORD $0x1144; BYTE $0x08 // vmovsd	8(%r9,%rdx), %xmm0
+	LONG $0xa9e9e2c4; BYTE $0x01               // vfmadd213sd	(%rcx), %xmm2, %xmm0
+	LONG $0x0111fbc5                           // vmovsd	%xmm0, (%rcx)
+	LONG $0x02488d48                           // leaq	2(%rax), %rcx
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_36
+	LONG $0x174c8d48; BYTE $0x10               // leaq	16(%rdi,%rdx), %rcx
+	LONG $0x107bc1c4; WORD $0x1144; BYTE $0x10 // vmovsd	16(%r9,%rdx), %xmm0
+	LONG $0xa9e9e2c4; BYTE $0x01               // vfmadd213sd	(%rcx), %xmm2, %xmm0
+	LONG $0x0111fbc5                           // vmovsd	%xmm0, (%rcx)
+	LONG $0x03488d48                           // leaq	3(%rax), %rcx
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_36
+	LONG $0x174c8d48; BYTE $0x18               // leaq	24(%rdi,%rdx), %rcx
+	LONG $0x107bc1c4; WORD $0x1144; BYTE $0x18 // vmovsd	24(%r9,%rdx), %xmm0
+	LONG $0xa9e9e2c4; BYTE $0x01               // vfmadd213sd	(%rcx), %xmm2, %xmm0
+	LONG $0x0111fbc5                           // vmovsd	%xmm0, (%rcx)
+	LONG $0x04488d48                           // leaq	4(%rax), %rcx
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_36
+	LONG $0x174c8d48; BYTE $0x20               // leaq	32(%rdi,%rdx), %rcx
+	LONG $0x107bc1c4; WORD $0x1144; BYTE $0x20 // vmovsd	32(%r9,%rdx), %xmm0
+	LONG $0xa9e9e2c4; BYTE $0x01               // vfmadd213sd	(%rcx), %xmm2, %xmm0
+	LONG $0x0111fbc5                           // vmovsd	%xmm0, (%rcx)
+	LONG $0x05488d48                           // leaq	5(%rax), %rcx
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_36
+	LONG $0x174c8d48; BYTE $0x28               // leaq	40(%rdi,%rdx), %rcx
+	LONG $0x107bc1c4; WORD $0x1144; BYTE $0x28 // vmovsd	40(%r9,%rdx), %xmm0
+	LONG $0xa9e9e2c4; BYTE $0x01               // vfmadd213sd	(%rcx), %xmm2, %xmm0
+	LONG $0x0111fbc5                           // vmovsd	%xmm0, (%rcx)
+	LONG $0x06488d48                           // leaq	6(%rax), %rcx
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_36
+	LONG $0x174c8d48; BYTE $0x30               // leaq	48(%rdi,%rdx), %rcx
+	LONG $0x107bc1c4; WORD $0x1144; BYTE $0x30 // vmovsd	48(%r9,%rdx), %xmm0
+	LONG $0x07c08348                           // addq	$7, %rax
+	LONG $0xa9e9e2c4; BYTE $0x01               // vfmadd213sd	(%rcx), %xmm2, %xmm0
+	LONG $0x0111fbc5                           // vmovsd	%xmm0, (%rcx)
+	WORD $0x3949; BYTE $0xc0                   // cmpq	%rax, %r8
+	JLE  BB0_36
+	LONG $0x17448d48; BYTE $0x38               // leaq	56(%rdi,%rdx), %rax
+	LONG $0x3010fbc5                           // vmovsd	(%rax), %xmm6
+	LONG $0x99c9c2c4; WORD $0x1154; BYTE $0x38 // vfmadd132sd	56(%r9,%rdx), %xmm6, %xmm2
+	LONG $0x1011fbc5                           // vmovsd	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_43:
+	LONG $0x06fb8349                           // cmpq	$6, %r11
+	JBE  BB0_12
+	LONG $0x48fdd162; WORD $0x2210             // vmovupd	(%r10), %zmm4
+	LONG $0x48ddd262; WORD $0x0c98; BYTE $0x11 // vfmadd132pd	(%r9,%rdx), %zmm4, %zmm1
+	WORD $0x8948; BYTE $0xf2                   // movq	%rsi, %rdx
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x48fdd162; WORD $0x0a11             // vmovupd	%zmm1, (%r10)
+	LONG $0x07c6f640                           // testb	$7, %sil
+	JE   BB0_36
+	WORD $0x2948; BYTE $0xd6                   // subq	%rdx, %rsi
+	LONG $0xff568d4c                           // leaq	-1(%rsi), %r10
+	LONG $0x02fa8349                           // cmpq	$2, %r10
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x0148; BYTE $0xca       // addq	%rcx, %rdx
+	LONG $0x197de2c4; BYTE $0xc2   // vbroadcastsd	%xmm2, %ymm0
+	LONG $0xd70c8d48               // leaq	(%rdi,%rdx,8), %rcx
+	LONG $0x1910fdc5               // vmovupd	(%rcx), %ymm3
+	LONG $0x98e5c2c4; WORD $0xd104 // vfmadd132pd	(%r9,%rdx,8), %ymm3, %ymm0
+	WORD $0x8948; BYTE $0xf2       // movq	%rsi, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	WORD $0xe683; BYTE $0x03       // andl	$3, %esi
+	LONG $0x0111fdc5               // vmovupd	%ymm0, (%rcx)
+	JE   BB0_36
+
+BB0_8:
+	QUAD $0x00000000c5148d48                   // leaq	0(,%rax,8), %rdx
+	LONG $0x107bc1c4; WORD $0xc104             // vmovsd	(%r9,%rax,8), %xmm0
+	LONG $0x170c8d48                           // leaq	(%rdi,%rdx), %rcx
+	LONG $0xa9e9e2c4; BYTE $0x01               // vfmadd213sd	(%rcx), %xmm2, %xmm0
+	LONG $0x0111fbc5                           // vmovsd	%xmm0, (%rcx)
+	LONG $0x01488d48                           // leaq	1(%rax), %rcx
+	WORD $0x3949; BYTE $0xc8                   // cmpq	%rcx, %r8
+	JLE  BB0_36
+	LONG $0x174c8d48; BYTE $0x08               // leaq	8(%rdi,%rdx), %rcx
+	LONG $0x107bc1c4; WORD $0x1144; BYTE $0x08 // vmovsd	8(%r9,%rdx), %xmm0
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0xa9e9e2c4; BYTE $0x01               // vfmadd213sd	(%rcx), %xmm2, %xmm0
+	LONG $0x0111fbc5                           // vmovsd	%xmm0, (%rcx)
+	WORD $0x3949; BYTE $0xc0                   // cmpq	%rax, %r8
+	JLE  BB0_36
+	LONG $0x17448d48; BYTE $0x10               // leaq	16(%rdi,%rdx), %rax
+	LONG $0x2810fbc5                           // vmovsd	(%rax), %xmm5
+	LONG $0x99d1c2c4; WORD $0x1154; BYTE $0x10 // vfmadd132sd	16(%r9,%rdx), %xmm5, %xmm2
+	LONG $0x1011fbc5                           // vmovsd	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_36:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_39:
+	RET
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_6
@@ -0,0 +1,170 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basemulto_c_f32_avx2_amd64.c
+
+TEXT ·multo_c_f32_avx2(SB), $0-32
+	MOVQ dst+0(FP), DI
+	MOVQ a+8(FP), SI
+	MOVQ b+16(FP), DX
+	MOVQ plen_dst+24(FP), CX
+	WORD $0x8949; BYTE $0xf8     // movq	%rdi, %r8
+	WORD $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	WORD $0x8b48; BYTE $0x11     // movq	(%rcx), %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_45
+	LONG $0x07fa8348             // cmpq	$7, %rdx
+	JLE  BB0_11
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_4:
+	LONG $0x4c10fcc5; WORD $0xe086             // vmovups	-32(%rsi,%rax,4), %ymm1
+	LONG $0x4459f4c5; WORD $0xe087             // vmulps	-32(%rdi,%rax,4), %ymm1, %ymm0
+	LONG $0x117cc1c4; WORD $0x8044; BYTE $0xe0 // vmovups	%ymm0, -32(%r8,%rax,4)
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JLE  BB0_4
+	LONG $0xf8428d48                           // leaq	-8(%rdx), %rax
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	QUAD $0x00000008c5048d48                   // leaq	8(,%rax,8), %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_31
+	WORD $0x8949; BYTE $0xd1     // movq	%rdx, %r9
+	QUAD $0x00000000850c8d48     // leaq	0(,%rax,4), %rcx
+	WORD $0x2949; BYTE $0xc1     // subq	%rax, %r9
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	WORD $0x8949; BYTE $0xc5     // movq	%rax, %r13
+	LONG $0xff598d49             // leaq	-1(%r9), %rbx
+	LONG $0x02fb8348             // cmpq	$2, %rbx
+	JBE  BB0_5
+	QUAD $0x00000000850c8d48     // leaq	0(,%rax,4), %rcx
+	LONG $0x081c8d4d             // leaq	(%r8,%rcx), %r11
+	LONG $0x04518d4c             // leaq	4(%rcx), %r10
+	LONG $0x16348d4e             // leaq	(%rsi,%r10), %r14
+	WORD $0x894d; BYTE $0xdc     // movq	%r11, %r12
+	WORD $0x294d; BYTE $0xf4     // subq	%r14, %r12
+	LONG $0x18fc8349             // cmpq	$24, %r12
+	JBE  BB0_5
+	WORD $0x0149; BYTE $0xfa     // addq	%rdi, %r10
+	WORD $0x894d; BYTE $0xdc     // movq	%r11, %r12
+	WORD $0x294d; BYTE $0xd4     // subq	%r10, %r12
+	LONG $0x18fc8349             // cmpq	$24, %r12
+	JBE  BB0_5
+	LONG $0x06fb8348             // cmpq	$6, %rbx
+	JBE  BB0_12
+	LONG $0x1c10fcc5; BYTE $0x0e // vmovups	(%rsi,%rcx), %ymm3
+	LONG $0x0459e4c5; BYTE $0x0f // vmulps	(%rdi,%rcx), %ymm3, %ymm0
+	WORD $0x894c; BYTE $0xc9     // movq	%r9, %rcx
+	LONG $0xf8e18348             // andq	$-8, %rcx
+	WORD $0x0148; BYTE $0xc8     // addq	%rcx, %rax
+	LONG $0x117cc1c4; BYTE $0x03 // vmovups	%ymm0, (%r11)
+	LONG $0x07c1f641             // testb	$7, %r9b
+	JE   BB0_42
+	WORD $0x2949; BYTE $0xc9     // subq	%rcx, %r9
+	LONG $0xff518d4d             // leaq	-1(%r9), %r10
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x014c; BYTE $0xe9       // addq	%r13, %rcx
+	LONG $0x1410f8c5; BYTE $0x8e   // vmovups	(%rsi,%rcx,4), %xmm2
+	LONG $0x0459e8c5; BYTE $0x8f   // vmulps	(%rdi,%rcx,4), %xmm2, %xmm0
+	LONG $0x1178c1c4; WORD $0x8804 // vmovups	%xmm0, (%r8,%rcx,4)
+	WORD $0x894c; BYTE $0xc9       // movq	%r9, %rcx
+	LONG $0xfce18348               // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	LONG $0x03e18341               // andl	$3, %r9d
+	JE   BB0_42
+
+BB0_8:
+	LONG $0x0410fac5; BYTE $0x86               // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x0459fac5; BYTE $0x87               // vmulss	(%rdi,%rax,4), %xmm0, %xmm0
+	LONG $0x01488d4c                           // leaq	1(%rax), %r9
+	QUAD $0x00000000850c8d48                   // leaq	0(,%rax,4), %rcx
+	LONG $0x117ac1c4; WORD $0x8004             // vmovss	%xmm0, (%r8,%rax,4)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_42
+	LONG $0x4410fac5; WORD $0x040e             // vmovss	4(%rsi,%rcx), %xmm0
+	LONG $0x4459fac5; WORD $0x040f             // vmulss	4(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x04 // vmovss	%xmm0, 4(%r8,%rcx)
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_42
+	LONG $0x4410fac5; WORD $0x080e             // vmovss	8(%rsi,%rcx), %xmm0
+	LONG $0x4459fac5; WORD $0x080f             // vmulss	8(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x08 // vmovss	%xmm0, 8(%r8,%rcx)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_5:
+	LONG $0x0410fac5; BYTE $0x86               // vmovss	(%rsi,%rax,4), %xmm0
+	LONG $0x0459fac5; BYTE $0x87               // vmulss	(%rdi,%rax,4), %xmm0, %xmm0
+	LONG $0x01488d4c                           // leaq	1(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x8004             // vmovss	%xmm0, (%r8,%rax,4)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_42
+	LONG $0x4410fac5; WORD $0x040e             // vmovss	4(%rsi,%rcx), %xmm0
+	LONG $0x4459fac5; WORD $0x040f             // vmulss	4(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x02488d4c                           // leaq	2(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x04 // vmovss	%xmm0, 4(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_42
+	LONG $0x4410fac5; WORD $0x080f             // vmovss	8(%rdi,%rcx), %xmm0
+	LONG $0x4459fac5; WORD $0x080e             // vmulss	8(%rsi,%rcx), %xmm0, %xmm0
+	LONG $0x03488d4c                           // leaq	3(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x08 // vmovss	%xmm0, 8(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_42
+	LONG $0x4410fac5; WORD $0x0c0e             // vmovss	12(%rsi,%rcx), %xmm0
+	LONG $0x4459fac5; WORD $0x0c0f             // vmulss	12(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x04488d4c                           // leaq	4(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x0c // vmovss	%xmm0, 12(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_42
+	LONG $0x4410fac5; WORD $0x100e             // vmovss	16(%rsi,%rcx), %xmm0
+	LONG $0x4459fac5; WORD $0x100f             // vmulss	16(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x05488d4c                           // leaq	5(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x10 // vmovss	%xmm0, 16(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_42
+	LONG $0x4410fac5; WORD $0x140e             // vmovss	20(%rsi,%rcx), %xmm0
+	LONG $0x4459fac5; WORD $0x140f             // vmulss	20(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x06488d4c                           // leaq	6(%rax), %r9
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x14 // vmovss	%xmm0, 20(%r8,%rcx)
+	WORD $0x394c; BYTE $0xca                   // cmpq	%r9, %rdx
+	JLE  BB0_42
+	LONG $0x4410fac5; WORD $0x180e             // vmovss	24(%rsi,%rcx), %xmm0
+	LONG $0x4459fac5; WORD $0x180f             // vmulss	24(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x07c08348                           // addq	$7, %rax
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x18 // vmovss	%xmm0, 24(%r8,%rcx)
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_42
+	LONG $0x4410fac5; WORD $0x1c0e             // vmovss	28(%rsi,%rcx), %xmm0
+	LONG $0x4459fac5; WORD $0x1c0f             // vmulss	28(%rdi,%rcx), %xmm0, %xmm0
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x1c // vmovss	%xmm0, 28(%r8,%rcx)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_42:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_45:
+	RET
+
+BB0_31:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_6
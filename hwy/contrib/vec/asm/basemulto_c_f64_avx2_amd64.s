@@ -0,0 +1,129 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basemulto_c_f64_avx2_amd64.c
+
+TEXT ·multo_c_f64_avx2(SB), $0-32
+	MOVQ dst+0(FP), DI
+	MOVQ a+8(FP), SI
+	MOVQ b+16(FP), DX
+	MOVQ plen_dst+24(FP), CX
+	WORD $0x8b48; BYTE $0x09     // movq	(%rcx), %rcx
+	WORD $0x8548; BYTE $0xc9     // testq	%rcx, %rcx
+	JE   BB0_43
+	LONG $0x03f98348             // cmpq	$3, %rcx
+	JLE  BB0_11
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+
+BB0_4:
+	LONG $0x4c10fdc5; WORD $0xe0c6 // vmovupd	-32(%rsi,%rax,8), %ymm1
+	LONG $0x4459f5c5; WORD $0xe0c2 // vmulpd	-32(%rdx,%rax,8), %ymm1, %ymm0
+	LONG $0x4411fdc5; WORD $0xe0c7 // vmovupd	%ymm0, -32(%rdi,%rax,8)
+	LONG $0x04c08348               // addq	$4, %rax
+	WORD $0x3948; BYTE $0xc8       // cmpq	%rcx, %rax
+	JLE  BB0_4
+	LONG $0xfc418d48               // leaq	-4(%rcx), %rax
+	LONG $0x02e8c148               // shrq	$2, %rax
+	QUAD $0x0000000485048d48       // leaq	4(,%rax,4), %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_35
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	QUAD $0x00000000c5048d4c       // leaq	0(,%rax,8), %r8
+	WORD $0x2949; BYTE $0xc1       // subq	%rax, %r9
+	WORD $0x8948; BYTE $0xe5       // movq	%rsp, %rbp
+	WORD $0x8949; BYTE $0xc5       // movq	%rax, %r13
+	LONG $0x01f98349               // cmpq	$1, %r9
+	JE   BB0_5
+	QUAD $0x00000000c5048d4c       // leaq	0(,%rax,8), %r8
+	LONG $0x071c8d4e               // leaq	(%rdi,%r8), %r11
+	LONG $0x08508d4d               // leaq	8(%r8), %r10
+	LONG $0x16248d4e               // leaq	(%rsi,%r10), %r12
+	WORD $0x894c; BYTE $0xdb       // movq	%r11, %rbx
+	WORD $0x294c; BYTE $0xe3       // subq	%r12, %rbx
+	LONG $0x10fb8348               // cmpq	$16, %rbx
+	JBE  BB0_5
+	WORD $0x0149; BYTE $0xd2       // addq	%rdx, %r10
+	WORD $0x894c; BYTE $0xdb       // movq	%r11, %rbx
+	WORD $0x294c; BYTE $0xd3       // subq	%r10, %rbx
+	LONG $0x10fb8348               // cmpq	$16, %rbx
+	JBE  BB0_5
+	LONG $0xff498d49               // leaq	-1(%r9), %rcx
+	LONG $0x02f98348               // cmpq	$2, %rcx
+	JBE  BB0_12
+	LONG $0x107da1c4; WORD $0x061c // vmovupd	(%rsi,%r8), %ymm3
+	LONG $0x5965a1c4; WORD $0x0204 // vmulpd	(%rdx,%r8), %ymm3, %ymm0
+	WORD $0x894c; BYTE $0xc9       // movq	%r9, %rcx
+	LONG $0xfce18348               // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	LONG $0x117dc1c4; BYTE $0x03   // vmovupd	%ymm0, (%r11)
+	LONG $0x03c1f641               // testb	$3, %r9b
+	JE   BB0_40
+	WORD $0x2949; BYTE $0xc9       // subq	%rcx, %r9
+	LONG $0x01f98349               // cmpq	$1, %r9
+	JE   BB0_8
+
+BB0_6:
+	WORD $0x014c; BYTE $0xe9     // addq	%r13, %rcx
+	LONG $0x1410f9c5; BYTE $0xce // vmovupd	(%rsi,%rcx,8), %xmm2
+	LONG $0x0459e9c5; BYTE $0xca // vmulpd	(%rdx,%rcx,8), %xmm2, %xmm0
+	LONG $0x0411f9c5; BYTE $0xcf // vmovupd	%xmm0, (%rdi,%rcx,8)
+	LONG $0x01c1f641             // testb	$1, %r9b
+	JE   BB0_40
+	LONG $0xfee18349             // andq	$-2, %r9
+	WORD $0x014c; BYTE $0xc8     // addq	%r9, %rax
+
+BB0_8:
+	LONG $0x0410fbc5; BYTE $0xc6 // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0x0459fbc5; BYTE $0xc2 // vmulsd	(%rdx,%rax,8), %xmm0, %xmm0
+	LONG $0x0411fbc5; BYTE $0xc7 // vmovsd	%xmm0, (%rdi,%rax,8)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_5:
+	LONG $0x0410fbc5; BYTE $0xc6               // vmovsd	(%rsi,%rax,8), %xmm0
+	LONG $0x0459fbc5; BYTE $0xc2               // vmulsd	(%rdx,%rax,8), %xmm0, %xmm0
+	LONG $0x01488d4c                           // leaq	1(%rax), %r9
+	LONG $0x0411fbc5; BYTE $0xc7               // vmovsd	%xmm0, (%rdi,%rax,8)
+	WORD $0x394c; BYTE $0xc9                   // cmpq	%r9, %rcx
+	JLE  BB0_40
+	LONG $0x107ba1c4; WORD $0x0644; BYTE $0x08 // vmovsd	8(%rsi,%r8), %xmm0
+	LONG $0x597ba1c4; WORD $0x0244; BYTE $0x08 // vmulsd	8(%rdx,%r8), %xmm0, %xmm0
+	LONG $0x02488d4c                           // leaq	2(%rax), %r9
+	LONG $0x117ba1c4; WORD $0x0744; BYTE $0x08 // vmovsd	%xmm0, 8(%rdi,%r8)
+	WORD $0x394c; BYTE $0xc9                   // cmpq	%r9, %rcx
+	JLE  BB0_40
+	LONG $0x107ba1c4; WORD $0x0244; BYTE $0x10 // vmovsd	16(%rdx,%r8), %xmm0
+	LONG $0x597ba1c4; WORD $0x0644; BYTE $0x10 // vmulsd	16(%rsi,%r8), %xmm0, %xmm0
+	LONG $0x03c08348                           // addq	$3, %rax
+	LONG $0x117ba1c4; WORD $0x0744; BYTE $0x10 // vmovsd	%xmm0, 16(%rdi,%r8)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_40
+	LONG $0x107ba1c4; WORD $0x0644; BYTE $0x18 // vmovsd	24(%rsi,%r8), %xmm0
+	LONG $0x597ba1c4; WORD $0x0244; BYTE $0x18 // vmulsd	24(%rdx,%r8), %xmm0, %xmm0
+	LONG $0x117ba1c4; WORD $0x0744; BYTE $0x18 // vmovsd	%xmm0, 24(%rdi,%r8)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_40:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_43:
+	RET
+
+BB0_35:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_6
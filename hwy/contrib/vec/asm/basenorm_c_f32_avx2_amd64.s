@@ -0,0 +1,182 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basenorm_c_f32_avx2_amd64.c
+
+TEXT ·norm_c_f32_avx2(SB), $0-24
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x36 // movq	(%rsi), %rsi
+	WORD $0x8948; BYTE $0xf9 // movq	%rdi, %rcx
+	WORD $0x8949; BYTE $0xd1 // movq	%rdx, %r9
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x8548; BYTE $0xf6 // testq	%rsi, %rsi
+	JE   BB0_2
+	LONG $0x1ffe8348         // cmpq	$31, %rsi
+	JLE  BB0_16
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	LONG $0xe07e8d48         // leaq	-32(%rsi), %rdi
+	LONG $0xdb57e0c5         // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0xd328fcc5         // vmovaps	%ymm3, %ymm2
+	LONG $0x05efc148         // shrq	$5, %rdi
+	LONG $0xcb28fcc5         // vmovaps	%ymm3, %ymm1
+	LONG $0xc328fcc5         // vmovaps	%ymm3, %ymm0
+	WORD $0x8948; BYTE $0xfa // movq	%rdi, %rdx
+	LONG $0x07e2c148         // salq	$7, %rdx
+	QUAD $0x0000008011948d48 // leaq	128(%rcx,%rdx), %rdx
+
+BB0_4:
+	LONG $0x2010fcc5             // vmovups	(%rax), %ymm4
+	LONG $0x6810fcc5; BYTE $0x20 // vmovups	32(%rax), %ymm5
+	LONG $0x80e88348             // subq	$-128, %rax
+	LONG $0x7010fcc5; BYTE $0xc0 // vmovups	-64(%rax), %ymm6
+	LONG $0x7810fcc5; BYTE $0xe0 // vmovups	-32(%rax), %ymm7
+	LONG $0xb85de2c4; BYTE $0xc4 // vfmadd231ps	%ymm4, %ymm4, %ymm0
+	LONG $0xb855e2c4; BYTE $0xcd // vfmadd231ps	%ymm5, %ymm5, %ymm1
+	LONG $0xb84de2c4; BYTE $0xd6 // vfmadd231ps	%ymm6, %ymm6, %ymm2
+	LONG $0xb845e2c4; BYTE $0xdf // vfmadd231ps	%ymm7, %ymm7, %ymm3
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JNE  BB0_4
+	LONG $0x01478d48             // leaq	1(%rdi), %rax
+	LONG $0xdb58ecc5             // vaddps	%ymm3, %ymm2, %ymm3
+	LONG $0x05e0c148             // salq	$5, %rax
+	LONG $0x08408d4c             // leaq	8(%rax), %r8
+
+BB0_3:
+	WORD $0x394c; BYTE $0xc6 // cmpq	%r8, %rsi
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xc2 // movq	%r8, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc7     // movq	%rax, %rdi
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	LONG $0x08528d48             // leaq	8(%rdx), %rdx
+	LONG $0x1410fcc5; BYTE $0xb9 // vmovups	(%rcx,%rdi,4), %ymm2
+	LONG $0xb86de2c4; BYTE $0xc2 // vfmadd231ps	%ymm2, %ymm2, %ymm0
+	WORD $0x3948; BYTE $0xd6     // cmpq	%rdx, %rsi
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xc0     // subq	%r8, %rax
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x014c; BYTE $0xc0     // addq	%r8, %rax
+
+BB0_5:
+	LONG $0xc858f4c5               // vaddps	%ymm0, %ymm1, %ymm1
+	LONG $0xcb58f4c5               // vaddps	%ymm3, %ymm1, %ymm1
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_7
+	WORD $0x8948; BYTE $0xf7       // movq	%rsi, %rdi
+	WORD $0x8949; BYTE $0xc2       // movq	%rax, %r10
+	WORD $0x2948; BYTE $0xc7       // subq	%rax, %rdi
+	LONG $0xff578d48               // leaq	-1(%rdi), %rdx
+	LONG $0x06fa8348               // cmpq	$6, %rdx
+	JBE  BB0_17
+	WORD $0x8949; BYTE $0xf8       // movq	%rdi, %r8
+	LONG $0x81148d48               // leaq	(%rcx,%rax,4), %rdx
+	LONG $0x03e8c149               // shrq	$3, %r8
+	LONG $0x05e0c149               // salq	$5, %r8
+	WORD $0x0149; BYTE $0xd0       // addq	%rdx, %r8
+
+BB0_9:
+	LONG $0x2210fcc5               // vmovups	(%rdx), %ymm4
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xcc59dcc5               // vmulps	%ymm4, %ymm4, %ymm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xd1c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0xd858e2c5               // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0x197de3c4; WORD $0x01c9 // vextractf128	$0x1, %ymm1, %xmm1
+	LONG $0xc358fac5               // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc258f2c5               // vaddss	%xmm2, %xmm1, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xfa       // movq	%rdi, %rdx
+	LONG $0xf8e28348               // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x07c7f640               // testb	$7, %dil
+	JE   BB0_7
+
+BB0_8:
+	WORD $0x2948; BYTE $0xd7     // subq	%rdx, %rdi
+	LONG $0xff478d4c             // leaq	-1(%rdi), %r8
+	LONG $0x02f88349             // cmpq	$2, %r8
+	JBE  BB0_12
+	WORD $0x014c; BYTE $0xd2     // addq	%r10, %rdx
+	LONG $0x0c10f8c5; BYTE $0x91 // vmovups	(%rcx,%rdx,4), %xmm1
+	WORD $0x8948; BYTE $0xfa     // movq	%rdi, %rdx
+	LONG $0xfce28348             // andq	$-4, %rdx
+	LONG $0xc959f0c5             // vmulps	%xmm1, %xmm1, %xmm1
+	WORD $0x0148; BYTE $0xd0     // addq	%rdx, %rax
+	WORD $0xe783; BYTE $0x03     // andl	$3, %edi
+	LONG $0xc058f2c5             // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55 // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd058eac5             // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5             // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5             // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5             // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_7
+
+BB0_12:
+	LONG $0x0c10fac5; BYTE $0x81   // vmovss	(%rcx,%rax,4), %xmm1
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	QUAD $0x0000000085148d48       // leaq	0(,%rax,4), %rdx
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xfe       // cmpq	%rdi, %rsi
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x0411 // vmovss	4(%rcx,%rdx), %xmm1
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x0811 // vmovss	8(%rcx,%rdx), %xmm1
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+
+BB0_7:
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0xc12ef8c5 // vucomiss	%xmm1, %xmm0
+	JP   BB0_19
+	JE   BB0_18
+
+BB0_19:
+	LONG $0xc051fac5         // vsqrtss	%xmm0, %xmm0, %xmm0
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_2:
+	LONG $0x117ac1c4; BYTE $0x01 // vmovss	%xmm0, (%r9)
+	RET
+
+BB0_16:
+	LONG $0xdb57e0c5               // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x0008b841; WORD $0x0000 // movl	$8, %r8d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0xcb28fcc5               // vmovaps	%ymm3, %ymm1
+	LONG $0xc328fcc5               // vmovaps	%ymm3, %ymm0
+	JMP  BB0_3
+
+BB0_17:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_8
+
+BB0_18:
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	JMP  BB0_2
@@ -0,0 +1,183 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basenorm_c_f64_avx512_amd64.c
+
+TEXT ·norm_c_f64_avx512(SB), $0-24
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x36       // movq	(%rsi), %rsi
+	WORD $0x8948; BYTE $0xf9       // movq	%rdi, %rcx
+	WORD $0x8949; BYTE $0xd1       // movq	%rdx, %r9
+	LONG $0xc057f9c5               // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x8548; BYTE $0xf6       // testq	%rsi, %rsi
+	JE   BB0_2
+	LONG $0x1ffe8348               // cmpq	$31, %rsi
+	JLE  BB0_16
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xe07e8d48               // leaq	-32(%rsi), %rdi
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	LONG $0x05efc148               // shrq	$5, %rdi
+	LONG $0x48fdf162; WORD $0xd328 // vmovapd	%zmm3, %zmm2
+	LONG $0x48fdf162; WORD $0xcb28 // vmovapd	%zmm3, %zmm1
+	WORD $0x8948; BYTE $0xfa       // movq	%rdi, %rdx
+	LONG $0x48fdf162; WORD $0xc328 // vmovapd	%zmm3, %zmm0
+	LONG $0x08e2c148               // salq	$8, %rdx
+	QUAD $0x0000010011948d48       // leaq	256(%rcx,%rdx), %rdx
+
+BB0_4:
+	LONG $0x48fdf162; WORD $0x2810             // vmovupd	(%rax), %zmm5
+	LONG $0x01000548; WORD $0x0000             // addq	$256, %rax
+	LONG $0x48fdf162; WORD $0x7010; BYTE $0xfd // vmovupd	-192(%rax), %zmm6
+	LONG $0x48fdf162; WORD $0x7810; BYTE $0xfe // vmovupd	-128(%rax), %zmm7
+	LONG $0x48fdf162; WORD $0x6010; BYTE $0xff // vmovupd	-64(%rax), %zmm4
+	LONG $0x48d5f262; WORD $0xc5b8             // vfmadd231pd	%zmm5, %zmm5, %zmm0
+	LONG $0x48cdf262; WORD $0xceb8             // vfmadd231pd	%zmm6, %zmm6, %zmm1
+	LONG $0x48c5f262; WORD $0xd7b8             // vfmadd231pd	%zmm7, %zmm7, %zmm2
+	LONG $0x48ddf262; WORD $0xdcb8             // vfmadd231pd	%zmm4, %zmm4, %zmm3
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JNE  BB0_4
+	LONG $0x01478d48                           // leaq	1(%rdi), %rax
+	LONG $0x48edf162; WORD $0xdb58             // vaddpd	%zmm3, %zmm2, %zmm3
+	LONG $0x05e0c148                           // salq	$5, %rax
+	LONG $0x08408d4c                           // leaq	8(%rax), %r8
+
+BB0_3:
+	WORD $0x394c; BYTE $0xc6 // cmpq	%r8, %rsi
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xc2 // movq	%r8, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc7                   // movq	%rax, %rdi
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x08528d48                           // leaq	8(%rdx), %rdx
+	LONG $0x48fdf162; WORD $0x1410; BYTE $0xf9 // vmovupd	(%rcx,%rdi,8), %zmm2
+	LONG $0x48edf262; WORD $0xc2b8             // vfmadd231pd	%zmm2, %zmm2, %zmm0
+	WORD $0x3948; BYTE $0xd6                   // cmpq	%rdx, %rsi
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xc0                   // subq	%r8, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+
+BB0_5:
+	LONG $0x48f5f162; WORD $0xc858             // vaddpd	%zmm0, %zmm1, %zmm1
+	LONG $0x48f5f162; WORD $0xcb58             // vaddpd	%zmm3, %zmm1, %zmm1
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm1
+	LONG $0xc858f1c5                           // vaddpd	%xmm0, %xmm1, %xmm1
+	LONG $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_7
+	WORD $0x8948; BYTE $0xf7                   // movq	%rsi, %rdi
+	WORD $0x8949; BYTE $0xc2                   // movq	%rax, %r10
+	WORD $0x2948; BYTE $0xc7                   // subq	%rax, %rdi
+	LONG $0xff578d48                           // leaq	-1(%rdi), %rdx
+	LONG $0x06fa8348                           // cmpq	$6, %rdx
+	JBE  BB0_17
+	WORD $0x8949; BYTE $0xf8                   // movq	%rdi, %r8
+	LONG $0xc1148d48                           // leaq	(%rcx,%rax,8), %rdx
+	LONG $0x03e8c149                           // shrq	$3, %r8
+	LONG $0x06e0c149                           // salq	$6, %r8
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+
+BB0_9:
+	LONG $0x48fdf162; WORD $0x2a10             // vmovupd	(%rdx), %zmm5
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x48d5f162; WORD $0xcd59             // vmulpd	%zmm5, %zmm5, %zmm1
+	LONG $0x28f5f362; WORD $0xd103; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm2
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xd915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm3
+	LONG $0xd858e3c5                           // vaddsd	%xmm0, %xmm3, %xmm3
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm0
+	LONG $0x48fdf362; WORD $0xc91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm1
+	LONG $0xc358fbc5                           // vaddsd	%xmm3, %xmm0, %xmm0
+	LONG $0xd058ebc5                           // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm0
+	LONG $0xd258f3c5                           // vaddsd	%xmm2, %xmm1, %xmm2
+	LONG $0xd258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm2
+	LONG $0x28fdf362; WORD $0xc819; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm0
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc2                   // cmpq	%r8, %rdx
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xfa                   // movq	%rdi, %rdx
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x07c7f640                           // testb	$7, %dil
+	JE   BB0_7
+
+BB0_8:
+	WORD $0x2948; BYTE $0xd7                   // subq	%rdx, %rdi
+	LONG $0xff478d4c                           // leaq	-1(%rdi), %r8
+	LONG $0x02f88349                           // cmpq	$2, %r8
+	JBE  BB0_12
+	WORD $0x014c; BYTE $0xd2                   // addq	%r10, %rdx
+	LONG $0x0c10fdc5; BYTE $0xd1               // vmovupd	(%rcx,%rdx,8), %ymm1
+	WORD $0x8948; BYTE $0xfa                   // movq	%rdi, %rdx
+	LONG $0xfce28348                           // andq	$-4, %rdx
+	LONG $0xc959f5c5                           // vmulpd	%ymm1, %ymm1, %ymm1
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0xe783; BYTE $0x03                   // andl	$3, %edi
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xd115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0x28fdf362; WORD $0xca19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm2
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	JE   BB0_7
+
+BB0_12:
+	LONG $0x0c10fbc5; BYTE $0xc1   // vmovsd	(%rcx,%rax,8), %xmm1
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	QUAD $0x00000000c5148d48       // leaq	0(,%rax,8), %rdx
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xfe       // cmpq	%rdi, %rsi
+	JLE  BB0_7
+	LONG $0x4c10fbc5; WORD $0x0811 // vmovsd	8(%rcx,%rdx), %xmm1
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_7
+	LONG $0x4c10fbc5; WORD $0x1011 // vmovsd	16(%rcx,%rdx), %xmm1
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+
+BB0_7:
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc12ef9c5 // vucomisd	%xmm1, %xmm0
+	JP   BB0_19
+	JE   BB0_18
+
+BB0_19:
+	LONG $0xc051fbc5         // vsqrtsd	%xmm0, %xmm0, %xmm0
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_2:
+	LONG $0x117bc1c4; BYTE $0x01 // vmovsd	%xmm0, (%r9)
+	RET
+
+BB0_16:
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	LONG $0x0008b841; WORD $0x0000 // movl	$8, %r8d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x48fdf162; WORD $0xcb28 // vmovapd	%zmm3, %zmm1
+	LONG $0x48fdf162; WORD $0xc328 // vmovapd	%zmm3, %zmm0
+	JMP  BB0_3
+
+BB0_17:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_8
+
+BB0_18:
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	JMP  BB0_2
@@ -0,0 +1,268 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basenormalize_c_f32_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_1<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $4
+
+TEXT ·normalize_c_f32_avx2(SB), $0-16
+	MOVQ dst+0(FP), DI
+	MOVQ plen_dst+8(FP), SI
+	WORD $0x8b48; BYTE $0x0e // movq	(%rsi), %rcx
+	WORD $0x8948; BYTE $0xfa // movq	%rdi, %rdx
+	WORD $0x8548; BYTE $0xc9 // testq	%rcx, %rcx
+	JE   BB0_48
+	LONG $0x1ff98348         // cmpq	$31, %rcx
+	JLE  BB0_22
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	LONG $0xe0798d48         // leaq	-32(%rcx), %rdi
+	LONG $0xdb57e0c5         // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0xd328fcc5         // vmovaps	%ymm3, %ymm2
+	LONG $0x05efc148         // shrq	$5, %rdi
+	LONG $0xcb28fcc5         // vmovaps	%ymm3, %ymm1
+	LONG $0xc328fcc5         // vmovaps	%ymm3, %ymm0
+	WORD $0x8948; BYTE $0xfe // movq	%rdi, %rsi
+	LONG $0x07e6c148         // salq	$7, %rsi
+	QUAD $0x0000008032b48d48 // leaq	128(%rdx,%rsi), %rsi
+
+BB0_4:
+	LONG $0x2010fcc5             // vmovups	(%rax), %ymm4
+	LONG $0x6810fcc5; BYTE $0x20 // vmovups	32(%rax), %ymm5
+	LONG $0x80e88348             // subq	$-128, %rax
+	LONG $0x7010fcc5; BYTE $0xc0 // vmovups	-64(%rax), %ymm6
+	LONG $0x7810fcc5; BYTE $0xe0 // vmovups	-32(%rax), %ymm7
+	LONG $0xb85de2c4; BYTE $0xc4 // vfmadd231ps	%ymm4, %ymm4, %ymm0
+	LONG $0xb855e2c4; BYTE $0xcd // vfmadd231ps	%ymm5, %ymm5, %ymm1
+	LONG $0xb84de2c4; BYTE $0xd6 // vfmadd231ps	%ymm6, %ymm6, %ymm2
+	LONG $0xb845e2c4; BYTE $0xdf // vfmadd231ps	%ymm7, %ymm7, %ymm3
+	WORD $0x3948; BYTE $0xc6     // cmpq	%rax, %rsi
+	JNE  BB0_4
+	LONG $0x01478d48             // leaq	1(%rdi), %rax
+	LONG $0xdb58ecc5             // vaddps	%ymm3, %ymm2, %ymm3
+	LONG $0x05e0c148             // salq	$5, %rax
+	LONG $0x08408d4c             // leaq	8(%rax), %r8
+
+BB0_3:
+	WORD $0x394c; BYTE $0xc1 // cmpq	%r8, %rcx
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xc6 // movq	%r8, %rsi
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc7     // movq	%rax, %rdi
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	LONG $0x08768d48             // leaq	8(%rsi), %rsi
+	LONG $0x1410fcc5; BYTE $0xba // vmovups	(%rdx,%rdi,4), %ymm2
+	LONG $0xb86de2c4; BYTE $0xc2 // vfmadd231ps	%ymm2, %ymm2, %ymm0
+	WORD $0x3948; BYTE $0xf1     // cmpq	%rsi, %rcx
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	WORD $0x294c; BYTE $0xc0     // subq	%r8, %rax
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x014c; BYTE $0xc0     // addq	%r8, %rax
+
+BB0_5:
+	LONG $0xc858f4c5               // vaddps	%ymm0, %ymm1, %ymm1
+	LONG $0xcb58f4c5               // vaddps	%ymm3, %ymm1, %ymm1
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_7
+	WORD $0x8948; BYTE $0xcf       // movq	%rcx, %rdi
+	WORD $0x8949; BYTE $0xc1       // movq	%rax, %r9
+	WORD $0x2948; BYTE $0xc7       // subq	%rax, %rdi
+	LONG $0xff778d48               // leaq	-1(%rdi), %rsi
+	LONG $0x06fe8348               // cmpq	$6, %rsi
+	JBE  BB0_23
+	WORD $0x8949; BYTE $0xf8       // movq	%rdi, %r8
+	LONG $0x82348d48               // leaq	(%rdx,%rax,4), %rsi
+	LONG $0x03e8c149               // shrq	$3, %r8
+	LONG $0x05e0c149               // salq	$5, %r8
+	WORD $0x0149; BYTE $0xf0       // addq	%rsi, %r8
+
+BB0_9:
+	LONG $0x2610fcc5               // vmovups	(%rsi), %ymm4
+	LONG $0x20c68348               // addq	$32, %rsi
+	LONG $0xcc59dcc5               // vmulps	%ymm4, %ymm4, %ymm1
+	LONG $0xc058f2c5               // vaddss	%xmm0, %xmm1, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xd1c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0xd858e2c5               // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0x197de3c4; WORD $0x01c9 // vextractf128	$0x1, %ymm1, %xmm1
+	LONG $0xc358fac5               // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc258f2c5               // vaddss	%xmm2, %xmm1, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xd058eac5               // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc6       // cmpq	%r8, %rsi
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xfe       // movq	%rdi, %rsi
+	LONG $0xf8e68348               // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0x07c7f640               // testb	$7, %dil
+	JE   BB0_7
+
+BB0_8:
+	WORD $0x2948; BYTE $0xf7     // subq	%rsi, %rdi
+	LONG $0xff478d4c             // leaq	-1(%rdi), %r8
+	LONG $0x02f88349             // cmpq	$2, %r8
+	JBE  BB0_12
+	WORD $0x014c; BYTE $0xce     // addq	%r9, %rsi
+	LONG $0x0c10f8c5; BYTE $0xb2 // vmovups	(%rdx,%rsi,4), %xmm1
+	WORD $0x8948; BYTE $0xfe     // movq	%rdi, %rsi
+	LONG $0xfce68348             // andq	$-4, %rsi
+	LONG $0xc959f0c5             // vmulps	%xmm1, %xmm1, %xmm1
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	WORD $0xe783; BYTE $0x03     // andl	$3, %edi
+	LONG $0xc158fac5             // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55 // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xc258fac5             // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xd115f0c5             // vunpckhps	%xmm1, %xmm1, %xmm2
+	LONG $0xc9c6f0c5; BYTE $0xff // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5             // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5             // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_7
+
+BB0_12:
+	LONG $0x0c10fac5; BYTE $0x82   // vmovss	(%rdx,%rax,4), %xmm1
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	QUAD $0x0000000085348d48       // leaq	0(,%rax,4), %rsi
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x0432 // vmovss	4(%rdx,%rsi), %xmm1
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x0832 // vmovss	8(%rdx,%rsi), %xmm1
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+
+BB0_7:
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0xc12ef8c5 // vucomiss	%xmm1, %xmm0
+	JP   BB0_25
+	JE   BB0_47
+
+BB0_25:
+	LONG   $0xc05afac5             // vcvtss2sd	%xmm0, %xmm0, %xmm0
+	LONG   $0xc051fbc5             // vsqrtsd	%xmm0, %xmm0, %xmm0
+	VMOVSS CPI0_1<>(SB), X2        // vmovss	.LCPI0_1(%rip), %xmm2
+	LONG   $0xc05afbc5             // vcvtsd2ss	%xmm0, %xmm0, %xmm0
+	LONG   $0xd05eeac5             // vdivss	%xmm0, %xmm2, %xmm2
+	LONG   $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG   $0x07f98348             // cmpq	$7, %rcx
+	JLE    BB0_50
+	LONG   $0xf8718d48             // leaq	-8(%rcx), %rsi
+	WORD   $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	LONG   $0x03eec148             // shrq	$3, %rsi
+	WORD   $0x8948; BYTE $0xf7     // movq	%rsi, %rdi
+	LONG   $0x05e7c148             // salq	$5, %rdi
+	LONG   $0x3a7c8d48; BYTE $0x20 // leaq	32(%rdx,%rdi), %rdi
+
+BB0_18:
+	LONG $0x0059f4c5             // vmulps	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fcc5; BYTE $0xe0 // vmovups	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc7     // cmpq	%rax, %rdi
+	JNE  BB0_18
+	LONG $0x01c68348             // addq	$1, %rsi
+	QUAD $0x00000000f53c8d48     // leaq	0(,%rsi,8), %rdi
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_47
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	WORD $0x8949; BYTE $0xf8     // movq	%rdi, %r8
+	WORD $0x2948; BYTE $0xf8     // subq	%rdi, %rax
+	LONG $0xff488d4c             // leaq	-1(%rax), %r9
+	LONG $0x06f98349             // cmpq	$6, %r9
+	JBE  BB0_24
+	LONG $0x05e6c148             // salq	$5, %rsi
+	WORD $0x0148; BYTE $0xd6     // addq	%rdx, %rsi
+	LONG $0x0e59f4c5             // vmulps	(%rsi), %ymm1, %ymm1
+	LONG $0x0e11fcc5             // vmovups	%ymm1, (%rsi)
+	WORD $0x8948; BYTE $0xc6     // movq	%rax, %rsi
+	LONG $0xf8e68348             // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf7     // addq	%rsi, %rdi
+	WORD $0x07a8                 // testb	$7, %al
+	JE   BB0_47
+
+BB0_17:
+	WORD $0x2948; BYTE $0xf0     // subq	%rsi, %rax
+	LONG $0xff488d4c             // leaq	-1(%rax), %r9
+	LONG $0x02f98349             // cmpq	$2, %r9
+	JBE  BB0_20
+	WORD $0x014c; BYTE $0xc6     // addq	%r8, %rsi
+	LONG $0xc2c6e8c5; BYTE $0x00 // vshufps	$0, %xmm2, %xmm2, %xmm0
+	LONG $0xb2348d48             // leaq	(%rdx,%rsi,4), %rsi
+	LONG $0x0659f8c5             // vmulps	(%rsi), %xmm0, %xmm0
+	LONG $0x0611f8c5             // vmovups	%xmm0, (%rsi)
+	WORD $0x03a8                 // testb	$3, %al
+	JE   BB0_47
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc7     // addq	%rax, %rdi
+
+BB0_20:
+	QUAD $0x00000000bd048d48     // leaq	0(,%rdi,4), %rax
+	LONG $0x02348d48             // leaq	(%rdx,%rax), %rsi
+	LONG $0x0659eac5             // vmulss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5             // vmovss	%xmm0, (%rsi)
+	LONG $0x01778d48             // leaq	1(%rdi), %rsi
+	WORD $0x3948; BYTE $0xf1     // cmpq	%rsi, %rcx
+	JLE  BB0_47
+	LONG $0x02748d48; BYTE $0x04 // leaq	4(%rdx,%rax), %rsi
+	LONG $0x02c78348             // addq	$2, %rdi
+	LONG $0x0659eac5             // vmulss	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fac5             // vmovss	%xmm0, (%rsi)
+	WORD $0x3948; BYTE $0xcf     // cmpq	%rcx, %rdi
+	JGE  BB0_47
+	LONG $0x02448d48; BYTE $0x08 // leaq	8(%rdx,%rax), %rax
+	LONG $0x1059eac5             // vmulss	(%rax), %xmm2, %xmm2
+	LONG $0x1011fac5             // vmovss	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_47:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_48:
+	RET
+
+BB0_22:
+	LONG $0xdb57e0c5               // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x0008b841; WORD $0x0000 // movl	$8, %r8d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0xcb28fcc5               // vmovaps	%ymm3, %ymm1
+	LONG $0xc328fcc5               // vmovaps	%ymm3, %ymm0
+	JMP  BB0_3
+
+BB0_50:
+	WORD $0x8548; BYTE $0xc9 // testq	%rcx, %rcx
+	JLE  BB0_47
+	WORD $0x8948; BYTE $0xc8 // movq	%rcx, %rax
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	WORD $0xf631             // xorl	%esi, %esi
+	WORD $0xff31             // xorl	%edi, %edi
+	JMP  BB0_17
+
+BB0_23:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_8
+
+BB0_24:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_17
@@ -0,0 +1,342 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basenormalize_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_1<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $4
+
+TEXT ·normalize_c_f32_avx512(SB), $0-16
+	MOVQ dst+0(FP), DI
+	MOVQ plen_dst+8(FP), SI
+	WORD $0x8b48; BYTE $0x0e       // movq	(%rsi), %rcx
+	WORD $0x8948; BYTE $0xfa       // movq	%rdi, %rdx
+	WORD $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JE   BB0_52
+	LONG $0x3ff98348               // cmpq	$63, %rcx
+	JLE  BB0_22
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xc0798d48               // leaq	-64(%rcx), %rdi
+	LONG $0xdb57e0c5               // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x06efc148               // shrq	$6, %rdi
+	LONG $0x487cf162; WORD $0xd328 // vmovaps	%zmm3, %zmm2
+	LONG $0x487cf162; WORD $0xcb28 // vmovaps	%zmm3, %zmm1
+	WORD $0x8948; BYTE $0xfe       // movq	%rdi, %rsi
+	LONG $0x487cf162; WORD $0xc328 // vmovaps	%zmm3, %zmm0
+	LONG $0x08e6c148               // salq	$8, %rsi
+	QUAD $0x0000010032b48d48       // leaq	256(%rdx,%rsi), %rsi
+
+BB0_4:
+	LONG $0x487cf162; WORD $0x2810             // vmovups	(%rax), %zmm5
+	LONG $0x487cf162; WORD $0x7010; BYTE $0x01 // vmovups	64(%rax), %zmm6
+	LONG $0x01000548; WORD $0x0000             // addq	$256, %rax
+	LONG $0x487cf162; WORD $0x7810; BYTE $0xfe // vmovups	-128(%rax), %zmm7
+	LONG $0x4855f262; WORD $0xc5b8             // vfmadd231ps	%zmm5, %zmm5, %zmm0
+	LONG $0x487cf162; WORD $0x6810; BYTE $0xff // vmovups	-64(%rax), %zmm5
+	LONG $0x484df262; WORD $0xceb8             // vfmadd231ps	%zmm6, %zmm6, %zmm1
+	LONG $0x4845f262; WORD $0xd7b8             // vfmadd231ps	%zmm7, %zmm7, %zmm2
+	LONG $0x4855f262; WORD $0xddb8             // vfmadd231ps	%zmm5, %zmm5, %zmm3
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JNE  BB0_4
+	LONG $0x01478d48                           // leaq	1(%rdi), %rax
+	LONG $0x486cf162; WORD $0xdb58             // vaddps	%zmm3, %zmm2, %zmm3
+	LONG $0x06e0c148                           // salq	$6, %rax
+	LONG $0x10408d4c                           // leaq	16(%rax), %r8
+
+BB0_3:
+	WORD $0x394c; BYTE $0xc1 // cmpq	%r8, %rcx
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xc6 // movq	%r8, %rsi
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc7                   // movq	%rax, %rdi
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0x10768d48                           // leaq	16(%rsi), %rsi
+	LONG $0x487cf162; WORD $0x1410; BYTE $0xba // vmovups	(%rdx,%rdi,4), %zmm2
+	LONG $0x486df262; WORD $0xc2b8             // vfmadd231ps	%zmm2, %zmm2, %zmm0
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	WORD $0x294c; BYTE $0xc0                   // subq	%r8, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+
+BB0_5:
+	LONG $0x4874f162; WORD $0xc858             // vaddps	%zmm0, %zmm1, %zmm1
+	LONG $0x4874f162; WORD $0xcb58             // vaddps	%zmm3, %zmm1, %zmm1
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc158fcc5                           // vaddps	%ymm1, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc128f8c5                           // vmovaps	%xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_7
+	WORD $0x8948; BYTE $0xcf                   // movq	%rcx, %rdi
+	WORD $0x8949; BYTE $0xc1                   // movq	%rax, %r9
+	WORD $0x2948; BYTE $0xc7                   // subq	%rax, %rdi
+	LONG $0xff778d48                           // leaq	-1(%rdi), %rsi
+	LONG $0x0efe8348                           // cmpq	$14, %rsi
+	JBE  BB0_23
+	WORD $0x8949; BYTE $0xf8                   // movq	%rdi, %r8
+	LONG $0x82348d48                           // leaq	(%rdx,%rax,4), %rsi
+	LONG $0x04e8c149                           // shrq	$4, %r8
+	LONG $0x06e0c149                           // salq	$6, %r8
+	WORD $0x0149; BYTE $0xf0                   // addq	%rsi, %r8
+
+BB0_9:
+	LONG $0x487cf162; WORD $0x3610             // vmovups	(%rsi), %zmm6
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0x484cf162; WORD $0xce59             // vmulps	%zmm6, %zmm6, %zmm1
+	LONG $0xe1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm4
+	LONG $0xd9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm3
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm2
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xe115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm4
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xcb19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm3
+	LONG $0x487df362; WORD $0xc91b; BYTE $0x01 // vextractf32x8	$0x1, %zmm1, %ymm1
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm2
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc6                   // cmpq	%r8, %rsi
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xfe                   // movq	%rdi, %rsi
+	LONG $0xf0e68348                           // andq	$-16, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x0fc7f640                           // testb	$15, %dil
+	JE   BB0_7
+
+BB0_8:
+	WORD $0x2948; BYTE $0xf7                   // subq	%rsi, %rdi
+	LONG $0xff478d4c                           // leaq	-1(%rdi), %r8
+	LONG $0x06f88349                           // cmpq	$6, %r8
+	JBE  BB0_12
+	WORD $0x014c; BYTE $0xce                   // addq	%r9, %rsi
+	LONG $0x0c10fcc5; BYTE $0xb2               // vmovups	(%rdx,%rsi,4), %ymm1
+	WORD $0x8948; BYTE $0xfe                   // movq	%rdi, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	LONG $0xc959f4c5                           // vmulps	%ymm1, %ymm1, %ymm1
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	WORD $0xe783; BYTE $0x07                   // andl	$7, %edi
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xd1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm2
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_7
+
+BB0_12:
+	LONG $0x0c10fac5; BYTE $0x82   // vmovss	(%rdx,%rax,4), %xmm1
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	QUAD $0x0000000085348d48       // leaq	0(,%rax,4), %rsi
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x0432 // vmovss	4(%rdx,%rsi), %xmm1
+	LONG $0x02788d48               // leaq	2(%rax), %rdi
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x0832 // vmovss	8(%rdx,%rsi), %xmm1
+	LONG $0x03788d48               // leaq	3(%rax), %rdi
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x0c32 // vmovss	12(%rdx,%rsi), %xmm1
+	LONG $0x04788d48               // leaq	4(%rax), %rdi
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x1032 // vmovss	16(%rdx,%rsi), %xmm1
+	LONG $0x05788d48               // leaq	5(%rax), %rdi
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x1432 // vmovss	20(%rdx,%rsi), %xmm1
+	LONG $0x06c08348               // addq	$6, %rax
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x1832 // vmovss	24(%rdx,%rsi), %xmm1
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+
+BB0_7:
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0xc12ef8c5 // vucomiss	%xmm1, %xmm0
+	JP   BB0_25
+	JE   BB0_51
+
+BB0_25:
+	VMOVSS CPI0_1<>(SB), X2          // vmovss	.LCPI0_1(%rip), %xmm2
+	LONG   $0xc05afac5               // vcvtss2sd	%xmm0, %xmm0, %xmm0
+	LONG   $0xc051fbc5               // vsqrtsd	%xmm0, %xmm0, %xmm0
+	LONG   $0xc05afbc5               // vcvtsd2ss	%xmm0, %xmm0, %xmm0
+	LONG   $0xd05eeac5               // vdivss	%xmm0, %xmm2, %xmm2
+	LONG   $0x487df262; WORD $0xca18 // vbroadcastss	%xmm2, %zmm1
+	LONG   $0x0ff98348               // cmpq	$15, %rcx
+	JLE    BB0_54
+	LONG   $0xf0718d48               // leaq	-16(%rcx), %rsi
+	WORD   $0x8948; BYTE $0xd0       // movq	%rdx, %rax
+	LONG   $0x04eec148               // shrq	$4, %rsi
+	WORD   $0x8948; BYTE $0xf7       // movq	%rsi, %rdi
+	LONG   $0x06e7c148               // salq	$6, %rdi
+	LONG   $0x3a7c8d48; BYTE $0x40   // leaq	64(%rdx,%rdi), %rdi
+
+BB0_18:
+	LONG $0x4874f162; WORD $0x0059             // vmulps	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xc7                   // cmpq	%rax, %rdi
+	JNE  BB0_18
+	LONG $0x01c68348                           // addq	$1, %rsi
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0x04e0c148                           // salq	$4, %rax
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_51
+	WORD $0x8948; BYTE $0xcf                   // movq	%rcx, %rdi
+	WORD $0x8949; BYTE $0xc1                   // movq	%rax, %r9
+	WORD $0x2948; BYTE $0xc7                   // subq	%rax, %rdi
+	LONG $0xff478d4c                           // leaq	-1(%rdi), %r8
+	LONG $0x0ef88349                           // cmpq	$14, %r8
+	JBE  BB0_24
+	LONG $0x06e6c148                           // salq	$6, %rsi
+	WORD $0x8949; BYTE $0xf8                   // movq	%rdi, %r8
+	WORD $0x0148; BYTE $0xd6                   // addq	%rdx, %rsi
+	LONG $0xf0e08349                           // andq	$-16, %r8
+	LONG $0x4874f162; WORD $0x0e59             // vmulps	(%rsi), %zmm1, %zmm1
+	WORD $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+	LONG $0x487cf162; WORD $0x0e11             // vmovups	%zmm1, (%rsi)
+	LONG $0x0fc7f640                           // testb	$15, %dil
+	JE   BB0_51
+
+BB0_17:
+	WORD $0x294c; BYTE $0xc7     // subq	%r8, %rdi
+	WORD $0x8948; BYTE $0xfe     // movq	%rdi, %rsi
+	LONG $0xff7f8d48             // leaq	-1(%rdi), %rdi
+	LONG $0x06ff8348             // cmpq	$6, %rdi
+	JBE  BB0_20
+	WORD $0x014d; BYTE $0xc8     // addq	%r9, %r8
+	LONG $0x187de2c4; BYTE $0xc2 // vbroadcastss	%xmm2, %ymm0
+	LONG $0x823c8d4a             // leaq	(%rdx,%r8,4), %rdi
+	LONG $0x0759fcc5             // vmulps	(%rdi), %ymm0, %ymm0
+	LONG $0x0711fcc5             // vmovups	%ymm0, (%rdi)
+	WORD $0x8948; BYTE $0xf7     // movq	%rsi, %rdi
+	LONG $0xf8e78348             // andq	$-8, %rdi
+	WORD $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	WORD $0xe683; BYTE $0x07     // andl	$7, %esi
+	JE   BB0_51
+
+BB0_20:
+	QUAD $0x0000000085348d48     // leaq	0(,%rax,4), %rsi
+	LONG $0x323c8d48             // leaq	(%rdx,%rsi), %rdi
+	LONG $0x0759eac5             // vmulss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x01788d48             // leaq	1(%rax), %rdi
+	WORD $0x3948; BYTE $0xcf     // cmpq	%rcx, %rdi
+	JGE  BB0_51
+	LONG $0x327c8d48; BYTE $0x04 // leaq	4(%rdx,%rsi), %rdi
+	LONG $0x0759eac5             // vmulss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x02788d48             // leaq	2(%rax), %rdi
+	WORD $0x3948; BYTE $0xcf     // cmpq	%rcx, %rdi
+	JGE  BB0_51
+	LONG $0x327c8d48; BYTE $0x08 // leaq	8(%rdx,%rsi), %rdi
+	LONG $0x0759eac5             // vmulss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x03788d48             // leaq	3(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_51
+	LONG $0x327c8d48; BYTE $0x0c // leaq	12(%rdx,%rsi), %rdi
+	LONG $0x0759eac5             // vmulss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x04788d48             // leaq	4(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_51
+	LONG $0x327c8d48; BYTE $0x10 // leaq	16(%rdx,%rsi), %rdi
+	LONG $0x0759eac5             // vmulss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x05788d48             // leaq	5(%rax), %rdi
+	WORD $0x3948; BYTE $0xf9     // cmpq	%rdi, %rcx
+	JLE  BB0_51
+	LONG $0x327c8d48; BYTE $0x14 // leaq	20(%rdx,%rsi), %rdi
+	LONG $0x06c08348             // addq	$6, %rax
+	LONG $0x0759eac5             // vmulss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JLE  BB0_51
+	LONG $0x32448d48; BYTE $0x18 // leaq	24(%rdx,%rsi), %rax
+	LONG $0x1059eac5             // vmulss	(%rax), %xmm2, %xmm2
+	LONG $0x1011fac5             // vmovss	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_51:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_52:
+	RET
+
+BB0_22:
+	LONG $0xdb57e0c5               // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x0010b841; WORD $0x0000 // movl	$16, %r8d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x487cf162; WORD $0xcb28 // vmovaps	%zmm3, %zmm1
+	LONG $0x487cf162; WORD $0xc328 // vmovaps	%zmm3, %zmm0
+	JMP  BB0_3
+
+BB0_54:
+	WORD $0x8548; BYTE $0xc9 // testq	%rcx, %rcx
+	JLE  BB0_51
+	WORD $0x8948; BYTE $0xcf // movq	%rcx, %rdi
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_17
+
+BB0_23:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_8
+
+BB0_24:
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	JMP  BB0_17
@@ -0,0 +1,214 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basenormalize_c_f64_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $8
+
+TEXT ·normalize_c_f64_avx2(SB), $0-16
+	MOVQ dst+0(FP), DI
+	MOVQ plen_dst+8(FP), SI
+	WORD $0x8b48; BYTE $0x16 // movq	(%rsi), %rdx
+	WORD $0x8948; BYTE $0xf9 // movq	%rdi, %rcx
+	WORD $0x8548; BYTE $0xd2 // testq	%rdx, %rdx
+	JE   BB0_43
+	LONG $0x0ffa8348         // cmpq	$15, %rdx
+	JLE  BB0_20
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	LONG $0xf07a8d48         // leaq	-16(%rdx), %rdi
+	LONG $0xdb57e1c5         // vxorpd	%xmm3, %xmm3, %xmm3
+	LONG $0xd328fdc5         // vmovapd	%ymm3, %ymm2
+	LONG $0x04efc148         // shrq	$4, %rdi
+	LONG $0xcb28fdc5         // vmovapd	%ymm3, %ymm1
+	LONG $0xc328fdc5         // vmovapd	%ymm3, %ymm0
+	WORD $0x8948; BYTE $0xfe // movq	%rdi, %rsi
+	LONG $0x07e6c148         // salq	$7, %rsi
+	QUAD $0x0000008031b48d48 // leaq	128(%rcx,%rsi), %rsi
+
+BB0_4:
+	LONG $0x2010fdc5             // vmovupd	(%rax), %ymm4
+	LONG $0x6810fdc5; BYTE $0x20 // vmovupd	32(%rax), %ymm5
+	LONG $0x80e88348             // subq	$-128, %rax
+	LONG $0x7010fdc5; BYTE $0xc0 // vmovupd	-64(%rax), %ymm6
+	LONG $0x7810fdc5; BYTE $0xe0 // vmovupd	-32(%rax), %ymm7
+	LONG $0xb8dde2c4; BYTE $0xc4 // vfmadd231pd	%ymm4, %ymm4, %ymm0
+	LONG $0xb8d5e2c4; BYTE $0xcd // vfmadd231pd	%ymm5, %ymm5, %ymm1
+	LONG $0xb8cde2c4; BYTE $0xd6 // vfmadd231pd	%ymm6, %ymm6, %ymm2
+	LONG $0xb8c5e2c4; BYTE $0xdf // vfmadd231pd	%ymm7, %ymm7, %ymm3
+	WORD $0x3948; BYTE $0xc6     // cmpq	%rax, %rsi
+	JNE  BB0_4
+	LONG $0x01478d48             // leaq	1(%rdi), %rax
+	LONG $0xdb58edc5             // vaddpd	%ymm3, %ymm2, %ymm3
+	LONG $0x04e0c148             // salq	$4, %rax
+	LONG $0x04408d4c             // leaq	4(%rax), %r8
+
+BB0_3:
+	WORD $0x394c; BYTE $0xc2 // cmpq	%r8, %rdx
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xc6 // movq	%r8, %rsi
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc7     // movq	%rax, %rdi
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	LONG $0x04768d48             // leaq	4(%rsi), %rsi
+	LONG $0x1410fdc5; BYTE $0xf9 // vmovupd	(%rcx,%rdi,8), %ymm2
+	LONG $0xb8ede2c4; BYTE $0xc2 // vfmadd231pd	%ymm2, %ymm2, %ymm0
+	WORD $0x3948; BYTE $0xf2     // cmpq	%rsi, %rdx
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	WORD $0x294c; BYTE $0xc0     // subq	%r8, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x014c; BYTE $0xc0     // addq	%r8, %rax
+
+BB0_5:
+	LONG $0xc858f5c5               // vaddpd	%ymm0, %ymm1, %ymm1
+	LONG $0xc358f5c5               // vaddpd	%ymm3, %ymm1, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1 // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc858f1c5               // vaddpd	%xmm0, %xmm1, %xmm1
+	LONG $0xc115f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm0
+	LONG $0xc858f3c5               // vaddsd	%xmm0, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_7
+	WORD $0x8949; BYTE $0xd0       // movq	%rdx, %r8
+	WORD $0x2949; BYTE $0xc0       // subq	%rax, %r8
+	LONG $0xff708d49               // leaq	-1(%r8), %rsi
+	LONG $0x02fe8348               // cmpq	$2, %rsi
+	JBE  BB0_8
+	WORD $0x894c; BYTE $0xc7       // movq	%r8, %rdi
+	LONG $0xc1348d48               // leaq	(%rcx,%rax,8), %rsi
+	LONG $0x02efc148               // shrq	$2, %rdi
+	LONG $0x05e7c148               // salq	$5, %rdi
+	WORD $0x0148; BYTE $0xf7       // addq	%rsi, %rdi
+
+BB0_9:
+	LONG $0x2610fdc5               // vmovupd	(%rsi), %ymm4
+	LONG $0x20c68348               // addq	$32, %rsi
+	LONG $0xc459ddc5               // vmulpd	%ymm4, %ymm4, %ymm0
+	LONG $0xc958fbc5               // vaddsd	%xmm1, %xmm0, %xmm1
+	LONG $0xd015f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm2
+	LONG $0x197de3c4; WORD $0x01c0 // vextractf128	$0x1, %ymm0, %xmm0
+	LONG $0xd158ebc5               // vaddsd	%xmm1, %xmm2, %xmm2
+	LONG $0xca58fbc5               // vaddsd	%xmm2, %xmm0, %xmm1
+	LONG $0xc015f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm0
+	LONG $0xc858f3c5               // vaddsd	%xmm0, %xmm1, %xmm1
+	WORD $0x3948; BYTE $0xf7       // cmpq	%rsi, %rdi
+	JNE  BB0_9
+	LONG $0x03c0f641               // testb	$3, %r8b
+	JE   BB0_7
+	LONG $0xfce08349               // andq	$-4, %r8
+	WORD $0x014c; BYTE $0xc0       // addq	%r8, %rax
+
+BB0_8:
+	LONG $0x0410fbc5; BYTE $0xc1   // vmovsd	(%rcx,%rax,8), %xmm0
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	QUAD $0x00000000c5348d48       // leaq	0(,%rax,8), %rsi
+	LONG $0xb9f9e2c4; BYTE $0xc8   // vfmadd231sd	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xd7       // cmpq	%rdx, %rdi
+	JGE  BB0_7
+	LONG $0x4410fbc5; WORD $0x0831 // vmovsd	8(%rcx,%rsi), %xmm0
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0xb9f9e2c4; BYTE $0xc8   // vfmadd231sd	%xmm0, %xmm0, %xmm1
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_7
+	LONG $0x4410fbc5; WORD $0x1031 // vmovsd	16(%rcx,%rsi), %xmm0
+	LONG $0xb9f9e2c4; BYTE $0xc8   // vfmadd231sd	%xmm0, %xmm0, %xmm1
+
+BB0_7:
+	LONG $0xc057f9c5 // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0xc82ef9c5 // vucomisd	%xmm0, %xmm1
+	JP   BB0_22
+	JE   BB0_42
+
+BB0_22:
+	LONG   $0xc951f3c5             // vsqrtsd	%xmm1, %xmm1, %xmm1
+	VMOVSD CPI0_1<>(SB), X2        // vmovsd	.LCPI0_1(%rip), %xmm2
+	LONG   $0xd15eebc5             // vdivsd	%xmm1, %xmm2, %xmm2
+	LONG   $0x197de2c4; BYTE $0xca // vbroadcastsd	%xmm2, %ymm1
+	LONG   $0x03fa8348             // cmpq	$3, %rdx
+	JLE    BB0_45
+	LONG   $0xfc728d48             // leaq	-4(%rdx), %rsi
+	WORD   $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	LONG   $0x02eec148             // shrq	$2, %rsi
+	WORD   $0x8948; BYTE $0xf7     // movq	%rsi, %rdi
+	LONG   $0x05e7c148             // salq	$5, %rdi
+	LONG   $0x397c8d48; BYTE $0x20 // leaq	32(%rcx,%rdi), %rdi
+
+BB0_16:
+	LONG $0x0059f5c5             // vmulpd	(%rax), %ymm1, %ymm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4011fdc5; BYTE $0xe0 // vmovupd	%ymm0, -32(%rax)
+	WORD $0x3948; BYTE $0xc7     // cmpq	%rax, %rdi
+	JNE  BB0_16
+	LONG $0x01c68348             // addq	$1, %rsi
+	QUAD $0x00000000b5048d48     // leaq	0(,%rsi,4), %rax
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_42
+	WORD $0x2948; BYTE $0xc2     // subq	%rax, %rdx
+	WORD $0x8948; BYTE $0xc7     // movq	%rax, %rdi
+	LONG $0xff428d4c             // leaq	-1(%rdx), %r8
+	LONG $0x02f88349             // cmpq	$2, %r8
+	JBE  BB0_21
+	LONG $0x05e6c148             // salq	$5, %rsi
+	WORD $0x0148; BYTE $0xce     // addq	%rcx, %rsi
+	LONG $0x0e59f5c5             // vmulpd	(%rsi), %ymm1, %ymm1
+	LONG $0x0e11fdc5             // vmovupd	%ymm1, (%rsi)
+	WORD $0x8948; BYTE $0xd6     // movq	%rdx, %rsi
+	LONG $0xfce68348             // andq	$-4, %rsi
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	WORD $0xc2f6; BYTE $0x03     // testb	$3, %dl
+	JE   BB0_42
+
+BB0_15:
+	WORD $0x2948; BYTE $0xf2 // subq	%rsi, %rdx
+	LONG $0x01fa8348         // cmpq	$1, %rdx
+	JE   BB0_18
+	WORD $0x0148; BYTE $0xfe // addq	%rdi, %rsi
+	LONG $0xc212fbc5         // vmovddup	%xmm2, %xmm0
+	LONG $0xf1348d48         // leaq	(%rcx,%rsi,8), %rsi
+	LONG $0x0659f9c5         // vmulpd	(%rsi), %xmm0, %xmm0
+	LONG $0x0611f9c5         // vmovupd	%xmm0, (%rsi)
+	WORD $0xc2f6; BYTE $0x01 // testb	$1, %dl
+	JE   BB0_42
+	LONG $0xfee28348         // andq	$-2, %rdx
+	WORD $0x0148; BYTE $0xd0 // addq	%rdx, %rax
+
+BB0_18:
+	LONG $0xc1048d48         // leaq	(%rcx,%rax,8), %rax
+	LONG $0x1059ebc5         // vmulsd	(%rax), %xmm2, %xmm2
+	LONG $0x1011fbc5         // vmovsd	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_42:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_43:
+	RET
+
+BB0_20:
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	LONG $0x0004b841; WORD $0x0000 // movl	$4, %r8d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0xcb28fdc5               // vmovapd	%ymm3, %ymm1
+	LONG $0xc328fdc5               // vmovapd	%ymm3, %ymm0
+	JMP  BB0_3
+
+BB0_45:
+	WORD $0x8548; BYTE $0xd2 // testq	%rdx, %rdx
+	JLE  BB0_42
+	WORD $0xff31             // xorl	%edi, %edi
+	WORD $0xf631             // xorl	%esi, %esi
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_15
+
+BB0_21:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_15
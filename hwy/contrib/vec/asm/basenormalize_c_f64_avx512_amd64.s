@@ -0,0 +1,268 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basenormalize_c_f64_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $8
+
+TEXT ·normalize_c_f64_avx512(SB), $0-16
+	MOVQ dst+0(FP), DI
+	MOVQ plen_dst+8(FP), SI
+	WORD $0x8b48; BYTE $0x0e       // movq	(%rsi), %rcx
+	WORD $0x8948; BYTE $0xfa       // movq	%rdi, %rdx
+	WORD $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JE   BB0_48
+	LONG $0x1ff98348               // cmpq	$31, %rcx
+	JLE  BB0_22
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xe0798d48               // leaq	-32(%rcx), %rdi
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	LONG $0x05efc148               // shrq	$5, %rdi
+	LONG $0x48fdf162; WORD $0xd328 // vmovapd	%zmm3, %zmm2
+	LONG $0x48fdf162; WORD $0xcb28 // vmovapd	%zmm3, %zmm1
+	WORD $0x8948; BYTE $0xfe       // movq	%rdi, %rsi
+	LONG $0x48fdf162; WORD $0xc328 // vmovapd	%zmm3, %zmm0
+	LONG $0x08e6c148               // salq	$8, %rsi
+	QUAD $0x0000010032b48d48       // leaq	256(%rdx,%rsi), %rsi
+
+BB0_4:
+	LONG $0x48fdf162; WORD $0x2810             // vmovupd	(%rax), %zmm5
+	LONG $0x01000548; WORD $0x0000             // addq	$256, %rax
+	LONG $0x48fdf162; WORD $0x7010; BYTE $0xfd // vmovupd	-192(%rax), %zmm6
+	LONG $0x48fdf162; WORD $0x7810; BYTE $0xfe // vmovupd	-128(%rax), %zmm7
+	LONG $0x48fdf162; WORD $0x6010; BYTE $0xff // vmovupd	-64(%rax), %zmm4
+	LONG $0x48d5f262; WORD $0xc5b8             // vfmadd231pd	%zmm5, %zmm5, %zmm0
+	LONG $0x48cdf262; WORD $0xceb8             // vfmadd231pd	%zmm6, %zmm6, %zmm1
+	LONG $0x48c5f262; WORD $0xd7b8             // vfmadd231pd	%zmm7, %zmm7, %zmm2
+	LONG $0x48ddf262; WORD $0xdcb8             // vfmadd231pd	%zmm4, %zmm4, %zmm3
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JNE  BB0_4
+	LONG $0x01478d48                           // leaq	1(%rdi), %rax
+	LONG $0x48edf162; WORD $0xdb58             // vaddpd	%zmm3, %zmm2, %zmm3
+	LONG $0x05e0c148                           // salq	$5, %rax
+	LONG $0x08408d4c                           // leaq	8(%rax), %r8
+
+BB0_3:
+	WORD $0x394c; BYTE $0xc1 // cmpq	%r8, %rcx
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xc6 // movq	%r8, %rsi
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc7                   // movq	%rax, %rdi
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0x08768d48                           // leaq	8(%rsi), %rsi
+	LONG $0x48fdf162; WORD $0x1410; BYTE $0xfa // vmovupd	(%rdx,%rdi,8), %zmm2
+	LONG $0x48edf262; WORD $0xc2b8             // vfmadd231pd	%zmm2, %zmm2, %zmm0
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	WORD $0x294c; BYTE $0xc0                   // subq	%r8, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+
+BB0_5:
+	LONG $0x48f5f162; WORD $0xc858             // vaddpd	%zmm0, %zmm1, %zmm1
+	LONG $0x48f5f162; WORD $0xcb58             // vaddpd	%zmm3, %zmm1, %zmm1
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm1
+	LONG $0xc858f1c5                           // vaddpd	%xmm0, %xmm1, %xmm1
+	LONG $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_7
+	WORD $0x8948; BYTE $0xcf                   // movq	%rcx, %rdi
+	WORD $0x8949; BYTE $0xc1                   // movq	%rax, %r9
+	WORD $0x2948; BYTE $0xc7                   // subq	%rax, %rdi
+	LONG $0xff778d48                           // leaq	-1(%rdi), %rsi
+	LONG $0x06fe8348                           // cmpq	$6, %rsi
+	JBE  BB0_23
+	WORD $0x8949; BYTE $0xf8                   // movq	%rdi, %r8
+	LONG $0xc2348d48                           // leaq	(%rdx,%rax,8), %rsi
+	LONG $0x03e8c149                           // shrq	$3, %r8
+	LONG $0x06e0c149                           // salq	$6, %r8
+	WORD $0x0149; BYTE $0xf0                   // addq	%rsi, %r8
+
+BB0_9:
+	LONG $0x48fdf162; WORD $0x2e10             // vmovupd	(%rsi), %zmm5
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0x48d5f162; WORD $0xcd59             // vmulpd	%zmm5, %zmm5, %zmm1
+	LONG $0x28f5f362; WORD $0xd103; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm2
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xd915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm3
+	LONG $0xc358fbc5                           // vaddsd	%xmm3, %xmm0, %xmm0
+	LONG $0x28fdf362; WORD $0xcb19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm3
+	LONG $0x48fdf362; WORD $0xc91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm1
+	LONG $0xc358fbc5                           // vaddsd	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xd115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0x28fdf362; WORD $0xca19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm2
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc6                   // cmpq	%r8, %rsi
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xfe                   // movq	%rdi, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x07c7f640                           // testb	$7, %dil
+	JE   BB0_7
+
+BB0_8:
+	WORD $0x2948; BYTE $0xf7                   // subq	%rsi, %rdi
+	LONG $0xff478d4c                           // leaq	-1(%rdi), %r8
+	LONG $0x02f88349                           // cmpq	$2, %r8
+	JBE  BB0_12
+	WORD $0x014c; BYTE $0xce                   // addq	%r9, %rsi
+	LONG $0x0c10fdc5; BYTE $0xf2               // vmovupd	(%rdx,%rsi,8), %ymm1
+	WORD $0x8948; BYTE $0xfe                   // movq	%rdi, %rsi
+	LONG $0xfce68348                           // andq	$-4, %rsi
+	LONG $0xc959f5c5                           // vmulpd	%ymm1, %ymm1, %ymm1
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	WORD $0xe783; BYTE $0x03                   // andl	$3, %edi
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xd115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0x28fdf362; WORD $0xca19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm2
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	JE   BB0_7
+
+BB0_12:
+	LONG $0x0c10fbc5; BYTE $0xc2   // vmovsd	(%rdx,%rax,8), %xmm1
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	QUAD $0x00000000c5348d48       // leaq	0(,%rax,8), %rsi
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xf9       // cmpq	%rdi, %rcx
+	JLE  BB0_7
+	LONG $0x4c10fbc5; WORD $0x0832 // vmovsd	8(%rdx,%rsi), %xmm1
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_7
+	LONG $0x4c10fbc5; WORD $0x1032 // vmovsd	16(%rdx,%rsi), %xmm1
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+
+BB0_7:
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc12ef9c5 // vucomisd	%xmm1, %xmm0
+	JP   BB0_25
+	JE   BB0_47
+
+BB0_25:
+	VMOVSD CPI0_1<>(SB), X2          // vmovsd	.LCPI0_1(%rip), %xmm2
+	LONG   $0xc051fbc5               // vsqrtsd	%xmm0, %xmm0, %xmm0
+	LONG   $0xd05eebc5               // vdivsd	%xmm0, %xmm2, %xmm2
+	LONG   $0x48fdf262; WORD $0xca19 // vbroadcastsd	%xmm2, %zmm1
+	LONG   $0x07f98348               // cmpq	$7, %rcx
+	JLE    BB0_50
+	LONG   $0xf8718d48               // leaq	-8(%rcx), %rsi
+	WORD   $0x8948; BYTE $0xd0       // movq	%rdx, %rax
+	LONG   $0x03eec148               // shrq	$3, %rsi
+	WORD   $0x8948; BYTE $0xf7       // movq	%rsi, %rdi
+	LONG   $0x06e7c148               // salq	$6, %rdi
+	LONG   $0x3a7c8d48; BYTE $0x40   // leaq	64(%rdx,%rdi), %rdi
+
+BB0_18:
+	LONG $0x48f5f162; WORD $0x0059             // vmulpd	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x48fdf162; WORD $0x4011; BYTE $0xff // vmovupd	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xc7                   // cmpq	%rax, %rdi
+	JNE  BB0_18
+	LONG $0x01c68348                           // addq	$1, %rsi
+	QUAD $0x00000000f53c8d48                   // leaq	0(,%rsi,8), %rdi
+	WORD $0x3948; BYTE $0xf9                   // cmpq	%rdi, %rcx
+	JLE  BB0_47
+	WORD $0x8948; BYTE $0xc8                   // movq	%rcx, %rax
+	WORD $0x8949; BYTE $0xf8                   // movq	%rdi, %r8
+	WORD $0x2948; BYTE $0xf8                   // subq	%rdi, %rax
+	LONG $0xff488d4c                           // leaq	-1(%rax), %r9
+	LONG $0x06f98349                           // cmpq	$6, %r9
+	JBE  BB0_24
+	LONG $0x06e6c148                           // salq	$6, %rsi
+	WORD $0x0148; BYTE $0xd6                   // addq	%rdx, %rsi
+	LONG $0x48f5f162; WORD $0x0e59             // vmulpd	(%rsi), %zmm1, %zmm1
+	LONG $0x48fdf162; WORD $0x0e11             // vmovupd	%zmm1, (%rsi)
+	WORD $0x8948; BYTE $0xc6                   // movq	%rax, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf7                   // addq	%rsi, %rdi
+	WORD $0x07a8                               // testb	$7, %al
+	JE   BB0_47
+
+BB0_17:
+	WORD $0x2948; BYTE $0xf0     // subq	%rsi, %rax
+	LONG $0xff488d4c             // leaq	-1(%rax), %r9
+	LONG $0x02f98349             // cmpq	$2, %r9
+	JBE  BB0_20
+	WORD $0x014c; BYTE $0xc6     // addq	%r8, %rsi
+	LONG $0x197de2c4; BYTE $0xc2 // vbroadcastsd	%xmm2, %ymm0
+	LONG $0xf2348d48             // leaq	(%rdx,%rsi,8), %rsi
+	LONG $0x0659fdc5             // vmulpd	(%rsi), %ymm0, %ymm0
+	LONG $0x0611fdc5             // vmovupd	%ymm0, (%rsi)
+	WORD $0x03a8                 // testb	$3, %al
+	JE   BB0_47
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc7     // addq	%rax, %rdi
+
+BB0_20:
+	QUAD $0x00000000fd048d48     // leaq	0(,%rdi,8), %rax
+	LONG $0x02348d48             // leaq	(%rdx,%rax), %rsi
+	LONG $0x0659ebc5             // vmulsd	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fbc5             // vmovsd	%xmm0, (%rsi)
+	LONG $0x01778d48             // leaq	1(%rdi), %rsi
+	WORD $0x3948; BYTE $0xf1     // cmpq	%rsi, %rcx
+	JLE  BB0_47
+	LONG $0x02748d48; BYTE $0x08 // leaq	8(%rdx,%rax), %rsi
+	LONG $0x02c78348             // addq	$2, %rdi
+	LONG $0x0659ebc5             // vmulsd	(%rsi), %xmm2, %xmm0
+	LONG $0x0611fbc5             // vmovsd	%xmm0, (%rsi)
+	WORD $0x3948; BYTE $0xcf     // cmpq	%rcx, %rdi
+	JGE  BB0_47
+	LONG $0x02448d48; BYTE $0x10 // leaq	16(%rdx,%rax), %rax
+	LONG $0x1059ebc5             // vmulsd	(%rax), %xmm2, %xmm2
+	LONG $0x1011fbc5             // vmovsd	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_47:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_48:
+	RET
+
+BB0_22:
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	LONG $0x0008b841; WORD $0x0000 // movl	$8, %r8d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x48fdf162; WORD $0xcb28 // vmovapd	%zmm3, %zmm1
+	LONG $0x48fdf162; WORD $0xc328 // vmovapd	%zmm3, %zmm0
+	JMP  BB0_3
+
+BB0_50:
+	WORD $0x8548; BYTE $0xc9 // testq	%rcx, %rcx
+	JLE  BB0_47
+	WORD $0x8948; BYTE $0xc8 // movq	%rcx, %rax
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	WORD $0xf631             // xorl	%esi, %esi
+	WORD $0xff31             // xorl	%edi, %edi
+	JMP  BB0_17
+
+BB0_23:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_8
+
+BB0_24:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_17
@@ -0,0 +1,349 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basenormalizeto_c_f32_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_1<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $4
+
+TEXT ·normalizeto_c_f32_avx2(SB), $0-24
+	MOVQ dst+0(FP), DI
+	MOVQ src+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b48; BYTE $0x12 // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2 // testq	%rdx, %rdx
+	JE   BB0_65
+	WORD $0x8948; BYTE $0xf1 // movq	%rsi, %rcx
+	LONG $0x1ffa8348         // cmpq	$31, %rdx
+	JLE  BB0_28
+	LONG $0xe0428d4c         // leaq	-32(%rdx), %r8
+	WORD $0x8948; BYTE $0xf0 // movq	%rsi, %rax
+	LONG $0xdb57e0c5         // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0xd328fcc5         // vmovaps	%ymm3, %ymm2
+	LONG $0x05e8c149         // shrq	$5, %r8
+	LONG $0xcb28fcc5         // vmovaps	%ymm3, %ymm1
+	LONG $0xc328fcc5         // vmovaps	%ymm3, %ymm0
+	WORD $0x894c; BYTE $0xc6 // movq	%r8, %rsi
+	LONG $0x07e6c148         // salq	$7, %rsi
+	QUAD $0x0000008031b48d48 // leaq	128(%rcx,%rsi), %rsi
+
+BB0_4:
+	LONG $0x2010fcc5             // vmovups	(%rax), %ymm4
+	LONG $0x6810fcc5; BYTE $0x20 // vmovups	32(%rax), %ymm5
+	LONG $0x80e88348             // subq	$-128, %rax
+	LONG $0x7010fcc5; BYTE $0xc0 // vmovups	-64(%rax), %ymm6
+	LONG $0x7810fcc5; BYTE $0xe0 // vmovups	-32(%rax), %ymm7
+	LONG $0xb85de2c4; BYTE $0xc4 // vfmadd231ps	%ymm4, %ymm4, %ymm0
+	LONG $0xb855e2c4; BYTE $0xcd // vfmadd231ps	%ymm5, %ymm5, %ymm1
+	LONG $0xb84de2c4; BYTE $0xd6 // vfmadd231ps	%ymm6, %ymm6, %ymm2
+	LONG $0xb845e2c4; BYTE $0xdf // vfmadd231ps	%ymm7, %ymm7, %ymm3
+	WORD $0x3948; BYTE $0xf0     // cmpq	%rsi, %rax
+	JNE  BB0_4
+	LONG $0x01408d49             // leaq	1(%r8), %rax
+	LONG $0xdb58ecc5             // vaddps	%ymm3, %ymm2, %ymm3
+	LONG $0x05e0c148             // salq	$5, %rax
+	LONG $0x08488d4c             // leaq	8(%rax), %r9
+
+BB0_3:
+	WORD $0x394c; BYTE $0xca // cmpq	%r9, %rdx
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xce // movq	%r9, %rsi
+
+BB0_6:
+	WORD $0x8949; BYTE $0xc0       // movq	%rax, %r8
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG $0x08768d48               // leaq	8(%rsi), %rsi
+	LONG $0x107ca1c4; WORD $0x8114 // vmovups	(%rcx,%r8,4), %ymm2
+	LONG $0xb86de2c4; BYTE $0xc2   // vfmadd231ps	%ymm2, %ymm2, %ymm0
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xd0       // movq	%rdx, %rax
+	WORD $0x294c; BYTE $0xc8       // subq	%r9, %rax
+	LONG $0xf8e08348               // andq	$-8, %rax
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+
+BB0_5:
+	LONG $0xc858f4c5               // vaddps	%ymm0, %ymm1, %ymm1
+	LONG $0xcb58f4c5               // vaddps	%ymm3, %ymm1, %ymm1
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_7
+	WORD $0x8949; BYTE $0xd0       // movq	%rdx, %r8
+	WORD $0x8949; BYTE $0xc2       // movq	%rax, %r10
+	WORD $0x2949; BYTE $0xc0       // subq	%rax, %r8
+	LONG $0xff708d49               // leaq	-1(%r8), %rsi
+	LONG $0x06fe8348               // cmpq	$6, %rsi
+	JBE  BB0_29
+	WORD $0x894d; BYTE $0xc1       // movq	%r8, %r9
+	LONG $0x81348d48               // leaq	(%rcx,%rax,4), %rsi
+	LONG $0x03e9c149               // shrq	$3, %r9
+	LONG $0x05e1c149               // salq	$5, %r9
+	WORD $0x0149; BYTE $0xf1       // addq	%rsi, %r9
+
+BB0_9:
+	LONG $0x2610fcc5               // vmovups	(%rsi), %ymm4
+	LONG $0x20c68348               // addq	$32, %rsi
+	LONG $0xcc59dcc5               // vmulps	%ymm4, %ymm4, %ymm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xd1c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0xc358fac5               // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd915f0c5               // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0x197de3c4; WORD $0x01c9 // vextractf128	$0x1, %ymm1, %xmm1
+	LONG $0xc358fac5               // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55   // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xd115f0c5               // vunpckhps	%xmm1, %xmm1, %xmm2
+	LONG $0xc9c6f0c5; BYTE $0xff   // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5               // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xce       // cmpq	%r9, %rsi
+	JNE  BB0_9
+	WORD $0x894c; BYTE $0xc6       // movq	%r8, %rsi
+	LONG $0xf8e68348               // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0       // addq	%rsi, %rax
+	LONG $0x07c0f641               // testb	$7, %r8b
+	JE   BB0_7
+
+BB0_8:
+	WORD $0x2949; BYTE $0xf0     // subq	%rsi, %r8
+	LONG $0xff488d4d             // leaq	-1(%r8), %r9
+	LONG $0x02f98349             // cmpq	$2, %r9
+	JBE  BB0_12
+	WORD $0x014c; BYTE $0xd6     // addq	%r10, %rsi
+	LONG $0x0c10f8c5; BYTE $0xb1 // vmovups	(%rcx,%rsi,4), %xmm1
+	WORD $0x894c; BYTE $0xc6     // movq	%r8, %rsi
+	LONG $0xfce68348             // andq	$-4, %rsi
+	LONG $0xc959f0c5             // vmulps	%xmm1, %xmm1, %xmm1
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	LONG $0x03e08341             // andl	$3, %r8d
+	LONG $0xc158fac5             // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0x55 // vshufps	$85, %xmm1, %xmm1, %xmm2
+	LONG $0xc258fac5             // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xd115f0c5             // vunpckhps	%xmm1, %xmm1, %xmm2
+	LONG $0xc9c6f0c5; BYTE $0xff // vshufps	$255, %xmm1, %xmm1, %xmm1
+	LONG $0xc258fac5             // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5             // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_7
+
+BB0_12:
+	LONG $0x0c10fac5; BYTE $0x81   // vmovss	(%rcx,%rax,4), %xmm1
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x0000000085348d48       // leaq	0(,%rax,4), %rsi
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x0431 // vmovss	4(%rcx,%rsi), %xmm1
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x0831 // vmovss	8(%rcx,%rsi), %xmm1
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+
+BB0_7:
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0xc12ef8c5 // vucomiss	%xmm1, %xmm0
+	JP   BB0_14
+	JE   BB0_69
+
+BB0_14:
+	LONG   $0xc05afac5             // vcvtss2sd	%xmm0, %xmm0, %xmm0
+	LONG   $0xc051fbc5             // vsqrtsd	%xmm0, %xmm0, %xmm0
+	VMOVSS CPI0_1<>(SB), X2        // vmovss	.LCPI0_1(%rip), %xmm2
+	LONG   $0xc05afbc5             // vcvtsd2ss	%xmm0, %xmm0, %xmm0
+	LONG   $0xd05eeac5             // vdivss	%xmm0, %xmm2, %xmm2
+	LONG   $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG   $0x07fa8348             // cmpq	$7, %rdx
+	JLE    BB0_30
+	LONG   $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_20:
+	LONG $0x4459f4c5; WORD $0xe081 // vmulps	-32(%rcx,%rax,4), %ymm1, %ymm0
+	LONG $0x4411fcc5; WORD $0xe087 // vmovups	%ymm0, -32(%rdi,%rax,4)
+	LONG $0x08c08348               // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JLE  BB0_20
+	LONG $0xf8428d48               // leaq	-8(%rdx), %rax
+	LONG $0x03e8c148               // shrq	$3, %rax
+	QUAD $0x00000008c5048d48       // leaq	8(,%rax,8), %rax
+
+BB0_19:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_51
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	QUAD $0x0000000085348d48     // leaq	0(,%rax,4), %rsi
+	WORD $0x2949; BYTE $0xc0     // subq	%rax, %r8
+	LONG $0xff508d4d             // leaq	-1(%r8), %r10
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_21
+	QUAD $0x0000000085348d48     // leaq	0(,%rax,4), %rsi
+	LONG $0x371c8d4c             // leaq	(%rdi,%rsi), %r11
+	LONG $0x31648d4c; BYTE $0x04 // leaq	4(%rcx,%rsi), %r12
+	WORD $0x894c; BYTE $0xdb     // movq	%r11, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x18fb8348             // cmpq	$24, %rbx
+	JA   BB0_70
+
+BB0_21:
+	LONG $0x0459eac5; BYTE $0x81   // vmulss	(%rcx,%rax,4), %xmm2, %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	LONG $0x0411fac5; BYTE $0x87   // vmovss	%xmm0, (%rdi,%rax,4)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459eac5; WORD $0x0431 // vmulss	4(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0437 // vmovss	%xmm0, 4(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459eac5; WORD $0x0831 // vmulss	8(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0837 // vmovss	%xmm0, 8(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459eac5; WORD $0x0c31 // vmulss	12(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0c37 // vmovss	%xmm0, 12(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459eac5; WORD $0x1031 // vmulss	16(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1037 // vmovss	%xmm0, 16(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459eac5; WORD $0x1431 // vmulss	20(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x06408d4c               // leaq	6(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1437 // vmovss	%xmm0, 20(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459eac5; WORD $0x1831 // vmulss	24(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x07c08348               // addq	$7, %rax
+	LONG $0x4411fac5; WORD $0x1837 // vmovss	%xmm0, 24(%rdi,%rsi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_62
+	LONG $0x5459eac5; WORD $0x1c31 // vmulss	28(%rcx,%rsi), %xmm2, %xmm2
+	LONG $0x5411fac5; WORD $0x1c37 // vmovss	%xmm2, 28(%rdi,%rsi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	JMP  BB0_63
+
+BB0_62:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_63:
+	RET
+
+BB0_69:
+	LONG $0x04518d48         // leaq	4(%rcx), %rdx
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	WORD $0x2948; BYTE $0xd0 // subq	%rdx, %rax
+	LONG $0x18f88348         // cmpq	$24, %rax
+	JBE  BB0_16
+	LONG $0x2910fcc5         // vmovups	(%rcx), %ymm5
+	LONG $0x2f11fcc5         // vmovups	%ymm5, (%rdi)
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_70:
+	LONG $0x06fa8349             // cmpq	$6, %r10
+	JBE  BB0_31
+	LONG $0x0c59f4c5; BYTE $0x31 // vmulps	(%rcx,%rsi), %ymm1, %ymm1
+	WORD $0x894c; BYTE $0xc6     // movq	%r8, %rsi
+	LONG $0xf8e68348             // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	LONG $0x117cc1c4; BYTE $0x0b // vmovups	%ymm1, (%r11)
+	LONG $0x07c0f641             // testb	$7, %r8b
+	JE   BB0_62
+	WORD $0x2949; BYTE $0xf0     // subq	%rsi, %r8
+	LONG $0xff508d4d             // leaq	-1(%r8), %r10
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_25
+
+BB0_22:
+	WORD $0x014c; BYTE $0xce     // addq	%r9, %rsi
+	LONG $0xc2c6e8c5; BYTE $0x00 // vshufps	$0, %xmm2, %xmm2, %xmm0
+	LONG $0x0459f8c5; BYTE $0xb1 // vmulps	(%rcx,%rsi,4), %xmm0, %xmm0
+	LONG $0x0411f8c5; BYTE $0xb7 // vmovups	%xmm0, (%rdi,%rsi,4)
+	WORD $0x894c; BYTE $0xc6     // movq	%r8, %rsi
+	LONG $0xfce68348             // andq	$-4, %rsi
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	LONG $0x03e08341             // andl	$3, %r8d
+	JE   BB0_62
+
+BB0_25:
+	LONG $0x0459eac5; BYTE $0x81   // vmulss	(%rcx,%rax,4), %xmm2, %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x0000000085348d48       // leaq	0(,%rax,4), %rsi
+	LONG $0x0411fac5; BYTE $0x87   // vmovss	%xmm0, (%rdi,%rax,4)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459eac5; WORD $0x0431 // vmulss	4(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x4411fac5; WORD $0x0437 // vmovss	%xmm0, 4(%rdi,%rsi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_62
+	LONG $0x5459eac5; WORD $0x0831 // vmulss	8(%rcx,%rsi), %xmm2, %xmm2
+	LONG $0x5411fac5; WORD $0x0837 // vmovss	%xmm2, 8(%rdi,%rsi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	JMP  BB0_63
+
+BB0_65:
+	RET
+
+BB0_28:
+	LONG $0xdb57e0c5               // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x0008b941; WORD $0x0000 // movl	$8, %r9d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0xcb28fcc5               // vmovaps	%ymm3, %ymm1
+	LONG $0xc328fcc5               // vmovaps	%ymm3, %ymm0
+	JMP  BB0_3
+
+BB0_51:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_16:
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x4110fac5; BYTE $0x04 // vmovss	4(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x04 // vmovss	%xmm0, 4(%rdi)
+	LONG $0x4110fac5; BYTE $0x08 // vmovss	8(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x08 // vmovss	%xmm0, 8(%rdi)
+	LONG $0x4110fac5; BYTE $0x0c // vmovss	12(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x0c // vmovss	%xmm0, 12(%rdi)
+	LONG $0x4110fac5; BYTE $0x10 // vmovss	16(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x10 // vmovss	%xmm0, 16(%rdi)
+	LONG $0x4110fac5; BYTE $0x14 // vmovss	20(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x14 // vmovss	%xmm0, 20(%rdi)
+	LONG $0x4110fac5; BYTE $0x18 // vmovss	24(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x18 // vmovss	%xmm0, 24(%rdi)
+	LONG $0x4110fac5; BYTE $0x1c // vmovss	28(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x1c // vmovss	%xmm0, 28(%rdi)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_30:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_19
+
+BB0_29:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_8
+
+BB0_31:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_22
@@ -0,0 +1,472 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basenormalizeto_c_f32_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_1<>+0(SB)/4, $0x3f800000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $4
+
+TEXT ·normalizeto_c_f32_avx512(SB), $0-24
+	MOVQ dst+0(FP), DI
+	MOVQ src+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b48; BYTE $0x12       // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2       // testq	%rdx, %rdx
+	JE   BB0_77
+	WORD $0x8948; BYTE $0xf1       // movq	%rsi, %rcx
+	LONG $0x3ffa8348               // cmpq	$63, %rdx
+	JLE  BB0_28
+	LONG $0xc0428d4c               // leaq	-64(%rdx), %r8
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG $0xdb57e0c5               // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x06e8c149               // shrq	$6, %r8
+	LONG $0x487cf162; WORD $0xd328 // vmovaps	%zmm3, %zmm2
+	LONG $0x487cf162; WORD $0xcb28 // vmovaps	%zmm3, %zmm1
+	WORD $0x894c; BYTE $0xc6       // movq	%r8, %rsi
+	LONG $0x487cf162; WORD $0xc328 // vmovaps	%zmm3, %zmm0
+	LONG $0x08e6c148               // salq	$8, %rsi
+	QUAD $0x0000010031b48d48       // leaq	256(%rcx,%rsi), %rsi
+
+BB0_4:
+	LONG $0x487cf162; WORD $0x2810             // vmovups	(%rax), %zmm5
+	LONG $0x487cf162; WORD $0x7010; BYTE $0x01 // vmovups	64(%rax), %zmm6
+	LONG $0x01000548; WORD $0x0000             // addq	$256, %rax
+	LONG $0x487cf162; WORD $0x7810; BYTE $0xfe // vmovups	-128(%rax), %zmm7
+	LONG $0x4855f262; WORD $0xc5b8             // vfmadd231ps	%zmm5, %zmm5, %zmm0
+	LONG $0x487cf162; WORD $0x6810; BYTE $0xff // vmovups	-64(%rax), %zmm5
+	LONG $0x484df262; WORD $0xceb8             // vfmadd231ps	%zmm6, %zmm6, %zmm1
+	LONG $0x4845f262; WORD $0xd7b8             // vfmadd231ps	%zmm7, %zmm7, %zmm2
+	LONG $0x4855f262; WORD $0xddb8             // vfmadd231ps	%zmm5, %zmm5, %zmm3
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JNE  BB0_4
+	LONG $0x01408d49                           // leaq	1(%r8), %rax
+	LONG $0x486cf162; WORD $0xdb58             // vaddps	%zmm3, %zmm2, %zmm3
+	LONG $0x06e0c148                           // salq	$6, %rax
+	LONG $0x10488d4c                           // leaq	16(%rax), %r9
+
+BB0_3:
+	WORD $0x394c; BYTE $0xca // cmpq	%r9, %rdx
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xce // movq	%r9, %rsi
+
+BB0_6:
+	WORD $0x8949; BYTE $0xc0                   // movq	%rax, %r8
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0x10768d48                           // leaq	16(%rsi), %rsi
+	LONG $0x487cb162; WORD $0x1410; BYTE $0x81 // vmovups	(%rcx,%r8,4), %zmm2
+	LONG $0x486df262; WORD $0xc2b8             // vfmadd231ps	%zmm2, %zmm2, %zmm0
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	WORD $0x294c; BYTE $0xc8                   // subq	%r9, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+
+BB0_5:
+	LONG $0x4874f162; WORD $0xc858             // vaddps	%zmm0, %zmm1, %zmm1
+	LONG $0x4874f162; WORD $0xcb58             // vaddps	%zmm3, %zmm1, %zmm1
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc158fcc5                           // vaddps	%ymm1, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc128f8c5                           // vmovaps	%xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_7
+	WORD $0x8949; BYTE $0xd0                   // movq	%rdx, %r8
+	WORD $0x8949; BYTE $0xc2                   // movq	%rax, %r10
+	WORD $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG $0xff708d49                           // leaq	-1(%r8), %rsi
+	LONG $0x0efe8348                           // cmpq	$14, %rsi
+	JBE  BB0_29
+	WORD $0x894d; BYTE $0xc1                   // movq	%r8, %r9
+	LONG $0x81348d48                           // leaq	(%rcx,%rax,4), %rsi
+	LONG $0x04e9c149                           // shrq	$4, %r9
+	LONG $0x06e1c149                           // salq	$6, %r9
+	WORD $0x0149; BYTE $0xf1                   // addq	%rsi, %r9
+
+BB0_9:
+	LONG $0x487cf162; WORD $0x3610             // vmovups	(%rsi), %zmm6
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0x484cf162; WORD $0xce59             // vmulps	%zmm6, %zmm6, %zmm1
+	LONG $0xe1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm4
+	LONG $0xd9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm3
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm2
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xe115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm4
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xcb19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm3
+	LONG $0x487df362; WORD $0xc91b; BYTE $0x01 // vextractf32x8	$0x1, %zmm1, %ymm1
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xd1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm2
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xce                   // cmpq	%r9, %rsi
+	JNE  BB0_9
+	WORD $0x894c; BYTE $0xc6                   // movq	%r8, %rsi
+	LONG $0xf0e68348                           // andq	$-16, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x0fc0f641                           // testb	$15, %r8b
+	JE   BB0_7
+
+BB0_8:
+	WORD $0x2949; BYTE $0xf0                   // subq	%rsi, %r8
+	LONG $0xff488d4d                           // leaq	-1(%r8), %r9
+	LONG $0x06f98349                           // cmpq	$6, %r9
+	JBE  BB0_12
+	WORD $0x014c; BYTE $0xd6                   // addq	%r10, %rsi
+	LONG $0x0c10fcc5; BYTE $0xb1               // vmovups	(%rcx,%rsi,4), %ymm1
+	WORD $0x894c; BYTE $0xc6                   // movq	%r8, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	LONG $0xc959f4c5                           // vmulps	%ymm1, %ymm1, %ymm1
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x07e08341                           // andl	$7, %r8d
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xd1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm2
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_7
+
+BB0_12:
+	LONG $0x0c10fac5; BYTE $0x81   // vmovss	(%rcx,%rax,4), %xmm1
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x0000000085348d48       // leaq	0(,%rax,4), %rsi
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x0431 // vmovss	4(%rcx,%rsi), %xmm1
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x0831 // vmovss	8(%rcx,%rsi), %xmm1
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x0c31 // vmovss	12(%rcx,%rsi), %xmm1
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x1031 // vmovss	16(%rcx,%rsi), %xmm1
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x1431 // vmovss	20(%rcx,%rsi), %xmm1
+	LONG $0x06c08348               // addq	$6, %rax
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_7
+	LONG $0x4c10fac5; WORD $0x1831 // vmovss	24(%rcx,%rsi), %xmm1
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+
+BB0_7:
+	LONG $0xc957f0c5 // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0xc12ef8c5 // vucomiss	%xmm1, %xmm0
+	JP   BB0_14
+	JE   BB0_81
+
+BB0_14:
+	VMOVSS CPI0_1<>(SB), X1          // vmovss	.LCPI0_1(%rip), %xmm1
+	LONG   $0xc05afac5               // vcvtss2sd	%xmm0, %xmm0, %xmm0
+	LONG   $0xc051fbc5               // vsqrtsd	%xmm0, %xmm0, %xmm0
+	LONG   $0xc05afbc5               // vcvtsd2ss	%xmm0, %xmm0, %xmm0
+	LONG   $0xc85ef2c5               // vdivss	%xmm0, %xmm1, %xmm1
+	LONG   $0x487df262; WORD $0xd118 // vbroadcastss	%xmm1, %zmm2
+	LONG   $0x0ffa8348               // cmpq	$15, %rdx
+	JLE    BB0_30
+	LONG   $0x000010b8; BYTE $0x00   // movl	$16, %eax
+
+BB0_20:
+	QUAD $0xff814459486cf162 // vmulps	-64(%rcx,%rax,4), %zmm2, %zmm0
+	QUAD $0xff874411487cf162 // vmovups	%zmm0, -64(%rdi,%rax,4)
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JLE  BB0_20
+	LONG $0xf0428d48         // leaq	-16(%rdx), %rax
+	LONG $0xf0e08348         // andq	$-16, %rax
+	LONG $0x10c08348         // addq	$16, %rax
+
+BB0_19:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_51
+	WORD $0x8949; BYTE $0xd3     // movq	%rdx, %r11
+	WORD $0x8949; BYTE $0xc0     // movq	%rax, %r8
+	QUAD $0x0000000085348d48     // leaq	0(,%rax,4), %rsi
+	WORD $0x2949; BYTE $0xc3     // subq	%rax, %r11
+	LONG $0xff4b8d4d             // leaq	-1(%r11), %r9
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x06f98349             // cmpq	$6, %r9
+	JBE  BB0_21
+	QUAD $0x0000000085348d48     // leaq	0(,%rax,4), %rsi
+	LONG $0x37148d4c             // leaq	(%rdi,%rsi), %r10
+	LONG $0x31648d4c; BYTE $0x04 // leaq	4(%rcx,%rsi), %r12
+	WORD $0x894c; BYTE $0xd3     // movq	%r10, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x38fb8348             // cmpq	$56, %rbx
+	JA   BB0_82
+
+BB0_21:
+	LONG $0x0459f2c5; BYTE $0x81   // vmulss	(%rcx,%rax,4), %xmm1, %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	LONG $0x0411fac5; BYTE $0x87   // vmovss	%xmm0, (%rdi,%rax,4)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x0431 // vmulss	4(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0437 // vmovss	%xmm0, 4(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x0831 // vmulss	8(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0837 // vmovss	%xmm0, 8(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x0c31 // vmulss	12(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0c37 // vmovss	%xmm0, 12(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x1031 // vmulss	16(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1037 // vmovss	%xmm0, 16(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x1431 // vmulss	20(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x06408d4c               // leaq	6(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1437 // vmovss	%xmm0, 20(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x1831 // vmulss	24(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x07408d4c               // leaq	7(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1837 // vmovss	%xmm0, 24(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x1c31 // vmulss	28(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x08408d4c               // leaq	8(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1c37 // vmovss	%xmm0, 28(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x2031 // vmulss	32(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x09408d4c               // leaq	9(%rax), %r8
+	LONG $0x4411fac5; WORD $0x2037 // vmovss	%xmm0, 32(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x2431 // vmulss	36(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x0a408d4c               // leaq	10(%rax), %r8
+	LONG $0x4411fac5; WORD $0x2437 // vmovss	%xmm0, 36(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x2831 // vmulss	40(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x0b408d4c               // leaq	11(%rax), %r8
+	LONG $0x4411fac5; WORD $0x2837 // vmovss	%xmm0, 40(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x2c31 // vmulss	44(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x0c408d4c               // leaq	12(%rax), %r8
+	LONG $0x4411fac5; WORD $0x2c37 // vmovss	%xmm0, 44(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x3031 // vmulss	48(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x0d408d4c               // leaq	13(%rax), %r8
+	LONG $0x4411fac5; WORD $0x3037 // vmovss	%xmm0, 48(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x3431 // vmulss	52(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x0e408d4c               // leaq	14(%rax), %r8
+	LONG $0x4411fac5; WORD $0x3437 // vmovss	%xmm0, 52(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x3831 // vmulss	56(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x0fc08348               // addq	$15, %rax
+	LONG $0x4411fac5; WORD $0x3837 // vmovss	%xmm0, 56(%rdi,%rsi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_74
+	LONG $0x4c59f2c5; WORD $0x3c31 // vmulss	60(%rcx,%rsi), %xmm1, %xmm1
+	LONG $0x4c11fac5; WORD $0x3c37 // vmovss	%xmm1, 60(%rdi,%rsi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	JMP  BB0_75
+
+BB0_74:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_75:
+	RET
+
+BB0_81:
+	LONG $0x04518d48               // leaq	4(%rcx), %rdx
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	WORD $0x2948; BYTE $0xd0       // subq	%rdx, %rax
+	LONG $0x38f88348               // cmpq	$56, %rax
+	JBE  BB0_16
+	LONG $0x487cf162; WORD $0x3910 // vmovups	(%rcx), %zmm7
+	LONG $0x487cf162; WORD $0x3f11 // vmovups	%zmm7, (%rdi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_82:
+	LONG $0x0ef98349                           // cmpq	$14, %r9
+	JBE  BB0_31
+	LONG $0x486cf162; WORD $0x1459; BYTE $0x31 // vmulps	(%rcx,%rsi), %zmm2, %zmm2
+	WORD $0x894c; BYTE $0xde                   // movq	%r11, %rsi
+	LONG $0xf0e68348                           // andq	$-16, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x487cd162; WORD $0x1211             // vmovups	%zmm2, (%r10)
+	LONG $0x0fc3f641                           // testb	$15, %r11b
+	JE   BB0_74
+	WORD $0x2949; BYTE $0xf3                   // subq	%rsi, %r11
+	LONG $0xff4b8d4d                           // leaq	-1(%r11), %r9
+	LONG $0x06f98349                           // cmpq	$6, %r9
+	JBE  BB0_25
+
+BB0_22:
+	WORD $0x014c; BYTE $0xc6     // addq	%r8, %rsi
+	LONG $0x187de2c4; BYTE $0xc1 // vbroadcastss	%xmm1, %ymm0
+	LONG $0x0459fcc5; BYTE $0xb1 // vmulps	(%rcx,%rsi,4), %ymm0, %ymm0
+	LONG $0x0411fcc5; BYTE $0xb7 // vmovups	%ymm0, (%rdi,%rsi,4)
+	WORD $0x894c; BYTE $0xde     // movq	%r11, %rsi
+	LONG $0xf8e68348             // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	LONG $0x07e38341             // andl	$7, %r11d
+	JE   BB0_74
+
+BB0_25:
+	LONG $0x0459f2c5; BYTE $0x81   // vmulss	(%rcx,%rax,4), %xmm1, %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x0000000085348d48       // leaq	0(,%rax,4), %rsi
+	LONG $0x0411fac5; BYTE $0x87   // vmovss	%xmm0, (%rdi,%rax,4)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x0431 // vmulss	4(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0437 // vmovss	%xmm0, 4(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x0831 // vmulss	8(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0837 // vmovss	%xmm0, 8(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x0c31 // vmulss	12(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0x4411fac5; WORD $0x0c37 // vmovss	%xmm0, 12(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x1031 // vmulss	16(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0x4411fac5; WORD $0x1037 // vmovss	%xmm0, 16(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_74
+	LONG $0x4459f2c5; WORD $0x1431 // vmulss	20(%rcx,%rsi), %xmm1, %xmm0
+	LONG $0x06c08348               // addq	$6, %rax
+	LONG $0x4411fac5; WORD $0x1437 // vmovss	%xmm0, 20(%rdi,%rsi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_74
+	LONG $0x4c59f2c5; WORD $0x1831 // vmulss	24(%rcx,%rsi), %xmm1, %xmm1
+	LONG $0x4c11fac5; WORD $0x1837 // vmovss	%xmm1, 24(%rdi,%rsi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	JMP  BB0_75
+
+BB0_77:
+	RET
+
+BB0_28:
+	LONG $0xdb57e0c5               // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x0010b941; WORD $0x0000 // movl	$16, %r9d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x487cf162; WORD $0xcb28 // vmovaps	%zmm3, %zmm1
+	LONG $0x487cf162; WORD $0xc328 // vmovaps	%zmm3, %zmm0
+	JMP  BB0_3
+
+BB0_16:
+	LONG $0x0110fac5             // vmovss	(%rcx), %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x4110fac5; BYTE $0x04 // vmovss	4(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x04 // vmovss	%xmm0, 4(%rdi)
+	LONG $0x4110fac5; BYTE $0x08 // vmovss	8(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x08 // vmovss	%xmm0, 8(%rdi)
+	LONG $0x4110fac5; BYTE $0x0c // vmovss	12(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x0c // vmovss	%xmm0, 12(%rdi)
+	LONG $0x4110fac5; BYTE $0x10 // vmovss	16(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x10 // vmovss	%xmm0, 16(%rdi)
+	LONG $0x4110fac5; BYTE $0x14 // vmovss	20(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x14 // vmovss	%xmm0, 20(%rdi)
+	LONG $0x4110fac5; BYTE $0x18 // vmovss	24(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x18 // vmovss	%xmm0, 24(%rdi)
+	LONG $0x4110fac5; BYTE $0x1c // vmovss	28(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x1c // vmovss	%xmm0, 28(%rdi)
+	LONG $0x4110fac5; BYTE $0x20 // vmovss	32(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x20 // vmovss	%xmm0, 32(%rdi)
+	LONG $0x4110fac5; BYTE $0x24 // vmovss	36(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x24 // vmovss	%xmm0, 36(%rdi)
+	LONG $0x4110fac5; BYTE $0x28 // vmovss	40(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x28 // vmovss	%xmm0, 40(%rdi)
+	LONG $0x4110fac5; BYTE $0x2c // vmovss	44(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x2c // vmovss	%xmm0, 44(%rdi)
+	LONG $0x4110fac5; BYTE $0x30 // vmovss	48(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x30 // vmovss	%xmm0, 48(%rdi)
+	LONG $0x4110fac5; BYTE $0x34 // vmovss	52(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x34 // vmovss	%xmm0, 52(%rdi)
+	LONG $0x4110fac5; BYTE $0x38 // vmovss	56(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x38 // vmovss	%xmm0, 56(%rdi)
+	LONG $0x4110fac5; BYTE $0x3c // vmovss	60(%rcx), %xmm0
+	LONG $0x4711fac5; BYTE $0x3c // vmovss	%xmm0, 60(%rdi)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_30:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_19
+
+BB0_51:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_29:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_8
+
+BB0_31:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_22
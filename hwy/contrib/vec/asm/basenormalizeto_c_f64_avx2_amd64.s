@@ -0,0 +1,268 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basenormalizeto_c_f64_avx2_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $8
+
+TEXT ·normalizeto_c_f64_avx2(SB), $0-24
+	MOVQ dst+0(FP), DI
+	MOVQ src+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b48; BYTE $0x12 // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2 // testq	%rdx, %rdx
+	JE   BB0_57
+	WORD $0x8948; BYTE $0xf1 // movq	%rsi, %rcx
+	LONG $0x0ffa8348         // cmpq	$15, %rdx
+	JLE  BB0_26
+	LONG $0xf0428d4c         // leaq	-16(%rdx), %r8
+	WORD $0x8948; BYTE $0xf0 // movq	%rsi, %rax
+	LONG $0xdb57e1c5         // vxorpd	%xmm3, %xmm3, %xmm3
+	LONG $0xd328fdc5         // vmovapd	%ymm3, %ymm2
+	LONG $0x04e8c149         // shrq	$4, %r8
+	LONG $0xcb28fdc5         // vmovapd	%ymm3, %ymm1
+	LONG $0xc328fdc5         // vmovapd	%ymm3, %ymm0
+	WORD $0x894c; BYTE $0xc6 // movq	%r8, %rsi
+	LONG $0x07e6c148         // salq	$7, %rsi
+	QUAD $0x0000008031b48d48 // leaq	128(%rcx,%rsi), %rsi
+
+BB0_4:
+	LONG $0x2010fdc5             // vmovupd	(%rax), %ymm4
+	LONG $0x6810fdc5; BYTE $0x20 // vmovupd	32(%rax), %ymm5
+	LONG $0x80e88348             // subq	$-128, %rax
+	LONG $0x7010fdc5; BYTE $0xc0 // vmovupd	-64(%rax), %ymm6
+	LONG $0x7810fdc5; BYTE $0xe0 // vmovupd	-32(%rax), %ymm7
+	LONG $0xb8dde2c4; BYTE $0xc4 // vfmadd231pd	%ymm4, %ymm4, %ymm0
+	LONG $0xb8d5e2c4; BYTE $0xcd // vfmadd231pd	%ymm5, %ymm5, %ymm1
+	LONG $0xb8cde2c4; BYTE $0xd6 // vfmadd231pd	%ymm6, %ymm6, %ymm2
+	LONG $0xb8c5e2c4; BYTE $0xdf // vfmadd231pd	%ymm7, %ymm7, %ymm3
+	WORD $0x3948; BYTE $0xc6     // cmpq	%rax, %rsi
+	JNE  BB0_4
+	LONG $0x01408d49             // leaq	1(%r8), %rax
+	LONG $0xdb58edc5             // vaddpd	%ymm3, %ymm2, %ymm3
+	LONG $0x04e0c148             // salq	$4, %rax
+	LONG $0x04488d4c             // leaq	4(%rax), %r9
+
+BB0_3:
+	WORD $0x394c; BYTE $0xca // cmpq	%r9, %rdx
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xce // movq	%r9, %rsi
+
+BB0_6:
+	WORD $0x8949; BYTE $0xc0       // movq	%rax, %r8
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG $0x04768d48               // leaq	4(%rsi), %rsi
+	LONG $0x107da1c4; WORD $0xc114 // vmovupd	(%rcx,%r8,8), %ymm2
+	LONG $0xb8ede2c4; BYTE $0xc2   // vfmadd231pd	%ymm2, %ymm2, %ymm0
+	WORD $0x3948; BYTE $0xf2       // cmpq	%rsi, %rdx
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xd0       // movq	%rdx, %rax
+	WORD $0x294c; BYTE $0xc8       // subq	%r9, %rax
+	LONG $0xfce08348               // andq	$-4, %rax
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+
+BB0_5:
+	LONG $0xc858f5c5               // vaddpd	%ymm0, %ymm1, %ymm1
+	LONG $0xcb58f5c5               // vaddpd	%ymm3, %ymm1, %ymm1
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_7
+	WORD $0x8949; BYTE $0xd1       // movq	%rdx, %r9
+	WORD $0x2949; BYTE $0xc1       // subq	%rax, %r9
+	LONG $0xff718d49               // leaq	-1(%r9), %rsi
+	LONG $0x02fe8348               // cmpq	$2, %rsi
+	JBE  BB0_8
+	WORD $0x894d; BYTE $0xc8       // movq	%r9, %r8
+	LONG $0xc1348d48               // leaq	(%rcx,%rax,8), %rsi
+	LONG $0x02e8c149               // shrq	$2, %r8
+	LONG $0x05e0c149               // salq	$5, %r8
+	WORD $0x0149; BYTE $0xf0       // addq	%rsi, %r8
+
+BB0_9:
+	LONG $0x2610fdc5               // vmovupd	(%rsi), %ymm4
+	LONG $0x20c68348               // addq	$32, %rsi
+	LONG $0xcc59ddc5               // vmulpd	%ymm4, %ymm4, %ymm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xd115f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0x197de3c4; WORD $0x01c9 // vextractf128	$0x1, %ymm1, %xmm1
+	LONG $0xc258fbc5               // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc6       // cmpq	%r8, %rsi
+	JNE  BB0_9
+	LONG $0x03c1f641               // testb	$3, %r9b
+	JE   BB0_7
+	LONG $0xfce18349               // andq	$-4, %r9
+	WORD $0x014c; BYTE $0xc8       // addq	%r9, %rax
+
+BB0_8:
+	LONG $0x0c10fbc5; BYTE $0xc1   // vmovsd	(%rcx,%rax,8), %xmm1
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x00000000c5348d48       // leaq	0(,%rax,8), %rsi
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_7
+	LONG $0x4c10fbc5; WORD $0x0831 // vmovsd	8(%rcx,%rsi), %xmm1
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_7
+	LONG $0x4c10fbc5; WORD $0x1031 // vmovsd	16(%rcx,%rsi), %xmm1
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+
+BB0_7:
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc12ef9c5 // vucomisd	%xmm1, %xmm0
+	JP   BB0_12
+	JE   BB0_61
+
+BB0_12:
+	LONG   $0xc051fbc5             // vsqrtsd	%xmm0, %xmm0, %xmm0
+	VMOVSD CPI0_1<>(SB), X2        // vmovsd	.LCPI0_1(%rip), %xmm2
+	LONG   $0xd05eebc5             // vdivsd	%xmm0, %xmm2, %xmm2
+	LONG   $0x197de2c4; BYTE $0xca // vbroadcastsd	%xmm2, %ymm1
+	LONG   $0x03fa8348             // cmpq	$3, %rdx
+	JLE    BB0_27
+	LONG   $0x000004b8; BYTE $0x00 // movl	$4, %eax
+
+BB0_18:
+	LONG $0x4459f5c5; WORD $0xe0c1 // vmulpd	-32(%rcx,%rax,8), %ymm1, %ymm0
+	LONG $0x4411fdc5; WORD $0xe0c7 // vmovupd	%ymm0, -32(%rdi,%rax,8)
+	LONG $0x04c08348               // addq	$4, %rax
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JLE  BB0_18
+	LONG $0xfc428d48               // leaq	-4(%rdx), %rax
+	LONG $0x02e8c148               // shrq	$2, %rax
+	QUAD $0x0000000485048d48       // leaq	4(,%rax,4), %rax
+
+BB0_17:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_49
+	WORD $0x8948; BYTE $0xd6     // movq	%rdx, %rsi
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	QUAD $0x00000000c5048d4c     // leaq	0(,%rax,8), %r8
+	WORD $0x2948; BYTE $0xc6     // subq	%rax, %rsi
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x01fe8348             // cmpq	$1, %rsi
+	JE   BB0_19
+	QUAD $0x00000000c5048d4c     // leaq	0(,%rax,8), %r8
+	LONG $0x07148d4e             // leaq	(%rdi,%r8), %r10
+	LONG $0x015c8d4a; BYTE $0x08 // leaq	8(%rcx,%r8), %rbx
+	WORD $0x894d; BYTE $0xd3     // movq	%r10, %r11
+	WORD $0x2949; BYTE $0xdb     // subq	%rbx, %r11
+	LONG $0x10fb8349             // cmpq	$16, %r11
+	JA   BB0_62
+
+BB0_19:
+	LONG $0x0459ebc5; BYTE $0xc1               // vmulsd	(%rcx,%rax,8), %xmm2, %xmm0
+	LONG $0x01708d48                           // leaq	1(%rax), %rsi
+	LONG $0x0411fbc5; BYTE $0xc7               // vmovsd	%xmm0, (%rdi,%rax,8)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_54
+	LONG $0x596ba1c4; WORD $0x0144; BYTE $0x08 // vmulsd	8(%rcx,%r8), %xmm2, %xmm0
+	LONG $0x02708d48                           // leaq	2(%rax), %rsi
+	LONG $0x117ba1c4; WORD $0x0744; BYTE $0x08 // vmovsd	%xmm0, 8(%rdi,%r8)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_54
+	LONG $0x596ba1c4; WORD $0x0144; BYTE $0x10 // vmulsd	16(%rcx,%r8), %xmm2, %xmm0
+	LONG $0x03c08348                           // addq	$3, %rax
+	LONG $0x117ba1c4; WORD $0x0744; BYTE $0x10 // vmovsd	%xmm0, 16(%rdi,%r8)
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_54
+	LONG $0x596ba1c4; WORD $0x0154; BYTE $0x18 // vmulsd	24(%rcx,%r8), %xmm2, %xmm2
+	LONG $0x117ba1c4; WORD $0x0754; BYTE $0x18 // vmovsd	%xmm2, 24(%rdi,%r8)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_57:
+	RET
+
+BB0_61:
+	LONG $0x08518d48         // leaq	8(%rcx), %rdx
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	WORD $0x2948; BYTE $0xd0 // subq	%rdx, %rax
+	LONG $0x10f88348         // cmpq	$16, %rax
+	JBE  BB0_14
+	LONG $0x2910fdc5         // vmovupd	(%rcx), %ymm5
+	LONG $0x2f11fdc5         // vmovupd	%ymm5, (%rdi)
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_62:
+	LONG $0xff568d48               // leaq	-1(%rsi), %rdx
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_28
+	LONG $0x5975a1c4; WORD $0x010c // vmulpd	(%rcx,%r8), %ymm1, %ymm1
+	WORD $0x8948; BYTE $0xf2       // movq	%rsi, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x117dc1c4; BYTE $0x0a   // vmovupd	%ymm1, (%r10)
+	LONG $0x03c6f640               // testb	$3, %sil
+	JE   BB0_54
+	WORD $0x2948; BYTE $0xd6       // subq	%rdx, %rsi
+	LONG $0x01fe8348               // cmpq	$1, %rsi
+	JE   BB0_23
+
+BB0_20:
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+	LONG $0xc212fbc5             // vmovddup	%xmm2, %xmm0
+	LONG $0x0459f9c5; BYTE $0xd1 // vmulpd	(%rcx,%rdx,8), %xmm0, %xmm0
+	LONG $0x0411f9c5; BYTE $0xd7 // vmovupd	%xmm0, (%rdi,%rdx,8)
+	LONG $0x01c6f640             // testb	$1, %sil
+	JE   BB0_54
+	LONG $0xfee68348             // andq	$-2, %rsi
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+
+BB0_23:
+	LONG $0x1459ebc5; BYTE $0xc1 // vmulsd	(%rcx,%rax,8), %xmm2, %xmm2
+	LONG $0x1411fbc5; BYTE $0xc7 // vmovsd	%xmm2, (%rdi,%rax,8)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_54:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_49:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_26:
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	LONG $0x0004b941; WORD $0x0000 // movl	$4, %r9d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0xcb28fdc5               // vmovapd	%ymm3, %ymm1
+	LONG $0xc328fdc5               // vmovapd	%ymm3, %ymm0
+	JMP  BB0_3
+
+BB0_14:
+	LONG $0x0110fbc5             // vmovsd	(%rcx), %xmm0
+	LONG $0x0711fbc5             // vmovsd	%xmm0, (%rdi)
+	LONG $0x4110fbc5; BYTE $0x08 // vmovsd	8(%rcx), %xmm0
+	LONG $0x4711fbc5; BYTE $0x08 // vmovsd	%xmm0, 8(%rdi)
+	LONG $0x4110fbc5; BYTE $0x10 // vmovsd	16(%rcx), %xmm0
+	LONG $0x4711fbc5; BYTE $0x10 // vmovsd	%xmm0, 16(%rdi)
+	LONG $0x4110fbc5; BYTE $0x18 // vmovsd	24(%rcx), %xmm0
+	LONG $0x4711fbc5; BYTE $0x18 // vmovsd	%xmm0, 24(%rdi)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_27:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_17
+
+BB0_28:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_20
@@ -0,0 +1,349 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basenormalizeto_c_f64_avx512_amd64.c
+
+#include "textflag.h"
+
+// Constant pool data
+DATA CPI0_1<>+0(SB)/4, $0x00000000
+DATA CPI0_1<>+4(SB)/4, $0x3ff00000
+GLOBL CPI0_1<>(SB), (RODATA|NOPTR), $8
+
+TEXT ·normalizeto_c_f64_avx512(SB), $0-24
+	MOVQ dst+0(FP), DI
+	MOVQ src+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b48; BYTE $0x12       // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2       // testq	%rdx, %rdx
+	JE   BB0_65
+	WORD $0x8948; BYTE $0xf1       // movq	%rsi, %rcx
+	LONG $0x1ffa8348               // cmpq	$31, %rdx
+	JLE  BB0_28
+	LONG $0xe0428d4c               // leaq	-32(%rdx), %r8
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	LONG $0x05e8c149               // shrq	$5, %r8
+	LONG $0x48fdf162; WORD $0xd328 // vmovapd	%zmm3, %zmm2
+	LONG $0x48fdf162; WORD $0xcb28 // vmovapd	%zmm3, %zmm1
+	WORD $0x894c; BYTE $0xc6       // movq	%r8, %rsi
+	LONG $0x48fdf162; WORD $0xc328 // vmovapd	%zmm3, %zmm0
+	LONG $0x08e6c148               // salq	$8, %rsi
+	QUAD $0x0000010031b48d48       // leaq	256(%rcx,%rsi), %rsi
+
+BB0_4:
+	LONG $0x48fdf162; WORD $0x2810             // vmovupd	(%rax), %zmm5
+	LONG $0x01000548; WORD $0x0000             // addq	$256, %rax
+	LONG $0x48fdf162; WORD $0x7010; BYTE $0xfd // vmovupd	-192(%rax), %zmm6
+	LONG $0x48fdf162; WORD $0x7810; BYTE $0xfe // vmovupd	-128(%rax), %zmm7
+	LONG $0x48fdf162; WORD $0x6010; BYTE $0xff // vmovupd	-64(%rax), %zmm4
+	LONG $0x48d5f262; WORD $0xc5b8             // vfmadd231pd	%zmm5, %zmm5, %zmm0
+	LONG $0x48cdf262; WORD $0xceb8             // vfmadd231pd	%zmm6, %zmm6, %zmm1
+	LONG $0x48c5f262; WORD $0xd7b8             // vfmadd231pd	%zmm7, %zmm7, %zmm2
+	LONG $0x48ddf262; WORD $0xdcb8             // vfmadd231pd	%zmm4, %zmm4, %zmm3
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JNE  BB0_4
+	LONG $0x01408d49                           // leaq	1(%r8), %rax
+	LONG $0x48edf162; WORD $0xdb58             // vaddpd	%zmm3, %zmm2, %zmm3
+	LONG $0x05e0c148                           // salq	$5, %rax
+	LONG $0x08488d4c                           // leaq	8(%rax), %r9
+
+BB0_3:
+	WORD $0x394c; BYTE $0xca // cmpq	%r9, %rdx
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xce // movq	%r9, %rsi
+
+BB0_6:
+	WORD $0x8949; BYTE $0xc0                   // movq	%rax, %r8
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	LONG $0x08768d48                           // leaq	8(%rsi), %rsi
+	LONG $0x48fdb162; WORD $0x1410; BYTE $0xc1 // vmovupd	(%rcx,%r8,8), %zmm2
+	LONG $0x48edf262; WORD $0xc2b8             // vfmadd231pd	%zmm2, %zmm2, %zmm0
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	WORD $0x294c; BYTE $0xc8                   // subq	%r9, %rax
+	LONG $0xf8e08348                           // andq	$-8, %rax
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+
+BB0_5:
+	LONG $0x48f5f162; WORD $0xc858             // vaddpd	%zmm0, %zmm1, %zmm1
+	LONG $0x48f5f162; WORD $0xcb58             // vaddpd	%zmm3, %zmm1, %zmm1
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc158fdc5                           // vaddpd	%ymm1, %ymm0, %ymm0
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm1
+	LONG $0xc858f1c5                           // vaddpd	%xmm0, %xmm1, %xmm1
+	LONG $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_7
+	WORD $0x8949; BYTE $0xd0                   // movq	%rdx, %r8
+	WORD $0x8949; BYTE $0xc2                   // movq	%rax, %r10
+	WORD $0x2949; BYTE $0xc0                   // subq	%rax, %r8
+	LONG $0xff708d49                           // leaq	-1(%r8), %rsi
+	LONG $0x06fe8348                           // cmpq	$6, %rsi
+	JBE  BB0_29
+	WORD $0x894d; BYTE $0xc1                   // movq	%r8, %r9
+	LONG $0xc1348d48                           // leaq	(%rcx,%rax,8), %rsi
+	LONG $0x03e9c149                           // shrq	$3, %r9
+	LONG $0x06e1c149                           // salq	$6, %r9
+	WORD $0x0149; BYTE $0xf1                   // addq	%rsi, %r9
+
+BB0_9:
+	LONG $0x48fdf162; WORD $0x2e10             // vmovupd	(%rsi), %zmm5
+	LONG $0x40c68348                           // addq	$64, %rsi
+	LONG $0x48d5f162; WORD $0xcd59             // vmulpd	%zmm5, %zmm5, %zmm1
+	LONG $0x28f5f362; WORD $0xd103; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm2
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xd915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm3
+	LONG $0xc358fbc5                           // vaddsd	%xmm3, %xmm0, %xmm0
+	LONG $0x28fdf362; WORD $0xcb19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm3
+	LONG $0x48fdf362; WORD $0xc91b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm1
+	LONG $0xc358fbc5                           // vaddsd	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xd115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0x28fdf362; WORD $0xca19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm2
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xce                   // cmpq	%r9, %rsi
+	JNE  BB0_9
+	WORD $0x894c; BYTE $0xc6                   // movq	%r8, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x07c0f641                           // testb	$7, %r8b
+	JE   BB0_7
+
+BB0_8:
+	WORD $0x2949; BYTE $0xf0                   // subq	%rsi, %r8
+	LONG $0xff488d4d                           // leaq	-1(%r8), %r9
+	LONG $0x02f98349                           // cmpq	$2, %r9
+	JBE  BB0_12
+	WORD $0x014c; BYTE $0xd6                   // addq	%r10, %rsi
+	LONG $0x0c10fdc5; BYTE $0xf1               // vmovupd	(%rcx,%rsi,8), %ymm1
+	WORD $0x894c; BYTE $0xc6                   // movq	%r8, %rsi
+	LONG $0xfce68348                           // andq	$-4, %rsi
+	LONG $0xc959f5c5                           // vmulpd	%ymm1, %ymm1, %ymm1
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x03e08341                           // andl	$3, %r8d
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xd115f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0x28fdf362; WORD $0xca19; BYTE $0x01 // vextractf64x2	$1, %ymm1, %xmm2
+	LONG $0x28f5f362; WORD $0xc903; BYTE $0x03 // valignq	$3, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fbc5                           // vaddsd	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	JE   BB0_7
+
+BB0_12:
+	LONG $0x0c10fbc5; BYTE $0xc1   // vmovsd	(%rcx,%rax,8), %xmm1
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x00000000c5348d48       // leaq	0(,%rax,8), %rsi
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_7
+	LONG $0x4c10fbc5; WORD $0x0831 // vmovsd	8(%rcx,%rsi), %xmm1
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_7
+	LONG $0x4c10fbc5; WORD $0x1031 // vmovsd	16(%rcx,%rsi), %xmm1
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+
+BB0_7:
+	LONG $0xc957f1c5 // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc12ef9c5 // vucomisd	%xmm1, %xmm0
+	JP   BB0_14
+	JE   BB0_69
+
+BB0_14:
+	VMOVSD CPI0_1<>(SB), X2          // vmovsd	.LCPI0_1(%rip), %xmm2
+	LONG   $0xc051fbc5               // vsqrtsd	%xmm0, %xmm0, %xmm0
+	LONG   $0xd05eebc5               // vdivsd	%xmm0, %xmm2, %xmm2
+	LONG   $0x48fdf262; WORD $0xca19 // vbroadcastsd	%xmm2, %zmm1
+	LONG   $0x07fa8348               // cmpq	$7, %rdx
+	JLE    BB0_30
+	LONG   $0x000008b8; BYTE $0x00   // movl	$8, %eax
+
+BB0_20:
+	QUAD $0xffc1445948f5f162 // vmulpd	-64(%rcx,%rax,8), %zmm1, %zmm0
+	QUAD $0xffc7441148fdf162 // vmovupd	%zmm0, -64(%rdi,%rax,8)
+	LONG $0x08c08348         // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JLE  BB0_20
+	LONG $0xf8428d48         // leaq	-8(%rdx), %rax
+	LONG $0x03e8c148         // shrq	$3, %rax
+	QUAD $0x00000008c5048d48 // leaq	8(,%rax,8), %rax
+
+BB0_19:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_51
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	QUAD $0x00000000c5348d48     // leaq	0(,%rax,8), %rsi
+	WORD $0x2949; BYTE $0xc0     // subq	%rax, %r8
+	LONG $0xff508d4d             // leaq	-1(%r8), %r10
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_21
+	QUAD $0x00000000c5348d48     // leaq	0(,%rax,8), %rsi
+	LONG $0x371c8d4c             // leaq	(%rdi,%rsi), %r11
+	LONG $0x31648d4c; BYTE $0x08 // leaq	8(%rcx,%rsi), %r12
+	WORD $0x894c; BYTE $0xdb     // movq	%r11, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x30fb8348             // cmpq	$48, %rbx
+	JA   BB0_70
+
+BB0_21:
+	LONG $0x0459ebc5; BYTE $0xc1   // vmulsd	(%rcx,%rax,8), %xmm2, %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	LONG $0x0411fbc5; BYTE $0xc7   // vmovsd	%xmm0, (%rdi,%rax,8)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459ebc5; WORD $0x0831 // vmulsd	8(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x0837 // vmovsd	%xmm0, 8(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459ebc5; WORD $0x1031 // vmulsd	16(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x1037 // vmovsd	%xmm0, 16(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459ebc5; WORD $0x1831 // vmulsd	24(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x1837 // vmovsd	%xmm0, 24(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459ebc5; WORD $0x2031 // vmulsd	32(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x2037 // vmovsd	%xmm0, 32(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459ebc5; WORD $0x2831 // vmulsd	40(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x06408d4c               // leaq	6(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x2837 // vmovsd	%xmm0, 40(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459ebc5; WORD $0x3031 // vmulsd	48(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x07c08348               // addq	$7, %rax
+	LONG $0x4411fbc5; WORD $0x3037 // vmovsd	%xmm0, 48(%rdi,%rsi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_62
+	LONG $0x5459ebc5; WORD $0x3831 // vmulsd	56(%rcx,%rsi), %xmm2, %xmm2
+	LONG $0x5411fbc5; WORD $0x3837 // vmovsd	%xmm2, 56(%rdi,%rsi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	JMP  BB0_63
+
+BB0_62:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_63:
+	RET
+
+BB0_69:
+	LONG $0x08518d48               // leaq	8(%rcx), %rdx
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	WORD $0x2948; BYTE $0xd0       // subq	%rdx, %rax
+	LONG $0x30f88348               // cmpq	$48, %rax
+	JBE  BB0_16
+	LONG $0x48fdf162; WORD $0x3110 // vmovupd	(%rcx), %zmm6
+	LONG $0x48fdf162; WORD $0x3711 // vmovupd	%zmm6, (%rdi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_70:
+	LONG $0x06fa8349                           // cmpq	$6, %r10
+	JBE  BB0_31
+	LONG $0x48f5f162; WORD $0x0c59; BYTE $0x31 // vmulpd	(%rcx,%rsi), %zmm1, %zmm1
+	WORD $0x894c; BYTE $0xc6                   // movq	%r8, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x48fdd162; WORD $0x0b11             // vmovupd	%zmm1, (%r11)
+	LONG $0x07c0f641                           // testb	$7, %r8b
+	JE   BB0_62
+	WORD $0x2949; BYTE $0xf0                   // subq	%rsi, %r8
+	LONG $0xff508d4d                           // leaq	-1(%r8), %r10
+	LONG $0x02fa8349                           // cmpq	$2, %r10
+	JBE  BB0_25
+
+BB0_22:
+	WORD $0x014c; BYTE $0xce     // addq	%r9, %rsi
+	LONG $0x197de2c4; BYTE $0xc2 // vbroadcastsd	%xmm2, %ymm0
+	LONG $0x0459fdc5; BYTE $0xf1 // vmulpd	(%rcx,%rsi,8), %ymm0, %ymm0
+	LONG $0x0411fdc5; BYTE $0xf7 // vmovupd	%ymm0, (%rdi,%rsi,8)
+	WORD $0x894c; BYTE $0xc6     // movq	%r8, %rsi
+	LONG $0xfce68348             // andq	$-4, %rsi
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	LONG $0x03e08341             // andl	$3, %r8d
+	JE   BB0_62
+
+BB0_25:
+	LONG $0x0459ebc5; BYTE $0xc1   // vmulsd	(%rcx,%rax,8), %xmm2, %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x00000000c5348d48       // leaq	0(,%rax,8), %rsi
+	LONG $0x0411fbc5; BYTE $0xc7   // vmovsd	%xmm0, (%rdi,%rax,8)
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_62
+	LONG $0x4459ebc5; WORD $0x0831 // vmulsd	8(%rcx,%rsi), %xmm2, %xmm0
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x4411fbc5; WORD $0x0837 // vmovsd	%xmm0, 8(%rdi,%rsi)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_62
+	LONG $0x5459ebc5; WORD $0x1031 // vmulsd	16(%rcx,%rsi), %xmm2, %xmm2
+	LONG $0x5411fbc5; WORD $0x1037 // vmovsd	%xmm2, 16(%rdi,%rsi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	JMP  BB0_63
+
+BB0_65:
+	RET
+
+BB0_28:
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	LONG $0x0008b941; WORD $0x0000 // movl	$8, %r9d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x48fdf162; WORD $0xcb28 // vmovapd	%zmm3, %zmm1
+	LONG $0x48fdf162; WORD $0xc328 // vmovapd	%zmm3, %zmm0
+	JMP  BB0_3
+
+BB0_51:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_16:
+	LONG $0x0110fbc5             // vmovsd	(%rcx), %xmm0
+	LONG $0x0711fbc5             // vmovsd	%xmm0, (%rdi)
+	LONG $0x4110fbc5; BYTE $0x08 // vmovsd	8(%rcx), %xmm0
+	LONG $0x4711fbc5; BYTE $0x08 // vmovsd	%xmm0, 8(%rdi)
+	LONG $0x4110fbc5; BYTE $0x10 // vmovsd	16(%rcx), %xmm0
+	LONG $0x4711fbc5; BYTE $0x10 // vmovsd	%xmm0, 16(%rdi)
+	LONG $0x4110fbc5; BYTE $0x18 // vmovsd	24(%rcx), %xmm0
+	LONG $0x4711fbc5; BYTE $0x18 // vmovsd	%xmm0, 24(%rdi)
+	LONG $0x4110fbc5; BYTE $0x20 // vmovsd	32(%rcx), %xmm0
+	LONG $0x4711fbc5; BYTE $0x20 // vmovsd	%xmm0, 32(%rdi)
+	LONG $0x4110fbc5; BYTE $0x28 // vmovsd	40(%rcx), %xmm0
+	LONG $0x4711fbc5; BYTE $0x28 // vmovsd	%xmm0, 40(%rdi)
+	LONG $0x4110fbc5; BYTE $0x30 // vmovsd	48(%rcx), %xmm0
+	LONG $0x4711fbc5; BYTE $0x30 // vmovsd	%xmm0, 48(%rdi)
+	LONG $0x4110fbc5; BYTE $0x38 // vmovsd	56(%rcx), %xmm0
+	LONG $0x4711fbc5; BYTE $0x38 // vmovsd	%xmm0, 56(%rdi)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_30:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_19
+
+BB0_29:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_8
+
+BB0_31:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_22
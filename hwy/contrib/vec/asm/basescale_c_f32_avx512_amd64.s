@@ -0,0 +1,133 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basescale_c_f32_avx512_amd64.c
+
+TEXT ·scale_c_f32_avx512(SB), $0-24
+	MOVQ pc+0(FP), DI
+	MOVQ dst+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8948; BYTE $0xf1       // movq	%rsi, %rcx
+	WORD $0x8b48; BYTE $0x32       // movq	(%rdx), %rsi
+	WORD $0x8548; BYTE $0xf6       // testq	%rsi, %rsi
+	JE   BB0_29
+	LONG $0x1710fac5               // vmovss	(%rdi), %xmm2
+	LONG $0x487df262; WORD $0xca18 // vbroadcastss	%xmm2, %zmm1
+	LONG $0x0ffe8348               // cmpq	$15, %rsi
+	JLE  BB0_31
+	LONG $0xf0568d48               // leaq	-16(%rsi), %rdx
+	WORD $0x8948; BYTE $0xc8       // movq	%rcx, %rax
+	LONG $0x04eac148               // shrq	$4, %rdx
+	WORD $0x8948; BYTE $0xd7       // movq	%rdx, %rdi
+	LONG $0x06e7c148               // salq	$6, %rdi
+	LONG $0x397c8d48; BYTE $0x40   // leaq	64(%rcx,%rdi), %rdi
+
+BB0_5:
+	LONG $0x4874f162; WORD $0x0059             // vmulps	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x487cf162; WORD $0x4011; BYTE $0xff // vmovups	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xc7                   // cmpq	%rax, %rdi
+	JNE  BB0_5
+	LONG $0x01c28348                           // addq	$1, %rdx
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x04e0c148                           // salq	$4, %rax
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_28
+	WORD $0x8948; BYTE $0xf7                   // movq	%rsi, %rdi
+	WORD $0x8949; BYTE $0xc0                   // movq	%rax, %r8
+	WORD $0x2948; BYTE $0xc7                   // subq	%rax, %rdi
+	LONG $0xff4f8d4c                           // leaq	-1(%rdi), %r9
+	LONG $0x0ef98349                           // cmpq	$14, %r9
+	JBE  BB0_9
+	LONG $0x06e2c148                           // salq	$6, %rdx
+	WORD $0x8949; BYTE $0xf9                   // movq	%rdi, %r9
+	WORD $0x0148; BYTE $0xca                   // addq	%rcx, %rdx
+	LONG $0xf0e18349                           // andq	$-16, %r9
+	LONG $0x4874f162; WORD $0x0a59             // vmulps	(%rdx), %zmm1, %zmm1
+	WORD $0x014c; BYTE $0xc8                   // addq	%r9, %rax
+	LONG $0x487cf162; WORD $0x0a11             // vmovups	%zmm1, (%rdx)
+	LONG $0x0fc7f640                           // testb	$15, %dil
+	JE   BB0_28
+
+BB0_4:
+	WORD $0x8948; BYTE $0xfa     // movq	%rdi, %rdx
+	WORD $0x294c; BYTE $0xca     // subq	%r9, %rdx
+	LONG $0xff7a8d48             // leaq	-1(%rdx), %rdi
+	LONG $0x06ff8348             // cmpq	$6, %rdi
+	JBE  BB0_7
+	LONG $0x083c8d4b             // leaq	(%r8,%r9), %rdi
+	LONG $0x187de2c4; BYTE $0xc2 // vbroadcastss	%xmm2, %ymm0
+	LONG $0xb93c8d48             // leaq	(%rcx,%rdi,4), %rdi
+	LONG $0x0759fcc5             // vmulps	(%rdi), %ymm0, %ymm0
+	LONG $0x0711fcc5             // vmovups	%ymm0, (%rdi)
+	WORD $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	LONG $0xf8e78348             // andq	$-8, %rdi
+	WORD $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	WORD $0xe283; BYTE $0x07     // andl	$7, %edx
+	JE   BB0_28
+
+BB0_7:
+	QUAD $0x0000000085148d48     // leaq	0(,%rax,4), %rdx
+	LONG $0x113c8d48             // leaq	(%rcx,%rdx), %rdi
+	LONG $0x0759eac5             // vmulss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x01788d48             // leaq	1(%rax), %rdi
+	WORD $0x3948; BYTE $0xfe     // cmpq	%rdi, %rsi
+	JLE  BB0_28
+	LONG $0x117c8d48; BYTE $0x04 // leaq	4(%rcx,%rdx), %rdi
+	LONG $0x0759eac5             // vmulss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x02788d48             // leaq	2(%rax), %rdi
+	WORD $0x3948; BYTE $0xfe     // cmpq	%rdi, %rsi
+	JLE  BB0_28
+	LONG $0x117c8d48; BYTE $0x08 // leaq	8(%rcx,%rdx), %rdi
+	LONG $0x0759eac5             // vmulss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x03788d48             // leaq	3(%rax), %rdi
+	WORD $0x3948; BYTE $0xfe     // cmpq	%rdi, %rsi
+	JLE  BB0_28
+	LONG $0x117c8d48; BYTE $0x0c // leaq	12(%rcx,%rdx), %rdi
+	LONG $0x0759eac5             // vmulss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x04788d48             // leaq	4(%rax), %rdi
+	WORD $0x3948; BYTE $0xfe     // cmpq	%rdi, %rsi
+	JLE  BB0_28
+	LONG $0x117c8d48; BYTE $0x10 // leaq	16(%rcx,%rdx), %rdi
+	LONG $0x0759eac5             // vmulss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	LONG $0x05788d48             // leaq	5(%rax), %rdi
+	WORD $0x3948; BYTE $0xfe     // cmpq	%rdi, %rsi
+	JLE  BB0_28
+	LONG $0x117c8d48; BYTE $0x14 // leaq	20(%rcx,%rdx), %rdi
+	LONG $0x06c08348             // addq	$6, %rax
+	LONG $0x0759eac5             // vmulss	(%rdi), %xmm2, %xmm0
+	LONG $0x0711fac5             // vmovss	%xmm0, (%rdi)
+	WORD $0x3948; BYTE $0xc6     // cmpq	%rax, %rsi
+	JLE  BB0_28
+	LONG $0x11448d48; BYTE $0x18 // leaq	24(%rcx,%rdx), %rax
+	LONG $0x1059eac5             // vmulss	(%rax), %xmm2, %xmm2
+	LONG $0x1011fac5             // vmovss	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_28:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_29:
+	RET
+
+BB0_31:
+	WORD $0x8548; BYTE $0xf6 // testq	%rsi, %rsi
+	JLE  BB0_28
+	WORD $0x8948; BYTE $0xf7 // movq	%rsi, %rdi
+	WORD $0x3145; BYTE $0xc0 // xorl	%r8d, %r8d
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	WORD $0xc031             // xorl	%eax, %eax
+	JMP  BB0_4
+
+BB0_9:
+	WORD $0x3145; BYTE $0xc9 // xorl	%r9d, %r9d
+	JMP  BB0_4
@@ -0,0 +1,106 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basescale_c_f64_avx512_amd64.c
+
+TEXT ·scale_c_f64_avx512(SB), $0-24
+	MOVQ pc+0(FP), DI
+	MOVQ dst+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b4c; BYTE $0x02       // movq	(%rdx), %r8
+	WORD $0x8948; BYTE $0xf1       // movq	%rsi, %rcx
+	WORD $0x854d; BYTE $0xc0       // testq	%r8, %r8
+	JE   BB0_25
+	LONG $0x1710fbc5               // vmovsd	(%rdi), %xmm2
+	LONG $0x48fdf262; WORD $0xca19 // vbroadcastsd	%xmm2, %zmm1
+	LONG $0x07f88349               // cmpq	$7, %r8
+	JLE  BB0_27
+	LONG $0xf8508d49               // leaq	-8(%r8), %rdx
+	WORD $0x8948; BYTE $0xf0       // movq	%rsi, %rax
+	LONG $0x03eac148               // shrq	$3, %rdx
+	WORD $0x8948; BYTE $0xd6       // movq	%rdx, %rsi
+	LONG $0x06e6c148               // salq	$6, %rsi
+	LONG $0x31748d48; BYTE $0x40   // leaq	64(%rcx,%rsi), %rsi
+
+BB0_5:
+	LONG $0x48f5f162; WORD $0x0059             // vmulpd	(%rax), %zmm1, %zmm0
+	LONG $0x40c08348                           // addq	$64, %rax
+	LONG $0x48fdf162; WORD $0x4011; BYTE $0xff // vmovupd	%zmm0, -64(%rax)
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JNE  BB0_5
+	LONG $0x01c28348                           // addq	$1, %rdx
+	QUAD $0x00000000d5348d48                   // leaq	0(,%rdx,8), %rsi
+	WORD $0x3949; BYTE $0xf0                   // cmpq	%rsi, %r8
+	JLE  BB0_24
+	WORD $0x894c; BYTE $0xc0                   // movq	%r8, %rax
+	WORD $0x8948; BYTE $0xf7                   // movq	%rsi, %rdi
+	WORD $0x2948; BYTE $0xf0                   // subq	%rsi, %rax
+	LONG $0xff488d4c                           // leaq	-1(%rax), %r9
+	LONG $0x06f98349                           // cmpq	$6, %r9
+	JBE  BB0_9
+	LONG $0x06e2c148                           // salq	$6, %rdx
+	WORD $0x0148; BYTE $0xca                   // addq	%rcx, %rdx
+	LONG $0x48f5f162; WORD $0x0a59             // vmulpd	(%rdx), %zmm1, %zmm1
+	LONG $0x48fdf162; WORD $0x0a11             // vmovupd	%zmm1, (%rdx)
+	WORD $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	WORD $0x0148; BYTE $0xd6                   // addq	%rdx, %rsi
+	WORD $0x07a8                               // testb	$7, %al
+	JE   BB0_24
+
+BB0_4:
+	WORD $0x2948; BYTE $0xd0     // subq	%rdx, %rax
+	LONG $0xff488d4c             // leaq	-1(%rax), %r9
+	LONG $0x02f98349             // cmpq	$2, %r9
+	JBE  BB0_7
+	WORD $0x0148; BYTE $0xfa     // addq	%rdi, %rdx
+	LONG $0x197de2c4; BYTE $0xc2 // vbroadcastsd	%xmm2, %ymm0
+	LONG $0xd1148d48             // leaq	(%rcx,%rdx,8), %rdx
+	LONG $0x0259fdc5             // vmulpd	(%rdx), %ymm0, %ymm0
+	LONG $0x0211fdc5             // vmovupd	%ymm0, (%rdx)
+	WORD $0x03a8                 // testb	$3, %al
+	JE   BB0_24
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x0148; BYTE $0xc6     // addq	%rax, %rsi
+
+BB0_7:
+	QUAD $0x00000000f5048d48     // leaq	0(,%rsi,8), %rax
+	LONG $0x01148d48             // leaq	(%rcx,%rax), %rdx
+	LONG $0x0259ebc5             // vmulsd	(%rdx), %xmm2, %xmm0
+	LONG $0x0211fbc5             // vmovsd	%xmm0, (%rdx)
+	LONG $0x01568d48             // leaq	1(%rsi), %rdx
+	WORD $0x3949; BYTE $0xd0     // cmpq	%rdx, %r8
+	JLE  BB0_24
+	LONG $0x01548d48; BYTE $0x08 // leaq	8(%rcx,%rax), %rdx
+	LONG $0x02c68348             // addq	$2, %rsi
+	LONG $0x0259ebc5             // vmulsd	(%rdx), %xmm2, %xmm0
+	LONG $0x0211fbc5             // vmovsd	%xmm0, (%rdx)
+	WORD $0x3949; BYTE $0xf0     // cmpq	%rsi, %r8
+	JLE  BB0_24
+	LONG $0x01448d48; BYTE $0x10 // leaq	16(%rcx,%rax), %rax
+	LONG $0x1059ebc5             // vmulsd	(%rax), %xmm2, %xmm2
+	LONG $0x1011fbc5             // vmovsd	%xmm2, (%rax)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_24:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_25:
+	RET
+
+BB0_27:
+	WORD $0x854d; BYTE $0xc0 // testq	%r8, %r8
+	JLE  BB0_24
+	WORD $0x894c; BYTE $0xc0 // movq	%r8, %rax
+	WORD $0xff31             // xorl	%edi, %edi
+	WORD $0xd231             // xorl	%edx, %edx
+	WORD $0xf631             // xorl	%esi, %esi
+	JMP  BB0_4
+
+BB0_9:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_4
@@ -0,0 +1,155 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basescaleto_c_f32_avx2_amd64.c
+
+TEXT ·scaleto_c_f32_avx2(SB), $0-32
+	MOVQ dst+0(FP), DI
+	MOVQ pc+8(FP), SI
+	MOVQ s+16(FP), DX
+	MOVQ plen_dst+24(FP), CX
+	WORD $0x8949; BYTE $0xf8     // movq	%rdi, %r8
+	WORD $0x8948; BYTE $0xd7     // movq	%rdx, %rdi
+	WORD $0x8b48; BYTE $0x11     // movq	(%rcx), %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_39
+	LONG $0x1610fac5             // vmovss	(%rsi), %xmm2
+	LONG $0x187de2c4; BYTE $0xca // vbroadcastss	%xmm2, %ymm1
+	LONG $0x07fa8348             // cmpq	$7, %rdx
+	JLE  BB0_11
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_4:
+	LONG $0x4459f4c5; WORD $0xe087             // vmulps	-32(%rdi,%rax,4), %ymm1, %ymm0
+	LONG $0x117cc1c4; WORD $0x8044; BYTE $0xe0 // vmovups	%ymm0, -32(%r8,%rax,4)
+	LONG $0x08c08348                           // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JLE  BB0_4
+	LONG $0xf8428d48                           // leaq	-8(%rdx), %rax
+	LONG $0x03e8c148                           // shrq	$3, %rax
+	QUAD $0x00000008c5048d48                   // leaq	8(,%rax,8), %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_25
+	WORD $0x8948; BYTE $0xd6     // movq	%rdx, %rsi
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	QUAD $0x00000000850c8d48     // leaq	0(,%rax,4), %rcx
+	WORD $0x2948; BYTE $0xc6     // subq	%rax, %rsi
+	LONG $0xff568d4c             // leaq	-1(%rsi), %r10
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_5
+	QUAD $0x00000000850c8d48     // leaq	0(,%rax,4), %rcx
+	LONG $0x081c8d4d             // leaq	(%r8,%rcx), %r11
+	LONG $0x0f648d4c; BYTE $0x04 // leaq	4(%rdi,%rcx), %r12
+	WORD $0x894c; BYTE $0xdb     // movq	%r11, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x18fb8348             // cmpq	$24, %rbx
+	JA   BB0_43
+
+BB0_5:
+	LONG $0x0459eac5; BYTE $0x87               // vmulss	(%rdi,%rax,4), %xmm2, %xmm0
+	LONG $0x01708d48                           // leaq	1(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x8004             // vmovss	%xmm0, (%r8,%rax,4)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_36
+	LONG $0x4459eac5; WORD $0x040f             // vmulss	4(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x02708d48                           // leaq	2(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x04 // vmovss	%xmm0, 4(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_36
+	LONG $0x4459eac5; WORD $0x080f             // vmulss	8(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x03708d48                           // leaq	3(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x08 // vmovss	%xmm0, 8(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_36
+	LONG $0x4459eac5; WORD $0x0c0f             // vmulss	12(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x04708d48                           // leaq	4(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x0c // vmovss	%xmm0, 12(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_36
+	LONG $0x4459eac5; WORD $0x100f             // vmulss	16(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x05708d48                           // leaq	5(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x10 // vmovss	%xmm0, 16(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_36
+	LONG $0x4459eac5; WORD $0x140f             // vmulss	20(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x06708d48                           // leaq	6(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x14 // vmovss	%xmm0, 20(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_36
+	LONG $0x4459eac5; WORD $0x180f             // vmulss	24(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x07c08348                           // addq	$7, %rax
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x18 // vmovss	%xmm0, 24(%r8,%rcx)
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_36
+	LONG $0x5459eac5; WORD $0x1c0f             // vmulss	28(%rdi,%rcx), %xmm2, %xmm2
+	LONG $0x117ac1c4; WORD $0x0854; BYTE $0x1c // vmovss	%xmm2, 28(%r8,%rcx)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_43:
+	LONG $0x06fa8349             // cmpq	$6, %r10
+	JBE  BB0_12
+	LONG $0x0c59f4c5; BYTE $0x0f // vmulps	(%rdi,%rcx), %ymm1, %ymm1
+	WORD $0x8948; BYTE $0xf1     // movq	%rsi, %rcx
+	LONG $0xf8e18348             // andq	$-8, %rcx
+	WORD $0x0148; BYTE $0xc8     // addq	%rcx, %rax
+	LONG $0x117cc1c4; BYTE $0x0b // vmovups	%ymm1, (%r11)
+	LONG $0x07c6f640             // testb	$7, %sil
+	JE   BB0_36
+	WORD $0x2948; BYTE $0xce     // subq	%rcx, %rsi
+	LONG $0xff568d4c             // leaq	-1(%rsi), %r10
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x014c; BYTE $0xc9       // addq	%r9, %rcx
+	LONG $0xc2c6e8c5; BYTE $0x00   // vshufps	$0, %xmm2, %xmm2, %xmm0
+	LONG $0x0459f8c5; BYTE $0x8f   // vmulps	(%rdi,%rcx,4), %xmm0, %xmm0
+	LONG $0x1178c1c4; WORD $0x8804 // vmovups	%xmm0, (%r8,%rcx,4)
+	WORD $0x8948; BYTE $0xf1       // movq	%rsi, %rcx
+	LONG $0xfce18348               // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	WORD $0xe683; BYTE $0x03       // andl	$3, %esi
+	JE   BB0_36
+
+BB0_8:
+	LONG $0x0459eac5; BYTE $0x87               // vmulss	(%rdi,%rax,4), %xmm2, %xmm0
+	LONG $0x01708d48                           // leaq	1(%rax), %rsi
+	QUAD $0x00000000850c8d48                   // leaq	0(,%rax,4), %rcx
+	LONG $0x117ac1c4; WORD $0x8004             // vmovss	%xmm0, (%r8,%rax,4)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_36
+	LONG $0x4459eac5; WORD $0x040f             // vmulss	4(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x02c08348                           // addq	$2, %rax
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x04 // vmovss	%xmm0, 4(%r8,%rcx)
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_36
+	LONG $0x5459eac5; WORD $0x080f             // vmulss	8(%rdi,%rcx), %xmm2, %xmm2
+	LONG $0x117ac1c4; WORD $0x0854; BYTE $0x08 // vmovss	%xmm2, 8(%r8,%rcx)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_36:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_39:
+	RET
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_6
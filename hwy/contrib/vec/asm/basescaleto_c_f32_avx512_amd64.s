@@ -0,0 +1,217 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basescaleto_c_f32_avx512_amd64.c
+
+TEXT ·scaleto_c_f32_avx512(SB), $0-32
+	MOVQ dst+0(FP), DI
+	MOVQ pc+8(FP), SI
+	MOVQ s+16(FP), DX
+	MOVQ plen_dst+24(FP), CX
+	WORD $0x8949; BYTE $0xf8       // movq	%rdi, %r8
+	WORD $0x8948; BYTE $0xd7       // movq	%rdx, %rdi
+	WORD $0x8b48; BYTE $0x11       // movq	(%rcx), %rdx
+	WORD $0x8548; BYTE $0xd2       // testq	%rdx, %rdx
+	JE   BB0_51
+	LONG $0x1610fac5               // vmovss	(%rsi), %xmm2
+	LONG $0x487df262; WORD $0xca18 // vbroadcastss	%xmm2, %zmm1
+	LONG $0x0ffa8348               // cmpq	$15, %rdx
+	JLE  BB0_11
+	LONG $0x000010b8; BYTE $0x00   // movl	$16, %eax
+
+BB0_4:
+	QUAD $0xff8744594874f162 // vmulps	-64(%rdi,%rax,4), %zmm1, %zmm0
+	QUAD $0xff804411487cd162 // vmovups	%zmm0, -64(%r8,%rax,4)
+	LONG $0x10c08348         // addq	$16, %rax
+	WORD $0x3948; BYTE $0xd0 // cmpq	%rdx, %rax
+	JLE  BB0_4
+	LONG $0xf0428d48         // leaq	-16(%rdx), %rax
+	LONG $0xf0e08348         // andq	$-16, %rax
+	LONG $0x10c08348         // addq	$16, %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_25
+	WORD $0x8949; BYTE $0xd1     // movq	%rdx, %r9
+	WORD $0x8948; BYTE $0xc6     // movq	%rax, %rsi
+	QUAD $0x00000000850c8d48     // leaq	0(,%rax,4), %rcx
+	WORD $0x2949; BYTE $0xc1     // subq	%rax, %r9
+	LONG $0xff518d4d             // leaq	-1(%r9), %r10
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x06fa8349             // cmpq	$6, %r10
+	JBE  BB0_5
+	QUAD $0x00000000850c8d48     // leaq	0(,%rax,4), %rcx
+	LONG $0x081c8d4d             // leaq	(%r8,%rcx), %r11
+	LONG $0x0f648d4c; BYTE $0x04 // leaq	4(%rdi,%rcx), %r12
+	WORD $0x894c; BYTE $0xdb     // movq	%r11, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x38fb8348             // cmpq	$56, %rbx
+	JA   BB0_55
+
+BB0_5:
+	LONG $0x0459eac5; BYTE $0x87               // vmulss	(%rdi,%rax,4), %xmm2, %xmm0
+	LONG $0x01708d48                           // leaq	1(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x8004             // vmovss	%xmm0, (%r8,%rax,4)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x040f             // vmulss	4(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x02708d48                           // leaq	2(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x04 // vmovss	%xmm0, 4(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x080f             // vmulss	8(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x03708d48                           // leaq	3(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x08 // vmovss	%xmm0, 8(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x0c0f             // vmulss	12(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x04708d48                           // leaq	4(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x0c // vmovss	%xmm0, 12(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x100f             // vmulss	16(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x05708d48                           // leaq	5(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x10 // vmovss	%xmm0, 16(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x140f             // vmulss	20(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x06708d48                           // leaq	6(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x14 // vmovss	%xmm0, 20(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x180f             // vmulss	24(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x07708d48                           // leaq	7(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x18 // vmovss	%xmm0, 24(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x1c0f             // vmulss	28(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x08708d48                           // leaq	8(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x1c // vmovss	%xmm0, 28(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x200f             // vmulss	32(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x09708d48                           // leaq	9(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x20 // vmovss	%xmm0, 32(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x240f             // vmulss	36(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x0a708d48                           // leaq	10(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x24 // vmovss	%xmm0, 36(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x280f             // vmulss	40(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x0b708d48                           // leaq	11(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x28 // vmovss	%xmm0, 40(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x2c0f             // vmulss	44(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x0c708d48                           // leaq	12(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x2c // vmovss	%xmm0, 44(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x300f             // vmulss	48(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x0d708d48                           // leaq	13(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x30 // vmovss	%xmm0, 48(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x340f             // vmulss	52(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x0e708d48                           // leaq	14(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x34 // vmovss	%xmm0, 52(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x380f             // vmulss	56(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x0fc08348                           // addq	$15, %rax
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x38 // vmovss	%xmm0, 56(%r8,%rcx)
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_48
+	LONG $0x5459eac5; WORD $0x3c0f             // vmulss	60(%rdi,%rcx), %xmm2, %xmm2
+	LONG $0x117ac1c4; WORD $0x0854; BYTE $0x3c // vmovss	%xmm2, 60(%r8,%rcx)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	JMP  BB0_49
+
+BB0_55:
+	LONG $0x0efa8349                           // cmpq	$14, %r10
+	JBE  BB0_12
+	LONG $0x4874f162; WORD $0x0c59; BYTE $0x0f // vmulps	(%rdi,%rcx), %zmm1, %zmm1
+	WORD $0x894c; BYTE $0xc9                   // movq	%r9, %rcx
+	LONG $0xf0e18348                           // andq	$-16, %rcx
+	WORD $0x0148; BYTE $0xc8                   // addq	%rcx, %rax
+	LONG $0x487cd162; WORD $0x0b11             // vmovups	%zmm1, (%r11)
+	LONG $0x0fc1f641                           // testb	$15, %r9b
+	JE   BB0_48
+	WORD $0x2949; BYTE $0xc9                   // subq	%rcx, %r9
+	LONG $0xff518d4d                           // leaq	-1(%r9), %r10
+	LONG $0x06fa8349                           // cmpq	$6, %r10
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x0148; BYTE $0xf1       // addq	%rsi, %rcx
+	LONG $0x187de2c4; BYTE $0xc2   // vbroadcastss	%xmm2, %ymm0
+	LONG $0x0459fcc5; BYTE $0x8f   // vmulps	(%rdi,%rcx,4), %ymm0, %ymm0
+	LONG $0x117cc1c4; WORD $0x8804 // vmovups	%ymm0, (%r8,%rcx,4)
+	WORD $0x894c; BYTE $0xc9       // movq	%r9, %rcx
+	LONG $0xf8e18348               // andq	$-8, %rcx
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	LONG $0x07e18341               // andl	$7, %r9d
+	JE   BB0_48
+
+BB0_8:
+	LONG $0x0459eac5; BYTE $0x87               // vmulss	(%rdi,%rax,4), %xmm2, %xmm0
+	LONG $0x01708d48                           // leaq	1(%rax), %rsi
+	QUAD $0x00000000850c8d48                   // leaq	0(,%rax,4), %rcx
+	LONG $0x117ac1c4; WORD $0x8004             // vmovss	%xmm0, (%r8,%rax,4)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x040f             // vmulss	4(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x02708d48                           // leaq	2(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x04 // vmovss	%xmm0, 4(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x080f             // vmulss	8(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x03708d48                           // leaq	3(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x08 // vmovss	%xmm0, 8(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x0c0f             // vmulss	12(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x04708d48                           // leaq	4(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x0c // vmovss	%xmm0, 12(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x100f             // vmulss	16(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x05708d48                           // leaq	5(%rax), %rsi
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x10 // vmovss	%xmm0, 16(%r8,%rcx)
+	WORD $0x3948; BYTE $0xf2                   // cmpq	%rsi, %rdx
+	JLE  BB0_48
+	LONG $0x4459eac5; WORD $0x140f             // vmulss	20(%rdi,%rcx), %xmm2, %xmm0
+	LONG $0x06c08348                           // addq	$6, %rax
+	LONG $0x117ac1c4; WORD $0x0844; BYTE $0x14 // vmovss	%xmm0, 20(%r8,%rcx)
+	WORD $0x3948; BYTE $0xc2                   // cmpq	%rax, %rdx
+	JLE  BB0_48
+	LONG $0x5459eac5; WORD $0x180f             // vmulss	24(%rdi,%rcx), %xmm2, %xmm2
+	LONG $0x117ac1c4; WORD $0x0854; BYTE $0x18 // vmovss	%xmm2, 24(%r8,%rcx)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_48:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+
+BB0_49:
+	RET
+
+BB0_51:
+	RET
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_6
@@ -0,0 +1,120 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basescaleto_c_f64_avx2_amd64.c
+
+TEXT ·scaleto_c_f64_avx2(SB), $0-32
+	MOVQ dst+0(FP), DI
+	MOVQ pc+8(FP), SI
+	MOVQ s+16(FP), DX
+	MOVQ plen_dst+24(FP), CX
+	WORD $0x8b48; BYTE $0x09     // movq	(%rcx), %rcx
+	WORD $0x8548; BYTE $0xc9     // testq	%rcx, %rcx
+	JE   BB0_37
+	LONG $0x1610fbc5             // vmovsd	(%rsi), %xmm2
+	LONG $0x197de2c4; BYTE $0xca // vbroadcastsd	%xmm2, %ymm1
+	LONG $0x03f98348             // cmpq	$3, %rcx
+	JLE  BB0_11
+	LONG $0x000004b8; BYTE $0x00 // movl	$4, %eax
+
+BB0_4:
+	LONG $0x4459f5c5; WORD $0xe0c2 // vmulpd	-32(%rdx,%rax,8), %ymm1, %ymm0
+	LONG $0x4411fdc5; WORD $0xe0c7 // vmovupd	%ymm0, -32(%rdi,%rax,8)
+	LONG $0x04c08348               // addq	$4, %rax
+	WORD $0x3948; BYTE $0xc8       // cmpq	%rcx, %rax
+	JLE  BB0_4
+	LONG $0xfc418d48               // leaq	-4(%rcx), %rax
+	LONG $0x02e8c148               // shrq	$2, %rax
+	QUAD $0x0000000485048d48       // leaq	4(,%rax,4), %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JLE  BB0_29
+	WORD $0x8948; BYTE $0xce     // movq	%rcx, %rsi
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	QUAD $0x00000000c5048d4c     // leaq	0(,%rax,8), %r8
+	WORD $0x2948; BYTE $0xc6     // subq	%rax, %rsi
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x01fe8348             // cmpq	$1, %rsi
+	JE   BB0_5
+	QUAD $0x00000000c5048d4c     // leaq	0(,%rax,8), %r8
+	LONG $0x07148d4e             // leaq	(%rdi,%r8), %r10
+	LONG $0x025c8d4a; BYTE $0x08 // leaq	8(%rdx,%r8), %rbx
+	WORD $0x894d; BYTE $0xd3     // movq	%r10, %r11
+	WORD $0x2949; BYTE $0xdb     // subq	%rbx, %r11
+	LONG $0x10fb8349             // cmpq	$16, %r11
+	JA   BB0_41
+
+BB0_5:
+	LONG $0x0459ebc5; BYTE $0xc2               // vmulsd	(%rdx,%rax,8), %xmm2, %xmm0
+	LONG $0x01708d48                           // leaq	1(%rax), %rsi
+	LONG $0x0411fbc5; BYTE $0xc7               // vmovsd	%xmm0, (%rdi,%rax,8)
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JLE  BB0_34
+	LONG $0x596ba1c4; WORD $0x0244; BYTE $0x08 // vmulsd	8(%rdx,%r8), %xmm2, %xmm0
+	LONG $0x02708d48                           // leaq	2(%rax), %rsi
+	LONG $0x117ba1c4; WORD $0x0744; BYTE $0x08 // vmovsd	%xmm0, 8(%rdi,%r8)
+	WORD $0x3948; BYTE $0xf1                   // cmpq	%rsi, %rcx
+	JLE  BB0_34
+	LONG $0x596ba1c4; WORD $0x0244; BYTE $0x10 // vmulsd	16(%rdx,%r8), %xmm2, %xmm0
+	LONG $0x03c08348                           // addq	$3, %rax
+	LONG $0x117ba1c4; WORD $0x0744; BYTE $0x10 // vmovsd	%xmm0, 16(%rdi,%r8)
+	WORD $0x3948; BYTE $0xc1                   // cmpq	%rax, %rcx
+	JLE  BB0_34
+	LONG $0x596ba1c4; WORD $0x0254; BYTE $0x18 // vmulsd	24(%rdx,%r8), %xmm2, %xmm2
+	LONG $0x117ba1c4; WORD $0x0754; BYTE $0x18 // vmovsd	%xmm2, 24(%rdi,%r8)
+	WORD $0xf8c5; BYTE $0x77                   // vzeroupper
+	RET
+
+BB0_34:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_37:
+	RET
+
+BB0_41:
+	LONG $0xff4e8d48               // leaq	-1(%rsi), %rcx
+	LONG $0x02f98348               // cmpq	$2, %rcx
+	JBE  BB0_12
+	LONG $0x5975a1c4; WORD $0x020c // vmulpd	(%rdx,%r8), %ymm1, %ymm1
+	WORD $0x8948; BYTE $0xf1       // movq	%rsi, %rcx
+	LONG $0xfce18348               // andq	$-4, %rcx
+	WORD $0x0148; BYTE $0xc8       // addq	%rcx, %rax
+	LONG $0x117dc1c4; BYTE $0x0a   // vmovupd	%ymm1, (%r10)
+	LONG $0x03c6f640               // testb	$3, %sil
+	JE   BB0_34
+	WORD $0x2948; BYTE $0xce       // subq	%rcx, %rsi
+	LONG $0x01fe8348               // cmpq	$1, %rsi
+	JE   BB0_8
+
+BB0_6:
+	WORD $0x014c; BYTE $0xc9     // addq	%r9, %rcx
+	LONG $0xc212fbc5             // vmovddup	%xmm2, %xmm0
+	LONG $0x0459f9c5; BYTE $0xca // vmulpd	(%rdx,%rcx,8), %xmm0, %xmm0
+	LONG $0x0411f9c5; BYTE $0xcf // vmovupd	%xmm0, (%rdi,%rcx,8)
+	LONG $0x01c6f640             // testb	$1, %sil
+	JE   BB0_34
+	LONG $0xfee68348             // andq	$-2, %rsi
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+
+BB0_8:
+	LONG $0x1459ebc5; BYTE $0xc2 // vmulsd	(%rdx,%rax,8), %xmm2, %xmm2
+	LONG $0x1411fbc5; BYTE $0xc7 // vmovsd	%xmm2, (%rdi,%rax,8)
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	RET
+
+BB0_29:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xc931 // xorl	%ecx, %ecx
+	JMP  BB0_6
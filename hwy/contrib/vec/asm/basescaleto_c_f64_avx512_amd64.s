@@ -0,0 +1,153 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basescaleto_c_f64_avx512_amd64.c
+
+TEXT ·scaleto_c_f64_avx512(SB), $0-32
+	MOVQ dst+0(FP), DI
+	MOVQ pc+8(FP), SI
+	MOVQ s+16(FP), DX
+	MOVQ plen_dst+24(FP), CX
+	WORD $0x8b48; BYTE $0x09       // movq	(%rcx), %rcx
+	WORD $0x8548; BYTE $0xc9       // testq	%rcx, %rcx
+	JE   BB0_39
+	LONG $0x1610fbc5               // vmovsd	(%rsi), %xmm2
+	LONG $0x48fdf262; WORD $0xca19 // vbroadcastsd	%xmm2, %zmm1
+	LONG $0x07f98348               // cmpq	$7, %rcx
+	JLE  BB0_11
+	LONG $0x000008b8; BYTE $0x00   // movl	$8, %eax
+
+BB0_4:
+	QUAD $0xffc2445948f5f162 // vmulpd	-64(%rdx,%rax,8), %zmm1, %zmm0
+	QUAD $0xffc7441148fdf162 // vmovupd	%zmm0, -64(%rdi,%rax,8)
+	LONG $0x08c08348         // addq	$8, %rax
+	WORD $0x3948; BYTE $0xc8 // cmpq	%rcx, %rax
+	JLE  BB0_4
+	LONG $0xf8418d48         // leaq	-8(%rcx), %rax
+	LONG $0x03e8c148         // shrq	$3, %rax
+	QUAD $0x00000008c5048d48 // leaq	8(,%rax,8), %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JLE  BB0_25
+	WORD $0x8949; BYTE $0xc8     // movq	%rcx, %r8
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	QUAD $0x00000000c5348d48     // leaq	0(,%rax,8), %rsi
+	WORD $0x2949; BYTE $0xc0     // subq	%rax, %r8
+	LONG $0xff508d4d             // leaq	-1(%r8), %r10
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_5
+	QUAD $0x00000000c5348d48     // leaq	0(,%rax,8), %rsi
+	LONG $0x371c8d4c             // leaq	(%rdi,%rsi), %r11
+	LONG $0x32648d4c; BYTE $0x08 // leaq	8(%rdx,%rsi), %r12
+	WORD $0x894c; BYTE $0xdb     // movq	%r11, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x30fb8348             // cmpq	$48, %rbx
+	JA   BB0_43
+
+BB0_5:
+	LONG $0x0459ebc5; BYTE $0xc2   // vmulsd	(%rdx,%rax,8), %xmm2, %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	LONG $0x0411fbc5; BYTE $0xc7   // vmovsd	%xmm0, (%rdi,%rax,8)
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_36
+	LONG $0x4459ebc5; WORD $0x0832 // vmulsd	8(%rdx,%rsi), %xmm2, %xmm0
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x0837 // vmovsd	%xmm0, 8(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_36
+	LONG $0x4459ebc5; WORD $0x1032 // vmulsd	16(%rdx,%rsi), %xmm2, %xmm0
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x1037 // vmovsd	%xmm0, 16(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_36
+	LONG $0x4459ebc5; WORD $0x1832 // vmulsd	24(%rdx,%rsi), %xmm2, %xmm0
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x1837 // vmovsd	%xmm0, 24(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_36
+	LONG $0x4459ebc5; WORD $0x2032 // vmulsd	32(%rdx,%rsi), %xmm2, %xmm0
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x2037 // vmovsd	%xmm0, 32(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_36
+	LONG $0x4459ebc5; WORD $0x2832 // vmulsd	40(%rdx,%rsi), %xmm2, %xmm0
+	LONG $0x06408d4c               // leaq	6(%rax), %r8
+	LONG $0x4411fbc5; WORD $0x2837 // vmovsd	%xmm0, 40(%rdi,%rsi)
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_36
+	LONG $0x4459ebc5; WORD $0x3032 // vmulsd	48(%rdx,%rsi), %xmm2, %xmm0
+	LONG $0x07c08348               // addq	$7, %rax
+	LONG $0x4411fbc5; WORD $0x3037 // vmovsd	%xmm0, 48(%rdi,%rsi)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_36
+	LONG $0x5459ebc5; WORD $0x3832 // vmulsd	56(%rdx,%rsi), %xmm2, %xmm2
+	LONG $0x5411fbc5; WORD $0x3837 // vmovsd	%xmm2, 56(%rdi,%rsi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_43:
+	LONG $0x06fa8349                           // cmpq	$6, %r10
+	JBE  BB0_12
+	LONG $0x48f5f162; WORD $0x0c59; BYTE $0x32 // vmulpd	(%rdx,%rsi), %zmm1, %zmm1
+	WORD $0x894c; BYTE $0xc6                   // movq	%r8, %rsi
+	LONG $0xf8e68348                           // andq	$-8, %rsi
+	WORD $0x0148; BYTE $0xf0                   // addq	%rsi, %rax
+	LONG $0x48fdd162; WORD $0x0b11             // vmovupd	%zmm1, (%r11)
+	LONG $0x07c0f641                           // testb	$7, %r8b
+	JE   BB0_36
+	WORD $0x2949; BYTE $0xf0                   // subq	%rsi, %r8
+	LONG $0xff508d4d                           // leaq	-1(%r8), %r10
+	LONG $0x02fa8349                           // cmpq	$2, %r10
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x014c; BYTE $0xce     // addq	%r9, %rsi
+	LONG $0x197de2c4; BYTE $0xc2 // vbroadcastsd	%xmm2, %ymm0
+	LONG $0x0459fdc5; BYTE $0xf2 // vmulpd	(%rdx,%rsi,8), %ymm0, %ymm0
+	LONG $0x0411fdc5; BYTE $0xf7 // vmovupd	%ymm0, (%rdi,%rsi,8)
+	WORD $0x894c; BYTE $0xc6     // movq	%r8, %rsi
+	LONG $0xfce68348             // andq	$-4, %rsi
+	WORD $0x0148; BYTE $0xf0     // addq	%rsi, %rax
+	LONG $0x03e08341             // andl	$3, %r8d
+	JE   BB0_36
+
+BB0_8:
+	LONG $0x0459ebc5; BYTE $0xc2   // vmulsd	(%rdx,%rax,8), %xmm2, %xmm0
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	QUAD $0x00000000c5348d48       // leaq	0(,%rax,8), %rsi
+	LONG $0x0411fbc5; BYTE $0xc7   // vmovsd	%xmm0, (%rdi,%rax,8)
+	WORD $0x394c; BYTE $0xc1       // cmpq	%r8, %rcx
+	JLE  BB0_36
+	LONG $0x4459ebc5; WORD $0x0832 // vmulsd	8(%rdx,%rsi), %xmm2, %xmm0
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x4411fbc5; WORD $0x0837 // vmovsd	%xmm0, 8(%rdi,%rsi)
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_36
+	LONG $0x5459ebc5; WORD $0x1032 // vmulsd	16(%rdx,%rsi), %xmm2, %xmm2
+	LONG $0x5411fbc5; WORD $0x1037 // vmovsd	%xmm2, 16(%rdi,%rsi)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_36:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_39:
+	RET
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xf631 // xorl	%esi, %esi
+	JMP  BB0_6
@@ -0,0 +1,220 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basesquarednorm_c_f32_avx512_amd64.c
+
+TEXT ·squarednorm_c_f32_avx512(SB), $0-24
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x36       // movq	(%rsi), %rsi
+	WORD $0x8948; BYTE $0xf9       // movq	%rdi, %rcx
+	WORD $0x8949; BYTE $0xd1       // movq	%rdx, %r9
+	LONG $0xc057f8c5               // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x8548; BYTE $0xf6       // testq	%rsi, %rsi
+	JE   BB0_2
+	LONG $0x3ffe8348               // cmpq	$63, %rsi
+	JLE  BB0_14
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xc07e8d48               // leaq	-64(%rsi), %rdi
+	LONG $0xdb57e0c5               // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x06efc148               // shrq	$6, %rdi
+	LONG $0x487cf162; WORD $0xd328 // vmovaps	%zmm3, %zmm2
+	LONG $0x487cf162; WORD $0xcb28 // vmovaps	%zmm3, %zmm1
+	WORD $0x8948; BYTE $0xfa       // movq	%rdi, %rdx
+	LONG $0x487cf162; WORD $0xc328 // vmovaps	%zmm3, %zmm0
+	LONG $0x08e2c148               // salq	$8, %rdx
+	QUAD $0x0000010011948d48       // leaq	256(%rcx,%rdx), %rdx
+
+BB0_4:
+	LONG $0x487cf162; WORD $0x2810             // vmovups	(%rax), %zmm5
+	LONG $0x487cf162; WORD $0x7010; BYTE $0x01 // vmovups	64(%rax), %zmm6
+	LONG $0x01000548; WORD $0x0000             // addq	$256, %rax
+	LONG $0x487cf162; WORD $0x7810; BYTE $0xfe // vmovups	-128(%rax), %zmm7
+	LONG $0x4855f262; WORD $0xc5b8             // vfmadd231ps	%zmm5, %zmm5, %zmm0
+	LONG $0x487cf162; WORD $0x6810; BYTE $0xff // vmovups	-64(%rax), %zmm5
+	LONG $0x484df262; WORD $0xceb8             // vfmadd231ps	%zmm6, %zmm6, %zmm1
+	LONG $0x4845f262; WORD $0xd7b8             // vfmadd231ps	%zmm7, %zmm7, %zmm2
+	LONG $0x4855f262; WORD $0xddb8             // vfmadd231ps	%zmm5, %zmm5, %zmm3
+	WORD $0x3948; BYTE $0xd0                   // cmpq	%rdx, %rax
+	JNE  BB0_4
+	LONG $0x01478d48                           // leaq	1(%rdi), %rax
+	LONG $0x486cf162; WORD $0xdb58             // vaddps	%zmm3, %zmm2, %zmm3
+	LONG $0x06e0c148                           // salq	$6, %rax
+	LONG $0x10408d4c                           // leaq	16(%rax), %r8
+
+BB0_3:
+	WORD $0x394c; BYTE $0xc6 // cmpq	%r8, %rsi
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xc2 // movq	%r8, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc7                   // movq	%rax, %rdi
+	WORD $0x8948; BYTE $0xd0                   // movq	%rdx, %rax
+	LONG $0x10528d48                           // leaq	16(%rdx), %rdx
+	LONG $0x487cf162; WORD $0x1410; BYTE $0xb9 // vmovups	(%rcx,%rdi,4), %zmm2
+	LONG $0x486df262; WORD $0xc2b8             // vfmadd231ps	%zmm2, %zmm2, %zmm0
+	WORD $0x3948; BYTE $0xd6                   // cmpq	%rdx, %rsi
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xf0                   // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xc0                   // subq	%r8, %rax
+	LONG $0xf0e08348                           // andq	$-16, %rax
+	WORD $0x014c; BYTE $0xc0                   // addq	%r8, %rax
+
+BB0_5:
+	LONG $0x4874f162; WORD $0xc858             // vaddps	%zmm0, %zmm1, %zmm1
+	LONG $0x4874f162; WORD $0xcb58             // vaddps	%zmm3, %zmm1, %zmm1
+	LONG $0x48fdf362; WORD $0xc81b; BYTE $0x01 // vextractf64x4	$0x1, %zmm1, %ymm0
+	LONG $0xc158fcc5                           // vaddps	%ymm1, %ymm0, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc128f8c5                           // vmovaps	%xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JLE  BB0_33
+	WORD $0x8948; BYTE $0xf7                   // movq	%rsi, %rdi
+	WORD $0x8949; BYTE $0xc2                   // movq	%rax, %r10
+	WORD $0x2948; BYTE $0xc7                   // subq	%rax, %rdi
+	LONG $0xff578d48                           // leaq	-1(%rdi), %rdx
+	LONG $0x0efa8348                           // cmpq	$14, %rdx
+	JBE  BB0_15
+	WORD $0x8949; BYTE $0xf8                   // movq	%rdi, %r8
+	LONG $0x81148d48                           // leaq	(%rcx,%rax,4), %rdx
+	LONG $0x04e8c149                           // shrq	$4, %r8
+	LONG $0x06e0c149                           // salq	$6, %r8
+	WORD $0x0149; BYTE $0xd0                   // addq	%rdx, %r8
+
+BB0_8:
+	LONG $0x487cf162; WORD $0x3210             // vmovups	(%rdx), %zmm6
+	LONG $0x40c28348                           // addq	$64, %rdx
+	LONG $0x484cf162; WORD $0xce59             // vmulps	%zmm6, %zmm6, %zmm1
+	LONG $0xe1c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm4
+	LONG $0xd9c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm3
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm2
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xe058dac5                           // vaddss	%xmm0, %xmm4, %xmm4
+	LONG $0xc115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm0
+	LONG $0xc458fac5                           // vaddss	%xmm4, %xmm0, %xmm0
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0x287df362; WORD $0xc819; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm0
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd903; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm3
+	LONG $0xd858e2c5                           // vaddss	%xmm0, %xmm3, %xmm3
+	LONG $0x2875f362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm0
+	LONG $0x487df362; WORD $0xc91b; BYTE $0x01 // vextractf32x8	$0x1, %zmm1, %ymm1
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0xc1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm0
+	LONG $0xd258f2c5                           // vaddss	%xmm2, %xmm1, %xmm2
+	LONG $0xda58e2c5                           // vaddss	%xmm2, %xmm3, %xmm3
+	LONG $0xd115f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm2
+	LONG $0xd358eac5                           // vaddss	%xmm3, %xmm2, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG $0xc058eac5                           // vaddss	%xmm0, %xmm2, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xd058eac5                           // vaddss	%xmm0, %xmm2, %xmm2
+	LONG $0x2875f362; WORD $0xc103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm0
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xd0                   // cmpq	%rdx, %r8
+	JNE  BB0_8
+	WORD $0x8948; BYTE $0xfa                   // movq	%rdi, %rdx
+	LONG $0xf0e28348                           // andq	$-16, %rdx
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	LONG $0x0fc7f640                           // testb	$15, %dil
+	JE   BB0_33
+
+BB0_7:
+	WORD $0x2948; BYTE $0xd7                   // subq	%rdx, %rdi
+	LONG $0xff478d4c                           // leaq	-1(%rdi), %r8
+	LONG $0x06f88349                           // cmpq	$6, %r8
+	JBE  BB0_11
+	WORD $0x014c; BYTE $0xd2                   // addq	%r10, %rdx
+	LONG $0x0c10fcc5; BYTE $0x91               // vmovups	(%rcx,%rdx,4), %ymm1
+	WORD $0x8948; BYTE $0xfa                   // movq	%rdi, %rdx
+	LONG $0xf8e28348                           // andq	$-8, %rdx
+	LONG $0xc959f4c5                           // vmulps	%ymm1, %ymm1, %ymm1
+	WORD $0x0148; BYTE $0xd0                   // addq	%rdx, %rax
+	WORD $0xe783; BYTE $0x07                   // andl	$7, %edi
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	LONG $0xd9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm3
+	LONG $0xd1c6f0c5; BYTE $0xff               // vshufps	$255, %xmm1, %xmm1, %xmm2
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xd915f0c5                           // vunpckhps	%xmm1, %xmm1, %xmm3
+	LONG $0xc358fac5                           // vaddss	%xmm3, %xmm0, %xmm0
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x287df362; WORD $0xca19; BYTE $0x01 // vextractf32x4	$1, %ymm1, %xmm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x05 // valignd	$5, %ymm1, %ymm1, %ymm2
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0x2875f362; WORD $0xd103; BYTE $0x06 // valignd	$6, %ymm1, %ymm1, %ymm2
+	LONG $0x2875f362; WORD $0xc903; BYTE $0x07 // valignd	$7, %ymm1, %ymm1, %ymm1
+	LONG $0xc258fac5                           // vaddss	%xmm2, %xmm0, %xmm0
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	JE   BB0_33
+
+BB0_11:
+	LONG $0x0c10fac5; BYTE $0x81   // vmovss	(%rcx,%rax,4), %xmm1
+	LONG $0x01788d48               // leaq	1(%rax), %rdi
+	QUAD $0x0000000085148d48       // leaq	0(,%rax,4), %rdx
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xfe       // cmpq	%rdi, %rsi
+	JLE  BB0_33
+	LONG $0x4c10fac5; WORD $0x0411 // vmovss	4(%rcx,%rdx), %xmm1
+	LONG $0x02788d48               // leaq	2(%rax), %rdi
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xfe       // cmpq	%rdi, %rsi
+	JLE  BB0_33
+	LONG $0x4c10fac5; WORD $0x0811 // vmovss	8(%rcx,%rdx), %xmm1
+	LONG $0x03788d48               // leaq	3(%rax), %rdi
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xfe       // cmpq	%rdi, %rsi
+	JLE  BB0_33
+	LONG $0x4c10fac5; WORD $0x0c11 // vmovss	12(%rcx,%rdx), %xmm1
+	LONG $0x04788d48               // leaq	4(%rax), %rdi
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xfe       // cmpq	%rdi, %rsi
+	JLE  BB0_33
+	LONG $0x4c10fac5; WORD $0x1011 // vmovss	16(%rcx,%rdx), %xmm1
+	LONG $0x05788d48               // leaq	5(%rax), %rdi
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xfe       // cmpq	%rdi, %rsi
+	JLE  BB0_33
+	LONG $0x4c10fac5; WORD $0x1411 // vmovss	20(%rcx,%rdx), %xmm1
+	LONG $0x06c08348               // addq	$6, %rax
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_33
+	LONG $0x4c10fac5; WORD $0x1811 // vmovss	24(%rcx,%rdx), %xmm1
+	LONG $0xb971e2c4; BYTE $0xc1   // vfmadd231ss	%xmm1, %xmm1, %xmm0
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+
+BB0_2:
+	LONG $0x117ac1c4; BYTE $0x01 // vmovss	%xmm0, (%r9)
+	RET
+
+BB0_33:
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117ac1c4; BYTE $0x01 // vmovss	%xmm0, (%r9)
+	RET
+
+BB0_14:
+	LONG $0xdb57e0c5               // vxorps	%xmm3, %xmm3, %xmm3
+	LONG $0x0010b841; WORD $0x0000 // movl	$16, %r8d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0x487cf162; WORD $0xcb28 // vmovaps	%zmm3, %zmm1
+	LONG $0x487cf162; WORD $0xc328 // vmovaps	%zmm3, %zmm0
+	JMP  BB0_3
+
+BB0_15:
+	WORD $0xd231 // xorl	%edx, %edx
+	JMP  BB0_7
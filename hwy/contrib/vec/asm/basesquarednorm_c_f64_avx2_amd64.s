@@ -0,0 +1,136 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basesquarednorm_c_f64_avx2_amd64.c
+
+TEXT ·squarednorm_c_f64_avx2(SB), $0-24
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x36 // movq	(%rsi), %rsi
+	WORD $0x8949; BYTE $0xd0 // movq	%rdx, %r8
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x8548; BYTE $0xf6 // testq	%rsi, %rsi
+	JE   BB0_2
+	LONG $0x0ffe8348         // cmpq	$15, %rsi
+	JLE  BB0_12
+	LONG $0xf04e8d48         // leaq	-16(%rsi), %rcx
+	LONG $0xdb57e1c5         // vxorpd	%xmm3, %xmm3, %xmm3
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	LONG $0xd328fdc5         // vmovapd	%ymm3, %ymm2
+	LONG $0x04e9c148         // shrq	$4, %rcx
+	LONG $0xcb28fdc5         // vmovapd	%ymm3, %ymm1
+	LONG $0xc328fdc5         // vmovapd	%ymm3, %ymm0
+	WORD $0x8948; BYTE $0xca // movq	%rcx, %rdx
+	LONG $0x07e2c148         // salq	$7, %rdx
+	QUAD $0x0000008017948d48 // leaq	128(%rdi,%rdx), %rdx
+
+BB0_4:
+	LONG $0x2010fdc5             // vmovupd	(%rax), %ymm4
+	LONG $0x6810fdc5; BYTE $0x20 // vmovupd	32(%rax), %ymm5
+	LONG $0x80e88348             // subq	$-128, %rax
+	LONG $0x7010fdc5; BYTE $0xc0 // vmovupd	-64(%rax), %ymm6
+	LONG $0x7810fdc5; BYTE $0xe0 // vmovupd	-32(%rax), %ymm7
+	LONG $0xb8dde2c4; BYTE $0xc4 // vfmadd231pd	%ymm4, %ymm4, %ymm0
+	LONG $0xb8d5e2c4; BYTE $0xcd // vfmadd231pd	%ymm5, %ymm5, %ymm1
+	LONG $0xb8cde2c4; BYTE $0xd6 // vfmadd231pd	%ymm6, %ymm6, %ymm2
+	LONG $0xb8c5e2c4; BYTE $0xdf // vfmadd231pd	%ymm7, %ymm7, %ymm3
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JNE  BB0_4
+	LONG $0x01418d48             // leaq	1(%rcx), %rax
+	LONG $0xdb58edc5             // vaddpd	%ymm3, %ymm2, %ymm3
+	LONG $0x04e0c148             // salq	$4, %rax
+	LONG $0x04488d4c             // leaq	4(%rax), %r9
+
+BB0_3:
+	WORD $0x394c; BYTE $0xce // cmpq	%r9, %rsi
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xca // movq	%r9, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc1     // movq	%rax, %rcx
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	LONG $0x04528d48             // leaq	4(%rdx), %rdx
+	LONG $0x1410fdc5; BYTE $0xcf // vmovupd	(%rdi,%rcx,8), %ymm2
+	LONG $0xb8ede2c4; BYTE $0xc2 // vfmadd231pd	%ymm2, %ymm2, %ymm0
+	WORD $0x3948; BYTE $0xd6     // cmpq	%rdx, %rsi
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xf0     // movq	%rsi, %rax
+	WORD $0x294c; BYTE $0xc8     // subq	%r9, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x014c; BYTE $0xc8     // addq	%r9, %rax
+
+BB0_5:
+	LONG $0xc858f5c5               // vaddpd	%ymm0, %ymm1, %ymm1
+	LONG $0xcb58f5c5               // vaddpd	%ymm3, %ymm1, %ymm1
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_23
+	WORD $0x8949; BYTE $0xf1       // movq	%rsi, %r9
+	WORD $0x2949; BYTE $0xc1       // subq	%rax, %r9
+	LONG $0xff518d49               // leaq	-1(%r9), %rdx
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_7
+	WORD $0x894c; BYTE $0xc9       // movq	%r9, %rcx
+	LONG $0xc7148d48               // leaq	(%rdi,%rax,8), %rdx
+	LONG $0x02e9c148               // shrq	$2, %rcx
+	LONG $0x05e1c148               // salq	$5, %rcx
+	WORD $0x0148; BYTE $0xd1       // addq	%rdx, %rcx
+
+BB0_8:
+	LONG $0x2210fdc5               // vmovupd	(%rdx), %ymm4
+	LONG $0x20c28348               // addq	$32, %rdx
+	LONG $0xcc59ddc5               // vmulpd	%ymm4, %ymm4, %ymm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	LONG $0xd115f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm2
+	LONG $0x197de3c4; WORD $0x01c9 // vextractf128	$0x1, %ymm1, %xmm1
+	LONG $0xd058ebc5               // vaddsd	%xmm0, %xmm2, %xmm2
+	LONG $0xc258f3c5               // vaddsd	%xmm2, %xmm1, %xmm0
+	LONG $0xc915f1c5               // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JNE  BB0_8
+	WORD $0x894c; BYTE $0xca       // movq	%r9, %rdx
+	LONG $0xfce28348               // andq	$-4, %rdx
+	WORD $0x0148; BYTE $0xd0       // addq	%rdx, %rax
+	LONG $0x03e18341               // andl	$3, %r9d
+	JE   BB0_23
+
+BB0_7:
+	LONG $0x0c10fbc5; BYTE $0xc7   // vmovsd	(%rdi,%rax,8), %xmm1
+	LONG $0x01488d48               // leaq	1(%rax), %rcx
+	QUAD $0x00000000c5148d48       // leaq	0(,%rax,8), %rdx
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xce       // cmpq	%rcx, %rsi
+	JLE  BB0_23
+	LONG $0x4c10fbc5; WORD $0x0817 // vmovsd	8(%rdi,%rdx), %xmm1
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0x3948; BYTE $0xc6       // cmpq	%rax, %rsi
+	JLE  BB0_23
+	LONG $0x4c10fbc5; WORD $0x1017 // vmovsd	16(%rdi,%rdx), %xmm1
+	LONG $0xb9f1e2c4; BYTE $0xc1   // vfmadd231sd	%xmm1, %xmm1, %xmm0
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+
+BB0_2:
+	LONG $0x117bc1c4; BYTE $0x00 // vmovsd	%xmm0, (%r8)
+	RET
+
+BB0_23:
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117bc1c4; BYTE $0x00 // vmovsd	%xmm0, (%r8)
+	RET
+
+BB0_12:
+	LONG $0xdb57e1c5               // vxorpd	%xmm3, %xmm3, %xmm3
+	LONG $0x0004b941; WORD $0x0000 // movl	$4, %r9d
+	WORD $0xc031                   // xorl	%eax, %eax
+	LONG $0xcb28fdc5               // vmovapd	%ymm3, %ymm1
+	LONG $0xc328fdc5               // vmovapd	%ymm3, %ymm0
+	JMP  BB0_3
@@ -0,0 +1,176 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basesub_c_f32_avx2_amd64.c
+
+TEXT ·sub_c_f32_avx2(SB), $0-24
+	MOVQ dst+0(FP), DI
+	MOVQ s+8(FP), SI
+	MOVQ plen_dst+16(FP), DX
+	WORD $0x8b48; BYTE $0x12     // movq	(%rdx), %rdx
+	WORD $0x8548; BYTE $0xd2     // testq	%rdx, %rdx
+	JE   BB0_39
+	WORD $0x8948; BYTE $0xf9     // movq	%rdi, %rcx
+	LONG $0x07fa8348             // cmpq	$7, %rdx
+	JLE  BB0_11
+	LONG $0x000008b8; BYTE $0x00 // movl	$8, %eax
+
+BB0_4:
+	LONG $0x4c10fcc5; WORD $0xe081 // vmovups	-32(%rcx,%rax,4), %ymm1
+	LONG $0x445cf4c5; WORD $0xe086 // vsubps	-32(%rsi,%rax,4), %ymm1, %ymm0
+	LONG $0x4411fcc5; WORD $0xe081 // vmovups	%ymm0, -32(%rcx,%rax,4)
+	LONG $0x08c08348               // addq	$8, %rax
+	WORD $0x3948; BYTE $0xd0       // cmpq	%rdx, %rax
+	JLE  BB0_4
+	LONG $0xf8428d48               // leaq	-8(%rdx), %rax
+	LONG $0x03e8c148               // shrq	$3, %rax
+	QUAD $0x00000008c5048d48       // leaq	8(,%rax,8), %rax
+
+BB0_3:
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JLE  BB0_25
+	WORD $0x8949; BYTE $0xd0     // movq	%rdx, %r8
+	WORD $0x8949; BYTE $0xc1     // movq	%rax, %r9
+	QUAD $0x00000000853c8d48     // leaq	0(,%rax,4), %rdi
+	WORD $0x2949; BYTE $0xc0     // subq	%rax, %r8
+	LONG $0xff588d4d             // leaq	-1(%r8), %r11
+	WORD $0x8948; BYTE $0xe5     // movq	%rsp, %rbp
+	LONG $0x02fb8349             // cmpq	$2, %r11
+	JBE  BB0_5
+	QUAD $0x00000000853c8d48     // leaq	0(,%rax,4), %rdi
+	LONG $0x39148d4c             // leaq	(%rcx,%rdi), %r10
+	LONG $0x3e648d4c; BYTE $0x04 // leaq	4(%rsi,%rdi), %r12
+	WORD $0x894c; BYTE $0xd3     // movq	%r10, %rbx
+	WORD $0x294c; BYTE $0xe3     // subq	%r12, %rbx
+	LONG $0x18fb8348             // cmpq	$24, %rbx
+	JA   BB0_43
+
+BB0_5:
+	LONG $0x39048d4c               // leaq	(%rcx,%rdi), %r8
+	LONG $0x107ac1c4; BYTE $0x00   // vmovss	(%r8), %xmm0
+	LONG $0x045cfac5; BYTE $0x86   // vsubss	(%rsi,%rax,4), %xmm0, %xmm0
+	LONG $0x117ac1c4; BYTE $0x00   // vmovss	%xmm0, (%r8)
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x39448d4c; BYTE $0x04   // leaq	4(%rcx,%rdi), %r8
+	LONG $0x107ac1c4; BYTE $0x00   // vmovss	(%r8), %xmm0
+	LONG $0x445cfac5; WORD $0x043e // vsubss	4(%rsi,%rdi), %xmm0, %xmm0
+	LONG $0x117ac1c4; BYTE $0x00   // vmovss	%xmm0, (%r8)
+	LONG $0x02408d4c               // leaq	2(%rax), %r8
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x39448d4c; BYTE $0x08   // leaq	8(%rcx,%rdi), %r8
+	LONG $0x107ac1c4; BYTE $0x00   // vmovss	(%r8), %xmm0
+	LONG $0x445cfac5; WORD $0x083e // vsubss	8(%rsi,%rdi), %xmm0, %xmm0
+	LONG $0x117ac1c4; BYTE $0x00   // vmovss	%xmm0, (%r8)
+	LONG $0x03408d4c               // leaq	3(%rax), %r8
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x39448d4c; BYTE $0x0c   // leaq	12(%rcx,%rdi), %r8
+	LONG $0x107ac1c4; BYTE $0x00   // vmovss	(%r8), %xmm0
+	LONG $0x445cfac5; WORD $0x0c3e // vsubss	12(%rsi,%rdi), %xmm0, %xmm0
+	LONG $0x117ac1c4; BYTE $0x00   // vmovss	%xmm0, (%r8)
+	LONG $0x04408d4c               // leaq	4(%rax), %r8
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x39448d4c; BYTE $0x10   // leaq	16(%rcx,%rdi), %r8
+	LONG $0x107ac1c4; BYTE $0x00   // vmovss	(%r8), %xmm0
+	LONG $0x445cfac5; WORD $0x103e // vsubss	16(%rsi,%rdi), %xmm0, %xmm0
+	LONG $0x117ac1c4; BYTE $0x00   // vmovss	%xmm0, (%r8)
+	LONG $0x05408d4c               // leaq	5(%rax), %r8
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x39448d4c; BYTE $0x14   // leaq	20(%rcx,%rdi), %r8
+	LONG $0x107ac1c4; BYTE $0x00   // vmovss	(%r8), %xmm0
+	LONG $0x445cfac5; WORD $0x143e // vsubss	20(%rsi,%rdi), %xmm0, %xmm0
+	LONG $0x117ac1c4; BYTE $0x00   // vmovss	%xmm0, (%r8)
+	LONG $0x06408d4c               // leaq	6(%rax), %r8
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x39448d4c; BYTE $0x18   // leaq	24(%rcx,%rdi), %r8
+	LONG $0x07c08348               // addq	$7, %rax
+	LONG $0x107ac1c4; BYTE $0x00   // vmovss	(%r8), %xmm0
+	LONG $0x445cfac5; WORD $0x183e // vsubss	24(%rsi,%rdi), %xmm0, %xmm0
+	LONG $0x117ac1c4; BYTE $0x00   // vmovss	%xmm0, (%r8)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_36
+	LONG $0x39448d48; BYTE $0x1c   // leaq	28(%rcx,%rdi), %rax
+	LONG $0x0010fac5               // vmovss	(%rax), %xmm0
+	LONG $0x445cfac5; WORD $0x1c3e // vsubss	28(%rsi,%rdi), %xmm0, %xmm0
+	LONG $0x0011fac5               // vmovss	%xmm0, (%rax)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_43:
+	LONG $0x06fb8349             // cmpq	$6, %r11
+	JBE  BB0_12
+	LONG $0x107cc1c4; BYTE $0x1a // vmovups	(%r10), %ymm3
+	LONG $0x045ce4c5; BYTE $0x3e // vsubps	(%rsi,%rdi), %ymm3, %ymm0
+	WORD $0x894c; BYTE $0xc7     // movq	%r8, %rdi
+	LONG $0xf8e78348             // andq	$-8, %rdi
+	WORD $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	LONG $0x117cc1c4; BYTE $0x02 // vmovups	%ymm0, (%r10)
+	LONG $0x07c0f641             // testb	$7, %r8b
+	JE   BB0_36
+	WORD $0x2949; BYTE $0xf8     // subq	%rdi, %r8
+	LONG $0xff508d4d             // leaq	-1(%r8), %r10
+	LONG $0x02fa8349             // cmpq	$2, %r10
+	JBE  BB0_8
+
+BB0_6:
+	WORD $0x014c; BYTE $0xcf     // addq	%r9, %rdi
+	LONG $0xb90c8d4c             // leaq	(%rcx,%rdi,4), %r9
+	LONG $0x1078c1c4; BYTE $0x11 // vmovups	(%r9), %xmm2
+	LONG $0x045ce8c5; BYTE $0xbe // vsubps	(%rsi,%rdi,4), %xmm2, %xmm0
+	WORD $0x894c; BYTE $0xc7     // movq	%r8, %rdi
+	LONG $0xfce78348             // andq	$-4, %rdi
+	WORD $0x0148; BYTE $0xf8     // addq	%rdi, %rax
+	LONG $0x03e08341             // andl	$3, %r8d
+	LONG $0x1178c1c4; BYTE $0x01 // vmovups	%xmm0, (%r9)
+	JE   BB0_36
+
+BB0_8:
+	QUAD $0x00000000853c8d48       // leaq	0(,%rax,4), %rdi
+	LONG $0x39048d4c               // leaq	(%rcx,%rdi), %r8
+	LONG $0x107ac1c4; BYTE $0x00   // vmovss	(%r8), %xmm0
+	LONG $0x045cfac5; BYTE $0x86   // vsubss	(%rsi,%rax,4), %xmm0, %xmm0
+	LONG $0x117ac1c4; BYTE $0x00   // vmovss	%xmm0, (%r8)
+	LONG $0x01408d4c               // leaq	1(%rax), %r8
+	WORD $0x394c; BYTE $0xc2       // cmpq	%r8, %rdx
+	JLE  BB0_36
+	LONG $0x39448d4c; BYTE $0x04   // leaq	4(%rcx,%rdi), %r8
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x107ac1c4; BYTE $0x00   // vmovss	(%r8), %xmm0
+	LONG $0x445cfac5; WORD $0x043e // vsubss	4(%rsi,%rdi), %xmm0, %xmm0
+	LONG $0x117ac1c4; BYTE $0x00   // vmovss	%xmm0, (%r8)
+	WORD $0x3948; BYTE $0xc2       // cmpq	%rax, %rdx
+	JLE  BB0_36
+	LONG $0x39448d48; BYTE $0x08   // leaq	8(%rcx,%rdi), %rax
+	LONG $0x0010fac5               // vmovss	(%rax), %xmm0
+	LONG $0x445cfac5; WORD $0x083e // vsubss	8(%rsi,%rdi), %xmm0, %xmm0
+	LONG $0x0011fac5               // vmovss	%xmm0, (%rax)
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+	RET
+
+BB0_36:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_39:
+	RET
+
+BB0_25:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	RET
+
+BB0_11:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_3
+
+BB0_12:
+	WORD $0xff31 // xorl	%edi, %edi
+	JMP  BB0_6
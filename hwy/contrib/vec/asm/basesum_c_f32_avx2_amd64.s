@@ -0,0 +1,143 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basesum_c_f32_avx2_amd64.c
+
+TEXT ·sum_c_f32_avx2(SB), $0-24
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x0e // movq	(%rsi), %rcx
+	WORD $0x8949; BYTE $0xd0 // movq	%rdx, %r8
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x8548; BYTE $0xc9 // testq	%rcx, %rcx
+	JE   BB0_2
+	LONG $0x1ff98348         // cmpq	$31, %rcx
+	JLE  BB0_12
+	LONG $0xe0518d48         // leaq	-32(%rcx), %rdx
+	LONG $0xc057f8c5         // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	LONG $0xd028fcc5         // vmovaps	%ymm0, %ymm2
+	LONG $0x05eac148         // shrq	$5, %rdx
+	LONG $0xd828fcc5         // vmovaps	%ymm0, %ymm3
+	LONG $0xc828fcc5         // vmovaps	%ymm0, %ymm1
+	WORD $0x8948; BYTE $0xd6 // movq	%rdx, %rsi
+	LONG $0x07e6c148         // salq	$7, %rsi
+	QUAD $0x0000008037b48d48 // leaq	128(%rdi,%rsi), %rsi
+
+BB0_4:
+	LONG $0x0858f4c5             // vaddps	(%rax), %ymm1, %ymm1
+	LONG $0x5858e4c5; BYTE $0x20 // vaddps	32(%rax), %ymm3, %ymm3
+	LONG $0x80e88348             // subq	$-128, %rax
+	LONG $0x5058ecc5; BYTE $0xc0 // vaddps	-64(%rax), %ymm2, %ymm2
+	LONG $0x4058fcc5; BYTE $0xe0 // vaddps	-32(%rax), %ymm0, %ymm0
+	WORD $0x3948; BYTE $0xc6     // cmpq	%rax, %rsi
+	JNE  BB0_4
+	LONG $0xcb58f4c5             // vaddps	%ymm3, %ymm1, %ymm1
+	LONG $0xc258fcc5             // vaddps	%ymm2, %ymm0, %ymm0
+	LONG $0x01c28348             // addq	$1, %rdx
+	LONG $0x05e2c148             // salq	$5, %rdx
+	LONG $0x084a8d4c             // leaq	8(%rdx), %r9
+	LONG $0xc858f4c5             // vaddps	%ymm0, %ymm1, %ymm1
+
+BB0_3:
+	WORD $0x394c; BYTE $0xc9 // cmpq	%r9, %rcx
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xc8 // movq	%r9, %rax
+
+BB0_6:
+	WORD $0x8948; BYTE $0xd6     // movq	%rdx, %rsi
+	WORD $0x8948; BYTE $0xc2     // movq	%rax, %rdx
+	LONG $0x08408d48             // leaq	8(%rax), %rax
+	LONG $0x0c58f4c5; BYTE $0xb7 // vaddps	(%rdi,%rsi,4), %ymm1, %ymm1
+	WORD $0x3948; BYTE $0xc1     // cmpq	%rax, %rcx
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xca     // movq	%rcx, %rdx
+	WORD $0x294c; BYTE $0xca     // subq	%r9, %rdx
+	LONG $0xf8e28348             // andq	$-8, %rdx
+	WORD $0x014c; BYTE $0xca     // addq	%r9, %rdx
+
+BB0_5:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc812f8c5               // vmovhlps	%xmm0, %xmm0, %xmm1
+	LONG $0xc158f8c5               // vaddps	%xmm1, %xmm0, %xmm0
+	LONG $0xc816fac5               // vmovshdup	%xmm0, %xmm1
+	LONG $0xc158fac5               // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_27
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	WORD $0x2949; BYTE $0xd1       // subq	%rdx, %r9
+	LONG $0xff418d49               // leaq	-1(%r9), %rax
+	LONG $0x06f88348               // cmpq	$6, %rax
+	JBE  BB0_8
+	WORD $0x894c; BYTE $0xce       // movq	%r9, %rsi
+	LONG $0x97048d48               // leaq	(%rdi,%rdx,4), %rax
+	LONG $0x03eec148               // shrq	$3, %rsi
+	LONG $0x05e6c148               // salq	$5, %rsi
+	WORD $0x0148; BYTE $0xc6       // addq	%rax, %rsi
+
+BB0_9:
+	LONG $0x0058fac5             // vaddss	(%rax), %xmm0, %xmm0
+	LONG $0x20c08348             // addq	$32, %rax
+	LONG $0x4058fac5; BYTE $0xe4 // vaddss	-28(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xe8 // vaddss	-24(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xec // vaddss	-20(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xf0 // vaddss	-16(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xf4 // vaddss	-12(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xf8 // vaddss	-8(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xfc // vaddss	-4(%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc6     // cmpq	%rax, %rsi
+	JNE  BB0_9
+	WORD $0x894c; BYTE $0xc8     // movq	%r9, %rax
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	LONG $0x07e18341             // andl	$7, %r9d
+	JE   BB0_27
+
+BB0_8:
+	LONG $0x01728d48               // leaq	1(%rdx), %rsi
+	LONG $0x0458fac5; BYTE $0x97   // vaddss	(%rdi,%rdx,4), %xmm0, %xmm0
+	QUAD $0x0000000095048d48       // leaq	0(,%rdx,4), %rax
+	WORD $0x3948; BYTE $0xf1       // cmpq	%rsi, %rcx
+	JLE  BB0_27
+	LONG $0x02728d48               // leaq	2(%rdx), %rsi
+	LONG $0x4458fac5; WORD $0x0407 // vaddss	4(%rdi,%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xf1       // cmpq	%rsi, %rcx
+	JLE  BB0_27
+	LONG $0x03728d48               // leaq	3(%rdx), %rsi
+	LONG $0x4458fac5; WORD $0x0807 // vaddss	8(%rdi,%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xf1       // cmpq	%rsi, %rcx
+	JLE  BB0_27
+	LONG $0x04728d48               // leaq	4(%rdx), %rsi
+	LONG $0x4458fac5; WORD $0x0c07 // vaddss	12(%rdi,%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xf1       // cmpq	%rsi, %rcx
+	JLE  BB0_27
+	LONG $0x05728d48               // leaq	5(%rdx), %rsi
+	LONG $0x4458fac5; WORD $0x1007 // vaddss	16(%rdi,%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xf1       // cmpq	%rsi, %rcx
+	JLE  BB0_27
+	LONG $0x06c28348               // addq	$6, %rdx
+	LONG $0x4458fac5; WORD $0x1407 // vaddss	20(%rdi,%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd1       // cmpq	%rdx, %rcx
+	JLE  BB0_27
+	LONG $0x4458fac5; WORD $0x1807 // vaddss	24(%rdi,%rax), %xmm0, %xmm0
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+
+BB0_2:
+	LONG $0x117ac1c4; BYTE $0x00 // vmovss	%xmm0, (%r8)
+	RET
+
+BB0_27:
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117ac1c4; BYTE $0x00 // vmovss	%xmm0, (%r8)
+	RET
+
+BB0_12:
+	LONG $0xc957f0c5               // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x0008b941; WORD $0x0000 // movl	$8, %r9d
+	WORD $0xd231                   // xorl	%edx, %edx
+	JMP  BB0_3
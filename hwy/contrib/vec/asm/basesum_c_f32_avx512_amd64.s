@@ -0,0 +1,181 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basesum_c_f32_avx512_amd64.c
+
+TEXT ·sum_c_f32_avx512(SB), $0-24
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x36       // movq	(%rsi), %rsi
+	WORD $0x8948; BYTE $0xf9       // movq	%rdi, %rcx
+	WORD $0x8949; BYTE $0xd2       // movq	%rdx, %r10
+	LONG $0xc057f8c5               // vxorps	%xmm0, %xmm0, %xmm0
+	WORD $0x8548; BYTE $0xf6       // testq	%rsi, %rsi
+	JE   BB0_2
+	LONG $0x3ffe8348               // cmpq	$63, %rsi
+	JLE  BB0_14
+	LONG $0xc0568d48               // leaq	-64(%rsi), %rdx
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0xc957f0c5               // vxorps	%xmm1, %xmm1, %xmm1
+	LONG $0x06eac148               // shrq	$6, %rdx
+	LONG $0x487cf162; WORD $0xd128 // vmovaps	%zmm1, %zmm2
+	LONG $0x487cf162; WORD $0xd928 // vmovaps	%zmm1, %zmm3
+	WORD $0x8948; BYTE $0xd7       // movq	%rdx, %rdi
+	LONG $0x487cf162; WORD $0xc128 // vmovaps	%zmm1, %zmm0
+	LONG $0x08e7c148               // salq	$8, %rdi
+	QUAD $0x0000010039bc8d48       // leaq	256(%rcx,%rdi), %rdi
+
+BB0_4:
+	LONG $0x487cf162; WORD $0x0058             // vaddps	(%rax), %zmm0, %zmm0
+	LONG $0x01000548; WORD $0x0000             // addq	$256, %rax
+	LONG $0x4864f162; WORD $0x5858; BYTE $0xfd // vaddps	-192(%rax), %zmm3, %zmm3
+	LONG $0x486cf162; WORD $0x5058; BYTE $0xfe // vaddps	-128(%rax), %zmm2, %zmm2
+	LONG $0x4874f162; WORD $0x4858; BYTE $0xff // vaddps	-64(%rax), %zmm1, %zmm1
+	WORD $0x3948; BYTE $0xf8                   // cmpq	%rdi, %rax
+	JNE  BB0_4
+	LONG $0x487cf162; WORD $0xc358             // vaddps	%zmm3, %zmm0, %zmm0
+	LONG $0x4874f162; WORD $0xca58             // vaddps	%zmm2, %zmm1, %zmm1
+	LONG $0x01c28348                           // addq	$1, %rdx
+	LONG $0x06e2c148                           // salq	$6, %rdx
+	LONG $0x10428d4c                           // leaq	16(%rdx), %r8
+	LONG $0x487cf162; WORD $0xc158             // vaddps	%zmm1, %zmm0, %zmm0
+
+BB0_3:
+	WORD $0x394c; BYTE $0xc6 // cmpq	%r8, %rsi
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xc0 // movq	%r8, %rax
+
+BB0_6:
+	WORD $0x8948; BYTE $0xd7                   // movq	%rdx, %rdi
+	WORD $0x8948; BYTE $0xc2                   // movq	%rax, %rdx
+	LONG $0x10408d48                           // leaq	16(%rax), %rax
+	LONG $0x487cf162; WORD $0x0458; BYTE $0xb9 // vaddps	(%rcx,%rdi,4), %zmm0, %zmm0
+	WORD $0x3948; BYTE $0xc6                   // cmpq	%rax, %rsi
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xf2                   // movq	%rsi, %rdx
+	WORD $0x294c; BYTE $0xc2                   // subq	%r8, %rdx
+	LONG $0xf0e28348                           // andq	$-16, %rdx
+	WORD $0x014c; BYTE $0xc2                   // addq	%r8, %rdx
+
+BB0_5:
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f4c5                           // vaddps	%ymm0, %ymm1, %ymm0
+	LONG $0x197de3c4; WORD $0x01c1             // vextractf128	$0x1, %ymm0, %xmm1
+	LONG $0xc058f0c5                           // vaddps	%xmm0, %xmm1, %xmm0
+	LONG $0x0479e3c4; WORD $0x4ec8             // vpermilps	$78, %xmm0, %xmm1
+	LONG $0xc858f0c5                           // vaddps	%xmm0, %xmm1, %xmm1
+	LONG $0xc128f8c5                           // vmovaps	%xmm1, %xmm0
+	LONG $0xc9c6f0c5; BYTE $0x55               // vshufps	$85, %xmm1, %xmm1, %xmm1
+	LONG $0xc158fac5                           // vaddss	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd6                   // cmpq	%rdx, %rsi
+	JLE  BB0_33
+	WORD $0x8948; BYTE $0xf7                   // movq	%rsi, %rdi
+	WORD $0x8949; BYTE $0xd1                   // movq	%rdx, %r9
+	WORD $0x2948; BYTE $0xd7                   // subq	%rdx, %rdi
+	LONG $0xff478d48                           // leaq	-1(%rdi), %rax
+	LONG $0x0ef88348                           // cmpq	$14, %rax
+	JBE  BB0_15
+	WORD $0x8949; BYTE $0xf8                   // movq	%rdi, %r8
+	LONG $0x91048d48                           // leaq	(%rcx,%rdx,4), %rax
+	LONG $0x04e8c149                           // shrq	$4, %r8
+	LONG $0x06e0c149                           // salq	$6, %r8
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+
+BB0_9:
+	LONG $0x0058fac5             // vaddss	(%rax), %xmm0, %xmm0
+	LONG $0x40c08348             // addq	$64, %rax
+	LONG $0x4058fac5; BYTE $0xc4 // vaddss	-60(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xc8 // vaddss	-56(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xcc // vaddss	-52(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xd0 // vaddss	-48(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xd4 // vaddss	-44(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xd8 // vaddss	-40(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xdc // vaddss	-36(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xe0 // vaddss	-32(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xe4 // vaddss	-28(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xe8 // vaddss	-24(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xec // vaddss	-20(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xf0 // vaddss	-16(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xf4 // vaddss	-12(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xf8 // vaddss	-8(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0xfc // vaddss	-4(%rax), %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc0     // cmpq	%r8, %rax
+	JNE  BB0_9
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0xf0e08348             // andq	$-16, %rax
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	LONG $0x0fc7f640             // testb	$15, %dil
+	JE   BB0_33
+
+BB0_8:
+	WORD $0x2948; BYTE $0xc7     // subq	%rax, %rdi
+	LONG $0xff478d4c             // leaq	-1(%rdi), %r8
+	LONG $0x06f88349             // cmpq	$6, %r8
+	JBE  BB0_11
+	WORD $0x014c; BYTE $0xc8     // addq	%r9, %rax
+	LONG $0x81048d48             // leaq	(%rcx,%rax,4), %rax
+	LONG $0x0058fac5             // vaddss	(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0x04 // vaddss	4(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0x08 // vaddss	8(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0x0c // vaddss	12(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0x10 // vaddss	16(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0x14 // vaddss	20(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0x18 // vaddss	24(%rax), %xmm0, %xmm0
+	LONG $0x4058fac5; BYTE $0x1c // vaddss	28(%rax), %xmm0, %xmm0
+	WORD $0x8948; BYTE $0xf8     // movq	%rdi, %rax
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc2     // addq	%rax, %rdx
+	WORD $0xe783; BYTE $0x07     // andl	$7, %edi
+	JE   BB0_33
+
+BB0_11:
+	LONG $0x017a8d48               // leaq	1(%rdx), %rdi
+	LONG $0x0458fac5; BYTE $0x91   // vaddss	(%rcx,%rdx,4), %xmm0, %xmm0
+	QUAD $0x0000000095048d48       // leaq	0(,%rdx,4), %rax
+	WORD $0x3948; BYTE $0xfe       // cmpq	%rdi, %rsi
+	JLE  BB0_33
+	LONG $0x027a8d48               // leaq	2(%rdx), %rdi
+	LONG $0x4458fac5; WORD $0x0401 // vaddss	4(%rcx,%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xfe       // cmpq	%rdi, %rsi
+	JLE  BB0_33
+	LONG $0x037a8d48               // leaq	3(%rdx), %rdi
+	LONG $0x4458fac5; WORD $0x0801 // vaddss	8(%rcx,%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xfe       // cmpq	%rdi, %rsi
+	JLE  BB0_33
+	LONG $0x047a8d48               // leaq	4(%rdx), %rdi
+	LONG $0x4458fac5; WORD $0x0c01 // vaddss	12(%rcx,%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xfe       // cmpq	%rdi, %rsi
+	JLE  BB0_33
+	LONG $0x057a8d48               // leaq	5(%rdx), %rdi
+	LONG $0x4458fac5; WORD $0x1001 // vaddss	16(%rcx,%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xfe       // cmpq	%rdi, %rsi
+	JLE  BB0_33
+	LONG $0x06c28348               // addq	$6, %rdx
+	LONG $0x4458fac5; WORD $0x1401 // vaddss	20(%rcx,%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd6       // cmpq	%rdx, %rsi
+	JLE  BB0_33
+	LONG $0x4458fac5; WORD $0x1801 // vaddss	24(%rcx,%rax), %xmm0, %xmm0
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+
+BB0_2:
+	LONG $0x117ac1c4; BYTE $0x02 // vmovss	%xmm0, (%r10)
+	RET
+
+BB0_33:
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117ac1c4; BYTE $0x02 // vmovss	%xmm0, (%r10)
+	RET
+
+BB0_14:
+	LONG $0xc057f8c5               // vxorps	%xmm0, %xmm0, %xmm0
+	LONG $0x0010b841; WORD $0x0000 // movl	$16, %r8d
+	WORD $0xd231                   // xorl	%edx, %edx
+	JMP  BB0_3
+
+BB0_15:
+	WORD $0xc031 // xorl	%eax, %eax
+	JMP  BB0_8
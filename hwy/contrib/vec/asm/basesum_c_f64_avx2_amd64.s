@@ -0,0 +1,120 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx2 -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basesum_c_f64_avx2_amd64.c
+
+TEXT ·sum_c_f64_avx2(SB), $0-24
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x0e // movq	(%rsi), %rcx
+	WORD $0x8949; BYTE $0xd0 // movq	%rdx, %r8
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x8548; BYTE $0xc9 // testq	%rcx, %rcx
+	JE   BB0_2
+	LONG $0x0ff98348         // cmpq	$15, %rcx
+	JLE  BB0_12
+	LONG $0xf0718d48         // leaq	-16(%rcx), %rsi
+	LONG $0xc057f9c5         // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x8948; BYTE $0xf8 // movq	%rdi, %rax
+	LONG $0xd028fdc5         // vmovapd	%ymm0, %ymm2
+	LONG $0x04eec148         // shrq	$4, %rsi
+	LONG $0xd828fdc5         // vmovapd	%ymm0, %ymm3
+	LONG $0xc828fdc5         // vmovapd	%ymm0, %ymm1
+	WORD $0x8948; BYTE $0xf2 // movq	%rsi, %rdx
+	LONG $0x07e2c148         // salq	$7, %rdx
+	QUAD $0x0000008017948d48 // leaq	128(%rdi,%rdx), %rdx
+
+BB0_4:
+	LONG $0x0858f5c5             // vaddpd	(%rax), %ymm1, %ymm1
+	LONG $0x5858e5c5; BYTE $0x20 // vaddpd	32(%rax), %ymm3, %ymm3
+	LONG $0x80e88348             // subq	$-128, %rax
+	LONG $0x5058edc5; BYTE $0xc0 // vaddpd	-64(%rax), %ymm2, %ymm2
+	LONG $0x4058fdc5; BYTE $0xe0 // vaddpd	-32(%rax), %ymm0, %ymm0
+	WORD $0x3948; BYTE $0xc2     // cmpq	%rax, %rdx
+	JNE  BB0_4
+	LONG $0xcb58f5c5             // vaddpd	%ymm3, %ymm1, %ymm1
+	LONG $0xc258fdc5             // vaddpd	%ymm2, %ymm0, %ymm0
+	LONG $0x01468d48             // leaq	1(%rsi), %rax
+	LONG $0x04e0c148             // salq	$4, %rax
+	LONG $0xc858f5c5             // vaddpd	%ymm0, %ymm1, %ymm1
+	LONG $0x04488d4c             // leaq	4(%rax), %r9
+
+BB0_3:
+	WORD $0x394c; BYTE $0xc9 // cmpq	%r9, %rcx
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xca // movq	%r9, %rdx
+
+BB0_6:
+	WORD $0x8948; BYTE $0xc6     // movq	%rax, %rsi
+	WORD $0x8948; BYTE $0xd0     // movq	%rdx, %rax
+	LONG $0x04528d48             // leaq	4(%rdx), %rdx
+	LONG $0x0c58f5c5; BYTE $0xf7 // vaddpd	(%rdi,%rsi,8), %ymm1, %ymm1
+	WORD $0x3948; BYTE $0xd1     // cmpq	%rdx, %rcx
+	JGE  BB0_6
+	WORD $0x8948; BYTE $0xc8     // movq	%rcx, %rax
+	WORD $0x294c; BYTE $0xc8     // subq	%r9, %rax
+	LONG $0xfce08348             // andq	$-4, %rax
+	WORD $0x014c; BYTE $0xc8     // addq	%r9, %rax
+
+BB0_5:
+	LONG $0x197de3c4; WORD $0x01c8 // vextractf128	$0x1, %ymm1, %xmm0
+	LONG $0xc158f9c5               // vaddpd	%xmm1, %xmm0, %xmm0
+	LONG $0xc815f9c5               // vunpckhpd	%xmm0, %xmm0, %xmm1
+	LONG $0xc158fbc5               // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_23
+	WORD $0x8949; BYTE $0xc9       // movq	%rcx, %r9
+	WORD $0x2949; BYTE $0xc1       // subq	%rax, %r9
+	LONG $0xff518d49               // leaq	-1(%r9), %rdx
+	LONG $0x02fa8348               // cmpq	$2, %rdx
+	JBE  BB0_8
+	WORD $0x894c; BYTE $0xce       // movq	%r9, %rsi
+	LONG $0xc7148d48               // leaq	(%rdi,%rax,8), %rdx
+	LONG $0x02eec148               // shrq	$2, %rsi
+	LONG $0x05e6c148               // salq	$5, %rsi
+	WORD $0x0148; BYTE $0xd6       // addq	%rdx, %rsi
+
+BB0_9:
+	LONG $0x0258fbc5             // vaddsd	(%rdx), %xmm0, %xmm0
+	LONG $0x20c28348             // addq	$32, %rdx
+	LONG $0x4258fbc5; BYTE $0xe8 // vaddsd	-24(%rdx), %xmm0, %xmm0
+	LONG $0x4258fbc5; BYTE $0xf0 // vaddsd	-16(%rdx), %xmm0, %xmm0
+	LONG $0x4258fbc5; BYTE $0xf8 // vaddsd	-8(%rdx), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xd6     // cmpq	%rdx, %rsi
+	JNE  BB0_9
+	LONG $0x03c1f641             // testb	$3, %r9b
+	JE   BB0_23
+	LONG $0xfce18349             // andq	$-4, %r9
+	WORD $0x014c; BYTE $0xc8     // addq	%r9, %rax
+
+BB0_8:
+	LONG $0x01708d48               // leaq	1(%rax), %rsi
+	LONG $0x0458fbc5; BYTE $0xc7   // vaddsd	(%rdi,%rax,8), %xmm0, %xmm0
+	QUAD $0x00000000c5148d48       // leaq	0(,%rax,8), %rdx
+	WORD $0x3948; BYTE $0xf1       // cmpq	%rsi, %rcx
+	JLE  BB0_23
+	LONG $0x02c08348               // addq	$2, %rax
+	LONG $0x4458fbc5; WORD $0x0817 // vaddsd	8(%rdi,%rdx), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xc1       // cmpq	%rax, %rcx
+	JLE  BB0_23
+	LONG $0x4458fbc5; WORD $0x1017 // vaddsd	16(%rdi,%rdx), %xmm0, %xmm0
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+
+BB0_2:
+	LONG $0x117bc1c4; BYTE $0x00 // vmovsd	%xmm0, (%r8)
+	RET
+
+BB0_23:
+	WORD $0xf8c5; BYTE $0x77     // vzeroupper
+	LONG $0x117bc1c4; BYTE $0x00 // vmovsd	%xmm0, (%r8)
+	RET
+
+BB0_12:
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	LONG $0x0004b941; WORD $0x0000 // movl	$4, %r9d
+	WORD $0xc031                   // xorl	%eax, %eax
+	JMP  BB0_3
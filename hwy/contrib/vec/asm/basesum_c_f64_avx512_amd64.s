@@ -0,0 +1,143 @@
+//go:build !noasm && amd64
+// Code generated by GoAT. DO NOT EDIT.
+// versions:
+// 	gcc     12.2.0
+// 	objdump 2.40 (llvm-objdump 14.0.6)
+// flags: -mavx512f -mavx512bw -mavx512dq -mavx512vl -mfma -fno-builtin-memset -O3
+// source: hwy/contrib/vec/asm/basesum_c_f64_avx512_amd64.c
+
+TEXT ·sum_c_f64_avx512(SB), $0-24
+	MOVQ v+0(FP), DI
+	MOVQ plen_v+8(FP), SI
+	MOVQ pout_result+16(FP), DX
+	WORD $0x8b48; BYTE $0x36       // movq	(%rsi), %rsi
+	LONG $0xc057f9c5               // vxorpd	%xmm0, %xmm0, %xmm0
+	WORD $0x8548; BYTE $0xf6       // testq	%rsi, %rsi
+	JE   BB0_2
+	LONG $0x1ffe8348               // cmpq	$31, %rsi
+	JLE  BB0_12
+	LONG $0xe04e8d48               // leaq	-32(%rsi), %rcx
+	LONG $0xc957f1c5               // vxorpd	%xmm1, %xmm1, %xmm1
+	WORD $0x8948; BYTE $0xf8       // movq	%rdi, %rax
+	LONG $0x05e9c148               // shrq	$5, %rcx
+	LONG $0x48fdf162; WORD $0xd128 // vmovapd	%zmm1, %zmm2
+	LONG $0x48fdf162; WORD $0xd928 // vmovapd	%zmm1, %zmm3
+	WORD $0x8949; BYTE $0xc8       // movq	%rcx, %r8
+	LONG $0x48fdf162; WORD $0xc128 // vmovapd	%zmm1, %zmm0
+	LONG $0x08e0c149               // salq	$8, %r8
+	QUAD $0x0000010007848d4e       // leaq	256(%rdi,%r8), %r8
+
+BB0_4:
+	LONG $0x48fdf162; WORD $0x0058             // vaddpd	(%rax), %zmm0, %zmm0
+	LONG $0x01000548; WORD $0x0000             // addq	$256, %rax
+	LONG $0x48e5f162; WORD $0x5858; BYTE $0xfd // vaddpd	-192(%rax), %zmm3, %zmm3
+	LONG $0x48edf162; WORD $0x5058; BYTE $0xfe // vaddpd	-128(%rax), %zmm2, %zmm2
+	LONG $0x48f5f162; WORD $0x4858; BYTE $0xff // vaddpd	-64(%rax), %zmm1, %zmm1
+	WORD $0x394c; BYTE $0xc0                   // cmpq	%r8, %rax
+	JNE  BB0_4
+	LONG $0x48fdf162; WORD $0xc358             // vaddpd	%zmm3, %zmm0, %zmm0
+	LONG $0x48f5f162; WORD $0xca58             // vaddpd	%zmm2, %zmm1, %zmm1
+	LONG $0x01c18348                           // addq	$1, %rcx
+	LONG $0x05e1c148                           // salq	$5, %rcx
+	LONG $0x08498d4c                           // leaq	8(%rcx), %r9
+	LONG $0x48fdf162; WORD $0xc158             // vaddpd	%zmm1, %zmm0, %zmm0
+
+BB0_3:
+	WORD $0x394c; BYTE $0xce // cmpq	%r9, %rsi
+	JL   BB0_5
+	WORD $0x894c; BYTE $0xc8 // movq	%r9, %rax
+
+BB0_6:
+	WORD $0x8949; BYTE $0xc8                   // movq	%rcx, %r8
+	WORD $0x8948; BYTE $0xc1                   // movq	%rax, %rcx
+	LONG $0x08408d48                           // leaq	8(%rax), %rax
+	LONG $0x48fdb162; WORD $0x0458; BYTE $0xc7 // vaddpd	(%rdi,%r8,8), %zmm0, %zmm0
+	WORD $0x3948; BYTE $0xf0                   // cmpq	%rsi, %rax
+	JLE  BB0_6
+	WORD $0x8948; BYTE $0xf1                   // movq	%rsi, %rcx
+	WORD $0x294c; BYTE $0xc9                   // subq	%r9, %rcx
+	LONG $0xf8e18348                           // andq	$-8, %rcx
+	WORD $0x014c; BYTE $0xc9                   // addq	%r9, %rcx
+
+BB0_5:
+	LONG $0x48fdf362; WORD $0xc11b; BYTE $0x01 // vextractf64x4	$0x1, %zmm0, %ymm1
+	LONG $0xc058f5c5                           // vaddpd	%ymm0, %ymm1, %ymm0
+	LONG $0x28fdf362; WORD $0xc119; BYTE $0x01 // vextractf64x2	$0x1, %ymm0, %xmm1
+	LONG $0xc858f1c5                           // vaddpd	%xmm0, %xmm1, %xmm1
+	LONG $0xc110f3c5                           // vmovsd	%xmm1, %xmm1, %xmm0
+	LONG $0xc915f1c5                           // vunpckhpd	%xmm1, %xmm1, %xmm1
+	LONG $0xc158fbc5                           // vaddsd	%xmm1, %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xce                   // cmpq	%rcx, %rsi
+	JLE  BB0_27
+	WORD $0x8949; BYTE $0xf1                   // movq	%rsi, %r9
+	WORD $0x2949; BYTE $0xc9                   // subq	%rcx, %r9
+	LONG $0xff418d49                           // leaq	-1(%r9), %rax
+	LONG $0x06f88348                           // cmpq	$6, %rax
+	JBE  BB0_8
+	WORD $0x894d; BYTE $0xc8                   // movq	%r9, %r8
+	LONG $0xcf048d48                           // leaq	(%rdi,%rcx,8), %rax
+	LONG $0x03e8c149                           // shrq	$3, %r8
+	LONG $0x06e0c149                           // salq	$6, %r8
+	WORD $0x0149; BYTE $0xc0                   // addq	%rax, %r8
+
+BB0_9:
+	LONG $0x0058fbc5             // vaddsd	(%rax), %xmm0, %xmm0
+	LONG $0x40c08348             // addq	$64, %rax
+	LONG $0x4058fbc5; BYTE $0xc8 // vaddsd	-56(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xd0 // vaddsd	-48(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xd8 // vaddsd	-40(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xe0 // vaddsd	-32(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xe8 // vaddsd	-24(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xf0 // vaddsd	-16(%rax), %xmm0, %xmm0
+	LONG $0x4058fbc5; BYTE $0xf8 // vaddsd	-8(%rax), %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xc0     // cmpq	%rax, %r8
+	JNE  BB0_9
+	WORD $0x894c; BYTE $0xc8     // movq	%r9, %rax
+	LONG $0xf8e08348             // andq	$-8, %rax
+	WORD $0x0148; BYTE $0xc1     // addq	%rax, %rcx
+	LONG $0x07e18341             // andl	$7, %r9d
+	JE   BB0_27
+
+BB0_8:
+	LONG $0x01418d4c               // leaq	1(%rcx), %r8
+	LONG $0x0458fbc5; BYTE $0xcf   // vaddsd	(%rdi,%rcx,8), %xmm0, %xmm0
+	QUAD $0x00000000cd048d48       // leaq	0(,%rcx,8), %rax
+	WORD $0x394c; BYTE $0xc6       // cmpq	%r8, %rsi
+	JLE  BB0_27
+	LONG $0x02418d4c               // leaq	2(%rcx), %r8
+	LONG $0x4458fbc5; WORD $0x0807 // vaddsd	8(%rdi,%rax), %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xf0       // cmpq	%rsi, %r8
+	JGE  BB0_27
+	LONG $0x03418d4c               // leaq	3(%rcx), %r8
+	LONG $0x4458fbc5; WORD $0x1007 // vaddsd	16(%rdi,%rax), %xmm0, %xmm0
+	WORD $0x3949; BYTE $0xf0       // cmpq	%rsi, %r8
+	JGE  BB0_27
+	LONG $0x04418d4c               // leaq	4(%rcx), %r8
+	LONG $0x4458fbc5; WORD $0x1807 // vaddsd	24(%rdi,%rax), %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc6       // cmpq	%r8, %rsi
+	JLE  BB0_27
+	LONG $0x05418d4c               // leaq	5(%rcx), %r8
+	LONG $0x4458fbc5; WORD $0x2007 // vaddsd	32(%rdi,%rax), %xmm0, %xmm0
+	WORD $0x394c; BYTE $0xc6       // cmpq	%r8, %rsi
+	JLE  BB0_27
+	LONG $0x06c18348               // addq	$6, %rcx
+	LONG $0x4458fbc5; WORD $0x2807 // vaddsd	40(%rdi,%rax), %xmm0, %xmm0
+	WORD $0x3948; BYTE $0xce       // cmpq	%rcx, %rsi
+	JLE  BB0_27
+	LONG $0x4458fbc5; WORD $0x3007 // vaddsd	48(%rdi,%rax), %xmm0, %xmm0
+	WORD $0xf8c5; BYTE $0x77       // vzeroupper
+
+BB0_2:
+	LONG $0x0211fbc5 // vmovsd	%xmm0, (%rdx)
+	RET
+
+BB0_27:
+	WORD $0xf8c5; BYTE $0x77 // vzeroupper
+	LONG $0x0211fbc5         // vmovsd	%xmm0, (%rdx)
+	RET
+
+BB0_12:
+	LONG $0xc057f9c5               // vxorpd	%xmm0, %xmm0, %xmm0
+	LONG $0x0008b941; WORD $0x0000 // movl	$8, %r9d
+	WORD $0xc931                   // xorl	%ecx, %ecx
+	JMP  BB0_3
@@ -0,0 +1,27 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Argmax_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Argmax_AVX2_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	argmax_c_f32_avx2(v, plen, pout_result)
+}
+
+// Argmax_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Argmax_AVX2_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	argmax_c_f64_avx2(v, plen, pout_result)
+}
+
+// Argmin_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Argmin_AVX2_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	argmin_c_f32_avx2(v, plen, pout_result)
+}
+
+// Argmin_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Argmin_AVX2_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	argmin_c_f64_avx2(v, plen, pout_result)
+}
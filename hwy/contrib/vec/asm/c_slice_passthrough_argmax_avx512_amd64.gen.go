@@ -0,0 +1,27 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Argmax_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func Argmax_AVX512_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	argmax_c_f32_avx512(v, plen, pout_result)
+}
+
+// Argmax_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func Argmax_AVX512_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	argmax_c_f64_avx512(v, plen, pout_result)
+}
+
+// Argmin_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func Argmin_AVX512_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	argmin_c_f32_avx512(v, plen, pout_result)
+}
+
+// Argmin_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func Argmin_AVX512_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	argmin_c_f64_avx512(v, plen, pout_result)
+}
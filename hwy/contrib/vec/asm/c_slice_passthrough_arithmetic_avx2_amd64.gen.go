@@ -0,0 +1,127 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Add_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Add_AVX2_F32(dst unsafe.Pointer, s unsafe.Pointer, plen unsafe.Pointer) {
+	add_c_f32_avx2(dst, s, plen)
+}
+
+// Add_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Add_AVX2_F64(dst unsafe.Pointer, s unsafe.Pointer, plen unsafe.Pointer) {
+	add_c_f64_avx2(dst, s, plen)
+}
+
+// AddConst_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func AddConst_AVX2_F32(pc unsafe.Pointer, dst unsafe.Pointer, plen unsafe.Pointer) {
+	addconst_c_f32_avx2(pc, dst, plen)
+}
+
+// AddConst_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func AddConst_AVX2_F64(pc unsafe.Pointer, dst unsafe.Pointer, plen unsafe.Pointer) {
+	addconst_c_f64_avx2(pc, dst, plen)
+}
+
+// AddTo_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func AddTo_AVX2_F32(dst unsafe.Pointer, a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer) {
+	addto_c_f32_avx2(dst, a, b, plen)
+}
+
+// AddTo_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func AddTo_AVX2_F64(dst unsafe.Pointer, a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer) {
+	addto_c_f64_avx2(dst, a, b, plen)
+}
+
+// Div_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Div_AVX2_F32(dst unsafe.Pointer, s unsafe.Pointer, plen unsafe.Pointer) {
+	div_c_f32_avx2(dst, s, plen)
+}
+
+// Div_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Div_AVX2_F64(dst unsafe.Pointer, s unsafe.Pointer, plen unsafe.Pointer) {
+	div_c_f64_avx2(dst, s, plen)
+}
+
+// DivTo_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func DivTo_AVX2_F32(dst unsafe.Pointer, a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer) {
+	divto_c_f32_avx2(dst, a, b, plen)
+}
+
+// DivTo_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func DivTo_AVX2_F64(dst unsafe.Pointer, a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer) {
+	divto_c_f64_avx2(dst, a, b, plen)
+}
+
+// Mul_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Mul_AVX2_F32(dst unsafe.Pointer, s unsafe.Pointer, plen unsafe.Pointer) {
+	mul_c_f32_avx2(dst, s, plen)
+}
+
+// Mul_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Mul_AVX2_F64(dst unsafe.Pointer, s unsafe.Pointer, plen unsafe.Pointer) {
+	mul_c_f64_avx2(dst, s, plen)
+}
+
+// MulConstAddTo_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func MulConstAddTo_AVX2_F32(dst unsafe.Pointer, pa unsafe.Pointer, x unsafe.Pointer, plen unsafe.Pointer) {
+	mulconstaddto_c_f32_avx2(dst, pa, x, plen)
+}
+
+// MulConstAddTo_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func MulConstAddTo_AVX2_F64(dst unsafe.Pointer, pa unsafe.Pointer, x unsafe.Pointer, plen unsafe.Pointer) {
+	mulconstaddto_c_f64_avx2(dst, pa, x, plen)
+}
+
+// MulTo_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func MulTo_AVX2_F32(dst unsafe.Pointer, a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer) {
+	multo_c_f32_avx2(dst, a, b, plen)
+}
+
+// MulTo_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func MulTo_AVX2_F64(dst unsafe.Pointer, a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer) {
+	multo_c_f64_avx2(dst, a, b, plen)
+}
+
+// Scale_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Scale_AVX2_F32(pc unsafe.Pointer, dst unsafe.Pointer, plen unsafe.Pointer) {
+	scale_c_f32_avx2(pc, dst, plen)
+}
+
+// Scale_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Scale_AVX2_F64(pc unsafe.Pointer, dst unsafe.Pointer, plen unsafe.Pointer) {
+	scale_c_f64_avx2(pc, dst, plen)
+}
+
+// ScaleTo_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func ScaleTo_AVX2_F32(dst unsafe.Pointer, pc unsafe.Pointer, s unsafe.Pointer, plen unsafe.Pointer) {
+	scaleto_c_f32_avx2(dst, pc, s, plen)
+}
+
+// ScaleTo_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func ScaleTo_AVX2_F64(dst unsafe.Pointer, pc unsafe.Pointer, s unsafe.Pointer, plen unsafe.Pointer) {
+	scaleto_c_f64_avx2(dst, pc, s, plen)
+}
+
+// Sub_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Sub_AVX2_F32(dst unsafe.Pointer, s unsafe.Pointer, plen unsafe.Pointer) {
+	sub_c_f32_avx2(dst, s, plen)
+}
+
+// Sub_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Sub_AVX2_F64(dst unsafe.Pointer, s unsafe.Pointer, plen unsafe.Pointer) {
+	sub_c_f64_avx2(dst, s, plen)
+}
+
+// SubTo_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func SubTo_AVX2_F32(dst unsafe.Pointer, a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer) {
+	subto_c_f32_avx2(dst, a, b, plen)
+}
+
+// SubTo_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func SubTo_AVX2_F64(dst unsafe.Pointer, a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer) {
+	subto_c_f64_avx2(dst, a, b, plen)
+}
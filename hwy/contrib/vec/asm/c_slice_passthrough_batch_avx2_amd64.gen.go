@@ -0,0 +1,27 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// BatchDot_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func BatchDot_AVX2_F32(query unsafe.Pointer, data unsafe.Pointer, dots unsafe.Pointer, pcount unsafe.Pointer, pdims unsafe.Pointer, plen_query unsafe.Pointer, plen_data unsafe.Pointer, plen_dots unsafe.Pointer) {
+	batchdot_c_f32_avx2(query, data, dots, pcount, pdims, plen_query, plen_data, plen_dots)
+}
+
+// BatchDot_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func BatchDot_AVX2_F64(query unsafe.Pointer, data unsafe.Pointer, dots unsafe.Pointer, pcount unsafe.Pointer, pdims unsafe.Pointer, plen_query unsafe.Pointer, plen_data unsafe.Pointer, plen_dots unsafe.Pointer) {
+	batchdot_c_f64_avx2(query, data, dots, pcount, pdims, plen_query, plen_data, plen_dots)
+}
+
+// BatchL2SquaredDistance_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func BatchL2SquaredDistance_AVX2_F32(query unsafe.Pointer, data unsafe.Pointer, distances unsafe.Pointer, pcount unsafe.Pointer, pdims unsafe.Pointer, plen_query unsafe.Pointer, plen_data unsafe.Pointer, plen_distances unsafe.Pointer) {
+	batchl2squareddistance_c_f32_avx2(query, data, distances, pcount, pdims, plen_query, plen_data, plen_distances)
+}
+
+// BatchL2SquaredDistance_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func BatchL2SquaredDistance_AVX2_F64(query unsafe.Pointer, data unsafe.Pointer, distances unsafe.Pointer, pcount unsafe.Pointer, pdims unsafe.Pointer, plen_query unsafe.Pointer, plen_data unsafe.Pointer, plen_distances unsafe.Pointer) {
+	batchl2squareddistance_c_f64_avx2(query, data, distances, pcount, pdims, plen_query, plen_data, plen_distances)
+}
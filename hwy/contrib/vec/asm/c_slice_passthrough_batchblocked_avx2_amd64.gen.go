@@ -0,0 +1,27 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// BatchDotBlocked_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func BatchDotBlocked_AVX2_F32(query unsafe.Pointer, data unsafe.Pointer, dots unsafe.Pointer, pcount unsafe.Pointer, pdims unsafe.Pointer, plen_query unsafe.Pointer, plen_data unsafe.Pointer, plen_dots unsafe.Pointer) {
+	batchdotblocked_c_f32_avx2(query, data, dots, pcount, pdims, plen_query, plen_data, plen_dots)
+}
+
+// BatchDotBlocked_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func BatchDotBlocked_AVX2_F64(query unsafe.Pointer, data unsafe.Pointer, dots unsafe.Pointer, pcount unsafe.Pointer, pdims unsafe.Pointer, plen_query unsafe.Pointer, plen_data unsafe.Pointer, plen_dots unsafe.Pointer) {
+	batchdotblocked_c_f64_avx2(query, data, dots, pcount, pdims, plen_query, plen_data, plen_dots)
+}
+
+// BatchL2SquaredDistanceBlocked_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func BatchL2SquaredDistanceBlocked_AVX2_F32(query unsafe.Pointer, data unsafe.Pointer, distances unsafe.Pointer, pcount unsafe.Pointer, pdims unsafe.Pointer, plen_query unsafe.Pointer, plen_data unsafe.Pointer, plen_distances unsafe.Pointer) {
+	batchl2squareddistanceblocked_c_f32_avx2(query, data, distances, pcount, pdims, plen_query, plen_data, plen_distances)
+}
+
+// BatchL2SquaredDistanceBlocked_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func BatchL2SquaredDistanceBlocked_AVX2_F64(query unsafe.Pointer, data unsafe.Pointer, distances unsafe.Pointer, pcount unsafe.Pointer, pdims unsafe.Pointer, plen_query unsafe.Pointer, plen_data unsafe.Pointer, plen_distances unsafe.Pointer) {
+	batchl2squareddistanceblocked_c_f64_avx2(query, data, distances, pcount, pdims, plen_query, plen_data, plen_distances)
+}
@@ -0,0 +1,17 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Copy_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Copy_AVX2_F32(dst unsafe.Pointer, src unsafe.Pointer, plen unsafe.Pointer) {
+	copy_c_f32_avx2(dst, src, plen)
+}
+
+// Copy_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Copy_AVX2_F64(dst unsafe.Pointer, src unsafe.Pointer, plen unsafe.Pointer) {
+	copy_c_f64_avx2(dst, src, plen)
+}
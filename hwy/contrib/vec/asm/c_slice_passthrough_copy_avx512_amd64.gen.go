@@ -0,0 +1,17 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Copy_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func Copy_AVX512_F32(dst unsafe.Pointer, src unsafe.Pointer, plen unsafe.Pointer) {
+	copy_c_f32_avx512(dst, src, plen)
+}
+
+// Copy_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func Copy_AVX512_F64(dst unsafe.Pointer, src unsafe.Pointer, plen unsafe.Pointer) {
+	copy_c_f64_avx512(dst, src, plen)
+}
@@ -0,0 +1,27 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// L2Distance_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func L2Distance_AVX512_F32(a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	l2distance_c_f32_avx512(a, b, plen, pout_result)
+}
+
+// L2Distance_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func L2Distance_AVX512_F64(a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	l2distance_c_f64_avx512(a, b, plen, pout_result)
+}
+
+// L2SquaredDistance_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func L2SquaredDistance_AVX512_F32(a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	l2squareddistance_c_f32_avx512(a, b, plen, pout_result)
+}
+
+// L2SquaredDistance_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func L2SquaredDistance_AVX512_F64(a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	l2squareddistance_c_f64_avx512(a, b, plen, pout_result)
+}
@@ -0,0 +1,17 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Dot_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Dot_AVX2_F32(a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	dot_c_f32_avx2(a, b, plen, pout_result)
+}
+
+// Dot_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Dot_AVX2_F64(a unsafe.Pointer, b unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	dot_c_f64_avx2(a, b, plen, pout_result)
+}
@@ -0,0 +1,27 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Norm_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Norm_AVX2_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	norm_c_f32_avx2(v, plen, pout_result)
+}
+
+// Norm_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Norm_AVX2_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	norm_c_f64_avx2(v, plen, pout_result)
+}
+
+// SquaredNorm_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func SquaredNorm_AVX2_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	squarednorm_c_f32_avx2(v, plen, pout_result)
+}
+
+// SquaredNorm_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func SquaredNorm_AVX2_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	squarednorm_c_f64_avx2(v, plen, pout_result)
+}
@@ -0,0 +1,27 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Normalize_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Normalize_AVX2_F32(dst unsafe.Pointer, plen unsafe.Pointer) {
+	normalize_c_f32_avx2(dst, plen)
+}
+
+// Normalize_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Normalize_AVX2_F64(dst unsafe.Pointer, plen unsafe.Pointer) {
+	normalize_c_f64_avx2(dst, plen)
+}
+
+// NormalizeTo_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func NormalizeTo_AVX2_F32(dst unsafe.Pointer, src unsafe.Pointer, plen unsafe.Pointer) {
+	normalizeto_c_f32_avx2(dst, src, plen)
+}
+
+// NormalizeTo_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func NormalizeTo_AVX2_F64(dst unsafe.Pointer, src unsafe.Pointer, plen unsafe.Pointer) {
+	normalizeto_c_f64_avx2(dst, src, plen)
+}
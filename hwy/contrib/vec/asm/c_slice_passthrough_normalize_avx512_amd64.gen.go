@@ -0,0 +1,27 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Normalize_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func Normalize_AVX512_F32(dst unsafe.Pointer, plen unsafe.Pointer) {
+	normalize_c_f32_avx512(dst, plen)
+}
+
+// Normalize_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func Normalize_AVX512_F64(dst unsafe.Pointer, plen unsafe.Pointer) {
+	normalize_c_f64_avx512(dst, plen)
+}
+
+// NormalizeTo_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func NormalizeTo_AVX512_F32(dst unsafe.Pointer, src unsafe.Pointer, plen unsafe.Pointer) {
+	normalizeto_c_f32_avx512(dst, src, plen)
+}
+
+// NormalizeTo_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func NormalizeTo_AVX512_F64(dst unsafe.Pointer, src unsafe.Pointer, plen unsafe.Pointer) {
+	normalizeto_c_f64_avx512(dst, src, plen)
+}
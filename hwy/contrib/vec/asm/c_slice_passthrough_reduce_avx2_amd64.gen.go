@@ -0,0 +1,47 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Max_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Max_AVX2_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	max_c_f32_avx2(v, plen, pout_result)
+}
+
+// Max_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Max_AVX2_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	max_c_f64_avx2(v, plen, pout_result)
+}
+
+// Min_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Min_AVX2_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	min_c_f32_avx2(v, plen, pout_result)
+}
+
+// Min_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Min_AVX2_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	min_c_f64_avx2(v, plen, pout_result)
+}
+
+// MinMax_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func MinMax_AVX2_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_minVal unsafe.Pointer, pout_maxVal unsafe.Pointer) {
+	minmax_c_f32_avx2(v, plen, pout_minVal, pout_maxVal)
+}
+
+// MinMax_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func MinMax_AVX2_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_minVal unsafe.Pointer, pout_maxVal unsafe.Pointer) {
+	minmax_c_f64_avx2(v, plen, pout_minVal, pout_maxVal)
+}
+
+// Sum_AVX2_F32 calls the AVX2 SIMD assembly implementation.
+func Sum_AVX2_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	sum_c_f32_avx2(v, plen, pout_result)
+}
+
+// Sum_AVX2_F64 calls the AVX2 SIMD assembly implementation.
+func Sum_AVX2_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	sum_c_f64_avx2(v, plen, pout_result)
+}
@@ -0,0 +1,47 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Max_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func Max_AVX512_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	max_c_f32_avx512(v, plen, pout_result)
+}
+
+// Max_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func Max_AVX512_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	max_c_f64_avx512(v, plen, pout_result)
+}
+
+// Min_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func Min_AVX512_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	min_c_f32_avx512(v, plen, pout_result)
+}
+
+// Min_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func Min_AVX512_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	min_c_f64_avx512(v, plen, pout_result)
+}
+
+// MinMax_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func MinMax_AVX512_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_minVal unsafe.Pointer, pout_maxVal unsafe.Pointer) {
+	minmax_c_f32_avx512(v, plen, pout_minVal, pout_maxVal)
+}
+
+// MinMax_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func MinMax_AVX512_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_minVal unsafe.Pointer, pout_maxVal unsafe.Pointer) {
+	minmax_c_f64_avx512(v, plen, pout_minVal, pout_maxVal)
+}
+
+// Sum_AVX512_F32 calls the AVX512 SIMD assembly implementation.
+func Sum_AVX512_F32(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	sum_c_f32_avx512(v, plen, pout_result)
+}
+
+// Sum_AVX512_F64 calls the AVX512 SIMD assembly implementation.
+func Sum_AVX512_F64(v unsafe.Pointer, plen unsafe.Pointer, pout_result unsafe.Pointer) {
+	sum_c_f64_avx512(v, plen, pout_result)
+}
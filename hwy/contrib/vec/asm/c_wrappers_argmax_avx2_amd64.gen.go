@@ -0,0 +1,84 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// ArgmaxCAVX2F32 computes Argmax using AVX2 SIMD assembly.
+func ArgmaxCAVX2F32(v []float32) int {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	argmax_c_f32_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return int(out_result)
+}
+
+// ArgmaxCAVX2F64 computes Argmax using AVX2 SIMD assembly.
+func ArgmaxCAVX2F64(v []float64) int {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	argmax_c_f64_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return int(out_result)
+}
+
+// ArgminCAVX2F32 computes Argmin using AVX2 SIMD assembly.
+func ArgminCAVX2F32(v []float32) int {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	argmin_c_f32_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return int(out_result)
+}
+
+// ArgminCAVX2F64 computes Argmin using AVX2 SIMD assembly.
+func ArgminCAVX2F64(v []float64) int {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	argmin_c_f64_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return int(out_result)
+}
@@ -0,0 +1,84 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// ArgmaxCAVX512F32 computes Argmax using AVX512 SIMD assembly.
+func ArgmaxCAVX512F32(v []float32) int {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	argmax_c_f32_avx512(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return int(out_result)
+}
+
+// ArgmaxCAVX512F64 computes Argmax using AVX512 SIMD assembly.
+func ArgmaxCAVX512F64(v []float64) int {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	argmax_c_f64_avx512(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return int(out_result)
+}
+
+// ArgminCAVX512F32 computes Argmin using AVX512 SIMD assembly.
+func ArgminCAVX512F32(v []float32) int {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	argmin_c_f32_avx512(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return int(out_result)
+}
+
+// ArgminCAVX512F64 computes Argmin using AVX512 SIMD assembly.
+func ArgminCAVX512F64(v []float64) int {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	argmin_c_f64_avx512(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return int(out_result)
+}
@@ -0,0 +1,548 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// AddCAVX2F32 computes Add using AVX2 SIMD assembly.
+func AddCAVX2F32(dst, s []float32) {
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	add_c_f32_avx2(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// AddCAVX2F64 computes Add using AVX2 SIMD assembly.
+func AddCAVX2F64(dst, s []float64) {
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	add_c_f64_avx2(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// AddConstCAVX2F32 computes AddConst using AVX2 SIMD assembly.
+func AddConstCAVX2F32(c float32, dst []float32) {
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	cVal := c
+	addconst_c_f32_avx2(
+		unsafe.Pointer(&cVal),
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// AddConstCAVX2F64 computes AddConst using AVX2 SIMD assembly.
+func AddConstCAVX2F64(c float64, dst []float64) {
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	cVal := c
+	addconst_c_f64_avx2(
+		unsafe.Pointer(&cVal),
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// AddToCAVX2F32 computes AddTo using AVX2 SIMD assembly.
+func AddToCAVX2F32(dst, a, b []float32) {
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	addto_c_f32_avx2(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// AddToCAVX2F64 computes AddTo using AVX2 SIMD assembly.
+func AddToCAVX2F64(dst, a, b []float64) {
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	addto_c_f64_avx2(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// DivCAVX2F32 computes Div using AVX2 SIMD assembly.
+func DivCAVX2F32(dst, s []float32) {
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	div_c_f32_avx2(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// DivCAVX2F64 computes Div using AVX2 SIMD assembly.
+func DivCAVX2F64(dst, s []float64) {
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	div_c_f64_avx2(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// DivToCAVX2F32 computes DivTo using AVX2 SIMD assembly.
+func DivToCAVX2F32(dst, a, b []float32) {
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	divto_c_f32_avx2(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// DivToCAVX2F64 computes DivTo using AVX2 SIMD assembly.
+func DivToCAVX2F64(dst, a, b []float64) {
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	divto_c_f64_avx2(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// MulCAVX2F32 computes Mul using AVX2 SIMD assembly.
+func MulCAVX2F32(dst, s []float32) {
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	mul_c_f32_avx2(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// MulCAVX2F64 computes Mul using AVX2 SIMD assembly.
+func MulCAVX2F64(dst, s []float64) {
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	mul_c_f64_avx2(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// MulConstAddToCAVX2F32 computes MulConstAddTo using AVX2 SIMD assembly.
+func MulConstAddToCAVX2F32(dst []float32, a float32, x []float32) {
+	lenVal := int64(min(len(dst), len(x)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	aVal := a
+	mulconstaddto_c_f32_avx2(
+		p_dst,
+		unsafe.Pointer(&aVal),
+		p_x,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// MulConstAddToCAVX2F64 computes MulConstAddTo using AVX2 SIMD assembly.
+func MulConstAddToCAVX2F64(dst []float64, a float64, x []float64) {
+	lenVal := int64(min(len(dst), len(x)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	aVal := a
+	mulconstaddto_c_f64_avx2(
+		p_dst,
+		unsafe.Pointer(&aVal),
+		p_x,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// MulToCAVX2F32 computes MulTo using AVX2 SIMD assembly.
+func MulToCAVX2F32(dst, a, b []float32) {
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	multo_c_f32_avx2(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// MulToCAVX2F64 computes MulTo using AVX2 SIMD assembly.
+func MulToCAVX2F64(dst, a, b []float64) {
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	multo_c_f64_avx2(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// ScaleCAVX2F32 computes Scale using AVX2 SIMD assembly.
+func ScaleCAVX2F32(c float32, dst []float32) {
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	cVal := c
+	scale_c_f32_avx2(
+		unsafe.Pointer(&cVal),
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// ScaleCAVX2F64 computes Scale using AVX2 SIMD assembly.
+func ScaleCAVX2F64(c float64, dst []float64) {
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	cVal := c
+	scale_c_f64_avx2(
+		unsafe.Pointer(&cVal),
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// ScaleToCAVX2F32 computes ScaleTo using AVX2 SIMD assembly.
+func ScaleToCAVX2F32(dst []float32, c float32, s []float32) {
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	cVal := c
+	scaleto_c_f32_avx2(
+		p_dst,
+		unsafe.Pointer(&cVal),
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// ScaleToCAVX2F64 computes ScaleTo using AVX2 SIMD assembly.
+func ScaleToCAVX2F64(dst []float64, c float64, s []float64) {
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	cVal := c
+	scaleto_c_f64_avx2(
+		p_dst,
+		unsafe.Pointer(&cVal),
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// SubCAVX2F32 computes Sub using AVX2 SIMD assembly.
+func SubCAVX2F32(dst, s []float32) {
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	sub_c_f32_avx2(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// SubCAVX2F64 computes Sub using AVX2 SIMD assembly.
+func SubCAVX2F64(dst, s []float64) {
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	sub_c_f64_avx2(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// SubToCAVX2F32 computes SubTo using AVX2 SIMD assembly.
+func SubToCAVX2F32(dst, a, b []float32) {
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	subto_c_f32_avx2(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// SubToCAVX2F64 computes SubTo using AVX2 SIMD assembly.
+func SubToCAVX2F64(dst, a, b []float64) {
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	subto_c_f64_avx2(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
@@ -0,0 +1,132 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// BatchDotCAVX512F32 computes BatchDot using AVX512 SIMD assembly.
+func BatchDotCAVX512F32(query, data, dots []float32, count, dims int) {
+	var p_query unsafe.Pointer
+	if len(query) > 0 {
+		p_query = unsafe.Pointer(&query[0])
+	}
+	var p_data unsafe.Pointer
+	if len(data) > 0 {
+		p_data = unsafe.Pointer(&data[0])
+	}
+	var p_dots unsafe.Pointer
+	if len(dots) > 0 {
+		p_dots = unsafe.Pointer(&dots[0])
+	}
+	countVal := int64(count)
+	dimsVal := int64(dims)
+	len_queryVal := int64(len(query))
+	len_dataVal := int64(len(data))
+	len_dotsVal := int64(len(dots))
+	batchdot_c_f32_avx512(
+		p_query,
+		p_data,
+		p_dots,
+		unsafe.Pointer(&countVal),
+		unsafe.Pointer(&dimsVal),
+		unsafe.Pointer(&len_queryVal),
+		unsafe.Pointer(&len_dataVal),
+		unsafe.Pointer(&len_dotsVal),
+	)
+}
+
+// BatchDotCAVX512F64 computes BatchDot using AVX512 SIMD assembly.
+func BatchDotCAVX512F64(query, data, dots []float64, count, dims int) {
+	var p_query unsafe.Pointer
+	if len(query) > 0 {
+		p_query = unsafe.Pointer(&query[0])
+	}
+	var p_data unsafe.Pointer
+	if len(data) > 0 {
+		p_data = unsafe.Pointer(&data[0])
+	}
+	var p_dots unsafe.Pointer
+	if len(dots) > 0 {
+		p_dots = unsafe.Pointer(&dots[0])
+	}
+	countVal := int64(count)
+	dimsVal := int64(dims)
+	len_queryVal := int64(len(query))
+	len_dataVal := int64(len(data))
+	len_dotsVal := int64(len(dots))
+	batchdot_c_f64_avx512(
+		p_query,
+		p_data,
+		p_dots,
+		unsafe.Pointer(&countVal),
+		unsafe.Pointer(&dimsVal),
+		unsafe.Pointer(&len_queryVal),
+		unsafe.Pointer(&len_dataVal),
+		unsafe.Pointer(&len_dotsVal),
+	)
+}
+
+// BatchL2SquaredDistanceCAVX512F32 computes BatchL2SquaredDistance using AVX512 SIMD assembly.
+func BatchL2SquaredDistanceCAVX512F32(query, data, distances []float32, count, dims int) {
+	var p_query unsafe.Pointer
+	if len(query) > 0 {
+		p_query = unsafe.Pointer(&query[0])
+	}
+	var p_data unsafe.Pointer
+	if len(data) > 0 {
+		p_data = unsafe.Pointer(&data[0])
+	}
+	var p_distances unsafe.Pointer
+	if len(distances) > 0 {
+		p_distances = unsafe.Pointer(&distances[0])
+	}
+	countVal := int64(count)
+	dimsVal := int64(dims)
+	len_queryVal := int64(len(query))
+	len_dataVal := int64(len(data))
+	len_distancesVal := int64(len(distances))
+	batchl2squareddistance_c_f32_avx512(
+		p_query,
+		p_data,
+		p_distances,
+		unsafe.Pointer(&countVal),
+		unsafe.Pointer(&dimsVal),
+		unsafe.Pointer(&len_queryVal),
+		unsafe.Pointer(&len_dataVal),
+		unsafe.Pointer(&len_distancesVal),
+	)
+}
+
+// BatchL2SquaredDistanceCAVX512F64 computes BatchL2SquaredDistance using AVX512 SIMD assembly.
+func BatchL2SquaredDistanceCAVX512F64(query, data, distances []float64, count, dims int) {
+	var p_query unsafe.Pointer
+	if len(query) > 0 {
+		p_query = unsafe.Pointer(&query[0])
+	}
+	var p_data unsafe.Pointer
+	if len(data) > 0 {
+		p_data = unsafe.Pointer(&data[0])
+	}
+	var p_distances unsafe.Pointer
+	if len(distances) > 0 {
+		p_distances = unsafe.Pointer(&distances[0])
+	}
+	countVal := int64(count)
+	dimsVal := int64(dims)
+	len_queryVal := int64(len(query))
+	len_dataVal := int64(len(data))
+	len_distancesVal := int64(len(distances))
+	batchl2squareddistance_c_f64_avx512(
+		p_query,
+		p_data,
+		p_distances,
+		unsafe.Pointer(&countVal),
+		unsafe.Pointer(&dimsVal),
+		unsafe.Pointer(&len_queryVal),
+		unsafe.Pointer(&len_dataVal),
+		unsafe.Pointer(&len_distancesVal),
+	)
+}
@@ -0,0 +1,50 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// CopyCAVX512F32 computes Copy using AVX512 SIMD assembly.
+func CopyCAVX512F32(dst, src []float32) {
+	lenVal := int64(min(len(dst), len(src)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_src unsafe.Pointer
+	if len(src) > 0 {
+		p_src = unsafe.Pointer(&src[0])
+	}
+	copy_c_f32_avx512(
+		p_dst,
+		p_src,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// CopyCAVX512F64 computes Copy using AVX512 SIMD assembly.
+func CopyCAVX512F64(dst, src []float64) {
+	lenVal := int64(min(len(dst), len(src)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_src unsafe.Pointer
+	if len(src) > 0 {
+		p_src = unsafe.Pointer(&src[0])
+	}
+	copy_c_f64_avx512(
+		p_dst,
+		p_src,
+		unsafe.Pointer(&lenVal),
+	)
+}
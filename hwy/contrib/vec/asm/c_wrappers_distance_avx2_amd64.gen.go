@@ -0,0 +1,104 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// L2DistanceCAVX2F32 computes L2Distance using AVX2 SIMD assembly.
+func L2DistanceCAVX2F32(a, b []float32) float32 {
+	lenVal := int64(len(a))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	var out_result int64
+	l2distance_c_f32_avx2(
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+// L2DistanceCAVX2F64 computes L2Distance using AVX2 SIMD assembly.
+func L2DistanceCAVX2F64(a, b []float64) float64 {
+	lenVal := int64(len(a))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	var out_result int64
+	l2distance_c_f64_avx2(
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
+
+// L2SquaredDistanceCAVX2F32 computes L2SquaredDistance using AVX2 SIMD assembly.
+func L2SquaredDistanceCAVX2F32(a, b []float32) float32 {
+	lenVal := int64(min(len(a), len(b)))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	var out_result int64
+	l2squareddistance_c_f32_avx2(
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+// L2SquaredDistanceCAVX2F64 computes L2SquaredDistance using AVX2 SIMD assembly.
+func L2SquaredDistanceCAVX2F64(a, b []float64) float64 {
+	lenVal := int64(min(len(a), len(b)))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	var out_result int64
+	l2squareddistance_c_f64_avx2(
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
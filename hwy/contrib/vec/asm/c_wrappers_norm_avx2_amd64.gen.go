@@ -0,0 +1,84 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// NormCAVX2F32 computes Norm using AVX2 SIMD assembly.
+func NormCAVX2F32(v []float32) float32 {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	norm_c_f32_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+// NormCAVX2F64 computes Norm using AVX2 SIMD assembly.
+func NormCAVX2F64(v []float64) float64 {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	norm_c_f64_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
+
+// SquaredNormCAVX2F32 computes SquaredNorm using AVX2 SIMD assembly.
+func SquaredNormCAVX2F32(v []float32) float32 {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	squarednorm_c_f32_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+// SquaredNormCAVX2F64 computes SquaredNorm using AVX2 SIMD assembly.
+func SquaredNormCAVX2F64(v []float64) float64 {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	squarednorm_c_f64_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
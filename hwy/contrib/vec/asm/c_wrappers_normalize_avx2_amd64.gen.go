@@ -0,0 +1,82 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// NormalizeCAVX2F32 computes Normalize using AVX2 SIMD assembly.
+func NormalizeCAVX2F32(dst []float32) {
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	normalize_c_f32_avx2(
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// NormalizeCAVX2F64 computes Normalize using AVX2 SIMD assembly.
+func NormalizeCAVX2F64(dst []float64) {
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	normalize_c_f64_avx2(
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// NormalizeToCAVX2F32 computes NormalizeTo using AVX2 SIMD assembly.
+func NormalizeToCAVX2F32(dst, src []float32) {
+	lenVal := int64(min(len(dst), len(src)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_src unsafe.Pointer
+	if len(src) > 0 {
+		p_src = unsafe.Pointer(&src[0])
+	}
+	normalizeto_c_f32_avx2(
+		p_dst,
+		p_src,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+// NormalizeToCAVX2F64 computes NormalizeTo using AVX2 SIMD assembly.
+func NormalizeToCAVX2F64(dst, src []float64) {
+	lenVal := int64(min(len(dst), len(src)))
+	if lenVal == 0 {
+		return
+	}
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_src unsafe.Pointer
+	if len(src) > 0 {
+		p_src = unsafe.Pointer(&src[0])
+	}
+	normalizeto_c_f64_avx2(
+		p_dst,
+		p_src,
+		unsafe.Pointer(&lenVal),
+	)
+}
@@ -0,0 +1,164 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package asm
+
+import "unsafe"
+
+// Public wrapper functions
+// MaxCAVX2F32 computes Max using AVX2 SIMD assembly.
+func MaxCAVX2F32(v []float32) float32 {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	max_c_f32_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+// MaxCAVX2F64 computes Max using AVX2 SIMD assembly.
+func MaxCAVX2F64(v []float64) float64 {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	max_c_f64_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
+
+// MinCAVX2F32 computes Min using AVX2 SIMD assembly.
+func MinCAVX2F32(v []float32) float32 {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	min_c_f32_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+// MinCAVX2F64 computes Min using AVX2 SIMD assembly.
+func MinCAVX2F64(v []float64) float64 {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	min_c_f64_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
+
+// MinMaxCAVX2F32 computes MinMax using AVX2 SIMD assembly.
+func MinMaxCAVX2F32(v []float32) (float32, float32) {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0, 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_minVal int64
+	var out_maxVal int64
+	minmax_c_f32_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_minVal),
+		unsafe.Pointer(&out_maxVal),
+	)
+	return float32(out_minVal), float32(out_maxVal)
+}
+
+// MinMaxCAVX2F64 computes MinMax using AVX2 SIMD assembly.
+func MinMaxCAVX2F64(v []float64) (float64, float64) {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0, 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_minVal int64
+	var out_maxVal int64
+	minmax_c_f64_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_minVal),
+		unsafe.Pointer(&out_maxVal),
+	)
+	return float64(out_minVal), float64(out_maxVal)
+}
+
+// SumCAVX2F32 computes Sum using AVX2 SIMD assembly.
+func SumCAVX2F32(v []float32) float32 {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	sum_c_f32_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+// SumCAVX2F64 computes Sum using AVX2 SIMD assembly.
+func SumCAVX2F64(v []float64) float64 {
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return 0
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	var out_result int64
+	sum_c_f64_avx2(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
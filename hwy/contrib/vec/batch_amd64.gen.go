@@ -55,6 +55,8 @@ var BatchL2SquaredDistanceFloat64 func(query []float64, data []float64, distance
 //	// dots[2] = 1*2 + 2*2 + 3*2 = 12
 //
 // This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:kernel
 func BatchDot[T hwy.Floats](query []T, data []T, dots []T, count int, dims int) {
 	switch any(query).(type) {
 	case []hwy.Float16:
@@ -68,6 +70,30 @@ func BatchDot[T hwy.Floats](query []T, data []T, dots []T, count int, dims int)
 	}
 }
 
+// BatchDotKernel returns the BatchDot implementation selected for T on this CPU.
+// Calling the returned function skips the per-call type dispatch of BatchDot,
+// which matters when it is called many times on short inputs.
+//
+// The handle is the implementation in effect when BatchDotKernel is called.
+// Take it after hwy.ForceDispatch or hwy.ApplyDispatchEnv, and again after
+// any later override or restore; an older handle keeps the old target.
+func BatchDotKernel[T hwy.Floats]() func(query []T, data []T, dots []T, count int, dims int) {
+	var zero T
+	if _, ok := any(zero).(hwy.Float16); ok {
+		return any(BatchDotFloat16).(func(query []T, data []T, dots []T, count int, dims int))
+	}
+	if _, ok := any(zero).(hwy.BFloat16); ok {
+		return any(BatchDotBFloat16).(func(query []T, data []T, dots []T, count int, dims int))
+	}
+	if _, ok := any(zero).(float32); ok {
+		return any(BatchDotFloat32).(func(query []T, data []T, dots []T, count int, dims int))
+	}
+	if _, ok := any(zero).(float64); ok {
+		return any(BatchDotFloat64).(func(query []T, data []T, dots []T, count int, dims int))
+	}
+	panic("unsupported type")
+}
+
 // BatchL2SquaredDistance computes the L2 squared distance from a single query
 // vector to multiple data vectors using SIMD primitives.
 //
@@ -104,6 +130,8 @@ func BatchDot[T hwy.Floats](query []T, data []T, dots []T, count int, dims int)
 //	// distances[2] = 1 + 4 + 9 = 14
 //
 // This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:kernel
 func BatchL2SquaredDistance[T hwy.Floats](query []T, data []T, distances []T, count int, dims int) {
 	switch any(query).(type) {
 	case []hwy.Float16:
@@ -117,8 +145,44 @@ func BatchL2SquaredDistance[T hwy.Floats](query []T, data []T, distances []T, co
 	}
 }
 
+// BatchL2SquaredDistanceKernel returns the BatchL2SquaredDistance implementation selected for T on this CPU.
+// Calling the returned function skips the per-call type dispatch of BatchL2SquaredDistance,
+// which matters when it is called many times on short inputs.
+//
+// The handle is the implementation in effect when BatchL2SquaredDistanceKernel is called.
+// Take it after hwy.ForceDispatch or hwy.ApplyDispatchEnv, and again after
+// any later override or restore; an older handle keeps the old target.
+func BatchL2SquaredDistanceKernel[T hwy.Floats]() func(query []T, data []T, distances []T, count int, dims int) {
+	var zero T
+	if _, ok := any(zero).(hwy.Float16); ok {
+		return any(BatchL2SquaredDistanceFloat16).(func(query []T, data []T, distances []T, count int, dims int))
+	}
+	if _, ok := any(zero).(hwy.BFloat16); ok {
+		return any(BatchL2SquaredDistanceBFloat16).(func(query []T, data []T, distances []T, count int, dims int))
+	}
+	if _, ok := any(zero).(float32); ok {
+		return any(BatchL2SquaredDistanceFloat32).(func(query []T, data []T, distances []T, count int, dims int))
+	}
+	if _, ok := any(zero).(float64); ok {
+		return any(BatchL2SquaredDistanceFloat64).(func(query []T, data []T, distances []T, count int, dims int))
+	}
+	panic("unsupported type")
+}
+
 func init() {
 	initBatchAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "BatchDot", Vars: []any{&BatchDotFloat16, &BatchDotBFloat16, &BatchDotFloat32, &BatchDotFloat64}},
+			{Name: "BatchL2SquaredDistance", Vars: []any{&BatchL2SquaredDistanceFloat16, &BatchL2SquaredDistanceBFloat16, &BatchL2SquaredDistanceFloat32, &BatchL2SquaredDistanceFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initBatchAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initBatchAVX2},
+			{Name: "fallback", Supported: true, Init: initBatchFallback},
+		},
+	})
 }
 
 func initBatchAll() {
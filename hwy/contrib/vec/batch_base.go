@@ -14,7 +14,7 @@
 
 package vec
 
-//go:generate go run ../../../cmd/hwygen -input batch_base.go -output . -targets avx2,avx512,neon:asm,fallback -dispatch batch
+//go:generate go run ../../../cmd/hwygen -input batch_base.go -output . -targets avx2,avx512,avx2:asm,avx512:asm,neon:asm,fallback -dispatch batch
 
 import "github.com/ajroetker/go-highway/hwy"
 
@@ -52,6 +52,8 @@ import "github.com/ajroetker/go-highway/hwy"
 //	// distances[0] = (1-4)^2 + (2-5)^2 + (3-6)^2 = 27
 //	// distances[1] = 0 (same as query)
 //	// distances[2] = 1 + 4 + 9 = 14
+//
+//hwy:kernel
 func BaseBatchL2SquaredDistance[T hwy.Floats](query, data []T, distances []T, count, dims int) {
 	// Handle edge cases
 	if count <= 0 || dims <= 0 {
@@ -138,6 +140,8 @@ func BaseBatchL2SquaredDistance[T hwy.Floats](query, data []T, distances []T, co
 //	// dots[0] = 1*4 + 2*5 + 3*6 = 32
 //	// dots[1] = 1*1 + 2*0 + 3*0 = 1
 //	// dots[2] = 1*2 + 2*2 + 3*2 = 12
+//
+//hwy:kernel
 func BaseBatchDot[T hwy.Floats](query, data []T, dots []T, count, dims int) {
 	// Handle edge cases
 	if count <= 0 || dims <= 0 {
@@ -0,0 +1,165 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package vec
+
+//go:generate go run ../../../cmd/hwygen -input batch_blocked_base.go -output . -targets avx2,avx512,avx2:asm,avx512:asm,neon,fallback -dispatch batchblocked
+
+import "github.com/ajroetker/go-highway/hwy"
+
+// blockedRows is the number of data vectors scored per query load by the
+// blocked batch kernels.
+const blockedRows = 4
+
+// BaseBatchL2SquaredDistanceBlocked computes the same distances as
+// BaseBatchL2SquaredDistance, scoring blockedRows data vectors at a time.
+//
+// Every query vector loaded from L1 is reused for four data rows, and the
+// four independent accumulators hide the FMA latency that a single
+// per-row accumulator chain exposes. Rows left over after the last full
+// block are scored one at a time.
+//
+//hwy:gen T={float32, float64}
+func BaseBatchL2SquaredDistanceBlocked[T float32 | float64](query, data []T, distances []T, count, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(distances) < count || len(query) < dims {
+		return
+	}
+	lanes := hwy.Zero[T]().NumLanes()
+
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := hwy.Zero[T]()
+		s1 := hwy.Zero[T]()
+		s2 := hwy.Zero[T]()
+		s3 := hwy.Zero[T]()
+		var j int
+		//hwy:unroll 1
+		for j = 0; j+lanes <= dims; j += lanes {
+			vq := hwy.Load(query[j:])
+			d0 := hwy.Sub(vq, hwy.Load(r0[j:]))
+			d1 := hwy.Sub(vq, hwy.Load(r1[j:]))
+			d2 := hwy.Sub(vq, hwy.Load(r2[j:]))
+			d3 := hwy.Sub(vq, hwy.Load(r3[j:]))
+			s0 = hwy.MulAdd(d0, d0, s0)
+			s1 = hwy.MulAdd(d1, d1, s1)
+			s2 = hwy.MulAdd(d2, d2, s2)
+			s3 = hwy.MulAdd(d3, d3, s3)
+		}
+		t0 := hwy.ReduceSum(s0)
+		t1 := hwy.ReduceSum(s1)
+		t2 := hwy.ReduceSum(s2)
+		t3 := hwy.ReduceSum(s3)
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += (q - r0[j]) * (q - r0[j])
+			t1 += (q - r1[j]) * (q - r1[j])
+			t2 += (q - r2[j]) * (q - r2[j])
+			t3 += (q - r3[j]) * (q - r3[j])
+		}
+		distances[i] = t0
+		distances[i+1] = t1
+		distances[i+2] = t2
+		distances[i+3] = t3
+	}
+
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := hwy.Zero[T]()
+		var j int
+		//hwy:unroll 1
+		for j = 0; j+lanes <= dims; j += lanes {
+			d := hwy.Sub(hwy.Load(query[j:]), hwy.Load(row[j:]))
+			sum = hwy.MulAdd(d, d, sum)
+		}
+		result := hwy.ReduceSum(sum)
+		for ; j < dims; j++ {
+			d := query[j] - row[j]
+			result += d * d
+		}
+		distances[i] = result
+	}
+}
+
+// BaseBatchDotBlocked computes the same dot products as BaseBatchDot,
+// scoring blockedRows data vectors per query load (see
+// BaseBatchL2SquaredDistanceBlocked).
+//
+//hwy:gen T={float32, float64}
+func BaseBatchDotBlocked[T float32 | float64](query, data []T, dots []T, count, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(dots) < count || len(query) < dims {
+		return
+	}
+	lanes := hwy.Zero[T]().NumLanes()
+
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := hwy.Zero[T]()
+		s1 := hwy.Zero[T]()
+		s2 := hwy.Zero[T]()
+		s3 := hwy.Zero[T]()
+		var j int
+		//hwy:unroll 1
+		for j = 0; j+lanes <= dims; j += lanes {
+			vq := hwy.Load(query[j:])
+			s0 = hwy.MulAdd(vq, hwy.Load(r0[j:]), s0)
+			s1 = hwy.MulAdd(vq, hwy.Load(r1[j:]), s1)
+			s2 = hwy.MulAdd(vq, hwy.Load(r2[j:]), s2)
+			s3 = hwy.MulAdd(vq, hwy.Load(r3[j:]), s3)
+		}
+		t0 := hwy.ReduceSum(s0)
+		t1 := hwy.ReduceSum(s1)
+		t2 := hwy.ReduceSum(s2)
+		t3 := hwy.ReduceSum(s3)
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += q * r0[j]
+			t1 += q * r1[j]
+			t2 += q * r2[j]
+			t3 += q * r3[j]
+		}
+		dots[i] = t0
+		dots[i+1] = t1
+		dots[i+2] = t2
+		dots[i+3] = t3
+	}
+
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := hwy.Zero[T]()
+		var j int
+		//hwy:unroll 1
+		for j = 0; j+lanes <= dims; j += lanes {
+			sum = hwy.MulAdd(hwy.Load(query[j:]), hwy.Load(row[j:]), sum)
+		}
+		result := hwy.ReduceSum(sum)
+		for ; j < dims; j++ {
+			result += query[j] * row[j]
+		}
+		dots[i] = result
+	}
+}
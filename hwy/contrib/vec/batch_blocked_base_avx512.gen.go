@@ -0,0 +1,252 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package vec
+
+import (
+	"simd/archsimd"
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func BaseBatchDotBlocked_avx512(query []float32, data []float32, dots []float32, count int, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(dots) < count || len(query) < dims {
+		return
+	}
+	lanes := 16
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := archsimd.BroadcastFloat32x16(0)
+		s1 := archsimd.BroadcastFloat32x16(0)
+		s2 := archsimd.BroadcastFloat32x16(0)
+		s3 := archsimd.BroadcastFloat32x16(0)
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			vq := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&query[j])))
+			s0 = vq.MulAdd(archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&r0[j]))), s0)
+			s1 = vq.MulAdd(archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&r1[j]))), s1)
+			s2 = vq.MulAdd(archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&r2[j]))), s2)
+			s3 = vq.MulAdd(archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&r3[j]))), s3)
+		}
+		t0 := hwy.ReduceSum_AVX512_F32x16(s0)
+		t1 := hwy.ReduceSum_AVX512_F32x16(s1)
+		t2 := hwy.ReduceSum_AVX512_F32x16(s2)
+		t3 := hwy.ReduceSum_AVX512_F32x16(s3)
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += q * r0[j]
+			t1 += q * r1[j]
+			t2 += q * r2[j]
+			t3 += q * r3[j]
+		}
+		dots[i] = t0
+		dots[i+1] = t1
+		dots[i+2] = t2
+		dots[i+3] = t3
+	}
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := archsimd.BroadcastFloat32x16(0)
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			sum = archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&query[j]))).MulAdd(archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&row[j]))), sum)
+		}
+		result := hwy.ReduceSum_AVX512_F32x16(sum)
+		for ; j < dims; j++ {
+			result += query[j] * row[j]
+		}
+		dots[i] = result
+	}
+}
+
+func BaseBatchDotBlocked_avx512_Float64(query []float64, data []float64, dots []float64, count int, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(dots) < count || len(query) < dims {
+		return
+	}
+	lanes := 8
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := archsimd.BroadcastFloat64x8(0)
+		s1 := archsimd.BroadcastFloat64x8(0)
+		s2 := archsimd.BroadcastFloat64x8(0)
+		s3 := archsimd.BroadcastFloat64x8(0)
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			vq := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&query[j])))
+			s0 = vq.MulAdd(archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&r0[j]))), s0)
+			s1 = vq.MulAdd(archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&r1[j]))), s1)
+			s2 = vq.MulAdd(archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&r2[j]))), s2)
+			s3 = vq.MulAdd(archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&r3[j]))), s3)
+		}
+		t0 := hwy.ReduceSum_AVX512_F64x8(s0)
+		t1 := hwy.ReduceSum_AVX512_F64x8(s1)
+		t2 := hwy.ReduceSum_AVX512_F64x8(s2)
+		t3 := hwy.ReduceSum_AVX512_F64x8(s3)
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += q * r0[j]
+			t1 += q * r1[j]
+			t2 += q * r2[j]
+			t3 += q * r3[j]
+		}
+		dots[i] = t0
+		dots[i+1] = t1
+		dots[i+2] = t2
+		dots[i+3] = t3
+	}
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := archsimd.BroadcastFloat64x8(0)
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			sum = archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&query[j]))).MulAdd(archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&row[j]))), sum)
+		}
+		result := hwy.ReduceSum_AVX512_F64x8(sum)
+		for ; j < dims; j++ {
+			result += query[j] * row[j]
+		}
+		dots[i] = result
+	}
+}
+
+func BaseBatchL2SquaredDistanceBlocked_avx512(query []float32, data []float32, distances []float32, count int, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(distances) < count || len(query) < dims {
+		return
+	}
+	lanes := 16
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := archsimd.BroadcastFloat32x16(0)
+		s1 := archsimd.BroadcastFloat32x16(0)
+		s2 := archsimd.BroadcastFloat32x16(0)
+		s3 := archsimd.BroadcastFloat32x16(0)
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			vq := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&query[j])))
+			d0 := vq.Sub(archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&r0[j]))))
+			d1 := vq.Sub(archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&r1[j]))))
+			d2 := vq.Sub(archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&r2[j]))))
+			d3 := vq.Sub(archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&r3[j]))))
+			s0 = d0.MulAdd(d0, s0)
+			s1 = d1.MulAdd(d1, s1)
+			s2 = d2.MulAdd(d2, s2)
+			s3 = d3.MulAdd(d3, s3)
+		}
+		t0 := hwy.ReduceSum_AVX512_F32x16(s0)
+		t1 := hwy.ReduceSum_AVX512_F32x16(s1)
+		t2 := hwy.ReduceSum_AVX512_F32x16(s2)
+		t3 := hwy.ReduceSum_AVX512_F32x16(s3)
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += (q - r0[j]) * (q - r0[j])
+			t1 += (q - r1[j]) * (q - r1[j])
+			t2 += (q - r2[j]) * (q - r2[j])
+			t3 += (q - r3[j]) * (q - r3[j])
+		}
+		distances[i] = t0
+		distances[i+1] = t1
+		distances[i+2] = t2
+		distances[i+3] = t3
+	}
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := archsimd.BroadcastFloat32x16(0)
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			d := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&query[j]))).Sub(archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&row[j]))))
+			sum = d.MulAdd(d, sum)
+		}
+		result := hwy.ReduceSum_AVX512_F32x16(sum)
+		for ; j < dims; j++ {
+			d := query[j] - row[j]
+			result += d * d
+		}
+		distances[i] = result
+	}
+}
+
+func BaseBatchL2SquaredDistanceBlocked_avx512_Float64(query []float64, data []float64, distances []float64, count int, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(distances) < count || len(query) < dims {
+		return
+	}
+	lanes := 8
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := archsimd.BroadcastFloat64x8(0)
+		s1 := archsimd.BroadcastFloat64x8(0)
+		s2 := archsimd.BroadcastFloat64x8(0)
+		s3 := archsimd.BroadcastFloat64x8(0)
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			vq := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&query[j])))
+			d0 := vq.Sub(archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&r0[j]))))
+			d1 := vq.Sub(archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&r1[j]))))
+			d2 := vq.Sub(archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&r2[j]))))
+			d3 := vq.Sub(archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&r3[j]))))
+			s0 = d0.MulAdd(d0, s0)
+			s1 = d1.MulAdd(d1, s1)
+			s2 = d2.MulAdd(d2, s2)
+			s3 = d3.MulAdd(d3, s3)
+		}
+		t0 := hwy.ReduceSum_AVX512_F64x8(s0)
+		t1 := hwy.ReduceSum_AVX512_F64x8(s1)
+		t2 := hwy.ReduceSum_AVX512_F64x8(s2)
+		t3 := hwy.ReduceSum_AVX512_F64x8(s3)
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += (q - r0[j]) * (q - r0[j])
+			t1 += (q - r1[j]) * (q - r1[j])
+			t2 += (q - r2[j]) * (q - r2[j])
+			t3 += (q - r3[j]) * (q - r3[j])
+		}
+		distances[i] = t0
+		distances[i+1] = t1
+		distances[i+2] = t2
+		distances[i+3] = t3
+	}
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := archsimd.BroadcastFloat64x8(0)
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			d := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&query[j]))).Sub(archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&row[j]))))
+			sum = d.MulAdd(d, sum)
+		}
+		result := hwy.ReduceSum_AVX512_F64x8(sum)
+		for ; j < dims; j++ {
+			d := query[j] - row[j]
+			result += d * d
+		}
+		distances[i] = result
+	}
+}
@@ -0,0 +1,239 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package vec
+
+func BaseBatchDotBlocked_fallback(query []float32, data []float32, dots []float32, count int, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(dots) < count || len(query) < dims {
+		return
+	}
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := float32(0)
+		s1 := float32(0)
+		s2 := float32(0)
+		s3 := float32(0)
+		var j int
+		for j = 0; j < dims; j++ {
+			vq := query[j]
+			s0 = vq*r0[j] + s0
+			s1 = vq*r1[j] + s1
+			s2 = vq*r2[j] + s2
+			s3 = vq*r3[j] + s3
+		}
+		t0 := s0
+		t1 := s1
+		t2 := s2
+		t3 := s3
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += q * r0[j]
+			t1 += q * r1[j]
+			t2 += q * r2[j]
+			t3 += q * r3[j]
+		}
+		dots[i] = t0
+		dots[i+1] = t1
+		dots[i+2] = t2
+		dots[i+3] = t3
+	}
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := float32(0)
+		var j int
+		for j = 0; j < dims; j++ {
+			sum = query[j]*row[j] + sum
+		}
+		result := sum
+		for ; j < dims; j++ {
+			result += query[j] * row[j]
+		}
+		dots[i] = result
+	}
+}
+
+func BaseBatchDotBlocked_fallback_Float64(query []float64, data []float64, dots []float64, count int, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(dots) < count || len(query) < dims {
+		return
+	}
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := float64(0)
+		s1 := float64(0)
+		s2 := float64(0)
+		s3 := float64(0)
+		var j int
+		for j = 0; j < dims; j++ {
+			vq := query[j]
+			s0 = vq*r0[j] + s0
+			s1 = vq*r1[j] + s1
+			s2 = vq*r2[j] + s2
+			s3 = vq*r3[j] + s3
+		}
+		t0 := s0
+		t1 := s1
+		t2 := s2
+		t3 := s3
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += q * r0[j]
+			t1 += q * r1[j]
+			t2 += q * r2[j]
+			t3 += q * r3[j]
+		}
+		dots[i] = t0
+		dots[i+1] = t1
+		dots[i+2] = t2
+		dots[i+3] = t3
+	}
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := float64(0)
+		var j int
+		for j = 0; j < dims; j++ {
+			sum = query[j]*row[j] + sum
+		}
+		result := sum
+		for ; j < dims; j++ {
+			result += query[j] * row[j]
+		}
+		dots[i] = result
+	}
+}
+
+func BaseBatchL2SquaredDistanceBlocked_fallback(query []float32, data []float32, distances []float32, count int, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(distances) < count || len(query) < dims {
+		return
+	}
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := float32(0)
+		s1 := float32(0)
+		s2 := float32(0)
+		s3 := float32(0)
+		var j int
+		for j = 0; j < dims; j++ {
+			vq := query[j]
+			d0 := vq - r0[j]
+			d1 := vq - r1[j]
+			d2 := vq - r2[j]
+			d3 := vq - r3[j]
+			s0 = d0*d0 + s0
+			s1 = d1*d1 + s1
+			s2 = d2*d2 + s2
+			s3 = d3*d3 + s3
+		}
+		t0 := s0
+		t1 := s1
+		t2 := s2
+		t3 := s3
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += (q - r0[j]) * (q - r0[j])
+			t1 += (q - r1[j]) * (q - r1[j])
+			t2 += (q - r2[j]) * (q - r2[j])
+			t3 += (q - r3[j]) * (q - r3[j])
+		}
+		distances[i] = t0
+		distances[i+1] = t1
+		distances[i+2] = t2
+		distances[i+3] = t3
+	}
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := float32(0)
+		var j int
+		for j = 0; j < dims; j++ {
+			d := query[j] - row[j]
+			sum = d*d + sum
+		}
+		result := sum
+		for ; j < dims; j++ {
+			d := query[j] - row[j]
+			result += d * d
+		}
+		distances[i] = result
+	}
+}
+
+func BaseBatchL2SquaredDistanceBlocked_fallback_Float64(query []float64, data []float64, distances []float64, count int, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(distances) < count || len(query) < dims {
+		return
+	}
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := float64(0)
+		s1 := float64(0)
+		s2 := float64(0)
+		s3 := float64(0)
+		var j int
+		for j = 0; j < dims; j++ {
+			vq := query[j]
+			d0 := vq - r0[j]
+			d1 := vq - r1[j]
+			d2 := vq - r2[j]
+			d3 := vq - r3[j]
+			s0 = d0*d0 + s0
+			s1 = d1*d1 + s1
+			s2 = d2*d2 + s2
+			s3 = d3*d3 + s3
+		}
+		t0 := s0
+		t1 := s1
+		t2 := s2
+		t3 := s3
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += (q - r0[j]) * (q - r0[j])
+			t1 += (q - r1[j]) * (q - r1[j])
+			t2 += (q - r2[j]) * (q - r2[j])
+			t3 += (q - r3[j]) * (q - r3[j])
+		}
+		distances[i] = t0
+		distances[i+1] = t1
+		distances[i+2] = t2
+		distances[i+3] = t3
+	}
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := float64(0)
+		var j int
+		for j = 0; j < dims; j++ {
+			d := query[j] - row[j]
+			sum = d*d + sum
+		}
+		result := sum
+		for ; j < dims; j++ {
+			d := query[j] - row[j]
+			result += d * d
+		}
+		distances[i] = result
+	}
+}
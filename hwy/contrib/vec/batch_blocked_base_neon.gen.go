@@ -0,0 +1,251 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package vec
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy/asm"
+)
+
+func BaseBatchDotBlocked_neon(query []float32, data []float32, dots []float32, count int, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(dots) < count || len(query) < dims {
+		return
+	}
+	lanes := 4
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := asm.ZeroFloat32x4()
+		s1 := asm.ZeroFloat32x4()
+		s2 := asm.ZeroFloat32x4()
+		s3 := asm.ZeroFloat32x4()
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			vq := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&query[j])))
+			vq.MulAddAcc(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&r0[j]))), &s0)
+			vq.MulAddAcc(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&r1[j]))), &s1)
+			vq.MulAddAcc(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&r2[j]))), &s2)
+			vq.MulAddAcc(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&r3[j]))), &s3)
+		}
+		t0 := s0.ReduceSum()
+		t1 := s1.ReduceSum()
+		t2 := s2.ReduceSum()
+		t3 := s3.ReduceSum()
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += q * r0[j]
+			t1 += q * r1[j]
+			t2 += q * r2[j]
+			t3 += q * r3[j]
+		}
+		dots[i] = t0
+		dots[i+1] = t1
+		dots[i+2] = t2
+		dots[i+3] = t3
+	}
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := asm.ZeroFloat32x4()
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&query[j]))).MulAddAcc(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&row[j]))), &sum)
+		}
+		result := sum.ReduceSum()
+		for ; j < dims; j++ {
+			result += query[j] * row[j]
+		}
+		dots[i] = result
+	}
+}
+
+func BaseBatchDotBlocked_neon_Float64(query []float64, data []float64, dots []float64, count int, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(dots) < count || len(query) < dims {
+		return
+	}
+	lanes := 2
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := asm.ZeroFloat64x2()
+		s1 := asm.ZeroFloat64x2()
+		s2 := asm.ZeroFloat64x2()
+		s3 := asm.ZeroFloat64x2()
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			vq := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&query[j])))
+			vq.MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&r0[j]))), &s0)
+			vq.MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&r1[j]))), &s1)
+			vq.MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&r2[j]))), &s2)
+			vq.MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&r3[j]))), &s3)
+		}
+		t0 := s0.ReduceSum()
+		t1 := s1.ReduceSum()
+		t2 := s2.ReduceSum()
+		t3 := s3.ReduceSum()
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += q * r0[j]
+			t1 += q * r1[j]
+			t2 += q * r2[j]
+			t3 += q * r3[j]
+		}
+		dots[i] = t0
+		dots[i+1] = t1
+		dots[i+2] = t2
+		dots[i+3] = t3
+	}
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := asm.ZeroFloat64x2()
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&query[j]))).MulAddAcc(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&row[j]))), &sum)
+		}
+		result := sum.ReduceSum()
+		for ; j < dims; j++ {
+			result += query[j] * row[j]
+		}
+		dots[i] = result
+	}
+}
+
+func BaseBatchL2SquaredDistanceBlocked_neon(query []float32, data []float32, distances []float32, count int, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(distances) < count || len(query) < dims {
+		return
+	}
+	lanes := 4
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := asm.ZeroFloat32x4()
+		s1 := asm.ZeroFloat32x4()
+		s2 := asm.ZeroFloat32x4()
+		s3 := asm.ZeroFloat32x4()
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			vq := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&query[j])))
+			d0 := vq.Sub(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&r0[j]))))
+			d1 := vq.Sub(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&r1[j]))))
+			d2 := vq.Sub(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&r2[j]))))
+			d3 := vq.Sub(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&r3[j]))))
+			d0.MulAddAcc(d0, &s0)
+			d1.MulAddAcc(d1, &s1)
+			d2.MulAddAcc(d2, &s2)
+			d3.MulAddAcc(d3, &s3)
+		}
+		t0 := s0.ReduceSum()
+		t1 := s1.ReduceSum()
+		t2 := s2.ReduceSum()
+		t3 := s3.ReduceSum()
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += (q - r0[j]) * (q - r0[j])
+			t1 += (q - r1[j]) * (q - r1[j])
+			t2 += (q - r2[j]) * (q - r2[j])
+			t3 += (q - r3[j]) * (q - r3[j])
+		}
+		distances[i] = t0
+		distances[i+1] = t1
+		distances[i+2] = t2
+		distances[i+3] = t3
+	}
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := asm.ZeroFloat32x4()
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			d := asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&query[j]))).Sub(asm.LoadFloat32x4((*[4]float32)(unsafe.Pointer(&row[j]))))
+			d.MulAddAcc(d, &sum)
+		}
+		result := sum.ReduceSum()
+		for ; j < dims; j++ {
+			d := query[j] - row[j]
+			result += d * d
+		}
+		distances[i] = result
+	}
+}
+
+func BaseBatchL2SquaredDistanceBlocked_neon_Float64(query []float64, data []float64, distances []float64, count int, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if len(data) < count*dims || len(distances) < count || len(query) < dims {
+		return
+	}
+	lanes := 2
+	var i int
+	for i = 0; i+blockedRows <= count; i += blockedRows {
+		r0 := data[i*dims : (i+1)*dims]
+		r1 := data[(i+1)*dims : (i+2)*dims]
+		r2 := data[(i+2)*dims : (i+3)*dims]
+		r3 := data[(i+3)*dims : (i+4)*dims]
+		s0 := asm.ZeroFloat64x2()
+		s1 := asm.ZeroFloat64x2()
+		s2 := asm.ZeroFloat64x2()
+		s3 := asm.ZeroFloat64x2()
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			vq := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&query[j])))
+			d0 := vq.Sub(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&r0[j]))))
+			d1 := vq.Sub(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&r1[j]))))
+			d2 := vq.Sub(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&r2[j]))))
+			d3 := vq.Sub(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&r3[j]))))
+			s0 = d0.MulAdd(d0, s0)
+			s1 = d1.MulAdd(d1, s1)
+			s2 = d2.MulAdd(d2, s2)
+			s3 = d3.MulAdd(d3, s3)
+		}
+		t0 := s0.ReduceSum()
+		t1 := s1.ReduceSum()
+		t2 := s2.ReduceSum()
+		t3 := s3.ReduceSum()
+		for ; j < dims; j++ {
+			q := query[j]
+			t0 += (q - r0[j]) * (q - r0[j])
+			t1 += (q - r1[j]) * (q - r1[j])
+			t2 += (q - r2[j]) * (q - r2[j])
+			t3 += (q - r3[j]) * (q - r3[j])
+		}
+		distances[i] = t0
+		distances[i+1] = t1
+		distances[i+2] = t2
+		distances[i+3] = t3
+	}
+	for ; i < count; i++ {
+		row := data[i*dims : (i+1)*dims]
+		sum := asm.ZeroFloat64x2()
+		var j int
+		for j = 0; j+lanes <= dims; j += lanes {
+			d := asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&query[j]))).Sub(asm.LoadFloat64x2((*[2]float64)(unsafe.Pointer(&row[j]))))
+			sum = d.MulAdd(d, sum)
+		}
+		result := sum.ReduceSum()
+		for ; j < dims; j++ {
+			d := query[j] - row[j]
+			result += d * d
+		}
+		distances[i] = result
+	}
+}
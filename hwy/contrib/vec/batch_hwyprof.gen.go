@@ -0,0 +1,72 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("vec", "BatchDot", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := BatchDotFloat16; hwyImpl != nil {
+			BatchDotFloat16 = func(query []hwy.Float16, data []hwy.Float16, dots []hwy.Float16, count int, dims int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, data, dots, count, dims)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(data)+hwy.SliceBytes(dots))
+			}
+		}
+		if hwyImpl := BatchDotBFloat16; hwyImpl != nil {
+			BatchDotBFloat16 = func(query []hwy.BFloat16, data []hwy.BFloat16, dots []hwy.BFloat16, count int, dims int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, data, dots, count, dims)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(data)+hwy.SliceBytes(dots))
+			}
+		}
+		if hwyImpl := BatchDotFloat32; hwyImpl != nil {
+			BatchDotFloat32 = func(query []float32, data []float32, dots []float32, count int, dims int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, data, dots, count, dims)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(data)+hwy.SliceBytes(dots))
+			}
+		}
+		if hwyImpl := BatchDotFloat64; hwyImpl != nil {
+			BatchDotFloat64 = func(query []float64, data []float64, dots []float64, count int, dims int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, data, dots, count, dims)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(data)+hwy.SliceBytes(dots))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "BatchL2SquaredDistance", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := BatchL2SquaredDistanceFloat16; hwyImpl != nil {
+			BatchL2SquaredDistanceFloat16 = func(query []hwy.Float16, data []hwy.Float16, distances []hwy.Float16, count int, dims int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, data, distances, count, dims)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(data)+hwy.SliceBytes(distances))
+			}
+		}
+		if hwyImpl := BatchL2SquaredDistanceBFloat16; hwyImpl != nil {
+			BatchL2SquaredDistanceBFloat16 = func(query []hwy.BFloat16, data []hwy.BFloat16, distances []hwy.BFloat16, count int, dims int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, data, distances, count, dims)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(data)+hwy.SliceBytes(distances))
+			}
+		}
+		if hwyImpl := BatchL2SquaredDistanceFloat32; hwyImpl != nil {
+			BatchL2SquaredDistanceFloat32 = func(query []float32, data []float32, distances []float32, count int, dims int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, data, distances, count, dims)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(data)+hwy.SliceBytes(distances))
+			}
+		}
+		if hwyImpl := BatchL2SquaredDistanceFloat64; hwyImpl != nil {
+			BatchL2SquaredDistanceFloat64 = func(query []float64, data []float64, distances []float64, count int, dims int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, data, distances, count, dims)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(data)+hwy.SliceBytes(distances))
+			}
+		}
+	})
+}
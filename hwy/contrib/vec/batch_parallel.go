@@ -0,0 +1,61 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package vec
+
+import "github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+
+// Parallel tuning parameters for the query-vs-many batch kernels.
+const (
+	// MinParallelBatchOps is the minimum count*dims before the parallel batch
+	// kernels split the data vectors across workers.
+	MinParallelBatchOps = 1 << 16
+
+	// BatchRowChunk is the number of data vectors handed to a worker at a
+	// time via ParallelForAtomicBatched. It is a multiple of the 4-row
+	// block of the blocked kernels.
+	BatchRowChunk = 64
+)
+
+// ParallelBatchL2SquaredDistance computes the squared L2 distances from
+// query to count data vectors of dims components, like
+// BatchL2SquaredDistance, splitting the data vectors across pool.
+//
+// Each worker runs BatchL2SquaredDistanceBlocked over chunks of
+// BatchRowChunk vectors, which scores four vectors per query load. Falls
+// back to a single sequential blocked call when pool is nil or count*dims is
+// below MinParallelBatchOps.
+func ParallelBatchL2SquaredDistance[T float32 | float64](pool workerpool.Executor, query, data, distances []T, count, dims int) {
+	parallelBatch(pool, query, data, distances, count, dims, BatchL2SquaredDistanceBlocked[T])
+}
+
+// ParallelBatchDot computes the dot products of query with count data
+// vectors of dims components, like BatchDot, splitting the data vectors
+// across pool (see ParallelBatchL2SquaredDistance).
+func ParallelBatchDot[T float32 | float64](pool workerpool.Executor, query, data, dots []T, count, dims int) {
+	parallelBatch(pool, query, data, dots, count, dims, BatchDotBlocked[T])
+}
+
+func parallelBatch[T float32 | float64](pool workerpool.Executor, query, data, out []T, count, dims int, kernel func(query, data, out []T, count, dims int)) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	if pool == nil || count*dims < MinParallelBatchOps {
+		kernel(query, data, out, count, dims)
+		return
+	}
+	pool.ParallelForAtomicBatched(count, BatchRowChunk, func(start, end int) {
+		kernel(query, data[start*dims:end*dims], out[start:end], end-start, dims)
+	})
+}
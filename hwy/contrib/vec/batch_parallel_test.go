@@ -0,0 +1,110 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package vec
+
+import (
+	"fmt"
+	"math"
+	"math/rand"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+func TestBatchBlockedMatchesBatch(t *testing.T) {
+	rng := rand.New(rand.NewSource(1))
+	pool := workerpool.New(4)
+	defer pool.Close()
+	for _, dims := range []int{1, 3, 8, 17, 64, 100, 768} {
+		for _, count := range []int{1, 3, 4, 5, 63, 64, 65, 1000} {
+			query := make([]float32, dims)
+			data := make([]float32, count*dims)
+			for i := range query {
+				query[i] = rng.Float32()*2 - 1
+			}
+			for i := range data {
+				data[i] = rng.Float32()*2 - 1
+			}
+			wantDist := make([]float32, count)
+			wantDot := make([]float32, count)
+			BatchL2SquaredDistanceFloat32(query, data, wantDist, count, dims)
+			BatchDotFloat32(query, data, wantDot, count, dims)
+
+			for _, p := range []workerpool.Executor{nil, pool} {
+				dist := make([]float32, count)
+				dots := make([]float32, count)
+				ParallelBatchL2SquaredDistance(p, query, data, dist, count, dims)
+				ParallelBatchDot(p, query, data, dots, count, dims)
+				for i := range count {
+					if math.Abs(float64(dist[i]-wantDist[i])) > 1e-5*float64(dims) {
+						t.Fatalf("dims=%d count=%d pool=%v: distance[%d] = %v, want %v", dims, count, p != nil, i, dist[i], wantDist[i])
+					}
+					if math.Abs(float64(dots[i]-wantDot[i])) > 1e-5*float64(dims) {
+						t.Fatalf("dims=%d count=%d pool=%v: dot[%d] = %v, want %v", dims, count, p != nil, i, dots[i], wantDot[i])
+					}
+				}
+			}
+		}
+	}
+}
+
+func TestBatchBlockedFloat64(t *testing.T) {
+	query := []float64{1, 2, 3}
+	data := []float64{4, 5, 6, 1, 2, 3, 0, 0, 0, 1, 1, 1, 2, 2, 2}
+	dist := make([]float64, 5)
+	dots := make([]float64, 5)
+	BatchL2SquaredDistanceBlocked(query, data, dist, 5, 3)
+	BatchDotBlocked(query, data, dots, 5, 3)
+	wantDist := []float64{27, 0, 14, 5, 2}
+	wantDot := []float64{32, 14, 0, 6, 12}
+	for i := range 5 {
+		if dist[i] != wantDist[i] || dots[i] != wantDot[i] {
+			t.Errorf("vector %d: distance %v dot %v, want %v and %v", i, dist[i], dots[i], wantDist[i], wantDot[i])
+		}
+	}
+}
+
+func BenchmarkBatchBlocked(b *testing.B) {
+	const count = 1 << 14
+	rng := rand.New(rand.NewSource(1))
+	pool := workerpool.New(0)
+	defer pool.Close()
+	for _, dims := range []int{128, 768} {
+		query := make([]float32, dims)
+		data := make([]float32, count*dims)
+		for i := range data {
+			data[i] = rng.Float32()
+		}
+		dist := make([]float32, count)
+		b.Run(fmt.Sprintf("Batch/%d", dims), func(b *testing.B) {
+			b.SetBytes(int64(count * dims * 4))
+			for i := 0; i < b.N; i++ {
+				BatchL2SquaredDistanceFloat32(query, data, dist, count, dims)
+			}
+		})
+		b.Run(fmt.Sprintf("Blocked/%d", dims), func(b *testing.B) {
+			b.SetBytes(int64(count * dims * 4))
+			for i := 0; i < b.N; i++ {
+				BatchL2SquaredDistanceBlockedFloat32(query, data, dist, count, dims)
+			}
+		})
+		b.Run(fmt.Sprintf("Parallel/%d", dims), func(b *testing.B) {
+			b.SetBytes(int64(count * dims * 4))
+			for i := 0; i < b.N; i++ {
+				ParallelBatchL2SquaredDistance(pool, query, data, dist, count, dims)
+			}
+		})
+	}
+}
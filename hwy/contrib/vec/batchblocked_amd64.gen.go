@@ -0,0 +1,105 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package vec
+
+import (
+	"simd/archsimd"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var BatchDotBlockedFloat32 func(query []float32, data []float32, dots []float32, count int, dims int)
+var BatchDotBlockedFloat64 func(query []float64, data []float64, dots []float64, count int, dims int)
+var BatchL2SquaredDistanceBlockedFloat32 func(query []float32, data []float32, distances []float32, count int, dims int)
+var BatchL2SquaredDistanceBlockedFloat64 func(query []float64, data []float64, distances []float64, count int, dims int)
+
+// BatchDotBlocked computes the same dot products as BaseBatchDot,
+// scoring blockedRows data vectors per query load (see
+// BaseBatchL2SquaredDistanceBlocked).
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:gen T={float32, float64}
+func BatchDotBlocked[T float32 | float64](query []T, data []T, dots []T, count int, dims int) {
+	switch any(query).(type) {
+	case []float32:
+		BatchDotBlockedFloat32(any(query).([]float32), any(data).([]float32), any(dots).([]float32), count, dims)
+	case []float64:
+		BatchDotBlockedFloat64(any(query).([]float64), any(data).([]float64), any(dots).([]float64), count, dims)
+	}
+}
+
+// BatchL2SquaredDistanceBlocked computes the same distances as
+// BaseBatchL2SquaredDistance, scoring blockedRows data vectors at a time.
+//
+// Every query vector loaded from L1 is reused for four data rows, and the
+// four independent accumulators hide the FMA latency that a single
+// per-row accumulator chain exposes. Rows left over after the last full
+// block are scored one at a time.
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:gen T={float32, float64}
+func BatchL2SquaredDistanceBlocked[T float32 | float64](query []T, data []T, distances []T, count int, dims int) {
+	switch any(query).(type) {
+	case []float32:
+		BatchL2SquaredDistanceBlockedFloat32(any(query).([]float32), any(data).([]float32), any(distances).([]float32), count, dims)
+	case []float64:
+		BatchL2SquaredDistanceBlockedFloat64(any(query).([]float64), any(data).([]float64), any(distances).([]float64), count, dims)
+	}
+}
+
+func init() {
+	initBatchblockedAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "BatchDotBlocked", Vars: []any{&BatchDotBlockedFloat32, &BatchDotBlockedFloat64}},
+			{Name: "BatchL2SquaredDistanceBlocked", Vars: []any{&BatchL2SquaredDistanceBlockedFloat32, &BatchL2SquaredDistanceBlockedFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initBatchblockedAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initBatchblockedAVX2},
+			{Name: "fallback", Supported: true, Init: initBatchblockedFallback},
+		},
+	})
+}
+
+func initBatchblockedAll() {
+	if hwy.NoSimdEnv() {
+		initBatchblockedFallback()
+		return
+	}
+	if archsimd.X86.AVX512() {
+		initBatchblockedAVX512()
+		return
+	}
+	if archsimd.X86.AVX2() {
+		initBatchblockedAVX2()
+		return
+	}
+	initBatchblockedFallback()
+}
+
+func initBatchblockedAVX2() {
+	BatchDotBlockedFloat32 = BaseBatchDotBlocked_avx2
+	BatchDotBlockedFloat64 = BaseBatchDotBlocked_avx2_Float64
+	BatchL2SquaredDistanceBlockedFloat32 = BaseBatchL2SquaredDistanceBlocked_avx2
+	BatchL2SquaredDistanceBlockedFloat64 = BaseBatchL2SquaredDistanceBlocked_avx2_Float64
+}
+
+func initBatchblockedAVX512() {
+	BatchDotBlockedFloat32 = BaseBatchDotBlocked_avx512
+	BatchDotBlockedFloat64 = BaseBatchDotBlocked_avx512_Float64
+	BatchL2SquaredDistanceBlockedFloat32 = BaseBatchL2SquaredDistanceBlocked_avx512
+	BatchL2SquaredDistanceBlockedFloat64 = BaseBatchL2SquaredDistanceBlocked_avx512_Float64
+}
+
+func initBatchblockedFallback() {
+	BatchDotBlockedFloat32 = BaseBatchDotBlocked_fallback
+	BatchDotBlockedFloat64 = BaseBatchDotBlocked_fallback_Float64
+	BatchL2SquaredDistanceBlockedFloat32 = BaseBatchL2SquaredDistanceBlocked_fallback
+	BatchL2SquaredDistanceBlockedFloat64 = BaseBatchL2SquaredDistanceBlocked_fallback_Float64
+}
@@ -0,0 +1,88 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var BatchDotBlockedFloat32 func(query []float32, data []float32, dots []float32, count int, dims int)
+var BatchDotBlockedFloat64 func(query []float64, data []float64, dots []float64, count int, dims int)
+var BatchL2SquaredDistanceBlockedFloat32 func(query []float32, data []float32, distances []float32, count int, dims int)
+var BatchL2SquaredDistanceBlockedFloat64 func(query []float64, data []float64, distances []float64, count int, dims int)
+
+// BatchDotBlocked computes the same dot products as BaseBatchDot,
+// scoring blockedRows data vectors per query load (see
+// BaseBatchL2SquaredDistanceBlocked).
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:gen T={float32, float64}
+func BatchDotBlocked[T float32 | float64](query []T, data []T, dots []T, count int, dims int) {
+	switch any(query).(type) {
+	case []float32:
+		BatchDotBlockedFloat32(any(query).([]float32), any(data).([]float32), any(dots).([]float32), count, dims)
+	case []float64:
+		BatchDotBlockedFloat64(any(query).([]float64), any(data).([]float64), any(dots).([]float64), count, dims)
+	}
+}
+
+// BatchL2SquaredDistanceBlocked computes the same distances as
+// BaseBatchL2SquaredDistance, scoring blockedRows data vectors at a time.
+//
+// Every query vector loaded from L1 is reused for four data rows, and the
+// four independent accumulators hide the FMA latency that a single
+// per-row accumulator chain exposes. Rows left over after the last full
+// block are scored one at a time.
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:gen T={float32, float64}
+func BatchL2SquaredDistanceBlocked[T float32 | float64](query []T, data []T, distances []T, count int, dims int) {
+	switch any(query).(type) {
+	case []float32:
+		BatchL2SquaredDistanceBlockedFloat32(any(query).([]float32), any(data).([]float32), any(distances).([]float32), count, dims)
+	case []float64:
+		BatchL2SquaredDistanceBlockedFloat64(any(query).([]float64), any(data).([]float64), any(distances).([]float64), count, dims)
+	}
+}
+
+func init() {
+	initBatchblockedAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "BatchDotBlocked", Vars: []any{&BatchDotBlockedFloat32, &BatchDotBlockedFloat64}},
+			{Name: "BatchL2SquaredDistanceBlocked", Vars: []any{&BatchL2SquaredDistanceBlockedFloat32, &BatchL2SquaredDistanceBlockedFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initBatchblockedNEON},
+			{Name: "fallback", Supported: true, Init: initBatchblockedFallback},
+		},
+	})
+}
+
+func initBatchblockedAll() {
+	if hwy.NoSimdEnv() {
+		initBatchblockedFallback()
+		return
+	}
+	initBatchblockedNEON()
+	return
+}
+
+func initBatchblockedNEON() {
+	BatchDotBlockedFloat32 = BaseBatchDotBlocked_neon
+	BatchDotBlockedFloat64 = BaseBatchDotBlocked_neon_Float64
+	BatchL2SquaredDistanceBlockedFloat32 = BaseBatchL2SquaredDistanceBlocked_neon
+	BatchL2SquaredDistanceBlockedFloat64 = BaseBatchL2SquaredDistanceBlocked_neon_Float64
+}
+
+func initBatchblockedFallback() {
+	BatchDotBlockedFloat32 = BaseBatchDotBlocked_fallback
+	BatchDotBlockedFloat64 = BaseBatchDotBlocked_fallback_Float64
+	BatchL2SquaredDistanceBlockedFloat32 = BaseBatchL2SquaredDistanceBlocked_fallback
+	BatchL2SquaredDistanceBlockedFloat64 = BaseBatchL2SquaredDistanceBlocked_fallback_Float64
+}
@@ -0,0 +1,44 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("vec", "BatchDotBlocked", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := BatchDotBlockedFloat32; hwyImpl != nil {
+			BatchDotBlockedFloat32 = func(query []float32, data []float32, dots []float32, count int, dims int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, data, dots, count, dims)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(data)+hwy.SliceBytes(dots))
+			}
+		}
+		if hwyImpl := BatchDotBlockedFloat64; hwyImpl != nil {
+			BatchDotBlockedFloat64 = func(query []float64, data []float64, dots []float64, count int, dims int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, data, dots, count, dims)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(data)+hwy.SliceBytes(dots))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "BatchL2SquaredDistanceBlocked", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := BatchL2SquaredDistanceBlockedFloat32; hwyImpl != nil {
+			BatchL2SquaredDistanceBlockedFloat32 = func(query []float32, data []float32, distances []float32, count int, dims int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, data, distances, count, dims)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(data)+hwy.SliceBytes(distances))
+			}
+		}
+		if hwyImpl := BatchL2SquaredDistanceBlockedFloat64; hwyImpl != nil {
+			BatchL2SquaredDistanceBlockedFloat64 = func(query []float64, data []float64, distances []float64, count int, dims int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(query, data, distances, count, dims)
+				hwyCounter.Done(hwyStart, len(query), hwy.SliceBytes(query)+hwy.SliceBytes(data)+hwy.SliceBytes(distances))
+			}
+		}
+	})
+}
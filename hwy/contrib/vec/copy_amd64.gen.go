@@ -39,6 +39,17 @@ func Copy[T hwy.Floats](dst []T, src []T) {
 
 func init() {
 	initCopyAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Copy", Vars: []any{&CopyFloat16, &CopyBFloat16, &CopyFloat32, &CopyFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initCopyAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initCopyAVX2},
+			{Name: "fallback", Supported: true, Init: initCopyFallback},
+		},
+	})
 }
 
 func initCopyAll() {
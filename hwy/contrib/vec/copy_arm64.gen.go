@@ -37,6 +37,16 @@ func Copy[T hwy.Floats](dst []T, src []T) {
 
 func init() {
 	initCopyAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Copy", Vars: []any{&CopyFloat16, &CopyBFloat16, &CopyFloat32, &CopyFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initCopyNEONAsm},
+			{Name: "fallback", Supported: true, Init: initCopyFallback},
+		},
+	})
 }
 
 func initCopyAll() {
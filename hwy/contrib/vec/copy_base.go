@@ -14,7 +14,7 @@
 
 package vec
 
-//go:generate go run ../../../cmd/hwygen -input copy_base.go -output . -targets avx2,avx512,neon:asm,fallback -dispatch copy
+//go:generate go run ../../../cmd/hwygen -input copy_base.go -output . -targets avx2,avx512,avx2:asm,avx512:asm,neon:asm,fallback -dispatch copy
 
 import "github.com/ajroetker/go-highway/hwy"
 
@@ -0,0 +1,42 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("vec", "Copy", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := CopyFloat16; hwyImpl != nil {
+			CopyFloat16 = func(dst []hwy.Float16, src []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, src)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(src))
+			}
+		}
+		if hwyImpl := CopyBFloat16; hwyImpl != nil {
+			CopyBFloat16 = func(dst []hwy.BFloat16, src []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, src)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(src))
+			}
+		}
+		if hwyImpl := CopyFloat32; hwyImpl != nil {
+			CopyFloat32 = func(dst []float32, src []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, src)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(src))
+			}
+		}
+		if hwyImpl := CopyFloat64; hwyImpl != nil {
+			CopyFloat64 = func(dst []float64, src []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, src)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(src))
+			}
+		}
+	})
+}
@@ -33,6 +33,8 @@ var L2SquaredDistanceFloat64 func(a []float64, b []float64) float64
 //	result := L2Distance(a, b)  // sqrt((1-4)^2 + (2-5)^2 + (3-6)^2) = sqrt(27) ≈ 5.196
 //
 // This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:kernel
 func L2Distance[T hwy.Floats](a []T, b []T) T {
 	if _, ok := any(a).([]hwy.Float16); ok {
 		return any(L2DistanceFloat16(any(a).([]hwy.Float16), any(b).([]hwy.Float16))).(T)
@@ -49,6 +51,30 @@ func L2Distance[T hwy.Floats](a []T, b []T) T {
 	panic("unsupported type")
 }
 
+// L2DistanceKernel returns the L2Distance implementation selected for T on this CPU.
+// Calling the returned function skips the per-call type dispatch of L2Distance,
+// which matters when it is called many times on short inputs.
+//
+// The handle is the implementation in effect when L2DistanceKernel is called.
+// Take it after hwy.ForceDispatch or hwy.ApplyDispatchEnv, and again after
+// any later override or restore; an older handle keeps the old target.
+func L2DistanceKernel[T hwy.Floats]() func(a []T, b []T) T {
+	var zero T
+	if _, ok := any(zero).(hwy.Float16); ok {
+		return any(L2DistanceFloat16).(func(a []T, b []T) T)
+	}
+	if _, ok := any(zero).(hwy.BFloat16); ok {
+		return any(L2DistanceBFloat16).(func(a []T, b []T) T)
+	}
+	if _, ok := any(zero).(float32); ok {
+		return any(L2DistanceFloat32).(func(a []T, b []T) T)
+	}
+	if _, ok := any(zero).(float64); ok {
+		return any(L2DistanceFloat64).(func(a []T, b []T) T)
+	}
+	panic("unsupported type")
+}
+
 // L2SquaredDistance computes the squared Euclidean distance between two slices.
 // The result is the sum of squared differences: sum((a[i] - b[i])^2).
 //
@@ -65,6 +91,8 @@ func L2Distance[T hwy.Floats](a []T, b []T) T {
 //	result := L2SquaredDistance(a, b)  // (1-4)^2 + (2-5)^2 + (3-6)^2 = 9 + 9 + 9 = 27
 //
 // This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:kernel
 func L2SquaredDistance[T hwy.Floats](a []T, b []T) T {
 	if _, ok := any(a).([]hwy.Float16); ok {
 		return any(L2SquaredDistanceFloat16(any(a).([]hwy.Float16), any(b).([]hwy.Float16))).(T)
@@ -81,8 +109,43 @@ func L2SquaredDistance[T hwy.Floats](a []T, b []T) T {
 	panic("unsupported type")
 }
 
+// L2SquaredDistanceKernel returns the L2SquaredDistance implementation selected for T on this CPU.
+// Calling the returned function skips the per-call type dispatch of L2SquaredDistance,
+// which matters when it is called many times on short inputs.
+//
+// The handle is the implementation in effect when L2SquaredDistanceKernel is called.
+// Take it after hwy.ForceDispatch or hwy.ApplyDispatchEnv, and again after
+// any later override or restore; an older handle keeps the old target.
+func L2SquaredDistanceKernel[T hwy.Floats]() func(a []T, b []T) T {
+	var zero T
+	if _, ok := any(zero).(hwy.Float16); ok {
+		return any(L2SquaredDistanceFloat16).(func(a []T, b []T) T)
+	}
+	if _, ok := any(zero).(hwy.BFloat16); ok {
+		return any(L2SquaredDistanceBFloat16).(func(a []T, b []T) T)
+	}
+	if _, ok := any(zero).(float32); ok {
+		return any(L2SquaredDistanceFloat32).(func(a []T, b []T) T)
+	}
+	if _, ok := any(zero).(float64); ok {
+		return any(L2SquaredDistanceFloat64).(func(a []T, b []T) T)
+	}
+	panic("unsupported type")
+}
+
 func init() {
 	initDistanceAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "L2Distance", Vars: []any{&L2DistanceFloat16, &L2DistanceBFloat16, &L2DistanceFloat32, &L2DistanceFloat64}},
+			{Name: "L2SquaredDistance", Vars: []any{&L2SquaredDistanceFloat16, &L2SquaredDistanceBFloat16, &L2SquaredDistanceFloat32, &L2SquaredDistanceFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initDistanceNEONAsm},
+			{Name: "fallback", Supported: true, Init: initDistanceFallback},
+		},
+	})
 }
 
 func initDistanceAll() {
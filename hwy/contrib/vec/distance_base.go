@@ -14,7 +14,7 @@
 
 package vec
 
-//go:generate go run ../../../cmd/hwygen -input distance_base.go -output . -targets avx2,avx512,neon:asm,fallback -dispatch distance
+//go:generate go run ../../../cmd/hwygen -input distance_base.go -output . -targets avx2,avx512,avx2:asm,avx512:asm,neon:asm,fallback -dispatch distance
 
 import (
 	"math"
@@ -36,6 +36,9 @@ import (
 //	a := []float32{1, 2, 3}
 //	b := []float32{4, 5, 6}
 //	result := L2SquaredDistance(a, b)  // (1-4)^2 + (2-5)^2 + (3-6)^2 = 9 + 9 + 9 = 27
+//
+//hwy:kernel
+//hwy:maskedtail
 func BaseL2SquaredDistance[T hwy.Floats](a, b []T) T {
 	if len(a) == 0 || len(b) == 0 {
 		return 0
@@ -73,12 +76,12 @@ func BaseL2SquaredDistance[T hwy.Floats](a, b []T) T {
 	}
 
 	// Process remaining full vectors (1 at a time)
-	for i+lanes <= n {
+	//hwy:unroll 1
+	for ; i+lanes <= n; i += lanes {
 		va := hwy.Load(a[i:])
 		vb := hwy.Load(b[i:])
 		diff := hwy.Sub(va, vb)
 		sum0 = hwy.MulAdd(diff, diff, sum0)
-		i += lanes
 	}
 
 	// Combine accumulators and reduce to scalar
@@ -110,6 +113,8 @@ func BaseL2SquaredDistance[T hwy.Floats](a, b []T) T {
 //	a := []float32{1, 2, 3}
 //	b := []float32{4, 5, 6}
 //	result := L2Distance(a, b)  // sqrt((1-4)^2 + (2-5)^2 + (3-6)^2) = sqrt(27) ≈ 5.196
+//
+//hwy:kernel
 func BaseL2Distance[T hwy.Floats](a, b []T) T {
 	sqDist := BaseL2SquaredDistance(a, b)
 	return T(math.Sqrt(float64(sqDist)))
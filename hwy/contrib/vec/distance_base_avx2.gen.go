@@ -57,12 +57,11 @@ func BaseL2SquaredDistance_avx2_Float16(a []hwy.Float16, b []hwy.Float16) hwy.Fl
 		sum2 = diff2.MulAdd(diff2, sum2)
 		sum3 = diff3.MulAdd(diff3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&a[i]))
 		vb := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&b[i]))
 		diff := va.Sub(vb)
 		sum0 = diff.MulAdd(diff, sum0)
-		i += lanes
 	}
 	sum0 = sum0.Add(sum1)
 	sum2 = sum2.Add(sum3)
@@ -99,12 +98,11 @@ func BaseL2SquaredDistance_avx2_BFloat16(a []hwy.BFloat16, b []hwy.BFloat16) hwy
 		sum2 = diff2.MulAdd(diff2, sum2)
 		sum3 = diff3.MulAdd(diff3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&a[i]))
 		vb := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&b[i]))
 		diff := va.Sub(vb)
 		sum0 = diff.MulAdd(diff, sum0)
-		i += lanes
 	}
 	sum0 = sum0.Add(sum1)
 	sum2 = sum2.Add(sum3)
@@ -141,21 +139,23 @@ func BaseL2SquaredDistance_avx2(a []float32, b []float32) float32 {
 		sum2 = diff2.MulAdd(diff2, sum2)
 		sum3 = diff3.MulAdd(diff3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&a[i])))
 		vb := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&b[i])))
 		diff := va.Sub(vb)
 		sum0 = diff.MulAdd(diff, sum0)
-		i += lanes
+	}
+	if i < n {
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(n - i)
+		va := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, a[i:])
+		vb := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, b[i:])
+		diff := va.Sub(vb)
+		sum0 = diff.MulAdd(diff, sum0).Merge(sum0, hwyTailMask)
 	}
 	sum0 = sum0.Add(sum1)
 	sum2 = sum2.Add(sum3)
 	sum0 = sum0.Add(sum2)
 	result := hwy.ReduceSum_AVX2_F32x8(sum0)
-	for ; i < n; i++ {
-		d := a[i] - b[i]
-		result += d * d
-	}
 	return result
 }
 
@@ -183,20 +183,22 @@ func BaseL2SquaredDistance_avx2_Float64(a []float64, b []float64) float64 {
 		sum2 = diff2.MulAdd(diff2, sum2)
 		sum3 = diff3.MulAdd(diff3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&a[i])))
 		vb := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&b[i])))
 		diff := va.Sub(vb)
 		sum0 = diff.MulAdd(diff, sum0)
-		i += lanes
+	}
+	if i < n {
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(n - i)
+		va := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, a[i:])
+		vb := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, b[i:])
+		diff := va.Sub(vb)
+		sum0 = diff.MulAdd(diff, sum0).Merge(sum0, hwyTailMask)
 	}
 	sum0 = sum0.Add(sum1)
 	sum2 = sum2.Add(sum3)
 	sum0 = sum0.Add(sum2)
 	result := hwy.ReduceSum_AVX2_F64x4(sum0)
-	for ; i < n; i++ {
-		d := a[i] - b[i]
-		result += d * d
-	}
 	return result
 }
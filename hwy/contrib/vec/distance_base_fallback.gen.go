@@ -52,12 +52,11 @@ func BaseL2SquaredDistance_fallback_Float16(a []hwy.Float16, b []hwy.Float16) hw
 		sum2 = hwy.MulAdd(diff2, diff2, sum2)
 		sum3 = hwy.MulAdd(diff3, diff3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := hwy.Load(a[i:])
 		vb := hwy.Load(b[i:])
 		diff := hwy.Sub(va, vb)
 		sum0 = hwy.MulAdd(diff, diff, sum0)
-		i += lanes
 	}
 	sum0 = hwy.Add(sum0, sum1)
 	sum2 = hwy.Add(sum2, sum3)
@@ -94,12 +93,11 @@ func BaseL2SquaredDistance_fallback_BFloat16(a []hwy.BFloat16, b []hwy.BFloat16)
 		sum2 = hwy.MulAdd(diff2, diff2, sum2)
 		sum3 = hwy.MulAdd(diff3, diff3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := hwy.Load(a[i:])
 		vb := hwy.Load(b[i:])
 		diff := hwy.Sub(va, vb)
 		sum0 = hwy.MulAdd(diff, diff, sum0)
-		i += lanes
 	}
 	sum0 = hwy.Add(sum0, sum1)
 	sum2 = hwy.Add(sum2, sum3)
@@ -136,12 +134,11 @@ func BaseL2SquaredDistance_fallback(a []float32, b []float32) float32 {
 		sum2 = hwy.MulAdd(diff2, diff2, sum2)
 		sum3 = hwy.MulAdd(diff3, diff3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := hwy.Load(a[i:])
 		vb := hwy.Load(b[i:])
 		diff := hwy.Sub(va, vb)
 		sum0 = hwy.MulAdd(diff, diff, sum0)
-		i += lanes
 	}
 	sum0 = hwy.Add(sum0, sum1)
 	sum2 = hwy.Add(sum2, sum3)
@@ -178,12 +175,11 @@ func BaseL2SquaredDistance_fallback_Float64(a []float64, b []float64) float64 {
 		sum2 = hwy.MulAdd(diff2, diff2, sum2)
 		sum3 = hwy.MulAdd(diff3, diff3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := hwy.Load(a[i:])
 		vb := hwy.Load(b[i:])
 		diff := hwy.Sub(va, vb)
 		sum0 = hwy.MulAdd(diff, diff, sum0)
-		i += lanes
 	}
 	sum0 = hwy.Add(sum0, sum1)
 	sum2 = hwy.Add(sum2, sum3)
@@ -0,0 +1,80 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("vec", "L2Distance", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := L2DistanceFloat16; hwyImpl != nil {
+			L2DistanceFloat16 = func(a []hwy.Float16, b []hwy.Float16) hwy.Float16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+		if hwyImpl := L2DistanceBFloat16; hwyImpl != nil {
+			L2DistanceBFloat16 = func(a []hwy.BFloat16, b []hwy.BFloat16) hwy.BFloat16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+		if hwyImpl := L2DistanceFloat32; hwyImpl != nil {
+			L2DistanceFloat32 = func(a []float32, b []float32) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+		if hwyImpl := L2DistanceFloat64; hwyImpl != nil {
+			L2DistanceFloat64 = func(a []float64, b []float64) float64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "L2SquaredDistance", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := L2SquaredDistanceFloat16; hwyImpl != nil {
+			L2SquaredDistanceFloat16 = func(a []hwy.Float16, b []hwy.Float16) hwy.Float16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+		if hwyImpl := L2SquaredDistanceBFloat16; hwyImpl != nil {
+			L2SquaredDistanceBFloat16 = func(a []hwy.BFloat16, b []hwy.BFloat16) hwy.BFloat16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+		if hwyImpl := L2SquaredDistanceFloat32; hwyImpl != nil {
+			L2SquaredDistanceFloat32 = func(a []float32, b []float32) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+		if hwyImpl := L2SquaredDistanceFloat64; hwyImpl != nil {
+			L2SquaredDistanceFloat64 = func(a []float64, b []float64) float64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+	})
+}
@@ -31,6 +31,8 @@ var DotFloat64 func(a []float64, b []float64) float64
 //	result := Dot(a, b)  // 1*4 + 2*5 + 3*6 = 32
 //
 // This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:kernel
 func Dot[T hwy.Floats](a []T, b []T) T {
 	if _, ok := any(a).([]hwy.Float16); ok {
 		return any(DotFloat16(any(a).([]hwy.Float16), any(b).([]hwy.Float16))).(T)
@@ -47,8 +49,43 @@ func Dot[T hwy.Floats](a []T, b []T) T {
 	panic("unsupported type")
 }
 
+// DotKernel returns the Dot implementation selected for T on this CPU.
+// Calling the returned function skips the per-call type dispatch of Dot,
+// which matters when it is called many times on short inputs.
+//
+// The handle is the implementation in effect when DotKernel is called.
+// Take it after hwy.ForceDispatch or hwy.ApplyDispatchEnv, and again after
+// any later override or restore; an older handle keeps the old target.
+func DotKernel[T hwy.Floats]() func(a []T, b []T) T {
+	var zero T
+	if _, ok := any(zero).(hwy.Float16); ok {
+		return any(DotFloat16).(func(a []T, b []T) T)
+	}
+	if _, ok := any(zero).(hwy.BFloat16); ok {
+		return any(DotBFloat16).(func(a []T, b []T) T)
+	}
+	if _, ok := any(zero).(float32); ok {
+		return any(DotFloat32).(func(a []T, b []T) T)
+	}
+	if _, ok := any(zero).(float64); ok {
+		return any(DotFloat64).(func(a []T, b []T) T)
+	}
+	panic("unsupported type")
+}
+
 func init() {
 	initDotAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Dot", Vars: []any{&DotFloat16, &DotBFloat16, &DotFloat32, &DotFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initDotAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initDotAVX2},
+			{Name: "fallback", Supported: true, Init: initDotFallback},
+		},
+	})
 }
 
 func initDotAll() {
@@ -14,7 +14,7 @@
 
 package vec
 
-//go:generate go run ../../../cmd/hwygen -input dot_base.go -output . -targets avx2,avx512,neon:asm,fallback -dispatch dot
+//go:generate go run ../../../cmd/hwygen -input dot_base.go -output . -targets avx2,avx512,avx2:asm,avx512:asm,neon:asm,fallback -dispatch dot
 
 import "github.com/ajroetker/go-highway/hwy"
 
@@ -32,6 +32,9 @@ import "github.com/ajroetker/go-highway/hwy"
 //	a := []float32{1, 2, 3}
 //	b := []float32{4, 5, 6}
 //	result := Dot(a, b)  // 1*4 + 2*5 + 3*6 = 32
+//
+//hwy:kernel
+//hwy:maskedtail
 func BaseDot[T hwy.Floats](a, b []T) T {
 	if len(a) == 0 || len(b) == 0 {
 		return 0
@@ -63,11 +66,11 @@ func BaseDot[T hwy.Floats](a, b []T) T {
 	}
 
 	// Process remaining full vectors (1 at a time)
-	for i+lanes <= n {
+	//hwy:unroll 1
+	for ; i+lanes <= n; i += lanes {
 		va := hwy.Load(a[i:])
 		vb := hwy.Load(b[i:])
 		sum0 = hwy.MulAdd(va, vb, sum0)
-		i += lanes
 	}
 
 	// Combine accumulators and reduce to scalar
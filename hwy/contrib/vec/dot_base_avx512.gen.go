@@ -32,11 +32,10 @@ func BaseDot_avx512_Float16(a []hwy.Float16, b []hwy.Float16) hwy.Float16 {
 		sum2 = va2.MulAdd(vb2, sum2)
 		sum3 = va3.MulAdd(vb3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := asm.LoadFloat16x16AVX512Ptr(unsafe.Pointer(&a[i]))
 		vb := asm.LoadFloat16x16AVX512Ptr(unsafe.Pointer(&b[i]))
 		sum0 = va.MulAdd(vb, sum0)
-		i += lanes
 	}
 	sum0 = sum0.Add(sum1)
 	sum2 = sum2.Add(sum3)
@@ -68,11 +67,10 @@ func BaseDot_avx512_BFloat16(a []hwy.BFloat16, b []hwy.BFloat16) hwy.BFloat16 {
 		sum2 = va2.MulAdd(vb2, sum2)
 		sum3 = va3.MulAdd(vb3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := asm.LoadBFloat16x16AVX512Ptr(unsafe.Pointer(&a[i]))
 		vb := asm.LoadBFloat16x16AVX512Ptr(unsafe.Pointer(&b[i]))
 		sum0 = va.MulAdd(vb, sum0)
-		i += lanes
 	}
 	sum0 = sum0.Add(sum1)
 	sum2 = sum2.Add(sum3)
@@ -104,19 +102,21 @@ func BaseDot_avx512(a []float32, b []float32) float32 {
 		sum2 = va2.MulAdd(vb2, sum2)
 		sum3 = va3.MulAdd(vb3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&a[i])))
 		vb := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&b[i])))
 		sum0 = va.MulAdd(vb, sum0)
-		i += lanes
+	}
+	if i < n {
+		hwyTailMask := hwy.FirstN_AVX512_F32x16(n - i)
+		va := hwy.MaskLoad_AVX512_F32x16(hwyTailMask, a[i:])
+		vb := hwy.MaskLoad_AVX512_F32x16(hwyTailMask, b[i:])
+		sum0 = va.MulAdd(vb, sum0).Merge(sum0, hwyTailMask)
 	}
 	sum0 = sum0.Add(sum1)
 	sum2 = sum2.Add(sum3)
 	sum0 = sum0.Add(sum2)
 	result := hwy.ReduceSum_AVX512_F32x16(sum0)
-	for ; i < n; i++ {
-		result += a[i] * b[i]
-	}
 	return result
 }
 
@@ -140,18 +140,20 @@ func BaseDot_avx512_Float64(a []float64, b []float64) float64 {
 		sum2 = va2.MulAdd(vb2, sum2)
 		sum3 = va3.MulAdd(vb3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&a[i])))
 		vb := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&b[i])))
 		sum0 = va.MulAdd(vb, sum0)
-		i += lanes
+	}
+	if i < n {
+		hwyTailMask := hwy.FirstN_AVX512_F64x8(n - i)
+		va := hwy.MaskLoad_AVX512_F64x8(hwyTailMask, a[i:])
+		vb := hwy.MaskLoad_AVX512_F64x8(hwyTailMask, b[i:])
+		sum0 = va.MulAdd(vb, sum0).Merge(sum0, hwyTailMask)
 	}
 	sum0 = sum0.Add(sum1)
 	sum2 = sum2.Add(sum3)
 	sum0 = sum0.Add(sum2)
 	result := hwy.ReduceSum_AVX512_F64x8(sum0)
-	for ; i < n; i++ {
-		result += a[i] * b[i]
-	}
 	return result
 }
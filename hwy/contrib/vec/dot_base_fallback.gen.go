@@ -26,11 +26,10 @@ func BaseDot_fallback_Float16(a []hwy.Float16, b []hwy.Float16) hwy.Float16 {
 		sum2 = hwy.MulAdd(va2, vb2, sum2)
 		sum3 = hwy.MulAdd(va3, vb3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := hwy.Load(a[i:])
 		vb := hwy.Load(b[i:])
 		sum0 = hwy.MulAdd(va, vb, sum0)
-		i += lanes
 	}
 	sum0 = hwy.Add(sum0, sum1)
 	sum2 = hwy.Add(sum2, sum3)
@@ -62,11 +61,10 @@ func BaseDot_fallback_BFloat16(a []hwy.BFloat16, b []hwy.BFloat16) hwy.BFloat16
 		sum2 = hwy.MulAdd(va2, vb2, sum2)
 		sum3 = hwy.MulAdd(va3, vb3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := hwy.Load(a[i:])
 		vb := hwy.Load(b[i:])
 		sum0 = hwy.MulAdd(va, vb, sum0)
-		i += lanes
 	}
 	sum0 = hwy.Add(sum0, sum1)
 	sum2 = hwy.Add(sum2, sum3)
@@ -98,11 +96,10 @@ func BaseDot_fallback(a []float32, b []float32) float32 {
 		sum2 = hwy.MulAdd(va2, vb2, sum2)
 		sum3 = hwy.MulAdd(va3, vb3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := hwy.Load(a[i:])
 		vb := hwy.Load(b[i:])
 		sum0 = hwy.MulAdd(va, vb, sum0)
-		i += lanes
 	}
 	sum0 = hwy.Add(sum0, sum1)
 	sum2 = hwy.Add(sum2, sum3)
@@ -134,11 +131,10 @@ func BaseDot_fallback_Float64(a []float64, b []float64) float64 {
 		sum2 = hwy.MulAdd(va2, vb2, sum2)
 		sum3 = hwy.MulAdd(va3, vb3, sum3)
 	}
-	for i+lanes <= n {
+	for ; i+lanes <= n; i += lanes {
 		va := hwy.Load(a[i:])
 		vb := hwy.Load(b[i:])
 		sum0 = hwy.MulAdd(va, vb, sum0)
-		i += lanes
 	}
 	sum0 = hwy.Add(sum0, sum1)
 	sum2 = hwy.Add(sum2, sum3)
@@ -0,0 +1,46 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("vec", "Dot", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DotFloat16; hwyImpl != nil {
+			DotFloat16 = func(a []hwy.Float16, b []hwy.Float16) hwy.Float16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+		if hwyImpl := DotBFloat16; hwyImpl != nil {
+			DotBFloat16 = func(a []hwy.BFloat16, b []hwy.BFloat16) hwy.BFloat16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+		if hwyImpl := DotFloat32; hwyImpl != nil {
+			DotFloat32 = func(a []float32, b []float32) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+		if hwyImpl := DotFloat64; hwyImpl != nil {
+			DotFloat64 = func(a []float64, b []float64) float64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+	})
+}
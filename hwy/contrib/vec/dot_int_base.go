@@ -52,3 +52,27 @@ func BaseDotInt[T int8 | uint8](a, b []T) int32 {
 	}
 	return result
 }
+
+// BaseDotIntScalar is the fallback of BaseDotInt. The emulated DotProduct
+// builds a vector value per group of lanes; a plain loop over four
+// independent accumulators stays in registers instead.
+//
+//hwy:gen T={int8, uint8}
+//hwy:specializes DotInt
+//hwy:targets fallback
+func BaseDotIntScalar[T int8 | uint8](a, b []T) int32 {
+	n := min(len(a), len(b))
+	a, b = a[:n], b[:n]
+	var s0, s1, s2, s3 int32
+	i := 0
+	for ; i+4 <= n; i += 4 {
+		s0 += int32(a[i]) * int32(b[i])
+		s1 += int32(a[i+1]) * int32(b[i+1])
+		s2 += int32(a[i+2]) * int32(b[i+2])
+		s3 += int32(a[i+3]) * int32(b[i+3])
+	}
+	for ; i < n; i++ {
+		s0 += int32(a[i]) * int32(b[i])
+	}
+	return s0 + s1 + s2 + s3
+}
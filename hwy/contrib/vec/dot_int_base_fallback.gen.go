@@ -2,40 +2,36 @@
 
 package vec
 
-import (
-	"github.com/ajroetker/go-highway/hwy"
-)
-
 func BaseDotInt_fallback_Int8(a []int8, b []int8) int32 {
 	n := min(len(a), len(b))
-	lanes := hwy.NumLanes[int8]()
-	acc := hwy.Zero[int32]()
-	var i int
-	for i = 0; i+lanes <= n; i += lanes {
-		va := hwy.Load(a[i:])
-		vb := hwy.Load(b[i:])
-		acc = hwy.Add(acc, hwy.DotProduct(va, vb))
+	a, b = a[:n], b[:n]
+	var s0, s1, s2, s3 int32
+	i := 0
+	for ; i+4 <= n; i += 4 {
+		s0 += int32(a[i]) * int32(b[i])
+		s1 += int32(a[i+1]) * int32(b[i+1])
+		s2 += int32(a[i+2]) * int32(b[i+2])
+		s3 += int32(a[i+3]) * int32(b[i+3])
 	}
-	result := hwy.ReduceSum(acc)
 	for ; i < n; i++ {
-		result += int32(a[i]) * int32(b[i])
+		s0 += int32(a[i]) * int32(b[i])
 	}
-	return result
+	return s0 + s1 + s2 + s3
 }
 
 func BaseDotInt_fallback_Uint8(a []uint8, b []uint8) int32 {
 	n := min(len(a), len(b))
-	lanes := hwy.NumLanes[uint8]()
-	acc := hwy.Zero[int32]()
-	var i int
-	for i = 0; i+lanes <= n; i += lanes {
-		va := hwy.Load(a[i:])
-		vb := hwy.Load(b[i:])
-		acc = hwy.Add(acc, hwy.DotProduct(va, vb))
+	a, b = a[:n], b[:n]
+	var s0, s1, s2, s3 int32
+	i := 0
+	for ; i+4 <= n; i += 4 {
+		s0 += int32(a[i]) * int32(b[i])
+		s1 += int32(a[i+1]) * int32(b[i+1])
+		s2 += int32(a[i+2]) * int32(b[i+2])
+		s3 += int32(a[i+3]) * int32(b[i+3])
 	}
-	result := hwy.ReduceSum(acc)
 	for ; i < n; i++ {
-		result += int32(a[i]) * int32(b[i])
+		s0 += int32(a[i]) * int32(b[i])
 	}
-	return result
+	return s0 + s1 + s2 + s3
 }
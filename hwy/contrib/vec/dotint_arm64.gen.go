@@ -40,6 +40,16 @@ func DotInt[T int8 | uint8](a []T, b []T) int32 {
 
 func init() {
 	initDotintAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DotInt", Vars: []any{&DotIntInt8, &DotIntUint8}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initDotintNEONAsm},
+			{Name: "fallback", Supported: true, Init: initDotintFallback},
+		},
+	})
 }
 
 func initDotintAll() {
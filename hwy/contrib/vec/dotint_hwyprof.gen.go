@@ -0,0 +1,30 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("vec", "DotInt", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DotIntInt8; hwyImpl != nil {
+			DotIntInt8 = func(a []int8, b []int8) int32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+		if hwyImpl := DotIntUint8; hwyImpl != nil {
+			DotIntUint8 = func(a []uint8, b []uint8) int32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(a, b)
+				hwyCounter.Done(hwyStart, len(a), hwy.SliceBytes(a)+hwy.SliceBytes(b))
+				return hwyR0
+			}
+		}
+	})
+}
@@ -4,6 +4,10 @@
 
 package vec
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var DotIntInt8 func(a []int8, b []int8) int32
 var DotIntUint8 func(a []uint8, b []uint8) int32
 
@@ -36,6 +40,15 @@ func DotInt[T int8 | uint8](a []T, b []T) int32 {
 
 func init() {
 	initDotintAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DotInt", Vars: []any{&DotIntInt8, &DotIntUint8}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initDotintFallback},
+		},
+	})
 }
 
 func initDotintAll() {
@@ -17,6 +17,20 @@ var EncodeFloat64s func(dst []byte, src []float64)
 
 func init() {
 	initEncodeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DecodeFloat32s", Vars: []any{&DecodeFloat32s}},
+			{Name: "DecodeFloat64s", Vars: []any{&DecodeFloat64s}},
+			{Name: "EncodeFloat32s", Vars: []any{&EncodeFloat32s}},
+			{Name: "EncodeFloat64s", Vars: []any{&EncodeFloat64s}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "avx512", Supported: archsimd.X86.AVX512(), Init: initEncodeAVX512},
+			{Name: "avx2", Supported: archsimd.X86.AVX2(), Init: initEncodeAVX2},
+			{Name: "fallback", Supported: true, Init: initEncodeFallback},
+		},
+	})
 }
 
 func initEncodeAll() {
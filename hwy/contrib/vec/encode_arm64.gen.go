@@ -15,6 +15,19 @@ var EncodeFloat64s func(dst []byte, src []float64)
 
 func init() {
 	initEncodeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DecodeFloat32s", Vars: []any{&DecodeFloat32s}},
+			{Name: "DecodeFloat64s", Vars: []any{&DecodeFloat64s}},
+			{Name: "EncodeFloat32s", Vars: []any{&EncodeFloat32s}},
+			{Name: "EncodeFloat64s", Vars: []any{&EncodeFloat64s}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initEncodeNEONAsm},
+			{Name: "fallback", Supported: true, Init: initEncodeFallback},
+		},
+	})
 }
 
 func initEncodeAll() {
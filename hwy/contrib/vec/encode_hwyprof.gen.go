@@ -0,0 +1,48 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("vec", "DecodeFloat32s", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DecodeFloat32s; hwyImpl != nil {
+			DecodeFloat32s = func(dst []float32, src []byte) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, src)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(src))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "DecodeFloat64s", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DecodeFloat64s; hwyImpl != nil {
+			DecodeFloat64s = func(dst []float64, src []byte) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, src)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(src))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "EncodeFloat32s", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := EncodeFloat32s; hwyImpl != nil {
+			EncodeFloat32s = func(dst []byte, src []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, src)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(src))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "EncodeFloat64s", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := EncodeFloat64s; hwyImpl != nil {
+			EncodeFloat64s = func(dst []byte, src []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, src)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(src))
+			}
+		}
+	})
+}
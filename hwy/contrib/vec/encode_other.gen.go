@@ -4,6 +4,10 @@
 
 package vec
 
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
 var DecodeFloat32s func(dst []float32, src []byte)
 var DecodeFloat64s func(dst []float64, src []byte)
 var EncodeFloat32s func(dst []byte, src []float32)
@@ -11,6 +15,18 @@ var EncodeFloat64s func(dst []byte, src []float64)
 
 func init() {
 	initEncodeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "DecodeFloat32s", Vars: []any{&DecodeFloat32s}},
+			{Name: "DecodeFloat64s", Vars: []any{&DecodeFloat64s}},
+			{Name: "EncodeFloat32s", Vars: []any{&EncodeFloat32s}},
+			{Name: "EncodeFloat64s", Vars: []any{&EncodeFloat64s}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initEncodeFallback},
+		},
+	})
 }
 
 func initEncodeAll() {
@@ -0,0 +1,190 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package vec
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		f16        = make([]hwy.Float16, allocTestLen)
+		bf16       = make([]hwy.BFloat16, allocTestLen)
+		f32        = make([]float32, allocTestLen)
+		f64        = make([]float64, allocTestLen)
+		i8         = make([]int8, allocTestLen)
+		u8         = make([]uint8, allocTestLen)
+		i32        = make([]int32, allocTestLen)
+		i64        = make([]int64, allocTestLen)
+		u32        = make([]uint32, allocTestLen)
+		u64        = make([]uint64, allocTestLen)
+		f16Scalar  = hwy.NewFloat16(1)
+		bf16Scalar = hwy.NewBFloat16(1)
+		f32Scalar  = float32(1)
+		f64Scalar  = float64(1)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseArgmax_fallback_Float16", func() { BaseArgmax_fallback_Float16(f16) }},
+		{"BaseArgmax_fallback_BFloat16", func() { BaseArgmax_fallback_BFloat16(bf16) }},
+		{"BaseArgmax_fallback", func() { BaseArgmax_fallback(f32) }},
+		{"BaseArgmax_fallback_Float64", func() { BaseArgmax_fallback_Float64(f64) }},
+		{"BaseArgmin_fallback_Float16", func() { BaseArgmin_fallback_Float16(f16) }},
+		{"BaseArgmin_fallback_BFloat16", func() { BaseArgmin_fallback_BFloat16(bf16) }},
+		{"BaseArgmin_fallback", func() { BaseArgmin_fallback(f32) }},
+		{"BaseArgmin_fallback_Float64", func() { BaseArgmin_fallback_Float64(f64) }},
+		{"BaseAdd_fallback_Float16", func() { BaseAdd_fallback_Float16(f16, f16) }},
+		{"BaseAdd_fallback_BFloat16", func() { BaseAdd_fallback_BFloat16(bf16, bf16) }},
+		{"BaseAdd_fallback", func() { BaseAdd_fallback(f32, f32) }},
+		{"BaseAdd_fallback_Float64", func() { BaseAdd_fallback_Float64(f64, f64) }},
+		{"BaseAddConst_fallback_Float16", func() { BaseAddConst_fallback_Float16(f16Scalar, f16) }},
+		{"BaseAddConst_fallback_BFloat16", func() { BaseAddConst_fallback_BFloat16(bf16Scalar, bf16) }},
+		{"BaseAddConst_fallback", func() { BaseAddConst_fallback(f32Scalar, f32) }},
+		{"BaseAddConst_fallback_Float64", func() { BaseAddConst_fallback_Float64(f64Scalar, f64) }},
+		{"BaseAddTo_fallback_Float16", func() { BaseAddTo_fallback_Float16(f16, f16, f16) }},
+		{"BaseAddTo_fallback_BFloat16", func() { BaseAddTo_fallback_BFloat16(bf16, bf16, bf16) }},
+		{"BaseAddTo_fallback", func() { BaseAddTo_fallback(f32, f32, f32) }},
+		{"BaseAddTo_fallback_Float64", func() { BaseAddTo_fallback_Float64(f64, f64, f64) }},
+		{"BaseDiv_fallback_Float16", func() { BaseDiv_fallback_Float16(f16, f16) }},
+		{"BaseDiv_fallback_BFloat16", func() { BaseDiv_fallback_BFloat16(bf16, bf16) }},
+		{"BaseDiv_fallback", func() { BaseDiv_fallback(f32, f32) }},
+		{"BaseDiv_fallback_Float64", func() { BaseDiv_fallback_Float64(f64, f64) }},
+		{"BaseDivTo_fallback_Float16", func() { BaseDivTo_fallback_Float16(f16, f16, f16) }},
+		{"BaseDivTo_fallback_BFloat16", func() { BaseDivTo_fallback_BFloat16(bf16, bf16, bf16) }},
+		{"BaseDivTo_fallback", func() { BaseDivTo_fallback(f32, f32, f32) }},
+		{"BaseDivTo_fallback_Float64", func() { BaseDivTo_fallback_Float64(f64, f64, f64) }},
+		{"BaseMul_fallback_Float16", func() { BaseMul_fallback_Float16(f16, f16) }},
+		{"BaseMul_fallback_BFloat16", func() { BaseMul_fallback_BFloat16(bf16, bf16) }},
+		{"BaseMul_fallback", func() { BaseMul_fallback(f32, f32) }},
+		{"BaseMul_fallback_Float64", func() { BaseMul_fallback_Float64(f64, f64) }},
+		{"BaseMulConstAddTo_fallback_Float16", func() { BaseMulConstAddTo_fallback_Float16(f16, f16Scalar, f16) }},
+		{"BaseMulConstAddTo_fallback_BFloat16", func() { BaseMulConstAddTo_fallback_BFloat16(bf16, bf16Scalar, bf16) }},
+		{"BaseMulConstAddTo_fallback", func() { BaseMulConstAddTo_fallback(f32, f32Scalar, f32) }},
+		{"BaseMulConstAddTo_fallback_Float64", func() { BaseMulConstAddTo_fallback_Float64(f64, f64Scalar, f64) }},
+		{"BaseMulTo_fallback_Float16", func() { BaseMulTo_fallback_Float16(f16, f16, f16) }},
+		{"BaseMulTo_fallback_BFloat16", func() { BaseMulTo_fallback_BFloat16(bf16, bf16, bf16) }},
+		{"BaseMulTo_fallback", func() { BaseMulTo_fallback(f32, f32, f32) }},
+		{"BaseMulTo_fallback_Float64", func() { BaseMulTo_fallback_Float64(f64, f64, f64) }},
+		{"BaseScale_fallback_Float16", func() { BaseScale_fallback_Float16(f16Scalar, f16) }},
+		{"BaseScale_fallback_BFloat16", func() { BaseScale_fallback_BFloat16(bf16Scalar, bf16) }},
+		{"BaseScale_fallback", func() { BaseScale_fallback(f32Scalar, f32) }},
+		{"BaseScale_fallback_Float64", func() { BaseScale_fallback_Float64(f64Scalar, f64) }},
+		{"BaseScaleTo_fallback_Float16", func() { BaseScaleTo_fallback_Float16(f16, f16Scalar, f16) }},
+		{"BaseScaleTo_fallback_BFloat16", func() { BaseScaleTo_fallback_BFloat16(bf16, bf16Scalar, bf16) }},
+		{"BaseScaleTo_fallback", func() { BaseScaleTo_fallback(f32, f32Scalar, f32) }},
+		{"BaseScaleTo_fallback_Float64", func() { BaseScaleTo_fallback_Float64(f64, f64Scalar, f64) }},
+		{"BaseSub_fallback_Float16", func() { BaseSub_fallback_Float16(f16, f16) }},
+		{"BaseSub_fallback_BFloat16", func() { BaseSub_fallback_BFloat16(bf16, bf16) }},
+		{"BaseSub_fallback", func() { BaseSub_fallback(f32, f32) }},
+		{"BaseSub_fallback_Float64", func() { BaseSub_fallback_Float64(f64, f64) }},
+		{"BaseSubTo_fallback_Float16", func() { BaseSubTo_fallback_Float16(f16, f16, f16) }},
+		{"BaseSubTo_fallback_BFloat16", func() { BaseSubTo_fallback_BFloat16(bf16, bf16, bf16) }},
+		{"BaseSubTo_fallback", func() { BaseSubTo_fallback(f32, f32, f32) }},
+		{"BaseSubTo_fallback_Float64", func() { BaseSubTo_fallback_Float64(f64, f64, f64) }},
+		{"BaseBatchDot_fallback_Float16", func() { BaseBatchDot_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim) }},
+		{"BaseBatchDot_fallback_BFloat16", func() { BaseBatchDot_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim) }},
+		{"BaseBatchDot_fallback", func() { BaseBatchDot_fallback(f32, f32, f32, allocTestDim, allocTestDim) }},
+		{"BaseBatchDot_fallback_Float64", func() { BaseBatchDot_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim) }},
+		{"BaseBatchL2SquaredDistance_fallback_Float16", func() { BaseBatchL2SquaredDistance_fallback_Float16(f16, f16, f16, allocTestDim, allocTestDim) }},
+		{"BaseBatchL2SquaredDistance_fallback_BFloat16", func() { BaseBatchL2SquaredDistance_fallback_BFloat16(bf16, bf16, bf16, allocTestDim, allocTestDim) }},
+		{"BaseBatchL2SquaredDistance_fallback", func() { BaseBatchL2SquaredDistance_fallback(f32, f32, f32, allocTestDim, allocTestDim) }},
+		{"BaseBatchL2SquaredDistance_fallback_Float64", func() { BaseBatchL2SquaredDistance_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim) }},
+		{"BaseBatchDotBlocked_fallback", func() { BaseBatchDotBlocked_fallback(f32, f32, f32, allocTestDim, allocTestDim) }},
+		{"BaseBatchDotBlocked_fallback_Float64", func() { BaseBatchDotBlocked_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim) }},
+		{"BaseBatchL2SquaredDistanceBlocked_fallback", func() { BaseBatchL2SquaredDistanceBlocked_fallback(f32, f32, f32, allocTestDim, allocTestDim) }},
+		{"BaseBatchL2SquaredDistanceBlocked_fallback_Float64", func() { BaseBatchL2SquaredDistanceBlocked_fallback_Float64(f64, f64, f64, allocTestDim, allocTestDim) }},
+		{"BaseCopy_fallback_Float16", func() { BaseCopy_fallback_Float16(f16, f16) }},
+		{"BaseCopy_fallback_BFloat16", func() { BaseCopy_fallback_BFloat16(bf16, bf16) }},
+		{"BaseCopy_fallback", func() { BaseCopy_fallback(f32, f32) }},
+		{"BaseCopy_fallback_Float64", func() { BaseCopy_fallback_Float64(f64, f64) }},
+		{"BaseL2Distance_fallback_Float16", func() { BaseL2Distance_fallback_Float16(f16, f16) }},
+		{"BaseL2Distance_fallback_BFloat16", func() { BaseL2Distance_fallback_BFloat16(bf16, bf16) }},
+		{"BaseL2Distance_fallback", func() { BaseL2Distance_fallback(f32, f32) }},
+		{"BaseL2Distance_fallback_Float64", func() { BaseL2Distance_fallback_Float64(f64, f64) }},
+		{"BaseL2SquaredDistance_fallback_Float16", func() { BaseL2SquaredDistance_fallback_Float16(f16, f16) }},
+		{"BaseL2SquaredDistance_fallback_BFloat16", func() { BaseL2SquaredDistance_fallback_BFloat16(bf16, bf16) }},
+		{"BaseL2SquaredDistance_fallback", func() { BaseL2SquaredDistance_fallback(f32, f32) }},
+		{"BaseL2SquaredDistance_fallback_Float64", func() { BaseL2SquaredDistance_fallback_Float64(f64, f64) }},
+		{"BaseDot_fallback_Float16", func() { BaseDot_fallback_Float16(f16, f16) }},
+		{"BaseDot_fallback_BFloat16", func() { BaseDot_fallback_BFloat16(bf16, bf16) }},
+		{"BaseDot_fallback", func() { BaseDot_fallback(f32, f32) }},
+		{"BaseDot_fallback_Float64", func() { BaseDot_fallback_Float64(f64, f64) }},
+		{"BaseDotInt_fallback_Int8", func() { BaseDotInt_fallback_Int8(i8, i8) }},
+		{"BaseDotInt_fallback_Uint8", func() { BaseDotInt_fallback_Uint8(u8, u8) }},
+		{"BaseDecodeFloat32s_fallback", func() { BaseDecodeFloat32s_fallback(f32[:allocTestLen/4], u8) }},
+		{"BaseDecodeFloat64s_fallback", func() { BaseDecodeFloat64s_fallback(f64[:allocTestLen/8], u8) }},
+		{"BaseEncodeFloat32s_fallback", func() { BaseEncodeFloat32s_fallback(u8, f32[:allocTestLen/4]) }},
+		{"BaseEncodeFloat64s_fallback", func() { BaseEncodeFloat64s_fallback(u8, f64[:allocTestLen/8]) }},
+		{"BaseNorm_fallback_Float16", func() { BaseNorm_fallback_Float16(f16) }},
+		{"BaseNorm_fallback_BFloat16", func() { BaseNorm_fallback_BFloat16(bf16) }},
+		{"BaseNorm_fallback", func() { BaseNorm_fallback(f32) }},
+		{"BaseNorm_fallback_Float64", func() { BaseNorm_fallback_Float64(f64) }},
+		{"BaseSquaredNorm_fallback_Float16", func() { BaseSquaredNorm_fallback_Float16(f16) }},
+		{"BaseSquaredNorm_fallback_BFloat16", func() { BaseSquaredNorm_fallback_BFloat16(bf16) }},
+		{"BaseSquaredNorm_fallback", func() { BaseSquaredNorm_fallback(f32) }},
+		{"BaseSquaredNorm_fallback_Float64", func() { BaseSquaredNorm_fallback_Float64(f64) }},
+		{"BaseNormalize_fallback_Float16", func() { BaseNormalize_fallback_Float16(f16) }},
+		{"BaseNormalize_fallback_BFloat16", func() { BaseNormalize_fallback_BFloat16(bf16) }},
+		{"BaseNormalize_fallback", func() { BaseNormalize_fallback(f32) }},
+		{"BaseNormalize_fallback_Float64", func() { BaseNormalize_fallback_Float64(f64) }},
+		{"BaseNormalizeTo_fallback_Float16", func() { BaseNormalizeTo_fallback_Float16(f16, f16) }},
+		{"BaseNormalizeTo_fallback_BFloat16", func() { BaseNormalizeTo_fallback_BFloat16(bf16, bf16) }},
+		{"BaseNormalizeTo_fallback", func() { BaseNormalizeTo_fallback(f32, f32) }},
+		{"BaseNormalizeTo_fallback_Float64", func() { BaseNormalizeTo_fallback_Float64(f64, f64) }},
+		{"BaseMax_fallback", func() { BaseMax_fallback(f32) }},
+		{"BaseMax_fallback_Float64", func() { BaseMax_fallback_Float64(f64) }},
+		{"BaseMax_fallback_Int32", func() { BaseMax_fallback_Int32(i32) }},
+		{"BaseMax_fallback_Int64", func() { BaseMax_fallback_Int64(i64) }},
+		{"BaseMax_fallback_Uint32", func() { BaseMax_fallback_Uint32(u32) }},
+		{"BaseMax_fallback_Uint64", func() { BaseMax_fallback_Uint64(u64) }},
+		{"BaseMin_fallback_Float16", func() { BaseMin_fallback_Float16(f16) }},
+		{"BaseMin_fallback_BFloat16", func() { BaseMin_fallback_BFloat16(bf16) }},
+		{"BaseMin_fallback", func() { BaseMin_fallback(f32) }},
+		{"BaseMin_fallback_Float64", func() { BaseMin_fallback_Float64(f64) }},
+		{"BaseMinMax_fallback_Float16", func() { BaseMinMax_fallback_Float16(f16) }},
+		{"BaseMinMax_fallback_BFloat16", func() { BaseMinMax_fallback_BFloat16(bf16) }},
+		{"BaseMinMax_fallback", func() { BaseMinMax_fallback(f32) }},
+		{"BaseMinMax_fallback_Float64", func() { BaseMinMax_fallback_Float64(f64) }},
+		{"BaseSum_fallback_Float16", func() { BaseSum_fallback_Float16(f16) }},
+		{"BaseSum_fallback_BFloat16", func() { BaseSum_fallback_BFloat16(bf16) }},
+		{"BaseSum_fallback", func() { BaseSum_fallback(f32) }},
+		{"BaseSum_fallback_Float64", func() { BaseSum_fallback_Float64(f64) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
@@ -0,0 +1,149 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package vec
+
+import (
+	"math/bits"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/roaring"
+)
+
+const (
+	// filterChunkWords is the number of allowed-bitmap words examined per
+	// chunk. 4096 bits keeps the extracted positions within ExtractBitPositions'
+	// uint16 range and the position buffer on the stack.
+	filterChunkWords = 64
+	filterChunkBits  = filterChunkWords * 64
+
+	// filterDenseNum/filterDenseDen is the chunk popcount fraction from which
+	// the filtered kernels find runs of allowed vectors by scanning the bitmap
+	// words instead of extracting every set bit position.
+	filterDenseNum = 3
+	filterDenseDen = 4
+)
+
+// FilteredBatchL2SquaredDistance computes the squared L2 distances from
+// query to the data vectors whose bit is set in allowed, skipping all
+// others.
+//
+// data holds count vectors of dims components, and allowed is a bitmap over
+// their indices in the roaring word layout (bit i%64 of allowed[i/64]); bits
+// at or beyond count are ignored. The index and distance of every allowed
+// vector are written to ids and distances in increasing index order, and the
+// number written is returned. ids and distances must hold at least as many
+// entries as allowed vectors, PopcntSlice(allowed) at most.
+//
+// The bitmap is processed in chunks of 4096 vectors. Empty chunks cost one
+// popcount. Sparse chunks extract their set bits with ExtractBitPositions
+// and gather the listed vectors; dense chunks walk the runs of consecutive
+// set bits directly. Either way each run of adjacent vectors is scored with
+// one BatchL2SquaredDistanceBlocked call, so the cost follows the number of
+// allowed vectors rather than count.
+func FilteredBatchL2SquaredDistance[T float32 | float64](query, data []T, allowed []uint64, ids []int32, distances []T, count, dims int) int {
+	return filteredBatch(query, data, allowed, ids, distances, count, dims, BatchL2SquaredDistanceBlocked[T])
+}
+
+// FilteredBatchDot computes the dot products of query with the data vectors
+// whose bit is set in allowed, like FilteredBatchL2SquaredDistance.
+func FilteredBatchDot[T float32 | float64](query, data []T, allowed []uint64, ids []int32, dots []T, count, dims int) int {
+	return filteredBatch(query, data, allowed, ids, dots, count, dims, BatchDotBlocked[T])
+}
+
+func filteredBatch[T float32 | float64](query, data []T, allowed []uint64, ids []int32, out []T, count, dims int,
+	batch func(query, data, out []T, count, dims int)) int {
+	if count <= 0 || dims <= 0 {
+		return 0
+	}
+	query = query[:dims]
+	words := (count + 63) / 64
+	allowed = allowed[:words]
+
+	var positions [filterChunkBits]uint16
+	var last [filterChunkWords]uint64
+	n := 0
+	for w := 0; w < words; w += filterChunkWords {
+		chunk := allowed[w:min(w+filterChunkWords, words)]
+		base := w * 64
+		if rem := count - base; rem < len(chunk)*64 {
+			// Mask off the bits past count in the final word.
+			copy(last[:], chunk)
+			chunk = last[:len(chunk)]
+			chunk[len(chunk)-1] &= 1<<(rem%64) - 1
+		}
+
+		set := int(roaring.PopcntSlice(chunk))
+		switch {
+		case set == 0:
+			continue
+		case set*filterDenseDen >= len(chunk)*64*filterDenseNum:
+			n = filteredRuns(query, data, chunk, base, ids, out, n, dims, batch)
+		default:
+			m := roaring.ExtractBitPositions(chunk, positions[:])
+			for j := 0; j < m; {
+				// Coalesce consecutive positions so that adjacent vectors
+				// still share query loads.
+				k := j + 1
+				for k < m && positions[k] == positions[k-1]+1 {
+					k++
+				}
+				lo := base + int(positions[j])
+				for i := range k - j {
+					ids[n+i] = int32(lo + i)
+				}
+				batch(query, data[lo*dims:(lo+k-j)*dims], out[n:n+k-j], k-j, dims)
+				n += k - j
+				j = k
+			}
+		}
+	}
+	return n
+}
+
+// filteredRuns scores every run of consecutive set bits in chunk with one
+// batch kernel call, appending to ids and out from index n.
+func filteredRuns[T float32 | float64](query, data []T, chunk []uint64, base int, ids []int32, out []T, n, dims int,
+	batch func(query, data, out []T, count, dims int)) int {
+	bitsLen := len(chunk) * 64
+	start := nextBit(chunk, 0, false)
+	for start < bitsLen {
+		end := nextBit(chunk, start, true)
+		lo, hi := base+start, base+end
+		batch(query, data[lo*dims:hi*dims], out[n:n+end-start], end-start, dims)
+		for i := lo; i < hi; i++ {
+			ids[n] = int32(i)
+			n++
+		}
+		start = nextBit(chunk, end, false)
+	}
+	return n
+}
+
+// nextBit returns the index of the first bit at or after from that is clear
+// (zero true) or set (zero false), or len(b)*64 if there is none.
+func nextBit(b []uint64, from int, zero bool) int {
+	for w := from / 64; w < len(b); w++ {
+		word := b[w]
+		if zero {
+			word = ^word
+		}
+		if w == from/64 {
+			word &= ^uint64(0) << (from % 64)
+		}
+		if word != 0 {
+			return w*64 + bits.TrailingZeros64(word)
+		}
+	}
+	return len(b) * 64
+}
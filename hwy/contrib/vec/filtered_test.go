@@ -0,0 +1,106 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package vec
+
+import (
+	"fmt"
+	"math"
+	"math/rand"
+	"testing"
+)
+
+func TestFilteredBatch(t *testing.T) {
+	rng := rand.New(rand.NewSource(1))
+	const dims = 19
+	for _, count := range []int{1, 63, 64, 65, 4096, 4097, 10000} {
+		for _, density := range []float64{0, 0.01, 0.3, 0.8, 1} {
+			query := make([]float32, dims)
+			data := make([]float32, count*dims)
+			for i := range query {
+				query[i] = rng.Float32()
+			}
+			for i := range data {
+				data[i] = rng.Float32()
+			}
+			// Bits past count are set and must be ignored.
+			allowed := make([]uint64, (count+63)/64)
+			for i := range allowed {
+				allowed[i] = ^uint64(0)
+			}
+			var want []int32
+			for i := range len(allowed) * 64 {
+				if i < count && rng.Float64() < density {
+					want = append(want, int32(i))
+				} else if i < count {
+					allowed[i/64] &^= 1 << (i % 64)
+				}
+			}
+
+			ids := make([]int32, count)
+			dist := make([]float32, count)
+			dots := make([]float32, count)
+			n := FilteredBatchL2SquaredDistance(query, data, allowed, ids, dist, count, dims)
+			if n != len(want) {
+				t.Fatalf("count=%d density=%v: got %d vectors, want %d", count, density, n, len(want))
+			}
+			if m := FilteredBatchDot(query, data, allowed, ids[:0:0], dots, 0, dims); m != 0 {
+				t.Fatalf("count=0: got %d vectors", m)
+			}
+			FilteredBatchDot(query, data, allowed, make([]int32, count), dots, count, dims)
+			for j, id := range want {
+				if ids[j] != id {
+					t.Fatalf("count=%d density=%v: ids[%d] = %d, want %d", count, density, j, ids[j], id)
+				}
+				v := data[int(id)*dims : int(id+1)*dims]
+				if d := L2SquaredDistanceFloat32(query, v); math.Abs(float64(dist[j]-d)) > 1e-4 {
+					t.Fatalf("count=%d density=%v: distance of %d = %v, want %v", count, density, id, dist[j], d)
+				}
+				if d := DotFloat32(query, v); math.Abs(float64(dots[j]-d)) > 1e-4 {
+					t.Fatalf("count=%d density=%v: dot of %d = %v, want %v", count, density, id, dots[j], d)
+				}
+			}
+		}
+	}
+}
+
+func BenchmarkFilteredBatch(b *testing.B) {
+	const count, dims = 1 << 15, 128
+	rng := rand.New(rand.NewSource(1))
+	query := make([]float32, dims)
+	data := make([]float32, count*dims)
+	for i := range data {
+		data[i] = rng.Float32()
+	}
+	ids := make([]int32, count)
+	dist := make([]float32, count)
+	b.Run("Unfiltered", func(b *testing.B) {
+		for i := 0; i < b.N; i++ {
+			BatchL2SquaredDistanceFloat32(query, data, dist, count, dims)
+		}
+	})
+	for _, density := range []float64{0.01, 0.1, 0.5, 0.9} {
+		allowed := make([]uint64, count/64)
+		for i := range count {
+			if rng.Float64() < density {
+				allowed[i/64] |= 1 << (i % 64)
+			}
+		}
+		b.Run(fmt.Sprintf("Filtered/%g", density), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				FilteredBatchL2SquaredDistance(query, data, allowed, ids, dist, count, dims)
+			}
+		})
+	}
+}
@@ -0,0 +1,144 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package vec
+
+import (
+	"fmt"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+// The //hwy:maskedtail kernels finish with one masked iteration on AVX2 and
+// AVX-512. These tests cover every length from 1 to 2*lanes+1, with inputs
+// allocated at exactly that length (so -race's checkptr sees any pointer
+// that reaches past the allocation) and outputs followed by sentinels that
+// the masked store must leave alone.
+
+func TestMaskedTail_ElementWise(t *testing.T) {
+	testMaskedTailElementWise[float32](t)
+	testMaskedTailElementWise[float64](t)
+}
+
+func TestMaskedTail_Reductions(t *testing.T) {
+	testMaskedTailReductions[float32](t)
+	testMaskedTailReductions[float64](t)
+}
+
+// maskedTailInput returns an exactly-sized slice of small nonzero integers,
+// so sums and products are exact in either precision.
+func maskedTailInput[T hwy.FloatsNative](n, seed int) []T {
+	v := make([]T, n)
+	for i := range v {
+		v[i] = T((i*seed)%7 + 1)
+	}
+	return v
+}
+
+func testMaskedTailElementWise[T hwy.FloatsNative](t *testing.T) {
+	const sentinel = -12345
+	binary := func(f func(T, T) T) func(a, b []T) []T {
+		return func(a, b []T) []T {
+			out := make([]T, len(a))
+			for i := range out {
+				out[i] = f(a[i], b[i])
+			}
+			return out
+		}
+	}
+	const c = 3
+	kernels := []struct {
+		name string
+		run  func(dst, a, b []T)
+		want func(a, b []T) []T
+	}{
+		{"Add", func(dst, a, b []T) { copy(dst, a); Add(dst, b) }, binary(func(x, y T) T { return x + y })},
+		{"AddTo", func(dst, a, b []T) { AddTo(dst, a, b) }, binary(func(x, y T) T { return x + y })},
+		{"Sub", func(dst, a, b []T) { copy(dst, a); Sub(dst, b) }, binary(func(x, y T) T { return x - y })},
+		{"SubTo", func(dst, a, b []T) { SubTo(dst, a, b) }, binary(func(x, y T) T { return x - y })},
+		{"Mul", func(dst, a, b []T) { copy(dst, a); Mul(dst, b) }, binary(func(x, y T) T { return x * y })},
+		{"MulTo", func(dst, a, b []T) { MulTo(dst, a, b) }, binary(func(x, y T) T { return x * y })},
+		{"Div", func(dst, a, b []T) { copy(dst, a); Div(dst, b) }, binary(func(x, y T) T { return x / y })},
+		{"DivTo", func(dst, a, b []T) { DivTo(dst, a, b) }, binary(func(x, y T) T { return x / y })},
+		{"Scale", func(dst, a, _ []T) { copy(dst, a); Scale(c, dst) }, binary(func(x, _ T) T { return c * x })},
+		{"ScaleTo", func(dst, a, _ []T) { ScaleTo(dst, c, a) }, binary(func(x, _ T) T { return c * x })},
+		{"AddConst", func(dst, a, _ []T) { copy(dst, a); AddConst(c, dst) }, binary(func(x, _ T) T { return x + c })},
+		{"MulConstAddTo", func(dst, a, b []T) { copy(dst, a); MulConstAddTo(dst, c, b) }, binary(func(x, y T) T { return x + c*y })},
+	}
+
+	lanes := hwy.MaxLanes[T]()
+	for _, k := range kernels {
+		for n := 1; n <= 2*lanes+1; n++ {
+			t.Run(fmt.Sprintf("%s/%T/n=%d", k.name, T(0), n), func(t *testing.T) {
+				a, b := maskedTailInput[T](n, 3), maskedTailInput[T](n, 5)
+				want := k.want(a, b)
+
+				exact := make([]T, n)
+				k.run(exact, a, b)
+
+				padded := make([]T, n+lanes)
+				for i := range padded {
+					padded[i] = sentinel
+				}
+				k.run(padded[:n], a, b)
+
+				for i := range n {
+					if exact[i] != want[i] || padded[i] != want[i] {
+						t.Fatalf("[%d] = %v (exact), %v (padded), want %v", i, exact[i], padded[i], want[i])
+					}
+				}
+				for i := n; i < len(padded); i++ {
+					if padded[i] != sentinel {
+						t.Fatalf("wrote [%d] = %v past len %d", i, padded[i], n)
+					}
+				}
+			})
+		}
+	}
+}
+
+func testMaskedTailReductions[T hwy.FloatsNative](t *testing.T) {
+	lanes := hwy.MaxLanes[T]()
+	for n := 1; n <= 2*lanes+1; n++ {
+		t.Run(fmt.Sprintf("%T/n=%d", T(0), n), func(t *testing.T) {
+			a, b := maskedTailInput[T](n, 3), maskedTailInput[T](n, 5)
+			var dot, dist, sum T
+			minVal := a[0]
+			for i := range n {
+				dot += a[i] * b[i]
+				d := a[i] - b[i]
+				dist += d * d
+				sum += a[i]
+				minVal = min(minVal, a[i])
+			}
+			if got := Dot(a, b); got != dot {
+				t.Errorf("Dot = %v, want %v", got, dot)
+			}
+			if got := L2SquaredDistance(a, b); got != dist {
+				t.Errorf("L2SquaredDistance = %v, want %v", got, dist)
+			}
+			if got := Sum(a); got != sum {
+				t.Errorf("Sum = %v, want %v", got, sum)
+			}
+			if got := Min(a); got != minVal {
+				t.Errorf("Min = %v, want %v", got, minVal)
+			}
+			// All-positive input: a masked-off lane reading as 0 would win.
+			if got := Min(b); got <= 0 {
+				t.Errorf("Min = %v, want a positive element", got)
+			}
+		})
+	}
+}
@@ -0,0 +1,257 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package vec
+
+import "github.com/ajroetker/go-highway/hwy"
+
+// Mixed-precision distances read half-precision or scaled int8 storage and
+// accumulate and return float32. The half-precision Dot and Batch kernels
+// return (and on some targets accumulate in) the storage type, which loses
+// most of the precision of long dot products; these variants never do.
+//
+// Half-precision inputs are widened to float32 in chunks of mixedChunk
+// elements using the hardware conversion instructions where available
+// (F16C vcvtph2ps, AVX-512, NEON fcvtl) and fed to the float32 FMA kernels.
+// BFloat16 dot products use vdpbf16ps (AVX-512 BF16) or bfdot (ARMv8.6 BF16)
+// directly when the CPU supports them.
+
+// mixedChunk is the number of elements widened per step. Two chunks of
+// float32 fit comfortably in L1 alongside the inputs.
+const mixedChunk = 256
+
+// mixedQueryMax is the largest query widened into a stack buffer by the
+// batch variants; longer queries are widened into a heap buffer.
+const mixedQueryMax = 1024
+
+// Widening conversions and native BFloat16 dot product, replaced by the
+// platform init functions when the hardware supports them.
+var (
+	promoteFloat16  = promoteFloat16Scalar
+	promoteBFloat16 = promoteBFloat16Scalar
+
+	// dotBFloat16 computes a BFloat16 dot product with float32 accumulation
+	// using a native instruction, or is nil.
+	dotBFloat16 func(a, b []hwy.BFloat16) float32
+)
+
+func promoteFloat16Scalar(src []hwy.Float16, dst []float32) {
+	dst = dst[:len(src)]
+	for i, v := range src {
+		dst[i] = hwy.Float16ToFloat32(v)
+	}
+}
+
+func promoteBFloat16Scalar(src []hwy.BFloat16, dst []float32) {
+	dst = dst[:len(src)]
+	for i, v := range src {
+		dst[i] = hwy.BFloat16ToFloat32(v)
+	}
+}
+
+// promoter returns the widening conversion for T.
+func promoter[T hwy.Float16 | hwy.BFloat16]() func([]T, []float32) {
+	var f any
+	var zero T
+	switch any(zero).(type) {
+	case hwy.Float16:
+		f = promoteFloat16
+	case hwy.BFloat16:
+		f = promoteBFloat16
+	}
+	return f.(func([]T, []float32))
+}
+
+// mixedReduce widens a and b chunk by chunk and sums kernel over the chunks.
+func mixedReduce[T hwy.Float16 | hwy.BFloat16](a, b []T, kernel func(a, b []float32) float32) float32 {
+	n := min(len(a), len(b))
+	promote := promoter[T]()
+	var abuf, bbuf [mixedChunk]float32
+	var sum float32
+	for i := 0; i < n; i += mixedChunk {
+		m := min(mixedChunk, n-i)
+		promote(a[i:i+m], abuf[:m])
+		promote(b[i:i+m], bbuf[:m])
+		sum += kernel(abuf[:m], bbuf[:m])
+	}
+	return sum
+}
+
+// MixedDot computes the dot product of two Float16 or BFloat16 vectors,
+// accumulating in float32 and returning a float32 result.
+//
+// If the slices have different lengths, the computation uses the minimum
+// length. Returns 0 if either slice is empty.
+func MixedDot[T hwy.Float16 | hwy.BFloat16](a, b []T) float32 {
+	if bf, ok := any(a).([]hwy.BFloat16); ok && dotBFloat16 != nil {
+		return dotBFloat16(bf, any(b).([]hwy.BFloat16))
+	}
+	return mixedReduce(a, b, DotFloat32)
+}
+
+// MixedL2SquaredDistance computes the squared Euclidean distance between two
+// Float16 or BFloat16 vectors, accumulating in float32 and returning a
+// float32 result.
+//
+// If the slices have different lengths, the computation uses the minimum
+// length. Returns 0 if either slice is empty.
+func MixedL2SquaredDistance[T hwy.Float16 | hwy.BFloat16](a, b []T) float32 {
+	return mixedReduce(a, b, L2SquaredDistanceFloat32)
+}
+
+// mixedBatch applies kernel between query and each of the count data vectors
+// of length dims, writing float32 results to out. The query is widened once.
+func mixedBatch[T hwy.Float16 | hwy.BFloat16](query, data []T, out []float32, count, dims int, kernel func(a, b []float32) float32) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	_ = data[count*dims-1]
+	_ = out[count-1]
+	promote := promoter[T]()
+
+	var qstack [mixedQueryMax]float32
+	q := qstack[:]
+	if dims > mixedQueryMax {
+		q = make([]float32, dims)
+	}
+	q = q[:dims]
+	promote(query[:dims], q)
+
+	var rbuf [mixedChunk]float32
+	for i := range count {
+		row := data[i*dims : (i+1)*dims]
+		var sum float32
+		for j := 0; j < dims; j += mixedChunk {
+			m := min(mixedChunk, dims-j)
+			promote(row[j:j+m], rbuf[:m])
+			sum += kernel(q[j:j+m], rbuf[:m])
+		}
+		out[i] = sum
+	}
+}
+
+// MixedBatchDot computes the dot products of a single Float16 or BFloat16
+// query with count data vectors of length dims stored contiguously in data,
+// writing float32 results to dots (length >= count).
+func MixedBatchDot[T hwy.Float16 | hwy.BFloat16](query, data []T, dots []float32, count, dims int) {
+	if bq, ok := any(query).([]hwy.BFloat16); ok && dotBFloat16 != nil && count > 0 && dims > 0 {
+		bd := any(data).([]hwy.BFloat16)
+		_ = bd[count*dims-1]
+		_ = dots[count-1]
+		for i := range count {
+			dots[i] = dotBFloat16(bq[:dims], bd[i*dims:(i+1)*dims])
+		}
+		return
+	}
+	mixedBatch(query, data, dots, count, dims, DotFloat32)
+}
+
+// MixedBatchL2SquaredDistance computes the squared Euclidean distances from a
+// single Float16 or BFloat16 query to count data vectors of length dims stored
+// contiguously in data, writing float32 results to distances (length >= count).
+func MixedBatchL2SquaredDistance[T hwy.Float16 | hwy.BFloat16](query, data []T, distances []float32, count, dims int) {
+	mixedBatch(query, data, distances, count, dims, L2SquaredDistanceFloat32)
+}
+
+// ScaledDotInt8 computes the dot product of two int8-quantized vectors whose
+// real values are aScale*a[i] and bScale*b[i]. The integer products are
+// summed exactly in int32 by DotInt and scaled once.
+//
+// If the slices have different lengths, the computation uses the minimum
+// length. Vectors longer than 2^17 elements may overflow the int32 sum.
+func ScaledDotInt8(a []int8, aScale float32, b []int8, bScale float32) float32 {
+	return aScale * bScale * float32(DotIntInt8(a, b))
+}
+
+// ScaledL2SquaredDistanceInt8 computes the squared Euclidean distance between
+// two int8-quantized vectors whose real values are aScale*a[i] and
+// bScale*b[i].
+//
+// The distance is expanded as aScale²·‖a‖² + bScale²·‖b‖² − 2·aScale·bScale·⟨a,b⟩
+// with all three integer sums exact, so vectors sharing a scale get an exact
+// result up to the final rounding to float32.
+func ScaledL2SquaredDistanceInt8(a []int8, aScale float32, b []int8, bScale float32) float32 {
+	n := min(len(a), len(b))
+	a, b = a[:n], b[:n]
+	return scaledL2(DotIntInt8(a, a), aScale, DotIntInt8(b, b), bScale, DotIntInt8(a, b))
+}
+
+// scaledL2 combines the integer norms and dot product of two scaled int8
+// vectors into their squared distance.
+func scaledL2(aa int32, aScale float32, bb int32, bScale float32, ab int32) float32 {
+	if aScale == bScale {
+		s := float64(aScale)
+		return float32(s * s * float64(int64(aa)+int64(bb)-2*int64(ab)))
+	}
+	sa, sb := float64(aScale), float64(bScale)
+	d := sa*sa*float64(aa) + sb*sb*float64(bb) - 2*sa*sb*float64(ab)
+	return float32(max(d, 0))
+}
+
+// ScaledBatchDotInt8 computes the dot products of a single int8 query (real
+// values queryScale*query[i]) with count int8 data vectors of length dims
+// stored contiguously in data, where vector i has scale scales[i]. Results
+// are written to dots (length >= count).
+func ScaledBatchDotInt8(query []int8, queryScale float32, data []int8, scales []float32, dots []float32, count, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	_ = data[count*dims-1]
+	_ = scales[count-1]
+	_ = dots[count-1]
+	query = query[:dims]
+	for i := range count {
+		dots[i] = queryScale * scales[i] * float32(DotIntInt8(query, data[i*dims:(i+1)*dims]))
+	}
+}
+
+// SquaredNormsInt8 writes the integer squared norm ‖v‖² of each of count
+// int8 vectors of length dims stored contiguously in data to norms (length
+// >= count). The norms depend only on the data, so they are computed once
+// and passed to every ScaledBatchL2SquaredDistanceInt8 call.
+func SquaredNormsInt8(data []int8, norms []int32, count, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	_ = data[count*dims-1]
+	_ = norms[count-1]
+	for i := range count {
+		row := data[i*dims : (i+1)*dims]
+		norms[i] = DotIntInt8(row, row)
+	}
+}
+
+// ScaledBatchL2SquaredDistanceInt8 computes the squared Euclidean distances
+// from a single int8 query (real values queryScale*query[i]) to count int8
+// data vectors of length dims stored contiguously in data, where vector i has
+// scale scales[i] and integer squared norm norms[i] (see SquaredNormsInt8).
+// Results are written to distances (length >= count).
+//
+// With the norms precomputed, each vector costs a single integer dot product
+// with the query.
+func ScaledBatchL2SquaredDistanceInt8(query []int8, queryScale float32, data []int8, scales []float32, norms []int32, distances []float32, count, dims int) {
+	if count <= 0 || dims <= 0 {
+		return
+	}
+	_ = data[count*dims-1]
+	_ = scales[count-1]
+	_ = norms[count-1]
+	_ = distances[count-1]
+	query = query[:dims]
+	qq := DotIntInt8(query, query)
+	for i := range count {
+		row := data[i*dims : (i+1)*dims]
+		distances[i] = scaledL2(qq, queryScale, norms[i], scales[i], DotIntInt8(query, row))
+	}
+}
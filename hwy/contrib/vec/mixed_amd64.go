@@ -0,0 +1,78 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//go:build amd64 && goexperiment.simd
+
+package vec
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/asm"
+)
+
+// Override the mixed-precision conversions with the GoAT-generated F16C and
+// AVX-512 kernels, and the BFloat16 dot product with VDPBF16PS.
+
+func halfBits[T hwy.Float16 | hwy.BFloat16](s []T) []uint16 {
+	return unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(s))), len(s))
+}
+
+func promoteFloat16F16C(src []hwy.Float16, dst []float32) {
+	asm.PromoteF16ToF32F16C(halfBits(src), dst[:len(src)])
+}
+
+func promoteFloat16AVX512(src []hwy.Float16, dst []float32) {
+	asm.PromoteF16ToF32AVX512(halfBits(src), dst[:len(src)])
+}
+
+func promoteBFloat16AVX512(src []hwy.BFloat16, dst []float32) {
+	asm.PromoteBF16ToF32AVX512(halfBits(src), dst[:len(src)])
+}
+
+// dotBFloat16AVX512 runs VDPBF16PS over whole 32-element blocks and finishes
+// the remainder in Go, since the kernel only accumulates even-length tails
+// into a single lane.
+func dotBFloat16AVX512(a, b []hwy.BFloat16) float32 {
+	n := min(len(a), len(b))
+	blocked := n &^ 31
+	var acc [16]float32
+	if blocked > 0 {
+		asm.DotBF16AVX512(halfBits(a[:blocked]), halfBits(b[:blocked]), acc[:])
+	}
+	var sum float32
+	for _, v := range acc {
+		sum += v
+	}
+	for i := blocked; i < n; i++ {
+		sum += hwy.BFloat16ToFloat32(a[i]) * hwy.BFloat16ToFloat32(b[i])
+	}
+	return sum
+}
+
+func init() {
+	level := hwy.CurrentLevel()
+
+	if level == hwy.DispatchAVX512 {
+		promoteFloat16 = promoteFloat16AVX512
+		promoteBFloat16 = promoteBFloat16AVX512
+	} else if level >= hwy.DispatchAVX2 && hwy.HasF16C() {
+		promoteFloat16 = promoteFloat16F16C
+	}
+
+	if level == hwy.DispatchAVX512 && hwy.HasAVX512BF16() {
+		dotBFloat16 = dotBFloat16AVX512
+	}
+}
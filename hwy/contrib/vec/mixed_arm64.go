@@ -0,0 +1,56 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//go:build !noasm && arm64
+
+package vec
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/asm"
+)
+
+// Override the mixed-precision conversions with the GoAT-generated NEON
+// kernels (fcvtl and shll), and the BFloat16 dot product with BFDOT.
+
+func halfBits[T hwy.Float16 | hwy.BFloat16](s []T) []uint16 {
+	return unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(s))), len(s))
+}
+
+func promoteFloat16NEON(src []hwy.Float16, dst []float32) {
+	asm.PromoteF16ToF32NEON(halfBits(src), dst[:len(src)])
+}
+
+func promoteBFloat16NEON(src []hwy.BFloat16, dst []float32) {
+	asm.PromoteBF16ToF32NEON(halfBits(src), dst[:len(src)])
+}
+
+func dotBFloat16NEON(a, b []hwy.BFloat16) float32 {
+	var acc float32
+	asm.DotBF16NEON(halfBits(a), halfBits(b), &acc, min(len(a), len(b)))
+	return acc
+}
+
+func init() {
+	if !hwy.HasSIMD() {
+		return
+	}
+	promoteFloat16 = promoteFloat16NEON
+	promoteBFloat16 = promoteBFloat16NEON
+	if hwy.HasARMBF16() {
+		dotBFloat16 = dotBFloat16NEON
+	}
+}
@@ -0,0 +1,209 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package vec
+
+import (
+	"fmt"
+	"math"
+	"math/rand"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+// halfVectors returns n random values in T together with their exact float64
+// values.
+func halfVectors[T hwy.Float16 | hwy.BFloat16](rng *rand.Rand, n int) ([]T, []float64) {
+	h := make([]T, n)
+	f := make([]float64, n)
+	for i := range h {
+		v := float32(rng.NormFloat64())
+		switch p := any(&h[i]).(type) {
+		case *hwy.Float16:
+			*p = hwy.Float32ToFloat16(v)
+			f[i] = float64(hwy.Float16ToFloat32(*p))
+		case *hwy.BFloat16:
+			*p = hwy.Float32ToBFloat16(v)
+			f[i] = float64(hwy.BFloat16ToFloat32(*p))
+		}
+	}
+	return h, f
+}
+
+func refDot(a, b []float64) float64 {
+	var s float64
+	for i := range a {
+		s += a[i] * b[i]
+	}
+	return s
+}
+
+func refL2(a, b []float64) float64 {
+	var s float64
+	for i := range a {
+		d := a[i] - b[i]
+		s += d * d
+	}
+	return s
+}
+
+// closeF32 reports whether got matches want to float32 accumulation accuracy,
+// relative to scale (the sum of absolute terms).
+func closeF32(got float32, want, scale float64) bool {
+	return math.Abs(float64(got)-want) <= 1e-5*scale+1e-6
+}
+
+func testMixed[T hwy.Float16 | hwy.BFloat16](t *testing.T) {
+	rng := rand.New(rand.NewSource(1))
+	for _, n := range []int{0, 1, 7, 31, 32, 33, 255, 256, 257, 1000, 4096} {
+		a, af := halfVectors[T](rng, n)
+		b, bf := halfVectors[T](rng, n)
+		var absDot float64
+		for i := range af {
+			absDot += math.Abs(af[i] * bf[i])
+		}
+		if got, want := MixedDot(a, b), refDot(af, bf); !closeF32(got, want, absDot) {
+			t.Errorf("n=%d: MixedDot = %v, want %v", n, got, want)
+		}
+		want := refL2(af, bf)
+		if got := MixedL2SquaredDistance(a, b); !closeF32(got, want, want) {
+			t.Errorf("n=%d: MixedL2SquaredDistance = %v, want %v", n, got, want)
+		}
+	}
+}
+
+func TestMixedFloat16(t *testing.T)  { testMixed[hwy.Float16](t) }
+func TestMixedBFloat16(t *testing.T) { testMixed[hwy.BFloat16](t) }
+
+// TestMixedDotPrecision checks that long dot products do not lose the
+// precision of the half-precision storage type.
+func TestMixedDotPrecision(t *testing.T) {
+	const n = 4096
+	a := make([]hwy.BFloat16, n)
+	b := make([]hwy.BFloat16, n)
+	for i := range a {
+		a[i] = hwy.Float32ToBFloat16(1)
+		b[i] = hwy.Float32ToBFloat16(1)
+	}
+	// BFloat16 cannot represent 4095; float32 accumulation must be exact.
+	b[0] = 0
+	if got := MixedDot(a, b); got != n-1 {
+		t.Errorf("MixedDot = %v, want %v", got, n-1)
+	}
+}
+
+func testMixedBatch[T hwy.Float16 | hwy.BFloat16](t *testing.T) {
+	rng := rand.New(rand.NewSource(2))
+	for _, dims := range []int{1, 15, 128, 300, 1500} {
+		const count = 9
+		query, qf := halfVectors[T](rng, dims)
+		data, df := halfVectors[T](rng, count*dims)
+		dots := make([]float32, count)
+		dists := make([]float32, count)
+		MixedBatchDot(query, data, dots, count, dims)
+		MixedBatchL2SquaredDistance(query, data, dists, count, dims)
+		for i := range count {
+			row := df[i*dims : (i+1)*dims]
+			var absDot float64
+			for j := range row {
+				absDot += math.Abs(row[j] * qf[j])
+			}
+			if want := refDot(qf, row); !closeF32(dots[i], want, absDot) {
+				t.Errorf("dims=%d row %d: dot = %v, want %v", dims, i, dots[i], want)
+			}
+			if want := refL2(qf, row); !closeF32(dists[i], want, want) {
+				t.Errorf("dims=%d row %d: distance = %v, want %v", dims, i, dists[i], want)
+			}
+		}
+	}
+}
+
+func TestMixedBatchFloat16(t *testing.T)  { testMixedBatch[hwy.Float16](t) }
+func TestMixedBatchBFloat16(t *testing.T) { testMixedBatch[hwy.BFloat16](t) }
+
+func randomInt8(rng *rand.Rand, n int) []int8 {
+	v := make([]int8, n)
+	for i := range v {
+		v[i] = int8(rng.Intn(255) - 127)
+	}
+	return v
+}
+
+func TestScaledInt8(t *testing.T) {
+	rng := rand.New(rand.NewSource(3))
+	for _, n := range []int{0, 1, 17, 64, 1000} {
+		a, b := randomInt8(rng, n), randomInt8(rng, n)
+		for _, scales := range [][2]float32{{0.01, 0.01}, {0.02, 0.005}} {
+			af, bf := make([]float64, n), make([]float64, n)
+			for i := range n {
+				af[i] = float64(scales[0]) * float64(a[i])
+				bf[i] = float64(scales[1]) * float64(b[i])
+			}
+			if got, want := ScaledDotInt8(a, scales[0], b, scales[1]), refDot(af, bf); !closeF32(got, want, math.Abs(want)) {
+				t.Errorf("n=%d scales=%v: ScaledDotInt8 = %v, want %v", n, scales, got, want)
+			}
+			if got, want := ScaledL2SquaredDistanceInt8(a, scales[0], b, scales[1]), refL2(af, bf); !closeF32(got, want, want) {
+				t.Errorf("n=%d scales=%v: ScaledL2SquaredDistanceInt8 = %v, want %v", n, scales, got, want)
+			}
+		}
+	}
+	// Identical vectors with the same scale are exactly zero apart.
+	a := randomInt8(rng, 100)
+	if got := ScaledL2SquaredDistanceInt8(a, 0.3, a, 0.3); got != 0 {
+		t.Errorf("distance to self = %v, want 0", got)
+	}
+}
+
+func TestScaledBatchInt8(t *testing.T) {
+	rng := rand.New(rand.NewSource(4))
+	const count, dims = 13, 96
+	query := randomInt8(rng, dims)
+	data := randomInt8(rng, count*dims)
+	scales := make([]float32, count)
+	for i := range scales {
+		scales[i] = 0.001 + rng.Float32()*0.01
+	}
+	norms := make([]int32, count)
+	SquaredNormsInt8(data, norms, count, dims)
+	dots := make([]float32, count)
+	dists := make([]float32, count)
+	ScaledBatchDotInt8(query, 0.02, data, scales, dots, count, dims)
+	ScaledBatchL2SquaredDistanceInt8(query, 0.02, data, scales, norms, dists, count, dims)
+	for i := range count {
+		row := data[i*dims : (i+1)*dims]
+		if want := ScaledDotInt8(query, 0.02, row, scales[i]); dots[i] != want {
+			t.Errorf("row %d: dot = %v, want %v", i, dots[i], want)
+		}
+		if want := ScaledL2SquaredDistanceInt8(query, 0.02, row, scales[i]); dists[i] != want {
+			t.Errorf("row %d: distance = %v, want %v", i, dists[i], want)
+		}
+	}
+}
+
+func BenchmarkMixedBatchDot(b *testing.B) {
+	const count = 1024
+	rng := rand.New(rand.NewSource(1))
+	for _, dims := range []int{128, 768} {
+		query, _ := halfVectors[hwy.BFloat16](rng, dims)
+		data, _ := halfVectors[hwy.BFloat16](rng, count*dims)
+		dots := make([]float32, count)
+		b.Run(fmt.Sprintf("BFloat16/%d", dims), func(b *testing.B) {
+			b.SetBytes(int64(count * dims * 2))
+			for i := 0; i < b.N; i++ {
+				MixedBatchDot(query, data, dots, count, dims)
+			}
+		})
+	}
+}
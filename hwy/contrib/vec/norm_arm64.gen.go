@@ -32,6 +32,8 @@ var SquaredNormFloat64 func(v []float64) float64
 //	result := Norm(v)  // Sqrt(3*3 + 4*4) = Sqrt(25) = 5
 //
 // This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:kernel
 func Norm[T hwy.Floats](v []T) T {
 	if _, ok := any(v).([]hwy.Float16); ok {
 		return any(NormFloat16(any(v).([]hwy.Float16))).(T)
@@ -48,6 +50,30 @@ func Norm[T hwy.Floats](v []T) T {
 	panic("unsupported type")
 }
 
+// NormKernel returns the Norm implementation selected for T on this CPU.
+// Calling the returned function skips the per-call type dispatch of Norm,
+// which matters when it is called many times on short inputs.
+//
+// The handle is the implementation in effect when NormKernel is called.
+// Take it after hwy.ForceDispatch or hwy.ApplyDispatchEnv, and again after
+// any later override or restore; an older handle keeps the old target.
+func NormKernel[T hwy.Floats]() func(v []T) T {
+	var zero T
+	if _, ok := any(zero).(hwy.Float16); ok {
+		return any(NormFloat16).(func(v []T) T)
+	}
+	if _, ok := any(zero).(hwy.BFloat16); ok {
+		return any(NormBFloat16).(func(v []T) T)
+	}
+	if _, ok := any(zero).(float32); ok {
+		return any(NormFloat32).(func(v []T) T)
+	}
+	if _, ok := any(zero).(float64); ok {
+		return any(NormFloat64).(func(v []T) T)
+	}
+	panic("unsupported type")
+}
+
 // SquaredNorm computes the squared L2 norm (sum of squares) of a vector
 // using hwy primitives.
 // The result is equivalent to Dot(v, v): Σ(v[i] * v[i]).
@@ -63,6 +89,8 @@ func Norm[T hwy.Floats](v []T) T {
 //	result := SquaredNorm(v)  // 3*3 + 4*4 = 25
 //
 // This function dispatches to the appropriate SIMD implementation at runtime.
+//
+//hwy:kernel
 func SquaredNorm[T hwy.Floats](v []T) T {
 	if _, ok := any(v).([]hwy.Float16); ok {
 		return any(SquaredNormFloat16(any(v).([]hwy.Float16))).(T)
@@ -79,8 +107,43 @@ func SquaredNorm[T hwy.Floats](v []T) T {
 	panic("unsupported type")
 }
 
+// SquaredNormKernel returns the SquaredNorm implementation selected for T on this CPU.
+// Calling the returned function skips the per-call type dispatch of SquaredNorm,
+// which matters when it is called many times on short inputs.
+//
+// The handle is the implementation in effect when SquaredNormKernel is called.
+// Take it after hwy.ForceDispatch or hwy.ApplyDispatchEnv, and again after
+// any later override or restore; an older handle keeps the old target.
+func SquaredNormKernel[T hwy.Floats]() func(v []T) T {
+	var zero T
+	if _, ok := any(zero).(hwy.Float16); ok {
+		return any(SquaredNormFloat16).(func(v []T) T)
+	}
+	if _, ok := any(zero).(hwy.BFloat16); ok {
+		return any(SquaredNormBFloat16).(func(v []T) T)
+	}
+	if _, ok := any(zero).(float32); ok {
+		return any(SquaredNormFloat32).(func(v []T) T)
+	}
+	if _, ok := any(zero).(float64); ok {
+		return any(SquaredNormFloat64).(func(v []T) T)
+	}
+	panic("unsupported type")
+}
+
 func init() {
 	initNormAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Norm", Vars: []any{&NormFloat16, &NormBFloat16, &NormFloat32, &NormFloat64}},
+			{Name: "SquaredNorm", Vars: []any{&SquaredNormFloat16, &SquaredNormBFloat16, &SquaredNormFloat32, &SquaredNormFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initNormNEONAsm},
+			{Name: "fallback", Supported: true, Init: initNormFallback},
+		},
+	})
 }
 
 func initNormAll() {
@@ -14,7 +14,7 @@
 
 package vec
 
-//go:generate go run ../../../cmd/hwygen -input norm_base.go -output . -targets avx2,avx512,neon:asm,fallback -dispatch norm
+//go:generate go run ../../../cmd/hwygen -input norm_base.go -output . -targets avx2,avx512,avx2:asm,avx512:asm,neon:asm,fallback -dispatch norm
 
 import (
 	"math"
@@ -35,9 +35,12 @@ import (
 //
 //	v := []float32{3, 4}
 //	result := SquaredNorm(v)  // 3*3 + 4*4 = 25
+//
+//hwy:kernel
 func BaseSquaredNorm[T hwy.Floats](v []T) T {
 	// Use Dot(v, v) for consistency with how norms are typically computed.
-	// This ensures the same precision characteristics as dot product operations.
+	// This ensures the same precision characteristics as dot product operations,
+	// and reuses BaseDot's four independent FMA chains on every target.
 	return BaseDot(v, v)
 }
 
@@ -54,6 +57,8 @@ func BaseSquaredNorm[T hwy.Floats](v []T) T {
 //
 //	v := []float32{3, 4}
 //	result := Norm(v)  // Sqrt(3*3 + 4*4) = Sqrt(25) = 5
+//
+//hwy:kernel
 func BaseNorm[T hwy.Floats](v []T) T {
 	squaredNorm := BaseSquaredNorm(v)
 	if squaredNorm == 0 {
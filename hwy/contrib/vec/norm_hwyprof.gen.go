@@ -0,0 +1,80 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("vec", "Norm", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := NormFloat16; hwyImpl != nil {
+			NormFloat16 = func(v []hwy.Float16) hwy.Float16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := NormBFloat16; hwyImpl != nil {
+			NormBFloat16 = func(v []hwy.BFloat16) hwy.BFloat16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := NormFloat32; hwyImpl != nil {
+			NormFloat32 = func(v []float32) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := NormFloat64; hwyImpl != nil {
+			NormFloat64 = func(v []float64) float64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "SquaredNorm", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SquaredNormFloat16; hwyImpl != nil {
+			SquaredNormFloat16 = func(v []hwy.Float16) hwy.Float16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := SquaredNormBFloat16; hwyImpl != nil {
+			SquaredNormBFloat16 = func(v []hwy.BFloat16) hwy.BFloat16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := SquaredNormFloat32; hwyImpl != nil {
+			SquaredNormFloat32 = func(v []float32) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := SquaredNormFloat64; hwyImpl != nil {
+			SquaredNormFloat64 = func(v []float64) float64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+	})
+}
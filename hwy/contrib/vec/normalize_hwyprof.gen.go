@@ -0,0 +1,72 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("vec", "Normalize", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := NormalizeFloat16; hwyImpl != nil {
+			NormalizeFloat16 = func(dst []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := NormalizeBFloat16; hwyImpl != nil {
+			NormalizeBFloat16 = func(dst []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := NormalizeFloat32; hwyImpl != nil {
+			NormalizeFloat32 = func(dst []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst))
+			}
+		}
+		if hwyImpl := NormalizeFloat64; hwyImpl != nil {
+			NormalizeFloat64 = func(dst []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst))
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "NormalizeTo", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := NormalizeToFloat16; hwyImpl != nil {
+			NormalizeToFloat16 = func(dst []hwy.Float16, src []hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, src)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(src))
+			}
+		}
+		if hwyImpl := NormalizeToBFloat16; hwyImpl != nil {
+			NormalizeToBFloat16 = func(dst []hwy.BFloat16, src []hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, src)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(src))
+			}
+		}
+		if hwyImpl := NormalizeToFloat32; hwyImpl != nil {
+			NormalizeToFloat32 = func(dst []float32, src []float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, src)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(src))
+			}
+		}
+		if hwyImpl := NormalizeToFloat64; hwyImpl != nil {
+			NormalizeToFloat64 = func(dst []float64, src []float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, src)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(src))
+			}
+		}
+	})
+}
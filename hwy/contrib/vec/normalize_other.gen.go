@@ -77,6 +77,16 @@ func NormalizeTo[T hwy.Floats](dst []T, src []T) {
 
 func init() {
 	initNormalizeAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Normalize", Vars: []any{&NormalizeFloat16, &NormalizeBFloat16, &NormalizeFloat32, &NormalizeFloat64}},
+			{Name: "NormalizeTo", Vars: []any{&NormalizeToFloat16, &NormalizeToBFloat16, &NormalizeToFloat32, &NormalizeToFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initNormalizeFallback},
+		},
+	})
 }
 
 func initNormalizeAll() {
@@ -14,7 +14,16 @@
 
 package vec
 
-//go:generate go run ../../../cmd/hwygen -input reduce_base.go -output . -targets avx2,avx512,neon:asm,fallback -dispatch reduce
+//go:generate go run ../../../cmd/hwygen -input reduce_base.go -output . -targets avx2,avx512,avx2:asm,avx512:asm,neon:asm,fallback -dispatch reduce
+
+// The //hwy:accumulators directives below split the reduction chains of the
+// AVX2 and AVX-512 kernels and of the float32, float64 and integer fallbacks,
+// which the fallback scalarizer unrolls into one scalar chain per
+// accumulator. The Float16 and BFloat16 fallbacks are not scalarized and keep
+// a single chain. The NEON assembly of this group (asm/basesum_c_*,
+// asm/basemin_c_* and asm/basemax_c_*) was built before the directives and
+// also reduces a single chain; only the C it would be rebuilt from, pinned by
+// TestAccumulatorChainsVecReduce in cmd/hwygen, has the split chains.
 
 import "github.com/ajroetker/go-highway/hwy"
 
@@ -29,6 +38,8 @@ import "github.com/ajroetker/go-highway/hwy"
 //
 //	data := []float32{1, 2, 3, 4}
 //	result := Sum(data)  // 1 + 2 + 3 + 4 = 10
+//
+//hwy:maskedtail
 func BaseSum[T hwy.Floats](v []T) T {
 	if len(v) == 0 {
 		return 0
@@ -39,6 +50,7 @@ func BaseSum[T hwy.Floats](v []T) T {
 
 	// Process full vectors
 	var i int
+	//hwy:accumulators 4
 	for i = 0; i+lanes <= len(v); i += lanes {
 		va := hwy.Load(v[i:])
 		sum = hwy.Add(sum, va)
@@ -69,6 +81,8 @@ func BaseSum[T hwy.Floats](v []T) T {
 //
 //	data := []float32{3, 1, 4, 1, 5}
 //	result := Min(data)  // 1
+//
+//hwy:maskedtail
 func BaseMin[T hwy.Floats](v []T) T {
 	if len(v) == 0 {
 		panic("vec: Min called on empty slice")
@@ -92,6 +106,7 @@ func BaseMin[T hwy.Floats](v []T) T {
 
 	// Process full vectors
 	var i int
+	//hwy:accumulators 2
 	for i = lanes; i+lanes <= len(v); i += lanes {
 		va := hwy.Load(v[i:])
 		minVec = hwy.Min(minVec, va)
@@ -148,6 +163,7 @@ func BaseMax[T hwy.Lanes](v []T) T {
 
 	// Process full vectors
 	var i int
+	//hwy:accumulators 2
 	for i = lanes; i+lanes <= len(v); i += lanes {
 		va := hwy.Load(v[i:])
 		maxVec = hwy.Max(maxVec, va)
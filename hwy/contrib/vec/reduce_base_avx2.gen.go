@@ -28,11 +28,17 @@ func BaseMax_avx2(v []float32) float32 {
 	}
 	maxVec := archsimd.LoadFloat32x8Slice(v)
 	var i int
+	maxVec1 := maxVec
 	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&v[i])))
 		maxVec = maxVec.Max(va)
 		va1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&v[i+8])))
-		maxVec = maxVec.Max(va1)
+		maxVec1 = maxVec1.Max(va1)
+	}
+	maxVec = maxVec.Max(maxVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&v[i])))
+		maxVec = maxVec.Max(va)
 	}
 	result := hwy.ReduceMax_AVX2_F32x8(maxVec)
 	for ; i < len(v); i++ {
@@ -59,11 +65,17 @@ func BaseMax_avx2_Float64(v []float64) float64 {
 	}
 	maxVec := archsimd.LoadFloat64x4Slice(v)
 	var i int
+	maxVec1 := maxVec
 	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&v[i])))
 		maxVec = maxVec.Max(va)
 		va1 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&v[i+4])))
-		maxVec = maxVec.Max(va1)
+		maxVec1 = maxVec1.Max(va1)
+	}
+	maxVec = maxVec.Max(maxVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&v[i])))
+		maxVec = maxVec.Max(va)
 	}
 	result := hwy.ReduceMax_AVX2_F64x4(maxVec)
 	for ; i < len(v); i++ {
@@ -90,11 +102,17 @@ func BaseMax_avx2_Int32(v []int32) int32 {
 	}
 	maxVec := archsimd.LoadInt32x8Slice(v)
 	var i int
+	maxVec1 := maxVec
 	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadInt32x8((*[8]int32)(unsafe.Pointer(&v[i])))
 		maxVec = maxVec.Max(va)
 		va1 := archsimd.LoadInt32x8((*[8]int32)(unsafe.Pointer(&v[i+8])))
-		maxVec = maxVec.Max(va1)
+		maxVec1 = maxVec1.Max(va1)
+	}
+	maxVec = maxVec.Max(maxVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadInt32x8((*[8]int32)(unsafe.Pointer(&v[i])))
+		maxVec = maxVec.Max(va)
 	}
 	result := hwy.ReduceMax_AVX2_I32x8(maxVec)
 	for ; i < len(v); i++ {
@@ -121,11 +139,17 @@ func BaseMax_avx2_Int64(v []int64) int64 {
 	}
 	maxVec := archsimd.LoadInt64x4Slice(v)
 	var i int
+	maxVec1 := maxVec
 	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadInt64x4((*[4]int64)(unsafe.Pointer(&v[i])))
 		maxVec = hwy.Max_AVX2_Int64x4(maxVec, va)
 		va1 := archsimd.LoadInt64x4((*[4]int64)(unsafe.Pointer(&v[i+4])))
-		maxVec = hwy.Max_AVX2_Int64x4(maxVec, va1)
+		maxVec1 = hwy.Max_AVX2_Int64x4(maxVec1, va1)
+	}
+	maxVec = hwy.Max_AVX2_Int64x4(maxVec, maxVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadInt64x4((*[4]int64)(unsafe.Pointer(&v[i])))
+		maxVec = hwy.Max_AVX2_Int64x4(maxVec, va)
 	}
 	result := hwy.ReduceMax_AVX2_I64x4(maxVec)
 	for ; i < len(v); i++ {
@@ -152,11 +176,17 @@ func BaseMax_avx2_Uint32(v []uint32) uint32 {
 	}
 	maxVec := archsimd.LoadUint32x8Slice(v)
 	var i int
+	maxVec1 := maxVec
 	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadUint32x8((*[8]uint32)(unsafe.Pointer(&v[i])))
 		maxVec = maxVec.Max(va)
 		va1 := archsimd.LoadUint32x8((*[8]uint32)(unsafe.Pointer(&v[i+8])))
-		maxVec = maxVec.Max(va1)
+		maxVec1 = maxVec1.Max(va1)
+	}
+	maxVec = maxVec.Max(maxVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadUint32x8((*[8]uint32)(unsafe.Pointer(&v[i])))
+		maxVec = maxVec.Max(va)
 	}
 	result := hwy.ReduceMax_AVX2_Uint32x8(maxVec)
 	for ; i < len(v); i++ {
@@ -183,11 +213,17 @@ func BaseMax_avx2_Uint64(v []uint64) uint64 {
 	}
 	maxVec := archsimd.LoadUint64x4Slice(v)
 	var i int
+	maxVec1 := maxVec
 	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&v[i])))
 		maxVec = hwy.Max_AVX2_Uint64x4(maxVec, va)
 		va1 := archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&v[i+4])))
-		maxVec = hwy.Max_AVX2_Uint64x4(maxVec, va1)
+		maxVec1 = hwy.Max_AVX2_Uint64x4(maxVec1, va1)
+	}
+	maxVec = hwy.Max_AVX2_Uint64x4(maxVec, maxVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadUint64x4((*[4]uint64)(unsafe.Pointer(&v[i])))
+		maxVec = hwy.Max_AVX2_Uint64x4(maxVec, va)
 	}
 	result := hwy.ReduceMax_AVX2_Uint64x4(maxVec)
 	for ; i < len(v); i++ {
@@ -214,11 +250,17 @@ func BaseMin_avx2_Float16(v []hwy.Float16) hwy.Float16 {
 	}
 	minVec := asm.LoadFloat16x8AVX2Slice(unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(v))), len(v)))
 	var i int
+	minVec1 := minVec
 	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&v[i]))
 		minVec = minVec.Min(va)
 		va1 := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&v[i+8]))
-		minVec = minVec.Min(va1)
+		minVec1 = minVec1.Min(va1)
+	}
+	minVec = minVec.Min(minVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&v[i]))
+		minVec = minVec.Min(va)
 	}
 	result := minVec.ReduceMin()
 	for ; i < len(v); i++ {
@@ -245,11 +287,17 @@ func BaseMin_avx2_BFloat16(v []hwy.BFloat16) hwy.BFloat16 {
 	}
 	minVec := asm.LoadBFloat16x8AVX2Slice(unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(v))), len(v)))
 	var i int
+	minVec1 := minVec
 	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&v[i]))
 		minVec = minVec.Min(va)
 		va1 := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&v[i+8]))
-		minVec = minVec.Min(va1)
+		minVec1 = minVec1.Min(va1)
+	}
+	minVec = minVec.Min(minVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&v[i]))
+		minVec = minVec.Min(va)
 	}
 	result := minVec.ReduceMin()
 	for ; i < len(v); i++ {
@@ -276,18 +324,24 @@ func BaseMin_avx2(v []float32) float32 {
 	}
 	minVec := archsimd.LoadFloat32x8Slice(v)
 	var i int
+	minVec1 := minVec
 	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&v[i])))
 		minVec = minVec.Min(va)
 		va1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&v[i+8])))
-		minVec = minVec.Min(va1)
+		minVec1 = minVec1.Min(va1)
 	}
-	result := hwy.ReduceMin_AVX2_F32x8(minVec)
-	for ; i < len(v); i++ {
-		if v[i] < result {
-			result = v[i]
-		}
+	minVec = minVec.Min(minVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&v[i])))
+		minVec = minVec.Min(va)
 	}
+	if i < len(v) {
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(len(v) - i)
+		va := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, v[i:])
+		minVec = minVec.Min(va).Merge(minVec, hwyTailMask)
+	}
+	result := hwy.ReduceMin_AVX2_F32x8(minVec)
 	return result
 }
 
@@ -307,18 +361,24 @@ func BaseMin_avx2_Float64(v []float64) float64 {
 	}
 	minVec := archsimd.LoadFloat64x4Slice(v)
 	var i int
+	minVec1 := minVec
 	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&v[i])))
 		minVec = minVec.Min(va)
 		va1 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&v[i+4])))
-		minVec = minVec.Min(va1)
+		minVec1 = minVec1.Min(va1)
 	}
-	result := hwy.ReduceMin_AVX2_F64x4(minVec)
-	for ; i < len(v); i++ {
-		if v[i] < result {
-			result = v[i]
-		}
+	minVec = minVec.Min(minVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&v[i])))
+		minVec = minVec.Min(va)
+	}
+	if i < len(v) {
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(len(v) - i)
+		va := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, v[i:])
+		minVec = minVec.Min(va).Merge(minVec, hwyTailMask)
 	}
+	result := hwy.ReduceMin_AVX2_F64x4(minVec)
 	return result
 }
 
@@ -497,11 +557,25 @@ func BaseSum_avx2_Float16(v []hwy.Float16) hwy.Float16 {
 	sum := asm.ZeroFloat16x8AVX2()
 	lanes := 8
 	var i int
-	for i = 0; i+lanes*2 <= len(v); i += lanes * 2 {
+	sum1 := asm.ZeroFloat16x8AVX2()
+	sum2 := asm.ZeroFloat16x8AVX2()
+	sum3 := asm.ZeroFloat16x8AVX2()
+	for i = 0; i+lanes*4 <= len(v); i += lanes * 4 {
 		va := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&v[i]))
 		sum = sum.Add(va)
 		va1 := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&v[i+8]))
-		sum = sum.Add(va1)
+		sum1 = sum1.Add(va1)
+		va2 := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&v[i+16]))
+		sum2 = sum2.Add(va2)
+		va3 := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&v[i+24]))
+		sum3 = sum3.Add(va3)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= len(v); i += lanes {
+		va := asm.LoadFloat16x8AVX2Ptr(unsafe.Pointer(&v[i]))
+		sum = sum.Add(va)
 	}
 	result := sum.ReduceSum()
 	for ; i < len(v); i++ {
@@ -517,11 +591,25 @@ func BaseSum_avx2_BFloat16(v []hwy.BFloat16) hwy.BFloat16 {
 	sum := asm.ZeroBFloat16x8AVX2()
 	lanes := 8
 	var i int
-	for i = 0; i+lanes*2 <= len(v); i += lanes * 2 {
+	sum1 := asm.ZeroBFloat16x8AVX2()
+	sum2 := asm.ZeroBFloat16x8AVX2()
+	sum3 := asm.ZeroBFloat16x8AVX2()
+	for i = 0; i+lanes*4 <= len(v); i += lanes * 4 {
 		va := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&v[i]))
 		sum = sum.Add(va)
 		va1 := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&v[i+8]))
-		sum = sum.Add(va1)
+		sum1 = sum1.Add(va1)
+		va2 := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&v[i+16]))
+		sum2 = sum2.Add(va2)
+		va3 := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&v[i+24]))
+		sum3 = sum3.Add(va3)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= len(v); i += lanes {
+		va := asm.LoadBFloat16x8AVX2Ptr(unsafe.Pointer(&v[i]))
+		sum = sum.Add(va)
 	}
 	result := sum.ReduceSum()
 	for ; i < len(v); i++ {
@@ -537,16 +625,32 @@ func BaseSum_avx2(v []float32) float32 {
 	sum := archsimd.BroadcastFloat32x8(0)
 	lanes := 8
 	var i int
-	for i = 0; i+lanes*2 <= len(v); i += lanes * 2 {
+	sum1 := archsimd.BroadcastFloat32x8(0)
+	sum2 := archsimd.BroadcastFloat32x8(0)
+	sum3 := archsimd.BroadcastFloat32x8(0)
+	for i = 0; i+lanes*4 <= len(v); i += lanes * 4 {
 		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&v[i])))
 		sum = sum.Add(va)
 		va1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&v[i+8])))
-		sum = sum.Add(va1)
+		sum1 = sum1.Add(va1)
+		va2 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&v[i+16])))
+		sum2 = sum2.Add(va2)
+		va3 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&v[i+24])))
+		sum3 = sum3.Add(va3)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&v[i])))
+		sum = sum.Add(va)
 	}
-	result := hwy.ReduceSum_AVX2_F32x8(sum)
-	for ; i < len(v); i++ {
-		result += v[i]
+	if i < len(v) {
+		hwyTailMask := hwy.FirstN_AVX2_F32x8(len(v) - i)
+		va := hwy.MaskLoad_AVX2_F32x8(hwyTailMask, v[i:])
+		sum = sum.Add(va).Merge(sum, hwyTailMask)
 	}
+	result := hwy.ReduceSum_AVX2_F32x8(sum)
 	return result
 }
 
@@ -557,15 +661,31 @@ func BaseSum_avx2_Float64(v []float64) float64 {
 	sum := archsimd.BroadcastFloat64x4(0)
 	lanes := 4
 	var i int
-	for i = 0; i+lanes*2 <= len(v); i += lanes * 2 {
+	sum1 := archsimd.BroadcastFloat64x4(0)
+	sum2 := archsimd.BroadcastFloat64x4(0)
+	sum3 := archsimd.BroadcastFloat64x4(0)
+	for i = 0; i+lanes*4 <= len(v); i += lanes * 4 {
 		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&v[i])))
 		sum = sum.Add(va)
 		va1 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&v[i+4])))
-		sum = sum.Add(va1)
+		sum1 = sum1.Add(va1)
+		va2 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&v[i+8])))
+		sum2 = sum2.Add(va2)
+		va3 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&v[i+12])))
+		sum3 = sum3.Add(va3)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&v[i])))
+		sum = sum.Add(va)
 	}
-	result := hwy.ReduceSum_AVX2_F64x4(sum)
-	for ; i < len(v); i++ {
-		result += v[i]
+	if i < len(v) {
+		hwyTailMask := hwy.FirstN_AVX2_F64x4(len(v) - i)
+		va := hwy.MaskLoad_AVX2_F64x4(hwyTailMask, v[i:])
+		sum = sum.Add(va).Merge(sum, hwyTailMask)
 	}
+	result := hwy.ReduceSum_AVX2_F64x4(sum)
 	return result
 }
@@ -28,13 +28,17 @@ func BaseMax_avx512(v []float32) float32 {
 	}
 	maxVec := archsimd.LoadFloat32x16Slice(v)
 	var i int
-	for i = lanes; i+lanes*3 <= len(v); i += lanes * 3 {
+	maxVec1 := maxVec
+	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i])))
 		maxVec = maxVec.Max(va)
 		va1 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i+16])))
-		maxVec = maxVec.Max(va1)
-		va2 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i+32])))
-		maxVec = maxVec.Max(va2)
+		maxVec1 = maxVec1.Max(va1)
+	}
+	maxVec = maxVec.Max(maxVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i])))
+		maxVec = maxVec.Max(va)
 	}
 	result := hwy.ReduceMax_AVX512_F32x16(maxVec)
 	for ; i < len(v); i++ {
@@ -61,13 +65,17 @@ func BaseMax_avx512_Float64(v []float64) float64 {
 	}
 	maxVec := archsimd.LoadFloat64x8Slice(v)
 	var i int
-	for i = lanes; i+lanes*3 <= len(v); i += lanes * 3 {
+	maxVec1 := maxVec
+	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i])))
 		maxVec = maxVec.Max(va)
 		va1 := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i+8])))
-		maxVec = maxVec.Max(va1)
-		va2 := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i+16])))
-		maxVec = maxVec.Max(va2)
+		maxVec1 = maxVec1.Max(va1)
+	}
+	maxVec = maxVec.Max(maxVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i])))
+		maxVec = maxVec.Max(va)
 	}
 	result := hwy.ReduceMax_AVX512_F64x8(maxVec)
 	for ; i < len(v); i++ {
@@ -94,13 +102,17 @@ func BaseMax_avx512_Int32(v []int32) int32 {
 	}
 	maxVec := archsimd.LoadInt32x16Slice(v)
 	var i int
-	for i = lanes; i+lanes*3 <= len(v); i += lanes * 3 {
+	maxVec1 := maxVec
+	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadInt32x16((*[16]int32)(unsafe.Pointer(&v[i])))
 		maxVec = maxVec.Max(va)
 		va1 := archsimd.LoadInt32x16((*[16]int32)(unsafe.Pointer(&v[i+16])))
-		maxVec = maxVec.Max(va1)
-		va2 := archsimd.LoadInt32x16((*[16]int32)(unsafe.Pointer(&v[i+32])))
-		maxVec = maxVec.Max(va2)
+		maxVec1 = maxVec1.Max(va1)
+	}
+	maxVec = maxVec.Max(maxVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadInt32x16((*[16]int32)(unsafe.Pointer(&v[i])))
+		maxVec = maxVec.Max(va)
 	}
 	result := hwy.ReduceMax_AVX512_I32x16(maxVec)
 	for ; i < len(v); i++ {
@@ -127,13 +139,17 @@ func BaseMax_avx512_Int64(v []int64) int64 {
 	}
 	maxVec := archsimd.LoadInt64x8Slice(v)
 	var i int
-	for i = lanes; i+lanes*3 <= len(v); i += lanes * 3 {
+	maxVec1 := maxVec
+	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadInt64x8((*[8]int64)(unsafe.Pointer(&v[i])))
 		maxVec = maxVec.Max(va)
 		va1 := archsimd.LoadInt64x8((*[8]int64)(unsafe.Pointer(&v[i+8])))
-		maxVec = maxVec.Max(va1)
-		va2 := archsimd.LoadInt64x8((*[8]int64)(unsafe.Pointer(&v[i+16])))
-		maxVec = maxVec.Max(va2)
+		maxVec1 = maxVec1.Max(va1)
+	}
+	maxVec = maxVec.Max(maxVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadInt64x8((*[8]int64)(unsafe.Pointer(&v[i])))
+		maxVec = maxVec.Max(va)
 	}
 	result := hwy.ReduceMax_AVX512_I64x8(maxVec)
 	for ; i < len(v); i++ {
@@ -160,13 +176,17 @@ func BaseMax_avx512_Uint32(v []uint32) uint32 {
 	}
 	maxVec := archsimd.LoadUint32x16Slice(v)
 	var i int
-	for i = lanes; i+lanes*3 <= len(v); i += lanes * 3 {
+	maxVec1 := maxVec
+	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadUint32x16((*[16]uint32)(unsafe.Pointer(&v[i])))
 		maxVec = maxVec.Max(va)
 		va1 := archsimd.LoadUint32x16((*[16]uint32)(unsafe.Pointer(&v[i+16])))
-		maxVec = maxVec.Max(va1)
-		va2 := archsimd.LoadUint32x16((*[16]uint32)(unsafe.Pointer(&v[i+32])))
-		maxVec = maxVec.Max(va2)
+		maxVec1 = maxVec1.Max(va1)
+	}
+	maxVec = maxVec.Max(maxVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadUint32x16((*[16]uint32)(unsafe.Pointer(&v[i])))
+		maxVec = maxVec.Max(va)
 	}
 	result := hwy.ReduceMax_AVX512_Uint32x16(maxVec)
 	for ; i < len(v); i++ {
@@ -193,13 +213,17 @@ func BaseMax_avx512_Uint64(v []uint64) uint64 {
 	}
 	maxVec := archsimd.LoadUint64x8Slice(v)
 	var i int
-	for i = lanes; i+lanes*3 <= len(v); i += lanes * 3 {
+	maxVec1 := maxVec
+	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadUint64x8((*[8]uint64)(unsafe.Pointer(&v[i])))
 		maxVec = maxVec.Max(va)
 		va1 := archsimd.LoadUint64x8((*[8]uint64)(unsafe.Pointer(&v[i+8])))
-		maxVec = maxVec.Max(va1)
-		va2 := archsimd.LoadUint64x8((*[8]uint64)(unsafe.Pointer(&v[i+16])))
-		maxVec = maxVec.Max(va2)
+		maxVec1 = maxVec1.Max(va1)
+	}
+	maxVec = maxVec.Max(maxVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadUint64x8((*[8]uint64)(unsafe.Pointer(&v[i])))
+		maxVec = maxVec.Max(va)
 	}
 	result := hwy.ReduceMax_AVX512_Uint64x8(maxVec)
 	for ; i < len(v); i++ {
@@ -226,13 +250,17 @@ func BaseMin_avx512_Float16(v []hwy.Float16) hwy.Float16 {
 	}
 	minVec := asm.LoadFloat16x16AVX512Slice(unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(v))), len(v)))
 	var i int
-	for i = lanes; i+lanes*3 <= len(v); i += lanes * 3 {
+	minVec1 := minVec
+	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := asm.LoadFloat16x16AVX512Ptr(unsafe.Pointer(&v[i]))
 		minVec = minVec.Min(va)
 		va1 := asm.LoadFloat16x16AVX512Ptr(unsafe.Pointer(&v[i+16]))
-		minVec = minVec.Min(va1)
-		va2 := asm.LoadFloat16x16AVX512Ptr(unsafe.Pointer(&v[i+32]))
-		minVec = minVec.Min(va2)
+		minVec1 = minVec1.Min(va1)
+	}
+	minVec = minVec.Min(minVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := asm.LoadFloat16x16AVX512Ptr(unsafe.Pointer(&v[i]))
+		minVec = minVec.Min(va)
 	}
 	result := minVec.ReduceMin()
 	for ; i < len(v); i++ {
@@ -259,13 +287,17 @@ func BaseMin_avx512_BFloat16(v []hwy.BFloat16) hwy.BFloat16 {
 	}
 	minVec := asm.LoadBFloat16x16AVX512Slice(unsafe.Slice((*uint16)(unsafe.Pointer(unsafe.SliceData(v))), len(v)))
 	var i int
-	for i = lanes; i+lanes*3 <= len(v); i += lanes * 3 {
+	minVec1 := minVec
+	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := asm.LoadBFloat16x16AVX512Ptr(unsafe.Pointer(&v[i]))
 		minVec = minVec.Min(va)
 		va1 := asm.LoadBFloat16x16AVX512Ptr(unsafe.Pointer(&v[i+16]))
-		minVec = minVec.Min(va1)
-		va2 := asm.LoadBFloat16x16AVX512Ptr(unsafe.Pointer(&v[i+32]))
-		minVec = minVec.Min(va2)
+		minVec1 = minVec1.Min(va1)
+	}
+	minVec = minVec.Min(minVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := asm.LoadBFloat16x16AVX512Ptr(unsafe.Pointer(&v[i]))
+		minVec = minVec.Min(va)
 	}
 	result := minVec.ReduceMin()
 	for ; i < len(v); i++ {
@@ -292,20 +324,24 @@ func BaseMin_avx512(v []float32) float32 {
 	}
 	minVec := archsimd.LoadFloat32x16Slice(v)
 	var i int
-	for i = lanes; i+lanes*3 <= len(v); i += lanes * 3 {
+	minVec1 := minVec
+	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i])))
 		minVec = minVec.Min(va)
 		va1 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i+16])))
-		minVec = minVec.Min(va1)
-		va2 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i+32])))
-		minVec = minVec.Min(va2)
+		minVec1 = minVec1.Min(va1)
 	}
-	result := hwy.ReduceMin_AVX512_F32x16(minVec)
-	for ; i < len(v); i++ {
-		if v[i] < result {
-			result = v[i]
-		}
+	minVec = minVec.Min(minVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i])))
+		minVec = minVec.Min(va)
+	}
+	if i < len(v) {
+		hwyTailMask := hwy.FirstN_AVX512_F32x16(len(v) - i)
+		va := hwy.MaskLoad_AVX512_F32x16(hwyTailMask, v[i:])
+		minVec = minVec.Min(va).Merge(minVec, hwyTailMask)
 	}
+	result := hwy.ReduceMin_AVX512_F32x16(minVec)
 	return result
 }
 
@@ -325,20 +361,24 @@ func BaseMin_avx512_Float64(v []float64) float64 {
 	}
 	minVec := archsimd.LoadFloat64x8Slice(v)
 	var i int
-	for i = lanes; i+lanes*3 <= len(v); i += lanes * 3 {
+	minVec1 := minVec
+	for i = lanes; i+lanes*2 <= len(v); i += lanes * 2 {
 		va := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i])))
 		minVec = minVec.Min(va)
 		va1 := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i+8])))
-		minVec = minVec.Min(va1)
-		va2 := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i+16])))
-		minVec = minVec.Min(va2)
+		minVec1 = minVec1.Min(va1)
 	}
-	result := hwy.ReduceMin_AVX512_F64x8(minVec)
-	for ; i < len(v); i++ {
-		if v[i] < result {
-			result = v[i]
-		}
+	minVec = minVec.Min(minVec1)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i])))
+		minVec = minVec.Min(va)
 	}
+	if i < len(v) {
+		hwyTailMask := hwy.FirstN_AVX512_F64x8(len(v) - i)
+		va := hwy.MaskLoad_AVX512_F64x8(hwyTailMask, v[i:])
+		minVec = minVec.Min(va).Merge(minVec, hwyTailMask)
+	}
+	result := hwy.ReduceMin_AVX512_F64x8(minVec)
 	return result
 }
 
@@ -529,13 +569,25 @@ func BaseSum_avx512_Float16(v []hwy.Float16) hwy.Float16 {
 	sum := asm.ZeroFloat16x16AVX512()
 	lanes := 16
 	var i int
-	for i = 0; i+lanes*3 <= len(v); i += lanes * 3 {
+	sum1 := asm.ZeroFloat16x16AVX512()
+	sum2 := asm.ZeroFloat16x16AVX512()
+	sum3 := asm.ZeroFloat16x16AVX512()
+	for i = 0; i+lanes*4 <= len(v); i += lanes * 4 {
 		va := asm.LoadFloat16x16AVX512Ptr(unsafe.Pointer(&v[i]))
 		sum = sum.Add(va)
 		va1 := asm.LoadFloat16x16AVX512Ptr(unsafe.Pointer(&v[i+16]))
-		sum = sum.Add(va1)
+		sum1 = sum1.Add(va1)
 		va2 := asm.LoadFloat16x16AVX512Ptr(unsafe.Pointer(&v[i+32]))
-		sum = sum.Add(va2)
+		sum2 = sum2.Add(va2)
+		va3 := asm.LoadFloat16x16AVX512Ptr(unsafe.Pointer(&v[i+48]))
+		sum3 = sum3.Add(va3)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= len(v); i += lanes {
+		va := asm.LoadFloat16x16AVX512Ptr(unsafe.Pointer(&v[i]))
+		sum = sum.Add(va)
 	}
 	result := sum.ReduceSum()
 	for ; i < len(v); i++ {
@@ -551,13 +603,25 @@ func BaseSum_avx512_BFloat16(v []hwy.BFloat16) hwy.BFloat16 {
 	sum := asm.ZeroBFloat16x16AVX512()
 	lanes := 16
 	var i int
-	for i = 0; i+lanes*3 <= len(v); i += lanes * 3 {
+	sum1 := asm.ZeroBFloat16x16AVX512()
+	sum2 := asm.ZeroBFloat16x16AVX512()
+	sum3 := asm.ZeroBFloat16x16AVX512()
+	for i = 0; i+lanes*4 <= len(v); i += lanes * 4 {
 		va := asm.LoadBFloat16x16AVX512Ptr(unsafe.Pointer(&v[i]))
 		sum = sum.Add(va)
 		va1 := asm.LoadBFloat16x16AVX512Ptr(unsafe.Pointer(&v[i+16]))
-		sum = sum.Add(va1)
+		sum1 = sum1.Add(va1)
 		va2 := asm.LoadBFloat16x16AVX512Ptr(unsafe.Pointer(&v[i+32]))
-		sum = sum.Add(va2)
+		sum2 = sum2.Add(va2)
+		va3 := asm.LoadBFloat16x16AVX512Ptr(unsafe.Pointer(&v[i+48]))
+		sum3 = sum3.Add(va3)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= len(v); i += lanes {
+		va := asm.LoadBFloat16x16AVX512Ptr(unsafe.Pointer(&v[i]))
+		sum = sum.Add(va)
 	}
 	result := sum.ReduceSum()
 	for ; i < len(v); i++ {
@@ -573,18 +637,32 @@ func BaseSum_avx512(v []float32) float32 {
 	sum := archsimd.BroadcastFloat32x16(0)
 	lanes := 16
 	var i int
-	for i = 0; i+lanes*3 <= len(v); i += lanes * 3 {
+	sum1 := archsimd.BroadcastFloat32x16(0)
+	sum2 := archsimd.BroadcastFloat32x16(0)
+	sum3 := archsimd.BroadcastFloat32x16(0)
+	for i = 0; i+lanes*4 <= len(v); i += lanes * 4 {
 		va := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i])))
 		sum = sum.Add(va)
 		va1 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i+16])))
-		sum = sum.Add(va1)
+		sum1 = sum1.Add(va1)
 		va2 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i+32])))
-		sum = sum.Add(va2)
+		sum2 = sum2.Add(va2)
+		va3 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i+48])))
+		sum3 = sum3.Add(va3)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&v[i])))
+		sum = sum.Add(va)
 	}
-	result := hwy.ReduceSum_AVX512_F32x16(sum)
-	for ; i < len(v); i++ {
-		result += v[i]
+	if i < len(v) {
+		hwyTailMask := hwy.FirstN_AVX512_F32x16(len(v) - i)
+		va := hwy.MaskLoad_AVX512_F32x16(hwyTailMask, v[i:])
+		sum = sum.Add(va).Merge(sum, hwyTailMask)
 	}
+	result := hwy.ReduceSum_AVX512_F32x16(sum)
 	return result
 }
 
@@ -595,17 +673,31 @@ func BaseSum_avx512_Float64(v []float64) float64 {
 	sum := archsimd.BroadcastFloat64x8(0)
 	lanes := 8
 	var i int
-	for i = 0; i+lanes*3 <= len(v); i += lanes * 3 {
+	sum1 := archsimd.BroadcastFloat64x8(0)
+	sum2 := archsimd.BroadcastFloat64x8(0)
+	sum3 := archsimd.BroadcastFloat64x8(0)
+	for i = 0; i+lanes*4 <= len(v); i += lanes * 4 {
 		va := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i])))
 		sum = sum.Add(va)
 		va1 := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i+8])))
-		sum = sum.Add(va1)
+		sum1 = sum1.Add(va1)
 		va2 := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i+16])))
-		sum = sum.Add(va2)
+		sum2 = sum2.Add(va2)
+		va3 := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i+24])))
+		sum3 = sum3.Add(va3)
+	}
+	sum = sum.Add(sum1)
+	sum2 = sum2.Add(sum3)
+	sum = sum.Add(sum2)
+	for ; i+lanes <= len(v); i += lanes {
+		va := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&v[i])))
+		sum = sum.Add(va)
 	}
-	result := hwy.ReduceSum_AVX512_F64x8(sum)
-	for ; i < len(v); i++ {
-		result += v[i]
+	if i < len(v) {
+		hwyTailMask := hwy.FirstN_AVX512_F64x8(len(v) - i)
+		va := hwy.MaskLoad_AVX512_F64x8(hwyTailMask, v[i:])
+		sum = sum.Add(va).Merge(sum, hwyTailMask)
 	}
+	result := hwy.ReduceSum_AVX512_F64x8(sum)
 	return result
 }
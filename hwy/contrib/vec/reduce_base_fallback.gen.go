@@ -21,10 +21,14 @@ func BaseMax_fallback(v []float32) float32 {
 	}
 	maxVec := v[0]
 	var i int
-	for i = 1; i < len(v); i++ {
+	maxVec1 := maxVec
+	for i = 1; i+2 <= len(v); i += 2 {
 		va := v[i]
 		maxVec = max(maxVec, va)
+		va1 := v[i+1]
+		maxVec1 = max(maxVec1, va1)
 	}
+	maxVec = max(maxVec, maxVec1)
 	result := maxVec
 	for ; i < len(v); i++ {
 		if v[i] > result {
@@ -49,10 +53,14 @@ func BaseMax_fallback_Float64(v []float64) float64 {
 	}
 	maxVec := v[0]
 	var i int
-	for i = 1; i < len(v); i++ {
+	maxVec1 := maxVec
+	for i = 1; i+2 <= len(v); i += 2 {
 		va := v[i]
 		maxVec = max(maxVec, va)
+		va1 := v[i+1]
+		maxVec1 = max(maxVec1, va1)
 	}
+	maxVec = max(maxVec, maxVec1)
 	result := maxVec
 	for ; i < len(v); i++ {
 		if v[i] > result {
@@ -77,10 +85,14 @@ func BaseMax_fallback_Int32(v []int32) int32 {
 	}
 	maxVec := v[0]
 	var i int
-	for i = 1; i < len(v); i++ {
+	maxVec1 := maxVec
+	for i = 1; i+2 <= len(v); i += 2 {
 		va := v[i]
 		maxVec = max(maxVec, va)
+		va1 := v[i+1]
+		maxVec1 = max(maxVec1, va1)
 	}
+	maxVec = max(maxVec, maxVec1)
 	result := maxVec
 	for ; i < len(v); i++ {
 		if v[i] > result {
@@ -105,10 +117,14 @@ func BaseMax_fallback_Int64(v []int64) int64 {
 	}
 	maxVec := v[0]
 	var i int
-	for i = 1; i < len(v); i++ {
+	maxVec1 := maxVec
+	for i = 1; i+2 <= len(v); i += 2 {
 		va := v[i]
 		maxVec = max(maxVec, va)
+		va1 := v[i+1]
+		maxVec1 = max(maxVec1, va1)
 	}
+	maxVec = max(maxVec, maxVec1)
 	result := maxVec
 	for ; i < len(v); i++ {
 		if v[i] > result {
@@ -133,10 +149,14 @@ func BaseMax_fallback_Uint32(v []uint32) uint32 {
 	}
 	maxVec := v[0]
 	var i int
-	for i = 1; i < len(v); i++ {
+	maxVec1 := maxVec
+	for i = 1; i+2 <= len(v); i += 2 {
 		va := v[i]
 		maxVec = max(maxVec, va)
+		va1 := v[i+1]
+		maxVec1 = max(maxVec1, va1)
 	}
+	maxVec = max(maxVec, maxVec1)
 	result := maxVec
 	for ; i < len(v); i++ {
 		if v[i] > result {
@@ -161,10 +181,14 @@ func BaseMax_fallback_Uint64(v []uint64) uint64 {
 	}
 	maxVec := v[0]
 	var i int
-	for i = 1; i < len(v); i++ {
+	maxVec1 := maxVec
+	for i = 1; i+2 <= len(v); i += 2 {
 		va := v[i]
 		maxVec = max(maxVec, va)
+		va1 := v[i+1]
+		maxVec1 = max(maxVec1, va1)
 	}
+	maxVec = max(maxVec, maxVec1)
 	result := maxVec
 	for ; i < len(v); i++ {
 		if v[i] > result {
@@ -247,10 +271,14 @@ func BaseMin_fallback(v []float32) float32 {
 	}
 	minVec := v[0]
 	var i int
-	for i = 1; i < len(v); i++ {
+	minVec1 := minVec
+	for i = 1; i+2 <= len(v); i += 2 {
 		va := v[i]
 		minVec = min(minVec, va)
+		va1 := v[i+1]
+		minVec1 = min(minVec1, va1)
 	}
+	minVec = min(minVec, minVec1)
 	result := minVec
 	for ; i < len(v); i++ {
 		if v[i] < result {
@@ -275,10 +303,14 @@ func BaseMin_fallback_Float64(v []float64) float64 {
 	}
 	minVec := v[0]
 	var i int
-	for i = 1; i < len(v); i++ {
+	minVec1 := minVec
+	for i = 1; i+2 <= len(v); i += 2 {
 		va := v[i]
 		minVec = min(minVec, va)
+		va1 := v[i+1]
+		minVec1 = min(minVec1, va1)
 	}
+	minVec = min(minVec, minVec1)
 	result := minVec
 	for ; i < len(v); i++ {
 		if v[i] < result {
@@ -484,10 +516,22 @@ func BaseSum_fallback(v []float32) float32 {
 	}
 	sum := float32(0)
 	var i int
-	for i = 0; i < len(v); i++ {
+	sum1 := float32(0)
+	sum2 := float32(0)
+	sum3 := float32(0)
+	for i = 0; i+4 <= len(v); i += 4 {
 		va := v[i]
 		sum = sum + va
-	}
+		va1 := v[i+1]
+		sum1 = sum1 + va1
+		va2 := v[i+2]
+		sum2 = sum2 + va2
+		va3 := v[i+3]
+		sum3 = sum3 + va3
+	}
+	sum = sum + sum1
+	sum2 = sum2 + sum3
+	sum = sum + sum2
 	result := sum
 	for ; i < len(v); i++ {
 		result += v[i]
@@ -501,10 +545,22 @@ func BaseSum_fallback_Float64(v []float64) float64 {
 	}
 	sum := float64(0)
 	var i int
-	for i = 0; i < len(v); i++ {
+	sum1 := float64(0)
+	sum2 := float64(0)
+	sum3 := float64(0)
+	for i = 0; i+4 <= len(v); i += 4 {
 		va := v[i]
 		sum = sum + va
-	}
+		va1 := v[i+1]
+		sum1 = sum1 + va1
+		va2 := v[i+2]
+		sum2 = sum2 + va2
+		va3 := v[i+3]
+		sum3 = sum3 + va3
+	}
+	sum = sum + sum1
+	sum2 = sum2 + sum3
+	sum = sum + sum2
 	result := sum
 	for ; i < len(v); i++ {
 		result += v[i]
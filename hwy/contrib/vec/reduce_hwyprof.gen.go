@@ -0,0 +1,164 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package vec
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("vec", "Max", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MaxFloat32; hwyImpl != nil {
+			MaxFloat32 = func(v []float32) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := MaxFloat64; hwyImpl != nil {
+			MaxFloat64 = func(v []float64) float64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := MaxInt32; hwyImpl != nil {
+			MaxInt32 = func(v []int32) int32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := MaxInt64; hwyImpl != nil {
+			MaxInt64 = func(v []int64) int64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := MaxUint32; hwyImpl != nil {
+			MaxUint32 = func(v []uint32) uint32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := MaxUint64; hwyImpl != nil {
+			MaxUint64 = func(v []uint64) uint64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "Min", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MinFloat16; hwyImpl != nil {
+			MinFloat16 = func(v []hwy.Float16) hwy.Float16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := MinBFloat16; hwyImpl != nil {
+			MinBFloat16 = func(v []hwy.BFloat16) hwy.BFloat16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := MinFloat32; hwyImpl != nil {
+			MinFloat32 = func(v []float32) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := MinFloat64; hwyImpl != nil {
+			MinFloat64 = func(v []float64) float64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "MinMax", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := MinMaxFloat16; hwyImpl != nil {
+			MinMaxFloat16 = func(v []hwy.Float16) (minVal hwy.Float16, maxVal hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := MinMaxBFloat16; hwyImpl != nil {
+			MinMaxBFloat16 = func(v []hwy.BFloat16) (minVal hwy.BFloat16, maxVal hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := MinMaxFloat32; hwyImpl != nil {
+			MinMaxFloat32 = func(v []float32) (minVal float32, maxVal float32) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0, hwyR1
+			}
+		}
+		if hwyImpl := MinMaxFloat64; hwyImpl != nil {
+			MinMaxFloat64 = func(v []float64) (minVal float64, maxVal float64) {
+				hwyStart := hwyCounter.Start()
+				hwyR0, hwyR1 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0, hwyR1
+			}
+		}
+	})
+	hwy.ProfileDispatch("vec", "Sum", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := SumFloat16; hwyImpl != nil {
+			SumFloat16 = func(v []hwy.Float16) hwy.Float16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := SumBFloat16; hwyImpl != nil {
+			SumBFloat16 = func(v []hwy.BFloat16) hwy.BFloat16 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := SumFloat32; hwyImpl != nil {
+			SumFloat32 = func(v []float32) float32 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+		if hwyImpl := SumFloat64; hwyImpl != nil {
+			SumFloat64 = func(v []float64) float64 {
+				hwyStart := hwyCounter.Start()
+				hwyR0 := hwyImpl(v)
+				hwyCounter.Done(hwyStart, len(v), hwy.SliceBytes(v))
+				return hwyR0
+			}
+		}
+	})
+}
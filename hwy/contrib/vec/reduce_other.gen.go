@@ -168,6 +168,18 @@ func Sum[T hwy.Floats](v []T) T {
 
 func init() {
 	initReduceAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "vec",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Max", Vars: []any{&MaxFloat32, &MaxFloat64, &MaxInt32, &MaxInt64, &MaxUint32, &MaxUint64}},
+			{Name: "Min", Vars: []any{&MinFloat16, &MinBFloat16, &MinFloat32, &MinFloat64}},
+			{Name: "MinMax", Vars: []any{&MinMaxFloat16, &MinMaxBFloat16, &MinMaxFloat32, &MinMaxFloat64}},
+			{Name: "Sum", Vars: []any{&SumFloat16, &SumBFloat16, &SumFloat32, &SumFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "fallback", Supported: true, Init: initReduceFallback},
+		},
+	})
 }
 
 func initReduceAll() {
@@ -1101,6 +1101,47 @@ func TestDot_Commutativity(t *testing.T) {
 // Batch Operations Tests
 // ============================================================================
 
+func TestKernelHandles(t *testing.T) {
+	a := makeVector32(37, func(i int) float32 { return float32(i%7) - 3 })
+	c := makeVector32(37, func(i int) float32 { return float32(i%5) + 0.5 })
+	if got, want := DotKernel[float32]()(a, c), Dot(a, c); got != want {
+		t.Errorf("DotKernel = %v, want %v", got, want)
+	}
+	if got, want := L2SquaredDistanceKernel[float32]()(a, c), L2SquaredDistance(a, c); got != want {
+		t.Errorf("L2SquaredDistanceKernel = %v, want %v", got, want)
+	}
+	if got, want := L2DistanceKernel[float32]()(a, c), L2Distance(a, c); got != want {
+		t.Errorf("L2DistanceKernel = %v, want %v", got, want)
+	}
+	if got, want := SquaredNormKernel[float32]()(a), SquaredNorm(a); got != want {
+		t.Errorf("SquaredNormKernel = %v, want %v", got, want)
+	}
+
+	a64 := makeVector64(37, func(i int) float64 { return float64(i%7) - 3 })
+	if got, want := NormKernel[float64]()(a64), Norm(a64); got != want {
+		t.Errorf("NormKernel = %v, want %v", got, want)
+	}
+
+	const count, dims = 5, 13
+	data := makeVector32(count*dims, func(i int) float32 { return float32(i % 11) })
+	want := make([]float32, count)
+	got := make([]float32, count)
+	BatchDot(a[:dims], data, want, count, dims)
+	BatchDotKernel[float32]()(a[:dims], data, got, count, dims)
+	for i := range count {
+		if got[i] != want[i] {
+			t.Errorf("BatchDotKernel[%d] = %v, want %v", i, got[i], want[i])
+		}
+	}
+	BatchL2SquaredDistance(a[:dims], data, want, count, dims)
+	BatchL2SquaredDistanceKernel[float32]()(a[:dims], data, got, count, dims)
+	for i := range count {
+		if got[i] != want[i] {
+			t.Errorf("BatchL2SquaredDistanceKernel[%d] = %v, want %v", i, got[i], want[i])
+		}
+	}
+}
+
 func TestBaseBatchL2SquaredDistance(t *testing.T) {
 	t.Run("single vector", func(t *testing.T) {
 		query := []float32{1, 2, 3}
@@ -1397,6 +1438,84 @@ func BenchmarkL2SquaredDistance(b *testing.B) {
 	}
 }
 
+// BenchmarkDotHandle measures the per-call dispatch overhead on short
+// vectors: the generic Dot and L2SquaredDistance, handles resolved once,
+// and the batched entry points scoring the same rows in one call. The empty
+// case isolates the cost of dispatch itself, since the kernels return
+// immediately; the dims cases score 256 rows and report ns/row.
+func BenchmarkDotHandle(b *testing.B) {
+	b.Run("Dot/empty", func(b *testing.B) {
+		var a []float32
+		for i := 0; i < b.N; i++ {
+			_ = Dot(a, a)
+		}
+	})
+	b.Run("DotKernel/empty", func(b *testing.B) {
+		var a []float32
+		dot := DotKernel[float32]()
+		for i := 0; i < b.N; i++ {
+			_ = dot(a, a)
+		}
+	})
+
+	const rows = 256
+	perRow := func(b *testing.B) {
+		b.ReportMetric(float64(b.Elapsed().Nanoseconds())/float64(b.N*rows), "ns/row")
+	}
+	for _, dims := range []int{32, 64, 128} {
+		query := makeVector32(dims, func(i int) float32 { return float32(i) })
+		data := makeVector32(rows*dims, func(i int) float32 { return float32(i % 17) })
+		scores := make([]float32, rows)
+
+		b.Run(fmt.Sprintf("Dot/dims_%d", dims), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				for r := range rows {
+					scores[r] = Dot(query, data[r*dims:(r+1)*dims])
+				}
+			}
+			perRow(b)
+		})
+		b.Run(fmt.Sprintf("DotKernel/dims_%d", dims), func(b *testing.B) {
+			dot := DotKernel[float32]()
+			for i := 0; i < b.N; i++ {
+				for r := range rows {
+					scores[r] = dot(query, data[r*dims:(r+1)*dims])
+				}
+			}
+			perRow(b)
+		})
+		b.Run(fmt.Sprintf("BatchDot/dims_%d", dims), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				BatchDot(query, data, scores, rows, dims)
+			}
+			perRow(b)
+		})
+		b.Run(fmt.Sprintf("L2SquaredDistance/dims_%d", dims), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				for r := range rows {
+					scores[r] = L2SquaredDistance(query, data[r*dims:(r+1)*dims])
+				}
+			}
+			perRow(b)
+		})
+		b.Run(fmt.Sprintf("L2SquaredDistanceKernel/dims_%d", dims), func(b *testing.B) {
+			l2 := L2SquaredDistanceKernel[float32]()
+			for i := 0; i < b.N; i++ {
+				for r := range rows {
+					scores[r] = l2(query, data[r*dims:(r+1)*dims])
+				}
+			}
+			perRow(b)
+		})
+		b.Run(fmt.Sprintf("BatchL2SquaredDistance/dims_%d", dims), func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				BatchL2SquaredDistance(query, data, scores, rows, dims)
+			}
+			perRow(b)
+		})
+	}
+}
+
 func BenchmarkSum(b *testing.B) {
 	sizes := []int{16, 64, 256, 512, 1024, 4096}
 
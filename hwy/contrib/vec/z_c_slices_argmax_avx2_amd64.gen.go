@@ -0,0 +1,110 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package vec
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec/asm"
+)
+
+func init() {
+	initArgmaxAvx2CAsm()
+}
+
+func initArgmaxAvx2CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX2() {
+		return
+	}
+	ArgmaxFloat32 = argmaxAVX2AsmF32
+	ArgmaxFloat64 = argmaxAVX2AsmF64
+	ArgminFloat32 = argminAVX2AsmF32
+	ArgminFloat64 = argminAVX2AsmF64
+}
+
+func argmaxAVX2AsmF32(v []float32) int {
+	if len(v) == 0 {
+		panic("vec: Argmax called on empty slice")
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseArgmax_fallback(v)
+	}
+	var out_result int64
+	asm.Argmax_AVX2_F32(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return int(out_result)
+}
+
+func argmaxAVX2AsmF64(v []float64) int {
+	if len(v) == 0 {
+		panic("vec: Argmax called on empty slice")
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseArgmax_fallback_Float64(v)
+	}
+	var out_result int64
+	asm.Argmax_AVX2_F64(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return int(out_result)
+}
+
+func argminAVX2AsmF32(v []float32) int {
+	if len(v) == 0 {
+		panic("vec: Argmin called on empty slice")
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseArgmin_fallback(v)
+	}
+	var out_result int64
+	asm.Argmin_AVX2_F32(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return int(out_result)
+}
+
+func argminAVX2AsmF64(v []float64) int {
+	if len(v) == 0 {
+		panic("vec: Argmin called on empty slice")
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseArgmin_fallback_Float64(v)
+	}
+	var out_result int64
+	asm.Argmin_AVX2_F64(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return int(out_result)
+}
@@ -21,7 +21,7 @@ func argmaxAsmF16(v []hwy.Float16) int {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseArgmax_fallback_Float16(v)
 	}
 	var out_result int64
 	asm.Argmax_F16(
@@ -42,7 +42,7 @@ func argmaxAsmBF16(v []hwy.BFloat16) int {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseArgmax_fallback_BFloat16(v)
 	}
 	var out_result int64
 	asm.Argmax_BF16(
@@ -63,7 +63,7 @@ func argmaxAsmF32(v []float32) int {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseArgmax_fallback(v)
 	}
 	var out_result int64
 	asm.Argmax_F32(
@@ -84,7 +84,7 @@ func argmaxAsmF64(v []float64) int {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseArgmax_fallback_Float64(v)
 	}
 	var out_result int64
 	asm.Argmax_F64(
@@ -105,7 +105,7 @@ func argminAsmF16(v []hwy.Float16) int {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseArgmin_fallback_Float16(v)
 	}
 	var out_result int64
 	asm.Argmin_F16(
@@ -126,7 +126,7 @@ func argminAsmBF16(v []hwy.BFloat16) int {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseArgmin_fallback_BFloat16(v)
 	}
 	var out_result int64
 	asm.Argmin_BF16(
@@ -147,7 +147,7 @@ func argminAsmF32(v []float32) int {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseArgmin_fallback(v)
 	}
 	var out_result int64
 	asm.Argmin_F32(
@@ -168,7 +168,7 @@ func argminAsmF64(v []float64) int {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseArgmin_fallback_Float64(v)
 	}
 	var out_result int64
 	asm.Argmin_F64(
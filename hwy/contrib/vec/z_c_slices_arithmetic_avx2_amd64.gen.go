@@ -0,0 +1,562 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package vec
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec/asm"
+)
+
+func init() {
+	initArithmeticAvx2CAsm()
+}
+
+func initArithmeticAvx2CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX2() {
+		return
+	}
+	AddFloat32 = addAVX2AsmF32
+	AddFloat64 = addAVX2AsmF64
+	AddConstFloat32 = addConstAVX2AsmF32
+	AddConstFloat64 = addConstAVX2AsmF64
+	AddToFloat32 = addToAVX2AsmF32
+	AddToFloat64 = addToAVX2AsmF64
+	DivFloat32 = divAVX2AsmF32
+	DivFloat64 = divAVX2AsmF64
+	DivToFloat32 = divToAVX2AsmF32
+	DivToFloat64 = divToAVX2AsmF64
+	MulFloat32 = mulAVX2AsmF32
+	MulFloat64 = mulAVX2AsmF64
+	MulConstAddToFloat32 = mulConstAddToAVX2AsmF32
+	MulConstAddToFloat64 = mulConstAddToAVX2AsmF64
+	MulToFloat32 = mulToAVX2AsmF32
+	MulToFloat64 = mulToAVX2AsmF64
+	ScaleFloat32 = scaleAVX2AsmF32
+	ScaleFloat64 = scaleAVX2AsmF64
+	ScaleToFloat32 = scaleToAVX2AsmF32
+	ScaleToFloat64 = scaleToAVX2AsmF64
+	SubFloat32 = subAVX2AsmF32
+	SubFloat64 = subAVX2AsmF64
+	SubToFloat32 = subToAVX2AsmF32
+	SubToFloat64 = subToAVX2AsmF64
+}
+
+func addAVX2AsmF32(dst, s []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Add_AVX2_F32(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func addAVX2AsmF64(dst, s []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Add_AVX2_F64(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func addConstAVX2AsmF32(c float32, dst []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	cVal := c
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	asm.AddConst_AVX2_F32(
+		unsafe.Pointer(&cVal),
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func addConstAVX2AsmF64(c float64, dst []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	cVal := c
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	asm.AddConst_AVX2_F64(
+		unsafe.Pointer(&cVal),
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func addToAVX2AsmF32(dst, a, b []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.AddTo_AVX2_F32(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func addToAVX2AsmF64(dst, a, b []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.AddTo_AVX2_F64(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func divAVX2AsmF32(dst, s []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Div_AVX2_F32(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func divAVX2AsmF64(dst, s []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Div_AVX2_F64(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func divToAVX2AsmF32(dst, a, b []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.DivTo_AVX2_F32(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func divToAVX2AsmF64(dst, a, b []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.DivTo_AVX2_F64(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func mulAVX2AsmF32(dst, s []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Mul_AVX2_F32(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func mulAVX2AsmF64(dst, s []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Mul_AVX2_F64(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func mulConstAddToAVX2AsmF32(dst []float32, a float32, x []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	aVal := a
+	lenVal := int64(min(len(dst), len(x)))
+	if lenVal == 0 {
+		return
+	}
+	asm.MulConstAddTo_AVX2_F32(
+		p_dst,
+		unsafe.Pointer(&aVal),
+		p_x,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func mulConstAddToAVX2AsmF64(dst []float64, a float64, x []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	aVal := a
+	lenVal := int64(min(len(dst), len(x)))
+	if lenVal == 0 {
+		return
+	}
+	asm.MulConstAddTo_AVX2_F64(
+		p_dst,
+		unsafe.Pointer(&aVal),
+		p_x,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func mulToAVX2AsmF32(dst, a, b []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.MulTo_AVX2_F32(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func mulToAVX2AsmF64(dst, a, b []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.MulTo_AVX2_F64(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func scaleAVX2AsmF32(c float32, dst []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	cVal := c
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	asm.Scale_AVX2_F32(
+		unsafe.Pointer(&cVal),
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func scaleAVX2AsmF64(c float64, dst []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	cVal := c
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	asm.Scale_AVX2_F64(
+		unsafe.Pointer(&cVal),
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func scaleToAVX2AsmF32(dst []float32, c float32, s []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	cVal := c
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.ScaleTo_AVX2_F32(
+		p_dst,
+		unsafe.Pointer(&cVal),
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func scaleToAVX2AsmF64(dst []float64, c float64, s []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	cVal := c
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.ScaleTo_AVX2_F64(
+		p_dst,
+		unsafe.Pointer(&cVal),
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func subAVX2AsmF32(dst, s []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Sub_AVX2_F32(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func subAVX2AsmF64(dst, s []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Sub_AVX2_F64(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func subToAVX2AsmF32(dst, a, b []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.SubTo_AVX2_F32(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func subToAVX2AsmF64(dst, a, b []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.SubTo_AVX2_F64(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
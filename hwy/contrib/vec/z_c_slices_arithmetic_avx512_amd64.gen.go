@@ -0,0 +1,562 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package vec
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec/asm"
+)
+
+func init() {
+	initArithmeticAvx512CAsm()
+}
+
+func initArithmeticAvx512CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX512() {
+		return
+	}
+	AddFloat32 = addAVX512AsmF32
+	AddFloat64 = addAVX512AsmF64
+	AddConstFloat32 = addConstAVX512AsmF32
+	AddConstFloat64 = addConstAVX512AsmF64
+	AddToFloat32 = addToAVX512AsmF32
+	AddToFloat64 = addToAVX512AsmF64
+	DivFloat32 = divAVX512AsmF32
+	DivFloat64 = divAVX512AsmF64
+	DivToFloat32 = divToAVX512AsmF32
+	DivToFloat64 = divToAVX512AsmF64
+	MulFloat32 = mulAVX512AsmF32
+	MulFloat64 = mulAVX512AsmF64
+	MulConstAddToFloat32 = mulConstAddToAVX512AsmF32
+	MulConstAddToFloat64 = mulConstAddToAVX512AsmF64
+	MulToFloat32 = mulToAVX512AsmF32
+	MulToFloat64 = mulToAVX512AsmF64
+	ScaleFloat32 = scaleAVX512AsmF32
+	ScaleFloat64 = scaleAVX512AsmF64
+	ScaleToFloat32 = scaleToAVX512AsmF32
+	ScaleToFloat64 = scaleToAVX512AsmF64
+	SubFloat32 = subAVX512AsmF32
+	SubFloat64 = subAVX512AsmF64
+	SubToFloat32 = subToAVX512AsmF32
+	SubToFloat64 = subToAVX512AsmF64
+}
+
+func addAVX512AsmF32(dst, s []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Add_AVX512_F32(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func addAVX512AsmF64(dst, s []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Add_AVX512_F64(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func addConstAVX512AsmF32(c float32, dst []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	cVal := c
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	asm.AddConst_AVX512_F32(
+		unsafe.Pointer(&cVal),
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func addConstAVX512AsmF64(c float64, dst []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	cVal := c
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	asm.AddConst_AVX512_F64(
+		unsafe.Pointer(&cVal),
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func addToAVX512AsmF32(dst, a, b []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.AddTo_AVX512_F32(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func addToAVX512AsmF64(dst, a, b []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.AddTo_AVX512_F64(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func divAVX512AsmF32(dst, s []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Div_AVX512_F32(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func divAVX512AsmF64(dst, s []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Div_AVX512_F64(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func divToAVX512AsmF32(dst, a, b []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.DivTo_AVX512_F32(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func divToAVX512AsmF64(dst, a, b []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.DivTo_AVX512_F64(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func mulAVX512AsmF32(dst, s []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Mul_AVX512_F32(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func mulAVX512AsmF64(dst, s []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Mul_AVX512_F64(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func mulConstAddToAVX512AsmF32(dst []float32, a float32, x []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	aVal := a
+	lenVal := int64(min(len(dst), len(x)))
+	if lenVal == 0 {
+		return
+	}
+	asm.MulConstAddTo_AVX512_F32(
+		p_dst,
+		unsafe.Pointer(&aVal),
+		p_x,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func mulConstAddToAVX512AsmF64(dst []float64, a float64, x []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_x unsafe.Pointer
+	if len(x) > 0 {
+		p_x = unsafe.Pointer(&x[0])
+	}
+	aVal := a
+	lenVal := int64(min(len(dst), len(x)))
+	if lenVal == 0 {
+		return
+	}
+	asm.MulConstAddTo_AVX512_F64(
+		p_dst,
+		unsafe.Pointer(&aVal),
+		p_x,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func mulToAVX512AsmF32(dst, a, b []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.MulTo_AVX512_F32(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func mulToAVX512AsmF64(dst, a, b []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.MulTo_AVX512_F64(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func scaleAVX512AsmF32(c float32, dst []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	cVal := c
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	asm.Scale_AVX512_F32(
+		unsafe.Pointer(&cVal),
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func scaleAVX512AsmF64(c float64, dst []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	cVal := c
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	asm.Scale_AVX512_F64(
+		unsafe.Pointer(&cVal),
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func scaleToAVX512AsmF32(dst []float32, c float32, s []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	cVal := c
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.ScaleTo_AVX512_F32(
+		p_dst,
+		unsafe.Pointer(&cVal),
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func scaleToAVX512AsmF64(dst []float64, c float64, s []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	cVal := c
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.ScaleTo_AVX512_F64(
+		p_dst,
+		unsafe.Pointer(&cVal),
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func subAVX512AsmF32(dst, s []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Sub_AVX512_F32(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func subAVX512AsmF64(dst, s []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_s unsafe.Pointer
+	if len(s) > 0 {
+		p_s = unsafe.Pointer(&s[0])
+	}
+	lenVal := int64(min(len(dst), len(s)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Sub_AVX512_F64(
+		p_dst,
+		p_s,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func subToAVX512AsmF32(dst, a, b []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.SubTo_AVX512_F32(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func subToAVX512AsmF64(dst, a, b []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(dst), min(len(a), len(b))))
+	if lenVal == 0 {
+		return
+	}
+	asm.SubTo_AVX512_F64(
+		p_dst,
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+	)
+}
@@ -0,0 +1,64 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package vec
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec/asm"
+)
+
+func init() {
+	initCopyAvx2CAsm()
+}
+
+func initCopyAvx2CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX2() {
+		return
+	}
+	CopyFloat32 = copyAVX2AsmF32
+	CopyFloat64 = copyAVX2AsmF64
+}
+
+func copyAVX2AsmF32(dst, src []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_src unsafe.Pointer
+	if len(src) > 0 {
+		p_src = unsafe.Pointer(&src[0])
+	}
+	lenVal := int64(min(len(dst), len(src)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Copy_AVX2_F32(
+		p_dst,
+		p_src,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func copyAVX2AsmF64(dst, src []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_src unsafe.Pointer
+	if len(src) > 0 {
+		p_src = unsafe.Pointer(&src[0])
+	}
+	lenVal := int64(min(len(dst), len(src)))
+	if lenVal == 0 {
+		return
+	}
+	asm.Copy_AVX2_F64(
+		p_dst,
+		p_src,
+		unsafe.Pointer(&lenVal),
+	)
+}
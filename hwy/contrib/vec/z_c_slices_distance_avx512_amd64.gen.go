@@ -0,0 +1,118 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package vec
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec/asm"
+)
+
+func init() {
+	initDistanceAvx512CAsm()
+}
+
+func initDistanceAvx512CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX512() {
+		return
+	}
+	L2DistanceFloat32 = l2DistanceAVX512AsmF32
+	L2DistanceFloat64 = l2DistanceAVX512AsmF64
+	L2SquaredDistanceFloat32 = l2SquaredDistanceAVX512AsmF32
+	L2SquaredDistanceFloat64 = l2SquaredDistanceAVX512AsmF64
+}
+
+func l2DistanceAVX512AsmF32(a, b []float32) float32 {
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(len(a))
+	if lenVal == 0 {
+		return BaseL2Distance_fallback(a, b)
+	}
+	var out_result float32
+	asm.L2Distance_AVX512_F32(
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+func l2DistanceAVX512AsmF64(a, b []float64) float64 {
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(len(a))
+	if lenVal == 0 {
+		return BaseL2Distance_fallback_Float64(a, b)
+	}
+	var out_result float64
+	asm.L2Distance_AVX512_F64(
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
+
+func l2SquaredDistanceAVX512AsmF32(a, b []float32) float32 {
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(a), len(b)))
+	if lenVal == 0 {
+		return BaseL2SquaredDistance_fallback(a, b)
+	}
+	var out_result float32
+	asm.L2SquaredDistance_AVX512_F32(
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+func l2SquaredDistanceAVX512AsmF64(a, b []float64) float64 {
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(a), len(b)))
+	if lenVal == 0 {
+		return BaseL2SquaredDistance_fallback_Float64(a, b)
+	}
+	var out_result float64
+	asm.L2SquaredDistance_AVX512_F64(
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
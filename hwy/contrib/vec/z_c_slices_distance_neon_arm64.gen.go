@@ -22,7 +22,7 @@ func l2DistanceAsmF16(a, b []hwy.Float16) hwy.Float16 {
 	}
 	lenVal := int64(len(a))
 	if lenVal == 0 {
-		return 0
+		return BaseL2Distance_fallback_Float16(a, b)
 	}
 	var out_result int64
 	asm.L2Distance_F16(
@@ -45,7 +45,7 @@ func l2DistanceAsmBF16(a, b []hwy.BFloat16) hwy.BFloat16 {
 	}
 	lenVal := int64(len(a))
 	if lenVal == 0 {
-		return 0
+		return BaseL2Distance_fallback_BFloat16(a, b)
 	}
 	var out_result int64
 	asm.L2Distance_BF16(
@@ -68,7 +68,7 @@ func l2DistanceAsmF32(a, b []float32) float32 {
 	}
 	lenVal := int64(len(a))
 	if lenVal == 0 {
-		return 0
+		return BaseL2Distance_fallback(a, b)
 	}
 	var out_result float32
 	asm.L2Distance_F32(
@@ -91,7 +91,7 @@ func l2DistanceAsmF64(a, b []float64) float64 {
 	}
 	lenVal := int64(len(a))
 	if lenVal == 0 {
-		return 0
+		return BaseL2Distance_fallback_Float64(a, b)
 	}
 	var out_result float64
 	asm.L2Distance_F64(
@@ -114,7 +114,7 @@ func l2SquaredDistanceAsmF16(a, b []hwy.Float16) hwy.Float16 {
 	}
 	lenVal := int64(min(len(a), len(b)))
 	if lenVal == 0 {
-		return 0
+		return BaseL2SquaredDistance_fallback_Float16(a, b)
 	}
 	var out_result int64
 	asm.L2SquaredDistance_F16(
@@ -137,7 +137,7 @@ func l2SquaredDistanceAsmBF16(a, b []hwy.BFloat16) hwy.BFloat16 {
 	}
 	lenVal := int64(min(len(a), len(b)))
 	if lenVal == 0 {
-		return 0
+		return BaseL2SquaredDistance_fallback_BFloat16(a, b)
 	}
 	var out_result int64
 	asm.L2SquaredDistance_BF16(
@@ -160,7 +160,7 @@ func l2SquaredDistanceAsmF32(a, b []float32) float32 {
 	}
 	lenVal := int64(min(len(a), len(b)))
 	if lenVal == 0 {
-		return 0
+		return BaseL2SquaredDistance_fallback(a, b)
 	}
 	var out_result float32
 	asm.L2SquaredDistance_F32(
@@ -183,7 +183,7 @@ func l2SquaredDistanceAsmF64(a, b []float64) float64 {
 	}
 	lenVal := int64(min(len(a), len(b)))
 	if lenVal == 0 {
-		return 0
+		return BaseL2SquaredDistance_fallback_Float64(a, b)
 	}
 	var out_result float64
 	asm.L2SquaredDistance_F64(
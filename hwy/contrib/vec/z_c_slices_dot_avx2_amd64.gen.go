@@ -0,0 +1,70 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package vec
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec/asm"
+)
+
+func init() {
+	initDotAvx2CAsm()
+}
+
+func initDotAvx2CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX2() {
+		return
+	}
+	DotFloat32 = dotAVX2AsmF32
+	DotFloat64 = dotAVX2AsmF64
+}
+
+func dotAVX2AsmF32(a, b []float32) float32 {
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(a), len(b)))
+	if lenVal == 0 {
+		return BaseDot_fallback(a, b)
+	}
+	var out_result float32
+	asm.Dot_AVX2_F32(
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+func dotAVX2AsmF64(a, b []float64) float64 {
+	var p_a unsafe.Pointer
+	if len(a) > 0 {
+		p_a = unsafe.Pointer(&a[0])
+	}
+	var p_b unsafe.Pointer
+	if len(b) > 0 {
+		p_b = unsafe.Pointer(&b[0])
+	}
+	lenVal := int64(min(len(a), len(b)))
+	if lenVal == 0 {
+		return BaseDot_fallback_Float64(a, b)
+	}
+	var out_result float64
+	asm.Dot_AVX2_F64(
+		p_a,
+		p_b,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
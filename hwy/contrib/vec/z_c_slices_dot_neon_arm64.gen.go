@@ -22,7 +22,7 @@ func dotAsmF16(a, b []hwy.Float16) hwy.Float16 {
 	}
 	lenVal := int64(min(len(a), len(b)))
 	if lenVal == 0 {
-		return 0
+		return BaseDot_fallback_Float16(a, b)
 	}
 	var out_result int64
 	asm.Dot_F16(
@@ -45,7 +45,7 @@ func dotAsmBF16(a, b []hwy.BFloat16) hwy.BFloat16 {
 	}
 	lenVal := int64(min(len(a), len(b)))
 	if lenVal == 0 {
-		return 0
+		return BaseDot_fallback_BFloat16(a, b)
 	}
 	var out_result int64
 	asm.Dot_BF16(
@@ -68,7 +68,7 @@ func dotAsmF32(a, b []float32) float32 {
 	}
 	lenVal := int64(min(len(a), len(b)))
 	if lenVal == 0 {
-		return 0
+		return BaseDot_fallback(a, b)
 	}
 	var out_result float32
 	asm.Dot_F32(
@@ -91,7 +91,7 @@ func dotAsmF64(a, b []float64) float64 {
 	}
 	lenVal := int64(min(len(a), len(b)))
 	if lenVal == 0 {
-		return 0
+		return BaseDot_fallback_Float64(a, b)
 	}
 	var out_result float64
 	asm.Dot_F64(
@@ -21,7 +21,7 @@ func dotIntAsmS8(a, b []int8) int32 {
 	}
 	lenVal := int64(min(len(a), len(b)))
 	if lenVal == 0 {
-		return 0
+		return BaseDotInt_fallback_Int8(a, b)
 	}
 	var out_result int64
 	asm.DotInt_S8(
@@ -44,7 +44,7 @@ func dotIntAsmU8(a, b []byte) int32 {
 	}
 	lenVal := int64(min(len(a), len(b)))
 	if lenVal == 0 {
-		return 0
+		return BaseDotInt_fallback_Uint8(a, b)
 	}
 	var out_result int64
 	asm.DotInt_U8(
@@ -0,0 +1,98 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package vec
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec/asm"
+)
+
+func init() {
+	initNormAvx512CAsm()
+}
+
+func initNormAvx512CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX512() {
+		return
+	}
+	NormFloat32 = normAVX512AsmF32
+	NormFloat64 = normAVX512AsmF64
+	SquaredNormFloat32 = squaredNormAVX512AsmF32
+	SquaredNormFloat64 = squaredNormAVX512AsmF64
+}
+
+func normAVX512AsmF32(v []float32) float32 {
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseNorm_fallback(v)
+	}
+	var out_result float32
+	asm.Norm_AVX512_F32(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+func normAVX512AsmF64(v []float64) float64 {
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseNorm_fallback_Float64(v)
+	}
+	var out_result float64
+	asm.Norm_AVX512_F64(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
+
+func squaredNormAVX512AsmF32(v []float32) float32 {
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseSquaredNorm_fallback(v)
+	}
+	var out_result float32
+	asm.SquaredNorm_AVX512_F32(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+func squaredNormAVX512AsmF64(v []float64) float64 {
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseSquaredNorm_fallback_Float64(v)
+	}
+	var out_result float64
+	asm.SquaredNorm_AVX512_F64(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
@@ -18,7 +18,7 @@ func normAsmF16(v []hwy.Float16) hwy.Float16 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseNorm_fallback_Float16(v)
 	}
 	var out_result int64
 	asm.Norm_F16(
@@ -36,7 +36,7 @@ func normAsmBF16(v []hwy.BFloat16) hwy.BFloat16 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseNorm_fallback_BFloat16(v)
 	}
 	var out_result int64
 	asm.Norm_BF16(
@@ -54,7 +54,7 @@ func normAsmF32(v []float32) float32 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseNorm_fallback(v)
 	}
 	var out_result float32
 	asm.Norm_F32(
@@ -72,7 +72,7 @@ func normAsmF64(v []float64) float64 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseNorm_fallback_Float64(v)
 	}
 	var out_result float64
 	asm.Norm_F64(
@@ -90,7 +90,7 @@ func squaredNormAsmF16(v []hwy.Float16) hwy.Float16 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseSquaredNorm_fallback_Float16(v)
 	}
 	var out_result int64
 	asm.SquaredNorm_F16(
@@ -108,7 +108,7 @@ func squaredNormAsmBF16(v []hwy.BFloat16) hwy.BFloat16 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseSquaredNorm_fallback_BFloat16(v)
 	}
 	var out_result int64
 	asm.SquaredNorm_BF16(
@@ -126,7 +126,7 @@ func squaredNormAsmF32(v []float32) float32 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseSquaredNorm_fallback(v)
 	}
 	var out_result float32
 	asm.SquaredNorm_F32(
@@ -144,7 +144,7 @@ func squaredNormAsmF64(v []float64) float64 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseSquaredNorm_fallback_Float64(v)
 	}
 	var out_result float64
 	asm.SquaredNorm_F64(
@@ -0,0 +1,96 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package vec
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec/asm"
+)
+
+func init() {
+	initNormalizeAvx512CAsm()
+}
+
+func initNormalizeAvx512CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX512() {
+		return
+	}
+	NormalizeFloat32 = normalizeAVX512AsmF32
+	NormalizeFloat64 = normalizeAVX512AsmF64
+	NormalizeToFloat32 = normalizeToAVX512AsmF32
+	NormalizeToFloat64 = normalizeToAVX512AsmF64
+}
+
+func normalizeAVX512AsmF32(dst []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	asm.Normalize_AVX512_F32(
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func normalizeAVX512AsmF64(dst []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	lenVal := int64(len(dst))
+	if lenVal == 0 {
+		return
+	}
+	asm.Normalize_AVX512_F64(
+		p_dst,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func normalizeToAVX512AsmF32(dst, src []float32) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_src unsafe.Pointer
+	if len(src) > 0 {
+		p_src = unsafe.Pointer(&src[0])
+	}
+	lenVal := int64(min(len(dst), len(src)))
+	if lenVal == 0 {
+		return
+	}
+	asm.NormalizeTo_AVX512_F32(
+		p_dst,
+		p_src,
+		unsafe.Pointer(&lenVal),
+	)
+}
+
+func normalizeToAVX512AsmF64(dst, src []float64) {
+	var p_dst unsafe.Pointer
+	if len(dst) > 0 {
+		p_dst = unsafe.Pointer(&dst[0])
+	}
+	var p_src unsafe.Pointer
+	if len(src) > 0 {
+		p_src = unsafe.Pointer(&src[0])
+	}
+	lenVal := int64(min(len(dst), len(src)))
+	if lenVal == 0 {
+		return
+	}
+	asm.NormalizeTo_AVX512_F64(
+		p_dst,
+		p_src,
+		unsafe.Pointer(&lenVal),
+	)
+}
@@ -0,0 +1,196 @@
+//go:build !noasm && amd64
+
+// Code generated by hwygen -c. DO NOT EDIT.
+
+package vec
+
+import (
+	"unsafe"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/vec/asm"
+)
+
+func init() {
+	initReduceAvx2CAsm()
+}
+
+func initReduceAvx2CAsm() {
+	if hwy.NoSimdEnv() || !hwy.HasAVX2() {
+		return
+	}
+	MaxFloat32 = maxAVX2AsmF32
+	MaxFloat64 = maxAVX2AsmF64
+	MinFloat32 = minAVX2AsmF32
+	MinFloat64 = minAVX2AsmF64
+	MinMaxFloat32 = minMaxAVX2AsmF32
+	MinMaxFloat64 = minMaxAVX2AsmF64
+	SumFloat32 = sumAVX2AsmF32
+	SumFloat64 = sumAVX2AsmF64
+}
+
+func maxAVX2AsmF32(v []float32) float32 {
+	if len(v) == 0 {
+		panic("vec: Max called on empty slice")
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseMax_fallback(v)
+	}
+	var out_result float32
+	asm.Max_AVX2_F32(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+func maxAVX2AsmF64(v []float64) float64 {
+	if len(v) == 0 {
+		panic("vec: Max called on empty slice")
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseMax_fallback_Float64(v)
+	}
+	var out_result float64
+	asm.Max_AVX2_F64(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
+
+func minAVX2AsmF32(v []float32) float32 {
+	if len(v) == 0 {
+		panic("vec: Min called on empty slice")
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseMin_fallback(v)
+	}
+	var out_result float32
+	asm.Min_AVX2_F32(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+func minAVX2AsmF64(v []float64) float64 {
+	if len(v) == 0 {
+		panic("vec: Min called on empty slice")
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseMin_fallback_Float64(v)
+	}
+	var out_result float64
+	asm.Min_AVX2_F64(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
+
+func minMaxAVX2AsmF32(v []float32) (float32, float32) {
+	if len(v) == 0 {
+		panic("vec: MinMax called on empty slice")
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseMinMax_fallback(v)
+	}
+	var out_minVal float32
+	var out_maxVal float32
+	asm.MinMax_AVX2_F32(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_minVal),
+		unsafe.Pointer(&out_maxVal),
+	)
+	return float32(out_minVal), float32(out_maxVal)
+}
+
+func minMaxAVX2AsmF64(v []float64) (float64, float64) {
+	if len(v) == 0 {
+		panic("vec: MinMax called on empty slice")
+	}
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseMinMax_fallback_Float64(v)
+	}
+	var out_minVal float64
+	var out_maxVal float64
+	asm.MinMax_AVX2_F64(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_minVal),
+		unsafe.Pointer(&out_maxVal),
+	)
+	return float64(out_minVal), float64(out_maxVal)
+}
+
+func sumAVX2AsmF32(v []float32) float32 {
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseSum_fallback(v)
+	}
+	var out_result float32
+	asm.Sum_AVX2_F32(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float32(out_result)
+}
+
+func sumAVX2AsmF64(v []float64) float64 {
+	var p_v unsafe.Pointer
+	if len(v) > 0 {
+		p_v = unsafe.Pointer(&v[0])
+	}
+	lenVal := int64(len(v))
+	if lenVal == 0 {
+		return BaseSum_fallback_Float64(v)
+	}
+	var out_result float64
+	asm.Sum_AVX2_F64(
+		p_v,
+		unsafe.Pointer(&lenVal),
+		unsafe.Pointer(&out_result),
+	)
+	return float64(out_result)
+}
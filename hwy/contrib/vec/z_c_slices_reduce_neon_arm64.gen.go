@@ -21,7 +21,7 @@ func maxAsmF32(v []float32) float32 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseMax_fallback(v)
 	}
 	var out_result float32
 	asm.Max_F32(
@@ -42,7 +42,7 @@ func maxAsmF64(v []float64) float64 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseMax_fallback_Float64(v)
 	}
 	var out_result float64
 	asm.Max_F64(
@@ -63,7 +63,7 @@ func maxAsmS32(v []int32) int32 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseMax_fallback_Int32(v)
 	}
 	var out_result int64
 	asm.Max_S32(
@@ -84,7 +84,7 @@ func maxAsmS64(v []int64) int64 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseMax_fallback_Int64(v)
 	}
 	var out_result int64
 	asm.Max_S64(
@@ -105,7 +105,7 @@ func maxAsmU32(v []uint32) uint32 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseMax_fallback_Uint32(v)
 	}
 	var out_result int64
 	asm.Max_U32(
@@ -126,7 +126,7 @@ func maxAsmU64(v []uint64) uint64 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseMax_fallback_Uint64(v)
 	}
 	var out_result int64
 	asm.Max_U64(
@@ -147,7 +147,7 @@ func minAsmF16(v []hwy.Float16) hwy.Float16 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseMin_fallback_Float16(v)
 	}
 	var out_result int64
 	asm.Min_F16(
@@ -168,7 +168,7 @@ func minAsmBF16(v []hwy.BFloat16) hwy.BFloat16 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseMin_fallback_BFloat16(v)
 	}
 	var out_result int64
 	asm.Min_BF16(
@@ -189,7 +189,7 @@ func minAsmF32(v []float32) float32 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseMin_fallback(v)
 	}
 	var out_result float32
 	asm.Min_F32(
@@ -210,7 +210,7 @@ func minAsmF64(v []float64) float64 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseMin_fallback_Float64(v)
 	}
 	var out_result float64
 	asm.Min_F64(
@@ -231,7 +231,7 @@ func minMaxAsmF16(v []hwy.Float16) (hwy.Float16, hwy.Float16) {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0, 0
+		return BaseMinMax_fallback_Float16(v)
 	}
 	var out_minVal int64
 	var out_maxVal int64
@@ -254,7 +254,7 @@ func minMaxAsmBF16(v []hwy.BFloat16) (hwy.BFloat16, hwy.BFloat16) {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0, 0
+		return BaseMinMax_fallback_BFloat16(v)
 	}
 	var out_minVal int64
 	var out_maxVal int64
@@ -277,7 +277,7 @@ func minMaxAsmF32(v []float32) (float32, float32) {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0, 0
+		return BaseMinMax_fallback(v)
 	}
 	var out_minVal float32
 	var out_maxVal float32
@@ -300,7 +300,7 @@ func minMaxAsmF64(v []float64) (float64, float64) {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0, 0
+		return BaseMinMax_fallback_Float64(v)
 	}
 	var out_minVal float64
 	var out_maxVal float64
@@ -320,7 +320,7 @@ func sumAsmF16(v []hwy.Float16) hwy.Float16 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseSum_fallback_Float16(v)
 	}
 	var out_result int64
 	asm.Sum_F16(
@@ -338,7 +338,7 @@ func sumAsmBF16(v []hwy.BFloat16) hwy.BFloat16 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseSum_fallback_BFloat16(v)
 	}
 	var out_result int64
 	asm.Sum_BF16(
@@ -356,7 +356,7 @@ func sumAsmF32(v []float32) float32 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseSum_fallback(v)
 	}
 	var out_result float32
 	asm.Sum_F32(
@@ -374,7 +374,7 @@ func sumAsmF64(v []float64) float64 {
 	}
 	lenVal := int64(len(v))
 	if lenVal == 0 {
-		return 0
+		return BaseSum_fallback_Float64(v)
 	}
 	var out_result float64
 	asm.Sum_F64(
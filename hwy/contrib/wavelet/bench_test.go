@@ -16,6 +16,8 @@ package wavelet
 
 import (
 	"testing"
+
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
 )
 
 // 1D benchmark sizes
@@ -65,6 +67,34 @@ func BenchmarkAnalyze53(b *testing.B) {
 	}
 }
 
+func BenchmarkForward2D53(b *testing.B) {
+	pool := workerpool.New(0)
+	defer pool.Close()
+
+	for _, size := range []int{256, 1024} {
+		img := testImage[int32](size, size)
+		for _, bc := range []struct {
+			name string
+			pool workerpool.Executor
+		}{{"seq", nil}, {"pool", pool}} {
+			b.Run(benchSizeName(size)+"/"+bc.name, func(b *testing.B) {
+				workers := 1
+				if bc.pool != nil {
+					workers = bc.pool.NumWorkers()
+				}
+				arena := NewArena[int32](size, size, workers)
+
+				b.ReportAllocs()
+				for b.Loop() {
+					Forward2D53(bc.pool, img, 5, 0, 0, arena)
+					Inverse2D53(bc.pool, img, 5, 0, 0, arena)
+				}
+				b.SetBytes(int64(size * size * 4 * 2))
+			})
+		}
+	}
+}
+
 func benchSizeName(size int) string {
 	switch size {
 	case 64:
@@ -0,0 +1,88 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build arm64
+
+package wavelet
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+var Analyze53CoreColsInt32 func(colBuf []int32, height int, lowBuf []int32, sn int, highBuf []int32, dn int, phase int)
+var Analyze53CoreColsInt64 func(colBuf []int64, height int, lowBuf []int64, sn int, highBuf []int64, dn int, phase int)
+var LiftStep97ColsFloat32 func(target []float32, tLen int, neighbor []float32, nLen int, coeff float32, phase int)
+var LiftStep97ColsFloat64 func(target []float64, tLen int, neighbor []float64, nLen int, coeff float64, phase int)
+
+// Analyze53CoreCols is the forward counterpart of BaseSynthesize53CoreCols:
+// it fuses Deinterleave + predict + update + copy for `lanes` columns at once.
+// colBuf uses the same column-interleaved layout (colBuf[y*lanes + c] holds
+// row y of column c).
+//
+// colBuf has height*lanes elements of interleaved rows on entry and contains
+// [low rows | high rows] on exit. lowBuf and highBuf are scratch buffers with
+// capacity >= sn*lanes and dn*lanes.
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+func Analyze53CoreCols[T hwy.SignedInts](colBuf []T, height int, lowBuf []T, sn int, highBuf []T, dn int, phase int) {
+	switch any(colBuf).(type) {
+	case []int32:
+		Analyze53CoreColsInt32(any(colBuf).([]int32), height, any(lowBuf).([]int32), sn, any(highBuf).([]int32), dn, phase)
+	case []int64:
+		Analyze53CoreColsInt64(any(colBuf).([]int64), height, any(lowBuf).([]int64), sn, any(highBuf).([]int64), dn, phase)
+	}
+}
+
+// LiftStep97Cols is BaseLiftStep97 over column-interleaved buffers:
+// target[y] -= coeff * (neighbor[off1] + neighbor[off2]) for `lanes` columns
+// at once, where row y occupies target[y*lanes : (y+1)*lanes].
+// phase=0 uses neighbor rows y, y+1; phase=1 uses y-1, y. Out-of-range
+// neighbors are clamped to the nearest valid row. Half-precision types are
+// excluded because their vector width differs from hwy.MaxLanes on AVX.
+//
+// This function dispatches to the appropriate SIMD implementation at runtime.
+func LiftStep97Cols[T hwy.FloatsNative](target []T, tLen int, neighbor []T, nLen int, coeff T, phase int) {
+	switch any(target).(type) {
+	case []float32:
+		LiftStep97ColsFloat32(any(target).([]float32), tLen, any(neighbor).([]float32), nLen, any(coeff).(float32), phase)
+	case []float64:
+		LiftStep97ColsFloat64(any(target).([]float64), tLen, any(neighbor).([]float64), nLen, any(coeff).(float64), phase)
+	}
+}
+
+func init() {
+	initColsAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "wavelet",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Analyze53CoreCols", Vars: []any{&Analyze53CoreColsInt32, &Analyze53CoreColsInt64}},
+			{Name: "LiftStep97Cols", Vars: []any{&LiftStep97ColsFloat32, &LiftStep97ColsFloat64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initColsNEON},
+			{Name: "fallback", Supported: true, Init: initColsFallback},
+		},
+	})
+}
+
+func initColsAll() {
+	if hwy.NoSimdEnv() {
+		initColsFallback()
+		return
+	}
+	initColsNEON()
+	return
+}
+
+func initColsNEON() {
+	Analyze53CoreColsInt32 = BaseAnalyze53CoreCols_neon_Int32
+	Analyze53CoreColsInt64 = BaseAnalyze53CoreCols_neon_Int64
+	LiftStep97ColsFloat32 = BaseLiftStep97Cols_neon
+	LiftStep97ColsFloat64 = BaseLiftStep97Cols_neon_Float64
+}
+
+func initColsFallback() {
+	Analyze53CoreColsInt32 = BaseAnalyze53CoreCols_fallback_Int32
+	Analyze53CoreColsInt64 = BaseAnalyze53CoreCols_fallback_Int64
+	LiftStep97ColsFloat32 = BaseLiftStep97Cols_fallback
+	LiftStep97ColsFloat64 = BaseLiftStep97Cols_fallback_Float64
+}
@@ -0,0 +1,111 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package wavelet
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+//go:generate go run ../../../cmd/hwygen -input cols_base.go -output . -targets avx2,avx512,neon,fallback -dispatch cols
+
+// BaseAnalyze53CoreCols is the forward counterpart of BaseSynthesize53CoreCols:
+// it fuses Deinterleave + predict + update + copy for `lanes` columns at once.
+// colBuf uses the same column-interleaved layout (colBuf[y*lanes + c] holds
+// row y of column c).
+//
+// colBuf has height*lanes elements of interleaved rows on entry and contains
+// [low rows | high rows] on exit. lowBuf and highBuf are scratch buffers with
+// capacity >= sn*lanes and dn*lanes.
+func BaseAnalyze53CoreCols[T hwy.SignedInts](colBuf []T, height int, lowBuf []T, sn int, highBuf []T, dn int, phase int) {
+	lanes := hwy.MaxLanes[T]()
+
+	// 1. Deinterleave rows: phase=0 puts even rows in low, phase=1 odd rows.
+	for y := range sn {
+		src := 2*y + phase
+		copy(lowBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := range dn {
+		src := 2*y + 1 - phase
+		copy(highBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+
+	// 2. Predict across columns: high[y] -= (low[off1] + low[off2]) >> 1
+	// phase=0 uses low[y], low[y+1]; phase=1 uses low[y-1], low[y].
+	for y := range dn {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = max(n1Idx, 0)
+		n2Idx = min(n2Idx, sn-1)
+		n1 := hwy.Load(lowBuf[n1Idx*lanes:])
+		n2 := hwy.Load(lowBuf[n2Idx*lanes:])
+		update := hwy.ShiftRight(hwy.Add(n1, n2), 1)
+		t := hwy.Load(highBuf[y*lanes:])
+		hwy.Store(hwy.Sub(t, update), highBuf[y*lanes:])
+	}
+
+	// 3. Update across columns: low[y] += (high[off1] + high[off2] + 2) >> 2
+	// phase=0 uses high[y-1], high[y]; phase=1 uses high[y], high[y+1].
+	if dn > 0 {
+		twoVec := hwy.Set(T(2))
+		for y := range sn {
+			n1Idx, n2Idx := y-1, y
+			if phase == 1 {
+				n1Idx, n2Idx = y, y+1
+			}
+			n1Idx = min(max(n1Idx, 0), dn-1)
+			n2Idx = min(n2Idx, dn-1)
+			n1 := hwy.Load(highBuf[n1Idx*lanes:])
+			n2 := hwy.Load(highBuf[n2Idx*lanes:])
+			update := hwy.ShiftRight(hwy.Add(hwy.Add(n1, n2), twoVec), 2)
+			t := hwy.Load(lowBuf[y*lanes:])
+			hwy.Store(hwy.Add(t, update), lowBuf[y*lanes:])
+		}
+	}
+
+	// 4. Write subbands back: rows [0..sn-1] low-pass, [sn..sn+dn-1] high-pass.
+	copy(colBuf[:sn*lanes], lowBuf[:sn*lanes])
+	copy(colBuf[sn*lanes:(sn+dn)*lanes], highBuf[:dn*lanes])
+}
+
+// BaseLiftStep97Cols is BaseLiftStep97 over column-interleaved buffers:
+// target[y] -= coeff * (neighbor[off1] + neighbor[off2]) for `lanes` columns
+// at once, where row y occupies target[y*lanes : (y+1)*lanes].
+// phase=0 uses neighbor rows y, y+1; phase=1 uses y-1, y. Out-of-range
+// neighbors are clamped to the nearest valid row. Half-precision types are
+// excluded because their vector width differs from hwy.MaxLanes on AVX.
+func BaseLiftStep97Cols[T hwy.FloatsNative](target []T, tLen int, neighbor []T, nLen int, coeff T, phase int) {
+	if tLen == 0 || nLen == 0 {
+		return
+	}
+
+	coeffVec := hwy.Set(coeff)
+	lanes := hwy.MaxLanes[T]()
+
+	for y := range tLen {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = min(max(n1Idx, 0), nLen-1)
+		n2Idx = min(n2Idx, nLen-1)
+		n1 := hwy.Load(neighbor[n1Idx*lanes:])
+		n2 := hwy.Load(neighbor[n2Idx*lanes:])
+		update := hwy.Mul(coeffVec, hwy.Add(n1, n2))
+		t := hwy.Load(target[y*lanes:])
+		hwy.Store(hwy.Sub(t, update), target[y*lanes:])
+	}
+}
@@ -0,0 +1,144 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package wavelet
+
+import (
+	"simd/archsimd"
+	"unsafe"
+)
+
+// Hoisted constants - pre-broadcasted at package init time
+var (
+	BaseAnalyze53CoreCols_AVX2_twoVec_f32     = archsimd.BroadcastInt64x4(int64(2))
+	BaseAnalyze53CoreCols_AVX2_twoVec_i32_f32 = archsimd.BroadcastInt32x8(int32(2))
+)
+
+func BaseAnalyze53CoreCols_avx2_Int32(colBuf []int32, height int, lowBuf []int32, sn int, highBuf []int32, dn int, phase int) {
+	lanes := 8
+	for y := int(0); y < int(sn); y++ {
+		src := 2*y + phase
+		copy(lowBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := int(0); y < int(dn); y++ {
+		src := 2*y + 1 - phase
+		copy(highBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := int(0); y < int(dn); y++ {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = max(n1Idx, 0)
+		n2Idx = min(n2Idx, sn-1)
+		n1 := archsimd.LoadInt32x8((*[8]int32)(unsafe.Pointer(&lowBuf[n1Idx*lanes])))
+		n2 := archsimd.LoadInt32x8((*[8]int32)(unsafe.Pointer(&lowBuf[n2Idx*lanes])))
+		update := n1.Add(n2).ShiftAllRight(uint64(1))
+		t := archsimd.LoadInt32x8((*[8]int32)(unsafe.Pointer(&highBuf[y*lanes])))
+		t.Sub(update).Store((*[8]int32)(unsafe.Pointer(&highBuf[y*lanes])))
+	}
+	if dn > 0 {
+		twoVec := BaseAnalyze53CoreCols_AVX2_twoVec_i32_f32
+		for y := int(0); y < int(sn); y++ {
+			n1Idx, n2Idx := y-1, y
+			if phase == 1 {
+				n1Idx, n2Idx = y, y+1
+			}
+			n1Idx = min(max(n1Idx, 0), dn-1)
+			n2Idx = min(n2Idx, dn-1)
+			n1 := archsimd.LoadInt32x8((*[8]int32)(unsafe.Pointer(&highBuf[n1Idx*lanes])))
+			n2 := archsimd.LoadInt32x8((*[8]int32)(unsafe.Pointer(&highBuf[n2Idx*lanes])))
+			update := n1.Add(n2).Add(twoVec).ShiftAllRight(uint64(2))
+			t := archsimd.LoadInt32x8((*[8]int32)(unsafe.Pointer(&lowBuf[y*lanes])))
+			t.Add(update).Store((*[8]int32)(unsafe.Pointer(&lowBuf[y*lanes])))
+		}
+	}
+	copy(colBuf[:sn*lanes], lowBuf[:sn*lanes])
+	copy(colBuf[sn*lanes:(sn+dn)*lanes], highBuf[:dn*lanes])
+}
+
+func BaseAnalyze53CoreCols_avx2_Int64(colBuf []int64, height int, lowBuf []int64, sn int, highBuf []int64, dn int, phase int) {
+	lanes := 4
+	for y := int(0); y < int(sn); y++ {
+		src := 2*y + phase
+		copy(lowBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := int(0); y < int(dn); y++ {
+		src := 2*y + 1 - phase
+		copy(highBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := int(0); y < int(dn); y++ {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = max(n1Idx, 0)
+		n2Idx = min(n2Idx, sn-1)
+		n1 := archsimd.LoadInt64x4((*[4]int64)(unsafe.Pointer(&lowBuf[n1Idx*lanes])))
+		n2 := archsimd.LoadInt64x4((*[4]int64)(unsafe.Pointer(&lowBuf[n2Idx*lanes])))
+		update := n1.Add(n2).ShiftAllRight(uint64(1))
+		t := archsimd.LoadInt64x4((*[4]int64)(unsafe.Pointer(&highBuf[y*lanes])))
+		t.Sub(update).Store((*[4]int64)(unsafe.Pointer(&highBuf[y*lanes])))
+	}
+	if dn > 0 {
+		twoVec := BaseAnalyze53CoreCols_AVX2_twoVec_f32
+		for y := int(0); y < int(sn); y++ {
+			n1Idx, n2Idx := y-1, y
+			if phase == 1 {
+				n1Idx, n2Idx = y, y+1
+			}
+			n1Idx = min(max(n1Idx, 0), dn-1)
+			n2Idx = min(n2Idx, dn-1)
+			n1 := archsimd.LoadInt64x4((*[4]int64)(unsafe.Pointer(&highBuf[n1Idx*lanes])))
+			n2 := archsimd.LoadInt64x4((*[4]int64)(unsafe.Pointer(&highBuf[n2Idx*lanes])))
+			update := n1.Add(n2).Add(twoVec).ShiftAllRight(uint64(2))
+			t := archsimd.LoadInt64x4((*[4]int64)(unsafe.Pointer(&lowBuf[y*lanes])))
+			t.Add(update).Store((*[4]int64)(unsafe.Pointer(&lowBuf[y*lanes])))
+		}
+	}
+	copy(colBuf[:sn*lanes], lowBuf[:sn*lanes])
+	copy(colBuf[sn*lanes:(sn+dn)*lanes], highBuf[:dn*lanes])
+}
+
+func BaseLiftStep97Cols_avx2(target []float32, tLen int, neighbor []float32, nLen int, coeff float32, phase int) {
+	if tLen == 0 || nLen == 0 {
+		return
+	}
+	coeffVec := archsimd.BroadcastFloat32x8(coeff)
+	lanes := 8
+	for y := int(0); y < int(tLen); y++ {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = min(max(n1Idx, 0), nLen-1)
+		n2Idx = min(n2Idx, nLen-1)
+		n1 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&neighbor[n1Idx*lanes])))
+		n2 := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&neighbor[n2Idx*lanes])))
+		update := coeffVec.Mul(n1.Add(n2))
+		t := archsimd.LoadFloat32x8((*[8]float32)(unsafe.Pointer(&target[y*lanes])))
+		t.Sub(update).Store((*[8]float32)(unsafe.Pointer(&target[y*lanes])))
+	}
+}
+
+func BaseLiftStep97Cols_avx2_Float64(target []float64, tLen int, neighbor []float64, nLen int, coeff float64, phase int) {
+	if tLen == 0 || nLen == 0 {
+		return
+	}
+	coeffVec := archsimd.BroadcastFloat64x4(coeff)
+	lanes := 4
+	for y := int(0); y < int(tLen); y++ {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = min(max(n1Idx, 0), nLen-1)
+		n2Idx = min(n2Idx, nLen-1)
+		n1 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&neighbor[n1Idx*lanes])))
+		n2 := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&neighbor[n2Idx*lanes])))
+		update := coeffVec.Mul(n1.Add(n2))
+		t := archsimd.LoadFloat64x4((*[4]float64)(unsafe.Pointer(&target[y*lanes])))
+		t.Sub(update).Store((*[4]float64)(unsafe.Pointer(&target[y*lanes])))
+	}
+}
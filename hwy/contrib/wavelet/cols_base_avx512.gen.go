@@ -0,0 +1,157 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build amd64 && goexperiment.simd
+
+package wavelet
+
+import (
+	"simd/archsimd"
+	"sync"
+	"unsafe"
+)
+
+// Hoisted constants - lazily initialized on first use to avoid init-time crashes
+var (
+	BaseAnalyze53CoreCols_AVX512_twoVec_f32     archsimd.Int64x8
+	BaseAnalyze53CoreCols_AVX512_twoVec_i32_f32 archsimd.Int32x16
+	_colsBaseHoistOnce                          sync.Once
+)
+
+func _colsBaseInitHoistedConstants() {
+	_colsBaseHoistOnce.Do(func() {
+		BaseAnalyze53CoreCols_AVX512_twoVec_f32 = archsimd.BroadcastInt64x8(int64(2))
+		BaseAnalyze53CoreCols_AVX512_twoVec_i32_f32 = archsimd.BroadcastInt32x16(int32(2))
+	})
+}
+
+func BaseAnalyze53CoreCols_avx512_Int32(colBuf []int32, height int, lowBuf []int32, sn int, highBuf []int32, dn int, phase int) {
+	_colsBaseInitHoistedConstants()
+	lanes := 16
+	for y := int(0); y < int(sn); y++ {
+		src := 2*y + phase
+		copy(lowBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := int(0); y < int(dn); y++ {
+		src := 2*y + 1 - phase
+		copy(highBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := int(0); y < int(dn); y++ {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = max(n1Idx, 0)
+		n2Idx = min(n2Idx, sn-1)
+		n1 := archsimd.LoadInt32x16((*[16]int32)(unsafe.Pointer(&lowBuf[n1Idx*lanes])))
+		n2 := archsimd.LoadInt32x16((*[16]int32)(unsafe.Pointer(&lowBuf[n2Idx*lanes])))
+		update := n1.Add(n2).ShiftAllRight(uint64(1))
+		t := archsimd.LoadInt32x16((*[16]int32)(unsafe.Pointer(&highBuf[y*lanes])))
+		t.Sub(update).Store((*[16]int32)(unsafe.Pointer(&highBuf[y*lanes])))
+	}
+	if dn > 0 {
+		twoVec := BaseAnalyze53CoreCols_AVX512_twoVec_i32_f32
+		for y := int(0); y < int(sn); y++ {
+			n1Idx, n2Idx := y-1, y
+			if phase == 1 {
+				n1Idx, n2Idx = y, y+1
+			}
+			n1Idx = min(max(n1Idx, 0), dn-1)
+			n2Idx = min(n2Idx, dn-1)
+			n1 := archsimd.LoadInt32x16((*[16]int32)(unsafe.Pointer(&highBuf[n1Idx*lanes])))
+			n2 := archsimd.LoadInt32x16((*[16]int32)(unsafe.Pointer(&highBuf[n2Idx*lanes])))
+			update := n1.Add(n2).Add(twoVec).ShiftAllRight(uint64(2))
+			t := archsimd.LoadInt32x16((*[16]int32)(unsafe.Pointer(&lowBuf[y*lanes])))
+			t.Add(update).Store((*[16]int32)(unsafe.Pointer(&lowBuf[y*lanes])))
+		}
+	}
+	copy(colBuf[:sn*lanes], lowBuf[:sn*lanes])
+	copy(colBuf[sn*lanes:(sn+dn)*lanes], highBuf[:dn*lanes])
+}
+
+func BaseAnalyze53CoreCols_avx512_Int64(colBuf []int64, height int, lowBuf []int64, sn int, highBuf []int64, dn int, phase int) {
+	_colsBaseInitHoistedConstants()
+	lanes := 8
+	for y := int(0); y < int(sn); y++ {
+		src := 2*y + phase
+		copy(lowBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := int(0); y < int(dn); y++ {
+		src := 2*y + 1 - phase
+		copy(highBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := int(0); y < int(dn); y++ {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = max(n1Idx, 0)
+		n2Idx = min(n2Idx, sn-1)
+		n1 := archsimd.LoadInt64x8((*[8]int64)(unsafe.Pointer(&lowBuf[n1Idx*lanes])))
+		n2 := archsimd.LoadInt64x8((*[8]int64)(unsafe.Pointer(&lowBuf[n2Idx*lanes])))
+		update := n1.Add(n2).ShiftAllRight(uint64(1))
+		t := archsimd.LoadInt64x8((*[8]int64)(unsafe.Pointer(&highBuf[y*lanes])))
+		t.Sub(update).Store((*[8]int64)(unsafe.Pointer(&highBuf[y*lanes])))
+	}
+	if dn > 0 {
+		twoVec := BaseAnalyze53CoreCols_AVX512_twoVec_f32
+		for y := int(0); y < int(sn); y++ {
+			n1Idx, n2Idx := y-1, y
+			if phase == 1 {
+				n1Idx, n2Idx = y, y+1
+			}
+			n1Idx = min(max(n1Idx, 0), dn-1)
+			n2Idx = min(n2Idx, dn-1)
+			n1 := archsimd.LoadInt64x8((*[8]int64)(unsafe.Pointer(&highBuf[n1Idx*lanes])))
+			n2 := archsimd.LoadInt64x8((*[8]int64)(unsafe.Pointer(&highBuf[n2Idx*lanes])))
+			update := n1.Add(n2).Add(twoVec).ShiftAllRight(uint64(2))
+			t := archsimd.LoadInt64x8((*[8]int64)(unsafe.Pointer(&lowBuf[y*lanes])))
+			t.Add(update).Store((*[8]int64)(unsafe.Pointer(&lowBuf[y*lanes])))
+		}
+	}
+	copy(colBuf[:sn*lanes], lowBuf[:sn*lanes])
+	copy(colBuf[sn*lanes:(sn+dn)*lanes], highBuf[:dn*lanes])
+}
+
+func BaseLiftStep97Cols_avx512(target []float32, tLen int, neighbor []float32, nLen int, coeff float32, phase int) {
+	_colsBaseInitHoistedConstants()
+	if tLen == 0 || nLen == 0 {
+		return
+	}
+	coeffVec := archsimd.BroadcastFloat32x16(coeff)
+	lanes := 16
+	for y := int(0); y < int(tLen); y++ {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = min(max(n1Idx, 0), nLen-1)
+		n2Idx = min(n2Idx, nLen-1)
+		n1 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&neighbor[n1Idx*lanes])))
+		n2 := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&neighbor[n2Idx*lanes])))
+		update := coeffVec.Mul(n1.Add(n2))
+		t := archsimd.LoadFloat32x16((*[16]float32)(unsafe.Pointer(&target[y*lanes])))
+		t.Sub(update).Store((*[16]float32)(unsafe.Pointer(&target[y*lanes])))
+	}
+}
+
+func BaseLiftStep97Cols_avx512_Float64(target []float64, tLen int, neighbor []float64, nLen int, coeff float64, phase int) {
+	_colsBaseInitHoistedConstants()
+	if tLen == 0 || nLen == 0 {
+		return
+	}
+	coeffVec := archsimd.BroadcastFloat64x8(coeff)
+	lanes := 8
+	for y := int(0); y < int(tLen); y++ {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = min(max(n1Idx, 0), nLen-1)
+		n2Idx = min(n2Idx, nLen-1)
+		n1 := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&neighbor[n1Idx*lanes])))
+		n2 := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&neighbor[n2Idx*lanes])))
+		update := coeffVec.Mul(n1.Add(n2))
+		t := archsimd.LoadFloat64x8((*[8]float64)(unsafe.Pointer(&target[y*lanes])))
+		t.Sub(update).Store((*[8]float64)(unsafe.Pointer(&target[y*lanes])))
+	}
+}
@@ -0,0 +1,135 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+package wavelet
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func BaseAnalyze53CoreCols_fallback_Int32(colBuf []int32, height int, lowBuf []int32, sn int, highBuf []int32, dn int, phase int) {
+	lanes := hwy.MaxLanes[int32]()
+	for y := int(0); y < int(sn); y++ {
+		src := 2*y + phase
+		copy(lowBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := int(0); y < int(dn); y++ {
+		src := 2*y + 1 - phase
+		copy(highBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := int(0); y < int(dn); y++ {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = max(n1Idx, 0)
+		n2Idx = min(n2Idx, sn-1)
+		n1 := hwy.Load(lowBuf[n1Idx*lanes:])
+		n2 := hwy.Load(lowBuf[n2Idx*lanes:])
+		update := hwy.ShiftRight(hwy.Add(n1, n2), 1)
+		t := hwy.Load(highBuf[y*lanes:])
+		hwy.Store(hwy.Sub(t, update), highBuf[y*lanes:])
+	}
+	if dn > 0 {
+		twoVec := hwy.Set(int32(2))
+		for y := int(0); y < int(sn); y++ {
+			n1Idx, n2Idx := y-1, y
+			if phase == 1 {
+				n1Idx, n2Idx = y, y+1
+			}
+			n1Idx = min(max(n1Idx, 0), dn-1)
+			n2Idx = min(n2Idx, dn-1)
+			n1 := hwy.Load(highBuf[n1Idx*lanes:])
+			n2 := hwy.Load(highBuf[n2Idx*lanes:])
+			update := hwy.ShiftRight(hwy.Add(hwy.Add(n1, n2), twoVec), 2)
+			t := hwy.Load(lowBuf[y*lanes:])
+			hwy.Store(hwy.Add(t, update), lowBuf[y*lanes:])
+		}
+	}
+	copy(colBuf[:sn*lanes], lowBuf[:sn*lanes])
+	copy(colBuf[sn*lanes:(sn+dn)*lanes], highBuf[:dn*lanes])
+}
+
+func BaseAnalyze53CoreCols_fallback_Int64(colBuf []int64, height int, lowBuf []int64, sn int, highBuf []int64, dn int, phase int) {
+	lanes := hwy.MaxLanes[int64]()
+	for y := int(0); y < int(sn); y++ {
+		src := 2*y + phase
+		copy(lowBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := int(0); y < int(dn); y++ {
+		src := 2*y + 1 - phase
+		copy(highBuf[y*lanes:y*lanes+lanes], colBuf[src*lanes:src*lanes+lanes])
+	}
+	for y := int(0); y < int(dn); y++ {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = max(n1Idx, 0)
+		n2Idx = min(n2Idx, sn-1)
+		n1 := hwy.Load(lowBuf[n1Idx*lanes:])
+		n2 := hwy.Load(lowBuf[n2Idx*lanes:])
+		update := hwy.ShiftRight(hwy.Add(n1, n2), 1)
+		t := hwy.Load(highBuf[y*lanes:])
+		hwy.Store(hwy.Sub(t, update), highBuf[y*lanes:])
+	}
+	if dn > 0 {
+		twoVec := hwy.Set(int64(2))
+		for y := int(0); y < int(sn); y++ {
+			n1Idx, n2Idx := y-1, y
+			if phase == 1 {
+				n1Idx, n2Idx = y, y+1
+			}
+			n1Idx = min(max(n1Idx, 0), dn-1)
+			n2Idx = min(n2Idx, dn-1)
+			n1 := hwy.Load(highBuf[n1Idx*lanes:])
+			n2 := hwy.Load(highBuf[n2Idx*lanes:])
+			update := hwy.ShiftRight(hwy.Add(hwy.Add(n1, n2), twoVec), 2)
+			t := hwy.Load(lowBuf[y*lanes:])
+			hwy.Store(hwy.Add(t, update), lowBuf[y*lanes:])
+		}
+	}
+	copy(colBuf[:sn*lanes], lowBuf[:sn*lanes])
+	copy(colBuf[sn*lanes:(sn+dn)*lanes], highBuf[:dn*lanes])
+}
+
+func BaseLiftStep97Cols_fallback(target []float32, tLen int, neighbor []float32, nLen int, coeff float32, phase int) {
+	if tLen == 0 || nLen == 0 {
+		return
+	}
+	coeffVec := hwy.Set(coeff)
+	lanes := hwy.MaxLanes[float32]()
+	for y := int(0); y < int(tLen); y++ {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = min(max(n1Idx, 0), nLen-1)
+		n2Idx = min(n2Idx, nLen-1)
+		n1 := hwy.Load(neighbor[n1Idx*lanes:])
+		n2 := hwy.Load(neighbor[n2Idx*lanes:])
+		update := hwy.Mul(coeffVec, hwy.Add(n1, n2))
+		t := hwy.Load(target[y*lanes:])
+		hwy.Store(hwy.Sub(t, update), target[y*lanes:])
+	}
+}
+
+func BaseLiftStep97Cols_fallback_Float64(target []float64, tLen int, neighbor []float64, nLen int, coeff float64, phase int) {
+	if tLen == 0 || nLen == 0 {
+		return
+	}
+	coeffVec := hwy.Set(coeff)
+	lanes := hwy.MaxLanes[float64]()
+	for y := int(0); y < int(tLen); y++ {
+		n1Idx, n2Idx := y, y+1
+		if phase == 1 {
+			n1Idx, n2Idx = y-1, y
+		}
+		n1Idx = min(max(n1Idx, 0), nLen-1)
+		n2Idx = min(n2Idx, nLen-1)
+		n1 := hwy.Load(neighbor[n1Idx*lanes:])
+		n2 := hwy.Load(neighbor[n2Idx*lanes:])
+		update := hwy.Mul(coeffVec, hwy.Add(n1, n2))
+		t := hwy.Load(target[y*lanes:])
+		hwy.Store(hwy.Sub(t, update), target[y*lanes:])
+	}
+}
@@ -0,0 +1,44 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package wavelet
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("wavelet", "Analyze53CoreCols", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Analyze53CoreColsInt32; hwyImpl != nil {
+			Analyze53CoreColsInt32 = func(colBuf []int32, height int, lowBuf []int32, sn int, highBuf []int32, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(colBuf, height, lowBuf, sn, highBuf, dn, phase)
+				hwyCounter.Done(hwyStart, len(colBuf), hwy.SliceBytes(colBuf)+hwy.SliceBytes(lowBuf)+hwy.SliceBytes(highBuf))
+			}
+		}
+		if hwyImpl := Analyze53CoreColsInt64; hwyImpl != nil {
+			Analyze53CoreColsInt64 = func(colBuf []int64, height int, lowBuf []int64, sn int, highBuf []int64, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(colBuf, height, lowBuf, sn, highBuf, dn, phase)
+				hwyCounter.Done(hwyStart, len(colBuf), hwy.SliceBytes(colBuf)+hwy.SliceBytes(lowBuf)+hwy.SliceBytes(highBuf))
+			}
+		}
+	})
+	hwy.ProfileDispatch("wavelet", "LiftStep97Cols", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := LiftStep97ColsFloat32; hwyImpl != nil {
+			LiftStep97ColsFloat32 = func(target []float32, tLen int, neighbor []float32, nLen int, coeff float32, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(target, tLen, neighbor, nLen, coeff, phase)
+				hwyCounter.Done(hwyStart, len(target), hwy.SliceBytes(target)+hwy.SliceBytes(neighbor))
+			}
+		}
+		if hwyImpl := LiftStep97ColsFloat64; hwyImpl != nil {
+			LiftStep97ColsFloat64 = func(target []float64, tLen int, neighbor []float64, nLen int, coeff float64, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(target, tLen, neighbor, nLen, coeff, phase)
+				hwyCounter.Done(hwyStart, len(target), hwy.SliceBytes(target)+hwy.SliceBytes(neighbor))
+			}
+		}
+	})
+}
@@ -14,8 +14,9 @@
 
 // Package wavelet provides SIMD-accelerated wavelet transforms for image processing.
 //
-// This package implements the CDF 5/3 (reversible) biorthogonal wavelet used in
-// JPEG 2000. All transforms use the lifting scheme for efficient computation.
+// This package implements the CDF 5/3 (reversible) and CDF 9/7 (irreversible)
+// biorthogonal wavelets used in JPEG 2000. All transforms use the lifting scheme
+// for efficient computation.
 //
 // # Wavelet Types
 //
@@ -24,6 +25,11 @@
 //   - Two lifting steps: predict and update
 //   - Used in JPEG 2000 Part-1 lossless mode
 //
+// CDF 9/7:
+//   - Irreversible transform for floating-point data
+//   - Four lifting steps followed by K97 scaling
+//   - Used in JPEG 2000 Part-1 lossy mode
+//
 // # Phase Parameter
 //
 // The phase parameter controls how samples are partitioned into even/odd:
@@ -41,12 +47,33 @@
 //
 //	Synthesize53(data, phase, low, high)       // inverse 5/3 transform
 //	Analyze53(data, phase, low, high)          // forward 5/3 transform
+//	Synthesize97(data, phase, low, high)       // inverse 9/7 transform
+//	Analyze97(data, phase, low, high)          // forward 9/7 transform
 //	Synthesize53Cols(colBuf, height, phase, lowBuf, highBuf) // column-batched inverse
+//	Analyze53Cols(colBuf, height, phase, lowBuf, highBuf)    // column-batched forward
+//
+// Analyze97Cols and Synthesize97Cols are the column-batched 9/7 transforms.
 //
 // Data layout:
 //   - Analysis (forward): interleaved samples → [low-pass | high-pass]
 //   - Synthesis (inverse): [low-pass | high-pass] → interleaved samples
 //
+// # 2D Transform Functions
+//
+// Forward2D53/Inverse2D53 (signed integers) and Forward2D97/Inverse2D97
+// (float32, float64) run a multi-level decomposition in place over an
+// image.Image, leaving the usual Mallat layout with LL in the top-left corner.
+// Each level runs a vertical pass over column tiles of hwy.MaxLanes columns
+// and a horizontal pass over rows, in the JPEG 2000 order; (x0, y0) is the
+// tile origin on the reference grid and sets the phase of every level.
+//
+// Row bands and column tiles are split across a workerpool.Executor (nil for
+// sequential). Scratch space comes from an Arena sized once per image shape:
+//
+//	arena := wavelet.NewArena[int32](img.Width(), img.Height(), pool.NumWorkers())
+//	wavelet.Forward2D53(pool, img, 5, 0, 0, arena)
+//	wavelet.Inverse2D53(pool, img, 5, 0, 0, arena)
+//
 // # Usage Example
 //
 //	// 1D inverse transform
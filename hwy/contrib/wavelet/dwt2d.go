@@ -0,0 +1,268 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package wavelet
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/image"
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// MinParallelDWTPixels is the minimum number of samples a single horizontal
+// or vertical pass must touch before it is split across workers. Smaller
+// passes (the coarse levels of a decomposition) run on the calling goroutine.
+const MinParallelDWTPixels = 16384
+
+// maxStackLevels bounds the level geometry kept on the stack; deeper
+// decompositions still work but allocate it.
+const maxStackLevels = 32
+
+// Arena holds the scratch buffers used by the 2D transforms, one slot per
+// worker, so a decomposition does not allocate. Each slot is sized for the
+// larger of a horizontal pass (two half-rows) and a vertical pass (a
+// column-interleaved tile plus its two half-height subbands).
+type Arena[T hwy.Lanes] struct {
+	width  int
+	height int
+	slots  [][]T
+}
+
+// NewArena returns an arena for images up to width x height processed by up
+// to workers goroutines. workers <= 0 is treated as 1.
+func NewArena[T hwy.Lanes](width, height, workers int) *Arena[T] {
+	workers = max(workers, 1)
+	lanes := hwy.MaxLanes[T]()
+	halfW := (width + 1) / 2
+	halfH := (height + 1) / 2
+	size := max(2*halfW, (height+2*halfH)*lanes)
+
+	buf := make([]T, size*workers)
+	slots := make([][]T, workers)
+	for i := range slots {
+		slots[i] = buf[i*size : (i+1)*size : (i+1)*size]
+	}
+	return &Arena[T]{width: width, height: height, slots: slots}
+}
+
+// dwtLevel describes the resolution a single decomposition level transforms:
+// the top-left w x h samples of the image, whose first column and row sit
+// at odd (1) or even (0) positions of the tile-component grid.
+type dwtLevel struct {
+	w, h   int
+	px, py int
+}
+
+// dwtLevels appends to dst the geometry of up to levels decomposition levels
+// of a width x height tile whose top-left sample is at (x0, y0) on the
+// reference grid. It stops early once a dimension becomes empty.
+func dwtLevels(dst []dwtLevel, width, height, levels, x0, y0 int) []dwtLevel {
+	w, h := width, height
+	for range levels {
+		if w == 0 || h == 0 {
+			break
+		}
+		px, py := x0&1, y0&1
+		dst = append(dst, dwtLevel{w: w, h: h, px: px, py: py})
+		w, _ = subbandLens(w, px)
+		h, _ = subbandLens(h, py)
+		x0 = (x0 + 1) / 2
+		y0 = (y0 + 1) / 2
+	}
+	return dst
+}
+
+// Forward2D53 applies levels of the forward 2D 5/3 transform in place. Each
+// level transforms the low-pass quadrant left by the previous one, producing
+// the usual Mallat layout (LL in the top-left corner). (x0, y0) is the
+// position of the image's top-left sample on the reference grid and sets
+// the phase of every level, as for JPEG 2000 tiles.
+//
+// Passes are split into row bands and column tiles run on pool; pool may be
+// nil for sequential execution. arena may be nil, in which case one is
+// allocated for the call.
+func Forward2D53[T hwy.SignedInts](pool workerpool.Executor, img *image.Image[T], levels, x0, y0 int, arena *Arena[T]) {
+	forward2D[T](pool, img, levels, x0, y0, arena, cdf53[T]{})
+}
+
+// Inverse2D53 undoes Forward2D53 with the same levels and origin. The 5/3
+// transform is reversible, so the round trip is exact.
+func Inverse2D53[T hwy.SignedInts](pool workerpool.Executor, img *image.Image[T], levels, x0, y0 int, arena *Arena[T]) {
+	inverse2D[T](pool, img, levels, x0, y0, arena, cdf53[T]{})
+}
+
+// Forward2D97 applies levels of the forward 2D 9/7 transform in place. See
+// Forward2D53 for the layout and parameters.
+func Forward2D97[T hwy.FloatsNative](pool workerpool.Executor, img *image.Image[T], levels, x0, y0 int, arena *Arena[T]) {
+	forward2D[T](pool, img, levels, x0, y0, arena, cdf97[T]{})
+}
+
+// Inverse2D97 undoes Forward2D97 with the same levels and origin, up to
+// floating-point rounding.
+func Inverse2D97[T hwy.FloatsNative](pool workerpool.Executor, img *image.Image[T], levels, x0, y0 int, arena *Arena[T]) {
+	inverse2D[T](pool, img, levels, x0, y0, arena, cdf97[T]{})
+}
+
+// lifting is the pair of 1D transforms, for rows and for column tiles, that
+// a 2D pass applies. Implementations are empty structs, so passing one
+// through the interface does not allocate.
+type lifting[T hwy.Lanes] interface {
+	rows(data []T, phase int, low, high []T, inverse bool)
+	cols(colBuf []T, height, phase int, lowBuf, highBuf []T, inverse bool)
+}
+
+type cdf53[T hwy.SignedInts] struct{}
+
+func (cdf53[T]) rows(data []T, phase int, low, high []T, inverse bool) {
+	if inverse {
+		Synthesize53(data, phase, low, high)
+	} else {
+		Analyze53(data, phase, low, high)
+	}
+}
+
+func (cdf53[T]) cols(colBuf []T, height, phase int, lowBuf, highBuf []T, inverse bool) {
+	if inverse {
+		Synthesize53Cols(colBuf, height, phase, lowBuf, highBuf)
+	} else {
+		Analyze53Cols(colBuf, height, phase, lowBuf, highBuf)
+	}
+}
+
+type cdf97[T hwy.FloatsNative] struct{}
+
+func (cdf97[T]) rows(data []T, phase int, low, high []T, inverse bool) {
+	if inverse {
+		Synthesize97(data, phase, low, high)
+	} else {
+		Analyze97(data, phase, low, high)
+	}
+}
+
+func (cdf97[T]) cols(colBuf []T, height, phase int, lowBuf, highBuf []T, inverse bool) {
+	if inverse {
+		Synthesize97Cols(colBuf, height, phase, lowBuf, highBuf)
+	} else {
+		Analyze97Cols(colBuf, height, phase, lowBuf, highBuf)
+	}
+}
+
+// forward2D runs the vertical then the horizontal pass of every level, the
+// order JPEG 2000 uses for 2D_SD.
+func forward2D[T hwy.Lanes](pool workerpool.Executor, img *image.Image[T], levels, x0, y0 int, arena *Arena[T], lift lifting[T]) {
+	arena = checkArena(pool, img, arena)
+	var buf [maxStackLevels]dwtLevel
+	for _, l := range dwtLevels(buf[:0], img.Width(), img.Height(), levels, x0, y0) {
+		colsPass(pool, img, l, arena, lift, false)
+		rowsPass(pool, img, l, arena, lift, false)
+	}
+}
+
+// inverse2D runs the levels from coarsest to finest, each as a horizontal
+// then a vertical pass, so it retraces forward2D exactly.
+func inverse2D[T hwy.Lanes](pool workerpool.Executor, img *image.Image[T], levels, x0, y0 int, arena *Arena[T], lift lifting[T]) {
+	arena = checkArena(pool, img, arena)
+	var buf [maxStackLevels]dwtLevel
+	geom := dwtLevels(buf[:0], img.Width(), img.Height(), levels, x0, y0)
+	for i := len(geom) - 1; i >= 0; i-- {
+		rowsPass(pool, img, geom[i], arena, lift, true)
+		colsPass(pool, img, geom[i], arena, lift, true)
+	}
+}
+
+// checkArena allocates an arena when none is given and panics when the given
+// one is too small for img.
+func checkArena[T hwy.Lanes](pool workerpool.Executor, img *image.Image[T], arena *Arena[T]) *Arena[T] {
+	if arena == nil {
+		workers := 1
+		if pool != nil {
+			workers = pool.NumWorkers()
+		}
+		return NewArena[T](img.Width(), img.Height(), workers)
+	}
+	if arena.width < img.Width() || arena.height < img.Height() {
+		panic("wavelet: arena smaller than image")
+	}
+	return arena
+}
+
+// rowsPass transforms the first l.w samples of rows [0, l.h), one row band
+// per arena slot.
+func rowsPass[T hwy.Lanes](pool workerpool.Executor, img *image.Image[T], l dwtLevel, arena *Arena[T], lift lifting[T], inverse bool) {
+	bands := numBands(pool, l.h, l.w*l.h, len(arena.slots))
+	if bands <= 1 {
+		rowsBand(img, l, arena.slots[0], 0, l.h, lift, inverse)
+		return
+	}
+	pool.ParallelForAtomic(bands, func(b int) {
+		rowsBand(img, l, arena.slots[b], b*l.h/bands, (b+1)*l.h/bands, lift, inverse)
+	})
+}
+
+func rowsBand[T hwy.Lanes](img *image.Image[T], l dwtLevel, buf []T, start, end int, lift lifting[T], inverse bool) {
+	half := (l.w + 1) / 2
+	low, high := buf[:half], buf[half:2*half]
+	for y := start; y < end; y++ {
+		lift.rows(img.Row(y)[:l.w], l.px, low, high, inverse)
+	}
+}
+
+// colsPass transforms the first l.h samples of columns [0, l.w) in tiles of
+// hwy.MaxLanes columns, one band of tiles per arena slot.
+func colsPass[T hwy.Lanes](pool workerpool.Executor, img *image.Image[T], l dwtLevel, arena *Arena[T], lift lifting[T], inverse bool) {
+	lanes := hwy.MaxLanes[T]()
+	tiles := (l.w + lanes - 1) / lanes
+	bands := numBands(pool, tiles, l.w*l.h, len(arena.slots))
+	if bands <= 1 {
+		colsBand(img, l, arena.slots[0], 0, tiles, lift, inverse)
+		return
+	}
+	pool.ParallelForAtomic(bands, func(b int) {
+		colsBand(img, l, arena.slots[b], b*tiles/bands, (b+1)*tiles/bands, lift, inverse)
+	})
+}
+
+// colsBand transforms column tiles [start, end). Each tile is gathered into
+// a column-interleaved buffer, one vector per row, transformed, and
+// scattered back. Rows are padded to a multiple of the vector width, so the
+// gather never runs past the row; only the tile's valid columns are written
+// back.
+func colsBand[T hwy.Lanes](img *image.Image[T], l dwtLevel, buf []T, start, end int, lift lifting[T], inverse bool) {
+	lanes := hwy.MaxLanes[T]()
+	half := (l.h + 1) / 2
+	colBuf := buf[:l.h*lanes]
+	lowBuf := buf[l.h*lanes : (l.h+half)*lanes]
+	highBuf := buf[(l.h+half)*lanes : (l.h+2*half)*lanes]
+	for t := start; t < end; t++ {
+		cx := t * lanes
+		for y := range l.h {
+			copy(colBuf[y*lanes:(y+1)*lanes], img.Row(y)[cx:cx+lanes])
+		}
+		lift.cols(colBuf, l.h, l.py, lowBuf, highBuf, inverse)
+		n := min(lanes, l.w-cx)
+		for y := range l.h {
+			copy(img.Row(y)[cx:cx+n], colBuf[y*lanes:y*lanes+n])
+		}
+	}
+}
+
+// numBands returns how many bands to split n units of a pass into: one when
+// pool is nil or the pass touches fewer than MinParallelDWTPixels samples,
+// otherwise at most one per worker and per arena slot.
+func numBands(pool workerpool.Executor, n, work, slots int) int {
+	if pool == nil || work < MinParallelDWTPixels {
+		return 1
+	}
+	return min(pool.NumWorkers(), slots, n)
+}
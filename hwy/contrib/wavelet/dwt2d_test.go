@@ -0,0 +1,291 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package wavelet
+
+import (
+	"fmt"
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/image"
+	"github.com/ajroetker/go-highway/hwy/contrib/workerpool"
+)
+
+// 2D test shapes: odd and even sizes, a single row and column, and widths
+// that leave a partial column tile.
+var test2DSizes = [][2]int{{1, 1}, {1, 9}, {9, 1}, {7, 5}, {16, 16}, {17, 33}, {40, 23}}
+
+func TestAnalyze97_RoundTrip(t *testing.T) {
+	for _, size := range append([]int{1}, testSizes...) {
+		for phase := 0; phase <= 1; phase++ {
+			t.Run(sizePhaseString(size, phase), func(t *testing.T) {
+				original := make([]float64, size)
+				data := make([]float64, size)
+				for i := range original {
+					original[i] = float64(i*7%13) - 3.5
+					data[i] = original[i]
+				}
+
+				maxHalf := (size + 1) / 2
+				low := make([]float64, maxHalf)
+				high := make([]float64, maxHalf)
+
+				Analyze97(data, phase, low, high)
+				Synthesize97(data, phase, low, high)
+
+				for i := range original {
+					if !almostEqualF64(data[i], original[i], 1e-9) {
+						t.Errorf("at %d: got %v, want %v", i, data[i], original[i])
+					}
+				}
+			})
+		}
+	}
+}
+
+func TestAnalyze53Cols_MatchesAnalyze53(t *testing.T) {
+	for _, height := range append([]int{1}, testSizes...) {
+		for phase := 0; phase <= 1; phase++ {
+			t.Run(sizePhaseString(height, phase), func(t *testing.T) {
+				lanes := hwy.MaxLanes[int32]()
+				maxHalf := (height + 1) / 2
+
+				colBuf := make([]int32, height*lanes)
+				for i := range colBuf {
+					colBuf[i] = int32(i*11%37 - 18)
+				}
+				want := make([]int32, len(colBuf))
+				col := make([]int32, height)
+				low := make([]int32, maxHalf)
+				high := make([]int32, maxHalf)
+				for c := range lanes {
+					for y := range height {
+						col[y] = colBuf[y*lanes+c]
+					}
+					Analyze53(col, phase, low, high)
+					for y := range height {
+						want[y*lanes+c] = col[y]
+					}
+				}
+
+				Analyze53Cols(colBuf, height, phase, make([]int32, maxHalf*lanes), make([]int32, maxHalf*lanes))
+
+				for i := range want {
+					if colBuf[i] != want[i] {
+						t.Fatalf("row %d col %d: got %d, want %d", i/lanes, i%lanes, colBuf[i], want[i])
+					}
+				}
+			})
+		}
+	}
+}
+
+func TestSynthesize97Cols_MatchesSynthesize97(t *testing.T) {
+	for _, height := range append([]int{1}, testSizes...) {
+		for phase := 0; phase <= 1; phase++ {
+			t.Run(sizePhaseString(height, phase), func(t *testing.T) {
+				lanes := hwy.MaxLanes[float32]()
+				maxHalf := (height + 1) / 2
+				lowBuf := make([]float32, maxHalf*lanes)
+				highBuf := make([]float32, maxHalf*lanes)
+
+				colBuf := make([]float32, height*lanes)
+				for i := range colBuf {
+					colBuf[i] = float32(i*11%37) - 18
+				}
+				fwd := make([]float32, len(colBuf))
+				inv := make([]float32, len(colBuf))
+				col := make([]float32, height)
+				low := make([]float32, maxHalf)
+				high := make([]float32, maxHalf)
+				for c := range lanes {
+					for y := range height {
+						col[y] = colBuf[y*lanes+c]
+					}
+					Analyze97(col, phase, low, high)
+					for y := range height {
+						fwd[y*lanes+c] = col[y]
+					}
+					Synthesize97(col, phase, low, high)
+					for y := range height {
+						inv[y*lanes+c] = col[y]
+					}
+				}
+
+				Analyze97Cols(colBuf, height, phase, lowBuf, highBuf)
+				for i := range fwd {
+					if !almostEqualF32(colBuf[i], fwd[i], 1e-4) {
+						t.Fatalf("forward row %d col %d: got %v, want %v", i/lanes, i%lanes, colBuf[i], fwd[i])
+					}
+				}
+				Synthesize97Cols(colBuf, height, phase, lowBuf, highBuf)
+				for i := range inv {
+					if !almostEqualF32(colBuf[i], inv[i], 1e-4) {
+						t.Fatalf("inverse row %d col %d: got %v, want %v", i/lanes, i%lanes, colBuf[i], inv[i])
+					}
+				}
+			})
+		}
+	}
+}
+
+func TestForward2D53_MatchesSeparable(t *testing.T) {
+	for _, sz := range test2DSizes {
+		for _, origin := range [][2]int{{0, 0}, {1, 0}, {3, 5}} {
+			w, h := sz[0], sz[1]
+			t.Run(fmt.Sprintf("%dx%d_at%d,%d", w, h, origin[0], origin[1]), func(t *testing.T) {
+				img := testImage[int32](w, h)
+				want := referenceForward2D53(img, 3, origin[0], origin[1])
+
+				Forward2D53(nil, img, 3, origin[0], origin[1], nil)
+				compareImages(t, img, want)
+			})
+		}
+	}
+}
+
+func TestForward2D53_RoundTrip(t *testing.T) {
+	for _, sz := range test2DSizes {
+		for levels := 1; levels <= 5; levels++ {
+			t.Run(fmt.Sprintf("%dx%d_L%d", sz[0], sz[1], levels), func(t *testing.T) {
+				img := testImage[int32](sz[0], sz[1])
+				want := img.Clone()
+				arena := NewArena[int32](sz[0], sz[1], 1)
+
+				Forward2D53(nil, img, levels, 1, 2, arena)
+				Inverse2D53(nil, img, levels, 1, 2, arena)
+				compareImages(t, img, want)
+			})
+		}
+	}
+}
+
+func TestForward2D97_RoundTrip(t *testing.T) {
+	for _, sz := range test2DSizes {
+		for levels := 1; levels <= 5; levels++ {
+			t.Run(fmt.Sprintf("%dx%d_L%d", sz[0], sz[1], levels), func(t *testing.T) {
+				img := testImage[float32](sz[0], sz[1])
+				want := img.Clone()
+
+				Forward2D97(nil, img, levels, 0, 1, nil)
+				Inverse2D97(nil, img, levels, 0, 1, nil)
+				for y := range sz[1] {
+					for x := range sz[0] {
+						if !almostEqualF32(img.At(x, y), want.At(x, y), 1e-3) {
+							t.Fatalf("(%d,%d): got %v, want %v", x, y, img.At(x, y), want.At(x, y))
+						}
+					}
+				}
+			})
+		}
+	}
+}
+
+func TestForward2D_Parallel(t *testing.T) {
+	pool := workerpool.New(4)
+	defer pool.Close()
+
+	const w, h = 257, 131
+	arena := NewArena[int32](w, h, pool.NumWorkers())
+
+	seq := testImage[int32](w, h)
+	par := seq.Clone()
+	Forward2D53(nil, seq, 4, 0, 0, nil)
+	Forward2D53(pool, par, 4, 0, 0, arena)
+	compareImages(t, par, seq)
+
+	Inverse2D53(pool, par, 4, 0, 0, arena)
+	compareImages(t, par, testImage[int32](w, h))
+
+	seq97 := testImage[float64](w, h)
+	par97 := seq97.Clone()
+	Forward2D97(nil, seq97, 4, 0, 0, nil)
+	Forward2D97(pool, par97, 4, 0, 0, nil)
+	compareImages(t, par97, seq97)
+}
+
+func TestForward2D_NoAllocs(t *testing.T) {
+	img := testImage[int32](64, 48)
+	arena := NewArena[int32](64, 48, 1)
+	allocs := testing.AllocsPerRun(10, func() {
+		Forward2D53(nil, img, 4, 1, 1, arena)
+		Inverse2D53(nil, img, 4, 1, 1, arena)
+	})
+	if allocs != 0 {
+		t.Errorf("got %v allocs/op with a pre-sized arena, want 0", allocs)
+	}
+}
+
+func TestArenaTooSmall(t *testing.T) {
+	defer func() {
+		if recover() == nil {
+			t.Error("expected panic for undersized arena")
+		}
+	}()
+	Forward2D53(nil, testImage[int32](16, 16), 1, 0, 0, NewArena[int32](8, 16, 1))
+}
+
+func testImage[T hwy.SignedInts | hwy.FloatsNative](w, h int) *image.Image[T] {
+	img := image.NewImage[T](w, h)
+	for y := range h {
+		for x := range w {
+			img.Set(x, y, T((x*31+y*17)%97)-48)
+		}
+	}
+	return img
+}
+
+func compareImages[T hwy.Lanes](t *testing.T, got, want *image.Image[T]) {
+	t.Helper()
+	for y := range want.Height() {
+		for x := range want.Width() {
+			if got.At(x, y) != want.At(x, y) {
+				t.Fatalf("(%d,%d): got %v, want %v", x, y, got.At(x, y), want.At(x, y))
+			}
+		}
+	}
+}
+
+// referenceForward2D53 computes the multi-level 5/3 decomposition one
+// column and one row at a time with the 1D transform.
+func referenceForward2D53(src *image.Image[int32], levels, x0, y0 int) *image.Image[int32] {
+	img := src.Clone()
+	w, h := img.Width(), img.Height()
+	for range levels {
+		if w == 0 || h == 0 {
+			break
+		}
+		px, py := x0&1, y0&1
+		low := make([]int32, (max(w, h)+1)/2)
+		high := make([]int32, (max(w, h)+1)/2)
+		col := make([]int32, h)
+		for x := range w {
+			for y := range h {
+				col[y] = img.At(x, y)
+			}
+			Analyze53(col, py, low, high)
+			for y := range h {
+				img.Set(x, y, col[y])
+			}
+		}
+		for y := range h {
+			Analyze53(img.Row(y)[:w], px, low, high)
+		}
+		w, _ = subbandLens(w, px)
+		h, _ = subbandLens(h, py)
+		x0, y0 = (x0+1)/2, (y0+1)/2
+	}
+	return img
+}
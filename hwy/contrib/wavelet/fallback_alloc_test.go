@@ -0,0 +1,110 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package wavelet
+
+import (
+	"testing"
+
+	"github.com/ajroetker/go-highway/hwy"
+	"github.com/ajroetker/go-highway/hwy/contrib/internal/fallbacktest"
+)
+
+// allocTestLen and allocTestDim size the inputs handed to the fallback
+// kernels: every slice holds allocTestLen elements and every size or count
+// parameter is allocTestDim, so 2-D shapes fit comfortably.
+const (
+	allocTestLen = 4096
+	allocTestDim = 16
+)
+
+// TestFallbackNoAllocs checks that every generated fallback kernel runs
+// without heap allocations.
+func TestFallbackNoAllocs(t *testing.T) {
+	var (
+		f32        = make([]float32, allocTestLen)
+		f64        = make([]float64, allocTestLen)
+		i32        = make([]int32, allocTestLen)
+		i64        = make([]int64, allocTestLen)
+		u32        = make([]uint32, allocTestLen)
+		u64        = make([]uint64, allocTestLen)
+		f16        = make([]hwy.Float16, allocTestLen)
+		bf16       = make([]hwy.BFloat16, allocTestLen)
+		f16Scalar  = hwy.NewFloat16(1)
+		bf16Scalar = hwy.NewBFloat16(1)
+		f32Scalar  = float32(1)
+		f64Scalar  = float64(1)
+	)
+	kernels := []struct {
+		name string
+		fn   func()
+	}{
+		{"BaseDeinterleave_fallback", func() { BaseDeinterleave_fallback(f32, f32, allocTestDim, f32, allocTestDim, allocTestDim) }},
+		{"BaseDeinterleave_fallback_Float64", func() { BaseDeinterleave_fallback_Float64(f64, f64, allocTestDim, f64, allocTestDim, allocTestDim) }},
+		{"BaseDeinterleave_fallback_Int32", func() { BaseDeinterleave_fallback_Int32(i32, i32, allocTestDim, i32, allocTestDim, allocTestDim) }},
+		{"BaseDeinterleave_fallback_Int64", func() { BaseDeinterleave_fallback_Int64(i64, i64, allocTestDim, i64, allocTestDim, allocTestDim) }},
+		{"BaseDeinterleave_fallback_Uint32", func() { BaseDeinterleave_fallback_Uint32(u32, u32, allocTestDim, u32, allocTestDim, allocTestDim) }},
+		{"BaseDeinterleave_fallback_Uint64", func() { BaseDeinterleave_fallback_Uint64(u64, u64, allocTestDim, u64, allocTestDim, allocTestDim) }},
+		{"BaseInterleave_fallback", func() { BaseInterleave_fallback(f32, f32, allocTestDim, f32, allocTestDim, allocTestDim) }},
+		{"BaseInterleave_fallback_Float64", func() { BaseInterleave_fallback_Float64(f64, f64, allocTestDim, f64, allocTestDim, allocTestDim) }},
+		{"BaseInterleave_fallback_Int32", func() { BaseInterleave_fallback_Int32(i32, i32, allocTestDim, i32, allocTestDim, allocTestDim) }},
+		{"BaseInterleave_fallback_Int64", func() { BaseInterleave_fallback_Int64(i64, i64, allocTestDim, i64, allocTestDim, allocTestDim) }},
+		{"BaseInterleave_fallback_Uint32", func() { BaseInterleave_fallback_Uint32(u32, u32, allocTestDim, u32, allocTestDim, allocTestDim) }},
+		{"BaseInterleave_fallback_Uint64", func() { BaseInterleave_fallback_Uint64(u64, u64, allocTestDim, u64, allocTestDim, allocTestDim) }},
+		{"BaseLiftPredict53_fallback_Int32", func() { BaseLiftPredict53_fallback_Int32(i32, allocTestDim, i32, allocTestDim, 0) }},
+		{"BaseLiftPredict53_fallback_Int64", func() { BaseLiftPredict53_fallback_Int64(i64, allocTestDim, i64, allocTestDim, 0) }},
+		{"BaseLiftStep97_fallback_Float16", func() { BaseLiftStep97_fallback_Float16(f16, allocTestDim, f16, allocTestDim, hwy.NewFloat16(1), 0) }},
+		{"BaseLiftStep97_fallback_BFloat16", func() {
+			BaseLiftStep97_fallback_BFloat16(bf16, allocTestDim, bf16, allocTestDim, hwy.NewBFloat16(1), 0)
+		}},
+		{"BaseLiftStep97_fallback", func() { BaseLiftStep97_fallback(f32, allocTestDim, f32, allocTestDim, 1, 0) }},
+		{"BaseLiftStep97_fallback_Float64", func() { BaseLiftStep97_fallback_Float64(f64, allocTestDim, f64, allocTestDim, 1, 0) }},
+		{"BaseLiftUpdate53_fallback_Int32", func() { BaseLiftUpdate53_fallback_Int32(i32, allocTestDim, i32, allocTestDim, 0) }},
+		{"BaseLiftUpdate53_fallback_Int64", func() { BaseLiftUpdate53_fallback_Int64(i64, allocTestDim, i64, allocTestDim, 0) }},
+		{"BaseScaleSlice_fallback_Float16", func() { BaseScaleSlice_fallback_Float16(f16, allocTestDim, f16Scalar) }},
+		{"BaseScaleSlice_fallback_BFloat16", func() { BaseScaleSlice_fallback_BFloat16(bf16, allocTestDim, bf16Scalar) }},
+		{"BaseScaleSlice_fallback", func() { BaseScaleSlice_fallback(f32, allocTestDim, f32Scalar) }},
+		{"BaseScaleSlice_fallback_Float64", func() { BaseScaleSlice_fallback_Float64(f64, allocTestDim, f64Scalar) }},
+		{"BaseSynthesize53Core_fallback_Int32", func() {
+			BaseSynthesize53Core_fallback_Int32(i32, allocTestDim, i32, allocTestDim/2, i32, allocTestDim/2, 0)
+		}},
+		{"BaseSynthesize53Core_fallback_Int64", func() {
+			BaseSynthesize53Core_fallback_Int64(i64, allocTestDim, i64, allocTestDim/2, i64, allocTestDim/2, 0)
+		}},
+		{"BaseSynthesize53CoreCols_fallback_Int32", func() {
+			BaseSynthesize53CoreCols_fallback_Int32(i32, allocTestDim, i32, allocTestDim/2, i32, allocTestDim/2, 0)
+		}},
+		{"BaseSynthesize53CoreCols_fallback_Int64", func() {
+			BaseSynthesize53CoreCols_fallback_Int64(i64, allocTestDim, i64, allocTestDim/2, i64, allocTestDim/2, 0)
+		}},
+		{"BaseAnalyze53CoreCols_fallback_Int32", func() {
+			BaseAnalyze53CoreCols_fallback_Int32(i32, allocTestDim, i32, allocTestDim/2, i32, allocTestDim/2, 0)
+		}},
+		{"BaseAnalyze53CoreCols_fallback_Int64", func() {
+			BaseAnalyze53CoreCols_fallback_Int64(i64, allocTestDim, i64, allocTestDim/2, i64, allocTestDim/2, 0)
+		}},
+		{"BaseLiftStep97Cols_fallback", func() { BaseLiftStep97Cols_fallback(f32, allocTestDim, f32, allocTestDim, 1, 0) }},
+		{"BaseLiftStep97Cols_fallback_Float64", func() { BaseLiftStep97Cols_fallback_Float64(f64, allocTestDim, f64, allocTestDim, 1, 0) }},
+	}
+	names := make([]string, len(kernels))
+	for i, k := range kernels {
+		names[i] = k.name
+	}
+	fallbacktest.CheckCovered(t, names)
+	for _, k := range kernels {
+		if allocs := testing.AllocsPerRun(10, k.fn); allocs != 0 {
+			t.Errorf("%s: %v allocs/op, want 0", k.name, allocs)
+		}
+	}
+}
@@ -178,6 +178,23 @@ func Synthesize53CoreCols[T hwy.SignedInts](colBuf []T, height int, lowBuf []T,
 
 func init() {
 	initLiftingAll()
+	hwy.RegisterDispatch(hwy.DispatchTable{
+		Package: "wavelet",
+		Groups: []hwy.DispatchGroup{
+			{Name: "Deinterleave", Vars: []any{&DeinterleaveFloat32, &DeinterleaveFloat64, &DeinterleaveInt32, &DeinterleaveInt64, &DeinterleaveUint32, &DeinterleaveUint64}},
+			{Name: "Interleave", Vars: []any{&InterleaveFloat32, &InterleaveFloat64, &InterleaveInt32, &InterleaveInt64, &InterleaveUint32, &InterleaveUint64}},
+			{Name: "LiftPredict53", Vars: []any{&LiftPredict53Int32, &LiftPredict53Int64}},
+			{Name: "LiftStep97", Vars: []any{&LiftStep97Float16, &LiftStep97BFloat16, &LiftStep97Float32, &LiftStep97Float64}},
+			{Name: "LiftUpdate53", Vars: []any{&LiftUpdate53Int32, &LiftUpdate53Int64}},
+			{Name: "ScaleSlice", Vars: []any{&ScaleSliceFloat16, &ScaleSliceBFloat16, &ScaleSliceFloat32, &ScaleSliceFloat64}},
+			{Name: "Synthesize53Core", Vars: []any{&Synthesize53CoreInt32, &Synthesize53CoreInt64}},
+			{Name: "Synthesize53CoreCols", Vars: []any{&Synthesize53CoreColsInt32, &Synthesize53CoreColsInt64}},
+		},
+		Targets: []hwy.DispatchTarget{
+			{Name: "neon", Supported: true, Init: initLiftingNEONAsm},
+			{Name: "fallback", Supported: true, Init: initLiftingFallback},
+		},
+	})
 }
 
 func initLiftingAll() {
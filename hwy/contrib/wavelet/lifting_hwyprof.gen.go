@@ -0,0 +1,224 @@
+// Code generated by github.com/ajroetker/go-highway/cmd/hwygen. DO NOT EDIT.
+
+//go:build hwyprof
+
+package wavelet
+
+import (
+	"github.com/ajroetker/go-highway/hwy"
+)
+
+func init() {
+	hwy.ProfileDispatch("wavelet", "Deinterleave", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := DeinterleaveFloat32; hwyImpl != nil {
+			DeinterleaveFloat32 = func(src []float32, low []float32, sn int, high []float32, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+		if hwyImpl := DeinterleaveFloat64; hwyImpl != nil {
+			DeinterleaveFloat64 = func(src []float64, low []float64, sn int, high []float64, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+		if hwyImpl := DeinterleaveInt32; hwyImpl != nil {
+			DeinterleaveInt32 = func(src []int32, low []int32, sn int, high []int32, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+		if hwyImpl := DeinterleaveInt64; hwyImpl != nil {
+			DeinterleaveInt64 = func(src []int64, low []int64, sn int, high []int64, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+		if hwyImpl := DeinterleaveUint32; hwyImpl != nil {
+			DeinterleaveUint32 = func(src []uint32, low []uint32, sn int, high []uint32, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+		if hwyImpl := DeinterleaveUint64; hwyImpl != nil {
+			DeinterleaveUint64 = func(src []uint64, low []uint64, sn int, high []uint64, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(src, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(src), hwy.SliceBytes(src)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+	})
+	hwy.ProfileDispatch("wavelet", "Interleave", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := InterleaveFloat32; hwyImpl != nil {
+			InterleaveFloat32 = func(dst []float32, low []float32, sn int, high []float32, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+		if hwyImpl := InterleaveFloat64; hwyImpl != nil {
+			InterleaveFloat64 = func(dst []float64, low []float64, sn int, high []float64, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+		if hwyImpl := InterleaveInt32; hwyImpl != nil {
+			InterleaveInt32 = func(dst []int32, low []int32, sn int, high []int32, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+		if hwyImpl := InterleaveInt64; hwyImpl != nil {
+			InterleaveInt64 = func(dst []int64, low []int64, sn int, high []int64, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+		if hwyImpl := InterleaveUint32; hwyImpl != nil {
+			InterleaveUint32 = func(dst []uint32, low []uint32, sn int, high []uint32, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+		if hwyImpl := InterleaveUint64; hwyImpl != nil {
+			InterleaveUint64 = func(dst []uint64, low []uint64, sn int, high []uint64, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(dst, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(dst), hwy.SliceBytes(dst)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+	})
+	hwy.ProfileDispatch("wavelet", "LiftPredict53", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := LiftPredict53Int32; hwyImpl != nil {
+			LiftPredict53Int32 = func(target []int32, tLen int, neighbor []int32, nLen int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(target, tLen, neighbor, nLen, phase)
+				hwyCounter.Done(hwyStart, len(target), hwy.SliceBytes(target)+hwy.SliceBytes(neighbor))
+			}
+		}
+		if hwyImpl := LiftPredict53Int64; hwyImpl != nil {
+			LiftPredict53Int64 = func(target []int64, tLen int, neighbor []int64, nLen int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(target, tLen, neighbor, nLen, phase)
+				hwyCounter.Done(hwyStart, len(target), hwy.SliceBytes(target)+hwy.SliceBytes(neighbor))
+			}
+		}
+	})
+	hwy.ProfileDispatch("wavelet", "LiftStep97", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := LiftStep97Float16; hwyImpl != nil {
+			LiftStep97Float16 = func(target []hwy.Float16, tLen int, neighbor []hwy.Float16, nLen int, coeff hwy.Float16, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(target, tLen, neighbor, nLen, coeff, phase)
+				hwyCounter.Done(hwyStart, len(target), hwy.SliceBytes(target)+hwy.SliceBytes(neighbor))
+			}
+		}
+		if hwyImpl := LiftStep97BFloat16; hwyImpl != nil {
+			LiftStep97BFloat16 = func(target []hwy.BFloat16, tLen int, neighbor []hwy.BFloat16, nLen int, coeff hwy.BFloat16, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(target, tLen, neighbor, nLen, coeff, phase)
+				hwyCounter.Done(hwyStart, len(target), hwy.SliceBytes(target)+hwy.SliceBytes(neighbor))
+			}
+		}
+		if hwyImpl := LiftStep97Float32; hwyImpl != nil {
+			LiftStep97Float32 = func(target []float32, tLen int, neighbor []float32, nLen int, coeff float32, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(target, tLen, neighbor, nLen, coeff, phase)
+				hwyCounter.Done(hwyStart, len(target), hwy.SliceBytes(target)+hwy.SliceBytes(neighbor))
+			}
+		}
+		if hwyImpl := LiftStep97Float64; hwyImpl != nil {
+			LiftStep97Float64 = func(target []float64, tLen int, neighbor []float64, nLen int, coeff float64, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(target, tLen, neighbor, nLen, coeff, phase)
+				hwyCounter.Done(hwyStart, len(target), hwy.SliceBytes(target)+hwy.SliceBytes(neighbor))
+			}
+		}
+	})
+	hwy.ProfileDispatch("wavelet", "LiftUpdate53", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := LiftUpdate53Int32; hwyImpl != nil {
+			LiftUpdate53Int32 = func(target []int32, tLen int, neighbor []int32, nLen int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(target, tLen, neighbor, nLen, phase)
+				hwyCounter.Done(hwyStart, len(target), hwy.SliceBytes(target)+hwy.SliceBytes(neighbor))
+			}
+		}
+		if hwyImpl := LiftUpdate53Int64; hwyImpl != nil {
+			LiftUpdate53Int64 = func(target []int64, tLen int, neighbor []int64, nLen int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(target, tLen, neighbor, nLen, phase)
+				hwyCounter.Done(hwyStart, len(target), hwy.SliceBytes(target)+hwy.SliceBytes(neighbor))
+			}
+		}
+	})
+	hwy.ProfileDispatch("wavelet", "ScaleSlice", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := ScaleSliceFloat16; hwyImpl != nil {
+			ScaleSliceFloat16 = func(data []hwy.Float16, n int, scale hwy.Float16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, n, scale)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := ScaleSliceBFloat16; hwyImpl != nil {
+			ScaleSliceBFloat16 = func(data []hwy.BFloat16, n int, scale hwy.BFloat16) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, n, scale)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := ScaleSliceFloat32; hwyImpl != nil {
+			ScaleSliceFloat32 = func(data []float32, n int, scale float32) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, n, scale)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+		if hwyImpl := ScaleSliceFloat64; hwyImpl != nil {
+			ScaleSliceFloat64 = func(data []float64, n int, scale float64) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, n, scale)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data))
+			}
+		}
+	})
+	hwy.ProfileDispatch("wavelet", "Synthesize53Core", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Synthesize53CoreInt32; hwyImpl != nil {
+			Synthesize53CoreInt32 = func(data []int32, n int, low []int32, sn int, high []int32, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, n, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+		if hwyImpl := Synthesize53CoreInt64; hwyImpl != nil {
+			Synthesize53CoreInt64 = func(data []int64, n int, low []int64, sn int, high []int64, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(data, n, low, sn, high, dn, phase)
+				hwyCounter.Done(hwyStart, len(data), hwy.SliceBytes(data)+hwy.SliceBytes(low)+hwy.SliceBytes(high))
+			}
+		}
+	})
+	hwy.ProfileDispatch("wavelet", "Synthesize53CoreCols", func(hwyCounter *hwy.KernelCounter) {
+		if hwyImpl := Synthesize53CoreColsInt32; hwyImpl != nil {
+			Synthesize53CoreColsInt32 = func(colBuf []int32, height int, lowBuf []int32, sn int, highBuf []int32, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(colBuf, height, lowBuf, sn, highBuf, dn, phase)
+				hwyCounter.Done(hwyStart, len(colBuf), hwy.SliceBytes(colBuf)+hwy.SliceBytes(lowBuf)+hwy.SliceBytes(highBuf))
+			}
+		}
+		if hwyImpl := Synthesize53CoreColsInt64; hwyImpl != nil {
+			Synthesize53CoreColsInt64 = func(colBuf []int64, height int, lowBuf []int64, sn int, highBuf []int64, dn int, phase int) {
+				hwyStart := hwyCounter.Start()
+				hwyImpl(colBuf, height, lowBuf, sn, highBuf, dn, phase)
+				hwyCounter.Done(hwyStart, len(colBuf), hwy.SliceBytes(colBuf)+hwy.SliceBytes(lowBuf)+hwy.SliceBytes(highBuf))
+			}
+		}
+	})
+}
@@ -179,3 +179,159 @@ func Analyze53[T hwy.SignedInts](data []T, phase int, low, high []T) {
 	copy(data[:sn], low)
 	copy(data[sn:], high)
 }
+
+// Analyze53Cols applies the forward 5/3 wavelet transform to multiple columns
+// simultaneously using column-interleaved SIMD. It is the inverse of
+// Synthesize53Cols and uses the same colBuf layout and scratch requirements.
+func Analyze53Cols[T hwy.SignedInts](colBuf []T, height int, phase int, lowBuf, highBuf []T) {
+	sn, dn := subbandLens(height, phase)
+	if sn == 0 || dn == 0 {
+		if phase == 1 && height == 1 {
+			lanes := hwy.MaxLanes[T]()
+			for c := range lanes {
+				colBuf[c] *= 2
+			}
+		}
+		return
+	}
+
+	Analyze53CoreCols(colBuf, height, lowBuf, sn, highBuf, dn, phase)
+}
+
+// Analyze97 applies the forward 9/7 wavelet transform using pre-allocated buffers.
+// low and high must each have capacity >= ceil(n/2). The low-pass band is scaled
+// by 1/K97 and the high-pass band by K97, matching JPEG 2000 lossy mode.
+func Analyze97[T hwy.Floats](data []T, phase int, low, high []T) {
+	n := len(data)
+	sn, dn := subbandLens(n, phase)
+	if sn == 0 || dn == 0 {
+		if phase == 1 && n == 1 {
+			data[0] *= 2
+		}
+		return
+	}
+
+	low = low[:sn]
+	high = high[:dn]
+	Deinterleave(data, low, sn, high, dn, phase)
+
+	// A high-pass sample at position i sees low neighbors with the same
+	// phase; a low-pass sample sees high neighbors with the opposite one.
+	alpha, beta, gamma, delta, k, invK := lift97Coeffs[T]()
+	LiftStep97(high, dn, low, sn, -alpha, phase)
+	LiftStep97(low, sn, high, dn, -beta, 1-phase)
+	LiftStep97(high, dn, low, sn, -gamma, phase)
+	LiftStep97(low, sn, high, dn, -delta, 1-phase)
+	ScaleSlice(low, sn, invK)
+	ScaleSlice(high, dn, k)
+
+	copy(data[:sn], low)
+	copy(data[sn:], high)
+}
+
+// Synthesize97 applies the inverse 9/7 wavelet transform using pre-allocated
+// buffers. low and high must each have capacity >= ceil(n/2).
+func Synthesize97[T hwy.Floats](data []T, phase int, low, high []T) {
+	n := len(data)
+	sn, dn := subbandLens(n, phase)
+	if sn == 0 || dn == 0 {
+		if phase == 1 && n == 1 {
+			data[0] /= 2
+		}
+		return
+	}
+
+	low = low[:sn]
+	high = high[:dn]
+	copy(low, data[:sn])
+	copy(high, data[sn:])
+
+	alpha, beta, gamma, delta, k, invK := lift97Coeffs[T]()
+	ScaleSlice(low, sn, k)
+	ScaleSlice(high, dn, invK)
+	LiftStep97(low, sn, high, dn, delta, 1-phase)
+	LiftStep97(high, dn, low, sn, gamma, phase)
+	LiftStep97(low, sn, high, dn, beta, 1-phase)
+	LiftStep97(high, dn, low, sn, alpha, phase)
+
+	Interleave(data, low, sn, high, dn, phase)
+}
+
+// Analyze97Cols applies the forward 9/7 wavelet transform to multiple columns
+// simultaneously. colBuf, lowBuf and highBuf follow the Synthesize53Cols layout.
+func Analyze97Cols[T hwy.FloatsNative](colBuf []T, height int, phase int, lowBuf, highBuf []T) {
+	lanes := hwy.MaxLanes[T]()
+	sn, dn := subbandLens(height, phase)
+	if sn == 0 || dn == 0 {
+		if phase == 1 && height == 1 {
+			for c := range lanes {
+				colBuf[c] *= 2
+			}
+		}
+		return
+	}
+
+	for y := range sn {
+		src := (2*y + phase) * lanes
+		copy(lowBuf[y*lanes:(y+1)*lanes], colBuf[src:src+lanes])
+	}
+	for y := range dn {
+		src := (2*y + 1 - phase) * lanes
+		copy(highBuf[y*lanes:(y+1)*lanes], colBuf[src:src+lanes])
+	}
+
+	alpha, beta, gamma, delta, k, invK := lift97Coeffs[T]()
+	LiftStep97Cols(highBuf, dn, lowBuf, sn, -alpha, phase)
+	LiftStep97Cols(lowBuf, sn, highBuf, dn, -beta, 1-phase)
+	LiftStep97Cols(highBuf, dn, lowBuf, sn, -gamma, phase)
+	LiftStep97Cols(lowBuf, sn, highBuf, dn, -delta, 1-phase)
+	ScaleSlice(lowBuf, sn*lanes, invK)
+	ScaleSlice(highBuf, dn*lanes, k)
+
+	copy(colBuf[:sn*lanes], lowBuf[:sn*lanes])
+	copy(colBuf[sn*lanes:(sn+dn)*lanes], highBuf[:dn*lanes])
+}
+
+// Synthesize97Cols applies the inverse 9/7 wavelet transform to multiple columns
+// simultaneously. colBuf, lowBuf and highBuf follow the Synthesize53Cols layout.
+func Synthesize97Cols[T hwy.FloatsNative](colBuf []T, height int, phase int, lowBuf, highBuf []T) {
+	lanes := hwy.MaxLanes[T]()
+	sn, dn := subbandLens(height, phase)
+	if sn == 0 || dn == 0 {
+		if phase == 1 && height == 1 {
+			for c := range lanes {
+				colBuf[c] /= 2
+			}
+		}
+		return
+	}
+
+	copy(lowBuf[:sn*lanes], colBuf[:sn*lanes])
+	copy(highBuf[:dn*lanes], colBuf[sn*lanes:(sn+dn)*lanes])
+
+	alpha, beta, gamma, delta, k, invK := lift97Coeffs[T]()
+	ScaleSlice(lowBuf, sn*lanes, k)
+	ScaleSlice(highBuf, dn*lanes, invK)
+	LiftStep97Cols(lowBuf, sn, highBuf, dn, delta, 1-phase)
+	LiftStep97Cols(highBuf, dn, lowBuf, sn, gamma, phase)
+	LiftStep97Cols(lowBuf, sn, highBuf, dn, beta, 1-phase)
+	LiftStep97Cols(highBuf, dn, lowBuf, sn, alpha, phase)
+
+	for y := range sn {
+		dst := (2*y + phase) * lanes
+		copy(colBuf[dst:dst+lanes], lowBuf[y*lanes:(y+1)*lanes])
+	}
+	for y := range dn {
+		dst := (2*y + 1 - phase) * lanes
+		copy(colBuf[dst:dst+lanes], highBuf[y*lanes:(y+1)*lanes])
+	}
+}
+
+// subbandLens returns the low-pass and high-pass lengths of an n-sample signal
+// whose first sample is even (phase=0) or odd (phase=1).
+func subbandLens(n, phase int) (sn, dn int) {
+	if phase == 0 {
+		return (n + 1) / 2, n / 2
+	}
+	return n / 2, (n + 1) / 2
+}
@@ -23,59 +23,63 @@ import "math"
 // ConvertToInt32 converts float types to int32 (truncate toward zero).
 // For values outside the int32 range, the result is undefined.
 func ConvertToInt32[T Floats](v Vec[T]) Vec[int32] {
-	result := make([]int32, len(v.data))
+	out := makeVec[int32](v.NumLanes())
+	result := out.data()
 	var zero T
 	switch any(zero).(type) {
 	case Float16:
-		for i := 0; i < len(v.data); i++ {
-			result[i] = int32(any(v.data[i]).(Float16).Float32())
+		for i := 0; i < v.NumLanes(); i++ {
+			result[i] = int32(any(v.data()[i]).(Float16).Float32())
 		}
 	case BFloat16:
-		for i := 0; i < len(v.data); i++ {
-			result[i] = int32(any(v.data[i]).(BFloat16).Float32())
+		for i := 0; i < v.NumLanes(); i++ {
+			result[i] = int32(any(v.data()[i]).(BFloat16).Float32())
 		}
 	case float32:
-		data := any(v.data).([]float32)
+		data := any(v.data()).([]float32)
 		for i := range data {
 			result[i] = int32(data[i])
 		}
 	case float64:
-		data := any(v.data).([]float64)
+		data := any(v.data()).([]float64)
 		for i := range data {
 			result[i] = int32(data[i])
 		}
 	}
-	return Vec[int32]{data: result}
+	return out
 }
 
 // ConvertToFloat32 converts int32 or int64 to float32.
 // Large int64 values may lose precision.
 func ConvertToFloat32[T ~int32 | ~int64](v Vec[T]) Vec[float32] {
-	result := make([]float32, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = float32(v.data[i])
+	out := makeVec[float32](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = float32(v.data()[i])
 	}
-	return Vec[float32]{data: result}
+	return out
 }
 
 // ConvertToF16 converts int32 to Float16.
 // Values are converted through float32 first.
 func ConvertToF16(v Vec[int32]) Vec[Float16] {
-	result := make([]Float16, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = Float32ToFloat16(float32(v.data[i]))
+	out := makeVec[Float16](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = Float32ToFloat16(float32(v.data()[i]))
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // ConvertToBF16 converts int32 to BFloat16.
 // Values are converted through float32 first.
 func ConvertToBF16(v Vec[int32]) Vec[BFloat16] {
-	result := make([]BFloat16, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = Float32ToBFloat16(float32(v.data[i]))
+	out := makeVec[BFloat16](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = Float32ToBFloat16(float32(v.data()[i]))
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // ConvertExponentToFloat converts integer exponents to the target float type.
@@ -85,10 +89,11 @@ func ConvertToBF16(v Vec[int32]) Vec[BFloat16] {
 func ConvertExponentToFloat[T Floats](e Vec[int32]) Vec[T] {
 	// This is the fallback/scalar implementation.
 	// hwygen will specialize this for each target type.
-	result := make([]T, len(e.data))
-	for i := 0; i < len(e.data); i++ {
+	out := makeVec[T](e.NumLanes())
+	result := out.data()
+	for i := 0; i < e.NumLanes(); i++ {
 		// Use float64 as intermediate to avoid type assertion issues
-		f := float64(e.data[i])
+		f := float64(e.data()[i])
 		switch r := (any)(result).(type) {
 		case []Float16:
 			r[i] = Float32ToFloat16(float32(f))
@@ -100,35 +105,38 @@ func ConvertExponentToFloat[T Floats](e Vec[int32]) Vec[T] {
 			r[i] = f
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // ConvertToInt64 converts float64 to int64 (truncate toward zero).
 // For values outside the int64 range, the result is undefined.
 func ConvertToInt64[T ~float64](v Vec[T]) Vec[int64] {
-	result := make([]int64, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = int64(v.data[i])
+	out := makeVec[int64](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = int64(v.data()[i])
 	}
-	return Vec[int64]{data: result}
+	return out
 }
 
 // ConvertToFloat64 converts int32 or int64 to float64.
 // Large int64 values may lose precision.
 func ConvertToFloat64[T ~int32 | ~int64](v Vec[T]) Vec[float64] {
-	result := make([]float64, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = float64(v.data[i])
+	out := makeVec[float64](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = float64(v.data()[i])
 	}
-	return Vec[float64]{data: result}
+	return out
 }
 
 // Round rounds each lane to the nearest integer (using banker's rounding).
 func Round[T Floats](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
 		var val T
-		switch x := any(v.data[i]).(type) {
+		switch x := any(v.data()[i]).(type) {
 		case Float16:
 			val = any(Float32ToFloat16(float32(math.Round(float64(x.Float32()))))).(T)
 		case BFloat16:
@@ -140,15 +148,16 @@ func Round[T Floats](v Vec[T]) Vec[T] {
 		}
 		result[i] = val
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Trunc truncates each lane toward zero.
 func Trunc[T Floats](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
 		var val T
-		switch x := any(v.data[i]).(type) {
+		switch x := any(v.data()[i]).(type) {
 		case Float16:
 			val = any(Float32ToFloat16(float32(math.Trunc(float64(x.Float32()))))).(T)
 		case BFloat16:
@@ -160,15 +169,16 @@ func Trunc[T Floats](v Vec[T]) Vec[T] {
 		}
 		result[i] = val
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Ceil rounds each lane up (toward positive infinity).
 func Ceil[T Floats](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
 		var val T
-		switch x := any(v.data[i]).(type) {
+		switch x := any(v.data()[i]).(type) {
 		case Float16:
 			val = any(Float32ToFloat16(float32(math.Ceil(float64(x.Float32()))))).(T)
 		case BFloat16:
@@ -180,15 +190,16 @@ func Ceil[T Floats](v Vec[T]) Vec[T] {
 		}
 		result[i] = val
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Floor rounds each lane down (toward negative infinity).
 func Floor[T Floats](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
 		var val T
-		switch x := any(v.data[i]).(type) {
+		switch x := any(v.data()[i]).(type) {
 		case Float16:
 			val = any(Float32ToFloat16(float32(math.Floor(float64(x.Float32()))))).(T)
 		case BFloat16:
@@ -200,17 +211,18 @@ func Floor[T Floats](v Vec[T]) Vec[T] {
 		}
 		result[i] = val
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // NearestInt rounds each lane to the nearest integer and returns the same type.
 // This is similar to Round but ensures the result is an integral value
 // stored in the floating-point type.
 func NearestInt[T Floats](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
 		var val T
-		switch x := any(v.data[i]).(type) {
+		switch x := any(v.data()[i]).(type) {
 		case Float16:
 			val = any(Float32ToFloat16(float32(math.RoundToEven(float64(x.Float32()))))).(T)
 		case BFloat16:
@@ -222,83 +234,91 @@ func NearestInt[T Floats](v Vec[T]) Vec[T] {
 		}
 		result[i] = val
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // BitCastF32ToI32 reinterprets float32 bits as int32 without conversion.
 // This is a bitwise reinterpretation, not a numeric conversion.
 func BitCastF32ToI32(v Vec[float32]) Vec[int32] {
-	result := make([]int32, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = int32(math.Float32bits(v.data[i]))
+	out := makeVec[int32](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = int32(math.Float32bits(v.data()[i]))
 	}
-	return Vec[int32]{data: result}
+	return out
 }
 
 // BitCastI32ToF32 reinterprets int32 bits as float32 without conversion.
 // This is a bitwise reinterpretation, not a numeric conversion.
 func BitCastI32ToF32(v Vec[int32]) Vec[float32] {
-	result := make([]float32, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = math.Float32frombits(uint32(v.data[i]))
+	out := makeVec[float32](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = math.Float32frombits(uint32(v.data()[i]))
 	}
-	return Vec[float32]{data: result}
+	return out
 }
 
 // BitCastF64ToI64 reinterprets float64 bits as int64 without conversion.
 // This is a bitwise reinterpretation, not a numeric conversion.
 func BitCastF64ToI64(v Vec[float64]) Vec[int64] {
-	result := make([]int64, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = int64(math.Float64bits(v.data[i]))
+	out := makeVec[int64](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = int64(math.Float64bits(v.data()[i]))
 	}
-	return Vec[int64]{data: result}
+	return out
 }
 
 // BitCastI64ToF64 reinterprets int64 bits as float64 without conversion.
 // This is a bitwise reinterpretation, not a numeric conversion.
 func BitCastI64ToF64(v Vec[int64]) Vec[float64] {
-	result := make([]float64, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = math.Float64frombits(uint64(v.data[i]))
+	out := makeVec[float64](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = math.Float64frombits(uint64(v.data()[i]))
 	}
-	return Vec[float64]{data: result}
+	return out
 }
 
 // BitCastU32ToF32 reinterprets uint32 bits as float32 without conversion.
 func BitCastU32ToF32(v Vec[uint32]) Vec[float32] {
-	result := make([]float32, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = math.Float32frombits(v.data[i])
+	out := makeVec[float32](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = math.Float32frombits(v.data()[i])
 	}
-	return Vec[float32]{data: result}
+	return out
 }
 
 // BitCastF32ToU32 reinterprets float32 bits as uint32 without conversion.
 func BitCastF32ToU32(v Vec[float32]) Vec[uint32] {
-	result := make([]uint32, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = math.Float32bits(v.data[i])
+	out := makeVec[uint32](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = math.Float32bits(v.data()[i])
 	}
-	return Vec[uint32]{data: result}
+	return out
 }
 
 // BitCastU64ToF64 reinterprets uint64 bits as float64 without conversion.
 func BitCastU64ToF64(v Vec[uint64]) Vec[float64] {
-	result := make([]float64, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = math.Float64frombits(v.data[i])
+	out := makeVec[float64](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = math.Float64frombits(v.data()[i])
 	}
-	return Vec[float64]{data: result}
+	return out
 }
 
 // BitCastF64ToU64 reinterprets float64 bits as uint64 without conversion.
 func BitCastF64ToU64(v Vec[float64]) Vec[uint64] {
-	result := make([]uint64, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = math.Float64bits(v.data[i])
+	out := makeVec[uint64](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = math.Float64bits(v.data()[i])
 	}
-	return Vec[uint64]{data: result}
+	return out
 }
 
 // ============================================================================
@@ -310,14 +330,15 @@ func BitCastF64ToU64(v Vec[float64]) Vec[uint64] {
 // k should be in the valid exponent range: [-126, 127] for float32, [-1022, 1023] for float64.
 // For Float16/BFloat16, the computation is done in float32 and converted back.
 func Pow2[T Floats](k Vec[int32]) Vec[T] {
-	result := make([]T, len(k.data))
+	out := makeVec[T](k.NumLanes())
+	result := out.data()
 	// Determine type at runtime
 	var zero T
 	switch any(zero).(type) {
 	case Float16:
 		// Float16: compute in float32, convert back
 		// Float16 exponent range is [-14, 15] but we compute via float32
-		for i, ki := range k.data {
+		for i, ki := range k.data() {
 			var f float32
 			if ki < -126 {
 				f = 0 // underflow
@@ -331,7 +352,7 @@ func Pow2[T Floats](k Vec[int32]) Vec[T] {
 		}
 	case BFloat16:
 		// BFloat16: compute in float32, convert back
-		for i, ki := range k.data {
+		for i, ki := range k.data() {
 			var f float32
 			if ki < -126 {
 				f = 0 // underflow
@@ -346,7 +367,7 @@ func Pow2[T Floats](k Vec[int32]) Vec[T] {
 	case float32:
 		// float32: exponent in bits [23:30], bias = 127
 		// 2^k = bits (k+127) << 23 interpreted as float32
-		for i, ki := range k.data {
+		for i, ki := range k.data() {
 			var f float32
 			if ki < -126 {
 				f = 0 // underflow
@@ -361,7 +382,7 @@ func Pow2[T Floats](k Vec[int32]) Vec[T] {
 	case float64:
 		// float64: exponent in bits [52:62], bias = 1023
 		// 2^k = bits (k+1023) << 52 interpreted as float64
-		for i, ki := range k.data {
+		for i, ki := range k.data() {
 			var f float64
 			if ki < -1022 {
 				f = 0 // underflow
@@ -374,7 +395,7 @@ func Pow2[T Floats](k Vec[int32]) Vec[T] {
 			result[i] = any(f).(T)
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // GetExponent[T Floats](v) extracts the unbiased exponent from IEEE 754 floats.
@@ -382,12 +403,13 @@ func Pow2[T Floats](k Vec[int32]) Vec[T] {
 // For denormals and special values, behavior is implementation-defined.
 // For Float16/BFloat16, the value is converted to float32 first.
 func GetExponent[T Floats](v Vec[T]) Vec[int32] {
-	result := make([]int32, len(v.data))
+	out := makeVec[int32](v.NumLanes())
+	result := out.data()
 	var zero T
 	switch any(zero).(type) {
 	case Float16:
 		// Float16: exponent in bits [10:14], bias = 15
-		for i, x := range v.data {
+		for i, x := range v.data() {
 			bits := uint16(any(x).(Float16))
 			exp := int32((bits >> 10) & 0x1F)
 			if exp == 0 || exp == 31 {
@@ -398,7 +420,7 @@ func GetExponent[T Floats](v Vec[T]) Vec[int32] {
 		}
 	case BFloat16:
 		// BFloat16: same exponent format as float32 (8 bits), bias = 127
-		for i, x := range v.data {
+		for i, x := range v.data() {
 			bits := uint16(any(x).(BFloat16))
 			exp := int32((bits >> 7) & 0xFF)
 			if exp == 0 || exp == 255 {
@@ -408,7 +430,7 @@ func GetExponent[T Floats](v Vec[T]) Vec[int32] {
 			}
 		}
 	case float32:
-		for i, x := range v.data {
+		for i, x := range v.data() {
 			bits := math.Float32bits(any(x).(float32))
 			exp := int32((bits >> 23) & 0xFF)
 			if exp == 0 || exp == 255 {
@@ -418,7 +440,7 @@ func GetExponent[T Floats](v Vec[T]) Vec[int32] {
 			}
 		}
 	case float64:
-		for i, x := range v.data {
+		for i, x := range v.data() {
 			bits := math.Float64bits(any(x).(float64))
 			exp := int32((bits >> 52) & 0x7FF)
 			if exp == 0 || exp == 2047 {
@@ -428,20 +450,21 @@ func GetExponent[T Floats](v Vec[T]) Vec[int32] {
 			}
 		}
 	}
-	return Vec[int32]{data: result}
+	return out
 }
 
 // GetMantissa[T Floats](v) extracts the mantissa with exponent normalized to [1, 2).
 // Returns a value m such that v = 2^exp * m, where 1 <= m < 2.
 // For denormals and special values, behavior is implementation-defined.
 func GetMantissa[T Floats](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
 	var zero T
 	switch any(zero).(type) {
 	case Float16:
 		// Float16: sign(1) | exp(5) | mantissa(10)
 		// Clear exponent, set to 15 (2^0 = 1)
-		for i, x := range v.data {
+		for i, x := range v.data() {
 			bits := uint16(any(x).(Float16))
 			// Mask: keep sign (bit 15) and mantissa (bits 0-9), set exponent to 15
 			mantissa := (bits & 0x83FF) | 0x3C00 // 0x3C00 = exponent 15 << 10
@@ -450,26 +473,26 @@ func GetMantissa[T Floats](v Vec[T]) Vec[T] {
 	case BFloat16:
 		// BFloat16: sign(1) | exp(8) | mantissa(7)
 		// Clear exponent, set to 127 (2^0 = 1)
-		for i, x := range v.data {
+		for i, x := range v.data() {
 			bits := uint16(any(x).(BFloat16))
 			// Mask: keep sign (bit 15) and mantissa (bits 0-6), set exponent to 127
 			mantissa := (bits & 0x807F) | 0x3F80 // 0x3F80 = exponent 127 << 7
 			result[i] = any(BFloat16(mantissa)).(T)
 		}
 	case float32:
-		for i, x := range v.data {
+		for i, x := range v.data() {
 			bits := math.Float32bits(any(x).(float32))
 			// Clear exponent, set to 127 (2^0 = 1)
 			mantissa := (bits & 0x807FFFFF) | 0x3F800000
 			result[i] = any(math.Float32frombits(mantissa)).(T)
 		}
 	case float64:
-		for i, x := range v.data {
+		for i, x := range v.data() {
 			bits := math.Float64bits(any(x).(float64))
 			// Clear exponent, set to 1023 (2^0 = 1)
 			mantissa := (bits & 0x800FFFFFFFFFFFFF) | 0x3FF0000000000000
 			result[i] = any(math.Float64frombits(mantissa)).(T)
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
@@ -58,8 +58,8 @@ func TestConvertToInt32_Float32(t *testing.T) {
 			result := ConvertToInt32(v)
 
 			for i := 0; i < result.NumLanes() && i < len(tt.want); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("lane %d: got %d, want %d", i, result.data[i], tt.want[i])
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("lane %d: got %d, want %d", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -90,8 +90,8 @@ func TestConvertToInt32_Float64(t *testing.T) {
 			result := ConvertToInt32(v)
 
 			for i := 0; i < result.NumLanes() && i < len(tt.want); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("lane %d: got %d, want %d", i, result.data[i], tt.want[i])
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("lane %d: got %d, want %d", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -127,8 +127,8 @@ func TestConvertToFloat32_Int32(t *testing.T) {
 			result := ConvertToFloat32(v)
 
 			for i := 0; i < result.NumLanes() && i < len(tt.want); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("lane %d: got %f, want %f", i, result.data[i], tt.want[i])
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("lane %d: got %f, want %f", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -159,8 +159,8 @@ func TestConvertToFloat32_Int64(t *testing.T) {
 			result := ConvertToFloat32(v)
 
 			for i := 0; i < result.NumLanes() && i < len(tt.want); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("lane %d: got %f, want %f", i, result.data[i], tt.want[i])
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("lane %d: got %f, want %f", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -191,8 +191,8 @@ func TestConvertToInt64_Float64(t *testing.T) {
 			result := ConvertToInt64(v)
 
 			for i := 0; i < result.NumLanes() && i < len(tt.want); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("lane %d: got %d, want %d", i, result.data[i], tt.want[i])
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("lane %d: got %d, want %d", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -207,8 +207,8 @@ func TestConvertToFloat64(t *testing.T) {
 
 		for i := 0; i < result.NumLanes() && i < len(input); i++ {
 			want := float64(input[i])
-			if result.data[i] != want {
-				t.Errorf("lane %d: got %f, want %f", i, result.data[i], want)
+			if result.data()[i] != want {
+				t.Errorf("lane %d: got %f, want %f", i, result.data()[i], want)
 			}
 		}
 	})
@@ -220,8 +220,8 @@ func TestConvertToFloat64(t *testing.T) {
 
 		for i := 0; i < result.NumLanes() && i < len(input); i++ {
 			want := float64(input[i])
-			if result.data[i] != want {
-				t.Errorf("lane %d: got %f, want %f", i, result.data[i], want)
+			if result.data()[i] != want {
+				t.Errorf("lane %d: got %f, want %f", i, result.data()[i], want)
 			}
 		}
 	})
@@ -247,8 +247,8 @@ func TestRound(t *testing.T) {
 			v := Set[float32](tt.input)
 			result := Round(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("Round(%f): got %f, want %f", tt.input, result.data[0], tt.want)
+			if result.data()[0] != tt.want {
+				t.Errorf("Round(%f): got %f, want %f", tt.input, result.data()[0], tt.want)
 			}
 		}
 	})
@@ -268,8 +268,8 @@ func TestRound(t *testing.T) {
 			v := Set[float64](tt.input)
 			result := Round(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("Round(%f): got %f, want %f", tt.input, result.data[0], tt.want)
+			if result.data()[0] != tt.want {
+				t.Errorf("Round(%f): got %f, want %f", tt.input, result.data()[0], tt.want)
 			}
 		}
 	})
@@ -293,8 +293,8 @@ func TestTrunc(t *testing.T) {
 			v := Set[float32](tt.input)
 			result := Trunc(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("Trunc(%f): got %f, want %f", tt.input, result.data[0], tt.want)
+			if result.data()[0] != tt.want {
+				t.Errorf("Trunc(%f): got %f, want %f", tt.input, result.data()[0], tt.want)
 			}
 		}
 	})
@@ -313,8 +313,8 @@ func TestTrunc(t *testing.T) {
 			v := Set[float64](tt.input)
 			result := Trunc(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("Trunc(%f): got %f, want %f", tt.input, result.data[0], tt.want)
+			if result.data()[0] != tt.want {
+				t.Errorf("Trunc(%f): got %f, want %f", tt.input, result.data()[0], tt.want)
 			}
 		}
 	})
@@ -339,8 +339,8 @@ func TestCeil(t *testing.T) {
 			v := Set[float32](tt.input)
 			result := Ceil(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("Ceil(%f): got %f, want %f", tt.input, result.data[0], tt.want)
+			if result.data()[0] != tt.want {
+				t.Errorf("Ceil(%f): got %f, want %f", tt.input, result.data()[0], tt.want)
 			}
 		}
 	})
@@ -359,8 +359,8 @@ func TestCeil(t *testing.T) {
 			v := Set[float64](tt.input)
 			result := Ceil(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("Ceil(%f): got %f, want %f", tt.input, result.data[0], tt.want)
+			if result.data()[0] != tt.want {
+				t.Errorf("Ceil(%f): got %f, want %f", tt.input, result.data()[0], tt.want)
 			}
 		}
 	})
@@ -385,8 +385,8 @@ func TestFloor(t *testing.T) {
 			v := Set[float32](tt.input)
 			result := Floor(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("Floor(%f): got %f, want %f", tt.input, result.data[0], tt.want)
+			if result.data()[0] != tt.want {
+				t.Errorf("Floor(%f): got %f, want %f", tt.input, result.data()[0], tt.want)
 			}
 		}
 	})
@@ -405,8 +405,8 @@ func TestFloor(t *testing.T) {
 			v := Set[float64](tt.input)
 			result := Floor(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("Floor(%f): got %f, want %f", tt.input, result.data[0], tt.want)
+			if result.data()[0] != tt.want {
+				t.Errorf("Floor(%f): got %f, want %f", tt.input, result.data()[0], tt.want)
 			}
 		}
 	})
@@ -433,8 +433,8 @@ func TestNearestInt(t *testing.T) {
 			v := Set[float32](tt.input)
 			result := NearestInt(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("NearestInt(%f): got %f, want %f", tt.input, result.data[0], tt.want)
+			if result.data()[0] != tt.want {
+				t.Errorf("NearestInt(%f): got %f, want %f", tt.input, result.data()[0], tt.want)
 			}
 		}
 	})
@@ -454,8 +454,8 @@ func TestNearestInt(t *testing.T) {
 			v := Set[float64](tt.input)
 			result := NearestInt(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("NearestInt(%f): got %f, want %f", tt.input, result.data[0], tt.want)
+			if result.data()[0] != tt.want {
+				t.Errorf("NearestInt(%f): got %f, want %f", tt.input, result.data()[0], tt.want)
 			}
 		}
 	})
@@ -479,8 +479,8 @@ func TestBitCastF32ToI32(t *testing.T) {
 			v := Set[float32](tt.input)
 			result := BitCastF32ToI32(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("BitCastF32ToI32(%f): got 0x%08X, want 0x%08X", tt.input, uint32(result.data[0]), uint32(tt.want))
+			if result.data()[0] != tt.want {
+				t.Errorf("BitCastF32ToI32(%f): got 0x%08X, want 0x%08X", tt.input, uint32(result.data()[0]), uint32(tt.want))
 			}
 		})
 	}
@@ -503,8 +503,8 @@ func TestBitCastI32ToF32(t *testing.T) {
 			v := Set[int32](tt.input)
 			result := BitCastI32ToF32(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("BitCastI32ToF32(0x%08X): got %f, want %f", uint32(tt.input), result.data[0], tt.want)
+			if result.data()[0] != tt.want {
+				t.Errorf("BitCastI32ToF32(0x%08X): got %f, want %f", uint32(tt.input), result.data()[0], tt.want)
 			}
 		})
 	}
@@ -518,8 +518,8 @@ func TestBitCastRoundTrip_F32I32(t *testing.T) {
 		asInt := BitCastF32ToI32(v)
 		backToFloat := BitCastI32ToF32(asInt)
 
-		if backToFloat.data[0] != val {
-			t.Errorf("BitCast round trip failed for %f: got %f", val, backToFloat.data[0])
+		if backToFloat.data()[0] != val {
+			t.Errorf("BitCast round trip failed for %f: got %f", val, backToFloat.data()[0])
 		}
 	}
 }
@@ -541,8 +541,8 @@ func TestBitCastF64ToI64(t *testing.T) {
 			v := Set[float64](tt.input)
 			result := BitCastF64ToI64(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("BitCastF64ToI64(%f): got 0x%016X, want 0x%016X", tt.input, uint64(result.data[0]), uint64(tt.want))
+			if result.data()[0] != tt.want {
+				t.Errorf("BitCastF64ToI64(%f): got 0x%016X, want 0x%016X", tt.input, uint64(result.data()[0]), uint64(tt.want))
 			}
 		})
 	}
@@ -565,8 +565,8 @@ func TestBitCastI64ToF64(t *testing.T) {
 			v := Set[int64](tt.input)
 			result := BitCastI64ToF64(v)
 
-			if result.data[0] != tt.want {
-				t.Errorf("BitCastI64ToF64(0x%016X): got %f, want %f", uint64(tt.input), result.data[0], tt.want)
+			if result.data()[0] != tt.want {
+				t.Errorf("BitCastI64ToF64(0x%016X): got %f, want %f", uint64(tt.input), result.data()[0], tt.want)
 			}
 		})
 	}
@@ -580,8 +580,8 @@ func TestBitCastRoundTrip_F64I64(t *testing.T) {
 		asInt := BitCastF64ToI64(v)
 		backToFloat := BitCastI64ToF64(asInt)
 
-		if backToFloat.data[0] != val {
-			t.Errorf("BitCast round trip failed for %f: got %f", val, backToFloat.data[0])
+		if backToFloat.data()[0] != val {
+			t.Errorf("BitCast round trip failed for %f: got %f", val, backToFloat.data()[0])
 		}
 	}
 }
@@ -590,16 +590,16 @@ func TestBitCastU32F32(t *testing.T) {
 	t.Run("U32 to F32", func(t *testing.T) {
 		v := Set[uint32](0x3f800000)
 		result := BitCastU32ToF32(v)
-		if result.data[0] != 1.0 {
-			t.Errorf("BitCastU32ToF32(0x3f800000): got %f, want 1.0", result.data[0])
+		if result.data()[0] != 1.0 {
+			t.Errorf("BitCastU32ToF32(0x3f800000): got %f, want 1.0", result.data()[0])
 		}
 	})
 
 	t.Run("F32 to U32", func(t *testing.T) {
 		v := Set[float32](1.0)
 		result := BitCastF32ToU32(v)
-		if result.data[0] != 0x3f800000 {
-			t.Errorf("BitCastF32ToU32(1.0): got 0x%08X, want 0x3f800000", result.data[0])
+		if result.data()[0] != 0x3f800000 {
+			t.Errorf("BitCastF32ToU32(1.0): got 0x%08X, want 0x3f800000", result.data()[0])
 		}
 	})
 }
@@ -608,16 +608,16 @@ func TestBitCastU64F64(t *testing.T) {
 	t.Run("U64 to F64", func(t *testing.T) {
 		v := Set[uint64](0x3ff0000000000000)
 		result := BitCastU64ToF64(v)
-		if result.data[0] != 1.0 {
-			t.Errorf("BitCastU64ToF64(0x3ff0000000000000): got %f, want 1.0", result.data[0])
+		if result.data()[0] != 1.0 {
+			t.Errorf("BitCastU64ToF64(0x3ff0000000000000): got %f, want 1.0", result.data()[0])
 		}
 	})
 
 	t.Run("F64 to U64", func(t *testing.T) {
 		v := Set[float64](1.0)
 		result := BitCastF64ToU64(v)
-		if result.data[0] != 0x3ff0000000000000 {
-			t.Errorf("BitCastF64ToU64(1.0): got 0x%016X, want 0x3ff0000000000000", result.data[0])
+		if result.data()[0] != 0x3ff0000000000000 {
+			t.Errorf("BitCastF64ToU64(1.0): got 0x%016X, want 0x3ff0000000000000", result.data()[0])
 		}
 	})
 }
@@ -651,8 +651,8 @@ func TestRoundEdgeCases(t *testing.T) {
 		nan := float32(math.NaN())
 		v := Set[float32](nan)
 		result := Round(v)
-		if !math.IsNaN(float64(result.data[0])) {
-			t.Errorf("Round(NaN) should be NaN, got %f", result.data[0])
+		if !math.IsNaN(float64(result.data()[0])) {
+			t.Errorf("Round(NaN) should be NaN, got %f", result.data()[0])
 		}
 	})
 
@@ -660,8 +660,8 @@ func TestRoundEdgeCases(t *testing.T) {
 		inf := float32(math.Inf(1))
 		v := Set[float32](inf)
 		result := Round(v)
-		if !math.IsInf(float64(result.data[0]), 1) {
-			t.Errorf("Round(+Inf) should be +Inf, got %f", result.data[0])
+		if !math.IsInf(float64(result.data()[0]), 1) {
+			t.Errorf("Round(+Inf) should be +Inf, got %f", result.data()[0])
 		}
 	})
 
@@ -669,8 +669,8 @@ func TestRoundEdgeCases(t *testing.T) {
 		inf := float32(math.Inf(-1))
 		v := Set[float32](inf)
 		result := Round(v)
-		if !math.IsInf(float64(result.data[0]), -1) {
-			t.Errorf("Round(-Inf) should be -Inf, got %f", result.data[0])
+		if !math.IsInf(float64(result.data()[0]), -1) {
+			t.Errorf("Round(-Inf) should be -Inf, got %f", result.data()[0])
 		}
 	})
 }
@@ -680,7 +680,7 @@ func TestTruncEdgeCases(t *testing.T) {
 		nan := float64(math.NaN())
 		v := Set[float64](nan)
 		result := Trunc(v)
-		if !math.IsNaN(result.data[0]) {
+		if !math.IsNaN(result.data()[0]) {
 			t.Errorf("Trunc(NaN) should be NaN")
 		}
 	})
@@ -689,7 +689,7 @@ func TestTruncEdgeCases(t *testing.T) {
 		inf := float64(math.Inf(1))
 		v := Set[float64](inf)
 		result := Trunc(v)
-		if !math.IsInf(result.data[0], 1) {
+		if !math.IsInf(result.data()[0], 1) {
 			t.Errorf("Trunc(+Inf) should be +Inf")
 		}
 	})
@@ -700,7 +700,7 @@ func TestCeilEdgeCases(t *testing.T) {
 		nan := float64(math.NaN())
 		v := Set[float64](nan)
 		result := Ceil(v)
-		if !math.IsNaN(result.data[0]) {
+		if !math.IsNaN(result.data()[0]) {
 			t.Errorf("Ceil(NaN) should be NaN")
 		}
 	})
@@ -711,7 +711,7 @@ func TestFloorEdgeCases(t *testing.T) {
 		nan := float64(math.NaN())
 		v := Set[float64](nan)
 		result := Floor(v)
-		if !math.IsNaN(result.data[0]) {
+		if !math.IsNaN(result.data()[0]) {
 			t.Errorf("Floor(NaN) should be NaN")
 		}
 	})
@@ -724,8 +724,8 @@ func TestBitCastPreservesBits_NaN(t *testing.T) {
 	asFloat := BitCastU32ToF32(v)
 	backToU32 := BitCastF32ToU32(asFloat)
 
-	if backToU32.data[0] != nanBits {
-		t.Errorf("BitCast round trip failed for NaN bits: got 0x%08X, want 0x%08X", backToU32.data[0], nanBits)
+	if backToU32.data()[0] != nanBits {
+		t.Errorf("BitCast round trip failed for NaN bits: got 0x%08X, want 0x%08X", backToU32.data()[0], nanBits)
 	}
 }
 
@@ -735,8 +735,8 @@ func TestBitCastPreservesBits_NegativeZero(t *testing.T) {
 	asInt := BitCastF32ToI32(v)
 
 	// Negative zero should have sign bit set (0x80000000 = min int32)
-	if asInt.data[0] != -0x80000000 {
-		t.Errorf("BitCast of -0.0: got 0x%08X, want 0x80000000", uint32(asInt.data[0]))
+	if asInt.data()[0] != -0x80000000 {
+		t.Errorf("BitCast of -0.0: got 0x%08X, want 0x80000000", uint32(asInt.data()[0]))
 	}
 }
 
@@ -755,8 +755,8 @@ func TestConvertLargeValues(t *testing.T) {
 		result := ConvertToFloat32(v)
 
 		expected := float32(largeInt)
-		if result.data[0] != expected {
-			t.Errorf("ConvertToFloat32(%d): got %f, want %f", largeInt, result.data[0], expected)
+		if result.data()[0] != expected {
+			t.Errorf("ConvertToFloat32(%d): got %f, want %f", largeInt, result.data()[0], expected)
 		}
 	})
 }
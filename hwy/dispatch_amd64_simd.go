@@ -32,6 +32,18 @@ var (
 	// AVX-512 FP16 is detected via CPUID leaf 7, subleaf 0, EDX bit 23
 	hasAVX512FP16 bool
 
+	// hasAVX2 indicates AVX2 with FMA support, the baseline for the AVX2
+	// assembly kernels (Haswell+)
+	hasAVX2 bool
+
+	// hasAVX512 indicates AVX-512 F/BW/DQ/VL support, the baseline for the
+	// AVX-512 assembly kernels (Skylake-X+)
+	hasAVX512 bool
+
+	// hasAVX512VPOPCNTDQ indicates native 32/64-bit vector popcount
+	// (VPOPCNTD/VPOPCNTQ, Ice Lake+ and Zen 4+)
+	hasAVX512VPOPCNTDQ bool
+
 	// hasAVX512BF16 indicates AVX-512 BF16 support: bfloat16 dot products (Cooper Lake+)
 	// Available from golang.org/x/sys/cpu
 	hasAVX512BF16 bool
@@ -45,6 +57,7 @@ func init() {
 	}
 
 	detectCPUFeatures()
+	detectAsmFeatures()
 	detectFP16BF16Features()
 }
 
@@ -67,6 +80,16 @@ func detectCPUFeatures() {
 	}
 }
 
+// detectAsmFeatures detects the CPU features required by the GoAT-compiled
+// AVX2 and AVX-512 kernels. It uses x/sys/cpu rather than archsimd so that
+// the assembly paths are available without GOEXPERIMENT=simd.
+func detectAsmFeatures() {
+	hasAVX2 = cpu.X86.HasAVX2 && cpu.X86.HasFMA
+	hasAVX512 = hasAVX2 && cpu.X86.HasAVX512F && cpu.X86.HasAVX512BW &&
+		cpu.X86.HasAVX512DQ && cpu.X86.HasAVX512VL
+	hasAVX512VPOPCNTDQ = hasAVX512 && cpu.X86.HasAVX512VPOPCNTDQ
+}
+
 func detectFP16BF16Features() {
 	// F16C detection: CPUID leaf 1, ECX bit 29
 	// F16C provides VCVTPH2PS and VCVTPS2PH instructions for float16 <-> float32 conversion
@@ -97,6 +120,20 @@ func setScalarMode() {
 	currentWidth = 16 // Use 16-byte vectors even in scalar mode for consistency
 }
 
+// HasAVX2 returns true if the CPU supports AVX2 and FMA.
+// It is the runtime guard for the AVX2 assembly kernels, which do not
+// depend on GOEXPERIMENT=simd.
+func HasAVX2() bool {
+	return hasAVX2
+}
+
+// HasAVX512 returns true if the CPU supports AVX-512 F, BW, DQ and VL.
+// It is the runtime guard for the AVX-512 assembly kernels, which do not
+// depend on GOEXPERIMENT=simd.
+func HasAVX512() bool {
+	return hasAVX512
+}
+
 // HasF16C returns true if the CPU supports F16C instructions.
 // F16C provides hardware-accelerated float16 <-> float32 conversions.
 // Present on Intel Haswell+ and AMD Piledriver+ CPUs.
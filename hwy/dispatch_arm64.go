@@ -125,6 +125,16 @@ func HasARMBF16() bool {
 	return hasARMBF16
 }
 
+// HasAVX2 returns false on ARM64 (AVX2 is x86-specific).
+func HasAVX2() bool {
+	return false
+}
+
+// HasAVX512 returns false on ARM64 (AVX-512 is x86-specific).
+func HasAVX512() bool {
+	return false
+}
+
 // HasF16C returns false on ARM64 (F16C is an x86-specific feature).
 // Use HasARMFP16() for ARM float16 support.
 func HasF16C() bool {
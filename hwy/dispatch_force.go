@@ -0,0 +1,443 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package hwy
+
+import (
+	"errors"
+	"fmt"
+	"io"
+	"os"
+	"path"
+	"reflect"
+	"runtime"
+	"strings"
+	"sync"
+	"text/tabwriter"
+)
+
+// DispatchTable describes the dispatch groups of one hwygen dispatch file.
+// Generated init functions pass it to RegisterDispatch after the default
+// selection has run; it is not meant to be built by hand.
+type DispatchTable struct {
+	// Package is the Go package name of the generated file, e.g. "vec".
+	Package string
+	// Groups lists the dispatch groups declared in the file.
+	Groups []DispatchGroup
+	// Targets lists the file's targets from most to least capable.
+	Targets []DispatchTarget
+}
+
+// DispatchGroup is one dispatch group, e.g. "Dot", with pointers to its
+// per-type function variables (&DotFloat32, &DotFloat64, ...).
+type DispatchGroup struct {
+	Name string
+	Vars []any
+}
+
+// DispatchTarget is one target a dispatch file can select.
+type DispatchTarget struct {
+	// Name is the lower-case target name used by HWY_FORCE, e.g. "avx2".
+	Name string
+	// Supported reports whether the running CPU can execute the target.
+	Supported bool
+	// Init assigns the target's implementations to every variable of the file.
+	Init func()
+}
+
+// DispatchInfo reports how one dispatch group was resolved.
+type DispatchInfo struct {
+	// Group is the qualified group name, e.g. "vec.Dot".
+	Group string
+	// Target is the target the group currently runs, or "custom" when its
+	// variables were replaced by hand-written code after registration
+	// (for example the SME kernels on arm64).
+	Target string
+	// Forced is true when the group was pinned by HWY_FORCE or ForceDispatch.
+	Forced bool
+	// Available lists the targets the group can be forced to on this CPU.
+	Available []string
+	// Impls names the function behind each per-type variable,
+	// e.g. "vec.BaseDot_avx2".
+	Impls []string
+	// Vars holds a pointer to each per-type function variable, e.g.
+	// &vec.DotFloat32, so tools can call a group without naming it. The
+	// variables follow later ForceDispatch calls.
+	Vars []any
+	// Note explains why a requested override was not applied.
+	Note string
+}
+
+// registeredTable is a DispatchTable together with the implementations each
+// supported target assigns, captured once at registration.
+type registeredTable struct {
+	pkg     string
+	groups  []registeredGroup
+	targets []DispatchTarget
+	// impls[t][g][v] is the value target t assigns to variable v of group g.
+	impls [][][]reflect.Value
+}
+
+type registeredGroup struct {
+	name string
+	vars []reflect.Value
+	// forced is the target the group was pinned to, or "".
+	forced string
+	note   string
+
+	// Profiling state, set when a hwyprof build wraps the group: wrap
+	// installs counting wrappers, wrapped holds them, unwrapped the
+	// implementations behind them and wrapTarget the target they belong to.
+	wrap       func(*KernelCounter)
+	wrapped    []reflect.Value
+	unwrapped  []reflect.Value
+	wrapTarget string
+}
+
+type forceRule struct {
+	pattern string
+	target  string
+}
+
+var (
+	dispatchMu     sync.Mutex
+	dispatchTables []*registeredTable
+
+	// forceRules holds the HWY_FORCE entries; later entries win.
+	forceRules, forceEnvErr = parseForceRules(os.Getenv("HWY_FORCE"))
+)
+
+// parseForceRules parses a HWY_FORCE value of the form
+// "matmul.MatMul=avx2,vec.Dot=fallback". Group names may use path.Match
+// patterns, e.g. "vec.*=fallback".
+func parseForceRules(s string) ([]forceRule, error) {
+	var rules []forceRule
+	for _, entry := range strings.Split(s, ",") {
+		entry = strings.TrimSpace(entry)
+		if entry == "" {
+			continue
+		}
+		group, target, ok := strings.Cut(entry, "=")
+		group, target = strings.TrimSpace(group), strings.TrimSpace(target)
+		if !ok || group == "" || target == "" {
+			return rules, fmt.Errorf("HWY_FORCE: malformed entry %q, want package.Group=target", entry)
+		}
+		if _, err := path.Match(group, ""); err != nil {
+			return rules, fmt.Errorf("HWY_FORCE: bad pattern %q: %w", group, err)
+		}
+		rules = append(rules, forceRule{pattern: group, target: strings.ToLower(target)})
+	}
+	return rules, nil
+}
+
+// RegisterDispatch records a generated dispatch file so its groups can be
+// pinned with HWY_FORCE or ForceDispatch and listed by DispatchReport.
+// Called from generated init functions.
+func RegisterDispatch(table DispatchTable) {
+	dispatchMu.Lock()
+	defer dispatchMu.Unlock()
+
+	rt := &registeredTable{
+		pkg:     table.Package,
+		targets: table.Targets,
+	}
+	for _, g := range table.Groups {
+		rg := registeredGroup{name: g.Name}
+		for _, v := range g.Vars {
+			rg.vars = append(rg.vars, reflect.ValueOf(v).Elem())
+		}
+		rt.groups = append(rt.groups, rg)
+	}
+
+	// Run every supported target's init from the default state and capture
+	// what it assigns, then put the default selection back.
+	defaults := rt.snapshot()
+	rt.impls = make([][][]reflect.Value, len(rt.targets))
+	for i, t := range rt.targets {
+		if !t.Supported {
+			continue
+		}
+		t.Init()
+		rt.impls[i] = rt.snapshot()
+		rt.restore(defaults)
+	}
+
+	rt.applyForceRules()
+
+	for gi, g := range rt.groups {
+		key := rt.pkg + "." + g.name
+		if wrap, ok := pendingProfiles[key]; ok {
+			delete(pendingProfiles, key)
+			rt.groups[gi].wrap = wrap
+			rt.profile(gi)
+		}
+	}
+
+	dispatchTables = append(dispatchTables, rt)
+}
+
+// applyForceRules pins the table's groups named in HWY_FORCE.
+func (rt *registeredTable) applyForceRules() {
+	for gi := range rt.groups {
+		target := ""
+		for _, r := range forceRules {
+			if ok, _ := path.Match(r.pattern, rt.pkg+"."+rt.groups[gi].name); ok {
+				target = r.target
+			}
+		}
+		if target == "" {
+			continue
+		}
+		if err := rt.force(gi, target); err != nil {
+			rt.groups[gi].note = "HWY_FORCE: " + err.Error()
+		}
+	}
+}
+
+func (rt *registeredTable) snapshot() [][]reflect.Value {
+	s := make([][]reflect.Value, len(rt.groups))
+	for gi, g := range rt.groups {
+		s[gi] = snapshotVars(g.vars)
+	}
+	return s
+}
+
+// snapshotVars copies the current values of vars.
+func snapshotVars(vars []reflect.Value) []reflect.Value {
+	s := make([]reflect.Value, len(vars))
+	for i, v := range vars {
+		s[i] = reflect.ValueOf(v.Interface())
+	}
+	return s
+}
+
+func (rt *registeredTable) restore(s [][]reflect.Value) {
+	for gi, g := range rt.groups {
+		for vi, v := range g.vars {
+			v.Set(s[gi][vi])
+		}
+	}
+}
+
+// force pins group gi to the named target.
+func (rt *registeredTable) force(gi int, target string) error {
+	for ti, t := range rt.targets {
+		if t.Name != target {
+			continue
+		}
+		if !t.Supported {
+			return fmt.Errorf("%s.%s: target %s is not supported on this CPU", rt.pkg, rt.groups[gi].name, target)
+		}
+		for vi, v := range rt.groups[gi].vars {
+			v.Set(rt.impls[ti][gi][vi])
+		}
+		rt.groups[gi].forced = target
+		rt.groups[gi].note = ""
+		if rt.groups[gi].wrap != nil {
+			rt.profile(gi)
+		}
+		return nil
+	}
+	return fmt.Errorf("%s.%s: no %s implementation", rt.pkg, rt.groups[gi].name, target)
+}
+
+// ForceDispatch pins every registered dispatch group matching group
+// (e.g. "vec.Dot" or "vec.*") to target (e.g. "avx2" or "fallback"), the
+// same way a HWY_FORCE entry does at startup.
+//
+// It swaps the groups' function variables without synchronization, so call
+// it before the affected kernels are used concurrently, typically from main.
+// Groups that lack the target, or whose target the CPU cannot run, keep
+// their current implementation and are reported in the returned error.
+func ForceDispatch(group, target string) error {
+	if _, err := path.Match(group, ""); err != nil {
+		return fmt.Errorf("hwy: bad group pattern %q: %w", group, err)
+	}
+	target = strings.ToLower(target)
+
+	dispatchMu.Lock()
+	defer dispatchMu.Unlock()
+	var errs []error
+	matched := false
+	for _, rt := range dispatchTables {
+		for gi, g := range rt.groups {
+			if ok, _ := path.Match(group, rt.pkg+"."+g.name); !ok {
+				continue
+			}
+			matched = true
+			if err := rt.force(gi, target); err != nil {
+				errs = append(errs, err)
+			}
+		}
+	}
+	if !matched {
+		return fmt.Errorf("hwy: no dispatch group matches %q", group)
+	}
+	return errors.Join(errs...)
+}
+
+// ApplyDispatchEnv applies the HWY_FORCE entries again to every registered
+// group. Each dispatch file applies them when it registers, but hand-written
+// init functions that run later in the same package (the SME and assembly
+// overrides, for example) can replace a pinned implementation. Calling
+// ApplyDispatchEnv at the start of main pins those groups as well. It has
+// the same concurrency caveat as ForceDispatch.
+func ApplyDispatchEnv() error {
+	if forceEnvErr != nil {
+		return forceEnvErr
+	}
+	dispatchMu.Lock()
+	defer dispatchMu.Unlock()
+	for _, rt := range dispatchTables {
+		rt.applyForceRules()
+	}
+	return nil
+}
+
+// SaveDispatch records the implementation every registered group runs now,
+// including hand-written overrides, and returns a function that puts them
+// back and clears any pins made in between. Benchmarks and tests use it to
+// undo ForceDispatch. It has the same concurrency caveat as ForceDispatch.
+func SaveDispatch() (restore func()) {
+	dispatchMu.Lock()
+	defer dispatchMu.Unlock()
+	tables := append([]*registeredTable(nil), dispatchTables...)
+	saved := make([][]registeredGroup, len(tables))
+	values := make([][][]reflect.Value, len(tables))
+	for i, rt := range tables {
+		saved[i] = append([]registeredGroup(nil), rt.groups...)
+		values[i] = rt.snapshot()
+	}
+	return func() {
+		dispatchMu.Lock()
+		defer dispatchMu.Unlock()
+		for i, rt := range tables {
+			copy(rt.groups, saved[i])
+			rt.restore(values[i])
+		}
+	}
+}
+
+// resolvedTarget returns the target group gi currently runs, or "custom".
+func (rt *registeredTable) resolvedTarget(gi int) string {
+	g := &rt.groups[gi]
+	if g.wrapped != nil && sameFuncs(g.vars, g.wrapped) {
+		return g.wrapTarget
+	}
+	// Targets often share implementations (a NEON group without assembly
+	// runs the fallback code), so prefer the pinned target and otherwise
+	// report the most capable match.
+	target := "custom"
+	for ti, t := range rt.targets {
+		if !t.Supported || !sameFuncs(g.vars, rt.impls[ti][gi]) {
+			continue
+		}
+		if target == "custom" || t.Name == g.forced {
+			target = t.Name
+		}
+	}
+	return target
+}
+
+// DispatchReport lists every registered dispatch group with the target and
+// implementations it currently resolves to, in registration order.
+func DispatchReport() []DispatchInfo {
+	dispatchMu.Lock()
+	defer dispatchMu.Unlock()
+	var infos []DispatchInfo
+	for _, rt := range dispatchTables {
+		for gi, g := range rt.groups {
+			info := DispatchInfo{
+				Group:  rt.pkg + "." + g.name,
+				Target: rt.resolvedTarget(gi),
+				Forced: g.forced != "",
+				Note:   g.note,
+			}
+			for _, t := range rt.targets {
+				if t.Supported {
+					info.Available = append(info.Available, t.Name)
+				}
+			}
+			if info.Forced && info.Target != g.forced && info.Note == "" {
+				info.Note = "pinned to " + g.forced + " but replaced by a later init override"
+			}
+			impls := g.vars
+			if g.wrapped != nil && sameFuncs(g.vars, g.wrapped) {
+				impls = g.unwrapped
+			}
+			for _, v := range impls {
+				info.Impls = append(info.Impls, funcName(v))
+			}
+			for _, v := range g.vars {
+				info.Vars = append(info.Vars, v.Addr().Interface())
+			}
+			infos = append(infos, info)
+		}
+	}
+	return infos
+}
+
+// WriteDispatchReport writes DispatchReport as an aligned table, one group
+// per line, preceded by any error found in HWY_FORCE.
+func WriteDispatchReport(w io.Writer) error {
+	if forceEnvErr != nil {
+		if _, err := fmt.Fprintf(w, "%v\n", forceEnvErr); err != nil {
+			return err
+		}
+	}
+	tw := tabwriter.NewWriter(w, 0, 8, 2, ' ', 0)
+	fmt.Fprintf(tw, "GROUP\tTARGET\tAVAILABLE\tIMPLEMENTATIONS\n")
+	for _, info := range DispatchReport() {
+		target := info.Target
+		if info.Forced {
+			target += " (forced)"
+		}
+		impls := strings.Join(info.Impls, " ")
+		if info.Note != "" {
+			impls += "  # " + info.Note
+		}
+		fmt.Fprintf(tw, "%s\t%s\t%s\t%s\n", info.Group, target, strings.Join(info.Available, ","), impls)
+	}
+	return tw.Flush()
+}
+
+// sameFuncs reports whether every variable holds the function in want.
+func sameFuncs(vars, want []reflect.Value) bool {
+	for i, v := range vars {
+		if v.IsNil() != want[i].IsNil() {
+			return false
+		}
+		if !v.IsNil() && v.Pointer() != want[i].Pointer() {
+			return false
+		}
+	}
+	return true
+}
+
+// funcName returns the package-qualified name of the function held by v,
+// e.g. "vec.BaseDot_avx2".
+func funcName(v reflect.Value) string {
+	if v.IsNil() {
+		return "<nil>"
+	}
+	fn := runtime.FuncForPC(v.Pointer())
+	if fn == nil {
+		return "?"
+	}
+	name := fn.Name()
+	if i := strings.LastIndexByte(name, '/'); i >= 0 {
+		name = name[i+1:]
+	}
+	return name
+}
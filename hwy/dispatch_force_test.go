@@ -0,0 +1,214 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package hwy
+
+import (
+	"bytes"
+	"strings"
+	"testing"
+)
+
+// A fake dispatch file with two groups and three targets, one of which the
+// "CPU" does not support.
+var (
+	forceAddFloat32 func(x float32) float32
+	forceAddFloat64 func(x float64) float64
+	forceMulFloat32 func(x float32) float32
+)
+
+func forceAddWide(x float32) float32     { return x + 3 }
+func forceAddWide64(x float64) float64   { return x + 3 }
+func forceAddFast(x float32) float32     { return x + 2 }
+func forceAddFast64(x float64) float64   { return x + 2 }
+func forceAddScalar(x float32) float32   { return x + 1 }
+func forceAddScalar64(x float64) float64 { return x + 1 }
+func forceMulFast(x float32) float32     { return x * 2 }
+func forceMulScalar(x float32) float32   { return x * 1 }
+func forceMulCustom(x float32) float32   { return x * 7 }
+
+func initForceWide() {
+	forceAddFloat32, forceAddFloat64 = forceAddWide, forceAddWide64
+	forceMulFloat32 = forceMulFast
+}
+
+func initForceFast() {
+	forceAddFloat32, forceAddFloat64 = forceAddFast, forceAddFast64
+	forceMulFloat32 = forceMulFast
+}
+
+func initForceFallback() {
+	forceAddFloat32, forceAddFloat64 = forceAddScalar, forceAddScalar64
+	forceMulFloat32 = forceMulScalar
+}
+
+func registerForceTest(pkg string) {
+	initForceFast()
+	RegisterDispatch(DispatchTable{
+		Package: pkg,
+		Groups: []DispatchGroup{
+			{Name: "Add", Vars: []any{&forceAddFloat32, &forceAddFloat64}},
+			{Name: "Mul", Vars: []any{&forceMulFloat32}},
+		},
+		Targets: []DispatchTarget{
+			{Name: "wide", Supported: false, Init: initForceWide},
+			{Name: "fast", Supported: true, Init: initForceFast},
+			{Name: "fallback", Supported: true, Init: initForceFallback},
+		},
+	})
+}
+
+func findDispatchInfo(t *testing.T, group string) DispatchInfo {
+	t.Helper()
+	for _, info := range DispatchReport() {
+		if info.Group == group {
+			return info
+		}
+	}
+	t.Fatalf("group %s not in DispatchReport", group)
+	return DispatchInfo{}
+}
+
+func TestParseForceRules(t *testing.T) {
+	rules, err := parseForceRules(" matmul.MatMul=AVX2, vec.*=fallback ,")
+	if err != nil {
+		t.Fatal(err)
+	}
+	want := []forceRule{{"matmul.MatMul", "avx2"}, {"vec.*", "fallback"}}
+	if len(rules) != len(want) {
+		t.Fatalf("got %v, want %v", rules, want)
+	}
+	for i := range want {
+		if rules[i] != want[i] {
+			t.Errorf("rule %d: got %v, want %v", i, rules[i], want[i])
+		}
+	}
+
+	for _, bad := range []string{"vec.Dot", "=avx2", "vec.Dot=", "vec.[=avx2"} {
+		if _, err := parseForceRules(bad); err == nil {
+			t.Errorf("parseForceRules(%q): expected error", bad)
+		}
+	}
+}
+
+func TestForceDispatch(t *testing.T) {
+	registerForceTest("forcetest")
+	defer initForceFast()
+
+	info := findDispatchInfo(t, "forcetest.Add")
+	if info.Target != "fast" || info.Forced {
+		t.Errorf("default: got target %q forced %v, want fast", info.Target, info.Forced)
+	}
+	if got := strings.Join(info.Available, ","); got != "fast,fallback" {
+		t.Errorf("available: got %s, want fast,fallback", got)
+	}
+	if len(info.Impls) != 2 || info.Impls[0] != "hwy.forceAddFast" {
+		t.Errorf("impls: got %v", info.Impls)
+	}
+	if len(info.Vars) != 2 || info.Vars[0] != any(&forceAddFloat32) {
+		t.Errorf("vars: got %v, want &forceAddFloat32 first", info.Vars)
+	}
+
+	// Pinning one group leaves the other on its default.
+	if err := ForceDispatch("forcetest.Add", "fallback"); err != nil {
+		t.Fatal(err)
+	}
+	if forceAddFloat32(1) != 2 || forceAddFloat64(1) != 2 || forceMulFloat32(3) != 6 {
+		t.Errorf("after forcing Add: got %v %v %v, want 2 2 6",
+			forceAddFloat32(1), forceAddFloat64(1), forceMulFloat32(3))
+	}
+	if info := findDispatchInfo(t, "forcetest.Add"); info.Target != "fallback" || !info.Forced {
+		t.Errorf("forced: got target %q forced %v, want fallback forced", info.Target, info.Forced)
+	}
+
+	// Patterns match several groups.
+	if err := ForceDispatch("forcetest.*", "fast"); err != nil {
+		t.Fatal(err)
+	}
+	if forceAddFloat32(1) != 3 || forceMulFloat32(3) != 6 {
+		t.Errorf("after forcing *: got %v %v, want 3 6", forceAddFloat32(1), forceMulFloat32(3))
+	}
+
+	// Unsupported and unknown targets keep the current implementation.
+	if err := ForceDispatch("forcetest.Add", "wide"); err == nil {
+		t.Error("forcing an unsupported target: expected error")
+	}
+	if err := ForceDispatch("forcetest.Add", "sve"); err == nil {
+		t.Error("forcing an unknown target: expected error")
+	}
+	if err := ForceDispatch("forcetest.Nope", "fast"); err == nil {
+		t.Error("forcing an unknown group: expected error")
+	}
+	if forceAddFloat32(1) != 3 {
+		t.Errorf("failed force changed Add: got %v, want 3", forceAddFloat32(1))
+	}
+
+	// A hand-written override after registration shows up as custom.
+	forceMulFloat32 = forceMulCustom
+	info = findDispatchInfo(t, "forcetest.Mul")
+	if info.Target != "custom" || info.Note == "" || info.Impls[0] != "hwy.forceMulCustom" {
+		t.Errorf("override: got %+v, want custom with a note", info)
+	}
+
+	var buf bytes.Buffer
+	if err := WriteDispatchReport(&buf); err != nil {
+		t.Fatal(err)
+	}
+	if !strings.Contains(buf.String(), "forcetest.Add") || !strings.Contains(buf.String(), "fast (forced)") {
+		t.Errorf("report missing forcetest.Add:\n%s", buf.String())
+	}
+}
+
+func TestRegisterDispatchAppliesForceRules(t *testing.T) {
+	saved := forceRules
+	defer func() { forceRules = saved }()
+	forceRules = []forceRule{{"forceenv.*", "fallback"}, {"forceenv.Mul", "wide"}}
+	defer initForceFast()
+
+	registerForceTest("forceenv")
+	if forceAddFloat32(1) != 2 {
+		t.Errorf("Add: got %v, want fallback result 2", forceAddFloat32(1))
+	}
+	// The later entry wins, but the CPU cannot run it, so Mul keeps the
+	// default and the report says why.
+	if forceMulFloat32(3) != 6 {
+		t.Errorf("Mul: got %v, want default result 6", forceMulFloat32(3))
+	}
+	if info := findDispatchInfo(t, "forceenv.Mul"); info.Target != "fast" || info.Note == "" {
+		t.Errorf("Mul: got %+v, want fast with a note", info)
+	}
+}
+
+func TestSaveDispatch(t *testing.T) {
+	registerForceTest("forcesave")
+	defer initForceFast()
+
+	// A hand-written override is part of the saved state.
+	forceMulFloat32 = forceMulCustom
+	restore := SaveDispatch()
+	if err := ForceDispatch("forcesave.*", "fallback"); err != nil {
+		t.Fatal(err)
+	}
+	if forceAddFloat32(1) != 2 || forceMulFloat32(3) != 3 {
+		t.Fatalf("forced: got %v %v, want 2 3", forceAddFloat32(1), forceMulFloat32(3))
+	}
+
+	restore()
+	if forceAddFloat32(1) != 3 || forceMulFloat32(3) != 21 {
+		t.Errorf("restored: got %v %v, want 3 21", forceAddFloat32(1), forceMulFloat32(3))
+	}
+	if info := findDispatchInfo(t, "forcesave.Add"); info.Target != "fast" || info.Forced {
+		t.Errorf("restored report: got %+v, want fast, not forced", info)
+	}
+}
@@ -27,6 +27,16 @@ func init() {
 	currentWidth = 16 // Use 16-byte vectors even in scalar mode for consistency
 }
 
+// HasAVX2 returns false on non-x86 platforms (AVX2 is x86-specific).
+func HasAVX2() bool {
+	return false
+}
+
+// HasAVX512 returns false on non-x86 platforms (AVX-512 is x86-specific).
+func HasAVX512() bool {
+	return false
+}
+
 // HasF16C returns false on non-x86 platforms (F16C is an x86-specific feature).
 func HasF16C() bool {
 	return false
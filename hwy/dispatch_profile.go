@@ -0,0 +1,230 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package hwy
+
+import (
+	"fmt"
+	"io"
+	"math/rand/v2"
+	"sort"
+	"sync"
+	"sync/atomic"
+	"text/tabwriter"
+	"time"
+	"unsafe"
+)
+
+// Kernel profiling.
+//
+// hwygen emits a <prefix>_hwyprof.gen.go file next to every dispatcher. It
+// is compiled only with -tags hwyprof, so normal builds carry no wrappers and
+// no counting cost. In a hwyprof build it wraps each dispatch variable so
+// that every call records its count, the elements of its first slice
+// argument, the bytes of all its slice arguments and its wall time, keyed by
+// dispatch group and target. KernelProfile turns the counts into GB/s and,
+// for groups given a FLOP count with SetKernelFlops, GFLOP/s.
+
+// ProfilingEnabled reports whether the binary was built with -tags hwyprof.
+func ProfilingEnabled() bool {
+	return profilingEnabled
+}
+
+// counterShards spreads concurrent updates over separate cache lines.
+const counterShards = 16
+
+type counterShard struct {
+	calls, elems, bytes, nanos atomic.Uint64
+	_                          [64 - 4*8]byte
+}
+
+// KernelCounter accumulates calls, elements, bytes and time for one dispatch
+// group running one target. Generated hwyprof wrappers update it; it is safe
+// for concurrent use and never locks.
+type KernelCounter struct {
+	group, target string
+	shards        [counterShards]counterShard
+}
+
+// Start returns the start time of a call, to be passed to Done.
+func (c *KernelCounter) Start() time.Time {
+	return time.Now()
+}
+
+// Done records one call that began at start and touched elems elements and
+// bytes bytes.
+func (c *KernelCounter) Done(start time.Time, elems, bytes int) {
+	d := time.Since(start)
+	// rand.Uint32 uses per-thread state, so picking a shard does not contend.
+	s := &c.shards[rand.Uint32()%counterShards]
+	s.calls.Add(1)
+	s.elems.Add(uint64(elems))
+	s.bytes.Add(uint64(bytes))
+	s.nanos.Add(uint64(d))
+}
+
+// SliceBytes returns the size of s in bytes. Generated wrappers use it to
+// count the memory traffic of a call.
+func SliceBytes[T any](s []T) int {
+	var zero T
+	return len(s) * int(unsafe.Sizeof(zero))
+}
+
+var (
+	profMu       sync.Mutex
+	profCounters []*KernelCounter
+	profByKey    = map[string]*KernelCounter{}
+	profFlops    = map[string]float64{}
+
+	// pendingProfiles holds wrappers registered before their dispatch
+	// table, keyed by "package.Group". Guarded by dispatchMu.
+	pendingProfiles = map[string]func(*KernelCounter){}
+)
+
+// kernelCounter returns the counter for group running target, creating it
+// on first use.
+func kernelCounter(group, target string) *KernelCounter {
+	profMu.Lock()
+	defer profMu.Unlock()
+	key := group + "/" + target
+	c := profByKey[key]
+	if c == nil {
+		c = &KernelCounter{group: group, target: target}
+		profByKey[key] = c
+		profCounters = append(profCounters, c)
+	}
+	return c
+}
+
+// ProfileDispatch installs the counting wrappers of a dispatch group. wrap
+// replaces each of the group's function variables with a wrapper that
+// reports to the given counter. It is called from generated hwyprof files;
+// the wrappers are installed again, with the new target's counter, whenever
+// the group is pinned by HWY_FORCE or ForceDispatch.
+func ProfileDispatch(pkg, group string, wrap func(*KernelCounter)) {
+	dispatchMu.Lock()
+	defer dispatchMu.Unlock()
+	for _, rt := range dispatchTables {
+		if rt.pkg != pkg {
+			continue
+		}
+		for gi, g := range rt.groups {
+			if g.name == group {
+				rt.groups[gi].wrap = wrap
+				rt.profile(gi)
+				return
+			}
+		}
+	}
+	// The dispatch file has not registered yet; RegisterDispatch picks the
+	// wrapper up.
+	pendingProfiles[pkg+"."+group] = wrap
+}
+
+// profile wraps the current implementations of group gi. Called with
+// dispatchMu held.
+func (rt *registeredTable) profile(gi int) {
+	g := &rt.groups[gi]
+	g.wrapped = nil
+	target := rt.resolvedTarget(gi)
+	g.unwrapped = snapshotVars(g.vars)
+	g.wrap(kernelCounter(rt.pkg+"."+g.name, target))
+	g.wrapped = snapshotVars(g.vars)
+	g.wrapTarget = target
+}
+
+// SetKernelFlops declares how many floating-point operations a dispatch
+// group (e.g. "vec.Dot") performs per element of its first slice argument,
+// so KernelProfile can report GFLOP/s for it. Dot, for example, does 2.
+func SetKernelFlops(group string, flopsPerElement float64) {
+	profMu.Lock()
+	defer profMu.Unlock()
+	profFlops[group] = flopsPerElement
+}
+
+// KernelStats is the profile of one dispatch group running one target.
+type KernelStats struct {
+	// Group is the qualified group name, e.g. "vec.Dot".
+	Group string
+	// Target is the target the calls ran on, e.g. "avx2".
+	Target string
+	// Calls is the number of calls.
+	Calls uint64
+	// Elements sums the length of the first slice argument of every call.
+	Elements uint64
+	// Bytes sums the size of all slice arguments of every call.
+	Bytes uint64
+	// Time is the wall time spent in the calls.
+	Time time.Duration
+	// GBPerSec is Bytes per second of Time, in units of 1e9.
+	GBPerSec float64
+	// GFLOPPerSec is the FLOP rate in units of 1e9, or 0 when no FLOP
+	// count was declared with SetKernelFlops.
+	GFLOPPerSec float64
+}
+
+// KernelProfile returns a snapshot of every kernel that has been called in a
+// hwyprof build, most time-consuming first. It returns nil in other builds.
+func KernelProfile() []KernelStats {
+	profMu.Lock()
+	defer profMu.Unlock()
+	var stats []KernelStats
+	for _, c := range profCounters {
+		st := KernelStats{Group: c.group, Target: c.target}
+		for i := range c.shards {
+			s := &c.shards[i]
+			st.Calls += s.calls.Load()
+			st.Elements += s.elems.Load()
+			st.Bytes += s.bytes.Load()
+			st.Time += time.Duration(s.nanos.Load())
+		}
+		if st.Calls == 0 {
+			continue
+		}
+		if ns := float64(st.Time); ns > 0 {
+			st.GBPerSec = float64(st.Bytes) / ns
+			st.GFLOPPerSec = float64(st.Elements) * profFlops[c.group] / ns
+		}
+		stats = append(stats, st)
+	}
+	sort.SliceStable(stats, func(i, j int) bool { return stats[i].Time > stats[j].Time })
+	return stats
+}
+
+// ResetKernelProfile zeroes all kernel counters.
+func ResetKernelProfile() {
+	profMu.Lock()
+	defer profMu.Unlock()
+	for _, c := range profCounters {
+		for i := range c.shards {
+			s := &c.shards[i]
+			s.calls.Store(0)
+			s.elems.Store(0)
+			s.bytes.Store(0)
+			s.nanos.Store(0)
+		}
+	}
+}
+
+// WriteKernelProfile writes KernelProfile as an aligned table.
+func WriteKernelProfile(w io.Writer) error {
+	tw := tabwriter.NewWriter(w, 0, 8, 2, ' ', tabwriter.AlignRight)
+	fmt.Fprintf(tw, "GROUP\tTARGET\tCALLS\tELEMENTS\tTIME\tns/call\tGB/s\tGFLOP/s\t\n")
+	for _, st := range KernelProfile() {
+		fmt.Fprintf(tw, "%s\t%s\t%d\t%d\t%v\t%.1f\t%.2f\t%.2f\t\n",
+			st.Group, st.Target, st.Calls, st.Elements, st.Time,
+			float64(st.Time)/float64(st.Calls), st.GBPerSec, st.GFLOPPerSec)
+	}
+	return tw.Flush()
+}
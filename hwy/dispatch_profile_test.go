@@ -0,0 +1,122 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package hwy
+
+import (
+	"bytes"
+	"strings"
+	"testing"
+)
+
+var profSumFloat32 func(a []float32) float32
+
+func profSumFast(a []float32) float32   { return 2 }
+func profSumScalar(a []float32) float32 { return 1 }
+
+// wrapProfSum is what a generated hwyprof file emits for profSum.
+func wrapProfSum(hwyCounter *KernelCounter) {
+	if hwyImpl := profSumFloat32; hwyImpl != nil {
+		profSumFloat32 = func(a []float32) float32 {
+			hwyStart := hwyCounter.Start()
+			hwyR0 := hwyImpl(a)
+			hwyCounter.Done(hwyStart, len(a), SliceBytes(a))
+			return hwyR0
+		}
+	}
+}
+
+func findKernelStats(group, target string) (KernelStats, bool) {
+	for _, st := range KernelProfile() {
+		if st.Group == group && st.Target == target {
+			return st, true
+		}
+	}
+	return KernelStats{}, false
+}
+
+func TestProfileDispatch(t *testing.T) {
+	// The wrapper is registered first here, as happens when the hwyprof
+	// file sorts before the dispatch file.
+	ProfileDispatch("proftest", "Sum", wrapProfSum)
+	profSumFloat32 = profSumFast
+	RegisterDispatch(DispatchTable{
+		Package: "proftest",
+		Groups:  []DispatchGroup{{Name: "Sum", Vars: []any{&profSumFloat32}}},
+		Targets: []DispatchTarget{
+			{Name: "fast", Supported: true, Init: func() { profSumFloat32 = profSumFast }},
+			{Name: "fallback", Supported: true, Init: func() { profSumFloat32 = profSumScalar }},
+		},
+	})
+	SetKernelFlops("proftest.Sum", 1)
+
+	a := make([]float32, 100)
+	for range 3 {
+		if got := profSumFloat32(a); got != 2 {
+			t.Fatalf("wrapped Sum = %v, want 2", got)
+		}
+	}
+	st, ok := findKernelStats("proftest.Sum", "fast")
+	if !ok {
+		t.Fatalf("no profile for proftest.Sum/fast in %+v", KernelProfile())
+	}
+	if st.Calls != 3 || st.Elements != 300 || st.Bytes != 1200 {
+		t.Errorf("got calls=%d elements=%d bytes=%d, want 3 300 1200", st.Calls, st.Elements, st.Bytes)
+	}
+	if st.Time > 0 && (st.GBPerSec <= 0 || st.GFLOPPerSec <= 0) {
+		t.Errorf("rates not computed: %+v", st)
+	}
+
+	// The report sees through the wrapper.
+	info := findDispatchInfo(t, "proftest.Sum")
+	if info.Target != "fast" || info.Impls[0] != "hwy.profSumFast" {
+		t.Errorf("report: got %+v, want fast / hwy.profSumFast", info)
+	}
+
+	// Forcing another target rewraps with that target's counter.
+	if err := ForceDispatch("proftest.Sum", "fallback"); err != nil {
+		t.Fatal(err)
+	}
+	if got := profSumFloat32(a); got != 1 {
+		t.Fatalf("forced Sum = %v, want 1", got)
+	}
+	if st, ok := findKernelStats("proftest.Sum", "fallback"); !ok || st.Calls != 1 {
+		t.Errorf("fallback profile: got %+v, want 1 call", st)
+	}
+	if info := findDispatchInfo(t, "proftest.Sum"); info.Target != "fallback" || !info.Forced {
+		t.Errorf("report after force: got %+v", info)
+	}
+
+	var buf bytes.Buffer
+	if err := WriteKernelProfile(&buf); err != nil {
+		t.Fatal(err)
+	}
+	if !strings.Contains(buf.String(), "proftest.Sum") {
+		t.Errorf("WriteKernelProfile missing proftest.Sum:\n%s", buf.String())
+	}
+
+	ResetKernelProfile()
+	if _, ok := findKernelStats("proftest.Sum", "fast"); ok {
+		t.Error("ResetKernelProfile left proftest.Sum/fast")
+	}
+}
+
+func BenchmarkKernelCounter(b *testing.B) {
+	c := kernelCounter("bench.Counter", "fallback")
+	b.RunParallel(func(pb *testing.PB) {
+		for pb.Next() {
+			c.Done(c.Start(), 64, 256)
+		}
+	})
+}
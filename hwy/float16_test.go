@@ -314,7 +314,7 @@ func TestAddF16(t *testing.T) {
 	result := AddF16(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := Float16ToFloat32(result.data[i])
+		got := Float16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-5.0)) > 0.01 {
 			t.Errorf("AddF16: lane %d: got %v, want 5.0", i, got)
 		}
@@ -328,7 +328,7 @@ func TestSubF16(t *testing.T) {
 	result := SubF16(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := Float16ToFloat32(result.data[i])
+		got := Float16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-3.0)) > 0.01 {
 			t.Errorf("SubF16: lane %d: got %v, want 3.0", i, got)
 		}
@@ -342,7 +342,7 @@ func TestMulF16(t *testing.T) {
 	result := MulF16(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := Float16ToFloat32(result.data[i])
+		got := Float16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-12.0)) > 0.01 {
 			t.Errorf("MulF16: lane %d: got %v, want 12.0", i, got)
 		}
@@ -356,7 +356,7 @@ func TestDivF16(t *testing.T) {
 	result := DivF16(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := Float16ToFloat32(result.data[i])
+		got := Float16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-4.0)) > 0.01 {
 			t.Errorf("DivF16: lane %d: got %v, want 4.0", i, got)
 		}
@@ -371,7 +371,7 @@ func TestFMAF16(t *testing.T) {
 	result := FMAF16(a, b, c) // 2*3 + 4 = 10
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := Float16ToFloat32(result.data[i])
+		got := Float16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-10.0)) > 0.01 {
 			t.Errorf("FMAF16: lane %d: got %v, want 10.0", i, got)
 		}
@@ -384,7 +384,7 @@ func TestNegF16(t *testing.T) {
 	result := NegF16(v)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := Float16ToFloat32(result.data[i])
+		got := Float16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-(-5.0))) > 0.01 {
 			t.Errorf("NegF16: lane %d: got %v, want -5.0", i, got)
 		}
@@ -397,7 +397,7 @@ func TestAbsF16(t *testing.T) {
 	result := AbsF16(v)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := Float16ToFloat32(result.data[i])
+		got := Float16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-7.0)) > 0.01 {
 			t.Errorf("AbsF16: lane %d: got %v, want 7.0", i, got)
 		}
@@ -413,8 +413,8 @@ func TestMinMaxF16(t *testing.T) {
 	maxResult := MaxF16(a, b)
 
 	for i := 0; i < minResult.NumLanes(); i++ {
-		gotMin := Float16ToFloat32(minResult.data[i])
-		gotMax := Float16ToFloat32(maxResult.data[i])
+		gotMin := Float16ToFloat32(minResult.data()[i])
+		gotMax := Float16ToFloat32(maxResult.data()[i])
 		if math.Abs(float64(gotMin-3.0)) > 0.01 {
 			t.Errorf("MinF16: lane %d: got %v, want 3.0", i, gotMin)
 		}
@@ -430,7 +430,7 @@ func TestSqrtF16(t *testing.T) {
 	result := SqrtF16(v)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := Float16ToFloat32(result.data[i])
+		got := Float16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-4.0)) > 0.01 {
 			t.Errorf("SqrtF16: lane %d: got %v, want 4.0", i, got)
 		}
@@ -443,7 +443,7 @@ func TestReciprocalF16(t *testing.T) {
 	result := ReciprocalF16(v)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		got := Float16ToFloat32(result.data[i])
+		got := Float16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-0.25)) > 0.01 {
 			t.Errorf("ReciprocalF16: lane %d: got %v, want 0.25", i, got)
 		}
@@ -453,11 +453,12 @@ func TestReciprocalF16(t *testing.T) {
 // TestReduceSumF16 tests Float16 reduction sum.
 func TestReduceSumF16(t *testing.T) {
 	// Create a vector with known values
-	data := make([]Float16, MaxLanes[Float16]())
+	out := makeVec[Float16](MaxLanes[Float16]())
+	data := out.data()
 	for i := range data {
 		data[i] = Float32ToFloat16(float32(i + 1))
 	}
-	v := Vec[Float16]{data: data}
+	v := out
 
 	sum := ReduceSumF16(v)
 
@@ -480,7 +481,7 @@ func TestReduceMinMaxF16(t *testing.T) {
 		Float32ToFloat16(8.0),
 		Float32ToFloat16(1.0),
 	}
-	v := Vec[Float16]{data: data}
+	v := vecFrom(data)
 
 	min := ReduceMinF16(v)
 	max := ReduceMaxF16(v)
@@ -495,18 +496,18 @@ func TestReduceMinMaxF16(t *testing.T) {
 
 // TestDotF16 tests Float16 dot product.
 func TestDotF16(t *testing.T) {
-	a := Vec[Float16]{data: []Float16{
+	a := vecFrom([]Float16{
 		Float32ToFloat16(1.0),
 		Float32ToFloat16(2.0),
 		Float32ToFloat16(3.0),
 		Float32ToFloat16(4.0),
-	}}
-	b := Vec[Float16]{data: []Float16{
+	})
+	b := vecFrom([]Float16{
 		Float32ToFloat16(1.0),
 		Float32ToFloat16(1.0),
 		Float32ToFloat16(1.0),
 		Float32ToFloat16(1.0),
-	}}
+	})
 
 	dot := DotF16(a, b)
 	// 1*1 + 2*1 + 3*1 + 4*1 = 10
@@ -517,18 +518,18 @@ func TestDotF16(t *testing.T) {
 
 // TestComparisonF16 tests Float16 comparison operations.
 func TestComparisonF16(t *testing.T) {
-	a := Vec[Float16]{data: []Float16{
+	a := vecFrom([]Float16{
 		Float32ToFloat16(1.0),
 		Float32ToFloat16(5.0),
 		Float32ToFloat16(3.0),
 		Float32ToFloat16(7.0),
-	}}
-	b := Vec[Float16]{data: []Float16{
+	})
+	b := vecFrom([]Float16{
 		Float32ToFloat16(1.0),
 		Float32ToFloat16(3.0),
 		Float32ToFloat16(5.0),
 		Float32ToFloat16(7.0),
-	}}
+	})
 
 	t.Run("Equal", func(t *testing.T) {
 		mask := EqualF16(a, b)
@@ -569,12 +570,12 @@ func TestComparisonF16(t *testing.T) {
 
 // TestIsNaNF16 tests Float16 NaN detection.
 func TestIsNaNF16(t *testing.T) {
-	v := Vec[Float16]{data: []Float16{
+	v := vecFrom([]Float16{
 		Float16One,
 		Float16NaN,
 		Float16Inf,
 		Float16(0x7E01), // Another NaN
-	}}
+	})
 
 	mask := IsNaNF16(v)
 
@@ -594,12 +595,12 @@ func TestIsNaNF16(t *testing.T) {
 
 // TestIsInfF16 tests Float16 infinity detection.
 func TestIsInfF16(t *testing.T) {
-	v := Vec[Float16]{data: []Float16{
+	v := vecFrom([]Float16{
 		Float16One,
 		Float16Inf,
 		Float16NegInf,
 		Float16NaN,
-	}}
+	})
 
 	t.Run("AnyInf", func(t *testing.T) {
 		mask := IsInfF16(v, 0)
@@ -640,18 +641,18 @@ func TestIsInfF16(t *testing.T) {
 
 // TestIfThenElseF16 tests Float16 conditional selection.
 func TestIfThenElseF16(t *testing.T) {
-	a := Vec[Float16]{data: []Float16{
+	a := vecFrom([]Float16{
 		Float32ToFloat16(1.0),
 		Float32ToFloat16(2.0),
 		Float32ToFloat16(3.0),
 		Float32ToFloat16(4.0),
-	}}
-	b := Vec[Float16]{data: []Float16{
+	})
+	b := vecFrom([]Float16{
 		Float32ToFloat16(1.0),
 		Float32ToFloat16(1.0),
 		Float32ToFloat16(3.0),
 		Float32ToFloat16(1.0),
-	}}
+	})
 
 	mask := EqualF16(a, b) // true, false, true, false
 	yes := SetF16FromF32(100.0)
@@ -659,13 +660,13 @@ func TestIfThenElseF16(t *testing.T) {
 
 	result := IfThenElseF16(mask, yes, no)
 
-	if Float16ToFloat32(result.data[0]) != 100.0 {
+	if Float16ToFloat32(result.data()[0]) != 100.0 {
 		t.Errorf("IfThenElseF16: lane 0 should be 100.0 (mask true)")
 	}
-	if Float16ToFloat32(result.data[1]) != 0.0 {
+	if Float16ToFloat32(result.data()[1]) != 0.0 {
 		t.Errorf("IfThenElseF16: lane 1 should be 0.0 (mask false)")
 	}
-	if Float16ToFloat32(result.data[2]) != 100.0 {
+	if Float16ToFloat32(result.data()[2]) != 100.0 {
 		t.Errorf("IfThenElseF16: lane 2 should be 100.0 (mask true)")
 	}
 }
@@ -673,30 +674,30 @@ func TestIfThenElseF16(t *testing.T) {
 // TestPromoteDemoteF16 tests Float16 promotion and demotion operations.
 func TestPromoteDemoteF16(t *testing.T) {
 	t.Run("PromoteF16ToF32", func(t *testing.T) {
-		v := Vec[Float16]{data: []Float16{
+		v := vecFrom([]Float16{
 			Float32ToFloat16(1.0),
 			Float32ToFloat16(2.0),
 			Float32ToFloat16(3.0),
 			Float32ToFloat16(4.0),
-		}}
+		})
 
 		result := PromoteF16ToF32(v)
 
-		for i := 0; i < len(v.data); i++ {
+		for i := 0; i < v.NumLanes(); i++ {
 			expected := float32(i + 1)
-			if math.Abs(float64(result.data[i]-expected)) > 0.01 {
-				t.Errorf("PromoteF16ToF32: lane %d: got %v, want %v", i, result.data[i], expected)
+			if math.Abs(float64(result.data()[i]-expected)) > 0.01 {
+				t.Errorf("PromoteF16ToF32: lane %d: got %v, want %v", i, result.data()[i], expected)
 			}
 		}
 	})
 
 	t.Run("DemoteF32ToF16", func(t *testing.T) {
-		v := Vec[float32]{data: []float32{1.0, 2.0, 3.0, 4.0}}
+		v := vecFrom([]float32{1.0, 2.0, 3.0, 4.0})
 
 		result := DemoteF32ToF16(v)
 
-		for i := 0; i < len(v.data); i++ {
-			got := Float16ToFloat32(result.data[i])
+		for i := 0; i < v.NumLanes(); i++ {
+			got := Float16ToFloat32(result.data()[i])
 			expected := float32(i + 1)
 			if math.Abs(float64(got-expected)) > 0.01 {
 				t.Errorf("DemoteF32ToF16: lane %d: got %v, want %v", i, got, expected)
@@ -705,56 +706,56 @@ func TestPromoteDemoteF16(t *testing.T) {
 	})
 
 	t.Run("PromoteLowerF16ToF32", func(t *testing.T) {
-		v := Vec[Float16]{data: []Float16{
+		v := vecFrom([]Float16{
 			Float32ToFloat16(1.0),
 			Float32ToFloat16(2.0),
 			Float32ToFloat16(3.0),
 			Float32ToFloat16(4.0),
-		}}
+		})
 
 		result := PromoteLowerF16ToF32(v)
 
 		// Should only contain lower half (1.0, 2.0)
-		if len(result.data) != 2 {
-			t.Errorf("PromoteLowerF16ToF32: expected 2 elements, got %d", len(result.data))
+		if result.NumLanes() != 2 {
+			t.Errorf("PromoteLowerF16ToF32: expected 2 elements, got %d", result.NumLanes())
 		}
-		if result.data[0] != 1.0 || result.data[1] != 2.0 {
-			t.Errorf("PromoteLowerF16ToF32: got %v, want [1.0, 2.0]", result.data)
+		if result.data()[0] != 1.0 || result.data()[1] != 2.0 {
+			t.Errorf("PromoteLowerF16ToF32: got %v, want [1.0, 2.0]", result.data())
 		}
 	})
 
 	t.Run("PromoteUpperF16ToF32", func(t *testing.T) {
-		v := Vec[Float16]{data: []Float16{
+		v := vecFrom([]Float16{
 			Float32ToFloat16(1.0),
 			Float32ToFloat16(2.0),
 			Float32ToFloat16(3.0),
 			Float32ToFloat16(4.0),
-		}}
+		})
 
 		result := PromoteUpperF16ToF32(v)
 
 		// Should only contain upper half (3.0, 4.0)
-		if len(result.data) != 2 {
-			t.Errorf("PromoteUpperF16ToF32: expected 2 elements, got %d", len(result.data))
+		if result.NumLanes() != 2 {
+			t.Errorf("PromoteUpperF16ToF32: expected 2 elements, got %d", result.NumLanes())
 		}
-		if result.data[0] != 3.0 || result.data[1] != 4.0 {
-			t.Errorf("PromoteUpperF16ToF32: got %v, want [3.0, 4.0]", result.data)
+		if result.data()[0] != 3.0 || result.data()[1] != 4.0 {
+			t.Errorf("PromoteUpperF16ToF32: got %v, want [3.0, 4.0]", result.data())
 		}
 	})
 
 	t.Run("DemoteTwoF32ToF16", func(t *testing.T) {
-		lo := Vec[float32]{data: []float32{1.0, 2.0}}
-		hi := Vec[float32]{data: []float32{3.0, 4.0}}
+		lo := vecFrom([]float32{1.0, 2.0})
+		hi := vecFrom([]float32{3.0, 4.0})
 
 		result := DemoteTwoF32ToF16(lo, hi)
 
-		if len(result.data) != 4 {
-			t.Errorf("DemoteTwoF32ToF16: expected 4 elements, got %d", len(result.data))
+		if result.NumLanes() != 4 {
+			t.Errorf("DemoteTwoF32ToF16: expected 4 elements, got %d", result.NumLanes())
 		}
 
 		expected := []float32{1.0, 2.0, 3.0, 4.0}
 		for i, exp := range expected {
-			got := Float16ToFloat32(result.data[i])
+			got := Float16ToFloat32(result.data()[i])
 			if math.Abs(float64(got-exp)) > 0.01 {
 				t.Errorf("DemoteTwoF32ToF16: lane %d: got %v, want %v", i, got, exp)
 			}
@@ -769,14 +770,14 @@ func TestLoadStoreF16(t *testing.T) {
 		v := LoadF16(src)
 
 		for i := 0; i < len(src) && i < v.NumLanes(); i++ {
-			if v.data[i] != Float16(src[i]) {
-				t.Errorf("LoadF16: lane %d: got 0x%04X, want 0x%04X", i, v.data[i], src[i])
+			if v.data()[i] != Float16(src[i]) {
+				t.Errorf("LoadF16: lane %d: got 0x%04X, want 0x%04X", i, v.data()[i], src[i])
 			}
 		}
 	})
 
 	t.Run("StoreF16", func(t *testing.T) {
-		v := Vec[Float16]{data: []Float16{0x3C00, 0x4000, 0x4200, 0x4400}}
+		v := vecFrom([]Float16{0x3C00, 0x4000, 0x4200, 0x4400})
 		dst := make([]uint16, 4)
 		StoreF16(v, dst)
 
@@ -793,7 +794,7 @@ func TestLoadStoreF16(t *testing.T) {
 		v := LoadF16FromF32(src)
 
 		for i := 0; i < len(src) && i < v.NumLanes(); i++ {
-			got := Float16ToFloat32(v.data[i])
+			got := Float16ToFloat32(v.data()[i])
 			if math.Abs(float64(got-src[i])) > 0.01 {
 				t.Errorf("LoadF16FromF32: lane %d: got %v, want %v", i, got, src[i])
 			}
@@ -801,12 +802,12 @@ func TestLoadStoreF16(t *testing.T) {
 	})
 
 	t.Run("StoreF16ToF32", func(t *testing.T) {
-		v := Vec[Float16]{data: []Float16{
+		v := vecFrom([]Float16{
 			Float32ToFloat16(1.0),
 			Float32ToFloat16(2.0),
 			Float32ToFloat16(3.0),
 			Float32ToFloat16(4.0),
-		}}
+		})
 		dst := make([]float32, 4)
 		StoreF16ToF32(v, dst)
 
@@ -824,8 +825,8 @@ func TestSetZeroF16(t *testing.T) {
 	t.Run("SetF16", func(t *testing.T) {
 		v := SetF16(Float16One)
 		for i := 0; i < v.NumLanes(); i++ {
-			if v.data[i] != Float16One {
-				t.Errorf("SetF16: lane %d: got 0x%04X, want 0x%04X", i, v.data[i], Float16One)
+			if v.data()[i] != Float16One {
+				t.Errorf("SetF16: lane %d: got 0x%04X, want 0x%04X", i, v.data()[i], Float16One)
 			}
 		}
 	})
@@ -833,7 +834,7 @@ func TestSetZeroF16(t *testing.T) {
 	t.Run("SetF16FromF32", func(t *testing.T) {
 		v := SetF16FromF32(2.0)
 		for i := 0; i < v.NumLanes(); i++ {
-			got := Float16ToFloat32(v.data[i])
+			got := Float16ToFloat32(v.data()[i])
 			if math.Abs(float64(got-2.0)) > 0.01 {
 				t.Errorf("SetF16FromF32: lane %d: got %v, want 2.0", i, got)
 			}
@@ -843,8 +844,8 @@ func TestSetZeroF16(t *testing.T) {
 	t.Run("ZeroF16", func(t *testing.T) {
 		v := ZeroF16()
 		for i := 0; i < v.NumLanes(); i++ {
-			if v.data[i] != Float16Zero {
-				t.Errorf("ZeroF16: lane %d: got 0x%04X, want 0x0000", i, v.data[i])
+			if v.data()[i] != Float16Zero {
+				t.Errorf("ZeroF16: lane %d: got 0x%04X, want 0x0000", i, v.data()[i])
 			}
 		}
 	})
@@ -852,12 +853,12 @@ func TestSetZeroF16(t *testing.T) {
 
 // TestClampF16 tests Float16 clamping.
 func TestClampF16(t *testing.T) {
-	v := Vec[Float16]{data: []Float16{
+	v := vecFrom([]Float16{
 		Float32ToFloat16(0.0),
 		Float32ToFloat16(5.0),
 		Float32ToFloat16(15.0),
 		Float32ToFloat16(10.0),
-	}}
+	})
 	lo := SetF16FromF32(2.0)
 	hi := SetF16FromF32(12.0)
 
@@ -865,7 +866,7 @@ func TestClampF16(t *testing.T) {
 
 	expected := []float32{2.0, 5.0, 12.0, 10.0}
 	for i, exp := range expected {
-		got := Float16ToFloat32(result.data[i])
+		got := Float16ToFloat32(result.data()[i])
 		if math.Abs(float64(got-exp)) > 0.01 {
 			t.Errorf("ClampF16: lane %d: got %v, want %v", i, got, exp)
 		}
@@ -881,7 +882,7 @@ func TestMulAddSubF16(t *testing.T) {
 	t.Run("MulAddF16", func(t *testing.T) {
 		// 2*3 + 4 = 10
 		result := MulAddF16(a, b, c)
-		got := Float16ToFloat32(result.data[0])
+		got := Float16ToFloat32(result.data()[0])
 		if math.Abs(float64(got-10.0)) > 0.01 {
 			t.Errorf("MulAddF16: got %v, want 10.0", got)
 		}
@@ -890,7 +891,7 @@ func TestMulAddSubF16(t *testing.T) {
 	t.Run("MulSubF16", func(t *testing.T) {
 		// 2*3 - 4 = 2
 		result := MulSubF16(a, b, c)
-		got := Float16ToFloat32(result.data[0])
+		got := Float16ToFloat32(result.data()[0])
 		if math.Abs(float64(got-2.0)) > 0.01 {
 			t.Errorf("MulSubF16: got %v, want 2.0", got)
 		}
@@ -899,7 +900,7 @@ func TestMulAddSubF16(t *testing.T) {
 	t.Run("NegMulAddF16", func(t *testing.T) {
 		// -2*3 + 4 = -2
 		result := NegMulAddF16(a, b, c)
-		got := Float16ToFloat32(result.data[0])
+		got := Float16ToFloat32(result.data()[0])
 		if math.Abs(float64(got-(-2.0))) > 0.01 {
 			t.Errorf("NegMulAddF16: got %v, want -2.0", got)
 		}
@@ -908,7 +909,7 @@ func TestMulAddSubF16(t *testing.T) {
 	t.Run("NegMulSubF16", func(t *testing.T) {
 		// -(2*3 + 4) = -10
 		result := NegMulSubF16(a, b, c)
-		got := Float16ToFloat32(result.data[0])
+		got := Float16ToFloat32(result.data()[0])
 		if math.Abs(float64(got-(-10.0))) > 0.01 {
 			t.Errorf("NegMulSubF16: got %v, want -10.0", got)
 		}
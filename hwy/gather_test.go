@@ -65,12 +65,12 @@ func TestGatherIndex(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			indices := Vec[int32]{data: tt.indices}
+			indices := vecFrom(tt.indices)
 			result := GatherIndex(src, indices)
 
-			for i := 0; i < len(tt.want) && i < len(result.data); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("GatherIndex lane %d: got %v, want %v", i, result.data[i], tt.want[i])
+			for i := 0; i < len(tt.want) && i < result.NumLanes(); i++ {
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("GatherIndex lane %d: got %v, want %v", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -80,13 +80,13 @@ func TestGatherIndex(t *testing.T) {
 func TestGatherIndexInt64(t *testing.T) {
 	src := []float64{1.1, 2.2, 3.3, 4.4, 5.5, 6.6, 7.7, 8.8}
 
-	indices := Vec[int64]{data: []int64{0, 2, 4, 6}}
+	indices := vecFrom([]int64{0, 2, 4, 6})
 	result := GatherIndex(src, indices)
 
 	want := []float64{1.1, 3.3, 5.5, 7.7}
 	for i := range want {
-		if result.data[i] != want[i] {
-			t.Errorf("GatherIndex lane %d: got %v, want %v", i, result.data[i], want[i])
+		if result.data()[i] != want[i] {
+			t.Errorf("GatherIndex lane %d: got %v, want %v", i, result.data()[i], want[i])
 		}
 	}
 }
@@ -128,13 +128,13 @@ func TestGatherIndexMasked(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			indices := Vec[int32]{data: tt.indices}
-			mask := Mask[float32]{bits: tt.mask}
+			indices := vecFrom(tt.indices)
+			mask := maskFrom[float32](tt.mask)
 			result := GatherIndexMasked(src, indices, mask)
 
-			for i := 0; i < len(tt.want) && i < len(result.data); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("GatherIndexMasked lane %d: got %v, want %v", i, result.data[i], tt.want[i])
+			for i := 0; i < len(tt.want) && i < result.NumLanes(); i++ {
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("GatherIndexMasked lane %d: got %v, want %v", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -182,8 +182,8 @@ func TestScatterIndex(t *testing.T) {
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
 			dst := make([]float32, tt.dstSize)
-			v := Vec[float32]{data: tt.data}
-			indices := Vec[int32]{data: tt.indices}
+			v := vecFrom(tt.data)
+			indices := vecFrom(tt.indices)
 
 			ScatterIndex(v, dst, indices)
 
@@ -234,9 +234,9 @@ func TestScatterIndexMasked(t *testing.T) {
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
 			dst := make([]float32, tt.dstSize)
-			v := Vec[float32]{data: tt.data}
-			indices := Vec[int32]{data: tt.indices}
-			mask := Mask[float32]{bits: tt.mask}
+			v := vecFrom(tt.data)
+			indices := vecFrom(tt.indices)
+			mask := maskFrom[float32](tt.mask)
 
 			ScatterIndexMasked(v, dst, indices, mask)
 
@@ -252,7 +252,7 @@ func TestScatterIndexMasked(t *testing.T) {
 func TestGatherScatterRoundTrip(t *testing.T) {
 	// Gather then scatter with same indices should reconstruct original (sparse) data
 	src := []float32{10, 20, 30, 40, 50, 60, 70, 80}
-	indices := Vec[int32]{data: []int32{0, 2, 4, 6}}
+	indices := vecFrom([]int32{0, 2, 4, 6})
 
 	// Gather
 	gathered := GatherIndex(src, indices)
@@ -305,12 +305,12 @@ func TestGatherIndexOffset(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			indices := Vec[int32]{data: tt.indices}
+			indices := vecFrom(tt.indices)
 			result := GatherIndexOffset(src, tt.base, indices, tt.scale)
 
-			for i := 0; i < len(tt.want) && i < len(result.data); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("GatherIndexOffset lane %d: got %v, want %v", i, result.data[i], tt.want[i])
+			for i := 0; i < len(tt.want) && i < result.NumLanes(); i++ {
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("GatherIndexOffset lane %d: got %v, want %v", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -321,8 +321,8 @@ func TestIndicesIota(t *testing.T) {
 	result := IndicesIota[int32](8)
 
 	for i := range 8 {
-		if result.data[i] != int32(i) {
-			t.Errorf("IndicesIota lane %d: got %v, want %v", i, result.data[i], int32(i))
+		if result.data()[i] != int32(i) {
+			t.Errorf("IndicesIota lane %d: got %v, want %v", i, result.data()[i], int32(i))
 		}
 	}
 }
@@ -331,9 +331,9 @@ func TestIndicesStride(t *testing.T) {
 	result := IndicesStride[int32](8, 5, 3)
 
 	want := []int32{5, 8, 11, 14, 17, 20, 23, 26}
-	for i := 0; i < len(want) && i < len(result.data); i++ {
-		if result.data[i] != want[i] {
-			t.Errorf("IndicesStride lane %d: got %v, want %v", i, result.data[i], want[i])
+	for i := 0; i < len(want) && i < result.NumLanes(); i++ {
+		if result.data()[i] != want[i] {
+			t.Errorf("IndicesStride lane %d: got %v, want %v", i, result.data()[i], want[i])
 		}
 	}
 }
@@ -345,9 +345,9 @@ func TestIndicesFromFunc(t *testing.T) {
 	})
 
 	want := []int32{0, 1, 4, 9, 16, 25, 36, 49}
-	for i := 0; i < len(want) && i < len(result.data); i++ {
-		if result.data[i] != want[i] {
-			t.Errorf("IndicesFromFunc lane %d: got %v, want %v", i, result.data[i], want[i])
+	for i := 0; i < len(want) && i < result.NumLanes(); i++ {
+		if result.data()[i] != want[i] {
+			t.Errorf("IndicesFromFunc lane %d: got %v, want %v", i, result.data()[i], want[i])
 		}
 	}
 }
@@ -356,13 +356,13 @@ func TestGatherWithDifferentTypes(t *testing.T) {
 	// Test with int32
 	t.Run("int32", func(t *testing.T) {
 		src := []int32{100, 200, 300, 400, 500}
-		indices := Vec[int32]{data: []int32{4, 2, 0}}
+		indices := vecFrom([]int32{4, 2, 0})
 		result := GatherIndex(src, indices)
 
 		want := []int32{500, 300, 100}
 		for i := range want {
-			if result.data[i] != want[i] {
-				t.Errorf("GatherIndex int32 lane %d: got %v, want %v", i, result.data[i], want[i])
+			if result.data()[i] != want[i] {
+				t.Errorf("GatherIndex int32 lane %d: got %v, want %v", i, result.data()[i], want[i])
 			}
 		}
 	})
@@ -370,13 +370,13 @@ func TestGatherWithDifferentTypes(t *testing.T) {
 	// Test with float64
 	t.Run("float64", func(t *testing.T) {
 		src := []float64{1.5, 2.5, 3.5, 4.5, 5.5}
-		indices := Vec[int64]{data: []int64{0, 2, 4}}
+		indices := vecFrom([]int64{0, 2, 4})
 		result := GatherIndex(src, indices)
 
 		want := []float64{1.5, 3.5, 5.5}
 		for i := range want {
-			if result.data[i] != want[i] {
-				t.Errorf("GatherIndex float64 lane %d: got %v, want %v", i, result.data[i], want[i])
+			if result.data()[i] != want[i] {
+				t.Errorf("GatherIndex float64 lane %d: got %v, want %v", i, result.data()[i], want[i])
 			}
 		}
 	})
@@ -388,7 +388,7 @@ func BenchmarkGatherIndex(b *testing.B) {
 	for i := range src {
 		src[i] = float32(i)
 	}
-	indices := Vec[int32]{data: []int32{0, 64, 128, 192, 256, 320, 384, 448}}
+	indices := vecFrom([]int32{0, 64, 128, 192, 256, 320, 384, 448})
 
 	for b.Loop() {
 		_ = GatherIndex(src, indices)
@@ -397,8 +397,8 @@ func BenchmarkGatherIndex(b *testing.B) {
 
 func BenchmarkScatterIndex(b *testing.B) {
 	data := []float32{1, 2, 3, 4, 5, 6, 7, 8}
-	v := Vec[float32]{data: data}
-	indices := Vec[int32]{data: []int32{0, 64, 128, 192, 256, 320, 384, 448}}
+	v := vecFrom(data)
+	indices := vecFrom([]int32{0, 64, 128, 192, 256, 320, 384, 448})
 	dst := make([]float32, 512)
 
 	for b.Loop() {
@@ -56,12 +56,12 @@ var (
 	// Constant pool patterns
 	// Match constant pool labels: .LCPI0_0: (Linux) or LCPI0_0: (macOS)
 	amd64ConstPoolLabel = regexp.MustCompile(`^\.?LCPI\d+_\d+:`)
-	// Match .long directive with hex or decimal value
-	amd64LongDirective = regexp.MustCompile(`^\s+\.long\s+(0x[0-9a-fA-F]+|\d+)`)
+	// Match .long directive with hex or (possibly negative) decimal value
+	amd64LongDirective = regexp.MustCompile(`^\s+\.long\s+(0x[0-9a-fA-F]+|-?\d+)`)
 	// Match .quad directive with hex or decimal value
-	amd64QuadDirective = regexp.MustCompile(`^\s+\.quad\s+(0x[0-9a-fA-F]+|\d+)`)
+	amd64QuadDirective = regexp.MustCompile(`^\s+\.quad\s+(0x[0-9a-fA-F]+|-?\d+)`)
 	// Match .byte directive with hex or decimal value
-	amd64ByteDirective = regexp.MustCompile(`^\s+\.byte\s+(0x[0-9a-fA-F]+|\d+)`)
+	amd64ByteDirective = regexp.MustCompile(`^\s+\.byte\s+(0x[0-9a-fA-F]+|-?\d+)`)
 	// Match section directive for rodata
 	amd64RodataSection = regexp.MustCompile(`^\s+\.section\s+\.rodata|^\s+\.section\s+__TEXT,__const|^\s+\.section\s+__DATA,__const`)
 	// Match RIP-relative memory operand referencing constant pool
@@ -509,6 +509,24 @@ func amd64RewriteConstPoolRef(asm string, constLabel string) string {
 		return ""
 	}
 
+	// Leading immediate of a compare or shuffle (imm, mem, reg, dst) or
+	// selector of a blend (sel, mem, reg, dst)
+	imm := ""
+	if first := strings.TrimSpace(parts[0]); strings.HasPrefix(first, "$") {
+		imm = first + ", "
+		parts = parts[1:]
+	} else if len(parts) == 4 {
+		if imm = amd64ToGoRegister(first); imm == "" {
+			return ""
+		}
+		imm += ", "
+		parts = parts[1:]
+	}
+	// Masked and broadcast operands are not rewritten.
+	if len(parts) < 2 || len(parts) > 3 || strings.Contains(operands, "{") {
+		return ""
+	}
+
 	srcOp := strings.TrimSpace(parts[0])
 
 	// Check if source operand is the RIP-relative constant pool reference
@@ -523,7 +541,7 @@ func amd64RewriteConstPoolRef(asm string, constLabel string) string {
 		if src2 == "" || dst == "" {
 			return ""
 		}
-		return fmt.Sprintf("\t%s %s<>(SB), %s, %s\t// %s\n", mnemonic, constLabel, src2, dst, asm)
+		return fmt.Sprintf("\t%s %s%s<>(SB), %s, %s\t// %s\n", mnemonic, imm, constLabel, src2, dst, asm)
 	}
 
 	// 2-operand instruction: mem, reg
@@ -532,7 +550,20 @@ func amd64RewriteConstPoolRef(asm string, constLabel string) string {
 	if goReg == "" {
 		return ""
 	}
-	return fmt.Sprintf("\t%s %s<>(SB), %s\t// %s\n", mnemonic, constLabel, goReg, asm)
+	// The Go linker aligns RODATA symbols to at most 32 bytes, so a
+	// 64-byte aligned load of a constant pool may fault.
+	if unaligned, ok := amd64UnalignedZMMLoads[mnemonic]; ok && strings.HasPrefix(goReg, "Z") {
+		mnemonic = unaligned
+	}
+	return fmt.Sprintf("\t%s %s%s<>(SB), %s\t// %s\n", mnemonic, imm, constLabel, goReg, asm)
+}
+
+// amd64UnalignedZMMLoads maps aligned vector loads to their unaligned forms.
+var amd64UnalignedZMMLoads = map[string]string{
+	"VMOVAPS":   "VMOVUPS",
+	"VMOVAPD":   "VMOVUPD",
+	"VMOVDQA32": "VMOVDQU32",
+	"VMOVDQA64": "VMOVDQU64",
 }
 
 // amd64ToGoRegister converts an x86-64 AT&T syntax register to Go assembly format
@@ -544,6 +575,10 @@ func amd64ToGoRegister(reg string) string {
 	}
 	reg = reg[1:] // Remove % prefix
 
+	// Opmask registers (AVX-512)
+	if len(reg) == 2 && reg[0] == 'k' && reg[1] >= '0' && reg[1] <= '7' {
+		return "K" + reg[1:]
+	}
 	// ZMM registers (AVX-512)
 	if strings.HasPrefix(reg, "zmm") {
 		num := reg[3:]
@@ -927,16 +962,15 @@ func (p *AMD64Parser) generateGoAssembly(t *TranslateUnit, functions []Function,
 			// RIP-relative addressing won't work, so we replace with static-base loads
 			if line.hasConstPoolRef() {
 				constLabel := line.getConstPoolLabel()
-				if _, hasPool := constPools[constLabel]; hasPool {
-					goAsm := amd64RewriteConstPoolRef(line.Assembly, constLabel)
-					if goAsm != "" {
-						builder.WriteString(goAsm)
-						continue
-					}
-					// If we couldn't rewrite it, emit as comment and continue
-					builder.WriteString(fmt.Sprintf("\t// TODO: rewrite const pool ref: %s\n", line.Assembly))
-					continue
+				if _, hasPool := constPools[constLabel]; !hasPool {
+					return fmt.Errorf("%s: constant pool %s not found: %s", function.Name, constLabel, line.Assembly)
+				}
+				goAsm := amd64RewriteConstPoolRef(line.Assembly, constLabel)
+				if goAsm == "" {
+					return fmt.Errorf("%s: cannot rewrite constant pool reference: %s", function.Name, line.Assembly)
 				}
+				builder.WriteString(goAsm)
+				continue
 			}
 
 			if line.Assembly == "retq" {
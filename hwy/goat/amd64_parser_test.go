@@ -255,6 +255,24 @@ func TestAmd64RewriteConstPoolRef(t *testing.T) {
 			constLabel: "CPI0_0",
 			expected:   "\tVMOVAPS CPI0_0<>(SB), Y0\t// vmovaps\t.LCPI0_0(%rip), %ymm0\n",
 		},
+		{
+			name:       "vmovaps zmm",
+			input:      "vmovaps\t.LCPI0_1(%rip), %zmm2",
+			constLabel: "CPI0_1",
+			expected:   "\tVMOVUPS CPI0_1<>(SB), Z2\t// vmovaps\t.LCPI0_1(%rip), %zmm2\n",
+		},
+		{
+			name:       "vcmpps to mask",
+			input:      "vcmpps\t$5, .LCPI0_63(%rip), %zmm7, %k1",
+			constLabel: "CPI0_63",
+			expected:   "\tVCMPPS $5, CPI0_63<>(SB), Z7, K1\t// vcmpps\t$5, .LCPI0_63(%rip), %zmm7, %k1\n",
+		},
+		{
+			name:       "vblendvps selector",
+			input:      "vblendvps\t%ymm7, .LCPI0_25(%rip), %ymm0, %ymm1",
+			constLabel: "CPI0_25",
+			expected:   "\tVBLENDVPS Y7, CPI0_25<>(SB), Y0, Y1\t// vblendvps\t%ymm7, .LCPI0_25(%rip), %ymm0, %ymm1\n",
+		},
 		{
 			name:       "vmovdqa xmm",
 			input:      "vmovdqa\t.LCPI1_2(%rip), %xmm5",
@@ -19,6 +19,7 @@ import (
 	"fmt"
 	"os"
 	"regexp"
+	"sort"
 	"strconv"
 	"strings"
 	"unicode"
@@ -92,12 +93,18 @@ func normalizeLabel(label string) string {
 }
 
 // parseIntValue parses a decimal or hex integer value from a string.
+// Negative decimals, which GCC emits for constants with the sign bit set,
+// are returned as their two's complement bits.
 func parseIntValue(s string) uint64 {
 	s = strings.TrimSpace(s)
 	if strings.HasPrefix(s, "0x") || strings.HasPrefix(s, "0X") {
 		val, _ := strconv.ParseUint(s[2:], 16, 64)
 		return val
 	}
+	if strings.HasPrefix(s, "-") {
+		val, _ := strconv.ParseInt(s, 10, 64)
+		return uint64(val)
+	}
 	val, _ := strconv.ParseUint(s, 10, 64)
 	return val
 }
@@ -246,12 +253,19 @@ func (a *ConstPoolAccumulator) Pools() map[string]*ConstPool {
 	return a.pools
 }
 
-// emitConstPools writes DATA/GLOBL directives for all constant pools to the builder.
+// emitConstPools writes DATA/GLOBL directives for all constant pools to the
+// builder, in label order so regenerating a file reproduces it exactly.
 func emitConstPools(builder *strings.Builder, constPools map[string]*ConstPool) {
 	if len(constPools) > 0 {
 		builder.WriteString("\n#include \"textflag.h\"\n")
 		builder.WriteString("\n// Constant pool data\n")
-		for label, pool := range constPools {
+		labels := make([]string, 0, len(constPools))
+		for label := range constPools {
+			labels = append(labels, label)
+		}
+		sort.Strings(labels)
+		for _, label := range labels {
+			pool := constPools[label]
 			for i, val := range pool.Data {
 				fmt.Fprintf(builder, "DATA %s<>+%d(SB)/4, $0x%08x\n", label, i*4, val)
 			}
@@ -414,6 +414,8 @@ func TestParseIntValue(t *testing.T) {
 		{"0x3f800000", 0x3f800000},
 		{"0xFFFFFFFF", 0xFFFFFFFF},
 		{"0X10", 16},
+		{"-2147483648", 0xFFFFFFFF80000000},
+		{"-1", 0xFFFFFFFFFFFFFFFF},
 	}
 
 	for _, tt := range tests {
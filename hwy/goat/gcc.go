@@ -0,0 +1,292 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package main
+
+import (
+	"fmt"
+	"os"
+	"regexp"
+	"runtime"
+	"strconv"
+	"strings"
+)
+
+var (
+	// gccLocalLabel matches GCC's local labels and jump targets (.L5).
+	gccLocalLabel = regexp.MustCompile(`\.L(\d+)\b`)
+	// gccConstPool matches GCC's constant pool labels (.LC3).
+	gccConstPool = regexp.MustCompile(`\.LC(\d+)\b`)
+	// gccFunctionLabel matches a bare function label, which clang follows
+	// with a "# @name" comment that the parsers use to tell it from a label.
+	gccFunctionLabel = regexp.MustCompile(`(?m)^([A-Za-z_]\w*):$`)
+	// gccReturn matches GCC's unsuffixed return, which clang spells retq.
+	gccReturn = regexp.MustCompile(`(?m)^\tret$`)
+	// gccCall matches a call or a tail call, which GCC emits for math it
+	// does not inline.
+	gccCall = regexp.MustCompile(`(?m)^\t(?:call|jmp)\t([*A-Za-z_].*)$`)
+	// gccPoolAlias matches GCC's alias of one constant to an equal one.
+	gccPoolAlias = regexp.MustCompile(`(?m)^\t\.set\t(\.LC\d+),(\.LC\d+)\n`)
+	// gccValue and gccZero match the 16-bit and padding data directives GCC
+	// emits in constant pools, which the parser reads as .byte runs.
+	gccValue = regexp.MustCompile(`(?m)^\t\.value\t(-?\d+)$`)
+	gccZero  = regexp.MustCompile(`(?m)^\t\.zero\t(\d+)$`)
+	// gccRealign matches the stack realignment GCC emits for 64-byte spills.
+	gccRealign = regexp.MustCompile(`^\tandq\t\$-(\d+), %rsp$`)
+	// gccFrameAlloc matches the local frame allocation after a realignment.
+	gccFrameAlloc = regexp.MustCompile(`^\tsubq\t\$(\d+), %rsp$`)
+	// gccFrameRestore matches the epilogue that resets %rsp from %rbp.
+	gccFrameRestore = regexp.MustCompile(`^\tleaq\t-\d+\(%rbp\), %rsp$`)
+	// gccDRAP matches the argument pointer GCC sets up before realigning
+	// %rsp when the frame itself has to be addressed below %rbp.
+	gccDRAP = regexp.MustCompile(`^\tleaq\t8\(%rsp\), (%r\w+)$`)
+	// gccPush matches a register push in a prologue.
+	gccPush = regexp.MustCompile(`^\tpushq\t%\w+$`)
+	// gccCalleeSaveReload matches the reload of a callee-saved register
+	// that an epilogue pairs with leave instead of a pop.
+	gccCalleeSaveReload = regexp.MustCompile(`^\tmovq\t-\d+\(%rbp\), %(rbx|r1[2-5])$`)
+	// gccStackAdjust matches an allocation or a reset of %rsp in the body of
+	// a realigned function, used for over-aligned block-scoped arrays.
+	gccStackAdjust = regexp.MustCompile(`^\t(subq\t\$\d+|v?movq\t%\w+), %rsp$`)
+	// gccNegativeFrameRef matches any other access below %rbp.
+	gccNegativeFrameRef = regexp.MustCompile(`-\d+\(%rbp\)`)
+)
+
+// isGCC reports whether cc names a GCC driver (gcc, gcc-13, x86_64-linux-gnu-gcc).
+func isGCC(cc string) bool {
+	base := cc[strings.LastIndex(cc, "/")+1:]
+	return base == "gcc" || strings.HasPrefix(base, "gcc-") || strings.HasSuffix(base, "-gcc")
+}
+
+// compileGCC compiles the source with GCC instead of clang. It is limited to
+// native amd64: GCC has no -target, so cross builds still need clang. GCC's
+// local labels (.L5) and constant pools (.LC3) are renamed to clang's
+// .LBB0_5 and .LCPI0_3 so the amd64 parser reads both compilers' output.
+// -fno-math-errno and -fno-trapping-math match clang's defaults and keep
+// sqrt and round inline instead of calling libm.
+func (t *TranslateUnit) compileGCC(args ...string) error {
+	if runtime.GOARCH != "amd64" {
+		return fmt.Errorf("--cc %s: GCC is supported only for native amd64, running on %s", t.CC, runtime.GOARCH)
+	}
+	args = append(args, "-mno-red-zone", "-finline-limit=1000",
+		"-fno-asynchronous-unwind-tables", "-fno-exceptions", "-fno-builtin",
+		"-fomit-frame-pointer", "-fno-stack-protector", "-fcf-protection=none",
+		"-fno-pic", "-fno-plt", "-fno-math-errno", "-fno-trapping-math",
+		"-Werror=implicit-function-declaration")
+	args = append(args, t.parser.CompilerFlags()...)
+	if _, err := runCommand(t.CC, append([]string{"-S", "-c", t.Source, "-o", t.Assembly}, args...)...); err != nil {
+		return err
+	}
+	if err := normalizeGCCAssembly(t.Assembly); err != nil {
+		return err
+	}
+	_, err := runCommand(t.CC, append([]string{"-c", t.Assembly, "-o", t.Object}, args...)...)
+	return err
+}
+
+// normalizeGCCAssembly rewrites GCC label names in the assembly file at path
+// to the clang forms the parsers expect.
+func normalizeGCCAssembly(path string) error {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return err
+	}
+	if m := gccCall.FindStringSubmatch(string(data)); m != nil {
+		return fmt.Errorf("%s: unsupported call to %s", path, m[1])
+	}
+	s, err := rewriteRealignedFrames(string(data))
+	if err != nil {
+		return fmt.Errorf("%s: %w", path, err)
+	}
+	for _, m := range gccPoolAlias.FindAllStringSubmatch(s, -1) {
+		s = regexp.MustCompile(regexp.QuoteMeta(m[1])+`\b`).ReplaceAllString(s, m[2])
+	}
+	s = gccPoolAlias.ReplaceAllString(s, "")
+	s = gccConstPool.ReplaceAllString(s, ".LCPI0_$1")
+	s = gccLocalLabel.ReplaceAllString(s, ".LBB0_$1")
+	s = gccFunctionLabel.ReplaceAllString(s, "$1:\t\t\t\t# @$1")
+	s = gccReturn.ReplaceAllString(s, "\tretq")
+	s = gccValue.ReplaceAllStringFunc(s, func(line string) string {
+		v := parseIntValue(gccValue.FindStringSubmatch(line)[1])
+		return fmt.Sprintf("\t.byte\t%d\n\t.byte\t%d", v&0xff, v>>8&0xff)
+	})
+	s = gccZero.ReplaceAllStringFunc(s, func(line string) string {
+		n, _ := strconv.Atoi(gccZero.FindStringSubmatch(line)[1])
+		return strings.TrimSuffix(strings.Repeat("\t.byte\t0\n", n), "\n")
+	})
+	return os.WriteFile(path, []byte(s), 0o644)
+}
+
+// rewriteRealignedFrames moves GCC's realigned frames inside the Go frame.
+//
+// When a function spills 64-byte vectors, GCC saves %rbp, points it at the
+// entry %rsp, rounds %rsp down with andq and reads stack arguments from
+// 16(%rbp). GoAT drops the pushes and the subq, places stack arguments at
+// the top of the Go frame and expects %rsp to be unchanged at RET. So the
+// rewrite grows the frame by the alignment, rounds %rsp up into it instead
+// of down below it, and points %rbp 16 bytes below the stack arguments.
+func rewriteRealignedFrames(s string) (string, error) {
+	lines := strings.Split(s, "\n")
+	start := 0
+	for i := 0; i <= len(lines); i++ {
+		if i < len(lines) && !gccFunctionLabel.MatchString(lines[i]) {
+			continue
+		}
+		if err := rewriteRealignedFrame(lines[start:i]); err != nil {
+			return "", err
+		}
+		start = i
+	}
+	return strings.Join(lines, "\n"), nil
+}
+
+func rewriteRealignedFrame(fn []string) error {
+	realign := -1
+	for i, line := range fn {
+		if gccRealign.MatchString(line) {
+			realign = i
+			break
+		}
+	}
+	if realign < 0 {
+		return rewriteFramePointer(fn)
+	}
+	align, _ := strconv.Atoi(gccRealign.FindStringSubmatch(fn[realign])[1])
+	if realign > 0 && gccDRAP.MatchString(fn[realign-1]) {
+		return rewriteDRAPFrame(fn, realign, align)
+	}
+	alloc, locals := -1, 0
+	if realign+1 < len(fn) {
+		if m := gccFrameAlloc.FindStringSubmatch(fn[realign+1]); m != nil {
+			alloc = realign + 1
+			locals, _ = strconv.Atoi(m[1])
+		}
+	}
+	frame := locals + align
+	base := fmt.Sprintf("%d(%%rsp), %%rbp", frame-16)
+	for i, line := range fn {
+		switch {
+		case line == "\tmovq\t%rsp, %rbp":
+			fn[i] = "\tleaq\t" + base
+		case i == realign:
+			fn[i] = fmt.Sprintf("\tleaq\t%d(%%rsp), %%rsp\n%s", align, line)
+			if alloc < 0 {
+				fn[i] += fmt.Sprintf("\n\tsubq\t$%d, %%rsp", frame)
+			}
+		case i == alloc:
+			fn[i] = fmt.Sprintf("\tsubq\t$%d, %%rsp", frame)
+		case gccFrameRestore.MatchString(line), line == "\tleave":
+			fn[i] = fmt.Sprintf("\tleaq\t-%d(%%rbp), %%rsp", frame-16)
+		case gccStackAdjust.MatchString(line):
+			return fmt.Errorf("unsupported stack adjustment in a realigned frame: %s", strings.TrimSpace(line))
+		case gccNegativeFrameRef.MatchString(line):
+			return fmt.Errorf("unsupported access below the realigned frame: %s", strings.TrimSpace(line))
+		}
+	}
+	return nil
+}
+
+// rewriteDRAPFrame moves a realigned frame that GCC addresses through an
+// argument pointer inside the Go frame.
+//
+// When the locals live below %rbp, GCC keeps the address of the stack
+// arguments in a scratch register (the DRAP), rounds %rsp down, copies the
+// return address, saves %rbp and the callee-saved registers and the DRAP
+// itself, and restores %rsp from the DRAP on return. The rewrite replaces
+// the prologue with one Go frame holding the pushes, the locals and the
+// alignment slack: the DRAP points at the top of the Go frame, where GoAT
+// places stack arguments, %rbp is rounded down below it, and the DRAP save
+// and restore become moves to its push slot, since GoAT drops pushes.
+func rewriteDRAPFrame(fn []string, realign, align int) error {
+	drap := gccDRAP.FindStringSubmatch(fn[realign-1])[1]
+	setup, alloc, locals := -1, -1, 0
+	var pushes []int
+	for i := realign + 1; i < len(fn) && alloc < 0; i++ {
+		switch {
+		case fn[i] == "\tmovq\t%rsp, %rbp":
+			setup = i
+		case setup >= 0 && gccPush.MatchString(fn[i]):
+			pushes = append(pushes, i)
+		case setup >= 0:
+			if m := gccFrameAlloc.FindStringSubmatch(fn[i]); m != nil {
+				alloc = i
+				locals, _ = strconv.Atoi(m[1])
+			}
+		}
+	}
+	if setup < 0 {
+		return fmt.Errorf("realigned frame with an argument pointer does not set up %%rbp")
+	}
+	saved := 8 * len(pushes)
+	frame := locals + saved + align + 16
+	slot := ""
+	for n, i := range pushes {
+		if fn[i] == "\tpushq\t"+drap {
+			slot = fmt.Sprintf("-%d(%%rbp)", 8*(n+1))
+			fn[i] = fmt.Sprintf("\tmovq\t%s, %s", drap, slot)
+		}
+	}
+	fn[realign-1] = fmt.Sprintf("\tsubq\t$%d, %%rsp\n\tleaq\t%d(%%rsp), %s\n\tleaq\t%d(%%rsp), %%rbp\n\tandq\t$-%d, %%rbp\n\tleaq\t-16(%%rbp), %%rbp",
+		frame, frame, drap, frame, align)
+	fn[realign] = ""
+	fn[setup] = ""
+	below := fmt.Sprintf("\tleaq\t-%d(%%rbp), %%rsp", saved+locals)
+	if alloc >= 0 {
+		fn[alloc] = below
+	} else {
+		fn[setup] = below
+	}
+	for i, line := range fn {
+		switch {
+		case line == "\tpushq\t-8("+drap+")", line == "\tleave":
+			fn[i] = ""
+		case line == "\tpopq\t"+drap:
+			if slot == "" {
+				return fmt.Errorf("argument pointer %s restored without a save", drap)
+			}
+			fn[i] = fmt.Sprintf("\tmovq\t%s, %s", slot, drap)
+		case line == "\tleaq\t-8("+drap+"), %rsp":
+			fn[i] = fmt.Sprintf("\tleaq\t-%d(%s), %%rsp", frame, drap)
+		case gccStackAdjust.MatchString(line):
+			return fmt.Errorf("unsupported stack adjustment in a realigned frame: %s", strings.TrimSpace(line))
+		}
+	}
+	return nil
+}
+
+// rewriteFramePointer drops the frame epilogue of a function that sets up
+// %rbp without realigning %rsp. GoAT drops the pushes that save %rbp and the
+// callee-saved registers, so %rbp holds the entry %rsp, there is nothing to
+// reload and leave would pop one slot too many.
+func rewriteFramePointer(fn []string) error {
+	for i, line := range fn {
+		switch {
+		case line == "\tleave", gccCalleeSaveReload.MatchString(line):
+			fn[i] = ""
+		case gccNegativeFrameRef.MatchString(line):
+			return fmt.Errorf("unsupported access below the frame pointer: %s", strings.TrimSpace(line))
+		}
+	}
+	return nil
+}
+
+// fetchCompilerVersion returns the version of the C compiler for the header.
+func fetchCompilerVersion(cc string) string {
+	if isGCC(cc) {
+		if version, err := runCommand(cc, "-dumpfullversion"); err == nil {
+			return strings.TrimSpace(version)
+		}
+	}
+	return fetchVersion(cc)
+}
@@ -0,0 +1,221 @@
+package main
+
+import (
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+)
+
+func TestIsGCC(t *testing.T) {
+	for cc, want := range map[string]bool{
+		"gcc":                           true,
+		"gcc-13":                        true,
+		"/usr/bin/x86_64-linux-gnu-gcc": true,
+		"clang":                         false,
+		"clang-18":                      false,
+	} {
+		if got := isGCC(cc); got != want {
+			t.Errorf("isGCC(%q) = %v, want %v", cc, got, want)
+		}
+	}
+}
+
+func TestNormalizeGCCAssembly(t *testing.T) {
+	src := strings.Join([]string{
+		"dot:",
+		"\tvmovaps\t.LC0(%rip), %ymm0",
+		"\tvmovss\t.LC2(%rip), %xmm1",
+		"\tjle\t.L5",
+		".L5:",
+		"\tret",
+		".LC1:",
+		"\t.value\t-2",
+		"\t.zero\t2",
+		"\t.set\t.LC2,.LC1",
+		"",
+	}, "\n")
+	path := filepath.Join(t.TempDir(), "dot.s")
+	if err := os.WriteFile(path, []byte(src), 0o644); err != nil {
+		t.Fatal(err)
+	}
+	if err := normalizeGCCAssembly(path); err != nil {
+		t.Fatal(err)
+	}
+	data, err := os.ReadFile(path)
+	if err != nil {
+		t.Fatal(err)
+	}
+	want := strings.Join([]string{
+		"dot:\t\t\t\t# @dot",
+		"\tvmovaps\t.LCPI0_0(%rip), %ymm0",
+		"\tvmovss\t.LCPI0_1(%rip), %xmm1",
+		"\tjle\t.LBB0_5",
+		".LBB0_5:",
+		"\tretq",
+		".LCPI0_1:",
+		"\t.byte\t254",
+		"\t.byte\t255",
+		"\t.byte\t0",
+		"\t.byte\t0",
+		"",
+	}, "\n")
+	if got := string(data); got != want {
+		t.Errorf("normalizeGCCAssembly:\ngot:\n%s\nwant:\n%s", got, want)
+	}
+}
+
+func TestNormalizeGCCAssemblyRejectsCalls(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "exp.s")
+	if err := os.WriteFile(path, []byte("exp:\n\tcall\tround\n\tret\n"), 0o644); err != nil {
+		t.Fatal(err)
+	}
+	if err := normalizeGCCAssembly(path); err == nil || !strings.Contains(err.Error(), "call to round") {
+		t.Errorf("err = %v, want unsupported call to round", err)
+	}
+	if err := os.WriteFile(path, []byte("sort:\n\tjmp\t*sortSmall@GOTPCREL(%rip)\n"), 0o644); err != nil {
+		t.Fatal(err)
+	}
+	if err := normalizeGCCAssembly(path); err == nil || !strings.Contains(err.Error(), "call to *sortSmall") {
+		t.Errorf("err = %v, want unsupported call to *sortSmall", err)
+	}
+}
+
+func TestRewriteRealignedFrames(t *testing.T) {
+	tests := []struct {
+		name    string
+		input   []string
+		want    []string
+		wantErr string
+	}{
+		{
+			name: "realigned",
+			input: []string{
+				"f:",
+				"\tpushq\t%rbp",
+				"\tmovq\t%rsp, %rbp",
+				"\tandq\t$-64, %rsp",
+				"\tsubq\t$64, %rsp",
+				"\tmovq\t16(%rbp), %rax",
+				"\tleave",
+				"\tret",
+			},
+			want: []string{
+				"f:",
+				"\tpushq\t%rbp",
+				"\tleaq\t112(%rsp), %rbp",
+				"\tleaq\t64(%rsp), %rsp\n\tandq\t$-64, %rsp",
+				"\tsubq\t$128, %rsp",
+				"\tmovq\t16(%rbp), %rax",
+				"\tleaq\t-112(%rbp), %rsp",
+				"\tret",
+			},
+		},
+		{
+			name: "frame pointer",
+			input: []string{
+				"f:",
+				"\tpushq\t%rbp",
+				"\tmovq\t%rsp, %rbp",
+				"\tpushq\t%rbx",
+				"\tmovq\t-8(%rbp), %rbx",
+				"\tleave",
+				"\tret",
+			},
+			want: []string{
+				"f:",
+				"\tpushq\t%rbp",
+				"\tmovq\t%rsp, %rbp",
+				"\tpushq\t%rbx",
+				"",
+				"",
+				"\tret",
+			},
+		},
+		{
+			name: "argument pointer",
+			input: []string{
+				"f:",
+				"\tleaq\t8(%rsp), %r10",
+				"\tandq\t$-32, %rsp",
+				"\tpushq\t-8(%r10)",
+				"\tpushq\t%rbp",
+				"\tmovq\t%rsp, %rbp",
+				"\tpushq\t%r15",
+				"\tpushq\t%r10",
+				"\tpushq\t%rbx",
+				"\tsubq\t$64, %rsp",
+				"\tmovq\t%rax, -96(%rbp)",
+				"\tleaq\t-24(%rbp), %rsp",
+				"\tpopq\t%rbx",
+				"\tpopq\t%r10",
+				"\tpopq\t%r15",
+				"\tpopq\t%rbp",
+				"\tleaq\t-8(%r10), %rsp",
+				"\tret",
+			},
+			want: []string{
+				"f:",
+				"\tsubq\t$136, %rsp\n\tleaq\t136(%rsp), %r10\n\tleaq\t136(%rsp), %rbp\n\tandq\t$-32, %rbp\n\tleaq\t-16(%rbp), %rbp",
+				"",
+				"",
+				"\tpushq\t%rbp",
+				"",
+				"\tpushq\t%r15",
+				"\tmovq\t%r10, -16(%rbp)",
+				"\tpushq\t%rbx",
+				"\tleaq\t-88(%rbp), %rsp",
+				"\tmovq\t%rax, -96(%rbp)",
+				"\tleaq\t-24(%rbp), %rsp",
+				"\tpopq\t%rbx",
+				"\tmovq\t-16(%rbp), %r10",
+				"\tpopq\t%r15",
+				"\tpopq\t%rbp",
+				"\tleaq\t-136(%r10), %rsp",
+				"\tret",
+			},
+		},
+		{
+			name: "stack adjustment in body",
+			input: []string{
+				"f:",
+				"\tleaq\t8(%rsp), %r10",
+				"\tandq\t$-64, %rsp",
+				"\tpushq\t%rbp",
+				"\tmovq\t%rsp, %rbp",
+				"\tsubq\t$64, %rsp",
+				"\tmovq\t%rsp, %r14",
+				"\tsubq\t$1088, %rsp",
+				"\tmovq\t%r14, %rsp",
+			},
+			wantErr: "stack adjustment",
+		},
+		{
+			name: "local below frame pointer",
+			input: []string{
+				"f:",
+				"\tpushq\t%rbp",
+				"\tmovq\t%rsp, %rbp",
+				"\tvmovaps\t%ymm0, -48(%rbp)",
+			},
+			wantErr: "below the frame pointer",
+		},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			got, err := rewriteRealignedFrames(strings.Join(tt.input, "\n"))
+			if tt.wantErr != "" {
+				if err == nil || !strings.Contains(err.Error(), tt.wantErr) {
+					t.Fatalf("err = %v, want %q", err, tt.wantErr)
+				}
+				return
+			}
+			if err != nil {
+				t.Fatal(err)
+			}
+			if want := strings.Join(tt.want, "\n"); got != want {
+				t.Errorf("got:\n%s\nwant:\n%s", got, want)
+			}
+		})
+	}
+}
@@ -51,12 +51,13 @@ type TranslateUnit struct {
 	IncludePaths []string // Additional include paths for C parser
 	Sysroot      string   // Explicit sysroot path for cross-compilation
 	Offset       int
+	CC           string     // C compiler driver, clang unless --cc says otherwise
 	Target       string     // Target architecture (amd64, arm64, etc.)
 	TargetOS     string     // Target OS (darwin, linux, etc.)
 	parser       ArchParser // Architecture-specific parser
 }
 
-func NewTranslateUnit(source string, outputDir string, target string, targetOS string, includePaths []string, sysroot string, options ...string) (TranslateUnit, error) {
+func NewTranslateUnit(source string, outputDir string, cc string, target string, targetOS string, includePaths []string, sysroot string, options ...string) (TranslateUnit, error) {
 	sourceExt := filepath.Ext(source)
 	noExtSourcePath := source[:len(source)-len(sourceExt)]
 	noExtSourceBase := filepath.Base(noExtSourcePath)
@@ -65,6 +66,11 @@ func NewTranslateUnit(source string, outputDir string, target string, targetOS s
 	if err != nil {
 		return TranslateUnit{}, err
 	}
+	// GCC output is only lowered for amd64; other targets keep clang so one
+	// --cc gcc run can regenerate a package that also has arm64 kernels.
+	if isGCC(cc) && target != "amd64" {
+		cc = "clang"
+	}
 
 	return TranslateUnit{
 		Source:       source,
@@ -76,6 +82,7 @@ func NewTranslateUnit(source string, outputDir string, target string, targetOS s
 		Options:      options,
 		IncludePaths: includePaths,
 		Sysroot:      sysroot,
+		CC:           cc,
 		Target:       target,
 		TargetOS:     targetOS,
 		parser:       parser,
@@ -228,6 +235,9 @@ func (t *TranslateUnit) generateGoStubs(functions []Function) error {
 }
 
 func (t *TranslateUnit) compile(args ...string) error {
+	if isGCC(t.CC) {
+		return t.compileGCC(args...)
+	}
 	args = append(args, "-mno-red-zone", "-mllvm", "-inline-threshold=1000",
 		"-fno-asynchronous-unwind-tables", "-fno-exceptions", "-fno-rtti", "-fno-builtin",
 		"-fomit-frame-pointer", "-fno-stack-protector")
@@ -252,7 +262,7 @@ func (t *TranslateUnit) compile(args ...string) error {
 	}
 
 	target := t.parser.BuildTarget(t.TargetOS)
-	_, err := runCommand("clang", append([]string{"-S", "-target", target, "-c", t.Source, "-o", t.Assembly}, args...)...)
+	_, err := runCommand(t.CC, append([]string{"-S", "-target", target, "-c", t.Source, "-o", t.Assembly}, args...)...)
 	if err != nil {
 		return err
 	}
@@ -268,7 +278,7 @@ func (t *TranslateUnit) compile(args ...string) error {
 		}
 	}
 
-	_, err = runCommand("clang", append([]string{"-target", target, "-c", t.Assembly, "-o", t.Object}, args...)...)
+	_, err = runCommand(t.CC, append([]string{"-target", target, "-c", t.Assembly, "-o", t.Object}, args...)...)
 	return err
 }
 
@@ -580,7 +590,7 @@ func sanitizeAsmParamName(name string) string {
 func (t *TranslateUnit) writeHeader(builder *strings.Builder) {
 	builder.WriteString("// Code generated by GoAT. DO NOT EDIT.\n")
 	builder.WriteString("// versions:\n")
-	builder.WriteString(fmt.Sprintf("// 	clang   %s\n", fetchVersion("clang")))
+	builder.WriteString(fmt.Sprintf("// 	%-7s %s\n", t.CC[strings.LastIndex(t.CC, "/")+1:], fetchCompilerVersion(t.CC)))
 	builder.WriteString(fmt.Sprintf("// 	objdump %s\n", fetchObjdumpVersion()))
 	builder.WriteString("// flags:")
 	for _, option := range t.Options {
@@ -679,7 +689,8 @@ var command = &cobra.Command{
 		options = append(options, fmt.Sprintf("-O%d", optimizeLevel))
 		includePaths, _ := cmd.PersistentFlags().GetStringSlice("include-path")
 		sysroot, _ := cmd.PersistentFlags().GetString("sysroot")
-		file, err := NewTranslateUnit(args[0], output, target, targetOS, includePaths, sysroot, options...)
+		cc, _ := cmd.PersistentFlags().GetString("cc")
+		file, err := NewTranslateUnit(args[0], output, cc, target, targetOS, includePaths, sysroot, options...)
 		if err != nil {
 			_, _ = fmt.Fprintln(os.Stderr, err)
 			os.Exit(1)
@@ -701,6 +712,7 @@ func init() {
 	command.PersistentFlags().String("target-os", runtime.GOOS, "target operating system (darwin, linux, windows)")
 	command.PersistentFlags().StringSliceP("include-path", "I", nil, "additional include path for C parser (for cross-compilation)")
 	command.PersistentFlags().String("sysroot", "", "sysroot path for cross-compilation (passed as --sysroot to clang)")
+	command.PersistentFlags().String("cc", "clang", "C compiler: clang, or gcc for native amd64 targets (other targets use clang)")
 }
 
 func main() {
@@ -0,0 +1,163 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//go:build amd64 && goexperiment.simd
+
+package hwy
+
+import (
+	"simd/archsimd"
+	"unsafe"
+)
+
+// Masked loads and stores for AVX2, used by hwygen's //hwy:maskedtail
+// lowering. The mask must enable only the first len(slice) lanes, as
+// FirstN(len(slice)) does. The masked move never touches disabled lanes, so
+// the slice's data pointer is used directly even when fewer than a vector of
+// elements remain. Only a checkptr build (-race, -msan, -asan) with a slice
+// whose capacity is shorter than a vector bounces through a stack buffer:
+// checkptr rejects a full-width array pointer that reaches past the
+// allocation even though the masked move would not dereference it.
+
+// MaskLoad_AVX2_F32x8 loads the lanes of src enabled by mask and zeroes the rest.
+func MaskLoad_AVX2_F32x8(mask archsimd.Mask32x8, src []float32) archsimd.Float32x8 {
+	if cap(src) >= 8 || !checkptrEnabled {
+		return archsimd.LoadMaskedFloat32x8((*[8]float32)(unsafe.Pointer(unsafe.SliceData(src))), mask)
+	}
+	var buf [8]float32
+	copy(buf[:], src)
+	return archsimd.LoadMaskedFloat32x8(&buf, mask)
+}
+
+// MaskStore_AVX2_F32x8 stores the lanes of v enabled by mask to dst.
+func MaskStore_AVX2_F32x8(mask archsimd.Mask32x8, v archsimd.Float32x8, dst []float32) {
+	if cap(dst) >= 8 || !checkptrEnabled {
+		v.StoreMasked((*[8]float32)(unsafe.Pointer(unsafe.SliceData(dst))), mask)
+		return
+	}
+	var buf [8]float32
+	copy(buf[:], dst)
+	v.StoreMasked(&buf, mask)
+	copy(dst, buf[:len(dst)])
+}
+
+// MaskLoad_AVX2_F64x4 loads the lanes of src enabled by mask and zeroes the rest.
+func MaskLoad_AVX2_F64x4(mask archsimd.Mask64x4, src []float64) archsimd.Float64x4 {
+	if cap(src) >= 4 || !checkptrEnabled {
+		return archsimd.LoadMaskedFloat64x4((*[4]float64)(unsafe.Pointer(unsafe.SliceData(src))), mask)
+	}
+	var buf [4]float64
+	copy(buf[:], src)
+	return archsimd.LoadMaskedFloat64x4(&buf, mask)
+}
+
+// MaskStore_AVX2_F64x4 stores the lanes of v enabled by mask to dst.
+func MaskStore_AVX2_F64x4(mask archsimd.Mask64x4, v archsimd.Float64x4, dst []float64) {
+	if cap(dst) >= 4 || !checkptrEnabled {
+		v.StoreMasked((*[4]float64)(unsafe.Pointer(unsafe.SliceData(dst))), mask)
+		return
+	}
+	var buf [4]float64
+	copy(buf[:], dst)
+	v.StoreMasked(&buf, mask)
+	copy(dst, buf[:len(dst)])
+}
+
+// MaskLoad_AVX2_I32x8 loads the lanes of src enabled by mask and zeroes the rest.
+func MaskLoad_AVX2_I32x8(mask archsimd.Mask32x8, src []int32) archsimd.Int32x8 {
+	if cap(src) >= 8 || !checkptrEnabled {
+		return archsimd.LoadMaskedInt32x8((*[8]int32)(unsafe.Pointer(unsafe.SliceData(src))), mask)
+	}
+	var buf [8]int32
+	copy(buf[:], src)
+	return archsimd.LoadMaskedInt32x8(&buf, mask)
+}
+
+// MaskStore_AVX2_I32x8 stores the lanes of v enabled by mask to dst.
+func MaskStore_AVX2_I32x8(mask archsimd.Mask32x8, v archsimd.Int32x8, dst []int32) {
+	if cap(dst) >= 8 || !checkptrEnabled {
+		v.StoreMasked((*[8]int32)(unsafe.Pointer(unsafe.SliceData(dst))), mask)
+		return
+	}
+	var buf [8]int32
+	copy(buf[:], dst)
+	v.StoreMasked(&buf, mask)
+	copy(dst, buf[:len(dst)])
+}
+
+// MaskLoad_AVX2_I64x4 loads the lanes of src enabled by mask and zeroes the rest.
+func MaskLoad_AVX2_I64x4(mask archsimd.Mask64x4, src []int64) archsimd.Int64x4 {
+	if cap(src) >= 4 || !checkptrEnabled {
+		return archsimd.LoadMaskedInt64x4((*[4]int64)(unsafe.Pointer(unsafe.SliceData(src))), mask)
+	}
+	var buf [4]int64
+	copy(buf[:], src)
+	return archsimd.LoadMaskedInt64x4(&buf, mask)
+}
+
+// MaskStore_AVX2_I64x4 stores the lanes of v enabled by mask to dst.
+func MaskStore_AVX2_I64x4(mask archsimd.Mask64x4, v archsimd.Int64x4, dst []int64) {
+	if cap(dst) >= 4 || !checkptrEnabled {
+		v.StoreMasked((*[4]int64)(unsafe.Pointer(unsafe.SliceData(dst))), mask)
+		return
+	}
+	var buf [4]int64
+	copy(buf[:], dst)
+	v.StoreMasked(&buf, mask)
+	copy(dst, buf[:len(dst)])
+}
+
+// MaskLoad_AVX2_Uint32x8 loads the lanes of src enabled by mask and zeroes the rest.
+func MaskLoad_AVX2_Uint32x8(mask archsimd.Mask32x8, src []uint32) archsimd.Uint32x8 {
+	if cap(src) >= 8 || !checkptrEnabled {
+		return archsimd.LoadMaskedUint32x8((*[8]uint32)(unsafe.Pointer(unsafe.SliceData(src))), mask)
+	}
+	var buf [8]uint32
+	copy(buf[:], src)
+	return archsimd.LoadMaskedUint32x8(&buf, mask)
+}
+
+// MaskStore_AVX2_Uint32x8 stores the lanes of v enabled by mask to dst.
+func MaskStore_AVX2_Uint32x8(mask archsimd.Mask32x8, v archsimd.Uint32x8, dst []uint32) {
+	if cap(dst) >= 8 || !checkptrEnabled {
+		v.StoreMasked((*[8]uint32)(unsafe.Pointer(unsafe.SliceData(dst))), mask)
+		return
+	}
+	var buf [8]uint32
+	copy(buf[:], dst)
+	v.StoreMasked(&buf, mask)
+	copy(dst, buf[:len(dst)])
+}
+
+// MaskLoad_AVX2_Uint64x4 loads the lanes of src enabled by mask and zeroes the rest.
+func MaskLoad_AVX2_Uint64x4(mask archsimd.Mask64x4, src []uint64) archsimd.Uint64x4 {
+	if cap(src) >= 4 || !checkptrEnabled {
+		return archsimd.LoadMaskedUint64x4((*[4]uint64)(unsafe.Pointer(unsafe.SliceData(src))), mask)
+	}
+	var buf [4]uint64
+	copy(buf[:], src)
+	return archsimd.LoadMaskedUint64x4(&buf, mask)
+}
+
+// MaskStore_AVX2_Uint64x4 stores the lanes of v enabled by mask to dst.
+func MaskStore_AVX2_Uint64x4(mask archsimd.Mask64x4, v archsimd.Uint64x4, dst []uint64) {
+	if cap(dst) >= 4 || !checkptrEnabled {
+		v.StoreMasked((*[4]uint64)(unsafe.Pointer(unsafe.SliceData(dst))), mask)
+		return
+	}
+	var buf [4]uint64
+	copy(buf[:], dst)
+	v.StoreMasked(&buf, mask)
+	copy(dst, buf[:len(dst)])
+}
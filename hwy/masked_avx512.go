@@ -0,0 +1,163 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//go:build amd64 && goexperiment.simd
+
+package hwy
+
+import (
+	"simd/archsimd"
+	"unsafe"
+)
+
+// Masked loads and stores for AVX-512, used by hwygen's //hwy:maskedtail
+// lowering. The mask must enable only the first len(slice) lanes, as
+// FirstN(len(slice)) does. The masked move never touches disabled lanes, so
+// the slice's data pointer is used directly even when fewer than a vector of
+// elements remain. Only a checkptr build (-race, -msan, -asan) with a slice
+// whose capacity is shorter than a vector bounces through a stack buffer:
+// checkptr rejects a full-width array pointer that reaches past the
+// allocation even though the masked move would not dereference it.
+
+// MaskLoad_AVX512_F32x16 loads the lanes of src enabled by mask and zeroes the rest.
+func MaskLoad_AVX512_F32x16(mask archsimd.Mask32x16, src []float32) archsimd.Float32x16 {
+	if cap(src) >= 16 || !checkptrEnabled {
+		return archsimd.LoadMaskedFloat32x16((*[16]float32)(unsafe.Pointer(unsafe.SliceData(src))), mask)
+	}
+	var buf [16]float32
+	copy(buf[:], src)
+	return archsimd.LoadMaskedFloat32x16(&buf, mask)
+}
+
+// MaskStore_AVX512_F32x16 stores the lanes of v enabled by mask to dst.
+func MaskStore_AVX512_F32x16(mask archsimd.Mask32x16, v archsimd.Float32x16, dst []float32) {
+	if cap(dst) >= 16 || !checkptrEnabled {
+		v.StoreMasked((*[16]float32)(unsafe.Pointer(unsafe.SliceData(dst))), mask)
+		return
+	}
+	var buf [16]float32
+	copy(buf[:], dst)
+	v.StoreMasked(&buf, mask)
+	copy(dst, buf[:len(dst)])
+}
+
+// MaskLoad_AVX512_F64x8 loads the lanes of src enabled by mask and zeroes the rest.
+func MaskLoad_AVX512_F64x8(mask archsimd.Mask64x8, src []float64) archsimd.Float64x8 {
+	if cap(src) >= 8 || !checkptrEnabled {
+		return archsimd.LoadMaskedFloat64x8((*[8]float64)(unsafe.Pointer(unsafe.SliceData(src))), mask)
+	}
+	var buf [8]float64
+	copy(buf[:], src)
+	return archsimd.LoadMaskedFloat64x8(&buf, mask)
+}
+
+// MaskStore_AVX512_F64x8 stores the lanes of v enabled by mask to dst.
+func MaskStore_AVX512_F64x8(mask archsimd.Mask64x8, v archsimd.Float64x8, dst []float64) {
+	if cap(dst) >= 8 || !checkptrEnabled {
+		v.StoreMasked((*[8]float64)(unsafe.Pointer(unsafe.SliceData(dst))), mask)
+		return
+	}
+	var buf [8]float64
+	copy(buf[:], dst)
+	v.StoreMasked(&buf, mask)
+	copy(dst, buf[:len(dst)])
+}
+
+// MaskLoad_AVX512_I32x16 loads the lanes of src enabled by mask and zeroes the rest.
+func MaskLoad_AVX512_I32x16(mask archsimd.Mask32x16, src []int32) archsimd.Int32x16 {
+	if cap(src) >= 16 || !checkptrEnabled {
+		return archsimd.LoadMaskedInt32x16((*[16]int32)(unsafe.Pointer(unsafe.SliceData(src))), mask)
+	}
+	var buf [16]int32
+	copy(buf[:], src)
+	return archsimd.LoadMaskedInt32x16(&buf, mask)
+}
+
+// MaskStore_AVX512_I32x16 stores the lanes of v enabled by mask to dst.
+func MaskStore_AVX512_I32x16(mask archsimd.Mask32x16, v archsimd.Int32x16, dst []int32) {
+	if cap(dst) >= 16 || !checkptrEnabled {
+		v.StoreMasked((*[16]int32)(unsafe.Pointer(unsafe.SliceData(dst))), mask)
+		return
+	}
+	var buf [16]int32
+	copy(buf[:], dst)
+	v.StoreMasked(&buf, mask)
+	copy(dst, buf[:len(dst)])
+}
+
+// MaskLoad_AVX512_I64x8 loads the lanes of src enabled by mask and zeroes the rest.
+func MaskLoad_AVX512_I64x8(mask archsimd.Mask64x8, src []int64) archsimd.Int64x8 {
+	if cap(src) >= 8 || !checkptrEnabled {
+		return archsimd.LoadMaskedInt64x8((*[8]int64)(unsafe.Pointer(unsafe.SliceData(src))), mask)
+	}
+	var buf [8]int64
+	copy(buf[:], src)
+	return archsimd.LoadMaskedInt64x8(&buf, mask)
+}
+
+// MaskStore_AVX512_I64x8 stores the lanes of v enabled by mask to dst.
+func MaskStore_AVX512_I64x8(mask archsimd.Mask64x8, v archsimd.Int64x8, dst []int64) {
+	if cap(dst) >= 8 || !checkptrEnabled {
+		v.StoreMasked((*[8]int64)(unsafe.Pointer(unsafe.SliceData(dst))), mask)
+		return
+	}
+	var buf [8]int64
+	copy(buf[:], dst)
+	v.StoreMasked(&buf, mask)
+	copy(dst, buf[:len(dst)])
+}
+
+// MaskLoad_AVX512_Uint32x16 loads the lanes of src enabled by mask and zeroes the rest.
+func MaskLoad_AVX512_Uint32x16(mask archsimd.Mask32x16, src []uint32) archsimd.Uint32x16 {
+	if cap(src) >= 16 || !checkptrEnabled {
+		return archsimd.LoadMaskedUint32x16((*[16]uint32)(unsafe.Pointer(unsafe.SliceData(src))), mask)
+	}
+	var buf [16]uint32
+	copy(buf[:], src)
+	return archsimd.LoadMaskedUint32x16(&buf, mask)
+}
+
+// MaskStore_AVX512_Uint32x16 stores the lanes of v enabled by mask to dst.
+func MaskStore_AVX512_Uint32x16(mask archsimd.Mask32x16, v archsimd.Uint32x16, dst []uint32) {
+	if cap(dst) >= 16 || !checkptrEnabled {
+		v.StoreMasked((*[16]uint32)(unsafe.Pointer(unsafe.SliceData(dst))), mask)
+		return
+	}
+	var buf [16]uint32
+	copy(buf[:], dst)
+	v.StoreMasked(&buf, mask)
+	copy(dst, buf[:len(dst)])
+}
+
+// MaskLoad_AVX512_Uint64x8 loads the lanes of src enabled by mask and zeroes the rest.
+func MaskLoad_AVX512_Uint64x8(mask archsimd.Mask64x8, src []uint64) archsimd.Uint64x8 {
+	if cap(src) >= 8 || !checkptrEnabled {
+		return archsimd.LoadMaskedUint64x8((*[8]uint64)(unsafe.Pointer(unsafe.SliceData(src))), mask)
+	}
+	var buf [8]uint64
+	copy(buf[:], src)
+	return archsimd.LoadMaskedUint64x8(&buf, mask)
+}
+
+// MaskStore_AVX512_Uint64x8 stores the lanes of v enabled by mask to dst.
+func MaskStore_AVX512_Uint64x8(mask archsimd.Mask64x8, v archsimd.Uint64x8, dst []uint64) {
+	if cap(dst) >= 8 || !checkptrEnabled {
+		v.StoreMasked((*[8]uint64)(unsafe.Pointer(unsafe.SliceData(dst))), mask)
+		return
+	}
+	var buf [8]uint64
+	copy(buf[:], dst)
+	v.StoreMasked(&buf, mask)
+	copy(dst, buf[:len(dst)])
+}
@@ -0,0 +1,104 @@
+// Copyright 2025 go-highway Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//go:build amd64 && goexperiment.simd
+
+package hwy
+
+import (
+	"fmt"
+	"testing"
+)
+
+// TestMaskStoreLeavesSpareCapacity stores into a short window of a longer
+// buffer, the direct path even under checkptr, and checks that lanes past
+// len are left alone.
+func TestMaskStoreLeavesSpareCapacity(t *testing.T) {
+	if !hasAVX2 {
+		t.Skip("AVX2 not available")
+	}
+	const sentinel = -1
+	for n := 1; n < 8; n++ {
+		src := make([]float32, n)
+		for i := range src {
+			src[i] = float32(i + 1)
+		}
+		buf := make([]float32, 8)
+		for i := range buf {
+			buf[i] = sentinel
+		}
+		mask := FirstN_AVX2_F32x8(n)
+		MaskStore_AVX2_F32x8(mask, MaskLoad_AVX2_F32x8(mask, src), buf[:n])
+		for i, got := range buf {
+			want := float32(sentinel)
+			if i < n {
+				want = src[i]
+			}
+			if got != want {
+				t.Errorf("n=%d: buf[%d] = %v, want %v", n, i, got, want)
+			}
+		}
+	}
+}
+
+// The tail benchmarks add two exactly-sized slices shorter than a vector,
+// once with one masked iteration and once with the scalar loop it replaces.
+
+func BenchmarkMaskedTailAVX2(b *testing.B) {
+	if !hasAVX2 {
+		b.Skip("AVX2 not available")
+	}
+	for _, n := range []int{1, 3, 5, 7} {
+		x, y, dst := make([]float32, n), make([]float32, n), make([]float32, n)
+		b.Run(fmt.Sprintf("masked/%d", n), func(b *testing.B) {
+			for range b.N {
+				mask := FirstN_AVX2_F32x8(n)
+				vx := MaskLoad_AVX2_F32x8(mask, x)
+				vy := MaskLoad_AVX2_F32x8(mask, y)
+				MaskStore_AVX2_F32x8(mask, vx.Add(vy), dst)
+			}
+		})
+		b.Run(fmt.Sprintf("scalar/%d", n), func(b *testing.B) {
+			for range b.N {
+				for i := range dst {
+					dst[i] = x[i] + y[i]
+				}
+			}
+		})
+	}
+}
+
+func BenchmarkMaskedTailAVX512(b *testing.B) {
+	if !hasAVX512 {
+		b.Skip("AVX-512 not available")
+	}
+	for _, n := range []int{1, 5, 9, 15} {
+		x, y, dst := make([]float32, n), make([]float32, n), make([]float32, n)
+		b.Run(fmt.Sprintf("masked/%d", n), func(b *testing.B) {
+			for range b.N {
+				mask := FirstN_AVX512_F32x16(n)
+				vx := MaskLoad_AVX512_F32x16(mask, x)
+				vy := MaskLoad_AVX512_F32x16(mask, y)
+				MaskStore_AVX512_F32x16(mask, vx.Add(vy), dst)
+			}
+		})
+		b.Run(fmt.Sprintf("scalar/%d", n), func(b *testing.B) {
+			for range b.N {
+				for i := range dst {
+					dst[i] = x[i] + y[i]
+				}
+			}
+		})
+	}
+}
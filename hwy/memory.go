@@ -26,10 +26,10 @@ import "unsafe"
 // This is useful when you want conditional updates without affecting
 // the non-selected lanes in the destination.
 func BlendedStore[T Lanes](v Vec[T], mask Mask[T], dst []T) {
-	n := min(len(dst), min(len(mask.bits), len(v.data)))
+	n := min(len(dst), min(mask.NumLanes(), v.NumLanes()))
 	for i := range n {
-		if mask.bits[i] {
-			dst[i] = v.data[i]
+		if mask.get(i) {
+			dst[i] = v.data()[i]
 		}
 		// else: dst[i] unchanged (the "blend" part)
 	}
@@ -44,8 +44,7 @@ func BlendedStore[T Lanes](v Vec[T], mask Mask[T], dst []T) {
 // - First iteration of a reduction where initial value is unused
 // - Temporary storage that will be fully written before reading
 func Undefined[T Lanes]() Vec[T] {
-	n := MaxLanes[T]()
-	return Vec[T]{data: make([]T, n)}
+	return makeVec[T](MaxLanes[T]())
 }
 
 // LoadDup128 loads a 128-bit (16 byte) block from src and duplicates it
@@ -68,7 +67,8 @@ func LoadDup128[T Lanes](src []T) Vec[T] {
 	blockLanes := 16 / elemSize // lanes per 128-bit block
 	totalLanes := MaxLanes[T]()
 
-	result := make([]T, totalLanes)
+	out := makeVec[T](totalLanes)
+	result := out.data()
 
 	// Determine how many source lanes we can load (up to one 128-bit block)
 	srcLanes := min(len(src), blockLanes)
@@ -83,7 +83,7 @@ func LoadDup128[T Lanes](src []T) Vec[T] {
 		}
 	}
 
-	return Vec[T]{data: result}
+	return out
 }
 
 // LoadInterleaved2 loads interleaved pairs and deinterleaves into two vectors.
@@ -102,8 +102,10 @@ func LoadDup128[T Lanes](src []T) Vec[T] {
 // or any paired data stored in interleaved format.
 func LoadInterleaved2[T Lanes](src []T) (Vec[T], Vec[T]) {
 	n := MaxLanes[T]()
-	a := make([]T, n)
-	b := make([]T, n)
+	out := makeVec[T](n)
+	a := out.data()
+	bVec := makeVec[T](n)
+	b := bVec.data()
 
 	srcIdx := 0
 	for i := 0; i < n && srcIdx+1 < len(src); i++ {
@@ -112,7 +114,7 @@ func LoadInterleaved2[T Lanes](src []T) (Vec[T], Vec[T]) {
 		srcIdx += 2
 	}
 
-	return Vec[T]{data: a}, Vec[T]{data: b}
+	return out, bVec
 }
 
 // LoadInterleaved3 loads interleaved triples and deinterleaves into three vectors.
@@ -132,9 +134,12 @@ func LoadInterleaved2[T Lanes](src []T) (Vec[T], Vec[T]) {
 // or any triple data stored in interleaved format.
 func LoadInterleaved3[T Lanes](src []T) (Vec[T], Vec[T], Vec[T]) {
 	n := MaxLanes[T]()
-	a := make([]T, n)
-	b := make([]T, n)
-	c := make([]T, n)
+	out := makeVec[T](n)
+	a := out.data()
+	bVec := makeVec[T](n)
+	b := bVec.data()
+	cVec := makeVec[T](n)
+	c := cVec.data()
 
 	srcIdx := 0
 	for i := 0; i < n && srcIdx+2 < len(src); i++ {
@@ -144,7 +149,7 @@ func LoadInterleaved3[T Lanes](src []T) (Vec[T], Vec[T], Vec[T]) {
 		srcIdx += 3
 	}
 
-	return Vec[T]{data: a}, Vec[T]{data: b}, Vec[T]{data: c}
+	return out, bVec, cVec
 }
 
 // LoadInterleaved4 loads interleaved quads and deinterleaves into four vectors.
@@ -165,10 +170,14 @@ func LoadInterleaved3[T Lanes](src []T) (Vec[T], Vec[T], Vec[T]) {
 // or any quad data stored in interleaved format.
 func LoadInterleaved4[T Lanes](src []T) (Vec[T], Vec[T], Vec[T], Vec[T]) {
 	n := MaxLanes[T]()
-	a := make([]T, n)
-	b := make([]T, n)
-	c := make([]T, n)
-	d := make([]T, n)
+	out := makeVec[T](n)
+	a := out.data()
+	bVec := makeVec[T](n)
+	b := bVec.data()
+	cVec := makeVec[T](n)
+	c := cVec.data()
+	dVec := makeVec[T](n)
+	d := dVec.data()
 
 	srcIdx := 0
 	for i := 0; i < n && srcIdx+3 < len(src); i++ {
@@ -179,7 +188,7 @@ func LoadInterleaved4[T Lanes](src []T) (Vec[T], Vec[T], Vec[T], Vec[T]) {
 		srcIdx += 4
 	}
 
-	return Vec[T]{data: a}, Vec[T]{data: b}, Vec[T]{data: c}, Vec[T]{data: d}
+	return out, bVec, cVec, dVec
 }
 
 // StoreInterleaved2 stores two vectors interleaved to dst.
@@ -196,12 +205,12 @@ func LoadInterleaved4[T Lanes](src []T) (Vec[T], Vec[T], Vec[T], Vec[T]) {
 //
 // This is the inverse of LoadInterleaved2.
 func StoreInterleaved2[T Lanes](a, b Vec[T], dst []T) {
-	n := min(len(b.data), len(a.data))
+	n := min(b.NumLanes(), a.NumLanes())
 
 	dstIdx := 0
 	for i := 0; i < n && dstIdx+1 < len(dst); i++ {
-		dst[dstIdx] = a.data[i]
-		dst[dstIdx+1] = b.data[i]
+		dst[dstIdx] = a.data()[i]
+		dst[dstIdx+1] = b.data()[i]
 		dstIdx += 2
 	}
 }
@@ -221,13 +230,13 @@ func StoreInterleaved2[T Lanes](a, b Vec[T], dst []T) {
 //
 // This is the inverse of LoadInterleaved3.
 func StoreInterleaved3[T Lanes](a, b, c Vec[T], dst []T) {
-	n := min(len(c.data), min(len(b.data), len(a.data)))
+	n := min(c.NumLanes(), min(b.NumLanes(), a.NumLanes()))
 
 	dstIdx := 0
 	for i := 0; i < n && dstIdx+2 < len(dst); i++ {
-		dst[dstIdx] = a.data[i]
-		dst[dstIdx+1] = b.data[i]
-		dst[dstIdx+2] = c.data[i]
+		dst[dstIdx] = a.data()[i]
+		dst[dstIdx+1] = b.data()[i]
+		dst[dstIdx+2] = c.data()[i]
 		dstIdx += 3
 	}
 }
@@ -248,14 +257,14 @@ func StoreInterleaved3[T Lanes](a, b, c Vec[T], dst []T) {
 //
 // This is the inverse of LoadInterleaved4.
 func StoreInterleaved4[T Lanes](a, b, c, d Vec[T], dst []T) {
-	n := min(len(d.data), min(len(c.data), min(len(b.data), len(a.data))))
+	n := min(d.NumLanes(), min(c.NumLanes(), min(b.NumLanes(), a.NumLanes())))
 
 	dstIdx := 0
 	for i := 0; i < n && dstIdx+3 < len(dst); i++ {
-		dst[dstIdx] = a.data[i]
-		dst[dstIdx+1] = b.data[i]
-		dst[dstIdx+2] = c.data[i]
-		dst[dstIdx+3] = d.data[i]
+		dst[dstIdx] = a.data()[i]
+		dst[dstIdx+1] = b.data()[i]
+		dst[dstIdx+2] = c.data()[i]
+		dst[dstIdx+3] = d.data()[i]
 		dstIdx += 4
 	}
 }
@@ -20,8 +20,8 @@ import (
 
 func TestBlendedStore(t *testing.T) {
 	t.Run("all true mask", func(t *testing.T) {
-		v := Vec[float32]{data: []float32{1, 2, 3, 4}}
-		mask := Mask[float32]{bits: []bool{true, true, true, true}}
+		v := vecFrom([]float32{1, 2, 3, 4})
+		mask := maskFrom[float32]([]bool{true, true, true, true})
 		dst := []float32{10, 20, 30, 40}
 
 		BlendedStore(v, mask, dst)
@@ -35,8 +35,8 @@ func TestBlendedStore(t *testing.T) {
 	})
 
 	t.Run("all false mask", func(t *testing.T) {
-		v := Vec[float32]{data: []float32{1, 2, 3, 4}}
-		mask := Mask[float32]{bits: []bool{false, false, false, false}}
+		v := vecFrom([]float32{1, 2, 3, 4})
+		mask := maskFrom[float32]([]bool{false, false, false, false})
 		dst := []float32{10, 20, 30, 40}
 
 		BlendedStore(v, mask, dst)
@@ -51,8 +51,8 @@ func TestBlendedStore(t *testing.T) {
 	})
 
 	t.Run("mixed mask", func(t *testing.T) {
-		v := Vec[float32]{data: []float32{1, 2, 3, 4}}
-		mask := Mask[float32]{bits: []bool{true, false, true, false}}
+		v := vecFrom([]float32{1, 2, 3, 4})
+		mask := maskFrom[float32]([]bool{true, false, true, false})
 		dst := []float32{10, 20, 30, 40}
 
 		BlendedStore(v, mask, dst)
@@ -66,8 +66,8 @@ func TestBlendedStore(t *testing.T) {
 	})
 
 	t.Run("int32", func(t *testing.T) {
-		v := Vec[int32]{data: []int32{100, 200, 300, 400}}
-		mask := Mask[int32]{bits: []bool{false, true, false, true}}
+		v := vecFrom([]int32{100, 200, 300, 400})
+		mask := maskFrom[int32]([]bool{false, true, false, true})
 		dst := []int32{1, 2, 3, 4}
 
 		BlendedStore(v, mask, dst)
@@ -81,8 +81,8 @@ func TestBlendedStore(t *testing.T) {
 	})
 
 	t.Run("empty dst", func(t *testing.T) {
-		v := Vec[float32]{data: []float32{1, 2, 3, 4}}
-		mask := Mask[float32]{bits: []bool{true, true, true, true}}
+		v := vecFrom([]float32{1, 2, 3, 4})
+		mask := maskFrom[float32]([]bool{true, true, true, true})
 		dst := []float32{}
 
 		// Should not panic
@@ -90,8 +90,8 @@ func TestBlendedStore(t *testing.T) {
 	})
 
 	t.Run("partial dst", func(t *testing.T) {
-		v := Vec[float32]{data: []float32{1, 2, 3, 4}}
-		mask := Mask[float32]{bits: []bool{true, true, true, true}}
+		v := vecFrom([]float32{1, 2, 3, 4})
+		mask := maskFrom[float32]([]bool{true, true, true, true})
 		dst := []float32{10, 20} // only 2 elements
 
 		BlendedStore(v, mask, dst)
@@ -163,7 +163,7 @@ func TestLoadDup128(t *testing.T) {
 		for block := 0; block < totalLanes; block += blockSize {
 			for i := 0; i < blockSize && block+i < totalLanes; i++ {
 				want := src[i]
-				got := v.data[block+i]
+				got := v.data()[block+i]
 				if got != want {
 					t.Errorf("lane %d: got %v, want %v", block+i, got, want)
 				}
@@ -186,7 +186,7 @@ func TestLoadDup128(t *testing.T) {
 		for block := 0; block < totalLanes; block += blockSize {
 			for i := 0; i < blockSize && block+i < totalLanes; i++ {
 				want := src[i]
-				got := v.data[block+i]
+				got := v.data()[block+i]
 				if got != want {
 					t.Errorf("lane %d: got %v, want %v", block+i, got, want)
 				}
@@ -204,7 +204,7 @@ func TestLoadDup128(t *testing.T) {
 		for block := 0; block < totalLanes; block += blockSize {
 			for i := 0; i < blockSize && block+i < totalLanes; i++ {
 				want := src[i]
-				got := v.data[block+i]
+				got := v.data()[block+i]
 				if got != want {
 					t.Errorf("lane %d: got %v, want %v", block+i, got, want)
 				}
@@ -222,18 +222,18 @@ func TestLoadDup128(t *testing.T) {
 
 		for block := 0; block < totalLanes; block += blockSize {
 			// First two lanes of each block should have values
-			if v.data[block] != 1 {
-				t.Errorf("lane %d: got %v, want 1", block, v.data[block])
+			if v.data()[block] != 1 {
+				t.Errorf("lane %d: got %v, want 1", block, v.data()[block])
 			}
-			if block+1 < totalLanes && v.data[block+1] != 2 {
-				t.Errorf("lane %d: got %v, want 2", block+1, v.data[block+1])
+			if block+1 < totalLanes && v.data()[block+1] != 2 {
+				t.Errorf("lane %d: got %v, want 2", block+1, v.data()[block+1])
 			}
 			// Rest should be zero
-			if block+2 < totalLanes && v.data[block+2] != 0 {
-				t.Errorf("lane %d: got %v, want 0", block+2, v.data[block+2])
+			if block+2 < totalLanes && v.data()[block+2] != 0 {
+				t.Errorf("lane %d: got %v, want 0", block+2, v.data()[block+2])
 			}
-			if block+3 < totalLanes && v.data[block+3] != 0 {
-				t.Errorf("lane %d: got %v, want 0", block+3, v.data[block+3])
+			if block+3 < totalLanes && v.data()[block+3] != 0 {
+				t.Errorf("lane %d: got %v, want 0", block+3, v.data()[block+3])
 			}
 		}
 	})
@@ -243,7 +243,7 @@ func TestLoadDup128(t *testing.T) {
 		v := LoadDup128(src)
 
 		// Should return vector of all zeros
-		for i, val := range v.data {
+		for i, val := range v.data() {
 			if val != 0 {
 				t.Errorf("lane %d: got %v, want 0", i, val)
 			}
@@ -266,11 +266,11 @@ func TestLoadInterleaved2(t *testing.T) {
 		for i := range n {
 			wantX := float32(i)
 			wantY := float32(i + 10)
-			if x.data[i] != wantX {
-				t.Errorf("x lane %d: got %v, want %v", i, x.data[i], wantX)
+			if x.data()[i] != wantX {
+				t.Errorf("x lane %d: got %v, want %v", i, x.data()[i], wantX)
 			}
-			if y.data[i] != wantY {
-				t.Errorf("y lane %d: got %v, want %v", i, y.data[i], wantY)
+			if y.data()[i] != wantY {
+				t.Errorf("y lane %d: got %v, want %v", i, y.data()[i], wantY)
 			}
 		}
 	})
@@ -282,12 +282,12 @@ func TestLoadInterleaved2(t *testing.T) {
 		wantX := []int32{1, 2, 3, 4}
 		wantY := []int32{100, 200, 300, 400}
 
-		for i := 0; i < 4 && i < len(x.data); i++ {
-			if x.data[i] != wantX[i] {
-				t.Errorf("x lane %d: got %v, want %v", i, x.data[i], wantX[i])
+		for i := 0; i < 4 && i < x.NumLanes(); i++ {
+			if x.data()[i] != wantX[i] {
+				t.Errorf("x lane %d: got %v, want %v", i, x.data()[i], wantX[i])
 			}
-			if y.data[i] != wantY[i] {
-				t.Errorf("y lane %d: got %v, want %v", i, y.data[i], wantY[i])
+			if y.data()[i] != wantY[i] {
+				t.Errorf("y lane %d: got %v, want %v", i, y.data()[i], wantY[i])
 			}
 		}
 	})
@@ -310,14 +310,14 @@ func TestLoadInterleaved3(t *testing.T) {
 			wantR := float32(i)
 			wantG := float32(i + 100)
 			wantB := float32(i + 200)
-			if r.data[i] != wantR {
-				t.Errorf("R lane %d: got %v, want %v", i, r.data[i], wantR)
+			if r.data()[i] != wantR {
+				t.Errorf("R lane %d: got %v, want %v", i, r.data()[i], wantR)
 			}
-			if g.data[i] != wantG {
-				t.Errorf("G lane %d: got %v, want %v", i, g.data[i], wantG)
+			if g.data()[i] != wantG {
+				t.Errorf("G lane %d: got %v, want %v", i, g.data()[i], wantG)
 			}
-			if b.data[i] != wantB {
-				t.Errorf("B lane %d: got %v, want %v", i, b.data[i], wantB)
+			if b.data()[i] != wantB {
+				t.Errorf("B lane %d: got %v, want %v", i, b.data()[i], wantB)
 			}
 		}
 	})
@@ -338,17 +338,17 @@ func TestLoadInterleaved4(t *testing.T) {
 		r, g, b, a := LoadInterleaved4(src)
 
 		for i := range n {
-			if r.data[i] != float32(i) {
-				t.Errorf("R lane %d: got %v, want %v", i, r.data[i], float32(i))
+			if r.data()[i] != float32(i) {
+				t.Errorf("R lane %d: got %v, want %v", i, r.data()[i], float32(i))
 			}
-			if g.data[i] != float32(i+100) {
-				t.Errorf("G lane %d: got %v, want %v", i, g.data[i], float32(i+100))
+			if g.data()[i] != float32(i+100) {
+				t.Errorf("G lane %d: got %v, want %v", i, g.data()[i], float32(i+100))
 			}
-			if b.data[i] != float32(i+200) {
-				t.Errorf("B lane %d: got %v, want %v", i, b.data[i], float32(i+200))
+			if b.data()[i] != float32(i+200) {
+				t.Errorf("B lane %d: got %v, want %v", i, b.data()[i], float32(i+200))
 			}
-			if a.data[i] != float32(i+300) {
-				t.Errorf("A lane %d: got %v, want %v", i, a.data[i], float32(i+300))
+			if a.data()[i] != float32(i+300) {
+				t.Errorf("A lane %d: got %v, want %v", i, a.data()[i], float32(i+300))
 			}
 		}
 	})
@@ -356,8 +356,8 @@ func TestLoadInterleaved4(t *testing.T) {
 
 func TestStoreInterleaved2(t *testing.T) {
 	t.Run("float32 basic", func(t *testing.T) {
-		x := Vec[float32]{data: []float32{1, 2, 3, 4}}
-		y := Vec[float32]{data: []float32{10, 20, 30, 40}}
+		x := vecFrom([]float32{1, 2, 3, 4})
+		y := vecFrom([]float32{10, 20, 30, 40})
 		dst := make([]float32, 8)
 
 		StoreInterleaved2(x, y, dst)
@@ -371,8 +371,8 @@ func TestStoreInterleaved2(t *testing.T) {
 	})
 
 	t.Run("int32", func(t *testing.T) {
-		x := Vec[int32]{data: []int32{1, 2, 3, 4}}
-		y := Vec[int32]{data: []int32{100, 200, 300, 400}}
+		x := vecFrom([]int32{1, 2, 3, 4})
+		y := vecFrom([]int32{100, 200, 300, 400})
 		dst := make([]int32, 8)
 
 		StoreInterleaved2(x, y, dst)
@@ -388,9 +388,9 @@ func TestStoreInterleaved2(t *testing.T) {
 
 func TestStoreInterleaved3(t *testing.T) {
 	t.Run("float32 RGB", func(t *testing.T) {
-		r := Vec[float32]{data: []float32{1, 2, 3, 4}}
-		g := Vec[float32]{data: []float32{10, 20, 30, 40}}
-		b := Vec[float32]{data: []float32{100, 200, 300, 400}}
+		r := vecFrom([]float32{1, 2, 3, 4})
+		g := vecFrom([]float32{10, 20, 30, 40})
+		b := vecFrom([]float32{100, 200, 300, 400})
 		dst := make([]float32, 12)
 
 		StoreInterleaved3(r, g, b, dst)
@@ -406,10 +406,10 @@ func TestStoreInterleaved3(t *testing.T) {
 
 func TestStoreInterleaved4(t *testing.T) {
 	t.Run("float32 RGBA", func(t *testing.T) {
-		r := Vec[float32]{data: []float32{1, 2, 3, 4}}
-		g := Vec[float32]{data: []float32{10, 20, 30, 40}}
-		b := Vec[float32]{data: []float32{100, 200, 300, 400}}
-		a := Vec[float32]{data: []float32{1000, 2000, 3000, 4000}}
+		r := vecFrom([]float32{1, 2, 3, 4})
+		g := vecFrom([]float32{10, 20, 30, 40})
+		b := vecFrom([]float32{100, 200, 300, 400})
+		a := vecFrom([]float32{1000, 2000, 3000, 4000})
 		dst := make([]float32, 16)
 
 		StoreInterleaved4(r, g, b, a, dst)
@@ -490,12 +490,12 @@ func TestLoadStoreInterleaved4_RoundTrip(t *testing.T) {
 // Benchmarks
 
 func BenchmarkBlendedStore(b *testing.B) {
-	v := Vec[float32]{data: make([]float32, 8)}
-	mask := Mask[float32]{bits: []bool{true, false, true, false, true, false, true, false}}
+	v := vecFrom(make([]float32, 8))
+	mask := maskFrom[float32]([]bool{true, false, true, false, true, false, true, false})
 	dst := make([]float32, 8)
 
-	for i := range v.data {
-		v.data[i] = float32(i)
+	for i := range v.data() {
+		v.data()[i] = float32(i)
 	}
 
 	for b.Loop() {
@@ -517,13 +517,13 @@ func BenchmarkLoadInterleaved2(b *testing.B) {
 
 func BenchmarkStoreInterleaved2(b *testing.B) {
 	n := 8
-	x := Vec[float32]{data: make([]float32, n)}
-	y := Vec[float32]{data: make([]float32, n)}
+	x := vecFrom(make([]float32, n))
+	y := vecFrom(make([]float32, n))
 	dst := make([]float32, n*2)
 
 	for i := range n {
-		x.data[i] = float32(i)
-		y.data[i] = float32(i + 10)
+		x.data()[i] = float32(i)
+		y.data()[i] = float32(i + 10)
 	}
 
 	for b.Loop() {
@@ -26,9 +26,10 @@ import "math"
 // For performance-critical inner loops, use [Load] instead.
 func LoadSlice[T Lanes](src []T) Vec[T] {
 	n := min(len(src), MaxLanes[T]())
-	data := make([]T, n)
+	out := makeVec[T](n)
+	data := out.data()
 	copy(data, src[:n])
-	return Vec[T]{data: data}
+	return out
 }
 
 // Load loads a full vector from a slice without bounds checking.
@@ -46,11 +47,12 @@ func LoadSlice[T Lanes](src []T) Vec[T] {
 // Use [LoadSlice] for safe loading from slices of unknown length.
 func Load[T Lanes](src []T) Vec[T] {
 	n := NumLanes[T]()
-	data := make([]T, n)
+	out := makeVec[T](n)
+	data := out.data()
 	// Use unsafe.Pointer to avoid bounds checking in inner loop
 	// The caller guarantees len(src) >= n
 	copy(data, src[:n])
-	return Vec[T]{data: data}
+	return out
 }
 
 // Load4 loads 4 consecutive vectors from a slice for 4x loop unrolling.
@@ -85,8 +87,8 @@ func Load4_Fallback_Vec[T Lanes](src []T) (Vec[T], Vec[T], Vec[T], Vec[T]) {
 // This is the safe variant that handles slices shorter than the vector width.
 // For performance-critical inner loops, use [Store] instead.
 func StoreSlice[T Lanes](v Vec[T], dst []T) {
-	n := min(len(dst), len(v.data))
-	copy(dst[:n], v.data[:n])
+	n := min(len(dst), v.NumLanes())
+	copy(dst[:n], v.data()[:n])
 }
 
 // Store stores a full vector to a slice without bounds checking.
@@ -103,8 +105,8 @@ func StoreSlice[T Lanes](v Vec[T], dst []T) {
 // WARNING: Passing a slice with len(dst) < NumLanes[T]() is undefined behavior.
 // Use [StoreSlice] for safe storing to slices of unknown length.
 func Store[T Lanes](v Vec[T], dst []T) {
-	// The caller guarantees len(dst) >= len(v.data)
-	copy(dst[:len(v.data)], v.data)
+	// The caller guarantees len(dst) >= v.NumLanes()
+	copy(dst[:v.NumLanes()], v.data())
 }
 
 // Set returns a vector with all lanes set to the given value.
@@ -112,11 +114,12 @@ func Store[T Lanes](v Vec[T], dst []T) {
 // use [Const] which accepts float32 and handles type conversion automatically.
 func Set[T Lanes](value T) Vec[T] {
 	n := MaxLanes[T]()
-	data := make([]T, n)
+	out := makeVec[T](n)
+	data := out.data()
 	for i := range data {
 		data[i] = value
 	}
-	return Vec[T]{data: data}
+	return out
 }
 
 // Const returns a vector with all lanes set to the given float32 constant.
@@ -145,19 +148,18 @@ func ConstValue[T Lanes](val float32) T {
 
 // Zero creates a vector with all lanes set to zero.
 func Zero[T Lanes]() Vec[T] {
-	n := MaxLanes[T]()
-	data := make([]T, n)
-	return Vec[T]{data: data}
+	return makeVec[T](MaxLanes[T]())
 }
 
 // Add performs element-wise addition.
 func Add[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		result[i] = addHelper(a.data[i], b.data[i])
+		result[i] = addHelper(a.data()[i], b.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 func addHelper[T Lanes](a, b T) T {
@@ -200,12 +202,13 @@ func addHelper[T Lanes](a, b T) T {
 
 // Sub performs element-wise subtraction.
 func Sub[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		result[i] = subHelper(a.data[i], b.data[i])
+		result[i] = subHelper(a.data()[i], b.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 func subHelper[T Lanes](a, b T) T {
@@ -243,12 +246,13 @@ func subHelper[T Lanes](a, b T) T {
 
 // Mul performs element-wise multiplication.
 func Mul[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		result[i] = mulHelper(a.data[i], b.data[i])
+		result[i] = mulHelper(a.data()[i], b.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 func mulHelper[T Lanes](a, b T) T {
@@ -286,50 +290,52 @@ func mulHelper[T Lanes](a, b T) T {
 
 // Div performs element-wise division.
 func Div[T Floats](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 
 	// Check type once, then use optimized loop
 	var zero T
 	switch any(zero).(type) {
 	case Float16:
 		for i := range n {
-			av := any(a.data[i]).(Float16)
-			bv := any(b.data[i]).(Float16)
+			av := any(a.data()[i]).(Float16)
+			bv := any(b.data()[i]).(Float16)
 			result[i] = any(Float32ToFloat16(av.Float32() / bv.Float32())).(T)
 		}
 	case BFloat16:
 		for i := range n {
-			av := any(a.data[i]).(BFloat16)
-			bv := any(b.data[i]).(BFloat16)
+			av := any(a.data()[i]).(BFloat16)
+			bv := any(b.data()[i]).(BFloat16)
 			result[i] = any(Float32ToBFloat16(av.Float32() / bv.Float32())).(T)
 		}
 	case float32:
 		// Direct slice access for native floats - no boxing per element
-		aData := any(a.data).([]float32)
-		bData := any(b.data).([]float32)
+		aData := any(a.data()).([]float32)
+		bData := any(b.data()).([]float32)
 		rData := any(result).([]float32)
 		for i := range n {
 			rData[i] = aData[i] / bData[i]
 		}
 	case float64:
-		aData := any(a.data).([]float64)
-		bData := any(b.data).([]float64)
+		aData := any(a.data()).([]float64)
+		bData := any(b.data()).([]float64)
 		rData := any(result).([]float64)
 		for i := range n {
 			rData[i] = aData[i] / bData[i]
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Neg negates all lanes.
 func Neg[T Lanes](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = negHelper(v.data[i])
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = negHelper(v.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 func negHelper[T Lanes](a T) T {
@@ -365,11 +371,12 @@ func negHelper[T Lanes](a T) T {
 
 // Abs computes absolute value.
 func Abs[T Lanes](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = absHelper(v.data[i])
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = absHelper(v.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 func absHelper[T Lanes](a T) T {
@@ -431,16 +438,17 @@ func absHelper[T Lanes](a T) T {
 
 // Min returns element-wise minimum.
 func Min[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		if lessHelper(a.data[i], b.data[i]) {
-			result[i] = a.data[i]
+		if lessHelper(a.data()[i], b.data()[i]) {
+			result[i] = a.data()[i]
 		} else {
-			result[i] = b.data[i]
+			result[i] = b.data()[i]
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 func lessHelper[T Lanes](a, b T) bool {
@@ -476,16 +484,17 @@ func lessHelper[T Lanes](a, b T) bool {
 
 // Max returns element-wise maximum.
 func Max[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		if greaterHelper(a.data[i], b.data[i]) {
-			result[i] = a.data[i]
+		if greaterHelper(a.data()[i], b.data()[i]) {
+			result[i] = a.data()[i]
 		} else {
-			result[i] = b.data[i]
+			result[i] = b.data()[i]
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 func greaterHelper[T Lanes](a, b T) bool {
@@ -521,9 +530,10 @@ func greaterHelper[T Lanes](a, b T) bool {
 
 // Sqrt computes square root.
 func Sqrt[T Floats](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		switch x := any(v.data[i]).(type) {
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		switch x := any(v.data()[i]).(type) {
 		case Float16:
 			result[i] = any(Float32ToFloat16(float32(math.Sqrt(float64(x.Float32()))))).(T)
 		case BFloat16:
@@ -534,15 +544,16 @@ func Sqrt[T Floats](v Vec[T]) Vec[T] {
 			result[i] = any(math.Sqrt(x)).(T)
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // RSqrt computes reciprocal square root (1/sqrt(x)).
 // This is a scalar fallback implementation.
 func RSqrt[T Floats](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		switch x := any(v.data[i]).(type) {
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		switch x := any(v.data()[i]).(type) {
 		case Float16:
 			result[i] = any(Float32ToFloat16(float32(1.0 / math.Sqrt(float64(x.Float32()))))).(T)
 		case BFloat16:
@@ -553,7 +564,7 @@ func RSqrt[T Floats](v Vec[T]) Vec[T] {
 			result[i] = any(1.0 / math.Sqrt(x)).(T)
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // RSqrtNewtonRaphson computes 1/sqrt(x) with one Newton-Raphson refinement.
@@ -574,73 +585,75 @@ func InvSqrt[T Floats](v Vec[T]) Vec[T] { return RSqrt(v) }
 
 // Pow computes base^exp element-wise.
 func Pow[T Floats](base, exp Vec[T]) Vec[T] {
-	n := min(len(exp.data), len(base.data))
-	result := make([]T, n)
+	n := min(exp.NumLanes(), base.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		switch b := any(base.data[i]).(type) {
+		switch b := any(base.data()[i]).(type) {
 		case Float16:
-			e := any(exp.data[i]).(Float16)
+			e := any(exp.data()[i]).(Float16)
 			result[i] = any(Float32ToFloat16(float32(math.Pow(float64(b.Float32()), float64(e.Float32()))))).(T)
 		case BFloat16:
-			e := any(exp.data[i]).(BFloat16)
+			e := any(exp.data()[i]).(BFloat16)
 			result[i] = any(Float32ToBFloat16(float32(math.Pow(float64(b.Float32()), float64(e.Float32()))))).(T)
 		case float32:
-			e := any(exp.data[i]).(float32)
+			e := any(exp.data()[i]).(float32)
 			result[i] = any(float32(math.Pow(float64(b), float64(e)))).(T)
 		case float64:
-			e := any(exp.data[i]).(float64)
+			e := any(exp.data()[i]).(float64)
 			result[i] = any(math.Pow(b, e)).(T)
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // FMA performs fused multiply-add.
 func FMA[T Floats](a, b, c Vec[T]) Vec[T] {
-	n := min(len(c.data), min(len(b.data), len(a.data)))
-	result := make([]T, n)
+	n := min(c.NumLanes(), min(b.NumLanes(), a.NumLanes()))
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		switch av := any(a.data[i]).(type) {
+		switch av := any(a.data()[i]).(type) {
 		case Float16:
-			bv := any(b.data[i]).(Float16)
-			cv := any(c.data[i]).(Float16)
+			bv := any(b.data()[i]).(Float16)
+			cv := any(c.data()[i]).(Float16)
 			result[i] = any(Float32ToFloat16(float32(math.FMA(float64(av.Float32()), float64(bv.Float32()), float64(cv.Float32()))))).(T)
 		case BFloat16:
-			bv := any(b.data[i]).(BFloat16)
-			cv := any(c.data[i]).(BFloat16)
+			bv := any(b.data()[i]).(BFloat16)
+			cv := any(c.data()[i]).(BFloat16)
 			result[i] = any(Float32ToBFloat16(float32(math.FMA(float64(av.Float32()), float64(bv.Float32()), float64(cv.Float32()))))).(T)
 		case float32:
-			bv := any(b.data[i]).(float32)
-			cv := any(c.data[i]).(float32)
+			bv := any(b.data()[i]).(float32)
+			cv := any(c.data()[i]).(float32)
 			result[i] = any(float32(math.FMA(float64(av), float64(bv), float64(cv)))).(T)
 		case float64:
-			bv := any(b.data[i]).(float64)
-			cv := any(c.data[i]).(float64)
+			bv := any(b.data()[i]).(float64)
+			cv := any(c.data()[i]).(float64)
 			result[i] = any(math.FMA(av, bv, cv)).(T)
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // ReduceSum sums all lanes.
 func ReduceSum[T Lanes](v Vec[T]) T {
 	var sum T
-	for i := 0; i < len(v.data); i++ {
-		sum += v.data[i]
+	for i := 0; i < v.NumLanes(); i++ {
+		sum += v.data()[i]
 	}
 	return sum
 }
 
 // ReduceMin returns the minimum value across all lanes.
 func ReduceMin[T Lanes](v Vec[T]) T {
-	if len(v.data) == 0 {
+	if v.NumLanes() == 0 {
 		var zero T
 		return zero
 	}
-	min := v.data[0]
-	for i := 1; i < len(v.data); i++ {
-		if v.data[i] < min {
-			min = v.data[i]
+	min := v.data()[0]
+	for i := 1; i < v.NumLanes(); i++ {
+		if v.data()[i] < min {
+			min = v.data()[i]
 		}
 	}
 	return min
@@ -648,14 +661,14 @@ func ReduceMin[T Lanes](v Vec[T]) T {
 
 // ReduceMax returns the maximum value across all lanes.
 func ReduceMax[T Lanes](v Vec[T]) T {
-	if len(v.data) == 0 {
+	if v.NumLanes() == 0 {
 		var zero T
 		return zero
 	}
-	max := v.data[0]
-	for i := 1; i < len(v.data); i++ {
-		if v.data[i] > max {
-			max = v.data[i]
+	max := v.data()[0]
+	for i := 1; i < v.NumLanes(); i++ {
+		if v.data()[i] > max {
+			max = v.data()[i]
 		}
 	}
 	return max
@@ -663,107 +676,107 @@ func ReduceMax[T Lanes](v Vec[T]) T {
 
 // Equal performs element-wise equality comparison.
 func Equal[T Lanes](a, b Vec[T]) Mask[T] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[T](n)
 	for i := range n {
-		bits[i] = a.data[i] == b.data[i]
+		bits.set(i, a.data()[i] == b.data()[i])
 	}
-	return Mask[T]{bits: bits}
+	return bits
 }
 
 // NotEqual performs element-wise inequality comparison.
 func NotEqual[T Lanes](a, b Vec[T]) Mask[T] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[T](n)
 	for i := range n {
-		bits[i] = a.data[i] != b.data[i]
+		bits.set(i, a.data()[i] != b.data()[i])
 	}
-	return Mask[T]{bits: bits}
+	return bits
 }
 
 // LessThan performs element-wise less-than comparison.
 func LessThan[T Lanes](a, b Vec[T]) Mask[T] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[T](n)
 	for i := range n {
-		bits[i] = a.data[i] < b.data[i]
+		bits.set(i, a.data()[i] < b.data()[i])
 	}
-	return Mask[T]{bits: bits}
+	return bits
 }
 
 // GreaterThan performs element-wise greater-than comparison.
 func GreaterThan[T Lanes](a, b Vec[T]) Mask[T] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[T](n)
 	for i := range n {
-		bits[i] = a.data[i] > b.data[i]
+		bits.set(i, a.data()[i] > b.data()[i])
 	}
-	return Mask[T]{bits: bits}
+	return bits
 }
 
 // LessEqual performs element-wise less-than-or-equal comparison.
 func LessEqual[T Lanes](a, b Vec[T]) Mask[T] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[T](n)
 	for i := range n {
-		bits[i] = a.data[i] <= b.data[i]
+		bits.set(i, a.data()[i] <= b.data()[i])
 	}
-	return Mask[T]{bits: bits}
+	return bits
 }
 
 // GreaterEqual performs element-wise greater-than-or-equal comparison.
 func GreaterEqual[T Lanes](a, b Vec[T]) Mask[T] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[T](n)
 	for i := range n {
-		bits[i] = a.data[i] >= b.data[i]
+		bits.set(i, a.data()[i] >= b.data()[i])
 	}
-	return Mask[T]{bits: bits}
+	return bits
 }
 
 // IsNaN returns a mask indicating which lanes contain NaN values.
 // For integer types, this always returns all false.
 func IsNaN[T Floats](v Vec[T]) Mask[T] {
-	bits := make([]bool, len(v.data))
-	for i, val := range v.data {
+	bits := makeMask[T](v.NumLanes())
+	for i, val := range v.data() {
 		switch x := any(val).(type) {
 		case Float16:
-			bits[i] = math.IsNaN(float64(x.Float32()))
+			bits.set(i, math.IsNaN(float64(x.Float32())))
 		case BFloat16:
-			bits[i] = math.IsNaN(float64(x.Float32()))
+			bits.set(i, math.IsNaN(float64(x.Float32())))
 		case float32:
-			bits[i] = math.IsNaN(float64(x))
+			bits.set(i, math.IsNaN(float64(x)))
 		case float64:
-			bits[i] = math.IsNaN(x)
+			bits.set(i, math.IsNaN(x))
 		}
 	}
-	return Mask[T]{bits: bits}
+	return bits
 }
 
 // IsInf returns a mask indicating which lanes contain infinity.
 // The sign parameter: 0 = either, > 0 = +Inf only, < 0 = -Inf only.
 func IsInf[T Floats](v Vec[T], sign int) Mask[T] {
-	bits := make([]bool, len(v.data))
-	for i, val := range v.data {
+	bits := makeMask[T](v.NumLanes())
+	for i, val := range v.data() {
 		switch x := any(val).(type) {
 		case Float16:
-			bits[i] = math.IsInf(float64(x.Float32()), sign)
+			bits.set(i, math.IsInf(float64(x.Float32()), sign))
 		case BFloat16:
-			bits[i] = math.IsInf(float64(x.Float32()), sign)
+			bits.set(i, math.IsInf(float64(x.Float32()), sign))
 		case float32:
-			bits[i] = math.IsInf(float64(x), sign)
+			bits.set(i, math.IsInf(float64(x), sign))
 		case float64:
-			bits[i] = math.IsInf(x, sign)
+			bits.set(i, math.IsInf(x, sign))
 		}
 	}
-	return Mask[T]{bits: bits}
+	return bits
 }
 
 // IsFinite returns a mask indicating which lanes contain finite values.
 // A value is finite if it is neither NaN nor infinity.
 func IsFinite[T Floats](v Vec[T]) Mask[T] {
-	bits := make([]bool, len(v.data))
-	for i, val := range v.data {
+	bits := makeMask[T](v.NumLanes())
+	for i, val := range v.data() {
 		var f float64
 		switch x := any(val).(type) {
 		case Float16:
@@ -775,19 +788,19 @@ func IsFinite[T Floats](v Vec[T]) Mask[T] {
 		case float64:
 			f = x
 		}
-		bits[i] = !math.IsNaN(f) && !math.IsInf(f, 0)
+		bits.set(i, !math.IsNaN(f) && !math.IsInf(f, 0))
 	}
-	return Mask[T]{bits: bits}
+	return bits
 }
 
 // TestBit returns a mask indicating which lanes have the specified bit set.
 // Bit 0 is the least significant bit.
 func TestBit[T Integers](v Vec[T], bit int) Mask[T] {
-	bits := make([]bool, len(v.data))
-	for i, val := range v.data {
-		bits[i] = testBitHelper(val, bit)
+	bits := makeMask[T](v.NumLanes())
+	for i, val := range v.data() {
+		bits.set(i, testBitHelper(val, bit))
 	}
-	return Mask[T]{bits: bits}
+	return bits
 }
 
 func testBitHelper[T Integers](val T, bit int) bool {
@@ -815,161 +828,174 @@ func testBitHelper[T Integers](val T, bit int) bool {
 
 // IfThenElse performs conditional selection.
 func IfThenElse[T Lanes](mask Mask[T], a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), min(len(a.data), len(mask.bits)))
-	result := make([]T, n)
+	n := min(b.NumLanes(), min(a.NumLanes(), mask.NumLanes()))
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		if mask.bits[i] {
-			result[i] = a.data[i]
+		if mask.get(i) {
+			result[i] = a.data()[i]
 		} else {
-			result[i] = b.data[i]
+			result[i] = b.data()[i]
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // IfThenElseZero returns a where mask is true, zero otherwise.
 // Equivalent to IfThenElse(mask, a, Zero()) but more efficient.
 func IfThenElseZero[T Lanes](mask Mask[T], a Vec[T]) Vec[T] {
-	n := min(len(a.data), len(mask.bits))
-	result := make([]T, n)
+	n := min(a.NumLanes(), mask.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		if mask.bits[i] {
-			result[i] = a.data[i]
+		if mask.get(i) {
+			result[i] = a.data()[i]
 		}
 		// else: leave as zero value
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // IfThenZeroElse returns zero where mask is true, b otherwise.
 // Equivalent to IfThenElse(mask, Zero(), b) but more efficient.
 func IfThenZeroElse[T Lanes](mask Mask[T], b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(mask.bits))
-	result := make([]T, n)
+	n := min(b.NumLanes(), mask.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		if !mask.bits[i] {
-			result[i] = b.data[i]
+		if !mask.get(i) {
+			result[i] = b.data()[i]
 		}
 		// else: leave as zero value
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // ZeroIfNegative returns zero for negative lanes, original value otherwise.
 // Useful for clamping negative values to zero.
 func ZeroIfNegative[T Lanes](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i, val := range v.data {
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i, val := range v.data() {
 		if val >= 0 {
 			result[i] = val
 		}
 		// else: leave as zero value
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // MaskLoad loads data from a slice only for lanes where the mask is true.
 func MaskLoad[T Lanes](mask Mask[T], src []T) Vec[T] {
-	n := min(len(src), len(mask.bits))
-	result := make([]T, len(mask.bits))
+	n := min(len(src), mask.NumLanes())
+	out := makeVec[T](mask.NumLanes())
+	result := out.data()
 	for i := range n {
-		if mask.bits[i] {
+		if mask.get(i) {
 			result[i] = src[i]
 		}
 		// else: leave as zero value
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // MaskStore stores vector data to a slice only for lanes where the mask is true.
 func MaskStore[T Lanes](mask Mask[T], v Vec[T], dst []T) {
-	n := min(len(dst), min(len(v.data), len(mask.bits)))
+	n := min(len(dst), min(v.NumLanes(), mask.NumLanes()))
 	for i := range n {
-		if mask.bits[i] {
-			dst[i] = v.data[i]
+		if mask.get(i) {
+			dst[i] = v.data()[i]
 		}
 	}
 }
 
 // And performs element-wise bitwise AND.
 func And[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
 		// Perform bitwise AND by reinterpreting as integers
-		result[i] = bitwiseAnd(a.data[i], b.data[i])
+		result[i] = bitwiseAnd(a.data()[i], b.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Or performs element-wise bitwise OR.
 func Or[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		result[i] = bitwiseOr(a.data[i], b.data[i])
+		result[i] = bitwiseOr(a.data()[i], b.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Xor performs element-wise bitwise XOR.
 func Xor[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		result[i] = bitwiseXor(a.data[i], b.data[i])
+		result[i] = bitwiseXor(a.data()[i], b.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Not performs element-wise bitwise NOT (ones complement).
 func Not[T Lanes](v Vec[T]) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = bitwiseNot(v.data[i])
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = bitwiseNot(v.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // AndNot performs element-wise bitwise AND NOT (~a & b).
 func AndNot[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		result[i] = bitwiseAndNot(a.data[i], b.data[i])
+		result[i] = bitwiseAndNot(a.data()[i], b.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // ShiftLeft performs element-wise left shift by a constant number of bits.
 // Only valid for integer types.
 func ShiftLeft[T Integers](v Vec[T], bits int) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = shiftLeft(v.data[i], bits)
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = shiftLeft(v.data()[i], bits)
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // ShiftRight performs element-wise right shift by a constant number of bits.
 // For signed integers, this is arithmetic shift (sign-extended).
 // For unsigned integers, this is logical shift (zero-filled).
 func ShiftRight[T Integers](v Vec[T], bits int) Vec[T] {
-	result := make([]T, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		result[i] = shiftRight(v.data[i], bits)
+	out := makeVec[T](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		result[i] = shiftRight(v.data()[i], bits)
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Iota returns a vector with lanes set to [0, 1, 2, 3, ...].
 func Iota[T Lanes]() Vec[T] {
 	n := MaxLanes[T]()
-	data := make([]T, n)
+	out := makeVec[T](n)
+	data := out.data()
 	for i := range data {
 		data[i] = T(i)
 	}
-	return Vec[T]{data: data}
+	return out
 }
 
 // SignBit returns a vector with the sign bit set in each lane.
@@ -977,12 +1003,13 @@ func Iota[T Lanes]() Vec[T] {
 // For unsigned integers, this is the high bit set.
 func SignBit[T Lanes]() Vec[T] {
 	n := MaxLanes[T]()
-	data := make([]T, n)
+	out := makeVec[T](n)
+	data := out.data()
 	signBit := getSignBit[T]()
 	for i := range data {
 		data[i] = signBit
 	}
-	return Vec[T]{data: data}
+	return out
 }
 
 // Helper functions for bitwise operations that work with any numeric type
@@ -1232,38 +1259,39 @@ func MulAdd[T Floats](a, b, c Vec[T]) Vec[T] {
 // RoundToEven rounds to the nearest even integer (banker's rounding).
 // This is the default IEEE 754 rounding mode.
 func RoundToEven[T Floats](v Vec[T]) Vec[T] {
-	n := len(v.data)
-	result := make([]T, n)
+	n := v.NumLanes()
+	out := makeVec[T](n)
+	result := out.data()
 
 	// Check type once, then use optimized loop
 	var zero T
 	switch any(zero).(type) {
 	case Float16:
-		vData := any(v.data).([]Float16)
+		vData := any(v.data()).([]Float16)
 		rData := any(result).([]Float16)
 		for i := range n {
 			rData[i] = Float32ToFloat16(float32(math.RoundToEven(float64(vData[i].Float32()))))
 		}
 	case BFloat16:
-		vData := any(v.data).([]BFloat16)
+		vData := any(v.data()).([]BFloat16)
 		rData := any(result).([]BFloat16)
 		for i := range n {
 			rData[i] = Float32ToBFloat16(float32(math.RoundToEven(float64(vData[i].Float32()))))
 		}
 	case float32:
-		vData := any(v.data).([]float32)
+		vData := any(v.data()).([]float32)
 		rData := any(result).([]float32)
 		for i := range n {
 			rData[i] = float32(math.RoundToEven(float64(vData[i])))
 		}
 	case float64:
-		vData := any(v.data).([]float64)
+		vData := any(v.data()).([]float64)
 		rData := any(result).([]float64)
 		for i := range n {
 			rData[i] = math.RoundToEven(vData[i])
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Greater performs element-wise greater-than comparison.
@@ -1290,36 +1318,40 @@ func Merge[T Lanes](a, b Vec[T], mask Mask[T]) Vec[T] {
 
 // AsInt32 reinterprets a float32 vector as int32 (bit cast).
 func AsInt32(v Vec[float32]) Vec[int32] {
-	result := make([]int32, len(v.data))
-	for i, x := range v.data {
+	out := makeVec[int32](v.NumLanes())
+	result := out.data()
+	for i, x := range v.data() {
 		result[i] = int32(math.Float32bits(x))
 	}
-	return Vec[int32]{data: result}
+	return out
 }
 
 // AsFloat32 reinterprets an int32 vector as float32 (bit cast).
 func AsFloat32(v Vec[int32]) Vec[float32] {
-	result := make([]float32, len(v.data))
-	for i, x := range v.data {
+	out := makeVec[float32](v.NumLanes())
+	result := out.data()
+	for i, x := range v.data() {
 		result[i] = math.Float32frombits(uint32(x))
 	}
-	return Vec[float32]{data: result}
+	return out
 }
 
 // AsInt64 reinterprets a float64 vector as int64 (bit cast).
 func AsInt64(v Vec[float64]) Vec[int64] {
-	result := make([]int64, len(v.data))
-	for i, x := range v.data {
+	out := makeVec[int64](v.NumLanes())
+	result := out.data()
+	for i, x := range v.data() {
 		result[i] = int64(math.Float64bits(x))
 	}
-	return Vec[int64]{data: result}
+	return out
 }
 
 // AsFloat64 reinterprets an int64 vector as float64 (bit cast).
 func AsFloat64(v Vec[int64]) Vec[float64] {
-	result := make([]float64, len(v.data))
-	for i, x := range v.data {
+	out := makeVec[float64](v.NumLanes())
+	result := out.data()
+	for i, x := range v.data() {
 		result[i] = math.Float64frombits(uint64(x))
 	}
-	return Vec[float64]{data: result}
+	return out
 }
@@ -27,168 +27,180 @@ import "math"
 
 // AddBF16 performs element-wise addition of two BFloat16 vectors.
 func AddBF16(a, b Vec[BFloat16]) Vec[BFloat16] {
-	n := min(len(b.data), len(a.data))
-	result := make([]BFloat16, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[BFloat16](n)
+	result := out.data()
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
 		result[i] = Float32ToBFloat16(af + bf)
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // SubBF16 performs element-wise subtraction of two BFloat16 vectors.
 func SubBF16(a, b Vec[BFloat16]) Vec[BFloat16] {
-	n := min(len(b.data), len(a.data))
-	result := make([]BFloat16, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[BFloat16](n)
+	result := out.data()
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
 		result[i] = Float32ToBFloat16(af - bf)
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // MulBF16 performs element-wise multiplication of two BFloat16 vectors.
 func MulBF16(a, b Vec[BFloat16]) Vec[BFloat16] {
-	n := min(len(b.data), len(a.data))
-	result := make([]BFloat16, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[BFloat16](n)
+	result := out.data()
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
 		result[i] = Float32ToBFloat16(af * bf)
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // DivBF16 performs element-wise division of two BFloat16 vectors.
 func DivBF16(a, b Vec[BFloat16]) Vec[BFloat16] {
-	n := min(len(b.data), len(a.data))
-	result := make([]BFloat16, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[BFloat16](n)
+	result := out.data()
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
 		result[i] = Float32ToBFloat16(af / bf)
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // FMABF16 performs fused multiply-add: a * b + c.
 func FMABF16(a, b, c Vec[BFloat16]) Vec[BFloat16] {
-	n := min(len(c.data), min(len(b.data), len(a.data)))
-	result := make([]BFloat16, n)
+	n := min(c.NumLanes(), min(b.NumLanes(), a.NumLanes()))
+	out := makeVec[BFloat16](n)
+	result := out.data()
 	for i := range n {
-		af := float64(BFloat16ToFloat32(a.data[i]))
-		bf := float64(BFloat16ToFloat32(b.data[i]))
-		cf := float64(BFloat16ToFloat32(c.data[i]))
+		af := float64(BFloat16ToFloat32(a.data()[i]))
+		bf := float64(BFloat16ToFloat32(b.data()[i]))
+		cf := float64(BFloat16ToFloat32(c.data()[i]))
 		result[i] = Float32ToBFloat16(float32(math.FMA(af, bf, cf)))
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // NegBF16 negates all lanes.
 func NegBF16(v Vec[BFloat16]) Vec[BFloat16] {
-	result := make([]BFloat16, len(v.data))
-	for i := 0; i < len(v.data); i++ {
+	out := makeVec[BFloat16](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
 		// Negation is just flipping the sign bit
-		result[i] = v.data[i] ^ 0x8000
+		result[i] = v.data()[i] ^ 0x8000
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // AbsBF16 computes absolute value.
 func AbsBF16(v Vec[BFloat16]) Vec[BFloat16] {
-	result := make([]BFloat16, len(v.data))
-	for i := 0; i < len(v.data); i++ {
+	out := makeVec[BFloat16](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
 		// Absolute value is just clearing the sign bit
-		result[i] = v.data[i] & 0x7FFF
+		result[i] = v.data()[i] & 0x7FFF
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // MinBF16 returns element-wise minimum.
 func MinBF16(a, b Vec[BFloat16]) Vec[BFloat16] {
-	n := min(len(b.data), len(a.data))
-	result := make([]BFloat16, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[BFloat16](n)
+	result := out.data()
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
 		if af < bf {
-			result[i] = a.data[i]
+			result[i] = a.data()[i]
 		} else {
-			result[i] = b.data[i]
+			result[i] = b.data()[i]
 		}
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // MaxBF16 returns element-wise maximum.
 func MaxBF16(a, b Vec[BFloat16]) Vec[BFloat16] {
-	n := min(len(b.data), len(a.data))
-	result := make([]BFloat16, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[BFloat16](n)
+	result := out.data()
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
 		if af > bf {
-			result[i] = a.data[i]
+			result[i] = a.data()[i]
 		} else {
-			result[i] = b.data[i]
+			result[i] = b.data()[i]
 		}
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // SqrtBF16 computes square root.
 func SqrtBF16(v Vec[BFloat16]) Vec[BFloat16] {
-	result := make([]BFloat16, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		f := float64(BFloat16ToFloat32(v.data[i]))
+	out := makeVec[BFloat16](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		f := float64(BFloat16ToFloat32(v.data()[i]))
 		result[i] = Float32ToBFloat16(float32(math.Sqrt(f)))
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // ReciprocalBF16 computes 1/x (reciprocal).
 func ReciprocalBF16(v Vec[BFloat16]) Vec[BFloat16] {
-	result := make([]BFloat16, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		f := BFloat16ToFloat32(v.data[i])
+	out := makeVec[BFloat16](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		f := BFloat16ToFloat32(v.data()[i])
 		result[i] = Float32ToBFloat16(1.0 / f)
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // ReciprocalSqrtBF16 computes 1/sqrt(x).
 func ReciprocalSqrtBF16(v Vec[BFloat16]) Vec[BFloat16] {
-	result := make([]BFloat16, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		f := float64(BFloat16ToFloat32(v.data[i]))
+	out := makeVec[BFloat16](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		f := float64(BFloat16ToFloat32(v.data()[i]))
 		result[i] = Float32ToBFloat16(float32(1.0 / math.Sqrt(f)))
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // ReduceSumBF16 sums all lanes and returns the result as float32.
 // Accumulation is done in float32 to avoid precision loss.
 func ReduceSumBF16(v Vec[BFloat16]) float32 {
 	var sum float32
-	for i := 0; i < len(v.data); i++ {
-		sum += BFloat16ToFloat32(v.data[i])
+	for i := 0; i < v.NumLanes(); i++ {
+		sum += BFloat16ToFloat32(v.data()[i])
 	}
 	return sum
 }
 
 // ReduceMinBF16 returns the minimum value across all lanes.
 func ReduceMinBF16(v Vec[BFloat16]) BFloat16 {
-	if len(v.data) == 0 {
+	if v.NumLanes() == 0 {
 		return BFloat16Inf
 	}
-	min := v.data[0]
+	min := v.data()[0]
 	minF := BFloat16ToFloat32(min)
-	for i := 1; i < len(v.data); i++ {
-		f := BFloat16ToFloat32(v.data[i])
+	for i := 1; i < v.NumLanes(); i++ {
+		f := BFloat16ToFloat32(v.data()[i])
 		if f < minF {
-			min = v.data[i]
+			min = v.data()[i]
 			minF = f
 		}
 	}
@@ -197,15 +209,15 @@ func ReduceMinBF16(v Vec[BFloat16]) BFloat16 {
 
 // ReduceMaxBF16 returns the maximum value across all lanes.
 func ReduceMaxBF16(v Vec[BFloat16]) BFloat16 {
-	if len(v.data) == 0 {
+	if v.NumLanes() == 0 {
 		return BFloat16NegInf
 	}
-	max := v.data[0]
+	max := v.data()[0]
 	maxF := BFloat16ToFloat32(max)
-	for i := 1; i < len(v.data); i++ {
-		f := BFloat16ToFloat32(v.data[i])
+	for i := 1; i < v.NumLanes(); i++ {
+		f := BFloat16ToFloat32(v.data()[i])
 		if f > maxF {
-			max = v.data[i]
+			max = v.data()[i]
 			maxF = f
 		}
 	}
@@ -216,11 +228,11 @@ func ReduceMaxBF16(v Vec[BFloat16]) BFloat16 {
 // This is the common ML pattern: accumulate in higher precision.
 // On hardware with VDPBF16PS (AVX-512 BF16), this uses dedicated instruction.
 func DotBF16(a, b Vec[BFloat16]) float32 {
-	n := min(len(b.data), len(a.data))
+	n := min(b.NumLanes(), a.NumLanes())
 	var sum float32
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
 		sum += af * bf
 	}
 	return sum
@@ -228,128 +240,129 @@ func DotBF16(a, b Vec[BFloat16]) float32 {
 
 // NotEqualBF16 compares two BFloat16 vectors for inequality.
 func NotEqualBF16(a, b Vec[BFloat16]) Mask[BFloat16] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[BFloat16](n)
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
-		bits[i] = af != bf
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
+		bits.set(i, af != bf)
 	}
-	return Mask[BFloat16]{bits: bits}
+	return bits
 }
 
 // EqualBF16 compares two BFloat16 vectors for equality.
 func EqualBF16(a, b Vec[BFloat16]) Mask[BFloat16] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[BFloat16](n)
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
-		bits[i] = af == bf
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
+		bits.set(i, af == bf)
 	}
-	return Mask[BFloat16]{bits: bits}
+	return bits
 }
 
 // LessThanBF16 compares a < b element-wise.
 func LessThanBF16(a, b Vec[BFloat16]) Mask[BFloat16] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[BFloat16](n)
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
-		bits[i] = af < bf
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
+		bits.set(i, af < bf)
 	}
-	return Mask[BFloat16]{bits: bits}
+	return bits
 }
 
 // LessThanOrEqualBF16 compares a <= b element-wise.
 func LessThanOrEqualBF16(a, b Vec[BFloat16]) Mask[BFloat16] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[BFloat16](n)
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
-		bits[i] = af <= bf
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
+		bits.set(i, af <= bf)
 	}
-	return Mask[BFloat16]{bits: bits}
+	return bits
 }
 
 // GreaterThanBF16 compares a > b element-wise.
 func GreaterThanBF16(a, b Vec[BFloat16]) Mask[BFloat16] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[BFloat16](n)
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
-		bits[i] = af > bf
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
+		bits.set(i, af > bf)
 	}
-	return Mask[BFloat16]{bits: bits}
+	return bits
 }
 
 // GreaterThanOrEqualBF16 compares a >= b element-wise.
 func GreaterThanOrEqualBF16(a, b Vec[BFloat16]) Mask[BFloat16] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[BFloat16](n)
 	for i := range n {
-		af := BFloat16ToFloat32(a.data[i])
-		bf := BFloat16ToFloat32(b.data[i])
-		bits[i] = af >= bf
+		af := BFloat16ToFloat32(a.data()[i])
+		bf := BFloat16ToFloat32(b.data()[i])
+		bits.set(i, af >= bf)
 	}
-	return Mask[BFloat16]{bits: bits}
+	return bits
 }
 
 // IsNaNBF16 returns a mask where true indicates NaN.
 func IsNaNBF16(v Vec[BFloat16]) Mask[BFloat16] {
-	bits := make([]bool, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		bits[i] = v.data[i].IsNaN()
+	bits := makeMask[BFloat16](v.NumLanes())
+	for i := 0; i < v.NumLanes(); i++ {
+		bits.set(i, v.data()[i].IsNaN())
 	}
-	return Mask[BFloat16]{bits: bits}
+	return bits
 }
 
 // IsInfBF16 returns a mask where true indicates infinity.
 func IsInfBF16(v Vec[BFloat16], sign int) Mask[BFloat16] {
-	bits := make([]bool, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		if !v.data[i].IsInf() {
-			bits[i] = false
+	bits := makeMask[BFloat16](v.NumLanes())
+	for i := 0; i < v.NumLanes(); i++ {
+		if !v.data()[i].IsInf() {
+			bits.set(i, false)
 			continue
 		}
 		switch sign {
 		case 0:
-			bits[i] = true
+			bits.set(i, true)
 		case 1:
-			bits[i] = !v.data[i].IsNegative()
+			bits.set(i, !v.data()[i].IsNegative())
 		case -1:
-			bits[i] = v.data[i].IsNegative()
+			bits.set(i, v.data()[i].IsNegative())
 		default:
-			bits[i] = true
+			bits.set(i, true)
 		}
 	}
-	return Mask[BFloat16]{bits: bits}
+	return bits
 }
 
 // IsFiniteBF16 returns a mask where true indicates finite (not NaN or Inf).
 func IsFiniteBF16(v Vec[BFloat16]) Mask[BFloat16] {
-	bits := make([]bool, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		bits[i] = !v.data[i].IsNaN() && !v.data[i].IsInf()
+	bits := makeMask[BFloat16](v.NumLanes())
+	for i := 0; i < v.NumLanes(); i++ {
+		bits.set(i, !v.data()[i].IsNaN() && !v.data()[i].IsInf())
 	}
-	return Mask[BFloat16]{bits: bits}
+	return bits
 }
 
 // IfThenElseBF16 selects elements based on mask: mask ? yes : no.
 func IfThenElseBF16(mask Mask[BFloat16], yes, no Vec[BFloat16]) Vec[BFloat16] {
-	n := min(len(no.data), min(len(yes.data), len(mask.bits)))
-	result := make([]BFloat16, n)
+	n := min(no.NumLanes(), min(yes.NumLanes(), mask.NumLanes()))
+	out := makeVec[BFloat16](n)
+	result := out.data()
 	for i := range n {
-		if mask.bits[i] {
-			result[i] = yes.data[i]
+		if mask.get(i) {
+			result[i] = yes.data()[i]
 		} else {
-			result[i] = no.data[i]
+			result[i] = no.data()[i]
 		}
 	}
-	return Vec[BFloat16]{data: result}
+	return out
 }
 
 // ClampBF16 clamps values to [lo, hi] range.
@@ -27,169 +27,181 @@ import "math"
 
 // AddF16 performs element-wise addition of two Float16 vectors.
 func AddF16(a, b Vec[Float16]) Vec[Float16] {
-	n := min(len(b.data), len(a.data))
-	result := make([]Float16, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[Float16](n)
+	result := out.data()
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
 		result[i] = Float32ToFloat16(af + bf)
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // SubF16 performs element-wise subtraction of two Float16 vectors.
 func SubF16(a, b Vec[Float16]) Vec[Float16] {
-	n := min(len(b.data), len(a.data))
-	result := make([]Float16, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[Float16](n)
+	result := out.data()
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
 		result[i] = Float32ToFloat16(af - bf)
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // MulF16 performs element-wise multiplication of two Float16 vectors.
 func MulF16(a, b Vec[Float16]) Vec[Float16] {
-	n := min(len(b.data), len(a.data))
-	result := make([]Float16, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[Float16](n)
+	result := out.data()
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
 		result[i] = Float32ToFloat16(af * bf)
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // DivF16 performs element-wise division of two Float16 vectors.
 func DivF16(a, b Vec[Float16]) Vec[Float16] {
-	n := min(len(b.data), len(a.data))
-	result := make([]Float16, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[Float16](n)
+	result := out.data()
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
 		result[i] = Float32ToFloat16(af / bf)
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // FMAF16 performs fused multiply-add: a * b + c.
 // Using FMA in float32 preserves precision better than separate mul and add.
 func FMAF16(a, b, c Vec[Float16]) Vec[Float16] {
-	n := min(len(c.data), min(len(b.data), len(a.data)))
-	result := make([]Float16, n)
+	n := min(c.NumLanes(), min(b.NumLanes(), a.NumLanes()))
+	out := makeVec[Float16](n)
+	result := out.data()
 	for i := range n {
-		af := float64(Float16ToFloat32(a.data[i]))
-		bf := float64(Float16ToFloat32(b.data[i]))
-		cf := float64(Float16ToFloat32(c.data[i]))
+		af := float64(Float16ToFloat32(a.data()[i]))
+		bf := float64(Float16ToFloat32(b.data()[i]))
+		cf := float64(Float16ToFloat32(c.data()[i]))
 		result[i] = Float32ToFloat16(float32(math.FMA(af, bf, cf)))
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // NegF16 negates all lanes.
 func NegF16(v Vec[Float16]) Vec[Float16] {
-	result := make([]Float16, len(v.data))
-	for i := 0; i < len(v.data); i++ {
+	out := makeVec[Float16](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
 		// Negation is just flipping the sign bit
-		result[i] = v.data[i] ^ 0x8000
+		result[i] = v.data()[i] ^ 0x8000
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // AbsF16 computes absolute value.
 func AbsF16(v Vec[Float16]) Vec[Float16] {
-	result := make([]Float16, len(v.data))
-	for i := 0; i < len(v.data); i++ {
+	out := makeVec[Float16](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
 		// Absolute value is just clearing the sign bit
-		result[i] = v.data[i] & 0x7FFF
+		result[i] = v.data()[i] & 0x7FFF
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // MinF16 returns element-wise minimum.
 func MinF16(a, b Vec[Float16]) Vec[Float16] {
-	n := min(len(b.data), len(a.data))
-	result := make([]Float16, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[Float16](n)
+	result := out.data()
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
 		if af < bf {
-			result[i] = a.data[i]
+			result[i] = a.data()[i]
 		} else {
-			result[i] = b.data[i]
+			result[i] = b.data()[i]
 		}
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // MaxF16 returns element-wise maximum.
 func MaxF16(a, b Vec[Float16]) Vec[Float16] {
-	n := min(len(b.data), len(a.data))
-	result := make([]Float16, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[Float16](n)
+	result := out.data()
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
 		if af > bf {
-			result[i] = a.data[i]
+			result[i] = a.data()[i]
 		} else {
-			result[i] = b.data[i]
+			result[i] = b.data()[i]
 		}
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // SqrtF16 computes square root.
 func SqrtF16(v Vec[Float16]) Vec[Float16] {
-	result := make([]Float16, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		f := float64(Float16ToFloat32(v.data[i]))
+	out := makeVec[Float16](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		f := float64(Float16ToFloat32(v.data()[i]))
 		result[i] = Float32ToFloat16(float32(math.Sqrt(f)))
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // ReciprocalF16 computes 1/x (reciprocal).
 func ReciprocalF16(v Vec[Float16]) Vec[Float16] {
-	result := make([]Float16, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		f := Float16ToFloat32(v.data[i])
+	out := makeVec[Float16](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		f := Float16ToFloat32(v.data()[i])
 		result[i] = Float32ToFloat16(1.0 / f)
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // ReciprocalSqrtF16 computes 1/sqrt(x).
 func ReciprocalSqrtF16(v Vec[Float16]) Vec[Float16] {
-	result := make([]Float16, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		f := float64(Float16ToFloat32(v.data[i]))
+	out := makeVec[Float16](v.NumLanes())
+	result := out.data()
+	for i := 0; i < v.NumLanes(); i++ {
+		f := float64(Float16ToFloat32(v.data()[i]))
 		result[i] = Float32ToFloat16(float32(1.0 / math.Sqrt(f)))
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // ReduceSumF16 sums all lanes and returns the result as float32.
 // Accumulation is done in float32 to avoid precision loss.
 func ReduceSumF16(v Vec[Float16]) float32 {
 	var sum float32
-	for i := 0; i < len(v.data); i++ {
-		sum += Float16ToFloat32(v.data[i])
+	for i := 0; i < v.NumLanes(); i++ {
+		sum += Float16ToFloat32(v.data()[i])
 	}
 	return sum
 }
 
 // ReduceMinF16 returns the minimum value across all lanes.
 func ReduceMinF16(v Vec[Float16]) Float16 {
-	if len(v.data) == 0 {
+	if v.NumLanes() == 0 {
 		return Float16Inf // Return +Inf for empty vector
 	}
-	min := v.data[0]
+	min := v.data()[0]
 	minF := Float16ToFloat32(min)
-	for i := 1; i < len(v.data); i++ {
-		f := Float16ToFloat32(v.data[i])
+	for i := 1; i < v.NumLanes(); i++ {
+		f := Float16ToFloat32(v.data()[i])
 		if f < minF {
-			min = v.data[i]
+			min = v.data()[i]
 			minF = f
 		}
 	}
@@ -198,15 +210,15 @@ func ReduceMinF16(v Vec[Float16]) Float16 {
 
 // ReduceMaxF16 returns the maximum value across all lanes.
 func ReduceMaxF16(v Vec[Float16]) Float16 {
-	if len(v.data) == 0 {
+	if v.NumLanes() == 0 {
 		return Float16NegInf // Return -Inf for empty vector
 	}
-	max := v.data[0]
+	max := v.data()[0]
 	maxF := Float16ToFloat32(max)
-	for i := 1; i < len(v.data); i++ {
-		f := Float16ToFloat32(v.data[i])
+	for i := 1; i < v.NumLanes(); i++ {
+		f := Float16ToFloat32(v.data()[i])
 		if f > maxF {
-			max = v.data[i]
+			max = v.data()[i]
 			maxF = f
 		}
 	}
@@ -216,11 +228,11 @@ func ReduceMaxF16(v Vec[Float16]) Float16 {
 // DotF16 computes dot product of two Float16 vectors, returning float32.
 // This is the common ML pattern: accumulate in higher precision.
 func DotF16(a, b Vec[Float16]) float32 {
-	n := min(len(b.data), len(a.data))
+	n := min(b.NumLanes(), a.NumLanes())
 	var sum float32
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
 		sum += af * bf
 	}
 	return sum
@@ -228,129 +240,130 @@ func DotF16(a, b Vec[Float16]) float32 {
 
 // NotEqualF16 compares two Float16 vectors for inequality.
 func NotEqualF16(a, b Vec[Float16]) Mask[Float16] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[Float16](n)
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
-		bits[i] = af != bf
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
+		bits.set(i, af != bf)
 	}
-	return Mask[Float16]{bits: bits}
+	return bits
 }
 
 // EqualF16 compares two Float16 vectors for equality.
 func EqualF16(a, b Vec[Float16]) Mask[Float16] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[Float16](n)
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
-		bits[i] = af == bf
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
+		bits.set(i, af == bf)
 	}
-	return Mask[Float16]{bits: bits}
+	return bits
 }
 
 // LessThanF16 compares a < b element-wise.
 func LessThanF16(a, b Vec[Float16]) Mask[Float16] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[Float16](n)
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
-		bits[i] = af < bf
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
+		bits.set(i, af < bf)
 	}
-	return Mask[Float16]{bits: bits}
+	return bits
 }
 
 // LessThanOrEqualF16 compares a <= b element-wise.
 func LessThanOrEqualF16(a, b Vec[Float16]) Mask[Float16] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[Float16](n)
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
-		bits[i] = af <= bf
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
+		bits.set(i, af <= bf)
 	}
-	return Mask[Float16]{bits: bits}
+	return bits
 }
 
 // GreaterThanF16 compares a > b element-wise.
 func GreaterThanF16(a, b Vec[Float16]) Mask[Float16] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[Float16](n)
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
-		bits[i] = af > bf
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
+		bits.set(i, af > bf)
 	}
-	return Mask[Float16]{bits: bits}
+	return bits
 }
 
 // GreaterThanOrEqualF16 compares a >= b element-wise.
 func GreaterThanOrEqualF16(a, b Vec[Float16]) Mask[Float16] {
-	n := min(len(b.data), len(a.data))
-	bits := make([]bool, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	bits := makeMask[Float16](n)
 	for i := range n {
-		af := Float16ToFloat32(a.data[i])
-		bf := Float16ToFloat32(b.data[i])
-		bits[i] = af >= bf
+		af := Float16ToFloat32(a.data()[i])
+		bf := Float16ToFloat32(b.data()[i])
+		bits.set(i, af >= bf)
 	}
-	return Mask[Float16]{bits: bits}
+	return bits
 }
 
 // IsNaNF16 returns a mask where true indicates NaN.
 func IsNaNF16(v Vec[Float16]) Mask[Float16] {
-	bits := make([]bool, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		bits[i] = v.data[i].IsNaN()
+	bits := makeMask[Float16](v.NumLanes())
+	for i := 0; i < v.NumLanes(); i++ {
+		bits.set(i, v.data()[i].IsNaN())
 	}
-	return Mask[Float16]{bits: bits}
+	return bits
 }
 
 // IsInfF16 returns a mask where true indicates infinity.
 // sign: 0 = any infinity, 1 = positive infinity, -1 = negative infinity
 func IsInfF16(v Vec[Float16], sign int) Mask[Float16] {
-	bits := make([]bool, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		if !v.data[i].IsInf() {
-			bits[i] = false
+	bits := makeMask[Float16](v.NumLanes())
+	for i := 0; i < v.NumLanes(); i++ {
+		if !v.data()[i].IsInf() {
+			bits.set(i, false)
 			continue
 		}
 		switch sign {
 		case 0:
-			bits[i] = true
+			bits.set(i, true)
 		case 1:
-			bits[i] = !v.data[i].IsNegative()
+			bits.set(i, !v.data()[i].IsNegative())
 		case -1:
-			bits[i] = v.data[i].IsNegative()
+			bits.set(i, v.data()[i].IsNegative())
 		default:
-			bits[i] = true
+			bits.set(i, true)
 		}
 	}
-	return Mask[Float16]{bits: bits}
+	return bits
 }
 
 // IsFiniteF16 returns a mask where true indicates finite (not NaN or Inf).
 func IsFiniteF16(v Vec[Float16]) Mask[Float16] {
-	bits := make([]bool, len(v.data))
-	for i := 0; i < len(v.data); i++ {
-		bits[i] = !v.data[i].IsNaN() && !v.data[i].IsInf()
+	bits := makeMask[Float16](v.NumLanes())
+	for i := 0; i < v.NumLanes(); i++ {
+		bits.set(i, !v.data()[i].IsNaN() && !v.data()[i].IsInf())
 	}
-	return Mask[Float16]{bits: bits}
+	return bits
 }
 
 // IfThenElseF16 selects elements based on mask: mask ? yes : no.
 func IfThenElseF16(mask Mask[Float16], yes, no Vec[Float16]) Vec[Float16] {
-	n := min(len(no.data), min(len(yes.data), len(mask.bits)))
-	result := make([]Float16, n)
+	n := min(no.NumLanes(), min(yes.NumLanes(), mask.NumLanes()))
+	out := makeVec[Float16](n)
+	result := out.data()
 	for i := range n {
-		if mask.bits[i] {
-			result[i] = yes.data[i]
+		if mask.get(i) {
+			result[i] = yes.data()[i]
 		} else {
-			result[i] = no.data[i]
+			result[i] = no.data()[i]
 		}
 	}
-	return Vec[Float16]{data: result}
+	return out
 }
 
 // ClampF16 clamps values to [lo, hi] range.
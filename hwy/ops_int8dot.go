@@ -20,16 +20,17 @@ package hwy
 //
 // Maps to vdotq_s32 (NEON DOTPROD) / VPDPBSSD (AVX-VNNI).
 func DotProductSS(a, b Vec[int8]) Vec[int32] {
-	n := len(a.data) / 4
-	result := make([]int32, n)
+	n := a.NumLanes() / 4
+	out := makeVec[int32](n)
+	result := out.data()
 	for i := range n {
 		base := i * 4
-		result[i] = int32(a.data[base])*int32(b.data[base]) +
-			int32(a.data[base+1])*int32(b.data[base+1]) +
-			int32(a.data[base+2])*int32(b.data[base+2]) +
-			int32(a.data[base+3])*int32(b.data[base+3])
+		result[i] = int32(a.data()[base])*int32(b.data()[base]) +
+			int32(a.data()[base+1])*int32(b.data()[base+1]) +
+			int32(a.data()[base+2])*int32(b.data()[base+2]) +
+			int32(a.data()[base+3])*int32(b.data()[base+3])
 	}
-	return Vec[int32]{data: result}
+	return out
 }
 
 // DotProductUU computes widening 4-group dot product for unsigned uint8.
@@ -38,16 +39,17 @@ func DotProductSS(a, b Vec[int8]) Vec[int32] {
 //
 // Maps to vdotq_u32 (NEON DOTPROD) / VPDPBUUD (AVX-VNNI).
 func DotProductUU(a, b Vec[uint8]) Vec[uint32] {
-	n := len(a.data) / 4
-	result := make([]uint32, n)
+	n := a.NumLanes() / 4
+	out := makeVec[uint32](n)
+	result := out.data()
 	for i := range n {
 		base := i * 4
-		result[i] = uint32(a.data[base])*uint32(b.data[base]) +
-			uint32(a.data[base+1])*uint32(b.data[base+1]) +
-			uint32(a.data[base+2])*uint32(b.data[base+2]) +
-			uint32(a.data[base+3])*uint32(b.data[base+3])
+		result[i] = uint32(a.data()[base])*uint32(b.data()[base]) +
+			uint32(a.data()[base+1])*uint32(b.data()[base+1]) +
+			uint32(a.data()[base+2])*uint32(b.data()[base+2]) +
+			uint32(a.data()[base+3])*uint32(b.data()[base+3])
 	}
-	return Vec[uint32]{data: result}
+	return out
 }
 
 // DotProduct computes widening 4-group dot product for int8 or uint8 inputs.
@@ -57,14 +59,15 @@ func DotProductUU(a, b Vec[uint8]) Vec[uint32] {
 // Returns int32 for both signed and unsigned inputs. This is safe because
 // the maximum per-group value is 4*255*255 = 260100, well within int32 range.
 func DotProduct[T int8 | uint8](a, b Vec[T]) Vec[int32] {
-	n := len(a.data) / 4
-	result := make([]int32, n)
+	n := a.NumLanes() / 4
+	out := makeVec[int32](n)
+	result := out.data()
 	for i := range n {
 		base := i * 4
-		result[i] = int32(a.data[base])*int32(b.data[base]) +
-			int32(a.data[base+1])*int32(b.data[base+1]) +
-			int32(a.data[base+2])*int32(b.data[base+2]) +
-			int32(a.data[base+3])*int32(b.data[base+3])
+		result[i] = int32(a.data()[base])*int32(b.data()[base]) +
+			int32(a.data()[base+1])*int32(b.data()[base+1]) +
+			int32(a.data()[base+2])*int32(b.data()[base+2]) +
+			int32(a.data()[base+3])*int32(b.data()[base+3])
 	}
-	return Vec[int32]{data: result}
+	return out
 }
@@ -29,8 +29,8 @@ func TestLoad(t *testing.T) {
 	}
 
 	for i := 0; i < v.NumLanes() && i < len(data); i++ {
-		if v.data[i] != data[i] {
-			t.Errorf("Load: lane %d: got %v, want %v", i, v.data[i], data[i])
+		if v.data()[i] != data[i] {
+			t.Errorf("Load: lane %d: got %v, want %v", i, v.data()[i], data[i])
 		}
 	}
 }
@@ -43,8 +43,8 @@ func TestSet(t *testing.T) {
 	}
 
 	for i := 0; i < v.NumLanes(); i++ {
-		if v.data[i] != 42.0 {
-			t.Errorf("Set: lane %d: got %v, want %v", i, v.data[i], 42.0)
+		if v.data()[i] != 42.0 {
+			t.Errorf("Set: lane %d: got %v, want %v", i, v.data()[i], 42.0)
 		}
 	}
 }
@@ -57,8 +57,8 @@ func TestZero(t *testing.T) {
 	}
 
 	for i := 0; i < v.NumLanes(); i++ {
-		if v.data[i] != 0 {
-			t.Errorf("Zero: lane %d: got %v, want 0", i, v.data[i])
+		if v.data()[i] != 0 {
+			t.Errorf("Zero: lane %d: got %v, want 0", i, v.data()[i])
 		}
 	}
 }
@@ -69,8 +69,8 @@ func TestAdd(t *testing.T) {
 	result := Add(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		if result.data[i] != 15.0 {
-			t.Errorf("Add: lane %d: got %v, want 15.0", i, result.data[i])
+		if result.data()[i] != 15.0 {
+			t.Errorf("Add: lane %d: got %v, want 15.0", i, result.data()[i])
 		}
 	}
 }
@@ -81,8 +81,8 @@ func TestSub(t *testing.T) {
 	result := Sub(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		if result.data[i] != 7.0 {
-			t.Errorf("Sub: lane %d: got %v, want 7.0", i, result.data[i])
+		if result.data()[i] != 7.0 {
+			t.Errorf("Sub: lane %d: got %v, want 7.0", i, result.data()[i])
 		}
 	}
 }
@@ -93,8 +93,8 @@ func TestMul(t *testing.T) {
 	result := Mul(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		if result.data[i] != 20.0 {
-			t.Errorf("Mul: lane %d: got %v, want 20.0", i, result.data[i])
+		if result.data()[i] != 20.0 {
+			t.Errorf("Mul: lane %d: got %v, want 20.0", i, result.data()[i])
 		}
 	}
 }
@@ -105,8 +105,8 @@ func TestDiv(t *testing.T) {
 	result := Div(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		if result.data[i] != 5.0 {
-			t.Errorf("Div: lane %d: got %v, want 5.0", i, result.data[i])
+		if result.data()[i] != 5.0 {
+			t.Errorf("Div: lane %d: got %v, want 5.0", i, result.data()[i])
 		}
 	}
 }
@@ -116,8 +116,8 @@ func TestNeg(t *testing.T) {
 	result := Neg(v)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		if result.data[i] != -42.0 {
-			t.Errorf("Neg: lane %d: got %v, want -42.0", i, result.data[i])
+		if result.data()[i] != -42.0 {
+			t.Errorf("Neg: lane %d: got %v, want -42.0", i, result.data()[i])
 		}
 	}
 }
@@ -127,8 +127,8 @@ func TestAbs(t *testing.T) {
 	result := Abs(v)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		if result.data[i] != 42.0 {
-			t.Errorf("Abs: lane %d: got %v, want 42.0", i, result.data[i])
+		if result.data()[i] != 42.0 {
+			t.Errorf("Abs: lane %d: got %v, want 42.0", i, result.data()[i])
 		}
 	}
 }
@@ -139,8 +139,8 @@ func TestMin(t *testing.T) {
 	result := Min(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		if result.data[i] != 5.0 {
-			t.Errorf("Min: lane %d: got %v, want 5.0", i, result.data[i])
+		if result.data()[i] != 5.0 {
+			t.Errorf("Min: lane %d: got %v, want 5.0", i, result.data()[i])
 		}
 	}
 }
@@ -151,8 +151,8 @@ func TestMax(t *testing.T) {
 	result := Max(a, b)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		if result.data[i] != 10.0 {
-			t.Errorf("Max: lane %d: got %v, want 10.0", i, result.data[i])
+		if result.data()[i] != 10.0 {
+			t.Errorf("Max: lane %d: got %v, want 10.0", i, result.data()[i])
 		}
 	}
 }
@@ -162,8 +162,8 @@ func TestSqrt(t *testing.T) {
 	result := Sqrt(v)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		if result.data[i] != 4.0 {
-			t.Errorf("Sqrt: lane %d: got %v, want 4.0", i, result.data[i])
+		if result.data()[i] != 4.0 {
+			t.Errorf("Sqrt: lane %d: got %v, want 4.0", i, result.data()[i])
 		}
 	}
 }
@@ -175,8 +175,8 @@ func TestFMA(t *testing.T) {
 	result := FMA(a, b, c) // 2*3 + 4 = 10
 
 	for i := 0; i < result.NumLanes(); i++ {
-		if result.data[i] != 10.0 {
-			t.Errorf("FMA: lane %d: got %v, want 10.0", i, result.data[i])
+		if result.data()[i] != 10.0 {
+			t.Errorf("FMA: lane %d: got %v, want 10.0", i, result.data()[i])
 		}
 	}
 }
@@ -254,14 +254,14 @@ func TestIfThenElse(t *testing.T) {
 	b := Set[float32](200.0)
 	result := IfThenElse(mask, a, b)
 
-	if result.data[0] != 100.0 {
-		t.Errorf("IfThenElse: lane 0: got %v, want 100.0", result.data[0])
+	if result.data()[0] != 100.0 {
+		t.Errorf("IfThenElse: lane 0: got %v, want 100.0", result.data()[0])
 	}
-	if result.data[1] != 200.0 {
-		t.Errorf("IfThenElse: lane 1: got %v, want 200.0", result.data[1])
+	if result.data()[1] != 200.0 {
+		t.Errorf("IfThenElse: lane 1: got %v, want 200.0", result.data()[1])
 	}
-	if result.data[2] != 100.0 {
-		t.Errorf("IfThenElse: lane 2: got %v, want 100.0", result.data[2])
+	if result.data()[2] != 100.0 {
+		t.Errorf("IfThenElse: lane 2: got %v, want 100.0", result.data()[2])
 	}
 }
 
@@ -271,19 +271,19 @@ func TestMaskLoad(t *testing.T) {
 	mask := TailMask[float32](3) // First 3 lanes active
 	v := MaskLoad(mask, data)
 
-	if v.data[0] != 1.0 {
-		t.Errorf("MaskLoad: lane 0: got %v, want 1.0", v.data[0])
+	if v.data()[0] != 1.0 {
+		t.Errorf("MaskLoad: lane 0: got %v, want 1.0", v.data()[0])
 	}
-	if v.data[1] != 2.0 {
-		t.Errorf("MaskLoad: lane 1: got %v, want 2.0", v.data[1])
+	if v.data()[1] != 2.0 {
+		t.Errorf("MaskLoad: lane 1: got %v, want 2.0", v.data()[1])
 	}
-	if v.data[2] != 3.0 {
-		t.Errorf("MaskLoad: lane 2: got %v, want 3.0", v.data[2])
+	if v.data()[2] != 3.0 {
+		t.Errorf("MaskLoad: lane 2: got %v, want 3.0", v.data()[2])
 	}
 	// Lanes 3+ should be zero
 	for i := 3; i < v.NumLanes(); i++ {
-		if v.data[i] != 0.0 {
-			t.Errorf("MaskLoad: lane %d: got %v, want 0.0", i, v.data[i])
+		if v.data()[i] != 0.0 {
+			t.Errorf("MaskLoad: lane %d: got %v, want 0.0", i, v.data()[i])
 		}
 	}
 }
@@ -471,8 +471,8 @@ func TestAnd(t *testing.T) {
 
 	expected := []uint32{0x00000000, 0x00000000, 0x02244220, 0x0F0F0F0F}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("And: lane %d: got 0x%08X, want 0x%08X", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("And: lane %d: got 0x%08X, want 0x%08X", i, result.data()[i], expected[i])
 		}
 	}
 
@@ -489,8 +489,8 @@ func TestOr(t *testing.T) {
 
 	expected := []uint32{0xFFFFFFFF, 0xFFFFFFFF, 0x97755779, 0x0F0F0F0F}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("Or: lane %d: got 0x%08X, want 0x%08X", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("Or: lane %d: got 0x%08X, want 0x%08X", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -502,8 +502,8 @@ func TestXor(t *testing.T) {
 
 	expected := []uint32{0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x00000000}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("Xor: lane %d: got 0x%08X, want 0x%08X", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("Xor: lane %d: got 0x%08X, want 0x%08X", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -514,8 +514,8 @@ func TestNot(t *testing.T) {
 
 	expected := []uint32{0xFFFFFFFF, 0x00000000, 0x55555555, 0xAAAAAAAA}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("Not: lane %d: got 0x%08X, want 0x%08X", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("Not: lane %d: got 0x%08X, want 0x%08X", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -528,8 +528,8 @@ func TestAndNot(t *testing.T) {
 	// (~a) & b
 	expected := []uint32{0x00FF00FF, 0x55555555, 0x00000000, 0x0F0F0F0F}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("AndNot: lane %d: got 0x%08X, want 0x%08X", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("AndNot: lane %d: got 0x%08X, want 0x%08X", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -540,8 +540,8 @@ func TestShiftLeft(t *testing.T) {
 
 	expected := []uint32{4, 8, 12, 16}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("ShiftLeft: lane %d: got %d, want %d", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("ShiftLeft: lane %d: got %d, want %d", i, result.data()[i], expected[i])
 		}
 	}
 
@@ -551,8 +551,8 @@ func TestShiftLeft(t *testing.T) {
 
 	expected2 := []int32{-2, -4, -6, -8}
 	for i := 0; i < len(expected2) && i < result2.NumLanes(); i++ {
-		if result2.data[i] != expected2[i] {
-			t.Errorf("ShiftLeft (signed): lane %d: got %d, want %d", i, result2.data[i], expected2[i])
+		if result2.data()[i] != expected2[i] {
+			t.Errorf("ShiftLeft (signed): lane %d: got %d, want %d", i, result2.data()[i], expected2[i])
 		}
 	}
 }
@@ -564,8 +564,8 @@ func TestShiftRight(t *testing.T) {
 
 	expected := []uint32{4, 2, 1, 0}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("ShiftRight (unsigned): lane %d: got %d, want %d", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("ShiftRight (unsigned): lane %d: got %d, want %d", i, result.data()[i], expected[i])
 		}
 	}
 
@@ -575,8 +575,8 @@ func TestShiftRight(t *testing.T) {
 
 	expected2 := []int32{-4, -2, 2, 1}
 	for i := 0; i < len(expected2) && i < result2.NumLanes(); i++ {
-		if result2.data[i] != expected2[i] {
-			t.Errorf("ShiftRight (signed): lane %d: got %d, want %d", i, result2.data[i], expected2[i])
+		if result2.data()[i] != expected2[i] {
+			t.Errorf("ShiftRight (signed): lane %d: got %d, want %d", i, result2.data()[i], expected2[i])
 		}
 	}
 }
@@ -585,8 +585,8 @@ func TestIota(t *testing.T) {
 	v := Iota[int32]()
 
 	for i := 0; i < v.NumLanes(); i++ {
-		if v.data[i] != int32(i) {
-			t.Errorf("Iota: lane %d: got %d, want %d", i, v.data[i], i)
+		if v.data()[i] != int32(i) {
+			t.Errorf("Iota: lane %d: got %d, want %d", i, v.data()[i], i)
 		}
 	}
 
@@ -594,8 +594,8 @@ func TestIota(t *testing.T) {
 	vf := Iota[float32]()
 
 	for i := 0; i < vf.NumLanes(); i++ {
-		if vf.data[i] != float32(i) {
-			t.Errorf("Iota (float32): lane %d: got %f, want %f", i, vf.data[i], float32(i))
+		if vf.data()[i] != float32(i) {
+			t.Errorf("Iota (float32): lane %d: got %f, want %f", i, vf.data()[i], float32(i))
 		}
 	}
 }
@@ -605,7 +605,7 @@ func TestSignBit(t *testing.T) {
 	vf32 := SignBit[float32]()
 	for i := 0; i < vf32.NumLanes(); i++ {
 		// Should be -0.0, which has sign bit set
-		bits := math.Float32bits(vf32.data[i])
+		bits := math.Float32bits(vf32.data()[i])
 		if bits != 0x80000000 {
 			t.Errorf("SignBit (float32): lane %d: got bits 0x%08X, want 0x80000000", i, bits)
 		}
@@ -614,7 +614,7 @@ func TestSignBit(t *testing.T) {
 	// Test with float64
 	vf64 := SignBit[float64]()
 	for i := 0; i < vf64.NumLanes(); i++ {
-		bits := math.Float64bits(vf64.data[i])
+		bits := math.Float64bits(vf64.data()[i])
 		if bits != 0x8000000000000000 {
 			t.Errorf("SignBit (float64): lane %d: got bits 0x%016X, want 0x8000000000000000", i, bits)
 		}
@@ -623,16 +623,16 @@ func TestSignBit(t *testing.T) {
 	// Test with signed integer
 	vi32 := SignBit[int32]()
 	for i := 0; i < vi32.NumLanes(); i++ {
-		if vi32.data[i] != int32(-2147483648) {
-			t.Errorf("SignBit (int32): lane %d: got %d, want %d", i, vi32.data[i], int32(-2147483648))
+		if vi32.data()[i] != int32(-2147483648) {
+			t.Errorf("SignBit (int32): lane %d: got %d, want %d", i, vi32.data()[i], int32(-2147483648))
 		}
 	}
 
 	// Test with unsigned integer
 	vu32 := SignBit[uint32]()
 	for i := 0; i < vu32.NumLanes(); i++ {
-		if vu32.data[i] != uint32(0x80000000) {
-			t.Errorf("SignBit (uint32): lane %d: got 0x%08X, want 0x80000000", i, vu32.data[i])
+		if vu32.data()[i] != uint32(0x80000000) {
+			t.Errorf("SignBit (uint32): lane %d: got 0x%08X, want 0x80000000", i, vu32.data()[i])
 		}
 	}
 }
@@ -644,11 +644,11 @@ func TestReverse(t *testing.T) {
 	n := result.NumLanes()
 	for i := range n {
 		expected := int32(n - i)
-		if i < len(a.data) {
-			expected = a.data[n-1-i]
+		if i < a.NumLanes() {
+			expected = a.data()[n-1-i]
 		}
-		if result.data[i] != expected {
-			t.Errorf("Reverse: lane %d: got %d, want %d", i, result.data[i], expected)
+		if result.data()[i] != expected {
+			t.Errorf("Reverse: lane %d: got %d, want %d", i, result.data()[i], expected)
 		}
 	}
 }
@@ -660,16 +660,16 @@ func TestBroadcast(t *testing.T) {
 	result := Broadcast(a, 2)
 
 	for i := 0; i < result.NumLanes(); i++ {
-		if i < len(a.data) && result.data[i] != 3.0 {
-			t.Errorf("Broadcast: lane %d: got %f, want 3.0", i, result.data[i])
+		if i < a.NumLanes() && result.data()[i] != 3.0 {
+			t.Errorf("Broadcast: lane %d: got %f, want 3.0", i, result.data()[i])
 		}
 	}
 
 	// Test out of bounds
 	result2 := Broadcast(a, 100)
 	for i := 0; i < result2.NumLanes(); i++ {
-		if result2.data[i] != 0.0 {
-			t.Errorf("Broadcast (out of bounds): lane %d: got %f, want 0.0", i, result2.data[i])
+		if result2.data()[i] != 0.0 {
+			t.Errorf("Broadcast (out of bounds): lane %d: got %f, want 0.0", i, result2.data()[i])
 		}
 	}
 }
@@ -683,8 +683,8 @@ func TestRSqrt(t *testing.T) {
 	tolerance := float64(0.002)
 
 	for i := 0; i < result.NumLanes() && i < 8; i++ {
-		expected := float64(1.0 / math.Sqrt(float64(v.data[i])))
-		got := float64(result.data[i])
+		expected := float64(1.0 / math.Sqrt(float64(v.data()[i])))
+		got := float64(result.data()[i])
 		relErr := math.Abs(got-expected) / expected
 		if relErr > tolerance {
 			t.Errorf("RSqrt: lane %d: got %v, want ~%v (rel error %.4f%%)", i, got, expected, relErr*100)
@@ -701,8 +701,8 @@ func TestRSqrtNewtonRaphson(t *testing.T) {
 	tolerance := float64(0.0001)
 
 	for i := 0; i < result.NumLanes() && i < 8; i++ {
-		expected := float64(1.0 / math.Sqrt(float64(v.data[i])))
-		got := float64(result.data[i])
+		expected := float64(1.0 / math.Sqrt(float64(v.data()[i])))
+		got := float64(result.data()[i])
 		relErr := math.Abs(got-expected) / expected
 		if relErr > tolerance {
 			t.Errorf("RSqrtNewtonRaphson: lane %d: got %v, want ~%v (rel error %.6f%%)", i, got, expected, relErr*100)
@@ -719,8 +719,8 @@ func TestRSqrtPrecise(t *testing.T) {
 	tolerance := float64(1e-6)
 
 	for i := 0; i < result.NumLanes() && i < 8; i++ {
-		expected := float64(1.0 / math.Sqrt(float64(v.data[i])))
-		got := float64(result.data[i])
+		expected := float64(1.0 / math.Sqrt(float64(v.data()[i])))
+		got := float64(result.data()[i])
 		relErr := math.Abs(got-expected) / expected
 		if relErr > tolerance {
 			t.Errorf("RSqrtPrecise: lane %d: got %v, want ~%v (rel error %.9f%%)", i, got, expected, relErr*100)
@@ -737,8 +737,8 @@ func TestRSqrtFloat64(t *testing.T) {
 	tolerance := float64(0.002)
 
 	for i := 0; i < result.NumLanes() && i < 4; i++ {
-		expected := 1.0 / math.Sqrt(v.data[i])
-		got := result.data[i]
+		expected := 1.0 / math.Sqrt(v.data()[i])
+		got := result.data()[i]
 		relErr := math.Abs(got-expected) / expected
 		if relErr > tolerance {
 			t.Errorf("RSqrt (float64): lane %d: got %v, want ~%v (rel error %.4f%%)", i, got, expected, relErr*100)
@@ -754,8 +754,8 @@ func TestRSqrtNewtonRaphsonFloat64(t *testing.T) {
 	tolerance := float64(0.0001)
 
 	for i := 0; i < result.NumLanes() && i < 4; i++ {
-		expected := 1.0 / math.Sqrt(v.data[i])
-		got := result.data[i]
+		expected := 1.0 / math.Sqrt(v.data()[i])
+		got := result.data()[i]
 		relErr := math.Abs(got-expected) / expected
 		if relErr > tolerance {
 			t.Errorf("RSqrtNewtonRaphson (float64): lane %d: got %v, want ~%v (rel error %.6f%%)", i, got, expected, relErr*100)
@@ -771,8 +771,8 @@ func TestRSqrtPreciseFloat64(t *testing.T) {
 	tolerance := float64(1e-14)
 
 	for i := 0; i < result.NumLanes() && i < 4; i++ {
-		expected := 1.0 / math.Sqrt(v.data[i])
-		got := result.data[i]
+		expected := 1.0 / math.Sqrt(v.data()[i])
+		got := result.data()[i]
 		relErr := math.Abs(got-expected) / expected
 		if relErr > tolerance {
 			t.Errorf("RSqrtPrecise (float64): lane %d: got %v, want ~%v (rel error %.15f%%)", i, got, expected, relErr*100)
@@ -788,8 +788,8 @@ func TestRSqrtNonPerfectSquares(t *testing.T) {
 	tolerance := float64(1e-6)
 
 	for i := 0; i < result.NumLanes() && i < 8; i++ {
-		expected := float64(1.0 / math.Sqrt(float64(v.data[i])))
-		got := float64(result.data[i])
+		expected := float64(1.0 / math.Sqrt(float64(v.data()[i])))
+		got := float64(result.data()[i])
 		relErr := math.Abs(got-expected) / expected
 		if relErr > tolerance {
 			t.Errorf("RSqrtPrecise (non-perfect): lane %d: got %v, want ~%v (rel error %.9f%%)", i, got, expected, relErr*100)
@@ -805,8 +805,8 @@ func TestRSqrtLargeValues(t *testing.T) {
 	tolerance := float64(1e-6)
 
 	for i := 0; i < result.NumLanes() && i < 8; i++ {
-		expected := float64(1.0 / math.Sqrt(float64(v.data[i])))
-		got := float64(result.data[i])
+		expected := float64(1.0 / math.Sqrt(float64(v.data()[i])))
+		got := float64(result.data()[i])
 		relErr := math.Abs(got-expected) / expected
 		if relErr > tolerance {
 			t.Errorf("RSqrtPrecise (large): lane %d: got %v, want ~%v (rel error %.9f%%)", i, got, expected, relErr*100)
@@ -822,8 +822,8 @@ func TestRSqrtSmallValues(t *testing.T) {
 	tolerance := float64(1e-5) // slightly looser for very small values
 
 	for i := 0; i < result.NumLanes() && i < 8; i++ {
-		expected := float64(1.0 / math.Sqrt(float64(v.data[i])))
-		got := float64(result.data[i])
+		expected := float64(1.0 / math.Sqrt(float64(v.data()[i])))
+		got := float64(result.data()[i])
 		relErr := math.Abs(got-expected) / expected
 		if relErr > tolerance {
 			t.Errorf("RSqrtPrecise (small): lane %d: got %v, want ~%v (rel error %.9f%%)", i, got, expected, relErr*100)
@@ -864,8 +864,8 @@ func TestLoadSlice(t *testing.T) {
 	}
 
 	for i := 0; i < v.NumLanes(); i++ {
-		if v.data[i] != data[i] {
-			t.Errorf("LoadSlice: lane %d: got %v, want %v", i, v.data[i], data[i])
+		if v.data()[i] != data[i] {
+			t.Errorf("LoadSlice: lane %d: got %v, want %v", i, v.data()[i], data[i])
 		}
 	}
 }
@@ -275,3 +275,23 @@ func TruncateU64ToU32_AVX2(v archsimd.Int64x4) archsimd.Int32x8 {
 	}
 	return archsimd.LoadInt32x8Slice(result[:])
 }
+
+// promoteU8ToU16Lower and promoteU8ToU16Upper are PSHUFB indices that place
+// bytes 0-7 (resp. 8-15) in the low byte of each uint16 lane. Indices with the
+// high bit set zero the high byte, so the shuffle is a zero-extension.
+var (
+	promoteU8ToU16Lower = [16]int8{0, -1, 1, -1, 2, -1, 3, -1, 4, -1, 5, -1, 6, -1, 7, -1}
+	promoteU8ToU16Upper = [16]int8{8, -1, 9, -1, 10, -1, 11, -1, 12, -1, 13, -1, 14, -1, 15, -1}
+)
+
+// PromoteLowerU8ToU16_AVX2_Uint8x16 zero-extends the lower 8 uint8 lanes to
+// uint16 with a single in-register byte shuffle.
+func PromoteLowerU8ToU16_AVX2_Uint8x16(v archsimd.Uint8x16) archsimd.Uint16x8 {
+	return v.PermuteOrZero(archsimd.LoadInt8x16(&promoteU8ToU16Lower)).AsUint16x8()
+}
+
+// PromoteUpperU8ToU16_AVX2_Uint8x16 zero-extends the upper 8 uint8 lanes to
+// uint16 with a single in-register byte shuffle.
+func PromoteUpperU8ToU16_AVX2_Uint8x16(v archsimd.Uint8x16) archsimd.Uint16x8 {
+	return v.PermuteOrZero(archsimd.LoadInt8x16(&promoteU8ToU16Upper)).AsUint16x8()
+}
@@ -255,3 +255,15 @@ func TruncateU64ToU32_AVX512(v archsimd.Int64x8) archsimd.Int32x16 {
 	}
 	return archsimd.LoadInt32x16Slice(result[:])
 }
+
+// PromoteLowerU8ToU16_AVX512_Uint8x16 zero-extends the lower 8 uint8 lanes to
+// uint16. See PromoteLowerU8ToU16_AVX2_Uint8x16.
+func PromoteLowerU8ToU16_AVX512_Uint8x16(v archsimd.Uint8x16) archsimd.Uint16x8 {
+	return PromoteLowerU8ToU16_AVX2_Uint8x16(v)
+}
+
+// PromoteUpperU8ToU16_AVX512_Uint8x16 zero-extends the upper 8 uint8 lanes to
+// uint16. See PromoteUpperU8ToU16_AVX2_Uint8x16.
+func PromoteUpperU8ToU16_AVX512_Uint8x16(v archsimd.Uint8x16) archsimd.Uint16x8 {
+	return PromoteUpperU8ToU16_AVX2_Uint8x16(v)
+}
@@ -20,160 +20,160 @@ import (
 )
 
 func TestPromoteF32ToF64(t *testing.T) {
-	input := Vec[float32]{data: []float32{1.5, 2.25, 3.125, 4.0625}}
+	input := vecFrom([]float32{1.5, 2.25, 3.125, 4.0625})
 	result := PromoteF32ToF64(input)
 
-	for i := 0; i < len(input.data); i++ {
-		expected := float64(input.data[i])
-		if result.data[i] != expected {
-			t.Errorf("PromoteF32ToF64 lane %d: got %v, want %v", i, result.data[i], expected)
+	for i := 0; i < input.NumLanes(); i++ {
+		expected := float64(input.data()[i])
+		if result.data()[i] != expected {
+			t.Errorf("PromoteF32ToF64 lane %d: got %v, want %v", i, result.data()[i], expected)
 		}
 	}
 }
 
 func TestPromoteLowerF32ToF64(t *testing.T) {
-	input := Vec[float32]{data: []float32{1, 2, 3, 4, 5, 6, 7, 8}}
+	input := vecFrom([]float32{1, 2, 3, 4, 5, 6, 7, 8})
 	result := PromoteLowerF32ToF64(input)
 
 	// Should only promote lower 4 lanes
 	want := []float64{1, 2, 3, 4}
-	if len(result.data) != 4 {
-		t.Errorf("PromoteLowerF32ToF64: got %d lanes, want 4", len(result.data))
+	if result.NumLanes() != 4 {
+		t.Errorf("PromoteLowerF32ToF64: got %d lanes, want 4", result.NumLanes())
 	}
-	for i := 0; i < len(want) && i < len(result.data); i++ {
-		if result.data[i] != want[i] {
-			t.Errorf("PromoteLowerF32ToF64 lane %d: got %v, want %v", i, result.data[i], want[i])
+	for i := 0; i < len(want) && i < result.NumLanes(); i++ {
+		if result.data()[i] != want[i] {
+			t.Errorf("PromoteLowerF32ToF64 lane %d: got %v, want %v", i, result.data()[i], want[i])
 		}
 	}
 }
 
 func TestPromoteUpperF32ToF64(t *testing.T) {
-	input := Vec[float32]{data: []float32{1, 2, 3, 4, 5, 6, 7, 8}}
+	input := vecFrom([]float32{1, 2, 3, 4, 5, 6, 7, 8})
 	result := PromoteUpperF32ToF64(input)
 
 	// Should only promote upper 4 lanes
 	want := []float64{5, 6, 7, 8}
-	if len(result.data) != 4 {
-		t.Errorf("PromoteUpperF32ToF64: got %d lanes, want 4", len(result.data))
+	if result.NumLanes() != 4 {
+		t.Errorf("PromoteUpperF32ToF64: got %d lanes, want 4", result.NumLanes())
 	}
-	for i := 0; i < len(want) && i < len(result.data); i++ {
-		if result.data[i] != want[i] {
-			t.Errorf("PromoteUpperF32ToF64 lane %d: got %v, want %v", i, result.data[i], want[i])
+	for i := 0; i < len(want) && i < result.NumLanes(); i++ {
+		if result.data()[i] != want[i] {
+			t.Errorf("PromoteUpperF32ToF64 lane %d: got %v, want %v", i, result.data()[i], want[i])
 		}
 	}
 }
 
 func TestDemoteF64ToF32(t *testing.T) {
-	input := Vec[float64]{data: []float64{1.5, 2.25, 3.125, 4.0625}}
+	input := vecFrom([]float64{1.5, 2.25, 3.125, 4.0625})
 	result := DemoteF64ToF32(input)
 
-	for i := 0; i < len(input.data); i++ {
-		expected := float32(input.data[i])
-		if result.data[i] != expected {
-			t.Errorf("DemoteF64ToF32 lane %d: got %v, want %v", i, result.data[i], expected)
+	for i := 0; i < input.NumLanes(); i++ {
+		expected := float32(input.data()[i])
+		if result.data()[i] != expected {
+			t.Errorf("DemoteF64ToF32 lane %d: got %v, want %v", i, result.data()[i], expected)
 		}
 	}
 }
 
 func TestDemoteTwoF64ToF32(t *testing.T) {
-	lo := Vec[float64]{data: []float64{1, 2, 3, 4}}
-	hi := Vec[float64]{data: []float64{5, 6, 7, 8}}
+	lo := vecFrom([]float64{1, 2, 3, 4})
+	hi := vecFrom([]float64{5, 6, 7, 8})
 	result := DemoteTwoF64ToF32(lo, hi)
 
 	want := []float32{1, 2, 3, 4, 5, 6, 7, 8}
-	if len(result.data) != 8 {
-		t.Errorf("DemoteTwoF64ToF32: got %d lanes, want 8", len(result.data))
+	if result.NumLanes() != 8 {
+		t.Errorf("DemoteTwoF64ToF32: got %d lanes, want 8", result.NumLanes())
 	}
-	for i := 0; i < len(want) && i < len(result.data); i++ {
-		if result.data[i] != want[i] {
-			t.Errorf("DemoteTwoF64ToF32 lane %d: got %v, want %v", i, result.data[i], want[i])
+	for i := 0; i < len(want) && i < result.NumLanes(); i++ {
+		if result.data()[i] != want[i] {
+			t.Errorf("DemoteTwoF64ToF32 lane %d: got %v, want %v", i, result.data()[i], want[i])
 		}
 	}
 }
 
 func TestPromoteDemoteF32F64RoundTrip(t *testing.T) {
 	// Values that can be represented exactly in both float32 and float64
-	original := Vec[float32]{data: []float32{1.0, 2.0, 0.5, 0.25}}
+	original := vecFrom([]float32{1.0, 2.0, 0.5, 0.25})
 
 	promoted := PromoteF32ToF64(original)
 	demoted := DemoteF64ToF32(promoted)
 
-	for i := 0; i < len(original.data); i++ {
-		if demoted.data[i] != original.data[i] {
+	for i := 0; i < original.NumLanes(); i++ {
+		if demoted.data()[i] != original.data()[i] {
 			t.Errorf("PromoteDemote round trip lane %d: got %v, want %v",
-				i, demoted.data[i], original.data[i])
+				i, demoted.data()[i], original.data()[i])
 		}
 	}
 }
 
 func TestPromoteI8ToI16(t *testing.T) {
-	input := Vec[int8]{data: []int8{-128, -1, 0, 1, 127}}
+	input := vecFrom([]int8{-128, -1, 0, 1, 127})
 	result := PromoteI8ToI16(input)
 
-	for i := 0; i < len(input.data); i++ {
-		expected := int16(input.data[i])
-		if result.data[i] != expected {
-			t.Errorf("PromoteI8ToI16 lane %d: got %v, want %v", i, result.data[i], expected)
+	for i := 0; i < input.NumLanes(); i++ {
+		expected := int16(input.data()[i])
+		if result.data()[i] != expected {
+			t.Errorf("PromoteI8ToI16 lane %d: got %v, want %v", i, result.data()[i], expected)
 		}
 	}
 }
 
 func TestPromoteI16ToI32(t *testing.T) {
-	input := Vec[int16]{data: []int16{-32768, -1, 0, 1, 32767}}
+	input := vecFrom([]int16{-32768, -1, 0, 1, 32767})
 	result := PromoteI16ToI32(input)
 
-	for i := 0; i < len(input.data); i++ {
-		expected := int32(input.data[i])
-		if result.data[i] != expected {
-			t.Errorf("PromoteI16ToI32 lane %d: got %v, want %v", i, result.data[i], expected)
+	for i := 0; i < input.NumLanes(); i++ {
+		expected := int32(input.data()[i])
+		if result.data()[i] != expected {
+			t.Errorf("PromoteI16ToI32 lane %d: got %v, want %v", i, result.data()[i], expected)
 		}
 	}
 }
 
 func TestPromoteI32ToI64(t *testing.T) {
-	input := Vec[int32]{data: []int32{-2147483648, -1, 0, 1, 2147483647}}
+	input := vecFrom([]int32{-2147483648, -1, 0, 1, 2147483647})
 	result := PromoteI32ToI64(input)
 
-	for i := 0; i < len(input.data); i++ {
-		expected := int64(input.data[i])
-		if result.data[i] != expected {
-			t.Errorf("PromoteI32ToI64 lane %d: got %v, want %v", i, result.data[i], expected)
+	for i := 0; i < input.NumLanes(); i++ {
+		expected := int64(input.data()[i])
+		if result.data()[i] != expected {
+			t.Errorf("PromoteI32ToI64 lane %d: got %v, want %v", i, result.data()[i], expected)
 		}
 	}
 }
 
 func TestPromoteU8ToU16(t *testing.T) {
-	input := Vec[uint8]{data: []uint8{0, 1, 127, 128, 255}}
+	input := vecFrom([]uint8{0, 1, 127, 128, 255})
 	result := PromoteU8ToU16(input)
 
-	for i := 0; i < len(input.data); i++ {
-		expected := uint16(input.data[i])
-		if result.data[i] != expected {
-			t.Errorf("PromoteU8ToU16 lane %d: got %v, want %v", i, result.data[i], expected)
+	for i := 0; i < input.NumLanes(); i++ {
+		expected := uint16(input.data()[i])
+		if result.data()[i] != expected {
+			t.Errorf("PromoteU8ToU16 lane %d: got %v, want %v", i, result.data()[i], expected)
 		}
 	}
 }
 
 func TestPromoteU16ToU32(t *testing.T) {
-	input := Vec[uint16]{data: []uint16{0, 1, 32767, 32768, 65535}}
+	input := vecFrom([]uint16{0, 1, 32767, 32768, 65535})
 	result := PromoteU16ToU32(input)
 
-	for i := 0; i < len(input.data); i++ {
-		expected := uint32(input.data[i])
-		if result.data[i] != expected {
-			t.Errorf("PromoteU16ToU32 lane %d: got %v, want %v", i, result.data[i], expected)
+	for i := 0; i < input.NumLanes(); i++ {
+		expected := uint32(input.data()[i])
+		if result.data()[i] != expected {
+			t.Errorf("PromoteU16ToU32 lane %d: got %v, want %v", i, result.data()[i], expected)
 		}
 	}
 }
 
 func TestPromoteU32ToU64(t *testing.T) {
-	input := Vec[uint32]{data: []uint32{0, 1, 2147483647, 2147483648, 4294967295}}
+	input := vecFrom([]uint32{0, 1, 2147483647, 2147483648, 4294967295})
 	result := PromoteU32ToU64(input)
 
-	for i := 0; i < len(input.data); i++ {
-		expected := uint64(input.data[i])
-		if result.data[i] != expected {
-			t.Errorf("PromoteU32ToU64 lane %d: got %v, want %v", i, result.data[i], expected)
+	for i := 0; i < input.NumLanes(); i++ {
+		expected := uint64(input.data()[i])
+		if result.data()[i] != expected {
+			t.Errorf("PromoteU32ToU64 lane %d: got %v, want %v", i, result.data()[i], expected)
 		}
 	}
 }
@@ -203,12 +203,12 @@ func TestDemoteI16ToI8Saturating(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			input := Vec[int16]{data: tt.input}
+			input := vecFrom(tt.input)
 			result := DemoteI16ToI8(input)
 
-			for i := 0; i < len(tt.want) && i < len(result.data); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("DemoteI16ToI8 lane %d: got %v, want %v", i, result.data[i], tt.want[i])
+			for i := 0; i < len(tt.want) && i < result.NumLanes(); i++ {
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("DemoteI16ToI8 lane %d: got %v, want %v", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -240,12 +240,12 @@ func TestDemoteI32ToI16Saturating(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			input := Vec[int32]{data: tt.input}
+			input := vecFrom(tt.input)
 			result := DemoteI32ToI16(input)
 
-			for i := 0; i < len(tt.want) && i < len(result.data); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("DemoteI32ToI16 lane %d: got %v, want %v", i, result.data[i], tt.want[i])
+			for i := 0; i < len(tt.want) && i < result.NumLanes(); i++ {
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("DemoteI32ToI16 lane %d: got %v, want %v", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -277,12 +277,12 @@ func TestDemoteI64ToI32Saturating(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			input := Vec[int64]{data: tt.input}
+			input := vecFrom(tt.input)
 			result := DemoteI64ToI32(input)
 
-			for i := 0; i < len(tt.want) && i < len(result.data); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("DemoteI64ToI32 lane %d: got %v, want %v", i, result.data[i], tt.want[i])
+			for i := 0; i < len(tt.want) && i < result.NumLanes(); i++ {
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("DemoteI64ToI32 lane %d: got %v, want %v", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -309,12 +309,12 @@ func TestDemoteU16ToU8Saturating(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			input := Vec[uint16]{data: tt.input}
+			input := vecFrom(tt.input)
 			result := DemoteU16ToU8(input)
 
-			for i := 0; i < len(tt.want) && i < len(result.data); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("DemoteU16ToU8 lane %d: got %v, want %v", i, result.data[i], tt.want[i])
+			for i := 0; i < len(tt.want) && i < result.NumLanes(); i++ {
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("DemoteU16ToU8 lane %d: got %v, want %v", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -341,12 +341,12 @@ func TestDemoteU32ToU16Saturating(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			input := Vec[uint32]{data: tt.input}
+			input := vecFrom(tt.input)
 			result := DemoteU32ToU16(input)
 
-			for i := 0; i < len(tt.want) && i < len(result.data); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("DemoteU32ToU16 lane %d: got %v, want %v", i, result.data[i], tt.want[i])
+			for i := 0; i < len(tt.want) && i < result.NumLanes(); i++ {
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("DemoteU32ToU16 lane %d: got %v, want %v", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -373,12 +373,12 @@ func TestDemoteU64ToU32Saturating(t *testing.T) {
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			input := Vec[uint64]{data: tt.input}
+			input := vecFrom(tt.input)
 			result := DemoteU64ToU32(input)
 
-			for i := 0; i < len(tt.want) && i < len(result.data); i++ {
-				if result.data[i] != tt.want[i] {
-					t.Errorf("DemoteU64ToU32 lane %d: got %v, want %v", i, result.data[i], tt.want[i])
+			for i := 0; i < len(tt.want) && i < result.NumLanes(); i++ {
+				if result.data()[i] != tt.want[i] {
+					t.Errorf("DemoteU64ToU32 lane %d: got %v, want %v", i, result.data()[i], tt.want[i])
 				}
 			}
 		})
@@ -387,105 +387,106 @@ func TestDemoteU64ToU32Saturating(t *testing.T) {
 
 func TestTruncateI16ToI8(t *testing.T) {
 	// Truncation just keeps the lower bits
-	input := Vec[int16]{data: []int16{256, 512, -256}}
+	input := vecFrom([]int16{256, 512, -256})
 	result := TruncateI16ToI8(input)
 
 	want := []int8{0, 0, 0} // Lower 8 bits of these values
 	for i := range want {
-		if result.data[i] != want[i] {
-			t.Errorf("TruncateI16ToI8 lane %d: got %v, want %v", i, result.data[i], want[i])
+		if result.data()[i] != want[i] {
+			t.Errorf("TruncateI16ToI8 lane %d: got %v, want %v", i, result.data()[i], want[i])
 		}
 	}
 }
 
 func TestTruncateI32ToI16(t *testing.T) {
-	input := Vec[int32]{data: []int32{65536, 131072, -65536}}
+	input := vecFrom([]int32{65536, 131072, -65536})
 	result := TruncateI32ToI16(input)
 
 	want := []int16{0, 0, 0}
 	for i := range want {
-		if result.data[i] != want[i] {
-			t.Errorf("TruncateI32ToI16 lane %d: got %v, want %v", i, result.data[i], want[i])
+		if result.data()[i] != want[i] {
+			t.Errorf("TruncateI32ToI16 lane %d: got %v, want %v", i, result.data()[i], want[i])
 		}
 	}
 }
 
 func TestTruncateI64ToI32(t *testing.T) {
-	input := Vec[int64]{data: []int64{4294967296, 8589934592}}
+	input := vecFrom([]int64{4294967296, 8589934592})
 	result := TruncateI64ToI32(input)
 
 	want := []int32{0, 0}
 	for i := range want {
-		if result.data[i] != want[i] {
-			t.Errorf("TruncateI64ToI32 lane %d: got %v, want %v", i, result.data[i], want[i])
+		if result.data()[i] != want[i] {
+			t.Errorf("TruncateI64ToI32 lane %d: got %v, want %v", i, result.data()[i], want[i])
 		}
 	}
 }
 
 func TestDemoteTwoI32ToI16(t *testing.T) {
-	lo := Vec[int32]{data: []int32{1, 2, 3, 4}}
-	hi := Vec[int32]{data: []int32{5, 6, 7, 8}}
+	lo := vecFrom([]int32{1, 2, 3, 4})
+	hi := vecFrom([]int32{5, 6, 7, 8})
 	result := DemoteTwoI32ToI16(lo, hi)
 
 	want := []int16{1, 2, 3, 4, 5, 6, 7, 8}
-	if len(result.data) != 8 {
-		t.Errorf("DemoteTwoI32ToI16: got %d lanes, want 8", len(result.data))
+	if result.NumLanes() != 8 {
+		t.Errorf("DemoteTwoI32ToI16: got %d lanes, want 8", result.NumLanes())
 	}
-	for i := 0; i < len(want) && i < len(result.data); i++ {
-		if result.data[i] != want[i] {
-			t.Errorf("DemoteTwoI32ToI16 lane %d: got %v, want %v", i, result.data[i], want[i])
+	for i := 0; i < len(want) && i < result.NumLanes(); i++ {
+		if result.data()[i] != want[i] {
+			t.Errorf("DemoteTwoI32ToI16 lane %d: got %v, want %v", i, result.data()[i], want[i])
 		}
 	}
 }
 
 func TestDemoteTwoI64ToI32(t *testing.T) {
-	lo := Vec[int64]{data: []int64{1, 2, 3, 4}}
-	hi := Vec[int64]{data: []int64{5, 6, 7, 8}}
+	lo := vecFrom([]int64{1, 2, 3, 4})
+	hi := vecFrom([]int64{5, 6, 7, 8})
 	result := DemoteTwoI64ToI32(lo, hi)
 
 	want := []int32{1, 2, 3, 4, 5, 6, 7, 8}
-	if len(result.data) != 8 {
-		t.Errorf("DemoteTwoI64ToI32: got %d lanes, want 8", len(result.data))
+	if result.NumLanes() != 8 {
+		t.Errorf("DemoteTwoI64ToI32: got %d lanes, want 8", result.NumLanes())
 	}
-	for i := 0; i < len(want) && i < len(result.data); i++ {
-		if result.data[i] != want[i] {
-			t.Errorf("DemoteTwoI64ToI32 lane %d: got %v, want %v", i, result.data[i], want[i])
+	for i := 0; i < len(want) && i < result.NumLanes(); i++ {
+		if result.data()[i] != want[i] {
+			t.Errorf("DemoteTwoI64ToI32 lane %d: got %v, want %v", i, result.data()[i], want[i])
 		}
 	}
 }
 
 func TestPromoteLowerUpperCombined(t *testing.T) {
 	// Test that PromoteLower and PromoteUpper together cover all lanes
-	input := Vec[int32]{data: []int32{1, 2, 3, 4, 5, 6, 7, 8}}
+	input := vecFrom([]int32{1, 2, 3, 4, 5, 6, 7, 8})
 
 	lower := PromoteLowerI32ToI64(input)
 	upper := PromoteUpperI32ToI64(input)
 
 	// Lower should have first half
-	for i := 0; i < len(lower.data); i++ {
-		expected := int64(input.data[i])
-		if lower.data[i] != expected {
-			t.Errorf("PromoteLowerI32ToI64 lane %d: got %v, want %v", i, lower.data[i], expected)
+	for i := 0; i < lower.NumLanes(); i++ {
+		expected := int64(input.data()[i])
+		if lower.data()[i] != expected {
+			t.Errorf("PromoteLowerI32ToI64 lane %d: got %v, want %v", i, lower.data()[i], expected)
 		}
 	}
 
 	// Upper should have second half
-	half := len(input.data) / 2
-	for i := 0; i < len(upper.data); i++ {
-		expected := int64(input.data[half+i])
-		if upper.data[i] != expected {
-			t.Errorf("PromoteUpperI32ToI64 lane %d: got %v, want %v", i, upper.data[i], expected)
+	half := input.NumLanes() / 2
+	for i := 0; i < upper.NumLanes(); i++ {
+		expected := int64(input.data()[half+i])
+		if upper.data()[i] != expected {
+			t.Errorf("PromoteUpperI32ToI64 lane %d: got %v, want %v", i, upper.data()[i], expected)
 		}
 	}
 }
 
 // Benchmark tests
 func BenchmarkPromoteF32ToF64(b *testing.B) {
-	data := make([]float32, 8)
+	out := makeVec[float32](8)
+	data := out.data()
 	for i := range data {
 		data[i] = float32(i)
 	}
-	v := Vec[float32]{data: data}
+	v := out
 
 	for b.Loop() {
 		_ = PromoteF32ToF64(v)
@@ -493,11 +494,12 @@ func BenchmarkPromoteF32ToF64(b *testing.B) {
 }
 
 func BenchmarkDemoteF64ToF32(b *testing.B) {
-	data := make([]float64, 8)
+	out := makeVec[float64](8)
+	data := out.data()
 	for i := range data {
 		data[i] = float64(i)
 	}
-	v := Vec[float64]{data: data}
+	v := out
 
 	for b.Loop() {
 		_ = DemoteF64ToF32(v)
@@ -505,11 +507,12 @@ func BenchmarkDemoteF64ToF32(b *testing.B) {
 }
 
 func BenchmarkPromoteI32ToI64(b *testing.B) {
-	data := make([]int32, 8)
+	out := makeVec[int32](8)
+	data := out.data()
 	for i := range data {
 		data[i] = int32(i)
 	}
-	v := Vec[int32]{data: data}
+	v := out
 
 	for b.Loop() {
 		_ = PromoteI32ToI64(v)
@@ -517,11 +520,12 @@ func BenchmarkPromoteI32ToI64(b *testing.B) {
 }
 
 func BenchmarkDemoteI64ToI32Saturating(b *testing.B) {
-	data := make([]int64, 8)
+	out := makeVec[int64](8)
+	data := out.data()
 	for i := range data {
 		data[i] = int64(i * 1000000000)
 	}
-	v := Vec[int64]{data: data}
+	v := out
 
 	for b.Loop() {
 		_ = DemoteI64ToI32(v)
@@ -23,76 +23,82 @@ import "math"
 // Results are clamped to the type's valid range instead of wrapping.
 // For example, uint8: 250 + 10 = 255 (not 4)
 func SaturatedAdd[T Integers](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		result[i] = saturatedAdd(a.data[i], b.data[i])
+		result[i] = saturatedAdd(a.data()[i], b.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // SaturatedSub performs element-wise subtraction with saturation.
 // Results are clamped to the type's valid range instead of wrapping.
 // For example, uint8: 10 - 20 = 0 (not 246)
 func SaturatedSub[T Integers](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		result[i] = saturatedSub(a.data[i], b.data[i])
+		result[i] = saturatedSub(a.data()[i], b.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Clamp clamps each element to the range [lo, hi].
 // Elements less than lo become lo, elements greater than hi become hi.
 func Clamp[T Lanes](v, lo, hi Vec[T]) Vec[T] {
-	n := min(len(hi.data), min(len(lo.data), len(v.data)))
-	result := make([]T, n)
+	n := min(hi.NumLanes(), min(lo.NumLanes(), v.NumLanes()))
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		val := v.data[i]
-		if val < lo.data[i] {
-			val = lo.data[i]
+		val := v.data()[i]
+		if val < lo.data()[i] {
+			val = lo.data()[i]
 		}
-		if val > hi.data[i] {
-			val = hi.data[i]
+		if val > hi.data()[i] {
+			val = hi.data()[i]
 		}
 		result[i] = val
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // AbsDiff computes the absolute difference |a - b| for each element.
 // For unsigned types, this is max(a,b) - min(a,b).
 // For signed types, this is |a - b|.
 func AbsDiff[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		result[i] = absDiff(a.data[i], b.data[i])
+		result[i] = absDiff(a.data()[i], b.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Avg computes the rounded average (a + b + 1) / 2 for each element.
 // This is useful for image processing and avoids overflow.
 func Avg[T Integers](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		result[i] = roundedAvg(a.data[i], b.data[i])
+		result[i] = roundedAvg(a.data()[i], b.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // MulHigh returns the high bits of the widening multiplication a * b.
 // For n-bit integers, multiplying produces 2n bits; this returns the upper n bits.
 func MulHigh[T Integers](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		result[i] = mulHigh(a.data[i], b.data[i])
+		result[i] = mulHigh(a.data()[i], b.data()[i])
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Helper functions for saturated arithmetic
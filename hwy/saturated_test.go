@@ -26,8 +26,8 @@ func TestSaturatedAddUint8(t *testing.T) {
 
 	expected := []uint8{255, 150, 100, 255} // 250+10 saturates to 255
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("SaturatedAdd uint8: lane %d: got %d, want %d", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("SaturatedAdd uint8: lane %d: got %d, want %d", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -39,8 +39,8 @@ func TestSaturatedAddInt8(t *testing.T) {
 
 	expected := []int8{127, -128, 100, -100} // 120+10=130 saturates to 127
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("SaturatedAdd int8: lane %d: got %d, want %d", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("SaturatedAdd int8: lane %d: got %d, want %d", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -52,8 +52,8 @@ func TestSaturatedAddUint16(t *testing.T) {
 
 	expected := []uint16{65535, 150, 100, 65535}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("SaturatedAdd uint16: lane %d: got %d, want %d", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("SaturatedAdd uint16: lane %d: got %d, want %d", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -65,8 +65,8 @@ func TestSaturatedSubUint8(t *testing.T) {
 
 	expected := []uint8{0, 50, 0, 254} // 10-20 saturates to 0
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("SaturatedSub uint8: lane %d: got %d, want %d", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("SaturatedSub uint8: lane %d: got %d, want %d", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -78,8 +78,8 @@ func TestSaturatedSubInt8(t *testing.T) {
 
 	expected := []int8{-128, 127, 0, 0} // -120-10=-130 saturates to -128
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("SaturatedSub int8: lane %d: got %d, want %d", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("SaturatedSub int8: lane %d: got %d, want %d", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -92,8 +92,8 @@ func TestClamp(t *testing.T) {
 
 	expected := []float32{0, 0, 5, 10, 10}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("Clamp: lane %d: got %f, want %f", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("Clamp: lane %d: got %f, want %f", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -106,8 +106,8 @@ func TestClampInt(t *testing.T) {
 
 	expected := []int32{-25, -25, 0, 25, 25}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("Clamp int: lane %d: got %d, want %d", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("Clamp int: lane %d: got %d, want %d", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -119,8 +119,8 @@ func TestAbsDiff(t *testing.T) {
 
 	expected := []float32{5, 5, 5, 5}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("AbsDiff: lane %d: got %f, want %f", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("AbsDiff: lane %d: got %f, want %f", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -132,8 +132,8 @@ func TestAbsDiffUint(t *testing.T) {
 
 	expected := []uint32{5, 5, 50, 50}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("AbsDiff uint: lane %d: got %d, want %d", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("AbsDiff uint: lane %d: got %d, want %d", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -146,8 +146,8 @@ func TestAvg(t *testing.T) {
 	// (a + b + 1) / 2, rounded
 	expected := []uint8{15, 25, 255, 1}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("Avg: lane %d: got %d, want %d", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("Avg: lane %d: got %d, want %d", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -164,8 +164,8 @@ func TestAvgInt(t *testing.T) {
 	// Lane 3: (5 + -4 + 1) / 2 = 2/2 = 1
 	expected := []int32{-14, 15, 1, 1}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("Avg int: lane %d: got %d, want %d", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("Avg int: lane %d: got %d, want %d", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -178,8 +178,8 @@ func TestMulHigh(t *testing.T) {
 	// High 16 bits of product
 	expected := []uint16{0x4000, 0x1000, 0x0100, 0x0001}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("MulHigh: lane %d: got 0x%04X, want 0x%04X", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("MulHigh: lane %d: got 0x%04X, want 0x%04X", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -193,8 +193,8 @@ func TestMulHighSigned(t *testing.T) {
 	// -0x4000 * 0x4000 = -0x10000000, high 16 bits = -0x1000
 	expected := []int16{0x1000, -0x1000, 0x0100, 0x0100}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("MulHigh signed: lane %d: got 0x%04X, want 0x%04X", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("MulHigh signed: lane %d: got 0x%04X, want 0x%04X", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -341,17 +341,17 @@ func TestIfThenElseZero(t *testing.T) {
 	a := Set[float32](100.0)
 	result := IfThenElseZero(mask, a)
 
-	if result.data[0] != 100.0 {
-		t.Errorf("IfThenElseZero: lane 0: got %v, want 100.0", result.data[0])
+	if result.data()[0] != 100.0 {
+		t.Errorf("IfThenElseZero: lane 0: got %v, want 100.0", result.data()[0])
 	}
-	if result.data[1] != 0.0 {
-		t.Errorf("IfThenElseZero: lane 1: got %v, want 0.0", result.data[1])
+	if result.data()[1] != 0.0 {
+		t.Errorf("IfThenElseZero: lane 1: got %v, want 0.0", result.data()[1])
 	}
-	if result.data[2] != 100.0 {
-		t.Errorf("IfThenElseZero: lane 2: got %v, want 100.0", result.data[2])
+	if result.data()[2] != 100.0 {
+		t.Errorf("IfThenElseZero: lane 2: got %v, want 100.0", result.data()[2])
 	}
-	if result.data[3] != 0.0 {
-		t.Errorf("IfThenElseZero: lane 3: got %v, want 0.0", result.data[3])
+	if result.data()[3] != 0.0 {
+		t.Errorf("IfThenElseZero: lane 3: got %v, want 0.0", result.data()[3])
 	}
 }
 
@@ -363,17 +363,17 @@ func TestIfThenZeroElse(t *testing.T) {
 	b := Set[float32](200.0)
 	result := IfThenZeroElse(mask, b)
 
-	if result.data[0] != 0.0 {
-		t.Errorf("IfThenZeroElse: lane 0: got %v, want 0.0", result.data[0])
+	if result.data()[0] != 0.0 {
+		t.Errorf("IfThenZeroElse: lane 0: got %v, want 0.0", result.data()[0])
 	}
-	if result.data[1] != 200.0 {
-		t.Errorf("IfThenZeroElse: lane 1: got %v, want 200.0", result.data[1])
+	if result.data()[1] != 200.0 {
+		t.Errorf("IfThenZeroElse: lane 1: got %v, want 200.0", result.data()[1])
 	}
-	if result.data[2] != 0.0 {
-		t.Errorf("IfThenZeroElse: lane 2: got %v, want 0.0", result.data[2])
+	if result.data()[2] != 0.0 {
+		t.Errorf("IfThenZeroElse: lane 2: got %v, want 0.0", result.data()[2])
 	}
-	if result.data[3] != 200.0 {
-		t.Errorf("IfThenZeroElse: lane 3: got %v, want 200.0", result.data[3])
+	if result.data()[3] != 200.0 {
+		t.Errorf("IfThenZeroElse: lane 3: got %v, want 200.0", result.data()[3])
 	}
 }
 
@@ -383,8 +383,8 @@ func TestZeroIfNegative(t *testing.T) {
 
 	expected := []float32{0, 0, 5, 0}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("ZeroIfNegative: lane %d: got %f, want %f", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("ZeroIfNegative: lane %d: got %f, want %f", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -395,8 +395,8 @@ func TestZeroIfNegativeInt(t *testing.T) {
 
 	expected := []int32{0, 0, 100, 0}
 	for i := 0; i < len(expected) && i < result.NumLanes(); i++ {
-		if result.data[i] != expected[i] {
-			t.Errorf("ZeroIfNegative int: lane %d: got %d, want %d", i, result.data[i], expected[i])
+		if result.data()[i] != expected[i] {
+			t.Errorf("ZeroIfNegative int: lane %d: got %d, want %d", i, result.data()[i], expected[i])
 		}
 	}
 }
@@ -20,233 +20,249 @@ package hwy
 
 // Reverse reverses the order of lanes in the vector.
 func Reverse[T Lanes](v Vec[T]) Vec[T] {
-	n := len(v.data)
-	result := make([]T, n)
+	n := v.NumLanes()
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
-		result[i] = v.data[n-1-i]
+		result[i] = v.data()[n-1-i]
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Broadcast broadcasts a single lane to all lanes in the vector.
 func Broadcast[T Lanes](v Vec[T], lane int) Vec[T] {
-	n := len(v.data)
+	n := v.NumLanes()
 	if lane < 0 || lane >= n {
 		// Return zero vector if lane is out of bounds
 		return Zero[T]()
 	}
-	result := make([]T, n)
-	value := v.data[lane]
+	resultVec := makeVec[T](n)
+	result := resultVec.data()
+	value := v.data()[lane]
 	for i := range result {
 		result[i] = value
 	}
-	return Vec[T]{data: result}
+	return resultVec
 }
 
 // Reverse2 reverses pairs of lanes.
 // [0,1,2,3,4,5,6,7] -> [1,0,3,2,5,4,7,6]
 func Reverse2[T Lanes](v Vec[T]) Vec[T] {
-	n := len(v.data)
-	result := make([]T, n)
+	n := v.NumLanes()
+	out := makeVec[T](n)
+	result := out.data()
 	for i := 0; i < n-1; i += 2 {
-		result[i] = v.data[i+1]
-		result[i+1] = v.data[i]
+		result[i] = v.data()[i+1]
+		result[i+1] = v.data()[i]
 	}
 	// Handle odd lane count (copy last element)
 	if n%2 == 1 {
-		result[n-1] = v.data[n-1]
+		result[n-1] = v.data()[n-1]
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Reverse4 reverses groups of 4 lanes.
 // [0,1,2,3,4,5,6,7] -> [3,2,1,0,7,6,5,4]
 func Reverse4[T Lanes](v Vec[T]) Vec[T] {
-	n := len(v.data)
-	result := make([]T, n)
+	n := v.NumLanes()
+	out := makeVec[T](n)
+	result := out.data()
 	for i := 0; i < n; i += 4 {
 		remaining := n - i
 		if remaining >= 4 {
-			result[i] = v.data[i+3]
-			result[i+1] = v.data[i+2]
-			result[i+2] = v.data[i+1]
-			result[i+3] = v.data[i]
+			result[i] = v.data()[i+3]
+			result[i+1] = v.data()[i+2]
+			result[i+2] = v.data()[i+1]
+			result[i+3] = v.data()[i]
 		} else {
 			// Handle partial group at end
 			for j := range remaining {
-				result[i+j] = v.data[i+remaining-1-j]
+				result[i+j] = v.data()[i+remaining-1-j]
 			}
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Reverse8 reverses groups of 8 lanes.
 // [0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15] -> [7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8]
 func Reverse8[T Lanes](v Vec[T]) Vec[T] {
-	n := len(v.data)
-	result := make([]T, n)
+	n := v.NumLanes()
+	resultVec := makeVec[T](n)
+	result := resultVec.data()
 	for i := 0; i < n; i += 8 {
 		remaining := n - i
 		if remaining >= 8 {
 			for j := range 8 {
-				result[i+j] = v.data[i+7-j]
+				result[i+j] = v.data()[i+7-j]
 			}
 		} else {
 			// Handle partial group at end
 			for j := range remaining {
-				result[i+j] = v.data[i+remaining-1-j]
+				result[i+j] = v.data()[i+remaining-1-j]
 			}
 		}
 	}
-	return Vec[T]{data: result}
+	return resultVec
 }
 
 // GetLane extracts a single lane value from the vector.
 // Returns zero value if index is out of bounds.
 func GetLane[T Lanes](v Vec[T], idx int) T {
-	if idx < 0 || idx >= len(v.data) {
+	if idx < 0 || idx >= v.NumLanes() {
 		var zero T
 		return zero
 	}
-	return v.data[idx]
+	return v.data()[idx]
 }
 
 // InsertLane returns a new vector with the value inserted at the given lane.
 // Returns original vector if index is out of bounds.
 func InsertLane[T Lanes](v Vec[T], idx int, val T) Vec[T] {
-	n := len(v.data)
+	n := v.NumLanes()
 	if idx < 0 || idx >= n {
 		return v
 	}
-	result := make([]T, n)
-	copy(result, v.data)
+	out := makeVec[T](n)
+	result := out.data()
+	copy(result, v.data())
 	result[idx] = val
-	return Vec[T]{data: result}
+	return out
 }
 
 // InterleaveLower interleaves the lower halves of two vectors.
 // [a0,a1,a2,a3], [b0,b1,b2,b3] -> [a0,b0,a1,b1]
 func InterleaveLower[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
+	n := min(b.NumLanes(), a.NumLanes())
 	half := n / 2
-	result := make([]T, n)
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range half {
-		result[2*i] = a.data[i]
-		result[2*i+1] = b.data[i]
+		result[2*i] = a.data()[i]
+		result[2*i+1] = b.data()[i]
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // InterleaveUpper interleaves the upper halves of two vectors.
 // [a0,a1,a2,a3], [b0,b1,b2,b3] -> [a2,b2,a3,b3]
 func InterleaveUpper[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
+	n := min(b.NumLanes(), a.NumLanes())
 	half := n / 2
-	result := make([]T, n)
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range half {
-		result[2*i] = a.data[half+i]
-		result[2*i+1] = b.data[half+i]
+		result[2*i] = a.data()[half+i]
+		result[2*i+1] = b.data()[half+i]
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // ConcatLowerLower concatenates the lower halves of two vectors.
 // [a0,a1,a2,a3], [b0,b1,b2,b3] -> [a0,a1,b0,b1]
 func ConcatLowerLower[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
+	n := min(b.NumLanes(), a.NumLanes())
 	half := n / 2
-	result := make([]T, n)
-	copy(result[:half], a.data[:half])
-	copy(result[half:], b.data[:half])
-	return Vec[T]{data: result}
+	out := makeVec[T](n)
+	result := out.data()
+	copy(result[:half], a.data()[:half])
+	copy(result[half:], b.data()[:half])
+	return out
 }
 
 // ConcatUpperUpper concatenates the upper halves of two vectors.
 // [a0,a1,a2,a3], [b0,b1,b2,b3] -> [a2,a3,b2,b3]
 func ConcatUpperUpper[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
+	n := min(b.NumLanes(), a.NumLanes())
 	half := n / 2
-	result := make([]T, n)
-	copy(result[:half], a.data[half:])
-	copy(result[half:], b.data[half:])
-	return Vec[T]{data: result}
+	out := makeVec[T](n)
+	result := out.data()
+	copy(result[:half], a.data()[half:])
+	copy(result[half:], b.data()[half:])
+	return out
 }
 
 // ConcatLowerUpper concatenates lower half of a with upper half of b.
 // [a0,a1,a2,a3], [b0,b1,b2,b3] -> [a0,a1,b2,b3]
 func ConcatLowerUpper[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
+	n := min(b.NumLanes(), a.NumLanes())
 	half := n / 2
-	result := make([]T, n)
-	copy(result[:half], a.data[:half])
-	copy(result[half:], b.data[half:])
-	return Vec[T]{data: result}
+	out := makeVec[T](n)
+	result := out.data()
+	copy(result[:half], a.data()[:half])
+	copy(result[half:], b.data()[half:])
+	return out
 }
 
 // ConcatUpperLower concatenates upper half of a with lower half of b.
 // [a0,a1,a2,a3], [b0,b1,b2,b3] -> [a2,a3,b0,b1]
 func ConcatUpperLower[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
+	n := min(b.NumLanes(), a.NumLanes())
 	half := n / 2
-	result := make([]T, n)
-	copy(result[:half], a.data[half:])
-	copy(result[half:], b.data[:half])
-	return Vec[T]{data: result}
+	out := makeVec[T](n)
+	result := out.data()
+	copy(result[:half], a.data()[half:])
+	copy(result[half:], b.data()[:half])
+	return out
 }
 
 // OddEven combines odd lanes from a with even lanes from b.
 // Returns a vector where even indices have b's values and odd indices have a's values.
 // [a0,a1,a2,a3], [b0,b1,b2,b3] -> [b0,a1,b2,a3]
 func OddEven[T Lanes](a, b Vec[T]) Vec[T] {
-	n := min(len(b.data), len(a.data))
-	result := make([]T, n)
+	n := min(b.NumLanes(), a.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 	for i := range n {
 		if i%2 == 0 {
-			result[i] = b.data[i]
+			result[i] = b.data()[i]
 		} else {
-			result[i] = a.data[i]
+			result[i] = a.data()[i]
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // DupEven duplicates even lanes.
 // [a0,a1,a2,a3] -> [a0,a0,a2,a2]
 func DupEven[T Lanes](v Vec[T]) Vec[T] {
-	n := len(v.data)
-	result := make([]T, n)
+	n := v.NumLanes()
+	out := makeVec[T](n)
+	result := out.data()
 	for i := 0; i < n; i += 2 {
-		result[i] = v.data[i]
+		result[i] = v.data()[i]
 		if i+1 < n {
-			result[i+1] = v.data[i]
+			result[i+1] = v.data()[i]
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // DupOdd duplicates odd lanes.
 // [a0,a1,a2,a3] -> [a1,a1,a3,a3]
 func DupOdd[T Lanes](v Vec[T]) Vec[T] {
-	n := len(v.data)
-	result := make([]T, n)
+	n := v.NumLanes()
+	out := makeVec[T](n)
+	result := out.data()
 	for i := 0; i < n; i += 2 {
 		if i+1 < n {
-			result[i] = v.data[i+1]
-			result[i+1] = v.data[i+1]
+			result[i] = v.data()[i+1]
+			result[i+1] = v.data()[i+1]
 		} else {
-			result[i] = v.data[i]
+			result[i] = v.data()[i]
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // SwapAdjacentBlocks swaps adjacent 128-bit blocks.
 // For AVX2 (256-bit), this swaps the two 128-bit halves.
 // For AVX-512 (512-bit), this swaps pairs of 128-bit blocks.
 func SwapAdjacentBlocks[T Lanes](v Vec[T]) Vec[T] {
-	n := len(v.data)
-	result := make([]T, n)
+	n := v.NumLanes()
+	out := makeVec[T](n)
+	result := out.data()
 
 	// Calculate 128-bit block size in lanes
 	var dummy T
@@ -260,14 +276,14 @@ func SwapAdjacentBlocks[T Lanes](v Vec[T]) Vec[T] {
 	for i := 0; i < n; i += 2 * blockLanes {
 		if i+2*blockLanes <= n {
 			// Swap blocks
-			copy(result[i:i+blockLanes], v.data[i+blockLanes:i+2*blockLanes])
-			copy(result[i+blockLanes:i+2*blockLanes], v.data[i:i+blockLanes])
+			copy(result[i:i+blockLanes], v.data()[i+blockLanes:i+2*blockLanes])
+			copy(result[i+blockLanes:i+2*blockLanes], v.data()[i:i+blockLanes])
 		} else {
 			// Copy remaining lanes
-			copy(result[i:], v.data[i:])
+			copy(result[i:], v.data()[i:])
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // TableLookupBytes performs a byte-level table lookup.
@@ -275,18 +291,19 @@ func SwapAdjacentBlocks[T Lanes](v Vec[T]) Vec[T] {
 // This is a scalar fallback; SIMD versions use PSHUFB/TBL instructions.
 func TableLookupBytes[T Lanes](tbl, idx Vec[T]) Vec[T] {
 	// Convert to bytes, lookup, convert back
-	n := min(len(idx.data), len(tbl.data))
-	result := make([]T, n)
+	n := min(idx.NumLanes(), tbl.NumLanes())
+	out := makeVec[T](n)
+	result := out.data()
 
 	// For scalar fallback, treat each lane as a lookup index
 	for i := range n {
-		idxVal := int(idx.data[i])
+		idxVal := int(idx.data()[i])
 		if idxVal >= 0 && idxVal < n {
-			result[i] = tbl.data[idxVal]
+			result[i] = tbl.data()[idxVal]
 		}
 		// else: leave as zero
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // TableLookupLanes performs a lane-level table lookup.
@@ -294,33 +311,35 @@ func TableLookupBytes[T Lanes](tbl, idx Vec[T]) Vec[T] {
 // Unlike TableLookupBytes which works at byte granularity,
 // this operates on full lanes (elements).
 func TableLookupLanes[T Lanes](tbl Vec[T], idx Vec[int32]) Vec[T] {
-	n := min(len(idx.data), len(tbl.data))
-	result := make([]T, n)
+	n := min(idx.NumLanes(), tbl.NumLanes())
+	resultVec := makeVec[T](n)
+	result := resultVec.data()
 
 	for i := range n {
-		idxVal := int(idx.data[i])
-		if idxVal >= 0 && idxVal < len(tbl.data) {
-			result[i] = tbl.data[idxVal]
+		idxVal := int(idx.data()[i])
+		if idxVal >= 0 && idxVal < tbl.NumLanes() {
+			result[i] = tbl.data()[idxVal]
 		}
 		// else: leave as zero
 	}
-	return Vec[T]{data: result}
+	return resultVec
 }
 
 // TableLookupLanesOr returns fallback[i] when idx[i] is out of bounds.
 func TableLookupLanesOr[T Lanes](tbl Vec[T], idx Vec[int32], fallback Vec[T]) Vec[T] {
-	n := min(len(fallback.data), min(len(idx.data), len(tbl.data)))
-	result := make([]T, n)
+	n := min(fallback.NumLanes(), min(idx.NumLanes(), tbl.NumLanes()))
+	out := makeVec[T](n)
+	result := out.data()
 
 	for i := range n {
-		idxVal := int(idx.data[i])
-		if idxVal >= 0 && idxVal < len(tbl.data) {
-			result[i] = tbl.data[idxVal]
+		idxVal := int(idx.data()[i])
+		if idxVal >= 0 && idxVal < tbl.NumLanes() {
+			result[i] = tbl.data()[idxVal]
 		} else {
-			result[i] = fallback.data[i]
+			result[i] = fallback.data()[i]
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // ZipLower interleaves the lower halves of two vectors into one.
@@ -341,33 +360,35 @@ func ZipUpper[T Lanes](a, b Vec[T]) Vec[T] {
 // Each index specifies which lane from the source to place in that position.
 // For example: Shuffle0123(v, 3, 2, 1, 0) reverses a 4-lane vector.
 func Shuffle0123[T Lanes](v Vec[T], i0, i1, i2, i3 int) Vec[T] {
-	n := len(v.data)
+	n := v.NumLanes()
 	if n < 4 {
 		return v
 	}
-	result := make([]T, n)
+	out := makeVec[T](n)
+	result := out.data()
 
 	// Process in groups of 4
 	for base := 0; base < n; base += 4 {
 		if base+4 <= n {
-			result[base+0] = v.data[base+i0]
-			result[base+1] = v.data[base+i1]
-			result[base+2] = v.data[base+i2]
-			result[base+3] = v.data[base+i3]
+			result[base+0] = v.data()[base+i0]
+			result[base+1] = v.data()[base+i1]
+			result[base+2] = v.data()[base+i2]
+			result[base+3] = v.data()[base+i3]
 		} else {
 			// Copy remaining
-			copy(result[base:], v.data[base:])
+			copy(result[base:], v.data()[base:])
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // Per4LaneBlockShuffle performs a complex shuffle within each 4-lane block.
 // pattern bits encode the shuffle: each 2-bit field selects a lane (0-3).
 // Bits [1:0] select for lane 0, bits [3:2] for lane 1, etc.
 func Per4LaneBlockShuffle[T Lanes](v Vec[T], pattern uint8) Vec[T] {
-	n := len(v.data)
-	result := make([]T, n)
+	n := v.NumLanes()
+	out := makeVec[T](n)
+	result := out.data()
 
 	// Decode pattern: 2 bits per lane
 	idx0 := int(pattern & 0x03)
@@ -378,16 +399,16 @@ func Per4LaneBlockShuffle[T Lanes](v Vec[T], pattern uint8) Vec[T] {
 	// Process in groups of 4
 	for base := 0; base < n; base += 4 {
 		if base+4 <= n {
-			result[base+0] = v.data[base+idx0]
-			result[base+1] = v.data[base+idx1]
-			result[base+2] = v.data[base+idx2]
-			result[base+3] = v.data[base+idx3]
+			result[base+0] = v.data()[base+idx0]
+			result[base+1] = v.data()[base+idx1]
+			result[base+2] = v.data()[base+idx2]
+			result[base+3] = v.data()[base+idx3]
 		} else {
 			// Copy remaining
-			copy(result[base:], v.data[base:])
+			copy(result[base:], v.data()[base:])
 		}
 	}
-	return Vec[T]{data: result}
+	return out
 }
 
 // sizeOf returns the size in bytes of a type.
@@ -410,50 +431,52 @@ func sizeOf[T Lanes](v T) int {
 // Lower lanes are filled with zeros, upper lanes that slide out are discarded.
 // [1,2,3,4,5,6,7,8] with offset=2 -> [0,0,1,2,3,4,5,6]
 func SlideUpLanes[T Lanes](v Vec[T], offset int) Vec[T] {
-	n := len(v.data)
-	result := make([]T, n)
+	n := v.NumLanes()
+	resultVec := makeVec[T](n)
+	result := resultVec.data()
 
 	// Handle edge cases
 	if offset <= 0 {
-		copy(result, v.data)
-		return Vec[T]{data: result}
+		copy(result, v.data())
+		return resultVec
 	}
 	if offset >= n {
 		// All zeros (result is already zero-initialized)
-		return Vec[T]{data: result}
+		return resultVec
 	}
 
 	// Copy elements shifted up
-	// result[offset:n] = v.data[0:n-offset]
-	copy(result[offset:], v.data[:n-offset])
+	// result[offset:n] = v.data()[0:n-offset]
+	copy(result[offset:], v.data()[:n-offset])
 	// result[0:offset] remains zero
 
-	return Vec[T]{data: result}
+	return resultVec
 }
 
 // SlideDownLanes shifts all lanes down (toward lower indices) by the given offset.
 // Upper lanes are filled with zeros, lower lanes that slide out are discarded.
 // [1,2,3,4,5,6,7,8] with offset=2 -> [3,4,5,6,7,8,0,0]
 func SlideDownLanes[T Lanes](v Vec[T], offset int) Vec[T] {
-	n := len(v.data)
-	result := make([]T, n)
+	n := v.NumLanes()
+	out := makeVec[T](n)
+	result := out.data()
 
 	// Handle edge cases
 	if offset <= 0 {
-		copy(result, v.data)
-		return Vec[T]{data: result}
+		copy(result, v.data())
+		return out
 	}
 	if offset >= n {
 		// All zeros (result is already zero-initialized)
-		return Vec[T]{data: result}
+		return out
 	}
 
 	// Copy elements shifted down
-	// result[0:n-offset] = v.data[offset:n]
-	copy(result[:n-offset], v.data[offset:])
+	// result[0:n-offset] = v.data()[offset:n]
+	copy(result[:n-offset], v.data()[offset:])
 	// result[n-offset:n] remains zero
 
-	return Vec[T]{data: result}
+	return out
 }
 
 // Slide1Up shifts all lanes up by 1, filling the first lane with zero.
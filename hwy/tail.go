@@ -37,11 +37,11 @@ func TailMask[T Lanes](count int) Mask[T] {
 		count = maxLanes
 	}
 
-	bits := make([]bool, maxLanes)
+	bits := makeMask[T](maxLanes)
 	for i := 0; i < count; i++ {
-		bits[i] = true
+		bits.set(i, true)
 	}
-	return Mask[T]{bits: bits}
+	return bits
 }
 
 // ProcessWithTail is a helper for processing arrays with SIMD that handles
@@ -33,6 +33,11 @@
 //	hwy.StoreSlice(result, output)
 package hwy
 
+import (
+	"math/bits"
+	"unsafe"
+)
+
 // Float16Types is a constraint for half-precision float types.
 // These types use uint16 storage but represent floating-point values.
 type Float16Types interface {
@@ -72,34 +77,62 @@ type Lanes interface {
 	Floats | Integers
 }
 
+// maxVecBytes is the storage capacity of the portable Vec and Mask: the
+// widest register of any supported target (AVX-512).
+const maxVecBytes = 64
+
 // Vec is a portable vector handle that wraps SIMD operations.
-// In base (scalar) mode, it wraps a slice. In SIMD modes, it may wrap
-// architecture-specific vector types.
+// In base (scalar) mode, it holds its lanes inline in a fixed-size array,
+// so creating and passing vectors never allocates. In SIMD modes, it may
+// wrap architecture-specific vector types.
 //
 // Vec instances should not be created directly; use Load, Set, or Zero instead.
 type Vec[T Lanes] struct {
-	// data holds the vector elements in base mode.
-	// In SIMD modes, this may be empty and the actual data stored
-	// in architecture-specific fields.
-	data []T
+	// raw holds the vector elements in base mode as an [n]T array. It is
+	// declared as uint64s so that 8-byte lanes are aligned.
+	raw [maxVecBytes / 8]uint64
+	// n is the number of active lanes.
+	n int
+}
+
+// makeVec returns a zero vector with n lanes. n lanes of T must fit in
+// maxVecBytes.
+func makeVec[T Lanes](n int) Vec[T] {
+	var zero T
+	if uintptr(n)*unsafe.Sizeof(zero) > maxVecBytes {
+		panic("hwy: vector exceeds 64 bytes")
+	}
+	return Vec[T]{n: n}
+}
+
+// vecFrom returns a vector holding a copy of s.
+func vecFrom[T Lanes](s []T) Vec[T] {
+	v := makeVec[T](len(s))
+	copy(v.data(), s)
+	return v
+}
+
+// data returns the active lanes as a slice aliasing v's storage.
+func (v *Vec[T]) data() []T {
+	return unsafe.Slice((*T)(unsafe.Pointer(&v.raw)), v.n)
 }
 
 // NumLanes returns the number of lanes (elements) in this vector.
 func (v Vec[T]) NumLanes() int {
-	return len(v.data)
+	return v.n
 }
 
-// Data returns the underlying slice representation of the vector.
+// Data returns the vector elements as a slice.
 // This is primarily for testing and should not be used in performance-critical code.
 func (v Vec[T]) Data() []T {
-	return v.data
+	return v.data()
 }
 
 // Store writes the vector's data to a slice.
 // This is the method form of the hwy.Store function.
 func (v Vec[T]) Store(dst []T) {
-	n := min(len(dst), len(v.data))
-	copy(dst[:n], v.data[:n])
+	n := min(len(dst), v.n)
+	copy(dst[:n], v.data()[:n])
 }
 
 // Mask represents the result of a comparison operation.
@@ -109,51 +142,76 @@ func (v Vec[T]) Store(dst []T) {
 // Mask instances should not be created directly; use comparison operations
 // like Equal, LessThan, or GreaterThan instead.
 type Mask[T Lanes] struct {
-	// bits stores which lanes are active (true).
-	// bit i is set if lane i is active.
-	bits []bool
+	// bits stores which lanes are active: bit i is set if lane i is active.
+	// Bits at and above n are always clear.
+	bits uint64
+	// n is the number of lanes.
+	n int
+}
+
+// makeMask returns a mask with n lanes, all inactive.
+func makeMask[T Lanes](n int) Mask[T] {
+	if n > 64 {
+		panic("hwy: mask exceeds 64 lanes")
+	}
+	return Mask[T]{n: n}
+}
+
+// maskFrom returns a mask with lane i active where bits[i] is true.
+func maskFrom[T Lanes](bits []bool) Mask[T] {
+	m := makeMask[T](len(bits))
+	for i, bit := range bits {
+		m.set(i, bit)
+	}
+	return m
+}
+
+// lanesMask returns a bitmask of the low n bits.
+func lanesMask(n int) uint64 {
+	if n >= 64 {
+		return ^uint64(0)
+	}
+	return 1<<uint(n) - 1
+}
+
+// get reports whether lane i is active.
+func (m Mask[T]) get(i int) bool {
+	return m.bits>>uint(i)&1 != 0
+}
+
+// set marks lane i active or inactive.
+func (m *Mask[T]) set(i int, active bool) {
+	if active {
+		m.bits |= 1 << uint(i)
+	} else {
+		m.bits &^= 1 << uint(i)
+	}
 }
 
 // NumLanes returns the number of lanes in this mask.
 func (m Mask[T]) NumLanes() int {
-	return len(m.bits)
+	return m.n
 }
 
 // AllTrue returns true if all lanes in the mask are active.
 func (m Mask[T]) AllTrue() bool {
-	for _, bit := range m.bits {
-		if !bit {
-			return false
-		}
-	}
-	return true
+	return m.bits == lanesMask(m.n)
 }
 
 // AnyTrue returns true if at least one lane in the mask is active.
 func (m Mask[T]) AnyTrue() bool {
-	for _, bit := range m.bits {
-		if bit {
-			return true
-		}
-	}
-	return false
+	return m.bits != 0
 }
 
 // CountTrue returns the number of active lanes in the mask.
 func (m Mask[T]) CountTrue() int {
-	count := 0
-	for _, bit := range m.bits {
-		if bit {
-			count++
-		}
-	}
-	return count
+	return bits.OnesCount64(m.bits)
 }
 
 // GetBit returns whether lane i is active.
 func (m Mask[T]) GetBit(i int) bool {
-	if i < 0 || i >= len(m.bits) {
+	if i < 0 || i >= m.n {
 		return false
 	}
-	return m.bits[i]
+	return m.get(i)
 }